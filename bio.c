@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,6 +17,9 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_ASYNC: a read-ahead into the buffer is in flight. The
+//     buffer is unlocked meanwhile; bget waits for the read to
+//     finish before handing it out, and it is never recycled.
 
 #include "types.h"
 #include "defs.h"
@@ -25,70 +28,486 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "mmu.h"
+#include "memlayout.h"
+
+// Cached blocks are found through a hash table keyed on
+// (dev, blockno). The table has a bucket for every buffer the
+// cache can ever hold, so chains stay short as it grows; the
+// buckets share NBLOCK locks, and a bucket's lock also guards
+// refcnt of the buffers hashed there. Buffers nobody
+// holds (refcnt == 0) sit on a separate LRU list, the pool that
+// misses recycle from. A miss takes evictlock, so only one
+// process at a time changes which block a buffer caches.
+//
+// Lock order: evictlock, then a bucket lock, then lrulock.
+//
+// Buffers come from kalloc() a slab at a time: one page holding
+// BSLABBUFS buf headers plus the pages for their data. The cache
+// starts with enough slabs for NBUF buffers, grows on misses up
+// to a limit set from the memory kinit2() made available, and
+// hands idle slabs back when free pages run low. Slabs whose
+// buffers are all unreferenced are kept on a ring of their own,
+// so shrinking does not have to search for one.
+#define BSLABBUFS 16
+#define BSLABPAGES (BSLABBUFS*BSIZE/PGSIZE)
+#define BMINSLAB ((NBUF+BSLABBUFS-1)/BSLABBUFS + 1)
+#define BCACHEFRAC 8     // cache may use 1/BCACHEFRAC of free memory
+#define BLOWATER 256     // shrink when fewer free pages than this
+#define BMAXSLAB (BMINSLAB + PHYSTOP/PGSIZE/BCACHEFRAC/(BSLABPAGES+1))
+#define NBUCKET (BMAXSLAB*BSLABBUFS + 1)
+#define NBLOCK 61
+
+#define BNODEV (~0U)     // dev of a buffer caching nothing (not hashed)
+
+struct bslab {
+  struct bslab *next;
+  struct bslab *inext;    // idle ring, when nidle == BSLABBUFS
+  struct bslab *iprev;
+  int nidle;              // buffers on the LRU list
+  char *page[BSLABPAGES];
+  struct buf buf[BSLABBUFS];
+};
+
+struct bucket {
+  struct buf *head;       // chained through buf.hnext
+};
+
 struct {
-  struct spinlock lock;
-  struct buf buf[NBUF];
+  struct spinlock block[NBLOCK];
+  struct bucket bucket[NBUCKET];
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
+  // Protects the slab list as well.
+  struct spinlock evictlock;
+  struct bslab *slabs;
+  int nslab;
+  int maxslab;
+
+  // Linked list of unreferenced buffers, through prev/next.
+  // head.next is most recently used. Also protects the
+  // idle slab ring.
+  struct spinlock lrulock;
   struct buf head;
+  struct bslab *idle;
 } bcache;
 
+static struct bucket*
+bhash(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev ^ blockno) % NBUCKET];
+}
+
+static struct spinlock*
+block(struct bucket *bk)
+{
+  return &bcache.block[(bk - bcache.bucket) % NBLOCK];
+}
+
+// The slab header is the page the buffer's header lives in.
+static struct bslab*
+bslabof(struct buf *b)
+{
+  return (struct bslab*)PGROUNDDOWN((uint)b);
+}
+
+// b has just gone on the LRU list. Caller must hold lrulock.
+static void
+idleinc(struct buf *b)
+{
+  struct bslab *s = bslabof(b);
+
+  if(++s->nidle < BSLABBUFS)
+    return;
+  if(bcache.idle == 0){
+    s->inext = s->iprev = s;
+    bcache.idle = s;
+  } else {
+    s->inext = bcache.idle;
+    s->iprev = bcache.idle->iprev;
+    s->iprev->inext = s;
+    bcache.idle->iprev = s;
+  }
+}
+
+// b has just come off the LRU list. Caller must hold lrulock.
+static void
+idledec(struct buf *b)
+{
+  struct bslab *s = bslabof(b);
+
+  if(s->nidle-- < BSLABBUFS)
+    return;
+  if(s->inext == s)
+    bcache.idle = 0;
+  else {
+    s->iprev->inext = s->inext;
+    s->inext->iprev = s->iprev;
+    if(bcache.idle == s)
+      bcache.idle = s->inext;
+  }
+}
+
+// Put b at the MRU end of the LRU list.
+static void
+lruadd(struct buf *b)
+{
+  acquire(&bcache.lrulock);
+  b->next = bcache.head.next;
+  b->prev = &bcache.head;
+  bcache.head.next->prev = b;
+  bcache.head.next = b;
+  idleinc(b);
+  release(&bcache.lrulock);
+}
+
+// Put b at the LRU end, to be recycled first.
+static void
+lruaddtail(struct buf *b)
+{
+  acquire(&bcache.lrulock);
+  b->prev = bcache.head.prev;
+  b->next = &bcache.head;
+  bcache.head.prev->next = b;
+  bcache.head.prev = b;
+  idleinc(b);
+  release(&bcache.lrulock);
+}
+
+static void
+lruremove(struct buf *b)
+{
+  acquire(&bcache.lrulock);
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+  idledec(b);
+  release(&bcache.lrulock);
+}
+
+// Remove b from bucket bk, if it is there.
+// Caller must hold block(bk).
+static void
+unhash(struct bucket *bk, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+    if(*pp == b){
+      *pp = b->hnext;
+      break;
+    }
+  }
+}
+
+// Allocate a slab of empty buffers, not yet in the cache.
+// Takes no bcache locks, so misses needn't wait behind kalloc.
+static struct bslab*
+bslaballoc(void)
+{
+  struct bslab *s;
+  struct buf *b;
+  int i;
+
+  if((s = (struct bslab*)kalloc()) == 0)
+    return 0;
+  memset(s, 0, sizeof(*s));
+  for(i = 0; i < BSLABPAGES; i++){
+    if((s->page[i] = kalloc()) == 0){
+      while(--i >= 0)
+        kfree(s->page[i]);
+      kfree((char*)s);
+      return 0;
+    }
+  }
+  for(i = 0; i < BSLABBUFS; i++){
+    b = &s->buf[i];
+    initsleeplock(&b->lock, "buffer");
+    b->dev = BNODEV;
+    b->data = (uchar*)s->page[i*BSIZE/PGSIZE] + (i*BSIZE)%PGSIZE;
+  }
+  return s;
+}
+
+// Give a slab that is not in the cache back to kalloc.
+static void
+bslabrelease(struct bslab *s)
+{
+  int i;
+
+  for(i = 0; i < BSLABPAGES; i++)
+    kfree(s->page[i]);
+  kfree((char*)s);
+}
+
+// Add slab s to the cache.
+// Caller must hold evictlock, except during binit.
+static void
+bslabadd(struct bslab *s)
+{
+  int i;
+
+  for(i = 0; i < BSLABBUFS; i++)
+    lruaddtail(&s->buf[i]);
+  s->next = bcache.slabs;
+  bcache.slabs = s;
+  bcache.nslab++;
+}
+
+// Try to take slab s out of the cache, for bslabrelease. Every
+// buffer in it must be unreferenced and clean.
+// Caller must hold evictlock.
+static int
+bslabfree(struct bslab *s)
+{
+  struct bucket *bk;
+  struct bslab **ss;
+  struct buf *b;
+  int i, j;
+
+  // Cheap check first so busy slabs are passed over quickly.
+  for(i = 0; i < BSLABBUFS; i++)
+    if(s->buf[i].refcnt || (s->buf[i].flags & (B_DIRTY|B_ASYNC)))
+      return -1;
+
+  // Take each buffer out of the cache. If one turns out to be
+  // in use after all, put back the ones taken so far (empty).
+  for(i = 0; i < BSLABBUFS; i++){
+    b = &s->buf[i];
+    bk = bhash(b->dev, b->blockno);
+    acquire(block(bk));
+    if(b->refcnt || (b->flags & (B_DIRTY|B_ASYNC))){
+      release(block(bk));
+      for(j = 0; j < i; j++){
+        b = &s->buf[j];
+        b->dev = BNODEV;
+        b->flags = 0;
+        b->refcnt = 0;
+        lruaddtail(b);
+      }
+      return -1;
+    }
+    unhash(bk, b);
+    lruremove(b);
+    b->refcnt = 1;
+    release(block(bk));
+  }
+
+  for(ss = &bcache.slabs; *ss != s; ss = &(*ss)->next)
+    ;
+  *ss = s->next;
+  bcache.nslab--;
+  return 0;
+}
+
+// Take one idle slab out of the cache, keeping at least
+// BMINSLAB, and return it for bslabrelease once evictlock is
+// dropped. Returns 0 if there is none to spare.
+// Caller must hold evictlock.
+static struct bslab*
+bshrink(void)
+{
+  struct bslab *s;
+
+  if(bcache.nslab <= BMINSLAB)
+    return 0;
+  acquire(&bcache.lrulock);
+  s = bcache.idle;
+  release(&bcache.lrulock);
+  if(s == 0)
+    return 0;
+  if(bslabfree(s) == 0)
+    return s;
+
+  // Still holds an uncommitted block; try another one next time.
+  acquire(&bcache.lrulock);
+  if(bcache.idle == s)
+    bcache.idle = s->inext;
+  release(&bcache.lrulock);
+  return 0;
+}
+
+// Called by kalloc() when it has run out of pages.
+// Returns 0 if some memory was freed.
+int
+breclaim(void)
+{
+  struct bslab *s;
+
+  if(holding(&bcache.evictlock))
+    return -1;
+  acquire(&bcache.evictlock);
+  s = bshrink();
+  release(&bcache.evictlock);
+  if(s == 0)
+    return -1;
+  bslabrelease(s);
+  return 0;
+}
+
 void
 binit(void)
 {
-  struct buf *b;
+  struct bslab *s;
+  int i;
 
-  initlock(&bcache.lock, "bcache");
+  if(sizeof(struct bslab) > PGSIZE)
+    panic("binit: slab header");
+  initlock(&bcache.evictlock, "bcache.evict");
+  initlock(&bcache.lrulock, "bcache.lru");
+  for(i = 0; i < NBLOCK; i++)
+    initlock(&bcache.block[i], "bcache.bucket");
 
 //PAGEBREAK!
   // Create linked list of buffers
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  for(i = 0; i < BMINSLAB; i++){
+    if((s = bslaballoc()) == 0)
+      panic("binit");
+    bslabadd(s);
   }
+  bcache.maxslab = BMINSLAB;
+}
+
+// Called once all physical memory is in the page allocator:
+// let the cache grow to its share of it.
+void
+binit2(void)
+{
+  int n;
+
+  n = kfreepages() / BCACHEFRAC / (BSLABPAGES + 1);
+  if(n > BMAXSLAB)
+    n = BMAXSLAB;
+  if(n > bcache.maxslab)
+    bcache.maxslab = n;
+}
+
+// Find the buffer for dev/blockno in bk and take a reference
+// to it. Caller must hold block(bk).
+static struct buf*
+blookup(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext){
+    if(b->dev == dev && b->blockno == blockno){
+      if(b->refcnt++ == 0)
+        lruremove(b);
+      return b;
+    }
+  }
+  return 0;
 }
 
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
-// In either case, return locked buffer.
+// In either case, return locked buffer. If every buffer is
+// in use, panic, or return 0 if canfail is set.
 static struct buf*
-bget(uint dev, uint blockno)
+bget1(uint dev, uint blockno, int canfail)
 {
   struct buf *b;
+  struct bucket *bk, *obk;
+  struct bslab *s;
 
-  acquire(&bcache.lock);
+  bk = bhash(dev, blockno);
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  acquire(block(bk));
+  b = blookup(bk, dev, blockno);
+  release(block(bk));
+  if(b){
+    acquiresleep(&b->lock);
+    return b;
   }
 
-  // Not cached; recycle an unused buffer.
+  // Not cached. Grow the cache rather than evict while memory
+  // is plentiful. The slab is set up before taking evictlock and
+  // only linked in under it.
+  s = 0;
+  if(bcache.nslab < bcache.maxslab && kfreepages() >= BLOWATER)
+    s = bslaballoc();
+
+  acquire(&bcache.evictlock);
+  if(s && bcache.nslab < bcache.maxslab){
+    bslabadd(s);
+    s = 0;
+  } else if(s == 0 && kfreepages() < BLOWATER){
+    // Give some back instead; s is freed once evictlock is
+    // dropped, as is a slab that turned out not to be needed.
+    s = bshrink();
+  }
+
+  // Look again now that no one else can be adding blocks,
+  // in case another miss just brought it in.
+  acquire(block(bk));
+  b = blookup(bk, dev, blockno);
+  release(block(bk));
+  if(b){
+    release(&bcache.evictlock);
+    if(s)
+      bslabrelease(s);
+    acquiresleep(&b->lock);
+    return b;
+  }
+
+  // Recycle the least recently used unreferenced buffer.
   // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  // because log.c has modified it but not yet committed it,
+  // and B_ASYNC that the disk is still reading into it.
+  for(;;){
+    acquire(&bcache.lrulock);
+    for(b = bcache.head.prev; b != &bcache.head; b = b->prev)
+      if((b->flags & (B_DIRTY|B_ASYNC)) == 0)
+        break;
+    release(&bcache.lrulock);
+    if(b == &bcache.head){
+      if(canfail){
+        release(&bcache.evictlock);
+        if(s)
+          bslabrelease(s);
+        return 0;
+      }
+      panic("bget: no buffers");
     }
+
+    // b's identity can't change under us (we hold evictlock),
+    // but someone may have taken a reference in the meantime.
+    obk = bhash(b->dev, b->blockno);
+    acquire(block(obk));
+    if(b->refcnt == 0 && (b->flags & (B_DIRTY|B_ASYNC)) == 0)
+      break;
+    release(block(obk));
   }
-  panic("bget: no buffers");
+  unhash(obk, b);
+  lruremove(b);
+  b->refcnt = 1;
+  release(block(obk));
+
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  acquire(block(bk));
+  b->hnext = bk->head;
+  bk->head = b;
+  release(block(bk));
+  release(&bcache.evictlock);
+  if(s)
+    bslabrelease(s);
+
+  acquiresleep(&b->lock);
+  return b;
+}
+
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget1(dev, blockno, 0);
+  if(b->flags & B_ASYNC)
+    idewaitahead(b);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -104,6 +523,31 @@ bread(uint dev, uint blockno)
   return b;
 }
 
+// Start reading the indicated block into the cache, without
+// waiting for it. Does nothing if the block is already cached.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  bk = bhash(dev, blockno);
+  acquire(block(bk));
+  for(b = bk->head; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
+      break;
+  release(block(bk));
+  if(b)
+    return;
+
+  // Read-ahead is only a hint; skip it when the cache is full.
+  if((b = bget1(dev, blockno, 1)) == 0)
+    return;
+  if((b->flags & (B_VALID|B_ASYNC)) == 0)
+    idereadahead(b);
+  brelse(b);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -114,29 +558,42 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Write n buffers' contents to disk as one batch, so the disk
+// driver can merge neighbouring blocks. All must be locked and
+// for the same device (log.c only writes to log.dev).
+void
+bwritev(struct buf **bufs, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bufs[i]->lock))
+      panic("bwritev");
+    bufs[i]->flags |= B_DIRTY;
+  }
+  iderwv(bufs, n);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// If no one else holds it, move it to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
+  struct bucket *bk;
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  bk = bhash(b->dev, b->blockno);
+  acquire(block(bk));
   b->refcnt--;
   if (b->refcnt == 0) {
     // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    lruadd(b);
   }
-  
-  release(&bcache.lock);
+  release(block(bk));
 }
 //PAGEBREAK!
 // Blank page.
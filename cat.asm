@@ -0,0 +1,1306 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+char buf[512];
+int nosplice;  // stdout refused splice; don't ask again
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, moved;
+
+  // Let the kernel move the data when it can (a file or
+  // pipe into a pipe); otherwise copy it through buf.
+  if(!nosplice){
+   8:	8b 1d c0 0b 00 00    	mov    0xbc0,%ebx
+   e:	85 db                	test   %ebx,%ebx
+  10:	74 4c                	je     5e <cat+0x5e>
+      exit();
+    }
+    nosplice = 1;
+  }
+
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  12:	83 ec 04             	sub    $0x4,%esp
+  15:	68 00 02 00 00       	push   $0x200
+  1a:	68 e0 0b 00 00       	push   $0xbe0
+  1f:	56                   	push   %esi
+  20:	e8 9d 03 00 00       	call   3c2 <read>
+  25:	89 c3                	mov    %eax,%ebx
+  27:	83 c4 10             	add    $0x10,%esp
+  2a:	85 c0                	test   %eax,%eax
+  2c:	7e 6d                	jle    9b <cat+0x9b>
+    if (write(1, buf, n) != n) {
+  2e:	83 ec 04             	sub    $0x4,%esp
+  31:	53                   	push   %ebx
+  32:	68 e0 0b 00 00       	push   $0xbe0
+  37:	6a 01                	push   $0x1
+  39:	e8 8c 03 00 00       	call   3ca <write>
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	39 d8                	cmp    %ebx,%eax
+  43:	74 cd                	je     12 <cat+0x12>
+      printf(1, "cat: write error\n");
+  45:	83 ec 08             	sub    $0x8,%esp
+  48:	68 fc 07 00 00       	push   $0x7fc
+  4d:	6a 01                	push   $0x1
+  4f:	e8 fb 04 00 00       	call   54f <printf>
+      exit();
+  54:	e8 51 03 00 00       	call   3aa <exit>
+      moved = 1;
+  59:	bb 01 00 00 00       	mov    $0x1,%ebx
+    while((n = splice(fd, 1, 65536)) > 0)
+  5e:	83 ec 04             	sub    $0x4,%esp
+  61:	68 00 00 01 00       	push   $0x10000
+  66:	6a 01                	push   $0x1
+  68:	56                   	push   %esi
+  69:	e8 34 04 00 00       	call   4a2 <splice>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	85 c0                	test   %eax,%eax
+  73:	7f e4                	jg     59 <cat+0x59>
+    if(n == 0)
+  75:	74 26                	je     9d <cat+0x9d>
+    if(moved){
+  77:	85 db                	test   %ebx,%ebx
+  79:	75 0c                	jne    87 <cat+0x87>
+    nosplice = 1;
+  7b:	c7 05 c0 0b 00 00 01 	movl   $0x1,0xbc0
+  82:	00 00 00 
+  85:	eb 8b                	jmp    12 <cat+0x12>
+      printf(1, "cat: write error\n");
+  87:	83 ec 08             	sub    $0x8,%esp
+  8a:	68 fc 07 00 00       	push   $0x7fc
+  8f:	6a 01                	push   $0x1
+  91:	e8 b9 04 00 00       	call   54f <printf>
+      exit();
+  96:	e8 0f 03 00 00       	call   3aa <exit>
+    }
+  }
+  if(n < 0){
+  9b:	78 07                	js     a4 <cat+0xa4>
+    printf(1, "cat: read error\n");
+    exit();
+  }
+}
+  9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  a0:	5b                   	pop    %ebx
+  a1:	5e                   	pop    %esi
+  a2:	5d                   	pop    %ebp
+  a3:	c3                   	ret
+    printf(1, "cat: read error\n");
+  a4:	83 ec 08             	sub    $0x8,%esp
+  a7:	68 0e 08 00 00       	push   $0x80e
+  ac:	6a 01                	push   $0x1
+  ae:	e8 9c 04 00 00       	call   54f <printf>
+    exit();
+  b3:	e8 f2 02 00 00       	call   3aa <exit>
+
+000000b8 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  b8:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  bc:	83 e4 f0             	and    $0xfffffff0,%esp
+  bf:	ff 71 fc             	push   -0x4(%ecx)
+  c2:	55                   	push   %ebp
+  c3:	89 e5                	mov    %esp,%ebp
+  c5:	57                   	push   %edi
+  c6:	56                   	push   %esi
+  c7:	53                   	push   %ebx
+  c8:	51                   	push   %ecx
+  c9:	83 ec 18             	sub    $0x18,%esp
+  cc:	8b 01                	mov    (%ecx),%eax
+  ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  d1:	8b 51 04             	mov    0x4(%ecx),%edx
+  d4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+  d7:	83 f8 01             	cmp    $0x1,%eax
+  da:	7e 07                	jle    e3 <main+0x2b>
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  dc:	be 01 00 00 00       	mov    $0x1,%esi
+  e1:	eb 26                	jmp    109 <main+0x51>
+    cat(0);
+  e3:	83 ec 0c             	sub    $0xc,%esp
+  e6:	6a 00                	push   $0x0
+  e8:	e8 13 ff ff ff       	call   0 <cat>
+    exit();
+  ed:	e8 b8 02 00 00       	call   3aa <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  f2:	83 ec 0c             	sub    $0xc,%esp
+  f5:	50                   	push   %eax
+  f6:	e8 05 ff ff ff       	call   0 <cat>
+    close(fd);
+  fb:	89 1c 24             	mov    %ebx,(%esp)
+  fe:	e8 cf 02 00 00       	call   3d2 <close>
+  for(i = 1; i < argc; i++){
+ 103:	83 c6 01             	add    $0x1,%esi
+ 106:	83 c4 10             	add    $0x10,%esp
+ 109:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 10c:	39 c6                	cmp    %eax,%esi
+ 10e:	7d 31                	jge    141 <main+0x89>
+    if((fd = open(argv[i], 0)) < 0){
+ 110:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 113:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+ 116:	83 ec 08             	sub    $0x8,%esp
+ 119:	6a 00                	push   $0x0
+ 11b:	ff 37                	push   (%edi)
+ 11d:	e8 c8 02 00 00       	call   3ea <open>
+ 122:	89 c3                	mov    %eax,%ebx
+ 124:	83 c4 10             	add    $0x10,%esp
+ 127:	85 c0                	test   %eax,%eax
+ 129:	79 c7                	jns    f2 <main+0x3a>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+ 12b:	83 ec 04             	sub    $0x4,%esp
+ 12e:	ff 37                	push   (%edi)
+ 130:	68 1f 08 00 00       	push   $0x81f
+ 135:	6a 01                	push   $0x1
+ 137:	e8 13 04 00 00       	call   54f <printf>
+      exit();
+ 13c:	e8 69 02 00 00       	call   3aa <exit>
+  }
+  exit();
+ 141:	e8 64 02 00 00       	call   3aa <exit>
+
+00000146 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 146:	55                   	push   %ebp
+ 147:	89 e5                	mov    %esp,%ebp
+ 149:	56                   	push   %esi
+ 14a:	53                   	push   %ebx
+ 14b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 14e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 151:	89 f0                	mov    %esi,%eax
+ 153:	89 d1                	mov    %edx,%ecx
+ 155:	83 c2 01             	add    $0x1,%edx
+ 158:	89 c3                	mov    %eax,%ebx
+ 15a:	83 c0 01             	add    $0x1,%eax
+ 15d:	0f b6 09             	movzbl (%ecx),%ecx
+ 160:	88 0b                	mov    %cl,(%ebx)
+ 162:	84 c9                	test   %cl,%cl
+ 164:	75 ed                	jne    153 <strcpy+0xd>
+    ;
+  return os;
+}
+ 166:	89 f0                	mov    %esi,%eax
+ 168:	5b                   	pop    %ebx
+ 169:	5e                   	pop    %esi
+ 16a:	5d                   	pop    %ebp
+ 16b:	c3                   	ret
+
+0000016c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 16c:	55                   	push   %ebp
+ 16d:	89 e5                	mov    %esp,%ebp
+ 16f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 172:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 175:	eb 06                	jmp    17d <strcmp+0x11>
+    p++, q++;
+ 177:	83 c1 01             	add    $0x1,%ecx
+ 17a:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 17d:	0f b6 01             	movzbl (%ecx),%eax
+ 180:	84 c0                	test   %al,%al
+ 182:	74 04                	je     188 <strcmp+0x1c>
+ 184:	3a 02                	cmp    (%edx),%al
+ 186:	74 ef                	je     177 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 188:	0f b6 c0             	movzbl %al,%eax
+ 18b:	0f b6 12             	movzbl (%edx),%edx
+ 18e:	29 d0                	sub    %edx,%eax
+}
+ 190:	5d                   	pop    %ebp
+ 191:	c3                   	ret
+
+00000192 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 192:	55                   	push   %ebp
+ 193:	89 e5                	mov    %esp,%ebp
+ 195:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 198:	b8 00 00 00 00       	mov    $0x0,%eax
+ 19d:	eb 03                	jmp    1a2 <strlen+0x10>
+ 19f:	83 c0 01             	add    $0x1,%eax
+ 1a2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1a6:	75 f7                	jne    19f <strlen+0xd>
+    ;
+  return n;
+}
+ 1a8:	5d                   	pop    %ebp
+ 1a9:	c3                   	ret
+
+000001aa <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1aa:	55                   	push   %ebp
+ 1ab:	89 e5                	mov    %esp,%ebp
+ 1ad:	57                   	push   %edi
+ 1ae:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1b1:	89 d7                	mov    %edx,%edi
+ 1b3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1b9:	fc                   	cld
+ 1ba:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1bc:	89 d0                	mov    %edx,%eax
+ 1be:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1c1:	c9                   	leave
+ 1c2:	c3                   	ret
+
+000001c3 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1c3:	55                   	push   %ebp
+ 1c4:	89 e5                	mov    %esp,%ebp
+ 1c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1cd:	eb 03                	jmp    1d2 <strchr+0xf>
+ 1cf:	83 c0 01             	add    $0x1,%eax
+ 1d2:	0f b6 10             	movzbl (%eax),%edx
+ 1d5:	84 d2                	test   %dl,%dl
+ 1d7:	74 06                	je     1df <strchr+0x1c>
+    if(*s == c)
+ 1d9:	38 ca                	cmp    %cl,%dl
+ 1db:	75 f2                	jne    1cf <strchr+0xc>
+ 1dd:	eb 05                	jmp    1e4 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 1df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1e4:	5d                   	pop    %ebp
+ 1e5:	c3                   	ret
+
+000001e6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1e6:	55                   	push   %ebp
+ 1e7:	89 e5                	mov    %esp,%ebp
+ 1e9:	57                   	push   %edi
+ 1ea:	56                   	push   %esi
+ 1eb:	53                   	push   %ebx
+ 1ec:	83 ec 1c             	sub    $0x1c,%esp
+ 1ef:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1f7:	89 de                	mov    %ebx,%esi
+ 1f9:	83 c3 01             	add    $0x1,%ebx
+ 1fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1ff:	7d 2e                	jge    22f <gets+0x49>
+    cc = read(0, &c, 1);
+ 201:	83 ec 04             	sub    $0x4,%esp
+ 204:	6a 01                	push   $0x1
+ 206:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 209:	50                   	push   %eax
+ 20a:	6a 00                	push   $0x0
+ 20c:	e8 b1 01 00 00       	call   3c2 <read>
+    if(cc < 1)
+ 211:	83 c4 10             	add    $0x10,%esp
+ 214:	85 c0                	test   %eax,%eax
+ 216:	7e 17                	jle    22f <gets+0x49>
+      break;
+    buf[i++] = c;
+ 218:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 21c:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 21f:	3c 0a                	cmp    $0xa,%al
+ 221:	0f 94 c2             	sete   %dl
+ 224:	3c 0d                	cmp    $0xd,%al
+ 226:	0f 94 c0             	sete   %al
+ 229:	08 c2                	or     %al,%dl
+ 22b:	74 ca                	je     1f7 <gets+0x11>
+    buf[i++] = c;
+ 22d:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 22f:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 233:	89 f8                	mov    %edi,%eax
+ 235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 238:	5b                   	pop    %ebx
+ 239:	5e                   	pop    %esi
+ 23a:	5f                   	pop    %edi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+
+0000023d <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 23d:	55                   	push   %ebp
+ 23e:	89 e5                	mov    %esp,%ebp
+ 240:	56                   	push   %esi
+ 241:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 242:	83 ec 08             	sub    $0x8,%esp
+ 245:	6a 00                	push   $0x0
+ 247:	ff 75 08             	push   0x8(%ebp)
+ 24a:	e8 9b 01 00 00       	call   3ea <open>
+  if(fd < 0)
+ 24f:	83 c4 10             	add    $0x10,%esp
+ 252:	85 c0                	test   %eax,%eax
+ 254:	78 24                	js     27a <stat+0x3d>
+ 256:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 258:	83 ec 08             	sub    $0x8,%esp
+ 25b:	ff 75 0c             	push   0xc(%ebp)
+ 25e:	50                   	push   %eax
+ 25f:	e8 9e 01 00 00       	call   402 <fstat>
+ 264:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 266:	89 1c 24             	mov    %ebx,(%esp)
+ 269:	e8 64 01 00 00       	call   3d2 <close>
+  return r;
+ 26e:	83 c4 10             	add    $0x10,%esp
+}
+ 271:	89 f0                	mov    %esi,%eax
+ 273:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 276:	5b                   	pop    %ebx
+ 277:	5e                   	pop    %esi
+ 278:	5d                   	pop    %ebp
+ 279:	c3                   	ret
+    return -1;
+ 27a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 27f:	eb f0                	jmp    271 <stat+0x34>
+
+00000281 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 281:	55                   	push   %ebp
+ 282:	89 e5                	mov    %esp,%ebp
+ 284:	56                   	push   %esi
+ 285:	53                   	push   %ebx
+ 286:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 289:	eb 03                	jmp    28e <atoi+0xd>
+ 28b:	83 c2 01             	add    $0x1,%edx
+ 28e:	0f b6 02             	movzbl (%edx),%eax
+ 291:	3c 20                	cmp    $0x20,%al
+ 293:	74 f6                	je     28b <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 295:	3c 2d                	cmp    $0x2d,%al
+ 297:	74 1d                	je     2b6 <atoi+0x35>
+ 299:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 29e:	3c 2b                	cmp    $0x2b,%al
+ 2a0:	0f 94 c1             	sete   %cl
+ 2a3:	3c 2d                	cmp    $0x2d,%al
+ 2a5:	0f 94 c0             	sete   %al
+ 2a8:	08 c1                	or     %al,%cl
+ 2aa:	74 03                	je     2af <atoi+0x2e>
+    s++;
+ 2ac:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 2af:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2b4:	eb 17                	jmp    2cd <atoi+0x4c>
+ 2b6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2bb:	eb e1                	jmp    29e <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 2bd:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 2c0:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 2c3:	83 c2 01             	add    $0x1,%edx
+ 2c6:	0f be c9             	movsbl %cl,%ecx
+ 2c9:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 2cd:	0f b6 0a             	movzbl (%edx),%ecx
+ 2d0:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2d3:	80 fb 09             	cmp    $0x9,%bl
+ 2d6:	76 e5                	jbe    2bd <atoi+0x3c>
+  return sign*n;
+ 2d8:	0f af c6             	imul   %esi,%eax
+}
+ 2db:	5b                   	pop    %ebx
+ 2dc:	5e                   	pop    %esi
+ 2dd:	5d                   	pop    %ebp
+ 2de:	c3                   	ret
+
+000002df <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2df:	55                   	push   %ebp
+ 2e0:	89 e5                	mov    %esp,%ebp
+ 2e2:	56                   	push   %esi
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2e7:	eb 03                	jmp    2ec <atoo+0xd>
+ 2e9:	83 c2 01             	add    $0x1,%edx
+ 2ec:	0f b6 02             	movzbl (%edx),%eax
+ 2ef:	3c 20                	cmp    $0x20,%al
+ 2f1:	74 f6                	je     2e9 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 2f3:	3c 2d                	cmp    $0x2d,%al
+ 2f5:	74 1d                	je     314 <atoo+0x35>
+ 2f7:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2fc:	3c 2b                	cmp    $0x2b,%al
+ 2fe:	0f 94 c1             	sete   %cl
+ 301:	3c 2d                	cmp    $0x2d,%al
+ 303:	0f 94 c0             	sete   %al
+ 306:	08 c1                	or     %al,%cl
+ 308:	74 03                	je     30d <atoo+0x2e>
+    s++;
+ 30a:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 30d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 312:	eb 11                	jmp    325 <atoo+0x46>
+ 314:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 319:	eb e1                	jmp    2fc <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 31b:	83 c2 01             	add    $0x1,%edx
+ 31e:	0f be c9             	movsbl %cl,%ecx
+ 321:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 325:	0f b6 0a             	movzbl (%edx),%ecx
+ 328:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 32b:	80 fb 07             	cmp    $0x7,%bl
+ 32e:	76 eb                	jbe    31b <atoo+0x3c>
+  return sign*n;
+ 330:	0f af c6             	imul   %esi,%eax
+}
+ 333:	5b                   	pop    %ebx
+ 334:	5e                   	pop    %esi
+ 335:	5d                   	pop    %ebp
+ 336:	c3                   	ret
+
+00000337 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 337:	55                   	push   %ebp
+ 338:	89 e5                	mov    %esp,%ebp
+ 33a:	53                   	push   %ebx
+ 33b:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 341:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 344:	eb 09                	jmp    34f <strncmp+0x18>
+      n--, p++, q++;
+ 346:	83 e8 01             	sub    $0x1,%eax
+ 349:	83 c2 01             	add    $0x1,%edx
+ 34c:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 34f:	85 c0                	test   %eax,%eax
+ 351:	74 0b                	je     35e <strncmp+0x27>
+ 353:	0f b6 1a             	movzbl (%edx),%ebx
+ 356:	84 db                	test   %bl,%bl
+ 358:	74 04                	je     35e <strncmp+0x27>
+ 35a:	3a 19                	cmp    (%ecx),%bl
+ 35c:	74 e8                	je     346 <strncmp+0xf>
+    if(n == 0)
+ 35e:	85 c0                	test   %eax,%eax
+ 360:	74 0d                	je     36f <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 362:	0f b6 02             	movzbl (%edx),%eax
+ 365:	0f b6 11             	movzbl (%ecx),%edx
+ 368:	29 d0                	sub    %edx,%eax
+}
+ 36a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 36d:	c9                   	leave
+ 36e:	c3                   	ret
+      return 0;
+ 36f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 374:	eb f4                	jmp    36a <strncmp+0x33>
+
+00000376 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 376:	55                   	push   %ebp
+ 377:	89 e5                	mov    %esp,%ebp
+ 379:	56                   	push   %esi
+ 37a:	53                   	push   %ebx
+ 37b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 37e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 381:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 384:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 386:	eb 0d                	jmp    395 <memmove+0x1f>
+    *dst++ = *src++;
+ 388:	0f b6 01             	movzbl (%ecx),%eax
+ 38b:	88 02                	mov    %al,(%edx)
+ 38d:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 390:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 393:	89 d8                	mov    %ebx,%eax
+ 395:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 398:	85 c0                	test   %eax,%eax
+ 39a:	7f ec                	jg     388 <memmove+0x12>
+  return vdst;
+}
+ 39c:	89 f0                	mov    %esi,%eax
+ 39e:	5b                   	pop    %ebx
+ 39f:	5e                   	pop    %esi
+ 3a0:	5d                   	pop    %ebp
+ 3a1:	c3                   	ret
+
+000003a2 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3a2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a7:	cd 40                	int    $0x40
+ 3a9:	c3                   	ret
+
+000003aa <exit>:
+SYSCALL(exit)
+ 3aa:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3af:	cd 40                	int    $0x40
+ 3b1:	c3                   	ret
+
+000003b2 <wait>:
+SYSCALL(wait)
+ 3b2:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+000003ba <pipe>:
+SYSCALL(pipe)
+ 3ba:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+000003c2 <read>:
+SYSCALL(read)
+ 3c2:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+000003ca <write>:
+SYSCALL(write)
+ 3ca:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+000003d2 <close>:
+SYSCALL(close)
+ 3d2:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <kill>:
+SYSCALL(kill)
+ 3da:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <exec>:
+SYSCALL(exec)
+ 3e2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <open>:
+SYSCALL(open)
+ 3ea:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <mknod>:
+SYSCALL(mknod)
+ 3f2:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <unlink>:
+SYSCALL(unlink)
+ 3fa:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <fstat>:
+SYSCALL(fstat)
+ 402:	b8 08 00 00 00       	mov    $0x8,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <link>:
+SYSCALL(link)
+ 40a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <mkdir>:
+SYSCALL(mkdir)
+ 412:	b8 14 00 00 00       	mov    $0x14,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <chdir>:
+SYSCALL(chdir)
+ 41a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <dup>:
+SYSCALL(dup)
+ 422:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+0000042a <getpid>:
+SYSCALL(getpid)
+ 42a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 42f:	cd 40                	int    $0x40
+ 431:	c3                   	ret
+
+00000432 <sbrk>:
+SYSCALL(sbrk)
+ 432:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+0000043a <sleep>:
+SYSCALL(sleep)
+ 43a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 43f:	cd 40                	int    $0x40
+ 441:	c3                   	ret
+
+00000442 <uptime>:
+SYSCALL(uptime)
+ 442:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 447:	cd 40                	int    $0x40
+ 449:	c3                   	ret
+
+0000044a <halt>:
+SYSCALL(halt)
+ 44a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 44f:	cd 40                	int    $0x40
+ 451:	c3                   	ret
+
+00000452 <date>:
+SYSCALL(date)
+ 452:	b8 17 00 00 00       	mov    $0x17,%eax
+ 457:	cd 40                	int    $0x40
+ 459:	c3                   	ret
+
+0000045a <getuid>:
+SYSCALL(getuid)
+ 45a:	b8 18 00 00 00       	mov    $0x18,%eax
+ 45f:	cd 40                	int    $0x40
+ 461:	c3                   	ret
+
+00000462 <getgid>:
+SYSCALL(getgid)
+ 462:	b8 19 00 00 00       	mov    $0x19,%eax
+ 467:	cd 40                	int    $0x40
+ 469:	c3                   	ret
+
+0000046a <getppid>:
+SYSCALL(getppid)
+ 46a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 46f:	cd 40                	int    $0x40
+ 471:	c3                   	ret
+
+00000472 <setuid>:
+SYSCALL(setuid)
+ 472:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 477:	cd 40                	int    $0x40
+ 479:	c3                   	ret
+
+0000047a <setgid>:
+SYSCALL(setgid)
+ 47a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 47f:	cd 40                	int    $0x40
+ 481:	c3                   	ret
+
+00000482 <getprocs>:
+SYSCALL(getprocs)
+ 482:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 487:	cd 40                	int    $0x40
+ 489:	c3                   	ret
+
+0000048a <getpriority>:
+SYSCALL(getpriority)
+ 48a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 48f:	cd 40                	int    $0x40
+ 491:	c3                   	ret
+
+00000492 <setpriority>:
+SYSCALL(setpriority)
+ 492:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 497:	cd 40                	int    $0x40
+ 499:	c3                   	ret
+
+0000049a <pipesize>:
+SYSCALL(pipesize)
+ 49a:	b8 20 00 00 00       	mov    $0x20,%eax
+ 49f:	cd 40                	int    $0x40
+ 4a1:	c3                   	ret
+
+000004a2 <splice>:
+SYSCALL(splice)
+ 4a2:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4a7:	cd 40                	int    $0x40
+ 4a9:	c3                   	ret
+
+000004aa <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4aa:	55                   	push   %ebp
+ 4ab:	89 e5                	mov    %esp,%ebp
+ 4ad:	83 ec 1c             	sub    $0x1c,%esp
+ 4b0:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4b3:	6a 01                	push   $0x1
+ 4b5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 4b8:	52                   	push   %edx
+ 4b9:	50                   	push   %eax
+ 4ba:	e8 0b ff ff ff       	call   3ca <write>
+}
+ 4bf:	83 c4 10             	add    $0x10,%esp
+ 4c2:	c9                   	leave
+ 4c3:	c3                   	ret
+
+000004c4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4c4:	55                   	push   %ebp
+ 4c5:	89 e5                	mov    %esp,%ebp
+ 4c7:	57                   	push   %edi
+ 4c8:	56                   	push   %esi
+ 4c9:	53                   	push   %ebx
+ 4ca:	83 ec 2c             	sub    $0x2c,%esp
+ 4cd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 4d0:	89 d0                	mov    %edx,%eax
+ 4d2:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 4d4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 4d8:	0f 95 c1             	setne  %cl
+ 4db:	c1 ea 1f             	shr    $0x1f,%edx
+ 4de:	84 d1                	test   %dl,%cl
+ 4e0:	74 44                	je     526 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 4e2:	f7 d8                	neg    %eax
+ 4e4:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 4e6:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 4f2:	89 c8                	mov    %ecx,%eax
+ 4f4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4f9:	f7 f6                	div    %esi
+ 4fb:	89 df                	mov    %ebx,%edi
+ 4fd:	83 c3 01             	add    $0x1,%ebx
+ 500:	0f b6 92 94 08 00 00 	movzbl 0x894(%edx),%edx
+ 507:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 50b:	89 ca                	mov    %ecx,%edx
+ 50d:	89 c1                	mov    %eax,%ecx
+ 50f:	39 f2                	cmp    %esi,%edx
+ 511:	73 df                	jae    4f2 <printint+0x2e>
+  if(neg)
+ 513:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 517:	74 31                	je     54a <printint+0x86>
+    buf[i++] = '-';
+ 519:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 51e:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 521:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 524:	eb 17                	jmp    53d <printint+0x79>
+    x = xx;
+ 526:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 528:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 52f:	eb bc                	jmp    4ed <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 531:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 536:	89 f0                	mov    %esi,%eax
+ 538:	e8 6d ff ff ff       	call   4aa <putc>
+  while(--i >= 0)
+ 53d:	83 eb 01             	sub    $0x1,%ebx
+ 540:	79 ef                	jns    531 <printint+0x6d>
+}
+ 542:	83 c4 2c             	add    $0x2c,%esp
+ 545:	5b                   	pop    %ebx
+ 546:	5e                   	pop    %esi
+ 547:	5f                   	pop    %edi
+ 548:	5d                   	pop    %ebp
+ 549:	c3                   	ret
+ 54a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 54d:	eb ee                	jmp    53d <printint+0x79>
+
+0000054f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 54f:	55                   	push   %ebp
+ 550:	89 e5                	mov    %esp,%ebp
+ 552:	57                   	push   %edi
+ 553:	56                   	push   %esi
+ 554:	53                   	push   %ebx
+ 555:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 558:	8d 45 10             	lea    0x10(%ebp),%eax
+ 55b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 55e:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 563:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 568:	eb 14                	jmp    57e <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 56a:	89 fa                	mov    %edi,%edx
+ 56c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56f:	e8 36 ff ff ff       	call   4aa <putc>
+ 574:	eb 05                	jmp    57b <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 576:	83 fe 25             	cmp    $0x25,%esi
+ 579:	74 25                	je     5a0 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 57b:	83 c3 01             	add    $0x1,%ebx
+ 57e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 581:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 585:	84 c0                	test   %al,%al
+ 587:	0f 84 20 01 00 00    	je     6ad <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 58d:	0f be f8             	movsbl %al,%edi
+ 590:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 593:	85 f6                	test   %esi,%esi
+ 595:	75 df                	jne    576 <printf+0x27>
+      if(c == '%'){
+ 597:	83 f8 25             	cmp    $0x25,%eax
+ 59a:	75 ce                	jne    56a <printf+0x1b>
+        state = '%';
+ 59c:	89 c6                	mov    %eax,%esi
+ 59e:	eb db                	jmp    57b <printf+0x2c>
+      if(c == 'd'){
+ 5a0:	83 f8 25             	cmp    $0x25,%eax
+ 5a3:	0f 84 cf 00 00 00    	je     678 <printf+0x129>
+ 5a9:	0f 8c dd 00 00 00    	jl     68c <printf+0x13d>
+ 5af:	83 f8 78             	cmp    $0x78,%eax
+ 5b2:	0f 8f d4 00 00 00    	jg     68c <printf+0x13d>
+ 5b8:	83 f8 63             	cmp    $0x63,%eax
+ 5bb:	0f 8c cb 00 00 00    	jl     68c <printf+0x13d>
+ 5c1:	83 e8 63             	sub    $0x63,%eax
+ 5c4:	83 f8 15             	cmp    $0x15,%eax
+ 5c7:	0f 87 bf 00 00 00    	ja     68c <printf+0x13d>
+ 5cd:	ff 24 85 3c 08 00 00 	jmp    *0x83c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 5d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5d7:	8b 17                	mov    (%edi),%edx
+ 5d9:	83 ec 0c             	sub    $0xc,%esp
+ 5dc:	6a 01                	push   $0x1
+ 5de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e6:	e8 d9 fe ff ff       	call   4c4 <printint>
+        ap++;
+ 5eb:	83 c7 04             	add    $0x4,%edi
+ 5ee:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 5f1:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 5f4:	be 00 00 00 00       	mov    $0x0,%esi
+ 5f9:	eb 80                	jmp    57b <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 5fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5fe:	8b 17                	mov    (%edi),%edx
+ 600:	83 ec 0c             	sub    $0xc,%esp
+ 603:	6a 00                	push   $0x0
+ 605:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 60a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60d:	e8 b2 fe ff ff       	call   4c4 <printint>
+        ap++;
+ 612:	83 c7 04             	add    $0x4,%edi
+ 615:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 618:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 61b:	be 00 00 00 00       	mov    $0x0,%esi
+ 620:	e9 56 ff ff ff       	jmp    57b <printf+0x2c>
+        s = (char*)*ap;
+ 625:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 628:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 62a:	83 c0 04             	add    $0x4,%eax
+ 62d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 630:	85 f6                	test   %esi,%esi
+ 632:	75 15                	jne    649 <printf+0xfa>
+          s = "(null)";
+ 634:	be 34 08 00 00       	mov    $0x834,%esi
+ 639:	eb 0e                	jmp    649 <printf+0xfa>
+          putc(fd, *s);
+ 63b:	0f be d2             	movsbl %dl,%edx
+ 63e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 641:	e8 64 fe ff ff       	call   4aa <putc>
+          s++;
+ 646:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 649:	0f b6 16             	movzbl (%esi),%edx
+ 64c:	84 d2                	test   %dl,%dl
+ 64e:	75 eb                	jne    63b <printf+0xec>
+      state = 0;
+ 650:	be 00 00 00 00       	mov    $0x0,%esi
+ 655:	e9 21 ff ff ff       	jmp    57b <printf+0x2c>
+        putc(fd, *ap);
+ 65a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 65d:	0f be 17             	movsbl (%edi),%edx
+ 660:	8b 45 08             	mov    0x8(%ebp),%eax
+ 663:	e8 42 fe ff ff       	call   4aa <putc>
+        ap++;
+ 668:	83 c7 04             	add    $0x4,%edi
+ 66b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 66e:	be 00 00 00 00       	mov    $0x0,%esi
+ 673:	e9 03 ff ff ff       	jmp    57b <printf+0x2c>
+        putc(fd, c);
+ 678:	89 fa                	mov    %edi,%edx
+ 67a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67d:	e8 28 fe ff ff       	call   4aa <putc>
+      state = 0;
+ 682:	be 00 00 00 00       	mov    $0x0,%esi
+ 687:	e9 ef fe ff ff       	jmp    57b <printf+0x2c>
+        putc(fd, '%');
+ 68c:	ba 25 00 00 00       	mov    $0x25,%edx
+ 691:	8b 45 08             	mov    0x8(%ebp),%eax
+ 694:	e8 11 fe ff ff       	call   4aa <putc>
+        putc(fd, c);
+ 699:	89 fa                	mov    %edi,%edx
+ 69b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69e:	e8 07 fe ff ff       	call   4aa <putc>
+      state = 0;
+ 6a3:	be 00 00 00 00       	mov    $0x0,%esi
+ 6a8:	e9 ce fe ff ff       	jmp    57b <printf+0x2c>
+    }
+  }
+}
+ 6ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b0:	5b                   	pop    %ebx
+ 6b1:	5e                   	pop    %esi
+ 6b2:	5f                   	pop    %edi
+ 6b3:	5d                   	pop    %ebp
+ 6b4:	c3                   	ret
+
+000006b5 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6b5:	55                   	push   %ebp
+ 6b6:	89 e5                	mov    %esp,%ebp
+ 6b8:	57                   	push   %edi
+ 6b9:	56                   	push   %esi
+ 6ba:	53                   	push   %ebx
+ 6bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6c1:	a1 e0 0d 00 00       	mov    0xde0,%eax
+ 6c6:	eb 02                	jmp    6ca <free+0x15>
+ 6c8:	89 d0                	mov    %edx,%eax
+ 6ca:	39 c8                	cmp    %ecx,%eax
+ 6cc:	73 04                	jae    6d2 <free+0x1d>
+ 6ce:	3b 08                	cmp    (%eax),%ecx
+ 6d0:	72 12                	jb     6e4 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6d2:	8b 10                	mov    (%eax),%edx
+ 6d4:	39 d0                	cmp    %edx,%eax
+ 6d6:	72 f0                	jb     6c8 <free+0x13>
+ 6d8:	39 c8                	cmp    %ecx,%eax
+ 6da:	72 08                	jb     6e4 <free+0x2f>
+ 6dc:	39 d1                	cmp    %edx,%ecx
+ 6de:	72 04                	jb     6e4 <free+0x2f>
+ 6e0:	89 d0                	mov    %edx,%eax
+ 6e2:	eb e6                	jmp    6ca <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6e4:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6e7:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6ea:	8b 10                	mov    (%eax),%edx
+ 6ec:	39 d7                	cmp    %edx,%edi
+ 6ee:	74 19                	je     709 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 6f0:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6f3:	8b 50 04             	mov    0x4(%eax),%edx
+ 6f6:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 6f9:	39 ce                	cmp    %ecx,%esi
+ 6fb:	74 1b                	je     718 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 6fd:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 6ff:	a3 e0 0d 00 00       	mov    %eax,0xde0
+}
+ 704:	5b                   	pop    %ebx
+ 705:	5e                   	pop    %esi
+ 706:	5f                   	pop    %edi
+ 707:	5d                   	pop    %ebp
+ 708:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 709:	03 72 04             	add    0x4(%edx),%esi
+ 70c:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 70f:	8b 10                	mov    (%eax),%edx
+ 711:	8b 12                	mov    (%edx),%edx
+ 713:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 716:	eb db                	jmp    6f3 <free+0x3e>
+    p->s.size += bp->s.size;
+ 718:	03 53 fc             	add    -0x4(%ebx),%edx
+ 71b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 71e:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 721:	89 10                	mov    %edx,(%eax)
+ 723:	eb da                	jmp    6ff <free+0x4a>
+
+00000725 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 725:	55                   	push   %ebp
+ 726:	89 e5                	mov    %esp,%ebp
+ 728:	53                   	push   %ebx
+ 729:	83 ec 04             	sub    $0x4,%esp
+ 72c:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 72e:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 733:	77 05                	ja     73a <morecore+0x15>
+    nu = 4096;
+ 735:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 73a:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 741:	83 ec 0c             	sub    $0xc,%esp
+ 744:	50                   	push   %eax
+ 745:	e8 e8 fc ff ff       	call   432 <sbrk>
+  if(p == (char*)-1)
+ 74a:	83 c4 10             	add    $0x10,%esp
+ 74d:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 750:	74 1c                	je     76e <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 752:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 755:	83 c0 08             	add    $0x8,%eax
+ 758:	83 ec 0c             	sub    $0xc,%esp
+ 75b:	50                   	push   %eax
+ 75c:	e8 54 ff ff ff       	call   6b5 <free>
+  return freep;
+ 761:	a1 e0 0d 00 00       	mov    0xde0,%eax
+ 766:	83 c4 10             	add    $0x10,%esp
+}
+ 769:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 76c:	c9                   	leave
+ 76d:	c3                   	ret
+    return 0;
+ 76e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 773:	eb f4                	jmp    769 <morecore+0x44>
+
+00000775 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 775:	55                   	push   %ebp
+ 776:	89 e5                	mov    %esp,%ebp
+ 778:	53                   	push   %ebx
+ 779:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 77c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 77f:	8d 58 07             	lea    0x7(%eax),%ebx
+ 782:	c1 eb 03             	shr    $0x3,%ebx
+ 785:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 788:	8b 0d e0 0d 00 00    	mov    0xde0,%ecx
+ 78e:	85 c9                	test   %ecx,%ecx
+ 790:	74 04                	je     796 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 792:	8b 01                	mov    (%ecx),%eax
+ 794:	eb 4a                	jmp    7e0 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 796:	c7 05 e0 0d 00 00 e4 	movl   $0xde4,0xde0
+ 79d:	0d 00 00 
+ 7a0:	c7 05 e4 0d 00 00 e4 	movl   $0xde4,0xde4
+ 7a7:	0d 00 00 
+    base.s.size = 0;
+ 7aa:	c7 05 e8 0d 00 00 00 	movl   $0x0,0xde8
+ 7b1:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 7b4:	b9 e4 0d 00 00       	mov    $0xde4,%ecx
+ 7b9:	eb d7                	jmp    792 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 7bb:	74 19                	je     7d6 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7bd:	29 da                	sub    %ebx,%edx
+ 7bf:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7c2:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 7c5:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7c8:	89 0d e0 0d 00 00    	mov    %ecx,0xde0
+      return (void*)(p + 1);
+ 7ce:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7d4:	c9                   	leave
+ 7d5:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7d6:	8b 10                	mov    (%eax),%edx
+ 7d8:	89 11                	mov    %edx,(%ecx)
+ 7da:	eb ec                	jmp    7c8 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7dc:	89 c1                	mov    %eax,%ecx
+ 7de:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 7e0:	8b 50 04             	mov    0x4(%eax),%edx
+ 7e3:	39 da                	cmp    %ebx,%edx
+ 7e5:	73 d4                	jae    7bb <malloc+0x46>
+    if(p == freep)
+ 7e7:	39 05 e0 0d 00 00    	cmp    %eax,0xde0
+ 7ed:	75 ed                	jne    7dc <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 7ef:	89 d8                	mov    %ebx,%eax
+ 7f1:	e8 2f ff ff ff       	call   725 <morecore>
+ 7f6:	85 c0                	test   %eax,%eax
+ 7f8:	75 e2                	jne    7dc <malloc+0x67>
+ 7fa:	eb d5                	jmp    7d1 <malloc+0x5c>
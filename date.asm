@@ -0,0 +1,1306 @@
+
+_date:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <dayofweek>:
+static char *days[] = {"Sun", "Mon", "Tue", "Wed",
+  "Thu", "Fri", "Sat"};
+
+static int
+dayofweek(int y, int m, int d)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	89 c3                	mov    %eax,%ebx
+   7:	89 d0                	mov    %edx,%eax
+  return (d+=m<3?y--:y-2,23*m/9+d+4+y/4-y/100+y/400)%7;
+   9:	83 fa 02             	cmp    $0x2,%edx
+   c:	7f 70                	jg     7e <dayofweek+0x7e>
+   e:	89 de                	mov    %ebx,%esi
+  10:	8d 5b ff             	lea    -0x1(%ebx),%ebx
+  13:	01 ce                	add    %ecx,%esi
+  15:	6b c8 17             	imul   $0x17,%eax,%ecx
+  18:	ba 39 8e e3 38       	mov    $0x38e38e39,%edx
+  1d:	89 c8                	mov    %ecx,%eax
+  1f:	f7 ea                	imul   %edx
+  21:	d1 fa                	sar    %edx
+  23:	c1 f9 1f             	sar    $0x1f,%ecx
+  26:	29 ca                	sub    %ecx,%edx
+  28:	8d 4c 32 04          	lea    0x4(%edx,%esi,1),%ecx
+  2c:	8d 43 03             	lea    0x3(%ebx),%eax
+  2f:	85 db                	test   %ebx,%ebx
+  31:	0f 49 c3             	cmovns %ebx,%eax
+  34:	c1 f8 02             	sar    $0x2,%eax
+  37:	01 c1                	add    %eax,%ecx
+  39:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+  3e:	89 d8                	mov    %ebx,%eax
+  40:	f7 ea                	imul   %edx
+  42:	89 d6                	mov    %edx,%esi
+  44:	c1 fe 05             	sar    $0x5,%esi
+  47:	c1 fb 1f             	sar    $0x1f,%ebx
+  4a:	89 d8                	mov    %ebx,%eax
+  4c:	29 f0                	sub    %esi,%eax
+  4e:	01 c1                	add    %eax,%ecx
+  50:	c1 fa 07             	sar    $0x7,%edx
+  53:	29 da                	sub    %ebx,%edx
+  55:	01 d1                	add    %edx,%ecx
+  57:	ba 93 24 49 92       	mov    $0x92492493,%edx
+  5c:	89 c8                	mov    %ecx,%eax
+  5e:	f7 ea                	imul   %edx
+  60:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  63:	c1 f8 02             	sar    $0x2,%eax
+  66:	89 ca                	mov    %ecx,%edx
+  68:	c1 fa 1f             	sar    $0x1f,%edx
+  6b:	29 d0                	sub    %edx,%eax
+  6d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+  74:	29 c2                	sub    %eax,%edx
+  76:	89 c8                	mov    %ecx,%eax
+  78:	29 d0                	sub    %edx,%eax
+}
+  7a:	5b                   	pop    %ebx
+  7b:	5e                   	pop    %esi
+  7c:	5d                   	pop    %ebp
+  7d:	c3                   	ret
+  return (d+=m<3?y--:y-2,23*m/9+d+4+y/4-y/100+y/400)%7;
+  7e:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  81:	eb 90                	jmp    13 <dayofweek+0x13>
+
+00000083 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  83:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  87:	83 e4 f0             	and    $0xfffffff0,%esp
+  8a:	ff 71 fc             	push   -0x4(%ecx)
+  8d:	55                   	push   %ebp
+  8e:	89 e5                	mov    %esp,%ebp
+  90:	56                   	push   %esi
+  91:	53                   	push   %ebx
+  92:	51                   	push   %ecx
+  93:	83 ec 38             	sub    $0x38,%esp
+  int day;
+  struct rtcdate r;
+
+  if (date(&r)) {
+  96:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  99:	50                   	push   %eax
+  9a:	e8 fc 03 00 00       	call   49b <date>
+  9f:	83 c4 10             	add    $0x10,%esp
+  a2:	85 c0                	test   %eax,%eax
+  a4:	74 18                	je     be <main+0x3b>
+    printf(2,"Error: date call failed. %s at line %d\n",
+  a6:	6a 1c                	push   $0x1c
+  a8:	68 60 08 00 00       	push   $0x860
+  ad:	68 d4 08 00 00       	push   $0x8d4
+  b2:	6a 02                	push   $0x2
+  b4:	e8 df 04 00 00       	call   598 <printf>
+        __FILE__, __LINE__);
+    exit();
+  b9:	e8 35 03 00 00       	call   3f3 <exit>
+  }
+
+  day = dayofweek(r.year, r.month, r.day);
+  be:	8b 75 dc             	mov    -0x24(%ebp),%esi
+  c1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  c4:	89 f1                	mov    %esi,%ecx
+  c6:	89 da                	mov    %ebx,%edx
+  c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  cb:	e8 30 ff ff ff       	call   0 <dayofweek>
+
+  printf(1, "%s %s %d", days[day], months[r.month], r.day);
+  d0:	83 ec 0c             	sub    $0xc,%esp
+  d3:	56                   	push   %esi
+  d4:	ff 34 9d 20 09 00 00 	push   0x920(,%ebx,4)
+  db:	ff 34 85 00 09 00 00 	push   0x900(,%eax,4)
+  e2:	68 67 08 00 00       	push   $0x867
+  e7:	6a 01                	push   $0x1
+  e9:	e8 aa 04 00 00       	call   598 <printf>
+  printf(1, " ");
+  ee:	83 c4 18             	add    $0x18,%esp
+  f1:	68 70 08 00 00       	push   $0x870
+  f6:	6a 01                	push   $0x1
+  f8:	e8 9b 04 00 00       	call   598 <printf>
+  if (r.hour < 10) printf(1, "0");
+  fd:	83 c4 10             	add    $0x10,%esp
+ 100:	83 7d d8 09          	cmpl   $0x9,-0x28(%ebp)
+ 104:	76 4d                	jbe    153 <main+0xd0>
+  printf(1, "%d:", r.hour);
+ 106:	83 ec 04             	sub    $0x4,%esp
+ 109:	ff 75 d8             	push   -0x28(%ebp)
+ 10c:	68 74 08 00 00       	push   $0x874
+ 111:	6a 01                	push   $0x1
+ 113:	e8 80 04 00 00       	call   598 <printf>
+  if (r.minute < 10) printf(1, "0");
+ 118:	83 c4 10             	add    $0x10,%esp
+ 11b:	83 7d d4 09          	cmpl   $0x9,-0x2c(%ebp)
+ 11f:	76 46                	jbe    167 <main+0xe4>
+  printf(1, "%d:", r.minute);
+ 121:	83 ec 04             	sub    $0x4,%esp
+ 124:	ff 75 d4             	push   -0x2c(%ebp)
+ 127:	68 74 08 00 00       	push   $0x874
+ 12c:	6a 01                	push   $0x1
+ 12e:	e8 65 04 00 00       	call   598 <printf>
+  if (r.second < 10) printf(1, "0");
+ 133:	83 c4 10             	add    $0x10,%esp
+ 136:	83 7d d0 09          	cmpl   $0x9,-0x30(%ebp)
+ 13a:	76 3f                	jbe    17b <main+0xf8>
+  printf(1, "%d UTC %d\n", r.second, r.year);
+ 13c:	ff 75 e4             	push   -0x1c(%ebp)
+ 13f:	ff 75 d0             	push   -0x30(%ebp)
+ 142:	68 78 08 00 00       	push   $0x878
+ 147:	6a 01                	push   $0x1
+ 149:	e8 4a 04 00 00       	call   598 <printf>
+
+  exit();
+ 14e:	e8 a0 02 00 00       	call   3f3 <exit>
+  if (r.hour < 10) printf(1, "0");
+ 153:	83 ec 08             	sub    $0x8,%esp
+ 156:	68 72 08 00 00       	push   $0x872
+ 15b:	6a 01                	push   $0x1
+ 15d:	e8 36 04 00 00       	call   598 <printf>
+ 162:	83 c4 10             	add    $0x10,%esp
+ 165:	eb 9f                	jmp    106 <main+0x83>
+  if (r.minute < 10) printf(1, "0");
+ 167:	83 ec 08             	sub    $0x8,%esp
+ 16a:	68 72 08 00 00       	push   $0x872
+ 16f:	6a 01                	push   $0x1
+ 171:	e8 22 04 00 00       	call   598 <printf>
+ 176:	83 c4 10             	add    $0x10,%esp
+ 179:	eb a6                	jmp    121 <main+0x9e>
+  if (r.second < 10) printf(1, "0");
+ 17b:	83 ec 08             	sub    $0x8,%esp
+ 17e:	68 72 08 00 00       	push   $0x872
+ 183:	6a 01                	push   $0x1
+ 185:	e8 0e 04 00 00       	call   598 <printf>
+ 18a:	83 c4 10             	add    $0x10,%esp
+ 18d:	eb ad                	jmp    13c <main+0xb9>
+
+0000018f <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 18f:	55                   	push   %ebp
+ 190:	89 e5                	mov    %esp,%ebp
+ 192:	56                   	push   %esi
+ 193:	53                   	push   %ebx
+ 194:	8b 75 08             	mov    0x8(%ebp),%esi
+ 197:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 19a:	89 f0                	mov    %esi,%eax
+ 19c:	89 d1                	mov    %edx,%ecx
+ 19e:	83 c2 01             	add    $0x1,%edx
+ 1a1:	89 c3                	mov    %eax,%ebx
+ 1a3:	83 c0 01             	add    $0x1,%eax
+ 1a6:	0f b6 09             	movzbl (%ecx),%ecx
+ 1a9:	88 0b                	mov    %cl,(%ebx)
+ 1ab:	84 c9                	test   %cl,%cl
+ 1ad:	75 ed                	jne    19c <strcpy+0xd>
+    ;
+  return os;
+}
+ 1af:	89 f0                	mov    %esi,%eax
+ 1b1:	5b                   	pop    %ebx
+ 1b2:	5e                   	pop    %esi
+ 1b3:	5d                   	pop    %ebp
+ 1b4:	c3                   	ret
+
+000001b5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b5:	55                   	push   %ebp
+ 1b6:	89 e5                	mov    %esp,%ebp
+ 1b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 1be:	eb 06                	jmp    1c6 <strcmp+0x11>
+    p++, q++;
+ 1c0:	83 c1 01             	add    $0x1,%ecx
+ 1c3:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 1c6:	0f b6 01             	movzbl (%ecx),%eax
+ 1c9:	84 c0                	test   %al,%al
+ 1cb:	74 04                	je     1d1 <strcmp+0x1c>
+ 1cd:	3a 02                	cmp    (%edx),%al
+ 1cf:	74 ef                	je     1c0 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 1d1:	0f b6 c0             	movzbl %al,%eax
+ 1d4:	0f b6 12             	movzbl (%edx),%edx
+ 1d7:	29 d0                	sub    %edx,%eax
+}
+ 1d9:	5d                   	pop    %ebp
+ 1da:	c3                   	ret
+
+000001db <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1db:	55                   	push   %ebp
+ 1dc:	89 e5                	mov    %esp,%ebp
+ 1de:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1e1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1e6:	eb 03                	jmp    1eb <strlen+0x10>
+ 1e8:	83 c0 01             	add    $0x1,%eax
+ 1eb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1ef:	75 f7                	jne    1e8 <strlen+0xd>
+    ;
+  return n;
+}
+ 1f1:	5d                   	pop    %ebp
+ 1f2:	c3                   	ret
+
+000001f3 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1f3:	55                   	push   %ebp
+ 1f4:	89 e5                	mov    %esp,%ebp
+ 1f6:	57                   	push   %edi
+ 1f7:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1fa:	89 d7                	mov    %edx,%edi
+ 1fc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 202:	fc                   	cld
+ 203:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 205:	89 d0                	mov    %edx,%eax
+ 207:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 20a:	c9                   	leave
+ 20b:	c3                   	ret
+
+0000020c <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 20c:	55                   	push   %ebp
+ 20d:	89 e5                	mov    %esp,%ebp
+ 20f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 212:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 216:	eb 03                	jmp    21b <strchr+0xf>
+ 218:	83 c0 01             	add    $0x1,%eax
+ 21b:	0f b6 10             	movzbl (%eax),%edx
+ 21e:	84 d2                	test   %dl,%dl
+ 220:	74 06                	je     228 <strchr+0x1c>
+    if(*s == c)
+ 222:	38 ca                	cmp    %cl,%dl
+ 224:	75 f2                	jne    218 <strchr+0xc>
+ 226:	eb 05                	jmp    22d <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 228:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+
+0000022f <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 22f:	55                   	push   %ebp
+ 230:	89 e5                	mov    %esp,%ebp
+ 232:	57                   	push   %edi
+ 233:	56                   	push   %esi
+ 234:	53                   	push   %ebx
+ 235:	83 ec 1c             	sub    $0x1c,%esp
+ 238:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 23b:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 240:	89 de                	mov    %ebx,%esi
+ 242:	83 c3 01             	add    $0x1,%ebx
+ 245:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 248:	7d 2e                	jge    278 <gets+0x49>
+    cc = read(0, &c, 1);
+ 24a:	83 ec 04             	sub    $0x4,%esp
+ 24d:	6a 01                	push   $0x1
+ 24f:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 252:	50                   	push   %eax
+ 253:	6a 00                	push   $0x0
+ 255:	e8 b1 01 00 00       	call   40b <read>
+    if(cc < 1)
+ 25a:	83 c4 10             	add    $0x10,%esp
+ 25d:	85 c0                	test   %eax,%eax
+ 25f:	7e 17                	jle    278 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 261:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 265:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 268:	3c 0a                	cmp    $0xa,%al
+ 26a:	0f 94 c2             	sete   %dl
+ 26d:	3c 0d                	cmp    $0xd,%al
+ 26f:	0f 94 c0             	sete   %al
+ 272:	08 c2                	or     %al,%dl
+ 274:	74 ca                	je     240 <gets+0x11>
+    buf[i++] = c;
+ 276:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 278:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 27c:	89 f8                	mov    %edi,%eax
+ 27e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 281:	5b                   	pop    %ebx
+ 282:	5e                   	pop    %esi
+ 283:	5f                   	pop    %edi
+ 284:	5d                   	pop    %ebp
+ 285:	c3                   	ret
+
+00000286 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 286:	55                   	push   %ebp
+ 287:	89 e5                	mov    %esp,%ebp
+ 289:	56                   	push   %esi
+ 28a:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 28b:	83 ec 08             	sub    $0x8,%esp
+ 28e:	6a 00                	push   $0x0
+ 290:	ff 75 08             	push   0x8(%ebp)
+ 293:	e8 9b 01 00 00       	call   433 <open>
+  if(fd < 0)
+ 298:	83 c4 10             	add    $0x10,%esp
+ 29b:	85 c0                	test   %eax,%eax
+ 29d:	78 24                	js     2c3 <stat+0x3d>
+ 29f:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 2a1:	83 ec 08             	sub    $0x8,%esp
+ 2a4:	ff 75 0c             	push   0xc(%ebp)
+ 2a7:	50                   	push   %eax
+ 2a8:	e8 9e 01 00 00       	call   44b <fstat>
+ 2ad:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2af:	89 1c 24             	mov    %ebx,(%esp)
+ 2b2:	e8 64 01 00 00       	call   41b <close>
+  return r;
+ 2b7:	83 c4 10             	add    $0x10,%esp
+}
+ 2ba:	89 f0                	mov    %esi,%eax
+ 2bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2bf:	5b                   	pop    %ebx
+ 2c0:	5e                   	pop    %esi
+ 2c1:	5d                   	pop    %ebp
+ 2c2:	c3                   	ret
+    return -1;
+ 2c3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2c8:	eb f0                	jmp    2ba <stat+0x34>
+
+000002ca <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 2ca:	55                   	push   %ebp
+ 2cb:	89 e5                	mov    %esp,%ebp
+ 2cd:	56                   	push   %esi
+ 2ce:	53                   	push   %ebx
+ 2cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2d2:	eb 03                	jmp    2d7 <atoi+0xd>
+ 2d4:	83 c2 01             	add    $0x1,%edx
+ 2d7:	0f b6 02             	movzbl (%edx),%eax
+ 2da:	3c 20                	cmp    $0x20,%al
+ 2dc:	74 f6                	je     2d4 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 2de:	3c 2d                	cmp    $0x2d,%al
+ 2e0:	74 1d                	je     2ff <atoi+0x35>
+ 2e2:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2e7:	3c 2b                	cmp    $0x2b,%al
+ 2e9:	0f 94 c1             	sete   %cl
+ 2ec:	3c 2d                	cmp    $0x2d,%al
+ 2ee:	0f 94 c0             	sete   %al
+ 2f1:	08 c1                	or     %al,%cl
+ 2f3:	74 03                	je     2f8 <atoi+0x2e>
+    s++;
+ 2f5:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 2f8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2fd:	eb 17                	jmp    316 <atoi+0x4c>
+ 2ff:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 304:	eb e1                	jmp    2e7 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 306:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 309:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 30c:	83 c2 01             	add    $0x1,%edx
+ 30f:	0f be c9             	movsbl %cl,%ecx
+ 312:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 316:	0f b6 0a             	movzbl (%edx),%ecx
+ 319:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 31c:	80 fb 09             	cmp    $0x9,%bl
+ 31f:	76 e5                	jbe    306 <atoi+0x3c>
+  return sign*n;
+ 321:	0f af c6             	imul   %esi,%eax
+}
+ 324:	5b                   	pop    %ebx
+ 325:	5e                   	pop    %esi
+ 326:	5d                   	pop    %ebp
+ 327:	c3                   	ret
+
+00000328 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 328:	55                   	push   %ebp
+ 329:	89 e5                	mov    %esp,%ebp
+ 32b:	56                   	push   %esi
+ 32c:	53                   	push   %ebx
+ 32d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 330:	eb 03                	jmp    335 <atoo+0xd>
+ 332:	83 c2 01             	add    $0x1,%edx
+ 335:	0f b6 02             	movzbl (%edx),%eax
+ 338:	3c 20                	cmp    $0x20,%al
+ 33a:	74 f6                	je     332 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 33c:	3c 2d                	cmp    $0x2d,%al
+ 33e:	74 1d                	je     35d <atoo+0x35>
+ 340:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 345:	3c 2b                	cmp    $0x2b,%al
+ 347:	0f 94 c1             	sete   %cl
+ 34a:	3c 2d                	cmp    $0x2d,%al
+ 34c:	0f 94 c0             	sete   %al
+ 34f:	08 c1                	or     %al,%cl
+ 351:	74 03                	je     356 <atoo+0x2e>
+    s++;
+ 353:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 356:	b8 00 00 00 00       	mov    $0x0,%eax
+ 35b:	eb 11                	jmp    36e <atoo+0x46>
+ 35d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 362:	eb e1                	jmp    345 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 364:	83 c2 01             	add    $0x1,%edx
+ 367:	0f be c9             	movsbl %cl,%ecx
+ 36a:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 36e:	0f b6 0a             	movzbl (%edx),%ecx
+ 371:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 374:	80 fb 07             	cmp    $0x7,%bl
+ 377:	76 eb                	jbe    364 <atoo+0x3c>
+  return sign*n;
+ 379:	0f af c6             	imul   %esi,%eax
+}
+ 37c:	5b                   	pop    %ebx
+ 37d:	5e                   	pop    %esi
+ 37e:	5d                   	pop    %ebp
+ 37f:	c3                   	ret
+
+00000380 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+ 387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 38a:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 38d:	eb 09                	jmp    398 <strncmp+0x18>
+      n--, p++, q++;
+ 38f:	83 e8 01             	sub    $0x1,%eax
+ 392:	83 c2 01             	add    $0x1,%edx
+ 395:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 398:	85 c0                	test   %eax,%eax
+ 39a:	74 0b                	je     3a7 <strncmp+0x27>
+ 39c:	0f b6 1a             	movzbl (%edx),%ebx
+ 39f:	84 db                	test   %bl,%bl
+ 3a1:	74 04                	je     3a7 <strncmp+0x27>
+ 3a3:	3a 19                	cmp    (%ecx),%bl
+ 3a5:	74 e8                	je     38f <strncmp+0xf>
+    if(n == 0)
+ 3a7:	85 c0                	test   %eax,%eax
+ 3a9:	74 0d                	je     3b8 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 3ab:	0f b6 02             	movzbl (%edx),%eax
+ 3ae:	0f b6 11             	movzbl (%ecx),%edx
+ 3b1:	29 d0                	sub    %edx,%eax
+}
+ 3b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b6:	c9                   	leave
+ 3b7:	c3                   	ret
+      return 0;
+ 3b8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3bd:	eb f4                	jmp    3b3 <strncmp+0x33>
+
+000003bf <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3bf:	55                   	push   %ebp
+ 3c0:	89 e5                	mov    %esp,%ebp
+ 3c2:	56                   	push   %esi
+ 3c3:	53                   	push   %ebx
+ 3c4:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 3ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 3cd:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 3cf:	eb 0d                	jmp    3de <memmove+0x1f>
+    *dst++ = *src++;
+ 3d1:	0f b6 01             	movzbl (%ecx),%eax
+ 3d4:	88 02                	mov    %al,(%edx)
+ 3d6:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 3d9:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 3dc:	89 d8                	mov    %ebx,%eax
+ 3de:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 3e1:	85 c0                	test   %eax,%eax
+ 3e3:	7f ec                	jg     3d1 <memmove+0x12>
+  return vdst;
+}
+ 3e5:	89 f0                	mov    %esi,%eax
+ 3e7:	5b                   	pop    %ebx
+ 3e8:	5e                   	pop    %esi
+ 3e9:	5d                   	pop    %ebp
+ 3ea:	c3                   	ret
+
+000003eb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3eb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <exit>:
+SYSCALL(exit)
+ 3f3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <wait>:
+SYSCALL(wait)
+ 3fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <pipe>:
+SYSCALL(pipe)
+ 403:	b8 04 00 00 00       	mov    $0x4,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <read>:
+SYSCALL(read)
+ 40b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <write>:
+SYSCALL(write)
+ 413:	b8 10 00 00 00       	mov    $0x10,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <close>:
+SYSCALL(close)
+ 41b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <kill>:
+SYSCALL(kill)
+ 423:	b8 06 00 00 00       	mov    $0x6,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <exec>:
+SYSCALL(exec)
+ 42b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <open>:
+SYSCALL(open)
+ 433:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <mknod>:
+SYSCALL(mknod)
+ 43b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <unlink>:
+SYSCALL(unlink)
+ 443:	b8 12 00 00 00       	mov    $0x12,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <fstat>:
+SYSCALL(fstat)
+ 44b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <link>:
+SYSCALL(link)
+ 453:	b8 13 00 00 00       	mov    $0x13,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mkdir>:
+SYSCALL(mkdir)
+ 45b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <chdir>:
+SYSCALL(chdir)
+ 463:	b8 09 00 00 00       	mov    $0x9,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <dup>:
+SYSCALL(dup)
+ 46b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <getpid>:
+SYSCALL(getpid)
+ 473:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <sbrk>:
+SYSCALL(sbrk)
+ 47b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <sleep>:
+SYSCALL(sleep)
+ 483:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <uptime>:
+SYSCALL(uptime)
+ 48b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <halt>:
+SYSCALL(halt)
+ 493:	b8 16 00 00 00       	mov    $0x16,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <date>:
+SYSCALL(date)
+ 49b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <getuid>:
+SYSCALL(getuid)
+ 4a3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <getgid>:
+SYSCALL(getgid)
+ 4ab:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getppid>:
+SYSCALL(getppid)
+ 4b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <setuid>:
+SYSCALL(setuid)
+ 4bb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <setgid>:
+SYSCALL(setgid)
+ 4c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <getprocs>:
+SYSCALL(getprocs)
+ 4cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <getpriority>:
+SYSCALL(getpriority)
+ 4d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <setpriority>:
+SYSCALL(setpriority)
+ 4db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <pipesize>:
+SYSCALL(pipesize)
+ 4e3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <splice>:
+SYSCALL(splice)
+ 4eb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4f3:	55                   	push   %ebp
+ 4f4:	89 e5                	mov    %esp,%ebp
+ 4f6:	83 ec 1c             	sub    $0x1c,%esp
+ 4f9:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4fc:	6a 01                	push   $0x1
+ 4fe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 501:	52                   	push   %edx
+ 502:	50                   	push   %eax
+ 503:	e8 0b ff ff ff       	call   413 <write>
+}
+ 508:	83 c4 10             	add    $0x10,%esp
+ 50b:	c9                   	leave
+ 50c:	c3                   	ret
+
+0000050d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 50d:	55                   	push   %ebp
+ 50e:	89 e5                	mov    %esp,%ebp
+ 510:	57                   	push   %edi
+ 511:	56                   	push   %esi
+ 512:	53                   	push   %ebx
+ 513:	83 ec 2c             	sub    $0x2c,%esp
+ 516:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 519:	89 d0                	mov    %edx,%eax
+ 51b:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 51d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 521:	0f 95 c1             	setne  %cl
+ 524:	c1 ea 1f             	shr    $0x1f,%edx
+ 527:	84 d1                	test   %dl,%cl
+ 529:	74 44                	je     56f <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 52b:	f7 d8                	neg    %eax
+ 52d:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 52f:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 536:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 53b:	89 c8                	mov    %ecx,%eax
+ 53d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 542:	f7 f6                	div    %esi
+ 544:	89 df                	mov    %ebx,%edi
+ 546:	83 c3 01             	add    $0x1,%ebx
+ 549:	0f b6 92 b4 09 00 00 	movzbl 0x9b4(%edx),%edx
+ 550:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 554:	89 ca                	mov    %ecx,%edx
+ 556:	89 c1                	mov    %eax,%ecx
+ 558:	39 f2                	cmp    %esi,%edx
+ 55a:	73 df                	jae    53b <printint+0x2e>
+  if(neg)
+ 55c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 560:	74 31                	je     593 <printint+0x86>
+    buf[i++] = '-';
+ 562:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 567:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 56a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 56d:	eb 17                	jmp    586 <printint+0x79>
+    x = xx;
+ 56f:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 571:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 578:	eb bc                	jmp    536 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 57a:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 57f:	89 f0                	mov    %esi,%eax
+ 581:	e8 6d ff ff ff       	call   4f3 <putc>
+  while(--i >= 0)
+ 586:	83 eb 01             	sub    $0x1,%ebx
+ 589:	79 ef                	jns    57a <printint+0x6d>
+}
+ 58b:	83 c4 2c             	add    $0x2c,%esp
+ 58e:	5b                   	pop    %ebx
+ 58f:	5e                   	pop    %esi
+ 590:	5f                   	pop    %edi
+ 591:	5d                   	pop    %ebp
+ 592:	c3                   	ret
+ 593:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 596:	eb ee                	jmp    586 <printint+0x79>
+
+00000598 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 598:	55                   	push   %ebp
+ 599:	89 e5                	mov    %esp,%ebp
+ 59b:	57                   	push   %edi
+ 59c:	56                   	push   %esi
+ 59d:	53                   	push   %ebx
+ 59e:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 5a1:	8d 45 10             	lea    0x10(%ebp),%eax
+ 5a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 5a7:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 5ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 5b1:	eb 14                	jmp    5c7 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 5b3:	89 fa                	mov    %edi,%edx
+ 5b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b8:	e8 36 ff ff ff       	call   4f3 <putc>
+ 5bd:	eb 05                	jmp    5c4 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 5bf:	83 fe 25             	cmp    $0x25,%esi
+ 5c2:	74 25                	je     5e9 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 5c4:	83 c3 01             	add    $0x1,%ebx
+ 5c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ca:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 5ce:	84 c0                	test   %al,%al
+ 5d0:	0f 84 20 01 00 00    	je     6f6 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 5d6:	0f be f8             	movsbl %al,%edi
+ 5d9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 5dc:	85 f6                	test   %esi,%esi
+ 5de:	75 df                	jne    5bf <printf+0x27>
+      if(c == '%'){
+ 5e0:	83 f8 25             	cmp    $0x25,%eax
+ 5e3:	75 ce                	jne    5b3 <printf+0x1b>
+        state = '%';
+ 5e5:	89 c6                	mov    %eax,%esi
+ 5e7:	eb db                	jmp    5c4 <printf+0x2c>
+      if(c == 'd'){
+ 5e9:	83 f8 25             	cmp    $0x25,%eax
+ 5ec:	0f 84 cf 00 00 00    	je     6c1 <printf+0x129>
+ 5f2:	0f 8c dd 00 00 00    	jl     6d5 <printf+0x13d>
+ 5f8:	83 f8 78             	cmp    $0x78,%eax
+ 5fb:	0f 8f d4 00 00 00    	jg     6d5 <printf+0x13d>
+ 601:	83 f8 63             	cmp    $0x63,%eax
+ 604:	0f 8c cb 00 00 00    	jl     6d5 <printf+0x13d>
+ 60a:	83 e8 63             	sub    $0x63,%eax
+ 60d:	83 f8 15             	cmp    $0x15,%eax
+ 610:	0f 87 bf 00 00 00    	ja     6d5 <printf+0x13d>
+ 616:	ff 24 85 5c 09 00 00 	jmp    *0x95c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 61d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 620:	8b 17                	mov    (%edi),%edx
+ 622:	83 ec 0c             	sub    $0xc,%esp
+ 625:	6a 01                	push   $0x1
+ 627:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 62c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62f:	e8 d9 fe ff ff       	call   50d <printint>
+        ap++;
+ 634:	83 c7 04             	add    $0x4,%edi
+ 637:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 63a:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 63d:	be 00 00 00 00       	mov    $0x0,%esi
+ 642:	eb 80                	jmp    5c4 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 644:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 647:	8b 17                	mov    (%edi),%edx
+ 649:	83 ec 0c             	sub    $0xc,%esp
+ 64c:	6a 00                	push   $0x0
+ 64e:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 653:	8b 45 08             	mov    0x8(%ebp),%eax
+ 656:	e8 b2 fe ff ff       	call   50d <printint>
+        ap++;
+ 65b:	83 c7 04             	add    $0x4,%edi
+ 65e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 661:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 664:	be 00 00 00 00       	mov    $0x0,%esi
+ 669:	e9 56 ff ff ff       	jmp    5c4 <printf+0x2c>
+        s = (char*)*ap;
+ 66e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 671:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 673:	83 c0 04             	add    $0x4,%eax
+ 676:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 679:	85 f6                	test   %esi,%esi
+ 67b:	75 15                	jne    692 <printf+0xfa>
+          s = "(null)";
+ 67d:	be 54 09 00 00       	mov    $0x954,%esi
+ 682:	eb 0e                	jmp    692 <printf+0xfa>
+          putc(fd, *s);
+ 684:	0f be d2             	movsbl %dl,%edx
+ 687:	8b 45 08             	mov    0x8(%ebp),%eax
+ 68a:	e8 64 fe ff ff       	call   4f3 <putc>
+          s++;
+ 68f:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 692:	0f b6 16             	movzbl (%esi),%edx
+ 695:	84 d2                	test   %dl,%dl
+ 697:	75 eb                	jne    684 <printf+0xec>
+      state = 0;
+ 699:	be 00 00 00 00       	mov    $0x0,%esi
+ 69e:	e9 21 ff ff ff       	jmp    5c4 <printf+0x2c>
+        putc(fd, *ap);
+ 6a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 6a6:	0f be 17             	movsbl (%edi),%edx
+ 6a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ac:	e8 42 fe ff ff       	call   4f3 <putc>
+        ap++;
+ 6b1:	83 c7 04             	add    $0x4,%edi
+ 6b4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 6b7:	be 00 00 00 00       	mov    $0x0,%esi
+ 6bc:	e9 03 ff ff ff       	jmp    5c4 <printf+0x2c>
+        putc(fd, c);
+ 6c1:	89 fa                	mov    %edi,%edx
+ 6c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c6:	e8 28 fe ff ff       	call   4f3 <putc>
+      state = 0;
+ 6cb:	be 00 00 00 00       	mov    $0x0,%esi
+ 6d0:	e9 ef fe ff ff       	jmp    5c4 <printf+0x2c>
+        putc(fd, '%');
+ 6d5:	ba 25 00 00 00       	mov    $0x25,%edx
+ 6da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6dd:	e8 11 fe ff ff       	call   4f3 <putc>
+        putc(fd, c);
+ 6e2:	89 fa                	mov    %edi,%edx
+ 6e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e7:	e8 07 fe ff ff       	call   4f3 <putc>
+      state = 0;
+ 6ec:	be 00 00 00 00       	mov    $0x0,%esi
+ 6f1:	e9 ce fe ff ff       	jmp    5c4 <printf+0x2c>
+    }
+  }
+}
+ 6f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6f9:	5b                   	pop    %ebx
+ 6fa:	5e                   	pop    %esi
+ 6fb:	5f                   	pop    %edi
+ 6fc:	5d                   	pop    %ebp
+ 6fd:	c3                   	ret
+
+000006fe <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6fe:	55                   	push   %ebp
+ 6ff:	89 e5                	mov    %esp,%ebp
+ 701:	57                   	push   %edi
+ 702:	56                   	push   %esi
+ 703:	53                   	push   %ebx
+ 704:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 707:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 70a:	a1 dc 0c 00 00       	mov    0xcdc,%eax
+ 70f:	eb 02                	jmp    713 <free+0x15>
+ 711:	89 d0                	mov    %edx,%eax
+ 713:	39 c8                	cmp    %ecx,%eax
+ 715:	73 04                	jae    71b <free+0x1d>
+ 717:	3b 08                	cmp    (%eax),%ecx
+ 719:	72 12                	jb     72d <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 71b:	8b 10                	mov    (%eax),%edx
+ 71d:	39 d0                	cmp    %edx,%eax
+ 71f:	72 f0                	jb     711 <free+0x13>
+ 721:	39 c8                	cmp    %ecx,%eax
+ 723:	72 08                	jb     72d <free+0x2f>
+ 725:	39 d1                	cmp    %edx,%ecx
+ 727:	72 04                	jb     72d <free+0x2f>
+ 729:	89 d0                	mov    %edx,%eax
+ 72b:	eb e6                	jmp    713 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 72d:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 730:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 733:	8b 10                	mov    (%eax),%edx
+ 735:	39 d7                	cmp    %edx,%edi
+ 737:	74 19                	je     752 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 739:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 73c:	8b 50 04             	mov    0x4(%eax),%edx
+ 73f:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 742:	39 ce                	cmp    %ecx,%esi
+ 744:	74 1b                	je     761 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 746:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 748:	a3 dc 0c 00 00       	mov    %eax,0xcdc
+}
+ 74d:	5b                   	pop    %ebx
+ 74e:	5e                   	pop    %esi
+ 74f:	5f                   	pop    %edi
+ 750:	5d                   	pop    %ebp
+ 751:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 752:	03 72 04             	add    0x4(%edx),%esi
+ 755:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 758:	8b 10                	mov    (%eax),%edx
+ 75a:	8b 12                	mov    (%edx),%edx
+ 75c:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 75f:	eb db                	jmp    73c <free+0x3e>
+    p->s.size += bp->s.size;
+ 761:	03 53 fc             	add    -0x4(%ebx),%edx
+ 764:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 767:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 76a:	89 10                	mov    %edx,(%eax)
+ 76c:	eb da                	jmp    748 <free+0x4a>
+
+0000076e <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 76e:	55                   	push   %ebp
+ 76f:	89 e5                	mov    %esp,%ebp
+ 771:	53                   	push   %ebx
+ 772:	83 ec 04             	sub    $0x4,%esp
+ 775:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 777:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 77c:	77 05                	ja     783 <morecore+0x15>
+    nu = 4096;
+ 77e:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 783:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 78a:	83 ec 0c             	sub    $0xc,%esp
+ 78d:	50                   	push   %eax
+ 78e:	e8 e8 fc ff ff       	call   47b <sbrk>
+  if(p == (char*)-1)
+ 793:	83 c4 10             	add    $0x10,%esp
+ 796:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 799:	74 1c                	je     7b7 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 79b:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 79e:	83 c0 08             	add    $0x8,%eax
+ 7a1:	83 ec 0c             	sub    $0xc,%esp
+ 7a4:	50                   	push   %eax
+ 7a5:	e8 54 ff ff ff       	call   6fe <free>
+  return freep;
+ 7aa:	a1 dc 0c 00 00       	mov    0xcdc,%eax
+ 7af:	83 c4 10             	add    $0x10,%esp
+}
+ 7b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7b5:	c9                   	leave
+ 7b6:	c3                   	ret
+    return 0;
+ 7b7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7bc:	eb f4                	jmp    7b2 <morecore+0x44>
+
+000007be <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7be:	55                   	push   %ebp
+ 7bf:	89 e5                	mov    %esp,%ebp
+ 7c1:	53                   	push   %ebx
+ 7c2:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c8:	8d 58 07             	lea    0x7(%eax),%ebx
+ 7cb:	c1 eb 03             	shr    $0x3,%ebx
+ 7ce:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 7d1:	8b 0d dc 0c 00 00    	mov    0xcdc,%ecx
+ 7d7:	85 c9                	test   %ecx,%ecx
+ 7d9:	74 04                	je     7df <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7db:	8b 01                	mov    (%ecx),%eax
+ 7dd:	eb 4a                	jmp    829 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 7df:	c7 05 dc 0c 00 00 e0 	movl   $0xce0,0xcdc
+ 7e6:	0c 00 00 
+ 7e9:	c7 05 e0 0c 00 00 e0 	movl   $0xce0,0xce0
+ 7f0:	0c 00 00 
+    base.s.size = 0;
+ 7f3:	c7 05 e4 0c 00 00 00 	movl   $0x0,0xce4
+ 7fa:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 7fd:	b9 e0 0c 00 00       	mov    $0xce0,%ecx
+ 802:	eb d7                	jmp    7db <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 804:	74 19                	je     81f <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 806:	29 da                	sub    %ebx,%edx
+ 808:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 80b:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 80e:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 811:	89 0d dc 0c 00 00    	mov    %ecx,0xcdc
+      return (void*)(p + 1);
+ 817:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 81a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 81d:	c9                   	leave
+ 81e:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 81f:	8b 10                	mov    (%eax),%edx
+ 821:	89 11                	mov    %edx,(%ecx)
+ 823:	eb ec                	jmp    811 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 825:	89 c1                	mov    %eax,%ecx
+ 827:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 829:	8b 50 04             	mov    0x4(%eax),%edx
+ 82c:	39 da                	cmp    %ebx,%edx
+ 82e:	73 d4                	jae    804 <malloc+0x46>
+    if(p == freep)
+ 830:	39 05 dc 0c 00 00    	cmp    %eax,0xcdc
+ 836:	75 ed                	jne    825 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 838:	89 d8                	mov    %ebx,%eax
+ 83a:	e8 2f ff ff ff       	call   76e <morecore>
+ 83f:	85 c0                	test   %eax,%eax
+ 841:	75 e2                	jne    825 <malloc+0x67>
+ 843:	eb d5                	jmp    81a <malloc+0x5c>
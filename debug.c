@@ -29,10 +29,12 @@ findProc(struct proc *p)
   if (procLookup(p, ptable.list[UNUSED].head)   != 0) return 1;
   if (procLookup(p, ptable.list[EMBRYO].head)   != 0) return 1;
   if (procLookup(p, ptable.list[RUNNING].head)  != 0) return 1;
-  if (procLookup(p, ptable.list[SLEEPING].head) != 0) return 1;
   if (procLookup(p, ptable.list[ZOMBIE].head)   != 0) return 1;
-  for (int i=0; i<=MAXPRIO; i++)
-    if (procLookup(p, ptable.ready[i].head) != 0) return 1;
+  for (int i=0; i<NSLEEPQ; i++)
+    if (procLookup(p, ptable.sleepq[i].head) != 0) return 1;
+  for (int c=0; c<NCPU; c++)
+    for (int i=0; i<=MAXPRIO; i++)
+      if (procLookup(p, runq[c].ready[i].head) != 0) return 1;
 
   return 0; // not found
 }
@@ -43,7 +45,7 @@ checkProcs(const char *file, const char *func, int line)
   int found;
   struct proc *p;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.all; p; p = p->allnext){
     found = findProc(p);
     if (found) continue;
     cprintf("checkprocs error. Called from %s, %s, @ %d\n", file, func, line);
@@ -17,9 +17,13 @@ struct ptrs;
 #endif
 // bio.c
 void            binit(void);
+void            binit2(void);
+int             breclaim(void);
 struct buf*     bread(uint, uint);
+void            breadahead(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bwritev(struct buf**, int);
 
 // console.c
 void            consoleinit(void);
@@ -41,14 +45,18 @@ void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filesplice(struct file*, struct file*, int n);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
+void            dirunlink(struct inode*, uint);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+void            iexecref(struct inode*, int);
 void            iinit(int dev);
+void            iinit2(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
@@ -58,17 +66,24 @@ int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
+void            readahead(struct inode*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
+int             readipipe(struct inode*, struct pipe*, uint, uint);
+int             writeipipe(struct inode*, struct pipe*, uint, uint);
 
 
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderwv(struct buf**, int);
+void            idereadahead(struct buf*);
+void            idewaitahead(struct buf*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
+void            ioapicenablepci(int irq, int cpu);
 extern uchar    ioapicid;
 void            ioapicinit(void);
 
@@ -77,6 +92,9 @@ char*           kalloc(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kincref(char*);
+int             kfreepages(void);
+int             krefcount(char*);
 
 // kbd.c
 void            kbdintr(void);
@@ -100,6 +118,11 @@ void            end_op();
 extern int      ismp;
 void            mpinit(void);
 
+// pci.c
+uint            pciread(uint, int);
+void            pciwrite(uint, int, uint);
+int             pcifind(int, uint, uint, uint*);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -109,9 +132,15 @@ int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
+int             piperesize(struct pipe*, int);
+int             pipewait(struct pipe*, int);
+int             pipeput(struct pipe*, char*, int);
+int             pipeget(struct pipe*, char*, int);
+int             pipemove(struct pipe*, struct pipe*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             ofilegrow(struct proc*);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
@@ -125,6 +154,8 @@ void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
+int             sleepticks(uint);
+void            timertick(uint);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
@@ -175,6 +206,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argptrw(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -193,6 +225,12 @@ void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
 
+// virtio.c
+void            virtioinit(void);
+int             virtiorw(struct buf**, int, int);
+int             virtiowait(struct buf*);
+void            virtiointr(int);
+
 // vm.c
 void            seginit(void);
 void            kvmalloc(void);
@@ -208,6 +246,8 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             pagefault(struct proc*, uint, uint);
+int             prefault(struct proc*, uint, uint, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,1175 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	b8 01 00 00 00       	mov    $0x1,%eax
+  1e:	eb 1a                	jmp    3a <main+0x3a>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  20:	ba 0a 07 00 00       	mov    $0x70a,%edx
+  25:	52                   	push   %edx
+  26:	ff 34 87             	push   (%edi,%eax,4)
+  29:	68 0c 07 00 00       	push   $0x70c
+  2e:	6a 01                	push   $0x1
+  30:	e8 25 04 00 00       	call   45a <printf>
+  35:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  38:	89 d8                	mov    %ebx,%eax
+  3a:	39 f0                	cmp    %esi,%eax
+  3c:	7d 0e                	jge    4c <main+0x4c>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  3e:	8d 58 01             	lea    0x1(%eax),%ebx
+  41:	39 f3                	cmp    %esi,%ebx
+  43:	7d db                	jge    20 <main+0x20>
+  45:	ba 08 07 00 00       	mov    $0x708,%edx
+  4a:	eb d9                	jmp    25 <main+0x25>
+  exit();
+  4c:	e8 64 02 00 00       	call   2b5 <exit>
+
+00000051 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  51:	55                   	push   %ebp
+  52:	89 e5                	mov    %esp,%ebp
+  54:	56                   	push   %esi
+  55:	53                   	push   %ebx
+  56:	8b 75 08             	mov    0x8(%ebp),%esi
+  59:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  5c:	89 f0                	mov    %esi,%eax
+  5e:	89 d1                	mov    %edx,%ecx
+  60:	83 c2 01             	add    $0x1,%edx
+  63:	89 c3                	mov    %eax,%ebx
+  65:	83 c0 01             	add    $0x1,%eax
+  68:	0f b6 09             	movzbl (%ecx),%ecx
+  6b:	88 0b                	mov    %cl,(%ebx)
+  6d:	84 c9                	test   %cl,%cl
+  6f:	75 ed                	jne    5e <strcpy+0xd>
+    ;
+  return os;
+}
+  71:	89 f0                	mov    %esi,%eax
+  73:	5b                   	pop    %ebx
+  74:	5e                   	pop    %esi
+  75:	5d                   	pop    %ebp
+  76:	c3                   	ret
+
+00000077 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  77:	55                   	push   %ebp
+  78:	89 e5                	mov    %esp,%ebp
+  7a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  80:	eb 06                	jmp    88 <strcmp+0x11>
+    p++, q++;
+  82:	83 c1 01             	add    $0x1,%ecx
+  85:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  88:	0f b6 01             	movzbl (%ecx),%eax
+  8b:	84 c0                	test   %al,%al
+  8d:	74 04                	je     93 <strcmp+0x1c>
+  8f:	3a 02                	cmp    (%edx),%al
+  91:	74 ef                	je     82 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+  93:	0f b6 c0             	movzbl %al,%eax
+  96:	0f b6 12             	movzbl (%edx),%edx
+  99:	29 d0                	sub    %edx,%eax
+}
+  9b:	5d                   	pop    %ebp
+  9c:	c3                   	ret
+
+0000009d <strlen>:
+
+uint
+strlen(char *s)
+{
+  9d:	55                   	push   %ebp
+  9e:	89 e5                	mov    %esp,%ebp
+  a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  a8:	eb 03                	jmp    ad <strlen+0x10>
+  aa:	83 c0 01             	add    $0x1,%eax
+  ad:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  b1:	75 f7                	jne    aa <strlen+0xd>
+    ;
+  return n;
+}
+  b3:	5d                   	pop    %ebp
+  b4:	c3                   	ret
+
+000000b5 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  b5:	55                   	push   %ebp
+  b6:	89 e5                	mov    %esp,%ebp
+  b8:	57                   	push   %edi
+  b9:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  bc:	89 d7                	mov    %edx,%edi
+  be:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  c4:	fc                   	cld
+  c5:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  c7:	89 d0                	mov    %edx,%eax
+  c9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  cc:	c9                   	leave
+  cd:	c3                   	ret
+
+000000ce <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  ce:	55                   	push   %ebp
+  cf:	89 e5                	mov    %esp,%ebp
+  d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  d4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  d8:	eb 03                	jmp    dd <strchr+0xf>
+  da:	83 c0 01             	add    $0x1,%eax
+  dd:	0f b6 10             	movzbl (%eax),%edx
+  e0:	84 d2                	test   %dl,%dl
+  e2:	74 06                	je     ea <strchr+0x1c>
+    if(*s == c)
+  e4:	38 ca                	cmp    %cl,%dl
+  e6:	75 f2                	jne    da <strchr+0xc>
+  e8:	eb 05                	jmp    ef <strchr+0x21>
+      return (char*)s;
+  return 0;
+  ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  ef:	5d                   	pop    %ebp
+  f0:	c3                   	ret
+
+000000f1 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  f1:	55                   	push   %ebp
+  f2:	89 e5                	mov    %esp,%ebp
+  f4:	57                   	push   %edi
+  f5:	56                   	push   %esi
+  f6:	53                   	push   %ebx
+  f7:	83 ec 1c             	sub    $0x1c,%esp
+  fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 102:	89 de                	mov    %ebx,%esi
+ 104:	83 c3 01             	add    $0x1,%ebx
+ 107:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 10a:	7d 2e                	jge    13a <gets+0x49>
+    cc = read(0, &c, 1);
+ 10c:	83 ec 04             	sub    $0x4,%esp
+ 10f:	6a 01                	push   $0x1
+ 111:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 114:	50                   	push   %eax
+ 115:	6a 00                	push   $0x0
+ 117:	e8 b1 01 00 00       	call   2cd <read>
+    if(cc < 1)
+ 11c:	83 c4 10             	add    $0x10,%esp
+ 11f:	85 c0                	test   %eax,%eax
+ 121:	7e 17                	jle    13a <gets+0x49>
+      break;
+    buf[i++] = c;
+ 123:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 127:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 12a:	3c 0a                	cmp    $0xa,%al
+ 12c:	0f 94 c2             	sete   %dl
+ 12f:	3c 0d                	cmp    $0xd,%al
+ 131:	0f 94 c0             	sete   %al
+ 134:	08 c2                	or     %al,%dl
+ 136:	74 ca                	je     102 <gets+0x11>
+    buf[i++] = c;
+ 138:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 13a:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 13e:	89 f8                	mov    %edi,%eax
+ 140:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 143:	5b                   	pop    %ebx
+ 144:	5e                   	pop    %esi
+ 145:	5f                   	pop    %edi
+ 146:	5d                   	pop    %ebp
+ 147:	c3                   	ret
+
+00000148 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	56                   	push   %esi
+ 14c:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 14d:	83 ec 08             	sub    $0x8,%esp
+ 150:	6a 00                	push   $0x0
+ 152:	ff 75 08             	push   0x8(%ebp)
+ 155:	e8 9b 01 00 00       	call   2f5 <open>
+  if(fd < 0)
+ 15a:	83 c4 10             	add    $0x10,%esp
+ 15d:	85 c0                	test   %eax,%eax
+ 15f:	78 24                	js     185 <stat+0x3d>
+ 161:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 163:	83 ec 08             	sub    $0x8,%esp
+ 166:	ff 75 0c             	push   0xc(%ebp)
+ 169:	50                   	push   %eax
+ 16a:	e8 9e 01 00 00       	call   30d <fstat>
+ 16f:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 171:	89 1c 24             	mov    %ebx,(%esp)
+ 174:	e8 64 01 00 00       	call   2dd <close>
+  return r;
+ 179:	83 c4 10             	add    $0x10,%esp
+}
+ 17c:	89 f0                	mov    %esi,%eax
+ 17e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 181:	5b                   	pop    %ebx
+ 182:	5e                   	pop    %esi
+ 183:	5d                   	pop    %ebp
+ 184:	c3                   	ret
+    return -1;
+ 185:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 18a:	eb f0                	jmp    17c <stat+0x34>
+
+0000018c <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 18c:	55                   	push   %ebp
+ 18d:	89 e5                	mov    %esp,%ebp
+ 18f:	56                   	push   %esi
+ 190:	53                   	push   %ebx
+ 191:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 194:	eb 03                	jmp    199 <atoi+0xd>
+ 196:	83 c2 01             	add    $0x1,%edx
+ 199:	0f b6 02             	movzbl (%edx),%eax
+ 19c:	3c 20                	cmp    $0x20,%al
+ 19e:	74 f6                	je     196 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 1a0:	3c 2d                	cmp    $0x2d,%al
+ 1a2:	74 1d                	je     1c1 <atoi+0x35>
+ 1a4:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1a9:	3c 2b                	cmp    $0x2b,%al
+ 1ab:	0f 94 c1             	sete   %cl
+ 1ae:	3c 2d                	cmp    $0x2d,%al
+ 1b0:	0f 94 c0             	sete   %al
+ 1b3:	08 c1                	or     %al,%cl
+ 1b5:	74 03                	je     1ba <atoi+0x2e>
+    s++;
+ 1b7:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 1ba:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1bf:	eb 17                	jmp    1d8 <atoi+0x4c>
+ 1c1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1c6:	eb e1                	jmp    1a9 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 1c8:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 1cb:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 1ce:	83 c2 01             	add    $0x1,%edx
+ 1d1:	0f be c9             	movsbl %cl,%ecx
+ 1d4:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 1d8:	0f b6 0a             	movzbl (%edx),%ecx
+ 1db:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 1de:	80 fb 09             	cmp    $0x9,%bl
+ 1e1:	76 e5                	jbe    1c8 <atoi+0x3c>
+  return sign*n;
+ 1e3:	0f af c6             	imul   %esi,%eax
+}
+ 1e6:	5b                   	pop    %ebx
+ 1e7:	5e                   	pop    %esi
+ 1e8:	5d                   	pop    %ebp
+ 1e9:	c3                   	ret
+
+000001ea <atoo>:
+
+int
+atoo(const char *s)
+{
+ 1ea:	55                   	push   %ebp
+ 1eb:	89 e5                	mov    %esp,%ebp
+ 1ed:	56                   	push   %esi
+ 1ee:	53                   	push   %ebx
+ 1ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1f2:	eb 03                	jmp    1f7 <atoo+0xd>
+ 1f4:	83 c2 01             	add    $0x1,%edx
+ 1f7:	0f b6 02             	movzbl (%edx),%eax
+ 1fa:	3c 20                	cmp    $0x20,%al
+ 1fc:	74 f6                	je     1f4 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 1fe:	3c 2d                	cmp    $0x2d,%al
+ 200:	74 1d                	je     21f <atoo+0x35>
+ 202:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 207:	3c 2b                	cmp    $0x2b,%al
+ 209:	0f 94 c1             	sete   %cl
+ 20c:	3c 2d                	cmp    $0x2d,%al
+ 20e:	0f 94 c0             	sete   %al
+ 211:	08 c1                	or     %al,%cl
+ 213:	74 03                	je     218 <atoo+0x2e>
+    s++;
+ 215:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 218:	b8 00 00 00 00       	mov    $0x0,%eax
+ 21d:	eb 11                	jmp    230 <atoo+0x46>
+ 21f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 224:	eb e1                	jmp    207 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 226:	83 c2 01             	add    $0x1,%edx
+ 229:	0f be c9             	movsbl %cl,%ecx
+ 22c:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 230:	0f b6 0a             	movzbl (%edx),%ecx
+ 233:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 236:	80 fb 07             	cmp    $0x7,%bl
+ 239:	76 eb                	jbe    226 <atoo+0x3c>
+  return sign*n;
+ 23b:	0f af c6             	imul   %esi,%eax
+}
+ 23e:	5b                   	pop    %ebx
+ 23f:	5e                   	pop    %esi
+ 240:	5d                   	pop    %ebp
+ 241:	c3                   	ret
+
+00000242 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 242:	55                   	push   %ebp
+ 243:	89 e5                	mov    %esp,%ebp
+ 245:	53                   	push   %ebx
+ 246:	8b 55 08             	mov    0x8(%ebp),%edx
+ 249:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 24c:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 24f:	eb 09                	jmp    25a <strncmp+0x18>
+      n--, p++, q++;
+ 251:	83 e8 01             	sub    $0x1,%eax
+ 254:	83 c2 01             	add    $0x1,%edx
+ 257:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 25a:	85 c0                	test   %eax,%eax
+ 25c:	74 0b                	je     269 <strncmp+0x27>
+ 25e:	0f b6 1a             	movzbl (%edx),%ebx
+ 261:	84 db                	test   %bl,%bl
+ 263:	74 04                	je     269 <strncmp+0x27>
+ 265:	3a 19                	cmp    (%ecx),%bl
+ 267:	74 e8                	je     251 <strncmp+0xf>
+    if(n == 0)
+ 269:	85 c0                	test   %eax,%eax
+ 26b:	74 0d                	je     27a <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 26d:	0f b6 02             	movzbl (%edx),%eax
+ 270:	0f b6 11             	movzbl (%ecx),%edx
+ 273:	29 d0                	sub    %edx,%eax
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	c9                   	leave
+ 279:	c3                   	ret
+      return 0;
+ 27a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 27f:	eb f4                	jmp    275 <strncmp+0x33>
+
+00000281 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 281:	55                   	push   %ebp
+ 282:	89 e5                	mov    %esp,%ebp
+ 284:	56                   	push   %esi
+ 285:	53                   	push   %ebx
+ 286:	8b 75 08             	mov    0x8(%ebp),%esi
+ 289:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 28c:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 28f:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 291:	eb 0d                	jmp    2a0 <memmove+0x1f>
+    *dst++ = *src++;
+ 293:	0f b6 01             	movzbl (%ecx),%eax
+ 296:	88 02                	mov    %al,(%edx)
+ 298:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 29b:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 29e:	89 d8                	mov    %ebx,%eax
+ 2a0:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 2a3:	85 c0                	test   %eax,%eax
+ 2a5:	7f ec                	jg     293 <memmove+0x12>
+  return vdst;
+}
+ 2a7:	89 f0                	mov    %esi,%eax
+ 2a9:	5b                   	pop    %ebx
+ 2aa:	5e                   	pop    %esi
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+
+000002ad <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2ad:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b2:	cd 40                	int    $0x40
+ 2b4:	c3                   	ret
+
+000002b5 <exit>:
+SYSCALL(exit)
+ 2b5:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2ba:	cd 40                	int    $0x40
+ 2bc:	c3                   	ret
+
+000002bd <wait>:
+SYSCALL(wait)
+ 2bd:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c2:	cd 40                	int    $0x40
+ 2c4:	c3                   	ret
+
+000002c5 <pipe>:
+SYSCALL(pipe)
+ 2c5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2ca:	cd 40                	int    $0x40
+ 2cc:	c3                   	ret
+
+000002cd <read>:
+SYSCALL(read)
+ 2cd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d2:	cd 40                	int    $0x40
+ 2d4:	c3                   	ret
+
+000002d5 <write>:
+SYSCALL(write)
+ 2d5:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2da:	cd 40                	int    $0x40
+ 2dc:	c3                   	ret
+
+000002dd <close>:
+SYSCALL(close)
+ 2dd:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e2:	cd 40                	int    $0x40
+ 2e4:	c3                   	ret
+
+000002e5 <kill>:
+SYSCALL(kill)
+ 2e5:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2ea:	cd 40                	int    $0x40
+ 2ec:	c3                   	ret
+
+000002ed <exec>:
+SYSCALL(exec)
+ 2ed:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f2:	cd 40                	int    $0x40
+ 2f4:	c3                   	ret
+
+000002f5 <open>:
+SYSCALL(open)
+ 2f5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2fa:	cd 40                	int    $0x40
+ 2fc:	c3                   	ret
+
+000002fd <mknod>:
+SYSCALL(mknod)
+ 2fd:	b8 11 00 00 00       	mov    $0x11,%eax
+ 302:	cd 40                	int    $0x40
+ 304:	c3                   	ret
+
+00000305 <unlink>:
+SYSCALL(unlink)
+ 305:	b8 12 00 00 00       	mov    $0x12,%eax
+ 30a:	cd 40                	int    $0x40
+ 30c:	c3                   	ret
+
+0000030d <fstat>:
+SYSCALL(fstat)
+ 30d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 312:	cd 40                	int    $0x40
+ 314:	c3                   	ret
+
+00000315 <link>:
+SYSCALL(link)
+ 315:	b8 13 00 00 00       	mov    $0x13,%eax
+ 31a:	cd 40                	int    $0x40
+ 31c:	c3                   	ret
+
+0000031d <mkdir>:
+SYSCALL(mkdir)
+ 31d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 322:	cd 40                	int    $0x40
+ 324:	c3                   	ret
+
+00000325 <chdir>:
+SYSCALL(chdir)
+ 325:	b8 09 00 00 00       	mov    $0x9,%eax
+ 32a:	cd 40                	int    $0x40
+ 32c:	c3                   	ret
+
+0000032d <dup>:
+SYSCALL(dup)
+ 32d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 332:	cd 40                	int    $0x40
+ 334:	c3                   	ret
+
+00000335 <getpid>:
+SYSCALL(getpid)
+ 335:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 33a:	cd 40                	int    $0x40
+ 33c:	c3                   	ret
+
+0000033d <sbrk>:
+SYSCALL(sbrk)
+ 33d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 342:	cd 40                	int    $0x40
+ 344:	c3                   	ret
+
+00000345 <sleep>:
+SYSCALL(sleep)
+ 345:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 34a:	cd 40                	int    $0x40
+ 34c:	c3                   	ret
+
+0000034d <uptime>:
+SYSCALL(uptime)
+ 34d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 352:	cd 40                	int    $0x40
+ 354:	c3                   	ret
+
+00000355 <halt>:
+SYSCALL(halt)
+ 355:	b8 16 00 00 00       	mov    $0x16,%eax
+ 35a:	cd 40                	int    $0x40
+ 35c:	c3                   	ret
+
+0000035d <date>:
+SYSCALL(date)
+ 35d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 362:	cd 40                	int    $0x40
+ 364:	c3                   	ret
+
+00000365 <getuid>:
+SYSCALL(getuid)
+ 365:	b8 18 00 00 00       	mov    $0x18,%eax
+ 36a:	cd 40                	int    $0x40
+ 36c:	c3                   	ret
+
+0000036d <getgid>:
+SYSCALL(getgid)
+ 36d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 372:	cd 40                	int    $0x40
+ 374:	c3                   	ret
+
+00000375 <getppid>:
+SYSCALL(getppid)
+ 375:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 37a:	cd 40                	int    $0x40
+ 37c:	c3                   	ret
+
+0000037d <setuid>:
+SYSCALL(setuid)
+ 37d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 382:	cd 40                	int    $0x40
+ 384:	c3                   	ret
+
+00000385 <setgid>:
+SYSCALL(setgid)
+ 385:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 38a:	cd 40                	int    $0x40
+ 38c:	c3                   	ret
+
+0000038d <getprocs>:
+SYSCALL(getprocs)
+ 38d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 392:	cd 40                	int    $0x40
+ 394:	c3                   	ret
+
+00000395 <getpriority>:
+SYSCALL(getpriority)
+ 395:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 39a:	cd 40                	int    $0x40
+ 39c:	c3                   	ret
+
+0000039d <setpriority>:
+SYSCALL(setpriority)
+ 39d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3a2:	cd 40                	int    $0x40
+ 3a4:	c3                   	ret
+
+000003a5 <pipesize>:
+SYSCALL(pipesize)
+ 3a5:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3aa:	cd 40                	int    $0x40
+ 3ac:	c3                   	ret
+
+000003ad <splice>:
+SYSCALL(splice)
+ 3ad:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3b2:	cd 40                	int    $0x40
+ 3b4:	c3                   	ret
+
+000003b5 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3b5:	55                   	push   %ebp
+ 3b6:	89 e5                	mov    %esp,%ebp
+ 3b8:	83 ec 1c             	sub    $0x1c,%esp
+ 3bb:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3be:	6a 01                	push   $0x1
+ 3c0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3c3:	52                   	push   %edx
+ 3c4:	50                   	push   %eax
+ 3c5:	e8 0b ff ff ff       	call   2d5 <write>
+}
+ 3ca:	83 c4 10             	add    $0x10,%esp
+ 3cd:	c9                   	leave
+ 3ce:	c3                   	ret
+
+000003cf <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3cf:	55                   	push   %ebp
+ 3d0:	89 e5                	mov    %esp,%ebp
+ 3d2:	57                   	push   %edi
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+ 3d5:	83 ec 2c             	sub    $0x2c,%esp
+ 3d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3db:	89 d0                	mov    %edx,%eax
+ 3dd:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3df:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3e3:	0f 95 c1             	setne  %cl
+ 3e6:	c1 ea 1f             	shr    $0x1f,%edx
+ 3e9:	84 d1                	test   %dl,%cl
+ 3eb:	74 44                	je     431 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3ed:	f7 d8                	neg    %eax
+ 3ef:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3f1:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3fd:	89 c8                	mov    %ecx,%eax
+ 3ff:	ba 00 00 00 00       	mov    $0x0,%edx
+ 404:	f7 f6                	div    %esi
+ 406:	89 df                	mov    %ebx,%edi
+ 408:	83 c3 01             	add    $0x1,%ebx
+ 40b:	0f b6 92 70 07 00 00 	movzbl 0x770(%edx),%edx
+ 412:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 416:	89 ca                	mov    %ecx,%edx
+ 418:	89 c1                	mov    %eax,%ecx
+ 41a:	39 f2                	cmp    %esi,%edx
+ 41c:	73 df                	jae    3fd <printint+0x2e>
+  if(neg)
+ 41e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 422:	74 31                	je     455 <printint+0x86>
+    buf[i++] = '-';
+ 424:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 429:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 42c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 42f:	eb 17                	jmp    448 <printint+0x79>
+    x = xx;
+ 431:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 433:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 43a:	eb bc                	jmp    3f8 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 43c:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 441:	89 f0                	mov    %esi,%eax
+ 443:	e8 6d ff ff ff       	call   3b5 <putc>
+  while(--i >= 0)
+ 448:	83 eb 01             	sub    $0x1,%ebx
+ 44b:	79 ef                	jns    43c <printint+0x6d>
+}
+ 44d:	83 c4 2c             	add    $0x2c,%esp
+ 450:	5b                   	pop    %ebx
+ 451:	5e                   	pop    %esi
+ 452:	5f                   	pop    %edi
+ 453:	5d                   	pop    %ebp
+ 454:	c3                   	ret
+ 455:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 458:	eb ee                	jmp    448 <printint+0x79>
+
+0000045a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 45a:	55                   	push   %ebp
+ 45b:	89 e5                	mov    %esp,%ebp
+ 45d:	57                   	push   %edi
+ 45e:	56                   	push   %esi
+ 45f:	53                   	push   %ebx
+ 460:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 463:	8d 45 10             	lea    0x10(%ebp),%eax
+ 466:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 469:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 46e:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 473:	eb 14                	jmp    489 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 475:	89 fa                	mov    %edi,%edx
+ 477:	8b 45 08             	mov    0x8(%ebp),%eax
+ 47a:	e8 36 ff ff ff       	call   3b5 <putc>
+ 47f:	eb 05                	jmp    486 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 481:	83 fe 25             	cmp    $0x25,%esi
+ 484:	74 25                	je     4ab <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 486:	83 c3 01             	add    $0x1,%ebx
+ 489:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 48c:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 490:	84 c0                	test   %al,%al
+ 492:	0f 84 20 01 00 00    	je     5b8 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 498:	0f be f8             	movsbl %al,%edi
+ 49b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 49e:	85 f6                	test   %esi,%esi
+ 4a0:	75 df                	jne    481 <printf+0x27>
+      if(c == '%'){
+ 4a2:	83 f8 25             	cmp    $0x25,%eax
+ 4a5:	75 ce                	jne    475 <printf+0x1b>
+        state = '%';
+ 4a7:	89 c6                	mov    %eax,%esi
+ 4a9:	eb db                	jmp    486 <printf+0x2c>
+      if(c == 'd'){
+ 4ab:	83 f8 25             	cmp    $0x25,%eax
+ 4ae:	0f 84 cf 00 00 00    	je     583 <printf+0x129>
+ 4b4:	0f 8c dd 00 00 00    	jl     597 <printf+0x13d>
+ 4ba:	83 f8 78             	cmp    $0x78,%eax
+ 4bd:	0f 8f d4 00 00 00    	jg     597 <printf+0x13d>
+ 4c3:	83 f8 63             	cmp    $0x63,%eax
+ 4c6:	0f 8c cb 00 00 00    	jl     597 <printf+0x13d>
+ 4cc:	83 e8 63             	sub    $0x63,%eax
+ 4cf:	83 f8 15             	cmp    $0x15,%eax
+ 4d2:	0f 87 bf 00 00 00    	ja     597 <printf+0x13d>
+ 4d8:	ff 24 85 18 07 00 00 	jmp    *0x718(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4e2:	8b 17                	mov    (%edi),%edx
+ 4e4:	83 ec 0c             	sub    $0xc,%esp
+ 4e7:	6a 01                	push   $0x1
+ 4e9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4ee:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f1:	e8 d9 fe ff ff       	call   3cf <printint>
+        ap++;
+ 4f6:	83 c7 04             	add    $0x4,%edi
+ 4f9:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 4fc:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4ff:	be 00 00 00 00       	mov    $0x0,%esi
+ 504:	eb 80                	jmp    486 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 506:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 509:	8b 17                	mov    (%edi),%edx
+ 50b:	83 ec 0c             	sub    $0xc,%esp
+ 50e:	6a 00                	push   $0x0
+ 510:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 515:	8b 45 08             	mov    0x8(%ebp),%eax
+ 518:	e8 b2 fe ff ff       	call   3cf <printint>
+        ap++;
+ 51d:	83 c7 04             	add    $0x4,%edi
+ 520:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 523:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 526:	be 00 00 00 00       	mov    $0x0,%esi
+ 52b:	e9 56 ff ff ff       	jmp    486 <printf+0x2c>
+        s = (char*)*ap;
+ 530:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 533:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 535:	83 c0 04             	add    $0x4,%eax
+ 538:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 53b:	85 f6                	test   %esi,%esi
+ 53d:	75 15                	jne    554 <printf+0xfa>
+          s = "(null)";
+ 53f:	be 11 07 00 00       	mov    $0x711,%esi
+ 544:	eb 0e                	jmp    554 <printf+0xfa>
+          putc(fd, *s);
+ 546:	0f be d2             	movsbl %dl,%edx
+ 549:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54c:	e8 64 fe ff ff       	call   3b5 <putc>
+          s++;
+ 551:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 554:	0f b6 16             	movzbl (%esi),%edx
+ 557:	84 d2                	test   %dl,%dl
+ 559:	75 eb                	jne    546 <printf+0xec>
+      state = 0;
+ 55b:	be 00 00 00 00       	mov    $0x0,%esi
+ 560:	e9 21 ff ff ff       	jmp    486 <printf+0x2c>
+        putc(fd, *ap);
+ 565:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 568:	0f be 17             	movsbl (%edi),%edx
+ 56b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56e:	e8 42 fe ff ff       	call   3b5 <putc>
+        ap++;
+ 573:	83 c7 04             	add    $0x4,%edi
+ 576:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 579:	be 00 00 00 00       	mov    $0x0,%esi
+ 57e:	e9 03 ff ff ff       	jmp    486 <printf+0x2c>
+        putc(fd, c);
+ 583:	89 fa                	mov    %edi,%edx
+ 585:	8b 45 08             	mov    0x8(%ebp),%eax
+ 588:	e8 28 fe ff ff       	call   3b5 <putc>
+      state = 0;
+ 58d:	be 00 00 00 00       	mov    $0x0,%esi
+ 592:	e9 ef fe ff ff       	jmp    486 <printf+0x2c>
+        putc(fd, '%');
+ 597:	ba 25 00 00 00       	mov    $0x25,%edx
+ 59c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59f:	e8 11 fe ff ff       	call   3b5 <putc>
+        putc(fd, c);
+ 5a4:	89 fa                	mov    %edi,%edx
+ 5a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a9:	e8 07 fe ff ff       	call   3b5 <putc>
+      state = 0;
+ 5ae:	be 00 00 00 00       	mov    $0x0,%esi
+ 5b3:	e9 ce fe ff ff       	jmp    486 <printf+0x2c>
+    }
+  }
+}
+ 5b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5bb:	5b                   	pop    %ebx
+ 5bc:	5e                   	pop    %esi
+ 5bd:	5f                   	pop    %edi
+ 5be:	5d                   	pop    %ebp
+ 5bf:	c3                   	ret
+
+000005c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5c9:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5cc:	a1 70 0a 00 00       	mov    0xa70,%eax
+ 5d1:	eb 02                	jmp    5d5 <free+0x15>
+ 5d3:	89 d0                	mov    %edx,%eax
+ 5d5:	39 c8                	cmp    %ecx,%eax
+ 5d7:	73 04                	jae    5dd <free+0x1d>
+ 5d9:	3b 08                	cmp    (%eax),%ecx
+ 5db:	72 12                	jb     5ef <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5dd:	8b 10                	mov    (%eax),%edx
+ 5df:	39 d0                	cmp    %edx,%eax
+ 5e1:	72 f0                	jb     5d3 <free+0x13>
+ 5e3:	39 c8                	cmp    %ecx,%eax
+ 5e5:	72 08                	jb     5ef <free+0x2f>
+ 5e7:	39 d1                	cmp    %edx,%ecx
+ 5e9:	72 04                	jb     5ef <free+0x2f>
+ 5eb:	89 d0                	mov    %edx,%eax
+ 5ed:	eb e6                	jmp    5d5 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5ef:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5f2:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5f5:	8b 10                	mov    (%eax),%edx
+ 5f7:	39 d7                	cmp    %edx,%edi
+ 5f9:	74 19                	je     614 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 5fb:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 5fe:	8b 50 04             	mov    0x4(%eax),%edx
+ 601:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 604:	39 ce                	cmp    %ecx,%esi
+ 606:	74 1b                	je     623 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 608:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 60a:	a3 70 0a 00 00       	mov    %eax,0xa70
+}
+ 60f:	5b                   	pop    %ebx
+ 610:	5e                   	pop    %esi
+ 611:	5f                   	pop    %edi
+ 612:	5d                   	pop    %ebp
+ 613:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 614:	03 72 04             	add    0x4(%edx),%esi
+ 617:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 61a:	8b 10                	mov    (%eax),%edx
+ 61c:	8b 12                	mov    (%edx),%edx
+ 61e:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 621:	eb db                	jmp    5fe <free+0x3e>
+    p->s.size += bp->s.size;
+ 623:	03 53 fc             	add    -0x4(%ebx),%edx
+ 626:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 629:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 62c:	89 10                	mov    %edx,(%eax)
+ 62e:	eb da                	jmp    60a <free+0x4a>
+
+00000630 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	53                   	push   %ebx
+ 634:	83 ec 04             	sub    $0x4,%esp
+ 637:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 639:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 63e:	77 05                	ja     645 <morecore+0x15>
+    nu = 4096;
+ 640:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 645:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 64c:	83 ec 0c             	sub    $0xc,%esp
+ 64f:	50                   	push   %eax
+ 650:	e8 e8 fc ff ff       	call   33d <sbrk>
+  if(p == (char*)-1)
+ 655:	83 c4 10             	add    $0x10,%esp
+ 658:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 65b:	74 1c                	je     679 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 65d:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 660:	83 c0 08             	add    $0x8,%eax
+ 663:	83 ec 0c             	sub    $0xc,%esp
+ 666:	50                   	push   %eax
+ 667:	e8 54 ff ff ff       	call   5c0 <free>
+  return freep;
+ 66c:	a1 70 0a 00 00       	mov    0xa70,%eax
+ 671:	83 c4 10             	add    $0x10,%esp
+}
+ 674:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 677:	c9                   	leave
+ 678:	c3                   	ret
+    return 0;
+ 679:	b8 00 00 00 00       	mov    $0x0,%eax
+ 67e:	eb f4                	jmp    674 <morecore+0x44>
+
+00000680 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	53                   	push   %ebx
+ 684:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 687:	8b 45 08             	mov    0x8(%ebp),%eax
+ 68a:	8d 58 07             	lea    0x7(%eax),%ebx
+ 68d:	c1 eb 03             	shr    $0x3,%ebx
+ 690:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 693:	8b 0d 70 0a 00 00    	mov    0xa70,%ecx
+ 699:	85 c9                	test   %ecx,%ecx
+ 69b:	74 04                	je     6a1 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 69d:	8b 01                	mov    (%ecx),%eax
+ 69f:	eb 4a                	jmp    6eb <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 6a1:	c7 05 70 0a 00 00 74 	movl   $0xa74,0xa70
+ 6a8:	0a 00 00 
+ 6ab:	c7 05 74 0a 00 00 74 	movl   $0xa74,0xa74
+ 6b2:	0a 00 00 
+    base.s.size = 0;
+ 6b5:	c7 05 78 0a 00 00 00 	movl   $0x0,0xa78
+ 6bc:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 6bf:	b9 74 0a 00 00       	mov    $0xa74,%ecx
+ 6c4:	eb d7                	jmp    69d <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 6c6:	74 19                	je     6e1 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6c8:	29 da                	sub    %ebx,%edx
+ 6ca:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 6cd:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 6d0:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6d3:	89 0d 70 0a 00 00    	mov    %ecx,0xa70
+      return (void*)(p + 1);
+ 6d9:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6df:	c9                   	leave
+ 6e0:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6e1:	8b 10                	mov    (%eax),%edx
+ 6e3:	89 11                	mov    %edx,(%ecx)
+ 6e5:	eb ec                	jmp    6d3 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6e7:	89 c1                	mov    %eax,%ecx
+ 6e9:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 6eb:	8b 50 04             	mov    0x4(%eax),%edx
+ 6ee:	39 da                	cmp    %ebx,%edx
+ 6f0:	73 d4                	jae    6c6 <malloc+0x46>
+    if(p == freep)
+ 6f2:	39 05 70 0a 00 00    	cmp    %eax,0xa70
+ 6f8:	75 ed                	jne    6e7 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 6fa:	89 d8                	mov    %ebx,%eax
+ 6fc:	e8 2f ff ff ff       	call   630 <morecore>
+ 701:	85 c0                	test   %eax,%eax
+ 703:	75 e2                	jne    6e7 <malloc+0x67>
+ 705:	eb d5                	jmp    6dc <malloc+0x5c>
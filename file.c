@@ -5,21 +5,37 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 
 struct devsw devsw[NDEV];
+// The file table starts with NFILE entries and grows a page
+// at a time when they are all in use. Unused entries are kept
+// on a free list.
 struct {
   struct spinlock lock;
+  struct file *free;
   struct file file[NFILE];
 } ftable;
 
+// Put the n files at f on the free list.
+static void
+fileadd(struct file *f, int n)
+{
+  for(; n > 0; n--, f++){
+    f->fnext = ftable.free;
+    ftable.free = f;
+  }
+}
+
 void
 fileinit(void)
 {
   initlock(&ftable.lock, "ftable");
+  fileadd(ftable.file, NFILE);
 }
 
 // Allocate a file structure.
@@ -29,15 +45,16 @@ filealloc(void)
   struct file *f;
 
   acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
+  if(ftable.free == 0 && (f = (struct file*)kalloc()) != 0){
+    memset(f, 0, PGSIZE);
+    fileadd(f, PGSIZE / sizeof(*f));
+  }
+  if((f = ftable.free) != 0){
+    ftable.free = f->fnext;
+    f->ref = 1;
   }
   release(&ftable.lock);
-  return 0;
+  return f;
 }
 
 // Increment ref count for file f.
@@ -68,6 +85,8 @@ fileclose(struct file *f)
   ff = *f;
   f->ref = 0;
   f->type = FD_NONE;
+  f->fnext = ftable.free;
+  ftable.free = f;
   release(&ftable.lock);
 
   if(ff.type == FD_PIPE)
@@ -92,11 +111,16 @@ filestat(struct file *f, struct stat *st)
   return -1;
 }
 
+// Bounds of the sequential read-ahead window, in blocks.
+#define RAMIN 4
+#define RAMAX NREADAHEAD
+
 // Read from file f.
 int
 fileread(struct file *f, char *addr, int n)
 {
   int r;
+  uint start, end;
 
   if(f->readable == 0)
     return -1;
@@ -104,8 +128,25 @@ fileread(struct file *f, char *addr, int n)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
     ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
+    if((r = readi(f->ip, addr, f->off, n)) > 0){
+      // Reads that carry on where the last one stopped get a
+      // read-ahead window that doubles each time.
+      if(f->off == f->ranext)
+        f->rawin = f->rawin ? f->rawin*2 : RAMIN;
+      else
+        f->rawin = f->raend = 0;
+      if(f->rawin > RAMAX)
+        f->rawin = RAMAX;
       f->off += r;
+      f->ranext = f->off;
+      if(f->rawin){
+        end = f->off + f->rawin*BSIZE;
+        start = f->raend > f->off ? f->raend : f->off;
+        if(start < end)
+          readahead(f->ip, start, end - start);
+        f->raend = end;
+      }
+    }
     iunlock(f->ip);
     return r;
   }
@@ -130,7 +171,7 @@ filewrite(struct file *f, char *addr, int n)
     // and 2 blocks of slop for non-aligned writes.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
     int i = 0;
     while(i < n){
       int n1 = n - i;
@@ -155,3 +196,66 @@ filewrite(struct file *f, char *addr, int n)
   panic("filewrite");
 }
 
+
+// Move up to n bytes from file in to file out without copying
+// through user space. One end must be a pipe; the other may be
+// a pipe or an inode. Like fileread, returns once some bytes
+// have moved: the number moved, 0 at end of file, or -1.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+  int r, eof;
+  struct inode *ip;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+  if(n == 0)
+    return 0;
+
+  if(in->type == FD_INODE && out->type == FD_PIPE){
+    ip = in->ip;
+    for(;;){
+      if(pipewait(out->pipe, 1) < 0)
+        return -1;
+      ilock(ip);
+      if((r = readipipe(ip, out->pipe, in->off, n)) > 0)
+        in->off += r;
+      eof = in->off >= ip->size;
+      iunlock(ip);
+      if(r != 0 || eof)
+        return r;
+    }
+  }
+
+  if(in->type == FD_PIPE && out->type == FD_INODE){
+    // Keep to one log transaction's worth, as filewrite does.
+    if(n > ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE)
+      n = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
+    ip = out->ip;
+    for(;;){
+      if((r = pipewait(in->pipe, 0)) <= 0)
+        return r;
+      begin_op();
+      ilock(ip);
+      if((r = writeipipe(ip, in->pipe, out->off, n)) > 0)
+        out->off += r;
+      iunlock(ip);
+      end_op();
+      if(r != 0)
+        return r;
+    }
+  }
+
+  if(in->type == FD_PIPE && out->type == FD_PIPE && in->pipe != out->pipe){
+    for(;;){
+      if((r = pipewait(in->pipe, 0)) <= 0)
+        return r;
+      if(pipewait(out->pipe, 1) < 0)
+        return -1;
+      if((r = pipemove(in->pipe, out->pipe, n)) != 0)
+        return r;
+    }
+  }
+
+  return -1;
+}
@@ -1,19 +1,27 @@
 struct file {
   enum { FD_NONE, FD_PIPE, FD_INODE } type;
   int ref; // reference count
+  struct file *fnext; // ftable free list, while ref is 0
   char readable;
   char writable;
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  uint ranext;     // offset a sequential read would start at
+  uint raend;      // read-ahead has been started up to here
+  int rawin;       // read-ahead window, in blocks
 };
 
+#define NBMAP 16  // block mappings cached per inode
 
 // in-memory copy of an inode
 struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *hnext; // icache hash chain
+  struct inode *lprev; // icache LRU list, while ref is 0
+  struct inode *lnext;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -22,7 +30,18 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+2];
+
+  uint mapbn;         // file block of map[0]
+  uint nmap;          // valid entries in map[]
+  uint map[NBMAP];    // recent indirect block mappings, 0 if unknown
+  uint lastblk;       // last block allocated to it, goal for the next
+  int nexec;          // processes loading text from it; no writes
+
+  uint **dirhash;     // directory index pages, listed in a page (fs.c)
+  int ndirhash;       // pages in dirhash, 0 if not indexed
+  uint dirused;       // dirhash slots in use, incl. removed entries
+  uint dirfree;       // dirents below this offset are all in use
 };
 
 // table mapping major device number to
@@ -0,0 +1,780 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printf>:
+
+#define N  1000
+
+void
+printf(int fd, char *s, ...)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 10             	sub    $0x10,%esp
+   7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+   a:	53                   	push   %ebx
+   b:	e8 25 01 00 00       	call   135 <strlen>
+  10:	83 c4 0c             	add    $0xc,%esp
+  13:	50                   	push   %eax
+  14:	53                   	push   %ebx
+  15:	ff 75 08             	push   0x8(%ebp)
+  18:	e8 50 03 00 00       	call   36d <write>
+}
+  1d:	83 c4 10             	add    $0x10,%esp
+  20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  23:	c9                   	leave
+  24:	c3                   	ret
+
+00000025 <forktest>:
+
+void
+forktest(void)
+{
+  25:	55                   	push   %ebp
+  26:	89 e5                	mov    %esp,%ebp
+  28:	53                   	push   %ebx
+  29:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+  2c:	68 50 04 00 00       	push   $0x450
+  31:	6a 01                	push   $0x1
+  33:	e8 c8 ff ff ff       	call   0 <printf>
+
+  for(n=0; n<N; n++){
+  38:	83 c4 10             	add    $0x10,%esp
+  3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  40:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+  46:	7f 15                	jg     5d <forktest+0x38>
+    pid = fork();
+  48:	e8 f8 02 00 00       	call   345 <fork>
+    if(pid < 0)
+  4d:	85 c0                	test   %eax,%eax
+  4f:	78 0c                	js     5d <forktest+0x38>
+      break;
+    if(pid == 0)
+  51:	74 05                	je     58 <forktest+0x33>
+  for(n=0; n<N; n++){
+  53:	83 c3 01             	add    $0x1,%ebx
+  56:	eb e8                	jmp    40 <forktest+0x1b>
+      exit();
+  58:	e8 f0 02 00 00       	call   34d <exit>
+  }
+
+  if(n == N){
+  5d:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  63:	74 12                	je     77 <forktest+0x52>
+    printf(1, "fork claimed to work N times!\n", N);
+    exit();
+  }
+
+  for(; n > 0; n--){
+  65:	85 db                	test   %ebx,%ebx
+  67:	7e 3b                	jle    a4 <forktest+0x7f>
+    if(wait() < 0){
+  69:	e8 e7 02 00 00       	call   355 <wait>
+  6e:	85 c0                	test   %eax,%eax
+  70:	78 1e                	js     90 <forktest+0x6b>
+  for(; n > 0; n--){
+  72:	83 eb 01             	sub    $0x1,%ebx
+  75:	eb ee                	jmp    65 <forktest+0x40>
+    printf(1, "fork claimed to work N times!\n", N);
+  77:	83 ec 04             	sub    $0x4,%esp
+  7a:	68 e8 03 00 00       	push   $0x3e8
+  7f:	68 90 04 00 00       	push   $0x490
+  84:	6a 01                	push   $0x1
+  86:	e8 75 ff ff ff       	call   0 <printf>
+    exit();
+  8b:	e8 bd 02 00 00       	call   34d <exit>
+      printf(1, "wait stopped early\n");
+  90:	83 ec 08             	sub    $0x8,%esp
+  93:	68 5b 04 00 00       	push   $0x45b
+  98:	6a 01                	push   $0x1
+  9a:	e8 61 ff ff ff       	call   0 <printf>
+      exit();
+  9f:	e8 a9 02 00 00       	call   34d <exit>
+    }
+  }
+
+  if(wait() != -1){
+  a4:	e8 ac 02 00 00       	call   355 <wait>
+  a9:	83 f8 ff             	cmp    $0xffffffff,%eax
+  ac:	75 17                	jne    c5 <forktest+0xa0>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+  ae:	83 ec 08             	sub    $0x8,%esp
+  b1:	68 82 04 00 00       	push   $0x482
+  b6:	6a 01                	push   $0x1
+  b8:	e8 43 ff ff ff       	call   0 <printf>
+}
+  bd:	83 c4 10             	add    $0x10,%esp
+  c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c3:	c9                   	leave
+  c4:	c3                   	ret
+    printf(1, "wait got too many\n");
+  c5:	83 ec 08             	sub    $0x8,%esp
+  c8:	68 6f 04 00 00       	push   $0x46f
+  cd:	6a 01                	push   $0x1
+  cf:	e8 2c ff ff ff       	call   0 <printf>
+    exit();
+  d4:	e8 74 02 00 00       	call   34d <exit>
+
+000000d9 <main>:
+
+int
+main(void)
+{
+  d9:	55                   	push   %ebp
+  da:	89 e5                	mov    %esp,%ebp
+  dc:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+  df:	e8 41 ff ff ff       	call   25 <forktest>
+  exit();
+  e4:	e8 64 02 00 00       	call   34d <exit>
+
+000000e9 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  e9:	55                   	push   %ebp
+  ea:	89 e5                	mov    %esp,%ebp
+  ec:	56                   	push   %esi
+  ed:	53                   	push   %ebx
+  ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f4:	89 f0                	mov    %esi,%eax
+  f6:	89 d1                	mov    %edx,%ecx
+  f8:	83 c2 01             	add    $0x1,%edx
+  fb:	89 c3                	mov    %eax,%ebx
+  fd:	83 c0 01             	add    $0x1,%eax
+ 100:	0f b6 09             	movzbl (%ecx),%ecx
+ 103:	88 0b                	mov    %cl,(%ebx)
+ 105:	84 c9                	test   %cl,%cl
+ 107:	75 ed                	jne    f6 <strcpy+0xd>
+    ;
+  return os;
+}
+ 109:	89 f0                	mov    %esi,%eax
+ 10b:	5b                   	pop    %ebx
+ 10c:	5e                   	pop    %esi
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+
+0000010f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 10f:	55                   	push   %ebp
+ 110:	89 e5                	mov    %esp,%ebp
+ 112:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 115:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 118:	eb 06                	jmp    120 <strcmp+0x11>
+    p++, q++;
+ 11a:	83 c1 01             	add    $0x1,%ecx
+ 11d:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 120:	0f b6 01             	movzbl (%ecx),%eax
+ 123:	84 c0                	test   %al,%al
+ 125:	74 04                	je     12b <strcmp+0x1c>
+ 127:	3a 02                	cmp    (%edx),%al
+ 129:	74 ef                	je     11a <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 12b:	0f b6 c0             	movzbl %al,%eax
+ 12e:	0f b6 12             	movzbl (%edx),%edx
+ 131:	29 d0                	sub    %edx,%eax
+}
+ 133:	5d                   	pop    %ebp
+ 134:	c3                   	ret
+
+00000135 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 13b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 140:	eb 03                	jmp    145 <strlen+0x10>
+ 142:	83 c0 01             	add    $0x1,%eax
+ 145:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 149:	75 f7                	jne    142 <strlen+0xd>
+    ;
+  return n;
+}
+ 14b:	5d                   	pop    %ebp
+ 14c:	c3                   	ret
+
+0000014d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 14d:	55                   	push   %ebp
+ 14e:	89 e5                	mov    %esp,%ebp
+ 150:	57                   	push   %edi
+ 151:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 154:	89 d7                	mov    %edx,%edi
+ 156:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 159:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 15c:	fc                   	cld
+ 15d:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 15f:	89 d0                	mov    %edx,%eax
+ 161:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+
+00000166 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 170:	eb 03                	jmp    175 <strchr+0xf>
+ 172:	83 c0 01             	add    $0x1,%eax
+ 175:	0f b6 10             	movzbl (%eax),%edx
+ 178:	84 d2                	test   %dl,%dl
+ 17a:	74 06                	je     182 <strchr+0x1c>
+    if(*s == c)
+ 17c:	38 ca                	cmp    %cl,%dl
+ 17e:	75 f2                	jne    172 <strchr+0xc>
+ 180:	eb 05                	jmp    187 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 182:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+
+00000189 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 189:	55                   	push   %ebp
+ 18a:	89 e5                	mov    %esp,%ebp
+ 18c:	57                   	push   %edi
+ 18d:	56                   	push   %esi
+ 18e:	53                   	push   %ebx
+ 18f:	83 ec 1c             	sub    $0x1c,%esp
+ 192:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 195:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 19a:	89 de                	mov    %ebx,%esi
+ 19c:	83 c3 01             	add    $0x1,%ebx
+ 19f:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1a2:	7d 2e                	jge    1d2 <gets+0x49>
+    cc = read(0, &c, 1);
+ 1a4:	83 ec 04             	sub    $0x4,%esp
+ 1a7:	6a 01                	push   $0x1
+ 1a9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1ac:	50                   	push   %eax
+ 1ad:	6a 00                	push   $0x0
+ 1af:	e8 b1 01 00 00       	call   365 <read>
+    if(cc < 1)
+ 1b4:	83 c4 10             	add    $0x10,%esp
+ 1b7:	85 c0                	test   %eax,%eax
+ 1b9:	7e 17                	jle    1d2 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1bb:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1bf:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1c2:	3c 0a                	cmp    $0xa,%al
+ 1c4:	0f 94 c2             	sete   %dl
+ 1c7:	3c 0d                	cmp    $0xd,%al
+ 1c9:	0f 94 c0             	sete   %al
+ 1cc:	08 c2                	or     %al,%dl
+ 1ce:	74 ca                	je     19a <gets+0x11>
+    buf[i++] = c;
+ 1d0:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1d2:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 1d6:	89 f8                	mov    %edi,%eax
+ 1d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1db:	5b                   	pop    %ebx
+ 1dc:	5e                   	pop    %esi
+ 1dd:	5f                   	pop    %edi
+ 1de:	5d                   	pop    %ebp
+ 1df:	c3                   	ret
+
+000001e0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 9b 01 00 00       	call   38d <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 24                	js     21d <stat+0x3d>
+ 1f9:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1fb:	83 ec 08             	sub    $0x8,%esp
+ 1fe:	ff 75 0c             	push   0xc(%ebp)
+ 201:	50                   	push   %eax
+ 202:	e8 9e 01 00 00       	call   3a5 <fstat>
+ 207:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 209:	89 1c 24             	mov    %ebx,(%esp)
+ 20c:	e8 64 01 00 00       	call   375 <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	89 f0                	mov    %esi,%eax
+ 216:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+    return -1;
+ 21d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 222:	eb f0                	jmp    214 <stat+0x34>
+
+00000224 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 224:	55                   	push   %ebp
+ 225:	89 e5                	mov    %esp,%ebp
+ 227:	56                   	push   %esi
+ 228:	53                   	push   %ebx
+ 229:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 22c:	eb 03                	jmp    231 <atoi+0xd>
+ 22e:	83 c2 01             	add    $0x1,%edx
+ 231:	0f b6 02             	movzbl (%edx),%eax
+ 234:	3c 20                	cmp    $0x20,%al
+ 236:	74 f6                	je     22e <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 238:	3c 2d                	cmp    $0x2d,%al
+ 23a:	74 1d                	je     259 <atoi+0x35>
+ 23c:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 241:	3c 2b                	cmp    $0x2b,%al
+ 243:	0f 94 c1             	sete   %cl
+ 246:	3c 2d                	cmp    $0x2d,%al
+ 248:	0f 94 c0             	sete   %al
+ 24b:	08 c1                	or     %al,%cl
+ 24d:	74 03                	je     252 <atoi+0x2e>
+    s++;
+ 24f:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 252:	b8 00 00 00 00       	mov    $0x0,%eax
+ 257:	eb 17                	jmp    270 <atoi+0x4c>
+ 259:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 25e:	eb e1                	jmp    241 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 260:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 263:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 266:	83 c2 01             	add    $0x1,%edx
+ 269:	0f be c9             	movsbl %cl,%ecx
+ 26c:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 270:	0f b6 0a             	movzbl (%edx),%ecx
+ 273:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 276:	80 fb 09             	cmp    $0x9,%bl
+ 279:	76 e5                	jbe    260 <atoi+0x3c>
+  return sign*n;
+ 27b:	0f af c6             	imul   %esi,%eax
+}
+ 27e:	5b                   	pop    %ebx
+ 27f:	5e                   	pop    %esi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+
+00000282 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 282:	55                   	push   %ebp
+ 283:	89 e5                	mov    %esp,%ebp
+ 285:	56                   	push   %esi
+ 286:	53                   	push   %ebx
+ 287:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 28a:	eb 03                	jmp    28f <atoo+0xd>
+ 28c:	83 c2 01             	add    $0x1,%edx
+ 28f:	0f b6 02             	movzbl (%edx),%eax
+ 292:	3c 20                	cmp    $0x20,%al
+ 294:	74 f6                	je     28c <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 296:	3c 2d                	cmp    $0x2d,%al
+ 298:	74 1d                	je     2b7 <atoo+0x35>
+ 29a:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 29f:	3c 2b                	cmp    $0x2b,%al
+ 2a1:	0f 94 c1             	sete   %cl
+ 2a4:	3c 2d                	cmp    $0x2d,%al
+ 2a6:	0f 94 c0             	sete   %al
+ 2a9:	08 c1                	or     %al,%cl
+ 2ab:	74 03                	je     2b0 <atoo+0x2e>
+    s++;
+ 2ad:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 2b0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2b5:	eb 11                	jmp    2c8 <atoo+0x46>
+ 2b7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2bc:	eb e1                	jmp    29f <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 2be:	83 c2 01             	add    $0x1,%edx
+ 2c1:	0f be c9             	movsbl %cl,%ecx
+ 2c4:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 2c8:	0f b6 0a             	movzbl (%edx),%ecx
+ 2cb:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2ce:	80 fb 07             	cmp    $0x7,%bl
+ 2d1:	76 eb                	jbe    2be <atoo+0x3c>
+  return sign*n;
+ 2d3:	0f af c6             	imul   %esi,%eax
+}
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5d                   	pop    %ebp
+ 2d9:	c3                   	ret
+
+000002da <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 2da:	55                   	push   %ebp
+ 2db:	89 e5                	mov    %esp,%ebp
+ 2dd:	53                   	push   %ebx
+ 2de:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 2e4:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 2e7:	eb 09                	jmp    2f2 <strncmp+0x18>
+      n--, p++, q++;
+ 2e9:	83 e8 01             	sub    $0x1,%eax
+ 2ec:	83 c2 01             	add    $0x1,%edx
+ 2ef:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 2f2:	85 c0                	test   %eax,%eax
+ 2f4:	74 0b                	je     301 <strncmp+0x27>
+ 2f6:	0f b6 1a             	movzbl (%edx),%ebx
+ 2f9:	84 db                	test   %bl,%bl
+ 2fb:	74 04                	je     301 <strncmp+0x27>
+ 2fd:	3a 19                	cmp    (%ecx),%bl
+ 2ff:	74 e8                	je     2e9 <strncmp+0xf>
+    if(n == 0)
+ 301:	85 c0                	test   %eax,%eax
+ 303:	74 0d                	je     312 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 305:	0f b6 02             	movzbl (%edx),%eax
+ 308:	0f b6 11             	movzbl (%ecx),%edx
+ 30b:	29 d0                	sub    %edx,%eax
+}
+ 30d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 310:	c9                   	leave
+ 311:	c3                   	ret
+      return 0;
+ 312:	b8 00 00 00 00       	mov    $0x0,%eax
+ 317:	eb f4                	jmp    30d <strncmp+0x33>
+
+00000319 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 319:	55                   	push   %ebp
+ 31a:	89 e5                	mov    %esp,%ebp
+ 31c:	56                   	push   %esi
+ 31d:	53                   	push   %ebx
+ 31e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 321:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 324:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 327:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 329:	eb 0d                	jmp    338 <memmove+0x1f>
+    *dst++ = *src++;
+ 32b:	0f b6 01             	movzbl (%ecx),%eax
+ 32e:	88 02                	mov    %al,(%edx)
+ 330:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 333:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 336:	89 d8                	mov    %ebx,%eax
+ 338:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 33b:	85 c0                	test   %eax,%eax
+ 33d:	7f ec                	jg     32b <memmove+0x12>
+  return vdst;
+}
+ 33f:	89 f0                	mov    %esi,%eax
+ 341:	5b                   	pop    %ebx
+ 342:	5e                   	pop    %esi
+ 343:	5d                   	pop    %ebp
+ 344:	c3                   	ret
+
+00000345 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 345:	b8 01 00 00 00       	mov    $0x1,%eax
+ 34a:	cd 40                	int    $0x40
+ 34c:	c3                   	ret
+
+0000034d <exit>:
+SYSCALL(exit)
+ 34d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 352:	cd 40                	int    $0x40
+ 354:	c3                   	ret
+
+00000355 <wait>:
+SYSCALL(wait)
+ 355:	b8 03 00 00 00       	mov    $0x3,%eax
+ 35a:	cd 40                	int    $0x40
+ 35c:	c3                   	ret
+
+0000035d <pipe>:
+SYSCALL(pipe)
+ 35d:	b8 04 00 00 00       	mov    $0x4,%eax
+ 362:	cd 40                	int    $0x40
+ 364:	c3                   	ret
+
+00000365 <read>:
+SYSCALL(read)
+ 365:	b8 05 00 00 00       	mov    $0x5,%eax
+ 36a:	cd 40                	int    $0x40
+ 36c:	c3                   	ret
+
+0000036d <write>:
+SYSCALL(write)
+ 36d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 372:	cd 40                	int    $0x40
+ 374:	c3                   	ret
+
+00000375 <close>:
+SYSCALL(close)
+ 375:	b8 15 00 00 00       	mov    $0x15,%eax
+ 37a:	cd 40                	int    $0x40
+ 37c:	c3                   	ret
+
+0000037d <kill>:
+SYSCALL(kill)
+ 37d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 382:	cd 40                	int    $0x40
+ 384:	c3                   	ret
+
+00000385 <exec>:
+SYSCALL(exec)
+ 385:	b8 07 00 00 00       	mov    $0x7,%eax
+ 38a:	cd 40                	int    $0x40
+ 38c:	c3                   	ret
+
+0000038d <open>:
+SYSCALL(open)
+ 38d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 392:	cd 40                	int    $0x40
+ 394:	c3                   	ret
+
+00000395 <mknod>:
+SYSCALL(mknod)
+ 395:	b8 11 00 00 00       	mov    $0x11,%eax
+ 39a:	cd 40                	int    $0x40
+ 39c:	c3                   	ret
+
+0000039d <unlink>:
+SYSCALL(unlink)
+ 39d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3a2:	cd 40                	int    $0x40
+ 3a4:	c3                   	ret
+
+000003a5 <fstat>:
+SYSCALL(fstat)
+ 3a5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3aa:	cd 40                	int    $0x40
+ 3ac:	c3                   	ret
+
+000003ad <link>:
+SYSCALL(link)
+ 3ad:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3b2:	cd 40                	int    $0x40
+ 3b4:	c3                   	ret
+
+000003b5 <mkdir>:
+SYSCALL(mkdir)
+ 3b5:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ba:	cd 40                	int    $0x40
+ 3bc:	c3                   	ret
+
+000003bd <chdir>:
+SYSCALL(chdir)
+ 3bd:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3c2:	cd 40                	int    $0x40
+ 3c4:	c3                   	ret
+
+000003c5 <dup>:
+SYSCALL(dup)
+ 3c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3ca:	cd 40                	int    $0x40
+ 3cc:	c3                   	ret
+
+000003cd <getpid>:
+SYSCALL(getpid)
+ 3cd:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3d2:	cd 40                	int    $0x40
+ 3d4:	c3                   	ret
+
+000003d5 <sbrk>:
+SYSCALL(sbrk)
+ 3d5:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3da:	cd 40                	int    $0x40
+ 3dc:	c3                   	ret
+
+000003dd <sleep>:
+SYSCALL(sleep)
+ 3dd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3e2:	cd 40                	int    $0x40
+ 3e4:	c3                   	ret
+
+000003e5 <uptime>:
+SYSCALL(uptime)
+ 3e5:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3ea:	cd 40                	int    $0x40
+ 3ec:	c3                   	ret
+
+000003ed <halt>:
+SYSCALL(halt)
+ 3ed:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3f2:	cd 40                	int    $0x40
+ 3f4:	c3                   	ret
+
+000003f5 <date>:
+SYSCALL(date)
+ 3f5:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3fa:	cd 40                	int    $0x40
+ 3fc:	c3                   	ret
+
+000003fd <getuid>:
+SYSCALL(getuid)
+ 3fd:	b8 18 00 00 00       	mov    $0x18,%eax
+ 402:	cd 40                	int    $0x40
+ 404:	c3                   	ret
+
+00000405 <getgid>:
+SYSCALL(getgid)
+ 405:	b8 19 00 00 00       	mov    $0x19,%eax
+ 40a:	cd 40                	int    $0x40
+ 40c:	c3                   	ret
+
+0000040d <getppid>:
+SYSCALL(getppid)
+ 40d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 412:	cd 40                	int    $0x40
+ 414:	c3                   	ret
+
+00000415 <setuid>:
+SYSCALL(setuid)
+ 415:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 41a:	cd 40                	int    $0x40
+ 41c:	c3                   	ret
+
+0000041d <setgid>:
+SYSCALL(setgid)
+ 41d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 422:	cd 40                	int    $0x40
+ 424:	c3                   	ret
+
+00000425 <getprocs>:
+SYSCALL(getprocs)
+ 425:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 42a:	cd 40                	int    $0x40
+ 42c:	c3                   	ret
+
+0000042d <getpriority>:
+SYSCALL(getpriority)
+ 42d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 432:	cd 40                	int    $0x40
+ 434:	c3                   	ret
+
+00000435 <setpriority>:
+SYSCALL(setpriority)
+ 435:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 43a:	cd 40                	int    $0x40
+ 43c:	c3                   	ret
+
+0000043d <pipesize>:
+SYSCALL(pipesize)
+ 43d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 442:	cd 40                	int    $0x40
+ 444:	c3                   	ret
+
+00000445 <splice>:
+SYSCALL(splice)
+ 445:	b8 21 00 00 00       	mov    $0x21,%eax
+ 44a:	cd 40                	int    $0x40
+ 44c:	c3                   	ret
@@ -23,6 +23,8 @@
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
+static void dirindexfree(struct inode*);
+static void dcachepurge(uint, uint);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb;
@@ -51,32 +53,87 @@ bzero(int dev, int bno)
 }
 
 // Blocks.
+//
+// bsum counts the free blocks in each group of BGROUP blocks,
+// so balloc can pass over full parts of the bitmap without
+// reading them. It is built by iinit2 and kept up to date by
+// balloc and bfree.
+
+#define BGROUP 256   // must divide BPB
+#define NBGROUP ((FSSIZE + BGROUP - 1) / BGROUP)
 
-// Allocate a zeroed disk block.
+static struct {
+  struct spinlock lock;
+  int ngroup;
+  ushort nfree[NBGROUP];
+} bsum;
+
+// Allocate the first free block in [b, end), which must lie
+// in one bitmap block, looking at 32 bits at a time.
+// Returns 0 if there is none.
 static uint
-balloc(uint dev)
+bscan(uint dev, uint b, uint end)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint *w, base, bi, bits;
 
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
-    bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
-      }
-    }
+  base = b - b % BPB;
+  bp = bread(dev, BBLOCK(b, sb));
+  w = (uint*)bp->data;
+  for(bi = b - base; bi < end - base; bi = bi - bi%32 + 32){
+    bits = ~w[bi/32] & (~0U << (bi%32));  // free bits from bi on
+    if(bits == 0)
+      continue;
+    bi = bi - bi%32 + __builtin_ctz(bits);
+    if(bi >= end - base)
+      break;
+    w[bi/32] |= 1U << (bi%32);  // Mark block in use.
+    log_write(bp);
     brelse(bp);
+    return base + bi;
+  }
+  brelse(bp);
+  return 0;
+}
+
+// Allocate a zeroed disk block, preferably goal or the first
+// free one after it.
+static uint
+balloc(uint dev, uint goal)
+{
+  uint b, g, i, n;
+
+  if(goal >= sb.size)
+    goal = 0;
+  g = goal / BGROUP;
+  // Visit goal's group last again, for the blocks before goal.
+  for(i = 0; i <= bsum.ngroup; i++, g = (g + 1) % bsum.ngroup){
+    acquire(&bsum.lock);
+    n = bsum.nfree[g];
+    release(&bsum.lock);
+    if(n == 0)
+      continue;
+    b = bscan(dev, i == 0 ? goal : g*BGROUP, min((g+1)*BGROUP, sb.size));
+    if(b != 0){
+      acquire(&bsum.lock);
+      bsum.nfree[g]--;
+      release(&bsum.lock);
+      bzero(dev, b);
+      return b;
+    }
   }
   panic("balloc: out of blocks");
 }
 
+// Allocate a block for ip, next to the last one it got if
+// possible, so a file's blocks end up contiguous.
+static uint
+iballoc(struct inode *ip)
+{
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+  return ip->lastblk;
+}
+
 // Free a disk block.
 static void
 bfree(int dev, uint b)
@@ -84,7 +141,6 @@ bfree(int dev, uint b)
   struct buf *bp;
   int bi, m;
 
-  readsb(dev, &sb);
   bp = bread(dev, BBLOCK(b, sb));
   bi = b % BPB;
   m = 1 << (bi % 8);
@@ -93,6 +149,9 @@ bfree(int dev, uint b)
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+  acquire(&bsum.lock);
+  bsum.nfree[b / BGROUP]++;
+  release(&bsum.lock);
 }
 
 // Inodes.
@@ -120,12 +179,13 @@ bfree(int dev, uint b)
 //   is non-zero. ialloc() allocates, and iput() frees if
 //   the reference and link counts have fallen to zero.
 //
-// * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
-//   the number of in-memory pointers to the entry (open
-//   files and current directories). iget() finds or
-//   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+// * Referencing in cache: ip->ref tracks the number of
+//   in-memory pointers to the entry (open files and current
+//   directories). iget() finds or creates a cache entry and
+//   increments its ref; iput() decrements ref. An entry
+//   whose ref is zero may be recycled for another inode,
+//   least recently used first; until then iget() can find
+//   it again, still valid.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
@@ -155,39 +215,184 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// The cache starts with the NINODE entries in icache.inode and
+// grows a page at a time when every entry is referenced.
+//
+// Cached inodes are found through a hash table keyed on
+// (dev, inum). Each bucket's lock guards ip->ref of the inodes
+// hashed there; unreferenced inodes also sit on an LRU list
+// under icache.lrulock. Recycling an entry, which changes
+// ip->dev and ip->inum, happens only under icache.evictlock.
+// Lock order: evictlock, then a bucket lock, then lrulock.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
-struct {
+#define NIBUCKET 31
+
+struct ibucket {
   struct spinlock lock;
+  struct inode *head;     // chained through inode.hnext
+};
+
+struct {
+  struct ibucket bucket[NIBUCKET];
+  struct spinlock evictlock;
+
+  // Linked list of unreferenced inodes, through lprev/lnext.
+  // head.lnext is most recently used.
+  struct spinlock lrulock;
+  struct inode head;
+
   struct inode inode[NINODE];
 } icache;
 
+static struct ibucket*
+ihash(uint dev, uint inum)
+{
+  return &icache.bucket[(dev ^ inum) % NIBUCKET];
+}
+
+// Put ip on the LRU list: at the MRU end, or at the LRU end
+// to be recycled first if tail is set.
+static void
+ilruadd(struct inode *ip, int tail)
+{
+  struct inode *h;
+
+  acquire(&icache.lrulock);
+  h = tail ? icache.head.lprev : &icache.head;
+  ip->lnext = h->lnext;
+  ip->lprev = h;
+  h->lnext->lprev = ip;
+  h->lnext = ip;
+  release(&icache.lrulock);
+}
+
+static void
+ilruremove(struct inode *ip)
+{
+  acquire(&icache.lrulock);
+  ip->lnext->lprev = ip->lprev;
+  ip->lprev->lnext = ip->lnext;
+  release(&icache.lrulock);
+}
+
+// Name cache.
+//
+// dcache remembers recent lookups of name in directory dir,
+// including failed ones (inum 0), so repeated path resolution
+// skips reading directories. It is direct-mapped on a hash of
+// (dir, name). Entries change only with the directory locked:
+// dirlookup fills them in, dirlink and dirunlink update them,
+// and dcachepurge drops a freed directory's entries.
+
+#define NDCACHE 256
+
+struct dcentry {
+  uint dev;
+  uint dir;      // directory inum, 0 if unused
+  uint inum;     // 0 if name is not in dir
+  char name[DIRSIZ];
+};
+
+static struct {
+  struct spinlock lock;
+  struct dcentry e[NDCACHE];
+} dcache;
+
 void
 iinit(int dev)
 {
   int i = 0;
 
-  initlock(&icache.lock, "icache");
+  for(i = 0; i < NIBUCKET; i++)
+    initlock(&icache.bucket[i].lock, "icache.bucket");
+  initlock(&icache.evictlock, "icache.evict");
+  initlock(&icache.lrulock, "icache.lru");
+  initlock(&dcache.lock, "dcache");
+  icache.head.lprev = &icache.head;
+  icache.head.lnext = &icache.head;
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
+    ilruadd(&icache.inode[i], 0);
   }
 
   readsb(dev, &sb);
+  if(sb.bsize != BSIZE)
+    panic("iinit: block size");
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
           sb.bmapstart);
 }
 
+// ifree has a bit set for each free on-disk inode, built by
+// iinit2, so ialloc need not read inode blocks to find one.
+// Bits before inext are all clear.
+static struct {
+  struct spinlock lock;
+  uint inext;
+  uint map[NINODES/32 + 1];
+} ifree;
+
+// Second half of mounting, once the log has been recovered:
+// count the free blocks for balloc and find the free inodes.
+void
+iinit2(int dev)
+{
+  struct buf *bp;
+  struct dinode *dip;
+  uint b, inum;
+
+  bsum.ngroup = (sb.size + BGROUP - 1) / BGROUP;
+  if(bsum.ngroup > NBGROUP)
+    panic("iinit2: file system too big");
+  initlock(&bsum.lock, "bsum");
+  bp = 0;
+  for(b = 0; b < sb.size; b++){
+    if(b % BPB == 0){
+      if(bp)
+        brelse(bp);
+      bp = bread(dev, BBLOCK(b, sb));
+    }
+    if((bp->data[(b % BPB)/8] & (1 << (b % 8))) == 0)
+      bsum.nfree[b / BGROUP]++;
+  }
+  brelse(bp);
+
+  if(sb.ninodes > NINODES)
+    panic("iinit2: too many inodes");
+  initlock(&ifree.lock, "ifree");
+  ifree.inext = 1;
+  bp = 0;
+  for(inum = 1; inum < sb.ninodes; inum++){
+    if(bp == 0 || inum % IPB == 0){
+      if(bp)
+        brelse(bp);
+      bp = bread(dev, IBLOCK(inum, sb));
+    }
+    dip = (struct dinode*)bp->data + inum%IPB;
+    if(dip->type == 0)
+      ifree.map[inum/32] |= 1U << (inum%32);
+  }
+  if(bp)
+    brelse(bp);
+}
+
 static struct inode* iget(uint dev, uint inum);
 
+static void
+ifreemark(uint inum)
+{
+  acquire(&ifree.lock);
+  ifree.map[inum/32] |= 1U << (inum%32);
+  if(inum < ifree.inext)
+    ifree.inext = inum;
+  release(&ifree.lock);
+}
+
 //PAGEBREAK!
 // Allocate an inode on device dev.
 // Mark it as allocated by  giving it type type.
@@ -195,23 +400,30 @@ static struct inode* iget(uint dev, uint inum);
 struct inode*
 ialloc(uint dev, short type)
 {
-  int inum;
+  uint inum, w = 0;
   struct buf *bp;
   struct dinode *dip;
 
-  for(inum = 1; inum < sb.ninodes; inum++){
-    bp = bread(dev, IBLOCK(inum, sb));
-    dip = (struct dinode*)bp->data + inum%IPB;
-    if(dip->type == 0){  // a free inode
-      memset(dip, 0, sizeof(*dip));
-      dip->type = type;
-      log_write(bp);   // mark it allocated on the disk
-      brelse(bp);
-      return iget(dev, inum);
-    }
-    brelse(bp);
-  }
-  panic("ialloc: no inodes");
+  acquire(&ifree.lock);
+  for(inum = ifree.inext - ifree.inext%32; inum < sb.ninodes; inum += 32)
+    if((w = ifree.map[inum/32]) != 0)
+      break;
+  if(inum >= sb.ninodes)
+    panic("ialloc: no inodes");
+  inum += __builtin_ctz(w);
+  ifree.map[inum/32] &= ~(1U << (inum%32));
+  ifree.inext = inum + 1;
+  release(&ifree.lock);
+
+  bp = bread(dev, IBLOCK(inum, sb));
+  dip = (struct dinode*)bp->data + inum%IPB;
+  if(dip->type != 0)
+    panic("ialloc: inode in use");
+  memset(dip, 0, sizeof(*dip));
+  dip->type = type;
+  log_write(bp);   // mark it allocated on the disk
+  brelse(bp);
+  return iget(dev, inum);
 }
 
 // Copy a modified in-memory inode to disk.
@@ -236,38 +448,108 @@ iupdate(struct inode *ip)
   brelse(bp);
 }
 
+// Add a page of unused entries to the inode cache.
+// Returns 0 if out of memory.
+static int
+igrow(void)
+{
+  struct inode *ip, *np;
+
+  if((np = (struct inode*)kalloc()) == 0)
+    return 0;
+  memset(np, 0, PGSIZE);
+  for(ip = np; ip < np + PGSIZE/sizeof(*ip); ip++){
+    initsleeplock(&ip->lock, "inode");
+    ilruadd(ip, 0);
+  }
+  return 1;
+}
+
+// Look for inode (dev, inum) in bucket bk and take a reference.
+// Caller must hold bk->lock.
+static struct inode*
+ilookup(struct ibucket *bk, uint dev, uint inum)
+{
+  struct inode *ip;
+
+  for(ip = bk->head; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        ilruremove(ip);
+      return ip;
+    }
+  }
+  return 0;
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
+  struct ibucket *bk, *obk;
 
-  acquire(&icache.lock);
+  bk = ihash(dev, inum);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
-      release(&icache.lock);
-      return ip;
-    }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
+  acquire(&bk->lock);
+  ip = ilookup(bk, dev, inum);
+  release(&bk->lock);
+  if(ip)
+    return ip;
+
+  // Not cached. Look again now that no one else can be
+  // adding inodes, in case another miss just brought it in.
+  acquire(&icache.evictlock);
+  acquire(&bk->lock);
+  ip = ilookup(bk, dev, inum);
+  release(&bk->lock);
+  if(ip){
+    release(&icache.evictlock);
+    return ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
+  // Recycle the least recently used unreferenced entry,
+  // growing the cache by a page of entries if there is none.
+  for(;;){
+    acquire(&icache.lrulock);
+    ip = icache.head.lprev;
+    release(&icache.lrulock);
+    if(ip == &icache.head){
+      if(igrow() == 0)
+        panic("iget: no inodes");
+      continue;
+    }
+
+    // ip's identity can't change under us (we hold evictlock),
+    // but someone may have taken a reference in the meantime.
+    obk = ihash(ip->dev, ip->inum);
+    acquire(&obk->lock);
+    if(ip->ref == 0)
+      break;
+    release(&obk->lock);
+  }
+  for(pp = &obk->head; *pp; pp = &(*pp)->hnext){
+    if(*pp == ip){
+      *pp = ip->hnext;
+      break;
+    }
+  }
+  ilruremove(ip);
+  ip->ref = 1;
+  release(&obk->lock);
 
-  ip = empty;
+  dirindexfree(ip);
   ip->dev = dev;
   ip->inum = inum;
-  ip->ref = 1;
   ip->valid = 0;
-  release(&icache.lock);
+  acquire(&bk->lock);
+  ip->hnext = bk->head;
+  bk->head = ip;
+  release(&bk->lock);
+  release(&icache.evictlock);
 
   return ip;
 }
@@ -277,12 +559,29 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
+  struct ibucket *bk;
+
+  bk = ihash(ip->dev, ip->inum);
+  acquire(&bk->lock);
   ip->ref++;
-  release(&icache.lock);
+  release(&bk->lock);
   return ip;
 }
 
+// Count one more (n = 1) or one fewer (n = -1) process that
+// demand-loads its program from ip (see loadpage in vm.c).
+// While any do, writes to ip fail, so a running program's
+// text can't change underneath it.
+void
+iexecref(struct inode *ip, int n)
+{
+  ilock(ip);
+  ip->nexec += n;
+  if(ip->nexec < 0)
+    panic("iexecref");
+  iunlock(ip);
+}
+
 // Lock the given inode.
 // Reads the inode from disk if necessary.
 void
@@ -306,6 +605,8 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->nmap = 0;
+    ip->lastblk = 0;
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -332,24 +633,30 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  struct ibucket *bk = ihash(ip->dev, ip->inum);
+
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
+    acquire(&bk->lock);
     int r = ip->ref;
-    release(&icache.lock);
+    release(&bk->lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
       itrunc(ip);
       ip->type = 0;
       iupdate(ip);
       ip->valid = 0;
+      dirindexfree(ip);
+      dcachepurge(ip->dev, ip->inum);
+      ifreemark(ip->inum);
     }
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  release(&icache.lock);
+  acquire(&bk->lock);
+  if(--ip->ref == 0)
+    ilruadd(ip, !ip->valid);
+  release(&bk->lock);
 }
 
 // Common idiom: unlock, then put.
@@ -366,38 +673,106 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT], and the NDINDIRECT after
+// those in the indirect blocks listed in block ip->addrs[NDIRECT+1].
+// ip->map[] keeps the last NBMAP mappings read from an indirect
+// block, so sequential access doesn't bread it for every block.
 
 // Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// If there is no such block, allocate one if alloc is set,
+// else return 0.
 static uint
-bmap(struct inode *ip, uint bn)
+bmap1(struct inode *ip, uint bn, int alloc)
 {
-  uint addr, *a;
+  uint addr, i, *a;
   struct buf *bp;
 
   if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[bn]) == 0 && alloc)
+      ip->addrs[bn] = addr = iballoc(ip);
     return addr;
   }
-  bn -= NDIRECT;
+  if(bn - ip->mapbn < ip->nmap && (addr = ip->map[bn - ip->mapbn]) != 0)
+    return addr;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+  // Find the indirect block holding the mapping, allocating
+  // the path to it if necessary.
+  i = bn - NDIRECT;
+  if(i < NINDIRECT){
+    if((addr = ip->addrs[NDIRECT]) == 0){
+      if(!alloc)
+        return 0;
+      ip->addrs[NDIRECT] = addr = iballoc(ip);
+    }
+  } else {
+    i -= NINDIRECT;
+    if(i >= NDINDIRECT)
+      panic("bmap: out of range");
+    if((addr = ip->addrs[NDIRECT+1]) == 0){
+      if(!alloc)
+        return 0;
+      ip->addrs[NDIRECT+1] = addr = iballoc(ip);
+    }
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+    if((addr = a[i/NINDIRECT]) == 0 && alloc){
+      a[i/NINDIRECT] = addr = iballoc(ip);
       log_write(bp);
     }
     brelse(bp);
-    return addr;
+    if(addr == 0)
+      return 0;
+    i %= NINDIRECT;
+  }
+
+  bp = bread(ip->dev, addr);
+  a = (uint*)bp->data;
+  if((addr = a[i]) == 0 && alloc){
+    a[i] = addr = iballoc(ip);
+    log_write(bp);
   }
+  // Remember the neighbouring mappings too.
+  ip->mapbn = bn - i%NBMAP;
+  ip->nmap = NBMAP;
+  memmove(ip->map, a + i - i%NBMAP, sizeof(ip->map));
+  brelse(bp);
+  return addr;
+}
+
+static uint
+bmap(struct inode *ip, uint bn)
+{
+  // After the inode is reloaded, continue from its current
+  // last block so appends stay next to the existing data.
+  // Not in iballoc: bmap1 may hold the indirect block then.
+  if(ip->lastblk == 0 && ip->size > 0)
+    ip->lastblk = bmap1(ip, (ip->size-1)/BSIZE, 0);
+  return bmap1(ip, bn, 1);
+}
 
-  panic("bmap: out of range");
+// Like bmap, but don't allocate: 0 if bn has no block yet.
+static uint
+bmappeek(struct inode *ip, uint bn)
+{
+  return bmap1(ip, bn, 0);
+}
+
+// Free indirect block addr and the blocks it lists.
+static void
+bfreeind(uint dev, uint addr)
+{
+  int j;
+  struct buf *bp;
+  uint *a;
+
+  bp = bread(dev, addr);
+  a = (uint*)bp->data;
+  for(j = 0; j < NINDIRECT; j++){
+    if(a[j])
+      bfree(dev, a[j]);
+  }
+  brelse(bp);
+  bfree(dev, addr);
 }
 
 // Truncate inode (discard contents).
@@ -420,17 +795,23 @@ itrunc(struct inode *ip)
   }
 
   if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+    bfreeind(ip->dev, ip->addrs[NDIRECT]);
+    ip->addrs[NDIRECT] = 0;
+  }
+
+  if(ip->addrs[NDIRECT+1]){
+    bp = bread(ip->dev, ip->addrs[NDIRECT+1]);
     a = (uint*)bp->data;
     for(j = 0; j < NINDIRECT; j++){
       if(a[j])
-        bfree(ip->dev, a[j]);
+        bfreeind(ip->dev, a[j]);
     }
     brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
+    bfree(ip->dev, ip->addrs[NDIRECT+1]);
+    ip->addrs[NDIRECT+1] = 0;
   }
 
+  ip->nmap = 0;
   ip->size = 0;
   iupdate(ip);
 }
@@ -467,6 +848,11 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  // Get the disk working on all the blocks at once
+  // rather than one round trip per block.
+  if(n > BSIZE - off%BSIZE)
+    readahead(ip, off, n);
+
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
@@ -476,6 +862,114 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   return n;
 }
 
+// Start reading the blocks of ip that hold [off, off+n)
+// into the buffer cache, without waiting for them. At most
+// NREADAHEAD blocks are started, so as not to flood the cache.
+// Caller must hold ip->lock.
+void
+readahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, addr;
+
+  if(ip->type == T_DEV || off >= ip->size)
+    return;
+  if(off + n > ip->size || off + n < off)
+    n = ip->size - off;
+  if(n > NREADAHEAD*BSIZE - off%BSIZE)
+    n = NREADAHEAD*BSIZE - off%BSIZE;
+  for(bn = off/BSIZE; bn <= (off + n - 1)/BSIZE; bn++)
+    if((addr = bmappeek(ip, bn)) != 0)
+      breadahead(ip->dev, addr);
+}
+
+// Move up to n bytes of ip from off into pipe p, straight out
+// of the buffer cache, stopping when the pipe is full.
+// Caller must hold ip->lock. Returns the number of bytes moved,
+// or -1 if ip is a device or the pipe has no reader.
+int
+readipipe(struct inode *ip, struct pipe *p, uint off, uint n)
+{
+  uint tot;
+  int m, r;
+  struct buf *bp;
+
+  if(ip->type == T_DEV || off > ip->size || off + n < off)
+    return -1;
+  if(off + n > ip->size)
+    n = ip->size - off;
+  if(n > BSIZE - off%BSIZE)
+    readahead(ip, off, n);
+
+  for(tot=0; tot<n; tot+=r, off+=r){
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+    r = pipeput(p, (char*)bp->data + off%BSIZE, m);
+    brelse(bp);
+    if(r < 0)
+      return tot > 0 ? tot : -1;
+    if(r < m){
+      tot += r;
+      break;
+    }
+  }
+  return tot;
+}
+
+// Move up to n bytes from pipe p into ip at off, straight into
+// the buffer cache, stopping when the pipe is empty. A block
+// that isn't allocated yet is only allocated once its data is
+// out of the pipe, staged in a page, so that a pipe drained by
+// another reader meanwhile doesn't leave a block past the end.
+// Caller must hold ip->lock and be in a transaction.
+int
+writeipipe(struct inode *ip, struct pipe *p, uint off, uint n)
+{
+  uint tot, addr;
+  int m, r;
+  struct buf *bp;
+  char *stage;
+
+  if(ip->type == T_DEV || ip->nexec > 0 || off > ip->size || off + n < off)
+    return -1;
+  if(n > 0 && (off + n - 1)/BSIZE >= MAXFILE)
+    return -1;
+
+  stage = 0;
+  for(tot=0; tot<n; tot+=r, off+=r){
+    m = min(n - tot, BSIZE - off%BSIZE);
+    if((addr = bmappeek(ip, off/BSIZE)) != 0){
+      bp = bread(ip->dev, addr);
+      r = pipeget(p, (char*)bp->data + off%BSIZE, m);
+    } else {
+      if(stage == 0 && (stage = kalloc()) == 0){
+        if(tot == 0)
+          return -1;
+        break;
+      }
+      if((r = pipeget(p, stage, m)) == 0)
+        break;
+      bp = bread(ip->dev, bmap(ip, off/BSIZE));
+      memmove(bp->data + off%BSIZE, stage, r);
+    }
+    if(r > 0)
+      log_write(bp);
+    brelse(bp);
+    if(r < m){
+      tot += r;
+      off += r;
+      break;
+    }
+  }
+  if(stage)
+    kfree(stage);
+
+  if(tot > 0 && off > ip->size){
+    ip->size = off;
+    iupdate(ip);
+  }
+  return tot;
+}
+
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
@@ -491,9 +985,11 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return devsw[ip->major].write(ip, src, n);
   }
 
+  if(ip->nexec > 0)
+    return -1;  // a running program's text
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if(n > 0 && (off + n - 1)/BSIZE >= MAXFILE)
     return -1;
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
@@ -520,17 +1016,199 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Directory index.
+//
+// A directory bigger than DIRIDXMIN gets an in-memory hash
+// table from names to dirent slots, built by its first lookup,
+// kept up to date by dirlink and dirunlink, and dropped when the
+// inode leaves the cache. The on-disk format is unchanged.
+// The table lives in ndirhash pages, listed in one more page,
+// and is kept at most half full, counting deleted slots, so
+// probes stay short; it is rebuilt bigger as the directory grows.
+
+#define DIRIDXMIN BSIZE                   // index dirs bigger than this
+#define DIRSLOTS (PGSIZE / sizeof(uint))  // hash slots per page
+#define DIRPAGES (PGSIZE / sizeof(uint*)) // max pages in an index
+#define DIRDEL 0xFFFFFFFF                // slot of a removed entry
+
+static uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 0;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return h;
+}
+
+static uint*
+dirslot(struct inode *dp, uint i)
+{
+  return &dp->dirhash[i / DIRSLOTS][i % DIRSLOTS];
+}
+
+static void
+dirindexfree(struct inode *dp)
+{
+  int i;
+
+  for(i = 0; i < dp->ndirhash; i++)
+    kfree((char*)dp->dirhash[i]);
+  if(dp->dirhash)
+    kfree((char*)dp->dirhash);
+  dp->dirhash = 0;
+  dp->ndirhash = 0;
+}
+
+// Record that the dirent at off holds name.
+static void
+dirindexadd(struct inode *dp, char *name, uint off)
+{
+  uint i, n, *s;
+
+  n = dp->ndirhash * DIRSLOTS;
+  for(i = dirhash(name) % n; *(s = dirslot(dp, i)) != 0; i = (i + 1) % n)
+    if(*s == DIRDEL)
+      break;
+  if(*s == 0)
+    dp->dirused++;
+  *s = off / sizeof(struct dirent) + 1;
+}
+
+// (Re)build the index of directory dp, sized for twice the
+// entries it could hold now. dp stays unindexed if it is small
+// or memory is short.
+static void
+dirindex(struct inode *dp)
+{
+  uint off, n;
+  int npg;
+  struct buf *bp;
+  struct dirent *de;
+
+  dirindexfree(dp);
+  if(dp->size <= DIRIDXMIN)
+    return;
+  n = dp->size / sizeof(struct dirent);
+  for(npg = 1; npg * DIRSLOTS < 4*n; npg *= 2)
+    ;
+  if(npg > DIRPAGES)
+    return;
+  if((dp->dirhash = (uint**)kalloc()) == 0)
+    return;
+  for(dp->ndirhash = 0; dp->ndirhash < npg; dp->ndirhash++){
+    if((dp->dirhash[dp->ndirhash] = (uint*)kalloc()) == 0){
+      dirindexfree(dp);
+      return;
+    }
+    memset(dp->dirhash[dp->ndirhash], 0, PGSIZE);
+  }
+
+  dp->dirused = 0;
+  dp->dirfree = dp->size;
+  bp = 0;
+  for(off = 0; off < dp->size; off += sizeof(*de)){
+    if(bp == 0 || off % BSIZE == 0){
+      if(bp)
+        brelse(bp);
+      bp = bread(dp->dev, bmap(dp, off / BSIZE));
+    }
+    de = (struct dirent*)(bp->data + off % BSIZE);
+    if(de->inum != 0)
+      dirindexadd(dp, de->name, off);
+    else if(off < dp->dirfree)
+      dp->dirfree = off;
+  }
+  if(bp)
+    brelse(bp);
+}
+
+static struct dcentry*
+dcentry(struct inode *dp, char *name)
+{
+  return &dcache.e[(dirhash(name) + dp->inum*31) % NDCACHE];
+}
+
+// Look up name in dp. Returns 1 and sets *inum on a hit.
+static int
+dcacheget(struct inode *dp, char *name, uint *inum)
+{
+  struct dcentry *e;
+  int hit;
+
+  acquire(&dcache.lock);
+  e = dcentry(dp, name);
+  hit = e->dir == dp->inum && e->dev == dp->dev && namecmp(name, e->name) == 0;
+  if(hit)
+    *inum = e->inum;
+  release(&dcache.lock);
+  return hit;
+}
+
+static void
+dcacheput(struct inode *dp, char *name, uint inum)
+{
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  e = dcentry(dp, name);
+  e->dev = dp->dev;
+  e->dir = dp->inum;
+  e->inum = inum;
+  strncpy(e->name, name, DIRSIZ);
+  release(&dcache.lock);
+}
+
+// Forget the entries of directory inum, which is being freed.
+static void
+dcachepurge(uint dev, uint inum)
+{
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  for(e = dcache.e; e < &dcache.e[NDCACHE]; e++)
+    if(e->dir == inum && e->dev == dev)
+      e->dir = 0;
+  release(&dcache.lock);
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off, inum;
+  uint off, inum, i, n, v;
   struct dirent de;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
+  if(poff == 0 && dcacheget(dp, name, &inum))
+    return inum ? iget(dp->dev, inum) : 0;
+
+  if(dp->ndirhash == 0 && dp->size > DIRIDXMIN)
+    dirindex(dp);
+  if(dp->ndirhash){
+    n = dp->ndirhash * DIRSLOTS;
+    for(i = dirhash(name) % n; (v = *dirslot(dp, i)) != 0; i = (i + 1) % n){
+      if(v == DIRDEL)
+        continue;
+      off = (v - 1) * sizeof(de);
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlookup read");
+      if(de.inum != 0 && namecmp(name, de.name) == 0){
+        if(poff)
+          *poff = off;
+        dcacheput(dp, name, de.inum);
+        return iget(dp->dev, de.inum);
+      }
+    }
+    dcacheput(dp, name, 0);
+    return 0;
+  }
+
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlookup read");
@@ -541,10 +1219,12 @@ dirlookup(struct inode *dp, char *name, uint *poff)
       if(poff)
         *poff = off;
       inum = de.inum;
+      dcacheput(dp, name, inum);
       return iget(dp->dev, inum);
     }
   }
 
+  dcacheput(dp, name, 0);
   return 0;
 }
 
@@ -563,7 +1243,8 @@ dirlink(struct inode *dp, char *name, uint inum)
   }
 
   // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
+  off = dp->ndirhash ? dp->dirfree : 0;
+  for(; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlink read");
     if(de.inum == 0)
@@ -574,10 +1255,43 @@ dirlink(struct inode *dp, char *name, uint inum)
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  dcacheput(dp, name, inum);
 
+  if(dp->ndirhash){
+    dp->dirfree = off + sizeof(de);
+    dirindexadd(dp, name, off);
+    if(2 * dp->dirused > dp->ndirhash * DIRSLOTS)
+      dirindex(dp);
+  }
   return 0;
 }
 
+// Remove the directory entry at byte offset off from dp.
+void
+dirunlink(struct inode *dp, uint off)
+{
+  uint i, n, v;
+  struct dirent de;
+
+  if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("dirunlink read");
+  if(dp->ndirhash){
+    n = dp->ndirhash * DIRSLOTS;
+    for(i = dirhash(de.name) % n; (v = *dirslot(dp, i)) != 0; i = (i + 1) % n){
+      if(v == off / sizeof(de) + 1){
+        *dirslot(dp, i) = DIRDEL;
+        break;
+      }
+    }
+    if(off < dp->dirfree)
+      dp->dirfree = off;
+  }
+  dcacheput(dp, de.name, 0);
+  memset(&de, 0, sizeof(de));
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("unlink: writei");
+}
+
 //PAGEBREAK!
 // Paths
 
@@ -0,0 +1,1465 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <matchstar>:
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	8b 75 08             	mov    0x8(%ebp),%esi
+   c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+   f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+  12:	83 ec 08             	sub    $0x8,%esp
+  15:	53                   	push   %ebx
+  16:	57                   	push   %edi
+  17:	e8 2c 00 00 00       	call   48 <matchhere>
+  1c:	83 c4 10             	add    $0x10,%esp
+  1f:	85 c0                	test   %eax,%eax
+  21:	75 18                	jne    3b <matchstar+0x3b>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+  23:	0f b6 13             	movzbl (%ebx),%edx
+  26:	84 d2                	test   %dl,%dl
+  28:	74 16                	je     40 <matchstar+0x40>
+  2a:	83 c3 01             	add    $0x1,%ebx
+  2d:	0f be d2             	movsbl %dl,%edx
+  30:	39 f2                	cmp    %esi,%edx
+  32:	74 de                	je     12 <matchstar+0x12>
+  34:	83 fe 2e             	cmp    $0x2e,%esi
+  37:	74 d9                	je     12 <matchstar+0x12>
+  39:	eb 05                	jmp    40 <matchstar+0x40>
+      return 1;
+  3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  return 0;
+}
+  40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  43:	5b                   	pop    %ebx
+  44:	5e                   	pop    %esi
+  45:	5f                   	pop    %edi
+  46:	5d                   	pop    %ebp
+  47:	c3                   	ret
+
+00000048 <matchhere>:
+{
+  48:	55                   	push   %ebp
+  49:	89 e5                	mov    %esp,%ebp
+  4b:	83 ec 08             	sub    $0x8,%esp
+  4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(re[0] == '\0')
+  51:	0f b6 02             	movzbl (%edx),%eax
+  54:	84 c0                	test   %al,%al
+  56:	74 68                	je     c0 <matchhere+0x78>
+  if(re[1] == '*')
+  58:	0f b6 4a 01          	movzbl 0x1(%edx),%ecx
+  5c:	80 f9 2a             	cmp    $0x2a,%cl
+  5f:	74 1d                	je     7e <matchhere+0x36>
+  if(re[0] == '$' && re[1] == '\0')
+  61:	3c 24                	cmp    $0x24,%al
+  63:	74 31                	je     96 <matchhere+0x4e>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  68:	0f b6 09             	movzbl (%ecx),%ecx
+  6b:	84 c9                	test   %cl,%cl
+  6d:	74 58                	je     c7 <matchhere+0x7f>
+  6f:	3c 2e                	cmp    $0x2e,%al
+  71:	74 35                	je     a8 <matchhere+0x60>
+  73:	38 c8                	cmp    %cl,%al
+  75:	74 31                	je     a8 <matchhere+0x60>
+  return 0;
+  77:	b8 00 00 00 00       	mov    $0x0,%eax
+  7c:	eb 47                	jmp    c5 <matchhere+0x7d>
+    return matchstar(re[0], re+2, text);
+  7e:	83 ec 04             	sub    $0x4,%esp
+  81:	ff 75 0c             	push   0xc(%ebp)
+  84:	83 c2 02             	add    $0x2,%edx
+  87:	52                   	push   %edx
+  88:	0f be c0             	movsbl %al,%eax
+  8b:	50                   	push   %eax
+  8c:	e8 6f ff ff ff       	call   0 <matchstar>
+  91:	83 c4 10             	add    $0x10,%esp
+  94:	eb 2f                	jmp    c5 <matchhere+0x7d>
+  if(re[0] == '$' && re[1] == '\0')
+  96:	84 c9                	test   %cl,%cl
+  98:	75 cb                	jne    65 <matchhere+0x1d>
+    return *text == '\0';
+  9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9d:	80 38 00             	cmpb   $0x0,(%eax)
+  a0:	0f 94 c0             	sete   %al
+  a3:	0f b6 c0             	movzbl %al,%eax
+  a6:	eb 1d                	jmp    c5 <matchhere+0x7d>
+    return matchhere(re+1, text+1);
+  a8:	83 ec 08             	sub    $0x8,%esp
+  ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ae:	83 c0 01             	add    $0x1,%eax
+  b1:	50                   	push   %eax
+  b2:	83 c2 01             	add    $0x1,%edx
+  b5:	52                   	push   %edx
+  b6:	e8 8d ff ff ff       	call   48 <matchhere>
+  bb:	83 c4 10             	add    $0x10,%esp
+  be:	eb 05                	jmp    c5 <matchhere+0x7d>
+    return 1;
+  c0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  c5:	c9                   	leave
+  c6:	c3                   	ret
+  return 0;
+  c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  cc:	eb f7                	jmp    c5 <matchhere+0x7d>
+
+000000ce <match>:
+{
+  ce:	55                   	push   %ebp
+  cf:	89 e5                	mov    %esp,%ebp
+  d1:	56                   	push   %esi
+  d2:	53                   	push   %ebx
+  d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '^')
+  d9:	80 3e 5e             	cmpb   $0x5e,(%esi)
+  dc:	75 14                	jne    f2 <match+0x24>
+    return matchhere(re+1, text);
+  de:	83 ec 08             	sub    $0x8,%esp
+  e1:	53                   	push   %ebx
+  e2:	83 c6 01             	add    $0x1,%esi
+  e5:	56                   	push   %esi
+  e6:	e8 5d ff ff ff       	call   48 <matchhere>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	eb 22                	jmp    112 <match+0x44>
+  }while(*text++ != '\0');
+  f0:	89 d3                	mov    %edx,%ebx
+    if(matchhere(re, text))
+  f2:	83 ec 08             	sub    $0x8,%esp
+  f5:	53                   	push   %ebx
+  f6:	56                   	push   %esi
+  f7:	e8 4c ff ff ff       	call   48 <matchhere>
+  fc:	83 c4 10             	add    $0x10,%esp
+  ff:	85 c0                	test   %eax,%eax
+ 101:	75 0a                	jne    10d <match+0x3f>
+  }while(*text++ != '\0');
+ 103:	8d 53 01             	lea    0x1(%ebx),%edx
+ 106:	80 3b 00             	cmpb   $0x0,(%ebx)
+ 109:	75 e5                	jne    f0 <match+0x22>
+ 10b:	eb 05                	jmp    112 <match+0x44>
+      return 1;
+ 10d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 112:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 115:	5b                   	pop    %ebx
+ 116:	5e                   	pop    %esi
+ 117:	5d                   	pop    %ebp
+ 118:	c3                   	ret
+
+00000119 <grep>:
+{
+ 119:	55                   	push   %ebp
+ 11a:	89 e5                	mov    %esp,%ebp
+ 11c:	57                   	push   %edi
+ 11d:	56                   	push   %esi
+ 11e:	53                   	push   %ebx
+ 11f:	83 ec 1c             	sub    $0x1c,%esp
+ 122:	8b 7d 08             	mov    0x8(%ebp),%edi
+  m = 0;
+ 125:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 12c:	eb 52                	jmp    180 <grep+0x67>
+      p = q+1;
+ 12e:	8d 73 01             	lea    0x1(%ebx),%esi
+    while((q = strchr(p, '\n')) != 0){
+ 131:	83 ec 08             	sub    $0x8,%esp
+ 134:	6a 0a                	push   $0xa
+ 136:	56                   	push   %esi
+ 137:	e8 e3 01 00 00       	call   31f <strchr>
+ 13c:	89 c3                	mov    %eax,%ebx
+ 13e:	83 c4 10             	add    $0x10,%esp
+ 141:	85 c0                	test   %eax,%eax
+ 143:	74 2d                	je     172 <grep+0x59>
+      *q = 0;
+ 145:	c6 03 00             	movb   $0x0,(%ebx)
+      if(match(pattern, p)){
+ 148:	83 ec 08             	sub    $0x8,%esp
+ 14b:	56                   	push   %esi
+ 14c:	57                   	push   %edi
+ 14d:	e8 7c ff ff ff       	call   ce <match>
+ 152:	83 c4 10             	add    $0x10,%esp
+ 155:	85 c0                	test   %eax,%eax
+ 157:	74 d5                	je     12e <grep+0x15>
+        *q = '\n';
+ 159:	c6 03 0a             	movb   $0xa,(%ebx)
+        write(1, p, q+1 - p);
+ 15c:	8d 43 01             	lea    0x1(%ebx),%eax
+ 15f:	83 ec 04             	sub    $0x4,%esp
+ 162:	29 f0                	sub    %esi,%eax
+ 164:	50                   	push   %eax
+ 165:	56                   	push   %esi
+ 166:	6a 01                	push   $0x1
+ 168:	e8 b9 03 00 00       	call   526 <write>
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	eb bc                	jmp    12e <grep+0x15>
+    if(p == buf)
+ 172:	81 fe a0 0d 00 00    	cmp    $0xda0,%esi
+ 178:	74 41                	je     1bb <grep+0xa2>
+    if(m > 0){
+ 17a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 17e:	7f 44                	jg     1c4 <grep+0xab>
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 180:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 185:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 188:	29 c8                	sub    %ecx,%eax
+ 18a:	83 ec 04             	sub    $0x4,%esp
+ 18d:	50                   	push   %eax
+ 18e:	8d 81 a0 0d 00 00    	lea    0xda0(%ecx),%eax
+ 194:	50                   	push   %eax
+ 195:	ff 75 0c             	push   0xc(%ebp)
+ 198:	e8 81 03 00 00       	call   51e <read>
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 41                	jle    1e5 <grep+0xcc>
+    m += n;
+ 1a4:	01 45 e4             	add    %eax,-0x1c(%ebp)
+ 1a7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    buf[m] = '\0';
+ 1aa:	c6 82 a0 0d 00 00 00 	movb   $0x0,0xda0(%edx)
+    p = buf;
+ 1b1:	be a0 0d 00 00       	mov    $0xda0,%esi
+    while((q = strchr(p, '\n')) != 0){
+ 1b6:	e9 76 ff ff ff       	jmp    131 <grep+0x18>
+      m = 0;
+ 1bb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 1c2:	eb b6                	jmp    17a <grep+0x61>
+      m -= p - buf;
+ 1c4:	89 f0                	mov    %esi,%eax
+ 1c6:	2d a0 0d 00 00       	sub    $0xda0,%eax
+ 1cb:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+ 1ce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+      memmove(buf, p, m);
+ 1d1:	83 ec 04             	sub    $0x4,%esp
+ 1d4:	51                   	push   %ecx
+ 1d5:	56                   	push   %esi
+ 1d6:	68 a0 0d 00 00       	push   $0xda0
+ 1db:	e8 f2 02 00 00       	call   4d2 <memmove>
+ 1e0:	83 c4 10             	add    $0x10,%esp
+ 1e3:	eb 9b                	jmp    180 <grep+0x67>
+}
+ 1e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1e8:	5b                   	pop    %ebx
+ 1e9:	5e                   	pop    %esi
+ 1ea:	5f                   	pop    %edi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+
+000001ed <main>:
+{
+ 1ed:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 1f1:	83 e4 f0             	and    $0xfffffff0,%esp
+ 1f4:	ff 71 fc             	push   -0x4(%ecx)
+ 1f7:	55                   	push   %ebp
+ 1f8:	89 e5                	mov    %esp,%ebp
+ 1fa:	57                   	push   %edi
+ 1fb:	56                   	push   %esi
+ 1fc:	53                   	push   %ebx
+ 1fd:	51                   	push   %ecx
+ 1fe:	83 ec 18             	sub    $0x18,%esp
+ 201:	8b 01                	mov    (%ecx),%eax
+ 203:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 206:	8b 51 04             	mov    0x4(%ecx),%edx
+ 209:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  if(argc <= 1){
+ 20c:	83 f8 01             	cmp    $0x1,%eax
+ 20f:	7e 52                	jle    263 <main+0x76>
+  pattern = argv[1];
+ 211:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 214:	8b 40 04             	mov    0x4(%eax),%eax
+ 217:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(argc <= 2){
+ 21a:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+ 21e:	7e 57                	jle    277 <main+0x8a>
+  for(i = 2; i < argc; i++){
+ 220:	be 02 00 00 00       	mov    $0x2,%esi
+ 225:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 228:	39 c6                	cmp    %eax,%esi
+ 22a:	7d 71                	jge    29d <main+0xb0>
+    if((fd = open(argv[i], 0)) < 0){
+ 22c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 22f:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+ 232:	83 ec 08             	sub    $0x8,%esp
+ 235:	6a 00                	push   $0x0
+ 237:	ff 37                	push   (%edi)
+ 239:	e8 08 03 00 00       	call   546 <open>
+ 23e:	89 c3                	mov    %eax,%ebx
+ 240:	83 c4 10             	add    $0x10,%esp
+ 243:	85 c0                	test   %eax,%eax
+ 245:	78 40                	js     287 <main+0x9a>
+    grep(pattern, fd);
+ 247:	83 ec 08             	sub    $0x8,%esp
+ 24a:	50                   	push   %eax
+ 24b:	ff 75 dc             	push   -0x24(%ebp)
+ 24e:	e8 c6 fe ff ff       	call   119 <grep>
+    close(fd);
+ 253:	89 1c 24             	mov    %ebx,(%esp)
+ 256:	e8 d3 02 00 00       	call   52e <close>
+  for(i = 2; i < argc; i++){
+ 25b:	83 c6 01             	add    $0x1,%esi
+ 25e:	83 c4 10             	add    $0x10,%esp
+ 261:	eb c2                	jmp    225 <main+0x38>
+    printf(2, "usage: grep pattern [file ...]\n");
+ 263:	83 ec 08             	sub    $0x8,%esp
+ 266:	68 58 09 00 00       	push   $0x958
+ 26b:	6a 02                	push   $0x2
+ 26d:	e8 39 04 00 00       	call   6ab <printf>
+    exit();
+ 272:	e8 8f 02 00 00       	call   506 <exit>
+    grep(pattern, 0);
+ 277:	83 ec 08             	sub    $0x8,%esp
+ 27a:	6a 00                	push   $0x0
+ 27c:	50                   	push   %eax
+ 27d:	e8 97 fe ff ff       	call   119 <grep>
+    exit();
+ 282:	e8 7f 02 00 00       	call   506 <exit>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+ 287:	83 ec 04             	sub    $0x4,%esp
+ 28a:	ff 37                	push   (%edi)
+ 28c:	68 78 09 00 00       	push   $0x978
+ 291:	6a 01                	push   $0x1
+ 293:	e8 13 04 00 00       	call   6ab <printf>
+      exit();
+ 298:	e8 69 02 00 00       	call   506 <exit>
+  exit();
+ 29d:	e8 64 02 00 00       	call   506 <exit>
+
+000002a2 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2a2:	55                   	push   %ebp
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	56                   	push   %esi
+ 2a6:	53                   	push   %ebx
+ 2a7:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2ad:	89 f0                	mov    %esi,%eax
+ 2af:	89 d1                	mov    %edx,%ecx
+ 2b1:	83 c2 01             	add    $0x1,%edx
+ 2b4:	89 c3                	mov    %eax,%ebx
+ 2b6:	83 c0 01             	add    $0x1,%eax
+ 2b9:	0f b6 09             	movzbl (%ecx),%ecx
+ 2bc:	88 0b                	mov    %cl,(%ebx)
+ 2be:	84 c9                	test   %cl,%cl
+ 2c0:	75 ed                	jne    2af <strcpy+0xd>
+    ;
+  return os;
+}
+ 2c2:	89 f0                	mov    %esi,%eax
+ 2c4:	5b                   	pop    %ebx
+ 2c5:	5e                   	pop    %esi
+ 2c6:	5d                   	pop    %ebp
+ 2c7:	c3                   	ret
+
+000002c8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2c8:	55                   	push   %ebp
+ 2c9:	89 e5                	mov    %esp,%ebp
+ 2cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 2d1:	eb 06                	jmp    2d9 <strcmp+0x11>
+    p++, q++;
+ 2d3:	83 c1 01             	add    $0x1,%ecx
+ 2d6:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 2d9:	0f b6 01             	movzbl (%ecx),%eax
+ 2dc:	84 c0                	test   %al,%al
+ 2de:	74 04                	je     2e4 <strcmp+0x1c>
+ 2e0:	3a 02                	cmp    (%edx),%al
+ 2e2:	74 ef                	je     2d3 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 2e4:	0f b6 c0             	movzbl %al,%eax
+ 2e7:	0f b6 12             	movzbl (%edx),%edx
+ 2ea:	29 d0                	sub    %edx,%eax
+}
+ 2ec:	5d                   	pop    %ebp
+ 2ed:	c3                   	ret
+
+000002ee <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2ee:	55                   	push   %ebp
+ 2ef:	89 e5                	mov    %esp,%ebp
+ 2f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2f4:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2f9:	eb 03                	jmp    2fe <strlen+0x10>
+ 2fb:	83 c0 01             	add    $0x1,%eax
+ 2fe:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 302:	75 f7                	jne    2fb <strlen+0xd>
+    ;
+  return n;
+}
+ 304:	5d                   	pop    %ebp
+ 305:	c3                   	ret
+
+00000306 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 306:	55                   	push   %ebp
+ 307:	89 e5                	mov    %esp,%ebp
+ 309:	57                   	push   %edi
+ 30a:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 30d:	89 d7                	mov    %edx,%edi
+ 30f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 312:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 315:	fc                   	cld
+ 316:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 318:	89 d0                	mov    %edx,%eax
+ 31a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 31d:	c9                   	leave
+ 31e:	c3                   	ret
+
+0000031f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 31f:	55                   	push   %ebp
+ 320:	89 e5                	mov    %esp,%ebp
+ 322:	8b 45 08             	mov    0x8(%ebp),%eax
+ 325:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 329:	eb 03                	jmp    32e <strchr+0xf>
+ 32b:	83 c0 01             	add    $0x1,%eax
+ 32e:	0f b6 10             	movzbl (%eax),%edx
+ 331:	84 d2                	test   %dl,%dl
+ 333:	74 06                	je     33b <strchr+0x1c>
+    if(*s == c)
+ 335:	38 ca                	cmp    %cl,%dl
+ 337:	75 f2                	jne    32b <strchr+0xc>
+ 339:	eb 05                	jmp    340 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 33b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 340:	5d                   	pop    %ebp
+ 341:	c3                   	ret
+
+00000342 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 342:	55                   	push   %ebp
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	57                   	push   %edi
+ 346:	56                   	push   %esi
+ 347:	53                   	push   %ebx
+ 348:	83 ec 1c             	sub    $0x1c,%esp
+ 34b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 34e:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 353:	89 de                	mov    %ebx,%esi
+ 355:	83 c3 01             	add    $0x1,%ebx
+ 358:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 35b:	7d 2e                	jge    38b <gets+0x49>
+    cc = read(0, &c, 1);
+ 35d:	83 ec 04             	sub    $0x4,%esp
+ 360:	6a 01                	push   $0x1
+ 362:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 365:	50                   	push   %eax
+ 366:	6a 00                	push   $0x0
+ 368:	e8 b1 01 00 00       	call   51e <read>
+    if(cc < 1)
+ 36d:	83 c4 10             	add    $0x10,%esp
+ 370:	85 c0                	test   %eax,%eax
+ 372:	7e 17                	jle    38b <gets+0x49>
+      break;
+    buf[i++] = c;
+ 374:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 378:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 37b:	3c 0a                	cmp    $0xa,%al
+ 37d:	0f 94 c2             	sete   %dl
+ 380:	3c 0d                	cmp    $0xd,%al
+ 382:	0f 94 c0             	sete   %al
+ 385:	08 c2                	or     %al,%dl
+ 387:	74 ca                	je     353 <gets+0x11>
+    buf[i++] = c;
+ 389:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 38b:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 38f:	89 f8                	mov    %edi,%eax
+ 391:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 394:	5b                   	pop    %ebx
+ 395:	5e                   	pop    %esi
+ 396:	5f                   	pop    %edi
+ 397:	5d                   	pop    %ebp
+ 398:	c3                   	ret
+
+00000399 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 399:	55                   	push   %ebp
+ 39a:	89 e5                	mov    %esp,%ebp
+ 39c:	56                   	push   %esi
+ 39d:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 39e:	83 ec 08             	sub    $0x8,%esp
+ 3a1:	6a 00                	push   $0x0
+ 3a3:	ff 75 08             	push   0x8(%ebp)
+ 3a6:	e8 9b 01 00 00       	call   546 <open>
+  if(fd < 0)
+ 3ab:	83 c4 10             	add    $0x10,%esp
+ 3ae:	85 c0                	test   %eax,%eax
+ 3b0:	78 24                	js     3d6 <stat+0x3d>
+ 3b2:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 3b4:	83 ec 08             	sub    $0x8,%esp
+ 3b7:	ff 75 0c             	push   0xc(%ebp)
+ 3ba:	50                   	push   %eax
+ 3bb:	e8 9e 01 00 00       	call   55e <fstat>
+ 3c0:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3c2:	89 1c 24             	mov    %ebx,(%esp)
+ 3c5:	e8 64 01 00 00       	call   52e <close>
+  return r;
+ 3ca:	83 c4 10             	add    $0x10,%esp
+}
+ 3cd:	89 f0                	mov    %esi,%eax
+ 3cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d2:	5b                   	pop    %ebx
+ 3d3:	5e                   	pop    %esi
+ 3d4:	5d                   	pop    %ebp
+ 3d5:	c3                   	ret
+    return -1;
+ 3d6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3db:	eb f0                	jmp    3cd <stat+0x34>
+
+000003dd <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 3dd:	55                   	push   %ebp
+ 3de:	89 e5                	mov    %esp,%ebp
+ 3e0:	56                   	push   %esi
+ 3e1:	53                   	push   %ebx
+ 3e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 3e5:	eb 03                	jmp    3ea <atoi+0xd>
+ 3e7:	83 c2 01             	add    $0x1,%edx
+ 3ea:	0f b6 02             	movzbl (%edx),%eax
+ 3ed:	3c 20                	cmp    $0x20,%al
+ 3ef:	74 f6                	je     3e7 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 3f1:	3c 2d                	cmp    $0x2d,%al
+ 3f3:	74 1d                	je     412 <atoi+0x35>
+ 3f5:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 3fa:	3c 2b                	cmp    $0x2b,%al
+ 3fc:	0f 94 c1             	sete   %cl
+ 3ff:	3c 2d                	cmp    $0x2d,%al
+ 401:	0f 94 c0             	sete   %al
+ 404:	08 c1                	or     %al,%cl
+ 406:	74 03                	je     40b <atoi+0x2e>
+    s++;
+ 408:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 40b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 410:	eb 17                	jmp    429 <atoi+0x4c>
+ 412:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 417:	eb e1                	jmp    3fa <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 419:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 41c:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 41f:	83 c2 01             	add    $0x1,%edx
+ 422:	0f be c9             	movsbl %cl,%ecx
+ 425:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 429:	0f b6 0a             	movzbl (%edx),%ecx
+ 42c:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 42f:	80 fb 09             	cmp    $0x9,%bl
+ 432:	76 e5                	jbe    419 <atoi+0x3c>
+  return sign*n;
+ 434:	0f af c6             	imul   %esi,%eax
+}
+ 437:	5b                   	pop    %ebx
+ 438:	5e                   	pop    %esi
+ 439:	5d                   	pop    %ebp
+ 43a:	c3                   	ret
+
+0000043b <atoo>:
+
+int
+atoo(const char *s)
+{
+ 43b:	55                   	push   %ebp
+ 43c:	89 e5                	mov    %esp,%ebp
+ 43e:	56                   	push   %esi
+ 43f:	53                   	push   %ebx
+ 440:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 443:	eb 03                	jmp    448 <atoo+0xd>
+ 445:	83 c2 01             	add    $0x1,%edx
+ 448:	0f b6 02             	movzbl (%edx),%eax
+ 44b:	3c 20                	cmp    $0x20,%al
+ 44d:	74 f6                	je     445 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 44f:	3c 2d                	cmp    $0x2d,%al
+ 451:	74 1d                	je     470 <atoo+0x35>
+ 453:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 458:	3c 2b                	cmp    $0x2b,%al
+ 45a:	0f 94 c1             	sete   %cl
+ 45d:	3c 2d                	cmp    $0x2d,%al
+ 45f:	0f 94 c0             	sete   %al
+ 462:	08 c1                	or     %al,%cl
+ 464:	74 03                	je     469 <atoo+0x2e>
+    s++;
+ 466:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 469:	b8 00 00 00 00       	mov    $0x0,%eax
+ 46e:	eb 11                	jmp    481 <atoo+0x46>
+ 470:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 475:	eb e1                	jmp    458 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 477:	83 c2 01             	add    $0x1,%edx
+ 47a:	0f be c9             	movsbl %cl,%ecx
+ 47d:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 481:	0f b6 0a             	movzbl (%edx),%ecx
+ 484:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 487:	80 fb 07             	cmp    $0x7,%bl
+ 48a:	76 eb                	jbe    477 <atoo+0x3c>
+  return sign*n;
+ 48c:	0f af c6             	imul   %esi,%eax
+}
+ 48f:	5b                   	pop    %ebx
+ 490:	5e                   	pop    %esi
+ 491:	5d                   	pop    %ebp
+ 492:	c3                   	ret
+
+00000493 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 493:	55                   	push   %ebp
+ 494:	89 e5                	mov    %esp,%ebp
+ 496:	53                   	push   %ebx
+ 497:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 49d:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 4a0:	eb 09                	jmp    4ab <strncmp+0x18>
+      n--, p++, q++;
+ 4a2:	83 e8 01             	sub    $0x1,%eax
+ 4a5:	83 c2 01             	add    $0x1,%edx
+ 4a8:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 4ab:	85 c0                	test   %eax,%eax
+ 4ad:	74 0b                	je     4ba <strncmp+0x27>
+ 4af:	0f b6 1a             	movzbl (%edx),%ebx
+ 4b2:	84 db                	test   %bl,%bl
+ 4b4:	74 04                	je     4ba <strncmp+0x27>
+ 4b6:	3a 19                	cmp    (%ecx),%bl
+ 4b8:	74 e8                	je     4a2 <strncmp+0xf>
+    if(n == 0)
+ 4ba:	85 c0                	test   %eax,%eax
+ 4bc:	74 0d                	je     4cb <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 4be:	0f b6 02             	movzbl (%edx),%eax
+ 4c1:	0f b6 11             	movzbl (%ecx),%edx
+ 4c4:	29 d0                	sub    %edx,%eax
+}
+ 4c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4c9:	c9                   	leave
+ 4ca:	c3                   	ret
+      return 0;
+ 4cb:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4d0:	eb f4                	jmp    4c6 <strncmp+0x33>
+
+000004d2 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4d2:	55                   	push   %ebp
+ 4d3:	89 e5                	mov    %esp,%ebp
+ 4d5:	56                   	push   %esi
+ 4d6:	53                   	push   %ebx
+ 4d7:	8b 75 08             	mov    0x8(%ebp),%esi
+ 4da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 4dd:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 4e0:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 4e2:	eb 0d                	jmp    4f1 <memmove+0x1f>
+    *dst++ = *src++;
+ 4e4:	0f b6 01             	movzbl (%ecx),%eax
+ 4e7:	88 02                	mov    %al,(%edx)
+ 4e9:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 4ec:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 4ef:	89 d8                	mov    %ebx,%eax
+ 4f1:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 4f4:	85 c0                	test   %eax,%eax
+ 4f6:	7f ec                	jg     4e4 <memmove+0x12>
+  return vdst;
+}
+ 4f8:	89 f0                	mov    %esi,%eax
+ 4fa:	5b                   	pop    %ebx
+ 4fb:	5e                   	pop    %esi
+ 4fc:	5d                   	pop    %ebp
+ 4fd:	c3                   	ret
+
+000004fe <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4fe:	b8 01 00 00 00       	mov    $0x1,%eax
+ 503:	cd 40                	int    $0x40
+ 505:	c3                   	ret
+
+00000506 <exit>:
+SYSCALL(exit)
+ 506:	b8 02 00 00 00       	mov    $0x2,%eax
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <wait>:
+SYSCALL(wait)
+ 50e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <pipe>:
+SYSCALL(pipe)
+ 516:	b8 04 00 00 00       	mov    $0x4,%eax
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <read>:
+SYSCALL(read)
+ 51e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <write>:
+SYSCALL(write)
+ 526:	b8 10 00 00 00       	mov    $0x10,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <close>:
+SYSCALL(close)
+ 52e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <kill>:
+SYSCALL(kill)
+ 536:	b8 06 00 00 00       	mov    $0x6,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <exec>:
+SYSCALL(exec)
+ 53e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <open>:
+SYSCALL(open)
+ 546:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <mknod>:
+SYSCALL(mknod)
+ 54e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <unlink>:
+SYSCALL(unlink)
+ 556:	b8 12 00 00 00       	mov    $0x12,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <fstat>:
+SYSCALL(fstat)
+ 55e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <link>:
+SYSCALL(link)
+ 566:	b8 13 00 00 00       	mov    $0x13,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <mkdir>:
+SYSCALL(mkdir)
+ 56e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <chdir>:
+SYSCALL(chdir)
+ 576:	b8 09 00 00 00       	mov    $0x9,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <dup>:
+SYSCALL(dup)
+ 57e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <getpid>:
+SYSCALL(getpid)
+ 586:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <sbrk>:
+SYSCALL(sbrk)
+ 58e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <sleep>:
+SYSCALL(sleep)
+ 596:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 59b:	cd 40                	int    $0x40
+ 59d:	c3                   	ret
+
+0000059e <uptime>:
+SYSCALL(uptime)
+ 59e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5a3:	cd 40                	int    $0x40
+ 5a5:	c3                   	ret
+
+000005a6 <halt>:
+SYSCALL(halt)
+ 5a6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5ab:	cd 40                	int    $0x40
+ 5ad:	c3                   	ret
+
+000005ae <date>:
+SYSCALL(date)
+ 5ae:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5b3:	cd 40                	int    $0x40
+ 5b5:	c3                   	ret
+
+000005b6 <getuid>:
+SYSCALL(getuid)
+ 5b6:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5bb:	cd 40                	int    $0x40
+ 5bd:	c3                   	ret
+
+000005be <getgid>:
+SYSCALL(getgid)
+ 5be:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5c3:	cd 40                	int    $0x40
+ 5c5:	c3                   	ret
+
+000005c6 <getppid>:
+SYSCALL(getppid)
+ 5c6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5cb:	cd 40                	int    $0x40
+ 5cd:	c3                   	ret
+
+000005ce <setuid>:
+SYSCALL(setuid)
+ 5ce:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5d3:	cd 40                	int    $0x40
+ 5d5:	c3                   	ret
+
+000005d6 <setgid>:
+SYSCALL(setgid)
+ 5d6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5db:	cd 40                	int    $0x40
+ 5dd:	c3                   	ret
+
+000005de <getprocs>:
+SYSCALL(getprocs)
+ 5de:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5e3:	cd 40                	int    $0x40
+ 5e5:	c3                   	ret
+
+000005e6 <getpriority>:
+SYSCALL(getpriority)
+ 5e6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5eb:	cd 40                	int    $0x40
+ 5ed:	c3                   	ret
+
+000005ee <setpriority>:
+SYSCALL(setpriority)
+ 5ee:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5f3:	cd 40                	int    $0x40
+ 5f5:	c3                   	ret
+
+000005f6 <pipesize>:
+SYSCALL(pipesize)
+ 5f6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5fb:	cd 40                	int    $0x40
+ 5fd:	c3                   	ret
+
+000005fe <splice>:
+SYSCALL(splice)
+ 5fe:	b8 21 00 00 00       	mov    $0x21,%eax
+ 603:	cd 40                	int    $0x40
+ 605:	c3                   	ret
+
+00000606 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 606:	55                   	push   %ebp
+ 607:	89 e5                	mov    %esp,%ebp
+ 609:	83 ec 1c             	sub    $0x1c,%esp
+ 60c:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 60f:	6a 01                	push   $0x1
+ 611:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 614:	52                   	push   %edx
+ 615:	50                   	push   %eax
+ 616:	e8 0b ff ff ff       	call   526 <write>
+}
+ 61b:	83 c4 10             	add    $0x10,%esp
+ 61e:	c9                   	leave
+ 61f:	c3                   	ret
+
+00000620 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	83 ec 2c             	sub    $0x2c,%esp
+ 629:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 62c:	89 d0                	mov    %edx,%eax
+ 62e:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 630:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 634:	0f 95 c1             	setne  %cl
+ 637:	c1 ea 1f             	shr    $0x1f,%edx
+ 63a:	84 d1                	test   %dl,%cl
+ 63c:	74 44                	je     682 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 63e:	f7 d8                	neg    %eax
+ 640:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 642:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 649:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 64e:	89 c8                	mov    %ecx,%eax
+ 650:	ba 00 00 00 00       	mov    $0x0,%edx
+ 655:	f7 f6                	div    %esi
+ 657:	89 df                	mov    %ebx,%edi
+ 659:	83 c3 01             	add    $0x1,%ebx
+ 65c:	0f b6 92 f0 09 00 00 	movzbl 0x9f0(%edx),%edx
+ 663:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 667:	89 ca                	mov    %ecx,%edx
+ 669:	89 c1                	mov    %eax,%ecx
+ 66b:	39 f2                	cmp    %esi,%edx
+ 66d:	73 df                	jae    64e <printint+0x2e>
+  if(neg)
+ 66f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 673:	74 31                	je     6a6 <printint+0x86>
+    buf[i++] = '-';
+ 675:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 67a:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 67d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 680:	eb 17                	jmp    699 <printint+0x79>
+    x = xx;
+ 682:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 684:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 68b:	eb bc                	jmp    649 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 68d:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 692:	89 f0                	mov    %esi,%eax
+ 694:	e8 6d ff ff ff       	call   606 <putc>
+  while(--i >= 0)
+ 699:	83 eb 01             	sub    $0x1,%ebx
+ 69c:	79 ef                	jns    68d <printint+0x6d>
+}
+ 69e:	83 c4 2c             	add    $0x2c,%esp
+ 6a1:	5b                   	pop    %ebx
+ 6a2:	5e                   	pop    %esi
+ 6a3:	5f                   	pop    %edi
+ 6a4:	5d                   	pop    %ebp
+ 6a5:	c3                   	ret
+ 6a6:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 6a9:	eb ee                	jmp    699 <printint+0x79>
+
+000006ab <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6ab:	55                   	push   %ebp
+ 6ac:	89 e5                	mov    %esp,%ebp
+ 6ae:	57                   	push   %edi
+ 6af:	56                   	push   %esi
+ 6b0:	53                   	push   %ebx
+ 6b1:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 6b4:	8d 45 10             	lea    0x10(%ebp),%eax
+ 6b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 6ba:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 6bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 6c4:	eb 14                	jmp    6da <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 6c6:	89 fa                	mov    %edi,%edx
+ 6c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cb:	e8 36 ff ff ff       	call   606 <putc>
+ 6d0:	eb 05                	jmp    6d7 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 6d2:	83 fe 25             	cmp    $0x25,%esi
+ 6d5:	74 25                	je     6fc <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 6d7:	83 c3 01             	add    $0x1,%ebx
+ 6da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6dd:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 6e1:	84 c0                	test   %al,%al
+ 6e3:	0f 84 20 01 00 00    	je     809 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 6e9:	0f be f8             	movsbl %al,%edi
+ 6ec:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 6ef:	85 f6                	test   %esi,%esi
+ 6f1:	75 df                	jne    6d2 <printf+0x27>
+      if(c == '%'){
+ 6f3:	83 f8 25             	cmp    $0x25,%eax
+ 6f6:	75 ce                	jne    6c6 <printf+0x1b>
+        state = '%';
+ 6f8:	89 c6                	mov    %eax,%esi
+ 6fa:	eb db                	jmp    6d7 <printf+0x2c>
+      if(c == 'd'){
+ 6fc:	83 f8 25             	cmp    $0x25,%eax
+ 6ff:	0f 84 cf 00 00 00    	je     7d4 <printf+0x129>
+ 705:	0f 8c dd 00 00 00    	jl     7e8 <printf+0x13d>
+ 70b:	83 f8 78             	cmp    $0x78,%eax
+ 70e:	0f 8f d4 00 00 00    	jg     7e8 <printf+0x13d>
+ 714:	83 f8 63             	cmp    $0x63,%eax
+ 717:	0f 8c cb 00 00 00    	jl     7e8 <printf+0x13d>
+ 71d:	83 e8 63             	sub    $0x63,%eax
+ 720:	83 f8 15             	cmp    $0x15,%eax
+ 723:	0f 87 bf 00 00 00    	ja     7e8 <printf+0x13d>
+ 729:	ff 24 85 98 09 00 00 	jmp    *0x998(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 730:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 733:	8b 17                	mov    (%edi),%edx
+ 735:	83 ec 0c             	sub    $0xc,%esp
+ 738:	6a 01                	push   $0x1
+ 73a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 73f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 742:	e8 d9 fe ff ff       	call   620 <printint>
+        ap++;
+ 747:	83 c7 04             	add    $0x4,%edi
+ 74a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 74d:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 750:	be 00 00 00 00       	mov    $0x0,%esi
+ 755:	eb 80                	jmp    6d7 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 757:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 75a:	8b 17                	mov    (%edi),%edx
+ 75c:	83 ec 0c             	sub    $0xc,%esp
+ 75f:	6a 00                	push   $0x0
+ 761:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 766:	8b 45 08             	mov    0x8(%ebp),%eax
+ 769:	e8 b2 fe ff ff       	call   620 <printint>
+        ap++;
+ 76e:	83 c7 04             	add    $0x4,%edi
+ 771:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 774:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 777:	be 00 00 00 00       	mov    $0x0,%esi
+ 77c:	e9 56 ff ff ff       	jmp    6d7 <printf+0x2c>
+        s = (char*)*ap;
+ 781:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 784:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 786:	83 c0 04             	add    $0x4,%eax
+ 789:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 78c:	85 f6                	test   %esi,%esi
+ 78e:	75 15                	jne    7a5 <printf+0xfa>
+          s = "(null)";
+ 790:	be 8e 09 00 00       	mov    $0x98e,%esi
+ 795:	eb 0e                	jmp    7a5 <printf+0xfa>
+          putc(fd, *s);
+ 797:	0f be d2             	movsbl %dl,%edx
+ 79a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79d:	e8 64 fe ff ff       	call   606 <putc>
+          s++;
+ 7a2:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 7a5:	0f b6 16             	movzbl (%esi),%edx
+ 7a8:	84 d2                	test   %dl,%dl
+ 7aa:	75 eb                	jne    797 <printf+0xec>
+      state = 0;
+ 7ac:	be 00 00 00 00       	mov    $0x0,%esi
+ 7b1:	e9 21 ff ff ff       	jmp    6d7 <printf+0x2c>
+        putc(fd, *ap);
+ 7b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 7b9:	0f be 17             	movsbl (%edi),%edx
+ 7bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7bf:	e8 42 fe ff ff       	call   606 <putc>
+        ap++;
+ 7c4:	83 c7 04             	add    $0x4,%edi
+ 7c7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 7ca:	be 00 00 00 00       	mov    $0x0,%esi
+ 7cf:	e9 03 ff ff ff       	jmp    6d7 <printf+0x2c>
+        putc(fd, c);
+ 7d4:	89 fa                	mov    %edi,%edx
+ 7d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d9:	e8 28 fe ff ff       	call   606 <putc>
+      state = 0;
+ 7de:	be 00 00 00 00       	mov    $0x0,%esi
+ 7e3:	e9 ef fe ff ff       	jmp    6d7 <printf+0x2c>
+        putc(fd, '%');
+ 7e8:	ba 25 00 00 00       	mov    $0x25,%edx
+ 7ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7f0:	e8 11 fe ff ff       	call   606 <putc>
+        putc(fd, c);
+ 7f5:	89 fa                	mov    %edi,%edx
+ 7f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7fa:	e8 07 fe ff ff       	call   606 <putc>
+      state = 0;
+ 7ff:	be 00 00 00 00       	mov    $0x0,%esi
+ 804:	e9 ce fe ff ff       	jmp    6d7 <printf+0x2c>
+    }
+  }
+}
+ 809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 80c:	5b                   	pop    %ebx
+ 80d:	5e                   	pop    %esi
+ 80e:	5f                   	pop    %edi
+ 80f:	5d                   	pop    %ebp
+ 810:	c3                   	ret
+
+00000811 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 811:	55                   	push   %ebp
+ 812:	89 e5                	mov    %esp,%ebp
+ 814:	57                   	push   %edi
+ 815:	56                   	push   %esi
+ 816:	53                   	push   %ebx
+ 817:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 81a:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 81d:	a1 a0 11 00 00       	mov    0x11a0,%eax
+ 822:	eb 02                	jmp    826 <free+0x15>
+ 824:	89 d0                	mov    %edx,%eax
+ 826:	39 c8                	cmp    %ecx,%eax
+ 828:	73 04                	jae    82e <free+0x1d>
+ 82a:	3b 08                	cmp    (%eax),%ecx
+ 82c:	72 12                	jb     840 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 82e:	8b 10                	mov    (%eax),%edx
+ 830:	39 d0                	cmp    %edx,%eax
+ 832:	72 f0                	jb     824 <free+0x13>
+ 834:	39 c8                	cmp    %ecx,%eax
+ 836:	72 08                	jb     840 <free+0x2f>
+ 838:	39 d1                	cmp    %edx,%ecx
+ 83a:	72 04                	jb     840 <free+0x2f>
+ 83c:	89 d0                	mov    %edx,%eax
+ 83e:	eb e6                	jmp    826 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 840:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 843:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 846:	8b 10                	mov    (%eax),%edx
+ 848:	39 d7                	cmp    %edx,%edi
+ 84a:	74 19                	je     865 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 84c:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 84f:	8b 50 04             	mov    0x4(%eax),%edx
+ 852:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 855:	39 ce                	cmp    %ecx,%esi
+ 857:	74 1b                	je     874 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 859:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 85b:	a3 a0 11 00 00       	mov    %eax,0x11a0
+}
+ 860:	5b                   	pop    %ebx
+ 861:	5e                   	pop    %esi
+ 862:	5f                   	pop    %edi
+ 863:	5d                   	pop    %ebp
+ 864:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 865:	03 72 04             	add    0x4(%edx),%esi
+ 868:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 86b:	8b 10                	mov    (%eax),%edx
+ 86d:	8b 12                	mov    (%edx),%edx
+ 86f:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 872:	eb db                	jmp    84f <free+0x3e>
+    p->s.size += bp->s.size;
+ 874:	03 53 fc             	add    -0x4(%ebx),%edx
+ 877:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 87a:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 87d:	89 10                	mov    %edx,(%eax)
+ 87f:	eb da                	jmp    85b <free+0x4a>
+
+00000881 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 881:	55                   	push   %ebp
+ 882:	89 e5                	mov    %esp,%ebp
+ 884:	53                   	push   %ebx
+ 885:	83 ec 04             	sub    $0x4,%esp
+ 888:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 88a:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 88f:	77 05                	ja     896 <morecore+0x15>
+    nu = 4096;
+ 891:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 896:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 89d:	83 ec 0c             	sub    $0xc,%esp
+ 8a0:	50                   	push   %eax
+ 8a1:	e8 e8 fc ff ff       	call   58e <sbrk>
+  if(p == (char*)-1)
+ 8a6:	83 c4 10             	add    $0x10,%esp
+ 8a9:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8ac:	74 1c                	je     8ca <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 8ae:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8b1:	83 c0 08             	add    $0x8,%eax
+ 8b4:	83 ec 0c             	sub    $0xc,%esp
+ 8b7:	50                   	push   %eax
+ 8b8:	e8 54 ff ff ff       	call   811 <free>
+  return freep;
+ 8bd:	a1 a0 11 00 00       	mov    0x11a0,%eax
+ 8c2:	83 c4 10             	add    $0x10,%esp
+}
+ 8c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8c8:	c9                   	leave
+ 8c9:	c3                   	ret
+    return 0;
+ 8ca:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8cf:	eb f4                	jmp    8c5 <morecore+0x44>
+
+000008d1 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8d1:	55                   	push   %ebp
+ 8d2:	89 e5                	mov    %esp,%ebp
+ 8d4:	53                   	push   %ebx
+ 8d5:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8db:	8d 58 07             	lea    0x7(%eax),%ebx
+ 8de:	c1 eb 03             	shr    $0x3,%ebx
+ 8e1:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 8e4:	8b 0d a0 11 00 00    	mov    0x11a0,%ecx
+ 8ea:	85 c9                	test   %ecx,%ecx
+ 8ec:	74 04                	je     8f2 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8ee:	8b 01                	mov    (%ecx),%eax
+ 8f0:	eb 4a                	jmp    93c <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 8f2:	c7 05 a0 11 00 00 a4 	movl   $0x11a4,0x11a0
+ 8f9:	11 00 00 
+ 8fc:	c7 05 a4 11 00 00 a4 	movl   $0x11a4,0x11a4
+ 903:	11 00 00 
+    base.s.size = 0;
+ 906:	c7 05 a8 11 00 00 00 	movl   $0x0,0x11a8
+ 90d:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 910:	b9 a4 11 00 00       	mov    $0x11a4,%ecx
+ 915:	eb d7                	jmp    8ee <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 917:	74 19                	je     932 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 919:	29 da                	sub    %ebx,%edx
+ 91b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 91e:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 921:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 924:	89 0d a0 11 00 00    	mov    %ecx,0x11a0
+      return (void*)(p + 1);
+ 92a:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 92d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 930:	c9                   	leave
+ 931:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 932:	8b 10                	mov    (%eax),%edx
+ 934:	89 11                	mov    %edx,(%ecx)
+ 936:	eb ec                	jmp    924 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 938:	89 c1                	mov    %eax,%ecx
+ 93a:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 93c:	8b 50 04             	mov    0x4(%eax),%edx
+ 93f:	39 da                	cmp    %ebx,%edx
+ 941:	73 d4                	jae    917 <malloc+0x46>
+    if(p == freep)
+ 943:	39 05 a0 11 00 00    	cmp    %eax,0x11a0
+ 949:	75 ed                	jne    938 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 94b:	89 d8                	mov    %ebx,%eax
+ 94d:	e8 2f ff ff ff       	call   881 <morecore>
+ 952:	85 c0                	test   %eax,%eax
+ 954:	75 e2                	jne    938 <malloc+0x67>
+ 956:	eb d5                	jmp    92d <malloc+0x5c>
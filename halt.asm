@@ -0,0 +1,1145 @@
+
+_halt:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// halt the system.
+#include "types.h"
+#include "user.h"
+
+int
+main(void) {
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  halt();
+   6:	e8 09 03 00 00       	call   314 <halt>
+  exit();
+   b:	e8 64 02 00 00       	call   274 <exit>
+
+00000010 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	8b 75 08             	mov    0x8(%ebp),%esi
+  18:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  1b:	89 f0                	mov    %esi,%eax
+  1d:	89 d1                	mov    %edx,%ecx
+  1f:	83 c2 01             	add    $0x1,%edx
+  22:	89 c3                	mov    %eax,%ebx
+  24:	83 c0 01             	add    $0x1,%eax
+  27:	0f b6 09             	movzbl (%ecx),%ecx
+  2a:	88 0b                	mov    %cl,(%ebx)
+  2c:	84 c9                	test   %cl,%cl
+  2e:	75 ed                	jne    1d <strcpy+0xd>
+    ;
+  return os;
+}
+  30:	89 f0                	mov    %esi,%eax
+  32:	5b                   	pop    %ebx
+  33:	5e                   	pop    %esi
+  34:	5d                   	pop    %ebp
+  35:	c3                   	ret
+
+00000036 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  36:	55                   	push   %ebp
+  37:	89 e5                	mov    %esp,%ebp
+  39:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  3f:	eb 06                	jmp    47 <strcmp+0x11>
+    p++, q++;
+  41:	83 c1 01             	add    $0x1,%ecx
+  44:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  47:	0f b6 01             	movzbl (%ecx),%eax
+  4a:	84 c0                	test   %al,%al
+  4c:	74 04                	je     52 <strcmp+0x1c>
+  4e:	3a 02                	cmp    (%edx),%al
+  50:	74 ef                	je     41 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+  52:	0f b6 c0             	movzbl %al,%eax
+  55:	0f b6 12             	movzbl (%edx),%edx
+  58:	29 d0                	sub    %edx,%eax
+}
+  5a:	5d                   	pop    %ebp
+  5b:	c3                   	ret
+
+0000005c <strlen>:
+
+uint
+strlen(char *s)
+{
+  5c:	55                   	push   %ebp
+  5d:	89 e5                	mov    %esp,%ebp
+  5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  62:	b8 00 00 00 00       	mov    $0x0,%eax
+  67:	eb 03                	jmp    6c <strlen+0x10>
+  69:	83 c0 01             	add    $0x1,%eax
+  6c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  70:	75 f7                	jne    69 <strlen+0xd>
+    ;
+  return n;
+}
+  72:	5d                   	pop    %ebp
+  73:	c3                   	ret
+
+00000074 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  74:	55                   	push   %ebp
+  75:	89 e5                	mov    %esp,%ebp
+  77:	57                   	push   %edi
+  78:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  7b:	89 d7                	mov    %edx,%edi
+  7d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80:	8b 45 0c             	mov    0xc(%ebp),%eax
+  83:	fc                   	cld
+  84:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  86:	89 d0                	mov    %edx,%eax
+  88:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8b:	c9                   	leave
+  8c:	c3                   	ret
+
+0000008d <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  8d:	55                   	push   %ebp
+  8e:	89 e5                	mov    %esp,%ebp
+  90:	8b 45 08             	mov    0x8(%ebp),%eax
+  93:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  97:	eb 03                	jmp    9c <strchr+0xf>
+  99:	83 c0 01             	add    $0x1,%eax
+  9c:	0f b6 10             	movzbl (%eax),%edx
+  9f:	84 d2                	test   %dl,%dl
+  a1:	74 06                	je     a9 <strchr+0x1c>
+    if(*s == c)
+  a3:	38 ca                	cmp    %cl,%dl
+  a5:	75 f2                	jne    99 <strchr+0xc>
+  a7:	eb 05                	jmp    ae <strchr+0x21>
+      return (char*)s;
+  return 0;
+  a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  ae:	5d                   	pop    %ebp
+  af:	c3                   	ret
+
+000000b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	57                   	push   %edi
+  b4:	56                   	push   %esi
+  b5:	53                   	push   %ebx
+  b6:	83 ec 1c             	sub    $0x1c,%esp
+  b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  c1:	89 de                	mov    %ebx,%esi
+  c3:	83 c3 01             	add    $0x1,%ebx
+  c6:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+  c9:	7d 2e                	jge    f9 <gets+0x49>
+    cc = read(0, &c, 1);
+  cb:	83 ec 04             	sub    $0x4,%esp
+  ce:	6a 01                	push   $0x1
+  d0:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  d3:	50                   	push   %eax
+  d4:	6a 00                	push   $0x0
+  d6:	e8 b1 01 00 00       	call   28c <read>
+    if(cc < 1)
+  db:	83 c4 10             	add    $0x10,%esp
+  de:	85 c0                	test   %eax,%eax
+  e0:	7e 17                	jle    f9 <gets+0x49>
+      break;
+    buf[i++] = c;
+  e2:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+  e6:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+  e9:	3c 0a                	cmp    $0xa,%al
+  eb:	0f 94 c2             	sete   %dl
+  ee:	3c 0d                	cmp    $0xd,%al
+  f0:	0f 94 c0             	sete   %al
+  f3:	08 c2                	or     %al,%dl
+  f5:	74 ca                	je     c1 <gets+0x11>
+    buf[i++] = c;
+  f7:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+  f9:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+  fd:	89 f8                	mov    %edi,%eax
+  ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 102:	5b                   	pop    %ebx
+ 103:	5e                   	pop    %esi
+ 104:	5f                   	pop    %edi
+ 105:	5d                   	pop    %ebp
+ 106:	c3                   	ret
+
+00000107 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 107:	55                   	push   %ebp
+ 108:	89 e5                	mov    %esp,%ebp
+ 10a:	56                   	push   %esi
+ 10b:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 10c:	83 ec 08             	sub    $0x8,%esp
+ 10f:	6a 00                	push   $0x0
+ 111:	ff 75 08             	push   0x8(%ebp)
+ 114:	e8 9b 01 00 00       	call   2b4 <open>
+  if(fd < 0)
+ 119:	83 c4 10             	add    $0x10,%esp
+ 11c:	85 c0                	test   %eax,%eax
+ 11e:	78 24                	js     144 <stat+0x3d>
+ 120:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	ff 75 0c             	push   0xc(%ebp)
+ 128:	50                   	push   %eax
+ 129:	e8 9e 01 00 00       	call   2cc <fstat>
+ 12e:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 130:	89 1c 24             	mov    %ebx,(%esp)
+ 133:	e8 64 01 00 00       	call   29c <close>
+  return r;
+ 138:	83 c4 10             	add    $0x10,%esp
+}
+ 13b:	89 f0                	mov    %esi,%eax
+ 13d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 140:	5b                   	pop    %ebx
+ 141:	5e                   	pop    %esi
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+    return -1;
+ 144:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 149:	eb f0                	jmp    13b <stat+0x34>
+
+0000014b <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 14b:	55                   	push   %ebp
+ 14c:	89 e5                	mov    %esp,%ebp
+ 14e:	56                   	push   %esi
+ 14f:	53                   	push   %ebx
+ 150:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 153:	eb 03                	jmp    158 <atoi+0xd>
+ 155:	83 c2 01             	add    $0x1,%edx
+ 158:	0f b6 02             	movzbl (%edx),%eax
+ 15b:	3c 20                	cmp    $0x20,%al
+ 15d:	74 f6                	je     155 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 15f:	3c 2d                	cmp    $0x2d,%al
+ 161:	74 1d                	je     180 <atoi+0x35>
+ 163:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 168:	3c 2b                	cmp    $0x2b,%al
+ 16a:	0f 94 c1             	sete   %cl
+ 16d:	3c 2d                	cmp    $0x2d,%al
+ 16f:	0f 94 c0             	sete   %al
+ 172:	08 c1                	or     %al,%cl
+ 174:	74 03                	je     179 <atoi+0x2e>
+    s++;
+ 176:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 179:	b8 00 00 00 00       	mov    $0x0,%eax
+ 17e:	eb 17                	jmp    197 <atoi+0x4c>
+ 180:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 185:	eb e1                	jmp    168 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 187:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 18a:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 18d:	83 c2 01             	add    $0x1,%edx
+ 190:	0f be c9             	movsbl %cl,%ecx
+ 193:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 197:	0f b6 0a             	movzbl (%edx),%ecx
+ 19a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 19d:	80 fb 09             	cmp    $0x9,%bl
+ 1a0:	76 e5                	jbe    187 <atoi+0x3c>
+  return sign*n;
+ 1a2:	0f af c6             	imul   %esi,%eax
+}
+ 1a5:	5b                   	pop    %ebx
+ 1a6:	5e                   	pop    %esi
+ 1a7:	5d                   	pop    %ebp
+ 1a8:	c3                   	ret
+
+000001a9 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 1a9:	55                   	push   %ebp
+ 1aa:	89 e5                	mov    %esp,%ebp
+ 1ac:	56                   	push   %esi
+ 1ad:	53                   	push   %ebx
+ 1ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1b1:	eb 03                	jmp    1b6 <atoo+0xd>
+ 1b3:	83 c2 01             	add    $0x1,%edx
+ 1b6:	0f b6 02             	movzbl (%edx),%eax
+ 1b9:	3c 20                	cmp    $0x20,%al
+ 1bb:	74 f6                	je     1b3 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 1bd:	3c 2d                	cmp    $0x2d,%al
+ 1bf:	74 1d                	je     1de <atoo+0x35>
+ 1c1:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1c6:	3c 2b                	cmp    $0x2b,%al
+ 1c8:	0f 94 c1             	sete   %cl
+ 1cb:	3c 2d                	cmp    $0x2d,%al
+ 1cd:	0f 94 c0             	sete   %al
+ 1d0:	08 c1                	or     %al,%cl
+ 1d2:	74 03                	je     1d7 <atoo+0x2e>
+    s++;
+ 1d4:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 1d7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1dc:	eb 11                	jmp    1ef <atoo+0x46>
+ 1de:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1e3:	eb e1                	jmp    1c6 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 1e5:	83 c2 01             	add    $0x1,%edx
+ 1e8:	0f be c9             	movsbl %cl,%ecx
+ 1eb:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 1ef:	0f b6 0a             	movzbl (%edx),%ecx
+ 1f2:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 1f5:	80 fb 07             	cmp    $0x7,%bl
+ 1f8:	76 eb                	jbe    1e5 <atoo+0x3c>
+  return sign*n;
+ 1fa:	0f af c6             	imul   %esi,%eax
+}
+ 1fd:	5b                   	pop    %ebx
+ 1fe:	5e                   	pop    %esi
+ 1ff:	5d                   	pop    %ebp
+ 200:	c3                   	ret
+
+00000201 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 201:	55                   	push   %ebp
+ 202:	89 e5                	mov    %esp,%ebp
+ 204:	53                   	push   %ebx
+ 205:	8b 55 08             	mov    0x8(%ebp),%edx
+ 208:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 20b:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 20e:	eb 09                	jmp    219 <strncmp+0x18>
+      n--, p++, q++;
+ 210:	83 e8 01             	sub    $0x1,%eax
+ 213:	83 c2 01             	add    $0x1,%edx
+ 216:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 219:	85 c0                	test   %eax,%eax
+ 21b:	74 0b                	je     228 <strncmp+0x27>
+ 21d:	0f b6 1a             	movzbl (%edx),%ebx
+ 220:	84 db                	test   %bl,%bl
+ 222:	74 04                	je     228 <strncmp+0x27>
+ 224:	3a 19                	cmp    (%ecx),%bl
+ 226:	74 e8                	je     210 <strncmp+0xf>
+    if(n == 0)
+ 228:	85 c0                	test   %eax,%eax
+ 22a:	74 0d                	je     239 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 22c:	0f b6 02             	movzbl (%edx),%eax
+ 22f:	0f b6 11             	movzbl (%ecx),%edx
+ 232:	29 d0                	sub    %edx,%eax
+}
+ 234:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 237:	c9                   	leave
+ 238:	c3                   	ret
+      return 0;
+ 239:	b8 00 00 00 00       	mov    $0x0,%eax
+ 23e:	eb f4                	jmp    234 <strncmp+0x33>
+
+00000240 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+ 245:	8b 75 08             	mov    0x8(%ebp),%esi
+ 248:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 24b:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 24e:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 250:	eb 0d                	jmp    25f <memmove+0x1f>
+    *dst++ = *src++;
+ 252:	0f b6 01             	movzbl (%ecx),%eax
+ 255:	88 02                	mov    %al,(%edx)
+ 257:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 25a:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 25d:	89 d8                	mov    %ebx,%eax
+ 25f:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 262:	85 c0                	test   %eax,%eax
+ 264:	7f ec                	jg     252 <memmove+0x12>
+  return vdst;
+}
+ 266:	89 f0                	mov    %esi,%eax
+ 268:	5b                   	pop    %ebx
+ 269:	5e                   	pop    %esi
+ 26a:	5d                   	pop    %ebp
+ 26b:	c3                   	ret
+
+0000026c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 26c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 271:	cd 40                	int    $0x40
+ 273:	c3                   	ret
+
+00000274 <exit>:
+SYSCALL(exit)
+ 274:	b8 02 00 00 00       	mov    $0x2,%eax
+ 279:	cd 40                	int    $0x40
+ 27b:	c3                   	ret
+
+0000027c <wait>:
+SYSCALL(wait)
+ 27c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 281:	cd 40                	int    $0x40
+ 283:	c3                   	ret
+
+00000284 <pipe>:
+SYSCALL(pipe)
+ 284:	b8 04 00 00 00       	mov    $0x4,%eax
+ 289:	cd 40                	int    $0x40
+ 28b:	c3                   	ret
+
+0000028c <read>:
+SYSCALL(read)
+ 28c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 291:	cd 40                	int    $0x40
+ 293:	c3                   	ret
+
+00000294 <write>:
+SYSCALL(write)
+ 294:	b8 10 00 00 00       	mov    $0x10,%eax
+ 299:	cd 40                	int    $0x40
+ 29b:	c3                   	ret
+
+0000029c <close>:
+SYSCALL(close)
+ 29c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+000002a4 <kill>:
+SYSCALL(kill)
+ 2a4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+000002ac <exec>:
+SYSCALL(exec)
+ 2ac:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+000002b4 <open>:
+SYSCALL(open)
+ 2b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <mknod>:
+SYSCALL(mknod)
+ 2bc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <unlink>:
+SYSCALL(unlink)
+ 2c4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <fstat>:
+SYSCALL(fstat)
+ 2cc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <link>:
+SYSCALL(link)
+ 2d4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <mkdir>:
+SYSCALL(mkdir)
+ 2dc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <chdir>:
+SYSCALL(chdir)
+ 2e4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <dup>:
+SYSCALL(dup)
+ 2ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <getpid>:
+SYSCALL(getpid)
+ 2f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <sbrk>:
+SYSCALL(sbrk)
+ 2fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <sleep>:
+SYSCALL(sleep)
+ 304:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <uptime>:
+SYSCALL(uptime)
+ 30c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <halt>:
+SYSCALL(halt)
+ 314:	b8 16 00 00 00       	mov    $0x16,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <date>:
+SYSCALL(date)
+ 31c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <getuid>:
+SYSCALL(getuid)
+ 324:	b8 18 00 00 00       	mov    $0x18,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <getgid>:
+SYSCALL(getgid)
+ 32c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <getppid>:
+SYSCALL(getppid)
+ 334:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <setuid>:
+SYSCALL(setuid)
+ 33c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <setgid>:
+SYSCALL(setgid)
+ 344:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <getprocs>:
+SYSCALL(getprocs)
+ 34c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <getpriority>:
+SYSCALL(getpriority)
+ 354:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <setpriority>:
+SYSCALL(setpriority)
+ 35c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <pipesize>:
+SYSCALL(pipesize)
+ 364:	b8 20 00 00 00       	mov    $0x20,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <splice>:
+SYSCALL(splice)
+ 36c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 374:	55                   	push   %ebp
+ 375:	89 e5                	mov    %esp,%ebp
+ 377:	83 ec 1c             	sub    $0x1c,%esp
+ 37a:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 37d:	6a 01                	push   $0x1
+ 37f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 382:	52                   	push   %edx
+ 383:	50                   	push   %eax
+ 384:	e8 0b ff ff ff       	call   294 <write>
+}
+ 389:	83 c4 10             	add    $0x10,%esp
+ 38c:	c9                   	leave
+ 38d:	c3                   	ret
+
+0000038e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 38e:	55                   	push   %ebp
+ 38f:	89 e5                	mov    %esp,%ebp
+ 391:	57                   	push   %edi
+ 392:	56                   	push   %esi
+ 393:	53                   	push   %ebx
+ 394:	83 ec 2c             	sub    $0x2c,%esp
+ 397:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 39a:	89 d0                	mov    %edx,%eax
+ 39c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 39e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3a2:	0f 95 c1             	setne  %cl
+ 3a5:	c1 ea 1f             	shr    $0x1f,%edx
+ 3a8:	84 d1                	test   %dl,%cl
+ 3aa:	74 44                	je     3f0 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3ac:	f7 d8                	neg    %eax
+ 3ae:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3b0:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3bc:	89 c8                	mov    %ecx,%eax
+ 3be:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3c3:	f7 f6                	div    %esi
+ 3c5:	89 df                	mov    %ebx,%edi
+ 3c7:	83 c3 01             	add    $0x1,%ebx
+ 3ca:	0f b6 92 28 07 00 00 	movzbl 0x728(%edx),%edx
+ 3d1:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 3d5:	89 ca                	mov    %ecx,%edx
+ 3d7:	89 c1                	mov    %eax,%ecx
+ 3d9:	39 f2                	cmp    %esi,%edx
+ 3db:	73 df                	jae    3bc <printint+0x2e>
+  if(neg)
+ 3dd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 3e1:	74 31                	je     414 <printint+0x86>
+    buf[i++] = '-';
+ 3e3:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 3e8:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 3eb:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 3ee:	eb 17                	jmp    407 <printint+0x79>
+    x = xx;
+ 3f0:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 3f2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 3f9:	eb bc                	jmp    3b7 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 3fb:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 400:	89 f0                	mov    %esi,%eax
+ 402:	e8 6d ff ff ff       	call   374 <putc>
+  while(--i >= 0)
+ 407:	83 eb 01             	sub    $0x1,%ebx
+ 40a:	79 ef                	jns    3fb <printint+0x6d>
+}
+ 40c:	83 c4 2c             	add    $0x2c,%esp
+ 40f:	5b                   	pop    %ebx
+ 410:	5e                   	pop    %esi
+ 411:	5f                   	pop    %edi
+ 412:	5d                   	pop    %ebp
+ 413:	c3                   	ret
+ 414:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 417:	eb ee                	jmp    407 <printint+0x79>
+
+00000419 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 419:	55                   	push   %ebp
+ 41a:	89 e5                	mov    %esp,%ebp
+ 41c:	57                   	push   %edi
+ 41d:	56                   	push   %esi
+ 41e:	53                   	push   %ebx
+ 41f:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 422:	8d 45 10             	lea    0x10(%ebp),%eax
+ 425:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 428:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 42d:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 432:	eb 14                	jmp    448 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 434:	89 fa                	mov    %edi,%edx
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+ 439:	e8 36 ff ff ff       	call   374 <putc>
+ 43e:	eb 05                	jmp    445 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 440:	83 fe 25             	cmp    $0x25,%esi
+ 443:	74 25                	je     46a <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 445:	83 c3 01             	add    $0x1,%ebx
+ 448:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 44b:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 44f:	84 c0                	test   %al,%al
+ 451:	0f 84 20 01 00 00    	je     577 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 457:	0f be f8             	movsbl %al,%edi
+ 45a:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 45d:	85 f6                	test   %esi,%esi
+ 45f:	75 df                	jne    440 <printf+0x27>
+      if(c == '%'){
+ 461:	83 f8 25             	cmp    $0x25,%eax
+ 464:	75 ce                	jne    434 <printf+0x1b>
+        state = '%';
+ 466:	89 c6                	mov    %eax,%esi
+ 468:	eb db                	jmp    445 <printf+0x2c>
+      if(c == 'd'){
+ 46a:	83 f8 25             	cmp    $0x25,%eax
+ 46d:	0f 84 cf 00 00 00    	je     542 <printf+0x129>
+ 473:	0f 8c dd 00 00 00    	jl     556 <printf+0x13d>
+ 479:	83 f8 78             	cmp    $0x78,%eax
+ 47c:	0f 8f d4 00 00 00    	jg     556 <printf+0x13d>
+ 482:	83 f8 63             	cmp    $0x63,%eax
+ 485:	0f 8c cb 00 00 00    	jl     556 <printf+0x13d>
+ 48b:	83 e8 63             	sub    $0x63,%eax
+ 48e:	83 f8 15             	cmp    $0x15,%eax
+ 491:	0f 87 bf 00 00 00    	ja     556 <printf+0x13d>
+ 497:	ff 24 85 d0 06 00 00 	jmp    *0x6d0(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 49e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4a1:	8b 17                	mov    (%edi),%edx
+ 4a3:	83 ec 0c             	sub    $0xc,%esp
+ 4a6:	6a 01                	push   $0x1
+ 4a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b0:	e8 d9 fe ff ff       	call   38e <printint>
+        ap++;
+ 4b5:	83 c7 04             	add    $0x4,%edi
+ 4b8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 4bb:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4be:	be 00 00 00 00       	mov    $0x0,%esi
+ 4c3:	eb 80                	jmp    445 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 4c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4c8:	8b 17                	mov    (%edi),%edx
+ 4ca:	83 ec 0c             	sub    $0xc,%esp
+ 4cd:	6a 00                	push   $0x0
+ 4cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 4d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d7:	e8 b2 fe ff ff       	call   38e <printint>
+        ap++;
+ 4dc:	83 c7 04             	add    $0x4,%edi
+ 4df:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 4e2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 4e5:	be 00 00 00 00       	mov    $0x0,%esi
+ 4ea:	e9 56 ff ff ff       	jmp    445 <printf+0x2c>
+        s = (char*)*ap;
+ 4ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4f2:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 4f4:	83 c0 04             	add    $0x4,%eax
+ 4f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 4fa:	85 f6                	test   %esi,%esi
+ 4fc:	75 15                	jne    513 <printf+0xfa>
+          s = "(null)";
+ 4fe:	be c8 06 00 00       	mov    $0x6c8,%esi
+ 503:	eb 0e                	jmp    513 <printf+0xfa>
+          putc(fd, *s);
+ 505:	0f be d2             	movsbl %dl,%edx
+ 508:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50b:	e8 64 fe ff ff       	call   374 <putc>
+          s++;
+ 510:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 513:	0f b6 16             	movzbl (%esi),%edx
+ 516:	84 d2                	test   %dl,%dl
+ 518:	75 eb                	jne    505 <printf+0xec>
+      state = 0;
+ 51a:	be 00 00 00 00       	mov    $0x0,%esi
+ 51f:	e9 21 ff ff ff       	jmp    445 <printf+0x2c>
+        putc(fd, *ap);
+ 524:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 527:	0f be 17             	movsbl (%edi),%edx
+ 52a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52d:	e8 42 fe ff ff       	call   374 <putc>
+        ap++;
+ 532:	83 c7 04             	add    $0x4,%edi
+ 535:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 538:	be 00 00 00 00       	mov    $0x0,%esi
+ 53d:	e9 03 ff ff ff       	jmp    445 <printf+0x2c>
+        putc(fd, c);
+ 542:	89 fa                	mov    %edi,%edx
+ 544:	8b 45 08             	mov    0x8(%ebp),%eax
+ 547:	e8 28 fe ff ff       	call   374 <putc>
+      state = 0;
+ 54c:	be 00 00 00 00       	mov    $0x0,%esi
+ 551:	e9 ef fe ff ff       	jmp    445 <printf+0x2c>
+        putc(fd, '%');
+ 556:	ba 25 00 00 00       	mov    $0x25,%edx
+ 55b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 55e:	e8 11 fe ff ff       	call   374 <putc>
+        putc(fd, c);
+ 563:	89 fa                	mov    %edi,%edx
+ 565:	8b 45 08             	mov    0x8(%ebp),%eax
+ 568:	e8 07 fe ff ff       	call   374 <putc>
+      state = 0;
+ 56d:	be 00 00 00 00       	mov    $0x0,%esi
+ 572:	e9 ce fe ff ff       	jmp    445 <printf+0x2c>
+    }
+  }
+}
+ 577:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 57a:	5b                   	pop    %ebx
+ 57b:	5e                   	pop    %esi
+ 57c:	5f                   	pop    %edi
+ 57d:	5d                   	pop    %ebp
+ 57e:	c3                   	ret
+
+0000057f <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 57f:	55                   	push   %ebp
+ 580:	89 e5                	mov    %esp,%ebp
+ 582:	57                   	push   %edi
+ 583:	56                   	push   %esi
+ 584:	53                   	push   %ebx
+ 585:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 588:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 58b:	a1 14 0a 00 00       	mov    0xa14,%eax
+ 590:	eb 02                	jmp    594 <free+0x15>
+ 592:	89 d0                	mov    %edx,%eax
+ 594:	39 c8                	cmp    %ecx,%eax
+ 596:	73 04                	jae    59c <free+0x1d>
+ 598:	3b 08                	cmp    (%eax),%ecx
+ 59a:	72 12                	jb     5ae <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 59c:	8b 10                	mov    (%eax),%edx
+ 59e:	39 d0                	cmp    %edx,%eax
+ 5a0:	72 f0                	jb     592 <free+0x13>
+ 5a2:	39 c8                	cmp    %ecx,%eax
+ 5a4:	72 08                	jb     5ae <free+0x2f>
+ 5a6:	39 d1                	cmp    %edx,%ecx
+ 5a8:	72 04                	jb     5ae <free+0x2f>
+ 5aa:	89 d0                	mov    %edx,%eax
+ 5ac:	eb e6                	jmp    594 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5ae:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5b1:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5b4:	8b 10                	mov    (%eax),%edx
+ 5b6:	39 d7                	cmp    %edx,%edi
+ 5b8:	74 19                	je     5d3 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 5ba:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 5bd:	8b 50 04             	mov    0x4(%eax),%edx
+ 5c0:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 5c3:	39 ce                	cmp    %ecx,%esi
+ 5c5:	74 1b                	je     5e2 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 5c7:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 5c9:	a3 14 0a 00 00       	mov    %eax,0xa14
+}
+ 5ce:	5b                   	pop    %ebx
+ 5cf:	5e                   	pop    %esi
+ 5d0:	5f                   	pop    %edi
+ 5d1:	5d                   	pop    %ebp
+ 5d2:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 5d3:	03 72 04             	add    0x4(%edx),%esi
+ 5d6:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5d9:	8b 10                	mov    (%eax),%edx
+ 5db:	8b 12                	mov    (%edx),%edx
+ 5dd:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 5e0:	eb db                	jmp    5bd <free+0x3e>
+    p->s.size += bp->s.size;
+ 5e2:	03 53 fc             	add    -0x4(%ebx),%edx
+ 5e5:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 5e8:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 5eb:	89 10                	mov    %edx,(%eax)
+ 5ed:	eb da                	jmp    5c9 <free+0x4a>
+
+000005ef <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 5ef:	55                   	push   %ebp
+ 5f0:	89 e5                	mov    %esp,%ebp
+ 5f2:	53                   	push   %ebx
+ 5f3:	83 ec 04             	sub    $0x4,%esp
+ 5f6:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 5f8:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 5fd:	77 05                	ja     604 <morecore+0x15>
+    nu = 4096;
+ 5ff:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 604:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 60b:	83 ec 0c             	sub    $0xc,%esp
+ 60e:	50                   	push   %eax
+ 60f:	e8 e8 fc ff ff       	call   2fc <sbrk>
+  if(p == (char*)-1)
+ 614:	83 c4 10             	add    $0x10,%esp
+ 617:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 61a:	74 1c                	je     638 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 61c:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 61f:	83 c0 08             	add    $0x8,%eax
+ 622:	83 ec 0c             	sub    $0xc,%esp
+ 625:	50                   	push   %eax
+ 626:	e8 54 ff ff ff       	call   57f <free>
+  return freep;
+ 62b:	a1 14 0a 00 00       	mov    0xa14,%eax
+ 630:	83 c4 10             	add    $0x10,%esp
+}
+ 633:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 636:	c9                   	leave
+ 637:	c3                   	ret
+    return 0;
+ 638:	b8 00 00 00 00       	mov    $0x0,%eax
+ 63d:	eb f4                	jmp    633 <morecore+0x44>
+
+0000063f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 63f:	55                   	push   %ebp
+ 640:	89 e5                	mov    %esp,%ebp
+ 642:	53                   	push   %ebx
+ 643:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 646:	8b 45 08             	mov    0x8(%ebp),%eax
+ 649:	8d 58 07             	lea    0x7(%eax),%ebx
+ 64c:	c1 eb 03             	shr    $0x3,%ebx
+ 64f:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 652:	8b 0d 14 0a 00 00    	mov    0xa14,%ecx
+ 658:	85 c9                	test   %ecx,%ecx
+ 65a:	74 04                	je     660 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 65c:	8b 01                	mov    (%ecx),%eax
+ 65e:	eb 4a                	jmp    6aa <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 660:	c7 05 14 0a 00 00 18 	movl   $0xa18,0xa14
+ 667:	0a 00 00 
+ 66a:	c7 05 18 0a 00 00 18 	movl   $0xa18,0xa18
+ 671:	0a 00 00 
+    base.s.size = 0;
+ 674:	c7 05 1c 0a 00 00 00 	movl   $0x0,0xa1c
+ 67b:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 67e:	b9 18 0a 00 00       	mov    $0xa18,%ecx
+ 683:	eb d7                	jmp    65c <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 685:	74 19                	je     6a0 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 687:	29 da                	sub    %ebx,%edx
+ 689:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 68c:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 68f:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 692:	89 0d 14 0a 00 00    	mov    %ecx,0xa14
+      return (void*)(p + 1);
+ 698:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 69b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 69e:	c9                   	leave
+ 69f:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6a0:	8b 10                	mov    (%eax),%edx
+ 6a2:	89 11                	mov    %edx,(%ecx)
+ 6a4:	eb ec                	jmp    692 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6a6:	89 c1                	mov    %eax,%ecx
+ 6a8:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 6aa:	8b 50 04             	mov    0x4(%eax),%edx
+ 6ad:	39 da                	cmp    %ebx,%edx
+ 6af:	73 d4                	jae    685 <malloc+0x46>
+    if(p == freep)
+ 6b1:	39 05 14 0a 00 00    	cmp    %eax,0xa14
+ 6b7:	75 ed                	jne    6a6 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 6b9:	89 d8                	mov    %ebx,%eax
+ 6bb:	e8 2f ff ff ff       	call   5ef <morecore>
+ 6c0:	85 c0                	test   %eax,%eax
+ 6c2:	75 e2                	jne    6a6 <malloc+0x67>
+ 6c4:	eb d5                	jmp    69b <malloc+0x5c>
@@ -1,4 +1,5 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code. Uses bus-master DMA when there is a
+// PCI IDE controller that can do it, PIO otherwise.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +13,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,16 +25,52 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+
+#define IDE_MAXSECT   16  // sectors per READ/WRITE MULTIPLE
+#define IDE_DMAMAXSECT 128 // sectors per READ/WRITE DMA
+
+// Bus-master DMA registers (PIIX style), relative to idebm.
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4
+#define BM_START      0x01  // BM_CMD: start transfer
+#define BM_READ       0x08  // BM_CMD: transfer is disk to memory
+#define BM_ERR        0x02  // BM_STATUS: error (write 1 to clear)
+#define BM_INTR       0x04  // BM_STATUS: interrupt (write 1 to clear)
+
+// Physical region descriptor: one contiguous piece of a transfer.
+struct prd {
+  uint addr;
+  ushort count;    // bytes
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last entry in table
+
+// idequeue points to the buf now being read/written to the disk,
+// followed by the rest of the queue in C-SCAN order: blocks at or
+// after idepos in ascending order, then the ones before it.
+// The first idenbatch bufs are being transferred by one command;
+// idenbatch is 0 when the disk is idle.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenbatch;
+static uint idepos;
 
 static int havedisk1;
-static void idestart(struct buf*);
+static int idemaxsect;  // most sectors in one command
+static int idemulti;    // READ/WRITE MULTIPLE enabled (PIO)
+static int idesect;     // PIO: sectors of the active command moved
+static int idedma;      // active command uses DMA
+static int idepioretry; // DMA failed; redo the active request by PIO
+static ushort idebm;    // bus-master I/O base, 0 if using PIO
+static struct prd *ideprdt;  // PRD table for the active command
+static void idestart(void);
 
 // Wait for IDE disk to become ready.
 static int
@@ -51,6 +89,7 @@ void
 ideinit(void)
 {
   int i;
+  uint bdf, bar;
 
   initlock(&idelock, "ide");
   ioapicenable(IRQ_IDE, ncpu - 1);
@@ -65,35 +104,131 @@ ideinit(void)
     }
   }
 
+  // Use DMA if there is a bus-master capable IDE controller
+  // (class 1, subclass 1, prog-if bit 7) with its registers in
+  // I/O space (BAR4).
+  if(pcifind(PCI_CLASS, 0xFFFF8000, 0x01018000, &bdf) == 0 &&
+     ((bar = pciread(bdf, PCI_BAR(4))) & PCI_BAR_IO) &&
+     (ideprdt = (struct prd*)kalloc()) != 0){
+    pciwrite(bdf, PCI_COMMAND,
+             pciread(bdf, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+    idebm = bar & 0xFFFC;
+    idemaxsect = IDE_DMAMAXSECT;
+    outb(0x1f6, 0xe0 | (0<<4));
+    return;
+  }
+
+  // Let READ/WRITE MULTIPLE move up to IDE_MAXSECT sectors per
+  // interrupt, with the interrupt masked while we set it up.
+  // If a disk won't, use plain READ/WRITE SECTORS, a sector per
+  // interrupt, and have every command move one block.
+  idemaxsect = IDE_MAXSECT;
+  idemulti = 1;
+  outb(0x3f6, 2);
+  for(i = 0; i <= havedisk1; i++){
+    outb(0x1f6, 0xe0 | (i<<4));
+    outb(0x1f2, IDE_MAXSECT);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    if(idewait(1) < 0){
+      idemaxsect = BSIZE/SECTOR_SIZE;
+      idemulti = 0;
+    }
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Move the next DRQ block of the active PIO command -- up to
+// IDE_MAXSECT sectors with READ/WRITE MULTIPLE, one sector
+// without -- between the data port and the queued bufs.
+// Caller must hold idelock.
 static void
-idestart(struct buf *b)
+idepio(int write)
 {
-  if(b == 0)
+  struct buf *b;
+  char *p;
+  int i, n, spb = BSIZE/SECTOR_SIZE;
+
+  n = idenbatch*spb - idesect;
+  if(idemulti && n > IDE_MAXSECT)
+    n = IDE_MAXSECT;
+  else if(!idemulti)
+    n = 1;
+  for(; n > 0; n--, idesect++){
+    for(b = idequeue, i = idesect/spb; i > 0; i--)
+      b = b->qnext;
+    p = (char*)b->data + (idesect%spb)*SECTOR_SIZE;
+    if(write)
+      outsl(0x1f0, p, SECTOR_SIZE/4);
+    else
+      insl(0x1f0, p, SECTOR_SIZE/4);
+  }
+}
+
+// Start the request at the head of idequeue, merged with the
+// requests after it for the following blocks in the same
+// direction, as many as one command can carry.
+// Caller must hold idelock.
+static void
+idestart(void)
+{
+  struct buf *b, *q;
+  int i, n, nsect, sector;
+  int sector_per_block =  BSIZE/SECTOR_SIZE;
+
+  if((b = idequeue) == 0)
     panic("idestart");
   if(b->blockno >= FSSIZE)
     panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  if(sector_per_block > idemaxsect)
+    panic("idestart");
 
-  if (sector_per_block > 7) panic("idestart");
+  for(n = 1, q = b; q->qnext && (n+1)*sector_per_block <= idemaxsect; n++, q = q->qnext){
+    if(q->qnext->dev != b->dev || q->qnext->blockno != q->blockno+1 ||
+       q->qnext->blockno >= FSSIZE ||
+       (q->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+  }
+  idenbatch = n;
+  idepos = b->blockno;
+  idesect = 0;
+
+  nsect = n * sector_per_block;
+  sector = b->blockno * sector_per_block;
+  int read_cmd = (nsect > 1 && idemulti) ? IDE_CMD_RDMUL : IDE_CMD_READ;
+  int write_cmd = (nsect > 1 && idemulti) ? IDE_CMD_WRMUL : IDE_CMD_WRITE;
+  int dmadir = (b->flags & B_DIRTY) ? 0 : BM_READ;
+
+  idedma = idebm && !idepioretry;
+  if(idedma){
+    // One PRD per buffer; a block never crosses a page.
+    for(i = 0, q = b; i < n; i++, q = q->qnext){
+      ideprdt[i].addr = V2P(q->data);
+      ideprdt[i].count = BSIZE;
+      ideprdt[i].flags = 0;
+    }
+    ideprdt[n-1].flags = PRD_EOT;
+    outl(idebm + BM_PRDT, V2P(ideprdt));
+    outb(idebm + BM_CMD, dmadir);
+    outb(idebm + BM_STATUS, BM_ERR | BM_INTR);
+    read_cmd = IDE_CMD_RDDMA;
+    write_cmd = IDE_CMD_WRDMA;
+  }
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsect);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(idedma){
+    outb(0x1f7, (b->flags & B_DIRTY) ? write_cmd : read_cmd);
+    outb(idebm + BM_CMD, dmadir | BM_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    idepio(1);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -104,40 +239,89 @@ void
 ideintr(void)
 {
   struct buf *b;
+  int i, st;
 
-  // First queued buffer is the active request.
+  // The first idenbatch queued buffers are the active request.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = idequeue) == 0 || idenbatch == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(idedma){
+    // The controller has already moved the data, unless it
+    // or the drive reports an error; then try again by PIO.
+    if(((st = inb(idebm + BM_STATUS)) & BM_INTR) == 0){
+      release(&idelock);
+      return;
+    }
+    outb(idebm + BM_CMD, 0);
+    outb(idebm + BM_STATUS, BM_ERR | BM_INTR);
+    if(idewait(1) < 0 || (st & BM_ERR)){
+      cprintf("ide: DMA error on block %d, retrying with PIO\n", b->blockno);
+      idepioretry = 1;
+      idestart();
+      release(&idelock);
+      return;
+    }
+  } else {
+    // Each interrupt is one DRQ block: read it, or send the
+    // next one, until the whole command has been moved.
+    if(idewait(1) < 0)
+      panic("ide: disk error");
+    if(!(b->flags & B_DIRTY))
+      idepio(0);
+    if(idesect < idenbatch*(BSIZE/SECTOR_SIZE)){
+      if(b->flags & B_DIRTY)
+        idepio(1);
+      release(&idelock);
+      return;
+    }
+  }
+
+  for(i = 0; i < idenbatch; i++){
+    b = idequeue;
+    idequeue = b->qnext;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    // Wake process waiting for this buf. A read-ahead buf is
+    // left in the cache for bget to find.
+    b->flags |= B_VALID;
+    b->flags &= ~(B_DIRTY|B_ASYNC);
+    wakeup(b);
+  }
+  idenbatch = 0;
+  idepioretry = 0;
 
   // Start disk on next buf in queue.
   if(idequeue != 0)
-    idestart(idequeue);
+    idestart();
 
   release(&idelock);
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Does a come before b in the C-SCAN sweep starting at idepos?
+static int
+idebefore(struct buf *a, struct buf *b)
+{
+  int wrapa = a->blockno < idepos;
+  int wrapb = b->blockno < idepos;
+
+  if(wrapa != wrapb)
+    return wrapb;
+  if(a->blockno != b->blockno)
+    return a->blockno < b->blockno;
+  return a->dev < b->dev;
+}
+
+// Add b to idequeue in sweep order, behind the active request.
+// Caller must hold idelock.
+static void
+idequeueadd(struct buf *b)
 {
   struct buf **pp;
+  int i;
 
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -146,23 +330,76 @@ iderw(struct buf *b)
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
-  acquire(&idelock);  //DOC:acquire-lock
-
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  pp = &idequeue;
+  for(i = 0; i < idenbatch; i++)
+    pp = &(*pp)->qnext;
+  for(; *pp && !idebefore(b, *pp); pp = &(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
+}
 
-  // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+// Start reading b from disk and return without waiting.
+// b is marked B_ASYNC until the read completes; the caller
+// should release it (brelse) rather than hold it meanwhile.
+void
+idereadahead(struct buf *b)
+{
+  if(virtiorw(&b, 1, 1) == 0)
+    return;
+  acquire(&idelock);
+  b->flags |= B_ASYNC;
+  idequeueadd(b);
+  if(idenbatch == 0)
+    idestart();
+  release(&idelock);
+}
 
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+// Wait for a read-ahead into b to complete.
+void
+idewaitahead(struct buf *b)
+{
+  if(virtiowait(b) == 0)
+    return;
+  acquire(&idelock);
+  while(b->flags & B_ASYNC)
     sleep(b, &idelock);
-  }
+  release(&idelock);
+}
+
+// Sync n bufs with disk, queueing them all before starting
+// so that neighbouring blocks can go out as one command.
+// All n must be for the same device.
+// For each buf:
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderwv(struct buf **bufs, int n)
+{
+  int i;
+
+  if(virtiorw(bufs, n, 0) == 0)
+    return;
+  acquire(&idelock);  //DOC:acquire-lock
+
+  for(i = 0; i < n; i++)
+    idequeueadd(bufs[i]);
 
+  // Start disk if necessary.
+  if(idenbatch == 0)
+    idestart();
+
+  // Wait for requests to finish.
+  for(i = 0; i < n; i++)
+    while((bufs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(bufs[i], &idelock);
 
   release(&idelock);
 }
+
+// Sync buf with disk.
+void
+iderw(struct buf *b)
+{
+  iderwv(&b, 1);
+}
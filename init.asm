@@ -0,0 +1,1235 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 94 07 00 00       	push   $0x794
+  19:	e8 63 03 00 00       	call   381 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	78 1b                	js     40 <main+0x40>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  25:	83 ec 0c             	sub    $0xc,%esp
+  28:	6a 00                	push   $0x0
+  2a:	e8 8a 03 00 00       	call   3b9 <dup>
+  dup(0);  // stderr
+  2f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  36:	e8 7e 03 00 00       	call   3b9 <dup>
+  3b:	83 c4 10             	add    $0x10,%esp
+  3e:	eb 58                	jmp    98 <main+0x98>
+    mknod("console", 1, 1);
+  40:	83 ec 04             	sub    $0x4,%esp
+  43:	6a 01                	push   $0x1
+  45:	6a 01                	push   $0x1
+  47:	68 94 07 00 00       	push   $0x794
+  4c:	e8 38 03 00 00       	call   389 <mknod>
+    open("console", O_RDWR);
+  51:	83 c4 08             	add    $0x8,%esp
+  54:	6a 02                	push   $0x2
+  56:	68 94 07 00 00       	push   $0x794
+  5b:	e8 21 03 00 00       	call   381 <open>
+  60:	83 c4 10             	add    $0x10,%esp
+  63:	eb c0                	jmp    25 <main+0x25>
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+    pid = fork();
+    if(pid < 0){
+      printf(1, "init: fork failed\n");
+  65:	83 ec 08             	sub    $0x8,%esp
+  68:	68 af 07 00 00       	push   $0x7af
+  6d:	6a 01                	push   $0x1
+  6f:	e8 72 04 00 00       	call   4e6 <printf>
+      exit();
+  74:	e8 c8 02 00 00       	call   341 <exit>
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  79:	83 ec 08             	sub    $0x8,%esp
+  7c:	68 db 07 00 00       	push   $0x7db
+  81:	6a 01                	push   $0x1
+  83:	e8 5e 04 00 00       	call   4e6 <printf>
+  88:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+  8b:	e8 b9 02 00 00       	call   349 <wait>
+  90:	85 c0                	test   %eax,%eax
+  92:	78 04                	js     98 <main+0x98>
+  94:	39 c3                	cmp    %eax,%ebx
+  96:	75 e1                	jne    79 <main+0x79>
+    printf(1, "init: starting sh\n");
+  98:	83 ec 08             	sub    $0x8,%esp
+  9b:	68 9c 07 00 00       	push   $0x79c
+  a0:	6a 01                	push   $0x1
+  a2:	e8 3f 04 00 00       	call   4e6 <printf>
+    pid = fork();
+  a7:	e8 8d 02 00 00       	call   339 <fork>
+  ac:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  ae:	83 c4 10             	add    $0x10,%esp
+  b1:	85 c0                	test   %eax,%eax
+  b3:	78 b0                	js     65 <main+0x65>
+    if(pid == 0){
+  b5:	75 d4                	jne    8b <main+0x8b>
+      exec("sh", argv);
+  b7:	83 ec 08             	sub    $0x8,%esp
+  ba:	68 3c 0b 00 00       	push   $0xb3c
+  bf:	68 c2 07 00 00       	push   $0x7c2
+  c4:	e8 b0 02 00 00       	call   379 <exec>
+      printf(1, "init: exec sh failed\n");
+  c9:	83 c4 08             	add    $0x8,%esp
+  cc:	68 c5 07 00 00       	push   $0x7c5
+  d1:	6a 01                	push   $0x1
+  d3:	e8 0e 04 00 00       	call   4e6 <printf>
+      exit();
+  d8:	e8 64 02 00 00       	call   341 <exit>
+
+000000dd <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  dd:	55                   	push   %ebp
+  de:	89 e5                	mov    %esp,%ebp
+  e0:	56                   	push   %esi
+  e1:	53                   	push   %ebx
+  e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  e8:	89 f0                	mov    %esi,%eax
+  ea:	89 d1                	mov    %edx,%ecx
+  ec:	83 c2 01             	add    $0x1,%edx
+  ef:	89 c3                	mov    %eax,%ebx
+  f1:	83 c0 01             	add    $0x1,%eax
+  f4:	0f b6 09             	movzbl (%ecx),%ecx
+  f7:	88 0b                	mov    %cl,(%ebx)
+  f9:	84 c9                	test   %cl,%cl
+  fb:	75 ed                	jne    ea <strcpy+0xd>
+    ;
+  return os;
+}
+  fd:	89 f0                	mov    %esi,%eax
+  ff:	5b                   	pop    %ebx
+ 100:	5e                   	pop    %esi
+ 101:	5d                   	pop    %ebp
+ 102:	c3                   	ret
+
+00000103 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 103:	55                   	push   %ebp
+ 104:	89 e5                	mov    %esp,%ebp
+ 106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 109:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 10c:	eb 06                	jmp    114 <strcmp+0x11>
+    p++, q++;
+ 10e:	83 c1 01             	add    $0x1,%ecx
+ 111:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 114:	0f b6 01             	movzbl (%ecx),%eax
+ 117:	84 c0                	test   %al,%al
+ 119:	74 04                	je     11f <strcmp+0x1c>
+ 11b:	3a 02                	cmp    (%edx),%al
+ 11d:	74 ef                	je     10e <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 11f:	0f b6 c0             	movzbl %al,%eax
+ 122:	0f b6 12             	movzbl (%edx),%edx
+ 125:	29 d0                	sub    %edx,%eax
+}
+ 127:	5d                   	pop    %ebp
+ 128:	c3                   	ret
+
+00000129 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 129:	55                   	push   %ebp
+ 12a:	89 e5                	mov    %esp,%ebp
+ 12c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 12f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 134:	eb 03                	jmp    139 <strlen+0x10>
+ 136:	83 c0 01             	add    $0x1,%eax
+ 139:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 13d:	75 f7                	jne    136 <strlen+0xd>
+    ;
+  return n;
+}
+ 13f:	5d                   	pop    %ebp
+ 140:	c3                   	ret
+
+00000141 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 141:	55                   	push   %ebp
+ 142:	89 e5                	mov    %esp,%ebp
+ 144:	57                   	push   %edi
+ 145:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 148:	89 d7                	mov    %edx,%edi
+ 14a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 150:	fc                   	cld
+ 151:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 153:	89 d0                	mov    %edx,%eax
+ 155:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 158:	c9                   	leave
+ 159:	c3                   	ret
+
+0000015a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 15a:	55                   	push   %ebp
+ 15b:	89 e5                	mov    %esp,%ebp
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 164:	eb 03                	jmp    169 <strchr+0xf>
+ 166:	83 c0 01             	add    $0x1,%eax
+ 169:	0f b6 10             	movzbl (%eax),%edx
+ 16c:	84 d2                	test   %dl,%dl
+ 16e:	74 06                	je     176 <strchr+0x1c>
+    if(*s == c)
+ 170:	38 ca                	cmp    %cl,%dl
+ 172:	75 f2                	jne    166 <strchr+0xc>
+ 174:	eb 05                	jmp    17b <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 176:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+
+0000017d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 17d:	55                   	push   %ebp
+ 17e:	89 e5                	mov    %esp,%ebp
+ 180:	57                   	push   %edi
+ 181:	56                   	push   %esi
+ 182:	53                   	push   %ebx
+ 183:	83 ec 1c             	sub    $0x1c,%esp
+ 186:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 189:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 18e:	89 de                	mov    %ebx,%esi
+ 190:	83 c3 01             	add    $0x1,%ebx
+ 193:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 196:	7d 2e                	jge    1c6 <gets+0x49>
+    cc = read(0, &c, 1);
+ 198:	83 ec 04             	sub    $0x4,%esp
+ 19b:	6a 01                	push   $0x1
+ 19d:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1a0:	50                   	push   %eax
+ 1a1:	6a 00                	push   $0x0
+ 1a3:	e8 b1 01 00 00       	call   359 <read>
+    if(cc < 1)
+ 1a8:	83 c4 10             	add    $0x10,%esp
+ 1ab:	85 c0                	test   %eax,%eax
+ 1ad:	7e 17                	jle    1c6 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1af:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b3:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1b6:	3c 0a                	cmp    $0xa,%al
+ 1b8:	0f 94 c2             	sete   %dl
+ 1bb:	3c 0d                	cmp    $0xd,%al
+ 1bd:	0f 94 c0             	sete   %al
+ 1c0:	08 c2                	or     %al,%dl
+ 1c2:	74 ca                	je     18e <gets+0x11>
+    buf[i++] = c;
+ 1c4:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1c6:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 1ca:	89 f8                	mov    %edi,%eax
+ 1cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cf:	5b                   	pop    %ebx
+ 1d0:	5e                   	pop    %esi
+ 1d1:	5f                   	pop    %edi
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+
+000001d4 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1d4:	55                   	push   %ebp
+ 1d5:	89 e5                	mov    %esp,%ebp
+ 1d7:	56                   	push   %esi
+ 1d8:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1d9:	83 ec 08             	sub    $0x8,%esp
+ 1dc:	6a 00                	push   $0x0
+ 1de:	ff 75 08             	push   0x8(%ebp)
+ 1e1:	e8 9b 01 00 00       	call   381 <open>
+  if(fd < 0)
+ 1e6:	83 c4 10             	add    $0x10,%esp
+ 1e9:	85 c0                	test   %eax,%eax
+ 1eb:	78 24                	js     211 <stat+0x3d>
+ 1ed:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1ef:	83 ec 08             	sub    $0x8,%esp
+ 1f2:	ff 75 0c             	push   0xc(%ebp)
+ 1f5:	50                   	push   %eax
+ 1f6:	e8 9e 01 00 00       	call   399 <fstat>
+ 1fb:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1fd:	89 1c 24             	mov    %ebx,(%esp)
+ 200:	e8 64 01 00 00       	call   369 <close>
+  return r;
+ 205:	83 c4 10             	add    $0x10,%esp
+}
+ 208:	89 f0                	mov    %esi,%eax
+ 20a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 20d:	5b                   	pop    %ebx
+ 20e:	5e                   	pop    %esi
+ 20f:	5d                   	pop    %ebp
+ 210:	c3                   	ret
+    return -1;
+ 211:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 216:	eb f0                	jmp    208 <stat+0x34>
+
+00000218 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 218:	55                   	push   %ebp
+ 219:	89 e5                	mov    %esp,%ebp
+ 21b:	56                   	push   %esi
+ 21c:	53                   	push   %ebx
+ 21d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 220:	eb 03                	jmp    225 <atoi+0xd>
+ 222:	83 c2 01             	add    $0x1,%edx
+ 225:	0f b6 02             	movzbl (%edx),%eax
+ 228:	3c 20                	cmp    $0x20,%al
+ 22a:	74 f6                	je     222 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 22c:	3c 2d                	cmp    $0x2d,%al
+ 22e:	74 1d                	je     24d <atoi+0x35>
+ 230:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 235:	3c 2b                	cmp    $0x2b,%al
+ 237:	0f 94 c1             	sete   %cl
+ 23a:	3c 2d                	cmp    $0x2d,%al
+ 23c:	0f 94 c0             	sete   %al
+ 23f:	08 c1                	or     %al,%cl
+ 241:	74 03                	je     246 <atoi+0x2e>
+    s++;
+ 243:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 246:	b8 00 00 00 00       	mov    $0x0,%eax
+ 24b:	eb 17                	jmp    264 <atoi+0x4c>
+ 24d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 252:	eb e1                	jmp    235 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 254:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 257:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 25a:	83 c2 01             	add    $0x1,%edx
+ 25d:	0f be c9             	movsbl %cl,%ecx
+ 260:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 264:	0f b6 0a             	movzbl (%edx),%ecx
+ 267:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 26a:	80 fb 09             	cmp    $0x9,%bl
+ 26d:	76 e5                	jbe    254 <atoi+0x3c>
+  return sign*n;
+ 26f:	0f af c6             	imul   %esi,%eax
+}
+ 272:	5b                   	pop    %ebx
+ 273:	5e                   	pop    %esi
+ 274:	5d                   	pop    %ebp
+ 275:	c3                   	ret
+
+00000276 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 276:	55                   	push   %ebp
+ 277:	89 e5                	mov    %esp,%ebp
+ 279:	56                   	push   %esi
+ 27a:	53                   	push   %ebx
+ 27b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 27e:	eb 03                	jmp    283 <atoo+0xd>
+ 280:	83 c2 01             	add    $0x1,%edx
+ 283:	0f b6 02             	movzbl (%edx),%eax
+ 286:	3c 20                	cmp    $0x20,%al
+ 288:	74 f6                	je     280 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 28a:	3c 2d                	cmp    $0x2d,%al
+ 28c:	74 1d                	je     2ab <atoo+0x35>
+ 28e:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 293:	3c 2b                	cmp    $0x2b,%al
+ 295:	0f 94 c1             	sete   %cl
+ 298:	3c 2d                	cmp    $0x2d,%al
+ 29a:	0f 94 c0             	sete   %al
+ 29d:	08 c1                	or     %al,%cl
+ 29f:	74 03                	je     2a4 <atoo+0x2e>
+    s++;
+ 2a1:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 2a4:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2a9:	eb 11                	jmp    2bc <atoo+0x46>
+ 2ab:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2b0:	eb e1                	jmp    293 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 2b2:	83 c2 01             	add    $0x1,%edx
+ 2b5:	0f be c9             	movsbl %cl,%ecx
+ 2b8:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 2bc:	0f b6 0a             	movzbl (%edx),%ecx
+ 2bf:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2c2:	80 fb 07             	cmp    $0x7,%bl
+ 2c5:	76 eb                	jbe    2b2 <atoo+0x3c>
+  return sign*n;
+ 2c7:	0f af c6             	imul   %esi,%eax
+}
+ 2ca:	5b                   	pop    %ebx
+ 2cb:	5e                   	pop    %esi
+ 2cc:	5d                   	pop    %ebp
+ 2cd:	c3                   	ret
+
+000002ce <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 2ce:	55                   	push   %ebp
+ 2cf:	89 e5                	mov    %esp,%ebp
+ 2d1:	53                   	push   %ebx
+ 2d2:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 2d8:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 2db:	eb 09                	jmp    2e6 <strncmp+0x18>
+      n--, p++, q++;
+ 2dd:	83 e8 01             	sub    $0x1,%eax
+ 2e0:	83 c2 01             	add    $0x1,%edx
+ 2e3:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 2e6:	85 c0                	test   %eax,%eax
+ 2e8:	74 0b                	je     2f5 <strncmp+0x27>
+ 2ea:	0f b6 1a             	movzbl (%edx),%ebx
+ 2ed:	84 db                	test   %bl,%bl
+ 2ef:	74 04                	je     2f5 <strncmp+0x27>
+ 2f1:	3a 19                	cmp    (%ecx),%bl
+ 2f3:	74 e8                	je     2dd <strncmp+0xf>
+    if(n == 0)
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	74 0d                	je     306 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 2f9:	0f b6 02             	movzbl (%edx),%eax
+ 2fc:	0f b6 11             	movzbl (%ecx),%edx
+ 2ff:	29 d0                	sub    %edx,%eax
+}
+ 301:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 304:	c9                   	leave
+ 305:	c3                   	ret
+      return 0;
+ 306:	b8 00 00 00 00       	mov    $0x0,%eax
+ 30b:	eb f4                	jmp    301 <strncmp+0x33>
+
+0000030d <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 30d:	55                   	push   %ebp
+ 30e:	89 e5                	mov    %esp,%ebp
+ 310:	56                   	push   %esi
+ 311:	53                   	push   %ebx
+ 312:	8b 75 08             	mov    0x8(%ebp),%esi
+ 315:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 318:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 31b:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 31d:	eb 0d                	jmp    32c <memmove+0x1f>
+    *dst++ = *src++;
+ 31f:	0f b6 01             	movzbl (%ecx),%eax
+ 322:	88 02                	mov    %al,(%edx)
+ 324:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 327:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 32a:	89 d8                	mov    %ebx,%eax
+ 32c:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 32f:	85 c0                	test   %eax,%eax
+ 331:	7f ec                	jg     31f <memmove+0x12>
+  return vdst;
+}
+ 333:	89 f0                	mov    %esi,%eax
+ 335:	5b                   	pop    %ebx
+ 336:	5e                   	pop    %esi
+ 337:	5d                   	pop    %ebp
+ 338:	c3                   	ret
+
+00000339 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 339:	b8 01 00 00 00       	mov    $0x1,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <exit>:
+SYSCALL(exit)
+ 341:	b8 02 00 00 00       	mov    $0x2,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <wait>:
+SYSCALL(wait)
+ 349:	b8 03 00 00 00       	mov    $0x3,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <pipe>:
+SYSCALL(pipe)
+ 351:	b8 04 00 00 00       	mov    $0x4,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <read>:
+SYSCALL(read)
+ 359:	b8 05 00 00 00       	mov    $0x5,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <write>:
+SYSCALL(write)
+ 361:	b8 10 00 00 00       	mov    $0x10,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <close>:
+SYSCALL(close)
+ 369:	b8 15 00 00 00       	mov    $0x15,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <kill>:
+SYSCALL(kill)
+ 371:	b8 06 00 00 00       	mov    $0x6,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <exec>:
+SYSCALL(exec)
+ 379:	b8 07 00 00 00       	mov    $0x7,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <open>:
+SYSCALL(open)
+ 381:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <mknod>:
+SYSCALL(mknod)
+ 389:	b8 11 00 00 00       	mov    $0x11,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <unlink>:
+SYSCALL(unlink)
+ 391:	b8 12 00 00 00       	mov    $0x12,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <fstat>:
+SYSCALL(fstat)
+ 399:	b8 08 00 00 00       	mov    $0x8,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <link>:
+SYSCALL(link)
+ 3a1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <mkdir>:
+SYSCALL(mkdir)
+ 3a9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <chdir>:
+SYSCALL(chdir)
+ 3b1:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <dup>:
+SYSCALL(dup)
+ 3b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <getpid>:
+SYSCALL(getpid)
+ 3c1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <sbrk>:
+SYSCALL(sbrk)
+ 3c9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <sleep>:
+SYSCALL(sleep)
+ 3d1:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <uptime>:
+SYSCALL(uptime)
+ 3d9:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <halt>:
+SYSCALL(halt)
+ 3e1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <date>:
+SYSCALL(date)
+ 3e9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3ee:	cd 40                	int    $0x40
+ 3f0:	c3                   	ret
+
+000003f1 <getuid>:
+SYSCALL(getuid)
+ 3f1:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3f6:	cd 40                	int    $0x40
+ 3f8:	c3                   	ret
+
+000003f9 <getgid>:
+SYSCALL(getgid)
+ 3f9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3fe:	cd 40                	int    $0x40
+ 400:	c3                   	ret
+
+00000401 <getppid>:
+SYSCALL(getppid)
+ 401:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <setuid>:
+SYSCALL(setuid)
+ 409:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 40e:	cd 40                	int    $0x40
+ 410:	c3                   	ret
+
+00000411 <setgid>:
+SYSCALL(setgid)
+ 411:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 416:	cd 40                	int    $0x40
+ 418:	c3                   	ret
+
+00000419 <getprocs>:
+SYSCALL(getprocs)
+ 419:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 41e:	cd 40                	int    $0x40
+ 420:	c3                   	ret
+
+00000421 <getpriority>:
+SYSCALL(getpriority)
+ 421:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 426:	cd 40                	int    $0x40
+ 428:	c3                   	ret
+
+00000429 <setpriority>:
+SYSCALL(setpriority)
+ 429:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 42e:	cd 40                	int    $0x40
+ 430:	c3                   	ret
+
+00000431 <pipesize>:
+SYSCALL(pipesize)
+ 431:	b8 20 00 00 00       	mov    $0x20,%eax
+ 436:	cd 40                	int    $0x40
+ 438:	c3                   	ret
+
+00000439 <splice>:
+SYSCALL(splice)
+ 439:	b8 21 00 00 00       	mov    $0x21,%eax
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 441:	55                   	push   %ebp
+ 442:	89 e5                	mov    %esp,%ebp
+ 444:	83 ec 1c             	sub    $0x1c,%esp
+ 447:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 44a:	6a 01                	push   $0x1
+ 44c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 44f:	52                   	push   %edx
+ 450:	50                   	push   %eax
+ 451:	e8 0b ff ff ff       	call   361 <write>
+}
+ 456:	83 c4 10             	add    $0x10,%esp
+ 459:	c9                   	leave
+ 45a:	c3                   	ret
+
+0000045b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 45b:	55                   	push   %ebp
+ 45c:	89 e5                	mov    %esp,%ebp
+ 45e:	57                   	push   %edi
+ 45f:	56                   	push   %esi
+ 460:	53                   	push   %ebx
+ 461:	83 ec 2c             	sub    $0x2c,%esp
+ 464:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 467:	89 d0                	mov    %edx,%eax
+ 469:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 46b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 46f:	0f 95 c1             	setne  %cl
+ 472:	c1 ea 1f             	shr    $0x1f,%edx
+ 475:	84 d1                	test   %dl,%cl
+ 477:	74 44                	je     4bd <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 479:	f7 d8                	neg    %eax
+ 47b:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 47d:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 484:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 489:	89 c8                	mov    %ecx,%eax
+ 48b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 490:	f7 f6                	div    %esi
+ 492:	89 df                	mov    %ebx,%edi
+ 494:	83 c3 01             	add    $0x1,%ebx
+ 497:	0f b6 92 44 08 00 00 	movzbl 0x844(%edx),%edx
+ 49e:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 4a2:	89 ca                	mov    %ecx,%edx
+ 4a4:	89 c1                	mov    %eax,%ecx
+ 4a6:	39 f2                	cmp    %esi,%edx
+ 4a8:	73 df                	jae    489 <printint+0x2e>
+  if(neg)
+ 4aa:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 4ae:	74 31                	je     4e1 <printint+0x86>
+    buf[i++] = '-';
+ 4b0:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4b5:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 4b8:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4bb:	eb 17                	jmp    4d4 <printint+0x79>
+    x = xx;
+ 4bd:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 4bf:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 4c6:	eb bc                	jmp    484 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4c8:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 4cd:	89 f0                	mov    %esi,%eax
+ 4cf:	e8 6d ff ff ff       	call   441 <putc>
+  while(--i >= 0)
+ 4d4:	83 eb 01             	sub    $0x1,%ebx
+ 4d7:	79 ef                	jns    4c8 <printint+0x6d>
+}
+ 4d9:	83 c4 2c             	add    $0x2c,%esp
+ 4dc:	5b                   	pop    %ebx
+ 4dd:	5e                   	pop    %esi
+ 4de:	5f                   	pop    %edi
+ 4df:	5d                   	pop    %ebp
+ 4e0:	c3                   	ret
+ 4e1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4e4:	eb ee                	jmp    4d4 <printint+0x79>
+
+000004e6 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4e6:	55                   	push   %ebp
+ 4e7:	89 e5                	mov    %esp,%ebp
+ 4e9:	57                   	push   %edi
+ 4ea:	56                   	push   %esi
+ 4eb:	53                   	push   %ebx
+ 4ec:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 4ef:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 4f5:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 4fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4ff:	eb 14                	jmp    515 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 501:	89 fa                	mov    %edi,%edx
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	e8 36 ff ff ff       	call   441 <putc>
+ 50b:	eb 05                	jmp    512 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 50d:	83 fe 25             	cmp    $0x25,%esi
+ 510:	74 25                	je     537 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 512:	83 c3 01             	add    $0x1,%ebx
+ 515:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 518:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 51c:	84 c0                	test   %al,%al
+ 51e:	0f 84 20 01 00 00    	je     644 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 524:	0f be f8             	movsbl %al,%edi
+ 527:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 52a:	85 f6                	test   %esi,%esi
+ 52c:	75 df                	jne    50d <printf+0x27>
+      if(c == '%'){
+ 52e:	83 f8 25             	cmp    $0x25,%eax
+ 531:	75 ce                	jne    501 <printf+0x1b>
+        state = '%';
+ 533:	89 c6                	mov    %eax,%esi
+ 535:	eb db                	jmp    512 <printf+0x2c>
+      if(c == 'd'){
+ 537:	83 f8 25             	cmp    $0x25,%eax
+ 53a:	0f 84 cf 00 00 00    	je     60f <printf+0x129>
+ 540:	0f 8c dd 00 00 00    	jl     623 <printf+0x13d>
+ 546:	83 f8 78             	cmp    $0x78,%eax
+ 549:	0f 8f d4 00 00 00    	jg     623 <printf+0x13d>
+ 54f:	83 f8 63             	cmp    $0x63,%eax
+ 552:	0f 8c cb 00 00 00    	jl     623 <printf+0x13d>
+ 558:	83 e8 63             	sub    $0x63,%eax
+ 55b:	83 f8 15             	cmp    $0x15,%eax
+ 55e:	0f 87 bf 00 00 00    	ja     623 <printf+0x13d>
+ 564:	ff 24 85 ec 07 00 00 	jmp    *0x7ec(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 56b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 56e:	8b 17                	mov    (%edi),%edx
+ 570:	83 ec 0c             	sub    $0xc,%esp
+ 573:	6a 01                	push   $0x1
+ 575:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 57a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57d:	e8 d9 fe ff ff       	call   45b <printint>
+        ap++;
+ 582:	83 c7 04             	add    $0x4,%edi
+ 585:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 588:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 58b:	be 00 00 00 00       	mov    $0x0,%esi
+ 590:	eb 80                	jmp    512 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 592:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 595:	8b 17                	mov    (%edi),%edx
+ 597:	83 ec 0c             	sub    $0xc,%esp
+ 59a:	6a 00                	push   $0x0
+ 59c:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a4:	e8 b2 fe ff ff       	call   45b <printint>
+        ap++;
+ 5a9:	83 c7 04             	add    $0x4,%edi
+ 5ac:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 5af:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5b2:	be 00 00 00 00       	mov    $0x0,%esi
+ 5b7:	e9 56 ff ff ff       	jmp    512 <printf+0x2c>
+        s = (char*)*ap;
+ 5bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5bf:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 5c1:	83 c0 04             	add    $0x4,%eax
+ 5c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 5c7:	85 f6                	test   %esi,%esi
+ 5c9:	75 15                	jne    5e0 <printf+0xfa>
+          s = "(null)";
+ 5cb:	be e4 07 00 00       	mov    $0x7e4,%esi
+ 5d0:	eb 0e                	jmp    5e0 <printf+0xfa>
+          putc(fd, *s);
+ 5d2:	0f be d2             	movsbl %dl,%edx
+ 5d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d8:	e8 64 fe ff ff       	call   441 <putc>
+          s++;
+ 5dd:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 5e0:	0f b6 16             	movzbl (%esi),%edx
+ 5e3:	84 d2                	test   %dl,%dl
+ 5e5:	75 eb                	jne    5d2 <printf+0xec>
+      state = 0;
+ 5e7:	be 00 00 00 00       	mov    $0x0,%esi
+ 5ec:	e9 21 ff ff ff       	jmp    512 <printf+0x2c>
+        putc(fd, *ap);
+ 5f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5f4:	0f be 17             	movsbl (%edi),%edx
+ 5f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fa:	e8 42 fe ff ff       	call   441 <putc>
+        ap++;
+ 5ff:	83 c7 04             	add    $0x4,%edi
+ 602:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 605:	be 00 00 00 00       	mov    $0x0,%esi
+ 60a:	e9 03 ff ff ff       	jmp    512 <printf+0x2c>
+        putc(fd, c);
+ 60f:	89 fa                	mov    %edi,%edx
+ 611:	8b 45 08             	mov    0x8(%ebp),%eax
+ 614:	e8 28 fe ff ff       	call   441 <putc>
+      state = 0;
+ 619:	be 00 00 00 00       	mov    $0x0,%esi
+ 61e:	e9 ef fe ff ff       	jmp    512 <printf+0x2c>
+        putc(fd, '%');
+ 623:	ba 25 00 00 00       	mov    $0x25,%edx
+ 628:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62b:	e8 11 fe ff ff       	call   441 <putc>
+        putc(fd, c);
+ 630:	89 fa                	mov    %edi,%edx
+ 632:	8b 45 08             	mov    0x8(%ebp),%eax
+ 635:	e8 07 fe ff ff       	call   441 <putc>
+      state = 0;
+ 63a:	be 00 00 00 00       	mov    $0x0,%esi
+ 63f:	e9 ce fe ff ff       	jmp    512 <printf+0x2c>
+    }
+  }
+}
+ 644:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 647:	5b                   	pop    %ebx
+ 648:	5e                   	pop    %esi
+ 649:	5f                   	pop    %edi
+ 64a:	5d                   	pop    %ebp
+ 64b:	c3                   	ret
+
+0000064c <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 64c:	55                   	push   %ebp
+ 64d:	89 e5                	mov    %esp,%ebp
+ 64f:	57                   	push   %edi
+ 650:	56                   	push   %esi
+ 651:	53                   	push   %ebx
+ 652:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 655:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 658:	a1 44 0b 00 00       	mov    0xb44,%eax
+ 65d:	eb 02                	jmp    661 <free+0x15>
+ 65f:	89 d0                	mov    %edx,%eax
+ 661:	39 c8                	cmp    %ecx,%eax
+ 663:	73 04                	jae    669 <free+0x1d>
+ 665:	3b 08                	cmp    (%eax),%ecx
+ 667:	72 12                	jb     67b <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 669:	8b 10                	mov    (%eax),%edx
+ 66b:	39 d0                	cmp    %edx,%eax
+ 66d:	72 f0                	jb     65f <free+0x13>
+ 66f:	39 c8                	cmp    %ecx,%eax
+ 671:	72 08                	jb     67b <free+0x2f>
+ 673:	39 d1                	cmp    %edx,%ecx
+ 675:	72 04                	jb     67b <free+0x2f>
+ 677:	89 d0                	mov    %edx,%eax
+ 679:	eb e6                	jmp    661 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 67b:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 67e:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 681:	8b 10                	mov    (%eax),%edx
+ 683:	39 d7                	cmp    %edx,%edi
+ 685:	74 19                	je     6a0 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 687:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 68a:	8b 50 04             	mov    0x4(%eax),%edx
+ 68d:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 690:	39 ce                	cmp    %ecx,%esi
+ 692:	74 1b                	je     6af <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 694:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 696:	a3 44 0b 00 00       	mov    %eax,0xb44
+}
+ 69b:	5b                   	pop    %ebx
+ 69c:	5e                   	pop    %esi
+ 69d:	5f                   	pop    %edi
+ 69e:	5d                   	pop    %ebp
+ 69f:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6a0:	03 72 04             	add    0x4(%edx),%esi
+ 6a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6a6:	8b 10                	mov    (%eax),%edx
+ 6a8:	8b 12                	mov    (%edx),%edx
+ 6aa:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 6ad:	eb db                	jmp    68a <free+0x3e>
+    p->s.size += bp->s.size;
+ 6af:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6b2:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6b5:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 6b8:	89 10                	mov    %edx,(%eax)
+ 6ba:	eb da                	jmp    696 <free+0x4a>
+
+000006bc <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6bc:	55                   	push   %ebp
+ 6bd:	89 e5                	mov    %esp,%ebp
+ 6bf:	53                   	push   %ebx
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 6c5:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 6ca:	77 05                	ja     6d1 <morecore+0x15>
+    nu = 4096;
+ 6cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6d1:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 6d8:	83 ec 0c             	sub    $0xc,%esp
+ 6db:	50                   	push   %eax
+ 6dc:	e8 e8 fc ff ff       	call   3c9 <sbrk>
+  if(p == (char*)-1)
+ 6e1:	83 c4 10             	add    $0x10,%esp
+ 6e4:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6e7:	74 1c                	je     705 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 6e9:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 6ec:	83 c0 08             	add    $0x8,%eax
+ 6ef:	83 ec 0c             	sub    $0xc,%esp
+ 6f2:	50                   	push   %eax
+ 6f3:	e8 54 ff ff ff       	call   64c <free>
+  return freep;
+ 6f8:	a1 44 0b 00 00       	mov    0xb44,%eax
+ 6fd:	83 c4 10             	add    $0x10,%esp
+}
+ 700:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 703:	c9                   	leave
+ 704:	c3                   	ret
+    return 0;
+ 705:	b8 00 00 00 00       	mov    $0x0,%eax
+ 70a:	eb f4                	jmp    700 <morecore+0x44>
+
+0000070c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 70c:	55                   	push   %ebp
+ 70d:	89 e5                	mov    %esp,%ebp
+ 70f:	53                   	push   %ebx
+ 710:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 713:	8b 45 08             	mov    0x8(%ebp),%eax
+ 716:	8d 58 07             	lea    0x7(%eax),%ebx
+ 719:	c1 eb 03             	shr    $0x3,%ebx
+ 71c:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 71f:	8b 0d 44 0b 00 00    	mov    0xb44,%ecx
+ 725:	85 c9                	test   %ecx,%ecx
+ 727:	74 04                	je     72d <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 729:	8b 01                	mov    (%ecx),%eax
+ 72b:	eb 4a                	jmp    777 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 72d:	c7 05 44 0b 00 00 48 	movl   $0xb48,0xb44
+ 734:	0b 00 00 
+ 737:	c7 05 48 0b 00 00 48 	movl   $0xb48,0xb48
+ 73e:	0b 00 00 
+    base.s.size = 0;
+ 741:	c7 05 4c 0b 00 00 00 	movl   $0x0,0xb4c
+ 748:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 74b:	b9 48 0b 00 00       	mov    $0xb48,%ecx
+ 750:	eb d7                	jmp    729 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 752:	74 19                	je     76d <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 754:	29 da                	sub    %ebx,%edx
+ 756:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 759:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 75c:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 75f:	89 0d 44 0b 00 00    	mov    %ecx,0xb44
+      return (void*)(p + 1);
+ 765:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 768:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 76b:	c9                   	leave
+ 76c:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 76d:	8b 10                	mov    (%eax),%edx
+ 76f:	89 11                	mov    %edx,(%ecx)
+ 771:	eb ec                	jmp    75f <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 773:	89 c1                	mov    %eax,%ecx
+ 775:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 777:	8b 50 04             	mov    0x4(%eax),%edx
+ 77a:	39 da                	cmp    %ebx,%edx
+ 77c:	73 d4                	jae    752 <malloc+0x46>
+    if(p == freep)
+ 77e:	39 05 44 0b 00 00    	cmp    %eax,0xb44
+ 784:	75 ed                	jne    773 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 786:	89 d8                	mov    %ebx,%eax
+ 788:	e8 2f ff ff ff       	call   6bc <morecore>
+ 78d:	85 c0                	test   %eax,%eax
+ 78f:	75 e2                	jne    773 <malloc+0x67>
+ 791:	eb d5                	jmp    768 <malloc+0x5c>
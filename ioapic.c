@@ -73,3 +73,12 @@ ioapicenable(int irq, int cpunum)
   ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
   ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
 }
+
+// Like ioapicenable, for a PCI INTx line: those are
+// level-triggered, active low, and may be shared.
+void
+ioapicenablepci(int irq, int cpunum)
+{
+  ioapicwrite(REG_TABLE+2*irq, INT_LEVEL | INT_ACTIVELOW | (T_IRQ0 + irq));
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+}
@@ -21,8 +21,34 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  int nfree;            // pages on freelist
 } kmem;
 
+// Per-CPU caches of free pages. kalloc() and kfree() work on the
+// current CPU's cache and go to kmem (under kmem.lock) only to
+// refill an empty cache or drain a full one, KBATCH pages at a
+// time. A cache's lock is only contended when kalloc() has run
+// out everywhere else and empties the other CPUs' caches.
+// Lock order: a kcache lock, then kmem.lock.
+#define KCACHE 64
+#define KBATCH 32
+
+struct kcache {
+  struct spinlock lock;
+  struct run *freelist;
+  int n;
+} __attribute__ ((aligned (64)));
+
+static struct kcache kcache[NCPU];
+
+// Number of references to each physical page, for pages shared
+// copy-on-write between processes after fork. kalloc() hands out
+// a page with one reference and kfree() only frees it when the
+// last one is dropped.
+static ushort kref[PHYSTOP/PGSIZE];
+
+#define KREF(v) kref[V2P(v)/PGSIZE]
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -31,7 +57,11 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
+  struct kcache *c;
+
   initlock(&kmem.lock, "kmem");
+  for(c = kcache; c < &kcache[NCPU]; c++)
+    initlock(&c->lock, "kcache");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -48,32 +78,147 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    KREF(p) = 1;
     kfree(p);
+  }
+}
+
+// Add a reference to the page at v.
+void
+kincref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kincref");
+  __sync_fetch_and_add(&KREF(v), 1);
+}
+
+int
+krefcount(char *v)
+{
+  return KREF(v);
 }
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
+// Drop a reference to the page of physical memory pointed at
+// by v, and free it if that was the last one. v normally
+// should have been returned by a call to kalloc().  (The
+// exception is when initializing the allocator; see kinit above.)
 void
 kfree(char *v)
 {
-  struct run *r;
+  struct run *r, *head, *tail;
+  struct kcache *c;
+  int i;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
+  if(KREF(v) == 0)
+    panic("kfree: free page");
+  if(__sync_sub_and_fetch(&KREF(v), 1) > 0)
+    return;
 
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
+  if(!kmem.use_lock){
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+    return;
+  }
+
+  pushcli();
+  c = &kcache[cpuid()];
+  acquire(&c->lock);
+  r->next = c->freelist;
+  c->freelist = r;
+  if(++c->n > KCACHE){
+    // Hand a batch back to the global pool.
+    for(head = tail = c->freelist, i = 1; i < KBATCH; i++)
+      tail = tail->next;
+    c->freelist = tail->next;
+    c->n -= KBATCH;
+    acquire(&kmem.lock);
+    tail->next = kmem.freelist;
+    kmem.freelist = head;
+    kmem.nfree += KBATCH;
     release(&kmem.lock);
+  }
+  release(&c->lock);
+  popcli();
+}
+
+static char*
+kalloc1(void)
+{
+  struct run *r;
+  struct kcache *c;
+
+  if(!kmem.use_lock){
+    r = kmem.freelist;
+    if(r){
+      kmem.freelist = r->next;
+      kmem.nfree--;
+      KREF(r) = 1;
+    }
+    return (char*)r;
+  }
+
+  pushcli();
+  c = &kcache[cpuid()];
+  acquire(&c->lock);
+  if(c->freelist == 0){
+    // Refill with up to a batch from the global pool.
+    acquire(&kmem.lock);
+    while(c->n < KBATCH && (r = kmem.freelist) != 0){
+      kmem.freelist = r->next;
+      kmem.nfree--;
+      r->next = c->freelist;
+      c->freelist = r;
+      c->n++;
+    }
+    release(&kmem.lock);
+  }
+  r = c->freelist;
+  if(r){
+    c->freelist = r->next;
+    c->n--;
+    KREF(r) = 1;
+  }
+  release(&c->lock);
+  popcli();
+  return (char*)r;
+}
+
+// Move the pages cached by every CPU back to kmem, so a CPU that
+// has run dry can use pages the others are holding on to.
+// Returns the number of pages moved.
+static int
+kdrain(void)
+{
+  struct kcache *c;
+  struct run *r;
+  int n;
+
+  n = 0;
+  for(c = kcache; c < &kcache[NCPU]; c++){
+    if(c->n == 0)
+      continue;
+    acquire(&c->lock);
+    acquire(&kmem.lock);
+    while((r = c->freelist) != 0){
+      c->freelist = r->next;
+      r->next = kmem.freelist;
+      kmem.freelist = r;
+      n++;
+    }
+    kmem.nfree += c->n;
+    c->n = 0;
+    release(&kmem.lock);
+    release(&c->lock);
+  }
+  return n;
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -82,15 +227,26 @@ kfree(char *v)
 char*
 kalloc(void)
 {
-  struct run *r;
+  char *r;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
-  return (char*)r;
+  // When out of pages, take back the other CPUs' cached pages,
+  // and failing that ask the buffer cache to give some back.
+  if((r = kalloc1()) == 0 && kmem.use_lock &&
+     (kdrain() > 0 || breclaim() == 0))
+    r = kalloc1();
+  return r;
 }
 
+// Approximate number of free pages, for deciding when memory
+// is getting short. Counts other CPUs' caches without locking.
+int
+kfreepages(void)
+{
+  struct kcache *c;
+  int n;
+
+  n = kmem.nfree;
+  for(c = kcache; c < &kcache[NCPU]; c++)
+    n += c->n;
+  return n;
+}
@@ -0,0 +1,23835 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 e0 10 00       	mov    $0x10e000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc 10 60 14 80       	mov    $0x80146010,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 51 55 10 80       	mov    $0x80105551,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+
+80100034 <bhash>:
+} bcache;
+
+static struct bucket*
+bhash(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev ^ blockno) % NBUCKET];
+80100034:	31 d0                	xor    %edx,%eax
+80100036:	89 c1                	mov    %eax,%ecx
+80100038:	ba cf 25 16 35       	mov    $0x351625cf,%edx
+8010003d:	f7 e2                	mul    %edx
+8010003f:	89 c8                	mov    %ecx,%eax
+80100041:	29 d0                	sub    %edx,%eax
+80100043:	d1 e8                	shr    %eax
+80100045:	01 c2                	add    %eax,%edx
+80100047:	c1 ea 0c             	shr    $0xc,%edx
+8010004a:	69 c2 81 1a 00 00    	imul   $0x1a81,%edx,%eax
+80100050:	29 c1                	sub    %eax,%ecx
+80100052:	8d 04 8d 64 0c 11 80 	lea    -0x7feef39c(,%ecx,4),%eax
+}
+80100059:	c3                   	ret
+
+8010005a <block>:
+
+static struct spinlock*
+block(struct bucket *bk)
+{
+8010005a:	55                   	push   %ebp
+8010005b:	89 e5                	mov    %esp,%ebp
+8010005d:	53                   	push   %ebx
+  return &bcache.block[(bk - bcache.bucket) % NBLOCK];
+8010005e:	2d 64 0c 11 80       	sub    $0x80110c64,%eax
+80100063:	89 c3                	mov    %eax,%ebx
+80100065:	89 c1                	mov    %eax,%ecx
+80100067:	c1 f9 02             	sar    $0x2,%ecx
+8010006a:	ba 3f c5 25 43       	mov    $0x4325c53f,%edx
+8010006f:	89 c8                	mov    %ecx,%eax
+80100071:	f7 ea                	imul   %edx
+80100073:	c1 fa 04             	sar    $0x4,%edx
+80100076:	c1 fb 1f             	sar    $0x1f,%ebx
+80100079:	29 da                	sub    %ebx,%edx
+8010007b:	6b c2 3d             	imul   $0x3d,%edx,%eax
+8010007e:	29 c1                	sub    %eax,%ecx
+80100080:	6b d1 34             	imul   $0x34,%ecx,%edx
+80100083:	8d 82 00 00 11 80    	lea    -0x7fef0000(%edx),%eax
+}
+80100089:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010008c:	c9                   	leave
+8010008d:	c3                   	ret
+
+8010008e <bslabof>:
+
+// The slab header is the page the buffer's header lives in.
+static struct bslab*
+bslabof(struct buf *b)
+{
+  return (struct bslab*)PGROUNDDOWN((uint)b);
+8010008e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+}
+80100093:	c3                   	ret
+
+80100094 <idleinc>:
+
+// b has just gone on the LRU list. Caller must hold lrulock.
+static void
+idleinc(struct buf *b)
+{
+80100094:	55                   	push   %ebp
+80100095:	89 e5                	mov    %esp,%ebp
+80100097:	83 ec 08             	sub    $0x8,%esp
+  struct bslab *s = bslabof(b);
+8010009a:	e8 ef ff ff ff       	call   8010008e <bslabof>
+
+  if(++s->nidle < BSLABBUFS)
+8010009f:	8b 48 0c             	mov    0xc(%eax),%ecx
+801000a2:	8d 51 01             	lea    0x1(%ecx),%edx
+801000a5:	89 50 0c             	mov    %edx,0xc(%eax)
+801000a8:	83 fa 0f             	cmp    $0xf,%edx
+801000ab:	7e 1f                	jle    801000cc <idleinc+0x38>
+    return;
+  if(bcache.idle == 0){
+801000ad:	8b 15 40 77 11 80    	mov    0x80117740,%edx
+801000b3:	85 d2                	test   %edx,%edx
+801000b5:	74 17                	je     801000ce <idleinc+0x3a>
+    s->inext = s->iprev = s;
+    bcache.idle = s;
+  } else {
+    s->inext = bcache.idle;
+801000b7:	89 50 04             	mov    %edx,0x4(%eax)
+    s->iprev = bcache.idle->iprev;
+801000ba:	8b 52 08             	mov    0x8(%edx),%edx
+801000bd:	89 50 08             	mov    %edx,0x8(%eax)
+    s->iprev->inext = s;
+801000c0:	89 42 04             	mov    %eax,0x4(%edx)
+    bcache.idle->iprev = s;
+801000c3:	8b 15 40 77 11 80    	mov    0x80117740,%edx
+801000c9:	89 42 08             	mov    %eax,0x8(%edx)
+  }
+}
+801000cc:	c9                   	leave
+801000cd:	c3                   	ret
+    s->inext = s->iprev = s;
+801000ce:	89 40 08             	mov    %eax,0x8(%eax)
+801000d1:	89 40 04             	mov    %eax,0x4(%eax)
+    bcache.idle = s;
+801000d4:	a3 40 77 11 80       	mov    %eax,0x80117740
+801000d9:	eb f1                	jmp    801000cc <idleinc+0x38>
+
+801000db <idledec>:
+
+// b has just come off the LRU list. Caller must hold lrulock.
+static void
+idledec(struct buf *b)
+{
+801000db:	55                   	push   %ebp
+801000dc:	89 e5                	mov    %esp,%ebp
+801000de:	83 ec 08             	sub    $0x8,%esp
+  struct bslab *s = bslabof(b);
+801000e1:	e8 a8 ff ff ff       	call   8010008e <bslabof>
+
+  if(s->nidle-- < BSLABBUFS)
+801000e6:	8b 50 0c             	mov    0xc(%eax),%edx
+801000e9:	8d 4a ff             	lea    -0x1(%edx),%ecx
+801000ec:	89 48 0c             	mov    %ecx,0xc(%eax)
+801000ef:	83 fa 0f             	cmp    $0xf,%edx
+801000f2:	7e 1b                	jle    8010010f <idledec+0x34>
+    return;
+  if(s->inext == s)
+801000f4:	8b 50 04             	mov    0x4(%eax),%edx
+801000f7:	39 c2                	cmp    %eax,%edx
+801000f9:	74 16                	je     80100111 <idledec+0x36>
+    bcache.idle = 0;
+  else {
+    s->iprev->inext = s->inext;
+801000fb:	8b 48 08             	mov    0x8(%eax),%ecx
+801000fe:	89 51 04             	mov    %edx,0x4(%ecx)
+    s->inext->iprev = s->iprev;
+80100101:	8b 48 08             	mov    0x8(%eax),%ecx
+80100104:	89 4a 08             	mov    %ecx,0x8(%edx)
+    if(bcache.idle == s)
+80100107:	39 05 40 77 11 80    	cmp    %eax,0x80117740
+8010010d:	74 0e                	je     8010011d <idledec+0x42>
+      bcache.idle = s->inext;
+  }
+}
+8010010f:	c9                   	leave
+80100110:	c3                   	ret
+    bcache.idle = 0;
+80100111:	c7 05 40 77 11 80 00 	movl   $0x0,0x80117740
+80100118:	00 00 00 
+8010011b:	eb f2                	jmp    8010010f <idledec+0x34>
+      bcache.idle = s->inext;
+8010011d:	8b 40 04             	mov    0x4(%eax),%eax
+80100120:	a3 40 77 11 80       	mov    %eax,0x80117740
+80100125:	eb e8                	jmp    8010010f <idledec+0x34>
+
+80100127 <unhash>:
+static void
+unhash(struct bucket *bk, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+80100127:	eb 03                	jmp    8010012c <unhash+0x5>
+80100129:	8d 41 58             	lea    0x58(%ecx),%eax
+8010012c:	8b 08                	mov    (%eax),%ecx
+8010012e:	85 c9                	test   %ecx,%ecx
+80100130:	74 0a                	je     8010013c <unhash+0x15>
+    if(*pp == b){
+80100132:	39 d1                	cmp    %edx,%ecx
+80100134:	75 f3                	jne    80100129 <unhash+0x2>
+      *pp = b->hnext;
+80100136:	8b 52 58             	mov    0x58(%edx),%edx
+80100139:	89 10                	mov    %edx,(%eax)
+      break;
+8010013b:	c3                   	ret
+    }
+  }
+}
+8010013c:	c3                   	ret
+
+8010013d <lruaddtail>:
+{
+8010013d:	55                   	push   %ebp
+8010013e:	89 e5                	mov    %esp,%ebp
+80100140:	53                   	push   %ebx
+80100141:	83 ec 10             	sub    $0x10,%esp
+80100144:	89 c3                	mov    %eax,%ebx
+  acquire(&bcache.lrulock);
+80100146:	68 a8 76 11 80       	push   $0x801176a8
+8010014b:	e8 92 84 00 00       	call   801085e2 <acquire>
+  b->prev = bcache.head.prev;
+80100150:	a1 2c 77 11 80       	mov    0x8011772c,%eax
+80100155:	89 43 50             	mov    %eax,0x50(%ebx)
+  b->next = &bcache.head;
+80100158:	c7 43 54 dc 76 11 80 	movl   $0x801176dc,0x54(%ebx)
+  bcache.head.prev->next = b;
+8010015f:	a1 2c 77 11 80       	mov    0x8011772c,%eax
+80100164:	89 58 54             	mov    %ebx,0x54(%eax)
+  bcache.head.prev = b;
+80100167:	89 1d 2c 77 11 80    	mov    %ebx,0x8011772c
+  idleinc(b);
+8010016d:	89 d8                	mov    %ebx,%eax
+8010016f:	e8 20 ff ff ff       	call   80100094 <idleinc>
+  release(&bcache.lrulock);
+80100174:	c7 04 24 a8 76 11 80 	movl   $0x801176a8,(%esp)
+8010017b:	e8 c7 84 00 00       	call   80108647 <release>
+}
+80100180:	83 c4 10             	add    $0x10,%esp
+80100183:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100186:	c9                   	leave
+80100187:	c3                   	ret
+
+80100188 <bslabadd>:
+
+// Add slab s to the cache.
+// Caller must hold evictlock, except during binit.
+static void
+bslabadd(struct bslab *s)
+{
+80100188:	55                   	push   %ebp
+80100189:	89 e5                	mov    %esp,%ebp
+8010018b:	56                   	push   %esi
+8010018c:	53                   	push   %ebx
+8010018d:	89 c6                	mov    %eax,%esi
+  int i;
+
+  for(i = 0; i < BSLABBUFS; i++)
+8010018f:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100194:	eb 0f                	jmp    801001a5 <bslabadd+0x1d>
+    lruaddtail(&s->buf[i]);
+80100196:	6b c3 64             	imul   $0x64,%ebx,%eax
+80100199:	8d 44 06 50          	lea    0x50(%esi,%eax,1),%eax
+8010019d:	e8 9b ff ff ff       	call   8010013d <lruaddtail>
+  for(i = 0; i < BSLABBUFS; i++)
+801001a2:	83 c3 01             	add    $0x1,%ebx
+801001a5:	83 fb 0f             	cmp    $0xf,%ebx
+801001a8:	7e ec                	jle    80100196 <bslabadd+0xe>
+  s->next = bcache.slabs;
+801001aa:	a1 9c 76 11 80       	mov    0x8011769c,%eax
+801001af:	89 06                	mov    %eax,(%esi)
+  bcache.slabs = s;
+801001b1:	89 35 9c 76 11 80    	mov    %esi,0x8011769c
+  bcache.nslab++;
+801001b7:	a1 a0 76 11 80       	mov    0x801176a0,%eax
+801001bc:	83 c0 01             	add    $0x1,%eax
+801001bf:	a3 a0 76 11 80       	mov    %eax,0x801176a0
+}
+801001c4:	5b                   	pop    %ebx
+801001c5:	5e                   	pop    %esi
+801001c6:	5d                   	pop    %ebp
+801001c7:	c3                   	ret
+
+801001c8 <lruremove>:
+{
+801001c8:	55                   	push   %ebp
+801001c9:	89 e5                	mov    %esp,%ebp
+801001cb:	53                   	push   %ebx
+801001cc:	83 ec 10             	sub    $0x10,%esp
+801001cf:	89 c3                	mov    %eax,%ebx
+  acquire(&bcache.lrulock);
+801001d1:	68 a8 76 11 80       	push   $0x801176a8
+801001d6:	e8 07 84 00 00       	call   801085e2 <acquire>
+  b->next->prev = b->prev;
+801001db:	8b 53 54             	mov    0x54(%ebx),%edx
+801001de:	8b 43 50             	mov    0x50(%ebx),%eax
+801001e1:	89 42 50             	mov    %eax,0x50(%edx)
+  b->prev->next = b->next;
+801001e4:	8b 53 54             	mov    0x54(%ebx),%edx
+801001e7:	89 50 54             	mov    %edx,0x54(%eax)
+  idledec(b);
+801001ea:	89 d8                	mov    %ebx,%eax
+801001ec:	e8 ea fe ff ff       	call   801000db <idledec>
+  release(&bcache.lrulock);
+801001f1:	c7 04 24 a8 76 11 80 	movl   $0x801176a8,(%esp)
+801001f8:	e8 4a 84 00 00       	call   80108647 <release>
+}
+801001fd:	83 c4 10             	add    $0x10,%esp
+80100200:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100203:	c9                   	leave
+80100204:	c3                   	ret
+
+80100205 <blookup>:
+
+// Find the buffer for dev/blockno in bk and take a reference
+// to it. Caller must hold block(bk).
+static struct buf*
+blookup(struct bucket *bk, uint dev, uint blockno)
+{
+80100205:	55                   	push   %ebp
+80100206:	89 e5                	mov    %esp,%ebp
+80100208:	53                   	push   %ebx
+80100209:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext){
+8010020c:	8b 18                	mov    (%eax),%ebx
+8010020e:	eb 0c                	jmp    8010021c <blookup+0x17>
+    if(b->dev == dev && b->blockno == blockno){
+      if(b->refcnt++ == 0)
+        lruremove(b);
+80100210:	89 d8                	mov    %ebx,%eax
+80100212:	e8 b1 ff ff ff       	call   801001c8 <lruremove>
+      return b;
+80100217:	eb 1e                	jmp    80100237 <blookup+0x32>
+  for(b = bk->head; b; b = b->hnext){
+80100219:	8b 5b 58             	mov    0x58(%ebx),%ebx
+8010021c:	85 db                	test   %ebx,%ebx
+8010021e:	74 17                	je     80100237 <blookup+0x32>
+    if(b->dev == dev && b->blockno == blockno){
+80100220:	39 53 04             	cmp    %edx,0x4(%ebx)
+80100223:	75 f4                	jne    80100219 <blookup+0x14>
+80100225:	39 4b 08             	cmp    %ecx,0x8(%ebx)
+80100228:	75 ef                	jne    80100219 <blookup+0x14>
+      if(b->refcnt++ == 0)
+8010022a:	8b 43 4c             	mov    0x4c(%ebx),%eax
+8010022d:	8d 50 01             	lea    0x1(%eax),%edx
+80100230:	89 53 4c             	mov    %edx,0x4c(%ebx)
+80100233:	85 c0                	test   %eax,%eax
+80100235:	74 d9                	je     80100210 <blookup+0xb>
+    }
+  }
+  return 0;
+}
+80100237:	89 d8                	mov    %ebx,%eax
+80100239:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010023c:	c9                   	leave
+8010023d:	c3                   	ret
+
+8010023e <bslabfree>:
+{
+8010023e:	55                   	push   %ebp
+8010023f:	89 e5                	mov    %esp,%ebp
+80100241:	57                   	push   %edi
+80100242:	56                   	push   %esi
+80100243:	53                   	push   %ebx
+80100244:	83 ec 1c             	sub    $0x1c,%esp
+80100247:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < BSLABBUFS; i++)
+80100249:	b8 00 00 00 00       	mov    $0x0,%eax
+8010024e:	83 f8 0f             	cmp    $0xf,%eax
+80100251:	7f 21                	jg     80100274 <bslabfree+0x36>
+    if(s->buf[i].refcnt || (s->buf[i].flags & (B_DIRTY|B_ASYNC)))
+80100253:	6b d0 64             	imul   $0x64,%eax,%edx
+80100256:	83 bc 13 9c 00 00 00 	cmpl   $0x0,0x9c(%ebx,%edx,1)
+8010025d:	00 
+8010025e:	0f 85 06 01 00 00    	jne    8010036a <bslabfree+0x12c>
+80100264:	f6 44 13 50 0c       	testb  $0xc,0x50(%ebx,%edx,1)
+80100269:	0f 85 08 01 00 00    	jne    80100377 <bslabfree+0x139>
+  for(i = 0; i < BSLABBUFS; i++)
+8010026f:	83 c0 01             	add    $0x1,%eax
+80100272:	eb da                	jmp    8010024e <bslabfree+0x10>
+  for(i = 0; i < BSLABBUFS; i++){
+80100274:	bf 00 00 00 00       	mov    $0x0,%edi
+80100279:	83 ff 0f             	cmp    $0xf,%edi
+8010027c:	0f 8f c1 00 00 00    	jg     80100343 <bslabfree+0x105>
+    b = &s->buf[i];
+80100282:	6b f7 64             	imul   $0x64,%edi,%esi
+80100285:	8d 44 33 50          	lea    0x50(%ebx,%esi,1),%eax
+80100289:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    bk = bhash(b->dev, b->blockno);
+8010028c:	01 de                	add    %ebx,%esi
+8010028e:	8b 56 58             	mov    0x58(%esi),%edx
+80100291:	8b 46 54             	mov    0x54(%esi),%eax
+80100294:	e8 9b fd ff ff       	call   80100034 <bhash>
+80100299:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    acquire(block(bk));
+8010029c:	e8 b9 fd ff ff       	call   8010005a <block>
+801002a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801002a4:	83 ec 0c             	sub    $0xc,%esp
+801002a7:	50                   	push   %eax
+801002a8:	e8 35 83 00 00       	call   801085e2 <acquire>
+    if(b->refcnt || (b->flags & (B_DIRTY|B_ASYNC))){
+801002ad:	83 c4 10             	add    $0x10,%esp
+801002b0:	83 be 9c 00 00 00 00 	cmpl   $0x0,0x9c(%esi)
+801002b7:	75 3f                	jne    801002f8 <bslabfree+0xba>
+801002b9:	6b c7 64             	imul   $0x64,%edi,%eax
+801002bc:	f6 44 03 50 0c       	testb  $0xc,0x50(%ebx,%eax,1)
+801002c1:	75 35                	jne    801002f8 <bslabfree+0xba>
+    unhash(bk, b);
+801002c3:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801002c6:	89 f2                	mov    %esi,%edx
+801002c8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801002cb:	e8 57 fe ff ff       	call   80100127 <unhash>
+    lruremove(b);
+801002d0:	89 f0                	mov    %esi,%eax
+801002d2:	e8 f1 fe ff ff       	call   801001c8 <lruremove>
+    b->refcnt = 1;
+801002d7:	6b c7 64             	imul   $0x64,%edi,%eax
+801002da:	c7 84 03 9c 00 00 00 	movl   $0x1,0x9c(%ebx,%eax,1)
+801002e1:	01 00 00 00 
+    release(block(bk));
+801002e5:	83 ec 0c             	sub    $0xc,%esp
+801002e8:	ff 75 e4             	push   -0x1c(%ebp)
+801002eb:	e8 57 83 00 00       	call   80108647 <release>
+  for(i = 0; i < BSLABBUFS; i++){
+801002f0:	83 c7 01             	add    $0x1,%edi
+801002f3:	83 c4 10             	add    $0x10,%esp
+801002f6:	eb 81                	jmp    80100279 <bslabfree+0x3b>
+      release(block(bk));
+801002f8:	83 ec 0c             	sub    $0xc,%esp
+801002fb:	ff 75 e4             	push   -0x1c(%ebp)
+801002fe:	e8 44 83 00 00       	call   80108647 <release>
+      for(j = 0; j < i; j++){
+80100303:	83 c4 10             	add    $0x10,%esp
+80100306:	be 00 00 00 00       	mov    $0x0,%esi
+8010030b:	eb 2b                	jmp    80100338 <bslabfree+0xfa>
+        b = &s->buf[j];
+8010030d:	6b c6 64             	imul   $0x64,%esi,%eax
+80100310:	8d 54 03 50          	lea    0x50(%ebx,%eax,1),%edx
+        b->dev = BNODEV;
+80100314:	01 d8                	add    %ebx,%eax
+80100316:	c7 40 54 ff ff ff ff 	movl   $0xffffffff,0x54(%eax)
+        b->flags = 0;
+8010031d:	c7 40 50 00 00 00 00 	movl   $0x0,0x50(%eax)
+        b->refcnt = 0;
+80100324:	c7 80 9c 00 00 00 00 	movl   $0x0,0x9c(%eax)
+8010032b:	00 00 00 
+        lruaddtail(b);
+8010032e:	89 d0                	mov    %edx,%eax
+80100330:	e8 08 fe ff ff       	call   8010013d <lruaddtail>
+      for(j = 0; j < i; j++){
+80100335:	83 c6 01             	add    $0x1,%esi
+80100338:	39 f7                	cmp    %esi,%edi
+8010033a:	7f d1                	jg     8010030d <bslabfree+0xcf>
+      return -1;
+8010033c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100341:	eb 2c                	jmp    8010036f <bslabfree+0x131>
+  for(ss = &bcache.slabs; *ss != s; ss = &(*ss)->next)
+80100343:	ba 9c 76 11 80       	mov    $0x8011769c,%edx
+80100348:	eb 02                	jmp    8010034c <bslabfree+0x10e>
+8010034a:	89 c2                	mov    %eax,%edx
+8010034c:	8b 02                	mov    (%edx),%eax
+8010034e:	39 d8                	cmp    %ebx,%eax
+80100350:	75 f8                	jne    8010034a <bslabfree+0x10c>
+  *ss = s->next;
+80100352:	8b 03                	mov    (%ebx),%eax
+80100354:	89 02                	mov    %eax,(%edx)
+  bcache.nslab--;
+80100356:	a1 a0 76 11 80       	mov    0x801176a0,%eax
+8010035b:	83 e8 01             	sub    $0x1,%eax
+8010035e:	a3 a0 76 11 80       	mov    %eax,0x801176a0
+  return 0;
+80100363:	b8 00 00 00 00       	mov    $0x0,%eax
+80100368:	eb 05                	jmp    8010036f <bslabfree+0x131>
+      return -1;
+8010036a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010036f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100372:	5b                   	pop    %ebx
+80100373:	5e                   	pop    %esi
+80100374:	5f                   	pop    %edi
+80100375:	5d                   	pop    %ebp
+80100376:	c3                   	ret
+      return -1;
+80100377:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010037c:	eb f1                	jmp    8010036f <bslabfree+0x131>
+
+8010037e <bshrink>:
+{
+8010037e:	55                   	push   %ebp
+8010037f:	89 e5                	mov    %esp,%ebp
+80100381:	53                   	push   %ebx
+80100382:	83 ec 04             	sub    $0x4,%esp
+  if(bcache.nslab <= BMINSLAB)
+80100385:	83 3d a0 76 11 80 03 	cmpl   $0x3,0x801176a0
+8010038c:	7e 71                	jle    801003ff <bshrink+0x81>
+  acquire(&bcache.lrulock);
+8010038e:	83 ec 0c             	sub    $0xc,%esp
+80100391:	68 a8 76 11 80       	push   $0x801176a8
+80100396:	e8 47 82 00 00       	call   801085e2 <acquire>
+  s = bcache.idle;
+8010039b:	8b 1d 40 77 11 80    	mov    0x80117740,%ebx
+  release(&bcache.lrulock);
+801003a1:	c7 04 24 a8 76 11 80 	movl   $0x801176a8,(%esp)
+801003a8:	e8 9a 82 00 00       	call   80108647 <release>
+  if(s == 0)
+801003ad:	83 c4 10             	add    $0x10,%esp
+801003b0:	85 db                	test   %ebx,%ebx
+801003b2:	74 0b                	je     801003bf <bshrink+0x41>
+  if(bslabfree(s) == 0)
+801003b4:	89 d8                	mov    %ebx,%eax
+801003b6:	e8 83 fe ff ff       	call   8010023e <bslabfree>
+801003bb:	85 c0                	test   %eax,%eax
+801003bd:	75 07                	jne    801003c6 <bshrink+0x48>
+}
+801003bf:	89 d8                	mov    %ebx,%eax
+801003c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801003c4:	c9                   	leave
+801003c5:	c3                   	ret
+  acquire(&bcache.lrulock);
+801003c6:	83 ec 0c             	sub    $0xc,%esp
+801003c9:	68 a8 76 11 80       	push   $0x801176a8
+801003ce:	e8 0f 82 00 00       	call   801085e2 <acquire>
+  if(bcache.idle == s)
+801003d3:	83 c4 10             	add    $0x10,%esp
+801003d6:	39 1d 40 77 11 80    	cmp    %ebx,0x80117740
+801003dc:	74 17                	je     801003f5 <bshrink+0x77>
+  release(&bcache.lrulock);
+801003de:	83 ec 0c             	sub    $0xc,%esp
+801003e1:	68 a8 76 11 80       	push   $0x801176a8
+801003e6:	e8 5c 82 00 00       	call   80108647 <release>
+  return 0;
+801003eb:	83 c4 10             	add    $0x10,%esp
+801003ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+801003f3:	eb ca                	jmp    801003bf <bshrink+0x41>
+    bcache.idle = s->inext;
+801003f5:	8b 43 04             	mov    0x4(%ebx),%eax
+801003f8:	a3 40 77 11 80       	mov    %eax,0x80117740
+801003fd:	eb df                	jmp    801003de <bshrink+0x60>
+    return 0;
+801003ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100404:	eb b9                	jmp    801003bf <bshrink+0x41>
+
+80100406 <lruadd>:
+{
+80100406:	55                   	push   %ebp
+80100407:	89 e5                	mov    %esp,%ebp
+80100409:	53                   	push   %ebx
+8010040a:	83 ec 10             	sub    $0x10,%esp
+8010040d:	89 c3                	mov    %eax,%ebx
+  acquire(&bcache.lrulock);
+8010040f:	68 a8 76 11 80       	push   $0x801176a8
+80100414:	e8 c9 81 00 00       	call   801085e2 <acquire>
+  b->next = bcache.head.next;
+80100419:	a1 30 77 11 80       	mov    0x80117730,%eax
+8010041e:	89 43 54             	mov    %eax,0x54(%ebx)
+  b->prev = &bcache.head;
+80100421:	c7 43 50 dc 76 11 80 	movl   $0x801176dc,0x50(%ebx)
+  bcache.head.next->prev = b;
+80100428:	a1 30 77 11 80       	mov    0x80117730,%eax
+8010042d:	89 58 50             	mov    %ebx,0x50(%eax)
+  bcache.head.next = b;
+80100430:	89 1d 30 77 11 80    	mov    %ebx,0x80117730
+  idleinc(b);
+80100436:	89 d8                	mov    %ebx,%eax
+80100438:	e8 57 fc ff ff       	call   80100094 <idleinc>
+  release(&bcache.lrulock);
+8010043d:	c7 04 24 a8 76 11 80 	movl   $0x801176a8,(%esp)
+80100444:	e8 fe 81 00 00       	call   80108647 <release>
+}
+80100449:	83 c4 10             	add    $0x10,%esp
+8010044c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010044f:	c9                   	leave
+80100450:	c3                   	ret
+
+80100451 <bslabrelease>:
+{
+80100451:	55                   	push   %ebp
+80100452:	89 e5                	mov    %esp,%ebp
+80100454:	56                   	push   %esi
+80100455:	53                   	push   %ebx
+80100456:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BSLABPAGES; i++)
+80100458:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010045d:	eb 12                	jmp    80100471 <bslabrelease+0x20>
+    kfree(s->page[i]);
+8010045f:	83 ec 0c             	sub    $0xc,%esp
+80100462:	ff 74 9e 10          	push   0x10(%esi,%ebx,4)
+80100466:	e8 a6 44 00 00       	call   80104911 <kfree>
+  for(i = 0; i < BSLABPAGES; i++)
+8010046b:	83 c3 01             	add    $0x1,%ebx
+8010046e:	83 c4 10             	add    $0x10,%esp
+80100471:	83 fb 0f             	cmp    $0xf,%ebx
+80100474:	7e e9                	jle    8010045f <bslabrelease+0xe>
+  kfree((char*)s);
+80100476:	83 ec 0c             	sub    $0xc,%esp
+80100479:	56                   	push   %esi
+8010047a:	e8 92 44 00 00       	call   80104911 <kfree>
+}
+8010047f:	83 c4 10             	add    $0x10,%esp
+80100482:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100485:	5b                   	pop    %ebx
+80100486:	5e                   	pop    %esi
+80100487:	5d                   	pop    %ebp
+80100488:	c3                   	ret
+
+80100489 <bslaballoc>:
+{
+80100489:	55                   	push   %ebp
+8010048a:	89 e5                	mov    %esp,%ebp
+8010048c:	57                   	push   %edi
+8010048d:	56                   	push   %esi
+8010048e:	53                   	push   %ebx
+8010048f:	83 ec 0c             	sub    $0xc,%esp
+  if((s = (struct bslab*)kalloc()) == 0)
+80100492:	e8 99 46 00 00       	call   80104b30 <kalloc>
+80100497:	89 c6                	mov    %eax,%esi
+80100499:	85 c0                	test   %eax,%eax
+8010049b:	0f 84 8f 00 00 00    	je     80100530 <bslaballoc+0xa7>
+  memset(s, 0, sizeof(*s));
+801004a1:	83 ec 04             	sub    $0x4,%esp
+801004a4:	68 90 06 00 00       	push   $0x690
+801004a9:	6a 00                	push   $0x0
+801004ab:	50                   	push   %eax
+801004ac:	e8 dd 81 00 00       	call   8010868e <memset>
+  for(i = 0; i < BSLABPAGES; i++){
+801004b1:	83 c4 10             	add    $0x10,%esp
+801004b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+801004b9:	83 fb 0f             	cmp    $0xf,%ebx
+801004bc:	7f 38                	jg     801004f6 <bslaballoc+0x6d>
+    if((s->page[i] = kalloc()) == 0){
+801004be:	e8 6d 46 00 00       	call   80104b30 <kalloc>
+801004c3:	89 c7                	mov    %eax,%edi
+801004c5:	89 44 9e 10          	mov    %eax,0x10(%esi,%ebx,4)
+801004c9:	85 c0                	test   %eax,%eax
+801004cb:	74 14                	je     801004e1 <bslaballoc+0x58>
+  for(i = 0; i < BSLABPAGES; i++){
+801004cd:	83 c3 01             	add    $0x1,%ebx
+801004d0:	eb e7                	jmp    801004b9 <bslaballoc+0x30>
+        kfree(s->page[i]);
+801004d2:	83 ec 0c             	sub    $0xc,%esp
+801004d5:	ff 74 9e 10          	push   0x10(%esi,%ebx,4)
+801004d9:	e8 33 44 00 00       	call   80104911 <kfree>
+801004de:	83 c4 10             	add    $0x10,%esp
+      while(--i >= 0)
+801004e1:	83 eb 01             	sub    $0x1,%ebx
+801004e4:	79 ec                	jns    801004d2 <bslaballoc+0x49>
+      kfree((char*)s);
+801004e6:	83 ec 0c             	sub    $0xc,%esp
+801004e9:	56                   	push   %esi
+801004ea:	e8 22 44 00 00       	call   80104911 <kfree>
+      return 0;
+801004ef:	83 c4 10             	add    $0x10,%esp
+801004f2:	89 fe                	mov    %edi,%esi
+801004f4:	eb 3a                	jmp    80100530 <bslaballoc+0xa7>
+  for(i = 0; i < BSLABBUFS; i++){
+801004f6:	bf 00 00 00 00       	mov    $0x0,%edi
+801004fb:	eb 2e                	jmp    8010052b <bslaballoc+0xa2>
+    initsleeplock(&b->lock, "buffer");
+801004fd:	83 ec 08             	sub    $0x8,%esp
+80100500:	68 c0 bc 10 80       	push   $0x8010bcc0
+80100505:	6b df 64             	imul   $0x64,%edi,%ebx
+80100508:	8d 44 1e 5c          	lea    0x5c(%esi,%ebx,1),%eax
+8010050c:	50                   	push   %eax
+8010050d:	e8 a8 7e 00 00       	call   801083ba <initsleeplock>
+    b->dev = BNODEV;
+80100512:	01 f3                	add    %esi,%ebx
+80100514:	c7 43 54 ff ff ff ff 	movl   $0xffffffff,0x54(%ebx)
+    b->data = (uchar*)s->page[i*BSIZE/PGSIZE] + (i*BSIZE)%PGSIZE;
+8010051b:	8b 44 be 10          	mov    0x10(%esi,%edi,4),%eax
+8010051f:	89 83 b0 00 00 00    	mov    %eax,0xb0(%ebx)
+  for(i = 0; i < BSLABBUFS; i++){
+80100525:	83 c7 01             	add    $0x1,%edi
+80100528:	83 c4 10             	add    $0x10,%esp
+8010052b:	83 ff 0f             	cmp    $0xf,%edi
+8010052e:	7e cd                	jle    801004fd <bslaballoc+0x74>
+}
+80100530:	89 f0                	mov    %esi,%eax
+80100532:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100535:	5b                   	pop    %ebx
+80100536:	5e                   	pop    %esi
+80100537:	5f                   	pop    %edi
+80100538:	5d                   	pop    %ebp
+80100539:	c3                   	ret
+
+8010053a <bget1>:
+// If not found, allocate a buffer.
+// In either case, return locked buffer. If every buffer is
+// in use, panic, or return 0 if canfail is set.
+static struct buf*
+bget1(uint dev, uint blockno, int canfail)
+{
+8010053a:	55                   	push   %ebp
+8010053b:	89 e5                	mov    %esp,%ebp
+8010053d:	57                   	push   %edi
+8010053e:	56                   	push   %esi
+8010053f:	53                   	push   %ebx
+80100540:	83 ec 2c             	sub    $0x2c,%esp
+80100543:	89 c3                	mov    %eax,%ebx
+80100545:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80100548:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  struct buf *b;
+  struct bucket *bk, *obk;
+  struct bslab *s;
+
+  bk = bhash(dev, blockno);
+8010054b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010054e:	e8 e1 fa ff ff       	call   80100034 <bhash>
+80100553:	89 c6                	mov    %eax,%esi
+80100555:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+  // Is the block already cached?
+  acquire(block(bk));
+80100558:	e8 fd fa ff ff       	call   8010005a <block>
+8010055d:	89 c7                	mov    %eax,%edi
+8010055f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80100562:	83 ec 0c             	sub    $0xc,%esp
+80100565:	50                   	push   %eax
+80100566:	e8 77 80 00 00       	call   801085e2 <acquire>
+  b = blookup(bk, dev, blockno);
+8010056b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010056e:	89 da                	mov    %ebx,%edx
+80100570:	89 f0                	mov    %esi,%eax
+80100572:	e8 8e fc ff ff       	call   80100205 <blookup>
+80100577:	89 c6                	mov    %eax,%esi
+80100579:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  release(block(bk));
+8010057c:	89 3c 24             	mov    %edi,(%esp)
+8010057f:	e8 c3 80 00 00       	call   80108647 <release>
+  if(b){
+80100584:	83 c4 10             	add    $0x10,%esp
+80100587:	85 f6                	test   %esi,%esi
+80100589:	0f 85 a4 00 00 00    	jne    80100633 <bget1+0xf9>
+
+  // Not cached. Grow the cache rather than evict while memory
+  // is plentiful. The slab is set up before taking evictlock and
+  // only linked in under it.
+  s = 0;
+  if(bcache.nslab < bcache.maxslab && kfreepages() >= BLOWATER)
+8010058f:	a1 a4 76 11 80       	mov    0x801176a4,%eax
+80100594:	39 05 a0 76 11 80    	cmp    %eax,0x801176a0
+8010059a:	0f 8c b0 00 00 00    	jl     80100650 <bget1+0x116>
+  s = 0;
+801005a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801005a3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    s = bslaballoc();
+
+  acquire(&bcache.evictlock);
+801005a6:	83 ec 0c             	sub    $0xc,%esp
+801005a9:	68 68 76 11 80       	push   $0x80117668
+801005ae:	e8 2f 80 00 00       	call   801085e2 <acquire>
+  if(s && bcache.nslab < bcache.maxslab){
+801005b3:	83 c4 10             	add    $0x10,%esp
+801005b6:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+801005ba:	0f 84 c7 00 00 00    	je     80100687 <bget1+0x14d>
+801005c0:	a1 a4 76 11 80       	mov    0x801176a4,%eax
+801005c5:	39 05 a0 76 11 80    	cmp    %eax,0x801176a0
+801005cb:	0f 8c a3 00 00 00    	jl     80100674 <bget1+0x13a>
+    s = bshrink();
+  }
+
+  // Look again now that no one else can be adding blocks,
+  // in case another miss just brought it in.
+  acquire(block(bk));
+801005d1:	83 ec 0c             	sub    $0xc,%esp
+801005d4:	8b 75 d8             	mov    -0x28(%ebp),%esi
+801005d7:	56                   	push   %esi
+801005d8:	e8 05 80 00 00       	call   801085e2 <acquire>
+  b = blookup(bk, dev, blockno);
+801005dd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801005e0:	8b 55 d0             	mov    -0x30(%ebp),%edx
+801005e3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801005e6:	e8 1a fc ff ff       	call   80100205 <blookup>
+801005eb:	89 c7                	mov    %eax,%edi
+801005ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  release(block(bk));
+801005f0:	89 34 24             	mov    %esi,(%esp)
+801005f3:	e8 4f 80 00 00       	call   80108647 <release>
+  if(b){
+801005f8:	83 c4 10             	add    $0x10,%esp
+801005fb:	85 ff                	test   %edi,%edi
+801005fd:	0f 84 f0 00 00 00    	je     801006f3 <bget1+0x1b9>
+    release(&bcache.evictlock);
+80100603:	83 ec 0c             	sub    $0xc,%esp
+80100606:	68 68 76 11 80       	push   $0x80117668
+8010060b:	e8 37 80 00 00       	call   80108647 <release>
+    if(s)
+80100610:	83 c4 10             	add    $0x10,%esp
+80100613:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80100616:	85 c0                	test   %eax,%eax
+80100618:	74 05                	je     8010061f <bget1+0xe5>
+      bslabrelease(s);
+8010061a:	e8 32 fe ff ff       	call   80100451 <bslabrelease>
+    acquiresleep(&b->lock);
+8010061f:	83 ec 0c             	sub    $0xc,%esp
+80100622:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100625:	83 c0 0c             	add    $0xc,%eax
+80100628:	50                   	push   %eax
+80100629:	e8 bf 7d 00 00       	call   801083ed <acquiresleep>
+    return b;
+8010062e:	83 c4 10             	add    $0x10,%esp
+80100631:	eb 12                	jmp    80100645 <bget1+0x10b>
+    acquiresleep(&b->lock);
+80100633:	83 ec 0c             	sub    $0xc,%esp
+80100636:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100639:	83 c0 0c             	add    $0xc,%eax
+8010063c:	50                   	push   %eax
+8010063d:	e8 ab 7d 00 00       	call   801083ed <acquiresleep>
+    return b;
+80100642:	83 c4 10             	add    $0x10,%esp
+  if(s)
+    bslabrelease(s);
+
+  acquiresleep(&b->lock);
+  return b;
+}
+80100645:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100648:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010064b:	5b                   	pop    %ebx
+8010064c:	5e                   	pop    %esi
+8010064d:	5f                   	pop    %edi
+8010064e:	5d                   	pop    %ebp
+8010064f:	c3                   	ret
+  if(bcache.nslab < bcache.maxslab && kfreepages() >= BLOWATER)
+80100650:	e8 1a 45 00 00       	call   80104b6f <kfreepages>
+80100655:	3d ff 00 00 00       	cmp    $0xff,%eax
+8010065a:	7f 0b                	jg     80100667 <bget1+0x12d>
+  s = 0;
+8010065c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010065f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80100662:	e9 3f ff ff ff       	jmp    801005a6 <bget1+0x6c>
+    s = bslaballoc();
+80100667:	e8 1d fe ff ff       	call   80100489 <bslaballoc>
+8010066c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010066f:	e9 32 ff ff ff       	jmp    801005a6 <bget1+0x6c>
+    bslabadd(s);
+80100674:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80100677:	e8 0c fb ff ff       	call   80100188 <bslabadd>
+    s = 0;
+8010067c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010067f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80100682:	e9 4a ff ff ff       	jmp    801005d1 <bget1+0x97>
+  } else if(s == 0 && kfreepages() < BLOWATER){
+80100687:	e8 e3 44 00 00       	call   80104b6f <kfreepages>
+8010068c:	3d ff 00 00 00       	cmp    $0xff,%eax
+80100691:	0f 8f 3a ff ff ff    	jg     801005d1 <bget1+0x97>
+    s = bshrink();
+80100697:	e8 e2 fc ff ff       	call   8010037e <bshrink>
+8010069c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010069f:	e9 2d ff ff ff       	jmp    801005d1 <bget1+0x97>
+    release(&bcache.lrulock);
+801006a4:	83 ec 0c             	sub    $0xc,%esp
+801006a7:	68 a8 76 11 80       	push   $0x801176a8
+801006ac:	e8 96 7f 00 00       	call   80108647 <release>
+    if(b == &bcache.head){
+801006b1:	83 c4 10             	add    $0x10,%esp
+801006b4:	81 fb dc 76 11 80    	cmp    $0x801176dc,%ebx
+801006ba:	74 5f                	je     8010071b <bget1+0x1e1>
+    obk = bhash(b->dev, b->blockno);
+801006bc:	8b 53 08             	mov    0x8(%ebx),%edx
+801006bf:	8b 43 04             	mov    0x4(%ebx),%eax
+801006c2:	e8 6d f9 ff ff       	call   80100034 <bhash>
+801006c7:	89 c7                	mov    %eax,%edi
+    acquire(block(obk));
+801006c9:	e8 8c f9 ff ff       	call   8010005a <block>
+801006ce:	89 c6                	mov    %eax,%esi
+801006d0:	83 ec 0c             	sub    $0xc,%esp
+801006d3:	50                   	push   %eax
+801006d4:	e8 09 7f 00 00       	call   801085e2 <acquire>
+    if(b->refcnt == 0 && (b->flags & (B_DIRTY|B_ASYNC)) == 0)
+801006d9:	83 c4 10             	add    $0x10,%esp
+801006dc:	83 7b 4c 00          	cmpl   $0x0,0x4c(%ebx)
+801006e0:	75 05                	jne    801006e7 <bget1+0x1ad>
+801006e2:	f6 03 0c             	testb  $0xc,(%ebx)
+801006e5:	74 6c                	je     80100753 <bget1+0x219>
+    release(block(obk));
+801006e7:	83 ec 0c             	sub    $0xc,%esp
+801006ea:	56                   	push   %esi
+801006eb:	e8 57 7f 00 00       	call   80108647 <release>
+    acquire(&bcache.lrulock);
+801006f0:	83 c4 10             	add    $0x10,%esp
+801006f3:	83 ec 0c             	sub    $0xc,%esp
+801006f6:	68 a8 76 11 80       	push   $0x801176a8
+801006fb:	e8 e2 7e 00 00       	call   801085e2 <acquire>
+    for(b = bcache.head.prev; b != &bcache.head; b = b->prev)
+80100700:	8b 1d 2c 77 11 80    	mov    0x8011772c,%ebx
+80100706:	83 c4 10             	add    $0x10,%esp
+80100709:	81 fb dc 76 11 80    	cmp    $0x801176dc,%ebx
+8010070f:	74 93                	je     801006a4 <bget1+0x16a>
+      if((b->flags & (B_DIRTY|B_ASYNC)) == 0)
+80100711:	f6 03 0c             	testb  $0xc,(%ebx)
+80100714:	74 8e                	je     801006a4 <bget1+0x16a>
+    for(b = bcache.head.prev; b != &bcache.head; b = b->prev)
+80100716:	8b 5b 50             	mov    0x50(%ebx),%ebx
+80100719:	eb ee                	jmp    80100709 <bget1+0x1cf>
+      if(canfail){
+8010071b:	83 7d cc 00          	cmpl   $0x0,-0x34(%ebp)
+8010071f:	74 25                	je     80100746 <bget1+0x20c>
+        release(&bcache.evictlock);
+80100721:	83 ec 0c             	sub    $0xc,%esp
+80100724:	68 68 76 11 80       	push   $0x80117668
+80100729:	e8 19 7f 00 00       	call   80108647 <release>
+        if(s)
+8010072e:	83 c4 10             	add    $0x10,%esp
+80100731:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80100734:	85 c0                	test   %eax,%eax
+80100736:	0f 84 09 ff ff ff    	je     80100645 <bget1+0x10b>
+          bslabrelease(s);
+8010073c:	e8 10 fd ff ff       	call   80100451 <bslabrelease>
+        return 0;
+80100741:	e9 ff fe ff ff       	jmp    80100645 <bget1+0x10b>
+      panic("bget: no buffers");
+80100746:	83 ec 0c             	sub    $0xc,%esp
+80100749:	68 c7 bc 10 80       	push   $0x8010bcc7
+8010074e:	e8 a3 04 00 00       	call   80100bf6 <panic>
+  unhash(obk, b);
+80100753:	89 da                	mov    %ebx,%edx
+80100755:	89 f8                	mov    %edi,%eax
+80100757:	e8 cb f9 ff ff       	call   80100127 <unhash>
+  lruremove(b);
+8010075c:	89 d8                	mov    %ebx,%eax
+8010075e:	e8 65 fa ff ff       	call   801001c8 <lruremove>
+  b->refcnt = 1;
+80100763:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+  release(block(obk));
+8010076a:	83 ec 0c             	sub    $0xc,%esp
+8010076d:	56                   	push   %esi
+8010076e:	e8 d4 7e 00 00       	call   80108647 <release>
+  b->dev = dev;
+80100773:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80100776:	89 43 04             	mov    %eax,0x4(%ebx)
+  b->blockno = blockno;
+80100779:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010077c:	89 43 08             	mov    %eax,0x8(%ebx)
+  b->flags = 0;
+8010077f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  acquire(block(bk));
+80100785:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80100788:	89 3c 24             	mov    %edi,(%esp)
+8010078b:	e8 52 7e 00 00       	call   801085e2 <acquire>
+  b->hnext = bk->head;
+80100790:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80100793:	8b 01                	mov    (%ecx),%eax
+80100795:	89 43 58             	mov    %eax,0x58(%ebx)
+  bk->head = b;
+80100798:	89 19                	mov    %ebx,(%ecx)
+  release(block(bk));
+8010079a:	89 3c 24             	mov    %edi,(%esp)
+8010079d:	e8 a5 7e 00 00       	call   80108647 <release>
+  release(&bcache.evictlock);
+801007a2:	c7 04 24 68 76 11 80 	movl   $0x80117668,(%esp)
+801007a9:	e8 99 7e 00 00       	call   80108647 <release>
+  if(s)
+801007ae:	83 c4 10             	add    $0x10,%esp
+801007b1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801007b4:	85 c0                	test   %eax,%eax
+801007b6:	74 05                	je     801007bd <bget1+0x283>
+    bslabrelease(s);
+801007b8:	e8 94 fc ff ff       	call   80100451 <bslabrelease>
+  acquiresleep(&b->lock);
+801007bd:	83 ec 0c             	sub    $0xc,%esp
+801007c0:	8d 43 0c             	lea    0xc(%ebx),%eax
+801007c3:	50                   	push   %eax
+801007c4:	e8 24 7c 00 00       	call   801083ed <acquiresleep>
+  return b;
+801007c9:	83 c4 10             	add    $0x10,%esp
+801007cc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+801007cf:	e9 71 fe ff ff       	jmp    80100645 <bget1+0x10b>
+
+801007d4 <bget>:
+
+static struct buf*
+bget(uint dev, uint blockno)
+{
+801007d4:	55                   	push   %ebp
+801007d5:	89 e5                	mov    %esp,%ebp
+801007d7:	53                   	push   %ebx
+801007d8:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  b = bget1(dev, blockno, 0);
+801007db:	b9 00 00 00 00       	mov    $0x0,%ecx
+801007e0:	e8 55 fd ff ff       	call   8010053a <bget1>
+801007e5:	89 c3                	mov    %eax,%ebx
+  if(b->flags & B_ASYNC)
+801007e7:	f6 00 08             	testb  $0x8,(%eax)
+801007ea:	75 07                	jne    801007f3 <bget+0x1f>
+    idewaitahead(b);
+  return b;
+}
+801007ec:	89 d8                	mov    %ebx,%eax
+801007ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801007f1:	c9                   	leave
+801007f2:	c3                   	ret
+    idewaitahead(b);
+801007f3:	83 ec 0c             	sub    $0xc,%esp
+801007f6:	50                   	push   %eax
+801007f7:	e8 e9 3c 00 00       	call   801044e5 <idewaitahead>
+801007fc:	83 c4 10             	add    $0x10,%esp
+  return b;
+801007ff:	eb eb                	jmp    801007ec <bget+0x18>
+
+80100801 <breclaim>:
+{
+80100801:	55                   	push   %ebp
+80100802:	89 e5                	mov    %esp,%ebp
+80100804:	56                   	push   %esi
+80100805:	53                   	push   %ebx
+  if(holding(&bcache.evictlock))
+80100806:	83 ec 0c             	sub    $0xc,%esp
+80100809:	68 68 76 11 80       	push   $0x80117668
+8010080e:	e8 90 7d 00 00       	call   801085a3 <holding>
+80100813:	83 c4 10             	add    $0x10,%esp
+80100816:	85 c0                	test   %eax,%eax
+80100818:	75 39                	jne    80100853 <breclaim+0x52>
+8010081a:	89 c3                	mov    %eax,%ebx
+  acquire(&bcache.evictlock);
+8010081c:	83 ec 0c             	sub    $0xc,%esp
+8010081f:	68 68 76 11 80       	push   $0x80117668
+80100824:	e8 b9 7d 00 00       	call   801085e2 <acquire>
+  s = bshrink();
+80100829:	e8 50 fb ff ff       	call   8010037e <bshrink>
+8010082e:	89 c6                	mov    %eax,%esi
+  release(&bcache.evictlock);
+80100830:	c7 04 24 68 76 11 80 	movl   $0x80117668,(%esp)
+80100837:	e8 0b 7e 00 00       	call   80108647 <release>
+  if(s == 0)
+8010083c:	83 c4 10             	add    $0x10,%esp
+8010083f:	85 f6                	test   %esi,%esi
+80100841:	74 17                	je     8010085a <breclaim+0x59>
+  bslabrelease(s);
+80100843:	89 f0                	mov    %esi,%eax
+80100845:	e8 07 fc ff ff       	call   80100451 <bslabrelease>
+}
+8010084a:	89 d8                	mov    %ebx,%eax
+8010084c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010084f:	5b                   	pop    %ebx
+80100850:	5e                   	pop    %esi
+80100851:	5d                   	pop    %ebp
+80100852:	c3                   	ret
+    return -1;
+80100853:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80100858:	eb f0                	jmp    8010084a <breclaim+0x49>
+    return -1;
+8010085a:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010085f:	eb e9                	jmp    8010084a <breclaim+0x49>
+
+80100861 <binit>:
+{
+80100861:	55                   	push   %ebp
+80100862:	89 e5                	mov    %esp,%ebp
+80100864:	53                   	push   %ebx
+80100865:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&bcache.evictlock, "bcache.evict");
+80100868:	68 d8 bc 10 80       	push   $0x8010bcd8
+8010086d:	68 68 76 11 80       	push   $0x80117668
+80100872:	e8 27 7c 00 00       	call   8010849e <initlock>
+  initlock(&bcache.lrulock, "bcache.lru");
+80100877:	83 c4 08             	add    $0x8,%esp
+8010087a:	68 e5 bc 10 80       	push   $0x8010bce5
+8010087f:	68 a8 76 11 80       	push   $0x801176a8
+80100884:	e8 15 7c 00 00       	call   8010849e <initlock>
+  for(i = 0; i < NBLOCK; i++)
+80100889:	83 c4 10             	add    $0x10,%esp
+8010088c:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100891:	eb 1c                	jmp    801008af <binit+0x4e>
+    initlock(&bcache.block[i], "bcache.bucket");
+80100893:	83 ec 08             	sub    $0x8,%esp
+80100896:	68 f0 bc 10 80       	push   $0x8010bcf0
+8010089b:	6b c3 34             	imul   $0x34,%ebx,%eax
+8010089e:	05 00 00 11 80       	add    $0x80110000,%eax
+801008a3:	50                   	push   %eax
+801008a4:	e8 f5 7b 00 00       	call   8010849e <initlock>
+  for(i = 0; i < NBLOCK; i++)
+801008a9:	83 c3 01             	add    $0x1,%ebx
+801008ac:	83 c4 10             	add    $0x10,%esp
+801008af:	83 fb 3c             	cmp    $0x3c,%ebx
+801008b2:	7e df                	jle    80100893 <binit+0x32>
+  bcache.head.prev = &bcache.head;
+801008b4:	c7 05 2c 77 11 80 dc 	movl   $0x801176dc,0x8011772c
+801008bb:	76 11 80 
+  bcache.head.next = &bcache.head;
+801008be:	c7 05 30 77 11 80 dc 	movl   $0x801176dc,0x80117730
+801008c5:	76 11 80 
+  for(i = 0; i < BMINSLAB; i++){
+801008c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+801008cd:	83 fb 02             	cmp    $0x2,%ebx
+801008d0:	7f 20                	jg     801008f2 <binit+0x91>
+    if((s = bslaballoc()) == 0)
+801008d2:	e8 b2 fb ff ff       	call   80100489 <bslaballoc>
+801008d7:	85 c0                	test   %eax,%eax
+801008d9:	74 0a                	je     801008e5 <binit+0x84>
+    bslabadd(s);
+801008db:	e8 a8 f8 ff ff       	call   80100188 <bslabadd>
+  for(i = 0; i < BMINSLAB; i++){
+801008e0:	83 c3 01             	add    $0x1,%ebx
+801008e3:	eb e8                	jmp    801008cd <binit+0x6c>
+      panic("binit");
+801008e5:	83 ec 0c             	sub    $0xc,%esp
+801008e8:	68 fe bc 10 80       	push   $0x8010bcfe
+801008ed:	e8 04 03 00 00       	call   80100bf6 <panic>
+  bcache.maxslab = BMINSLAB;
+801008f2:	c7 05 a4 76 11 80 03 	movl   $0x3,0x801176a4
+801008f9:	00 00 00 
+}
+801008fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801008ff:	c9                   	leave
+80100900:	c3                   	ret
+
+80100901 <binit2>:
+{
+80100901:	55                   	push   %ebp
+80100902:	89 e5                	mov    %esp,%ebp
+80100904:	83 ec 08             	sub    $0x8,%esp
+  n = kfreepages() / BCACHEFRAC / (BSLABPAGES + 1);
+80100907:	e8 63 42 00 00       	call   80104b6f <kfreepages>
+8010090c:	89 c1                	mov    %eax,%ecx
+8010090e:	ba 79 78 78 78       	mov    $0x78787879,%edx
+80100913:	f7 ea                	imul   %edx
+80100915:	c1 fa 06             	sar    $0x6,%edx
+80100918:	89 c8                	mov    %ecx,%eax
+8010091a:	c1 f8 1f             	sar    $0x1f,%eax
+8010091d:	29 c2                	sub    %eax,%edx
+  if(n > BMAXSLAB)
+8010091f:	81 f9 c7 e1 00 00    	cmp    $0xe1c7,%ecx
+80100925:	7e 05                	jle    8010092c <binit2+0x2b>
+    n = BMAXSLAB;
+80100927:	ba a8 01 00 00       	mov    $0x1a8,%edx
+  if(n > bcache.maxslab)
+8010092c:	39 15 a4 76 11 80    	cmp    %edx,0x801176a4
+80100932:	7d 06                	jge    8010093a <binit2+0x39>
+    bcache.maxslab = n;
+80100934:	89 15 a4 76 11 80    	mov    %edx,0x801176a4
+}
+8010093a:	c9                   	leave
+8010093b:	c3                   	ret
+
+8010093c <bread>:
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+8010093c:	55                   	push   %ebp
+8010093d:	89 e5                	mov    %esp,%ebp
+8010093f:	53                   	push   %ebx
+80100940:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+80100943:	8b 55 0c             	mov    0xc(%ebp),%edx
+80100946:	8b 45 08             	mov    0x8(%ebp),%eax
+80100949:	e8 86 fe ff ff       	call   801007d4 <bget>
+8010094e:	89 c3                	mov    %eax,%ebx
+  if((b->flags & B_VALID) == 0) {
+80100950:	f6 00 02             	testb  $0x2,(%eax)
+80100953:	74 07                	je     8010095c <bread+0x20>
+    iderw(b);
+  }
+  return b;
+}
+80100955:	89 d8                	mov    %ebx,%eax
+80100957:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010095a:	c9                   	leave
+8010095b:	c3                   	ret
+    iderw(b);
+8010095c:	83 ec 0c             	sub    $0xc,%esp
+8010095f:	50                   	push   %eax
+80100960:	e8 71 3c 00 00       	call   801045d6 <iderw>
+80100965:	83 c4 10             	add    $0x10,%esp
+  return b;
+80100968:	eb eb                	jmp    80100955 <bread+0x19>
+
+8010096a <bwrite>:
+}
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+8010096a:	55                   	push   %ebp
+8010096b:	89 e5                	mov    %esp,%ebp
+8010096d:	53                   	push   %ebx
+8010096e:	83 ec 10             	sub    $0x10,%esp
+80100971:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100974:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100977:	50                   	push   %eax
+80100978:	e8 fa 7a 00 00       	call   80108477 <holdingsleep>
+8010097d:	83 c4 10             	add    $0x10,%esp
+80100980:	85 c0                	test   %eax,%eax
+80100982:	74 18                	je     8010099c <bwrite+0x32>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+80100984:	8b 03                	mov    (%ebx),%eax
+80100986:	83 c8 04             	or     $0x4,%eax
+80100989:	89 03                	mov    %eax,(%ebx)
+  iderw(b);
+8010098b:	83 ec 0c             	sub    $0xc,%esp
+8010098e:	53                   	push   %ebx
+8010098f:	e8 42 3c 00 00       	call   801045d6 <iderw>
+}
+80100994:	83 c4 10             	add    $0x10,%esp
+80100997:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010099a:	c9                   	leave
+8010099b:	c3                   	ret
+    panic("bwrite");
+8010099c:	83 ec 0c             	sub    $0xc,%esp
+8010099f:	68 04 bd 10 80       	push   $0x8010bd04
+801009a4:	e8 4d 02 00 00       	call   80100bf6 <panic>
+
+801009a9 <bwritev>:
+// Write n buffers' contents to disk as one batch, so the disk
+// driver can merge neighbouring blocks. All must be locked and
+// for the same device (log.c only writes to log.dev).
+void
+bwritev(struct buf **bufs, int n)
+{
+801009a9:	55                   	push   %ebp
+801009aa:	89 e5                	mov    %esp,%ebp
+801009ac:	57                   	push   %edi
+801009ad:	56                   	push   %esi
+801009ae:	53                   	push   %ebx
+801009af:	83 ec 0c             	sub    $0xc,%esp
+801009b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  for(i = 0; i < n; i++){
+801009b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+801009ba:	39 fb                	cmp    %edi,%ebx
+801009bc:	7d 36                	jge    801009f4 <bwritev+0x4b>
+    if(!holdingsleep(&bufs[i]->lock))
+801009be:	8b 45 08             	mov    0x8(%ebp),%eax
+801009c1:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+801009c4:	83 ec 0c             	sub    $0xc,%esp
+801009c7:	8b 06                	mov    (%esi),%eax
+801009c9:	83 c0 0c             	add    $0xc,%eax
+801009cc:	50                   	push   %eax
+801009cd:	e8 a5 7a 00 00       	call   80108477 <holdingsleep>
+801009d2:	83 c4 10             	add    $0x10,%esp
+801009d5:	85 c0                	test   %eax,%eax
+801009d7:	74 0e                	je     801009e7 <bwritev+0x3e>
+      panic("bwritev");
+    bufs[i]->flags |= B_DIRTY;
+801009d9:	8b 16                	mov    (%esi),%edx
+801009db:	8b 02                	mov    (%edx),%eax
+801009dd:	83 c8 04             	or     $0x4,%eax
+801009e0:	89 02                	mov    %eax,(%edx)
+  for(i = 0; i < n; i++){
+801009e2:	83 c3 01             	add    $0x1,%ebx
+801009e5:	eb d3                	jmp    801009ba <bwritev+0x11>
+      panic("bwritev");
+801009e7:	83 ec 0c             	sub    $0xc,%esp
+801009ea:	68 0b bd 10 80       	push   $0x8010bd0b
+801009ef:	e8 02 02 00 00       	call   80100bf6 <panic>
+  }
+  iderwv(bufs, n);
+801009f4:	83 ec 08             	sub    $0x8,%esp
+801009f7:	57                   	push   %edi
+801009f8:	ff 75 08             	push   0x8(%ebp)
+801009fb:	e8 3b 3b 00 00       	call   8010453b <iderwv>
+}
+80100a00:	83 c4 10             	add    $0x10,%esp
+80100a03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100a06:	5b                   	pop    %ebx
+80100a07:	5e                   	pop    %esi
+80100a08:	5f                   	pop    %edi
+80100a09:	5d                   	pop    %ebp
+80100a0a:	c3                   	ret
+
+80100a0b <brelse>:
+
+// Release a locked buffer.
+// If no one else holds it, move it to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+80100a0b:	55                   	push   %ebp
+80100a0c:	89 e5                	mov    %esp,%ebp
+80100a0e:	56                   	push   %esi
+80100a0f:	53                   	push   %ebx
+80100a10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct bucket *bk;
+
+  if(!holdingsleep(&b->lock))
+80100a13:	8d 73 0c             	lea    0xc(%ebx),%esi
+80100a16:	83 ec 0c             	sub    $0xc,%esp
+80100a19:	56                   	push   %esi
+80100a1a:	e8 58 7a 00 00       	call   80108477 <holdingsleep>
+80100a1f:	83 c4 10             	add    $0x10,%esp
+80100a22:	85 c0                	test   %eax,%eax
+80100a24:	74 46                	je     80100a6c <brelse+0x61>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+80100a26:	83 ec 0c             	sub    $0xc,%esp
+80100a29:	56                   	push   %esi
+80100a2a:	e8 0d 7a 00 00       	call   8010843c <releasesleep>
+
+  bk = bhash(b->dev, b->blockno);
+80100a2f:	8b 53 08             	mov    0x8(%ebx),%edx
+80100a32:	8b 43 04             	mov    0x4(%ebx),%eax
+80100a35:	e8 fa f5 ff ff       	call   80100034 <bhash>
+  acquire(block(bk));
+80100a3a:	e8 1b f6 ff ff       	call   8010005a <block>
+80100a3f:	89 c6                	mov    %eax,%esi
+80100a41:	89 04 24             	mov    %eax,(%esp)
+80100a44:	e8 99 7b 00 00       	call   801085e2 <acquire>
+  b->refcnt--;
+80100a49:	8b 43 4c             	mov    0x4c(%ebx),%eax
+80100a4c:	83 e8 01             	sub    $0x1,%eax
+80100a4f:	89 43 4c             	mov    %eax,0x4c(%ebx)
+  if (b->refcnt == 0) {
+80100a52:	83 c4 10             	add    $0x10,%esp
+80100a55:	85 c0                	test   %eax,%eax
+80100a57:	74 20                	je     80100a79 <brelse+0x6e>
+    // no one is waiting for it.
+    lruadd(b);
+  }
+  release(block(bk));
+80100a59:	83 ec 0c             	sub    $0xc,%esp
+80100a5c:	56                   	push   %esi
+80100a5d:	e8 e5 7b 00 00       	call   80108647 <release>
+}
+80100a62:	83 c4 10             	add    $0x10,%esp
+80100a65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100a68:	5b                   	pop    %ebx
+80100a69:	5e                   	pop    %esi
+80100a6a:	5d                   	pop    %ebp
+80100a6b:	c3                   	ret
+    panic("brelse");
+80100a6c:	83 ec 0c             	sub    $0xc,%esp
+80100a6f:	68 13 bd 10 80       	push   $0x8010bd13
+80100a74:	e8 7d 01 00 00       	call   80100bf6 <panic>
+    lruadd(b);
+80100a79:	89 d8                	mov    %ebx,%eax
+80100a7b:	e8 86 f9 ff ff       	call   80100406 <lruadd>
+80100a80:	eb d7                	jmp    80100a59 <brelse+0x4e>
+
+80100a82 <breadahead>:
+{
+80100a82:	55                   	push   %ebp
+80100a83:	89 e5                	mov    %esp,%ebp
+80100a85:	57                   	push   %edi
+80100a86:	56                   	push   %esi
+80100a87:	53                   	push   %ebx
+80100a88:	83 ec 1c             	sub    $0x1c,%esp
+80100a8b:	8b 75 08             	mov    0x8(%ebp),%esi
+80100a8e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  bk = bhash(dev, blockno);
+80100a91:	89 fa                	mov    %edi,%edx
+80100a93:	89 f0                	mov    %esi,%eax
+80100a95:	e8 9a f5 ff ff       	call   80100034 <bhash>
+80100a9a:	89 c3                	mov    %eax,%ebx
+  acquire(block(bk));
+80100a9c:	e8 b9 f5 ff ff       	call   8010005a <block>
+80100aa1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100aa4:	83 ec 0c             	sub    $0xc,%esp
+80100aa7:	50                   	push   %eax
+80100aa8:	e8 35 7b 00 00       	call   801085e2 <acquire>
+  for(b = bk->head; b; b = b->hnext)
+80100aad:	8b 1b                	mov    (%ebx),%ebx
+80100aaf:	83 c4 10             	add    $0x10,%esp
+80100ab2:	eb 03                	jmp    80100ab7 <breadahead+0x35>
+80100ab4:	8b 5b 58             	mov    0x58(%ebx),%ebx
+80100ab7:	85 db                	test   %ebx,%ebx
+80100ab9:	74 0a                	je     80100ac5 <breadahead+0x43>
+    if(b->dev == dev && b->blockno == blockno)
+80100abb:	39 73 04             	cmp    %esi,0x4(%ebx)
+80100abe:	75 f4                	jne    80100ab4 <breadahead+0x32>
+80100ac0:	39 7b 08             	cmp    %edi,0x8(%ebx)
+80100ac3:	75 ef                	jne    80100ab4 <breadahead+0x32>
+  release(block(bk));
+80100ac5:	83 ec 0c             	sub    $0xc,%esp
+80100ac8:	ff 75 e4             	push   -0x1c(%ebp)
+80100acb:	e8 77 7b 00 00       	call   80108647 <release>
+  if(b)
+80100ad0:	83 c4 10             	add    $0x10,%esp
+80100ad3:	85 db                	test   %ebx,%ebx
+80100ad5:	74 08                	je     80100adf <breadahead+0x5d>
+}
+80100ad7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100ada:	5b                   	pop    %ebx
+80100adb:	5e                   	pop    %esi
+80100adc:	5f                   	pop    %edi
+80100add:	5d                   	pop    %ebp
+80100ade:	c3                   	ret
+  if((b = bget1(dev, blockno, 1)) == 0)
+80100adf:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100ae4:	89 fa                	mov    %edi,%edx
+80100ae6:	89 f0                	mov    %esi,%eax
+80100ae8:	e8 4d fa ff ff       	call   8010053a <bget1>
+80100aed:	89 c3                	mov    %eax,%ebx
+80100aef:	85 c0                	test   %eax,%eax
+80100af1:	74 e4                	je     80100ad7 <breadahead+0x55>
+  if((b->flags & (B_VALID|B_ASYNC)) == 0)
+80100af3:	f6 00 0a             	testb  $0xa,(%eax)
+80100af6:	74 0e                	je     80100b06 <breadahead+0x84>
+  brelse(b);
+80100af8:	83 ec 0c             	sub    $0xc,%esp
+80100afb:	53                   	push   %ebx
+80100afc:	e8 0a ff ff ff       	call   80100a0b <brelse>
+80100b01:	83 c4 10             	add    $0x10,%esp
+80100b04:	eb d1                	jmp    80100ad7 <breadahead+0x55>
+    idereadahead(b);
+80100b06:	83 ec 0c             	sub    $0xc,%esp
+80100b09:	50                   	push   %eax
+80100b0a:	e8 76 39 00 00       	call   80104485 <idereadahead>
+80100b0f:	83 c4 10             	add    $0x10,%esp
+80100b12:	eb e4                	jmp    80100af8 <breadahead+0x76>
+
+80100b14 <consoleread>:
+#endif
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100b14:	55                   	push   %ebp
+80100b15:	89 e5                	mov    %esp,%ebp
+80100b17:	57                   	push   %edi
+80100b18:	56                   	push   %esi
+80100b19:	53                   	push   %ebx
+80100b1a:	83 ec 28             	sub    $0x28,%esp
+80100b1d:	8b 7d 08             	mov    0x8(%ebp),%edi
+80100b20:	8b 75 0c             	mov    0xc(%ebp),%esi
+80100b23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  uint target;
+  int c;
+
+  iunlock(ip);
+80100b26:	57                   	push   %edi
+80100b27:	e8 ca 24 00 00       	call   80102ff6 <iunlock>
+  target = n;
+80100b2c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  acquire(&cons.lock);
+80100b2f:	c7 04 24 00 78 11 80 	movl   $0x80117800,(%esp)
+80100b36:	e8 a7 7a 00 00       	call   801085e2 <acquire>
+  while(n > 0){
+80100b3b:	83 c4 10             	add    $0x10,%esp
+80100b3e:	85 db                	test   %ebx,%ebx
+80100b40:	0f 8e 91 00 00 00    	jle    80100bd7 <consoleread+0xc3>
+    while(input.r == input.w){
+80100b46:	a1 e0 77 11 80       	mov    0x801177e0,%eax
+80100b4b:	3b 05 e4 77 11 80    	cmp    0x801177e4,%eax
+80100b51:	75 47                	jne    80100b9a <consoleread+0x86>
+      if(myproc()->killed){
+80100b53:	e8 f4 5d 00 00       	call   8010694c <myproc>
+80100b58:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80100b5c:	75 17                	jne    80100b75 <consoleread+0x61>
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+80100b5e:	83 ec 08             	sub    $0x8,%esp
+80100b61:	68 00 78 11 80       	push   $0x80117800
+80100b66:	68 e0 77 11 80       	push   $0x801177e0
+80100b6b:	e8 fc 6c 00 00       	call   8010786c <sleep>
+80100b70:	83 c4 10             	add    $0x10,%esp
+80100b73:	eb d1                	jmp    80100b46 <consoleread+0x32>
+        release(&cons.lock);
+80100b75:	83 ec 0c             	sub    $0xc,%esp
+80100b78:	68 00 78 11 80       	push   $0x80117800
+80100b7d:	e8 c5 7a 00 00       	call   80108647 <release>
+        ilock(ip);
+80100b82:	89 3c 24             	mov    %edi,(%esp)
+80100b85:	e8 97 23 00 00       	call   80102f21 <ilock>
+        return -1;
+80100b8a:	83 c4 10             	add    $0x10,%esp
+80100b8d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+80100b92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100b95:	5b                   	pop    %ebx
+80100b96:	5e                   	pop    %esi
+80100b97:	5f                   	pop    %edi
+80100b98:	5d                   	pop    %ebp
+80100b99:	c3                   	ret
+    c = input.buf[input.r++ % INPUT_BUF];
+80100b9a:	8d 50 01             	lea    0x1(%eax),%edx
+80100b9d:	89 15 e0 77 11 80    	mov    %edx,0x801177e0
+80100ba3:	89 c2                	mov    %eax,%edx
+80100ba5:	83 e2 7f             	and    $0x7f,%edx
+80100ba8:	0f b6 92 60 77 11 80 	movzbl -0x7fee88a0(%edx),%edx
+80100baf:	0f be ca             	movsbl %dl,%ecx
+    if(c == C('D')){  // EOF
+80100bb2:	80 fa 04             	cmp    $0x4,%dl
+80100bb5:	74 14                	je     80100bcb <consoleread+0xb7>
+    *dst++ = c;
+80100bb7:	8d 46 01             	lea    0x1(%esi),%eax
+80100bba:	88 16                	mov    %dl,(%esi)
+    --n;
+80100bbc:	83 eb 01             	sub    $0x1,%ebx
+    if(c == '\n')
+80100bbf:	83 f9 0a             	cmp    $0xa,%ecx
+80100bc2:	74 13                	je     80100bd7 <consoleread+0xc3>
+    *dst++ = c;
+80100bc4:	89 c6                	mov    %eax,%esi
+80100bc6:	e9 73 ff ff ff       	jmp    80100b3e <consoleread+0x2a>
+      if(n < target){
+80100bcb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80100bce:	39 cb                	cmp    %ecx,%ebx
+80100bd0:	73 05                	jae    80100bd7 <consoleread+0xc3>
+        input.r--;
+80100bd2:	a3 e0 77 11 80       	mov    %eax,0x801177e0
+  release(&cons.lock);
+80100bd7:	83 ec 0c             	sub    $0xc,%esp
+80100bda:	68 00 78 11 80       	push   $0x80117800
+80100bdf:	e8 63 7a 00 00       	call   80108647 <release>
+  ilock(ip);
+80100be4:	89 3c 24             	mov    %edi,(%esp)
+80100be7:	e8 35 23 00 00       	call   80102f21 <ilock>
+  return target - n;
+80100bec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100bef:	29 d8                	sub    %ebx,%eax
+80100bf1:	83 c4 10             	add    $0x10,%esp
+80100bf4:	eb 9c                	jmp    80100b92 <consoleread+0x7e>
+
+80100bf6 <panic>:
+{
+80100bf6:	55                   	push   %ebp
+80100bf7:	89 e5                	mov    %esp,%ebp
+80100bf9:	53                   	push   %ebx
+80100bfa:	83 ec 34             	sub    $0x34,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100bfd:	fa                   	cli
+  cons.locking = 0;
+80100bfe:	c7 05 34 78 11 80 00 	movl   $0x0,0x80117834
+80100c05:	00 00 00 
+  cprintf("lapicid %d: panic: ", lapicid());
+80100c08:	e8 e7 41 00 00       	call   80104df4 <lapicid>
+80100c0d:	83 ec 08             	sub    $0x8,%esp
+80100c10:	50                   	push   %eax
+80100c11:	68 1a bd 10 80       	push   $0x8010bd1a
+80100c16:	e8 9c 02 00 00       	call   80100eb7 <cprintf>
+  cprintf(s);
+80100c1b:	83 c4 04             	add    $0x4,%esp
+80100c1e:	ff 75 08             	push   0x8(%ebp)
+80100c21:	e8 91 02 00 00       	call   80100eb7 <cprintf>
+  cprintf("\n");
+80100c26:	c7 04 24 9b cc 10 80 	movl   $0x8010cc9b,(%esp)
+80100c2d:	e8 85 02 00 00       	call   80100eb7 <cprintf>
+  getcallerpcs(&s, pcs);
+80100c32:	83 c4 08             	add    $0x8,%esp
+80100c35:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80100c38:	50                   	push   %eax
+80100c39:	8d 45 08             	lea    0x8(%ebp),%eax
+80100c3c:	50                   	push   %eax
+80100c3d:	e8 77 78 00 00       	call   801084b9 <getcallerpcs>
+  for(i=0; i<10; i++)
+80100c42:	83 c4 10             	add    $0x10,%esp
+80100c45:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100c4a:	eb 17                	jmp    80100c63 <panic+0x6d>
+    cprintf(" %p", pcs[i]);
+80100c4c:	83 ec 08             	sub    $0x8,%esp
+80100c4f:	ff 74 9d d0          	push   -0x30(%ebp,%ebx,4)
+80100c53:	68 2e bd 10 80       	push   $0x8010bd2e
+80100c58:	e8 5a 02 00 00       	call   80100eb7 <cprintf>
+  for(i=0; i<10; i++)
+80100c5d:	83 c3 01             	add    $0x1,%ebx
+80100c60:	83 c4 10             	add    $0x10,%esp
+80100c63:	83 fb 09             	cmp    $0x9,%ebx
+80100c66:	7e e4                	jle    80100c4c <panic+0x56>
+  panicked = 1; // freeze other CPU
+80100c68:	c7 05 38 78 11 80 01 	movl   $0x1,0x80117838
+80100c6f:	00 00 00 
+  for(;;)
+80100c72:	eb fe                	jmp    80100c72 <panic+0x7c>
+
+80100c74 <cgaputc>:
+{
+80100c74:	55                   	push   %ebp
+80100c75:	89 e5                	mov    %esp,%ebp
+80100c77:	57                   	push   %edi
+80100c78:	56                   	push   %esi
+80100c79:	53                   	push   %ebx
+80100c7a:	83 ec 0c             	sub    $0xc,%esp
+80100c7d:	89 c3                	mov    %eax,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100c7f:	bf d4 03 00 00       	mov    $0x3d4,%edi
+80100c84:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100c89:	89 fa                	mov    %edi,%edx
+80100c8b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100c8c:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+80100c91:	89 ca                	mov    %ecx,%edx
+80100c93:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100c94:	0f b6 f0             	movzbl %al,%esi
+80100c97:	c1 e6 08             	shl    $0x8,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100c9a:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100c9f:	89 fa                	mov    %edi,%edx
+80100ca1:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100ca2:	89 ca                	mov    %ecx,%edx
+80100ca4:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100ca5:	0f b6 c8             	movzbl %al,%ecx
+80100ca8:	09 f1                	or     %esi,%ecx
+  if(c == '\n')
+80100caa:	83 fb 0a             	cmp    $0xa,%ebx
+80100cad:	74 60                	je     80100d0f <cgaputc+0x9b>
+  else if(c == BACKSPACE){
+80100caf:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+80100cb5:	74 79                	je     80100d30 <cgaputc+0xbc>
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+80100cb7:	0f b6 c3             	movzbl %bl,%eax
+80100cba:	8d 59 01             	lea    0x1(%ecx),%ebx
+80100cbd:	80 cc 07             	or     $0x7,%ah
+80100cc0:	66 89 84 09 00 80 0b 	mov    %ax,-0x7ff48000(%ecx,%ecx,1)
+80100cc7:	80 
+  if(pos < 0 || pos > 25*80)
+80100cc8:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+80100cce:	77 6d                	ja     80100d3d <cgaputc+0xc9>
+  if((pos/80) >= 24){  // Scroll up.
+80100cd0:	81 fb 7f 07 00 00    	cmp    $0x77f,%ebx
+80100cd6:	7f 72                	jg     80100d4a <cgaputc+0xd6>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100cd8:	be d4 03 00 00       	mov    $0x3d4,%esi
+80100cdd:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100ce2:	89 f2                	mov    %esi,%edx
+80100ce4:	ee                   	out    %al,(%dx)
+  outb(CRTPORT+1, pos>>8);
+80100ce5:	0f b6 c7             	movzbl %bh,%eax
+80100ce8:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+80100ced:	89 ca                	mov    %ecx,%edx
+80100cef:	ee                   	out    %al,(%dx)
+80100cf0:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100cf5:	89 f2                	mov    %esi,%edx
+80100cf7:	ee                   	out    %al,(%dx)
+80100cf8:	89 d8                	mov    %ebx,%eax
+80100cfa:	89 ca                	mov    %ecx,%edx
+80100cfc:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+80100cfd:	66 c7 84 1b 00 80 0b 	movw   $0x720,-0x7ff48000(%ebx,%ebx,1)
+80100d04:	80 20 07 
+}
+80100d07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100d0a:	5b                   	pop    %ebx
+80100d0b:	5e                   	pop    %esi
+80100d0c:	5f                   	pop    %edi
+80100d0d:	5d                   	pop    %ebp
+80100d0e:	c3                   	ret
+    pos += 80 - pos%80;
+80100d0f:	ba 67 66 66 66       	mov    $0x66666667,%edx
+80100d14:	89 c8                	mov    %ecx,%eax
+80100d16:	f7 ea                	imul   %edx
+80100d18:	c1 fa 05             	sar    $0x5,%edx
+80100d1b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+80100d1e:	c1 e0 04             	shl    $0x4,%eax
+80100d21:	89 ca                	mov    %ecx,%edx
+80100d23:	29 c2                	sub    %eax,%edx
+80100d25:	bb 50 00 00 00       	mov    $0x50,%ebx
+80100d2a:	29 d3                	sub    %edx,%ebx
+80100d2c:	01 cb                	add    %ecx,%ebx
+80100d2e:	eb 98                	jmp    80100cc8 <cgaputc+0x54>
+    if(pos > 0) --pos;
+80100d30:	85 c9                	test   %ecx,%ecx
+80100d32:	7e 05                	jle    80100d39 <cgaputc+0xc5>
+80100d34:	8d 59 ff             	lea    -0x1(%ecx),%ebx
+80100d37:	eb 8f                	jmp    80100cc8 <cgaputc+0x54>
+  pos |= inb(CRTPORT+1);
+80100d39:	89 cb                	mov    %ecx,%ebx
+80100d3b:	eb 8b                	jmp    80100cc8 <cgaputc+0x54>
+    panic("pos under/overflow");
+80100d3d:	83 ec 0c             	sub    $0xc,%esp
+80100d40:	68 32 bd 10 80       	push   $0x8010bd32
+80100d45:	e8 ac fe ff ff       	call   80100bf6 <panic>
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100d4a:	83 ec 04             	sub    $0x4,%esp
+80100d4d:	68 60 0e 00 00       	push   $0xe60
+80100d52:	68 a0 80 0b 80       	push   $0x800b80a0
+80100d57:	68 00 80 0b 80       	push   $0x800b8000
+80100d5c:	e8 a5 79 00 00       	call   80108706 <memmove>
+    pos -= 80;
+80100d61:	83 eb 50             	sub    $0x50,%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100d64:	b8 80 07 00 00       	mov    $0x780,%eax
+80100d69:	29 d8                	sub    %ebx,%eax
+80100d6b:	8d 94 1b 00 80 0b 80 	lea    -0x7ff48000(%ebx,%ebx,1),%edx
+80100d72:	83 c4 0c             	add    $0xc,%esp
+80100d75:	01 c0                	add    %eax,%eax
+80100d77:	50                   	push   %eax
+80100d78:	6a 00                	push   $0x0
+80100d7a:	52                   	push   %edx
+80100d7b:	e8 0e 79 00 00       	call   8010868e <memset>
+80100d80:	83 c4 10             	add    $0x10,%esp
+80100d83:	e9 50 ff ff ff       	jmp    80100cd8 <cgaputc+0x64>
+
+80100d88 <consputc>:
+  if(panicked){
+80100d88:	83 3d 38 78 11 80 00 	cmpl   $0x0,0x80117838
+80100d8f:	74 03                	je     80100d94 <consputc+0xc>
+  asm volatile("cli");
+80100d91:	fa                   	cli
+    for(;;)
+80100d92:	eb fe                	jmp    80100d92 <consputc+0xa>
+{
+80100d94:	55                   	push   %ebp
+80100d95:	89 e5                	mov    %esp,%ebp
+80100d97:	53                   	push   %ebx
+80100d98:	83 ec 04             	sub    $0x4,%esp
+80100d9b:	89 c3                	mov    %eax,%ebx
+  if(c == BACKSPACE){
+80100d9d:	3d 00 01 00 00       	cmp    $0x100,%eax
+80100da2:	74 18                	je     80100dbc <consputc+0x34>
+    uartputc(c);
+80100da4:	83 ec 0c             	sub    $0xc,%esp
+80100da7:	50                   	push   %eax
+80100da8:	e8 35 90 00 00       	call   80109de2 <uartputc>
+80100dad:	83 c4 10             	add    $0x10,%esp
+  cgaputc(c);
+80100db0:	89 d8                	mov    %ebx,%eax
+80100db2:	e8 bd fe ff ff       	call   80100c74 <cgaputc>
+}
+80100db7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100dba:	c9                   	leave
+80100dbb:	c3                   	ret
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+80100dbc:	83 ec 0c             	sub    $0xc,%esp
+80100dbf:	6a 08                	push   $0x8
+80100dc1:	e8 1c 90 00 00       	call   80109de2 <uartputc>
+80100dc6:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80100dcd:	e8 10 90 00 00       	call   80109de2 <uartputc>
+80100dd2:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100dd9:	e8 04 90 00 00       	call   80109de2 <uartputc>
+80100dde:	83 c4 10             	add    $0x10,%esp
+80100de1:	eb cd                	jmp    80100db0 <consputc+0x28>
+
+80100de3 <printint>:
+{
+80100de3:	55                   	push   %ebp
+80100de4:	89 e5                	mov    %esp,%ebp
+80100de6:	57                   	push   %edi
+80100de7:	56                   	push   %esi
+80100de8:	53                   	push   %ebx
+80100de9:	83 ec 2c             	sub    $0x2c,%esp
+80100dec:	89 c3                	mov    %eax,%ebx
+80100dee:	89 d6                	mov    %edx,%esi
+80100df0:	89 c8                	mov    %ecx,%eax
+  if(sign && (sign = xx < 0))
+80100df2:	85 c9                	test   %ecx,%ecx
+80100df4:	74 09                	je     80100dff <printint+0x1c>
+80100df6:	89 d8                	mov    %ebx,%eax
+80100df8:	c1 e8 1f             	shr    $0x1f,%eax
+80100dfb:	85 db                	test   %ebx,%ebx
+80100dfd:	78 3c                	js     80100e3b <printint+0x58>
+    x = xx;
+80100dff:	89 d9                	mov    %ebx,%ecx
+  i = 0;
+80100e01:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100e06:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    buf[i++] = digits[x % base];
+80100e09:	89 c8                	mov    %ecx,%eax
+80100e0b:	ba 00 00 00 00       	mov    $0x0,%edx
+80100e10:	f7 f6                	div    %esi
+80100e12:	89 df                	mov    %ebx,%edi
+80100e14:	83 c3 01             	add    $0x1,%ebx
+80100e17:	0f b6 92 d0 bd 10 80 	movzbl -0x7fef4230(%edx),%edx
+80100e1e:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+80100e22:	89 ca                	mov    %ecx,%edx
+80100e24:	89 c1                	mov    %eax,%ecx
+80100e26:	39 f2                	cmp    %esi,%edx
+80100e28:	73 df                	jae    80100e09 <printint+0x26>
+  if(sign)
+80100e2a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100e2d:	85 c0                	test   %eax,%eax
+80100e2f:	74 1a                	je     80100e4b <printint+0x68>
+    buf[i++] = '-';
+80100e31:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+80100e36:	8d 5f 02             	lea    0x2(%edi),%ebx
+80100e39:	eb 10                	jmp    80100e4b <printint+0x68>
+    x = -xx;
+80100e3b:	89 d9                	mov    %ebx,%ecx
+80100e3d:	f7 d9                	neg    %ecx
+80100e3f:	eb c0                	jmp    80100e01 <printint+0x1e>
+    consputc(buf[i]);
+80100e41:	0f be 44 1d d8       	movsbl -0x28(%ebp,%ebx,1),%eax
+80100e46:	e8 3d ff ff ff       	call   80100d88 <consputc>
+  while(--i >= 0)
+80100e4b:	83 eb 01             	sub    $0x1,%ebx
+80100e4e:	79 f1                	jns    80100e41 <printint+0x5e>
+}
+80100e50:	83 c4 2c             	add    $0x2c,%esp
+80100e53:	5b                   	pop    %ebx
+80100e54:	5e                   	pop    %esi
+80100e55:	5f                   	pop    %edi
+80100e56:	5d                   	pop    %ebp
+80100e57:	c3                   	ret
+
+80100e58 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+80100e58:	55                   	push   %ebp
+80100e59:	89 e5                	mov    %esp,%ebp
+80100e5b:	57                   	push   %edi
+80100e5c:	56                   	push   %esi
+80100e5d:	53                   	push   %ebx
+80100e5e:	83 ec 18             	sub    $0x18,%esp
+80100e61:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80100e64:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+80100e67:	ff 75 08             	push   0x8(%ebp)
+80100e6a:	e8 87 21 00 00       	call   80102ff6 <iunlock>
+  acquire(&cons.lock);
+80100e6f:	c7 04 24 00 78 11 80 	movl   $0x80117800,(%esp)
+80100e76:	e8 67 77 00 00       	call   801085e2 <acquire>
+  for(i = 0; i < n; i++)
+80100e7b:	83 c4 10             	add    $0x10,%esp
+80100e7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100e83:	eb 0c                	jmp    80100e91 <consolewrite+0x39>
+    consputc(buf[i] & 0xff);
+80100e85:	0f b6 04 1f          	movzbl (%edi,%ebx,1),%eax
+80100e89:	e8 fa fe ff ff       	call   80100d88 <consputc>
+  for(i = 0; i < n; i++)
+80100e8e:	83 c3 01             	add    $0x1,%ebx
+80100e91:	39 f3                	cmp    %esi,%ebx
+80100e93:	7c f0                	jl     80100e85 <consolewrite+0x2d>
+  release(&cons.lock);
+80100e95:	83 ec 0c             	sub    $0xc,%esp
+80100e98:	68 00 78 11 80       	push   $0x80117800
+80100e9d:	e8 a5 77 00 00       	call   80108647 <release>
+  ilock(ip);
+80100ea2:	83 c4 04             	add    $0x4,%esp
+80100ea5:	ff 75 08             	push   0x8(%ebp)
+80100ea8:	e8 74 20 00 00       	call   80102f21 <ilock>
+
+  return n;
+}
+80100ead:	89 f0                	mov    %esi,%eax
+80100eaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100eb2:	5b                   	pop    %ebx
+80100eb3:	5e                   	pop    %esi
+80100eb4:	5f                   	pop    %edi
+80100eb5:	5d                   	pop    %ebp
+80100eb6:	c3                   	ret
+
+80100eb7 <cprintf>:
+{
+80100eb7:	55                   	push   %ebp
+80100eb8:	89 e5                	mov    %esp,%ebp
+80100eba:	57                   	push   %edi
+80100ebb:	56                   	push   %esi
+80100ebc:	53                   	push   %ebx
+80100ebd:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+80100ec0:	a1 34 78 11 80       	mov    0x80117834,%eax
+80100ec5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(locking)
+80100ec8:	85 c0                	test   %eax,%eax
+80100eca:	75 10                	jne    80100edc <cprintf+0x25>
+  if (fmt == 0)
+80100ecc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+80100ed0:	74 1c                	je     80100eee <cprintf+0x37>
+  argp = (uint*)(void*)(&fmt + 1);
+80100ed2:	8d 7d 0c             	lea    0xc(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100ed5:	be 00 00 00 00       	mov    $0x0,%esi
+80100eda:	eb 27                	jmp    80100f03 <cprintf+0x4c>
+    acquire(&cons.lock);
+80100edc:	83 ec 0c             	sub    $0xc,%esp
+80100edf:	68 00 78 11 80       	push   $0x80117800
+80100ee4:	e8 f9 76 00 00       	call   801085e2 <acquire>
+80100ee9:	83 c4 10             	add    $0x10,%esp
+80100eec:	eb de                	jmp    80100ecc <cprintf+0x15>
+    panic("null fmt");
+80100eee:	83 ec 0c             	sub    $0xc,%esp
+80100ef1:	68 4c bd 10 80       	push   $0x8010bd4c
+80100ef6:	e8 fb fc ff ff       	call   80100bf6 <panic>
+      consputc(c);
+80100efb:	e8 88 fe ff ff       	call   80100d88 <consputc>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100f00:	83 c6 01             	add    $0x1,%esi
+80100f03:	8b 55 08             	mov    0x8(%ebp),%edx
+80100f06:	0f b6 04 32          	movzbl (%edx,%esi,1),%eax
+80100f0a:	85 c0                	test   %eax,%eax
+80100f0c:	0f 84 b1 00 00 00    	je     80100fc3 <cprintf+0x10c>
+    if(c != '%'){
+80100f12:	83 f8 25             	cmp    $0x25,%eax
+80100f15:	75 e4                	jne    80100efb <cprintf+0x44>
+    c = fmt[++i] & 0xff;
+80100f17:	83 c6 01             	add    $0x1,%esi
+80100f1a:	0f b6 1c 32          	movzbl (%edx,%esi,1),%ebx
+    if(c == 0)
+80100f1e:	85 db                	test   %ebx,%ebx
+80100f20:	0f 84 9d 00 00 00    	je     80100fc3 <cprintf+0x10c>
+    switch(c){
+80100f26:	83 fb 70             	cmp    $0x70,%ebx
+80100f29:	74 2e                	je     80100f59 <cprintf+0xa2>
+80100f2b:	7f 22                	jg     80100f4f <cprintf+0x98>
+80100f2d:	83 fb 25             	cmp    $0x25,%ebx
+80100f30:	74 6c                	je     80100f9e <cprintf+0xe7>
+80100f32:	83 fb 64             	cmp    $0x64,%ebx
+80100f35:	75 76                	jne    80100fad <cprintf+0xf6>
+      printint(*argp++, 10, 1);
+80100f37:	8d 5f 04             	lea    0x4(%edi),%ebx
+80100f3a:	8b 07                	mov    (%edi),%eax
+80100f3c:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100f41:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100f46:	e8 98 fe ff ff       	call   80100de3 <printint>
+80100f4b:	89 df                	mov    %ebx,%edi
+      break;
+80100f4d:	eb b1                	jmp    80100f00 <cprintf+0x49>
+    switch(c){
+80100f4f:	83 fb 73             	cmp    $0x73,%ebx
+80100f52:	74 1d                	je     80100f71 <cprintf+0xba>
+80100f54:	83 fb 78             	cmp    $0x78,%ebx
+80100f57:	75 54                	jne    80100fad <cprintf+0xf6>
+      printint(*argp++, 16, 0);
+80100f59:	8d 5f 04             	lea    0x4(%edi),%ebx
+80100f5c:	8b 07                	mov    (%edi),%eax
+80100f5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+80100f63:	ba 10 00 00 00       	mov    $0x10,%edx
+80100f68:	e8 76 fe ff ff       	call   80100de3 <printint>
+80100f6d:	89 df                	mov    %ebx,%edi
+      break;
+80100f6f:	eb 8f                	jmp    80100f00 <cprintf+0x49>
+      if((s = (char*)*argp++) == 0)
+80100f71:	8d 47 04             	lea    0x4(%edi),%eax
+80100f74:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100f77:	8b 1f                	mov    (%edi),%ebx
+80100f79:	85 db                	test   %ebx,%ebx
+80100f7b:	75 12                	jne    80100f8f <cprintf+0xd8>
+        s = "(null)";
+80100f7d:	bb 45 bd 10 80       	mov    $0x8010bd45,%ebx
+80100f82:	eb 0b                	jmp    80100f8f <cprintf+0xd8>
+        consputc(*s);
+80100f84:	0f be c0             	movsbl %al,%eax
+80100f87:	e8 fc fd ff ff       	call   80100d88 <consputc>
+      for(; *s; s++)
+80100f8c:	83 c3 01             	add    $0x1,%ebx
+80100f8f:	0f b6 03             	movzbl (%ebx),%eax
+80100f92:	84 c0                	test   %al,%al
+80100f94:	75 ee                	jne    80100f84 <cprintf+0xcd>
+      if((s = (char*)*argp++) == 0)
+80100f96:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80100f99:	e9 62 ff ff ff       	jmp    80100f00 <cprintf+0x49>
+      consputc('%');
+80100f9e:	b8 25 00 00 00       	mov    $0x25,%eax
+80100fa3:	e8 e0 fd ff ff       	call   80100d88 <consputc>
+      break;
+80100fa8:	e9 53 ff ff ff       	jmp    80100f00 <cprintf+0x49>
+      consputc('%');
+80100fad:	b8 25 00 00 00       	mov    $0x25,%eax
+80100fb2:	e8 d1 fd ff ff       	call   80100d88 <consputc>
+      consputc(c);
+80100fb7:	89 d8                	mov    %ebx,%eax
+80100fb9:	e8 ca fd ff ff       	call   80100d88 <consputc>
+      break;
+80100fbe:	e9 3d ff ff ff       	jmp    80100f00 <cprintf+0x49>
+  if(locking)
+80100fc3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80100fc7:	75 08                	jne    80100fd1 <cprintf+0x11a>
+}
+80100fc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100fcc:	5b                   	pop    %ebx
+80100fcd:	5e                   	pop    %esi
+80100fce:	5f                   	pop    %edi
+80100fcf:	5d                   	pop    %ebp
+80100fd0:	c3                   	ret
+    release(&cons.lock);
+80100fd1:	83 ec 0c             	sub    $0xc,%esp
+80100fd4:	68 00 78 11 80       	push   $0x80117800
+80100fd9:	e8 69 76 00 00       	call   80108647 <release>
+80100fde:	83 c4 10             	add    $0x10,%esp
+}
+80100fe1:	eb e6                	jmp    80100fc9 <cprintf+0x112>
+
+80100fe3 <do_shutdown>:
+{
+80100fe3:	55                   	push   %ebp
+80100fe4:	89 e5                	mov    %esp,%ebp
+80100fe6:	83 ec 14             	sub    $0x14,%esp
+  cprintf("\nShutting down ...\n");
+80100fe9:	68 55 bd 10 80       	push   $0x8010bd55
+80100fee:	e8 c4 fe ff ff       	call   80100eb7 <cprintf>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100ff3:	b8 00 20 00 00       	mov    $0x2000,%eax
+80100ff8:	ba 04 06 00 00       	mov    $0x604,%edx
+80100ffd:	66 ef                	out    %ax,(%dx)
+  return;  // not reached
+80100fff:	83 c4 10             	add    $0x10,%esp
+}
+80101002:	c9                   	leave
+80101003:	c3                   	ret
+
+80101004 <consoleintr>:
+{
+80101004:	55                   	push   %ebp
+80101005:	89 e5                	mov    %esp,%ebp
+80101007:	57                   	push   %edi
+80101008:	56                   	push   %esi
+80101009:	53                   	push   %ebx
+8010100a:	83 ec 38             	sub    $0x38,%esp
+8010100d:	8b 75 08             	mov    0x8(%ebp),%esi
+  acquire(&cons.lock);
+80101010:	68 00 78 11 80       	push   $0x80117800
+80101015:	e8 c8 75 00 00       	call   801085e2 <acquire>
+  while((c = getc()) >= 0){
+8010101a:	83 c4 10             	add    $0x10,%esp
+  int shutdown = FALSE;
+8010101d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  int doctrlz = 0;
+80101024:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  int doctrls = 0;
+8010102b:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  int doctrlr = 0;
+80101032:	bf 00 00 00 00       	mov    $0x0,%edi
+  int doctrlf = 0;
+80101037:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  int c, doprocdump = 0;
+8010103e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  while((c = getc()) >= 0){
+80101045:	ff d6                	call   *%esi
+80101047:	89 c3                	mov    %eax,%ebx
+80101049:	85 c0                	test   %eax,%eax
+8010104b:	0f 88 48 01 00 00    	js     80101199 <consoleintr+0x195>
+    switch(c){
+80101051:	83 fb 1a             	cmp    $0x1a,%ebx
+80101054:	7f 1d                	jg     80101073 <consoleintr+0x6f>
+80101056:	83 fb 04             	cmp    $0x4,%ebx
+80101059:	7c 21                	jl     8010107c <consoleintr+0x78>
+8010105b:	8d 43 fc             	lea    -0x4(%ebx),%eax
+8010105e:	83 f8 16             	cmp    $0x16,%eax
+80101061:	77 19                	ja     8010107c <consoleintr+0x78>
+80101063:	ff 24 85 74 bd 10 80 	jmp    *-0x7fef428c(,%eax,4)
+8010106a:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+80101071:	eb d2                	jmp    80101045 <consoleintr+0x41>
+80101073:	83 fb 7f             	cmp    $0x7f,%ebx
+80101076:	0f 84 b1 00 00 00    	je     8010112d <consoleintr+0x129>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+8010107c:	85 db                	test   %ebx,%ebx
+8010107e:	74 c5                	je     80101045 <consoleintr+0x41>
+80101080:	a1 e8 77 11 80       	mov    0x801177e8,%eax
+80101085:	89 c2                	mov    %eax,%edx
+80101087:	2b 15 e0 77 11 80    	sub    0x801177e0,%edx
+8010108d:	83 fa 7f             	cmp    $0x7f,%edx
+80101090:	77 b3                	ja     80101045 <consoleintr+0x41>
+        c = (c == '\r') ? '\n' : c;
+80101092:	83 fb 0d             	cmp    $0xd,%ebx
+80101095:	0f 84 e8 00 00 00    	je     80101183 <consoleintr+0x17f>
+        input.buf[input.e++ % INPUT_BUF] = c;
+8010109b:	8d 50 01             	lea    0x1(%eax),%edx
+8010109e:	89 15 e8 77 11 80    	mov    %edx,0x801177e8
+801010a4:	83 e0 7f             	and    $0x7f,%eax
+801010a7:	88 98 60 77 11 80    	mov    %bl,-0x7fee88a0(%eax)
+        consputc(c);
+801010ad:	89 d8                	mov    %ebx,%eax
+801010af:	e8 d4 fc ff ff       	call   80100d88 <consputc>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+801010b4:	83 fb 0a             	cmp    $0xa,%ebx
+801010b7:	0f 94 c0             	sete   %al
+801010ba:	83 fb 04             	cmp    $0x4,%ebx
+801010bd:	0f 94 c2             	sete   %dl
+801010c0:	08 d0                	or     %dl,%al
+801010c2:	75 14                	jne    801010d8 <consoleintr+0xd4>
+801010c4:	a1 e0 77 11 80       	mov    0x801177e0,%eax
+801010c9:	83 e8 80             	sub    $0xffffff80,%eax
+801010cc:	39 05 e8 77 11 80    	cmp    %eax,0x801177e8
+801010d2:	0f 85 6d ff ff ff    	jne    80101045 <consoleintr+0x41>
+          input.w = input.e;
+801010d8:	a1 e8 77 11 80       	mov    0x801177e8,%eax
+801010dd:	a3 e4 77 11 80       	mov    %eax,0x801177e4
+          wakeup(&input.r);
+801010e2:	83 ec 0c             	sub    $0xc,%esp
+801010e5:	68 e0 77 11 80       	push   $0x801177e0
+801010ea:	e8 5a 5d 00 00       	call   80106e49 <wakeup>
+801010ef:	83 c4 10             	add    $0x10,%esp
+801010f2:	e9 4e ff ff ff       	jmp    80101045 <consoleintr+0x41>
+        input.e--;
+801010f7:	a3 e8 77 11 80       	mov    %eax,0x801177e8
+        consputc(BACKSPACE);
+801010fc:	b8 00 01 00 00       	mov    $0x100,%eax
+80101101:	e8 82 fc ff ff       	call   80100d88 <consputc>
+      while(input.e != input.w &&
+80101106:	a1 e8 77 11 80       	mov    0x801177e8,%eax
+8010110b:	3b 05 e4 77 11 80    	cmp    0x801177e4,%eax
+80101111:	0f 84 2e ff ff ff    	je     80101045 <consoleintr+0x41>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80101117:	83 e8 01             	sub    $0x1,%eax
+8010111a:	89 c2                	mov    %eax,%edx
+8010111c:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+8010111f:	80 ba 60 77 11 80 0a 	cmpb   $0xa,-0x7fee88a0(%edx)
+80101126:	75 cf                	jne    801010f7 <consoleintr+0xf3>
+80101128:	e9 18 ff ff ff       	jmp    80101045 <consoleintr+0x41>
+      if(input.e != input.w){
+8010112d:	a1 e8 77 11 80       	mov    0x801177e8,%eax
+80101132:	3b 05 e4 77 11 80    	cmp    0x801177e4,%eax
+80101138:	0f 84 07 ff ff ff    	je     80101045 <consoleintr+0x41>
+        input.e--;
+8010113e:	83 e8 01             	sub    $0x1,%eax
+80101141:	a3 e8 77 11 80       	mov    %eax,0x801177e8
+        consputc(BACKSPACE);
+80101146:	b8 00 01 00 00       	mov    $0x100,%eax
+8010114b:	e8 38 fc ff ff       	call   80100d88 <consputc>
+80101150:	e9 f0 fe ff ff       	jmp    80101045 <consoleintr+0x41>
+      doctrlr = 1;
+80101155:	bf 01 00 00 00       	mov    $0x1,%edi
+      break;
+8010115a:	e9 e6 fe ff ff       	jmp    80101045 <consoleintr+0x41>
+      doctrlf = 1;
+8010115f:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      break;
+80101166:	e9 da fe ff ff       	jmp    80101045 <consoleintr+0x41>
+      doctrls = 1;
+8010116b:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+      break;
+80101172:	e9 ce fe ff ff       	jmp    80101045 <consoleintr+0x41>
+      doctrlz = 1;
+80101177:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+      break;
+8010117e:	e9 c2 fe ff ff       	jmp    80101045 <consoleintr+0x41>
+        c = (c == '\r') ? '\n' : c;
+80101183:	bb 0a 00 00 00       	mov    $0xa,%ebx
+80101188:	e9 0e ff ff ff       	jmp    8010109b <consoleintr+0x97>
+      shutdown = TRUE;
+8010118d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+80101194:	e9 ac fe ff ff       	jmp    80101045 <consoleintr+0x41>
+  release(&cons.lock);
+80101199:	83 ec 0c             	sub    $0xc,%esp
+8010119c:	68 00 78 11 80       	push   $0x80117800
+801011a1:	e8 a1 74 00 00       	call   80108647 <release>
+  if (shutdown)
+801011a6:	83 c4 10             	add    $0x10,%esp
+801011a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+801011ad:	75 24                	jne    801011d3 <consoleintr+0x1cf>
+  if(doprocdump) {
+801011af:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+801011b3:	75 25                	jne    801011da <consoleintr+0x1d6>
+  if(doctrlr) {
+801011b5:	85 ff                	test   %edi,%edi
+801011b7:	75 28                	jne    801011e1 <consoleintr+0x1dd>
+  if(doctrlf) {
+801011b9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801011bd:	75 29                	jne    801011e8 <consoleintr+0x1e4>
+  if(doctrls) {
+801011bf:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+801011c3:	75 2a                	jne    801011ef <consoleintr+0x1eb>
+  if(doctrlz) {
+801011c5:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+801011c9:	75 2b                	jne    801011f6 <consoleintr+0x1f2>
+}
+801011cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801011ce:	5b                   	pop    %ebx
+801011cf:	5e                   	pop    %esi
+801011d0:	5f                   	pop    %edi
+801011d1:	5d                   	pop    %ebp
+801011d2:	c3                   	ret
+    do_shutdown();
+801011d3:	e8 0b fe ff ff       	call   80100fe3 <do_shutdown>
+801011d8:	eb d5                	jmp    801011af <consoleintr+0x1ab>
+    procdump();  // now call procdump() wo. cons.lock held
+801011da:	e8 17 71 00 00       	call   801082f6 <procdump>
+801011df:	eb d4                	jmp    801011b5 <consoleintr+0x1b1>
+    ctrlr();  
+801011e1:	e8 96 6e 00 00       	call   8010807c <ctrlr>
+801011e6:	eb d1                	jmp    801011b9 <consoleintr+0x1b5>
+    ctrlf();  
+801011e8:	e8 81 6f 00 00       	call   8010816e <ctrlf>
+801011ed:	eb d0                	jmp    801011bf <consoleintr+0x1bb>
+    ctrls(); 
+801011ef:	e8 d1 6f 00 00       	call   801081c5 <ctrls>
+801011f4:	eb cf                	jmp    801011c5 <consoleintr+0x1c1>
+    ctrlz();  
+801011f6:	e8 66 70 00 00       	call   80108261 <ctrlz>
+}
+801011fb:	eb ce                	jmp    801011cb <consoleintr+0x1c7>
+
+801011fd <consoleinit>:
+
+void
+consoleinit(void)
+{
+801011fd:	55                   	push   %ebp
+801011fe:	89 e5                	mov    %esp,%ebp
+80101200:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80101203:	68 69 bd 10 80       	push   $0x8010bd69
+80101208:	68 00 78 11 80       	push   $0x80117800
+8010120d:	e8 8c 72 00 00       	call   8010849e <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80101212:	c7 05 2c 88 11 80 58 	movl   $0x80100e58,0x8011882c
+80101219:	0e 10 80 
+  devsw[CONSOLE].read = consoleread;
+8010121c:	c7 05 28 88 11 80 14 	movl   $0x80100b14,0x80118828
+80101223:	0b 10 80 
+  cons.locking = 1;
+80101226:	c7 05 34 78 11 80 01 	movl   $0x1,0x80117834
+8010122d:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80101230:	83 c4 08             	add    $0x8,%esp
+80101233:	6a 00                	push   $0x0
+80101235:	6a 01                	push   $0x1
+80101237:	e8 56 34 00 00       	call   80104692 <ioapicenable>
+}
+8010123c:	83 c4 10             	add    $0x10,%esp
+8010123f:	c9                   	leave
+80101240:	c3                   	ret
+
+80101241 <exec>:
+#include "elf.h"
+
+
+int
+exec(char *path, char **argv)
+{
+80101241:	55                   	push   %ebp
+80101242:	89 e5                	mov    %esp,%ebp
+80101244:	57                   	push   %edi
+80101245:	56                   	push   %esi
+80101246:	53                   	push   %ebx
+80101247:	81 ec 4c 01 00 00    	sub    $0x14c,%esp
+  struct inode *ip, *exe, *oldexe;
+  struct seg seg[NSEG];
+  int nseg;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+8010124d:	e8 fa 56 00 00       	call   8010694c <myproc>
+80101252:	89 85 b8 fe ff ff    	mov    %eax,-0x148(%ebp)
+
+  begin_op();
+80101258:	e8 3a 40 00 00       	call   80105297 <begin_op>
+
+  if((ip = namei(path)) == 0){
+8010125d:	83 ec 0c             	sub    $0xc,%esp
+80101260:	ff 75 08             	push   0x8(%ebp)
+80101263:	e8 76 2a 00 00       	call   80103cde <namei>
+80101268:	89 85 c4 fe ff ff    	mov    %eax,-0x13c(%ebp)
+8010126e:	83 c4 10             	add    $0x10,%esp
+80101271:	85 c0                	test   %eax,%eax
+80101273:	74 51                	je     801012c6 <exec+0x85>
+    cprintf("exec: fail\n");
+#endif
+    return -1;
+  }
+  // No writes to the program from here on (see iexecref).
+  iexecref(ip, 1);
+80101275:	83 ec 08             	sub    $0x8,%esp
+80101278:	6a 01                	push   $0x1
+8010127a:	8b 9d c4 fe ff ff    	mov    -0x13c(%ebp),%ebx
+80101280:	53                   	push   %ebx
+80101281:	e8 b5 1d 00 00       	call   8010303b <iexecref>
+  ilock(ip);
+80101286:	89 1c 24             	mov    %ebx,(%esp)
+80101289:	e8 93 1c 00 00       	call   80102f21 <ilock>
+  pgdir = 0;
+  exe = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+8010128e:	6a 34                	push   $0x34
+80101290:	6a 00                	push   $0x0
+80101292:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80101298:	50                   	push   %eax
+80101299:	53                   	push   %ebx
+8010129a:	e8 8a 1f 00 00       	call   80103229 <readi>
+8010129f:	83 c4 20             	add    $0x20,%esp
+801012a2:	83 f8 34             	cmp    $0x34,%eax
+801012a5:	0f 85 aa 03 00 00    	jne    80101655 <exec+0x414>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+801012ab:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+801012b2:	45 4c 46 
+801012b5:	74 1e                	je     801012d5 <exec+0x94>
+  pgdir = 0;
+801012b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  exe = 0;
+801012bc:	be 00 00 00 00       	mov    $0x0,%esi
+801012c1:	e9 99 03 00 00       	jmp    8010165f <exec+0x41e>
+    end_op();
+801012c6:	e8 46 40 00 00       	call   80105311 <end_op>
+    return -1;
+801012cb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801012d0:	e9 f5 03 00 00       	jmp    801016ca <exec+0x489>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+801012d5:	e8 df a5 00 00       	call   8010b8b9 <setupkvm>
+801012da:	89 c7                	mov    %eax,%edi
+801012dc:	85 c0                	test   %eax,%eax
+801012de:	0f 84 ee 03 00 00    	je     801016d2 <exec+0x491>
+  // Record the program's segments. Their pages are only
+  // read in when first touched (see pagefault in vm.c);
+  // segments beyond the first NSEG are loaded now.
+  sz = 0;
+  nseg = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+801012e4:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  nseg = 0;
+801012ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  sz = 0;
+801012ef:	c7 85 bc fe ff ff 00 	movl   $0x0,-0x144(%ebp)
+801012f6:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+801012f9:	be 00 00 00 00       	mov    $0x0,%esi
+801012fe:	8b 9d c4 fe ff ff    	mov    -0x13c(%ebp),%ebx
+80101304:	89 bd b4 fe ff ff    	mov    %edi,-0x14c(%ebp)
+8010130a:	89 cf                	mov    %ecx,%edi
+8010130c:	eb 63                	jmp    80101371 <exec+0x130>
+      seg[nseg].vaddr = ph.vaddr;
+      seg[nseg].filesz = ph.filesz;
+      seg[nseg].off = ph.off;
+      nseg++;
+    } else {
+      if(allocuvm(pgdir, ph.vaddr, ph.vaddr + ph.memsz) == 0)
+8010130e:	83 ec 04             	sub    $0x4,%esp
+80101311:	50                   	push   %eax
+80101312:	52                   	push   %edx
+80101313:	ff b5 b4 fe ff ff    	push   -0x14c(%ebp)
+80101319:	e8 46 a4 00 00       	call   8010b764 <allocuvm>
+8010131e:	83 c4 10             	add    $0x10,%esp
+80101321:	85 c0                	test   %eax,%eax
+80101323:	0f 84 fd 03 00 00    	je     80101726 <exec+0x4e5>
+        goto bad;
+      if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+80101329:	83 ec 0c             	sub    $0xc,%esp
+8010132c:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+80101332:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+80101338:	53                   	push   %ebx
+80101339:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+8010133f:	ff b5 b4 fe ff ff    	push   -0x14c(%ebp)
+80101345:	e8 ed a2 00 00       	call   8010b637 <loaduvm>
+8010134a:	83 c4 20             	add    $0x20,%esp
+8010134d:	85 c0                	test   %eax,%eax
+8010134f:	0f 89 b9 00 00 00    	jns    8010140e <exec+0x1cd>
+  exe = 0;
+80101355:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+8010135b:	be 00 00 00 00       	mov    $0x0,%esi
+80101360:	e9 fa 02 00 00       	jmp    8010165f <exec+0x41e>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101365:	83 c6 01             	add    $0x1,%esi
+80101368:	8b 85 c0 fe ff ff    	mov    -0x140(%ebp),%eax
+8010136e:	83 c0 20             	add    $0x20,%eax
+80101371:	0f b7 95 50 ff ff ff 	movzwl -0xb0(%ebp),%edx
+80101378:	39 f2                	cmp    %esi,%edx
+8010137a:	0f 8e b1 00 00 00    	jle    80101431 <exec+0x1f0>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80101380:	89 85 c0 fe ff ff    	mov    %eax,-0x140(%ebp)
+80101386:	6a 20                	push   $0x20
+80101388:	50                   	push   %eax
+80101389:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+8010138f:	50                   	push   %eax
+80101390:	53                   	push   %ebx
+80101391:	e8 93 1e 00 00       	call   80103229 <readi>
+80101396:	83 c4 10             	add    $0x10,%esp
+80101399:	83 f8 20             	cmp    $0x20,%eax
+8010139c:	0f 85 34 03 00 00    	jne    801016d6 <exec+0x495>
+    if(ph.type != ELF_PROG_LOAD)
+801013a2:	83 bd d4 fe ff ff 01 	cmpl   $0x1,-0x12c(%ebp)
+801013a9:	75 ba                	jne    80101365 <exec+0x124>
+    if(ph.memsz < ph.filesz)
+801013ab:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+801013b1:	8b 8d e4 fe ff ff    	mov    -0x11c(%ebp),%ecx
+801013b7:	39 c8                	cmp    %ecx,%eax
+801013b9:	0f 82 27 03 00 00    	jb     801016e6 <exec+0x4a5>
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+801013bf:	8b 95 dc fe ff ff    	mov    -0x124(%ebp),%edx
+801013c5:	01 d0                	add    %edx,%eax
+801013c7:	0f 82 29 03 00 00    	jb     801016f6 <exec+0x4b5>
+    if(ph.vaddr + ph.memsz >= KERNBASE)
+801013cd:	85 c0                	test   %eax,%eax
+801013cf:	0f 88 31 03 00 00    	js     80101706 <exec+0x4c5>
+    if(ph.vaddr % PGSIZE != 0)
+801013d5:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+801013db:	0f 85 35 03 00 00    	jne    80101716 <exec+0x4d5>
+    if(nseg < NSEG){
+801013e1:	83 ff 03             	cmp    $0x3,%edi
+801013e4:	0f 8f 24 ff ff ff    	jg     8010130e <exec+0xcd>
+      seg[nseg].vaddr = ph.vaddr;
+801013ea:	8d 04 7f             	lea    (%edi,%edi,2),%eax
+801013ed:	c1 e0 02             	shl    $0x2,%eax
+801013f0:	89 94 05 f4 fe ff ff 	mov    %edx,-0x10c(%ebp,%eax,1)
+      seg[nseg].filesz = ph.filesz;
+801013f7:	89 8c 05 f8 fe ff ff 	mov    %ecx,-0x108(%ebp,%eax,1)
+      seg[nseg].off = ph.off;
+801013fe:	8b 95 d8 fe ff ff    	mov    -0x128(%ebp),%edx
+80101404:	89 94 05 fc fe ff ff 	mov    %edx,-0x104(%ebp,%eax,1)
+      nseg++;
+8010140b:	83 c7 01             	add    $0x1,%edi
+        goto bad;
+    }
+    if(ph.vaddr + ph.memsz > sz)
+8010140e:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+80101414:	03 85 dc fe ff ff    	add    -0x124(%ebp),%eax
+8010141a:	39 85 bc fe ff ff    	cmp    %eax,-0x144(%ebp)
+80101420:	0f 83 3f ff ff ff    	jae    80101365 <exec+0x124>
+      sz = ph.vaddr + ph.memsz;
+80101426:	89 85 bc fe ff ff    	mov    %eax,-0x144(%ebp)
+8010142c:	e9 34 ff ff ff       	jmp    80101365 <exec+0x124>
+  }
+  // Hold on to ip for the pages still to be read in.
+  iunlock(ip);
+80101431:	89 bd b0 fe ff ff    	mov    %edi,-0x150(%ebp)
+80101437:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+8010143d:	83 ec 0c             	sub    $0xc,%esp
+80101440:	ff b5 c4 fe ff ff    	push   -0x13c(%ebp)
+80101446:	e8 ab 1b 00 00       	call   80102ff6 <iunlock>
+  end_op();
+8010144b:	e8 c1 3e 00 00       	call   80105311 <end_op>
+  exe = ip;
+  ip = 0;
+
+  // Allocate two pages at the next page boundary.
+  // Make the first inaccessible.  Use the second as the user stack.
+  sz = PGROUNDUP(sz);
+80101450:	8b 85 bc fe ff ff    	mov    -0x144(%ebp),%eax
+80101456:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010145b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80101460:	83 c4 0c             	add    $0xc,%esp
+80101463:	8d 90 00 20 00 00    	lea    0x2000(%eax),%edx
+80101469:	52                   	push   %edx
+8010146a:	50                   	push   %eax
+8010146b:	57                   	push   %edi
+8010146c:	e8 f3 a2 00 00       	call   8010b764 <allocuvm>
+80101471:	89 c3                	mov    %eax,%ebx
+80101473:	89 85 bc fe ff ff    	mov    %eax,-0x144(%ebp)
+80101479:	83 c4 10             	add    $0x10,%esp
+8010147c:	85 c0                	test   %eax,%eax
+8010147e:	75 15                	jne    80101495 <exec+0x254>
+  exe = ip;
+80101480:	8b b5 c4 fe ff ff    	mov    -0x13c(%ebp),%esi
+  ip = 0;
+80101486:	c7 85 c4 fe ff ff 00 	movl   $0x0,-0x13c(%ebp)
+8010148d:	00 00 00 
+80101490:	e9 ca 01 00 00       	jmp    8010165f <exec+0x41e>
+    goto bad;
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80101495:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+8010149b:	83 ec 08             	sub    $0x8,%esp
+8010149e:	50                   	push   %eax
+8010149f:	57                   	push   %edi
+801014a0:	e8 99 a4 00 00       	call   8010b93e <clearpteu>
+  sp = sz;
+
+  // Push argument strings, prepare rest of stack in ustack.
+  for(argc = 0; argv[argc]; argc++) {
+801014a5:	83 c4 10             	add    $0x10,%esp
+801014a8:	be 00 00 00 00       	mov    $0x0,%esi
+801014ad:	89 bd c0 fe ff ff    	mov    %edi,-0x140(%ebp)
+801014b3:	eb 0a                	jmp    801014bf <exec+0x27e>
+    if(argc >= MAXARG)
+      goto bad;
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+      goto bad;
+    ustack[3+argc] = sp;
+801014b5:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+  for(argc = 0; argv[argc]; argc++) {
+801014bc:	83 c6 01             	add    $0x1,%esi
+801014bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+801014c2:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+801014c5:	8b 07                	mov    (%edi),%eax
+801014c7:	85 c0                	test   %eax,%eax
+801014c9:	74 58                	je     80101523 <exec+0x2e2>
+    if(argc >= MAXARG)
+801014cb:	83 fe 1f             	cmp    $0x1f,%esi
+801014ce:	0f 87 62 02 00 00    	ja     80101736 <exec+0x4f5>
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+801014d4:	83 ec 0c             	sub    $0xc,%esp
+801014d7:	50                   	push   %eax
+801014d8:	e8 5a 73 00 00       	call   80108837 <strlen>
+801014dd:	29 c3                	sub    %eax,%ebx
+801014df:	83 eb 01             	sub    $0x1,%ebx
+801014e2:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+801014e5:	83 c4 04             	add    $0x4,%esp
+801014e8:	ff 37                	push   (%edi)
+801014ea:	e8 48 73 00 00       	call   80108837 <strlen>
+801014ef:	83 c0 01             	add    $0x1,%eax
+801014f2:	50                   	push   %eax
+801014f3:	ff 37                	push   (%edi)
+801014f5:	53                   	push   %ebx
+801014f6:	ff b5 c0 fe ff ff    	push   -0x140(%ebp)
+801014fc:	e8 04 a7 00 00       	call   8010bc05 <copyout>
+80101501:	83 c4 20             	add    $0x20,%esp
+80101504:	85 c0                	test   %eax,%eax
+80101506:	79 ad                	jns    801014b5 <exec+0x274>
+  exe = ip;
+80101508:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+8010150e:	8b b5 c4 fe ff ff    	mov    -0x13c(%ebp),%esi
+  ip = 0;
+80101514:	c7 85 c4 fe ff ff 00 	movl   $0x0,-0x13c(%ebp)
+8010151b:	00 00 00 
+8010151e:	e9 3c 01 00 00       	jmp    8010165f <exec+0x41e>
+  }
+  ustack[3+argc] = 0;
+80101523:	89 85 b4 fe ff ff    	mov    %eax,-0x14c(%ebp)
+80101529:	89 d9                	mov    %ebx,%ecx
+8010152b:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+80101531:	c7 84 b5 64 ff ff ff 	movl   $0x0,-0x9c(%ebp,%esi,4)
+80101538:	00 00 00 00 
+
+  ustack[0] = 0xffffffff;  // fake return PC
+8010153c:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80101543:	ff ff ff 
+  ustack[1] = argc;
+80101546:	89 b5 5c ff ff ff    	mov    %esi,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010154c:	8d 14 b5 04 00 00 00 	lea    0x4(,%esi,4),%edx
+80101553:	89 d8                	mov    %ebx,%eax
+80101555:	29 d0                	sub    %edx,%eax
+80101557:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+
+  sp -= (3+argc+1) * 4;
+8010155d:	8d 04 b5 10 00 00 00 	lea    0x10(,%esi,4),%eax
+80101564:	29 c1                	sub    %eax,%ecx
+80101566:	89 8d c0 fe ff ff    	mov    %ecx,-0x140(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+8010156c:	50                   	push   %eax
+8010156d:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+80101573:	50                   	push   %eax
+80101574:	51                   	push   %ecx
+80101575:	57                   	push   %edi
+80101576:	e8 8a a6 00 00       	call   8010bc05 <copyout>
+8010157b:	83 c4 10             	add    $0x10,%esp
+8010157e:	85 c0                	test   %eax,%eax
+80101580:	0f 88 cb 01 00 00    	js     80101751 <exec+0x510>
+    goto bad;
+
+  // Save program name for debugging.
+  for(last=s=path; *s; s++)
+80101586:	8b 55 08             	mov    0x8(%ebp),%edx
+80101589:	89 d0                	mov    %edx,%eax
+8010158b:	eb 03                	jmp    80101590 <exec+0x34f>
+8010158d:	83 c0 01             	add    $0x1,%eax
+80101590:	0f b6 08             	movzbl (%eax),%ecx
+80101593:	84 c9                	test   %cl,%cl
+80101595:	74 0a                	je     801015a1 <exec+0x360>
+    if(*s == '/')
+80101597:	80 f9 2f             	cmp    $0x2f,%cl
+8010159a:	75 f1                	jne    8010158d <exec+0x34c>
+      last = s+1;
+8010159c:	8d 50 01             	lea    0x1(%eax),%edx
+8010159f:	eb ec                	jmp    8010158d <exec+0x34c>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+801015a1:	8b b5 b8 fe ff ff    	mov    -0x148(%ebp),%esi
+801015a7:	8d 86 b4 00 00 00    	lea    0xb4(%esi),%eax
+801015ad:	83 ec 04             	sub    $0x4,%esp
+801015b0:	6a 10                	push   $0x10
+801015b2:	52                   	push   %edx
+801015b3:	50                   	push   %eax
+801015b4:	e8 41 72 00 00       	call   801087fa <safestrcpy>
+
+  // Commit to the user image.
+  oldpgdir = curproc->pgdir;
+801015b9:	89 f1                	mov    %esi,%ecx
+801015bb:	8b 5e 04             	mov    0x4(%esi),%ebx
+  oldexe = curproc->exe;
+801015be:	8b 76 7c             	mov    0x7c(%esi),%esi
+  curproc->pgdir = pgdir;
+801015c1:	89 79 04             	mov    %edi,0x4(%ecx)
+  curproc->sz = sz;
+801015c4:	8b 85 bc fe ff ff    	mov    -0x144(%ebp),%eax
+801015ca:	89 01                	mov    %eax,(%ecx)
+  curproc->exe = exe;
+801015cc:	89 cf                	mov    %ecx,%edi
+801015ce:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+801015d4:	89 41 7c             	mov    %eax,0x7c(%ecx)
+  curproc->nseg = nseg;
+801015d7:	8b 85 b0 fe ff ff    	mov    -0x150(%ebp),%eax
+801015dd:	89 81 b0 00 00 00    	mov    %eax,0xb0(%ecx)
+  memmove(curproc->seg, seg, sizeof(seg));
+801015e3:	8d 81 80 00 00 00    	lea    0x80(%ecx),%eax
+801015e9:	83 c4 0c             	add    $0xc,%esp
+801015ec:	6a 30                	push   $0x30
+801015ee:	8d 95 f4 fe ff ff    	lea    -0x10c(%ebp),%edx
+801015f4:	52                   	push   %edx
+801015f5:	50                   	push   %eax
+801015f6:	e8 0b 71 00 00       	call   80108706 <memmove>
+  curproc->tf->eip = elf.entry;  // main
+801015fb:	8b 47 20             	mov    0x20(%edi),%eax
+801015fe:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+80101604:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+80101607:	8b 47 20             	mov    0x20(%edi),%eax
+8010160a:	8b 95 c0 fe ff ff    	mov    -0x140(%ebp),%edx
+80101610:	89 50 44             	mov    %edx,0x44(%eax)
+  switchuvm(curproc);
+80101613:	89 3c 24             	mov    %edi,(%esp)
+80101616:	e8 53 9e 00 00       	call   8010b46e <switchuvm>
+  freevm(oldpgdir);
+8010161b:	89 1c 24             	mov    %ebx,(%esp)
+8010161e:	e8 26 a2 00 00       	call   8010b849 <freevm>
+  if(oldexe){
+80101623:	83 c4 10             	add    $0x10,%esp
+80101626:	85 f6                	test   %esi,%esi
+80101628:	0f 84 3a 01 00 00    	je     80101768 <exec+0x527>
+    begin_op();
+8010162e:	e8 64 3c 00 00       	call   80105297 <begin_op>
+    iexecref(oldexe, -1);
+80101633:	83 ec 08             	sub    $0x8,%esp
+80101636:	6a ff                	push   $0xffffffff
+80101638:	56                   	push   %esi
+80101639:	e8 fd 19 00 00       	call   8010303b <iexecref>
+    iput(oldexe);
+8010163e:	89 34 24             	mov    %esi,(%esp)
+80101641:	e8 39 1a 00 00       	call   8010307f <iput>
+    end_op();
+80101646:	e8 c6 3c 00 00       	call   80105311 <end_op>
+8010164b:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+8010164e:	b8 00 00 00 00       	mov    $0x0,%eax
+80101653:	eb 75                	jmp    801016ca <exec+0x489>
+  pgdir = 0;
+80101655:	bf 00 00 00 00       	mov    $0x0,%edi
+  exe = 0;
+8010165a:	be 00 00 00 00       	mov    $0x0,%esi
+
+bad:
+  if(pgdir)
+8010165f:	85 ff                	test   %edi,%edi
+80101661:	74 0c                	je     8010166f <exec+0x42e>
+    freevm(pgdir);
+80101663:	83 ec 0c             	sub    $0xc,%esp
+80101666:	57                   	push   %edi
+80101667:	e8 dd a1 00 00       	call   8010b849 <freevm>
+8010166c:	83 c4 10             	add    $0x10,%esp
+  if(ip){
+8010166f:	8b bd c4 fe ff ff    	mov    -0x13c(%ebp),%edi
+80101675:	85 ff                	test   %edi,%edi
+80101677:	74 24                	je     8010169d <exec+0x45c>
+    iunlock(ip);
+80101679:	83 ec 0c             	sub    $0xc,%esp
+8010167c:	57                   	push   %edi
+8010167d:	e8 74 19 00 00       	call   80102ff6 <iunlock>
+    iexecref(ip, -1);
+80101682:	83 c4 08             	add    $0x8,%esp
+80101685:	6a ff                	push   $0xffffffff
+80101687:	57                   	push   %edi
+80101688:	e8 ae 19 00 00       	call   8010303b <iexecref>
+    iput(ip);
+8010168d:	89 3c 24             	mov    %edi,(%esp)
+80101690:	e8 ea 19 00 00       	call   8010307f <iput>
+    end_op();
+80101695:	e8 77 3c 00 00       	call   80105311 <end_op>
+8010169a:	83 c4 10             	add    $0x10,%esp
+  }
+  if(exe){
+8010169d:	85 f6                	test   %esi,%esi
+8010169f:	0f 84 cd 00 00 00    	je     80101772 <exec+0x531>
+    begin_op();
+801016a5:	e8 ed 3b 00 00       	call   80105297 <begin_op>
+    iexecref(exe, -1);
+801016aa:	83 ec 08             	sub    $0x8,%esp
+801016ad:	6a ff                	push   $0xffffffff
+801016af:	56                   	push   %esi
+801016b0:	e8 86 19 00 00       	call   8010303b <iexecref>
+    iput(exe);
+801016b5:	89 34 24             	mov    %esi,(%esp)
+801016b8:	e8 c2 19 00 00       	call   8010307f <iput>
+    end_op();
+801016bd:	e8 4f 3c 00 00       	call   80105311 <end_op>
+801016c2:	83 c4 10             	add    $0x10,%esp
+  }
+  return -1;
+801016c5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801016ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801016cd:	5b                   	pop    %ebx
+801016ce:	5e                   	pop    %esi
+801016cf:	5f                   	pop    %edi
+801016d0:	5d                   	pop    %ebp
+801016d1:	c3                   	ret
+  exe = 0;
+801016d2:	89 c6                	mov    %eax,%esi
+801016d4:	eb 89                	jmp    8010165f <exec+0x41e>
+801016d6:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+801016dc:	be 00 00 00 00       	mov    $0x0,%esi
+801016e1:	e9 79 ff ff ff       	jmp    8010165f <exec+0x41e>
+801016e6:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+801016ec:	be 00 00 00 00       	mov    $0x0,%esi
+801016f1:	e9 69 ff ff ff       	jmp    8010165f <exec+0x41e>
+801016f6:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+801016fc:	be 00 00 00 00       	mov    $0x0,%esi
+80101701:	e9 59 ff ff ff       	jmp    8010165f <exec+0x41e>
+80101706:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+8010170c:	be 00 00 00 00       	mov    $0x0,%esi
+80101711:	e9 49 ff ff ff       	jmp    8010165f <exec+0x41e>
+80101716:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+8010171c:	be 00 00 00 00       	mov    $0x0,%esi
+80101721:	e9 39 ff ff ff       	jmp    8010165f <exec+0x41e>
+80101726:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+8010172c:	be 00 00 00 00       	mov    $0x0,%esi
+80101731:	e9 29 ff ff ff       	jmp    8010165f <exec+0x41e>
+  exe = ip;
+80101736:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+8010173c:	8b b5 c4 fe ff ff    	mov    -0x13c(%ebp),%esi
+  ip = 0;
+80101742:	c7 85 c4 fe ff ff 00 	movl   $0x0,-0x13c(%ebp)
+80101749:	00 00 00 
+8010174c:	e9 0e ff ff ff       	jmp    8010165f <exec+0x41e>
+  exe = ip;
+80101751:	8b b5 c4 fe ff ff    	mov    -0x13c(%ebp),%esi
+  ip = 0;
+80101757:	8b 85 b4 fe ff ff    	mov    -0x14c(%ebp),%eax
+8010175d:	89 85 c4 fe ff ff    	mov    %eax,-0x13c(%ebp)
+80101763:	e9 f7 fe ff ff       	jmp    8010165f <exec+0x41e>
+  return 0;
+80101768:	b8 00 00 00 00       	mov    $0x0,%eax
+8010176d:	e9 58 ff ff ff       	jmp    801016ca <exec+0x489>
+  return -1;
+80101772:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101777:	e9 4e ff ff ff       	jmp    801016ca <exec+0x489>
+
+8010177c <fileadd>:
+
+// Put the n files at f on the free list.
+static void
+fileadd(struct file *f, int n)
+{
+  for(; n > 0; n--, f++){
+8010177c:	eb 14                	jmp    80101792 <fileadd+0x16>
+    f->fnext = ftable.free;
+8010177e:	8b 0d 74 78 11 80    	mov    0x80117874,%ecx
+80101784:	89 48 08             	mov    %ecx,0x8(%eax)
+    ftable.free = f;
+80101787:	a3 74 78 11 80       	mov    %eax,0x80117874
+  for(; n > 0; n--, f++){
+8010178c:	83 ea 01             	sub    $0x1,%edx
+8010178f:	83 c0 28             	add    $0x28,%eax
+80101792:	85 d2                	test   %edx,%edx
+80101794:	7f e8                	jg     8010177e <fileadd+0x2>
+  }
+}
+80101796:	c3                   	ret
+
+80101797 <fileinit>:
+
+void
+fileinit(void)
+{
+80101797:	55                   	push   %ebp
+80101798:	89 e5                	mov    %esp,%ebp
+8010179a:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+8010179d:	68 e1 bd 10 80       	push   $0x8010bde1
+801017a2:	68 40 78 11 80       	push   $0x80117840
+801017a7:	e8 f2 6c 00 00       	call   8010849e <initlock>
+  fileadd(ftable.file, NFILE);
+801017ac:	ba 64 00 00 00       	mov    $0x64,%edx
+801017b1:	b8 78 78 11 80       	mov    $0x80117878,%eax
+801017b6:	e8 c1 ff ff ff       	call   8010177c <fileadd>
+}
+801017bb:	83 c4 10             	add    $0x10,%esp
+801017be:	c9                   	leave
+801017bf:	c3                   	ret
+
+801017c0 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+801017c0:	55                   	push   %ebp
+801017c1:	89 e5                	mov    %esp,%ebp
+801017c3:	53                   	push   %ebx
+801017c4:	83 ec 10             	sub    $0x10,%esp
+  struct file *f;
+
+  acquire(&ftable.lock);
+801017c7:	68 40 78 11 80       	push   $0x80117840
+801017cc:	e8 11 6e 00 00       	call   801085e2 <acquire>
+  if(ftable.free == 0 && (f = (struct file*)kalloc()) != 0){
+801017d1:	83 c4 10             	add    $0x10,%esp
+801017d4:	83 3d 74 78 11 80 00 	cmpl   $0x0,0x80117874
+801017db:	74 2d                	je     8010180a <filealloc+0x4a>
+    memset(f, 0, PGSIZE);
+    fileadd(f, PGSIZE / sizeof(*f));
+  }
+  if((f = ftable.free) != 0){
+801017dd:	8b 1d 74 78 11 80    	mov    0x80117874,%ebx
+801017e3:	85 db                	test   %ebx,%ebx
+801017e5:	74 0f                	je     801017f6 <filealloc+0x36>
+    ftable.free = f->fnext;
+801017e7:	8b 43 08             	mov    0x8(%ebx),%eax
+801017ea:	a3 74 78 11 80       	mov    %eax,0x80117874
+    f->ref = 1;
+801017ef:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+  }
+  release(&ftable.lock);
+801017f6:	83 ec 0c             	sub    $0xc,%esp
+801017f9:	68 40 78 11 80       	push   $0x80117840
+801017fe:	e8 44 6e 00 00       	call   80108647 <release>
+  return f;
+}
+80101803:	89 d8                	mov    %ebx,%eax
+80101805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101808:	c9                   	leave
+80101809:	c3                   	ret
+  if(ftable.free == 0 && (f = (struct file*)kalloc()) != 0){
+8010180a:	e8 21 33 00 00       	call   80104b30 <kalloc>
+8010180f:	89 c3                	mov    %eax,%ebx
+80101811:	85 c0                	test   %eax,%eax
+80101813:	74 c8                	je     801017dd <filealloc+0x1d>
+    memset(f, 0, PGSIZE);
+80101815:	83 ec 04             	sub    $0x4,%esp
+80101818:	68 00 10 00 00       	push   $0x1000
+8010181d:	6a 00                	push   $0x0
+8010181f:	50                   	push   %eax
+80101820:	e8 69 6e 00 00       	call   8010868e <memset>
+    fileadd(f, PGSIZE / sizeof(*f));
+80101825:	ba 66 00 00 00       	mov    $0x66,%edx
+8010182a:	89 d8                	mov    %ebx,%eax
+8010182c:	e8 4b ff ff ff       	call   8010177c <fileadd>
+80101831:	83 c4 10             	add    $0x10,%esp
+80101834:	eb a7                	jmp    801017dd <filealloc+0x1d>
+
+80101836 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80101836:	55                   	push   %ebp
+80101837:	89 e5                	mov    %esp,%ebp
+80101839:	53                   	push   %ebx
+8010183a:	83 ec 10             	sub    $0x10,%esp
+8010183d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+80101840:	68 40 78 11 80       	push   $0x80117840
+80101845:	e8 98 6d 00 00       	call   801085e2 <acquire>
+  if(f->ref < 1)
+8010184a:	8b 43 04             	mov    0x4(%ebx),%eax
+8010184d:	83 c4 10             	add    $0x10,%esp
+80101850:	85 c0                	test   %eax,%eax
+80101852:	7e 1a                	jle    8010186e <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+80101854:	83 c0 01             	add    $0x1,%eax
+80101857:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+8010185a:	83 ec 0c             	sub    $0xc,%esp
+8010185d:	68 40 78 11 80       	push   $0x80117840
+80101862:	e8 e0 6d 00 00       	call   80108647 <release>
+  return f;
+}
+80101867:	89 d8                	mov    %ebx,%eax
+80101869:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010186c:	c9                   	leave
+8010186d:	c3                   	ret
+    panic("filedup");
+8010186e:	83 ec 0c             	sub    $0xc,%esp
+80101871:	68 e8 bd 10 80       	push   $0x8010bde8
+80101876:	e8 7b f3 ff ff       	call   80100bf6 <panic>
+
+8010187b <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+8010187b:	55                   	push   %ebp
+8010187c:	89 e5                	mov    %esp,%ebp
+8010187e:	53                   	push   %ebx
+8010187f:	83 ec 40             	sub    $0x40,%esp
+80101882:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+80101885:	68 40 78 11 80       	push   $0x80117840
+8010188a:	e8 53 6d 00 00       	call   801085e2 <acquire>
+  if(f->ref < 1)
+8010188f:	8b 43 04             	mov    0x4(%ebx),%eax
+80101892:	83 c4 10             	add    $0x10,%esp
+80101895:	85 c0                	test   %eax,%eax
+80101897:	0f 8e 9b 00 00 00    	jle    80101938 <fileclose+0xbd>
+    panic("fileclose");
+  if(--f->ref > 0){
+8010189d:	83 e8 01             	sub    $0x1,%eax
+801018a0:	89 43 04             	mov    %eax,0x4(%ebx)
+801018a3:	85 c0                	test   %eax,%eax
+801018a5:	0f 8f 9a 00 00 00    	jg     80101945 <fileclose+0xca>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+801018ab:	8b 03                	mov    (%ebx),%eax
+801018ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+801018b0:	8b 43 04             	mov    0x4(%ebx),%eax
+801018b3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801018b6:	8b 43 08             	mov    0x8(%ebx),%eax
+801018b9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801018bc:	8b 43 0c             	mov    0xc(%ebx),%eax
+801018bf:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801018c2:	8b 43 10             	mov    0x10(%ebx),%eax
+801018c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801018c8:	8b 43 14             	mov    0x14(%ebx),%eax
+801018cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801018ce:	8b 43 18             	mov    0x18(%ebx),%eax
+801018d1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+801018d4:	8b 43 1c             	mov    0x1c(%ebx),%eax
+801018d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+801018da:	8b 43 20             	mov    0x20(%ebx),%eax
+801018dd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+801018e0:	8b 43 24             	mov    0x24(%ebx),%eax
+801018e3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  f->ref = 0;
+801018e6:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  f->type = FD_NONE;
+801018ed:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  f->fnext = ftable.free;
+801018f3:	a1 74 78 11 80       	mov    0x80117874,%eax
+801018f8:	89 43 08             	mov    %eax,0x8(%ebx)
+  ftable.free = f;
+801018fb:	89 1d 74 78 11 80    	mov    %ebx,0x80117874
+  release(&ftable.lock);
+80101901:	83 ec 0c             	sub    $0xc,%esp
+80101904:	68 40 78 11 80       	push   $0x80117840
+80101909:	e8 39 6d 00 00       	call   80108647 <release>
+
+  if(ff.type == FD_PIPE)
+8010190e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80101911:	83 c4 10             	add    $0x10,%esp
+80101914:	83 f8 01             	cmp    $0x1,%eax
+80101917:	74 41                	je     8010195a <fileclose+0xdf>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+80101919:	83 f8 02             	cmp    $0x2,%eax
+8010191c:	75 37                	jne    80101955 <fileclose+0xda>
+    begin_op();
+8010191e:	e8 74 39 00 00       	call   80105297 <begin_op>
+    iput(ff.ip);
+80101923:	83 ec 0c             	sub    $0xc,%esp
+80101926:	ff 75 e4             	push   -0x1c(%ebp)
+80101929:	e8 51 17 00 00       	call   8010307f <iput>
+    end_op();
+8010192e:	e8 de 39 00 00       	call   80105311 <end_op>
+80101933:	83 c4 10             	add    $0x10,%esp
+80101936:	eb 1d                	jmp    80101955 <fileclose+0xda>
+    panic("fileclose");
+80101938:	83 ec 0c             	sub    $0xc,%esp
+8010193b:	68 f0 bd 10 80       	push   $0x8010bdf0
+80101940:	e8 b1 f2 ff ff       	call   80100bf6 <panic>
+    release(&ftable.lock);
+80101945:	83 ec 0c             	sub    $0xc,%esp
+80101948:	68 40 78 11 80       	push   $0x80117840
+8010194d:	e8 f5 6c 00 00       	call   80108647 <release>
+    return;
+80101952:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80101955:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101958:	c9                   	leave
+80101959:	c3                   	ret
+    pipeclose(ff.pipe, ff.writable);
+8010195a:	83 ec 08             	sub    $0x8,%esp
+8010195d:	0f be 45 dd          	movsbl -0x23(%ebp),%eax
+80101961:	50                   	push   %eax
+80101962:	ff 75 e0             	push   -0x20(%ebp)
+80101965:	e8 6a 42 00 00       	call   80105bd4 <pipeclose>
+8010196a:	83 c4 10             	add    $0x10,%esp
+8010196d:	eb e6                	jmp    80101955 <fileclose+0xda>
+
+8010196f <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+8010196f:	55                   	push   %ebp
+80101970:	89 e5                	mov    %esp,%ebp
+80101972:	53                   	push   %ebx
+80101973:	83 ec 04             	sub    $0x4,%esp
+80101976:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+80101979:	83 3b 02             	cmpl   $0x2,(%ebx)
+8010197c:	75 31                	jne    801019af <filestat+0x40>
+    ilock(f->ip);
+8010197e:	83 ec 0c             	sub    $0xc,%esp
+80101981:	ff 73 14             	push   0x14(%ebx)
+80101984:	e8 98 15 00 00       	call   80102f21 <ilock>
+    stati(f->ip, st);
+80101989:	83 c4 08             	add    $0x8,%esp
+8010198c:	ff 75 0c             	push   0xc(%ebp)
+8010198f:	ff 73 14             	push   0x14(%ebx)
+80101992:	e8 e5 17 00 00       	call   8010317c <stati>
+    iunlock(f->ip);
+80101997:	83 c4 04             	add    $0x4,%esp
+8010199a:	ff 73 14             	push   0x14(%ebx)
+8010199d:	e8 54 16 00 00       	call   80102ff6 <iunlock>
+    return 0;
+801019a2:	83 c4 10             	add    $0x10,%esp
+801019a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  return -1;
+}
+801019aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801019ad:	c9                   	leave
+801019ae:	c3                   	ret
+  return -1;
+801019af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801019b4:	eb f4                	jmp    801019aa <filestat+0x3b>
+
+801019b6 <fileread>:
+#define RAMAX NREADAHEAD
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+801019b6:	55                   	push   %ebp
+801019b7:	89 e5                	mov    %esp,%ebp
+801019b9:	57                   	push   %edi
+801019ba:	56                   	push   %esi
+801019bb:	53                   	push   %ebx
+801019bc:	83 ec 0c             	sub    $0xc,%esp
+801019bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  uint start, end;
+
+  if(f->readable == 0)
+801019c2:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+801019c6:	0f 84 e7 00 00 00    	je     80101ab3 <fileread+0xfd>
+    return -1;
+  if(f->type == FD_PIPE)
+801019cc:	8b 03                	mov    (%ebx),%eax
+801019ce:	83 f8 01             	cmp    $0x1,%eax
+801019d1:	0f 84 8c 00 00 00    	je     80101a63 <fileread+0xad>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801019d7:	83 f8 02             	cmp    $0x2,%eax
+801019da:	0f 85 c6 00 00 00    	jne    80101aa6 <fileread+0xf0>
+    ilock(f->ip);
+801019e0:	83 ec 0c             	sub    $0xc,%esp
+801019e3:	ff 73 14             	push   0x14(%ebx)
+801019e6:	e8 36 15 00 00       	call   80102f21 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0){
+801019eb:	ff 75 10             	push   0x10(%ebp)
+801019ee:	ff 73 18             	push   0x18(%ebx)
+801019f1:	ff 75 0c             	push   0xc(%ebp)
+801019f4:	ff 73 14             	push   0x14(%ebx)
+801019f7:	e8 2d 18 00 00       	call   80103229 <readi>
+801019fc:	89 c6                	mov    %eax,%esi
+801019fe:	83 c4 20             	add    $0x20,%esp
+80101a01:	85 c0                	test   %eax,%eax
+80101a03:	7e 46                	jle    80101a4b <fileread+0x95>
+      // Reads that carry on where the last one stopped get a
+      // read-ahead window that doubles each time.
+      if(f->off == f->ranext)
+80101a05:	8b 43 18             	mov    0x18(%ebx),%eax
+80101a08:	3b 43 1c             	cmp    0x1c(%ebx),%eax
+80101a0b:	74 6e                	je     80101a7b <fileread+0xc5>
+        f->rawin = f->rawin ? f->rawin*2 : RAMIN;
+      else
+        f->rawin = f->raend = 0;
+80101a0d:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+80101a14:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+      if(f->rawin > RAMAX)
+80101a1b:	83 7b 24 20          	cmpl   $0x20,0x24(%ebx)
+80101a1f:	7e 07                	jle    80101a28 <fileread+0x72>
+        f->rawin = RAMAX;
+80101a21:	c7 43 24 20 00 00 00 	movl   $0x20,0x24(%ebx)
+      f->off += r;
+80101a28:	01 f0                	add    %esi,%eax
+80101a2a:	89 43 18             	mov    %eax,0x18(%ebx)
+      f->ranext = f->off;
+80101a2d:	89 43 1c             	mov    %eax,0x1c(%ebx)
+      if(f->rawin){
+80101a30:	8b 7b 24             	mov    0x24(%ebx),%edi
+80101a33:	85 ff                	test   %edi,%edi
+80101a35:	74 14                	je     80101a4b <fileread+0x95>
+        end = f->off + f->rawin*BSIZE;
+80101a37:	c1 e7 0c             	shl    $0xc,%edi
+80101a3a:	01 c7                	add    %eax,%edi
+        start = f->raend > f->off ? f->raend : f->off;
+80101a3c:	8b 53 20             	mov    0x20(%ebx),%edx
+80101a3f:	39 d0                	cmp    %edx,%eax
+80101a41:	0f 42 c2             	cmovb  %edx,%eax
+        if(start < end)
+80101a44:	39 f8                	cmp    %edi,%eax
+80101a46:	72 48                	jb     80101a90 <fileread+0xda>
+          readahead(f->ip, start, end - start);
+        f->raend = end;
+80101a48:	89 7b 20             	mov    %edi,0x20(%ebx)
+      }
+    }
+    iunlock(f->ip);
+80101a4b:	83 ec 0c             	sub    $0xc,%esp
+80101a4e:	ff 73 14             	push   0x14(%ebx)
+80101a51:	e8 a0 15 00 00       	call   80102ff6 <iunlock>
+    return r;
+80101a56:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+80101a59:	89 f0                	mov    %esi,%eax
+80101a5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a5e:	5b                   	pop    %ebx
+80101a5f:	5e                   	pop    %esi
+80101a60:	5f                   	pop    %edi
+80101a61:	5d                   	pop    %ebp
+80101a62:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+80101a63:	83 ec 04             	sub    $0x4,%esp
+80101a66:	ff 75 10             	push   0x10(%ebp)
+80101a69:	ff 75 0c             	push   0xc(%ebp)
+80101a6c:	ff 73 10             	push   0x10(%ebx)
+80101a6f:	e8 9b 42 00 00       	call   80105d0f <piperead>
+80101a74:	89 c6                	mov    %eax,%esi
+80101a76:	83 c4 10             	add    $0x10,%esp
+80101a79:	eb de                	jmp    80101a59 <fileread+0xa3>
+        f->rawin = f->rawin ? f->rawin*2 : RAMIN;
+80101a7b:	8b 53 24             	mov    0x24(%ebx),%edx
+80101a7e:	85 d2                	test   %edx,%edx
+80101a80:	74 07                	je     80101a89 <fileread+0xd3>
+80101a82:	01 d2                	add    %edx,%edx
+80101a84:	89 53 24             	mov    %edx,0x24(%ebx)
+80101a87:	eb 92                	jmp    80101a1b <fileread+0x65>
+80101a89:	ba 04 00 00 00       	mov    $0x4,%edx
+80101a8e:	eb f4                	jmp    80101a84 <fileread+0xce>
+          readahead(f->ip, start, end - start);
+80101a90:	83 ec 04             	sub    $0x4,%esp
+80101a93:	89 fa                	mov    %edi,%edx
+80101a95:	29 c2                	sub    %eax,%edx
+80101a97:	52                   	push   %edx
+80101a98:	50                   	push   %eax
+80101a99:	ff 73 14             	push   0x14(%ebx)
+80101a9c:	e8 06 17 00 00       	call   801031a7 <readahead>
+80101aa1:	83 c4 10             	add    $0x10,%esp
+80101aa4:	eb a2                	jmp    80101a48 <fileread+0x92>
+  panic("fileread");
+80101aa6:	83 ec 0c             	sub    $0xc,%esp
+80101aa9:	68 fa bd 10 80       	push   $0x8010bdfa
+80101aae:	e8 43 f1 ff ff       	call   80100bf6 <panic>
+    return -1;
+80101ab3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80101ab8:	eb 9f                	jmp    80101a59 <fileread+0xa3>
+
+80101aba <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+80101aba:	55                   	push   %ebp
+80101abb:	89 e5                	mov    %esp,%ebp
+80101abd:	57                   	push   %edi
+80101abe:	56                   	push   %esi
+80101abf:	53                   	push   %ebx
+80101ac0:	83 ec 1c             	sub    $0x1c,%esp
+80101ac3:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+
+  if(f->writable == 0)
+80101ac6:	80 7e 0d 00          	cmpb   $0x0,0xd(%esi)
+80101aca:	0f 84 cc 00 00 00    	je     80101b9c <filewrite+0xe2>
+    return -1;
+  if(f->type == FD_PIPE)
+80101ad0:	8b 06                	mov    (%esi),%eax
+80101ad2:	83 f8 01             	cmp    $0x1,%eax
+80101ad5:	74 10                	je     80101ae7 <filewrite+0x2d>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+80101ad7:	83 f8 02             	cmp    $0x2,%eax
+80101ada:	0f 85 af 00 00 00    	jne    80101b8f <filewrite+0xd5>
+    // i-node, indirect block, allocation blocks,
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
+    int i = 0;
+80101ae0:	bf 00 00 00 00       	mov    $0x0,%edi
+80101ae5:	eb 67                	jmp    80101b4e <filewrite+0x94>
+    return pipewrite(f->pipe, addr, n);
+80101ae7:	83 ec 04             	sub    $0x4,%esp
+80101aea:	ff 75 10             	push   0x10(%ebp)
+80101aed:	ff 75 0c             	push   0xc(%ebp)
+80101af0:	ff 76 10             	push   0x10(%esi)
+80101af3:	e8 6f 41 00 00       	call   80105c67 <pipewrite>
+80101af8:	83 c4 10             	add    $0x10,%esp
+80101afb:	e9 82 00 00 00       	jmp    80101b82 <filewrite+0xc8>
+    while(i < n){
+      int n1 = n - i;
+      if(n1 > max)
+        n1 = max;
+
+      begin_op();
+80101b00:	e8 92 37 00 00       	call   80105297 <begin_op>
+      ilock(f->ip);
+80101b05:	83 ec 0c             	sub    $0xc,%esp
+80101b08:	ff 76 14             	push   0x14(%esi)
+80101b0b:	e8 11 14 00 00       	call   80102f21 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+80101b10:	ff 75 e4             	push   -0x1c(%ebp)
+80101b13:	ff 76 18             	push   0x18(%esi)
+80101b16:	89 f8                	mov    %edi,%eax
+80101b18:	03 45 0c             	add    0xc(%ebp),%eax
+80101b1b:	50                   	push   %eax
+80101b1c:	ff 76 14             	push   0x14(%esi)
+80101b1f:	e8 30 1b 00 00       	call   80103654 <writei>
+80101b24:	89 c3                	mov    %eax,%ebx
+80101b26:	83 c4 20             	add    $0x20,%esp
+80101b29:	85 c0                	test   %eax,%eax
+80101b2b:	7e 03                	jle    80101b30 <filewrite+0x76>
+        f->off += r;
+80101b2d:	01 46 18             	add    %eax,0x18(%esi)
+      iunlock(f->ip);
+80101b30:	83 ec 0c             	sub    $0xc,%esp
+80101b33:	ff 76 14             	push   0x14(%esi)
+80101b36:	e8 bb 14 00 00       	call   80102ff6 <iunlock>
+      end_op();
+80101b3b:	e8 d1 37 00 00       	call   80105311 <end_op>
+
+      if(r < 0)
+80101b40:	83 c4 10             	add    $0x10,%esp
+80101b43:	85 db                	test   %ebx,%ebx
+80101b45:	78 31                	js     80101b78 <filewrite+0xbe>
+        break;
+      if(r != n1)
+80101b47:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+80101b4a:	75 1f                	jne    80101b6b <filewrite+0xb1>
+        panic("short filewrite");
+      i += r;
+80101b4c:	01 df                	add    %ebx,%edi
+    while(i < n){
+80101b4e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+80101b51:	7d 25                	jge    80101b78 <filewrite+0xbe>
+      int n1 = n - i;
+80101b53:	8b 45 10             	mov    0x10(%ebp),%eax
+80101b56:	29 f8                	sub    %edi,%eax
+80101b58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(n1 > max)
+80101b5b:	3d 00 30 00 00       	cmp    $0x3000,%eax
+80101b60:	7e 9e                	jle    80101b00 <filewrite+0x46>
+        n1 = max;
+80101b62:	c7 45 e4 00 30 00 00 	movl   $0x3000,-0x1c(%ebp)
+80101b69:	eb 95                	jmp    80101b00 <filewrite+0x46>
+        panic("short filewrite");
+80101b6b:	83 ec 0c             	sub    $0xc,%esp
+80101b6e:	68 03 be 10 80       	push   $0x8010be03
+80101b73:	e8 7e f0 ff ff       	call   80100bf6 <panic>
+    }
+    return i == n ? n : -1;
+80101b78:	3b 7d 10             	cmp    0x10(%ebp),%edi
+80101b7b:	74 0d                	je     80101b8a <filewrite+0xd0>
+80101b7d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  panic("filewrite");
+}
+80101b82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101b85:	5b                   	pop    %ebx
+80101b86:	5e                   	pop    %esi
+80101b87:	5f                   	pop    %edi
+80101b88:	5d                   	pop    %ebp
+80101b89:	c3                   	ret
+    return i == n ? n : -1;
+80101b8a:	8b 45 10             	mov    0x10(%ebp),%eax
+80101b8d:	eb f3                	jmp    80101b82 <filewrite+0xc8>
+  panic("filewrite");
+80101b8f:	83 ec 0c             	sub    $0xc,%esp
+80101b92:	68 09 be 10 80       	push   $0x8010be09
+80101b97:	e8 5a f0 ff ff       	call   80100bf6 <panic>
+    return -1;
+80101b9c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101ba1:	eb df                	jmp    80101b82 <filewrite+0xc8>
+
+80101ba3 <filesplice>:
+// through user space. One end must be a pipe; the other may be
+// a pipe or an inode. Like fileread, returns once some bytes
+// have moved: the number moved, 0 at end of file, or -1.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+80101ba3:	55                   	push   %ebp
+80101ba4:	89 e5                	mov    %esp,%ebp
+80101ba6:	57                   	push   %edi
+80101ba7:	56                   	push   %esi
+80101ba8:	53                   	push   %ebx
+80101ba9:	83 ec 1c             	sub    $0x1c,%esp
+80101bac:	8b 75 08             	mov    0x8(%ebp),%esi
+80101baf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int r, eof;
+  struct inode *ip;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+80101bb2:	80 7e 0c 00          	cmpb   $0x0,0xc(%esi)
+80101bb6:	0f 84 90 01 00 00    	je     80101d4c <filesplice+0x1a9>
+80101bbc:	80 7f 0d 00          	cmpb   $0x0,0xd(%edi)
+80101bc0:	0f 84 8d 01 00 00    	je     80101d53 <filesplice+0x1b0>
+80101bc6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80101bca:	0f 88 8a 01 00 00    	js     80101d5a <filesplice+0x1b7>
+    return -1;
+  if(n == 0)
+80101bd0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80101bd4:	0f 84 87 01 00 00    	je     80101d61 <filesplice+0x1be>
+    return 0;
+
+  if(in->type == FD_INODE && out->type == FD_PIPE){
+80101bda:	8b 06                	mov    (%esi),%eax
+80101bdc:	83 f8 02             	cmp    $0x2,%eax
+80101bdf:	74 78                	je     80101c59 <filesplice+0xb6>
+      if(r != 0 || eof)
+        return r;
+    }
+  }
+
+  if(in->type == FD_PIPE && out->type == FD_INODE){
+80101be1:	83 f8 01             	cmp    $0x1,%eax
+80101be4:	0f 84 e6 00 00 00    	je     80101cd0 <filesplice+0x12d>
+      if(r != 0)
+        return r;
+    }
+  }
+
+  if(in->type == FD_PIPE && out->type == FD_PIPE && in->pipe != out->pipe){
+80101bea:	83 f8 01             	cmp    $0x1,%eax
+80101bed:	0f 85 82 01 00 00    	jne    80101d75 <filesplice+0x1d2>
+80101bf3:	83 3f 01             	cmpl   $0x1,(%edi)
+80101bf6:	0f 85 80 01 00 00    	jne    80101d7c <filesplice+0x1d9>
+80101bfc:	8b 47 10             	mov    0x10(%edi),%eax
+80101bff:	39 46 10             	cmp    %eax,0x10(%esi)
+80101c02:	0f 84 7b 01 00 00    	je     80101d83 <filesplice+0x1e0>
+    for(;;){
+      if((r = pipewait(in->pipe, 0)) <= 0)
+80101c08:	83 ec 08             	sub    $0x8,%esp
+80101c0b:	6a 00                	push   $0x0
+80101c0d:	ff 76 10             	push   0x10(%esi)
+80101c10:	e8 7c 41 00 00       	call   80105d91 <pipewait>
+80101c15:	89 c3                	mov    %eax,%ebx
+80101c17:	83 c4 10             	add    $0x10,%esp
+80101c1a:	85 c0                	test   %eax,%eax
+80101c1c:	0f 8e 42 01 00 00    	jle    80101d64 <filesplice+0x1c1>
+        return r;
+      if(pipewait(out->pipe, 1) < 0)
+80101c22:	83 ec 08             	sub    $0x8,%esp
+80101c25:	6a 01                	push   $0x1
+80101c27:	ff 77 10             	push   0x10(%edi)
+80101c2a:	e8 62 41 00 00       	call   80105d91 <pipewait>
+80101c2f:	83 c4 10             	add    $0x10,%esp
+80101c32:	85 c0                	test   %eax,%eax
+80101c34:	0f 88 50 01 00 00    	js     80101d8a <filesplice+0x1e7>
+        return -1;
+      if((r = pipemove(in->pipe, out->pipe, n)) != 0)
+80101c3a:	83 ec 04             	sub    $0x4,%esp
+80101c3d:	ff 75 10             	push   0x10(%ebp)
+80101c40:	ff 77 10             	push   0x10(%edi)
+80101c43:	ff 76 10             	push   0x10(%esi)
+80101c46:	e8 56 42 00 00       	call   80105ea1 <pipemove>
+80101c4b:	89 c3                	mov    %eax,%ebx
+80101c4d:	83 c4 10             	add    $0x10,%esp
+80101c50:	85 c0                	test   %eax,%eax
+80101c52:	74 b4                	je     80101c08 <filesplice+0x65>
+80101c54:	e9 0b 01 00 00       	jmp    80101d64 <filesplice+0x1c1>
+  if(in->type == FD_INODE && out->type == FD_PIPE){
+80101c59:	83 3f 01             	cmpl   $0x1,(%edi)
+80101c5c:	75 83                	jne    80101be1 <filesplice+0x3e>
+    ip = in->ip;
+80101c5e:	8b 46 14             	mov    0x14(%esi),%eax
+80101c61:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101c64:	eb 29                	jmp    80101c8f <filesplice+0xec>
+      eof = in->off >= ip->size;
+80101c66:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101c69:	8b 42 64             	mov    0x64(%edx),%eax
+80101c6c:	39 46 18             	cmp    %eax,0x18(%esi)
+80101c6f:	0f 93 c0             	setae  %al
+80101c72:	0f b6 c0             	movzbl %al,%eax
+80101c75:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(ip);
+80101c78:	83 ec 0c             	sub    $0xc,%esp
+80101c7b:	52                   	push   %edx
+80101c7c:	e8 75 13 00 00       	call   80102ff6 <iunlock>
+      if(r != 0 || eof)
+80101c81:	83 c4 10             	add    $0x10,%esp
+80101c84:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101c87:	09 d8                	or     %ebx,%eax
+80101c89:	0f 85 d5 00 00 00    	jne    80101d64 <filesplice+0x1c1>
+      if(pipewait(out->pipe, 1) < 0)
+80101c8f:	83 ec 08             	sub    $0x8,%esp
+80101c92:	6a 01                	push   $0x1
+80101c94:	ff 77 10             	push   0x10(%edi)
+80101c97:	e8 f5 40 00 00       	call   80105d91 <pipewait>
+80101c9c:	83 c4 10             	add    $0x10,%esp
+80101c9f:	85 c0                	test   %eax,%eax
+80101ca1:	0f 88 c7 00 00 00    	js     80101d6e <filesplice+0x1cb>
+      ilock(ip);
+80101ca7:	83 ec 0c             	sub    $0xc,%esp
+80101caa:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101cad:	53                   	push   %ebx
+80101cae:	e8 6e 12 00 00       	call   80102f21 <ilock>
+      if((r = readipipe(ip, out->pipe, in->off, n)) > 0)
+80101cb3:	ff 75 10             	push   0x10(%ebp)
+80101cb6:	ff 76 18             	push   0x18(%esi)
+80101cb9:	ff 77 10             	push   0x10(%edi)
+80101cbc:	53                   	push   %ebx
+80101cbd:	e8 8b 16 00 00       	call   8010334d <readipipe>
+80101cc2:	89 c3                	mov    %eax,%ebx
+80101cc4:	83 c4 20             	add    $0x20,%esp
+80101cc7:	85 c0                	test   %eax,%eax
+80101cc9:	7e 9b                	jle    80101c66 <filesplice+0xc3>
+        in->off += r;
+80101ccb:	01 46 18             	add    %eax,0x18(%esi)
+80101cce:	eb 96                	jmp    80101c66 <filesplice+0xc3>
+  if(in->type == FD_PIPE && out->type == FD_INODE){
+80101cd0:	83 3f 02             	cmpl   $0x2,(%edi)
+80101cd3:	0f 85 11 ff ff ff    	jne    80101bea <filesplice+0x47>
+    if(n > ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE)
+80101cd9:	81 7d 10 00 30 00 00 	cmpl   $0x3000,0x10(%ebp)
+80101ce0:	7e 07                	jle    80101ce9 <filesplice+0x146>
+      n = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
+80101ce2:	c7 45 10 00 30 00 00 	movl   $0x3000,0x10(%ebp)
+    ip = out->ip;
+80101ce9:	8b 47 14             	mov    0x14(%edi),%eax
+80101cec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101cef:	eb 17                	jmp    80101d08 <filesplice+0x165>
+      iunlock(ip);
+80101cf1:	83 ec 0c             	sub    $0xc,%esp
+80101cf4:	ff 75 e4             	push   -0x1c(%ebp)
+80101cf7:	e8 fa 12 00 00       	call   80102ff6 <iunlock>
+      end_op();
+80101cfc:	e8 10 36 00 00       	call   80105311 <end_op>
+      if(r != 0)
+80101d01:	83 c4 10             	add    $0x10,%esp
+80101d04:	85 db                	test   %ebx,%ebx
+80101d06:	75 5c                	jne    80101d64 <filesplice+0x1c1>
+      if((r = pipewait(in->pipe, 0)) <= 0)
+80101d08:	83 ec 08             	sub    $0x8,%esp
+80101d0b:	6a 00                	push   $0x0
+80101d0d:	ff 76 10             	push   0x10(%esi)
+80101d10:	e8 7c 40 00 00       	call   80105d91 <pipewait>
+80101d15:	89 c3                	mov    %eax,%ebx
+80101d17:	83 c4 10             	add    $0x10,%esp
+80101d1a:	85 c0                	test   %eax,%eax
+80101d1c:	7e 46                	jle    80101d64 <filesplice+0x1c1>
+      begin_op();
+80101d1e:	e8 74 35 00 00       	call   80105297 <begin_op>
+      ilock(ip);
+80101d23:	83 ec 0c             	sub    $0xc,%esp
+80101d26:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101d29:	53                   	push   %ebx
+80101d2a:	e8 f2 11 00 00       	call   80102f21 <ilock>
+      if((r = writeipipe(ip, in->pipe, out->off, n)) > 0)
+80101d2f:	ff 75 10             	push   0x10(%ebp)
+80101d32:	ff 77 18             	push   0x18(%edi)
+80101d35:	ff 76 10             	push   0x10(%esi)
+80101d38:	53                   	push   %ebx
+80101d39:	e8 26 17 00 00       	call   80103464 <writeipipe>
+80101d3e:	89 c3                	mov    %eax,%ebx
+80101d40:	83 c4 20             	add    $0x20,%esp
+80101d43:	85 c0                	test   %eax,%eax
+80101d45:	7e aa                	jle    80101cf1 <filesplice+0x14e>
+        out->off += r;
+80101d47:	01 47 18             	add    %eax,0x18(%edi)
+80101d4a:	eb a5                	jmp    80101cf1 <filesplice+0x14e>
+    return -1;
+80101d4c:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101d51:	eb 11                	jmp    80101d64 <filesplice+0x1c1>
+80101d53:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101d58:	eb 0a                	jmp    80101d64 <filesplice+0x1c1>
+80101d5a:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101d5f:	eb 03                	jmp    80101d64 <filesplice+0x1c1>
+    return 0;
+80101d61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+        return r;
+    }
+  }
+
+  return -1;
+}
+80101d64:	89 d8                	mov    %ebx,%eax
+80101d66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d69:	5b                   	pop    %ebx
+80101d6a:	5e                   	pop    %esi
+80101d6b:	5f                   	pop    %edi
+80101d6c:	5d                   	pop    %ebp
+80101d6d:	c3                   	ret
+        return -1;
+80101d6e:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101d73:	eb ef                	jmp    80101d64 <filesplice+0x1c1>
+  return -1;
+80101d75:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101d7a:	eb e8                	jmp    80101d64 <filesplice+0x1c1>
+80101d7c:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101d81:	eb e1                	jmp    80101d64 <filesplice+0x1c1>
+80101d83:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101d88:	eb da                	jmp    80101d64 <filesplice+0x1c1>
+        return -1;
+80101d8a:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101d8f:	eb d3                	jmp    80101d64 <filesplice+0x1c1>
+
+80101d91 <ihash>:
+} icache;
+
+static struct ibucket*
+ihash(uint dev, uint inum)
+{
+  return &icache.bucket[(dev ^ inum) % NIBUCKET];
+80101d91:	31 d0                	xor    %edx,%eax
+80101d93:	89 c1                	mov    %eax,%ecx
+80101d95:	ba 85 10 42 08       	mov    $0x8421085,%edx
+80101d9a:	f7 e2                	mul    %edx
+80101d9c:	89 c8                	mov    %ecx,%eax
+80101d9e:	29 d0                	sub    %edx,%eax
+80101da0:	d1 e8                	shr    %eax
+80101da2:	01 c2                	add    %eax,%edx
+80101da4:	c1 ea 04             	shr    $0x4,%edx
+80101da7:	89 d0                	mov    %edx,%eax
+80101da9:	c1 e0 05             	shl    $0x5,%eax
+80101dac:	29 d0                	sub    %edx,%eax
+80101dae:	29 c1                	sub    %eax,%ecx
+80101db0:	6b d1 38             	imul   $0x38,%ecx,%edx
+80101db3:	8d 82 80 88 11 80    	lea    -0x7fee7780(%edx),%eax
+}
+80101db9:	c3                   	ret
+
+80101dba <dirhash>:
+#define DIRPAGES (PGSIZE / sizeof(uint*)) // max pages in an index
+#define DIRDEL 0xFFFFFFFF                // slot of a removed entry
+
+static uint
+dirhash(char *name)
+{
+80101dba:	55                   	push   %ebp
+80101dbb:	89 e5                	mov    %esp,%ebp
+80101dbd:	56                   	push   %esi
+80101dbe:	53                   	push   %ebx
+80101dbf:	89 c3                	mov    %eax,%ebx
+  uint h;
+  int i;
+
+  h = 0;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101dc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  h = 0;
+80101dc6:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101dcb:	eb 10                	jmp    80101ddd <dirhash+0x23>
+    h = h*31 + (uchar)name[i];
+80101dcd:	89 f1                	mov    %esi,%ecx
+80101dcf:	c1 e1 05             	shl    $0x5,%ecx
+80101dd2:	29 f1                	sub    %esi,%ecx
+80101dd4:	0f b6 c0             	movzbl %al,%eax
+80101dd7:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101dda:	83 c2 01             	add    $0x1,%edx
+80101ddd:	83 fa 0d             	cmp    $0xd,%edx
+80101de0:	7f 08                	jg     80101dea <dirhash+0x30>
+80101de2:	0f b6 04 13          	movzbl (%ebx,%edx,1),%eax
+80101de6:	84 c0                	test   %al,%al
+80101de8:	75 e3                	jne    80101dcd <dirhash+0x13>
+  return h;
+}
+80101dea:	89 f0                	mov    %esi,%eax
+80101dec:	5b                   	pop    %ebx
+80101ded:	5e                   	pop    %esi
+80101dee:	5d                   	pop    %ebp
+80101def:	c3                   	ret
+
+80101df0 <dirslot>:
+
+static uint*
+dirslot(struct inode *dp, uint i)
+{
+80101df0:	55                   	push   %ebp
+80101df1:	89 e5                	mov    %esp,%ebp
+80101df3:	53                   	push   %ebx
+  return &dp->dirhash[i / DIRSLOTS][i % DIRSLOTS];
+80101df4:	8b 88 ec 00 00 00    	mov    0xec(%eax),%ecx
+80101dfa:	89 d3                	mov    %edx,%ebx
+80101dfc:	c1 eb 0a             	shr    $0xa,%ebx
+80101dff:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+80101e05:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+80101e0c:	03 04 99             	add    (%ecx,%ebx,4),%eax
+}
+80101e0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101e12:	c9                   	leave
+80101e13:	c3                   	ret
+
+80101e14 <dirindexadd>:
+}
+
+// Record that the dirent at off holds name.
+static void
+dirindexadd(struct inode *dp, char *name, uint off)
+{
+80101e14:	55                   	push   %ebp
+80101e15:	89 e5                	mov    %esp,%ebp
+80101e17:	57                   	push   %edi
+80101e18:	56                   	push   %esi
+80101e19:	53                   	push   %ebx
+80101e1a:	83 ec 1c             	sub    $0x1c,%esp
+80101e1d:	89 c7                	mov    %eax,%edi
+80101e1f:	89 d0                	mov    %edx,%eax
+80101e21:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  uint i, n, *s;
+
+  n = dp->ndirhash * DIRSLOTS;
+80101e24:	8b b7 f0 00 00 00    	mov    0xf0(%edi),%esi
+80101e2a:	c1 e6 0a             	shl    $0xa,%esi
+  for(i = dirhash(name) % n; *(s = dirslot(dp, i)) != 0; i = (i + 1) % n)
+80101e2d:	e8 88 ff ff ff       	call   80101dba <dirhash>
+80101e32:	ba 00 00 00 00       	mov    $0x0,%edx
+80101e37:	f7 f6                	div    %esi
+80101e39:	89 d3                	mov    %edx,%ebx
+80101e3b:	eb 0c                	jmp    80101e49 <dirindexadd+0x35>
+80101e3d:	8d 43 01             	lea    0x1(%ebx),%eax
+80101e40:	ba 00 00 00 00       	mov    $0x0,%edx
+80101e45:	f7 f6                	div    %esi
+80101e47:	89 d3                	mov    %edx,%ebx
+80101e49:	89 da                	mov    %ebx,%edx
+80101e4b:	89 f8                	mov    %edi,%eax
+80101e4d:	e8 9e ff ff ff       	call   80101df0 <dirslot>
+80101e52:	8b 10                	mov    (%eax),%edx
+80101e54:	85 d2                	test   %edx,%edx
+80101e56:	74 05                	je     80101e5d <dirindexadd+0x49>
+    if(*s == DIRDEL)
+80101e58:	83 fa ff             	cmp    $0xffffffff,%edx
+80101e5b:	75 e0                	jne    80101e3d <dirindexadd+0x29>
+      break;
+  if(*s == 0)
+80101e5d:	85 d2                	test   %edx,%edx
+80101e5f:	75 0f                	jne    80101e70 <dirindexadd+0x5c>
+    dp->dirused++;
+80101e61:	8b 8f f4 00 00 00    	mov    0xf4(%edi),%ecx
+80101e67:	8d 51 01             	lea    0x1(%ecx),%edx
+80101e6a:	89 97 f4 00 00 00    	mov    %edx,0xf4(%edi)
+  *s = off / sizeof(struct dirent) + 1;
+80101e70:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101e73:	c1 ea 04             	shr    $0x4,%edx
+80101e76:	83 c2 01             	add    $0x1,%edx
+80101e79:	89 10                	mov    %edx,(%eax)
+}
+80101e7b:	83 c4 1c             	add    $0x1c,%esp
+80101e7e:	5b                   	pop    %ebx
+80101e7f:	5e                   	pop    %esi
+80101e80:	5f                   	pop    %edi
+80101e81:	5d                   	pop    %ebp
+80101e82:	c3                   	ret
+
+80101e83 <dcentry>:
+    brelse(bp);
+}
+
+static struct dcentry*
+dcentry(struct inode *dp, char *name)
+{
+80101e83:	55                   	push   %ebp
+80101e84:	89 e5                	mov    %esp,%ebp
+80101e86:	53                   	push   %ebx
+80101e87:	83 ec 04             	sub    $0x4,%esp
+80101e8a:	89 c3                	mov    %eax,%ebx
+80101e8c:	89 d0                	mov    %edx,%eax
+  return &dcache.e[(dirhash(name) + dp->inum*31) % NDCACHE];
+80101e8e:	e8 27 ff ff ff       	call   80101dba <dirhash>
+80101e93:	8b 4b 04             	mov    0x4(%ebx),%ecx
+80101e96:	89 ca                	mov    %ecx,%edx
+80101e98:	c1 e2 05             	shl    $0x5,%edx
+80101e9b:	29 ca                	sub    %ecx,%edx
+80101e9d:	01 d0                	add    %edx,%eax
+80101e9f:	0f b6 c0             	movzbl %al,%eax
+80101ea2:	6b c0 1c             	imul   $0x1c,%eax,%eax
+80101ea5:	05 b4 c2 11 80       	add    $0x8011c2b4,%eax
+}
+80101eaa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101ead:	c9                   	leave
+80101eae:	c3                   	ret
+
+80101eaf <skipelem>:
+//   skipelem("a", name) = "", setting name = "a"
+//   skipelem("", name) = skipelem("////", name) = 0
+//
+static char*
+skipelem(char *path, char *name)
+{
+80101eaf:	55                   	push   %ebp
+80101eb0:	89 e5                	mov    %esp,%ebp
+80101eb2:	57                   	push   %edi
+80101eb3:	56                   	push   %esi
+80101eb4:	53                   	push   %ebx
+80101eb5:	83 ec 0c             	sub    $0xc,%esp
+80101eb8:	89 d6                	mov    %edx,%esi
+  char *s;
+  int len;
+
+  while(*path == '/')
+80101eba:	eb 03                	jmp    80101ebf <skipelem+0x10>
+    path++;
+80101ebc:	83 c0 01             	add    $0x1,%eax
+  while(*path == '/')
+80101ebf:	0f b6 10             	movzbl (%eax),%edx
+80101ec2:	80 fa 2f             	cmp    $0x2f,%dl
+80101ec5:	74 f5                	je     80101ebc <skipelem+0xd>
+  if(*path == 0)
+80101ec7:	84 d2                	test   %dl,%dl
+80101ec9:	74 53                	je     80101f1e <skipelem+0x6f>
+80101ecb:	89 c3                	mov    %eax,%ebx
+80101ecd:	eb 03                	jmp    80101ed2 <skipelem+0x23>
+    return 0;
+  s = path;
+  while(*path != '/' && *path != 0)
+    path++;
+80101ecf:	83 c3 01             	add    $0x1,%ebx
+  while(*path != '/' && *path != 0)
+80101ed2:	0f b6 13             	movzbl (%ebx),%edx
+80101ed5:	80 fa 2f             	cmp    $0x2f,%dl
+80101ed8:	74 04                	je     80101ede <skipelem+0x2f>
+80101eda:	84 d2                	test   %dl,%dl
+80101edc:	75 f1                	jne    80101ecf <skipelem+0x20>
+  len = path - s;
+80101ede:	89 df                	mov    %ebx,%edi
+80101ee0:	29 c7                	sub    %eax,%edi
+  if(len >= DIRSIZ)
+80101ee2:	83 ff 0d             	cmp    $0xd,%edi
+80101ee5:	7e 11                	jle    80101ef8 <skipelem+0x49>
+    memmove(name, s, DIRSIZ);
+80101ee7:	83 ec 04             	sub    $0x4,%esp
+80101eea:	6a 0e                	push   $0xe
+80101eec:	50                   	push   %eax
+80101eed:	56                   	push   %esi
+80101eee:	e8 13 68 00 00       	call   80108706 <memmove>
+80101ef3:	83 c4 10             	add    $0x10,%esp
+80101ef6:	eb 17                	jmp    80101f0f <skipelem+0x60>
+  else {
+    memmove(name, s, len);
+80101ef8:	83 ec 04             	sub    $0x4,%esp
+80101efb:	57                   	push   %edi
+80101efc:	50                   	push   %eax
+80101efd:	56                   	push   %esi
+80101efe:	e8 03 68 00 00       	call   80108706 <memmove>
+    name[len] = 0;
+80101f03:	c6 04 3e 00          	movb   $0x0,(%esi,%edi,1)
+80101f07:	83 c4 10             	add    $0x10,%esp
+80101f0a:	eb 03                	jmp    80101f0f <skipelem+0x60>
+  }
+  while(*path == '/')
+    path++;
+80101f0c:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80101f0f:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80101f12:	74 f8                	je     80101f0c <skipelem+0x5d>
+  return path;
+}
+80101f14:	89 d8                	mov    %ebx,%eax
+80101f16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101f19:	5b                   	pop    %ebx
+80101f1a:	5e                   	pop    %esi
+80101f1b:	5f                   	pop    %edi
+80101f1c:	5d                   	pop    %ebp
+80101f1d:	c3                   	ret
+    return 0;
+80101f1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101f23:	eb ef                	jmp    80101f14 <skipelem+0x65>
+
+80101f25 <ilruadd>:
+{
+80101f25:	55                   	push   %ebp
+80101f26:	89 e5                	mov    %esp,%ebp
+80101f28:	56                   	push   %esi
+80101f29:	53                   	push   %ebx
+80101f2a:	89 c3                	mov    %eax,%ebx
+80101f2c:	89 d6                	mov    %edx,%esi
+  acquire(&icache.lrulock);
+80101f2e:	83 ec 0c             	sub    $0xc,%esp
+80101f31:	68 7c 8f 11 80       	push   $0x80118f7c
+80101f36:	e8 a7 66 00 00       	call   801085e2 <acquire>
+  h = tail ? icache.head.lprev : &icache.head;
+80101f3b:	83 c4 10             	add    $0x10,%esp
+80101f3e:	85 f6                	test   %esi,%esi
+80101f40:	74 2e                	je     80101f70 <ilruadd+0x4b>
+80101f42:	a1 c0 8f 11 80       	mov    0x80118fc0,%eax
+  ip->lnext = h->lnext;
+80101f47:	8b 50 14             	mov    0x14(%eax),%edx
+80101f4a:	89 53 14             	mov    %edx,0x14(%ebx)
+  ip->lprev = h;
+80101f4d:	89 43 10             	mov    %eax,0x10(%ebx)
+  h->lnext->lprev = ip;
+80101f50:	8b 50 14             	mov    0x14(%eax),%edx
+80101f53:	89 5a 10             	mov    %ebx,0x10(%edx)
+  h->lnext = ip;
+80101f56:	89 58 14             	mov    %ebx,0x14(%eax)
+  release(&icache.lrulock);
+80101f59:	83 ec 0c             	sub    $0xc,%esp
+80101f5c:	68 7c 8f 11 80       	push   $0x80118f7c
+80101f61:	e8 e1 66 00 00       	call   80108647 <release>
+}
+80101f66:	83 c4 10             	add    $0x10,%esp
+80101f69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101f6c:	5b                   	pop    %ebx
+80101f6d:	5e                   	pop    %esi
+80101f6e:	5d                   	pop    %ebp
+80101f6f:	c3                   	ret
+  h = tail ? icache.head.lprev : &icache.head;
+80101f70:	b8 b0 8f 11 80       	mov    $0x80118fb0,%eax
+80101f75:	eb d0                	jmp    80101f47 <ilruadd+0x22>
+
+80101f77 <ilruremove>:
+{
+80101f77:	55                   	push   %ebp
+80101f78:	89 e5                	mov    %esp,%ebp
+80101f7a:	53                   	push   %ebx
+80101f7b:	83 ec 10             	sub    $0x10,%esp
+80101f7e:	89 c3                	mov    %eax,%ebx
+  acquire(&icache.lrulock);
+80101f80:	68 7c 8f 11 80       	push   $0x80118f7c
+80101f85:	e8 58 66 00 00       	call   801085e2 <acquire>
+  ip->lnext->lprev = ip->lprev;
+80101f8a:	8b 53 14             	mov    0x14(%ebx),%edx
+80101f8d:	8b 43 10             	mov    0x10(%ebx),%eax
+80101f90:	89 42 10             	mov    %eax,0x10(%edx)
+  ip->lprev->lnext = ip->lnext;
+80101f93:	8b 53 14             	mov    0x14(%ebx),%edx
+80101f96:	89 50 14             	mov    %edx,0x14(%eax)
+  release(&icache.lrulock);
+80101f99:	c7 04 24 7c 8f 11 80 	movl   $0x80118f7c,(%esp)
+80101fa0:	e8 a2 66 00 00       	call   80108647 <release>
+}
+80101fa5:	83 c4 10             	add    $0x10,%esp
+80101fa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101fab:	c9                   	leave
+80101fac:	c3                   	ret
+
+80101fad <ilookup>:
+{
+80101fad:	55                   	push   %ebp
+80101fae:	89 e5                	mov    %esp,%ebp
+80101fb0:	53                   	push   %ebx
+80101fb1:	83 ec 04             	sub    $0x4,%esp
+  for(ip = bk->head; ip; ip = ip->hnext){
+80101fb4:	8b 58 34             	mov    0x34(%eax),%ebx
+80101fb7:	eb 0c                	jmp    80101fc5 <ilookup+0x18>
+        ilruremove(ip);
+80101fb9:	89 d8                	mov    %ebx,%eax
+80101fbb:	e8 b7 ff ff ff       	call   80101f77 <ilruremove>
+      return ip;
+80101fc0:	eb 1d                	jmp    80101fdf <ilookup+0x32>
+  for(ip = bk->head; ip; ip = ip->hnext){
+80101fc2:	8b 5b 0c             	mov    0xc(%ebx),%ebx
+80101fc5:	85 db                	test   %ebx,%ebx
+80101fc7:	74 16                	je     80101fdf <ilookup+0x32>
+    if(ip->dev == dev && ip->inum == inum){
+80101fc9:	39 13                	cmp    %edx,(%ebx)
+80101fcb:	75 f5                	jne    80101fc2 <ilookup+0x15>
+80101fcd:	39 4b 04             	cmp    %ecx,0x4(%ebx)
+80101fd0:	75 f0                	jne    80101fc2 <ilookup+0x15>
+      if(ip->ref++ == 0)
+80101fd2:	8b 43 08             	mov    0x8(%ebx),%eax
+80101fd5:	8d 50 01             	lea    0x1(%eax),%edx
+80101fd8:	89 53 08             	mov    %edx,0x8(%ebx)
+80101fdb:	85 c0                	test   %eax,%eax
+80101fdd:	74 da                	je     80101fb9 <ilookup+0xc>
+}
+80101fdf:	89 d8                	mov    %ebx,%eax
+80101fe1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101fe4:	c9                   	leave
+80101fe5:	c3                   	ret
+
+80101fe6 <dcachepurge>:
+{
+80101fe6:	55                   	push   %ebp
+80101fe7:	89 e5                	mov    %esp,%ebp
+80101fe9:	56                   	push   %esi
+80101fea:	53                   	push   %ebx
+80101feb:	89 c6                	mov    %eax,%esi
+80101fed:	89 d3                	mov    %edx,%ebx
+  acquire(&dcache.lock);
+80101fef:	83 ec 0c             	sub    $0xc,%esp
+80101ff2:	68 80 c2 11 80       	push   $0x8011c280
+80101ff7:	e8 e6 65 00 00       	call   801085e2 <acquire>
+  for(e = dcache.e; e < &dcache.e[NDCACHE]; e++)
+80101ffc:	83 c4 10             	add    $0x10,%esp
+80101fff:	b8 b4 c2 11 80       	mov    $0x8011c2b4,%eax
+80102004:	eb 03                	jmp    80102009 <dcachepurge+0x23>
+80102006:	83 c0 1c             	add    $0x1c,%eax
+80102009:	3d b4 de 11 80       	cmp    $0x8011deb4,%eax
+8010200e:	73 12                	jae    80102022 <dcachepurge+0x3c>
+    if(e->dir == inum && e->dev == dev)
+80102010:	39 58 04             	cmp    %ebx,0x4(%eax)
+80102013:	75 f1                	jne    80102006 <dcachepurge+0x20>
+80102015:	39 30                	cmp    %esi,(%eax)
+80102017:	75 ed                	jne    80102006 <dcachepurge+0x20>
+      e->dir = 0;
+80102019:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+80102020:	eb e4                	jmp    80102006 <dcachepurge+0x20>
+  release(&dcache.lock);
+80102022:	83 ec 0c             	sub    $0xc,%esp
+80102025:	68 80 c2 11 80       	push   $0x8011c280
+8010202a:	e8 18 66 00 00       	call   80108647 <release>
+}
+8010202f:	83 c4 10             	add    $0x10,%esp
+80102032:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102035:	5b                   	pop    %ebx
+80102036:	5e                   	pop    %esi
+80102037:	5d                   	pop    %ebp
+80102038:	c3                   	ret
+
+80102039 <ifreemark>:
+{
+80102039:	55                   	push   %ebp
+8010203a:	89 e5                	mov    %esp,%ebp
+8010203c:	53                   	push   %ebx
+8010203d:	83 ec 10             	sub    $0x10,%esp
+80102040:	89 c3                	mov    %eax,%ebx
+  acquire(&ifree.lock);
+80102042:	68 20 c2 11 80       	push   $0x8011c220
+80102047:	e8 96 65 00 00       	call   801085e2 <acquire>
+  ifree.map[inum/32] |= 1U << (inum%32);
+8010204c:	89 da                	mov    %ebx,%edx
+8010204e:	c1 ea 05             	shr    $0x5,%edx
+80102051:	b8 01 00 00 00       	mov    $0x1,%eax
+80102056:	89 d9                	mov    %ebx,%ecx
+80102058:	d3 e0                	shl    %cl,%eax
+8010205a:	09 04 95 58 c2 11 80 	or     %eax,-0x7fee3da8(,%edx,4)
+  if(inum < ifree.inext)
+80102061:	83 c4 10             	add    $0x10,%esp
+80102064:	3b 1d 54 c2 11 80    	cmp    0x8011c254,%ebx
+8010206a:	73 06                	jae    80102072 <ifreemark+0x39>
+    ifree.inext = inum;
+8010206c:	89 1d 54 c2 11 80    	mov    %ebx,0x8011c254
+  release(&ifree.lock);
+80102072:	83 ec 0c             	sub    $0xc,%esp
+80102075:	68 20 c2 11 80       	push   $0x8011c220
+8010207a:	e8 c8 65 00 00       	call   80108647 <release>
+}
+8010207f:	83 c4 10             	add    $0x10,%esp
+80102082:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102085:	c9                   	leave
+80102086:	c3                   	ret
+
+80102087 <bfree>:
+{
+80102087:	55                   	push   %ebp
+80102088:	89 e5                	mov    %esp,%ebp
+8010208a:	57                   	push   %edi
+8010208b:	56                   	push   %esi
+8010208c:	53                   	push   %ebx
+8010208d:	83 ec 14             	sub    $0x14,%esp
+80102090:	89 c1                	mov    %eax,%ecx
+80102092:	89 d3                	mov    %edx,%ebx
+  bp = bread(dev, BBLOCK(b, sb));
+80102094:	89 d0                	mov    %edx,%eax
+80102096:	c1 e8 0f             	shr    $0xf,%eax
+80102099:	03 05 18 c2 11 80    	add    0x8011c218,%eax
+8010209f:	50                   	push   %eax
+801020a0:	51                   	push   %ecx
+801020a1:	e8 96 e8 ff ff       	call   8010093c <bread>
+801020a6:	89 c6                	mov    %eax,%esi
+  bi = b % BPB;
+801020a8:	89 da                	mov    %ebx,%edx
+801020aa:	81 e2 ff 7f 00 00    	and    $0x7fff,%edx
+  m = 1 << (bi % 8);
+801020b0:	89 d9                	mov    %ebx,%ecx
+801020b2:	83 e1 07             	and    $0x7,%ecx
+801020b5:	b8 01 00 00 00       	mov    $0x1,%eax
+801020ba:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+801020bc:	83 c4 10             	add    $0x10,%esp
+801020bf:	c1 fa 03             	sar    $0x3,%edx
+801020c2:	03 56 60             	add    0x60(%esi),%edx
+801020c5:	0f b6 0a             	movzbl (%edx),%ecx
+801020c8:	0f b6 f9             	movzbl %cl,%edi
+801020cb:	85 c7                	test   %eax,%edi
+801020cd:	74 4e                	je     8010211d <bfree+0x96>
+  bp->data[bi/8] &= ~m;
+801020cf:	f7 d0                	not    %eax
+801020d1:	21 c8                	and    %ecx,%eax
+801020d3:	88 02                	mov    %al,(%edx)
+  log_write(bp);
+801020d5:	83 ec 0c             	sub    $0xc,%esp
+801020d8:	56                   	push   %esi
+801020d9:	e8 e2 32 00 00       	call   801053c0 <log_write>
+  brelse(bp);
+801020de:	89 34 24             	mov    %esi,(%esp)
+801020e1:	e8 25 e9 ff ff       	call   80100a0b <brelse>
+  acquire(&bsum.lock);
+801020e6:	c7 04 24 c0 de 11 80 	movl   $0x8011dec0,(%esp)
+801020ed:	e8 f0 64 00 00       	call   801085e2 <acquire>
+  bsum.nfree[b / BGROUP]++;
+801020f2:	c1 eb 08             	shr    $0x8,%ebx
+801020f5:	ba c0 de 11 80       	mov    $0x8011dec0,%edx
+801020fa:	83 c3 18             	add    $0x18,%ebx
+801020fd:	0f b7 44 5a 08       	movzwl 0x8(%edx,%ebx,2),%eax
+80102102:	83 c0 01             	add    $0x1,%eax
+80102105:	66 89 44 5a 08       	mov    %ax,0x8(%edx,%ebx,2)
+  release(&bsum.lock);
+8010210a:	89 14 24             	mov    %edx,(%esp)
+8010210d:	e8 35 65 00 00       	call   80108647 <release>
+}
+80102112:	83 c4 10             	add    $0x10,%esp
+80102115:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102118:	5b                   	pop    %ebx
+80102119:	5e                   	pop    %esi
+8010211a:	5f                   	pop    %edi
+8010211b:	5d                   	pop    %ebp
+8010211c:	c3                   	ret
+    panic("freeing free block");
+8010211d:	83 ec 0c             	sub    $0xc,%esp
+80102120:	68 13 be 10 80       	push   $0x8010be13
+80102125:	e8 cc ea ff ff       	call   80100bf6 <panic>
+
+8010212a <bfreeind>:
+{
+8010212a:	55                   	push   %ebp
+8010212b:	89 e5                	mov    %esp,%ebp
+8010212d:	57                   	push   %edi
+8010212e:	56                   	push   %esi
+8010212f:	53                   	push   %ebx
+80102130:	83 ec 24             	sub    $0x24,%esp
+80102133:	89 c7                	mov    %eax,%edi
+80102135:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  bp = bread(dev, addr);
+80102138:	52                   	push   %edx
+80102139:	50                   	push   %eax
+8010213a:	e8 fd e7 ff ff       	call   8010093c <bread>
+  a = (uint*)bp->data;
+8010213f:	8b 70 60             	mov    0x60(%eax),%esi
+  for(j = 0; j < NINDIRECT; j++){
+80102142:	83 c4 10             	add    $0x10,%esp
+80102145:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010214a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010214d:	eb 03                	jmp    80102152 <bfreeind+0x28>
+8010214f:	83 c3 01             	add    $0x1,%ebx
+80102152:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+80102158:	77 10                	ja     8010216a <bfreeind+0x40>
+    if(a[j])
+8010215a:	8b 14 9e             	mov    (%esi,%ebx,4),%edx
+8010215d:	85 d2                	test   %edx,%edx
+8010215f:	74 ee                	je     8010214f <bfreeind+0x25>
+      bfree(dev, a[j]);
+80102161:	89 f8                	mov    %edi,%eax
+80102163:	e8 1f ff ff ff       	call   80102087 <bfree>
+80102168:	eb e5                	jmp    8010214f <bfreeind+0x25>
+  brelse(bp);
+8010216a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010216d:	83 ec 0c             	sub    $0xc,%esp
+80102170:	50                   	push   %eax
+80102171:	e8 95 e8 ff ff       	call   80100a0b <brelse>
+  bfree(dev, addr);
+80102176:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102179:	89 f8                	mov    %edi,%eax
+8010217b:	e8 07 ff ff ff       	call   80102087 <bfree>
+}
+80102180:	83 c4 10             	add    $0x10,%esp
+80102183:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102186:	5b                   	pop    %ebx
+80102187:	5e                   	pop    %esi
+80102188:	5f                   	pop    %edi
+80102189:	5d                   	pop    %ebp
+8010218a:	c3                   	ret
+
+8010218b <bscan>:
+{
+8010218b:	55                   	push   %ebp
+8010218c:	89 e5                	mov    %esp,%ebp
+8010218e:	57                   	push   %edi
+8010218f:	56                   	push   %esi
+80102190:	53                   	push   %ebx
+80102191:	83 ec 24             	sub    $0x24,%esp
+80102194:	89 d3                	mov    %edx,%ebx
+80102196:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  base = b - b % BPB;
+80102199:	89 d6                	mov    %edx,%esi
+8010219b:	81 e6 00 80 ff ff    	and    $0xffff8000,%esi
+  bp = bread(dev, BBLOCK(b, sb));
+801021a1:	c1 ea 0f             	shr    $0xf,%edx
+801021a4:	03 15 18 c2 11 80    	add    0x8011c218,%edx
+801021aa:	52                   	push   %edx
+801021ab:	50                   	push   %eax
+801021ac:	e8 8b e7 ff ff       	call   8010093c <bread>
+801021b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  w = (uint*)bp->data;
+801021b4:	8b 78 60             	mov    0x60(%eax),%edi
+  for(bi = b - base; bi < end - base; bi = bi - bi%32 + 32){
+801021b7:	29 f3                	sub    %esi,%ebx
+801021b9:	89 d9                	mov    %ebx,%ecx
+801021bb:	83 c4 10             	add    $0x10,%esp
+801021be:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801021c1:	29 f2                	sub    %esi,%edx
+801021c3:	39 d1                	cmp    %edx,%ecx
+801021c5:	73 23                	jae    801021ea <bscan+0x5f>
+    bits = ~w[bi/32] & (~0U << (bi%32));  // free bits from bi on
+801021c7:	89 c8                	mov    %ecx,%eax
+801021c9:	c1 e8 05             	shr    $0x5,%eax
+801021cc:	8b 04 87             	mov    (%edi,%eax,4),%eax
+801021cf:	f7 d0                	not    %eax
+801021d1:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801021d6:	d3 e3                	shl    %cl,%ebx
+    if(bits == 0)
+801021d8:	21 d8                	and    %ebx,%eax
+801021da:	74 29                	je     80102205 <bscan+0x7a>
+    bi = bi - bi%32 + __builtin_ctz(bits);
+801021dc:	83 e1 e0             	and    $0xffffffe0,%ecx
+801021df:	f3 0f bc c0          	tzcnt  %eax,%eax
+801021e3:	8d 1c 01             	lea    (%ecx,%eax,1),%ebx
+    if(bi >= end - base)
+801021e6:	39 d3                	cmp    %edx,%ebx
+801021e8:	72 23                	jb     8010220d <bscan+0x82>
+  brelse(bp);
+801021ea:	83 ec 0c             	sub    $0xc,%esp
+801021ed:	ff 75 e0             	push   -0x20(%ebp)
+801021f0:	e8 16 e8 ff ff       	call   80100a0b <brelse>
+  return 0;
+801021f5:	83 c4 10             	add    $0x10,%esp
+801021f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801021fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102200:	5b                   	pop    %ebx
+80102201:	5e                   	pop    %esi
+80102202:	5f                   	pop    %edi
+80102203:	5d                   	pop    %ebp
+80102204:	c3                   	ret
+  for(bi = b - base; bi < end - base; bi = bi - bi%32 + 32){
+80102205:	83 e1 e0             	and    $0xffffffe0,%ecx
+80102208:	83 c1 20             	add    $0x20,%ecx
+8010220b:	eb b1                	jmp    801021be <bscan+0x33>
+    w[bi/32] |= 1U << (bi%32);  // Mark block in use.
+8010220d:	89 da                	mov    %ebx,%edx
+8010220f:	c1 ea 05             	shr    $0x5,%edx
+80102212:	b8 01 00 00 00       	mov    $0x1,%eax
+80102217:	89 d9                	mov    %ebx,%ecx
+80102219:	d3 e0                	shl    %cl,%eax
+8010221b:	09 04 97             	or     %eax,(%edi,%edx,4)
+    log_write(bp);
+8010221e:	83 ec 0c             	sub    $0xc,%esp
+80102221:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80102224:	57                   	push   %edi
+80102225:	e8 96 31 00 00       	call   801053c0 <log_write>
+    brelse(bp);
+8010222a:	89 3c 24             	mov    %edi,(%esp)
+8010222d:	e8 d9 e7 ff ff       	call   80100a0b <brelse>
+    return base + bi;
+80102232:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+80102235:	83 c4 10             	add    $0x10,%esp
+80102238:	eb c3                	jmp    801021fd <bscan+0x72>
+
+8010223a <bzero>:
+{
+8010223a:	55                   	push   %ebp
+8010223b:	89 e5                	mov    %esp,%ebp
+8010223d:	53                   	push   %ebx
+8010223e:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, bno);
+80102241:	52                   	push   %edx
+80102242:	50                   	push   %eax
+80102243:	e8 f4 e6 ff ff       	call   8010093c <bread>
+80102248:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+8010224a:	8b 40 60             	mov    0x60(%eax),%eax
+8010224d:	83 c4 0c             	add    $0xc,%esp
+80102250:	68 00 10 00 00       	push   $0x1000
+80102255:	6a 00                	push   $0x0
+80102257:	50                   	push   %eax
+80102258:	e8 31 64 00 00       	call   8010868e <memset>
+  log_write(bp);
+8010225d:	89 1c 24             	mov    %ebx,(%esp)
+80102260:	e8 5b 31 00 00       	call   801053c0 <log_write>
+  brelse(bp);
+80102265:	89 1c 24             	mov    %ebx,(%esp)
+80102268:	e8 9e e7 ff ff       	call   80100a0b <brelse>
+}
+8010226d:	83 c4 10             	add    $0x10,%esp
+80102270:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102273:	c9                   	leave
+80102274:	c3                   	ret
+
+80102275 <balloc>:
+{
+80102275:	55                   	push   %ebp
+80102276:	89 e5                	mov    %esp,%ebp
+80102278:	57                   	push   %edi
+80102279:	56                   	push   %esi
+8010227a:	53                   	push   %ebx
+8010227b:	83 ec 1c             	sub    $0x1c,%esp
+8010227e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102281:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  if(goal >= sb.size)
+80102284:	3b 15 00 c2 11 80    	cmp    0x8011c200,%edx
+8010228a:	72 07                	jb     80102293 <balloc+0x1e>
+    goal = 0;
+8010228c:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  g = goal / BGROUP;
+80102293:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102296:	c1 eb 08             	shr    $0x8,%ebx
+  for(i = 0; i <= bsum.ngroup; i++, g = (g + 1) % bsum.ngroup){
+80102299:	be 00 00 00 00       	mov    $0x0,%esi
+8010229e:	eb 22                	jmp    801022c2 <balloc+0x4d>
+    b = bscan(dev, i == 0 ? goal : g*BGROUP, min((g+1)*BGROUP, sb.size));
+801022a0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801022a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801022a6:	e8 e0 fe ff ff       	call   8010218b <bscan>
+    if(b != 0){
+801022ab:	85 c0                	test   %eax,%eax
+801022ad:	75 6d                	jne    8010231c <balloc+0xa7>
+  for(i = 0; i <= bsum.ngroup; i++, g = (g + 1) % bsum.ngroup){
+801022af:	83 c6 01             	add    $0x1,%esi
+801022b2:	8d 43 01             	lea    0x1(%ebx),%eax
+801022b5:	ba 00 00 00 00       	mov    $0x0,%edx
+801022ba:	f7 35 f4 de 11 80    	divl   0x8011def4
+801022c0:	89 d3                	mov    %edx,%ebx
+801022c2:	39 35 f4 de 11 80    	cmp    %esi,0x8011def4
+801022c8:	72 45                	jb     8010230f <balloc+0x9a>
+    acquire(&bsum.lock);
+801022ca:	83 ec 0c             	sub    $0xc,%esp
+801022cd:	68 c0 de 11 80       	push   $0x8011dec0
+801022d2:	e8 0b 63 00 00       	call   801085e2 <acquire>
+    n = bsum.nfree[g];
+801022d7:	0f b7 bc 1b f8 de 11 	movzwl -0x7fee2108(%ebx,%ebx,1),%edi
+801022de:	80 
+    release(&bsum.lock);
+801022df:	c7 04 24 c0 de 11 80 	movl   $0x8011dec0,(%esp)
+801022e6:	e8 5c 63 00 00       	call   80108647 <release>
+    if(n == 0)
+801022eb:	83 c4 10             	add    $0x10,%esp
+801022ee:	66 85 ff             	test   %di,%di
+801022f1:	74 bc                	je     801022af <balloc+0x3a>
+    b = bscan(dev, i == 0 ? goal : g*BGROUP, min((g+1)*BGROUP, sb.size));
+801022f3:	8b 0d 00 c2 11 80    	mov    0x8011c200,%ecx
+801022f9:	8d 43 01             	lea    0x1(%ebx),%eax
+801022fc:	c1 e0 08             	shl    $0x8,%eax
+801022ff:	39 c1                	cmp    %eax,%ecx
+80102301:	0f 47 c8             	cmova  %eax,%ecx
+80102304:	85 f6                	test   %esi,%esi
+80102306:	74 98                	je     801022a0 <balloc+0x2b>
+80102308:	89 da                	mov    %ebx,%edx
+8010230a:	c1 e2 08             	shl    $0x8,%edx
+8010230d:	eb 94                	jmp    801022a3 <balloc+0x2e>
+  panic("balloc: out of blocks");
+8010230f:	83 ec 0c             	sub    $0xc,%esp
+80102312:	68 26 be 10 80       	push   $0x8010be26
+80102317:	e8 da e8 ff ff       	call   80100bf6 <panic>
+      acquire(&bsum.lock);
+8010231c:	89 c7                	mov    %eax,%edi
+8010231e:	83 ec 0c             	sub    $0xc,%esp
+80102321:	68 c0 de 11 80       	push   $0x8011dec0
+80102326:	e8 b7 62 00 00       	call   801085e2 <acquire>
+      bsum.nfree[g]--;
+8010232b:	ba c0 de 11 80       	mov    $0x8011dec0,%edx
+80102330:	83 c3 18             	add    $0x18,%ebx
+80102333:	0f b7 44 5a 08       	movzwl 0x8(%edx,%ebx,2),%eax
+80102338:	83 e8 01             	sub    $0x1,%eax
+8010233b:	66 89 44 5a 08       	mov    %ax,0x8(%edx,%ebx,2)
+      release(&bsum.lock);
+80102340:	89 14 24             	mov    %edx,(%esp)
+80102343:	e8 ff 62 00 00       	call   80108647 <release>
+      bzero(dev, b);
+80102348:	89 fa                	mov    %edi,%edx
+8010234a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010234d:	e8 e8 fe ff ff       	call   8010223a <bzero>
+}
+80102352:	89 f8                	mov    %edi,%eax
+80102354:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102357:	5b                   	pop    %ebx
+80102358:	5e                   	pop    %esi
+80102359:	5f                   	pop    %edi
+8010235a:	5d                   	pop    %ebp
+8010235b:	c3                   	ret
+
+8010235c <iballoc>:
+{
+8010235c:	55                   	push   %ebp
+8010235d:	89 e5                	mov    %esp,%ebp
+8010235f:	53                   	push   %ebx
+80102360:	83 ec 04             	sub    $0x4,%esp
+80102363:	89 c3                	mov    %eax,%ebx
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80102365:	8b 90 e4 00 00 00    	mov    0xe4(%eax),%edx
+8010236b:	85 d2                	test   %edx,%edx
+8010236d:	74 03                	je     80102372 <iballoc+0x16>
+8010236f:	83 c2 01             	add    $0x1,%edx
+80102372:	8b 03                	mov    (%ebx),%eax
+80102374:	e8 fc fe ff ff       	call   80102275 <balloc>
+80102379:	89 83 e4 00 00 00    	mov    %eax,0xe4(%ebx)
+}
+8010237f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102382:	c9                   	leave
+80102383:	c3                   	ret
+
+80102384 <bmap1>:
+{
+80102384:	55                   	push   %ebp
+80102385:	89 e5                	mov    %esp,%ebp
+80102387:	57                   	push   %edi
+80102388:	56                   	push   %esi
+80102389:	53                   	push   %ebx
+8010238a:	83 ec 2c             	sub    $0x2c,%esp
+8010238d:	89 c3                	mov    %eax,%ebx
+8010238f:	89 d7                	mov    %edx,%edi
+80102391:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(bn < NDIRECT){
+80102394:	83 fa 0a             	cmp    $0xa,%edx
+80102397:	76 58                	jbe    801023f1 <bmap1+0x6d>
+  if(bn - ip->mapbn < ip->nmap && (addr = ip->map[bn - ip->mapbn]) != 0)
+80102399:	89 d0                	mov    %edx,%eax
+8010239b:	2b 83 9c 00 00 00    	sub    0x9c(%ebx),%eax
+801023a1:	3b 83 a0 00 00 00    	cmp    0xa0(%ebx),%eax
+801023a7:	73 0f                	jae    801023b8 <bmap1+0x34>
+801023a9:	8b b4 83 a4 00 00 00 	mov    0xa4(%ebx,%eax,4),%esi
+801023b0:	85 f6                	test   %esi,%esi
+801023b2:	0f 85 54 01 00 00    	jne    8010250c <bmap1+0x188>
+  i = bn - NDIRECT;
+801023b8:	8d 47 f5             	lea    -0xb(%edi),%eax
+801023bb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(i < NINDIRECT){
+801023be:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+801023c3:	77 50                	ja     80102415 <bmap1+0x91>
+    if((addr = ip->addrs[NDIRECT]) == 0){
+801023c5:	8b b3 94 00 00 00    	mov    0x94(%ebx),%esi
+801023cb:	85 f6                	test   %esi,%esi
+801023cd:	0f 85 c8 00 00 00    	jne    8010249b <bmap1+0x117>
+      if(!alloc)
+801023d3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801023d7:	0f 84 2f 01 00 00    	je     8010250c <bmap1+0x188>
+      ip->addrs[NDIRECT] = addr = iballoc(ip);
+801023dd:	89 d8                	mov    %ebx,%eax
+801023df:	e8 78 ff ff ff       	call   8010235c <iballoc>
+801023e4:	89 c6                	mov    %eax,%esi
+801023e6:	89 83 94 00 00 00    	mov    %eax,0x94(%ebx)
+801023ec:	e9 aa 00 00 00       	jmp    8010249b <bmap1+0x117>
+    if((addr = ip->addrs[bn]) == 0 && alloc)
+801023f1:	8b 74 90 68          	mov    0x68(%eax,%edx,4),%esi
+801023f5:	85 f6                	test   %esi,%esi
+801023f7:	0f 85 0f 01 00 00    	jne    8010250c <bmap1+0x188>
+801023fd:	85 c9                	test   %ecx,%ecx
+801023ff:	0f 84 07 01 00 00    	je     8010250c <bmap1+0x188>
+      ip->addrs[bn] = addr = iballoc(ip);
+80102405:	e8 52 ff ff ff       	call   8010235c <iballoc>
+8010240a:	89 c6                	mov    %eax,%esi
+8010240c:	89 44 bb 68          	mov    %eax,0x68(%ebx,%edi,4)
+    return addr;
+80102410:	e9 f7 00 00 00       	jmp    8010250c <bmap1+0x188>
+    i -= NINDIRECT;
+80102415:	8d 87 f5 fb ff ff    	lea    -0x40b(%edi),%eax
+8010241b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(i >= NDINDIRECT)
+8010241e:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+80102423:	0f 87 ed 00 00 00    	ja     80102516 <bmap1+0x192>
+    if((addr = ip->addrs[NDIRECT+1]) == 0){
+80102429:	8b b3 98 00 00 00    	mov    0x98(%ebx),%esi
+8010242f:	85 f6                	test   %esi,%esi
+80102431:	75 19                	jne    8010244c <bmap1+0xc8>
+      if(!alloc)
+80102433:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+80102437:	0f 84 cf 00 00 00    	je     8010250c <bmap1+0x188>
+      ip->addrs[NDIRECT+1] = addr = iballoc(ip);
+8010243d:	89 d8                	mov    %ebx,%eax
+8010243f:	e8 18 ff ff ff       	call   8010235c <iballoc>
+80102444:	89 c6                	mov    %eax,%esi
+80102446:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+    bp = bread(ip->dev, addr);
+8010244c:	83 ec 08             	sub    $0x8,%esp
+8010244f:	56                   	push   %esi
+80102450:	ff 33                	push   (%ebx)
+80102452:	e8 e5 e4 ff ff       	call   8010093c <bread>
+80102457:	89 c1                	mov    %eax,%ecx
+80102459:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    if((addr = a[i/NINDIRECT]) == 0 && alloc){
+8010245c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010245f:	c1 e8 0a             	shr    $0xa,%eax
+80102462:	c1 e0 02             	shl    $0x2,%eax
+80102465:	03 41 60             	add    0x60(%ecx),%eax
+80102468:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010246b:	8b 30                	mov    (%eax),%esi
+8010246d:	83 c4 10             	add    $0x10,%esp
+80102470:	85 f6                	test   %esi,%esi
+80102472:	75 0a                	jne    8010247e <bmap1+0xfa>
+80102474:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+80102478:	0f 85 a5 00 00 00    	jne    80102523 <bmap1+0x19f>
+    brelse(bp);
+8010247e:	83 ec 0c             	sub    $0xc,%esp
+80102481:	ff 75 dc             	push   -0x24(%ebp)
+80102484:	e8 82 e5 ff ff       	call   80100a0b <brelse>
+    if(addr == 0)
+80102489:	83 c4 10             	add    $0x10,%esp
+8010248c:	85 f6                	test   %esi,%esi
+8010248e:	74 7c                	je     8010250c <bmap1+0x188>
+    i %= NINDIRECT;
+80102490:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102493:	25 ff 03 00 00       	and    $0x3ff,%eax
+80102498:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  bp = bread(ip->dev, addr);
+8010249b:	83 ec 08             	sub    $0x8,%esp
+8010249e:	56                   	push   %esi
+8010249f:	ff 33                	push   (%ebx)
+801024a1:	e8 96 e4 ff ff       	call   8010093c <bread>
+801024a6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  a = (uint*)bp->data;
+801024a9:	8b 40 60             	mov    0x60(%eax),%eax
+801024ac:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  if((addr = a[i]) == 0 && alloc){
+801024af:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801024b2:	8d 04 90             	lea    (%eax,%edx,4),%eax
+801024b5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801024b8:	8b 30                	mov    (%eax),%esi
+801024ba:	83 c4 10             	add    $0x10,%esp
+801024bd:	85 f6                	test   %esi,%esi
+801024bf:	75 06                	jne    801024c7 <bmap1+0x143>
+801024c1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801024c5:	75 7d                	jne    80102544 <bmap1+0x1c0>
+  ip->mapbn = bn - i%NBMAP;
+801024c7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801024ca:	89 ca                	mov    %ecx,%edx
+801024cc:	83 e2 0f             	and    $0xf,%edx
+801024cf:	89 f8                	mov    %edi,%eax
+801024d1:	29 d0                	sub    %edx,%eax
+801024d3:	89 83 9c 00 00 00    	mov    %eax,0x9c(%ebx)
+  ip->nmap = NBMAP;
+801024d9:	c7 83 a0 00 00 00 10 	movl   $0x10,0xa0(%ebx)
+801024e0:	00 00 00 
+  memmove(ip->map, a + i - i%NBMAP, sizeof(ip->map));
+801024e3:	83 e1 f0             	and    $0xfffffff0,%ecx
+801024e6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801024e9:	8d 04 88             	lea    (%eax,%ecx,4),%eax
+801024ec:	81 c3 a4 00 00 00    	add    $0xa4,%ebx
+801024f2:	83 ec 04             	sub    $0x4,%esp
+801024f5:	6a 40                	push   $0x40
+801024f7:	50                   	push   %eax
+801024f8:	53                   	push   %ebx
+801024f9:	e8 08 62 00 00       	call   80108706 <memmove>
+  brelse(bp);
+801024fe:	83 c4 04             	add    $0x4,%esp
+80102501:	ff 75 dc             	push   -0x24(%ebp)
+80102504:	e8 02 e5 ff ff       	call   80100a0b <brelse>
+  return addr;
+80102509:	83 c4 10             	add    $0x10,%esp
+}
+8010250c:	89 f0                	mov    %esi,%eax
+8010250e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102511:	5b                   	pop    %ebx
+80102512:	5e                   	pop    %esi
+80102513:	5f                   	pop    %edi
+80102514:	5d                   	pop    %ebp
+80102515:	c3                   	ret
+      panic("bmap: out of range");
+80102516:	83 ec 0c             	sub    $0xc,%esp
+80102519:	68 3c be 10 80       	push   $0x8010be3c
+8010251e:	e8 d3 e6 ff ff       	call   80100bf6 <panic>
+      a[i/NINDIRECT] = addr = iballoc(ip);
+80102523:	89 d8                	mov    %ebx,%eax
+80102525:	e8 32 fe ff ff       	call   8010235c <iballoc>
+8010252a:	89 c6                	mov    %eax,%esi
+8010252c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+8010252f:	89 30                	mov    %esi,(%eax)
+      log_write(bp);
+80102531:	83 ec 0c             	sub    $0xc,%esp
+80102534:	ff 75 dc             	push   -0x24(%ebp)
+80102537:	e8 84 2e 00 00       	call   801053c0 <log_write>
+8010253c:	83 c4 10             	add    $0x10,%esp
+8010253f:	e9 3a ff ff ff       	jmp    8010247e <bmap1+0xfa>
+    a[i] = addr = iballoc(ip);
+80102544:	89 d8                	mov    %ebx,%eax
+80102546:	e8 11 fe ff ff       	call   8010235c <iballoc>
+8010254b:	89 c6                	mov    %eax,%esi
+8010254d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80102550:	89 30                	mov    %esi,(%eax)
+    log_write(bp);
+80102552:	83 ec 0c             	sub    $0xc,%esp
+80102555:	ff 75 dc             	push   -0x24(%ebp)
+80102558:	e8 63 2e 00 00       	call   801053c0 <log_write>
+8010255d:	83 c4 10             	add    $0x10,%esp
+80102560:	e9 62 ff ff ff       	jmp    801024c7 <bmap1+0x143>
+
+80102565 <bmap>:
+{
+80102565:	55                   	push   %ebp
+80102566:	89 e5                	mov    %esp,%ebp
+80102568:	56                   	push   %esi
+80102569:	53                   	push   %ebx
+8010256a:	89 c3                	mov    %eax,%ebx
+8010256c:	89 d6                	mov    %edx,%esi
+  if(ip->lastblk == 0 && ip->size > 0)
+8010256e:	83 b8 e4 00 00 00 00 	cmpl   $0x0,0xe4(%eax)
+80102575:	75 07                	jne    8010257e <bmap+0x19>
+80102577:	8b 50 64             	mov    0x64(%eax),%edx
+8010257a:	85 d2                	test   %edx,%edx
+8010257c:	75 12                	jne    80102590 <bmap+0x2b>
+  return bmap1(ip, bn, 1);
+8010257e:	b9 01 00 00 00       	mov    $0x1,%ecx
+80102583:	89 f2                	mov    %esi,%edx
+80102585:	89 d8                	mov    %ebx,%eax
+80102587:	e8 f8 fd ff ff       	call   80102384 <bmap1>
+}
+8010258c:	5b                   	pop    %ebx
+8010258d:	5e                   	pop    %esi
+8010258e:	5d                   	pop    %ebp
+8010258f:	c3                   	ret
+    ip->lastblk = bmap1(ip, (ip->size-1)/BSIZE, 0);
+80102590:	83 ea 01             	sub    $0x1,%edx
+80102593:	c1 ea 0c             	shr    $0xc,%edx
+80102596:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010259b:	e8 e4 fd ff ff       	call   80102384 <bmap1>
+801025a0:	89 83 e4 00 00 00    	mov    %eax,0xe4(%ebx)
+801025a6:	eb d6                	jmp    8010257e <bmap+0x19>
+
+801025a8 <bmappeek>:
+{
+801025a8:	55                   	push   %ebp
+801025a9:	89 e5                	mov    %esp,%ebp
+801025ab:	83 ec 08             	sub    $0x8,%esp
+  return bmap1(ip, bn, 0);
+801025ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+801025b3:	e8 cc fd ff ff       	call   80102384 <bmap1>
+}
+801025b8:	c9                   	leave
+801025b9:	c3                   	ret
+
+801025ba <igrow>:
+{
+801025ba:	55                   	push   %ebp
+801025bb:	89 e5                	mov    %esp,%ebp
+801025bd:	56                   	push   %esi
+801025be:	53                   	push   %ebx
+  if((np = (struct inode*)kalloc()) == 0)
+801025bf:	e8 6c 25 00 00       	call   80104b30 <kalloc>
+801025c4:	85 c0                	test   %eax,%eax
+801025c6:	74 55                	je     8010261d <igrow+0x63>
+801025c8:	89 c6                	mov    %eax,%esi
+  memset(np, 0, PGSIZE);
+801025ca:	83 ec 04             	sub    $0x4,%esp
+801025cd:	68 00 10 00 00       	push   $0x1000
+801025d2:	6a 00                	push   $0x0
+801025d4:	50                   	push   %eax
+801025d5:	e8 b4 60 00 00       	call   8010868e <memset>
+  for(ip = np; ip < np + PGSIZE/sizeof(*ip); ip++){
+801025da:	83 c4 10             	add    $0x10,%esp
+801025dd:	89 f3                	mov    %esi,%ebx
+801025df:	eb 26                	jmp    80102607 <igrow+0x4d>
+    initsleeplock(&ip->lock, "inode");
+801025e1:	83 ec 08             	sub    $0x8,%esp
+801025e4:	68 4f be 10 80       	push   $0x8010be4f
+801025e9:	8d 43 18             	lea    0x18(%ebx),%eax
+801025ec:	50                   	push   %eax
+801025ed:	e8 c8 5d 00 00       	call   801083ba <initsleeplock>
+    ilruadd(ip, 0);
+801025f2:	ba 00 00 00 00       	mov    $0x0,%edx
+801025f7:	89 d8                	mov    %ebx,%eax
+801025f9:	e8 27 f9 ff ff       	call   80101f25 <ilruadd>
+  for(ip = np; ip < np + PGSIZE/sizeof(*ip); ip++){
+801025fe:	81 c3 fc 00 00 00    	add    $0xfc,%ebx
+80102604:	83 c4 10             	add    $0x10,%esp
+80102607:	8d 86 c0 0f 00 00    	lea    0xfc0(%esi),%eax
+8010260d:	39 c3                	cmp    %eax,%ebx
+8010260f:	72 d0                	jb     801025e1 <igrow+0x27>
+  return 1;
+80102611:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80102616:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102619:	5b                   	pop    %ebx
+8010261a:	5e                   	pop    %esi
+8010261b:	5d                   	pop    %ebp
+8010261c:	c3                   	ret
+    return 0;
+8010261d:	b8 00 00 00 00       	mov    $0x0,%eax
+80102622:	eb f2                	jmp    80102616 <igrow+0x5c>
+
+80102624 <dirindexfree>:
+{
+80102624:	55                   	push   %ebp
+80102625:	89 e5                	mov    %esp,%ebp
+80102627:	56                   	push   %esi
+80102628:	53                   	push   %ebx
+80102629:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < dp->ndirhash; i++)
+8010262b:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102630:	eb 1d                	jmp    8010264f <dirindexfree+0x2b>
+    kfree((char*)dp->dirhash[i]);
+80102632:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+80102639:	03 86 ec 00 00 00    	add    0xec(%esi),%eax
+8010263f:	83 ec 0c             	sub    $0xc,%esp
+80102642:	ff 30                	push   (%eax)
+80102644:	e8 c8 22 00 00       	call   80104911 <kfree>
+  for(i = 0; i < dp->ndirhash; i++)
+80102649:	83 c3 01             	add    $0x1,%ebx
+8010264c:	83 c4 10             	add    $0x10,%esp
+8010264f:	39 9e f0 00 00 00    	cmp    %ebx,0xf0(%esi)
+80102655:	7f db                	jg     80102632 <dirindexfree+0xe>
+  if(dp->dirhash)
+80102657:	8b 86 ec 00 00 00    	mov    0xec(%esi),%eax
+8010265d:	85 c0                	test   %eax,%eax
+8010265f:	74 0c                	je     8010266d <dirindexfree+0x49>
+    kfree((char*)dp->dirhash);
+80102661:	83 ec 0c             	sub    $0xc,%esp
+80102664:	50                   	push   %eax
+80102665:	e8 a7 22 00 00       	call   80104911 <kfree>
+8010266a:	83 c4 10             	add    $0x10,%esp
+  dp->dirhash = 0;
+8010266d:	c7 86 ec 00 00 00 00 	movl   $0x0,0xec(%esi)
+80102674:	00 00 00 
+  dp->ndirhash = 0;
+80102677:	c7 86 f0 00 00 00 00 	movl   $0x0,0xf0(%esi)
+8010267e:	00 00 00 
+}
+80102681:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102684:	5b                   	pop    %ebx
+80102685:	5e                   	pop    %esi
+80102686:	5d                   	pop    %ebp
+80102687:	c3                   	ret
+
+80102688 <iget>:
+{
+80102688:	55                   	push   %ebp
+80102689:	89 e5                	mov    %esp,%ebp
+8010268b:	57                   	push   %edi
+8010268c:	56                   	push   %esi
+8010268d:	53                   	push   %ebx
+8010268e:	83 ec 1c             	sub    $0x1c,%esp
+80102691:	89 c6                	mov    %eax,%esi
+80102693:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102696:	89 d3                	mov    %edx,%ebx
+80102698:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  bk = ihash(dev, inum);
+8010269b:	e8 f1 f6 ff ff       	call   80101d91 <ihash>
+801026a0:	89 c7                	mov    %eax,%edi
+  acquire(&bk->lock);
+801026a2:	83 ec 0c             	sub    $0xc,%esp
+801026a5:	50                   	push   %eax
+801026a6:	e8 37 5f 00 00       	call   801085e2 <acquire>
+  ip = ilookup(bk, dev, inum);
+801026ab:	89 d9                	mov    %ebx,%ecx
+801026ad:	89 f2                	mov    %esi,%edx
+801026af:	89 f8                	mov    %edi,%eax
+801026b1:	e8 f7 f8 ff ff       	call   80101fad <ilookup>
+801026b6:	89 c3                	mov    %eax,%ebx
+  release(&bk->lock);
+801026b8:	89 3c 24             	mov    %edi,(%esp)
+801026bb:	e8 87 5f 00 00       	call   80108647 <release>
+  if(ip)
+801026c0:	83 c4 10             	add    $0x10,%esp
+801026c3:	85 db                	test   %ebx,%ebx
+801026c5:	74 0a                	je     801026d1 <iget+0x49>
+}
+801026c7:	89 d8                	mov    %ebx,%eax
+801026c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801026cc:	5b                   	pop    %ebx
+801026cd:	5e                   	pop    %esi
+801026ce:	5f                   	pop    %edi
+801026cf:	5d                   	pop    %ebp
+801026d0:	c3                   	ret
+  acquire(&icache.evictlock);
+801026d1:	83 ec 0c             	sub    $0xc,%esp
+801026d4:	68 48 8f 11 80       	push   $0x80118f48
+801026d9:	e8 04 5f 00 00       	call   801085e2 <acquire>
+  acquire(&bk->lock);
+801026de:	89 3c 24             	mov    %edi,(%esp)
+801026e1:	e8 fc 5e 00 00       	call   801085e2 <acquire>
+  ip = ilookup(bk, dev, inum);
+801026e6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801026e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801026ec:	89 f8                	mov    %edi,%eax
+801026ee:	e8 ba f8 ff ff       	call   80101fad <ilookup>
+801026f3:	89 c3                	mov    %eax,%ebx
+  release(&bk->lock);
+801026f5:	89 3c 24             	mov    %edi,(%esp)
+801026f8:	e8 4a 5f 00 00       	call   80108647 <release>
+  if(ip){
+801026fd:	83 c4 10             	add    $0x10,%esp
+80102700:	85 db                	test   %ebx,%ebx
+80102702:	74 1b                	je     8010271f <iget+0x97>
+    release(&icache.evictlock);
+80102704:	83 ec 0c             	sub    $0xc,%esp
+80102707:	68 48 8f 11 80       	push   $0x80118f48
+8010270c:	e8 36 5f 00 00       	call   80108647 <release>
+    return ip;
+80102711:	83 c4 10             	add    $0x10,%esp
+80102714:	eb b1                	jmp    801026c7 <iget+0x3f>
+      if(igrow() == 0)
+80102716:	e8 9f fe ff ff       	call   801025ba <igrow>
+8010271b:	85 c0                	test   %eax,%eax
+8010271d:	74 56                	je     80102775 <iget+0xed>
+    acquire(&icache.lrulock);
+8010271f:	83 ec 0c             	sub    $0xc,%esp
+80102722:	68 7c 8f 11 80       	push   $0x80118f7c
+80102727:	e8 b6 5e 00 00       	call   801085e2 <acquire>
+    ip = icache.head.lprev;
+8010272c:	8b 1d c0 8f 11 80    	mov    0x80118fc0,%ebx
+    release(&icache.lrulock);
+80102732:	c7 04 24 7c 8f 11 80 	movl   $0x80118f7c,(%esp)
+80102739:	e8 09 5f 00 00       	call   80108647 <release>
+    if(ip == &icache.head){
+8010273e:	83 c4 10             	add    $0x10,%esp
+80102741:	81 fb b0 8f 11 80    	cmp    $0x80118fb0,%ebx
+80102747:	74 cd                	je     80102716 <iget+0x8e>
+    obk = ihash(ip->dev, ip->inum);
+80102749:	8b 53 04             	mov    0x4(%ebx),%edx
+8010274c:	8b 03                	mov    (%ebx),%eax
+8010274e:	e8 3e f6 ff ff       	call   80101d91 <ihash>
+80102753:	89 c6                	mov    %eax,%esi
+    acquire(&obk->lock);
+80102755:	83 ec 0c             	sub    $0xc,%esp
+80102758:	50                   	push   %eax
+80102759:	e8 84 5e 00 00       	call   801085e2 <acquire>
+    if(ip->ref == 0)
+8010275e:	83 c4 10             	add    $0x10,%esp
+80102761:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+80102765:	74 1b                	je     80102782 <iget+0xfa>
+    release(&obk->lock);
+80102767:	83 ec 0c             	sub    $0xc,%esp
+8010276a:	56                   	push   %esi
+8010276b:	e8 d7 5e 00 00       	call   80108647 <release>
+80102770:	83 c4 10             	add    $0x10,%esp
+80102773:	eb aa                	jmp    8010271f <iget+0x97>
+        panic("iget: no inodes");
+80102775:	83 ec 0c             	sub    $0xc,%esp
+80102778:	68 55 be 10 80       	push   $0x8010be55
+8010277d:	e8 74 e4 ff ff       	call   80100bf6 <panic>
+  for(pp = &obk->head; *pp; pp = &(*pp)->hnext){
+80102782:	8d 56 34             	lea    0x34(%esi),%edx
+80102785:	eb 03                	jmp    8010278a <iget+0x102>
+80102787:	8d 50 0c             	lea    0xc(%eax),%edx
+8010278a:	8b 02                	mov    (%edx),%eax
+8010278c:	85 c0                	test   %eax,%eax
+8010278e:	74 09                	je     80102799 <iget+0x111>
+    if(*pp == ip){
+80102790:	39 d8                	cmp    %ebx,%eax
+80102792:	75 f3                	jne    80102787 <iget+0xff>
+      *pp = ip->hnext;
+80102794:	8b 43 0c             	mov    0xc(%ebx),%eax
+80102797:	89 02                	mov    %eax,(%edx)
+  ilruremove(ip);
+80102799:	89 d8                	mov    %ebx,%eax
+8010279b:	e8 d7 f7 ff ff       	call   80101f77 <ilruremove>
+  ip->ref = 1;
+801027a0:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+  release(&obk->lock);
+801027a7:	83 ec 0c             	sub    $0xc,%esp
+801027aa:	56                   	push   %esi
+801027ab:	e8 97 5e 00 00       	call   80108647 <release>
+  dirindexfree(ip);
+801027b0:	89 d8                	mov    %ebx,%eax
+801027b2:	e8 6d fe ff ff       	call   80102624 <dirindexfree>
+  ip->dev = dev;
+801027b7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801027ba:	89 03                	mov    %eax,(%ebx)
+  ip->inum = inum;
+801027bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801027bf:	89 43 04             	mov    %eax,0x4(%ebx)
+  ip->valid = 0;
+801027c2:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  acquire(&bk->lock);
+801027c9:	89 3c 24             	mov    %edi,(%esp)
+801027cc:	e8 11 5e 00 00       	call   801085e2 <acquire>
+  ip->hnext = bk->head;
+801027d1:	8b 47 34             	mov    0x34(%edi),%eax
+801027d4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  bk->head = ip;
+801027d7:	89 5f 34             	mov    %ebx,0x34(%edi)
+  release(&bk->lock);
+801027da:	89 3c 24             	mov    %edi,(%esp)
+801027dd:	e8 65 5e 00 00       	call   80108647 <release>
+  release(&icache.evictlock);
+801027e2:	c7 04 24 48 8f 11 80 	movl   $0x80118f48,(%esp)
+801027e9:	e8 59 5e 00 00       	call   80108647 <release>
+  return ip;
+801027ee:	83 c4 10             	add    $0x10,%esp
+801027f1:	e9 d1 fe ff ff       	jmp    801026c7 <iget+0x3f>
+
+801027f6 <dirindex>:
+{
+801027f6:	55                   	push   %ebp
+801027f7:	89 e5                	mov    %esp,%ebp
+801027f9:	57                   	push   %edi
+801027fa:	56                   	push   %esi
+801027fb:	53                   	push   %ebx
+801027fc:	83 ec 0c             	sub    $0xc,%esp
+801027ff:	89 c3                	mov    %eax,%ebx
+  dirindexfree(dp);
+80102801:	e8 1e fe ff ff       	call   80102624 <dirindexfree>
+  if(dp->size <= DIRIDXMIN)
+80102806:	8b 4b 64             	mov    0x64(%ebx),%ecx
+80102809:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+8010280f:	76 24                	jbe    80102835 <dirindex+0x3f>
+  n = dp->size / sizeof(struct dirent);
+80102811:	c1 e9 04             	shr    $0x4,%ecx
+  for(npg = 1; npg * DIRSLOTS < 4*n; npg *= 2)
+80102814:	be 01 00 00 00       	mov    $0x1,%esi
+80102819:	eb 02                	jmp    8010281d <dirindex+0x27>
+8010281b:	01 f6                	add    %esi,%esi
+8010281d:	89 f2                	mov    %esi,%edx
+8010281f:	c1 e2 0a             	shl    $0xa,%edx
+80102822:	8d 04 8d 00 00 00 00 	lea    0x0(,%ecx,4),%eax
+80102829:	39 c2                	cmp    %eax,%edx
+8010282b:	72 ee                	jb     8010281b <dirindex+0x25>
+  if(npg > DIRPAGES)
+8010282d:	81 fe 00 04 00 00    	cmp    $0x400,%esi
+80102833:	76 08                	jbe    8010283d <dirindex+0x47>
+}
+80102835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102838:	5b                   	pop    %ebx
+80102839:	5e                   	pop    %esi
+8010283a:	5f                   	pop    %edi
+8010283b:	5d                   	pop    %ebp
+8010283c:	c3                   	ret
+  if((dp->dirhash = (uint**)kalloc()) == 0)
+8010283d:	e8 ee 22 00 00       	call   80104b30 <kalloc>
+80102842:	89 83 ec 00 00 00    	mov    %eax,0xec(%ebx)
+80102848:	85 c0                	test   %eax,%eax
+8010284a:	74 e9                	je     80102835 <dirindex+0x3f>
+  for(dp->ndirhash = 0; dp->ndirhash < npg; dp->ndirhash++){
+8010284c:	c7 83 f0 00 00 00 00 	movl   $0x0,0xf0(%ebx)
+80102853:	00 00 00 
+80102856:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+8010285c:	39 f0                	cmp    %esi,%eax
+8010285e:	7d 55                	jge    801028b5 <dirindex+0xbf>
+    if((dp->dirhash[dp->ndirhash] = (uint*)kalloc()) == 0){
+80102860:	8d 3c 85 00 00 00 00 	lea    0x0(,%eax,4),%edi
+80102867:	03 bb ec 00 00 00    	add    0xec(%ebx),%edi
+8010286d:	e8 be 22 00 00       	call   80104b30 <kalloc>
+80102872:	89 07                	mov    %eax,(%edi)
+80102874:	85 c0                	test   %eax,%eax
+80102876:	74 34                	je     801028ac <dirindex+0xb6>
+    memset(dp->dirhash[dp->ndirhash], 0, PGSIZE);
+80102878:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+8010287e:	c1 e0 02             	shl    $0x2,%eax
+80102881:	03 83 ec 00 00 00    	add    0xec(%ebx),%eax
+80102887:	83 ec 04             	sub    $0x4,%esp
+8010288a:	68 00 10 00 00       	push   $0x1000
+8010288f:	6a 00                	push   $0x0
+80102891:	ff 30                	push   (%eax)
+80102893:	e8 f6 5d 00 00       	call   8010868e <memset>
+  for(dp->ndirhash = 0; dp->ndirhash < npg; dp->ndirhash++){
+80102898:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+8010289e:	83 c0 01             	add    $0x1,%eax
+801028a1:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+801028a7:	83 c4 10             	add    $0x10,%esp
+801028aa:	eb aa                	jmp    80102856 <dirindex+0x60>
+      dirindexfree(dp);
+801028ac:	89 d8                	mov    %ebx,%eax
+801028ae:	e8 71 fd ff ff       	call   80102624 <dirindexfree>
+      return;
+801028b3:	eb 80                	jmp    80102835 <dirindex+0x3f>
+  dp->dirused = 0;
+801028b5:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+801028bc:	00 00 00 
+  dp->dirfree = dp->size;
+801028bf:	8b 43 64             	mov    0x64(%ebx),%eax
+801028c2:	89 83 f8 00 00 00    	mov    %eax,0xf8(%ebx)
+  bp = 0;
+801028c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  for(off = 0; off < dp->size; off += sizeof(*de)){
+801028cd:	be 00 00 00 00       	mov    $0x0,%esi
+801028d2:	eb 39                	jmp    8010290d <dirindex+0x117>
+        brelse(bp);
+801028d4:	83 ec 0c             	sub    $0xc,%esp
+801028d7:	57                   	push   %edi
+801028d8:	e8 2e e1 ff ff       	call   80100a0b <brelse>
+801028dd:	83 c4 10             	add    $0x10,%esp
+      bp = bread(dp->dev, bmap(dp, off / BSIZE));
+801028e0:	89 f2                	mov    %esi,%edx
+801028e2:	c1 ea 0c             	shr    $0xc,%edx
+801028e5:	89 d8                	mov    %ebx,%eax
+801028e7:	e8 79 fc ff ff       	call   80102565 <bmap>
+801028ec:	83 ec 08             	sub    $0x8,%esp
+801028ef:	50                   	push   %eax
+801028f0:	ff 33                	push   (%ebx)
+801028f2:	e8 45 e0 ff ff       	call   8010093c <bread>
+801028f7:	89 c7                	mov    %eax,%edi
+801028f9:	83 c4 10             	add    $0x10,%esp
+801028fc:	eb 20                	jmp    8010291e <dirindex+0x128>
+      dirindexadd(dp, de->name, off);
+801028fe:	83 c2 02             	add    $0x2,%edx
+80102901:	89 f1                	mov    %esi,%ecx
+80102903:	89 d8                	mov    %ebx,%eax
+80102905:	e8 0a f5 ff ff       	call   80101e14 <dirindexadd>
+  for(off = 0; off < dp->size; off += sizeof(*de)){
+8010290a:	83 c6 10             	add    $0x10,%esi
+8010290d:	3b 73 64             	cmp    0x64(%ebx),%esi
+80102910:	73 2d                	jae    8010293f <dirindex+0x149>
+    if(bp == 0 || off % BSIZE == 0){
+80102912:	85 ff                	test   %edi,%edi
+80102914:	74 ca                	je     801028e0 <dirindex+0xea>
+80102916:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+8010291c:	74 b6                	je     801028d4 <dirindex+0xde>
+    de = (struct dirent*)(bp->data + off % BSIZE);
+8010291e:	89 f2                	mov    %esi,%edx
+80102920:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+80102926:	03 57 60             	add    0x60(%edi),%edx
+    if(de->inum != 0)
+80102929:	66 83 3a 00          	cmpw   $0x0,(%edx)
+8010292d:	75 cf                	jne    801028fe <dirindex+0x108>
+    else if(off < dp->dirfree)
+8010292f:	3b b3 f8 00 00 00    	cmp    0xf8(%ebx),%esi
+80102935:	73 d3                	jae    8010290a <dirindex+0x114>
+      dp->dirfree = off;
+80102937:	89 b3 f8 00 00 00    	mov    %esi,0xf8(%ebx)
+8010293d:	eb cb                	jmp    8010290a <dirindex+0x114>
+  if(bp)
+8010293f:	85 ff                	test   %edi,%edi
+80102941:	0f 84 ee fe ff ff    	je     80102835 <dirindex+0x3f>
+    brelse(bp);
+80102947:	83 ec 0c             	sub    $0xc,%esp
+8010294a:	57                   	push   %edi
+8010294b:	e8 bb e0 ff ff       	call   80100a0b <brelse>
+80102950:	83 c4 10             	add    $0x10,%esp
+80102953:	e9 dd fe ff ff       	jmp    80102835 <dirindex+0x3f>
+
+80102958 <dcacheput>:
+{
+80102958:	55                   	push   %ebp
+80102959:	89 e5                	mov    %esp,%ebp
+8010295b:	57                   	push   %edi
+8010295c:	56                   	push   %esi
+8010295d:	53                   	push   %ebx
+8010295e:	83 ec 18             	sub    $0x18,%esp
+80102961:	89 c3                	mov    %eax,%ebx
+80102963:	89 d6                	mov    %edx,%esi
+80102965:	89 cf                	mov    %ecx,%edi
+  acquire(&dcache.lock);
+80102967:	68 80 c2 11 80       	push   $0x8011c280
+8010296c:	e8 71 5c 00 00       	call   801085e2 <acquire>
+  e = dcentry(dp, name);
+80102971:	89 f2                	mov    %esi,%edx
+80102973:	89 d8                	mov    %ebx,%eax
+80102975:	e8 09 f5 ff ff       	call   80101e83 <dcentry>
+  e->dev = dp->dev;
+8010297a:	8b 13                	mov    (%ebx),%edx
+8010297c:	89 10                	mov    %edx,(%eax)
+  e->dir = dp->inum;
+8010297e:	8b 53 04             	mov    0x4(%ebx),%edx
+80102981:	89 50 04             	mov    %edx,0x4(%eax)
+  e->inum = inum;
+80102984:	89 78 08             	mov    %edi,0x8(%eax)
+  strncpy(e->name, name, DIRSIZ);
+80102987:	83 c0 0c             	add    $0xc,%eax
+8010298a:	83 c4 0c             	add    $0xc,%esp
+8010298d:	6a 0e                	push   $0xe
+8010298f:	56                   	push   %esi
+80102990:	50                   	push   %eax
+80102991:	e8 1b 5e 00 00       	call   801087b1 <strncpy>
+  release(&dcache.lock);
+80102996:	c7 04 24 80 c2 11 80 	movl   $0x8011c280,(%esp)
+8010299d:	e8 a5 5c 00 00       	call   80108647 <release>
+}
+801029a2:	83 c4 10             	add    $0x10,%esp
+801029a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801029a8:	5b                   	pop    %ebx
+801029a9:	5e                   	pop    %esi
+801029aa:	5f                   	pop    %edi
+801029ab:	5d                   	pop    %ebp
+801029ac:	c3                   	ret
+
+801029ad <readsb>:
+{
+801029ad:	55                   	push   %ebp
+801029ae:	89 e5                	mov    %esp,%ebp
+801029b0:	53                   	push   %ebx
+801029b1:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, 1);
+801029b4:	6a 01                	push   $0x1
+801029b6:	ff 75 08             	push   0x8(%ebp)
+801029b9:	e8 7e df ff ff       	call   8010093c <bread>
+801029be:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+801029c0:	8b 40 60             	mov    0x60(%eax),%eax
+801029c3:	83 c4 0c             	add    $0xc,%esp
+801029c6:	6a 20                	push   $0x20
+801029c8:	50                   	push   %eax
+801029c9:	ff 75 0c             	push   0xc(%ebp)
+801029cc:	e8 35 5d 00 00       	call   80108706 <memmove>
+  brelse(bp);
+801029d1:	89 1c 24             	mov    %ebx,(%esp)
+801029d4:	e8 32 e0 ff ff       	call   80100a0b <brelse>
+}
+801029d9:	83 c4 10             	add    $0x10,%esp
+801029dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801029df:	c9                   	leave
+801029e0:	c3                   	ret
+
+801029e1 <iinit>:
+{
+801029e1:	55                   	push   %ebp
+801029e2:	89 e5                	mov    %esp,%ebp
+801029e4:	56                   	push   %esi
+801029e5:	53                   	push   %ebx
+  for(i = 0; i < NIBUCKET; i++)
+801029e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+801029eb:	eb 1c                	jmp    80102a09 <iinit+0x28>
+    initlock(&icache.bucket[i].lock, "icache.bucket");
+801029ed:	83 ec 08             	sub    $0x8,%esp
+801029f0:	68 65 be 10 80       	push   $0x8010be65
+801029f5:	6b c3 38             	imul   $0x38,%ebx,%eax
+801029f8:	05 80 88 11 80       	add    $0x80118880,%eax
+801029fd:	50                   	push   %eax
+801029fe:	e8 9b 5a 00 00       	call   8010849e <initlock>
+  for(i = 0; i < NIBUCKET; i++)
+80102a03:	83 c3 01             	add    $0x1,%ebx
+80102a06:	83 c4 10             	add    $0x10,%esp
+80102a09:	83 fb 1e             	cmp    $0x1e,%ebx
+80102a0c:	7e df                	jle    801029ed <iinit+0xc>
+  initlock(&icache.evictlock, "icache.evict");
+80102a0e:	83 ec 08             	sub    $0x8,%esp
+80102a11:	68 73 be 10 80       	push   $0x8010be73
+80102a16:	68 48 8f 11 80       	push   $0x80118f48
+80102a1b:	e8 7e 5a 00 00       	call   8010849e <initlock>
+  initlock(&icache.lrulock, "icache.lru");
+80102a20:	83 c4 08             	add    $0x8,%esp
+80102a23:	68 80 be 10 80       	push   $0x8010be80
+80102a28:	68 7c 8f 11 80       	push   $0x80118f7c
+80102a2d:	e8 6c 5a 00 00       	call   8010849e <initlock>
+  initlock(&dcache.lock, "dcache");
+80102a32:	83 c4 08             	add    $0x8,%esp
+80102a35:	68 8b be 10 80       	push   $0x8010be8b
+80102a3a:	68 80 c2 11 80       	push   $0x8011c280
+80102a3f:	e8 5a 5a 00 00       	call   8010849e <initlock>
+  icache.head.lprev = &icache.head;
+80102a44:	c7 05 c0 8f 11 80 b0 	movl   $0x80118fb0,0x80118fc0
+80102a4b:	8f 11 80 
+  icache.head.lnext = &icache.head;
+80102a4e:	c7 05 c4 8f 11 80 b0 	movl   $0x80118fb0,0x80118fc4
+80102a55:	8f 11 80 
+  for(i = 0; i < NINODE; i++) {
+80102a58:	83 c4 10             	add    $0x10,%esp
+80102a5b:	be 00 00 00 00       	mov    $0x0,%esi
+80102a60:	eb 30                	jmp    80102a92 <iinit+0xb1>
+    initsleeplock(&icache.inode[i].lock, "inode");
+80102a62:	83 ec 08             	sub    $0x8,%esp
+80102a65:	68 4f be 10 80       	push   $0x8010be4f
+80102a6a:	69 de fc 00 00 00    	imul   $0xfc,%esi,%ebx
+80102a70:	8d 83 c4 90 11 80    	lea    -0x7fee6f3c(%ebx),%eax
+80102a76:	50                   	push   %eax
+80102a77:	e8 3e 59 00 00       	call   801083ba <initsleeplock>
+    ilruadd(&icache.inode[i], 0);
+80102a7c:	8d 83 ac 90 11 80    	lea    -0x7fee6f54(%ebx),%eax
+80102a82:	ba 00 00 00 00       	mov    $0x0,%edx
+80102a87:	e8 99 f4 ff ff       	call   80101f25 <ilruadd>
+  for(i = 0; i < NINODE; i++) {
+80102a8c:	83 c6 01             	add    $0x1,%esi
+80102a8f:	83 c4 10             	add    $0x10,%esp
+80102a92:	83 fe 31             	cmp    $0x31,%esi
+80102a95:	7e cb                	jle    80102a62 <iinit+0x81>
+  readsb(dev, &sb);
+80102a97:	83 ec 08             	sub    $0x8,%esp
+80102a9a:	68 00 c2 11 80       	push   $0x8011c200
+80102a9f:	ff 75 08             	push   0x8(%ebp)
+80102aa2:	e8 06 ff ff ff       	call   801029ad <readsb>
+  if(sb.bsize != BSIZE)
+80102aa7:	83 c4 10             	add    $0x10,%esp
+80102aaa:	81 3d 1c c2 11 80 00 	cmpl   $0x1000,0x8011c21c
+80102ab1:	10 00 00 
+80102ab4:	75 3e                	jne    80102af4 <iinit+0x113>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80102ab6:	ff 35 18 c2 11 80    	push   0x8011c218
+80102abc:	ff 35 14 c2 11 80    	push   0x8011c214
+80102ac2:	ff 35 10 c2 11 80    	push   0x8011c210
+80102ac8:	ff 35 0c c2 11 80    	push   0x8011c20c
+80102ace:	ff 35 08 c2 11 80    	push   0x8011c208
+80102ad4:	ff 35 04 c2 11 80    	push   0x8011c204
+80102ada:	ff 35 00 c2 11 80    	push   0x8011c200
+80102ae0:	68 7c bf 10 80       	push   $0x8010bf7c
+80102ae5:	e8 cd e3 ff ff       	call   80100eb7 <cprintf>
+}
+80102aea:	83 c4 20             	add    $0x20,%esp
+80102aed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102af0:	5b                   	pop    %ebx
+80102af1:	5e                   	pop    %esi
+80102af2:	5d                   	pop    %ebp
+80102af3:	c3                   	ret
+    panic("iinit: block size");
+80102af4:	83 ec 0c             	sub    $0xc,%esp
+80102af7:	68 92 be 10 80       	push   $0x8010be92
+80102afc:	e8 f5 e0 ff ff       	call   80100bf6 <panic>
+
+80102b01 <iinit2>:
+{
+80102b01:	55                   	push   %ebp
+80102b02:	89 e5                	mov    %esp,%ebp
+80102b04:	57                   	push   %edi
+80102b05:	56                   	push   %esi
+80102b06:	53                   	push   %ebx
+80102b07:	83 ec 0c             	sub    $0xc,%esp
+80102b0a:	8b 75 08             	mov    0x8(%ebp),%esi
+  bsum.ngroup = (sb.size + BGROUP - 1) / BGROUP;
+80102b0d:	a1 00 c2 11 80       	mov    0x8011c200,%eax
+80102b12:	05 ff 00 00 00       	add    $0xff,%eax
+80102b17:	c1 e8 08             	shr    $0x8,%eax
+80102b1a:	a3 f4 de 11 80       	mov    %eax,0x8011def4
+  if(bsum.ngroup > NBGROUP)
+80102b1f:	83 f8 10             	cmp    $0x10,%eax
+80102b22:	7f 21                	jg     80102b45 <iinit2+0x44>
+  initlock(&bsum.lock, "bsum");
+80102b24:	83 ec 08             	sub    $0x8,%esp
+80102b27:	68 c0 be 10 80       	push   $0x8010bec0
+80102b2c:	68 c0 de 11 80       	push   $0x8011dec0
+80102b31:	e8 68 59 00 00       	call   8010849e <initlock>
+  for(b = 0; b < sb.size; b++){
+80102b36:	83 c4 10             	add    $0x10,%esp
+80102b39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  bp = 0;
+80102b3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  for(b = 0; b < sb.size; b++){
+80102b43:	eb 59                	jmp    80102b9e <iinit2+0x9d>
+    panic("iinit2: file system too big");
+80102b45:	83 ec 0c             	sub    $0xc,%esp
+80102b48:	68 a4 be 10 80       	push   $0x8010bea4
+80102b4d:	e8 a4 e0 ff ff       	call   80100bf6 <panic>
+      bp = bread(dev, BBLOCK(b, sb));
+80102b52:	89 d8                	mov    %ebx,%eax
+80102b54:	c1 e8 0f             	shr    $0xf,%eax
+80102b57:	83 ec 08             	sub    $0x8,%esp
+80102b5a:	03 05 18 c2 11 80    	add    0x8011c218,%eax
+80102b60:	50                   	push   %eax
+80102b61:	56                   	push   %esi
+80102b62:	e8 d5 dd ff ff       	call   8010093c <bread>
+80102b67:	89 c2                	mov    %eax,%edx
+80102b69:	83 c4 10             	add    $0x10,%esp
+    if((bp->data[(b % BPB)/8] & (1 << (b % 8))) == 0)
+80102b6c:	8b 42 60             	mov    0x60(%edx),%eax
+80102b6f:	c1 ef 03             	shr    $0x3,%edi
+80102b72:	0f b6 04 38          	movzbl (%eax,%edi,1),%eax
+80102b76:	89 d9                	mov    %ebx,%ecx
+80102b78:	83 e1 07             	and    $0x7,%ecx
+80102b7b:	d3 f8                	sar    %cl,%eax
+80102b7d:	a8 01                	test   $0x1,%al
+80102b7f:	75 1a                	jne    80102b9b <iinit2+0x9a>
+      bsum.nfree[b / BGROUP]++;
+80102b81:	89 d8                	mov    %ebx,%eax
+80102b83:	c1 e8 08             	shr    $0x8,%eax
+80102b86:	b9 c0 de 11 80       	mov    $0x8011dec0,%ecx
+80102b8b:	83 c0 18             	add    $0x18,%eax
+80102b8e:	0f b7 7c 41 08       	movzwl 0x8(%ecx,%eax,2),%edi
+80102b93:	83 c7 01             	add    $0x1,%edi
+80102b96:	66 89 7c 41 08       	mov    %di,0x8(%ecx,%eax,2)
+  for(b = 0; b < sb.size; b++){
+80102b9b:	83 c3 01             	add    $0x1,%ebx
+80102b9e:	3b 1d 00 c2 11 80    	cmp    0x8011c200,%ebx
+80102ba4:	73 1c                	jae    80102bc2 <iinit2+0xc1>
+    if(b % BPB == 0){
+80102ba6:	89 df                	mov    %ebx,%edi
+80102ba8:	81 e7 ff 7f 00 00    	and    $0x7fff,%edi
+80102bae:	75 bc                	jne    80102b6c <iinit2+0x6b>
+      if(bp)
+80102bb0:	85 d2                	test   %edx,%edx
+80102bb2:	74 9e                	je     80102b52 <iinit2+0x51>
+        brelse(bp);
+80102bb4:	83 ec 0c             	sub    $0xc,%esp
+80102bb7:	52                   	push   %edx
+80102bb8:	e8 4e de ff ff       	call   80100a0b <brelse>
+80102bbd:	83 c4 10             	add    $0x10,%esp
+80102bc0:	eb 90                	jmp    80102b52 <iinit2+0x51>
+  brelse(bp);
+80102bc2:	83 ec 0c             	sub    $0xc,%esp
+80102bc5:	52                   	push   %edx
+80102bc6:	e8 40 de ff ff       	call   80100a0b <brelse>
+  if(sb.ninodes > NINODES)
+80102bcb:	83 c4 10             	add    $0x10,%esp
+80102bce:	81 3d 08 c2 11 80 c8 	cmpl   $0xc8,0x8011c208
+80102bd5:	00 00 00 
+80102bd8:	77 2b                	ja     80102c05 <iinit2+0x104>
+  initlock(&ifree.lock, "ifree");
+80102bda:	83 ec 08             	sub    $0x8,%esp
+80102bdd:	68 dd be 10 80       	push   $0x8010bedd
+80102be2:	68 20 c2 11 80       	push   $0x8011c220
+80102be7:	e8 b2 58 00 00       	call   8010849e <initlock>
+  ifree.inext = 1;
+80102bec:	c7 05 54 c2 11 80 01 	movl   $0x1,0x8011c254
+80102bf3:	00 00 00 
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102bf6:	83 c4 10             	add    $0x10,%esp
+80102bf9:	bb 01 00 00 00       	mov    $0x1,%ebx
+  bp = 0;
+80102bfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102c03:	eb 38                	jmp    80102c3d <iinit2+0x13c>
+    panic("iinit2: too many inodes");
+80102c05:	83 ec 0c             	sub    $0xc,%esp
+80102c08:	68 c5 be 10 80       	push   $0x8010bec5
+80102c0d:	e8 e4 df ff ff       	call   80100bf6 <panic>
+        brelse(bp);
+80102c12:	83 ec 0c             	sub    $0xc,%esp
+80102c15:	52                   	push   %edx
+80102c16:	e8 f0 dd ff ff       	call   80100a0b <brelse>
+80102c1b:	83 c4 10             	add    $0x10,%esp
+      bp = bread(dev, IBLOCK(inum, sb));
+80102c1e:	89 d8                	mov    %ebx,%eax
+80102c20:	c1 e8 06             	shr    $0x6,%eax
+80102c23:	83 ec 08             	sub    $0x8,%esp
+80102c26:	03 05 14 c2 11 80    	add    0x8011c214,%eax
+80102c2c:	50                   	push   %eax
+80102c2d:	56                   	push   %esi
+80102c2e:	e8 09 dd ff ff       	call   8010093c <bread>
+80102c33:	89 c2                	mov    %eax,%edx
+80102c35:	83 c4 10             	add    $0x10,%esp
+80102c38:	eb 14                	jmp    80102c4e <iinit2+0x14d>
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102c3a:	83 c3 01             	add    $0x1,%ebx
+80102c3d:	3b 1d 08 c2 11 80    	cmp    0x8011c208,%ebx
+80102c43:	73 31                	jae    80102c76 <iinit2+0x175>
+    if(bp == 0 || inum % IPB == 0){
+80102c45:	85 d2                	test   %edx,%edx
+80102c47:	74 d5                	je     80102c1e <iinit2+0x11d>
+80102c49:	f6 c3 3f             	test   $0x3f,%bl
+80102c4c:	74 c4                	je     80102c12 <iinit2+0x111>
+    dip = (struct dinode*)bp->data + inum%IPB;
+80102c4e:	89 d8                	mov    %ebx,%eax
+80102c50:	83 e0 3f             	and    $0x3f,%eax
+80102c53:	c1 e0 06             	shl    $0x6,%eax
+80102c56:	03 42 60             	add    0x60(%edx),%eax
+    if(dip->type == 0)
+80102c59:	66 83 38 00          	cmpw   $0x0,(%eax)
+80102c5d:	75 db                	jne    80102c3a <iinit2+0x139>
+      ifree.map[inum/32] |= 1U << (inum%32);
+80102c5f:	89 df                	mov    %ebx,%edi
+80102c61:	c1 ef 05             	shr    $0x5,%edi
+80102c64:	b8 01 00 00 00       	mov    $0x1,%eax
+80102c69:	89 d9                	mov    %ebx,%ecx
+80102c6b:	d3 e0                	shl    %cl,%eax
+80102c6d:	09 04 bd 58 c2 11 80 	or     %eax,-0x7fee3da8(,%edi,4)
+80102c74:	eb c4                	jmp    80102c3a <iinit2+0x139>
+  if(bp)
+80102c76:	85 d2                	test   %edx,%edx
+80102c78:	74 0c                	je     80102c86 <iinit2+0x185>
+    brelse(bp);
+80102c7a:	83 ec 0c             	sub    $0xc,%esp
+80102c7d:	52                   	push   %edx
+80102c7e:	e8 88 dd ff ff       	call   80100a0b <brelse>
+80102c83:	83 c4 10             	add    $0x10,%esp
+}
+80102c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102c89:	5b                   	pop    %ebx
+80102c8a:	5e                   	pop    %esi
+80102c8b:	5f                   	pop    %edi
+80102c8c:	5d                   	pop    %ebp
+80102c8d:	c3                   	ret
+
+80102c8e <ialloc>:
+{
+80102c8e:	55                   	push   %ebp
+80102c8f:	89 e5                	mov    %esp,%ebp
+80102c91:	57                   	push   %edi
+80102c92:	56                   	push   %esi
+80102c93:	53                   	push   %ebx
+80102c94:	83 ec 28             	sub    $0x28,%esp
+80102c97:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102c9a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquire(&ifree.lock);
+80102c9d:	68 20 c2 11 80       	push   $0x8011c220
+80102ca2:	e8 3b 59 00 00       	call   801085e2 <acquire>
+  for(inum = ifree.inext - ifree.inext%32; inum < sb.ninodes; inum += 32)
+80102ca7:	a1 54 c2 11 80       	mov    0x8011c254,%eax
+80102cac:	83 e0 e0             	and    $0xffffffe0,%eax
+80102caf:	83 c4 10             	add    $0x10,%esp
+  uint inum, w = 0;
+80102cb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(inum = ifree.inext - ifree.inext%32; inum < sb.ninodes; inum += 32)
+80102cb7:	eb 03                	jmp    80102cbc <ialloc+0x2e>
+80102cb9:	83 c0 20             	add    $0x20,%eax
+80102cbc:	8b 15 08 c2 11 80    	mov    0x8011c208,%edx
+80102cc2:	39 d0                	cmp    %edx,%eax
+80102cc4:	73 10                	jae    80102cd6 <ialloc+0x48>
+    if((w = ifree.map[inum/32]) != 0)
+80102cc6:	89 c1                	mov    %eax,%ecx
+80102cc8:	c1 e9 05             	shr    $0x5,%ecx
+80102ccb:	8b 1c 8d 58 c2 11 80 	mov    -0x7fee3da8(,%ecx,4),%ebx
+80102cd2:	85 db                	test   %ebx,%ebx
+80102cd4:	74 e3                	je     80102cb9 <ialloc+0x2b>
+  if(inum >= sb.ninodes)
+80102cd6:	39 d0                	cmp    %edx,%eax
+80102cd8:	0f 83 95 00 00 00    	jae    80102d73 <ialloc+0xe5>
+  inum += __builtin_ctz(w);
+80102cde:	f3 0f bc db          	tzcnt  %ebx,%ebx
+80102ce2:	01 c3                	add    %eax,%ebx
+  ifree.map[inum/32] &= ~(1U << (inum%32));
+80102ce4:	89 da                	mov    %ebx,%edx
+80102ce6:	c1 ea 05             	shr    $0x5,%edx
+80102ce9:	b8 01 00 00 00       	mov    $0x1,%eax
+80102cee:	89 d9                	mov    %ebx,%ecx
+80102cf0:	d3 e0                	shl    %cl,%eax
+80102cf2:	f7 d0                	not    %eax
+80102cf4:	21 04 95 58 c2 11 80 	and    %eax,-0x7fee3da8(,%edx,4)
+  ifree.inext = inum + 1;
+80102cfb:	8d 43 01             	lea    0x1(%ebx),%eax
+80102cfe:	a3 54 c2 11 80       	mov    %eax,0x8011c254
+  release(&ifree.lock);
+80102d03:	83 ec 0c             	sub    $0xc,%esp
+80102d06:	68 20 c2 11 80       	push   $0x8011c220
+80102d0b:	e8 37 59 00 00       	call   80108647 <release>
+  bp = bread(dev, IBLOCK(inum, sb));
+80102d10:	89 d8                	mov    %ebx,%eax
+80102d12:	c1 e8 06             	shr    $0x6,%eax
+80102d15:	83 c4 08             	add    $0x8,%esp
+80102d18:	03 05 14 c2 11 80    	add    0x8011c214,%eax
+80102d1e:	50                   	push   %eax
+80102d1f:	ff 75 08             	push   0x8(%ebp)
+80102d22:	e8 15 dc ff ff       	call   8010093c <bread>
+80102d27:	89 c7                	mov    %eax,%edi
+  dip = (struct dinode*)bp->data + inum%IPB;
+80102d29:	89 de                	mov    %ebx,%esi
+80102d2b:	83 e6 3f             	and    $0x3f,%esi
+80102d2e:	c1 e6 06             	shl    $0x6,%esi
+80102d31:	03 70 60             	add    0x60(%eax),%esi
+  if(dip->type != 0)
+80102d34:	83 c4 10             	add    $0x10,%esp
+80102d37:	66 83 3e 00          	cmpw   $0x0,(%esi)
+80102d3b:	75 43                	jne    80102d80 <ialloc+0xf2>
+  memset(dip, 0, sizeof(*dip));
+80102d3d:	83 ec 04             	sub    $0x4,%esp
+80102d40:	6a 40                	push   $0x40
+80102d42:	6a 00                	push   $0x0
+80102d44:	56                   	push   %esi
+80102d45:	e8 44 59 00 00       	call   8010868e <memset>
+  dip->type = type;
+80102d4a:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+80102d4e:	66 89 06             	mov    %ax,(%esi)
+  log_write(bp);   // mark it allocated on the disk
+80102d51:	89 3c 24             	mov    %edi,(%esp)
+80102d54:	e8 67 26 00 00       	call   801053c0 <log_write>
+  brelse(bp);
+80102d59:	89 3c 24             	mov    %edi,(%esp)
+80102d5c:	e8 aa dc ff ff       	call   80100a0b <brelse>
+  return iget(dev, inum);
+80102d61:	89 da                	mov    %ebx,%edx
+80102d63:	8b 45 08             	mov    0x8(%ebp),%eax
+80102d66:	e8 1d f9 ff ff       	call   80102688 <iget>
+}
+80102d6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102d6e:	5b                   	pop    %ebx
+80102d6f:	5e                   	pop    %esi
+80102d70:	5f                   	pop    %edi
+80102d71:	5d                   	pop    %ebp
+80102d72:	c3                   	ret
+    panic("ialloc: no inodes");
+80102d73:	83 ec 0c             	sub    $0xc,%esp
+80102d76:	68 e3 be 10 80       	push   $0x8010bee3
+80102d7b:	e8 76 de ff ff       	call   80100bf6 <panic>
+    panic("ialloc: inode in use");
+80102d80:	83 ec 0c             	sub    $0xc,%esp
+80102d83:	68 f5 be 10 80       	push   $0x8010bef5
+80102d88:	e8 69 de ff ff       	call   80100bf6 <panic>
+
+80102d8d <iupdate>:
+{
+80102d8d:	55                   	push   %ebp
+80102d8e:	89 e5                	mov    %esp,%ebp
+80102d90:	56                   	push   %esi
+80102d91:	53                   	push   %ebx
+80102d92:	8b 75 08             	mov    0x8(%ebp),%esi
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102d95:	8b 46 04             	mov    0x4(%esi),%eax
+80102d98:	c1 e8 06             	shr    $0x6,%eax
+80102d9b:	83 ec 08             	sub    $0x8,%esp
+80102d9e:	03 05 14 c2 11 80    	add    0x8011c214,%eax
+80102da4:	50                   	push   %eax
+80102da5:	ff 36                	push   (%esi)
+80102da7:	e8 90 db ff ff       	call   8010093c <bread>
+80102dac:	89 c3                	mov    %eax,%ebx
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+80102dae:	8b 46 04             	mov    0x4(%esi),%eax
+80102db1:	83 e0 3f             	and    $0x3f,%eax
+80102db4:	c1 e0 06             	shl    $0x6,%eax
+80102db7:	03 43 60             	add    0x60(%ebx),%eax
+  dip->type = ip->type;
+80102dba:	0f b7 56 5c          	movzwl 0x5c(%esi),%edx
+80102dbe:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+80102dc1:	0f b7 56 5e          	movzwl 0x5e(%esi),%edx
+80102dc5:	66 89 50 02          	mov    %dx,0x2(%eax)
+  dip->minor = ip->minor;
+80102dc9:	0f b7 56 60          	movzwl 0x60(%esi),%edx
+80102dcd:	66 89 50 04          	mov    %dx,0x4(%eax)
+  dip->nlink = ip->nlink;
+80102dd1:	0f b7 56 62          	movzwl 0x62(%esi),%edx
+80102dd5:	66 89 50 06          	mov    %dx,0x6(%eax)
+  dip->size = ip->size;
+80102dd9:	8b 56 64             	mov    0x64(%esi),%edx
+80102ddc:	89 50 08             	mov    %edx,0x8(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102ddf:	8d 56 68             	lea    0x68(%esi),%edx
+80102de2:	83 c0 0c             	add    $0xc,%eax
+80102de5:	83 c4 0c             	add    $0xc,%esp
+80102de8:	6a 34                	push   $0x34
+80102dea:	52                   	push   %edx
+80102deb:	50                   	push   %eax
+80102dec:	e8 15 59 00 00       	call   80108706 <memmove>
+  log_write(bp);
+80102df1:	89 1c 24             	mov    %ebx,(%esp)
+80102df4:	e8 c7 25 00 00       	call   801053c0 <log_write>
+  brelse(bp);
+80102df9:	89 1c 24             	mov    %ebx,(%esp)
+80102dfc:	e8 0a dc ff ff       	call   80100a0b <brelse>
+}
+80102e01:	83 c4 10             	add    $0x10,%esp
+80102e04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102e07:	5b                   	pop    %ebx
+80102e08:	5e                   	pop    %esi
+80102e09:	5d                   	pop    %ebp
+80102e0a:	c3                   	ret
+
+80102e0b <itrunc>:
+{
+80102e0b:	55                   	push   %ebp
+80102e0c:	89 e5                	mov    %esp,%ebp
+80102e0e:	57                   	push   %edi
+80102e0f:	56                   	push   %esi
+80102e10:	53                   	push   %ebx
+80102e11:	83 ec 1c             	sub    $0x1c,%esp
+80102e14:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NDIRECT; i++){
+80102e16:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102e1b:	eb 03                	jmp    80102e20 <itrunc+0x15>
+80102e1d:	83 c3 01             	add    $0x1,%ebx
+80102e20:	83 fb 0a             	cmp    $0xa,%ebx
+80102e23:	7f 19                	jg     80102e3e <itrunc+0x33>
+    if(ip->addrs[i]){
+80102e25:	8b 54 9e 68          	mov    0x68(%esi,%ebx,4),%edx
+80102e29:	85 d2                	test   %edx,%edx
+80102e2b:	74 f0                	je     80102e1d <itrunc+0x12>
+      bfree(ip->dev, ip->addrs[i]);
+80102e2d:	8b 06                	mov    (%esi),%eax
+80102e2f:	e8 53 f2 ff ff       	call   80102087 <bfree>
+      ip->addrs[i] = 0;
+80102e34:	c7 44 9e 68 00 00 00 	movl   $0x0,0x68(%esi,%ebx,4)
+80102e3b:	00 
+80102e3c:	eb df                	jmp    80102e1d <itrunc+0x12>
+  if(ip->addrs[NDIRECT]){
+80102e3e:	8b 96 94 00 00 00    	mov    0x94(%esi),%edx
+80102e44:	85 d2                	test   %edx,%edx
+80102e46:	75 2f                	jne    80102e77 <itrunc+0x6c>
+  if(ip->addrs[NDIRECT+1]){
+80102e48:	8b 86 98 00 00 00    	mov    0x98(%esi),%eax
+80102e4e:	85 c0                	test   %eax,%eax
+80102e50:	75 38                	jne    80102e8a <itrunc+0x7f>
+  ip->nmap = 0;
+80102e52:	c7 86 a0 00 00 00 00 	movl   $0x0,0xa0(%esi)
+80102e59:	00 00 00 
+  ip->size = 0;
+80102e5c:	c7 46 64 00 00 00 00 	movl   $0x0,0x64(%esi)
+  iupdate(ip);
+80102e63:	83 ec 0c             	sub    $0xc,%esp
+80102e66:	56                   	push   %esi
+80102e67:	e8 21 ff ff ff       	call   80102d8d <iupdate>
+}
+80102e6c:	83 c4 10             	add    $0x10,%esp
+80102e6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102e72:	5b                   	pop    %ebx
+80102e73:	5e                   	pop    %esi
+80102e74:	5f                   	pop    %edi
+80102e75:	5d                   	pop    %ebp
+80102e76:	c3                   	ret
+    bfreeind(ip->dev, ip->addrs[NDIRECT]);
+80102e77:	8b 06                	mov    (%esi),%eax
+80102e79:	e8 ac f2 ff ff       	call   8010212a <bfreeind>
+    ip->addrs[NDIRECT] = 0;
+80102e7e:	c7 86 94 00 00 00 00 	movl   $0x0,0x94(%esi)
+80102e85:	00 00 00 
+80102e88:	eb be                	jmp    80102e48 <itrunc+0x3d>
+    bp = bread(ip->dev, ip->addrs[NDIRECT+1]);
+80102e8a:	83 ec 08             	sub    $0x8,%esp
+80102e8d:	50                   	push   %eax
+80102e8e:	ff 36                	push   (%esi)
+80102e90:	e8 a7 da ff ff       	call   8010093c <bread>
+80102e95:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    a = (uint*)bp->data;
+80102e98:	8b 78 60             	mov    0x60(%eax),%edi
+    for(j = 0; j < NINDIRECT; j++){
+80102e9b:	83 c4 10             	add    $0x10,%esp
+80102e9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102ea3:	eb 03                	jmp    80102ea8 <itrunc+0x9d>
+80102ea5:	83 c3 01             	add    $0x1,%ebx
+80102ea8:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+80102eae:	77 10                	ja     80102ec0 <itrunc+0xb5>
+      if(a[j])
+80102eb0:	8b 14 9f             	mov    (%edi,%ebx,4),%edx
+80102eb3:	85 d2                	test   %edx,%edx
+80102eb5:	74 ee                	je     80102ea5 <itrunc+0x9a>
+        bfreeind(ip->dev, a[j]);
+80102eb7:	8b 06                	mov    (%esi),%eax
+80102eb9:	e8 6c f2 ff ff       	call   8010212a <bfreeind>
+80102ebe:	eb e5                	jmp    80102ea5 <itrunc+0x9a>
+    brelse(bp);
+80102ec0:	83 ec 0c             	sub    $0xc,%esp
+80102ec3:	ff 75 e4             	push   -0x1c(%ebp)
+80102ec6:	e8 40 db ff ff       	call   80100a0b <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT+1]);
+80102ecb:	8b 06                	mov    (%esi),%eax
+80102ecd:	8b 96 98 00 00 00    	mov    0x98(%esi),%edx
+80102ed3:	e8 af f1 ff ff       	call   80102087 <bfree>
+    ip->addrs[NDIRECT+1] = 0;
+80102ed8:	c7 86 98 00 00 00 00 	movl   $0x0,0x98(%esi)
+80102edf:	00 00 00 
+80102ee2:	83 c4 10             	add    $0x10,%esp
+80102ee5:	e9 68 ff ff ff       	jmp    80102e52 <itrunc+0x47>
+
+80102eea <idup>:
+{
+80102eea:	55                   	push   %ebp
+80102eeb:	89 e5                	mov    %esp,%ebp
+80102eed:	56                   	push   %esi
+80102eee:	53                   	push   %ebx
+80102eef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bk = ihash(ip->dev, ip->inum);
+80102ef2:	8b 53 04             	mov    0x4(%ebx),%edx
+80102ef5:	8b 03                	mov    (%ebx),%eax
+80102ef7:	e8 95 ee ff ff       	call   80101d91 <ihash>
+80102efc:	89 c6                	mov    %eax,%esi
+  acquire(&bk->lock);
+80102efe:	83 ec 0c             	sub    $0xc,%esp
+80102f01:	50                   	push   %eax
+80102f02:	e8 db 56 00 00       	call   801085e2 <acquire>
+  ip->ref++;
+80102f07:	8b 43 08             	mov    0x8(%ebx),%eax
+80102f0a:	83 c0 01             	add    $0x1,%eax
+80102f0d:	89 43 08             	mov    %eax,0x8(%ebx)
+  release(&bk->lock);
+80102f10:	89 34 24             	mov    %esi,(%esp)
+80102f13:	e8 2f 57 00 00       	call   80108647 <release>
+}
+80102f18:	89 d8                	mov    %ebx,%eax
+80102f1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102f1d:	5b                   	pop    %ebx
+80102f1e:	5e                   	pop    %esi
+80102f1f:	5d                   	pop    %ebp
+80102f20:	c3                   	ret
+
+80102f21 <ilock>:
+{
+80102f21:	55                   	push   %ebp
+80102f22:	89 e5                	mov    %esp,%ebp
+80102f24:	56                   	push   %esi
+80102f25:	53                   	push   %ebx
+80102f26:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102f29:	85 db                	test   %ebx,%ebx
+80102f2b:	74 22                	je     80102f4f <ilock+0x2e>
+80102f2d:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+80102f31:	7e 1c                	jle    80102f4f <ilock+0x2e>
+  acquiresleep(&ip->lock);
+80102f33:	83 ec 0c             	sub    $0xc,%esp
+80102f36:	8d 43 18             	lea    0x18(%ebx),%eax
+80102f39:	50                   	push   %eax
+80102f3a:	e8 ae 54 00 00       	call   801083ed <acquiresleep>
+  if(ip->valid == 0){
+80102f3f:	83 c4 10             	add    $0x10,%esp
+80102f42:	83 7b 58 00          	cmpl   $0x0,0x58(%ebx)
+80102f46:	74 14                	je     80102f5c <ilock+0x3b>
+}
+80102f48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102f4b:	5b                   	pop    %ebx
+80102f4c:	5e                   	pop    %esi
+80102f4d:	5d                   	pop    %ebp
+80102f4e:	c3                   	ret
+    panic("ilock");
+80102f4f:	83 ec 0c             	sub    $0xc,%esp
+80102f52:	68 0a bf 10 80       	push   $0x8010bf0a
+80102f57:	e8 9a dc ff ff       	call   80100bf6 <panic>
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102f5c:	8b 43 04             	mov    0x4(%ebx),%eax
+80102f5f:	c1 e8 06             	shr    $0x6,%eax
+80102f62:	83 ec 08             	sub    $0x8,%esp
+80102f65:	03 05 14 c2 11 80    	add    0x8011c214,%eax
+80102f6b:	50                   	push   %eax
+80102f6c:	ff 33                	push   (%ebx)
+80102f6e:	e8 c9 d9 ff ff       	call   8010093c <bread>
+80102f73:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+80102f75:	8b 43 04             	mov    0x4(%ebx),%eax
+80102f78:	83 e0 3f             	and    $0x3f,%eax
+80102f7b:	c1 e0 06             	shl    $0x6,%eax
+80102f7e:	03 46 60             	add    0x60(%esi),%eax
+    ip->type = dip->type;
+80102f81:	0f b7 10             	movzwl (%eax),%edx
+80102f84:	66 89 53 5c          	mov    %dx,0x5c(%ebx)
+    ip->major = dip->major;
+80102f88:	0f b7 50 02          	movzwl 0x2(%eax),%edx
+80102f8c:	66 89 53 5e          	mov    %dx,0x5e(%ebx)
+    ip->minor = dip->minor;
+80102f90:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+80102f94:	66 89 53 60          	mov    %dx,0x60(%ebx)
+    ip->nlink = dip->nlink;
+80102f98:	0f b7 50 06          	movzwl 0x6(%eax),%edx
+80102f9c:	66 89 53 62          	mov    %dx,0x62(%ebx)
+    ip->size = dip->size;
+80102fa0:	8b 50 08             	mov    0x8(%eax),%edx
+80102fa3:	89 53 64             	mov    %edx,0x64(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102fa6:	83 c0 0c             	add    $0xc,%eax
+80102fa9:	8d 53 68             	lea    0x68(%ebx),%edx
+80102fac:	83 c4 0c             	add    $0xc,%esp
+80102faf:	6a 34                	push   $0x34
+80102fb1:	50                   	push   %eax
+80102fb2:	52                   	push   %edx
+80102fb3:	e8 4e 57 00 00       	call   80108706 <memmove>
+    brelse(bp);
+80102fb8:	89 34 24             	mov    %esi,(%esp)
+80102fbb:	e8 4b da ff ff       	call   80100a0b <brelse>
+    ip->nmap = 0;
+80102fc0:	c7 83 a0 00 00 00 00 	movl   $0x0,0xa0(%ebx)
+80102fc7:	00 00 00 
+    ip->lastblk = 0;
+80102fca:	c7 83 e4 00 00 00 00 	movl   $0x0,0xe4(%ebx)
+80102fd1:	00 00 00 
+    ip->valid = 1;
+80102fd4:	c7 43 58 01 00 00 00 	movl   $0x1,0x58(%ebx)
+    if(ip->type == 0)
+80102fdb:	83 c4 10             	add    $0x10,%esp
+80102fde:	66 83 7b 5c 00       	cmpw   $0x0,0x5c(%ebx)
+80102fe3:	0f 85 5f ff ff ff    	jne    80102f48 <ilock+0x27>
+      panic("ilock: no type");
+80102fe9:	83 ec 0c             	sub    $0xc,%esp
+80102fec:	68 10 bf 10 80       	push   $0x8010bf10
+80102ff1:	e8 00 dc ff ff       	call   80100bf6 <panic>
+
+80102ff6 <iunlock>:
+{
+80102ff6:	55                   	push   %ebp
+80102ff7:	89 e5                	mov    %esp,%ebp
+80102ff9:	56                   	push   %esi
+80102ffa:	53                   	push   %ebx
+80102ffb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102ffe:	85 db                	test   %ebx,%ebx
+80103000:	74 2c                	je     8010302e <iunlock+0x38>
+80103002:	8d 73 18             	lea    0x18(%ebx),%esi
+80103005:	83 ec 0c             	sub    $0xc,%esp
+80103008:	56                   	push   %esi
+80103009:	e8 69 54 00 00       	call   80108477 <holdingsleep>
+8010300e:	83 c4 10             	add    $0x10,%esp
+80103011:	85 c0                	test   %eax,%eax
+80103013:	74 19                	je     8010302e <iunlock+0x38>
+80103015:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+80103019:	7e 13                	jle    8010302e <iunlock+0x38>
+  releasesleep(&ip->lock);
+8010301b:	83 ec 0c             	sub    $0xc,%esp
+8010301e:	56                   	push   %esi
+8010301f:	e8 18 54 00 00       	call   8010843c <releasesleep>
+}
+80103024:	83 c4 10             	add    $0x10,%esp
+80103027:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010302a:	5b                   	pop    %ebx
+8010302b:	5e                   	pop    %esi
+8010302c:	5d                   	pop    %ebp
+8010302d:	c3                   	ret
+    panic("iunlock");
+8010302e:	83 ec 0c             	sub    $0xc,%esp
+80103031:	68 1f bf 10 80       	push   $0x8010bf1f
+80103036:	e8 bb db ff ff       	call   80100bf6 <panic>
+
+8010303b <iexecref>:
+{
+8010303b:	55                   	push   %ebp
+8010303c:	89 e5                	mov    %esp,%ebp
+8010303e:	53                   	push   %ebx
+8010303f:	83 ec 10             	sub    $0x10,%esp
+80103042:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  ilock(ip);
+80103045:	53                   	push   %ebx
+80103046:	e8 d6 fe ff ff       	call   80102f21 <ilock>
+  ip->nexec += n;
+8010304b:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010304e:	03 83 e8 00 00 00    	add    0xe8(%ebx),%eax
+80103054:	89 83 e8 00 00 00    	mov    %eax,0xe8(%ebx)
+  if(ip->nexec < 0)
+8010305a:	83 c4 10             	add    $0x10,%esp
+8010305d:	85 c0                	test   %eax,%eax
+8010305f:	78 11                	js     80103072 <iexecref+0x37>
+  iunlock(ip);
+80103061:	83 ec 0c             	sub    $0xc,%esp
+80103064:	53                   	push   %ebx
+80103065:	e8 8c ff ff ff       	call   80102ff6 <iunlock>
+}
+8010306a:	83 c4 10             	add    $0x10,%esp
+8010306d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103070:	c9                   	leave
+80103071:	c3                   	ret
+    panic("iexecref");
+80103072:	83 ec 0c             	sub    $0xc,%esp
+80103075:	68 27 bf 10 80       	push   $0x8010bf27
+8010307a:	e8 77 db ff ff       	call   80100bf6 <panic>
+
+8010307f <iput>:
+{
+8010307f:	55                   	push   %ebp
+80103080:	89 e5                	mov    %esp,%ebp
+80103082:	57                   	push   %edi
+80103083:	56                   	push   %esi
+80103084:	53                   	push   %ebx
+80103085:	83 ec 1c             	sub    $0x1c,%esp
+80103088:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct ibucket *bk = ihash(ip->dev, ip->inum);
+8010308b:	8b 53 04             	mov    0x4(%ebx),%edx
+8010308e:	8b 03                	mov    (%ebx),%eax
+80103090:	e8 fc ec ff ff       	call   80101d91 <ihash>
+80103095:	89 c6                	mov    %eax,%esi
+  acquiresleep(&ip->lock);
+80103097:	8d 7b 18             	lea    0x18(%ebx),%edi
+8010309a:	83 ec 0c             	sub    $0xc,%esp
+8010309d:	57                   	push   %edi
+8010309e:	e8 4a 53 00 00       	call   801083ed <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+801030a3:	83 c4 10             	add    $0x10,%esp
+801030a6:	83 7b 58 00          	cmpl   $0x0,0x58(%ebx)
+801030aa:	74 07                	je     801030b3 <iput+0x34>
+801030ac:	66 83 7b 62 00       	cmpw   $0x0,0x62(%ebx)
+801030b1:	74 35                	je     801030e8 <iput+0x69>
+  releasesleep(&ip->lock);
+801030b3:	83 ec 0c             	sub    $0xc,%esp
+801030b6:	57                   	push   %edi
+801030b7:	e8 80 53 00 00       	call   8010843c <releasesleep>
+  acquire(&bk->lock);
+801030bc:	89 34 24             	mov    %esi,(%esp)
+801030bf:	e8 1e 55 00 00       	call   801085e2 <acquire>
+  if(--ip->ref == 0)
+801030c4:	8b 43 08             	mov    0x8(%ebx),%eax
+801030c7:	83 e8 01             	sub    $0x1,%eax
+801030ca:	89 43 08             	mov    %eax,0x8(%ebx)
+801030cd:	83 c4 10             	add    $0x10,%esp
+801030d0:	85 c0                	test   %eax,%eax
+801030d2:	74 72                	je     80103146 <iput+0xc7>
+  release(&bk->lock);
+801030d4:	83 ec 0c             	sub    $0xc,%esp
+801030d7:	56                   	push   %esi
+801030d8:	e8 6a 55 00 00       	call   80108647 <release>
+}
+801030dd:	83 c4 10             	add    $0x10,%esp
+801030e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801030e3:	5b                   	pop    %ebx
+801030e4:	5e                   	pop    %esi
+801030e5:	5f                   	pop    %edi
+801030e6:	5d                   	pop    %ebp
+801030e7:	c3                   	ret
+    acquire(&bk->lock);
+801030e8:	83 ec 0c             	sub    $0xc,%esp
+801030eb:	56                   	push   %esi
+801030ec:	e8 f1 54 00 00       	call   801085e2 <acquire>
+    int r = ip->ref;
+801030f1:	8b 43 08             	mov    0x8(%ebx),%eax
+801030f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    release(&bk->lock);
+801030f7:	89 34 24             	mov    %esi,(%esp)
+801030fa:	e8 48 55 00 00       	call   80108647 <release>
+    if(r == 1){
+801030ff:	83 c4 10             	add    $0x10,%esp
+80103102:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+80103106:	75 ab                	jne    801030b3 <iput+0x34>
+      itrunc(ip);
+80103108:	89 d8                	mov    %ebx,%eax
+8010310a:	e8 fc fc ff ff       	call   80102e0b <itrunc>
+      ip->type = 0;
+8010310f:	66 c7 43 5c 00 00    	movw   $0x0,0x5c(%ebx)
+      iupdate(ip);
+80103115:	83 ec 0c             	sub    $0xc,%esp
+80103118:	53                   	push   %ebx
+80103119:	e8 6f fc ff ff       	call   80102d8d <iupdate>
+      ip->valid = 0;
+8010311e:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+      dirindexfree(ip);
+80103125:	89 d8                	mov    %ebx,%eax
+80103127:	e8 f8 f4 ff ff       	call   80102624 <dirindexfree>
+      dcachepurge(ip->dev, ip->inum);
+8010312c:	8b 53 04             	mov    0x4(%ebx),%edx
+8010312f:	8b 03                	mov    (%ebx),%eax
+80103131:	e8 b0 ee ff ff       	call   80101fe6 <dcachepurge>
+      ifreemark(ip->inum);
+80103136:	8b 43 04             	mov    0x4(%ebx),%eax
+80103139:	e8 fb ee ff ff       	call   80102039 <ifreemark>
+8010313e:	83 c4 10             	add    $0x10,%esp
+80103141:	e9 6d ff ff ff       	jmp    801030b3 <iput+0x34>
+    ilruadd(ip, !ip->valid);
+80103146:	83 7b 58 00          	cmpl   $0x0,0x58(%ebx)
+8010314a:	0f 94 c2             	sete   %dl
+8010314d:	0f b6 d2             	movzbl %dl,%edx
+80103150:	89 d8                	mov    %ebx,%eax
+80103152:	e8 ce ed ff ff       	call   80101f25 <ilruadd>
+80103157:	e9 78 ff ff ff       	jmp    801030d4 <iput+0x55>
+
+8010315c <iunlockput>:
+{
+8010315c:	55                   	push   %ebp
+8010315d:	89 e5                	mov    %esp,%ebp
+8010315f:	53                   	push   %ebx
+80103160:	83 ec 10             	sub    $0x10,%esp
+80103163:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  iunlock(ip);
+80103166:	53                   	push   %ebx
+80103167:	e8 8a fe ff ff       	call   80102ff6 <iunlock>
+  iput(ip);
+8010316c:	89 1c 24             	mov    %ebx,(%esp)
+8010316f:	e8 0b ff ff ff       	call   8010307f <iput>
+}
+80103174:	83 c4 10             	add    $0x10,%esp
+80103177:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010317a:	c9                   	leave
+8010317b:	c3                   	ret
+
+8010317c <stati>:
+{
+8010317c:	55                   	push   %ebp
+8010317d:	89 e5                	mov    %esp,%ebp
+8010317f:	8b 55 08             	mov    0x8(%ebp),%edx
+80103182:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80103185:	8b 0a                	mov    (%edx),%ecx
+80103187:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+8010318a:	8b 4a 04             	mov    0x4(%edx),%ecx
+8010318d:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80103190:	0f b7 4a 5c          	movzwl 0x5c(%edx),%ecx
+80103194:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80103197:	0f b7 4a 62          	movzwl 0x62(%edx),%ecx
+8010319b:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+8010319f:	8b 52 64             	mov    0x64(%edx),%edx
+801031a2:	89 50 10             	mov    %edx,0x10(%eax)
+}
+801031a5:	5d                   	pop    %ebp
+801031a6:	c3                   	ret
+
+801031a7 <readahead>:
+{
+801031a7:	55                   	push   %ebp
+801031a8:	89 e5                	mov    %esp,%ebp
+801031aa:	57                   	push   %edi
+801031ab:	56                   	push   %esi
+801031ac:	53                   	push   %ebx
+801031ad:	83 ec 0c             	sub    $0xc,%esp
+801031b0:	8b 75 0c             	mov    0xc(%ebp),%esi
+801031b3:	8b 45 10             	mov    0x10(%ebp),%eax
+  if(ip->type == T_DEV || off >= ip->size)
+801031b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801031b9:	66 83 79 5c 03       	cmpw   $0x3,0x5c(%ecx)
+801031be:	74 61                	je     80103221 <readahead+0x7a>
+801031c0:	8b 51 64             	mov    0x64(%ecx),%edx
+801031c3:	39 d6                	cmp    %edx,%esi
+801031c5:	73 5a                	jae    80103221 <readahead+0x7a>
+  if(off + n > ip->size || off + n < off)
+801031c7:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+801031ca:	39 ca                	cmp    %ecx,%edx
+801031cc:	72 04                	jb     801031d2 <readahead+0x2b>
+801031ce:	39 f1                	cmp    %esi,%ecx
+801031d0:	73 04                	jae    801031d6 <readahead+0x2f>
+    n = ip->size - off;
+801031d2:	89 d0                	mov    %edx,%eax
+801031d4:	29 f0                	sub    %esi,%eax
+  if(n > NREADAHEAD*BSIZE - off%BSIZE)
+801031d6:	89 f2                	mov    %esi,%edx
+801031d8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+801031de:	bf 00 00 02 00       	mov    $0x20000,%edi
+801031e3:	29 d7                	sub    %edx,%edi
+801031e5:	39 c7                	cmp    %eax,%edi
+801031e7:	72 02                	jb     801031eb <readahead+0x44>
+801031e9:	89 c7                	mov    %eax,%edi
+  for(bn = off/BSIZE; bn <= (off + n - 1)/BSIZE; bn++)
+801031eb:	89 f3                	mov    %esi,%ebx
+801031ed:	c1 eb 0c             	shr    $0xc,%ebx
+801031f0:	eb 03                	jmp    801031f5 <readahead+0x4e>
+801031f2:	83 c3 01             	add    $0x1,%ebx
+801031f5:	8d 44 37 ff          	lea    -0x1(%edi,%esi,1),%eax
+801031f9:	c1 e8 0c             	shr    $0xc,%eax
+801031fc:	39 d8                	cmp    %ebx,%eax
+801031fe:	72 21                	jb     80103221 <readahead+0x7a>
+    if((addr = bmappeek(ip, bn)) != 0)
+80103200:	89 da                	mov    %ebx,%edx
+80103202:	8b 45 08             	mov    0x8(%ebp),%eax
+80103205:	e8 9e f3 ff ff       	call   801025a8 <bmappeek>
+8010320a:	85 c0                	test   %eax,%eax
+8010320c:	74 e4                	je     801031f2 <readahead+0x4b>
+      breadahead(ip->dev, addr);
+8010320e:	83 ec 08             	sub    $0x8,%esp
+80103211:	50                   	push   %eax
+80103212:	8b 45 08             	mov    0x8(%ebp),%eax
+80103215:	ff 30                	push   (%eax)
+80103217:	e8 66 d8 ff ff       	call   80100a82 <breadahead>
+8010321c:	83 c4 10             	add    $0x10,%esp
+8010321f:	eb d1                	jmp    801031f2 <readahead+0x4b>
+}
+80103221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103224:	5b                   	pop    %ebx
+80103225:	5e                   	pop    %esi
+80103226:	5f                   	pop    %edi
+80103227:	5d                   	pop    %ebp
+80103228:	c3                   	ret
+
+80103229 <readi>:
+{
+80103229:	55                   	push   %ebp
+8010322a:	89 e5                	mov    %esp,%ebp
+8010322c:	57                   	push   %edi
+8010322d:	56                   	push   %esi
+8010322e:	53                   	push   %ebx
+8010322f:	83 ec 1c             	sub    $0x1c,%esp
+80103232:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80103235:	8b 45 08             	mov    0x8(%ebp),%eax
+80103238:	66 83 78 5c 03       	cmpw   $0x3,0x5c(%eax)
+8010323d:	74 40                	je     8010327f <readi+0x56>
+  if(off > ip->size || off + n < off)
+8010323f:	8b 45 08             	mov    0x8(%ebp),%eax
+80103242:	8b 40 64             	mov    0x64(%eax),%eax
+80103245:	39 f8                	cmp    %edi,%eax
+80103247:	0f 82 f2 00 00 00    	jb     8010333f <readi+0x116>
+8010324d:	89 fa                	mov    %edi,%edx
+8010324f:	03 55 14             	add    0x14(%ebp),%edx
+80103252:	0f 82 ee 00 00 00    	jb     80103346 <readi+0x11d>
+  if(off + n > ip->size)
+80103258:	39 d0                	cmp    %edx,%eax
+8010325a:	73 05                	jae    80103261 <readi+0x38>
+    n = ip->size - off;
+8010325c:	29 f8                	sub    %edi,%eax
+8010325e:	89 45 14             	mov    %eax,0x14(%ebp)
+  if(n > BSIZE - off%BSIZE)
+80103261:	89 fa                	mov    %edi,%edx
+80103263:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+80103269:	b8 00 10 00 00       	mov    $0x1000,%eax
+8010326e:	29 d0                	sub    %edx,%eax
+80103270:	3b 45 14             	cmp    0x14(%ebp),%eax
+80103273:	72 3b                	jb     801032b0 <readi+0x87>
+{
+80103275:	be 00 00 00 00       	mov    $0x0,%esi
+8010327a:	e9 a2 00 00 00       	jmp    80103321 <readi+0xf8>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+8010327f:	0f b7 40 5e          	movzwl 0x5e(%eax),%eax
+80103283:	66 83 f8 09          	cmp    $0x9,%ax
+80103287:	0f 87 a4 00 00 00    	ja     80103331 <readi+0x108>
+8010328d:	98                   	cwtl
+8010328e:	8b 04 c5 20 88 11 80 	mov    -0x7fee77e0(,%eax,8),%eax
+80103295:	85 c0                	test   %eax,%eax
+80103297:	0f 84 9b 00 00 00    	je     80103338 <readi+0x10f>
+    return devsw[ip->major].read(ip, dst, n);
+8010329d:	83 ec 04             	sub    $0x4,%esp
+801032a0:	ff 75 14             	push   0x14(%ebp)
+801032a3:	ff 75 0c             	push   0xc(%ebp)
+801032a6:	ff 75 08             	push   0x8(%ebp)
+801032a9:	ff d0                	call   *%eax
+801032ab:	83 c4 10             	add    $0x10,%esp
+801032ae:	eb 79                	jmp    80103329 <readi+0x100>
+    readahead(ip, off, n);
+801032b0:	83 ec 04             	sub    $0x4,%esp
+801032b3:	ff 75 14             	push   0x14(%ebp)
+801032b6:	57                   	push   %edi
+801032b7:	ff 75 08             	push   0x8(%ebp)
+801032ba:	e8 e8 fe ff ff       	call   801031a7 <readahead>
+801032bf:	83 c4 10             	add    $0x10,%esp
+801032c2:	eb b1                	jmp    80103275 <readi+0x4c>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+801032c4:	89 fa                	mov    %edi,%edx
+801032c6:	c1 ea 0c             	shr    $0xc,%edx
+801032c9:	8b 45 08             	mov    0x8(%ebp),%eax
+801032cc:	e8 94 f2 ff ff       	call   80102565 <bmap>
+801032d1:	83 ec 08             	sub    $0x8,%esp
+801032d4:	50                   	push   %eax
+801032d5:	8b 45 08             	mov    0x8(%ebp),%eax
+801032d8:	ff 30                	push   (%eax)
+801032da:	e8 5d d6 ff ff       	call   8010093c <bread>
+801032df:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+801032e1:	89 f8                	mov    %edi,%eax
+801032e3:	25 ff 0f 00 00       	and    $0xfff,%eax
+801032e8:	bb 00 10 00 00       	mov    $0x1000,%ebx
+801032ed:	29 c3                	sub    %eax,%ebx
+801032ef:	8b 55 14             	mov    0x14(%ebp),%edx
+801032f2:	29 f2                	sub    %esi,%edx
+801032f4:	39 d3                	cmp    %edx,%ebx
+801032f6:	0f 47 da             	cmova  %edx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+801032f9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801032fc:	03 41 60             	add    0x60(%ecx),%eax
+801032ff:	83 c4 0c             	add    $0xc,%esp
+80103302:	53                   	push   %ebx
+80103303:	50                   	push   %eax
+80103304:	ff 75 0c             	push   0xc(%ebp)
+80103307:	e8 fa 53 00 00       	call   80108706 <memmove>
+    brelse(bp);
+8010330c:	83 c4 04             	add    $0x4,%esp
+8010330f:	ff 75 e4             	push   -0x1c(%ebp)
+80103312:	e8 f4 d6 ff ff       	call   80100a0b <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80103317:	01 de                	add    %ebx,%esi
+80103319:	01 df                	add    %ebx,%edi
+8010331b:	01 5d 0c             	add    %ebx,0xc(%ebp)
+8010331e:	83 c4 10             	add    $0x10,%esp
+80103321:	3b 75 14             	cmp    0x14(%ebp),%esi
+80103324:	72 9e                	jb     801032c4 <readi+0x9b>
+  return n;
+80103326:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+80103329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010332c:	5b                   	pop    %ebx
+8010332d:	5e                   	pop    %esi
+8010332e:	5f                   	pop    %edi
+8010332f:	5d                   	pop    %ebp
+80103330:	c3                   	ret
+      return -1;
+80103331:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103336:	eb f1                	jmp    80103329 <readi+0x100>
+80103338:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010333d:	eb ea                	jmp    80103329 <readi+0x100>
+    return -1;
+8010333f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103344:	eb e3                	jmp    80103329 <readi+0x100>
+80103346:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010334b:	eb dc                	jmp    80103329 <readi+0x100>
+
+8010334d <readipipe>:
+{
+8010334d:	55                   	push   %ebp
+8010334e:	89 e5                	mov    %esp,%ebp
+80103350:	57                   	push   %edi
+80103351:	56                   	push   %esi
+80103352:	53                   	push   %ebx
+80103353:	83 ec 1c             	sub    $0x1c,%esp
+80103356:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(ip->type == T_DEV || off > ip->size || off + n < off)
+80103359:	8b 45 08             	mov    0x8(%ebp),%eax
+8010335c:	66 83 78 5c 03       	cmpw   $0x3,0x5c(%eax)
+80103361:	0f 84 e8 00 00 00    	je     8010344f <readipipe+0x102>
+80103367:	8b 40 64             	mov    0x64(%eax),%eax
+8010336a:	39 f0                	cmp    %esi,%eax
+8010336c:	0f 82 e4 00 00 00    	jb     80103456 <readipipe+0x109>
+80103372:	89 f2                	mov    %esi,%edx
+80103374:	03 55 14             	add    0x14(%ebp),%edx
+80103377:	0f 82 e0 00 00 00    	jb     8010345d <readipipe+0x110>
+  if(off + n > ip->size)
+8010337d:	39 d0                	cmp    %edx,%eax
+8010337f:	73 05                	jae    80103386 <readipipe+0x39>
+    n = ip->size - off;
+80103381:	29 f0                	sub    %esi,%eax
+80103383:	89 45 14             	mov    %eax,0x14(%ebp)
+  if(n > BSIZE - off%BSIZE)
+80103386:	89 f2                	mov    %esi,%edx
+80103388:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+8010338e:	b8 00 10 00 00       	mov    $0x1000,%eax
+80103393:	29 d0                	sub    %edx,%eax
+80103395:	3b 45 14             	cmp    0x14(%ebp),%eax
+80103398:	72 0c                	jb     801033a6 <readipipe+0x59>
+      return tot > 0 ? tot : -1;
+8010339a:	bf 00 00 00 00       	mov    $0x0,%edi
+8010339f:	89 75 10             	mov    %esi,0x10(%ebp)
+801033a2:	89 fe                	mov    %edi,%esi
+801033a4:	eb 2b                	jmp    801033d1 <readipipe+0x84>
+    readahead(ip, off, n);
+801033a6:	83 ec 04             	sub    $0x4,%esp
+801033a9:	ff 75 14             	push   0x14(%ebp)
+801033ac:	56                   	push   %esi
+801033ad:	ff 75 08             	push   0x8(%ebp)
+801033b0:	e8 f2 fd ff ff       	call   801031a7 <readahead>
+801033b5:	83 c4 10             	add    $0x10,%esp
+801033b8:	eb e0                	jmp    8010339a <readipipe+0x4d>
+      return tot > 0 ? tot : -1;
+801033ba:	85 f6                	test   %esi,%esi
+801033bc:	74 07                	je     801033c5 <readipipe+0x78>
+801033be:	89 f0                	mov    %esi,%eax
+801033c0:	e9 82 00 00 00       	jmp    80103447 <readipipe+0xfa>
+801033c5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801033ca:	eb 7b                	jmp    80103447 <readipipe+0xfa>
+  for(tot=0; tot<n; tot+=r, off+=r){
+801033cc:	01 fe                	add    %edi,%esi
+801033ce:	01 7d 10             	add    %edi,0x10(%ebp)
+801033d1:	3b 75 14             	cmp    0x14(%ebp),%esi
+801033d4:	73 6d                	jae    80103443 <readipipe+0xf6>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+801033d6:	8b 55 10             	mov    0x10(%ebp),%edx
+801033d9:	c1 ea 0c             	shr    $0xc,%edx
+801033dc:	8b 45 08             	mov    0x8(%ebp),%eax
+801033df:	e8 81 f1 ff ff       	call   80102565 <bmap>
+801033e4:	83 ec 08             	sub    $0x8,%esp
+801033e7:	50                   	push   %eax
+801033e8:	8b 45 08             	mov    0x8(%ebp),%eax
+801033eb:	ff 30                	push   (%eax)
+801033ed:	e8 4a d5 ff ff       	call   8010093c <bread>
+801033f2:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+801033f4:	8b 55 10             	mov    0x10(%ebp),%edx
+801033f7:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+801033fd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+80103402:	29 d3                	sub    %edx,%ebx
+80103404:	8b 45 14             	mov    0x14(%ebp),%eax
+80103407:	29 f0                	sub    %esi,%eax
+80103409:	39 c3                	cmp    %eax,%ebx
+8010340b:	0f 47 d8             	cmova  %eax,%ebx
+    r = pipeput(p, (char*)bp->data + off%BSIZE, m);
+8010340e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80103411:	8b 41 60             	mov    0x60(%ecx),%eax
+80103414:	83 c4 0c             	add    $0xc,%esp
+80103417:	53                   	push   %ebx
+80103418:	01 d0                	add    %edx,%eax
+8010341a:	50                   	push   %eax
+8010341b:	ff 75 0c             	push   0xc(%ebp)
+8010341e:	e8 08 2a 00 00       	call   80105e2b <pipeput>
+80103423:	89 c7                	mov    %eax,%edi
+    brelse(bp);
+80103425:	83 c4 04             	add    $0x4,%esp
+80103428:	ff 75 e4             	push   -0x1c(%ebp)
+8010342b:	e8 db d5 ff ff       	call   80100a0b <brelse>
+    if(r < 0)
+80103430:	83 c4 10             	add    $0x10,%esp
+80103433:	85 ff                	test   %edi,%edi
+80103435:	78 83                	js     801033ba <readipipe+0x6d>
+    if(r < m){
+80103437:	39 fb                	cmp    %edi,%ebx
+80103439:	7e 91                	jle    801033cc <readipipe+0x7f>
+      tot += r;
+8010343b:	89 f8                	mov    %edi,%eax
+8010343d:	89 f7                	mov    %esi,%edi
+8010343f:	01 c7                	add    %eax,%edi
+      break;
+80103441:	eb 02                	jmp    80103445 <readipipe+0xf8>
+80103443:	89 f7                	mov    %esi,%edi
+  return tot;
+80103445:	89 f8                	mov    %edi,%eax
+}
+80103447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010344a:	5b                   	pop    %ebx
+8010344b:	5e                   	pop    %esi
+8010344c:	5f                   	pop    %edi
+8010344d:	5d                   	pop    %ebp
+8010344e:	c3                   	ret
+    return -1;
+8010344f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103454:	eb f1                	jmp    80103447 <readipipe+0xfa>
+80103456:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010345b:	eb ea                	jmp    80103447 <readipipe+0xfa>
+8010345d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103462:	eb e3                	jmp    80103447 <readipipe+0xfa>
+
+80103464 <writeipipe>:
+{
+80103464:	55                   	push   %ebp
+80103465:	89 e5                	mov    %esp,%ebp
+80103467:	57                   	push   %edi
+80103468:	56                   	push   %esi
+80103469:	53                   	push   %ebx
+8010346a:	83 ec 1c             	sub    $0x1c,%esp
+8010346d:	8b 55 14             	mov    0x14(%ebp),%edx
+  if(ip->type == T_DEV || ip->nexec > 0 || off > ip->size || off + n < off)
+80103470:	8b 45 08             	mov    0x8(%ebp),%eax
+80103473:	66 83 78 5c 03       	cmpw   $0x3,0x5c(%eax)
+80103478:	0f 84 b3 01 00 00    	je     80103631 <writeipipe+0x1cd>
+8010347e:	83 b8 e8 00 00 00 00 	cmpl   $0x0,0xe8(%eax)
+80103485:	0f 8f ad 01 00 00    	jg     80103638 <writeipipe+0x1d4>
+8010348b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010348e:	39 48 64             	cmp    %ecx,0x64(%eax)
+80103491:	0f 82 a8 01 00 00    	jb     8010363f <writeipipe+0x1db>
+80103497:	89 d0                	mov    %edx,%eax
+80103499:	01 c8                	add    %ecx,%eax
+8010349b:	0f 82 a5 01 00 00    	jb     80103646 <writeipipe+0x1e2>
+  if(n > 0 && (off + n - 1)/BSIZE >= MAXFILE)
+801034a1:	85 d2                	test   %edx,%edx
+801034a3:	0f 84 65 01 00 00    	je     8010360e <writeipipe+0x1aa>
+801034a9:	83 e8 01             	sub    $0x1,%eax
+801034ac:	3d ff ef ff ff       	cmp    $0xffffefff,%eax
+801034b1:	0f 87 96 01 00 00    	ja     8010364d <writeipipe+0x1e9>
+801034b7:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+801034be:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+801034c5:	e9 97 00 00 00       	jmp    80103561 <writeipipe+0xfd>
+      bp = bread(ip->dev, addr);
+801034ca:	83 ec 08             	sub    $0x8,%esp
+801034cd:	50                   	push   %eax
+801034ce:	8b 45 08             	mov    0x8(%ebp),%eax
+801034d1:	ff 30                	push   (%eax)
+801034d3:	e8 64 d4 ff ff       	call   8010093c <bread>
+801034d8:	89 c6                	mov    %eax,%esi
+      r = pipeget(p, (char*)bp->data + off%BSIZE, m);
+801034da:	8b 40 60             	mov    0x60(%eax),%eax
+801034dd:	83 c4 0c             	add    $0xc,%esp
+801034e0:	ff 75 e0             	push   -0x20(%ebp)
+801034e3:	01 f8                	add    %edi,%eax
+801034e5:	50                   	push   %eax
+801034e6:	ff 75 0c             	push   0xc(%ebp)
+801034e9:	e8 82 29 00 00       	call   80105e70 <pipeget>
+801034ee:	89 c3                	mov    %eax,%ebx
+801034f0:	83 c4 10             	add    $0x10,%esp
+801034f3:	eb 4b                	jmp    80103540 <writeipipe+0xdc>
+      if((r = pipeget(p, stage, m)) == 0)
+801034f5:	83 ec 04             	sub    $0x4,%esp
+801034f8:	ff 75 e0             	push   -0x20(%ebp)
+801034fb:	ff 75 dc             	push   -0x24(%ebp)
+801034fe:	ff 75 0c             	push   0xc(%ebp)
+80103501:	e8 6a 29 00 00       	call   80105e70 <pipeget>
+80103506:	89 c3                	mov    %eax,%ebx
+80103508:	83 c4 10             	add    $0x10,%esp
+8010350b:	85 c0                	test   %eax,%eax
+8010350d:	0f 84 cc 00 00 00    	je     801035df <writeipipe+0x17b>
+      bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80103513:	89 f2                	mov    %esi,%edx
+80103515:	8b 45 08             	mov    0x8(%ebp),%eax
+80103518:	e8 48 f0 ff ff       	call   80102565 <bmap>
+8010351d:	83 ec 08             	sub    $0x8,%esp
+80103520:	50                   	push   %eax
+80103521:	8b 45 08             	mov    0x8(%ebp),%eax
+80103524:	ff 30                	push   (%eax)
+80103526:	e8 11 d4 ff ff       	call   8010093c <bread>
+8010352b:	89 c6                	mov    %eax,%esi
+      memmove(bp->data + off%BSIZE, stage, r);
+8010352d:	03 78 60             	add    0x60(%eax),%edi
+80103530:	83 c4 0c             	add    $0xc,%esp
+80103533:	53                   	push   %ebx
+80103534:	ff 75 dc             	push   -0x24(%ebp)
+80103537:	57                   	push   %edi
+80103538:	e8 c9 51 00 00       	call   80108706 <memmove>
+8010353d:	83 c4 10             	add    $0x10,%esp
+    if(r > 0)
+80103540:	85 db                	test   %ebx,%ebx
+80103542:	0f 8f 80 00 00 00    	jg     801035c8 <writeipipe+0x164>
+    brelse(bp);
+80103548:	83 ec 0c             	sub    $0xc,%esp
+8010354b:	56                   	push   %esi
+8010354c:	e8 ba d4 ff ff       	call   80100a0b <brelse>
+    if(r < m){
+80103551:	83 c4 10             	add    $0x10,%esp
+80103554:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103557:	39 c3                	cmp    %eax,%ebx
+80103559:	7c 7e                	jl     801035d9 <writeipipe+0x175>
+  for(tot=0; tot<n; tot+=r, off+=r){
+8010355b:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+8010355e:	01 5d 10             	add    %ebx,0x10(%ebp)
+80103561:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103564:	3b 45 14             	cmp    0x14(%ebp),%eax
+80103567:	73 76                	jae    801035df <writeipipe+0x17b>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80103569:	8b 7d 10             	mov    0x10(%ebp),%edi
+8010356c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+80103572:	b8 00 10 00 00       	mov    $0x1000,%eax
+80103577:	29 f8                	sub    %edi,%eax
+80103579:	8b 55 14             	mov    0x14(%ebp),%edx
+8010357c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010357f:	29 ca                	sub    %ecx,%edx
+80103581:	39 d0                	cmp    %edx,%eax
+80103583:	0f 46 d0             	cmovbe %eax,%edx
+80103586:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    if((addr = bmappeek(ip, off/BSIZE)) != 0){
+80103589:	8b 75 10             	mov    0x10(%ebp),%esi
+8010358c:	c1 ee 0c             	shr    $0xc,%esi
+8010358f:	89 f2                	mov    %esi,%edx
+80103591:	8b 45 08             	mov    0x8(%ebp),%eax
+80103594:	e8 0f f0 ff ff       	call   801025a8 <bmappeek>
+80103599:	85 c0                	test   %eax,%eax
+8010359b:	0f 85 29 ff ff ff    	jne    801034ca <writeipipe+0x66>
+      if(stage == 0 && (stage = kalloc()) == 0){
+801035a1:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+801035a5:	0f 85 4a ff ff ff    	jne    801034f5 <writeipipe+0x91>
+801035ab:	e8 80 15 00 00       	call   80104b30 <kalloc>
+801035b0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801035b3:	85 c0                	test   %eax,%eax
+801035b5:	0f 85 3a ff ff ff    	jne    801034f5 <writeipipe+0x91>
+        if(tot == 0)
+801035bb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801035bf:	75 1e                	jne    801035df <writeipipe+0x17b>
+          return -1;
+801035c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801035c6:	eb 3e                	jmp    80103606 <writeipipe+0x1a2>
+      log_write(bp);
+801035c8:	83 ec 0c             	sub    $0xc,%esp
+801035cb:	56                   	push   %esi
+801035cc:	e8 ef 1d 00 00       	call   801053c0 <log_write>
+801035d1:	83 c4 10             	add    $0x10,%esp
+801035d4:	e9 6f ff ff ff       	jmp    80103548 <writeipipe+0xe4>
+      tot += r;
+801035d9:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+      off += r;
+801035dc:	01 5d 10             	add    %ebx,0x10(%ebp)
+  if(stage)
+801035df:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801035e2:	85 c0                	test   %eax,%eax
+801035e4:	74 0c                	je     801035f2 <writeipipe+0x18e>
+    kfree(stage);
+801035e6:	83 ec 0c             	sub    $0xc,%esp
+801035e9:	50                   	push   %eax
+801035ea:	e8 22 13 00 00       	call   80104911 <kfree>
+801035ef:	83 c4 10             	add    $0x10,%esp
+  if(tot > 0 && off > ip->size){
+801035f2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801035f6:	74 0b                	je     80103603 <writeipipe+0x19f>
+801035f8:	8b 45 08             	mov    0x8(%ebp),%eax
+801035fb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801035fe:	39 48 64             	cmp    %ecx,0x64(%eax)
+80103601:	72 1d                	jb     80103620 <writeipipe+0x1bc>
+  return tot;
+80103603:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+}
+80103606:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103609:	5b                   	pop    %ebx
+8010360a:	5e                   	pop    %esi
+8010360b:	5f                   	pop    %edi
+8010360c:	5d                   	pop    %ebp
+8010360d:	c3                   	ret
+8010360e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80103611:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+80103618:	89 55 14             	mov    %edx,0x14(%ebp)
+8010361b:	e9 41 ff ff ff       	jmp    80103561 <writeipipe+0xfd>
+    ip->size = off;
+80103620:	89 48 64             	mov    %ecx,0x64(%eax)
+    iupdate(ip);
+80103623:	83 ec 0c             	sub    $0xc,%esp
+80103626:	50                   	push   %eax
+80103627:	e8 61 f7 ff ff       	call   80102d8d <iupdate>
+8010362c:	83 c4 10             	add    $0x10,%esp
+8010362f:	eb d2                	jmp    80103603 <writeipipe+0x19f>
+    return -1;
+80103631:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103636:	eb ce                	jmp    80103606 <writeipipe+0x1a2>
+80103638:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010363d:	eb c7                	jmp    80103606 <writeipipe+0x1a2>
+8010363f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103644:	eb c0                	jmp    80103606 <writeipipe+0x1a2>
+80103646:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010364b:	eb b9                	jmp    80103606 <writeipipe+0x1a2>
+    return -1;
+8010364d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103652:	eb b2                	jmp    80103606 <writeipipe+0x1a2>
+
+80103654 <writei>:
+{
+80103654:	55                   	push   %ebp
+80103655:	89 e5                	mov    %esp,%ebp
+80103657:	57                   	push   %edi
+80103658:	56                   	push   %esi
+80103659:	53                   	push   %ebx
+8010365a:	83 ec 1c             	sub    $0x1c,%esp
+8010365d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80103660:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80103663:	66 83 79 5c 03       	cmpw   $0x3,0x5c(%ecx)
+80103668:	74 46                	je     801036b0 <writei+0x5c>
+  if(ip->nexec > 0)
+8010366a:	83 b9 e8 00 00 00 00 	cmpl   $0x0,0xe8(%ecx)
+80103671:	0f 8f 15 01 00 00    	jg     8010378c <writei+0x138>
+  if(off > ip->size || off + n < off)
+80103677:	39 79 64             	cmp    %edi,0x64(%ecx)
+8010367a:	0f 82 13 01 00 00    	jb     80103793 <writei+0x13f>
+80103680:	89 f8                	mov    %edi,%eax
+80103682:	03 45 14             	add    0x14(%ebp),%eax
+80103685:	0f 82 0f 01 00 00    	jb     8010379a <writei+0x146>
+  if(n > 0 && (off + n - 1)/BSIZE >= MAXFILE)
+8010368b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010368f:	0f 84 d0 00 00 00    	je     80103765 <writei+0x111>
+80103695:	83 e8 01             	sub    $0x1,%eax
+80103698:	3d ff ef ff ff       	cmp    $0xffffefff,%eax
+8010369d:	0f 87 fe 00 00 00    	ja     801037a1 <writei+0x14d>
+801036a3:	be 00 00 00 00       	mov    $0x0,%esi
+801036a8:	89 4d 08             	mov    %ecx,0x8(%ebp)
+801036ab:	e9 97 00 00 00       	jmp    80103747 <writei+0xf3>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+801036b0:	0f b7 41 5e          	movzwl 0x5e(%ecx),%eax
+801036b4:	66 83 f8 09          	cmp    $0x9,%ax
+801036b8:	0f 87 c0 00 00 00    	ja     8010377e <writei+0x12a>
+801036be:	98                   	cwtl
+801036bf:	8b 04 c5 24 88 11 80 	mov    -0x7fee77dc(,%eax,8),%eax
+801036c6:	85 c0                	test   %eax,%eax
+801036c8:	0f 84 b7 00 00 00    	je     80103785 <writei+0x131>
+    return devsw[ip->major].write(ip, src, n);
+801036ce:	83 ec 04             	sub    $0x4,%esp
+801036d1:	ff 75 14             	push   0x14(%ebp)
+801036d4:	ff 75 0c             	push   0xc(%ebp)
+801036d7:	51                   	push   %ecx
+801036d8:	ff d0                	call   *%eax
+801036da:	83 c4 10             	add    $0x10,%esp
+801036dd:	eb 7e                	jmp    8010375d <writei+0x109>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+801036df:	89 fa                	mov    %edi,%edx
+801036e1:	c1 ea 0c             	shr    $0xc,%edx
+801036e4:	8b 45 08             	mov    0x8(%ebp),%eax
+801036e7:	e8 79 ee ff ff       	call   80102565 <bmap>
+801036ec:	83 ec 08             	sub    $0x8,%esp
+801036ef:	50                   	push   %eax
+801036f0:	8b 45 08             	mov    0x8(%ebp),%eax
+801036f3:	ff 30                	push   (%eax)
+801036f5:	e8 42 d2 ff ff       	call   8010093c <bread>
+801036fa:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+801036fc:	89 f8                	mov    %edi,%eax
+801036fe:	25 ff 0f 00 00       	and    $0xfff,%eax
+80103703:	bb 00 10 00 00       	mov    $0x1000,%ebx
+80103708:	29 c3                	sub    %eax,%ebx
+8010370a:	8b 55 14             	mov    0x14(%ebp),%edx
+8010370d:	29 f2                	sub    %esi,%edx
+8010370f:	39 d3                	cmp    %edx,%ebx
+80103711:	0f 47 da             	cmova  %edx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+80103714:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80103717:	03 41 60             	add    0x60(%ecx),%eax
+8010371a:	83 c4 0c             	add    $0xc,%esp
+8010371d:	53                   	push   %ebx
+8010371e:	ff 75 0c             	push   0xc(%ebp)
+80103721:	50                   	push   %eax
+80103722:	e8 df 4f 00 00       	call   80108706 <memmove>
+    log_write(bp);
+80103727:	83 c4 04             	add    $0x4,%esp
+8010372a:	ff 75 e4             	push   -0x1c(%ebp)
+8010372d:	e8 8e 1c 00 00       	call   801053c0 <log_write>
+    brelse(bp);
+80103732:	83 c4 04             	add    $0x4,%esp
+80103735:	ff 75 e4             	push   -0x1c(%ebp)
+80103738:	e8 ce d2 ff ff       	call   80100a0b <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+8010373d:	01 de                	add    %ebx,%esi
+8010373f:	01 df                	add    %ebx,%edi
+80103741:	01 5d 0c             	add    %ebx,0xc(%ebp)
+80103744:	83 c4 10             	add    $0x10,%esp
+80103747:	3b 75 14             	cmp    0x14(%ebp),%esi
+8010374a:	72 93                	jb     801036df <writei+0x8b>
+  if(n > 0 && off > ip->size){
+8010374c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010374f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+80103753:	74 05                	je     8010375a <writei+0x106>
+80103755:	39 79 64             	cmp    %edi,0x64(%ecx)
+80103758:	72 13                	jb     8010376d <writei+0x119>
+  return n;
+8010375a:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+8010375d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103760:	5b                   	pop    %ebx
+80103761:	5e                   	pop    %esi
+80103762:	5f                   	pop    %edi
+80103763:	5d                   	pop    %ebp
+80103764:	c3                   	ret
+80103765:	8b 75 14             	mov    0x14(%ebp),%esi
+80103768:	89 4d 08             	mov    %ecx,0x8(%ebp)
+8010376b:	eb da                	jmp    80103747 <writei+0xf3>
+    ip->size = off;
+8010376d:	89 79 64             	mov    %edi,0x64(%ecx)
+    iupdate(ip);
+80103770:	83 ec 0c             	sub    $0xc,%esp
+80103773:	51                   	push   %ecx
+80103774:	e8 14 f6 ff ff       	call   80102d8d <iupdate>
+80103779:	83 c4 10             	add    $0x10,%esp
+8010377c:	eb dc                	jmp    8010375a <writei+0x106>
+      return -1;
+8010377e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103783:	eb d8                	jmp    8010375d <writei+0x109>
+80103785:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010378a:	eb d1                	jmp    8010375d <writei+0x109>
+    return -1;  // a running program's text
+8010378c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103791:	eb ca                	jmp    8010375d <writei+0x109>
+    return -1;
+80103793:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103798:	eb c3                	jmp    8010375d <writei+0x109>
+8010379a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010379f:	eb bc                	jmp    8010375d <writei+0x109>
+    return -1;
+801037a1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801037a6:	eb b5                	jmp    8010375d <writei+0x109>
+
+801037a8 <namecmp>:
+{
+801037a8:	55                   	push   %ebp
+801037a9:	89 e5                	mov    %esp,%ebp
+801037ab:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+801037ae:	6a 0e                	push   $0xe
+801037b0:	ff 75 0c             	push   0xc(%ebp)
+801037b3:	ff 75 08             	push   0x8(%ebp)
+801037b6:	e8 b7 4f 00 00       	call   80108772 <strncmp>
+}
+801037bb:	c9                   	leave
+801037bc:	c3                   	ret
+
+801037bd <dcacheget>:
+{
+801037bd:	55                   	push   %ebp
+801037be:	89 e5                	mov    %esp,%ebp
+801037c0:	57                   	push   %edi
+801037c1:	56                   	push   %esi
+801037c2:	53                   	push   %ebx
+801037c3:	83 ec 28             	sub    $0x28,%esp
+801037c6:	89 c3                	mov    %eax,%ebx
+801037c8:	89 d7                	mov    %edx,%edi
+801037ca:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  acquire(&dcache.lock);
+801037cd:	68 80 c2 11 80       	push   $0x8011c280
+801037d2:	e8 0b 4e 00 00       	call   801085e2 <acquire>
+  e = dcentry(dp, name);
+801037d7:	89 fa                	mov    %edi,%edx
+801037d9:	89 d8                	mov    %ebx,%eax
+801037db:	e8 a3 e6 ff ff       	call   80101e83 <dcentry>
+801037e0:	89 c6                	mov    %eax,%esi
+  hit = e->dir == dp->inum && e->dev == dp->dev && namecmp(name, e->name) == 0;
+801037e2:	83 c4 10             	add    $0x10,%esp
+801037e5:	8b 43 04             	mov    0x4(%ebx),%eax
+801037e8:	39 46 04             	cmp    %eax,0x4(%esi)
+801037eb:	74 1c                	je     80103809 <dcacheget+0x4c>
+801037ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  release(&dcache.lock);
+801037f2:	83 ec 0c             	sub    $0xc,%esp
+801037f5:	68 80 c2 11 80       	push   $0x8011c280
+801037fa:	e8 48 4e 00 00       	call   80108647 <release>
+}
+801037ff:	89 d8                	mov    %ebx,%eax
+80103801:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103804:	5b                   	pop    %ebx
+80103805:	5e                   	pop    %esi
+80103806:	5f                   	pop    %edi
+80103807:	5d                   	pop    %ebp
+80103808:	c3                   	ret
+  hit = e->dir == dp->inum && e->dev == dp->dev && namecmp(name, e->name) == 0;
+80103809:	8b 03                	mov    (%ebx),%eax
+8010380b:	39 06                	cmp    %eax,(%esi)
+8010380d:	74 07                	je     80103816 <dcacheget+0x59>
+8010380f:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103814:	eb dc                	jmp    801037f2 <dcacheget+0x35>
+80103816:	8d 46 0c             	lea    0xc(%esi),%eax
+80103819:	83 ec 08             	sub    $0x8,%esp
+8010381c:	50                   	push   %eax
+8010381d:	57                   	push   %edi
+8010381e:	e8 85 ff ff ff       	call   801037a8 <namecmp>
+80103823:	83 c4 10             	add    $0x10,%esp
+80103826:	85 c0                	test   %eax,%eax
+80103828:	75 0f                	jne    80103839 <dcacheget+0x7c>
+    *inum = e->inum;
+8010382a:	8b 46 08             	mov    0x8(%esi),%eax
+8010382d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103830:	89 07                	mov    %eax,(%edi)
+  hit = e->dir == dp->inum && e->dev == dp->dev && namecmp(name, e->name) == 0;
+80103832:	bb 01 00 00 00       	mov    $0x1,%ebx
+80103837:	eb b9                	jmp    801037f2 <dcacheget+0x35>
+80103839:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010383e:	eb b2                	jmp    801037f2 <dcacheget+0x35>
+
+80103840 <dirlookup>:
+{
+80103840:	55                   	push   %ebp
+80103841:	89 e5                	mov    %esp,%ebp
+80103843:	57                   	push   %edi
+80103844:	56                   	push   %esi
+80103845:	53                   	push   %ebx
+80103846:	83 ec 3c             	sub    $0x3c,%esp
+80103849:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(dp->type != T_DIR)
+8010384c:	66 83 7f 5c 01       	cmpw   $0x1,0x5c(%edi)
+80103851:	75 41                	jne    80103894 <dirlookup+0x54>
+  if(poff == 0 && dcacheget(dp, name, &inum))
+80103853:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80103857:	74 48                	je     801038a1 <dirlookup+0x61>
+  if(dp->ndirhash == 0 && dp->size > DIRIDXMIN)
+80103859:	83 bf f0 00 00 00 00 	cmpl   $0x0,0xf0(%edi)
+80103860:	75 09                	jne    8010386b <dirlookup+0x2b>
+80103862:	81 7f 64 00 10 00 00 	cmpl   $0x1000,0x64(%edi)
+80103869:	77 62                	ja     801038cd <dirlookup+0x8d>
+  if(dp->ndirhash){
+8010386b:	8b 87 f0 00 00 00    	mov    0xf0(%edi),%eax
+80103871:	85 c0                	test   %eax,%eax
+80103873:	0f 84 72 01 00 00    	je     801039eb <dirlookup+0x1ab>
+    n = dp->ndirhash * DIRSLOTS;
+80103879:	c1 e0 0a             	shl    $0xa,%eax
+8010387c:	89 c3                	mov    %eax,%ebx
+8010387e:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    for(i = dirhash(name) % n; (v = *dirslot(dp, i)) != 0; i = (i + 1) % n){
+80103881:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103884:	e8 31 e5 ff ff       	call   80101dba <dirhash>
+80103889:	ba 00 00 00 00       	mov    $0x0,%edx
+8010388e:	f7 f3                	div    %ebx
+80103890:	89 d3                	mov    %edx,%ebx
+80103892:	eb 5c                	jmp    801038f0 <dirlookup+0xb0>
+    panic("dirlookup not DIR");
+80103894:	83 ec 0c             	sub    $0xc,%esp
+80103897:	68 30 bf 10 80       	push   $0x8010bf30
+8010389c:	e8 55 d3 ff ff       	call   80100bf6 <panic>
+  if(poff == 0 && dcacheget(dp, name, &inum))
+801038a1:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+801038a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+801038a7:	89 f8                	mov    %edi,%eax
+801038a9:	e8 0f ff ff ff       	call   801037bd <dcacheget>
+801038ae:	85 c0                	test   %eax,%eax
+801038b0:	74 a7                	je     80103859 <dirlookup+0x19>
+    return inum ? iget(dp->dev, inum) : 0;
+801038b2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801038b5:	85 d2                	test   %edx,%edx
+801038b7:	75 08                	jne    801038c1 <dirlookup+0x81>
+801038b9:	8b 45 10             	mov    0x10(%ebp),%eax
+801038bc:	e9 b5 00 00 00       	jmp    80103976 <dirlookup+0x136>
+801038c1:	8b 07                	mov    (%edi),%eax
+801038c3:	e8 c0 ed ff ff       	call   80102688 <iget>
+801038c8:	89 45 10             	mov    %eax,0x10(%ebp)
+801038cb:	eb ec                	jmp    801038b9 <dirlookup+0x79>
+    dirindex(dp);
+801038cd:	89 f8                	mov    %edi,%eax
+801038cf:	e8 22 ef ff ff       	call   801027f6 <dirindex>
+801038d4:	eb 95                	jmp    8010386b <dirlookup+0x2b>
+        panic("dirlookup read");
+801038d6:	83 ec 0c             	sub    $0xc,%esp
+801038d9:	68 42 bf 10 80       	push   $0x8010bf42
+801038de:	e8 13 d3 ff ff       	call   80100bf6 <panic>
+    for(i = dirhash(name) % n; (v = *dirslot(dp, i)) != 0; i = (i + 1) % n){
+801038e3:	8d 43 01             	lea    0x1(%ebx),%eax
+801038e6:	ba 00 00 00 00       	mov    $0x0,%edx
+801038eb:	f7 75 c4             	divl   -0x3c(%ebp)
+801038ee:	89 d3                	mov    %edx,%ebx
+801038f0:	89 da                	mov    %ebx,%edx
+801038f2:	89 f8                	mov    %edi,%eax
+801038f4:	e8 f7 e4 ff ff       	call   80101df0 <dirslot>
+801038f9:	8b 30                	mov    (%eax),%esi
+801038fb:	85 f6                	test   %esi,%esi
+801038fd:	74 63                	je     80103962 <dirlookup+0x122>
+      if(v == DIRDEL)
+801038ff:	83 fe ff             	cmp    $0xffffffff,%esi
+80103902:	74 df                	je     801038e3 <dirlookup+0xa3>
+      off = (v - 1) * sizeof(de);
+80103904:	83 ee 01             	sub    $0x1,%esi
+80103907:	c1 e6 04             	shl    $0x4,%esi
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010390a:	6a 10                	push   $0x10
+8010390c:	56                   	push   %esi
+8010390d:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+80103910:	50                   	push   %eax
+80103911:	57                   	push   %edi
+80103912:	e8 12 f9 ff ff       	call   80103229 <readi>
+80103917:	83 c4 10             	add    $0x10,%esp
+8010391a:	83 f8 10             	cmp    $0x10,%eax
+8010391d:	75 b7                	jne    801038d6 <dirlookup+0x96>
+      if(de.inum != 0 && namecmp(name, de.name) == 0){
+8010391f:	66 83 7d d4 00       	cmpw   $0x0,-0x2c(%ebp)
+80103924:	74 bd                	je     801038e3 <dirlookup+0xa3>
+80103926:	83 ec 08             	sub    $0x8,%esp
+80103929:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+8010392c:	50                   	push   %eax
+8010392d:	ff 75 0c             	push   0xc(%ebp)
+80103930:	e8 73 fe ff ff       	call   801037a8 <namecmp>
+80103935:	83 c4 10             	add    $0x10,%esp
+80103938:	85 c0                	test   %eax,%eax
+8010393a:	75 a7                	jne    801038e3 <dirlookup+0xa3>
+        if(poff)
+8010393c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80103940:	74 05                	je     80103947 <dirlookup+0x107>
+          *poff = off;
+80103942:	8b 45 10             	mov    0x10(%ebp),%eax
+80103945:	89 30                	mov    %esi,(%eax)
+        dcacheput(dp, name, de.inum);
+80103947:	0f b7 4d d4          	movzwl -0x2c(%ebp),%ecx
+8010394b:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010394e:	89 f8                	mov    %edi,%eax
+80103950:	e8 03 f0 ff ff       	call   80102958 <dcacheput>
+        return iget(dp->dev, de.inum);
+80103955:	0f b7 55 d4          	movzwl -0x2c(%ebp),%edx
+80103959:	8b 07                	mov    (%edi),%eax
+8010395b:	e8 28 ed ff ff       	call   80102688 <iget>
+80103960:	eb 14                	jmp    80103976 <dirlookup+0x136>
+    dcacheput(dp, name, 0);
+80103962:	b9 00 00 00 00       	mov    $0x0,%ecx
+80103967:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010396a:	89 f8                	mov    %edi,%eax
+8010396c:	e8 e7 ef ff ff       	call   80102958 <dcacheput>
+    return 0;
+80103971:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80103976:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103979:	5b                   	pop    %ebx
+8010397a:	5e                   	pop    %esi
+8010397b:	5f                   	pop    %edi
+8010397c:	5d                   	pop    %ebp
+8010397d:	c3                   	ret
+      panic("dirlookup read");
+8010397e:	83 ec 0c             	sub    $0xc,%esp
+80103981:	68 42 bf 10 80       	push   $0x8010bf42
+80103986:	e8 6b d2 ff ff       	call   80100bf6 <panic>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+8010398b:	83 c3 10             	add    $0x10,%ebx
+8010398e:	3b 5f 64             	cmp    0x64(%edi),%ebx
+80103991:	73 62                	jae    801039f5 <dirlookup+0x1b5>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103993:	6a 10                	push   $0x10
+80103995:	53                   	push   %ebx
+80103996:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+80103999:	50                   	push   %eax
+8010399a:	57                   	push   %edi
+8010399b:	e8 89 f8 ff ff       	call   80103229 <readi>
+801039a0:	83 c4 10             	add    $0x10,%esp
+801039a3:	83 f8 10             	cmp    $0x10,%eax
+801039a6:	75 d6                	jne    8010397e <dirlookup+0x13e>
+    if(de.inum == 0)
+801039a8:	66 83 7d d4 00       	cmpw   $0x0,-0x2c(%ebp)
+801039ad:	74 dc                	je     8010398b <dirlookup+0x14b>
+    if(namecmp(name, de.name) == 0){
+801039af:	83 ec 08             	sub    $0x8,%esp
+801039b2:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+801039b5:	50                   	push   %eax
+801039b6:	56                   	push   %esi
+801039b7:	e8 ec fd ff ff       	call   801037a8 <namecmp>
+801039bc:	83 c4 10             	add    $0x10,%esp
+801039bf:	85 c0                	test   %eax,%eax
+801039c1:	75 c8                	jne    8010398b <dirlookup+0x14b>
+      if(poff)
+801039c3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+801039c7:	74 05                	je     801039ce <dirlookup+0x18e>
+        *poff = off;
+801039c9:	8b 45 10             	mov    0x10(%ebp),%eax
+801039cc:	89 18                	mov    %ebx,(%eax)
+      inum = de.inum;
+801039ce:	0f b7 4d d4          	movzwl -0x2c(%ebp),%ecx
+801039d2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+      dcacheput(dp, name, inum);
+801039d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+801039d8:	89 f8                	mov    %edi,%eax
+801039da:	e8 79 ef ff ff       	call   80102958 <dcacheput>
+      return iget(dp->dev, inum);
+801039df:	8b 07                	mov    (%edi),%eax
+801039e1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801039e4:	e8 9f ec ff ff       	call   80102688 <iget>
+801039e9:	eb 8b                	jmp    80103976 <dirlookup+0x136>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801039eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+801039f0:	8b 75 0c             	mov    0xc(%ebp),%esi
+801039f3:	eb 99                	jmp    8010398e <dirlookup+0x14e>
+  dcacheput(dp, name, 0);
+801039f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+801039fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+801039fd:	89 f8                	mov    %edi,%eax
+801039ff:	e8 54 ef ff ff       	call   80102958 <dcacheput>
+  return 0;
+80103a04:	b8 00 00 00 00       	mov    $0x0,%eax
+80103a09:	e9 68 ff ff ff       	jmp    80103976 <dirlookup+0x136>
+
+80103a0e <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80103a0e:	55                   	push   %ebp
+80103a0f:	89 e5                	mov    %esp,%ebp
+80103a11:	57                   	push   %edi
+80103a12:	56                   	push   %esi
+80103a13:	53                   	push   %ebx
+80103a14:	83 ec 1c             	sub    $0x1c,%esp
+80103a17:	89 c3                	mov    %eax,%ebx
+80103a19:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80103a1c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  struct inode *ip, *next;
+
+  if(*path == '/')
+80103a1f:	80 38 2f             	cmpb   $0x2f,(%eax)
+80103a22:	74 17                	je     80103a3b <namex+0x2d>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+80103a24:	e8 23 2f 00 00       	call   8010694c <myproc>
+80103a29:	83 ec 0c             	sub    $0xc,%esp
+80103a2c:	ff 70 78             	push   0x78(%eax)
+80103a2f:	e8 b6 f4 ff ff       	call   80102eea <idup>
+80103a34:	89 c6                	mov    %eax,%esi
+80103a36:	83 c4 10             	add    $0x10,%esp
+80103a39:	eb 53                	jmp    80103a8e <namex+0x80>
+    ip = iget(ROOTDEV, ROOTINO);
+80103a3b:	ba 01 00 00 00       	mov    $0x1,%edx
+80103a40:	b8 01 00 00 00       	mov    $0x1,%eax
+80103a45:	e8 3e ec ff ff       	call   80102688 <iget>
+80103a4a:	89 c6                	mov    %eax,%esi
+80103a4c:	eb 40                	jmp    80103a8e <namex+0x80>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+    if(ip->type != T_DIR){
+      iunlockput(ip);
+80103a4e:	83 ec 0c             	sub    $0xc,%esp
+80103a51:	56                   	push   %esi
+80103a52:	e8 05 f7 ff ff       	call   8010315c <iunlockput>
+      return 0;
+80103a57:	83 c4 10             	add    $0x10,%esp
+80103a5a:	be 00 00 00 00       	mov    $0x0,%esi
+  if(nameiparent){
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+80103a5f:	89 f0                	mov    %esi,%eax
+80103a61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103a64:	5b                   	pop    %ebx
+80103a65:	5e                   	pop    %esi
+80103a66:	5f                   	pop    %edi
+80103a67:	5d                   	pop    %ebp
+80103a68:	c3                   	ret
+    if((next = dirlookup(ip, name, 0)) == 0){
+80103a69:	83 ec 04             	sub    $0x4,%esp
+80103a6c:	6a 00                	push   $0x0
+80103a6e:	ff 75 e4             	push   -0x1c(%ebp)
+80103a71:	56                   	push   %esi
+80103a72:	e8 c9 fd ff ff       	call   80103840 <dirlookup>
+80103a77:	89 c7                	mov    %eax,%edi
+80103a79:	83 c4 10             	add    $0x10,%esp
+80103a7c:	85 c0                	test   %eax,%eax
+80103a7e:	74 4a                	je     80103aca <namex+0xbc>
+    iunlockput(ip);
+80103a80:	83 ec 0c             	sub    $0xc,%esp
+80103a83:	56                   	push   %esi
+80103a84:	e8 d3 f6 ff ff       	call   8010315c <iunlockput>
+80103a89:	83 c4 10             	add    $0x10,%esp
+    ip = next;
+80103a8c:	89 fe                	mov    %edi,%esi
+  while((path = skipelem(path, name)) != 0){
+80103a8e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103a91:	89 d8                	mov    %ebx,%eax
+80103a93:	e8 17 e4 ff ff       	call   80101eaf <skipelem>
+80103a98:	89 c3                	mov    %eax,%ebx
+80103a9a:	85 c0                	test   %eax,%eax
+80103a9c:	74 3c                	je     80103ada <namex+0xcc>
+    ilock(ip);
+80103a9e:	83 ec 0c             	sub    $0xc,%esp
+80103aa1:	56                   	push   %esi
+80103aa2:	e8 7a f4 ff ff       	call   80102f21 <ilock>
+    if(ip->type != T_DIR){
+80103aa7:	83 c4 10             	add    $0x10,%esp
+80103aaa:	66 83 7e 5c 01       	cmpw   $0x1,0x5c(%esi)
+80103aaf:	75 9d                	jne    80103a4e <namex+0x40>
+    if(nameiparent && *path == '\0'){
+80103ab1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80103ab5:	74 b2                	je     80103a69 <namex+0x5b>
+80103ab7:	80 3b 00             	cmpb   $0x0,(%ebx)
+80103aba:	75 ad                	jne    80103a69 <namex+0x5b>
+      iunlock(ip);
+80103abc:	83 ec 0c             	sub    $0xc,%esp
+80103abf:	56                   	push   %esi
+80103ac0:	e8 31 f5 ff ff       	call   80102ff6 <iunlock>
+      return ip;
+80103ac5:	83 c4 10             	add    $0x10,%esp
+80103ac8:	eb 95                	jmp    80103a5f <namex+0x51>
+      iunlockput(ip);
+80103aca:	83 ec 0c             	sub    $0xc,%esp
+80103acd:	56                   	push   %esi
+80103ace:	e8 89 f6 ff ff       	call   8010315c <iunlockput>
+      return 0;
+80103ad3:	83 c4 10             	add    $0x10,%esp
+80103ad6:	89 fe                	mov    %edi,%esi
+80103ad8:	eb 85                	jmp    80103a5f <namex+0x51>
+  if(nameiparent){
+80103ada:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80103ade:	0f 84 7b ff ff ff    	je     80103a5f <namex+0x51>
+    iput(ip);
+80103ae4:	83 ec 0c             	sub    $0xc,%esp
+80103ae7:	56                   	push   %esi
+80103ae8:	e8 92 f5 ff ff       	call   8010307f <iput>
+    return 0;
+80103aed:	83 c4 10             	add    $0x10,%esp
+80103af0:	89 de                	mov    %ebx,%esi
+80103af2:	e9 68 ff ff ff       	jmp    80103a5f <namex+0x51>
+
+80103af7 <dirlink>:
+{
+80103af7:	55                   	push   %ebp
+80103af8:	89 e5                	mov    %esp,%ebp
+80103afa:	57                   	push   %edi
+80103afb:	56                   	push   %esi
+80103afc:	53                   	push   %ebx
+80103afd:	83 ec 20             	sub    $0x20,%esp
+80103b00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80103b03:	6a 00                	push   $0x0
+80103b05:	ff 75 0c             	push   0xc(%ebp)
+80103b08:	53                   	push   %ebx
+80103b09:	e8 32 fd ff ff       	call   80103840 <dirlookup>
+80103b0e:	83 c4 10             	add    $0x10,%esp
+80103b11:	85 c0                	test   %eax,%eax
+80103b13:	75 38                	jne    80103b4d <dirlink+0x56>
+  off = dp->ndirhash ? dp->dirfree : 0;
+80103b15:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+80103b1b:	85 c0                	test   %eax,%eax
+80103b1d:	74 06                	je     80103b25 <dirlink+0x2e>
+80103b1f:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+  for(; off < dp->size; off += sizeof(de)){
+80103b25:	89 c6                	mov    %eax,%esi
+80103b27:	3b 43 64             	cmp    0x64(%ebx),%eax
+80103b2a:	73 41                	jae    80103b6d <dirlink+0x76>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103b2c:	6a 10                	push   $0x10
+80103b2e:	50                   	push   %eax
+80103b2f:	8d 45 d8             	lea    -0x28(%ebp),%eax
+80103b32:	50                   	push   %eax
+80103b33:	53                   	push   %ebx
+80103b34:	e8 f0 f6 ff ff       	call   80103229 <readi>
+80103b39:	83 c4 10             	add    $0x10,%esp
+80103b3c:	83 f8 10             	cmp    $0x10,%eax
+80103b3f:	75 1f                	jne    80103b60 <dirlink+0x69>
+    if(de.inum == 0)
+80103b41:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80103b46:	74 25                	je     80103b6d <dirlink+0x76>
+  for(; off < dp->size; off += sizeof(de)){
+80103b48:	8d 46 10             	lea    0x10(%esi),%eax
+80103b4b:	eb d8                	jmp    80103b25 <dirlink+0x2e>
+    iput(ip);
+80103b4d:	83 ec 0c             	sub    $0xc,%esp
+80103b50:	50                   	push   %eax
+80103b51:	e8 29 f5 ff ff       	call   8010307f <iput>
+    return -1;
+80103b56:	83 c4 10             	add    $0x10,%esp
+80103b59:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103b5e:	eb 52                	jmp    80103bb2 <dirlink+0xbb>
+      panic("dirlink read");
+80103b60:	83 ec 0c             	sub    $0xc,%esp
+80103b63:	68 51 bf 10 80       	push   $0x8010bf51
+80103b68:	e8 89 d0 ff ff       	call   80100bf6 <panic>
+  strncpy(de.name, name, DIRSIZ);
+80103b6d:	83 ec 04             	sub    $0x4,%esp
+80103b70:	6a 0e                	push   $0xe
+80103b72:	ff 75 0c             	push   0xc(%ebp)
+80103b75:	8d 7d d8             	lea    -0x28(%ebp),%edi
+80103b78:	8d 45 da             	lea    -0x26(%ebp),%eax
+80103b7b:	50                   	push   %eax
+80103b7c:	e8 30 4c 00 00       	call   801087b1 <strncpy>
+  de.inum = inum;
+80103b81:	0f b7 45 10          	movzwl 0x10(%ebp),%eax
+80103b85:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103b89:	6a 10                	push   $0x10
+80103b8b:	56                   	push   %esi
+80103b8c:	57                   	push   %edi
+80103b8d:	53                   	push   %ebx
+80103b8e:	e8 c1 fa ff ff       	call   80103654 <writei>
+80103b93:	83 c4 20             	add    $0x20,%esp
+80103b96:	83 f8 10             	cmp    $0x10,%eax
+80103b99:	75 1f                	jne    80103bba <dirlink+0xc3>
+  dcacheput(dp, name, inum);
+80103b9b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80103b9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+80103ba1:	89 d8                	mov    %ebx,%eax
+80103ba3:	e8 b0 ed ff ff       	call   80102958 <dcacheput>
+  if(dp->ndirhash){
+80103ba8:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+80103bae:	85 c0                	test   %eax,%eax
+80103bb0:	75 15                	jne    80103bc7 <dirlink+0xd0>
+}
+80103bb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103bb5:	5b                   	pop    %ebx
+80103bb6:	5e                   	pop    %esi
+80103bb7:	5f                   	pop    %edi
+80103bb8:	5d                   	pop    %ebp
+80103bb9:	c3                   	ret
+    panic("dirlink");
+80103bba:	83 ec 0c             	sub    $0xc,%esp
+80103bbd:	68 c0 c9 10 80       	push   $0x8010c9c0
+80103bc2:	e8 2f d0 ff ff       	call   80100bf6 <panic>
+    dp->dirfree = off + sizeof(de);
+80103bc7:	8d 46 10             	lea    0x10(%esi),%eax
+80103bca:	89 83 f8 00 00 00    	mov    %eax,0xf8(%ebx)
+    dirindexadd(dp, name, off);
+80103bd0:	89 f1                	mov    %esi,%ecx
+80103bd2:	8b 55 0c             	mov    0xc(%ebp),%edx
+80103bd5:	89 d8                	mov    %ebx,%eax
+80103bd7:	e8 38 e2 ff ff       	call   80101e14 <dirindexadd>
+    if(2 * dp->dirused > dp->ndirhash * DIRSLOTS)
+80103bdc:	8b 83 f4 00 00 00    	mov    0xf4(%ebx),%eax
+80103be2:	01 c0                	add    %eax,%eax
+80103be4:	8b 93 f0 00 00 00    	mov    0xf0(%ebx),%edx
+80103bea:	c1 e2 0a             	shl    $0xa,%edx
+80103bed:	39 c2                	cmp    %eax,%edx
+80103bef:	72 07                	jb     80103bf8 <dirlink+0x101>
+  return 0;
+80103bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+80103bf6:	eb ba                	jmp    80103bb2 <dirlink+0xbb>
+      dirindex(dp);
+80103bf8:	89 d8                	mov    %ebx,%eax
+80103bfa:	e8 f7 eb ff ff       	call   801027f6 <dirindex>
+  return 0;
+80103bff:	b8 00 00 00 00       	mov    $0x0,%eax
+80103c04:	eb ac                	jmp    80103bb2 <dirlink+0xbb>
+
+80103c06 <dirunlink>:
+{
+80103c06:	55                   	push   %ebp
+80103c07:	89 e5                	mov    %esp,%ebp
+80103c09:	57                   	push   %edi
+80103c0a:	56                   	push   %esi
+80103c0b:	53                   	push   %ebx
+80103c0c:	83 ec 2c             	sub    $0x2c,%esp
+80103c0f:	8b 75 08             	mov    0x8(%ebp),%esi
+80103c12:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103c15:	6a 10                	push   $0x10
+80103c17:	57                   	push   %edi
+80103c18:	8d 45 d8             	lea    -0x28(%ebp),%eax
+80103c1b:	50                   	push   %eax
+80103c1c:	56                   	push   %esi
+80103c1d:	e8 07 f6 ff ff       	call   80103229 <readi>
+80103c22:	83 c4 10             	add    $0x10,%esp
+80103c25:	83 f8 10             	cmp    $0x10,%eax
+80103c28:	75 4d                	jne    80103c77 <dirunlink+0x71>
+  if(dp->ndirhash){
+80103c2a:	8b 86 f0 00 00 00    	mov    0xf0(%esi),%eax
+80103c30:	85 c0                	test   %eax,%eax
+80103c32:	74 64                	je     80103c98 <dirunlink+0x92>
+    n = dp->ndirhash * DIRSLOTS;
+80103c34:	c1 e0 0a             	shl    $0xa,%eax
+80103c37:	89 c3                	mov    %eax,%ebx
+80103c39:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    for(i = dirhash(de.name) % n; (v = *dirslot(dp, i)) != 0; i = (i + 1) % n){
+80103c3c:	8d 45 da             	lea    -0x26(%ebp),%eax
+80103c3f:	e8 76 e1 ff ff       	call   80101dba <dirhash>
+80103c44:	ba 00 00 00 00       	mov    $0x0,%edx
+80103c49:	f7 f3                	div    %ebx
+80103c4b:	89 d3                	mov    %edx,%ebx
+80103c4d:	89 da                	mov    %ebx,%edx
+80103c4f:	89 f0                	mov    %esi,%eax
+80103c51:	e8 9a e1 ff ff       	call   80101df0 <dirslot>
+80103c56:	8b 08                	mov    (%eax),%ecx
+80103c58:	85 c9                	test   %ecx,%ecx
+80103c5a:	74 2e                	je     80103c8a <dirunlink+0x84>
+      if(v == off / sizeof(de) + 1){
+80103c5c:	89 fa                	mov    %edi,%edx
+80103c5e:	c1 ea 04             	shr    $0x4,%edx
+80103c61:	83 c2 01             	add    $0x1,%edx
+80103c64:	39 ca                	cmp    %ecx,%edx
+80103c66:	74 1c                	je     80103c84 <dirunlink+0x7e>
+    for(i = dirhash(de.name) % n; (v = *dirslot(dp, i)) != 0; i = (i + 1) % n){
+80103c68:	8d 43 01             	lea    0x1(%ebx),%eax
+80103c6b:	ba 00 00 00 00       	mov    $0x0,%edx
+80103c70:	f7 75 d4             	divl   -0x2c(%ebp)
+80103c73:	89 d3                	mov    %edx,%ebx
+80103c75:	eb d6                	jmp    80103c4d <dirunlink+0x47>
+    panic("dirunlink read");
+80103c77:	83 ec 0c             	sub    $0xc,%esp
+80103c7a:	68 5e bf 10 80       	push   $0x8010bf5e
+80103c7f:	e8 72 cf ff ff       	call   80100bf6 <panic>
+        *dirslot(dp, i) = DIRDEL;
+80103c84:	c7 00 ff ff ff ff    	movl   $0xffffffff,(%eax)
+    if(off < dp->dirfree)
+80103c8a:	3b be f8 00 00 00    	cmp    0xf8(%esi),%edi
+80103c90:	73 06                	jae    80103c98 <dirunlink+0x92>
+      dp->dirfree = off;
+80103c92:	89 be f8 00 00 00    	mov    %edi,0xf8(%esi)
+  dcacheput(dp, de.name, 0);
+80103c98:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+80103c9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+80103ca0:	8d 55 da             	lea    -0x26(%ebp),%edx
+80103ca3:	89 f0                	mov    %esi,%eax
+80103ca5:	e8 ae ec ff ff       	call   80102958 <dcacheput>
+  memset(&de, 0, sizeof(de));
+80103caa:	83 ec 04             	sub    $0x4,%esp
+80103cad:	6a 10                	push   $0x10
+80103caf:	6a 00                	push   $0x0
+80103cb1:	53                   	push   %ebx
+80103cb2:	e8 d7 49 00 00       	call   8010868e <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103cb7:	6a 10                	push   $0x10
+80103cb9:	57                   	push   %edi
+80103cba:	53                   	push   %ebx
+80103cbb:	56                   	push   %esi
+80103cbc:	e8 93 f9 ff ff       	call   80103654 <writei>
+80103cc1:	83 c4 20             	add    $0x20,%esp
+80103cc4:	83 f8 10             	cmp    $0x10,%eax
+80103cc7:	75 08                	jne    80103cd1 <dirunlink+0xcb>
+}
+80103cc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103ccc:	5b                   	pop    %ebx
+80103ccd:	5e                   	pop    %esi
+80103cce:	5f                   	pop    %edi
+80103ccf:	5d                   	pop    %ebp
+80103cd0:	c3                   	ret
+    panic("unlink: writei");
+80103cd1:	83 ec 0c             	sub    $0xc,%esp
+80103cd4:	68 6d bf 10 80       	push   $0x8010bf6d
+80103cd9:	e8 18 cf ff ff       	call   80100bf6 <panic>
+
+80103cde <namei>:
+
+struct inode*
+namei(char *path)
+{
+80103cde:	55                   	push   %ebp
+80103cdf:	89 e5                	mov    %esp,%ebp
+80103ce1:	83 ec 18             	sub    $0x18,%esp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80103ce4:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+80103ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+80103cec:	8b 45 08             	mov    0x8(%ebp),%eax
+80103cef:	e8 1a fd ff ff       	call   80103a0e <namex>
+}
+80103cf4:	c9                   	leave
+80103cf5:	c3                   	ret
+
+80103cf6 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80103cf6:	55                   	push   %ebp
+80103cf7:	89 e5                	mov    %esp,%ebp
+80103cf9:	83 ec 08             	sub    $0x8,%esp
+  return namex(path, 1, name);
+80103cfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80103cff:	ba 01 00 00 00       	mov    $0x1,%edx
+80103d04:	8b 45 08             	mov    0x8(%ebp),%eax
+80103d07:	e8 02 fd ff ff       	call   80103a0e <namex>
+}
+80103d0c:	c9                   	leave
+80103d0d:	c3                   	ret
+
+80103d0e <idewait>:
+static void idestart(void);
+
+// Wait for IDE disk to become ready.
+static int
+idewait(int checkerr)
+{
+80103d0e:	89 c1                	mov    %eax,%ecx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103d10:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80103d15:	ec                   	in     (%dx),%al
+  int r;
+
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80103d16:	89 c2                	mov    %eax,%edx
+80103d18:	83 e2 c0             	and    $0xffffffc0,%edx
+80103d1b:	80 fa 40             	cmp    $0x40,%dl
+80103d1e:	75 f0                	jne    80103d10 <idewait+0x2>
+    ;
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+80103d20:	85 c9                	test   %ecx,%ecx
+80103d22:	74 09                	je     80103d2d <idewait+0x1f>
+80103d24:	a8 21                	test   $0x21,%al
+80103d26:	75 08                	jne    80103d30 <idewait+0x22>
+    return -1;
+  return 0;
+80103d28:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+80103d2d:	89 c8                	mov    %ecx,%eax
+80103d2f:	c3                   	ret
+    return -1;
+80103d30:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+80103d35:	eb f6                	jmp    80103d2d <idewait+0x1f>
+
+80103d37 <idepio>:
+// IDE_MAXSECT sectors with READ/WRITE MULTIPLE, one sector
+// without -- between the data port and the queued bufs.
+// Caller must hold idelock.
+static void
+idepio(int write)
+{
+80103d37:	55                   	push   %ebp
+80103d38:	89 e5                	mov    %esp,%ebp
+80103d3a:	57                   	push   %edi
+80103d3b:	56                   	push   %esi
+80103d3c:	53                   	push   %ebx
+80103d3d:	89 c3                	mov    %eax,%ebx
+  struct buf *b;
+  char *p;
+  int i, n, spb = BSIZE/SECTOR_SIZE;
+
+  n = idenbatch*spb - idesect;
+80103d3f:	a1 44 df 11 80       	mov    0x8011df44,%eax
+80103d44:	c1 e0 03             	shl    $0x3,%eax
+80103d47:	2b 05 30 df 11 80    	sub    0x8011df30,%eax
+  if(idemulti && n > IDE_MAXSECT)
+80103d4d:	8b 15 34 df 11 80    	mov    0x8011df34,%edx
+80103d53:	85 d2                	test   %edx,%edx
+80103d55:	74 05                	je     80103d5c <idepio+0x25>
+80103d57:	83 f8 10             	cmp    $0x10,%eax
+80103d5a:	7f 0b                	jg     80103d67 <idepio+0x30>
+    n = IDE_MAXSECT;
+  else if(!idemulti)
+80103d5c:	85 d2                	test   %edx,%edx
+80103d5e:	75 4b                	jne    80103dab <idepio+0x74>
+    n = 1;
+80103d60:	b8 01 00 00 00       	mov    $0x1,%eax
+80103d65:	eb 44                	jmp    80103dab <idepio+0x74>
+    n = IDE_MAXSECT;
+80103d67:	b8 10 00 00 00       	mov    $0x10,%eax
+80103d6c:	eb 3d                	jmp    80103dab <idepio+0x74>
+  for(; n > 0; n--, idesect++){
+    for(b = idequeue, i = idesect/spb; i > 0; i--)
+      b = b->qnext;
+80103d6e:	8b 49 5c             	mov    0x5c(%ecx),%ecx
+    for(b = idequeue, i = idesect/spb; i > 0; i--)
+80103d71:	83 ea 01             	sub    $0x1,%edx
+80103d74:	85 d2                	test   %edx,%edx
+80103d76:	7f f6                	jg     80103d6e <idepio+0x37>
+    p = (char*)b->data + (idesect%spb)*SECTOR_SIZE;
+80103d78:	89 f2                	mov    %esi,%edx
+80103d7a:	c1 fa 1f             	sar    $0x1f,%edx
+80103d7d:	c1 ea 1d             	shr    $0x1d,%edx
+80103d80:	8d 3c 16             	lea    (%esi,%edx,1),%edi
+80103d83:	83 e7 07             	and    $0x7,%edi
+80103d86:	29 d7                	sub    %edx,%edi
+80103d88:	c1 e7 09             	shl    $0x9,%edi
+80103d8b:	03 79 60             	add    0x60(%ecx),%edi
+    if(write)
+80103d8e:	85 db                	test   %ebx,%ebx
+80103d90:	74 36                	je     80103dc8 <idepio+0x91>
+  asm volatile("cld; rep outsl" :
+80103d92:	89 fe                	mov    %edi,%esi
+80103d94:	b9 80 00 00 00       	mov    $0x80,%ecx
+80103d99:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80103d9e:	fc                   	cld
+80103d9f:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+  for(; n > 0; n--, idesect++){
+80103da1:	83 e8 01             	sub    $0x1,%eax
+80103da4:	83 05 30 df 11 80 01 	addl   $0x1,0x8011df30
+80103dab:	85 c0                	test   %eax,%eax
+80103dad:	7e 28                	jle    80103dd7 <idepio+0xa0>
+    for(b = idequeue, i = idesect/spb; i > 0; i--)
+80103daf:	8b 0d 48 df 11 80    	mov    0x8011df48,%ecx
+80103db5:	8b 35 30 df 11 80    	mov    0x8011df30,%esi
+80103dbb:	8d 56 07             	lea    0x7(%esi),%edx
+80103dbe:	85 f6                	test   %esi,%esi
+80103dc0:	0f 49 d6             	cmovns %esi,%edx
+80103dc3:	c1 fa 03             	sar    $0x3,%edx
+80103dc6:	eb ac                	jmp    80103d74 <idepio+0x3d>
+  asm volatile("cld; rep insl" :
+80103dc8:	b9 80 00 00 00       	mov    $0x80,%ecx
+80103dcd:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80103dd2:	fc                   	cld
+80103dd3:	f3 6d                	rep insl (%dx),%es:(%edi)
+}
+80103dd5:	eb ca                	jmp    80103da1 <idepio+0x6a>
+      outsl(0x1f0, p, SECTOR_SIZE/4);
+    else
+      insl(0x1f0, p, SECTOR_SIZE/4);
+  }
+}
+80103dd7:	5b                   	pop    %ebx
+80103dd8:	5e                   	pop    %esi
+80103dd9:	5f                   	pop    %edi
+80103dda:	5d                   	pop    %ebp
+80103ddb:	c3                   	ret
+
+80103ddc <idebefore>:
+
+//PAGEBREAK!
+// Does a come before b in the C-SCAN sweep starting at idepos?
+static int
+idebefore(struct buf *a, struct buf *b)
+{
+80103ddc:	55                   	push   %ebp
+80103ddd:	89 e5                	mov    %esp,%ebp
+80103ddf:	57                   	push   %edi
+80103de0:	56                   	push   %esi
+80103de1:	53                   	push   %ebx
+80103de2:	83 ec 08             	sub    $0x8,%esp
+80103de5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+80103de8:	89 d6                	mov    %edx,%esi
+  int wrapa = a->blockno < idepos;
+80103dea:	8b 48 08             	mov    0x8(%eax),%ecx
+80103ded:	8b 1d 40 df 11 80    	mov    0x8011df40,%ebx
+80103df3:	39 d9                	cmp    %ebx,%ecx
+80103df5:	0f 92 c2             	setb   %dl
+80103df8:	89 d7                	mov    %edx,%edi
+  int wrapb = b->blockno < idepos;
+80103dfa:	8b 56 08             	mov    0x8(%esi),%edx
+80103dfd:	39 da                	cmp    %ebx,%edx
+80103dff:	0f 92 45 f3          	setb   -0xd(%ebp)
+80103e03:	0f 92 c3             	setb   %bl
+80103e06:	0f b6 db             	movzbl %bl,%ebx
+
+  if(wrapa != wrapb)
+80103e09:	89 f8                	mov    %edi,%eax
+80103e0b:	3a 45 f3             	cmp    -0xd(%ebp),%al
+80103e0e:	75 0a                	jne    80103e1a <idebefore+0x3e>
+    return wrapb;
+  if(a->blockno != b->blockno)
+80103e10:	39 d1                	cmp    %edx,%ecx
+80103e12:	74 10                	je     80103e24 <idebefore+0x48>
+    return a->blockno < b->blockno;
+80103e14:	0f 92 c3             	setb   %bl
+80103e17:	0f b6 db             	movzbl %bl,%ebx
+  return a->dev < b->dev;
+}
+80103e1a:	89 d8                	mov    %ebx,%eax
+80103e1c:	83 c4 08             	add    $0x8,%esp
+80103e1f:	5b                   	pop    %ebx
+80103e20:	5e                   	pop    %esi
+80103e21:	5f                   	pop    %edi
+80103e22:	5d                   	pop    %ebp
+80103e23:	c3                   	ret
+  return a->dev < b->dev;
+80103e24:	8b 46 04             	mov    0x4(%esi),%eax
+80103e27:	8b 7d ec             	mov    -0x14(%ebp),%edi
+80103e2a:	39 47 04             	cmp    %eax,0x4(%edi)
+80103e2d:	0f 92 c3             	setb   %bl
+80103e30:	0f b6 db             	movzbl %bl,%ebx
+80103e33:	eb e5                	jmp    80103e1a <idebefore+0x3e>
+
+80103e35 <idestart>:
+{
+80103e35:	55                   	push   %ebp
+80103e36:	89 e5                	mov    %esp,%ebp
+80103e38:	57                   	push   %edi
+80103e39:	56                   	push   %esi
+80103e3a:	53                   	push   %ebx
+80103e3b:	83 ec 1c             	sub    $0x1c,%esp
+  if((b = idequeue) == 0)
+80103e3e:	8b 1d 48 df 11 80    	mov    0x8011df48,%ebx
+80103e44:	85 db                	test   %ebx,%ebx
+80103e46:	74 64                	je     80103eac <idestart+0x77>
+  if(b->blockno >= FSSIZE)
+80103e48:	8b 53 08             	mov    0x8(%ebx),%edx
+80103e4b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+80103e51:	77 66                	ja     80103eb9 <idestart+0x84>
+  if(sector_per_block > idemaxsect)
+80103e53:	a1 38 df 11 80       	mov    0x8011df38,%eax
+80103e58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103e5b:	83 f8 07             	cmp    $0x7,%eax
+80103e5e:	7e 66                	jle    80103ec6 <idestart+0x91>
+  for(n = 1, q = b; q->qnext && (n+1)*sector_per_block <= idemaxsect; n++, q = q->qnext){
+80103e60:	89 d8                	mov    %ebx,%eax
+80103e62:	bf 01 00 00 00       	mov    $0x1,%edi
+80103e67:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80103e6a:	89 c2                	mov    %eax,%edx
+80103e6c:	8b 40 5c             	mov    0x5c(%eax),%eax
+80103e6f:	85 c0                	test   %eax,%eax
+80103e71:	74 60                	je     80103ed3 <idestart+0x9e>
+80103e73:	8d 4f 01             	lea    0x1(%edi),%ecx
+80103e76:	8d 34 cd 00 00 00 00 	lea    0x0(,%ecx,8),%esi
+80103e7d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+80103e80:	7c 51                	jl     80103ed3 <idestart+0x9e>
+    if(q->qnext->dev != b->dev || q->qnext->blockno != q->blockno+1 ||
+80103e82:	8b 73 04             	mov    0x4(%ebx),%esi
+80103e85:	39 70 04             	cmp    %esi,0x4(%eax)
+80103e88:	75 49                	jne    80103ed3 <idestart+0x9e>
+80103e8a:	8b 70 08             	mov    0x8(%eax),%esi
+80103e8d:	8b 52 08             	mov    0x8(%edx),%edx
+80103e90:	83 c2 01             	add    $0x1,%edx
+80103e93:	39 d6                	cmp    %edx,%esi
+80103e95:	75 3c                	jne    80103ed3 <idestart+0x9e>
+80103e97:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+80103e9d:	77 34                	ja     80103ed3 <idestart+0x9e>
+       (q->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+80103e9f:	8b 13                	mov    (%ebx),%edx
+80103ea1:	33 10                	xor    (%eax),%edx
+       q->qnext->blockno >= FSSIZE ||
+80103ea3:	f6 c2 04             	test   $0x4,%dl
+80103ea6:	75 2b                	jne    80103ed3 <idestart+0x9e>
+  for(n = 1, q = b; q->qnext && (n+1)*sector_per_block <= idemaxsect; n++, q = q->qnext){
+80103ea8:	89 cf                	mov    %ecx,%edi
+80103eaa:	eb be                	jmp    80103e6a <idestart+0x35>
+    panic("idestart");
+80103eac:	83 ec 0c             	sub    $0xc,%esp
+80103eaf:	68 cf bf 10 80       	push   $0x8010bfcf
+80103eb4:	e8 3d cd ff ff       	call   80100bf6 <panic>
+    panic("incorrect blockno");
+80103eb9:	83 ec 0c             	sub    $0xc,%esp
+80103ebc:	68 d8 bf 10 80       	push   $0x8010bfd8
+80103ec1:	e8 30 cd ff ff       	call   80100bf6 <panic>
+    panic("idestart");
+80103ec6:	83 ec 0c             	sub    $0xc,%esp
+80103ec9:	68 cf bf 10 80       	push   $0x8010bfcf
+80103ece:	e8 23 cd ff ff       	call   80100bf6 <panic>
+  idenbatch = n;
+80103ed3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80103ed6:	89 3d 44 df 11 80    	mov    %edi,0x8011df44
+  idepos = b->blockno;
+80103edc:	89 15 40 df 11 80    	mov    %edx,0x8011df40
+  idesect = 0;
+80103ee2:	c7 05 30 df 11 80 00 	movl   $0x0,0x8011df30
+80103ee9:	00 00 00 
+  nsect = n * sector_per_block;
+80103eec:	8d 04 fd 00 00 00 00 	lea    0x0(,%edi,8),%eax
+80103ef3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  sector = b->blockno * sector_per_block;
+80103ef6:	8d 0c d5 00 00 00 00 	lea    0x0(,%edx,8),%ecx
+80103efd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  int read_cmd = (nsect > 1 && idemulti) ? IDE_CMD_RDMUL : IDE_CMD_READ;
+80103f00:	83 f8 01             	cmp    $0x1,%eax
+80103f03:	7e 22                	jle    80103f27 <idestart+0xf2>
+80103f05:	a1 34 df 11 80       	mov    0x8011df34,%eax
+80103f0a:	85 c0                	test   %eax,%eax
+80103f0c:	74 12                	je     80103f20 <idestart+0xeb>
+80103f0e:	be c4 00 00 00       	mov    $0xc4,%esi
+  int write_cmd = (nsect > 1 && idemulti) ? IDE_CMD_WRMUL : IDE_CMD_WRITE;
+80103f13:	85 c0                	test   %eax,%eax
+80103f15:	74 48                	je     80103f5f <idestart+0x12a>
+80103f17:	c7 45 d8 c5 00 00 00 	movl   $0xc5,-0x28(%ebp)
+80103f1e:	eb 13                	jmp    80103f33 <idestart+0xfe>
+  int read_cmd = (nsect > 1 && idemulti) ? IDE_CMD_RDMUL : IDE_CMD_READ;
+80103f20:	be 20 00 00 00       	mov    $0x20,%esi
+80103f25:	eb ec                	jmp    80103f13 <idestart+0xde>
+80103f27:	be 20 00 00 00       	mov    $0x20,%esi
+  int write_cmd = (nsect > 1 && idemulti) ? IDE_CMD_WRMUL : IDE_CMD_WRITE;
+80103f2c:	c7 45 d8 30 00 00 00 	movl   $0x30,-0x28(%ebp)
+  int dmadir = (b->flags & B_DIRTY) ? 0 : BM_READ;
+80103f33:	f6 03 04             	testb  $0x4,(%ebx)
+80103f36:	74 30                	je     80103f68 <idestart+0x133>
+80103f38:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  idedma = idebm && !idepioretry;
+80103f3f:	0f b7 0d 24 df 11 80 	movzwl 0x8011df24,%ecx
+80103f46:	66 85 c9             	test   %cx,%cx
+80103f49:	74 26                	je     80103f71 <idestart+0x13c>
+80103f4b:	83 3d 28 df 11 80 00 	cmpl   $0x0,0x8011df28
+80103f52:	0f 84 bd 00 00 00    	je     80104015 <idestart+0x1e0>
+80103f58:	b8 00 00 00 00       	mov    $0x0,%eax
+80103f5d:	eb 17                	jmp    80103f76 <idestart+0x141>
+  int write_cmd = (nsect > 1 && idemulti) ? IDE_CMD_WRMUL : IDE_CMD_WRITE;
+80103f5f:	c7 45 d8 30 00 00 00 	movl   $0x30,-0x28(%ebp)
+80103f66:	eb cb                	jmp    80103f33 <idestart+0xfe>
+  int dmadir = (b->flags & B_DIRTY) ? 0 : BM_READ;
+80103f68:	c7 45 e0 08 00 00 00 	movl   $0x8,-0x20(%ebp)
+80103f6f:	eb ce                	jmp    80103f3f <idestart+0x10a>
+  idedma = idebm && !idepioretry;
+80103f71:	b8 00 00 00 00       	mov    $0x0,%eax
+80103f76:	a3 2c df 11 80       	mov    %eax,0x8011df2c
+  if(idedma){
+80103f7b:	85 c0                	test   %eax,%eax
+80103f7d:	0f 85 9c 00 00 00    	jne    8010401f <idestart+0x1ea>
+  idewait(0);
+80103f83:	b8 00 00 00 00       	mov    $0x0,%eax
+80103f88:	e8 81 fd ff ff       	call   80103d0e <idewait>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+80103f92:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80103f97:	ee                   	out    %al,(%dx)
+80103f98:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80103f9d:	0f b6 45 dc          	movzbl -0x24(%ebp),%eax
+80103fa1:	ee                   	out    %al,(%dx)
+80103fa2:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80103fa7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80103faa:	89 c8                	mov    %ecx,%eax
+80103fac:	ee                   	out    %al,(%dx)
+  outb(0x1f4, (sector >> 8) & 0xff);
+80103fad:	0f b6 c5             	movzbl %ch,%eax
+80103fb0:	ba f4 01 00 00       	mov    $0x1f4,%edx
+80103fb5:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+80103fb6:	89 c8                	mov    %ecx,%eax
+80103fb8:	c1 f8 10             	sar    $0x10,%eax
+80103fbb:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80103fc0:	ee                   	out    %al,(%dx)
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80103fc1:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+80103fc5:	c1 e0 04             	shl    $0x4,%eax
+80103fc8:	83 e0 10             	and    $0x10,%eax
+80103fcb:	c1 f9 18             	sar    $0x18,%ecx
+80103fce:	89 ca                	mov    %ecx,%edx
+80103fd0:	83 e2 0f             	and    $0xf,%edx
+80103fd3:	09 d0                	or     %edx,%eax
+80103fd5:	83 c8 e0             	or     $0xffffffe0,%eax
+80103fd8:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80103fdd:	ee                   	out    %al,(%dx)
+  if(idedma){
+80103fde:	83 3d 2c df 11 80 00 	cmpl   $0x0,0x8011df2c
+80103fe5:	0f 84 af 00 00 00    	je     8010409a <idestart+0x265>
+    outb(0x1f7, (b->flags & B_DIRTY) ? write_cmd : read_cmd);
+80103feb:	f6 03 04             	testb  $0x4,(%ebx)
+80103fee:	0f 84 9c 00 00 00    	je     80104090 <idestart+0x25b>
+80103ff4:	0f b6 45 d8          	movzbl -0x28(%ebp),%eax
+80103ff8:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80103ffd:	ee                   	out    %al,(%dx)
+    outb(idebm + BM_CMD, dmadir | BM_START);
+80103ffe:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+80104002:	83 c8 01             	or     $0x1,%eax
+80104005:	0f b7 15 24 df 11 80 	movzwl 0x8011df24,%edx
+8010400c:	ee                   	out    %al,(%dx)
+}
+8010400d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104010:	5b                   	pop    %ebx
+80104011:	5e                   	pop    %esi
+80104012:	5f                   	pop    %edi
+80104013:	5d                   	pop    %ebp
+80104014:	c3                   	ret
+  idedma = idebm && !idepioretry;
+80104015:	b8 01 00 00 00       	mov    $0x1,%eax
+8010401a:	e9 57 ff ff ff       	jmp    80103f76 <idestart+0x141>
+    for(i = 0, q = b; i < n; i++, q = q->qnext){
+8010401f:	89 de                	mov    %ebx,%esi
+80104021:	b8 00 00 00 00       	mov    $0x0,%eax
+80104026:	66 89 4d d8          	mov    %cx,-0x28(%ebp)
+8010402a:	39 f8                	cmp    %edi,%eax
+8010402c:	7d 28                	jge    80104056 <idestart+0x221>
+      ideprdt[i].addr = V2P(q->data);
+8010402e:	8b 15 20 df 11 80    	mov    0x8011df20,%edx
+80104034:	8d 14 c2             	lea    (%edx,%eax,8),%edx
+80104037:	8b 4e 60             	mov    0x60(%esi),%ecx
+8010403a:	81 c1 00 00 00 80    	add    $0x80000000,%ecx
+80104040:	89 0a                	mov    %ecx,(%edx)
+      ideprdt[i].count = BSIZE;
+80104042:	66 c7 42 04 00 10    	movw   $0x1000,0x4(%edx)
+      ideprdt[i].flags = 0;
+80104048:	66 c7 42 06 00 00    	movw   $0x0,0x6(%edx)
+    for(i = 0, q = b; i < n; i++, q = q->qnext){
+8010404e:	83 c0 01             	add    $0x1,%eax
+80104051:	8b 76 5c             	mov    0x5c(%esi),%esi
+80104054:	eb d4                	jmp    8010402a <idestart+0x1f5>
+    ideprdt[n-1].flags = PRD_EOT;
+80104056:	0f b7 4d d8          	movzwl -0x28(%ebp),%ecx
+8010405a:	a1 20 df 11 80       	mov    0x8011df20,%eax
+8010405f:	66 c7 44 f8 fe 00 80 	movw   $0x8000,-0x2(%eax,%edi,8)
+    outl(idebm + BM_PRDT, V2P(ideprdt));
+80104066:	05 00 00 00 80       	add    $0x80000000,%eax
+8010406b:	8d 51 04             	lea    0x4(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010406e:	ef                   	out    %eax,(%dx)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010406f:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+80104073:	89 ca                	mov    %ecx,%edx
+80104075:	ee                   	out    %al,(%dx)
+    outb(idebm + BM_STATUS, BM_ERR | BM_INTR);
+80104076:	8d 51 02             	lea    0x2(%ecx),%edx
+80104079:	b8 06 00 00 00       	mov    $0x6,%eax
+8010407e:	ee                   	out    %al,(%dx)
+    write_cmd = IDE_CMD_WRDMA;
+8010407f:	c7 45 d8 ca 00 00 00 	movl   $0xca,-0x28(%ebp)
+    read_cmd = IDE_CMD_RDDMA;
+80104086:	be c8 00 00 00       	mov    $0xc8,%esi
+8010408b:	e9 f3 fe ff ff       	jmp    80103f83 <idestart+0x14e>
+80104090:	89 f0                	mov    %esi,%eax
+80104092:	0f b6 c0             	movzbl %al,%eax
+80104095:	e9 5e ff ff ff       	jmp    80103ff8 <idestart+0x1c3>
+  } else if(b->flags & B_DIRTY){
+8010409a:	f6 03 04             	testb  $0x4,(%ebx)
+8010409d:	75 0d                	jne    801040ac <idestart+0x277>
+8010409f:	ba f7 01 00 00       	mov    $0x1f7,%edx
+801040a4:	89 f0                	mov    %esi,%eax
+801040a6:	ee                   	out    %al,(%dx)
+}
+801040a7:	e9 61 ff ff ff       	jmp    8010400d <idestart+0x1d8>
+801040ac:	ba f7 01 00 00       	mov    $0x1f7,%edx
+801040b1:	0f b6 45 d8          	movzbl -0x28(%ebp),%eax
+801040b5:	ee                   	out    %al,(%dx)
+    idepio(1);
+801040b6:	b8 01 00 00 00       	mov    $0x1,%eax
+801040bb:	e8 77 fc ff ff       	call   80103d37 <idepio>
+801040c0:	e9 48 ff ff ff       	jmp    8010400d <idestart+0x1d8>
+
+801040c5 <idequeueadd>:
+
+// Add b to idequeue in sweep order, behind the active request.
+// Caller must hold idelock.
+static void
+idequeueadd(struct buf *b)
+{
+801040c5:	55                   	push   %ebp
+801040c6:	89 e5                	mov    %esp,%ebp
+801040c8:	57                   	push   %edi
+801040c9:	56                   	push   %esi
+801040ca:	53                   	push   %ebx
+801040cb:	83 ec 18             	sub    $0x18,%esp
+801040ce:	89 c7                	mov    %eax,%edi
+  struct buf **pp;
+  int i;
+
+  if(!holdingsleep(&b->lock))
+801040d0:	8d 40 0c             	lea    0xc(%eax),%eax
+801040d3:	50                   	push   %eax
+801040d4:	e8 9e 43 00 00       	call   80108477 <holdingsleep>
+801040d9:	83 c4 10             	add    $0x10,%esp
+801040dc:	85 c0                	test   %eax,%eax
+801040de:	74 25                	je     80104105 <idequeueadd+0x40>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+801040e0:	8b 07                	mov    (%edi),%eax
+801040e2:	83 e0 06             	and    $0x6,%eax
+801040e5:	83 f8 02             	cmp    $0x2,%eax
+801040e8:	74 28                	je     80104112 <idequeueadd+0x4d>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+801040ea:	83 7f 04 00          	cmpl   $0x0,0x4(%edi)
+801040ee:	74 4e                	je     8010413e <idequeueadd+0x79>
+801040f0:	83 3d 3c df 11 80 00 	cmpl   $0x0,0x8011df3c
+801040f7:	74 26                	je     8010411f <idequeueadd+0x5a>
+801040f9:	b8 00 00 00 00       	mov    $0x0,%eax
+801040fe:	bb 48 df 11 80       	mov    $0x8011df48,%ebx
+80104103:	eb 2f                	jmp    80104134 <idequeueadd+0x6f>
+    panic("iderw: buf not locked");
+80104105:	83 ec 0c             	sub    $0xc,%esp
+80104108:	68 ea bf 10 80       	push   $0x8010bfea
+8010410d:	e8 e4 ca ff ff       	call   80100bf6 <panic>
+    panic("iderw: nothing to do");
+80104112:	83 ec 0c             	sub    $0xc,%esp
+80104115:	68 00 c0 10 80       	push   $0x8010c000
+8010411a:	e8 d7 ca ff ff       	call   80100bf6 <panic>
+    panic("iderw: ide disk 1 not present");
+8010411f:	83 ec 0c             	sub    $0xc,%esp
+80104122:	68 15 c0 10 80       	push   $0x8010c015
+80104127:	e8 ca ca ff ff       	call   80100bf6 <panic>
+
+  pp = &idequeue;
+  for(i = 0; i < idenbatch; i++)
+    pp = &(*pp)->qnext;
+8010412c:	8b 1b                	mov    (%ebx),%ebx
+8010412e:	83 c3 5c             	add    $0x5c,%ebx
+  for(i = 0; i < idenbatch; i++)
+80104131:	83 c0 01             	add    $0x1,%eax
+80104134:	39 05 44 df 11 80    	cmp    %eax,0x8011df44
+8010413a:	7f f0                	jg     8010412c <idequeueadd+0x67>
+8010413c:	eb 0f                	jmp    8010414d <idequeueadd+0x88>
+8010413e:	b8 00 00 00 00       	mov    $0x0,%eax
+80104143:	bb 48 df 11 80       	mov    $0x8011df48,%ebx
+80104148:	eb ea                	jmp    80104134 <idequeueadd+0x6f>
+  for(; *pp && !idebefore(b, *pp); pp = &(*pp)->qnext)  //DOC:insert-queue
+8010414a:	8d 5e 5c             	lea    0x5c(%esi),%ebx
+8010414d:	8b 33                	mov    (%ebx),%esi
+8010414f:	85 f6                	test   %esi,%esi
+80104151:	74 0d                	je     80104160 <idequeueadd+0x9b>
+80104153:	89 f2                	mov    %esi,%edx
+80104155:	89 f8                	mov    %edi,%eax
+80104157:	e8 80 fc ff ff       	call   80103ddc <idebefore>
+8010415c:	85 c0                	test   %eax,%eax
+8010415e:	74 ea                	je     8010414a <idequeueadd+0x85>
+    ;
+  b->qnext = *pp;
+80104160:	89 77 5c             	mov    %esi,0x5c(%edi)
+  *pp = b;
+80104163:	89 3b                	mov    %edi,(%ebx)
+}
+80104165:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104168:	5b                   	pop    %ebx
+80104169:	5e                   	pop    %esi
+8010416a:	5f                   	pop    %edi
+8010416b:	5d                   	pop    %ebp
+8010416c:	c3                   	ret
+
+8010416d <ideinit>:
+{
+8010416d:	55                   	push   %ebp
+8010416e:	89 e5                	mov    %esp,%ebp
+80104170:	53                   	push   %ebx
+80104171:	83 ec 1c             	sub    $0x1c,%esp
+  initlock(&idelock, "ide");
+80104174:	68 33 c0 10 80       	push   $0x8010c033
+80104179:	68 60 df 11 80       	push   $0x8011df60
+8010417e:	e8 1b 43 00 00       	call   8010849e <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80104183:	83 c4 08             	add    $0x8,%esp
+80104186:	a1 04 a3 13 80       	mov    0x8013a304,%eax
+8010418b:	83 e8 01             	sub    $0x1,%eax
+8010418e:	50                   	push   %eax
+8010418f:	6a 0e                	push   $0xe
+80104191:	e8 fc 04 00 00       	call   80104692 <ioapicenable>
+  idewait(0);
+80104196:	b8 00 00 00 00       	mov    $0x0,%eax
+8010419b:	e8 6e fb ff ff       	call   80103d0e <idewait>
+801041a0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+801041a5:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801041aa:	ee                   	out    %al,(%dx)
+  for(i=0; i<1000; i++){
+801041ab:	83 c4 10             	add    $0x10,%esp
+801041ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+801041b3:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+801041b9:	7f 19                	jg     801041d4 <ideinit+0x67>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801041bb:	ba f7 01 00 00       	mov    $0x1f7,%edx
+801041c0:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+801041c1:	84 c0                	test   %al,%al
+801041c3:	75 05                	jne    801041ca <ideinit+0x5d>
+  for(i=0; i<1000; i++){
+801041c5:	83 c1 01             	add    $0x1,%ecx
+801041c8:	eb e9                	jmp    801041b3 <ideinit+0x46>
+      havedisk1 = 1;
+801041ca:	c7 05 3c df 11 80 01 	movl   $0x1,0x8011df3c
+801041d1:	00 00 00 
+  if(pcifind(PCI_CLASS, 0xFFFF8000, 0x01018000, &bdf) == 0 &&
+801041d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801041d7:	50                   	push   %eax
+801041d8:	68 00 80 01 01       	push   $0x1018000
+801041dd:	68 00 80 ff ff       	push   $0xffff8000
+801041e2:	6a 08                	push   $0x8
+801041e4:	e8 84 16 00 00       	call   8010586d <pcifind>
+801041e9:	83 c4 10             	add    $0x10,%esp
+801041ec:	85 c0                	test   %eax,%eax
+801041ee:	74 26                	je     80104216 <ideinit+0xa9>
+  idemaxsect = IDE_MAXSECT;
+801041f0:	c7 05 38 df 11 80 10 	movl   $0x10,0x8011df38
+801041f7:	00 00 00 
+  idemulti = 1;
+801041fa:	c7 05 34 df 11 80 01 	movl   $0x1,0x8011df34
+80104201:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104204:	b8 02 00 00 00       	mov    $0x2,%eax
+80104209:	ba f6 03 00 00       	mov    $0x3f6,%edx
+8010420e:	ee                   	out    %al,(%dx)
+  for(i = 0; i <= havedisk1; i++){
+8010420f:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104214:	eb 69                	jmp    8010427f <ideinit+0x112>
+     ((bar = pciread(bdf, PCI_BAR(4))) & PCI_BAR_IO) &&
+80104216:	83 ec 08             	sub    $0x8,%esp
+80104219:	6a 20                	push   $0x20
+8010421b:	ff 75 f4             	push   -0xc(%ebp)
+8010421e:	e8 f9 15 00 00       	call   8010581c <pciread>
+80104223:	89 c3                	mov    %eax,%ebx
+  if(pcifind(PCI_CLASS, 0xFFFF8000, 0x01018000, &bdf) == 0 &&
+80104225:	83 c4 10             	add    $0x10,%esp
+80104228:	a8 01                	test   $0x1,%al
+8010422a:	74 c4                	je     801041f0 <ideinit+0x83>
+     (ideprdt = (struct prd*)kalloc()) != 0){
+8010422c:	e8 ff 08 00 00       	call   80104b30 <kalloc>
+80104231:	a3 20 df 11 80       	mov    %eax,0x8011df20
+     ((bar = pciread(bdf, PCI_BAR(4))) & PCI_BAR_IO) &&
+80104236:	85 c0                	test   %eax,%eax
+80104238:	74 b6                	je     801041f0 <ideinit+0x83>
+             pciread(bdf, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+8010423a:	83 ec 08             	sub    $0x8,%esp
+8010423d:	6a 04                	push   $0x4
+8010423f:	ff 75 f4             	push   -0xc(%ebp)
+80104242:	e8 d5 15 00 00       	call   8010581c <pciread>
+    pciwrite(bdf, PCI_COMMAND,
+80104247:	83 c4 0c             	add    $0xc,%esp
+8010424a:	83 c8 05             	or     $0x5,%eax
+8010424d:	50                   	push   %eax
+8010424e:	6a 04                	push   $0x4
+80104250:	ff 75 f4             	push   -0xc(%ebp)
+80104253:	e8 eb 15 00 00       	call   80105843 <pciwrite>
+    idebm = bar & 0xFFFC;
+80104258:	83 e3 fc             	and    $0xfffffffc,%ebx
+8010425b:	66 89 1d 24 df 11 80 	mov    %bx,0x8011df24
+    idemaxsect = IDE_DMAMAXSECT;
+80104262:	c7 05 38 df 11 80 80 	movl   $0x80,0x8011df38
+80104269:	00 00 00 
+8010426c:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80104271:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80104276:	ee                   	out    %al,(%dx)
+    return;
+80104277:	83 c4 10             	add    $0x10,%esp
+8010427a:	eb 5e                	jmp    801042da <ideinit+0x16d>
+  for(i = 0; i <= havedisk1; i++){
+8010427c:	83 c3 01             	add    $0x1,%ebx
+8010427f:	39 1d 3c df 11 80    	cmp    %ebx,0x8011df3c
+80104285:	7c 48                	jl     801042cf <ideinit+0x162>
+    outb(0x1f6, 0xe0 | (i<<4));
+80104287:	89 d8                	mov    %ebx,%eax
+80104289:	c1 e0 04             	shl    $0x4,%eax
+8010428c:	83 c8 e0             	or     $0xffffffe0,%eax
+8010428f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80104294:	ee                   	out    %al,(%dx)
+80104295:	b8 10 00 00 00       	mov    $0x10,%eax
+8010429a:	ba f2 01 00 00       	mov    $0x1f2,%edx
+8010429f:	ee                   	out    %al,(%dx)
+801042a0:	b8 c6 ff ff ff       	mov    $0xffffffc6,%eax
+801042a5:	ba f7 01 00 00       	mov    $0x1f7,%edx
+801042aa:	ee                   	out    %al,(%dx)
+    if(idewait(1) < 0){
+801042ab:	b8 01 00 00 00       	mov    $0x1,%eax
+801042b0:	e8 59 fa ff ff       	call   80103d0e <idewait>
+801042b5:	85 c0                	test   %eax,%eax
+801042b7:	79 c3                	jns    8010427c <ideinit+0x10f>
+      idemaxsect = BSIZE/SECTOR_SIZE;
+801042b9:	c7 05 38 df 11 80 08 	movl   $0x8,0x8011df38
+801042c0:	00 00 00 
+      idemulti = 0;
+801042c3:	c7 05 34 df 11 80 00 	movl   $0x0,0x8011df34
+801042ca:	00 00 00 
+801042cd:	eb ad                	jmp    8010427c <ideinit+0x10f>
+801042cf:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+801042d4:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801042d9:	ee                   	out    %al,(%dx)
+}
+801042da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801042dd:	c9                   	leave
+801042de:	c3                   	ret
+
+801042df <ideintr>:
+{
+801042df:	55                   	push   %ebp
+801042e0:	89 e5                	mov    %esp,%ebp
+801042e2:	57                   	push   %edi
+801042e3:	56                   	push   %esi
+801042e4:	53                   	push   %ebx
+801042e5:	83 ec 18             	sub    $0x18,%esp
+  acquire(&idelock);
+801042e8:	68 60 df 11 80       	push   $0x8011df60
+801042ed:	e8 f0 42 00 00       	call   801085e2 <acquire>
+  if((b = idequeue) == 0 || idenbatch == 0){
+801042f2:	8b 1d 48 df 11 80    	mov    0x8011df48,%ebx
+801042f8:	83 c4 10             	add    $0x10,%esp
+801042fb:	85 db                	test   %ebx,%ebx
+801042fd:	74 59                	je     80104358 <ideintr+0x79>
+801042ff:	83 3d 44 df 11 80 00 	cmpl   $0x0,0x8011df44
+80104306:	74 50                	je     80104358 <ideintr+0x79>
+  if(idedma){
+80104308:	83 3d 2c df 11 80 00 	cmpl   $0x0,0x8011df2c
+8010430f:	0f 84 9d 00 00 00    	je     801043b2 <ideintr+0xd3>
+    if(((st = inb(idebm + BM_STATUS)) & BM_INTR) == 0){
+80104315:	0f b7 3d 24 df 11 80 	movzwl 0x8011df24,%edi
+8010431c:	8d 4f 02             	lea    0x2(%edi),%ecx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010431f:	89 ca                	mov    %ecx,%edx
+80104321:	ec                   	in     (%dx),%al
+80104322:	89 c6                	mov    %eax,%esi
+80104324:	a8 04                	test   $0x4,%al
+80104326:	74 48                	je     80104370 <ideintr+0x91>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104328:	b8 00 00 00 00       	mov    $0x0,%eax
+8010432d:	89 fa                	mov    %edi,%edx
+8010432f:	ee                   	out    %al,(%dx)
+80104330:	b8 06 00 00 00       	mov    $0x6,%eax
+80104335:	89 ca                	mov    %ecx,%edx
+80104337:	ee                   	out    %al,(%dx)
+    if(idewait(1) < 0 || (st & BM_ERR)){
+80104338:	b8 01 00 00 00       	mov    $0x1,%eax
+8010433d:	e8 cc f9 ff ff       	call   80103d0e <idewait>
+80104342:	85 c0                	test   %eax,%eax
+80104344:	78 3c                	js     80104382 <ideintr+0xa3>
+80104346:	f7 c6 02 00 00 00    	test   $0x2,%esi
+8010434c:	75 34                	jne    80104382 <ideintr+0xa3>
+{
+8010434e:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104353:	e9 ee 00 00 00       	jmp    80104446 <ideintr+0x167>
+    release(&idelock);
+80104358:	83 ec 0c             	sub    $0xc,%esp
+8010435b:	68 60 df 11 80       	push   $0x8011df60
+80104360:	e8 e2 42 00 00       	call   80108647 <release>
+    return;
+80104365:	83 c4 10             	add    $0x10,%esp
+}
+80104368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010436b:	5b                   	pop    %ebx
+8010436c:	5e                   	pop    %esi
+8010436d:	5f                   	pop    %edi
+8010436e:	5d                   	pop    %ebp
+8010436f:	c3                   	ret
+      release(&idelock);
+80104370:	83 ec 0c             	sub    $0xc,%esp
+80104373:	68 60 df 11 80       	push   $0x8011df60
+80104378:	e8 ca 42 00 00       	call   80108647 <release>
+      return;
+8010437d:	83 c4 10             	add    $0x10,%esp
+80104380:	eb e6                	jmp    80104368 <ideintr+0x89>
+      cprintf("ide: DMA error on block %d, retrying with PIO\n", b->blockno);
+80104382:	83 ec 08             	sub    $0x8,%esp
+80104385:	ff 73 08             	push   0x8(%ebx)
+80104388:	68 48 c0 10 80       	push   $0x8010c048
+8010438d:	e8 25 cb ff ff       	call   80100eb7 <cprintf>
+      idepioretry = 1;
+80104392:	c7 05 28 df 11 80 01 	movl   $0x1,0x8011df28
+80104399:	00 00 00 
+      idestart();
+8010439c:	e8 94 fa ff ff       	call   80103e35 <idestart>
+      release(&idelock);
+801043a1:	c7 04 24 60 df 11 80 	movl   $0x8011df60,(%esp)
+801043a8:	e8 9a 42 00 00       	call   80108647 <release>
+      return;
+801043ad:	83 c4 10             	add    $0x10,%esp
+801043b0:	eb b6                	jmp    80104368 <ideintr+0x89>
+    if(idewait(1) < 0)
+801043b2:	b8 01 00 00 00       	mov    $0x1,%eax
+801043b7:	e8 52 f9 ff ff       	call   80103d0e <idewait>
+801043bc:	85 c0                	test   %eax,%eax
+801043be:	78 33                	js     801043f3 <ideintr+0x114>
+    if(!(b->flags & B_DIRTY))
+801043c0:	f6 03 04             	testb  $0x4,(%ebx)
+801043c3:	74 3b                	je     80104400 <ideintr+0x121>
+    if(idesect < idenbatch*(BSIZE/SECTOR_SIZE)){
+801043c5:	a1 44 df 11 80       	mov    0x8011df44,%eax
+801043ca:	c1 e0 03             	shl    $0x3,%eax
+801043cd:	3b 05 30 df 11 80    	cmp    0x8011df30,%eax
+801043d3:	0f 8e 75 ff ff ff    	jle    8010434e <ideintr+0x6f>
+      if(b->flags & B_DIRTY)
+801043d9:	f6 03 04             	testb  $0x4,(%ebx)
+801043dc:	75 2e                	jne    8010440c <ideintr+0x12d>
+      release(&idelock);
+801043de:	83 ec 0c             	sub    $0xc,%esp
+801043e1:	68 60 df 11 80       	push   $0x8011df60
+801043e6:	e8 5c 42 00 00       	call   80108647 <release>
+      return;
+801043eb:	83 c4 10             	add    $0x10,%esp
+801043ee:	e9 75 ff ff ff       	jmp    80104368 <ideintr+0x89>
+      panic("ide: disk error");
+801043f3:	83 ec 0c             	sub    $0xc,%esp
+801043f6:	68 37 c0 10 80       	push   $0x8010c037
+801043fb:	e8 f6 c7 ff ff       	call   80100bf6 <panic>
+      idepio(0);
+80104400:	b8 00 00 00 00       	mov    $0x0,%eax
+80104405:	e8 2d f9 ff ff       	call   80103d37 <idepio>
+8010440a:	eb b9                	jmp    801043c5 <ideintr+0xe6>
+        idepio(1);
+8010440c:	b8 01 00 00 00       	mov    $0x1,%eax
+80104411:	e8 21 f9 ff ff       	call   80103d37 <idepio>
+80104416:	eb c6                	jmp    801043de <ideintr+0xff>
+    b = idequeue;
+80104418:	8b 15 48 df 11 80    	mov    0x8011df48,%edx
+    idequeue = b->qnext;
+8010441e:	8b 42 5c             	mov    0x5c(%edx),%eax
+80104421:	a3 48 df 11 80       	mov    %eax,0x8011df48
+    b->flags |= B_VALID;
+80104426:	8b 02                	mov    (%edx),%eax
+80104428:	89 c1                	mov    %eax,%ecx
+8010442a:	83 c9 02             	or     $0x2,%ecx
+8010442d:	89 0a                	mov    %ecx,(%edx)
+    b->flags &= ~(B_DIRTY|B_ASYNC);
+8010442f:	83 e0 f3             	and    $0xfffffff3,%eax
+80104432:	83 c8 02             	or     $0x2,%eax
+80104435:	89 02                	mov    %eax,(%edx)
+    wakeup(b);
+80104437:	83 ec 0c             	sub    $0xc,%esp
+8010443a:	52                   	push   %edx
+8010443b:	e8 09 2a 00 00       	call   80106e49 <wakeup>
+  for(i = 0; i < idenbatch; i++){
+80104440:	83 c3 01             	add    $0x1,%ebx
+80104443:	83 c4 10             	add    $0x10,%esp
+80104446:	39 1d 44 df 11 80    	cmp    %ebx,0x8011df44
+8010444c:	7f ca                	jg     80104418 <ideintr+0x139>
+  idenbatch = 0;
+8010444e:	c7 05 44 df 11 80 00 	movl   $0x0,0x8011df44
+80104455:	00 00 00 
+  idepioretry = 0;
+80104458:	c7 05 28 df 11 80 00 	movl   $0x0,0x8011df28
+8010445f:	00 00 00 
+  if(idequeue != 0)
+80104462:	83 3d 48 df 11 80 00 	cmpl   $0x0,0x8011df48
+80104469:	74 05                	je     80104470 <ideintr+0x191>
+    idestart();
+8010446b:	e8 c5 f9 ff ff       	call   80103e35 <idestart>
+  release(&idelock);
+80104470:	83 ec 0c             	sub    $0xc,%esp
+80104473:	68 60 df 11 80       	push   $0x8011df60
+80104478:	e8 ca 41 00 00       	call   80108647 <release>
+8010447d:	83 c4 10             	add    $0x10,%esp
+80104480:	e9 e3 fe ff ff       	jmp    80104368 <ideintr+0x89>
+
+80104485 <idereadahead>:
+// Start reading b from disk and return without waiting.
+// b is marked B_ASYNC until the read completes; the caller
+// should release it (brelse) rather than hold it meanwhile.
+void
+idereadahead(struct buf *b)
+{
+80104485:	55                   	push   %ebp
+80104486:	89 e5                	mov    %esp,%ebp
+80104488:	83 ec 0c             	sub    $0xc,%esp
+  if(virtiorw(&b, 1, 1) == 0)
+8010448b:	6a 01                	push   $0x1
+8010448d:	6a 01                	push   $0x1
+8010448f:	8d 45 08             	lea    0x8(%ebp),%eax
+80104492:	50                   	push   %eax
+80104493:	e8 19 68 00 00       	call   8010acb1 <virtiorw>
+80104498:	83 c4 10             	add    $0x10,%esp
+8010449b:	85 c0                	test   %eax,%eax
+8010449d:	75 02                	jne    801044a1 <idereadahead+0x1c>
+  b->flags |= B_ASYNC;
+  idequeueadd(b);
+  if(idenbatch == 0)
+    idestart();
+  release(&idelock);
+}
+8010449f:	c9                   	leave
+801044a0:	c3                   	ret
+  acquire(&idelock);
+801044a1:	83 ec 0c             	sub    $0xc,%esp
+801044a4:	68 60 df 11 80       	push   $0x8011df60
+801044a9:	e8 34 41 00 00       	call   801085e2 <acquire>
+  b->flags |= B_ASYNC;
+801044ae:	8b 55 08             	mov    0x8(%ebp),%edx
+801044b1:	8b 02                	mov    (%edx),%eax
+801044b3:	83 c8 08             	or     $0x8,%eax
+801044b6:	89 02                	mov    %eax,(%edx)
+  idequeueadd(b);
+801044b8:	8b 45 08             	mov    0x8(%ebp),%eax
+801044bb:	e8 05 fc ff ff       	call   801040c5 <idequeueadd>
+  if(idenbatch == 0)
+801044c0:	83 c4 10             	add    $0x10,%esp
+801044c3:	83 3d 44 df 11 80 00 	cmpl   $0x0,0x8011df44
+801044ca:	74 12                	je     801044de <idereadahead+0x59>
+  release(&idelock);
+801044cc:	83 ec 0c             	sub    $0xc,%esp
+801044cf:	68 60 df 11 80       	push   $0x8011df60
+801044d4:	e8 6e 41 00 00       	call   80108647 <release>
+801044d9:	83 c4 10             	add    $0x10,%esp
+801044dc:	eb c1                	jmp    8010449f <idereadahead+0x1a>
+    idestart();
+801044de:	e8 52 f9 ff ff       	call   80103e35 <idestart>
+801044e3:	eb e7                	jmp    801044cc <idereadahead+0x47>
+
+801044e5 <idewaitahead>:
+
+// Wait for a read-ahead into b to complete.
+void
+idewaitahead(struct buf *b)
+{
+801044e5:	55                   	push   %ebp
+801044e6:	89 e5                	mov    %esp,%ebp
+801044e8:	53                   	push   %ebx
+801044e9:	83 ec 10             	sub    $0x10,%esp
+801044ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(virtiowait(b) == 0)
+801044ef:	53                   	push   %ebx
+801044f0:	e8 21 69 00 00       	call   8010ae16 <virtiowait>
+801044f5:	83 c4 10             	add    $0x10,%esp
+801044f8:	85 c0                	test   %eax,%eax
+801044fa:	75 05                	jne    80104501 <idewaitahead+0x1c>
+    return;
+  acquire(&idelock);
+  while(b->flags & B_ASYNC)
+    sleep(b, &idelock);
+  release(&idelock);
+}
+801044fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801044ff:	c9                   	leave
+80104500:	c3                   	ret
+  acquire(&idelock);
+80104501:	83 ec 0c             	sub    $0xc,%esp
+80104504:	68 60 df 11 80       	push   $0x8011df60
+80104509:	e8 d4 40 00 00       	call   801085e2 <acquire>
+  while(b->flags & B_ASYNC)
+8010450e:	83 c4 10             	add    $0x10,%esp
+80104511:	eb 11                	jmp    80104524 <idewaitahead+0x3f>
+    sleep(b, &idelock);
+80104513:	83 ec 08             	sub    $0x8,%esp
+80104516:	68 60 df 11 80       	push   $0x8011df60
+8010451b:	53                   	push   %ebx
+8010451c:	e8 4b 33 00 00       	call   8010786c <sleep>
+80104521:	83 c4 10             	add    $0x10,%esp
+  while(b->flags & B_ASYNC)
+80104524:	f6 03 08             	testb  $0x8,(%ebx)
+80104527:	75 ea                	jne    80104513 <idewaitahead+0x2e>
+  release(&idelock);
+80104529:	83 ec 0c             	sub    $0xc,%esp
+8010452c:	68 60 df 11 80       	push   $0x8011df60
+80104531:	e8 11 41 00 00       	call   80108647 <release>
+80104536:	83 c4 10             	add    $0x10,%esp
+80104539:	eb c1                	jmp    801044fc <idewaitahead+0x17>
+
+8010453b <iderwv>:
+// For each buf:
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderwv(struct buf **bufs, int n)
+{
+8010453b:	55                   	push   %ebp
+8010453c:	89 e5                	mov    %esp,%ebp
+8010453e:	57                   	push   %edi
+8010453f:	56                   	push   %esi
+80104540:	53                   	push   %ebx
+80104541:	83 ec 10             	sub    $0x10,%esp
+80104544:	8b 75 08             	mov    0x8(%ebp),%esi
+80104547:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  if(virtiorw(bufs, n, 0) == 0)
+8010454a:	6a 00                	push   $0x0
+8010454c:	57                   	push   %edi
+8010454d:	56                   	push   %esi
+8010454e:	e8 5e 67 00 00       	call   8010acb1 <virtiorw>
+80104553:	83 c4 10             	add    $0x10,%esp
+80104556:	85 c0                	test   %eax,%eax
+80104558:	75 08                	jne    80104562 <iderwv+0x27>
+  for(i = 0; i < n; i++)
+    while((bufs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(bufs[i], &idelock);
+
+  release(&idelock);
+}
+8010455a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010455d:	5b                   	pop    %ebx
+8010455e:	5e                   	pop    %esi
+8010455f:	5f                   	pop    %edi
+80104560:	5d                   	pop    %ebp
+80104561:	c3                   	ret
+  acquire(&idelock);  //DOC:acquire-lock
+80104562:	83 ec 0c             	sub    $0xc,%esp
+80104565:	68 60 df 11 80       	push   $0x8011df60
+8010456a:	e8 73 40 00 00       	call   801085e2 <acquire>
+  for(i = 0; i < n; i++)
+8010456f:	83 c4 10             	add    $0x10,%esp
+80104572:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104577:	eb 0b                	jmp    80104584 <iderwv+0x49>
+    idequeueadd(bufs[i]);
+80104579:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+8010457c:	e8 44 fb ff ff       	call   801040c5 <idequeueadd>
+  for(i = 0; i < n; i++)
+80104581:	83 c3 01             	add    $0x1,%ebx
+80104584:	39 fb                	cmp    %edi,%ebx
+80104586:	7c f1                	jl     80104579 <iderwv+0x3e>
+  if(idenbatch == 0)
+80104588:	83 3d 44 df 11 80 00 	cmpl   $0x0,0x8011df44
+8010458f:	74 07                	je     80104598 <iderwv+0x5d>
+  for(i = 0; i < n; i++)
+80104591:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104596:	eb 28                	jmp    801045c0 <iderwv+0x85>
+    idestart();
+80104598:	e8 98 f8 ff ff       	call   80103e35 <idestart>
+8010459d:	eb f2                	jmp    80104591 <iderwv+0x56>
+      sleep(bufs[i], &idelock);
+8010459f:	83 ec 08             	sub    $0x8,%esp
+801045a2:	68 60 df 11 80       	push   $0x8011df60
+801045a7:	52                   	push   %edx
+801045a8:	e8 bf 32 00 00       	call   8010786c <sleep>
+801045ad:	83 c4 10             	add    $0x10,%esp
+    while((bufs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+801045b0:	8b 14 9e             	mov    (%esi,%ebx,4),%edx
+801045b3:	8b 02                	mov    (%edx),%eax
+801045b5:	83 e0 06             	and    $0x6,%eax
+801045b8:	83 f8 02             	cmp    $0x2,%eax
+801045bb:	75 e2                	jne    8010459f <iderwv+0x64>
+  for(i = 0; i < n; i++)
+801045bd:	83 c3 01             	add    $0x1,%ebx
+801045c0:	39 fb                	cmp    %edi,%ebx
+801045c2:	7c ec                	jl     801045b0 <iderwv+0x75>
+  release(&idelock);
+801045c4:	83 ec 0c             	sub    $0xc,%esp
+801045c7:	68 60 df 11 80       	push   $0x8011df60
+801045cc:	e8 76 40 00 00       	call   80108647 <release>
+801045d1:	83 c4 10             	add    $0x10,%esp
+801045d4:	eb 84                	jmp    8010455a <iderwv+0x1f>
+
+801045d6 <iderw>:
+
+// Sync buf with disk.
+void
+iderw(struct buf *b)
+{
+801045d6:	55                   	push   %ebp
+801045d7:	89 e5                	mov    %esp,%ebp
+801045d9:	83 ec 10             	sub    $0x10,%esp
+  iderwv(&b, 1);
+801045dc:	6a 01                	push   $0x1
+801045de:	8d 45 08             	lea    0x8(%ebp),%eax
+801045e1:	50                   	push   %eax
+801045e2:	e8 54 ff ff ff       	call   8010453b <iderwv>
+}
+801045e7:	83 c4 10             	add    $0x10,%esp
+801045ea:	c9                   	leave
+801045eb:	c3                   	ret
+
+801045ec <ioapicread>:
+};
+
+static uint
+ioapicread(int reg)
+{
+  ioapic->reg = reg;
+801045ec:	8b 15 94 df 11 80    	mov    0x8011df94,%edx
+801045f2:	89 02                	mov    %eax,(%edx)
+  return ioapic->data;
+801045f4:	a1 94 df 11 80       	mov    0x8011df94,%eax
+801045f9:	8b 40 10             	mov    0x10(%eax),%eax
+}
+801045fc:	c3                   	ret
+
+801045fd <ioapicwrite>:
+
+static void
+ioapicwrite(int reg, uint data)
+{
+  ioapic->reg = reg;
+801045fd:	8b 0d 94 df 11 80    	mov    0x8011df94,%ecx
+80104603:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80104605:	a1 94 df 11 80       	mov    0x8011df94,%eax
+8010460a:	89 50 10             	mov    %edx,0x10(%eax)
+}
+8010460d:	c3                   	ret
+
+8010460e <ioapicinit>:
+
+void
+ioapicinit(void)
+{
+8010460e:	55                   	push   %ebp
+8010460f:	89 e5                	mov    %esp,%ebp
+80104611:	57                   	push   %edi
+80104612:	56                   	push   %esi
+80104613:	53                   	push   %ebx
+80104614:	83 ec 0c             	sub    $0xc,%esp
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+80104617:	c7 05 94 df 11 80 00 	movl   $0xfec00000,0x8011df94
+8010461e:	00 c0 fe 
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+80104621:	b8 01 00 00 00       	mov    $0x1,%eax
+80104626:	e8 c1 ff ff ff       	call   801045ec <ioapicread>
+8010462b:	c1 e8 10             	shr    $0x10,%eax
+8010462e:	0f b6 f8             	movzbl %al,%edi
+  id = ioapicread(REG_ID) >> 24;
+80104631:	b8 00 00 00 00       	mov    $0x0,%eax
+80104636:	e8 b1 ff ff ff       	call   801045ec <ioapicread>
+8010463b:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+8010463e:	0f b6 15 00 a3 13 80 	movzbl 0x8013a300,%edx
+80104645:	39 c2                	cmp    %eax,%edx
+80104647:	75 07                	jne    80104650 <ioapicinit+0x42>
+{
+80104649:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010464e:	eb 36                	jmp    80104686 <ioapicinit+0x78>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80104650:	83 ec 0c             	sub    $0xc,%esp
+80104653:	68 78 c0 10 80       	push   $0x8010c078
+80104658:	e8 5a c8 ff ff       	call   80100eb7 <cprintf>
+8010465d:	83 c4 10             	add    $0x10,%esp
+80104660:	eb e7                	jmp    80104649 <ioapicinit+0x3b>
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+80104662:	8d 53 20             	lea    0x20(%ebx),%edx
+80104665:	81 ca 00 00 01 00    	or     $0x10000,%edx
+8010466b:	8d 74 1b 10          	lea    0x10(%ebx,%ebx,1),%esi
+8010466f:	89 f0                	mov    %esi,%eax
+80104671:	e8 87 ff ff ff       	call   801045fd <ioapicwrite>
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+80104676:	8d 46 01             	lea    0x1(%esi),%eax
+80104679:	ba 00 00 00 00       	mov    $0x0,%edx
+8010467e:	e8 7a ff ff ff       	call   801045fd <ioapicwrite>
+  for(i = 0; i <= maxintr; i++){
+80104683:	83 c3 01             	add    $0x1,%ebx
+80104686:	39 fb                	cmp    %edi,%ebx
+80104688:	7e d8                	jle    80104662 <ioapicinit+0x54>
+  }
+}
+8010468a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010468d:	5b                   	pop    %ebx
+8010468e:	5e                   	pop    %esi
+8010468f:	5f                   	pop    %edi
+80104690:	5d                   	pop    %ebp
+80104691:	c3                   	ret
+
+80104692 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80104692:	55                   	push   %ebp
+80104693:	89 e5                	mov    %esp,%ebp
+80104695:	53                   	push   %ebx
+80104696:	83 ec 04             	sub    $0x4,%esp
+80104699:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+8010469c:	8d 50 20             	lea    0x20(%eax),%edx
+8010469f:	8d 5c 00 10          	lea    0x10(%eax,%eax,1),%ebx
+801046a3:	89 d8                	mov    %ebx,%eax
+801046a5:	e8 53 ff ff ff       	call   801045fd <ioapicwrite>
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801046aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+801046ad:	c1 e2 18             	shl    $0x18,%edx
+801046b0:	8d 43 01             	lea    0x1(%ebx),%eax
+801046b3:	e8 45 ff ff ff       	call   801045fd <ioapicwrite>
+}
+801046b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801046bb:	c9                   	leave
+801046bc:	c3                   	ret
+
+801046bd <ioapicenablepci>:
+
+// Like ioapicenable, for a PCI INTx line: those are
+// level-triggered, active low, and may be shared.
+void
+ioapicenablepci(int irq, int cpunum)
+{
+801046bd:	55                   	push   %ebp
+801046be:	89 e5                	mov    %esp,%ebp
+801046c0:	53                   	push   %ebx
+801046c1:	83 ec 04             	sub    $0x4,%esp
+801046c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  ioapicwrite(REG_TABLE+2*irq, INT_LEVEL | INT_ACTIVELOW | (T_IRQ0 + irq));
+801046c7:	8d 50 20             	lea    0x20(%eax),%edx
+801046ca:	80 ce a0             	or     $0xa0,%dh
+801046cd:	8d 5c 00 10          	lea    0x10(%eax,%eax,1),%ebx
+801046d1:	89 d8                	mov    %ebx,%eax
+801046d3:	e8 25 ff ff ff       	call   801045fd <ioapicwrite>
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801046d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+801046db:	c1 e2 18             	shl    $0x18,%edx
+801046de:	8d 43 01             	lea    0x1(%ebx),%eax
+801046e1:	e8 17 ff ff ff       	call   801045fd <ioapicwrite>
+}
+801046e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801046e9:	c9                   	leave
+801046ea:	c3                   	ret
+
+801046eb <kdrain>:
+// Move the pages cached by every CPU back to kmem, so a CPU that
+// has run dry can use pages the others are holding on to.
+// Returns the number of pages moved.
+static int
+kdrain(void)
+{
+801046eb:	55                   	push   %ebp
+801046ec:	89 e5                	mov    %esp,%ebp
+801046ee:	57                   	push   %edi
+801046ef:	56                   	push   %esi
+801046f0:	53                   	push   %ebx
+801046f1:	83 ec 0c             	sub    $0xc,%esp
+  struct kcache *c;
+  struct run *r;
+  int n;
+
+  n = 0;
+801046f4:	be 00 00 00 00       	mov    $0x0,%esi
+  for(c = kcache; c < &kcache[NCPU]; c++){
+801046f9:	bb 00 a0 13 80       	mov    $0x8013a000,%ebx
+801046fe:	eb 47                	jmp    80104747 <kdrain+0x5c>
+    if(c->n == 0)
+      continue;
+    acquire(&c->lock);
+    acquire(&kmem.lock);
+    while((r = c->freelist) != 0){
+      c->freelist = r->next;
+80104700:	8b 10                	mov    (%eax),%edx
+80104702:	89 53 34             	mov    %edx,0x34(%ebx)
+      r->next = kmem.freelist;
+80104705:	8b 15 f8 df 11 80    	mov    0x8011dff8,%edx
+8010470b:	89 10                	mov    %edx,(%eax)
+      kmem.freelist = r;
+8010470d:	a3 f8 df 11 80       	mov    %eax,0x8011dff8
+      n++;
+80104712:	83 c6 01             	add    $0x1,%esi
+    while((r = c->freelist) != 0){
+80104715:	8b 43 34             	mov    0x34(%ebx),%eax
+80104718:	85 c0                	test   %eax,%eax
+8010471a:	75 e4                	jne    80104700 <kdrain+0x15>
+    }
+    kmem.nfree += c->n;
+8010471c:	8b 43 38             	mov    0x38(%ebx),%eax
+8010471f:	01 05 fc df 11 80    	add    %eax,0x8011dffc
+    c->n = 0;
+80104725:	c7 43 38 00 00 00 00 	movl   $0x0,0x38(%ebx)
+    release(&kmem.lock);
+8010472c:	83 ec 0c             	sub    $0xc,%esp
+8010472f:	68 c0 df 11 80       	push   $0x8011dfc0
+80104734:	e8 0e 3f 00 00       	call   80108647 <release>
+    release(&c->lock);
+80104739:	89 3c 24             	mov    %edi,(%esp)
+8010473c:	e8 06 3f 00 00       	call   80108647 <release>
+80104741:	83 c4 10             	add    $0x10,%esp
+  for(c = kcache; c < &kcache[NCPU]; c++){
+80104744:	83 c3 40             	add    $0x40,%ebx
+80104747:	81 fb 00 a2 13 80    	cmp    $0x8013a200,%ebx
+8010474d:	73 22                	jae    80104771 <kdrain+0x86>
+    if(c->n == 0)
+8010474f:	83 7b 38 00          	cmpl   $0x0,0x38(%ebx)
+80104753:	74 ef                	je     80104744 <kdrain+0x59>
+    acquire(&c->lock);
+80104755:	89 df                	mov    %ebx,%edi
+80104757:	83 ec 0c             	sub    $0xc,%esp
+8010475a:	53                   	push   %ebx
+8010475b:	e8 82 3e 00 00       	call   801085e2 <acquire>
+    acquire(&kmem.lock);
+80104760:	c7 04 24 c0 df 11 80 	movl   $0x8011dfc0,(%esp)
+80104767:	e8 76 3e 00 00       	call   801085e2 <acquire>
+    while((r = c->freelist) != 0){
+8010476c:	83 c4 10             	add    $0x10,%esp
+8010476f:	eb a4                	jmp    80104715 <kdrain+0x2a>
+  }
+  return n;
+}
+80104771:	89 f0                	mov    %esi,%eax
+80104773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104776:	5b                   	pop    %ebx
+80104777:	5e                   	pop    %esi
+80104778:	5f                   	pop    %edi
+80104779:	5d                   	pop    %ebp
+8010477a:	c3                   	ret
+
+8010477b <kalloc1>:
+{
+8010477b:	55                   	push   %ebp
+8010477c:	89 e5                	mov    %esp,%ebp
+8010477e:	57                   	push   %edi
+8010477f:	56                   	push   %esi
+80104780:	53                   	push   %ebx
+80104781:	83 ec 0c             	sub    $0xc,%esp
+  if(!kmem.use_lock){
+80104784:	83 3d f4 df 11 80 00 	cmpl   $0x0,0x8011dff4
+8010478b:	75 37                	jne    801047c4 <kalloc1+0x49>
+    r = kmem.freelist;
+8010478d:	8b 35 f8 df 11 80    	mov    0x8011dff8,%esi
+    if(r){
+80104793:	85 f6                	test   %esi,%esi
+80104795:	0f 84 9f 00 00 00    	je     8010483a <kalloc1+0xbf>
+      kmem.freelist = r->next;
+8010479b:	8b 06                	mov    (%esi),%eax
+8010479d:	a3 f8 df 11 80       	mov    %eax,0x8011dff8
+      kmem.nfree--;
+801047a2:	a1 fc df 11 80       	mov    0x8011dffc,%eax
+801047a7:	83 e8 01             	sub    $0x1,%eax
+801047aa:	a3 fc df 11 80       	mov    %eax,0x8011dffc
+      KREF(r) = 1;
+801047af:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+801047b5:	c1 e8 0c             	shr    $0xc,%eax
+801047b8:	66 c7 84 00 00 e0 11 	movw   $0x1,-0x7fee2000(%eax,%eax,1)
+801047bf:	80 01 00 
+    return (char*)r;
+801047c2:	eb 76                	jmp    8010483a <kalloc1+0xbf>
+  pushcli();
+801047c4:	e8 36 3d 00 00       	call   801084ff <pushcli>
+  c = &kcache[cpuid()];
+801047c9:	e8 63 21 00 00       	call   80106931 <cpuid>
+801047ce:	89 c3                	mov    %eax,%ebx
+  acquire(&c->lock);
+801047d0:	89 c7                	mov    %eax,%edi
+801047d2:	c1 e7 06             	shl    $0x6,%edi
+801047d5:	81 c7 00 a0 13 80    	add    $0x8013a000,%edi
+801047db:	83 ec 0c             	sub    $0xc,%esp
+801047de:	57                   	push   %edi
+801047df:	e8 fe 3d 00 00       	call   801085e2 <acquire>
+  if(c->freelist == 0){
+801047e4:	83 c4 10             	add    $0x10,%esp
+801047e7:	83 7f 34 00          	cmpl   $0x0,0x34(%edi)
+801047eb:	74 57                	je     80104844 <kalloc1+0xc9>
+  r = c->freelist;
+801047ed:	89 d8                	mov    %ebx,%eax
+801047ef:	c1 e0 06             	shl    $0x6,%eax
+801047f2:	8b b0 34 a0 13 80    	mov    -0x7fec5fcc(%eax),%esi
+  if(r){
+801047f8:	85 f6                	test   %esi,%esi
+801047fa:	74 2d                	je     80104829 <kalloc1+0xae>
+    c->freelist = r->next;
+801047fc:	8b 06                	mov    (%esi),%eax
+801047fe:	c1 e3 06             	shl    $0x6,%ebx
+80104801:	89 83 34 a0 13 80    	mov    %eax,-0x7fec5fcc(%ebx)
+    c->n--;
+80104807:	8b 83 38 a0 13 80    	mov    -0x7fec5fc8(%ebx),%eax
+8010480d:	83 e8 01             	sub    $0x1,%eax
+80104810:	89 83 38 a0 13 80    	mov    %eax,-0x7fec5fc8(%ebx)
+    KREF(r) = 1;
+80104816:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+8010481c:	c1 e8 0c             	shr    $0xc,%eax
+8010481f:	66 c7 84 00 00 e0 11 	movw   $0x1,-0x7fee2000(%eax,%eax,1)
+80104826:	80 01 00 
+  release(&c->lock);
+80104829:	83 ec 0c             	sub    $0xc,%esp
+8010482c:	57                   	push   %edi
+8010482d:	e8 15 3e 00 00       	call   80108647 <release>
+  popcli();
+80104832:	e8 0c 3d 00 00       	call   80108543 <popcli>
+  return (char*)r;
+80104837:	83 c4 10             	add    $0x10,%esp
+}
+8010483a:	89 f0                	mov    %esi,%eax
+8010483c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010483f:	5b                   	pop    %ebx
+80104840:	5e                   	pop    %esi
+80104841:	5f                   	pop    %edi
+80104842:	5d                   	pop    %ebp
+80104843:	c3                   	ret
+    acquire(&kmem.lock);
+80104844:	83 ec 0c             	sub    $0xc,%esp
+80104847:	68 c0 df 11 80       	push   $0x8011dfc0
+8010484c:	e8 91 3d 00 00       	call   801085e2 <acquire>
+    while(c->n < KBATCH && (r = kmem.freelist) != 0){
+80104851:	83 c4 10             	add    $0x10,%esp
+80104854:	eb 36                	jmp    8010488c <kalloc1+0x111>
+      kmem.freelist = r->next;
+80104856:	8b 02                	mov    (%edx),%eax
+80104858:	a3 f8 df 11 80       	mov    %eax,0x8011dff8
+      kmem.nfree--;
+8010485d:	a1 fc df 11 80       	mov    0x8011dffc,%eax
+80104862:	83 e8 01             	sub    $0x1,%eax
+80104865:	a3 fc df 11 80       	mov    %eax,0x8011dffc
+      r->next = c->freelist;
+8010486a:	89 d8                	mov    %ebx,%eax
+8010486c:	c1 e0 06             	shl    $0x6,%eax
+8010486f:	8b 88 34 a0 13 80    	mov    -0x7fec5fcc(%eax),%ecx
+80104875:	89 0a                	mov    %ecx,(%edx)
+      c->freelist = r;
+80104877:	89 90 34 a0 13 80    	mov    %edx,-0x7fec5fcc(%eax)
+      c->n++;
+8010487d:	8b 88 38 a0 13 80    	mov    -0x7fec5fc8(%eax),%ecx
+80104883:	8d 51 01             	lea    0x1(%ecx),%edx
+80104886:	89 90 38 a0 13 80    	mov    %edx,-0x7fec5fc8(%eax)
+    while(c->n < KBATCH && (r = kmem.freelist) != 0){
+8010488c:	89 d8                	mov    %ebx,%eax
+8010488e:	c1 e0 06             	shl    $0x6,%eax
+80104891:	83 b8 38 a0 13 80 1f 	cmpl   $0x1f,-0x7fec5fc8(%eax)
+80104898:	7f 0a                	jg     801048a4 <kalloc1+0x129>
+8010489a:	8b 15 f8 df 11 80    	mov    0x8011dff8,%edx
+801048a0:	85 d2                	test   %edx,%edx
+801048a2:	75 b2                	jne    80104856 <kalloc1+0xdb>
+    release(&kmem.lock);
+801048a4:	83 ec 0c             	sub    $0xc,%esp
+801048a7:	68 c0 df 11 80       	push   $0x8011dfc0
+801048ac:	e8 96 3d 00 00       	call   80108647 <release>
+801048b1:	83 c4 10             	add    $0x10,%esp
+801048b4:	e9 34 ff ff ff       	jmp    801047ed <kalloc1+0x72>
+
+801048b9 <kincref>:
+{
+801048b9:	55                   	push   %ebp
+801048ba:	89 e5                	mov    %esp,%ebp
+801048bc:	83 ec 08             	sub    $0x8,%esp
+801048bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+801048c2:	a9 ff 0f 00 00       	test   $0xfff,%eax
+801048c7:	75 23                	jne    801048ec <kincref+0x33>
+801048c9:	3d 10 60 14 80       	cmp    $0x80146010,%eax
+801048ce:	72 1c                	jb     801048ec <kincref+0x33>
+801048d0:	05 00 00 00 80       	add    $0x80000000,%eax
+801048d5:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+801048da:	77 10                	ja     801048ec <kincref+0x33>
+  __sync_fetch_and_add(&KREF(v), 1);
+801048dc:	c1 e8 0c             	shr    $0xc,%eax
+801048df:	01 c0                	add    %eax,%eax
+801048e1:	66 f0 83 80 00 e0 11 	lock addw $0x1,-0x7fee2000(%eax)
+801048e8:	80 01 
+}
+801048ea:	c9                   	leave
+801048eb:	c3                   	ret
+    panic("kincref");
+801048ec:	83 ec 0c             	sub    $0xc,%esp
+801048ef:	68 aa c0 10 80       	push   $0x8010c0aa
+801048f4:	e8 fd c2 ff ff       	call   80100bf6 <panic>
+
+801048f9 <krefcount>:
+{
+801048f9:	55                   	push   %ebp
+801048fa:	89 e5                	mov    %esp,%ebp
+  return KREF(v);
+801048fc:	8b 45 08             	mov    0x8(%ebp),%eax
+801048ff:	05 00 00 00 80       	add    $0x80000000,%eax
+80104904:	c1 e8 0c             	shr    $0xc,%eax
+80104907:	0f b7 84 00 00 e0 11 	movzwl -0x7fee2000(%eax,%eax,1),%eax
+8010490e:	80 
+}
+8010490f:	5d                   	pop    %ebp
+80104910:	c3                   	ret
+
+80104911 <kfree>:
+{
+80104911:	55                   	push   %ebp
+80104912:	89 e5                	mov    %esp,%ebp
+80104914:	57                   	push   %edi
+80104915:	56                   	push   %esi
+80104916:	53                   	push   %ebx
+80104917:	83 ec 1c             	sub    $0x1c,%esp
+8010491a:	8b 75 08             	mov    0x8(%ebp),%esi
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+8010491d:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+80104923:	75 42                	jne    80104967 <kfree+0x56>
+80104925:	81 fe 10 60 14 80    	cmp    $0x80146010,%esi
+8010492b:	72 3a                	jb     80104967 <kfree+0x56>
+8010492d:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80104933:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80104938:	77 2d                	ja     80104967 <kfree+0x56>
+  if(KREF(v) == 0)
+8010493a:	c1 e8 0c             	shr    $0xc,%eax
+8010493d:	66 83 bc 00 00 e0 11 	cmpw   $0x0,-0x7fee2000(%eax,%eax,1)
+80104944:	80 00 
+80104946:	74 2c                	je     80104974 <kfree+0x63>
+  if(__sync_sub_and_fetch(&KREF(v), 1) > 0)
+80104948:	8d 84 00 00 e0 11 80 	lea    -0x7fee2000(%eax,%eax,1),%eax
+8010494f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+80104954:	66 f0 0f c1 10       	lock xadd %dx,(%eax)
+80104959:	66 83 fa 01          	cmp    $0x1,%dx
+8010495d:	74 22                	je     80104981 <kfree+0x70>
+}
+8010495f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104962:	5b                   	pop    %ebx
+80104963:	5e                   	pop    %esi
+80104964:	5f                   	pop    %edi
+80104965:	5d                   	pop    %ebp
+80104966:	c3                   	ret
+    panic("kfree");
+80104967:	83 ec 0c             	sub    $0xc,%esp
+8010496a:	68 b2 c0 10 80       	push   $0x8010c0b2
+8010496f:	e8 82 c2 ff ff       	call   80100bf6 <panic>
+    panic("kfree: free page");
+80104974:	83 ec 0c             	sub    $0xc,%esp
+80104977:	68 b8 c0 10 80       	push   $0x8010c0b8
+8010497c:	e8 75 c2 ff ff       	call   80100bf6 <panic>
+  memset(v, 1, PGSIZE);
+80104981:	83 ec 04             	sub    $0x4,%esp
+80104984:	68 00 10 00 00       	push   $0x1000
+80104989:	6a 01                	push   $0x1
+8010498b:	56                   	push   %esi
+8010498c:	e8 fd 3c 00 00       	call   8010868e <memset>
+  if(!kmem.use_lock){
+80104991:	83 c4 10             	add    $0x10,%esp
+80104994:	83 3d f4 df 11 80 00 	cmpl   $0x0,0x8011dff4
+8010499b:	75 1c                	jne    801049b9 <kfree+0xa8>
+    r->next = kmem.freelist;
+8010499d:	a1 f8 df 11 80       	mov    0x8011dff8,%eax
+801049a2:	89 06                	mov    %eax,(%esi)
+    kmem.freelist = r;
+801049a4:	89 35 f8 df 11 80    	mov    %esi,0x8011dff8
+    kmem.nfree++;
+801049aa:	a1 fc df 11 80       	mov    0x8011dffc,%eax
+801049af:	83 c0 01             	add    $0x1,%eax
+801049b2:	a3 fc df 11 80       	mov    %eax,0x8011dffc
+    return;
+801049b7:	eb a6                	jmp    8010495f <kfree+0x4e>
+  pushcli();
+801049b9:	e8 41 3b 00 00       	call   801084ff <pushcli>
+  c = &kcache[cpuid()];
+801049be:	e8 6e 1f 00 00       	call   80106931 <cpuid>
+801049c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquire(&c->lock);
+801049c6:	89 c7                	mov    %eax,%edi
+801049c8:	c1 e7 06             	shl    $0x6,%edi
+801049cb:	81 c7 00 a0 13 80    	add    $0x8013a000,%edi
+801049d1:	83 ec 0c             	sub    $0xc,%esp
+801049d4:	57                   	push   %edi
+801049d5:	e8 08 3c 00 00       	call   801085e2 <acquire>
+  r->next = c->freelist;
+801049da:	8b 47 34             	mov    0x34(%edi),%eax
+801049dd:	89 06                	mov    %eax,(%esi)
+  c->freelist = r;
+801049df:	89 77 34             	mov    %esi,0x34(%edi)
+  if(++c->n > KCACHE){
+801049e2:	8b 57 38             	mov    0x38(%edi),%edx
+801049e5:	8d 42 01             	lea    0x1(%edx),%eax
+801049e8:	89 47 38             	mov    %eax,0x38(%edi)
+801049eb:	83 c4 10             	add    $0x10,%esp
+801049ee:	83 f8 40             	cmp    $0x40,%eax
+801049f1:	7f 6f                	jg     80104a62 <kfree+0x151>
+  release(&c->lock);
+801049f3:	83 ec 0c             	sub    $0xc,%esp
+801049f6:	57                   	push   %edi
+801049f7:	e8 4b 3c 00 00       	call   80108647 <release>
+  popcli();
+801049fc:	e8 42 3b 00 00       	call   80108543 <popcli>
+80104a01:	83 c4 10             	add    $0x10,%esp
+80104a04:	e9 56 ff ff ff       	jmp    8010495f <kfree+0x4e>
+      tail = tail->next;
+80104a09:	8b 1b                	mov    (%ebx),%ebx
+    for(head = tail = c->freelist, i = 1; i < KBATCH; i++)
+80104a0b:	83 c0 01             	add    $0x1,%eax
+80104a0e:	83 f8 1f             	cmp    $0x1f,%eax
+80104a11:	7e f6                	jle    80104a09 <kfree+0xf8>
+    c->freelist = tail->next;
+80104a13:	8b 0b                	mov    (%ebx),%ecx
+80104a15:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104a18:	c1 e0 06             	shl    $0x6,%eax
+80104a1b:	89 88 34 a0 13 80    	mov    %ecx,-0x7fec5fcc(%eax)
+    c->n -= KBATCH;
+80104a21:	83 ea 1f             	sub    $0x1f,%edx
+80104a24:	89 90 38 a0 13 80    	mov    %edx,-0x7fec5fc8(%eax)
+    acquire(&kmem.lock);
+80104a2a:	83 ec 0c             	sub    $0xc,%esp
+80104a2d:	68 c0 df 11 80       	push   $0x8011dfc0
+80104a32:	e8 ab 3b 00 00       	call   801085e2 <acquire>
+    tail->next = kmem.freelist;
+80104a37:	a1 f8 df 11 80       	mov    0x8011dff8,%eax
+80104a3c:	89 03                	mov    %eax,(%ebx)
+    kmem.freelist = head;
+80104a3e:	89 35 f8 df 11 80    	mov    %esi,0x8011dff8
+    kmem.nfree += KBATCH;
+80104a44:	a1 fc df 11 80       	mov    0x8011dffc,%eax
+80104a49:	83 c0 20             	add    $0x20,%eax
+80104a4c:	a3 fc df 11 80       	mov    %eax,0x8011dffc
+    release(&kmem.lock);
+80104a51:	c7 04 24 c0 df 11 80 	movl   $0x8011dfc0,(%esp)
+80104a58:	e8 ea 3b 00 00       	call   80108647 <release>
+80104a5d:	83 c4 10             	add    $0x10,%esp
+80104a60:	eb 91                	jmp    801049f3 <kfree+0xe2>
+    for(head = tail = c->freelist, i = 1; i < KBATCH; i++)
+80104a62:	89 f3                	mov    %esi,%ebx
+80104a64:	b8 01 00 00 00       	mov    $0x1,%eax
+80104a69:	eb a3                	jmp    80104a0e <kfree+0xfd>
+
+80104a6b <freerange>:
+{
+80104a6b:	55                   	push   %ebp
+80104a6c:	89 e5                	mov    %esp,%ebp
+80104a6e:	56                   	push   %esi
+80104a6f:	53                   	push   %ebx
+80104a70:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80104a73:	8b 45 08             	mov    0x8(%ebp),%eax
+80104a76:	05 ff 0f 00 00       	add    $0xfff,%eax
+80104a7b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104a80:	eb 21                	jmp    80104aa3 <freerange+0x38>
+    KREF(p) = 1;
+80104a82:	8d 90 00 00 00 80    	lea    -0x80000000(%eax),%edx
+80104a88:	c1 ea 0c             	shr    $0xc,%edx
+80104a8b:	66 c7 84 12 00 e0 11 	movw   $0x1,-0x7fee2000(%edx,%edx,1)
+80104a92:	80 01 00 
+    kfree(p);
+80104a95:	83 ec 0c             	sub    $0xc,%esp
+80104a98:	50                   	push   %eax
+80104a99:	e8 73 fe ff ff       	call   80104911 <kfree>
+80104a9e:	83 c4 10             	add    $0x10,%esp
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104aa1:	89 f0                	mov    %esi,%eax
+80104aa3:	8d b0 00 10 00 00    	lea    0x1000(%eax),%esi
+80104aa9:	39 f3                	cmp    %esi,%ebx
+80104aab:	73 d5                	jae    80104a82 <freerange+0x17>
+}
+80104aad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104ab0:	5b                   	pop    %ebx
+80104ab1:	5e                   	pop    %esi
+80104ab2:	5d                   	pop    %ebp
+80104ab3:	c3                   	ret
+
+80104ab4 <kinit1>:
+{
+80104ab4:	55                   	push   %ebp
+80104ab5:	89 e5                	mov    %esp,%ebp
+80104ab7:	53                   	push   %ebx
+80104ab8:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&kmem.lock, "kmem");
+80104abb:	68 c9 c0 10 80       	push   $0x8010c0c9
+80104ac0:	68 c0 df 11 80       	push   $0x8011dfc0
+80104ac5:	e8 d4 39 00 00       	call   8010849e <initlock>
+  for(c = kcache; c < &kcache[NCPU]; c++)
+80104aca:	83 c4 10             	add    $0x10,%esp
+80104acd:	bb 00 a0 13 80       	mov    $0x8013a000,%ebx
+80104ad2:	eb 14                	jmp    80104ae8 <kinit1+0x34>
+    initlock(&c->lock, "kcache");
+80104ad4:	83 ec 08             	sub    $0x8,%esp
+80104ad7:	68 ce c0 10 80       	push   $0x8010c0ce
+80104adc:	53                   	push   %ebx
+80104add:	e8 bc 39 00 00       	call   8010849e <initlock>
+  for(c = kcache; c < &kcache[NCPU]; c++)
+80104ae2:	83 c3 40             	add    $0x40,%ebx
+80104ae5:	83 c4 10             	add    $0x10,%esp
+80104ae8:	81 fb 00 a2 13 80    	cmp    $0x8013a200,%ebx
+80104aee:	72 e4                	jb     80104ad4 <kinit1+0x20>
+  kmem.use_lock = 0;
+80104af0:	c7 05 f4 df 11 80 00 	movl   $0x0,0x8011dff4
+80104af7:	00 00 00 
+  freerange(vstart, vend);
+80104afa:	83 ec 08             	sub    $0x8,%esp
+80104afd:	ff 75 0c             	push   0xc(%ebp)
+80104b00:	ff 75 08             	push   0x8(%ebp)
+80104b03:	e8 63 ff ff ff       	call   80104a6b <freerange>
+}
+80104b08:	83 c4 10             	add    $0x10,%esp
+80104b0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104b0e:	c9                   	leave
+80104b0f:	c3                   	ret
+
+80104b10 <kinit2>:
+{
+80104b10:	55                   	push   %ebp
+80104b11:	89 e5                	mov    %esp,%ebp
+80104b13:	83 ec 10             	sub    $0x10,%esp
+  freerange(vstart, vend);
+80104b16:	ff 75 0c             	push   0xc(%ebp)
+80104b19:	ff 75 08             	push   0x8(%ebp)
+80104b1c:	e8 4a ff ff ff       	call   80104a6b <freerange>
+  kmem.use_lock = 1;
+80104b21:	c7 05 f4 df 11 80 01 	movl   $0x1,0x8011dff4
+80104b28:	00 00 00 
+}
+80104b2b:	83 c4 10             	add    $0x10,%esp
+80104b2e:	c9                   	leave
+80104b2f:	c3                   	ret
+
+80104b30 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+80104b30:	55                   	push   %ebp
+80104b31:	89 e5                	mov    %esp,%ebp
+80104b33:	53                   	push   %ebx
+80104b34:	83 ec 04             	sub    $0x4,%esp
+  char *r;
+
+  // When out of pages, take back the other CPUs' cached pages,
+  // and failing that ask the buffer cache to give some back.
+  if((r = kalloc1()) == 0 && kmem.use_lock &&
+80104b37:	e8 3f fc ff ff       	call   8010477b <kalloc1>
+80104b3c:	89 c3                	mov    %eax,%ebx
+80104b3e:	85 c0                	test   %eax,%eax
+80104b40:	74 07                	je     80104b49 <kalloc+0x19>
+     (kdrain() > 0 || breclaim() == 0))
+    r = kalloc1();
+  return r;
+}
+80104b42:	89 d8                	mov    %ebx,%eax
+80104b44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104b47:	c9                   	leave
+80104b48:	c3                   	ret
+  if((r = kalloc1()) == 0 && kmem.use_lock &&
+80104b49:	83 3d f4 df 11 80 00 	cmpl   $0x0,0x8011dff4
+80104b50:	74 f0                	je     80104b42 <kalloc+0x12>
+     (kdrain() > 0 || breclaim() == 0))
+80104b52:	e8 94 fb ff ff       	call   801046eb <kdrain>
+  if((r = kalloc1()) == 0 && kmem.use_lock &&
+80104b57:	85 c0                	test   %eax,%eax
+80104b59:	7e 09                	jle    80104b64 <kalloc+0x34>
+    r = kalloc1();
+80104b5b:	e8 1b fc ff ff       	call   8010477b <kalloc1>
+80104b60:	89 c3                	mov    %eax,%ebx
+  return r;
+80104b62:	eb de                	jmp    80104b42 <kalloc+0x12>
+     (kdrain() > 0 || breclaim() == 0))
+80104b64:	e8 98 bc ff ff       	call   80100801 <breclaim>
+80104b69:	85 c0                	test   %eax,%eax
+80104b6b:	75 d5                	jne    80104b42 <kalloc+0x12>
+80104b6d:	eb ec                	jmp    80104b5b <kalloc+0x2b>
+
+80104b6f <kfreepages>:
+kfreepages(void)
+{
+  struct kcache *c;
+  int n;
+
+  n = kmem.nfree;
+80104b6f:	8b 15 fc df 11 80    	mov    0x8011dffc,%edx
+  for(c = kcache; c < &kcache[NCPU]; c++)
+80104b75:	b8 00 a0 13 80       	mov    $0x8013a000,%eax
+80104b7a:	eb 06                	jmp    80104b82 <kfreepages+0x13>
+    n += c->n;
+80104b7c:	03 50 38             	add    0x38(%eax),%edx
+  for(c = kcache; c < &kcache[NCPU]; c++)
+80104b7f:	83 c0 40             	add    $0x40,%eax
+80104b82:	3d 00 a2 13 80       	cmp    $0x8013a200,%eax
+80104b87:	72 f3                	jb     80104b7c <kfreepages+0xd>
+  return n;
+}
+80104b89:	89 d0                	mov    %edx,%eax
+80104b8b:	c3                   	ret
+
+80104b8c <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104b8c:	ba 64 00 00 00       	mov    $0x64,%edx
+80104b91:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80104b92:	a8 01                	test   $0x1,%al
+80104b94:	0f 84 b4 00 00 00    	je     80104c4e <kbdgetc+0xc2>
+80104b9a:	ba 60 00 00 00       	mov    $0x60,%edx
+80104b9f:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+80104ba0:	0f b6 c8             	movzbl %al,%ecx
+
+  if(data == 0xE0){
+80104ba3:	3c e0                	cmp    $0xe0,%al
+80104ba5:	74 61                	je     80104c08 <kbdgetc+0x7c>
+    shift |= E0ESC;
+    return 0;
+  } else if(data & 0x80){
+80104ba7:	84 c0                	test   %al,%al
+80104ba9:	78 6a                	js     80104c15 <kbdgetc+0x89>
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+80104bab:	8b 15 00 a2 13 80    	mov    0x8013a200,%edx
+80104bb1:	f6 c2 40             	test   $0x40,%dl
+80104bb4:	74 0f                	je     80104bc5 <kbdgetc+0x39>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80104bb6:	83 c8 80             	or     $0xffffff80,%eax
+80104bb9:	0f b6 c8             	movzbl %al,%ecx
+    shift &= ~E0ESC;
+80104bbc:	83 e2 bf             	and    $0xffffffbf,%edx
+80104bbf:	89 15 00 a2 13 80    	mov    %edx,0x8013a200
+  }
+
+  shift |= shiftcode[data];
+80104bc5:	0f b6 91 00 c2 10 80 	movzbl -0x7fef3e00(%ecx),%edx
+80104bcc:	0b 15 00 a2 13 80    	or     0x8013a200,%edx
+80104bd2:	89 15 00 a2 13 80    	mov    %edx,0x8013a200
+  shift ^= togglecode[data];
+80104bd8:	0f b6 81 00 c1 10 80 	movzbl -0x7fef3f00(%ecx),%eax
+80104bdf:	31 c2                	xor    %eax,%edx
+80104be1:	89 15 00 a2 13 80    	mov    %edx,0x8013a200
+  c = charcode[shift & (CTL | SHIFT)][data];
+80104be7:	89 d0                	mov    %edx,%eax
+80104be9:	83 e0 03             	and    $0x3,%eax
+80104bec:	8b 04 85 e0 c0 10 80 	mov    -0x7fef3f20(,%eax,4),%eax
+80104bf3:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80104bf7:	f6 c2 08             	test   $0x8,%dl
+80104bfa:	74 57                	je     80104c53 <kbdgetc+0xc7>
+    if('a' <= c && c <= 'z')
+80104bfc:	8d 50 9f             	lea    -0x61(%eax),%edx
+80104bff:	83 fa 19             	cmp    $0x19,%edx
+80104c02:	77 3e                	ja     80104c42 <kbdgetc+0xb6>
+      c += 'A' - 'a';
+80104c04:	83 e8 20             	sub    $0x20,%eax
+80104c07:	c3                   	ret
+    shift |= E0ESC;
+80104c08:	83 0d 00 a2 13 80 40 	orl    $0x40,0x8013a200
+    return 0;
+80104c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+80104c14:	c3                   	ret
+    data = (shift & E0ESC ? data : data & 0x7F);
+80104c15:	8b 15 00 a2 13 80    	mov    0x8013a200,%edx
+80104c1b:	f6 c2 40             	test   $0x40,%dl
+80104c1e:	75 05                	jne    80104c25 <kbdgetc+0x99>
+80104c20:	89 c1                	mov    %eax,%ecx
+80104c22:	83 e1 7f             	and    $0x7f,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80104c25:	0f b6 81 00 c2 10 80 	movzbl -0x7fef3e00(%ecx),%eax
+80104c2c:	83 c8 40             	or     $0x40,%eax
+80104c2f:	0f b6 c0             	movzbl %al,%eax
+80104c32:	f7 d0                	not    %eax
+80104c34:	21 c2                	and    %eax,%edx
+80104c36:	89 15 00 a2 13 80    	mov    %edx,0x8013a200
+    return 0;
+80104c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+80104c41:	c3                   	ret
+    else if('A' <= c && c <= 'Z')
+80104c42:	8d 50 bf             	lea    -0x41(%eax),%edx
+80104c45:	83 fa 19             	cmp    $0x19,%edx
+80104c48:	77 09                	ja     80104c53 <kbdgetc+0xc7>
+      c += 'a' - 'A';
+80104c4a:	83 c0 20             	add    $0x20,%eax
+  }
+  return c;
+80104c4d:	c3                   	ret
+    return -1;
+80104c4e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80104c53:	c3                   	ret
+
+80104c54 <kbdintr>:
+
+void
+kbdintr(void)
+{
+80104c54:	55                   	push   %ebp
+80104c55:	89 e5                	mov    %esp,%ebp
+80104c57:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80104c5a:	68 8c 4b 10 80       	push   $0x80104b8c
+80104c5f:	e8 a0 c3 ff ff       	call   80101004 <consoleintr>
+}
+80104c64:	83 c4 10             	add    $0x10,%esp
+80104c67:	c9                   	leave
+80104c68:	c3                   	ret
+
+80104c69 <lapicw>:
+
+//PAGEBREAK!
+static void
+lapicw(int index, int value)
+{
+  lapic[index] = value;
+80104c69:	8b 0d 04 a2 13 80    	mov    0x8013a204,%ecx
+80104c6f:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+80104c72:	89 10                	mov    %edx,(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80104c74:	a1 04 a2 13 80       	mov    0x8013a204,%eax
+80104c79:	8b 40 20             	mov    0x20(%eax),%eax
+}
+80104c7c:	c3                   	ret
+
+80104c7d <cmos_read>:
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104c7d:	ba 70 00 00 00       	mov    $0x70,%edx
+80104c82:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104c83:	ba 71 00 00 00       	mov    $0x71,%edx
+80104c88:	ec                   	in     (%dx),%al
+static uint cmos_read(uint reg)
+{
+  outb(CMOS_PORT,  reg);
+  microdelay(200);
+
+  return inb(CMOS_RETURN);
+80104c89:	0f b6 c0             	movzbl %al,%eax
+}
+80104c8c:	c3                   	ret
+
+80104c8d <fill_rtcdate>:
+
+static void fill_rtcdate(struct rtcdate *r)
+{
+80104c8d:	55                   	push   %ebp
+80104c8e:	89 e5                	mov    %esp,%ebp
+80104c90:	53                   	push   %ebx
+80104c91:	83 ec 04             	sub    $0x4,%esp
+80104c94:	89 c3                	mov    %eax,%ebx
+  r->second = cmos_read(SECS);
+80104c96:	b8 00 00 00 00       	mov    $0x0,%eax
+80104c9b:	e8 dd ff ff ff       	call   80104c7d <cmos_read>
+80104ca0:	89 03                	mov    %eax,(%ebx)
+  r->minute = cmos_read(MINS);
+80104ca2:	b8 02 00 00 00       	mov    $0x2,%eax
+80104ca7:	e8 d1 ff ff ff       	call   80104c7d <cmos_read>
+80104cac:	89 43 04             	mov    %eax,0x4(%ebx)
+  r->hour   = cmos_read(HOURS);
+80104caf:	b8 04 00 00 00       	mov    $0x4,%eax
+80104cb4:	e8 c4 ff ff ff       	call   80104c7d <cmos_read>
+80104cb9:	89 43 08             	mov    %eax,0x8(%ebx)
+  r->day    = cmos_read(DAY);
+80104cbc:	b8 07 00 00 00       	mov    $0x7,%eax
+80104cc1:	e8 b7 ff ff ff       	call   80104c7d <cmos_read>
+80104cc6:	89 43 0c             	mov    %eax,0xc(%ebx)
+  r->month  = cmos_read(MONTH);
+80104cc9:	b8 08 00 00 00       	mov    $0x8,%eax
+80104cce:	e8 aa ff ff ff       	call   80104c7d <cmos_read>
+80104cd3:	89 43 10             	mov    %eax,0x10(%ebx)
+  r->year   = cmos_read(YEAR);
+80104cd6:	b8 09 00 00 00       	mov    $0x9,%eax
+80104cdb:	e8 9d ff ff ff       	call   80104c7d <cmos_read>
+80104ce0:	89 43 14             	mov    %eax,0x14(%ebx)
+}
+80104ce3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104ce6:	c9                   	leave
+80104ce7:	c3                   	ret
+
+80104ce8 <lapicinit>:
+  if(!lapic)
+80104ce8:	83 3d 04 a2 13 80 00 	cmpl   $0x0,0x8013a204
+80104cef:	0f 84 fe 00 00 00    	je     80104df3 <lapicinit+0x10b>
+{
+80104cf5:	55                   	push   %ebp
+80104cf6:	89 e5                	mov    %esp,%ebp
+80104cf8:	83 ec 08             	sub    $0x8,%esp
+  lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
+80104cfb:	ba 3f 01 00 00       	mov    $0x13f,%edx
+80104d00:	b8 3c 00 00 00       	mov    $0x3c,%eax
+80104d05:	e8 5f ff ff ff       	call   80104c69 <lapicw>
+  lapicw(TDCR, X1);
+80104d0a:	ba 0b 00 00 00       	mov    $0xb,%edx
+80104d0f:	b8 f8 00 00 00       	mov    $0xf8,%eax
+80104d14:	e8 50 ff ff ff       	call   80104c69 <lapicw>
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+80104d19:	ba 20 00 02 00       	mov    $0x20020,%edx
+80104d1e:	b8 c8 00 00 00       	mov    $0xc8,%eax
+80104d23:	e8 41 ff ff ff       	call   80104c69 <lapicw>
+  lapicw(TICR, 1000000);
+80104d28:	ba 40 42 0f 00       	mov    $0xf4240,%edx
+80104d2d:	b8 e0 00 00 00       	mov    $0xe0,%eax
+80104d32:	e8 32 ff ff ff       	call   80104c69 <lapicw>
+  lapicw(LINT0, MASKED);
+80104d37:	ba 00 00 01 00       	mov    $0x10000,%edx
+80104d3c:	b8 d4 00 00 00       	mov    $0xd4,%eax
+80104d41:	e8 23 ff ff ff       	call   80104c69 <lapicw>
+  lapicw(LINT1, MASKED);
+80104d46:	ba 00 00 01 00       	mov    $0x10000,%edx
+80104d4b:	b8 d8 00 00 00       	mov    $0xd8,%eax
+80104d50:	e8 14 ff ff ff       	call   80104c69 <lapicw>
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+80104d55:	a1 04 a2 13 80       	mov    0x8013a204,%eax
+80104d5a:	8b 40 30             	mov    0x30(%eax),%eax
+80104d5d:	c1 e8 10             	shr    $0x10,%eax
+80104d60:	a8 fc                	test   $0xfc,%al
+80104d62:	75 7b                	jne    80104ddf <lapicinit+0xf7>
+  lapicw(ERROR, T_IRQ0 + IRQ_ERROR);
+80104d64:	ba 33 00 00 00       	mov    $0x33,%edx
+80104d69:	b8 dc 00 00 00       	mov    $0xdc,%eax
+80104d6e:	e8 f6 fe ff ff       	call   80104c69 <lapicw>
+  lapicw(ESR, 0);
+80104d73:	ba 00 00 00 00       	mov    $0x0,%edx
+80104d78:	b8 a0 00 00 00       	mov    $0xa0,%eax
+80104d7d:	e8 e7 fe ff ff       	call   80104c69 <lapicw>
+  lapicw(ESR, 0);
+80104d82:	ba 00 00 00 00       	mov    $0x0,%edx
+80104d87:	b8 a0 00 00 00       	mov    $0xa0,%eax
+80104d8c:	e8 d8 fe ff ff       	call   80104c69 <lapicw>
+  lapicw(EOI, 0);
+80104d91:	ba 00 00 00 00       	mov    $0x0,%edx
+80104d96:	b8 2c 00 00 00       	mov    $0x2c,%eax
+80104d9b:	e8 c9 fe ff ff       	call   80104c69 <lapicw>
+  lapicw(ICRHI, 0);
+80104da0:	ba 00 00 00 00       	mov    $0x0,%edx
+80104da5:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80104daa:	e8 ba fe ff ff       	call   80104c69 <lapicw>
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+80104daf:	ba 00 85 08 00       	mov    $0x88500,%edx
+80104db4:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80104db9:	e8 ab fe ff ff       	call   80104c69 <lapicw>
+  while(lapic[ICRLO] & DELIVS)
+80104dbe:	a1 04 a2 13 80       	mov    0x8013a204,%eax
+80104dc3:	8b 80 00 03 00 00    	mov    0x300(%eax),%eax
+80104dc9:	f6 c4 10             	test   $0x10,%ah
+80104dcc:	75 f0                	jne    80104dbe <lapicinit+0xd6>
+  lapicw(TPR, 0);
+80104dce:	ba 00 00 00 00       	mov    $0x0,%edx
+80104dd3:	b8 20 00 00 00       	mov    $0x20,%eax
+80104dd8:	e8 8c fe ff ff       	call   80104c69 <lapicw>
+}
+80104ddd:	c9                   	leave
+80104dde:	c3                   	ret
+    lapicw(PCINT, MASKED);
+80104ddf:	ba 00 00 01 00       	mov    $0x10000,%edx
+80104de4:	b8 d0 00 00 00       	mov    $0xd0,%eax
+80104de9:	e8 7b fe ff ff       	call   80104c69 <lapicw>
+80104dee:	e9 71 ff ff ff       	jmp    80104d64 <lapicinit+0x7c>
+80104df3:	c3                   	ret
+
+80104df4 <lapicid>:
+  if (!lapic)
+80104df4:	a1 04 a2 13 80       	mov    0x8013a204,%eax
+80104df9:	85 c0                	test   %eax,%eax
+80104dfb:	74 07                	je     80104e04 <lapicid+0x10>
+  return lapic[ID] >> 24;
+80104dfd:	8b 40 20             	mov    0x20(%eax),%eax
+80104e00:	c1 e8 18             	shr    $0x18,%eax
+80104e03:	c3                   	ret
+    return 0;
+80104e04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80104e09:	c3                   	ret
+
+80104e0a <lapiceoi>:
+  if(lapic)
+80104e0a:	83 3d 04 a2 13 80 00 	cmpl   $0x0,0x8013a204
+80104e11:	74 17                	je     80104e2a <lapiceoi+0x20>
+{
+80104e13:	55                   	push   %ebp
+80104e14:	89 e5                	mov    %esp,%ebp
+80104e16:	83 ec 08             	sub    $0x8,%esp
+    lapicw(EOI, 0);
+80104e19:	ba 00 00 00 00       	mov    $0x0,%edx
+80104e1e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+80104e23:	e8 41 fe ff ff       	call   80104c69 <lapicw>
+}
+80104e28:	c9                   	leave
+80104e29:	c3                   	ret
+80104e2a:	c3                   	ret
+
+80104e2b <microdelay>:
+}
+80104e2b:	c3                   	ret
+
+80104e2c <lapicstartap>:
+{
+80104e2c:	55                   	push   %ebp
+80104e2d:	89 e5                	mov    %esp,%ebp
+80104e2f:	57                   	push   %edi
+80104e30:	56                   	push   %esi
+80104e31:	53                   	push   %ebx
+80104e32:	83 ec 0c             	sub    $0xc,%esp
+80104e35:	8b 75 08             	mov    0x8(%ebp),%esi
+80104e38:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104e3b:	b8 0f 00 00 00       	mov    $0xf,%eax
+80104e40:	ba 70 00 00 00       	mov    $0x70,%edx
+80104e45:	ee                   	out    %al,(%dx)
+80104e46:	b8 0a 00 00 00       	mov    $0xa,%eax
+80104e4b:	ba 71 00 00 00       	mov    $0x71,%edx
+80104e50:	ee                   	out    %al,(%dx)
+  wrv[0] = 0;
+80104e51:	66 c7 05 67 04 00 80 	movw   $0x0,0x80000467
+80104e58:	00 00 
+  wrv[1] = addr >> 4;
+80104e5a:	89 f8                	mov    %edi,%eax
+80104e5c:	c1 e8 04             	shr    $0x4,%eax
+80104e5f:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapicw(ICRHI, apicid<<24);
+80104e65:	c1 e6 18             	shl    $0x18,%esi
+80104e68:	89 f2                	mov    %esi,%edx
+80104e6a:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80104e6f:	e8 f5 fd ff ff       	call   80104c69 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL | ASSERT);
+80104e74:	ba 00 c5 00 00       	mov    $0xc500,%edx
+80104e79:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80104e7e:	e8 e6 fd ff ff       	call   80104c69 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL);
+80104e83:	ba 00 85 00 00       	mov    $0x8500,%edx
+80104e88:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80104e8d:	e8 d7 fd ff ff       	call   80104c69 <lapicw>
+  for(i = 0; i < 2; i++){
+80104e92:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104e97:	eb 21                	jmp    80104eba <lapicstartap+0x8e>
+    lapicw(ICRHI, apicid<<24);
+80104e99:	89 f2                	mov    %esi,%edx
+80104e9b:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80104ea0:	e8 c4 fd ff ff       	call   80104c69 <lapicw>
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80104ea5:	89 fa                	mov    %edi,%edx
+80104ea7:	c1 ea 0c             	shr    $0xc,%edx
+80104eaa:	80 ce 06             	or     $0x6,%dh
+80104ead:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80104eb2:	e8 b2 fd ff ff       	call   80104c69 <lapicw>
+  for(i = 0; i < 2; i++){
+80104eb7:	83 c3 01             	add    $0x1,%ebx
+80104eba:	83 fb 01             	cmp    $0x1,%ebx
+80104ebd:	7e da                	jle    80104e99 <lapicstartap+0x6d>
+}
+80104ebf:	83 c4 0c             	add    $0xc,%esp
+80104ec2:	5b                   	pop    %ebx
+80104ec3:	5e                   	pop    %esi
+80104ec4:	5f                   	pop    %edi
+80104ec5:	5d                   	pop    %ebp
+80104ec6:	c3                   	ret
+
+80104ec7 <cmostime>:
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void cmostime(struct rtcdate *r)
+{
+80104ec7:	55                   	push   %ebp
+80104ec8:	89 e5                	mov    %esp,%ebp
+80104eca:	57                   	push   %edi
+80104ecb:	56                   	push   %esi
+80104ecc:	53                   	push   %ebx
+80104ecd:	83 ec 3c             	sub    $0x3c,%esp
+80104ed0:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+80104ed3:	b8 0b 00 00 00       	mov    $0xb,%eax
+80104ed8:	e8 a0 fd ff ff       	call   80104c7d <cmos_read>
+
+  bcd = (sb & (1 << 2)) == 0;
+80104edd:	83 e0 04             	and    $0x4,%eax
+80104ee0:	89 c7                	mov    %eax,%edi
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+80104ee2:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80104ee5:	e8 a3 fd ff ff       	call   80104c8d <fill_rtcdate>
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80104eea:	b8 0a 00 00 00       	mov    $0xa,%eax
+80104eef:	e8 89 fd ff ff       	call   80104c7d <cmos_read>
+80104ef4:	a8 80                	test   $0x80,%al
+80104ef6:	75 ea                	jne    80104ee2 <cmostime+0x1b>
+        continue;
+    fill_rtcdate(&t2);
+80104ef8:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+80104efb:	89 d8                	mov    %ebx,%eax
+80104efd:	e8 8b fd ff ff       	call   80104c8d <fill_rtcdate>
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80104f02:	83 ec 04             	sub    $0x4,%esp
+80104f05:	6a 18                	push   $0x18
+80104f07:	53                   	push   %ebx
+80104f08:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80104f0b:	50                   	push   %eax
+80104f0c:	e8 c0 37 00 00       	call   801086d1 <memcmp>
+80104f11:	83 c4 10             	add    $0x10,%esp
+80104f14:	85 c0                	test   %eax,%eax
+80104f16:	75 ca                	jne    80104ee2 <cmostime+0x1b>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80104f18:	85 ff                	test   %edi,%edi
+80104f1a:	75 78                	jne    80104f94 <cmostime+0xcd>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80104f1c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80104f1f:	89 c2                	mov    %eax,%edx
+80104f21:	c1 ea 04             	shr    $0x4,%edx
+80104f24:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104f27:	83 e0 0f             	and    $0xf,%eax
+80104f2a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104f2d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    CONV(minute);
+80104f30:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80104f33:	89 c2                	mov    %eax,%edx
+80104f35:	c1 ea 04             	shr    $0x4,%edx
+80104f38:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104f3b:	83 e0 0f             	and    $0xf,%eax
+80104f3e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104f41:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    CONV(hour  );
+80104f44:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80104f47:	89 c2                	mov    %eax,%edx
+80104f49:	c1 ea 04             	shr    $0x4,%edx
+80104f4c:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104f4f:	83 e0 0f             	and    $0xf,%eax
+80104f52:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104f55:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    CONV(day   );
+80104f58:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104f5b:	89 c2                	mov    %eax,%edx
+80104f5d:	c1 ea 04             	shr    $0x4,%edx
+80104f60:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104f63:	83 e0 0f             	and    $0xf,%eax
+80104f66:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104f69:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    CONV(month );
+80104f6c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80104f6f:	89 c2                	mov    %eax,%edx
+80104f71:	c1 ea 04             	shr    $0x4,%edx
+80104f74:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104f77:	83 e0 0f             	and    $0xf,%eax
+80104f7a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104f7d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    CONV(year  );
+80104f80:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104f83:	89 c2                	mov    %eax,%edx
+80104f85:	c1 ea 04             	shr    $0x4,%edx
+80104f88:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104f8b:	83 e0 0f             	and    $0xf,%eax
+80104f8e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104f91:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+80104f94:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80104f97:	89 06                	mov    %eax,(%esi)
+80104f99:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80104f9c:	89 46 04             	mov    %eax,0x4(%esi)
+80104f9f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80104fa2:	89 46 08             	mov    %eax,0x8(%esi)
+80104fa5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104fa8:	89 46 0c             	mov    %eax,0xc(%esi)
+80104fab:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80104fae:	89 46 10             	mov    %eax,0x10(%esi)
+80104fb1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104fb4:	89 46 14             	mov    %eax,0x14(%esi)
+  r->year += 2000;
+80104fb7:	05 d0 07 00 00       	add    $0x7d0,%eax
+80104fbc:	89 46 14             	mov    %eax,0x14(%esi)
+}
+80104fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104fc2:	5b                   	pop    %ebx
+80104fc3:	5e                   	pop    %esi
+80104fc4:	5f                   	pop    %edi
+80104fc5:	5d                   	pop    %ebp
+80104fc6:	c3                   	ret
+
+80104fc7 <read_head>:
+}
+
+// Read the log header from disk into the in-memory log header
+static void
+read_head(void)
+{
+80104fc7:	55                   	push   %ebp
+80104fc8:	89 e5                	mov    %esp,%ebp
+80104fca:	56                   	push   %esi
+80104fcb:	53                   	push   %ebx
+  struct buf *buf = bread(log.dev, log.start);
+80104fcc:	83 ec 08             	sub    $0x8,%esp
+80104fcf:	ff 35 54 a2 13 80    	push   0x8013a254
+80104fd5:	ff 35 64 a2 13 80    	push   0x8013a264
+80104fdb:	e8 5c b9 ff ff       	call   8010093c <bread>
+  struct logheader *lh = (struct logheader *) (buf->data);
+80104fe0:	8b 70 60             	mov    0x60(%eax),%esi
+  int i;
+  log.lh.n = lh->n;
+80104fe3:	8b 1e                	mov    (%esi),%ebx
+80104fe5:	89 1d 68 a2 13 80    	mov    %ebx,0x8013a268
+  for (i = 0; i < log.lh.n; i++) {
+80104feb:	83 c4 10             	add    $0x10,%esp
+80104fee:	ba 00 00 00 00       	mov    $0x0,%edx
+80104ff3:	eb 0e                	jmp    80105003 <read_head+0x3c>
+    log.lh.block[i] = lh->block[i];
+80104ff5:	8b 4c 96 04          	mov    0x4(%esi,%edx,4),%ecx
+80104ff9:	89 0c 95 6c a2 13 80 	mov    %ecx,-0x7fec5d94(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80105000:	83 c2 01             	add    $0x1,%edx
+80105003:	39 d3                	cmp    %edx,%ebx
+80105005:	7f ee                	jg     80104ff5 <read_head+0x2e>
+  }
+  brelse(buf);
+80105007:	83 ec 0c             	sub    $0xc,%esp
+8010500a:	50                   	push   %eax
+8010500b:	e8 fb b9 ff ff       	call   80100a0b <brelse>
+}
+80105010:	83 c4 10             	add    $0x10,%esp
+80105013:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105016:	5b                   	pop    %ebx
+80105017:	5e                   	pop    %esi
+80105018:	5d                   	pop    %ebp
+80105019:	c3                   	ret
+
+8010501a <install_trans>:
+{
+8010501a:	55                   	push   %ebp
+8010501b:	89 e5                	mov    %esp,%ebp
+8010501d:	57                   	push   %edi
+8010501e:	56                   	push   %esi
+8010501f:	53                   	push   %ebx
+80105020:	83 ec 3c             	sub    $0x3c,%esp
+  for (tail = 0; tail < log.lh.n; tail += n) {
+80105023:	bf 00 00 00 00       	mov    $0x0,%edi
+80105028:	eb 2f                	jmp    80105059 <install_trans+0x3f>
+    bwritev(dbuf, n);  // write dst to disk
+8010502a:	83 ec 08             	sub    $0x8,%esp
+8010502d:	53                   	push   %ebx
+8010502e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+80105031:	50                   	push   %eax
+80105032:	e8 72 b9 ff ff       	call   801009a9 <bwritev>
+    for (i = 0; i < n; i++)
+80105037:	83 c4 10             	add    $0x10,%esp
+8010503a:	be 00 00 00 00       	mov    $0x0,%esi
+8010503f:	eb 12                	jmp    80105053 <install_trans+0x39>
+      brelse(dbuf[i]);
+80105041:	83 ec 0c             	sub    $0xc,%esp
+80105044:	ff 74 b5 c8          	push   -0x38(%ebp,%esi,4)
+80105048:	e8 be b9 ff ff       	call   80100a0b <brelse>
+    for (i = 0; i < n; i++)
+8010504d:	83 c6 01             	add    $0x1,%esi
+80105050:	83 c4 10             	add    $0x10,%esp
+80105053:	39 de                	cmp    %ebx,%esi
+80105055:	7c ea                	jl     80105041 <install_trans+0x27>
+  for (tail = 0; tail < log.lh.n; tail += n) {
+80105057:	01 df                	add    %ebx,%edi
+80105059:	39 3d 68 a2 13 80    	cmp    %edi,0x8013a268
+8010505f:	7e 74                	jle    801050d5 <install_trans+0xbb>
+    for (n = 0; n < LOGBATCH && tail+n < log.lh.n; n++) {
+80105061:	bb 00 00 00 00       	mov    $0x0,%ebx
+80105066:	83 fb 07             	cmp    $0x7,%ebx
+80105069:	7f bf                	jg     8010502a <install_trans+0x10>
+8010506b:	8d 34 1f             	lea    (%edi,%ebx,1),%esi
+8010506e:	3b 35 68 a2 13 80    	cmp    0x8013a268,%esi
+80105074:	7d b4                	jge    8010502a <install_trans+0x10>
+      struct buf *lbuf = bread(log.dev, log.start+tail+n+1); // read log block
+80105076:	89 f8                	mov    %edi,%eax
+80105078:	03 05 54 a2 13 80    	add    0x8013a254,%eax
+8010507e:	8d 44 18 01          	lea    0x1(%eax,%ebx,1),%eax
+80105082:	83 ec 08             	sub    $0x8,%esp
+80105085:	50                   	push   %eax
+80105086:	ff 35 64 a2 13 80    	push   0x8013a264
+8010508c:	e8 ab b8 ff ff       	call   8010093c <bread>
+80105091:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+      dbuf[n] = bread(log.dev, log.lh.block[tail+n]); // read dst
+80105094:	83 c4 08             	add    $0x8,%esp
+80105097:	ff 34 b5 6c a2 13 80 	push   -0x7fec5d94(,%esi,4)
+8010509e:	ff 35 64 a2 13 80    	push   0x8013a264
+801050a4:	e8 93 b8 ff ff       	call   8010093c <bread>
+801050a9:	89 44 9d c8          	mov    %eax,-0x38(%ebp,%ebx,4)
+      memmove(dbuf[n]->data, lbuf->data, BSIZE);  // copy block to dst
+801050ad:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+801050b0:	8b 56 60             	mov    0x60(%esi),%edx
+801050b3:	8b 40 60             	mov    0x60(%eax),%eax
+801050b6:	83 c4 0c             	add    $0xc,%esp
+801050b9:	68 00 10 00 00       	push   $0x1000
+801050be:	52                   	push   %edx
+801050bf:	50                   	push   %eax
+801050c0:	e8 41 36 00 00       	call   80108706 <memmove>
+      brelse(lbuf);
+801050c5:	89 34 24             	mov    %esi,(%esp)
+801050c8:	e8 3e b9 ff ff       	call   80100a0b <brelse>
+    for (n = 0; n < LOGBATCH && tail+n < log.lh.n; n++) {
+801050cd:	83 c3 01             	add    $0x1,%ebx
+801050d0:	83 c4 10             	add    $0x10,%esp
+801050d3:	eb 91                	jmp    80105066 <install_trans+0x4c>
+}
+801050d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801050d8:	5b                   	pop    %ebx
+801050d9:	5e                   	pop    %esi
+801050da:	5f                   	pop    %edi
+801050db:	5d                   	pop    %ebp
+801050dc:	c3                   	ret
+
+801050dd <write_log>:
+
+// Copy modified blocks from cache to log, LOGBATCH at a time;
+// the log blocks are contiguous, so each batch is one transfer.
+static void
+write_log(void)
+{
+801050dd:	55                   	push   %ebp
+801050de:	89 e5                	mov    %esp,%ebp
+801050e0:	57                   	push   %edi
+801050e1:	56                   	push   %esi
+801050e2:	53                   	push   %ebx
+801050e3:	83 ec 2c             	sub    $0x2c,%esp
+  int tail, i, n;
+  struct buf *to[LOGBATCH];
+
+  for (tail = 0; tail < log.lh.n; tail += n) {
+801050e6:	bf 00 00 00 00       	mov    $0x0,%edi
+801050eb:	eb 2f                	jmp    8010511c <write_log+0x3f>
+      to[n] = bread(log.dev, log.start+tail+n+1); // log block
+      struct buf *from = bread(log.dev, log.lh.block[tail+n]); // cache block
+      memmove(to[n]->data, from->data, BSIZE);
+      brelse(from);
+    }
+    bwritev(to, n);  // write the log
+801050ed:	83 ec 08             	sub    $0x8,%esp
+801050f0:	53                   	push   %ebx
+801050f1:	8d 45 c8             	lea    -0x38(%ebp),%eax
+801050f4:	50                   	push   %eax
+801050f5:	e8 af b8 ff ff       	call   801009a9 <bwritev>
+    for (i = 0; i < n; i++)
+801050fa:	83 c4 10             	add    $0x10,%esp
+801050fd:	be 00 00 00 00       	mov    $0x0,%esi
+80105102:	eb 12                	jmp    80105116 <write_log+0x39>
+      brelse(to[i]);
+80105104:	83 ec 0c             	sub    $0xc,%esp
+80105107:	ff 74 b5 c8          	push   -0x38(%ebp,%esi,4)
+8010510b:	e8 fb b8 ff ff       	call   80100a0b <brelse>
+    for (i = 0; i < n; i++)
+80105110:	83 c6 01             	add    $0x1,%esi
+80105113:	83 c4 10             	add    $0x10,%esp
+80105116:	39 de                	cmp    %ebx,%esi
+80105118:	7c ea                	jl     80105104 <write_log+0x27>
+  for (tail = 0; tail < log.lh.n; tail += n) {
+8010511a:	01 df                	add    %ebx,%edi
+8010511c:	39 3d 68 a2 13 80    	cmp    %edi,0x8013a268
+80105122:	7e 74                	jle    80105198 <write_log+0xbb>
+    for (n = 0; n < LOGBATCH && tail+n < log.lh.n; n++) {
+80105124:	bb 00 00 00 00       	mov    $0x0,%ebx
+80105129:	83 fb 07             	cmp    $0x7,%ebx
+8010512c:	7f bf                	jg     801050ed <write_log+0x10>
+8010512e:	8d 34 1f             	lea    (%edi,%ebx,1),%esi
+80105131:	3b 35 68 a2 13 80    	cmp    0x8013a268,%esi
+80105137:	7d b4                	jge    801050ed <write_log+0x10>
+      to[n] = bread(log.dev, log.start+tail+n+1); // log block
+80105139:	89 f8                	mov    %edi,%eax
+8010513b:	03 05 54 a2 13 80    	add    0x8013a254,%eax
+80105141:	8d 44 18 01          	lea    0x1(%eax,%ebx,1),%eax
+80105145:	83 ec 08             	sub    $0x8,%esp
+80105148:	50                   	push   %eax
+80105149:	ff 35 64 a2 13 80    	push   0x8013a264
+8010514f:	e8 e8 b7 ff ff       	call   8010093c <bread>
+80105154:	89 44 9d c8          	mov    %eax,-0x38(%ebp,%ebx,4)
+      struct buf *from = bread(log.dev, log.lh.block[tail+n]); // cache block
+80105158:	83 c4 08             	add    $0x8,%esp
+8010515b:	ff 34 b5 6c a2 13 80 	push   -0x7fec5d94(,%esi,4)
+80105162:	ff 35 64 a2 13 80    	push   0x8013a264
+80105168:	e8 cf b7 ff ff       	call   8010093c <bread>
+8010516d:	89 c6                	mov    %eax,%esi
+      memmove(to[n]->data, from->data, BSIZE);
+8010516f:	8b 50 60             	mov    0x60(%eax),%edx
+80105172:	8b 44 9d c8          	mov    -0x38(%ebp,%ebx,4),%eax
+80105176:	8b 40 60             	mov    0x60(%eax),%eax
+80105179:	83 c4 0c             	add    $0xc,%esp
+8010517c:	68 00 10 00 00       	push   $0x1000
+80105181:	52                   	push   %edx
+80105182:	50                   	push   %eax
+80105183:	e8 7e 35 00 00       	call   80108706 <memmove>
+      brelse(from);
+80105188:	89 34 24             	mov    %esi,(%esp)
+8010518b:	e8 7b b8 ff ff       	call   80100a0b <brelse>
+    for (n = 0; n < LOGBATCH && tail+n < log.lh.n; n++) {
+80105190:	83 c3 01             	add    $0x1,%ebx
+80105193:	83 c4 10             	add    $0x10,%esp
+80105196:	eb 91                	jmp    80105129 <write_log+0x4c>
+  }
+}
+80105198:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010519b:	5b                   	pop    %ebx
+8010519c:	5e                   	pop    %esi
+8010519d:	5f                   	pop    %edi
+8010519e:	5d                   	pop    %ebp
+8010519f:	c3                   	ret
+
+801051a0 <write_head>:
+{
+801051a0:	55                   	push   %ebp
+801051a1:	89 e5                	mov    %esp,%ebp
+801051a3:	53                   	push   %ebx
+801051a4:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+801051a7:	ff 35 54 a2 13 80    	push   0x8013a254
+801051ad:	ff 35 64 a2 13 80    	push   0x8013a264
+801051b3:	e8 84 b7 ff ff       	call   8010093c <bread>
+801051b8:	89 c3                	mov    %eax,%ebx
+  struct logheader *hb = (struct logheader *) (buf->data);
+801051ba:	8b 48 60             	mov    0x60(%eax),%ecx
+  hb->n = log.lh.n;
+801051bd:	a1 68 a2 13 80       	mov    0x8013a268,%eax
+801051c2:	89 01                	mov    %eax,(%ecx)
+  for (i = 0; i < log.lh.n; i++) {
+801051c4:	83 c4 10             	add    $0x10,%esp
+801051c7:	b8 00 00 00 00       	mov    $0x0,%eax
+801051cc:	eb 0e                	jmp    801051dc <write_head+0x3c>
+    hb->block[i] = log.lh.block[i];
+801051ce:	8b 14 85 6c a2 13 80 	mov    -0x7fec5d94(,%eax,4),%edx
+801051d5:	89 54 81 04          	mov    %edx,0x4(%ecx,%eax,4)
+  for (i = 0; i < log.lh.n; i++) {
+801051d9:	83 c0 01             	add    $0x1,%eax
+801051dc:	39 05 68 a2 13 80    	cmp    %eax,0x8013a268
+801051e2:	7f ea                	jg     801051ce <write_head+0x2e>
+  bwrite(buf);
+801051e4:	83 ec 0c             	sub    $0xc,%esp
+801051e7:	53                   	push   %ebx
+801051e8:	e8 7d b7 ff ff       	call   8010096a <bwrite>
+  brelse(buf);
+801051ed:	89 1c 24             	mov    %ebx,(%esp)
+801051f0:	e8 16 b8 ff ff       	call   80100a0b <brelse>
+}
+801051f5:	83 c4 10             	add    $0x10,%esp
+801051f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801051fb:	c9                   	leave
+801051fc:	c3                   	ret
+
+801051fd <recover_from_log>:
+{
+801051fd:	55                   	push   %ebp
+801051fe:	89 e5                	mov    %esp,%ebp
+80105200:	83 ec 08             	sub    $0x8,%esp
+  read_head();
+80105203:	e8 bf fd ff ff       	call   80104fc7 <read_head>
+  install_trans(); // if committed, copy from log to disk
+80105208:	e8 0d fe ff ff       	call   8010501a <install_trans>
+  log.lh.n = 0;
+8010520d:	c7 05 68 a2 13 80 00 	movl   $0x0,0x8013a268
+80105214:	00 00 00 
+  write_head(); // clear the log
+80105217:	e8 84 ff ff ff       	call   801051a0 <write_head>
+}
+8010521c:	c9                   	leave
+8010521d:	c3                   	ret
+
+8010521e <commit>:
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+8010521e:	83 3d 68 a2 13 80 00 	cmpl   $0x0,0x8013a268
+80105225:	7f 01                	jg     80105228 <commit+0xa>
+80105227:	c3                   	ret
+{
+80105228:	55                   	push   %ebp
+80105229:	89 e5                	mov    %esp,%ebp
+8010522b:	83 ec 08             	sub    $0x8,%esp
+    write_log();     // Write modified blocks from cache to log
+8010522e:	e8 aa fe ff ff       	call   801050dd <write_log>
+    write_head();    // Write header to disk -- the real commit
+80105233:	e8 68 ff ff ff       	call   801051a0 <write_head>
+    install_trans(); // Now install writes to home locations
+80105238:	e8 dd fd ff ff       	call   8010501a <install_trans>
+    log.lh.n = 0;
+8010523d:	c7 05 68 a2 13 80 00 	movl   $0x0,0x8013a268
+80105244:	00 00 00 
+    write_head();    // Erase the transaction from the log
+80105247:	e8 54 ff ff ff       	call   801051a0 <write_head>
+  }
+}
+8010524c:	c9                   	leave
+8010524d:	c3                   	ret
+
+8010524e <initlog>:
+{
+8010524e:	55                   	push   %ebp
+8010524f:	89 e5                	mov    %esp,%ebp
+80105251:	53                   	push   %ebx
+80105252:	83 ec 2c             	sub    $0x2c,%esp
+80105255:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+80105258:	68 00 c3 10 80       	push   $0x8010c300
+8010525d:	68 20 a2 13 80       	push   $0x8013a220
+80105262:	e8 37 32 00 00       	call   8010849e <initlock>
+  readsb(dev, &sb);
+80105267:	83 c4 08             	add    $0x8,%esp
+8010526a:	8d 45 d8             	lea    -0x28(%ebp),%eax
+8010526d:	50                   	push   %eax
+8010526e:	53                   	push   %ebx
+8010526f:	e8 39 d7 ff ff       	call   801029ad <readsb>
+  log.start = sb.logstart;
+80105274:	8b 45 e8             	mov    -0x18(%ebp),%eax
+80105277:	a3 54 a2 13 80       	mov    %eax,0x8013a254
+  log.size = sb.nlog;
+8010527c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010527f:	a3 58 a2 13 80       	mov    %eax,0x8013a258
+  log.dev = dev;
+80105284:	89 1d 64 a2 13 80    	mov    %ebx,0x8013a264
+  recover_from_log();
+8010528a:	e8 6e ff ff ff       	call   801051fd <recover_from_log>
+}
+8010528f:	83 c4 10             	add    $0x10,%esp
+80105292:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105295:	c9                   	leave
+80105296:	c3                   	ret
+
+80105297 <begin_op>:
+{
+80105297:	55                   	push   %ebp
+80105298:	89 e5                	mov    %esp,%ebp
+8010529a:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+8010529d:	68 20 a2 13 80       	push   $0x8013a220
+801052a2:	e8 3b 33 00 00       	call   801085e2 <acquire>
+801052a7:	83 c4 10             	add    $0x10,%esp
+801052aa:	eb 15                	jmp    801052c1 <begin_op+0x2a>
+      sleep(&log, &log.lock);
+801052ac:	83 ec 08             	sub    $0x8,%esp
+801052af:	68 20 a2 13 80       	push   $0x8013a220
+801052b4:	68 20 a2 13 80       	push   $0x8013a220
+801052b9:	e8 ae 25 00 00       	call   8010786c <sleep>
+801052be:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+801052c1:	83 3d 60 a2 13 80 00 	cmpl   $0x0,0x8013a260
+801052c8:	75 e2                	jne    801052ac <begin_op+0x15>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+801052ca:	a1 5c a2 13 80       	mov    0x8013a25c,%eax
+801052cf:	83 c0 01             	add    $0x1,%eax
+801052d2:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+801052d5:	8d 14 09             	lea    (%ecx,%ecx,1),%edx
+801052d8:	03 15 68 a2 13 80    	add    0x8013a268,%edx
+801052de:	83 fa 1e             	cmp    $0x1e,%edx
+801052e1:	7e 17                	jle    801052fa <begin_op+0x63>
+      sleep(&log, &log.lock);
+801052e3:	83 ec 08             	sub    $0x8,%esp
+801052e6:	68 20 a2 13 80       	push   $0x8013a220
+801052eb:	68 20 a2 13 80       	push   $0x8013a220
+801052f0:	e8 77 25 00 00       	call   8010786c <sleep>
+801052f5:	83 c4 10             	add    $0x10,%esp
+801052f8:	eb c7                	jmp    801052c1 <begin_op+0x2a>
+      log.outstanding += 1;
+801052fa:	a3 5c a2 13 80       	mov    %eax,0x8013a25c
+      release(&log.lock);
+801052ff:	83 ec 0c             	sub    $0xc,%esp
+80105302:	68 20 a2 13 80       	push   $0x8013a220
+80105307:	e8 3b 33 00 00       	call   80108647 <release>
+}
+8010530c:	83 c4 10             	add    $0x10,%esp
+8010530f:	c9                   	leave
+80105310:	c3                   	ret
+
+80105311 <end_op>:
+{
+80105311:	55                   	push   %ebp
+80105312:	89 e5                	mov    %esp,%ebp
+80105314:	53                   	push   %ebx
+80105315:	83 ec 10             	sub    $0x10,%esp
+  acquire(&log.lock);
+80105318:	68 20 a2 13 80       	push   $0x8013a220
+8010531d:	e8 c0 32 00 00       	call   801085e2 <acquire>
+  log.outstanding -= 1;
+80105322:	a1 5c a2 13 80       	mov    0x8013a25c,%eax
+80105327:	83 e8 01             	sub    $0x1,%eax
+8010532a:	a3 5c a2 13 80       	mov    %eax,0x8013a25c
+  if(log.committing)
+8010532f:	8b 1d 60 a2 13 80    	mov    0x8013a260,%ebx
+80105335:	83 c4 10             	add    $0x10,%esp
+80105338:	85 db                	test   %ebx,%ebx
+8010533a:	75 2c                	jne    80105368 <end_op+0x57>
+  if(log.outstanding == 0){
+8010533c:	85 c0                	test   %eax,%eax
+8010533e:	75 35                	jne    80105375 <end_op+0x64>
+    log.committing = 1;
+80105340:	c7 05 60 a2 13 80 01 	movl   $0x1,0x8013a260
+80105347:	00 00 00 
+    do_commit = 1;
+8010534a:	bb 01 00 00 00       	mov    $0x1,%ebx
+  release(&log.lock);
+8010534f:	83 ec 0c             	sub    $0xc,%esp
+80105352:	68 20 a2 13 80       	push   $0x8013a220
+80105357:	e8 eb 32 00 00       	call   80108647 <release>
+  if(do_commit){
+8010535c:	83 c4 10             	add    $0x10,%esp
+8010535f:	85 db                	test   %ebx,%ebx
+80105361:	75 24                	jne    80105387 <end_op+0x76>
+}
+80105363:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105366:	c9                   	leave
+80105367:	c3                   	ret
+    panic("log.committing");
+80105368:	83 ec 0c             	sub    $0xc,%esp
+8010536b:	68 04 c3 10 80       	push   $0x8010c304
+80105370:	e8 81 b8 ff ff       	call   80100bf6 <panic>
+    wakeup(&log);
+80105375:	83 ec 0c             	sub    $0xc,%esp
+80105378:	68 20 a2 13 80       	push   $0x8013a220
+8010537d:	e8 c7 1a 00 00       	call   80106e49 <wakeup>
+80105382:	83 c4 10             	add    $0x10,%esp
+80105385:	eb c8                	jmp    8010534f <end_op+0x3e>
+    commit();
+80105387:	e8 92 fe ff ff       	call   8010521e <commit>
+    acquire(&log.lock);
+8010538c:	83 ec 0c             	sub    $0xc,%esp
+8010538f:	68 20 a2 13 80       	push   $0x8013a220
+80105394:	e8 49 32 00 00       	call   801085e2 <acquire>
+    log.committing = 0;
+80105399:	c7 05 60 a2 13 80 00 	movl   $0x0,0x8013a260
+801053a0:	00 00 00 
+    wakeup(&log);
+801053a3:	c7 04 24 20 a2 13 80 	movl   $0x8013a220,(%esp)
+801053aa:	e8 9a 1a 00 00       	call   80106e49 <wakeup>
+    release(&log.lock);
+801053af:	c7 04 24 20 a2 13 80 	movl   $0x8013a220,(%esp)
+801053b6:	e8 8c 32 00 00       	call   80108647 <release>
+801053bb:	83 c4 10             	add    $0x10,%esp
+}
+801053be:	eb a3                	jmp    80105363 <end_op+0x52>
+
+801053c0 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+801053c0:	55                   	push   %ebp
+801053c1:	89 e5                	mov    %esp,%ebp
+801053c3:	53                   	push   %ebx
+801053c4:	83 ec 04             	sub    $0x4,%esp
+801053c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+801053ca:	8b 15 68 a2 13 80    	mov    0x8013a268,%edx
+801053d0:	83 fa 1d             	cmp    $0x1d,%edx
+801053d3:	7f 2c                	jg     80105401 <log_write+0x41>
+801053d5:	a1 58 a2 13 80       	mov    0x8013a258,%eax
+801053da:	83 e8 01             	sub    $0x1,%eax
+801053dd:	39 c2                	cmp    %eax,%edx
+801053df:	7d 20                	jge    80105401 <log_write+0x41>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+801053e1:	83 3d 5c a2 13 80 00 	cmpl   $0x0,0x8013a25c
+801053e8:	7e 24                	jle    8010540e <log_write+0x4e>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+801053ea:	83 ec 0c             	sub    $0xc,%esp
+801053ed:	68 20 a2 13 80       	push   $0x8013a220
+801053f2:	e8 eb 31 00 00       	call   801085e2 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+801053f7:	83 c4 10             	add    $0x10,%esp
+801053fa:	b8 00 00 00 00       	mov    $0x0,%eax
+801053ff:	eb 1d                	jmp    8010541e <log_write+0x5e>
+    panic("too big a transaction");
+80105401:	83 ec 0c             	sub    $0xc,%esp
+80105404:	68 13 c3 10 80       	push   $0x8010c313
+80105409:	e8 e8 b7 ff ff       	call   80100bf6 <panic>
+    panic("log_write outside of trans");
+8010540e:	83 ec 0c             	sub    $0xc,%esp
+80105411:	68 29 c3 10 80       	push   $0x8010c329
+80105416:	e8 db b7 ff ff       	call   80100bf6 <panic>
+  for (i = 0; i < log.lh.n; i++) {
+8010541b:	83 c0 01             	add    $0x1,%eax
+8010541e:	8b 15 68 a2 13 80    	mov    0x8013a268,%edx
+80105424:	39 c2                	cmp    %eax,%edx
+80105426:	7e 0c                	jle    80105434 <log_write+0x74>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80105428:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010542b:	39 0c 85 6c a2 13 80 	cmp    %ecx,-0x7fec5d94(,%eax,4)
+80105432:	75 e7                	jne    8010541b <log_write+0x5b>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+80105434:	8b 4b 08             	mov    0x8(%ebx),%ecx
+80105437:	89 0c 85 6c a2 13 80 	mov    %ecx,-0x7fec5d94(,%eax,4)
+  if (i == log.lh.n)
+8010543e:	39 c2                	cmp    %eax,%edx
+80105440:	74 1c                	je     8010545e <log_write+0x9e>
+    log.lh.n++;
+  b->flags |= B_DIRTY; // prevent eviction
+80105442:	8b 03                	mov    (%ebx),%eax
+80105444:	83 c8 04             	or     $0x4,%eax
+80105447:	89 03                	mov    %eax,(%ebx)
+  release(&log.lock);
+80105449:	83 ec 0c             	sub    $0xc,%esp
+8010544c:	68 20 a2 13 80       	push   $0x8013a220
+80105451:	e8 f1 31 00 00       	call   80108647 <release>
+}
+80105456:	83 c4 10             	add    $0x10,%esp
+80105459:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010545c:	c9                   	leave
+8010545d:	c3                   	ret
+    log.lh.n++;
+8010545e:	83 c2 01             	add    $0x1,%edx
+80105461:	89 15 68 a2 13 80    	mov    %edx,0x8013a268
+80105467:	eb d9                	jmp    80105442 <log_write+0x82>
+
+80105469 <startothers>:
+pde_t entrypgdir[];  // For entry.S
+
+// Start the non-boot (AP) processors.
+static void
+startothers(void)
+{
+80105469:	55                   	push   %ebp
+8010546a:	89 e5                	mov    %esp,%ebp
+8010546c:	53                   	push   %ebx
+8010546d:	83 ec 08             	sub    $0x8,%esp
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+80105470:	68 8a 00 00 00       	push   $0x8a
+80105475:	68 8c f4 10 80       	push   $0x8010f48c
+8010547a:	68 00 70 00 80       	push   $0x80007000
+8010547f:	e8 82 32 00 00       	call   80108706 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+80105484:	83 c4 10             	add    $0x10,%esp
+80105487:	bb 20 a3 13 80       	mov    $0x8013a320,%ebx
+8010548c:	eb 06                	jmp    80105494 <startothers+0x2b>
+8010548e:	81 c3 b0 00 00 00    	add    $0xb0,%ebx
+80105494:	69 05 04 a3 13 80 b0 	imul   $0xb0,0x8013a304,%eax
+8010549b:	00 00 00 
+8010549e:	05 20 a3 13 80       	add    $0x8013a320,%eax
+801054a3:	39 c3                	cmp    %eax,%ebx
+801054a5:	73 4c                	jae    801054f3 <startothers+0x8a>
+    if(c == mycpu())  // We've started already.
+801054a7:	e8 29 14 00 00       	call   801068d5 <mycpu>
+801054ac:	39 c3                	cmp    %eax,%ebx
+801054ae:	74 de                	je     8010548e <startothers+0x25>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+801054b0:	e8 7b f6 ff ff       	call   80104b30 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+801054b5:	05 00 10 00 00       	add    $0x1000,%eax
+801054ba:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    *(void**)(code-8) = mpenter;
+801054bf:	c7 05 f8 6f 00 80 37 	movl   $0x80105537,0x80006ff8
+801054c6:	55 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+801054c9:	c7 05 f4 6f 00 80 00 	movl   $0x10e000,0x80006ff4
+801054d0:	e0 10 00 
+
+    lapicstartap(c->apicid, V2P(code));
+801054d3:	83 ec 08             	sub    $0x8,%esp
+801054d6:	68 00 70 00 00       	push   $0x7000
+801054db:	0f b6 03             	movzbl (%ebx),%eax
+801054de:	50                   	push   %eax
+801054df:	e8 48 f9 ff ff       	call   80104e2c <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+801054e4:	83 c4 10             	add    $0x10,%esp
+801054e7:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+801054ed:	85 c0                	test   %eax,%eax
+801054ef:	74 f6                	je     801054e7 <startothers+0x7e>
+801054f1:	eb 9b                	jmp    8010548e <startothers+0x25>
+      ;
+  }
+}
+801054f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801054f6:	c9                   	leave
+801054f7:	c3                   	ret
+
+801054f8 <mpmain>:
+{
+801054f8:	55                   	push   %ebp
+801054f9:	89 e5                	mov    %esp,%ebp
+801054fb:	53                   	push   %ebx
+801054fc:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+801054ff:	e8 2d 14 00 00       	call   80106931 <cpuid>
+80105504:	89 c3                	mov    %eax,%ebx
+80105506:	e8 26 14 00 00       	call   80106931 <cpuid>
+8010550b:	83 ec 04             	sub    $0x4,%esp
+8010550e:	53                   	push   %ebx
+8010550f:	50                   	push   %eax
+80105510:	68 44 c3 10 80       	push   $0x8010c344
+80105515:	e8 9d b9 ff ff       	call   80100eb7 <cprintf>
+  idtinit();       // load idt register
+8010551a:	e8 f0 45 00 00       	call   80109b0f <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+8010551f:	e8 b1 13 00 00       	call   801068d5 <mycpu>
+80105524:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+80105526:	b8 01 00 00 00       	mov    $0x1,%eax
+8010552b:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+80105532:	e8 6e 1c 00 00       	call   801071a5 <scheduler>
+
+80105537 <mpenter>:
+{
+80105537:	55                   	push   %ebp
+80105538:	89 e5                	mov    %esp,%ebp
+8010553a:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+8010553d:	e8 1e 5f 00 00       	call   8010b460 <switchkvm>
+  seginit();
+80105542:	e8 a4 5c 00 00       	call   8010b1eb <seginit>
+  lapicinit();
+80105547:	e8 9c f7 ff ff       	call   80104ce8 <lapicinit>
+  mpmain();
+8010554c:	e8 a7 ff ff ff       	call   801054f8 <mpmain>
+
+80105551 <main>:
+{
+80105551:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80105555:	83 e4 f0             	and    $0xfffffff0,%esp
+80105558:	ff 71 fc             	push   -0x4(%ecx)
+8010555b:	55                   	push   %ebp
+8010555c:	89 e5                	mov    %esp,%ebp
+8010555e:	51                   	push   %ecx
+8010555f:	83 ec 0c             	sub    $0xc,%esp
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+80105562:	68 00 00 40 80       	push   $0x80400000
+80105567:	68 10 60 14 80       	push   $0x80146010
+8010556c:	e8 43 f5 ff ff       	call   80104ab4 <kinit1>
+  kvmalloc();      // kernel page table
+80105571:	e8 b1 63 00 00       	call   8010b927 <kvmalloc>
+  mpinit();        // detect other processors
+80105576:	e8 cb 01 00 00       	call   80105746 <mpinit>
+  lapicinit();     // interrupt controller
+8010557b:	e8 68 f7 ff ff       	call   80104ce8 <lapicinit>
+  seginit();       // segment descriptors
+80105580:	e8 66 5c 00 00       	call   8010b1eb <seginit>
+  picinit();       // disable pic
+80105585:	e8 ab 03 00 00       	call   80105935 <picinit>
+  ioapicinit();    // another interrupt controller
+8010558a:	e8 7f f0 ff ff       	call   8010460e <ioapicinit>
+  consoleinit();   // console hardware
+8010558f:	e8 69 bc ff ff       	call   801011fd <consoleinit>
+  uartinit();      // serial port
+80105594:	e8 8e 48 00 00       	call   80109e27 <uartinit>
+  pinit();         // process table
+80105599:	e8 d5 12 00 00       	call   80106873 <pinit>
+  tvinit();        // trap vectors
+8010559e:	e8 7f 44 00 00       	call   80109a22 <tvinit>
+  binit();         // buffer cache
+801055a3:	e8 b9 b2 ff ff       	call   80100861 <binit>
+  fileinit();      // file table
+801055a8:	e8 ea c1 ff ff       	call   80101797 <fileinit>
+  ideinit();       // disk 
+801055ad:	e8 bb eb ff ff       	call   8010416d <ideinit>
+  virtioinit();    // virtio disk
+801055b2:	e8 15 55 00 00       	call   8010aacc <virtioinit>
+  startothers();   // start other processors
+801055b7:	e8 ad fe ff ff       	call   80105469 <startothers>
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+801055bc:	83 c4 08             	add    $0x8,%esp
+801055bf:	68 00 00 00 8e       	push   $0x8e000000
+801055c4:	68 00 00 40 80       	push   $0x80400000
+801055c9:	e8 42 f5 ff ff       	call   80104b10 <kinit2>
+  binit2();        // let buffer cache use the memory
+801055ce:	e8 2e b3 ff ff       	call   80100901 <binit2>
+  userinit();      // first user process
+801055d3:	e8 00 14 00 00       	call   801069d8 <userinit>
+  mpmain();        // finish this processor's setup
+801055d8:	e8 1b ff ff ff       	call   801054f8 <mpmain>
+
+801055dd <sum>:
+int ncpu;
+uchar ioapicid;
+
+static uchar
+sum(uchar *addr, int len)
+{
+801055dd:	55                   	push   %ebp
+801055de:	89 e5                	mov    %esp,%ebp
+801055e0:	56                   	push   %esi
+801055e1:	53                   	push   %ebx
+801055e2:	89 c6                	mov    %eax,%esi
+  int i, sum;
+
+  sum = 0;
+801055e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  for(i=0; i<len; i++)
+801055e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+801055ee:	eb 09                	jmp    801055f9 <sum+0x1c>
+    sum += addr[i];
+801055f0:	0f b6 1c 0e          	movzbl (%esi,%ecx,1),%ebx
+801055f4:	01 d8                	add    %ebx,%eax
+  for(i=0; i<len; i++)
+801055f6:	83 c1 01             	add    $0x1,%ecx
+801055f9:	39 d1                	cmp    %edx,%ecx
+801055fb:	7c f3                	jl     801055f0 <sum+0x13>
+  return sum;
+}
+801055fd:	5b                   	pop    %ebx
+801055fe:	5e                   	pop    %esi
+801055ff:	5d                   	pop    %ebp
+80105600:	c3                   	ret
+
+80105601 <mpsearch1>:
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80105601:	55                   	push   %ebp
+80105602:	89 e5                	mov    %esp,%ebp
+80105604:	56                   	push   %esi
+80105605:	53                   	push   %ebx
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80105606:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+8010560c:	89 f3                	mov    %esi,%ebx
+  e = addr+len;
+8010560e:	01 d6                	add    %edx,%esi
+  for(p = addr; p < e; p += sizeof(struct mp))
+80105610:	eb 03                	jmp    80105615 <mpsearch1+0x14>
+80105612:	83 c3 10             	add    $0x10,%ebx
+80105615:	39 f3                	cmp    %esi,%ebx
+80105617:	73 29                	jae    80105642 <mpsearch1+0x41>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80105619:	83 ec 04             	sub    $0x4,%esp
+8010561c:	6a 04                	push   $0x4
+8010561e:	68 58 c3 10 80       	push   $0x8010c358
+80105623:	53                   	push   %ebx
+80105624:	e8 a8 30 00 00       	call   801086d1 <memcmp>
+80105629:	83 c4 10             	add    $0x10,%esp
+8010562c:	85 c0                	test   %eax,%eax
+8010562e:	75 e2                	jne    80105612 <mpsearch1+0x11>
+80105630:	ba 10 00 00 00       	mov    $0x10,%edx
+80105635:	89 d8                	mov    %ebx,%eax
+80105637:	e8 a1 ff ff ff       	call   801055dd <sum>
+8010563c:	84 c0                	test   %al,%al
+8010563e:	75 d2                	jne    80105612 <mpsearch1+0x11>
+80105640:	eb 05                	jmp    80105647 <mpsearch1+0x46>
+      return (struct mp*)p;
+  return 0;
+80105642:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+80105647:	89 d8                	mov    %ebx,%eax
+80105649:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010564c:	5b                   	pop    %ebx
+8010564d:	5e                   	pop    %esi
+8010564e:	5d                   	pop    %ebp
+8010564f:	c3                   	ret
+
+80105650 <mpsearch>:
+// 1) in the first KB of the EBDA;
+// 2) in the last KB of system base memory;
+// 3) in the BIOS ROM between 0xE0000 and 0xFFFFF.
+static struct mp*
+mpsearch(void)
+{
+80105650:	55                   	push   %ebp
+80105651:	89 e5                	mov    %esp,%ebp
+80105653:	83 ec 08             	sub    $0x8,%esp
+  uchar *bda;
+  uint p;
+  struct mp *mp;
+
+  bda = (uchar *) P2V(0x400);
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80105656:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+8010565d:	c1 e0 08             	shl    $0x8,%eax
+80105660:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80105667:	09 d0                	or     %edx,%eax
+80105669:	c1 e0 04             	shl    $0x4,%eax
+8010566c:	74 1f                	je     8010568d <mpsearch+0x3d>
+    if((mp = mpsearch1(p, 1024)))
+8010566e:	ba 00 04 00 00       	mov    $0x400,%edx
+80105673:	e8 89 ff ff ff       	call   80105601 <mpsearch1>
+80105678:	85 c0                	test   %eax,%eax
+8010567a:	75 0f                	jne    8010568b <mpsearch+0x3b>
+  } else {
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+    if((mp = mpsearch1(p-1024, 1024)))
+      return mp;
+  }
+  return mpsearch1(0xF0000, 0x10000);
+8010567c:	ba 00 00 01 00       	mov    $0x10000,%edx
+80105681:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+80105686:	e8 76 ff ff ff       	call   80105601 <mpsearch1>
+}
+8010568b:	c9                   	leave
+8010568c:	c3                   	ret
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+8010568d:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80105694:	c1 e0 08             	shl    $0x8,%eax
+80105697:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+8010569e:	09 d0                	or     %edx,%eax
+801056a0:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+801056a3:	2d 00 04 00 00       	sub    $0x400,%eax
+801056a8:	ba 00 04 00 00       	mov    $0x400,%edx
+801056ad:	e8 4f ff ff ff       	call   80105601 <mpsearch1>
+801056b2:	85 c0                	test   %eax,%eax
+801056b4:	75 d5                	jne    8010568b <mpsearch+0x3b>
+801056b6:	eb c4                	jmp    8010567c <mpsearch+0x2c>
+
+801056b8 <mpconfig>:
+// Check for correct signature, calculate the checksum and,
+// if correct, check the version.
+// To do: check extended table checksum.
+static struct mpconf*
+mpconfig(struct mp **pmp)
+{
+801056b8:	55                   	push   %ebp
+801056b9:	89 e5                	mov    %esp,%ebp
+801056bb:	57                   	push   %edi
+801056bc:	56                   	push   %esi
+801056bd:	53                   	push   %ebx
+801056be:	83 ec 1c             	sub    $0x1c,%esp
+801056c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct mpconf *conf;
+  struct mp *mp;
+
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+801056c4:	e8 87 ff ff ff       	call   80105650 <mpsearch>
+801056c9:	89 c3                	mov    %eax,%ebx
+801056cb:	85 c0                	test   %eax,%eax
+801056cd:	74 5a                	je     80105729 <mpconfig+0x71>
+801056cf:	8b 70 04             	mov    0x4(%eax),%esi
+801056d2:	85 f6                	test   %esi,%esi
+801056d4:	74 57                	je     8010572d <mpconfig+0x75>
+    return 0;
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+801056d6:	8d be 00 00 00 80    	lea    -0x80000000(%esi),%edi
+  if(memcmp(conf, "PCMP", 4) != 0)
+801056dc:	83 ec 04             	sub    $0x4,%esp
+801056df:	6a 04                	push   $0x4
+801056e1:	68 5d c3 10 80       	push   $0x8010c35d
+801056e6:	57                   	push   %edi
+801056e7:	e8 e5 2f 00 00       	call   801086d1 <memcmp>
+801056ec:	83 c4 10             	add    $0x10,%esp
+801056ef:	85 c0                	test   %eax,%eax
+801056f1:	75 3e                	jne    80105731 <mpconfig+0x79>
+    return 0;
+  if(conf->version != 1 && conf->version != 4)
+801056f3:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+801056fa:	3c 01                	cmp    $0x1,%al
+801056fc:	0f 95 c2             	setne  %dl
+801056ff:	3c 04                	cmp    $0x4,%al
+80105701:	0f 95 c0             	setne  %al
+80105704:	84 c2                	test   %al,%dl
+80105706:	75 30                	jne    80105738 <mpconfig+0x80>
+    return 0;
+  if(sum((uchar*)conf, conf->length) != 0)
+80105708:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+8010570f:	89 f8                	mov    %edi,%eax
+80105711:	e8 c7 fe ff ff       	call   801055dd <sum>
+80105716:	84 c0                	test   %al,%al
+80105718:	75 25                	jne    8010573f <mpconfig+0x87>
+    return 0;
+  *pmp = mp;
+8010571a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010571d:	89 18                	mov    %ebx,(%eax)
+  return conf;
+}
+8010571f:	89 f8                	mov    %edi,%eax
+80105721:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105724:	5b                   	pop    %ebx
+80105725:	5e                   	pop    %esi
+80105726:	5f                   	pop    %edi
+80105727:	5d                   	pop    %ebp
+80105728:	c3                   	ret
+    return 0;
+80105729:	89 c7                	mov    %eax,%edi
+8010572b:	eb f2                	jmp    8010571f <mpconfig+0x67>
+8010572d:	89 f7                	mov    %esi,%edi
+8010572f:	eb ee                	jmp    8010571f <mpconfig+0x67>
+    return 0;
+80105731:	bf 00 00 00 00       	mov    $0x0,%edi
+80105736:	eb e7                	jmp    8010571f <mpconfig+0x67>
+    return 0;
+80105738:	bf 00 00 00 00       	mov    $0x0,%edi
+8010573d:	eb e0                	jmp    8010571f <mpconfig+0x67>
+    return 0;
+8010573f:	bf 00 00 00 00       	mov    $0x0,%edi
+80105744:	eb d9                	jmp    8010571f <mpconfig+0x67>
+
+80105746 <mpinit>:
+
+void
+mpinit(void)
+{
+80105746:	55                   	push   %ebp
+80105747:	89 e5                	mov    %esp,%ebp
+80105749:	57                   	push   %edi
+8010574a:	56                   	push   %esi
+8010574b:	53                   	push   %ebx
+8010574c:	83 ec 1c             	sub    $0x1c,%esp
+  struct mp *mp;
+  struct mpconf *conf;
+  struct mpproc *proc;
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+8010574f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80105752:	e8 61 ff ff ff       	call   801056b8 <mpconfig>
+80105757:	85 c0                	test   %eax,%eax
+80105759:	74 19                	je     80105774 <mpinit+0x2e>
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+8010575b:	8b 50 24             	mov    0x24(%eax),%edx
+8010575e:	89 15 04 a2 13 80    	mov    %edx,0x8013a204
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80105764:	8d 50 2c             	lea    0x2c(%eax),%edx
+80105767:	0f b7 48 04          	movzwl 0x4(%eax),%ecx
+8010576b:	01 c1                	add    %eax,%ecx
+  ismp = 1;
+8010576d:	bb 01 00 00 00       	mov    $0x1,%ebx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80105772:	eb 20                	jmp    80105794 <mpinit+0x4e>
+    panic("Expect to run on an SMP");
+80105774:	83 ec 0c             	sub    $0xc,%esp
+80105777:	68 62 c3 10 80       	push   $0x8010c362
+8010577c:	e8 75 b4 ff ff       	call   80100bf6 <panic>
+    switch(*p){
+80105781:	bb 00 00 00 00       	mov    $0x0,%ebx
+80105786:	eb 0c                	jmp    80105794 <mpinit+0x4e>
+80105788:	83 e8 03             	sub    $0x3,%eax
+8010578b:	3c 01                	cmp    $0x1,%al
+8010578d:	76 1a                	jbe    801057a9 <mpinit+0x63>
+8010578f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80105794:	39 ca                	cmp    %ecx,%edx
+80105796:	73 4d                	jae    801057e5 <mpinit+0x9f>
+    switch(*p){
+80105798:	0f b6 02             	movzbl (%edx),%eax
+8010579b:	3c 02                	cmp    $0x2,%al
+8010579d:	74 38                	je     801057d7 <mpinit+0x91>
+8010579f:	77 e7                	ja     80105788 <mpinit+0x42>
+801057a1:	84 c0                	test   %al,%al
+801057a3:	74 09                	je     801057ae <mpinit+0x68>
+801057a5:	3c 01                	cmp    $0x1,%al
+801057a7:	75 d8                	jne    80105781 <mpinit+0x3b>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+801057a9:	83 c2 08             	add    $0x8,%edx
+      continue;
+801057ac:	eb e6                	jmp    80105794 <mpinit+0x4e>
+      if(ncpu < NCPU) {
+801057ae:	8b 35 04 a3 13 80    	mov    0x8013a304,%esi
+801057b4:	83 fe 07             	cmp    $0x7,%esi
+801057b7:	7f 19                	jg     801057d2 <mpinit+0x8c>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+801057b9:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+801057bd:	69 fe b0 00 00 00    	imul   $0xb0,%esi,%edi
+801057c3:	88 87 20 a3 13 80    	mov    %al,-0x7fec5ce0(%edi)
+        ncpu++;
+801057c9:	83 c6 01             	add    $0x1,%esi
+801057cc:	89 35 04 a3 13 80    	mov    %esi,0x8013a304
+      p += sizeof(struct mpproc);
+801057d2:	83 c2 14             	add    $0x14,%edx
+      continue;
+801057d5:	eb bd                	jmp    80105794 <mpinit+0x4e>
+      ioapicid = ioapic->apicno;
+801057d7:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+801057db:	a2 00 a3 13 80       	mov    %al,0x8013a300
+      p += sizeof(struct mpioapic);
+801057e0:	83 c2 08             	add    $0x8,%edx
+      continue;
+801057e3:	eb af                	jmp    80105794 <mpinit+0x4e>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+801057e5:	85 db                	test   %ebx,%ebx
+801057e7:	74 26                	je     8010580f <mpinit+0xc9>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+801057e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801057ec:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+801057f0:	74 15                	je     80105807 <mpinit+0xc1>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801057f2:	b8 70 00 00 00       	mov    $0x70,%eax
+801057f7:	ba 22 00 00 00       	mov    $0x22,%edx
+801057fc:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801057fd:	ba 23 00 00 00       	mov    $0x23,%edx
+80105802:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+80105803:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105806:	ee                   	out    %al,(%dx)
+  }
+}
+80105807:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010580a:	5b                   	pop    %ebx
+8010580b:	5e                   	pop    %esi
+8010580c:	5f                   	pop    %edi
+8010580d:	5d                   	pop    %ebp
+8010580e:	c3                   	ret
+    panic("Didn't find a suitable machine");
+8010580f:	83 ec 0c             	sub    $0xc,%esp
+80105812:	68 7c c3 10 80       	push   $0x8010c37c
+80105817:	e8 da b3 ff ff       	call   80100bf6 <panic>
+
+8010581c <pciread>:
+#define CONFIG_ADDRESS  0xCF8
+#define CONFIG_DATA     0xCFC
+
+uint
+pciread(uint bdf, int off)
+{
+8010581c:	55                   	push   %ebp
+8010581d:	89 e5                	mov    %esp,%ebp
+  outl(CONFIG_ADDRESS, 0x80000000 | bdf<<8 | (off & 0xFC));
+8010581f:	8b 45 08             	mov    0x8(%ebp),%eax
+80105822:	c1 e0 08             	shl    $0x8,%eax
+80105825:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105828:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+8010582e:	09 d0                	or     %edx,%eax
+80105830:	0d 00 00 00 80       	or     $0x80000000,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105835:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+8010583a:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010583b:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80105840:	ed                   	in     (%dx),%eax
+  return inl(CONFIG_DATA);
+}
+80105841:	5d                   	pop    %ebp
+80105842:	c3                   	ret
+
+80105843 <pciwrite>:
+
+void
+pciwrite(uint bdf, int off, uint val)
+{
+80105843:	55                   	push   %ebp
+80105844:	89 e5                	mov    %esp,%ebp
+  outl(CONFIG_ADDRESS, 0x80000000 | bdf<<8 | (off & 0xFC));
+80105846:	8b 45 08             	mov    0x8(%ebp),%eax
+80105849:	c1 e0 08             	shl    $0x8,%eax
+8010584c:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010584f:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80105855:	09 d0                	or     %edx,%eax
+80105857:	0d 00 00 00 80       	or     $0x80000000,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010585c:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80105861:	ef                   	out    %eax,(%dx)
+80105862:	8b 45 10             	mov    0x10(%ebp),%eax
+80105865:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+8010586a:	ef                   	out    %eax,(%dx)
+  outl(CONFIG_DATA, val);
+}
+8010586b:	5d                   	pop    %ebp
+8010586c:	c3                   	ret
+
+8010586d <pcifind>:
+// Find the first device function whose config register off,
+// masked with mask, equals val. Returns 0 and sets *bdf if
+// found, -1 if not.
+int
+pcifind(int off, uint mask, uint val, uint *bdf)
+{
+8010586d:	55                   	push   %ebp
+8010586e:	89 e5                	mov    %esp,%ebp
+80105870:	57                   	push   %edi
+80105871:	56                   	push   %esi
+80105872:	53                   	push   %ebx
+80105873:	83 ec 1c             	sub    $0x1c,%esp
+  uint bus, dev, func, nfunc, b;
+
+  for(bus = 0; bus < 256; bus++){
+80105876:	bf 00 00 00 00       	mov    $0x0,%edi
+8010587b:	81 ff ff 00 00 00    	cmp    $0xff,%edi
+80105881:	0f 87 a7 00 00 00    	ja     8010592e <pcifind+0xc1>
+    for(dev = 0; dev < 32; dev++){
+80105887:	ba 00 00 00 00       	mov    $0x0,%edx
+8010588c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+8010588f:	89 d3                	mov    %edx,%ebx
+80105891:	eb 7d                	jmp    80105910 <pcifind+0xa3>
+        b = bus<<8 | dev<<3 | func;
+        if((pciread(b, PCI_ID) & 0xFFFF) == 0xFFFF)
+          continue;  // no such function
+        if(func == 0 && (pciread(b, PCI_HEADER) & 0x800000))
+          nfunc = 8;  // multi-function device
+        if((pciread(b, off) & mask) == val){
+80105893:	83 ec 08             	sub    $0x8,%esp
+80105896:	ff 75 08             	push   0x8(%ebp)
+80105899:	57                   	push   %edi
+8010589a:	e8 7d ff ff ff       	call   8010581c <pciread>
+8010589f:	23 45 0c             	and    0xc(%ebp),%eax
+801058a2:	83 c4 10             	add    $0x10,%esp
+801058a5:	3b 45 10             	cmp    0x10(%ebp),%eax
+801058a8:	74 51                	je     801058fb <pcifind+0x8e>
+      for(func = 0; func < nfunc; func++){
+801058aa:	83 c6 01             	add    $0x1,%esi
+801058ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801058b0:	39 c6                	cmp    %eax,%esi
+801058b2:	73 59                	jae    8010590d <pcifind+0xa0>
+        b = bus<<8 | dev<<3 | func;
+801058b4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801058b7:	c1 e7 08             	shl    $0x8,%edi
+801058ba:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+801058c1:	09 c7                	or     %eax,%edi
+801058c3:	09 f7                	or     %esi,%edi
+        if((pciread(b, PCI_ID) & 0xFFFF) == 0xFFFF)
+801058c5:	83 ec 08             	sub    $0x8,%esp
+801058c8:	6a 00                	push   $0x0
+801058ca:	57                   	push   %edi
+801058cb:	e8 4c ff ff ff       	call   8010581c <pciread>
+801058d0:	83 c4 10             	add    $0x10,%esp
+801058d3:	66 83 f8 ff          	cmp    $0xffff,%ax
+801058d7:	74 d1                	je     801058aa <pcifind+0x3d>
+        if(func == 0 && (pciread(b, PCI_HEADER) & 0x800000))
+801058d9:	85 f6                	test   %esi,%esi
+801058db:	75 b6                	jne    80105893 <pcifind+0x26>
+801058dd:	83 ec 08             	sub    $0x8,%esp
+801058e0:	6a 0c                	push   $0xc
+801058e2:	57                   	push   %edi
+801058e3:	e8 34 ff ff ff       	call   8010581c <pciread>
+801058e8:	83 c4 10             	add    $0x10,%esp
+801058eb:	a9 00 00 80 00       	test   $0x800000,%eax
+801058f0:	74 a1                	je     80105893 <pcifind+0x26>
+          nfunc = 8;  // multi-function device
+801058f2:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%ebp)
+801058f9:	eb 98                	jmp    80105893 <pcifind+0x26>
+          *bdf = b;
+801058fb:	8b 45 14             	mov    0x14(%ebp),%eax
+801058fe:	89 38                	mov    %edi,(%eax)
+          return 0;
+80105900:	b8 00 00 00 00       	mov    $0x0,%eax
+        }
+      }
+    }
+  }
+  return -1;
+}
+80105905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105908:	5b                   	pop    %ebx
+80105909:	5e                   	pop    %esi
+8010590a:	5f                   	pop    %edi
+8010590b:	5d                   	pop    %ebp
+8010590c:	c3                   	ret
+    for(dev = 0; dev < 32; dev++){
+8010590d:	83 c3 01             	add    $0x1,%ebx
+80105910:	83 fb 1f             	cmp    $0x1f,%ebx
+80105913:	77 0e                	ja     80105923 <pcifind+0xb6>
+      nfunc = 1;
+80105915:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      for(func = 0; func < nfunc; func++){
+8010591c:	be 00 00 00 00       	mov    $0x0,%esi
+80105921:	eb 8a                	jmp    801058ad <pcifind+0x40>
+  for(bus = 0; bus < 256; bus++){
+80105923:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80105926:	83 c7 01             	add    $0x1,%edi
+80105929:	e9 4d ff ff ff       	jmp    8010587b <pcifind+0xe>
+  return -1;
+8010592e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105933:	eb d0                	jmp    80105905 <pcifind+0x98>
+
+80105935 <picinit>:
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105935:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010593a:	ba 21 00 00 00       	mov    $0x21,%edx
+8010593f:	ee                   	out    %al,(%dx)
+80105940:	ba a1 00 00 00       	mov    $0xa1,%edx
+80105945:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80105946:	c3                   	ret
+
+80105947 <pipefreepg>:
+  return -1;
+}
+
+static void
+pipefreepg(struct pipe *p)
+{
+80105947:	55                   	push   %ebp
+80105948:	89 e5                	mov    %esp,%ebp
+8010594a:	56                   	push   %esi
+8010594b:	53                   	push   %ebx
+8010594c:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if(p->pg[0] != (char*)(p + 1))
+8010594e:	8d 80 94 00 00 00    	lea    0x94(%eax),%eax
+80105954:	39 46 34             	cmp    %eax,0x34(%esi)
+80105957:	74 1e                	je     80105977 <pipefreepg+0x30>
+    for(i = 0; i < p->npg; i++)
+80105959:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010595e:	eb 12                	jmp    80105972 <pipefreepg+0x2b>
+      kfree(p->pg[i]);
+80105960:	83 ec 0c             	sub    $0xc,%esp
+80105963:	ff 74 9e 34          	push   0x34(%esi,%ebx,4)
+80105967:	e8 a5 ef ff ff       	call   80104911 <kfree>
+    for(i = 0; i < p->npg; i++)
+8010596c:	83 c3 01             	add    $0x1,%ebx
+8010596f:	83 c4 10             	add    $0x10,%esp
+80105972:	39 5e 74             	cmp    %ebx,0x74(%esi)
+80105975:	7f e9                	jg     80105960 <pipefreepg+0x19>
+}
+80105977:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010597a:	5b                   	pop    %ebx
+8010597b:	5e                   	pop    %esi
+8010597c:	5d                   	pop    %ebp
+8010597d:	c3                   	ret
+
+8010597e <pipecopy>:
+{
+8010597e:	55                   	push   %ebp
+8010597f:	89 e5                	mov    %esp,%ebp
+80105981:	57                   	push   %edi
+80105982:	56                   	push   %esi
+80105983:	53                   	push   %ebx
+80105984:	83 ec 1c             	sub    $0x1c,%esp
+80105987:	89 c7                	mov    %eax,%edi
+80105989:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010598c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010598f:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(; n > 0; n -= m, addr += m, i = (i + m) % p->size){
+80105992:	eb 25                	jmp    801059b9 <pipecopy+0x3b>
+      memmove(addr, b, m);
+80105994:	83 ec 04             	sub    $0x4,%esp
+80105997:	53                   	push   %ebx
+80105998:	51                   	push   %ecx
+80105999:	ff 75 e0             	push   -0x20(%ebp)
+8010599c:	e8 65 2d 00 00       	call   80108706 <memmove>
+801059a1:	83 c4 10             	add    $0x10,%esp
+  for(; n > 0; n -= m, addr += m, i = (i + m) % p->size){
+801059a4:	29 de                	sub    %ebx,%esi
+801059a6:	01 5d e0             	add    %ebx,-0x20(%ebp)
+801059a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801059ac:	01 d8                	add    %ebx,%eax
+801059ae:	ba 00 00 00 00       	mov    $0x0,%edx
+801059b3:	f7 77 7c             	divl   0x7c(%edi)
+801059b6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801059b9:	85 f6                	test   %esi,%esi
+801059bb:	74 32                	je     801059ef <pipecopy+0x71>
+    b = p->pg[i / p->pgsize] + i % p->pgsize;
+801059bd:	8b 5f 78             	mov    0x78(%edi),%ebx
+801059c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801059c3:	ba 00 00 00 00       	mov    $0x0,%edx
+801059c8:	f7 f3                	div    %ebx
+801059ca:	89 d1                	mov    %edx,%ecx
+801059cc:	03 4c 87 34          	add    0x34(%edi,%eax,4),%ecx
+    m = min(n, p->pgsize - i % p->pgsize);
+801059d0:	29 d3                	sub    %edx,%ebx
+801059d2:	39 f3                	cmp    %esi,%ebx
+801059d4:	0f 47 de             	cmova  %esi,%ebx
+    if(in)
+801059d7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+801059db:	74 b7                	je     80105994 <pipecopy+0x16>
+      memmove(b, addr, m);
+801059dd:	83 ec 04             	sub    $0x4,%esp
+801059e0:	53                   	push   %ebx
+801059e1:	ff 75 e0             	push   -0x20(%ebp)
+801059e4:	51                   	push   %ecx
+801059e5:	e8 1c 2d 00 00       	call   80108706 <memmove>
+801059ea:	83 c4 10             	add    $0x10,%esp
+801059ed:	eb b5                	jmp    801059a4 <pipecopy+0x26>
+}
+801059ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801059f2:	5b                   	pop    %ebx
+801059f3:	5e                   	pop    %esi
+801059f4:	5f                   	pop    %edi
+801059f5:	5d                   	pop    %ebp
+801059f6:	c3                   	ret
+
+801059f7 <pipein>:
+
+// Move up to n bytes from addr into p's ring, as many as fit.
+// Caller must hold p->lock.
+static int
+pipein(struct pipe *p, char *addr, int n)
+{
+801059f7:	55                   	push   %ebp
+801059f8:	89 e5                	mov    %esp,%ebp
+801059fa:	57                   	push   %edi
+801059fb:	56                   	push   %esi
+801059fc:	53                   	push   %ebx
+801059fd:	83 ec 14             	sub    $0x14,%esp
+80105a00:	89 c3                	mov    %eax,%ebx
+80105a02:	89 d7                	mov    %edx,%edi
+80105a04:	89 ce                	mov    %ecx,%esi
+  int m;
+
+  m = min(n, p->size - (p->nwrite - p->nread));
+80105a06:	8b 88 84 00 00 00    	mov    0x84(%eax),%ecx
+80105a0c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+80105a12:	89 ca                	mov    %ecx,%edx
+80105a14:	29 c2                	sub    %eax,%edx
+80105a16:	03 53 7c             	add    0x7c(%ebx),%edx
+80105a19:	39 d6                	cmp    %edx,%esi
+80105a1b:	0f 47 f2             	cmova  %edx,%esi
+  pipecopy(p, (p->rpos + p->nwrite - p->nread) % p->size, addr, m, 1);
+80105a1e:	03 83 80 00 00 00    	add    0x80(%ebx),%eax
+80105a24:	29 c8                	sub    %ecx,%eax
+80105a26:	ba 00 00 00 00       	mov    $0x0,%edx
+80105a2b:	f7 73 7c             	divl   0x7c(%ebx)
+80105a2e:	6a 01                	push   $0x1
+80105a30:	56                   	push   %esi
+80105a31:	89 f9                	mov    %edi,%ecx
+80105a33:	89 d8                	mov    %ebx,%eax
+80105a35:	e8 44 ff ff ff       	call   8010597e <pipecopy>
+  p->nwrite += m;
+80105a3a:	01 b3 88 00 00 00    	add    %esi,0x88(%ebx)
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+80105a40:	81 c3 84 00 00 00    	add    $0x84,%ebx
+80105a46:	89 1c 24             	mov    %ebx,(%esp)
+80105a49:	e8 fb 13 00 00       	call   80106e49 <wakeup>
+  return m;
+}
+80105a4e:	89 f0                	mov    %esi,%eax
+80105a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105a53:	5b                   	pop    %ebx
+80105a54:	5e                   	pop    %esi
+80105a55:	5f                   	pop    %edi
+80105a56:	5d                   	pop    %ebp
+80105a57:	c3                   	ret
+
+80105a58 <pipeout>:
+
+// Move up to n buffered bytes out of p's ring into addr.
+// Caller must hold p->lock.
+static int
+pipeout(struct pipe *p, char *addr, int n)
+{
+80105a58:	55                   	push   %ebp
+80105a59:	89 e5                	mov    %esp,%ebp
+80105a5b:	56                   	push   %esi
+80105a5c:	53                   	push   %ebx
+80105a5d:	89 c3                	mov    %eax,%ebx
+  int m;
+
+  m = min(n, p->nwrite - p->nread);  //DOC: piperead-copy
+80105a5f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+80105a65:	2b 83 84 00 00 00    	sub    0x84(%ebx),%eax
+80105a6b:	39 c1                	cmp    %eax,%ecx
+80105a6d:	0f 46 c1             	cmovbe %ecx,%eax
+80105a70:	89 c6                	mov    %eax,%esi
+  pipecopy(p, p->rpos, addr, m, 0);
+80105a72:	83 ec 08             	sub    $0x8,%esp
+80105a75:	6a 00                	push   $0x0
+80105a77:	50                   	push   %eax
+80105a78:	89 d1                	mov    %edx,%ecx
+80105a7a:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+80105a80:	89 d8                	mov    %ebx,%eax
+80105a82:	e8 f7 fe ff ff       	call   8010597e <pipecopy>
+  p->rpos = (p->rpos + m) % p->size;
+80105a87:	89 f0                	mov    %esi,%eax
+80105a89:	03 83 80 00 00 00    	add    0x80(%ebx),%eax
+80105a8f:	ba 00 00 00 00       	mov    $0x0,%edx
+80105a94:	f7 73 7c             	divl   0x7c(%ebx)
+80105a97:	89 93 80 00 00 00    	mov    %edx,0x80(%ebx)
+  p->nread += m;
+80105a9d:	01 b3 84 00 00 00    	add    %esi,0x84(%ebx)
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+80105aa3:	81 c3 88 00 00 00    	add    $0x88,%ebx
+80105aa9:	89 1c 24             	mov    %ebx,(%esp)
+80105aac:	e8 98 13 00 00       	call   80106e49 <wakeup>
+  return m;
+}
+80105ab1:	89 f0                	mov    %esi,%eax
+80105ab3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105ab6:	5b                   	pop    %ebx
+80105ab7:	5e                   	pop    %esi
+80105ab8:	5d                   	pop    %ebp
+80105ab9:	c3                   	ret
+
+80105aba <pipealloc>:
+{
+80105aba:	55                   	push   %ebp
+80105abb:	89 e5                	mov    %esp,%ebp
+80105abd:	57                   	push   %edi
+80105abe:	56                   	push   %esi
+80105abf:	53                   	push   %ebx
+80105ac0:	83 ec 0c             	sub    $0xc,%esp
+80105ac3:	8b 75 08             	mov    0x8(%ebp),%esi
+80105ac6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  *f0 = *f1 = 0;
+80105ac9:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80105acf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+80105ad5:	e8 e6 bc ff ff       	call   801017c0 <filealloc>
+80105ada:	89 06                	mov    %eax,(%esi)
+80105adc:	85 c0                	test   %eax,%eax
+80105ade:	0f 84 b8 00 00 00    	je     80105b9c <pipealloc+0xe2>
+80105ae4:	e8 d7 bc ff ff       	call   801017c0 <filealloc>
+80105ae9:	89 07                	mov    %eax,(%edi)
+80105aeb:	85 c0                	test   %eax,%eax
+80105aed:	0f 84 a9 00 00 00    	je     80105b9c <pipealloc+0xe2>
+  if((p = (struct pipe*)kalloc()) == 0)
+80105af3:	e8 38 f0 ff ff       	call   80104b30 <kalloc>
+80105af8:	89 c3                	mov    %eax,%ebx
+80105afa:	85 c0                	test   %eax,%eax
+80105afc:	0f 84 9a 00 00 00    	je     80105b9c <pipealloc+0xe2>
+  p->readopen = 1;
+80105b02:	c7 80 8c 00 00 00 01 	movl   $0x1,0x8c(%eax)
+80105b09:	00 00 00 
+  p->writeopen = 1;
+80105b0c:	c7 80 90 00 00 00 01 	movl   $0x1,0x90(%eax)
+80105b13:	00 00 00 
+  p->pg[0] = (char*)(p + 1);
+80105b16:	8d 80 94 00 00 00    	lea    0x94(%eax),%eax
+80105b1c:	89 43 34             	mov    %eax,0x34(%ebx)
+  p->npg = 1;
+80105b1f:	c7 43 74 01 00 00 00 	movl   $0x1,0x74(%ebx)
+  p->pgsize = PGSIZE - sizeof(*p);
+80105b26:	c7 43 78 6c 0f 00 00 	movl   $0xf6c,0x78(%ebx)
+  p->size = p->pgsize;
+80105b2d:	c7 43 7c 6c 0f 00 00 	movl   $0xf6c,0x7c(%ebx)
+  p->rpos = 0;
+80105b34:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+80105b3b:	00 00 00 
+  p->nwrite = 0;
+80105b3e:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80105b45:	00 00 00 
+  p->nread = 0;
+80105b48:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80105b4f:	00 00 00 
+  initlock(&p->lock, "pipe");
+80105b52:	83 ec 08             	sub    $0x8,%esp
+80105b55:	68 9b c3 10 80       	push   $0x8010c39b
+80105b5a:	53                   	push   %ebx
+80105b5b:	e8 3e 29 00 00       	call   8010849e <initlock>
+  (*f0)->type = FD_PIPE;
+80105b60:	8b 06                	mov    (%esi),%eax
+80105b62:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+80105b68:	8b 06                	mov    (%esi),%eax
+80105b6a:	c6 40 0c 01          	movb   $0x1,0xc(%eax)
+  (*f0)->writable = 0;
+80105b6e:	8b 06                	mov    (%esi),%eax
+80105b70:	c6 40 0d 00          	movb   $0x0,0xd(%eax)
+  (*f0)->pipe = p;
+80105b74:	8b 06                	mov    (%esi),%eax
+80105b76:	89 58 10             	mov    %ebx,0x10(%eax)
+  (*f1)->type = FD_PIPE;
+80105b79:	8b 07                	mov    (%edi),%eax
+80105b7b:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+80105b81:	8b 07                	mov    (%edi),%eax
+80105b83:	c6 40 0c 00          	movb   $0x0,0xc(%eax)
+  (*f1)->writable = 1;
+80105b87:	8b 07                	mov    (%edi),%eax
+80105b89:	c6 40 0d 01          	movb   $0x1,0xd(%eax)
+  (*f1)->pipe = p;
+80105b8d:	8b 07                	mov    (%edi),%eax
+80105b8f:	89 58 10             	mov    %ebx,0x10(%eax)
+  return 0;
+80105b92:	83 c4 10             	add    $0x10,%esp
+80105b95:	b8 00 00 00 00       	mov    $0x0,%eax
+80105b9a:	eb 29                	jmp    80105bc5 <pipealloc+0x10b>
+  if(*f0)
+80105b9c:	8b 06                	mov    (%esi),%eax
+80105b9e:	85 c0                	test   %eax,%eax
+80105ba0:	74 0c                	je     80105bae <pipealloc+0xf4>
+    fileclose(*f0);
+80105ba2:	83 ec 0c             	sub    $0xc,%esp
+80105ba5:	50                   	push   %eax
+80105ba6:	e8 d0 bc ff ff       	call   8010187b <fileclose>
+80105bab:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+80105bae:	8b 07                	mov    (%edi),%eax
+80105bb0:	85 c0                	test   %eax,%eax
+80105bb2:	74 19                	je     80105bcd <pipealloc+0x113>
+    fileclose(*f1);
+80105bb4:	83 ec 0c             	sub    $0xc,%esp
+80105bb7:	50                   	push   %eax
+80105bb8:	e8 be bc ff ff       	call   8010187b <fileclose>
+80105bbd:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80105bc0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105bc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105bc8:	5b                   	pop    %ebx
+80105bc9:	5e                   	pop    %esi
+80105bca:	5f                   	pop    %edi
+80105bcb:	5d                   	pop    %ebp
+80105bcc:	c3                   	ret
+  return -1;
+80105bcd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105bd2:	eb f1                	jmp    80105bc5 <pipealloc+0x10b>
+
+80105bd4 <pipeclose>:
+{
+80105bd4:	55                   	push   %ebp
+80105bd5:	89 e5                	mov    %esp,%ebp
+80105bd7:	53                   	push   %ebx
+80105bd8:	83 ec 10             	sub    $0x10,%esp
+80105bdb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&p->lock);
+80105bde:	53                   	push   %ebx
+80105bdf:	e8 fe 29 00 00       	call   801085e2 <acquire>
+  if(writable){
+80105be4:	83 c4 10             	add    $0x10,%esp
+80105be7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+80105beb:	74 3f                	je     80105c2c <pipeclose+0x58>
+    p->writeopen = 0;
+80105bed:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+80105bf4:	00 00 00 
+    wakeup(&p->nread);
+80105bf7:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+80105bfd:	83 ec 0c             	sub    $0xc,%esp
+80105c00:	50                   	push   %eax
+80105c01:	e8 43 12 00 00       	call   80106e49 <wakeup>
+80105c06:	83 c4 10             	add    $0x10,%esp
+  if(p->readopen == 0 && p->writeopen == 0){
+80105c09:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+80105c10:	75 09                	jne    80105c1b <pipeclose+0x47>
+80105c12:	83 bb 90 00 00 00 00 	cmpl   $0x0,0x90(%ebx)
+80105c19:	74 2f                	je     80105c4a <pipeclose+0x76>
+    release(&p->lock);
+80105c1b:	83 ec 0c             	sub    $0xc,%esp
+80105c1e:	53                   	push   %ebx
+80105c1f:	e8 23 2a 00 00       	call   80108647 <release>
+80105c24:	83 c4 10             	add    $0x10,%esp
+}
+80105c27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105c2a:	c9                   	leave
+80105c2b:	c3                   	ret
+    p->readopen = 0;
+80105c2c:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+80105c33:	00 00 00 
+    wakeup(&p->nwrite);
+80105c36:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+80105c3c:	83 ec 0c             	sub    $0xc,%esp
+80105c3f:	50                   	push   %eax
+80105c40:	e8 04 12 00 00       	call   80106e49 <wakeup>
+80105c45:	83 c4 10             	add    $0x10,%esp
+80105c48:	eb bf                	jmp    80105c09 <pipeclose+0x35>
+    release(&p->lock);
+80105c4a:	83 ec 0c             	sub    $0xc,%esp
+80105c4d:	53                   	push   %ebx
+80105c4e:	e8 f4 29 00 00       	call   80108647 <release>
+    pipefreepg(p);
+80105c53:	89 d8                	mov    %ebx,%eax
+80105c55:	e8 ed fc ff ff       	call   80105947 <pipefreepg>
+    kfree((char*)p);
+80105c5a:	89 1c 24             	mov    %ebx,(%esp)
+80105c5d:	e8 af ec ff ff       	call   80104911 <kfree>
+80105c62:	83 c4 10             	add    $0x10,%esp
+80105c65:	eb c0                	jmp    80105c27 <pipeclose+0x53>
+
+80105c67 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+80105c67:	55                   	push   %ebp
+80105c68:	89 e5                	mov    %esp,%ebp
+80105c6a:	57                   	push   %edi
+80105c6b:	56                   	push   %esi
+80105c6c:	53                   	push   %ebx
+80105c6d:	83 ec 18             	sub    $0x18,%esp
+80105c70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80105c73:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i, m;
+
+  acquire(&p->lock);
+80105c76:	53                   	push   %ebx
+80105c77:	e8 66 29 00 00       	call   801085e2 <acquire>
+  for(i = 0; i < n; i += m){
+80105c7c:	83 c4 10             	add    $0x10,%esp
+80105c7f:	bf 00 00 00 00       	mov    $0x0,%edi
+80105c84:	39 f7                	cmp    %esi,%edi
+80105c86:	7c 32                	jl     80105cba <pipewrite+0x53>
+      wakeup(&p->nread);
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+    }
+    m = pipein(p, addr + i, n - i);
+  }
+  release(&p->lock);
+80105c88:	83 ec 0c             	sub    $0xc,%esp
+80105c8b:	53                   	push   %ebx
+80105c8c:	e8 b6 29 00 00       	call   80108647 <release>
+  return n;
+80105c91:	83 c4 10             	add    $0x10,%esp
+80105c94:	89 f0                	mov    %esi,%eax
+80105c96:	eb 58                	jmp    80105cf0 <pipewrite+0x89>
+      wakeup(&p->nread);
+80105c98:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+80105c9e:	83 ec 0c             	sub    $0xc,%esp
+80105ca1:	50                   	push   %eax
+80105ca2:	e8 a2 11 00 00       	call   80106e49 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80105ca7:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+80105cad:	83 c4 08             	add    $0x8,%esp
+80105cb0:	53                   	push   %ebx
+80105cb1:	50                   	push   %eax
+80105cb2:	e8 b5 1b 00 00       	call   8010786c <sleep>
+80105cb7:	83 c4 10             	add    $0x10,%esp
+    while(p->nwrite == p->nread + p->size){  //DOC: pipewrite-full
+80105cba:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80105cbd:	03 83 84 00 00 00    	add    0x84(%ebx),%eax
+80105cc3:	39 83 88 00 00 00    	cmp    %eax,0x88(%ebx)
+80105cc9:	75 2d                	jne    80105cf8 <pipewrite+0x91>
+      if(p->readopen == 0 || myproc()->killed){
+80105ccb:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+80105cd2:	74 0b                	je     80105cdf <pipewrite+0x78>
+80105cd4:	e8 73 0c 00 00       	call   8010694c <myproc>
+80105cd9:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80105cdd:	74 b9                	je     80105c98 <pipewrite+0x31>
+        release(&p->lock);
+80105cdf:	83 ec 0c             	sub    $0xc,%esp
+80105ce2:	53                   	push   %ebx
+80105ce3:	e8 5f 29 00 00       	call   80108647 <release>
+        return -1;
+80105ce8:	83 c4 10             	add    $0x10,%esp
+80105ceb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105cf3:	5b                   	pop    %ebx
+80105cf4:	5e                   	pop    %esi
+80105cf5:	5f                   	pop    %edi
+80105cf6:	5d                   	pop    %ebp
+80105cf7:	c3                   	ret
+    m = pipein(p, addr + i, n - i);
+80105cf8:	89 f1                	mov    %esi,%ecx
+80105cfa:	29 f9                	sub    %edi,%ecx
+80105cfc:	89 fa                	mov    %edi,%edx
+80105cfe:	03 55 0c             	add    0xc(%ebp),%edx
+80105d01:	89 d8                	mov    %ebx,%eax
+80105d03:	e8 ef fc ff ff       	call   801059f7 <pipein>
+  for(i = 0; i < n; i += m){
+80105d08:	01 c7                	add    %eax,%edi
+80105d0a:	e9 75 ff ff ff       	jmp    80105c84 <pipewrite+0x1d>
+
+80105d0f <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80105d0f:	55                   	push   %ebp
+80105d10:	89 e5                	mov    %esp,%ebp
+80105d12:	56                   	push   %esi
+80105d13:	53                   	push   %ebx
+80105d14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int m;
+
+  acquire(&p->lock);
+80105d17:	83 ec 0c             	sub    $0xc,%esp
+80105d1a:	53                   	push   %ebx
+80105d1b:	e8 c2 28 00 00       	call   801085e2 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80105d20:	83 c4 10             	add    $0x10,%esp
+80105d23:	eb 13                	jmp    80105d38 <piperead+0x29>
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80105d25:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+80105d2b:	83 ec 08             	sub    $0x8,%esp
+80105d2e:	53                   	push   %ebx
+80105d2f:	50                   	push   %eax
+80105d30:	e8 37 1b 00 00       	call   8010786c <sleep>
+80105d35:	83 c4 10             	add    $0x10,%esp
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80105d38:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+80105d3e:	39 83 84 00 00 00    	cmp    %eax,0x84(%ebx)
+80105d44:	75 27                	jne    80105d6d <piperead+0x5e>
+80105d46:	83 bb 90 00 00 00 00 	cmpl   $0x0,0x90(%ebx)
+80105d4d:	74 1e                	je     80105d6d <piperead+0x5e>
+    if(myproc()->killed){
+80105d4f:	e8 f8 0b 00 00       	call   8010694c <myproc>
+80105d54:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80105d58:	74 cb                	je     80105d25 <piperead+0x16>
+      release(&p->lock);
+80105d5a:	83 ec 0c             	sub    $0xc,%esp
+80105d5d:	53                   	push   %ebx
+80105d5e:	e8 e4 28 00 00       	call   80108647 <release>
+      return -1;
+80105d63:	83 c4 10             	add    $0x10,%esp
+80105d66:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105d6b:	eb 1b                	jmp    80105d88 <piperead+0x79>
+  }
+  m = pipeout(p, addr, n);
+80105d6d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80105d70:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105d73:	89 d8                	mov    %ebx,%eax
+80105d75:	e8 de fc ff ff       	call   80105a58 <pipeout>
+80105d7a:	89 c6                	mov    %eax,%esi
+  release(&p->lock);
+80105d7c:	83 ec 0c             	sub    $0xc,%esp
+80105d7f:	53                   	push   %ebx
+80105d80:	e8 c2 28 00 00       	call   80108647 <release>
+  return m;
+80105d85:	83 c4 10             	add    $0x10,%esp
+}
+80105d88:	89 f0                	mov    %esi,%eax
+80105d8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105d8d:	5b                   	pop    %ebx
+80105d8e:	5e                   	pop    %esi
+80105d8f:	5d                   	pop    %ebp
+80105d90:	c3                   	ret
+
+80105d91 <pipewait>:
+// pipeget and pipemove then move what they can without sleeping,
+// so callers can hold other locks.
+
+int
+pipewait(struct pipe *p, int wr)
+{
+80105d91:	55                   	push   %ebp
+80105d92:	89 e5                	mov    %esp,%ebp
+80105d94:	57                   	push   %edi
+80105d95:	56                   	push   %esi
+80105d96:	53                   	push   %ebx
+80105d97:	83 ec 18             	sub    $0x18,%esp
+80105d9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80105d9d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int n;
+
+  acquire(&p->lock);
+80105da0:	53                   	push   %ebx
+80105da1:	e8 3c 28 00 00       	call   801085e2 <acquire>
+80105da6:	83 c4 10             	add    $0x10,%esp
+80105da9:	eb 38                	jmp    80105de3 <pipewait+0x52>
+  for(;;){
+    if(myproc()->killed || (wr && p->readopen == 0)){
+      n = -1;
+      break;
+    }
+    n = wr ? p->size - (p->nwrite - p->nread) : p->nwrite - p->nread;
+80105dab:	8b b3 88 00 00 00    	mov    0x88(%ebx),%esi
+80105db1:	2b b3 84 00 00 00    	sub    0x84(%ebx),%esi
+    if(n > 0 || (!wr && p->writeopen == 0))
+80105db7:	85 f6                	test   %esi,%esi
+80105db9:	7f 56                	jg     80105e11 <pipewait+0x80>
+80105dbb:	85 ff                	test   %edi,%edi
+80105dbd:	75 11                	jne    80105dd0 <pipewait+0x3f>
+80105dbf:	83 bb 90 00 00 00 00 	cmpl   $0x0,0x90(%ebx)
+80105dc6:	74 49                	je     80105e11 <pipewait+0x80>
+      break;
+    sleep(wr ? &p->nwrite : &p->nread, &p->lock);
+80105dc8:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+80105dce:	eb 06                	jmp    80105dd6 <pipewait+0x45>
+80105dd0:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+80105dd6:	83 ec 08             	sub    $0x8,%esp
+80105dd9:	53                   	push   %ebx
+80105dda:	50                   	push   %eax
+80105ddb:	e8 8c 1a 00 00       	call   8010786c <sleep>
+    if(myproc()->killed || (wr && p->readopen == 0)){
+80105de0:	83 c4 10             	add    $0x10,%esp
+80105de3:	e8 64 0b 00 00       	call   8010694c <myproc>
+80105de8:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80105dec:	75 1e                	jne    80105e0c <pipewait+0x7b>
+80105dee:	85 ff                	test   %edi,%edi
+80105df0:	74 b9                	je     80105dab <pipewait+0x1a>
+80105df2:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+80105df9:	74 29                	je     80105e24 <pipewait+0x93>
+    n = wr ? p->size - (p->nwrite - p->nread) : p->nwrite - p->nread;
+80105dfb:	8b b3 84 00 00 00    	mov    0x84(%ebx),%esi
+80105e01:	2b b3 88 00 00 00    	sub    0x88(%ebx),%esi
+80105e07:	03 73 7c             	add    0x7c(%ebx),%esi
+80105e0a:	eb ab                	jmp    80105db7 <pipewait+0x26>
+      n = -1;
+80105e0c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  }
+  release(&p->lock);
+80105e11:	83 ec 0c             	sub    $0xc,%esp
+80105e14:	53                   	push   %ebx
+80105e15:	e8 2d 28 00 00       	call   80108647 <release>
+  return n;
+}
+80105e1a:	89 f0                	mov    %esi,%eax
+80105e1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105e1f:	5b                   	pop    %ebx
+80105e20:	5e                   	pop    %esi
+80105e21:	5f                   	pop    %edi
+80105e22:	5d                   	pop    %ebp
+80105e23:	c3                   	ret
+      n = -1;
+80105e24:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105e29:	eb e6                	jmp    80105e11 <pipewait+0x80>
+
+80105e2b <pipeput>:
+
+// Write up to n bytes from addr to p. Returns the number
+// written, or -1 if the read end is closed.
+int
+pipeput(struct pipe *p, char *addr, int n)
+{
+80105e2b:	55                   	push   %ebp
+80105e2c:	89 e5                	mov    %esp,%ebp
+80105e2e:	56                   	push   %esi
+80105e2f:	53                   	push   %ebx
+80105e30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int m;
+
+  acquire(&p->lock);
+80105e33:	83 ec 0c             	sub    $0xc,%esp
+80105e36:	53                   	push   %ebx
+80105e37:	e8 a6 27 00 00       	call   801085e2 <acquire>
+  m = p->readopen ? pipein(p, addr, n) : -1;
+80105e3c:	83 c4 10             	add    $0x10,%esp
+80105e3f:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+80105e46:	74 21                	je     80105e69 <pipeput+0x3e>
+80105e48:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80105e4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105e4e:	89 d8                	mov    %ebx,%eax
+80105e50:	e8 a2 fb ff ff       	call   801059f7 <pipein>
+80105e55:	89 c6                	mov    %eax,%esi
+  release(&p->lock);
+80105e57:	83 ec 0c             	sub    $0xc,%esp
+80105e5a:	53                   	push   %ebx
+80105e5b:	e8 e7 27 00 00       	call   80108647 <release>
+  return m;
+}
+80105e60:	89 f0                	mov    %esi,%eax
+80105e62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105e65:	5b                   	pop    %ebx
+80105e66:	5e                   	pop    %esi
+80105e67:	5d                   	pop    %ebp
+80105e68:	c3                   	ret
+  m = p->readopen ? pipein(p, addr, n) : -1;
+80105e69:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105e6e:	eb e7                	jmp    80105e57 <pipeput+0x2c>
+
+80105e70 <pipeget>:
+
+// Read up to n bytes from p to addr. Returns the number read.
+int
+pipeget(struct pipe *p, char *addr, int n)
+{
+80105e70:	55                   	push   %ebp
+80105e71:	89 e5                	mov    %esp,%ebp
+80105e73:	56                   	push   %esi
+80105e74:	53                   	push   %ebx
+80105e75:	8b 75 08             	mov    0x8(%ebp),%esi
+  int m;
+
+  acquire(&p->lock);
+80105e78:	83 ec 0c             	sub    $0xc,%esp
+80105e7b:	56                   	push   %esi
+80105e7c:	e8 61 27 00 00       	call   801085e2 <acquire>
+  m = pipeout(p, addr, n);
+80105e81:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80105e84:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105e87:	89 f0                	mov    %esi,%eax
+80105e89:	e8 ca fb ff ff       	call   80105a58 <pipeout>
+80105e8e:	89 c3                	mov    %eax,%ebx
+  release(&p->lock);
+80105e90:	89 34 24             	mov    %esi,(%esp)
+80105e93:	e8 af 27 00 00       	call   80108647 <release>
+  return m;
+}
+80105e98:	89 d8                	mov    %ebx,%eax
+80105e9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105e9d:	5b                   	pop    %ebx
+80105e9e:	5e                   	pop    %esi
+80105e9f:	5d                   	pop    %ebp
+80105ea0:	c3                   	ret
+
+80105ea1 <pipemove>:
+
+// Move up to n bytes from pipe in to pipe out, ring to ring.
+// Returns the number moved, or -1 if out's read end is closed.
+int
+pipemove(struct pipe *in, struct pipe *out, int n)
+{
+80105ea1:	55                   	push   %ebp
+80105ea2:	89 e5                	mov    %esp,%ebp
+80105ea4:	57                   	push   %edi
+80105ea5:	56                   	push   %esi
+80105ea6:	53                   	push   %ebx
+80105ea7:	83 ec 1c             	sub    $0x1c,%esp
+80105eaa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int m, tot;
+  uint k;
+
+  if(in == out)
+80105ead:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+80105eb0:	0f 84 fa 00 00 00    	je     80105fb0 <pipemove+0x10f>
+    return -1;
+  // Lock in address order.
+  acquire(in < out ? &in->lock : &out->lock);
+80105eb6:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+80105eb9:	0f 83 a4 00 00 00    	jae    80105f63 <pipemove+0xc2>
+80105ebf:	89 d8                	mov    %ebx,%eax
+80105ec1:	83 ec 0c             	sub    $0xc,%esp
+80105ec4:	50                   	push   %eax
+80105ec5:	e8 18 27 00 00       	call   801085e2 <acquire>
+  acquire(in < out ? &out->lock : &in->lock);
+80105eca:	83 c4 10             	add    $0x10,%esp
+80105ecd:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+80105ed0:	0f 83 95 00 00 00    	jae    80105f6b <pipemove+0xca>
+80105ed6:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105ed9:	83 ec 0c             	sub    $0xc,%esp
+80105edc:	50                   	push   %eax
+80105edd:	e8 00 27 00 00       	call   801085e2 <acquire>
+  if(out->readopen == 0){
+80105ee2:	83 c4 10             	add    $0x10,%esp
+80105ee5:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105ee8:	83 b8 8c 00 00 00 00 	cmpl   $0x0,0x8c(%eax)
+80105eef:	0f 84 95 00 00 00    	je     80105f8a <pipemove+0xe9>
+    tot = -1;
+  } else {
+    n = min(n, in->nwrite - in->nread);
+80105ef5:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+80105efb:	2b 83 84 00 00 00    	sub    0x84(%ebx),%eax
+80105f01:	39 45 10             	cmp    %eax,0x10(%ebp)
+80105f04:	0f 46 45 10          	cmovbe 0x10(%ebp),%eax
+80105f08:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(tot = 0; tot < n; tot += m){
+80105f0b:	be 00 00 00 00       	mov    $0x0,%esi
+80105f10:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105f13:	39 c6                	cmp    %eax,%esi
+80105f15:	7d 5b                	jge    80105f72 <pipemove+0xd1>
+      k = in->rpos;
+80105f17:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+      m = min(n - tot, in->pgsize - k % in->pgsize);
+80105f1d:	8b 4b 78             	mov    0x78(%ebx),%ecx
+80105f20:	ba 00 00 00 00       	mov    $0x0,%edx
+80105f25:	f7 f1                	div    %ecx
+80105f27:	29 d1                	sub    %edx,%ecx
+80105f29:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80105f2c:	29 f7                	sub    %esi,%edi
+80105f2e:	39 f9                	cmp    %edi,%ecx
+80105f30:	0f 47 cf             	cmova  %edi,%ecx
+      if((m = pipein(out, in->pg[k / in->pgsize] + k % in->pgsize, m)) == 0)
+80105f33:	03 54 83 34          	add    0x34(%ebx,%eax,4),%edx
+80105f37:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105f3a:	e8 b8 fa ff ff       	call   801059f7 <pipein>
+80105f3f:	89 c1                	mov    %eax,%ecx
+80105f41:	85 c0                	test   %eax,%eax
+80105f43:	74 2d                	je     80105f72 <pipemove+0xd1>
+        break;
+      in->rpos = (in->rpos + m) % in->size;
+80105f45:	03 83 80 00 00 00    	add    0x80(%ebx),%eax
+80105f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+80105f50:	f7 73 7c             	divl   0x7c(%ebx)
+80105f53:	89 93 80 00 00 00    	mov    %edx,0x80(%ebx)
+      in->nread += m;
+80105f59:	01 8b 84 00 00 00    	add    %ecx,0x84(%ebx)
+    for(tot = 0; tot < n; tot += m){
+80105f5f:	01 ce                	add    %ecx,%esi
+80105f61:	eb ad                	jmp    80105f10 <pipemove+0x6f>
+  acquire(in < out ? &in->lock : &out->lock);
+80105f63:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105f66:	e9 56 ff ff ff       	jmp    80105ec1 <pipemove+0x20>
+  acquire(in < out ? &out->lock : &in->lock);
+80105f6b:	89 d8                	mov    %ebx,%eax
+80105f6d:	e9 67 ff ff ff       	jmp    80105ed9 <pipemove+0x38>
+    }
+    if(tot > 0)
+80105f72:	85 f6                	test   %esi,%esi
+80105f74:	7e 19                	jle    80105f8f <pipemove+0xee>
+      wakeup(&in->nwrite);
+80105f76:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+80105f7c:	83 ec 0c             	sub    $0xc,%esp
+80105f7f:	50                   	push   %eax
+80105f80:	e8 c4 0e 00 00       	call   80106e49 <wakeup>
+80105f85:	83 c4 10             	add    $0x10,%esp
+80105f88:	eb 05                	jmp    80105f8f <pipemove+0xee>
+    tot = -1;
+80105f8a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  }
+  release(&in->lock);
+80105f8f:	83 ec 0c             	sub    $0xc,%esp
+80105f92:	53                   	push   %ebx
+80105f93:	e8 af 26 00 00       	call   80108647 <release>
+  release(&out->lock);
+80105f98:	83 c4 04             	add    $0x4,%esp
+80105f9b:	ff 75 0c             	push   0xc(%ebp)
+80105f9e:	e8 a4 26 00 00       	call   80108647 <release>
+  return tot;
+80105fa3:	83 c4 10             	add    $0x10,%esp
+}
+80105fa6:	89 f0                	mov    %esi,%eax
+80105fa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105fab:	5b                   	pop    %ebx
+80105fac:	5e                   	pop    %esi
+80105fad:	5f                   	pop    %edi
+80105fae:	5d                   	pop    %ebp
+80105faf:	c3                   	ret
+    return -1;
+80105fb0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105fb5:	eb ef                	jmp    80105fa6 <pipemove+0x105>
+
+80105fb7 <piperesize>:
+// Grow p's ring buffer to hold at least n bytes, in pages.
+// Returns the new size, or -1 if n is over PIPEMAX or memory
+// is short. The buffer never shrinks.
+int
+piperesize(struct pipe *p, int n)
+{
+80105fb7:	55                   	push   %ebp
+80105fb8:	89 e5                	mov    %esp,%ebp
+80105fba:	57                   	push   %edi
+80105fbb:	56                   	push   %esi
+80105fbc:	53                   	push   %ebx
+80105fbd:	83 ec 5c             	sub    $0x5c,%esp
+80105fc0:	8b 75 08             	mov    0x8(%ebp),%esi
+80105fc3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *pg[PIPEMAXPG];
+  int npg, i;
+  uint j, k, m, cnt;
+
+  if(n < 0 || n > PIPEMAX)
+80105fc6:	3d 00 00 01 00       	cmp    $0x10000,%eax
+80105fcb:	0f 87 7a 01 00 00    	ja     8010614b <piperesize+0x194>
+    return -1;
+  npg = (n + PGSIZE - 1) / PGSIZE;
+80105fd1:	8d 90 fe 1f 00 00    	lea    0x1ffe(%eax),%edx
+80105fd7:	05 ff 0f 00 00       	add    $0xfff,%eax
+80105fdc:	0f 48 c2             	cmovs  %edx,%eax
+80105fdf:	89 c3                	mov    %eax,%ebx
+80105fe1:	c1 fb 0c             	sar    $0xc,%ebx
+  if(npg * PGSIZE <= p->size)
+80105fe4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80105fe9:	89 c2                	mov    %eax,%edx
+80105feb:	89 45 9c             	mov    %eax,-0x64(%ebp)
+80105fee:	8b 46 7c             	mov    0x7c(%esi),%eax
+80105ff1:	39 d0                	cmp    %edx,%eax
+80105ff3:	73 34                	jae    80106029 <piperesize+0x72>
+    return p->size;
+  for(i = 0; i < npg; i++){
+80105ff5:	bf 00 00 00 00       	mov    $0x0,%edi
+80105ffa:	39 df                	cmp    %ebx,%edi
+80105ffc:	7d 33                	jge    80106031 <piperesize+0x7a>
+    if((pg[i] = kalloc()) == 0){
+80105ffe:	e8 2d eb ff ff       	call   80104b30 <kalloc>
+80106003:	89 44 bd a8          	mov    %eax,-0x58(%ebp,%edi,4)
+80106007:	85 c0                	test   %eax,%eax
+80106009:	74 14                	je     8010601f <piperesize+0x68>
+  for(i = 0; i < npg; i++){
+8010600b:	83 c7 01             	add    $0x1,%edi
+8010600e:	eb ea                	jmp    80105ffa <piperesize+0x43>
+      while(--i >= 0)
+        kfree(pg[i]);
+80106010:	83 ec 0c             	sub    $0xc,%esp
+80106013:	ff 74 bd a8          	push   -0x58(%ebp,%edi,4)
+80106017:	e8 f5 e8 ff ff       	call   80104911 <kfree>
+8010601c:	83 c4 10             	add    $0x10,%esp
+      while(--i >= 0)
+8010601f:	83 ef 01             	sub    $0x1,%edi
+80106022:	79 ec                	jns    80106010 <piperesize+0x59>
+      return -1;
+80106024:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  p->size = npg * PGSIZE;
+  p->rpos = 0;
+  wakeup(&p->nwrite);
+  release(&p->lock);
+  return p->size;
+}
+80106029:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010602c:	5b                   	pop    %ebx
+8010602d:	5e                   	pop    %esi
+8010602e:	5f                   	pop    %edi
+8010602f:	5d                   	pop    %ebp
+80106030:	c3                   	ret
+  acquire(&p->lock);
+80106031:	83 ec 0c             	sub    $0xc,%esp
+80106034:	56                   	push   %esi
+80106035:	e8 a8 25 00 00       	call   801085e2 <acquire>
+  if(npg * PGSIZE <= p->size){  // someone else grew it
+8010603a:	83 c4 10             	add    $0x10,%esp
+8010603d:	8b 45 9c             	mov    -0x64(%ebp),%eax
+80106040:	39 46 7c             	cmp    %eax,0x7c(%esi)
+80106043:	73 1c                	jae    80106061 <piperesize+0xaa>
+  cnt = p->nwrite - p->nread;
+80106045:	8b 86 88 00 00 00    	mov    0x88(%esi),%eax
+8010604b:	2b 86 84 00 00 00    	sub    0x84(%esi),%eax
+80106051:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  for(j = 0; j < cnt; j += m){
+80106054:	bf 00 00 00 00       	mov    $0x0,%edi
+80106059:	89 5d 98             	mov    %ebx,-0x68(%ebp)
+8010605c:	e9 8c 00 00 00       	jmp    801060ed <piperesize+0x136>
+    release(&p->lock);
+80106061:	83 ec 0c             	sub    $0xc,%esp
+80106064:	56                   	push   %esi
+80106065:	e8 dd 25 00 00       	call   80108647 <release>
+    for(i = 0; i < npg; i++)
+8010606a:	83 c4 10             	add    $0x10,%esp
+8010606d:	bf 00 00 00 00       	mov    $0x0,%edi
+80106072:	eb 12                	jmp    80106086 <piperesize+0xcf>
+      kfree(pg[i]);
+80106074:	83 ec 0c             	sub    $0xc,%esp
+80106077:	ff 74 bd a8          	push   -0x58(%ebp,%edi,4)
+8010607b:	e8 91 e8 ff ff       	call   80104911 <kfree>
+    for(i = 0; i < npg; i++)
+80106080:	83 c7 01             	add    $0x1,%edi
+80106083:	83 c4 10             	add    $0x10,%esp
+80106086:	39 df                	cmp    %ebx,%edi
+80106088:	7c ea                	jl     80106074 <piperesize+0xbd>
+    return p->size;
+8010608a:	8b 46 7c             	mov    0x7c(%esi),%eax
+8010608d:	eb 9a                	jmp    80106029 <piperesize+0x72>
+    k = (p->rpos + j) % p->size;
+8010608f:	89 f8                	mov    %edi,%eax
+80106091:	03 86 80 00 00 00    	add    0x80(%esi),%eax
+80106097:	ba 00 00 00 00       	mov    $0x0,%edx
+8010609c:	f7 76 7c             	divl   0x7c(%esi)
+    m = min(cnt - j, p->pgsize - k % p->pgsize);
+8010609f:	8b 4e 78             	mov    0x78(%esi),%ecx
+801060a2:	89 d0                	mov    %edx,%eax
+801060a4:	ba 00 00 00 00       	mov    $0x0,%edx
+801060a9:	f7 f1                	div    %ecx
+801060ab:	89 45 a0             	mov    %eax,-0x60(%ebp)
+801060ae:	29 d1                	sub    %edx,%ecx
+801060b0:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+801060b3:	29 f8                	sub    %edi,%eax
+801060b5:	39 c1                	cmp    %eax,%ecx
+801060b7:	0f 47 c8             	cmova  %eax,%ecx
+    m = min(m, PGSIZE - j % PGSIZE);
+801060ba:	89 f8                	mov    %edi,%eax
+801060bc:	25 ff 0f 00 00       	and    $0xfff,%eax
+801060c1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+801060c6:	29 c3                	sub    %eax,%ebx
+801060c8:	39 cb                	cmp    %ecx,%ebx
+801060ca:	0f 47 d9             	cmova  %ecx,%ebx
+    memmove(pg[j / PGSIZE] + j % PGSIZE, p->pg[k / p->pgsize] + k % p->pgsize, m);
+801060cd:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+801060d0:	03 54 8e 34          	add    0x34(%esi,%ecx,4),%edx
+801060d4:	89 f9                	mov    %edi,%ecx
+801060d6:	c1 e9 0c             	shr    $0xc,%ecx
+801060d9:	03 44 8d a8          	add    -0x58(%ebp,%ecx,4),%eax
+801060dd:	83 ec 04             	sub    $0x4,%esp
+801060e0:	53                   	push   %ebx
+801060e1:	52                   	push   %edx
+801060e2:	50                   	push   %eax
+801060e3:	e8 1e 26 00 00       	call   80108706 <memmove>
+  for(j = 0; j < cnt; j += m){
+801060e8:	01 df                	add    %ebx,%edi
+801060ea:	83 c4 10             	add    $0x10,%esp
+801060ed:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+801060f0:	39 c7                	cmp    %eax,%edi
+801060f2:	72 9b                	jb     8010608f <piperesize+0xd8>
+  pipefreepg(p);
+801060f4:	8b 5d 98             	mov    -0x68(%ebp),%ebx
+801060f7:	89 f0                	mov    %esi,%eax
+801060f9:	e8 49 f8 ff ff       	call   80105947 <pipefreepg>
+  memmove(p->pg, pg, sizeof(pg));
+801060fe:	8d 46 34             	lea    0x34(%esi),%eax
+80106101:	83 ec 04             	sub    $0x4,%esp
+80106104:	6a 40                	push   $0x40
+80106106:	8d 55 a8             	lea    -0x58(%ebp),%edx
+80106109:	52                   	push   %edx
+8010610a:	50                   	push   %eax
+8010610b:	e8 f6 25 00 00       	call   80108706 <memmove>
+  p->npg = npg;
+80106110:	89 5e 74             	mov    %ebx,0x74(%esi)
+  p->pgsize = PGSIZE;
+80106113:	c7 46 78 00 10 00 00 	movl   $0x1000,0x78(%esi)
+  p->size = npg * PGSIZE;
+8010611a:	8b 45 9c             	mov    -0x64(%ebp),%eax
+8010611d:	89 46 7c             	mov    %eax,0x7c(%esi)
+  p->rpos = 0;
+80106120:	c7 86 80 00 00 00 00 	movl   $0x0,0x80(%esi)
+80106127:	00 00 00 
+  wakeup(&p->nwrite);
+8010612a:	8d 86 88 00 00 00    	lea    0x88(%esi),%eax
+80106130:	89 04 24             	mov    %eax,(%esp)
+80106133:	e8 11 0d 00 00       	call   80106e49 <wakeup>
+  release(&p->lock);
+80106138:	89 34 24             	mov    %esi,(%esp)
+8010613b:	e8 07 25 00 00       	call   80108647 <release>
+  return p->size;
+80106140:	8b 46 7c             	mov    0x7c(%esi),%eax
+80106143:	83 c4 10             	add    $0x10,%esp
+80106146:	e9 de fe ff ff       	jmp    80106029 <piperesize+0x72>
+    return -1;
+8010614b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106150:	e9 d4 fe ff ff       	jmp    80106029 <piperesize+0x72>
+
+80106155 <stateListRemove>:
+}
+
+static int
+stateListRemove(struct ptrs* list, struct proc* p)
+{
+  if(p == NULL || p->list != list){
+80106155:	85 d2                	test   %edx,%edx
+80106157:	74 79                	je     801061d2 <stateListRemove+0x7d>
+80106159:	89 c1                	mov    %eax,%ecx
+8010615b:	89 d0                	mov    %edx,%eax
+8010615d:	39 8a ec 00 00 00    	cmp    %ecx,0xec(%edx)
+80106163:	75 73                	jne    801061d8 <stateListRemove+0x83>
+{
+80106165:	55                   	push   %ebp
+80106166:	89 e5                	mov    %esp,%ebp
+80106168:	53                   	push   %ebx
+    return -1;
+  }
+
+  if(p->prev)
+80106169:	8b 92 e8 00 00 00    	mov    0xe8(%edx),%edx
+8010616f:	85 d2                	test   %edx,%edx
+80106171:	74 4a                	je     801061bd <stateListRemove+0x68>
+    p->prev->next = p->next;
+80106173:	8b 98 e4 00 00 00    	mov    0xe4(%eax),%ebx
+80106179:	89 9a e4 00 00 00    	mov    %ebx,0xe4(%edx)
+  else
+    (*list).head = p->next;
+
+  if(p->next)
+8010617f:	8b 90 e4 00 00 00    	mov    0xe4(%eax),%edx
+80106185:	85 d2                	test   %edx,%edx
+80106187:	74 3e                	je     801061c7 <stateListRemove+0x72>
+    p->next->prev = p->prev;
+80106189:	8b 88 e8 00 00 00    	mov    0xe8(%eax),%ecx
+8010618f:	89 8a e8 00 00 00    	mov    %ecx,0xe8(%edx)
+  else
+    (*list).tail = p->prev;
+
+  // Make sure p doesn't point into the list.
+  p->next = NULL;
+80106195:	c7 80 e4 00 00 00 00 	movl   $0x0,0xe4(%eax)
+8010619c:	00 00 00 
+  p->prev = NULL;
+8010619f:	c7 80 e8 00 00 00 00 	movl   $0x0,0xe8(%eax)
+801061a6:	00 00 00 
+  p->list = NULL;
+801061a9:	c7 80 ec 00 00 00 00 	movl   $0x0,0xec(%eax)
+801061b0:	00 00 00 
+
+  return 0;
+801061b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801061b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801061bb:	c9                   	leave
+801061bc:	c3                   	ret
+    (*list).head = p->next;
+801061bd:	8b 90 e4 00 00 00    	mov    0xe4(%eax),%edx
+801061c3:	89 11                	mov    %edx,(%ecx)
+801061c5:	eb b8                	jmp    8010617f <stateListRemove+0x2a>
+    (*list).tail = p->prev;
+801061c7:	8b 90 e8 00 00 00    	mov    0xe8(%eax),%edx
+801061cd:	89 51 04             	mov    %edx,0x4(%ecx)
+801061d0:	eb c3                	jmp    80106195 <stateListRemove+0x40>
+    return -1;
+801061d2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801061d7:	c3                   	ret
+801061d8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801061dd:	c3                   	ret
+
+801061de <sleepList>:
+
+// The hash chain holding processes asleep on chan.
+static struct ptrs*
+sleepList(void *chan)
+{
+  return &ptable.sleepq[((uint)chan >> 2) % NSLEEPQ];
+801061de:	c1 e8 02             	shr    $0x2,%eax
+801061e1:	89 c1                	mov    %eax,%ecx
+801061e3:	ba 3f c5 25 43       	mov    $0x4325c53f,%edx
+801061e8:	f7 e2                	mul    %edx
+801061ea:	c1 ea 04             	shr    $0x4,%edx
+801061ed:	6b c2 3d             	imul   $0x3d,%edx,%eax
+801061f0:	29 c1                	sub    %eax,%ecx
+801061f2:	8d 04 cd 68 f1 13 80 	lea    -0x7fec0e98(,%ecx,8),%eax
+}
+801061f9:	c3                   	ret
+
+801061fa <initProcessLists>:
+static void
+initProcessLists()
+{
+  int i;
+
+  for (i = UNUSED; i <= ZOMBIE; i++) {
+801061fa:	b8 00 00 00 00       	mov    $0x0,%eax
+801061ff:	eb 1f                	jmp    80106220 <initProcessLists+0x26>
+    ptable.list[i].head = NULL;
+80106201:	8d 90 86 08 00 00    	lea    0x886(%eax),%edx
+80106207:	c7 04 d5 08 ad 13 80 	movl   $0x0,-0x7fec52f8(,%edx,8)
+8010620e:	00 00 00 00 
+    ptable.list[i].tail = NULL;
+80106212:	c7 04 d5 0c ad 13 80 	movl   $0x0,-0x7fec52f4(,%edx,8)
+80106219:	00 00 00 00 
+  for (i = UNUSED; i <= ZOMBIE; i++) {
+8010621d:	83 c0 01             	add    $0x1,%eax
+80106220:	83 f8 05             	cmp    $0x5,%eax
+80106223:	7e dc                	jle    80106201 <initProcessLists+0x7>
+  }
+  for (i = 0; i < NSLEEPQ; i++) {
+80106225:	b8 00 00 00 00       	mov    $0x0,%eax
+8010622a:	eb 1f                	jmp    8010624b <initProcessLists+0x51>
+    ptable.sleepq[i].head = NULL;
+8010622c:	8d 90 8c 08 00 00    	lea    0x88c(%eax),%edx
+80106232:	c7 04 d5 08 ad 13 80 	movl   $0x0,-0x7fec52f8(,%edx,8)
+80106239:	00 00 00 00 
+    ptable.sleepq[i].tail = NULL;
+8010623d:	c7 04 d5 0c ad 13 80 	movl   $0x0,-0x7fec52f4(,%edx,8)
+80106244:	00 00 00 00 
+  for (i = 0; i < NSLEEPQ; i++) {
+80106248:	83 c0 01             	add    $0x1,%eax
+8010624b:	83 f8 3c             	cmp    $0x3c,%eax
+8010624e:	7e dc                	jle    8010622c <initProcessLists+0x32>
+  }
+#ifdef CS333_P4
+  struct runq *q;
+
+  for (q = runq; q < &runq[NCPU]; q++) {
+80106250:	ba 00 a9 13 80       	mov    $0x8013a900,%edx
+80106255:	eb 22                	jmp    80106279 <initProcessLists+0x7f>
+    for (i = 0; i <= MAXPRIO; i++) {
+      q->ready[i].head = NULL;
+80106257:	c7 44 c2 34 00 00 00 	movl   $0x0,0x34(%edx,%eax,8)
+8010625e:	00 
+      q->ready[i].tail = NULL;
+8010625f:	c7 44 c2 38 00 00 00 	movl   $0x0,0x38(%edx,%eax,8)
+80106266:	00 
+    for (i = 0; i <= MAXPRIO; i++) {
+80106267:	83 c0 01             	add    $0x1,%eax
+8010626a:	83 f8 06             	cmp    $0x6,%eax
+8010626d:	7e e8                	jle    80106257 <initProcessLists+0x5d>
+    }
+    q->count = 0;
+8010626f:	c7 42 6c 00 00 00 00 	movl   $0x0,0x6c(%edx)
+  for (q = runq; q < &runq[NCPU]; q++) {
+80106276:	83 ea 80             	sub    $0xffffff80,%edx
+80106279:	81 fa 00 ad 13 80    	cmp    $0x8013ad00,%edx
+8010627f:	73 07                	jae    80106288 <initProcessLists+0x8e>
+    for (i = 0; i <= MAXPRIO; i++) {
+80106281:	b8 00 00 00 00       	mov    $0x0,%eax
+80106286:	eb e2                	jmp    8010626a <initProcessLists+0x70>
+  }
+#endif
+}
+80106288:	c3                   	ret
+
+80106289 <runqHead>:
+
+// Highest priority process waiting on q, or NULL.
+// Caller must hold ptable.lock.
+static struct proc*
+runqHead(struct runq* q)
+{
+80106289:	89 c1                	mov    %eax,%ecx
+  int i;
+
+  for(i = MAXPRIO; i >= 0; --i)
+8010628b:	ba 06 00 00 00       	mov    $0x6,%edx
+80106290:	eb 03                	jmp    80106295 <runqHead+0xc>
+80106292:	83 ea 01             	sub    $0x1,%edx
+80106295:	85 d2                	test   %edx,%edx
+80106297:	78 0a                	js     801062a3 <runqHead+0x1a>
+    if(q->ready[i].head != NULL)
+80106299:	8b 44 d1 34          	mov    0x34(%ecx,%edx,8),%eax
+8010629d:	85 c0                	test   %eax,%eax
+8010629f:	74 f1                	je     80106292 <runqHead+0x9>
+801062a1:	eb 05                	jmp    801062a8 <runqHead+0x1f>
+      return q->ready[i].head;
+  return NULL;
+801062a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801062a8:	c3                   	ret
+
+801062a9 <allocpid>:
+static void
+allocpid(struct proc *p)
+{
+  struct proc **h;
+
+  p->pid = nextpid++;
+801062a9:	8b 15 04 f0 10 80    	mov    0x8010f004,%edx
+801062af:	8d 4a 01             	lea    0x1(%edx),%ecx
+801062b2:	89 0d 04 f0 10 80    	mov    %ecx,0x8010f004
+801062b8:	89 50 10             	mov    %edx,0x10(%eax)
+  h = &ptable.pidhash[p->pid % NPIDHASH];
+801062bb:	83 e2 3f             	and    $0x3f,%edx
+  p->pidnext = *h;
+801062be:	81 c2 cc 10 00 00    	add    $0x10cc,%edx
+801062c4:	8b 0c 95 08 ad 13 80 	mov    -0x7fec52f8(,%edx,4),%ecx
+801062cb:	89 48 14             	mov    %ecx,0x14(%eax)
+  *h = p;
+801062ce:	89 04 95 08 ad 13 80 	mov    %eax,-0x7fec52f8(,%edx,4)
+}
+801062d5:	c3                   	ret
+
+801062d6 <freepid>:
+static void
+freepid(struct proc *p)
+{
+  struct proc **h;
+
+  for(h = &ptable.pidhash[p->pid % NPIDHASH]; *h; h = &(*h)->pidnext){
+801062d6:	8b 50 10             	mov    0x10(%eax),%edx
+801062d9:	83 e2 3f             	and    $0x3f,%edx
+801062dc:	8d 0c 95 38 f0 13 80 	lea    -0x7fec0fc8(,%edx,4),%ecx
+801062e3:	eb 03                	jmp    801062e8 <freepid+0x12>
+801062e5:	8d 4a 14             	lea    0x14(%edx),%ecx
+801062e8:	8b 11                	mov    (%ecx),%edx
+801062ea:	85 d2                	test   %edx,%edx
+801062ec:	74 09                	je     801062f7 <freepid+0x21>
+    if(*h == p){
+801062ee:	39 c2                	cmp    %eax,%edx
+801062f0:	75 f3                	jne    801062e5 <freepid+0xf>
+      *h = p->pidnext;
+801062f2:	8b 50 14             	mov    0x14(%eax),%edx
+801062f5:	89 11                	mov    %edx,(%ecx)
+      break;
+    }
+  }
+  p->pidnext = 0;
+801062f7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  p->pid = 0;
+801062fe:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+}
+80106305:	c3                   	ret
+
+80106306 <pidlookup>:
+
+// The process with the given pid, or NULL if it has been reaped.
+// Caller must hold ptable.lock.
+static struct proc*
+pidlookup(int pid)
+{
+80106306:	89 c2                	mov    %eax,%edx
+  struct proc *p;
+
+  for(p = ptable.pidhash[(uint)pid % NPIDHASH]; p; p = p->pidnext)
+80106308:	83 e0 3f             	and    $0x3f,%eax
+8010630b:	8b 04 85 38 f0 13 80 	mov    -0x7fec0fc8(,%eax,4),%eax
+80106312:	eb 03                	jmp    80106317 <pidlookup+0x11>
+80106314:	8b 40 14             	mov    0x14(%eax),%eax
+80106317:	85 c0                	test   %eax,%eax
+80106319:	74 05                	je     80106320 <pidlookup+0x1a>
+    if(p->pid == pid)
+8010631b:	3b 50 10             	cmp    0x10(%eax),%edx
+8010631e:	75 f4                	jne    80106314 <pidlookup+0xe>
+      return p;
+  return NULL;
+}
+80106320:	c3                   	ret
+
+80106321 <timerremove>:
+}
+
+static void
+timerremove(struct proc *p)
+{
+  if(p->tnext)
+80106321:	8b 90 c8 00 00 00    	mov    0xc8(%eax),%edx
+80106327:	85 d2                	test   %edx,%edx
+80106329:	74 0c                	je     80106337 <timerremove+0x16>
+    p->tnext->tprev = p->tprev;
+8010632b:	8b 88 cc 00 00 00    	mov    0xcc(%eax),%ecx
+80106331:	89 8a cc 00 00 00    	mov    %ecx,0xcc(%edx)
+  *p->tprev = p->tnext;
+80106337:	8b 90 cc 00 00 00    	mov    0xcc(%eax),%edx
+8010633d:	8b 88 c8 00 00 00    	mov    0xc8(%eax),%ecx
+80106343:	89 0a                	mov    %ecx,(%edx)
+  p->tnext = 0;
+80106345:	c7 80 c8 00 00 00 00 	movl   $0x0,0xc8(%eax)
+8010634c:	00 00 00 
+  p->tprev = 0;
+8010634f:	c7 80 cc 00 00 00 00 	movl   $0x0,0xcc(%eax)
+80106356:	00 00 00 
+}
+80106359:	c3                   	ret
+
+8010635a <stateListAdd>:
+  if(p->list != NULL)
+8010635a:	83 ba ec 00 00 00 00 	cmpl   $0x0,0xec(%edx)
+80106361:	75 28                	jne    8010638b <stateListAdd+0x31>
+  p->next = NULL;
+80106363:	c7 82 e4 00 00 00 00 	movl   $0x0,0xe4(%edx)
+8010636a:	00 00 00 
+  p->prev = (*list).tail;
+8010636d:	8b 48 04             	mov    0x4(%eax),%ecx
+80106370:	89 8a e8 00 00 00    	mov    %ecx,0xe8(%edx)
+  if((*list).head == NULL)
+80106376:	83 38 00             	cmpl   $0x0,(%eax)
+80106379:	74 20                	je     8010639b <stateListAdd+0x41>
+    ((*list).tail)->next = p;
+8010637b:	89 91 e4 00 00 00    	mov    %edx,0xe4(%ecx)
+  (*list).tail = p;
+80106381:	89 50 04             	mov    %edx,0x4(%eax)
+  p->list = list;
+80106384:	89 82 ec 00 00 00    	mov    %eax,0xec(%edx)
+8010638a:	c3                   	ret
+{
+8010638b:	55                   	push   %ebp
+8010638c:	89 e5                	mov    %esp,%ebp
+8010638e:	83 ec 14             	sub    $0x14,%esp
+    panic("stateListAdd: proc already on a list");
+80106391:	68 a0 c3 10 80       	push   $0x8010c3a0
+80106396:	e8 5b a8 ff ff       	call   80100bf6 <panic>
+    (*list).head = p;
+8010639b:	89 10                	mov    %edx,(%eax)
+8010639d:	eb e2                	jmp    80106381 <stateListAdd+0x27>
+
+8010639f <initFreeList>:
+{
+8010639f:	55                   	push   %ebp
+801063a0:	89 e5                	mov    %esp,%ebp
+801063a2:	53                   	push   %ebx
+801063a3:	83 ec 04             	sub    $0x4,%esp
+  for(p = ptable.all; p; p = p->allnext){
+801063a6:	8b 1d 34 ec 13 80    	mov    0x8013ec34,%ebx
+801063ac:	eb 20                	jmp    801063ce <initFreeList+0x2f>
+    p->state = UNUSED;
+801063ae:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    p->list = NULL;
+801063b5:	c7 83 ec 00 00 00 00 	movl   $0x0,0xec(%ebx)
+801063bc:	00 00 00 
+    stateListAdd(&ptable.list[UNUSED], p);
+801063bf:	89 da                	mov    %ebx,%edx
+801063c1:	b8 38 f1 13 80       	mov    $0x8013f138,%eax
+801063c6:	e8 8f ff ff ff       	call   8010635a <stateListAdd>
+  for(p = ptable.all; p; p = p->allnext){
+801063cb:	8b 5b 18             	mov    0x18(%ebx),%ebx
+801063ce:	85 db                	test   %ebx,%ebx
+801063d0:	75 dc                	jne    801063ae <initFreeList+0xf>
+}
+801063d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801063d5:	c9                   	leave
+801063d6:	c3                   	ret
+
+801063d7 <procgrow>:
+{
+801063d7:	55                   	push   %ebp
+801063d8:	89 e5                	mov    %esp,%ebp
+801063da:	56                   	push   %esi
+801063db:	53                   	push   %ebx
+  if((np = (struct proc*)kalloc()) == 0)
+801063dc:	e8 4f e7 ff ff       	call   80104b30 <kalloc>
+801063e1:	85 c0                	test   %eax,%eax
+801063e3:	74 56                	je     8010643b <procgrow+0x64>
+801063e5:	89 c6                	mov    %eax,%esi
+  memset(np, 0, PGSIZE);
+801063e7:	83 ec 04             	sub    $0x4,%esp
+801063ea:	68 00 10 00 00       	push   $0x1000
+801063ef:	6a 00                	push   $0x0
+801063f1:	50                   	push   %eax
+801063f2:	e8 97 22 00 00       	call   8010868e <memset>
+  for(p = np; p < np + PGSIZE/sizeof(*p); p++){
+801063f7:	83 c4 10             	add    $0x10,%esp
+801063fa:	89 f3                	mov    %esi,%ebx
+801063fc:	eb 27                	jmp    80106425 <procgrow+0x4e>
+    p->state = UNUSED;
+801063fe:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    p->allnext = ptable.all;
+80106405:	a1 34 ec 13 80       	mov    0x8013ec34,%eax
+8010640a:	89 43 18             	mov    %eax,0x18(%ebx)
+    ptable.all = p;
+8010640d:	89 1d 34 ec 13 80    	mov    %ebx,0x8013ec34
+    stateListAdd(&ptable.list[UNUSED], p);
+80106413:	89 da                	mov    %ebx,%edx
+80106415:	b8 38 f1 13 80       	mov    $0x8013f138,%eax
+8010641a:	e8 3b ff ff ff       	call   8010635a <stateListAdd>
+  for(p = np; p < np + PGSIZE/sizeof(*p); p++){
+8010641f:	81 c3 fc 00 00 00    	add    $0xfc,%ebx
+80106425:	8d 86 c0 0f 00 00    	lea    0xfc0(%esi),%eax
+8010642b:	39 c3                	cmp    %eax,%ebx
+8010642d:	72 cf                	jb     801063fe <procgrow+0x27>
+  return 1;
+8010642f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80106434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106437:	5b                   	pop    %ebx
+80106438:	5e                   	pop    %esi
+80106439:	5d                   	pop    %ebp
+8010643a:	c3                   	ret
+    return 0;
+8010643b:	b8 00 00 00 00       	mov    $0x0,%eax
+80106440:	eb f2                	jmp    80106434 <procgrow+0x5d>
+
+80106442 <runqAdd>:
+{
+80106442:	55                   	push   %ebp
+80106443:	89 e5                	mov    %esp,%ebp
+80106445:	57                   	push   %edi
+80106446:	56                   	push   %esi
+80106447:	53                   	push   %ebx
+80106448:	83 ec 18             	sub    $0x18,%esp
+8010644b:	89 c7                	mov    %eax,%edi
+8010644d:	89 d6                	mov    %edx,%esi
+  acquire(&q->lock);
+8010644f:	89 c3                	mov    %eax,%ebx
+80106451:	c1 e3 07             	shl    $0x7,%ebx
+80106454:	81 c3 00 a9 13 80    	add    $0x8013a900,%ebx
+8010645a:	53                   	push   %ebx
+8010645b:	e8 82 21 00 00       	call   801085e2 <acquire>
+  stateListAdd(&q->ready[p->priority], p);
+80106460:	89 f8                	mov    %edi,%eax
+80106462:	c1 e0 04             	shl    $0x4,%eax
+80106465:	03 86 f0 00 00 00    	add    0xf0(%esi),%eax
+8010646b:	8d 04 c5 34 a9 13 80 	lea    -0x7fec56cc(,%eax,8),%eax
+80106472:	89 f2                	mov    %esi,%edx
+80106474:	e8 e1 fe ff ff       	call   8010635a <stateListAdd>
+  q->count++;
+80106479:	8b 43 6c             	mov    0x6c(%ebx),%eax
+8010647c:	83 c0 01             	add    $0x1,%eax
+8010647f:	89 43 6c             	mov    %eax,0x6c(%ebx)
+  p->rq = rq;
+80106482:	89 be f8 00 00 00    	mov    %edi,0xf8(%esi)
+  release(&q->lock);
+80106488:	89 1c 24             	mov    %ebx,(%esp)
+8010648b:	e8 b7 21 00 00       	call   80108647 <release>
+}
+80106490:	83 c4 10             	add    $0x10,%esp
+80106493:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106496:	5b                   	pop    %ebx
+80106497:	5e                   	pop    %esi
+80106498:	5f                   	pop    %edi
+80106499:	5d                   	pop    %ebp
+8010649a:	c3                   	ret
+
+8010649b <runqPick>:
+{
+8010649b:	55                   	push   %ebp
+8010649c:	89 e5                	mov    %esp,%ebp
+8010649e:	57                   	push   %edi
+8010649f:	56                   	push   %esi
+801064a0:	53                   	push   %ebx
+801064a1:	83 ec 18             	sub    $0x18,%esp
+801064a4:	89 c3                	mov    %eax,%ebx
+  acquire(&runq[self].lock);
+801064a6:	89 c6                	mov    %eax,%esi
+801064a8:	c1 e6 07             	shl    $0x7,%esi
+801064ab:	81 c6 00 a9 13 80    	add    $0x8013a900,%esi
+801064b1:	56                   	push   %esi
+801064b2:	e8 2b 21 00 00       	call   801085e2 <acquire>
+  n = runq[self].count;
+801064b7:	8b 7e 6c             	mov    0x6c(%esi),%edi
+  release(&runq[self].lock);
+801064ba:	89 34 24             	mov    %esi,(%esp)
+801064bd:	e8 85 21 00 00       	call   80108647 <release>
+  if(n > 0)
+801064c2:	83 c4 10             	add    $0x10,%esp
+801064c5:	85 ff                	test   %edi,%edi
+801064c7:	7f 38                	jg     80106501 <runqPick+0x66>
+  most = 0;
+801064c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  best = -1;
+801064ce:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  for(i = 0; i < ncpu; i++){
+801064d3:	b8 00 00 00 00       	mov    $0x0,%eax
+801064d8:	eb 03                	jmp    801064dd <runqPick+0x42>
+801064da:	83 c0 01             	add    $0x1,%eax
+801064dd:	39 05 04 a3 13 80    	cmp    %eax,0x8013a304
+801064e3:	7e 1e                	jle    80106503 <runqPick+0x68>
+    if(i == self)
+801064e5:	39 d8                	cmp    %ebx,%eax
+801064e7:	74 f1                	je     801064da <runqPick+0x3f>
+    n = *(volatile int*)&runq[i].count;
+801064e9:	89 c2                	mov    %eax,%edx
+801064eb:	c1 e2 07             	shl    $0x7,%edx
+801064ee:	81 c2 00 a9 13 80    	add    $0x8013a900,%edx
+801064f4:	8b 52 6c             	mov    0x6c(%edx),%edx
+    if(n > most){
+801064f7:	39 d1                	cmp    %edx,%ecx
+801064f9:	7d df                	jge    801064da <runqPick+0x3f>
+      most = n;
+801064fb:	89 d1                	mov    %edx,%ecx
+      best = i;
+801064fd:	89 c6                	mov    %eax,%esi
+801064ff:	eb d9                	jmp    801064da <runqPick+0x3f>
+    return self;
+80106501:	89 de                	mov    %ebx,%esi
+}
+80106503:	89 f0                	mov    %esi,%eax
+80106505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106508:	5b                   	pop    %ebx
+80106509:	5e                   	pop    %esi
+8010650a:	5f                   	pop    %edi
+8010650b:	5d                   	pop    %ebp
+8010650c:	c3                   	ret
+
+8010650d <runqRemove>:
+{
+8010650d:	55                   	push   %ebp
+8010650e:	89 e5                	mov    %esp,%ebp
+80106510:	57                   	push   %edi
+80106511:	56                   	push   %esi
+80106512:	53                   	push   %ebx
+80106513:	83 ec 18             	sub    $0x18,%esp
+80106516:	89 c7                	mov    %eax,%edi
+  struct runq *q = &runq[p->rq];
+80106518:	8b 98 f8 00 00 00    	mov    0xf8(%eax),%ebx
+  acquire(&q->lock);
+8010651e:	89 de                	mov    %ebx,%esi
+80106520:	c1 e6 07             	shl    $0x7,%esi
+80106523:	81 c6 00 a9 13 80    	add    $0x8013a900,%esi
+80106529:	56                   	push   %esi
+8010652a:	e8 b3 20 00 00       	call   801085e2 <acquire>
+  if(stateListRemove(&q->ready[p->priority], p) < 0)
+8010652f:	89 d8                	mov    %ebx,%eax
+80106531:	c1 e0 04             	shl    $0x4,%eax
+80106534:	03 87 f0 00 00 00    	add    0xf0(%edi),%eax
+8010653a:	8d 04 c5 34 a9 13 80 	lea    -0x7fec56cc(,%eax,8),%eax
+80106541:	89 fa                	mov    %edi,%edx
+80106543:	e8 0d fc ff ff       	call   80106155 <stateListRemove>
+80106548:	83 c4 10             	add    $0x10,%esp
+8010654b:	85 c0                	test   %eax,%eax
+8010654d:	78 26                	js     80106575 <runqRemove+0x68>
+  q->count--;
+8010654f:	c1 e3 07             	shl    $0x7,%ebx
+80106552:	8b 83 6c a9 13 80    	mov    -0x7fec5694(%ebx),%eax
+80106558:	83 e8 01             	sub    $0x1,%eax
+8010655b:	89 83 6c a9 13 80    	mov    %eax,-0x7fec5694(%ebx)
+  release(&q->lock);
+80106561:	83 ec 0c             	sub    $0xc,%esp
+80106564:	56                   	push   %esi
+80106565:	e8 dd 20 00 00       	call   80108647 <release>
+}
+8010656a:	83 c4 10             	add    $0x10,%esp
+8010656d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106570:	5b                   	pop    %ebx
+80106571:	5e                   	pop    %esi
+80106572:	5f                   	pop    %edi
+80106573:	5d                   	pop    %ebp
+80106574:	c3                   	ret
+    panic("Process could not be removed from the RUNNABLE list");
+80106575:	83 ec 0c             	sub    $0xc,%esp
+80106578:	68 c8 c3 10 80       	push   $0x8010c3c8
+8010657d:	e8 74 a6 ff ff       	call   80100bf6 <panic>
+
+80106582 <assertState>:
+    if (p->state == state)
+80106582:	8b 40 0c             	mov    0xc(%eax),%eax
+80106585:	39 d0                	cmp    %edx,%eax
+80106587:	75 01                	jne    8010658a <assertState+0x8>
+80106589:	c3                   	ret
+{
+8010658a:	55                   	push   %ebp
+8010658b:	89 e5                	mov    %esp,%ebp
+8010658d:	83 ec 14             	sub    $0x14,%esp
+    cprintf("Error: proc state is %s and should be %s.\nCalled from %s line %d\n",
+80106590:	ff 75 08             	push   0x8(%ebp)
+80106593:	51                   	push   %ecx
+80106594:	ff 34 95 8c c8 10 80 	push   -0x7fef3774(,%edx,4)
+8010659b:	ff 34 85 8c c8 10 80 	push   -0x7fef3774(,%eax,4)
+801065a2:	68 fc c3 10 80       	push   $0x8010c3fc
+801065a7:	e8 0b a9 ff ff       	call   80100eb7 <cprintf>
+    panic("Error: Process state incorrect in assertState()");
+801065ac:	83 c4 14             	add    $0x14,%esp
+801065af:	68 40 c4 10 80       	push   $0x8010c440
+801065b4:	e8 3d a6 ff ff       	call   80100bf6 <panic>
+
+801065b9 <allocproc>:
+{
+801065b9:	55                   	push   %ebp
+801065ba:	89 e5                	mov    %esp,%ebp
+801065bc:	56                   	push   %esi
+801065bd:	53                   	push   %ebx
+  acquire(&ptable.lock);
+801065be:	83 ec 0c             	sub    $0xc,%esp
+801065c1:	68 00 ad 13 80       	push   $0x8013ad00
+801065c6:	e8 17 20 00 00       	call   801085e2 <acquire>
+  if(ptable.list[UNUSED].head == NULL)
+801065cb:	83 c4 10             	add    $0x10,%esp
+801065ce:	83 3d 38 f1 13 80 00 	cmpl   $0x0,0x8013f138
+801065d5:	0f 84 fa 00 00 00    	je     801066d5 <allocproc+0x11c>
+  if(ptable.list[UNUSED].head != NULL){
+801065db:	8b 1d 38 f1 13 80    	mov    0x8013f138,%ebx
+801065e1:	85 db                	test   %ebx,%ebx
+801065e3:	0f 84 03 01 00 00    	je     801066ec <allocproc+0x133>
+    if(stateListRemove(&ptable.list[p->state], p) < 0){
+801065e9:	8b 43 0c             	mov    0xc(%ebx),%eax
+801065ec:	8d 04 c5 38 f1 13 80 	lea    -0x7fec0ec8(,%eax,8),%eax
+801065f3:	89 da                	mov    %ebx,%edx
+801065f5:	e8 5b fb ff ff       	call   80106155 <stateListRemove>
+801065fa:	85 c0                	test   %eax,%eax
+801065fc:	0f 88 dd 00 00 00    	js     801066df <allocproc+0x126>
+    assertState(p, UNUSED, __FUNCTION__, __LINE__);
+80106602:	83 ec 0c             	sub    $0xc,%esp
+80106605:	68 c4 01 00 00       	push   $0x1c4
+8010660a:	b9 74 c8 10 80       	mov    $0x8010c874,%ecx
+8010660f:	ba 00 00 00 00       	mov    $0x0,%edx
+80106614:	89 d8                	mov    %ebx,%eax
+80106616:	e8 67 ff ff ff       	call   80106582 <assertState>
+    p->priority = MAXPRIO;
+8010661b:	c7 83 f0 00 00 00 06 	movl   $0x6,0xf0(%ebx)
+80106622:	00 00 00 
+    p->budget = DEFAULT_BUDGET;
+80106625:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+8010662c:	01 00 00 
+    p->state = EMBRYO;
+8010662f:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+    stateListAdd(&ptable.list[p->state],p);
+80106636:	89 da                	mov    %ebx,%edx
+80106638:	b8 40 f1 13 80       	mov    $0x8013f140,%eax
+8010663d:	e8 18 fd ff ff       	call   8010635a <stateListAdd>
+  allocpid(p);
+80106642:	89 d8                	mov    %ebx,%eax
+80106644:	e8 60 fc ff ff       	call   801062a9 <allocpid>
+  release(&ptable.lock);
+80106649:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106650:	e8 f2 1f 00 00       	call   80108647 <release>
+  if((p->kstack = kalloc()) == 0){
+80106655:	e8 d6 e4 ff ff       	call   80104b30 <kalloc>
+8010665a:	89 c6                	mov    %eax,%esi
+8010665c:	89 43 08             	mov    %eax,0x8(%ebx)
+8010665f:	83 c4 10             	add    $0x10,%esp
+80106662:	85 c0                	test   %eax,%eax
+80106664:	0f 84 94 00 00 00    	je     801066fe <allocproc+0x145>
+  sp -= sizeof *p->tf;
+8010666a:	8d 80 b4 0f 00 00    	lea    0xfb4(%eax),%eax
+  p->tf = (struct trapframe*)sp;
+80106670:	89 43 20             	mov    %eax,0x20(%ebx)
+  *(uint*)sp = (uint)trapret;
+80106673:	c7 86 b0 0f 00 00 17 	movl   $0x80109a17,0xfb0(%esi)
+8010667a:	9a 10 80 
+  sp -= sizeof *p->context;
+8010667d:	81 c6 9c 0f 00 00    	add    $0xf9c,%esi
+  p->context = (struct context*)sp;
+80106683:	89 73 24             	mov    %esi,0x24(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+80106686:	83 ec 04             	sub    $0x4,%esp
+80106689:	6a 14                	push   $0x14
+8010668b:	6a 00                	push   $0x0
+8010668d:	56                   	push   %esi
+8010668e:	e8 fb 1f 00 00       	call   8010868e <memset>
+  p->context->eip = (uint)forkret;
+80106693:	8b 43 24             	mov    0x24(%ebx),%eax
+80106696:	c7 40 10 24 68 10 80 	movl   $0x80106824,0x10(%eax)
+  p->ofile = p->ofile0;
+8010669d:	8d 43 38             	lea    0x38(%ebx),%eax
+801066a0:	89 43 30             	mov    %eax,0x30(%ebx)
+  p->nofile = NOFILE;
+801066a3:	c7 43 34 10 00 00 00 	movl   $0x10,0x34(%ebx)
+  p->start_ticks = ticks;
+801066aa:	a1 60 f3 13 80       	mov    0x8013f360,%eax
+801066af:	89 83 d0 00 00 00    	mov    %eax,0xd0(%ebx)
+  p->cpu_ticks_total = 0;
+801066b5:	c7 83 dc 00 00 00 00 	movl   $0x0,0xdc(%ebx)
+801066bc:	00 00 00 
+  p->cpu_ticks_in = 0;
+801066bf:	c7 83 e0 00 00 00 00 	movl   $0x0,0xe0(%ebx)
+801066c6:	00 00 00 
+  return p;
+801066c9:	83 c4 10             	add    $0x10,%esp
+}
+801066cc:	89 d8                	mov    %ebx,%eax
+801066ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801066d1:	5b                   	pop    %ebx
+801066d2:	5e                   	pop    %esi
+801066d3:	5d                   	pop    %ebp
+801066d4:	c3                   	ret
+    procgrow();
+801066d5:	e8 fd fc ff ff       	call   801063d7 <procgrow>
+801066da:	e9 fc fe ff ff       	jmp    801065db <allocproc+0x22>
+      panic("Process could not be removed from UNUSED list");
+801066df:	83 ec 0c             	sub    $0xc,%esp
+801066e2:	68 70 c4 10 80       	push   $0x8010c470
+801066e7:	e8 0a a5 ff ff       	call   80100bf6 <panic>
+    release(&ptable.lock);
+801066ec:	83 ec 0c             	sub    $0xc,%esp
+801066ef:	68 00 ad 13 80       	push   $0x8013ad00
+801066f4:	e8 4e 1f 00 00       	call   80108647 <release>
+    return 0;
+801066f9:	83 c4 10             	add    $0x10,%esp
+801066fc:	eb ce                	jmp    801066cc <allocproc+0x113>
+    acquire(&ptable.lock);
+801066fe:	83 ec 0c             	sub    $0xc,%esp
+80106701:	68 00 ad 13 80       	push   $0x8013ad00
+80106706:	e8 d7 1e 00 00       	call   801085e2 <acquire>
+    freepid(p);
+8010670b:	89 d8                	mov    %ebx,%eax
+8010670d:	e8 c4 fb ff ff       	call   801062d6 <freepid>
+    if(stateListRemove(&ptable.list[p->state], p) < 0){
+80106712:	8b 43 0c             	mov    0xc(%ebx),%eax
+80106715:	8d 04 c5 38 f1 13 80 	lea    -0x7fec0ec8(,%eax,8),%eax
+8010671c:	89 da                	mov    %ebx,%edx
+8010671e:	e8 32 fa ff ff       	call   80106155 <stateListRemove>
+80106723:	83 c4 10             	add    $0x10,%esp
+80106726:	85 c0                	test   %eax,%eax
+80106728:	78 42                	js     8010676c <allocproc+0x1b3>
+    assertState(p, EMBRYO, __FUNCTION__, __LINE__);
+8010672a:	83 ec 0c             	sub    $0xc,%esp
+8010672d:	68 dd 01 00 00       	push   $0x1dd
+80106732:	b9 74 c8 10 80       	mov    $0x8010c874,%ecx
+80106737:	ba 01 00 00 00       	mov    $0x1,%edx
+8010673c:	89 d8                	mov    %ebx,%eax
+8010673e:	e8 3f fe ff ff       	call   80106582 <assertState>
+    p->state = UNUSED;
+80106743:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    stateListAdd(&ptable.list[p->state], p);
+8010674a:	89 da                	mov    %ebx,%edx
+8010674c:	b8 38 f1 13 80       	mov    $0x8013f138,%eax
+80106751:	e8 04 fc ff ff       	call   8010635a <stateListAdd>
+    release(&ptable.lock);
+80106756:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+8010675d:	e8 e5 1e 00 00       	call   80108647 <release>
+    return 0;
+80106762:	83 c4 10             	add    $0x10,%esp
+80106765:	89 f3                	mov    %esi,%ebx
+80106767:	e9 60 ff ff ff       	jmp    801066cc <allocproc+0x113>
+      panic("Process could not be removed from EMBRYO list");
+8010676c:	83 ec 0c             	sub    $0xc,%esp
+8010676f:	68 a0 c4 10 80       	push   $0x8010c4a0
+80106774:	e8 7d a4 ff ff       	call   80100bf6 <panic>
+
+80106779 <wakeup1>:
+{
+80106779:	55                   	push   %ebp
+8010677a:	89 e5                	mov    %esp,%ebp
+8010677c:	57                   	push   %edi
+8010677d:	56                   	push   %esi
+8010677e:	53                   	push   %ebx
+8010677f:	83 ec 1c             	sub    $0x1c,%esp
+80106782:	89 c7                	mov    %eax,%edi
+  for(p = sleepList(chan)->head; p != NULL; p = next){
+80106784:	e8 55 fa ff ff       	call   801061de <sleepList>
+80106789:	8b 18                	mov    (%eax),%ebx
+8010678b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010678e:	eb 0f                	jmp    8010679f <wakeup1+0x26>
+	panic("Process could not be removed from the list");
+80106790:	83 ec 0c             	sub    $0xc,%esp
+80106793:	68 d0 c4 10 80       	push   $0x8010c4d0
+80106798:	e8 59 a4 ff ff       	call   80100bf6 <panic>
+{
+8010679d:	89 f3                	mov    %esi,%ebx
+  for(p = sleepList(chan)->head; p != NULL; p = next){
+8010679f:	85 db                	test   %ebx,%ebx
+801067a1:	74 4b                	je     801067ee <wakeup1+0x75>
+    next = p->next;  // removal clears p->next
+801067a3:	8b b3 e4 00 00 00    	mov    0xe4(%ebx),%esi
+    if(p->chan == chan){
+801067a9:	39 7b 28             	cmp    %edi,0x28(%ebx)
+801067ac:	75 ef                	jne    8010679d <wakeup1+0x24>
+      if(stateListRemove(sleepList(chan), p) < 0)
+801067ae:	89 da                	mov    %ebx,%edx
+801067b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801067b3:	e8 9d f9 ff ff       	call   80106155 <stateListRemove>
+801067b8:	85 c0                	test   %eax,%eax
+801067ba:	78 d4                	js     80106790 <wakeup1+0x17>
+      assertState(p, SLEEPING, __FUNCTION__, __LINE__);
+801067bc:	83 ec 0c             	sub    $0xc,%esp
+801067bf:	68 6c 06 00 00       	push   $0x66c
+801067c4:	b9 5c c8 10 80       	mov    $0x8010c85c,%ecx
+801067c9:	ba 02 00 00 00       	mov    $0x2,%edx
+801067ce:	89 d8                	mov    %ebx,%eax
+801067d0:	e8 ad fd ff ff       	call   80106582 <assertState>
+      p->state = RUNNABLE;
+801067d5:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+      runqAdd(p->rq, p);
+801067dc:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+801067e2:	89 da                	mov    %ebx,%edx
+801067e4:	e8 59 fc ff ff       	call   80106442 <runqAdd>
+801067e9:	83 c4 10             	add    $0x10,%esp
+801067ec:	eb af                	jmp    8010679d <wakeup1+0x24>
+}
+801067ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801067f1:	5b                   	pop    %ebx
+801067f2:	5e                   	pop    %esi
+801067f3:	5f                   	pop    %edi
+801067f4:	5d                   	pop    %ebp
+801067f5:	c3                   	ret
+
+801067f6 <ofilefree>:
+{
+801067f6:	55                   	push   %ebp
+801067f7:	89 e5                	mov    %esp,%ebp
+801067f9:	56                   	push   %esi
+801067fa:	53                   	push   %ebx
+801067fb:	89 c3                	mov    %eax,%ebx
+  if(p->ofile != p->ofile0)
+801067fd:	8b 40 30             	mov    0x30(%eax),%eax
+80106800:	8d 73 38             	lea    0x38(%ebx),%esi
+80106803:	39 f0                	cmp    %esi,%eax
+80106805:	74 0c                	je     80106813 <ofilefree+0x1d>
+    kfree((char*)p->ofile);
+80106807:	83 ec 0c             	sub    $0xc,%esp
+8010680a:	50                   	push   %eax
+8010680b:	e8 01 e1 ff ff       	call   80104911 <kfree>
+80106810:	83 c4 10             	add    $0x10,%esp
+  p->ofile = p->ofile0;
+80106813:	89 73 30             	mov    %esi,0x30(%ebx)
+  p->nofile = NOFILE;
+80106816:	c7 43 34 10 00 00 00 	movl   $0x10,0x34(%ebx)
+}
+8010681d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106820:	5b                   	pop    %ebx
+80106821:	5e                   	pop    %esi
+80106822:	5d                   	pop    %ebp
+80106823:	c3                   	ret
+
+80106824 <forkret>:
+{
+80106824:	55                   	push   %ebp
+80106825:	89 e5                	mov    %esp,%ebp
+80106827:	83 ec 14             	sub    $0x14,%esp
+  release(&ptable.lock);
+8010682a:	68 00 ad 13 80       	push   $0x8013ad00
+8010682f:	e8 13 1e 00 00       	call   80108647 <release>
+  if (first) {
+80106834:	83 c4 10             	add    $0x10,%esp
+80106837:	83 3d 00 f0 10 80 00 	cmpl   $0x0,0x8010f000
+8010683e:	75 02                	jne    80106842 <forkret+0x1e>
+}
+80106840:	c9                   	leave
+80106841:	c3                   	ret
+    first = 0;
+80106842:	c7 05 00 f0 10 80 00 	movl   $0x0,0x8010f000
+80106849:	00 00 00 
+    iinit(ROOTDEV);
+8010684c:	83 ec 0c             	sub    $0xc,%esp
+8010684f:	6a 01                	push   $0x1
+80106851:	e8 8b c1 ff ff       	call   801029e1 <iinit>
+    initlog(ROOTDEV);
+80106856:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+8010685d:	e8 ec e9 ff ff       	call   8010524e <initlog>
+    iinit2(ROOTDEV);
+80106862:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+80106869:	e8 93 c2 ff ff       	call   80102b01 <iinit2>
+8010686e:	83 c4 10             	add    $0x10,%esp
+}
+80106871:	eb cd                	jmp    80106840 <forkret+0x1c>
+
+80106873 <pinit>:
+{
+80106873:	55                   	push   %ebp
+80106874:	89 e5                	mov    %esp,%ebp
+80106876:	53                   	push   %ebx
+80106877:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&ptable.lock, "ptable");
+8010687a:	68 61 c6 10 80       	push   $0x8010c661
+8010687f:	68 00 ad 13 80       	push   $0x8013ad00
+80106884:	e8 15 1c 00 00       	call   8010849e <initlock>
+  for(p = &ptable.proc[NPROC-1]; p >= ptable.proc; p--){
+80106889:	83 c4 10             	add    $0x10,%esp
+8010688c:	b8 38 eb 13 80       	mov    $0x8013eb38,%eax
+80106891:	eb 13                	jmp    801068a6 <pinit+0x33>
+    p->allnext = ptable.all;
+80106893:	8b 15 34 ec 13 80    	mov    0x8013ec34,%edx
+80106899:	89 50 18             	mov    %edx,0x18(%eax)
+    ptable.all = p;
+8010689c:	a3 34 ec 13 80       	mov    %eax,0x8013ec34
+  for(p = &ptable.proc[NPROC-1]; p >= ptable.proc; p--){
+801068a1:	2d fc 00 00 00       	sub    $0xfc,%eax
+801068a6:	3d 34 ad 13 80       	cmp    $0x8013ad34,%eax
+801068ab:	73 e6                	jae    80106893 <pinit+0x20>
+  for(q = runq; q < &runq[NCPU]; q++)
+801068ad:	bb 00 a9 13 80       	mov    $0x8013a900,%ebx
+801068b2:	eb 14                	jmp    801068c8 <pinit+0x55>
+    initlock(&q->lock, "runq");
+801068b4:	83 ec 08             	sub    $0x8,%esp
+801068b7:	68 68 c6 10 80       	push   $0x8010c668
+801068bc:	53                   	push   %ebx
+801068bd:	e8 dc 1b 00 00       	call   8010849e <initlock>
+  for(q = runq; q < &runq[NCPU]; q++)
+801068c2:	83 eb 80             	sub    $0xffffff80,%ebx
+801068c5:	83 c4 10             	add    $0x10,%esp
+801068c8:	81 fb 00 ad 13 80    	cmp    $0x8013ad00,%ebx
+801068ce:	72 e4                	jb     801068b4 <pinit+0x41>
+}
+801068d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801068d3:	c9                   	leave
+801068d4:	c3                   	ret
+
+801068d5 <mycpu>:
+{
+801068d5:	55                   	push   %ebp
+801068d6:	89 e5                	mov    %esp,%ebp
+801068d8:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801068db:	9c                   	pushf
+801068dc:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801068dd:	f6 c4 02             	test   $0x2,%ah
+801068e0:	75 28                	jne    8010690a <mycpu+0x35>
+  apicid = lapicid();
+801068e2:	e8 0d e5 ff ff       	call   80104df4 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+801068e7:	ba 00 00 00 00       	mov    $0x0,%edx
+801068ec:	39 15 04 a3 13 80    	cmp    %edx,0x8013a304
+801068f2:	7e 23                	jle    80106917 <mycpu+0x42>
+    if (cpus[i].apicid == apicid) {
+801068f4:	69 ca b0 00 00 00    	imul   $0xb0,%edx,%ecx
+801068fa:	0f b6 89 20 a3 13 80 	movzbl -0x7fec5ce0(%ecx),%ecx
+80106901:	39 c1                	cmp    %eax,%ecx
+80106903:	74 1f                	je     80106924 <mycpu+0x4f>
+  for (i = 0; i < ncpu; ++i) {
+80106905:	83 c2 01             	add    $0x1,%edx
+80106908:	eb e2                	jmp    801068ec <mycpu+0x17>
+    panic("mycpu called with interrupts enabled\n");
+8010690a:	83 ec 0c             	sub    $0xc,%esp
+8010690d:	68 fc c4 10 80       	push   $0x8010c4fc
+80106912:	e8 df a2 ff ff       	call   80100bf6 <panic>
+  panic("unknown apicid\n");
+80106917:	83 ec 0c             	sub    $0xc,%esp
+8010691a:	68 6d c6 10 80       	push   $0x8010c66d
+8010691f:	e8 d2 a2 ff ff       	call   80100bf6 <panic>
+      return &cpus[i];
+80106924:	69 c2 b0 00 00 00    	imul   $0xb0,%edx,%eax
+8010692a:	05 20 a3 13 80       	add    $0x8013a320,%eax
+}
+8010692f:	c9                   	leave
+80106930:	c3                   	ret
+
+80106931 <cpuid>:
+cpuid() {
+80106931:	55                   	push   %ebp
+80106932:	89 e5                	mov    %esp,%ebp
+80106934:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80106937:	e8 99 ff ff ff       	call   801068d5 <mycpu>
+8010693c:	2d 20 a3 13 80       	sub    $0x8013a320,%eax
+80106941:	c1 f8 04             	sar    $0x4,%eax
+80106944:	69 c0 a3 8b 2e ba    	imul   $0xba2e8ba3,%eax,%eax
+}
+8010694a:	c9                   	leave
+8010694b:	c3                   	ret
+
+8010694c <myproc>:
+myproc(void) {
+8010694c:	55                   	push   %ebp
+8010694d:	89 e5                	mov    %esp,%ebp
+8010694f:	53                   	push   %ebx
+80106950:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80106953:	e8 a7 1b 00 00       	call   801084ff <pushcli>
+  c = mycpu();
+80106958:	e8 78 ff ff ff       	call   801068d5 <mycpu>
+  p = c->proc;
+8010695d:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106963:	e8 db 1b 00 00       	call   80108543 <popcli>
+}
+80106968:	89 d8                	mov    %ebx,%eax
+8010696a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010696d:	c9                   	leave
+8010696e:	c3                   	ret
+
+8010696f <ofilegrow>:
+{
+8010696f:	55                   	push   %ebp
+80106970:	89 e5                	mov    %esp,%ebp
+80106972:	57                   	push   %edi
+80106973:	56                   	push   %esi
+80106974:	53                   	push   %ebx
+80106975:	83 ec 0c             	sub    $0xc,%esp
+80106978:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p->ofile != p->ofile0 || (f = (struct file**)kalloc()) == 0)
+8010697b:	8d 7e 38             	lea    0x38(%esi),%edi
+8010697e:	39 7e 30             	cmp    %edi,0x30(%esi)
+80106981:	75 4e                	jne    801069d1 <ofilegrow+0x62>
+80106983:	e8 a8 e1 ff ff       	call   80104b30 <kalloc>
+80106988:	89 c3                	mov    %eax,%ebx
+8010698a:	85 c0                	test   %eax,%eax
+8010698c:	74 43                	je     801069d1 <ofilegrow+0x62>
+  memset(f, 0, PGSIZE);
+8010698e:	83 ec 04             	sub    $0x4,%esp
+80106991:	68 00 10 00 00       	push   $0x1000
+80106996:	6a 00                	push   $0x0
+80106998:	50                   	push   %eax
+80106999:	e8 f0 1c 00 00       	call   8010868e <memset>
+  memmove(f, p->ofile0, sizeof(p->ofile0));
+8010699e:	83 c4 0c             	add    $0xc,%esp
+801069a1:	6a 40                	push   $0x40
+801069a3:	57                   	push   %edi
+801069a4:	53                   	push   %ebx
+801069a5:	e8 5c 1d 00 00       	call   80108706 <memmove>
+  memset(p->ofile0, 0, sizeof(p->ofile0));
+801069aa:	83 c4 0c             	add    $0xc,%esp
+801069ad:	6a 40                	push   $0x40
+801069af:	6a 00                	push   $0x0
+801069b1:	57                   	push   %edi
+801069b2:	e8 d7 1c 00 00       	call   8010868e <memset>
+  p->ofile = f;
+801069b7:	89 5e 30             	mov    %ebx,0x30(%esi)
+  p->nofile = PGSIZE/sizeof(*f);
+801069ba:	c7 46 34 00 04 00 00 	movl   $0x400,0x34(%esi)
+  return 0;
+801069c1:	83 c4 10             	add    $0x10,%esp
+801069c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801069c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801069cc:	5b                   	pop    %ebx
+801069cd:	5e                   	pop    %esi
+801069ce:	5f                   	pop    %edi
+801069cf:	5d                   	pop    %ebp
+801069d0:	c3                   	ret
+    return -1;
+801069d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801069d6:	eb f1                	jmp    801069c9 <ofilegrow+0x5a>
+
+801069d8 <userinit>:
+{
+801069d8:	55                   	push   %ebp
+801069d9:	89 e5                	mov    %esp,%ebp
+801069db:	53                   	push   %ebx
+801069dc:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+801069df:	68 00 ad 13 80       	push   $0x8013ad00
+801069e4:	e8 f9 1b 00 00       	call   801085e2 <acquire>
+  initProcessLists();
+801069e9:	e8 0c f8 ff ff       	call   801061fa <initProcessLists>
+  initFreeList();
+801069ee:	e8 ac f9 ff ff       	call   8010639f <initFreeList>
+  ptable.PromoteAtTime = ticks + TICKS_TO_PROMOTE;
+801069f3:	a1 60 f3 13 80       	mov    0x8013f360,%eax
+801069f8:	05 b8 0b 00 00       	add    $0xbb8,%eax
+801069fd:	a3 50 f3 13 80       	mov    %eax,0x8013f350
+  release(&ptable.lock);
+80106a02:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106a09:	e8 39 1c 00 00       	call   80108647 <release>
+  acquire(&ptable.lock);
+80106a0e:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106a15:	e8 c8 1b 00 00       	call   801085e2 <acquire>
+  initProcessLists();
+80106a1a:	e8 db f7 ff ff       	call   801061fa <initProcessLists>
+  initFreeList();
+80106a1f:	e8 7b f9 ff ff       	call   8010639f <initFreeList>
+  release(&ptable.lock);
+80106a24:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106a2b:	e8 17 1c 00 00       	call   80108647 <release>
+  p = allocproc();
+80106a30:	e8 84 fb ff ff       	call   801065b9 <allocproc>
+80106a35:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+80106a37:	a3 c0 a8 13 80       	mov    %eax,0x8013a8c0
+  if((p->pgdir = setupkvm()) == 0)
+80106a3c:	e8 78 4e 00 00       	call   8010b8b9 <setupkvm>
+80106a41:	89 43 04             	mov    %eax,0x4(%ebx)
+80106a44:	83 c4 10             	add    $0x10,%esp
+80106a47:	85 c0                	test   %eax,%eax
+80106a49:	0f 84 0c 01 00 00    	je     80106b5b <userinit+0x183>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80106a4f:	83 ec 04             	sub    $0x4,%esp
+80106a52:	68 2c 00 00 00       	push   $0x2c
+80106a57:	68 60 f4 10 80       	push   $0x8010f460
+80106a5c:	50                   	push   %eax
+80106a5d:	e8 6c 4b 00 00       	call   8010b5ce <inituvm>
+  p->sz = PGSIZE;
+80106a62:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+80106a68:	8b 43 20             	mov    0x20(%ebx),%eax
+80106a6b:	83 c4 0c             	add    $0xc,%esp
+80106a6e:	6a 4c                	push   $0x4c
+80106a70:	6a 00                	push   $0x0
+80106a72:	50                   	push   %eax
+80106a73:	e8 16 1c 00 00       	call   8010868e <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80106a78:	8b 43 20             	mov    0x20(%ebx),%eax
+80106a7b:	66 c7 40 3c 1b 00    	movw   $0x1b,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80106a81:	8b 43 20             	mov    0x20(%ebx),%eax
+80106a84:	66 c7 40 2c 23 00    	movw   $0x23,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80106a8a:	8b 43 20             	mov    0x20(%ebx),%eax
+80106a8d:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80106a91:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80106a95:	8b 43 20             	mov    0x20(%ebx),%eax
+80106a98:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80106a9c:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80106aa0:	8b 43 20             	mov    0x20(%ebx),%eax
+80106aa3:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80106aaa:	8b 43 20             	mov    0x20(%ebx),%eax
+80106aad:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80106ab4:	8b 43 20             	mov    0x20(%ebx),%eax
+80106ab7:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  p->uid = UID;
+80106abe:	c7 83 d4 00 00 00 00 	movl   $0x0,0xd4(%ebx)
+80106ac5:	00 00 00 
+  p->gid = GID;
+80106ac8:	c7 83 d8 00 00 00 00 	movl   $0x0,0xd8(%ebx)
+80106acf:	00 00 00 
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80106ad2:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+80106ad8:	83 c4 0c             	add    $0xc,%esp
+80106adb:	6a 10                	push   $0x10
+80106add:	68 96 c6 10 80       	push   $0x8010c696
+80106ae2:	50                   	push   %eax
+80106ae3:	e8 12 1d 00 00       	call   801087fa <safestrcpy>
+  p->cwd = namei("/");
+80106ae8:	c7 04 24 9f c6 10 80 	movl   $0x8010c69f,(%esp)
+80106aef:	e8 ea d1 ff ff       	call   80103cde <namei>
+80106af4:	89 43 78             	mov    %eax,0x78(%ebx)
+  acquire(&ptable.lock);
+80106af7:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106afe:	e8 df 1a 00 00       	call   801085e2 <acquire>
+  if(stateListRemove(&ptable.list[p->state],p) < 0){
+80106b03:	8b 43 0c             	mov    0xc(%ebx),%eax
+80106b06:	8d 04 c5 38 f1 13 80 	lea    -0x7fec0ec8(,%eax,8),%eax
+80106b0d:	89 da                	mov    %ebx,%edx
+80106b0f:	e8 41 f6 ff ff       	call   80106155 <stateListRemove>
+80106b14:	83 c4 10             	add    $0x10,%esp
+80106b17:	85 c0                	test   %eax,%eax
+80106b19:	78 4d                	js     80106b68 <userinit+0x190>
+  assertState(p, EMBRYO, __FUNCTION__, __LINE__);
+80106b1b:	83 ec 0c             	sub    $0xc,%esp
+80106b1e:	68 6e 02 00 00       	push   $0x26e
+80106b23:	b9 80 c8 10 80       	mov    $0x8010c880,%ecx
+80106b28:	ba 01 00 00 00       	mov    $0x1,%edx
+80106b2d:	89 d8                	mov    %ebx,%eax
+80106b2f:	e8 4e fa ff ff       	call   80106582 <assertState>
+  p->state = RUNNABLE;
+80106b34:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  runqAdd(cpuid(), p);
+80106b3b:	e8 f1 fd ff ff       	call   80106931 <cpuid>
+80106b40:	89 da                	mov    %ebx,%edx
+80106b42:	e8 fb f8 ff ff       	call   80106442 <runqAdd>
+  release(&ptable.lock);
+80106b47:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106b4e:	e8 f4 1a 00 00       	call   80108647 <release>
+}
+80106b53:	83 c4 10             	add    $0x10,%esp
+80106b56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106b59:	c9                   	leave
+80106b5a:	c3                   	ret
+    panic("userinit: out of memory?");
+80106b5b:	83 ec 0c             	sub    $0xc,%esp
+80106b5e:	68 7d c6 10 80       	push   $0x8010c67d
+80106b63:	e8 8e a0 ff ff       	call   80100bf6 <panic>
+    panic("Process could not be removed from the EMBRYO list");
+80106b68:	83 ec 0c             	sub    $0xc,%esp
+80106b6b:	68 24 c5 10 80       	push   $0x8010c524
+80106b70:	e8 81 a0 ff ff       	call   80100bf6 <panic>
+
+80106b75 <growproc>:
+{
+80106b75:	55                   	push   %ebp
+80106b76:	89 e5                	mov    %esp,%ebp
+80106b78:	56                   	push   %esi
+80106b79:	53                   	push   %ebx
+80106b7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80106b7d:	e8 ca fd ff ff       	call   8010694c <myproc>
+80106b82:	89 c6                	mov    %eax,%esi
+  sz = curproc->sz;
+80106b84:	8b 00                	mov    (%eax),%eax
+  if(n > 0){
+80106b86:	85 db                	test   %ebx,%ebx
+80106b88:	7e 22                	jle    80106bac <growproc+0x37>
+    if(sz + n < sz || sz + n >= KERNBASE)
+80106b8a:	01 c3                	add    %eax,%ebx
+80106b8c:	72 43                	jb     80106bd1 <growproc+0x5c>
+80106b8e:	85 db                	test   %ebx,%ebx
+80106b90:	78 46                	js     80106bd8 <growproc+0x63>
+  curproc->sz = sz;
+80106b92:	89 1e                	mov    %ebx,(%esi)
+  switchuvm(curproc);
+80106b94:	83 ec 0c             	sub    $0xc,%esp
+80106b97:	56                   	push   %esi
+80106b98:	e8 d1 48 00 00       	call   8010b46e <switchuvm>
+  return 0;
+80106b9d:	83 c4 10             	add    $0x10,%esp
+80106ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106ba5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106ba8:	5b                   	pop    %ebx
+80106ba9:	5e                   	pop    %esi
+80106baa:	5d                   	pop    %ebp
+80106bab:	c3                   	ret
+  } else if(n < 0){
+80106bac:	78 04                	js     80106bb2 <growproc+0x3d>
+  sz = curproc->sz;
+80106bae:	89 c3                	mov    %eax,%ebx
+80106bb0:	eb e0                	jmp    80106b92 <growproc+0x1d>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80106bb2:	83 ec 04             	sub    $0x4,%esp
+80106bb5:	01 c3                	add    %eax,%ebx
+80106bb7:	53                   	push   %ebx
+80106bb8:	50                   	push   %eax
+80106bb9:	ff 76 04             	push   0x4(%esi)
+80106bbc:	e8 11 4b 00 00       	call   8010b6d2 <deallocuvm>
+80106bc1:	89 c3                	mov    %eax,%ebx
+80106bc3:	83 c4 10             	add    $0x10,%esp
+80106bc6:	85 c0                	test   %eax,%eax
+80106bc8:	75 c8                	jne    80106b92 <growproc+0x1d>
+      return -1;
+80106bca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106bcf:	eb d4                	jmp    80106ba5 <growproc+0x30>
+      return -1;
+80106bd1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106bd6:	eb cd                	jmp    80106ba5 <growproc+0x30>
+80106bd8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106bdd:	eb c6                	jmp    80106ba5 <growproc+0x30>
+
+80106bdf <fork>:
+{
+80106bdf:	55                   	push   %ebp
+80106be0:	89 e5                	mov    %esp,%ebp
+80106be2:	57                   	push   %edi
+80106be3:	56                   	push   %esi
+80106be4:	53                   	push   %ebx
+80106be5:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc *curproc = myproc();
+80106be8:	e8 5f fd ff ff       	call   8010694c <myproc>
+80106bed:	89 c3                	mov    %eax,%ebx
+  if((np = allocproc()) == 0){
+80106bef:	e8 c5 f9 ff ff       	call   801065b9 <allocproc>
+80106bf4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106bf7:	85 c0                	test   %eax,%eax
+80106bf9:	0f 84 43 02 00 00    	je     80106e42 <fork+0x263>
+  if((curproc->nofile > np->nofile && ofilegrow(np) < 0) ||
+80106bff:	8b 48 34             	mov    0x34(%eax),%ecx
+80106c02:	39 4b 34             	cmp    %ecx,0x34(%ebx)
+80106c05:	7e 10                	jle    80106c17 <fork+0x38>
+80106c07:	83 ec 0c             	sub    $0xc,%esp
+80106c0a:	50                   	push   %eax
+80106c0b:	e8 5f fd ff ff       	call   8010696f <ofilegrow>
+80106c10:	83 c4 10             	add    $0x10,%esp
+80106c13:	85 c0                	test   %eax,%eax
+80106c15:	78 5d                	js     80106c74 <fork+0x95>
+     (np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+80106c17:	83 ec 08             	sub    $0x8,%esp
+80106c1a:	ff 33                	push   (%ebx)
+80106c1c:	ff 73 04             	push   0x4(%ebx)
+80106c1f:	e8 4a 4d 00 00       	call   8010b96e <copyuvm>
+80106c24:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80106c27:	89 41 04             	mov    %eax,0x4(%ecx)
+  if((curproc->nofile > np->nofile && ofilegrow(np) < 0) ||
+80106c2a:	83 c4 10             	add    $0x10,%esp
+80106c2d:	85 c0                	test   %eax,%eax
+80106c2f:	74 43                	je     80106c74 <fork+0x95>
+  np->sz = curproc->sz;
+80106c31:	8b 03                	mov    (%ebx),%eax
+80106c33:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106c36:	89 02                	mov    %eax,(%edx)
+  np->parent = curproc;
+80106c38:	89 5a 1c             	mov    %ebx,0x1c(%edx)
+  *np->tf = *curproc->tf;
+80106c3b:	8b 73 20             	mov    0x20(%ebx),%esi
+80106c3e:	8b 7a 20             	mov    0x20(%edx),%edi
+80106c41:	b9 13 00 00 00       	mov    $0x13,%ecx
+80106c46:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  np->uid = curproc->uid;
+80106c48:	8b 83 d4 00 00 00    	mov    0xd4(%ebx),%eax
+80106c4e:	89 82 d4 00 00 00    	mov    %eax,0xd4(%edx)
+  np->gid = curproc->gid;
+80106c54:	8b 83 d8 00 00 00    	mov    0xd8(%ebx),%eax
+80106c5a:	89 82 d8 00 00 00    	mov    %eax,0xd8(%edx)
+  np->tf->eax = 0;
+80106c60:	8b 42 20             	mov    0x20(%edx),%eax
+80106c63:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(i = 0; i < curproc->nofile; i++)
+80106c6a:	be 00 00 00 00       	mov    $0x0,%esi
+80106c6f:	e9 9f 00 00 00       	jmp    80106d13 <fork+0x134>
+    ofilefree(np);
+80106c74:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80106c77:	89 f0                	mov    %esi,%eax
+80106c79:	e8 78 fb ff ff       	call   801067f6 <ofilefree>
+    kfree(np->kstack);
+80106c7e:	83 ec 0c             	sub    $0xc,%esp
+80106c81:	ff 76 08             	push   0x8(%esi)
+80106c84:	e8 88 dc ff ff       	call   80104911 <kfree>
+    np->kstack = 0;
+80106c89:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+    acquire(&ptable.lock);
+80106c90:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106c97:	e8 46 19 00 00       	call   801085e2 <acquire>
+    freepid(np);
+80106c9c:	89 f0                	mov    %esi,%eax
+80106c9e:	e8 33 f6 ff ff       	call   801062d6 <freepid>
+    if(stateListRemove(&ptable.list[np->state],np) < 0){
+80106ca3:	89 f2                	mov    %esi,%edx
+80106ca5:	8b 46 0c             	mov    0xc(%esi),%eax
+80106ca8:	8d 04 c5 38 f1 13 80 	lea    -0x7fec0ec8(,%eax,8),%eax
+80106caf:	e8 a1 f4 ff ff       	call   80106155 <stateListRemove>
+80106cb4:	83 c4 10             	add    $0x10,%esp
+80106cb7:	85 c0                	test   %eax,%eax
+80106cb9:	78 48                	js     80106d03 <fork+0x124>
+    assertState(np, EMBRYO, __FUNCTION__, __LINE__);
+80106cbb:	83 ec 0c             	sub    $0xc,%esp
+80106cbe:	68 b9 02 00 00       	push   $0x2b9
+80106cc3:	b9 6c c8 10 80       	mov    $0x8010c86c,%ecx
+80106cc8:	ba 01 00 00 00       	mov    $0x1,%edx
+80106ccd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80106cd0:	89 d8                	mov    %ebx,%eax
+80106cd2:	e8 ab f8 ff ff       	call   80106582 <assertState>
+    np->state = UNUSED;
+80106cd7:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    stateListAdd(&ptable.list[np->state], np);
+80106cde:	89 da                	mov    %ebx,%edx
+80106ce0:	b8 38 f1 13 80       	mov    $0x8013f138,%eax
+80106ce5:	e8 70 f6 ff ff       	call   8010635a <stateListAdd>
+    release(&ptable.lock);
+80106cea:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106cf1:	e8 51 19 00 00       	call   80108647 <release>
+    return -1;
+80106cf6:	83 c4 10             	add    $0x10,%esp
+80106cf9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106cfe:	e9 1b 01 00 00       	jmp    80106e1e <fork+0x23f>
+      panic("Process could not be removed from EMBRYO list");
+80106d03:	83 ec 0c             	sub    $0xc,%esp
+80106d06:	68 a0 c4 10 80       	push   $0x8010c4a0
+80106d0b:	e8 e6 9e ff ff       	call   80100bf6 <panic>
+  for(i = 0; i < curproc->nofile; i++)
+80106d10:	83 c6 01             	add    $0x1,%esi
+80106d13:	39 73 34             	cmp    %esi,0x34(%ebx)
+80106d16:	7e 27                	jle    80106d3f <fork+0x160>
+    if(curproc->ofile[i])
+80106d18:	8b 43 30             	mov    0x30(%ebx),%eax
+80106d1b:	8d 3c b5 00 00 00 00 	lea    0x0(,%esi,4),%edi
+80106d22:	8b 04 b0             	mov    (%eax,%esi,4),%eax
+80106d25:	85 c0                	test   %eax,%eax
+80106d27:	74 e7                	je     80106d10 <fork+0x131>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80106d29:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80106d2c:	03 79 30             	add    0x30(%ecx),%edi
+80106d2f:	83 ec 0c             	sub    $0xc,%esp
+80106d32:	50                   	push   %eax
+80106d33:	e8 fe aa ff ff       	call   80101836 <filedup>
+80106d38:	89 07                	mov    %eax,(%edi)
+80106d3a:	83 c4 10             	add    $0x10,%esp
+80106d3d:	eb d1                	jmp    80106d10 <fork+0x131>
+  np->cwd = idup(curproc->cwd);
+80106d3f:	83 ec 0c             	sub    $0xc,%esp
+80106d42:	ff 73 78             	push   0x78(%ebx)
+80106d45:	e8 a0 c1 ff ff       	call   80102eea <idup>
+80106d4a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80106d4d:	89 46 78             	mov    %eax,0x78(%esi)
+  if(curproc->exe){
+80106d50:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80106d53:	83 c4 10             	add    $0x10,%esp
+80106d56:	85 c0                	test   %eax,%eax
+80106d58:	0f 84 c8 00 00 00    	je     80106e26 <fork+0x247>
+    np->exe = idup(curproc->exe);
+80106d5e:	83 ec 0c             	sub    $0xc,%esp
+80106d61:	50                   	push   %eax
+80106d62:	e8 83 c1 ff ff       	call   80102eea <idup>
+80106d67:	89 46 7c             	mov    %eax,0x7c(%esi)
+    iexecref(np->exe, 1);
+80106d6a:	83 c4 08             	add    $0x8,%esp
+80106d6d:	6a 01                	push   $0x1
+80106d6f:	50                   	push   %eax
+80106d70:	e8 c6 c2 ff ff       	call   8010303b <iexecref>
+80106d75:	83 c4 10             	add    $0x10,%esp
+  np->nseg = curproc->nseg;
+80106d78:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+80106d7e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106d81:	89 87 b0 00 00 00    	mov    %eax,0xb0(%edi)
+  memmove(np->seg, curproc->seg, sizeof(curproc->seg));
+80106d87:	8d 93 80 00 00 00    	lea    0x80(%ebx),%edx
+80106d8d:	8d 87 80 00 00 00    	lea    0x80(%edi),%eax
+80106d93:	83 ec 04             	sub    $0x4,%esp
+80106d96:	6a 30                	push   $0x30
+80106d98:	52                   	push   %edx
+80106d99:	50                   	push   %eax
+80106d9a:	e8 67 19 00 00       	call   80108706 <memmove>
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80106d9f:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+80106da5:	8d 87 b4 00 00 00    	lea    0xb4(%edi),%eax
+80106dab:	83 c4 0c             	add    $0xc,%esp
+80106dae:	6a 10                	push   $0x10
+80106db0:	53                   	push   %ebx
+80106db1:	50                   	push   %eax
+80106db2:	e8 43 1a 00 00       	call   801087fa <safestrcpy>
+  pid = np->pid;
+80106db7:	8b 5f 10             	mov    0x10(%edi),%ebx
+  acquire(&ptable.lock);
+80106dba:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106dc1:	e8 1c 18 00 00       	call   801085e2 <acquire>
+  if(stateListRemove(&ptable.list[np->state], np) < 0){
+80106dc6:	89 fa                	mov    %edi,%edx
+80106dc8:	8b 47 0c             	mov    0xc(%edi),%eax
+80106dcb:	8d 04 c5 38 f1 13 80 	lea    -0x7fec0ec8(,%eax,8),%eax
+80106dd2:	e8 7e f3 ff ff       	call   80106155 <stateListRemove>
+80106dd7:	83 c4 10             	add    $0x10,%esp
+80106dda:	85 c0                	test   %eax,%eax
+80106ddc:	78 57                	js     80106e35 <fork+0x256>
+  assertState(np, EMBRYO, __FUNCTION__, __LINE__);
+80106dde:	83 ec 0c             	sub    $0xc,%esp
+80106de1:	68 e5 02 00 00       	push   $0x2e5
+80106de6:	b9 6c c8 10 80       	mov    $0x8010c86c,%ecx
+80106deb:	ba 01 00 00 00       	mov    $0x1,%edx
+80106df0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106df3:	89 f8                	mov    %edi,%eax
+80106df5:	e8 88 f7 ff ff       	call   80106582 <assertState>
+  np->state = RUNNABLE;
+80106dfa:	c7 47 0c 03 00 00 00 	movl   $0x3,0xc(%edi)
+  runqAdd(cpuid(), np);
+80106e01:	e8 2b fb ff ff       	call   80106931 <cpuid>
+80106e06:	89 fa                	mov    %edi,%edx
+80106e08:	e8 35 f6 ff ff       	call   80106442 <runqAdd>
+  release(&ptable.lock);
+80106e0d:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106e14:	e8 2e 18 00 00       	call   80108647 <release>
+  return pid;
+80106e19:	89 d8                	mov    %ebx,%eax
+80106e1b:	83 c4 10             	add    $0x10,%esp
+}
+80106e1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106e21:	5b                   	pop    %ebx
+80106e22:	5e                   	pop    %esi
+80106e23:	5f                   	pop    %edi
+80106e24:	5d                   	pop    %ebp
+80106e25:	c3                   	ret
+    np->exe = 0;
+80106e26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106e29:	c7 40 7c 00 00 00 00 	movl   $0x0,0x7c(%eax)
+80106e30:	e9 43 ff ff ff       	jmp    80106d78 <fork+0x199>
+    panic("Process could not be removed from EMBRYO list");
+80106e35:	83 ec 0c             	sub    $0xc,%esp
+80106e38:	68 a0 c4 10 80       	push   $0x8010c4a0
+80106e3d:	e8 b4 9d ff ff       	call   80100bf6 <panic>
+    return -1;
+80106e42:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106e47:	eb d5                	jmp    80106e1e <fork+0x23f>
+
+80106e49 <wakeup>:
+{
+80106e49:	55                   	push   %ebp
+80106e4a:	89 e5                	mov    %esp,%ebp
+80106e4c:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);
+80106e4f:	68 00 ad 13 80       	push   $0x8013ad00
+80106e54:	e8 89 17 00 00       	call   801085e2 <acquire>
+  wakeup1(chan);
+80106e59:	8b 45 08             	mov    0x8(%ebp),%eax
+80106e5c:	e8 18 f9 ff ff       	call   80106779 <wakeup1>
+  release(&ptable.lock);
+80106e61:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80106e68:	e8 da 17 00 00       	call   80108647 <release>
+}
+80106e6d:	83 c4 10             	add    $0x10,%esp
+80106e70:	c9                   	leave
+80106e71:	c3                   	ret
+
+80106e72 <timertick>:
+// Called on every clock tick, after ticks is advanced to now.
+// Wakes the sleepers whose deadline is now; an empty slot is
+// skipped without taking ptable.lock.
+void
+timertick(uint now)
+{
+80106e72:	55                   	push   %ebp
+80106e73:	89 e5                	mov    %esp,%ebp
+80106e75:	57                   	push   %edi
+80106e76:	56                   	push   %esi
+80106e77:	53                   	push   %ebx
+80106e78:	83 ec 0c             	sub    $0xc,%esp
+80106e7b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct proc **slot = &ptable.timer[now % NTIMERSLOT];
+80106e7e:	89 f8                	mov    %edi,%eax
+80106e80:	0f b6 d8             	movzbl %al,%ebx
+  struct proc *p, *next;
+
+  __sync_synchronize();
+80106e83:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(*slot == 0)
+80106e88:	83 3c 9d 38 ec 13 80 	cmpl   $0x0,-0x7fec13c8(,%ebx,4)
+80106e8f:	00 
+80106e90:	74 55                	je     80106ee7 <timertick+0x75>
+    return;
+
+  acquire(&ptable.lock);
+80106e92:	83 ec 0c             	sub    $0xc,%esp
+80106e95:	68 00 ad 13 80       	push   $0x8013ad00
+80106e9a:	e8 43 17 00 00       	call   801085e2 <acquire>
+  for(p = *slot; p; p = next){
+80106e9f:	8b 1c 9d 38 ec 13 80 	mov    -0x7fec13c8(,%ebx,4),%ebx
+80106ea6:	83 c4 10             	add    $0x10,%esp
+80106ea9:	eb 02                	jmp    80106ead <timertick+0x3b>
+{
+80106eab:	89 f3                	mov    %esi,%ebx
+  for(p = *slot; p; p = next){
+80106ead:	85 db                	test   %ebx,%ebx
+80106eaf:	74 26                	je     80106ed7 <timertick+0x65>
+    next = p->tnext;
+80106eb1:	8b b3 c8 00 00 00    	mov    0xc8(%ebx),%esi
+    if((int)(p->wakeat - now) <= 0){
+80106eb7:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+80106ebd:	29 f8                	sub    %edi,%eax
+80106ebf:	85 c0                	test   %eax,%eax
+80106ec1:	7f e8                	jg     80106eab <timertick+0x39>
+      timerremove(p);
+80106ec3:	89 d8                	mov    %ebx,%eax
+80106ec5:	e8 57 f4 ff ff       	call   80106321 <timerremove>
+      wakeup1(&p->wakeat);
+80106eca:	8d 83 c4 00 00 00    	lea    0xc4(%ebx),%eax
+80106ed0:	e8 a4 f8 ff ff       	call   80106779 <wakeup1>
+80106ed5:	eb d4                	jmp    80106eab <timertick+0x39>
+    }
+  }
+  release(&ptable.lock);
+80106ed7:	83 ec 0c             	sub    $0xc,%esp
+80106eda:	68 00 ad 13 80       	push   $0x8013ad00
+80106edf:	e8 63 17 00 00       	call   80108647 <release>
+80106ee4:	83 c4 10             	add    $0x10,%esp
+}
+80106ee7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106eea:	5b                   	pop    %ebx
+80106eeb:	5e                   	pop    %esi
+80106eec:	5f                   	pop    %edi
+80106eed:	5d                   	pop    %ebp
+80106eee:	c3                   	ret
+
+80106eef <kill>:
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+#ifdef CS333_P4
+int
+kill(int pid)
+{
+80106eef:	55                   	push   %ebp
+80106ef0:	89 e5                	mov    %esp,%ebp
+80106ef2:	53                   	push   %ebx
+80106ef3:	83 ec 10             	sub    $0x10,%esp
+  struct proc *p;
+
+  acquire(&ptable.lock);
+80106ef6:	68 00 ad 13 80       	push   $0x8013ad00
+80106efb:	e8 e2 16 00 00       	call   801085e2 <acquire>
+  p = pidlookup(pid);
+80106f00:	8b 45 08             	mov    0x8(%ebp),%eax
+80106f03:	e8 fe f3 ff ff       	call   80106306 <pidlookup>
+  if(p == NULL || p->state == ZOMBIE){
+80106f08:	83 c4 10             	add    $0x10,%esp
+80106f0b:	85 c0                	test   %eax,%eax
+80106f0d:	74 30                	je     80106f3f <kill+0x50>
+80106f0f:	89 c3                	mov    %eax,%ebx
+80106f11:	8b 40 0c             	mov    0xc(%eax),%eax
+80106f14:	83 f8 05             	cmp    $0x5,%eax
+80106f17:	74 26                	je     80106f3f <kill+0x50>
+    release(&ptable.lock);
+    return -1;
+  }
+  p->killed = 1;
+80106f19:	c7 43 2c 01 00 00 00 	movl   $0x1,0x2c(%ebx)
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING){
+80106f20:	83 f8 02             	cmp    $0x2,%eax
+80106f23:	74 31                	je     80106f56 <kill+0x67>
+    }
+    assertState(p, SLEEPING, __FUNCTION__, __LINE__);
+    p->state = RUNNABLE;
+    runqAdd(p->rq, p);
+  }
+  release(&ptable.lock);
+80106f25:	83 ec 0c             	sub    $0xc,%esp
+80106f28:	68 00 ad 13 80       	push   $0x8013ad00
+80106f2d:	e8 15 17 00 00       	call   80108647 <release>
+  return 0;
+80106f32:	83 c4 10             	add    $0x10,%esp
+80106f35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106f3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106f3d:	c9                   	leave
+80106f3e:	c3                   	ret
+    release(&ptable.lock);
+80106f3f:	83 ec 0c             	sub    $0xc,%esp
+80106f42:	68 00 ad 13 80       	push   $0x8013ad00
+80106f47:	e8 fb 16 00 00       	call   80108647 <release>
+    return -1;
+80106f4c:	83 c4 10             	add    $0x10,%esp
+80106f4f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106f54:	eb e4                	jmp    80106f3a <kill+0x4b>
+    if(stateListRemove(sleepList(p->chan), p) < 0){
+80106f56:	8b 43 28             	mov    0x28(%ebx),%eax
+80106f59:	e8 80 f2 ff ff       	call   801061de <sleepList>
+80106f5e:	89 da                	mov    %ebx,%edx
+80106f60:	e8 f0 f1 ff ff       	call   80106155 <stateListRemove>
+80106f65:	85 c0                	test   %eax,%eax
+80106f67:	78 32                	js     80106f9b <kill+0xac>
+    assertState(p, SLEEPING, __FUNCTION__, __LINE__);
+80106f69:	83 ec 0c             	sub    $0xc,%esp
+80106f6c:	68 f1 06 00 00       	push   $0x6f1
+80106f71:	b9 30 c8 10 80       	mov    $0x8010c830,%ecx
+80106f76:	ba 02 00 00 00       	mov    $0x2,%edx
+80106f7b:	89 d8                	mov    %ebx,%eax
+80106f7d:	e8 00 f6 ff ff       	call   80106582 <assertState>
+    p->state = RUNNABLE;
+80106f82:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+    runqAdd(p->rq, p);
+80106f89:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80106f8f:	89 da                	mov    %ebx,%edx
+80106f91:	e8 ac f4 ff ff       	call   80106442 <runqAdd>
+80106f96:	83 c4 10             	add    $0x10,%esp
+80106f99:	eb 8a                	jmp    80106f25 <kill+0x36>
+      panic("Process could not be removed from the SLEEPING list");
+80106f9b:	83 ec 0c             	sub    $0xc,%esp
+80106f9e:	68 58 c5 10 80       	push   $0x8010c558
+80106fa3:	e8 4e 9c ff ff       	call   80100bf6 <panic>
+
+80106fa8 <getprocs>:
+}
+#endif //CS333_P3
+#ifdef CS333_P2
+int
+getprocs(int max, struct uproc * table)
+{
+80106fa8:	55                   	push   %ebp
+80106fa9:	89 e5                	mov    %esp,%ebp
+80106fab:	57                   	push   %edi
+80106fac:	56                   	push   %esi
+80106fad:	53                   	push   %ebx
+80106fae:	83 ec 18             	sub    $0x18,%esp
+  char * state;
+  struct proc * p;
+  int i = 0;
+
+  acquire(&ptable.lock);
+80106fb1:	68 00 ad 13 80       	push   $0x8013ad00
+80106fb6:	e8 27 16 00 00       	call   801085e2 <acquire>
+
+  for(p= ptable.all; p && i< max; p = p->allnext){
+80106fbb:	8b 1d 34 ec 13 80    	mov    0x8013ec34,%ebx
+80106fc1:	83 c4 10             	add    $0x10,%esp
+  int i = 0;
+80106fc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  for(p= ptable.all; p && i< max; p = p->allnext){
+80106fc9:	eb 61                	jmp    8010702c <getprocs+0x84>
+       continue;	     
+     table[i].pid = p->pid;
+     table[i].uid = p->uid;
+     table[i].gid = p->gid;
+     if(p->parent == NULL)
+       table[i].ppid = p->pid;
+80106fcb:	8b 43 10             	mov    0x10(%ebx),%eax
+80106fce:	89 46 0c             	mov    %eax,0xc(%esi)
+     else{
+       table[i].ppid = p->parent->pid;
+     }
+#ifdef CS333_P4
+     table[i].priority = p->priority; 
+80106fd1:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+80106fd7:	89 46 10             	mov    %eax,0x10(%esi)
+#endif
+     table[i].elapsed_ticks = (ticks - p->start_ticks);
+80106fda:	a1 60 f3 13 80       	mov    0x8013f360,%eax
+80106fdf:	2b 83 d0 00 00 00    	sub    0xd0(%ebx),%eax
+80106fe5:	89 46 14             	mov    %eax,0x14(%esi)
+
+     table[i].CPU_total_ticks = p->cpu_ticks_total;
+80106fe8:	8b 83 dc 00 00 00    	mov    0xdc(%ebx),%eax
+80106fee:	89 46 18             	mov    %eax,0x18(%esi)
+     state = states[p->state];
+80106ff1:	8b 53 0c             	mov    0xc(%ebx),%edx
+     safestrcpy(table[i].state, state, 32);
+80106ff4:	8d 46 1c             	lea    0x1c(%esi),%eax
+80106ff7:	83 ec 04             	sub    $0x4,%esp
+80106ffa:	6a 20                	push   $0x20
+80106ffc:	ff 34 95 8c c8 10 80 	push   -0x7fef3774(,%edx,4)
+80107003:	50                   	push   %eax
+80107004:	e8 f1 17 00 00       	call   801087fa <safestrcpy>
+     table[i].size = p->sz;
+80107009:	8b 03                	mov    (%ebx),%eax
+8010700b:	89 46 3c             	mov    %eax,0x3c(%esi)
+     safestrcpy(table[i].name, p->name, sizeof(p->name));
+8010700e:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+80107014:	83 c6 40             	add    $0x40,%esi
+80107017:	83 c4 0c             	add    $0xc,%esp
+8010701a:	6a 10                	push   $0x10
+8010701c:	50                   	push   %eax
+8010701d:	56                   	push   %esi
+8010701e:	e8 d7 17 00 00       	call   801087fa <safestrcpy>
+     
+     ++i;
+80107023:	83 c7 01             	add    $0x1,%edi
+80107026:	83 c4 10             	add    $0x10,%esp
+  for(p= ptable.all; p && i< max; p = p->allnext){
+80107029:	8b 5b 18             	mov    0x18(%ebx),%ebx
+8010702c:	85 db                	test   %ebx,%ebx
+8010702e:	0f 95 c0             	setne  %al
+80107031:	3b 7d 08             	cmp    0x8(%ebp),%edi
+80107034:	0f 9c c2             	setl   %dl
+80107037:	84 c0                	test   %al,%al
+80107039:	74 42                	je     8010707d <getprocs+0xd5>
+8010703b:	84 d2                	test   %dl,%dl
+8010703d:	74 3e                	je     8010707d <getprocs+0xd5>
+     if( (p->state == UNUSED || p->state == EMBRYO))
+8010703f:	83 7b 0c 01          	cmpl   $0x1,0xc(%ebx)
+80107043:	76 e4                	jbe    80107029 <getprocs+0x81>
+     table[i].pid = p->pid;
+80107045:	8d 04 7f             	lea    (%edi,%edi,2),%eax
+80107048:	c1 e0 05             	shl    $0x5,%eax
+8010704b:	89 c6                	mov    %eax,%esi
+8010704d:	03 75 0c             	add    0xc(%ebp),%esi
+80107050:	8b 43 10             	mov    0x10(%ebx),%eax
+80107053:	89 06                	mov    %eax,(%esi)
+     table[i].uid = p->uid;
+80107055:	8b 83 d4 00 00 00    	mov    0xd4(%ebx),%eax
+8010705b:	89 46 04             	mov    %eax,0x4(%esi)
+     table[i].gid = p->gid;
+8010705e:	8b 83 d8 00 00 00    	mov    0xd8(%ebx),%eax
+80107064:	89 46 08             	mov    %eax,0x8(%esi)
+     if(p->parent == NULL)
+80107067:	8b 43 1c             	mov    0x1c(%ebx),%eax
+8010706a:	85 c0                	test   %eax,%eax
+8010706c:	0f 84 59 ff ff ff    	je     80106fcb <getprocs+0x23>
+       table[i].ppid = p->parent->pid;
+80107072:	8b 40 10             	mov    0x10(%eax),%eax
+80107075:	89 46 0c             	mov    %eax,0xc(%esi)
+80107078:	e9 54 ff ff ff       	jmp    80106fd1 <getprocs+0x29>
+    }
+  release(&ptable.lock);
+8010707d:	83 ec 0c             	sub    $0xc,%esp
+80107080:	68 00 ad 13 80       	push   $0x8013ad00
+80107085:	e8 bd 15 00 00       	call   80108647 <release>
+  return i;
+
+}
+8010708a:	89 f8                	mov    %edi,%eax
+8010708c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010708f:	5b                   	pop    %ebx
+80107090:	5e                   	pop    %esi
+80107091:	5f                   	pop    %edi
+80107092:	5d                   	pop    %ebp
+80107093:	c3                   	ret
+
+80107094 <promote>:
+#endif //CS333_P2
+#ifdef CS333_P4
+void
+promote()
+{
+80107094:	55                   	push   %ebp
+80107095:	89 e5                	mov    %esp,%ebp
+80107097:	57                   	push   %edi
+80107098:	56                   	push   %esi
+80107099:	53                   	push   %ebx
+8010709a:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc* p;
+  for(struct runq *q = runq; q < &runq[ncpu]; q++){
+8010709d:	bf 00 a9 13 80       	mov    $0x8013a900,%edi
+801070a2:	eb 6b                	jmp    8010710f <promote+0x7b>
+    for(int i = MAXPRIO-1; i >= 0; --i){
+      p = q->ready[i].head;
+      while(p != NULL){
+        struct proc* temp = p->next;
+801070a4:	8b bb e4 00 00 00    	mov    0xe4(%ebx),%edi
+
+        runqRemove(p);
+801070aa:	89 d8                	mov    %ebx,%eax
+801070ac:	e8 5c f4 ff ff       	call   8010650d <runqRemove>
+        assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+801070b1:	83 ec 0c             	sub    $0xc,%esp
+801070b4:	68 59 07 00 00       	push   $0x759
+801070b9:	b9 28 c8 10 80       	mov    $0x8010c828,%ecx
+801070be:	ba 03 00 00 00       	mov    $0x3,%edx
+801070c3:	89 d8                	mov    %ebx,%eax
+801070c5:	e8 b8 f4 ff ff       	call   80106582 <assertState>
+        p->priority = p->priority + 1;
+801070ca:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+801070d0:	83 c0 01             	add    $0x1,%eax
+801070d3:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+        p->budget = DEFAULT_BUDGET;
+801070d9:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+801070e0:	01 00 00 
+        runqAdd(p->rq, p);
+801070e3:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+801070e9:	89 da                	mov    %ebx,%edx
+801070eb:	e8 52 f3 ff ff       	call   80106442 <runqAdd>
+801070f0:	83 c4 10             	add    $0x10,%esp
+        p = temp;
+801070f3:	89 fb                	mov    %edi,%ebx
+      while(p != NULL){
+801070f5:	85 db                	test   %ebx,%ebx
+801070f7:	75 ab                	jne    801070a4 <promote+0x10>
+    for(int i = MAXPRIO-1; i >= 0; --i){
+801070f9:	83 ee 01             	sub    $0x1,%esi
+801070fc:	85 f6                	test   %esi,%esi
+801070fe:	78 09                	js     80107109 <promote+0x75>
+      p = q->ready[i].head;
+80107100:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107103:	8b 5c f0 34          	mov    0x34(%eax,%esi,8),%ebx
+      while(p != NULL){
+80107107:	eb ec                	jmp    801070f5 <promote+0x61>
+  for(struct runq *q = runq; q < &runq[ncpu]; q++){
+80107109:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010710c:	83 ef 80             	sub    $0xffffff80,%edi
+8010710f:	a1 04 a3 13 80       	mov    0x8013a304,%eax
+80107114:	c1 e0 07             	shl    $0x7,%eax
+80107117:	05 00 a9 13 80       	add    $0x8013a900,%eax
+8010711c:	39 c7                	cmp    %eax,%edi
+8010711e:	73 0a                	jae    8010712a <promote+0x96>
+    for(int i = MAXPRIO-1; i >= 0; --i){
+80107120:	be 05 00 00 00       	mov    $0x5,%esi
+80107125:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80107128:	eb d2                	jmp    801070fc <promote+0x68>
+      }
+    }
+  }
+  for(p = ptable.list[RUNNING].head; p != NULL; p = p->next){
+8010712a:	a1 58 f1 13 80       	mov    0x8013f158,%eax
+8010712f:	eb 06                	jmp    80107137 <promote+0xa3>
+80107131:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80107137:	85 c0                	test   %eax,%eax
+80107139:	74 20                	je     8010715b <promote+0xc7>
+    if(p->priority != MAXPRIO){
+8010713b:	8b 90 f0 00 00 00    	mov    0xf0(%eax),%edx
+80107141:	83 fa 06             	cmp    $0x6,%edx
+80107144:	74 eb                	je     80107131 <promote+0x9d>
+       p->priority = p->priority + 1;
+80107146:	83 c2 01             	add    $0x1,%edx
+80107149:	89 90 f0 00 00 00    	mov    %edx,0xf0(%eax)
+       p->budget = DEFAULT_BUDGET;
+8010714f:	c7 80 f4 00 00 00 2c 	movl   $0x12c,0xf4(%eax)
+80107156:	01 00 00 
+80107159:	eb d6                	jmp    80107131 <promote+0x9d>
+    }
+  }
+  for(int i = 0; i < NSLEEPQ; i++){
+8010715b:	b9 00 00 00 00       	mov    $0x0,%ecx
+80107160:	eb 2d                	jmp    8010718f <promote+0xfb>
+    for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
+80107162:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80107168:	85 c0                	test   %eax,%eax
+8010716a:	74 20                	je     8010718c <promote+0xf8>
+      if(p->priority != MAXPRIO){
+8010716c:	8b 90 f0 00 00 00    	mov    0xf0(%eax),%edx
+80107172:	83 fa 06             	cmp    $0x6,%edx
+80107175:	74 eb                	je     80107162 <promote+0xce>
+        p->priority = p->priority + 1;
+80107177:	83 c2 01             	add    $0x1,%edx
+8010717a:	89 90 f0 00 00 00    	mov    %edx,0xf0(%eax)
+        p->budget = DEFAULT_BUDGET;
+80107180:	c7 80 f4 00 00 00 2c 	movl   $0x12c,0xf4(%eax)
+80107187:	01 00 00 
+8010718a:	eb d6                	jmp    80107162 <promote+0xce>
+  for(int i = 0; i < NSLEEPQ; i++){
+8010718c:	83 c1 01             	add    $0x1,%ecx
+8010718f:	83 f9 3c             	cmp    $0x3c,%ecx
+80107192:	7f 09                	jg     8010719d <promote+0x109>
+    for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
+80107194:	8b 04 cd 68 f1 13 80 	mov    -0x7fec0e98(,%ecx,8),%eax
+8010719b:	eb cb                	jmp    80107168 <promote+0xd4>
+      }
+    }
+  }
+}
+8010719d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801071a0:	5b                   	pop    %ebx
+801071a1:	5e                   	pop    %esi
+801071a2:	5f                   	pop    %edi
+801071a3:	5d                   	pop    %ebp
+801071a4:	c3                   	ret
+
+801071a5 <scheduler>:
+{
+801071a5:	55                   	push   %ebp
+801071a6:	89 e5                	mov    %esp,%ebp
+801071a8:	57                   	push   %edi
+801071a9:	56                   	push   %esi
+801071aa:	53                   	push   %ebx
+801071ab:	83 ec 0c             	sub    $0xc,%esp
+  struct cpu *c = mycpu();
+801071ae:	e8 22 f7 ff ff       	call   801068d5 <mycpu>
+801071b3:	89 c7                	mov    %eax,%edi
+  int self = c - cpus;
+801071b5:	89 c6                	mov    %eax,%esi
+801071b7:	81 ee 20 a3 13 80    	sub    $0x8013a320,%esi
+801071bd:	c1 fe 04             	sar    $0x4,%esi
+801071c0:	69 f6 a3 8b 2e ba    	imul   $0xba2e8ba3,%esi,%esi
+  c->proc = 0;
+801071c6:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+801071cd:	00 00 00 
+801071d0:	eb 3b                	jmp    8010720d <scheduler+0x68>
+    if(rq >= 0 || (MAXPRIO > 0 && ticks >= ptable.PromoteAtTime)){
+801071d2:	a1 50 f3 13 80       	mov    0x8013f350,%eax
+801071d7:	39 05 60 f3 13 80    	cmp    %eax,0x8013f360
+801071dd:	72 2c                	jb     8010720b <scheduler+0x66>
+801071df:	eb 3a                	jmp    8010721b <scheduler+0x76>
+    idle = 1;  // assume idle unless we schedule a process
+801071e1:	bb 01 00 00 00       	mov    $0x1,%ebx
+      if(ticks >= ptable.PromoteAtTime && MAXPRIO > 0){
+801071e6:	a1 50 f3 13 80       	mov    0x8013f350,%eax
+801071eb:	39 05 60 f3 13 80    	cmp    %eax,0x8013f360
+801071f1:	0f 83 d3 00 00 00    	jae    801072ca <scheduler+0x125>
+      release(&ptable.lock);
+801071f7:	83 ec 0c             	sub    $0xc,%esp
+801071fa:	68 00 ad 13 80       	push   $0x8013ad00
+801071ff:	e8 43 14 00 00       	call   80108647 <release>
+    if (idle) {
+80107204:	83 c4 10             	add    $0x10,%esp
+80107207:	85 db                	test   %ebx,%ebx
+80107209:	74 02                	je     8010720d <scheduler+0x68>
+  asm volatile("sti");
+8010720b:	fb                   	sti
+
+// hlt() added by Noah Zentzis, Fall 2016.
+static inline void
+hlt()
+{
+  asm volatile("hlt");
+8010720c:	f4                   	hlt
+8010720d:	fb                   	sti
+    rq = runqPick(self);
+8010720e:	89 f0                	mov    %esi,%eax
+80107210:	e8 86 f2 ff ff       	call   8010649b <runqPick>
+80107215:	89 c3                	mov    %eax,%ebx
+    if(rq >= 0 || (MAXPRIO > 0 && ticks >= ptable.PromoteAtTime)){
+80107217:	85 c0                	test   %eax,%eax
+80107219:	78 b7                	js     801071d2 <scheduler+0x2d>
+      acquire(&ptable.lock);
+8010721b:	83 ec 0c             	sub    $0xc,%esp
+8010721e:	68 00 ad 13 80       	push   $0x8013ad00
+80107223:	e8 ba 13 00 00       	call   801085e2 <acquire>
+      if(rq >= 0 && (p = runqHead(&runq[rq])) != NULL){
+80107228:	83 c4 10             	add    $0x10,%esp
+8010722b:	85 db                	test   %ebx,%ebx
+8010722d:	78 b2                	js     801071e1 <scheduler+0x3c>
+8010722f:	c1 e3 07             	shl    $0x7,%ebx
+80107232:	8d 83 00 a9 13 80    	lea    -0x7fec5700(%ebx),%eax
+80107238:	e8 4c f0 ff ff       	call   80106289 <runqHead>
+8010723d:	89 c3                	mov    %eax,%ebx
+8010723f:	85 c0                	test   %eax,%eax
+80107241:	74 7d                	je     801072c0 <scheduler+0x11b>
+        c->proc = p;
+80107243:	89 87 ac 00 00 00    	mov    %eax,0xac(%edi)
+        switchuvm(p);
+80107249:	83 ec 0c             	sub    $0xc,%esp
+8010724c:	50                   	push   %eax
+8010724d:	e8 1c 42 00 00       	call   8010b46e <switchuvm>
+        runqRemove(p);
+80107252:	89 d8                	mov    %ebx,%eax
+80107254:	e8 b4 f2 ff ff       	call   8010650d <runqRemove>
+        assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+80107259:	c7 04 24 cd 04 00 00 	movl   $0x4cd,(%esp)
+80107260:	b9 48 c8 10 80       	mov    $0x8010c848,%ecx
+80107265:	ba 03 00 00 00       	mov    $0x3,%edx
+8010726a:	89 d8                	mov    %ebx,%eax
+8010726c:	e8 11 f3 ff ff       	call   80106582 <assertState>
+        p->rq = self;  // a stolen process now belongs to this CPU
+80107271:	89 b3 f8 00 00 00    	mov    %esi,0xf8(%ebx)
+        p->state = RUNNING;
+80107277:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+        stateListAdd(&ptable.list[p->state],p);
+8010727e:	89 da                	mov    %ebx,%edx
+80107280:	b8 58 f1 13 80       	mov    $0x8013f158,%eax
+80107285:	e8 d0 f0 ff ff       	call   8010635a <stateListAdd>
+        p->cpu_ticks_in = ticks;
+8010728a:	a1 60 f3 13 80       	mov    0x8013f360,%eax
+8010728f:	89 83 e0 00 00 00    	mov    %eax,0xe0(%ebx)
+        swtch(&(c->scheduler), p->context);
+80107295:	83 c4 08             	add    $0x8,%esp
+80107298:	ff 73 24             	push   0x24(%ebx)
+8010729b:	8d 47 04             	lea    0x4(%edi),%eax
+8010729e:	50                   	push   %eax
+8010729f:	e8 ab 15 00 00       	call   8010884f <swtch>
+        switchkvm();
+801072a4:	e8 b7 41 00 00       	call   8010b460 <switchkvm>
+        c->proc = 0;
+801072a9:	c7 87 ac 00 00 00 00 	movl   $0x0,0xac(%edi)
+801072b0:	00 00 00 
+801072b3:	83 c4 10             	add    $0x10,%esp
+        idle = 0;  // not idle this timeslice
+801072b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+801072bb:	e9 26 ff ff ff       	jmp    801071e6 <scheduler+0x41>
+    idle = 1;  // assume idle unless we schedule a process
+801072c0:	bb 01 00 00 00       	mov    $0x1,%ebx
+801072c5:	e9 1c ff ff ff       	jmp    801071e6 <scheduler+0x41>
+        promote();
+801072ca:	e8 c5 fd ff ff       	call   80107094 <promote>
+        ptable.PromoteAtTime = ticks + TICKS_TO_PROMOTE;
+801072cf:	a1 60 f3 13 80       	mov    0x8013f360,%eax
+801072d4:	05 b8 0b 00 00       	add    $0xbb8,%eax
+801072d9:	a3 50 f3 13 80       	mov    %eax,0x8013f350
+801072de:	e9 14 ff ff ff       	jmp    801071f7 <scheduler+0x52>
+
+801072e3 <getpriority>:
+
+int
+getpriority(int pid)
+{
+801072e3:	55                   	push   %ebp
+801072e4:	89 e5                	mov    %esp,%ebp
+801072e6:	53                   	push   %ebx
+801072e7:	83 ec 10             	sub    $0x10,%esp
+  struct proc * p;
+  int prio = -1;
+
+  acquire(&ptable.lock);
+801072ea:	68 00 ad 13 80       	push   $0x8013ad00
+801072ef:	e8 ee 12 00 00       	call   801085e2 <acquire>
+  p = pidlookup(pid);
+801072f4:	8b 45 08             	mov    0x8(%ebp),%eax
+801072f7:	e8 0a f0 ff ff       	call   80106306 <pidlookup>
+  if(p != NULL)
+801072fc:	83 c4 10             	add    $0x10,%esp
+801072ff:	85 c0                	test   %eax,%eax
+80107301:	74 1a                	je     8010731d <getpriority+0x3a>
+    prio = p->priority;
+80107303:	8b 98 f0 00 00 00    	mov    0xf0(%eax),%ebx
+  release(&ptable.lock);
+80107309:	83 ec 0c             	sub    $0xc,%esp
+8010730c:	68 00 ad 13 80       	push   $0x8013ad00
+80107311:	e8 31 13 00 00       	call   80108647 <release>
+  return prio;
+}
+80107316:	89 d8                	mov    %ebx,%eax
+80107318:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010731b:	c9                   	leave
+8010731c:	c3                   	ret
+  int prio = -1;
+8010731d:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80107322:	eb e5                	jmp    80107309 <getpriority+0x26>
+
+80107324 <FindPID>:
+//only used when ptable lock is being held
+struct proc*
+FindPID(int pid)
+{
+80107324:	55                   	push   %ebp
+80107325:	89 e5                	mov    %esp,%ebp
+80107327:	53                   	push   %ebx
+80107328:	83 ec 04             	sub    $0x4,%esp
+  struct proc * p = pidlookup(pid);
+8010732b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010732e:	e8 d3 ef ff ff       	call   80106306 <pidlookup>
+
+  if(p != NULL && (p->state == RUNNING || p->state == SLEEPING ||
+80107333:	85 c0                	test   %eax,%eax
+80107335:	74 1d                	je     80107354 <FindPID+0x30>
+80107337:	8b 50 0c             	mov    0xc(%eax),%edx
+8010733a:	83 fa 04             	cmp    $0x4,%edx
+8010733d:	0f 94 c1             	sete   %cl
+80107340:	83 fa 02             	cmp    $0x2,%edx
+80107343:	0f 94 c3             	sete   %bl
+80107346:	08 d9                	or     %bl,%cl
+80107348:	75 0a                	jne    80107354 <FindPID+0x30>
+8010734a:	83 fa 03             	cmp    $0x3,%edx
+8010734d:	74 05                	je     80107354 <FindPID+0x30>
+                   p->state == RUNNABLE))
+    return p;
+  return NULL;
+8010734f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107354:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107357:	c9                   	leave
+80107358:	c3                   	ret
+
+80107359 <setpriority>:
+
+int
+setpriority(int pid, int priority)
+{
+80107359:	55                   	push   %ebp
+8010735a:	89 e5                	mov    %esp,%ebp
+8010735c:	56                   	push   %esi
+8010735d:	53                   	push   %ebx
+8010735e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&ptable.lock);
+80107361:	83 ec 0c             	sub    $0xc,%esp
+80107364:	68 00 ad 13 80       	push   $0x8013ad00
+80107369:	e8 74 12 00 00       	call   801085e2 <acquire>
+
+  struct proc* p = FindPID(pid);
+8010736e:	83 c4 04             	add    $0x4,%esp
+80107371:	ff 75 08             	push   0x8(%ebp)
+80107374:	e8 ab ff ff ff       	call   80107324 <FindPID>
+80107379:	83 c4 10             	add    $0x10,%esp
+  if(p == NULL){
+8010737c:	85 c0                	test   %eax,%eax
+8010737e:	74 3c                	je     801073bc <setpriority+0x63>
+80107380:	89 c3                	mov    %eax,%ebx
+    release(&ptable.lock);
+    return -1;
+  }
+  if(p->priority != priority && p->state == RUNNABLE){
+80107382:	39 b0 f0 00 00 00    	cmp    %esi,0xf0(%eax)
+80107388:	74 06                	je     80107390 <setpriority+0x37>
+8010738a:	83 78 0c 03          	cmpl   $0x3,0xc(%eax)
+8010738e:	74 43                	je     801073d3 <setpriority+0x7a>
+    runqAdd(p->rq, p);
+    release(&ptable.lock);
+    return 0;
+  }
+  else{
+    p->budget = DEFAULT_BUDGET;
+80107390:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+80107397:	01 00 00 
+    p->priority = priority;
+8010739a:	89 b3 f0 00 00 00    	mov    %esi,0xf0(%ebx)
+    release(&ptable.lock);
+801073a0:	83 ec 0c             	sub    $0xc,%esp
+801073a3:	68 00 ad 13 80       	push   $0x8013ad00
+801073a8:	e8 9a 12 00 00       	call   80108647 <release>
+    return 0;
+801073ad:	83 c4 10             	add    $0x10,%esp
+801073b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  release(&ptable.lock); 
+  return -1;
+
+
+}
+801073b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801073b8:	5b                   	pop    %ebx
+801073b9:	5e                   	pop    %esi
+801073ba:	5d                   	pop    %ebp
+801073bb:	c3                   	ret
+    release(&ptable.lock);
+801073bc:	83 ec 0c             	sub    $0xc,%esp
+801073bf:	68 00 ad 13 80       	push   $0x8013ad00
+801073c4:	e8 7e 12 00 00       	call   80108647 <release>
+    return -1;
+801073c9:	83 c4 10             	add    $0x10,%esp
+801073cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801073d1:	eb e2                	jmp    801073b5 <setpriority+0x5c>
+    runqRemove(p);
+801073d3:	e8 35 f1 ff ff       	call   8010650d <runqRemove>
+    assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+801073d8:	83 ec 0c             	sub    $0xc,%esp
+801073db:	68 96 07 00 00       	push   $0x796
+801073e0:	b9 1c c8 10 80       	mov    $0x8010c81c,%ecx
+801073e5:	ba 03 00 00 00       	mov    $0x3,%edx
+801073ea:	89 d8                	mov    %ebx,%eax
+801073ec:	e8 91 f1 ff ff       	call   80106582 <assertState>
+    p->budget = DEFAULT_BUDGET;
+801073f1:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+801073f8:	01 00 00 
+    p->priority = priority;
+801073fb:	89 b3 f0 00 00 00    	mov    %esi,0xf0(%ebx)
+    runqAdd(p->rq, p);
+80107401:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80107407:	89 da                	mov    %ebx,%edx
+80107409:	e8 34 f0 ff ff       	call   80106442 <runqAdd>
+    release(&ptable.lock);
+8010740e:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80107415:	e8 2d 12 00 00       	call   80108647 <release>
+    return 0;
+8010741a:	83 c4 10             	add    $0x10,%esp
+8010741d:	b8 00 00 00 00       	mov    $0x0,%eax
+80107422:	eb 91                	jmp    801073b5 <setpriority+0x5c>
+
+80107424 <schedDemote>:
+//Called under sched only and while lock is held
+void
+schedDemote(int pid, int priority){
+80107424:	55                   	push   %ebp
+80107425:	89 e5                	mov    %esp,%ebp
+80107427:	56                   	push   %esi
+80107428:	53                   	push   %ebx
+80107429:	8b 75 0c             	mov    0xc(%ebp),%esi
+  
+  struct proc * p = FindPID(pid);
+8010742c:	83 ec 0c             	sub    $0xc,%esp
+8010742f:	ff 75 08             	push   0x8(%ebp)
+80107432:	e8 ed fe ff ff       	call   80107324 <FindPID>
+80107437:	83 c4 10             	add    $0x10,%esp
+  if(p == NULL){
+8010743a:	85 c0                	test   %eax,%eax
+8010743c:	74 20                	je     8010745e <schedDemote+0x3a>
+8010743e:	89 c3                	mov    %eax,%ebx
+    return ;
+  }
+  if(p->priority != priority && p->state == RUNNABLE){
+80107440:	39 b0 f0 00 00 00    	cmp    %esi,0xf0(%eax)
+80107446:	74 06                	je     8010744e <schedDemote+0x2a>
+80107448:	83 78 0c 03          	cmpl   $0x3,0xc(%eax)
+8010744c:	74 17                	je     80107465 <schedDemote+0x41>
+    p->priority = priority;
+    runqAdd(p->rq, p);
+    return ;
+  }
+  else{
+    p->budget = DEFAULT_BUDGET;
+8010744e:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+80107455:	01 00 00 
+    p->priority = priority;
+80107458:	89 b3 f0 00 00 00    	mov    %esi,0xf0(%ebx)
+    return ;
+  }
+  return;
+}
+8010745e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107461:	5b                   	pop    %ebx
+80107462:	5e                   	pop    %esi
+80107463:	5d                   	pop    %ebp
+80107464:	c3                   	ret
+    runqRemove(p);
+80107465:	e8 a3 f0 ff ff       	call   8010650d <runqRemove>
+    assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+8010746a:	83 ec 0c             	sub    $0xc,%esp
+8010746d:	68 b2 07 00 00       	push   $0x7b2
+80107472:	b9 10 c8 10 80       	mov    $0x8010c810,%ecx
+80107477:	ba 03 00 00 00       	mov    $0x3,%edx
+8010747c:	89 d8                	mov    %ebx,%eax
+8010747e:	e8 ff f0 ff ff       	call   80106582 <assertState>
+    p->budget = DEFAULT_BUDGET;
+80107483:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+8010748a:	01 00 00 
+    p->priority = priority;
+8010748d:	89 b3 f0 00 00 00    	mov    %esi,0xf0(%ebx)
+    runqAdd(p->rq, p);
+80107493:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80107499:	89 da                	mov    %ebx,%edx
+8010749b:	e8 a2 ef ff ff       	call   80106442 <runqAdd>
+    return ;
+801074a0:	83 c4 10             	add    $0x10,%esp
+801074a3:	eb b9                	jmp    8010745e <schedDemote+0x3a>
+
+801074a5 <sched>:
+{
+801074a5:	55                   	push   %ebp
+801074a6:	89 e5                	mov    %esp,%ebp
+801074a8:	56                   	push   %esi
+801074a9:	53                   	push   %ebx
+  struct proc *p = myproc();
+801074aa:	e8 9d f4 ff ff       	call   8010694c <myproc>
+801074af:	89 c3                	mov    %eax,%ebx
+  if(!holding(&ptable.lock))
+801074b1:	83 ec 0c             	sub    $0xc,%esp
+801074b4:	68 00 ad 13 80       	push   $0x8013ad00
+801074b9:	e8 e5 10 00 00       	call   801085a3 <holding>
+801074be:	83 c4 10             	add    $0x10,%esp
+801074c1:	85 c0                	test   %eax,%eax
+801074c3:	0f 84 8d 00 00 00    	je     80107556 <sched+0xb1>
+  if(mycpu()->ncli != 1)
+801074c9:	e8 07 f4 ff ff       	call   801068d5 <mycpu>
+801074ce:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+801074d5:	0f 85 88 00 00 00    	jne    80107563 <sched+0xbe>
+  if(p->state == RUNNING)
+801074db:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+801074df:	0f 84 8b 00 00 00    	je     80107570 <sched+0xcb>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801074e5:	9c                   	pushf
+801074e6:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801074e7:	f6 c4 02             	test   $0x2,%ah
+801074ea:	0f 85 8d 00 00 00    	jne    8010757d <sched+0xd8>
+  intena = mycpu()->intena;
+801074f0:	e8 e0 f3 ff ff       	call   801068d5 <mycpu>
+801074f5:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  p->cpu_ticks_total += (ticks - p->cpu_ticks_in);
+801074fb:	8b 15 60 f3 13 80    	mov    0x8013f360,%edx
+80107501:	8b 83 e0 00 00 00    	mov    0xe0(%ebx),%eax
+80107507:	89 d1                	mov    %edx,%ecx
+80107509:	29 c1                	sub    %eax,%ecx
+8010750b:	01 8b dc 00 00 00    	add    %ecx,0xdc(%ebx)
+  p->budget = p->budget - (ticks - p->cpu_ticks_in);
+80107511:	29 d0                	sub    %edx,%eax
+80107513:	03 83 f4 00 00 00    	add    0xf4(%ebx),%eax
+80107519:	89 83 f4 00 00 00    	mov    %eax,0xf4(%ebx)
+  if(p->priority != 0 && p->budget <= 0)
+8010751f:	8b 93 f0 00 00 00    	mov    0xf0(%ebx),%edx
+80107525:	85 d2                	test   %edx,%edx
+80107527:	74 04                	je     8010752d <sched+0x88>
+80107529:	85 c0                	test   %eax,%eax
+8010752b:	7e 5d                	jle    8010758a <sched+0xe5>
+  swtch(&p->context, mycpu()->scheduler);
+8010752d:	e8 a3 f3 ff ff       	call   801068d5 <mycpu>
+80107532:	83 ec 08             	sub    $0x8,%esp
+80107535:	ff 70 04             	push   0x4(%eax)
+80107538:	83 c3 24             	add    $0x24,%ebx
+8010753b:	53                   	push   %ebx
+8010753c:	e8 0e 13 00 00       	call   8010884f <swtch>
+  mycpu()->intena = intena;
+80107541:	e8 8f f3 ff ff       	call   801068d5 <mycpu>
+80107546:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+8010754c:	83 c4 10             	add    $0x10,%esp
+8010754f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107552:	5b                   	pop    %ebx
+80107553:	5e                   	pop    %esi
+80107554:	5d                   	pop    %ebp
+80107555:	c3                   	ret
+    panic("sched ptable.lock");
+80107556:	83 ec 0c             	sub    $0xc,%esp
+80107559:	68 a1 c6 10 80       	push   $0x8010c6a1
+8010755e:	e8 93 96 ff ff       	call   80100bf6 <panic>
+    panic("sched locks");
+80107563:	83 ec 0c             	sub    $0xc,%esp
+80107566:	68 b3 c6 10 80       	push   $0x8010c6b3
+8010756b:	e8 86 96 ff ff       	call   80100bf6 <panic>
+    panic("sched running");
+80107570:	83 ec 0c             	sub    $0xc,%esp
+80107573:	68 bf c6 10 80       	push   $0x8010c6bf
+80107578:	e8 79 96 ff ff       	call   80100bf6 <panic>
+    panic("sched interruptible");
+8010757d:	83 ec 0c             	sub    $0xc,%esp
+80107580:	68 cd c6 10 80       	push   $0x8010c6cd
+80107585:	e8 6c 96 ff ff       	call   80100bf6 <panic>
+    schedDemote(p->pid, p->priority -1);
+8010758a:	83 ea 01             	sub    $0x1,%edx
+8010758d:	8b 43 10             	mov    0x10(%ebx),%eax
+80107590:	83 ec 08             	sub    $0x8,%esp
+80107593:	52                   	push   %edx
+80107594:	50                   	push   %eax
+80107595:	e8 8a fe ff ff       	call   80107424 <schedDemote>
+8010759a:	83 c4 10             	add    $0x10,%esp
+8010759d:	eb 8e                	jmp    8010752d <sched+0x88>
+
+8010759f <exit>:
+{
+8010759f:	55                   	push   %ebp
+801075a0:	89 e5                	mov    %esp,%ebp
+801075a2:	57                   	push   %edi
+801075a3:	56                   	push   %esi
+801075a4:	53                   	push   %ebx
+801075a5:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+801075a8:	e8 9f f3 ff ff       	call   8010694c <myproc>
+  if(curproc == initproc)
+801075ad:	39 05 c0 a8 13 80    	cmp    %eax,0x8013a8c0
+801075b3:	74 09                	je     801075be <exit+0x1f>
+801075b5:	89 c3                	mov    %eax,%ebx
+  for(fd = 0; fd < curproc->nofile; fd++){
+801075b7:	be 00 00 00 00       	mov    $0x0,%esi
+801075bc:	eb 10                	jmp    801075ce <exit+0x2f>
+    panic("init exiting");
+801075be:	83 ec 0c             	sub    $0xc,%esp
+801075c1:	68 e1 c6 10 80       	push   $0x8010c6e1
+801075c6:	e8 2b 96 ff ff       	call   80100bf6 <panic>
+  for(fd = 0; fd < curproc->nofile; fd++){
+801075cb:	83 c6 01             	add    $0x1,%esi
+801075ce:	39 73 34             	cmp    %esi,0x34(%ebx)
+801075d1:	7e 28                	jle    801075fb <exit+0x5c>
+    if(curproc->ofile[fd]){
+801075d3:	8b 43 30             	mov    0x30(%ebx),%eax
+801075d6:	8d 3c b5 00 00 00 00 	lea    0x0(,%esi,4),%edi
+801075dd:	8b 04 b0             	mov    (%eax,%esi,4),%eax
+801075e0:	85 c0                	test   %eax,%eax
+801075e2:	74 e7                	je     801075cb <exit+0x2c>
+      fileclose(curproc->ofile[fd]);
+801075e4:	83 ec 0c             	sub    $0xc,%esp
+801075e7:	50                   	push   %eax
+801075e8:	e8 8e a2 ff ff       	call   8010187b <fileclose>
+      curproc->ofile[fd] = 0;
+801075ed:	03 7b 30             	add    0x30(%ebx),%edi
+801075f0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+801075f6:	83 c4 10             	add    $0x10,%esp
+801075f9:	eb d0                	jmp    801075cb <exit+0x2c>
+  ofilefree(curproc);
+801075fb:	89 d8                	mov    %ebx,%eax
+801075fd:	e8 f4 f1 ff ff       	call   801067f6 <ofilefree>
+  begin_op();
+80107602:	e8 90 dc ff ff       	call   80105297 <begin_op>
+  iput(curproc->cwd);
+80107607:	83 ec 0c             	sub    $0xc,%esp
+8010760a:	ff 73 78             	push   0x78(%ebx)
+8010760d:	e8 6d ba ff ff       	call   8010307f <iput>
+  if(curproc->exe){
+80107612:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80107615:	83 c4 10             	add    $0x10,%esp
+80107618:	85 c0                	test   %eax,%eax
+8010761a:	74 19                	je     80107635 <exit+0x96>
+    iexecref(curproc->exe, -1);
+8010761c:	83 ec 08             	sub    $0x8,%esp
+8010761f:	6a ff                	push   $0xffffffff
+80107621:	50                   	push   %eax
+80107622:	e8 14 ba ff ff       	call   8010303b <iexecref>
+    iput(curproc->exe);
+80107627:	83 c4 04             	add    $0x4,%esp
+8010762a:	ff 73 7c             	push   0x7c(%ebx)
+8010762d:	e8 4d ba ff ff       	call   8010307f <iput>
+80107632:	83 c4 10             	add    $0x10,%esp
+  end_op();
+80107635:	e8 d7 dc ff ff       	call   80105311 <end_op>
+  curproc->cwd = 0;
+8010763a:	c7 43 78 00 00 00 00 	movl   $0x0,0x78(%ebx)
+  curproc->exe = 0;
+80107641:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  acquire(&ptable.lock);
+80107648:	83 ec 0c             	sub    $0xc,%esp
+8010764b:	68 00 ad 13 80       	push   $0x8013ad00
+80107650:	e8 8d 0f 00 00       	call   801085e2 <acquire>
+  wakeup1(curproc->parent);
+80107655:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80107658:	e8 1c f1 ff ff       	call   80106779 <wakeup1>
+  for(p= ptable.list[RUNNING].head; p!= NULL; p = p->next){
+8010765d:	a1 58 f1 13 80       	mov    0x8013f158,%eax
+80107662:	83 c4 10             	add    $0x10,%esp
+80107665:	eb 06                	jmp    8010766d <exit+0xce>
+80107667:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+8010766d:	85 c0                	test   %eax,%eax
+8010766f:	74 10                	je     80107681 <exit+0xe2>
+    if(p->parent == curproc){
+80107671:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80107674:	75 f1                	jne    80107667 <exit+0xc8>
+      p->parent = initproc;
+80107676:	8b 15 c0 a8 13 80    	mov    0x8013a8c0,%edx
+8010767c:	89 50 1c             	mov    %edx,0x1c(%eax)
+8010767f:	eb e6                	jmp    80107667 <exit+0xc8>
+  for(struct runq *q = runq; q < &runq[ncpu]; q++){
+80107681:	be 00 a9 13 80       	mov    $0x8013a900,%esi
+80107686:	eb 2a                	jmp    801076b2 <exit+0x113>
+      for(p= q->ready[i].head; p!= NULL; p = p->next){
+80107688:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+8010768e:	85 c0                	test   %eax,%eax
+80107690:	74 10                	je     801076a2 <exit+0x103>
+        if(p->parent == curproc){
+80107692:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80107695:	75 f1                	jne    80107688 <exit+0xe9>
+          p->parent = initproc;
+80107697:	8b 15 c0 a8 13 80    	mov    0x8013a8c0,%edx
+8010769d:	89 50 1c             	mov    %edx,0x1c(%eax)
+801076a0:	eb e6                	jmp    80107688 <exit+0xe9>
+    for(int i = MAXPRIO; i >= 0; --i){
+801076a2:	83 e9 01             	sub    $0x1,%ecx
+801076a5:	85 c9                	test   %ecx,%ecx
+801076a7:	78 06                	js     801076af <exit+0x110>
+      for(p= q->ready[i].head; p!= NULL; p = p->next){
+801076a9:	8b 44 ce 34          	mov    0x34(%esi,%ecx,8),%eax
+801076ad:	eb df                	jmp    8010768e <exit+0xef>
+  for(struct runq *q = runq; q < &runq[ncpu]; q++){
+801076af:	83 ee 80             	sub    $0xffffff80,%esi
+801076b2:	a1 04 a3 13 80       	mov    0x8013a304,%eax
+801076b7:	c1 e0 07             	shl    $0x7,%eax
+801076ba:	05 00 a9 13 80       	add    $0x8013a900,%eax
+801076bf:	39 c6                	cmp    %eax,%esi
+801076c1:	73 07                	jae    801076ca <exit+0x12b>
+    for(int i = MAXPRIO; i >= 0; --i){
+801076c3:	b9 06 00 00 00       	mov    $0x6,%ecx
+801076c8:	eb db                	jmp    801076a5 <exit+0x106>
+  for(int i = 0; i < NSLEEPQ; i++){
+801076ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+801076cf:	eb 1d                	jmp    801076ee <exit+0x14f>
+    for(p= ptable.sleepq[i].head; p!= NULL; p = p->next){
+801076d1:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+801076d7:	85 c0                	test   %eax,%eax
+801076d9:	74 10                	je     801076eb <exit+0x14c>
+      if(p->parent == curproc){
+801076db:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+801076de:	75 f1                	jne    801076d1 <exit+0x132>
+        p->parent = initproc;
+801076e0:	8b 15 c0 a8 13 80    	mov    0x8013a8c0,%edx
+801076e6:	89 50 1c             	mov    %edx,0x1c(%eax)
+801076e9:	eb e6                	jmp    801076d1 <exit+0x132>
+  for(int i = 0; i < NSLEEPQ; i++){
+801076eb:	83 c1 01             	add    $0x1,%ecx
+801076ee:	83 f9 3c             	cmp    $0x3c,%ecx
+801076f1:	7f 09                	jg     801076fc <exit+0x15d>
+    for(p= ptable.sleepq[i].head; p!= NULL; p = p->next){
+801076f3:	8b 04 cd 68 f1 13 80 	mov    -0x7fec0e98(,%ecx,8),%eax
+801076fa:	eb db                	jmp    801076d7 <exit+0x138>
+  for(p= ptable.list[EMBRYO].head; p!= NULL; p = p->next){
+801076fc:	a1 40 f1 13 80       	mov    0x8013f140,%eax
+80107701:	eb 06                	jmp    80107709 <exit+0x16a>
+80107703:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80107709:	85 c0                	test   %eax,%eax
+8010770b:	74 10                	je     8010771d <exit+0x17e>
+    if(p->parent == curproc){
+8010770d:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80107710:	75 f1                	jne    80107703 <exit+0x164>
+      p->parent = initproc;
+80107712:	8b 15 c0 a8 13 80    	mov    0x8013a8c0,%edx
+80107718:	89 50 1c             	mov    %edx,0x1c(%eax)
+8010771b:	eb e6                	jmp    80107703 <exit+0x164>
+  for(p = ptable.list[ZOMBIE].head; p != NULL; p = p->next){
+8010771d:	8b 35 60 f1 13 80    	mov    0x8013f160,%esi
+80107723:	eb 06                	jmp    8010772b <exit+0x18c>
+80107725:	8b b6 e4 00 00 00    	mov    0xe4(%esi),%esi
+8010772b:	85 f6                	test   %esi,%esi
+8010772d:	74 14                	je     80107743 <exit+0x1a4>
+    if(p->parent == curproc){
+8010772f:	39 5e 1c             	cmp    %ebx,0x1c(%esi)
+80107732:	75 f1                	jne    80107725 <exit+0x186>
+      p->parent = initproc;
+80107734:	a1 c0 a8 13 80       	mov    0x8013a8c0,%eax
+80107739:	89 46 1c             	mov    %eax,0x1c(%esi)
+      wakeup1(initproc);
+8010773c:	e8 38 f0 ff ff       	call   80106779 <wakeup1>
+80107741:	eb e2                	jmp    80107725 <exit+0x186>
+  if(stateListRemove(&ptable.list[curproc->state], curproc) < 0){
+80107743:	8b 43 0c             	mov    0xc(%ebx),%eax
+80107746:	8d 04 c5 38 f1 13 80 	lea    -0x7fec0ec8(,%eax,8),%eax
+8010774d:	89 da                	mov    %ebx,%edx
+8010774f:	e8 01 ea ff ff       	call   80106155 <stateListRemove>
+80107754:	85 c0                	test   %eax,%eax
+80107756:	78 43                	js     8010779b <exit+0x1fc>
+  assertState(curproc, RUNNING, __FUNCTION__, __LINE__);
+80107758:	83 ec 0c             	sub    $0xc,%esp
+8010775b:	68 4d 03 00 00       	push   $0x34d
+80107760:	b9 64 c8 10 80       	mov    $0x8010c864,%ecx
+80107765:	ba 04 00 00 00       	mov    $0x4,%edx
+8010776a:	89 d8                	mov    %ebx,%eax
+8010776c:	e8 11 ee ff ff       	call   80106582 <assertState>
+  curproc->state = ZOMBIE;
+80107771:	c7 43 0c 05 00 00 00 	movl   $0x5,0xc(%ebx)
+  stateListAdd(&ptable.list[curproc->state], curproc);
+80107778:	89 da                	mov    %ebx,%edx
+8010777a:	b8 60 f1 13 80       	mov    $0x8013f160,%eax
+8010777f:	e8 d6 eb ff ff       	call   8010635a <stateListAdd>
+  curproc->sz = 0;
+80107784:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  sched();
+8010778a:	e8 16 fd ff ff       	call   801074a5 <sched>
+  panic("zombie exit");
+8010778f:	c7 04 24 ee c6 10 80 	movl   $0x8010c6ee,(%esp)
+80107796:	e8 5b 94 ff ff       	call   80100bf6 <panic>
+    panic("Process could not be removed from RUNNING list");
+8010779b:	83 ec 0c             	sub    $0xc,%esp
+8010779e:	68 8c c5 10 80       	push   $0x8010c58c
+801077a3:	e8 4e 94 ff ff       	call   80100bf6 <panic>
+
+801077a8 <yield>:
+{
+801077a8:	55                   	push   %ebp
+801077a9:	89 e5                	mov    %esp,%ebp
+801077ab:	53                   	push   %ebx
+801077ac:	83 ec 04             	sub    $0x4,%esp
+  struct proc *curproc = myproc();
+801077af:	e8 98 f1 ff ff       	call   8010694c <myproc>
+801077b4:	89 c3                	mov    %eax,%ebx
+  acquire(&ptable.lock);  //DOC: yieldlock
+801077b6:	83 ec 0c             	sub    $0xc,%esp
+801077b9:	68 00 ad 13 80       	push   $0x8013ad00
+801077be:	e8 1f 0e 00 00       	call   801085e2 <acquire>
+  if(stateListRemove(&ptable.list[curproc->state], curproc) <0){
+801077c3:	8b 43 0c             	mov    0xc(%ebx),%eax
+801077c6:	8d 04 c5 38 f1 13 80 	lea    -0x7fec0ec8(,%eax,8),%eax
+801077cd:	89 da                	mov    %ebx,%edx
+801077cf:	e8 81 e9 ff ff       	call   80106155 <stateListRemove>
+801077d4:	83 c4 10             	add    $0x10,%esp
+801077d7:	85 c0                	test   %eax,%eax
+801077d9:	78 65                	js     80107840 <yield+0x98>
+  assertState(curproc, RUNNING, __FUNCTION__, __LINE__);
+801077db:	83 ec 0c             	sub    $0xc,%esp
+801077de:	68 a4 05 00 00       	push   $0x5a4
+801077e3:	b9 40 c8 10 80       	mov    $0x8010c840,%ecx
+801077e8:	ba 04 00 00 00       	mov    $0x4,%edx
+801077ed:	89 d8                	mov    %ebx,%eax
+801077ef:	e8 8e ed ff ff       	call   80106582 <assertState>
+  curproc->state = RUNNABLE;
+801077f4:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  curproc->budget = curproc->budget - (ticks - curproc->cpu_ticks_in);
+801077fb:	8b 83 e0 00 00 00    	mov    0xe0(%ebx),%eax
+80107801:	2b 05 60 f3 13 80    	sub    0x8013f360,%eax
+80107807:	03 83 f4 00 00 00    	add    0xf4(%ebx),%eax
+8010780d:	89 83 f4 00 00 00    	mov    %eax,0xf4(%ebx)
+  if(curproc->budget <= 0){
+80107813:	83 c4 10             	add    $0x10,%esp
+80107816:	85 c0                	test   %eax,%eax
+80107818:	7e 33                	jle    8010784d <yield+0xa5>
+  runqAdd(cpuid(), curproc);
+8010781a:	e8 12 f1 ff ff       	call   80106931 <cpuid>
+8010781f:	89 da                	mov    %ebx,%edx
+80107821:	e8 1c ec ff ff       	call   80106442 <runqAdd>
+  sched();
+80107826:	e8 7a fc ff ff       	call   801074a5 <sched>
+  release(&ptable.lock);
+8010782b:	83 ec 0c             	sub    $0xc,%esp
+8010782e:	68 00 ad 13 80       	push   $0x8013ad00
+80107833:	e8 0f 0e 00 00       	call   80108647 <release>
+}
+80107838:	83 c4 10             	add    $0x10,%esp
+8010783b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010783e:	c9                   	leave
+8010783f:	c3                   	ret
+    panic("Process could not be removed from the RUNNING list");	  
+80107840:	83 ec 0c             	sub    $0xc,%esp
+80107843:	68 bc c5 10 80       	push   $0x8010c5bc
+80107848:	e8 a9 93 ff ff       	call   80100bf6 <panic>
+    if(curproc->priority != 0)
+8010784d:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+80107853:	85 c0                	test   %eax,%eax
+80107855:	74 09                	je     80107860 <yield+0xb8>
+      curproc->priority = curproc->priority - 1;
+80107857:	83 e8 01             	sub    $0x1,%eax
+8010785a:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+    curproc->budget = DEFAULT_BUDGET;
+80107860:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+80107867:	01 00 00 
+8010786a:	eb ae                	jmp    8010781a <yield+0x72>
+
+8010786c <sleep>:
+{
+8010786c:	55                   	push   %ebp
+8010786d:	89 e5                	mov    %esp,%ebp
+8010786f:	57                   	push   %edi
+80107870:	56                   	push   %esi
+80107871:	53                   	push   %ebx
+80107872:	83 ec 0c             	sub    $0xc,%esp
+80107875:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107878:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct proc *p = myproc();
+8010787b:	e8 cc f0 ff ff       	call   8010694c <myproc>
+  if(p == 0)
+80107880:	85 c0                	test   %eax,%eax
+80107882:	0f 84 cf 00 00 00    	je     80107957 <sleep+0xeb>
+80107888:	89 c3                	mov    %eax,%ebx
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+8010788a:	81 fe 00 ad 13 80    	cmp    $0x8013ad00,%esi
+80107890:	74 20                	je     801078b2 <sleep+0x46>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+80107892:	83 ec 0c             	sub    $0xc,%esp
+80107895:	68 00 ad 13 80       	push   $0x8013ad00
+8010789a:	e8 43 0d 00 00       	call   801085e2 <acquire>
+    if (lk) release(lk);
+8010789f:	83 c4 10             	add    $0x10,%esp
+801078a2:	85 f6                	test   %esi,%esi
+801078a4:	74 0c                	je     801078b2 <sleep+0x46>
+801078a6:	83 ec 0c             	sub    $0xc,%esp
+801078a9:	56                   	push   %esi
+801078aa:	e8 98 0d 00 00       	call   80108647 <release>
+801078af:	83 c4 10             	add    $0x10,%esp
+  p->chan = chan;
+801078b2:	89 7b 28             	mov    %edi,0x28(%ebx)
+  if(stateListRemove(&ptable.list[p->state],p) < 0){
+801078b5:	8b 43 0c             	mov    0xc(%ebx),%eax
+801078b8:	8d 04 c5 38 f1 13 80 	lea    -0x7fec0ec8(,%eax,8),%eax
+801078bf:	89 da                	mov    %ebx,%edx
+801078c1:	e8 8f e8 ff ff       	call   80106155 <stateListRemove>
+801078c6:	85 c0                	test   %eax,%eax
+801078c8:	0f 88 96 00 00 00    	js     80107964 <sleep+0xf8>
+  assertState(p, RUNNING, __FUNCTION__, __LINE__);
+801078ce:	83 ec 0c             	sub    $0xc,%esp
+801078d1:	68 fd 05 00 00       	push   $0x5fd
+801078d6:	b9 38 c8 10 80       	mov    $0x8010c838,%ecx
+801078db:	ba 04 00 00 00       	mov    $0x4,%edx
+801078e0:	89 d8                	mov    %ebx,%eax
+801078e2:	e8 9b ec ff ff       	call   80106582 <assertState>
+  p->budget = p->budget - (ticks - p->cpu_ticks_in);
+801078e7:	8b 83 e0 00 00 00    	mov    0xe0(%ebx),%eax
+801078ed:	2b 05 60 f3 13 80    	sub    0x8013f360,%eax
+801078f3:	03 83 f4 00 00 00    	add    0xf4(%ebx),%eax
+801078f9:	89 83 f4 00 00 00    	mov    %eax,0xf4(%ebx)
+  if(p->budget <= 0){
+801078ff:	83 c4 10             	add    $0x10,%esp
+80107902:	85 c0                	test   %eax,%eax
+80107904:	7e 6b                	jle    80107971 <sleep+0x105>
+  p->state = SLEEPING;
+80107906:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  stateListAdd(sleepList(chan), p);
+8010790d:	89 f8                	mov    %edi,%eax
+8010790f:	e8 ca e8 ff ff       	call   801061de <sleepList>
+80107914:	89 da                	mov    %ebx,%edx
+80107916:	e8 3f ea ff ff       	call   8010635a <stateListAdd>
+  sched();
+8010791b:	e8 85 fb ff ff       	call   801074a5 <sched>
+  p->chan = 0;
+80107920:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%ebx)
+  if(lk != &ptable.lock){  //DOC: sleeplock2
+80107927:	81 fe 00 ad 13 80    	cmp    $0x8013ad00,%esi
+8010792d:	74 20                	je     8010794f <sleep+0xe3>
+    release(&ptable.lock);
+8010792f:	83 ec 0c             	sub    $0xc,%esp
+80107932:	68 00 ad 13 80       	push   $0x8013ad00
+80107937:	e8 0b 0d 00 00       	call   80108647 <release>
+    if (lk) acquire(lk);
+8010793c:	83 c4 10             	add    $0x10,%esp
+8010793f:	85 f6                	test   %esi,%esi
+80107941:	74 0c                	je     8010794f <sleep+0xe3>
+80107943:	83 ec 0c             	sub    $0xc,%esp
+80107946:	56                   	push   %esi
+80107947:	e8 96 0c 00 00       	call   801085e2 <acquire>
+8010794c:	83 c4 10             	add    $0x10,%esp
+}
+8010794f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107952:	5b                   	pop    %ebx
+80107953:	5e                   	pop    %esi
+80107954:	5f                   	pop    %edi
+80107955:	5d                   	pop    %ebp
+80107956:	c3                   	ret
+    panic("sleep");
+80107957:	83 ec 0c             	sub    $0xc,%esp
+8010795a:	68 fa c6 10 80       	push   $0x8010c6fa
+8010795f:	e8 92 92 ff ff       	call   80100bf6 <panic>
+    panic("Process could not be removed from the RUNNING list");
+80107964:	83 ec 0c             	sub    $0xc,%esp
+80107967:	68 bc c5 10 80       	push   $0x8010c5bc
+8010796c:	e8 85 92 ff ff       	call   80100bf6 <panic>
+    if(p->priority != 0)
+80107971:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+80107977:	85 c0                	test   %eax,%eax
+80107979:	74 09                	je     80107984 <sleep+0x118>
+      p->priority = p->priority - 1;
+8010797b:	83 e8 01             	sub    $0x1,%eax
+8010797e:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+    p->budget = DEFAULT_BUDGET;
+80107984:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+8010798b:	01 00 00 
+8010798e:	e9 73 ff ff ff       	jmp    80107906 <sleep+0x9a>
+
+80107993 <wait>:
+{
+80107993:	55                   	push   %ebp
+80107994:	89 e5                	mov    %esp,%ebp
+80107996:	56                   	push   %esi
+80107997:	53                   	push   %ebx
+  struct proc *curproc = myproc();
+80107998:	e8 af ef ff ff       	call   8010694c <myproc>
+8010799d:	89 c3                	mov    %eax,%ebx
+  acquire(&ptable.lock);
+8010799f:	83 ec 0c             	sub    $0xc,%esp
+801079a2:	68 00 ad 13 80       	push   $0x8013ad00
+801079a7:	e8 36 0c 00 00       	call   801085e2 <acquire>
+801079ac:	83 c4 10             	add    $0x10,%esp
+801079af:	e9 85 01 00 00       	jmp    80107b39 <wait+0x1a6>
+        pid = p->pid;
+801079b4:	8b 5e 10             	mov    0x10(%esi),%ebx
+        kfree(p->kstack);
+801079b7:	83 ec 0c             	sub    $0xc,%esp
+801079ba:	ff 76 08             	push   0x8(%esi)
+801079bd:	e8 4f cf ff ff       	call   80104911 <kfree>
+        p->kstack = 0;
+801079c2:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+        freevm(p->pgdir);
+801079c9:	83 c4 04             	add    $0x4,%esp
+801079cc:	ff 76 04             	push   0x4(%esi)
+801079cf:	e8 75 3e 00 00       	call   8010b849 <freevm>
+        freepid(p);
+801079d4:	89 f0                	mov    %esi,%eax
+801079d6:	e8 fb e8 ff ff       	call   801062d6 <freepid>
+        p->parent = 0;
+801079db:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+        p->name[0] = 0;
+801079e2:	c6 86 b4 00 00 00 00 	movb   $0x0,0xb4(%esi)
+        p->killed = 0;
+801079e9:	c7 46 2c 00 00 00 00 	movl   $0x0,0x2c(%esi)
+	if(stateListRemove(&ptable.list[p->state], p) < 0){
+801079f0:	8b 46 0c             	mov    0xc(%esi),%eax
+801079f3:	8d 04 c5 38 f1 13 80 	lea    -0x7fec0ec8(,%eax,8),%eax
+801079fa:	89 f2                	mov    %esi,%edx
+801079fc:	e8 54 e7 ff ff       	call   80106155 <stateListRemove>
+80107a01:	83 c4 10             	add    $0x10,%esp
+80107a04:	85 c0                	test   %eax,%eax
+80107a06:	78 44                	js     80107a4c <wait+0xb9>
+	assertState(p, ZOMBIE, __FUNCTION__, __LINE__);
+80107a08:	83 ec 0c             	sub    $0xc,%esp
+80107a0b:	68 fa 03 00 00       	push   $0x3fa
+80107a10:	b9 54 c8 10 80       	mov    $0x8010c854,%ecx
+80107a15:	ba 05 00 00 00       	mov    $0x5,%edx
+80107a1a:	89 f0                	mov    %esi,%eax
+80107a1c:	e8 61 eb ff ff       	call   80106582 <assertState>
+        p->state = UNUSED;
+80107a21:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+	stateListAdd(&ptable.list[p->state], p);
+80107a28:	89 f2                	mov    %esi,%edx
+80107a2a:	b8 38 f1 13 80       	mov    $0x8013f138,%eax
+80107a2f:	e8 26 e9 ff ff       	call   8010635a <stateListAdd>
+        release(&ptable.lock);
+80107a34:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+80107a3b:	e8 07 0c 00 00       	call   80108647 <release>
+        return pid;
+80107a40:	89 d8                	mov    %ebx,%eax
+80107a42:	83 c4 10             	add    $0x10,%esp
+}
+80107a45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107a48:	5b                   	pop    %ebx
+80107a49:	5e                   	pop    %esi
+80107a4a:	5d                   	pop    %ebp
+80107a4b:	c3                   	ret
+	  panic("Process could not be removed from ZOMBIE list");
+80107a4c:	83 ec 0c             	sub    $0xc,%esp
+80107a4f:	68 f0 c5 10 80       	push   $0x8010c5f0
+80107a54:	e8 9d 91 ff ff       	call   80100bf6 <panic>
+    for(p = ptable.list[ZOMBIE].head; p != NULL; p = p->next){
+80107a59:	8b b6 e4 00 00 00    	mov    0xe4(%esi),%esi
+80107a5f:	85 f6                	test   %esi,%esi
+80107a61:	74 16                	je     80107a79 <wait+0xe6>
+      if(p->parent != curproc)
+80107a63:	39 5e 1c             	cmp    %ebx,0x1c(%esi)
+80107a66:	75 f1                	jne    80107a59 <wait+0xc6>
+      if(p->state == ZOMBIE){
+80107a68:	83 7e 0c 05          	cmpl   $0x5,0xc(%esi)
+80107a6c:	0f 84 42 ff ff ff    	je     801079b4 <wait+0x21>
+      havekids = 1;
+80107a72:	b9 01 00 00 00       	mov    $0x1,%ecx
+80107a77:	eb e0                	jmp    80107a59 <wait+0xc6>
+    for(struct runq *q = runq; q < &runq[ncpu]; q++){
+80107a79:	be 00 a9 13 80       	mov    $0x8013a900,%esi
+80107a7e:	eb 24                	jmp    80107aa4 <wait+0x111>
+            havekids = 1;
+80107a80:	b9 01 00 00 00       	mov    $0x1,%ecx
+      for(int i = MAXPRIO; i >= 0; --i){
+80107a85:	83 ea 01             	sub    $0x1,%edx
+80107a88:	85 d2                	test   %edx,%edx
+80107a8a:	78 15                	js     80107aa1 <wait+0x10e>
+        for(p = q->ready[i].head; p != NULL; p = p->next){
+80107a8c:	8b 44 d6 34          	mov    0x34(%esi,%edx,8),%eax
+80107a90:	85 c0                	test   %eax,%eax
+80107a92:	74 f1                	je     80107a85 <wait+0xf2>
+          if(p->parent == curproc){
+80107a94:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80107a97:	74 e7                	je     80107a80 <wait+0xed>
+        for(p = q->ready[i].head; p != NULL; p = p->next){
+80107a99:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80107a9f:	eb ef                	jmp    80107a90 <wait+0xfd>
+    for(struct runq *q = runq; q < &runq[ncpu]; q++){
+80107aa1:	83 ee 80             	sub    $0xffffff80,%esi
+80107aa4:	a1 04 a3 13 80       	mov    0x8013a304,%eax
+80107aa9:	c1 e0 07             	shl    $0x7,%eax
+80107aac:	05 00 a9 13 80       	add    $0x8013a900,%eax
+80107ab1:	39 c6                	cmp    %eax,%esi
+80107ab3:	73 07                	jae    80107abc <wait+0x129>
+      for(int i = MAXPRIO; i >= 0; --i){
+80107ab5:	ba 06 00 00 00       	mov    $0x6,%edx
+80107aba:	eb cc                	jmp    80107a88 <wait+0xf5>
+    for(int i = 0; i < NSLEEPQ; i++){
+80107abc:	ba 00 00 00 00       	mov    $0x0,%edx
+80107ac1:	eb 08                	jmp    80107acb <wait+0x138>
+          havekids = 1;
+80107ac3:	b9 01 00 00 00       	mov    $0x1,%ecx
+    for(int i = 0; i < NSLEEPQ; i++){
+80107ac8:	83 c2 01             	add    $0x1,%edx
+80107acb:	83 fa 3c             	cmp    $0x3c,%edx
+80107ace:	7f 18                	jg     80107ae8 <wait+0x155>
+      for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
+80107ad0:	8b 04 d5 68 f1 13 80 	mov    -0x7fec0e98(,%edx,8),%eax
+80107ad7:	85 c0                	test   %eax,%eax
+80107ad9:	74 ed                	je     80107ac8 <wait+0x135>
+        if(p->parent == curproc){
+80107adb:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80107ade:	74 e3                	je     80107ac3 <wait+0x130>
+      for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
+80107ae0:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80107ae6:	eb ef                	jmp    80107ad7 <wait+0x144>
+    for(p = ptable.list[EMBRYO].head; p != NULL; p = p->next){
+80107ae8:	a1 40 f1 13 80       	mov    0x8013f140,%eax
+80107aed:	85 c0                	test   %eax,%eax
+80107aef:	74 12                	je     80107b03 <wait+0x170>
+      if(p->parent == curproc){
+80107af1:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80107af4:	74 08                	je     80107afe <wait+0x16b>
+    for(p = ptable.list[EMBRYO].head; p != NULL; p = p->next){
+80107af6:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80107afc:	eb ef                	jmp    80107aed <wait+0x15a>
+        havekids = 1;
+80107afe:	b9 01 00 00 00       	mov    $0x1,%ecx
+    for(p = ptable.list[RUNNING].head; p != NULL; p = p->next){
+80107b03:	a1 58 f1 13 80       	mov    0x8013f158,%eax
+80107b08:	eb 06                	jmp    80107b10 <wait+0x17d>
+80107b0a:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80107b10:	85 c0                	test   %eax,%eax
+80107b12:	74 0a                	je     80107b1e <wait+0x18b>
+      if(p->parent == curproc){
+80107b14:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80107b17:	75 f1                	jne    80107b0a <wait+0x177>
+        havekids = 1;
+80107b19:	b9 01 00 00 00       	mov    $0x1,%ecx
+    if(!havekids || curproc->killed){
+80107b1e:	85 c9                	test   %ecx,%ecx
+80107b20:	74 27                	je     80107b49 <wait+0x1b6>
+80107b22:	83 7b 2c 00          	cmpl   $0x0,0x2c(%ebx)
+80107b26:	75 21                	jne    80107b49 <wait+0x1b6>
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+80107b28:	83 ec 08             	sub    $0x8,%esp
+80107b2b:	68 00 ad 13 80       	push   $0x8013ad00
+80107b30:	53                   	push   %ebx
+80107b31:	e8 36 fd ff ff       	call   8010786c <sleep>
+    havekids = 0;
+80107b36:	83 c4 10             	add    $0x10,%esp
+    for(p = ptable.list[ZOMBIE].head; p != NULL; p = p->next){
+80107b39:	8b 35 60 f1 13 80    	mov    0x8013f160,%esi
+    havekids = 0;
+80107b3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for(p = ptable.list[ZOMBIE].head; p != NULL; p = p->next){
+80107b44:	e9 16 ff ff ff       	jmp    80107a5f <wait+0xcc>
+      release(&ptable.lock);
+80107b49:	83 ec 0c             	sub    $0xc,%esp
+80107b4c:	68 00 ad 13 80       	push   $0x8013ad00
+80107b51:	e8 f1 0a 00 00       	call   80108647 <release>
+      return -1;
+80107b56:	83 c4 10             	add    $0x10,%esp
+80107b59:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107b5e:	e9 e2 fe ff ff       	jmp    80107a45 <wait+0xb2>
+
+80107b63 <sleepticks>:
+{
+80107b63:	55                   	push   %ebp
+80107b64:	89 e5                	mov    %esp,%ebp
+80107b66:	56                   	push   %esi
+80107b67:	53                   	push   %ebx
+  struct proc *p = myproc();
+80107b68:	e8 df ed ff ff       	call   8010694c <myproc>
+80107b6d:	89 c3                	mov    %eax,%ebx
+  acquire(&ptable.lock);
+80107b6f:	83 ec 0c             	sub    $0xc,%esp
+80107b72:	68 00 ad 13 80       	push   $0x8013ad00
+80107b77:	e8 66 0a 00 00       	call   801085e2 <acquire>
+  p->wakeat = ticks + n;
+80107b7c:	8b 45 08             	mov    0x8(%ebp),%eax
+80107b7f:	03 05 60 f3 13 80    	add    0x8013f360,%eax
+80107b85:	89 83 c4 00 00 00    	mov    %eax,0xc4(%ebx)
+  while((int)(p->wakeat - ticks) > 0){
+80107b8b:	83 c4 10             	add    $0x10,%esp
+80107b8e:	eb 27                	jmp    80107bb7 <sleepticks+0x54>
+      release(&ptable.lock);
+80107b90:	83 ec 0c             	sub    $0xc,%esp
+80107b93:	68 00 ad 13 80       	push   $0x8013ad00
+80107b98:	e8 aa 0a 00 00       	call   80108647 <release>
+      return -1;
+80107b9d:	83 c4 10             	add    $0x10,%esp
+80107ba0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ba5:	e9 bc 00 00 00       	jmp    80107c66 <sleepticks+0x103>
+    if(p->tprev)
+80107baa:	83 bb cc 00 00 00 00 	cmpl   $0x0,0xcc(%ebx)
+80107bb1:	0f 85 8e 00 00 00    	jne    80107c45 <sleepticks+0xe2>
+  while((int)(p->wakeat - ticks) > 0){
+80107bb7:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+80107bbd:	89 c2                	mov    %eax,%edx
+80107bbf:	2b 15 60 f3 13 80    	sub    0x8013f360,%edx
+80107bc5:	85 d2                	test   %edx,%edx
+80107bc7:	0f 8e 84 00 00 00    	jle    80107c51 <sleepticks+0xee>
+    if(p->killed){
+80107bcd:	83 7b 2c 00          	cmpl   $0x0,0x2c(%ebx)
+80107bd1:	75 bd                	jne    80107b90 <sleepticks+0x2d>
+    slot = &ptable.timer[p->wakeat % NTIMERSLOT];
+80107bd3:	0f b6 c0             	movzbl %al,%eax
+80107bd6:	8d 90 cc 0f 00 00    	lea    0xfcc(%eax),%edx
+80107bdc:	8d 0c 85 38 ec 13 80 	lea    -0x7fec13c8(,%eax,4),%ecx
+    p->tnext = *slot;
+80107be3:	8b 34 95 08 ad 13 80 	mov    -0x7fec52f8(,%edx,4),%esi
+80107bea:	89 b3 c8 00 00 00    	mov    %esi,0xc8(%ebx)
+    p->tprev = slot;
+80107bf0:	89 8b cc 00 00 00    	mov    %ecx,0xcc(%ebx)
+    if(*slot)
+80107bf6:	8b 14 95 08 ad 13 80 	mov    -0x7fec52f8(,%edx,4),%edx
+80107bfd:	85 d2                	test   %edx,%edx
+80107bff:	74 0c                	je     80107c0d <sleepticks+0xaa>
+      (*slot)->tprev = &p->tnext;
+80107c01:	8d 8b c8 00 00 00    	lea    0xc8(%ebx),%ecx
+80107c07:	89 8a cc 00 00 00    	mov    %ecx,0xcc(%edx)
+    *slot = p;
+80107c0d:	89 1c 85 38 ec 13 80 	mov    %ebx,-0x7fec13c8(,%eax,4)
+    __sync_synchronize();
+80107c14:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    if((int)(p->wakeat - ticks) > 0)
+80107c19:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+80107c1f:	2b 05 60 f3 13 80    	sub    0x8013f360,%eax
+80107c25:	85 c0                	test   %eax,%eax
+80107c27:	7e 81                	jle    80107baa <sleepticks+0x47>
+      sleep(&p->wakeat, &ptable.lock);
+80107c29:	8d 83 c4 00 00 00    	lea    0xc4(%ebx),%eax
+80107c2f:	83 ec 08             	sub    $0x8,%esp
+80107c32:	68 00 ad 13 80       	push   $0x8013ad00
+80107c37:	50                   	push   %eax
+80107c38:	e8 2f fc ff ff       	call   8010786c <sleep>
+80107c3d:	83 c4 10             	add    $0x10,%esp
+80107c40:	e9 65 ff ff ff       	jmp    80107baa <sleepticks+0x47>
+      timerremove(p);
+80107c45:	89 d8                	mov    %ebx,%eax
+80107c47:	e8 d5 e6 ff ff       	call   80106321 <timerremove>
+80107c4c:	e9 66 ff ff ff       	jmp    80107bb7 <sleepticks+0x54>
+  release(&ptable.lock);
+80107c51:	83 ec 0c             	sub    $0xc,%esp
+80107c54:	68 00 ad 13 80       	push   $0x8013ad00
+80107c59:	e8 e9 09 00 00       	call   80108647 <release>
+  return 0;
+80107c5e:	83 c4 10             	add    $0x10,%esp
+80107c61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107c66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107c69:	5b                   	pop    %ebx
+80107c6a:	5e                   	pop    %esi
+80107c6b:	5d                   	pop    %ebp
+80107c6c:	c3                   	ret
+
+80107c6d <procdumpP1>:
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+#ifdef CS333_P1
+void
+procdumpP1(struct proc * p, char *state)
+{
+80107c6d:	55                   	push   %ebp
+80107c6e:	89 e5                	mov    %esp,%ebp
+80107c70:	57                   	push   %edi
+80107c71:	56                   	push   %esi
+80107c72:	53                   	push   %ebx
+80107c73:	83 ec 0c             	sub    $0xc,%esp
+80107c76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int elapsed = (ticks - p->start_ticks) / 1000;
+80107c79:	8b 0d 60 f3 13 80    	mov    0x8013f360,%ecx
+80107c7f:	2b 8b d0 00 00 00    	sub    0xd0(%ebx),%ecx
+80107c85:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+80107c8a:	89 c8                	mov    %ecx,%eax
+80107c8c:	f7 e2                	mul    %edx
+80107c8e:	c1 ea 06             	shr    $0x6,%edx
+  int elapsed_dec = (ticks - p->start_ticks) % 1000;
+80107c91:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+80107c97:	89 ce                	mov    %ecx,%esi
+80107c99:	29 c6                	sub    %eax,%esi
+80107c9b:	89 f7                	mov    %esi,%edi
+  //cprintf("%d\t%s\t\t%d.%d\t%s\t%d\t", p->pid, p->name, elapsed,elapsed_dec, state, p->sz);
+  cprintf("%d\t%s\t     %d.", p->pid, p->name, elapsed);
+80107c9d:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+80107ca3:	52                   	push   %edx
+80107ca4:	50                   	push   %eax
+80107ca5:	ff 73 10             	push   0x10(%ebx)
+80107ca8:	68 00 c7 10 80       	push   $0x8010c700
+80107cad:	e8 05 92 ff ff       	call   80100eb7 <cprintf>
+  if(elapsed_dec < 100 && elapsed_dec > 9)
+80107cb2:	8d 46 f6             	lea    -0xa(%esi),%eax
+80107cb5:	83 c4 10             	add    $0x10,%esp
+80107cb8:	83 f8 59             	cmp    $0x59,%eax
+80107cbb:	76 27                	jbe    80107ce4 <procdumpP1+0x77>
+    cprintf("0%d", elapsed_dec);
+  if(elapsed_dec < 10)
+80107cbd:	83 ff 09             	cmp    $0x9,%edi
+80107cc0:	7e 35                	jle    80107cf7 <procdumpP1+0x8a>
+    cprintf("00%d", elapsed_dec);
+  if(elapsed_dec >=100)
+80107cc2:	83 ff 63             	cmp    $0x63,%edi
+80107cc5:	7f 43                	jg     80107d0a <procdumpP1+0x9d>
+    cprintf("%d", elapsed_dec);
+  cprintf("\t%s\t%d\t", state, p->sz);	  
+80107cc7:	83 ec 04             	sub    $0x4,%esp
+80107cca:	ff 33                	push   (%ebx)
+80107ccc:	ff 75 0c             	push   0xc(%ebp)
+80107ccf:	68 14 c7 10 80       	push   $0x8010c714
+80107cd4:	e8 de 91 ff ff       	call   80100eb7 <cprintf>
+
+}
+80107cd9:	83 c4 10             	add    $0x10,%esp
+80107cdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107cdf:	5b                   	pop    %ebx
+80107ce0:	5e                   	pop    %esi
+80107ce1:	5f                   	pop    %edi
+80107ce2:	5d                   	pop    %ebp
+80107ce3:	c3                   	ret
+    cprintf("0%d", elapsed_dec);
+80107ce4:	83 ec 08             	sub    $0x8,%esp
+80107ce7:	56                   	push   %esi
+80107ce8:	68 10 c7 10 80       	push   $0x8010c710
+80107ced:	e8 c5 91 ff ff       	call   80100eb7 <cprintf>
+80107cf2:	83 c4 10             	add    $0x10,%esp
+80107cf5:	eb c6                	jmp    80107cbd <procdumpP1+0x50>
+    cprintf("00%d", elapsed_dec);
+80107cf7:	83 ec 08             	sub    $0x8,%esp
+80107cfa:	57                   	push   %edi
+80107cfb:	68 0f c7 10 80       	push   $0x8010c70f
+80107d00:	e8 b2 91 ff ff       	call   80100eb7 <cprintf>
+80107d05:	83 c4 10             	add    $0x10,%esp
+80107d08:	eb b8                	jmp    80107cc2 <procdumpP1+0x55>
+    cprintf("%d", elapsed_dec);
+80107d0a:	83 ec 08             	sub    $0x8,%esp
+80107d0d:	57                   	push   %edi
+80107d0e:	68 11 c7 10 80       	push   $0x8010c711
+80107d13:	e8 9f 91 ff ff       	call   80100eb7 <cprintf>
+80107d18:	83 c4 10             	add    $0x10,%esp
+80107d1b:	eb aa                	jmp    80107cc7 <procdumpP1+0x5a>
+
+80107d1d <procdumpP2>:
+#endif //CS333_P1
+#ifdef CS333_P2
+ 
+void
+procdumpP2(struct proc * p, char *state)
+{
+80107d1d:	55                   	push   %ebp
+80107d1e:	89 e5                	mov    %esp,%ebp
+80107d20:	57                   	push   %edi
+80107d21:	56                   	push   %esi
+80107d22:	53                   	push   %ebx
+80107d23:	83 ec 18             	sub    $0x18,%esp
+80107d26:	8b 5d 08             	mov    0x8(%ebp),%ebx
+   cprintf("%d\t%s\t     %d\t        %d\t", p->pid, p->name,p->uid, p->gid);
+80107d29:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+80107d2f:	ff b3 d8 00 00 00    	push   0xd8(%ebx)
+80107d35:	ff b3 d4 00 00 00    	push   0xd4(%ebx)
+80107d3b:	50                   	push   %eax
+80107d3c:	ff 73 10             	push   0x10(%ebx)
+80107d3f:	68 1c c7 10 80       	push   $0x8010c71c
+80107d44:	e8 6e 91 ff ff       	call   80100eb7 <cprintf>
+   if(p->parent != NULL)
+80107d49:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80107d4c:	83 c4 20             	add    $0x20,%esp
+80107d4f:	85 c0                	test   %eax,%eax
+80107d51:	0f 84 d0 00 00 00    	je     80107e27 <procdumpP2+0x10a>
+     cprintf("%d\t", p->parent->pid);
+80107d57:	83 ec 08             	sub    $0x8,%esp
+80107d5a:	ff 70 10             	push   0x10(%eax)
+80107d5d:	68 18 c7 10 80       	push   $0x8010c718
+80107d62:	e8 50 91 ff ff       	call   80100eb7 <cprintf>
+80107d67:	83 c4 10             	add    $0x10,%esp
+   else
+     cprintf("%d\t", p->pid);
+
+   int elapsed = (ticks - p->start_ticks) / 1000;
+80107d6a:	8b 0d 60 f3 13 80    	mov    0x8013f360,%ecx
+80107d70:	2b 8b d0 00 00 00    	sub    0xd0(%ebx),%ecx
+80107d76:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+80107d7b:	89 c8                	mov    %ecx,%eax
+80107d7d:	f7 e2                	mul    %edx
+80107d7f:	c1 ea 06             	shr    $0x6,%edx
+   int elapsed_dec = (ticks - p->start_ticks) % 1000;
+80107d82:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+80107d88:	29 c1                	sub    %eax,%ecx
+80107d8a:	89 ce                	mov    %ecx,%esi
+80107d8c:	89 cf                	mov    %ecx,%edi
+
+   cprintf("%d.", elapsed);
+80107d8e:	83 ec 08             	sub    $0x8,%esp
+80107d91:	52                   	push   %edx
+80107d92:	68 0b c7 10 80       	push   $0x8010c70b
+80107d97:	e8 1b 91 ff ff       	call   80100eb7 <cprintf>
+   if(elapsed_dec < 100 && elapsed_dec > 9)
+80107d9c:	8d 46 f6             	lea    -0xa(%esi),%eax
+80107d9f:	83 c4 10             	add    $0x10,%esp
+80107da2:	83 f8 59             	cmp    $0x59,%eax
+80107da5:	0f 86 94 00 00 00    	jbe    80107e3f <procdumpP2+0x122>
+      cprintf("0%d\t", elapsed_dec);
+   if(elapsed_dec < 10)
+80107dab:	83 ff 09             	cmp    $0x9,%edi
+80107dae:	0f 8e a1 00 00 00    	jle    80107e55 <procdumpP2+0x138>
+      cprintf("00%d\t", elapsed_dec);
+   if(elapsed_dec >=100)
+80107db4:	83 ff 63             	cmp    $0x63,%edi
+80107db7:	0f 8f ae 00 00 00    	jg     80107e6b <procdumpP2+0x14e>
+     cprintf("%d\t", elapsed_dec);
+   int cpuelapsed = p->cpu_ticks_total /1000;
+80107dbd:	8b 8b dc 00 00 00    	mov    0xdc(%ebx),%ecx
+80107dc3:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+80107dc8:	89 c8                	mov    %ecx,%eax
+80107dca:	f7 e2                	mul    %edx
+80107dcc:	c1 ea 06             	shr    $0x6,%edx
+   int cpuelapsed_dec = p->cpu_ticks_total %1000;  
+80107dcf:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+80107dd5:	89 ce                	mov    %ecx,%esi
+80107dd7:	29 c6                	sub    %eax,%esi
+80107dd9:	89 f7                	mov    %esi,%edi
+   cprintf("%d.", cpuelapsed);
+80107ddb:	83 ec 08             	sub    $0x8,%esp
+80107dde:	52                   	push   %edx
+80107ddf:	68 0b c7 10 80       	push   $0x8010c70b
+80107de4:	e8 ce 90 ff ff       	call   80100eb7 <cprintf>
+   if(cpuelapsed_dec < 100 && cpuelapsed_dec > 9)
+80107de9:	8d 46 f6             	lea    -0xa(%esi),%eax
+80107dec:	83 c4 10             	add    $0x10,%esp
+80107def:	83 f8 59             	cmp    $0x59,%eax
+80107df2:	0f 86 89 00 00 00    	jbe    80107e81 <procdumpP2+0x164>
+        cprintf("0%d", cpuelapsed_dec);
+   if(cpuelapsed_dec < 10)
+80107df8:	83 ff 09             	cmp    $0x9,%edi
+80107dfb:	0f 8e 96 00 00 00    	jle    80107e97 <procdumpP2+0x17a>
+      cprintf("00%d", cpuelapsed_dec);
+   if(cpuelapsed_dec >=100)
+80107e01:	83 ff 63             	cmp    $0x63,%edi
+80107e04:	0f 8f a3 00 00 00    	jg     80107ead <procdumpP2+0x190>
+     cprintf("%d", cpuelapsed_dec);
+   cprintf("   %s\t%d   ", state, p->sz);
+80107e0a:	83 ec 04             	sub    $0x4,%esp
+80107e0d:	ff 33                	push   (%ebx)
+80107e0f:	ff 75 0c             	push   0xc(%ebp)
+80107e12:	68 3c c7 10 80       	push   $0x8010c73c
+80107e17:	e8 9b 90 ff ff       	call   80100eb7 <cprintf>
+     
+
+
+
+
+}
+80107e1c:	83 c4 10             	add    $0x10,%esp
+80107e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107e22:	5b                   	pop    %ebx
+80107e23:	5e                   	pop    %esi
+80107e24:	5f                   	pop    %edi
+80107e25:	5d                   	pop    %ebp
+80107e26:	c3                   	ret
+     cprintf("%d\t", p->pid);
+80107e27:	83 ec 08             	sub    $0x8,%esp
+80107e2a:	ff 73 10             	push   0x10(%ebx)
+80107e2d:	68 18 c7 10 80       	push   $0x8010c718
+80107e32:	e8 80 90 ff ff       	call   80100eb7 <cprintf>
+80107e37:	83 c4 10             	add    $0x10,%esp
+80107e3a:	e9 2b ff ff ff       	jmp    80107d6a <procdumpP2+0x4d>
+      cprintf("0%d\t", elapsed_dec);
+80107e3f:	83 ec 08             	sub    $0x8,%esp
+80107e42:	56                   	push   %esi
+80107e43:	68 37 c7 10 80       	push   $0x8010c737
+80107e48:	e8 6a 90 ff ff       	call   80100eb7 <cprintf>
+80107e4d:	83 c4 10             	add    $0x10,%esp
+80107e50:	e9 56 ff ff ff       	jmp    80107dab <procdumpP2+0x8e>
+      cprintf("00%d\t", elapsed_dec);
+80107e55:	83 ec 08             	sub    $0x8,%esp
+80107e58:	57                   	push   %edi
+80107e59:	68 36 c7 10 80       	push   $0x8010c736
+80107e5e:	e8 54 90 ff ff       	call   80100eb7 <cprintf>
+80107e63:	83 c4 10             	add    $0x10,%esp
+80107e66:	e9 49 ff ff ff       	jmp    80107db4 <procdumpP2+0x97>
+     cprintf("%d\t", elapsed_dec);
+80107e6b:	83 ec 08             	sub    $0x8,%esp
+80107e6e:	57                   	push   %edi
+80107e6f:	68 18 c7 10 80       	push   $0x8010c718
+80107e74:	e8 3e 90 ff ff       	call   80100eb7 <cprintf>
+80107e79:	83 c4 10             	add    $0x10,%esp
+80107e7c:	e9 3c ff ff ff       	jmp    80107dbd <procdumpP2+0xa0>
+        cprintf("0%d", cpuelapsed_dec);
+80107e81:	83 ec 08             	sub    $0x8,%esp
+80107e84:	56                   	push   %esi
+80107e85:	68 10 c7 10 80       	push   $0x8010c710
+80107e8a:	e8 28 90 ff ff       	call   80100eb7 <cprintf>
+80107e8f:	83 c4 10             	add    $0x10,%esp
+80107e92:	e9 61 ff ff ff       	jmp    80107df8 <procdumpP2+0xdb>
+      cprintf("00%d", cpuelapsed_dec);
+80107e97:	83 ec 08             	sub    $0x8,%esp
+80107e9a:	57                   	push   %edi
+80107e9b:	68 0f c7 10 80       	push   $0x8010c70f
+80107ea0:	e8 12 90 ff ff       	call   80100eb7 <cprintf>
+80107ea5:	83 c4 10             	add    $0x10,%esp
+80107ea8:	e9 54 ff ff ff       	jmp    80107e01 <procdumpP2+0xe4>
+     cprintf("%d", cpuelapsed_dec);
+80107ead:	83 ec 08             	sub    $0x8,%esp
+80107eb0:	57                   	push   %edi
+80107eb1:	68 11 c7 10 80       	push   $0x8010c711
+80107eb6:	e8 fc 8f ff ff       	call   80100eb7 <cprintf>
+80107ebb:	83 c4 10             	add    $0x10,%esp
+80107ebe:	e9 47 ff ff ff       	jmp    80107e0a <procdumpP2+0xed>
+
+80107ec3 <procdumpP3>:
+#endif //CS333_P2
+#ifdef CS333_P3
+void
+procdumpP3(struct proc * p, char * state)
+{
+80107ec3:	55                   	push   %ebp
+80107ec4:	89 e5                	mov    %esp,%ebp
+80107ec6:	57                   	push   %edi
+80107ec7:	56                   	push   %esi
+80107ec8:	53                   	push   %ebx
+80107ec9:	83 ec 18             	sub    $0x18,%esp
+80107ecc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+   cprintf("%d\t%s\t     %d\t        %d\t", p->pid, p->name,p->uid, p->gid);
+80107ecf:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+80107ed5:	ff b3 d8 00 00 00    	push   0xd8(%ebx)
+80107edb:	ff b3 d4 00 00 00    	push   0xd4(%ebx)
+80107ee1:	50                   	push   %eax
+80107ee2:	ff 73 10             	push   0x10(%ebx)
+80107ee5:	68 1c c7 10 80       	push   $0x8010c71c
+80107eea:	e8 c8 8f ff ff       	call   80100eb7 <cprintf>
+   if(p->parent != NULL)
+80107eef:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80107ef2:	83 c4 20             	add    $0x20,%esp
+80107ef5:	85 c0                	test   %eax,%eax
+80107ef7:	0f 84 e3 00 00 00    	je     80107fe0 <procdumpP3+0x11d>
+     cprintf("%d\t", p->parent->pid);
+80107efd:	83 ec 08             	sub    $0x8,%esp
+80107f00:	ff 70 10             	push   0x10(%eax)
+80107f03:	68 18 c7 10 80       	push   $0x8010c718
+80107f08:	e8 aa 8f ff ff       	call   80100eb7 <cprintf>
+80107f0d:	83 c4 10             	add    $0x10,%esp
+   else
+     cprintf("%d\t", p->pid);
+#ifdef CS333_P4
+   cprintf("%d\t", p->priority);
+80107f10:	83 ec 08             	sub    $0x8,%esp
+80107f13:	ff b3 f0 00 00 00    	push   0xf0(%ebx)
+80107f19:	68 18 c7 10 80       	push   $0x8010c718
+80107f1e:	e8 94 8f ff ff       	call   80100eb7 <cprintf>
+#endif
+   int elapsed = (ticks - p->start_ticks) / 1000;
+80107f23:	8b 0d 60 f3 13 80    	mov    0x8013f360,%ecx
+80107f29:	2b 8b d0 00 00 00    	sub    0xd0(%ebx),%ecx
+80107f2f:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+80107f34:	89 c8                	mov    %ecx,%eax
+80107f36:	f7 e2                	mul    %edx
+80107f38:	c1 ea 06             	shr    $0x6,%edx
+   int elapsed_dec = (ticks - p->start_ticks) % 1000;
+80107f3b:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+80107f41:	29 c1                	sub    %eax,%ecx
+80107f43:	89 ce                	mov    %ecx,%esi
+80107f45:	89 cf                	mov    %ecx,%edi
+
+   cprintf("%d.", elapsed);
+80107f47:	83 c4 08             	add    $0x8,%esp
+80107f4a:	52                   	push   %edx
+80107f4b:	68 0b c7 10 80       	push   $0x8010c70b
+80107f50:	e8 62 8f ff ff       	call   80100eb7 <cprintf>
+   if(elapsed_dec < 100 && elapsed_dec > 9)
+80107f55:	8d 46 f6             	lea    -0xa(%esi),%eax
+80107f58:	83 c4 10             	add    $0x10,%esp
+80107f5b:	83 f8 59             	cmp    $0x59,%eax
+80107f5e:	0f 86 94 00 00 00    	jbe    80107ff8 <procdumpP3+0x135>
+      cprintf("0%d\t", elapsed_dec);
+   if(elapsed_dec < 10)
+80107f64:	83 ff 09             	cmp    $0x9,%edi
+80107f67:	0f 8e a1 00 00 00    	jle    8010800e <procdumpP3+0x14b>
+      cprintf("00%d\t", elapsed_dec);
+   if(elapsed_dec >=100)
+80107f6d:	83 ff 63             	cmp    $0x63,%edi
+80107f70:	0f 8f ae 00 00 00    	jg     80108024 <procdumpP3+0x161>
+     cprintf("%d\t", elapsed_dec);
+   int cpuelapsed = p->cpu_ticks_total /1000;
+80107f76:	8b 8b dc 00 00 00    	mov    0xdc(%ebx),%ecx
+80107f7c:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+80107f81:	89 c8                	mov    %ecx,%eax
+80107f83:	f7 e2                	mul    %edx
+80107f85:	c1 ea 06             	shr    $0x6,%edx
+   int cpuelapsed_dec = p->cpu_ticks_total %1000;  
+80107f88:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+80107f8e:	89 ce                	mov    %ecx,%esi
+80107f90:	29 c6                	sub    %eax,%esi
+80107f92:	89 f7                	mov    %esi,%edi
+   cprintf("%d.", cpuelapsed);
+80107f94:	83 ec 08             	sub    $0x8,%esp
+80107f97:	52                   	push   %edx
+80107f98:	68 0b c7 10 80       	push   $0x8010c70b
+80107f9d:	e8 15 8f ff ff       	call   80100eb7 <cprintf>
+   if(cpuelapsed_dec < 100 && cpuelapsed_dec > 9)
+80107fa2:	8d 46 f6             	lea    -0xa(%esi),%eax
+80107fa5:	83 c4 10             	add    $0x10,%esp
+80107fa8:	83 f8 59             	cmp    $0x59,%eax
+80107fab:	0f 86 89 00 00 00    	jbe    8010803a <procdumpP3+0x177>
+        cprintf("0%d", cpuelapsed_dec);
+   if(cpuelapsed_dec < 10)
+80107fb1:	83 ff 09             	cmp    $0x9,%edi
+80107fb4:	0f 8e 96 00 00 00    	jle    80108050 <procdumpP3+0x18d>
+      cprintf("00%d", cpuelapsed_dec);
+   if(cpuelapsed_dec >=100)
+80107fba:	83 ff 63             	cmp    $0x63,%edi
+80107fbd:	0f 8f a3 00 00 00    	jg     80108066 <procdumpP3+0x1a3>
+     cprintf("%d", cpuelapsed_dec);
+   cprintf("   %s\t%d   ", state, p->sz);
+80107fc3:	83 ec 04             	sub    $0x4,%esp
+80107fc6:	ff 33                	push   (%ebx)
+80107fc8:	ff 75 0c             	push   0xc(%ebp)
+80107fcb:	68 3c c7 10 80       	push   $0x8010c73c
+80107fd0:	e8 e2 8e ff ff       	call   80100eb7 <cprintf>
+}
+80107fd5:	83 c4 10             	add    $0x10,%esp
+80107fd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107fdb:	5b                   	pop    %ebx
+80107fdc:	5e                   	pop    %esi
+80107fdd:	5f                   	pop    %edi
+80107fde:	5d                   	pop    %ebp
+80107fdf:	c3                   	ret
+     cprintf("%d\t", p->pid);
+80107fe0:	83 ec 08             	sub    $0x8,%esp
+80107fe3:	ff 73 10             	push   0x10(%ebx)
+80107fe6:	68 18 c7 10 80       	push   $0x8010c718
+80107feb:	e8 c7 8e ff ff       	call   80100eb7 <cprintf>
+80107ff0:	83 c4 10             	add    $0x10,%esp
+80107ff3:	e9 18 ff ff ff       	jmp    80107f10 <procdumpP3+0x4d>
+      cprintf("0%d\t", elapsed_dec);
+80107ff8:	83 ec 08             	sub    $0x8,%esp
+80107ffb:	56                   	push   %esi
+80107ffc:	68 37 c7 10 80       	push   $0x8010c737
+80108001:	e8 b1 8e ff ff       	call   80100eb7 <cprintf>
+80108006:	83 c4 10             	add    $0x10,%esp
+80108009:	e9 56 ff ff ff       	jmp    80107f64 <procdumpP3+0xa1>
+      cprintf("00%d\t", elapsed_dec);
+8010800e:	83 ec 08             	sub    $0x8,%esp
+80108011:	57                   	push   %edi
+80108012:	68 36 c7 10 80       	push   $0x8010c736
+80108017:	e8 9b 8e ff ff       	call   80100eb7 <cprintf>
+8010801c:	83 c4 10             	add    $0x10,%esp
+8010801f:	e9 49 ff ff ff       	jmp    80107f6d <procdumpP3+0xaa>
+     cprintf("%d\t", elapsed_dec);
+80108024:	83 ec 08             	sub    $0x8,%esp
+80108027:	57                   	push   %edi
+80108028:	68 18 c7 10 80       	push   $0x8010c718
+8010802d:	e8 85 8e ff ff       	call   80100eb7 <cprintf>
+80108032:	83 c4 10             	add    $0x10,%esp
+80108035:	e9 3c ff ff ff       	jmp    80107f76 <procdumpP3+0xb3>
+        cprintf("0%d", cpuelapsed_dec);
+8010803a:	83 ec 08             	sub    $0x8,%esp
+8010803d:	56                   	push   %esi
+8010803e:	68 10 c7 10 80       	push   $0x8010c710
+80108043:	e8 6f 8e ff ff       	call   80100eb7 <cprintf>
+80108048:	83 c4 10             	add    $0x10,%esp
+8010804b:	e9 61 ff ff ff       	jmp    80107fb1 <procdumpP3+0xee>
+      cprintf("00%d", cpuelapsed_dec);
+80108050:	83 ec 08             	sub    $0x8,%esp
+80108053:	57                   	push   %edi
+80108054:	68 0f c7 10 80       	push   $0x8010c70f
+80108059:	e8 59 8e ff ff       	call   80100eb7 <cprintf>
+8010805e:	83 c4 10             	add    $0x10,%esp
+80108061:	e9 54 ff ff ff       	jmp    80107fba <procdumpP3+0xf7>
+     cprintf("%d", cpuelapsed_dec);
+80108066:	83 ec 08             	sub    $0x8,%esp
+80108069:	57                   	push   %edi
+8010806a:	68 11 c7 10 80       	push   $0x8010c711
+8010806f:	e8 43 8e ff ff       	call   80100eb7 <cprintf>
+80108074:	83 c4 10             	add    $0x10,%esp
+80108077:	e9 47 ff ff ff       	jmp    80107fc3 <procdumpP3+0x100>
+
+8010807c <ctrlr>:
+
+#ifdef CS333_P4
+void
+ctrlr(void)
+{
+8010807c:	55                   	push   %ebp
+8010807d:	89 e5                	mov    %esp,%ebp
+8010807f:	57                   	push   %edi
+80108080:	56                   	push   %esi
+80108081:	53                   	push   %ebx
+80108082:	83 ec 18             	sub    $0x18,%esp
+  acquire(&ptable.lock);
+80108085:	68 00 ad 13 80       	push   $0x8013ad00
+8010808a:	e8 53 05 00 00       	call   801085e2 <acquire>
+  struct proc * current;
+  cprintf("Ready List Processes:\n");
+8010808f:	c7 04 24 48 c7 10 80 	movl   $0x8010c748,(%esp)
+80108096:	e8 1c 8e ff ff       	call   80100eb7 <cprintf>
+  for(int c = 0; c < ncpu; c++){
+8010809b:	83 c4 10             	add    $0x10,%esp
+8010809e:	bf 00 00 00 00       	mov    $0x0,%edi
+801080a3:	e9 82 00 00 00       	jmp    8010812a <ctrlr+0xae>
+    for(int i = MAXPRIO; i >= 0; --i){
+      current = runq[c].ready[i].head;
+      cprintf("%d: ", i);
+      while(current != NULL){
+        if(current->next == NULL)
+          cprintf("(%d,%d)\n", current->pid, current->budget);
+801080a8:	83 ec 04             	sub    $0x4,%esp
+801080ab:	ff b3 f4 00 00 00    	push   0xf4(%ebx)
+801080b1:	ff 73 10             	push   0x10(%ebx)
+801080b4:	68 6c c7 10 80       	push   $0x8010c76c
+801080b9:	e8 f9 8d ff ff       	call   80100eb7 <cprintf>
+801080be:	83 c4 10             	add    $0x10,%esp
+        else
+          cprintf("(%d,%d)->", current->pid, current->budget);
+
+        current = current->next;
+801080c1:	8b 9b e4 00 00 00    	mov    0xe4(%ebx),%ebx
+      while(current != NULL){
+801080c7:	85 db                	test   %ebx,%ebx
+801080c9:	74 24                	je     801080ef <ctrlr+0x73>
+        if(current->next == NULL)
+801080cb:	83 bb e4 00 00 00 00 	cmpl   $0x0,0xe4(%ebx)
+801080d2:	74 d4                	je     801080a8 <ctrlr+0x2c>
+          cprintf("(%d,%d)->", current->pid, current->budget);
+801080d4:	83 ec 04             	sub    $0x4,%esp
+801080d7:	ff b3 f4 00 00 00    	push   0xf4(%ebx)
+801080dd:	ff 73 10             	push   0x10(%ebx)
+801080e0:	68 75 c7 10 80       	push   $0x8010c775
+801080e5:	e8 cd 8d ff ff       	call   80100eb7 <cprintf>
+801080ea:	83 c4 10             	add    $0x10,%esp
+801080ed:	eb d2                	jmp    801080c1 <ctrlr+0x45>
+
+     }
+     cprintf("\n");
+801080ef:	83 ec 0c             	sub    $0xc,%esp
+801080f2:	68 9b cc 10 80       	push   $0x8010cc9b
+801080f7:	e8 bb 8d ff ff       	call   80100eb7 <cprintf>
+    for(int i = MAXPRIO; i >= 0; --i){
+801080fc:	83 ee 01             	sub    $0x1,%esi
+801080ff:	83 c4 10             	add    $0x10,%esp
+80108102:	85 f6                	test   %esi,%esi
+80108104:	78 21                	js     80108127 <ctrlr+0xab>
+      current = runq[c].ready[i].head;
+80108106:	89 f8                	mov    %edi,%eax
+80108108:	c1 e0 04             	shl    $0x4,%eax
+8010810b:	01 f0                	add    %esi,%eax
+8010810d:	8b 1c c5 34 a9 13 80 	mov    -0x7fec56cc(,%eax,8),%ebx
+      cprintf("%d: ", i);
+80108114:	83 ec 08             	sub    $0x8,%esp
+80108117:	56                   	push   %esi
+80108118:	68 67 c7 10 80       	push   $0x8010c767
+8010811d:	e8 95 8d ff ff       	call   80100eb7 <cprintf>
+      while(current != NULL){
+80108122:	83 c4 10             	add    $0x10,%esp
+80108125:	eb a0                	jmp    801080c7 <ctrlr+0x4b>
+  for(int c = 0; c < ncpu; c++){
+80108127:	83 c7 01             	add    $0x1,%edi
+8010812a:	39 3d 04 a3 13 80    	cmp    %edi,0x8013a304
+80108130:	7e 18                	jle    8010814a <ctrlr+0xce>
+    cprintf("cpu%d:\n", c);
+80108132:	83 ec 08             	sub    $0x8,%esp
+80108135:	57                   	push   %edi
+80108136:	68 5f c7 10 80       	push   $0x8010c75f
+8010813b:	e8 77 8d ff ff       	call   80100eb7 <cprintf>
+    for(int i = MAXPRIO; i >= 0; --i){
+80108140:	83 c4 10             	add    $0x10,%esp
+80108143:	be 06 00 00 00       	mov    $0x6,%esi
+80108148:	eb b8                	jmp    80108102 <ctrlr+0x86>
+
+    }
+  }
+  release(&ptable.lock);
+8010814a:	83 ec 0c             	sub    $0xc,%esp
+8010814d:	68 00 ad 13 80       	push   $0x8013ad00
+80108152:	e8 f0 04 00 00       	call   80108647 <release>
+  cprintf("\n$ ");
+80108157:	c7 04 24 7f c7 10 80 	movl   $0x8010c77f,(%esp)
+8010815e:	e8 54 8d ff ff       	call   80100eb7 <cprintf>
+}
+80108163:	83 c4 10             	add    $0x10,%esp
+80108166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108169:	5b                   	pop    %ebx
+8010816a:	5e                   	pop    %esi
+8010816b:	5f                   	pop    %edi
+8010816c:	5d                   	pop    %ebp
+8010816d:	c3                   	ret
+
+8010816e <ctrlf>:
+  cprintf("\n$ ");
+}
+#endif
+void
+ctrlf(void)
+{
+8010816e:	55                   	push   %ebp
+8010816f:	89 e5                	mov    %esp,%ebp
+80108171:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);
+80108174:	68 00 ad 13 80       	push   $0x8013ad00
+80108179:	e8 64 04 00 00       	call   801085e2 <acquire>
+  struct proc * current = ptable.list[UNUSED].head;
+8010817e:	a1 38 f1 13 80       	mov    0x8013f138,%eax
+  int counted = 0;
+  while(current != NULL){
+80108183:	83 c4 10             	add    $0x10,%esp
+  int counted = 0;
+80108186:	ba 00 00 00 00       	mov    $0x0,%edx
+  while(current != NULL){
+8010818b:	eb 09                	jmp    80108196 <ctrlf+0x28>
+    ++counted;  
+8010818d:	83 c2 01             	add    $0x1,%edx
+    
+    current = current->next;
+80108190:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+  while(current != NULL){
+80108196:	85 c0                	test   %eax,%eax
+80108198:	75 f3                	jne    8010818d <ctrlf+0x1f>
+
+  }
+  cprintf("Free List Size: %d processes", counted);
+8010819a:	83 ec 08             	sub    $0x8,%esp
+8010819d:	52                   	push   %edx
+8010819e:	68 83 c7 10 80       	push   $0x8010c783
+801081a3:	e8 0f 8d ff ff       	call   80100eb7 <cprintf>
+  release(&ptable.lock);
+801081a8:	c7 04 24 00 ad 13 80 	movl   $0x8013ad00,(%esp)
+801081af:	e8 93 04 00 00       	call   80108647 <release>
+  cprintf("\n$ ");
+801081b4:	c7 04 24 7f c7 10 80 	movl   $0x8010c77f,(%esp)
+801081bb:	e8 f7 8c ff ff       	call   80100eb7 <cprintf>
+}
+801081c0:	83 c4 10             	add    $0x10,%esp
+801081c3:	c9                   	leave
+801081c4:	c3                   	ret
+
+801081c5 <ctrls>:
+void
+ctrls(void)
+{
+801081c5:	55                   	push   %ebp
+801081c6:	89 e5                	mov    %esp,%ebp
+801081c8:	56                   	push   %esi
+801081c9:	53                   	push   %ebx
+  acquire(&ptable.lock);
+801081ca:	83 ec 0c             	sub    $0xc,%esp
+801081cd:	68 00 ad 13 80       	push   $0x8013ad00
+801081d2:	e8 0b 04 00 00       	call   801085e2 <acquire>
+  struct proc * current;
+  int first = 1;
+  cprintf("Sleeping List Processes:\n");
+801081d7:	c7 04 24 a0 c7 10 80 	movl   $0x8010c7a0,(%esp)
+801081de:	e8 d4 8c ff ff       	call   80100eb7 <cprintf>
+  for(int i = 0; i < NSLEEPQ; i++){
+801081e3:	83 c4 10             	add    $0x10,%esp
+801081e6:	be 00 00 00 00       	mov    $0x0,%esi
+  int first = 1;
+801081eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  for(int i = 0; i < NSLEEPQ; i++){
+801081f0:	eb 3e                	jmp    80108230 <ctrls+0x6b>
+    for(current = ptable.sleepq[i].head; current != NULL; current = current->next){
+      if(first)
+        cprintf("%d", current->pid);
+      else
+        cprintf("->%d", current->pid);
+801081f2:	83 ec 08             	sub    $0x8,%esp
+801081f5:	ff 73 10             	push   0x10(%ebx)
+801081f8:	68 ba c7 10 80       	push   $0x8010c7ba
+801081fd:	e8 b5 8c ff ff       	call   80100eb7 <cprintf>
+80108202:	83 c4 10             	add    $0x10,%esp
+    for(current = ptable.sleepq[i].head; current != NULL; current = current->next){
+80108205:	8b 9b e4 00 00 00    	mov    0xe4(%ebx),%ebx
+      first = 0;
+8010820b:	b8 00 00 00 00       	mov    $0x0,%eax
+    for(current = ptable.sleepq[i].head; current != NULL; current = current->next){
+80108210:	85 db                	test   %ebx,%ebx
+80108212:	74 19                	je     8010822d <ctrls+0x68>
+      if(first)
+80108214:	85 c0                	test   %eax,%eax
+80108216:	74 da                	je     801081f2 <ctrls+0x2d>
+        cprintf("%d", current->pid);
+80108218:	83 ec 08             	sub    $0x8,%esp
+8010821b:	ff 73 10             	push   0x10(%ebx)
+8010821e:	68 11 c7 10 80       	push   $0x8010c711
+80108223:	e8 8f 8c ff ff       	call   80100eb7 <cprintf>
+80108228:	83 c4 10             	add    $0x10,%esp
+8010822b:	eb d8                	jmp    80108205 <ctrls+0x40>
+  for(int i = 0; i < NSLEEPQ; i++){
+8010822d:	83 c6 01             	add    $0x1,%esi
+80108230:	83 fe 3c             	cmp    $0x3c,%esi
+80108233:	7f 09                	jg     8010823e <ctrls+0x79>
+    for(current = ptable.sleepq[i].head; current != NULL; current = current->next){
+80108235:	8b 1c f5 68 f1 13 80 	mov    -0x7fec0e98(,%esi,8),%ebx
+8010823c:	eb d2                	jmp    80108210 <ctrls+0x4b>
+    }
+  }
+  release(&ptable.lock);
+8010823e:	83 ec 0c             	sub    $0xc,%esp
+80108241:	68 00 ad 13 80       	push   $0x8013ad00
+80108246:	e8 fc 03 00 00       	call   80108647 <release>
+  cprintf("\n$ ");
+8010824b:	c7 04 24 7f c7 10 80 	movl   $0x8010c77f,(%esp)
+80108252:	e8 60 8c ff ff       	call   80100eb7 <cprintf>
+}
+80108257:	83 c4 10             	add    $0x10,%esp
+8010825a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010825d:	5b                   	pop    %ebx
+8010825e:	5e                   	pop    %esi
+8010825f:	5d                   	pop    %ebp
+80108260:	c3                   	ret
+
+80108261 <ctrlz>:
+void
+ctrlz(void)
+{
+80108261:	55                   	push   %ebp
+80108262:	89 e5                	mov    %esp,%ebp
+80108264:	53                   	push   %ebx
+80108265:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+80108268:	68 00 ad 13 80       	push   $0x8013ad00
+8010826d:	e8 70 03 00 00       	call   801085e2 <acquire>
+  struct proc * current = ptable.list[ZOMBIE].head;
+80108272:	8b 1d 60 f1 13 80    	mov    0x8013f160,%ebx
+  int ppid = 0;
+  cprintf("Zombie List Processes:\n");
+80108278:	c7 04 24 bf c7 10 80 	movl   $0x8010c7bf,(%esp)
+8010827f:	e8 33 8c ff ff       	call   80100eb7 <cprintf>
+  while(current != NULL){
+80108284:	83 c4 10             	add    $0x10,%esp
+80108287:	eb 1f                	jmp    801082a8 <ctrlz+0x47>
+   if(current->parent != NULL)
+     ppid = current->parent->pid;
+   else
+     ppid = current->pid;
+80108289:	8b 43 10             	mov    0x10(%ebx),%eax
+8010828c:	eb 28                	jmp    801082b6 <ctrlz+0x55>
+
+   if(current->next == NULL)
+     cprintf("(%d,%d)", current->pid, ppid);  
+   else
+     cprintf("(%d,%d)->", current->pid, ppid);  
+8010828e:	83 ec 04             	sub    $0x4,%esp
+80108291:	50                   	push   %eax
+80108292:	ff 73 10             	push   0x10(%ebx)
+80108295:	68 75 c7 10 80       	push   $0x8010c775
+8010829a:	e8 18 8c ff ff       	call   80100eb7 <cprintf>
+8010829f:	83 c4 10             	add    $0x10,%esp
+    
+    current = current->next;
+801082a2:	8b 9b e4 00 00 00    	mov    0xe4(%ebx),%ebx
+  while(current != NULL){
+801082a8:	85 db                	test   %ebx,%ebx
+801082aa:	74 29                	je     801082d5 <ctrlz+0x74>
+   if(current->parent != NULL)
+801082ac:	8b 43 1c             	mov    0x1c(%ebx),%eax
+801082af:	85 c0                	test   %eax,%eax
+801082b1:	74 d6                	je     80108289 <ctrlz+0x28>
+     ppid = current->parent->pid;
+801082b3:	8b 40 10             	mov    0x10(%eax),%eax
+   if(current->next == NULL)
+801082b6:	83 bb e4 00 00 00 00 	cmpl   $0x0,0xe4(%ebx)
+801082bd:	75 cf                	jne    8010828e <ctrlz+0x2d>
+     cprintf("(%d,%d)", current->pid, ppid);  
+801082bf:	83 ec 04             	sub    $0x4,%esp
+801082c2:	50                   	push   %eax
+801082c3:	ff 73 10             	push   0x10(%ebx)
+801082c6:	68 d7 c7 10 80       	push   $0x8010c7d7
+801082cb:	e8 e7 8b ff ff       	call   80100eb7 <cprintf>
+801082d0:	83 c4 10             	add    $0x10,%esp
+801082d3:	eb cd                	jmp    801082a2 <ctrlz+0x41>
+
+  }
+  release(&ptable.lock);
+801082d5:	83 ec 0c             	sub    $0xc,%esp
+801082d8:	68 00 ad 13 80       	push   $0x8013ad00
+801082dd:	e8 65 03 00 00       	call   80108647 <release>
+  cprintf("\n$ ");
+801082e2:	c7 04 24 7f c7 10 80 	movl   $0x8010c77f,(%esp)
+801082e9:	e8 c9 8b ff ff       	call   80100eb7 <cprintf>
+}
+801082ee:	83 c4 10             	add    $0x10,%esp
+801082f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801082f4:	c9                   	leave
+801082f5:	c3                   	ret
+
+801082f6 <procdump>:
+
+#endif //CS333_P3
+void
+procdump(void)
+{
+801082f6:	55                   	push   %ebp
+801082f7:	89 e5                	mov    %esp,%ebp
+801082f9:	56                   	push   %esi
+801082fa:	53                   	push   %ebx
+801082fb:	83 ec 3c             	sub    $0x3c,%esp
+#define HEADER "\nPID\tName         Elapsed\tState\tSize\t PCs\n"
+#else
+#define HEADER "\n"
+#endif
+
+  cprintf(HEADER);  // not conditionally compiled as must work in all project states
+801082fe:	68 20 c6 10 80       	push   $0x8010c620
+80108303:	e8 af 8b ff ff       	call   80100eb7 <cprintf>
+
+  for(p = ptable.all; p; p = p->allnext){
+80108308:	8b 1d 34 ec 13 80    	mov    0x8013ec34,%ebx
+8010830e:	83 c4 10             	add    $0x10,%esp
+80108311:	eb 2b                	jmp    8010833e <procdump+0x48>
+    if(p->state == UNUSED)
+      continue;
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+      state = states[p->state];
+    else
+      state = "???";
+80108313:	b8 df c7 10 80       	mov    $0x8010c7df,%eax
+ 
+#if defined(CS333_P3)
+    procdumpP3(p, state);
+80108318:	83 ec 08             	sub    $0x8,%esp
+8010831b:	50                   	push   %eax
+8010831c:	53                   	push   %ebx
+8010831d:	e8 a1 fb ff ff       	call   80107ec3 <procdumpP3>
+    procdumpP1(p, state);
+#else
+    cprintf("%d\t%s\t%s\t", p->pid, p->name, state);
+#endif
+
+    if(p->state == SLEEPING){
+80108322:	83 c4 10             	add    $0x10,%esp
+80108325:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80108329:	74 35                	je     80108360 <procdump+0x6a>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+8010832b:	83 ec 0c             	sub    $0xc,%esp
+8010832e:	68 9b cc 10 80       	push   $0x8010cc9b
+80108333:	e8 7f 8b ff ff       	call   80100eb7 <cprintf>
+80108338:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.all; p; p = p->allnext){
+8010833b:	8b 5b 18             	mov    0x18(%ebx),%ebx
+8010833e:	85 db                	test   %ebx,%ebx
+80108340:	74 61                	je     801083a3 <procdump+0xad>
+    if(p->state == UNUSED)
+80108342:	8b 43 0c             	mov    0xc(%ebx),%eax
+80108345:	85 c0                	test   %eax,%eax
+80108347:	74 f2                	je     8010833b <procdump+0x45>
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80108349:	83 f8 05             	cmp    $0x5,%eax
+8010834c:	77 c5                	ja     80108313 <procdump+0x1d>
+8010834e:	8b 04 85 8c c8 10 80 	mov    -0x7fef3774(,%eax,4),%eax
+80108355:	85 c0                	test   %eax,%eax
+80108357:	75 bf                	jne    80108318 <procdump+0x22>
+      state = "???";
+80108359:	b8 df c7 10 80       	mov    $0x8010c7df,%eax
+8010835e:	eb b8                	jmp    80108318 <procdump+0x22>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80108360:	8b 43 24             	mov    0x24(%ebx),%eax
+80108363:	8b 40 0c             	mov    0xc(%eax),%eax
+80108366:	83 c0 08             	add    $0x8,%eax
+80108369:	83 ec 08             	sub    $0x8,%esp
+8010836c:	8d 55 d0             	lea    -0x30(%ebp),%edx
+8010836f:	52                   	push   %edx
+80108370:	50                   	push   %eax
+80108371:	e8 43 01 00 00       	call   801084b9 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80108376:	83 c4 10             	add    $0x10,%esp
+80108379:	be 00 00 00 00       	mov    $0x0,%esi
+8010837e:	eb 14                	jmp    80108394 <procdump+0x9e>
+        cprintf(" %p", pc[i]);
+80108380:	83 ec 08             	sub    $0x8,%esp
+80108383:	50                   	push   %eax
+80108384:	68 2e bd 10 80       	push   $0x8010bd2e
+80108389:	e8 29 8b ff ff       	call   80100eb7 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+8010838e:	83 c6 01             	add    $0x1,%esi
+80108391:	83 c4 10             	add    $0x10,%esp
+80108394:	83 fe 09             	cmp    $0x9,%esi
+80108397:	7f 92                	jg     8010832b <procdump+0x35>
+80108399:	8b 44 b5 d0          	mov    -0x30(%ebp,%esi,4),%eax
+8010839d:	85 c0                	test   %eax,%eax
+8010839f:	75 df                	jne    80108380 <procdump+0x8a>
+801083a1:	eb 88                	jmp    8010832b <procdump+0x35>
+   }
+ 
+#ifdef CS333_P1
+  cprintf("$ ");  // simulate shell prompt
+801083a3:	83 ec 0c             	sub    $0xc,%esp
+801083a6:	68 80 c7 10 80       	push   $0x8010c780
+801083ab:	e8 07 8b ff ff       	call   80100eb7 <cprintf>
+#endif // CS333_P1
+}
+801083b0:	83 c4 10             	add    $0x10,%esp
+801083b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801083b6:	5b                   	pop    %ebx
+801083b7:	5e                   	pop    %esi
+801083b8:	5d                   	pop    %ebp
+801083b9:	c3                   	ret
+
+801083ba <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+801083ba:	55                   	push   %ebp
+801083bb:	89 e5                	mov    %esp,%ebp
+801083bd:	53                   	push   %ebx
+801083be:	83 ec 0c             	sub    $0xc,%esp
+801083c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+801083c4:	68 a4 c8 10 80       	push   $0x8010c8a4
+801083c9:	8d 43 04             	lea    0x4(%ebx),%eax
+801083cc:	50                   	push   %eax
+801083cd:	e8 cc 00 00 00       	call   8010849e <initlock>
+  lk->name = name;
+801083d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+801083d5:	89 43 38             	mov    %eax,0x38(%ebx)
+  lk->locked = 0;
+801083d8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+801083de:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+}
+801083e5:	83 c4 10             	add    $0x10,%esp
+801083e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801083eb:	c9                   	leave
+801083ec:	c3                   	ret
+
+801083ed <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+801083ed:	55                   	push   %ebp
+801083ee:	89 e5                	mov    %esp,%ebp
+801083f0:	56                   	push   %esi
+801083f1:	53                   	push   %ebx
+801083f2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+801083f5:	8d 73 04             	lea    0x4(%ebx),%esi
+801083f8:	83 ec 0c             	sub    $0xc,%esp
+801083fb:	56                   	push   %esi
+801083fc:	e8 e1 01 00 00       	call   801085e2 <acquire>
+  while (lk->locked) {
+80108401:	83 c4 10             	add    $0x10,%esp
+80108404:	eb 0d                	jmp    80108413 <acquiresleep+0x26>
+    sleep(lk, &lk->lk);
+80108406:	83 ec 08             	sub    $0x8,%esp
+80108409:	56                   	push   %esi
+8010840a:	53                   	push   %ebx
+8010840b:	e8 5c f4 ff ff       	call   8010786c <sleep>
+80108410:	83 c4 10             	add    $0x10,%esp
+  while (lk->locked) {
+80108413:	83 3b 00             	cmpl   $0x0,(%ebx)
+80108416:	75 ee                	jne    80108406 <acquiresleep+0x19>
+  }
+  lk->locked = 1;
+80108418:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+8010841e:	e8 29 e5 ff ff       	call   8010694c <myproc>
+80108423:	8b 40 10             	mov    0x10(%eax),%eax
+80108426:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+80108429:	83 ec 0c             	sub    $0xc,%esp
+8010842c:	56                   	push   %esi
+8010842d:	e8 15 02 00 00       	call   80108647 <release>
+}
+80108432:	83 c4 10             	add    $0x10,%esp
+80108435:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108438:	5b                   	pop    %ebx
+80108439:	5e                   	pop    %esi
+8010843a:	5d                   	pop    %ebp
+8010843b:	c3                   	ret
+
+8010843c <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+8010843c:	55                   	push   %ebp
+8010843d:	89 e5                	mov    %esp,%ebp
+8010843f:	56                   	push   %esi
+80108440:	53                   	push   %ebx
+80108441:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80108444:	8d 73 04             	lea    0x4(%ebx),%esi
+80108447:	83 ec 0c             	sub    $0xc,%esp
+8010844a:	56                   	push   %esi
+8010844b:	e8 92 01 00 00       	call   801085e2 <acquire>
+  lk->locked = 0;
+80108450:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+80108456:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeup(lk);
+8010845d:	89 1c 24             	mov    %ebx,(%esp)
+80108460:	e8 e4 e9 ff ff       	call   80106e49 <wakeup>
+  release(&lk->lk);
+80108465:	89 34 24             	mov    %esi,(%esp)
+80108468:	e8 da 01 00 00       	call   80108647 <release>
+}
+8010846d:	83 c4 10             	add    $0x10,%esp
+80108470:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108473:	5b                   	pop    %ebx
+80108474:	5e                   	pop    %esi
+80108475:	5d                   	pop    %ebp
+80108476:	c3                   	ret
+
+80108477 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80108477:	55                   	push   %ebp
+80108478:	89 e5                	mov    %esp,%ebp
+8010847a:	56                   	push   %esi
+8010847b:	53                   	push   %ebx
+8010847c:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  
+  acquire(&lk->lk);
+8010847f:	8d 5e 04             	lea    0x4(%esi),%ebx
+80108482:	83 ec 0c             	sub    $0xc,%esp
+80108485:	53                   	push   %ebx
+80108486:	e8 57 01 00 00       	call   801085e2 <acquire>
+  r = lk->locked;
+8010848b:	8b 36                	mov    (%esi),%esi
+  release(&lk->lk);
+8010848d:	89 1c 24             	mov    %ebx,(%esp)
+80108490:	e8 b2 01 00 00       	call   80108647 <release>
+  return r;
+}
+80108495:	89 f0                	mov    %esi,%eax
+80108497:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010849a:	5b                   	pop    %ebx
+8010849b:	5e                   	pop    %esi
+8010849c:	5d                   	pop    %ebp
+8010849d:	c3                   	ret
+
+8010849e <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+8010849e:	55                   	push   %ebp
+8010849f:	89 e5                	mov    %esp,%ebp
+801084a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+801084a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+801084a7:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->locked = 0;
+801084aa:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->cpu = 0;
+801084b0:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+801084b7:	5d                   	pop    %ebp
+801084b8:	c3                   	ret
+
+801084b9 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+801084b9:	55                   	push   %ebp
+801084ba:	89 e5                	mov    %esp,%ebp
+801084bc:	53                   	push   %ebx
+801084bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+801084c0:	8b 45 08             	mov    0x8(%ebp),%eax
+801084c3:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+801084c6:	b8 00 00 00 00       	mov    $0x0,%eax
+801084cb:	83 f8 09             	cmp    $0x9,%eax
+801084ce:	7f 25                	jg     801084f5 <getcallerpcs+0x3c>
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801084d0:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+801084d6:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+801084dc:	77 17                	ja     801084f5 <getcallerpcs+0x3c>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+801084de:	8b 5a 04             	mov    0x4(%edx),%ebx
+801084e1:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+    ebp = (uint*)ebp[0]; // saved %ebp
+801084e4:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+801084e6:	83 c0 01             	add    $0x1,%eax
+801084e9:	eb e0                	jmp    801084cb <getcallerpcs+0x12>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+801084eb:	c7 04 81 00 00 00 00 	movl   $0x0,(%ecx,%eax,4)
+  for(; i < 10; i++)
+801084f2:	83 c0 01             	add    $0x1,%eax
+801084f5:	83 f8 09             	cmp    $0x9,%eax
+801084f8:	7e f1                	jle    801084eb <getcallerpcs+0x32>
+}
+801084fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801084fd:	c9                   	leave
+801084fe:	c3                   	ret
+
+801084ff <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+801084ff:	55                   	push   %ebp
+80108500:	89 e5                	mov    %esp,%ebp
+80108502:	53                   	push   %ebx
+80108503:	83 ec 04             	sub    $0x4,%esp
+80108506:	9c                   	pushf
+80108507:	5b                   	pop    %ebx
+  asm volatile("cli");
+80108508:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+80108509:	e8 c7 e3 ff ff       	call   801068d5 <mycpu>
+8010850e:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+80108515:	74 19                	je     80108530 <pushcli+0x31>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80108517:	e8 b9 e3 ff ff       	call   801068d5 <mycpu>
+8010851c:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+80108522:	8d 51 01             	lea    0x1(%ecx),%edx
+80108525:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+}
+8010852b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010852e:	c9                   	leave
+8010852f:	c3                   	ret
+    mycpu()->intena = eflags & FL_IF;
+80108530:	e8 a0 e3 ff ff       	call   801068d5 <mycpu>
+80108535:	81 e3 00 02 00 00    	and    $0x200,%ebx
+8010853b:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80108541:	eb d4                	jmp    80108517 <pushcli+0x18>
+
+80108543 <popcli>:
+
+void
+popcli(void)
+{
+80108543:	55                   	push   %ebp
+80108544:	89 e5                	mov    %esp,%ebp
+80108546:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80108549:	9c                   	pushf
+8010854a:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+8010854b:	f6 c4 02             	test   $0x2,%ah
+8010854e:	75 28                	jne    80108578 <popcli+0x35>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80108550:	e8 80 e3 ff ff       	call   801068d5 <mycpu>
+80108555:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+8010855b:	8d 51 ff             	lea    -0x1(%ecx),%edx
+8010855e:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+80108564:	85 d2                	test   %edx,%edx
+80108566:	78 1d                	js     80108585 <popcli+0x42>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80108568:	e8 68 e3 ff ff       	call   801068d5 <mycpu>
+8010856d:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+80108574:	74 1c                	je     80108592 <popcli+0x4f>
+    sti();
+}
+80108576:	c9                   	leave
+80108577:	c3                   	ret
+    panic("popcli - interruptible");
+80108578:	83 ec 0c             	sub    $0xc,%esp
+8010857b:	68 af c8 10 80       	push   $0x8010c8af
+80108580:	e8 71 86 ff ff       	call   80100bf6 <panic>
+    panic("popcli");
+80108585:	83 ec 0c             	sub    $0xc,%esp
+80108588:	68 c6 c8 10 80       	push   $0x8010c8c6
+8010858d:	e8 64 86 ff ff       	call   80100bf6 <panic>
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80108592:	e8 3e e3 ff ff       	call   801068d5 <mycpu>
+80108597:	83 b8 a8 00 00 00 00 	cmpl   $0x0,0xa8(%eax)
+8010859e:	74 d6                	je     80108576 <popcli+0x33>
+  asm volatile("sti");
+801085a0:	fb                   	sti
+}
+801085a1:	eb d3                	jmp    80108576 <popcli+0x33>
+
+801085a3 <holding>:
+{
+801085a3:	55                   	push   %ebp
+801085a4:	89 e5                	mov    %esp,%ebp
+801085a6:	53                   	push   %ebx
+801085a7:	83 ec 04             	sub    $0x4,%esp
+801085aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+801085ad:	e8 4d ff ff ff       	call   801084ff <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+801085b2:	83 3b 00             	cmpl   $0x0,(%ebx)
+801085b5:	75 11                	jne    801085c8 <holding+0x25>
+801085b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  popcli();
+801085bc:	e8 82 ff ff ff       	call   80108543 <popcli>
+}
+801085c1:	89 d8                	mov    %ebx,%eax
+801085c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801085c6:	c9                   	leave
+801085c7:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+801085c8:	8b 5b 08             	mov    0x8(%ebx),%ebx
+801085cb:	e8 05 e3 ff ff       	call   801068d5 <mycpu>
+801085d0:	39 c3                	cmp    %eax,%ebx
+801085d2:	74 07                	je     801085db <holding+0x38>
+801085d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+801085d9:	eb e1                	jmp    801085bc <holding+0x19>
+801085db:	bb 01 00 00 00       	mov    $0x1,%ebx
+801085e0:	eb da                	jmp    801085bc <holding+0x19>
+
+801085e2 <acquire>:
+{
+801085e2:	55                   	push   %ebp
+801085e3:	89 e5                	mov    %esp,%ebp
+801085e5:	53                   	push   %ebx
+801085e6:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+801085e9:	e8 11 ff ff ff       	call   801084ff <pushcli>
+  if(holding(lk))
+801085ee:	83 ec 0c             	sub    $0xc,%esp
+801085f1:	ff 75 08             	push   0x8(%ebp)
+801085f4:	e8 aa ff ff ff       	call   801085a3 <holding>
+801085f9:	83 c4 10             	add    $0x10,%esp
+801085fc:	85 c0                	test   %eax,%eax
+801085fe:	75 3a                	jne    8010863a <acquire+0x58>
+  while(xchg(&lk->locked, 1) != 0)
+80108600:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("lock; xchgl %0, %1" :
+80108603:	b8 01 00 00 00       	mov    $0x1,%eax
+80108608:	f0 87 02             	lock xchg %eax,(%edx)
+8010860b:	85 c0                	test   %eax,%eax
+8010860d:	75 f1                	jne    80108600 <acquire+0x1e>
+  __sync_synchronize();
+8010860f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+80108614:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80108617:	e8 b9 e2 ff ff       	call   801068d5 <mycpu>
+8010861c:	89 43 08             	mov    %eax,0x8(%ebx)
+  getcallerpcs(&lk, lk->pcs);
+8010861f:	8b 45 08             	mov    0x8(%ebp),%eax
+80108622:	83 c0 0c             	add    $0xc,%eax
+80108625:	83 ec 08             	sub    $0x8,%esp
+80108628:	50                   	push   %eax
+80108629:	8d 45 08             	lea    0x8(%ebp),%eax
+8010862c:	50                   	push   %eax
+8010862d:	e8 87 fe ff ff       	call   801084b9 <getcallerpcs>
+}
+80108632:	83 c4 10             	add    $0x10,%esp
+80108635:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108638:	c9                   	leave
+80108639:	c3                   	ret
+    panic("acquire");
+8010863a:	83 ec 0c             	sub    $0xc,%esp
+8010863d:	68 cd c8 10 80       	push   $0x8010c8cd
+80108642:	e8 af 85 ff ff       	call   80100bf6 <panic>
+
+80108647 <release>:
+{
+80108647:	55                   	push   %ebp
+80108648:	89 e5                	mov    %esp,%ebp
+8010864a:	53                   	push   %ebx
+8010864b:	83 ec 10             	sub    $0x10,%esp
+8010864e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holding(lk))
+80108651:	53                   	push   %ebx
+80108652:	e8 4c ff ff ff       	call   801085a3 <holding>
+80108657:	83 c4 10             	add    $0x10,%esp
+8010865a:	85 c0                	test   %eax,%eax
+8010865c:	74 23                	je     80108681 <release+0x3a>
+  lk->pcs[0] = 0;
+8010865e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80108665:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+8010866c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80108671:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  popcli();
+80108677:	e8 c7 fe ff ff       	call   80108543 <popcli>
+}
+8010867c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010867f:	c9                   	leave
+80108680:	c3                   	ret
+    panic("release");
+80108681:	83 ec 0c             	sub    $0xc,%esp
+80108684:	68 d5 c8 10 80       	push   $0x8010c8d5
+80108689:	e8 68 85 ff ff       	call   80100bf6 <panic>
+
+8010868e <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+8010868e:	55                   	push   %ebp
+8010868f:	89 e5                	mov    %esp,%ebp
+80108691:	57                   	push   %edi
+80108692:	53                   	push   %ebx
+80108693:	8b 55 08             	mov    0x8(%ebp),%edx
+80108696:	8b 45 0c             	mov    0xc(%ebp),%eax
+80108699:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+8010869c:	f6 c2 03             	test   $0x3,%dl
+8010869f:	75 25                	jne    801086c6 <memset+0x38>
+801086a1:	f6 c1 03             	test   $0x3,%cl
+801086a4:	75 20                	jne    801086c6 <memset+0x38>
+    c &= 0xFF;
+801086a6:	0f b6 f8             	movzbl %al,%edi
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+801086a9:	c1 e9 02             	shr    $0x2,%ecx
+801086ac:	c1 e0 18             	shl    $0x18,%eax
+801086af:	89 fb                	mov    %edi,%ebx
+801086b1:	c1 e3 10             	shl    $0x10,%ebx
+801086b4:	09 d8                	or     %ebx,%eax
+801086b6:	89 fb                	mov    %edi,%ebx
+801086b8:	c1 e3 08             	shl    $0x8,%ebx
+801086bb:	09 d8                	or     %ebx,%eax
+801086bd:	09 f8                	or     %edi,%eax
+  asm volatile("cld; rep stosl" :
+801086bf:	89 d7                	mov    %edx,%edi
+801086c1:	fc                   	cld
+801086c2:	f3 ab                	rep stos %eax,%es:(%edi)
+}
+801086c4:	eb 05                	jmp    801086cb <memset+0x3d>
+  asm volatile("cld; rep stosb" :
+801086c6:	89 d7                	mov    %edx,%edi
+801086c8:	fc                   	cld
+801086c9:	f3 aa                	rep stos %al,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+801086cb:	89 d0                	mov    %edx,%eax
+801086cd:	5b                   	pop    %ebx
+801086ce:	5f                   	pop    %edi
+801086cf:	5d                   	pop    %ebp
+801086d0:	c3                   	ret
+
+801086d1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+801086d1:	55                   	push   %ebp
+801086d2:	89 e5                	mov    %esp,%ebp
+801086d4:	56                   	push   %esi
+801086d5:	53                   	push   %ebx
+801086d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801086d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+801086dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+801086df:	eb 08                	jmp    801086e9 <memcmp+0x18>
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+801086e1:	83 c1 01             	add    $0x1,%ecx
+801086e4:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+801086e7:	89 f0                	mov    %esi,%eax
+801086e9:	8d 70 ff             	lea    -0x1(%eax),%esi
+801086ec:	85 c0                	test   %eax,%eax
+801086ee:	74 12                	je     80108702 <memcmp+0x31>
+    if(*s1 != *s2)
+801086f0:	0f b6 01             	movzbl (%ecx),%eax
+801086f3:	0f b6 1a             	movzbl (%edx),%ebx
+801086f6:	38 d8                	cmp    %bl,%al
+801086f8:	74 e7                	je     801086e1 <memcmp+0x10>
+      return *s1 - *s2;
+801086fa:	0f b6 c0             	movzbl %al,%eax
+801086fd:	0f b6 db             	movzbl %bl,%ebx
+80108700:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80108702:	5b                   	pop    %ebx
+80108703:	5e                   	pop    %esi
+80108704:	5d                   	pop    %ebp
+80108705:	c3                   	ret
+
+80108706 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80108706:	55                   	push   %ebp
+80108707:	89 e5                	mov    %esp,%ebp
+80108709:	56                   	push   %esi
+8010870a:	53                   	push   %ebx
+8010870b:	8b 75 08             	mov    0x8(%ebp),%esi
+8010870e:	8b 55 0c             	mov    0xc(%ebp),%edx
+80108711:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+80108714:	39 f2                	cmp    %esi,%edx
+80108716:	73 3c                	jae    80108754 <memmove+0x4e>
+80108718:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+8010871b:	39 ce                	cmp    %ecx,%esi
+8010871d:	73 39                	jae    80108758 <memmove+0x52>
+    s += n;
+    d += n;
+8010871f:	8d 14 06             	lea    (%esi,%eax,1),%edx
+    while(n-- > 0)
+80108722:	eb 0d                	jmp    80108731 <memmove+0x2b>
+      *--d = *--s;
+80108724:	83 e9 01             	sub    $0x1,%ecx
+80108727:	83 ea 01             	sub    $0x1,%edx
+8010872a:	0f b6 01             	movzbl (%ecx),%eax
+8010872d:	88 02                	mov    %al,(%edx)
+    while(n-- > 0)
+8010872f:	89 d8                	mov    %ebx,%eax
+80108731:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80108734:	85 c0                	test   %eax,%eax
+80108736:	75 ec                	jne    80108724 <memmove+0x1e>
+80108738:	eb 14                	jmp    8010874e <memmove+0x48>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+8010873a:	0f b6 02             	movzbl (%edx),%eax
+8010873d:	88 01                	mov    %al,(%ecx)
+8010873f:	8d 49 01             	lea    0x1(%ecx),%ecx
+80108742:	8d 52 01             	lea    0x1(%edx),%edx
+    while(n-- > 0)
+80108745:	89 d8                	mov    %ebx,%eax
+80108747:	8d 58 ff             	lea    -0x1(%eax),%ebx
+8010874a:	85 c0                	test   %eax,%eax
+8010874c:	75 ec                	jne    8010873a <memmove+0x34>
+
+  return dst;
+}
+8010874e:	89 f0                	mov    %esi,%eax
+80108750:	5b                   	pop    %ebx
+80108751:	5e                   	pop    %esi
+80108752:	5d                   	pop    %ebp
+80108753:	c3                   	ret
+80108754:	89 f1                	mov    %esi,%ecx
+80108756:	eb ef                	jmp    80108747 <memmove+0x41>
+80108758:	89 f1                	mov    %esi,%ecx
+8010875a:	eb eb                	jmp    80108747 <memmove+0x41>
+
+8010875c <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+8010875c:	55                   	push   %ebp
+8010875d:	89 e5                	mov    %esp,%ebp
+8010875f:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+80108762:	ff 75 10             	push   0x10(%ebp)
+80108765:	ff 75 0c             	push   0xc(%ebp)
+80108768:	ff 75 08             	push   0x8(%ebp)
+8010876b:	e8 96 ff ff ff       	call   80108706 <memmove>
+}
+80108770:	c9                   	leave
+80108771:	c3                   	ret
+
+80108772 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80108772:	55                   	push   %ebp
+80108773:	89 e5                	mov    %esp,%ebp
+80108775:	53                   	push   %ebx
+80108776:	8b 55 08             	mov    0x8(%ebp),%edx
+80108779:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010877c:	8b 45 10             	mov    0x10(%ebp),%eax
+  while(n > 0 && *p && *p == *q)
+8010877f:	eb 09                	jmp    8010878a <strncmp+0x18>
+    n--, p++, q++;
+80108781:	83 e8 01             	sub    $0x1,%eax
+80108784:	83 c2 01             	add    $0x1,%edx
+80108787:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+8010878a:	85 c0                	test   %eax,%eax
+8010878c:	74 0b                	je     80108799 <strncmp+0x27>
+8010878e:	0f b6 1a             	movzbl (%edx),%ebx
+80108791:	84 db                	test   %bl,%bl
+80108793:	74 04                	je     80108799 <strncmp+0x27>
+80108795:	3a 19                	cmp    (%ecx),%bl
+80108797:	74 e8                	je     80108781 <strncmp+0xf>
+  if(n == 0)
+80108799:	85 c0                	test   %eax,%eax
+8010879b:	74 0d                	je     801087aa <strncmp+0x38>
+    return 0;
+  return (uchar)*p - (uchar)*q;
+8010879d:	0f b6 02             	movzbl (%edx),%eax
+801087a0:	0f b6 11             	movzbl (%ecx),%edx
+801087a3:	29 d0                	sub    %edx,%eax
+}
+801087a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801087a8:	c9                   	leave
+801087a9:	c3                   	ret
+    return 0;
+801087aa:	b8 00 00 00 00       	mov    $0x0,%eax
+801087af:	eb f4                	jmp    801087a5 <strncmp+0x33>
+
+801087b1 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+801087b1:	55                   	push   %ebp
+801087b2:	89 e5                	mov    %esp,%ebp
+801087b4:	57                   	push   %edi
+801087b5:	56                   	push   %esi
+801087b6:	53                   	push   %ebx
+801087b7:	8b 7d 08             	mov    0x8(%ebp),%edi
+801087ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801087bd:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+801087c0:	89 fa                	mov    %edi,%edx
+801087c2:	eb 04                	jmp    801087c8 <strncpy+0x17>
+801087c4:	89 f1                	mov    %esi,%ecx
+801087c6:	89 da                	mov    %ebx,%edx
+801087c8:	89 c3                	mov    %eax,%ebx
+801087ca:	83 e8 01             	sub    $0x1,%eax
+801087cd:	85 db                	test   %ebx,%ebx
+801087cf:	7e 11                	jle    801087e2 <strncpy+0x31>
+801087d1:	8d 71 01             	lea    0x1(%ecx),%esi
+801087d4:	8d 5a 01             	lea    0x1(%edx),%ebx
+801087d7:	0f b6 09             	movzbl (%ecx),%ecx
+801087da:	88 0a                	mov    %cl,(%edx)
+801087dc:	84 c9                	test   %cl,%cl
+801087de:	75 e4                	jne    801087c4 <strncpy+0x13>
+801087e0:	89 da                	mov    %ebx,%edx
+    ;
+  while(n-- > 0)
+801087e2:	8d 48 ff             	lea    -0x1(%eax),%ecx
+801087e5:	85 c0                	test   %eax,%eax
+801087e7:	7e 0a                	jle    801087f3 <strncpy+0x42>
+    *s++ = 0;
+801087e9:	c6 02 00             	movb   $0x0,(%edx)
+  while(n-- > 0)
+801087ec:	89 c8                	mov    %ecx,%eax
+    *s++ = 0;
+801087ee:	8d 52 01             	lea    0x1(%edx),%edx
+801087f1:	eb ef                	jmp    801087e2 <strncpy+0x31>
+  return os;
+}
+801087f3:	89 f8                	mov    %edi,%eax
+801087f5:	5b                   	pop    %ebx
+801087f6:	5e                   	pop    %esi
+801087f7:	5f                   	pop    %edi
+801087f8:	5d                   	pop    %ebp
+801087f9:	c3                   	ret
+
+801087fa <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+801087fa:	55                   	push   %ebp
+801087fb:	89 e5                	mov    %esp,%ebp
+801087fd:	57                   	push   %edi
+801087fe:	56                   	push   %esi
+801087ff:	53                   	push   %ebx
+80108800:	8b 7d 08             	mov    0x8(%ebp),%edi
+80108803:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80108806:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+80108809:	85 c0                	test   %eax,%eax
+8010880b:	7e 23                	jle    80108830 <safestrcpy+0x36>
+8010880d:	89 fa                	mov    %edi,%edx
+8010880f:	eb 04                	jmp    80108815 <safestrcpy+0x1b>
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80108811:	89 f1                	mov    %esi,%ecx
+80108813:	89 da                	mov    %ebx,%edx
+80108815:	83 e8 01             	sub    $0x1,%eax
+80108818:	85 c0                	test   %eax,%eax
+8010881a:	7e 11                	jle    8010882d <safestrcpy+0x33>
+8010881c:	8d 71 01             	lea    0x1(%ecx),%esi
+8010881f:	8d 5a 01             	lea    0x1(%edx),%ebx
+80108822:	0f b6 09             	movzbl (%ecx),%ecx
+80108825:	88 0a                	mov    %cl,(%edx)
+80108827:	84 c9                	test   %cl,%cl
+80108829:	75 e6                	jne    80108811 <safestrcpy+0x17>
+8010882b:	89 da                	mov    %ebx,%edx
+    ;
+  *s = 0;
+8010882d:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80108830:	89 f8                	mov    %edi,%eax
+80108832:	5b                   	pop    %ebx
+80108833:	5e                   	pop    %esi
+80108834:	5f                   	pop    %edi
+80108835:	5d                   	pop    %ebp
+80108836:	c3                   	ret
+
+80108837 <strlen>:
+
+int
+strlen(const char *s)
+{
+80108837:	55                   	push   %ebp
+80108838:	89 e5                	mov    %esp,%ebp
+8010883a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+8010883d:	b8 00 00 00 00       	mov    $0x0,%eax
+80108842:	eb 03                	jmp    80108847 <strlen+0x10>
+80108844:	83 c0 01             	add    $0x1,%eax
+80108847:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+8010884b:	75 f7                	jne    80108844 <strlen+0xd>
+    ;
+  return n;
+}
+8010884d:	5d                   	pop    %ebp
+8010884e:	c3                   	ret
+
+8010884f <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+8010884f:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+80108853:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-save registers
+  pushl %ebp
+80108857:	55                   	push   %ebp
+  pushl %ebx
+80108858:	53                   	push   %ebx
+  pushl %esi
+80108859:	56                   	push   %esi
+  pushl %edi
+8010885a:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+8010885b:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+8010885d:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-save registers
+  popl %edi
+8010885f:	5f                   	pop    %edi
+  popl %esi
+80108860:	5e                   	pop    %esi
+  popl %ebx
+80108861:	5b                   	pop    %ebx
+  popl %ebp
+80108862:	5d                   	pop    %ebp
+  ret
+80108863:	c3                   	ret
+
+80108864 <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+80108864:	55                   	push   %ebp
+80108865:	89 e5                	mov    %esp,%ebp
+80108867:	53                   	push   %ebx
+80108868:	83 ec 04             	sub    $0x4,%esp
+8010886b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+8010886e:	e8 d9 e0 ff ff       	call   8010694c <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80108873:	8b 10                	mov    (%eax),%edx
+80108875:	39 d3                	cmp    %edx,%ebx
+80108877:	73 2a                	jae    801088a3 <fetchint+0x3f>
+80108879:	8d 4b 04             	lea    0x4(%ebx),%ecx
+8010887c:	39 ca                	cmp    %ecx,%edx
+8010887e:	72 2a                	jb     801088aa <fetchint+0x46>
+    return -1;
+  if(prefault(curproc, addr, 4, 0) < 0)
+80108880:	6a 00                	push   $0x0
+80108882:	6a 04                	push   $0x4
+80108884:	53                   	push   %ebx
+80108885:	50                   	push   %eax
+80108886:	e8 a2 32 00 00       	call   8010bb2d <prefault>
+8010888b:	83 c4 10             	add    $0x10,%esp
+8010888e:	85 c0                	test   %eax,%eax
+80108890:	78 1f                	js     801088b1 <fetchint+0x4d>
+    return -1;
+  *ip = *(int*)(addr);
+80108892:	8b 13                	mov    (%ebx),%edx
+80108894:	8b 45 0c             	mov    0xc(%ebp),%eax
+80108897:	89 10                	mov    %edx,(%eax)
+  return 0;
+80108899:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010889e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801088a1:	c9                   	leave
+801088a2:	c3                   	ret
+    return -1;
+801088a3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801088a8:	eb f4                	jmp    8010889e <fetchint+0x3a>
+801088aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801088af:	eb ed                	jmp    8010889e <fetchint+0x3a>
+    return -1;
+801088b1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801088b6:	eb e6                	jmp    8010889e <fetchint+0x3a>
+
+801088b8 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+801088b8:	55                   	push   %ebp
+801088b9:	89 e5                	mov    %esp,%ebp
+801088bb:	57                   	push   %edi
+801088bc:	56                   	push   %esi
+801088bd:	53                   	push   %ebx
+801088be:	83 ec 1c             	sub    $0x1c,%esp
+801088c1:	8b 7d 08             	mov    0x8(%ebp),%edi
+801088c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s, *ep;
+  struct proc *curproc = myproc();
+801088c7:	e8 80 e0 ff ff       	call   8010694c <myproc>
+801088cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if(addr >= curproc->sz)
+801088cf:	3b 38                	cmp    (%eax),%edi
+801088d1:	73 49                	jae    8010891c <fetchstr+0x64>
+    return -1;
+  *pp = (char*)addr;
+801088d3:	89 fb                	mov    %edi,%ebx
+801088d5:	89 3e                	mov    %edi,(%esi)
+  ep = (char*)curproc->sz;
+801088d7:	8b 38                	mov    (%eax),%edi
+  for(s = *pp; s < ep; s++){
+801088d9:	eb 1c                	jmp    801088f7 <fetchstr+0x3f>
+    if((s == *pp || (uint)s % PGSIZE == 0) && prefault(curproc, (uint)s, 1, 0) < 0)
+801088db:	6a 00                	push   $0x0
+801088dd:	6a 01                	push   $0x1
+801088df:	53                   	push   %ebx
+801088e0:	ff 75 e4             	push   -0x1c(%ebp)
+801088e3:	e8 45 32 00 00       	call   8010bb2d <prefault>
+801088e8:	83 c4 10             	add    $0x10,%esp
+801088eb:	85 c0                	test   %eax,%eax
+801088ed:	78 34                	js     80108923 <fetchstr+0x6b>
+      return -1;
+    if(*s == 0)
+801088ef:	80 3b 00             	cmpb   $0x0,(%ebx)
+801088f2:	74 15                	je     80108909 <fetchstr+0x51>
+  for(s = *pp; s < ep; s++){
+801088f4:	83 c3 01             	add    $0x1,%ebx
+801088f7:	39 fb                	cmp    %edi,%ebx
+801088f9:	73 14                	jae    8010890f <fetchstr+0x57>
+    if((s == *pp || (uint)s % PGSIZE == 0) && prefault(curproc, (uint)s, 1, 0) < 0)
+801088fb:	39 1e                	cmp    %ebx,(%esi)
+801088fd:	74 dc                	je     801088db <fetchstr+0x23>
+801088ff:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80108905:	75 e8                	jne    801088ef <fetchstr+0x37>
+80108907:	eb d2                	jmp    801088db <fetchstr+0x23>
+      return s - *pp;
+80108909:	89 d8                	mov    %ebx,%eax
+8010890b:	2b 06                	sub    (%esi),%eax
+8010890d:	eb 05                	jmp    80108914 <fetchstr+0x5c>
+  }
+  return -1;
+8010890f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108914:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108917:	5b                   	pop    %ebx
+80108918:	5e                   	pop    %esi
+80108919:	5f                   	pop    %edi
+8010891a:	5d                   	pop    %ebp
+8010891b:	c3                   	ret
+    return -1;
+8010891c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108921:	eb f1                	jmp    80108914 <fetchstr+0x5c>
+      return -1;
+80108923:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108928:	eb ea                	jmp    80108914 <fetchstr+0x5c>
+
+8010892a <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+8010892a:	55                   	push   %ebp
+8010892b:	89 e5                	mov    %esp,%ebp
+8010892d:	83 ec 08             	sub    $0x8,%esp
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80108930:	e8 17 e0 ff ff       	call   8010694c <myproc>
+80108935:	8b 50 20             	mov    0x20(%eax),%edx
+80108938:	8b 45 08             	mov    0x8(%ebp),%eax
+8010893b:	c1 e0 02             	shl    $0x2,%eax
+8010893e:	03 42 44             	add    0x44(%edx),%eax
+80108941:	83 ec 08             	sub    $0x8,%esp
+80108944:	ff 75 0c             	push   0xc(%ebp)
+80108947:	83 c0 04             	add    $0x4,%eax
+8010894a:	50                   	push   %eax
+8010894b:	e8 14 ff ff ff       	call   80108864 <fetchint>
+}
+80108950:	c9                   	leave
+80108951:	c3                   	ret
+
+80108952 <argptr1>:
+
+static int
+argptr1(int n, char **pp, int size, int write)
+{
+80108952:	55                   	push   %ebp
+80108953:	89 e5                	mov    %esp,%ebp
+80108955:	57                   	push   %edi
+80108956:	56                   	push   %esi
+80108957:	53                   	push   %ebx
+80108958:	83 ec 2c             	sub    $0x2c,%esp
+8010895b:	89 c7                	mov    %eax,%edi
+8010895d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80108960:	89 cb                	mov    %ecx,%ebx
+  int i;
+  struct proc *curproc = myproc();
+80108962:	e8 e5 df ff ff       	call   8010694c <myproc>
+80108967:	89 c6                	mov    %eax,%esi
+
+  if(argint(n, &i) < 0)
+80108969:	83 ec 08             	sub    $0x8,%esp
+8010896c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+8010896f:	50                   	push   %eax
+80108970:	57                   	push   %edi
+80108971:	e8 b4 ff ff ff       	call   8010892a <argint>
+80108976:	83 c4 10             	add    $0x10,%esp
+80108979:	85 c0                	test   %eax,%eax
+8010897b:	78 3b                	js     801089b8 <argptr1+0x66>
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+8010897d:	85 db                	test   %ebx,%ebx
+8010897f:	78 3e                	js     801089bf <argptr1+0x6d>
+80108981:	8b 16                	mov    (%esi),%edx
+80108983:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80108986:	39 d0                	cmp    %edx,%eax
+80108988:	73 3c                	jae    801089c6 <argptr1+0x74>
+8010898a:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+8010898d:	39 ca                	cmp    %ecx,%edx
+8010898f:	72 3c                	jb     801089cd <argptr1+0x7b>
+    return -1;
+  if(prefault(curproc, i, size, write) < 0)
+80108991:	ff 75 08             	push   0x8(%ebp)
+80108994:	53                   	push   %ebx
+80108995:	50                   	push   %eax
+80108996:	56                   	push   %esi
+80108997:	e8 91 31 00 00       	call   8010bb2d <prefault>
+8010899c:	83 c4 10             	add    $0x10,%esp
+8010899f:	85 c0                	test   %eax,%eax
+801089a1:	78 31                	js     801089d4 <argptr1+0x82>
+    return -1;
+  *pp = (char*)i;
+801089a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801089a6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+801089a9:	89 07                	mov    %eax,(%edi)
+  return 0;
+801089ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801089b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801089b3:	5b                   	pop    %ebx
+801089b4:	5e                   	pop    %esi
+801089b5:	5f                   	pop    %edi
+801089b6:	5d                   	pop    %ebp
+801089b7:	c3                   	ret
+    return -1;
+801089b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089bd:	eb f1                	jmp    801089b0 <argptr1+0x5e>
+    return -1;
+801089bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089c4:	eb ea                	jmp    801089b0 <argptr1+0x5e>
+801089c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089cb:	eb e3                	jmp    801089b0 <argptr1+0x5e>
+801089cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089d2:	eb dc                	jmp    801089b0 <argptr1+0x5e>
+    return -1;
+801089d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089d9:	eb d5                	jmp    801089b0 <argptr1+0x5e>
+
+801089db <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+801089db:	55                   	push   %ebp
+801089dc:	89 e5                	mov    %esp,%ebp
+801089de:	83 ec 14             	sub    $0x14,%esp
+  return argptr1(n, pp, size, 0);
+801089e1:	6a 00                	push   $0x0
+801089e3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801089e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+801089e9:	8b 45 08             	mov    0x8(%ebp),%eax
+801089ec:	e8 61 ff ff ff       	call   80108952 <argptr1>
+}
+801089f1:	c9                   	leave
+801089f2:	c3                   	ret
+
+801089f3 <argptrw>:
+
+// Like argptr, for a block the kernel is going to write.
+int
+argptrw(int n, char **pp, int size)
+{
+801089f3:	55                   	push   %ebp
+801089f4:	89 e5                	mov    %esp,%ebp
+801089f6:	83 ec 14             	sub    $0x14,%esp
+  return argptr1(n, pp, size, 1);
+801089f9:	6a 01                	push   $0x1
+801089fb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801089fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+80108a01:	8b 45 08             	mov    0x8(%ebp),%eax
+80108a04:	e8 49 ff ff ff       	call   80108952 <argptr1>
+}
+80108a09:	c9                   	leave
+80108a0a:	c3                   	ret
+
+80108a0b <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80108a0b:	55                   	push   %ebp
+80108a0c:	89 e5                	mov    %esp,%ebp
+80108a0e:	83 ec 20             	sub    $0x20,%esp
+  int addr;
+  if(argint(n, &addr) < 0)
+80108a11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a14:	50                   	push   %eax
+80108a15:	ff 75 08             	push   0x8(%ebp)
+80108a18:	e8 0d ff ff ff       	call   8010892a <argint>
+80108a1d:	83 c4 10             	add    $0x10,%esp
+80108a20:	85 c0                	test   %eax,%eax
+80108a22:	78 13                	js     80108a37 <argstr+0x2c>
+    return -1;
+  return fetchstr(addr, pp);
+80108a24:	83 ec 08             	sub    $0x8,%esp
+80108a27:	ff 75 0c             	push   0xc(%ebp)
+80108a2a:	ff 75 f4             	push   -0xc(%ebp)
+80108a2d:	e8 86 fe ff ff       	call   801088b8 <fetchstr>
+80108a32:	83 c4 10             	add    $0x10,%esp
+}
+80108a35:	c9                   	leave
+80108a36:	c3                   	ret
+    return -1;
+80108a37:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a3c:	eb f7                	jmp    80108a35 <argstr+0x2a>
+
+80108a3e <syscall>:
+};
+#endif // PRINT_SYSCALLS
+
+void
+syscall(void)
+{
+80108a3e:	55                   	push   %ebp
+80108a3f:	89 e5                	mov    %esp,%ebp
+80108a41:	53                   	push   %ebx
+80108a42:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+80108a45:	e8 02 df ff ff       	call   8010694c <myproc>
+80108a4a:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+80108a4c:	8b 40 20             	mov    0x20(%eax),%eax
+80108a4f:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+80108a52:	8d 50 ff             	lea    -0x1(%eax),%edx
+80108a55:	83 fa 20             	cmp    $0x20,%edx
+80108a58:	77 17                	ja     80108a71 <syscall+0x33>
+80108a5a:	8b 14 85 00 c9 10 80 	mov    -0x7fef3700(,%eax,4),%edx
+80108a61:	85 d2                	test   %edx,%edx
+80108a63:	74 0c                	je     80108a71 <syscall+0x33>
+    curproc->tf->eax = syscalls[num]();
+80108a65:	ff d2                	call   *%edx
+80108a67:	89 c2                	mov    %eax,%edx
+80108a69:	8b 43 20             	mov    0x20(%ebx),%eax
+80108a6c:	89 50 1c             	mov    %edx,0x1c(%eax)
+80108a6f:	eb 22                	jmp    80108a93 <syscall+0x55>
+  #ifdef PRINT_SYSCALLS
+    cprintf("%s -> %d\n", syscallnames[num], curproc->tf->eax);
+  #endif // PRINT_SYSCALLS
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+80108a71:	8d 93 b4 00 00 00    	lea    0xb4(%ebx),%edx
+    cprintf("%d %s: unknown sys call %d\n",
+80108a77:	50                   	push   %eax
+80108a78:	52                   	push   %edx
+80108a79:	ff 73 10             	push   0x10(%ebx)
+80108a7c:	68 dd c8 10 80       	push   $0x8010c8dd
+80108a81:	e8 31 84 ff ff       	call   80100eb7 <cprintf>
+    curproc->tf->eax = -1;
+80108a86:	8b 43 20             	mov    0x20(%ebx),%eax
+80108a89:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+80108a90:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80108a93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108a96:	c9                   	leave
+80108a97:	c3                   	ret
+
+80108a98 <argfd>:
+
+// Fetch the nth word-sized system call argument as a file descriptor
+// and return both the descriptor and the corresponding struct file.
+static int
+argfd(int n, int *pfd, struct file **pf)
+{
+80108a98:	55                   	push   %ebp
+80108a99:	89 e5                	mov    %esp,%ebp
+80108a9b:	56                   	push   %esi
+80108a9c:	53                   	push   %ebx
+80108a9d:	83 ec 18             	sub    $0x18,%esp
+80108aa0:	89 d6                	mov    %edx,%esi
+80108aa2:	89 cb                	mov    %ecx,%ebx
+  int fd;
+  struct file *f;
+
+  if(argint(n, &fd) < 0)
+80108aa4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80108aa7:	52                   	push   %edx
+80108aa8:	50                   	push   %eax
+80108aa9:	e8 7c fe ff ff       	call   8010892a <argint>
+80108aae:	83 c4 10             	add    $0x10,%esp
+80108ab1:	85 c0                	test   %eax,%eax
+80108ab3:	78 4c                	js     80108b01 <argfd+0x69>
+    return -1;
+  if(fd < 0 || fd >= myproc()->nofile || (f=myproc()->ofile[fd]) == 0)
+80108ab5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+80108ab9:	78 3f                	js     80108afa <argfd+0x62>
+80108abb:	e8 8c de ff ff       	call   8010694c <myproc>
+80108ac0:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+80108ac3:	39 48 34             	cmp    %ecx,0x34(%eax)
+80108ac6:	7e 32                	jle    80108afa <argfd+0x62>
+80108ac8:	e8 7f de ff ff       	call   8010694c <myproc>
+80108acd:	89 c1                	mov    %eax,%ecx
+80108acf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108ad2:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+80108ad9:	03 41 30             	add    0x30(%ecx),%eax
+80108adc:	8b 00                	mov    (%eax),%eax
+80108ade:	85 c0                	test   %eax,%eax
+80108ae0:	74 18                	je     80108afa <argfd+0x62>
+    return -1;
+  if(pfd)
+80108ae2:	85 f6                	test   %esi,%esi
+80108ae4:	74 02                	je     80108ae8 <argfd+0x50>
+    *pfd = fd;
+80108ae6:	89 16                	mov    %edx,(%esi)
+  if(pf)
+80108ae8:	85 db                	test   %ebx,%ebx
+80108aea:	74 1c                	je     80108b08 <argfd+0x70>
+    *pf = f;
+80108aec:	89 03                	mov    %eax,(%ebx)
+  return 0;
+80108aee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108af3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108af6:	5b                   	pop    %ebx
+80108af7:	5e                   	pop    %esi
+80108af8:	5d                   	pop    %ebp
+80108af9:	c3                   	ret
+    return -1;
+80108afa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108aff:	eb f2                	jmp    80108af3 <argfd+0x5b>
+    return -1;
+80108b01:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b06:	eb eb                	jmp    80108af3 <argfd+0x5b>
+  return 0;
+80108b08:	b8 00 00 00 00       	mov    $0x0,%eax
+80108b0d:	eb e4                	jmp    80108af3 <argfd+0x5b>
+
+80108b0f <fdalloc>:
+
+// Allocate a file descriptor for the given file.
+// Takes over file reference from caller on success.
+static int
+fdalloc(struct file *f)
+{
+80108b0f:	55                   	push   %ebp
+80108b10:	89 e5                	mov    %esp,%ebp
+80108b12:	57                   	push   %edi
+80108b13:	56                   	push   %esi
+80108b14:	53                   	push   %ebx
+80108b15:	83 ec 0c             	sub    $0xc,%esp
+80108b18:	89 c7                	mov    %eax,%edi
+  int fd;
+  struct proc *curproc = myproc();
+80108b1a:	e8 2d de ff ff       	call   8010694c <myproc>
+80108b1f:	89 c6                	mov    %eax,%esi
+
+  for(fd = 0; fd < curproc->nofile; fd++){
+80108b21:	bb 00 00 00 00       	mov    $0x0,%ebx
+80108b26:	eb 03                	jmp    80108b2b <fdalloc+0x1c>
+80108b28:	83 c3 01             	add    $0x1,%ebx
+80108b2b:	39 5e 34             	cmp    %ebx,0x34(%esi)
+80108b2e:	7e 13                	jle    80108b43 <fdalloc+0x34>
+    if(curproc->ofile[fd] == 0){
+80108b30:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+80108b37:	03 46 30             	add    0x30(%esi),%eax
+80108b3a:	83 38 00             	cmpl   $0x0,(%eax)
+80108b3d:	75 e9                	jne    80108b28 <fdalloc+0x19>
+      curproc->ofile[fd] = f;
+80108b3f:	89 38                	mov    %edi,(%eax)
+      return fd;
+80108b41:	eb 1c                	jmp    80108b5f <fdalloc+0x50>
+    }
+  }
+  if(ofilegrow(curproc) < 0)
+80108b43:	83 ec 0c             	sub    $0xc,%esp
+80108b46:	56                   	push   %esi
+80108b47:	e8 23 de ff ff       	call   8010696f <ofilegrow>
+80108b4c:	83 c4 10             	add    $0x10,%esp
+80108b4f:	85 c0                	test   %eax,%eax
+80108b51:	78 16                	js     80108b69 <fdalloc+0x5a>
+    return -1;
+  curproc->ofile[fd] = f;
+80108b53:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+80108b5a:	03 46 30             	add    0x30(%esi),%eax
+80108b5d:	89 38                	mov    %edi,(%eax)
+  return fd;
+}
+80108b5f:	89 d8                	mov    %ebx,%eax
+80108b61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108b64:	5b                   	pop    %ebx
+80108b65:	5e                   	pop    %esi
+80108b66:	5f                   	pop    %edi
+80108b67:	5d                   	pop    %ebp
+80108b68:	c3                   	ret
+    return -1;
+80108b69:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108b6e:	eb ef                	jmp    80108b5f <fdalloc+0x50>
+
+80108b70 <isdirempty>:
+}
+
+// Is the directory dp empty except for "." and ".." ?
+static int
+isdirempty(struct inode *dp)
+{
+80108b70:	55                   	push   %ebp
+80108b71:	89 e5                	mov    %esp,%ebp
+80108b73:	56                   	push   %esi
+80108b74:	53                   	push   %ebx
+80108b75:	83 ec 10             	sub    $0x10,%esp
+80108b78:	89 c3                	mov    %eax,%ebx
+  int off;
+  struct dirent de;
+
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108b7a:	b8 20 00 00 00       	mov    $0x20,%eax
+80108b7f:	89 c6                	mov    %eax,%esi
+80108b81:	3b 43 64             	cmp    0x64(%ebx),%eax
+80108b84:	73 2e                	jae    80108bb4 <isdirempty+0x44>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108b86:	6a 10                	push   $0x10
+80108b88:	50                   	push   %eax
+80108b89:	8d 45 e8             	lea    -0x18(%ebp),%eax
+80108b8c:	50                   	push   %eax
+80108b8d:	53                   	push   %ebx
+80108b8e:	e8 96 a6 ff ff       	call   80103229 <readi>
+80108b93:	83 c4 10             	add    $0x10,%esp
+80108b96:	83 f8 10             	cmp    $0x10,%eax
+80108b99:	75 0c                	jne    80108ba7 <isdirempty+0x37>
+      panic("isdirempty: readi");
+    if(de.inum != 0)
+80108b9b:	66 83 7d e8 00       	cmpw   $0x0,-0x18(%ebp)
+80108ba0:	75 1e                	jne    80108bc0 <isdirempty+0x50>
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108ba2:	8d 46 10             	lea    0x10(%esi),%eax
+80108ba5:	eb d8                	jmp    80108b7f <isdirempty+0xf>
+      panic("isdirempty: readi");
+80108ba7:	83 ec 0c             	sub    $0xc,%esp
+80108baa:	68 88 c9 10 80       	push   $0x8010c988
+80108baf:	e8 42 80 ff ff       	call   80100bf6 <panic>
+      return 0;
+  }
+  return 1;
+80108bb4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80108bb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108bbc:	5b                   	pop    %ebx
+80108bbd:	5e                   	pop    %esi
+80108bbe:	5d                   	pop    %ebp
+80108bbf:	c3                   	ret
+      return 0;
+80108bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+80108bc5:	eb f2                	jmp    80108bb9 <isdirempty+0x49>
+
+80108bc7 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+80108bc7:	55                   	push   %ebp
+80108bc8:	89 e5                	mov    %esp,%ebp
+80108bca:	57                   	push   %edi
+80108bcb:	56                   	push   %esi
+80108bcc:	53                   	push   %ebx
+80108bcd:	83 ec 44             	sub    $0x44,%esp
+80108bd0:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+80108bd3:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+80108bd6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  uint off;
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+80108bd9:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+80108bdc:	52                   	push   %edx
+80108bdd:	50                   	push   %eax
+80108bde:	e8 13 b1 ff ff       	call   80103cf6 <nameiparent>
+80108be3:	89 c6                	mov    %eax,%esi
+80108be5:	83 c4 10             	add    $0x10,%esp
+80108be8:	85 c0                	test   %eax,%eax
+80108bea:	0f 84 35 01 00 00    	je     80108d25 <create+0x15e>
+    return 0;
+  ilock(dp);
+80108bf0:	83 ec 0c             	sub    $0xc,%esp
+80108bf3:	50                   	push   %eax
+80108bf4:	e8 28 a3 ff ff       	call   80102f21 <ilock>
+
+  if((ip = dirlookup(dp, name, &off)) != 0){
+80108bf9:	83 c4 0c             	add    $0xc,%esp
+80108bfc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108bff:	50                   	push   %eax
+80108c00:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+80108c03:	50                   	push   %eax
+80108c04:	56                   	push   %esi
+80108c05:	e8 36 ac ff ff       	call   80103840 <dirlookup>
+80108c0a:	89 c3                	mov    %eax,%ebx
+80108c0c:	83 c4 10             	add    $0x10,%esp
+80108c0f:	85 c0                	test   %eax,%eax
+80108c11:	74 3d                	je     80108c50 <create+0x89>
+    iunlockput(dp);
+80108c13:	83 ec 0c             	sub    $0xc,%esp
+80108c16:	56                   	push   %esi
+80108c17:	e8 40 a5 ff ff       	call   8010315c <iunlockput>
+    ilock(ip);
+80108c1c:	89 1c 24             	mov    %ebx,(%esp)
+80108c1f:	e8 fd a2 ff ff       	call   80102f21 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80108c24:	83 c4 10             	add    $0x10,%esp
+80108c27:	66 83 7d c4 02       	cmpw   $0x2,-0x3c(%ebp)
+80108c2c:	75 07                	jne    80108c35 <create+0x6e>
+80108c2e:	66 83 7b 5c 02       	cmpw   $0x2,0x5c(%ebx)
+80108c33:	74 11                	je     80108c46 <create+0x7f>
+      return ip;
+    iunlockput(ip);
+80108c35:	83 ec 0c             	sub    $0xc,%esp
+80108c38:	53                   	push   %ebx
+80108c39:	e8 1e a5 ff ff       	call   8010315c <iunlockput>
+    return 0;
+80108c3e:	83 c4 10             	add    $0x10,%esp
+80108c41:	bb 00 00 00 00       	mov    $0x0,%ebx
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80108c46:	89 d8                	mov    %ebx,%eax
+80108c48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108c4b:	5b                   	pop    %ebx
+80108c4c:	5e                   	pop    %esi
+80108c4d:	5f                   	pop    %edi
+80108c4e:	5d                   	pop    %ebp
+80108c4f:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80108c50:	83 ec 08             	sub    $0x8,%esp
+80108c53:	0f bf 45 c4          	movswl -0x3c(%ebp),%eax
+80108c57:	50                   	push   %eax
+80108c58:	ff 36                	push   (%esi)
+80108c5a:	e8 2f a0 ff ff       	call   80102c8e <ialloc>
+80108c5f:	89 c3                	mov    %eax,%ebx
+80108c61:	83 c4 10             	add    $0x10,%esp
+80108c64:	85 c0                	test   %eax,%eax
+80108c66:	74 52                	je     80108cba <create+0xf3>
+  ilock(ip);
+80108c68:	83 ec 0c             	sub    $0xc,%esp
+80108c6b:	50                   	push   %eax
+80108c6c:	e8 b0 a2 ff ff       	call   80102f21 <ilock>
+  ip->major = major;
+80108c71:	0f b7 45 c0          	movzwl -0x40(%ebp),%eax
+80108c75:	66 89 43 5e          	mov    %ax,0x5e(%ebx)
+  ip->minor = minor;
+80108c79:	66 89 7b 60          	mov    %di,0x60(%ebx)
+  ip->nlink = 1;
+80108c7d:	66 c7 43 62 01 00    	movw   $0x1,0x62(%ebx)
+  iupdate(ip);
+80108c83:	89 1c 24             	mov    %ebx,(%esp)
+80108c86:	e8 02 a1 ff ff       	call   80102d8d <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80108c8b:	83 c4 10             	add    $0x10,%esp
+80108c8e:	66 83 7d c4 01       	cmpw   $0x1,-0x3c(%ebp)
+80108c93:	74 32                	je     80108cc7 <create+0x100>
+  if(dirlink(dp, name, ip->inum) < 0)
+80108c95:	83 ec 04             	sub    $0x4,%esp
+80108c98:	ff 73 04             	push   0x4(%ebx)
+80108c9b:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+80108c9e:	50                   	push   %eax
+80108c9f:	56                   	push   %esi
+80108ca0:	e8 52 ae ff ff       	call   80103af7 <dirlink>
+80108ca5:	83 c4 10             	add    $0x10,%esp
+80108ca8:	85 c0                	test   %eax,%eax
+80108caa:	78 6c                	js     80108d18 <create+0x151>
+  iunlockput(dp);
+80108cac:	83 ec 0c             	sub    $0xc,%esp
+80108caf:	56                   	push   %esi
+80108cb0:	e8 a7 a4 ff ff       	call   8010315c <iunlockput>
+  return ip;
+80108cb5:	83 c4 10             	add    $0x10,%esp
+80108cb8:	eb 8c                	jmp    80108c46 <create+0x7f>
+    panic("create: ialloc");
+80108cba:	83 ec 0c             	sub    $0xc,%esp
+80108cbd:	68 9a c9 10 80       	push   $0x8010c99a
+80108cc2:	e8 2f 7f ff ff       	call   80100bf6 <panic>
+    dp->nlink++;  // for ".."
+80108cc7:	0f b7 46 62          	movzwl 0x62(%esi),%eax
+80108ccb:	83 c0 01             	add    $0x1,%eax
+80108cce:	66 89 46 62          	mov    %ax,0x62(%esi)
+    iupdate(dp);
+80108cd2:	83 ec 0c             	sub    $0xc,%esp
+80108cd5:	56                   	push   %esi
+80108cd6:	e8 b2 a0 ff ff       	call   80102d8d <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+80108cdb:	83 c4 0c             	add    $0xc,%esp
+80108cde:	ff 73 04             	push   0x4(%ebx)
+80108ce1:	68 aa c9 10 80       	push   $0x8010c9aa
+80108ce6:	53                   	push   %ebx
+80108ce7:	e8 0b ae ff ff       	call   80103af7 <dirlink>
+80108cec:	83 c4 10             	add    $0x10,%esp
+80108cef:	85 c0                	test   %eax,%eax
+80108cf1:	78 18                	js     80108d0b <create+0x144>
+80108cf3:	83 ec 04             	sub    $0x4,%esp
+80108cf6:	ff 76 04             	push   0x4(%esi)
+80108cf9:	68 a9 c9 10 80       	push   $0x8010c9a9
+80108cfe:	53                   	push   %ebx
+80108cff:	e8 f3 ad ff ff       	call   80103af7 <dirlink>
+80108d04:	83 c4 10             	add    $0x10,%esp
+80108d07:	85 c0                	test   %eax,%eax
+80108d09:	79 8a                	jns    80108c95 <create+0xce>
+      panic("create dots");
+80108d0b:	83 ec 0c             	sub    $0xc,%esp
+80108d0e:	68 ac c9 10 80       	push   $0x8010c9ac
+80108d13:	e8 de 7e ff ff       	call   80100bf6 <panic>
+    panic("create: dirlink");
+80108d18:	83 ec 0c             	sub    $0xc,%esp
+80108d1b:	68 b8 c9 10 80       	push   $0x8010c9b8
+80108d20:	e8 d1 7e ff ff       	call   80100bf6 <panic>
+    return 0;
+80108d25:	89 c3                	mov    %eax,%ebx
+80108d27:	e9 1a ff ff ff       	jmp    80108c46 <create+0x7f>
+
+80108d2c <sys_dup>:
+{
+80108d2c:	55                   	push   %ebp
+80108d2d:	89 e5                	mov    %esp,%ebp
+80108d2f:	53                   	push   %ebx
+80108d30:	83 ec 14             	sub    $0x14,%esp
+  if(argfd(0, 0, &f) < 0)
+80108d33:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80108d36:	ba 00 00 00 00       	mov    $0x0,%edx
+80108d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+80108d40:	e8 53 fd ff ff       	call   80108a98 <argfd>
+80108d45:	85 c0                	test   %eax,%eax
+80108d47:	78 23                	js     80108d6c <sys_dup+0x40>
+  if((fd=fdalloc(f)) < 0)
+80108d49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108d4c:	e8 be fd ff ff       	call   80108b0f <fdalloc>
+80108d51:	89 c3                	mov    %eax,%ebx
+80108d53:	85 c0                	test   %eax,%eax
+80108d55:	78 1c                	js     80108d73 <sys_dup+0x47>
+  filedup(f);
+80108d57:	83 ec 0c             	sub    $0xc,%esp
+80108d5a:	ff 75 f4             	push   -0xc(%ebp)
+80108d5d:	e8 d4 8a ff ff       	call   80101836 <filedup>
+  return fd;
+80108d62:	83 c4 10             	add    $0x10,%esp
+}
+80108d65:	89 d8                	mov    %ebx,%eax
+80108d67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108d6a:	c9                   	leave
+80108d6b:	c3                   	ret
+    return -1;
+80108d6c:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108d71:	eb f2                	jmp    80108d65 <sys_dup+0x39>
+    return -1;
+80108d73:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108d78:	eb eb                	jmp    80108d65 <sys_dup+0x39>
+
+80108d7a <sys_read>:
+{
+80108d7a:	55                   	push   %ebp
+80108d7b:	89 e5                	mov    %esp,%ebp
+80108d7d:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
+80108d80:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80108d83:	ba 00 00 00 00       	mov    $0x0,%edx
+80108d88:	b8 00 00 00 00       	mov    $0x0,%eax
+80108d8d:	e8 06 fd ff ff       	call   80108a98 <argfd>
+80108d92:	85 c0                	test   %eax,%eax
+80108d94:	78 43                	js     80108dd9 <sys_read+0x5f>
+80108d96:	83 ec 08             	sub    $0x8,%esp
+80108d99:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108d9c:	50                   	push   %eax
+80108d9d:	6a 02                	push   $0x2
+80108d9f:	e8 86 fb ff ff       	call   8010892a <argint>
+80108da4:	83 c4 10             	add    $0x10,%esp
+80108da7:	85 c0                	test   %eax,%eax
+80108da9:	78 2e                	js     80108dd9 <sys_read+0x5f>
+80108dab:	83 ec 04             	sub    $0x4,%esp
+80108dae:	ff 75 f0             	push   -0x10(%ebp)
+80108db1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108db4:	50                   	push   %eax
+80108db5:	6a 01                	push   $0x1
+80108db7:	e8 37 fc ff ff       	call   801089f3 <argptrw>
+80108dbc:	83 c4 10             	add    $0x10,%esp
+80108dbf:	85 c0                	test   %eax,%eax
+80108dc1:	78 16                	js     80108dd9 <sys_read+0x5f>
+  return fileread(f, p, n);
+80108dc3:	83 ec 04             	sub    $0x4,%esp
+80108dc6:	ff 75 f0             	push   -0x10(%ebp)
+80108dc9:	ff 75 ec             	push   -0x14(%ebp)
+80108dcc:	ff 75 f4             	push   -0xc(%ebp)
+80108dcf:	e8 e2 8b ff ff       	call   801019b6 <fileread>
+80108dd4:	83 c4 10             	add    $0x10,%esp
+}
+80108dd7:	c9                   	leave
+80108dd8:	c3                   	ret
+    return -1;
+80108dd9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108dde:	eb f7                	jmp    80108dd7 <sys_read+0x5d>
+
+80108de0 <sys_write>:
+{
+80108de0:	55                   	push   %ebp
+80108de1:	89 e5                	mov    %esp,%ebp
+80108de3:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80108de6:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80108de9:	ba 00 00 00 00       	mov    $0x0,%edx
+80108dee:	b8 00 00 00 00       	mov    $0x0,%eax
+80108df3:	e8 a0 fc ff ff       	call   80108a98 <argfd>
+80108df8:	85 c0                	test   %eax,%eax
+80108dfa:	78 43                	js     80108e3f <sys_write+0x5f>
+80108dfc:	83 ec 08             	sub    $0x8,%esp
+80108dff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108e02:	50                   	push   %eax
+80108e03:	6a 02                	push   $0x2
+80108e05:	e8 20 fb ff ff       	call   8010892a <argint>
+80108e0a:	83 c4 10             	add    $0x10,%esp
+80108e0d:	85 c0                	test   %eax,%eax
+80108e0f:	78 2e                	js     80108e3f <sys_write+0x5f>
+80108e11:	83 ec 04             	sub    $0x4,%esp
+80108e14:	ff 75 f0             	push   -0x10(%ebp)
+80108e17:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108e1a:	50                   	push   %eax
+80108e1b:	6a 01                	push   $0x1
+80108e1d:	e8 b9 fb ff ff       	call   801089db <argptr>
+80108e22:	83 c4 10             	add    $0x10,%esp
+80108e25:	85 c0                	test   %eax,%eax
+80108e27:	78 16                	js     80108e3f <sys_write+0x5f>
+  return filewrite(f, p, n);
+80108e29:	83 ec 04             	sub    $0x4,%esp
+80108e2c:	ff 75 f0             	push   -0x10(%ebp)
+80108e2f:	ff 75 ec             	push   -0x14(%ebp)
+80108e32:	ff 75 f4             	push   -0xc(%ebp)
+80108e35:	e8 80 8c ff ff       	call   80101aba <filewrite>
+80108e3a:	83 c4 10             	add    $0x10,%esp
+}
+80108e3d:	c9                   	leave
+80108e3e:	c3                   	ret
+    return -1;
+80108e3f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108e44:	eb f7                	jmp    80108e3d <sys_write+0x5d>
+
+80108e46 <sys_close>:
+{
+80108e46:	55                   	push   %ebp
+80108e47:	89 e5                	mov    %esp,%ebp
+80108e49:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, &fd, &f) < 0)
+80108e4c:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+80108e4f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80108e52:	b8 00 00 00 00       	mov    $0x0,%eax
+80108e57:	e8 3c fc ff ff       	call   80108a98 <argfd>
+80108e5c:	85 c0                	test   %eax,%eax
+80108e5e:	78 2b                	js     80108e8b <sys_close+0x45>
+  myproc()->ofile[fd] = 0;
+80108e60:	e8 e7 da ff ff       	call   8010694c <myproc>
+80108e65:	89 c2                	mov    %eax,%edx
+80108e67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108e6a:	c1 e0 02             	shl    $0x2,%eax
+80108e6d:	03 42 30             	add    0x30(%edx),%eax
+80108e70:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  fileclose(f);
+80108e76:	83 ec 0c             	sub    $0xc,%esp
+80108e79:	ff 75 f0             	push   -0x10(%ebp)
+80108e7c:	e8 fa 89 ff ff       	call   8010187b <fileclose>
+  return 0;
+80108e81:	83 c4 10             	add    $0x10,%esp
+80108e84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108e89:	c9                   	leave
+80108e8a:	c3                   	ret
+    return -1;
+80108e8b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108e90:	eb f7                	jmp    80108e89 <sys_close+0x43>
+
+80108e92 <sys_fstat>:
+{
+80108e92:	55                   	push   %ebp
+80108e93:	89 e5                	mov    %esp,%ebp
+80108e95:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argptrw(1, (void*)&st, sizeof(*st)) < 0)
+80108e98:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80108e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+80108ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+80108ea5:	e8 ee fb ff ff       	call   80108a98 <argfd>
+80108eaa:	85 c0                	test   %eax,%eax
+80108eac:	78 2a                	js     80108ed8 <sys_fstat+0x46>
+80108eae:	83 ec 04             	sub    $0x4,%esp
+80108eb1:	6a 14                	push   $0x14
+80108eb3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108eb6:	50                   	push   %eax
+80108eb7:	6a 01                	push   $0x1
+80108eb9:	e8 35 fb ff ff       	call   801089f3 <argptrw>
+80108ebe:	83 c4 10             	add    $0x10,%esp
+80108ec1:	85 c0                	test   %eax,%eax
+80108ec3:	78 13                	js     80108ed8 <sys_fstat+0x46>
+  return filestat(f, st);
+80108ec5:	83 ec 08             	sub    $0x8,%esp
+80108ec8:	ff 75 f0             	push   -0x10(%ebp)
+80108ecb:	ff 75 f4             	push   -0xc(%ebp)
+80108ece:	e8 9c 8a ff ff       	call   8010196f <filestat>
+80108ed3:	83 c4 10             	add    $0x10,%esp
+}
+80108ed6:	c9                   	leave
+80108ed7:	c3                   	ret
+    return -1;
+80108ed8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108edd:	eb f7                	jmp    80108ed6 <sys_fstat+0x44>
+
+80108edf <sys_link>:
+{
+80108edf:	55                   	push   %ebp
+80108ee0:	89 e5                	mov    %esp,%ebp
+80108ee2:	56                   	push   %esi
+80108ee3:	53                   	push   %ebx
+80108ee4:	83 ec 28             	sub    $0x28,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80108ee7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80108eea:	50                   	push   %eax
+80108eeb:	6a 00                	push   $0x0
+80108eed:	e8 19 fb ff ff       	call   80108a0b <argstr>
+80108ef2:	83 c4 10             	add    $0x10,%esp
+80108ef5:	85 c0                	test   %eax,%eax
+80108ef7:	0f 88 d3 00 00 00    	js     80108fd0 <sys_link+0xf1>
+80108efd:	83 ec 08             	sub    $0x8,%esp
+80108f00:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108f03:	50                   	push   %eax
+80108f04:	6a 01                	push   $0x1
+80108f06:	e8 00 fb ff ff       	call   80108a0b <argstr>
+80108f0b:	83 c4 10             	add    $0x10,%esp
+80108f0e:	85 c0                	test   %eax,%eax
+80108f10:	0f 88 ba 00 00 00    	js     80108fd0 <sys_link+0xf1>
+  begin_op();
+80108f16:	e8 7c c3 ff ff       	call   80105297 <begin_op>
+  if((ip = namei(old)) == 0){
+80108f1b:	83 ec 0c             	sub    $0xc,%esp
+80108f1e:	ff 75 e0             	push   -0x20(%ebp)
+80108f21:	e8 b8 ad ff ff       	call   80103cde <namei>
+80108f26:	89 c3                	mov    %eax,%ebx
+80108f28:	83 c4 10             	add    $0x10,%esp
+80108f2b:	85 c0                	test   %eax,%eax
+80108f2d:	0f 84 a4 00 00 00    	je     80108fd7 <sys_link+0xf8>
+  ilock(ip);
+80108f33:	83 ec 0c             	sub    $0xc,%esp
+80108f36:	50                   	push   %eax
+80108f37:	e8 e5 9f ff ff       	call   80102f21 <ilock>
+  if(ip->type == T_DIR){
+80108f3c:	83 c4 10             	add    $0x10,%esp
+80108f3f:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+80108f44:	0f 84 99 00 00 00    	je     80108fe3 <sys_link+0x104>
+  ip->nlink++;
+80108f4a:	0f b7 43 62          	movzwl 0x62(%ebx),%eax
+80108f4e:	83 c0 01             	add    $0x1,%eax
+80108f51:	66 89 43 62          	mov    %ax,0x62(%ebx)
+  iupdate(ip);
+80108f55:	83 ec 0c             	sub    $0xc,%esp
+80108f58:	53                   	push   %ebx
+80108f59:	e8 2f 9e ff ff       	call   80102d8d <iupdate>
+  iunlock(ip);
+80108f5e:	89 1c 24             	mov    %ebx,(%esp)
+80108f61:	e8 90 a0 ff ff       	call   80102ff6 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80108f66:	83 c4 08             	add    $0x8,%esp
+80108f69:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80108f6c:	50                   	push   %eax
+80108f6d:	ff 75 e4             	push   -0x1c(%ebp)
+80108f70:	e8 81 ad ff ff       	call   80103cf6 <nameiparent>
+80108f75:	89 c6                	mov    %eax,%esi
+80108f77:	83 c4 10             	add    $0x10,%esp
+80108f7a:	85 c0                	test   %eax,%eax
+80108f7c:	0f 84 85 00 00 00    	je     80109007 <sys_link+0x128>
+  ilock(dp);
+80108f82:	83 ec 0c             	sub    $0xc,%esp
+80108f85:	50                   	push   %eax
+80108f86:	e8 96 9f ff ff       	call   80102f21 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80108f8b:	83 c4 10             	add    $0x10,%esp
+80108f8e:	8b 03                	mov    (%ebx),%eax
+80108f90:	39 06                	cmp    %eax,(%esi)
+80108f92:	75 67                	jne    80108ffb <sys_link+0x11c>
+80108f94:	83 ec 04             	sub    $0x4,%esp
+80108f97:	ff 73 04             	push   0x4(%ebx)
+80108f9a:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80108f9d:	50                   	push   %eax
+80108f9e:	56                   	push   %esi
+80108f9f:	e8 53 ab ff ff       	call   80103af7 <dirlink>
+80108fa4:	83 c4 10             	add    $0x10,%esp
+80108fa7:	85 c0                	test   %eax,%eax
+80108fa9:	78 50                	js     80108ffb <sys_link+0x11c>
+  iunlockput(dp);
+80108fab:	83 ec 0c             	sub    $0xc,%esp
+80108fae:	56                   	push   %esi
+80108faf:	e8 a8 a1 ff ff       	call   8010315c <iunlockput>
+  iput(ip);
+80108fb4:	89 1c 24             	mov    %ebx,(%esp)
+80108fb7:	e8 c3 a0 ff ff       	call   8010307f <iput>
+  end_op();
+80108fbc:	e8 50 c3 ff ff       	call   80105311 <end_op>
+  return 0;
+80108fc1:	83 c4 10             	add    $0x10,%esp
+80108fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108fc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108fcc:	5b                   	pop    %ebx
+80108fcd:	5e                   	pop    %esi
+80108fce:	5d                   	pop    %ebp
+80108fcf:	c3                   	ret
+    return -1;
+80108fd0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108fd5:	eb f2                	jmp    80108fc9 <sys_link+0xea>
+    end_op();
+80108fd7:	e8 35 c3 ff ff       	call   80105311 <end_op>
+    return -1;
+80108fdc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108fe1:	eb e6                	jmp    80108fc9 <sys_link+0xea>
+    iunlockput(ip);
+80108fe3:	83 ec 0c             	sub    $0xc,%esp
+80108fe6:	53                   	push   %ebx
+80108fe7:	e8 70 a1 ff ff       	call   8010315c <iunlockput>
+    end_op();
+80108fec:	e8 20 c3 ff ff       	call   80105311 <end_op>
+    return -1;
+80108ff1:	83 c4 10             	add    $0x10,%esp
+80108ff4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ff9:	eb ce                	jmp    80108fc9 <sys_link+0xea>
+    iunlockput(dp);
+80108ffb:	83 ec 0c             	sub    $0xc,%esp
+80108ffe:	56                   	push   %esi
+80108fff:	e8 58 a1 ff ff       	call   8010315c <iunlockput>
+    goto bad;
+80109004:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80109007:	83 ec 0c             	sub    $0xc,%esp
+8010900a:	53                   	push   %ebx
+8010900b:	e8 11 9f ff ff       	call   80102f21 <ilock>
+  ip->nlink--;
+80109010:	0f b7 43 62          	movzwl 0x62(%ebx),%eax
+80109014:	83 e8 01             	sub    $0x1,%eax
+80109017:	66 89 43 62          	mov    %ax,0x62(%ebx)
+  iupdate(ip);
+8010901b:	89 1c 24             	mov    %ebx,(%esp)
+8010901e:	e8 6a 9d ff ff       	call   80102d8d <iupdate>
+  iunlockput(ip);
+80109023:	89 1c 24             	mov    %ebx,(%esp)
+80109026:	e8 31 a1 ff ff       	call   8010315c <iunlockput>
+  end_op();
+8010902b:	e8 e1 c2 ff ff       	call   80105311 <end_op>
+  return -1;
+80109030:	83 c4 10             	add    $0x10,%esp
+80109033:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109038:	eb 8f                	jmp    80108fc9 <sys_link+0xea>
+
+8010903a <sys_unlink>:
+{
+8010903a:	55                   	push   %ebp
+8010903b:	89 e5                	mov    %esp,%ebp
+8010903d:	56                   	push   %esi
+8010903e:	53                   	push   %ebx
+8010903f:	83 ec 28             	sub    $0x28,%esp
+  if(argstr(0, &path) < 0)
+80109042:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80109045:	50                   	push   %eax
+80109046:	6a 00                	push   $0x0
+80109048:	e8 be f9 ff ff       	call   80108a0b <argstr>
+8010904d:	83 c4 10             	add    $0x10,%esp
+80109050:	85 c0                	test   %eax,%eax
+80109052:	0f 88 50 01 00 00    	js     801091a8 <sys_unlink+0x16e>
+  begin_op();
+80109058:	e8 3a c2 ff ff       	call   80105297 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+8010905d:	83 ec 08             	sub    $0x8,%esp
+80109060:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80109063:	50                   	push   %eax
+80109064:	ff 75 e4             	push   -0x1c(%ebp)
+80109067:	e8 8a ac ff ff       	call   80103cf6 <nameiparent>
+8010906c:	89 c6                	mov    %eax,%esi
+8010906e:	83 c4 10             	add    $0x10,%esp
+80109071:	85 c0                	test   %eax,%eax
+80109073:	0f 84 cb 00 00 00    	je     80109144 <sys_unlink+0x10a>
+  ilock(dp);
+80109079:	83 ec 0c             	sub    $0xc,%esp
+8010907c:	50                   	push   %eax
+8010907d:	e8 9f 9e ff ff       	call   80102f21 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+80109082:	83 c4 08             	add    $0x8,%esp
+80109085:	68 aa c9 10 80       	push   $0x8010c9aa
+8010908a:	8d 45 ea             	lea    -0x16(%ebp),%eax
+8010908d:	50                   	push   %eax
+8010908e:	e8 15 a7 ff ff       	call   801037a8 <namecmp>
+80109093:	83 c4 10             	add    $0x10,%esp
+80109096:	85 c0                	test   %eax,%eax
+80109098:	0f 84 d6 00 00 00    	je     80109174 <sys_unlink+0x13a>
+8010909e:	83 ec 08             	sub    $0x8,%esp
+801090a1:	68 a9 c9 10 80       	push   $0x8010c9a9
+801090a6:	8d 45 ea             	lea    -0x16(%ebp),%eax
+801090a9:	50                   	push   %eax
+801090aa:	e8 f9 a6 ff ff       	call   801037a8 <namecmp>
+801090af:	83 c4 10             	add    $0x10,%esp
+801090b2:	85 c0                	test   %eax,%eax
+801090b4:	0f 84 ba 00 00 00    	je     80109174 <sys_unlink+0x13a>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+801090ba:	83 ec 04             	sub    $0x4,%esp
+801090bd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+801090c0:	50                   	push   %eax
+801090c1:	8d 45 ea             	lea    -0x16(%ebp),%eax
+801090c4:	50                   	push   %eax
+801090c5:	56                   	push   %esi
+801090c6:	e8 75 a7 ff ff       	call   80103840 <dirlookup>
+801090cb:	89 c3                	mov    %eax,%ebx
+801090cd:	83 c4 10             	add    $0x10,%esp
+801090d0:	85 c0                	test   %eax,%eax
+801090d2:	0f 84 9c 00 00 00    	je     80109174 <sys_unlink+0x13a>
+  ilock(ip);
+801090d8:	83 ec 0c             	sub    $0xc,%esp
+801090db:	50                   	push   %eax
+801090dc:	e8 40 9e ff ff       	call   80102f21 <ilock>
+  if(ip->nlink < 1)
+801090e1:	83 c4 10             	add    $0x10,%esp
+801090e4:	66 83 7b 62 00       	cmpw   $0x0,0x62(%ebx)
+801090e9:	7e 65                	jle    80109150 <sys_unlink+0x116>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+801090eb:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+801090f0:	74 6b                	je     8010915d <sys_unlink+0x123>
+  dirunlink(dp, off);
+801090f2:	83 ec 08             	sub    $0x8,%esp
+801090f5:	ff 75 e0             	push   -0x20(%ebp)
+801090f8:	56                   	push   %esi
+801090f9:	e8 08 ab ff ff       	call   80103c06 <dirunlink>
+  if(ip->type == T_DIR){
+801090fe:	83 c4 10             	add    $0x10,%esp
+80109101:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+80109106:	0f 84 80 00 00 00    	je     8010918c <sys_unlink+0x152>
+  iunlockput(dp);
+8010910c:	83 ec 0c             	sub    $0xc,%esp
+8010910f:	56                   	push   %esi
+80109110:	e8 47 a0 ff ff       	call   8010315c <iunlockput>
+  ip->nlink--;
+80109115:	0f b7 43 62          	movzwl 0x62(%ebx),%eax
+80109119:	83 e8 01             	sub    $0x1,%eax
+8010911c:	66 89 43 62          	mov    %ax,0x62(%ebx)
+  iupdate(ip);
+80109120:	89 1c 24             	mov    %ebx,(%esp)
+80109123:	e8 65 9c ff ff       	call   80102d8d <iupdate>
+  iunlockput(ip);
+80109128:	89 1c 24             	mov    %ebx,(%esp)
+8010912b:	e8 2c a0 ff ff       	call   8010315c <iunlockput>
+  end_op();
+80109130:	e8 dc c1 ff ff       	call   80105311 <end_op>
+  return 0;
+80109135:	83 c4 10             	add    $0x10,%esp
+80109138:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010913d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109140:	5b                   	pop    %ebx
+80109141:	5e                   	pop    %esi
+80109142:	5d                   	pop    %ebp
+80109143:	c3                   	ret
+    end_op();
+80109144:	e8 c8 c1 ff ff       	call   80105311 <end_op>
+    return -1;
+80109149:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010914e:	eb ed                	jmp    8010913d <sys_unlink+0x103>
+    panic("unlink: nlink < 1");
+80109150:	83 ec 0c             	sub    $0xc,%esp
+80109153:	68 c8 c9 10 80       	push   $0x8010c9c8
+80109158:	e8 99 7a ff ff       	call   80100bf6 <panic>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+8010915d:	89 d8                	mov    %ebx,%eax
+8010915f:	e8 0c fa ff ff       	call   80108b70 <isdirempty>
+80109164:	85 c0                	test   %eax,%eax
+80109166:	75 8a                	jne    801090f2 <sys_unlink+0xb8>
+    iunlockput(ip);
+80109168:	83 ec 0c             	sub    $0xc,%esp
+8010916b:	53                   	push   %ebx
+8010916c:	e8 eb 9f ff ff       	call   8010315c <iunlockput>
+    goto bad;
+80109171:	83 c4 10             	add    $0x10,%esp
+  iunlockput(dp);
+80109174:	83 ec 0c             	sub    $0xc,%esp
+80109177:	56                   	push   %esi
+80109178:	e8 df 9f ff ff       	call   8010315c <iunlockput>
+  end_op();
+8010917d:	e8 8f c1 ff ff       	call   80105311 <end_op>
+  return -1;
+80109182:	83 c4 10             	add    $0x10,%esp
+80109185:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010918a:	eb b1                	jmp    8010913d <sys_unlink+0x103>
+    dp->nlink--;
+8010918c:	0f b7 46 62          	movzwl 0x62(%esi),%eax
+80109190:	83 e8 01             	sub    $0x1,%eax
+80109193:	66 89 46 62          	mov    %ax,0x62(%esi)
+    iupdate(dp);
+80109197:	83 ec 0c             	sub    $0xc,%esp
+8010919a:	56                   	push   %esi
+8010919b:	e8 ed 9b ff ff       	call   80102d8d <iupdate>
+801091a0:	83 c4 10             	add    $0x10,%esp
+801091a3:	e9 64 ff ff ff       	jmp    8010910c <sys_unlink+0xd2>
+    return -1;
+801091a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801091ad:	eb 8e                	jmp    8010913d <sys_unlink+0x103>
+
+801091af <sys_open>:
+
+int
+sys_open(void)
+{
+801091af:	55                   	push   %ebp
+801091b0:	89 e5                	mov    %esp,%ebp
+801091b2:	57                   	push   %edi
+801091b3:	56                   	push   %esi
+801091b4:	53                   	push   %ebx
+801091b5:	83 ec 24             	sub    $0x24,%esp
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801091b8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801091bb:	50                   	push   %eax
+801091bc:	6a 00                	push   $0x0
+801091be:	e8 48 f8 ff ff       	call   80108a0b <argstr>
+801091c3:	83 c4 10             	add    $0x10,%esp
+801091c6:	85 c0                	test   %eax,%eax
+801091c8:	0f 88 b5 00 00 00    	js     80109283 <sys_open+0xd4>
+801091ce:	83 ec 08             	sub    $0x8,%esp
+801091d1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+801091d4:	50                   	push   %eax
+801091d5:	6a 01                	push   $0x1
+801091d7:	e8 4e f7 ff ff       	call   8010892a <argint>
+801091dc:	83 c4 10             	add    $0x10,%esp
+801091df:	85 c0                	test   %eax,%eax
+801091e1:	0f 88 9c 00 00 00    	js     80109283 <sys_open+0xd4>
+    return -1;
+
+  begin_op();
+801091e7:	e8 ab c0 ff ff       	call   80105297 <begin_op>
+
+  if(omode & O_CREATE){
+801091ec:	f6 45 e1 02          	testb  $0x2,-0x1f(%ebp)
+801091f0:	0f 84 a0 00 00 00    	je     80109296 <sys_open+0xe7>
+    ip = create(path, T_FILE, 0, 0);
+801091f6:	83 ec 0c             	sub    $0xc,%esp
+801091f9:	6a 00                	push   $0x0
+801091fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+80109200:	ba 02 00 00 00       	mov    $0x2,%edx
+80109205:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80109208:	e8 ba f9 ff ff       	call   80108bc7 <create>
+8010920d:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+8010920f:	83 c4 10             	add    $0x10,%esp
+80109212:	85 c0                	test   %eax,%eax
+80109214:	74 74                	je     8010928a <sys_open+0xdb>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+80109216:	e8 a5 85 ff ff       	call   801017c0 <filealloc>
+8010921b:	89 c3                	mov    %eax,%ebx
+8010921d:	85 c0                	test   %eax,%eax
+8010921f:	0f 84 d6 00 00 00    	je     801092fb <sys_open+0x14c>
+80109225:	e8 e5 f8 ff ff       	call   80108b0f <fdalloc>
+8010922a:	89 c7                	mov    %eax,%edi
+8010922c:	85 c0                	test   %eax,%eax
+8010922e:	0f 88 bb 00 00 00    	js     801092ef <sys_open+0x140>
+      fileclose(f);
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80109234:	83 ec 0c             	sub    $0xc,%esp
+80109237:	56                   	push   %esi
+80109238:	e8 b9 9d ff ff       	call   80102ff6 <iunlock>
+  end_op();
+8010923d:	e8 cf c0 ff ff       	call   80105311 <end_op>
+
+  f->type = FD_INODE;
+80109242:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  f->ip = ip;
+80109248:	89 73 14             	mov    %esi,0x14(%ebx)
+  f->off = 0;
+8010924b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->ranext = f->raend = 0;
+80109252:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+80109259:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  f->rawin = 0;
+80109260:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+  f->readable = !(omode & O_WRONLY);
+80109267:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010926a:	83 c4 10             	add    $0x10,%esp
+8010926d:	a8 01                	test   $0x1,%al
+8010926f:	0f 94 43 0c          	sete   0xc(%ebx)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80109273:	a8 03                	test   $0x3,%al
+80109275:	0f 95 43 0d          	setne  0xd(%ebx)
+  return fd;
+}
+80109279:	89 f8                	mov    %edi,%eax
+8010927b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010927e:	5b                   	pop    %ebx
+8010927f:	5e                   	pop    %esi
+80109280:	5f                   	pop    %edi
+80109281:	5d                   	pop    %ebp
+80109282:	c3                   	ret
+    return -1;
+80109283:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80109288:	eb ef                	jmp    80109279 <sys_open+0xca>
+      end_op();
+8010928a:	e8 82 c0 ff ff       	call   80105311 <end_op>
+      return -1;
+8010928f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80109294:	eb e3                	jmp    80109279 <sys_open+0xca>
+    if((ip = namei(path)) == 0){
+80109296:	83 ec 0c             	sub    $0xc,%esp
+80109299:	ff 75 e4             	push   -0x1c(%ebp)
+8010929c:	e8 3d aa ff ff       	call   80103cde <namei>
+801092a1:	89 c6                	mov    %eax,%esi
+801092a3:	83 c4 10             	add    $0x10,%esp
+801092a6:	85 c0                	test   %eax,%eax
+801092a8:	74 39                	je     801092e3 <sys_open+0x134>
+    ilock(ip);
+801092aa:	83 ec 0c             	sub    $0xc,%esp
+801092ad:	50                   	push   %eax
+801092ae:	e8 6e 9c ff ff       	call   80102f21 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+801092b3:	83 c4 10             	add    $0x10,%esp
+801092b6:	66 83 7e 5c 01       	cmpw   $0x1,0x5c(%esi)
+801092bb:	0f 85 55 ff ff ff    	jne    80109216 <sys_open+0x67>
+801092c1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+801092c5:	0f 84 4b ff ff ff    	je     80109216 <sys_open+0x67>
+      iunlockput(ip);
+801092cb:	83 ec 0c             	sub    $0xc,%esp
+801092ce:	56                   	push   %esi
+801092cf:	e8 88 9e ff ff       	call   8010315c <iunlockput>
+      end_op();
+801092d4:	e8 38 c0 ff ff       	call   80105311 <end_op>
+      return -1;
+801092d9:	83 c4 10             	add    $0x10,%esp
+801092dc:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801092e1:	eb 96                	jmp    80109279 <sys_open+0xca>
+      end_op();
+801092e3:	e8 29 c0 ff ff       	call   80105311 <end_op>
+      return -1;
+801092e8:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801092ed:	eb 8a                	jmp    80109279 <sys_open+0xca>
+      fileclose(f);
+801092ef:	83 ec 0c             	sub    $0xc,%esp
+801092f2:	53                   	push   %ebx
+801092f3:	e8 83 85 ff ff       	call   8010187b <fileclose>
+801092f8:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+801092fb:	83 ec 0c             	sub    $0xc,%esp
+801092fe:	56                   	push   %esi
+801092ff:	e8 58 9e ff ff       	call   8010315c <iunlockput>
+    end_op();
+80109304:	e8 08 c0 ff ff       	call   80105311 <end_op>
+    return -1;
+80109309:	83 c4 10             	add    $0x10,%esp
+8010930c:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80109311:	e9 63 ff ff ff       	jmp    80109279 <sys_open+0xca>
+
+80109316 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+80109316:	55                   	push   %ebp
+80109317:	89 e5                	mov    %esp,%ebp
+80109319:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+8010931c:	e8 76 bf ff ff       	call   80105297 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+80109321:	83 ec 08             	sub    $0x8,%esp
+80109324:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109327:	50                   	push   %eax
+80109328:	6a 00                	push   $0x0
+8010932a:	e8 dc f6 ff ff       	call   80108a0b <argstr>
+8010932f:	83 c4 10             	add    $0x10,%esp
+80109332:	85 c0                	test   %eax,%eax
+80109334:	78 36                	js     8010936c <sys_mkdir+0x56>
+80109336:	83 ec 0c             	sub    $0xc,%esp
+80109339:	6a 00                	push   $0x0
+8010933b:	b9 00 00 00 00       	mov    $0x0,%ecx
+80109340:	ba 01 00 00 00       	mov    $0x1,%edx
+80109345:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80109348:	e8 7a f8 ff ff       	call   80108bc7 <create>
+8010934d:	83 c4 10             	add    $0x10,%esp
+80109350:	85 c0                	test   %eax,%eax
+80109352:	74 18                	je     8010936c <sys_mkdir+0x56>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+80109354:	83 ec 0c             	sub    $0xc,%esp
+80109357:	50                   	push   %eax
+80109358:	e8 ff 9d ff ff       	call   8010315c <iunlockput>
+  end_op();
+8010935d:	e8 af bf ff ff       	call   80105311 <end_op>
+  return 0;
+80109362:	83 c4 10             	add    $0x10,%esp
+80109365:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010936a:	c9                   	leave
+8010936b:	c3                   	ret
+    end_op();
+8010936c:	e8 a0 bf ff ff       	call   80105311 <end_op>
+    return -1;
+80109371:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109376:	eb f2                	jmp    8010936a <sys_mkdir+0x54>
+
+80109378 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+80109378:	55                   	push   %ebp
+80109379:	89 e5                	mov    %esp,%ebp
+8010937b:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+8010937e:	e8 14 bf ff ff       	call   80105297 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+80109383:	83 ec 08             	sub    $0x8,%esp
+80109386:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109389:	50                   	push   %eax
+8010938a:	6a 00                	push   $0x0
+8010938c:	e8 7a f6 ff ff       	call   80108a0b <argstr>
+80109391:	83 c4 10             	add    $0x10,%esp
+80109394:	85 c0                	test   %eax,%eax
+80109396:	78 62                	js     801093fa <sys_mknod+0x82>
+     argint(1, &major) < 0 ||
+80109398:	83 ec 08             	sub    $0x8,%esp
+8010939b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+8010939e:	50                   	push   %eax
+8010939f:	6a 01                	push   $0x1
+801093a1:	e8 84 f5 ff ff       	call   8010892a <argint>
+  if((argstr(0, &path)) < 0 ||
+801093a6:	83 c4 10             	add    $0x10,%esp
+801093a9:	85 c0                	test   %eax,%eax
+801093ab:	78 4d                	js     801093fa <sys_mknod+0x82>
+     argint(2, &minor) < 0 ||
+801093ad:	83 ec 08             	sub    $0x8,%esp
+801093b0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801093b3:	50                   	push   %eax
+801093b4:	6a 02                	push   $0x2
+801093b6:	e8 6f f5 ff ff       	call   8010892a <argint>
+     argint(1, &major) < 0 ||
+801093bb:	83 c4 10             	add    $0x10,%esp
+801093be:	85 c0                	test   %eax,%eax
+801093c0:	78 38                	js     801093fa <sys_mknod+0x82>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+801093c2:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+801093c6:	83 ec 0c             	sub    $0xc,%esp
+801093c9:	0f bf 45 ec          	movswl -0x14(%ebp),%eax
+801093cd:	50                   	push   %eax
+801093ce:	ba 03 00 00 00       	mov    $0x3,%edx
+801093d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801093d6:	e8 ec f7 ff ff       	call   80108bc7 <create>
+     argint(2, &minor) < 0 ||
+801093db:	83 c4 10             	add    $0x10,%esp
+801093de:	85 c0                	test   %eax,%eax
+801093e0:	74 18                	je     801093fa <sys_mknod+0x82>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+801093e2:	83 ec 0c             	sub    $0xc,%esp
+801093e5:	50                   	push   %eax
+801093e6:	e8 71 9d ff ff       	call   8010315c <iunlockput>
+  end_op();
+801093eb:	e8 21 bf ff ff       	call   80105311 <end_op>
+  return 0;
+801093f0:	83 c4 10             	add    $0x10,%esp
+801093f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801093f8:	c9                   	leave
+801093f9:	c3                   	ret
+    end_op();
+801093fa:	e8 12 bf ff ff       	call   80105311 <end_op>
+    return -1;
+801093ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109404:	eb f2                	jmp    801093f8 <sys_mknod+0x80>
+
+80109406 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+80109406:	55                   	push   %ebp
+80109407:	89 e5                	mov    %esp,%ebp
+80109409:	56                   	push   %esi
+8010940a:	53                   	push   %ebx
+8010940b:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+8010940e:	e8 39 d5 ff ff       	call   8010694c <myproc>
+80109413:	89 c6                	mov    %eax,%esi
+
+  begin_op();
+80109415:	e8 7d be ff ff       	call   80105297 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+8010941a:	83 ec 08             	sub    $0x8,%esp
+8010941d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109420:	50                   	push   %eax
+80109421:	6a 00                	push   $0x0
+80109423:	e8 e3 f5 ff ff       	call   80108a0b <argstr>
+80109428:	83 c4 10             	add    $0x10,%esp
+8010942b:	85 c0                	test   %eax,%eax
+8010942d:	78 52                	js     80109481 <sys_chdir+0x7b>
+8010942f:	83 ec 0c             	sub    $0xc,%esp
+80109432:	ff 75 f4             	push   -0xc(%ebp)
+80109435:	e8 a4 a8 ff ff       	call   80103cde <namei>
+8010943a:	89 c3                	mov    %eax,%ebx
+8010943c:	83 c4 10             	add    $0x10,%esp
+8010943f:	85 c0                	test   %eax,%eax
+80109441:	74 3e                	je     80109481 <sys_chdir+0x7b>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+80109443:	83 ec 0c             	sub    $0xc,%esp
+80109446:	50                   	push   %eax
+80109447:	e8 d5 9a ff ff       	call   80102f21 <ilock>
+  if(ip->type != T_DIR){
+8010944c:	83 c4 10             	add    $0x10,%esp
+8010944f:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+80109454:	75 37                	jne    8010948d <sys_chdir+0x87>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80109456:	83 ec 0c             	sub    $0xc,%esp
+80109459:	53                   	push   %ebx
+8010945a:	e8 97 9b ff ff       	call   80102ff6 <iunlock>
+  iput(curproc->cwd);
+8010945f:	83 c4 04             	add    $0x4,%esp
+80109462:	ff 76 78             	push   0x78(%esi)
+80109465:	e8 15 9c ff ff       	call   8010307f <iput>
+  end_op();
+8010946a:	e8 a2 be ff ff       	call   80105311 <end_op>
+  curproc->cwd = ip;
+8010946f:	89 5e 78             	mov    %ebx,0x78(%esi)
+  return 0;
+80109472:	83 c4 10             	add    $0x10,%esp
+80109475:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010947a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010947d:	5b                   	pop    %ebx
+8010947e:	5e                   	pop    %esi
+8010947f:	5d                   	pop    %ebp
+80109480:	c3                   	ret
+    end_op();
+80109481:	e8 8b be ff ff       	call   80105311 <end_op>
+    return -1;
+80109486:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010948b:	eb ed                	jmp    8010947a <sys_chdir+0x74>
+    iunlockput(ip);
+8010948d:	83 ec 0c             	sub    $0xc,%esp
+80109490:	53                   	push   %ebx
+80109491:	e8 c6 9c ff ff       	call   8010315c <iunlockput>
+    end_op();
+80109496:	e8 76 be ff ff       	call   80105311 <end_op>
+    return -1;
+8010949b:	83 c4 10             	add    $0x10,%esp
+8010949e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801094a3:	eb d5                	jmp    8010947a <sys_chdir+0x74>
+
+801094a5 <sys_exec>:
+
+int
+sys_exec(void)
+{
+801094a5:	55                   	push   %ebp
+801094a6:	89 e5                	mov    %esp,%ebp
+801094a8:	53                   	push   %ebx
+801094a9:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+801094af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801094b2:	50                   	push   %eax
+801094b3:	6a 00                	push   $0x0
+801094b5:	e8 51 f5 ff ff       	call   80108a0b <argstr>
+801094ba:	83 c4 10             	add    $0x10,%esp
+801094bd:	85 c0                	test   %eax,%eax
+801094bf:	78 38                	js     801094f9 <sys_exec+0x54>
+801094c1:	83 ec 08             	sub    $0x8,%esp
+801094c4:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+801094ca:	50                   	push   %eax
+801094cb:	6a 01                	push   $0x1
+801094cd:	e8 58 f4 ff ff       	call   8010892a <argint>
+801094d2:	83 c4 10             	add    $0x10,%esp
+801094d5:	85 c0                	test   %eax,%eax
+801094d7:	78 20                	js     801094f9 <sys_exec+0x54>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+801094d9:	83 ec 04             	sub    $0x4,%esp
+801094dc:	68 80 00 00 00       	push   $0x80
+801094e1:	6a 00                	push   $0x0
+801094e3:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+801094e9:	50                   	push   %eax
+801094ea:	e8 9f f1 ff ff       	call   8010868e <memset>
+801094ef:	83 c4 10             	add    $0x10,%esp
+  for(i=0;; i++){
+801094f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+801094f7:	eb 2c                	jmp    80109525 <sys_exec+0x80>
+    return -1;
+801094f9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801094fe:	eb 78                	jmp    80109578 <sys_exec+0xd3>
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+      return -1;
+    if(uarg == 0){
+      argv[i] = 0;
+80109500:	c7 84 9d 74 ff ff ff 	movl   $0x0,-0x8c(%ebp,%ebx,4)
+80109507:	00 00 00 00 
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+      return -1;
+  }
+  return exec(path, argv);
+8010950b:	83 ec 08             	sub    $0x8,%esp
+8010950e:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+80109514:	50                   	push   %eax
+80109515:	ff 75 f4             	push   -0xc(%ebp)
+80109518:	e8 24 7d ff ff       	call   80101241 <exec>
+8010951d:	83 c4 10             	add    $0x10,%esp
+80109520:	eb 56                	jmp    80109578 <sys_exec+0xd3>
+  for(i=0;; i++){
+80109522:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80109525:	83 fb 1f             	cmp    $0x1f,%ebx
+80109528:	77 49                	ja     80109573 <sys_exec+0xce>
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+8010952a:	83 ec 08             	sub    $0x8,%esp
+8010952d:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+80109533:	50                   	push   %eax
+80109534:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+8010953a:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+8010953d:	50                   	push   %eax
+8010953e:	e8 21 f3 ff ff       	call   80108864 <fetchint>
+80109543:	83 c4 10             	add    $0x10,%esp
+80109546:	85 c0                	test   %eax,%eax
+80109548:	78 33                	js     8010957d <sys_exec+0xd8>
+    if(uarg == 0){
+8010954a:	8b 85 6c ff ff ff    	mov    -0x94(%ebp),%eax
+80109550:	85 c0                	test   %eax,%eax
+80109552:	74 ac                	je     80109500 <sys_exec+0x5b>
+    if(fetchstr(uarg, &argv[i]) < 0)
+80109554:	83 ec 08             	sub    $0x8,%esp
+80109557:	8d 94 9d 74 ff ff ff 	lea    -0x8c(%ebp,%ebx,4),%edx
+8010955e:	52                   	push   %edx
+8010955f:	50                   	push   %eax
+80109560:	e8 53 f3 ff ff       	call   801088b8 <fetchstr>
+80109565:	83 c4 10             	add    $0x10,%esp
+80109568:	85 c0                	test   %eax,%eax
+8010956a:	79 b6                	jns    80109522 <sys_exec+0x7d>
+      return -1;
+8010956c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109571:	eb 05                	jmp    80109578 <sys_exec+0xd3>
+      return -1;
+80109573:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109578:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010957b:	c9                   	leave
+8010957c:	c3                   	ret
+      return -1;
+8010957d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109582:	eb f4                	jmp    80109578 <sys_exec+0xd3>
+
+80109584 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+80109584:	55                   	push   %ebp
+80109585:	89 e5                	mov    %esp,%ebp
+80109587:	53                   	push   %ebx
+80109588:	83 ec 18             	sub    $0x18,%esp
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+8010958b:	6a 08                	push   $0x8
+8010958d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109590:	50                   	push   %eax
+80109591:	6a 00                	push   $0x0
+80109593:	e8 5b f4 ff ff       	call   801089f3 <argptrw>
+80109598:	83 c4 10             	add    $0x10,%esp
+8010959b:	85 c0                	test   %eax,%eax
+8010959d:	78 77                	js     80109616 <sys_pipe+0x92>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+8010959f:	83 ec 08             	sub    $0x8,%esp
+801095a2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801095a5:	50                   	push   %eax
+801095a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801095a9:	50                   	push   %eax
+801095aa:	e8 0b c5 ff ff       	call   80105aba <pipealloc>
+801095af:	83 c4 10             	add    $0x10,%esp
+801095b2:	85 c0                	test   %eax,%eax
+801095b4:	78 67                	js     8010961d <sys_pipe+0x99>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+801095b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+801095b9:	e8 51 f5 ff ff       	call   80108b0f <fdalloc>
+801095be:	89 c3                	mov    %eax,%ebx
+801095c0:	85 c0                	test   %eax,%eax
+801095c2:	78 32                	js     801095f6 <sys_pipe+0x72>
+801095c4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+801095c7:	e8 43 f5 ff ff       	call   80108b0f <fdalloc>
+801095cc:	85 c0                	test   %eax,%eax
+801095ce:	78 15                	js     801095e5 <sys_pipe+0x61>
+      myproc()->ofile[fd0] = 0;
+    fileclose(rf);
+    fileclose(wf);
+    return -1;
+  }
+  fd[0] = fd0;
+801095d0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801095d3:	89 1a                	mov    %ebx,(%edx)
+  fd[1] = fd1;
+801095d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801095d8:	89 42 04             	mov    %eax,0x4(%edx)
+  return 0;
+801095db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801095e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801095e3:	c9                   	leave
+801095e4:	c3                   	ret
+      myproc()->ofile[fd0] = 0;
+801095e5:	e8 62 d3 ff ff       	call   8010694c <myproc>
+801095ea:	c1 e3 02             	shl    $0x2,%ebx
+801095ed:	03 58 30             	add    0x30(%eax),%ebx
+801095f0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    fileclose(rf);
+801095f6:	83 ec 0c             	sub    $0xc,%esp
+801095f9:	ff 75 f0             	push   -0x10(%ebp)
+801095fc:	e8 7a 82 ff ff       	call   8010187b <fileclose>
+    fileclose(wf);
+80109601:	83 c4 04             	add    $0x4,%esp
+80109604:	ff 75 ec             	push   -0x14(%ebp)
+80109607:	e8 6f 82 ff ff       	call   8010187b <fileclose>
+    return -1;
+8010960c:	83 c4 10             	add    $0x10,%esp
+8010960f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109614:	eb ca                	jmp    801095e0 <sys_pipe+0x5c>
+    return -1;
+80109616:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010961b:	eb c3                	jmp    801095e0 <sys_pipe+0x5c>
+    return -1;
+8010961d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109622:	eb bc                	jmp    801095e0 <sys_pipe+0x5c>
+
+80109624 <sys_pipesize>:
+
+// Grow the buffer of the pipe open as fd to at least n bytes.
+// Returns the new size.
+int
+sys_pipesize(void)
+{
+80109624:	55                   	push   %ebp
+80109625:	89 e5                	mov    %esp,%ebp
+80109627:	83 ec 18             	sub    $0x18,%esp
+  struct file *f;
+  int n;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &n) < 0)
+8010962a:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+8010962d:	ba 00 00 00 00       	mov    $0x0,%edx
+80109632:	b8 00 00 00 00       	mov    $0x0,%eax
+80109637:	e8 5c f4 ff ff       	call   80108a98 <argfd>
+8010963c:	85 c0                	test   %eax,%eax
+8010963e:	78 30                	js     80109670 <sys_pipesize+0x4c>
+80109640:	83 ec 08             	sub    $0x8,%esp
+80109643:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80109646:	50                   	push   %eax
+80109647:	6a 01                	push   $0x1
+80109649:	e8 dc f2 ff ff       	call   8010892a <argint>
+8010964e:	83 c4 10             	add    $0x10,%esp
+80109651:	85 c0                	test   %eax,%eax
+80109653:	78 1b                	js     80109670 <sys_pipesize+0x4c>
+    return -1;
+  if(f->type != FD_PIPE)
+80109655:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80109658:	83 38 01             	cmpl   $0x1,(%eax)
+8010965b:	75 1a                	jne    80109677 <sys_pipesize+0x53>
+    return -1;
+  return piperesize(f->pipe, n);
+8010965d:	83 ec 08             	sub    $0x8,%esp
+80109660:	ff 75 f0             	push   -0x10(%ebp)
+80109663:	ff 70 10             	push   0x10(%eax)
+80109666:	e8 4c c9 ff ff       	call   80105fb7 <piperesize>
+8010966b:	83 c4 10             	add    $0x10,%esp
+}
+8010966e:	c9                   	leave
+8010966f:	c3                   	ret
+    return -1;
+80109670:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109675:	eb f7                	jmp    8010966e <sys_pipesize+0x4a>
+    return -1;
+80109677:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010967c:	eb f0                	jmp    8010966e <sys_pipesize+0x4a>
+
+8010967e <sys_splice>:
+
+// Move up to n bytes from fd in to fd out inside the kernel,
+// where one of them is a pipe. Returns the number moved.
+int
+sys_splice(void)
+{
+8010967e:	55                   	push   %ebp
+8010967f:	89 e5                	mov    %esp,%ebp
+80109681:	83 ec 18             	sub    $0x18,%esp
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0)
+80109684:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80109687:	ba 00 00 00 00       	mov    $0x0,%edx
+8010968c:	b8 00 00 00 00       	mov    $0x0,%eax
+80109691:	e8 02 f4 ff ff       	call   80108a98 <argfd>
+80109696:	85 c0                	test   %eax,%eax
+80109698:	78 41                	js     801096db <sys_splice+0x5d>
+8010969a:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+8010969d:	ba 00 00 00 00       	mov    $0x0,%edx
+801096a2:	b8 01 00 00 00       	mov    $0x1,%eax
+801096a7:	e8 ec f3 ff ff       	call   80108a98 <argfd>
+801096ac:	85 c0                	test   %eax,%eax
+801096ae:	78 2b                	js     801096db <sys_splice+0x5d>
+801096b0:	83 ec 08             	sub    $0x8,%esp
+801096b3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801096b6:	50                   	push   %eax
+801096b7:	6a 02                	push   $0x2
+801096b9:	e8 6c f2 ff ff       	call   8010892a <argint>
+801096be:	83 c4 10             	add    $0x10,%esp
+801096c1:	85 c0                	test   %eax,%eax
+801096c3:	78 16                	js     801096db <sys_splice+0x5d>
+    return -1;
+  return filesplice(in, out, n);
+801096c5:	83 ec 04             	sub    $0x4,%esp
+801096c8:	ff 75 ec             	push   -0x14(%ebp)
+801096cb:	ff 75 f0             	push   -0x10(%ebp)
+801096ce:	ff 75 f4             	push   -0xc(%ebp)
+801096d1:	e8 cd 84 ff ff       	call   80101ba3 <filesplice>
+801096d6:	83 c4 10             	add    $0x10,%esp
+}
+801096d9:	c9                   	leave
+801096da:	c3                   	ret
+    return -1;
+801096db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801096e0:	eb f7                	jmp    801096d9 <sys_splice+0x5b>
+
+801096e2 <sys_fork>:
+#ifdef CS333_P2
+#include "uproc.h"
+#endif //CS333_P2
+int
+sys_fork(void)
+{
+801096e2:	55                   	push   %ebp
+801096e3:	89 e5                	mov    %esp,%ebp
+801096e5:	83 ec 08             	sub    $0x8,%esp
+  return fork();
+801096e8:	e8 f2 d4 ff ff       	call   80106bdf <fork>
+}
+801096ed:	c9                   	leave
+801096ee:	c3                   	ret
+
+801096ef <sys_exit>:
+
+int
+sys_exit(void)
+{
+801096ef:	55                   	push   %ebp
+801096f0:	89 e5                	mov    %esp,%ebp
+801096f2:	83 ec 08             	sub    $0x8,%esp
+  exit();
+801096f5:	e8 a5 de ff ff       	call   8010759f <exit>
+  return 0;  // not reached
+}
+801096fa:	b8 00 00 00 00       	mov    $0x0,%eax
+801096ff:	c9                   	leave
+80109700:	c3                   	ret
+
+80109701 <sys_wait>:
+
+int
+sys_wait(void)
+{
+80109701:	55                   	push   %ebp
+80109702:	89 e5                	mov    %esp,%ebp
+80109704:	83 ec 08             	sub    $0x8,%esp
+  return wait();
+80109707:	e8 87 e2 ff ff       	call   80107993 <wait>
+}
+8010970c:	c9                   	leave
+8010970d:	c3                   	ret
+
+8010970e <sys_kill>:
+
+int
+sys_kill(void)
+{
+8010970e:	55                   	push   %ebp
+8010970f:	89 e5                	mov    %esp,%ebp
+80109711:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80109714:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109717:	50                   	push   %eax
+80109718:	6a 00                	push   $0x0
+8010971a:	e8 0b f2 ff ff       	call   8010892a <argint>
+8010971f:	83 c4 10             	add    $0x10,%esp
+80109722:	85 c0                	test   %eax,%eax
+80109724:	78 10                	js     80109736 <sys_kill+0x28>
+    return -1;
+  return kill(pid);
+80109726:	83 ec 0c             	sub    $0xc,%esp
+80109729:	ff 75 f4             	push   -0xc(%ebp)
+8010972c:	e8 be d7 ff ff       	call   80106eef <kill>
+80109731:	83 c4 10             	add    $0x10,%esp
+}
+80109734:	c9                   	leave
+80109735:	c3                   	ret
+    return -1;
+80109736:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010973b:	eb f7                	jmp    80109734 <sys_kill+0x26>
+
+8010973d <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+8010973d:	55                   	push   %ebp
+8010973e:	89 e5                	mov    %esp,%ebp
+80109740:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80109743:	e8 04 d2 ff ff       	call   8010694c <myproc>
+80109748:	8b 40 10             	mov    0x10(%eax),%eax
+}
+8010974b:	c9                   	leave
+8010974c:	c3                   	ret
+
+8010974d <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+8010974d:	55                   	push   %ebp
+8010974e:	89 e5                	mov    %esp,%ebp
+80109750:	53                   	push   %ebx
+80109751:	83 ec 1c             	sub    $0x1c,%esp
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80109754:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109757:	50                   	push   %eax
+80109758:	6a 00                	push   $0x0
+8010975a:	e8 cb f1 ff ff       	call   8010892a <argint>
+8010975f:	83 c4 10             	add    $0x10,%esp
+80109762:	85 c0                	test   %eax,%eax
+80109764:	78 20                	js     80109786 <sys_sbrk+0x39>
+    return -1;
+  addr = myproc()->sz;
+80109766:	e8 e1 d1 ff ff       	call   8010694c <myproc>
+8010976b:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+8010976d:	83 ec 0c             	sub    $0xc,%esp
+80109770:	ff 75 f4             	push   -0xc(%ebp)
+80109773:	e8 fd d3 ff ff       	call   80106b75 <growproc>
+80109778:	83 c4 10             	add    $0x10,%esp
+8010977b:	85 c0                	test   %eax,%eax
+8010977d:	78 0e                	js     8010978d <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+8010977f:	89 d8                	mov    %ebx,%eax
+80109781:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109784:	c9                   	leave
+80109785:	c3                   	ret
+    return -1;
+80109786:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010978b:	eb f2                	jmp    8010977f <sys_sbrk+0x32>
+    return -1;
+8010978d:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80109792:	eb eb                	jmp    8010977f <sys_sbrk+0x32>
+
+80109794 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80109794:	55                   	push   %ebp
+80109795:	89 e5                	mov    %esp,%ebp
+80109797:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+8010979a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010979d:	50                   	push   %eax
+8010979e:	6a 00                	push   $0x0
+801097a0:	e8 85 f1 ff ff       	call   8010892a <argint>
+801097a5:	83 c4 10             	add    $0x10,%esp
+801097a8:	85 c0                	test   %eax,%eax
+801097aa:	78 15                	js     801097c1 <sys_sleep+0x2d>
+    return -1;
+  if(n <= 0)
+801097ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801097af:	85 c0                	test   %eax,%eax
+801097b1:	7e 15                	jle    801097c8 <sys_sleep+0x34>
+    return 0;
+  return sleepticks(n);
+801097b3:	83 ec 0c             	sub    $0xc,%esp
+801097b6:	50                   	push   %eax
+801097b7:	e8 a7 e3 ff ff       	call   80107b63 <sleepticks>
+801097bc:	83 c4 10             	add    $0x10,%esp
+}
+801097bf:	c9                   	leave
+801097c0:	c3                   	ret
+    return -1;
+801097c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801097c6:	eb f7                	jmp    801097bf <sys_sleep+0x2b>
+    return 0;
+801097c8:	b8 00 00 00 00       	mov    $0x0,%eax
+801097cd:	eb f0                	jmp    801097bf <sys_sleep+0x2b>
+
+801097cf <sys_uptime>:
+{
+  uint xticks;
+
+  xticks = ticks;
+  return xticks;
+}
+801097cf:	a1 60 f3 13 80       	mov    0x8013f360,%eax
+801097d4:	c3                   	ret
+
+801097d5 <sys_halt>:
+
+#ifdef PDX_XV6
+// shutdown QEMU
+int
+sys_halt(void)
+{
+801097d5:	55                   	push   %ebp
+801097d6:	89 e5                	mov    %esp,%ebp
+801097d8:	83 ec 08             	sub    $0x8,%esp
+  do_shutdown();  // never returns
+801097db:	e8 03 78 ff ff       	call   80100fe3 <do_shutdown>
+  return 0;
+}
+801097e0:	b8 00 00 00 00       	mov    $0x0,%eax
+801097e5:	c9                   	leave
+801097e6:	c3                   	ret
+
+801097e7 <sys_date>:
+
+#ifdef CS333_P1
+
+int
+sys_date(void)
+{
+801097e7:	55                   	push   %ebp
+801097e8:	89 e5                	mov    %esp,%ebp
+801097ea:	83 ec 1c             	sub    $0x1c,%esp
+  struct rtcdate *d;
+
+  if(argptrw(0, (void*)&d, sizeof(struct rtcdate)) < 0)
+801097ed:	6a 18                	push   $0x18
+801097ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801097f2:	50                   	push   %eax
+801097f3:	6a 00                	push   $0x0
+801097f5:	e8 f9 f1 ff ff       	call   801089f3 <argptrw>
+801097fa:	83 c4 10             	add    $0x10,%esp
+801097fd:	85 c0                	test   %eax,%eax
+801097ff:	78 15                	js     80109816 <sys_date+0x2f>
+    return -1;
+  cmostime(d);
+80109801:	83 ec 0c             	sub    $0xc,%esp
+80109804:	ff 75 f4             	push   -0xc(%ebp)
+80109807:	e8 bb b6 ff ff       	call   80104ec7 <cmostime>
+  return 0;
+8010980c:	83 c4 10             	add    $0x10,%esp
+8010980f:	b8 00 00 00 00       	mov    $0x0,%eax
+
+}
+80109814:	c9                   	leave
+80109815:	c3                   	ret
+    return -1;
+80109816:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010981b:	eb f7                	jmp    80109814 <sys_date+0x2d>
+
+8010981d <sys_getuid>:
+#endif //CS333_P1
+#ifdef CS333_P2
+int
+sys_getuid(void)
+{
+8010981d:	55                   	push   %ebp
+8010981e:	89 e5                	mov    %esp,%ebp
+80109820:	83 ec 08             	sub    $0x8,%esp
+  uint uid;
+  
+  uid = myproc()->uid;  
+80109823:	e8 24 d1 ff ff       	call   8010694c <myproc>
+80109828:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  return uid;	
+}
+8010982e:	c9                   	leave
+8010982f:	c3                   	ret
+
+80109830 <sys_getgid>:
+
+int
+sys_getgid(void)
+{
+80109830:	55                   	push   %ebp
+80109831:	89 e5                	mov    %esp,%ebp
+80109833:	83 ec 08             	sub    $0x8,%esp
+  uint gid;
+
+  gid = myproc()->gid;
+80109836:	e8 11 d1 ff ff       	call   8010694c <myproc>
+8010983b:	8b 80 d8 00 00 00    	mov    0xd8(%eax),%eax
+  return gid;
+}
+80109841:	c9                   	leave
+80109842:	c3                   	ret
+
+80109843 <sys_getppid>:
+int
+sys_getppid(void)
+{
+80109843:	55                   	push   %ebp
+80109844:	89 e5                	mov    %esp,%ebp
+80109846:	83 ec 08             	sub    $0x8,%esp
+  uint ppid;
+  
+  if(myproc()->parent != NULL)
+80109849:	e8 fe d0 ff ff       	call   8010694c <myproc>
+8010984e:	83 78 1c 00          	cmpl   $0x0,0x1c(%eax)
+80109852:	74 0d                	je     80109861 <sys_getppid+0x1e>
+    ppid = myproc()->parent->pid;
+80109854:	e8 f3 d0 ff ff       	call   8010694c <myproc>
+80109859:	8b 40 1c             	mov    0x1c(%eax),%eax
+8010985c:	8b 40 10             	mov    0x10(%eax),%eax
+  else
+    ppid = myproc()->pid;
+  return ppid;
+}
+8010985f:	c9                   	leave
+80109860:	c3                   	ret
+    ppid = myproc()->pid;
+80109861:	e8 e6 d0 ff ff       	call   8010694c <myproc>
+80109866:	8b 40 10             	mov    0x10(%eax),%eax
+80109869:	eb f4                	jmp    8010985f <sys_getppid+0x1c>
+
+8010986b <sys_setuid>:
+
+int
+sys_setuid(void)
+{
+8010986b:	55                   	push   %ebp
+8010986c:	89 e5                	mov    %esp,%ebp
+8010986e:	53                   	push   %ebx
+8010986f:	83 ec 1c             	sub    $0x1c,%esp
+  int uid;
+  if(argint(0, &uid) < 0)
+80109872:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109875:	50                   	push   %eax
+80109876:	6a 00                	push   $0x0
+80109878:	e8 ad f0 ff ff       	call   8010892a <argint>
+8010987d:	83 c4 10             	add    $0x10,%esp
+80109880:	85 c0                	test   %eax,%eax
+80109882:	78 20                	js     801098a4 <sys_setuid+0x39>
+    return -1;	  
+  if(uid < 0 || uid > 32767)
+80109884:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+80109887:	81 fb ff 7f 00 00    	cmp    $0x7fff,%ebx
+8010988d:	77 1c                	ja     801098ab <sys_setuid+0x40>
+    return -1;
+  else{
+    myproc()->uid = uid;
+8010988f:	e8 b8 d0 ff ff       	call   8010694c <myproc>
+80109894:	89 98 d4 00 00 00    	mov    %ebx,0xd4(%eax)
+    return 0;
+8010989a:	b8 00 00 00 00       	mov    $0x0,%eax
+    }    
+}
+8010989f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801098a2:	c9                   	leave
+801098a3:	c3                   	ret
+    return -1;	  
+801098a4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801098a9:	eb f4                	jmp    8010989f <sys_setuid+0x34>
+    return -1;
+801098ab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801098b0:	eb ed                	jmp    8010989f <sys_setuid+0x34>
+
+801098b2 <sys_setgid>:
+
+int
+sys_setgid(void)
+{
+801098b2:	55                   	push   %ebp
+801098b3:	89 e5                	mov    %esp,%ebp
+801098b5:	53                   	push   %ebx
+801098b6:	83 ec 1c             	sub    $0x1c,%esp
+  int gid;
+
+  if(argint(0, &gid) < 0)
+801098b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801098bc:	50                   	push   %eax
+801098bd:	6a 00                	push   $0x0
+801098bf:	e8 66 f0 ff ff       	call   8010892a <argint>
+801098c4:	83 c4 10             	add    $0x10,%esp
+801098c7:	85 c0                	test   %eax,%eax
+801098c9:	78 20                	js     801098eb <sys_setgid+0x39>
+    return -1;	  
+  if(gid < 0 || gid > 32767)
+801098cb:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+801098ce:	81 fb ff 7f 00 00    	cmp    $0x7fff,%ebx
+801098d4:	77 1c                	ja     801098f2 <sys_setgid+0x40>
+    return -1;
+
+  else{
+    myproc()->gid = gid;
+801098d6:	e8 71 d0 ff ff       	call   8010694c <myproc>
+801098db:	89 98 d8 00 00 00    	mov    %ebx,0xd8(%eax)
+    return 0;
+801098e1:	b8 00 00 00 00       	mov    $0x0,%eax
+    }    
+}
+801098e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801098e9:	c9                   	leave
+801098ea:	c3                   	ret
+    return -1;	  
+801098eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801098f0:	eb f4                	jmp    801098e6 <sys_setgid+0x34>
+    return -1;
+801098f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801098f7:	eb ed                	jmp    801098e6 <sys_setgid+0x34>
+
+801098f9 <sys_getprocs>:
+int
+sys_getprocs(void)
+{
+801098f9:	55                   	push   %ebp
+801098fa:	89 e5                	mov    %esp,%ebp
+801098fc:	83 ec 20             	sub    $0x20,%esp
+  int max;
+  struct uproc *up;
+  if(argint(0, &max) < 0)
+801098ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109902:	50                   	push   %eax
+80109903:	6a 00                	push   $0x0
+80109905:	e8 20 f0 ff ff       	call   8010892a <argint>
+8010990a:	83 c4 10             	add    $0x10,%esp
+8010990d:	85 c0                	test   %eax,%eax
+8010990f:	78 4a                	js     8010995b <sys_getprocs+0x62>
+    return -1;
+  if((argptrw(1, (void*)&up, max*sizeof(*up))< 0))
+80109911:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80109914:	8d 04 40             	lea    (%eax,%eax,2),%eax
+80109917:	c1 e0 05             	shl    $0x5,%eax
+8010991a:	83 ec 04             	sub    $0x4,%esp
+8010991d:	50                   	push   %eax
+8010991e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80109921:	50                   	push   %eax
+80109922:	6a 01                	push   $0x1
+80109924:	e8 ca f0 ff ff       	call   801089f3 <argptrw>
+80109929:	83 c4 10             	add    $0x10,%esp
+8010992c:	85 c0                	test   %eax,%eax
+8010992e:	78 32                	js     80109962 <sys_getprocs+0x69>
+    return -1;
+  if(max <= 64)	  
+80109930:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80109933:	83 f8 40             	cmp    $0x40,%eax
+80109936:	7f 11                	jg     80109949 <sys_getprocs+0x50>
+    return getprocs(max, up);
+80109938:	83 ec 08             	sub    $0x8,%esp
+8010993b:	ff 75 f0             	push   -0x10(%ebp)
+8010993e:	50                   	push   %eax
+8010993f:	e8 64 d6 ff ff       	call   80106fa8 <getprocs>
+80109944:	83 c4 10             	add    $0x10,%esp
+  else
+    return getprocs(64, up);	  
+}
+80109947:	c9                   	leave
+80109948:	c3                   	ret
+    return getprocs(64, up);	  
+80109949:	83 ec 08             	sub    $0x8,%esp
+8010994c:	ff 75 f0             	push   -0x10(%ebp)
+8010994f:	6a 40                	push   $0x40
+80109951:	e8 52 d6 ff ff       	call   80106fa8 <getprocs>
+80109956:	83 c4 10             	add    $0x10,%esp
+80109959:	eb ec                	jmp    80109947 <sys_getprocs+0x4e>
+    return -1;
+8010995b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109960:	eb e5                	jmp    80109947 <sys_getprocs+0x4e>
+    return -1;
+80109962:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109967:	eb de                	jmp    80109947 <sys_getprocs+0x4e>
+
+80109969 <sys_getpriority>:
+#endif //CS333_P2
+
+#ifdef CS333_P4
+int
+sys_getpriority(void)
+{
+80109969:	55                   	push   %ebp
+8010996a:	89 e5                	mov    %esp,%ebp
+8010996c:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+  if(argint(0, &pid) < 0)
+8010996f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109972:	50                   	push   %eax
+80109973:	6a 00                	push   $0x0
+80109975:	e8 b0 ef ff ff       	call   8010892a <argint>
+8010997a:	83 c4 10             	add    $0x10,%esp
+8010997d:	85 c0                	test   %eax,%eax
+8010997f:	78 10                	js     80109991 <sys_getpriority+0x28>
+    return -1;
+  return getpriority(pid);
+80109981:	83 ec 0c             	sub    $0xc,%esp
+80109984:	ff 75 f4             	push   -0xc(%ebp)
+80109987:	e8 57 d9 ff ff       	call   801072e3 <getpriority>
+8010998c:	83 c4 10             	add    $0x10,%esp
+
+}
+8010998f:	c9                   	leave
+80109990:	c3                   	ret
+    return -1;
+80109991:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109996:	eb f7                	jmp    8010998f <sys_getpriority+0x26>
+
+80109998 <sys_setpriority>:
+
+int
+sys_setpriority(void)
+{
+80109998:	55                   	push   %ebp
+80109999:	89 e5                	mov    %esp,%ebp
+8010999b:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+  int priority;
+  if(argint(0, &pid) < 0)
+8010999e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801099a1:	50                   	push   %eax
+801099a2:	6a 00                	push   $0x0
+801099a4:	e8 81 ef ff ff       	call   8010892a <argint>
+801099a9:	83 c4 10             	add    $0x10,%esp
+801099ac:	85 c0                	test   %eax,%eax
+801099ae:	78 33                	js     801099e3 <sys_setpriority+0x4b>
+    return -1;
+  if(argint(1, &priority) < 0)
+801099b0:	83 ec 08             	sub    $0x8,%esp
+801099b3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801099b6:	50                   	push   %eax
+801099b7:	6a 01                	push   $0x1
+801099b9:	e8 6c ef ff ff       	call   8010892a <argint>
+801099be:	83 c4 10             	add    $0x10,%esp
+801099c1:	85 c0                	test   %eax,%eax
+801099c3:	78 25                	js     801099ea <sys_setpriority+0x52>
+    return -1;
+  if(priority > MAXPRIO || priority < 0 || pid < 0)
+801099c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+801099c8:	83 f8 06             	cmp    $0x6,%eax
+801099cb:	77 24                	ja     801099f1 <sys_setpriority+0x59>
+801099cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801099d0:	85 d2                	test   %edx,%edx
+801099d2:	78 24                	js     801099f8 <sys_setpriority+0x60>
+    return -1;
+ 
+  return setpriority(pid, priority);
+801099d4:	83 ec 08             	sub    $0x8,%esp
+801099d7:	50                   	push   %eax
+801099d8:	52                   	push   %edx
+801099d9:	e8 7b d9 ff ff       	call   80107359 <setpriority>
+801099de:	83 c4 10             	add    $0x10,%esp
+}
+801099e1:	c9                   	leave
+801099e2:	c3                   	ret
+    return -1;
+801099e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801099e8:	eb f7                	jmp    801099e1 <sys_setpriority+0x49>
+    return -1;
+801099ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801099ef:	eb f0                	jmp    801099e1 <sys_setpriority+0x49>
+    return -1;
+801099f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801099f6:	eb e9                	jmp    801099e1 <sys_setpriority+0x49>
+801099f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801099fd:	eb e2                	jmp    801099e1 <sys_setpriority+0x49>
+
+801099ff <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+801099ff:	1e                   	push   %ds
+  pushl %es
+80109a00:	06                   	push   %es
+  pushl %fs
+80109a01:	0f a0                	push   %fs
+  pushl %gs
+80109a03:	0f a8                	push   %gs
+  pushal
+80109a05:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+80109a06:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+80109a0a:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80109a0c:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+80109a0e:	54                   	push   %esp
+  call trap
+80109a0f:	e8 1f 01 00 00       	call   80109b33 <trap>
+  addl $4, %esp
+80109a14:	83 c4 04             	add    $0x4,%esp
+
+80109a17 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80109a17:	61                   	popa
+  popl %gs
+80109a18:	0f a9                	pop    %gs
+  popl %fs
+80109a1a:	0f a1                	pop    %fs
+  popl %es
+80109a1c:	07                   	pop    %es
+  popl %ds
+80109a1d:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80109a1e:	83 c4 08             	add    $0x8,%esp
+  iret
+80109a21:	cf                   	iret
+
+80109a22 <tvinit>:
+uint ticks;
+#endif // PDX_XV6
+
+void
+tvinit(void)
+{
+80109a22:	55                   	push   %ebp
+80109a23:	89 e5                	mov    %esp,%ebp
+80109a25:	53                   	push   %ebx
+  int i;
+
+  for(i = 0; i < 256; i++)
+80109a26:	b8 00 00 00 00       	mov    $0x0,%eax
+80109a2b:	eb 76                	jmp    80109aa3 <tvinit+0x81>
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80109a2d:	8b 0c 85 08 f0 10 80 	mov    -0x7fef0ff8(,%eax,4),%ecx
+80109a34:	66 89 0c c5 80 f3 13 	mov    %cx,-0x7fec0c80(,%eax,8)
+80109a3b:	80 
+80109a3c:	66 c7 04 c5 82 f3 13 	movw   $0x8,-0x7fec0c7e(,%eax,8)
+80109a43:	80 08 00 
+80109a46:	0f b6 14 c5 84 f3 13 	movzbl -0x7fec0c7c(,%eax,8),%edx
+80109a4d:	80 
+80109a4e:	83 e2 e0             	and    $0xffffffe0,%edx
+80109a51:	88 14 c5 84 f3 13 80 	mov    %dl,-0x7fec0c7c(,%eax,8)
+80109a58:	c6 04 c5 84 f3 13 80 	movb   $0x0,-0x7fec0c7c(,%eax,8)
+80109a5f:	00 
+80109a60:	0f b6 14 c5 85 f3 13 	movzbl -0x7fec0c7b(,%eax,8),%edx
+80109a67:	80 
+80109a68:	83 e2 f0             	and    $0xfffffff0,%edx
+80109a6b:	83 ca 0e             	or     $0xe,%edx
+80109a6e:	88 14 c5 85 f3 13 80 	mov    %dl,-0x7fec0c7b(,%eax,8)
+80109a75:	89 d3                	mov    %edx,%ebx
+80109a77:	83 e3 ef             	and    $0xffffffef,%ebx
+80109a7a:	88 1c c5 85 f3 13 80 	mov    %bl,-0x7fec0c7b(,%eax,8)
+80109a81:	83 e2 8f             	and    $0xffffff8f,%edx
+80109a84:	88 14 c5 85 f3 13 80 	mov    %dl,-0x7fec0c7b(,%eax,8)
+80109a8b:	83 ca 80             	or     $0xffffff80,%edx
+80109a8e:	88 14 c5 85 f3 13 80 	mov    %dl,-0x7fec0c7b(,%eax,8)
+80109a95:	c1 e9 10             	shr    $0x10,%ecx
+80109a98:	66 89 0c c5 86 f3 13 	mov    %cx,-0x7fec0c7a(,%eax,8)
+80109a9f:	80 
+  for(i = 0; i < 256; i++)
+80109aa0:	83 c0 01             	add    $0x1,%eax
+80109aa3:	3d ff 00 00 00       	cmp    $0xff,%eax
+80109aa8:	7e 83                	jle    80109a2d <tvinit+0xb>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80109aaa:	8b 15 08 f1 10 80    	mov    0x8010f108,%edx
+80109ab0:	66 89 15 80 f5 13 80 	mov    %dx,0x8013f580
+80109ab7:	66 c7 05 82 f5 13 80 	movw   $0x8,0x8013f582
+80109abe:	08 00 
+80109ac0:	0f b6 05 84 f5 13 80 	movzbl 0x8013f584,%eax
+80109ac7:	83 e0 e0             	and    $0xffffffe0,%eax
+80109aca:	a2 84 f5 13 80       	mov    %al,0x8013f584
+80109acf:	c6 05 84 f5 13 80 00 	movb   $0x0,0x8013f584
+80109ad6:	0f b6 05 85 f5 13 80 	movzbl 0x8013f585,%eax
+80109add:	83 c8 0f             	or     $0xf,%eax
+80109ae0:	a2 85 f5 13 80       	mov    %al,0x8013f585
+80109ae5:	83 e0 ef             	and    $0xffffffef,%eax
+80109ae8:	a2 85 f5 13 80       	mov    %al,0x8013f585
+80109aed:	89 c1                	mov    %eax,%ecx
+80109aef:	83 c9 60             	or     $0x60,%ecx
+80109af2:	88 0d 85 f5 13 80    	mov    %cl,0x8013f585
+80109af8:	83 c8 e0             	or     $0xffffffe0,%eax
+80109afb:	a2 85 f5 13 80       	mov    %al,0x8013f585
+80109b00:	c1 ea 10             	shr    $0x10,%edx
+80109b03:	66 89 15 86 f5 13 80 	mov    %dx,0x8013f586
+
+#ifndef PDX_XV6
+  initlock(&tickslock, "time");
+#endif // PDX_XV6
+}
+80109b0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109b0d:	c9                   	leave
+80109b0e:	c3                   	ret
+
+80109b0f <idtinit>:
+
+void
+idtinit(void)
+{
+80109b0f:	55                   	push   %ebp
+80109b10:	89 e5                	mov    %esp,%ebp
+80109b12:	83 ec 10             	sub    $0x10,%esp
+  pd[0] = size-1;
+80109b15:	66 c7 45 fa ff 07    	movw   $0x7ff,-0x6(%ebp)
+  pd[1] = (uint)p;
+80109b1b:	b8 80 f3 13 80       	mov    $0x8013f380,%eax
+80109b20:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80109b24:	c1 e8 10             	shr    $0x10,%eax
+80109b27:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+80109b2b:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80109b2e:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80109b31:	c9                   	leave
+80109b32:	c3                   	ret
+
+80109b33 <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80109b33:	55                   	push   %ebp
+80109b34:	89 e5                	mov    %esp,%ebp
+80109b36:	57                   	push   %edi
+80109b37:	56                   	push   %esi
+80109b38:	53                   	push   %ebx
+80109b39:	83 ec 1c             	sub    $0x1c,%esp
+80109b3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+80109b3f:	8b 43 30             	mov    0x30(%ebx),%eax
+80109b42:	83 f8 40             	cmp    $0x40,%eax
+80109b45:	74 13                	je     80109b5a <trap+0x27>
+    if(myproc()->killed)
+      exit();
+    return;
+  }
+
+  switch(tf->trapno){
+80109b47:	8d 50 f2             	lea    -0xe(%eax),%edx
+80109b4a:	83 fa 31             	cmp    $0x31,%edx
+80109b4d:	0f 87 f5 00 00 00    	ja     80109c48 <trap+0x115>
+80109b53:	ff 24 95 7c ca 10 80 	jmp    *-0x7fef3584(,%edx,4)
+    if(myproc()->killed)
+80109b5a:	e8 ed cd ff ff       	call   8010694c <myproc>
+80109b5f:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80109b63:	75 26                	jne    80109b8b <trap+0x58>
+    myproc()->tf = tf;
+80109b65:	e8 e2 cd ff ff       	call   8010694c <myproc>
+80109b6a:	89 58 20             	mov    %ebx,0x20(%eax)
+    syscall();
+80109b6d:	e8 cc ee ff ff       	call   80108a3e <syscall>
+    if(myproc()->killed)
+80109b72:	e8 d5 cd ff ff       	call   8010694c <myproc>
+80109b77:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80109b7b:	0f 84 97 01 00 00    	je     80109d18 <trap+0x1e5>
+      exit();
+80109b81:	e8 19 da ff ff       	call   8010759f <exit>
+    return;
+80109b86:	e9 8d 01 00 00       	jmp    80109d18 <trap+0x1e5>
+      exit();
+80109b8b:	e8 0f da ff ff       	call   8010759f <exit>
+80109b90:	eb d3                	jmp    80109b65 <trap+0x32>
+  case T_IRQ0 + IRQ_TIMER:
+    if(cpuid() == 0){
+80109b92:	e8 9a cd ff ff       	call   80106931 <cpuid>
+80109b97:	85 c0                	test   %eax,%eax
+80109b99:	74 0a                	je     80109ba5 <trap+0x72>
+      ticks++;
+      timertick(ticks);
+      release(&tickslock);
+#endif // PDX_XV6
+    }
+    lapiceoi();
+80109b9b:	e8 6a b2 ff ff       	call   80104e0a <lapiceoi>
+    break;
+80109ba0:	e9 11 01 00 00       	jmp    80109cb6 <trap+0x183>
+// atom_inc() necessary for removal of tickslock
+// other atomic ops added for completeness
+static inline void
+atom_inc(volatile int *num)
+{
+  asm volatile ( "lock incl %0" : "=m" (*num));
+80109ba5:	f0 ff 05 60 f3 13 80 	lock incl 0x8013f360
+      timertick(ticks);
+80109bac:	83 ec 0c             	sub    $0xc,%esp
+80109baf:	ff 35 60 f3 13 80    	push   0x8013f360
+80109bb5:	e8 b8 d2 ff ff       	call   80106e72 <timertick>
+80109bba:	83 c4 10             	add    $0x10,%esp
+80109bbd:	eb dc                	jmp    80109b9b <trap+0x68>
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+80109bbf:	e8 1b a7 ff ff       	call   801042df <ideintr>
+    lapiceoi();
+80109bc4:	e8 41 b2 ff ff       	call   80104e0a <lapiceoi>
+    break;
+80109bc9:	e9 e8 00 00 00       	jmp    80109cb6 <trap+0x183>
+  case T_IRQ0 + IRQ_PCI0:
+  case T_IRQ0 + IRQ_PCI1:
+  case T_IRQ0 + IRQ_PCI2:
+    virtiointr(tf->trapno - T_IRQ0);
+80109bce:	83 e8 20             	sub    $0x20,%eax
+80109bd1:	83 ec 0c             	sub    $0xc,%esp
+80109bd4:	50                   	push   %eax
+80109bd5:	e8 a5 12 00 00       	call   8010ae7f <virtiointr>
+    lapiceoi();
+80109bda:	e8 2b b2 ff ff       	call   80104e0a <lapiceoi>
+    break;
+80109bdf:	83 c4 10             	add    $0x10,%esp
+80109be2:	e9 cf 00 00 00       	jmp    80109cb6 <trap+0x183>
+  case T_IRQ0 + IRQ_IDE+1:
+    // Bochs generates spurious IDE1 interrupts.
+    break;
+  case T_IRQ0 + IRQ_KBD:
+    kbdintr();
+80109be7:	e8 68 b0 ff ff       	call   80104c54 <kbdintr>
+    lapiceoi();
+80109bec:	e8 19 b2 ff ff       	call   80104e0a <lapiceoi>
+    break;
+80109bf1:	e9 c0 00 00 00       	jmp    80109cb6 <trap+0x183>
+  case T_IRQ0 + IRQ_COM1:
+    uartintr();
+80109bf6:	e8 ce 02 00 00       	call   80109ec9 <uartintr>
+    lapiceoi();
+80109bfb:	e8 0a b2 ff ff       	call   80104e0a <lapiceoi>
+    break;
+80109c00:	e9 b1 00 00 00       	jmp    80109cb6 <trap+0x183>
+  case T_IRQ0 + 7:
+  case T_IRQ0 + IRQ_SPURIOUS:
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80109c05:	8b 7b 38             	mov    0x38(%ebx),%edi
+            cpuid(), tf->cs, tf->eip);
+80109c08:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80109c0c:	e8 20 cd ff ff       	call   80106931 <cpuid>
+80109c11:	57                   	push   %edi
+80109c12:	0f b7 f6             	movzwl %si,%esi
+80109c15:	56                   	push   %esi
+80109c16:	50                   	push   %eax
+80109c17:	68 dc c9 10 80       	push   $0x8010c9dc
+80109c1c:	e8 96 72 ff ff       	call   80100eb7 <cprintf>
+    lapiceoi();
+80109c21:	e8 e4 b1 ff ff       	call   80104e0a <lapiceoi>
+    break;
+80109c26:	83 c4 10             	add    $0x10,%esp
+80109c29:	e9 88 00 00 00       	jmp    80109cb6 <trap+0x183>
+  case T_PGFLT:
+    // Only user code faults on user memory; system calls
+    // fault their buffers in up front (see prefault).
+    // Reading the page in may sleep, so let interrupts in,
+    // once cr2 is safe.
+    if(myproc() && (tf->cs&3) == DPL_USER){
+80109c2e:	e8 19 cd ff ff       	call   8010694c <myproc>
+80109c33:	85 c0                	test   %eax,%eax
+80109c35:	74 11                	je     80109c48 <trap+0x115>
+80109c37:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109c3b:	83 e0 03             	and    $0x3,%eax
+80109c3e:	66 83 f8 03          	cmp    $0x3,%ax
+80109c42:	0f 84 d8 00 00 00    	je     80109d20 <trap+0x1ed>
+    }
+    // fall through
+
+  //PAGEBREAK: 13
+  default:
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80109c48:	e8 ff cc ff ff       	call   8010694c <myproc>
+80109c4d:	85 c0                	test   %eax,%eax
+80109c4f:	0f 84 f2 00 00 00    	je     80109d47 <trap+0x214>
+80109c55:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80109c59:	0f 84 e8 00 00 00    	je     80109d47 <trap+0x214>
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80109c5f:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+              tf->trapno, cpuid(), tf->eip, rcr2());
+      panic("trap");
+    }
+    // In user space, assume process misbehaved.
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109c62:	8b 43 38             	mov    0x38(%ebx),%eax
+80109c65:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80109c68:	e8 c4 cc ff ff       	call   80106931 <cpuid>
+80109c6d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80109c70:	8b 4b 34             	mov    0x34(%ebx),%ecx
+80109c73:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+80109c76:	8b 73 30             	mov    0x30(%ebx),%esi
+            "eip 0x%x addr 0x%x--kill proc\n",
+            myproc()->pid, myproc()->name, tf->trapno,
+80109c79:	e8 ce cc ff ff       	call   8010694c <myproc>
+80109c7e:	8d 90 b4 00 00 00    	lea    0xb4(%eax),%edx
+80109c84:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80109c87:	e8 c0 cc ff ff       	call   8010694c <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109c8c:	57                   	push   %edi
+80109c8d:	ff 75 e4             	push   -0x1c(%ebp)
+80109c90:	ff 75 e0             	push   -0x20(%ebp)
+80109c93:	ff 75 dc             	push   -0x24(%ebp)
+80109c96:	56                   	push   %esi
+80109c97:	ff 75 d8             	push   -0x28(%ebp)
+80109c9a:	ff 70 10             	push   0x10(%eax)
+80109c9d:	68 34 ca 10 80       	push   $0x8010ca34
+80109ca2:	e8 10 72 ff ff       	call   80100eb7 <cprintf>
+            tf->err, cpuid(), tf->eip, rcr2());
+    myproc()->killed = 1;
+80109ca7:	83 c4 20             	add    $0x20,%esp
+80109caa:	e8 9d cc ff ff       	call   8010694c <myproc>
+80109caf:	c7 40 2c 01 00 00 00 	movl   $0x1,0x2c(%eax)
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109cb6:	e8 91 cc ff ff       	call   8010694c <myproc>
+80109cbb:	85 c0                	test   %eax,%eax
+80109cbd:	74 1c                	je     80109cdb <trap+0x1a8>
+80109cbf:	e8 88 cc ff ff       	call   8010694c <myproc>
+80109cc4:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80109cc8:	74 11                	je     80109cdb <trap+0x1a8>
+80109cca:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109cce:	83 e0 03             	and    $0x3,%eax
+80109cd1:	66 83 f8 03          	cmp    $0x3,%ax
+80109cd5:	0f 84 97 00 00 00    	je     80109d72 <trap+0x23f>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+80109cdb:	e8 6c cc ff ff       	call   8010694c <myproc>
+80109ce0:	85 c0                	test   %eax,%eax
+80109ce2:	74 0f                	je     80109cf3 <trap+0x1c0>
+80109ce4:	e8 63 cc ff ff       	call   8010694c <myproc>
+80109ce9:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80109ced:	0f 84 89 00 00 00    	je     80109d7c <trap+0x249>
+    tf->trapno == T_IRQ0+IRQ_TIMER)
+#endif // PDX_XV6
+    yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109cf3:	e8 54 cc ff ff       	call   8010694c <myproc>
+80109cf8:	85 c0                	test   %eax,%eax
+80109cfa:	74 1c                	je     80109d18 <trap+0x1e5>
+80109cfc:	e8 4b cc ff ff       	call   8010694c <myproc>
+80109d01:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80109d05:	74 11                	je     80109d18 <trap+0x1e5>
+80109d07:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109d0b:	83 e0 03             	and    $0x3,%eax
+80109d0e:	66 83 f8 03          	cmp    $0x3,%ax
+80109d12:	0f 84 97 00 00 00    	je     80109daf <trap+0x27c>
+    exit();
+}
+80109d18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109d1b:	5b                   	pop    %ebx
+80109d1c:	5e                   	pop    %esi
+80109d1d:	5f                   	pop    %edi
+80109d1e:	5d                   	pop    %ebp
+80109d1f:	c3                   	ret
+80109d20:	0f 20 d6             	mov    %cr2,%esi
+  asm volatile("sti");
+80109d23:	fb                   	sti
+      if(pagefault(myproc(), va, tf->err) == 0)
+80109d24:	8b 7b 34             	mov    0x34(%ebx),%edi
+80109d27:	e8 20 cc ff ff       	call   8010694c <myproc>
+80109d2c:	83 ec 04             	sub    $0x4,%esp
+80109d2f:	57                   	push   %edi
+80109d30:	56                   	push   %esi
+80109d31:	50                   	push   %eax
+80109d32:	e8 13 1d 00 00       	call   8010ba4a <pagefault>
+80109d37:	83 c4 10             	add    $0x10,%esp
+80109d3a:	85 c0                	test   %eax,%eax
+80109d3c:	0f 84 74 ff ff ff    	je     80109cb6 <trap+0x183>
+80109d42:	e9 01 ff ff ff       	jmp    80109c48 <trap+0x115>
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80109d47:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80109d4a:	8b 73 38             	mov    0x38(%ebx),%esi
+80109d4d:	e8 df cb ff ff       	call   80106931 <cpuid>
+80109d52:	83 ec 0c             	sub    $0xc,%esp
+80109d55:	57                   	push   %edi
+80109d56:	56                   	push   %esi
+80109d57:	50                   	push   %eax
+80109d58:	ff 73 30             	push   0x30(%ebx)
+80109d5b:	68 00 ca 10 80       	push   $0x8010ca00
+80109d60:	e8 52 71 ff ff       	call   80100eb7 <cprintf>
+      panic("trap");
+80109d65:	83 c4 14             	add    $0x14,%esp
+80109d68:	68 77 ca 10 80       	push   $0x8010ca77
+80109d6d:	e8 84 6e ff ff       	call   80100bf6 <panic>
+    exit();
+80109d72:	e8 28 d8 ff ff       	call   8010759f <exit>
+80109d77:	e9 5f ff ff ff       	jmp    80109cdb <trap+0x1a8>
+  if(myproc() && myproc()->state == RUNNING &&
+80109d7c:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+80109d80:	0f 85 6d ff ff ff    	jne    80109cf3 <trap+0x1c0>
+    tf->trapno == T_IRQ0+IRQ_TIMER && ticks%SCHED_INTERVAL==0)
+80109d86:	8b 0d 60 f3 13 80    	mov    0x8013f360,%ecx
+80109d8c:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80109d91:	89 c8                	mov    %ecx,%eax
+80109d93:	f7 e2                	mul    %edx
+80109d95:	c1 ea 03             	shr    $0x3,%edx
+80109d98:	8d 04 92             	lea    (%edx,%edx,4),%eax
+80109d9b:	01 c0                	add    %eax,%eax
+80109d9d:	39 c1                	cmp    %eax,%ecx
+80109d9f:	0f 85 4e ff ff ff    	jne    80109cf3 <trap+0x1c0>
+    yield();
+80109da5:	e8 fe d9 ff ff       	call   801077a8 <yield>
+80109daa:	e9 44 ff ff ff       	jmp    80109cf3 <trap+0x1c0>
+    exit();
+80109daf:	e8 eb d7 ff ff       	call   8010759f <exit>
+80109db4:	e9 5f ff ff ff       	jmp    80109d18 <trap+0x1e5>
+
+80109db9 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80109db9:	83 3d 80 fb 13 80 00 	cmpl   $0x0,0x8013fb80
+80109dc0:	74 14                	je     80109dd6 <uartgetc+0x1d>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109dc2:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109dc7:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+80109dc8:	a8 01                	test   $0x1,%al
+80109dca:	74 10                	je     80109ddc <uartgetc+0x23>
+80109dcc:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109dd1:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+80109dd2:	0f b6 c0             	movzbl %al,%eax
+80109dd5:	c3                   	ret
+    return -1;
+80109dd6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109ddb:	c3                   	ret
+    return -1;
+80109ddc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109de1:	c3                   	ret
+
+80109de2 <uartputc>:
+  if(!uart)
+80109de2:	83 3d 80 fb 13 80 00 	cmpl   $0x0,0x8013fb80
+80109de9:	74 3b                	je     80109e26 <uartputc+0x44>
+{
+80109deb:	55                   	push   %ebp
+80109dec:	89 e5                	mov    %esp,%ebp
+80109dee:	53                   	push   %ebx
+80109def:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109df2:	bb 00 00 00 00       	mov    $0x0,%ebx
+80109df7:	eb 10                	jmp    80109e09 <uartputc+0x27>
+    microdelay(10);
+80109df9:	83 ec 0c             	sub    $0xc,%esp
+80109dfc:	6a 0a                	push   $0xa
+80109dfe:	e8 28 b0 ff ff       	call   80104e2b <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109e03:	83 c3 01             	add    $0x1,%ebx
+80109e06:	83 c4 10             	add    $0x10,%esp
+80109e09:	83 fb 7f             	cmp    $0x7f,%ebx
+80109e0c:	7f 0a                	jg     80109e18 <uartputc+0x36>
+80109e0e:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109e13:	ec                   	in     (%dx),%al
+80109e14:	a8 20                	test   $0x20,%al
+80109e16:	74 e1                	je     80109df9 <uartputc+0x17>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109e18:	8b 45 08             	mov    0x8(%ebp),%eax
+80109e1b:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109e20:	ee                   	out    %al,(%dx)
+}
+80109e21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109e24:	c9                   	leave
+80109e25:	c3                   	ret
+80109e26:	c3                   	ret
+
+80109e27 <uartinit>:
+{
+80109e27:	55                   	push   %ebp
+80109e28:	89 e5                	mov    %esp,%ebp
+80109e2a:	56                   	push   %esi
+80109e2b:	53                   	push   %ebx
+80109e2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+80109e31:	ba fa 03 00 00       	mov    $0x3fa,%edx
+80109e36:	89 c8                	mov    %ecx,%eax
+80109e38:	ee                   	out    %al,(%dx)
+80109e39:	be fb 03 00 00       	mov    $0x3fb,%esi
+80109e3e:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+80109e43:	89 f2                	mov    %esi,%edx
+80109e45:	ee                   	out    %al,(%dx)
+80109e46:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109e4b:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109e50:	ee                   	out    %al,(%dx)
+80109e51:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80109e56:	89 c8                	mov    %ecx,%eax
+80109e58:	89 da                	mov    %ebx,%edx
+80109e5a:	ee                   	out    %al,(%dx)
+80109e5b:	b8 03 00 00 00       	mov    $0x3,%eax
+80109e60:	89 f2                	mov    %esi,%edx
+80109e62:	ee                   	out    %al,(%dx)
+80109e63:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109e68:	89 c8                	mov    %ecx,%eax
+80109e6a:	ee                   	out    %al,(%dx)
+80109e6b:	b8 01 00 00 00       	mov    $0x1,%eax
+80109e70:	89 da                	mov    %ebx,%edx
+80109e72:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109e73:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109e78:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80109e79:	3c ff                	cmp    $0xff,%al
+80109e7b:	74 45                	je     80109ec2 <uartinit+0x9b>
+  uart = 1;
+80109e7d:	c7 05 80 fb 13 80 01 	movl   $0x1,0x8013fb80
+80109e84:	00 00 00 
+80109e87:	ba fa 03 00 00       	mov    $0x3fa,%edx
+80109e8c:	ec                   	in     (%dx),%al
+80109e8d:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109e92:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+80109e93:	83 ec 08             	sub    $0x8,%esp
+80109e96:	6a 00                	push   $0x0
+80109e98:	6a 04                	push   $0x4
+80109e9a:	e8 f3 a7 ff ff       	call   80104692 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80109e9f:	83 c4 10             	add    $0x10,%esp
+80109ea2:	bb 44 cb 10 80       	mov    $0x8010cb44,%ebx
+80109ea7:	eb 12                	jmp    80109ebb <uartinit+0x94>
+    uartputc(*p);
+80109ea9:	83 ec 0c             	sub    $0xc,%esp
+80109eac:	0f be c0             	movsbl %al,%eax
+80109eaf:	50                   	push   %eax
+80109eb0:	e8 2d ff ff ff       	call   80109de2 <uartputc>
+  for(p="xv6...\n"; *p; p++)
+80109eb5:	83 c3 01             	add    $0x1,%ebx
+80109eb8:	83 c4 10             	add    $0x10,%esp
+80109ebb:	0f b6 03             	movzbl (%ebx),%eax
+80109ebe:	84 c0                	test   %al,%al
+80109ec0:	75 e7                	jne    80109ea9 <uartinit+0x82>
+}
+80109ec2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109ec5:	5b                   	pop    %ebx
+80109ec6:	5e                   	pop    %esi
+80109ec7:	5d                   	pop    %ebp
+80109ec8:	c3                   	ret
+
+80109ec9 <uartintr>:
+
+void
+uartintr(void)
+{
+80109ec9:	55                   	push   %ebp
+80109eca:	89 e5                	mov    %esp,%ebp
+80109ecc:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80109ecf:	68 b9 9d 10 80       	push   $0x80109db9
+80109ed4:	e8 2b 71 ff ff       	call   80101004 <consoleintr>
+}
+80109ed9:	83 c4 10             	add    $0x10,%esp
+80109edc:	c9                   	leave
+80109edd:	c3                   	ret
+
+80109ede <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80109ede:	6a 00                	push   $0x0
+  pushl $0
+80109ee0:	6a 00                	push   $0x0
+  jmp alltraps
+80109ee2:	e9 18 fb ff ff       	jmp    801099ff <alltraps>
+
+80109ee7 <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+80109ee7:	6a 00                	push   $0x0
+  pushl $1
+80109ee9:	6a 01                	push   $0x1
+  jmp alltraps
+80109eeb:	e9 0f fb ff ff       	jmp    801099ff <alltraps>
+
+80109ef0 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80109ef0:	6a 00                	push   $0x0
+  pushl $2
+80109ef2:	6a 02                	push   $0x2
+  jmp alltraps
+80109ef4:	e9 06 fb ff ff       	jmp    801099ff <alltraps>
+
+80109ef9 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+80109ef9:	6a 00                	push   $0x0
+  pushl $3
+80109efb:	6a 03                	push   $0x3
+  jmp alltraps
+80109efd:	e9 fd fa ff ff       	jmp    801099ff <alltraps>
+
+80109f02 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+80109f02:	6a 00                	push   $0x0
+  pushl $4
+80109f04:	6a 04                	push   $0x4
+  jmp alltraps
+80109f06:	e9 f4 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f0b <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80109f0b:	6a 00                	push   $0x0
+  pushl $5
+80109f0d:	6a 05                	push   $0x5
+  jmp alltraps
+80109f0f:	e9 eb fa ff ff       	jmp    801099ff <alltraps>
+
+80109f14 <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+80109f14:	6a 00                	push   $0x0
+  pushl $6
+80109f16:	6a 06                	push   $0x6
+  jmp alltraps
+80109f18:	e9 e2 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f1d <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80109f1d:	6a 00                	push   $0x0
+  pushl $7
+80109f1f:	6a 07                	push   $0x7
+  jmp alltraps
+80109f21:	e9 d9 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f26 <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+80109f26:	6a 08                	push   $0x8
+  jmp alltraps
+80109f28:	e9 d2 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f2d <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80109f2d:	6a 00                	push   $0x0
+  pushl $9
+80109f2f:	6a 09                	push   $0x9
+  jmp alltraps
+80109f31:	e9 c9 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f36 <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+80109f36:	6a 0a                	push   $0xa
+  jmp alltraps
+80109f38:	e9 c2 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f3d <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80109f3d:	6a 0b                	push   $0xb
+  jmp alltraps
+80109f3f:	e9 bb fa ff ff       	jmp    801099ff <alltraps>
+
+80109f44 <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+80109f44:	6a 0c                	push   $0xc
+  jmp alltraps
+80109f46:	e9 b4 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f4b <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+80109f4b:	6a 0d                	push   $0xd
+  jmp alltraps
+80109f4d:	e9 ad fa ff ff       	jmp    801099ff <alltraps>
+
+80109f52 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+80109f52:	6a 0e                	push   $0xe
+  jmp alltraps
+80109f54:	e9 a6 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f59 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+80109f59:	6a 00                	push   $0x0
+  pushl $15
+80109f5b:	6a 0f                	push   $0xf
+  jmp alltraps
+80109f5d:	e9 9d fa ff ff       	jmp    801099ff <alltraps>
+
+80109f62 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+80109f62:	6a 00                	push   $0x0
+  pushl $16
+80109f64:	6a 10                	push   $0x10
+  jmp alltraps
+80109f66:	e9 94 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f6b <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+80109f6b:	6a 11                	push   $0x11
+  jmp alltraps
+80109f6d:	e9 8d fa ff ff       	jmp    801099ff <alltraps>
+
+80109f72 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+80109f72:	6a 00                	push   $0x0
+  pushl $18
+80109f74:	6a 12                	push   $0x12
+  jmp alltraps
+80109f76:	e9 84 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f7b <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80109f7b:	6a 00                	push   $0x0
+  pushl $19
+80109f7d:	6a 13                	push   $0x13
+  jmp alltraps
+80109f7f:	e9 7b fa ff ff       	jmp    801099ff <alltraps>
+
+80109f84 <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+80109f84:	6a 00                	push   $0x0
+  pushl $20
+80109f86:	6a 14                	push   $0x14
+  jmp alltraps
+80109f88:	e9 72 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f8d <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109f8d:	6a 00                	push   $0x0
+  pushl $21
+80109f8f:	6a 15                	push   $0x15
+  jmp alltraps
+80109f91:	e9 69 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f96 <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+80109f96:	6a 00                	push   $0x0
+  pushl $22
+80109f98:	6a 16                	push   $0x16
+  jmp alltraps
+80109f9a:	e9 60 fa ff ff       	jmp    801099ff <alltraps>
+
+80109f9f <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109f9f:	6a 00                	push   $0x0
+  pushl $23
+80109fa1:	6a 17                	push   $0x17
+  jmp alltraps
+80109fa3:	e9 57 fa ff ff       	jmp    801099ff <alltraps>
+
+80109fa8 <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+80109fa8:	6a 00                	push   $0x0
+  pushl $24
+80109faa:	6a 18                	push   $0x18
+  jmp alltraps
+80109fac:	e9 4e fa ff ff       	jmp    801099ff <alltraps>
+
+80109fb1 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+80109fb1:	6a 00                	push   $0x0
+  pushl $25
+80109fb3:	6a 19                	push   $0x19
+  jmp alltraps
+80109fb5:	e9 45 fa ff ff       	jmp    801099ff <alltraps>
+
+80109fba <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+80109fba:	6a 00                	push   $0x0
+  pushl $26
+80109fbc:	6a 1a                	push   $0x1a
+  jmp alltraps
+80109fbe:	e9 3c fa ff ff       	jmp    801099ff <alltraps>
+
+80109fc3 <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+80109fc3:	6a 00                	push   $0x0
+  pushl $27
+80109fc5:	6a 1b                	push   $0x1b
+  jmp alltraps
+80109fc7:	e9 33 fa ff ff       	jmp    801099ff <alltraps>
+
+80109fcc <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+80109fcc:	6a 00                	push   $0x0
+  pushl $28
+80109fce:	6a 1c                	push   $0x1c
+  jmp alltraps
+80109fd0:	e9 2a fa ff ff       	jmp    801099ff <alltraps>
+
+80109fd5 <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+80109fd5:	6a 00                	push   $0x0
+  pushl $29
+80109fd7:	6a 1d                	push   $0x1d
+  jmp alltraps
+80109fd9:	e9 21 fa ff ff       	jmp    801099ff <alltraps>
+
+80109fde <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+80109fde:	6a 00                	push   $0x0
+  pushl $30
+80109fe0:	6a 1e                	push   $0x1e
+  jmp alltraps
+80109fe2:	e9 18 fa ff ff       	jmp    801099ff <alltraps>
+
+80109fe7 <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+80109fe7:	6a 00                	push   $0x0
+  pushl $31
+80109fe9:	6a 1f                	push   $0x1f
+  jmp alltraps
+80109feb:	e9 0f fa ff ff       	jmp    801099ff <alltraps>
+
+80109ff0 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80109ff0:	6a 00                	push   $0x0
+  pushl $32
+80109ff2:	6a 20                	push   $0x20
+  jmp alltraps
+80109ff4:	e9 06 fa ff ff       	jmp    801099ff <alltraps>
+
+80109ff9 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+80109ff9:	6a 00                	push   $0x0
+  pushl $33
+80109ffb:	6a 21                	push   $0x21
+  jmp alltraps
+80109ffd:	e9 fd f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a002 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+8010a002:	6a 00                	push   $0x0
+  pushl $34
+8010a004:	6a 22                	push   $0x22
+  jmp alltraps
+8010a006:	e9 f4 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a00b <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+8010a00b:	6a 00                	push   $0x0
+  pushl $35
+8010a00d:	6a 23                	push   $0x23
+  jmp alltraps
+8010a00f:	e9 eb f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a014 <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+8010a014:	6a 00                	push   $0x0
+  pushl $36
+8010a016:	6a 24                	push   $0x24
+  jmp alltraps
+8010a018:	e9 e2 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a01d <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+8010a01d:	6a 00                	push   $0x0
+  pushl $37
+8010a01f:	6a 25                	push   $0x25
+  jmp alltraps
+8010a021:	e9 d9 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a026 <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+8010a026:	6a 00                	push   $0x0
+  pushl $38
+8010a028:	6a 26                	push   $0x26
+  jmp alltraps
+8010a02a:	e9 d0 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a02f <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+8010a02f:	6a 00                	push   $0x0
+  pushl $39
+8010a031:	6a 27                	push   $0x27
+  jmp alltraps
+8010a033:	e9 c7 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a038 <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+8010a038:	6a 00                	push   $0x0
+  pushl $40
+8010a03a:	6a 28                	push   $0x28
+  jmp alltraps
+8010a03c:	e9 be f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a041 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+8010a041:	6a 00                	push   $0x0
+  pushl $41
+8010a043:	6a 29                	push   $0x29
+  jmp alltraps
+8010a045:	e9 b5 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a04a <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+8010a04a:	6a 00                	push   $0x0
+  pushl $42
+8010a04c:	6a 2a                	push   $0x2a
+  jmp alltraps
+8010a04e:	e9 ac f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a053 <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+8010a053:	6a 00                	push   $0x0
+  pushl $43
+8010a055:	6a 2b                	push   $0x2b
+  jmp alltraps
+8010a057:	e9 a3 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a05c <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+8010a05c:	6a 00                	push   $0x0
+  pushl $44
+8010a05e:	6a 2c                	push   $0x2c
+  jmp alltraps
+8010a060:	e9 9a f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a065 <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+8010a065:	6a 00                	push   $0x0
+  pushl $45
+8010a067:	6a 2d                	push   $0x2d
+  jmp alltraps
+8010a069:	e9 91 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a06e <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+8010a06e:	6a 00                	push   $0x0
+  pushl $46
+8010a070:	6a 2e                	push   $0x2e
+  jmp alltraps
+8010a072:	e9 88 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a077 <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+8010a077:	6a 00                	push   $0x0
+  pushl $47
+8010a079:	6a 2f                	push   $0x2f
+  jmp alltraps
+8010a07b:	e9 7f f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a080 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+8010a080:	6a 00                	push   $0x0
+  pushl $48
+8010a082:	6a 30                	push   $0x30
+  jmp alltraps
+8010a084:	e9 76 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a089 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+8010a089:	6a 00                	push   $0x0
+  pushl $49
+8010a08b:	6a 31                	push   $0x31
+  jmp alltraps
+8010a08d:	e9 6d f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a092 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+8010a092:	6a 00                	push   $0x0
+  pushl $50
+8010a094:	6a 32                	push   $0x32
+  jmp alltraps
+8010a096:	e9 64 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a09b <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+8010a09b:	6a 00                	push   $0x0
+  pushl $51
+8010a09d:	6a 33                	push   $0x33
+  jmp alltraps
+8010a09f:	e9 5b f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0a4 <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+8010a0a4:	6a 00                	push   $0x0
+  pushl $52
+8010a0a6:	6a 34                	push   $0x34
+  jmp alltraps
+8010a0a8:	e9 52 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0ad <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+8010a0ad:	6a 00                	push   $0x0
+  pushl $53
+8010a0af:	6a 35                	push   $0x35
+  jmp alltraps
+8010a0b1:	e9 49 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0b6 <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+8010a0b6:	6a 00                	push   $0x0
+  pushl $54
+8010a0b8:	6a 36                	push   $0x36
+  jmp alltraps
+8010a0ba:	e9 40 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0bf <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+8010a0bf:	6a 00                	push   $0x0
+  pushl $55
+8010a0c1:	6a 37                	push   $0x37
+  jmp alltraps
+8010a0c3:	e9 37 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0c8 <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+8010a0c8:	6a 00                	push   $0x0
+  pushl $56
+8010a0ca:	6a 38                	push   $0x38
+  jmp alltraps
+8010a0cc:	e9 2e f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0d1 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+8010a0d1:	6a 00                	push   $0x0
+  pushl $57
+8010a0d3:	6a 39                	push   $0x39
+  jmp alltraps
+8010a0d5:	e9 25 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0da <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+8010a0da:	6a 00                	push   $0x0
+  pushl $58
+8010a0dc:	6a 3a                	push   $0x3a
+  jmp alltraps
+8010a0de:	e9 1c f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0e3 <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+8010a0e3:	6a 00                	push   $0x0
+  pushl $59
+8010a0e5:	6a 3b                	push   $0x3b
+  jmp alltraps
+8010a0e7:	e9 13 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0ec <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+8010a0ec:	6a 00                	push   $0x0
+  pushl $60
+8010a0ee:	6a 3c                	push   $0x3c
+  jmp alltraps
+8010a0f0:	e9 0a f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0f5 <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+8010a0f5:	6a 00                	push   $0x0
+  pushl $61
+8010a0f7:	6a 3d                	push   $0x3d
+  jmp alltraps
+8010a0f9:	e9 01 f9 ff ff       	jmp    801099ff <alltraps>
+
+8010a0fe <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+8010a0fe:	6a 00                	push   $0x0
+  pushl $62
+8010a100:	6a 3e                	push   $0x3e
+  jmp alltraps
+8010a102:	e9 f8 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a107 <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+8010a107:	6a 00                	push   $0x0
+  pushl $63
+8010a109:	6a 3f                	push   $0x3f
+  jmp alltraps
+8010a10b:	e9 ef f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a110 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+8010a110:	6a 00                	push   $0x0
+  pushl $64
+8010a112:	6a 40                	push   $0x40
+  jmp alltraps
+8010a114:	e9 e6 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a119 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+8010a119:	6a 00                	push   $0x0
+  pushl $65
+8010a11b:	6a 41                	push   $0x41
+  jmp alltraps
+8010a11d:	e9 dd f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a122 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+8010a122:	6a 00                	push   $0x0
+  pushl $66
+8010a124:	6a 42                	push   $0x42
+  jmp alltraps
+8010a126:	e9 d4 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a12b <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+8010a12b:	6a 00                	push   $0x0
+  pushl $67
+8010a12d:	6a 43                	push   $0x43
+  jmp alltraps
+8010a12f:	e9 cb f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a134 <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+8010a134:	6a 00                	push   $0x0
+  pushl $68
+8010a136:	6a 44                	push   $0x44
+  jmp alltraps
+8010a138:	e9 c2 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a13d <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+8010a13d:	6a 00                	push   $0x0
+  pushl $69
+8010a13f:	6a 45                	push   $0x45
+  jmp alltraps
+8010a141:	e9 b9 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a146 <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+8010a146:	6a 00                	push   $0x0
+  pushl $70
+8010a148:	6a 46                	push   $0x46
+  jmp alltraps
+8010a14a:	e9 b0 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a14f <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+8010a14f:	6a 00                	push   $0x0
+  pushl $71
+8010a151:	6a 47                	push   $0x47
+  jmp alltraps
+8010a153:	e9 a7 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a158 <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+8010a158:	6a 00                	push   $0x0
+  pushl $72
+8010a15a:	6a 48                	push   $0x48
+  jmp alltraps
+8010a15c:	e9 9e f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a161 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+8010a161:	6a 00                	push   $0x0
+  pushl $73
+8010a163:	6a 49                	push   $0x49
+  jmp alltraps
+8010a165:	e9 95 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a16a <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+8010a16a:	6a 00                	push   $0x0
+  pushl $74
+8010a16c:	6a 4a                	push   $0x4a
+  jmp alltraps
+8010a16e:	e9 8c f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a173 <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+8010a173:	6a 00                	push   $0x0
+  pushl $75
+8010a175:	6a 4b                	push   $0x4b
+  jmp alltraps
+8010a177:	e9 83 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a17c <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+8010a17c:	6a 00                	push   $0x0
+  pushl $76
+8010a17e:	6a 4c                	push   $0x4c
+  jmp alltraps
+8010a180:	e9 7a f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a185 <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+8010a185:	6a 00                	push   $0x0
+  pushl $77
+8010a187:	6a 4d                	push   $0x4d
+  jmp alltraps
+8010a189:	e9 71 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a18e <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+8010a18e:	6a 00                	push   $0x0
+  pushl $78
+8010a190:	6a 4e                	push   $0x4e
+  jmp alltraps
+8010a192:	e9 68 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a197 <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+8010a197:	6a 00                	push   $0x0
+  pushl $79
+8010a199:	6a 4f                	push   $0x4f
+  jmp alltraps
+8010a19b:	e9 5f f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1a0 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+8010a1a0:	6a 00                	push   $0x0
+  pushl $80
+8010a1a2:	6a 50                	push   $0x50
+  jmp alltraps
+8010a1a4:	e9 56 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1a9 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+8010a1a9:	6a 00                	push   $0x0
+  pushl $81
+8010a1ab:	6a 51                	push   $0x51
+  jmp alltraps
+8010a1ad:	e9 4d f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1b2 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+8010a1b2:	6a 00                	push   $0x0
+  pushl $82
+8010a1b4:	6a 52                	push   $0x52
+  jmp alltraps
+8010a1b6:	e9 44 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1bb <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+8010a1bb:	6a 00                	push   $0x0
+  pushl $83
+8010a1bd:	6a 53                	push   $0x53
+  jmp alltraps
+8010a1bf:	e9 3b f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1c4 <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+8010a1c4:	6a 00                	push   $0x0
+  pushl $84
+8010a1c6:	6a 54                	push   $0x54
+  jmp alltraps
+8010a1c8:	e9 32 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1cd <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+8010a1cd:	6a 00                	push   $0x0
+  pushl $85
+8010a1cf:	6a 55                	push   $0x55
+  jmp alltraps
+8010a1d1:	e9 29 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1d6 <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+8010a1d6:	6a 00                	push   $0x0
+  pushl $86
+8010a1d8:	6a 56                	push   $0x56
+  jmp alltraps
+8010a1da:	e9 20 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1df <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+8010a1df:	6a 00                	push   $0x0
+  pushl $87
+8010a1e1:	6a 57                	push   $0x57
+  jmp alltraps
+8010a1e3:	e9 17 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1e8 <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+8010a1e8:	6a 00                	push   $0x0
+  pushl $88
+8010a1ea:	6a 58                	push   $0x58
+  jmp alltraps
+8010a1ec:	e9 0e f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1f1 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+8010a1f1:	6a 00                	push   $0x0
+  pushl $89
+8010a1f3:	6a 59                	push   $0x59
+  jmp alltraps
+8010a1f5:	e9 05 f8 ff ff       	jmp    801099ff <alltraps>
+
+8010a1fa <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+8010a1fa:	6a 00                	push   $0x0
+  pushl $90
+8010a1fc:	6a 5a                	push   $0x5a
+  jmp alltraps
+8010a1fe:	e9 fc f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a203 <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+8010a203:	6a 00                	push   $0x0
+  pushl $91
+8010a205:	6a 5b                	push   $0x5b
+  jmp alltraps
+8010a207:	e9 f3 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a20c <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+8010a20c:	6a 00                	push   $0x0
+  pushl $92
+8010a20e:	6a 5c                	push   $0x5c
+  jmp alltraps
+8010a210:	e9 ea f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a215 <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+8010a215:	6a 00                	push   $0x0
+  pushl $93
+8010a217:	6a 5d                	push   $0x5d
+  jmp alltraps
+8010a219:	e9 e1 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a21e <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+8010a21e:	6a 00                	push   $0x0
+  pushl $94
+8010a220:	6a 5e                	push   $0x5e
+  jmp alltraps
+8010a222:	e9 d8 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a227 <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+8010a227:	6a 00                	push   $0x0
+  pushl $95
+8010a229:	6a 5f                	push   $0x5f
+  jmp alltraps
+8010a22b:	e9 cf f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a230 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+8010a230:	6a 00                	push   $0x0
+  pushl $96
+8010a232:	6a 60                	push   $0x60
+  jmp alltraps
+8010a234:	e9 c6 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a239 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+8010a239:	6a 00                	push   $0x0
+  pushl $97
+8010a23b:	6a 61                	push   $0x61
+  jmp alltraps
+8010a23d:	e9 bd f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a242 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+8010a242:	6a 00                	push   $0x0
+  pushl $98
+8010a244:	6a 62                	push   $0x62
+  jmp alltraps
+8010a246:	e9 b4 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a24b <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+8010a24b:	6a 00                	push   $0x0
+  pushl $99
+8010a24d:	6a 63                	push   $0x63
+  jmp alltraps
+8010a24f:	e9 ab f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a254 <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+8010a254:	6a 00                	push   $0x0
+  pushl $100
+8010a256:	6a 64                	push   $0x64
+  jmp alltraps
+8010a258:	e9 a2 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a25d <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+8010a25d:	6a 00                	push   $0x0
+  pushl $101
+8010a25f:	6a 65                	push   $0x65
+  jmp alltraps
+8010a261:	e9 99 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a266 <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+8010a266:	6a 00                	push   $0x0
+  pushl $102
+8010a268:	6a 66                	push   $0x66
+  jmp alltraps
+8010a26a:	e9 90 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a26f <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+8010a26f:	6a 00                	push   $0x0
+  pushl $103
+8010a271:	6a 67                	push   $0x67
+  jmp alltraps
+8010a273:	e9 87 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a278 <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+8010a278:	6a 00                	push   $0x0
+  pushl $104
+8010a27a:	6a 68                	push   $0x68
+  jmp alltraps
+8010a27c:	e9 7e f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a281 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+8010a281:	6a 00                	push   $0x0
+  pushl $105
+8010a283:	6a 69                	push   $0x69
+  jmp alltraps
+8010a285:	e9 75 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a28a <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+8010a28a:	6a 00                	push   $0x0
+  pushl $106
+8010a28c:	6a 6a                	push   $0x6a
+  jmp alltraps
+8010a28e:	e9 6c f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a293 <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010a293:	6a 00                	push   $0x0
+  pushl $107
+8010a295:	6a 6b                	push   $0x6b
+  jmp alltraps
+8010a297:	e9 63 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a29c <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+8010a29c:	6a 00                	push   $0x0
+  pushl $108
+8010a29e:	6a 6c                	push   $0x6c
+  jmp alltraps
+8010a2a0:	e9 5a f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2a5 <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010a2a5:	6a 00                	push   $0x0
+  pushl $109
+8010a2a7:	6a 6d                	push   $0x6d
+  jmp alltraps
+8010a2a9:	e9 51 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2ae <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+8010a2ae:	6a 00                	push   $0x0
+  pushl $110
+8010a2b0:	6a 6e                	push   $0x6e
+  jmp alltraps
+8010a2b2:	e9 48 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2b7 <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+8010a2b7:	6a 00                	push   $0x0
+  pushl $111
+8010a2b9:	6a 6f                	push   $0x6f
+  jmp alltraps
+8010a2bb:	e9 3f f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2c0 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+8010a2c0:	6a 00                	push   $0x0
+  pushl $112
+8010a2c2:	6a 70                	push   $0x70
+  jmp alltraps
+8010a2c4:	e9 36 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2c9 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+8010a2c9:	6a 00                	push   $0x0
+  pushl $113
+8010a2cb:	6a 71                	push   $0x71
+  jmp alltraps
+8010a2cd:	e9 2d f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2d2 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+8010a2d2:	6a 00                	push   $0x0
+  pushl $114
+8010a2d4:	6a 72                	push   $0x72
+  jmp alltraps
+8010a2d6:	e9 24 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2db <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+8010a2db:	6a 00                	push   $0x0
+  pushl $115
+8010a2dd:	6a 73                	push   $0x73
+  jmp alltraps
+8010a2df:	e9 1b f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2e4 <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+8010a2e4:	6a 00                	push   $0x0
+  pushl $116
+8010a2e6:	6a 74                	push   $0x74
+  jmp alltraps
+8010a2e8:	e9 12 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2ed <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+8010a2ed:	6a 00                	push   $0x0
+  pushl $117
+8010a2ef:	6a 75                	push   $0x75
+  jmp alltraps
+8010a2f1:	e9 09 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2f6 <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+8010a2f6:	6a 00                	push   $0x0
+  pushl $118
+8010a2f8:	6a 76                	push   $0x76
+  jmp alltraps
+8010a2fa:	e9 00 f7 ff ff       	jmp    801099ff <alltraps>
+
+8010a2ff <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+8010a2ff:	6a 00                	push   $0x0
+  pushl $119
+8010a301:	6a 77                	push   $0x77
+  jmp alltraps
+8010a303:	e9 f7 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a308 <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+8010a308:	6a 00                	push   $0x0
+  pushl $120
+8010a30a:	6a 78                	push   $0x78
+  jmp alltraps
+8010a30c:	e9 ee f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a311 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+8010a311:	6a 00                	push   $0x0
+  pushl $121
+8010a313:	6a 79                	push   $0x79
+  jmp alltraps
+8010a315:	e9 e5 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a31a <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+8010a31a:	6a 00                	push   $0x0
+  pushl $122
+8010a31c:	6a 7a                	push   $0x7a
+  jmp alltraps
+8010a31e:	e9 dc f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a323 <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+8010a323:	6a 00                	push   $0x0
+  pushl $123
+8010a325:	6a 7b                	push   $0x7b
+  jmp alltraps
+8010a327:	e9 d3 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a32c <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+8010a32c:	6a 00                	push   $0x0
+  pushl $124
+8010a32e:	6a 7c                	push   $0x7c
+  jmp alltraps
+8010a330:	e9 ca f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a335 <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+8010a335:	6a 00                	push   $0x0
+  pushl $125
+8010a337:	6a 7d                	push   $0x7d
+  jmp alltraps
+8010a339:	e9 c1 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a33e <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+8010a33e:	6a 00                	push   $0x0
+  pushl $126
+8010a340:	6a 7e                	push   $0x7e
+  jmp alltraps
+8010a342:	e9 b8 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a347 <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+8010a347:	6a 00                	push   $0x0
+  pushl $127
+8010a349:	6a 7f                	push   $0x7f
+  jmp alltraps
+8010a34b:	e9 af f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a350 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+8010a350:	6a 00                	push   $0x0
+  pushl $128
+8010a352:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+8010a357:	e9 a3 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a35c <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+8010a35c:	6a 00                	push   $0x0
+  pushl $129
+8010a35e:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+8010a363:	e9 97 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a368 <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+8010a368:	6a 00                	push   $0x0
+  pushl $130
+8010a36a:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+8010a36f:	e9 8b f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a374 <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+8010a374:	6a 00                	push   $0x0
+  pushl $131
+8010a376:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+8010a37b:	e9 7f f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a380 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+8010a380:	6a 00                	push   $0x0
+  pushl $132
+8010a382:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+8010a387:	e9 73 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a38c <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+8010a38c:	6a 00                	push   $0x0
+  pushl $133
+8010a38e:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+8010a393:	e9 67 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a398 <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+8010a398:	6a 00                	push   $0x0
+  pushl $134
+8010a39a:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+8010a39f:	e9 5b f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a3a4 <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+8010a3a4:	6a 00                	push   $0x0
+  pushl $135
+8010a3a6:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+8010a3ab:	e9 4f f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a3b0 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+8010a3b0:	6a 00                	push   $0x0
+  pushl $136
+8010a3b2:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+8010a3b7:	e9 43 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a3bc <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+8010a3bc:	6a 00                	push   $0x0
+  pushl $137
+8010a3be:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+8010a3c3:	e9 37 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a3c8 <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+8010a3c8:	6a 00                	push   $0x0
+  pushl $138
+8010a3ca:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+8010a3cf:	e9 2b f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a3d4 <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+8010a3d4:	6a 00                	push   $0x0
+  pushl $139
+8010a3d6:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+8010a3db:	e9 1f f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a3e0 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+8010a3e0:	6a 00                	push   $0x0
+  pushl $140
+8010a3e2:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+8010a3e7:	e9 13 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a3ec <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+8010a3ec:	6a 00                	push   $0x0
+  pushl $141
+8010a3ee:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+8010a3f3:	e9 07 f6 ff ff       	jmp    801099ff <alltraps>
+
+8010a3f8 <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+8010a3f8:	6a 00                	push   $0x0
+  pushl $142
+8010a3fa:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+8010a3ff:	e9 fb f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a404 <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+8010a404:	6a 00                	push   $0x0
+  pushl $143
+8010a406:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+8010a40b:	e9 ef f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a410 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+8010a410:	6a 00                	push   $0x0
+  pushl $144
+8010a412:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+8010a417:	e9 e3 f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a41c <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+8010a41c:	6a 00                	push   $0x0
+  pushl $145
+8010a41e:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+8010a423:	e9 d7 f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a428 <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+8010a428:	6a 00                	push   $0x0
+  pushl $146
+8010a42a:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+8010a42f:	e9 cb f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a434 <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+8010a434:	6a 00                	push   $0x0
+  pushl $147
+8010a436:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+8010a43b:	e9 bf f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a440 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+8010a440:	6a 00                	push   $0x0
+  pushl $148
+8010a442:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+8010a447:	e9 b3 f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a44c <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+8010a44c:	6a 00                	push   $0x0
+  pushl $149
+8010a44e:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+8010a453:	e9 a7 f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a458 <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+8010a458:	6a 00                	push   $0x0
+  pushl $150
+8010a45a:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+8010a45f:	e9 9b f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a464 <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+8010a464:	6a 00                	push   $0x0
+  pushl $151
+8010a466:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+8010a46b:	e9 8f f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a470 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+8010a470:	6a 00                	push   $0x0
+  pushl $152
+8010a472:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+8010a477:	e9 83 f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a47c <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+8010a47c:	6a 00                	push   $0x0
+  pushl $153
+8010a47e:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+8010a483:	e9 77 f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a488 <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+8010a488:	6a 00                	push   $0x0
+  pushl $154
+8010a48a:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+8010a48f:	e9 6b f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a494 <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+8010a494:	6a 00                	push   $0x0
+  pushl $155
+8010a496:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+8010a49b:	e9 5f f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a4a0 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+8010a4a0:	6a 00                	push   $0x0
+  pushl $156
+8010a4a2:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+8010a4a7:	e9 53 f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a4ac <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+8010a4ac:	6a 00                	push   $0x0
+  pushl $157
+8010a4ae:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+8010a4b3:	e9 47 f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a4b8 <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+8010a4b8:	6a 00                	push   $0x0
+  pushl $158
+8010a4ba:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+8010a4bf:	e9 3b f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a4c4 <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+8010a4c4:	6a 00                	push   $0x0
+  pushl $159
+8010a4c6:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+8010a4cb:	e9 2f f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a4d0 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+8010a4d0:	6a 00                	push   $0x0
+  pushl $160
+8010a4d2:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+8010a4d7:	e9 23 f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a4dc <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+8010a4dc:	6a 00                	push   $0x0
+  pushl $161
+8010a4de:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+8010a4e3:	e9 17 f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a4e8 <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+8010a4e8:	6a 00                	push   $0x0
+  pushl $162
+8010a4ea:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+8010a4ef:	e9 0b f5 ff ff       	jmp    801099ff <alltraps>
+
+8010a4f4 <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+8010a4f4:	6a 00                	push   $0x0
+  pushl $163
+8010a4f6:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+8010a4fb:	e9 ff f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a500 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+8010a500:	6a 00                	push   $0x0
+  pushl $164
+8010a502:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+8010a507:	e9 f3 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a50c <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+8010a50c:	6a 00                	push   $0x0
+  pushl $165
+8010a50e:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+8010a513:	e9 e7 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a518 <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+8010a518:	6a 00                	push   $0x0
+  pushl $166
+8010a51a:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+8010a51f:	e9 db f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a524 <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+8010a524:	6a 00                	push   $0x0
+  pushl $167
+8010a526:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+8010a52b:	e9 cf f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a530 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+8010a530:	6a 00                	push   $0x0
+  pushl $168
+8010a532:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+8010a537:	e9 c3 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a53c <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+8010a53c:	6a 00                	push   $0x0
+  pushl $169
+8010a53e:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+8010a543:	e9 b7 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a548 <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+8010a548:	6a 00                	push   $0x0
+  pushl $170
+8010a54a:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+8010a54f:	e9 ab f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a554 <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+8010a554:	6a 00                	push   $0x0
+  pushl $171
+8010a556:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+8010a55b:	e9 9f f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a560 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+8010a560:	6a 00                	push   $0x0
+  pushl $172
+8010a562:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+8010a567:	e9 93 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a56c <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+8010a56c:	6a 00                	push   $0x0
+  pushl $173
+8010a56e:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+8010a573:	e9 87 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a578 <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+8010a578:	6a 00                	push   $0x0
+  pushl $174
+8010a57a:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+8010a57f:	e9 7b f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a584 <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+8010a584:	6a 00                	push   $0x0
+  pushl $175
+8010a586:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+8010a58b:	e9 6f f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a590 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+8010a590:	6a 00                	push   $0x0
+  pushl $176
+8010a592:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+8010a597:	e9 63 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a59c <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+8010a59c:	6a 00                	push   $0x0
+  pushl $177
+8010a59e:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+8010a5a3:	e9 57 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a5a8 <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+8010a5a8:	6a 00                	push   $0x0
+  pushl $178
+8010a5aa:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+8010a5af:	e9 4b f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a5b4 <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+8010a5b4:	6a 00                	push   $0x0
+  pushl $179
+8010a5b6:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+8010a5bb:	e9 3f f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a5c0 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+8010a5c0:	6a 00                	push   $0x0
+  pushl $180
+8010a5c2:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+8010a5c7:	e9 33 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a5cc <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+8010a5cc:	6a 00                	push   $0x0
+  pushl $181
+8010a5ce:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+8010a5d3:	e9 27 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a5d8 <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+8010a5d8:	6a 00                	push   $0x0
+  pushl $182
+8010a5da:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+8010a5df:	e9 1b f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a5e4 <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+8010a5e4:	6a 00                	push   $0x0
+  pushl $183
+8010a5e6:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+8010a5eb:	e9 0f f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a5f0 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+8010a5f0:	6a 00                	push   $0x0
+  pushl $184
+8010a5f2:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010a5f7:	e9 03 f4 ff ff       	jmp    801099ff <alltraps>
+
+8010a5fc <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+8010a5fc:	6a 00                	push   $0x0
+  pushl $185
+8010a5fe:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+8010a603:	e9 f7 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a608 <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+8010a608:	6a 00                	push   $0x0
+  pushl $186
+8010a60a:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+8010a60f:	e9 eb f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a614 <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+8010a614:	6a 00                	push   $0x0
+  pushl $187
+8010a616:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+8010a61b:	e9 df f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a620 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+8010a620:	6a 00                	push   $0x0
+  pushl $188
+8010a622:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010a627:	e9 d3 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a62c <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+8010a62c:	6a 00                	push   $0x0
+  pushl $189
+8010a62e:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+8010a633:	e9 c7 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a638 <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010a638:	6a 00                	push   $0x0
+  pushl $190
+8010a63a:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+8010a63f:	e9 bb f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a644 <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+8010a644:	6a 00                	push   $0x0
+  pushl $191
+8010a646:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+8010a64b:	e9 af f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a650 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+8010a650:	6a 00                	push   $0x0
+  pushl $192
+8010a652:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+8010a657:	e9 a3 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a65c <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+8010a65c:	6a 00                	push   $0x0
+  pushl $193
+8010a65e:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+8010a663:	e9 97 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a668 <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+8010a668:	6a 00                	push   $0x0
+  pushl $194
+8010a66a:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+8010a66f:	e9 8b f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a674 <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+8010a674:	6a 00                	push   $0x0
+  pushl $195
+8010a676:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+8010a67b:	e9 7f f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a680 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+8010a680:	6a 00                	push   $0x0
+  pushl $196
+8010a682:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+8010a687:	e9 73 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a68c <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+8010a68c:	6a 00                	push   $0x0
+  pushl $197
+8010a68e:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+8010a693:	e9 67 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a698 <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+8010a698:	6a 00                	push   $0x0
+  pushl $198
+8010a69a:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+8010a69f:	e9 5b f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a6a4 <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+8010a6a4:	6a 00                	push   $0x0
+  pushl $199
+8010a6a6:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+8010a6ab:	e9 4f f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a6b0 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+8010a6b0:	6a 00                	push   $0x0
+  pushl $200
+8010a6b2:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+8010a6b7:	e9 43 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a6bc <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+8010a6bc:	6a 00                	push   $0x0
+  pushl $201
+8010a6be:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+8010a6c3:	e9 37 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a6c8 <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+8010a6c8:	6a 00                	push   $0x0
+  pushl $202
+8010a6ca:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+8010a6cf:	e9 2b f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a6d4 <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+8010a6d4:	6a 00                	push   $0x0
+  pushl $203
+8010a6d6:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+8010a6db:	e9 1f f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a6e0 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+8010a6e0:	6a 00                	push   $0x0
+  pushl $204
+8010a6e2:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+8010a6e7:	e9 13 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a6ec <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+8010a6ec:	6a 00                	push   $0x0
+  pushl $205
+8010a6ee:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+8010a6f3:	e9 07 f3 ff ff       	jmp    801099ff <alltraps>
+
+8010a6f8 <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+8010a6f8:	6a 00                	push   $0x0
+  pushl $206
+8010a6fa:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+8010a6ff:	e9 fb f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a704 <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+8010a704:	6a 00                	push   $0x0
+  pushl $207
+8010a706:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+8010a70b:	e9 ef f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a710 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+8010a710:	6a 00                	push   $0x0
+  pushl $208
+8010a712:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+8010a717:	e9 e3 f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a71c <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+8010a71c:	6a 00                	push   $0x0
+  pushl $209
+8010a71e:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+8010a723:	e9 d7 f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a728 <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010a728:	6a 00                	push   $0x0
+  pushl $210
+8010a72a:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+8010a72f:	e9 cb f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a734 <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+8010a734:	6a 00                	push   $0x0
+  pushl $211
+8010a736:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+8010a73b:	e9 bf f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a740 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+8010a740:	6a 00                	push   $0x0
+  pushl $212
+8010a742:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+8010a747:	e9 b3 f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a74c <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+8010a74c:	6a 00                	push   $0x0
+  pushl $213
+8010a74e:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+8010a753:	e9 a7 f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a758 <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+8010a758:	6a 00                	push   $0x0
+  pushl $214
+8010a75a:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+8010a75f:	e9 9b f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a764 <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+8010a764:	6a 00                	push   $0x0
+  pushl $215
+8010a766:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+8010a76b:	e9 8f f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a770 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+8010a770:	6a 00                	push   $0x0
+  pushl $216
+8010a772:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+8010a777:	e9 83 f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a77c <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+8010a77c:	6a 00                	push   $0x0
+  pushl $217
+8010a77e:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+8010a783:	e9 77 f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a788 <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+8010a788:	6a 00                	push   $0x0
+  pushl $218
+8010a78a:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+8010a78f:	e9 6b f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a794 <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+8010a794:	6a 00                	push   $0x0
+  pushl $219
+8010a796:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+8010a79b:	e9 5f f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a7a0 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+8010a7a0:	6a 00                	push   $0x0
+  pushl $220
+8010a7a2:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+8010a7a7:	e9 53 f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a7ac <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+8010a7ac:	6a 00                	push   $0x0
+  pushl $221
+8010a7ae:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+8010a7b3:	e9 47 f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a7b8 <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+8010a7b8:	6a 00                	push   $0x0
+  pushl $222
+8010a7ba:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+8010a7bf:	e9 3b f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a7c4 <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+8010a7c4:	6a 00                	push   $0x0
+  pushl $223
+8010a7c6:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+8010a7cb:	e9 2f f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a7d0 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+8010a7d0:	6a 00                	push   $0x0
+  pushl $224
+8010a7d2:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+8010a7d7:	e9 23 f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a7dc <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+8010a7dc:	6a 00                	push   $0x0
+  pushl $225
+8010a7de:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+8010a7e3:	e9 17 f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a7e8 <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+8010a7e8:	6a 00                	push   $0x0
+  pushl $226
+8010a7ea:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+8010a7ef:	e9 0b f2 ff ff       	jmp    801099ff <alltraps>
+
+8010a7f4 <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+8010a7f4:	6a 00                	push   $0x0
+  pushl $227
+8010a7f6:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+8010a7fb:	e9 ff f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a800 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+8010a800:	6a 00                	push   $0x0
+  pushl $228
+8010a802:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+8010a807:	e9 f3 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a80c <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+8010a80c:	6a 00                	push   $0x0
+  pushl $229
+8010a80e:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+8010a813:	e9 e7 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a818 <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+8010a818:	6a 00                	push   $0x0
+  pushl $230
+8010a81a:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+8010a81f:	e9 db f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a824 <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+8010a824:	6a 00                	push   $0x0
+  pushl $231
+8010a826:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+8010a82b:	e9 cf f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a830 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+8010a830:	6a 00                	push   $0x0
+  pushl $232
+8010a832:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010a837:	e9 c3 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a83c <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+8010a83c:	6a 00                	push   $0x0
+  pushl $233
+8010a83e:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+8010a843:	e9 b7 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a848 <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+8010a848:	6a 00                	push   $0x0
+  pushl $234
+8010a84a:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+8010a84f:	e9 ab f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a854 <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+8010a854:	6a 00                	push   $0x0
+  pushl $235
+8010a856:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+8010a85b:	e9 9f f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a860 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+8010a860:	6a 00                	push   $0x0
+  pushl $236
+8010a862:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+8010a867:	e9 93 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a86c <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+8010a86c:	6a 00                	push   $0x0
+  pushl $237
+8010a86e:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+8010a873:	e9 87 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a878 <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+8010a878:	6a 00                	push   $0x0
+  pushl $238
+8010a87a:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+8010a87f:	e9 7b f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a884 <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+8010a884:	6a 00                	push   $0x0
+  pushl $239
+8010a886:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+8010a88b:	e9 6f f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a890 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+8010a890:	6a 00                	push   $0x0
+  pushl $240
+8010a892:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+8010a897:	e9 63 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a89c <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+8010a89c:	6a 00                	push   $0x0
+  pushl $241
+8010a89e:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+8010a8a3:	e9 57 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a8a8 <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+8010a8a8:	6a 00                	push   $0x0
+  pushl $242
+8010a8aa:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+8010a8af:	e9 4b f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a8b4 <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+8010a8b4:	6a 00                	push   $0x0
+  pushl $243
+8010a8b6:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+8010a8bb:	e9 3f f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a8c0 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+8010a8c0:	6a 00                	push   $0x0
+  pushl $244
+8010a8c2:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+8010a8c7:	e9 33 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a8cc <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+8010a8cc:	6a 00                	push   $0x0
+  pushl $245
+8010a8ce:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+8010a8d3:	e9 27 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a8d8 <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+8010a8d8:	6a 00                	push   $0x0
+  pushl $246
+8010a8da:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+8010a8df:	e9 1b f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a8e4 <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+8010a8e4:	6a 00                	push   $0x0
+  pushl $247
+8010a8e6:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+8010a8eb:	e9 0f f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a8f0 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+8010a8f0:	6a 00                	push   $0x0
+  pushl $248
+8010a8f2:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+8010a8f7:	e9 03 f1 ff ff       	jmp    801099ff <alltraps>
+
+8010a8fc <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+8010a8fc:	6a 00                	push   $0x0
+  pushl $249
+8010a8fe:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+8010a903:	e9 f7 f0 ff ff       	jmp    801099ff <alltraps>
+
+8010a908 <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+8010a908:	6a 00                	push   $0x0
+  pushl $250
+8010a90a:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+8010a90f:	e9 eb f0 ff ff       	jmp    801099ff <alltraps>
+
+8010a914 <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+8010a914:	6a 00                	push   $0x0
+  pushl $251
+8010a916:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+8010a91b:	e9 df f0 ff ff       	jmp    801099ff <alltraps>
+
+8010a920 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+8010a920:	6a 00                	push   $0x0
+  pushl $252
+8010a922:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010a927:	e9 d3 f0 ff ff       	jmp    801099ff <alltraps>
+
+8010a92c <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+8010a92c:	6a 00                	push   $0x0
+  pushl $253
+8010a92e:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010a933:	e9 c7 f0 ff ff       	jmp    801099ff <alltraps>
+
+8010a938 <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010a938:	6a 00                	push   $0x0
+  pushl $254
+8010a93a:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+8010a93f:	e9 bb f0 ff ff       	jmp    801099ff <alltraps>
+
+8010a944 <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010a944:	6a 00                	push   $0x0
+  pushl $255
+8010a946:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+8010a94b:	e9 af f0 ff ff       	jmp    801099ff <alltraps>
+
+8010a950 <descalloc>:
+static int
+descalloc(void)
+{
+  int i;
+
+  i = vdisk.freehead;
+8010a950:	0f b7 15 4e 00 14 80 	movzwl 0x8014004e,%edx
+  vdisk.freehead = vdisk.desc[i].next;
+8010a957:	89 d0                	mov    %edx,%eax
+8010a959:	c1 e0 04             	shl    $0x4,%eax
+8010a95c:	03 05 40 00 14 80    	add    0x80140040,%eax
+8010a962:	0f b7 40 0e          	movzwl 0xe(%eax),%eax
+8010a966:	66 a3 4e 00 14 80    	mov    %ax,0x8014004e
+  vdisk.nfree--;
+8010a96c:	a1 50 00 14 80       	mov    0x80140050,%eax
+8010a971:	83 e8 01             	sub    $0x1,%eax
+8010a974:	a3 50 00 14 80       	mov    %eax,0x80140050
+  return i;
+}
+8010a979:	89 d0                	mov    %edx,%eax
+8010a97b:	c3                   	ret
+
+8010a97c <descfree>:
+
+static void
+descfree(int i)
+{
+  vdisk.desc[i].next = vdisk.freehead;
+8010a97c:	89 c2                	mov    %eax,%edx
+8010a97e:	c1 e2 04             	shl    $0x4,%edx
+8010a981:	03 15 40 00 14 80    	add    0x80140040,%edx
+8010a987:	0f b7 0d 4e 00 14 80 	movzwl 0x8014004e,%ecx
+8010a98e:	66 89 4a 0e          	mov    %cx,0xe(%edx)
+  vdisk.freehead = i;
+8010a992:	66 a3 4e 00 14 80    	mov    %ax,0x8014004e
+  vdisk.nfree++;
+8010a998:	a1 50 00 14 80       	mov    0x80140050,%eax
+8010a99d:	83 c0 01             	add    $0x1,%eax
+8010a9a0:	a3 50 00 14 80       	mov    %eax,0x80140050
+}
+8010a9a5:	c3                   	ret
+
+8010a9a6 <virtioqueue>:
+// Put b on the queue as a three-descriptor chain: request
+// header, data, status byte. Caller must hold vdisk.lock and
+// have checked that three descriptors are free.
+static void
+virtioqueue(struct buf *b)
+{
+8010a9a6:	55                   	push   %ebp
+8010a9a7:	89 e5                	mov    %esp,%ebp
+8010a9a9:	57                   	push   %edi
+8010a9aa:	56                   	push   %esi
+8010a9ab:	53                   	push   %ebx
+8010a9ac:	83 ec 1c             	sub    $0x1c,%esp
+8010a9af:	89 c7                	mov    %eax,%edi
+  int h, d, s;
+  struct vring_desc *desc = vdisk.desc;
+8010a9b1:	8b 35 40 00 14 80    	mov    0x80140040,%esi
+
+  h = descalloc();
+8010a9b7:	e8 94 ff ff ff       	call   8010a950 <descalloc>
+8010a9bc:	89 c3                	mov    %eax,%ebx
+  d = descalloc();
+8010a9be:	e8 8d ff ff ff       	call   8010a950 <descalloc>
+8010a9c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  s = descalloc();
+8010a9c6:	e8 85 ff ff ff       	call   8010a950 <descalloc>
+8010a9cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+
+  vdisk.req[h].hdr.type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+8010a9ce:	8b 17                	mov    (%edi),%edx
+8010a9d0:	c1 fa 02             	sar    $0x2,%edx
+8010a9d3:	83 e2 01             	and    $0x1,%edx
+8010a9d6:	8d 0c 1b             	lea    (%ebx,%ebx,1),%ecx
+8010a9d9:	8d 04 19             	lea    (%ecx,%ebx,1),%eax
+8010a9dc:	8d 04 c5 00 00 14 80 	lea    -0x7fec0000(,%eax,8),%eax
+8010a9e3:	89 50 54             	mov    %edx,0x54(%eax)
+  vdisk.req[h].hdr.ioprio = 0;
+8010a9e6:	c7 40 58 00 00 00 00 	movl   $0x0,0x58(%eax)
+  vdisk.req[h].hdr.sector = b->blockno * (BSIZE/512);
+8010a9ed:	8b 57 08             	mov    0x8(%edi),%edx
+8010a9f0:	c1 e2 03             	shl    $0x3,%edx
+8010a9f3:	89 50 5c             	mov    %edx,0x5c(%eax)
+  vdisk.req[h].hdr.sectorhi = 0;
+8010a9f6:	c7 40 60 00 00 00 00 	movl   $0x0,0x60(%eax)
+  vdisk.req[h].status = 0xFF;
+8010a9fd:	c6 40 64 ff          	movb   $0xff,0x64(%eax)
+  vdisk.req[h].b = b;
+8010aa01:	89 78 68             	mov    %edi,0x68(%eax)
+
+  desc[h].addr = V2P(&vdisk.req[h].hdr);
+8010aa04:	01 d9                	add    %ebx,%ecx
+8010aa06:	89 da                	mov    %ebx,%edx
+8010aa08:	c1 e2 04             	shl    $0x4,%edx
+8010aa0b:	89 d0                	mov    %edx,%eax
+8010aa0d:	01 f0                	add    %esi,%eax
+8010aa0f:	8d 14 cd 54 00 14 00 	lea    0x140054(,%ecx,8),%edx
+8010aa16:	89 10                	mov    %edx,(%eax)
+  desc[h].addrhi = 0;
+8010aa18:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  desc[h].len = sizeof(vdisk.req[h].hdr);
+8010aa1f:	c7 40 08 10 00 00 00 	movl   $0x10,0x8(%eax)
+  desc[h].flags = VRING_DESC_F_NEXT;
+8010aa26:	66 c7 40 0c 01 00    	movw   $0x1,0xc(%eax)
+  desc[h].next = d;
+8010aa2c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010aa2f:	66 89 48 0e          	mov    %cx,0xe(%eax)
+
+  desc[d].addr = V2P(b->data);
+8010aa33:	89 c8                	mov    %ecx,%eax
+8010aa35:	c1 e0 04             	shl    $0x4,%eax
+8010aa38:	01 f0                	add    %esi,%eax
+8010aa3a:	8b 4f 60             	mov    0x60(%edi),%ecx
+8010aa3d:	8d 91 00 00 00 80    	lea    -0x80000000(%ecx),%edx
+8010aa43:	89 10                	mov    %edx,(%eax)
+  desc[d].addrhi = 0;
+8010aa45:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  desc[d].len = BSIZE;
+8010aa4c:	c7 40 08 00 10 00 00 	movl   $0x1000,0x8(%eax)
+  desc[d].flags = VRING_DESC_F_NEXT;
+8010aa53:	66 c7 40 0c 01 00    	movw   $0x1,0xc(%eax)
+  if(!(b->flags & B_DIRTY))
+8010aa59:	f6 07 04             	testb  $0x4,(%edi)
+8010aa5c:	75 06                	jne    8010aa64 <virtioqueue+0xbe>
+    desc[d].flags |= VRING_DESC_F_WRITE;
+8010aa5e:	66 c7 40 0c 03 00    	movw   $0x3,0xc(%eax)
+  desc[d].next = s;
+8010aa64:	8b 7d e0             	mov    -0x20(%ebp),%edi
+8010aa67:	66 89 78 0e          	mov    %di,0xe(%eax)
+
+  desc[s].addr = V2P(&vdisk.req[h].status);
+8010aa6b:	8d 14 5b             	lea    (%ebx,%ebx,2),%edx
+8010aa6e:	89 f8                	mov    %edi,%eax
+8010aa70:	c1 e0 04             	shl    $0x4,%eax
+8010aa73:	01 c6                	add    %eax,%esi
+8010aa75:	8d 04 d5 64 00 14 00 	lea    0x140064(,%edx,8),%eax
+8010aa7c:	89 06                	mov    %eax,(%esi)
+  desc[s].addrhi = 0;
+8010aa7e:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+  desc[s].len = 1;
+8010aa85:	c7 46 08 01 00 00 00 	movl   $0x1,0x8(%esi)
+  desc[s].flags = VRING_DESC_F_WRITE;
+8010aa8c:	66 c7 46 0c 02 00    	movw   $0x2,0xc(%esi)
+  desc[s].next = 0;
+8010aa92:	66 c7 46 0e 00 00    	movw   $0x0,0xe(%esi)
+
+  vdisk.avail->ring[vdisk.avail->idx % vdisk.qsize] = h;
+8010aa98:	8b 0d 44 00 14 80    	mov    0x80140044,%ecx
+8010aa9e:	0f b7 41 02          	movzwl 0x2(%ecx),%eax
+8010aaa2:	99                   	cltd
+8010aaa3:	f7 3d 3c 00 14 80    	idivl  0x8014003c
+8010aaa9:	66 89 5c 51 04       	mov    %bx,0x4(%ecx,%edx,2)
+  __sync_synchronize();
+8010aaae:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  vdisk.avail->idx++;
+8010aab3:	8b 15 44 00 14 80    	mov    0x80140044,%edx
+8010aab9:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+8010aabd:	83 c0 01             	add    $0x1,%eax
+8010aac0:	66 89 42 02          	mov    %ax,0x2(%edx)
+}
+8010aac4:	83 c4 1c             	add    $0x1c,%esp
+8010aac7:	5b                   	pop    %ebx
+8010aac8:	5e                   	pop    %esi
+8010aac9:	5f                   	pop    %edi
+8010aaca:	5d                   	pop    %ebp
+8010aacb:	c3                   	ret
+
+8010aacc <virtioinit>:
+{
+8010aacc:	55                   	push   %ebp
+8010aacd:	89 e5                	mov    %esp,%ebp
+8010aacf:	53                   	push   %ebx
+8010aad0:	83 ec 1c             	sub    $0x1c,%esp
+  initlock(&vdisk.lock, "virtio");
+8010aad3:	68 4c cb 10 80       	push   $0x8010cb4c
+8010aad8:	68 00 00 14 80       	push   $0x80140000
+8010aadd:	e8 bc d9 ff ff       	call   8010849e <initlock>
+  if(pcifind(PCI_ID, 0xFFFFFFFF, VIRTIO_BLK<<16 | VIRTIO_VENDOR, &bdf) < 0)
+8010aae2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010aae5:	50                   	push   %eax
+8010aae6:	68 f4 1a 01 10       	push   $0x10011af4
+8010aaeb:	6a ff                	push   $0xffffffff
+8010aaed:	6a 00                	push   $0x0
+8010aaef:	e8 79 ad ff ff       	call   8010586d <pcifind>
+8010aaf4:	83 c4 20             	add    $0x20,%esp
+8010aaf7:	85 c0                	test   %eax,%eax
+8010aaf9:	78 16                	js     8010ab11 <virtioinit+0x45>
+  bar = pciread(bdf, PCI_BAR(0));
+8010aafb:	83 ec 08             	sub    $0x8,%esp
+8010aafe:	6a 10                	push   $0x10
+8010ab00:	ff 75 f4             	push   -0xc(%ebp)
+8010ab03:	e8 14 ad ff ff       	call   8010581c <pciread>
+8010ab08:	89 c3                	mov    %eax,%ebx
+  if((bar & PCI_BAR_IO) == 0)
+8010ab0a:	83 c4 10             	add    $0x10,%esp
+8010ab0d:	a8 01                	test   $0x1,%al
+8010ab0f:	75 05                	jne    8010ab16 <virtioinit+0x4a>
+}
+8010ab11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010ab14:	c9                   	leave
+8010ab15:	c3                   	ret
+           pciread(bdf, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+8010ab16:	83 ec 08             	sub    $0x8,%esp
+8010ab19:	6a 04                	push   $0x4
+8010ab1b:	ff 75 f4             	push   -0xc(%ebp)
+8010ab1e:	e8 f9 ac ff ff       	call   8010581c <pciread>
+  pciwrite(bdf, PCI_COMMAND,
+8010ab23:	83 c4 0c             	add    $0xc,%esp
+8010ab26:	83 c8 05             	or     $0x5,%eax
+8010ab29:	50                   	push   %eax
+8010ab2a:	6a 04                	push   $0x4
+8010ab2c:	ff 75 f4             	push   -0xc(%ebp)
+8010ab2f:	e8 0f ad ff ff       	call   80105843 <pciwrite>
+  vdisk.iobase = bar & 0xFFFC;
+8010ab34:	89 d9                	mov    %ebx,%ecx
+8010ab36:	83 e1 fc             	and    $0xfffffffc,%ecx
+8010ab39:	66 89 0d 34 00 14 80 	mov    %cx,0x80140034
+  outb(vdisk.iobase + VIO_STATUS, 0);  // reset
+8010ab40:	8d 51 12             	lea    0x12(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010ab43:	b8 00 00 00 00       	mov    $0x0,%eax
+8010ab48:	ee                   	out    %al,(%dx)
+8010ab49:	b8 01 00 00 00       	mov    $0x1,%eax
+8010ab4e:	ee                   	out    %al,(%dx)
+8010ab4f:	b8 03 00 00 00       	mov    $0x3,%eax
+8010ab54:	ee                   	out    %al,(%dx)
+  outl(vdisk.iobase + VIO_GUESTFEAT, 0);  // no optional features
+8010ab55:	8d 51 04             	lea    0x4(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010ab58:	b8 00 00 00 00       	mov    $0x0,%eax
+8010ab5d:	ef                   	out    %eax,(%dx)
+  outw(vdisk.iobase + VIO_QSEL, 0);
+8010ab5e:	8d 51 0e             	lea    0xe(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010ab61:	66 ef                	out    %ax,(%dx)
+  n = inw(vdisk.iobase + VIO_QSIZE);
+8010ab63:	8d 51 0c             	lea    0xc(%ecx),%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010ab66:	66 ed                	in     (%dx),%ax
+8010ab68:	0f b7 d8             	movzwl %ax,%ebx
+  if(n < 3 || n > VQMAX){
+8010ab6b:	8d 43 fd             	lea    -0x3(%ebx),%eax
+8010ab6e:	83 c4 10             	add    $0x10,%esp
+8010ab71:	3d fd 00 00 00       	cmp    $0xfd,%eax
+8010ab76:	77 55                	ja     8010abcd <virtioinit+0x101>
+  vdisk.qsize = n;
+8010ab78:	89 1d 3c 00 14 80    	mov    %ebx,0x8014003c
+  memset(vqmem, 0, sizeof(vqmem));
+8010ab7e:	83 ec 04             	sub    $0x4,%esp
+8010ab81:	68 00 30 00 00       	push   $0x3000
+8010ab86:	6a 00                	push   $0x0
+8010ab88:	68 00 20 14 80       	push   $0x80142000
+8010ab8d:	e8 fc da ff ff       	call   8010868e <memset>
+  vdisk.desc = (struct vring_desc*)vqmem;
+8010ab92:	c7 05 40 00 14 80 00 	movl   $0x80142000,0x80140040
+8010ab99:	20 14 80 
+  vdisk.avail = (struct vring_avail*)(vqmem + 16*n);
+8010ab9c:	89 d8                	mov    %ebx,%eax
+8010ab9e:	c1 e0 04             	shl    $0x4,%eax
+8010aba1:	8d 90 00 20 14 80    	lea    -0x7febe000(%eax),%edx
+8010aba7:	89 15 44 00 14 80    	mov    %edx,0x80140044
+  vdisk.used = (struct vring_used*)(vqmem + PGROUNDUP(16*n + 6 + 2*n));
+8010abad:	8d 84 58 05 10 00 00 	lea    0x1005(%eax,%ebx,2),%eax
+8010abb4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010abb9:	05 00 20 14 80       	add    $0x80142000,%eax
+8010abbe:	a3 48 00 14 80       	mov    %eax,0x80140048
+  for(i = 0; i < n; i++)
+8010abc3:	83 c4 10             	add    $0x10,%esp
+8010abc6:	ba 00 00 00 00       	mov    $0x0,%edx
+8010abcb:	eb 44                	jmp    8010ac11 <virtioinit+0x145>
+    cprintf("virtio: unusable queue size %d\n", n);
+8010abcd:	83 ec 08             	sub    $0x8,%esp
+8010abd0:	53                   	push   %ebx
+8010abd1:	68 cc cb 10 80       	push   $0x8010cbcc
+8010abd6:	e8 dc 62 ff ff       	call   80100eb7 <cprintf>
+    outb(vdisk.iobase + VIO_STATUS, VIO_S_FAILED);
+8010abdb:	0f b7 05 34 00 14 80 	movzwl 0x80140034,%eax
+8010abe2:	8d 50 12             	lea    0x12(%eax),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010abe5:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010abea:	ee                   	out    %al,(%dx)
+    vdisk.iobase = 0;
+8010abeb:	66 c7 05 34 00 14 80 	movw   $0x0,0x80140034
+8010abf2:	00 00 
+    return;
+8010abf4:	83 c4 10             	add    $0x10,%esp
+8010abf7:	e9 15 ff ff ff       	jmp    8010ab11 <virtioinit+0x45>
+    vdisk.desc[i].next = i + 1;
+8010abfc:	89 d1                	mov    %edx,%ecx
+8010abfe:	c1 e1 04             	shl    $0x4,%ecx
+8010ac01:	03 0d 40 00 14 80    	add    0x80140040,%ecx
+8010ac07:	8d 42 01             	lea    0x1(%edx),%eax
+8010ac0a:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+  for(i = 0; i < n; i++)
+8010ac0e:	83 c2 01             	add    $0x1,%edx
+8010ac11:	39 da                	cmp    %ebx,%edx
+8010ac13:	7c e7                	jl     8010abfc <virtioinit+0x130>
+  vdisk.freehead = 0;
+8010ac15:	66 c7 05 4e 00 14 80 	movw   $0x0,0x8014004e
+8010ac1c:	00 00 
+  vdisk.nfree = n;
+8010ac1e:	89 1d 50 00 14 80    	mov    %ebx,0x80140050
+  outl(vdisk.iobase + VIO_QADDR, V2P(vqmem) >> PGSHIFT);
+8010ac24:	b8 00 20 14 00       	mov    $0x142000,%eax
+8010ac29:	c1 e8 0c             	shr    $0xc,%eax
+8010ac2c:	0f b7 1d 34 00 14 80 	movzwl 0x80140034,%ebx
+8010ac33:	8d 53 08             	lea    0x8(%ebx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010ac36:	ef                   	out    %eax,(%dx)
+  vdisk.irq = pciread(bdf, PCI_INTR) & 0xFF;
+8010ac37:	83 ec 08             	sub    $0x8,%esp
+8010ac3a:	6a 3c                	push   $0x3c
+8010ac3c:	ff 75 f4             	push   -0xc(%ebp)
+8010ac3f:	e8 d8 ab ff ff       	call   8010581c <pciread>
+8010ac44:	0f b6 c0             	movzbl %al,%eax
+8010ac47:	a3 38 00 14 80       	mov    %eax,0x80140038
+  if(vdisk.irq != IRQ_PCI0 && vdisk.irq != IRQ_PCI1 && vdisk.irq != IRQ_PCI2){
+8010ac4c:	8d 50 f7             	lea    -0x9(%eax),%edx
+8010ac4f:	83 c4 10             	add    $0x10,%esp
+8010ac52:	83 fa 02             	cmp    $0x2,%edx
+8010ac55:	77 2b                	ja     8010ac82 <virtioinit+0x1b6>
+  ioapicenablepci(vdisk.irq, ncpu - 1);
+8010ac57:	83 ec 08             	sub    $0x8,%esp
+8010ac5a:	8b 1d 04 a3 13 80    	mov    0x8013a304,%ebx
+8010ac60:	8d 53 ff             	lea    -0x1(%ebx),%edx
+8010ac63:	52                   	push   %edx
+8010ac64:	50                   	push   %eax
+8010ac65:	e8 53 9a ff ff       	call   801046bd <ioapicenablepci>
+  outb(vdisk.iobase + VIO_STATUS, VIO_S_ACK | VIO_S_DRIVER | VIO_S_DRIVER_OK);
+8010ac6a:	0f b7 05 34 00 14 80 	movzwl 0x80140034,%eax
+8010ac71:	8d 50 12             	lea    0x12(%eax),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010ac74:	b8 07 00 00 00       	mov    $0x7,%eax
+8010ac79:	ee                   	out    %al,(%dx)
+8010ac7a:	83 c4 10             	add    $0x10,%esp
+8010ac7d:	e9 8f fe ff ff       	jmp    8010ab11 <virtioinit+0x45>
+    cprintf("virtio: unexpected irq %d\n", vdisk.irq);
+8010ac82:	83 ec 08             	sub    $0x8,%esp
+8010ac85:	50                   	push   %eax
+8010ac86:	68 53 cb 10 80       	push   $0x8010cb53
+8010ac8b:	e8 27 62 ff ff       	call   80100eb7 <cprintf>
+    outb(vdisk.iobase + VIO_STATUS, VIO_S_FAILED);
+8010ac90:	0f b7 05 34 00 14 80 	movzwl 0x80140034,%eax
+8010ac97:	8d 50 12             	lea    0x12(%eax),%edx
+8010ac9a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010ac9f:	ee                   	out    %al,(%dx)
+    vdisk.iobase = 0;
+8010aca0:	66 c7 05 34 00 14 80 	movw   $0x0,0x80140034
+8010aca7:	00 00 
+    return;
+8010aca9:	83 c4 10             	add    $0x10,%esp
+8010acac:	e9 60 fe ff ff       	jmp    8010ab11 <virtioinit+0x45>
+
+8010acb1 <virtiorw>:
+// set, mark them B_ASYNC and return once they are queued, like
+// idereadahead(). Returns -1 if the bufs are not for a
+// virtio disk. A batch must all be for the same device.
+int
+virtiorw(struct buf **bufs, int n, int async)
+{
+8010acb1:	55                   	push   %ebp
+8010acb2:	89 e5                	mov    %esp,%ebp
+8010acb4:	57                   	push   %edi
+8010acb5:	56                   	push   %esi
+8010acb6:	53                   	push   %ebx
+8010acb7:	83 ec 0c             	sub    $0xc,%esp
+8010acba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i;
+
+  if(vdisk.iobase == 0 || bufs[0]->dev != VIRTIO_DEV)
+8010acbd:	66 83 3d 34 00 14 80 	cmpw   $0x0,0x80140034
+8010acc4:	00 
+8010acc5:	0f 84 3d 01 00 00    	je     8010ae08 <virtiorw+0x157>
+8010accb:	8b 07                	mov    (%edi),%eax
+8010accd:	83 78 04 01          	cmpl   $0x1,0x4(%eax)
+8010acd1:	0f 85 38 01 00 00    	jne    8010ae0f <virtiorw+0x15e>
+    return -1;
+  for(i = 1; i < n; i++)
+8010acd7:	b8 01 00 00 00       	mov    $0x1,%eax
+8010acdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010acdf:	39 c8                	cmp    %ecx,%eax
+8010ace1:	7d 1b                	jge    8010acfe <virtiorw+0x4d>
+    if(bufs[i]->dev != VIRTIO_DEV)
+8010ace3:	8b 14 87             	mov    (%edi,%eax,4),%edx
+8010ace6:	83 7a 04 01          	cmpl   $0x1,0x4(%edx)
+8010acea:	75 05                	jne    8010acf1 <virtiorw+0x40>
+  for(i = 1; i < n; i++)
+8010acec:	83 c0 01             	add    $0x1,%eax
+8010acef:	eb ee                	jmp    8010acdf <virtiorw+0x2e>
+      panic("virtiorw: mixed devices");
+8010acf1:	83 ec 0c             	sub    $0xc,%esp
+8010acf4:	68 6e cb 10 80       	push   $0x8010cb6e
+8010acf9:	e8 f8 5e ff ff       	call   80100bf6 <panic>
+
+  acquire(&vdisk.lock);
+8010acfe:	83 ec 0c             	sub    $0xc,%esp
+8010ad01:	68 00 00 14 80       	push   $0x80140000
+8010ad06:	e8 d7 d8 ff ff       	call   801085e2 <acquire>
+  for(i = 0; i < n; i++){
+8010ad0b:	83 c4 10             	add    $0x10,%esp
+8010ad0e:	be 00 00 00 00       	mov    $0x0,%esi
+8010ad13:	eb 55                	jmp    8010ad6a <virtiorw+0xb9>
+    if(!holdingsleep(&bufs[i]->lock))
+      panic("virtiorw: buf not locked");
+8010ad15:	83 ec 0c             	sub    $0xc,%esp
+8010ad18:	68 86 cb 10 80       	push   $0x8010cb86
+8010ad1d:	e8 d4 5e ff ff       	call   80100bf6 <panic>
+    if((bufs[i]->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("virtiorw: nothing to do");
+    while(vdisk.nfree < 3){
+      // Let the device see what is queued so far.
+      outw(vdisk.iobase + VIO_QNOTIFY, 0);
+8010ad22:	0f b7 05 34 00 14 80 	movzwl 0x80140034,%eax
+8010ad29:	8d 50 10             	lea    0x10(%eax),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010ad2c:	b8 00 00 00 00       	mov    $0x0,%eax
+8010ad31:	66 ef                	out    %ax,(%dx)
+      sleep(&vdisk.nfree, &vdisk.lock);
+8010ad33:	83 ec 08             	sub    $0x8,%esp
+8010ad36:	68 00 00 14 80       	push   $0x80140000
+8010ad3b:	68 50 00 14 80       	push   $0x80140050
+8010ad40:	e8 27 cb ff ff       	call   8010786c <sleep>
+8010ad45:	83 c4 10             	add    $0x10,%esp
+    while(vdisk.nfree < 3){
+8010ad48:	83 3d 50 00 14 80 02 	cmpl   $0x2,0x80140050
+8010ad4f:	7e d1                	jle    8010ad22 <virtiorw+0x71>
+    }
+    if(async)
+8010ad51:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+8010ad55:	74 09                	je     8010ad60 <virtiorw+0xaf>
+      bufs[i]->flags |= B_ASYNC;
+8010ad57:	8b 13                	mov    (%ebx),%edx
+8010ad59:	8b 02                	mov    (%edx),%eax
+8010ad5b:	83 c8 08             	or     $0x8,%eax
+8010ad5e:	89 02                	mov    %eax,(%edx)
+    virtioqueue(bufs[i]);
+8010ad60:	8b 03                	mov    (%ebx),%eax
+8010ad62:	e8 3f fc ff ff       	call   8010a9a6 <virtioqueue>
+  for(i = 0; i < n; i++){
+8010ad67:	83 c6 01             	add    $0x1,%esi
+8010ad6a:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010ad6d:	7d 31                	jge    8010ada0 <virtiorw+0xef>
+    if(!holdingsleep(&bufs[i]->lock))
+8010ad6f:	8d 1c b7             	lea    (%edi,%esi,4),%ebx
+8010ad72:	83 ec 0c             	sub    $0xc,%esp
+8010ad75:	8b 03                	mov    (%ebx),%eax
+8010ad77:	83 c0 0c             	add    $0xc,%eax
+8010ad7a:	50                   	push   %eax
+8010ad7b:	e8 f7 d6 ff ff       	call   80108477 <holdingsleep>
+8010ad80:	83 c4 10             	add    $0x10,%esp
+8010ad83:	85 c0                	test   %eax,%eax
+8010ad85:	74 8e                	je     8010ad15 <virtiorw+0x64>
+    if((bufs[i]->flags & (B_VALID|B_DIRTY)) == B_VALID)
+8010ad87:	8b 03                	mov    (%ebx),%eax
+8010ad89:	8b 00                	mov    (%eax),%eax
+8010ad8b:	83 e0 06             	and    $0x6,%eax
+8010ad8e:	83 f8 02             	cmp    $0x2,%eax
+8010ad91:	75 b5                	jne    8010ad48 <virtiorw+0x97>
+      panic("virtiorw: nothing to do");
+8010ad93:	83 ec 0c             	sub    $0xc,%esp
+8010ad96:	68 9f cb 10 80       	push   $0x8010cb9f
+8010ad9b:	e8 56 5e ff ff       	call   80100bf6 <panic>
+  }
+  __sync_synchronize();
+8010ada0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  outw(vdisk.iobase + VIO_QNOTIFY, 0);
+8010ada5:	0f b7 05 34 00 14 80 	movzwl 0x80140034,%eax
+8010adac:	8d 50 10             	lea    0x10(%eax),%edx
+8010adaf:	b8 00 00 00 00       	mov    $0x0,%eax
+8010adb4:	66 ef                	out    %ax,(%dx)
+
+  if(!async)
+8010adb6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+8010adba:	74 44                	je     8010ae00 <virtiorw+0x14f>
+    for(i = 0; i < n; i++)
+      while((bufs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+        sleep(bufs[i], &vdisk.lock);
+  release(&vdisk.lock);
+8010adbc:	83 ec 0c             	sub    $0xc,%esp
+8010adbf:	68 00 00 14 80       	push   $0x80140000
+8010adc4:	e8 7e d8 ff ff       	call   80108647 <release>
+  return 0;
+8010adc9:	83 c4 10             	add    $0x10,%esp
+8010adcc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010add1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010add4:	5b                   	pop    %ebx
+8010add5:	5e                   	pop    %esi
+8010add6:	5f                   	pop    %edi
+8010add7:	5d                   	pop    %ebp
+8010add8:	c3                   	ret
+        sleep(bufs[i], &vdisk.lock);
+8010add9:	83 ec 08             	sub    $0x8,%esp
+8010addc:	68 00 00 14 80       	push   $0x80140000
+8010ade1:	52                   	push   %edx
+8010ade2:	e8 85 ca ff ff       	call   8010786c <sleep>
+8010ade7:	83 c4 10             	add    $0x10,%esp
+      while((bufs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+8010adea:	8b 14 9f             	mov    (%edi,%ebx,4),%edx
+8010aded:	8b 02                	mov    (%edx),%eax
+8010adef:	83 e0 06             	and    $0x6,%eax
+8010adf2:	83 f8 02             	cmp    $0x2,%eax
+8010adf5:	75 e2                	jne    8010add9 <virtiorw+0x128>
+    for(i = 0; i < n; i++)
+8010adf7:	83 c3 01             	add    $0x1,%ebx
+8010adfa:	39 f3                	cmp    %esi,%ebx
+8010adfc:	7c ec                	jl     8010adea <virtiorw+0x139>
+8010adfe:	eb bc                	jmp    8010adbc <virtiorw+0x10b>
+8010ae00:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010ae03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010ae06:	eb f2                	jmp    8010adfa <virtiorw+0x149>
+    return -1;
+8010ae08:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ae0d:	eb c2                	jmp    8010add1 <virtiorw+0x120>
+8010ae0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ae14:	eb bb                	jmp    8010add1 <virtiorw+0x120>
+
+8010ae16 <virtiowait>:
+
+// Wait for a read-ahead into b to complete, like idewaitahead().
+// Returns -1 if b is not for a virtio disk.
+int
+virtiowait(struct buf *b)
+{
+8010ae16:	55                   	push   %ebp
+8010ae17:	89 e5                	mov    %esp,%ebp
+8010ae19:	56                   	push   %esi
+8010ae1a:	53                   	push   %ebx
+8010ae1b:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(vdisk.iobase == 0 || b->dev != VIRTIO_DEV)
+8010ae1e:	66 83 3d 34 00 14 80 	cmpw   $0x0,0x80140034
+8010ae25:	00 
+8010ae26:	74 49                	je     8010ae71 <virtiowait+0x5b>
+8010ae28:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+8010ae2c:	75 4a                	jne    8010ae78 <virtiowait+0x62>
+    return -1;
+  acquire(&vdisk.lock);
+8010ae2e:	83 ec 0c             	sub    $0xc,%esp
+8010ae31:	68 00 00 14 80       	push   $0x80140000
+8010ae36:	e8 a7 d7 ff ff       	call   801085e2 <acquire>
+  while(b->flags & B_ASYNC)
+8010ae3b:	83 c4 10             	add    $0x10,%esp
+8010ae3e:	eb 11                	jmp    8010ae51 <virtiowait+0x3b>
+    sleep(b, &vdisk.lock);
+8010ae40:	83 ec 08             	sub    $0x8,%esp
+8010ae43:	68 00 00 14 80       	push   $0x80140000
+8010ae48:	56                   	push   %esi
+8010ae49:	e8 1e ca ff ff       	call   8010786c <sleep>
+8010ae4e:	83 c4 10             	add    $0x10,%esp
+  while(b->flags & B_ASYNC)
+8010ae51:	8b 1e                	mov    (%esi),%ebx
+8010ae53:	83 e3 08             	and    $0x8,%ebx
+8010ae56:	75 e8                	jne    8010ae40 <virtiowait+0x2a>
+  release(&vdisk.lock);
+8010ae58:	83 ec 0c             	sub    $0xc,%esp
+8010ae5b:	68 00 00 14 80       	push   $0x80140000
+8010ae60:	e8 e2 d7 ff ff       	call   80108647 <release>
+  return 0;
+8010ae65:	83 c4 10             	add    $0x10,%esp
+}
+8010ae68:	89 d8                	mov    %ebx,%eax
+8010ae6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010ae6d:	5b                   	pop    %ebx
+8010ae6e:	5e                   	pop    %esi
+8010ae6f:	5d                   	pop    %ebp
+8010ae70:	c3                   	ret
+    return -1;
+8010ae71:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010ae76:	eb f0                	jmp    8010ae68 <virtiowait+0x52>
+8010ae78:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010ae7d:	eb e9                	jmp    8010ae68 <virtiowait+0x52>
+
+8010ae7f <virtiointr>:
+virtiointr(int irq)
+{
+  struct buf *b;
+  int h, d;
+
+  if(vdisk.iobase == 0 || irq != vdisk.irq)
+8010ae7f:	66 83 3d 34 00 14 80 	cmpw   $0x0,0x80140034
+8010ae86:	00 
+8010ae87:	0f 84 0d 01 00 00    	je     8010af9a <virtiointr+0x11b>
+{
+8010ae8d:	55                   	push   %ebp
+8010ae8e:	89 e5                	mov    %esp,%ebp
+8010ae90:	56                   	push   %esi
+8010ae91:	53                   	push   %ebx
+  if(vdisk.iobase == 0 || irq != vdisk.irq)
+8010ae92:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ae95:	39 05 38 00 14 80    	cmp    %eax,0x80140038
+8010ae9b:	74 07                	je     8010aea4 <virtiointr+0x25>
+    vdisk.usedidx++;
+  }
+  wakeup(&vdisk.nfree);
+
+  release(&vdisk.lock);
+}
+8010ae9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010aea0:	5b                   	pop    %ebx
+8010aea1:	5e                   	pop    %esi
+8010aea2:	5d                   	pop    %ebp
+8010aea3:	c3                   	ret
+  acquire(&vdisk.lock);
+8010aea4:	83 ec 0c             	sub    $0xc,%esp
+8010aea7:	68 00 00 14 80       	push   $0x80140000
+8010aeac:	e8 31 d7 ff ff       	call   801085e2 <acquire>
+  inb(vdisk.iobase + VIO_ISR);  // acknowledge
+8010aeb1:	0f b7 05 34 00 14 80 	movzwl 0x80140034,%eax
+8010aeb8:	8d 50 13             	lea    0x13(%eax),%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010aebb:	ec                   	in     (%dx),%al
+  return data;
+8010aebc:	83 c4 10             	add    $0x10,%esp
+  while(vdisk.usedidx != *(volatile ushort*)&vdisk.used->idx){
+8010aebf:	a1 48 00 14 80       	mov    0x80140048,%eax
+8010aec4:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+8010aec8:	66 39 05 4c 00 14 80 	cmp    %ax,0x8014004c
+8010aecf:	0f 84 a4 00 00 00    	je     8010af79 <virtiointr+0xfa>
+    __sync_synchronize();
+8010aed5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    h = vdisk.used->ring[vdisk.usedidx % vdisk.qsize].id;
+8010aeda:	0f b7 05 4c 00 14 80 	movzwl 0x8014004c,%eax
+8010aee1:	99                   	cltd
+8010aee2:	f7 3d 3c 00 14 80    	idivl  0x8014003c
+8010aee8:	a1 48 00 14 80       	mov    0x80140048,%eax
+8010aeed:	8b 5c d0 04          	mov    0x4(%eax,%edx,8),%ebx
+    b = vdisk.req[h].b;
+8010aef1:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+8010aef4:	01 da                	add    %ebx,%edx
+8010aef6:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+8010aefd:	8b 90 68 00 14 80    	mov    -0x7febff98(%eax),%edx
+8010af03:	05 00 00 14 80       	add    $0x80140000,%eax
+    if(vdisk.req[h].status != 0)
+8010af08:	80 78 64 00          	cmpb   $0x0,0x64(%eax)
+8010af0c:	75 5e                	jne    8010af6c <virtiointr+0xed>
+    b->flags |= B_VALID;
+8010af0e:	8b 02                	mov    (%edx),%eax
+8010af10:	89 c1                	mov    %eax,%ecx
+8010af12:	83 c9 02             	or     $0x2,%ecx
+8010af15:	89 0a                	mov    %ecx,(%edx)
+    b->flags &= ~(B_DIRTY|B_ASYNC);
+8010af17:	83 e0 f3             	and    $0xfffffff3,%eax
+8010af1a:	83 c8 02             	or     $0x2,%eax
+8010af1d:	89 02                	mov    %eax,(%edx)
+    wakeup(b);
+8010af1f:	83 ec 0c             	sub    $0xc,%esp
+8010af22:	52                   	push   %edx
+8010af23:	e8 21 bf ff ff       	call   80106e49 <wakeup>
+    d = vdisk.desc[h].next;
+8010af28:	a1 40 00 14 80       	mov    0x80140040,%eax
+8010af2d:	89 da                	mov    %ebx,%edx
+8010af2f:	c1 e2 04             	shl    $0x4,%edx
+8010af32:	0f b7 74 10 0e       	movzwl 0xe(%eax,%edx,1),%esi
+    descfree(vdisk.desc[d].next);
+8010af37:	89 f2                	mov    %esi,%edx
+8010af39:	c1 e2 04             	shl    $0x4,%edx
+8010af3c:	0f b7 44 10 0e       	movzwl 0xe(%eax,%edx,1),%eax
+8010af41:	e8 36 fa ff ff       	call   8010a97c <descfree>
+    descfree(d);
+8010af46:	89 f0                	mov    %esi,%eax
+8010af48:	e8 2f fa ff ff       	call   8010a97c <descfree>
+    descfree(h);
+8010af4d:	89 d8                	mov    %ebx,%eax
+8010af4f:	e8 28 fa ff ff       	call   8010a97c <descfree>
+    vdisk.usedidx++;
+8010af54:	0f b7 05 4c 00 14 80 	movzwl 0x8014004c,%eax
+8010af5b:	83 c0 01             	add    $0x1,%eax
+8010af5e:	66 a3 4c 00 14 80    	mov    %ax,0x8014004c
+8010af64:	83 c4 10             	add    $0x10,%esp
+8010af67:	e9 53 ff ff ff       	jmp    8010aebf <virtiointr+0x40>
+      panic("virtio: I/O error");
+8010af6c:	83 ec 0c             	sub    $0xc,%esp
+8010af6f:	68 b7 cb 10 80       	push   $0x8010cbb7
+8010af74:	e8 7d 5c ff ff       	call   80100bf6 <panic>
+  wakeup(&vdisk.nfree);
+8010af79:	83 ec 0c             	sub    $0xc,%esp
+8010af7c:	68 50 00 14 80       	push   $0x80140050
+8010af81:	e8 c3 be ff ff       	call   80106e49 <wakeup>
+  release(&vdisk.lock);
+8010af86:	c7 04 24 00 00 14 80 	movl   $0x80140000,(%esp)
+8010af8d:	e8 b5 d6 ff ff       	call   80108647 <release>
+8010af92:	83 c4 10             	add    $0x10,%esp
+8010af95:	e9 03 ff ff ff       	jmp    8010ae9d <virtiointr+0x1e>
+8010af9a:	c3                   	ret
+
+8010af9b <walkpgdir>:
+// Return the address of the PTE in page table pgdir
+// that corresponds to virtual address va.  If alloc!=0,
+// create any required page table pages.
+static pte_t *
+walkpgdir(pde_t *pgdir, const void *va, int alloc)
+{
+8010af9b:	55                   	push   %ebp
+8010af9c:	89 e5                	mov    %esp,%ebp
+8010af9e:	57                   	push   %edi
+8010af9f:	56                   	push   %esi
+8010afa0:	53                   	push   %ebx
+8010afa1:	83 ec 0c             	sub    $0xc,%esp
+8010afa4:	89 d3                	mov    %edx,%ebx
+  pde_t *pde;
+  pte_t *pgtab;
+
+  pde = &pgdir[PDX(va)];
+8010afa6:	c1 ea 16             	shr    $0x16,%edx
+8010afa9:	8d 3c 90             	lea    (%eax,%edx,4),%edi
+  if(*pde & PTE_P){
+8010afac:	8b 37                	mov    (%edi),%esi
+8010afae:	f7 c6 01 00 00 00    	test   $0x1,%esi
+8010afb4:	74 20                	je     8010afd6 <walkpgdir+0x3b>
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010afb6:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+8010afbc:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+    // The permissions here are overly generous, but they can
+    // be further restricted by the permissions in the page table
+    // entries, if necessary.
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+  }
+  return &pgtab[PTX(va)];
+8010afc2:	c1 eb 0c             	shr    $0xc,%ebx
+8010afc5:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+8010afcb:	8d 04 9e             	lea    (%esi,%ebx,4),%eax
+}
+8010afce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010afd1:	5b                   	pop    %ebx
+8010afd2:	5e                   	pop    %esi
+8010afd3:	5f                   	pop    %edi
+8010afd4:	5d                   	pop    %ebp
+8010afd5:	c3                   	ret
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010afd6:	85 c9                	test   %ecx,%ecx
+8010afd8:	74 2b                	je     8010b005 <walkpgdir+0x6a>
+8010afda:	e8 51 9b ff ff       	call   80104b30 <kalloc>
+8010afdf:	89 c6                	mov    %eax,%esi
+8010afe1:	85 c0                	test   %eax,%eax
+8010afe3:	74 20                	je     8010b005 <walkpgdir+0x6a>
+    memset(pgtab, 0, PGSIZE);
+8010afe5:	83 ec 04             	sub    $0x4,%esp
+8010afe8:	68 00 10 00 00       	push   $0x1000
+8010afed:	6a 00                	push   $0x0
+8010afef:	50                   	push   %eax
+8010aff0:	e8 99 d6 ff ff       	call   8010868e <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010aff5:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+8010affb:	83 c8 07             	or     $0x7,%eax
+8010affe:	89 07                	mov    %eax,(%edi)
+8010b000:	83 c4 10             	add    $0x10,%esp
+8010b003:	eb bd                	jmp    8010afc2 <walkpgdir+0x27>
+      return 0;
+8010b005:	b8 00 00 00 00       	mov    $0x0,%eax
+8010b00a:	eb c2                	jmp    8010afce <walkpgdir+0x33>
+
+8010b00c <mappages>:
+// Create PTEs for virtual addresses starting at va that refer to
+// physical addresses starting at pa. va and size might not
+// be page-aligned.
+static int
+mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
+{
+8010b00c:	55                   	push   %ebp
+8010b00d:	89 e5                	mov    %esp,%ebp
+8010b00f:	57                   	push   %edi
+8010b010:	56                   	push   %esi
+8010b011:	53                   	push   %ebx
+8010b012:	83 ec 1c             	sub    $0x1c,%esp
+8010b015:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010b018:	8b 75 08             	mov    0x8(%ebp),%esi
+  char *a, *last;
+  pte_t *pte;
+
+  a = (char*)PGROUNDDOWN((uint)va);
+8010b01b:	89 d3                	mov    %edx,%ebx
+8010b01d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010b023:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+8010b027:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b02c:	89 c7                	mov    %eax,%edi
+  for(;;){
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010b02e:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010b033:	89 da                	mov    %ebx,%edx
+8010b035:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b038:	e8 5e ff ff ff       	call   8010af9b <walkpgdir>
+8010b03d:	85 c0                	test   %eax,%eax
+8010b03f:	74 2e                	je     8010b06f <mappages+0x63>
+      return -1;
+    if(*pte & PTE_P)
+8010b041:	f6 00 01             	testb  $0x1,(%eax)
+8010b044:	75 1c                	jne    8010b062 <mappages+0x56>
+      panic("remap");
+    *pte = pa | perm | PTE_P;
+8010b046:	89 f2                	mov    %esi,%edx
+8010b048:	0b 55 0c             	or     0xc(%ebp),%edx
+8010b04b:	83 ca 01             	or     $0x1,%edx
+8010b04e:	89 10                	mov    %edx,(%eax)
+    if(a == last)
+8010b050:	39 fb                	cmp    %edi,%ebx
+8010b052:	74 28                	je     8010b07c <mappages+0x70>
+      break;
+    a += PGSIZE;
+8010b054:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    pa += PGSIZE;
+8010b05a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010b060:	eb cc                	jmp    8010b02e <mappages+0x22>
+      panic("remap");
+8010b062:	83 ec 0c             	sub    $0xc,%esp
+8010b065:	68 ec cb 10 80       	push   $0x8010cbec
+8010b06a:	e8 87 5b ff ff       	call   80100bf6 <panic>
+      return -1;
+8010b06f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return 0;
+}
+8010b074:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b077:	5b                   	pop    %ebx
+8010b078:	5e                   	pop    %esi
+8010b079:	5f                   	pop    %edi
+8010b07a:	5d                   	pop    %ebp
+8010b07b:	c3                   	ret
+  return 0;
+8010b07c:	b8 00 00 00 00       	mov    $0x0,%eax
+8010b081:	eb f1                	jmp    8010b074 <mappages+0x68>
+
+8010b083 <loadpage>:
+// user page va, if any. May sleep, so only called from process
+// context with no locks held. The file can't be written while
+// p runs it (see iexecref), so late pages match early ones.
+static int
+loadpage(struct proc *p, char *mem, uint va)
+{
+8010b083:	55                   	push   %ebp
+8010b084:	89 e5                	mov    %esp,%ebp
+8010b086:	57                   	push   %edi
+8010b087:	56                   	push   %esi
+8010b088:	53                   	push   %ebx
+8010b089:	83 ec 1c             	sub    $0x1c,%esp
+8010b08c:	89 c6                	mov    %eax,%esi
+8010b08e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010b091:	89 cf                	mov    %ecx,%edi
+  struct seg *s;
+  uint n;
+
+  for(s = p->seg; s < &p->seg[p->nseg]; s++){
+8010b093:	8d 98 80 00 00 00    	lea    0x80(%eax),%ebx
+8010b099:	eb 03                	jmp    8010b09e <loadpage+0x1b>
+8010b09b:	83 c3 0c             	add    $0xc,%ebx
+8010b09e:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+8010b0a4:	8d 04 40             	lea    (%eax,%eax,2),%eax
+8010b0a7:	8d 84 86 80 00 00 00 	lea    0x80(%esi,%eax,4),%eax
+8010b0ae:	39 c3                	cmp    %eax,%ebx
+8010b0b0:	0f 83 a6 00 00 00    	jae    8010b15c <loadpage+0xd9>
+    if(va < s->vaddr || va >= s->vaddr + s->filesz)
+8010b0b6:	8b 03                	mov    (%ebx),%eax
+8010b0b8:	39 c7                	cmp    %eax,%edi
+8010b0ba:	72 df                	jb     8010b09b <loadpage+0x18>
+8010b0bc:	03 43 04             	add    0x4(%ebx),%eax
+8010b0bf:	39 c7                	cmp    %eax,%edi
+8010b0c1:	73 d8                	jae    8010b09b <loadpage+0x18>
+      continue;
+    n = s->vaddr + s->filesz - va;
+8010b0c3:	29 f8                	sub    %edi,%eax
+8010b0c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(n > PGSIZE)
+8010b0c8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+8010b0cd:	76 07                	jbe    8010b0d6 <loadpage+0x53>
+      n = PGSIZE;
+8010b0cf:	c7 45 e4 00 10 00 00 	movl   $0x1000,-0x1c(%ebp)
+    ilock(p->exe);
+8010b0d6:	83 ec 0c             	sub    $0xc,%esp
+8010b0d9:	ff 76 7c             	push   0x7c(%esi)
+8010b0dc:	e8 40 7e ff ff       	call   80102f21 <ilock>
+    if(readi(p->exe, mem, s->off + (va - s->vaddr), n) != n){
+8010b0e1:	89 f8                	mov    %edi,%eax
+8010b0e3:	2b 03                	sub    (%ebx),%eax
+8010b0e5:	ff 75 e4             	push   -0x1c(%ebp)
+8010b0e8:	03 43 08             	add    0x8(%ebx),%eax
+8010b0eb:	50                   	push   %eax
+8010b0ec:	ff 75 e0             	push   -0x20(%ebp)
+8010b0ef:	ff 76 7c             	push   0x7c(%esi)
+8010b0f2:	e8 32 81 ff ff       	call   80103229 <readi>
+8010b0f7:	83 c4 20             	add    $0x20,%esp
+8010b0fa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010b0fd:	39 c8                	cmp    %ecx,%eax
+8010b0ff:	75 2b                	jne    8010b12c <loadpage+0xa9>
+      iunlock(p->exe);
+      return -1;
+    }
+    // Programs mostly fault their way forward through a
+    // segment, so start reading the next page now.
+    if(va + n < s->vaddr + s->filesz)
+8010b101:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b104:	01 f8                	add    %edi,%eax
+8010b106:	8b 13                	mov    (%ebx),%edx
+8010b108:	89 d1                	mov    %edx,%ecx
+8010b10a:	03 4b 04             	add    0x4(%ebx),%ecx
+8010b10d:	39 c8                	cmp    %ecx,%eax
+8010b10f:	72 30                	jb     8010b141 <loadpage+0xbe>
+      readahead(p->exe, s->off + (va + n - s->vaddr), PGSIZE);
+    iunlock(p->exe);
+8010b111:	83 ec 0c             	sub    $0xc,%esp
+8010b114:	ff 76 7c             	push   0x7c(%esi)
+8010b117:	e8 da 7e ff ff       	call   80102ff6 <iunlock>
+    break;
+8010b11c:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+8010b11f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010b124:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b127:	5b                   	pop    %ebx
+8010b128:	5e                   	pop    %esi
+8010b129:	5f                   	pop    %edi
+8010b12a:	5d                   	pop    %ebp
+8010b12b:	c3                   	ret
+      iunlock(p->exe);
+8010b12c:	83 ec 0c             	sub    $0xc,%esp
+8010b12f:	ff 76 7c             	push   0x7c(%esi)
+8010b132:	e8 bf 7e ff ff       	call   80102ff6 <iunlock>
+      return -1;
+8010b137:	83 c4 10             	add    $0x10,%esp
+8010b13a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b13f:	eb e3                	jmp    8010b124 <loadpage+0xa1>
+      readahead(p->exe, s->off + (va + n - s->vaddr), PGSIZE);
+8010b141:	29 d0                	sub    %edx,%eax
+8010b143:	83 ec 04             	sub    $0x4,%esp
+8010b146:	68 00 10 00 00       	push   $0x1000
+8010b14b:	03 43 08             	add    0x8(%ebx),%eax
+8010b14e:	50                   	push   %eax
+8010b14f:	ff 76 7c             	push   0x7c(%esi)
+8010b152:	e8 50 80 ff ff       	call   801031a7 <readahead>
+8010b157:	83 c4 10             	add    $0x10,%esp
+8010b15a:	eb b5                	jmp    8010b111 <loadpage+0x8e>
+  return 0;
+8010b15c:	b8 00 00 00 00       	mov    $0x0,%eax
+8010b161:	eb c1                	jmp    8010b124 <loadpage+0xa1>
+
+8010b163 <cowpage>:
+{
+8010b163:	55                   	push   %ebp
+8010b164:	89 e5                	mov    %esp,%ebp
+8010b166:	57                   	push   %edi
+8010b167:	56                   	push   %esi
+8010b168:	53                   	push   %ebx
+8010b169:	83 ec 28             	sub    $0x28,%esp
+8010b16c:	89 c6                	mov    %eax,%esi
+8010b16e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pa = PTE_ADDR(*pte);
+8010b171:	8b 18                	mov    (%eax),%ebx
+8010b173:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(krefcount(P2V(pa)) > 1){
+8010b179:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+8010b17f:	53                   	push   %ebx
+8010b180:	e8 74 97 ff ff       	call   801048f9 <krefcount>
+8010b185:	83 c4 10             	add    $0x10,%esp
+8010b188:	83 f8 01             	cmp    $0x1,%eax
+8010b18b:	7f 1f                	jg     8010b1ac <cowpage+0x49>
+  *pte = (*pte | PTE_W) & ~PTE_COW;
+8010b18d:	8b 06                	mov    (%esi),%eax
+8010b18f:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+8010b194:	83 c8 02             	or     $0x2,%eax
+8010b197:	89 06                	mov    %eax,(%esi)
+}
+
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+8010b199:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b19c:	0f 01 38             	invlpg (%eax)
+  return 0;
+8010b19f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010b1a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b1a7:	5b                   	pop    %ebx
+8010b1a8:	5e                   	pop    %esi
+8010b1a9:	5f                   	pop    %edi
+8010b1aa:	5d                   	pop    %ebp
+8010b1ab:	c3                   	ret
+    if((mem = kalloc()) == 0)
+8010b1ac:	e8 7f 99 ff ff       	call   80104b30 <kalloc>
+8010b1b1:	89 c7                	mov    %eax,%edi
+8010b1b3:	85 c0                	test   %eax,%eax
+8010b1b5:	74 2d                	je     8010b1e4 <cowpage+0x81>
+    memmove(mem, P2V(pa), PGSIZE);
+8010b1b7:	83 ec 04             	sub    $0x4,%esp
+8010b1ba:	68 00 10 00 00       	push   $0x1000
+8010b1bf:	53                   	push   %ebx
+8010b1c0:	50                   	push   %eax
+8010b1c1:	e8 40 d5 ff ff       	call   80108706 <memmove>
+    *pte = V2P(mem) | PTE_FLAGS(*pte);
+8010b1c6:	81 c7 00 00 00 80    	add    $0x80000000,%edi
+8010b1cc:	8b 06                	mov    (%esi),%eax
+8010b1ce:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010b1d3:	09 c7                	or     %eax,%edi
+8010b1d5:	89 3e                	mov    %edi,(%esi)
+    kfree(P2V(pa));
+8010b1d7:	89 1c 24             	mov    %ebx,(%esp)
+8010b1da:	e8 32 97 ff ff       	call   80104911 <kfree>
+8010b1df:	83 c4 10             	add    $0x10,%esp
+8010b1e2:	eb a9                	jmp    8010b18d <cowpage+0x2a>
+      return -1;
+8010b1e4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b1e9:	eb b9                	jmp    8010b1a4 <cowpage+0x41>
+
+8010b1eb <seginit>:
+{
+8010b1eb:	55                   	push   %ebp
+8010b1ec:	89 e5                	mov    %esp,%ebp
+8010b1ee:	57                   	push   %edi
+8010b1ef:	56                   	push   %esi
+8010b1f0:	53                   	push   %ebx
+8010b1f1:	83 ec 1c             	sub    $0x1c,%esp
+  c = &cpus[cpuid()];
+8010b1f4:	e8 38 b7 ff ff       	call   80106931 <cpuid>
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010b1f9:	69 f8 b0 00 00 00    	imul   $0xb0,%eax,%edi
+8010b1ff:	66 c7 87 98 a3 13 80 	movw   $0xffff,-0x7fec5c68(%edi)
+8010b206:	ff ff 
+8010b208:	66 c7 87 9a a3 13 80 	movw   $0x0,-0x7fec5c66(%edi)
+8010b20f:	00 00 
+8010b211:	c6 87 9c a3 13 80 00 	movb   $0x0,-0x7fec5c64(%edi)
+8010b218:	0f b6 8f 9d a3 13 80 	movzbl -0x7fec5c63(%edi),%ecx
+8010b21f:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010b222:	89 ce                	mov    %ecx,%esi
+8010b224:	83 ce 0a             	or     $0xa,%esi
+8010b227:	89 f2                	mov    %esi,%edx
+8010b229:	88 97 9d a3 13 80    	mov    %dl,-0x7fec5c63(%edi)
+8010b22f:	83 c9 1a             	or     $0x1a,%ecx
+8010b232:	88 8f 9d a3 13 80    	mov    %cl,-0x7fec5c63(%edi)
+8010b238:	83 e1 9f             	and    $0xffffff9f,%ecx
+8010b23b:	88 8f 9d a3 13 80    	mov    %cl,-0x7fec5c63(%edi)
+8010b241:	83 c9 80             	or     $0xffffff80,%ecx
+8010b244:	88 8f 9d a3 13 80    	mov    %cl,-0x7fec5c63(%edi)
+8010b24a:	0f b6 8f 9e a3 13 80 	movzbl -0x7fec5c62(%edi),%ecx
+8010b251:	83 c9 0f             	or     $0xf,%ecx
+8010b254:	88 8f 9e a3 13 80    	mov    %cl,-0x7fec5c62(%edi)
+8010b25a:	89 ce                	mov    %ecx,%esi
+8010b25c:	83 e6 ef             	and    $0xffffffef,%esi
+8010b25f:	89 f2                	mov    %esi,%edx
+8010b261:	88 97 9e a3 13 80    	mov    %dl,-0x7fec5c62(%edi)
+8010b267:	83 e1 cf             	and    $0xffffffcf,%ecx
+8010b26a:	88 8f 9e a3 13 80    	mov    %cl,-0x7fec5c62(%edi)
+8010b270:	89 ce                	mov    %ecx,%esi
+8010b272:	83 ce 40             	or     $0x40,%esi
+8010b275:	89 f2                	mov    %esi,%edx
+8010b277:	88 97 9e a3 13 80    	mov    %dl,-0x7fec5c62(%edi)
+8010b27d:	83 c9 c0             	or     $0xffffffc0,%ecx
+8010b280:	88 8f 9e a3 13 80    	mov    %cl,-0x7fec5c62(%edi)
+8010b286:	c6 87 9f a3 13 80 00 	movb   $0x0,-0x7fec5c61(%edi)
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010b28d:	66 c7 87 a0 a3 13 80 	movw   $0xffff,-0x7fec5c60(%edi)
+8010b294:	ff ff 
+8010b296:	66 c7 87 a2 a3 13 80 	movw   $0x0,-0x7fec5c5e(%edi)
+8010b29d:	00 00 
+8010b29f:	c6 87 a4 a3 13 80 00 	movb   $0x0,-0x7fec5c5c(%edi)
+8010b2a6:	0f b6 8f a5 a3 13 80 	movzbl -0x7fec5c5b(%edi),%ecx
+8010b2ad:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010b2b0:	89 ce                	mov    %ecx,%esi
+8010b2b2:	83 ce 02             	or     $0x2,%esi
+8010b2b5:	89 f2                	mov    %esi,%edx
+8010b2b7:	88 97 a5 a3 13 80    	mov    %dl,-0x7fec5c5b(%edi)
+8010b2bd:	83 c9 12             	or     $0x12,%ecx
+8010b2c0:	88 8f a5 a3 13 80    	mov    %cl,-0x7fec5c5b(%edi)
+8010b2c6:	83 e1 9f             	and    $0xffffff9f,%ecx
+8010b2c9:	88 8f a5 a3 13 80    	mov    %cl,-0x7fec5c5b(%edi)
+8010b2cf:	83 c9 80             	or     $0xffffff80,%ecx
+8010b2d2:	88 8f a5 a3 13 80    	mov    %cl,-0x7fec5c5b(%edi)
+8010b2d8:	0f b6 8f a6 a3 13 80 	movzbl -0x7fec5c5a(%edi),%ecx
+8010b2df:	83 c9 0f             	or     $0xf,%ecx
+8010b2e2:	88 8f a6 a3 13 80    	mov    %cl,-0x7fec5c5a(%edi)
+8010b2e8:	89 ce                	mov    %ecx,%esi
+8010b2ea:	83 e6 ef             	and    $0xffffffef,%esi
+8010b2ed:	89 f2                	mov    %esi,%edx
+8010b2ef:	88 97 a6 a3 13 80    	mov    %dl,-0x7fec5c5a(%edi)
+8010b2f5:	83 e1 cf             	and    $0xffffffcf,%ecx
+8010b2f8:	88 8f a6 a3 13 80    	mov    %cl,-0x7fec5c5a(%edi)
+8010b2fe:	89 ce                	mov    %ecx,%esi
+8010b300:	83 ce 40             	or     $0x40,%esi
+8010b303:	89 f2                	mov    %esi,%edx
+8010b305:	88 97 a6 a3 13 80    	mov    %dl,-0x7fec5c5a(%edi)
+8010b30b:	83 c9 c0             	or     $0xffffffc0,%ecx
+8010b30e:	88 8f a6 a3 13 80    	mov    %cl,-0x7fec5c5a(%edi)
+8010b314:	c6 87 a7 a3 13 80 00 	movb   $0x0,-0x7fec5c59(%edi)
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010b31b:	66 c7 87 a8 a3 13 80 	movw   $0xffff,-0x7fec5c58(%edi)
+8010b322:	ff ff 
+8010b324:	66 c7 87 aa a3 13 80 	movw   $0x0,-0x7fec5c56(%edi)
+8010b32b:	00 00 
+8010b32d:	c6 87 ac a3 13 80 00 	movb   $0x0,-0x7fec5c54(%edi)
+8010b334:	0f b6 9f ad a3 13 80 	movzbl -0x7fec5c53(%edi),%ebx
+8010b33b:	83 e3 f0             	and    $0xfffffff0,%ebx
+8010b33e:	89 de                	mov    %ebx,%esi
+8010b340:	83 ce 0a             	or     $0xa,%esi
+8010b343:	89 f2                	mov    %esi,%edx
+8010b345:	88 97 ad a3 13 80    	mov    %dl,-0x7fec5c53(%edi)
+8010b34b:	89 de                	mov    %ebx,%esi
+8010b34d:	83 ce 1a             	or     $0x1a,%esi
+8010b350:	89 f2                	mov    %esi,%edx
+8010b352:	88 97 ad a3 13 80    	mov    %dl,-0x7fec5c53(%edi)
+8010b358:	83 cb 7a             	or     $0x7a,%ebx
+8010b35b:	88 9f ad a3 13 80    	mov    %bl,-0x7fec5c53(%edi)
+8010b361:	c6 87 ad a3 13 80 fa 	movb   $0xfa,-0x7fec5c53(%edi)
+8010b368:	0f b6 9f ae a3 13 80 	movzbl -0x7fec5c52(%edi),%ebx
+8010b36f:	83 cb 0f             	or     $0xf,%ebx
+8010b372:	88 9f ae a3 13 80    	mov    %bl,-0x7fec5c52(%edi)
+8010b378:	89 de                	mov    %ebx,%esi
+8010b37a:	83 e6 ef             	and    $0xffffffef,%esi
+8010b37d:	89 f2                	mov    %esi,%edx
+8010b37f:	88 97 ae a3 13 80    	mov    %dl,-0x7fec5c52(%edi)
+8010b385:	83 e3 cf             	and    $0xffffffcf,%ebx
+8010b388:	88 9f ae a3 13 80    	mov    %bl,-0x7fec5c52(%edi)
+8010b38e:	89 de                	mov    %ebx,%esi
+8010b390:	83 ce 40             	or     $0x40,%esi
+8010b393:	89 f2                	mov    %esi,%edx
+8010b395:	88 97 ae a3 13 80    	mov    %dl,-0x7fec5c52(%edi)
+8010b39b:	83 cb c0             	or     $0xffffffc0,%ebx
+8010b39e:	88 9f ae a3 13 80    	mov    %bl,-0x7fec5c52(%edi)
+8010b3a4:	c6 87 af a3 13 80 00 	movb   $0x0,-0x7fec5c51(%edi)
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010b3ab:	66 c7 87 b0 a3 13 80 	movw   $0xffff,-0x7fec5c50(%edi)
+8010b3b2:	ff ff 
+8010b3b4:	66 c7 87 b2 a3 13 80 	movw   $0x0,-0x7fec5c4e(%edi)
+8010b3bb:	00 00 
+8010b3bd:	c6 87 b4 a3 13 80 00 	movb   $0x0,-0x7fec5c4c(%edi)
+8010b3c4:	0f b6 9f b5 a3 13 80 	movzbl -0x7fec5c4b(%edi),%ebx
+8010b3cb:	83 e3 f0             	and    $0xfffffff0,%ebx
+8010b3ce:	89 de                	mov    %ebx,%esi
+8010b3d0:	83 ce 02             	or     $0x2,%esi
+8010b3d3:	89 f2                	mov    %esi,%edx
+8010b3d5:	88 97 b5 a3 13 80    	mov    %dl,-0x7fec5c4b(%edi)
+8010b3db:	89 de                	mov    %ebx,%esi
+8010b3dd:	83 ce 12             	or     $0x12,%esi
+8010b3e0:	89 f2                	mov    %esi,%edx
+8010b3e2:	88 97 b5 a3 13 80    	mov    %dl,-0x7fec5c4b(%edi)
+8010b3e8:	83 cb 72             	or     $0x72,%ebx
+8010b3eb:	88 9f b5 a3 13 80    	mov    %bl,-0x7fec5c4b(%edi)
+8010b3f1:	c6 87 b5 a3 13 80 f2 	movb   $0xf2,-0x7fec5c4b(%edi)
+8010b3f8:	0f b6 9f b6 a3 13 80 	movzbl -0x7fec5c4a(%edi),%ebx
+8010b3ff:	83 cb 0f             	or     $0xf,%ebx
+8010b402:	88 9f b6 a3 13 80    	mov    %bl,-0x7fec5c4a(%edi)
+8010b408:	89 de                	mov    %ebx,%esi
+8010b40a:	83 e6 ef             	and    $0xffffffef,%esi
+8010b40d:	89 f2                	mov    %esi,%edx
+8010b40f:	88 97 b6 a3 13 80    	mov    %dl,-0x7fec5c4a(%edi)
+8010b415:	83 e3 cf             	and    $0xffffffcf,%ebx
+8010b418:	88 9f b6 a3 13 80    	mov    %bl,-0x7fec5c4a(%edi)
+8010b41e:	89 de                	mov    %ebx,%esi
+8010b420:	83 ce 40             	or     $0x40,%esi
+8010b423:	89 f2                	mov    %esi,%edx
+8010b425:	88 97 b6 a3 13 80    	mov    %dl,-0x7fec5c4a(%edi)
+8010b42b:	83 cb c0             	or     $0xffffffc0,%ebx
+8010b42e:	88 9f b6 a3 13 80    	mov    %bl,-0x7fec5c4a(%edi)
+8010b434:	c6 87 b7 a3 13 80 00 	movb   $0x0,-0x7fec5c49(%edi)
+  lgdt(c->gdt, sizeof(c->gdt));
+8010b43b:	8d 97 90 a3 13 80    	lea    -0x7fec5c70(%edi),%edx
+  pd[0] = size-1;
+8010b441:	66 c7 45 e2 2f 00    	movw   $0x2f,-0x1e(%ebp)
+  pd[1] = (uint)p;
+8010b447:	66 89 55 e4          	mov    %dx,-0x1c(%ebp)
+  pd[2] = (uint)p >> 16;
+8010b44b:	c1 ea 10             	shr    $0x10,%edx
+8010b44e:	66 89 55 e6          	mov    %dx,-0x1a(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010b452:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+8010b455:	0f 01 10             	lgdtl  (%eax)
+}
+8010b458:	83 c4 1c             	add    $0x1c,%esp
+8010b45b:	5b                   	pop    %ebx
+8010b45c:	5e                   	pop    %esi
+8010b45d:	5f                   	pop    %edi
+8010b45e:	5d                   	pop    %ebp
+8010b45f:	c3                   	ret
+
+8010b460 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010b460:	a1 00 50 14 80       	mov    0x80145000,%eax
+8010b465:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010b46a:	0f 22 d8             	mov    %eax,%cr3
+}
+8010b46d:	c3                   	ret
+
+8010b46e <switchuvm>:
+{
+8010b46e:	55                   	push   %ebp
+8010b46f:	89 e5                	mov    %esp,%ebp
+8010b471:	57                   	push   %edi
+8010b472:	56                   	push   %esi
+8010b473:	53                   	push   %ebx
+8010b474:	83 ec 1c             	sub    $0x1c,%esp
+8010b477:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010b47a:	85 f6                	test   %esi,%esi
+8010b47c:	0f 84 25 01 00 00    	je     8010b5a7 <switchuvm+0x139>
+  if(p->kstack == 0)
+8010b482:	83 7e 08 00          	cmpl   $0x0,0x8(%esi)
+8010b486:	0f 84 28 01 00 00    	je     8010b5b4 <switchuvm+0x146>
+  if(p->pgdir == 0)
+8010b48c:	83 7e 04 00          	cmpl   $0x0,0x4(%esi)
+8010b490:	0f 84 2b 01 00 00    	je     8010b5c1 <switchuvm+0x153>
+  pushcli();
+8010b496:	e8 64 d0 ff ff       	call   801084ff <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010b49b:	e8 35 b4 ff ff       	call   801068d5 <mycpu>
+8010b4a0:	89 c3                	mov    %eax,%ebx
+8010b4a2:	e8 2e b4 ff ff       	call   801068d5 <mycpu>
+8010b4a7:	8d 78 08             	lea    0x8(%eax),%edi
+8010b4aa:	e8 26 b4 ff ff       	call   801068d5 <mycpu>
+8010b4af:	83 c0 08             	add    $0x8,%eax
+8010b4b2:	c1 e8 10             	shr    $0x10,%eax
+8010b4b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010b4b8:	e8 18 b4 ff ff       	call   801068d5 <mycpu>
+8010b4bd:	83 c0 08             	add    $0x8,%eax
+8010b4c0:	c1 e8 18             	shr    $0x18,%eax
+8010b4c3:	66 c7 83 98 00 00 00 	movw   $0x67,0x98(%ebx)
+8010b4ca:	67 00 
+8010b4cc:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+8010b4d3:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+8010b4d7:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+8010b4dd:	0f b6 93 9d 00 00 00 	movzbl 0x9d(%ebx),%edx
+8010b4e4:	83 e2 f0             	and    $0xfffffff0,%edx
+8010b4e7:	89 d1                	mov    %edx,%ecx
+8010b4e9:	83 c9 09             	or     $0x9,%ecx
+8010b4ec:	88 8b 9d 00 00 00    	mov    %cl,0x9d(%ebx)
+8010b4f2:	83 ca 19             	or     $0x19,%edx
+8010b4f5:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010b4fb:	83 e2 9f             	and    $0xffffff9f,%edx
+8010b4fe:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010b504:	83 ca 80             	or     $0xffffff80,%edx
+8010b507:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010b50d:	0f b6 93 9e 00 00 00 	movzbl 0x9e(%ebx),%edx
+8010b514:	89 d1                	mov    %edx,%ecx
+8010b516:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010b519:	88 8b 9e 00 00 00    	mov    %cl,0x9e(%ebx)
+8010b51f:	89 d1                	mov    %edx,%ecx
+8010b521:	83 e1 e0             	and    $0xffffffe0,%ecx
+8010b524:	88 8b 9e 00 00 00    	mov    %cl,0x9e(%ebx)
+8010b52a:	83 e2 c0             	and    $0xffffffc0,%edx
+8010b52d:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010b533:	83 ca 40             	or     $0x40,%edx
+8010b536:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010b53c:	83 e2 7f             	and    $0x7f,%edx
+8010b53f:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010b545:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010b54b:	e8 85 b3 ff ff       	call   801068d5 <mycpu>
+8010b550:	0f b6 90 9d 00 00 00 	movzbl 0x9d(%eax),%edx
+8010b557:	83 e2 ef             	and    $0xffffffef,%edx
+8010b55a:	88 90 9d 00 00 00    	mov    %dl,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010b560:	e8 70 b3 ff ff       	call   801068d5 <mycpu>
+8010b565:	66 c7 40 10 10 00    	movw   $0x10,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010b56b:	8b 5e 08             	mov    0x8(%esi),%ebx
+8010b56e:	e8 62 b3 ff ff       	call   801068d5 <mycpu>
+8010b573:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b579:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010b57c:	e8 54 b3 ff ff       	call   801068d5 <mycpu>
+8010b581:	66 c7 40 6e ff ff    	movw   $0xffff,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010b587:	b8 28 00 00 00       	mov    $0x28,%eax
+8010b58c:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+8010b58f:	8b 46 04             	mov    0x4(%esi),%eax
+8010b592:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010b597:	0f 22 d8             	mov    %eax,%cr3
+  popcli();
+8010b59a:	e8 a4 cf ff ff       	call   80108543 <popcli>
+}
+8010b59f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b5a2:	5b                   	pop    %ebx
+8010b5a3:	5e                   	pop    %esi
+8010b5a4:	5f                   	pop    %edi
+8010b5a5:	5d                   	pop    %ebp
+8010b5a6:	c3                   	ret
+    panic("switchuvm: no process");
+8010b5a7:	83 ec 0c             	sub    $0xc,%esp
+8010b5aa:	68 f2 cb 10 80       	push   $0x8010cbf2
+8010b5af:	e8 42 56 ff ff       	call   80100bf6 <panic>
+    panic("switchuvm: no kstack");
+8010b5b4:	83 ec 0c             	sub    $0xc,%esp
+8010b5b7:	68 08 cc 10 80       	push   $0x8010cc08
+8010b5bc:	e8 35 56 ff ff       	call   80100bf6 <panic>
+    panic("switchuvm: no pgdir");
+8010b5c1:	83 ec 0c             	sub    $0xc,%esp
+8010b5c4:	68 1d cc 10 80       	push   $0x8010cc1d
+8010b5c9:	e8 28 56 ff ff       	call   80100bf6 <panic>
+
+8010b5ce <inituvm>:
+{
+8010b5ce:	55                   	push   %ebp
+8010b5cf:	89 e5                	mov    %esp,%ebp
+8010b5d1:	56                   	push   %esi
+8010b5d2:	53                   	push   %ebx
+8010b5d3:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(sz >= PGSIZE)
+8010b5d6:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010b5dc:	77 4c                	ja     8010b62a <inituvm+0x5c>
+  mem = kalloc();
+8010b5de:	e8 4d 95 ff ff       	call   80104b30 <kalloc>
+8010b5e3:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+8010b5e5:	83 ec 04             	sub    $0x4,%esp
+8010b5e8:	68 00 10 00 00       	push   $0x1000
+8010b5ed:	6a 00                	push   $0x0
+8010b5ef:	50                   	push   %eax
+8010b5f0:	e8 99 d0 ff ff       	call   8010868e <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010b5f5:	83 c4 08             	add    $0x8,%esp
+8010b5f8:	6a 06                	push   $0x6
+8010b5fa:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010b600:	50                   	push   %eax
+8010b601:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b606:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b60b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b60e:	e8 f9 f9 ff ff       	call   8010b00c <mappages>
+  memmove(mem, init, sz);
+8010b613:	83 c4 0c             	add    $0xc,%esp
+8010b616:	56                   	push   %esi
+8010b617:	ff 75 0c             	push   0xc(%ebp)
+8010b61a:	53                   	push   %ebx
+8010b61b:	e8 e6 d0 ff ff       	call   80108706 <memmove>
+}
+8010b620:	83 c4 10             	add    $0x10,%esp
+8010b623:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b626:	5b                   	pop    %ebx
+8010b627:	5e                   	pop    %esi
+8010b628:	5d                   	pop    %ebp
+8010b629:	c3                   	ret
+    panic("inituvm: more than a page");
+8010b62a:	83 ec 0c             	sub    $0xc,%esp
+8010b62d:	68 31 cc 10 80       	push   $0x8010cc31
+8010b632:	e8 bf 55 ff ff       	call   80100bf6 <panic>
+
+8010b637 <loaduvm>:
+{
+8010b637:	55                   	push   %ebp
+8010b638:	89 e5                	mov    %esp,%ebp
+8010b63a:	57                   	push   %edi
+8010b63b:	56                   	push   %esi
+8010b63c:	53                   	push   %ebx
+8010b63d:	83 ec 0c             	sub    $0xc,%esp
+8010b640:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if((uint) addr % PGSIZE != 0)
+8010b643:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010b646:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+8010b64c:	74 3c                	je     8010b68a <loaduvm+0x53>
+    panic("loaduvm: addr must be page aligned");
+8010b64e:	83 ec 0c             	sub    $0xc,%esp
+8010b651:	68 b8 cc 10 80       	push   $0x8010ccb8
+8010b656:	e8 9b 55 ff ff       	call   80100bf6 <panic>
+      panic("loaduvm: address should exist");
+8010b65b:	83 ec 0c             	sub    $0xc,%esp
+8010b65e:	68 4b cc 10 80       	push   $0x8010cc4b
+8010b663:	e8 8e 55 ff ff       	call   80100bf6 <panic>
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010b668:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b66d:	56                   	push   %esi
+8010b66e:	89 da                	mov    %ebx,%edx
+8010b670:	03 55 14             	add    0x14(%ebp),%edx
+8010b673:	52                   	push   %edx
+8010b674:	50                   	push   %eax
+8010b675:	ff 75 10             	push   0x10(%ebp)
+8010b678:	e8 ac 7b ff ff       	call   80103229 <readi>
+8010b67d:	83 c4 10             	add    $0x10,%esp
+8010b680:	39 f0                	cmp    %esi,%eax
+8010b682:	75 47                	jne    8010b6cb <loaduvm+0x94>
+  for(i = 0; i < sz; i += PGSIZE){
+8010b684:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b68a:	39 fb                	cmp    %edi,%ebx
+8010b68c:	73 30                	jae    8010b6be <loaduvm+0x87>
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010b68e:	89 da                	mov    %ebx,%edx
+8010b690:	03 55 0c             	add    0xc(%ebp),%edx
+8010b693:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b698:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b69b:	e8 fb f8 ff ff       	call   8010af9b <walkpgdir>
+8010b6a0:	85 c0                	test   %eax,%eax
+8010b6a2:	74 b7                	je     8010b65b <loaduvm+0x24>
+    pa = PTE_ADDR(*pte);
+8010b6a4:	8b 00                	mov    (%eax),%eax
+8010b6a6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(sz - i < PGSIZE)
+8010b6ab:	89 fe                	mov    %edi,%esi
+8010b6ad:	29 de                	sub    %ebx,%esi
+8010b6af:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010b6b5:	76 b1                	jbe    8010b668 <loaduvm+0x31>
+      n = PGSIZE;
+8010b6b7:	be 00 10 00 00       	mov    $0x1000,%esi
+8010b6bc:	eb aa                	jmp    8010b668 <loaduvm+0x31>
+  return 0;
+8010b6be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010b6c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b6c6:	5b                   	pop    %ebx
+8010b6c7:	5e                   	pop    %esi
+8010b6c8:	5f                   	pop    %edi
+8010b6c9:	5d                   	pop    %ebp
+8010b6ca:	c3                   	ret
+      return -1;
+8010b6cb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b6d0:	eb f1                	jmp    8010b6c3 <loaduvm+0x8c>
+
+8010b6d2 <deallocuvm>:
+{
+8010b6d2:	55                   	push   %ebp
+8010b6d3:	89 e5                	mov    %esp,%ebp
+8010b6d5:	57                   	push   %edi
+8010b6d6:	56                   	push   %esi
+8010b6d7:	53                   	push   %ebx
+8010b6d8:	83 ec 0c             	sub    $0xc,%esp
+8010b6db:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(newsz >= oldsz)
+8010b6de:	39 7d 10             	cmp    %edi,0x10(%ebp)
+8010b6e1:	73 11                	jae    8010b6f4 <deallocuvm+0x22>
+  a = PGROUNDUP(newsz);
+8010b6e3:	8b 45 10             	mov    0x10(%ebp),%eax
+8010b6e6:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+8010b6ec:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010b6f2:	eb 19                	jmp    8010b70d <deallocuvm+0x3b>
+    return oldsz;
+8010b6f4:	89 f8                	mov    %edi,%eax
+8010b6f6:	eb 64                	jmp    8010b75c <deallocuvm+0x8a>
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010b6f8:	c1 eb 16             	shr    $0x16,%ebx
+8010b6fb:	83 c3 01             	add    $0x1,%ebx
+8010b6fe:	c1 e3 16             	shl    $0x16,%ebx
+8010b701:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010b707:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b70d:	39 fb                	cmp    %edi,%ebx
+8010b70f:	73 48                	jae    8010b759 <deallocuvm+0x87>
+    pte = walkpgdir(pgdir, (char*)a, 0);
+8010b711:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b716:	89 da                	mov    %ebx,%edx
+8010b718:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b71b:	e8 7b f8 ff ff       	call   8010af9b <walkpgdir>
+8010b720:	89 c6                	mov    %eax,%esi
+    if(!pte)
+8010b722:	85 c0                	test   %eax,%eax
+8010b724:	74 d2                	je     8010b6f8 <deallocuvm+0x26>
+    else if((*pte & PTE_P) != 0){
+8010b726:	8b 00                	mov    (%eax),%eax
+8010b728:	a8 01                	test   $0x1,%al
+8010b72a:	74 db                	je     8010b707 <deallocuvm+0x35>
+      if(pa == 0)
+8010b72c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b731:	74 19                	je     8010b74c <deallocuvm+0x7a>
+      char *v = P2V(pa);
+8010b733:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010b738:	83 ec 0c             	sub    $0xc,%esp
+8010b73b:	50                   	push   %eax
+8010b73c:	e8 d0 91 ff ff       	call   80104911 <kfree>
+      *pte = 0;
+8010b741:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+8010b747:	83 c4 10             	add    $0x10,%esp
+8010b74a:	eb bb                	jmp    8010b707 <deallocuvm+0x35>
+        panic("kfree");
+8010b74c:	83 ec 0c             	sub    $0xc,%esp
+8010b74f:	68 b2 c0 10 80       	push   $0x8010c0b2
+8010b754:	e8 9d 54 ff ff       	call   80100bf6 <panic>
+  return newsz;
+8010b759:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+8010b75c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b75f:	5b                   	pop    %ebx
+8010b760:	5e                   	pop    %esi
+8010b761:	5f                   	pop    %edi
+8010b762:	5d                   	pop    %ebp
+8010b763:	c3                   	ret
+
+8010b764 <allocuvm>:
+{
+8010b764:	55                   	push   %ebp
+8010b765:	89 e5                	mov    %esp,%ebp
+8010b767:	57                   	push   %edi
+8010b768:	56                   	push   %esi
+8010b769:	53                   	push   %ebx
+8010b76a:	83 ec 1c             	sub    $0x1c,%esp
+8010b76d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(newsz >= KERNBASE)
+8010b770:	85 ff                	test   %edi,%edi
+8010b772:	0f 88 c2 00 00 00    	js     8010b83a <allocuvm+0xd6>
+  if(newsz < oldsz)
+8010b778:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+8010b77b:	72 5f                	jb     8010b7dc <allocuvm+0x78>
+  a = PGROUNDUP(oldsz);
+8010b77d:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010b780:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+8010b786:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  for(; a < newsz; a += PGSIZE){
+8010b78c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+8010b78f:	39 fe                	cmp    %edi,%esi
+8010b791:	0f 83 9e 00 00 00    	jae    8010b835 <allocuvm+0xd1>
+    mem = kalloc();
+8010b797:	e8 94 93 ff ff       	call   80104b30 <kalloc>
+8010b79c:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010b79e:	85 c0                	test   %eax,%eax
+8010b7a0:	74 3f                	je     8010b7e1 <allocuvm+0x7d>
+    memset(mem, 0, PGSIZE);
+8010b7a2:	83 ec 04             	sub    $0x4,%esp
+8010b7a5:	68 00 10 00 00       	push   $0x1000
+8010b7aa:	6a 00                	push   $0x0
+8010b7ac:	50                   	push   %eax
+8010b7ad:	e8 dc ce ff ff       	call   8010868e <memset>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010b7b2:	83 c4 08             	add    $0x8,%esp
+8010b7b5:	6a 06                	push   $0x6
+8010b7b7:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010b7bd:	50                   	push   %eax
+8010b7be:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b7c3:	89 f2                	mov    %esi,%edx
+8010b7c5:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b7c8:	e8 3f f8 ff ff       	call   8010b00c <mappages>
+8010b7cd:	83 c4 10             	add    $0x10,%esp
+8010b7d0:	85 c0                	test   %eax,%eax
+8010b7d2:	78 33                	js     8010b807 <allocuvm+0xa3>
+  for(; a < newsz; a += PGSIZE){
+8010b7d4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010b7da:	eb b3                	jmp    8010b78f <allocuvm+0x2b>
+    return oldsz;
+8010b7dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010b7df:	eb 5e                	jmp    8010b83f <allocuvm+0xdb>
+      cprintf("allocuvm out of memory\n");
+8010b7e1:	83 ec 0c             	sub    $0xc,%esp
+8010b7e4:	68 69 cc 10 80       	push   $0x8010cc69
+8010b7e9:	e8 c9 56 ff ff       	call   80100eb7 <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+8010b7ee:	83 c4 0c             	add    $0xc,%esp
+8010b7f1:	ff 75 0c             	push   0xc(%ebp)
+8010b7f4:	57                   	push   %edi
+8010b7f5:	ff 75 08             	push   0x8(%ebp)
+8010b7f8:	e8 d5 fe ff ff       	call   8010b6d2 <deallocuvm>
+      return 0;
+8010b7fd:	83 c4 10             	add    $0x10,%esp
+8010b800:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b805:	eb 38                	jmp    8010b83f <allocuvm+0xdb>
+      cprintf("allocuvm out of memory (2)\n");
+8010b807:	83 ec 0c             	sub    $0xc,%esp
+8010b80a:	68 81 cc 10 80       	push   $0x8010cc81
+8010b80f:	e8 a3 56 ff ff       	call   80100eb7 <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+8010b814:	83 c4 0c             	add    $0xc,%esp
+8010b817:	ff 75 0c             	push   0xc(%ebp)
+8010b81a:	57                   	push   %edi
+8010b81b:	ff 75 08             	push   0x8(%ebp)
+8010b81e:	e8 af fe ff ff       	call   8010b6d2 <deallocuvm>
+      kfree(mem);
+8010b823:	89 1c 24             	mov    %ebx,(%esp)
+8010b826:	e8 e6 90 ff ff       	call   80104911 <kfree>
+      return 0;
+8010b82b:	83 c4 10             	add    $0x10,%esp
+8010b82e:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b833:	eb 0a                	jmp    8010b83f <allocuvm+0xdb>
+8010b835:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b838:	eb 05                	jmp    8010b83f <allocuvm+0xdb>
+    return 0;
+8010b83a:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+8010b83f:	89 d0                	mov    %edx,%eax
+8010b841:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b844:	5b                   	pop    %ebx
+8010b845:	5e                   	pop    %esi
+8010b846:	5f                   	pop    %edi
+8010b847:	5d                   	pop    %ebp
+8010b848:	c3                   	ret
+
+8010b849 <freevm>:
+{
+8010b849:	55                   	push   %ebp
+8010b84a:	89 e5                	mov    %esp,%ebp
+8010b84c:	56                   	push   %esi
+8010b84d:	53                   	push   %ebx
+8010b84e:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(pgdir == 0)
+8010b851:	85 f6                	test   %esi,%esi
+8010b853:	74 1a                	je     8010b86f <freevm+0x26>
+  deallocuvm(pgdir, KERNBASE, 0);
+8010b855:	83 ec 04             	sub    $0x4,%esp
+8010b858:	6a 00                	push   $0x0
+8010b85a:	68 00 00 00 80       	push   $0x80000000
+8010b85f:	56                   	push   %esi
+8010b860:	e8 6d fe ff ff       	call   8010b6d2 <deallocuvm>
+  for(i = 0; i < NPDENTRIES; i++){
+8010b865:	83 c4 10             	add    $0x10,%esp
+8010b868:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010b86d:	eb 10                	jmp    8010b87f <freevm+0x36>
+    panic("freevm: no pgdir");
+8010b86f:	83 ec 0c             	sub    $0xc,%esp
+8010b872:	68 9d cc 10 80       	push   $0x8010cc9d
+8010b877:	e8 7a 53 ff ff       	call   80100bf6 <panic>
+  for(i = 0; i < NPDENTRIES; i++){
+8010b87c:	83 c3 01             	add    $0x1,%ebx
+8010b87f:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+8010b885:	77 1f                	ja     8010b8a6 <freevm+0x5d>
+    if(pgdir[i] & PTE_P){
+8010b887:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+8010b88a:	a8 01                	test   $0x1,%al
+8010b88c:	74 ee                	je     8010b87c <freevm+0x33>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010b88e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b893:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010b898:	83 ec 0c             	sub    $0xc,%esp
+8010b89b:	50                   	push   %eax
+8010b89c:	e8 70 90 ff ff       	call   80104911 <kfree>
+8010b8a1:	83 c4 10             	add    $0x10,%esp
+8010b8a4:	eb d6                	jmp    8010b87c <freevm+0x33>
+  kfree((char*)pgdir);
+8010b8a6:	83 ec 0c             	sub    $0xc,%esp
+8010b8a9:	56                   	push   %esi
+8010b8aa:	e8 62 90 ff ff       	call   80104911 <kfree>
+}
+8010b8af:	83 c4 10             	add    $0x10,%esp
+8010b8b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b8b5:	5b                   	pop    %ebx
+8010b8b6:	5e                   	pop    %esi
+8010b8b7:	5d                   	pop    %ebp
+8010b8b8:	c3                   	ret
+
+8010b8b9 <setupkvm>:
+{
+8010b8b9:	55                   	push   %ebp
+8010b8ba:	89 e5                	mov    %esp,%ebp
+8010b8bc:	56                   	push   %esi
+8010b8bd:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+8010b8be:	e8 6d 92 ff ff       	call   80104b30 <kalloc>
+8010b8c3:	89 c6                	mov    %eax,%esi
+8010b8c5:	85 c0                	test   %eax,%eax
+8010b8c7:	74 55                	je     8010b91e <setupkvm+0x65>
+  memset(pgdir, 0, PGSIZE);
+8010b8c9:	83 ec 04             	sub    $0x4,%esp
+8010b8cc:	68 00 10 00 00       	push   $0x1000
+8010b8d1:	6a 00                	push   $0x0
+8010b8d3:	50                   	push   %eax
+8010b8d4:	e8 b5 cd ff ff       	call   8010868e <memset>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010b8d9:	83 c4 10             	add    $0x10,%esp
+8010b8dc:	bb 20 f4 10 80       	mov    $0x8010f420,%ebx
+8010b8e1:	81 fb 60 f4 10 80    	cmp    $0x8010f460,%ebx
+8010b8e7:	73 35                	jae    8010b91e <setupkvm+0x65>
+                (uint)k->phys_start, k->perm) < 0) {
+8010b8e9:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+8010b8ec:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010b8ef:	29 c1                	sub    %eax,%ecx
+8010b8f1:	8b 13                	mov    (%ebx),%edx
+8010b8f3:	83 ec 08             	sub    $0x8,%esp
+8010b8f6:	ff 73 0c             	push   0xc(%ebx)
+8010b8f9:	50                   	push   %eax
+8010b8fa:	89 f0                	mov    %esi,%eax
+8010b8fc:	e8 0b f7 ff ff       	call   8010b00c <mappages>
+8010b901:	83 c4 10             	add    $0x10,%esp
+8010b904:	85 c0                	test   %eax,%eax
+8010b906:	78 05                	js     8010b90d <setupkvm+0x54>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010b908:	83 c3 10             	add    $0x10,%ebx
+8010b90b:	eb d4                	jmp    8010b8e1 <setupkvm+0x28>
+      freevm(pgdir);
+8010b90d:	83 ec 0c             	sub    $0xc,%esp
+8010b910:	56                   	push   %esi
+8010b911:	e8 33 ff ff ff       	call   8010b849 <freevm>
+      return 0;
+8010b916:	83 c4 10             	add    $0x10,%esp
+8010b919:	be 00 00 00 00       	mov    $0x0,%esi
+}
+8010b91e:	89 f0                	mov    %esi,%eax
+8010b920:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b923:	5b                   	pop    %ebx
+8010b924:	5e                   	pop    %esi
+8010b925:	5d                   	pop    %ebp
+8010b926:	c3                   	ret
+
+8010b927 <kvmalloc>:
+{
+8010b927:	55                   	push   %ebp
+8010b928:	89 e5                	mov    %esp,%ebp
+8010b92a:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010b92d:	e8 87 ff ff ff       	call   8010b8b9 <setupkvm>
+8010b932:	a3 00 50 14 80       	mov    %eax,0x80145000
+  switchkvm();
+8010b937:	e8 24 fb ff ff       	call   8010b460 <switchkvm>
+}
+8010b93c:	c9                   	leave
+8010b93d:	c3                   	ret
+
+8010b93e <clearpteu>:
+{
+8010b93e:	55                   	push   %ebp
+8010b93f:	89 e5                	mov    %esp,%ebp
+8010b941:	83 ec 08             	sub    $0x8,%esp
+  pte = walkpgdir(pgdir, uva, 0);
+8010b944:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b949:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010b94c:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b94f:	e8 47 f6 ff ff       	call   8010af9b <walkpgdir>
+  if(pte == 0)
+8010b954:	85 c0                	test   %eax,%eax
+8010b956:	74 09                	je     8010b961 <clearpteu+0x23>
+  *pte &= ~PTE_U;
+8010b958:	8b 10                	mov    (%eax),%edx
+8010b95a:	83 e2 fb             	and    $0xfffffffb,%edx
+8010b95d:	89 10                	mov    %edx,(%eax)
+}
+8010b95f:	c9                   	leave
+8010b960:	c3                   	ret
+    panic("clearpteu");
+8010b961:	83 ec 0c             	sub    $0xc,%esp
+8010b964:	68 ae cc 10 80       	push   $0x8010ccae
+8010b969:	e8 88 52 ff ff       	call   80100bf6 <panic>
+
+8010b96e <copyuvm>:
+{
+8010b96e:	55                   	push   %ebp
+8010b96f:	89 e5                	mov    %esp,%ebp
+8010b971:	57                   	push   %edi
+8010b972:	56                   	push   %esi
+8010b973:	53                   	push   %ebx
+8010b974:	83 ec 1c             	sub    $0x1c,%esp
+8010b977:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((d = setupkvm()) == 0)
+8010b97a:	e8 3a ff ff ff       	call   8010b8b9 <setupkvm>
+8010b97f:	89 c1                	mov    %eax,%ecx
+8010b981:	85 c0                	test   %eax,%eax
+8010b983:	0f 84 b7 00 00 00    	je     8010ba40 <copyuvm+0xd2>
+  for(i = 0; i < sz; i += PGSIZE){
+8010b989:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010b98e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010b991:	89 7d 08             	mov    %edi,0x8(%ebp)
+8010b994:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010b997:	eb 43                	jmp    8010b9dc <copyuvm+0x6e>
+    pa = PTE_ADDR(*pte);
+8010b999:	8b 00                	mov    (%eax),%eax
+8010b99b:	89 c6                	mov    %eax,%esi
+8010b99d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    flags = PTE_FLAGS(*pte);
+8010b9a3:	25 ff 0f 00 00       	and    $0xfff,%eax
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010b9a8:	83 ec 08             	sub    $0x8,%esp
+8010b9ab:	50                   	push   %eax
+8010b9ac:	56                   	push   %esi
+8010b9ad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b9b2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b9b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b9b8:	e8 4f f6 ff ff       	call   8010b00c <mappages>
+8010b9bd:	83 c4 10             	add    $0x10,%esp
+8010b9c0:	85 c0                	test   %eax,%eax
+8010b9c2:	78 4b                	js     8010ba0f <copyuvm+0xa1>
+    kincref(P2V(pa));
+8010b9c4:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+8010b9ca:	83 ec 0c             	sub    $0xc,%esp
+8010b9cd:	56                   	push   %esi
+8010b9ce:	e8 e6 8e ff ff       	call   801048b9 <kincref>
+8010b9d3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sz; i += PGSIZE){
+8010b9d6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b9dc:	39 fb                	cmp    %edi,%ebx
+8010b9de:	73 51                	jae    8010ba31 <copyuvm+0xc3>
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0 || !(*pte & PTE_P))
+8010b9e0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010b9e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b9e8:	89 da                	mov    %ebx,%edx
+8010b9ea:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b9ed:	e8 a9 f5 ff ff       	call   8010af9b <walkpgdir>
+8010b9f2:	85 c0                	test   %eax,%eax
+8010b9f4:	74 e0                	je     8010b9d6 <copyuvm+0x68>
+8010b9f6:	8b 10                	mov    (%eax),%edx
+8010b9f8:	f6 c2 01             	test   $0x1,%dl
+8010b9fb:	74 d9                	je     8010b9d6 <copyuvm+0x68>
+    if(*pte & PTE_W)
+8010b9fd:	f6 c2 02             	test   $0x2,%dl
+8010ba00:	74 97                	je     8010b999 <copyuvm+0x2b>
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+8010ba02:	81 e2 fd fd ff ff    	and    $0xfffffdfd,%edx
+8010ba08:	80 ce 02             	or     $0x2,%dh
+8010ba0b:	89 10                	mov    %edx,(%eax)
+8010ba0d:	eb 8a                	jmp    8010b999 <copyuvm+0x2b>
+  lcr3(V2P(pgdir));
+8010ba0f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010ba12:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010ba15:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010ba1b:	0f 22 d8             	mov    %eax,%cr3
+  freevm(d);
+8010ba1e:	83 ec 0c             	sub    $0xc,%esp
+8010ba21:	51                   	push   %ecx
+8010ba22:	e8 22 fe ff ff       	call   8010b849 <freevm>
+  return 0;
+8010ba27:	83 c4 10             	add    $0x10,%esp
+8010ba2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ba2f:	eb 0f                	jmp    8010ba40 <copyuvm+0xd2>
+  lcr3(V2P(pgdir));
+8010ba31:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010ba34:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010ba37:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010ba3d:	0f 22 d8             	mov    %eax,%cr3
+}
+8010ba40:	89 c8                	mov    %ecx,%eax
+8010ba42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ba45:	5b                   	pop    %ebx
+8010ba46:	5e                   	pop    %esi
+8010ba47:	5f                   	pop    %edi
+8010ba48:	5d                   	pop    %ebp
+8010ba49:	c3                   	ret
+
+8010ba4a <pagefault>:
+// Handle a page fault at va in process p with error code err.
+// Returns 0 if the fault was resolved and the faulting
+// instruction can be restarted, -1 otherwise.
+int
+pagefault(struct proc *p, uint va, uint err)
+{
+8010ba4a:	55                   	push   %ebp
+8010ba4b:	89 e5                	mov    %esp,%ebp
+8010ba4d:	57                   	push   %edi
+8010ba4e:	56                   	push   %esi
+8010ba4f:	53                   	push   %ebx
+8010ba50:	83 ec 0c             	sub    $0xc,%esp
+8010ba53:	8b 75 08             	mov    0x8(%ebp),%esi
+8010ba56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  pte_t *pte;
+  char *mem;
+  uint a;
+
+  if(va >= p->sz)
+8010ba59:	3b 1e                	cmp    (%esi),%ebx
+8010ba5b:	0f 83 b0 00 00 00    	jae    8010bb11 <pagefault+0xc7>
+    return -1;
+  a = PGROUNDDOWN(va);
+8010ba61:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  pte = walkpgdir(p->pgdir, (char*)a, 0);
+8010ba67:	8b 46 04             	mov    0x4(%esi),%eax
+8010ba6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ba6f:	89 da                	mov    %ebx,%edx
+8010ba71:	e8 25 f5 ff ff       	call   8010af9b <walkpgdir>
+  if(pte == 0 || (*pte & PTE_P) == 0){
+8010ba76:	85 c0                	test   %eax,%eax
+8010ba78:	74 07                	je     8010ba81 <pagefault+0x37>
+8010ba7a:	8b 10                	mov    (%eax),%edx
+8010ba7c:	f6 c2 01             	test   $0x1,%dl
+8010ba7f:	75 73                	jne    8010baf4 <pagefault+0xaa>
+    // exec() and sbrk() only set up p->sz; program and heap
+    // pages are allocated and filled here, on first touch.
+    if((mem = kalloc()) == 0)
+8010ba81:	e8 aa 90 ff ff       	call   80104b30 <kalloc>
+8010ba86:	89 c7                	mov    %eax,%edi
+8010ba88:	85 c0                	test   %eax,%eax
+8010ba8a:	0f 84 88 00 00 00    	je     8010bb18 <pagefault+0xce>
+      return -1;
+    memset(mem, 0, PGSIZE);
+8010ba90:	83 ec 04             	sub    $0x4,%esp
+8010ba93:	68 00 10 00 00       	push   $0x1000
+8010ba98:	6a 00                	push   $0x0
+8010ba9a:	50                   	push   %eax
+8010ba9b:	e8 ee cb ff ff       	call   8010868e <memset>
+    if(loadpage(p, mem, a) < 0 ||
+8010baa0:	89 d9                	mov    %ebx,%ecx
+8010baa2:	89 fa                	mov    %edi,%edx
+8010baa4:	89 f0                	mov    %esi,%eax
+8010baa6:	e8 d8 f5 ff ff       	call   8010b083 <loadpage>
+8010baab:	83 c4 10             	add    $0x10,%esp
+8010baae:	85 c0                	test   %eax,%eax
+8010bab0:	78 2f                	js     8010bae1 <pagefault+0x97>
+       mappages(p->pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010bab2:	8b 46 04             	mov    0x4(%esi),%eax
+8010bab5:	83 ec 08             	sub    $0x8,%esp
+8010bab8:	6a 06                	push   $0x6
+8010baba:	8d 97 00 00 00 80    	lea    -0x80000000(%edi),%edx
+8010bac0:	52                   	push   %edx
+8010bac1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010bac6:	89 da                	mov    %ebx,%edx
+8010bac8:	e8 3f f5 ff ff       	call   8010b00c <mappages>
+    if(loadpage(p, mem, a) < 0 ||
+8010bacd:	83 c4 10             	add    $0x10,%esp
+8010bad0:	85 c0                	test   %eax,%eax
+8010bad2:	78 0d                	js     8010bae1 <pagefault+0x97>
+      kfree(mem);
+      return -1;
+    }
+    return 0;
+8010bad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  if((err & FEC_WR) && (*pte & (PTE_U|PTE_COW)) == (PTE_U|PTE_COW))
+    return cowpage(pte, a);
+  return -1;
+}
+8010bad9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010badc:	5b                   	pop    %ebx
+8010badd:	5e                   	pop    %esi
+8010bade:	5f                   	pop    %edi
+8010badf:	5d                   	pop    %ebp
+8010bae0:	c3                   	ret
+      kfree(mem);
+8010bae1:	83 ec 0c             	sub    $0xc,%esp
+8010bae4:	57                   	push   %edi
+8010bae5:	e8 27 8e ff ff       	call   80104911 <kfree>
+      return -1;
+8010baea:	83 c4 10             	add    $0x10,%esp
+8010baed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010baf2:	eb e5                	jmp    8010bad9 <pagefault+0x8f>
+  if((err & FEC_WR) && (*pte & (PTE_U|PTE_COW)) == (PTE_U|PTE_COW))
+8010baf4:	f6 45 10 02          	testb  $0x2,0x10(%ebp)
+8010baf8:	74 25                	je     8010bb1f <pagefault+0xd5>
+8010bafa:	81 e2 04 02 00 00    	and    $0x204,%edx
+8010bb00:	81 fa 04 02 00 00    	cmp    $0x204,%edx
+8010bb06:	75 1e                	jne    8010bb26 <pagefault+0xdc>
+    return cowpage(pte, a);
+8010bb08:	89 da                	mov    %ebx,%edx
+8010bb0a:	e8 54 f6 ff ff       	call   8010b163 <cowpage>
+8010bb0f:	eb c8                	jmp    8010bad9 <pagefault+0x8f>
+    return -1;
+8010bb11:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010bb16:	eb c1                	jmp    8010bad9 <pagefault+0x8f>
+      return -1;
+8010bb18:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010bb1d:	eb ba                	jmp    8010bad9 <pagefault+0x8f>
+  return -1;
+8010bb1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010bb24:	eb b3                	jmp    8010bad9 <pagefault+0x8f>
+8010bb26:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010bb2b:	eb ac                	jmp    8010bad9 <pagefault+0x8f>
+
+8010bb2d <prefault>:
+// private copies of copy-on-write ones. The kernel never takes
+// page faults on user memory itself (see trap). Returns -1 if
+// out of memory.
+int
+prefault(struct proc *p, uint va, uint len, int write)
+{
+8010bb2d:	55                   	push   %ebp
+8010bb2e:	89 e5                	mov    %esp,%ebp
+8010bb30:	57                   	push   %edi
+8010bb31:	56                   	push   %esi
+8010bb32:	53                   	push   %ebx
+8010bb33:	83 ec 0c             	sub    $0xc,%esp
+8010bb36:	8b 75 08             	mov    0x8(%ebp),%esi
+8010bb39:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010bb3c:	89 fb                	mov    %edi,%ebx
+8010bb3e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010bb44:	eb 1d                	jmp    8010bb63 <prefault+0x36>
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0){
+      if(pagefault(p, a, write ? FEC_WR : 0) < 0)
+8010bb46:	b8 00 00 00 00       	mov    $0x0,%eax
+8010bb4b:	83 ec 04             	sub    $0x4,%esp
+8010bb4e:	50                   	push   %eax
+8010bb4f:	53                   	push   %ebx
+8010bb50:	56                   	push   %esi
+8010bb51:	e8 f4 fe ff ff       	call   8010ba4a <pagefault>
+8010bb56:	83 c4 10             	add    $0x10,%esp
+8010bb59:	85 c0                	test   %eax,%eax
+8010bb5b:	78 67                	js     8010bbc4 <prefault+0x97>
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010bb5d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010bb63:	89 f8                	mov    %edi,%eax
+8010bb65:	03 45 10             	add    0x10(%ebp),%eax
+8010bb68:	39 c3                	cmp    %eax,%ebx
+8010bb6a:	73 4b                	jae    8010bbb7 <prefault+0x8a>
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+8010bb6c:	8b 46 04             	mov    0x4(%esi),%eax
+8010bb6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010bb74:	89 da                	mov    %ebx,%edx
+8010bb76:	e8 20 f4 ff ff       	call   8010af9b <walkpgdir>
+    if(pte == 0 || (*pte & PTE_P) == 0){
+8010bb7b:	85 c0                	test   %eax,%eax
+8010bb7d:	74 06                	je     8010bb85 <prefault+0x58>
+8010bb7f:	8b 00                	mov    (%eax),%eax
+8010bb81:	a8 01                	test   $0x1,%al
+8010bb83:	75 0d                	jne    8010bb92 <prefault+0x65>
+      if(pagefault(p, a, write ? FEC_WR : 0) < 0)
+8010bb85:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010bb89:	74 bb                	je     8010bb46 <prefault+0x19>
+8010bb8b:	b8 02 00 00 00       	mov    $0x2,%eax
+8010bb90:	eb b9                	jmp    8010bb4b <prefault+0x1e>
+        return -1;
+    } else if(write && (*pte & PTE_COW)){
+8010bb92:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010bb96:	74 c5                	je     8010bb5d <prefault+0x30>
+8010bb98:	f6 c4 02             	test   $0x2,%ah
+8010bb9b:	74 c0                	je     8010bb5d <prefault+0x30>
+      if(pagefault(p, a, FEC_WR) < 0)
+8010bb9d:	83 ec 04             	sub    $0x4,%esp
+8010bba0:	6a 02                	push   $0x2
+8010bba2:	53                   	push   %ebx
+8010bba3:	56                   	push   %esi
+8010bba4:	e8 a1 fe ff ff       	call   8010ba4a <pagefault>
+8010bba9:	83 c4 10             	add    $0x10,%esp
+8010bbac:	85 c0                	test   %eax,%eax
+8010bbae:	79 ad                	jns    8010bb5d <prefault+0x30>
+        return -1;
+8010bbb0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010bbb5:	eb 05                	jmp    8010bbbc <prefault+0x8f>
+    }
+  }
+  return 0;
+8010bbb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010bbbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010bbbf:	5b                   	pop    %ebx
+8010bbc0:	5e                   	pop    %esi
+8010bbc1:	5f                   	pop    %edi
+8010bbc2:	5d                   	pop    %ebp
+8010bbc3:	c3                   	ret
+        return -1;
+8010bbc4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010bbc9:	eb f1                	jmp    8010bbbc <prefault+0x8f>
+
+8010bbcb <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010bbcb:	55                   	push   %ebp
+8010bbcc:	89 e5                	mov    %esp,%ebp
+8010bbce:	83 ec 08             	sub    $0x8,%esp
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+8010bbd1:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010bbd6:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010bbd9:	8b 45 08             	mov    0x8(%ebp),%eax
+8010bbdc:	e8 ba f3 ff ff       	call   8010af9b <walkpgdir>
+  if((*pte & PTE_P) == 0)
+8010bbe1:	8b 00                	mov    (%eax),%eax
+8010bbe3:	a8 01                	test   $0x1,%al
+8010bbe5:	74 10                	je     8010bbf7 <uva2ka+0x2c>
+    return 0;
+  if((*pte & PTE_U) == 0)
+8010bbe7:	a8 04                	test   $0x4,%al
+8010bbe9:	74 13                	je     8010bbfe <uva2ka+0x33>
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+8010bbeb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010bbf0:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+8010bbf5:	c9                   	leave
+8010bbf6:	c3                   	ret
+    return 0;
+8010bbf7:	b8 00 00 00 00       	mov    $0x0,%eax
+8010bbfc:	eb f7                	jmp    8010bbf5 <uva2ka+0x2a>
+    return 0;
+8010bbfe:	b8 00 00 00 00       	mov    $0x0,%eax
+8010bc03:	eb f0                	jmp    8010bbf5 <uva2ka+0x2a>
+
+8010bc05 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010bc05:	55                   	push   %ebp
+8010bc06:	89 e5                	mov    %esp,%ebp
+8010bc08:	57                   	push   %edi
+8010bc09:	56                   	push   %esi
+8010bc0a:	53                   	push   %ebx
+8010bc0b:	83 ec 0c             	sub    $0xc,%esp
+8010bc0e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+8010bc11:	eb 32                	jmp    8010bc45 <copyout+0x40>
+    va0 = (uint)PGROUNDDOWN(va);
+    // The kernel writes through its own mapping, so a shared
+    // page has to be copied here rather than on a fault.
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & (PTE_P|PTE_U|PTE_COW)) == (PTE_P|PTE_U|PTE_COW))
+      if(cowpage(pte, va0) < 0)
+8010bc13:	89 f2                	mov    %esi,%edx
+8010bc15:	e8 49 f5 ff ff       	call   8010b163 <cowpage>
+8010bc1a:	85 c0                	test   %eax,%eax
+8010bc1c:	79 58                	jns    8010bc76 <copyout+0x71>
+        return -1;
+8010bc1e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010bc23:	eb 7d                	jmp    8010bca2 <copyout+0x9d>
+    if(pa0 == 0)
+      return -1;
+    n = PGSIZE - (va - va0);
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+8010bc25:	29 f7                	sub    %esi,%edi
+8010bc27:	01 f8                	add    %edi,%eax
+8010bc29:	83 ec 04             	sub    $0x4,%esp
+8010bc2c:	53                   	push   %ebx
+8010bc2d:	ff 75 10             	push   0x10(%ebp)
+8010bc30:	50                   	push   %eax
+8010bc31:	e8 d0 ca ff ff       	call   80108706 <memmove>
+    len -= n;
+8010bc36:	29 5d 14             	sub    %ebx,0x14(%ebp)
+    buf += n;
+8010bc39:	01 5d 10             	add    %ebx,0x10(%ebp)
+    va = va0 + PGSIZE;
+8010bc3c:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+8010bc42:	83 c4 10             	add    $0x10,%esp
+  while(len > 0){
+8010bc45:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010bc49:	74 52                	je     8010bc9d <copyout+0x98>
+    va0 = (uint)PGROUNDDOWN(va);
+8010bc4b:	89 fe                	mov    %edi,%esi
+8010bc4d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+8010bc53:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010bc58:	89 f2                	mov    %esi,%edx
+8010bc5a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010bc5d:	e8 39 f3 ff ff       	call   8010af9b <walkpgdir>
+    if(pte && (*pte & (PTE_P|PTE_U|PTE_COW)) == (PTE_P|PTE_U|PTE_COW))
+8010bc62:	85 c0                	test   %eax,%eax
+8010bc64:	74 10                	je     8010bc76 <copyout+0x71>
+8010bc66:	8b 10                	mov    (%eax),%edx
+8010bc68:	81 e2 05 02 00 00    	and    $0x205,%edx
+8010bc6e:	81 fa 05 02 00 00    	cmp    $0x205,%edx
+8010bc74:	74 9d                	je     8010bc13 <copyout+0xe>
+    pa0 = uva2ka(pgdir, (char*)va0);
+8010bc76:	83 ec 08             	sub    $0x8,%esp
+8010bc79:	56                   	push   %esi
+8010bc7a:	ff 75 08             	push   0x8(%ebp)
+8010bc7d:	e8 49 ff ff ff       	call   8010bbcb <uva2ka>
+    if(pa0 == 0)
+8010bc82:	83 c4 10             	add    $0x10,%esp
+8010bc85:	85 c0                	test   %eax,%eax
+8010bc87:	74 21                	je     8010bcaa <copyout+0xa5>
+    n = PGSIZE - (va - va0);
+8010bc89:	89 f3                	mov    %esi,%ebx
+8010bc8b:	29 fb                	sub    %edi,%ebx
+8010bc8d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    if(n > len)
+8010bc93:	39 5d 14             	cmp    %ebx,0x14(%ebp)
+8010bc96:	73 8d                	jae    8010bc25 <copyout+0x20>
+      n = len;
+8010bc98:	8b 5d 14             	mov    0x14(%ebp),%ebx
+8010bc9b:	eb 88                	jmp    8010bc25 <copyout+0x20>
+  }
+  return 0;
+8010bc9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010bca2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010bca5:	5b                   	pop    %ebx
+8010bca6:	5e                   	pop    %esi
+8010bca7:	5f                   	pop    %edi
+8010bca8:	5d                   	pop    %ebp
+8010bca9:	c3                   	ret
+      return -1;
+8010bcaa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010bcaf:	eb f1                	jmp    8010bca2 <copyout+0x9d>
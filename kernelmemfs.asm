@@ -0,0 +1,22575 @@
+
+kernelmemfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 e0 10 00       	mov    $0x10e000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc 10 70 34 80       	mov    $0x80347010,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 b1 49 10 80       	mov    $0x801049b1,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+
+80100034 <bhash>:
+} bcache;
+
+static struct bucket*
+bhash(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev ^ blockno) % NBUCKET];
+80100034:	31 d0                	xor    %edx,%eax
+80100036:	89 c1                	mov    %eax,%ecx
+80100038:	ba cf 25 16 35       	mov    $0x351625cf,%edx
+8010003d:	f7 e2                	mul    %edx
+8010003f:	89 c8                	mov    %ecx,%eax
+80100041:	29 d0                	sub    %edx,%eax
+80100043:	d1 e8                	shr    %eax
+80100045:	01 c2                	add    %eax,%edx
+80100047:	c1 ea 0c             	shr    $0xc,%edx
+8010004a:	69 c2 81 1a 00 00    	imul   $0x1a81,%edx,%eax
+80100050:	29 c1                	sub    %eax,%ecx
+80100052:	8d 04 8d 64 0c 31 80 	lea    -0x7fcef39c(,%ecx,4),%eax
+}
+80100059:	c3                   	ret
+
+8010005a <block>:
+
+static struct spinlock*
+block(struct bucket *bk)
+{
+8010005a:	55                   	push   %ebp
+8010005b:	89 e5                	mov    %esp,%ebp
+8010005d:	53                   	push   %ebx
+  return &bcache.block[(bk - bcache.bucket) % NBLOCK];
+8010005e:	2d 64 0c 31 80       	sub    $0x80310c64,%eax
+80100063:	89 c3                	mov    %eax,%ebx
+80100065:	89 c1                	mov    %eax,%ecx
+80100067:	c1 f9 02             	sar    $0x2,%ecx
+8010006a:	ba 3f c5 25 43       	mov    $0x4325c53f,%edx
+8010006f:	89 c8                	mov    %ecx,%eax
+80100071:	f7 ea                	imul   %edx
+80100073:	c1 fa 04             	sar    $0x4,%edx
+80100076:	c1 fb 1f             	sar    $0x1f,%ebx
+80100079:	29 da                	sub    %ebx,%edx
+8010007b:	6b c2 3d             	imul   $0x3d,%edx,%eax
+8010007e:	29 c1                	sub    %eax,%ecx
+80100080:	6b d1 34             	imul   $0x34,%ecx,%edx
+80100083:	8d 82 00 00 31 80    	lea    -0x7fcf0000(%edx),%eax
+}
+80100089:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010008c:	c9                   	leave
+8010008d:	c3                   	ret
+
+8010008e <bslabof>:
+
+// The slab header is the page the buffer's header lives in.
+static struct bslab*
+bslabof(struct buf *b)
+{
+  return (struct bslab*)PGROUNDDOWN((uint)b);
+8010008e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+}
+80100093:	c3                   	ret
+
+80100094 <idleinc>:
+
+// b has just gone on the LRU list. Caller must hold lrulock.
+static void
+idleinc(struct buf *b)
+{
+80100094:	55                   	push   %ebp
+80100095:	89 e5                	mov    %esp,%ebp
+80100097:	83 ec 08             	sub    $0x8,%esp
+  struct bslab *s = bslabof(b);
+8010009a:	e8 ef ff ff ff       	call   8010008e <bslabof>
+
+  if(++s->nidle < BSLABBUFS)
+8010009f:	8b 48 0c             	mov    0xc(%eax),%ecx
+801000a2:	8d 51 01             	lea    0x1(%ecx),%edx
+801000a5:	89 50 0c             	mov    %edx,0xc(%eax)
+801000a8:	83 fa 0f             	cmp    $0xf,%edx
+801000ab:	7e 1f                	jle    801000cc <idleinc+0x38>
+    return;
+  if(bcache.idle == 0){
+801000ad:	8b 15 40 77 31 80    	mov    0x80317740,%edx
+801000b3:	85 d2                	test   %edx,%edx
+801000b5:	74 17                	je     801000ce <idleinc+0x3a>
+    s->inext = s->iprev = s;
+    bcache.idle = s;
+  } else {
+    s->inext = bcache.idle;
+801000b7:	89 50 04             	mov    %edx,0x4(%eax)
+    s->iprev = bcache.idle->iprev;
+801000ba:	8b 52 08             	mov    0x8(%edx),%edx
+801000bd:	89 50 08             	mov    %edx,0x8(%eax)
+    s->iprev->inext = s;
+801000c0:	89 42 04             	mov    %eax,0x4(%edx)
+    bcache.idle->iprev = s;
+801000c3:	8b 15 40 77 31 80    	mov    0x80317740,%edx
+801000c9:	89 42 08             	mov    %eax,0x8(%edx)
+  }
+}
+801000cc:	c9                   	leave
+801000cd:	c3                   	ret
+    s->inext = s->iprev = s;
+801000ce:	89 40 08             	mov    %eax,0x8(%eax)
+801000d1:	89 40 04             	mov    %eax,0x4(%eax)
+    bcache.idle = s;
+801000d4:	a3 40 77 31 80       	mov    %eax,0x80317740
+801000d9:	eb f1                	jmp    801000cc <idleinc+0x38>
+
+801000db <idledec>:
+
+// b has just come off the LRU list. Caller must hold lrulock.
+static void
+idledec(struct buf *b)
+{
+801000db:	55                   	push   %ebp
+801000dc:	89 e5                	mov    %esp,%ebp
+801000de:	83 ec 08             	sub    $0x8,%esp
+  struct bslab *s = bslabof(b);
+801000e1:	e8 a8 ff ff ff       	call   8010008e <bslabof>
+
+  if(s->nidle-- < BSLABBUFS)
+801000e6:	8b 50 0c             	mov    0xc(%eax),%edx
+801000e9:	8d 4a ff             	lea    -0x1(%edx),%ecx
+801000ec:	89 48 0c             	mov    %ecx,0xc(%eax)
+801000ef:	83 fa 0f             	cmp    $0xf,%edx
+801000f2:	7e 1b                	jle    8010010f <idledec+0x34>
+    return;
+  if(s->inext == s)
+801000f4:	8b 50 04             	mov    0x4(%eax),%edx
+801000f7:	39 c2                	cmp    %eax,%edx
+801000f9:	74 16                	je     80100111 <idledec+0x36>
+    bcache.idle = 0;
+  else {
+    s->iprev->inext = s->inext;
+801000fb:	8b 48 08             	mov    0x8(%eax),%ecx
+801000fe:	89 51 04             	mov    %edx,0x4(%ecx)
+    s->inext->iprev = s->iprev;
+80100101:	8b 48 08             	mov    0x8(%eax),%ecx
+80100104:	89 4a 08             	mov    %ecx,0x8(%edx)
+    if(bcache.idle == s)
+80100107:	39 05 40 77 31 80    	cmp    %eax,0x80317740
+8010010d:	74 0e                	je     8010011d <idledec+0x42>
+      bcache.idle = s->inext;
+  }
+}
+8010010f:	c9                   	leave
+80100110:	c3                   	ret
+    bcache.idle = 0;
+80100111:	c7 05 40 77 31 80 00 	movl   $0x0,0x80317740
+80100118:	00 00 00 
+8010011b:	eb f2                	jmp    8010010f <idledec+0x34>
+      bcache.idle = s->inext;
+8010011d:	8b 40 04             	mov    0x4(%eax),%eax
+80100120:	a3 40 77 31 80       	mov    %eax,0x80317740
+80100125:	eb e8                	jmp    8010010f <idledec+0x34>
+
+80100127 <unhash>:
+static void
+unhash(struct bucket *bk, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+80100127:	eb 03                	jmp    8010012c <unhash+0x5>
+80100129:	8d 41 58             	lea    0x58(%ecx),%eax
+8010012c:	8b 08                	mov    (%eax),%ecx
+8010012e:	85 c9                	test   %ecx,%ecx
+80100130:	74 0a                	je     8010013c <unhash+0x15>
+    if(*pp == b){
+80100132:	39 d1                	cmp    %edx,%ecx
+80100134:	75 f3                	jne    80100129 <unhash+0x2>
+      *pp = b->hnext;
+80100136:	8b 52 58             	mov    0x58(%edx),%edx
+80100139:	89 10                	mov    %edx,(%eax)
+      break;
+8010013b:	c3                   	ret
+    }
+  }
+}
+8010013c:	c3                   	ret
+
+8010013d <lruaddtail>:
+{
+8010013d:	55                   	push   %ebp
+8010013e:	89 e5                	mov    %esp,%ebp
+80100140:	53                   	push   %ebx
+80100141:	83 ec 10             	sub    $0x10,%esp
+80100144:	89 c3                	mov    %eax,%ebx
+  acquire(&bcache.lrulock);
+80100146:	68 a8 76 31 80       	push   $0x803176a8
+8010014b:	e8 7b 78 00 00       	call   801079cb <acquire>
+  b->prev = bcache.head.prev;
+80100150:	a1 2c 77 31 80       	mov    0x8031772c,%eax
+80100155:	89 43 50             	mov    %eax,0x50(%ebx)
+  b->next = &bcache.head;
+80100158:	c7 43 54 dc 76 31 80 	movl   $0x803176dc,0x54(%ebx)
+  bcache.head.prev->next = b;
+8010015f:	a1 2c 77 31 80       	mov    0x8031772c,%eax
+80100164:	89 58 54             	mov    %ebx,0x54(%eax)
+  bcache.head.prev = b;
+80100167:	89 1d 2c 77 31 80    	mov    %ebx,0x8031772c
+  idleinc(b);
+8010016d:	89 d8                	mov    %ebx,%eax
+8010016f:	e8 20 ff ff ff       	call   80100094 <idleinc>
+  release(&bcache.lrulock);
+80100174:	c7 04 24 a8 76 31 80 	movl   $0x803176a8,(%esp)
+8010017b:	e8 b0 78 00 00       	call   80107a30 <release>
+}
+80100180:	83 c4 10             	add    $0x10,%esp
+80100183:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100186:	c9                   	leave
+80100187:	c3                   	ret
+
+80100188 <lruremove>:
+{
+80100188:	55                   	push   %ebp
+80100189:	89 e5                	mov    %esp,%ebp
+8010018b:	53                   	push   %ebx
+8010018c:	83 ec 10             	sub    $0x10,%esp
+8010018f:	89 c3                	mov    %eax,%ebx
+  acquire(&bcache.lrulock);
+80100191:	68 a8 76 31 80       	push   $0x803176a8
+80100196:	e8 30 78 00 00       	call   801079cb <acquire>
+  b->next->prev = b->prev;
+8010019b:	8b 53 54             	mov    0x54(%ebx),%edx
+8010019e:	8b 43 50             	mov    0x50(%ebx),%eax
+801001a1:	89 42 50             	mov    %eax,0x50(%edx)
+  b->prev->next = b->next;
+801001a4:	8b 53 54             	mov    0x54(%ebx),%edx
+801001a7:	89 50 54             	mov    %edx,0x54(%eax)
+  idledec(b);
+801001aa:	89 d8                	mov    %ebx,%eax
+801001ac:	e8 2a ff ff ff       	call   801000db <idledec>
+  release(&bcache.lrulock);
+801001b1:	c7 04 24 a8 76 31 80 	movl   $0x803176a8,(%esp)
+801001b8:	e8 73 78 00 00       	call   80107a30 <release>
+}
+801001bd:	83 c4 10             	add    $0x10,%esp
+801001c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801001c3:	c9                   	leave
+801001c4:	c3                   	ret
+
+801001c5 <blookup>:
+
+// Find the buffer for dev/blockno in bk and take a reference
+// to it. Caller must hold block(bk).
+static struct buf*
+blookup(struct bucket *bk, uint dev, uint blockno)
+{
+801001c5:	55                   	push   %ebp
+801001c6:	89 e5                	mov    %esp,%ebp
+801001c8:	53                   	push   %ebx
+801001c9:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext){
+801001cc:	8b 18                	mov    (%eax),%ebx
+801001ce:	eb 0c                	jmp    801001dc <blookup+0x17>
+    if(b->dev == dev && b->blockno == blockno){
+      if(b->refcnt++ == 0)
+        lruremove(b);
+801001d0:	89 d8                	mov    %ebx,%eax
+801001d2:	e8 b1 ff ff ff       	call   80100188 <lruremove>
+      return b;
+801001d7:	eb 1e                	jmp    801001f7 <blookup+0x32>
+  for(b = bk->head; b; b = b->hnext){
+801001d9:	8b 5b 58             	mov    0x58(%ebx),%ebx
+801001dc:	85 db                	test   %ebx,%ebx
+801001de:	74 17                	je     801001f7 <blookup+0x32>
+    if(b->dev == dev && b->blockno == blockno){
+801001e0:	39 53 04             	cmp    %edx,0x4(%ebx)
+801001e3:	75 f4                	jne    801001d9 <blookup+0x14>
+801001e5:	39 4b 08             	cmp    %ecx,0x8(%ebx)
+801001e8:	75 ef                	jne    801001d9 <blookup+0x14>
+      if(b->refcnt++ == 0)
+801001ea:	8b 43 4c             	mov    0x4c(%ebx),%eax
+801001ed:	8d 50 01             	lea    0x1(%eax),%edx
+801001f0:	89 53 4c             	mov    %edx,0x4c(%ebx)
+801001f3:	85 c0                	test   %eax,%eax
+801001f5:	74 d9                	je     801001d0 <blookup+0xb>
+    }
+  }
+  return 0;
+}
+801001f7:	89 d8                	mov    %ebx,%eax
+801001f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801001fc:	c9                   	leave
+801001fd:	c3                   	ret
+
+801001fe <lruadd>:
+{
+801001fe:	55                   	push   %ebp
+801001ff:	89 e5                	mov    %esp,%ebp
+80100201:	53                   	push   %ebx
+80100202:	83 ec 10             	sub    $0x10,%esp
+80100205:	89 c3                	mov    %eax,%ebx
+  acquire(&bcache.lrulock);
+80100207:	68 a8 76 31 80       	push   $0x803176a8
+8010020c:	e8 ba 77 00 00       	call   801079cb <acquire>
+  b->next = bcache.head.next;
+80100211:	a1 30 77 31 80       	mov    0x80317730,%eax
+80100216:	89 43 54             	mov    %eax,0x54(%ebx)
+  b->prev = &bcache.head;
+80100219:	c7 43 50 dc 76 31 80 	movl   $0x803176dc,0x50(%ebx)
+  bcache.head.next->prev = b;
+80100220:	a1 30 77 31 80       	mov    0x80317730,%eax
+80100225:	89 58 50             	mov    %ebx,0x50(%eax)
+  bcache.head.next = b;
+80100228:	89 1d 30 77 31 80    	mov    %ebx,0x80317730
+  idleinc(b);
+8010022e:	89 d8                	mov    %ebx,%eax
+80100230:	e8 5f fe ff ff       	call   80100094 <idleinc>
+  release(&bcache.lrulock);
+80100235:	c7 04 24 a8 76 31 80 	movl   $0x803176a8,(%esp)
+8010023c:	e8 ef 77 00 00       	call   80107a30 <release>
+}
+80100241:	83 c4 10             	add    $0x10,%esp
+80100244:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100247:	c9                   	leave
+80100248:	c3                   	ret
+
+80100249 <bslabfree>:
+{
+80100249:	55                   	push   %ebp
+8010024a:	89 e5                	mov    %esp,%ebp
+8010024c:	57                   	push   %edi
+8010024d:	56                   	push   %esi
+8010024e:	53                   	push   %ebx
+8010024f:	83 ec 1c             	sub    $0x1c,%esp
+80100252:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < BSLABBUFS; i++)
+80100254:	b8 00 00 00 00       	mov    $0x0,%eax
+80100259:	83 f8 0f             	cmp    $0xf,%eax
+8010025c:	7f 21                	jg     8010027f <bslabfree+0x36>
+    if(s->buf[i].refcnt || (s->buf[i].flags & (B_DIRTY|B_ASYNC)))
+8010025e:	6b d0 64             	imul   $0x64,%eax,%edx
+80100261:	83 bc 13 9c 00 00 00 	cmpl   $0x0,0x9c(%ebx,%edx,1)
+80100268:	00 
+80100269:	0f 85 30 01 00 00    	jne    8010039f <bslabfree+0x156>
+8010026f:	f6 44 13 50 0c       	testb  $0xc,0x50(%ebx,%edx,1)
+80100274:	0f 85 32 01 00 00    	jne    801003ac <bslabfree+0x163>
+  for(i = 0; i < BSLABBUFS; i++)
+8010027a:	83 c0 01             	add    $0x1,%eax
+8010027d:	eb da                	jmp    80100259 <bslabfree+0x10>
+  for(i = 0; i < BSLABBUFS; i++){
+8010027f:	bf 00 00 00 00       	mov    $0x0,%edi
+80100284:	83 ff 0f             	cmp    $0xf,%edi
+80100287:	0f 8f c1 00 00 00    	jg     8010034e <bslabfree+0x105>
+    b = &s->buf[i];
+8010028d:	6b f7 64             	imul   $0x64,%edi,%esi
+80100290:	8d 44 33 50          	lea    0x50(%ebx,%esi,1),%eax
+80100294:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    bk = bhash(b->dev, b->blockno);
+80100297:	01 de                	add    %ebx,%esi
+80100299:	8b 56 58             	mov    0x58(%esi),%edx
+8010029c:	8b 46 54             	mov    0x54(%esi),%eax
+8010029f:	e8 90 fd ff ff       	call   80100034 <bhash>
+801002a4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    acquire(block(bk));
+801002a7:	e8 ae fd ff ff       	call   8010005a <block>
+801002ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801002af:	83 ec 0c             	sub    $0xc,%esp
+801002b2:	50                   	push   %eax
+801002b3:	e8 13 77 00 00       	call   801079cb <acquire>
+    if(b->refcnt || (b->flags & (B_DIRTY|B_ASYNC))){
+801002b8:	83 c4 10             	add    $0x10,%esp
+801002bb:	83 be 9c 00 00 00 00 	cmpl   $0x0,0x9c(%esi)
+801002c2:	75 3f                	jne    80100303 <bslabfree+0xba>
+801002c4:	6b c7 64             	imul   $0x64,%edi,%eax
+801002c7:	f6 44 03 50 0c       	testb  $0xc,0x50(%ebx,%eax,1)
+801002cc:	75 35                	jne    80100303 <bslabfree+0xba>
+    unhash(bk, b);
+801002ce:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801002d1:	89 f2                	mov    %esi,%edx
+801002d3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801002d6:	e8 4c fe ff ff       	call   80100127 <unhash>
+    lruremove(b);
+801002db:	89 f0                	mov    %esi,%eax
+801002dd:	e8 a6 fe ff ff       	call   80100188 <lruremove>
+    b->refcnt = 1;
+801002e2:	6b c7 64             	imul   $0x64,%edi,%eax
+801002e5:	c7 84 03 9c 00 00 00 	movl   $0x1,0x9c(%ebx,%eax,1)
+801002ec:	01 00 00 00 
+    release(block(bk));
+801002f0:	83 ec 0c             	sub    $0xc,%esp
+801002f3:	ff 75 e4             	push   -0x1c(%ebp)
+801002f6:	e8 35 77 00 00       	call   80107a30 <release>
+  for(i = 0; i < BSLABBUFS; i++){
+801002fb:	83 c7 01             	add    $0x1,%edi
+801002fe:	83 c4 10             	add    $0x10,%esp
+80100301:	eb 81                	jmp    80100284 <bslabfree+0x3b>
+      release(block(bk));
+80100303:	83 ec 0c             	sub    $0xc,%esp
+80100306:	ff 75 e4             	push   -0x1c(%ebp)
+80100309:	e8 22 77 00 00       	call   80107a30 <release>
+      for(j = 0; j < i; j++){
+8010030e:	83 c4 10             	add    $0x10,%esp
+80100311:	be 00 00 00 00       	mov    $0x0,%esi
+80100316:	eb 2b                	jmp    80100343 <bslabfree+0xfa>
+        b = &s->buf[j];
+80100318:	6b c6 64             	imul   $0x64,%esi,%eax
+8010031b:	8d 54 03 50          	lea    0x50(%ebx,%eax,1),%edx
+        b->dev = BNODEV;
+8010031f:	01 d8                	add    %ebx,%eax
+80100321:	c7 40 54 ff ff ff ff 	movl   $0xffffffff,0x54(%eax)
+        b->flags = 0;
+80100328:	c7 40 50 00 00 00 00 	movl   $0x0,0x50(%eax)
+        b->refcnt = 0;
+8010032f:	c7 80 9c 00 00 00 00 	movl   $0x0,0x9c(%eax)
+80100336:	00 00 00 
+        lruaddtail(b);
+80100339:	89 d0                	mov    %edx,%eax
+8010033b:	e8 fd fd ff ff       	call   8010013d <lruaddtail>
+      for(j = 0; j < i; j++){
+80100340:	83 c6 01             	add    $0x1,%esi
+80100343:	39 f7                	cmp    %esi,%edi
+80100345:	7f d1                	jg     80100318 <bslabfree+0xcf>
+      return -1;
+80100347:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010034c:	eb 56                	jmp    801003a4 <bslabfree+0x15b>
+  for(ss = &bcache.slabs; *ss != s; ss = &(*ss)->next)
+8010034e:	ba 9c 76 31 80       	mov    $0x8031769c,%edx
+80100353:	eb 02                	jmp    80100357 <bslabfree+0x10e>
+80100355:	89 c2                	mov    %eax,%edx
+80100357:	8b 02                	mov    (%edx),%eax
+80100359:	39 d8                	cmp    %ebx,%eax
+8010035b:	75 f8                	jne    80100355 <bslabfree+0x10c>
+  *ss = s->next;
+8010035d:	8b 03                	mov    (%ebx),%eax
+8010035f:	89 02                	mov    %eax,(%edx)
+  bcache.nslab--;
+80100361:	a1 a0 76 31 80       	mov    0x803176a0,%eax
+80100366:	83 e8 01             	sub    $0x1,%eax
+80100369:	a3 a0 76 31 80       	mov    %eax,0x803176a0
+  for(i = 0; i < BSLABPAGES; i++)
+8010036e:	be 00 00 00 00       	mov    $0x0,%esi
+80100373:	eb 12                	jmp    80100387 <bslabfree+0x13e>
+    kfree(s->page[i]);
+80100375:	83 ec 0c             	sub    $0xc,%esp
+80100378:	ff 74 b3 10          	push   0x10(%ebx,%esi,4)
+8010037c:	e8 f0 39 00 00       	call   80103d71 <kfree>
+  for(i = 0; i < BSLABPAGES; i++)
+80100381:	83 c6 01             	add    $0x1,%esi
+80100384:	83 c4 10             	add    $0x10,%esp
+80100387:	83 fe 0f             	cmp    $0xf,%esi
+8010038a:	7e e9                	jle    80100375 <bslabfree+0x12c>
+  kfree((char*)s);
+8010038c:	83 ec 0c             	sub    $0xc,%esp
+8010038f:	53                   	push   %ebx
+80100390:	e8 dc 39 00 00       	call   80103d71 <kfree>
+  return 0;
+80100395:	83 c4 10             	add    $0x10,%esp
+80100398:	b8 00 00 00 00       	mov    $0x0,%eax
+8010039d:	eb 05                	jmp    801003a4 <bslabfree+0x15b>
+      return -1;
+8010039f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801003a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801003a7:	5b                   	pop    %ebx
+801003a8:	5e                   	pop    %esi
+801003a9:	5f                   	pop    %edi
+801003aa:	5d                   	pop    %ebp
+801003ab:	c3                   	ret
+      return -1;
+801003ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801003b1:	eb f1                	jmp    801003a4 <bslabfree+0x15b>
+
+801003b3 <bshrink>:
+  if(bcache.nslab <= BMINSLAB)
+801003b3:	83 3d a0 76 31 80 03 	cmpl   $0x3,0x803176a0
+801003ba:	7e 73                	jle    8010042f <bshrink+0x7c>
+{
+801003bc:	55                   	push   %ebp
+801003bd:	89 e5                	mov    %esp,%ebp
+801003bf:	53                   	push   %ebx
+801003c0:	83 ec 10             	sub    $0x10,%esp
+  acquire(&bcache.lrulock);
+801003c3:	68 a8 76 31 80       	push   $0x803176a8
+801003c8:	e8 fe 75 00 00       	call   801079cb <acquire>
+  s = bcache.idle;
+801003cd:	8b 1d 40 77 31 80    	mov    0x80317740,%ebx
+  release(&bcache.lrulock);
+801003d3:	c7 04 24 a8 76 31 80 	movl   $0x803176a8,(%esp)
+801003da:	e8 51 76 00 00       	call   80107a30 <release>
+  if(s == 0)
+801003df:	83 c4 10             	add    $0x10,%esp
+801003e2:	85 db                	test   %ebx,%ebx
+801003e4:	74 4f                	je     80100435 <bshrink+0x82>
+  if(bslabfree(s) == 0)
+801003e6:	89 d8                	mov    %ebx,%eax
+801003e8:	e8 5c fe ff ff       	call   80100249 <bslabfree>
+801003ed:	85 c0                	test   %eax,%eax
+801003ef:	75 05                	jne    801003f6 <bshrink+0x43>
+}
+801003f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801003f4:	c9                   	leave
+801003f5:	c3                   	ret
+  acquire(&bcache.lrulock);
+801003f6:	83 ec 0c             	sub    $0xc,%esp
+801003f9:	68 a8 76 31 80       	push   $0x803176a8
+801003fe:	e8 c8 75 00 00       	call   801079cb <acquire>
+  if(bcache.idle == s)
+80100403:	83 c4 10             	add    $0x10,%esp
+80100406:	39 1d 40 77 31 80    	cmp    %ebx,0x80317740
+8010040c:	74 17                	je     80100425 <bshrink+0x72>
+  release(&bcache.lrulock);
+8010040e:	83 ec 0c             	sub    $0xc,%esp
+80100411:	68 a8 76 31 80       	push   $0x803176a8
+80100416:	e8 15 76 00 00       	call   80107a30 <release>
+  return -1;
+8010041b:	83 c4 10             	add    $0x10,%esp
+8010041e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100423:	eb cc                	jmp    801003f1 <bshrink+0x3e>
+    bcache.idle = s->inext;
+80100425:	8b 43 04             	mov    0x4(%ebx),%eax
+80100428:	a3 40 77 31 80       	mov    %eax,0x80317740
+8010042d:	eb df                	jmp    8010040e <bshrink+0x5b>
+    return -1;
+8010042f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80100434:	c3                   	ret
+    return -1;
+80100435:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010043a:	eb b5                	jmp    801003f1 <bshrink+0x3e>
+
+8010043c <bgrow>:
+{
+8010043c:	55                   	push   %ebp
+8010043d:	89 e5                	mov    %esp,%ebp
+8010043f:	57                   	push   %edi
+80100440:	56                   	push   %esi
+80100441:	53                   	push   %ebx
+80100442:	83 ec 1c             	sub    $0x1c,%esp
+  if((s = (struct bslab*)kalloc()) == 0)
+80100445:	e8 46 3b 00 00       	call   80103f90 <kalloc>
+8010044a:	85 c0                	test   %eax,%eax
+8010044c:	0f 84 c7 00 00 00    	je     80100519 <bgrow+0xdd>
+80100452:	89 c6                	mov    %eax,%esi
+  memset(s, 0, sizeof(*s));
+80100454:	83 ec 04             	sub    $0x4,%esp
+80100457:	68 90 06 00 00       	push   $0x690
+8010045c:	6a 00                	push   $0x0
+8010045e:	50                   	push   %eax
+8010045f:	e8 13 76 00 00       	call   80107a77 <memset>
+  for(i = 0; i < BSLABPAGES; i++){
+80100464:	83 c4 10             	add    $0x10,%esp
+80100467:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010046c:	83 fb 0f             	cmp    $0xf,%ebx
+8010046f:	7f 39                	jg     801004aa <bgrow+0x6e>
+    if((s->page[i] = kalloc()) == 0){
+80100471:	e8 1a 3b 00 00       	call   80103f90 <kalloc>
+80100476:	89 44 9e 10          	mov    %eax,0x10(%esi,%ebx,4)
+8010047a:	85 c0                	test   %eax,%eax
+8010047c:	74 14                	je     80100492 <bgrow+0x56>
+  for(i = 0; i < BSLABPAGES; i++){
+8010047e:	83 c3 01             	add    $0x1,%ebx
+80100481:	eb e9                	jmp    8010046c <bgrow+0x30>
+        kfree(s->page[i]);
+80100483:	83 ec 0c             	sub    $0xc,%esp
+80100486:	ff 74 9e 10          	push   0x10(%esi,%ebx,4)
+8010048a:	e8 e2 38 00 00       	call   80103d71 <kfree>
+8010048f:	83 c4 10             	add    $0x10,%esp
+      while(--i >= 0)
+80100492:	83 eb 01             	sub    $0x1,%ebx
+80100495:	79 ec                	jns    80100483 <bgrow+0x47>
+      kfree((char*)s);
+80100497:	83 ec 0c             	sub    $0xc,%esp
+8010049a:	56                   	push   %esi
+8010049b:	e8 d1 38 00 00       	call   80103d71 <kfree>
+      return -1;
+801004a0:	83 c4 10             	add    $0x10,%esp
+801004a3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801004a8:	eb 67                	jmp    80100511 <bgrow+0xd5>
+  for(i = 0; i < BSLABBUFS; i++){
+801004aa:	bf 00 00 00 00       	mov    $0x0,%edi
+801004af:	eb 3c                	jmp    801004ed <bgrow+0xb1>
+    b = &s->buf[i];
+801004b1:	6b df 64             	imul   $0x64,%edi,%ebx
+801004b4:	8d 44 1e 50          	lea    0x50(%esi,%ebx,1),%eax
+    initsleeplock(&b->lock, "buffer");
+801004b8:	83 ec 08             	sub    $0x8,%esp
+801004bb:	68 c0 b0 10 80       	push   $0x8010b0c0
+801004c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801004c3:	83 c0 0c             	add    $0xc,%eax
+801004c6:	50                   	push   %eax
+801004c7:	e8 d7 72 00 00       	call   801077a3 <initsleeplock>
+    b->dev = BNODEV;
+801004cc:	01 f3                	add    %esi,%ebx
+801004ce:	c7 43 54 ff ff ff ff 	movl   $0xffffffff,0x54(%ebx)
+    b->data = (uchar*)s->page[i*BSIZE/PGSIZE] + (i*BSIZE)%PGSIZE;
+801004d5:	8b 44 be 10          	mov    0x10(%esi,%edi,4),%eax
+801004d9:	89 83 b0 00 00 00    	mov    %eax,0xb0(%ebx)
+    lruaddtail(b);
+801004df:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801004e2:	e8 56 fc ff ff       	call   8010013d <lruaddtail>
+  for(i = 0; i < BSLABBUFS; i++){
+801004e7:	83 c7 01             	add    $0x1,%edi
+801004ea:	83 c4 10             	add    $0x10,%esp
+801004ed:	83 ff 0f             	cmp    $0xf,%edi
+801004f0:	7e bf                	jle    801004b1 <bgrow+0x75>
+  s->next = bcache.slabs;
+801004f2:	a1 9c 76 31 80       	mov    0x8031769c,%eax
+801004f7:	89 06                	mov    %eax,(%esi)
+  bcache.slabs = s;
+801004f9:	89 35 9c 76 31 80    	mov    %esi,0x8031769c
+  bcache.nslab++;
+801004ff:	a1 a0 76 31 80       	mov    0x803176a0,%eax
+80100504:	83 c0 01             	add    $0x1,%eax
+80100507:	a3 a0 76 31 80       	mov    %eax,0x803176a0
+  return 0;
+8010050c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80100511:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100514:	5b                   	pop    %ebx
+80100515:	5e                   	pop    %esi
+80100516:	5f                   	pop    %edi
+80100517:	5d                   	pop    %ebp
+80100518:	c3                   	ret
+    return -1;
+80100519:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010051e:	eb f1                	jmp    80100511 <bgrow+0xd5>
+
+80100520 <bget1>:
+// If not found, allocate a buffer.
+// In either case, return locked buffer. If every buffer is
+// in use, panic, or return 0 if canfail is set.
+static struct buf*
+bget1(uint dev, uint blockno, int canfail)
+{
+80100520:	55                   	push   %ebp
+80100521:	89 e5                	mov    %esp,%ebp
+80100523:	57                   	push   %edi
+80100524:	56                   	push   %esi
+80100525:	53                   	push   %ebx
+80100526:	83 ec 2c             	sub    $0x2c,%esp
+80100529:	89 c3                	mov    %eax,%ebx
+8010052b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010052e:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  struct buf *b;
+  struct bucket *bk, *obk;
+
+  bk = bhash(dev, blockno);
+80100531:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80100534:	e8 fb fa ff ff       	call   80100034 <bhash>
+80100539:	89 c6                	mov    %eax,%esi
+8010053b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+
+  // Is the block already cached?
+  acquire(block(bk));
+8010053e:	e8 17 fb ff ff       	call   8010005a <block>
+80100543:	89 c7                	mov    %eax,%edi
+80100545:	83 ec 0c             	sub    $0xc,%esp
+80100548:	50                   	push   %eax
+80100549:	e8 7d 74 00 00       	call   801079cb <acquire>
+  b = blookup(bk, dev, blockno);
+8010054e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80100551:	89 da                	mov    %ebx,%edx
+80100553:	89 f0                	mov    %esi,%eax
+80100555:	e8 6b fc ff ff       	call   801001c5 <blookup>
+8010055a:	89 c6                	mov    %eax,%esi
+8010055c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  release(block(bk));
+8010055f:	89 3c 24             	mov    %edi,(%esp)
+80100562:	e8 c9 74 00 00       	call   80107a30 <release>
+  if(b){
+80100567:	83 c4 10             	add    $0x10,%esp
+8010056a:	85 f6                	test   %esi,%esi
+8010056c:	74 1c                	je     8010058a <bget1+0x6a>
+8010056e:	89 f0                	mov    %esi,%eax
+    acquiresleep(&b->lock);
+80100570:	83 ec 0c             	sub    $0xc,%esp
+80100573:	83 c0 0c             	add    $0xc,%eax
+80100576:	50                   	push   %eax
+80100577:	e8 5a 72 00 00       	call   801077d6 <acquiresleep>
+    return b;
+8010057c:	83 c4 10             	add    $0x10,%esp
+  release(block(bk));
+  release(&bcache.evictlock);
+
+  acquiresleep(&b->lock);
+  return b;
+}
+8010057f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100582:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100585:	5b                   	pop    %ebx
+80100586:	5e                   	pop    %esi
+80100587:	5f                   	pop    %edi
+80100588:	5d                   	pop    %ebp
+80100589:	c3                   	ret
+  acquire(&bcache.evictlock);
+8010058a:	83 ec 0c             	sub    $0xc,%esp
+8010058d:	68 68 76 31 80       	push   $0x80317668
+80100592:	e8 34 74 00 00       	call   801079cb <acquire>
+  acquire(block(bk));
+80100597:	89 3c 24             	mov    %edi,(%esp)
+8010059a:	e8 2c 74 00 00       	call   801079cb <acquire>
+  b = blookup(bk, dev, blockno);
+8010059f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801005a2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+801005a5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801005a8:	e8 18 fc ff ff       	call   801001c5 <blookup>
+801005ad:	89 c6                	mov    %eax,%esi
+801005af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  release(block(bk));
+801005b2:	89 3c 24             	mov    %edi,(%esp)
+801005b5:	e8 76 74 00 00       	call   80107a30 <release>
+  if(b){
+801005ba:	83 c4 10             	add    $0x10,%esp
+801005bd:	85 f6                	test   %esi,%esi
+801005bf:	74 1d                	je     801005de <bget1+0xbe>
+    release(&bcache.evictlock);
+801005c1:	83 ec 0c             	sub    $0xc,%esp
+801005c4:	68 68 76 31 80       	push   $0x80317668
+801005c9:	e8 62 74 00 00       	call   80107a30 <release>
+    acquiresleep(&b->lock);
+801005ce:	8d 46 0c             	lea    0xc(%esi),%eax
+801005d1:	89 04 24             	mov    %eax,(%esp)
+801005d4:	e8 fd 71 00 00       	call   801077d6 <acquiresleep>
+    return b;
+801005d9:	83 c4 10             	add    $0x10,%esp
+801005dc:	eb a1                	jmp    8010057f <bget1+0x5f>
+  if(kfreepages() < BLOWATER)
+801005de:	e8 ec 39 00 00       	call   80103fcf <kfreepages>
+801005e3:	3d ff 00 00 00       	cmp    $0xff,%eax
+801005e8:	7e 12                	jle    801005fc <bget1+0xdc>
+  else if(bcache.nslab < bcache.maxslab)
+801005ea:	a1 a4 76 31 80       	mov    0x803176a4,%eax
+801005ef:	39 05 a0 76 31 80    	cmp    %eax,0x803176a0
+801005f5:	7c 0f                	jl     80100606 <bget1+0xe6>
+801005f7:	89 7d d0             	mov    %edi,-0x30(%ebp)
+801005fa:	eb 63                	jmp    8010065f <bget1+0x13f>
+    bshrink();
+801005fc:	e8 b2 fd ff ff       	call   801003b3 <bshrink>
+80100601:	89 7d d0             	mov    %edi,-0x30(%ebp)
+80100604:	eb 59                	jmp    8010065f <bget1+0x13f>
+    bgrow();
+80100606:	e8 31 fe ff ff       	call   8010043c <bgrow>
+8010060b:	89 7d d0             	mov    %edi,-0x30(%ebp)
+8010060e:	eb 4f                	jmp    8010065f <bget1+0x13f>
+    release(&bcache.lrulock);
+80100610:	83 ec 0c             	sub    $0xc,%esp
+80100613:	68 a8 76 31 80       	push   $0x803176a8
+80100618:	e8 13 74 00 00       	call   80107a30 <release>
+    if(b == &bcache.head){
+8010061d:	83 c4 10             	add    $0x10,%esp
+80100620:	81 fb dc 76 31 80    	cmp    $0x803176dc,%ebx
+80100626:	74 5f                	je     80100687 <bget1+0x167>
+    obk = bhash(b->dev, b->blockno);
+80100628:	8b 53 08             	mov    0x8(%ebx),%edx
+8010062b:	8b 43 04             	mov    0x4(%ebx),%eax
+8010062e:	e8 01 fa ff ff       	call   80100034 <bhash>
+80100633:	89 c7                	mov    %eax,%edi
+    acquire(block(obk));
+80100635:	e8 20 fa ff ff       	call   8010005a <block>
+8010063a:	89 c6                	mov    %eax,%esi
+8010063c:	83 ec 0c             	sub    $0xc,%esp
+8010063f:	50                   	push   %eax
+80100640:	e8 86 73 00 00       	call   801079cb <acquire>
+    if(b->refcnt == 0 && (b->flags & (B_DIRTY|B_ASYNC)) == 0)
+80100645:	83 c4 10             	add    $0x10,%esp
+80100648:	83 7b 4c 00          	cmpl   $0x0,0x4c(%ebx)
+8010064c:	75 05                	jne    80100653 <bget1+0x133>
+8010064e:	f6 03 0c             	testb  $0xc,(%ebx)
+80100651:	74 5c                	je     801006af <bget1+0x18f>
+    release(block(obk));
+80100653:	83 ec 0c             	sub    $0xc,%esp
+80100656:	56                   	push   %esi
+80100657:	e8 d4 73 00 00       	call   80107a30 <release>
+    acquire(&bcache.lrulock);
+8010065c:	83 c4 10             	add    $0x10,%esp
+8010065f:	83 ec 0c             	sub    $0xc,%esp
+80100662:	68 a8 76 31 80       	push   $0x803176a8
+80100667:	e8 5f 73 00 00       	call   801079cb <acquire>
+    for(b = bcache.head.prev; b != &bcache.head; b = b->prev)
+8010066c:	8b 1d 2c 77 31 80    	mov    0x8031772c,%ebx
+80100672:	83 c4 10             	add    $0x10,%esp
+80100675:	81 fb dc 76 31 80    	cmp    $0x803176dc,%ebx
+8010067b:	74 93                	je     80100610 <bget1+0xf0>
+      if((b->flags & (B_DIRTY|B_ASYNC)) == 0)
+8010067d:	f6 03 0c             	testb  $0xc,(%ebx)
+80100680:	74 8e                	je     80100610 <bget1+0xf0>
+    for(b = bcache.head.prev; b != &bcache.head; b = b->prev)
+80100682:	8b 5b 50             	mov    0x50(%ebx),%ebx
+80100685:	eb ee                	jmp    80100675 <bget1+0x155>
+      if(canfail){
+80100687:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+8010068b:	74 15                	je     801006a2 <bget1+0x182>
+        release(&bcache.evictlock);
+8010068d:	83 ec 0c             	sub    $0xc,%esp
+80100690:	68 68 76 31 80       	push   $0x80317668
+80100695:	e8 96 73 00 00       	call   80107a30 <release>
+        return 0;
+8010069a:	83 c4 10             	add    $0x10,%esp
+8010069d:	e9 dd fe ff ff       	jmp    8010057f <bget1+0x5f>
+      panic("bget: no buffers");
+801006a2:	83 ec 0c             	sub    $0xc,%esp
+801006a5:	68 c7 b0 10 80       	push   $0x8010b0c7
+801006aa:	e8 77 04 00 00       	call   80100b26 <panic>
+  unhash(obk, b);
+801006af:	89 f8                	mov    %edi,%eax
+801006b1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+801006b4:	89 da                	mov    %ebx,%edx
+801006b6:	e8 6c fa ff ff       	call   80100127 <unhash>
+  lruremove(b);
+801006bb:	89 d8                	mov    %ebx,%eax
+801006bd:	e8 c6 fa ff ff       	call   80100188 <lruremove>
+  b->refcnt = 1;
+801006c2:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+  release(block(obk));
+801006c9:	83 ec 0c             	sub    $0xc,%esp
+801006cc:	56                   	push   %esi
+801006cd:	e8 5e 73 00 00       	call   80107a30 <release>
+  b->dev = dev;
+801006d2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801006d5:	89 43 04             	mov    %eax,0x4(%ebx)
+  b->blockno = blockno;
+801006d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801006db:	89 43 08             	mov    %eax,0x8(%ebx)
+  b->flags = 0;
+801006de:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  acquire(block(bk));
+801006e4:	89 3c 24             	mov    %edi,(%esp)
+801006e7:	e8 df 72 00 00       	call   801079cb <acquire>
+  b->hnext = bk->head;
+801006ec:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+801006ef:	8b 01                	mov    (%ecx),%eax
+801006f1:	89 43 58             	mov    %eax,0x58(%ebx)
+  bk->head = b;
+801006f4:	89 19                	mov    %ebx,(%ecx)
+  release(block(bk));
+801006f6:	89 3c 24             	mov    %edi,(%esp)
+801006f9:	e8 32 73 00 00       	call   80107a30 <release>
+  release(&bcache.evictlock);
+801006fe:	c7 04 24 68 76 31 80 	movl   $0x80317668,(%esp)
+80100705:	e8 26 73 00 00       	call   80107a30 <release>
+  acquiresleep(&b->lock);
+8010070a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010070d:	89 04 24             	mov    %eax,(%esp)
+80100710:	e8 c1 70 00 00       	call   801077d6 <acquiresleep>
+  return b;
+80100715:	83 c4 10             	add    $0x10,%esp
+80100718:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010071b:	e9 5f fe ff ff       	jmp    8010057f <bget1+0x5f>
+
+80100720 <bget>:
+
+static struct buf*
+bget(uint dev, uint blockno)
+{
+80100720:	55                   	push   %ebp
+80100721:	89 e5                	mov    %esp,%ebp
+80100723:	53                   	push   %ebx
+80100724:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  b = bget1(dev, blockno, 0);
+80100727:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010072c:	e8 ef fd ff ff       	call   80100520 <bget1>
+80100731:	89 c3                	mov    %eax,%ebx
+  if(b->flags & B_ASYNC)
+80100733:	f6 00 08             	testb  $0x8,(%eax)
+80100736:	75 07                	jne    8010073f <bget+0x1f>
+    idewaitahead(b);
+  return b;
+}
+80100738:	89 d8                	mov    %ebx,%eax
+8010073a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010073d:	c9                   	leave
+8010073e:	c3                   	ret
+    idewaitahead(b);
+8010073f:	83 ec 0c             	sub    $0xc,%esp
+80100742:	50                   	push   %eax
+80100743:	e8 6d a9 00 00       	call   8010b0b5 <idewaitahead>
+80100748:	83 c4 10             	add    $0x10,%esp
+  return b;
+8010074b:	eb eb                	jmp    80100738 <bget+0x18>
+
+8010074d <breclaim>:
+{
+8010074d:	55                   	push   %ebp
+8010074e:	89 e5                	mov    %esp,%ebp
+80100750:	53                   	push   %ebx
+80100751:	83 ec 10             	sub    $0x10,%esp
+  if(holding(&bcache.evictlock))
+80100754:	68 68 76 31 80       	push   $0x80317668
+80100759:	e8 2e 72 00 00       	call   8010798c <holding>
+8010075e:	83 c4 10             	add    $0x10,%esp
+80100761:	85 c0                	test   %eax,%eax
+80100763:	75 2a                	jne    8010078f <breclaim+0x42>
+  acquire(&bcache.evictlock);
+80100765:	83 ec 0c             	sub    $0xc,%esp
+80100768:	68 68 76 31 80       	push   $0x80317668
+8010076d:	e8 59 72 00 00       	call   801079cb <acquire>
+  r = bshrink();
+80100772:	e8 3c fc ff ff       	call   801003b3 <bshrink>
+80100777:	89 c3                	mov    %eax,%ebx
+  release(&bcache.evictlock);
+80100779:	c7 04 24 68 76 31 80 	movl   $0x80317668,(%esp)
+80100780:	e8 ab 72 00 00       	call   80107a30 <release>
+  return r;
+80100785:	83 c4 10             	add    $0x10,%esp
+}
+80100788:	89 d8                	mov    %ebx,%eax
+8010078a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010078d:	c9                   	leave
+8010078e:	c3                   	ret
+    return -1;
+8010078f:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80100794:	eb f2                	jmp    80100788 <breclaim+0x3b>
+
+80100796 <binit>:
+{
+80100796:	55                   	push   %ebp
+80100797:	89 e5                	mov    %esp,%ebp
+80100799:	53                   	push   %ebx
+8010079a:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&bcache.evictlock, "bcache.evict");
+8010079d:	68 d8 b0 10 80       	push   $0x8010b0d8
+801007a2:	68 68 76 31 80       	push   $0x80317668
+801007a7:	e8 db 70 00 00       	call   80107887 <initlock>
+  initlock(&bcache.lrulock, "bcache.lru");
+801007ac:	83 c4 08             	add    $0x8,%esp
+801007af:	68 e5 b0 10 80       	push   $0x8010b0e5
+801007b4:	68 a8 76 31 80       	push   $0x803176a8
+801007b9:	e8 c9 70 00 00       	call   80107887 <initlock>
+  for(i = 0; i < NBLOCK; i++)
+801007be:	83 c4 10             	add    $0x10,%esp
+801007c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+801007c6:	eb 1c                	jmp    801007e4 <binit+0x4e>
+    initlock(&bcache.block[i], "bcache.bucket");
+801007c8:	83 ec 08             	sub    $0x8,%esp
+801007cb:	68 f0 b0 10 80       	push   $0x8010b0f0
+801007d0:	6b c3 34             	imul   $0x34,%ebx,%eax
+801007d3:	05 00 00 31 80       	add    $0x80310000,%eax
+801007d8:	50                   	push   %eax
+801007d9:	e8 a9 70 00 00       	call   80107887 <initlock>
+  for(i = 0; i < NBLOCK; i++)
+801007de:	83 c3 01             	add    $0x1,%ebx
+801007e1:	83 c4 10             	add    $0x10,%esp
+801007e4:	83 fb 3c             	cmp    $0x3c,%ebx
+801007e7:	7e df                	jle    801007c8 <binit+0x32>
+  bcache.head.prev = &bcache.head;
+801007e9:	c7 05 2c 77 31 80 dc 	movl   $0x803176dc,0x8031772c
+801007f0:	76 31 80 
+  bcache.head.next = &bcache.head;
+801007f3:	c7 05 30 77 31 80 dc 	movl   $0x803176dc,0x80317730
+801007fa:	76 31 80 
+  for(i = 0; i < BMINSLAB; i++)
+801007fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100802:	83 fb 02             	cmp    $0x2,%ebx
+80100805:	7f 1b                	jg     80100822 <binit+0x8c>
+    if(bgrow() < 0)
+80100807:	e8 30 fc ff ff       	call   8010043c <bgrow>
+8010080c:	85 c0                	test   %eax,%eax
+8010080e:	78 05                	js     80100815 <binit+0x7f>
+  for(i = 0; i < BMINSLAB; i++)
+80100810:	83 c3 01             	add    $0x1,%ebx
+80100813:	eb ed                	jmp    80100802 <binit+0x6c>
+      panic("binit");
+80100815:	83 ec 0c             	sub    $0xc,%esp
+80100818:	68 fe b0 10 80       	push   $0x8010b0fe
+8010081d:	e8 04 03 00 00       	call   80100b26 <panic>
+  bcache.maxslab = BMINSLAB;
+80100822:	c7 05 a4 76 31 80 03 	movl   $0x3,0x803176a4
+80100829:	00 00 00 
+}
+8010082c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010082f:	c9                   	leave
+80100830:	c3                   	ret
+
+80100831 <binit2>:
+{
+80100831:	55                   	push   %ebp
+80100832:	89 e5                	mov    %esp,%ebp
+80100834:	83 ec 08             	sub    $0x8,%esp
+  n = kfreepages() / BCACHEFRAC / (BSLABPAGES + 1);
+80100837:	e8 93 37 00 00       	call   80103fcf <kfreepages>
+8010083c:	89 c1                	mov    %eax,%ecx
+8010083e:	ba 79 78 78 78       	mov    $0x78787879,%edx
+80100843:	f7 ea                	imul   %edx
+80100845:	c1 fa 06             	sar    $0x6,%edx
+80100848:	89 c8                	mov    %ecx,%eax
+8010084a:	c1 f8 1f             	sar    $0x1f,%eax
+8010084d:	29 c2                	sub    %eax,%edx
+  if(n > BMAXSLAB)
+8010084f:	81 f9 c7 e1 00 00    	cmp    $0xe1c7,%ecx
+80100855:	7e 05                	jle    8010085c <binit2+0x2b>
+    n = BMAXSLAB;
+80100857:	ba a8 01 00 00       	mov    $0x1a8,%edx
+  if(n > bcache.maxslab)
+8010085c:	39 15 a4 76 31 80    	cmp    %edx,0x803176a4
+80100862:	7d 06                	jge    8010086a <binit2+0x39>
+    bcache.maxslab = n;
+80100864:	89 15 a4 76 31 80    	mov    %edx,0x803176a4
+}
+8010086a:	c9                   	leave
+8010086b:	c3                   	ret
+
+8010086c <bread>:
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+8010086c:	55                   	push   %ebp
+8010086d:	89 e5                	mov    %esp,%ebp
+8010086f:	53                   	push   %ebx
+80100870:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+80100873:	8b 55 0c             	mov    0xc(%ebp),%edx
+80100876:	8b 45 08             	mov    0x8(%ebp),%eax
+80100879:	e8 a2 fe ff ff       	call   80100720 <bget>
+8010087e:	89 c3                	mov    %eax,%ebx
+  if((b->flags & B_VALID) == 0) {
+80100880:	f6 00 02             	testb  $0x2,(%eax)
+80100883:	74 07                	je     8010088c <bread+0x20>
+    iderw(b);
+  }
+  return b;
+}
+80100885:	89 d8                	mov    %ebx,%eax
+80100887:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010088a:	c9                   	leave
+8010088b:	c3                   	ret
+    iderw(b);
+8010088c:	83 ec 0c             	sub    $0xc,%esp
+8010088f:	50                   	push   %eax
+80100890:	e8 26 a7 00 00       	call   8010afbb <iderw>
+80100895:	83 c4 10             	add    $0x10,%esp
+  return b;
+80100898:	eb eb                	jmp    80100885 <bread+0x19>
+
+8010089a <bwrite>:
+}
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+8010089a:	55                   	push   %ebp
+8010089b:	89 e5                	mov    %esp,%ebp
+8010089d:	53                   	push   %ebx
+8010089e:	83 ec 10             	sub    $0x10,%esp
+801008a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801008a4:	8d 43 0c             	lea    0xc(%ebx),%eax
+801008a7:	50                   	push   %eax
+801008a8:	e8 b3 6f 00 00       	call   80107860 <holdingsleep>
+801008ad:	83 c4 10             	add    $0x10,%esp
+801008b0:	85 c0                	test   %eax,%eax
+801008b2:	74 18                	je     801008cc <bwrite+0x32>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+801008b4:	8b 03                	mov    (%ebx),%eax
+801008b6:	83 c8 04             	or     $0x4,%eax
+801008b9:	89 03                	mov    %eax,(%ebx)
+  iderw(b);
+801008bb:	83 ec 0c             	sub    $0xc,%esp
+801008be:	53                   	push   %ebx
+801008bf:	e8 f7 a6 00 00       	call   8010afbb <iderw>
+}
+801008c4:	83 c4 10             	add    $0x10,%esp
+801008c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801008ca:	c9                   	leave
+801008cb:	c3                   	ret
+    panic("bwrite");
+801008cc:	83 ec 0c             	sub    $0xc,%esp
+801008cf:	68 04 b1 10 80       	push   $0x8010b104
+801008d4:	e8 4d 02 00 00       	call   80100b26 <panic>
+
+801008d9 <bwritev>:
+// Write n buffers' contents to disk as one batch, so the disk
+// driver can merge neighbouring blocks. All must be locked and
+// for the same device (log.c only writes to log.dev).
+void
+bwritev(struct buf **bufs, int n)
+{
+801008d9:	55                   	push   %ebp
+801008da:	89 e5                	mov    %esp,%ebp
+801008dc:	57                   	push   %edi
+801008dd:	56                   	push   %esi
+801008de:	53                   	push   %ebx
+801008df:	83 ec 0c             	sub    $0xc,%esp
+801008e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  for(i = 0; i < n; i++){
+801008e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+801008ea:	39 fb                	cmp    %edi,%ebx
+801008ec:	7d 36                	jge    80100924 <bwritev+0x4b>
+    if(!holdingsleep(&bufs[i]->lock))
+801008ee:	8b 45 08             	mov    0x8(%ebp),%eax
+801008f1:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+801008f4:	83 ec 0c             	sub    $0xc,%esp
+801008f7:	8b 06                	mov    (%esi),%eax
+801008f9:	83 c0 0c             	add    $0xc,%eax
+801008fc:	50                   	push   %eax
+801008fd:	e8 5e 6f 00 00       	call   80107860 <holdingsleep>
+80100902:	83 c4 10             	add    $0x10,%esp
+80100905:	85 c0                	test   %eax,%eax
+80100907:	74 0e                	je     80100917 <bwritev+0x3e>
+      panic("bwritev");
+    bufs[i]->flags |= B_DIRTY;
+80100909:	8b 16                	mov    (%esi),%edx
+8010090b:	8b 02                	mov    (%edx),%eax
+8010090d:	83 c8 04             	or     $0x4,%eax
+80100910:	89 02                	mov    %eax,(%edx)
+  for(i = 0; i < n; i++){
+80100912:	83 c3 01             	add    $0x1,%ebx
+80100915:	eb d3                	jmp    801008ea <bwritev+0x11>
+      panic("bwritev");
+80100917:	83 ec 0c             	sub    $0xc,%esp
+8010091a:	68 0b b1 10 80       	push   $0x8010b10b
+8010091f:	e8 02 02 00 00       	call   80100b26 <panic>
+  }
+  iderwv(bufs, n);
+80100924:	83 ec 08             	sub    $0x8,%esp
+80100927:	57                   	push   %edi
+80100928:	ff 75 08             	push   0x8(%ebp)
+8010092b:	e8 3f a7 00 00       	call   8010b06f <iderwv>
+}
+80100930:	83 c4 10             	add    $0x10,%esp
+80100933:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100936:	5b                   	pop    %ebx
+80100937:	5e                   	pop    %esi
+80100938:	5f                   	pop    %edi
+80100939:	5d                   	pop    %ebp
+8010093a:	c3                   	ret
+
+8010093b <brelse>:
+
+// Release a locked buffer.
+// If no one else holds it, move it to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+8010093b:	55                   	push   %ebp
+8010093c:	89 e5                	mov    %esp,%ebp
+8010093e:	56                   	push   %esi
+8010093f:	53                   	push   %ebx
+80100940:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct bucket *bk;
+
+  if(!holdingsleep(&b->lock))
+80100943:	8d 73 0c             	lea    0xc(%ebx),%esi
+80100946:	83 ec 0c             	sub    $0xc,%esp
+80100949:	56                   	push   %esi
+8010094a:	e8 11 6f 00 00       	call   80107860 <holdingsleep>
+8010094f:	83 c4 10             	add    $0x10,%esp
+80100952:	85 c0                	test   %eax,%eax
+80100954:	74 46                	je     8010099c <brelse+0x61>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+80100956:	83 ec 0c             	sub    $0xc,%esp
+80100959:	56                   	push   %esi
+8010095a:	e8 c6 6e 00 00       	call   80107825 <releasesleep>
+
+  bk = bhash(b->dev, b->blockno);
+8010095f:	8b 53 08             	mov    0x8(%ebx),%edx
+80100962:	8b 43 04             	mov    0x4(%ebx),%eax
+80100965:	e8 ca f6 ff ff       	call   80100034 <bhash>
+  acquire(block(bk));
+8010096a:	e8 eb f6 ff ff       	call   8010005a <block>
+8010096f:	89 c6                	mov    %eax,%esi
+80100971:	89 04 24             	mov    %eax,(%esp)
+80100974:	e8 52 70 00 00       	call   801079cb <acquire>
+  b->refcnt--;
+80100979:	8b 43 4c             	mov    0x4c(%ebx),%eax
+8010097c:	83 e8 01             	sub    $0x1,%eax
+8010097f:	89 43 4c             	mov    %eax,0x4c(%ebx)
+  if (b->refcnt == 0) {
+80100982:	83 c4 10             	add    $0x10,%esp
+80100985:	85 c0                	test   %eax,%eax
+80100987:	74 20                	je     801009a9 <brelse+0x6e>
+    // no one is waiting for it.
+    lruadd(b);
+  }
+  release(block(bk));
+80100989:	83 ec 0c             	sub    $0xc,%esp
+8010098c:	56                   	push   %esi
+8010098d:	e8 9e 70 00 00       	call   80107a30 <release>
+}
+80100992:	83 c4 10             	add    $0x10,%esp
+80100995:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100998:	5b                   	pop    %ebx
+80100999:	5e                   	pop    %esi
+8010099a:	5d                   	pop    %ebp
+8010099b:	c3                   	ret
+    panic("brelse");
+8010099c:	83 ec 0c             	sub    $0xc,%esp
+8010099f:	68 13 b1 10 80       	push   $0x8010b113
+801009a4:	e8 7d 01 00 00       	call   80100b26 <panic>
+    lruadd(b);
+801009a9:	89 d8                	mov    %ebx,%eax
+801009ab:	e8 4e f8 ff ff       	call   801001fe <lruadd>
+801009b0:	eb d7                	jmp    80100989 <brelse+0x4e>
+
+801009b2 <breadahead>:
+{
+801009b2:	55                   	push   %ebp
+801009b3:	89 e5                	mov    %esp,%ebp
+801009b5:	57                   	push   %edi
+801009b6:	56                   	push   %esi
+801009b7:	53                   	push   %ebx
+801009b8:	83 ec 1c             	sub    $0x1c,%esp
+801009bb:	8b 75 08             	mov    0x8(%ebp),%esi
+801009be:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  bk = bhash(dev, blockno);
+801009c1:	89 fa                	mov    %edi,%edx
+801009c3:	89 f0                	mov    %esi,%eax
+801009c5:	e8 6a f6 ff ff       	call   80100034 <bhash>
+801009ca:	89 c3                	mov    %eax,%ebx
+  acquire(block(bk));
+801009cc:	e8 89 f6 ff ff       	call   8010005a <block>
+801009d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801009d4:	83 ec 0c             	sub    $0xc,%esp
+801009d7:	50                   	push   %eax
+801009d8:	e8 ee 6f 00 00       	call   801079cb <acquire>
+  for(b = bk->head; b; b = b->hnext)
+801009dd:	8b 1b                	mov    (%ebx),%ebx
+801009df:	83 c4 10             	add    $0x10,%esp
+801009e2:	eb 03                	jmp    801009e7 <breadahead+0x35>
+801009e4:	8b 5b 58             	mov    0x58(%ebx),%ebx
+801009e7:	85 db                	test   %ebx,%ebx
+801009e9:	74 0a                	je     801009f5 <breadahead+0x43>
+    if(b->dev == dev && b->blockno == blockno)
+801009eb:	39 73 04             	cmp    %esi,0x4(%ebx)
+801009ee:	75 f4                	jne    801009e4 <breadahead+0x32>
+801009f0:	39 7b 08             	cmp    %edi,0x8(%ebx)
+801009f3:	75 ef                	jne    801009e4 <breadahead+0x32>
+  release(block(bk));
+801009f5:	83 ec 0c             	sub    $0xc,%esp
+801009f8:	ff 75 e4             	push   -0x1c(%ebp)
+801009fb:	e8 30 70 00 00       	call   80107a30 <release>
+  if(b)
+80100a00:	83 c4 10             	add    $0x10,%esp
+80100a03:	85 db                	test   %ebx,%ebx
+80100a05:	74 08                	je     80100a0f <breadahead+0x5d>
+}
+80100a07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100a0a:	5b                   	pop    %ebx
+80100a0b:	5e                   	pop    %esi
+80100a0c:	5f                   	pop    %edi
+80100a0d:	5d                   	pop    %ebp
+80100a0e:	c3                   	ret
+  if((b = bget1(dev, blockno, 1)) == 0)
+80100a0f:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100a14:	89 fa                	mov    %edi,%edx
+80100a16:	89 f0                	mov    %esi,%eax
+80100a18:	e8 03 fb ff ff       	call   80100520 <bget1>
+80100a1d:	89 c3                	mov    %eax,%ebx
+80100a1f:	85 c0                	test   %eax,%eax
+80100a21:	74 e4                	je     80100a07 <breadahead+0x55>
+  if((b->flags & (B_VALID|B_ASYNC)) == 0)
+80100a23:	f6 00 0a             	testb  $0xa,(%eax)
+80100a26:	74 0e                	je     80100a36 <breadahead+0x84>
+  brelse(b);
+80100a28:	83 ec 0c             	sub    $0xc,%esp
+80100a2b:	53                   	push   %ebx
+80100a2c:	e8 0a ff ff ff       	call   8010093b <brelse>
+80100a31:	83 c4 10             	add    $0x10,%esp
+80100a34:	eb d1                	jmp    80100a07 <breadahead+0x55>
+    idereadahead(b);
+80100a36:	83 ec 0c             	sub    $0xc,%esp
+80100a39:	50                   	push   %eax
+80100a3a:	e8 63 a6 00 00       	call   8010b0a2 <idereadahead>
+80100a3f:	83 c4 10             	add    $0x10,%esp
+80100a42:	eb e4                	jmp    80100a28 <breadahead+0x76>
+
+80100a44 <consoleread>:
+#endif
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100a44:	55                   	push   %ebp
+80100a45:	89 e5                	mov    %esp,%ebp
+80100a47:	57                   	push   %edi
+80100a48:	56                   	push   %esi
+80100a49:	53                   	push   %ebx
+80100a4a:	83 ec 28             	sub    $0x28,%esp
+80100a4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+80100a50:	8b 75 0c             	mov    0xc(%ebp),%esi
+80100a53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  uint target;
+  int c;
+
+  iunlock(ip);
+80100a56:	57                   	push   %edi
+80100a57:	e8 1d 24 00 00       	call   80102e79 <iunlock>
+  target = n;
+80100a5c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  acquire(&cons.lock);
+80100a5f:	c7 04 24 00 78 31 80 	movl   $0x80317800,(%esp)
+80100a66:	e8 60 6f 00 00       	call   801079cb <acquire>
+  while(n > 0){
+80100a6b:	83 c4 10             	add    $0x10,%esp
+80100a6e:	85 db                	test   %ebx,%ebx
+80100a70:	0f 8e 91 00 00 00    	jle    80100b07 <consoleread+0xc3>
+    while(input.r == input.w){
+80100a76:	a1 e0 77 31 80       	mov    0x803177e0,%eax
+80100a7b:	3b 05 e4 77 31 80    	cmp    0x803177e4,%eax
+80100a81:	75 47                	jne    80100aca <consoleread+0x86>
+      if(myproc()->killed){
+80100a83:	e8 cf 52 00 00       	call   80105d57 <myproc>
+80100a88:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80100a8c:	75 17                	jne    80100aa5 <consoleread+0x61>
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+80100a8e:	83 ec 08             	sub    $0x8,%esp
+80100a91:	68 00 78 31 80       	push   $0x80317800
+80100a96:	68 e0 77 31 80       	push   $0x803177e0
+80100a9b:	e8 bd 61 00 00       	call   80106c5d <sleep>
+80100aa0:	83 c4 10             	add    $0x10,%esp
+80100aa3:	eb d1                	jmp    80100a76 <consoleread+0x32>
+        release(&cons.lock);
+80100aa5:	83 ec 0c             	sub    $0xc,%esp
+80100aa8:	68 00 78 31 80       	push   $0x80317800
+80100aad:	e8 7e 6f 00 00       	call   80107a30 <release>
+        ilock(ip);
+80100ab2:	89 3c 24             	mov    %edi,(%esp)
+80100ab5:	e8 ea 22 00 00       	call   80102da4 <ilock>
+        return -1;
+80100aba:	83 c4 10             	add    $0x10,%esp
+80100abd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+80100ac2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100ac5:	5b                   	pop    %ebx
+80100ac6:	5e                   	pop    %esi
+80100ac7:	5f                   	pop    %edi
+80100ac8:	5d                   	pop    %ebp
+80100ac9:	c3                   	ret
+    c = input.buf[input.r++ % INPUT_BUF];
+80100aca:	8d 50 01             	lea    0x1(%eax),%edx
+80100acd:	89 15 e0 77 31 80    	mov    %edx,0x803177e0
+80100ad3:	89 c2                	mov    %eax,%edx
+80100ad5:	83 e2 7f             	and    $0x7f,%edx
+80100ad8:	0f b6 92 60 77 31 80 	movzbl -0x7fce88a0(%edx),%edx
+80100adf:	0f be ca             	movsbl %dl,%ecx
+    if(c == C('D')){  // EOF
+80100ae2:	80 fa 04             	cmp    $0x4,%dl
+80100ae5:	74 14                	je     80100afb <consoleread+0xb7>
+    *dst++ = c;
+80100ae7:	8d 46 01             	lea    0x1(%esi),%eax
+80100aea:	88 16                	mov    %dl,(%esi)
+    --n;
+80100aec:	83 eb 01             	sub    $0x1,%ebx
+    if(c == '\n')
+80100aef:	83 f9 0a             	cmp    $0xa,%ecx
+80100af2:	74 13                	je     80100b07 <consoleread+0xc3>
+    *dst++ = c;
+80100af4:	89 c6                	mov    %eax,%esi
+80100af6:	e9 73 ff ff ff       	jmp    80100a6e <consoleread+0x2a>
+      if(n < target){
+80100afb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80100afe:	39 cb                	cmp    %ecx,%ebx
+80100b00:	73 05                	jae    80100b07 <consoleread+0xc3>
+        input.r--;
+80100b02:	a3 e0 77 31 80       	mov    %eax,0x803177e0
+  release(&cons.lock);
+80100b07:	83 ec 0c             	sub    $0xc,%esp
+80100b0a:	68 00 78 31 80       	push   $0x80317800
+80100b0f:	e8 1c 6f 00 00       	call   80107a30 <release>
+  ilock(ip);
+80100b14:	89 3c 24             	mov    %edi,(%esp)
+80100b17:	e8 88 22 00 00       	call   80102da4 <ilock>
+  return target - n;
+80100b1c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100b1f:	29 d8                	sub    %ebx,%eax
+80100b21:	83 c4 10             	add    $0x10,%esp
+80100b24:	eb 9c                	jmp    80100ac2 <consoleread+0x7e>
+
+80100b26 <panic>:
+{
+80100b26:	55                   	push   %ebp
+80100b27:	89 e5                	mov    %esp,%ebp
+80100b29:	53                   	push   %ebx
+80100b2a:	83 ec 34             	sub    $0x34,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100b2d:	fa                   	cli
+  cons.locking = 0;
+80100b2e:	c7 05 34 78 31 80 00 	movl   $0x0,0x80317834
+80100b35:	00 00 00 
+  cprintf("lapicid %d: panic: ", lapicid());
+80100b38:	e8 17 37 00 00       	call   80104254 <lapicid>
+80100b3d:	83 ec 08             	sub    $0x8,%esp
+80100b40:	50                   	push   %eax
+80100b41:	68 1a b1 10 80       	push   $0x8010b11a
+80100b46:	e8 9c 02 00 00       	call   80100de7 <cprintf>
+  cprintf(s);
+80100b4b:	83 c4 04             	add    $0x4,%esp
+80100b4e:	ff 75 08             	push   0x8(%ebp)
+80100b51:	e8 91 02 00 00       	call   80100de7 <cprintf>
+  cprintf("\n");
+80100b56:	c7 04 24 df bf 10 80 	movl   $0x8010bfdf,(%esp)
+80100b5d:	e8 85 02 00 00       	call   80100de7 <cprintf>
+  getcallerpcs(&s, pcs);
+80100b62:	83 c4 08             	add    $0x8,%esp
+80100b65:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80100b68:	50                   	push   %eax
+80100b69:	8d 45 08             	lea    0x8(%ebp),%eax
+80100b6c:	50                   	push   %eax
+80100b6d:	e8 30 6d 00 00       	call   801078a2 <getcallerpcs>
+  for(i=0; i<10; i++)
+80100b72:	83 c4 10             	add    $0x10,%esp
+80100b75:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100b7a:	eb 17                	jmp    80100b93 <panic+0x6d>
+    cprintf(" %p", pcs[i]);
+80100b7c:	83 ec 08             	sub    $0x8,%esp
+80100b7f:	ff 74 9d d0          	push   -0x30(%ebp,%ebx,4)
+80100b83:	68 2e b1 10 80       	push   $0x8010b12e
+80100b88:	e8 5a 02 00 00       	call   80100de7 <cprintf>
+  for(i=0; i<10; i++)
+80100b8d:	83 c3 01             	add    $0x1,%ebx
+80100b90:	83 c4 10             	add    $0x10,%esp
+80100b93:	83 fb 09             	cmp    $0x9,%ebx
+80100b96:	7e e4                	jle    80100b7c <panic+0x56>
+  panicked = 1; // freeze other CPU
+80100b98:	c7 05 38 78 31 80 01 	movl   $0x1,0x80317838
+80100b9f:	00 00 00 
+  for(;;)
+80100ba2:	eb fe                	jmp    80100ba2 <panic+0x7c>
+
+80100ba4 <cgaputc>:
+{
+80100ba4:	55                   	push   %ebp
+80100ba5:	89 e5                	mov    %esp,%ebp
+80100ba7:	57                   	push   %edi
+80100ba8:	56                   	push   %esi
+80100ba9:	53                   	push   %ebx
+80100baa:	83 ec 0c             	sub    $0xc,%esp
+80100bad:	89 c3                	mov    %eax,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100baf:	bf d4 03 00 00       	mov    $0x3d4,%edi
+80100bb4:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100bb9:	89 fa                	mov    %edi,%edx
+80100bbb:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100bbc:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+80100bc1:	89 ca                	mov    %ecx,%edx
+80100bc3:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100bc4:	0f b6 f0             	movzbl %al,%esi
+80100bc7:	c1 e6 08             	shl    $0x8,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100bca:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100bcf:	89 fa                	mov    %edi,%edx
+80100bd1:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100bd2:	89 ca                	mov    %ecx,%edx
+80100bd4:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100bd5:	0f b6 c8             	movzbl %al,%ecx
+80100bd8:	09 f1                	or     %esi,%ecx
+  if(c == '\n')
+80100bda:	83 fb 0a             	cmp    $0xa,%ebx
+80100bdd:	74 60                	je     80100c3f <cgaputc+0x9b>
+  else if(c == BACKSPACE){
+80100bdf:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+80100be5:	74 79                	je     80100c60 <cgaputc+0xbc>
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+80100be7:	0f b6 c3             	movzbl %bl,%eax
+80100bea:	8d 59 01             	lea    0x1(%ecx),%ebx
+80100bed:	80 cc 07             	or     $0x7,%ah
+80100bf0:	66 89 84 09 00 80 0b 	mov    %ax,-0x7ff48000(%ecx,%ecx,1)
+80100bf7:	80 
+  if(pos < 0 || pos > 25*80)
+80100bf8:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+80100bfe:	77 6d                	ja     80100c6d <cgaputc+0xc9>
+  if((pos/80) >= 24){  // Scroll up.
+80100c00:	81 fb 7f 07 00 00    	cmp    $0x77f,%ebx
+80100c06:	7f 72                	jg     80100c7a <cgaputc+0xd6>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100c08:	be d4 03 00 00       	mov    $0x3d4,%esi
+80100c0d:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100c12:	89 f2                	mov    %esi,%edx
+80100c14:	ee                   	out    %al,(%dx)
+  outb(CRTPORT+1, pos>>8);
+80100c15:	0f b6 c7             	movzbl %bh,%eax
+80100c18:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+80100c1d:	89 ca                	mov    %ecx,%edx
+80100c1f:	ee                   	out    %al,(%dx)
+80100c20:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100c25:	89 f2                	mov    %esi,%edx
+80100c27:	ee                   	out    %al,(%dx)
+80100c28:	89 d8                	mov    %ebx,%eax
+80100c2a:	89 ca                	mov    %ecx,%edx
+80100c2c:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+80100c2d:	66 c7 84 1b 00 80 0b 	movw   $0x720,-0x7ff48000(%ebx,%ebx,1)
+80100c34:	80 20 07 
+}
+80100c37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100c3a:	5b                   	pop    %ebx
+80100c3b:	5e                   	pop    %esi
+80100c3c:	5f                   	pop    %edi
+80100c3d:	5d                   	pop    %ebp
+80100c3e:	c3                   	ret
+    pos += 80 - pos%80;
+80100c3f:	ba 67 66 66 66       	mov    $0x66666667,%edx
+80100c44:	89 c8                	mov    %ecx,%eax
+80100c46:	f7 ea                	imul   %edx
+80100c48:	c1 fa 05             	sar    $0x5,%edx
+80100c4b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+80100c4e:	c1 e0 04             	shl    $0x4,%eax
+80100c51:	89 ca                	mov    %ecx,%edx
+80100c53:	29 c2                	sub    %eax,%edx
+80100c55:	bb 50 00 00 00       	mov    $0x50,%ebx
+80100c5a:	29 d3                	sub    %edx,%ebx
+80100c5c:	01 cb                	add    %ecx,%ebx
+80100c5e:	eb 98                	jmp    80100bf8 <cgaputc+0x54>
+    if(pos > 0) --pos;
+80100c60:	85 c9                	test   %ecx,%ecx
+80100c62:	7e 05                	jle    80100c69 <cgaputc+0xc5>
+80100c64:	8d 59 ff             	lea    -0x1(%ecx),%ebx
+80100c67:	eb 8f                	jmp    80100bf8 <cgaputc+0x54>
+  pos |= inb(CRTPORT+1);
+80100c69:	89 cb                	mov    %ecx,%ebx
+80100c6b:	eb 8b                	jmp    80100bf8 <cgaputc+0x54>
+    panic("pos under/overflow");
+80100c6d:	83 ec 0c             	sub    $0xc,%esp
+80100c70:	68 32 b1 10 80       	push   $0x8010b132
+80100c75:	e8 ac fe ff ff       	call   80100b26 <panic>
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100c7a:	83 ec 04             	sub    $0x4,%esp
+80100c7d:	68 60 0e 00 00       	push   $0xe60
+80100c82:	68 a0 80 0b 80       	push   $0x800b80a0
+80100c87:	68 00 80 0b 80       	push   $0x800b8000
+80100c8c:	e8 5e 6e 00 00       	call   80107aef <memmove>
+    pos -= 80;
+80100c91:	83 eb 50             	sub    $0x50,%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100c94:	b8 80 07 00 00       	mov    $0x780,%eax
+80100c99:	29 d8                	sub    %ebx,%eax
+80100c9b:	8d 94 1b 00 80 0b 80 	lea    -0x7ff48000(%ebx,%ebx,1),%edx
+80100ca2:	83 c4 0c             	add    $0xc,%esp
+80100ca5:	01 c0                	add    %eax,%eax
+80100ca7:	50                   	push   %eax
+80100ca8:	6a 00                	push   $0x0
+80100caa:	52                   	push   %edx
+80100cab:	e8 c7 6d 00 00       	call   80107a77 <memset>
+80100cb0:	83 c4 10             	add    $0x10,%esp
+80100cb3:	e9 50 ff ff ff       	jmp    80100c08 <cgaputc+0x64>
+
+80100cb8 <consputc>:
+  if(panicked){
+80100cb8:	83 3d 38 78 31 80 00 	cmpl   $0x0,0x80317838
+80100cbf:	74 03                	je     80100cc4 <consputc+0xc>
+  asm volatile("cli");
+80100cc1:	fa                   	cli
+    for(;;)
+80100cc2:	eb fe                	jmp    80100cc2 <consputc+0xa>
+{
+80100cc4:	55                   	push   %ebp
+80100cc5:	89 e5                	mov    %esp,%ebp
+80100cc7:	53                   	push   %ebx
+80100cc8:	83 ec 04             	sub    $0x4,%esp
+80100ccb:	89 c3                	mov    %eax,%ebx
+  if(c == BACKSPACE){
+80100ccd:	3d 00 01 00 00       	cmp    $0x100,%eax
+80100cd2:	74 18                	je     80100cec <consputc+0x34>
+    uartputc(c);
+80100cd4:	83 ec 0c             	sub    $0xc,%esp
+80100cd7:	50                   	push   %eax
+80100cd8:	e8 7d 84 00 00       	call   8010915a <uartputc>
+80100cdd:	83 c4 10             	add    $0x10,%esp
+  cgaputc(c);
+80100ce0:	89 d8                	mov    %ebx,%eax
+80100ce2:	e8 bd fe ff ff       	call   80100ba4 <cgaputc>
+}
+80100ce7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100cea:	c9                   	leave
+80100ceb:	c3                   	ret
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+80100cec:	83 ec 0c             	sub    $0xc,%esp
+80100cef:	6a 08                	push   $0x8
+80100cf1:	e8 64 84 00 00       	call   8010915a <uartputc>
+80100cf6:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80100cfd:	e8 58 84 00 00       	call   8010915a <uartputc>
+80100d02:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100d09:	e8 4c 84 00 00       	call   8010915a <uartputc>
+80100d0e:	83 c4 10             	add    $0x10,%esp
+80100d11:	eb cd                	jmp    80100ce0 <consputc+0x28>
+
+80100d13 <printint>:
+{
+80100d13:	55                   	push   %ebp
+80100d14:	89 e5                	mov    %esp,%ebp
+80100d16:	57                   	push   %edi
+80100d17:	56                   	push   %esi
+80100d18:	53                   	push   %ebx
+80100d19:	83 ec 2c             	sub    $0x2c,%esp
+80100d1c:	89 c3                	mov    %eax,%ebx
+80100d1e:	89 d6                	mov    %edx,%esi
+80100d20:	89 c8                	mov    %ecx,%eax
+  if(sign && (sign = xx < 0))
+80100d22:	85 c9                	test   %ecx,%ecx
+80100d24:	74 09                	je     80100d2f <printint+0x1c>
+80100d26:	89 d8                	mov    %ebx,%eax
+80100d28:	c1 e8 1f             	shr    $0x1f,%eax
+80100d2b:	85 db                	test   %ebx,%ebx
+80100d2d:	78 3c                	js     80100d6b <printint+0x58>
+    x = xx;
+80100d2f:	89 d9                	mov    %ebx,%ecx
+  i = 0;
+80100d31:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100d36:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    buf[i++] = digits[x % base];
+80100d39:	89 c8                	mov    %ecx,%eax
+80100d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+80100d40:	f7 f6                	div    %esi
+80100d42:	89 df                	mov    %ebx,%edi
+80100d44:	83 c3 01             	add    $0x1,%ebx
+80100d47:	0f b6 92 d0 b1 10 80 	movzbl -0x7fef4e30(%edx),%edx
+80100d4e:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+80100d52:	89 ca                	mov    %ecx,%edx
+80100d54:	89 c1                	mov    %eax,%ecx
+80100d56:	39 f2                	cmp    %esi,%edx
+80100d58:	73 df                	jae    80100d39 <printint+0x26>
+  if(sign)
+80100d5a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100d5d:	85 c0                	test   %eax,%eax
+80100d5f:	74 1a                	je     80100d7b <printint+0x68>
+    buf[i++] = '-';
+80100d61:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+80100d66:	8d 5f 02             	lea    0x2(%edi),%ebx
+80100d69:	eb 10                	jmp    80100d7b <printint+0x68>
+    x = -xx;
+80100d6b:	89 d9                	mov    %ebx,%ecx
+80100d6d:	f7 d9                	neg    %ecx
+80100d6f:	eb c0                	jmp    80100d31 <printint+0x1e>
+    consputc(buf[i]);
+80100d71:	0f be 44 1d d8       	movsbl -0x28(%ebp,%ebx,1),%eax
+80100d76:	e8 3d ff ff ff       	call   80100cb8 <consputc>
+  while(--i >= 0)
+80100d7b:	83 eb 01             	sub    $0x1,%ebx
+80100d7e:	79 f1                	jns    80100d71 <printint+0x5e>
+}
+80100d80:	83 c4 2c             	add    $0x2c,%esp
+80100d83:	5b                   	pop    %ebx
+80100d84:	5e                   	pop    %esi
+80100d85:	5f                   	pop    %edi
+80100d86:	5d                   	pop    %ebp
+80100d87:	c3                   	ret
+
+80100d88 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+80100d88:	55                   	push   %ebp
+80100d89:	89 e5                	mov    %esp,%ebp
+80100d8b:	57                   	push   %edi
+80100d8c:	56                   	push   %esi
+80100d8d:	53                   	push   %ebx
+80100d8e:	83 ec 18             	sub    $0x18,%esp
+80100d91:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80100d94:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+80100d97:	ff 75 08             	push   0x8(%ebp)
+80100d9a:	e8 da 20 00 00       	call   80102e79 <iunlock>
+  acquire(&cons.lock);
+80100d9f:	c7 04 24 00 78 31 80 	movl   $0x80317800,(%esp)
+80100da6:	e8 20 6c 00 00       	call   801079cb <acquire>
+  for(i = 0; i < n; i++)
+80100dab:	83 c4 10             	add    $0x10,%esp
+80100dae:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100db3:	eb 0c                	jmp    80100dc1 <consolewrite+0x39>
+    consputc(buf[i] & 0xff);
+80100db5:	0f b6 04 1f          	movzbl (%edi,%ebx,1),%eax
+80100db9:	e8 fa fe ff ff       	call   80100cb8 <consputc>
+  for(i = 0; i < n; i++)
+80100dbe:	83 c3 01             	add    $0x1,%ebx
+80100dc1:	39 f3                	cmp    %esi,%ebx
+80100dc3:	7c f0                	jl     80100db5 <consolewrite+0x2d>
+  release(&cons.lock);
+80100dc5:	83 ec 0c             	sub    $0xc,%esp
+80100dc8:	68 00 78 31 80       	push   $0x80317800
+80100dcd:	e8 5e 6c 00 00       	call   80107a30 <release>
+  ilock(ip);
+80100dd2:	83 c4 04             	add    $0x4,%esp
+80100dd5:	ff 75 08             	push   0x8(%ebp)
+80100dd8:	e8 c7 1f 00 00       	call   80102da4 <ilock>
+
+  return n;
+}
+80100ddd:	89 f0                	mov    %esi,%eax
+80100ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100de2:	5b                   	pop    %ebx
+80100de3:	5e                   	pop    %esi
+80100de4:	5f                   	pop    %edi
+80100de5:	5d                   	pop    %ebp
+80100de6:	c3                   	ret
+
+80100de7 <cprintf>:
+{
+80100de7:	55                   	push   %ebp
+80100de8:	89 e5                	mov    %esp,%ebp
+80100dea:	57                   	push   %edi
+80100deb:	56                   	push   %esi
+80100dec:	53                   	push   %ebx
+80100ded:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+80100df0:	a1 34 78 31 80       	mov    0x80317834,%eax
+80100df5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(locking)
+80100df8:	85 c0                	test   %eax,%eax
+80100dfa:	75 10                	jne    80100e0c <cprintf+0x25>
+  if (fmt == 0)
+80100dfc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+80100e00:	74 1c                	je     80100e1e <cprintf+0x37>
+  argp = (uint*)(void*)(&fmt + 1);
+80100e02:	8d 7d 0c             	lea    0xc(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100e05:	be 00 00 00 00       	mov    $0x0,%esi
+80100e0a:	eb 27                	jmp    80100e33 <cprintf+0x4c>
+    acquire(&cons.lock);
+80100e0c:	83 ec 0c             	sub    $0xc,%esp
+80100e0f:	68 00 78 31 80       	push   $0x80317800
+80100e14:	e8 b2 6b 00 00       	call   801079cb <acquire>
+80100e19:	83 c4 10             	add    $0x10,%esp
+80100e1c:	eb de                	jmp    80100dfc <cprintf+0x15>
+    panic("null fmt");
+80100e1e:	83 ec 0c             	sub    $0xc,%esp
+80100e21:	68 4c b1 10 80       	push   $0x8010b14c
+80100e26:	e8 fb fc ff ff       	call   80100b26 <panic>
+      consputc(c);
+80100e2b:	e8 88 fe ff ff       	call   80100cb8 <consputc>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100e30:	83 c6 01             	add    $0x1,%esi
+80100e33:	8b 55 08             	mov    0x8(%ebp),%edx
+80100e36:	0f b6 04 32          	movzbl (%edx,%esi,1),%eax
+80100e3a:	85 c0                	test   %eax,%eax
+80100e3c:	0f 84 b1 00 00 00    	je     80100ef3 <cprintf+0x10c>
+    if(c != '%'){
+80100e42:	83 f8 25             	cmp    $0x25,%eax
+80100e45:	75 e4                	jne    80100e2b <cprintf+0x44>
+    c = fmt[++i] & 0xff;
+80100e47:	83 c6 01             	add    $0x1,%esi
+80100e4a:	0f b6 1c 32          	movzbl (%edx,%esi,1),%ebx
+    if(c == 0)
+80100e4e:	85 db                	test   %ebx,%ebx
+80100e50:	0f 84 9d 00 00 00    	je     80100ef3 <cprintf+0x10c>
+    switch(c){
+80100e56:	83 fb 70             	cmp    $0x70,%ebx
+80100e59:	74 2e                	je     80100e89 <cprintf+0xa2>
+80100e5b:	7f 22                	jg     80100e7f <cprintf+0x98>
+80100e5d:	83 fb 25             	cmp    $0x25,%ebx
+80100e60:	74 6c                	je     80100ece <cprintf+0xe7>
+80100e62:	83 fb 64             	cmp    $0x64,%ebx
+80100e65:	75 76                	jne    80100edd <cprintf+0xf6>
+      printint(*argp++, 10, 1);
+80100e67:	8d 5f 04             	lea    0x4(%edi),%ebx
+80100e6a:	8b 07                	mov    (%edi),%eax
+80100e6c:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100e71:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100e76:	e8 98 fe ff ff       	call   80100d13 <printint>
+80100e7b:	89 df                	mov    %ebx,%edi
+      break;
+80100e7d:	eb b1                	jmp    80100e30 <cprintf+0x49>
+    switch(c){
+80100e7f:	83 fb 73             	cmp    $0x73,%ebx
+80100e82:	74 1d                	je     80100ea1 <cprintf+0xba>
+80100e84:	83 fb 78             	cmp    $0x78,%ebx
+80100e87:	75 54                	jne    80100edd <cprintf+0xf6>
+      printint(*argp++, 16, 0);
+80100e89:	8d 5f 04             	lea    0x4(%edi),%ebx
+80100e8c:	8b 07                	mov    (%edi),%eax
+80100e8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+80100e93:	ba 10 00 00 00       	mov    $0x10,%edx
+80100e98:	e8 76 fe ff ff       	call   80100d13 <printint>
+80100e9d:	89 df                	mov    %ebx,%edi
+      break;
+80100e9f:	eb 8f                	jmp    80100e30 <cprintf+0x49>
+      if((s = (char*)*argp++) == 0)
+80100ea1:	8d 47 04             	lea    0x4(%edi),%eax
+80100ea4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100ea7:	8b 1f                	mov    (%edi),%ebx
+80100ea9:	85 db                	test   %ebx,%ebx
+80100eab:	75 12                	jne    80100ebf <cprintf+0xd8>
+        s = "(null)";
+80100ead:	bb 45 b1 10 80       	mov    $0x8010b145,%ebx
+80100eb2:	eb 0b                	jmp    80100ebf <cprintf+0xd8>
+        consputc(*s);
+80100eb4:	0f be c0             	movsbl %al,%eax
+80100eb7:	e8 fc fd ff ff       	call   80100cb8 <consputc>
+      for(; *s; s++)
+80100ebc:	83 c3 01             	add    $0x1,%ebx
+80100ebf:	0f b6 03             	movzbl (%ebx),%eax
+80100ec2:	84 c0                	test   %al,%al
+80100ec4:	75 ee                	jne    80100eb4 <cprintf+0xcd>
+      if((s = (char*)*argp++) == 0)
+80100ec6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80100ec9:	e9 62 ff ff ff       	jmp    80100e30 <cprintf+0x49>
+      consputc('%');
+80100ece:	b8 25 00 00 00       	mov    $0x25,%eax
+80100ed3:	e8 e0 fd ff ff       	call   80100cb8 <consputc>
+      break;
+80100ed8:	e9 53 ff ff ff       	jmp    80100e30 <cprintf+0x49>
+      consputc('%');
+80100edd:	b8 25 00 00 00       	mov    $0x25,%eax
+80100ee2:	e8 d1 fd ff ff       	call   80100cb8 <consputc>
+      consputc(c);
+80100ee7:	89 d8                	mov    %ebx,%eax
+80100ee9:	e8 ca fd ff ff       	call   80100cb8 <consputc>
+      break;
+80100eee:	e9 3d ff ff ff       	jmp    80100e30 <cprintf+0x49>
+  if(locking)
+80100ef3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80100ef7:	75 08                	jne    80100f01 <cprintf+0x11a>
+}
+80100ef9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100efc:	5b                   	pop    %ebx
+80100efd:	5e                   	pop    %esi
+80100efe:	5f                   	pop    %edi
+80100eff:	5d                   	pop    %ebp
+80100f00:	c3                   	ret
+    release(&cons.lock);
+80100f01:	83 ec 0c             	sub    $0xc,%esp
+80100f04:	68 00 78 31 80       	push   $0x80317800
+80100f09:	e8 22 6b 00 00       	call   80107a30 <release>
+80100f0e:	83 c4 10             	add    $0x10,%esp
+}
+80100f11:	eb e6                	jmp    80100ef9 <cprintf+0x112>
+
+80100f13 <do_shutdown>:
+{
+80100f13:	55                   	push   %ebp
+80100f14:	89 e5                	mov    %esp,%ebp
+80100f16:	83 ec 14             	sub    $0x14,%esp
+  cprintf("\nShutting down ...\n");
+80100f19:	68 55 b1 10 80       	push   $0x8010b155
+80100f1e:	e8 c4 fe ff ff       	call   80100de7 <cprintf>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100f23:	b8 00 20 00 00       	mov    $0x2000,%eax
+80100f28:	ba 04 06 00 00       	mov    $0x604,%edx
+80100f2d:	66 ef                	out    %ax,(%dx)
+  return;  // not reached
+80100f2f:	83 c4 10             	add    $0x10,%esp
+}
+80100f32:	c9                   	leave
+80100f33:	c3                   	ret
+
+80100f34 <consoleintr>:
+{
+80100f34:	55                   	push   %ebp
+80100f35:	89 e5                	mov    %esp,%ebp
+80100f37:	57                   	push   %edi
+80100f38:	56                   	push   %esi
+80100f39:	53                   	push   %ebx
+80100f3a:	83 ec 38             	sub    $0x38,%esp
+80100f3d:	8b 75 08             	mov    0x8(%ebp),%esi
+  acquire(&cons.lock);
+80100f40:	68 00 78 31 80       	push   $0x80317800
+80100f45:	e8 81 6a 00 00       	call   801079cb <acquire>
+  while((c = getc()) >= 0){
+80100f4a:	83 c4 10             	add    $0x10,%esp
+  int shutdown = FALSE;
+80100f4d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  int doctrlz = 0;
+80100f54:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  int doctrls = 0;
+80100f5b:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  int doctrlr = 0;
+80100f62:	bf 00 00 00 00       	mov    $0x0,%edi
+  int doctrlf = 0;
+80100f67:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  int c, doprocdump = 0;
+80100f6e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  while((c = getc()) >= 0){
+80100f75:	ff d6                	call   *%esi
+80100f77:	89 c3                	mov    %eax,%ebx
+80100f79:	85 c0                	test   %eax,%eax
+80100f7b:	0f 88 48 01 00 00    	js     801010c9 <consoleintr+0x195>
+    switch(c){
+80100f81:	83 fb 1a             	cmp    $0x1a,%ebx
+80100f84:	7f 1d                	jg     80100fa3 <consoleintr+0x6f>
+80100f86:	83 fb 04             	cmp    $0x4,%ebx
+80100f89:	7c 21                	jl     80100fac <consoleintr+0x78>
+80100f8b:	8d 43 fc             	lea    -0x4(%ebx),%eax
+80100f8e:	83 f8 16             	cmp    $0x16,%eax
+80100f91:	77 19                	ja     80100fac <consoleintr+0x78>
+80100f93:	ff 24 85 74 b1 10 80 	jmp    *-0x7fef4e8c(,%eax,4)
+80100f9a:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+80100fa1:	eb d2                	jmp    80100f75 <consoleintr+0x41>
+80100fa3:	83 fb 7f             	cmp    $0x7f,%ebx
+80100fa6:	0f 84 b1 00 00 00    	je     8010105d <consoleintr+0x129>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100fac:	85 db                	test   %ebx,%ebx
+80100fae:	74 c5                	je     80100f75 <consoleintr+0x41>
+80100fb0:	a1 e8 77 31 80       	mov    0x803177e8,%eax
+80100fb5:	89 c2                	mov    %eax,%edx
+80100fb7:	2b 15 e0 77 31 80    	sub    0x803177e0,%edx
+80100fbd:	83 fa 7f             	cmp    $0x7f,%edx
+80100fc0:	77 b3                	ja     80100f75 <consoleintr+0x41>
+        c = (c == '\r') ? '\n' : c;
+80100fc2:	83 fb 0d             	cmp    $0xd,%ebx
+80100fc5:	0f 84 e8 00 00 00    	je     801010b3 <consoleintr+0x17f>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100fcb:	8d 50 01             	lea    0x1(%eax),%edx
+80100fce:	89 15 e8 77 31 80    	mov    %edx,0x803177e8
+80100fd4:	83 e0 7f             	and    $0x7f,%eax
+80100fd7:	88 98 60 77 31 80    	mov    %bl,-0x7fce88a0(%eax)
+        consputc(c);
+80100fdd:	89 d8                	mov    %ebx,%eax
+80100fdf:	e8 d4 fc ff ff       	call   80100cb8 <consputc>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+80100fe4:	83 fb 0a             	cmp    $0xa,%ebx
+80100fe7:	0f 94 c0             	sete   %al
+80100fea:	83 fb 04             	cmp    $0x4,%ebx
+80100fed:	0f 94 c2             	sete   %dl
+80100ff0:	08 d0                	or     %dl,%al
+80100ff2:	75 14                	jne    80101008 <consoleintr+0xd4>
+80100ff4:	a1 e0 77 31 80       	mov    0x803177e0,%eax
+80100ff9:	83 e8 80             	sub    $0xffffff80,%eax
+80100ffc:	39 05 e8 77 31 80    	cmp    %eax,0x803177e8
+80101002:	0f 85 6d ff ff ff    	jne    80100f75 <consoleintr+0x41>
+          input.w = input.e;
+80101008:	a1 e8 77 31 80       	mov    0x803177e8,%eax
+8010100d:	a3 e4 77 31 80       	mov    %eax,0x803177e4
+          wakeup(&input.r);
+80101012:	83 ec 0c             	sub    $0xc,%esp
+80101015:	68 e0 77 31 80       	push   $0x803177e0
+8010101a:	e8 2a 52 00 00       	call   80106249 <wakeup>
+8010101f:	83 c4 10             	add    $0x10,%esp
+80101022:	e9 4e ff ff ff       	jmp    80100f75 <consoleintr+0x41>
+        input.e--;
+80101027:	a3 e8 77 31 80       	mov    %eax,0x803177e8
+        consputc(BACKSPACE);
+8010102c:	b8 00 01 00 00       	mov    $0x100,%eax
+80101031:	e8 82 fc ff ff       	call   80100cb8 <consputc>
+      while(input.e != input.w &&
+80101036:	a1 e8 77 31 80       	mov    0x803177e8,%eax
+8010103b:	3b 05 e4 77 31 80    	cmp    0x803177e4,%eax
+80101041:	0f 84 2e ff ff ff    	je     80100f75 <consoleintr+0x41>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80101047:	83 e8 01             	sub    $0x1,%eax
+8010104a:	89 c2                	mov    %eax,%edx
+8010104c:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+8010104f:	80 ba 60 77 31 80 0a 	cmpb   $0xa,-0x7fce88a0(%edx)
+80101056:	75 cf                	jne    80101027 <consoleintr+0xf3>
+80101058:	e9 18 ff ff ff       	jmp    80100f75 <consoleintr+0x41>
+      if(input.e != input.w){
+8010105d:	a1 e8 77 31 80       	mov    0x803177e8,%eax
+80101062:	3b 05 e4 77 31 80    	cmp    0x803177e4,%eax
+80101068:	0f 84 07 ff ff ff    	je     80100f75 <consoleintr+0x41>
+        input.e--;
+8010106e:	83 e8 01             	sub    $0x1,%eax
+80101071:	a3 e8 77 31 80       	mov    %eax,0x803177e8
+        consputc(BACKSPACE);
+80101076:	b8 00 01 00 00       	mov    $0x100,%eax
+8010107b:	e8 38 fc ff ff       	call   80100cb8 <consputc>
+80101080:	e9 f0 fe ff ff       	jmp    80100f75 <consoleintr+0x41>
+      doctrlr = 1;
+80101085:	bf 01 00 00 00       	mov    $0x1,%edi
+      break;
+8010108a:	e9 e6 fe ff ff       	jmp    80100f75 <consoleintr+0x41>
+      doctrlf = 1;
+8010108f:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      break;
+80101096:	e9 da fe ff ff       	jmp    80100f75 <consoleintr+0x41>
+      doctrls = 1;
+8010109b:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+      break;
+801010a2:	e9 ce fe ff ff       	jmp    80100f75 <consoleintr+0x41>
+      doctrlz = 1;
+801010a7:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+      break;
+801010ae:	e9 c2 fe ff ff       	jmp    80100f75 <consoleintr+0x41>
+        c = (c == '\r') ? '\n' : c;
+801010b3:	bb 0a 00 00 00       	mov    $0xa,%ebx
+801010b8:	e9 0e ff ff ff       	jmp    80100fcb <consoleintr+0x97>
+      shutdown = TRUE;
+801010bd:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+801010c4:	e9 ac fe ff ff       	jmp    80100f75 <consoleintr+0x41>
+  release(&cons.lock);
+801010c9:	83 ec 0c             	sub    $0xc,%esp
+801010cc:	68 00 78 31 80       	push   $0x80317800
+801010d1:	e8 5a 69 00 00       	call   80107a30 <release>
+  if (shutdown)
+801010d6:	83 c4 10             	add    $0x10,%esp
+801010d9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+801010dd:	75 24                	jne    80101103 <consoleintr+0x1cf>
+  if(doprocdump) {
+801010df:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+801010e3:	75 25                	jne    8010110a <consoleintr+0x1d6>
+  if(doctrlr) {
+801010e5:	85 ff                	test   %edi,%edi
+801010e7:	75 28                	jne    80101111 <consoleintr+0x1dd>
+  if(doctrlf) {
+801010e9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801010ed:	75 29                	jne    80101118 <consoleintr+0x1e4>
+  if(doctrls) {
+801010ef:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+801010f3:	75 2a                	jne    8010111f <consoleintr+0x1eb>
+  if(doctrlz) {
+801010f5:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+801010f9:	75 2b                	jne    80101126 <consoleintr+0x1f2>
+}
+801010fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801010fe:	5b                   	pop    %ebx
+801010ff:	5e                   	pop    %esi
+80101100:	5f                   	pop    %edi
+80101101:	5d                   	pop    %ebp
+80101102:	c3                   	ret
+    do_shutdown();
+80101103:	e8 0b fe ff ff       	call   80100f13 <do_shutdown>
+80101108:	eb d5                	jmp    801010df <consoleintr+0x1ab>
+    procdump();  // now call procdump() wo. cons.lock held
+8010110a:	e8 d0 65 00 00       	call   801076df <procdump>
+8010110f:	eb d4                	jmp    801010e5 <consoleintr+0x1b1>
+    ctrlr();  
+80101111:	e8 56 63 00 00       	call   8010746c <ctrlr>
+80101116:	eb d1                	jmp    801010e9 <consoleintr+0x1b5>
+    ctrlf();  
+80101118:	e8 3a 64 00 00       	call   80107557 <ctrlf>
+8010111d:	eb d0                	jmp    801010ef <consoleintr+0x1bb>
+    ctrls(); 
+8010111f:	e8 8a 64 00 00       	call   801075ae <ctrls>
+80101124:	eb cf                	jmp    801010f5 <consoleintr+0x1c1>
+    ctrlz();  
+80101126:	e8 1f 65 00 00       	call   8010764a <ctrlz>
+}
+8010112b:	eb ce                	jmp    801010fb <consoleintr+0x1c7>
+
+8010112d <consoleinit>:
+
+void
+consoleinit(void)
+{
+8010112d:	55                   	push   %ebp
+8010112e:	89 e5                	mov    %esp,%ebp
+80101130:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80101133:	68 69 b1 10 80       	push   $0x8010b169
+80101138:	68 00 78 31 80       	push   $0x80317800
+8010113d:	e8 45 67 00 00       	call   80107887 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80101142:	c7 05 2c 88 31 80 88 	movl   $0x80100d88,0x8031882c
+80101149:	0d 10 80 
+  devsw[CONSOLE].read = consoleread;
+8010114c:	c7 05 28 88 31 80 44 	movl   $0x80100a44,0x80318828
+80101153:	0a 10 80 
+  cons.locking = 1;
+80101156:	c7 05 34 78 31 80 01 	movl   $0x1,0x80317834
+8010115d:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80101160:	83 c4 08             	add    $0x8,%esp
+80101163:	6a 00                	push   $0x0
+80101165:	6a 01                	push   $0x1
+80101167:	e8 86 29 00 00       	call   80103af2 <ioapicenable>
+}
+8010116c:	83 c4 10             	add    $0x10,%esp
+8010116f:	c9                   	leave
+80101170:	c3                   	ret
+
+80101171 <exec>:
+#include "elf.h"
+
+
+int
+exec(char *path, char **argv)
+{
+80101171:	55                   	push   %ebp
+80101172:	89 e5                	mov    %esp,%ebp
+80101174:	57                   	push   %edi
+80101175:	56                   	push   %esi
+80101176:	53                   	push   %ebx
+80101177:	81 ec 4c 01 00 00    	sub    $0x14c,%esp
+  struct inode *ip, *exe, *oldexe;
+  struct seg seg[NSEG];
+  int nseg;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+8010117d:	e8 d5 4b 00 00       	call   80105d57 <myproc>
+80101182:	89 85 b8 fe ff ff    	mov    %eax,-0x148(%ebp)
+
+  begin_op();
+80101188:	e8 6a 35 00 00       	call   801046f7 <begin_op>
+
+  if((ip = namei(path)) == 0){
+8010118d:	83 ec 0c             	sub    $0xc,%esp
+80101190:	ff 75 08             	push   0x8(%ebp)
+80101193:	e8 84 28 00 00       	call   80103a1c <namei>
+80101198:	89 85 c4 fe ff ff    	mov    %eax,-0x13c(%ebp)
+8010119e:	83 c4 10             	add    $0x10,%esp
+801011a1:	85 c0                	test   %eax,%eax
+801011a3:	74 47                	je     801011ec <exec+0x7b>
+#ifndef PDX_XV6
+    cprintf("exec: fail\n");
+#endif
+    return -1;
+  }
+  ilock(ip);
+801011a5:	83 ec 0c             	sub    $0xc,%esp
+801011a8:	8b 9d c4 fe ff ff    	mov    -0x13c(%ebp),%ebx
+801011ae:	53                   	push   %ebx
+801011af:	e8 f0 1b 00 00       	call   80102da4 <ilock>
+  pgdir = 0;
+  exe = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+801011b4:	6a 34                	push   $0x34
+801011b6:	6a 00                	push   $0x0
+801011b8:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+801011be:	50                   	push   %eax
+801011bf:	53                   	push   %ebx
+801011c0:	e8 a3 1e 00 00       	call   80103068 <readi>
+801011c5:	83 c4 20             	add    $0x20,%esp
+801011c8:	83 f8 34             	cmp    $0x34,%eax
+801011cb:	0f 85 a2 03 00 00    	jne    80101573 <exec+0x402>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+801011d1:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+801011d8:	45 4c 46 
+801011db:	74 1e                	je     801011fb <exec+0x8a>
+  pgdir = 0;
+801011dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  exe = 0;
+801011e2:	be 00 00 00 00       	mov    $0x0,%esi
+801011e7:	e9 91 03 00 00       	jmp    8010157d <exec+0x40c>
+    end_op();
+801011ec:	e8 80 35 00 00       	call   80104771 <end_op>
+    return -1;
+801011f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801011f6:	e9 d0 03 00 00       	jmp    801015cb <exec+0x45a>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+801011fb:	e8 df 99 00 00       	call   8010abdf <setupkvm>
+80101200:	89 c7                	mov    %eax,%edi
+80101202:	85 c0                	test   %eax,%eax
+80101204:	0f 84 c9 03 00 00    	je     801015d3 <exec+0x462>
+  // Record the program's segments. Their pages are only
+  // read in when first touched (see pagefault in vm.c);
+  // segments beyond the first NSEG are loaded now.
+  sz = 0;
+  nseg = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010120a:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  nseg = 0;
+80101210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  sz = 0;
+80101215:	c7 85 bc fe ff ff 00 	movl   $0x0,-0x144(%ebp)
+8010121c:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010121f:	be 00 00 00 00       	mov    $0x0,%esi
+80101224:	8b 9d c4 fe ff ff    	mov    -0x13c(%ebp),%ebx
+8010122a:	89 bd b4 fe ff ff    	mov    %edi,-0x14c(%ebp)
+80101230:	89 cf                	mov    %ecx,%edi
+80101232:	eb 63                	jmp    80101297 <exec+0x126>
+      seg[nseg].vaddr = ph.vaddr;
+      seg[nseg].filesz = ph.filesz;
+      seg[nseg].off = ph.off;
+      nseg++;
+    } else {
+      if(allocuvm(pgdir, ph.vaddr, ph.vaddr + ph.memsz) == 0)
+80101234:	83 ec 04             	sub    $0x4,%esp
+80101237:	50                   	push   %eax
+80101238:	52                   	push   %edx
+80101239:	ff b5 b4 fe ff ff    	push   -0x14c(%ebp)
+8010123f:	e8 46 98 00 00       	call   8010aa8a <allocuvm>
+80101244:	83 c4 10             	add    $0x10,%esp
+80101247:	85 c0                	test   %eax,%eax
+80101249:	0f 84 d2 03 00 00    	je     80101621 <exec+0x4b0>
+        goto bad;
+      if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+8010124f:	83 ec 0c             	sub    $0xc,%esp
+80101252:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+80101258:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+8010125e:	53                   	push   %ebx
+8010125f:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+80101265:	ff b5 b4 fe ff ff    	push   -0x14c(%ebp)
+8010126b:	e8 ed 96 00 00       	call   8010a95d <loaduvm>
+80101270:	83 c4 20             	add    $0x20,%esp
+80101273:	85 c0                	test   %eax,%eax
+80101275:	0f 89 b9 00 00 00    	jns    80101334 <exec+0x1c3>
+  exe = 0;
+8010127b:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+80101281:	be 00 00 00 00       	mov    $0x0,%esi
+80101286:	e9 f2 02 00 00       	jmp    8010157d <exec+0x40c>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010128b:	83 c6 01             	add    $0x1,%esi
+8010128e:	8b 85 c0 fe ff ff    	mov    -0x140(%ebp),%eax
+80101294:	83 c0 20             	add    $0x20,%eax
+80101297:	0f b7 95 50 ff ff ff 	movzwl -0xb0(%ebp),%edx
+8010129e:	39 f2                	cmp    %esi,%edx
+801012a0:	0f 8e b1 00 00 00    	jle    80101357 <exec+0x1e6>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+801012a6:	89 85 c0 fe ff ff    	mov    %eax,-0x140(%ebp)
+801012ac:	6a 20                	push   $0x20
+801012ae:	50                   	push   %eax
+801012af:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+801012b5:	50                   	push   %eax
+801012b6:	53                   	push   %ebx
+801012b7:	e8 ac 1d 00 00       	call   80103068 <readi>
+801012bc:	83 c4 10             	add    $0x10,%esp
+801012bf:	83 f8 20             	cmp    $0x20,%eax
+801012c2:	0f 85 0f 03 00 00    	jne    801015d7 <exec+0x466>
+    if(ph.type != ELF_PROG_LOAD)
+801012c8:	83 bd d4 fe ff ff 01 	cmpl   $0x1,-0x12c(%ebp)
+801012cf:	75 ba                	jne    8010128b <exec+0x11a>
+    if(ph.memsz < ph.filesz)
+801012d1:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+801012d7:	8b 8d e4 fe ff ff    	mov    -0x11c(%ebp),%ecx
+801012dd:	39 c8                	cmp    %ecx,%eax
+801012df:	0f 82 ff 02 00 00    	jb     801015e4 <exec+0x473>
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+801012e5:	8b 95 dc fe ff ff    	mov    -0x124(%ebp),%edx
+801012eb:	01 d0                	add    %edx,%eax
+801012ed:	0f 82 fe 02 00 00    	jb     801015f1 <exec+0x480>
+    if(ph.vaddr + ph.memsz >= KERNBASE)
+801012f3:	85 c0                	test   %eax,%eax
+801012f5:	0f 88 06 03 00 00    	js     80101601 <exec+0x490>
+    if(ph.vaddr % PGSIZE != 0)
+801012fb:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+80101301:	0f 85 0a 03 00 00    	jne    80101611 <exec+0x4a0>
+    if(nseg < NSEG){
+80101307:	83 ff 03             	cmp    $0x3,%edi
+8010130a:	0f 8f 24 ff ff ff    	jg     80101234 <exec+0xc3>
+      seg[nseg].vaddr = ph.vaddr;
+80101310:	8d 04 7f             	lea    (%edi,%edi,2),%eax
+80101313:	c1 e0 02             	shl    $0x2,%eax
+80101316:	89 94 05 f4 fe ff ff 	mov    %edx,-0x10c(%ebp,%eax,1)
+      seg[nseg].filesz = ph.filesz;
+8010131d:	89 8c 05 f8 fe ff ff 	mov    %ecx,-0x108(%ebp,%eax,1)
+      seg[nseg].off = ph.off;
+80101324:	8b 95 d8 fe ff ff    	mov    -0x128(%ebp),%edx
+8010132a:	89 94 05 fc fe ff ff 	mov    %edx,-0x104(%ebp,%eax,1)
+      nseg++;
+80101331:	83 c7 01             	add    $0x1,%edi
+        goto bad;
+    }
+    if(ph.vaddr + ph.memsz > sz)
+80101334:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+8010133a:	03 85 dc fe ff ff    	add    -0x124(%ebp),%eax
+80101340:	39 85 bc fe ff ff    	cmp    %eax,-0x144(%ebp)
+80101346:	0f 83 3f ff ff ff    	jae    8010128b <exec+0x11a>
+      sz = ph.vaddr + ph.memsz;
+8010134c:	89 85 bc fe ff ff    	mov    %eax,-0x144(%ebp)
+80101352:	e9 34 ff ff ff       	jmp    8010128b <exec+0x11a>
+  }
+  // Hold on to ip for the pages still to be read in.
+  iunlock(ip);
+80101357:	89 bd b0 fe ff ff    	mov    %edi,-0x150(%ebp)
+8010135d:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+80101363:	83 ec 0c             	sub    $0xc,%esp
+80101366:	ff b5 c4 fe ff ff    	push   -0x13c(%ebp)
+8010136c:	e8 08 1b 00 00       	call   80102e79 <iunlock>
+  end_op();
+80101371:	e8 fb 33 00 00       	call   80104771 <end_op>
+  exe = ip;
+  ip = 0;
+
+  // Allocate two pages at the next page boundary.
+  // Make the first inaccessible.  Use the second as the user stack.
+  sz = PGROUNDUP(sz);
+80101376:	8b 85 bc fe ff ff    	mov    -0x144(%ebp),%eax
+8010137c:	05 ff 0f 00 00       	add    $0xfff,%eax
+80101381:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80101386:	83 c4 0c             	add    $0xc,%esp
+80101389:	8d 90 00 20 00 00    	lea    0x2000(%eax),%edx
+8010138f:	52                   	push   %edx
+80101390:	50                   	push   %eax
+80101391:	57                   	push   %edi
+80101392:	e8 f3 96 00 00       	call   8010aa8a <allocuvm>
+80101397:	89 c3                	mov    %eax,%ebx
+80101399:	89 85 bc fe ff ff    	mov    %eax,-0x144(%ebp)
+8010139f:	83 c4 10             	add    $0x10,%esp
+801013a2:	85 c0                	test   %eax,%eax
+801013a4:	75 15                	jne    801013bb <exec+0x24a>
+  exe = ip;
+801013a6:	8b b5 c4 fe ff ff    	mov    -0x13c(%ebp),%esi
+  ip = 0;
+801013ac:	c7 85 c4 fe ff ff 00 	movl   $0x0,-0x13c(%ebp)
+801013b3:	00 00 00 
+801013b6:	e9 c2 01 00 00       	jmp    8010157d <exec+0x40c>
+    goto bad;
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+801013bb:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+801013c1:	83 ec 08             	sub    $0x8,%esp
+801013c4:	50                   	push   %eax
+801013c5:	57                   	push   %edi
+801013c6:	e8 99 98 00 00       	call   8010ac64 <clearpteu>
+  sp = sz;
+
+  // Push argument strings, prepare rest of stack in ustack.
+  for(argc = 0; argv[argc]; argc++) {
+801013cb:	83 c4 10             	add    $0x10,%esp
+801013ce:	be 00 00 00 00       	mov    $0x0,%esi
+801013d3:	89 bd c0 fe ff ff    	mov    %edi,-0x140(%ebp)
+801013d9:	eb 0a                	jmp    801013e5 <exec+0x274>
+    if(argc >= MAXARG)
+      goto bad;
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+      goto bad;
+    ustack[3+argc] = sp;
+801013db:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+  for(argc = 0; argv[argc]; argc++) {
+801013e2:	83 c6 01             	add    $0x1,%esi
+801013e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+801013e8:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+801013eb:	8b 07                	mov    (%edi),%eax
+801013ed:	85 c0                	test   %eax,%eax
+801013ef:	74 58                	je     80101449 <exec+0x2d8>
+    if(argc >= MAXARG)
+801013f1:	83 fe 1f             	cmp    $0x1f,%esi
+801013f4:	0f 87 37 02 00 00    	ja     80101631 <exec+0x4c0>
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+801013fa:	83 ec 0c             	sub    $0xc,%esp
+801013fd:	50                   	push   %eax
+801013fe:	e8 1d 68 00 00       	call   80107c20 <strlen>
+80101403:	29 c3                	sub    %eax,%ebx
+80101405:	83 eb 01             	sub    $0x1,%ebx
+80101408:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+8010140b:	83 c4 04             	add    $0x4,%esp
+8010140e:	ff 37                	push   (%edi)
+80101410:	e8 0b 68 00 00       	call   80107c20 <strlen>
+80101415:	83 c0 01             	add    $0x1,%eax
+80101418:	50                   	push   %eax
+80101419:	ff 37                	push   (%edi)
+8010141b:	53                   	push   %ebx
+8010141c:	ff b5 c0 fe ff ff    	push   -0x140(%ebp)
+80101422:	e8 cf 9a 00 00       	call   8010aef6 <copyout>
+80101427:	83 c4 20             	add    $0x20,%esp
+8010142a:	85 c0                	test   %eax,%eax
+8010142c:	79 ad                	jns    801013db <exec+0x26a>
+  exe = ip;
+8010142e:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+80101434:	8b b5 c4 fe ff ff    	mov    -0x13c(%ebp),%esi
+  ip = 0;
+8010143a:	c7 85 c4 fe ff ff 00 	movl   $0x0,-0x13c(%ebp)
+80101441:	00 00 00 
+80101444:	e9 34 01 00 00       	jmp    8010157d <exec+0x40c>
+  }
+  ustack[3+argc] = 0;
+80101449:	89 85 b4 fe ff ff    	mov    %eax,-0x14c(%ebp)
+8010144f:	89 d9                	mov    %ebx,%ecx
+80101451:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+80101457:	c7 84 b5 64 ff ff ff 	movl   $0x0,-0x9c(%ebp,%esi,4)
+8010145e:	00 00 00 00 
+
+  ustack[0] = 0xffffffff;  // fake return PC
+80101462:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80101469:	ff ff ff 
+  ustack[1] = argc;
+8010146c:	89 b5 5c ff ff ff    	mov    %esi,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80101472:	8d 14 b5 04 00 00 00 	lea    0x4(,%esi,4),%edx
+80101479:	89 d8                	mov    %ebx,%eax
+8010147b:	29 d0                	sub    %edx,%eax
+8010147d:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+
+  sp -= (3+argc+1) * 4;
+80101483:	8d 04 b5 10 00 00 00 	lea    0x10(,%esi,4),%eax
+8010148a:	29 c1                	sub    %eax,%ecx
+8010148c:	89 8d c0 fe ff ff    	mov    %ecx,-0x140(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80101492:	50                   	push   %eax
+80101493:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+80101499:	50                   	push   %eax
+8010149a:	51                   	push   %ecx
+8010149b:	57                   	push   %edi
+8010149c:	e8 55 9a 00 00       	call   8010aef6 <copyout>
+801014a1:	83 c4 10             	add    $0x10,%esp
+801014a4:	85 c0                	test   %eax,%eax
+801014a6:	0f 88 a0 01 00 00    	js     8010164c <exec+0x4db>
+    goto bad;
+
+  // Save program name for debugging.
+  for(last=s=path; *s; s++)
+801014ac:	8b 55 08             	mov    0x8(%ebp),%edx
+801014af:	89 d0                	mov    %edx,%eax
+801014b1:	eb 03                	jmp    801014b6 <exec+0x345>
+801014b3:	83 c0 01             	add    $0x1,%eax
+801014b6:	0f b6 08             	movzbl (%eax),%ecx
+801014b9:	84 c9                	test   %cl,%cl
+801014bb:	74 0a                	je     801014c7 <exec+0x356>
+    if(*s == '/')
+801014bd:	80 f9 2f             	cmp    $0x2f,%cl
+801014c0:	75 f1                	jne    801014b3 <exec+0x342>
+      last = s+1;
+801014c2:	8d 50 01             	lea    0x1(%eax),%edx
+801014c5:	eb ec                	jmp    801014b3 <exec+0x342>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+801014c7:	8b 9d b8 fe ff ff    	mov    -0x148(%ebp),%ebx
+801014cd:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+801014d3:	83 ec 04             	sub    $0x4,%esp
+801014d6:	6a 10                	push   $0x10
+801014d8:	52                   	push   %edx
+801014d9:	50                   	push   %eax
+801014da:	e8 04 67 00 00       	call   80107be3 <safestrcpy>
+
+  // Commit to the user image.
+  oldpgdir = curproc->pgdir;
+801014df:	89 d9                	mov    %ebx,%ecx
+801014e1:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  oldexe = curproc->exe;
+801014e4:	8b 71 7c             	mov    0x7c(%ecx),%esi
+  curproc->pgdir = pgdir;
+801014e7:	89 79 04             	mov    %edi,0x4(%ecx)
+  curproc->sz = sz;
+801014ea:	8b 85 bc fe ff ff    	mov    -0x144(%ebp),%eax
+801014f0:	89 01                	mov    %eax,(%ecx)
+  curproc->exe = exe;
+801014f2:	89 cf                	mov    %ecx,%edi
+801014f4:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+801014fa:	89 41 7c             	mov    %eax,0x7c(%ecx)
+  curproc->nseg = nseg;
+801014fd:	8b 85 b0 fe ff ff    	mov    -0x150(%ebp),%eax
+80101503:	89 81 b0 00 00 00    	mov    %eax,0xb0(%ecx)
+  memmove(curproc->seg, seg, sizeof(seg));
+80101509:	8d 81 80 00 00 00    	lea    0x80(%ecx),%eax
+8010150f:	83 c4 0c             	add    $0xc,%esp
+80101512:	6a 30                	push   $0x30
+80101514:	8d 95 f4 fe ff ff    	lea    -0x10c(%ebp),%edx
+8010151a:	52                   	push   %edx
+8010151b:	50                   	push   %eax
+8010151c:	e8 ce 65 00 00       	call   80107aef <memmove>
+  curproc->tf->eip = elf.entry;  // main
+80101521:	89 f9                	mov    %edi,%ecx
+80101523:	8b 47 20             	mov    0x20(%edi),%eax
+80101526:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+8010152c:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+8010152f:	8b 47 20             	mov    0x20(%edi),%eax
+80101532:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+80101538:	89 78 44             	mov    %edi,0x44(%eax)
+  switchuvm(curproc);
+8010153b:	89 0c 24             	mov    %ecx,(%esp)
+8010153e:	e8 51 92 00 00       	call   8010a794 <switchuvm>
+  freevm(oldpgdir);
+80101543:	89 1c 24             	mov    %ebx,(%esp)
+80101546:	e8 24 96 00 00       	call   8010ab6f <freevm>
+  if(oldexe){
+8010154b:	83 c4 10             	add    $0x10,%esp
+8010154e:	85 f6                	test   %esi,%esi
+80101550:	0f 84 0d 01 00 00    	je     80101663 <exec+0x4f2>
+    begin_op();
+80101556:	e8 9c 31 00 00       	call   801046f7 <begin_op>
+    iput(oldexe);
+8010155b:	83 ec 0c             	sub    $0xc,%esp
+8010155e:	56                   	push   %esi
+8010155f:	e8 5a 19 00 00       	call   80102ebe <iput>
+    end_op();
+80101564:	e8 08 32 00 00       	call   80104771 <end_op>
+80101569:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+8010156c:	b8 00 00 00 00       	mov    $0x0,%eax
+80101571:	eb 58                	jmp    801015cb <exec+0x45a>
+  pgdir = 0;
+80101573:	bf 00 00 00 00       	mov    $0x0,%edi
+  exe = 0;
+80101578:	be 00 00 00 00       	mov    $0x0,%esi
+
+bad:
+  if(pgdir)
+8010157d:	85 ff                	test   %edi,%edi
+8010157f:	74 0c                	je     8010158d <exec+0x41c>
+    freevm(pgdir);
+80101581:	83 ec 0c             	sub    $0xc,%esp
+80101584:	57                   	push   %edi
+80101585:	e8 e5 95 00 00       	call   8010ab6f <freevm>
+8010158a:	83 c4 10             	add    $0x10,%esp
+  if(ip){
+8010158d:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+80101593:	85 c0                	test   %eax,%eax
+80101595:	74 11                	je     801015a8 <exec+0x437>
+    iunlockput(ip);
+80101597:	83 ec 0c             	sub    $0xc,%esp
+8010159a:	50                   	push   %eax
+8010159b:	e8 fb 19 00 00       	call   80102f9b <iunlockput>
+    end_op();
+801015a0:	e8 cc 31 00 00       	call   80104771 <end_op>
+801015a5:	83 c4 10             	add    $0x10,%esp
+  }
+  if(exe){
+801015a8:	85 f6                	test   %esi,%esi
+801015aa:	0f 84 bd 00 00 00    	je     8010166d <exec+0x4fc>
+    begin_op();
+801015b0:	e8 42 31 00 00       	call   801046f7 <begin_op>
+    iput(exe);
+801015b5:	83 ec 0c             	sub    $0xc,%esp
+801015b8:	56                   	push   %esi
+801015b9:	e8 00 19 00 00       	call   80102ebe <iput>
+    end_op();
+801015be:	e8 ae 31 00 00       	call   80104771 <end_op>
+801015c3:	83 c4 10             	add    $0x10,%esp
+  }
+  return -1;
+801015c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801015cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801015ce:	5b                   	pop    %ebx
+801015cf:	5e                   	pop    %esi
+801015d0:	5f                   	pop    %edi
+801015d1:	5d                   	pop    %ebp
+801015d2:	c3                   	ret
+  exe = 0;
+801015d3:	89 c6                	mov    %eax,%esi
+801015d5:	eb a6                	jmp    8010157d <exec+0x40c>
+801015d7:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+801015dd:	be 00 00 00 00       	mov    $0x0,%esi
+801015e2:	eb 99                	jmp    8010157d <exec+0x40c>
+801015e4:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+801015ea:	be 00 00 00 00       	mov    $0x0,%esi
+801015ef:	eb 8c                	jmp    8010157d <exec+0x40c>
+801015f1:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+801015f7:	be 00 00 00 00       	mov    $0x0,%esi
+801015fc:	e9 7c ff ff ff       	jmp    8010157d <exec+0x40c>
+80101601:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+80101607:	be 00 00 00 00       	mov    $0x0,%esi
+8010160c:	e9 6c ff ff ff       	jmp    8010157d <exec+0x40c>
+80101611:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+80101617:	be 00 00 00 00       	mov    $0x0,%esi
+8010161c:	e9 5c ff ff ff       	jmp    8010157d <exec+0x40c>
+80101621:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+80101627:	be 00 00 00 00       	mov    $0x0,%esi
+8010162c:	e9 4c ff ff ff       	jmp    8010157d <exec+0x40c>
+  exe = ip;
+80101631:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+80101637:	8b b5 c4 fe ff ff    	mov    -0x13c(%ebp),%esi
+  ip = 0;
+8010163d:	c7 85 c4 fe ff ff 00 	movl   $0x0,-0x13c(%ebp)
+80101644:	00 00 00 
+80101647:	e9 31 ff ff ff       	jmp    8010157d <exec+0x40c>
+  exe = ip;
+8010164c:	8b b5 c4 fe ff ff    	mov    -0x13c(%ebp),%esi
+  ip = 0;
+80101652:	8b 85 b4 fe ff ff    	mov    -0x14c(%ebp),%eax
+80101658:	89 85 c4 fe ff ff    	mov    %eax,-0x13c(%ebp)
+8010165e:	e9 1a ff ff ff       	jmp    8010157d <exec+0x40c>
+  return 0;
+80101663:	b8 00 00 00 00       	mov    $0x0,%eax
+80101668:	e9 5e ff ff ff       	jmp    801015cb <exec+0x45a>
+  return -1;
+8010166d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101672:	e9 54 ff ff ff       	jmp    801015cb <exec+0x45a>
+
+80101677 <fileadd>:
+
+// Put the n files at f on the free list.
+static void
+fileadd(struct file *f, int n)
+{
+  for(; n > 0; n--, f++){
+80101677:	eb 14                	jmp    8010168d <fileadd+0x16>
+    f->fnext = ftable.free;
+80101679:	8b 0d 74 78 31 80    	mov    0x80317874,%ecx
+8010167f:	89 48 08             	mov    %ecx,0x8(%eax)
+    ftable.free = f;
+80101682:	a3 74 78 31 80       	mov    %eax,0x80317874
+  for(; n > 0; n--, f++){
+80101687:	83 ea 01             	sub    $0x1,%edx
+8010168a:	83 c0 28             	add    $0x28,%eax
+8010168d:	85 d2                	test   %edx,%edx
+8010168f:	7f e8                	jg     80101679 <fileadd+0x2>
+  }
+}
+80101691:	c3                   	ret
+
+80101692 <fileinit>:
+
+void
+fileinit(void)
+{
+80101692:	55                   	push   %ebp
+80101693:	89 e5                	mov    %esp,%ebp
+80101695:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80101698:	68 e1 b1 10 80       	push   $0x8010b1e1
+8010169d:	68 40 78 31 80       	push   $0x80317840
+801016a2:	e8 e0 61 00 00       	call   80107887 <initlock>
+  fileadd(ftable.file, NFILE);
+801016a7:	ba 64 00 00 00       	mov    $0x64,%edx
+801016ac:	b8 78 78 31 80       	mov    $0x80317878,%eax
+801016b1:	e8 c1 ff ff ff       	call   80101677 <fileadd>
+}
+801016b6:	83 c4 10             	add    $0x10,%esp
+801016b9:	c9                   	leave
+801016ba:	c3                   	ret
+
+801016bb <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+801016bb:	55                   	push   %ebp
+801016bc:	89 e5                	mov    %esp,%ebp
+801016be:	53                   	push   %ebx
+801016bf:	83 ec 10             	sub    $0x10,%esp
+  struct file *f;
+
+  acquire(&ftable.lock);
+801016c2:	68 40 78 31 80       	push   $0x80317840
+801016c7:	e8 ff 62 00 00       	call   801079cb <acquire>
+  if(ftable.free == 0 && (f = (struct file*)kalloc()) != 0){
+801016cc:	83 c4 10             	add    $0x10,%esp
+801016cf:	83 3d 74 78 31 80 00 	cmpl   $0x0,0x80317874
+801016d6:	74 2d                	je     80101705 <filealloc+0x4a>
+    memset(f, 0, PGSIZE);
+    fileadd(f, PGSIZE / sizeof(*f));
+  }
+  if((f = ftable.free) != 0){
+801016d8:	8b 1d 74 78 31 80    	mov    0x80317874,%ebx
+801016de:	85 db                	test   %ebx,%ebx
+801016e0:	74 0f                	je     801016f1 <filealloc+0x36>
+    ftable.free = f->fnext;
+801016e2:	8b 43 08             	mov    0x8(%ebx),%eax
+801016e5:	a3 74 78 31 80       	mov    %eax,0x80317874
+    f->ref = 1;
+801016ea:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+  }
+  release(&ftable.lock);
+801016f1:	83 ec 0c             	sub    $0xc,%esp
+801016f4:	68 40 78 31 80       	push   $0x80317840
+801016f9:	e8 32 63 00 00       	call   80107a30 <release>
+  return f;
+}
+801016fe:	89 d8                	mov    %ebx,%eax
+80101700:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101703:	c9                   	leave
+80101704:	c3                   	ret
+  if(ftable.free == 0 && (f = (struct file*)kalloc()) != 0){
+80101705:	e8 86 28 00 00       	call   80103f90 <kalloc>
+8010170a:	89 c3                	mov    %eax,%ebx
+8010170c:	85 c0                	test   %eax,%eax
+8010170e:	74 c8                	je     801016d8 <filealloc+0x1d>
+    memset(f, 0, PGSIZE);
+80101710:	83 ec 04             	sub    $0x4,%esp
+80101713:	68 00 10 00 00       	push   $0x1000
+80101718:	6a 00                	push   $0x0
+8010171a:	50                   	push   %eax
+8010171b:	e8 57 63 00 00       	call   80107a77 <memset>
+    fileadd(f, PGSIZE / sizeof(*f));
+80101720:	ba 66 00 00 00       	mov    $0x66,%edx
+80101725:	89 d8                	mov    %ebx,%eax
+80101727:	e8 4b ff ff ff       	call   80101677 <fileadd>
+8010172c:	83 c4 10             	add    $0x10,%esp
+8010172f:	eb a7                	jmp    801016d8 <filealloc+0x1d>
+
+80101731 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80101731:	55                   	push   %ebp
+80101732:	89 e5                	mov    %esp,%ebp
+80101734:	53                   	push   %ebx
+80101735:	83 ec 10             	sub    $0x10,%esp
+80101738:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+8010173b:	68 40 78 31 80       	push   $0x80317840
+80101740:	e8 86 62 00 00       	call   801079cb <acquire>
+  if(f->ref < 1)
+80101745:	8b 43 04             	mov    0x4(%ebx),%eax
+80101748:	83 c4 10             	add    $0x10,%esp
+8010174b:	85 c0                	test   %eax,%eax
+8010174d:	7e 1a                	jle    80101769 <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+8010174f:	83 c0 01             	add    $0x1,%eax
+80101752:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80101755:	83 ec 0c             	sub    $0xc,%esp
+80101758:	68 40 78 31 80       	push   $0x80317840
+8010175d:	e8 ce 62 00 00       	call   80107a30 <release>
+  return f;
+}
+80101762:	89 d8                	mov    %ebx,%eax
+80101764:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101767:	c9                   	leave
+80101768:	c3                   	ret
+    panic("filedup");
+80101769:	83 ec 0c             	sub    $0xc,%esp
+8010176c:	68 e8 b1 10 80       	push   $0x8010b1e8
+80101771:	e8 b0 f3 ff ff       	call   80100b26 <panic>
+
+80101776 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80101776:	55                   	push   %ebp
+80101777:	89 e5                	mov    %esp,%ebp
+80101779:	53                   	push   %ebx
+8010177a:	83 ec 40             	sub    $0x40,%esp
+8010177d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+80101780:	68 40 78 31 80       	push   $0x80317840
+80101785:	e8 41 62 00 00       	call   801079cb <acquire>
+  if(f->ref < 1)
+8010178a:	8b 43 04             	mov    0x4(%ebx),%eax
+8010178d:	83 c4 10             	add    $0x10,%esp
+80101790:	85 c0                	test   %eax,%eax
+80101792:	0f 8e 9b 00 00 00    	jle    80101833 <fileclose+0xbd>
+    panic("fileclose");
+  if(--f->ref > 0){
+80101798:	83 e8 01             	sub    $0x1,%eax
+8010179b:	89 43 04             	mov    %eax,0x4(%ebx)
+8010179e:	85 c0                	test   %eax,%eax
+801017a0:	0f 8f 9a 00 00 00    	jg     80101840 <fileclose+0xca>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+801017a6:	8b 03                	mov    (%ebx),%eax
+801017a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+801017ab:	8b 43 04             	mov    0x4(%ebx),%eax
+801017ae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801017b1:	8b 43 08             	mov    0x8(%ebx),%eax
+801017b4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801017b7:	8b 43 0c             	mov    0xc(%ebx),%eax
+801017ba:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801017bd:	8b 43 10             	mov    0x10(%ebx),%eax
+801017c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801017c3:	8b 43 14             	mov    0x14(%ebx),%eax
+801017c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801017c9:	8b 43 18             	mov    0x18(%ebx),%eax
+801017cc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+801017cf:	8b 43 1c             	mov    0x1c(%ebx),%eax
+801017d2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+801017d5:	8b 43 20             	mov    0x20(%ebx),%eax
+801017d8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+801017db:	8b 43 24             	mov    0x24(%ebx),%eax
+801017de:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  f->ref = 0;
+801017e1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  f->type = FD_NONE;
+801017e8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  f->fnext = ftable.free;
+801017ee:	a1 74 78 31 80       	mov    0x80317874,%eax
+801017f3:	89 43 08             	mov    %eax,0x8(%ebx)
+  ftable.free = f;
+801017f6:	89 1d 74 78 31 80    	mov    %ebx,0x80317874
+  release(&ftable.lock);
+801017fc:	83 ec 0c             	sub    $0xc,%esp
+801017ff:	68 40 78 31 80       	push   $0x80317840
+80101804:	e8 27 62 00 00       	call   80107a30 <release>
+
+  if(ff.type == FD_PIPE)
+80101809:	8b 45 d0             	mov    -0x30(%ebp),%eax
+8010180c:	83 c4 10             	add    $0x10,%esp
+8010180f:	83 f8 01             	cmp    $0x1,%eax
+80101812:	74 41                	je     80101855 <fileclose+0xdf>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+80101814:	83 f8 02             	cmp    $0x2,%eax
+80101817:	75 37                	jne    80101850 <fileclose+0xda>
+    begin_op();
+80101819:	e8 d9 2e 00 00       	call   801046f7 <begin_op>
+    iput(ff.ip);
+8010181e:	83 ec 0c             	sub    $0xc,%esp
+80101821:	ff 75 e4             	push   -0x1c(%ebp)
+80101824:	e8 95 16 00 00       	call   80102ebe <iput>
+    end_op();
+80101829:	e8 43 2f 00 00       	call   80104771 <end_op>
+8010182e:	83 c4 10             	add    $0x10,%esp
+80101831:	eb 1d                	jmp    80101850 <fileclose+0xda>
+    panic("fileclose");
+80101833:	83 ec 0c             	sub    $0xc,%esp
+80101836:	68 f0 b1 10 80       	push   $0x8010b1f0
+8010183b:	e8 e6 f2 ff ff       	call   80100b26 <panic>
+    release(&ftable.lock);
+80101840:	83 ec 0c             	sub    $0xc,%esp
+80101843:	68 40 78 31 80       	push   $0x80317840
+80101848:	e8 e3 61 00 00       	call   80107a30 <release>
+    return;
+8010184d:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80101850:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101853:	c9                   	leave
+80101854:	c3                   	ret
+    pipeclose(ff.pipe, ff.writable);
+80101855:	83 ec 08             	sub    $0x8,%esp
+80101858:	0f be 45 dd          	movsbl -0x23(%ebp),%eax
+8010185c:	50                   	push   %eax
+8010185d:	ff 75 e0             	push   -0x20(%ebp)
+80101860:	e8 cf 37 00 00       	call   80105034 <pipeclose>
+80101865:	83 c4 10             	add    $0x10,%esp
+80101868:	eb e6                	jmp    80101850 <fileclose+0xda>
+
+8010186a <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+8010186a:	55                   	push   %ebp
+8010186b:	89 e5                	mov    %esp,%ebp
+8010186d:	53                   	push   %ebx
+8010186e:	83 ec 04             	sub    $0x4,%esp
+80101871:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+80101874:	83 3b 02             	cmpl   $0x2,(%ebx)
+80101877:	75 31                	jne    801018aa <filestat+0x40>
+    ilock(f->ip);
+80101879:	83 ec 0c             	sub    $0xc,%esp
+8010187c:	ff 73 14             	push   0x14(%ebx)
+8010187f:	e8 20 15 00 00       	call   80102da4 <ilock>
+    stati(f->ip, st);
+80101884:	83 c4 08             	add    $0x8,%esp
+80101887:	ff 75 0c             	push   0xc(%ebp)
+8010188a:	ff 73 14             	push   0x14(%ebx)
+8010188d:	e8 29 17 00 00       	call   80102fbb <stati>
+    iunlock(f->ip);
+80101892:	83 c4 04             	add    $0x4,%esp
+80101895:	ff 73 14             	push   0x14(%ebx)
+80101898:	e8 dc 15 00 00       	call   80102e79 <iunlock>
+    return 0;
+8010189d:	83 c4 10             	add    $0x10,%esp
+801018a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  return -1;
+}
+801018a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801018a8:	c9                   	leave
+801018a9:	c3                   	ret
+  return -1;
+801018aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801018af:	eb f4                	jmp    801018a5 <filestat+0x3b>
+
+801018b1 <fileread>:
+#define RAMAX NREADAHEAD
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+801018b1:	55                   	push   %ebp
+801018b2:	89 e5                	mov    %esp,%ebp
+801018b4:	57                   	push   %edi
+801018b5:	56                   	push   %esi
+801018b6:	53                   	push   %ebx
+801018b7:	83 ec 0c             	sub    $0xc,%esp
+801018ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  uint start, end;
+
+  if(f->readable == 0)
+801018bd:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+801018c1:	0f 84 e7 00 00 00    	je     801019ae <fileread+0xfd>
+    return -1;
+  if(f->type == FD_PIPE)
+801018c7:	8b 03                	mov    (%ebx),%eax
+801018c9:	83 f8 01             	cmp    $0x1,%eax
+801018cc:	0f 84 8c 00 00 00    	je     8010195e <fileread+0xad>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801018d2:	83 f8 02             	cmp    $0x2,%eax
+801018d5:	0f 85 c6 00 00 00    	jne    801019a1 <fileread+0xf0>
+    ilock(f->ip);
+801018db:	83 ec 0c             	sub    $0xc,%esp
+801018de:	ff 73 14             	push   0x14(%ebx)
+801018e1:	e8 be 14 00 00       	call   80102da4 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0){
+801018e6:	ff 75 10             	push   0x10(%ebp)
+801018e9:	ff 73 18             	push   0x18(%ebx)
+801018ec:	ff 75 0c             	push   0xc(%ebp)
+801018ef:	ff 73 14             	push   0x14(%ebx)
+801018f2:	e8 71 17 00 00       	call   80103068 <readi>
+801018f7:	89 c6                	mov    %eax,%esi
+801018f9:	83 c4 20             	add    $0x20,%esp
+801018fc:	85 c0                	test   %eax,%eax
+801018fe:	7e 46                	jle    80101946 <fileread+0x95>
+      // Reads that carry on where the last one stopped get a
+      // read-ahead window that doubles each time.
+      if(f->off == f->ranext)
+80101900:	8b 43 18             	mov    0x18(%ebx),%eax
+80101903:	3b 43 1c             	cmp    0x1c(%ebx),%eax
+80101906:	74 6e                	je     80101976 <fileread+0xc5>
+        f->rawin = f->rawin ? f->rawin*2 : RAMIN;
+      else
+        f->rawin = f->raend = 0;
+80101908:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+8010190f:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+      if(f->rawin > RAMAX)
+80101916:	83 7b 24 20          	cmpl   $0x20,0x24(%ebx)
+8010191a:	7e 07                	jle    80101923 <fileread+0x72>
+        f->rawin = RAMAX;
+8010191c:	c7 43 24 20 00 00 00 	movl   $0x20,0x24(%ebx)
+      f->off += r;
+80101923:	01 f0                	add    %esi,%eax
+80101925:	89 43 18             	mov    %eax,0x18(%ebx)
+      f->ranext = f->off;
+80101928:	89 43 1c             	mov    %eax,0x1c(%ebx)
+      if(f->rawin){
+8010192b:	8b 7b 24             	mov    0x24(%ebx),%edi
+8010192e:	85 ff                	test   %edi,%edi
+80101930:	74 14                	je     80101946 <fileread+0x95>
+        end = f->off + f->rawin*BSIZE;
+80101932:	c1 e7 0c             	shl    $0xc,%edi
+80101935:	01 c7                	add    %eax,%edi
+        start = f->raend > f->off ? f->raend : f->off;
+80101937:	8b 53 20             	mov    0x20(%ebx),%edx
+8010193a:	39 d0                	cmp    %edx,%eax
+8010193c:	0f 42 c2             	cmovb  %edx,%eax
+        if(start < end)
+8010193f:	39 f8                	cmp    %edi,%eax
+80101941:	72 48                	jb     8010198b <fileread+0xda>
+          readahead(f->ip, start, end - start);
+        f->raend = end;
+80101943:	89 7b 20             	mov    %edi,0x20(%ebx)
+      }
+    }
+    iunlock(f->ip);
+80101946:	83 ec 0c             	sub    $0xc,%esp
+80101949:	ff 73 14             	push   0x14(%ebx)
+8010194c:	e8 28 15 00 00       	call   80102e79 <iunlock>
+    return r;
+80101951:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+80101954:	89 f0                	mov    %esi,%eax
+80101956:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101959:	5b                   	pop    %ebx
+8010195a:	5e                   	pop    %esi
+8010195b:	5f                   	pop    %edi
+8010195c:	5d                   	pop    %ebp
+8010195d:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+8010195e:	83 ec 04             	sub    $0x4,%esp
+80101961:	ff 75 10             	push   0x10(%ebp)
+80101964:	ff 75 0c             	push   0xc(%ebp)
+80101967:	ff 73 10             	push   0x10(%ebx)
+8010196a:	e8 00 38 00 00       	call   8010516f <piperead>
+8010196f:	89 c6                	mov    %eax,%esi
+80101971:	83 c4 10             	add    $0x10,%esp
+80101974:	eb de                	jmp    80101954 <fileread+0xa3>
+        f->rawin = f->rawin ? f->rawin*2 : RAMIN;
+80101976:	8b 53 24             	mov    0x24(%ebx),%edx
+80101979:	85 d2                	test   %edx,%edx
+8010197b:	74 07                	je     80101984 <fileread+0xd3>
+8010197d:	01 d2                	add    %edx,%edx
+8010197f:	89 53 24             	mov    %edx,0x24(%ebx)
+80101982:	eb 92                	jmp    80101916 <fileread+0x65>
+80101984:	ba 04 00 00 00       	mov    $0x4,%edx
+80101989:	eb f4                	jmp    8010197f <fileread+0xce>
+          readahead(f->ip, start, end - start);
+8010198b:	83 ec 04             	sub    $0x4,%esp
+8010198e:	89 fa                	mov    %edi,%edx
+80101990:	29 c2                	sub    %eax,%edx
+80101992:	52                   	push   %edx
+80101993:	50                   	push   %eax
+80101994:	ff 73 14             	push   0x14(%ebx)
+80101997:	e8 4a 16 00 00       	call   80102fe6 <readahead>
+8010199c:	83 c4 10             	add    $0x10,%esp
+8010199f:	eb a2                	jmp    80101943 <fileread+0x92>
+  panic("fileread");
+801019a1:	83 ec 0c             	sub    $0xc,%esp
+801019a4:	68 fa b1 10 80       	push   $0x8010b1fa
+801019a9:	e8 78 f1 ff ff       	call   80100b26 <panic>
+    return -1;
+801019ae:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801019b3:	eb 9f                	jmp    80101954 <fileread+0xa3>
+
+801019b5 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+801019b5:	55                   	push   %ebp
+801019b6:	89 e5                	mov    %esp,%ebp
+801019b8:	57                   	push   %edi
+801019b9:	56                   	push   %esi
+801019ba:	53                   	push   %ebx
+801019bb:	83 ec 1c             	sub    $0x1c,%esp
+801019be:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+
+  if(f->writable == 0)
+801019c1:	80 7e 0d 00          	cmpb   $0x0,0xd(%esi)
+801019c5:	0f 84 cc 00 00 00    	je     80101a97 <filewrite+0xe2>
+    return -1;
+  if(f->type == FD_PIPE)
+801019cb:	8b 06                	mov    (%esi),%eax
+801019cd:	83 f8 01             	cmp    $0x1,%eax
+801019d0:	74 10                	je     801019e2 <filewrite+0x2d>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801019d2:	83 f8 02             	cmp    $0x2,%eax
+801019d5:	0f 85 af 00 00 00    	jne    80101a8a <filewrite+0xd5>
+    // i-node, indirect block, allocation blocks,
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
+    int i = 0;
+801019db:	bf 00 00 00 00       	mov    $0x0,%edi
+801019e0:	eb 67                	jmp    80101a49 <filewrite+0x94>
+    return pipewrite(f->pipe, addr, n);
+801019e2:	83 ec 04             	sub    $0x4,%esp
+801019e5:	ff 75 10             	push   0x10(%ebp)
+801019e8:	ff 75 0c             	push   0xc(%ebp)
+801019eb:	ff 76 10             	push   0x10(%esi)
+801019ee:	e8 d4 36 00 00       	call   801050c7 <pipewrite>
+801019f3:	83 c4 10             	add    $0x10,%esp
+801019f6:	e9 82 00 00 00       	jmp    80101a7d <filewrite+0xc8>
+    while(i < n){
+      int n1 = n - i;
+      if(n1 > max)
+        n1 = max;
+
+      begin_op();
+801019fb:	e8 f7 2c 00 00       	call   801046f7 <begin_op>
+      ilock(f->ip);
+80101a00:	83 ec 0c             	sub    $0xc,%esp
+80101a03:	ff 76 14             	push   0x14(%esi)
+80101a06:	e8 99 13 00 00       	call   80102da4 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+80101a0b:	ff 75 e4             	push   -0x1c(%ebp)
+80101a0e:	ff 76 18             	push   0x18(%esi)
+80101a11:	89 f8                	mov    %edi,%eax
+80101a13:	03 45 0c             	add    0xc(%ebp),%eax
+80101a16:	50                   	push   %eax
+80101a17:	ff 76 14             	push   0x14(%esi)
+80101a1a:	e8 ae 19 00 00       	call   801033cd <writei>
+80101a1f:	89 c3                	mov    %eax,%ebx
+80101a21:	83 c4 20             	add    $0x20,%esp
+80101a24:	85 c0                	test   %eax,%eax
+80101a26:	7e 03                	jle    80101a2b <filewrite+0x76>
+        f->off += r;
+80101a28:	01 46 18             	add    %eax,0x18(%esi)
+      iunlock(f->ip);
+80101a2b:	83 ec 0c             	sub    $0xc,%esp
+80101a2e:	ff 76 14             	push   0x14(%esi)
+80101a31:	e8 43 14 00 00       	call   80102e79 <iunlock>
+      end_op();
+80101a36:	e8 36 2d 00 00       	call   80104771 <end_op>
+
+      if(r < 0)
+80101a3b:	83 c4 10             	add    $0x10,%esp
+80101a3e:	85 db                	test   %ebx,%ebx
+80101a40:	78 31                	js     80101a73 <filewrite+0xbe>
+        break;
+      if(r != n1)
+80101a42:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+80101a45:	75 1f                	jne    80101a66 <filewrite+0xb1>
+        panic("short filewrite");
+      i += r;
+80101a47:	01 df                	add    %ebx,%edi
+    while(i < n){
+80101a49:	3b 7d 10             	cmp    0x10(%ebp),%edi
+80101a4c:	7d 25                	jge    80101a73 <filewrite+0xbe>
+      int n1 = n - i;
+80101a4e:	8b 45 10             	mov    0x10(%ebp),%eax
+80101a51:	29 f8                	sub    %edi,%eax
+80101a53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(n1 > max)
+80101a56:	3d 00 30 00 00       	cmp    $0x3000,%eax
+80101a5b:	7e 9e                	jle    801019fb <filewrite+0x46>
+        n1 = max;
+80101a5d:	c7 45 e4 00 30 00 00 	movl   $0x3000,-0x1c(%ebp)
+80101a64:	eb 95                	jmp    801019fb <filewrite+0x46>
+        panic("short filewrite");
+80101a66:	83 ec 0c             	sub    $0xc,%esp
+80101a69:	68 03 b2 10 80       	push   $0x8010b203
+80101a6e:	e8 b3 f0 ff ff       	call   80100b26 <panic>
+    }
+    return i == n ? n : -1;
+80101a73:	3b 7d 10             	cmp    0x10(%ebp),%edi
+80101a76:	74 0d                	je     80101a85 <filewrite+0xd0>
+80101a78:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  panic("filewrite");
+}
+80101a7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a80:	5b                   	pop    %ebx
+80101a81:	5e                   	pop    %esi
+80101a82:	5f                   	pop    %edi
+80101a83:	5d                   	pop    %ebp
+80101a84:	c3                   	ret
+    return i == n ? n : -1;
+80101a85:	8b 45 10             	mov    0x10(%ebp),%eax
+80101a88:	eb f3                	jmp    80101a7d <filewrite+0xc8>
+  panic("filewrite");
+80101a8a:	83 ec 0c             	sub    $0xc,%esp
+80101a8d:	68 09 b2 10 80       	push   $0x8010b209
+80101a92:	e8 8f f0 ff ff       	call   80100b26 <panic>
+    return -1;
+80101a97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101a9c:	eb df                	jmp    80101a7d <filewrite+0xc8>
+
+80101a9e <filesplice>:
+// through user space. One end must be a pipe; the other may be
+// a pipe or an inode. Like fileread, returns once some bytes
+// have moved: the number moved, 0 at end of file, or -1.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+80101a9e:	55                   	push   %ebp
+80101a9f:	89 e5                	mov    %esp,%ebp
+80101aa1:	57                   	push   %edi
+80101aa2:	56                   	push   %esi
+80101aa3:	53                   	push   %ebx
+80101aa4:	83 ec 1c             	sub    $0x1c,%esp
+80101aa7:	8b 75 08             	mov    0x8(%ebp),%esi
+80101aaa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int r, eof;
+  struct inode *ip;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+80101aad:	80 7e 0c 00          	cmpb   $0x0,0xc(%esi)
+80101ab1:	0f 84 90 01 00 00    	je     80101c47 <filesplice+0x1a9>
+80101ab7:	80 7f 0d 00          	cmpb   $0x0,0xd(%edi)
+80101abb:	0f 84 8d 01 00 00    	je     80101c4e <filesplice+0x1b0>
+80101ac1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80101ac5:	0f 88 8a 01 00 00    	js     80101c55 <filesplice+0x1b7>
+    return -1;
+  if(n == 0)
+80101acb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80101acf:	0f 84 87 01 00 00    	je     80101c5c <filesplice+0x1be>
+    return 0;
+
+  if(in->type == FD_INODE && out->type == FD_PIPE){
+80101ad5:	8b 06                	mov    (%esi),%eax
+80101ad7:	83 f8 02             	cmp    $0x2,%eax
+80101ada:	74 78                	je     80101b54 <filesplice+0xb6>
+      if(r != 0 || eof)
+        return r;
+    }
+  }
+
+  if(in->type == FD_PIPE && out->type == FD_INODE){
+80101adc:	83 f8 01             	cmp    $0x1,%eax
+80101adf:	0f 84 e6 00 00 00    	je     80101bcb <filesplice+0x12d>
+      if(r != 0)
+        return r;
+    }
+  }
+
+  if(in->type == FD_PIPE && out->type == FD_PIPE && in->pipe != out->pipe){
+80101ae5:	83 f8 01             	cmp    $0x1,%eax
+80101ae8:	0f 85 82 01 00 00    	jne    80101c70 <filesplice+0x1d2>
+80101aee:	83 3f 01             	cmpl   $0x1,(%edi)
+80101af1:	0f 85 80 01 00 00    	jne    80101c77 <filesplice+0x1d9>
+80101af7:	8b 47 10             	mov    0x10(%edi),%eax
+80101afa:	39 46 10             	cmp    %eax,0x10(%esi)
+80101afd:	0f 84 7b 01 00 00    	je     80101c7e <filesplice+0x1e0>
+    for(;;){
+      if((r = pipewait(in->pipe, 0)) <= 0)
+80101b03:	83 ec 08             	sub    $0x8,%esp
+80101b06:	6a 00                	push   $0x0
+80101b08:	ff 76 10             	push   0x10(%esi)
+80101b0b:	e8 e1 36 00 00       	call   801051f1 <pipewait>
+80101b10:	89 c3                	mov    %eax,%ebx
+80101b12:	83 c4 10             	add    $0x10,%esp
+80101b15:	85 c0                	test   %eax,%eax
+80101b17:	0f 8e 42 01 00 00    	jle    80101c5f <filesplice+0x1c1>
+        return r;
+      if(pipewait(out->pipe, 1) < 0)
+80101b1d:	83 ec 08             	sub    $0x8,%esp
+80101b20:	6a 01                	push   $0x1
+80101b22:	ff 77 10             	push   0x10(%edi)
+80101b25:	e8 c7 36 00 00       	call   801051f1 <pipewait>
+80101b2a:	83 c4 10             	add    $0x10,%esp
+80101b2d:	85 c0                	test   %eax,%eax
+80101b2f:	0f 88 50 01 00 00    	js     80101c85 <filesplice+0x1e7>
+        return -1;
+      if((r = pipemove(in->pipe, out->pipe, n)) != 0)
+80101b35:	83 ec 04             	sub    $0x4,%esp
+80101b38:	ff 75 10             	push   0x10(%ebp)
+80101b3b:	ff 77 10             	push   0x10(%edi)
+80101b3e:	ff 76 10             	push   0x10(%esi)
+80101b41:	e8 e9 37 00 00       	call   8010532f <pipemove>
+80101b46:	89 c3                	mov    %eax,%ebx
+80101b48:	83 c4 10             	add    $0x10,%esp
+80101b4b:	85 c0                	test   %eax,%eax
+80101b4d:	74 b4                	je     80101b03 <filesplice+0x65>
+80101b4f:	e9 0b 01 00 00       	jmp    80101c5f <filesplice+0x1c1>
+  if(in->type == FD_INODE && out->type == FD_PIPE){
+80101b54:	83 3f 01             	cmpl   $0x1,(%edi)
+80101b57:	75 83                	jne    80101adc <filesplice+0x3e>
+    ip = in->ip;
+80101b59:	8b 46 14             	mov    0x14(%esi),%eax
+80101b5c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101b5f:	eb 29                	jmp    80101b8a <filesplice+0xec>
+      eof = in->off >= ip->size;
+80101b61:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101b64:	8b 42 64             	mov    0x64(%edx),%eax
+80101b67:	39 46 18             	cmp    %eax,0x18(%esi)
+80101b6a:	0f 93 c0             	setae  %al
+80101b6d:	0f b6 c0             	movzbl %al,%eax
+80101b70:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(ip);
+80101b73:	83 ec 0c             	sub    $0xc,%esp
+80101b76:	52                   	push   %edx
+80101b77:	e8 fd 12 00 00       	call   80102e79 <iunlock>
+      if(r != 0 || eof)
+80101b7c:	83 c4 10             	add    $0x10,%esp
+80101b7f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101b82:	09 d8                	or     %ebx,%eax
+80101b84:	0f 85 d5 00 00 00    	jne    80101c5f <filesplice+0x1c1>
+      if(pipewait(out->pipe, 1) < 0)
+80101b8a:	83 ec 08             	sub    $0x8,%esp
+80101b8d:	6a 01                	push   $0x1
+80101b8f:	ff 77 10             	push   0x10(%edi)
+80101b92:	e8 5a 36 00 00       	call   801051f1 <pipewait>
+80101b97:	83 c4 10             	add    $0x10,%esp
+80101b9a:	85 c0                	test   %eax,%eax
+80101b9c:	0f 88 c7 00 00 00    	js     80101c69 <filesplice+0x1cb>
+      ilock(ip);
+80101ba2:	83 ec 0c             	sub    $0xc,%esp
+80101ba5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101ba8:	53                   	push   %ebx
+80101ba9:	e8 f6 11 00 00       	call   80102da4 <ilock>
+      if((r = readipipe(ip, out->pipe, in->off, n)) > 0)
+80101bae:	ff 75 10             	push   0x10(%ebp)
+80101bb1:	ff 76 18             	push   0x18(%esi)
+80101bb4:	ff 77 10             	push   0x10(%edi)
+80101bb7:	53                   	push   %ebx
+80101bb8:	e8 cf 15 00 00       	call   8010318c <readipipe>
+80101bbd:	89 c3                	mov    %eax,%ebx
+80101bbf:	83 c4 20             	add    $0x20,%esp
+80101bc2:	85 c0                	test   %eax,%eax
+80101bc4:	7e 9b                	jle    80101b61 <filesplice+0xc3>
+        in->off += r;
+80101bc6:	01 46 18             	add    %eax,0x18(%esi)
+80101bc9:	eb 96                	jmp    80101b61 <filesplice+0xc3>
+  if(in->type == FD_PIPE && out->type == FD_INODE){
+80101bcb:	83 3f 02             	cmpl   $0x2,(%edi)
+80101bce:	0f 85 11 ff ff ff    	jne    80101ae5 <filesplice+0x47>
+    if(n > ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE)
+80101bd4:	81 7d 10 00 30 00 00 	cmpl   $0x3000,0x10(%ebp)
+80101bdb:	7e 07                	jle    80101be4 <filesplice+0x146>
+      n = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
+80101bdd:	c7 45 10 00 30 00 00 	movl   $0x3000,0x10(%ebp)
+    ip = out->ip;
+80101be4:	8b 47 14             	mov    0x14(%edi),%eax
+80101be7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101bea:	eb 17                	jmp    80101c03 <filesplice+0x165>
+      iunlock(ip);
+80101bec:	83 ec 0c             	sub    $0xc,%esp
+80101bef:	ff 75 e4             	push   -0x1c(%ebp)
+80101bf2:	e8 82 12 00 00       	call   80102e79 <iunlock>
+      end_op();
+80101bf7:	e8 75 2b 00 00       	call   80104771 <end_op>
+      if(r != 0)
+80101bfc:	83 c4 10             	add    $0x10,%esp
+80101bff:	85 db                	test   %ebx,%ebx
+80101c01:	75 5c                	jne    80101c5f <filesplice+0x1c1>
+      if((r = pipewait(in->pipe, 0)) <= 0)
+80101c03:	83 ec 08             	sub    $0x8,%esp
+80101c06:	6a 00                	push   $0x0
+80101c08:	ff 76 10             	push   0x10(%esi)
+80101c0b:	e8 e1 35 00 00       	call   801051f1 <pipewait>
+80101c10:	89 c3                	mov    %eax,%ebx
+80101c12:	83 c4 10             	add    $0x10,%esp
+80101c15:	85 c0                	test   %eax,%eax
+80101c17:	7e 46                	jle    80101c5f <filesplice+0x1c1>
+      begin_op();
+80101c19:	e8 d9 2a 00 00       	call   801046f7 <begin_op>
+      ilock(ip);
+80101c1e:	83 ec 0c             	sub    $0xc,%esp
+80101c21:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101c24:	53                   	push   %ebx
+80101c25:	e8 7a 11 00 00       	call   80102da4 <ilock>
+      if((r = writeipipe(ip, in->pipe, out->off, n)) > 0)
+80101c2a:	ff 75 10             	push   0x10(%ebp)
+80101c2d:	ff 77 18             	push   0x18(%edi)
+80101c30:	ff 76 10             	push   0x10(%esi)
+80101c33:	53                   	push   %ebx
+80101c34:	e8 6a 16 00 00       	call   801032a3 <writeipipe>
+80101c39:	89 c3                	mov    %eax,%ebx
+80101c3b:	83 c4 20             	add    $0x20,%esp
+80101c3e:	85 c0                	test   %eax,%eax
+80101c40:	7e aa                	jle    80101bec <filesplice+0x14e>
+        out->off += r;
+80101c42:	01 47 18             	add    %eax,0x18(%edi)
+80101c45:	eb a5                	jmp    80101bec <filesplice+0x14e>
+    return -1;
+80101c47:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101c4c:	eb 11                	jmp    80101c5f <filesplice+0x1c1>
+80101c4e:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101c53:	eb 0a                	jmp    80101c5f <filesplice+0x1c1>
+80101c55:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101c5a:	eb 03                	jmp    80101c5f <filesplice+0x1c1>
+    return 0;
+80101c5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+        return r;
+    }
+  }
+
+  return -1;
+}
+80101c5f:	89 d8                	mov    %ebx,%eax
+80101c61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c64:	5b                   	pop    %ebx
+80101c65:	5e                   	pop    %esi
+80101c66:	5f                   	pop    %edi
+80101c67:	5d                   	pop    %ebp
+80101c68:	c3                   	ret
+        return -1;
+80101c69:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101c6e:	eb ef                	jmp    80101c5f <filesplice+0x1c1>
+  return -1;
+80101c70:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101c75:	eb e8                	jmp    80101c5f <filesplice+0x1c1>
+80101c77:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101c7c:	eb e1                	jmp    80101c5f <filesplice+0x1c1>
+80101c7e:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101c83:	eb da                	jmp    80101c5f <filesplice+0x1c1>
+        return -1;
+80101c85:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101c8a:	eb d3                	jmp    80101c5f <filesplice+0x1c1>
+
+80101c8c <ihash>:
+} icache;
+
+static struct ibucket*
+ihash(uint dev, uint inum)
+{
+  return &icache.bucket[(dev ^ inum) % NIBUCKET];
+80101c8c:	31 d0                	xor    %edx,%eax
+80101c8e:	89 c1                	mov    %eax,%ecx
+80101c90:	ba 85 10 42 08       	mov    $0x8421085,%edx
+80101c95:	f7 e2                	mul    %edx
+80101c97:	89 c8                	mov    %ecx,%eax
+80101c99:	29 d0                	sub    %edx,%eax
+80101c9b:	d1 e8                	shr    %eax
+80101c9d:	01 c2                	add    %eax,%edx
+80101c9f:	c1 ea 04             	shr    $0x4,%edx
+80101ca2:	89 d0                	mov    %edx,%eax
+80101ca4:	c1 e0 05             	shl    $0x5,%eax
+80101ca7:	29 d0                	sub    %edx,%eax
+80101ca9:	29 c1                	sub    %eax,%ecx
+80101cab:	6b d1 38             	imul   $0x38,%ecx,%edx
+80101cae:	8d 82 80 88 31 80    	lea    -0x7fce7780(%edx),%eax
+}
+80101cb4:	c3                   	ret
+
+80101cb5 <dirhash>:
+#define DIRSLOTS (PGSIZE / sizeof(uint)) // hash slots per page
+#define DIRDEL 0xFFFFFFFF                // slot of a removed entry
+
+static uint
+dirhash(char *name)
+{
+80101cb5:	55                   	push   %ebp
+80101cb6:	89 e5                	mov    %esp,%ebp
+80101cb8:	56                   	push   %esi
+80101cb9:	53                   	push   %ebx
+80101cba:	89 c3                	mov    %eax,%ebx
+  uint h;
+  int i;
+
+  h = 0;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101cbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  h = 0;
+80101cc1:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101cc6:	eb 10                	jmp    80101cd8 <dirhash+0x23>
+    h = h*31 + (uchar)name[i];
+80101cc8:	89 f1                	mov    %esi,%ecx
+80101cca:	c1 e1 05             	shl    $0x5,%ecx
+80101ccd:	29 f1                	sub    %esi,%ecx
+80101ccf:	0f b6 c0             	movzbl %al,%eax
+80101cd2:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101cd5:	83 c2 01             	add    $0x1,%edx
+80101cd8:	83 fa 0d             	cmp    $0xd,%edx
+80101cdb:	7f 08                	jg     80101ce5 <dirhash+0x30>
+80101cdd:	0f b6 04 13          	movzbl (%ebx,%edx,1),%eax
+80101ce1:	84 c0                	test   %al,%al
+80101ce3:	75 e3                	jne    80101cc8 <dirhash+0x13>
+  return h;
+}
+80101ce5:	89 f0                	mov    %esi,%eax
+80101ce7:	5b                   	pop    %ebx
+80101ce8:	5e                   	pop    %esi
+80101ce9:	5d                   	pop    %ebp
+80101cea:	c3                   	ret
+
+80101ceb <dirslot>:
+
+static uint*
+dirslot(struct inode *dp, uint i)
+{
+80101ceb:	55                   	push   %ebp
+80101cec:	89 e5                	mov    %esp,%ebp
+80101cee:	53                   	push   %ebx
+80101cef:	89 c1                	mov    %eax,%ecx
+  return &dp->dirhash[i / DIRSLOTS][i % DIRSLOTS];
+80101cf1:	89 d3                	mov    %edx,%ebx
+80101cf3:	c1 eb 0a             	shr    $0xa,%ebx
+80101cf6:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+80101cfc:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+80101d03:	03 84 99 e8 00 00 00 	add    0xe8(%ecx,%ebx,4),%eax
+}
+80101d0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101d0d:	c9                   	leave
+80101d0e:	c3                   	ret
+
+80101d0f <dirindexadd>:
+}
+
+// Record that the dirent at off holds name.
+static void
+dirindexadd(struct inode *dp, char *name, uint off)
+{
+80101d0f:	55                   	push   %ebp
+80101d10:	89 e5                	mov    %esp,%ebp
+80101d12:	57                   	push   %edi
+80101d13:	56                   	push   %esi
+80101d14:	53                   	push   %ebx
+80101d15:	83 ec 1c             	sub    $0x1c,%esp
+80101d18:	89 c7                	mov    %eax,%edi
+80101d1a:	89 d0                	mov    %edx,%eax
+80101d1c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  uint i, n, *s;
+
+  n = dp->ndirhash * DIRSLOTS;
+80101d1f:	8b b7 28 01 00 00    	mov    0x128(%edi),%esi
+80101d25:	c1 e6 0a             	shl    $0xa,%esi
+  for(i = dirhash(name) % n; *(s = dirslot(dp, i)) != 0; i = (i + 1) % n)
+80101d28:	e8 88 ff ff ff       	call   80101cb5 <dirhash>
+80101d2d:	ba 00 00 00 00       	mov    $0x0,%edx
+80101d32:	f7 f6                	div    %esi
+80101d34:	89 d3                	mov    %edx,%ebx
+80101d36:	eb 0c                	jmp    80101d44 <dirindexadd+0x35>
+80101d38:	8d 43 01             	lea    0x1(%ebx),%eax
+80101d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+80101d40:	f7 f6                	div    %esi
+80101d42:	89 d3                	mov    %edx,%ebx
+80101d44:	89 da                	mov    %ebx,%edx
+80101d46:	89 f8                	mov    %edi,%eax
+80101d48:	e8 9e ff ff ff       	call   80101ceb <dirslot>
+80101d4d:	8b 10                	mov    (%eax),%edx
+80101d4f:	85 d2                	test   %edx,%edx
+80101d51:	74 05                	je     80101d58 <dirindexadd+0x49>
+    if(*s == DIRDEL)
+80101d53:	83 fa ff             	cmp    $0xffffffff,%edx
+80101d56:	75 e0                	jne    80101d38 <dirindexadd+0x29>
+      break;
+  if(*s == 0)
+80101d58:	85 d2                	test   %edx,%edx
+80101d5a:	75 0f                	jne    80101d6b <dirindexadd+0x5c>
+    dp->dirused++;
+80101d5c:	8b 8f 2c 01 00 00    	mov    0x12c(%edi),%ecx
+80101d62:	8d 51 01             	lea    0x1(%ecx),%edx
+80101d65:	89 97 2c 01 00 00    	mov    %edx,0x12c(%edi)
+  *s = off / sizeof(struct dirent) + 1;
+80101d6b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101d6e:	c1 ea 04             	shr    $0x4,%edx
+80101d71:	83 c2 01             	add    $0x1,%edx
+80101d74:	89 10                	mov    %edx,(%eax)
+}
+80101d76:	83 c4 1c             	add    $0x1c,%esp
+80101d79:	5b                   	pop    %ebx
+80101d7a:	5e                   	pop    %esi
+80101d7b:	5f                   	pop    %edi
+80101d7c:	5d                   	pop    %ebp
+80101d7d:	c3                   	ret
+
+80101d7e <dcentry>:
+    brelse(bp);
+}
+
+static struct dcentry*
+dcentry(struct inode *dp, char *name)
+{
+80101d7e:	55                   	push   %ebp
+80101d7f:	89 e5                	mov    %esp,%ebp
+80101d81:	53                   	push   %ebx
+80101d82:	83 ec 04             	sub    $0x4,%esp
+80101d85:	89 c3                	mov    %eax,%ebx
+80101d87:	89 d0                	mov    %edx,%eax
+  return &dcache.e[(dirhash(name) + dp->inum*31) % NDCACHE];
+80101d89:	e8 27 ff ff ff       	call   80101cb5 <dirhash>
+80101d8e:	8b 4b 04             	mov    0x4(%ebx),%ecx
+80101d91:	89 ca                	mov    %ecx,%edx
+80101d93:	c1 e2 05             	shl    $0x5,%edx
+80101d96:	29 ca                	sub    %ecx,%edx
+80101d98:	01 d0                	add    %edx,%eax
+80101d9a:	0f b6 c0             	movzbl %al,%eax
+80101d9d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+80101da0:	05 d4 cd 31 80       	add    $0x8031cdd4,%eax
+}
+80101da5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101da8:	c9                   	leave
+80101da9:	c3                   	ret
+
+80101daa <skipelem>:
+//   skipelem("a", name) = "", setting name = "a"
+//   skipelem("", name) = skipelem("////", name) = 0
+//
+static char*
+skipelem(char *path, char *name)
+{
+80101daa:	55                   	push   %ebp
+80101dab:	89 e5                	mov    %esp,%ebp
+80101dad:	57                   	push   %edi
+80101dae:	56                   	push   %esi
+80101daf:	53                   	push   %ebx
+80101db0:	83 ec 0c             	sub    $0xc,%esp
+80101db3:	89 d6                	mov    %edx,%esi
+  char *s;
+  int len;
+
+  while(*path == '/')
+80101db5:	eb 03                	jmp    80101dba <skipelem+0x10>
+    path++;
+80101db7:	83 c0 01             	add    $0x1,%eax
+  while(*path == '/')
+80101dba:	0f b6 10             	movzbl (%eax),%edx
+80101dbd:	80 fa 2f             	cmp    $0x2f,%dl
+80101dc0:	74 f5                	je     80101db7 <skipelem+0xd>
+  if(*path == 0)
+80101dc2:	84 d2                	test   %dl,%dl
+80101dc4:	74 53                	je     80101e19 <skipelem+0x6f>
+80101dc6:	89 c3                	mov    %eax,%ebx
+80101dc8:	eb 03                	jmp    80101dcd <skipelem+0x23>
+    return 0;
+  s = path;
+  while(*path != '/' && *path != 0)
+    path++;
+80101dca:	83 c3 01             	add    $0x1,%ebx
+  while(*path != '/' && *path != 0)
+80101dcd:	0f b6 13             	movzbl (%ebx),%edx
+80101dd0:	80 fa 2f             	cmp    $0x2f,%dl
+80101dd3:	74 04                	je     80101dd9 <skipelem+0x2f>
+80101dd5:	84 d2                	test   %dl,%dl
+80101dd7:	75 f1                	jne    80101dca <skipelem+0x20>
+  len = path - s;
+80101dd9:	89 df                	mov    %ebx,%edi
+80101ddb:	29 c7                	sub    %eax,%edi
+  if(len >= DIRSIZ)
+80101ddd:	83 ff 0d             	cmp    $0xd,%edi
+80101de0:	7e 11                	jle    80101df3 <skipelem+0x49>
+    memmove(name, s, DIRSIZ);
+80101de2:	83 ec 04             	sub    $0x4,%esp
+80101de5:	6a 0e                	push   $0xe
+80101de7:	50                   	push   %eax
+80101de8:	56                   	push   %esi
+80101de9:	e8 01 5d 00 00       	call   80107aef <memmove>
+80101dee:	83 c4 10             	add    $0x10,%esp
+80101df1:	eb 17                	jmp    80101e0a <skipelem+0x60>
+  else {
+    memmove(name, s, len);
+80101df3:	83 ec 04             	sub    $0x4,%esp
+80101df6:	57                   	push   %edi
+80101df7:	50                   	push   %eax
+80101df8:	56                   	push   %esi
+80101df9:	e8 f1 5c 00 00       	call   80107aef <memmove>
+    name[len] = 0;
+80101dfe:	c6 04 3e 00          	movb   $0x0,(%esi,%edi,1)
+80101e02:	83 c4 10             	add    $0x10,%esp
+80101e05:	eb 03                	jmp    80101e0a <skipelem+0x60>
+  }
+  while(*path == '/')
+    path++;
+80101e07:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80101e0a:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80101e0d:	74 f8                	je     80101e07 <skipelem+0x5d>
+  return path;
+}
+80101e0f:	89 d8                	mov    %ebx,%eax
+80101e11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101e14:	5b                   	pop    %ebx
+80101e15:	5e                   	pop    %esi
+80101e16:	5f                   	pop    %edi
+80101e17:	5d                   	pop    %ebp
+80101e18:	c3                   	ret
+    return 0;
+80101e19:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101e1e:	eb ef                	jmp    80101e0f <skipelem+0x65>
+
+80101e20 <ilruadd>:
+{
+80101e20:	55                   	push   %ebp
+80101e21:	89 e5                	mov    %esp,%ebp
+80101e23:	56                   	push   %esi
+80101e24:	53                   	push   %ebx
+80101e25:	89 c3                	mov    %eax,%ebx
+80101e27:	89 d6                	mov    %edx,%esi
+  acquire(&icache.lrulock);
+80101e29:	83 ec 0c             	sub    $0xc,%esp
+80101e2c:	68 7c 8f 31 80       	push   $0x80318f7c
+80101e31:	e8 95 5b 00 00       	call   801079cb <acquire>
+  h = tail ? icache.head.lprev : &icache.head;
+80101e36:	83 c4 10             	add    $0x10,%esp
+80101e39:	85 f6                	test   %esi,%esi
+80101e3b:	74 2e                	je     80101e6b <ilruadd+0x4b>
+80101e3d:	a1 c0 8f 31 80       	mov    0x80318fc0,%eax
+  ip->lnext = h->lnext;
+80101e42:	8b 50 14             	mov    0x14(%eax),%edx
+80101e45:	89 53 14             	mov    %edx,0x14(%ebx)
+  ip->lprev = h;
+80101e48:	89 43 10             	mov    %eax,0x10(%ebx)
+  h->lnext->lprev = ip;
+80101e4b:	8b 50 14             	mov    0x14(%eax),%edx
+80101e4e:	89 5a 10             	mov    %ebx,0x10(%edx)
+  h->lnext = ip;
+80101e51:	89 58 14             	mov    %ebx,0x14(%eax)
+  release(&icache.lrulock);
+80101e54:	83 ec 0c             	sub    $0xc,%esp
+80101e57:	68 7c 8f 31 80       	push   $0x80318f7c
+80101e5c:	e8 cf 5b 00 00       	call   80107a30 <release>
+}
+80101e61:	83 c4 10             	add    $0x10,%esp
+80101e64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101e67:	5b                   	pop    %ebx
+80101e68:	5e                   	pop    %esi
+80101e69:	5d                   	pop    %ebp
+80101e6a:	c3                   	ret
+  h = tail ? icache.head.lprev : &icache.head;
+80101e6b:	b8 b0 8f 31 80       	mov    $0x80318fb0,%eax
+80101e70:	eb d0                	jmp    80101e42 <ilruadd+0x22>
+
+80101e72 <ilruremove>:
+{
+80101e72:	55                   	push   %ebp
+80101e73:	89 e5                	mov    %esp,%ebp
+80101e75:	53                   	push   %ebx
+80101e76:	83 ec 10             	sub    $0x10,%esp
+80101e79:	89 c3                	mov    %eax,%ebx
+  acquire(&icache.lrulock);
+80101e7b:	68 7c 8f 31 80       	push   $0x80318f7c
+80101e80:	e8 46 5b 00 00       	call   801079cb <acquire>
+  ip->lnext->lprev = ip->lprev;
+80101e85:	8b 53 14             	mov    0x14(%ebx),%edx
+80101e88:	8b 43 10             	mov    0x10(%ebx),%eax
+80101e8b:	89 42 10             	mov    %eax,0x10(%edx)
+  ip->lprev->lnext = ip->lnext;
+80101e8e:	8b 53 14             	mov    0x14(%ebx),%edx
+80101e91:	89 50 14             	mov    %edx,0x14(%eax)
+  release(&icache.lrulock);
+80101e94:	c7 04 24 7c 8f 31 80 	movl   $0x80318f7c,(%esp)
+80101e9b:	e8 90 5b 00 00       	call   80107a30 <release>
+}
+80101ea0:	83 c4 10             	add    $0x10,%esp
+80101ea3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101ea6:	c9                   	leave
+80101ea7:	c3                   	ret
+
+80101ea8 <ilookup>:
+{
+80101ea8:	55                   	push   %ebp
+80101ea9:	89 e5                	mov    %esp,%ebp
+80101eab:	53                   	push   %ebx
+80101eac:	83 ec 04             	sub    $0x4,%esp
+  for(ip = bk->head; ip; ip = ip->hnext){
+80101eaf:	8b 58 34             	mov    0x34(%eax),%ebx
+80101eb2:	eb 0c                	jmp    80101ec0 <ilookup+0x18>
+        ilruremove(ip);
+80101eb4:	89 d8                	mov    %ebx,%eax
+80101eb6:	e8 b7 ff ff ff       	call   80101e72 <ilruremove>
+      return ip;
+80101ebb:	eb 1d                	jmp    80101eda <ilookup+0x32>
+  for(ip = bk->head; ip; ip = ip->hnext){
+80101ebd:	8b 5b 0c             	mov    0xc(%ebx),%ebx
+80101ec0:	85 db                	test   %ebx,%ebx
+80101ec2:	74 16                	je     80101eda <ilookup+0x32>
+    if(ip->dev == dev && ip->inum == inum){
+80101ec4:	39 13                	cmp    %edx,(%ebx)
+80101ec6:	75 f5                	jne    80101ebd <ilookup+0x15>
+80101ec8:	39 4b 04             	cmp    %ecx,0x4(%ebx)
+80101ecb:	75 f0                	jne    80101ebd <ilookup+0x15>
+      if(ip->ref++ == 0)
+80101ecd:	8b 43 08             	mov    0x8(%ebx),%eax
+80101ed0:	8d 50 01             	lea    0x1(%eax),%edx
+80101ed3:	89 53 08             	mov    %edx,0x8(%ebx)
+80101ed6:	85 c0                	test   %eax,%eax
+80101ed8:	74 da                	je     80101eb4 <ilookup+0xc>
+}
+80101eda:	89 d8                	mov    %ebx,%eax
+80101edc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101edf:	c9                   	leave
+80101ee0:	c3                   	ret
+
+80101ee1 <dcachepurge>:
+{
+80101ee1:	55                   	push   %ebp
+80101ee2:	89 e5                	mov    %esp,%ebp
+80101ee4:	56                   	push   %esi
+80101ee5:	53                   	push   %ebx
+80101ee6:	89 c6                	mov    %eax,%esi
+80101ee8:	89 d3                	mov    %edx,%ebx
+  acquire(&dcache.lock);
+80101eea:	83 ec 0c             	sub    $0xc,%esp
+80101eed:	68 a0 cd 31 80       	push   $0x8031cda0
+80101ef2:	e8 d4 5a 00 00       	call   801079cb <acquire>
+  for(e = dcache.e; e < &dcache.e[NDCACHE]; e++)
+80101ef7:	83 c4 10             	add    $0x10,%esp
+80101efa:	b8 d4 cd 31 80       	mov    $0x8031cdd4,%eax
+80101eff:	eb 03                	jmp    80101f04 <dcachepurge+0x23>
+80101f01:	83 c0 1c             	add    $0x1c,%eax
+80101f04:	3d d4 e9 31 80       	cmp    $0x8031e9d4,%eax
+80101f09:	73 12                	jae    80101f1d <dcachepurge+0x3c>
+    if(e->dir == inum && e->dev == dev)
+80101f0b:	39 58 04             	cmp    %ebx,0x4(%eax)
+80101f0e:	75 f1                	jne    80101f01 <dcachepurge+0x20>
+80101f10:	39 30                	cmp    %esi,(%eax)
+80101f12:	75 ed                	jne    80101f01 <dcachepurge+0x20>
+      e->dir = 0;
+80101f14:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+80101f1b:	eb e4                	jmp    80101f01 <dcachepurge+0x20>
+  release(&dcache.lock);
+80101f1d:	83 ec 0c             	sub    $0xc,%esp
+80101f20:	68 a0 cd 31 80       	push   $0x8031cda0
+80101f25:	e8 06 5b 00 00       	call   80107a30 <release>
+}
+80101f2a:	83 c4 10             	add    $0x10,%esp
+80101f2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101f30:	5b                   	pop    %ebx
+80101f31:	5e                   	pop    %esi
+80101f32:	5d                   	pop    %ebp
+80101f33:	c3                   	ret
+
+80101f34 <ifreemark>:
+{
+80101f34:	55                   	push   %ebp
+80101f35:	89 e5                	mov    %esp,%ebp
+80101f37:	53                   	push   %ebx
+80101f38:	83 ec 10             	sub    $0x10,%esp
+80101f3b:	89 c3                	mov    %eax,%ebx
+  acquire(&ifree.lock);
+80101f3d:	68 40 cd 31 80       	push   $0x8031cd40
+80101f42:	e8 84 5a 00 00       	call   801079cb <acquire>
+  ifree.map[inum/32] |= 1U << (inum%32);
+80101f47:	89 da                	mov    %ebx,%edx
+80101f49:	c1 ea 05             	shr    $0x5,%edx
+80101f4c:	b8 01 00 00 00       	mov    $0x1,%eax
+80101f51:	89 d9                	mov    %ebx,%ecx
+80101f53:	d3 e0                	shl    %cl,%eax
+80101f55:	09 04 95 78 cd 31 80 	or     %eax,-0x7fce3288(,%edx,4)
+  if(inum < ifree.inext)
+80101f5c:	83 c4 10             	add    $0x10,%esp
+80101f5f:	3b 1d 74 cd 31 80    	cmp    0x8031cd74,%ebx
+80101f65:	73 06                	jae    80101f6d <ifreemark+0x39>
+    ifree.inext = inum;
+80101f67:	89 1d 74 cd 31 80    	mov    %ebx,0x8031cd74
+  release(&ifree.lock);
+80101f6d:	83 ec 0c             	sub    $0xc,%esp
+80101f70:	68 40 cd 31 80       	push   $0x8031cd40
+80101f75:	e8 b6 5a 00 00       	call   80107a30 <release>
+}
+80101f7a:	83 c4 10             	add    $0x10,%esp
+80101f7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101f80:	c9                   	leave
+80101f81:	c3                   	ret
+
+80101f82 <bfree>:
+{
+80101f82:	55                   	push   %ebp
+80101f83:	89 e5                	mov    %esp,%ebp
+80101f85:	57                   	push   %edi
+80101f86:	56                   	push   %esi
+80101f87:	53                   	push   %ebx
+80101f88:	83 ec 14             	sub    $0x14,%esp
+80101f8b:	89 c1                	mov    %eax,%ecx
+80101f8d:	89 d3                	mov    %edx,%ebx
+  bp = bread(dev, BBLOCK(b, sb));
+80101f8f:	89 d0                	mov    %edx,%eax
+80101f91:	c1 e8 0f             	shr    $0xf,%eax
+80101f94:	03 05 38 cd 31 80    	add    0x8031cd38,%eax
+80101f9a:	50                   	push   %eax
+80101f9b:	51                   	push   %ecx
+80101f9c:	e8 cb e8 ff ff       	call   8010086c <bread>
+80101fa1:	89 c6                	mov    %eax,%esi
+  bi = b % BPB;
+80101fa3:	89 da                	mov    %ebx,%edx
+80101fa5:	81 e2 ff 7f 00 00    	and    $0x7fff,%edx
+  m = 1 << (bi % 8);
+80101fab:	89 d9                	mov    %ebx,%ecx
+80101fad:	83 e1 07             	and    $0x7,%ecx
+80101fb0:	b8 01 00 00 00       	mov    $0x1,%eax
+80101fb5:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101fb7:	83 c4 10             	add    $0x10,%esp
+80101fba:	c1 fa 03             	sar    $0x3,%edx
+80101fbd:	03 56 60             	add    0x60(%esi),%edx
+80101fc0:	0f b6 0a             	movzbl (%edx),%ecx
+80101fc3:	0f b6 f9             	movzbl %cl,%edi
+80101fc6:	85 c7                	test   %eax,%edi
+80101fc8:	74 4e                	je     80102018 <bfree+0x96>
+  bp->data[bi/8] &= ~m;
+80101fca:	f7 d0                	not    %eax
+80101fcc:	21 c8                	and    %ecx,%eax
+80101fce:	88 02                	mov    %al,(%edx)
+  log_write(bp);
+80101fd0:	83 ec 0c             	sub    $0xc,%esp
+80101fd3:	56                   	push   %esi
+80101fd4:	e8 47 28 00 00       	call   80104820 <log_write>
+  brelse(bp);
+80101fd9:	89 34 24             	mov    %esi,(%esp)
+80101fdc:	e8 5a e9 ff ff       	call   8010093b <brelse>
+  acquire(&bsum.lock);
+80101fe1:	c7 04 24 e0 e9 31 80 	movl   $0x8031e9e0,(%esp)
+80101fe8:	e8 de 59 00 00       	call   801079cb <acquire>
+  bsum.nfree[b / BGROUP]++;
+80101fed:	c1 eb 08             	shr    $0x8,%ebx
+80101ff0:	ba e0 e9 31 80       	mov    $0x8031e9e0,%edx
+80101ff5:	83 c3 18             	add    $0x18,%ebx
+80101ff8:	0f b7 44 5a 08       	movzwl 0x8(%edx,%ebx,2),%eax
+80101ffd:	83 c0 01             	add    $0x1,%eax
+80102000:	66 89 44 5a 08       	mov    %ax,0x8(%edx,%ebx,2)
+  release(&bsum.lock);
+80102005:	89 14 24             	mov    %edx,(%esp)
+80102008:	e8 23 5a 00 00       	call   80107a30 <release>
+}
+8010200d:	83 c4 10             	add    $0x10,%esp
+80102010:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102013:	5b                   	pop    %ebx
+80102014:	5e                   	pop    %esi
+80102015:	5f                   	pop    %edi
+80102016:	5d                   	pop    %ebp
+80102017:	c3                   	ret
+    panic("freeing free block");
+80102018:	83 ec 0c             	sub    $0xc,%esp
+8010201b:	68 13 b2 10 80       	push   $0x8010b213
+80102020:	e8 01 eb ff ff       	call   80100b26 <panic>
+
+80102025 <bfreeind>:
+{
+80102025:	55                   	push   %ebp
+80102026:	89 e5                	mov    %esp,%ebp
+80102028:	57                   	push   %edi
+80102029:	56                   	push   %esi
+8010202a:	53                   	push   %ebx
+8010202b:	83 ec 24             	sub    $0x24,%esp
+8010202e:	89 c7                	mov    %eax,%edi
+80102030:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  bp = bread(dev, addr);
+80102033:	52                   	push   %edx
+80102034:	50                   	push   %eax
+80102035:	e8 32 e8 ff ff       	call   8010086c <bread>
+  a = (uint*)bp->data;
+8010203a:	8b 70 60             	mov    0x60(%eax),%esi
+  for(j = 0; j < NINDIRECT; j++){
+8010203d:	83 c4 10             	add    $0x10,%esp
+80102040:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102045:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102048:	eb 03                	jmp    8010204d <bfreeind+0x28>
+8010204a:	83 c3 01             	add    $0x1,%ebx
+8010204d:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+80102053:	77 10                	ja     80102065 <bfreeind+0x40>
+    if(a[j])
+80102055:	8b 14 9e             	mov    (%esi,%ebx,4),%edx
+80102058:	85 d2                	test   %edx,%edx
+8010205a:	74 ee                	je     8010204a <bfreeind+0x25>
+      bfree(dev, a[j]);
+8010205c:	89 f8                	mov    %edi,%eax
+8010205e:	e8 1f ff ff ff       	call   80101f82 <bfree>
+80102063:	eb e5                	jmp    8010204a <bfreeind+0x25>
+  brelse(bp);
+80102065:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102068:	83 ec 0c             	sub    $0xc,%esp
+8010206b:	50                   	push   %eax
+8010206c:	e8 ca e8 ff ff       	call   8010093b <brelse>
+  bfree(dev, addr);
+80102071:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102074:	89 f8                	mov    %edi,%eax
+80102076:	e8 07 ff ff ff       	call   80101f82 <bfree>
+}
+8010207b:	83 c4 10             	add    $0x10,%esp
+8010207e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102081:	5b                   	pop    %ebx
+80102082:	5e                   	pop    %esi
+80102083:	5f                   	pop    %edi
+80102084:	5d                   	pop    %ebp
+80102085:	c3                   	ret
+
+80102086 <bscan>:
+{
+80102086:	55                   	push   %ebp
+80102087:	89 e5                	mov    %esp,%ebp
+80102089:	57                   	push   %edi
+8010208a:	56                   	push   %esi
+8010208b:	53                   	push   %ebx
+8010208c:	83 ec 24             	sub    $0x24,%esp
+8010208f:	89 d3                	mov    %edx,%ebx
+80102091:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  base = b - b % BPB;
+80102094:	89 d6                	mov    %edx,%esi
+80102096:	81 e6 00 80 ff ff    	and    $0xffff8000,%esi
+  bp = bread(dev, BBLOCK(b, sb));
+8010209c:	c1 ea 0f             	shr    $0xf,%edx
+8010209f:	03 15 38 cd 31 80    	add    0x8031cd38,%edx
+801020a5:	52                   	push   %edx
+801020a6:	50                   	push   %eax
+801020a7:	e8 c0 e7 ff ff       	call   8010086c <bread>
+801020ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  w = (uint*)bp->data;
+801020af:	8b 78 60             	mov    0x60(%eax),%edi
+  for(bi = b - base; bi < end - base; bi = bi - bi%32 + 32){
+801020b2:	29 f3                	sub    %esi,%ebx
+801020b4:	89 d9                	mov    %ebx,%ecx
+801020b6:	83 c4 10             	add    $0x10,%esp
+801020b9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801020bc:	29 f2                	sub    %esi,%edx
+801020be:	39 d1                	cmp    %edx,%ecx
+801020c0:	73 23                	jae    801020e5 <bscan+0x5f>
+    bits = ~w[bi/32] & (~0U << (bi%32));  // free bits from bi on
+801020c2:	89 c8                	mov    %ecx,%eax
+801020c4:	c1 e8 05             	shr    $0x5,%eax
+801020c7:	8b 04 87             	mov    (%edi,%eax,4),%eax
+801020ca:	f7 d0                	not    %eax
+801020cc:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801020d1:	d3 e3                	shl    %cl,%ebx
+    if(bits == 0)
+801020d3:	21 d8                	and    %ebx,%eax
+801020d5:	74 29                	je     80102100 <bscan+0x7a>
+    bi = bi - bi%32 + __builtin_ctz(bits);
+801020d7:	83 e1 e0             	and    $0xffffffe0,%ecx
+801020da:	f3 0f bc c0          	tzcnt  %eax,%eax
+801020de:	8d 1c 01             	lea    (%ecx,%eax,1),%ebx
+    if(bi >= end - base)
+801020e1:	39 d3                	cmp    %edx,%ebx
+801020e3:	72 23                	jb     80102108 <bscan+0x82>
+  brelse(bp);
+801020e5:	83 ec 0c             	sub    $0xc,%esp
+801020e8:	ff 75 e0             	push   -0x20(%ebp)
+801020eb:	e8 4b e8 ff ff       	call   8010093b <brelse>
+  return 0;
+801020f0:	83 c4 10             	add    $0x10,%esp
+801020f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801020f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801020fb:	5b                   	pop    %ebx
+801020fc:	5e                   	pop    %esi
+801020fd:	5f                   	pop    %edi
+801020fe:	5d                   	pop    %ebp
+801020ff:	c3                   	ret
+  for(bi = b - base; bi < end - base; bi = bi - bi%32 + 32){
+80102100:	83 e1 e0             	and    $0xffffffe0,%ecx
+80102103:	83 c1 20             	add    $0x20,%ecx
+80102106:	eb b1                	jmp    801020b9 <bscan+0x33>
+    w[bi/32] |= 1U << (bi%32);  // Mark block in use.
+80102108:	89 da                	mov    %ebx,%edx
+8010210a:	c1 ea 05             	shr    $0x5,%edx
+8010210d:	b8 01 00 00 00       	mov    $0x1,%eax
+80102112:	89 d9                	mov    %ebx,%ecx
+80102114:	d3 e0                	shl    %cl,%eax
+80102116:	09 04 97             	or     %eax,(%edi,%edx,4)
+    log_write(bp);
+80102119:	83 ec 0c             	sub    $0xc,%esp
+8010211c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+8010211f:	57                   	push   %edi
+80102120:	e8 fb 26 00 00       	call   80104820 <log_write>
+    brelse(bp);
+80102125:	89 3c 24             	mov    %edi,(%esp)
+80102128:	e8 0e e8 ff ff       	call   8010093b <brelse>
+    return base + bi;
+8010212d:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+80102130:	83 c4 10             	add    $0x10,%esp
+80102133:	eb c3                	jmp    801020f8 <bscan+0x72>
+
+80102135 <bzero>:
+{
+80102135:	55                   	push   %ebp
+80102136:	89 e5                	mov    %esp,%ebp
+80102138:	53                   	push   %ebx
+80102139:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, bno);
+8010213c:	52                   	push   %edx
+8010213d:	50                   	push   %eax
+8010213e:	e8 29 e7 ff ff       	call   8010086c <bread>
+80102143:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+80102145:	8b 40 60             	mov    0x60(%eax),%eax
+80102148:	83 c4 0c             	add    $0xc,%esp
+8010214b:	68 00 10 00 00       	push   $0x1000
+80102150:	6a 00                	push   $0x0
+80102152:	50                   	push   %eax
+80102153:	e8 1f 59 00 00       	call   80107a77 <memset>
+  log_write(bp);
+80102158:	89 1c 24             	mov    %ebx,(%esp)
+8010215b:	e8 c0 26 00 00       	call   80104820 <log_write>
+  brelse(bp);
+80102160:	89 1c 24             	mov    %ebx,(%esp)
+80102163:	e8 d3 e7 ff ff       	call   8010093b <brelse>
+}
+80102168:	83 c4 10             	add    $0x10,%esp
+8010216b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010216e:	c9                   	leave
+8010216f:	c3                   	ret
+
+80102170 <balloc>:
+{
+80102170:	55                   	push   %ebp
+80102171:	89 e5                	mov    %esp,%ebp
+80102173:	57                   	push   %edi
+80102174:	56                   	push   %esi
+80102175:	53                   	push   %ebx
+80102176:	83 ec 1c             	sub    $0x1c,%esp
+80102179:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010217c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  if(goal >= sb.size)
+8010217f:	3b 15 20 cd 31 80    	cmp    0x8031cd20,%edx
+80102185:	72 07                	jb     8010218e <balloc+0x1e>
+    goal = 0;
+80102187:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  g = goal / BGROUP;
+8010218e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102191:	c1 eb 08             	shr    $0x8,%ebx
+  for(i = 0; i <= bsum.ngroup; i++, g = (g + 1) % bsum.ngroup){
+80102194:	be 00 00 00 00       	mov    $0x0,%esi
+80102199:	eb 22                	jmp    801021bd <balloc+0x4d>
+    b = bscan(dev, i == 0 ? goal : g*BGROUP, min((g+1)*BGROUP, sb.size));
+8010219b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010219e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801021a1:	e8 e0 fe ff ff       	call   80102086 <bscan>
+    if(b != 0){
+801021a6:	85 c0                	test   %eax,%eax
+801021a8:	75 6d                	jne    80102217 <balloc+0xa7>
+  for(i = 0; i <= bsum.ngroup; i++, g = (g + 1) % bsum.ngroup){
+801021aa:	83 c6 01             	add    $0x1,%esi
+801021ad:	8d 43 01             	lea    0x1(%ebx),%eax
+801021b0:	ba 00 00 00 00       	mov    $0x0,%edx
+801021b5:	f7 35 14 ea 31 80    	divl   0x8031ea14
+801021bb:	89 d3                	mov    %edx,%ebx
+801021bd:	39 35 14 ea 31 80    	cmp    %esi,0x8031ea14
+801021c3:	72 45                	jb     8010220a <balloc+0x9a>
+    acquire(&bsum.lock);
+801021c5:	83 ec 0c             	sub    $0xc,%esp
+801021c8:	68 e0 e9 31 80       	push   $0x8031e9e0
+801021cd:	e8 f9 57 00 00       	call   801079cb <acquire>
+    n = bsum.nfree[g];
+801021d2:	0f b7 bc 1b 18 ea 31 	movzwl -0x7fce15e8(%ebx,%ebx,1),%edi
+801021d9:	80 
+    release(&bsum.lock);
+801021da:	c7 04 24 e0 e9 31 80 	movl   $0x8031e9e0,(%esp)
+801021e1:	e8 4a 58 00 00       	call   80107a30 <release>
+    if(n == 0)
+801021e6:	83 c4 10             	add    $0x10,%esp
+801021e9:	66 85 ff             	test   %di,%di
+801021ec:	74 bc                	je     801021aa <balloc+0x3a>
+    b = bscan(dev, i == 0 ? goal : g*BGROUP, min((g+1)*BGROUP, sb.size));
+801021ee:	8b 0d 20 cd 31 80    	mov    0x8031cd20,%ecx
+801021f4:	8d 43 01             	lea    0x1(%ebx),%eax
+801021f7:	c1 e0 08             	shl    $0x8,%eax
+801021fa:	39 c1                	cmp    %eax,%ecx
+801021fc:	0f 47 c8             	cmova  %eax,%ecx
+801021ff:	85 f6                	test   %esi,%esi
+80102201:	74 98                	je     8010219b <balloc+0x2b>
+80102203:	89 da                	mov    %ebx,%edx
+80102205:	c1 e2 08             	shl    $0x8,%edx
+80102208:	eb 94                	jmp    8010219e <balloc+0x2e>
+  panic("balloc: out of blocks");
+8010220a:	83 ec 0c             	sub    $0xc,%esp
+8010220d:	68 26 b2 10 80       	push   $0x8010b226
+80102212:	e8 0f e9 ff ff       	call   80100b26 <panic>
+      acquire(&bsum.lock);
+80102217:	89 c7                	mov    %eax,%edi
+80102219:	83 ec 0c             	sub    $0xc,%esp
+8010221c:	68 e0 e9 31 80       	push   $0x8031e9e0
+80102221:	e8 a5 57 00 00       	call   801079cb <acquire>
+      bsum.nfree[g]--;
+80102226:	ba e0 e9 31 80       	mov    $0x8031e9e0,%edx
+8010222b:	83 c3 18             	add    $0x18,%ebx
+8010222e:	0f b7 44 5a 08       	movzwl 0x8(%edx,%ebx,2),%eax
+80102233:	83 e8 01             	sub    $0x1,%eax
+80102236:	66 89 44 5a 08       	mov    %ax,0x8(%edx,%ebx,2)
+      release(&bsum.lock);
+8010223b:	89 14 24             	mov    %edx,(%esp)
+8010223e:	e8 ed 57 00 00       	call   80107a30 <release>
+      bzero(dev, b);
+80102243:	89 fa                	mov    %edi,%edx
+80102245:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102248:	e8 e8 fe ff ff       	call   80102135 <bzero>
+}
+8010224d:	89 f8                	mov    %edi,%eax
+8010224f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102252:	5b                   	pop    %ebx
+80102253:	5e                   	pop    %esi
+80102254:	5f                   	pop    %edi
+80102255:	5d                   	pop    %ebp
+80102256:	c3                   	ret
+
+80102257 <iballoc>:
+{
+80102257:	55                   	push   %ebp
+80102258:	89 e5                	mov    %esp,%ebp
+8010225a:	53                   	push   %ebx
+8010225b:	83 ec 04             	sub    $0x4,%esp
+8010225e:	89 c3                	mov    %eax,%ebx
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80102260:	8b 90 e4 00 00 00    	mov    0xe4(%eax),%edx
+80102266:	85 d2                	test   %edx,%edx
+80102268:	74 03                	je     8010226d <iballoc+0x16>
+8010226a:	83 c2 01             	add    $0x1,%edx
+8010226d:	8b 03                	mov    (%ebx),%eax
+8010226f:	e8 fc fe ff ff       	call   80102170 <balloc>
+80102274:	89 83 e4 00 00 00    	mov    %eax,0xe4(%ebx)
+}
+8010227a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010227d:	c9                   	leave
+8010227e:	c3                   	ret
+
+8010227f <bmap1>:
+{
+8010227f:	55                   	push   %ebp
+80102280:	89 e5                	mov    %esp,%ebp
+80102282:	57                   	push   %edi
+80102283:	56                   	push   %esi
+80102284:	53                   	push   %ebx
+80102285:	83 ec 2c             	sub    $0x2c,%esp
+80102288:	89 c3                	mov    %eax,%ebx
+8010228a:	89 d7                	mov    %edx,%edi
+8010228c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(bn < NDIRECT){
+8010228f:	83 fa 0a             	cmp    $0xa,%edx
+80102292:	76 58                	jbe    801022ec <bmap1+0x6d>
+  if(bn - ip->mapbn < ip->nmap && (addr = ip->map[bn - ip->mapbn]) != 0)
+80102294:	89 d0                	mov    %edx,%eax
+80102296:	2b 83 9c 00 00 00    	sub    0x9c(%ebx),%eax
+8010229c:	3b 83 a0 00 00 00    	cmp    0xa0(%ebx),%eax
+801022a2:	73 0f                	jae    801022b3 <bmap1+0x34>
+801022a4:	8b b4 83 a4 00 00 00 	mov    0xa4(%ebx,%eax,4),%esi
+801022ab:	85 f6                	test   %esi,%esi
+801022ad:	0f 85 54 01 00 00    	jne    80102407 <bmap1+0x188>
+  i = bn - NDIRECT;
+801022b3:	8d 47 f5             	lea    -0xb(%edi),%eax
+801022b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(i < NINDIRECT){
+801022b9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+801022be:	77 50                	ja     80102310 <bmap1+0x91>
+    if((addr = ip->addrs[NDIRECT]) == 0){
+801022c0:	8b b3 94 00 00 00    	mov    0x94(%ebx),%esi
+801022c6:	85 f6                	test   %esi,%esi
+801022c8:	0f 85 c8 00 00 00    	jne    80102396 <bmap1+0x117>
+      if(!alloc)
+801022ce:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801022d2:	0f 84 2f 01 00 00    	je     80102407 <bmap1+0x188>
+      ip->addrs[NDIRECT] = addr = iballoc(ip);
+801022d8:	89 d8                	mov    %ebx,%eax
+801022da:	e8 78 ff ff ff       	call   80102257 <iballoc>
+801022df:	89 c6                	mov    %eax,%esi
+801022e1:	89 83 94 00 00 00    	mov    %eax,0x94(%ebx)
+801022e7:	e9 aa 00 00 00       	jmp    80102396 <bmap1+0x117>
+    if((addr = ip->addrs[bn]) == 0 && alloc)
+801022ec:	8b 74 90 68          	mov    0x68(%eax,%edx,4),%esi
+801022f0:	85 f6                	test   %esi,%esi
+801022f2:	0f 85 0f 01 00 00    	jne    80102407 <bmap1+0x188>
+801022f8:	85 c9                	test   %ecx,%ecx
+801022fa:	0f 84 07 01 00 00    	je     80102407 <bmap1+0x188>
+      ip->addrs[bn] = addr = iballoc(ip);
+80102300:	e8 52 ff ff ff       	call   80102257 <iballoc>
+80102305:	89 c6                	mov    %eax,%esi
+80102307:	89 44 bb 68          	mov    %eax,0x68(%ebx,%edi,4)
+    return addr;
+8010230b:	e9 f7 00 00 00       	jmp    80102407 <bmap1+0x188>
+    i -= NINDIRECT;
+80102310:	8d 87 f5 fb ff ff    	lea    -0x40b(%edi),%eax
+80102316:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(i >= NDINDIRECT)
+80102319:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+8010231e:	0f 87 ed 00 00 00    	ja     80102411 <bmap1+0x192>
+    if((addr = ip->addrs[NDIRECT+1]) == 0){
+80102324:	8b b3 98 00 00 00    	mov    0x98(%ebx),%esi
+8010232a:	85 f6                	test   %esi,%esi
+8010232c:	75 19                	jne    80102347 <bmap1+0xc8>
+      if(!alloc)
+8010232e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+80102332:	0f 84 cf 00 00 00    	je     80102407 <bmap1+0x188>
+      ip->addrs[NDIRECT+1] = addr = iballoc(ip);
+80102338:	89 d8                	mov    %ebx,%eax
+8010233a:	e8 18 ff ff ff       	call   80102257 <iballoc>
+8010233f:	89 c6                	mov    %eax,%esi
+80102341:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+    bp = bread(ip->dev, addr);
+80102347:	83 ec 08             	sub    $0x8,%esp
+8010234a:	56                   	push   %esi
+8010234b:	ff 33                	push   (%ebx)
+8010234d:	e8 1a e5 ff ff       	call   8010086c <bread>
+80102352:	89 c1                	mov    %eax,%ecx
+80102354:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    if((addr = a[i/NINDIRECT]) == 0 && alloc){
+80102357:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010235a:	c1 e8 0a             	shr    $0xa,%eax
+8010235d:	c1 e0 02             	shl    $0x2,%eax
+80102360:	03 41 60             	add    0x60(%ecx),%eax
+80102363:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80102366:	8b 30                	mov    (%eax),%esi
+80102368:	83 c4 10             	add    $0x10,%esp
+8010236b:	85 f6                	test   %esi,%esi
+8010236d:	75 0a                	jne    80102379 <bmap1+0xfa>
+8010236f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+80102373:	0f 85 a5 00 00 00    	jne    8010241e <bmap1+0x19f>
+    brelse(bp);
+80102379:	83 ec 0c             	sub    $0xc,%esp
+8010237c:	ff 75 dc             	push   -0x24(%ebp)
+8010237f:	e8 b7 e5 ff ff       	call   8010093b <brelse>
+    if(addr == 0)
+80102384:	83 c4 10             	add    $0x10,%esp
+80102387:	85 f6                	test   %esi,%esi
+80102389:	74 7c                	je     80102407 <bmap1+0x188>
+    i %= NINDIRECT;
+8010238b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010238e:	25 ff 03 00 00       	and    $0x3ff,%eax
+80102393:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  bp = bread(ip->dev, addr);
+80102396:	83 ec 08             	sub    $0x8,%esp
+80102399:	56                   	push   %esi
+8010239a:	ff 33                	push   (%ebx)
+8010239c:	e8 cb e4 ff ff       	call   8010086c <bread>
+801023a1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  a = (uint*)bp->data;
+801023a4:	8b 40 60             	mov    0x60(%eax),%eax
+801023a7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  if((addr = a[i]) == 0 && alloc){
+801023aa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801023ad:	8d 04 90             	lea    (%eax,%edx,4),%eax
+801023b0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801023b3:	8b 30                	mov    (%eax),%esi
+801023b5:	83 c4 10             	add    $0x10,%esp
+801023b8:	85 f6                	test   %esi,%esi
+801023ba:	75 06                	jne    801023c2 <bmap1+0x143>
+801023bc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801023c0:	75 7d                	jne    8010243f <bmap1+0x1c0>
+  ip->mapbn = bn - i%NBMAP;
+801023c2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801023c5:	89 ca                	mov    %ecx,%edx
+801023c7:	83 e2 0f             	and    $0xf,%edx
+801023ca:	89 f8                	mov    %edi,%eax
+801023cc:	29 d0                	sub    %edx,%eax
+801023ce:	89 83 9c 00 00 00    	mov    %eax,0x9c(%ebx)
+  ip->nmap = NBMAP;
+801023d4:	c7 83 a0 00 00 00 10 	movl   $0x10,0xa0(%ebx)
+801023db:	00 00 00 
+  memmove(ip->map, a + i - i%NBMAP, sizeof(ip->map));
+801023de:	83 e1 f0             	and    $0xfffffff0,%ecx
+801023e1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801023e4:	8d 04 88             	lea    (%eax,%ecx,4),%eax
+801023e7:	81 c3 a4 00 00 00    	add    $0xa4,%ebx
+801023ed:	83 ec 04             	sub    $0x4,%esp
+801023f0:	6a 40                	push   $0x40
+801023f2:	50                   	push   %eax
+801023f3:	53                   	push   %ebx
+801023f4:	e8 f6 56 00 00       	call   80107aef <memmove>
+  brelse(bp);
+801023f9:	83 c4 04             	add    $0x4,%esp
+801023fc:	ff 75 dc             	push   -0x24(%ebp)
+801023ff:	e8 37 e5 ff ff       	call   8010093b <brelse>
+  return addr;
+80102404:	83 c4 10             	add    $0x10,%esp
+}
+80102407:	89 f0                	mov    %esi,%eax
+80102409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010240c:	5b                   	pop    %ebx
+8010240d:	5e                   	pop    %esi
+8010240e:	5f                   	pop    %edi
+8010240f:	5d                   	pop    %ebp
+80102410:	c3                   	ret
+      panic("bmap: out of range");
+80102411:	83 ec 0c             	sub    $0xc,%esp
+80102414:	68 3c b2 10 80       	push   $0x8010b23c
+80102419:	e8 08 e7 ff ff       	call   80100b26 <panic>
+      a[i/NINDIRECT] = addr = iballoc(ip);
+8010241e:	89 d8                	mov    %ebx,%eax
+80102420:	e8 32 fe ff ff       	call   80102257 <iballoc>
+80102425:	89 c6                	mov    %eax,%esi
+80102427:	8b 45 d8             	mov    -0x28(%ebp),%eax
+8010242a:	89 30                	mov    %esi,(%eax)
+      log_write(bp);
+8010242c:	83 ec 0c             	sub    $0xc,%esp
+8010242f:	ff 75 dc             	push   -0x24(%ebp)
+80102432:	e8 e9 23 00 00       	call   80104820 <log_write>
+80102437:	83 c4 10             	add    $0x10,%esp
+8010243a:	e9 3a ff ff ff       	jmp    80102379 <bmap1+0xfa>
+    a[i] = addr = iballoc(ip);
+8010243f:	89 d8                	mov    %ebx,%eax
+80102441:	e8 11 fe ff ff       	call   80102257 <iballoc>
+80102446:	89 c6                	mov    %eax,%esi
+80102448:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+8010244b:	89 30                	mov    %esi,(%eax)
+    log_write(bp);
+8010244d:	83 ec 0c             	sub    $0xc,%esp
+80102450:	ff 75 dc             	push   -0x24(%ebp)
+80102453:	e8 c8 23 00 00       	call   80104820 <log_write>
+80102458:	83 c4 10             	add    $0x10,%esp
+8010245b:	e9 62 ff ff ff       	jmp    801023c2 <bmap1+0x143>
+
+80102460 <bmap>:
+{
+80102460:	55                   	push   %ebp
+80102461:	89 e5                	mov    %esp,%ebp
+80102463:	83 ec 08             	sub    $0x8,%esp
+  return bmap1(ip, bn, 1);
+80102466:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010246b:	e8 0f fe ff ff       	call   8010227f <bmap1>
+}
+80102470:	c9                   	leave
+80102471:	c3                   	ret
+
+80102472 <bmappeek>:
+{
+80102472:	55                   	push   %ebp
+80102473:	89 e5                	mov    %esp,%ebp
+80102475:	83 ec 08             	sub    $0x8,%esp
+  return bmap1(ip, bn, 0);
+80102478:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010247d:	e8 fd fd ff ff       	call   8010227f <bmap1>
+}
+80102482:	c9                   	leave
+80102483:	c3                   	ret
+
+80102484 <igrow>:
+{
+80102484:	55                   	push   %ebp
+80102485:	89 e5                	mov    %esp,%ebp
+80102487:	56                   	push   %esi
+80102488:	53                   	push   %ebx
+  if((np = (struct inode*)kalloc()) == 0)
+80102489:	e8 02 1b 00 00       	call   80103f90 <kalloc>
+8010248e:	85 c0                	test   %eax,%eax
+80102490:	74 55                	je     801024e7 <igrow+0x63>
+80102492:	89 c6                	mov    %eax,%esi
+  memset(np, 0, PGSIZE);
+80102494:	83 ec 04             	sub    $0x4,%esp
+80102497:	68 00 10 00 00       	push   $0x1000
+8010249c:	6a 00                	push   $0x0
+8010249e:	50                   	push   %eax
+8010249f:	e8 d3 55 00 00       	call   80107a77 <memset>
+  for(ip = np; ip < np + PGSIZE/sizeof(*ip); ip++){
+801024a4:	83 c4 10             	add    $0x10,%esp
+801024a7:	89 f3                	mov    %esi,%ebx
+801024a9:	eb 26                	jmp    801024d1 <igrow+0x4d>
+    initsleeplock(&ip->lock, "inode");
+801024ab:	83 ec 08             	sub    $0x8,%esp
+801024ae:	68 4f b2 10 80       	push   $0x8010b24f
+801024b3:	8d 43 18             	lea    0x18(%ebx),%eax
+801024b6:	50                   	push   %eax
+801024b7:	e8 e7 52 00 00       	call   801077a3 <initsleeplock>
+    ilruadd(ip, 0);
+801024bc:	ba 00 00 00 00       	mov    $0x0,%edx
+801024c1:	89 d8                	mov    %ebx,%eax
+801024c3:	e8 58 f9 ff ff       	call   80101e20 <ilruadd>
+  for(ip = np; ip < np + PGSIZE/sizeof(*ip); ip++){
+801024c8:	81 c3 34 01 00 00    	add    $0x134,%ebx
+801024ce:	83 c4 10             	add    $0x10,%esp
+801024d1:	8d 86 a4 0f 00 00    	lea    0xfa4(%esi),%eax
+801024d7:	39 c3                	cmp    %eax,%ebx
+801024d9:	72 d0                	jb     801024ab <igrow+0x27>
+  return 1;
+801024db:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+801024e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801024e3:	5b                   	pop    %ebx
+801024e4:	5e                   	pop    %esi
+801024e5:	5d                   	pop    %ebp
+801024e6:	c3                   	ret
+    return 0;
+801024e7:	b8 00 00 00 00       	mov    $0x0,%eax
+801024ec:	eb f2                	jmp    801024e0 <igrow+0x5c>
+
+801024ee <dirindexfree>:
+{
+801024ee:	55                   	push   %ebp
+801024ef:	89 e5                	mov    %esp,%ebp
+801024f1:	56                   	push   %esi
+801024f2:	53                   	push   %ebx
+801024f3:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < dp->ndirhash; i++)
+801024f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+801024fa:	eb 15                	jmp    80102511 <dirindexfree+0x23>
+    kfree((char*)dp->dirhash[i]);
+801024fc:	83 ec 0c             	sub    $0xc,%esp
+801024ff:	ff b4 9e e8 00 00 00 	push   0xe8(%esi,%ebx,4)
+80102506:	e8 66 18 00 00       	call   80103d71 <kfree>
+  for(i = 0; i < dp->ndirhash; i++)
+8010250b:	83 c3 01             	add    $0x1,%ebx
+8010250e:	83 c4 10             	add    $0x10,%esp
+80102511:	39 9e 28 01 00 00    	cmp    %ebx,0x128(%esi)
+80102517:	7f e3                	jg     801024fc <dirindexfree+0xe>
+  dp->ndirhash = 0;
+80102519:	c7 86 28 01 00 00 00 	movl   $0x0,0x128(%esi)
+80102520:	00 00 00 
+}
+80102523:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102526:	5b                   	pop    %ebx
+80102527:	5e                   	pop    %esi
+80102528:	5d                   	pop    %ebp
+80102529:	c3                   	ret
+
+8010252a <iget>:
+{
+8010252a:	55                   	push   %ebp
+8010252b:	89 e5                	mov    %esp,%ebp
+8010252d:	57                   	push   %edi
+8010252e:	56                   	push   %esi
+8010252f:	53                   	push   %ebx
+80102530:	83 ec 1c             	sub    $0x1c,%esp
+80102533:	89 c6                	mov    %eax,%esi
+80102535:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102538:	89 d3                	mov    %edx,%ebx
+8010253a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  bk = ihash(dev, inum);
+8010253d:	e8 4a f7 ff ff       	call   80101c8c <ihash>
+80102542:	89 c7                	mov    %eax,%edi
+  acquire(&bk->lock);
+80102544:	83 ec 0c             	sub    $0xc,%esp
+80102547:	50                   	push   %eax
+80102548:	e8 7e 54 00 00       	call   801079cb <acquire>
+  ip = ilookup(bk, dev, inum);
+8010254d:	89 d9                	mov    %ebx,%ecx
+8010254f:	89 f2                	mov    %esi,%edx
+80102551:	89 f8                	mov    %edi,%eax
+80102553:	e8 50 f9 ff ff       	call   80101ea8 <ilookup>
+80102558:	89 c3                	mov    %eax,%ebx
+  release(&bk->lock);
+8010255a:	89 3c 24             	mov    %edi,(%esp)
+8010255d:	e8 ce 54 00 00       	call   80107a30 <release>
+  if(ip)
+80102562:	83 c4 10             	add    $0x10,%esp
+80102565:	85 db                	test   %ebx,%ebx
+80102567:	74 0a                	je     80102573 <iget+0x49>
+}
+80102569:	89 d8                	mov    %ebx,%eax
+8010256b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010256e:	5b                   	pop    %ebx
+8010256f:	5e                   	pop    %esi
+80102570:	5f                   	pop    %edi
+80102571:	5d                   	pop    %ebp
+80102572:	c3                   	ret
+  acquire(&icache.evictlock);
+80102573:	83 ec 0c             	sub    $0xc,%esp
+80102576:	68 48 8f 31 80       	push   $0x80318f48
+8010257b:	e8 4b 54 00 00       	call   801079cb <acquire>
+  acquire(&bk->lock);
+80102580:	89 3c 24             	mov    %edi,(%esp)
+80102583:	e8 43 54 00 00       	call   801079cb <acquire>
+  ip = ilookup(bk, dev, inum);
+80102588:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010258b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010258e:	89 f8                	mov    %edi,%eax
+80102590:	e8 13 f9 ff ff       	call   80101ea8 <ilookup>
+80102595:	89 c3                	mov    %eax,%ebx
+  release(&bk->lock);
+80102597:	89 3c 24             	mov    %edi,(%esp)
+8010259a:	e8 91 54 00 00       	call   80107a30 <release>
+  if(ip){
+8010259f:	83 c4 10             	add    $0x10,%esp
+801025a2:	85 db                	test   %ebx,%ebx
+801025a4:	74 1b                	je     801025c1 <iget+0x97>
+    release(&icache.evictlock);
+801025a6:	83 ec 0c             	sub    $0xc,%esp
+801025a9:	68 48 8f 31 80       	push   $0x80318f48
+801025ae:	e8 7d 54 00 00       	call   80107a30 <release>
+    return ip;
+801025b3:	83 c4 10             	add    $0x10,%esp
+801025b6:	eb b1                	jmp    80102569 <iget+0x3f>
+      if(igrow() == 0)
+801025b8:	e8 c7 fe ff ff       	call   80102484 <igrow>
+801025bd:	85 c0                	test   %eax,%eax
+801025bf:	74 56                	je     80102617 <iget+0xed>
+    acquire(&icache.lrulock);
+801025c1:	83 ec 0c             	sub    $0xc,%esp
+801025c4:	68 7c 8f 31 80       	push   $0x80318f7c
+801025c9:	e8 fd 53 00 00       	call   801079cb <acquire>
+    ip = icache.head.lprev;
+801025ce:	8b 1d c0 8f 31 80    	mov    0x80318fc0,%ebx
+    release(&icache.lrulock);
+801025d4:	c7 04 24 7c 8f 31 80 	movl   $0x80318f7c,(%esp)
+801025db:	e8 50 54 00 00       	call   80107a30 <release>
+    if(ip == &icache.head){
+801025e0:	83 c4 10             	add    $0x10,%esp
+801025e3:	81 fb b0 8f 31 80    	cmp    $0x80318fb0,%ebx
+801025e9:	74 cd                	je     801025b8 <iget+0x8e>
+    obk = ihash(ip->dev, ip->inum);
+801025eb:	8b 53 04             	mov    0x4(%ebx),%edx
+801025ee:	8b 03                	mov    (%ebx),%eax
+801025f0:	e8 97 f6 ff ff       	call   80101c8c <ihash>
+801025f5:	89 c6                	mov    %eax,%esi
+    acquire(&obk->lock);
+801025f7:	83 ec 0c             	sub    $0xc,%esp
+801025fa:	50                   	push   %eax
+801025fb:	e8 cb 53 00 00       	call   801079cb <acquire>
+    if(ip->ref == 0)
+80102600:	83 c4 10             	add    $0x10,%esp
+80102603:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+80102607:	74 1b                	je     80102624 <iget+0xfa>
+    release(&obk->lock);
+80102609:	83 ec 0c             	sub    $0xc,%esp
+8010260c:	56                   	push   %esi
+8010260d:	e8 1e 54 00 00       	call   80107a30 <release>
+80102612:	83 c4 10             	add    $0x10,%esp
+80102615:	eb aa                	jmp    801025c1 <iget+0x97>
+        panic("iget: no inodes");
+80102617:	83 ec 0c             	sub    $0xc,%esp
+8010261a:	68 55 b2 10 80       	push   $0x8010b255
+8010261f:	e8 02 e5 ff ff       	call   80100b26 <panic>
+  for(pp = &obk->head; *pp; pp = &(*pp)->hnext){
+80102624:	8d 56 34             	lea    0x34(%esi),%edx
+80102627:	eb 03                	jmp    8010262c <iget+0x102>
+80102629:	8d 50 0c             	lea    0xc(%eax),%edx
+8010262c:	8b 02                	mov    (%edx),%eax
+8010262e:	85 c0                	test   %eax,%eax
+80102630:	74 09                	je     8010263b <iget+0x111>
+    if(*pp == ip){
+80102632:	39 d8                	cmp    %ebx,%eax
+80102634:	75 f3                	jne    80102629 <iget+0xff>
+      *pp = ip->hnext;
+80102636:	8b 43 0c             	mov    0xc(%ebx),%eax
+80102639:	89 02                	mov    %eax,(%edx)
+  ilruremove(ip);
+8010263b:	89 d8                	mov    %ebx,%eax
+8010263d:	e8 30 f8 ff ff       	call   80101e72 <ilruremove>
+  ip->ref = 1;
+80102642:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+  release(&obk->lock);
+80102649:	83 ec 0c             	sub    $0xc,%esp
+8010264c:	56                   	push   %esi
+8010264d:	e8 de 53 00 00       	call   80107a30 <release>
+  dirindexfree(ip);
+80102652:	89 d8                	mov    %ebx,%eax
+80102654:	e8 95 fe ff ff       	call   801024ee <dirindexfree>
+  ip->dev = dev;
+80102659:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010265c:	89 03                	mov    %eax,(%ebx)
+  ip->inum = inum;
+8010265e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102661:	89 43 04             	mov    %eax,0x4(%ebx)
+  ip->valid = 0;
+80102664:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  acquire(&bk->lock);
+8010266b:	89 3c 24             	mov    %edi,(%esp)
+8010266e:	e8 58 53 00 00       	call   801079cb <acquire>
+  ip->hnext = bk->head;
+80102673:	8b 47 34             	mov    0x34(%edi),%eax
+80102676:	89 43 0c             	mov    %eax,0xc(%ebx)
+  bk->head = ip;
+80102679:	89 5f 34             	mov    %ebx,0x34(%edi)
+  release(&bk->lock);
+8010267c:	89 3c 24             	mov    %edi,(%esp)
+8010267f:	e8 ac 53 00 00       	call   80107a30 <release>
+  release(&icache.evictlock);
+80102684:	c7 04 24 48 8f 31 80 	movl   $0x80318f48,(%esp)
+8010268b:	e8 a0 53 00 00       	call   80107a30 <release>
+  return ip;
+80102690:	83 c4 10             	add    $0x10,%esp
+80102693:	e9 d1 fe ff ff       	jmp    80102569 <iget+0x3f>
+
+80102698 <dirindex>:
+{
+80102698:	55                   	push   %ebp
+80102699:	89 e5                	mov    %esp,%ebp
+8010269b:	57                   	push   %edi
+8010269c:	56                   	push   %esi
+8010269d:	53                   	push   %ebx
+8010269e:	83 ec 0c             	sub    $0xc,%esp
+801026a1:	89 c3                	mov    %eax,%ebx
+  dirindexfree(dp);
+801026a3:	e8 46 fe ff ff       	call   801024ee <dirindexfree>
+  if(dp->size <= DIRIDXMIN)
+801026a8:	8b 4b 64             	mov    0x64(%ebx),%ecx
+801026ab:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+801026b1:	76 7d                	jbe    80102730 <dirindex+0x98>
+  n = dp->size / sizeof(struct dirent);
+801026b3:	c1 e9 04             	shr    $0x4,%ecx
+  for(npg = 1; npg * DIRSLOTS < 4*n; npg *= 2)
+801026b6:	be 01 00 00 00       	mov    $0x1,%esi
+801026bb:	eb 02                	jmp    801026bf <dirindex+0x27>
+801026bd:	01 f6                	add    %esi,%esi
+801026bf:	89 f2                	mov    %esi,%edx
+801026c1:	c1 e2 0a             	shl    $0xa,%edx
+801026c4:	8d 04 8d 00 00 00 00 	lea    0x0(,%ecx,4),%eax
+801026cb:	39 c2                	cmp    %eax,%edx
+801026cd:	72 ee                	jb     801026bd <dirindex+0x25>
+  if(npg > NDIRHASH)
+801026cf:	83 fe 10             	cmp    $0x10,%esi
+801026d2:	7f 5c                	jg     80102730 <dirindex+0x98>
+  for(dp->ndirhash = 0; dp->ndirhash < npg; dp->ndirhash++){
+801026d4:	c7 83 28 01 00 00 00 	movl   $0x0,0x128(%ebx)
+801026db:	00 00 00 
+801026de:	eb 2f                	jmp    8010270f <dirindex+0x77>
+    memset(dp->dirhash[dp->ndirhash], 0, PGSIZE);
+801026e0:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+801026e6:	8b 84 83 e8 00 00 00 	mov    0xe8(%ebx,%eax,4),%eax
+801026ed:	83 ec 04             	sub    $0x4,%esp
+801026f0:	68 00 10 00 00       	push   $0x1000
+801026f5:	6a 00                	push   $0x0
+801026f7:	50                   	push   %eax
+801026f8:	e8 7a 53 00 00       	call   80107a77 <memset>
+  for(dp->ndirhash = 0; dp->ndirhash < npg; dp->ndirhash++){
+801026fd:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+80102703:	83 c0 01             	add    $0x1,%eax
+80102706:	89 83 28 01 00 00    	mov    %eax,0x128(%ebx)
+8010270c:	83 c4 10             	add    $0x10,%esp
+8010270f:	8b bb 28 01 00 00    	mov    0x128(%ebx),%edi
+80102715:	39 f7                	cmp    %esi,%edi
+80102717:	7d 1f                	jge    80102738 <dirindex+0xa0>
+    if((dp->dirhash[dp->ndirhash] = (uint*)kalloc()) == 0){
+80102719:	e8 72 18 00 00       	call   80103f90 <kalloc>
+8010271e:	89 84 bb e8 00 00 00 	mov    %eax,0xe8(%ebx,%edi,4)
+80102725:	85 c0                	test   %eax,%eax
+80102727:	75 b7                	jne    801026e0 <dirindex+0x48>
+      dirindexfree(dp);
+80102729:	89 d8                	mov    %ebx,%eax
+8010272b:	e8 be fd ff ff       	call   801024ee <dirindexfree>
+}
+80102730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102733:	5b                   	pop    %ebx
+80102734:	5e                   	pop    %esi
+80102735:	5f                   	pop    %edi
+80102736:	5d                   	pop    %ebp
+80102737:	c3                   	ret
+  dp->dirused = 0;
+80102738:	c7 83 2c 01 00 00 00 	movl   $0x0,0x12c(%ebx)
+8010273f:	00 00 00 
+  dp->dirfree = dp->size;
+80102742:	8b 43 64             	mov    0x64(%ebx),%eax
+80102745:	89 83 30 01 00 00    	mov    %eax,0x130(%ebx)
+  bp = 0;
+8010274b:	bf 00 00 00 00       	mov    $0x0,%edi
+  for(off = 0; off < dp->size; off += sizeof(*de)){
+80102750:	be 00 00 00 00       	mov    $0x0,%esi
+80102755:	eb 39                	jmp    80102790 <dirindex+0xf8>
+        brelse(bp);
+80102757:	83 ec 0c             	sub    $0xc,%esp
+8010275a:	57                   	push   %edi
+8010275b:	e8 db e1 ff ff       	call   8010093b <brelse>
+80102760:	83 c4 10             	add    $0x10,%esp
+      bp = bread(dp->dev, bmap(dp, off / BSIZE));
+80102763:	89 f2                	mov    %esi,%edx
+80102765:	c1 ea 0c             	shr    $0xc,%edx
+80102768:	89 d8                	mov    %ebx,%eax
+8010276a:	e8 f1 fc ff ff       	call   80102460 <bmap>
+8010276f:	83 ec 08             	sub    $0x8,%esp
+80102772:	50                   	push   %eax
+80102773:	ff 33                	push   (%ebx)
+80102775:	e8 f2 e0 ff ff       	call   8010086c <bread>
+8010277a:	89 c7                	mov    %eax,%edi
+8010277c:	83 c4 10             	add    $0x10,%esp
+8010277f:	eb 20                	jmp    801027a1 <dirindex+0x109>
+      dirindexadd(dp, de->name, off);
+80102781:	83 c2 02             	add    $0x2,%edx
+80102784:	89 f1                	mov    %esi,%ecx
+80102786:	89 d8                	mov    %ebx,%eax
+80102788:	e8 82 f5 ff ff       	call   80101d0f <dirindexadd>
+  for(off = 0; off < dp->size; off += sizeof(*de)){
+8010278d:	83 c6 10             	add    $0x10,%esi
+80102790:	3b 73 64             	cmp    0x64(%ebx),%esi
+80102793:	73 2d                	jae    801027c2 <dirindex+0x12a>
+    if(bp == 0 || off % BSIZE == 0){
+80102795:	85 ff                	test   %edi,%edi
+80102797:	74 ca                	je     80102763 <dirindex+0xcb>
+80102799:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+8010279f:	74 b6                	je     80102757 <dirindex+0xbf>
+    de = (struct dirent*)(bp->data + off % BSIZE);
+801027a1:	89 f2                	mov    %esi,%edx
+801027a3:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+801027a9:	03 57 60             	add    0x60(%edi),%edx
+    if(de->inum != 0)
+801027ac:	66 83 3a 00          	cmpw   $0x0,(%edx)
+801027b0:	75 cf                	jne    80102781 <dirindex+0xe9>
+    else if(off < dp->dirfree)
+801027b2:	3b b3 30 01 00 00    	cmp    0x130(%ebx),%esi
+801027b8:	73 d3                	jae    8010278d <dirindex+0xf5>
+      dp->dirfree = off;
+801027ba:	89 b3 30 01 00 00    	mov    %esi,0x130(%ebx)
+801027c0:	eb cb                	jmp    8010278d <dirindex+0xf5>
+  if(bp)
+801027c2:	85 ff                	test   %edi,%edi
+801027c4:	0f 84 66 ff ff ff    	je     80102730 <dirindex+0x98>
+    brelse(bp);
+801027ca:	83 ec 0c             	sub    $0xc,%esp
+801027cd:	57                   	push   %edi
+801027ce:	e8 68 e1 ff ff       	call   8010093b <brelse>
+801027d3:	83 c4 10             	add    $0x10,%esp
+801027d6:	e9 55 ff ff ff       	jmp    80102730 <dirindex+0x98>
+
+801027db <dcacheput>:
+{
+801027db:	55                   	push   %ebp
+801027dc:	89 e5                	mov    %esp,%ebp
+801027de:	57                   	push   %edi
+801027df:	56                   	push   %esi
+801027e0:	53                   	push   %ebx
+801027e1:	83 ec 18             	sub    $0x18,%esp
+801027e4:	89 c3                	mov    %eax,%ebx
+801027e6:	89 d6                	mov    %edx,%esi
+801027e8:	89 cf                	mov    %ecx,%edi
+  acquire(&dcache.lock);
+801027ea:	68 a0 cd 31 80       	push   $0x8031cda0
+801027ef:	e8 d7 51 00 00       	call   801079cb <acquire>
+  e = dcentry(dp, name);
+801027f4:	89 f2                	mov    %esi,%edx
+801027f6:	89 d8                	mov    %ebx,%eax
+801027f8:	e8 81 f5 ff ff       	call   80101d7e <dcentry>
+  e->dev = dp->dev;
+801027fd:	8b 13                	mov    (%ebx),%edx
+801027ff:	89 10                	mov    %edx,(%eax)
+  e->dir = dp->inum;
+80102801:	8b 53 04             	mov    0x4(%ebx),%edx
+80102804:	89 50 04             	mov    %edx,0x4(%eax)
+  e->inum = inum;
+80102807:	89 78 08             	mov    %edi,0x8(%eax)
+  strncpy(e->name, name, DIRSIZ);
+8010280a:	83 c0 0c             	add    $0xc,%eax
+8010280d:	83 c4 0c             	add    $0xc,%esp
+80102810:	6a 0e                	push   $0xe
+80102812:	56                   	push   %esi
+80102813:	50                   	push   %eax
+80102814:	e8 81 53 00 00       	call   80107b9a <strncpy>
+  release(&dcache.lock);
+80102819:	c7 04 24 a0 cd 31 80 	movl   $0x8031cda0,(%esp)
+80102820:	e8 0b 52 00 00       	call   80107a30 <release>
+}
+80102825:	83 c4 10             	add    $0x10,%esp
+80102828:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010282b:	5b                   	pop    %ebx
+8010282c:	5e                   	pop    %esi
+8010282d:	5f                   	pop    %edi
+8010282e:	5d                   	pop    %ebp
+8010282f:	c3                   	ret
+
+80102830 <readsb>:
+{
+80102830:	55                   	push   %ebp
+80102831:	89 e5                	mov    %esp,%ebp
+80102833:	53                   	push   %ebx
+80102834:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, 1);
+80102837:	6a 01                	push   $0x1
+80102839:	ff 75 08             	push   0x8(%ebp)
+8010283c:	e8 2b e0 ff ff       	call   8010086c <bread>
+80102841:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80102843:	8b 40 60             	mov    0x60(%eax),%eax
+80102846:	83 c4 0c             	add    $0xc,%esp
+80102849:	6a 20                	push   $0x20
+8010284b:	50                   	push   %eax
+8010284c:	ff 75 0c             	push   0xc(%ebp)
+8010284f:	e8 9b 52 00 00       	call   80107aef <memmove>
+  brelse(bp);
+80102854:	89 1c 24             	mov    %ebx,(%esp)
+80102857:	e8 df e0 ff ff       	call   8010093b <brelse>
+}
+8010285c:	83 c4 10             	add    $0x10,%esp
+8010285f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102862:	c9                   	leave
+80102863:	c3                   	ret
+
+80102864 <iinit>:
+{
+80102864:	55                   	push   %ebp
+80102865:	89 e5                	mov    %esp,%ebp
+80102867:	56                   	push   %esi
+80102868:	53                   	push   %ebx
+  for(i = 0; i < NIBUCKET; i++)
+80102869:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010286e:	eb 1c                	jmp    8010288c <iinit+0x28>
+    initlock(&icache.bucket[i].lock, "icache.bucket");
+80102870:	83 ec 08             	sub    $0x8,%esp
+80102873:	68 65 b2 10 80       	push   $0x8010b265
+80102878:	6b c3 38             	imul   $0x38,%ebx,%eax
+8010287b:	05 80 88 31 80       	add    $0x80318880,%eax
+80102880:	50                   	push   %eax
+80102881:	e8 01 50 00 00       	call   80107887 <initlock>
+  for(i = 0; i < NIBUCKET; i++)
+80102886:	83 c3 01             	add    $0x1,%ebx
+80102889:	83 c4 10             	add    $0x10,%esp
+8010288c:	83 fb 1e             	cmp    $0x1e,%ebx
+8010288f:	7e df                	jle    80102870 <iinit+0xc>
+  initlock(&icache.evictlock, "icache.evict");
+80102891:	83 ec 08             	sub    $0x8,%esp
+80102894:	68 73 b2 10 80       	push   $0x8010b273
+80102899:	68 48 8f 31 80       	push   $0x80318f48
+8010289e:	e8 e4 4f 00 00       	call   80107887 <initlock>
+  initlock(&icache.lrulock, "icache.lru");
+801028a3:	83 c4 08             	add    $0x8,%esp
+801028a6:	68 80 b2 10 80       	push   $0x8010b280
+801028ab:	68 7c 8f 31 80       	push   $0x80318f7c
+801028b0:	e8 d2 4f 00 00       	call   80107887 <initlock>
+  initlock(&dcache.lock, "dcache");
+801028b5:	83 c4 08             	add    $0x8,%esp
+801028b8:	68 8b b2 10 80       	push   $0x8010b28b
+801028bd:	68 a0 cd 31 80       	push   $0x8031cda0
+801028c2:	e8 c0 4f 00 00       	call   80107887 <initlock>
+  icache.head.lprev = &icache.head;
+801028c7:	c7 05 c0 8f 31 80 b0 	movl   $0x80318fb0,0x80318fc0
+801028ce:	8f 31 80 
+  icache.head.lnext = &icache.head;
+801028d1:	c7 05 c4 8f 31 80 b0 	movl   $0x80318fb0,0x80318fc4
+801028d8:	8f 31 80 
+  for(i = 0; i < NINODE; i++) {
+801028db:	83 c4 10             	add    $0x10,%esp
+801028de:	be 00 00 00 00       	mov    $0x0,%esi
+801028e3:	eb 30                	jmp    80102915 <iinit+0xb1>
+    initsleeplock(&icache.inode[i].lock, "inode");
+801028e5:	83 ec 08             	sub    $0x8,%esp
+801028e8:	68 4f b2 10 80       	push   $0x8010b24f
+801028ed:	69 de 34 01 00 00    	imul   $0x134,%esi,%ebx
+801028f3:	8d 83 fc 90 31 80    	lea    -0x7fce6f04(%ebx),%eax
+801028f9:	50                   	push   %eax
+801028fa:	e8 a4 4e 00 00       	call   801077a3 <initsleeplock>
+    ilruadd(&icache.inode[i], 0);
+801028ff:	8d 83 e4 90 31 80    	lea    -0x7fce6f1c(%ebx),%eax
+80102905:	ba 00 00 00 00       	mov    $0x0,%edx
+8010290a:	e8 11 f5 ff ff       	call   80101e20 <ilruadd>
+  for(i = 0; i < NINODE; i++) {
+8010290f:	83 c6 01             	add    $0x1,%esi
+80102912:	83 c4 10             	add    $0x10,%esp
+80102915:	83 fe 31             	cmp    $0x31,%esi
+80102918:	7e cb                	jle    801028e5 <iinit+0x81>
+  readsb(dev, &sb);
+8010291a:	83 ec 08             	sub    $0x8,%esp
+8010291d:	68 20 cd 31 80       	push   $0x8031cd20
+80102922:	ff 75 08             	push   0x8(%ebp)
+80102925:	e8 06 ff ff ff       	call   80102830 <readsb>
+  if(sb.bsize != BSIZE)
+8010292a:	83 c4 10             	add    $0x10,%esp
+8010292d:	81 3d 3c cd 31 80 00 	cmpl   $0x1000,0x8031cd3c
+80102934:	10 00 00 
+80102937:	75 3e                	jne    80102977 <iinit+0x113>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80102939:	ff 35 38 cd 31 80    	push   0x8031cd38
+8010293f:	ff 35 34 cd 31 80    	push   0x8031cd34
+80102945:	ff 35 30 cd 31 80    	push   0x8031cd30
+8010294b:	ff 35 2c cd 31 80    	push   0x8031cd2c
+80102951:	ff 35 28 cd 31 80    	push   0x8031cd28
+80102957:	ff 35 24 cd 31 80    	push   0x8031cd24
+8010295d:	ff 35 20 cd 31 80    	push   0x8031cd20
+80102963:	68 74 b3 10 80       	push   $0x8010b374
+80102968:	e8 7a e4 ff ff       	call   80100de7 <cprintf>
+}
+8010296d:	83 c4 20             	add    $0x20,%esp
+80102970:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102973:	5b                   	pop    %ebx
+80102974:	5e                   	pop    %esi
+80102975:	5d                   	pop    %ebp
+80102976:	c3                   	ret
+    panic("iinit: block size");
+80102977:	83 ec 0c             	sub    $0xc,%esp
+8010297a:	68 92 b2 10 80       	push   $0x8010b292
+8010297f:	e8 a2 e1 ff ff       	call   80100b26 <panic>
+
+80102984 <iinit2>:
+{
+80102984:	55                   	push   %ebp
+80102985:	89 e5                	mov    %esp,%ebp
+80102987:	57                   	push   %edi
+80102988:	56                   	push   %esi
+80102989:	53                   	push   %ebx
+8010298a:	83 ec 0c             	sub    $0xc,%esp
+8010298d:	8b 75 08             	mov    0x8(%ebp),%esi
+  bsum.ngroup = (sb.size + BGROUP - 1) / BGROUP;
+80102990:	a1 20 cd 31 80       	mov    0x8031cd20,%eax
+80102995:	05 ff 00 00 00       	add    $0xff,%eax
+8010299a:	c1 e8 08             	shr    $0x8,%eax
+8010299d:	a3 14 ea 31 80       	mov    %eax,0x8031ea14
+  if(bsum.ngroup > NBGROUP)
+801029a2:	83 f8 10             	cmp    $0x10,%eax
+801029a5:	7f 21                	jg     801029c8 <iinit2+0x44>
+  initlock(&bsum.lock, "bsum");
+801029a7:	83 ec 08             	sub    $0x8,%esp
+801029aa:	68 c0 b2 10 80       	push   $0x8010b2c0
+801029af:	68 e0 e9 31 80       	push   $0x8031e9e0
+801029b4:	e8 ce 4e 00 00       	call   80107887 <initlock>
+  for(b = 0; b < sb.size; b++){
+801029b9:	83 c4 10             	add    $0x10,%esp
+801029bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  bp = 0;
+801029c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  for(b = 0; b < sb.size; b++){
+801029c6:	eb 59                	jmp    80102a21 <iinit2+0x9d>
+    panic("iinit2: file system too big");
+801029c8:	83 ec 0c             	sub    $0xc,%esp
+801029cb:	68 a4 b2 10 80       	push   $0x8010b2a4
+801029d0:	e8 51 e1 ff ff       	call   80100b26 <panic>
+      bp = bread(dev, BBLOCK(b, sb));
+801029d5:	89 d8                	mov    %ebx,%eax
+801029d7:	c1 e8 0f             	shr    $0xf,%eax
+801029da:	83 ec 08             	sub    $0x8,%esp
+801029dd:	03 05 38 cd 31 80    	add    0x8031cd38,%eax
+801029e3:	50                   	push   %eax
+801029e4:	56                   	push   %esi
+801029e5:	e8 82 de ff ff       	call   8010086c <bread>
+801029ea:	89 c2                	mov    %eax,%edx
+801029ec:	83 c4 10             	add    $0x10,%esp
+    if((bp->data[(b % BPB)/8] & (1 << (b % 8))) == 0)
+801029ef:	8b 42 60             	mov    0x60(%edx),%eax
+801029f2:	c1 ef 03             	shr    $0x3,%edi
+801029f5:	0f b6 04 38          	movzbl (%eax,%edi,1),%eax
+801029f9:	89 d9                	mov    %ebx,%ecx
+801029fb:	83 e1 07             	and    $0x7,%ecx
+801029fe:	d3 f8                	sar    %cl,%eax
+80102a00:	a8 01                	test   $0x1,%al
+80102a02:	75 1a                	jne    80102a1e <iinit2+0x9a>
+      bsum.nfree[b / BGROUP]++;
+80102a04:	89 d8                	mov    %ebx,%eax
+80102a06:	c1 e8 08             	shr    $0x8,%eax
+80102a09:	b9 e0 e9 31 80       	mov    $0x8031e9e0,%ecx
+80102a0e:	83 c0 18             	add    $0x18,%eax
+80102a11:	0f b7 7c 41 08       	movzwl 0x8(%ecx,%eax,2),%edi
+80102a16:	83 c7 01             	add    $0x1,%edi
+80102a19:	66 89 7c 41 08       	mov    %di,0x8(%ecx,%eax,2)
+  for(b = 0; b < sb.size; b++){
+80102a1e:	83 c3 01             	add    $0x1,%ebx
+80102a21:	3b 1d 20 cd 31 80    	cmp    0x8031cd20,%ebx
+80102a27:	73 1c                	jae    80102a45 <iinit2+0xc1>
+    if(b % BPB == 0){
+80102a29:	89 df                	mov    %ebx,%edi
+80102a2b:	81 e7 ff 7f 00 00    	and    $0x7fff,%edi
+80102a31:	75 bc                	jne    801029ef <iinit2+0x6b>
+      if(bp)
+80102a33:	85 d2                	test   %edx,%edx
+80102a35:	74 9e                	je     801029d5 <iinit2+0x51>
+        brelse(bp);
+80102a37:	83 ec 0c             	sub    $0xc,%esp
+80102a3a:	52                   	push   %edx
+80102a3b:	e8 fb de ff ff       	call   8010093b <brelse>
+80102a40:	83 c4 10             	add    $0x10,%esp
+80102a43:	eb 90                	jmp    801029d5 <iinit2+0x51>
+  brelse(bp);
+80102a45:	83 ec 0c             	sub    $0xc,%esp
+80102a48:	52                   	push   %edx
+80102a49:	e8 ed de ff ff       	call   8010093b <brelse>
+  if(sb.ninodes > NINODES)
+80102a4e:	83 c4 10             	add    $0x10,%esp
+80102a51:	81 3d 28 cd 31 80 c8 	cmpl   $0xc8,0x8031cd28
+80102a58:	00 00 00 
+80102a5b:	77 2b                	ja     80102a88 <iinit2+0x104>
+  initlock(&ifree.lock, "ifree");
+80102a5d:	83 ec 08             	sub    $0x8,%esp
+80102a60:	68 dd b2 10 80       	push   $0x8010b2dd
+80102a65:	68 40 cd 31 80       	push   $0x8031cd40
+80102a6a:	e8 18 4e 00 00       	call   80107887 <initlock>
+  ifree.inext = 1;
+80102a6f:	c7 05 74 cd 31 80 01 	movl   $0x1,0x8031cd74
+80102a76:	00 00 00 
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102a79:	83 c4 10             	add    $0x10,%esp
+80102a7c:	bb 01 00 00 00       	mov    $0x1,%ebx
+  bp = 0;
+80102a81:	ba 00 00 00 00       	mov    $0x0,%edx
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102a86:	eb 38                	jmp    80102ac0 <iinit2+0x13c>
+    panic("iinit2: too many inodes");
+80102a88:	83 ec 0c             	sub    $0xc,%esp
+80102a8b:	68 c5 b2 10 80       	push   $0x8010b2c5
+80102a90:	e8 91 e0 ff ff       	call   80100b26 <panic>
+        brelse(bp);
+80102a95:	83 ec 0c             	sub    $0xc,%esp
+80102a98:	52                   	push   %edx
+80102a99:	e8 9d de ff ff       	call   8010093b <brelse>
+80102a9e:	83 c4 10             	add    $0x10,%esp
+      bp = bread(dev, IBLOCK(inum, sb));
+80102aa1:	89 d8                	mov    %ebx,%eax
+80102aa3:	c1 e8 06             	shr    $0x6,%eax
+80102aa6:	83 ec 08             	sub    $0x8,%esp
+80102aa9:	03 05 34 cd 31 80    	add    0x8031cd34,%eax
+80102aaf:	50                   	push   %eax
+80102ab0:	56                   	push   %esi
+80102ab1:	e8 b6 dd ff ff       	call   8010086c <bread>
+80102ab6:	89 c2                	mov    %eax,%edx
+80102ab8:	83 c4 10             	add    $0x10,%esp
+80102abb:	eb 14                	jmp    80102ad1 <iinit2+0x14d>
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102abd:	83 c3 01             	add    $0x1,%ebx
+80102ac0:	3b 1d 28 cd 31 80    	cmp    0x8031cd28,%ebx
+80102ac6:	73 31                	jae    80102af9 <iinit2+0x175>
+    if(bp == 0 || inum % IPB == 0){
+80102ac8:	85 d2                	test   %edx,%edx
+80102aca:	74 d5                	je     80102aa1 <iinit2+0x11d>
+80102acc:	f6 c3 3f             	test   $0x3f,%bl
+80102acf:	74 c4                	je     80102a95 <iinit2+0x111>
+    dip = (struct dinode*)bp->data + inum%IPB;
+80102ad1:	89 d8                	mov    %ebx,%eax
+80102ad3:	83 e0 3f             	and    $0x3f,%eax
+80102ad6:	c1 e0 06             	shl    $0x6,%eax
+80102ad9:	03 42 60             	add    0x60(%edx),%eax
+    if(dip->type == 0)
+80102adc:	66 83 38 00          	cmpw   $0x0,(%eax)
+80102ae0:	75 db                	jne    80102abd <iinit2+0x139>
+      ifree.map[inum/32] |= 1U << (inum%32);
+80102ae2:	89 df                	mov    %ebx,%edi
+80102ae4:	c1 ef 05             	shr    $0x5,%edi
+80102ae7:	b8 01 00 00 00       	mov    $0x1,%eax
+80102aec:	89 d9                	mov    %ebx,%ecx
+80102aee:	d3 e0                	shl    %cl,%eax
+80102af0:	09 04 bd 78 cd 31 80 	or     %eax,-0x7fce3288(,%edi,4)
+80102af7:	eb c4                	jmp    80102abd <iinit2+0x139>
+  if(bp)
+80102af9:	85 d2                	test   %edx,%edx
+80102afb:	74 0c                	je     80102b09 <iinit2+0x185>
+    brelse(bp);
+80102afd:	83 ec 0c             	sub    $0xc,%esp
+80102b00:	52                   	push   %edx
+80102b01:	e8 35 de ff ff       	call   8010093b <brelse>
+80102b06:	83 c4 10             	add    $0x10,%esp
+}
+80102b09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102b0c:	5b                   	pop    %ebx
+80102b0d:	5e                   	pop    %esi
+80102b0e:	5f                   	pop    %edi
+80102b0f:	5d                   	pop    %ebp
+80102b10:	c3                   	ret
+
+80102b11 <ialloc>:
+{
+80102b11:	55                   	push   %ebp
+80102b12:	89 e5                	mov    %esp,%ebp
+80102b14:	57                   	push   %edi
+80102b15:	56                   	push   %esi
+80102b16:	53                   	push   %ebx
+80102b17:	83 ec 28             	sub    $0x28,%esp
+80102b1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102b1d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquire(&ifree.lock);
+80102b20:	68 40 cd 31 80       	push   $0x8031cd40
+80102b25:	e8 a1 4e 00 00       	call   801079cb <acquire>
+  for(inum = ifree.inext - ifree.inext%32; inum < sb.ninodes; inum += 32)
+80102b2a:	a1 74 cd 31 80       	mov    0x8031cd74,%eax
+80102b2f:	83 e0 e0             	and    $0xffffffe0,%eax
+80102b32:	83 c4 10             	add    $0x10,%esp
+  uint inum, w = 0;
+80102b35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(inum = ifree.inext - ifree.inext%32; inum < sb.ninodes; inum += 32)
+80102b3a:	eb 03                	jmp    80102b3f <ialloc+0x2e>
+80102b3c:	83 c0 20             	add    $0x20,%eax
+80102b3f:	8b 15 28 cd 31 80    	mov    0x8031cd28,%edx
+80102b45:	39 d0                	cmp    %edx,%eax
+80102b47:	73 10                	jae    80102b59 <ialloc+0x48>
+    if((w = ifree.map[inum/32]) != 0)
+80102b49:	89 c1                	mov    %eax,%ecx
+80102b4b:	c1 e9 05             	shr    $0x5,%ecx
+80102b4e:	8b 1c 8d 78 cd 31 80 	mov    -0x7fce3288(,%ecx,4),%ebx
+80102b55:	85 db                	test   %ebx,%ebx
+80102b57:	74 e3                	je     80102b3c <ialloc+0x2b>
+  if(inum >= sb.ninodes)
+80102b59:	39 d0                	cmp    %edx,%eax
+80102b5b:	0f 83 95 00 00 00    	jae    80102bf6 <ialloc+0xe5>
+  inum += __builtin_ctz(w);
+80102b61:	f3 0f bc db          	tzcnt  %ebx,%ebx
+80102b65:	01 c3                	add    %eax,%ebx
+  ifree.map[inum/32] &= ~(1U << (inum%32));
+80102b67:	89 da                	mov    %ebx,%edx
+80102b69:	c1 ea 05             	shr    $0x5,%edx
+80102b6c:	b8 01 00 00 00       	mov    $0x1,%eax
+80102b71:	89 d9                	mov    %ebx,%ecx
+80102b73:	d3 e0                	shl    %cl,%eax
+80102b75:	f7 d0                	not    %eax
+80102b77:	21 04 95 78 cd 31 80 	and    %eax,-0x7fce3288(,%edx,4)
+  ifree.inext = inum + 1;
+80102b7e:	8d 43 01             	lea    0x1(%ebx),%eax
+80102b81:	a3 74 cd 31 80       	mov    %eax,0x8031cd74
+  release(&ifree.lock);
+80102b86:	83 ec 0c             	sub    $0xc,%esp
+80102b89:	68 40 cd 31 80       	push   $0x8031cd40
+80102b8e:	e8 9d 4e 00 00       	call   80107a30 <release>
+  bp = bread(dev, IBLOCK(inum, sb));
+80102b93:	89 d8                	mov    %ebx,%eax
+80102b95:	c1 e8 06             	shr    $0x6,%eax
+80102b98:	83 c4 08             	add    $0x8,%esp
+80102b9b:	03 05 34 cd 31 80    	add    0x8031cd34,%eax
+80102ba1:	50                   	push   %eax
+80102ba2:	ff 75 08             	push   0x8(%ebp)
+80102ba5:	e8 c2 dc ff ff       	call   8010086c <bread>
+80102baa:	89 c7                	mov    %eax,%edi
+  dip = (struct dinode*)bp->data + inum%IPB;
+80102bac:	89 de                	mov    %ebx,%esi
+80102bae:	83 e6 3f             	and    $0x3f,%esi
+80102bb1:	c1 e6 06             	shl    $0x6,%esi
+80102bb4:	03 70 60             	add    0x60(%eax),%esi
+  if(dip->type != 0)
+80102bb7:	83 c4 10             	add    $0x10,%esp
+80102bba:	66 83 3e 00          	cmpw   $0x0,(%esi)
+80102bbe:	75 43                	jne    80102c03 <ialloc+0xf2>
+  memset(dip, 0, sizeof(*dip));
+80102bc0:	83 ec 04             	sub    $0x4,%esp
+80102bc3:	6a 40                	push   $0x40
+80102bc5:	6a 00                	push   $0x0
+80102bc7:	56                   	push   %esi
+80102bc8:	e8 aa 4e 00 00       	call   80107a77 <memset>
+  dip->type = type;
+80102bcd:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+80102bd1:	66 89 06             	mov    %ax,(%esi)
+  log_write(bp);   // mark it allocated on the disk
+80102bd4:	89 3c 24             	mov    %edi,(%esp)
+80102bd7:	e8 44 1c 00 00       	call   80104820 <log_write>
+  brelse(bp);
+80102bdc:	89 3c 24             	mov    %edi,(%esp)
+80102bdf:	e8 57 dd ff ff       	call   8010093b <brelse>
+  return iget(dev, inum);
+80102be4:	89 da                	mov    %ebx,%edx
+80102be6:	8b 45 08             	mov    0x8(%ebp),%eax
+80102be9:	e8 3c f9 ff ff       	call   8010252a <iget>
+}
+80102bee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102bf1:	5b                   	pop    %ebx
+80102bf2:	5e                   	pop    %esi
+80102bf3:	5f                   	pop    %edi
+80102bf4:	5d                   	pop    %ebp
+80102bf5:	c3                   	ret
+    panic("ialloc: no inodes");
+80102bf6:	83 ec 0c             	sub    $0xc,%esp
+80102bf9:	68 e3 b2 10 80       	push   $0x8010b2e3
+80102bfe:	e8 23 df ff ff       	call   80100b26 <panic>
+    panic("ialloc: inode in use");
+80102c03:	83 ec 0c             	sub    $0xc,%esp
+80102c06:	68 f5 b2 10 80       	push   $0x8010b2f5
+80102c0b:	e8 16 df ff ff       	call   80100b26 <panic>
+
+80102c10 <iupdate>:
+{
+80102c10:	55                   	push   %ebp
+80102c11:	89 e5                	mov    %esp,%ebp
+80102c13:	56                   	push   %esi
+80102c14:	53                   	push   %ebx
+80102c15:	8b 75 08             	mov    0x8(%ebp),%esi
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102c18:	8b 46 04             	mov    0x4(%esi),%eax
+80102c1b:	c1 e8 06             	shr    $0x6,%eax
+80102c1e:	83 ec 08             	sub    $0x8,%esp
+80102c21:	03 05 34 cd 31 80    	add    0x8031cd34,%eax
+80102c27:	50                   	push   %eax
+80102c28:	ff 36                	push   (%esi)
+80102c2a:	e8 3d dc ff ff       	call   8010086c <bread>
+80102c2f:	89 c3                	mov    %eax,%ebx
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+80102c31:	8b 46 04             	mov    0x4(%esi),%eax
+80102c34:	83 e0 3f             	and    $0x3f,%eax
+80102c37:	c1 e0 06             	shl    $0x6,%eax
+80102c3a:	03 43 60             	add    0x60(%ebx),%eax
+  dip->type = ip->type;
+80102c3d:	0f b7 56 5c          	movzwl 0x5c(%esi),%edx
+80102c41:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+80102c44:	0f b7 56 5e          	movzwl 0x5e(%esi),%edx
+80102c48:	66 89 50 02          	mov    %dx,0x2(%eax)
+  dip->minor = ip->minor;
+80102c4c:	0f b7 56 60          	movzwl 0x60(%esi),%edx
+80102c50:	66 89 50 04          	mov    %dx,0x4(%eax)
+  dip->nlink = ip->nlink;
+80102c54:	0f b7 56 62          	movzwl 0x62(%esi),%edx
+80102c58:	66 89 50 06          	mov    %dx,0x6(%eax)
+  dip->size = ip->size;
+80102c5c:	8b 56 64             	mov    0x64(%esi),%edx
+80102c5f:	89 50 08             	mov    %edx,0x8(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102c62:	8d 56 68             	lea    0x68(%esi),%edx
+80102c65:	83 c0 0c             	add    $0xc,%eax
+80102c68:	83 c4 0c             	add    $0xc,%esp
+80102c6b:	6a 34                	push   $0x34
+80102c6d:	52                   	push   %edx
+80102c6e:	50                   	push   %eax
+80102c6f:	e8 7b 4e 00 00       	call   80107aef <memmove>
+  log_write(bp);
+80102c74:	89 1c 24             	mov    %ebx,(%esp)
+80102c77:	e8 a4 1b 00 00       	call   80104820 <log_write>
+  brelse(bp);
+80102c7c:	89 1c 24             	mov    %ebx,(%esp)
+80102c7f:	e8 b7 dc ff ff       	call   8010093b <brelse>
+}
+80102c84:	83 c4 10             	add    $0x10,%esp
+80102c87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102c8a:	5b                   	pop    %ebx
+80102c8b:	5e                   	pop    %esi
+80102c8c:	5d                   	pop    %ebp
+80102c8d:	c3                   	ret
+
+80102c8e <itrunc>:
+{
+80102c8e:	55                   	push   %ebp
+80102c8f:	89 e5                	mov    %esp,%ebp
+80102c91:	57                   	push   %edi
+80102c92:	56                   	push   %esi
+80102c93:	53                   	push   %ebx
+80102c94:	83 ec 1c             	sub    $0x1c,%esp
+80102c97:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NDIRECT; i++){
+80102c99:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102c9e:	eb 03                	jmp    80102ca3 <itrunc+0x15>
+80102ca0:	83 c3 01             	add    $0x1,%ebx
+80102ca3:	83 fb 0a             	cmp    $0xa,%ebx
+80102ca6:	7f 19                	jg     80102cc1 <itrunc+0x33>
+    if(ip->addrs[i]){
+80102ca8:	8b 54 9e 68          	mov    0x68(%esi,%ebx,4),%edx
+80102cac:	85 d2                	test   %edx,%edx
+80102cae:	74 f0                	je     80102ca0 <itrunc+0x12>
+      bfree(ip->dev, ip->addrs[i]);
+80102cb0:	8b 06                	mov    (%esi),%eax
+80102cb2:	e8 cb f2 ff ff       	call   80101f82 <bfree>
+      ip->addrs[i] = 0;
+80102cb7:	c7 44 9e 68 00 00 00 	movl   $0x0,0x68(%esi,%ebx,4)
+80102cbe:	00 
+80102cbf:	eb df                	jmp    80102ca0 <itrunc+0x12>
+  if(ip->addrs[NDIRECT]){
+80102cc1:	8b 96 94 00 00 00    	mov    0x94(%esi),%edx
+80102cc7:	85 d2                	test   %edx,%edx
+80102cc9:	75 2f                	jne    80102cfa <itrunc+0x6c>
+  if(ip->addrs[NDIRECT+1]){
+80102ccb:	8b 86 98 00 00 00    	mov    0x98(%esi),%eax
+80102cd1:	85 c0                	test   %eax,%eax
+80102cd3:	75 38                	jne    80102d0d <itrunc+0x7f>
+  ip->nmap = 0;
+80102cd5:	c7 86 a0 00 00 00 00 	movl   $0x0,0xa0(%esi)
+80102cdc:	00 00 00 
+  ip->size = 0;
+80102cdf:	c7 46 64 00 00 00 00 	movl   $0x0,0x64(%esi)
+  iupdate(ip);
+80102ce6:	83 ec 0c             	sub    $0xc,%esp
+80102ce9:	56                   	push   %esi
+80102cea:	e8 21 ff ff ff       	call   80102c10 <iupdate>
+}
+80102cef:	83 c4 10             	add    $0x10,%esp
+80102cf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102cf5:	5b                   	pop    %ebx
+80102cf6:	5e                   	pop    %esi
+80102cf7:	5f                   	pop    %edi
+80102cf8:	5d                   	pop    %ebp
+80102cf9:	c3                   	ret
+    bfreeind(ip->dev, ip->addrs[NDIRECT]);
+80102cfa:	8b 06                	mov    (%esi),%eax
+80102cfc:	e8 24 f3 ff ff       	call   80102025 <bfreeind>
+    ip->addrs[NDIRECT] = 0;
+80102d01:	c7 86 94 00 00 00 00 	movl   $0x0,0x94(%esi)
+80102d08:	00 00 00 
+80102d0b:	eb be                	jmp    80102ccb <itrunc+0x3d>
+    bp = bread(ip->dev, ip->addrs[NDIRECT+1]);
+80102d0d:	83 ec 08             	sub    $0x8,%esp
+80102d10:	50                   	push   %eax
+80102d11:	ff 36                	push   (%esi)
+80102d13:	e8 54 db ff ff       	call   8010086c <bread>
+80102d18:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    a = (uint*)bp->data;
+80102d1b:	8b 78 60             	mov    0x60(%eax),%edi
+    for(j = 0; j < NINDIRECT; j++){
+80102d1e:	83 c4 10             	add    $0x10,%esp
+80102d21:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102d26:	eb 03                	jmp    80102d2b <itrunc+0x9d>
+80102d28:	83 c3 01             	add    $0x1,%ebx
+80102d2b:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+80102d31:	77 10                	ja     80102d43 <itrunc+0xb5>
+      if(a[j])
+80102d33:	8b 14 9f             	mov    (%edi,%ebx,4),%edx
+80102d36:	85 d2                	test   %edx,%edx
+80102d38:	74 ee                	je     80102d28 <itrunc+0x9a>
+        bfreeind(ip->dev, a[j]);
+80102d3a:	8b 06                	mov    (%esi),%eax
+80102d3c:	e8 e4 f2 ff ff       	call   80102025 <bfreeind>
+80102d41:	eb e5                	jmp    80102d28 <itrunc+0x9a>
+    brelse(bp);
+80102d43:	83 ec 0c             	sub    $0xc,%esp
+80102d46:	ff 75 e4             	push   -0x1c(%ebp)
+80102d49:	e8 ed db ff ff       	call   8010093b <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT+1]);
+80102d4e:	8b 06                	mov    (%esi),%eax
+80102d50:	8b 96 98 00 00 00    	mov    0x98(%esi),%edx
+80102d56:	e8 27 f2 ff ff       	call   80101f82 <bfree>
+    ip->addrs[NDIRECT+1] = 0;
+80102d5b:	c7 86 98 00 00 00 00 	movl   $0x0,0x98(%esi)
+80102d62:	00 00 00 
+80102d65:	83 c4 10             	add    $0x10,%esp
+80102d68:	e9 68 ff ff ff       	jmp    80102cd5 <itrunc+0x47>
+
+80102d6d <idup>:
+{
+80102d6d:	55                   	push   %ebp
+80102d6e:	89 e5                	mov    %esp,%ebp
+80102d70:	56                   	push   %esi
+80102d71:	53                   	push   %ebx
+80102d72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bk = ihash(ip->dev, ip->inum);
+80102d75:	8b 53 04             	mov    0x4(%ebx),%edx
+80102d78:	8b 03                	mov    (%ebx),%eax
+80102d7a:	e8 0d ef ff ff       	call   80101c8c <ihash>
+80102d7f:	89 c6                	mov    %eax,%esi
+  acquire(&bk->lock);
+80102d81:	83 ec 0c             	sub    $0xc,%esp
+80102d84:	50                   	push   %eax
+80102d85:	e8 41 4c 00 00       	call   801079cb <acquire>
+  ip->ref++;
+80102d8a:	8b 43 08             	mov    0x8(%ebx),%eax
+80102d8d:	83 c0 01             	add    $0x1,%eax
+80102d90:	89 43 08             	mov    %eax,0x8(%ebx)
+  release(&bk->lock);
+80102d93:	89 34 24             	mov    %esi,(%esp)
+80102d96:	e8 95 4c 00 00       	call   80107a30 <release>
+}
+80102d9b:	89 d8                	mov    %ebx,%eax
+80102d9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102da0:	5b                   	pop    %ebx
+80102da1:	5e                   	pop    %esi
+80102da2:	5d                   	pop    %ebp
+80102da3:	c3                   	ret
+
+80102da4 <ilock>:
+{
+80102da4:	55                   	push   %ebp
+80102da5:	89 e5                	mov    %esp,%ebp
+80102da7:	56                   	push   %esi
+80102da8:	53                   	push   %ebx
+80102da9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102dac:	85 db                	test   %ebx,%ebx
+80102dae:	74 22                	je     80102dd2 <ilock+0x2e>
+80102db0:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+80102db4:	7e 1c                	jle    80102dd2 <ilock+0x2e>
+  acquiresleep(&ip->lock);
+80102db6:	83 ec 0c             	sub    $0xc,%esp
+80102db9:	8d 43 18             	lea    0x18(%ebx),%eax
+80102dbc:	50                   	push   %eax
+80102dbd:	e8 14 4a 00 00       	call   801077d6 <acquiresleep>
+  if(ip->valid == 0){
+80102dc2:	83 c4 10             	add    $0x10,%esp
+80102dc5:	83 7b 58 00          	cmpl   $0x0,0x58(%ebx)
+80102dc9:	74 14                	je     80102ddf <ilock+0x3b>
+}
+80102dcb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102dce:	5b                   	pop    %ebx
+80102dcf:	5e                   	pop    %esi
+80102dd0:	5d                   	pop    %ebp
+80102dd1:	c3                   	ret
+    panic("ilock");
+80102dd2:	83 ec 0c             	sub    $0xc,%esp
+80102dd5:	68 0a b3 10 80       	push   $0x8010b30a
+80102dda:	e8 47 dd ff ff       	call   80100b26 <panic>
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102ddf:	8b 43 04             	mov    0x4(%ebx),%eax
+80102de2:	c1 e8 06             	shr    $0x6,%eax
+80102de5:	83 ec 08             	sub    $0x8,%esp
+80102de8:	03 05 34 cd 31 80    	add    0x8031cd34,%eax
+80102dee:	50                   	push   %eax
+80102def:	ff 33                	push   (%ebx)
+80102df1:	e8 76 da ff ff       	call   8010086c <bread>
+80102df6:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+80102df8:	8b 43 04             	mov    0x4(%ebx),%eax
+80102dfb:	83 e0 3f             	and    $0x3f,%eax
+80102dfe:	c1 e0 06             	shl    $0x6,%eax
+80102e01:	03 46 60             	add    0x60(%esi),%eax
+    ip->type = dip->type;
+80102e04:	0f b7 10             	movzwl (%eax),%edx
+80102e07:	66 89 53 5c          	mov    %dx,0x5c(%ebx)
+    ip->major = dip->major;
+80102e0b:	0f b7 50 02          	movzwl 0x2(%eax),%edx
+80102e0f:	66 89 53 5e          	mov    %dx,0x5e(%ebx)
+    ip->minor = dip->minor;
+80102e13:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+80102e17:	66 89 53 60          	mov    %dx,0x60(%ebx)
+    ip->nlink = dip->nlink;
+80102e1b:	0f b7 50 06          	movzwl 0x6(%eax),%edx
+80102e1f:	66 89 53 62          	mov    %dx,0x62(%ebx)
+    ip->size = dip->size;
+80102e23:	8b 50 08             	mov    0x8(%eax),%edx
+80102e26:	89 53 64             	mov    %edx,0x64(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102e29:	83 c0 0c             	add    $0xc,%eax
+80102e2c:	8d 53 68             	lea    0x68(%ebx),%edx
+80102e2f:	83 c4 0c             	add    $0xc,%esp
+80102e32:	6a 34                	push   $0x34
+80102e34:	50                   	push   %eax
+80102e35:	52                   	push   %edx
+80102e36:	e8 b4 4c 00 00       	call   80107aef <memmove>
+    brelse(bp);
+80102e3b:	89 34 24             	mov    %esi,(%esp)
+80102e3e:	e8 f8 da ff ff       	call   8010093b <brelse>
+    ip->nmap = 0;
+80102e43:	c7 83 a0 00 00 00 00 	movl   $0x0,0xa0(%ebx)
+80102e4a:	00 00 00 
+    ip->lastblk = 0;
+80102e4d:	c7 83 e4 00 00 00 00 	movl   $0x0,0xe4(%ebx)
+80102e54:	00 00 00 
+    ip->valid = 1;
+80102e57:	c7 43 58 01 00 00 00 	movl   $0x1,0x58(%ebx)
+    if(ip->type == 0)
+80102e5e:	83 c4 10             	add    $0x10,%esp
+80102e61:	66 83 7b 5c 00       	cmpw   $0x0,0x5c(%ebx)
+80102e66:	0f 85 5f ff ff ff    	jne    80102dcb <ilock+0x27>
+      panic("ilock: no type");
+80102e6c:	83 ec 0c             	sub    $0xc,%esp
+80102e6f:	68 10 b3 10 80       	push   $0x8010b310
+80102e74:	e8 ad dc ff ff       	call   80100b26 <panic>
+
+80102e79 <iunlock>:
+{
+80102e79:	55                   	push   %ebp
+80102e7a:	89 e5                	mov    %esp,%ebp
+80102e7c:	56                   	push   %esi
+80102e7d:	53                   	push   %ebx
+80102e7e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102e81:	85 db                	test   %ebx,%ebx
+80102e83:	74 2c                	je     80102eb1 <iunlock+0x38>
+80102e85:	8d 73 18             	lea    0x18(%ebx),%esi
+80102e88:	83 ec 0c             	sub    $0xc,%esp
+80102e8b:	56                   	push   %esi
+80102e8c:	e8 cf 49 00 00       	call   80107860 <holdingsleep>
+80102e91:	83 c4 10             	add    $0x10,%esp
+80102e94:	85 c0                	test   %eax,%eax
+80102e96:	74 19                	je     80102eb1 <iunlock+0x38>
+80102e98:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+80102e9c:	7e 13                	jle    80102eb1 <iunlock+0x38>
+  releasesleep(&ip->lock);
+80102e9e:	83 ec 0c             	sub    $0xc,%esp
+80102ea1:	56                   	push   %esi
+80102ea2:	e8 7e 49 00 00       	call   80107825 <releasesleep>
+}
+80102ea7:	83 c4 10             	add    $0x10,%esp
+80102eaa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102ead:	5b                   	pop    %ebx
+80102eae:	5e                   	pop    %esi
+80102eaf:	5d                   	pop    %ebp
+80102eb0:	c3                   	ret
+    panic("iunlock");
+80102eb1:	83 ec 0c             	sub    $0xc,%esp
+80102eb4:	68 1f b3 10 80       	push   $0x8010b31f
+80102eb9:	e8 68 dc ff ff       	call   80100b26 <panic>
+
+80102ebe <iput>:
+{
+80102ebe:	55                   	push   %ebp
+80102ebf:	89 e5                	mov    %esp,%ebp
+80102ec1:	57                   	push   %edi
+80102ec2:	56                   	push   %esi
+80102ec3:	53                   	push   %ebx
+80102ec4:	83 ec 1c             	sub    $0x1c,%esp
+80102ec7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct ibucket *bk = ihash(ip->dev, ip->inum);
+80102eca:	8b 53 04             	mov    0x4(%ebx),%edx
+80102ecd:	8b 03                	mov    (%ebx),%eax
+80102ecf:	e8 b8 ed ff ff       	call   80101c8c <ihash>
+80102ed4:	89 c6                	mov    %eax,%esi
+  acquiresleep(&ip->lock);
+80102ed6:	8d 7b 18             	lea    0x18(%ebx),%edi
+80102ed9:	83 ec 0c             	sub    $0xc,%esp
+80102edc:	57                   	push   %edi
+80102edd:	e8 f4 48 00 00       	call   801077d6 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+80102ee2:	83 c4 10             	add    $0x10,%esp
+80102ee5:	83 7b 58 00          	cmpl   $0x0,0x58(%ebx)
+80102ee9:	74 07                	je     80102ef2 <iput+0x34>
+80102eeb:	66 83 7b 62 00       	cmpw   $0x0,0x62(%ebx)
+80102ef0:	74 35                	je     80102f27 <iput+0x69>
+  releasesleep(&ip->lock);
+80102ef2:	83 ec 0c             	sub    $0xc,%esp
+80102ef5:	57                   	push   %edi
+80102ef6:	e8 2a 49 00 00       	call   80107825 <releasesleep>
+  acquire(&bk->lock);
+80102efb:	89 34 24             	mov    %esi,(%esp)
+80102efe:	e8 c8 4a 00 00       	call   801079cb <acquire>
+  if(--ip->ref == 0)
+80102f03:	8b 43 08             	mov    0x8(%ebx),%eax
+80102f06:	83 e8 01             	sub    $0x1,%eax
+80102f09:	89 43 08             	mov    %eax,0x8(%ebx)
+80102f0c:	83 c4 10             	add    $0x10,%esp
+80102f0f:	85 c0                	test   %eax,%eax
+80102f11:	74 72                	je     80102f85 <iput+0xc7>
+  release(&bk->lock);
+80102f13:	83 ec 0c             	sub    $0xc,%esp
+80102f16:	56                   	push   %esi
+80102f17:	e8 14 4b 00 00       	call   80107a30 <release>
+}
+80102f1c:	83 c4 10             	add    $0x10,%esp
+80102f1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102f22:	5b                   	pop    %ebx
+80102f23:	5e                   	pop    %esi
+80102f24:	5f                   	pop    %edi
+80102f25:	5d                   	pop    %ebp
+80102f26:	c3                   	ret
+    acquire(&bk->lock);
+80102f27:	83 ec 0c             	sub    $0xc,%esp
+80102f2a:	56                   	push   %esi
+80102f2b:	e8 9b 4a 00 00       	call   801079cb <acquire>
+    int r = ip->ref;
+80102f30:	8b 43 08             	mov    0x8(%ebx),%eax
+80102f33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    release(&bk->lock);
+80102f36:	89 34 24             	mov    %esi,(%esp)
+80102f39:	e8 f2 4a 00 00       	call   80107a30 <release>
+    if(r == 1){
+80102f3e:	83 c4 10             	add    $0x10,%esp
+80102f41:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+80102f45:	75 ab                	jne    80102ef2 <iput+0x34>
+      itrunc(ip);
+80102f47:	89 d8                	mov    %ebx,%eax
+80102f49:	e8 40 fd ff ff       	call   80102c8e <itrunc>
+      ip->type = 0;
+80102f4e:	66 c7 43 5c 00 00    	movw   $0x0,0x5c(%ebx)
+      iupdate(ip);
+80102f54:	83 ec 0c             	sub    $0xc,%esp
+80102f57:	53                   	push   %ebx
+80102f58:	e8 b3 fc ff ff       	call   80102c10 <iupdate>
+      ip->valid = 0;
+80102f5d:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+      dirindexfree(ip);
+80102f64:	89 d8                	mov    %ebx,%eax
+80102f66:	e8 83 f5 ff ff       	call   801024ee <dirindexfree>
+      dcachepurge(ip->dev, ip->inum);
+80102f6b:	8b 53 04             	mov    0x4(%ebx),%edx
+80102f6e:	8b 03                	mov    (%ebx),%eax
+80102f70:	e8 6c ef ff ff       	call   80101ee1 <dcachepurge>
+      ifreemark(ip->inum);
+80102f75:	8b 43 04             	mov    0x4(%ebx),%eax
+80102f78:	e8 b7 ef ff ff       	call   80101f34 <ifreemark>
+80102f7d:	83 c4 10             	add    $0x10,%esp
+80102f80:	e9 6d ff ff ff       	jmp    80102ef2 <iput+0x34>
+    ilruadd(ip, !ip->valid);
+80102f85:	83 7b 58 00          	cmpl   $0x0,0x58(%ebx)
+80102f89:	0f 94 c2             	sete   %dl
+80102f8c:	0f b6 d2             	movzbl %dl,%edx
+80102f8f:	89 d8                	mov    %ebx,%eax
+80102f91:	e8 8a ee ff ff       	call   80101e20 <ilruadd>
+80102f96:	e9 78 ff ff ff       	jmp    80102f13 <iput+0x55>
+
+80102f9b <iunlockput>:
+{
+80102f9b:	55                   	push   %ebp
+80102f9c:	89 e5                	mov    %esp,%ebp
+80102f9e:	53                   	push   %ebx
+80102f9f:	83 ec 10             	sub    $0x10,%esp
+80102fa2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  iunlock(ip);
+80102fa5:	53                   	push   %ebx
+80102fa6:	e8 ce fe ff ff       	call   80102e79 <iunlock>
+  iput(ip);
+80102fab:	89 1c 24             	mov    %ebx,(%esp)
+80102fae:	e8 0b ff ff ff       	call   80102ebe <iput>
+}
+80102fb3:	83 c4 10             	add    $0x10,%esp
+80102fb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102fb9:	c9                   	leave
+80102fba:	c3                   	ret
+
+80102fbb <stati>:
+{
+80102fbb:	55                   	push   %ebp
+80102fbc:	89 e5                	mov    %esp,%ebp
+80102fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+80102fc1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80102fc4:	8b 0a                	mov    (%edx),%ecx
+80102fc6:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80102fc9:	8b 4a 04             	mov    0x4(%edx),%ecx
+80102fcc:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80102fcf:	0f b7 4a 5c          	movzwl 0x5c(%edx),%ecx
+80102fd3:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80102fd6:	0f b7 4a 62          	movzwl 0x62(%edx),%ecx
+80102fda:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80102fde:	8b 52 64             	mov    0x64(%edx),%edx
+80102fe1:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80102fe4:	5d                   	pop    %ebp
+80102fe5:	c3                   	ret
+
+80102fe6 <readahead>:
+{
+80102fe6:	55                   	push   %ebp
+80102fe7:	89 e5                	mov    %esp,%ebp
+80102fe9:	57                   	push   %edi
+80102fea:	56                   	push   %esi
+80102feb:	53                   	push   %ebx
+80102fec:	83 ec 0c             	sub    $0xc,%esp
+80102fef:	8b 75 0c             	mov    0xc(%ebp),%esi
+80102ff2:	8b 45 10             	mov    0x10(%ebp),%eax
+  if(ip->type == T_DEV || off >= ip->size)
+80102ff5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80102ff8:	66 83 79 5c 03       	cmpw   $0x3,0x5c(%ecx)
+80102ffd:	74 61                	je     80103060 <readahead+0x7a>
+80102fff:	8b 51 64             	mov    0x64(%ecx),%edx
+80103002:	39 d6                	cmp    %edx,%esi
+80103004:	73 5a                	jae    80103060 <readahead+0x7a>
+  if(off + n > ip->size || off + n < off)
+80103006:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80103009:	39 ca                	cmp    %ecx,%edx
+8010300b:	72 04                	jb     80103011 <readahead+0x2b>
+8010300d:	39 f1                	cmp    %esi,%ecx
+8010300f:	73 04                	jae    80103015 <readahead+0x2f>
+    n = ip->size - off;
+80103011:	89 d0                	mov    %edx,%eax
+80103013:	29 f0                	sub    %esi,%eax
+  if(n > NREADAHEAD*BSIZE - off%BSIZE)
+80103015:	89 f2                	mov    %esi,%edx
+80103017:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+8010301d:	bf 00 00 02 00       	mov    $0x20000,%edi
+80103022:	29 d7                	sub    %edx,%edi
+80103024:	39 c7                	cmp    %eax,%edi
+80103026:	72 02                	jb     8010302a <readahead+0x44>
+80103028:	89 c7                	mov    %eax,%edi
+  for(bn = off/BSIZE; bn <= (off + n - 1)/BSIZE; bn++)
+8010302a:	89 f3                	mov    %esi,%ebx
+8010302c:	c1 eb 0c             	shr    $0xc,%ebx
+8010302f:	eb 03                	jmp    80103034 <readahead+0x4e>
+80103031:	83 c3 01             	add    $0x1,%ebx
+80103034:	8d 44 37 ff          	lea    -0x1(%edi,%esi,1),%eax
+80103038:	c1 e8 0c             	shr    $0xc,%eax
+8010303b:	39 d8                	cmp    %ebx,%eax
+8010303d:	72 21                	jb     80103060 <readahead+0x7a>
+    if((addr = bmappeek(ip, bn)) != 0)
+8010303f:	89 da                	mov    %ebx,%edx
+80103041:	8b 45 08             	mov    0x8(%ebp),%eax
+80103044:	e8 29 f4 ff ff       	call   80102472 <bmappeek>
+80103049:	85 c0                	test   %eax,%eax
+8010304b:	74 e4                	je     80103031 <readahead+0x4b>
+      breadahead(ip->dev, addr);
+8010304d:	83 ec 08             	sub    $0x8,%esp
+80103050:	50                   	push   %eax
+80103051:	8b 45 08             	mov    0x8(%ebp),%eax
+80103054:	ff 30                	push   (%eax)
+80103056:	e8 57 d9 ff ff       	call   801009b2 <breadahead>
+8010305b:	83 c4 10             	add    $0x10,%esp
+8010305e:	eb d1                	jmp    80103031 <readahead+0x4b>
+}
+80103060:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103063:	5b                   	pop    %ebx
+80103064:	5e                   	pop    %esi
+80103065:	5f                   	pop    %edi
+80103066:	5d                   	pop    %ebp
+80103067:	c3                   	ret
+
+80103068 <readi>:
+{
+80103068:	55                   	push   %ebp
+80103069:	89 e5                	mov    %esp,%ebp
+8010306b:	57                   	push   %edi
+8010306c:	56                   	push   %esi
+8010306d:	53                   	push   %ebx
+8010306e:	83 ec 1c             	sub    $0x1c,%esp
+80103071:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80103074:	8b 45 08             	mov    0x8(%ebp),%eax
+80103077:	66 83 78 5c 03       	cmpw   $0x3,0x5c(%eax)
+8010307c:	74 40                	je     801030be <readi+0x56>
+  if(off > ip->size || off + n < off)
+8010307e:	8b 45 08             	mov    0x8(%ebp),%eax
+80103081:	8b 40 64             	mov    0x64(%eax),%eax
+80103084:	39 f8                	cmp    %edi,%eax
+80103086:	0f 82 f2 00 00 00    	jb     8010317e <readi+0x116>
+8010308c:	89 fa                	mov    %edi,%edx
+8010308e:	03 55 14             	add    0x14(%ebp),%edx
+80103091:	0f 82 ee 00 00 00    	jb     80103185 <readi+0x11d>
+  if(off + n > ip->size)
+80103097:	39 d0                	cmp    %edx,%eax
+80103099:	73 05                	jae    801030a0 <readi+0x38>
+    n = ip->size - off;
+8010309b:	29 f8                	sub    %edi,%eax
+8010309d:	89 45 14             	mov    %eax,0x14(%ebp)
+  if(n > BSIZE - off%BSIZE)
+801030a0:	89 fa                	mov    %edi,%edx
+801030a2:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+801030a8:	b8 00 10 00 00       	mov    $0x1000,%eax
+801030ad:	29 d0                	sub    %edx,%eax
+801030af:	3b 45 14             	cmp    0x14(%ebp),%eax
+801030b2:	72 3b                	jb     801030ef <readi+0x87>
+{
+801030b4:	be 00 00 00 00       	mov    $0x0,%esi
+801030b9:	e9 a2 00 00 00       	jmp    80103160 <readi+0xf8>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+801030be:	0f b7 40 5e          	movzwl 0x5e(%eax),%eax
+801030c2:	66 83 f8 09          	cmp    $0x9,%ax
+801030c6:	0f 87 a4 00 00 00    	ja     80103170 <readi+0x108>
+801030cc:	98                   	cwtl
+801030cd:	8b 04 c5 20 88 31 80 	mov    -0x7fce77e0(,%eax,8),%eax
+801030d4:	85 c0                	test   %eax,%eax
+801030d6:	0f 84 9b 00 00 00    	je     80103177 <readi+0x10f>
+    return devsw[ip->major].read(ip, dst, n);
+801030dc:	83 ec 04             	sub    $0x4,%esp
+801030df:	ff 75 14             	push   0x14(%ebp)
+801030e2:	ff 75 0c             	push   0xc(%ebp)
+801030e5:	ff 75 08             	push   0x8(%ebp)
+801030e8:	ff d0                	call   *%eax
+801030ea:	83 c4 10             	add    $0x10,%esp
+801030ed:	eb 79                	jmp    80103168 <readi+0x100>
+    readahead(ip, off, n);
+801030ef:	83 ec 04             	sub    $0x4,%esp
+801030f2:	ff 75 14             	push   0x14(%ebp)
+801030f5:	57                   	push   %edi
+801030f6:	ff 75 08             	push   0x8(%ebp)
+801030f9:	e8 e8 fe ff ff       	call   80102fe6 <readahead>
+801030fe:	83 c4 10             	add    $0x10,%esp
+80103101:	eb b1                	jmp    801030b4 <readi+0x4c>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80103103:	89 fa                	mov    %edi,%edx
+80103105:	c1 ea 0c             	shr    $0xc,%edx
+80103108:	8b 45 08             	mov    0x8(%ebp),%eax
+8010310b:	e8 50 f3 ff ff       	call   80102460 <bmap>
+80103110:	83 ec 08             	sub    $0x8,%esp
+80103113:	50                   	push   %eax
+80103114:	8b 45 08             	mov    0x8(%ebp),%eax
+80103117:	ff 30                	push   (%eax)
+80103119:	e8 4e d7 ff ff       	call   8010086c <bread>
+8010311e:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80103120:	89 f8                	mov    %edi,%eax
+80103122:	25 ff 0f 00 00       	and    $0xfff,%eax
+80103127:	bb 00 10 00 00       	mov    $0x1000,%ebx
+8010312c:	29 c3                	sub    %eax,%ebx
+8010312e:	8b 55 14             	mov    0x14(%ebp),%edx
+80103131:	29 f2                	sub    %esi,%edx
+80103133:	39 d3                	cmp    %edx,%ebx
+80103135:	0f 47 da             	cmova  %edx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+80103138:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010313b:	03 41 60             	add    0x60(%ecx),%eax
+8010313e:	83 c4 0c             	add    $0xc,%esp
+80103141:	53                   	push   %ebx
+80103142:	50                   	push   %eax
+80103143:	ff 75 0c             	push   0xc(%ebp)
+80103146:	e8 a4 49 00 00       	call   80107aef <memmove>
+    brelse(bp);
+8010314b:	83 c4 04             	add    $0x4,%esp
+8010314e:	ff 75 e4             	push   -0x1c(%ebp)
+80103151:	e8 e5 d7 ff ff       	call   8010093b <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80103156:	01 de                	add    %ebx,%esi
+80103158:	01 df                	add    %ebx,%edi
+8010315a:	01 5d 0c             	add    %ebx,0xc(%ebp)
+8010315d:	83 c4 10             	add    $0x10,%esp
+80103160:	3b 75 14             	cmp    0x14(%ebp),%esi
+80103163:	72 9e                	jb     80103103 <readi+0x9b>
+  return n;
+80103165:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+80103168:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010316b:	5b                   	pop    %ebx
+8010316c:	5e                   	pop    %esi
+8010316d:	5f                   	pop    %edi
+8010316e:	5d                   	pop    %ebp
+8010316f:	c3                   	ret
+      return -1;
+80103170:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103175:	eb f1                	jmp    80103168 <readi+0x100>
+80103177:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010317c:	eb ea                	jmp    80103168 <readi+0x100>
+    return -1;
+8010317e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103183:	eb e3                	jmp    80103168 <readi+0x100>
+80103185:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010318a:	eb dc                	jmp    80103168 <readi+0x100>
+
+8010318c <readipipe>:
+{
+8010318c:	55                   	push   %ebp
+8010318d:	89 e5                	mov    %esp,%ebp
+8010318f:	57                   	push   %edi
+80103190:	56                   	push   %esi
+80103191:	53                   	push   %ebx
+80103192:	83 ec 1c             	sub    $0x1c,%esp
+80103195:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(ip->type == T_DEV || off > ip->size || off + n < off)
+80103198:	8b 45 08             	mov    0x8(%ebp),%eax
+8010319b:	66 83 78 5c 03       	cmpw   $0x3,0x5c(%eax)
+801031a0:	0f 84 e8 00 00 00    	je     8010328e <readipipe+0x102>
+801031a6:	8b 40 64             	mov    0x64(%eax),%eax
+801031a9:	39 f0                	cmp    %esi,%eax
+801031ab:	0f 82 e4 00 00 00    	jb     80103295 <readipipe+0x109>
+801031b1:	89 f2                	mov    %esi,%edx
+801031b3:	03 55 14             	add    0x14(%ebp),%edx
+801031b6:	0f 82 e0 00 00 00    	jb     8010329c <readipipe+0x110>
+  if(off + n > ip->size)
+801031bc:	39 d0                	cmp    %edx,%eax
+801031be:	73 05                	jae    801031c5 <readipipe+0x39>
+    n = ip->size - off;
+801031c0:	29 f0                	sub    %esi,%eax
+801031c2:	89 45 14             	mov    %eax,0x14(%ebp)
+  if(n > BSIZE - off%BSIZE)
+801031c5:	89 f2                	mov    %esi,%edx
+801031c7:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+801031cd:	b8 00 10 00 00       	mov    $0x1000,%eax
+801031d2:	29 d0                	sub    %edx,%eax
+801031d4:	3b 45 14             	cmp    0x14(%ebp),%eax
+801031d7:	72 0c                	jb     801031e5 <readipipe+0x59>
+      return tot > 0 ? tot : -1;
+801031d9:	bf 00 00 00 00       	mov    $0x0,%edi
+801031de:	89 75 10             	mov    %esi,0x10(%ebp)
+801031e1:	89 fe                	mov    %edi,%esi
+801031e3:	eb 2b                	jmp    80103210 <readipipe+0x84>
+    readahead(ip, off, n);
+801031e5:	83 ec 04             	sub    $0x4,%esp
+801031e8:	ff 75 14             	push   0x14(%ebp)
+801031eb:	56                   	push   %esi
+801031ec:	ff 75 08             	push   0x8(%ebp)
+801031ef:	e8 f2 fd ff ff       	call   80102fe6 <readahead>
+801031f4:	83 c4 10             	add    $0x10,%esp
+801031f7:	eb e0                	jmp    801031d9 <readipipe+0x4d>
+      return tot > 0 ? tot : -1;
+801031f9:	85 f6                	test   %esi,%esi
+801031fb:	74 07                	je     80103204 <readipipe+0x78>
+801031fd:	89 f0                	mov    %esi,%eax
+801031ff:	e9 82 00 00 00       	jmp    80103286 <readipipe+0xfa>
+80103204:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103209:	eb 7b                	jmp    80103286 <readipipe+0xfa>
+  for(tot=0; tot<n; tot+=r, off+=r){
+8010320b:	01 fe                	add    %edi,%esi
+8010320d:	01 7d 10             	add    %edi,0x10(%ebp)
+80103210:	3b 75 14             	cmp    0x14(%ebp),%esi
+80103213:	73 6d                	jae    80103282 <readipipe+0xf6>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80103215:	8b 55 10             	mov    0x10(%ebp),%edx
+80103218:	c1 ea 0c             	shr    $0xc,%edx
+8010321b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010321e:	e8 3d f2 ff ff       	call   80102460 <bmap>
+80103223:	83 ec 08             	sub    $0x8,%esp
+80103226:	50                   	push   %eax
+80103227:	8b 45 08             	mov    0x8(%ebp),%eax
+8010322a:	ff 30                	push   (%eax)
+8010322c:	e8 3b d6 ff ff       	call   8010086c <bread>
+80103231:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80103233:	8b 55 10             	mov    0x10(%ebp),%edx
+80103236:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+8010323c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+80103241:	29 d3                	sub    %edx,%ebx
+80103243:	8b 45 14             	mov    0x14(%ebp),%eax
+80103246:	29 f0                	sub    %esi,%eax
+80103248:	39 c3                	cmp    %eax,%ebx
+8010324a:	0f 47 d8             	cmova  %eax,%ebx
+    r = pipeput(p, (char*)bp->data + off%BSIZE, m);
+8010324d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80103250:	8b 41 60             	mov    0x60(%ecx),%eax
+80103253:	83 c4 0c             	add    $0xc,%esp
+80103256:	53                   	push   %ebx
+80103257:	01 d0                	add    %edx,%eax
+80103259:	50                   	push   %eax
+8010325a:	ff 75 0c             	push   0xc(%ebp)
+8010325d:	e8 29 20 00 00       	call   8010528b <pipeput>
+80103262:	89 c7                	mov    %eax,%edi
+    brelse(bp);
+80103264:	83 c4 04             	add    $0x4,%esp
+80103267:	ff 75 e4             	push   -0x1c(%ebp)
+8010326a:	e8 cc d6 ff ff       	call   8010093b <brelse>
+    if(r < 0)
+8010326f:	83 c4 10             	add    $0x10,%esp
+80103272:	85 ff                	test   %edi,%edi
+80103274:	78 83                	js     801031f9 <readipipe+0x6d>
+    if(r < m){
+80103276:	39 fb                	cmp    %edi,%ebx
+80103278:	7e 91                	jle    8010320b <readipipe+0x7f>
+      tot += r;
+8010327a:	89 f8                	mov    %edi,%eax
+8010327c:	89 f7                	mov    %esi,%edi
+8010327e:	01 c7                	add    %eax,%edi
+      break;
+80103280:	eb 02                	jmp    80103284 <readipipe+0xf8>
+80103282:	89 f7                	mov    %esi,%edi
+  return tot;
+80103284:	89 f8                	mov    %edi,%eax
+}
+80103286:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103289:	5b                   	pop    %ebx
+8010328a:	5e                   	pop    %esi
+8010328b:	5f                   	pop    %edi
+8010328c:	5d                   	pop    %ebp
+8010328d:	c3                   	ret
+    return -1;
+8010328e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103293:	eb f1                	jmp    80103286 <readipipe+0xfa>
+80103295:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010329a:	eb ea                	jmp    80103286 <readipipe+0xfa>
+8010329c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801032a1:	eb e3                	jmp    80103286 <readipipe+0xfa>
+
+801032a3 <writeipipe>:
+{
+801032a3:	55                   	push   %ebp
+801032a4:	89 e5                	mov    %esp,%ebp
+801032a6:	57                   	push   %edi
+801032a7:	56                   	push   %esi
+801032a8:	53                   	push   %ebx
+801032a9:	83 ec 1c             	sub    $0x1c,%esp
+  if(ip->type == T_DEV || off > ip->size || off + n < off)
+801032ac:	8b 45 08             	mov    0x8(%ebp),%eax
+801032af:	66 83 78 5c 03       	cmpw   $0x3,0x5c(%eax)
+801032b4:	0f 84 fe 00 00 00    	je     801033b8 <writeipipe+0x115>
+801032ba:	8b 7d 10             	mov    0x10(%ebp),%edi
+801032bd:	39 78 64             	cmp    %edi,0x64(%eax)
+801032c0:	0f 82 f9 00 00 00    	jb     801033bf <writeipipe+0x11c>
+801032c6:	89 f8                	mov    %edi,%eax
+801032c8:	03 45 14             	add    0x14(%ebp),%eax
+801032cb:	0f 82 f5 00 00 00    	jb     801033c6 <writeipipe+0x123>
+  for(tot=0; tot<n; tot+=r, off+=r){
+801032d1:	bf 00 00 00 00       	mov    $0x0,%edi
+801032d6:	eb 1b                	jmp    801032f3 <writeipipe+0x50>
+    brelse(bp);
+801032d8:	83 ec 0c             	sub    $0xc,%esp
+801032db:	ff 75 e4             	push   -0x1c(%ebp)
+801032de:	e8 58 d6 ff ff       	call   8010093b <brelse>
+    if(r < m){
+801032e3:	83 c4 10             	add    $0x10,%esp
+801032e6:	39 f3                	cmp    %esi,%ebx
+801032e8:	0f 8f 91 00 00 00    	jg     8010337f <writeipipe+0xdc>
+  for(tot=0; tot<n; tot+=r, off+=r){
+801032ee:	01 f7                	add    %esi,%edi
+801032f0:	01 75 10             	add    %esi,0x10(%ebp)
+801032f3:	3b 7d 14             	cmp    0x14(%ebp),%edi
+801032f6:	0f 83 8c 00 00 00    	jae    80103388 <writeipipe+0xe5>
+    if(pipeavail(p) == 0)
+801032fc:	83 ec 0c             	sub    $0xc,%esp
+801032ff:	ff 75 0c             	push   0xc(%ebp)
+80103302:	e8 fa 1f 00 00       	call   80105301 <pipeavail>
+80103307:	83 c4 10             	add    $0x10,%esp
+8010330a:	85 c0                	test   %eax,%eax
+8010330c:	0f 84 91 00 00 00    	je     801033a3 <writeipipe+0x100>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80103312:	8b 55 10             	mov    0x10(%ebp),%edx
+80103315:	c1 ea 0c             	shr    $0xc,%edx
+80103318:	8b 45 08             	mov    0x8(%ebp),%eax
+8010331b:	e8 40 f1 ff ff       	call   80102460 <bmap>
+80103320:	83 ec 08             	sub    $0x8,%esp
+80103323:	50                   	push   %eax
+80103324:	8b 45 08             	mov    0x8(%ebp),%eax
+80103327:	ff 30                	push   (%eax)
+80103329:	e8 3e d5 ff ff       	call   8010086c <bread>
+8010332e:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80103330:	8b 55 10             	mov    0x10(%ebp),%edx
+80103333:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+80103339:	bb 00 10 00 00       	mov    $0x1000,%ebx
+8010333e:	29 d3                	sub    %edx,%ebx
+80103340:	8b 45 14             	mov    0x14(%ebp),%eax
+80103343:	29 f8                	sub    %edi,%eax
+80103345:	39 c3                	cmp    %eax,%ebx
+80103347:	0f 47 d8             	cmova  %eax,%ebx
+    if((r = pipeget(p, (char*)bp->data + off%BSIZE, m)) > 0)
+8010334a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010334d:	8b 41 60             	mov    0x60(%ecx),%eax
+80103350:	83 c4 0c             	add    $0xc,%esp
+80103353:	53                   	push   %ebx
+80103354:	01 d0                	add    %edx,%eax
+80103356:	50                   	push   %eax
+80103357:	ff 75 0c             	push   0xc(%ebp)
+8010335a:	e8 71 1f 00 00       	call   801052d0 <pipeget>
+8010335f:	89 c6                	mov    %eax,%esi
+80103361:	83 c4 10             	add    $0x10,%esp
+80103364:	85 c0                	test   %eax,%eax
+80103366:	0f 8e 6c ff ff ff    	jle    801032d8 <writeipipe+0x35>
+      log_write(bp);
+8010336c:	83 ec 0c             	sub    $0xc,%esp
+8010336f:	ff 75 e4             	push   -0x1c(%ebp)
+80103372:	e8 a9 14 00 00       	call   80104820 <log_write>
+80103377:	83 c4 10             	add    $0x10,%esp
+8010337a:	e9 59 ff ff ff       	jmp    801032d8 <writeipipe+0x35>
+      tot += r;
+8010337f:	01 f7                	add    %esi,%edi
+80103381:	89 fb                	mov    %edi,%ebx
+      off += r;
+80103383:	01 75 10             	add    %esi,0x10(%ebp)
+      break;
+80103386:	eb 02                	jmp    8010338a <writeipipe+0xe7>
+80103388:	89 fb                	mov    %edi,%ebx
+  if(tot > 0 && off > ip->size){
+8010338a:	85 db                	test   %ebx,%ebx
+8010338c:	74 0b                	je     80103399 <writeipipe+0xf6>
+8010338e:	8b 45 08             	mov    0x8(%ebp),%eax
+80103391:	8b 7d 10             	mov    0x10(%ebp),%edi
+80103394:	39 78 64             	cmp    %edi,0x64(%eax)
+80103397:	72 0e                	jb     801033a7 <writeipipe+0x104>
+  return tot;
+80103399:	89 d8                	mov    %ebx,%eax
+}
+8010339b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010339e:	5b                   	pop    %ebx
+8010339f:	5e                   	pop    %esi
+801033a0:	5f                   	pop    %edi
+801033a1:	5d                   	pop    %ebp
+801033a2:	c3                   	ret
+801033a3:	89 fb                	mov    %edi,%ebx
+801033a5:	eb e3                	jmp    8010338a <writeipipe+0xe7>
+    ip->size = off;
+801033a7:	89 78 64             	mov    %edi,0x64(%eax)
+    iupdate(ip);
+801033aa:	83 ec 0c             	sub    $0xc,%esp
+801033ad:	50                   	push   %eax
+801033ae:	e8 5d f8 ff ff       	call   80102c10 <iupdate>
+801033b3:	83 c4 10             	add    $0x10,%esp
+801033b6:	eb e1                	jmp    80103399 <writeipipe+0xf6>
+    return -1;
+801033b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801033bd:	eb dc                	jmp    8010339b <writeipipe+0xf8>
+801033bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801033c4:	eb d5                	jmp    8010339b <writeipipe+0xf8>
+801033c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801033cb:	eb ce                	jmp    8010339b <writeipipe+0xf8>
+
+801033cd <writei>:
+{
+801033cd:	55                   	push   %ebp
+801033ce:	89 e5                	mov    %esp,%ebp
+801033d0:	57                   	push   %edi
+801033d1:	56                   	push   %esi
+801033d2:	53                   	push   %ebx
+801033d3:	83 ec 1c             	sub    $0x1c,%esp
+801033d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801033d9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+801033dc:	66 83 79 5c 03       	cmpw   $0x3,0x5c(%ecx)
+801033e1:	74 21                	je     80103404 <writei+0x37>
+  if(off > ip->size || off + n < off)
+801033e3:	39 79 64             	cmp    %edi,0x64(%ecx)
+801033e6:	0f 82 ec 00 00 00    	jb     801034d8 <writei+0x10b>
+801033ec:	89 f8                	mov    %edi,%eax
+801033ee:	03 45 14             	add    0x14(%ebp),%eax
+801033f1:	0f 82 e8 00 00 00    	jb     801034df <writei+0x112>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+801033f7:	be 00 00 00 00       	mov    $0x0,%esi
+801033fc:	89 4d 08             	mov    %ecx,0x8(%ebp)
+801033ff:	e9 97 00 00 00       	jmp    8010349b <writei+0xce>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+80103404:	0f b7 41 5e          	movzwl 0x5e(%ecx),%eax
+80103408:	66 83 f8 09          	cmp    $0x9,%ax
+8010340c:	0f 87 b8 00 00 00    	ja     801034ca <writei+0xfd>
+80103412:	98                   	cwtl
+80103413:	8b 04 c5 24 88 31 80 	mov    -0x7fce77dc(,%eax,8),%eax
+8010341a:	85 c0                	test   %eax,%eax
+8010341c:	0f 84 af 00 00 00    	je     801034d1 <writei+0x104>
+    return devsw[ip->major].write(ip, src, n);
+80103422:	83 ec 04             	sub    $0x4,%esp
+80103425:	ff 75 14             	push   0x14(%ebp)
+80103428:	ff 75 0c             	push   0xc(%ebp)
+8010342b:	51                   	push   %ecx
+8010342c:	ff d0                	call   *%eax
+8010342e:	83 c4 10             	add    $0x10,%esp
+80103431:	eb 7e                	jmp    801034b1 <writei+0xe4>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80103433:	89 fa                	mov    %edi,%edx
+80103435:	c1 ea 0c             	shr    $0xc,%edx
+80103438:	8b 45 08             	mov    0x8(%ebp),%eax
+8010343b:	e8 20 f0 ff ff       	call   80102460 <bmap>
+80103440:	83 ec 08             	sub    $0x8,%esp
+80103443:	50                   	push   %eax
+80103444:	8b 45 08             	mov    0x8(%ebp),%eax
+80103447:	ff 30                	push   (%eax)
+80103449:	e8 1e d4 ff ff       	call   8010086c <bread>
+8010344e:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80103450:	89 f8                	mov    %edi,%eax
+80103452:	25 ff 0f 00 00       	and    $0xfff,%eax
+80103457:	bb 00 10 00 00       	mov    $0x1000,%ebx
+8010345c:	29 c3                	sub    %eax,%ebx
+8010345e:	8b 55 14             	mov    0x14(%ebp),%edx
+80103461:	29 f2                	sub    %esi,%edx
+80103463:	39 d3                	cmp    %edx,%ebx
+80103465:	0f 47 da             	cmova  %edx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+80103468:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010346b:	03 41 60             	add    0x60(%ecx),%eax
+8010346e:	83 c4 0c             	add    $0xc,%esp
+80103471:	53                   	push   %ebx
+80103472:	ff 75 0c             	push   0xc(%ebp)
+80103475:	50                   	push   %eax
+80103476:	e8 74 46 00 00       	call   80107aef <memmove>
+    log_write(bp);
+8010347b:	83 c4 04             	add    $0x4,%esp
+8010347e:	ff 75 e4             	push   -0x1c(%ebp)
+80103481:	e8 9a 13 00 00       	call   80104820 <log_write>
+    brelse(bp);
+80103486:	83 c4 04             	add    $0x4,%esp
+80103489:	ff 75 e4             	push   -0x1c(%ebp)
+8010348c:	e8 aa d4 ff ff       	call   8010093b <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80103491:	01 de                	add    %ebx,%esi
+80103493:	01 df                	add    %ebx,%edi
+80103495:	01 5d 0c             	add    %ebx,0xc(%ebp)
+80103498:	83 c4 10             	add    $0x10,%esp
+8010349b:	3b 75 14             	cmp    0x14(%ebp),%esi
+8010349e:	72 93                	jb     80103433 <writei+0x66>
+  if(n > 0 && off > ip->size){
+801034a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801034a3:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+801034a7:	74 05                	je     801034ae <writei+0xe1>
+801034a9:	39 79 64             	cmp    %edi,0x64(%ecx)
+801034ac:	72 0b                	jb     801034b9 <writei+0xec>
+  return n;
+801034ae:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+801034b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801034b4:	5b                   	pop    %ebx
+801034b5:	5e                   	pop    %esi
+801034b6:	5f                   	pop    %edi
+801034b7:	5d                   	pop    %ebp
+801034b8:	c3                   	ret
+    ip->size = off;
+801034b9:	89 79 64             	mov    %edi,0x64(%ecx)
+    iupdate(ip);
+801034bc:	83 ec 0c             	sub    $0xc,%esp
+801034bf:	51                   	push   %ecx
+801034c0:	e8 4b f7 ff ff       	call   80102c10 <iupdate>
+801034c5:	83 c4 10             	add    $0x10,%esp
+801034c8:	eb e4                	jmp    801034ae <writei+0xe1>
+      return -1;
+801034ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801034cf:	eb e0                	jmp    801034b1 <writei+0xe4>
+801034d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801034d6:	eb d9                	jmp    801034b1 <writei+0xe4>
+    return -1;
+801034d8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801034dd:	eb d2                	jmp    801034b1 <writei+0xe4>
+801034df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801034e4:	eb cb                	jmp    801034b1 <writei+0xe4>
+
+801034e6 <namecmp>:
+{
+801034e6:	55                   	push   %ebp
+801034e7:	89 e5                	mov    %esp,%ebp
+801034e9:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+801034ec:	6a 0e                	push   $0xe
+801034ee:	ff 75 0c             	push   0xc(%ebp)
+801034f1:	ff 75 08             	push   0x8(%ebp)
+801034f4:	e8 62 46 00 00       	call   80107b5b <strncmp>
+}
+801034f9:	c9                   	leave
+801034fa:	c3                   	ret
+
+801034fb <dcacheget>:
+{
+801034fb:	55                   	push   %ebp
+801034fc:	89 e5                	mov    %esp,%ebp
+801034fe:	57                   	push   %edi
+801034ff:	56                   	push   %esi
+80103500:	53                   	push   %ebx
+80103501:	83 ec 28             	sub    $0x28,%esp
+80103504:	89 c3                	mov    %eax,%ebx
+80103506:	89 d7                	mov    %edx,%edi
+80103508:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  acquire(&dcache.lock);
+8010350b:	68 a0 cd 31 80       	push   $0x8031cda0
+80103510:	e8 b6 44 00 00       	call   801079cb <acquire>
+  e = dcentry(dp, name);
+80103515:	89 fa                	mov    %edi,%edx
+80103517:	89 d8                	mov    %ebx,%eax
+80103519:	e8 60 e8 ff ff       	call   80101d7e <dcentry>
+8010351e:	89 c6                	mov    %eax,%esi
+  hit = e->dir == dp->inum && e->dev == dp->dev && namecmp(name, e->name) == 0;
+80103520:	83 c4 10             	add    $0x10,%esp
+80103523:	8b 43 04             	mov    0x4(%ebx),%eax
+80103526:	39 46 04             	cmp    %eax,0x4(%esi)
+80103529:	74 1c                	je     80103547 <dcacheget+0x4c>
+8010352b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  release(&dcache.lock);
+80103530:	83 ec 0c             	sub    $0xc,%esp
+80103533:	68 a0 cd 31 80       	push   $0x8031cda0
+80103538:	e8 f3 44 00 00       	call   80107a30 <release>
+}
+8010353d:	89 d8                	mov    %ebx,%eax
+8010353f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103542:	5b                   	pop    %ebx
+80103543:	5e                   	pop    %esi
+80103544:	5f                   	pop    %edi
+80103545:	5d                   	pop    %ebp
+80103546:	c3                   	ret
+  hit = e->dir == dp->inum && e->dev == dp->dev && namecmp(name, e->name) == 0;
+80103547:	8b 03                	mov    (%ebx),%eax
+80103549:	39 06                	cmp    %eax,(%esi)
+8010354b:	74 07                	je     80103554 <dcacheget+0x59>
+8010354d:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103552:	eb dc                	jmp    80103530 <dcacheget+0x35>
+80103554:	8d 46 0c             	lea    0xc(%esi),%eax
+80103557:	83 ec 08             	sub    $0x8,%esp
+8010355a:	50                   	push   %eax
+8010355b:	57                   	push   %edi
+8010355c:	e8 85 ff ff ff       	call   801034e6 <namecmp>
+80103561:	83 c4 10             	add    $0x10,%esp
+80103564:	85 c0                	test   %eax,%eax
+80103566:	75 0f                	jne    80103577 <dcacheget+0x7c>
+    *inum = e->inum;
+80103568:	8b 46 08             	mov    0x8(%esi),%eax
+8010356b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010356e:	89 07                	mov    %eax,(%edi)
+  hit = e->dir == dp->inum && e->dev == dp->dev && namecmp(name, e->name) == 0;
+80103570:	bb 01 00 00 00       	mov    $0x1,%ebx
+80103575:	eb b9                	jmp    80103530 <dcacheget+0x35>
+80103577:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010357c:	eb b2                	jmp    80103530 <dcacheget+0x35>
+
+8010357e <dirlookup>:
+{
+8010357e:	55                   	push   %ebp
+8010357f:	89 e5                	mov    %esp,%ebp
+80103581:	57                   	push   %edi
+80103582:	56                   	push   %esi
+80103583:	53                   	push   %ebx
+80103584:	83 ec 3c             	sub    $0x3c,%esp
+80103587:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(dp->type != T_DIR)
+8010358a:	66 83 7f 5c 01       	cmpw   $0x1,0x5c(%edi)
+8010358f:	75 41                	jne    801035d2 <dirlookup+0x54>
+  if(poff == 0 && dcacheget(dp, name, &inum))
+80103591:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80103595:	74 48                	je     801035df <dirlookup+0x61>
+  if(dp->ndirhash == 0 && dp->size > DIRIDXMIN)
+80103597:	83 bf 28 01 00 00 00 	cmpl   $0x0,0x128(%edi)
+8010359e:	75 09                	jne    801035a9 <dirlookup+0x2b>
+801035a0:	81 7f 64 00 10 00 00 	cmpl   $0x1000,0x64(%edi)
+801035a7:	77 62                	ja     8010360b <dirlookup+0x8d>
+  if(dp->ndirhash){
+801035a9:	8b 87 28 01 00 00    	mov    0x128(%edi),%eax
+801035af:	85 c0                	test   %eax,%eax
+801035b1:	0f 84 72 01 00 00    	je     80103729 <dirlookup+0x1ab>
+    n = dp->ndirhash * DIRSLOTS;
+801035b7:	c1 e0 0a             	shl    $0xa,%eax
+801035ba:	89 c3                	mov    %eax,%ebx
+801035bc:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    for(i = dirhash(name) % n; (v = *dirslot(dp, i)) != 0; i = (i + 1) % n){
+801035bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+801035c2:	e8 ee e6 ff ff       	call   80101cb5 <dirhash>
+801035c7:	ba 00 00 00 00       	mov    $0x0,%edx
+801035cc:	f7 f3                	div    %ebx
+801035ce:	89 d3                	mov    %edx,%ebx
+801035d0:	eb 5c                	jmp    8010362e <dirlookup+0xb0>
+    panic("dirlookup not DIR");
+801035d2:	83 ec 0c             	sub    $0xc,%esp
+801035d5:	68 27 b3 10 80       	push   $0x8010b327
+801035da:	e8 47 d5 ff ff       	call   80100b26 <panic>
+  if(poff == 0 && dcacheget(dp, name, &inum))
+801035df:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+801035e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+801035e5:	89 f8                	mov    %edi,%eax
+801035e7:	e8 0f ff ff ff       	call   801034fb <dcacheget>
+801035ec:	85 c0                	test   %eax,%eax
+801035ee:	74 a7                	je     80103597 <dirlookup+0x19>
+    return inum ? iget(dp->dev, inum) : 0;
+801035f0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801035f3:	85 d2                	test   %edx,%edx
+801035f5:	75 08                	jne    801035ff <dirlookup+0x81>
+801035f7:	8b 45 10             	mov    0x10(%ebp),%eax
+801035fa:	e9 b5 00 00 00       	jmp    801036b4 <dirlookup+0x136>
+801035ff:	8b 07                	mov    (%edi),%eax
+80103601:	e8 24 ef ff ff       	call   8010252a <iget>
+80103606:	89 45 10             	mov    %eax,0x10(%ebp)
+80103609:	eb ec                	jmp    801035f7 <dirlookup+0x79>
+    dirindex(dp);
+8010360b:	89 f8                	mov    %edi,%eax
+8010360d:	e8 86 f0 ff ff       	call   80102698 <dirindex>
+80103612:	eb 95                	jmp    801035a9 <dirlookup+0x2b>
+        panic("dirlookup read");
+80103614:	83 ec 0c             	sub    $0xc,%esp
+80103617:	68 39 b3 10 80       	push   $0x8010b339
+8010361c:	e8 05 d5 ff ff       	call   80100b26 <panic>
+    for(i = dirhash(name) % n; (v = *dirslot(dp, i)) != 0; i = (i + 1) % n){
+80103621:	8d 43 01             	lea    0x1(%ebx),%eax
+80103624:	ba 00 00 00 00       	mov    $0x0,%edx
+80103629:	f7 75 c4             	divl   -0x3c(%ebp)
+8010362c:	89 d3                	mov    %edx,%ebx
+8010362e:	89 da                	mov    %ebx,%edx
+80103630:	89 f8                	mov    %edi,%eax
+80103632:	e8 b4 e6 ff ff       	call   80101ceb <dirslot>
+80103637:	8b 30                	mov    (%eax),%esi
+80103639:	85 f6                	test   %esi,%esi
+8010363b:	74 63                	je     801036a0 <dirlookup+0x122>
+      if(v == DIRDEL)
+8010363d:	83 fe ff             	cmp    $0xffffffff,%esi
+80103640:	74 df                	je     80103621 <dirlookup+0xa3>
+      off = (v - 1) * sizeof(de);
+80103642:	83 ee 01             	sub    $0x1,%esi
+80103645:	c1 e6 04             	shl    $0x4,%esi
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103648:	6a 10                	push   $0x10
+8010364a:	56                   	push   %esi
+8010364b:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+8010364e:	50                   	push   %eax
+8010364f:	57                   	push   %edi
+80103650:	e8 13 fa ff ff       	call   80103068 <readi>
+80103655:	83 c4 10             	add    $0x10,%esp
+80103658:	83 f8 10             	cmp    $0x10,%eax
+8010365b:	75 b7                	jne    80103614 <dirlookup+0x96>
+      if(de.inum != 0 && namecmp(name, de.name) == 0){
+8010365d:	66 83 7d d4 00       	cmpw   $0x0,-0x2c(%ebp)
+80103662:	74 bd                	je     80103621 <dirlookup+0xa3>
+80103664:	83 ec 08             	sub    $0x8,%esp
+80103667:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+8010366a:	50                   	push   %eax
+8010366b:	ff 75 0c             	push   0xc(%ebp)
+8010366e:	e8 73 fe ff ff       	call   801034e6 <namecmp>
+80103673:	83 c4 10             	add    $0x10,%esp
+80103676:	85 c0                	test   %eax,%eax
+80103678:	75 a7                	jne    80103621 <dirlookup+0xa3>
+        if(poff)
+8010367a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+8010367e:	74 05                	je     80103685 <dirlookup+0x107>
+          *poff = off;
+80103680:	8b 45 10             	mov    0x10(%ebp),%eax
+80103683:	89 30                	mov    %esi,(%eax)
+        dcacheput(dp, name, de.inum);
+80103685:	0f b7 4d d4          	movzwl -0x2c(%ebp),%ecx
+80103689:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010368c:	89 f8                	mov    %edi,%eax
+8010368e:	e8 48 f1 ff ff       	call   801027db <dcacheput>
+        return iget(dp->dev, de.inum);
+80103693:	0f b7 55 d4          	movzwl -0x2c(%ebp),%edx
+80103697:	8b 07                	mov    (%edi),%eax
+80103699:	e8 8c ee ff ff       	call   8010252a <iget>
+8010369e:	eb 14                	jmp    801036b4 <dirlookup+0x136>
+    dcacheput(dp, name, 0);
+801036a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+801036a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+801036a8:	89 f8                	mov    %edi,%eax
+801036aa:	e8 2c f1 ff ff       	call   801027db <dcacheput>
+    return 0;
+801036af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801036b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801036b7:	5b                   	pop    %ebx
+801036b8:	5e                   	pop    %esi
+801036b9:	5f                   	pop    %edi
+801036ba:	5d                   	pop    %ebp
+801036bb:	c3                   	ret
+      panic("dirlookup read");
+801036bc:	83 ec 0c             	sub    $0xc,%esp
+801036bf:	68 39 b3 10 80       	push   $0x8010b339
+801036c4:	e8 5d d4 ff ff       	call   80100b26 <panic>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801036c9:	83 c3 10             	add    $0x10,%ebx
+801036cc:	3b 5f 64             	cmp    0x64(%edi),%ebx
+801036cf:	73 62                	jae    80103733 <dirlookup+0x1b5>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801036d1:	6a 10                	push   $0x10
+801036d3:	53                   	push   %ebx
+801036d4:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+801036d7:	50                   	push   %eax
+801036d8:	57                   	push   %edi
+801036d9:	e8 8a f9 ff ff       	call   80103068 <readi>
+801036de:	83 c4 10             	add    $0x10,%esp
+801036e1:	83 f8 10             	cmp    $0x10,%eax
+801036e4:	75 d6                	jne    801036bc <dirlookup+0x13e>
+    if(de.inum == 0)
+801036e6:	66 83 7d d4 00       	cmpw   $0x0,-0x2c(%ebp)
+801036eb:	74 dc                	je     801036c9 <dirlookup+0x14b>
+    if(namecmp(name, de.name) == 0){
+801036ed:	83 ec 08             	sub    $0x8,%esp
+801036f0:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+801036f3:	50                   	push   %eax
+801036f4:	56                   	push   %esi
+801036f5:	e8 ec fd ff ff       	call   801034e6 <namecmp>
+801036fa:	83 c4 10             	add    $0x10,%esp
+801036fd:	85 c0                	test   %eax,%eax
+801036ff:	75 c8                	jne    801036c9 <dirlookup+0x14b>
+      if(poff)
+80103701:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80103705:	74 05                	je     8010370c <dirlookup+0x18e>
+        *poff = off;
+80103707:	8b 45 10             	mov    0x10(%ebp),%eax
+8010370a:	89 18                	mov    %ebx,(%eax)
+      inum = de.inum;
+8010370c:	0f b7 4d d4          	movzwl -0x2c(%ebp),%ecx
+80103710:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+      dcacheput(dp, name, inum);
+80103713:	8b 55 0c             	mov    0xc(%ebp),%edx
+80103716:	89 f8                	mov    %edi,%eax
+80103718:	e8 be f0 ff ff       	call   801027db <dcacheput>
+      return iget(dp->dev, inum);
+8010371d:	8b 07                	mov    (%edi),%eax
+8010371f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103722:	e8 03 ee ff ff       	call   8010252a <iget>
+80103727:	eb 8b                	jmp    801036b4 <dirlookup+0x136>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80103729:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010372e:	8b 75 0c             	mov    0xc(%ebp),%esi
+80103731:	eb 99                	jmp    801036cc <dirlookup+0x14e>
+  dcacheput(dp, name, 0);
+80103733:	b9 00 00 00 00       	mov    $0x0,%ecx
+80103738:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010373b:	89 f8                	mov    %edi,%eax
+8010373d:	e8 99 f0 ff ff       	call   801027db <dcacheput>
+  return 0;
+80103742:	b8 00 00 00 00       	mov    $0x0,%eax
+80103747:	e9 68 ff ff ff       	jmp    801036b4 <dirlookup+0x136>
+
+8010374c <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+8010374c:	55                   	push   %ebp
+8010374d:	89 e5                	mov    %esp,%ebp
+8010374f:	57                   	push   %edi
+80103750:	56                   	push   %esi
+80103751:	53                   	push   %ebx
+80103752:	83 ec 1c             	sub    $0x1c,%esp
+80103755:	89 c3                	mov    %eax,%ebx
+80103757:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010375a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  struct inode *ip, *next;
+
+  if(*path == '/')
+8010375d:	80 38 2f             	cmpb   $0x2f,(%eax)
+80103760:	74 17                	je     80103779 <namex+0x2d>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+80103762:	e8 f0 25 00 00       	call   80105d57 <myproc>
+80103767:	83 ec 0c             	sub    $0xc,%esp
+8010376a:	ff 70 78             	push   0x78(%eax)
+8010376d:	e8 fb f5 ff ff       	call   80102d6d <idup>
+80103772:	89 c6                	mov    %eax,%esi
+80103774:	83 c4 10             	add    $0x10,%esp
+80103777:	eb 53                	jmp    801037cc <namex+0x80>
+    ip = iget(ROOTDEV, ROOTINO);
+80103779:	ba 01 00 00 00       	mov    $0x1,%edx
+8010377e:	b8 01 00 00 00       	mov    $0x1,%eax
+80103783:	e8 a2 ed ff ff       	call   8010252a <iget>
+80103788:	89 c6                	mov    %eax,%esi
+8010378a:	eb 40                	jmp    801037cc <namex+0x80>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+    if(ip->type != T_DIR){
+      iunlockput(ip);
+8010378c:	83 ec 0c             	sub    $0xc,%esp
+8010378f:	56                   	push   %esi
+80103790:	e8 06 f8 ff ff       	call   80102f9b <iunlockput>
+      return 0;
+80103795:	83 c4 10             	add    $0x10,%esp
+80103798:	be 00 00 00 00       	mov    $0x0,%esi
+  if(nameiparent){
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+8010379d:	89 f0                	mov    %esi,%eax
+8010379f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801037a2:	5b                   	pop    %ebx
+801037a3:	5e                   	pop    %esi
+801037a4:	5f                   	pop    %edi
+801037a5:	5d                   	pop    %ebp
+801037a6:	c3                   	ret
+    if((next = dirlookup(ip, name, 0)) == 0){
+801037a7:	83 ec 04             	sub    $0x4,%esp
+801037aa:	6a 00                	push   $0x0
+801037ac:	ff 75 e4             	push   -0x1c(%ebp)
+801037af:	56                   	push   %esi
+801037b0:	e8 c9 fd ff ff       	call   8010357e <dirlookup>
+801037b5:	89 c7                	mov    %eax,%edi
+801037b7:	83 c4 10             	add    $0x10,%esp
+801037ba:	85 c0                	test   %eax,%eax
+801037bc:	74 4a                	je     80103808 <namex+0xbc>
+    iunlockput(ip);
+801037be:	83 ec 0c             	sub    $0xc,%esp
+801037c1:	56                   	push   %esi
+801037c2:	e8 d4 f7 ff ff       	call   80102f9b <iunlockput>
+801037c7:	83 c4 10             	add    $0x10,%esp
+    ip = next;
+801037ca:	89 fe                	mov    %edi,%esi
+  while((path = skipelem(path, name)) != 0){
+801037cc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801037cf:	89 d8                	mov    %ebx,%eax
+801037d1:	e8 d4 e5 ff ff       	call   80101daa <skipelem>
+801037d6:	89 c3                	mov    %eax,%ebx
+801037d8:	85 c0                	test   %eax,%eax
+801037da:	74 3c                	je     80103818 <namex+0xcc>
+    ilock(ip);
+801037dc:	83 ec 0c             	sub    $0xc,%esp
+801037df:	56                   	push   %esi
+801037e0:	e8 bf f5 ff ff       	call   80102da4 <ilock>
+    if(ip->type != T_DIR){
+801037e5:	83 c4 10             	add    $0x10,%esp
+801037e8:	66 83 7e 5c 01       	cmpw   $0x1,0x5c(%esi)
+801037ed:	75 9d                	jne    8010378c <namex+0x40>
+    if(nameiparent && *path == '\0'){
+801037ef:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+801037f3:	74 b2                	je     801037a7 <namex+0x5b>
+801037f5:	80 3b 00             	cmpb   $0x0,(%ebx)
+801037f8:	75 ad                	jne    801037a7 <namex+0x5b>
+      iunlock(ip);
+801037fa:	83 ec 0c             	sub    $0xc,%esp
+801037fd:	56                   	push   %esi
+801037fe:	e8 76 f6 ff ff       	call   80102e79 <iunlock>
+      return ip;
+80103803:	83 c4 10             	add    $0x10,%esp
+80103806:	eb 95                	jmp    8010379d <namex+0x51>
+      iunlockput(ip);
+80103808:	83 ec 0c             	sub    $0xc,%esp
+8010380b:	56                   	push   %esi
+8010380c:	e8 8a f7 ff ff       	call   80102f9b <iunlockput>
+      return 0;
+80103811:	83 c4 10             	add    $0x10,%esp
+80103814:	89 fe                	mov    %edi,%esi
+80103816:	eb 85                	jmp    8010379d <namex+0x51>
+  if(nameiparent){
+80103818:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+8010381c:	0f 84 7b ff ff ff    	je     8010379d <namex+0x51>
+    iput(ip);
+80103822:	83 ec 0c             	sub    $0xc,%esp
+80103825:	56                   	push   %esi
+80103826:	e8 93 f6 ff ff       	call   80102ebe <iput>
+    return 0;
+8010382b:	83 c4 10             	add    $0x10,%esp
+8010382e:	89 de                	mov    %ebx,%esi
+80103830:	e9 68 ff ff ff       	jmp    8010379d <namex+0x51>
+
+80103835 <dirlink>:
+{
+80103835:	55                   	push   %ebp
+80103836:	89 e5                	mov    %esp,%ebp
+80103838:	57                   	push   %edi
+80103839:	56                   	push   %esi
+8010383a:	53                   	push   %ebx
+8010383b:	83 ec 20             	sub    $0x20,%esp
+8010383e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80103841:	6a 00                	push   $0x0
+80103843:	ff 75 0c             	push   0xc(%ebp)
+80103846:	53                   	push   %ebx
+80103847:	e8 32 fd ff ff       	call   8010357e <dirlookup>
+8010384c:	83 c4 10             	add    $0x10,%esp
+8010384f:	85 c0                	test   %eax,%eax
+80103851:	75 38                	jne    8010388b <dirlink+0x56>
+  off = dp->ndirhash ? dp->dirfree : 0;
+80103853:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+80103859:	85 c0                	test   %eax,%eax
+8010385b:	74 06                	je     80103863 <dirlink+0x2e>
+8010385d:	8b 83 30 01 00 00    	mov    0x130(%ebx),%eax
+  for(; off < dp->size; off += sizeof(de)){
+80103863:	89 c6                	mov    %eax,%esi
+80103865:	3b 43 64             	cmp    0x64(%ebx),%eax
+80103868:	73 41                	jae    801038ab <dirlink+0x76>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010386a:	6a 10                	push   $0x10
+8010386c:	50                   	push   %eax
+8010386d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+80103870:	50                   	push   %eax
+80103871:	53                   	push   %ebx
+80103872:	e8 f1 f7 ff ff       	call   80103068 <readi>
+80103877:	83 c4 10             	add    $0x10,%esp
+8010387a:	83 f8 10             	cmp    $0x10,%eax
+8010387d:	75 1f                	jne    8010389e <dirlink+0x69>
+    if(de.inum == 0)
+8010387f:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80103884:	74 25                	je     801038ab <dirlink+0x76>
+  for(; off < dp->size; off += sizeof(de)){
+80103886:	8d 46 10             	lea    0x10(%esi),%eax
+80103889:	eb d8                	jmp    80103863 <dirlink+0x2e>
+    iput(ip);
+8010388b:	83 ec 0c             	sub    $0xc,%esp
+8010388e:	50                   	push   %eax
+8010388f:	e8 2a f6 ff ff       	call   80102ebe <iput>
+    return -1;
+80103894:	83 c4 10             	add    $0x10,%esp
+80103897:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010389c:	eb 52                	jmp    801038f0 <dirlink+0xbb>
+      panic("dirlink read");
+8010389e:	83 ec 0c             	sub    $0xc,%esp
+801038a1:	68 48 b3 10 80       	push   $0x8010b348
+801038a6:	e8 7b d2 ff ff       	call   80100b26 <panic>
+  strncpy(de.name, name, DIRSIZ);
+801038ab:	83 ec 04             	sub    $0x4,%esp
+801038ae:	6a 0e                	push   $0xe
+801038b0:	ff 75 0c             	push   0xc(%ebp)
+801038b3:	8d 7d d8             	lea    -0x28(%ebp),%edi
+801038b6:	8d 45 da             	lea    -0x26(%ebp),%eax
+801038b9:	50                   	push   %eax
+801038ba:	e8 db 42 00 00       	call   80107b9a <strncpy>
+  de.inum = inum;
+801038bf:	0f b7 45 10          	movzwl 0x10(%ebp),%eax
+801038c3:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801038c7:	6a 10                	push   $0x10
+801038c9:	56                   	push   %esi
+801038ca:	57                   	push   %edi
+801038cb:	53                   	push   %ebx
+801038cc:	e8 fc fa ff ff       	call   801033cd <writei>
+801038d1:	83 c4 20             	add    $0x20,%esp
+801038d4:	83 f8 10             	cmp    $0x10,%eax
+801038d7:	75 1f                	jne    801038f8 <dirlink+0xc3>
+  dcacheput(dp, name, inum);
+801038d9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801038dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+801038df:	89 d8                	mov    %ebx,%eax
+801038e1:	e8 f5 ee ff ff       	call   801027db <dcacheput>
+  if(dp->ndirhash){
+801038e6:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+801038ec:	85 c0                	test   %eax,%eax
+801038ee:	75 15                	jne    80103905 <dirlink+0xd0>
+}
+801038f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801038f3:	5b                   	pop    %ebx
+801038f4:	5e                   	pop    %esi
+801038f5:	5f                   	pop    %edi
+801038f6:	5d                   	pop    %ebp
+801038f7:	c3                   	ret
+    panic("dirlink");
+801038f8:	83 ec 0c             	sub    $0xc,%esp
+801038fb:	68 20 bd 10 80       	push   $0x8010bd20
+80103900:	e8 21 d2 ff ff       	call   80100b26 <panic>
+    dp->dirfree = off + sizeof(de);
+80103905:	8d 46 10             	lea    0x10(%esi),%eax
+80103908:	89 83 30 01 00 00    	mov    %eax,0x130(%ebx)
+    dirindexadd(dp, name, off);
+8010390e:	89 f1                	mov    %esi,%ecx
+80103910:	8b 55 0c             	mov    0xc(%ebp),%edx
+80103913:	89 d8                	mov    %ebx,%eax
+80103915:	e8 f5 e3 ff ff       	call   80101d0f <dirindexadd>
+    if(2 * dp->dirused > dp->ndirhash * DIRSLOTS)
+8010391a:	8b 83 2c 01 00 00    	mov    0x12c(%ebx),%eax
+80103920:	01 c0                	add    %eax,%eax
+80103922:	8b 93 28 01 00 00    	mov    0x128(%ebx),%edx
+80103928:	c1 e2 0a             	shl    $0xa,%edx
+8010392b:	39 c2                	cmp    %eax,%edx
+8010392d:	72 07                	jb     80103936 <dirlink+0x101>
+  return 0;
+8010392f:	b8 00 00 00 00       	mov    $0x0,%eax
+80103934:	eb ba                	jmp    801038f0 <dirlink+0xbb>
+      dirindex(dp);
+80103936:	89 d8                	mov    %ebx,%eax
+80103938:	e8 5b ed ff ff       	call   80102698 <dirindex>
+  return 0;
+8010393d:	b8 00 00 00 00       	mov    $0x0,%eax
+80103942:	eb ac                	jmp    801038f0 <dirlink+0xbb>
+
+80103944 <dirunlink>:
+{
+80103944:	55                   	push   %ebp
+80103945:	89 e5                	mov    %esp,%ebp
+80103947:	57                   	push   %edi
+80103948:	56                   	push   %esi
+80103949:	53                   	push   %ebx
+8010394a:	83 ec 2c             	sub    $0x2c,%esp
+8010394d:	8b 75 08             	mov    0x8(%ebp),%esi
+80103950:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103953:	6a 10                	push   $0x10
+80103955:	57                   	push   %edi
+80103956:	8d 45 d8             	lea    -0x28(%ebp),%eax
+80103959:	50                   	push   %eax
+8010395a:	56                   	push   %esi
+8010395b:	e8 08 f7 ff ff       	call   80103068 <readi>
+80103960:	83 c4 10             	add    $0x10,%esp
+80103963:	83 f8 10             	cmp    $0x10,%eax
+80103966:	75 4d                	jne    801039b5 <dirunlink+0x71>
+  if(dp->ndirhash){
+80103968:	8b 86 28 01 00 00    	mov    0x128(%esi),%eax
+8010396e:	85 c0                	test   %eax,%eax
+80103970:	74 64                	je     801039d6 <dirunlink+0x92>
+    n = dp->ndirhash * DIRSLOTS;
+80103972:	c1 e0 0a             	shl    $0xa,%eax
+80103975:	89 c3                	mov    %eax,%ebx
+80103977:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    for(i = dirhash(de.name) % n; (v = *dirslot(dp, i)) != 0; i = (i + 1) % n){
+8010397a:	8d 45 da             	lea    -0x26(%ebp),%eax
+8010397d:	e8 33 e3 ff ff       	call   80101cb5 <dirhash>
+80103982:	ba 00 00 00 00       	mov    $0x0,%edx
+80103987:	f7 f3                	div    %ebx
+80103989:	89 d3                	mov    %edx,%ebx
+8010398b:	89 da                	mov    %ebx,%edx
+8010398d:	89 f0                	mov    %esi,%eax
+8010398f:	e8 57 e3 ff ff       	call   80101ceb <dirslot>
+80103994:	8b 08                	mov    (%eax),%ecx
+80103996:	85 c9                	test   %ecx,%ecx
+80103998:	74 2e                	je     801039c8 <dirunlink+0x84>
+      if(v == off / sizeof(de) + 1){
+8010399a:	89 fa                	mov    %edi,%edx
+8010399c:	c1 ea 04             	shr    $0x4,%edx
+8010399f:	83 c2 01             	add    $0x1,%edx
+801039a2:	39 ca                	cmp    %ecx,%edx
+801039a4:	74 1c                	je     801039c2 <dirunlink+0x7e>
+    for(i = dirhash(de.name) % n; (v = *dirslot(dp, i)) != 0; i = (i + 1) % n){
+801039a6:	8d 43 01             	lea    0x1(%ebx),%eax
+801039a9:	ba 00 00 00 00       	mov    $0x0,%edx
+801039ae:	f7 75 d4             	divl   -0x2c(%ebp)
+801039b1:	89 d3                	mov    %edx,%ebx
+801039b3:	eb d6                	jmp    8010398b <dirunlink+0x47>
+    panic("dirunlink read");
+801039b5:	83 ec 0c             	sub    $0xc,%esp
+801039b8:	68 55 b3 10 80       	push   $0x8010b355
+801039bd:	e8 64 d1 ff ff       	call   80100b26 <panic>
+        *dirslot(dp, i) = DIRDEL;
+801039c2:	c7 00 ff ff ff ff    	movl   $0xffffffff,(%eax)
+    if(off < dp->dirfree)
+801039c8:	3b be 30 01 00 00    	cmp    0x130(%esi),%edi
+801039ce:	73 06                	jae    801039d6 <dirunlink+0x92>
+      dp->dirfree = off;
+801039d0:	89 be 30 01 00 00    	mov    %edi,0x130(%esi)
+  dcacheput(dp, de.name, 0);
+801039d6:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+801039d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+801039de:	8d 55 da             	lea    -0x26(%ebp),%edx
+801039e1:	89 f0                	mov    %esi,%eax
+801039e3:	e8 f3 ed ff ff       	call   801027db <dcacheput>
+  memset(&de, 0, sizeof(de));
+801039e8:	83 ec 04             	sub    $0x4,%esp
+801039eb:	6a 10                	push   $0x10
+801039ed:	6a 00                	push   $0x0
+801039ef:	53                   	push   %ebx
+801039f0:	e8 82 40 00 00       	call   80107a77 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801039f5:	6a 10                	push   $0x10
+801039f7:	57                   	push   %edi
+801039f8:	53                   	push   %ebx
+801039f9:	56                   	push   %esi
+801039fa:	e8 ce f9 ff ff       	call   801033cd <writei>
+801039ff:	83 c4 20             	add    $0x20,%esp
+80103a02:	83 f8 10             	cmp    $0x10,%eax
+80103a05:	75 08                	jne    80103a0f <dirunlink+0xcb>
+}
+80103a07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103a0a:	5b                   	pop    %ebx
+80103a0b:	5e                   	pop    %esi
+80103a0c:	5f                   	pop    %edi
+80103a0d:	5d                   	pop    %ebp
+80103a0e:	c3                   	ret
+    panic("unlink: writei");
+80103a0f:	83 ec 0c             	sub    $0xc,%esp
+80103a12:	68 64 b3 10 80       	push   $0x8010b364
+80103a17:	e8 0a d1 ff ff       	call   80100b26 <panic>
+
+80103a1c <namei>:
+
+struct inode*
+namei(char *path)
+{
+80103a1c:	55                   	push   %ebp
+80103a1d:	89 e5                	mov    %esp,%ebp
+80103a1f:	83 ec 18             	sub    $0x18,%esp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80103a22:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+80103a25:	ba 00 00 00 00       	mov    $0x0,%edx
+80103a2a:	8b 45 08             	mov    0x8(%ebp),%eax
+80103a2d:	e8 1a fd ff ff       	call   8010374c <namex>
+}
+80103a32:	c9                   	leave
+80103a33:	c3                   	ret
+
+80103a34 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80103a34:	55                   	push   %ebp
+80103a35:	89 e5                	mov    %esp,%ebp
+80103a37:	83 ec 08             	sub    $0x8,%esp
+  return namex(path, 1, name);
+80103a3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80103a3d:	ba 01 00 00 00       	mov    $0x1,%edx
+80103a42:	8b 45 08             	mov    0x8(%ebp),%eax
+80103a45:	e8 02 fd ff ff       	call   8010374c <namex>
+}
+80103a4a:	c9                   	leave
+80103a4b:	c3                   	ret
+
+80103a4c <ioapicread>:
+};
+
+static uint
+ioapicread(int reg)
+{
+  ioapic->reg = reg;
+80103a4c:	8b 15 38 ea 31 80    	mov    0x8031ea38,%edx
+80103a52:	89 02                	mov    %eax,(%edx)
+  return ioapic->data;
+80103a54:	a1 38 ea 31 80       	mov    0x8031ea38,%eax
+80103a59:	8b 40 10             	mov    0x10(%eax),%eax
+}
+80103a5c:	c3                   	ret
+
+80103a5d <ioapicwrite>:
+
+static void
+ioapicwrite(int reg, uint data)
+{
+  ioapic->reg = reg;
+80103a5d:	8b 0d 38 ea 31 80    	mov    0x8031ea38,%ecx
+80103a63:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80103a65:	a1 38 ea 31 80       	mov    0x8031ea38,%eax
+80103a6a:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80103a6d:	c3                   	ret
+
+80103a6e <ioapicinit>:
+
+void
+ioapicinit(void)
+{
+80103a6e:	55                   	push   %ebp
+80103a6f:	89 e5                	mov    %esp,%ebp
+80103a71:	57                   	push   %edi
+80103a72:	56                   	push   %esi
+80103a73:	53                   	push   %ebx
+80103a74:	83 ec 0c             	sub    $0xc,%esp
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+80103a77:	c7 05 38 ea 31 80 00 	movl   $0xfec00000,0x8031ea38
+80103a7e:	00 c0 fe 
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+80103a81:	b8 01 00 00 00       	mov    $0x1,%eax
+80103a86:	e8 c1 ff ff ff       	call   80103a4c <ioapicread>
+80103a8b:	c1 e8 10             	shr    $0x10,%eax
+80103a8e:	0f b6 f8             	movzbl %al,%edi
+  id = ioapicread(REG_ID) >> 24;
+80103a91:	b8 00 00 00 00       	mov    $0x0,%eax
+80103a96:	e8 b1 ff ff ff       	call   80103a4c <ioapicread>
+80103a9b:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+80103a9e:	0f b6 15 80 ad 33 80 	movzbl 0x8033ad80,%edx
+80103aa5:	39 c2                	cmp    %eax,%edx
+80103aa7:	75 07                	jne    80103ab0 <ioapicinit+0x42>
+{
+80103aa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103aae:	eb 36                	jmp    80103ae6 <ioapicinit+0x78>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80103ab0:	83 ec 0c             	sub    $0xc,%esp
+80103ab3:	68 c8 b3 10 80       	push   $0x8010b3c8
+80103ab8:	e8 2a d3 ff ff       	call   80100de7 <cprintf>
+80103abd:	83 c4 10             	add    $0x10,%esp
+80103ac0:	eb e7                	jmp    80103aa9 <ioapicinit+0x3b>
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+80103ac2:	8d 53 20             	lea    0x20(%ebx),%edx
+80103ac5:	81 ca 00 00 01 00    	or     $0x10000,%edx
+80103acb:	8d 74 1b 10          	lea    0x10(%ebx,%ebx,1),%esi
+80103acf:	89 f0                	mov    %esi,%eax
+80103ad1:	e8 87 ff ff ff       	call   80103a5d <ioapicwrite>
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+80103ad6:	8d 46 01             	lea    0x1(%esi),%eax
+80103ad9:	ba 00 00 00 00       	mov    $0x0,%edx
+80103ade:	e8 7a ff ff ff       	call   80103a5d <ioapicwrite>
+  for(i = 0; i <= maxintr; i++){
+80103ae3:	83 c3 01             	add    $0x1,%ebx
+80103ae6:	39 fb                	cmp    %edi,%ebx
+80103ae8:	7e d8                	jle    80103ac2 <ioapicinit+0x54>
+  }
+}
+80103aea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103aed:	5b                   	pop    %ebx
+80103aee:	5e                   	pop    %esi
+80103aef:	5f                   	pop    %edi
+80103af0:	5d                   	pop    %ebp
+80103af1:	c3                   	ret
+
+80103af2 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80103af2:	55                   	push   %ebp
+80103af3:	89 e5                	mov    %esp,%ebp
+80103af5:	53                   	push   %ebx
+80103af6:	83 ec 04             	sub    $0x4,%esp
+80103af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+80103afc:	8d 50 20             	lea    0x20(%eax),%edx
+80103aff:	8d 5c 00 10          	lea    0x10(%eax,%eax,1),%ebx
+80103b03:	89 d8                	mov    %ebx,%eax
+80103b05:	e8 53 ff ff ff       	call   80103a5d <ioapicwrite>
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80103b0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+80103b0d:	c1 e2 18             	shl    $0x18,%edx
+80103b10:	8d 43 01             	lea    0x1(%ebx),%eax
+80103b13:	e8 45 ff ff ff       	call   80103a5d <ioapicwrite>
+}
+80103b18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103b1b:	c9                   	leave
+80103b1c:	c3                   	ret
+
+80103b1d <ioapicroute>:
+// Like ioapicenable, but deliver interrupt irq as if it were
+// interrupt vec, for devices whose line is only known once
+// their PCI configuration has been read.
+void
+ioapicroute(int irq, int vec, int cpunum)
+{
+80103b1d:	55                   	push   %ebp
+80103b1e:	89 e5                	mov    %esp,%ebp
+80103b20:	53                   	push   %ebx
+80103b21:	83 ec 04             	sub    $0x4,%esp
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + vec);
+80103b24:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103b27:	8d 50 20             	lea    0x20(%eax),%edx
+80103b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+80103b2d:	8d 5c 00 10          	lea    0x10(%eax,%eax,1),%ebx
+80103b31:	89 d8                	mov    %ebx,%eax
+80103b33:	e8 25 ff ff ff       	call   80103a5d <ioapicwrite>
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80103b38:	8b 55 10             	mov    0x10(%ebp),%edx
+80103b3b:	c1 e2 18             	shl    $0x18,%edx
+80103b3e:	8d 43 01             	lea    0x1(%ebx),%eax
+80103b41:	e8 17 ff ff ff       	call   80103a5d <ioapicwrite>
+}
+80103b46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103b49:	c9                   	leave
+80103b4a:	c3                   	ret
+
+80103b4b <kdrain>:
+// Move the pages cached by every CPU back to kmem, so a CPU that
+// has run dry can use pages the others are holding on to.
+// Returns the number of pages moved.
+static int
+kdrain(void)
+{
+80103b4b:	55                   	push   %ebp
+80103b4c:	89 e5                	mov    %esp,%ebp
+80103b4e:	57                   	push   %edi
+80103b4f:	56                   	push   %esi
+80103b50:	53                   	push   %ebx
+80103b51:	83 ec 0c             	sub    $0xc,%esp
+  struct kcache *c;
+  struct run *r;
+  int n;
+
+  n = 0;
+80103b54:	be 00 00 00 00       	mov    $0x0,%esi
+  for(c = kcache; c < &kcache[NCPU]; c++){
+80103b59:	bb 80 aa 33 80       	mov    $0x8033aa80,%ebx
+80103b5e:	eb 47                	jmp    80103ba7 <kdrain+0x5c>
+    if(c->n == 0)
+      continue;
+    acquire(&c->lock);
+    acquire(&kmem.lock);
+    while((r = c->freelist) != 0){
+      c->freelist = r->next;
+80103b60:	8b 10                	mov    (%eax),%edx
+80103b62:	89 53 34             	mov    %edx,0x34(%ebx)
+      r->next = kmem.freelist;
+80103b65:	8b 15 78 ea 31 80    	mov    0x8031ea78,%edx
+80103b6b:	89 10                	mov    %edx,(%eax)
+      kmem.freelist = r;
+80103b6d:	a3 78 ea 31 80       	mov    %eax,0x8031ea78
+      n++;
+80103b72:	83 c6 01             	add    $0x1,%esi
+    while((r = c->freelist) != 0){
+80103b75:	8b 43 34             	mov    0x34(%ebx),%eax
+80103b78:	85 c0                	test   %eax,%eax
+80103b7a:	75 e4                	jne    80103b60 <kdrain+0x15>
+    }
+    kmem.nfree += c->n;
+80103b7c:	8b 43 38             	mov    0x38(%ebx),%eax
+80103b7f:	01 05 7c ea 31 80    	add    %eax,0x8031ea7c
+    c->n = 0;
+80103b85:	c7 43 38 00 00 00 00 	movl   $0x0,0x38(%ebx)
+    release(&kmem.lock);
+80103b8c:	83 ec 0c             	sub    $0xc,%esp
+80103b8f:	68 40 ea 31 80       	push   $0x8031ea40
+80103b94:	e8 97 3e 00 00       	call   80107a30 <release>
+    release(&c->lock);
+80103b99:	89 3c 24             	mov    %edi,(%esp)
+80103b9c:	e8 8f 3e 00 00       	call   80107a30 <release>
+80103ba1:	83 c4 10             	add    $0x10,%esp
+  for(c = kcache; c < &kcache[NCPU]; c++){
+80103ba4:	83 c3 40             	add    $0x40,%ebx
+80103ba7:	81 fb 80 ac 33 80    	cmp    $0x8033ac80,%ebx
+80103bad:	73 22                	jae    80103bd1 <kdrain+0x86>
+    if(c->n == 0)
+80103baf:	83 7b 38 00          	cmpl   $0x0,0x38(%ebx)
+80103bb3:	74 ef                	je     80103ba4 <kdrain+0x59>
+    acquire(&c->lock);
+80103bb5:	89 df                	mov    %ebx,%edi
+80103bb7:	83 ec 0c             	sub    $0xc,%esp
+80103bba:	53                   	push   %ebx
+80103bbb:	e8 0b 3e 00 00       	call   801079cb <acquire>
+    acquire(&kmem.lock);
+80103bc0:	c7 04 24 40 ea 31 80 	movl   $0x8031ea40,(%esp)
+80103bc7:	e8 ff 3d 00 00       	call   801079cb <acquire>
+    while((r = c->freelist) != 0){
+80103bcc:	83 c4 10             	add    $0x10,%esp
+80103bcf:	eb a4                	jmp    80103b75 <kdrain+0x2a>
+  }
+  return n;
+}
+80103bd1:	89 f0                	mov    %esi,%eax
+80103bd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103bd6:	5b                   	pop    %ebx
+80103bd7:	5e                   	pop    %esi
+80103bd8:	5f                   	pop    %edi
+80103bd9:	5d                   	pop    %ebp
+80103bda:	c3                   	ret
+
+80103bdb <kalloc1>:
+{
+80103bdb:	55                   	push   %ebp
+80103bdc:	89 e5                	mov    %esp,%ebp
+80103bde:	57                   	push   %edi
+80103bdf:	56                   	push   %esi
+80103be0:	53                   	push   %ebx
+80103be1:	83 ec 0c             	sub    $0xc,%esp
+  if(!kmem.use_lock){
+80103be4:	83 3d 74 ea 31 80 00 	cmpl   $0x0,0x8031ea74
+80103beb:	75 37                	jne    80103c24 <kalloc1+0x49>
+    r = kmem.freelist;
+80103bed:	8b 35 78 ea 31 80    	mov    0x8031ea78,%esi
+    if(r){
+80103bf3:	85 f6                	test   %esi,%esi
+80103bf5:	0f 84 9f 00 00 00    	je     80103c9a <kalloc1+0xbf>
+      kmem.freelist = r->next;
+80103bfb:	8b 06                	mov    (%esi),%eax
+80103bfd:	a3 78 ea 31 80       	mov    %eax,0x8031ea78
+      kmem.nfree--;
+80103c02:	a1 7c ea 31 80       	mov    0x8031ea7c,%eax
+80103c07:	83 e8 01             	sub    $0x1,%eax
+80103c0a:	a3 7c ea 31 80       	mov    %eax,0x8031ea7c
+      KREF(r) = 1;
+80103c0f:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80103c15:	c1 e8 0c             	shr    $0xc,%eax
+80103c18:	66 c7 84 00 80 ea 31 	movw   $0x1,-0x7fce1580(%eax,%eax,1)
+80103c1f:	80 01 00 
+    return (char*)r;
+80103c22:	eb 76                	jmp    80103c9a <kalloc1+0xbf>
+  pushcli();
+80103c24:	e8 bf 3c 00 00       	call   801078e8 <pushcli>
+  c = &kcache[cpuid()];
+80103c29:	e8 0e 21 00 00       	call   80105d3c <cpuid>
+80103c2e:	89 c3                	mov    %eax,%ebx
+  acquire(&c->lock);
+80103c30:	89 c7                	mov    %eax,%edi
+80103c32:	c1 e7 06             	shl    $0x6,%edi
+80103c35:	81 c7 80 aa 33 80    	add    $0x8033aa80,%edi
+80103c3b:	83 ec 0c             	sub    $0xc,%esp
+80103c3e:	57                   	push   %edi
+80103c3f:	e8 87 3d 00 00       	call   801079cb <acquire>
+  if(c->freelist == 0){
+80103c44:	83 c4 10             	add    $0x10,%esp
+80103c47:	83 7f 34 00          	cmpl   $0x0,0x34(%edi)
+80103c4b:	74 57                	je     80103ca4 <kalloc1+0xc9>
+  r = c->freelist;
+80103c4d:	89 d8                	mov    %ebx,%eax
+80103c4f:	c1 e0 06             	shl    $0x6,%eax
+80103c52:	8b b0 b4 aa 33 80    	mov    -0x7fcc554c(%eax),%esi
+  if(r){
+80103c58:	85 f6                	test   %esi,%esi
+80103c5a:	74 2d                	je     80103c89 <kalloc1+0xae>
+    c->freelist = r->next;
+80103c5c:	8b 06                	mov    (%esi),%eax
+80103c5e:	c1 e3 06             	shl    $0x6,%ebx
+80103c61:	89 83 b4 aa 33 80    	mov    %eax,-0x7fcc554c(%ebx)
+    c->n--;
+80103c67:	8b 83 b8 aa 33 80    	mov    -0x7fcc5548(%ebx),%eax
+80103c6d:	83 e8 01             	sub    $0x1,%eax
+80103c70:	89 83 b8 aa 33 80    	mov    %eax,-0x7fcc5548(%ebx)
+    KREF(r) = 1;
+80103c76:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80103c7c:	c1 e8 0c             	shr    $0xc,%eax
+80103c7f:	66 c7 84 00 80 ea 31 	movw   $0x1,-0x7fce1580(%eax,%eax,1)
+80103c86:	80 01 00 
+  release(&c->lock);
+80103c89:	83 ec 0c             	sub    $0xc,%esp
+80103c8c:	57                   	push   %edi
+80103c8d:	e8 9e 3d 00 00       	call   80107a30 <release>
+  popcli();
+80103c92:	e8 95 3c 00 00       	call   8010792c <popcli>
+  return (char*)r;
+80103c97:	83 c4 10             	add    $0x10,%esp
+}
+80103c9a:	89 f0                	mov    %esi,%eax
+80103c9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103c9f:	5b                   	pop    %ebx
+80103ca0:	5e                   	pop    %esi
+80103ca1:	5f                   	pop    %edi
+80103ca2:	5d                   	pop    %ebp
+80103ca3:	c3                   	ret
+    acquire(&kmem.lock);
+80103ca4:	83 ec 0c             	sub    $0xc,%esp
+80103ca7:	68 40 ea 31 80       	push   $0x8031ea40
+80103cac:	e8 1a 3d 00 00       	call   801079cb <acquire>
+    while(c->n < KBATCH && (r = kmem.freelist) != 0){
+80103cb1:	83 c4 10             	add    $0x10,%esp
+80103cb4:	eb 36                	jmp    80103cec <kalloc1+0x111>
+      kmem.freelist = r->next;
+80103cb6:	8b 02                	mov    (%edx),%eax
+80103cb8:	a3 78 ea 31 80       	mov    %eax,0x8031ea78
+      kmem.nfree--;
+80103cbd:	a1 7c ea 31 80       	mov    0x8031ea7c,%eax
+80103cc2:	83 e8 01             	sub    $0x1,%eax
+80103cc5:	a3 7c ea 31 80       	mov    %eax,0x8031ea7c
+      r->next = c->freelist;
+80103cca:	89 d8                	mov    %ebx,%eax
+80103ccc:	c1 e0 06             	shl    $0x6,%eax
+80103ccf:	8b 88 b4 aa 33 80    	mov    -0x7fcc554c(%eax),%ecx
+80103cd5:	89 0a                	mov    %ecx,(%edx)
+      c->freelist = r;
+80103cd7:	89 90 b4 aa 33 80    	mov    %edx,-0x7fcc554c(%eax)
+      c->n++;
+80103cdd:	8b 88 b8 aa 33 80    	mov    -0x7fcc5548(%eax),%ecx
+80103ce3:	8d 51 01             	lea    0x1(%ecx),%edx
+80103ce6:	89 90 b8 aa 33 80    	mov    %edx,-0x7fcc5548(%eax)
+    while(c->n < KBATCH && (r = kmem.freelist) != 0){
+80103cec:	89 d8                	mov    %ebx,%eax
+80103cee:	c1 e0 06             	shl    $0x6,%eax
+80103cf1:	83 b8 b8 aa 33 80 1f 	cmpl   $0x1f,-0x7fcc5548(%eax)
+80103cf8:	7f 0a                	jg     80103d04 <kalloc1+0x129>
+80103cfa:	8b 15 78 ea 31 80    	mov    0x8031ea78,%edx
+80103d00:	85 d2                	test   %edx,%edx
+80103d02:	75 b2                	jne    80103cb6 <kalloc1+0xdb>
+    release(&kmem.lock);
+80103d04:	83 ec 0c             	sub    $0xc,%esp
+80103d07:	68 40 ea 31 80       	push   $0x8031ea40
+80103d0c:	e8 1f 3d 00 00       	call   80107a30 <release>
+80103d11:	83 c4 10             	add    $0x10,%esp
+80103d14:	e9 34 ff ff ff       	jmp    80103c4d <kalloc1+0x72>
+
+80103d19 <kincref>:
+{
+80103d19:	55                   	push   %ebp
+80103d1a:	89 e5                	mov    %esp,%ebp
+80103d1c:	83 ec 08             	sub    $0x8,%esp
+80103d1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80103d22:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80103d27:	75 23                	jne    80103d4c <kincref+0x33>
+80103d29:	3d 10 70 34 80       	cmp    $0x80347010,%eax
+80103d2e:	72 1c                	jb     80103d4c <kincref+0x33>
+80103d30:	05 00 00 00 80       	add    $0x80000000,%eax
+80103d35:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80103d3a:	77 10                	ja     80103d4c <kincref+0x33>
+  __sync_fetch_and_add(&KREF(v), 1);
+80103d3c:	c1 e8 0c             	shr    $0xc,%eax
+80103d3f:	01 c0                	add    %eax,%eax
+80103d41:	66 f0 83 80 80 ea 31 	lock addw $0x1,-0x7fce1580(%eax)
+80103d48:	80 01 
+}
+80103d4a:	c9                   	leave
+80103d4b:	c3                   	ret
+    panic("kincref");
+80103d4c:	83 ec 0c             	sub    $0xc,%esp
+80103d4f:	68 fa b3 10 80       	push   $0x8010b3fa
+80103d54:	e8 cd cd ff ff       	call   80100b26 <panic>
+
+80103d59 <krefcount>:
+{
+80103d59:	55                   	push   %ebp
+80103d5a:	89 e5                	mov    %esp,%ebp
+  return KREF(v);
+80103d5c:	8b 45 08             	mov    0x8(%ebp),%eax
+80103d5f:	05 00 00 00 80       	add    $0x80000000,%eax
+80103d64:	c1 e8 0c             	shr    $0xc,%eax
+80103d67:	0f b7 84 00 80 ea 31 	movzwl -0x7fce1580(%eax,%eax,1),%eax
+80103d6e:	80 
+}
+80103d6f:	5d                   	pop    %ebp
+80103d70:	c3                   	ret
+
+80103d71 <kfree>:
+{
+80103d71:	55                   	push   %ebp
+80103d72:	89 e5                	mov    %esp,%ebp
+80103d74:	57                   	push   %edi
+80103d75:	56                   	push   %esi
+80103d76:	53                   	push   %ebx
+80103d77:	83 ec 1c             	sub    $0x1c,%esp
+80103d7a:	8b 75 08             	mov    0x8(%ebp),%esi
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80103d7d:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+80103d83:	75 42                	jne    80103dc7 <kfree+0x56>
+80103d85:	81 fe 10 70 34 80    	cmp    $0x80347010,%esi
+80103d8b:	72 3a                	jb     80103dc7 <kfree+0x56>
+80103d8d:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80103d93:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80103d98:	77 2d                	ja     80103dc7 <kfree+0x56>
+  if(KREF(v) == 0)
+80103d9a:	c1 e8 0c             	shr    $0xc,%eax
+80103d9d:	66 83 bc 00 80 ea 31 	cmpw   $0x0,-0x7fce1580(%eax,%eax,1)
+80103da4:	80 00 
+80103da6:	74 2c                	je     80103dd4 <kfree+0x63>
+  if(__sync_sub_and_fetch(&KREF(v), 1) > 0)
+80103da8:	8d 84 00 80 ea 31 80 	lea    -0x7fce1580(%eax,%eax,1),%eax
+80103daf:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+80103db4:	66 f0 0f c1 10       	lock xadd %dx,(%eax)
+80103db9:	66 83 fa 01          	cmp    $0x1,%dx
+80103dbd:	74 22                	je     80103de1 <kfree+0x70>
+}
+80103dbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103dc2:	5b                   	pop    %ebx
+80103dc3:	5e                   	pop    %esi
+80103dc4:	5f                   	pop    %edi
+80103dc5:	5d                   	pop    %ebp
+80103dc6:	c3                   	ret
+    panic("kfree");
+80103dc7:	83 ec 0c             	sub    $0xc,%esp
+80103dca:	68 02 b4 10 80       	push   $0x8010b402
+80103dcf:	e8 52 cd ff ff       	call   80100b26 <panic>
+    panic("kfree: free page");
+80103dd4:	83 ec 0c             	sub    $0xc,%esp
+80103dd7:	68 08 b4 10 80       	push   $0x8010b408
+80103ddc:	e8 45 cd ff ff       	call   80100b26 <panic>
+  memset(v, 1, PGSIZE);
+80103de1:	83 ec 04             	sub    $0x4,%esp
+80103de4:	68 00 10 00 00       	push   $0x1000
+80103de9:	6a 01                	push   $0x1
+80103deb:	56                   	push   %esi
+80103dec:	e8 86 3c 00 00       	call   80107a77 <memset>
+  if(!kmem.use_lock){
+80103df1:	83 c4 10             	add    $0x10,%esp
+80103df4:	83 3d 74 ea 31 80 00 	cmpl   $0x0,0x8031ea74
+80103dfb:	75 1c                	jne    80103e19 <kfree+0xa8>
+    r->next = kmem.freelist;
+80103dfd:	a1 78 ea 31 80       	mov    0x8031ea78,%eax
+80103e02:	89 06                	mov    %eax,(%esi)
+    kmem.freelist = r;
+80103e04:	89 35 78 ea 31 80    	mov    %esi,0x8031ea78
+    kmem.nfree++;
+80103e0a:	a1 7c ea 31 80       	mov    0x8031ea7c,%eax
+80103e0f:	83 c0 01             	add    $0x1,%eax
+80103e12:	a3 7c ea 31 80       	mov    %eax,0x8031ea7c
+    return;
+80103e17:	eb a6                	jmp    80103dbf <kfree+0x4e>
+  pushcli();
+80103e19:	e8 ca 3a 00 00       	call   801078e8 <pushcli>
+  c = &kcache[cpuid()];
+80103e1e:	e8 19 1f 00 00       	call   80105d3c <cpuid>
+80103e23:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquire(&c->lock);
+80103e26:	89 c7                	mov    %eax,%edi
+80103e28:	c1 e7 06             	shl    $0x6,%edi
+80103e2b:	81 c7 80 aa 33 80    	add    $0x8033aa80,%edi
+80103e31:	83 ec 0c             	sub    $0xc,%esp
+80103e34:	57                   	push   %edi
+80103e35:	e8 91 3b 00 00       	call   801079cb <acquire>
+  r->next = c->freelist;
+80103e3a:	8b 47 34             	mov    0x34(%edi),%eax
+80103e3d:	89 06                	mov    %eax,(%esi)
+  c->freelist = r;
+80103e3f:	89 77 34             	mov    %esi,0x34(%edi)
+  if(++c->n > KCACHE){
+80103e42:	8b 57 38             	mov    0x38(%edi),%edx
+80103e45:	8d 42 01             	lea    0x1(%edx),%eax
+80103e48:	89 47 38             	mov    %eax,0x38(%edi)
+80103e4b:	83 c4 10             	add    $0x10,%esp
+80103e4e:	83 f8 40             	cmp    $0x40,%eax
+80103e51:	7f 6f                	jg     80103ec2 <kfree+0x151>
+  release(&c->lock);
+80103e53:	83 ec 0c             	sub    $0xc,%esp
+80103e56:	57                   	push   %edi
+80103e57:	e8 d4 3b 00 00       	call   80107a30 <release>
+  popcli();
+80103e5c:	e8 cb 3a 00 00       	call   8010792c <popcli>
+80103e61:	83 c4 10             	add    $0x10,%esp
+80103e64:	e9 56 ff ff ff       	jmp    80103dbf <kfree+0x4e>
+      tail = tail->next;
+80103e69:	8b 1b                	mov    (%ebx),%ebx
+    for(head = tail = c->freelist, i = 1; i < KBATCH; i++)
+80103e6b:	83 c0 01             	add    $0x1,%eax
+80103e6e:	83 f8 1f             	cmp    $0x1f,%eax
+80103e71:	7e f6                	jle    80103e69 <kfree+0xf8>
+    c->freelist = tail->next;
+80103e73:	8b 0b                	mov    (%ebx),%ecx
+80103e75:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103e78:	c1 e0 06             	shl    $0x6,%eax
+80103e7b:	89 88 b4 aa 33 80    	mov    %ecx,-0x7fcc554c(%eax)
+    c->n -= KBATCH;
+80103e81:	83 ea 1f             	sub    $0x1f,%edx
+80103e84:	89 90 b8 aa 33 80    	mov    %edx,-0x7fcc5548(%eax)
+    acquire(&kmem.lock);
+80103e8a:	83 ec 0c             	sub    $0xc,%esp
+80103e8d:	68 40 ea 31 80       	push   $0x8031ea40
+80103e92:	e8 34 3b 00 00       	call   801079cb <acquire>
+    tail->next = kmem.freelist;
+80103e97:	a1 78 ea 31 80       	mov    0x8031ea78,%eax
+80103e9c:	89 03                	mov    %eax,(%ebx)
+    kmem.freelist = head;
+80103e9e:	89 35 78 ea 31 80    	mov    %esi,0x8031ea78
+    kmem.nfree += KBATCH;
+80103ea4:	a1 7c ea 31 80       	mov    0x8031ea7c,%eax
+80103ea9:	83 c0 20             	add    $0x20,%eax
+80103eac:	a3 7c ea 31 80       	mov    %eax,0x8031ea7c
+    release(&kmem.lock);
+80103eb1:	c7 04 24 40 ea 31 80 	movl   $0x8031ea40,(%esp)
+80103eb8:	e8 73 3b 00 00       	call   80107a30 <release>
+80103ebd:	83 c4 10             	add    $0x10,%esp
+80103ec0:	eb 91                	jmp    80103e53 <kfree+0xe2>
+    for(head = tail = c->freelist, i = 1; i < KBATCH; i++)
+80103ec2:	89 f3                	mov    %esi,%ebx
+80103ec4:	b8 01 00 00 00       	mov    $0x1,%eax
+80103ec9:	eb a3                	jmp    80103e6e <kfree+0xfd>
+
+80103ecb <freerange>:
+{
+80103ecb:	55                   	push   %ebp
+80103ecc:	89 e5                	mov    %esp,%ebp
+80103ece:	56                   	push   %esi
+80103ecf:	53                   	push   %ebx
+80103ed0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80103ed3:	8b 45 08             	mov    0x8(%ebp),%eax
+80103ed6:	05 ff 0f 00 00       	add    $0xfff,%eax
+80103edb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80103ee0:	eb 21                	jmp    80103f03 <freerange+0x38>
+    KREF(p) = 1;
+80103ee2:	8d 90 00 00 00 80    	lea    -0x80000000(%eax),%edx
+80103ee8:	c1 ea 0c             	shr    $0xc,%edx
+80103eeb:	66 c7 84 12 80 ea 31 	movw   $0x1,-0x7fce1580(%edx,%edx,1)
+80103ef2:	80 01 00 
+    kfree(p);
+80103ef5:	83 ec 0c             	sub    $0xc,%esp
+80103ef8:	50                   	push   %eax
+80103ef9:	e8 73 fe ff ff       	call   80103d71 <kfree>
+80103efe:	83 c4 10             	add    $0x10,%esp
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80103f01:	89 f0                	mov    %esi,%eax
+80103f03:	8d b0 00 10 00 00    	lea    0x1000(%eax),%esi
+80103f09:	39 f3                	cmp    %esi,%ebx
+80103f0b:	73 d5                	jae    80103ee2 <freerange+0x17>
+}
+80103f0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103f10:	5b                   	pop    %ebx
+80103f11:	5e                   	pop    %esi
+80103f12:	5d                   	pop    %ebp
+80103f13:	c3                   	ret
+
+80103f14 <kinit1>:
+{
+80103f14:	55                   	push   %ebp
+80103f15:	89 e5                	mov    %esp,%ebp
+80103f17:	53                   	push   %ebx
+80103f18:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&kmem.lock, "kmem");
+80103f1b:	68 19 b4 10 80       	push   $0x8010b419
+80103f20:	68 40 ea 31 80       	push   $0x8031ea40
+80103f25:	e8 5d 39 00 00       	call   80107887 <initlock>
+  for(c = kcache; c < &kcache[NCPU]; c++)
+80103f2a:	83 c4 10             	add    $0x10,%esp
+80103f2d:	bb 80 aa 33 80       	mov    $0x8033aa80,%ebx
+80103f32:	eb 14                	jmp    80103f48 <kinit1+0x34>
+    initlock(&c->lock, "kcache");
+80103f34:	83 ec 08             	sub    $0x8,%esp
+80103f37:	68 1e b4 10 80       	push   $0x8010b41e
+80103f3c:	53                   	push   %ebx
+80103f3d:	e8 45 39 00 00       	call   80107887 <initlock>
+  for(c = kcache; c < &kcache[NCPU]; c++)
+80103f42:	83 c3 40             	add    $0x40,%ebx
+80103f45:	83 c4 10             	add    $0x10,%esp
+80103f48:	81 fb 80 ac 33 80    	cmp    $0x8033ac80,%ebx
+80103f4e:	72 e4                	jb     80103f34 <kinit1+0x20>
+  kmem.use_lock = 0;
+80103f50:	c7 05 74 ea 31 80 00 	movl   $0x0,0x8031ea74
+80103f57:	00 00 00 
+  freerange(vstart, vend);
+80103f5a:	83 ec 08             	sub    $0x8,%esp
+80103f5d:	ff 75 0c             	push   0xc(%ebp)
+80103f60:	ff 75 08             	push   0x8(%ebp)
+80103f63:	e8 63 ff ff ff       	call   80103ecb <freerange>
+}
+80103f68:	83 c4 10             	add    $0x10,%esp
+80103f6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103f6e:	c9                   	leave
+80103f6f:	c3                   	ret
+
+80103f70 <kinit2>:
+{
+80103f70:	55                   	push   %ebp
+80103f71:	89 e5                	mov    %esp,%ebp
+80103f73:	83 ec 10             	sub    $0x10,%esp
+  freerange(vstart, vend);
+80103f76:	ff 75 0c             	push   0xc(%ebp)
+80103f79:	ff 75 08             	push   0x8(%ebp)
+80103f7c:	e8 4a ff ff ff       	call   80103ecb <freerange>
+  kmem.use_lock = 1;
+80103f81:	c7 05 74 ea 31 80 01 	movl   $0x1,0x8031ea74
+80103f88:	00 00 00 
+}
+80103f8b:	83 c4 10             	add    $0x10,%esp
+80103f8e:	c9                   	leave
+80103f8f:	c3                   	ret
+
+80103f90 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+80103f90:	55                   	push   %ebp
+80103f91:	89 e5                	mov    %esp,%ebp
+80103f93:	53                   	push   %ebx
+80103f94:	83 ec 04             	sub    $0x4,%esp
+  char *r;
+
+  // When out of pages, take back the other CPUs' cached pages,
+  // and failing that ask the buffer cache to give some back.
+  if((r = kalloc1()) == 0 && kmem.use_lock &&
+80103f97:	e8 3f fc ff ff       	call   80103bdb <kalloc1>
+80103f9c:	89 c3                	mov    %eax,%ebx
+80103f9e:	85 c0                	test   %eax,%eax
+80103fa0:	74 07                	je     80103fa9 <kalloc+0x19>
+     (kdrain() > 0 || breclaim() == 0))
+    r = kalloc1();
+  return r;
+}
+80103fa2:	89 d8                	mov    %ebx,%eax
+80103fa4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103fa7:	c9                   	leave
+80103fa8:	c3                   	ret
+  if((r = kalloc1()) == 0 && kmem.use_lock &&
+80103fa9:	83 3d 74 ea 31 80 00 	cmpl   $0x0,0x8031ea74
+80103fb0:	74 f0                	je     80103fa2 <kalloc+0x12>
+     (kdrain() > 0 || breclaim() == 0))
+80103fb2:	e8 94 fb ff ff       	call   80103b4b <kdrain>
+  if((r = kalloc1()) == 0 && kmem.use_lock &&
+80103fb7:	85 c0                	test   %eax,%eax
+80103fb9:	7e 09                	jle    80103fc4 <kalloc+0x34>
+    r = kalloc1();
+80103fbb:	e8 1b fc ff ff       	call   80103bdb <kalloc1>
+80103fc0:	89 c3                	mov    %eax,%ebx
+  return r;
+80103fc2:	eb de                	jmp    80103fa2 <kalloc+0x12>
+     (kdrain() > 0 || breclaim() == 0))
+80103fc4:	e8 84 c7 ff ff       	call   8010074d <breclaim>
+80103fc9:	85 c0                	test   %eax,%eax
+80103fcb:	75 d5                	jne    80103fa2 <kalloc+0x12>
+80103fcd:	eb ec                	jmp    80103fbb <kalloc+0x2b>
+
+80103fcf <kfreepages>:
+kfreepages(void)
+{
+  struct kcache *c;
+  int n;
+
+  n = kmem.nfree;
+80103fcf:	8b 15 7c ea 31 80    	mov    0x8031ea7c,%edx
+  for(c = kcache; c < &kcache[NCPU]; c++)
+80103fd5:	b8 80 aa 33 80       	mov    $0x8033aa80,%eax
+80103fda:	eb 06                	jmp    80103fe2 <kfreepages+0x13>
+    n += c->n;
+80103fdc:	03 50 38             	add    0x38(%eax),%edx
+  for(c = kcache; c < &kcache[NCPU]; c++)
+80103fdf:	83 c0 40             	add    $0x40,%eax
+80103fe2:	3d 80 ac 33 80       	cmp    $0x8033ac80,%eax
+80103fe7:	72 f3                	jb     80103fdc <kfreepages+0xd>
+  return n;
+}
+80103fe9:	89 d0                	mov    %edx,%eax
+80103feb:	c3                   	ret
+
+80103fec <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103fec:	ba 64 00 00 00       	mov    $0x64,%edx
+80103ff1:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80103ff2:	a8 01                	test   $0x1,%al
+80103ff4:	0f 84 b4 00 00 00    	je     801040ae <kbdgetc+0xc2>
+80103ffa:	ba 60 00 00 00       	mov    $0x60,%edx
+80103fff:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+80104000:	0f b6 c8             	movzbl %al,%ecx
+
+  if(data == 0xE0){
+80104003:	3c e0                	cmp    $0xe0,%al
+80104005:	74 61                	je     80104068 <kbdgetc+0x7c>
+    shift |= E0ESC;
+    return 0;
+  } else if(data & 0x80){
+80104007:	84 c0                	test   %al,%al
+80104009:	78 6a                	js     80104075 <kbdgetc+0x89>
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+8010400b:	8b 15 80 ac 33 80    	mov    0x8033ac80,%edx
+80104011:	f6 c2 40             	test   $0x40,%dl
+80104014:	74 0f                	je     80104025 <kbdgetc+0x39>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80104016:	83 c8 80             	or     $0xffffff80,%eax
+80104019:	0f b6 c8             	movzbl %al,%ecx
+    shift &= ~E0ESC;
+8010401c:	83 e2 bf             	and    $0xffffffbf,%edx
+8010401f:	89 15 80 ac 33 80    	mov    %edx,0x8033ac80
+  }
+
+  shift |= shiftcode[data];
+80104025:	0f b6 91 60 b5 10 80 	movzbl -0x7fef4aa0(%ecx),%edx
+8010402c:	0b 15 80 ac 33 80    	or     0x8033ac80,%edx
+80104032:	89 15 80 ac 33 80    	mov    %edx,0x8033ac80
+  shift ^= togglecode[data];
+80104038:	0f b6 81 60 b4 10 80 	movzbl -0x7fef4ba0(%ecx),%eax
+8010403f:	31 c2                	xor    %eax,%edx
+80104041:	89 15 80 ac 33 80    	mov    %edx,0x8033ac80
+  c = charcode[shift & (CTL | SHIFT)][data];
+80104047:	89 d0                	mov    %edx,%eax
+80104049:	83 e0 03             	and    $0x3,%eax
+8010404c:	8b 04 85 40 b4 10 80 	mov    -0x7fef4bc0(,%eax,4),%eax
+80104053:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80104057:	f6 c2 08             	test   $0x8,%dl
+8010405a:	74 57                	je     801040b3 <kbdgetc+0xc7>
+    if('a' <= c && c <= 'z')
+8010405c:	8d 50 9f             	lea    -0x61(%eax),%edx
+8010405f:	83 fa 19             	cmp    $0x19,%edx
+80104062:	77 3e                	ja     801040a2 <kbdgetc+0xb6>
+      c += 'A' - 'a';
+80104064:	83 e8 20             	sub    $0x20,%eax
+80104067:	c3                   	ret
+    shift |= E0ESC;
+80104068:	83 0d 80 ac 33 80 40 	orl    $0x40,0x8033ac80
+    return 0;
+8010406f:	b8 00 00 00 00       	mov    $0x0,%eax
+80104074:	c3                   	ret
+    data = (shift & E0ESC ? data : data & 0x7F);
+80104075:	8b 15 80 ac 33 80    	mov    0x8033ac80,%edx
+8010407b:	f6 c2 40             	test   $0x40,%dl
+8010407e:	75 05                	jne    80104085 <kbdgetc+0x99>
+80104080:	89 c1                	mov    %eax,%ecx
+80104082:	83 e1 7f             	and    $0x7f,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80104085:	0f b6 81 60 b5 10 80 	movzbl -0x7fef4aa0(%ecx),%eax
+8010408c:	83 c8 40             	or     $0x40,%eax
+8010408f:	0f b6 c0             	movzbl %al,%eax
+80104092:	f7 d0                	not    %eax
+80104094:	21 c2                	and    %eax,%edx
+80104096:	89 15 80 ac 33 80    	mov    %edx,0x8033ac80
+    return 0;
+8010409c:	b8 00 00 00 00       	mov    $0x0,%eax
+801040a1:	c3                   	ret
+    else if('A' <= c && c <= 'Z')
+801040a2:	8d 50 bf             	lea    -0x41(%eax),%edx
+801040a5:	83 fa 19             	cmp    $0x19,%edx
+801040a8:	77 09                	ja     801040b3 <kbdgetc+0xc7>
+      c += 'a' - 'A';
+801040aa:	83 c0 20             	add    $0x20,%eax
+  }
+  return c;
+801040ad:	c3                   	ret
+    return -1;
+801040ae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801040b3:	c3                   	ret
+
+801040b4 <kbdintr>:
+
+void
+kbdintr(void)
+{
+801040b4:	55                   	push   %ebp
+801040b5:	89 e5                	mov    %esp,%ebp
+801040b7:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+801040ba:	68 ec 3f 10 80       	push   $0x80103fec
+801040bf:	e8 70 ce ff ff       	call   80100f34 <consoleintr>
+}
+801040c4:	83 c4 10             	add    $0x10,%esp
+801040c7:	c9                   	leave
+801040c8:	c3                   	ret
+
+801040c9 <lapicw>:
+
+//PAGEBREAK!
+static void
+lapicw(int index, int value)
+{
+  lapic[index] = value;
+801040c9:	8b 0d 84 ac 33 80    	mov    0x8033ac84,%ecx
+801040cf:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+801040d2:	89 10                	mov    %edx,(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801040d4:	a1 84 ac 33 80       	mov    0x8033ac84,%eax
+801040d9:	8b 40 20             	mov    0x20(%eax),%eax
+}
+801040dc:	c3                   	ret
+
+801040dd <cmos_read>:
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801040dd:	ba 70 00 00 00       	mov    $0x70,%edx
+801040e2:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801040e3:	ba 71 00 00 00       	mov    $0x71,%edx
+801040e8:	ec                   	in     (%dx),%al
+static uint cmos_read(uint reg)
+{
+  outb(CMOS_PORT,  reg);
+  microdelay(200);
+
+  return inb(CMOS_RETURN);
+801040e9:	0f b6 c0             	movzbl %al,%eax
+}
+801040ec:	c3                   	ret
+
+801040ed <fill_rtcdate>:
+
+static void fill_rtcdate(struct rtcdate *r)
+{
+801040ed:	55                   	push   %ebp
+801040ee:	89 e5                	mov    %esp,%ebp
+801040f0:	53                   	push   %ebx
+801040f1:	83 ec 04             	sub    $0x4,%esp
+801040f4:	89 c3                	mov    %eax,%ebx
+  r->second = cmos_read(SECS);
+801040f6:	b8 00 00 00 00       	mov    $0x0,%eax
+801040fb:	e8 dd ff ff ff       	call   801040dd <cmos_read>
+80104100:	89 03                	mov    %eax,(%ebx)
+  r->minute = cmos_read(MINS);
+80104102:	b8 02 00 00 00       	mov    $0x2,%eax
+80104107:	e8 d1 ff ff ff       	call   801040dd <cmos_read>
+8010410c:	89 43 04             	mov    %eax,0x4(%ebx)
+  r->hour   = cmos_read(HOURS);
+8010410f:	b8 04 00 00 00       	mov    $0x4,%eax
+80104114:	e8 c4 ff ff ff       	call   801040dd <cmos_read>
+80104119:	89 43 08             	mov    %eax,0x8(%ebx)
+  r->day    = cmos_read(DAY);
+8010411c:	b8 07 00 00 00       	mov    $0x7,%eax
+80104121:	e8 b7 ff ff ff       	call   801040dd <cmos_read>
+80104126:	89 43 0c             	mov    %eax,0xc(%ebx)
+  r->month  = cmos_read(MONTH);
+80104129:	b8 08 00 00 00       	mov    $0x8,%eax
+8010412e:	e8 aa ff ff ff       	call   801040dd <cmos_read>
+80104133:	89 43 10             	mov    %eax,0x10(%ebx)
+  r->year   = cmos_read(YEAR);
+80104136:	b8 09 00 00 00       	mov    $0x9,%eax
+8010413b:	e8 9d ff ff ff       	call   801040dd <cmos_read>
+80104140:	89 43 14             	mov    %eax,0x14(%ebx)
+}
+80104143:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104146:	c9                   	leave
+80104147:	c3                   	ret
+
+80104148 <lapicinit>:
+  if(!lapic)
+80104148:	83 3d 84 ac 33 80 00 	cmpl   $0x0,0x8033ac84
+8010414f:	0f 84 fe 00 00 00    	je     80104253 <lapicinit+0x10b>
+{
+80104155:	55                   	push   %ebp
+80104156:	89 e5                	mov    %esp,%ebp
+80104158:	83 ec 08             	sub    $0x8,%esp
+  lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
+8010415b:	ba 3f 01 00 00       	mov    $0x13f,%edx
+80104160:	b8 3c 00 00 00       	mov    $0x3c,%eax
+80104165:	e8 5f ff ff ff       	call   801040c9 <lapicw>
+  lapicw(TDCR, X1);
+8010416a:	ba 0b 00 00 00       	mov    $0xb,%edx
+8010416f:	b8 f8 00 00 00       	mov    $0xf8,%eax
+80104174:	e8 50 ff ff ff       	call   801040c9 <lapicw>
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+80104179:	ba 20 00 02 00       	mov    $0x20020,%edx
+8010417e:	b8 c8 00 00 00       	mov    $0xc8,%eax
+80104183:	e8 41 ff ff ff       	call   801040c9 <lapicw>
+  lapicw(TICR, 1000000);
+80104188:	ba 40 42 0f 00       	mov    $0xf4240,%edx
+8010418d:	b8 e0 00 00 00       	mov    $0xe0,%eax
+80104192:	e8 32 ff ff ff       	call   801040c9 <lapicw>
+  lapicw(LINT0, MASKED);
+80104197:	ba 00 00 01 00       	mov    $0x10000,%edx
+8010419c:	b8 d4 00 00 00       	mov    $0xd4,%eax
+801041a1:	e8 23 ff ff ff       	call   801040c9 <lapicw>
+  lapicw(LINT1, MASKED);
+801041a6:	ba 00 00 01 00       	mov    $0x10000,%edx
+801041ab:	b8 d8 00 00 00       	mov    $0xd8,%eax
+801041b0:	e8 14 ff ff ff       	call   801040c9 <lapicw>
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+801041b5:	a1 84 ac 33 80       	mov    0x8033ac84,%eax
+801041ba:	8b 40 30             	mov    0x30(%eax),%eax
+801041bd:	c1 e8 10             	shr    $0x10,%eax
+801041c0:	a8 fc                	test   $0xfc,%al
+801041c2:	75 7b                	jne    8010423f <lapicinit+0xf7>
+  lapicw(ERROR, T_IRQ0 + IRQ_ERROR);
+801041c4:	ba 33 00 00 00       	mov    $0x33,%edx
+801041c9:	b8 dc 00 00 00       	mov    $0xdc,%eax
+801041ce:	e8 f6 fe ff ff       	call   801040c9 <lapicw>
+  lapicw(ESR, 0);
+801041d3:	ba 00 00 00 00       	mov    $0x0,%edx
+801041d8:	b8 a0 00 00 00       	mov    $0xa0,%eax
+801041dd:	e8 e7 fe ff ff       	call   801040c9 <lapicw>
+  lapicw(ESR, 0);
+801041e2:	ba 00 00 00 00       	mov    $0x0,%edx
+801041e7:	b8 a0 00 00 00       	mov    $0xa0,%eax
+801041ec:	e8 d8 fe ff ff       	call   801040c9 <lapicw>
+  lapicw(EOI, 0);
+801041f1:	ba 00 00 00 00       	mov    $0x0,%edx
+801041f6:	b8 2c 00 00 00       	mov    $0x2c,%eax
+801041fb:	e8 c9 fe ff ff       	call   801040c9 <lapicw>
+  lapicw(ICRHI, 0);
+80104200:	ba 00 00 00 00       	mov    $0x0,%edx
+80104205:	b8 c4 00 00 00       	mov    $0xc4,%eax
+8010420a:	e8 ba fe ff ff       	call   801040c9 <lapicw>
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+8010420f:	ba 00 85 08 00       	mov    $0x88500,%edx
+80104214:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80104219:	e8 ab fe ff ff       	call   801040c9 <lapicw>
+  while(lapic[ICRLO] & DELIVS)
+8010421e:	a1 84 ac 33 80       	mov    0x8033ac84,%eax
+80104223:	8b 80 00 03 00 00    	mov    0x300(%eax),%eax
+80104229:	f6 c4 10             	test   $0x10,%ah
+8010422c:	75 f0                	jne    8010421e <lapicinit+0xd6>
+  lapicw(TPR, 0);
+8010422e:	ba 00 00 00 00       	mov    $0x0,%edx
+80104233:	b8 20 00 00 00       	mov    $0x20,%eax
+80104238:	e8 8c fe ff ff       	call   801040c9 <lapicw>
+}
+8010423d:	c9                   	leave
+8010423e:	c3                   	ret
+    lapicw(PCINT, MASKED);
+8010423f:	ba 00 00 01 00       	mov    $0x10000,%edx
+80104244:	b8 d0 00 00 00       	mov    $0xd0,%eax
+80104249:	e8 7b fe ff ff       	call   801040c9 <lapicw>
+8010424e:	e9 71 ff ff ff       	jmp    801041c4 <lapicinit+0x7c>
+80104253:	c3                   	ret
+
+80104254 <lapicid>:
+  if (!lapic)
+80104254:	a1 84 ac 33 80       	mov    0x8033ac84,%eax
+80104259:	85 c0                	test   %eax,%eax
+8010425b:	74 07                	je     80104264 <lapicid+0x10>
+  return lapic[ID] >> 24;
+8010425d:	8b 40 20             	mov    0x20(%eax),%eax
+80104260:	c1 e8 18             	shr    $0x18,%eax
+80104263:	c3                   	ret
+    return 0;
+80104264:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80104269:	c3                   	ret
+
+8010426a <lapiceoi>:
+  if(lapic)
+8010426a:	83 3d 84 ac 33 80 00 	cmpl   $0x0,0x8033ac84
+80104271:	74 17                	je     8010428a <lapiceoi+0x20>
+{
+80104273:	55                   	push   %ebp
+80104274:	89 e5                	mov    %esp,%ebp
+80104276:	83 ec 08             	sub    $0x8,%esp
+    lapicw(EOI, 0);
+80104279:	ba 00 00 00 00       	mov    $0x0,%edx
+8010427e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+80104283:	e8 41 fe ff ff       	call   801040c9 <lapicw>
+}
+80104288:	c9                   	leave
+80104289:	c3                   	ret
+8010428a:	c3                   	ret
+
+8010428b <microdelay>:
+}
+8010428b:	c3                   	ret
+
+8010428c <lapicstartap>:
+{
+8010428c:	55                   	push   %ebp
+8010428d:	89 e5                	mov    %esp,%ebp
+8010428f:	57                   	push   %edi
+80104290:	56                   	push   %esi
+80104291:	53                   	push   %ebx
+80104292:	83 ec 0c             	sub    $0xc,%esp
+80104295:	8b 75 08             	mov    0x8(%ebp),%esi
+80104298:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010429b:	b8 0f 00 00 00       	mov    $0xf,%eax
+801042a0:	ba 70 00 00 00       	mov    $0x70,%edx
+801042a5:	ee                   	out    %al,(%dx)
+801042a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+801042ab:	ba 71 00 00 00       	mov    $0x71,%edx
+801042b0:	ee                   	out    %al,(%dx)
+  wrv[0] = 0;
+801042b1:	66 c7 05 67 04 00 80 	movw   $0x0,0x80000467
+801042b8:	00 00 
+  wrv[1] = addr >> 4;
+801042ba:	89 f8                	mov    %edi,%eax
+801042bc:	c1 e8 04             	shr    $0x4,%eax
+801042bf:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapicw(ICRHI, apicid<<24);
+801042c5:	c1 e6 18             	shl    $0x18,%esi
+801042c8:	89 f2                	mov    %esi,%edx
+801042ca:	b8 c4 00 00 00       	mov    $0xc4,%eax
+801042cf:	e8 f5 fd ff ff       	call   801040c9 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL | ASSERT);
+801042d4:	ba 00 c5 00 00       	mov    $0xc500,%edx
+801042d9:	b8 c0 00 00 00       	mov    $0xc0,%eax
+801042de:	e8 e6 fd ff ff       	call   801040c9 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL);
+801042e3:	ba 00 85 00 00       	mov    $0x8500,%edx
+801042e8:	b8 c0 00 00 00       	mov    $0xc0,%eax
+801042ed:	e8 d7 fd ff ff       	call   801040c9 <lapicw>
+  for(i = 0; i < 2; i++){
+801042f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+801042f7:	eb 21                	jmp    8010431a <lapicstartap+0x8e>
+    lapicw(ICRHI, apicid<<24);
+801042f9:	89 f2                	mov    %esi,%edx
+801042fb:	b8 c4 00 00 00       	mov    $0xc4,%eax
+80104300:	e8 c4 fd ff ff       	call   801040c9 <lapicw>
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80104305:	89 fa                	mov    %edi,%edx
+80104307:	c1 ea 0c             	shr    $0xc,%edx
+8010430a:	80 ce 06             	or     $0x6,%dh
+8010430d:	b8 c0 00 00 00       	mov    $0xc0,%eax
+80104312:	e8 b2 fd ff ff       	call   801040c9 <lapicw>
+  for(i = 0; i < 2; i++){
+80104317:	83 c3 01             	add    $0x1,%ebx
+8010431a:	83 fb 01             	cmp    $0x1,%ebx
+8010431d:	7e da                	jle    801042f9 <lapicstartap+0x6d>
+}
+8010431f:	83 c4 0c             	add    $0xc,%esp
+80104322:	5b                   	pop    %ebx
+80104323:	5e                   	pop    %esi
+80104324:	5f                   	pop    %edi
+80104325:	5d                   	pop    %ebp
+80104326:	c3                   	ret
+
+80104327 <cmostime>:
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void cmostime(struct rtcdate *r)
+{
+80104327:	55                   	push   %ebp
+80104328:	89 e5                	mov    %esp,%ebp
+8010432a:	57                   	push   %edi
+8010432b:	56                   	push   %esi
+8010432c:	53                   	push   %ebx
+8010432d:	83 ec 3c             	sub    $0x3c,%esp
+80104330:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+80104333:	b8 0b 00 00 00       	mov    $0xb,%eax
+80104338:	e8 a0 fd ff ff       	call   801040dd <cmos_read>
+
+  bcd = (sb & (1 << 2)) == 0;
+8010433d:	83 e0 04             	and    $0x4,%eax
+80104340:	89 c7                	mov    %eax,%edi
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+80104342:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80104345:	e8 a3 fd ff ff       	call   801040ed <fill_rtcdate>
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+8010434a:	b8 0a 00 00 00       	mov    $0xa,%eax
+8010434f:	e8 89 fd ff ff       	call   801040dd <cmos_read>
+80104354:	a8 80                	test   $0x80,%al
+80104356:	75 ea                	jne    80104342 <cmostime+0x1b>
+        continue;
+    fill_rtcdate(&t2);
+80104358:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+8010435b:	89 d8                	mov    %ebx,%eax
+8010435d:	e8 8b fd ff ff       	call   801040ed <fill_rtcdate>
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80104362:	83 ec 04             	sub    $0x4,%esp
+80104365:	6a 18                	push   $0x18
+80104367:	53                   	push   %ebx
+80104368:	8d 45 d0             	lea    -0x30(%ebp),%eax
+8010436b:	50                   	push   %eax
+8010436c:	e8 49 37 00 00       	call   80107aba <memcmp>
+80104371:	83 c4 10             	add    $0x10,%esp
+80104374:	85 c0                	test   %eax,%eax
+80104376:	75 ca                	jne    80104342 <cmostime+0x1b>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80104378:	85 ff                	test   %edi,%edi
+8010437a:	75 78                	jne    801043f4 <cmostime+0xcd>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+8010437c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+8010437f:	89 c2                	mov    %eax,%edx
+80104381:	c1 ea 04             	shr    $0x4,%edx
+80104384:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104387:	83 e0 0f             	and    $0xf,%eax
+8010438a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+8010438d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    CONV(minute);
+80104390:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80104393:	89 c2                	mov    %eax,%edx
+80104395:	c1 ea 04             	shr    $0x4,%edx
+80104398:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010439b:	83 e0 0f             	and    $0xf,%eax
+8010439e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801043a1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    CONV(hour  );
+801043a4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801043a7:	89 c2                	mov    %eax,%edx
+801043a9:	c1 ea 04             	shr    $0x4,%edx
+801043ac:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801043af:	83 e0 0f             	and    $0xf,%eax
+801043b2:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801043b5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    CONV(day   );
+801043b8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801043bb:	89 c2                	mov    %eax,%edx
+801043bd:	c1 ea 04             	shr    $0x4,%edx
+801043c0:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801043c3:	83 e0 0f             	and    $0xf,%eax
+801043c6:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801043c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    CONV(month );
+801043cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801043cf:	89 c2                	mov    %eax,%edx
+801043d1:	c1 ea 04             	shr    $0x4,%edx
+801043d4:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801043d7:	83 e0 0f             	and    $0xf,%eax
+801043da:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801043dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    CONV(year  );
+801043e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801043e3:	89 c2                	mov    %eax,%edx
+801043e5:	c1 ea 04             	shr    $0x4,%edx
+801043e8:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801043eb:	83 e0 0f             	and    $0xf,%eax
+801043ee:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801043f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+801043f4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+801043f7:	89 06                	mov    %eax,(%esi)
+801043f9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801043fc:	89 46 04             	mov    %eax,0x4(%esi)
+801043ff:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80104402:	89 46 08             	mov    %eax,0x8(%esi)
+80104405:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104408:	89 46 0c             	mov    %eax,0xc(%esi)
+8010440b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010440e:	89 46 10             	mov    %eax,0x10(%esi)
+80104411:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104414:	89 46 14             	mov    %eax,0x14(%esi)
+  r->year += 2000;
+80104417:	05 d0 07 00 00       	add    $0x7d0,%eax
+8010441c:	89 46 14             	mov    %eax,0x14(%esi)
+}
+8010441f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104422:	5b                   	pop    %ebx
+80104423:	5e                   	pop    %esi
+80104424:	5f                   	pop    %edi
+80104425:	5d                   	pop    %ebp
+80104426:	c3                   	ret
+
+80104427 <read_head>:
+}
+
+// Read the log header from disk into the in-memory log header
+static void
+read_head(void)
+{
+80104427:	55                   	push   %ebp
+80104428:	89 e5                	mov    %esp,%ebp
+8010442a:	56                   	push   %esi
+8010442b:	53                   	push   %ebx
+  struct buf *buf = bread(log.dev, log.start);
+8010442c:	83 ec 08             	sub    $0x8,%esp
+8010442f:	ff 35 d4 ac 33 80    	push   0x8033acd4
+80104435:	ff 35 e4 ac 33 80    	push   0x8033ace4
+8010443b:	e8 2c c4 ff ff       	call   8010086c <bread>
+  struct logheader *lh = (struct logheader *) (buf->data);
+80104440:	8b 70 60             	mov    0x60(%eax),%esi
+  int i;
+  log.lh.n = lh->n;
+80104443:	8b 1e                	mov    (%esi),%ebx
+80104445:	89 1d e8 ac 33 80    	mov    %ebx,0x8033ace8
+  for (i = 0; i < log.lh.n; i++) {
+8010444b:	83 c4 10             	add    $0x10,%esp
+8010444e:	ba 00 00 00 00       	mov    $0x0,%edx
+80104453:	eb 0e                	jmp    80104463 <read_head+0x3c>
+    log.lh.block[i] = lh->block[i];
+80104455:	8b 4c 96 04          	mov    0x4(%esi,%edx,4),%ecx
+80104459:	89 0c 95 ec ac 33 80 	mov    %ecx,-0x7fcc5314(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80104460:	83 c2 01             	add    $0x1,%edx
+80104463:	39 d3                	cmp    %edx,%ebx
+80104465:	7f ee                	jg     80104455 <read_head+0x2e>
+  }
+  brelse(buf);
+80104467:	83 ec 0c             	sub    $0xc,%esp
+8010446a:	50                   	push   %eax
+8010446b:	e8 cb c4 ff ff       	call   8010093b <brelse>
+}
+80104470:	83 c4 10             	add    $0x10,%esp
+80104473:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104476:	5b                   	pop    %ebx
+80104477:	5e                   	pop    %esi
+80104478:	5d                   	pop    %ebp
+80104479:	c3                   	ret
+
+8010447a <install_trans>:
+{
+8010447a:	55                   	push   %ebp
+8010447b:	89 e5                	mov    %esp,%ebp
+8010447d:	57                   	push   %edi
+8010447e:	56                   	push   %esi
+8010447f:	53                   	push   %ebx
+80104480:	83 ec 3c             	sub    $0x3c,%esp
+  for (tail = 0; tail < log.lh.n; tail += n) {
+80104483:	bf 00 00 00 00       	mov    $0x0,%edi
+80104488:	eb 2f                	jmp    801044b9 <install_trans+0x3f>
+    bwritev(dbuf, n);  // write dst to disk
+8010448a:	83 ec 08             	sub    $0x8,%esp
+8010448d:	53                   	push   %ebx
+8010448e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+80104491:	50                   	push   %eax
+80104492:	e8 42 c4 ff ff       	call   801008d9 <bwritev>
+    for (i = 0; i < n; i++)
+80104497:	83 c4 10             	add    $0x10,%esp
+8010449a:	be 00 00 00 00       	mov    $0x0,%esi
+8010449f:	eb 12                	jmp    801044b3 <install_trans+0x39>
+      brelse(dbuf[i]);
+801044a1:	83 ec 0c             	sub    $0xc,%esp
+801044a4:	ff 74 b5 c8          	push   -0x38(%ebp,%esi,4)
+801044a8:	e8 8e c4 ff ff       	call   8010093b <brelse>
+    for (i = 0; i < n; i++)
+801044ad:	83 c6 01             	add    $0x1,%esi
+801044b0:	83 c4 10             	add    $0x10,%esp
+801044b3:	39 de                	cmp    %ebx,%esi
+801044b5:	7c ea                	jl     801044a1 <install_trans+0x27>
+  for (tail = 0; tail < log.lh.n; tail += n) {
+801044b7:	01 df                	add    %ebx,%edi
+801044b9:	39 3d e8 ac 33 80    	cmp    %edi,0x8033ace8
+801044bf:	7e 74                	jle    80104535 <install_trans+0xbb>
+    for (n = 0; n < LOGBATCH && tail+n < log.lh.n; n++) {
+801044c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+801044c6:	83 fb 07             	cmp    $0x7,%ebx
+801044c9:	7f bf                	jg     8010448a <install_trans+0x10>
+801044cb:	8d 34 1f             	lea    (%edi,%ebx,1),%esi
+801044ce:	3b 35 e8 ac 33 80    	cmp    0x8033ace8,%esi
+801044d4:	7d b4                	jge    8010448a <install_trans+0x10>
+      struct buf *lbuf = bread(log.dev, log.start+tail+n+1); // read log block
+801044d6:	89 f8                	mov    %edi,%eax
+801044d8:	03 05 d4 ac 33 80    	add    0x8033acd4,%eax
+801044de:	8d 44 18 01          	lea    0x1(%eax,%ebx,1),%eax
+801044e2:	83 ec 08             	sub    $0x8,%esp
+801044e5:	50                   	push   %eax
+801044e6:	ff 35 e4 ac 33 80    	push   0x8033ace4
+801044ec:	e8 7b c3 ff ff       	call   8010086c <bread>
+801044f1:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+      dbuf[n] = bread(log.dev, log.lh.block[tail+n]); // read dst
+801044f4:	83 c4 08             	add    $0x8,%esp
+801044f7:	ff 34 b5 ec ac 33 80 	push   -0x7fcc5314(,%esi,4)
+801044fe:	ff 35 e4 ac 33 80    	push   0x8033ace4
+80104504:	e8 63 c3 ff ff       	call   8010086c <bread>
+80104509:	89 44 9d c8          	mov    %eax,-0x38(%ebp,%ebx,4)
+      memmove(dbuf[n]->data, lbuf->data, BSIZE);  // copy block to dst
+8010450d:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+80104510:	8b 56 60             	mov    0x60(%esi),%edx
+80104513:	8b 40 60             	mov    0x60(%eax),%eax
+80104516:	83 c4 0c             	add    $0xc,%esp
+80104519:	68 00 10 00 00       	push   $0x1000
+8010451e:	52                   	push   %edx
+8010451f:	50                   	push   %eax
+80104520:	e8 ca 35 00 00       	call   80107aef <memmove>
+      brelse(lbuf);
+80104525:	89 34 24             	mov    %esi,(%esp)
+80104528:	e8 0e c4 ff ff       	call   8010093b <brelse>
+    for (n = 0; n < LOGBATCH && tail+n < log.lh.n; n++) {
+8010452d:	83 c3 01             	add    $0x1,%ebx
+80104530:	83 c4 10             	add    $0x10,%esp
+80104533:	eb 91                	jmp    801044c6 <install_trans+0x4c>
+}
+80104535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104538:	5b                   	pop    %ebx
+80104539:	5e                   	pop    %esi
+8010453a:	5f                   	pop    %edi
+8010453b:	5d                   	pop    %ebp
+8010453c:	c3                   	ret
+
+8010453d <write_log>:
+
+// Copy modified blocks from cache to log, LOGBATCH at a time;
+// the log blocks are contiguous, so each batch is one transfer.
+static void
+write_log(void)
+{
+8010453d:	55                   	push   %ebp
+8010453e:	89 e5                	mov    %esp,%ebp
+80104540:	57                   	push   %edi
+80104541:	56                   	push   %esi
+80104542:	53                   	push   %ebx
+80104543:	83 ec 2c             	sub    $0x2c,%esp
+  int tail, i, n;
+  struct buf *to[LOGBATCH];
+
+  for (tail = 0; tail < log.lh.n; tail += n) {
+80104546:	bf 00 00 00 00       	mov    $0x0,%edi
+8010454b:	eb 2f                	jmp    8010457c <write_log+0x3f>
+      to[n] = bread(log.dev, log.start+tail+n+1); // log block
+      struct buf *from = bread(log.dev, log.lh.block[tail+n]); // cache block
+      memmove(to[n]->data, from->data, BSIZE);
+      brelse(from);
+    }
+    bwritev(to, n);  // write the log
+8010454d:	83 ec 08             	sub    $0x8,%esp
+80104550:	53                   	push   %ebx
+80104551:	8d 45 c8             	lea    -0x38(%ebp),%eax
+80104554:	50                   	push   %eax
+80104555:	e8 7f c3 ff ff       	call   801008d9 <bwritev>
+    for (i = 0; i < n; i++)
+8010455a:	83 c4 10             	add    $0x10,%esp
+8010455d:	be 00 00 00 00       	mov    $0x0,%esi
+80104562:	eb 12                	jmp    80104576 <write_log+0x39>
+      brelse(to[i]);
+80104564:	83 ec 0c             	sub    $0xc,%esp
+80104567:	ff 74 b5 c8          	push   -0x38(%ebp,%esi,4)
+8010456b:	e8 cb c3 ff ff       	call   8010093b <brelse>
+    for (i = 0; i < n; i++)
+80104570:	83 c6 01             	add    $0x1,%esi
+80104573:	83 c4 10             	add    $0x10,%esp
+80104576:	39 de                	cmp    %ebx,%esi
+80104578:	7c ea                	jl     80104564 <write_log+0x27>
+  for (tail = 0; tail < log.lh.n; tail += n) {
+8010457a:	01 df                	add    %ebx,%edi
+8010457c:	39 3d e8 ac 33 80    	cmp    %edi,0x8033ace8
+80104582:	7e 74                	jle    801045f8 <write_log+0xbb>
+    for (n = 0; n < LOGBATCH && tail+n < log.lh.n; n++) {
+80104584:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104589:	83 fb 07             	cmp    $0x7,%ebx
+8010458c:	7f bf                	jg     8010454d <write_log+0x10>
+8010458e:	8d 34 1f             	lea    (%edi,%ebx,1),%esi
+80104591:	3b 35 e8 ac 33 80    	cmp    0x8033ace8,%esi
+80104597:	7d b4                	jge    8010454d <write_log+0x10>
+      to[n] = bread(log.dev, log.start+tail+n+1); // log block
+80104599:	89 f8                	mov    %edi,%eax
+8010459b:	03 05 d4 ac 33 80    	add    0x8033acd4,%eax
+801045a1:	8d 44 18 01          	lea    0x1(%eax,%ebx,1),%eax
+801045a5:	83 ec 08             	sub    $0x8,%esp
+801045a8:	50                   	push   %eax
+801045a9:	ff 35 e4 ac 33 80    	push   0x8033ace4
+801045af:	e8 b8 c2 ff ff       	call   8010086c <bread>
+801045b4:	89 44 9d c8          	mov    %eax,-0x38(%ebp,%ebx,4)
+      struct buf *from = bread(log.dev, log.lh.block[tail+n]); // cache block
+801045b8:	83 c4 08             	add    $0x8,%esp
+801045bb:	ff 34 b5 ec ac 33 80 	push   -0x7fcc5314(,%esi,4)
+801045c2:	ff 35 e4 ac 33 80    	push   0x8033ace4
+801045c8:	e8 9f c2 ff ff       	call   8010086c <bread>
+801045cd:	89 c6                	mov    %eax,%esi
+      memmove(to[n]->data, from->data, BSIZE);
+801045cf:	8b 50 60             	mov    0x60(%eax),%edx
+801045d2:	8b 44 9d c8          	mov    -0x38(%ebp,%ebx,4),%eax
+801045d6:	8b 40 60             	mov    0x60(%eax),%eax
+801045d9:	83 c4 0c             	add    $0xc,%esp
+801045dc:	68 00 10 00 00       	push   $0x1000
+801045e1:	52                   	push   %edx
+801045e2:	50                   	push   %eax
+801045e3:	e8 07 35 00 00       	call   80107aef <memmove>
+      brelse(from);
+801045e8:	89 34 24             	mov    %esi,(%esp)
+801045eb:	e8 4b c3 ff ff       	call   8010093b <brelse>
+    for (n = 0; n < LOGBATCH && tail+n < log.lh.n; n++) {
+801045f0:	83 c3 01             	add    $0x1,%ebx
+801045f3:	83 c4 10             	add    $0x10,%esp
+801045f6:	eb 91                	jmp    80104589 <write_log+0x4c>
+  }
+}
+801045f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801045fb:	5b                   	pop    %ebx
+801045fc:	5e                   	pop    %esi
+801045fd:	5f                   	pop    %edi
+801045fe:	5d                   	pop    %ebp
+801045ff:	c3                   	ret
+
+80104600 <write_head>:
+{
+80104600:	55                   	push   %ebp
+80104601:	89 e5                	mov    %esp,%ebp
+80104603:	53                   	push   %ebx
+80104604:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+80104607:	ff 35 d4 ac 33 80    	push   0x8033acd4
+8010460d:	ff 35 e4 ac 33 80    	push   0x8033ace4
+80104613:	e8 54 c2 ff ff       	call   8010086c <bread>
+80104618:	89 c3                	mov    %eax,%ebx
+  struct logheader *hb = (struct logheader *) (buf->data);
+8010461a:	8b 48 60             	mov    0x60(%eax),%ecx
+  hb->n = log.lh.n;
+8010461d:	a1 e8 ac 33 80       	mov    0x8033ace8,%eax
+80104622:	89 01                	mov    %eax,(%ecx)
+  for (i = 0; i < log.lh.n; i++) {
+80104624:	83 c4 10             	add    $0x10,%esp
+80104627:	b8 00 00 00 00       	mov    $0x0,%eax
+8010462c:	eb 0e                	jmp    8010463c <write_head+0x3c>
+    hb->block[i] = log.lh.block[i];
+8010462e:	8b 14 85 ec ac 33 80 	mov    -0x7fcc5314(,%eax,4),%edx
+80104635:	89 54 81 04          	mov    %edx,0x4(%ecx,%eax,4)
+  for (i = 0; i < log.lh.n; i++) {
+80104639:	83 c0 01             	add    $0x1,%eax
+8010463c:	39 05 e8 ac 33 80    	cmp    %eax,0x8033ace8
+80104642:	7f ea                	jg     8010462e <write_head+0x2e>
+  bwrite(buf);
+80104644:	83 ec 0c             	sub    $0xc,%esp
+80104647:	53                   	push   %ebx
+80104648:	e8 4d c2 ff ff       	call   8010089a <bwrite>
+  brelse(buf);
+8010464d:	89 1c 24             	mov    %ebx,(%esp)
+80104650:	e8 e6 c2 ff ff       	call   8010093b <brelse>
+}
+80104655:	83 c4 10             	add    $0x10,%esp
+80104658:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010465b:	c9                   	leave
+8010465c:	c3                   	ret
+
+8010465d <recover_from_log>:
+{
+8010465d:	55                   	push   %ebp
+8010465e:	89 e5                	mov    %esp,%ebp
+80104660:	83 ec 08             	sub    $0x8,%esp
+  read_head();
+80104663:	e8 bf fd ff ff       	call   80104427 <read_head>
+  install_trans(); // if committed, copy from log to disk
+80104668:	e8 0d fe ff ff       	call   8010447a <install_trans>
+  log.lh.n = 0;
+8010466d:	c7 05 e8 ac 33 80 00 	movl   $0x0,0x8033ace8
+80104674:	00 00 00 
+  write_head(); // clear the log
+80104677:	e8 84 ff ff ff       	call   80104600 <write_head>
+}
+8010467c:	c9                   	leave
+8010467d:	c3                   	ret
+
+8010467e <commit>:
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+8010467e:	83 3d e8 ac 33 80 00 	cmpl   $0x0,0x8033ace8
+80104685:	7f 01                	jg     80104688 <commit+0xa>
+80104687:	c3                   	ret
+{
+80104688:	55                   	push   %ebp
+80104689:	89 e5                	mov    %esp,%ebp
+8010468b:	83 ec 08             	sub    $0x8,%esp
+    write_log();     // Write modified blocks from cache to log
+8010468e:	e8 aa fe ff ff       	call   8010453d <write_log>
+    write_head();    // Write header to disk -- the real commit
+80104693:	e8 68 ff ff ff       	call   80104600 <write_head>
+    install_trans(); // Now install writes to home locations
+80104698:	e8 dd fd ff ff       	call   8010447a <install_trans>
+    log.lh.n = 0;
+8010469d:	c7 05 e8 ac 33 80 00 	movl   $0x0,0x8033ace8
+801046a4:	00 00 00 
+    write_head();    // Erase the transaction from the log
+801046a7:	e8 54 ff ff ff       	call   80104600 <write_head>
+  }
+}
+801046ac:	c9                   	leave
+801046ad:	c3                   	ret
+
+801046ae <initlog>:
+{
+801046ae:	55                   	push   %ebp
+801046af:	89 e5                	mov    %esp,%ebp
+801046b1:	53                   	push   %ebx
+801046b2:	83 ec 2c             	sub    $0x2c,%esp
+801046b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+801046b8:	68 60 b6 10 80       	push   $0x8010b660
+801046bd:	68 a0 ac 33 80       	push   $0x8033aca0
+801046c2:	e8 c0 31 00 00       	call   80107887 <initlock>
+  readsb(dev, &sb);
+801046c7:	83 c4 08             	add    $0x8,%esp
+801046ca:	8d 45 d8             	lea    -0x28(%ebp),%eax
+801046cd:	50                   	push   %eax
+801046ce:	53                   	push   %ebx
+801046cf:	e8 5c e1 ff ff       	call   80102830 <readsb>
+  log.start = sb.logstart;
+801046d4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+801046d7:	a3 d4 ac 33 80       	mov    %eax,0x8033acd4
+  log.size = sb.nlog;
+801046dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801046df:	a3 d8 ac 33 80       	mov    %eax,0x8033acd8
+  log.dev = dev;
+801046e4:	89 1d e4 ac 33 80    	mov    %ebx,0x8033ace4
+  recover_from_log();
+801046ea:	e8 6e ff ff ff       	call   8010465d <recover_from_log>
+}
+801046ef:	83 c4 10             	add    $0x10,%esp
+801046f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801046f5:	c9                   	leave
+801046f6:	c3                   	ret
+
+801046f7 <begin_op>:
+{
+801046f7:	55                   	push   %ebp
+801046f8:	89 e5                	mov    %esp,%ebp
+801046fa:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+801046fd:	68 a0 ac 33 80       	push   $0x8033aca0
+80104702:	e8 c4 32 00 00       	call   801079cb <acquire>
+80104707:	83 c4 10             	add    $0x10,%esp
+8010470a:	eb 15                	jmp    80104721 <begin_op+0x2a>
+      sleep(&log, &log.lock);
+8010470c:	83 ec 08             	sub    $0x8,%esp
+8010470f:	68 a0 ac 33 80       	push   $0x8033aca0
+80104714:	68 a0 ac 33 80       	push   $0x8033aca0
+80104719:	e8 3f 25 00 00       	call   80106c5d <sleep>
+8010471e:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+80104721:	83 3d e0 ac 33 80 00 	cmpl   $0x0,0x8033ace0
+80104728:	75 e2                	jne    8010470c <begin_op+0x15>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+8010472a:	a1 dc ac 33 80       	mov    0x8033acdc,%eax
+8010472f:	83 c0 01             	add    $0x1,%eax
+80104732:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80104735:	8d 14 09             	lea    (%ecx,%ecx,1),%edx
+80104738:	03 15 e8 ac 33 80    	add    0x8033ace8,%edx
+8010473e:	83 fa 1e             	cmp    $0x1e,%edx
+80104741:	7e 17                	jle    8010475a <begin_op+0x63>
+      sleep(&log, &log.lock);
+80104743:	83 ec 08             	sub    $0x8,%esp
+80104746:	68 a0 ac 33 80       	push   $0x8033aca0
+8010474b:	68 a0 ac 33 80       	push   $0x8033aca0
+80104750:	e8 08 25 00 00       	call   80106c5d <sleep>
+80104755:	83 c4 10             	add    $0x10,%esp
+80104758:	eb c7                	jmp    80104721 <begin_op+0x2a>
+      log.outstanding += 1;
+8010475a:	a3 dc ac 33 80       	mov    %eax,0x8033acdc
+      release(&log.lock);
+8010475f:	83 ec 0c             	sub    $0xc,%esp
+80104762:	68 a0 ac 33 80       	push   $0x8033aca0
+80104767:	e8 c4 32 00 00       	call   80107a30 <release>
+}
+8010476c:	83 c4 10             	add    $0x10,%esp
+8010476f:	c9                   	leave
+80104770:	c3                   	ret
+
+80104771 <end_op>:
+{
+80104771:	55                   	push   %ebp
+80104772:	89 e5                	mov    %esp,%ebp
+80104774:	53                   	push   %ebx
+80104775:	83 ec 10             	sub    $0x10,%esp
+  acquire(&log.lock);
+80104778:	68 a0 ac 33 80       	push   $0x8033aca0
+8010477d:	e8 49 32 00 00       	call   801079cb <acquire>
+  log.outstanding -= 1;
+80104782:	a1 dc ac 33 80       	mov    0x8033acdc,%eax
+80104787:	83 e8 01             	sub    $0x1,%eax
+8010478a:	a3 dc ac 33 80       	mov    %eax,0x8033acdc
+  if(log.committing)
+8010478f:	8b 1d e0 ac 33 80    	mov    0x8033ace0,%ebx
+80104795:	83 c4 10             	add    $0x10,%esp
+80104798:	85 db                	test   %ebx,%ebx
+8010479a:	75 2c                	jne    801047c8 <end_op+0x57>
+  if(log.outstanding == 0){
+8010479c:	85 c0                	test   %eax,%eax
+8010479e:	75 35                	jne    801047d5 <end_op+0x64>
+    log.committing = 1;
+801047a0:	c7 05 e0 ac 33 80 01 	movl   $0x1,0x8033ace0
+801047a7:	00 00 00 
+    do_commit = 1;
+801047aa:	bb 01 00 00 00       	mov    $0x1,%ebx
+  release(&log.lock);
+801047af:	83 ec 0c             	sub    $0xc,%esp
+801047b2:	68 a0 ac 33 80       	push   $0x8033aca0
+801047b7:	e8 74 32 00 00       	call   80107a30 <release>
+  if(do_commit){
+801047bc:	83 c4 10             	add    $0x10,%esp
+801047bf:	85 db                	test   %ebx,%ebx
+801047c1:	75 24                	jne    801047e7 <end_op+0x76>
+}
+801047c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801047c6:	c9                   	leave
+801047c7:	c3                   	ret
+    panic("log.committing");
+801047c8:	83 ec 0c             	sub    $0xc,%esp
+801047cb:	68 64 b6 10 80       	push   $0x8010b664
+801047d0:	e8 51 c3 ff ff       	call   80100b26 <panic>
+    wakeup(&log);
+801047d5:	83 ec 0c             	sub    $0xc,%esp
+801047d8:	68 a0 ac 33 80       	push   $0x8033aca0
+801047dd:	e8 67 1a 00 00       	call   80106249 <wakeup>
+801047e2:	83 c4 10             	add    $0x10,%esp
+801047e5:	eb c8                	jmp    801047af <end_op+0x3e>
+    commit();
+801047e7:	e8 92 fe ff ff       	call   8010467e <commit>
+    acquire(&log.lock);
+801047ec:	83 ec 0c             	sub    $0xc,%esp
+801047ef:	68 a0 ac 33 80       	push   $0x8033aca0
+801047f4:	e8 d2 31 00 00       	call   801079cb <acquire>
+    log.committing = 0;
+801047f9:	c7 05 e0 ac 33 80 00 	movl   $0x0,0x8033ace0
+80104800:	00 00 00 
+    wakeup(&log);
+80104803:	c7 04 24 a0 ac 33 80 	movl   $0x8033aca0,(%esp)
+8010480a:	e8 3a 1a 00 00       	call   80106249 <wakeup>
+    release(&log.lock);
+8010480f:	c7 04 24 a0 ac 33 80 	movl   $0x8033aca0,(%esp)
+80104816:	e8 15 32 00 00       	call   80107a30 <release>
+8010481b:	83 c4 10             	add    $0x10,%esp
+}
+8010481e:	eb a3                	jmp    801047c3 <end_op+0x52>
+
+80104820 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80104820:	55                   	push   %ebp
+80104821:	89 e5                	mov    %esp,%ebp
+80104823:	53                   	push   %ebx
+80104824:	83 ec 04             	sub    $0x4,%esp
+80104827:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+8010482a:	8b 15 e8 ac 33 80    	mov    0x8033ace8,%edx
+80104830:	83 fa 1d             	cmp    $0x1d,%edx
+80104833:	7f 2c                	jg     80104861 <log_write+0x41>
+80104835:	a1 d8 ac 33 80       	mov    0x8033acd8,%eax
+8010483a:	83 e8 01             	sub    $0x1,%eax
+8010483d:	39 c2                	cmp    %eax,%edx
+8010483f:	7d 20                	jge    80104861 <log_write+0x41>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80104841:	83 3d dc ac 33 80 00 	cmpl   $0x0,0x8033acdc
+80104848:	7e 24                	jle    8010486e <log_write+0x4e>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+8010484a:	83 ec 0c             	sub    $0xc,%esp
+8010484d:	68 a0 ac 33 80       	push   $0x8033aca0
+80104852:	e8 74 31 00 00       	call   801079cb <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+80104857:	83 c4 10             	add    $0x10,%esp
+8010485a:	b8 00 00 00 00       	mov    $0x0,%eax
+8010485f:	eb 1d                	jmp    8010487e <log_write+0x5e>
+    panic("too big a transaction");
+80104861:	83 ec 0c             	sub    $0xc,%esp
+80104864:	68 73 b6 10 80       	push   $0x8010b673
+80104869:	e8 b8 c2 ff ff       	call   80100b26 <panic>
+    panic("log_write outside of trans");
+8010486e:	83 ec 0c             	sub    $0xc,%esp
+80104871:	68 89 b6 10 80       	push   $0x8010b689
+80104876:	e8 ab c2 ff ff       	call   80100b26 <panic>
+  for (i = 0; i < log.lh.n; i++) {
+8010487b:	83 c0 01             	add    $0x1,%eax
+8010487e:	8b 15 e8 ac 33 80    	mov    0x8033ace8,%edx
+80104884:	39 c2                	cmp    %eax,%edx
+80104886:	7e 0c                	jle    80104894 <log_write+0x74>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80104888:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010488b:	39 0c 85 ec ac 33 80 	cmp    %ecx,-0x7fcc5314(,%eax,4)
+80104892:	75 e7                	jne    8010487b <log_write+0x5b>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+80104894:	8b 4b 08             	mov    0x8(%ebx),%ecx
+80104897:	89 0c 85 ec ac 33 80 	mov    %ecx,-0x7fcc5314(,%eax,4)
+  if (i == log.lh.n)
+8010489e:	39 c2                	cmp    %eax,%edx
+801048a0:	74 1c                	je     801048be <log_write+0x9e>
+    log.lh.n++;
+  b->flags |= B_DIRTY; // prevent eviction
+801048a2:	8b 03                	mov    (%ebx),%eax
+801048a4:	83 c8 04             	or     $0x4,%eax
+801048a7:	89 03                	mov    %eax,(%ebx)
+  release(&log.lock);
+801048a9:	83 ec 0c             	sub    $0xc,%esp
+801048ac:	68 a0 ac 33 80       	push   $0x8033aca0
+801048b1:	e8 7a 31 00 00       	call   80107a30 <release>
+}
+801048b6:	83 c4 10             	add    $0x10,%esp
+801048b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801048bc:	c9                   	leave
+801048bd:	c3                   	ret
+    log.lh.n++;
+801048be:	83 c2 01             	add    $0x1,%edx
+801048c1:	89 15 e8 ac 33 80    	mov    %edx,0x8033ace8
+801048c7:	eb d9                	jmp    801048a2 <log_write+0x82>
+
+801048c9 <startothers>:
+pde_t entrypgdir[];  // For entry.S
+
+// Start the non-boot (AP) processors.
+static void
+startothers(void)
+{
+801048c9:	55                   	push   %ebp
+801048ca:	89 e5                	mov    %esp,%ebp
+801048cc:	53                   	push   %ebx
+801048cd:	83 ec 08             	sub    $0x8,%esp
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+801048d0:	68 8a 00 00 00       	push   $0x8a
+801048d5:	68 8c f4 10 80       	push   $0x8010f48c
+801048da:	68 00 70 00 80       	push   $0x80007000
+801048df:	e8 0b 32 00 00       	call   80107aef <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+801048e4:	83 c4 10             	add    $0x10,%esp
+801048e7:	bb a0 ad 33 80       	mov    $0x8033ada0,%ebx
+801048ec:	eb 06                	jmp    801048f4 <startothers+0x2b>
+801048ee:	81 c3 b0 00 00 00    	add    $0xb0,%ebx
+801048f4:	69 05 84 ad 33 80 b0 	imul   $0xb0,0x8033ad84,%eax
+801048fb:	00 00 00 
+801048fe:	05 a0 ad 33 80       	add    $0x8033ada0,%eax
+80104903:	39 c3                	cmp    %eax,%ebx
+80104905:	73 4c                	jae    80104953 <startothers+0x8a>
+    if(c == mycpu())  // We've started already.
+80104907:	e8 d4 13 00 00       	call   80105ce0 <mycpu>
+8010490c:	39 c3                	cmp    %eax,%ebx
+8010490e:	74 de                	je     801048ee <startothers+0x25>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80104910:	e8 7b f6 ff ff       	call   80103f90 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80104915:	05 00 10 00 00       	add    $0x1000,%eax
+8010491a:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    *(void**)(code-8) = mpenter;
+8010491f:	c7 05 f8 6f 00 80 97 	movl   $0x80104997,0x80006ff8
+80104926:	49 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80104929:	c7 05 f4 6f 00 80 00 	movl   $0x10e000,0x80006ff4
+80104930:	e0 10 00 
+
+    lapicstartap(c->apicid, V2P(code));
+80104933:	83 ec 08             	sub    $0x8,%esp
+80104936:	68 00 70 00 00       	push   $0x7000
+8010493b:	0f b6 03             	movzbl (%ebx),%eax
+8010493e:	50                   	push   %eax
+8010493f:	e8 48 f9 ff ff       	call   8010428c <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80104944:	83 c4 10             	add    $0x10,%esp
+80104947:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+8010494d:	85 c0                	test   %eax,%eax
+8010494f:	74 f6                	je     80104947 <startothers+0x7e>
+80104951:	eb 9b                	jmp    801048ee <startothers+0x25>
+      ;
+  }
+}
+80104953:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104956:	c9                   	leave
+80104957:	c3                   	ret
+
+80104958 <mpmain>:
+{
+80104958:	55                   	push   %ebp
+80104959:	89 e5                	mov    %esp,%ebp
+8010495b:	53                   	push   %ebx
+8010495c:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+8010495f:	e8 d8 13 00 00       	call   80105d3c <cpuid>
+80104964:	89 c3                	mov    %eax,%ebx
+80104966:	e8 d1 13 00 00       	call   80105d3c <cpuid>
+8010496b:	83 ec 04             	sub    $0x4,%esp
+8010496e:	53                   	push   %ebx
+8010496f:	50                   	push   %eax
+80104970:	68 a4 b6 10 80       	push   $0x8010b6a4
+80104975:	e8 6d c4 ff ff       	call   80100de7 <cprintf>
+  idtinit();       // load idt register
+8010497a:	e8 47 45 00 00       	call   80108ec6 <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+8010497f:	e8 5c 13 00 00       	call   80105ce0 <mycpu>
+80104984:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+80104986:	b8 01 00 00 00       	mov    $0x1,%eax
+8010498b:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+80104992:	e8 0d 1c 00 00       	call   801065a4 <scheduler>
+
+80104997 <mpenter>:
+{
+80104997:	55                   	push   %ebp
+80104998:	89 e5                	mov    %esp,%ebp
+8010499a:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+8010499d:	e8 e4 5d 00 00       	call   8010a786 <switchkvm>
+  seginit();
+801049a2:	e8 6a 5b 00 00       	call   8010a511 <seginit>
+  lapicinit();
+801049a7:	e8 9c f7 ff ff       	call   80104148 <lapicinit>
+  mpmain();
+801049ac:	e8 a7 ff ff ff       	call   80104958 <mpmain>
+
+801049b1 <main>:
+{
+801049b1:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+801049b5:	83 e4 f0             	and    $0xfffffff0,%esp
+801049b8:	ff 71 fc             	push   -0x4(%ecx)
+801049bb:	55                   	push   %ebp
+801049bc:	89 e5                	mov    %esp,%ebp
+801049be:	51                   	push   %ecx
+801049bf:	83 ec 0c             	sub    $0xc,%esp
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+801049c2:	68 00 00 40 80       	push   $0x80400000
+801049c7:	68 10 70 34 80       	push   $0x80347010
+801049cc:	e8 43 f5 ff ff       	call   80103f14 <kinit1>
+  kvmalloc();      // kernel page table
+801049d1:	e8 77 62 00 00       	call   8010ac4d <kvmalloc>
+  mpinit();        // detect other processors
+801049d6:	e8 cb 01 00 00       	call   80104ba6 <mpinit>
+  lapicinit();     // interrupt controller
+801049db:	e8 68 f7 ff ff       	call   80104148 <lapicinit>
+  seginit();       // segment descriptors
+801049e0:	e8 2c 5b 00 00       	call   8010a511 <seginit>
+  picinit();       // disable pic
+801049e5:	e8 ab 03 00 00       	call   80104d95 <picinit>
+  ioapicinit();    // another interrupt controller
+801049ea:	e8 7f f0 ff ff       	call   80103a6e <ioapicinit>
+  consoleinit();   // console hardware
+801049ef:	e8 39 c7 ff ff       	call   8010112d <consoleinit>
+  uartinit();      // serial port
+801049f4:	e8 a6 47 00 00       	call   8010919f <uartinit>
+  pinit();         // process table
+801049f9:	e8 a7 12 00 00       	call   80105ca5 <pinit>
+  tvinit();        // trap vectors
+801049fe:	e8 d6 43 00 00       	call   80108dd9 <tvinit>
+  binit();         // buffer cache
+80104a03:	e8 8e bd ff ff       	call   80100796 <binit>
+  fileinit();      // file table
+80104a08:	e8 85 cc ff ff       	call   80101692 <fileinit>
+  ideinit();       // disk 
+80104a0d:	e8 90 65 00 00       	call   8010afa2 <ideinit>
+  virtioinit();    // virtio disk
+80104a12:	e8 2d 54 00 00       	call   80109e44 <virtioinit>
+  startothers();   // start other processors
+80104a17:	e8 ad fe ff ff       	call   801048c9 <startothers>
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+80104a1c:	83 c4 08             	add    $0x8,%esp
+80104a1f:	68 00 00 00 8e       	push   $0x8e000000
+80104a24:	68 00 00 40 80       	push   $0x80400000
+80104a29:	e8 42 f5 ff ff       	call   80103f70 <kinit2>
+  binit2();        // let buffer cache use the memory
+80104a2e:	e8 fe bd ff ff       	call   80100831 <binit2>
+  userinit();      // first user process
+80104a33:	e8 ab 13 00 00       	call   80105de3 <userinit>
+  mpmain();        // finish this processor's setup
+80104a38:	e8 1b ff ff ff       	call   80104958 <mpmain>
+
+80104a3d <sum>:
+int ncpu;
+uchar ioapicid;
+
+static uchar
+sum(uchar *addr, int len)
+{
+80104a3d:	55                   	push   %ebp
+80104a3e:	89 e5                	mov    %esp,%ebp
+80104a40:	56                   	push   %esi
+80104a41:	53                   	push   %ebx
+80104a42:	89 c6                	mov    %eax,%esi
+  int i, sum;
+
+  sum = 0;
+80104a44:	b8 00 00 00 00       	mov    $0x0,%eax
+  for(i=0; i<len; i++)
+80104a49:	b9 00 00 00 00       	mov    $0x0,%ecx
+80104a4e:	eb 09                	jmp    80104a59 <sum+0x1c>
+    sum += addr[i];
+80104a50:	0f b6 1c 0e          	movzbl (%esi,%ecx,1),%ebx
+80104a54:	01 d8                	add    %ebx,%eax
+  for(i=0; i<len; i++)
+80104a56:	83 c1 01             	add    $0x1,%ecx
+80104a59:	39 d1                	cmp    %edx,%ecx
+80104a5b:	7c f3                	jl     80104a50 <sum+0x13>
+  return sum;
+}
+80104a5d:	5b                   	pop    %ebx
+80104a5e:	5e                   	pop    %esi
+80104a5f:	5d                   	pop    %ebp
+80104a60:	c3                   	ret
+
+80104a61 <mpsearch1>:
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80104a61:	55                   	push   %ebp
+80104a62:	89 e5                	mov    %esp,%ebp
+80104a64:	56                   	push   %esi
+80104a65:	53                   	push   %ebx
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80104a66:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+80104a6c:	89 f3                	mov    %esi,%ebx
+  e = addr+len;
+80104a6e:	01 d6                	add    %edx,%esi
+  for(p = addr; p < e; p += sizeof(struct mp))
+80104a70:	eb 03                	jmp    80104a75 <mpsearch1+0x14>
+80104a72:	83 c3 10             	add    $0x10,%ebx
+80104a75:	39 f3                	cmp    %esi,%ebx
+80104a77:	73 29                	jae    80104aa2 <mpsearch1+0x41>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104a79:	83 ec 04             	sub    $0x4,%esp
+80104a7c:	6a 04                	push   $0x4
+80104a7e:	68 b8 b6 10 80       	push   $0x8010b6b8
+80104a83:	53                   	push   %ebx
+80104a84:	e8 31 30 00 00       	call   80107aba <memcmp>
+80104a89:	83 c4 10             	add    $0x10,%esp
+80104a8c:	85 c0                	test   %eax,%eax
+80104a8e:	75 e2                	jne    80104a72 <mpsearch1+0x11>
+80104a90:	ba 10 00 00 00       	mov    $0x10,%edx
+80104a95:	89 d8                	mov    %ebx,%eax
+80104a97:	e8 a1 ff ff ff       	call   80104a3d <sum>
+80104a9c:	84 c0                	test   %al,%al
+80104a9e:	75 d2                	jne    80104a72 <mpsearch1+0x11>
+80104aa0:	eb 05                	jmp    80104aa7 <mpsearch1+0x46>
+      return (struct mp*)p;
+  return 0;
+80104aa2:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+80104aa7:	89 d8                	mov    %ebx,%eax
+80104aa9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104aac:	5b                   	pop    %ebx
+80104aad:	5e                   	pop    %esi
+80104aae:	5d                   	pop    %ebp
+80104aaf:	c3                   	ret
+
+80104ab0 <mpsearch>:
+// 1) in the first KB of the EBDA;
+// 2) in the last KB of system base memory;
+// 3) in the BIOS ROM between 0xE0000 and 0xFFFFF.
+static struct mp*
+mpsearch(void)
+{
+80104ab0:	55                   	push   %ebp
+80104ab1:	89 e5                	mov    %esp,%ebp
+80104ab3:	83 ec 08             	sub    $0x8,%esp
+  uchar *bda;
+  uint p;
+  struct mp *mp;
+
+  bda = (uchar *) P2V(0x400);
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80104ab6:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80104abd:	c1 e0 08             	shl    $0x8,%eax
+80104ac0:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80104ac7:	09 d0                	or     %edx,%eax
+80104ac9:	c1 e0 04             	shl    $0x4,%eax
+80104acc:	74 1f                	je     80104aed <mpsearch+0x3d>
+    if((mp = mpsearch1(p, 1024)))
+80104ace:	ba 00 04 00 00       	mov    $0x400,%edx
+80104ad3:	e8 89 ff ff ff       	call   80104a61 <mpsearch1>
+80104ad8:	85 c0                	test   %eax,%eax
+80104ada:	75 0f                	jne    80104aeb <mpsearch+0x3b>
+  } else {
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+    if((mp = mpsearch1(p-1024, 1024)))
+      return mp;
+  }
+  return mpsearch1(0xF0000, 0x10000);
+80104adc:	ba 00 00 01 00       	mov    $0x10000,%edx
+80104ae1:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+80104ae6:	e8 76 ff ff ff       	call   80104a61 <mpsearch1>
+}
+80104aeb:	c9                   	leave
+80104aec:	c3                   	ret
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80104aed:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80104af4:	c1 e0 08             	shl    $0x8,%eax
+80104af7:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+80104afe:	09 d0                	or     %edx,%eax
+80104b00:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80104b03:	2d 00 04 00 00       	sub    $0x400,%eax
+80104b08:	ba 00 04 00 00       	mov    $0x400,%edx
+80104b0d:	e8 4f ff ff ff       	call   80104a61 <mpsearch1>
+80104b12:	85 c0                	test   %eax,%eax
+80104b14:	75 d5                	jne    80104aeb <mpsearch+0x3b>
+80104b16:	eb c4                	jmp    80104adc <mpsearch+0x2c>
+
+80104b18 <mpconfig>:
+// Check for correct signature, calculate the checksum and,
+// if correct, check the version.
+// To do: check extended table checksum.
+static struct mpconf*
+mpconfig(struct mp **pmp)
+{
+80104b18:	55                   	push   %ebp
+80104b19:	89 e5                	mov    %esp,%ebp
+80104b1b:	57                   	push   %edi
+80104b1c:	56                   	push   %esi
+80104b1d:	53                   	push   %ebx
+80104b1e:	83 ec 1c             	sub    $0x1c,%esp
+80104b21:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct mpconf *conf;
+  struct mp *mp;
+
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80104b24:	e8 87 ff ff ff       	call   80104ab0 <mpsearch>
+80104b29:	89 c3                	mov    %eax,%ebx
+80104b2b:	85 c0                	test   %eax,%eax
+80104b2d:	74 5a                	je     80104b89 <mpconfig+0x71>
+80104b2f:	8b 70 04             	mov    0x4(%eax),%esi
+80104b32:	85 f6                	test   %esi,%esi
+80104b34:	74 57                	je     80104b8d <mpconfig+0x75>
+    return 0;
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+80104b36:	8d be 00 00 00 80    	lea    -0x80000000(%esi),%edi
+  if(memcmp(conf, "PCMP", 4) != 0)
+80104b3c:	83 ec 04             	sub    $0x4,%esp
+80104b3f:	6a 04                	push   $0x4
+80104b41:	68 bd b6 10 80       	push   $0x8010b6bd
+80104b46:	57                   	push   %edi
+80104b47:	e8 6e 2f 00 00       	call   80107aba <memcmp>
+80104b4c:	83 c4 10             	add    $0x10,%esp
+80104b4f:	85 c0                	test   %eax,%eax
+80104b51:	75 3e                	jne    80104b91 <mpconfig+0x79>
+    return 0;
+  if(conf->version != 1 && conf->version != 4)
+80104b53:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+80104b5a:	3c 01                	cmp    $0x1,%al
+80104b5c:	0f 95 c2             	setne  %dl
+80104b5f:	3c 04                	cmp    $0x4,%al
+80104b61:	0f 95 c0             	setne  %al
+80104b64:	84 c2                	test   %al,%dl
+80104b66:	75 30                	jne    80104b98 <mpconfig+0x80>
+    return 0;
+  if(sum((uchar*)conf, conf->length) != 0)
+80104b68:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+80104b6f:	89 f8                	mov    %edi,%eax
+80104b71:	e8 c7 fe ff ff       	call   80104a3d <sum>
+80104b76:	84 c0                	test   %al,%al
+80104b78:	75 25                	jne    80104b9f <mpconfig+0x87>
+    return 0;
+  *pmp = mp;
+80104b7a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104b7d:	89 18                	mov    %ebx,(%eax)
+  return conf;
+}
+80104b7f:	89 f8                	mov    %edi,%eax
+80104b81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104b84:	5b                   	pop    %ebx
+80104b85:	5e                   	pop    %esi
+80104b86:	5f                   	pop    %edi
+80104b87:	5d                   	pop    %ebp
+80104b88:	c3                   	ret
+    return 0;
+80104b89:	89 c7                	mov    %eax,%edi
+80104b8b:	eb f2                	jmp    80104b7f <mpconfig+0x67>
+80104b8d:	89 f7                	mov    %esi,%edi
+80104b8f:	eb ee                	jmp    80104b7f <mpconfig+0x67>
+    return 0;
+80104b91:	bf 00 00 00 00       	mov    $0x0,%edi
+80104b96:	eb e7                	jmp    80104b7f <mpconfig+0x67>
+    return 0;
+80104b98:	bf 00 00 00 00       	mov    $0x0,%edi
+80104b9d:	eb e0                	jmp    80104b7f <mpconfig+0x67>
+    return 0;
+80104b9f:	bf 00 00 00 00       	mov    $0x0,%edi
+80104ba4:	eb d9                	jmp    80104b7f <mpconfig+0x67>
+
+80104ba6 <mpinit>:
+
+void
+mpinit(void)
+{
+80104ba6:	55                   	push   %ebp
+80104ba7:	89 e5                	mov    %esp,%ebp
+80104ba9:	57                   	push   %edi
+80104baa:	56                   	push   %esi
+80104bab:	53                   	push   %ebx
+80104bac:	83 ec 1c             	sub    $0x1c,%esp
+  struct mp *mp;
+  struct mpconf *conf;
+  struct mpproc *proc;
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+80104baf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80104bb2:	e8 61 ff ff ff       	call   80104b18 <mpconfig>
+80104bb7:	85 c0                	test   %eax,%eax
+80104bb9:	74 19                	je     80104bd4 <mpinit+0x2e>
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+80104bbb:	8b 50 24             	mov    0x24(%eax),%edx
+80104bbe:	89 15 84 ac 33 80    	mov    %edx,0x8033ac84
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104bc4:	8d 50 2c             	lea    0x2c(%eax),%edx
+80104bc7:	0f b7 48 04          	movzwl 0x4(%eax),%ecx
+80104bcb:	01 c1                	add    %eax,%ecx
+  ismp = 1;
+80104bcd:	bb 01 00 00 00       	mov    $0x1,%ebx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104bd2:	eb 20                	jmp    80104bf4 <mpinit+0x4e>
+    panic("Expect to run on an SMP");
+80104bd4:	83 ec 0c             	sub    $0xc,%esp
+80104bd7:	68 c2 b6 10 80       	push   $0x8010b6c2
+80104bdc:	e8 45 bf ff ff       	call   80100b26 <panic>
+    switch(*p){
+80104be1:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104be6:	eb 0c                	jmp    80104bf4 <mpinit+0x4e>
+80104be8:	83 e8 03             	sub    $0x3,%eax
+80104beb:	3c 01                	cmp    $0x1,%al
+80104bed:	76 1a                	jbe    80104c09 <mpinit+0x63>
+80104bef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104bf4:	39 ca                	cmp    %ecx,%edx
+80104bf6:	73 4d                	jae    80104c45 <mpinit+0x9f>
+    switch(*p){
+80104bf8:	0f b6 02             	movzbl (%edx),%eax
+80104bfb:	3c 02                	cmp    $0x2,%al
+80104bfd:	74 38                	je     80104c37 <mpinit+0x91>
+80104bff:	77 e7                	ja     80104be8 <mpinit+0x42>
+80104c01:	84 c0                	test   %al,%al
+80104c03:	74 09                	je     80104c0e <mpinit+0x68>
+80104c05:	3c 01                	cmp    $0x1,%al
+80104c07:	75 d8                	jne    80104be1 <mpinit+0x3b>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80104c09:	83 c2 08             	add    $0x8,%edx
+      continue;
+80104c0c:	eb e6                	jmp    80104bf4 <mpinit+0x4e>
+      if(ncpu < NCPU) {
+80104c0e:	8b 35 84 ad 33 80    	mov    0x8033ad84,%esi
+80104c14:	83 fe 07             	cmp    $0x7,%esi
+80104c17:	7f 19                	jg     80104c32 <mpinit+0x8c>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80104c19:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+80104c1d:	69 fe b0 00 00 00    	imul   $0xb0,%esi,%edi
+80104c23:	88 87 a0 ad 33 80    	mov    %al,-0x7fcc5260(%edi)
+        ncpu++;
+80104c29:	83 c6 01             	add    $0x1,%esi
+80104c2c:	89 35 84 ad 33 80    	mov    %esi,0x8033ad84
+      p += sizeof(struct mpproc);
+80104c32:	83 c2 14             	add    $0x14,%edx
+      continue;
+80104c35:	eb bd                	jmp    80104bf4 <mpinit+0x4e>
+      ioapicid = ioapic->apicno;
+80104c37:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+80104c3b:	a2 80 ad 33 80       	mov    %al,0x8033ad80
+      p += sizeof(struct mpioapic);
+80104c40:	83 c2 08             	add    $0x8,%edx
+      continue;
+80104c43:	eb af                	jmp    80104bf4 <mpinit+0x4e>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80104c45:	85 db                	test   %ebx,%ebx
+80104c47:	74 26                	je     80104c6f <mpinit+0xc9>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80104c49:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104c4c:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+80104c50:	74 15                	je     80104c67 <mpinit+0xc1>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104c52:	b8 70 00 00 00       	mov    $0x70,%eax
+80104c57:	ba 22 00 00 00       	mov    $0x22,%edx
+80104c5c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104c5d:	ba 23 00 00 00       	mov    $0x23,%edx
+80104c62:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+80104c63:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104c66:	ee                   	out    %al,(%dx)
+  }
+}
+80104c67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104c6a:	5b                   	pop    %ebx
+80104c6b:	5e                   	pop    %esi
+80104c6c:	5f                   	pop    %edi
+80104c6d:	5d                   	pop    %ebp
+80104c6e:	c3                   	ret
+    panic("Didn't find a suitable machine");
+80104c6f:	83 ec 0c             	sub    $0xc,%esp
+80104c72:	68 dc b6 10 80       	push   $0x8010b6dc
+80104c77:	e8 aa be ff ff       	call   80100b26 <panic>
+
+80104c7c <pciread>:
+#define CONFIG_ADDRESS  0xCF8
+#define CONFIG_DATA     0xCFC
+
+uint
+pciread(uint bdf, int off)
+{
+80104c7c:	55                   	push   %ebp
+80104c7d:	89 e5                	mov    %esp,%ebp
+  outl(CONFIG_ADDRESS, 0x80000000 | bdf<<8 | (off & 0xFC));
+80104c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+80104c82:	c1 e0 08             	shl    $0x8,%eax
+80104c85:	8b 55 0c             	mov    0xc(%ebp),%edx
+80104c88:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80104c8e:	09 d0                	or     %edx,%eax
+80104c90:	0d 00 00 00 80       	or     $0x80000000,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104c95:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104c9a:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104c9b:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104ca0:	ed                   	in     (%dx),%eax
+  return inl(CONFIG_DATA);
+}
+80104ca1:	5d                   	pop    %ebp
+80104ca2:	c3                   	ret
+
+80104ca3 <pciwrite>:
+
+void
+pciwrite(uint bdf, int off, uint val)
+{
+80104ca3:	55                   	push   %ebp
+80104ca4:	89 e5                	mov    %esp,%ebp
+  outl(CONFIG_ADDRESS, 0x80000000 | bdf<<8 | (off & 0xFC));
+80104ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+80104ca9:	c1 e0 08             	shl    $0x8,%eax
+80104cac:	8b 55 0c             	mov    0xc(%ebp),%edx
+80104caf:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80104cb5:	09 d0                	or     %edx,%eax
+80104cb7:	0d 00 00 00 80       	or     $0x80000000,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104cbc:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104cc1:	ef                   	out    %eax,(%dx)
+80104cc2:	8b 45 10             	mov    0x10(%ebp),%eax
+80104cc5:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104cca:	ef                   	out    %eax,(%dx)
+  outl(CONFIG_DATA, val);
+}
+80104ccb:	5d                   	pop    %ebp
+80104ccc:	c3                   	ret
+
+80104ccd <pcifind>:
+// Find the first device function whose config register off,
+// masked with mask, equals val. Returns 0 and sets *bdf if
+// found, -1 if not.
+int
+pcifind(int off, uint mask, uint val, uint *bdf)
+{
+80104ccd:	55                   	push   %ebp
+80104cce:	89 e5                	mov    %esp,%ebp
+80104cd0:	57                   	push   %edi
+80104cd1:	56                   	push   %esi
+80104cd2:	53                   	push   %ebx
+80104cd3:	83 ec 1c             	sub    $0x1c,%esp
+  uint bus, dev, func, nfunc, b;
+
+  for(bus = 0; bus < 256; bus++){
+80104cd6:	bf 00 00 00 00       	mov    $0x0,%edi
+80104cdb:	81 ff ff 00 00 00    	cmp    $0xff,%edi
+80104ce1:	0f 87 a7 00 00 00    	ja     80104d8e <pcifind+0xc1>
+    for(dev = 0; dev < 32; dev++){
+80104ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+80104cec:	89 7d e0             	mov    %edi,-0x20(%ebp)
+80104cef:	89 d3                	mov    %edx,%ebx
+80104cf1:	eb 7d                	jmp    80104d70 <pcifind+0xa3>
+        b = bus<<8 | dev<<3 | func;
+        if((pciread(b, PCI_ID) & 0xFFFF) == 0xFFFF)
+          continue;  // no such function
+        if(func == 0 && (pciread(b, PCI_HEADER) & 0x800000))
+          nfunc = 8;  // multi-function device
+        if((pciread(b, off) & mask) == val){
+80104cf3:	83 ec 08             	sub    $0x8,%esp
+80104cf6:	ff 75 08             	push   0x8(%ebp)
+80104cf9:	57                   	push   %edi
+80104cfa:	e8 7d ff ff ff       	call   80104c7c <pciread>
+80104cff:	23 45 0c             	and    0xc(%ebp),%eax
+80104d02:	83 c4 10             	add    $0x10,%esp
+80104d05:	3b 45 10             	cmp    0x10(%ebp),%eax
+80104d08:	74 51                	je     80104d5b <pcifind+0x8e>
+      for(func = 0; func < nfunc; func++){
+80104d0a:	83 c6 01             	add    $0x1,%esi
+80104d0d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104d10:	39 c6                	cmp    %eax,%esi
+80104d12:	73 59                	jae    80104d6d <pcifind+0xa0>
+        b = bus<<8 | dev<<3 | func;
+80104d14:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80104d17:	c1 e7 08             	shl    $0x8,%edi
+80104d1a:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+80104d21:	09 c7                	or     %eax,%edi
+80104d23:	09 f7                	or     %esi,%edi
+        if((pciread(b, PCI_ID) & 0xFFFF) == 0xFFFF)
+80104d25:	83 ec 08             	sub    $0x8,%esp
+80104d28:	6a 00                	push   $0x0
+80104d2a:	57                   	push   %edi
+80104d2b:	e8 4c ff ff ff       	call   80104c7c <pciread>
+80104d30:	83 c4 10             	add    $0x10,%esp
+80104d33:	66 83 f8 ff          	cmp    $0xffff,%ax
+80104d37:	74 d1                	je     80104d0a <pcifind+0x3d>
+        if(func == 0 && (pciread(b, PCI_HEADER) & 0x800000))
+80104d39:	85 f6                	test   %esi,%esi
+80104d3b:	75 b6                	jne    80104cf3 <pcifind+0x26>
+80104d3d:	83 ec 08             	sub    $0x8,%esp
+80104d40:	6a 0c                	push   $0xc
+80104d42:	57                   	push   %edi
+80104d43:	e8 34 ff ff ff       	call   80104c7c <pciread>
+80104d48:	83 c4 10             	add    $0x10,%esp
+80104d4b:	a9 00 00 80 00       	test   $0x800000,%eax
+80104d50:	74 a1                	je     80104cf3 <pcifind+0x26>
+          nfunc = 8;  // multi-function device
+80104d52:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%ebp)
+80104d59:	eb 98                	jmp    80104cf3 <pcifind+0x26>
+          *bdf = b;
+80104d5b:	8b 45 14             	mov    0x14(%ebp),%eax
+80104d5e:	89 38                	mov    %edi,(%eax)
+          return 0;
+80104d60:	b8 00 00 00 00       	mov    $0x0,%eax
+        }
+      }
+    }
+  }
+  return -1;
+}
+80104d65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104d68:	5b                   	pop    %ebx
+80104d69:	5e                   	pop    %esi
+80104d6a:	5f                   	pop    %edi
+80104d6b:	5d                   	pop    %ebp
+80104d6c:	c3                   	ret
+    for(dev = 0; dev < 32; dev++){
+80104d6d:	83 c3 01             	add    $0x1,%ebx
+80104d70:	83 fb 1f             	cmp    $0x1f,%ebx
+80104d73:	77 0e                	ja     80104d83 <pcifind+0xb6>
+      nfunc = 1;
+80104d75:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      for(func = 0; func < nfunc; func++){
+80104d7c:	be 00 00 00 00       	mov    $0x0,%esi
+80104d81:	eb 8a                	jmp    80104d0d <pcifind+0x40>
+  for(bus = 0; bus < 256; bus++){
+80104d83:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80104d86:	83 c7 01             	add    $0x1,%edi
+80104d89:	e9 4d ff ff ff       	jmp    80104cdb <pcifind+0xe>
+  return -1;
+80104d8e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104d93:	eb d0                	jmp    80104d65 <pcifind+0x98>
+
+80104d95 <picinit>:
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104d95:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104d9a:	ba 21 00 00 00       	mov    $0x21,%edx
+80104d9f:	ee                   	out    %al,(%dx)
+80104da0:	ba a1 00 00 00       	mov    $0xa1,%edx
+80104da5:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80104da6:	c3                   	ret
+
+80104da7 <pipefreepg>:
+  return -1;
+}
+
+static void
+pipefreepg(struct pipe *p)
+{
+80104da7:	55                   	push   %ebp
+80104da8:	89 e5                	mov    %esp,%ebp
+80104daa:	56                   	push   %esi
+80104dab:	53                   	push   %ebx
+80104dac:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if(p->pg[0] != (char*)(p + 1))
+80104dae:	8d 80 94 00 00 00    	lea    0x94(%eax),%eax
+80104db4:	39 46 34             	cmp    %eax,0x34(%esi)
+80104db7:	74 1e                	je     80104dd7 <pipefreepg+0x30>
+    for(i = 0; i < p->npg; i++)
+80104db9:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104dbe:	eb 12                	jmp    80104dd2 <pipefreepg+0x2b>
+      kfree(p->pg[i]);
+80104dc0:	83 ec 0c             	sub    $0xc,%esp
+80104dc3:	ff 74 9e 34          	push   0x34(%esi,%ebx,4)
+80104dc7:	e8 a5 ef ff ff       	call   80103d71 <kfree>
+    for(i = 0; i < p->npg; i++)
+80104dcc:	83 c3 01             	add    $0x1,%ebx
+80104dcf:	83 c4 10             	add    $0x10,%esp
+80104dd2:	39 5e 74             	cmp    %ebx,0x74(%esi)
+80104dd5:	7f e9                	jg     80104dc0 <pipefreepg+0x19>
+}
+80104dd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104dda:	5b                   	pop    %ebx
+80104ddb:	5e                   	pop    %esi
+80104ddc:	5d                   	pop    %ebp
+80104ddd:	c3                   	ret
+
+80104dde <pipecopy>:
+{
+80104dde:	55                   	push   %ebp
+80104ddf:	89 e5                	mov    %esp,%ebp
+80104de1:	57                   	push   %edi
+80104de2:	56                   	push   %esi
+80104de3:	53                   	push   %ebx
+80104de4:	83 ec 1c             	sub    $0x1c,%esp
+80104de7:	89 c7                	mov    %eax,%edi
+80104de9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80104dec:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80104def:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(; n > 0; n -= m, addr += m, i = (i + m) % p->size){
+80104df2:	eb 25                	jmp    80104e19 <pipecopy+0x3b>
+      memmove(addr, b, m);
+80104df4:	83 ec 04             	sub    $0x4,%esp
+80104df7:	53                   	push   %ebx
+80104df8:	51                   	push   %ecx
+80104df9:	ff 75 e0             	push   -0x20(%ebp)
+80104dfc:	e8 ee 2c 00 00       	call   80107aef <memmove>
+80104e01:	83 c4 10             	add    $0x10,%esp
+  for(; n > 0; n -= m, addr += m, i = (i + m) % p->size){
+80104e04:	29 de                	sub    %ebx,%esi
+80104e06:	01 5d e0             	add    %ebx,-0x20(%ebp)
+80104e09:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104e0c:	01 d8                	add    %ebx,%eax
+80104e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+80104e13:	f7 77 7c             	divl   0x7c(%edi)
+80104e16:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80104e19:	85 f6                	test   %esi,%esi
+80104e1b:	74 32                	je     80104e4f <pipecopy+0x71>
+    b = p->pg[i / p->pgsize] + i % p->pgsize;
+80104e1d:	8b 5f 78             	mov    0x78(%edi),%ebx
+80104e20:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104e23:	ba 00 00 00 00       	mov    $0x0,%edx
+80104e28:	f7 f3                	div    %ebx
+80104e2a:	89 d1                	mov    %edx,%ecx
+80104e2c:	03 4c 87 34          	add    0x34(%edi,%eax,4),%ecx
+    m = min(n, p->pgsize - i % p->pgsize);
+80104e30:	29 d3                	sub    %edx,%ebx
+80104e32:	39 f3                	cmp    %esi,%ebx
+80104e34:	0f 47 de             	cmova  %esi,%ebx
+    if(in)
+80104e37:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+80104e3b:	74 b7                	je     80104df4 <pipecopy+0x16>
+      memmove(b, addr, m);
+80104e3d:	83 ec 04             	sub    $0x4,%esp
+80104e40:	53                   	push   %ebx
+80104e41:	ff 75 e0             	push   -0x20(%ebp)
+80104e44:	51                   	push   %ecx
+80104e45:	e8 a5 2c 00 00       	call   80107aef <memmove>
+80104e4a:	83 c4 10             	add    $0x10,%esp
+80104e4d:	eb b5                	jmp    80104e04 <pipecopy+0x26>
+}
+80104e4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104e52:	5b                   	pop    %ebx
+80104e53:	5e                   	pop    %esi
+80104e54:	5f                   	pop    %edi
+80104e55:	5d                   	pop    %ebp
+80104e56:	c3                   	ret
+
+80104e57 <pipein>:
+
+// Move up to n bytes from addr into p's ring, as many as fit.
+// Caller must hold p->lock.
+static int
+pipein(struct pipe *p, char *addr, int n)
+{
+80104e57:	55                   	push   %ebp
+80104e58:	89 e5                	mov    %esp,%ebp
+80104e5a:	57                   	push   %edi
+80104e5b:	56                   	push   %esi
+80104e5c:	53                   	push   %ebx
+80104e5d:	83 ec 14             	sub    $0x14,%esp
+80104e60:	89 c3                	mov    %eax,%ebx
+80104e62:	89 d7                	mov    %edx,%edi
+80104e64:	89 ce                	mov    %ecx,%esi
+  int m;
+
+  m = min(n, p->size - (p->nwrite - p->nread));
+80104e66:	8b 88 84 00 00 00    	mov    0x84(%eax),%ecx
+80104e6c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+80104e72:	89 ca                	mov    %ecx,%edx
+80104e74:	29 c2                	sub    %eax,%edx
+80104e76:	03 53 7c             	add    0x7c(%ebx),%edx
+80104e79:	39 d6                	cmp    %edx,%esi
+80104e7b:	0f 47 f2             	cmova  %edx,%esi
+  pipecopy(p, (p->rpos + p->nwrite - p->nread) % p->size, addr, m, 1);
+80104e7e:	03 83 80 00 00 00    	add    0x80(%ebx),%eax
+80104e84:	29 c8                	sub    %ecx,%eax
+80104e86:	ba 00 00 00 00       	mov    $0x0,%edx
+80104e8b:	f7 73 7c             	divl   0x7c(%ebx)
+80104e8e:	6a 01                	push   $0x1
+80104e90:	56                   	push   %esi
+80104e91:	89 f9                	mov    %edi,%ecx
+80104e93:	89 d8                	mov    %ebx,%eax
+80104e95:	e8 44 ff ff ff       	call   80104dde <pipecopy>
+  p->nwrite += m;
+80104e9a:	01 b3 88 00 00 00    	add    %esi,0x88(%ebx)
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+80104ea0:	81 c3 84 00 00 00    	add    $0x84,%ebx
+80104ea6:	89 1c 24             	mov    %ebx,(%esp)
+80104ea9:	e8 9b 13 00 00       	call   80106249 <wakeup>
+  return m;
+}
+80104eae:	89 f0                	mov    %esi,%eax
+80104eb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104eb3:	5b                   	pop    %ebx
+80104eb4:	5e                   	pop    %esi
+80104eb5:	5f                   	pop    %edi
+80104eb6:	5d                   	pop    %ebp
+80104eb7:	c3                   	ret
+
+80104eb8 <pipeout>:
+
+// Move up to n buffered bytes out of p's ring into addr.
+// Caller must hold p->lock.
+static int
+pipeout(struct pipe *p, char *addr, int n)
+{
+80104eb8:	55                   	push   %ebp
+80104eb9:	89 e5                	mov    %esp,%ebp
+80104ebb:	56                   	push   %esi
+80104ebc:	53                   	push   %ebx
+80104ebd:	89 c3                	mov    %eax,%ebx
+  int m;
+
+  m = min(n, p->nwrite - p->nread);  //DOC: piperead-copy
+80104ebf:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+80104ec5:	2b 83 84 00 00 00    	sub    0x84(%ebx),%eax
+80104ecb:	39 c1                	cmp    %eax,%ecx
+80104ecd:	0f 46 c1             	cmovbe %ecx,%eax
+80104ed0:	89 c6                	mov    %eax,%esi
+  pipecopy(p, p->rpos, addr, m, 0);
+80104ed2:	83 ec 08             	sub    $0x8,%esp
+80104ed5:	6a 00                	push   $0x0
+80104ed7:	50                   	push   %eax
+80104ed8:	89 d1                	mov    %edx,%ecx
+80104eda:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+80104ee0:	89 d8                	mov    %ebx,%eax
+80104ee2:	e8 f7 fe ff ff       	call   80104dde <pipecopy>
+  p->rpos = (p->rpos + m) % p->size;
+80104ee7:	89 f0                	mov    %esi,%eax
+80104ee9:	03 83 80 00 00 00    	add    0x80(%ebx),%eax
+80104eef:	ba 00 00 00 00       	mov    $0x0,%edx
+80104ef4:	f7 73 7c             	divl   0x7c(%ebx)
+80104ef7:	89 93 80 00 00 00    	mov    %edx,0x80(%ebx)
+  p->nread += m;
+80104efd:	01 b3 84 00 00 00    	add    %esi,0x84(%ebx)
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+80104f03:	81 c3 88 00 00 00    	add    $0x88,%ebx
+80104f09:	89 1c 24             	mov    %ebx,(%esp)
+80104f0c:	e8 38 13 00 00       	call   80106249 <wakeup>
+  return m;
+}
+80104f11:	89 f0                	mov    %esi,%eax
+80104f13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104f16:	5b                   	pop    %ebx
+80104f17:	5e                   	pop    %esi
+80104f18:	5d                   	pop    %ebp
+80104f19:	c3                   	ret
+
+80104f1a <pipealloc>:
+{
+80104f1a:	55                   	push   %ebp
+80104f1b:	89 e5                	mov    %esp,%ebp
+80104f1d:	57                   	push   %edi
+80104f1e:	56                   	push   %esi
+80104f1f:	53                   	push   %ebx
+80104f20:	83 ec 0c             	sub    $0xc,%esp
+80104f23:	8b 75 08             	mov    0x8(%ebp),%esi
+80104f26:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  *f0 = *f1 = 0;
+80104f29:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80104f2f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+80104f35:	e8 81 c7 ff ff       	call   801016bb <filealloc>
+80104f3a:	89 06                	mov    %eax,(%esi)
+80104f3c:	85 c0                	test   %eax,%eax
+80104f3e:	0f 84 b8 00 00 00    	je     80104ffc <pipealloc+0xe2>
+80104f44:	e8 72 c7 ff ff       	call   801016bb <filealloc>
+80104f49:	89 07                	mov    %eax,(%edi)
+80104f4b:	85 c0                	test   %eax,%eax
+80104f4d:	0f 84 a9 00 00 00    	je     80104ffc <pipealloc+0xe2>
+  if((p = (struct pipe*)kalloc()) == 0)
+80104f53:	e8 38 f0 ff ff       	call   80103f90 <kalloc>
+80104f58:	89 c3                	mov    %eax,%ebx
+80104f5a:	85 c0                	test   %eax,%eax
+80104f5c:	0f 84 9a 00 00 00    	je     80104ffc <pipealloc+0xe2>
+  p->readopen = 1;
+80104f62:	c7 80 8c 00 00 00 01 	movl   $0x1,0x8c(%eax)
+80104f69:	00 00 00 
+  p->writeopen = 1;
+80104f6c:	c7 80 90 00 00 00 01 	movl   $0x1,0x90(%eax)
+80104f73:	00 00 00 
+  p->pg[0] = (char*)(p + 1);
+80104f76:	8d 80 94 00 00 00    	lea    0x94(%eax),%eax
+80104f7c:	89 43 34             	mov    %eax,0x34(%ebx)
+  p->npg = 1;
+80104f7f:	c7 43 74 01 00 00 00 	movl   $0x1,0x74(%ebx)
+  p->pgsize = PGSIZE - sizeof(*p);
+80104f86:	c7 43 78 6c 0f 00 00 	movl   $0xf6c,0x78(%ebx)
+  p->size = p->pgsize;
+80104f8d:	c7 43 7c 6c 0f 00 00 	movl   $0xf6c,0x7c(%ebx)
+  p->rpos = 0;
+80104f94:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+80104f9b:	00 00 00 
+  p->nwrite = 0;
+80104f9e:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80104fa5:	00 00 00 
+  p->nread = 0;
+80104fa8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80104faf:	00 00 00 
+  initlock(&p->lock, "pipe");
+80104fb2:	83 ec 08             	sub    $0x8,%esp
+80104fb5:	68 fb b6 10 80       	push   $0x8010b6fb
+80104fba:	53                   	push   %ebx
+80104fbb:	e8 c7 28 00 00       	call   80107887 <initlock>
+  (*f0)->type = FD_PIPE;
+80104fc0:	8b 06                	mov    (%esi),%eax
+80104fc2:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+80104fc8:	8b 06                	mov    (%esi),%eax
+80104fca:	c6 40 0c 01          	movb   $0x1,0xc(%eax)
+  (*f0)->writable = 0;
+80104fce:	8b 06                	mov    (%esi),%eax
+80104fd0:	c6 40 0d 00          	movb   $0x0,0xd(%eax)
+  (*f0)->pipe = p;
+80104fd4:	8b 06                	mov    (%esi),%eax
+80104fd6:	89 58 10             	mov    %ebx,0x10(%eax)
+  (*f1)->type = FD_PIPE;
+80104fd9:	8b 07                	mov    (%edi),%eax
+80104fdb:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+80104fe1:	8b 07                	mov    (%edi),%eax
+80104fe3:	c6 40 0c 00          	movb   $0x0,0xc(%eax)
+  (*f1)->writable = 1;
+80104fe7:	8b 07                	mov    (%edi),%eax
+80104fe9:	c6 40 0d 01          	movb   $0x1,0xd(%eax)
+  (*f1)->pipe = p;
+80104fed:	8b 07                	mov    (%edi),%eax
+80104fef:	89 58 10             	mov    %ebx,0x10(%eax)
+  return 0;
+80104ff2:	83 c4 10             	add    $0x10,%esp
+80104ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+80104ffa:	eb 29                	jmp    80105025 <pipealloc+0x10b>
+  if(*f0)
+80104ffc:	8b 06                	mov    (%esi),%eax
+80104ffe:	85 c0                	test   %eax,%eax
+80105000:	74 0c                	je     8010500e <pipealloc+0xf4>
+    fileclose(*f0);
+80105002:	83 ec 0c             	sub    $0xc,%esp
+80105005:	50                   	push   %eax
+80105006:	e8 6b c7 ff ff       	call   80101776 <fileclose>
+8010500b:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+8010500e:	8b 07                	mov    (%edi),%eax
+80105010:	85 c0                	test   %eax,%eax
+80105012:	74 19                	je     8010502d <pipealloc+0x113>
+    fileclose(*f1);
+80105014:	83 ec 0c             	sub    $0xc,%esp
+80105017:	50                   	push   %eax
+80105018:	e8 59 c7 ff ff       	call   80101776 <fileclose>
+8010501d:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80105020:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105025:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105028:	5b                   	pop    %ebx
+80105029:	5e                   	pop    %esi
+8010502a:	5f                   	pop    %edi
+8010502b:	5d                   	pop    %ebp
+8010502c:	c3                   	ret
+  return -1;
+8010502d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105032:	eb f1                	jmp    80105025 <pipealloc+0x10b>
+
+80105034 <pipeclose>:
+{
+80105034:	55                   	push   %ebp
+80105035:	89 e5                	mov    %esp,%ebp
+80105037:	53                   	push   %ebx
+80105038:	83 ec 10             	sub    $0x10,%esp
+8010503b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&p->lock);
+8010503e:	53                   	push   %ebx
+8010503f:	e8 87 29 00 00       	call   801079cb <acquire>
+  if(writable){
+80105044:	83 c4 10             	add    $0x10,%esp
+80105047:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+8010504b:	74 3f                	je     8010508c <pipeclose+0x58>
+    p->writeopen = 0;
+8010504d:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+80105054:	00 00 00 
+    wakeup(&p->nread);
+80105057:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+8010505d:	83 ec 0c             	sub    $0xc,%esp
+80105060:	50                   	push   %eax
+80105061:	e8 e3 11 00 00       	call   80106249 <wakeup>
+80105066:	83 c4 10             	add    $0x10,%esp
+  if(p->readopen == 0 && p->writeopen == 0){
+80105069:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+80105070:	75 09                	jne    8010507b <pipeclose+0x47>
+80105072:	83 bb 90 00 00 00 00 	cmpl   $0x0,0x90(%ebx)
+80105079:	74 2f                	je     801050aa <pipeclose+0x76>
+    release(&p->lock);
+8010507b:	83 ec 0c             	sub    $0xc,%esp
+8010507e:	53                   	push   %ebx
+8010507f:	e8 ac 29 00 00       	call   80107a30 <release>
+80105084:	83 c4 10             	add    $0x10,%esp
+}
+80105087:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010508a:	c9                   	leave
+8010508b:	c3                   	ret
+    p->readopen = 0;
+8010508c:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+80105093:	00 00 00 
+    wakeup(&p->nwrite);
+80105096:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+8010509c:	83 ec 0c             	sub    $0xc,%esp
+8010509f:	50                   	push   %eax
+801050a0:	e8 a4 11 00 00       	call   80106249 <wakeup>
+801050a5:	83 c4 10             	add    $0x10,%esp
+801050a8:	eb bf                	jmp    80105069 <pipeclose+0x35>
+    release(&p->lock);
+801050aa:	83 ec 0c             	sub    $0xc,%esp
+801050ad:	53                   	push   %ebx
+801050ae:	e8 7d 29 00 00       	call   80107a30 <release>
+    pipefreepg(p);
+801050b3:	89 d8                	mov    %ebx,%eax
+801050b5:	e8 ed fc ff ff       	call   80104da7 <pipefreepg>
+    kfree((char*)p);
+801050ba:	89 1c 24             	mov    %ebx,(%esp)
+801050bd:	e8 af ec ff ff       	call   80103d71 <kfree>
+801050c2:	83 c4 10             	add    $0x10,%esp
+801050c5:	eb c0                	jmp    80105087 <pipeclose+0x53>
+
+801050c7 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+801050c7:	55                   	push   %ebp
+801050c8:	89 e5                	mov    %esp,%ebp
+801050ca:	57                   	push   %edi
+801050cb:	56                   	push   %esi
+801050cc:	53                   	push   %ebx
+801050cd:	83 ec 18             	sub    $0x18,%esp
+801050d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801050d3:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i, m;
+
+  acquire(&p->lock);
+801050d6:	53                   	push   %ebx
+801050d7:	e8 ef 28 00 00       	call   801079cb <acquire>
+  for(i = 0; i < n; i += m){
+801050dc:	83 c4 10             	add    $0x10,%esp
+801050df:	bf 00 00 00 00       	mov    $0x0,%edi
+801050e4:	39 f7                	cmp    %esi,%edi
+801050e6:	7c 32                	jl     8010511a <pipewrite+0x53>
+      wakeup(&p->nread);
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+    }
+    m = pipein(p, addr + i, n - i);
+  }
+  release(&p->lock);
+801050e8:	83 ec 0c             	sub    $0xc,%esp
+801050eb:	53                   	push   %ebx
+801050ec:	e8 3f 29 00 00       	call   80107a30 <release>
+  return n;
+801050f1:	83 c4 10             	add    $0x10,%esp
+801050f4:	89 f0                	mov    %esi,%eax
+801050f6:	eb 58                	jmp    80105150 <pipewrite+0x89>
+      wakeup(&p->nread);
+801050f8:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+801050fe:	83 ec 0c             	sub    $0xc,%esp
+80105101:	50                   	push   %eax
+80105102:	e8 42 11 00 00       	call   80106249 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80105107:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+8010510d:	83 c4 08             	add    $0x8,%esp
+80105110:	53                   	push   %ebx
+80105111:	50                   	push   %eax
+80105112:	e8 46 1b 00 00       	call   80106c5d <sleep>
+80105117:	83 c4 10             	add    $0x10,%esp
+    while(p->nwrite == p->nread + p->size){  //DOC: pipewrite-full
+8010511a:	8b 43 7c             	mov    0x7c(%ebx),%eax
+8010511d:	03 83 84 00 00 00    	add    0x84(%ebx),%eax
+80105123:	39 83 88 00 00 00    	cmp    %eax,0x88(%ebx)
+80105129:	75 2d                	jne    80105158 <pipewrite+0x91>
+      if(p->readopen == 0 || myproc()->killed){
+8010512b:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+80105132:	74 0b                	je     8010513f <pipewrite+0x78>
+80105134:	e8 1e 0c 00 00       	call   80105d57 <myproc>
+80105139:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+8010513d:	74 b9                	je     801050f8 <pipewrite+0x31>
+        release(&p->lock);
+8010513f:	83 ec 0c             	sub    $0xc,%esp
+80105142:	53                   	push   %ebx
+80105143:	e8 e8 28 00 00       	call   80107a30 <release>
+        return -1;
+80105148:	83 c4 10             	add    $0x10,%esp
+8010514b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105153:	5b                   	pop    %ebx
+80105154:	5e                   	pop    %esi
+80105155:	5f                   	pop    %edi
+80105156:	5d                   	pop    %ebp
+80105157:	c3                   	ret
+    m = pipein(p, addr + i, n - i);
+80105158:	89 f1                	mov    %esi,%ecx
+8010515a:	29 f9                	sub    %edi,%ecx
+8010515c:	89 fa                	mov    %edi,%edx
+8010515e:	03 55 0c             	add    0xc(%ebp),%edx
+80105161:	89 d8                	mov    %ebx,%eax
+80105163:	e8 ef fc ff ff       	call   80104e57 <pipein>
+  for(i = 0; i < n; i += m){
+80105168:	01 c7                	add    %eax,%edi
+8010516a:	e9 75 ff ff ff       	jmp    801050e4 <pipewrite+0x1d>
+
+8010516f <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+8010516f:	55                   	push   %ebp
+80105170:	89 e5                	mov    %esp,%ebp
+80105172:	56                   	push   %esi
+80105173:	53                   	push   %ebx
+80105174:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int m;
+
+  acquire(&p->lock);
+80105177:	83 ec 0c             	sub    $0xc,%esp
+8010517a:	53                   	push   %ebx
+8010517b:	e8 4b 28 00 00       	call   801079cb <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80105180:	83 c4 10             	add    $0x10,%esp
+80105183:	eb 13                	jmp    80105198 <piperead+0x29>
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80105185:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+8010518b:	83 ec 08             	sub    $0x8,%esp
+8010518e:	53                   	push   %ebx
+8010518f:	50                   	push   %eax
+80105190:	e8 c8 1a 00 00       	call   80106c5d <sleep>
+80105195:	83 c4 10             	add    $0x10,%esp
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80105198:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+8010519e:	39 83 84 00 00 00    	cmp    %eax,0x84(%ebx)
+801051a4:	75 27                	jne    801051cd <piperead+0x5e>
+801051a6:	83 bb 90 00 00 00 00 	cmpl   $0x0,0x90(%ebx)
+801051ad:	74 1e                	je     801051cd <piperead+0x5e>
+    if(myproc()->killed){
+801051af:	e8 a3 0b 00 00       	call   80105d57 <myproc>
+801051b4:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+801051b8:	74 cb                	je     80105185 <piperead+0x16>
+      release(&p->lock);
+801051ba:	83 ec 0c             	sub    $0xc,%esp
+801051bd:	53                   	push   %ebx
+801051be:	e8 6d 28 00 00       	call   80107a30 <release>
+      return -1;
+801051c3:	83 c4 10             	add    $0x10,%esp
+801051c6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801051cb:	eb 1b                	jmp    801051e8 <piperead+0x79>
+  }
+  m = pipeout(p, addr, n);
+801051cd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801051d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+801051d3:	89 d8                	mov    %ebx,%eax
+801051d5:	e8 de fc ff ff       	call   80104eb8 <pipeout>
+801051da:	89 c6                	mov    %eax,%esi
+  release(&p->lock);
+801051dc:	83 ec 0c             	sub    $0xc,%esp
+801051df:	53                   	push   %ebx
+801051e0:	e8 4b 28 00 00       	call   80107a30 <release>
+  return m;
+801051e5:	83 c4 10             	add    $0x10,%esp
+}
+801051e8:	89 f0                	mov    %esi,%eax
+801051ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801051ed:	5b                   	pop    %ebx
+801051ee:	5e                   	pop    %esi
+801051ef:	5d                   	pop    %ebp
+801051f0:	c3                   	ret
+
+801051f1 <pipewait>:
+// pipeget and pipemove then move what they can without sleeping,
+// so callers can hold other locks.
+
+int
+pipewait(struct pipe *p, int wr)
+{
+801051f1:	55                   	push   %ebp
+801051f2:	89 e5                	mov    %esp,%ebp
+801051f4:	57                   	push   %edi
+801051f5:	56                   	push   %esi
+801051f6:	53                   	push   %ebx
+801051f7:	83 ec 18             	sub    $0x18,%esp
+801051fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801051fd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int n;
+
+  acquire(&p->lock);
+80105200:	53                   	push   %ebx
+80105201:	e8 c5 27 00 00       	call   801079cb <acquire>
+80105206:	83 c4 10             	add    $0x10,%esp
+80105209:	eb 38                	jmp    80105243 <pipewait+0x52>
+  for(;;){
+    if(myproc()->killed || (wr && p->readopen == 0)){
+      n = -1;
+      break;
+    }
+    n = wr ? p->size - (p->nwrite - p->nread) : p->nwrite - p->nread;
+8010520b:	8b b3 88 00 00 00    	mov    0x88(%ebx),%esi
+80105211:	2b b3 84 00 00 00    	sub    0x84(%ebx),%esi
+    if(n > 0 || (!wr && p->writeopen == 0))
+80105217:	85 f6                	test   %esi,%esi
+80105219:	7f 56                	jg     80105271 <pipewait+0x80>
+8010521b:	85 ff                	test   %edi,%edi
+8010521d:	75 11                	jne    80105230 <pipewait+0x3f>
+8010521f:	83 bb 90 00 00 00 00 	cmpl   $0x0,0x90(%ebx)
+80105226:	74 49                	je     80105271 <pipewait+0x80>
+      break;
+    sleep(wr ? &p->nwrite : &p->nread, &p->lock);
+80105228:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+8010522e:	eb 06                	jmp    80105236 <pipewait+0x45>
+80105230:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+80105236:	83 ec 08             	sub    $0x8,%esp
+80105239:	53                   	push   %ebx
+8010523a:	50                   	push   %eax
+8010523b:	e8 1d 1a 00 00       	call   80106c5d <sleep>
+    if(myproc()->killed || (wr && p->readopen == 0)){
+80105240:	83 c4 10             	add    $0x10,%esp
+80105243:	e8 0f 0b 00 00       	call   80105d57 <myproc>
+80105248:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+8010524c:	75 1e                	jne    8010526c <pipewait+0x7b>
+8010524e:	85 ff                	test   %edi,%edi
+80105250:	74 b9                	je     8010520b <pipewait+0x1a>
+80105252:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+80105259:	74 29                	je     80105284 <pipewait+0x93>
+    n = wr ? p->size - (p->nwrite - p->nread) : p->nwrite - p->nread;
+8010525b:	8b b3 84 00 00 00    	mov    0x84(%ebx),%esi
+80105261:	2b b3 88 00 00 00    	sub    0x88(%ebx),%esi
+80105267:	03 73 7c             	add    0x7c(%ebx),%esi
+8010526a:	eb ab                	jmp    80105217 <pipewait+0x26>
+      n = -1;
+8010526c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  }
+  release(&p->lock);
+80105271:	83 ec 0c             	sub    $0xc,%esp
+80105274:	53                   	push   %ebx
+80105275:	e8 b6 27 00 00       	call   80107a30 <release>
+  return n;
+}
+8010527a:	89 f0                	mov    %esi,%eax
+8010527c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010527f:	5b                   	pop    %ebx
+80105280:	5e                   	pop    %esi
+80105281:	5f                   	pop    %edi
+80105282:	5d                   	pop    %ebp
+80105283:	c3                   	ret
+      n = -1;
+80105284:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105289:	eb e6                	jmp    80105271 <pipewait+0x80>
+
+8010528b <pipeput>:
+
+// Write up to n bytes from addr to p. Returns the number
+// written, or -1 if the read end is closed.
+int
+pipeput(struct pipe *p, char *addr, int n)
+{
+8010528b:	55                   	push   %ebp
+8010528c:	89 e5                	mov    %esp,%ebp
+8010528e:	56                   	push   %esi
+8010528f:	53                   	push   %ebx
+80105290:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int m;
+
+  acquire(&p->lock);
+80105293:	83 ec 0c             	sub    $0xc,%esp
+80105296:	53                   	push   %ebx
+80105297:	e8 2f 27 00 00       	call   801079cb <acquire>
+  m = p->readopen ? pipein(p, addr, n) : -1;
+8010529c:	83 c4 10             	add    $0x10,%esp
+8010529f:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+801052a6:	74 21                	je     801052c9 <pipeput+0x3e>
+801052a8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801052ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+801052ae:	89 d8                	mov    %ebx,%eax
+801052b0:	e8 a2 fb ff ff       	call   80104e57 <pipein>
+801052b5:	89 c6                	mov    %eax,%esi
+  release(&p->lock);
+801052b7:	83 ec 0c             	sub    $0xc,%esp
+801052ba:	53                   	push   %ebx
+801052bb:	e8 70 27 00 00       	call   80107a30 <release>
+  return m;
+}
+801052c0:	89 f0                	mov    %esi,%eax
+801052c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801052c5:	5b                   	pop    %ebx
+801052c6:	5e                   	pop    %esi
+801052c7:	5d                   	pop    %ebp
+801052c8:	c3                   	ret
+  m = p->readopen ? pipein(p, addr, n) : -1;
+801052c9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801052ce:	eb e7                	jmp    801052b7 <pipeput+0x2c>
+
+801052d0 <pipeget>:
+
+// Read up to n bytes from p to addr. Returns the number read.
+int
+pipeget(struct pipe *p, char *addr, int n)
+{
+801052d0:	55                   	push   %ebp
+801052d1:	89 e5                	mov    %esp,%ebp
+801052d3:	56                   	push   %esi
+801052d4:	53                   	push   %ebx
+801052d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int m;
+
+  acquire(&p->lock);
+801052d8:	83 ec 0c             	sub    $0xc,%esp
+801052db:	56                   	push   %esi
+801052dc:	e8 ea 26 00 00       	call   801079cb <acquire>
+  m = pipeout(p, addr, n);
+801052e1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801052e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+801052e7:	89 f0                	mov    %esi,%eax
+801052e9:	e8 ca fb ff ff       	call   80104eb8 <pipeout>
+801052ee:	89 c3                	mov    %eax,%ebx
+  release(&p->lock);
+801052f0:	89 34 24             	mov    %esi,(%esp)
+801052f3:	e8 38 27 00 00       	call   80107a30 <release>
+  return m;
+}
+801052f8:	89 d8                	mov    %ebx,%eax
+801052fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801052fd:	5b                   	pop    %ebx
+801052fe:	5e                   	pop    %esi
+801052ff:	5d                   	pop    %ebp
+80105300:	c3                   	ret
+
+80105301 <pipeavail>:
+
+// Number of bytes waiting to be read from p.
+int
+pipeavail(struct pipe *p)
+{
+80105301:	55                   	push   %ebp
+80105302:	89 e5                	mov    %esp,%ebp
+80105304:	56                   	push   %esi
+80105305:	53                   	push   %ebx
+80105306:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  acquire(&p->lock);
+80105309:	83 ec 0c             	sub    $0xc,%esp
+8010530c:	53                   	push   %ebx
+8010530d:	e8 b9 26 00 00       	call   801079cb <acquire>
+  n = p->nwrite - p->nread;
+80105312:	8b b3 88 00 00 00    	mov    0x88(%ebx),%esi
+80105318:	2b b3 84 00 00 00    	sub    0x84(%ebx),%esi
+  release(&p->lock);
+8010531e:	89 1c 24             	mov    %ebx,(%esp)
+80105321:	e8 0a 27 00 00       	call   80107a30 <release>
+  return n;
+}
+80105326:	89 f0                	mov    %esi,%eax
+80105328:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010532b:	5b                   	pop    %ebx
+8010532c:	5e                   	pop    %esi
+8010532d:	5d                   	pop    %ebp
+8010532e:	c3                   	ret
+
+8010532f <pipemove>:
+
+// Move up to n bytes from pipe in to pipe out, ring to ring.
+// Returns the number moved, or -1 if out's read end is closed.
+int
+pipemove(struct pipe *in, struct pipe *out, int n)
+{
+8010532f:	55                   	push   %ebp
+80105330:	89 e5                	mov    %esp,%ebp
+80105332:	57                   	push   %edi
+80105333:	56                   	push   %esi
+80105334:	53                   	push   %ebx
+80105335:	83 ec 1c             	sub    $0x1c,%esp
+80105338:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int m, tot;
+  uint k;
+
+  if(in == out)
+8010533b:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+8010533e:	0f 84 fa 00 00 00    	je     8010543e <pipemove+0x10f>
+    return -1;
+  // Lock in address order.
+  acquire(in < out ? &in->lock : &out->lock);
+80105344:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+80105347:	0f 83 a4 00 00 00    	jae    801053f1 <pipemove+0xc2>
+8010534d:	89 d8                	mov    %ebx,%eax
+8010534f:	83 ec 0c             	sub    $0xc,%esp
+80105352:	50                   	push   %eax
+80105353:	e8 73 26 00 00       	call   801079cb <acquire>
+  acquire(in < out ? &out->lock : &in->lock);
+80105358:	83 c4 10             	add    $0x10,%esp
+8010535b:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+8010535e:	0f 83 95 00 00 00    	jae    801053f9 <pipemove+0xca>
+80105364:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105367:	83 ec 0c             	sub    $0xc,%esp
+8010536a:	50                   	push   %eax
+8010536b:	e8 5b 26 00 00       	call   801079cb <acquire>
+  if(out->readopen == 0){
+80105370:	83 c4 10             	add    $0x10,%esp
+80105373:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105376:	83 b8 8c 00 00 00 00 	cmpl   $0x0,0x8c(%eax)
+8010537d:	0f 84 95 00 00 00    	je     80105418 <pipemove+0xe9>
+    tot = -1;
+  } else {
+    n = min(n, in->nwrite - in->nread);
+80105383:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+80105389:	2b 83 84 00 00 00    	sub    0x84(%ebx),%eax
+8010538f:	39 45 10             	cmp    %eax,0x10(%ebp)
+80105392:	0f 46 45 10          	cmovbe 0x10(%ebp),%eax
+80105396:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(tot = 0; tot < n; tot += m){
+80105399:	be 00 00 00 00       	mov    $0x0,%esi
+8010539e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801053a1:	39 c6                	cmp    %eax,%esi
+801053a3:	7d 5b                	jge    80105400 <pipemove+0xd1>
+      k = in->rpos;
+801053a5:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+      m = min(n - tot, in->pgsize - k % in->pgsize);
+801053ab:	8b 4b 78             	mov    0x78(%ebx),%ecx
+801053ae:	ba 00 00 00 00       	mov    $0x0,%edx
+801053b3:	f7 f1                	div    %ecx
+801053b5:	29 d1                	sub    %edx,%ecx
+801053b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801053ba:	29 f7                	sub    %esi,%edi
+801053bc:	39 f9                	cmp    %edi,%ecx
+801053be:	0f 47 cf             	cmova  %edi,%ecx
+      if((m = pipein(out, in->pg[k / in->pgsize] + k % in->pgsize, m)) == 0)
+801053c1:	03 54 83 34          	add    0x34(%ebx,%eax,4),%edx
+801053c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+801053c8:	e8 8a fa ff ff       	call   80104e57 <pipein>
+801053cd:	89 c1                	mov    %eax,%ecx
+801053cf:	85 c0                	test   %eax,%eax
+801053d1:	74 2d                	je     80105400 <pipemove+0xd1>
+        break;
+      in->rpos = (in->rpos + m) % in->size;
+801053d3:	03 83 80 00 00 00    	add    0x80(%ebx),%eax
+801053d9:	ba 00 00 00 00       	mov    $0x0,%edx
+801053de:	f7 73 7c             	divl   0x7c(%ebx)
+801053e1:	89 93 80 00 00 00    	mov    %edx,0x80(%ebx)
+      in->nread += m;
+801053e7:	01 8b 84 00 00 00    	add    %ecx,0x84(%ebx)
+    for(tot = 0; tot < n; tot += m){
+801053ed:	01 ce                	add    %ecx,%esi
+801053ef:	eb ad                	jmp    8010539e <pipemove+0x6f>
+  acquire(in < out ? &in->lock : &out->lock);
+801053f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+801053f4:	e9 56 ff ff ff       	jmp    8010534f <pipemove+0x20>
+  acquire(in < out ? &out->lock : &in->lock);
+801053f9:	89 d8                	mov    %ebx,%eax
+801053fb:	e9 67 ff ff ff       	jmp    80105367 <pipemove+0x38>
+    }
+    if(tot > 0)
+80105400:	85 f6                	test   %esi,%esi
+80105402:	7e 19                	jle    8010541d <pipemove+0xee>
+      wakeup(&in->nwrite);
+80105404:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+8010540a:	83 ec 0c             	sub    $0xc,%esp
+8010540d:	50                   	push   %eax
+8010540e:	e8 36 0e 00 00       	call   80106249 <wakeup>
+80105413:	83 c4 10             	add    $0x10,%esp
+80105416:	eb 05                	jmp    8010541d <pipemove+0xee>
+    tot = -1;
+80105418:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  }
+  release(&in->lock);
+8010541d:	83 ec 0c             	sub    $0xc,%esp
+80105420:	53                   	push   %ebx
+80105421:	e8 0a 26 00 00       	call   80107a30 <release>
+  release(&out->lock);
+80105426:	83 c4 04             	add    $0x4,%esp
+80105429:	ff 75 0c             	push   0xc(%ebp)
+8010542c:	e8 ff 25 00 00       	call   80107a30 <release>
+  return tot;
+80105431:	83 c4 10             	add    $0x10,%esp
+}
+80105434:	89 f0                	mov    %esi,%eax
+80105436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105439:	5b                   	pop    %ebx
+8010543a:	5e                   	pop    %esi
+8010543b:	5f                   	pop    %edi
+8010543c:	5d                   	pop    %ebp
+8010543d:	c3                   	ret
+    return -1;
+8010543e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105443:	eb ef                	jmp    80105434 <pipemove+0x105>
+
+80105445 <piperesize>:
+// Grow p's ring buffer to hold at least n bytes, in pages.
+// Returns the new size, or -1 if n is over PIPEMAX or memory
+// is short. The buffer never shrinks.
+int
+piperesize(struct pipe *p, int n)
+{
+80105445:	55                   	push   %ebp
+80105446:	89 e5                	mov    %esp,%ebp
+80105448:	57                   	push   %edi
+80105449:	56                   	push   %esi
+8010544a:	53                   	push   %ebx
+8010544b:	83 ec 5c             	sub    $0x5c,%esp
+8010544e:	8b 75 08             	mov    0x8(%ebp),%esi
+80105451:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *pg[PIPEMAXPG];
+  int npg, i;
+  uint j, k, m, cnt;
+
+  if(n < 0 || n > PIPEMAX)
+80105454:	3d 00 00 01 00       	cmp    $0x10000,%eax
+80105459:	0f 87 7a 01 00 00    	ja     801055d9 <piperesize+0x194>
+    return -1;
+  npg = (n + PGSIZE - 1) / PGSIZE;
+8010545f:	8d 90 fe 1f 00 00    	lea    0x1ffe(%eax),%edx
+80105465:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010546a:	0f 48 c2             	cmovs  %edx,%eax
+8010546d:	89 c3                	mov    %eax,%ebx
+8010546f:	c1 fb 0c             	sar    $0xc,%ebx
+  if(npg * PGSIZE <= p->size)
+80105472:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80105477:	89 c2                	mov    %eax,%edx
+80105479:	89 45 9c             	mov    %eax,-0x64(%ebp)
+8010547c:	8b 46 7c             	mov    0x7c(%esi),%eax
+8010547f:	39 d0                	cmp    %edx,%eax
+80105481:	73 34                	jae    801054b7 <piperesize+0x72>
+    return p->size;
+  for(i = 0; i < npg; i++){
+80105483:	bf 00 00 00 00       	mov    $0x0,%edi
+80105488:	39 df                	cmp    %ebx,%edi
+8010548a:	7d 33                	jge    801054bf <piperesize+0x7a>
+    if((pg[i] = kalloc()) == 0){
+8010548c:	e8 ff ea ff ff       	call   80103f90 <kalloc>
+80105491:	89 44 bd a8          	mov    %eax,-0x58(%ebp,%edi,4)
+80105495:	85 c0                	test   %eax,%eax
+80105497:	74 14                	je     801054ad <piperesize+0x68>
+  for(i = 0; i < npg; i++){
+80105499:	83 c7 01             	add    $0x1,%edi
+8010549c:	eb ea                	jmp    80105488 <piperesize+0x43>
+      while(--i >= 0)
+        kfree(pg[i]);
+8010549e:	83 ec 0c             	sub    $0xc,%esp
+801054a1:	ff 74 bd a8          	push   -0x58(%ebp,%edi,4)
+801054a5:	e8 c7 e8 ff ff       	call   80103d71 <kfree>
+801054aa:	83 c4 10             	add    $0x10,%esp
+      while(--i >= 0)
+801054ad:	83 ef 01             	sub    $0x1,%edi
+801054b0:	79 ec                	jns    8010549e <piperesize+0x59>
+      return -1;
+801054b2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  p->size = npg * PGSIZE;
+  p->rpos = 0;
+  wakeup(&p->nwrite);
+  release(&p->lock);
+  return p->size;
+}
+801054b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801054ba:	5b                   	pop    %ebx
+801054bb:	5e                   	pop    %esi
+801054bc:	5f                   	pop    %edi
+801054bd:	5d                   	pop    %ebp
+801054be:	c3                   	ret
+  acquire(&p->lock);
+801054bf:	83 ec 0c             	sub    $0xc,%esp
+801054c2:	56                   	push   %esi
+801054c3:	e8 03 25 00 00       	call   801079cb <acquire>
+  if(npg * PGSIZE <= p->size){  // someone else grew it
+801054c8:	83 c4 10             	add    $0x10,%esp
+801054cb:	8b 45 9c             	mov    -0x64(%ebp),%eax
+801054ce:	39 46 7c             	cmp    %eax,0x7c(%esi)
+801054d1:	73 1c                	jae    801054ef <piperesize+0xaa>
+  cnt = p->nwrite - p->nread;
+801054d3:	8b 86 88 00 00 00    	mov    0x88(%esi),%eax
+801054d9:	2b 86 84 00 00 00    	sub    0x84(%esi),%eax
+801054df:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  for(j = 0; j < cnt; j += m){
+801054e2:	bf 00 00 00 00       	mov    $0x0,%edi
+801054e7:	89 5d 98             	mov    %ebx,-0x68(%ebp)
+801054ea:	e9 8c 00 00 00       	jmp    8010557b <piperesize+0x136>
+    release(&p->lock);
+801054ef:	83 ec 0c             	sub    $0xc,%esp
+801054f2:	56                   	push   %esi
+801054f3:	e8 38 25 00 00       	call   80107a30 <release>
+    for(i = 0; i < npg; i++)
+801054f8:	83 c4 10             	add    $0x10,%esp
+801054fb:	bf 00 00 00 00       	mov    $0x0,%edi
+80105500:	eb 12                	jmp    80105514 <piperesize+0xcf>
+      kfree(pg[i]);
+80105502:	83 ec 0c             	sub    $0xc,%esp
+80105505:	ff 74 bd a8          	push   -0x58(%ebp,%edi,4)
+80105509:	e8 63 e8 ff ff       	call   80103d71 <kfree>
+    for(i = 0; i < npg; i++)
+8010550e:	83 c7 01             	add    $0x1,%edi
+80105511:	83 c4 10             	add    $0x10,%esp
+80105514:	39 df                	cmp    %ebx,%edi
+80105516:	7c ea                	jl     80105502 <piperesize+0xbd>
+    return p->size;
+80105518:	8b 46 7c             	mov    0x7c(%esi),%eax
+8010551b:	eb 9a                	jmp    801054b7 <piperesize+0x72>
+    k = (p->rpos + j) % p->size;
+8010551d:	89 f8                	mov    %edi,%eax
+8010551f:	03 86 80 00 00 00    	add    0x80(%esi),%eax
+80105525:	ba 00 00 00 00       	mov    $0x0,%edx
+8010552a:	f7 76 7c             	divl   0x7c(%esi)
+    m = min(cnt - j, p->pgsize - k % p->pgsize);
+8010552d:	8b 4e 78             	mov    0x78(%esi),%ecx
+80105530:	89 d0                	mov    %edx,%eax
+80105532:	ba 00 00 00 00       	mov    $0x0,%edx
+80105537:	f7 f1                	div    %ecx
+80105539:	89 45 a0             	mov    %eax,-0x60(%ebp)
+8010553c:	29 d1                	sub    %edx,%ecx
+8010553e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+80105541:	29 f8                	sub    %edi,%eax
+80105543:	39 c1                	cmp    %eax,%ecx
+80105545:	0f 47 c8             	cmova  %eax,%ecx
+    m = min(m, PGSIZE - j % PGSIZE);
+80105548:	89 f8                	mov    %edi,%eax
+8010554a:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010554f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+80105554:	29 c3                	sub    %eax,%ebx
+80105556:	39 cb                	cmp    %ecx,%ebx
+80105558:	0f 47 d9             	cmova  %ecx,%ebx
+    memmove(pg[j / PGSIZE] + j % PGSIZE, p->pg[k / p->pgsize] + k % p->pgsize, m);
+8010555b:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+8010555e:	03 54 8e 34          	add    0x34(%esi,%ecx,4),%edx
+80105562:	89 f9                	mov    %edi,%ecx
+80105564:	c1 e9 0c             	shr    $0xc,%ecx
+80105567:	03 44 8d a8          	add    -0x58(%ebp,%ecx,4),%eax
+8010556b:	83 ec 04             	sub    $0x4,%esp
+8010556e:	53                   	push   %ebx
+8010556f:	52                   	push   %edx
+80105570:	50                   	push   %eax
+80105571:	e8 79 25 00 00       	call   80107aef <memmove>
+  for(j = 0; j < cnt; j += m){
+80105576:	01 df                	add    %ebx,%edi
+80105578:	83 c4 10             	add    $0x10,%esp
+8010557b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+8010557e:	39 c7                	cmp    %eax,%edi
+80105580:	72 9b                	jb     8010551d <piperesize+0xd8>
+  pipefreepg(p);
+80105582:	8b 5d 98             	mov    -0x68(%ebp),%ebx
+80105585:	89 f0                	mov    %esi,%eax
+80105587:	e8 1b f8 ff ff       	call   80104da7 <pipefreepg>
+  memmove(p->pg, pg, sizeof(pg));
+8010558c:	8d 46 34             	lea    0x34(%esi),%eax
+8010558f:	83 ec 04             	sub    $0x4,%esp
+80105592:	6a 40                	push   $0x40
+80105594:	8d 55 a8             	lea    -0x58(%ebp),%edx
+80105597:	52                   	push   %edx
+80105598:	50                   	push   %eax
+80105599:	e8 51 25 00 00       	call   80107aef <memmove>
+  p->npg = npg;
+8010559e:	89 5e 74             	mov    %ebx,0x74(%esi)
+  p->pgsize = PGSIZE;
+801055a1:	c7 46 78 00 10 00 00 	movl   $0x1000,0x78(%esi)
+  p->size = npg * PGSIZE;
+801055a8:	8b 45 9c             	mov    -0x64(%ebp),%eax
+801055ab:	89 46 7c             	mov    %eax,0x7c(%esi)
+  p->rpos = 0;
+801055ae:	c7 86 80 00 00 00 00 	movl   $0x0,0x80(%esi)
+801055b5:	00 00 00 
+  wakeup(&p->nwrite);
+801055b8:	8d 86 88 00 00 00    	lea    0x88(%esi),%eax
+801055be:	89 04 24             	mov    %eax,(%esp)
+801055c1:	e8 83 0c 00 00       	call   80106249 <wakeup>
+  release(&p->lock);
+801055c6:	89 34 24             	mov    %esi,(%esp)
+801055c9:	e8 62 24 00 00       	call   80107a30 <release>
+  return p->size;
+801055ce:	8b 46 7c             	mov    0x7c(%esi),%eax
+801055d1:	83 c4 10             	add    $0x10,%esp
+801055d4:	e9 de fe ff ff       	jmp    801054b7 <piperesize+0x72>
+    return -1;
+801055d9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801055de:	e9 d4 fe ff ff       	jmp    801054b7 <piperesize+0x72>
+
+801055e3 <stateListRemove>:
+}
+
+static int
+stateListRemove(struct ptrs* list, struct proc* p)
+{
+  if(p == NULL || p->list != list){
+801055e3:	85 d2                	test   %edx,%edx
+801055e5:	74 79                	je     80105660 <stateListRemove+0x7d>
+801055e7:	89 c1                	mov    %eax,%ecx
+801055e9:	89 d0                	mov    %edx,%eax
+801055eb:	39 8a ec 00 00 00    	cmp    %ecx,0xec(%edx)
+801055f1:	75 73                	jne    80105666 <stateListRemove+0x83>
+{
+801055f3:	55                   	push   %ebp
+801055f4:	89 e5                	mov    %esp,%ebp
+801055f6:	53                   	push   %ebx
+    return -1;
+  }
+
+  if(p->prev)
+801055f7:	8b 92 e8 00 00 00    	mov    0xe8(%edx),%edx
+801055fd:	85 d2                	test   %edx,%edx
+801055ff:	74 4a                	je     8010564b <stateListRemove+0x68>
+    p->prev->next = p->next;
+80105601:	8b 98 e4 00 00 00    	mov    0xe4(%eax),%ebx
+80105607:	89 9a e4 00 00 00    	mov    %ebx,0xe4(%edx)
+  else
+    (*list).head = p->next;
+
+  if(p->next)
+8010560d:	8b 90 e4 00 00 00    	mov    0xe4(%eax),%edx
+80105613:	85 d2                	test   %edx,%edx
+80105615:	74 3e                	je     80105655 <stateListRemove+0x72>
+    p->next->prev = p->prev;
+80105617:	8b 88 e8 00 00 00    	mov    0xe8(%eax),%ecx
+8010561d:	89 8a e8 00 00 00    	mov    %ecx,0xe8(%edx)
+  else
+    (*list).tail = p->prev;
+
+  // Make sure p doesn't point into the list.
+  p->next = NULL;
+80105623:	c7 80 e4 00 00 00 00 	movl   $0x0,0xe4(%eax)
+8010562a:	00 00 00 
+  p->prev = NULL;
+8010562d:	c7 80 e8 00 00 00 00 	movl   $0x0,0xe8(%eax)
+80105634:	00 00 00 
+  p->list = NULL;
+80105637:	c7 80 ec 00 00 00 00 	movl   $0x0,0xec(%eax)
+8010563e:	00 00 00 
+
+  return 0;
+80105641:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105646:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105649:	c9                   	leave
+8010564a:	c3                   	ret
+    (*list).head = p->next;
+8010564b:	8b 90 e4 00 00 00    	mov    0xe4(%eax),%edx
+80105651:	89 11                	mov    %edx,(%ecx)
+80105653:	eb b8                	jmp    8010560d <stateListRemove+0x2a>
+    (*list).tail = p->prev;
+80105655:	8b 90 e8 00 00 00    	mov    0xe8(%eax),%edx
+8010565b:	89 51 04             	mov    %edx,0x4(%ecx)
+8010565e:	eb c3                	jmp    80105623 <stateListRemove+0x40>
+    return -1;
+80105660:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105665:	c3                   	ret
+80105666:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010566b:	c3                   	ret
+
+8010566c <sleepList>:
+
+// The hash chain holding processes asleep on chan.
+static struct ptrs*
+sleepList(void *chan)
+{
+  return &ptable.sleepq[((uint)chan >> 2) % NSLEEPQ];
+8010566c:	c1 e8 02             	shr    $0x2,%eax
+8010566f:	89 c1                	mov    %eax,%ecx
+80105671:	ba 3f c5 25 43       	mov    $0x4325c53f,%edx
+80105676:	f7 e2                	mul    %edx
+80105678:	c1 ea 04             	shr    $0x4,%edx
+8010567b:	6b c2 3d             	imul   $0x3d,%edx,%eax
+8010567e:	29 c1                	sub    %eax,%ecx
+80105680:	8d 04 cd e8 f9 33 80 	lea    -0x7fcc0618(,%ecx,8),%eax
+}
+80105687:	c3                   	ret
+
+80105688 <initProcessLists>:
+static void
+initProcessLists()
+{
+  int i;
+
+  for (i = UNUSED; i <= ZOMBIE; i++) {
+80105688:	b8 00 00 00 00       	mov    $0x0,%eax
+8010568d:	eb 1f                	jmp    801056ae <initProcessLists+0x26>
+    ptable.list[i].head = NULL;
+8010568f:	8d 90 86 08 00 00    	lea    0x886(%eax),%edx
+80105695:	c7 04 d5 88 b5 33 80 	movl   $0x0,-0x7fcc4a78(,%edx,8)
+8010569c:	00 00 00 00 
+    ptable.list[i].tail = NULL;
+801056a0:	c7 04 d5 8c b5 33 80 	movl   $0x0,-0x7fcc4a74(,%edx,8)
+801056a7:	00 00 00 00 
+  for (i = UNUSED; i <= ZOMBIE; i++) {
+801056ab:	83 c0 01             	add    $0x1,%eax
+801056ae:	83 f8 05             	cmp    $0x5,%eax
+801056b1:	7e dc                	jle    8010568f <initProcessLists+0x7>
+  }
+  for (i = 0; i < NSLEEPQ; i++) {
+801056b3:	b8 00 00 00 00       	mov    $0x0,%eax
+801056b8:	eb 1f                	jmp    801056d9 <initProcessLists+0x51>
+    ptable.sleepq[i].head = NULL;
+801056ba:	8d 90 8c 08 00 00    	lea    0x88c(%eax),%edx
+801056c0:	c7 04 d5 88 b5 33 80 	movl   $0x0,-0x7fcc4a78(,%edx,8)
+801056c7:	00 00 00 00 
+    ptable.sleepq[i].tail = NULL;
+801056cb:	c7 04 d5 8c b5 33 80 	movl   $0x0,-0x7fcc4a74(,%edx,8)
+801056d2:	00 00 00 00 
+  for (i = 0; i < NSLEEPQ; i++) {
+801056d6:	83 c0 01             	add    $0x1,%eax
+801056d9:	83 f8 3c             	cmp    $0x3c,%eax
+801056dc:	7e dc                	jle    801056ba <initProcessLists+0x32>
+  }
+#ifdef CS333_P4
+  struct runq *q;
+
+  for (q = runq; q < &runq[NCPU]; q++) {
+801056de:	ba 80 b3 33 80       	mov    $0x8033b380,%edx
+801056e3:	eb 21                	jmp    80105706 <initProcessLists+0x7e>
+    for (i = 0; i <= MAXPRIO; i++) {
+      q->ready[i].head = NULL;
+801056e5:	c7 04 c2 00 00 00 00 	movl   $0x0,(%edx,%eax,8)
+      q->ready[i].tail = NULL;
+801056ec:	c7 44 c2 04 00 00 00 	movl   $0x0,0x4(%edx,%eax,8)
+801056f3:	00 
+    for (i = 0; i <= MAXPRIO; i++) {
+801056f4:	83 c0 01             	add    $0x1,%eax
+801056f7:	83 f8 06             	cmp    $0x6,%eax
+801056fa:	7e e9                	jle    801056e5 <initProcessLists+0x5d>
+    }
+    q->count = 0;
+801056fc:	c7 42 38 00 00 00 00 	movl   $0x0,0x38(%edx)
+  for (q = runq; q < &runq[NCPU]; q++) {
+80105703:	83 c2 40             	add    $0x40,%edx
+80105706:	81 fa 80 b5 33 80    	cmp    $0x8033b580,%edx
+8010570c:	73 07                	jae    80105715 <initProcessLists+0x8d>
+    for (i = 0; i <= MAXPRIO; i++) {
+8010570e:	b8 00 00 00 00       	mov    $0x0,%eax
+80105713:	eb e2                	jmp    801056f7 <initProcessLists+0x6f>
+  }
+#endif
+}
+80105715:	c3                   	ret
+
+80105716 <runqHead>:
+
+// Highest priority process waiting on q, or NULL.
+// Caller must hold ptable.lock.
+static struct proc*
+runqHead(struct runq* q)
+{
+80105716:	89 c1                	mov    %eax,%ecx
+  int i;
+
+  for(i = MAXPRIO; i >= 0; --i)
+80105718:	ba 06 00 00 00       	mov    $0x6,%edx
+8010571d:	eb 03                	jmp    80105722 <runqHead+0xc>
+8010571f:	83 ea 01             	sub    $0x1,%edx
+80105722:	85 d2                	test   %edx,%edx
+80105724:	78 09                	js     8010572f <runqHead+0x19>
+    if(q->ready[i].head != NULL)
+80105726:	8b 04 d1             	mov    (%ecx,%edx,8),%eax
+80105729:	85 c0                	test   %eax,%eax
+8010572b:	74 f2                	je     8010571f <runqHead+0x9>
+8010572d:	eb 05                	jmp    80105734 <runqHead+0x1e>
+      return q->ready[i].head;
+  return NULL;
+8010572f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105734:	c3                   	ret
+
+80105735 <runqPick>:
+// if anything is queued there, otherwise the busiest peer.
+// Returns -1 if every queue is empty. No lock is taken, so the
+// answer is a hint; the caller looks again under ptable.lock.
+static int
+runqPick(int self)
+{
+80105735:	55                   	push   %ebp
+80105736:	89 e5                	mov    %esp,%ebp
+80105738:	56                   	push   %esi
+80105739:	53                   	push   %ebx
+8010573a:	89 c1                	mov    %eax,%ecx
+  int i, n, best, most;
+
+  if(*(volatile int*)&runq[self].count > 0)
+8010573c:	c1 e0 06             	shl    $0x6,%eax
+8010573f:	05 80 b3 33 80       	add    $0x8033b380,%eax
+80105744:	8b 40 38             	mov    0x38(%eax),%eax
+80105747:	85 c0                	test   %eax,%eax
+80105749:	7f 38                	jg     80105783 <runqPick+0x4e>
+    return self;
+
+  best = -1;
+  most = 0;
+8010574b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  best = -1;
+80105750:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  for(i = 0; i < ncpu; i++){
+80105755:	b8 00 00 00 00       	mov    $0x0,%eax
+8010575a:	eb 03                	jmp    8010575f <runqPick+0x2a>
+8010575c:	83 c0 01             	add    $0x1,%eax
+8010575f:	39 05 84 ad 33 80    	cmp    %eax,0x8033ad84
+80105765:	7e 1e                	jle    80105785 <runqPick+0x50>
+    if(i == self)
+80105767:	39 c8                	cmp    %ecx,%eax
+80105769:	74 f1                	je     8010575c <runqPick+0x27>
+      continue;
+    n = *(volatile int*)&runq[i].count;
+8010576b:	89 c2                	mov    %eax,%edx
+8010576d:	c1 e2 06             	shl    $0x6,%edx
+80105770:	81 c2 80 b3 33 80    	add    $0x8033b380,%edx
+80105776:	8b 52 38             	mov    0x38(%edx),%edx
+    if(n > most){
+80105779:	39 d3                	cmp    %edx,%ebx
+8010577b:	7d df                	jge    8010575c <runqPick+0x27>
+      most = n;
+8010577d:	89 d3                	mov    %edx,%ebx
+      best = i;
+8010577f:	89 c6                	mov    %eax,%esi
+80105781:	eb d9                	jmp    8010575c <runqPick+0x27>
+    return self;
+80105783:	89 ce                	mov    %ecx,%esi
+    }
+  }
+  return best;
+}
+80105785:	89 f0                	mov    %esi,%eax
+80105787:	5b                   	pop    %ebx
+80105788:	5e                   	pop    %esi
+80105789:	5d                   	pop    %ebp
+8010578a:	c3                   	ret
+
+8010578b <allocpid>:
+static void
+allocpid(struct proc *p)
+{
+  struct proc **h;
+
+  p->pid = nextpid++;
+8010578b:	8b 15 04 f0 10 80    	mov    0x8010f004,%edx
+80105791:	8d 4a 01             	lea    0x1(%edx),%ecx
+80105794:	89 0d 04 f0 10 80    	mov    %ecx,0x8010f004
+8010579a:	89 50 10             	mov    %edx,0x10(%eax)
+  h = &ptable.pidhash[p->pid % NPIDHASH];
+8010579d:	83 e2 3f             	and    $0x3f,%edx
+  p->pidnext = *h;
+801057a0:	81 c2 cc 10 00 00    	add    $0x10cc,%edx
+801057a6:	8b 0c 95 88 b5 33 80 	mov    -0x7fcc4a78(,%edx,4),%ecx
+801057ad:	89 48 14             	mov    %ecx,0x14(%eax)
+  *h = p;
+801057b0:	89 04 95 88 b5 33 80 	mov    %eax,-0x7fcc4a78(,%edx,4)
+}
+801057b7:	c3                   	ret
+
+801057b8 <freepid>:
+static void
+freepid(struct proc *p)
+{
+  struct proc **h;
+
+  for(h = &ptable.pidhash[p->pid % NPIDHASH]; *h; h = &(*h)->pidnext){
+801057b8:	8b 50 10             	mov    0x10(%eax),%edx
+801057bb:	83 e2 3f             	and    $0x3f,%edx
+801057be:	8d 0c 95 b8 f8 33 80 	lea    -0x7fcc0748(,%edx,4),%ecx
+801057c5:	eb 03                	jmp    801057ca <freepid+0x12>
+801057c7:	8d 4a 14             	lea    0x14(%edx),%ecx
+801057ca:	8b 11                	mov    (%ecx),%edx
+801057cc:	85 d2                	test   %edx,%edx
+801057ce:	74 09                	je     801057d9 <freepid+0x21>
+    if(*h == p){
+801057d0:	39 c2                	cmp    %eax,%edx
+801057d2:	75 f3                	jne    801057c7 <freepid+0xf>
+      *h = p->pidnext;
+801057d4:	8b 50 14             	mov    0x14(%eax),%edx
+801057d7:	89 11                	mov    %edx,(%ecx)
+      break;
+    }
+  }
+  p->pidnext = 0;
+801057d9:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  p->pid = 0;
+801057e0:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+}
+801057e7:	c3                   	ret
+
+801057e8 <pidlookup>:
+
+// The process with the given pid, or NULL if it has been reaped.
+// Caller must hold ptable.lock.
+static struct proc*
+pidlookup(int pid)
+{
+801057e8:	89 c2                	mov    %eax,%edx
+  struct proc *p;
+
+  for(p = ptable.pidhash[(uint)pid % NPIDHASH]; p; p = p->pidnext)
+801057ea:	83 e0 3f             	and    $0x3f,%eax
+801057ed:	8b 04 85 b8 f8 33 80 	mov    -0x7fcc0748(,%eax,4),%eax
+801057f4:	eb 03                	jmp    801057f9 <pidlookup+0x11>
+801057f6:	8b 40 14             	mov    0x14(%eax),%eax
+801057f9:	85 c0                	test   %eax,%eax
+801057fb:	74 05                	je     80105802 <pidlookup+0x1a>
+    if(p->pid == pid)
+801057fd:	3b 50 10             	cmp    0x10(%eax),%edx
+80105800:	75 f4                	jne    801057f6 <pidlookup+0xe>
+      return p;
+  return NULL;
+}
+80105802:	c3                   	ret
+
+80105803 <timerremove>:
+}
+
+static void
+timerremove(struct proc *p)
+{
+  if(p->tnext)
+80105803:	8b 90 c8 00 00 00    	mov    0xc8(%eax),%edx
+80105809:	85 d2                	test   %edx,%edx
+8010580b:	74 0c                	je     80105819 <timerremove+0x16>
+    p->tnext->tprev = p->tprev;
+8010580d:	8b 88 cc 00 00 00    	mov    0xcc(%eax),%ecx
+80105813:	89 8a cc 00 00 00    	mov    %ecx,0xcc(%edx)
+  *p->tprev = p->tnext;
+80105819:	8b 90 cc 00 00 00    	mov    0xcc(%eax),%edx
+8010581f:	8b 88 c8 00 00 00    	mov    0xc8(%eax),%ecx
+80105825:	89 0a                	mov    %ecx,(%edx)
+  p->tnext = 0;
+80105827:	c7 80 c8 00 00 00 00 	movl   $0x0,0xc8(%eax)
+8010582e:	00 00 00 
+  p->tprev = 0;
+80105831:	c7 80 cc 00 00 00 00 	movl   $0x0,0xcc(%eax)
+80105838:	00 00 00 
+}
+8010583b:	c3                   	ret
+
+8010583c <stateListAdd>:
+  if(p->list != NULL)
+8010583c:	83 ba ec 00 00 00 00 	cmpl   $0x0,0xec(%edx)
+80105843:	75 28                	jne    8010586d <stateListAdd+0x31>
+  p->next = NULL;
+80105845:	c7 82 e4 00 00 00 00 	movl   $0x0,0xe4(%edx)
+8010584c:	00 00 00 
+  p->prev = (*list).tail;
+8010584f:	8b 48 04             	mov    0x4(%eax),%ecx
+80105852:	89 8a e8 00 00 00    	mov    %ecx,0xe8(%edx)
+  if((*list).head == NULL)
+80105858:	83 38 00             	cmpl   $0x0,(%eax)
+8010585b:	74 20                	je     8010587d <stateListAdd+0x41>
+    ((*list).tail)->next = p;
+8010585d:	89 91 e4 00 00 00    	mov    %edx,0xe4(%ecx)
+  (*list).tail = p;
+80105863:	89 50 04             	mov    %edx,0x4(%eax)
+  p->list = list;
+80105866:	89 82 ec 00 00 00    	mov    %eax,0xec(%edx)
+8010586c:	c3                   	ret
+{
+8010586d:	55                   	push   %ebp
+8010586e:	89 e5                	mov    %esp,%ebp
+80105870:	83 ec 14             	sub    $0x14,%esp
+    panic("stateListAdd: proc already on a list");
+80105873:	68 00 b7 10 80       	push   $0x8010b700
+80105878:	e8 a9 b2 ff ff       	call   80100b26 <panic>
+    (*list).head = p;
+8010587d:	89 10                	mov    %edx,(%eax)
+8010587f:	eb e2                	jmp    80105863 <stateListAdd+0x27>
+
+80105881 <initFreeList>:
+{
+80105881:	55                   	push   %ebp
+80105882:	89 e5                	mov    %esp,%ebp
+80105884:	53                   	push   %ebx
+80105885:	83 ec 04             	sub    $0x4,%esp
+  for(p = ptable.all; p; p = p->allnext){
+80105888:	8b 1d b4 f4 33 80    	mov    0x8033f4b4,%ebx
+8010588e:	eb 20                	jmp    801058b0 <initFreeList+0x2f>
+    p->state = UNUSED;
+80105890:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    p->list = NULL;
+80105897:	c7 83 ec 00 00 00 00 	movl   $0x0,0xec(%ebx)
+8010589e:	00 00 00 
+    stateListAdd(&ptable.list[UNUSED], p);
+801058a1:	89 da                	mov    %ebx,%edx
+801058a3:	b8 b8 f9 33 80       	mov    $0x8033f9b8,%eax
+801058a8:	e8 8f ff ff ff       	call   8010583c <stateListAdd>
+  for(p = ptable.all; p; p = p->allnext){
+801058ad:	8b 5b 18             	mov    0x18(%ebx),%ebx
+801058b0:	85 db                	test   %ebx,%ebx
+801058b2:	75 dc                	jne    80105890 <initFreeList+0xf>
+}
+801058b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801058b7:	c9                   	leave
+801058b8:	c3                   	ret
+
+801058b9 <runqAdd>:
+{
+801058b9:	55                   	push   %ebp
+801058ba:	89 e5                	mov    %esp,%ebp
+801058bc:	56                   	push   %esi
+801058bd:	53                   	push   %ebx
+801058be:	89 c6                	mov    %eax,%esi
+801058c0:	89 d3                	mov    %edx,%ebx
+  stateListAdd(&q->ready[p->priority], p);
+801058c2:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+801058c9:	03 82 f0 00 00 00    	add    0xf0(%edx),%eax
+801058cf:	8d 04 c5 80 b3 33 80 	lea    -0x7fcc4c80(,%eax,8),%eax
+801058d6:	e8 61 ff ff ff       	call   8010583c <stateListAdd>
+  q->count++;
+801058db:	89 f0                	mov    %esi,%eax
+801058dd:	c1 e0 06             	shl    $0x6,%eax
+801058e0:	8b 88 b8 b3 33 80    	mov    -0x7fcc4c48(%eax),%ecx
+801058e6:	8d 51 01             	lea    0x1(%ecx),%edx
+801058e9:	89 90 b8 b3 33 80    	mov    %edx,-0x7fcc4c48(%eax)
+  p->rq = rq;
+801058ef:	89 b3 f8 00 00 00    	mov    %esi,0xf8(%ebx)
+}
+801058f5:	5b                   	pop    %ebx
+801058f6:	5e                   	pop    %esi
+801058f7:	5d                   	pop    %ebp
+801058f8:	c3                   	ret
+
+801058f9 <runqRemove>:
+{
+801058f9:	55                   	push   %ebp
+801058fa:	89 e5                	mov    %esp,%ebp
+801058fc:	53                   	push   %ebx
+801058fd:	83 ec 04             	sub    $0x4,%esp
+80105900:	89 c2                	mov    %eax,%edx
+  struct runq *q = &runq[p->rq];
+80105902:	8b 98 f8 00 00 00    	mov    0xf8(%eax),%ebx
+  if(stateListRemove(&q->ready[p->priority], p) < 0)
+80105908:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+8010590f:	03 82 f0 00 00 00    	add    0xf0(%edx),%eax
+80105915:	8d 04 c5 80 b3 33 80 	lea    -0x7fcc4c80(,%eax,8),%eax
+8010591c:	e8 c2 fc ff ff       	call   801055e3 <stateListRemove>
+80105921:	85 c0                	test   %eax,%eax
+80105923:	78 17                	js     8010593c <runqRemove+0x43>
+  q->count--;
+80105925:	c1 e3 06             	shl    $0x6,%ebx
+80105928:	8b 83 b8 b3 33 80    	mov    -0x7fcc4c48(%ebx),%eax
+8010592e:	83 e8 01             	sub    $0x1,%eax
+80105931:	89 83 b8 b3 33 80    	mov    %eax,-0x7fcc4c48(%ebx)
+}
+80105937:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010593a:	c9                   	leave
+8010593b:	c3                   	ret
+    panic("Process could not be removed from the RUNNABLE list");
+8010593c:	83 ec 0c             	sub    $0xc,%esp
+8010593f:	68 28 b7 10 80       	push   $0x8010b728
+80105944:	e8 dd b1 ff ff       	call   80100b26 <panic>
+
+80105949 <procgrow>:
+{
+80105949:	55                   	push   %ebp
+8010594a:	89 e5                	mov    %esp,%ebp
+8010594c:	56                   	push   %esi
+8010594d:	53                   	push   %ebx
+  if((np = (struct proc*)kalloc()) == 0)
+8010594e:	e8 3d e6 ff ff       	call   80103f90 <kalloc>
+80105953:	85 c0                	test   %eax,%eax
+80105955:	74 56                	je     801059ad <procgrow+0x64>
+80105957:	89 c6                	mov    %eax,%esi
+  memset(np, 0, PGSIZE);
+80105959:	83 ec 04             	sub    $0x4,%esp
+8010595c:	68 00 10 00 00       	push   $0x1000
+80105961:	6a 00                	push   $0x0
+80105963:	50                   	push   %eax
+80105964:	e8 0e 21 00 00       	call   80107a77 <memset>
+  for(p = np; p < np + PGSIZE/sizeof(*p); p++){
+80105969:	83 c4 10             	add    $0x10,%esp
+8010596c:	89 f3                	mov    %esi,%ebx
+8010596e:	eb 27                	jmp    80105997 <procgrow+0x4e>
+    p->state = UNUSED;
+80105970:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    p->allnext = ptable.all;
+80105977:	a1 b4 f4 33 80       	mov    0x8033f4b4,%eax
+8010597c:	89 43 18             	mov    %eax,0x18(%ebx)
+    ptable.all = p;
+8010597f:	89 1d b4 f4 33 80    	mov    %ebx,0x8033f4b4
+    stateListAdd(&ptable.list[UNUSED], p);
+80105985:	89 da                	mov    %ebx,%edx
+80105987:	b8 b8 f9 33 80       	mov    $0x8033f9b8,%eax
+8010598c:	e8 ab fe ff ff       	call   8010583c <stateListAdd>
+  for(p = np; p < np + PGSIZE/sizeof(*p); p++){
+80105991:	81 c3 fc 00 00 00    	add    $0xfc,%ebx
+80105997:	8d 86 c0 0f 00 00    	lea    0xfc0(%esi),%eax
+8010599d:	39 c3                	cmp    %eax,%ebx
+8010599f:	72 cf                	jb     80105970 <procgrow+0x27>
+  return 1;
+801059a1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+801059a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801059a9:	5b                   	pop    %ebx
+801059aa:	5e                   	pop    %esi
+801059ab:	5d                   	pop    %ebp
+801059ac:	c3                   	ret
+    return 0;
+801059ad:	b8 00 00 00 00       	mov    $0x0,%eax
+801059b2:	eb f2                	jmp    801059a6 <procgrow+0x5d>
+
+801059b4 <assertState>:
+    if (p->state == state)
+801059b4:	8b 40 0c             	mov    0xc(%eax),%eax
+801059b7:	39 d0                	cmp    %edx,%eax
+801059b9:	75 01                	jne    801059bc <assertState+0x8>
+801059bb:	c3                   	ret
+{
+801059bc:	55                   	push   %ebp
+801059bd:	89 e5                	mov    %esp,%ebp
+801059bf:	83 ec 14             	sub    $0x14,%esp
+    cprintf("Error: proc state is %s and should be %s.\nCalled from %s line %d\n",
+801059c2:	ff 75 08             	push   0x8(%ebp)
+801059c5:	51                   	push   %ecx
+801059c6:	ff 34 95 e4 bb 10 80 	push   -0x7fef441c(,%edx,4)
+801059cd:	ff 34 85 e4 bb 10 80 	push   -0x7fef441c(,%eax,4)
+801059d4:	68 5c b7 10 80       	push   $0x8010b75c
+801059d9:	e8 09 b4 ff ff       	call   80100de7 <cprintf>
+    panic("Error: Process state incorrect in assertState()");
+801059de:	83 c4 14             	add    $0x14,%esp
+801059e1:	68 a0 b7 10 80       	push   $0x8010b7a0
+801059e6:	e8 3b b1 ff ff       	call   80100b26 <panic>
+
+801059eb <allocproc>:
+{
+801059eb:	55                   	push   %ebp
+801059ec:	89 e5                	mov    %esp,%ebp
+801059ee:	56                   	push   %esi
+801059ef:	53                   	push   %ebx
+  acquire(&ptable.lock);
+801059f0:	83 ec 0c             	sub    $0xc,%esp
+801059f3:	68 80 b5 33 80       	push   $0x8033b580
+801059f8:	e8 ce 1f 00 00       	call   801079cb <acquire>
+  if(ptable.list[UNUSED].head == NULL)
+801059fd:	83 c4 10             	add    $0x10,%esp
+80105a00:	83 3d b8 f9 33 80 00 	cmpl   $0x0,0x8033f9b8
+80105a07:	0f 84 fa 00 00 00    	je     80105b07 <allocproc+0x11c>
+  if(ptable.list[UNUSED].head != NULL){
+80105a0d:	8b 1d b8 f9 33 80    	mov    0x8033f9b8,%ebx
+80105a13:	85 db                	test   %ebx,%ebx
+80105a15:	0f 84 03 01 00 00    	je     80105b1e <allocproc+0x133>
+    if(stateListRemove(&ptable.list[p->state], p) < 0){
+80105a1b:	8b 43 0c             	mov    0xc(%ebx),%eax
+80105a1e:	8d 04 c5 b8 f9 33 80 	lea    -0x7fcc0648(,%eax,8),%eax
+80105a25:	89 da                	mov    %ebx,%edx
+80105a27:	e8 b7 fb ff ff       	call   801055e3 <stateListRemove>
+80105a2c:	85 c0                	test   %eax,%eax
+80105a2e:	0f 88 dd 00 00 00    	js     80105b11 <allocproc+0x126>
+    assertState(p, UNUSED, __FUNCTION__, __LINE__);
+80105a34:	83 ec 0c             	sub    $0xc,%esp
+80105a37:	68 b1 01 00 00       	push   $0x1b1
+80105a3c:	b9 cc bb 10 80       	mov    $0x8010bbcc,%ecx
+80105a41:	ba 00 00 00 00       	mov    $0x0,%edx
+80105a46:	89 d8                	mov    %ebx,%eax
+80105a48:	e8 67 ff ff ff       	call   801059b4 <assertState>
+    p->priority = MAXPRIO;
+80105a4d:	c7 83 f0 00 00 00 06 	movl   $0x6,0xf0(%ebx)
+80105a54:	00 00 00 
+    p->budget = DEFAULT_BUDGET;
+80105a57:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+80105a5e:	01 00 00 
+    p->state = EMBRYO;
+80105a61:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+    stateListAdd(&ptable.list[p->state],p);
+80105a68:	89 da                	mov    %ebx,%edx
+80105a6a:	b8 c0 f9 33 80       	mov    $0x8033f9c0,%eax
+80105a6f:	e8 c8 fd ff ff       	call   8010583c <stateListAdd>
+  allocpid(p);
+80105a74:	89 d8                	mov    %ebx,%eax
+80105a76:	e8 10 fd ff ff       	call   8010578b <allocpid>
+  release(&ptable.lock);
+80105a7b:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80105a82:	e8 a9 1f 00 00       	call   80107a30 <release>
+  if((p->kstack = kalloc()) == 0){
+80105a87:	e8 04 e5 ff ff       	call   80103f90 <kalloc>
+80105a8c:	89 c6                	mov    %eax,%esi
+80105a8e:	89 43 08             	mov    %eax,0x8(%ebx)
+80105a91:	83 c4 10             	add    $0x10,%esp
+80105a94:	85 c0                	test   %eax,%eax
+80105a96:	0f 84 94 00 00 00    	je     80105b30 <allocproc+0x145>
+  sp -= sizeof *p->tf;
+80105a9c:	8d 80 b4 0f 00 00    	lea    0xfb4(%eax),%eax
+  p->tf = (struct trapframe*)sp;
+80105aa2:	89 43 20             	mov    %eax,0x20(%ebx)
+  *(uint*)sp = (uint)trapret;
+80105aa5:	c7 86 b0 0f 00 00 ce 	movl   $0x80108dce,0xfb0(%esi)
+80105aac:	8d 10 80 
+  sp -= sizeof *p->context;
+80105aaf:	81 c6 9c 0f 00 00    	add    $0xf9c,%esi
+  p->context = (struct context*)sp;
+80105ab5:	89 73 24             	mov    %esi,0x24(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+80105ab8:	83 ec 04             	sub    $0x4,%esp
+80105abb:	6a 14                	push   $0x14
+80105abd:	6a 00                	push   $0x0
+80105abf:	56                   	push   %esi
+80105ac0:	e8 b2 1f 00 00       	call   80107a77 <memset>
+  p->context->eip = (uint)forkret;
+80105ac5:	8b 43 24             	mov    0x24(%ebx),%eax
+80105ac8:	c7 40 10 56 5c 10 80 	movl   $0x80105c56,0x10(%eax)
+  p->ofile = p->ofile0;
+80105acf:	8d 43 38             	lea    0x38(%ebx),%eax
+80105ad2:	89 43 30             	mov    %eax,0x30(%ebx)
+  p->nofile = NOFILE;
+80105ad5:	c7 43 34 10 00 00 00 	movl   $0x10,0x34(%ebx)
+  p->start_ticks = ticks;
+80105adc:	a1 e0 fb 33 80       	mov    0x8033fbe0,%eax
+80105ae1:	89 83 d0 00 00 00    	mov    %eax,0xd0(%ebx)
+  p->cpu_ticks_total = 0;
+80105ae7:	c7 83 dc 00 00 00 00 	movl   $0x0,0xdc(%ebx)
+80105aee:	00 00 00 
+  p->cpu_ticks_in = 0;
+80105af1:	c7 83 e0 00 00 00 00 	movl   $0x0,0xe0(%ebx)
+80105af8:	00 00 00 
+  return p;
+80105afb:	83 c4 10             	add    $0x10,%esp
+}
+80105afe:	89 d8                	mov    %ebx,%eax
+80105b00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105b03:	5b                   	pop    %ebx
+80105b04:	5e                   	pop    %esi
+80105b05:	5d                   	pop    %ebp
+80105b06:	c3                   	ret
+    procgrow();
+80105b07:	e8 3d fe ff ff       	call   80105949 <procgrow>
+80105b0c:	e9 fc fe ff ff       	jmp    80105a0d <allocproc+0x22>
+      panic("Process could not be removed from UNUSED list");
+80105b11:	83 ec 0c             	sub    $0xc,%esp
+80105b14:	68 d0 b7 10 80       	push   $0x8010b7d0
+80105b19:	e8 08 b0 ff ff       	call   80100b26 <panic>
+    release(&ptable.lock);
+80105b1e:	83 ec 0c             	sub    $0xc,%esp
+80105b21:	68 80 b5 33 80       	push   $0x8033b580
+80105b26:	e8 05 1f 00 00       	call   80107a30 <release>
+    return 0;
+80105b2b:	83 c4 10             	add    $0x10,%esp
+80105b2e:	eb ce                	jmp    80105afe <allocproc+0x113>
+    acquire(&ptable.lock);
+80105b30:	83 ec 0c             	sub    $0xc,%esp
+80105b33:	68 80 b5 33 80       	push   $0x8033b580
+80105b38:	e8 8e 1e 00 00       	call   801079cb <acquire>
+    freepid(p);
+80105b3d:	89 d8                	mov    %ebx,%eax
+80105b3f:	e8 74 fc ff ff       	call   801057b8 <freepid>
+    if(stateListRemove(&ptable.list[p->state], p) < 0){
+80105b44:	8b 43 0c             	mov    0xc(%ebx),%eax
+80105b47:	8d 04 c5 b8 f9 33 80 	lea    -0x7fcc0648(,%eax,8),%eax
+80105b4e:	89 da                	mov    %ebx,%edx
+80105b50:	e8 8e fa ff ff       	call   801055e3 <stateListRemove>
+80105b55:	83 c4 10             	add    $0x10,%esp
+80105b58:	85 c0                	test   %eax,%eax
+80105b5a:	78 42                	js     80105b9e <allocproc+0x1b3>
+    assertState(p, EMBRYO, __FUNCTION__, __LINE__);
+80105b5c:	83 ec 0c             	sub    $0xc,%esp
+80105b5f:	68 ca 01 00 00       	push   $0x1ca
+80105b64:	b9 cc bb 10 80       	mov    $0x8010bbcc,%ecx
+80105b69:	ba 01 00 00 00       	mov    $0x1,%edx
+80105b6e:	89 d8                	mov    %ebx,%eax
+80105b70:	e8 3f fe ff ff       	call   801059b4 <assertState>
+    p->state = UNUSED;
+80105b75:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    stateListAdd(&ptable.list[p->state], p);
+80105b7c:	89 da                	mov    %ebx,%edx
+80105b7e:	b8 b8 f9 33 80       	mov    $0x8033f9b8,%eax
+80105b83:	e8 b4 fc ff ff       	call   8010583c <stateListAdd>
+    release(&ptable.lock);
+80105b88:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80105b8f:	e8 9c 1e 00 00       	call   80107a30 <release>
+    return 0;
+80105b94:	83 c4 10             	add    $0x10,%esp
+80105b97:	89 f3                	mov    %esi,%ebx
+80105b99:	e9 60 ff ff ff       	jmp    80105afe <allocproc+0x113>
+      panic("Process could not be removed from EMBRYO list");
+80105b9e:	83 ec 0c             	sub    $0xc,%esp
+80105ba1:	68 00 b8 10 80       	push   $0x8010b800
+80105ba6:	e8 7b af ff ff       	call   80100b26 <panic>
+
+80105bab <wakeup1>:
+{
+80105bab:	55                   	push   %ebp
+80105bac:	89 e5                	mov    %esp,%ebp
+80105bae:	57                   	push   %edi
+80105baf:	56                   	push   %esi
+80105bb0:	53                   	push   %ebx
+80105bb1:	83 ec 1c             	sub    $0x1c,%esp
+80105bb4:	89 c7                	mov    %eax,%edi
+  for(p = sleepList(chan)->head; p != NULL; p = next){
+80105bb6:	e8 b1 fa ff ff       	call   8010566c <sleepList>
+80105bbb:	8b 18                	mov    (%eax),%ebx
+80105bbd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105bc0:	eb 0f                	jmp    80105bd1 <wakeup1+0x26>
+	panic("Process could not be removed from the list");
+80105bc2:	83 ec 0c             	sub    $0xc,%esp
+80105bc5:	68 30 b8 10 80       	push   $0x8010b830
+80105bca:	e8 57 af ff ff       	call   80100b26 <panic>
+{
+80105bcf:	89 f3                	mov    %esi,%ebx
+  for(p = sleepList(chan)->head; p != NULL; p = next){
+80105bd1:	85 db                	test   %ebx,%ebx
+80105bd3:	74 4b                	je     80105c20 <wakeup1+0x75>
+    next = p->next;  // removal clears p->next
+80105bd5:	8b b3 e4 00 00 00    	mov    0xe4(%ebx),%esi
+    if(p->chan == chan){
+80105bdb:	39 7b 28             	cmp    %edi,0x28(%ebx)
+80105bde:	75 ef                	jne    80105bcf <wakeup1+0x24>
+      if(stateListRemove(sleepList(chan), p) < 0)
+80105be0:	89 da                	mov    %ebx,%edx
+80105be2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105be5:	e8 f9 f9 ff ff       	call   801055e3 <stateListRemove>
+80105bea:	85 c0                	test   %eax,%eax
+80105bec:	78 d4                	js     80105bc2 <wakeup1+0x17>
+      assertState(p, SLEEPING, __FUNCTION__, __LINE__);
+80105bee:	83 ec 0c             	sub    $0xc,%esp
+80105bf1:	68 52 06 00 00       	push   $0x652
+80105bf6:	b9 b4 bb 10 80       	mov    $0x8010bbb4,%ecx
+80105bfb:	ba 02 00 00 00       	mov    $0x2,%edx
+80105c00:	89 d8                	mov    %ebx,%eax
+80105c02:	e8 ad fd ff ff       	call   801059b4 <assertState>
+      p->state = RUNNABLE;
+80105c07:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+      runqAdd(p->rq, p);
+80105c0e:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80105c14:	89 da                	mov    %ebx,%edx
+80105c16:	e8 9e fc ff ff       	call   801058b9 <runqAdd>
+80105c1b:	83 c4 10             	add    $0x10,%esp
+80105c1e:	eb af                	jmp    80105bcf <wakeup1+0x24>
+}
+80105c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105c23:	5b                   	pop    %ebx
+80105c24:	5e                   	pop    %esi
+80105c25:	5f                   	pop    %edi
+80105c26:	5d                   	pop    %ebp
+80105c27:	c3                   	ret
+
+80105c28 <ofilefree>:
+{
+80105c28:	55                   	push   %ebp
+80105c29:	89 e5                	mov    %esp,%ebp
+80105c2b:	56                   	push   %esi
+80105c2c:	53                   	push   %ebx
+80105c2d:	89 c3                	mov    %eax,%ebx
+  if(p->ofile != p->ofile0)
+80105c2f:	8b 40 30             	mov    0x30(%eax),%eax
+80105c32:	8d 73 38             	lea    0x38(%ebx),%esi
+80105c35:	39 f0                	cmp    %esi,%eax
+80105c37:	74 0c                	je     80105c45 <ofilefree+0x1d>
+    kfree((char*)p->ofile);
+80105c39:	83 ec 0c             	sub    $0xc,%esp
+80105c3c:	50                   	push   %eax
+80105c3d:	e8 2f e1 ff ff       	call   80103d71 <kfree>
+80105c42:	83 c4 10             	add    $0x10,%esp
+  p->ofile = p->ofile0;
+80105c45:	89 73 30             	mov    %esi,0x30(%ebx)
+  p->nofile = NOFILE;
+80105c48:	c7 43 34 10 00 00 00 	movl   $0x10,0x34(%ebx)
+}
+80105c4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105c52:	5b                   	pop    %ebx
+80105c53:	5e                   	pop    %esi
+80105c54:	5d                   	pop    %ebp
+80105c55:	c3                   	ret
+
+80105c56 <forkret>:
+{
+80105c56:	55                   	push   %ebp
+80105c57:	89 e5                	mov    %esp,%ebp
+80105c59:	83 ec 14             	sub    $0x14,%esp
+  release(&ptable.lock);
+80105c5c:	68 80 b5 33 80       	push   $0x8033b580
+80105c61:	e8 ca 1d 00 00       	call   80107a30 <release>
+  if (first) {
+80105c66:	83 c4 10             	add    $0x10,%esp
+80105c69:	83 3d 00 f0 10 80 00 	cmpl   $0x0,0x8010f000
+80105c70:	75 02                	jne    80105c74 <forkret+0x1e>
+}
+80105c72:	c9                   	leave
+80105c73:	c3                   	ret
+    first = 0;
+80105c74:	c7 05 00 f0 10 80 00 	movl   $0x0,0x8010f000
+80105c7b:	00 00 00 
+    iinit(ROOTDEV);
+80105c7e:	83 ec 0c             	sub    $0xc,%esp
+80105c81:	6a 01                	push   $0x1
+80105c83:	e8 dc cb ff ff       	call   80102864 <iinit>
+    initlog(ROOTDEV);
+80105c88:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+80105c8f:	e8 1a ea ff ff       	call   801046ae <initlog>
+    iinit2(ROOTDEV);
+80105c94:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+80105c9b:	e8 e4 cc ff ff       	call   80102984 <iinit2>
+80105ca0:	83 c4 10             	add    $0x10,%esp
+}
+80105ca3:	eb cd                	jmp    80105c72 <forkret+0x1c>
+
+80105ca5 <pinit>:
+{
+80105ca5:	55                   	push   %ebp
+80105ca6:	89 e5                	mov    %esp,%ebp
+80105ca8:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ptable.lock, "ptable");
+80105cab:	68 c1 b9 10 80       	push   $0x8010b9c1
+80105cb0:	68 80 b5 33 80       	push   $0x8033b580
+80105cb5:	e8 cd 1b 00 00       	call   80107887 <initlock>
+  for(p = &ptable.proc[NPROC-1]; p >= ptable.proc; p--){
+80105cba:	83 c4 10             	add    $0x10,%esp
+80105cbd:	b8 b8 f3 33 80       	mov    $0x8033f3b8,%eax
+80105cc2:	eb 13                	jmp    80105cd7 <pinit+0x32>
+    p->allnext = ptable.all;
+80105cc4:	8b 15 b4 f4 33 80    	mov    0x8033f4b4,%edx
+80105cca:	89 50 18             	mov    %edx,0x18(%eax)
+    ptable.all = p;
+80105ccd:	a3 b4 f4 33 80       	mov    %eax,0x8033f4b4
+  for(p = &ptable.proc[NPROC-1]; p >= ptable.proc; p--){
+80105cd2:	2d fc 00 00 00       	sub    $0xfc,%eax
+80105cd7:	3d b4 b5 33 80       	cmp    $0x8033b5b4,%eax
+80105cdc:	73 e6                	jae    80105cc4 <pinit+0x1f>
+}
+80105cde:	c9                   	leave
+80105cdf:	c3                   	ret
+
+80105ce0 <mycpu>:
+{
+80105ce0:	55                   	push   %ebp
+80105ce1:	89 e5                	mov    %esp,%ebp
+80105ce3:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80105ce6:	9c                   	pushf
+80105ce7:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80105ce8:	f6 c4 02             	test   $0x2,%ah
+80105ceb:	75 28                	jne    80105d15 <mycpu+0x35>
+  apicid = lapicid();
+80105ced:	e8 62 e5 ff ff       	call   80104254 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+80105cf2:	ba 00 00 00 00       	mov    $0x0,%edx
+80105cf7:	39 15 84 ad 33 80    	cmp    %edx,0x8033ad84
+80105cfd:	7e 23                	jle    80105d22 <mycpu+0x42>
+    if (cpus[i].apicid == apicid) {
+80105cff:	69 ca b0 00 00 00    	imul   $0xb0,%edx,%ecx
+80105d05:	0f b6 89 a0 ad 33 80 	movzbl -0x7fcc5260(%ecx),%ecx
+80105d0c:	39 c1                	cmp    %eax,%ecx
+80105d0e:	74 1f                	je     80105d2f <mycpu+0x4f>
+  for (i = 0; i < ncpu; ++i) {
+80105d10:	83 c2 01             	add    $0x1,%edx
+80105d13:	eb e2                	jmp    80105cf7 <mycpu+0x17>
+    panic("mycpu called with interrupts enabled\n");
+80105d15:	83 ec 0c             	sub    $0xc,%esp
+80105d18:	68 5c b8 10 80       	push   $0x8010b85c
+80105d1d:	e8 04 ae ff ff       	call   80100b26 <panic>
+  panic("unknown apicid\n");
+80105d22:	83 ec 0c             	sub    $0xc,%esp
+80105d25:	68 c8 b9 10 80       	push   $0x8010b9c8
+80105d2a:	e8 f7 ad ff ff       	call   80100b26 <panic>
+      return &cpus[i];
+80105d2f:	69 c2 b0 00 00 00    	imul   $0xb0,%edx,%eax
+80105d35:	05 a0 ad 33 80       	add    $0x8033ada0,%eax
+}
+80105d3a:	c9                   	leave
+80105d3b:	c3                   	ret
+
+80105d3c <cpuid>:
+cpuid() {
+80105d3c:	55                   	push   %ebp
+80105d3d:	89 e5                	mov    %esp,%ebp
+80105d3f:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80105d42:	e8 99 ff ff ff       	call   80105ce0 <mycpu>
+80105d47:	2d a0 ad 33 80       	sub    $0x8033ada0,%eax
+80105d4c:	c1 f8 04             	sar    $0x4,%eax
+80105d4f:	69 c0 a3 8b 2e ba    	imul   $0xba2e8ba3,%eax,%eax
+}
+80105d55:	c9                   	leave
+80105d56:	c3                   	ret
+
+80105d57 <myproc>:
+myproc(void) {
+80105d57:	55                   	push   %ebp
+80105d58:	89 e5                	mov    %esp,%ebp
+80105d5a:	53                   	push   %ebx
+80105d5b:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80105d5e:	e8 85 1b 00 00       	call   801078e8 <pushcli>
+  c = mycpu();
+80105d63:	e8 78 ff ff ff       	call   80105ce0 <mycpu>
+  p = c->proc;
+80105d68:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80105d6e:	e8 b9 1b 00 00       	call   8010792c <popcli>
+}
+80105d73:	89 d8                	mov    %ebx,%eax
+80105d75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105d78:	c9                   	leave
+80105d79:	c3                   	ret
+
+80105d7a <ofilegrow>:
+{
+80105d7a:	55                   	push   %ebp
+80105d7b:	89 e5                	mov    %esp,%ebp
+80105d7d:	57                   	push   %edi
+80105d7e:	56                   	push   %esi
+80105d7f:	53                   	push   %ebx
+80105d80:	83 ec 0c             	sub    $0xc,%esp
+80105d83:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p->ofile != p->ofile0 || (f = (struct file**)kalloc()) == 0)
+80105d86:	8d 7e 38             	lea    0x38(%esi),%edi
+80105d89:	39 7e 30             	cmp    %edi,0x30(%esi)
+80105d8c:	75 4e                	jne    80105ddc <ofilegrow+0x62>
+80105d8e:	e8 fd e1 ff ff       	call   80103f90 <kalloc>
+80105d93:	89 c3                	mov    %eax,%ebx
+80105d95:	85 c0                	test   %eax,%eax
+80105d97:	74 43                	je     80105ddc <ofilegrow+0x62>
+  memset(f, 0, PGSIZE);
+80105d99:	83 ec 04             	sub    $0x4,%esp
+80105d9c:	68 00 10 00 00       	push   $0x1000
+80105da1:	6a 00                	push   $0x0
+80105da3:	50                   	push   %eax
+80105da4:	e8 ce 1c 00 00       	call   80107a77 <memset>
+  memmove(f, p->ofile0, sizeof(p->ofile0));
+80105da9:	83 c4 0c             	add    $0xc,%esp
+80105dac:	6a 40                	push   $0x40
+80105dae:	57                   	push   %edi
+80105daf:	53                   	push   %ebx
+80105db0:	e8 3a 1d 00 00       	call   80107aef <memmove>
+  memset(p->ofile0, 0, sizeof(p->ofile0));
+80105db5:	83 c4 0c             	add    $0xc,%esp
+80105db8:	6a 40                	push   $0x40
+80105dba:	6a 00                	push   $0x0
+80105dbc:	57                   	push   %edi
+80105dbd:	e8 b5 1c 00 00       	call   80107a77 <memset>
+  p->ofile = f;
+80105dc2:	89 5e 30             	mov    %ebx,0x30(%esi)
+  p->nofile = PGSIZE/sizeof(*f);
+80105dc5:	c7 46 34 00 04 00 00 	movl   $0x400,0x34(%esi)
+  return 0;
+80105dcc:	83 c4 10             	add    $0x10,%esp
+80105dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105dd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105dd7:	5b                   	pop    %ebx
+80105dd8:	5e                   	pop    %esi
+80105dd9:	5f                   	pop    %edi
+80105dda:	5d                   	pop    %ebp
+80105ddb:	c3                   	ret
+    return -1;
+80105ddc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105de1:	eb f1                	jmp    80105dd4 <ofilegrow+0x5a>
+
+80105de3 <userinit>:
+{
+80105de3:	55                   	push   %ebp
+80105de4:	89 e5                	mov    %esp,%ebp
+80105de6:	53                   	push   %ebx
+80105de7:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+80105dea:	68 80 b5 33 80       	push   $0x8033b580
+80105def:	e8 d7 1b 00 00       	call   801079cb <acquire>
+  initProcessLists();
+80105df4:	e8 8f f8 ff ff       	call   80105688 <initProcessLists>
+  initFreeList();
+80105df9:	e8 83 fa ff ff       	call   80105881 <initFreeList>
+  ptable.PromoteAtTime = ticks + TICKS_TO_PROMOTE;
+80105dfe:	a1 e0 fb 33 80       	mov    0x8033fbe0,%eax
+80105e03:	05 b8 0b 00 00       	add    $0xbb8,%eax
+80105e08:	a3 d0 fb 33 80       	mov    %eax,0x8033fbd0
+  release(&ptable.lock);
+80105e0d:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80105e14:	e8 17 1c 00 00       	call   80107a30 <release>
+  acquire(&ptable.lock);
+80105e19:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80105e20:	e8 a6 1b 00 00       	call   801079cb <acquire>
+  initProcessLists();
+80105e25:	e8 5e f8 ff ff       	call   80105688 <initProcessLists>
+  initFreeList();
+80105e2a:	e8 52 fa ff ff       	call   80105881 <initFreeList>
+  release(&ptable.lock);
+80105e2f:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80105e36:	e8 f5 1b 00 00       	call   80107a30 <release>
+  p = allocproc();
+80105e3b:	e8 ab fb ff ff       	call   801059eb <allocproc>
+80105e40:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+80105e42:	a3 40 b3 33 80       	mov    %eax,0x8033b340
+  if((p->pgdir = setupkvm()) == 0)
+80105e47:	e8 93 4d 00 00       	call   8010abdf <setupkvm>
+80105e4c:	89 43 04             	mov    %eax,0x4(%ebx)
+80105e4f:	83 c4 10             	add    $0x10,%esp
+80105e52:	85 c0                	test   %eax,%eax
+80105e54:	0f 84 0c 01 00 00    	je     80105f66 <userinit+0x183>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80105e5a:	83 ec 04             	sub    $0x4,%esp
+80105e5d:	68 2c 00 00 00       	push   $0x2c
+80105e62:	68 60 f4 10 80       	push   $0x8010f460
+80105e67:	50                   	push   %eax
+80105e68:	e8 87 4a 00 00       	call   8010a8f4 <inituvm>
+  p->sz = PGSIZE;
+80105e6d:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+80105e73:	8b 43 20             	mov    0x20(%ebx),%eax
+80105e76:	83 c4 0c             	add    $0xc,%esp
+80105e79:	6a 4c                	push   $0x4c
+80105e7b:	6a 00                	push   $0x0
+80105e7d:	50                   	push   %eax
+80105e7e:	e8 f4 1b 00 00       	call   80107a77 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105e83:	8b 43 20             	mov    0x20(%ebx),%eax
+80105e86:	66 c7 40 3c 1b 00    	movw   $0x1b,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105e8c:	8b 43 20             	mov    0x20(%ebx),%eax
+80105e8f:	66 c7 40 2c 23 00    	movw   $0x23,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80105e95:	8b 43 20             	mov    0x20(%ebx),%eax
+80105e98:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105e9c:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80105ea0:	8b 43 20             	mov    0x20(%ebx),%eax
+80105ea3:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105ea7:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80105eab:	8b 43 20             	mov    0x20(%ebx),%eax
+80105eae:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80105eb5:	8b 43 20             	mov    0x20(%ebx),%eax
+80105eb8:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80105ebf:	8b 43 20             	mov    0x20(%ebx),%eax
+80105ec2:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  p->uid = UID;
+80105ec9:	c7 83 d4 00 00 00 00 	movl   $0x0,0xd4(%ebx)
+80105ed0:	00 00 00 
+  p->gid = GID;
+80105ed3:	c7 83 d8 00 00 00 00 	movl   $0x0,0xd8(%ebx)
+80105eda:	00 00 00 
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105edd:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+80105ee3:	83 c4 0c             	add    $0xc,%esp
+80105ee6:	6a 10                	push   $0x10
+80105ee8:	68 f1 b9 10 80       	push   $0x8010b9f1
+80105eed:	50                   	push   %eax
+80105eee:	e8 f0 1c 00 00       	call   80107be3 <safestrcpy>
+  p->cwd = namei("/");
+80105ef3:	c7 04 24 fa b9 10 80 	movl   $0x8010b9fa,(%esp)
+80105efa:	e8 1d db ff ff       	call   80103a1c <namei>
+80105eff:	89 43 78             	mov    %eax,0x78(%ebx)
+  acquire(&ptable.lock);
+80105f02:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80105f09:	e8 bd 1a 00 00       	call   801079cb <acquire>
+  if(stateListRemove(&ptable.list[p->state],p) < 0){
+80105f0e:	8b 43 0c             	mov    0xc(%ebx),%eax
+80105f11:	8d 04 c5 b8 f9 33 80 	lea    -0x7fcc0648(,%eax,8),%eax
+80105f18:	89 da                	mov    %ebx,%edx
+80105f1a:	e8 c4 f6 ff ff       	call   801055e3 <stateListRemove>
+80105f1f:	83 c4 10             	add    $0x10,%esp
+80105f22:	85 c0                	test   %eax,%eax
+80105f24:	78 4d                	js     80105f73 <userinit+0x190>
+  assertState(p, EMBRYO, __FUNCTION__, __LINE__);
+80105f26:	83 ec 0c             	sub    $0xc,%esp
+80105f29:	68 5b 02 00 00       	push   $0x25b
+80105f2e:	b9 d8 bb 10 80       	mov    $0x8010bbd8,%ecx
+80105f33:	ba 01 00 00 00       	mov    $0x1,%edx
+80105f38:	89 d8                	mov    %ebx,%eax
+80105f3a:	e8 75 fa ff ff       	call   801059b4 <assertState>
+  p->state = RUNNABLE;
+80105f3f:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  runqAdd(cpuid(), p);
+80105f46:	e8 f1 fd ff ff       	call   80105d3c <cpuid>
+80105f4b:	89 da                	mov    %ebx,%edx
+80105f4d:	e8 67 f9 ff ff       	call   801058b9 <runqAdd>
+  release(&ptable.lock);
+80105f52:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80105f59:	e8 d2 1a 00 00       	call   80107a30 <release>
+}
+80105f5e:	83 c4 10             	add    $0x10,%esp
+80105f61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105f64:	c9                   	leave
+80105f65:	c3                   	ret
+    panic("userinit: out of memory?");
+80105f66:	83 ec 0c             	sub    $0xc,%esp
+80105f69:	68 d8 b9 10 80       	push   $0x8010b9d8
+80105f6e:	e8 b3 ab ff ff       	call   80100b26 <panic>
+    panic("Process could not be removed from the EMBRYO list");
+80105f73:	83 ec 0c             	sub    $0xc,%esp
+80105f76:	68 84 b8 10 80       	push   $0x8010b884
+80105f7b:	e8 a6 ab ff ff       	call   80100b26 <panic>
+
+80105f80 <growproc>:
+{
+80105f80:	55                   	push   %ebp
+80105f81:	89 e5                	mov    %esp,%ebp
+80105f83:	56                   	push   %esi
+80105f84:	53                   	push   %ebx
+80105f85:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80105f88:	e8 ca fd ff ff       	call   80105d57 <myproc>
+80105f8d:	89 c6                	mov    %eax,%esi
+  sz = curproc->sz;
+80105f8f:	8b 00                	mov    (%eax),%eax
+  if(n > 0){
+80105f91:	85 db                	test   %ebx,%ebx
+80105f93:	7e 22                	jle    80105fb7 <growproc+0x37>
+    if(sz + n < sz || sz + n >= KERNBASE)
+80105f95:	01 c3                	add    %eax,%ebx
+80105f97:	72 43                	jb     80105fdc <growproc+0x5c>
+80105f99:	85 db                	test   %ebx,%ebx
+80105f9b:	78 46                	js     80105fe3 <growproc+0x63>
+  curproc->sz = sz;
+80105f9d:	89 1e                	mov    %ebx,(%esi)
+  switchuvm(curproc);
+80105f9f:	83 ec 0c             	sub    $0xc,%esp
+80105fa2:	56                   	push   %esi
+80105fa3:	e8 ec 47 00 00       	call   8010a794 <switchuvm>
+  return 0;
+80105fa8:	83 c4 10             	add    $0x10,%esp
+80105fab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80105fb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105fb3:	5b                   	pop    %ebx
+80105fb4:	5e                   	pop    %esi
+80105fb5:	5d                   	pop    %ebp
+80105fb6:	c3                   	ret
+  } else if(n < 0){
+80105fb7:	78 04                	js     80105fbd <growproc+0x3d>
+  sz = curproc->sz;
+80105fb9:	89 c3                	mov    %eax,%ebx
+80105fbb:	eb e0                	jmp    80105f9d <growproc+0x1d>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80105fbd:	83 ec 04             	sub    $0x4,%esp
+80105fc0:	01 c3                	add    %eax,%ebx
+80105fc2:	53                   	push   %ebx
+80105fc3:	50                   	push   %eax
+80105fc4:	ff 76 04             	push   0x4(%esi)
+80105fc7:	e8 2c 4a 00 00       	call   8010a9f8 <deallocuvm>
+80105fcc:	89 c3                	mov    %eax,%ebx
+80105fce:	83 c4 10             	add    $0x10,%esp
+80105fd1:	85 c0                	test   %eax,%eax
+80105fd3:	75 c8                	jne    80105f9d <growproc+0x1d>
+      return -1;
+80105fd5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105fda:	eb d4                	jmp    80105fb0 <growproc+0x30>
+      return -1;
+80105fdc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105fe1:	eb cd                	jmp    80105fb0 <growproc+0x30>
+80105fe3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105fe8:	eb c6                	jmp    80105fb0 <growproc+0x30>
+
+80105fea <fork>:
+{
+80105fea:	55                   	push   %ebp
+80105feb:	89 e5                	mov    %esp,%ebp
+80105fed:	57                   	push   %edi
+80105fee:	56                   	push   %esi
+80105fef:	53                   	push   %ebx
+80105ff0:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc *curproc = myproc();
+80105ff3:	e8 5f fd ff ff       	call   80105d57 <myproc>
+80105ff8:	89 c3                	mov    %eax,%ebx
+  if((np = allocproc()) == 0){
+80105ffa:	e8 ec f9 ff ff       	call   801059eb <allocproc>
+80105fff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106002:	85 c0                	test   %eax,%eax
+80106004:	0f 84 38 02 00 00    	je     80106242 <fork+0x258>
+  if((curproc->nofile > np->nofile && ofilegrow(np) < 0) ||
+8010600a:	8b 48 34             	mov    0x34(%eax),%ecx
+8010600d:	39 4b 34             	cmp    %ecx,0x34(%ebx)
+80106010:	7e 10                	jle    80106022 <fork+0x38>
+80106012:	83 ec 0c             	sub    $0xc,%esp
+80106015:	50                   	push   %eax
+80106016:	e8 5f fd ff ff       	call   80105d7a <ofilegrow>
+8010601b:	83 c4 10             	add    $0x10,%esp
+8010601e:	85 c0                	test   %eax,%eax
+80106020:	78 5d                	js     8010607f <fork+0x95>
+     (np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+80106022:	83 ec 08             	sub    $0x8,%esp
+80106025:	ff 33                	push   (%ebx)
+80106027:	ff 73 04             	push   0x4(%ebx)
+8010602a:	e8 65 4c 00 00       	call   8010ac94 <copyuvm>
+8010602f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80106032:	89 41 04             	mov    %eax,0x4(%ecx)
+  if((curproc->nofile > np->nofile && ofilegrow(np) < 0) ||
+80106035:	83 c4 10             	add    $0x10,%esp
+80106038:	85 c0                	test   %eax,%eax
+8010603a:	74 43                	je     8010607f <fork+0x95>
+  np->sz = curproc->sz;
+8010603c:	8b 03                	mov    (%ebx),%eax
+8010603e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106041:	89 02                	mov    %eax,(%edx)
+  np->parent = curproc;
+80106043:	89 5a 1c             	mov    %ebx,0x1c(%edx)
+  *np->tf = *curproc->tf;
+80106046:	8b 73 20             	mov    0x20(%ebx),%esi
+80106049:	8b 7a 20             	mov    0x20(%edx),%edi
+8010604c:	b9 13 00 00 00       	mov    $0x13,%ecx
+80106051:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  np->uid = curproc->uid;
+80106053:	8b 83 d4 00 00 00    	mov    0xd4(%ebx),%eax
+80106059:	89 82 d4 00 00 00    	mov    %eax,0xd4(%edx)
+  np->gid = curproc->gid;
+8010605f:	8b 83 d8 00 00 00    	mov    0xd8(%ebx),%eax
+80106065:	89 82 d8 00 00 00    	mov    %eax,0xd8(%edx)
+  np->tf->eax = 0;
+8010606b:	8b 42 20             	mov    0x20(%edx),%eax
+8010606e:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(i = 0; i < curproc->nofile; i++)
+80106075:	be 00 00 00 00       	mov    $0x0,%esi
+8010607a:	e9 9f 00 00 00       	jmp    8010611e <fork+0x134>
+    ofilefree(np);
+8010607f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80106082:	89 f0                	mov    %esi,%eax
+80106084:	e8 9f fb ff ff       	call   80105c28 <ofilefree>
+    kfree(np->kstack);
+80106089:	83 ec 0c             	sub    $0xc,%esp
+8010608c:	ff 76 08             	push   0x8(%esi)
+8010608f:	e8 dd dc ff ff       	call   80103d71 <kfree>
+    np->kstack = 0;
+80106094:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+    acquire(&ptable.lock);
+8010609b:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+801060a2:	e8 24 19 00 00       	call   801079cb <acquire>
+    freepid(np);
+801060a7:	89 f0                	mov    %esi,%eax
+801060a9:	e8 0a f7 ff ff       	call   801057b8 <freepid>
+    if(stateListRemove(&ptable.list[np->state],np) < 0){
+801060ae:	89 f2                	mov    %esi,%edx
+801060b0:	8b 46 0c             	mov    0xc(%esi),%eax
+801060b3:	8d 04 c5 b8 f9 33 80 	lea    -0x7fcc0648(,%eax,8),%eax
+801060ba:	e8 24 f5 ff ff       	call   801055e3 <stateListRemove>
+801060bf:	83 c4 10             	add    $0x10,%esp
+801060c2:	85 c0                	test   %eax,%eax
+801060c4:	78 48                	js     8010610e <fork+0x124>
+    assertState(np, EMBRYO, __FUNCTION__, __LINE__);
+801060c6:	83 ec 0c             	sub    $0xc,%esp
+801060c9:	68 a6 02 00 00       	push   $0x2a6
+801060ce:	b9 c4 bb 10 80       	mov    $0x8010bbc4,%ecx
+801060d3:	ba 01 00 00 00       	mov    $0x1,%edx
+801060d8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801060db:	89 d8                	mov    %ebx,%eax
+801060dd:	e8 d2 f8 ff ff       	call   801059b4 <assertState>
+    np->state = UNUSED;
+801060e2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    stateListAdd(&ptable.list[np->state], np);
+801060e9:	89 da                	mov    %ebx,%edx
+801060eb:	b8 b8 f9 33 80       	mov    $0x8033f9b8,%eax
+801060f0:	e8 47 f7 ff ff       	call   8010583c <stateListAdd>
+    release(&ptable.lock);
+801060f5:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+801060fc:	e8 2f 19 00 00       	call   80107a30 <release>
+    return -1;
+80106101:	83 c4 10             	add    $0x10,%esp
+80106104:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106109:	e9 10 01 00 00       	jmp    8010621e <fork+0x234>
+      panic("Process could not be removed from EMBRYO list");
+8010610e:	83 ec 0c             	sub    $0xc,%esp
+80106111:	68 00 b8 10 80       	push   $0x8010b800
+80106116:	e8 0b aa ff ff       	call   80100b26 <panic>
+  for(i = 0; i < curproc->nofile; i++)
+8010611b:	83 c6 01             	add    $0x1,%esi
+8010611e:	39 73 34             	cmp    %esi,0x34(%ebx)
+80106121:	7e 27                	jle    8010614a <fork+0x160>
+    if(curproc->ofile[i])
+80106123:	8b 43 30             	mov    0x30(%ebx),%eax
+80106126:	8d 3c b5 00 00 00 00 	lea    0x0(,%esi,4),%edi
+8010612d:	8b 04 b0             	mov    (%eax,%esi,4),%eax
+80106130:	85 c0                	test   %eax,%eax
+80106132:	74 e7                	je     8010611b <fork+0x131>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80106134:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80106137:	03 79 30             	add    0x30(%ecx),%edi
+8010613a:	83 ec 0c             	sub    $0xc,%esp
+8010613d:	50                   	push   %eax
+8010613e:	e8 ee b5 ff ff       	call   80101731 <filedup>
+80106143:	89 07                	mov    %eax,(%edi)
+80106145:	83 c4 10             	add    $0x10,%esp
+80106148:	eb d1                	jmp    8010611b <fork+0x131>
+  np->cwd = idup(curproc->cwd);
+8010614a:	83 ec 0c             	sub    $0xc,%esp
+8010614d:	ff 73 78             	push   0x78(%ebx)
+80106150:	e8 18 cc ff ff       	call   80102d6d <idup>
+80106155:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80106158:	89 46 78             	mov    %eax,0x78(%esi)
+  if(curproc->exe)
+8010615b:	8b 43 7c             	mov    0x7c(%ebx),%eax
+8010615e:	83 c4 10             	add    $0x10,%esp
+80106161:	85 c0                	test   %eax,%eax
+80106163:	0f 84 bd 00 00 00    	je     80106226 <fork+0x23c>
+    np->exe = idup(curproc->exe);
+80106169:	83 ec 0c             	sub    $0xc,%esp
+8010616c:	50                   	push   %eax
+8010616d:	e8 fb cb ff ff       	call   80102d6d <idup>
+80106172:	89 46 7c             	mov    %eax,0x7c(%esi)
+80106175:	83 c4 10             	add    $0x10,%esp
+  np->nseg = curproc->nseg;
+80106178:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+8010617e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106181:	89 87 b0 00 00 00    	mov    %eax,0xb0(%edi)
+  memmove(np->seg, curproc->seg, sizeof(curproc->seg));
+80106187:	8d 93 80 00 00 00    	lea    0x80(%ebx),%edx
+8010618d:	8d 87 80 00 00 00    	lea    0x80(%edi),%eax
+80106193:	83 ec 04             	sub    $0x4,%esp
+80106196:	6a 30                	push   $0x30
+80106198:	52                   	push   %edx
+80106199:	50                   	push   %eax
+8010619a:	e8 50 19 00 00       	call   80107aef <memmove>
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+8010619f:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+801061a5:	8d 87 b4 00 00 00    	lea    0xb4(%edi),%eax
+801061ab:	83 c4 0c             	add    $0xc,%esp
+801061ae:	6a 10                	push   $0x10
+801061b0:	53                   	push   %ebx
+801061b1:	50                   	push   %eax
+801061b2:	e8 2c 1a 00 00       	call   80107be3 <safestrcpy>
+  pid = np->pid;
+801061b7:	8b 5f 10             	mov    0x10(%edi),%ebx
+  acquire(&ptable.lock);
+801061ba:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+801061c1:	e8 05 18 00 00       	call   801079cb <acquire>
+  if(stateListRemove(&ptable.list[np->state], np) < 0){
+801061c6:	89 fa                	mov    %edi,%edx
+801061c8:	8b 47 0c             	mov    0xc(%edi),%eax
+801061cb:	8d 04 c5 b8 f9 33 80 	lea    -0x7fcc0648(,%eax,8),%eax
+801061d2:	e8 0c f4 ff ff       	call   801055e3 <stateListRemove>
+801061d7:	83 c4 10             	add    $0x10,%esp
+801061da:	85 c0                	test   %eax,%eax
+801061dc:	78 57                	js     80106235 <fork+0x24b>
+  assertState(np, EMBRYO, __FUNCTION__, __LINE__);
+801061de:	83 ec 0c             	sub    $0xc,%esp
+801061e1:	68 d1 02 00 00       	push   $0x2d1
+801061e6:	b9 c4 bb 10 80       	mov    $0x8010bbc4,%ecx
+801061eb:	ba 01 00 00 00       	mov    $0x1,%edx
+801061f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801061f3:	89 f8                	mov    %edi,%eax
+801061f5:	e8 ba f7 ff ff       	call   801059b4 <assertState>
+  np->state = RUNNABLE;
+801061fa:	c7 47 0c 03 00 00 00 	movl   $0x3,0xc(%edi)
+  runqAdd(cpuid(), np);
+80106201:	e8 36 fb ff ff       	call   80105d3c <cpuid>
+80106206:	89 fa                	mov    %edi,%edx
+80106208:	e8 ac f6 ff ff       	call   801058b9 <runqAdd>
+  release(&ptable.lock);
+8010620d:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80106214:	e8 17 18 00 00       	call   80107a30 <release>
+  return pid;
+80106219:	89 d8                	mov    %ebx,%eax
+8010621b:	83 c4 10             	add    $0x10,%esp
+}
+8010621e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106221:	5b                   	pop    %ebx
+80106222:	5e                   	pop    %esi
+80106223:	5f                   	pop    %edi
+80106224:	5d                   	pop    %ebp
+80106225:	c3                   	ret
+    np->exe = 0;
+80106226:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106229:	c7 40 7c 00 00 00 00 	movl   $0x0,0x7c(%eax)
+80106230:	e9 43 ff ff ff       	jmp    80106178 <fork+0x18e>
+    panic("Process could not be removed from EMBRYO list");
+80106235:	83 ec 0c             	sub    $0xc,%esp
+80106238:	68 00 b8 10 80       	push   $0x8010b800
+8010623d:	e8 e4 a8 ff ff       	call   80100b26 <panic>
+    return -1;
+80106242:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106247:	eb d5                	jmp    8010621e <fork+0x234>
+
+80106249 <wakeup>:
+{
+80106249:	55                   	push   %ebp
+8010624a:	89 e5                	mov    %esp,%ebp
+8010624c:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);
+8010624f:	68 80 b5 33 80       	push   $0x8033b580
+80106254:	e8 72 17 00 00       	call   801079cb <acquire>
+  wakeup1(chan);
+80106259:	8b 45 08             	mov    0x8(%ebp),%eax
+8010625c:	e8 4a f9 ff ff       	call   80105bab <wakeup1>
+  release(&ptable.lock);
+80106261:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80106268:	e8 c3 17 00 00       	call   80107a30 <release>
+}
+8010626d:	83 c4 10             	add    $0x10,%esp
+80106270:	c9                   	leave
+80106271:	c3                   	ret
+
+80106272 <timertick>:
+// Called on every clock tick, after ticks is advanced to now.
+// Wakes the sleepers whose deadline is now; an empty slot is
+// skipped without taking ptable.lock.
+void
+timertick(uint now)
+{
+80106272:	55                   	push   %ebp
+80106273:	89 e5                	mov    %esp,%ebp
+80106275:	57                   	push   %edi
+80106276:	56                   	push   %esi
+80106277:	53                   	push   %ebx
+80106278:	83 ec 0c             	sub    $0xc,%esp
+8010627b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct proc **slot = &ptable.timer[now % NTIMERSLOT];
+8010627e:	89 f8                	mov    %edi,%eax
+80106280:	0f b6 d8             	movzbl %al,%ebx
+  struct proc *p, *next;
+
+  __sync_synchronize();
+80106283:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(*slot == 0)
+80106288:	83 3c 9d b8 f4 33 80 	cmpl   $0x0,-0x7fcc0b48(,%ebx,4)
+8010628f:	00 
+80106290:	74 55                	je     801062e7 <timertick+0x75>
+    return;
+
+  acquire(&ptable.lock);
+80106292:	83 ec 0c             	sub    $0xc,%esp
+80106295:	68 80 b5 33 80       	push   $0x8033b580
+8010629a:	e8 2c 17 00 00       	call   801079cb <acquire>
+  for(p = *slot; p; p = next){
+8010629f:	8b 1c 9d b8 f4 33 80 	mov    -0x7fcc0b48(,%ebx,4),%ebx
+801062a6:	83 c4 10             	add    $0x10,%esp
+801062a9:	eb 02                	jmp    801062ad <timertick+0x3b>
+{
+801062ab:	89 f3                	mov    %esi,%ebx
+  for(p = *slot; p; p = next){
+801062ad:	85 db                	test   %ebx,%ebx
+801062af:	74 26                	je     801062d7 <timertick+0x65>
+    next = p->tnext;
+801062b1:	8b b3 c8 00 00 00    	mov    0xc8(%ebx),%esi
+    if((int)(p->wakeat - now) <= 0){
+801062b7:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+801062bd:	29 f8                	sub    %edi,%eax
+801062bf:	85 c0                	test   %eax,%eax
+801062c1:	7f e8                	jg     801062ab <timertick+0x39>
+      timerremove(p);
+801062c3:	89 d8                	mov    %ebx,%eax
+801062c5:	e8 39 f5 ff ff       	call   80105803 <timerremove>
+      wakeup1(&p->wakeat);
+801062ca:	8d 83 c4 00 00 00    	lea    0xc4(%ebx),%eax
+801062d0:	e8 d6 f8 ff ff       	call   80105bab <wakeup1>
+801062d5:	eb d4                	jmp    801062ab <timertick+0x39>
+    }
+  }
+  release(&ptable.lock);
+801062d7:	83 ec 0c             	sub    $0xc,%esp
+801062da:	68 80 b5 33 80       	push   $0x8033b580
+801062df:	e8 4c 17 00 00       	call   80107a30 <release>
+801062e4:	83 c4 10             	add    $0x10,%esp
+}
+801062e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801062ea:	5b                   	pop    %ebx
+801062eb:	5e                   	pop    %esi
+801062ec:	5f                   	pop    %edi
+801062ed:	5d                   	pop    %ebp
+801062ee:	c3                   	ret
+
+801062ef <kill>:
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+#ifdef CS333_P4
+int
+kill(int pid)
+{
+801062ef:	55                   	push   %ebp
+801062f0:	89 e5                	mov    %esp,%ebp
+801062f2:	53                   	push   %ebx
+801062f3:	83 ec 10             	sub    $0x10,%esp
+  struct proc *p;
+
+  acquire(&ptable.lock);
+801062f6:	68 80 b5 33 80       	push   $0x8033b580
+801062fb:	e8 cb 16 00 00       	call   801079cb <acquire>
+  p = pidlookup(pid);
+80106300:	8b 45 08             	mov    0x8(%ebp),%eax
+80106303:	e8 e0 f4 ff ff       	call   801057e8 <pidlookup>
+  if(p == NULL || p->state == ZOMBIE){
+80106308:	83 c4 10             	add    $0x10,%esp
+8010630b:	85 c0                	test   %eax,%eax
+8010630d:	74 30                	je     8010633f <kill+0x50>
+8010630f:	89 c3                	mov    %eax,%ebx
+80106311:	8b 40 0c             	mov    0xc(%eax),%eax
+80106314:	83 f8 05             	cmp    $0x5,%eax
+80106317:	74 26                	je     8010633f <kill+0x50>
+    release(&ptable.lock);
+    return -1;
+  }
+  p->killed = 1;
+80106319:	c7 43 2c 01 00 00 00 	movl   $0x1,0x2c(%ebx)
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING){
+80106320:	83 f8 02             	cmp    $0x2,%eax
+80106323:	74 31                	je     80106356 <kill+0x67>
+    }
+    assertState(p, SLEEPING, __FUNCTION__, __LINE__);
+    p->state = RUNNABLE;
+    runqAdd(p->rq, p);
+  }
+  release(&ptable.lock);
+80106325:	83 ec 0c             	sub    $0xc,%esp
+80106328:	68 80 b5 33 80       	push   $0x8033b580
+8010632d:	e8 fe 16 00 00       	call   80107a30 <release>
+  return 0;
+80106332:	83 c4 10             	add    $0x10,%esp
+80106335:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010633a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010633d:	c9                   	leave
+8010633e:	c3                   	ret
+    release(&ptable.lock);
+8010633f:	83 ec 0c             	sub    $0xc,%esp
+80106342:	68 80 b5 33 80       	push   $0x8033b580
+80106347:	e8 e4 16 00 00       	call   80107a30 <release>
+    return -1;
+8010634c:	83 c4 10             	add    $0x10,%esp
+8010634f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106354:	eb e4                	jmp    8010633a <kill+0x4b>
+    if(stateListRemove(sleepList(p->chan), p) < 0){
+80106356:	8b 43 28             	mov    0x28(%ebx),%eax
+80106359:	e8 0e f3 ff ff       	call   8010566c <sleepList>
+8010635e:	89 da                	mov    %ebx,%edx
+80106360:	e8 7e f2 ff ff       	call   801055e3 <stateListRemove>
+80106365:	85 c0                	test   %eax,%eax
+80106367:	78 32                	js     8010639b <kill+0xac>
+    assertState(p, SLEEPING, __FUNCTION__, __LINE__);
+80106369:	83 ec 0c             	sub    $0xc,%esp
+8010636c:	68 d7 06 00 00       	push   $0x6d7
+80106371:	b9 88 bb 10 80       	mov    $0x8010bb88,%ecx
+80106376:	ba 02 00 00 00       	mov    $0x2,%edx
+8010637b:	89 d8                	mov    %ebx,%eax
+8010637d:	e8 32 f6 ff ff       	call   801059b4 <assertState>
+    p->state = RUNNABLE;
+80106382:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+    runqAdd(p->rq, p);
+80106389:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+8010638f:	89 da                	mov    %ebx,%edx
+80106391:	e8 23 f5 ff ff       	call   801058b9 <runqAdd>
+80106396:	83 c4 10             	add    $0x10,%esp
+80106399:	eb 8a                	jmp    80106325 <kill+0x36>
+      panic("Process could not be removed from the SLEEPING list");
+8010639b:	83 ec 0c             	sub    $0xc,%esp
+8010639e:	68 b8 b8 10 80       	push   $0x8010b8b8
+801063a3:	e8 7e a7 ff ff       	call   80100b26 <panic>
+
+801063a8 <getprocs>:
+}
+#endif //CS333_P3
+#ifdef CS333_P2
+int
+getprocs(int max, struct uproc * table)
+{
+801063a8:	55                   	push   %ebp
+801063a9:	89 e5                	mov    %esp,%ebp
+801063ab:	57                   	push   %edi
+801063ac:	56                   	push   %esi
+801063ad:	53                   	push   %ebx
+801063ae:	83 ec 18             	sub    $0x18,%esp
+  char * state;
+  struct proc * p;
+  int i = 0;
+
+  acquire(&ptable.lock);
+801063b1:	68 80 b5 33 80       	push   $0x8033b580
+801063b6:	e8 10 16 00 00       	call   801079cb <acquire>
+
+  for(p= ptable.all; p && i< max; p = p->allnext){
+801063bb:	8b 1d b4 f4 33 80    	mov    0x8033f4b4,%ebx
+801063c1:	83 c4 10             	add    $0x10,%esp
+  int i = 0;
+801063c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  for(p= ptable.all; p && i< max; p = p->allnext){
+801063c9:	eb 61                	jmp    8010642c <getprocs+0x84>
+       continue;	     
+     table[i].pid = p->pid;
+     table[i].uid = p->uid;
+     table[i].gid = p->gid;
+     if(p->parent == NULL)
+       table[i].ppid = p->pid;
+801063cb:	8b 43 10             	mov    0x10(%ebx),%eax
+801063ce:	89 46 0c             	mov    %eax,0xc(%esi)
+     else{
+       table[i].ppid = p->parent->pid;
+     }
+#ifdef CS333_P4
+     table[i].priority = p->priority; 
+801063d1:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+801063d7:	89 46 10             	mov    %eax,0x10(%esi)
+#endif
+     table[i].elapsed_ticks = (ticks - p->start_ticks);
+801063da:	a1 e0 fb 33 80       	mov    0x8033fbe0,%eax
+801063df:	2b 83 d0 00 00 00    	sub    0xd0(%ebx),%eax
+801063e5:	89 46 14             	mov    %eax,0x14(%esi)
+
+     table[i].CPU_total_ticks = p->cpu_ticks_total;
+801063e8:	8b 83 dc 00 00 00    	mov    0xdc(%ebx),%eax
+801063ee:	89 46 18             	mov    %eax,0x18(%esi)
+     state = states[p->state];
+801063f1:	8b 53 0c             	mov    0xc(%ebx),%edx
+     safestrcpy(table[i].state, state, 32);
+801063f4:	8d 46 1c             	lea    0x1c(%esi),%eax
+801063f7:	83 ec 04             	sub    $0x4,%esp
+801063fa:	6a 20                	push   $0x20
+801063fc:	ff 34 95 e4 bb 10 80 	push   -0x7fef441c(,%edx,4)
+80106403:	50                   	push   %eax
+80106404:	e8 da 17 00 00       	call   80107be3 <safestrcpy>
+     table[i].size = p->sz;
+80106409:	8b 03                	mov    (%ebx),%eax
+8010640b:	89 46 3c             	mov    %eax,0x3c(%esi)
+     safestrcpy(table[i].name, p->name, sizeof(p->name));
+8010640e:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+80106414:	83 c6 40             	add    $0x40,%esi
+80106417:	83 c4 0c             	add    $0xc,%esp
+8010641a:	6a 10                	push   $0x10
+8010641c:	50                   	push   %eax
+8010641d:	56                   	push   %esi
+8010641e:	e8 c0 17 00 00       	call   80107be3 <safestrcpy>
+     
+     ++i;
+80106423:	83 c7 01             	add    $0x1,%edi
+80106426:	83 c4 10             	add    $0x10,%esp
+  for(p= ptable.all; p && i< max; p = p->allnext){
+80106429:	8b 5b 18             	mov    0x18(%ebx),%ebx
+8010642c:	85 db                	test   %ebx,%ebx
+8010642e:	0f 95 c0             	setne  %al
+80106431:	3b 7d 08             	cmp    0x8(%ebp),%edi
+80106434:	0f 9c c2             	setl   %dl
+80106437:	84 c0                	test   %al,%al
+80106439:	74 42                	je     8010647d <getprocs+0xd5>
+8010643b:	84 d2                	test   %dl,%dl
+8010643d:	74 3e                	je     8010647d <getprocs+0xd5>
+     if( (p->state == UNUSED || p->state == EMBRYO))
+8010643f:	83 7b 0c 01          	cmpl   $0x1,0xc(%ebx)
+80106443:	76 e4                	jbe    80106429 <getprocs+0x81>
+     table[i].pid = p->pid;
+80106445:	8d 04 7f             	lea    (%edi,%edi,2),%eax
+80106448:	c1 e0 05             	shl    $0x5,%eax
+8010644b:	89 c6                	mov    %eax,%esi
+8010644d:	03 75 0c             	add    0xc(%ebp),%esi
+80106450:	8b 43 10             	mov    0x10(%ebx),%eax
+80106453:	89 06                	mov    %eax,(%esi)
+     table[i].uid = p->uid;
+80106455:	8b 83 d4 00 00 00    	mov    0xd4(%ebx),%eax
+8010645b:	89 46 04             	mov    %eax,0x4(%esi)
+     table[i].gid = p->gid;
+8010645e:	8b 83 d8 00 00 00    	mov    0xd8(%ebx),%eax
+80106464:	89 46 08             	mov    %eax,0x8(%esi)
+     if(p->parent == NULL)
+80106467:	8b 43 1c             	mov    0x1c(%ebx),%eax
+8010646a:	85 c0                	test   %eax,%eax
+8010646c:	0f 84 59 ff ff ff    	je     801063cb <getprocs+0x23>
+       table[i].ppid = p->parent->pid;
+80106472:	8b 40 10             	mov    0x10(%eax),%eax
+80106475:	89 46 0c             	mov    %eax,0xc(%esi)
+80106478:	e9 54 ff ff ff       	jmp    801063d1 <getprocs+0x29>
+    }
+  release(&ptable.lock);
+8010647d:	83 ec 0c             	sub    $0xc,%esp
+80106480:	68 80 b5 33 80       	push   $0x8033b580
+80106485:	e8 a6 15 00 00       	call   80107a30 <release>
+  return i;
+
+}
+8010648a:	89 f8                	mov    %edi,%eax
+8010648c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010648f:	5b                   	pop    %ebx
+80106490:	5e                   	pop    %esi
+80106491:	5f                   	pop    %edi
+80106492:	5d                   	pop    %ebp
+80106493:	c3                   	ret
+
+80106494 <promote>:
+#endif //CS333_P2
+#ifdef CS333_P4
+void
+promote()
+{
+80106494:	55                   	push   %ebp
+80106495:	89 e5                	mov    %esp,%ebp
+80106497:	57                   	push   %edi
+80106498:	56                   	push   %esi
+80106499:	53                   	push   %ebx
+8010649a:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc* p;
+  for(struct runq *q = runq; q < &runq[ncpu]; q++){
+8010649d:	bf 80 b3 33 80       	mov    $0x8033b380,%edi
+801064a2:	eb 6a                	jmp    8010650e <promote+0x7a>
+    for(int i = MAXPRIO-1; i >= 0; --i){
+      p = q->ready[i].head;
+      while(p != NULL){
+        struct proc* temp = p->next;
+801064a4:	8b bb e4 00 00 00    	mov    0xe4(%ebx),%edi
+
+        runqRemove(p);
+801064aa:	89 d8                	mov    %ebx,%eax
+801064ac:	e8 48 f4 ff ff       	call   801058f9 <runqRemove>
+        assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+801064b1:	83 ec 0c             	sub    $0xc,%esp
+801064b4:	68 3f 07 00 00       	push   $0x73f
+801064b9:	b9 80 bb 10 80       	mov    $0x8010bb80,%ecx
+801064be:	ba 03 00 00 00       	mov    $0x3,%edx
+801064c3:	89 d8                	mov    %ebx,%eax
+801064c5:	e8 ea f4 ff ff       	call   801059b4 <assertState>
+        p->priority = p->priority + 1;
+801064ca:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+801064d0:	83 c0 01             	add    $0x1,%eax
+801064d3:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+        p->budget = DEFAULT_BUDGET;
+801064d9:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+801064e0:	01 00 00 
+        runqAdd(p->rq, p);
+801064e3:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+801064e9:	89 da                	mov    %ebx,%edx
+801064eb:	e8 c9 f3 ff ff       	call   801058b9 <runqAdd>
+801064f0:	83 c4 10             	add    $0x10,%esp
+        p = temp;
+801064f3:	89 fb                	mov    %edi,%ebx
+      while(p != NULL){
+801064f5:	85 db                	test   %ebx,%ebx
+801064f7:	75 ab                	jne    801064a4 <promote+0x10>
+    for(int i = MAXPRIO-1; i >= 0; --i){
+801064f9:	83 ee 01             	sub    $0x1,%esi
+801064fc:	85 f6                	test   %esi,%esi
+801064fe:	78 08                	js     80106508 <promote+0x74>
+      p = q->ready[i].head;
+80106500:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106503:	8b 1c f0             	mov    (%eax,%esi,8),%ebx
+      while(p != NULL){
+80106506:	eb ed                	jmp    801064f5 <promote+0x61>
+  for(struct runq *q = runq; q < &runq[ncpu]; q++){
+80106508:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010650b:	83 c7 40             	add    $0x40,%edi
+8010650e:	a1 84 ad 33 80       	mov    0x8033ad84,%eax
+80106513:	c1 e0 06             	shl    $0x6,%eax
+80106516:	05 80 b3 33 80       	add    $0x8033b380,%eax
+8010651b:	39 c7                	cmp    %eax,%edi
+8010651d:	73 0a                	jae    80106529 <promote+0x95>
+    for(int i = MAXPRIO-1; i >= 0; --i){
+8010651f:	be 05 00 00 00       	mov    $0x5,%esi
+80106524:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80106527:	eb d3                	jmp    801064fc <promote+0x68>
+      }
+    }
+  }
+  for(p = ptable.list[RUNNING].head; p != NULL; p = p->next){
+80106529:	a1 d8 f9 33 80       	mov    0x8033f9d8,%eax
+8010652e:	eb 06                	jmp    80106536 <promote+0xa2>
+80106530:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80106536:	85 c0                	test   %eax,%eax
+80106538:	74 20                	je     8010655a <promote+0xc6>
+    if(p->priority != MAXPRIO){
+8010653a:	8b 90 f0 00 00 00    	mov    0xf0(%eax),%edx
+80106540:	83 fa 06             	cmp    $0x6,%edx
+80106543:	74 eb                	je     80106530 <promote+0x9c>
+       p->priority = p->priority + 1;
+80106545:	83 c2 01             	add    $0x1,%edx
+80106548:	89 90 f0 00 00 00    	mov    %edx,0xf0(%eax)
+       p->budget = DEFAULT_BUDGET;
+8010654e:	c7 80 f4 00 00 00 2c 	movl   $0x12c,0xf4(%eax)
+80106555:	01 00 00 
+80106558:	eb d6                	jmp    80106530 <promote+0x9c>
+    }
+  }
+  for(int i = 0; i < NSLEEPQ; i++){
+8010655a:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010655f:	eb 2d                	jmp    8010658e <promote+0xfa>
+    for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
+80106561:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80106567:	85 c0                	test   %eax,%eax
+80106569:	74 20                	je     8010658b <promote+0xf7>
+      if(p->priority != MAXPRIO){
+8010656b:	8b 90 f0 00 00 00    	mov    0xf0(%eax),%edx
+80106571:	83 fa 06             	cmp    $0x6,%edx
+80106574:	74 eb                	je     80106561 <promote+0xcd>
+        p->priority = p->priority + 1;
+80106576:	83 c2 01             	add    $0x1,%edx
+80106579:	89 90 f0 00 00 00    	mov    %edx,0xf0(%eax)
+        p->budget = DEFAULT_BUDGET;
+8010657f:	c7 80 f4 00 00 00 2c 	movl   $0x12c,0xf4(%eax)
+80106586:	01 00 00 
+80106589:	eb d6                	jmp    80106561 <promote+0xcd>
+  for(int i = 0; i < NSLEEPQ; i++){
+8010658b:	83 c1 01             	add    $0x1,%ecx
+8010658e:	83 f9 3c             	cmp    $0x3c,%ecx
+80106591:	7f 09                	jg     8010659c <promote+0x108>
+    for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
+80106593:	8b 04 cd e8 f9 33 80 	mov    -0x7fcc0618(,%ecx,8),%eax
+8010659a:	eb cb                	jmp    80106567 <promote+0xd3>
+      }
+    }
+  }
+}
+8010659c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010659f:	5b                   	pop    %ebx
+801065a0:	5e                   	pop    %esi
+801065a1:	5f                   	pop    %edi
+801065a2:	5d                   	pop    %ebp
+801065a3:	c3                   	ret
+
+801065a4 <scheduler>:
+{
+801065a4:	55                   	push   %ebp
+801065a5:	89 e5                	mov    %esp,%ebp
+801065a7:	57                   	push   %edi
+801065a8:	56                   	push   %esi
+801065a9:	53                   	push   %ebx
+801065aa:	83 ec 0c             	sub    $0xc,%esp
+  struct cpu *c = mycpu();
+801065ad:	e8 2e f7 ff ff       	call   80105ce0 <mycpu>
+801065b2:	89 c7                	mov    %eax,%edi
+  int self = c - cpus;
+801065b4:	89 c6                	mov    %eax,%esi
+801065b6:	81 ee a0 ad 33 80    	sub    $0x8033ada0,%esi
+801065bc:	c1 fe 04             	sar    $0x4,%esi
+801065bf:	69 f6 a3 8b 2e ba    	imul   $0xba2e8ba3,%esi,%esi
+  c->proc = 0;
+801065c5:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+801065cc:	00 00 00 
+801065cf:	eb 3b                	jmp    8010660c <scheduler+0x68>
+    if(rq >= 0 || (MAXPRIO > 0 && ticks >= ptable.PromoteAtTime)){
+801065d1:	a1 d0 fb 33 80       	mov    0x8033fbd0,%eax
+801065d6:	39 05 e0 fb 33 80    	cmp    %eax,0x8033fbe0
+801065dc:	72 2c                	jb     8010660a <scheduler+0x66>
+801065de:	eb 3a                	jmp    8010661a <scheduler+0x76>
+    idle = 1;  // assume idle unless we schedule a process
+801065e0:	bb 01 00 00 00       	mov    $0x1,%ebx
+      if(ticks >= ptable.PromoteAtTime && MAXPRIO > 0){
+801065e5:	a1 d0 fb 33 80       	mov    0x8033fbd0,%eax
+801065ea:	39 05 e0 fb 33 80    	cmp    %eax,0x8033fbe0
+801065f0:	0f 83 d3 00 00 00    	jae    801066c9 <scheduler+0x125>
+      release(&ptable.lock);
+801065f6:	83 ec 0c             	sub    $0xc,%esp
+801065f9:	68 80 b5 33 80       	push   $0x8033b580
+801065fe:	e8 2d 14 00 00       	call   80107a30 <release>
+    if (idle) {
+80106603:	83 c4 10             	add    $0x10,%esp
+80106606:	85 db                	test   %ebx,%ebx
+80106608:	74 02                	je     8010660c <scheduler+0x68>
+  asm volatile("sti");
+8010660a:	fb                   	sti
+
+// hlt() added by Noah Zentzis, Fall 2016.
+static inline void
+hlt()
+{
+  asm volatile("hlt");
+8010660b:	f4                   	hlt
+8010660c:	fb                   	sti
+    rq = runqPick(self);
+8010660d:	89 f0                	mov    %esi,%eax
+8010660f:	e8 21 f1 ff ff       	call   80105735 <runqPick>
+80106614:	89 c3                	mov    %eax,%ebx
+    if(rq >= 0 || (MAXPRIO > 0 && ticks >= ptable.PromoteAtTime)){
+80106616:	85 c0                	test   %eax,%eax
+80106618:	78 b7                	js     801065d1 <scheduler+0x2d>
+      acquire(&ptable.lock);
+8010661a:	83 ec 0c             	sub    $0xc,%esp
+8010661d:	68 80 b5 33 80       	push   $0x8033b580
+80106622:	e8 a4 13 00 00       	call   801079cb <acquire>
+      if(rq >= 0 && (p = runqHead(&runq[rq])) != NULL){
+80106627:	83 c4 10             	add    $0x10,%esp
+8010662a:	85 db                	test   %ebx,%ebx
+8010662c:	78 b2                	js     801065e0 <scheduler+0x3c>
+8010662e:	c1 e3 06             	shl    $0x6,%ebx
+80106631:	8d 83 80 b3 33 80    	lea    -0x7fcc4c80(%ebx),%eax
+80106637:	e8 da f0 ff ff       	call   80105716 <runqHead>
+8010663c:	89 c3                	mov    %eax,%ebx
+8010663e:	85 c0                	test   %eax,%eax
+80106640:	74 7d                	je     801066bf <scheduler+0x11b>
+        c->proc = p;
+80106642:	89 87 ac 00 00 00    	mov    %eax,0xac(%edi)
+        switchuvm(p);
+80106648:	83 ec 0c             	sub    $0xc,%esp
+8010664b:	50                   	push   %eax
+8010664c:	e8 43 41 00 00       	call   8010a794 <switchuvm>
+        runqRemove(p);
+80106651:	89 d8                	mov    %ebx,%eax
+80106653:	e8 a1 f2 ff ff       	call   801058f9 <runqRemove>
+        assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+80106658:	c7 04 24 b3 04 00 00 	movl   $0x4b3,(%esp)
+8010665f:	b9 a0 bb 10 80       	mov    $0x8010bba0,%ecx
+80106664:	ba 03 00 00 00       	mov    $0x3,%edx
+80106669:	89 d8                	mov    %ebx,%eax
+8010666b:	e8 44 f3 ff ff       	call   801059b4 <assertState>
+        p->rq = self;  // a stolen process now belongs to this CPU
+80106670:	89 b3 f8 00 00 00    	mov    %esi,0xf8(%ebx)
+        p->state = RUNNING;
+80106676:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+        stateListAdd(&ptable.list[p->state],p);
+8010667d:	89 da                	mov    %ebx,%edx
+8010667f:	b8 d8 f9 33 80       	mov    $0x8033f9d8,%eax
+80106684:	e8 b3 f1 ff ff       	call   8010583c <stateListAdd>
+        p->cpu_ticks_in = ticks;
+80106689:	a1 e0 fb 33 80       	mov    0x8033fbe0,%eax
+8010668e:	89 83 e0 00 00 00    	mov    %eax,0xe0(%ebx)
+        swtch(&(c->scheduler), p->context);
+80106694:	83 c4 08             	add    $0x8,%esp
+80106697:	ff 73 24             	push   0x24(%ebx)
+8010669a:	8d 47 04             	lea    0x4(%edi),%eax
+8010669d:	50                   	push   %eax
+8010669e:	e8 95 15 00 00       	call   80107c38 <swtch>
+        switchkvm();
+801066a3:	e8 de 40 00 00       	call   8010a786 <switchkvm>
+        c->proc = 0;
+801066a8:	c7 87 ac 00 00 00 00 	movl   $0x0,0xac(%edi)
+801066af:	00 00 00 
+801066b2:	83 c4 10             	add    $0x10,%esp
+        idle = 0;  // not idle this timeslice
+801066b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+801066ba:	e9 26 ff ff ff       	jmp    801065e5 <scheduler+0x41>
+    idle = 1;  // assume idle unless we schedule a process
+801066bf:	bb 01 00 00 00       	mov    $0x1,%ebx
+801066c4:	e9 1c ff ff ff       	jmp    801065e5 <scheduler+0x41>
+        promote();
+801066c9:	e8 c6 fd ff ff       	call   80106494 <promote>
+        ptable.PromoteAtTime = ticks + TICKS_TO_PROMOTE;
+801066ce:	a1 e0 fb 33 80       	mov    0x8033fbe0,%eax
+801066d3:	05 b8 0b 00 00       	add    $0xbb8,%eax
+801066d8:	a3 d0 fb 33 80       	mov    %eax,0x8033fbd0
+801066dd:	e9 14 ff ff ff       	jmp    801065f6 <scheduler+0x52>
+
+801066e2 <getpriority>:
+
+int
+getpriority(int pid)
+{
+801066e2:	55                   	push   %ebp
+801066e3:	89 e5                	mov    %esp,%ebp
+801066e5:	53                   	push   %ebx
+801066e6:	83 ec 10             	sub    $0x10,%esp
+  struct proc * p;
+  int prio = -1;
+
+  acquire(&ptable.lock);
+801066e9:	68 80 b5 33 80       	push   $0x8033b580
+801066ee:	e8 d8 12 00 00       	call   801079cb <acquire>
+  p = pidlookup(pid);
+801066f3:	8b 45 08             	mov    0x8(%ebp),%eax
+801066f6:	e8 ed f0 ff ff       	call   801057e8 <pidlookup>
+  if(p != NULL)
+801066fb:	83 c4 10             	add    $0x10,%esp
+801066fe:	85 c0                	test   %eax,%eax
+80106700:	74 1a                	je     8010671c <getpriority+0x3a>
+    prio = p->priority;
+80106702:	8b 98 f0 00 00 00    	mov    0xf0(%eax),%ebx
+  release(&ptable.lock);
+80106708:	83 ec 0c             	sub    $0xc,%esp
+8010670b:	68 80 b5 33 80       	push   $0x8033b580
+80106710:	e8 1b 13 00 00       	call   80107a30 <release>
+  return prio;
+}
+80106715:	89 d8                	mov    %ebx,%eax
+80106717:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010671a:	c9                   	leave
+8010671b:	c3                   	ret
+  int prio = -1;
+8010671c:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80106721:	eb e5                	jmp    80106708 <getpriority+0x26>
+
+80106723 <FindPID>:
+//only used when ptable lock is being held
+struct proc*
+FindPID(int pid)
+{
+80106723:	55                   	push   %ebp
+80106724:	89 e5                	mov    %esp,%ebp
+80106726:	53                   	push   %ebx
+80106727:	83 ec 04             	sub    $0x4,%esp
+  struct proc * p = pidlookup(pid);
+8010672a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010672d:	e8 b6 f0 ff ff       	call   801057e8 <pidlookup>
+
+  if(p != NULL && (p->state == RUNNING || p->state == SLEEPING ||
+80106732:	85 c0                	test   %eax,%eax
+80106734:	74 1d                	je     80106753 <FindPID+0x30>
+80106736:	8b 50 0c             	mov    0xc(%eax),%edx
+80106739:	83 fa 04             	cmp    $0x4,%edx
+8010673c:	0f 94 c1             	sete   %cl
+8010673f:	83 fa 02             	cmp    $0x2,%edx
+80106742:	0f 94 c3             	sete   %bl
+80106745:	08 d9                	or     %bl,%cl
+80106747:	75 0a                	jne    80106753 <FindPID+0x30>
+80106749:	83 fa 03             	cmp    $0x3,%edx
+8010674c:	74 05                	je     80106753 <FindPID+0x30>
+                   p->state == RUNNABLE))
+    return p;
+  return NULL;
+8010674e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106753:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106756:	c9                   	leave
+80106757:	c3                   	ret
+
+80106758 <setpriority>:
+
+int
+setpriority(int pid, int priority)
+{
+80106758:	55                   	push   %ebp
+80106759:	89 e5                	mov    %esp,%ebp
+8010675b:	56                   	push   %esi
+8010675c:	53                   	push   %ebx
+8010675d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&ptable.lock);
+80106760:	83 ec 0c             	sub    $0xc,%esp
+80106763:	68 80 b5 33 80       	push   $0x8033b580
+80106768:	e8 5e 12 00 00       	call   801079cb <acquire>
+
+  struct proc* p = FindPID(pid);
+8010676d:	83 c4 04             	add    $0x4,%esp
+80106770:	ff 75 08             	push   0x8(%ebp)
+80106773:	e8 ab ff ff ff       	call   80106723 <FindPID>
+80106778:	83 c4 10             	add    $0x10,%esp
+  if(p == NULL){
+8010677b:	85 c0                	test   %eax,%eax
+8010677d:	74 3c                	je     801067bb <setpriority+0x63>
+8010677f:	89 c3                	mov    %eax,%ebx
+    release(&ptable.lock);
+    return -1;
+  }
+  if(p->priority != priority && p->state == RUNNABLE){
+80106781:	39 b0 f0 00 00 00    	cmp    %esi,0xf0(%eax)
+80106787:	74 06                	je     8010678f <setpriority+0x37>
+80106789:	83 78 0c 03          	cmpl   $0x3,0xc(%eax)
+8010678d:	74 43                	je     801067d2 <setpriority+0x7a>
+    runqAdd(p->rq, p);
+    release(&ptable.lock);
+    return 0;
+  }
+  else{
+    p->budget = DEFAULT_BUDGET;
+8010678f:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+80106796:	01 00 00 
+    p->priority = priority;
+80106799:	89 b3 f0 00 00 00    	mov    %esi,0xf0(%ebx)
+    release(&ptable.lock);
+8010679f:	83 ec 0c             	sub    $0xc,%esp
+801067a2:	68 80 b5 33 80       	push   $0x8033b580
+801067a7:	e8 84 12 00 00       	call   80107a30 <release>
+    return 0;
+801067ac:	83 c4 10             	add    $0x10,%esp
+801067af:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  release(&ptable.lock); 
+  return -1;
+
+
+}
+801067b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801067b7:	5b                   	pop    %ebx
+801067b8:	5e                   	pop    %esi
+801067b9:	5d                   	pop    %ebp
+801067ba:	c3                   	ret
+    release(&ptable.lock);
+801067bb:	83 ec 0c             	sub    $0xc,%esp
+801067be:	68 80 b5 33 80       	push   $0x8033b580
+801067c3:	e8 68 12 00 00       	call   80107a30 <release>
+    return -1;
+801067c8:	83 c4 10             	add    $0x10,%esp
+801067cb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801067d0:	eb e2                	jmp    801067b4 <setpriority+0x5c>
+    runqRemove(p);
+801067d2:	e8 22 f1 ff ff       	call   801058f9 <runqRemove>
+    assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+801067d7:	83 ec 0c             	sub    $0xc,%esp
+801067da:	68 7c 07 00 00       	push   $0x77c
+801067df:	b9 74 bb 10 80       	mov    $0x8010bb74,%ecx
+801067e4:	ba 03 00 00 00       	mov    $0x3,%edx
+801067e9:	89 d8                	mov    %ebx,%eax
+801067eb:	e8 c4 f1 ff ff       	call   801059b4 <assertState>
+    p->budget = DEFAULT_BUDGET;
+801067f0:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+801067f7:	01 00 00 
+    p->priority = priority;
+801067fa:	89 b3 f0 00 00 00    	mov    %esi,0xf0(%ebx)
+    runqAdd(p->rq, p);
+80106800:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80106806:	89 da                	mov    %ebx,%edx
+80106808:	e8 ac f0 ff ff       	call   801058b9 <runqAdd>
+    release(&ptable.lock);
+8010680d:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80106814:	e8 17 12 00 00       	call   80107a30 <release>
+    return 0;
+80106819:	83 c4 10             	add    $0x10,%esp
+8010681c:	b8 00 00 00 00       	mov    $0x0,%eax
+80106821:	eb 91                	jmp    801067b4 <setpriority+0x5c>
+
+80106823 <schedDemote>:
+//Called under sched only and while lock is held
+void
+schedDemote(int pid, int priority){
+80106823:	55                   	push   %ebp
+80106824:	89 e5                	mov    %esp,%ebp
+80106826:	56                   	push   %esi
+80106827:	53                   	push   %ebx
+80106828:	8b 75 0c             	mov    0xc(%ebp),%esi
+  
+  struct proc * p = FindPID(pid);
+8010682b:	83 ec 0c             	sub    $0xc,%esp
+8010682e:	ff 75 08             	push   0x8(%ebp)
+80106831:	e8 ed fe ff ff       	call   80106723 <FindPID>
+80106836:	83 c4 10             	add    $0x10,%esp
+  if(p == NULL){
+80106839:	85 c0                	test   %eax,%eax
+8010683b:	74 20                	je     8010685d <schedDemote+0x3a>
+8010683d:	89 c3                	mov    %eax,%ebx
+    return ;
+  }
+  if(p->priority != priority && p->state == RUNNABLE){
+8010683f:	39 b0 f0 00 00 00    	cmp    %esi,0xf0(%eax)
+80106845:	74 06                	je     8010684d <schedDemote+0x2a>
+80106847:	83 78 0c 03          	cmpl   $0x3,0xc(%eax)
+8010684b:	74 17                	je     80106864 <schedDemote+0x41>
+    p->priority = priority;
+    runqAdd(p->rq, p);
+    return ;
+  }
+  else{
+    p->budget = DEFAULT_BUDGET;
+8010684d:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+80106854:	01 00 00 
+    p->priority = priority;
+80106857:	89 b3 f0 00 00 00    	mov    %esi,0xf0(%ebx)
+    return ;
+  }
+  return;
+}
+8010685d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106860:	5b                   	pop    %ebx
+80106861:	5e                   	pop    %esi
+80106862:	5d                   	pop    %ebp
+80106863:	c3                   	ret
+    runqRemove(p);
+80106864:	e8 90 f0 ff ff       	call   801058f9 <runqRemove>
+    assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+80106869:	83 ec 0c             	sub    $0xc,%esp
+8010686c:	68 98 07 00 00       	push   $0x798
+80106871:	b9 68 bb 10 80       	mov    $0x8010bb68,%ecx
+80106876:	ba 03 00 00 00       	mov    $0x3,%edx
+8010687b:	89 d8                	mov    %ebx,%eax
+8010687d:	e8 32 f1 ff ff       	call   801059b4 <assertState>
+    p->budget = DEFAULT_BUDGET;
+80106882:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+80106889:	01 00 00 
+    p->priority = priority;
+8010688c:	89 b3 f0 00 00 00    	mov    %esi,0xf0(%ebx)
+    runqAdd(p->rq, p);
+80106892:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80106898:	89 da                	mov    %ebx,%edx
+8010689a:	e8 1a f0 ff ff       	call   801058b9 <runqAdd>
+    return ;
+8010689f:	83 c4 10             	add    $0x10,%esp
+801068a2:	eb b9                	jmp    8010685d <schedDemote+0x3a>
+
+801068a4 <sched>:
+{
+801068a4:	55                   	push   %ebp
+801068a5:	89 e5                	mov    %esp,%ebp
+801068a7:	56                   	push   %esi
+801068a8:	53                   	push   %ebx
+  struct proc *p = myproc();
+801068a9:	e8 a9 f4 ff ff       	call   80105d57 <myproc>
+801068ae:	89 c3                	mov    %eax,%ebx
+  if(!holding(&ptable.lock))
+801068b0:	83 ec 0c             	sub    $0xc,%esp
+801068b3:	68 80 b5 33 80       	push   $0x8033b580
+801068b8:	e8 cf 10 00 00       	call   8010798c <holding>
+801068bd:	83 c4 10             	add    $0x10,%esp
+801068c0:	85 c0                	test   %eax,%eax
+801068c2:	0f 84 8d 00 00 00    	je     80106955 <sched+0xb1>
+  if(mycpu()->ncli != 1)
+801068c8:	e8 13 f4 ff ff       	call   80105ce0 <mycpu>
+801068cd:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+801068d4:	0f 85 88 00 00 00    	jne    80106962 <sched+0xbe>
+  if(p->state == RUNNING)
+801068da:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+801068de:	0f 84 8b 00 00 00    	je     8010696f <sched+0xcb>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801068e4:	9c                   	pushf
+801068e5:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801068e6:	f6 c4 02             	test   $0x2,%ah
+801068e9:	0f 85 8d 00 00 00    	jne    8010697c <sched+0xd8>
+  intena = mycpu()->intena;
+801068ef:	e8 ec f3 ff ff       	call   80105ce0 <mycpu>
+801068f4:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  p->cpu_ticks_total += (ticks - p->cpu_ticks_in);
+801068fa:	8b 15 e0 fb 33 80    	mov    0x8033fbe0,%edx
+80106900:	8b 83 e0 00 00 00    	mov    0xe0(%ebx),%eax
+80106906:	89 d1                	mov    %edx,%ecx
+80106908:	29 c1                	sub    %eax,%ecx
+8010690a:	01 8b dc 00 00 00    	add    %ecx,0xdc(%ebx)
+  p->budget = p->budget - (ticks - p->cpu_ticks_in);
+80106910:	29 d0                	sub    %edx,%eax
+80106912:	03 83 f4 00 00 00    	add    0xf4(%ebx),%eax
+80106918:	89 83 f4 00 00 00    	mov    %eax,0xf4(%ebx)
+  if(p->priority != 0 && p->budget <= 0)
+8010691e:	8b 93 f0 00 00 00    	mov    0xf0(%ebx),%edx
+80106924:	85 d2                	test   %edx,%edx
+80106926:	74 04                	je     8010692c <sched+0x88>
+80106928:	85 c0                	test   %eax,%eax
+8010692a:	7e 5d                	jle    80106989 <sched+0xe5>
+  swtch(&p->context, mycpu()->scheduler);
+8010692c:	e8 af f3 ff ff       	call   80105ce0 <mycpu>
+80106931:	83 ec 08             	sub    $0x8,%esp
+80106934:	ff 70 04             	push   0x4(%eax)
+80106937:	83 c3 24             	add    $0x24,%ebx
+8010693a:	53                   	push   %ebx
+8010693b:	e8 f8 12 00 00       	call   80107c38 <swtch>
+  mycpu()->intena = intena;
+80106940:	e8 9b f3 ff ff       	call   80105ce0 <mycpu>
+80106945:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+8010694b:	83 c4 10             	add    $0x10,%esp
+8010694e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106951:	5b                   	pop    %ebx
+80106952:	5e                   	pop    %esi
+80106953:	5d                   	pop    %ebp
+80106954:	c3                   	ret
+    panic("sched ptable.lock");
+80106955:	83 ec 0c             	sub    $0xc,%esp
+80106958:	68 fc b9 10 80       	push   $0x8010b9fc
+8010695d:	e8 c4 a1 ff ff       	call   80100b26 <panic>
+    panic("sched locks");
+80106962:	83 ec 0c             	sub    $0xc,%esp
+80106965:	68 0e ba 10 80       	push   $0x8010ba0e
+8010696a:	e8 b7 a1 ff ff       	call   80100b26 <panic>
+    panic("sched running");
+8010696f:	83 ec 0c             	sub    $0xc,%esp
+80106972:	68 1a ba 10 80       	push   $0x8010ba1a
+80106977:	e8 aa a1 ff ff       	call   80100b26 <panic>
+    panic("sched interruptible");
+8010697c:	83 ec 0c             	sub    $0xc,%esp
+8010697f:	68 28 ba 10 80       	push   $0x8010ba28
+80106984:	e8 9d a1 ff ff       	call   80100b26 <panic>
+    schedDemote(p->pid, p->priority -1);
+80106989:	83 ea 01             	sub    $0x1,%edx
+8010698c:	8b 43 10             	mov    0x10(%ebx),%eax
+8010698f:	83 ec 08             	sub    $0x8,%esp
+80106992:	52                   	push   %edx
+80106993:	50                   	push   %eax
+80106994:	e8 8a fe ff ff       	call   80106823 <schedDemote>
+80106999:	83 c4 10             	add    $0x10,%esp
+8010699c:	eb 8e                	jmp    8010692c <sched+0x88>
+
+8010699e <exit>:
+{
+8010699e:	55                   	push   %ebp
+8010699f:	89 e5                	mov    %esp,%ebp
+801069a1:	57                   	push   %edi
+801069a2:	56                   	push   %esi
+801069a3:	53                   	push   %ebx
+801069a4:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+801069a7:	e8 ab f3 ff ff       	call   80105d57 <myproc>
+  if(curproc == initproc)
+801069ac:	39 05 40 b3 33 80    	cmp    %eax,0x8033b340
+801069b2:	74 09                	je     801069bd <exit+0x1f>
+801069b4:	89 c3                	mov    %eax,%ebx
+  for(fd = 0; fd < curproc->nofile; fd++){
+801069b6:	be 00 00 00 00       	mov    $0x0,%esi
+801069bb:	eb 10                	jmp    801069cd <exit+0x2f>
+    panic("init exiting");
+801069bd:	83 ec 0c             	sub    $0xc,%esp
+801069c0:	68 3c ba 10 80       	push   $0x8010ba3c
+801069c5:	e8 5c a1 ff ff       	call   80100b26 <panic>
+  for(fd = 0; fd < curproc->nofile; fd++){
+801069ca:	83 c6 01             	add    $0x1,%esi
+801069cd:	39 73 34             	cmp    %esi,0x34(%ebx)
+801069d0:	7e 28                	jle    801069fa <exit+0x5c>
+    if(curproc->ofile[fd]){
+801069d2:	8b 43 30             	mov    0x30(%ebx),%eax
+801069d5:	8d 3c b5 00 00 00 00 	lea    0x0(,%esi,4),%edi
+801069dc:	8b 04 b0             	mov    (%eax,%esi,4),%eax
+801069df:	85 c0                	test   %eax,%eax
+801069e1:	74 e7                	je     801069ca <exit+0x2c>
+      fileclose(curproc->ofile[fd]);
+801069e3:	83 ec 0c             	sub    $0xc,%esp
+801069e6:	50                   	push   %eax
+801069e7:	e8 8a ad ff ff       	call   80101776 <fileclose>
+      curproc->ofile[fd] = 0;
+801069ec:	03 7b 30             	add    0x30(%ebx),%edi
+801069ef:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+801069f5:	83 c4 10             	add    $0x10,%esp
+801069f8:	eb d0                	jmp    801069ca <exit+0x2c>
+  ofilefree(curproc);
+801069fa:	89 d8                	mov    %ebx,%eax
+801069fc:	e8 27 f2 ff ff       	call   80105c28 <ofilefree>
+  begin_op();
+80106a01:	e8 f1 dc ff ff       	call   801046f7 <begin_op>
+  iput(curproc->cwd);
+80106a06:	83 ec 0c             	sub    $0xc,%esp
+80106a09:	ff 73 78             	push   0x78(%ebx)
+80106a0c:	e8 ad c4 ff ff       	call   80102ebe <iput>
+  if(curproc->exe)
+80106a11:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80106a14:	83 c4 10             	add    $0x10,%esp
+80106a17:	85 c0                	test   %eax,%eax
+80106a19:	74 0c                	je     80106a27 <exit+0x89>
+    iput(curproc->exe);
+80106a1b:	83 ec 0c             	sub    $0xc,%esp
+80106a1e:	50                   	push   %eax
+80106a1f:	e8 9a c4 ff ff       	call   80102ebe <iput>
+80106a24:	83 c4 10             	add    $0x10,%esp
+  end_op();
+80106a27:	e8 45 dd ff ff       	call   80104771 <end_op>
+  curproc->cwd = 0;
+80106a2c:	c7 43 78 00 00 00 00 	movl   $0x0,0x78(%ebx)
+  curproc->exe = 0;
+80106a33:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  acquire(&ptable.lock);
+80106a3a:	83 ec 0c             	sub    $0xc,%esp
+80106a3d:	68 80 b5 33 80       	push   $0x8033b580
+80106a42:	e8 84 0f 00 00       	call   801079cb <acquire>
+  wakeup1(curproc->parent);
+80106a47:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80106a4a:	e8 5c f1 ff ff       	call   80105bab <wakeup1>
+  for(p= ptable.list[RUNNING].head; p!= NULL; p = p->next){
+80106a4f:	a1 d8 f9 33 80       	mov    0x8033f9d8,%eax
+80106a54:	83 c4 10             	add    $0x10,%esp
+80106a57:	eb 06                	jmp    80106a5f <exit+0xc1>
+80106a59:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80106a5f:	85 c0                	test   %eax,%eax
+80106a61:	74 10                	je     80106a73 <exit+0xd5>
+    if(p->parent == curproc){
+80106a63:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80106a66:	75 f1                	jne    80106a59 <exit+0xbb>
+      p->parent = initproc;
+80106a68:	8b 15 40 b3 33 80    	mov    0x8033b340,%edx
+80106a6e:	89 50 1c             	mov    %edx,0x1c(%eax)
+80106a71:	eb e6                	jmp    80106a59 <exit+0xbb>
+  for(struct runq *q = runq; q < &runq[ncpu]; q++){
+80106a73:	be 80 b3 33 80       	mov    $0x8033b380,%esi
+80106a78:	eb 29                	jmp    80106aa3 <exit+0x105>
+      for(p= q->ready[i].head; p!= NULL; p = p->next){
+80106a7a:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80106a80:	85 c0                	test   %eax,%eax
+80106a82:	74 10                	je     80106a94 <exit+0xf6>
+        if(p->parent == curproc){
+80106a84:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80106a87:	75 f1                	jne    80106a7a <exit+0xdc>
+          p->parent = initproc;
+80106a89:	8b 15 40 b3 33 80    	mov    0x8033b340,%edx
+80106a8f:	89 50 1c             	mov    %edx,0x1c(%eax)
+80106a92:	eb e6                	jmp    80106a7a <exit+0xdc>
+    for(int i = MAXPRIO; i >= 0; --i){
+80106a94:	83 e9 01             	sub    $0x1,%ecx
+80106a97:	85 c9                	test   %ecx,%ecx
+80106a99:	78 05                	js     80106aa0 <exit+0x102>
+      for(p= q->ready[i].head; p!= NULL; p = p->next){
+80106a9b:	8b 04 ce             	mov    (%esi,%ecx,8),%eax
+80106a9e:	eb e0                	jmp    80106a80 <exit+0xe2>
+  for(struct runq *q = runq; q < &runq[ncpu]; q++){
+80106aa0:	83 c6 40             	add    $0x40,%esi
+80106aa3:	a1 84 ad 33 80       	mov    0x8033ad84,%eax
+80106aa8:	c1 e0 06             	shl    $0x6,%eax
+80106aab:	05 80 b3 33 80       	add    $0x8033b380,%eax
+80106ab0:	39 c6                	cmp    %eax,%esi
+80106ab2:	73 07                	jae    80106abb <exit+0x11d>
+    for(int i = MAXPRIO; i >= 0; --i){
+80106ab4:	b9 06 00 00 00       	mov    $0x6,%ecx
+80106ab9:	eb dc                	jmp    80106a97 <exit+0xf9>
+  for(int i = 0; i < NSLEEPQ; i++){
+80106abb:	b9 00 00 00 00       	mov    $0x0,%ecx
+80106ac0:	eb 1d                	jmp    80106adf <exit+0x141>
+    for(p= ptable.sleepq[i].head; p!= NULL; p = p->next){
+80106ac2:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80106ac8:	85 c0                	test   %eax,%eax
+80106aca:	74 10                	je     80106adc <exit+0x13e>
+      if(p->parent == curproc){
+80106acc:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80106acf:	75 f1                	jne    80106ac2 <exit+0x124>
+        p->parent = initproc;
+80106ad1:	8b 15 40 b3 33 80    	mov    0x8033b340,%edx
+80106ad7:	89 50 1c             	mov    %edx,0x1c(%eax)
+80106ada:	eb e6                	jmp    80106ac2 <exit+0x124>
+  for(int i = 0; i < NSLEEPQ; i++){
+80106adc:	83 c1 01             	add    $0x1,%ecx
+80106adf:	83 f9 3c             	cmp    $0x3c,%ecx
+80106ae2:	7f 09                	jg     80106aed <exit+0x14f>
+    for(p= ptable.sleepq[i].head; p!= NULL; p = p->next){
+80106ae4:	8b 04 cd e8 f9 33 80 	mov    -0x7fcc0618(,%ecx,8),%eax
+80106aeb:	eb db                	jmp    80106ac8 <exit+0x12a>
+  for(p= ptable.list[EMBRYO].head; p!= NULL; p = p->next){
+80106aed:	a1 c0 f9 33 80       	mov    0x8033f9c0,%eax
+80106af2:	eb 06                	jmp    80106afa <exit+0x15c>
+80106af4:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80106afa:	85 c0                	test   %eax,%eax
+80106afc:	74 10                	je     80106b0e <exit+0x170>
+    if(p->parent == curproc){
+80106afe:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80106b01:	75 f1                	jne    80106af4 <exit+0x156>
+      p->parent = initproc;
+80106b03:	8b 15 40 b3 33 80    	mov    0x8033b340,%edx
+80106b09:	89 50 1c             	mov    %edx,0x1c(%eax)
+80106b0c:	eb e6                	jmp    80106af4 <exit+0x156>
+  for(p = ptable.list[ZOMBIE].head; p != NULL; p = p->next){
+80106b0e:	8b 35 e0 f9 33 80    	mov    0x8033f9e0,%esi
+80106b14:	eb 06                	jmp    80106b1c <exit+0x17e>
+80106b16:	8b b6 e4 00 00 00    	mov    0xe4(%esi),%esi
+80106b1c:	85 f6                	test   %esi,%esi
+80106b1e:	74 14                	je     80106b34 <exit+0x196>
+    if(p->parent == curproc){
+80106b20:	39 5e 1c             	cmp    %ebx,0x1c(%esi)
+80106b23:	75 f1                	jne    80106b16 <exit+0x178>
+      p->parent = initproc;
+80106b25:	a1 40 b3 33 80       	mov    0x8033b340,%eax
+80106b2a:	89 46 1c             	mov    %eax,0x1c(%esi)
+      wakeup1(initproc);
+80106b2d:	e8 79 f0 ff ff       	call   80105bab <wakeup1>
+80106b32:	eb e2                	jmp    80106b16 <exit+0x178>
+  if(stateListRemove(&ptable.list[curproc->state], curproc) < 0){
+80106b34:	8b 43 0c             	mov    0xc(%ebx),%eax
+80106b37:	8d 04 c5 b8 f9 33 80 	lea    -0x7fcc0648(,%eax,8),%eax
+80106b3e:	89 da                	mov    %ebx,%edx
+80106b40:	e8 9e ea ff ff       	call   801055e3 <stateListRemove>
+80106b45:	85 c0                	test   %eax,%eax
+80106b47:	78 43                	js     80106b8c <exit+0x1ee>
+  assertState(curproc, RUNNING, __FUNCTION__, __LINE__);
+80106b49:	83 ec 0c             	sub    $0xc,%esp
+80106b4c:	68 37 03 00 00       	push   $0x337
+80106b51:	b9 bc bb 10 80       	mov    $0x8010bbbc,%ecx
+80106b56:	ba 04 00 00 00       	mov    $0x4,%edx
+80106b5b:	89 d8                	mov    %ebx,%eax
+80106b5d:	e8 52 ee ff ff       	call   801059b4 <assertState>
+  curproc->state = ZOMBIE;
+80106b62:	c7 43 0c 05 00 00 00 	movl   $0x5,0xc(%ebx)
+  stateListAdd(&ptable.list[curproc->state], curproc);
+80106b69:	89 da                	mov    %ebx,%edx
+80106b6b:	b8 e0 f9 33 80       	mov    $0x8033f9e0,%eax
+80106b70:	e8 c7 ec ff ff       	call   8010583c <stateListAdd>
+  curproc->sz = 0;
+80106b75:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  sched();
+80106b7b:	e8 24 fd ff ff       	call   801068a4 <sched>
+  panic("zombie exit");
+80106b80:	c7 04 24 49 ba 10 80 	movl   $0x8010ba49,(%esp)
+80106b87:	e8 9a 9f ff ff       	call   80100b26 <panic>
+    panic("Process could not be removed from RUNNING list");
+80106b8c:	83 ec 0c             	sub    $0xc,%esp
+80106b8f:	68 ec b8 10 80       	push   $0x8010b8ec
+80106b94:	e8 8d 9f ff ff       	call   80100b26 <panic>
+
+80106b99 <yield>:
+{
+80106b99:	55                   	push   %ebp
+80106b9a:	89 e5                	mov    %esp,%ebp
+80106b9c:	53                   	push   %ebx
+80106b9d:	83 ec 04             	sub    $0x4,%esp
+  struct proc *curproc = myproc();
+80106ba0:	e8 b2 f1 ff ff       	call   80105d57 <myproc>
+80106ba5:	89 c3                	mov    %eax,%ebx
+  acquire(&ptable.lock);  //DOC: yieldlock
+80106ba7:	83 ec 0c             	sub    $0xc,%esp
+80106baa:	68 80 b5 33 80       	push   $0x8033b580
+80106baf:	e8 17 0e 00 00       	call   801079cb <acquire>
+  if(stateListRemove(&ptable.list[curproc->state], curproc) <0){
+80106bb4:	8b 43 0c             	mov    0xc(%ebx),%eax
+80106bb7:	8d 04 c5 b8 f9 33 80 	lea    -0x7fcc0648(,%eax,8),%eax
+80106bbe:	89 da                	mov    %ebx,%edx
+80106bc0:	e8 1e ea ff ff       	call   801055e3 <stateListRemove>
+80106bc5:	83 c4 10             	add    $0x10,%esp
+80106bc8:	85 c0                	test   %eax,%eax
+80106bca:	78 65                	js     80106c31 <yield+0x98>
+  assertState(curproc, RUNNING, __FUNCTION__, __LINE__);
+80106bcc:	83 ec 0c             	sub    $0xc,%esp
+80106bcf:	68 8a 05 00 00       	push   $0x58a
+80106bd4:	b9 98 bb 10 80       	mov    $0x8010bb98,%ecx
+80106bd9:	ba 04 00 00 00       	mov    $0x4,%edx
+80106bde:	89 d8                	mov    %ebx,%eax
+80106be0:	e8 cf ed ff ff       	call   801059b4 <assertState>
+  curproc->state = RUNNABLE;
+80106be5:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  curproc->budget = curproc->budget - (ticks - curproc->cpu_ticks_in);
+80106bec:	8b 83 e0 00 00 00    	mov    0xe0(%ebx),%eax
+80106bf2:	2b 05 e0 fb 33 80    	sub    0x8033fbe0,%eax
+80106bf8:	03 83 f4 00 00 00    	add    0xf4(%ebx),%eax
+80106bfe:	89 83 f4 00 00 00    	mov    %eax,0xf4(%ebx)
+  if(curproc->budget <= 0){
+80106c04:	83 c4 10             	add    $0x10,%esp
+80106c07:	85 c0                	test   %eax,%eax
+80106c09:	7e 33                	jle    80106c3e <yield+0xa5>
+  runqAdd(cpuid(), curproc);
+80106c0b:	e8 2c f1 ff ff       	call   80105d3c <cpuid>
+80106c10:	89 da                	mov    %ebx,%edx
+80106c12:	e8 a2 ec ff ff       	call   801058b9 <runqAdd>
+  sched();
+80106c17:	e8 88 fc ff ff       	call   801068a4 <sched>
+  release(&ptable.lock);
+80106c1c:	83 ec 0c             	sub    $0xc,%esp
+80106c1f:	68 80 b5 33 80       	push   $0x8033b580
+80106c24:	e8 07 0e 00 00       	call   80107a30 <release>
+}
+80106c29:	83 c4 10             	add    $0x10,%esp
+80106c2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106c2f:	c9                   	leave
+80106c30:	c3                   	ret
+    panic("Process could not be removed from the RUNNING list");	  
+80106c31:	83 ec 0c             	sub    $0xc,%esp
+80106c34:	68 1c b9 10 80       	push   $0x8010b91c
+80106c39:	e8 e8 9e ff ff       	call   80100b26 <panic>
+    if(curproc->priority != 0)
+80106c3e:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+80106c44:	85 c0                	test   %eax,%eax
+80106c46:	74 09                	je     80106c51 <yield+0xb8>
+      curproc->priority = curproc->priority - 1;
+80106c48:	83 e8 01             	sub    $0x1,%eax
+80106c4b:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+    curproc->budget = DEFAULT_BUDGET;
+80106c51:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+80106c58:	01 00 00 
+80106c5b:	eb ae                	jmp    80106c0b <yield+0x72>
+
+80106c5d <sleep>:
+{
+80106c5d:	55                   	push   %ebp
+80106c5e:	89 e5                	mov    %esp,%ebp
+80106c60:	57                   	push   %edi
+80106c61:	56                   	push   %esi
+80106c62:	53                   	push   %ebx
+80106c63:	83 ec 0c             	sub    $0xc,%esp
+80106c66:	8b 7d 08             	mov    0x8(%ebp),%edi
+80106c69:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct proc *p = myproc();
+80106c6c:	e8 e6 f0 ff ff       	call   80105d57 <myproc>
+  if(p == 0)
+80106c71:	85 c0                	test   %eax,%eax
+80106c73:	0f 84 cf 00 00 00    	je     80106d48 <sleep+0xeb>
+80106c79:	89 c3                	mov    %eax,%ebx
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+80106c7b:	81 fe 80 b5 33 80    	cmp    $0x8033b580,%esi
+80106c81:	74 20                	je     80106ca3 <sleep+0x46>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+80106c83:	83 ec 0c             	sub    $0xc,%esp
+80106c86:	68 80 b5 33 80       	push   $0x8033b580
+80106c8b:	e8 3b 0d 00 00       	call   801079cb <acquire>
+    if (lk) release(lk);
+80106c90:	83 c4 10             	add    $0x10,%esp
+80106c93:	85 f6                	test   %esi,%esi
+80106c95:	74 0c                	je     80106ca3 <sleep+0x46>
+80106c97:	83 ec 0c             	sub    $0xc,%esp
+80106c9a:	56                   	push   %esi
+80106c9b:	e8 90 0d 00 00       	call   80107a30 <release>
+80106ca0:	83 c4 10             	add    $0x10,%esp
+  p->chan = chan;
+80106ca3:	89 7b 28             	mov    %edi,0x28(%ebx)
+  if(stateListRemove(&ptable.list[p->state],p) < 0){
+80106ca6:	8b 43 0c             	mov    0xc(%ebx),%eax
+80106ca9:	8d 04 c5 b8 f9 33 80 	lea    -0x7fcc0648(,%eax,8),%eax
+80106cb0:	89 da                	mov    %ebx,%edx
+80106cb2:	e8 2c e9 ff ff       	call   801055e3 <stateListRemove>
+80106cb7:	85 c0                	test   %eax,%eax
+80106cb9:	0f 88 96 00 00 00    	js     80106d55 <sleep+0xf8>
+  assertState(p, RUNNING, __FUNCTION__, __LINE__);
+80106cbf:	83 ec 0c             	sub    $0xc,%esp
+80106cc2:	68 e3 05 00 00       	push   $0x5e3
+80106cc7:	b9 90 bb 10 80       	mov    $0x8010bb90,%ecx
+80106ccc:	ba 04 00 00 00       	mov    $0x4,%edx
+80106cd1:	89 d8                	mov    %ebx,%eax
+80106cd3:	e8 dc ec ff ff       	call   801059b4 <assertState>
+  p->budget = p->budget - (ticks - p->cpu_ticks_in);
+80106cd8:	8b 83 e0 00 00 00    	mov    0xe0(%ebx),%eax
+80106cde:	2b 05 e0 fb 33 80    	sub    0x8033fbe0,%eax
+80106ce4:	03 83 f4 00 00 00    	add    0xf4(%ebx),%eax
+80106cea:	89 83 f4 00 00 00    	mov    %eax,0xf4(%ebx)
+  if(p->budget <= 0){
+80106cf0:	83 c4 10             	add    $0x10,%esp
+80106cf3:	85 c0                	test   %eax,%eax
+80106cf5:	7e 6b                	jle    80106d62 <sleep+0x105>
+  p->state = SLEEPING;
+80106cf7:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  stateListAdd(sleepList(chan), p);
+80106cfe:	89 f8                	mov    %edi,%eax
+80106d00:	e8 67 e9 ff ff       	call   8010566c <sleepList>
+80106d05:	89 da                	mov    %ebx,%edx
+80106d07:	e8 30 eb ff ff       	call   8010583c <stateListAdd>
+  sched();
+80106d0c:	e8 93 fb ff ff       	call   801068a4 <sched>
+  p->chan = 0;
+80106d11:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%ebx)
+  if(lk != &ptable.lock){  //DOC: sleeplock2
+80106d18:	81 fe 80 b5 33 80    	cmp    $0x8033b580,%esi
+80106d1e:	74 20                	je     80106d40 <sleep+0xe3>
+    release(&ptable.lock);
+80106d20:	83 ec 0c             	sub    $0xc,%esp
+80106d23:	68 80 b5 33 80       	push   $0x8033b580
+80106d28:	e8 03 0d 00 00       	call   80107a30 <release>
+    if (lk) acquire(lk);
+80106d2d:	83 c4 10             	add    $0x10,%esp
+80106d30:	85 f6                	test   %esi,%esi
+80106d32:	74 0c                	je     80106d40 <sleep+0xe3>
+80106d34:	83 ec 0c             	sub    $0xc,%esp
+80106d37:	56                   	push   %esi
+80106d38:	e8 8e 0c 00 00       	call   801079cb <acquire>
+80106d3d:	83 c4 10             	add    $0x10,%esp
+}
+80106d40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106d43:	5b                   	pop    %ebx
+80106d44:	5e                   	pop    %esi
+80106d45:	5f                   	pop    %edi
+80106d46:	5d                   	pop    %ebp
+80106d47:	c3                   	ret
+    panic("sleep");
+80106d48:	83 ec 0c             	sub    $0xc,%esp
+80106d4b:	68 55 ba 10 80       	push   $0x8010ba55
+80106d50:	e8 d1 9d ff ff       	call   80100b26 <panic>
+    panic("Process could not be removed from the RUNNING list");
+80106d55:	83 ec 0c             	sub    $0xc,%esp
+80106d58:	68 1c b9 10 80       	push   $0x8010b91c
+80106d5d:	e8 c4 9d ff ff       	call   80100b26 <panic>
+    if(p->priority != 0)
+80106d62:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+80106d68:	85 c0                	test   %eax,%eax
+80106d6a:	74 09                	je     80106d75 <sleep+0x118>
+      p->priority = p->priority - 1;
+80106d6c:	83 e8 01             	sub    $0x1,%eax
+80106d6f:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+    p->budget = DEFAULT_BUDGET;
+80106d75:	c7 83 f4 00 00 00 2c 	movl   $0x12c,0xf4(%ebx)
+80106d7c:	01 00 00 
+80106d7f:	e9 73 ff ff ff       	jmp    80106cf7 <sleep+0x9a>
+
+80106d84 <wait>:
+{
+80106d84:	55                   	push   %ebp
+80106d85:	89 e5                	mov    %esp,%ebp
+80106d87:	56                   	push   %esi
+80106d88:	53                   	push   %ebx
+  struct proc *curproc = myproc();
+80106d89:	e8 c9 ef ff ff       	call   80105d57 <myproc>
+80106d8e:	89 c3                	mov    %eax,%ebx
+  acquire(&ptable.lock);
+80106d90:	83 ec 0c             	sub    $0xc,%esp
+80106d93:	68 80 b5 33 80       	push   $0x8033b580
+80106d98:	e8 2e 0c 00 00       	call   801079cb <acquire>
+80106d9d:	83 c4 10             	add    $0x10,%esp
+80106da0:	e9 84 01 00 00       	jmp    80106f29 <wait+0x1a5>
+        pid = p->pid;
+80106da5:	8b 5e 10             	mov    0x10(%esi),%ebx
+        kfree(p->kstack);
+80106da8:	83 ec 0c             	sub    $0xc,%esp
+80106dab:	ff 76 08             	push   0x8(%esi)
+80106dae:	e8 be cf ff ff       	call   80103d71 <kfree>
+        p->kstack = 0;
+80106db3:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+        freevm(p->pgdir);
+80106dba:	83 c4 04             	add    $0x4,%esp
+80106dbd:	ff 76 04             	push   0x4(%esi)
+80106dc0:	e8 aa 3d 00 00       	call   8010ab6f <freevm>
+        freepid(p);
+80106dc5:	89 f0                	mov    %esi,%eax
+80106dc7:	e8 ec e9 ff ff       	call   801057b8 <freepid>
+        p->parent = 0;
+80106dcc:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+        p->name[0] = 0;
+80106dd3:	c6 86 b4 00 00 00 00 	movb   $0x0,0xb4(%esi)
+        p->killed = 0;
+80106dda:	c7 46 2c 00 00 00 00 	movl   $0x0,0x2c(%esi)
+	if(stateListRemove(&ptable.list[p->state], p) < 0){
+80106de1:	8b 46 0c             	mov    0xc(%esi),%eax
+80106de4:	8d 04 c5 b8 f9 33 80 	lea    -0x7fcc0648(,%eax,8),%eax
+80106deb:	89 f2                	mov    %esi,%edx
+80106ded:	e8 f1 e7 ff ff       	call   801055e3 <stateListRemove>
+80106df2:	83 c4 10             	add    $0x10,%esp
+80106df5:	85 c0                	test   %eax,%eax
+80106df7:	78 44                	js     80106e3d <wait+0xb9>
+	assertState(p, ZOMBIE, __FUNCTION__, __LINE__);
+80106df9:	83 ec 0c             	sub    $0xc,%esp
+80106dfc:	68 e0 03 00 00       	push   $0x3e0
+80106e01:	b9 ac bb 10 80       	mov    $0x8010bbac,%ecx
+80106e06:	ba 05 00 00 00       	mov    $0x5,%edx
+80106e0b:	89 f0                	mov    %esi,%eax
+80106e0d:	e8 a2 eb ff ff       	call   801059b4 <assertState>
+        p->state = UNUSED;
+80106e12:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+	stateListAdd(&ptable.list[p->state], p);
+80106e19:	89 f2                	mov    %esi,%edx
+80106e1b:	b8 b8 f9 33 80       	mov    $0x8033f9b8,%eax
+80106e20:	e8 17 ea ff ff       	call   8010583c <stateListAdd>
+        release(&ptable.lock);
+80106e25:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80106e2c:	e8 ff 0b 00 00       	call   80107a30 <release>
+        return pid;
+80106e31:	89 d8                	mov    %ebx,%eax
+80106e33:	83 c4 10             	add    $0x10,%esp
+}
+80106e36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106e39:	5b                   	pop    %ebx
+80106e3a:	5e                   	pop    %esi
+80106e3b:	5d                   	pop    %ebp
+80106e3c:	c3                   	ret
+	  panic("Process could not be removed from ZOMBIE list");
+80106e3d:	83 ec 0c             	sub    $0xc,%esp
+80106e40:	68 50 b9 10 80       	push   $0x8010b950
+80106e45:	e8 dc 9c ff ff       	call   80100b26 <panic>
+    for(p = ptable.list[ZOMBIE].head; p != NULL; p = p->next){
+80106e4a:	8b b6 e4 00 00 00    	mov    0xe4(%esi),%esi
+80106e50:	85 f6                	test   %esi,%esi
+80106e52:	74 16                	je     80106e6a <wait+0xe6>
+      if(p->parent != curproc)
+80106e54:	39 5e 1c             	cmp    %ebx,0x1c(%esi)
+80106e57:	75 f1                	jne    80106e4a <wait+0xc6>
+      if(p->state == ZOMBIE){
+80106e59:	83 7e 0c 05          	cmpl   $0x5,0xc(%esi)
+80106e5d:	0f 84 42 ff ff ff    	je     80106da5 <wait+0x21>
+      havekids = 1;
+80106e63:	b9 01 00 00 00       	mov    $0x1,%ecx
+80106e68:	eb e0                	jmp    80106e4a <wait+0xc6>
+    for(struct runq *q = runq; q < &runq[ncpu]; q++){
+80106e6a:	be 80 b3 33 80       	mov    $0x8033b380,%esi
+80106e6f:	eb 23                	jmp    80106e94 <wait+0x110>
+            havekids = 1;
+80106e71:	b9 01 00 00 00       	mov    $0x1,%ecx
+      for(int i = MAXPRIO; i >= 0; --i){
+80106e76:	83 ea 01             	sub    $0x1,%edx
+80106e79:	85 d2                	test   %edx,%edx
+80106e7b:	78 14                	js     80106e91 <wait+0x10d>
+        for(p = q->ready[i].head; p != NULL; p = p->next){
+80106e7d:	8b 04 d6             	mov    (%esi,%edx,8),%eax
+80106e80:	85 c0                	test   %eax,%eax
+80106e82:	74 f2                	je     80106e76 <wait+0xf2>
+          if(p->parent == curproc){
+80106e84:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80106e87:	74 e8                	je     80106e71 <wait+0xed>
+        for(p = q->ready[i].head; p != NULL; p = p->next){
+80106e89:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80106e8f:	eb ef                	jmp    80106e80 <wait+0xfc>
+    for(struct runq *q = runq; q < &runq[ncpu]; q++){
+80106e91:	83 c6 40             	add    $0x40,%esi
+80106e94:	a1 84 ad 33 80       	mov    0x8033ad84,%eax
+80106e99:	c1 e0 06             	shl    $0x6,%eax
+80106e9c:	05 80 b3 33 80       	add    $0x8033b380,%eax
+80106ea1:	39 c6                	cmp    %eax,%esi
+80106ea3:	73 07                	jae    80106eac <wait+0x128>
+      for(int i = MAXPRIO; i >= 0; --i){
+80106ea5:	ba 06 00 00 00       	mov    $0x6,%edx
+80106eaa:	eb cd                	jmp    80106e79 <wait+0xf5>
+    for(int i = 0; i < NSLEEPQ; i++){
+80106eac:	ba 00 00 00 00       	mov    $0x0,%edx
+80106eb1:	eb 08                	jmp    80106ebb <wait+0x137>
+          havekids = 1;
+80106eb3:	b9 01 00 00 00       	mov    $0x1,%ecx
+    for(int i = 0; i < NSLEEPQ; i++){
+80106eb8:	83 c2 01             	add    $0x1,%edx
+80106ebb:	83 fa 3c             	cmp    $0x3c,%edx
+80106ebe:	7f 18                	jg     80106ed8 <wait+0x154>
+      for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
+80106ec0:	8b 04 d5 e8 f9 33 80 	mov    -0x7fcc0618(,%edx,8),%eax
+80106ec7:	85 c0                	test   %eax,%eax
+80106ec9:	74 ed                	je     80106eb8 <wait+0x134>
+        if(p->parent == curproc){
+80106ecb:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80106ece:	74 e3                	je     80106eb3 <wait+0x12f>
+      for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
+80106ed0:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80106ed6:	eb ef                	jmp    80106ec7 <wait+0x143>
+    for(p = ptable.list[EMBRYO].head; p != NULL; p = p->next){
+80106ed8:	a1 c0 f9 33 80       	mov    0x8033f9c0,%eax
+80106edd:	85 c0                	test   %eax,%eax
+80106edf:	74 12                	je     80106ef3 <wait+0x16f>
+      if(p->parent == curproc){
+80106ee1:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80106ee4:	74 08                	je     80106eee <wait+0x16a>
+    for(p = ptable.list[EMBRYO].head; p != NULL; p = p->next){
+80106ee6:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80106eec:	eb ef                	jmp    80106edd <wait+0x159>
+        havekids = 1;
+80106eee:	b9 01 00 00 00       	mov    $0x1,%ecx
+    for(p = ptable.list[RUNNING].head; p != NULL; p = p->next){
+80106ef3:	a1 d8 f9 33 80       	mov    0x8033f9d8,%eax
+80106ef8:	eb 06                	jmp    80106f00 <wait+0x17c>
+80106efa:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+80106f00:	85 c0                	test   %eax,%eax
+80106f02:	74 0a                	je     80106f0e <wait+0x18a>
+      if(p->parent == curproc){
+80106f04:	39 58 1c             	cmp    %ebx,0x1c(%eax)
+80106f07:	75 f1                	jne    80106efa <wait+0x176>
+        havekids = 1;
+80106f09:	b9 01 00 00 00       	mov    $0x1,%ecx
+    if(!havekids || curproc->killed){
+80106f0e:	85 c9                	test   %ecx,%ecx
+80106f10:	74 27                	je     80106f39 <wait+0x1b5>
+80106f12:	83 7b 2c 00          	cmpl   $0x0,0x2c(%ebx)
+80106f16:	75 21                	jne    80106f39 <wait+0x1b5>
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+80106f18:	83 ec 08             	sub    $0x8,%esp
+80106f1b:	68 80 b5 33 80       	push   $0x8033b580
+80106f20:	53                   	push   %ebx
+80106f21:	e8 37 fd ff ff       	call   80106c5d <sleep>
+    havekids = 0;
+80106f26:	83 c4 10             	add    $0x10,%esp
+    for(p = ptable.list[ZOMBIE].head; p != NULL; p = p->next){
+80106f29:	8b 35 e0 f9 33 80    	mov    0x8033f9e0,%esi
+    havekids = 0;
+80106f2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for(p = ptable.list[ZOMBIE].head; p != NULL; p = p->next){
+80106f34:	e9 17 ff ff ff       	jmp    80106e50 <wait+0xcc>
+      release(&ptable.lock);
+80106f39:	83 ec 0c             	sub    $0xc,%esp
+80106f3c:	68 80 b5 33 80       	push   $0x8033b580
+80106f41:	e8 ea 0a 00 00       	call   80107a30 <release>
+      return -1;
+80106f46:	83 c4 10             	add    $0x10,%esp
+80106f49:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106f4e:	e9 e3 fe ff ff       	jmp    80106e36 <wait+0xb2>
+
+80106f53 <sleepticks>:
+{
+80106f53:	55                   	push   %ebp
+80106f54:	89 e5                	mov    %esp,%ebp
+80106f56:	56                   	push   %esi
+80106f57:	53                   	push   %ebx
+  struct proc *p = myproc();
+80106f58:	e8 fa ed ff ff       	call   80105d57 <myproc>
+80106f5d:	89 c3                	mov    %eax,%ebx
+  acquire(&ptable.lock);
+80106f5f:	83 ec 0c             	sub    $0xc,%esp
+80106f62:	68 80 b5 33 80       	push   $0x8033b580
+80106f67:	e8 5f 0a 00 00       	call   801079cb <acquire>
+  p->wakeat = ticks + n;
+80106f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+80106f6f:	03 05 e0 fb 33 80    	add    0x8033fbe0,%eax
+80106f75:	89 83 c4 00 00 00    	mov    %eax,0xc4(%ebx)
+  while((int)(p->wakeat - ticks) > 0){
+80106f7b:	83 c4 10             	add    $0x10,%esp
+80106f7e:	eb 27                	jmp    80106fa7 <sleepticks+0x54>
+      release(&ptable.lock);
+80106f80:	83 ec 0c             	sub    $0xc,%esp
+80106f83:	68 80 b5 33 80       	push   $0x8033b580
+80106f88:	e8 a3 0a 00 00       	call   80107a30 <release>
+      return -1;
+80106f8d:	83 c4 10             	add    $0x10,%esp
+80106f90:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106f95:	e9 bc 00 00 00       	jmp    80107056 <sleepticks+0x103>
+    if(p->tprev)
+80106f9a:	83 bb cc 00 00 00 00 	cmpl   $0x0,0xcc(%ebx)
+80106fa1:	0f 85 8e 00 00 00    	jne    80107035 <sleepticks+0xe2>
+  while((int)(p->wakeat - ticks) > 0){
+80106fa7:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+80106fad:	89 c2                	mov    %eax,%edx
+80106faf:	2b 15 e0 fb 33 80    	sub    0x8033fbe0,%edx
+80106fb5:	85 d2                	test   %edx,%edx
+80106fb7:	0f 8e 84 00 00 00    	jle    80107041 <sleepticks+0xee>
+    if(p->killed){
+80106fbd:	83 7b 2c 00          	cmpl   $0x0,0x2c(%ebx)
+80106fc1:	75 bd                	jne    80106f80 <sleepticks+0x2d>
+    slot = &ptable.timer[p->wakeat % NTIMERSLOT];
+80106fc3:	0f b6 c0             	movzbl %al,%eax
+80106fc6:	8d 90 cc 0f 00 00    	lea    0xfcc(%eax),%edx
+80106fcc:	8d 0c 85 b8 f4 33 80 	lea    -0x7fcc0b48(,%eax,4),%ecx
+    p->tnext = *slot;
+80106fd3:	8b 34 95 88 b5 33 80 	mov    -0x7fcc4a78(,%edx,4),%esi
+80106fda:	89 b3 c8 00 00 00    	mov    %esi,0xc8(%ebx)
+    p->tprev = slot;
+80106fe0:	89 8b cc 00 00 00    	mov    %ecx,0xcc(%ebx)
+    if(*slot)
+80106fe6:	8b 14 95 88 b5 33 80 	mov    -0x7fcc4a78(,%edx,4),%edx
+80106fed:	85 d2                	test   %edx,%edx
+80106fef:	74 0c                	je     80106ffd <sleepticks+0xaa>
+      (*slot)->tprev = &p->tnext;
+80106ff1:	8d 8b c8 00 00 00    	lea    0xc8(%ebx),%ecx
+80106ff7:	89 8a cc 00 00 00    	mov    %ecx,0xcc(%edx)
+    *slot = p;
+80106ffd:	89 1c 85 b8 f4 33 80 	mov    %ebx,-0x7fcc0b48(,%eax,4)
+    __sync_synchronize();
+80107004:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    if((int)(p->wakeat - ticks) > 0)
+80107009:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+8010700f:	2b 05 e0 fb 33 80    	sub    0x8033fbe0,%eax
+80107015:	85 c0                	test   %eax,%eax
+80107017:	7e 81                	jle    80106f9a <sleepticks+0x47>
+      sleep(&p->wakeat, &ptable.lock);
+80107019:	8d 83 c4 00 00 00    	lea    0xc4(%ebx),%eax
+8010701f:	83 ec 08             	sub    $0x8,%esp
+80107022:	68 80 b5 33 80       	push   $0x8033b580
+80107027:	50                   	push   %eax
+80107028:	e8 30 fc ff ff       	call   80106c5d <sleep>
+8010702d:	83 c4 10             	add    $0x10,%esp
+80107030:	e9 65 ff ff ff       	jmp    80106f9a <sleepticks+0x47>
+      timerremove(p);
+80107035:	89 d8                	mov    %ebx,%eax
+80107037:	e8 c7 e7 ff ff       	call   80105803 <timerremove>
+8010703c:	e9 66 ff ff ff       	jmp    80106fa7 <sleepticks+0x54>
+  release(&ptable.lock);
+80107041:	83 ec 0c             	sub    $0xc,%esp
+80107044:	68 80 b5 33 80       	push   $0x8033b580
+80107049:	e8 e2 09 00 00       	call   80107a30 <release>
+  return 0;
+8010704e:	83 c4 10             	add    $0x10,%esp
+80107051:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107056:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107059:	5b                   	pop    %ebx
+8010705a:	5e                   	pop    %esi
+8010705b:	5d                   	pop    %ebp
+8010705c:	c3                   	ret
+
+8010705d <procdumpP1>:
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+#ifdef CS333_P1
+void
+procdumpP1(struct proc * p, char *state)
+{
+8010705d:	55                   	push   %ebp
+8010705e:	89 e5                	mov    %esp,%ebp
+80107060:	57                   	push   %edi
+80107061:	56                   	push   %esi
+80107062:	53                   	push   %ebx
+80107063:	83 ec 0c             	sub    $0xc,%esp
+80107066:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int elapsed = (ticks - p->start_ticks) / 1000;
+80107069:	8b 0d e0 fb 33 80    	mov    0x8033fbe0,%ecx
+8010706f:	2b 8b d0 00 00 00    	sub    0xd0(%ebx),%ecx
+80107075:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+8010707a:	89 c8                	mov    %ecx,%eax
+8010707c:	f7 e2                	mul    %edx
+8010707e:	c1 ea 06             	shr    $0x6,%edx
+  int elapsed_dec = (ticks - p->start_ticks) % 1000;
+80107081:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+80107087:	89 ce                	mov    %ecx,%esi
+80107089:	29 c6                	sub    %eax,%esi
+8010708b:	89 f7                	mov    %esi,%edi
+  //cprintf("%d\t%s\t\t%d.%d\t%s\t%d\t", p->pid, p->name, elapsed,elapsed_dec, state, p->sz);
+  cprintf("%d\t%s\t     %d.", p->pid, p->name, elapsed);
+8010708d:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+80107093:	52                   	push   %edx
+80107094:	50                   	push   %eax
+80107095:	ff 73 10             	push   0x10(%ebx)
+80107098:	68 5b ba 10 80       	push   $0x8010ba5b
+8010709d:	e8 45 9d ff ff       	call   80100de7 <cprintf>
+  if(elapsed_dec < 100 && elapsed_dec > 9)
+801070a2:	8d 46 f6             	lea    -0xa(%esi),%eax
+801070a5:	83 c4 10             	add    $0x10,%esp
+801070a8:	83 f8 59             	cmp    $0x59,%eax
+801070ab:	76 27                	jbe    801070d4 <procdumpP1+0x77>
+    cprintf("0%d", elapsed_dec);
+  if(elapsed_dec < 10)
+801070ad:	83 ff 09             	cmp    $0x9,%edi
+801070b0:	7e 35                	jle    801070e7 <procdumpP1+0x8a>
+    cprintf("00%d", elapsed_dec);
+  if(elapsed_dec >=100)
+801070b2:	83 ff 63             	cmp    $0x63,%edi
+801070b5:	7f 43                	jg     801070fa <procdumpP1+0x9d>
+    cprintf("%d", elapsed_dec);
+  cprintf("\t%s\t%d\t", state, p->sz);	  
+801070b7:	83 ec 04             	sub    $0x4,%esp
+801070ba:	ff 33                	push   (%ebx)
+801070bc:	ff 75 0c             	push   0xc(%ebp)
+801070bf:	68 6f ba 10 80       	push   $0x8010ba6f
+801070c4:	e8 1e 9d ff ff       	call   80100de7 <cprintf>
+
+}
+801070c9:	83 c4 10             	add    $0x10,%esp
+801070cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801070cf:	5b                   	pop    %ebx
+801070d0:	5e                   	pop    %esi
+801070d1:	5f                   	pop    %edi
+801070d2:	5d                   	pop    %ebp
+801070d3:	c3                   	ret
+    cprintf("0%d", elapsed_dec);
+801070d4:	83 ec 08             	sub    $0x8,%esp
+801070d7:	56                   	push   %esi
+801070d8:	68 6b ba 10 80       	push   $0x8010ba6b
+801070dd:	e8 05 9d ff ff       	call   80100de7 <cprintf>
+801070e2:	83 c4 10             	add    $0x10,%esp
+801070e5:	eb c6                	jmp    801070ad <procdumpP1+0x50>
+    cprintf("00%d", elapsed_dec);
+801070e7:	83 ec 08             	sub    $0x8,%esp
+801070ea:	57                   	push   %edi
+801070eb:	68 6a ba 10 80       	push   $0x8010ba6a
+801070f0:	e8 f2 9c ff ff       	call   80100de7 <cprintf>
+801070f5:	83 c4 10             	add    $0x10,%esp
+801070f8:	eb b8                	jmp    801070b2 <procdumpP1+0x55>
+    cprintf("%d", elapsed_dec);
+801070fa:	83 ec 08             	sub    $0x8,%esp
+801070fd:	57                   	push   %edi
+801070fe:	68 6c ba 10 80       	push   $0x8010ba6c
+80107103:	e8 df 9c ff ff       	call   80100de7 <cprintf>
+80107108:	83 c4 10             	add    $0x10,%esp
+8010710b:	eb aa                	jmp    801070b7 <procdumpP1+0x5a>
+
+8010710d <procdumpP2>:
+#endif //CS333_P1
+#ifdef CS333_P2
+ 
+void
+procdumpP2(struct proc * p, char *state)
+{
+8010710d:	55                   	push   %ebp
+8010710e:	89 e5                	mov    %esp,%ebp
+80107110:	57                   	push   %edi
+80107111:	56                   	push   %esi
+80107112:	53                   	push   %ebx
+80107113:	83 ec 18             	sub    $0x18,%esp
+80107116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+   cprintf("%d\t%s\t     %d\t        %d\t", p->pid, p->name,p->uid, p->gid);
+80107119:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+8010711f:	ff b3 d8 00 00 00    	push   0xd8(%ebx)
+80107125:	ff b3 d4 00 00 00    	push   0xd4(%ebx)
+8010712b:	50                   	push   %eax
+8010712c:	ff 73 10             	push   0x10(%ebx)
+8010712f:	68 77 ba 10 80       	push   $0x8010ba77
+80107134:	e8 ae 9c ff ff       	call   80100de7 <cprintf>
+   if(p->parent != NULL)
+80107139:	8b 43 1c             	mov    0x1c(%ebx),%eax
+8010713c:	83 c4 20             	add    $0x20,%esp
+8010713f:	85 c0                	test   %eax,%eax
+80107141:	0f 84 d0 00 00 00    	je     80107217 <procdumpP2+0x10a>
+     cprintf("%d\t", p->parent->pid);
+80107147:	83 ec 08             	sub    $0x8,%esp
+8010714a:	ff 70 10             	push   0x10(%eax)
+8010714d:	68 73 ba 10 80       	push   $0x8010ba73
+80107152:	e8 90 9c ff ff       	call   80100de7 <cprintf>
+80107157:	83 c4 10             	add    $0x10,%esp
+   else
+     cprintf("%d\t", p->pid);
+
+   int elapsed = (ticks - p->start_ticks) / 1000;
+8010715a:	8b 0d e0 fb 33 80    	mov    0x8033fbe0,%ecx
+80107160:	2b 8b d0 00 00 00    	sub    0xd0(%ebx),%ecx
+80107166:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+8010716b:	89 c8                	mov    %ecx,%eax
+8010716d:	f7 e2                	mul    %edx
+8010716f:	c1 ea 06             	shr    $0x6,%edx
+   int elapsed_dec = (ticks - p->start_ticks) % 1000;
+80107172:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+80107178:	29 c1                	sub    %eax,%ecx
+8010717a:	89 ce                	mov    %ecx,%esi
+8010717c:	89 cf                	mov    %ecx,%edi
+
+   cprintf("%d.", elapsed);
+8010717e:	83 ec 08             	sub    $0x8,%esp
+80107181:	52                   	push   %edx
+80107182:	68 66 ba 10 80       	push   $0x8010ba66
+80107187:	e8 5b 9c ff ff       	call   80100de7 <cprintf>
+   if(elapsed_dec < 100 && elapsed_dec > 9)
+8010718c:	8d 46 f6             	lea    -0xa(%esi),%eax
+8010718f:	83 c4 10             	add    $0x10,%esp
+80107192:	83 f8 59             	cmp    $0x59,%eax
+80107195:	0f 86 94 00 00 00    	jbe    8010722f <procdumpP2+0x122>
+      cprintf("0%d\t", elapsed_dec);
+   if(elapsed_dec < 10)
+8010719b:	83 ff 09             	cmp    $0x9,%edi
+8010719e:	0f 8e a1 00 00 00    	jle    80107245 <procdumpP2+0x138>
+      cprintf("00%d\t", elapsed_dec);
+   if(elapsed_dec >=100)
+801071a4:	83 ff 63             	cmp    $0x63,%edi
+801071a7:	0f 8f ae 00 00 00    	jg     8010725b <procdumpP2+0x14e>
+     cprintf("%d\t", elapsed_dec);
+   int cpuelapsed = p->cpu_ticks_total /1000;
+801071ad:	8b 8b dc 00 00 00    	mov    0xdc(%ebx),%ecx
+801071b3:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+801071b8:	89 c8                	mov    %ecx,%eax
+801071ba:	f7 e2                	mul    %edx
+801071bc:	c1 ea 06             	shr    $0x6,%edx
+   int cpuelapsed_dec = p->cpu_ticks_total %1000;  
+801071bf:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+801071c5:	89 ce                	mov    %ecx,%esi
+801071c7:	29 c6                	sub    %eax,%esi
+801071c9:	89 f7                	mov    %esi,%edi
+   cprintf("%d.", cpuelapsed);
+801071cb:	83 ec 08             	sub    $0x8,%esp
+801071ce:	52                   	push   %edx
+801071cf:	68 66 ba 10 80       	push   $0x8010ba66
+801071d4:	e8 0e 9c ff ff       	call   80100de7 <cprintf>
+   if(cpuelapsed_dec < 100 && cpuelapsed_dec > 9)
+801071d9:	8d 46 f6             	lea    -0xa(%esi),%eax
+801071dc:	83 c4 10             	add    $0x10,%esp
+801071df:	83 f8 59             	cmp    $0x59,%eax
+801071e2:	0f 86 89 00 00 00    	jbe    80107271 <procdumpP2+0x164>
+        cprintf("0%d", cpuelapsed_dec);
+   if(cpuelapsed_dec < 10)
+801071e8:	83 ff 09             	cmp    $0x9,%edi
+801071eb:	0f 8e 96 00 00 00    	jle    80107287 <procdumpP2+0x17a>
+      cprintf("00%d", cpuelapsed_dec);
+   if(cpuelapsed_dec >=100)
+801071f1:	83 ff 63             	cmp    $0x63,%edi
+801071f4:	0f 8f a3 00 00 00    	jg     8010729d <procdumpP2+0x190>
+     cprintf("%d", cpuelapsed_dec);
+   cprintf("   %s\t%d   ", state, p->sz);
+801071fa:	83 ec 04             	sub    $0x4,%esp
+801071fd:	ff 33                	push   (%ebx)
+801071ff:	ff 75 0c             	push   0xc(%ebp)
+80107202:	68 97 ba 10 80       	push   $0x8010ba97
+80107207:	e8 db 9b ff ff       	call   80100de7 <cprintf>
+     
+
+
+
+
+}
+8010720c:	83 c4 10             	add    $0x10,%esp
+8010720f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107212:	5b                   	pop    %ebx
+80107213:	5e                   	pop    %esi
+80107214:	5f                   	pop    %edi
+80107215:	5d                   	pop    %ebp
+80107216:	c3                   	ret
+     cprintf("%d\t", p->pid);
+80107217:	83 ec 08             	sub    $0x8,%esp
+8010721a:	ff 73 10             	push   0x10(%ebx)
+8010721d:	68 73 ba 10 80       	push   $0x8010ba73
+80107222:	e8 c0 9b ff ff       	call   80100de7 <cprintf>
+80107227:	83 c4 10             	add    $0x10,%esp
+8010722a:	e9 2b ff ff ff       	jmp    8010715a <procdumpP2+0x4d>
+      cprintf("0%d\t", elapsed_dec);
+8010722f:	83 ec 08             	sub    $0x8,%esp
+80107232:	56                   	push   %esi
+80107233:	68 92 ba 10 80       	push   $0x8010ba92
+80107238:	e8 aa 9b ff ff       	call   80100de7 <cprintf>
+8010723d:	83 c4 10             	add    $0x10,%esp
+80107240:	e9 56 ff ff ff       	jmp    8010719b <procdumpP2+0x8e>
+      cprintf("00%d\t", elapsed_dec);
+80107245:	83 ec 08             	sub    $0x8,%esp
+80107248:	57                   	push   %edi
+80107249:	68 91 ba 10 80       	push   $0x8010ba91
+8010724e:	e8 94 9b ff ff       	call   80100de7 <cprintf>
+80107253:	83 c4 10             	add    $0x10,%esp
+80107256:	e9 49 ff ff ff       	jmp    801071a4 <procdumpP2+0x97>
+     cprintf("%d\t", elapsed_dec);
+8010725b:	83 ec 08             	sub    $0x8,%esp
+8010725e:	57                   	push   %edi
+8010725f:	68 73 ba 10 80       	push   $0x8010ba73
+80107264:	e8 7e 9b ff ff       	call   80100de7 <cprintf>
+80107269:	83 c4 10             	add    $0x10,%esp
+8010726c:	e9 3c ff ff ff       	jmp    801071ad <procdumpP2+0xa0>
+        cprintf("0%d", cpuelapsed_dec);
+80107271:	83 ec 08             	sub    $0x8,%esp
+80107274:	56                   	push   %esi
+80107275:	68 6b ba 10 80       	push   $0x8010ba6b
+8010727a:	e8 68 9b ff ff       	call   80100de7 <cprintf>
+8010727f:	83 c4 10             	add    $0x10,%esp
+80107282:	e9 61 ff ff ff       	jmp    801071e8 <procdumpP2+0xdb>
+      cprintf("00%d", cpuelapsed_dec);
+80107287:	83 ec 08             	sub    $0x8,%esp
+8010728a:	57                   	push   %edi
+8010728b:	68 6a ba 10 80       	push   $0x8010ba6a
+80107290:	e8 52 9b ff ff       	call   80100de7 <cprintf>
+80107295:	83 c4 10             	add    $0x10,%esp
+80107298:	e9 54 ff ff ff       	jmp    801071f1 <procdumpP2+0xe4>
+     cprintf("%d", cpuelapsed_dec);
+8010729d:	83 ec 08             	sub    $0x8,%esp
+801072a0:	57                   	push   %edi
+801072a1:	68 6c ba 10 80       	push   $0x8010ba6c
+801072a6:	e8 3c 9b ff ff       	call   80100de7 <cprintf>
+801072ab:	83 c4 10             	add    $0x10,%esp
+801072ae:	e9 47 ff ff ff       	jmp    801071fa <procdumpP2+0xed>
+
+801072b3 <procdumpP3>:
+#endif //CS333_P2
+#ifdef CS333_P3
+void
+procdumpP3(struct proc * p, char * state)
+{
+801072b3:	55                   	push   %ebp
+801072b4:	89 e5                	mov    %esp,%ebp
+801072b6:	57                   	push   %edi
+801072b7:	56                   	push   %esi
+801072b8:	53                   	push   %ebx
+801072b9:	83 ec 18             	sub    $0x18,%esp
+801072bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+   cprintf("%d\t%s\t     %d\t        %d\t", p->pid, p->name,p->uid, p->gid);
+801072bf:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+801072c5:	ff b3 d8 00 00 00    	push   0xd8(%ebx)
+801072cb:	ff b3 d4 00 00 00    	push   0xd4(%ebx)
+801072d1:	50                   	push   %eax
+801072d2:	ff 73 10             	push   0x10(%ebx)
+801072d5:	68 77 ba 10 80       	push   $0x8010ba77
+801072da:	e8 08 9b ff ff       	call   80100de7 <cprintf>
+   if(p->parent != NULL)
+801072df:	8b 43 1c             	mov    0x1c(%ebx),%eax
+801072e2:	83 c4 20             	add    $0x20,%esp
+801072e5:	85 c0                	test   %eax,%eax
+801072e7:	0f 84 e3 00 00 00    	je     801073d0 <procdumpP3+0x11d>
+     cprintf("%d\t", p->parent->pid);
+801072ed:	83 ec 08             	sub    $0x8,%esp
+801072f0:	ff 70 10             	push   0x10(%eax)
+801072f3:	68 73 ba 10 80       	push   $0x8010ba73
+801072f8:	e8 ea 9a ff ff       	call   80100de7 <cprintf>
+801072fd:	83 c4 10             	add    $0x10,%esp
+   else
+     cprintf("%d\t", p->pid);
+#ifdef CS333_P4
+   cprintf("%d\t", p->priority);
+80107300:	83 ec 08             	sub    $0x8,%esp
+80107303:	ff b3 f0 00 00 00    	push   0xf0(%ebx)
+80107309:	68 73 ba 10 80       	push   $0x8010ba73
+8010730e:	e8 d4 9a ff ff       	call   80100de7 <cprintf>
+#endif
+   int elapsed = (ticks - p->start_ticks) / 1000;
+80107313:	8b 0d e0 fb 33 80    	mov    0x8033fbe0,%ecx
+80107319:	2b 8b d0 00 00 00    	sub    0xd0(%ebx),%ecx
+8010731f:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+80107324:	89 c8                	mov    %ecx,%eax
+80107326:	f7 e2                	mul    %edx
+80107328:	c1 ea 06             	shr    $0x6,%edx
+   int elapsed_dec = (ticks - p->start_ticks) % 1000;
+8010732b:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+80107331:	29 c1                	sub    %eax,%ecx
+80107333:	89 ce                	mov    %ecx,%esi
+80107335:	89 cf                	mov    %ecx,%edi
+
+   cprintf("%d.", elapsed);
+80107337:	83 c4 08             	add    $0x8,%esp
+8010733a:	52                   	push   %edx
+8010733b:	68 66 ba 10 80       	push   $0x8010ba66
+80107340:	e8 a2 9a ff ff       	call   80100de7 <cprintf>
+   if(elapsed_dec < 100 && elapsed_dec > 9)
+80107345:	8d 46 f6             	lea    -0xa(%esi),%eax
+80107348:	83 c4 10             	add    $0x10,%esp
+8010734b:	83 f8 59             	cmp    $0x59,%eax
+8010734e:	0f 86 94 00 00 00    	jbe    801073e8 <procdumpP3+0x135>
+      cprintf("0%d\t", elapsed_dec);
+   if(elapsed_dec < 10)
+80107354:	83 ff 09             	cmp    $0x9,%edi
+80107357:	0f 8e a1 00 00 00    	jle    801073fe <procdumpP3+0x14b>
+      cprintf("00%d\t", elapsed_dec);
+   if(elapsed_dec >=100)
+8010735d:	83 ff 63             	cmp    $0x63,%edi
+80107360:	0f 8f ae 00 00 00    	jg     80107414 <procdumpP3+0x161>
+     cprintf("%d\t", elapsed_dec);
+   int cpuelapsed = p->cpu_ticks_total /1000;
+80107366:	8b 8b dc 00 00 00    	mov    0xdc(%ebx),%ecx
+8010736c:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+80107371:	89 c8                	mov    %ecx,%eax
+80107373:	f7 e2                	mul    %edx
+80107375:	c1 ea 06             	shr    $0x6,%edx
+   int cpuelapsed_dec = p->cpu_ticks_total %1000;  
+80107378:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+8010737e:	89 ce                	mov    %ecx,%esi
+80107380:	29 c6                	sub    %eax,%esi
+80107382:	89 f7                	mov    %esi,%edi
+   cprintf("%d.", cpuelapsed);
+80107384:	83 ec 08             	sub    $0x8,%esp
+80107387:	52                   	push   %edx
+80107388:	68 66 ba 10 80       	push   $0x8010ba66
+8010738d:	e8 55 9a ff ff       	call   80100de7 <cprintf>
+   if(cpuelapsed_dec < 100 && cpuelapsed_dec > 9)
+80107392:	8d 46 f6             	lea    -0xa(%esi),%eax
+80107395:	83 c4 10             	add    $0x10,%esp
+80107398:	83 f8 59             	cmp    $0x59,%eax
+8010739b:	0f 86 89 00 00 00    	jbe    8010742a <procdumpP3+0x177>
+        cprintf("0%d", cpuelapsed_dec);
+   if(cpuelapsed_dec < 10)
+801073a1:	83 ff 09             	cmp    $0x9,%edi
+801073a4:	0f 8e 96 00 00 00    	jle    80107440 <procdumpP3+0x18d>
+      cprintf("00%d", cpuelapsed_dec);
+   if(cpuelapsed_dec >=100)
+801073aa:	83 ff 63             	cmp    $0x63,%edi
+801073ad:	0f 8f a3 00 00 00    	jg     80107456 <procdumpP3+0x1a3>
+     cprintf("%d", cpuelapsed_dec);
+   cprintf("   %s\t%d   ", state, p->sz);
+801073b3:	83 ec 04             	sub    $0x4,%esp
+801073b6:	ff 33                	push   (%ebx)
+801073b8:	ff 75 0c             	push   0xc(%ebp)
+801073bb:	68 97 ba 10 80       	push   $0x8010ba97
+801073c0:	e8 22 9a ff ff       	call   80100de7 <cprintf>
+}
+801073c5:	83 c4 10             	add    $0x10,%esp
+801073c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801073cb:	5b                   	pop    %ebx
+801073cc:	5e                   	pop    %esi
+801073cd:	5f                   	pop    %edi
+801073ce:	5d                   	pop    %ebp
+801073cf:	c3                   	ret
+     cprintf("%d\t", p->pid);
+801073d0:	83 ec 08             	sub    $0x8,%esp
+801073d3:	ff 73 10             	push   0x10(%ebx)
+801073d6:	68 73 ba 10 80       	push   $0x8010ba73
+801073db:	e8 07 9a ff ff       	call   80100de7 <cprintf>
+801073e0:	83 c4 10             	add    $0x10,%esp
+801073e3:	e9 18 ff ff ff       	jmp    80107300 <procdumpP3+0x4d>
+      cprintf("0%d\t", elapsed_dec);
+801073e8:	83 ec 08             	sub    $0x8,%esp
+801073eb:	56                   	push   %esi
+801073ec:	68 92 ba 10 80       	push   $0x8010ba92
+801073f1:	e8 f1 99 ff ff       	call   80100de7 <cprintf>
+801073f6:	83 c4 10             	add    $0x10,%esp
+801073f9:	e9 56 ff ff ff       	jmp    80107354 <procdumpP3+0xa1>
+      cprintf("00%d\t", elapsed_dec);
+801073fe:	83 ec 08             	sub    $0x8,%esp
+80107401:	57                   	push   %edi
+80107402:	68 91 ba 10 80       	push   $0x8010ba91
+80107407:	e8 db 99 ff ff       	call   80100de7 <cprintf>
+8010740c:	83 c4 10             	add    $0x10,%esp
+8010740f:	e9 49 ff ff ff       	jmp    8010735d <procdumpP3+0xaa>
+     cprintf("%d\t", elapsed_dec);
+80107414:	83 ec 08             	sub    $0x8,%esp
+80107417:	57                   	push   %edi
+80107418:	68 73 ba 10 80       	push   $0x8010ba73
+8010741d:	e8 c5 99 ff ff       	call   80100de7 <cprintf>
+80107422:	83 c4 10             	add    $0x10,%esp
+80107425:	e9 3c ff ff ff       	jmp    80107366 <procdumpP3+0xb3>
+        cprintf("0%d", cpuelapsed_dec);
+8010742a:	83 ec 08             	sub    $0x8,%esp
+8010742d:	56                   	push   %esi
+8010742e:	68 6b ba 10 80       	push   $0x8010ba6b
+80107433:	e8 af 99 ff ff       	call   80100de7 <cprintf>
+80107438:	83 c4 10             	add    $0x10,%esp
+8010743b:	e9 61 ff ff ff       	jmp    801073a1 <procdumpP3+0xee>
+      cprintf("00%d", cpuelapsed_dec);
+80107440:	83 ec 08             	sub    $0x8,%esp
+80107443:	57                   	push   %edi
+80107444:	68 6a ba 10 80       	push   $0x8010ba6a
+80107449:	e8 99 99 ff ff       	call   80100de7 <cprintf>
+8010744e:	83 c4 10             	add    $0x10,%esp
+80107451:	e9 54 ff ff ff       	jmp    801073aa <procdumpP3+0xf7>
+     cprintf("%d", cpuelapsed_dec);
+80107456:	83 ec 08             	sub    $0x8,%esp
+80107459:	57                   	push   %edi
+8010745a:	68 6c ba 10 80       	push   $0x8010ba6c
+8010745f:	e8 83 99 ff ff       	call   80100de7 <cprintf>
+80107464:	83 c4 10             	add    $0x10,%esp
+80107467:	e9 47 ff ff ff       	jmp    801073b3 <procdumpP3+0x100>
+
+8010746c <ctrlr>:
+
+#ifdef CS333_P4
+void
+ctrlr(void)
+{
+8010746c:	55                   	push   %ebp
+8010746d:	89 e5                	mov    %esp,%ebp
+8010746f:	57                   	push   %edi
+80107470:	56                   	push   %esi
+80107471:	53                   	push   %ebx
+80107472:	83 ec 18             	sub    $0x18,%esp
+  acquire(&ptable.lock);
+80107475:	68 80 b5 33 80       	push   $0x8033b580
+8010747a:	e8 4c 05 00 00       	call   801079cb <acquire>
+  struct proc * current;
+  cprintf("Ready List Processes:\n");
+8010747f:	c7 04 24 a3 ba 10 80 	movl   $0x8010baa3,(%esp)
+80107486:	e8 5c 99 ff ff       	call   80100de7 <cprintf>
+  for(int c = 0; c < ncpu; c++){
+8010748b:	83 c4 10             	add    $0x10,%esp
+8010748e:	bf 00 00 00 00       	mov    $0x0,%edi
+80107493:	eb 7e                	jmp    80107513 <ctrlr+0xa7>
+    for(int i = MAXPRIO; i >= 0; --i){
+      current = runq[c].ready[i].head;
+      cprintf("%d: ", i);
+      while(current != NULL){
+        if(current->next == NULL)
+          cprintf("(%d,%d)\n", current->pid, current->budget);
+80107495:	83 ec 04             	sub    $0x4,%esp
+80107498:	ff b3 f4 00 00 00    	push   0xf4(%ebx)
+8010749e:	ff 73 10             	push   0x10(%ebx)
+801074a1:	68 c7 ba 10 80       	push   $0x8010bac7
+801074a6:	e8 3c 99 ff ff       	call   80100de7 <cprintf>
+801074ab:	83 c4 10             	add    $0x10,%esp
+        else
+          cprintf("(%d,%d)->", current->pid, current->budget);
+
+        current = current->next;
+801074ae:	8b 9b e4 00 00 00    	mov    0xe4(%ebx),%ebx
+      while(current != NULL){
+801074b4:	85 db                	test   %ebx,%ebx
+801074b6:	74 24                	je     801074dc <ctrlr+0x70>
+        if(current->next == NULL)
+801074b8:	83 bb e4 00 00 00 00 	cmpl   $0x0,0xe4(%ebx)
+801074bf:	74 d4                	je     80107495 <ctrlr+0x29>
+          cprintf("(%d,%d)->", current->pid, current->budget);
+801074c1:	83 ec 04             	sub    $0x4,%esp
+801074c4:	ff b3 f4 00 00 00    	push   0xf4(%ebx)
+801074ca:	ff 73 10             	push   0x10(%ebx)
+801074cd:	68 d0 ba 10 80       	push   $0x8010bad0
+801074d2:	e8 10 99 ff ff       	call   80100de7 <cprintf>
+801074d7:	83 c4 10             	add    $0x10,%esp
+801074da:	eb d2                	jmp    801074ae <ctrlr+0x42>
+
+     }
+     cprintf("\n");
+801074dc:	83 ec 0c             	sub    $0xc,%esp
+801074df:	68 df bf 10 80       	push   $0x8010bfdf
+801074e4:	e8 fe 98 ff ff       	call   80100de7 <cprintf>
+    for(int i = MAXPRIO; i >= 0; --i){
+801074e9:	83 ee 01             	sub    $0x1,%esi
+801074ec:	83 c4 10             	add    $0x10,%esp
+801074ef:	85 f6                	test   %esi,%esi
+801074f1:	78 1d                	js     80107510 <ctrlr+0xa4>
+      current = runq[c].ready[i].head;
+801074f3:	8d 04 fe             	lea    (%esi,%edi,8),%eax
+801074f6:	8b 1c c5 80 b3 33 80 	mov    -0x7fcc4c80(,%eax,8),%ebx
+      cprintf("%d: ", i);
+801074fd:	83 ec 08             	sub    $0x8,%esp
+80107500:	56                   	push   %esi
+80107501:	68 c2 ba 10 80       	push   $0x8010bac2
+80107506:	e8 dc 98 ff ff       	call   80100de7 <cprintf>
+      while(current != NULL){
+8010750b:	83 c4 10             	add    $0x10,%esp
+8010750e:	eb a4                	jmp    801074b4 <ctrlr+0x48>
+  for(int c = 0; c < ncpu; c++){
+80107510:	83 c7 01             	add    $0x1,%edi
+80107513:	39 3d 84 ad 33 80    	cmp    %edi,0x8033ad84
+80107519:	7e 18                	jle    80107533 <ctrlr+0xc7>
+    cprintf("cpu%d:\n", c);
+8010751b:	83 ec 08             	sub    $0x8,%esp
+8010751e:	57                   	push   %edi
+8010751f:	68 ba ba 10 80       	push   $0x8010baba
+80107524:	e8 be 98 ff ff       	call   80100de7 <cprintf>
+    for(int i = MAXPRIO; i >= 0; --i){
+80107529:	83 c4 10             	add    $0x10,%esp
+8010752c:	be 06 00 00 00       	mov    $0x6,%esi
+80107531:	eb bc                	jmp    801074ef <ctrlr+0x83>
+
+    }
+  }
+  release(&ptable.lock);
+80107533:	83 ec 0c             	sub    $0xc,%esp
+80107536:	68 80 b5 33 80       	push   $0x8033b580
+8010753b:	e8 f0 04 00 00       	call   80107a30 <release>
+  cprintf("\n$ ");
+80107540:	c7 04 24 da ba 10 80 	movl   $0x8010bada,(%esp)
+80107547:	e8 9b 98 ff ff       	call   80100de7 <cprintf>
+}
+8010754c:	83 c4 10             	add    $0x10,%esp
+8010754f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107552:	5b                   	pop    %ebx
+80107553:	5e                   	pop    %esi
+80107554:	5f                   	pop    %edi
+80107555:	5d                   	pop    %ebp
+80107556:	c3                   	ret
+
+80107557 <ctrlf>:
+  cprintf("\n$ ");
+}
+#endif
+void
+ctrlf(void)
+{
+80107557:	55                   	push   %ebp
+80107558:	89 e5                	mov    %esp,%ebp
+8010755a:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);
+8010755d:	68 80 b5 33 80       	push   $0x8033b580
+80107562:	e8 64 04 00 00       	call   801079cb <acquire>
+  struct proc * current = ptable.list[UNUSED].head;
+80107567:	a1 b8 f9 33 80       	mov    0x8033f9b8,%eax
+  int counted = 0;
+  while(current != NULL){
+8010756c:	83 c4 10             	add    $0x10,%esp
+  int counted = 0;
+8010756f:	ba 00 00 00 00       	mov    $0x0,%edx
+  while(current != NULL){
+80107574:	eb 09                	jmp    8010757f <ctrlf+0x28>
+    ++counted;  
+80107576:	83 c2 01             	add    $0x1,%edx
+    
+    current = current->next;
+80107579:	8b 80 e4 00 00 00    	mov    0xe4(%eax),%eax
+  while(current != NULL){
+8010757f:	85 c0                	test   %eax,%eax
+80107581:	75 f3                	jne    80107576 <ctrlf+0x1f>
+
+  }
+  cprintf("Free List Size: %d processes", counted);
+80107583:	83 ec 08             	sub    $0x8,%esp
+80107586:	52                   	push   %edx
+80107587:	68 de ba 10 80       	push   $0x8010bade
+8010758c:	e8 56 98 ff ff       	call   80100de7 <cprintf>
+  release(&ptable.lock);
+80107591:	c7 04 24 80 b5 33 80 	movl   $0x8033b580,(%esp)
+80107598:	e8 93 04 00 00       	call   80107a30 <release>
+  cprintf("\n$ ");
+8010759d:	c7 04 24 da ba 10 80 	movl   $0x8010bada,(%esp)
+801075a4:	e8 3e 98 ff ff       	call   80100de7 <cprintf>
+}
+801075a9:	83 c4 10             	add    $0x10,%esp
+801075ac:	c9                   	leave
+801075ad:	c3                   	ret
+
+801075ae <ctrls>:
+void
+ctrls(void)
+{
+801075ae:	55                   	push   %ebp
+801075af:	89 e5                	mov    %esp,%ebp
+801075b1:	56                   	push   %esi
+801075b2:	53                   	push   %ebx
+  acquire(&ptable.lock);
+801075b3:	83 ec 0c             	sub    $0xc,%esp
+801075b6:	68 80 b5 33 80       	push   $0x8033b580
+801075bb:	e8 0b 04 00 00       	call   801079cb <acquire>
+  struct proc * current;
+  int first = 1;
+  cprintf("Sleeping List Processes:\n");
+801075c0:	c7 04 24 fb ba 10 80 	movl   $0x8010bafb,(%esp)
+801075c7:	e8 1b 98 ff ff       	call   80100de7 <cprintf>
+  for(int i = 0; i < NSLEEPQ; i++){
+801075cc:	83 c4 10             	add    $0x10,%esp
+801075cf:	be 00 00 00 00       	mov    $0x0,%esi
+  int first = 1;
+801075d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  for(int i = 0; i < NSLEEPQ; i++){
+801075d9:	eb 3e                	jmp    80107619 <ctrls+0x6b>
+    for(current = ptable.sleepq[i].head; current != NULL; current = current->next){
+      if(first)
+        cprintf("%d", current->pid);
+      else
+        cprintf("->%d", current->pid);
+801075db:	83 ec 08             	sub    $0x8,%esp
+801075de:	ff 73 10             	push   0x10(%ebx)
+801075e1:	68 15 bb 10 80       	push   $0x8010bb15
+801075e6:	e8 fc 97 ff ff       	call   80100de7 <cprintf>
+801075eb:	83 c4 10             	add    $0x10,%esp
+    for(current = ptable.sleepq[i].head; current != NULL; current = current->next){
+801075ee:	8b 9b e4 00 00 00    	mov    0xe4(%ebx),%ebx
+      first = 0;
+801075f4:	b8 00 00 00 00       	mov    $0x0,%eax
+    for(current = ptable.sleepq[i].head; current != NULL; current = current->next){
+801075f9:	85 db                	test   %ebx,%ebx
+801075fb:	74 19                	je     80107616 <ctrls+0x68>
+      if(first)
+801075fd:	85 c0                	test   %eax,%eax
+801075ff:	74 da                	je     801075db <ctrls+0x2d>
+        cprintf("%d", current->pid);
+80107601:	83 ec 08             	sub    $0x8,%esp
+80107604:	ff 73 10             	push   0x10(%ebx)
+80107607:	68 6c ba 10 80       	push   $0x8010ba6c
+8010760c:	e8 d6 97 ff ff       	call   80100de7 <cprintf>
+80107611:	83 c4 10             	add    $0x10,%esp
+80107614:	eb d8                	jmp    801075ee <ctrls+0x40>
+  for(int i = 0; i < NSLEEPQ; i++){
+80107616:	83 c6 01             	add    $0x1,%esi
+80107619:	83 fe 3c             	cmp    $0x3c,%esi
+8010761c:	7f 09                	jg     80107627 <ctrls+0x79>
+    for(current = ptable.sleepq[i].head; current != NULL; current = current->next){
+8010761e:	8b 1c f5 e8 f9 33 80 	mov    -0x7fcc0618(,%esi,8),%ebx
+80107625:	eb d2                	jmp    801075f9 <ctrls+0x4b>
+    }
+  }
+  release(&ptable.lock);
+80107627:	83 ec 0c             	sub    $0xc,%esp
+8010762a:	68 80 b5 33 80       	push   $0x8033b580
+8010762f:	e8 fc 03 00 00       	call   80107a30 <release>
+  cprintf("\n$ ");
+80107634:	c7 04 24 da ba 10 80 	movl   $0x8010bada,(%esp)
+8010763b:	e8 a7 97 ff ff       	call   80100de7 <cprintf>
+}
+80107640:	83 c4 10             	add    $0x10,%esp
+80107643:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107646:	5b                   	pop    %ebx
+80107647:	5e                   	pop    %esi
+80107648:	5d                   	pop    %ebp
+80107649:	c3                   	ret
+
+8010764a <ctrlz>:
+void
+ctrlz(void)
+{
+8010764a:	55                   	push   %ebp
+8010764b:	89 e5                	mov    %esp,%ebp
+8010764d:	53                   	push   %ebx
+8010764e:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+80107651:	68 80 b5 33 80       	push   $0x8033b580
+80107656:	e8 70 03 00 00       	call   801079cb <acquire>
+  struct proc * current = ptable.list[ZOMBIE].head;
+8010765b:	8b 1d e0 f9 33 80    	mov    0x8033f9e0,%ebx
+  int ppid = 0;
+  cprintf("Zombie List Processes:\n");
+80107661:	c7 04 24 1a bb 10 80 	movl   $0x8010bb1a,(%esp)
+80107668:	e8 7a 97 ff ff       	call   80100de7 <cprintf>
+  while(current != NULL){
+8010766d:	83 c4 10             	add    $0x10,%esp
+80107670:	eb 1f                	jmp    80107691 <ctrlz+0x47>
+   if(current->parent != NULL)
+     ppid = current->parent->pid;
+   else
+     ppid = current->pid;
+80107672:	8b 43 10             	mov    0x10(%ebx),%eax
+80107675:	eb 28                	jmp    8010769f <ctrlz+0x55>
+
+   if(current->next == NULL)
+     cprintf("(%d,%d)", current->pid, ppid);  
+   else
+     cprintf("(%d,%d)->", current->pid, ppid);  
+80107677:	83 ec 04             	sub    $0x4,%esp
+8010767a:	50                   	push   %eax
+8010767b:	ff 73 10             	push   0x10(%ebx)
+8010767e:	68 d0 ba 10 80       	push   $0x8010bad0
+80107683:	e8 5f 97 ff ff       	call   80100de7 <cprintf>
+80107688:	83 c4 10             	add    $0x10,%esp
+    
+    current = current->next;
+8010768b:	8b 9b e4 00 00 00    	mov    0xe4(%ebx),%ebx
+  while(current != NULL){
+80107691:	85 db                	test   %ebx,%ebx
+80107693:	74 29                	je     801076be <ctrlz+0x74>
+   if(current->parent != NULL)
+80107695:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80107698:	85 c0                	test   %eax,%eax
+8010769a:	74 d6                	je     80107672 <ctrlz+0x28>
+     ppid = current->parent->pid;
+8010769c:	8b 40 10             	mov    0x10(%eax),%eax
+   if(current->next == NULL)
+8010769f:	83 bb e4 00 00 00 00 	cmpl   $0x0,0xe4(%ebx)
+801076a6:	75 cf                	jne    80107677 <ctrlz+0x2d>
+     cprintf("(%d,%d)", current->pid, ppid);  
+801076a8:	83 ec 04             	sub    $0x4,%esp
+801076ab:	50                   	push   %eax
+801076ac:	ff 73 10             	push   0x10(%ebx)
+801076af:	68 32 bb 10 80       	push   $0x8010bb32
+801076b4:	e8 2e 97 ff ff       	call   80100de7 <cprintf>
+801076b9:	83 c4 10             	add    $0x10,%esp
+801076bc:	eb cd                	jmp    8010768b <ctrlz+0x41>
+
+  }
+  release(&ptable.lock);
+801076be:	83 ec 0c             	sub    $0xc,%esp
+801076c1:	68 80 b5 33 80       	push   $0x8033b580
+801076c6:	e8 65 03 00 00       	call   80107a30 <release>
+  cprintf("\n$ ");
+801076cb:	c7 04 24 da ba 10 80 	movl   $0x8010bada,(%esp)
+801076d2:	e8 10 97 ff ff       	call   80100de7 <cprintf>
+}
+801076d7:	83 c4 10             	add    $0x10,%esp
+801076da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801076dd:	c9                   	leave
+801076de:	c3                   	ret
+
+801076df <procdump>:
+
+#endif //CS333_P3
+void
+procdump(void)
+{
+801076df:	55                   	push   %ebp
+801076e0:	89 e5                	mov    %esp,%ebp
+801076e2:	56                   	push   %esi
+801076e3:	53                   	push   %ebx
+801076e4:	83 ec 3c             	sub    $0x3c,%esp
+#define HEADER "\nPID\tName         Elapsed\tState\tSize\t PCs\n"
+#else
+#define HEADER "\n"
+#endif
+
+  cprintf(HEADER);  // not conditionally compiled as must work in all project states
+801076e7:	68 80 b9 10 80       	push   $0x8010b980
+801076ec:	e8 f6 96 ff ff       	call   80100de7 <cprintf>
+
+  for(p = ptable.all; p; p = p->allnext){
+801076f1:	8b 1d b4 f4 33 80    	mov    0x8033f4b4,%ebx
+801076f7:	83 c4 10             	add    $0x10,%esp
+801076fa:	eb 2b                	jmp    80107727 <procdump+0x48>
+    if(p->state == UNUSED)
+      continue;
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+      state = states[p->state];
+    else
+      state = "???";
+801076fc:	b8 3a bb 10 80       	mov    $0x8010bb3a,%eax
+ 
+#if defined(CS333_P3)
+    procdumpP3(p, state);
+80107701:	83 ec 08             	sub    $0x8,%esp
+80107704:	50                   	push   %eax
+80107705:	53                   	push   %ebx
+80107706:	e8 a8 fb ff ff       	call   801072b3 <procdumpP3>
+    procdumpP1(p, state);
+#else
+    cprintf("%d\t%s\t%s\t", p->pid, p->name, state);
+#endif
+
+    if(p->state == SLEEPING){
+8010770b:	83 c4 10             	add    $0x10,%esp
+8010770e:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80107712:	74 35                	je     80107749 <procdump+0x6a>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80107714:	83 ec 0c             	sub    $0xc,%esp
+80107717:	68 df bf 10 80       	push   $0x8010bfdf
+8010771c:	e8 c6 96 ff ff       	call   80100de7 <cprintf>
+80107721:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.all; p; p = p->allnext){
+80107724:	8b 5b 18             	mov    0x18(%ebx),%ebx
+80107727:	85 db                	test   %ebx,%ebx
+80107729:	74 61                	je     8010778c <procdump+0xad>
+    if(p->state == UNUSED)
+8010772b:	8b 43 0c             	mov    0xc(%ebx),%eax
+8010772e:	85 c0                	test   %eax,%eax
+80107730:	74 f2                	je     80107724 <procdump+0x45>
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80107732:	83 f8 05             	cmp    $0x5,%eax
+80107735:	77 c5                	ja     801076fc <procdump+0x1d>
+80107737:	8b 04 85 e4 bb 10 80 	mov    -0x7fef441c(,%eax,4),%eax
+8010773e:	85 c0                	test   %eax,%eax
+80107740:	75 bf                	jne    80107701 <procdump+0x22>
+      state = "???";
+80107742:	b8 3a bb 10 80       	mov    $0x8010bb3a,%eax
+80107747:	eb b8                	jmp    80107701 <procdump+0x22>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80107749:	8b 43 24             	mov    0x24(%ebx),%eax
+8010774c:	8b 40 0c             	mov    0xc(%eax),%eax
+8010774f:	83 c0 08             	add    $0x8,%eax
+80107752:	83 ec 08             	sub    $0x8,%esp
+80107755:	8d 55 d0             	lea    -0x30(%ebp),%edx
+80107758:	52                   	push   %edx
+80107759:	50                   	push   %eax
+8010775a:	e8 43 01 00 00       	call   801078a2 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+8010775f:	83 c4 10             	add    $0x10,%esp
+80107762:	be 00 00 00 00       	mov    $0x0,%esi
+80107767:	eb 14                	jmp    8010777d <procdump+0x9e>
+        cprintf(" %p", pc[i]);
+80107769:	83 ec 08             	sub    $0x8,%esp
+8010776c:	50                   	push   %eax
+8010776d:	68 2e b1 10 80       	push   $0x8010b12e
+80107772:	e8 70 96 ff ff       	call   80100de7 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80107777:	83 c6 01             	add    $0x1,%esi
+8010777a:	83 c4 10             	add    $0x10,%esp
+8010777d:	83 fe 09             	cmp    $0x9,%esi
+80107780:	7f 92                	jg     80107714 <procdump+0x35>
+80107782:	8b 44 b5 d0          	mov    -0x30(%ebp,%esi,4),%eax
+80107786:	85 c0                	test   %eax,%eax
+80107788:	75 df                	jne    80107769 <procdump+0x8a>
+8010778a:	eb 88                	jmp    80107714 <procdump+0x35>
+   }
+ 
+#ifdef CS333_P1
+  cprintf("$ ");  // simulate shell prompt
+8010778c:	83 ec 0c             	sub    $0xc,%esp
+8010778f:	68 db ba 10 80       	push   $0x8010badb
+80107794:	e8 4e 96 ff ff       	call   80100de7 <cprintf>
+#endif // CS333_P1
+}
+80107799:	83 c4 10             	add    $0x10,%esp
+8010779c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010779f:	5b                   	pop    %ebx
+801077a0:	5e                   	pop    %esi
+801077a1:	5d                   	pop    %ebp
+801077a2:	c3                   	ret
+
+801077a3 <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+801077a3:	55                   	push   %ebp
+801077a4:	89 e5                	mov    %esp,%ebp
+801077a6:	53                   	push   %ebx
+801077a7:	83 ec 0c             	sub    $0xc,%esp
+801077aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+801077ad:	68 fc bb 10 80       	push   $0x8010bbfc
+801077b2:	8d 43 04             	lea    0x4(%ebx),%eax
+801077b5:	50                   	push   %eax
+801077b6:	e8 cc 00 00 00       	call   80107887 <initlock>
+  lk->name = name;
+801077bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+801077be:	89 43 38             	mov    %eax,0x38(%ebx)
+  lk->locked = 0;
+801077c1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+801077c7:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+}
+801077ce:	83 c4 10             	add    $0x10,%esp
+801077d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801077d4:	c9                   	leave
+801077d5:	c3                   	ret
+
+801077d6 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+801077d6:	55                   	push   %ebp
+801077d7:	89 e5                	mov    %esp,%ebp
+801077d9:	56                   	push   %esi
+801077da:	53                   	push   %ebx
+801077db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+801077de:	8d 73 04             	lea    0x4(%ebx),%esi
+801077e1:	83 ec 0c             	sub    $0xc,%esp
+801077e4:	56                   	push   %esi
+801077e5:	e8 e1 01 00 00       	call   801079cb <acquire>
+  while (lk->locked) {
+801077ea:	83 c4 10             	add    $0x10,%esp
+801077ed:	eb 0d                	jmp    801077fc <acquiresleep+0x26>
+    sleep(lk, &lk->lk);
+801077ef:	83 ec 08             	sub    $0x8,%esp
+801077f2:	56                   	push   %esi
+801077f3:	53                   	push   %ebx
+801077f4:	e8 64 f4 ff ff       	call   80106c5d <sleep>
+801077f9:	83 c4 10             	add    $0x10,%esp
+  while (lk->locked) {
+801077fc:	83 3b 00             	cmpl   $0x0,(%ebx)
+801077ff:	75 ee                	jne    801077ef <acquiresleep+0x19>
+  }
+  lk->locked = 1;
+80107801:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+80107807:	e8 4b e5 ff ff       	call   80105d57 <myproc>
+8010780c:	8b 40 10             	mov    0x10(%eax),%eax
+8010780f:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+80107812:	83 ec 0c             	sub    $0xc,%esp
+80107815:	56                   	push   %esi
+80107816:	e8 15 02 00 00       	call   80107a30 <release>
+}
+8010781b:	83 c4 10             	add    $0x10,%esp
+8010781e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107821:	5b                   	pop    %ebx
+80107822:	5e                   	pop    %esi
+80107823:	5d                   	pop    %ebp
+80107824:	c3                   	ret
+
+80107825 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80107825:	55                   	push   %ebp
+80107826:	89 e5                	mov    %esp,%ebp
+80107828:	56                   	push   %esi
+80107829:	53                   	push   %ebx
+8010782a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+8010782d:	8d 73 04             	lea    0x4(%ebx),%esi
+80107830:	83 ec 0c             	sub    $0xc,%esp
+80107833:	56                   	push   %esi
+80107834:	e8 92 01 00 00       	call   801079cb <acquire>
+  lk->locked = 0;
+80107839:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+8010783f:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeup(lk);
+80107846:	89 1c 24             	mov    %ebx,(%esp)
+80107849:	e8 fb e9 ff ff       	call   80106249 <wakeup>
+  release(&lk->lk);
+8010784e:	89 34 24             	mov    %esi,(%esp)
+80107851:	e8 da 01 00 00       	call   80107a30 <release>
+}
+80107856:	83 c4 10             	add    $0x10,%esp
+80107859:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010785c:	5b                   	pop    %ebx
+8010785d:	5e                   	pop    %esi
+8010785e:	5d                   	pop    %ebp
+8010785f:	c3                   	ret
+
+80107860 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80107860:	55                   	push   %ebp
+80107861:	89 e5                	mov    %esp,%ebp
+80107863:	56                   	push   %esi
+80107864:	53                   	push   %ebx
+80107865:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  
+  acquire(&lk->lk);
+80107868:	8d 5e 04             	lea    0x4(%esi),%ebx
+8010786b:	83 ec 0c             	sub    $0xc,%esp
+8010786e:	53                   	push   %ebx
+8010786f:	e8 57 01 00 00       	call   801079cb <acquire>
+  r = lk->locked;
+80107874:	8b 36                	mov    (%esi),%esi
+  release(&lk->lk);
+80107876:	89 1c 24             	mov    %ebx,(%esp)
+80107879:	e8 b2 01 00 00       	call   80107a30 <release>
+  return r;
+}
+8010787e:	89 f0                	mov    %esi,%eax
+80107880:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107883:	5b                   	pop    %ebx
+80107884:	5e                   	pop    %esi
+80107885:	5d                   	pop    %ebp
+80107886:	c3                   	ret
+
+80107887 <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80107887:	55                   	push   %ebp
+80107888:	89 e5                	mov    %esp,%ebp
+8010788a:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+8010788d:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107890:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->locked = 0;
+80107893:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->cpu = 0;
+80107899:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+801078a0:	5d                   	pop    %ebp
+801078a1:	c3                   	ret
+
+801078a2 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+801078a2:	55                   	push   %ebp
+801078a3:	89 e5                	mov    %esp,%ebp
+801078a5:	53                   	push   %ebx
+801078a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+801078a9:	8b 45 08             	mov    0x8(%ebp),%eax
+801078ac:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+801078af:	b8 00 00 00 00       	mov    $0x0,%eax
+801078b4:	83 f8 09             	cmp    $0x9,%eax
+801078b7:	7f 25                	jg     801078de <getcallerpcs+0x3c>
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801078b9:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+801078bf:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+801078c5:	77 17                	ja     801078de <getcallerpcs+0x3c>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+801078c7:	8b 5a 04             	mov    0x4(%edx),%ebx
+801078ca:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+    ebp = (uint*)ebp[0]; // saved %ebp
+801078cd:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+801078cf:	83 c0 01             	add    $0x1,%eax
+801078d2:	eb e0                	jmp    801078b4 <getcallerpcs+0x12>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+801078d4:	c7 04 81 00 00 00 00 	movl   $0x0,(%ecx,%eax,4)
+  for(; i < 10; i++)
+801078db:	83 c0 01             	add    $0x1,%eax
+801078de:	83 f8 09             	cmp    $0x9,%eax
+801078e1:	7e f1                	jle    801078d4 <getcallerpcs+0x32>
+}
+801078e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801078e6:	c9                   	leave
+801078e7:	c3                   	ret
+
+801078e8 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+801078e8:	55                   	push   %ebp
+801078e9:	89 e5                	mov    %esp,%ebp
+801078eb:	53                   	push   %ebx
+801078ec:	83 ec 04             	sub    $0x4,%esp
+801078ef:	9c                   	pushf
+801078f0:	5b                   	pop    %ebx
+  asm volatile("cli");
+801078f1:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+801078f2:	e8 e9 e3 ff ff       	call   80105ce0 <mycpu>
+801078f7:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+801078fe:	74 19                	je     80107919 <pushcli+0x31>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80107900:	e8 db e3 ff ff       	call   80105ce0 <mycpu>
+80107905:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+8010790b:	8d 51 01             	lea    0x1(%ecx),%edx
+8010790e:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+}
+80107914:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107917:	c9                   	leave
+80107918:	c3                   	ret
+    mycpu()->intena = eflags & FL_IF;
+80107919:	e8 c2 e3 ff ff       	call   80105ce0 <mycpu>
+8010791e:	81 e3 00 02 00 00    	and    $0x200,%ebx
+80107924:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+8010792a:	eb d4                	jmp    80107900 <pushcli+0x18>
+
+8010792c <popcli>:
+
+void
+popcli(void)
+{
+8010792c:	55                   	push   %ebp
+8010792d:	89 e5                	mov    %esp,%ebp
+8010792f:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80107932:	9c                   	pushf
+80107933:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80107934:	f6 c4 02             	test   $0x2,%ah
+80107937:	75 28                	jne    80107961 <popcli+0x35>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80107939:	e8 a2 e3 ff ff       	call   80105ce0 <mycpu>
+8010793e:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+80107944:	8d 51 ff             	lea    -0x1(%ecx),%edx
+80107947:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+8010794d:	85 d2                	test   %edx,%edx
+8010794f:	78 1d                	js     8010796e <popcli+0x42>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107951:	e8 8a e3 ff ff       	call   80105ce0 <mycpu>
+80107956:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+8010795d:	74 1c                	je     8010797b <popcli+0x4f>
+    sti();
+}
+8010795f:	c9                   	leave
+80107960:	c3                   	ret
+    panic("popcli - interruptible");
+80107961:	83 ec 0c             	sub    $0xc,%esp
+80107964:	68 07 bc 10 80       	push   $0x8010bc07
+80107969:	e8 b8 91 ff ff       	call   80100b26 <panic>
+    panic("popcli");
+8010796e:	83 ec 0c             	sub    $0xc,%esp
+80107971:	68 1e bc 10 80       	push   $0x8010bc1e
+80107976:	e8 ab 91 ff ff       	call   80100b26 <panic>
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+8010797b:	e8 60 e3 ff ff       	call   80105ce0 <mycpu>
+80107980:	83 b8 a8 00 00 00 00 	cmpl   $0x0,0xa8(%eax)
+80107987:	74 d6                	je     8010795f <popcli+0x33>
+  asm volatile("sti");
+80107989:	fb                   	sti
+}
+8010798a:	eb d3                	jmp    8010795f <popcli+0x33>
+
+8010798c <holding>:
+{
+8010798c:	55                   	push   %ebp
+8010798d:	89 e5                	mov    %esp,%ebp
+8010798f:	53                   	push   %ebx
+80107990:	83 ec 04             	sub    $0x4,%esp
+80107993:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80107996:	e8 4d ff ff ff       	call   801078e8 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+8010799b:	83 3b 00             	cmpl   $0x0,(%ebx)
+8010799e:	75 11                	jne    801079b1 <holding+0x25>
+801079a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  popcli();
+801079a5:	e8 82 ff ff ff       	call   8010792c <popcli>
+}
+801079aa:	89 d8                	mov    %ebx,%eax
+801079ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801079af:	c9                   	leave
+801079b0:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+801079b1:	8b 5b 08             	mov    0x8(%ebx),%ebx
+801079b4:	e8 27 e3 ff ff       	call   80105ce0 <mycpu>
+801079b9:	39 c3                	cmp    %eax,%ebx
+801079bb:	74 07                	je     801079c4 <holding+0x38>
+801079bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+801079c2:	eb e1                	jmp    801079a5 <holding+0x19>
+801079c4:	bb 01 00 00 00       	mov    $0x1,%ebx
+801079c9:	eb da                	jmp    801079a5 <holding+0x19>
+
+801079cb <acquire>:
+{
+801079cb:	55                   	push   %ebp
+801079cc:	89 e5                	mov    %esp,%ebp
+801079ce:	53                   	push   %ebx
+801079cf:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+801079d2:	e8 11 ff ff ff       	call   801078e8 <pushcli>
+  if(holding(lk))
+801079d7:	83 ec 0c             	sub    $0xc,%esp
+801079da:	ff 75 08             	push   0x8(%ebp)
+801079dd:	e8 aa ff ff ff       	call   8010798c <holding>
+801079e2:	83 c4 10             	add    $0x10,%esp
+801079e5:	85 c0                	test   %eax,%eax
+801079e7:	75 3a                	jne    80107a23 <acquire+0x58>
+  while(xchg(&lk->locked, 1) != 0)
+801079e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("lock; xchgl %0, %1" :
+801079ec:	b8 01 00 00 00       	mov    $0x1,%eax
+801079f1:	f0 87 02             	lock xchg %eax,(%edx)
+801079f4:	85 c0                	test   %eax,%eax
+801079f6:	75 f1                	jne    801079e9 <acquire+0x1e>
+  __sync_synchronize();
+801079f8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+801079fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80107a00:	e8 db e2 ff ff       	call   80105ce0 <mycpu>
+80107a05:	89 43 08             	mov    %eax,0x8(%ebx)
+  getcallerpcs(&lk, lk->pcs);
+80107a08:	8b 45 08             	mov    0x8(%ebp),%eax
+80107a0b:	83 c0 0c             	add    $0xc,%eax
+80107a0e:	83 ec 08             	sub    $0x8,%esp
+80107a11:	50                   	push   %eax
+80107a12:	8d 45 08             	lea    0x8(%ebp),%eax
+80107a15:	50                   	push   %eax
+80107a16:	e8 87 fe ff ff       	call   801078a2 <getcallerpcs>
+}
+80107a1b:	83 c4 10             	add    $0x10,%esp
+80107a1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107a21:	c9                   	leave
+80107a22:	c3                   	ret
+    panic("acquire");
+80107a23:	83 ec 0c             	sub    $0xc,%esp
+80107a26:	68 25 bc 10 80       	push   $0x8010bc25
+80107a2b:	e8 f6 90 ff ff       	call   80100b26 <panic>
+
+80107a30 <release>:
+{
+80107a30:	55                   	push   %ebp
+80107a31:	89 e5                	mov    %esp,%ebp
+80107a33:	53                   	push   %ebx
+80107a34:	83 ec 10             	sub    $0x10,%esp
+80107a37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holding(lk))
+80107a3a:	53                   	push   %ebx
+80107a3b:	e8 4c ff ff ff       	call   8010798c <holding>
+80107a40:	83 c4 10             	add    $0x10,%esp
+80107a43:	85 c0                	test   %eax,%eax
+80107a45:	74 23                	je     80107a6a <release+0x3a>
+  lk->pcs[0] = 0;
+80107a47:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80107a4e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+80107a55:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80107a5a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  popcli();
+80107a60:	e8 c7 fe ff ff       	call   8010792c <popcli>
+}
+80107a65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107a68:	c9                   	leave
+80107a69:	c3                   	ret
+    panic("release");
+80107a6a:	83 ec 0c             	sub    $0xc,%esp
+80107a6d:	68 2d bc 10 80       	push   $0x8010bc2d
+80107a72:	e8 af 90 ff ff       	call   80100b26 <panic>
+
+80107a77 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80107a77:	55                   	push   %ebp
+80107a78:	89 e5                	mov    %esp,%ebp
+80107a7a:	57                   	push   %edi
+80107a7b:	53                   	push   %ebx
+80107a7c:	8b 55 08             	mov    0x8(%ebp),%edx
+80107a7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107a82:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+80107a85:	f6 c2 03             	test   $0x3,%dl
+80107a88:	75 25                	jne    80107aaf <memset+0x38>
+80107a8a:	f6 c1 03             	test   $0x3,%cl
+80107a8d:	75 20                	jne    80107aaf <memset+0x38>
+    c &= 0xFF;
+80107a8f:	0f b6 f8             	movzbl %al,%edi
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80107a92:	c1 e9 02             	shr    $0x2,%ecx
+80107a95:	c1 e0 18             	shl    $0x18,%eax
+80107a98:	89 fb                	mov    %edi,%ebx
+80107a9a:	c1 e3 10             	shl    $0x10,%ebx
+80107a9d:	09 d8                	or     %ebx,%eax
+80107a9f:	89 fb                	mov    %edi,%ebx
+80107aa1:	c1 e3 08             	shl    $0x8,%ebx
+80107aa4:	09 d8                	or     %ebx,%eax
+80107aa6:	09 f8                	or     %edi,%eax
+  asm volatile("cld; rep stosl" :
+80107aa8:	89 d7                	mov    %edx,%edi
+80107aaa:	fc                   	cld
+80107aab:	f3 ab                	rep stos %eax,%es:(%edi)
+}
+80107aad:	eb 05                	jmp    80107ab4 <memset+0x3d>
+  asm volatile("cld; rep stosb" :
+80107aaf:	89 d7                	mov    %edx,%edi
+80107ab1:	fc                   	cld
+80107ab2:	f3 aa                	rep stos %al,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+80107ab4:	89 d0                	mov    %edx,%eax
+80107ab6:	5b                   	pop    %ebx
+80107ab7:	5f                   	pop    %edi
+80107ab8:	5d                   	pop    %ebp
+80107ab9:	c3                   	ret
+
+80107aba <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80107aba:	55                   	push   %ebp
+80107abb:	89 e5                	mov    %esp,%ebp
+80107abd:	56                   	push   %esi
+80107abe:	53                   	push   %ebx
+80107abf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80107ac2:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107ac5:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+80107ac8:	eb 08                	jmp    80107ad2 <memcmp+0x18>
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80107aca:	83 c1 01             	add    $0x1,%ecx
+80107acd:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80107ad0:	89 f0                	mov    %esi,%eax
+80107ad2:	8d 70 ff             	lea    -0x1(%eax),%esi
+80107ad5:	85 c0                	test   %eax,%eax
+80107ad7:	74 12                	je     80107aeb <memcmp+0x31>
+    if(*s1 != *s2)
+80107ad9:	0f b6 01             	movzbl (%ecx),%eax
+80107adc:	0f b6 1a             	movzbl (%edx),%ebx
+80107adf:	38 d8                	cmp    %bl,%al
+80107ae1:	74 e7                	je     80107aca <memcmp+0x10>
+      return *s1 - *s2;
+80107ae3:	0f b6 c0             	movzbl %al,%eax
+80107ae6:	0f b6 db             	movzbl %bl,%ebx
+80107ae9:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80107aeb:	5b                   	pop    %ebx
+80107aec:	5e                   	pop    %esi
+80107aed:	5d                   	pop    %ebp
+80107aee:	c3                   	ret
+
+80107aef <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80107aef:	55                   	push   %ebp
+80107af0:	89 e5                	mov    %esp,%ebp
+80107af2:	56                   	push   %esi
+80107af3:	53                   	push   %ebx
+80107af4:	8b 75 08             	mov    0x8(%ebp),%esi
+80107af7:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107afa:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+80107afd:	39 f2                	cmp    %esi,%edx
+80107aff:	73 3c                	jae    80107b3d <memmove+0x4e>
+80107b01:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+80107b04:	39 ce                	cmp    %ecx,%esi
+80107b06:	73 39                	jae    80107b41 <memmove+0x52>
+    s += n;
+    d += n;
+80107b08:	8d 14 06             	lea    (%esi,%eax,1),%edx
+    while(n-- > 0)
+80107b0b:	eb 0d                	jmp    80107b1a <memmove+0x2b>
+      *--d = *--s;
+80107b0d:	83 e9 01             	sub    $0x1,%ecx
+80107b10:	83 ea 01             	sub    $0x1,%edx
+80107b13:	0f b6 01             	movzbl (%ecx),%eax
+80107b16:	88 02                	mov    %al,(%edx)
+    while(n-- > 0)
+80107b18:	89 d8                	mov    %ebx,%eax
+80107b1a:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80107b1d:	85 c0                	test   %eax,%eax
+80107b1f:	75 ec                	jne    80107b0d <memmove+0x1e>
+80107b21:	eb 14                	jmp    80107b37 <memmove+0x48>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+80107b23:	0f b6 02             	movzbl (%edx),%eax
+80107b26:	88 01                	mov    %al,(%ecx)
+80107b28:	8d 49 01             	lea    0x1(%ecx),%ecx
+80107b2b:	8d 52 01             	lea    0x1(%edx),%edx
+    while(n-- > 0)
+80107b2e:	89 d8                	mov    %ebx,%eax
+80107b30:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80107b33:	85 c0                	test   %eax,%eax
+80107b35:	75 ec                	jne    80107b23 <memmove+0x34>
+
+  return dst;
+}
+80107b37:	89 f0                	mov    %esi,%eax
+80107b39:	5b                   	pop    %ebx
+80107b3a:	5e                   	pop    %esi
+80107b3b:	5d                   	pop    %ebp
+80107b3c:	c3                   	ret
+80107b3d:	89 f1                	mov    %esi,%ecx
+80107b3f:	eb ef                	jmp    80107b30 <memmove+0x41>
+80107b41:	89 f1                	mov    %esi,%ecx
+80107b43:	eb eb                	jmp    80107b30 <memmove+0x41>
+
+80107b45 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+80107b45:	55                   	push   %ebp
+80107b46:	89 e5                	mov    %esp,%ebp
+80107b48:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+80107b4b:	ff 75 10             	push   0x10(%ebp)
+80107b4e:	ff 75 0c             	push   0xc(%ebp)
+80107b51:	ff 75 08             	push   0x8(%ebp)
+80107b54:	e8 96 ff ff ff       	call   80107aef <memmove>
+}
+80107b59:	c9                   	leave
+80107b5a:	c3                   	ret
+
+80107b5b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80107b5b:	55                   	push   %ebp
+80107b5c:	89 e5                	mov    %esp,%ebp
+80107b5e:	53                   	push   %ebx
+80107b5f:	8b 55 08             	mov    0x8(%ebp),%edx
+80107b62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107b65:	8b 45 10             	mov    0x10(%ebp),%eax
+  while(n > 0 && *p && *p == *q)
+80107b68:	eb 09                	jmp    80107b73 <strncmp+0x18>
+    n--, p++, q++;
+80107b6a:	83 e8 01             	sub    $0x1,%eax
+80107b6d:	83 c2 01             	add    $0x1,%edx
+80107b70:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+80107b73:	85 c0                	test   %eax,%eax
+80107b75:	74 0b                	je     80107b82 <strncmp+0x27>
+80107b77:	0f b6 1a             	movzbl (%edx),%ebx
+80107b7a:	84 db                	test   %bl,%bl
+80107b7c:	74 04                	je     80107b82 <strncmp+0x27>
+80107b7e:	3a 19                	cmp    (%ecx),%bl
+80107b80:	74 e8                	je     80107b6a <strncmp+0xf>
+  if(n == 0)
+80107b82:	85 c0                	test   %eax,%eax
+80107b84:	74 0d                	je     80107b93 <strncmp+0x38>
+    return 0;
+  return (uchar)*p - (uchar)*q;
+80107b86:	0f b6 02             	movzbl (%edx),%eax
+80107b89:	0f b6 11             	movzbl (%ecx),%edx
+80107b8c:	29 d0                	sub    %edx,%eax
+}
+80107b8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107b91:	c9                   	leave
+80107b92:	c3                   	ret
+    return 0;
+80107b93:	b8 00 00 00 00       	mov    $0x0,%eax
+80107b98:	eb f4                	jmp    80107b8e <strncmp+0x33>
+
+80107b9a <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80107b9a:	55                   	push   %ebp
+80107b9b:	89 e5                	mov    %esp,%ebp
+80107b9d:	57                   	push   %edi
+80107b9e:	56                   	push   %esi
+80107b9f:	53                   	push   %ebx
+80107ba0:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107ba3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107ba6:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+80107ba9:	89 fa                	mov    %edi,%edx
+80107bab:	eb 04                	jmp    80107bb1 <strncpy+0x17>
+80107bad:	89 f1                	mov    %esi,%ecx
+80107baf:	89 da                	mov    %ebx,%edx
+80107bb1:	89 c3                	mov    %eax,%ebx
+80107bb3:	83 e8 01             	sub    $0x1,%eax
+80107bb6:	85 db                	test   %ebx,%ebx
+80107bb8:	7e 11                	jle    80107bcb <strncpy+0x31>
+80107bba:	8d 71 01             	lea    0x1(%ecx),%esi
+80107bbd:	8d 5a 01             	lea    0x1(%edx),%ebx
+80107bc0:	0f b6 09             	movzbl (%ecx),%ecx
+80107bc3:	88 0a                	mov    %cl,(%edx)
+80107bc5:	84 c9                	test   %cl,%cl
+80107bc7:	75 e4                	jne    80107bad <strncpy+0x13>
+80107bc9:	89 da                	mov    %ebx,%edx
+    ;
+  while(n-- > 0)
+80107bcb:	8d 48 ff             	lea    -0x1(%eax),%ecx
+80107bce:	85 c0                	test   %eax,%eax
+80107bd0:	7e 0a                	jle    80107bdc <strncpy+0x42>
+    *s++ = 0;
+80107bd2:	c6 02 00             	movb   $0x0,(%edx)
+  while(n-- > 0)
+80107bd5:	89 c8                	mov    %ecx,%eax
+    *s++ = 0;
+80107bd7:	8d 52 01             	lea    0x1(%edx),%edx
+80107bda:	eb ef                	jmp    80107bcb <strncpy+0x31>
+  return os;
+}
+80107bdc:	89 f8                	mov    %edi,%eax
+80107bde:	5b                   	pop    %ebx
+80107bdf:	5e                   	pop    %esi
+80107be0:	5f                   	pop    %edi
+80107be1:	5d                   	pop    %ebp
+80107be2:	c3                   	ret
+
+80107be3 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80107be3:	55                   	push   %ebp
+80107be4:	89 e5                	mov    %esp,%ebp
+80107be6:	57                   	push   %edi
+80107be7:	56                   	push   %esi
+80107be8:	53                   	push   %ebx
+80107be9:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107bec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107bef:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+80107bf2:	85 c0                	test   %eax,%eax
+80107bf4:	7e 23                	jle    80107c19 <safestrcpy+0x36>
+80107bf6:	89 fa                	mov    %edi,%edx
+80107bf8:	eb 04                	jmp    80107bfe <safestrcpy+0x1b>
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80107bfa:	89 f1                	mov    %esi,%ecx
+80107bfc:	89 da                	mov    %ebx,%edx
+80107bfe:	83 e8 01             	sub    $0x1,%eax
+80107c01:	85 c0                	test   %eax,%eax
+80107c03:	7e 11                	jle    80107c16 <safestrcpy+0x33>
+80107c05:	8d 71 01             	lea    0x1(%ecx),%esi
+80107c08:	8d 5a 01             	lea    0x1(%edx),%ebx
+80107c0b:	0f b6 09             	movzbl (%ecx),%ecx
+80107c0e:	88 0a                	mov    %cl,(%edx)
+80107c10:	84 c9                	test   %cl,%cl
+80107c12:	75 e6                	jne    80107bfa <safestrcpy+0x17>
+80107c14:	89 da                	mov    %ebx,%edx
+    ;
+  *s = 0;
+80107c16:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80107c19:	89 f8                	mov    %edi,%eax
+80107c1b:	5b                   	pop    %ebx
+80107c1c:	5e                   	pop    %esi
+80107c1d:	5f                   	pop    %edi
+80107c1e:	5d                   	pop    %ebp
+80107c1f:	c3                   	ret
+
+80107c20 <strlen>:
+
+int
+strlen(const char *s)
+{
+80107c20:	55                   	push   %ebp
+80107c21:	89 e5                	mov    %esp,%ebp
+80107c23:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+80107c26:	b8 00 00 00 00       	mov    $0x0,%eax
+80107c2b:	eb 03                	jmp    80107c30 <strlen+0x10>
+80107c2d:	83 c0 01             	add    $0x1,%eax
+80107c30:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+80107c34:	75 f7                	jne    80107c2d <strlen+0xd>
+    ;
+  return n;
+}
+80107c36:	5d                   	pop    %ebp
+80107c37:	c3                   	ret
+
+80107c38 <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+80107c38:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+80107c3c:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-save registers
+  pushl %ebp
+80107c40:	55                   	push   %ebp
+  pushl %ebx
+80107c41:	53                   	push   %ebx
+  pushl %esi
+80107c42:	56                   	push   %esi
+  pushl %edi
+80107c43:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+80107c44:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80107c46:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-save registers
+  popl %edi
+80107c48:	5f                   	pop    %edi
+  popl %esi
+80107c49:	5e                   	pop    %esi
+  popl %ebx
+80107c4a:	5b                   	pop    %ebx
+  popl %ebp
+80107c4b:	5d                   	pop    %ebp
+  ret
+80107c4c:	c3                   	ret
+
+80107c4d <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+80107c4d:	55                   	push   %ebp
+80107c4e:	89 e5                	mov    %esp,%ebp
+80107c50:	53                   	push   %ebx
+80107c51:	83 ec 04             	sub    $0x4,%esp
+80107c54:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80107c57:	e8 fb e0 ff ff       	call   80105d57 <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80107c5c:	8b 10                	mov    (%eax),%edx
+80107c5e:	39 d3                	cmp    %edx,%ebx
+80107c60:	73 2b                	jae    80107c8d <fetchint+0x40>
+80107c62:	8d 4b 04             	lea    0x4(%ebx),%ecx
+80107c65:	39 ca                	cmp    %ecx,%edx
+80107c67:	72 2b                	jb     80107c94 <fetchint+0x47>
+    return -1;
+  if(prefault(curproc, addr, 4) < 0)
+80107c69:	83 ec 04             	sub    $0x4,%esp
+80107c6c:	6a 04                	push   $0x4
+80107c6e:	53                   	push   %ebx
+80107c6f:	50                   	push   %eax
+80107c70:	e8 de 31 00 00       	call   8010ae53 <prefault>
+80107c75:	83 c4 10             	add    $0x10,%esp
+80107c78:	85 c0                	test   %eax,%eax
+80107c7a:	78 1f                	js     80107c9b <fetchint+0x4e>
+    return -1;
+  *ip = *(int*)(addr);
+80107c7c:	8b 13                	mov    (%ebx),%edx
+80107c7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107c81:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107c83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107c88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107c8b:	c9                   	leave
+80107c8c:	c3                   	ret
+    return -1;
+80107c8d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107c92:	eb f4                	jmp    80107c88 <fetchint+0x3b>
+80107c94:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107c99:	eb ed                	jmp    80107c88 <fetchint+0x3b>
+    return -1;
+80107c9b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ca0:	eb e6                	jmp    80107c88 <fetchint+0x3b>
+
+80107ca2 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80107ca2:	55                   	push   %ebp
+80107ca3:	89 e5                	mov    %esp,%ebp
+80107ca5:	57                   	push   %edi
+80107ca6:	56                   	push   %esi
+80107ca7:	53                   	push   %ebx
+80107ca8:	83 ec 1c             	sub    $0x1c,%esp
+80107cab:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107cae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s, *ep;
+  struct proc *curproc = myproc();
+80107cb1:	e8 a1 e0 ff ff       	call   80105d57 <myproc>
+80107cb6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if(addr >= curproc->sz)
+80107cb9:	3b 38                	cmp    (%eax),%edi
+80107cbb:	73 4a                	jae    80107d07 <fetchstr+0x65>
+    return -1;
+  *pp = (char*)addr;
+80107cbd:	89 fb                	mov    %edi,%ebx
+80107cbf:	89 3e                	mov    %edi,(%esi)
+  ep = (char*)curproc->sz;
+80107cc1:	8b 38                	mov    (%eax),%edi
+  for(s = *pp; s < ep; s++){
+80107cc3:	eb 1d                	jmp    80107ce2 <fetchstr+0x40>
+    if((s == *pp || (uint)s % PGSIZE == 0) && prefault(curproc, (uint)s, 1) < 0)
+80107cc5:	83 ec 04             	sub    $0x4,%esp
+80107cc8:	6a 01                	push   $0x1
+80107cca:	53                   	push   %ebx
+80107ccb:	ff 75 e4             	push   -0x1c(%ebp)
+80107cce:	e8 80 31 00 00       	call   8010ae53 <prefault>
+80107cd3:	83 c4 10             	add    $0x10,%esp
+80107cd6:	85 c0                	test   %eax,%eax
+80107cd8:	78 34                	js     80107d0e <fetchstr+0x6c>
+      return -1;
+    if(*s == 0)
+80107cda:	80 3b 00             	cmpb   $0x0,(%ebx)
+80107cdd:	74 15                	je     80107cf4 <fetchstr+0x52>
+  for(s = *pp; s < ep; s++){
+80107cdf:	83 c3 01             	add    $0x1,%ebx
+80107ce2:	39 fb                	cmp    %edi,%ebx
+80107ce4:	73 14                	jae    80107cfa <fetchstr+0x58>
+    if((s == *pp || (uint)s % PGSIZE == 0) && prefault(curproc, (uint)s, 1) < 0)
+80107ce6:	39 1e                	cmp    %ebx,(%esi)
+80107ce8:	74 db                	je     80107cc5 <fetchstr+0x23>
+80107cea:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80107cf0:	75 e8                	jne    80107cda <fetchstr+0x38>
+80107cf2:	eb d1                	jmp    80107cc5 <fetchstr+0x23>
+      return s - *pp;
+80107cf4:	89 d8                	mov    %ebx,%eax
+80107cf6:	2b 06                	sub    (%esi),%eax
+80107cf8:	eb 05                	jmp    80107cff <fetchstr+0x5d>
+  }
+  return -1;
+80107cfa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107cff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107d02:	5b                   	pop    %ebx
+80107d03:	5e                   	pop    %esi
+80107d04:	5f                   	pop    %edi
+80107d05:	5d                   	pop    %ebp
+80107d06:	c3                   	ret
+    return -1;
+80107d07:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107d0c:	eb f1                	jmp    80107cff <fetchstr+0x5d>
+      return -1;
+80107d0e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107d13:	eb ea                	jmp    80107cff <fetchstr+0x5d>
+
+80107d15 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+80107d15:	55                   	push   %ebp
+80107d16:	89 e5                	mov    %esp,%ebp
+80107d18:	83 ec 08             	sub    $0x8,%esp
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107d1b:	e8 37 e0 ff ff       	call   80105d57 <myproc>
+80107d20:	8b 50 20             	mov    0x20(%eax),%edx
+80107d23:	8b 45 08             	mov    0x8(%ebp),%eax
+80107d26:	c1 e0 02             	shl    $0x2,%eax
+80107d29:	03 42 44             	add    0x44(%edx),%eax
+80107d2c:	83 ec 08             	sub    $0x8,%esp
+80107d2f:	ff 75 0c             	push   0xc(%ebp)
+80107d32:	83 c0 04             	add    $0x4,%eax
+80107d35:	50                   	push   %eax
+80107d36:	e8 12 ff ff ff       	call   80107c4d <fetchint>
+}
+80107d3b:	c9                   	leave
+80107d3c:	c3                   	ret
+
+80107d3d <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+80107d3d:	55                   	push   %ebp
+80107d3e:	89 e5                	mov    %esp,%ebp
+80107d40:	56                   	push   %esi
+80107d41:	53                   	push   %ebx
+80107d42:	83 ec 10             	sub    $0x10,%esp
+80107d45:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+  struct proc *curproc = myproc();
+80107d48:	e8 0a e0 ff ff       	call   80105d57 <myproc>
+80107d4d:	89 c3                	mov    %eax,%ebx
+
+  if(argint(n, &i) < 0)
+80107d4f:	83 ec 08             	sub    $0x8,%esp
+80107d52:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80107d55:	50                   	push   %eax
+80107d56:	ff 75 08             	push   0x8(%ebp)
+80107d59:	e8 b7 ff ff ff       	call   80107d15 <argint>
+80107d5e:	83 c4 10             	add    $0x10,%esp
+80107d61:	85 c0                	test   %eax,%eax
+80107d63:	78 3a                	js     80107d9f <argptr+0x62>
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80107d65:	85 f6                	test   %esi,%esi
+80107d67:	78 3d                	js     80107da6 <argptr+0x69>
+80107d69:	8b 13                	mov    (%ebx),%edx
+80107d6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80107d6e:	39 d0                	cmp    %edx,%eax
+80107d70:	73 3b                	jae    80107dad <argptr+0x70>
+80107d72:	8d 0c 30             	lea    (%eax,%esi,1),%ecx
+80107d75:	39 ca                	cmp    %ecx,%edx
+80107d77:	72 3b                	jb     80107db4 <argptr+0x77>
+    return -1;
+  if(prefault(curproc, i, size) < 0)
+80107d79:	83 ec 04             	sub    $0x4,%esp
+80107d7c:	56                   	push   %esi
+80107d7d:	50                   	push   %eax
+80107d7e:	53                   	push   %ebx
+80107d7f:	e8 cf 30 00 00       	call   8010ae53 <prefault>
+80107d84:	83 c4 10             	add    $0x10,%esp
+80107d87:	85 c0                	test   %eax,%eax
+80107d89:	78 30                	js     80107dbb <argptr+0x7e>
+    return -1;
+  *pp = (char*)i;
+80107d8b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107d8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107d91:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107d93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107d98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107d9b:	5b                   	pop    %ebx
+80107d9c:	5e                   	pop    %esi
+80107d9d:	5d                   	pop    %ebp
+80107d9e:	c3                   	ret
+    return -1;
+80107d9f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107da4:	eb f2                	jmp    80107d98 <argptr+0x5b>
+    return -1;
+80107da6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107dab:	eb eb                	jmp    80107d98 <argptr+0x5b>
+80107dad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107db2:	eb e4                	jmp    80107d98 <argptr+0x5b>
+80107db4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107db9:	eb dd                	jmp    80107d98 <argptr+0x5b>
+    return -1;
+80107dbb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107dc0:	eb d6                	jmp    80107d98 <argptr+0x5b>
+
+80107dc2 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80107dc2:	55                   	push   %ebp
+80107dc3:	89 e5                	mov    %esp,%ebp
+80107dc5:	83 ec 20             	sub    $0x20,%esp
+  int addr;
+  if(argint(n, &addr) < 0)
+80107dc8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80107dcb:	50                   	push   %eax
+80107dcc:	ff 75 08             	push   0x8(%ebp)
+80107dcf:	e8 41 ff ff ff       	call   80107d15 <argint>
+80107dd4:	83 c4 10             	add    $0x10,%esp
+80107dd7:	85 c0                	test   %eax,%eax
+80107dd9:	78 13                	js     80107dee <argstr+0x2c>
+    return -1;
+  return fetchstr(addr, pp);
+80107ddb:	83 ec 08             	sub    $0x8,%esp
+80107dde:	ff 75 0c             	push   0xc(%ebp)
+80107de1:	ff 75 f4             	push   -0xc(%ebp)
+80107de4:	e8 b9 fe ff ff       	call   80107ca2 <fetchstr>
+80107de9:	83 c4 10             	add    $0x10,%esp
+}
+80107dec:	c9                   	leave
+80107ded:	c3                   	ret
+    return -1;
+80107dee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107df3:	eb f7                	jmp    80107dec <argstr+0x2a>
+
+80107df5 <syscall>:
+};
+#endif // PRINT_SYSCALLS
+
+void
+syscall(void)
+{
+80107df5:	55                   	push   %ebp
+80107df6:	89 e5                	mov    %esp,%ebp
+80107df8:	53                   	push   %ebx
+80107df9:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+80107dfc:	e8 56 df ff ff       	call   80105d57 <myproc>
+80107e01:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+80107e03:	8b 40 20             	mov    0x20(%eax),%eax
+80107e06:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+80107e09:	8d 50 ff             	lea    -0x1(%eax),%edx
+80107e0c:	83 fa 20             	cmp    $0x20,%edx
+80107e0f:	77 17                	ja     80107e28 <syscall+0x33>
+80107e11:	8b 14 85 60 bc 10 80 	mov    -0x7fef43a0(,%eax,4),%edx
+80107e18:	85 d2                	test   %edx,%edx
+80107e1a:	74 0c                	je     80107e28 <syscall+0x33>
+    curproc->tf->eax = syscalls[num]();
+80107e1c:	ff d2                	call   *%edx
+80107e1e:	89 c2                	mov    %eax,%edx
+80107e20:	8b 43 20             	mov    0x20(%ebx),%eax
+80107e23:	89 50 1c             	mov    %edx,0x1c(%eax)
+80107e26:	eb 22                	jmp    80107e4a <syscall+0x55>
+  #ifdef PRINT_SYSCALLS
+    cprintf("%s -> %d\n", syscallnames[num], curproc->tf->eax);
+  #endif // PRINT_SYSCALLS
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+80107e28:	8d 93 b4 00 00 00    	lea    0xb4(%ebx),%edx
+    cprintf("%d %s: unknown sys call %d\n",
+80107e2e:	50                   	push   %eax
+80107e2f:	52                   	push   %edx
+80107e30:	ff 73 10             	push   0x10(%ebx)
+80107e33:	68 35 bc 10 80       	push   $0x8010bc35
+80107e38:	e8 aa 8f ff ff       	call   80100de7 <cprintf>
+    curproc->tf->eax = -1;
+80107e3d:	8b 43 20             	mov    0x20(%ebx),%eax
+80107e40:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+80107e47:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80107e4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107e4d:	c9                   	leave
+80107e4e:	c3                   	ret
+
+80107e4f <argfd>:
+
+// Fetch the nth word-sized system call argument as a file descriptor
+// and return both the descriptor and the corresponding struct file.
+static int
+argfd(int n, int *pfd, struct file **pf)
+{
+80107e4f:	55                   	push   %ebp
+80107e50:	89 e5                	mov    %esp,%ebp
+80107e52:	56                   	push   %esi
+80107e53:	53                   	push   %ebx
+80107e54:	83 ec 18             	sub    $0x18,%esp
+80107e57:	89 d6                	mov    %edx,%esi
+80107e59:	89 cb                	mov    %ecx,%ebx
+  int fd;
+  struct file *f;
+
+  if(argint(n, &fd) < 0)
+80107e5b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80107e5e:	52                   	push   %edx
+80107e5f:	50                   	push   %eax
+80107e60:	e8 b0 fe ff ff       	call   80107d15 <argint>
+80107e65:	83 c4 10             	add    $0x10,%esp
+80107e68:	85 c0                	test   %eax,%eax
+80107e6a:	78 4c                	js     80107eb8 <argfd+0x69>
+    return -1;
+  if(fd < 0 || fd >= myproc()->nofile || (f=myproc()->ofile[fd]) == 0)
+80107e6c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+80107e70:	78 3f                	js     80107eb1 <argfd+0x62>
+80107e72:	e8 e0 de ff ff       	call   80105d57 <myproc>
+80107e77:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+80107e7a:	39 48 34             	cmp    %ecx,0x34(%eax)
+80107e7d:	7e 32                	jle    80107eb1 <argfd+0x62>
+80107e7f:	e8 d3 de ff ff       	call   80105d57 <myproc>
+80107e84:	89 c1                	mov    %eax,%ecx
+80107e86:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107e89:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+80107e90:	03 41 30             	add    0x30(%ecx),%eax
+80107e93:	8b 00                	mov    (%eax),%eax
+80107e95:	85 c0                	test   %eax,%eax
+80107e97:	74 18                	je     80107eb1 <argfd+0x62>
+    return -1;
+  if(pfd)
+80107e99:	85 f6                	test   %esi,%esi
+80107e9b:	74 02                	je     80107e9f <argfd+0x50>
+    *pfd = fd;
+80107e9d:	89 16                	mov    %edx,(%esi)
+  if(pf)
+80107e9f:	85 db                	test   %ebx,%ebx
+80107ea1:	74 1c                	je     80107ebf <argfd+0x70>
+    *pf = f;
+80107ea3:	89 03                	mov    %eax,(%ebx)
+  return 0;
+80107ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107eaa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107ead:	5b                   	pop    %ebx
+80107eae:	5e                   	pop    %esi
+80107eaf:	5d                   	pop    %ebp
+80107eb0:	c3                   	ret
+    return -1;
+80107eb1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107eb6:	eb f2                	jmp    80107eaa <argfd+0x5b>
+    return -1;
+80107eb8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ebd:	eb eb                	jmp    80107eaa <argfd+0x5b>
+  return 0;
+80107ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+80107ec4:	eb e4                	jmp    80107eaa <argfd+0x5b>
+
+80107ec6 <fdalloc>:
+
+// Allocate a file descriptor for the given file.
+// Takes over file reference from caller on success.
+static int
+fdalloc(struct file *f)
+{
+80107ec6:	55                   	push   %ebp
+80107ec7:	89 e5                	mov    %esp,%ebp
+80107ec9:	57                   	push   %edi
+80107eca:	56                   	push   %esi
+80107ecb:	53                   	push   %ebx
+80107ecc:	83 ec 0c             	sub    $0xc,%esp
+80107ecf:	89 c7                	mov    %eax,%edi
+  int fd;
+  struct proc *curproc = myproc();
+80107ed1:	e8 81 de ff ff       	call   80105d57 <myproc>
+80107ed6:	89 c6                	mov    %eax,%esi
+
+  for(fd = 0; fd < curproc->nofile; fd++){
+80107ed8:	bb 00 00 00 00       	mov    $0x0,%ebx
+80107edd:	eb 03                	jmp    80107ee2 <fdalloc+0x1c>
+80107edf:	83 c3 01             	add    $0x1,%ebx
+80107ee2:	39 5e 34             	cmp    %ebx,0x34(%esi)
+80107ee5:	7e 13                	jle    80107efa <fdalloc+0x34>
+    if(curproc->ofile[fd] == 0){
+80107ee7:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+80107eee:	03 46 30             	add    0x30(%esi),%eax
+80107ef1:	83 38 00             	cmpl   $0x0,(%eax)
+80107ef4:	75 e9                	jne    80107edf <fdalloc+0x19>
+      curproc->ofile[fd] = f;
+80107ef6:	89 38                	mov    %edi,(%eax)
+      return fd;
+80107ef8:	eb 1c                	jmp    80107f16 <fdalloc+0x50>
+    }
+  }
+  if(ofilegrow(curproc) < 0)
+80107efa:	83 ec 0c             	sub    $0xc,%esp
+80107efd:	56                   	push   %esi
+80107efe:	e8 77 de ff ff       	call   80105d7a <ofilegrow>
+80107f03:	83 c4 10             	add    $0x10,%esp
+80107f06:	85 c0                	test   %eax,%eax
+80107f08:	78 16                	js     80107f20 <fdalloc+0x5a>
+    return -1;
+  curproc->ofile[fd] = f;
+80107f0a:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+80107f11:	03 46 30             	add    0x30(%esi),%eax
+80107f14:	89 38                	mov    %edi,(%eax)
+  return fd;
+}
+80107f16:	89 d8                	mov    %ebx,%eax
+80107f18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107f1b:	5b                   	pop    %ebx
+80107f1c:	5e                   	pop    %esi
+80107f1d:	5f                   	pop    %edi
+80107f1e:	5d                   	pop    %ebp
+80107f1f:	c3                   	ret
+    return -1;
+80107f20:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80107f25:	eb ef                	jmp    80107f16 <fdalloc+0x50>
+
+80107f27 <isdirempty>:
+}
+
+// Is the directory dp empty except for "." and ".." ?
+static int
+isdirempty(struct inode *dp)
+{
+80107f27:	55                   	push   %ebp
+80107f28:	89 e5                	mov    %esp,%ebp
+80107f2a:	56                   	push   %esi
+80107f2b:	53                   	push   %ebx
+80107f2c:	83 ec 10             	sub    $0x10,%esp
+80107f2f:	89 c3                	mov    %eax,%ebx
+  int off;
+  struct dirent de;
+
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80107f31:	b8 20 00 00 00       	mov    $0x20,%eax
+80107f36:	89 c6                	mov    %eax,%esi
+80107f38:	3b 43 64             	cmp    0x64(%ebx),%eax
+80107f3b:	73 2e                	jae    80107f6b <isdirempty+0x44>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80107f3d:	6a 10                	push   $0x10
+80107f3f:	50                   	push   %eax
+80107f40:	8d 45 e8             	lea    -0x18(%ebp),%eax
+80107f43:	50                   	push   %eax
+80107f44:	53                   	push   %ebx
+80107f45:	e8 1e b1 ff ff       	call   80103068 <readi>
+80107f4a:	83 c4 10             	add    $0x10,%esp
+80107f4d:	83 f8 10             	cmp    $0x10,%eax
+80107f50:	75 0c                	jne    80107f5e <isdirempty+0x37>
+      panic("isdirempty: readi");
+    if(de.inum != 0)
+80107f52:	66 83 7d e8 00       	cmpw   $0x0,-0x18(%ebp)
+80107f57:	75 1e                	jne    80107f77 <isdirempty+0x50>
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80107f59:	8d 46 10             	lea    0x10(%esi),%eax
+80107f5c:	eb d8                	jmp    80107f36 <isdirempty+0xf>
+      panic("isdirempty: readi");
+80107f5e:	83 ec 0c             	sub    $0xc,%esp
+80107f61:	68 e8 bc 10 80       	push   $0x8010bce8
+80107f66:	e8 bb 8b ff ff       	call   80100b26 <panic>
+      return 0;
+  }
+  return 1;
+80107f6b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80107f70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107f73:	5b                   	pop    %ebx
+80107f74:	5e                   	pop    %esi
+80107f75:	5d                   	pop    %ebp
+80107f76:	c3                   	ret
+      return 0;
+80107f77:	b8 00 00 00 00       	mov    $0x0,%eax
+80107f7c:	eb f2                	jmp    80107f70 <isdirempty+0x49>
+
+80107f7e <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+80107f7e:	55                   	push   %ebp
+80107f7f:	89 e5                	mov    %esp,%ebp
+80107f81:	57                   	push   %edi
+80107f82:	56                   	push   %esi
+80107f83:	53                   	push   %ebx
+80107f84:	83 ec 44             	sub    $0x44,%esp
+80107f87:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+80107f8a:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+80107f8d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  uint off;
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+80107f90:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+80107f93:	52                   	push   %edx
+80107f94:	50                   	push   %eax
+80107f95:	e8 9a ba ff ff       	call   80103a34 <nameiparent>
+80107f9a:	89 c6                	mov    %eax,%esi
+80107f9c:	83 c4 10             	add    $0x10,%esp
+80107f9f:	85 c0                	test   %eax,%eax
+80107fa1:	0f 84 35 01 00 00    	je     801080dc <create+0x15e>
+    return 0;
+  ilock(dp);
+80107fa7:	83 ec 0c             	sub    $0xc,%esp
+80107faa:	50                   	push   %eax
+80107fab:	e8 f4 ad ff ff       	call   80102da4 <ilock>
+
+  if((ip = dirlookup(dp, name, &off)) != 0){
+80107fb0:	83 c4 0c             	add    $0xc,%esp
+80107fb3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80107fb6:	50                   	push   %eax
+80107fb7:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+80107fba:	50                   	push   %eax
+80107fbb:	56                   	push   %esi
+80107fbc:	e8 bd b5 ff ff       	call   8010357e <dirlookup>
+80107fc1:	89 c3                	mov    %eax,%ebx
+80107fc3:	83 c4 10             	add    $0x10,%esp
+80107fc6:	85 c0                	test   %eax,%eax
+80107fc8:	74 3d                	je     80108007 <create+0x89>
+    iunlockput(dp);
+80107fca:	83 ec 0c             	sub    $0xc,%esp
+80107fcd:	56                   	push   %esi
+80107fce:	e8 c8 af ff ff       	call   80102f9b <iunlockput>
+    ilock(ip);
+80107fd3:	89 1c 24             	mov    %ebx,(%esp)
+80107fd6:	e8 c9 ad ff ff       	call   80102da4 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80107fdb:	83 c4 10             	add    $0x10,%esp
+80107fde:	66 83 7d c4 02       	cmpw   $0x2,-0x3c(%ebp)
+80107fe3:	75 07                	jne    80107fec <create+0x6e>
+80107fe5:	66 83 7b 5c 02       	cmpw   $0x2,0x5c(%ebx)
+80107fea:	74 11                	je     80107ffd <create+0x7f>
+      return ip;
+    iunlockput(ip);
+80107fec:	83 ec 0c             	sub    $0xc,%esp
+80107fef:	53                   	push   %ebx
+80107ff0:	e8 a6 af ff ff       	call   80102f9b <iunlockput>
+    return 0;
+80107ff5:	83 c4 10             	add    $0x10,%esp
+80107ff8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80107ffd:	89 d8                	mov    %ebx,%eax
+80107fff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108002:	5b                   	pop    %ebx
+80108003:	5e                   	pop    %esi
+80108004:	5f                   	pop    %edi
+80108005:	5d                   	pop    %ebp
+80108006:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80108007:	83 ec 08             	sub    $0x8,%esp
+8010800a:	0f bf 45 c4          	movswl -0x3c(%ebp),%eax
+8010800e:	50                   	push   %eax
+8010800f:	ff 36                	push   (%esi)
+80108011:	e8 fb aa ff ff       	call   80102b11 <ialloc>
+80108016:	89 c3                	mov    %eax,%ebx
+80108018:	83 c4 10             	add    $0x10,%esp
+8010801b:	85 c0                	test   %eax,%eax
+8010801d:	74 52                	je     80108071 <create+0xf3>
+  ilock(ip);
+8010801f:	83 ec 0c             	sub    $0xc,%esp
+80108022:	50                   	push   %eax
+80108023:	e8 7c ad ff ff       	call   80102da4 <ilock>
+  ip->major = major;
+80108028:	0f b7 45 c0          	movzwl -0x40(%ebp),%eax
+8010802c:	66 89 43 5e          	mov    %ax,0x5e(%ebx)
+  ip->minor = minor;
+80108030:	66 89 7b 60          	mov    %di,0x60(%ebx)
+  ip->nlink = 1;
+80108034:	66 c7 43 62 01 00    	movw   $0x1,0x62(%ebx)
+  iupdate(ip);
+8010803a:	89 1c 24             	mov    %ebx,(%esp)
+8010803d:	e8 ce ab ff ff       	call   80102c10 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80108042:	83 c4 10             	add    $0x10,%esp
+80108045:	66 83 7d c4 01       	cmpw   $0x1,-0x3c(%ebp)
+8010804a:	74 32                	je     8010807e <create+0x100>
+  if(dirlink(dp, name, ip->inum) < 0)
+8010804c:	83 ec 04             	sub    $0x4,%esp
+8010804f:	ff 73 04             	push   0x4(%ebx)
+80108052:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+80108055:	50                   	push   %eax
+80108056:	56                   	push   %esi
+80108057:	e8 d9 b7 ff ff       	call   80103835 <dirlink>
+8010805c:	83 c4 10             	add    $0x10,%esp
+8010805f:	85 c0                	test   %eax,%eax
+80108061:	78 6c                	js     801080cf <create+0x151>
+  iunlockput(dp);
+80108063:	83 ec 0c             	sub    $0xc,%esp
+80108066:	56                   	push   %esi
+80108067:	e8 2f af ff ff       	call   80102f9b <iunlockput>
+  return ip;
+8010806c:	83 c4 10             	add    $0x10,%esp
+8010806f:	eb 8c                	jmp    80107ffd <create+0x7f>
+    panic("create: ialloc");
+80108071:	83 ec 0c             	sub    $0xc,%esp
+80108074:	68 fa bc 10 80       	push   $0x8010bcfa
+80108079:	e8 a8 8a ff ff       	call   80100b26 <panic>
+    dp->nlink++;  // for ".."
+8010807e:	0f b7 46 62          	movzwl 0x62(%esi),%eax
+80108082:	83 c0 01             	add    $0x1,%eax
+80108085:	66 89 46 62          	mov    %ax,0x62(%esi)
+    iupdate(dp);
+80108089:	83 ec 0c             	sub    $0xc,%esp
+8010808c:	56                   	push   %esi
+8010808d:	e8 7e ab ff ff       	call   80102c10 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+80108092:	83 c4 0c             	add    $0xc,%esp
+80108095:	ff 73 04             	push   0x4(%ebx)
+80108098:	68 0a bd 10 80       	push   $0x8010bd0a
+8010809d:	53                   	push   %ebx
+8010809e:	e8 92 b7 ff ff       	call   80103835 <dirlink>
+801080a3:	83 c4 10             	add    $0x10,%esp
+801080a6:	85 c0                	test   %eax,%eax
+801080a8:	78 18                	js     801080c2 <create+0x144>
+801080aa:	83 ec 04             	sub    $0x4,%esp
+801080ad:	ff 76 04             	push   0x4(%esi)
+801080b0:	68 09 bd 10 80       	push   $0x8010bd09
+801080b5:	53                   	push   %ebx
+801080b6:	e8 7a b7 ff ff       	call   80103835 <dirlink>
+801080bb:	83 c4 10             	add    $0x10,%esp
+801080be:	85 c0                	test   %eax,%eax
+801080c0:	79 8a                	jns    8010804c <create+0xce>
+      panic("create dots");
+801080c2:	83 ec 0c             	sub    $0xc,%esp
+801080c5:	68 0c bd 10 80       	push   $0x8010bd0c
+801080ca:	e8 57 8a ff ff       	call   80100b26 <panic>
+    panic("create: dirlink");
+801080cf:	83 ec 0c             	sub    $0xc,%esp
+801080d2:	68 18 bd 10 80       	push   $0x8010bd18
+801080d7:	e8 4a 8a ff ff       	call   80100b26 <panic>
+    return 0;
+801080dc:	89 c3                	mov    %eax,%ebx
+801080de:	e9 1a ff ff ff       	jmp    80107ffd <create+0x7f>
+
+801080e3 <sys_dup>:
+{
+801080e3:	55                   	push   %ebp
+801080e4:	89 e5                	mov    %esp,%ebp
+801080e6:	53                   	push   %ebx
+801080e7:	83 ec 14             	sub    $0x14,%esp
+  if(argfd(0, 0, &f) < 0)
+801080ea:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+801080ed:	ba 00 00 00 00       	mov    $0x0,%edx
+801080f2:	b8 00 00 00 00       	mov    $0x0,%eax
+801080f7:	e8 53 fd ff ff       	call   80107e4f <argfd>
+801080fc:	85 c0                	test   %eax,%eax
+801080fe:	78 23                	js     80108123 <sys_dup+0x40>
+  if((fd=fdalloc(f)) < 0)
+80108100:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108103:	e8 be fd ff ff       	call   80107ec6 <fdalloc>
+80108108:	89 c3                	mov    %eax,%ebx
+8010810a:	85 c0                	test   %eax,%eax
+8010810c:	78 1c                	js     8010812a <sys_dup+0x47>
+  filedup(f);
+8010810e:	83 ec 0c             	sub    $0xc,%esp
+80108111:	ff 75 f4             	push   -0xc(%ebp)
+80108114:	e8 18 96 ff ff       	call   80101731 <filedup>
+  return fd;
+80108119:	83 c4 10             	add    $0x10,%esp
+}
+8010811c:	89 d8                	mov    %ebx,%eax
+8010811e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108121:	c9                   	leave
+80108122:	c3                   	ret
+    return -1;
+80108123:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108128:	eb f2                	jmp    8010811c <sys_dup+0x39>
+    return -1;
+8010812a:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010812f:	eb eb                	jmp    8010811c <sys_dup+0x39>
+
+80108131 <sys_read>:
+{
+80108131:	55                   	push   %ebp
+80108132:	89 e5                	mov    %esp,%ebp
+80108134:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80108137:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+8010813a:	ba 00 00 00 00       	mov    $0x0,%edx
+8010813f:	b8 00 00 00 00       	mov    $0x0,%eax
+80108144:	e8 06 fd ff ff       	call   80107e4f <argfd>
+80108149:	85 c0                	test   %eax,%eax
+8010814b:	78 43                	js     80108190 <sys_read+0x5f>
+8010814d:	83 ec 08             	sub    $0x8,%esp
+80108150:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108153:	50                   	push   %eax
+80108154:	6a 02                	push   $0x2
+80108156:	e8 ba fb ff ff       	call   80107d15 <argint>
+8010815b:	83 c4 10             	add    $0x10,%esp
+8010815e:	85 c0                	test   %eax,%eax
+80108160:	78 2e                	js     80108190 <sys_read+0x5f>
+80108162:	83 ec 04             	sub    $0x4,%esp
+80108165:	ff 75 f0             	push   -0x10(%ebp)
+80108168:	8d 45 ec             	lea    -0x14(%ebp),%eax
+8010816b:	50                   	push   %eax
+8010816c:	6a 01                	push   $0x1
+8010816e:	e8 ca fb ff ff       	call   80107d3d <argptr>
+80108173:	83 c4 10             	add    $0x10,%esp
+80108176:	85 c0                	test   %eax,%eax
+80108178:	78 16                	js     80108190 <sys_read+0x5f>
+  return fileread(f, p, n);
+8010817a:	83 ec 04             	sub    $0x4,%esp
+8010817d:	ff 75 f0             	push   -0x10(%ebp)
+80108180:	ff 75 ec             	push   -0x14(%ebp)
+80108183:	ff 75 f4             	push   -0xc(%ebp)
+80108186:	e8 26 97 ff ff       	call   801018b1 <fileread>
+8010818b:	83 c4 10             	add    $0x10,%esp
+}
+8010818e:	c9                   	leave
+8010818f:	c3                   	ret
+    return -1;
+80108190:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108195:	eb f7                	jmp    8010818e <sys_read+0x5d>
+
+80108197 <sys_write>:
+{
+80108197:	55                   	push   %ebp
+80108198:	89 e5                	mov    %esp,%ebp
+8010819a:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+8010819d:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+801081a0:	ba 00 00 00 00       	mov    $0x0,%edx
+801081a5:	b8 00 00 00 00       	mov    $0x0,%eax
+801081aa:	e8 a0 fc ff ff       	call   80107e4f <argfd>
+801081af:	85 c0                	test   %eax,%eax
+801081b1:	78 43                	js     801081f6 <sys_write+0x5f>
+801081b3:	83 ec 08             	sub    $0x8,%esp
+801081b6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801081b9:	50                   	push   %eax
+801081ba:	6a 02                	push   $0x2
+801081bc:	e8 54 fb ff ff       	call   80107d15 <argint>
+801081c1:	83 c4 10             	add    $0x10,%esp
+801081c4:	85 c0                	test   %eax,%eax
+801081c6:	78 2e                	js     801081f6 <sys_write+0x5f>
+801081c8:	83 ec 04             	sub    $0x4,%esp
+801081cb:	ff 75 f0             	push   -0x10(%ebp)
+801081ce:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801081d1:	50                   	push   %eax
+801081d2:	6a 01                	push   $0x1
+801081d4:	e8 64 fb ff ff       	call   80107d3d <argptr>
+801081d9:	83 c4 10             	add    $0x10,%esp
+801081dc:	85 c0                	test   %eax,%eax
+801081de:	78 16                	js     801081f6 <sys_write+0x5f>
+  return filewrite(f, p, n);
+801081e0:	83 ec 04             	sub    $0x4,%esp
+801081e3:	ff 75 f0             	push   -0x10(%ebp)
+801081e6:	ff 75 ec             	push   -0x14(%ebp)
+801081e9:	ff 75 f4             	push   -0xc(%ebp)
+801081ec:	e8 c4 97 ff ff       	call   801019b5 <filewrite>
+801081f1:	83 c4 10             	add    $0x10,%esp
+}
+801081f4:	c9                   	leave
+801081f5:	c3                   	ret
+    return -1;
+801081f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801081fb:	eb f7                	jmp    801081f4 <sys_write+0x5d>
+
+801081fd <sys_close>:
+{
+801081fd:	55                   	push   %ebp
+801081fe:	89 e5                	mov    %esp,%ebp
+80108200:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, &fd, &f) < 0)
+80108203:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+80108206:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80108209:	b8 00 00 00 00       	mov    $0x0,%eax
+8010820e:	e8 3c fc ff ff       	call   80107e4f <argfd>
+80108213:	85 c0                	test   %eax,%eax
+80108215:	78 2b                	js     80108242 <sys_close+0x45>
+  myproc()->ofile[fd] = 0;
+80108217:	e8 3b db ff ff       	call   80105d57 <myproc>
+8010821c:	89 c2                	mov    %eax,%edx
+8010821e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108221:	c1 e0 02             	shl    $0x2,%eax
+80108224:	03 42 30             	add    0x30(%edx),%eax
+80108227:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  fileclose(f);
+8010822d:	83 ec 0c             	sub    $0xc,%esp
+80108230:	ff 75 f0             	push   -0x10(%ebp)
+80108233:	e8 3e 95 ff ff       	call   80101776 <fileclose>
+  return 0;
+80108238:	83 c4 10             	add    $0x10,%esp
+8010823b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108240:	c9                   	leave
+80108241:	c3                   	ret
+    return -1;
+80108242:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108247:	eb f7                	jmp    80108240 <sys_close+0x43>
+
+80108249 <sys_fstat>:
+{
+80108249:	55                   	push   %ebp
+8010824a:	89 e5                	mov    %esp,%ebp
+8010824c:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+8010824f:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80108252:	ba 00 00 00 00       	mov    $0x0,%edx
+80108257:	b8 00 00 00 00       	mov    $0x0,%eax
+8010825c:	e8 ee fb ff ff       	call   80107e4f <argfd>
+80108261:	85 c0                	test   %eax,%eax
+80108263:	78 2a                	js     8010828f <sys_fstat+0x46>
+80108265:	83 ec 04             	sub    $0x4,%esp
+80108268:	6a 14                	push   $0x14
+8010826a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+8010826d:	50                   	push   %eax
+8010826e:	6a 01                	push   $0x1
+80108270:	e8 c8 fa ff ff       	call   80107d3d <argptr>
+80108275:	83 c4 10             	add    $0x10,%esp
+80108278:	85 c0                	test   %eax,%eax
+8010827a:	78 13                	js     8010828f <sys_fstat+0x46>
+  return filestat(f, st);
+8010827c:	83 ec 08             	sub    $0x8,%esp
+8010827f:	ff 75 f0             	push   -0x10(%ebp)
+80108282:	ff 75 f4             	push   -0xc(%ebp)
+80108285:	e8 e0 95 ff ff       	call   8010186a <filestat>
+8010828a:	83 c4 10             	add    $0x10,%esp
+}
+8010828d:	c9                   	leave
+8010828e:	c3                   	ret
+    return -1;
+8010828f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108294:	eb f7                	jmp    8010828d <sys_fstat+0x44>
+
+80108296 <sys_link>:
+{
+80108296:	55                   	push   %ebp
+80108297:	89 e5                	mov    %esp,%ebp
+80108299:	56                   	push   %esi
+8010829a:	53                   	push   %ebx
+8010829b:	83 ec 28             	sub    $0x28,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+8010829e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+801082a1:	50                   	push   %eax
+801082a2:	6a 00                	push   $0x0
+801082a4:	e8 19 fb ff ff       	call   80107dc2 <argstr>
+801082a9:	83 c4 10             	add    $0x10,%esp
+801082ac:	85 c0                	test   %eax,%eax
+801082ae:	0f 88 d3 00 00 00    	js     80108387 <sys_link+0xf1>
+801082b4:	83 ec 08             	sub    $0x8,%esp
+801082b7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801082ba:	50                   	push   %eax
+801082bb:	6a 01                	push   $0x1
+801082bd:	e8 00 fb ff ff       	call   80107dc2 <argstr>
+801082c2:	83 c4 10             	add    $0x10,%esp
+801082c5:	85 c0                	test   %eax,%eax
+801082c7:	0f 88 ba 00 00 00    	js     80108387 <sys_link+0xf1>
+  begin_op();
+801082cd:	e8 25 c4 ff ff       	call   801046f7 <begin_op>
+  if((ip = namei(old)) == 0){
+801082d2:	83 ec 0c             	sub    $0xc,%esp
+801082d5:	ff 75 e0             	push   -0x20(%ebp)
+801082d8:	e8 3f b7 ff ff       	call   80103a1c <namei>
+801082dd:	89 c3                	mov    %eax,%ebx
+801082df:	83 c4 10             	add    $0x10,%esp
+801082e2:	85 c0                	test   %eax,%eax
+801082e4:	0f 84 a4 00 00 00    	je     8010838e <sys_link+0xf8>
+  ilock(ip);
+801082ea:	83 ec 0c             	sub    $0xc,%esp
+801082ed:	50                   	push   %eax
+801082ee:	e8 b1 aa ff ff       	call   80102da4 <ilock>
+  if(ip->type == T_DIR){
+801082f3:	83 c4 10             	add    $0x10,%esp
+801082f6:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+801082fb:	0f 84 99 00 00 00    	je     8010839a <sys_link+0x104>
+  ip->nlink++;
+80108301:	0f b7 43 62          	movzwl 0x62(%ebx),%eax
+80108305:	83 c0 01             	add    $0x1,%eax
+80108308:	66 89 43 62          	mov    %ax,0x62(%ebx)
+  iupdate(ip);
+8010830c:	83 ec 0c             	sub    $0xc,%esp
+8010830f:	53                   	push   %ebx
+80108310:	e8 fb a8 ff ff       	call   80102c10 <iupdate>
+  iunlock(ip);
+80108315:	89 1c 24             	mov    %ebx,(%esp)
+80108318:	e8 5c ab ff ff       	call   80102e79 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+8010831d:	83 c4 08             	add    $0x8,%esp
+80108320:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80108323:	50                   	push   %eax
+80108324:	ff 75 e4             	push   -0x1c(%ebp)
+80108327:	e8 08 b7 ff ff       	call   80103a34 <nameiparent>
+8010832c:	89 c6                	mov    %eax,%esi
+8010832e:	83 c4 10             	add    $0x10,%esp
+80108331:	85 c0                	test   %eax,%eax
+80108333:	0f 84 85 00 00 00    	je     801083be <sys_link+0x128>
+  ilock(dp);
+80108339:	83 ec 0c             	sub    $0xc,%esp
+8010833c:	50                   	push   %eax
+8010833d:	e8 62 aa ff ff       	call   80102da4 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80108342:	83 c4 10             	add    $0x10,%esp
+80108345:	8b 03                	mov    (%ebx),%eax
+80108347:	39 06                	cmp    %eax,(%esi)
+80108349:	75 67                	jne    801083b2 <sys_link+0x11c>
+8010834b:	83 ec 04             	sub    $0x4,%esp
+8010834e:	ff 73 04             	push   0x4(%ebx)
+80108351:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80108354:	50                   	push   %eax
+80108355:	56                   	push   %esi
+80108356:	e8 da b4 ff ff       	call   80103835 <dirlink>
+8010835b:	83 c4 10             	add    $0x10,%esp
+8010835e:	85 c0                	test   %eax,%eax
+80108360:	78 50                	js     801083b2 <sys_link+0x11c>
+  iunlockput(dp);
+80108362:	83 ec 0c             	sub    $0xc,%esp
+80108365:	56                   	push   %esi
+80108366:	e8 30 ac ff ff       	call   80102f9b <iunlockput>
+  iput(ip);
+8010836b:	89 1c 24             	mov    %ebx,(%esp)
+8010836e:	e8 4b ab ff ff       	call   80102ebe <iput>
+  end_op();
+80108373:	e8 f9 c3 ff ff       	call   80104771 <end_op>
+  return 0;
+80108378:	83 c4 10             	add    $0x10,%esp
+8010837b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108380:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108383:	5b                   	pop    %ebx
+80108384:	5e                   	pop    %esi
+80108385:	5d                   	pop    %ebp
+80108386:	c3                   	ret
+    return -1;
+80108387:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010838c:	eb f2                	jmp    80108380 <sys_link+0xea>
+    end_op();
+8010838e:	e8 de c3 ff ff       	call   80104771 <end_op>
+    return -1;
+80108393:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108398:	eb e6                	jmp    80108380 <sys_link+0xea>
+    iunlockput(ip);
+8010839a:	83 ec 0c             	sub    $0xc,%esp
+8010839d:	53                   	push   %ebx
+8010839e:	e8 f8 ab ff ff       	call   80102f9b <iunlockput>
+    end_op();
+801083a3:	e8 c9 c3 ff ff       	call   80104771 <end_op>
+    return -1;
+801083a8:	83 c4 10             	add    $0x10,%esp
+801083ab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801083b0:	eb ce                	jmp    80108380 <sys_link+0xea>
+    iunlockput(dp);
+801083b2:	83 ec 0c             	sub    $0xc,%esp
+801083b5:	56                   	push   %esi
+801083b6:	e8 e0 ab ff ff       	call   80102f9b <iunlockput>
+    goto bad;
+801083bb:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+801083be:	83 ec 0c             	sub    $0xc,%esp
+801083c1:	53                   	push   %ebx
+801083c2:	e8 dd a9 ff ff       	call   80102da4 <ilock>
+  ip->nlink--;
+801083c7:	0f b7 43 62          	movzwl 0x62(%ebx),%eax
+801083cb:	83 e8 01             	sub    $0x1,%eax
+801083ce:	66 89 43 62          	mov    %ax,0x62(%ebx)
+  iupdate(ip);
+801083d2:	89 1c 24             	mov    %ebx,(%esp)
+801083d5:	e8 36 a8 ff ff       	call   80102c10 <iupdate>
+  iunlockput(ip);
+801083da:	89 1c 24             	mov    %ebx,(%esp)
+801083dd:	e8 b9 ab ff ff       	call   80102f9b <iunlockput>
+  end_op();
+801083e2:	e8 8a c3 ff ff       	call   80104771 <end_op>
+  return -1;
+801083e7:	83 c4 10             	add    $0x10,%esp
+801083ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801083ef:	eb 8f                	jmp    80108380 <sys_link+0xea>
+
+801083f1 <sys_unlink>:
+{
+801083f1:	55                   	push   %ebp
+801083f2:	89 e5                	mov    %esp,%ebp
+801083f4:	56                   	push   %esi
+801083f5:	53                   	push   %ebx
+801083f6:	83 ec 28             	sub    $0x28,%esp
+  if(argstr(0, &path) < 0)
+801083f9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801083fc:	50                   	push   %eax
+801083fd:	6a 00                	push   $0x0
+801083ff:	e8 be f9 ff ff       	call   80107dc2 <argstr>
+80108404:	83 c4 10             	add    $0x10,%esp
+80108407:	85 c0                	test   %eax,%eax
+80108409:	0f 88 50 01 00 00    	js     8010855f <sys_unlink+0x16e>
+  begin_op();
+8010840f:	e8 e3 c2 ff ff       	call   801046f7 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+80108414:	83 ec 08             	sub    $0x8,%esp
+80108417:	8d 45 ea             	lea    -0x16(%ebp),%eax
+8010841a:	50                   	push   %eax
+8010841b:	ff 75 e4             	push   -0x1c(%ebp)
+8010841e:	e8 11 b6 ff ff       	call   80103a34 <nameiparent>
+80108423:	89 c6                	mov    %eax,%esi
+80108425:	83 c4 10             	add    $0x10,%esp
+80108428:	85 c0                	test   %eax,%eax
+8010842a:	0f 84 cb 00 00 00    	je     801084fb <sys_unlink+0x10a>
+  ilock(dp);
+80108430:	83 ec 0c             	sub    $0xc,%esp
+80108433:	50                   	push   %eax
+80108434:	e8 6b a9 ff ff       	call   80102da4 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+80108439:	83 c4 08             	add    $0x8,%esp
+8010843c:	68 0a bd 10 80       	push   $0x8010bd0a
+80108441:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80108444:	50                   	push   %eax
+80108445:	e8 9c b0 ff ff       	call   801034e6 <namecmp>
+8010844a:	83 c4 10             	add    $0x10,%esp
+8010844d:	85 c0                	test   %eax,%eax
+8010844f:	0f 84 d6 00 00 00    	je     8010852b <sys_unlink+0x13a>
+80108455:	83 ec 08             	sub    $0x8,%esp
+80108458:	68 09 bd 10 80       	push   $0x8010bd09
+8010845d:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80108460:	50                   	push   %eax
+80108461:	e8 80 b0 ff ff       	call   801034e6 <namecmp>
+80108466:	83 c4 10             	add    $0x10,%esp
+80108469:	85 c0                	test   %eax,%eax
+8010846b:	0f 84 ba 00 00 00    	je     8010852b <sys_unlink+0x13a>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+80108471:	83 ec 04             	sub    $0x4,%esp
+80108474:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80108477:	50                   	push   %eax
+80108478:	8d 45 ea             	lea    -0x16(%ebp),%eax
+8010847b:	50                   	push   %eax
+8010847c:	56                   	push   %esi
+8010847d:	e8 fc b0 ff ff       	call   8010357e <dirlookup>
+80108482:	89 c3                	mov    %eax,%ebx
+80108484:	83 c4 10             	add    $0x10,%esp
+80108487:	85 c0                	test   %eax,%eax
+80108489:	0f 84 9c 00 00 00    	je     8010852b <sys_unlink+0x13a>
+  ilock(ip);
+8010848f:	83 ec 0c             	sub    $0xc,%esp
+80108492:	50                   	push   %eax
+80108493:	e8 0c a9 ff ff       	call   80102da4 <ilock>
+  if(ip->nlink < 1)
+80108498:	83 c4 10             	add    $0x10,%esp
+8010849b:	66 83 7b 62 00       	cmpw   $0x0,0x62(%ebx)
+801084a0:	7e 65                	jle    80108507 <sys_unlink+0x116>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+801084a2:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+801084a7:	74 6b                	je     80108514 <sys_unlink+0x123>
+  dirunlink(dp, off);
+801084a9:	83 ec 08             	sub    $0x8,%esp
+801084ac:	ff 75 e0             	push   -0x20(%ebp)
+801084af:	56                   	push   %esi
+801084b0:	e8 8f b4 ff ff       	call   80103944 <dirunlink>
+  if(ip->type == T_DIR){
+801084b5:	83 c4 10             	add    $0x10,%esp
+801084b8:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+801084bd:	0f 84 80 00 00 00    	je     80108543 <sys_unlink+0x152>
+  iunlockput(dp);
+801084c3:	83 ec 0c             	sub    $0xc,%esp
+801084c6:	56                   	push   %esi
+801084c7:	e8 cf aa ff ff       	call   80102f9b <iunlockput>
+  ip->nlink--;
+801084cc:	0f b7 43 62          	movzwl 0x62(%ebx),%eax
+801084d0:	83 e8 01             	sub    $0x1,%eax
+801084d3:	66 89 43 62          	mov    %ax,0x62(%ebx)
+  iupdate(ip);
+801084d7:	89 1c 24             	mov    %ebx,(%esp)
+801084da:	e8 31 a7 ff ff       	call   80102c10 <iupdate>
+  iunlockput(ip);
+801084df:	89 1c 24             	mov    %ebx,(%esp)
+801084e2:	e8 b4 aa ff ff       	call   80102f9b <iunlockput>
+  end_op();
+801084e7:	e8 85 c2 ff ff       	call   80104771 <end_op>
+  return 0;
+801084ec:	83 c4 10             	add    $0x10,%esp
+801084ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801084f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801084f7:	5b                   	pop    %ebx
+801084f8:	5e                   	pop    %esi
+801084f9:	5d                   	pop    %ebp
+801084fa:	c3                   	ret
+    end_op();
+801084fb:	e8 71 c2 ff ff       	call   80104771 <end_op>
+    return -1;
+80108500:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108505:	eb ed                	jmp    801084f4 <sys_unlink+0x103>
+    panic("unlink: nlink < 1");
+80108507:	83 ec 0c             	sub    $0xc,%esp
+8010850a:	68 28 bd 10 80       	push   $0x8010bd28
+8010850f:	e8 12 86 ff ff       	call   80100b26 <panic>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+80108514:	89 d8                	mov    %ebx,%eax
+80108516:	e8 0c fa ff ff       	call   80107f27 <isdirempty>
+8010851b:	85 c0                	test   %eax,%eax
+8010851d:	75 8a                	jne    801084a9 <sys_unlink+0xb8>
+    iunlockput(ip);
+8010851f:	83 ec 0c             	sub    $0xc,%esp
+80108522:	53                   	push   %ebx
+80108523:	e8 73 aa ff ff       	call   80102f9b <iunlockput>
+    goto bad;
+80108528:	83 c4 10             	add    $0x10,%esp
+  iunlockput(dp);
+8010852b:	83 ec 0c             	sub    $0xc,%esp
+8010852e:	56                   	push   %esi
+8010852f:	e8 67 aa ff ff       	call   80102f9b <iunlockput>
+  end_op();
+80108534:	e8 38 c2 ff ff       	call   80104771 <end_op>
+  return -1;
+80108539:	83 c4 10             	add    $0x10,%esp
+8010853c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108541:	eb b1                	jmp    801084f4 <sys_unlink+0x103>
+    dp->nlink--;
+80108543:	0f b7 46 62          	movzwl 0x62(%esi),%eax
+80108547:	83 e8 01             	sub    $0x1,%eax
+8010854a:	66 89 46 62          	mov    %ax,0x62(%esi)
+    iupdate(dp);
+8010854e:	83 ec 0c             	sub    $0xc,%esp
+80108551:	56                   	push   %esi
+80108552:	e8 b9 a6 ff ff       	call   80102c10 <iupdate>
+80108557:	83 c4 10             	add    $0x10,%esp
+8010855a:	e9 64 ff ff ff       	jmp    801084c3 <sys_unlink+0xd2>
+    return -1;
+8010855f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108564:	eb 8e                	jmp    801084f4 <sys_unlink+0x103>
+
+80108566 <sys_open>:
+
+int
+sys_open(void)
+{
+80108566:	55                   	push   %ebp
+80108567:	89 e5                	mov    %esp,%ebp
+80108569:	57                   	push   %edi
+8010856a:	56                   	push   %esi
+8010856b:	53                   	push   %ebx
+8010856c:	83 ec 24             	sub    $0x24,%esp
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+8010856f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108572:	50                   	push   %eax
+80108573:	6a 00                	push   $0x0
+80108575:	e8 48 f8 ff ff       	call   80107dc2 <argstr>
+8010857a:	83 c4 10             	add    $0x10,%esp
+8010857d:	85 c0                	test   %eax,%eax
+8010857f:	0f 88 b5 00 00 00    	js     8010863a <sys_open+0xd4>
+80108585:	83 ec 08             	sub    $0x8,%esp
+80108588:	8d 45 e0             	lea    -0x20(%ebp),%eax
+8010858b:	50                   	push   %eax
+8010858c:	6a 01                	push   $0x1
+8010858e:	e8 82 f7 ff ff       	call   80107d15 <argint>
+80108593:	83 c4 10             	add    $0x10,%esp
+80108596:	85 c0                	test   %eax,%eax
+80108598:	0f 88 9c 00 00 00    	js     8010863a <sys_open+0xd4>
+    return -1;
+
+  begin_op();
+8010859e:	e8 54 c1 ff ff       	call   801046f7 <begin_op>
+
+  if(omode & O_CREATE){
+801085a3:	f6 45 e1 02          	testb  $0x2,-0x1f(%ebp)
+801085a7:	0f 84 a0 00 00 00    	je     8010864d <sys_open+0xe7>
+    ip = create(path, T_FILE, 0, 0);
+801085ad:	83 ec 0c             	sub    $0xc,%esp
+801085b0:	6a 00                	push   $0x0
+801085b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+801085b7:	ba 02 00 00 00       	mov    $0x2,%edx
+801085bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801085bf:	e8 ba f9 ff ff       	call   80107f7e <create>
+801085c4:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+801085c6:	83 c4 10             	add    $0x10,%esp
+801085c9:	85 c0                	test   %eax,%eax
+801085cb:	74 74                	je     80108641 <sys_open+0xdb>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+801085cd:	e8 e9 90 ff ff       	call   801016bb <filealloc>
+801085d2:	89 c3                	mov    %eax,%ebx
+801085d4:	85 c0                	test   %eax,%eax
+801085d6:	0f 84 d6 00 00 00    	je     801086b2 <sys_open+0x14c>
+801085dc:	e8 e5 f8 ff ff       	call   80107ec6 <fdalloc>
+801085e1:	89 c7                	mov    %eax,%edi
+801085e3:	85 c0                	test   %eax,%eax
+801085e5:	0f 88 bb 00 00 00    	js     801086a6 <sys_open+0x140>
+      fileclose(f);
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+801085eb:	83 ec 0c             	sub    $0xc,%esp
+801085ee:	56                   	push   %esi
+801085ef:	e8 85 a8 ff ff       	call   80102e79 <iunlock>
+  end_op();
+801085f4:	e8 78 c1 ff ff       	call   80104771 <end_op>
+
+  f->type = FD_INODE;
+801085f9:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  f->ip = ip;
+801085ff:	89 73 14             	mov    %esi,0x14(%ebx)
+  f->off = 0;
+80108602:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->ranext = f->raend = 0;
+80108609:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+80108610:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  f->rawin = 0;
+80108617:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+  f->readable = !(omode & O_WRONLY);
+8010861e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80108621:	83 c4 10             	add    $0x10,%esp
+80108624:	a8 01                	test   $0x1,%al
+80108626:	0f 94 43 0c          	sete   0xc(%ebx)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+8010862a:	a8 03                	test   $0x3,%al
+8010862c:	0f 95 43 0d          	setne  0xd(%ebx)
+  return fd;
+}
+80108630:	89 f8                	mov    %edi,%eax
+80108632:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108635:	5b                   	pop    %ebx
+80108636:	5e                   	pop    %esi
+80108637:	5f                   	pop    %edi
+80108638:	5d                   	pop    %ebp
+80108639:	c3                   	ret
+    return -1;
+8010863a:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010863f:	eb ef                	jmp    80108630 <sys_open+0xca>
+      end_op();
+80108641:	e8 2b c1 ff ff       	call   80104771 <end_op>
+      return -1;
+80108646:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010864b:	eb e3                	jmp    80108630 <sys_open+0xca>
+    if((ip = namei(path)) == 0){
+8010864d:	83 ec 0c             	sub    $0xc,%esp
+80108650:	ff 75 e4             	push   -0x1c(%ebp)
+80108653:	e8 c4 b3 ff ff       	call   80103a1c <namei>
+80108658:	89 c6                	mov    %eax,%esi
+8010865a:	83 c4 10             	add    $0x10,%esp
+8010865d:	85 c0                	test   %eax,%eax
+8010865f:	74 39                	je     8010869a <sys_open+0x134>
+    ilock(ip);
+80108661:	83 ec 0c             	sub    $0xc,%esp
+80108664:	50                   	push   %eax
+80108665:	e8 3a a7 ff ff       	call   80102da4 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+8010866a:	83 c4 10             	add    $0x10,%esp
+8010866d:	66 83 7e 5c 01       	cmpw   $0x1,0x5c(%esi)
+80108672:	0f 85 55 ff ff ff    	jne    801085cd <sys_open+0x67>
+80108678:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+8010867c:	0f 84 4b ff ff ff    	je     801085cd <sys_open+0x67>
+      iunlockput(ip);
+80108682:	83 ec 0c             	sub    $0xc,%esp
+80108685:	56                   	push   %esi
+80108686:	e8 10 a9 ff ff       	call   80102f9b <iunlockput>
+      end_op();
+8010868b:	e8 e1 c0 ff ff       	call   80104771 <end_op>
+      return -1;
+80108690:	83 c4 10             	add    $0x10,%esp
+80108693:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80108698:	eb 96                	jmp    80108630 <sys_open+0xca>
+      end_op();
+8010869a:	e8 d2 c0 ff ff       	call   80104771 <end_op>
+      return -1;
+8010869f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801086a4:	eb 8a                	jmp    80108630 <sys_open+0xca>
+      fileclose(f);
+801086a6:	83 ec 0c             	sub    $0xc,%esp
+801086a9:	53                   	push   %ebx
+801086aa:	e8 c7 90 ff ff       	call   80101776 <fileclose>
+801086af:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+801086b2:	83 ec 0c             	sub    $0xc,%esp
+801086b5:	56                   	push   %esi
+801086b6:	e8 e0 a8 ff ff       	call   80102f9b <iunlockput>
+    end_op();
+801086bb:	e8 b1 c0 ff ff       	call   80104771 <end_op>
+    return -1;
+801086c0:	83 c4 10             	add    $0x10,%esp
+801086c3:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801086c8:	e9 63 ff ff ff       	jmp    80108630 <sys_open+0xca>
+
+801086cd <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+801086cd:	55                   	push   %ebp
+801086ce:	89 e5                	mov    %esp,%ebp
+801086d0:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+801086d3:	e8 1f c0 ff ff       	call   801046f7 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+801086d8:	83 ec 08             	sub    $0x8,%esp
+801086db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801086de:	50                   	push   %eax
+801086df:	6a 00                	push   $0x0
+801086e1:	e8 dc f6 ff ff       	call   80107dc2 <argstr>
+801086e6:	83 c4 10             	add    $0x10,%esp
+801086e9:	85 c0                	test   %eax,%eax
+801086eb:	78 36                	js     80108723 <sys_mkdir+0x56>
+801086ed:	83 ec 0c             	sub    $0xc,%esp
+801086f0:	6a 00                	push   $0x0
+801086f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+801086f7:	ba 01 00 00 00       	mov    $0x1,%edx
+801086fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801086ff:	e8 7a f8 ff ff       	call   80107f7e <create>
+80108704:	83 c4 10             	add    $0x10,%esp
+80108707:	85 c0                	test   %eax,%eax
+80108709:	74 18                	je     80108723 <sys_mkdir+0x56>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+8010870b:	83 ec 0c             	sub    $0xc,%esp
+8010870e:	50                   	push   %eax
+8010870f:	e8 87 a8 ff ff       	call   80102f9b <iunlockput>
+  end_op();
+80108714:	e8 58 c0 ff ff       	call   80104771 <end_op>
+  return 0;
+80108719:	83 c4 10             	add    $0x10,%esp
+8010871c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108721:	c9                   	leave
+80108722:	c3                   	ret
+    end_op();
+80108723:	e8 49 c0 ff ff       	call   80104771 <end_op>
+    return -1;
+80108728:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010872d:	eb f2                	jmp    80108721 <sys_mkdir+0x54>
+
+8010872f <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+8010872f:	55                   	push   %ebp
+80108730:	89 e5                	mov    %esp,%ebp
+80108732:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+80108735:	e8 bd bf ff ff       	call   801046f7 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+8010873a:	83 ec 08             	sub    $0x8,%esp
+8010873d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108740:	50                   	push   %eax
+80108741:	6a 00                	push   $0x0
+80108743:	e8 7a f6 ff ff       	call   80107dc2 <argstr>
+80108748:	83 c4 10             	add    $0x10,%esp
+8010874b:	85 c0                	test   %eax,%eax
+8010874d:	78 62                	js     801087b1 <sys_mknod+0x82>
+     argint(1, &major) < 0 ||
+8010874f:	83 ec 08             	sub    $0x8,%esp
+80108752:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108755:	50                   	push   %eax
+80108756:	6a 01                	push   $0x1
+80108758:	e8 b8 f5 ff ff       	call   80107d15 <argint>
+  if((argstr(0, &path)) < 0 ||
+8010875d:	83 c4 10             	add    $0x10,%esp
+80108760:	85 c0                	test   %eax,%eax
+80108762:	78 4d                	js     801087b1 <sys_mknod+0x82>
+     argint(2, &minor) < 0 ||
+80108764:	83 ec 08             	sub    $0x8,%esp
+80108767:	8d 45 ec             	lea    -0x14(%ebp),%eax
+8010876a:	50                   	push   %eax
+8010876b:	6a 02                	push   $0x2
+8010876d:	e8 a3 f5 ff ff       	call   80107d15 <argint>
+     argint(1, &major) < 0 ||
+80108772:	83 c4 10             	add    $0x10,%esp
+80108775:	85 c0                	test   %eax,%eax
+80108777:	78 38                	js     801087b1 <sys_mknod+0x82>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+80108779:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+8010877d:	83 ec 0c             	sub    $0xc,%esp
+80108780:	0f bf 45 ec          	movswl -0x14(%ebp),%eax
+80108784:	50                   	push   %eax
+80108785:	ba 03 00 00 00       	mov    $0x3,%edx
+8010878a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010878d:	e8 ec f7 ff ff       	call   80107f7e <create>
+     argint(2, &minor) < 0 ||
+80108792:	83 c4 10             	add    $0x10,%esp
+80108795:	85 c0                	test   %eax,%eax
+80108797:	74 18                	je     801087b1 <sys_mknod+0x82>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+80108799:	83 ec 0c             	sub    $0xc,%esp
+8010879c:	50                   	push   %eax
+8010879d:	e8 f9 a7 ff ff       	call   80102f9b <iunlockput>
+  end_op();
+801087a2:	e8 ca bf ff ff       	call   80104771 <end_op>
+  return 0;
+801087a7:	83 c4 10             	add    $0x10,%esp
+801087aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801087af:	c9                   	leave
+801087b0:	c3                   	ret
+    end_op();
+801087b1:	e8 bb bf ff ff       	call   80104771 <end_op>
+    return -1;
+801087b6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801087bb:	eb f2                	jmp    801087af <sys_mknod+0x80>
+
+801087bd <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+801087bd:	55                   	push   %ebp
+801087be:	89 e5                	mov    %esp,%ebp
+801087c0:	56                   	push   %esi
+801087c1:	53                   	push   %ebx
+801087c2:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+801087c5:	e8 8d d5 ff ff       	call   80105d57 <myproc>
+801087ca:	89 c6                	mov    %eax,%esi
+
+  begin_op();
+801087cc:	e8 26 bf ff ff       	call   801046f7 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+801087d1:	83 ec 08             	sub    $0x8,%esp
+801087d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801087d7:	50                   	push   %eax
+801087d8:	6a 00                	push   $0x0
+801087da:	e8 e3 f5 ff ff       	call   80107dc2 <argstr>
+801087df:	83 c4 10             	add    $0x10,%esp
+801087e2:	85 c0                	test   %eax,%eax
+801087e4:	78 52                	js     80108838 <sys_chdir+0x7b>
+801087e6:	83 ec 0c             	sub    $0xc,%esp
+801087e9:	ff 75 f4             	push   -0xc(%ebp)
+801087ec:	e8 2b b2 ff ff       	call   80103a1c <namei>
+801087f1:	89 c3                	mov    %eax,%ebx
+801087f3:	83 c4 10             	add    $0x10,%esp
+801087f6:	85 c0                	test   %eax,%eax
+801087f8:	74 3e                	je     80108838 <sys_chdir+0x7b>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+801087fa:	83 ec 0c             	sub    $0xc,%esp
+801087fd:	50                   	push   %eax
+801087fe:	e8 a1 a5 ff ff       	call   80102da4 <ilock>
+  if(ip->type != T_DIR){
+80108803:	83 c4 10             	add    $0x10,%esp
+80108806:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+8010880b:	75 37                	jne    80108844 <sys_chdir+0x87>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+8010880d:	83 ec 0c             	sub    $0xc,%esp
+80108810:	53                   	push   %ebx
+80108811:	e8 63 a6 ff ff       	call   80102e79 <iunlock>
+  iput(curproc->cwd);
+80108816:	83 c4 04             	add    $0x4,%esp
+80108819:	ff 76 78             	push   0x78(%esi)
+8010881c:	e8 9d a6 ff ff       	call   80102ebe <iput>
+  end_op();
+80108821:	e8 4b bf ff ff       	call   80104771 <end_op>
+  curproc->cwd = ip;
+80108826:	89 5e 78             	mov    %ebx,0x78(%esi)
+  return 0;
+80108829:	83 c4 10             	add    $0x10,%esp
+8010882c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108831:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108834:	5b                   	pop    %ebx
+80108835:	5e                   	pop    %esi
+80108836:	5d                   	pop    %ebp
+80108837:	c3                   	ret
+    end_op();
+80108838:	e8 34 bf ff ff       	call   80104771 <end_op>
+    return -1;
+8010883d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108842:	eb ed                	jmp    80108831 <sys_chdir+0x74>
+    iunlockput(ip);
+80108844:	83 ec 0c             	sub    $0xc,%esp
+80108847:	53                   	push   %ebx
+80108848:	e8 4e a7 ff ff       	call   80102f9b <iunlockput>
+    end_op();
+8010884d:	e8 1f bf ff ff       	call   80104771 <end_op>
+    return -1;
+80108852:	83 c4 10             	add    $0x10,%esp
+80108855:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010885a:	eb d5                	jmp    80108831 <sys_chdir+0x74>
+
+8010885c <sys_exec>:
+
+int
+sys_exec(void)
+{
+8010885c:	55                   	push   %ebp
+8010885d:	89 e5                	mov    %esp,%ebp
+8010885f:	53                   	push   %ebx
+80108860:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80108866:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108869:	50                   	push   %eax
+8010886a:	6a 00                	push   $0x0
+8010886c:	e8 51 f5 ff ff       	call   80107dc2 <argstr>
+80108871:	83 c4 10             	add    $0x10,%esp
+80108874:	85 c0                	test   %eax,%eax
+80108876:	78 38                	js     801088b0 <sys_exec+0x54>
+80108878:	83 ec 08             	sub    $0x8,%esp
+8010887b:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+80108881:	50                   	push   %eax
+80108882:	6a 01                	push   $0x1
+80108884:	e8 8c f4 ff ff       	call   80107d15 <argint>
+80108889:	83 c4 10             	add    $0x10,%esp
+8010888c:	85 c0                	test   %eax,%eax
+8010888e:	78 20                	js     801088b0 <sys_exec+0x54>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+80108890:	83 ec 04             	sub    $0x4,%esp
+80108893:	68 80 00 00 00       	push   $0x80
+80108898:	6a 00                	push   $0x0
+8010889a:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+801088a0:	50                   	push   %eax
+801088a1:	e8 d1 f1 ff ff       	call   80107a77 <memset>
+801088a6:	83 c4 10             	add    $0x10,%esp
+  for(i=0;; i++){
+801088a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+801088ae:	eb 2c                	jmp    801088dc <sys_exec+0x80>
+    return -1;
+801088b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801088b5:	eb 78                	jmp    8010892f <sys_exec+0xd3>
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+      return -1;
+    if(uarg == 0){
+      argv[i] = 0;
+801088b7:	c7 84 9d 74 ff ff ff 	movl   $0x0,-0x8c(%ebp,%ebx,4)
+801088be:	00 00 00 00 
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+      return -1;
+  }
+  return exec(path, argv);
+801088c2:	83 ec 08             	sub    $0x8,%esp
+801088c5:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+801088cb:	50                   	push   %eax
+801088cc:	ff 75 f4             	push   -0xc(%ebp)
+801088cf:	e8 9d 88 ff ff       	call   80101171 <exec>
+801088d4:	83 c4 10             	add    $0x10,%esp
+801088d7:	eb 56                	jmp    8010892f <sys_exec+0xd3>
+  for(i=0;; i++){
+801088d9:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+801088dc:	83 fb 1f             	cmp    $0x1f,%ebx
+801088df:	77 49                	ja     8010892a <sys_exec+0xce>
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+801088e1:	83 ec 08             	sub    $0x8,%esp
+801088e4:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+801088ea:	50                   	push   %eax
+801088eb:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+801088f1:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+801088f4:	50                   	push   %eax
+801088f5:	e8 53 f3 ff ff       	call   80107c4d <fetchint>
+801088fa:	83 c4 10             	add    $0x10,%esp
+801088fd:	85 c0                	test   %eax,%eax
+801088ff:	78 33                	js     80108934 <sys_exec+0xd8>
+    if(uarg == 0){
+80108901:	8b 85 6c ff ff ff    	mov    -0x94(%ebp),%eax
+80108907:	85 c0                	test   %eax,%eax
+80108909:	74 ac                	je     801088b7 <sys_exec+0x5b>
+    if(fetchstr(uarg, &argv[i]) < 0)
+8010890b:	83 ec 08             	sub    $0x8,%esp
+8010890e:	8d 94 9d 74 ff ff ff 	lea    -0x8c(%ebp,%ebx,4),%edx
+80108915:	52                   	push   %edx
+80108916:	50                   	push   %eax
+80108917:	e8 86 f3 ff ff       	call   80107ca2 <fetchstr>
+8010891c:	83 c4 10             	add    $0x10,%esp
+8010891f:	85 c0                	test   %eax,%eax
+80108921:	79 b6                	jns    801088d9 <sys_exec+0x7d>
+      return -1;
+80108923:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108928:	eb 05                	jmp    8010892f <sys_exec+0xd3>
+      return -1;
+8010892a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010892f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108932:	c9                   	leave
+80108933:	c3                   	ret
+      return -1;
+80108934:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108939:	eb f4                	jmp    8010892f <sys_exec+0xd3>
+
+8010893b <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+8010893b:	55                   	push   %ebp
+8010893c:	89 e5                	mov    %esp,%ebp
+8010893e:	53                   	push   %ebx
+8010893f:	83 ec 18             	sub    $0x18,%esp
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80108942:	6a 08                	push   $0x8
+80108944:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108947:	50                   	push   %eax
+80108948:	6a 00                	push   $0x0
+8010894a:	e8 ee f3 ff ff       	call   80107d3d <argptr>
+8010894f:	83 c4 10             	add    $0x10,%esp
+80108952:	85 c0                	test   %eax,%eax
+80108954:	78 77                	js     801089cd <sys_pipe+0x92>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+80108956:	83 ec 08             	sub    $0x8,%esp
+80108959:	8d 45 ec             	lea    -0x14(%ebp),%eax
+8010895c:	50                   	push   %eax
+8010895d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108960:	50                   	push   %eax
+80108961:	e8 b4 c5 ff ff       	call   80104f1a <pipealloc>
+80108966:	83 c4 10             	add    $0x10,%esp
+80108969:	85 c0                	test   %eax,%eax
+8010896b:	78 67                	js     801089d4 <sys_pipe+0x99>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+8010896d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80108970:	e8 51 f5 ff ff       	call   80107ec6 <fdalloc>
+80108975:	89 c3                	mov    %eax,%ebx
+80108977:	85 c0                	test   %eax,%eax
+80108979:	78 32                	js     801089ad <sys_pipe+0x72>
+8010897b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+8010897e:	e8 43 f5 ff ff       	call   80107ec6 <fdalloc>
+80108983:	85 c0                	test   %eax,%eax
+80108985:	78 15                	js     8010899c <sys_pipe+0x61>
+      myproc()->ofile[fd0] = 0;
+    fileclose(rf);
+    fileclose(wf);
+    return -1;
+  }
+  fd[0] = fd0;
+80108987:	8b 55 f4             	mov    -0xc(%ebp),%edx
+8010898a:	89 1a                	mov    %ebx,(%edx)
+  fd[1] = fd1;
+8010898c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+8010898f:	89 42 04             	mov    %eax,0x4(%edx)
+  return 0;
+80108992:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108997:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010899a:	c9                   	leave
+8010899b:	c3                   	ret
+      myproc()->ofile[fd0] = 0;
+8010899c:	e8 b6 d3 ff ff       	call   80105d57 <myproc>
+801089a1:	c1 e3 02             	shl    $0x2,%ebx
+801089a4:	03 58 30             	add    0x30(%eax),%ebx
+801089a7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    fileclose(rf);
+801089ad:	83 ec 0c             	sub    $0xc,%esp
+801089b0:	ff 75 f0             	push   -0x10(%ebp)
+801089b3:	e8 be 8d ff ff       	call   80101776 <fileclose>
+    fileclose(wf);
+801089b8:	83 c4 04             	add    $0x4,%esp
+801089bb:	ff 75 ec             	push   -0x14(%ebp)
+801089be:	e8 b3 8d ff ff       	call   80101776 <fileclose>
+    return -1;
+801089c3:	83 c4 10             	add    $0x10,%esp
+801089c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089cb:	eb ca                	jmp    80108997 <sys_pipe+0x5c>
+    return -1;
+801089cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089d2:	eb c3                	jmp    80108997 <sys_pipe+0x5c>
+    return -1;
+801089d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089d9:	eb bc                	jmp    80108997 <sys_pipe+0x5c>
+
+801089db <sys_pipesize>:
+
+// Grow the buffer of the pipe open as fd to at least n bytes.
+// Returns the new size.
+int
+sys_pipesize(void)
+{
+801089db:	55                   	push   %ebp
+801089dc:	89 e5                	mov    %esp,%ebp
+801089de:	83 ec 18             	sub    $0x18,%esp
+  struct file *f;
+  int n;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &n) < 0)
+801089e1:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+801089e4:	ba 00 00 00 00       	mov    $0x0,%edx
+801089e9:	b8 00 00 00 00       	mov    $0x0,%eax
+801089ee:	e8 5c f4 ff ff       	call   80107e4f <argfd>
+801089f3:	85 c0                	test   %eax,%eax
+801089f5:	78 30                	js     80108a27 <sys_pipesize+0x4c>
+801089f7:	83 ec 08             	sub    $0x8,%esp
+801089fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801089fd:	50                   	push   %eax
+801089fe:	6a 01                	push   $0x1
+80108a00:	e8 10 f3 ff ff       	call   80107d15 <argint>
+80108a05:	83 c4 10             	add    $0x10,%esp
+80108a08:	85 c0                	test   %eax,%eax
+80108a0a:	78 1b                	js     80108a27 <sys_pipesize+0x4c>
+    return -1;
+  if(f->type != FD_PIPE)
+80108a0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108a0f:	83 38 01             	cmpl   $0x1,(%eax)
+80108a12:	75 1a                	jne    80108a2e <sys_pipesize+0x53>
+    return -1;
+  return piperesize(f->pipe, n);
+80108a14:	83 ec 08             	sub    $0x8,%esp
+80108a17:	ff 75 f0             	push   -0x10(%ebp)
+80108a1a:	ff 70 10             	push   0x10(%eax)
+80108a1d:	e8 23 ca ff ff       	call   80105445 <piperesize>
+80108a22:	83 c4 10             	add    $0x10,%esp
+}
+80108a25:	c9                   	leave
+80108a26:	c3                   	ret
+    return -1;
+80108a27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a2c:	eb f7                	jmp    80108a25 <sys_pipesize+0x4a>
+    return -1;
+80108a2e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a33:	eb f0                	jmp    80108a25 <sys_pipesize+0x4a>
+
+80108a35 <sys_splice>:
+
+// Move up to n bytes from fd in to fd out inside the kernel,
+// where one of them is a pipe. Returns the number moved.
+int
+sys_splice(void)
+{
+80108a35:	55                   	push   %ebp
+80108a36:	89 e5                	mov    %esp,%ebp
+80108a38:	83 ec 18             	sub    $0x18,%esp
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0)
+80108a3b:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80108a3e:	ba 00 00 00 00       	mov    $0x0,%edx
+80108a43:	b8 00 00 00 00       	mov    $0x0,%eax
+80108a48:	e8 02 f4 ff ff       	call   80107e4f <argfd>
+80108a4d:	85 c0                	test   %eax,%eax
+80108a4f:	78 41                	js     80108a92 <sys_splice+0x5d>
+80108a51:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+80108a54:	ba 00 00 00 00       	mov    $0x0,%edx
+80108a59:	b8 01 00 00 00       	mov    $0x1,%eax
+80108a5e:	e8 ec f3 ff ff       	call   80107e4f <argfd>
+80108a63:	85 c0                	test   %eax,%eax
+80108a65:	78 2b                	js     80108a92 <sys_splice+0x5d>
+80108a67:	83 ec 08             	sub    $0x8,%esp
+80108a6a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108a6d:	50                   	push   %eax
+80108a6e:	6a 02                	push   $0x2
+80108a70:	e8 a0 f2 ff ff       	call   80107d15 <argint>
+80108a75:	83 c4 10             	add    $0x10,%esp
+80108a78:	85 c0                	test   %eax,%eax
+80108a7a:	78 16                	js     80108a92 <sys_splice+0x5d>
+    return -1;
+  return filesplice(in, out, n);
+80108a7c:	83 ec 04             	sub    $0x4,%esp
+80108a7f:	ff 75 ec             	push   -0x14(%ebp)
+80108a82:	ff 75 f0             	push   -0x10(%ebp)
+80108a85:	ff 75 f4             	push   -0xc(%ebp)
+80108a88:	e8 11 90 ff ff       	call   80101a9e <filesplice>
+80108a8d:	83 c4 10             	add    $0x10,%esp
+}
+80108a90:	c9                   	leave
+80108a91:	c3                   	ret
+    return -1;
+80108a92:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a97:	eb f7                	jmp    80108a90 <sys_splice+0x5b>
+
+80108a99 <sys_fork>:
+#ifdef CS333_P2
+#include "uproc.h"
+#endif //CS333_P2
+int
+sys_fork(void)
+{
+80108a99:	55                   	push   %ebp
+80108a9a:	89 e5                	mov    %esp,%ebp
+80108a9c:	83 ec 08             	sub    $0x8,%esp
+  return fork();
+80108a9f:	e8 46 d5 ff ff       	call   80105fea <fork>
+}
+80108aa4:	c9                   	leave
+80108aa5:	c3                   	ret
+
+80108aa6 <sys_exit>:
+
+int
+sys_exit(void)
+{
+80108aa6:	55                   	push   %ebp
+80108aa7:	89 e5                	mov    %esp,%ebp
+80108aa9:	83 ec 08             	sub    $0x8,%esp
+  exit();
+80108aac:	e8 ed de ff ff       	call   8010699e <exit>
+  return 0;  // not reached
+}
+80108ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+80108ab6:	c9                   	leave
+80108ab7:	c3                   	ret
+
+80108ab8 <sys_wait>:
+
+int
+sys_wait(void)
+{
+80108ab8:	55                   	push   %ebp
+80108ab9:	89 e5                	mov    %esp,%ebp
+80108abb:	83 ec 08             	sub    $0x8,%esp
+  return wait();
+80108abe:	e8 c1 e2 ff ff       	call   80106d84 <wait>
+}
+80108ac3:	c9                   	leave
+80108ac4:	c3                   	ret
+
+80108ac5 <sys_kill>:
+
+int
+sys_kill(void)
+{
+80108ac5:	55                   	push   %ebp
+80108ac6:	89 e5                	mov    %esp,%ebp
+80108ac8:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80108acb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108ace:	50                   	push   %eax
+80108acf:	6a 00                	push   $0x0
+80108ad1:	e8 3f f2 ff ff       	call   80107d15 <argint>
+80108ad6:	83 c4 10             	add    $0x10,%esp
+80108ad9:	85 c0                	test   %eax,%eax
+80108adb:	78 10                	js     80108aed <sys_kill+0x28>
+    return -1;
+  return kill(pid);
+80108add:	83 ec 0c             	sub    $0xc,%esp
+80108ae0:	ff 75 f4             	push   -0xc(%ebp)
+80108ae3:	e8 07 d8 ff ff       	call   801062ef <kill>
+80108ae8:	83 c4 10             	add    $0x10,%esp
+}
+80108aeb:	c9                   	leave
+80108aec:	c3                   	ret
+    return -1;
+80108aed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108af2:	eb f7                	jmp    80108aeb <sys_kill+0x26>
+
+80108af4 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80108af4:	55                   	push   %ebp
+80108af5:	89 e5                	mov    %esp,%ebp
+80108af7:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80108afa:	e8 58 d2 ff ff       	call   80105d57 <myproc>
+80108aff:	8b 40 10             	mov    0x10(%eax),%eax
+}
+80108b02:	c9                   	leave
+80108b03:	c3                   	ret
+
+80108b04 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80108b04:	55                   	push   %ebp
+80108b05:	89 e5                	mov    %esp,%ebp
+80108b07:	53                   	push   %ebx
+80108b08:	83 ec 1c             	sub    $0x1c,%esp
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80108b0b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108b0e:	50                   	push   %eax
+80108b0f:	6a 00                	push   $0x0
+80108b11:	e8 ff f1 ff ff       	call   80107d15 <argint>
+80108b16:	83 c4 10             	add    $0x10,%esp
+80108b19:	85 c0                	test   %eax,%eax
+80108b1b:	78 20                	js     80108b3d <sys_sbrk+0x39>
+    return -1;
+  addr = myproc()->sz;
+80108b1d:	e8 35 d2 ff ff       	call   80105d57 <myproc>
+80108b22:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+80108b24:	83 ec 0c             	sub    $0xc,%esp
+80108b27:	ff 75 f4             	push   -0xc(%ebp)
+80108b2a:	e8 51 d4 ff ff       	call   80105f80 <growproc>
+80108b2f:	83 c4 10             	add    $0x10,%esp
+80108b32:	85 c0                	test   %eax,%eax
+80108b34:	78 0e                	js     80108b44 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80108b36:	89 d8                	mov    %ebx,%eax
+80108b38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108b3b:	c9                   	leave
+80108b3c:	c3                   	ret
+    return -1;
+80108b3d:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108b42:	eb f2                	jmp    80108b36 <sys_sbrk+0x32>
+    return -1;
+80108b44:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108b49:	eb eb                	jmp    80108b36 <sys_sbrk+0x32>
+
+80108b4b <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80108b4b:	55                   	push   %ebp
+80108b4c:	89 e5                	mov    %esp,%ebp
+80108b4e:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+80108b51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108b54:	50                   	push   %eax
+80108b55:	6a 00                	push   $0x0
+80108b57:	e8 b9 f1 ff ff       	call   80107d15 <argint>
+80108b5c:	83 c4 10             	add    $0x10,%esp
+80108b5f:	85 c0                	test   %eax,%eax
+80108b61:	78 15                	js     80108b78 <sys_sleep+0x2d>
+    return -1;
+  if(n <= 0)
+80108b63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108b66:	85 c0                	test   %eax,%eax
+80108b68:	7e 15                	jle    80108b7f <sys_sleep+0x34>
+    return 0;
+  return sleepticks(n);
+80108b6a:	83 ec 0c             	sub    $0xc,%esp
+80108b6d:	50                   	push   %eax
+80108b6e:	e8 e0 e3 ff ff       	call   80106f53 <sleepticks>
+80108b73:	83 c4 10             	add    $0x10,%esp
+}
+80108b76:	c9                   	leave
+80108b77:	c3                   	ret
+    return -1;
+80108b78:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b7d:	eb f7                	jmp    80108b76 <sys_sleep+0x2b>
+    return 0;
+80108b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+80108b84:	eb f0                	jmp    80108b76 <sys_sleep+0x2b>
+
+80108b86 <sys_uptime>:
+{
+  uint xticks;
+
+  xticks = ticks;
+  return xticks;
+}
+80108b86:	a1 e0 fb 33 80       	mov    0x8033fbe0,%eax
+80108b8b:	c3                   	ret
+
+80108b8c <sys_halt>:
+
+#ifdef PDX_XV6
+// shutdown QEMU
+int
+sys_halt(void)
+{
+80108b8c:	55                   	push   %ebp
+80108b8d:	89 e5                	mov    %esp,%ebp
+80108b8f:	83 ec 08             	sub    $0x8,%esp
+  do_shutdown();  // never returns
+80108b92:	e8 7c 83 ff ff       	call   80100f13 <do_shutdown>
+  return 0;
+}
+80108b97:	b8 00 00 00 00       	mov    $0x0,%eax
+80108b9c:	c9                   	leave
+80108b9d:	c3                   	ret
+
+80108b9e <sys_date>:
+
+#ifdef CS333_P1
+
+int
+sys_date(void)
+{
+80108b9e:	55                   	push   %ebp
+80108b9f:	89 e5                	mov    %esp,%ebp
+80108ba1:	83 ec 1c             	sub    $0x1c,%esp
+  struct rtcdate *d;
+
+  if(argptr(0, (void*)&d, sizeof(struct rtcdate)) < 0)
+80108ba4:	6a 18                	push   $0x18
+80108ba6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108ba9:	50                   	push   %eax
+80108baa:	6a 00                	push   $0x0
+80108bac:	e8 8c f1 ff ff       	call   80107d3d <argptr>
+80108bb1:	83 c4 10             	add    $0x10,%esp
+80108bb4:	85 c0                	test   %eax,%eax
+80108bb6:	78 15                	js     80108bcd <sys_date+0x2f>
+    return -1;
+  cmostime(d);
+80108bb8:	83 ec 0c             	sub    $0xc,%esp
+80108bbb:	ff 75 f4             	push   -0xc(%ebp)
+80108bbe:	e8 64 b7 ff ff       	call   80104327 <cmostime>
+  return 0;
+80108bc3:	83 c4 10             	add    $0x10,%esp
+80108bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+
+}
+80108bcb:	c9                   	leave
+80108bcc:	c3                   	ret
+    return -1;
+80108bcd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108bd2:	eb f7                	jmp    80108bcb <sys_date+0x2d>
+
+80108bd4 <sys_getuid>:
+#endif //CS333_P1
+#ifdef CS333_P2
+int
+sys_getuid(void)
+{
+80108bd4:	55                   	push   %ebp
+80108bd5:	89 e5                	mov    %esp,%ebp
+80108bd7:	83 ec 08             	sub    $0x8,%esp
+  uint uid;
+  
+  uid = myproc()->uid;  
+80108bda:	e8 78 d1 ff ff       	call   80105d57 <myproc>
+80108bdf:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  return uid;	
+}
+80108be5:	c9                   	leave
+80108be6:	c3                   	ret
+
+80108be7 <sys_getgid>:
+
+int
+sys_getgid(void)
+{
+80108be7:	55                   	push   %ebp
+80108be8:	89 e5                	mov    %esp,%ebp
+80108bea:	83 ec 08             	sub    $0x8,%esp
+  uint gid;
+
+  gid = myproc()->gid;
+80108bed:	e8 65 d1 ff ff       	call   80105d57 <myproc>
+80108bf2:	8b 80 d8 00 00 00    	mov    0xd8(%eax),%eax
+  return gid;
+}
+80108bf8:	c9                   	leave
+80108bf9:	c3                   	ret
+
+80108bfa <sys_getppid>:
+int
+sys_getppid(void)
+{
+80108bfa:	55                   	push   %ebp
+80108bfb:	89 e5                	mov    %esp,%ebp
+80108bfd:	83 ec 08             	sub    $0x8,%esp
+  uint ppid;
+  
+  if(myproc()->parent != NULL)
+80108c00:	e8 52 d1 ff ff       	call   80105d57 <myproc>
+80108c05:	83 78 1c 00          	cmpl   $0x0,0x1c(%eax)
+80108c09:	74 0d                	je     80108c18 <sys_getppid+0x1e>
+    ppid = myproc()->parent->pid;
+80108c0b:	e8 47 d1 ff ff       	call   80105d57 <myproc>
+80108c10:	8b 40 1c             	mov    0x1c(%eax),%eax
+80108c13:	8b 40 10             	mov    0x10(%eax),%eax
+  else
+    ppid = myproc()->pid;
+  return ppid;
+}
+80108c16:	c9                   	leave
+80108c17:	c3                   	ret
+    ppid = myproc()->pid;
+80108c18:	e8 3a d1 ff ff       	call   80105d57 <myproc>
+80108c1d:	8b 40 10             	mov    0x10(%eax),%eax
+80108c20:	eb f4                	jmp    80108c16 <sys_getppid+0x1c>
+
+80108c22 <sys_setuid>:
+
+int
+sys_setuid(void)
+{
+80108c22:	55                   	push   %ebp
+80108c23:	89 e5                	mov    %esp,%ebp
+80108c25:	53                   	push   %ebx
+80108c26:	83 ec 1c             	sub    $0x1c,%esp
+  int uid;
+  if(argint(0, &uid) < 0)
+80108c29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108c2c:	50                   	push   %eax
+80108c2d:	6a 00                	push   $0x0
+80108c2f:	e8 e1 f0 ff ff       	call   80107d15 <argint>
+80108c34:	83 c4 10             	add    $0x10,%esp
+80108c37:	85 c0                	test   %eax,%eax
+80108c39:	78 20                	js     80108c5b <sys_setuid+0x39>
+    return -1;	  
+  if(uid < 0 || uid > 32767)
+80108c3b:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+80108c3e:	81 fb ff 7f 00 00    	cmp    $0x7fff,%ebx
+80108c44:	77 1c                	ja     80108c62 <sys_setuid+0x40>
+    return -1;
+  else{
+    myproc()->uid = uid;
+80108c46:	e8 0c d1 ff ff       	call   80105d57 <myproc>
+80108c4b:	89 98 d4 00 00 00    	mov    %ebx,0xd4(%eax)
+    return 0;
+80108c51:	b8 00 00 00 00       	mov    $0x0,%eax
+    }    
+}
+80108c56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108c59:	c9                   	leave
+80108c5a:	c3                   	ret
+    return -1;	  
+80108c5b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c60:	eb f4                	jmp    80108c56 <sys_setuid+0x34>
+    return -1;
+80108c62:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c67:	eb ed                	jmp    80108c56 <sys_setuid+0x34>
+
+80108c69 <sys_setgid>:
+
+int
+sys_setgid(void)
+{
+80108c69:	55                   	push   %ebp
+80108c6a:	89 e5                	mov    %esp,%ebp
+80108c6c:	53                   	push   %ebx
+80108c6d:	83 ec 1c             	sub    $0x1c,%esp
+  int gid;
+
+  if(argint(0, &gid) < 0)
+80108c70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108c73:	50                   	push   %eax
+80108c74:	6a 00                	push   $0x0
+80108c76:	e8 9a f0 ff ff       	call   80107d15 <argint>
+80108c7b:	83 c4 10             	add    $0x10,%esp
+80108c7e:	85 c0                	test   %eax,%eax
+80108c80:	78 20                	js     80108ca2 <sys_setgid+0x39>
+    return -1;	  
+  if(gid < 0 || gid > 32767)
+80108c82:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+80108c85:	81 fb ff 7f 00 00    	cmp    $0x7fff,%ebx
+80108c8b:	77 1c                	ja     80108ca9 <sys_setgid+0x40>
+    return -1;
+
+  else{
+    myproc()->gid = gid;
+80108c8d:	e8 c5 d0 ff ff       	call   80105d57 <myproc>
+80108c92:	89 98 d8 00 00 00    	mov    %ebx,0xd8(%eax)
+    return 0;
+80108c98:	b8 00 00 00 00       	mov    $0x0,%eax
+    }    
+}
+80108c9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108ca0:	c9                   	leave
+80108ca1:	c3                   	ret
+    return -1;	  
+80108ca2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ca7:	eb f4                	jmp    80108c9d <sys_setgid+0x34>
+    return -1;
+80108ca9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108cae:	eb ed                	jmp    80108c9d <sys_setgid+0x34>
+
+80108cb0 <sys_getprocs>:
+int
+sys_getprocs(void)
+{
+80108cb0:	55                   	push   %ebp
+80108cb1:	89 e5                	mov    %esp,%ebp
+80108cb3:	83 ec 20             	sub    $0x20,%esp
+  int max;
+  struct uproc *up;
+  if(argint(0, &max) < 0)
+80108cb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108cb9:	50                   	push   %eax
+80108cba:	6a 00                	push   $0x0
+80108cbc:	e8 54 f0 ff ff       	call   80107d15 <argint>
+80108cc1:	83 c4 10             	add    $0x10,%esp
+80108cc4:	85 c0                	test   %eax,%eax
+80108cc6:	78 4a                	js     80108d12 <sys_getprocs+0x62>
+    return -1;
+  if((argptr(1, (void*)&up, max*sizeof(*up))< 0))
+80108cc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108ccb:	8d 04 40             	lea    (%eax,%eax,2),%eax
+80108cce:	c1 e0 05             	shl    $0x5,%eax
+80108cd1:	83 ec 04             	sub    $0x4,%esp
+80108cd4:	50                   	push   %eax
+80108cd5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108cd8:	50                   	push   %eax
+80108cd9:	6a 01                	push   $0x1
+80108cdb:	e8 5d f0 ff ff       	call   80107d3d <argptr>
+80108ce0:	83 c4 10             	add    $0x10,%esp
+80108ce3:	85 c0                	test   %eax,%eax
+80108ce5:	78 32                	js     80108d19 <sys_getprocs+0x69>
+    return -1;
+  if(max <= 64)	  
+80108ce7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108cea:	83 f8 40             	cmp    $0x40,%eax
+80108ced:	7f 11                	jg     80108d00 <sys_getprocs+0x50>
+    return getprocs(max, up);
+80108cef:	83 ec 08             	sub    $0x8,%esp
+80108cf2:	ff 75 f0             	push   -0x10(%ebp)
+80108cf5:	50                   	push   %eax
+80108cf6:	e8 ad d6 ff ff       	call   801063a8 <getprocs>
+80108cfb:	83 c4 10             	add    $0x10,%esp
+  else
+    return getprocs(64, up);	  
+}
+80108cfe:	c9                   	leave
+80108cff:	c3                   	ret
+    return getprocs(64, up);	  
+80108d00:	83 ec 08             	sub    $0x8,%esp
+80108d03:	ff 75 f0             	push   -0x10(%ebp)
+80108d06:	6a 40                	push   $0x40
+80108d08:	e8 9b d6 ff ff       	call   801063a8 <getprocs>
+80108d0d:	83 c4 10             	add    $0x10,%esp
+80108d10:	eb ec                	jmp    80108cfe <sys_getprocs+0x4e>
+    return -1;
+80108d12:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d17:	eb e5                	jmp    80108cfe <sys_getprocs+0x4e>
+    return -1;
+80108d19:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d1e:	eb de                	jmp    80108cfe <sys_getprocs+0x4e>
+
+80108d20 <sys_getpriority>:
+#endif //CS333_P2
+
+#ifdef CS333_P4
+int
+sys_getpriority(void)
+{
+80108d20:	55                   	push   %ebp
+80108d21:	89 e5                	mov    %esp,%ebp
+80108d23:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+  if(argint(0, &pid) < 0)
+80108d26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108d29:	50                   	push   %eax
+80108d2a:	6a 00                	push   $0x0
+80108d2c:	e8 e4 ef ff ff       	call   80107d15 <argint>
+80108d31:	83 c4 10             	add    $0x10,%esp
+80108d34:	85 c0                	test   %eax,%eax
+80108d36:	78 10                	js     80108d48 <sys_getpriority+0x28>
+    return -1;
+  return getpriority(pid);
+80108d38:	83 ec 0c             	sub    $0xc,%esp
+80108d3b:	ff 75 f4             	push   -0xc(%ebp)
+80108d3e:	e8 9f d9 ff ff       	call   801066e2 <getpriority>
+80108d43:	83 c4 10             	add    $0x10,%esp
+
+}
+80108d46:	c9                   	leave
+80108d47:	c3                   	ret
+    return -1;
+80108d48:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d4d:	eb f7                	jmp    80108d46 <sys_getpriority+0x26>
+
+80108d4f <sys_setpriority>:
+
+int
+sys_setpriority(void)
+{
+80108d4f:	55                   	push   %ebp
+80108d50:	89 e5                	mov    %esp,%ebp
+80108d52:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+  int priority;
+  if(argint(0, &pid) < 0)
+80108d55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108d58:	50                   	push   %eax
+80108d59:	6a 00                	push   $0x0
+80108d5b:	e8 b5 ef ff ff       	call   80107d15 <argint>
+80108d60:	83 c4 10             	add    $0x10,%esp
+80108d63:	85 c0                	test   %eax,%eax
+80108d65:	78 33                	js     80108d9a <sys_setpriority+0x4b>
+    return -1;
+  if(argint(1, &priority) < 0)
+80108d67:	83 ec 08             	sub    $0x8,%esp
+80108d6a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108d6d:	50                   	push   %eax
+80108d6e:	6a 01                	push   $0x1
+80108d70:	e8 a0 ef ff ff       	call   80107d15 <argint>
+80108d75:	83 c4 10             	add    $0x10,%esp
+80108d78:	85 c0                	test   %eax,%eax
+80108d7a:	78 25                	js     80108da1 <sys_setpriority+0x52>
+    return -1;
+  if(priority > MAXPRIO || priority < 0 || pid < 0)
+80108d7c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80108d7f:	83 f8 06             	cmp    $0x6,%eax
+80108d82:	77 24                	ja     80108da8 <sys_setpriority+0x59>
+80108d84:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108d87:	85 d2                	test   %edx,%edx
+80108d89:	78 24                	js     80108daf <sys_setpriority+0x60>
+    return -1;
+ 
+  return setpriority(pid, priority);
+80108d8b:	83 ec 08             	sub    $0x8,%esp
+80108d8e:	50                   	push   %eax
+80108d8f:	52                   	push   %edx
+80108d90:	e8 c3 d9 ff ff       	call   80106758 <setpriority>
+80108d95:	83 c4 10             	add    $0x10,%esp
+}
+80108d98:	c9                   	leave
+80108d99:	c3                   	ret
+    return -1;
+80108d9a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d9f:	eb f7                	jmp    80108d98 <sys_setpriority+0x49>
+    return -1;
+80108da1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108da6:	eb f0                	jmp    80108d98 <sys_setpriority+0x49>
+    return -1;
+80108da8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108dad:	eb e9                	jmp    80108d98 <sys_setpriority+0x49>
+80108daf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108db4:	eb e2                	jmp    80108d98 <sys_setpriority+0x49>
+
+80108db6 <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+80108db6:	1e                   	push   %ds
+  pushl %es
+80108db7:	06                   	push   %es
+  pushl %fs
+80108db8:	0f a0                	push   %fs
+  pushl %gs
+80108dba:	0f a8                	push   %gs
+  pushal
+80108dbc:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+80108dbd:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+80108dc1:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80108dc3:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+80108dc5:	54                   	push   %esp
+  call trap
+80108dc6:	e8 1f 01 00 00       	call   80108eea <trap>
+  addl $4, %esp
+80108dcb:	83 c4 04             	add    $0x4,%esp
+
+80108dce <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80108dce:	61                   	popa
+  popl %gs
+80108dcf:	0f a9                	pop    %gs
+  popl %fs
+80108dd1:	0f a1                	pop    %fs
+  popl %es
+80108dd3:	07                   	pop    %es
+  popl %ds
+80108dd4:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80108dd5:	83 c4 08             	add    $0x8,%esp
+  iret
+80108dd8:	cf                   	iret
+
+80108dd9 <tvinit>:
+uint ticks;
+#endif // PDX_XV6
+
+void
+tvinit(void)
+{
+80108dd9:	55                   	push   %ebp
+80108dda:	89 e5                	mov    %esp,%ebp
+80108ddc:	53                   	push   %ebx
+  int i;
+
+  for(i = 0; i < 256; i++)
+80108ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+80108de2:	eb 76                	jmp    80108e5a <tvinit+0x81>
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80108de4:	8b 0c 85 08 f0 10 80 	mov    -0x7fef0ff8(,%eax,4),%ecx
+80108deb:	66 89 0c c5 00 fc 33 	mov    %cx,-0x7fcc0400(,%eax,8)
+80108df2:	80 
+80108df3:	66 c7 04 c5 02 fc 33 	movw   $0x8,-0x7fcc03fe(,%eax,8)
+80108dfa:	80 08 00 
+80108dfd:	0f b6 14 c5 04 fc 33 	movzbl -0x7fcc03fc(,%eax,8),%edx
+80108e04:	80 
+80108e05:	83 e2 e0             	and    $0xffffffe0,%edx
+80108e08:	88 14 c5 04 fc 33 80 	mov    %dl,-0x7fcc03fc(,%eax,8)
+80108e0f:	c6 04 c5 04 fc 33 80 	movb   $0x0,-0x7fcc03fc(,%eax,8)
+80108e16:	00 
+80108e17:	0f b6 14 c5 05 fc 33 	movzbl -0x7fcc03fb(,%eax,8),%edx
+80108e1e:	80 
+80108e1f:	83 e2 f0             	and    $0xfffffff0,%edx
+80108e22:	83 ca 0e             	or     $0xe,%edx
+80108e25:	88 14 c5 05 fc 33 80 	mov    %dl,-0x7fcc03fb(,%eax,8)
+80108e2c:	89 d3                	mov    %edx,%ebx
+80108e2e:	83 e3 ef             	and    $0xffffffef,%ebx
+80108e31:	88 1c c5 05 fc 33 80 	mov    %bl,-0x7fcc03fb(,%eax,8)
+80108e38:	83 e2 8f             	and    $0xffffff8f,%edx
+80108e3b:	88 14 c5 05 fc 33 80 	mov    %dl,-0x7fcc03fb(,%eax,8)
+80108e42:	83 ca 80             	or     $0xffffff80,%edx
+80108e45:	88 14 c5 05 fc 33 80 	mov    %dl,-0x7fcc03fb(,%eax,8)
+80108e4c:	c1 e9 10             	shr    $0x10,%ecx
+80108e4f:	66 89 0c c5 06 fc 33 	mov    %cx,-0x7fcc03fa(,%eax,8)
+80108e56:	80 
+  for(i = 0; i < 256; i++)
+80108e57:	83 c0 01             	add    $0x1,%eax
+80108e5a:	3d ff 00 00 00       	cmp    $0xff,%eax
+80108e5f:	7e 83                	jle    80108de4 <tvinit+0xb>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80108e61:	8b 15 08 f1 10 80    	mov    0x8010f108,%edx
+80108e67:	66 89 15 00 fe 33 80 	mov    %dx,0x8033fe00
+80108e6e:	66 c7 05 02 fe 33 80 	movw   $0x8,0x8033fe02
+80108e75:	08 00 
+80108e77:	0f b6 05 04 fe 33 80 	movzbl 0x8033fe04,%eax
+80108e7e:	83 e0 e0             	and    $0xffffffe0,%eax
+80108e81:	a2 04 fe 33 80       	mov    %al,0x8033fe04
+80108e86:	c6 05 04 fe 33 80 00 	movb   $0x0,0x8033fe04
+80108e8d:	0f b6 05 05 fe 33 80 	movzbl 0x8033fe05,%eax
+80108e94:	83 c8 0f             	or     $0xf,%eax
+80108e97:	a2 05 fe 33 80       	mov    %al,0x8033fe05
+80108e9c:	83 e0 ef             	and    $0xffffffef,%eax
+80108e9f:	a2 05 fe 33 80       	mov    %al,0x8033fe05
+80108ea4:	89 c1                	mov    %eax,%ecx
+80108ea6:	83 c9 60             	or     $0x60,%ecx
+80108ea9:	88 0d 05 fe 33 80    	mov    %cl,0x8033fe05
+80108eaf:	83 c8 e0             	or     $0xffffffe0,%eax
+80108eb2:	a2 05 fe 33 80       	mov    %al,0x8033fe05
+80108eb7:	c1 ea 10             	shr    $0x10,%edx
+80108eba:	66 89 15 06 fe 33 80 	mov    %dx,0x8033fe06
+
+#ifndef PDX_XV6
+  initlock(&tickslock, "time");
+#endif // PDX_XV6
+}
+80108ec1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108ec4:	c9                   	leave
+80108ec5:	c3                   	ret
+
+80108ec6 <idtinit>:
+
+void
+idtinit(void)
+{
+80108ec6:	55                   	push   %ebp
+80108ec7:	89 e5                	mov    %esp,%ebp
+80108ec9:	83 ec 10             	sub    $0x10,%esp
+  pd[0] = size-1;
+80108ecc:	66 c7 45 fa ff 07    	movw   $0x7ff,-0x6(%ebp)
+  pd[1] = (uint)p;
+80108ed2:	b8 00 fc 33 80       	mov    $0x8033fc00,%eax
+80108ed7:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80108edb:	c1 e8 10             	shr    $0x10,%eax
+80108ede:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+80108ee2:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80108ee5:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80108ee8:	c9                   	leave
+80108ee9:	c3                   	ret
+
+80108eea <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80108eea:	55                   	push   %ebp
+80108eeb:	89 e5                	mov    %esp,%ebp
+80108eed:	57                   	push   %edi
+80108eee:	56                   	push   %esi
+80108eef:	53                   	push   %ebx
+80108ef0:	83 ec 1c             	sub    $0x1c,%esp
+80108ef3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+80108ef6:	8b 43 30             	mov    0x30(%ebx),%eax
+80108ef9:	83 f8 40             	cmp    $0x40,%eax
+80108efc:	74 13                	je     80108f11 <trap+0x27>
+    if(myproc()->killed)
+      exit();
+    return;
+  }
+
+  switch(tf->trapno){
+80108efe:	83 e8 0e             	sub    $0xe,%eax
+80108f01:	83 f8 31             	cmp    $0x31,%eax
+80108f04:	0f 87 f7 00 00 00    	ja     80109001 <trap+0x117>
+80108f0a:	ff 24 85 dc bd 10 80 	jmp    *-0x7fef4224(,%eax,4)
+    if(myproc()->killed)
+80108f11:	e8 41 ce ff ff       	call   80105d57 <myproc>
+80108f16:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80108f1a:	75 26                	jne    80108f42 <trap+0x58>
+    myproc()->tf = tf;
+80108f1c:	e8 36 ce ff ff       	call   80105d57 <myproc>
+80108f21:	89 58 20             	mov    %ebx,0x20(%eax)
+    syscall();
+80108f24:	e8 cc ee ff ff       	call   80107df5 <syscall>
+    if(myproc()->killed)
+80108f29:	e8 29 ce ff ff       	call   80105d57 <myproc>
+80108f2e:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80108f32:	0f 84 8d 01 00 00    	je     801090c5 <trap+0x1db>
+      exit();
+80108f38:	e8 61 da ff ff       	call   8010699e <exit>
+    return;
+80108f3d:	e9 83 01 00 00       	jmp    801090c5 <trap+0x1db>
+      exit();
+80108f42:	e8 57 da ff ff       	call   8010699e <exit>
+80108f47:	eb d3                	jmp    80108f1c <trap+0x32>
+  case T_IRQ0 + IRQ_TIMER:
+    if(cpuid() == 0){
+80108f49:	e8 ee cd ff ff       	call   80105d3c <cpuid>
+80108f4e:	85 c0                	test   %eax,%eax
+80108f50:	74 0a                	je     80108f5c <trap+0x72>
+      ticks++;
+      timertick(ticks);
+      release(&tickslock);
+#endif // PDX_XV6
+    }
+    lapiceoi();
+80108f52:	e8 13 b3 ff ff       	call   8010426a <lapiceoi>
+    break;
+80108f57:	e9 13 01 00 00       	jmp    8010906f <trap+0x185>
+// atom_inc() necessary for removal of tickslock
+// other atomic ops added for completeness
+static inline void
+atom_inc(volatile int *num)
+{
+  asm volatile ( "lock incl %0" : "=m" (*num));
+80108f5c:	f0 ff 05 e0 fb 33 80 	lock incl 0x8033fbe0
+      timertick(ticks);
+80108f63:	83 ec 0c             	sub    $0xc,%esp
+80108f66:	ff 35 e0 fb 33 80    	push   0x8033fbe0
+80108f6c:	e8 01 d3 ff ff       	call   80106272 <timertick>
+80108f71:	83 c4 10             	add    $0x10,%esp
+80108f74:	eb dc                	jmp    80108f52 <trap+0x68>
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+80108f76:	e8 3f 20 00 00       	call   8010afba <ideintr>
+    lapiceoi();
+80108f7b:	e8 ea b2 ff ff       	call   8010426a <lapiceoi>
+    break;
+80108f80:	e9 ea 00 00 00       	jmp    8010906f <trap+0x185>
+  case T_IRQ0 + IRQ_VIRTIO:
+    virtiointr();
+80108f85:	e8 2f 12 00 00       	call   8010a1b9 <virtiointr>
+    lapiceoi();
+80108f8a:	e8 db b2 ff ff       	call   8010426a <lapiceoi>
+    break;
+80108f8f:	e9 db 00 00 00       	jmp    8010906f <trap+0x185>
+  case T_IRQ0 + IRQ_IDE+1:
+    // Bochs generates spurious IDE1 interrupts.
+    break;
+  case T_IRQ0 + IRQ_KBD:
+    kbdintr();
+80108f94:	e8 1b b1 ff ff       	call   801040b4 <kbdintr>
+    lapiceoi();
+80108f99:	e8 cc b2 ff ff       	call   8010426a <lapiceoi>
+    break;
+80108f9e:	e9 cc 00 00 00       	jmp    8010906f <trap+0x185>
+  case T_IRQ0 + IRQ_COM1:
+    uartintr();
+80108fa3:	e8 99 02 00 00       	call   80109241 <uartintr>
+    lapiceoi();
+80108fa8:	e8 bd b2 ff ff       	call   8010426a <lapiceoi>
+    break;
+80108fad:	e9 bd 00 00 00       	jmp    8010906f <trap+0x185>
+  case T_IRQ0 + 7:
+  case T_IRQ0 + IRQ_SPURIOUS:
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80108fb2:	8b 7b 38             	mov    0x38(%ebx),%edi
+            cpuid(), tf->cs, tf->eip);
+80108fb5:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80108fb9:	e8 7e cd ff ff       	call   80105d3c <cpuid>
+80108fbe:	57                   	push   %edi
+80108fbf:	0f b7 f6             	movzwl %si,%esi
+80108fc2:	56                   	push   %esi
+80108fc3:	50                   	push   %eax
+80108fc4:	68 3c bd 10 80       	push   $0x8010bd3c
+80108fc9:	e8 19 7e ff ff       	call   80100de7 <cprintf>
+    lapiceoi();
+80108fce:	e8 97 b2 ff ff       	call   8010426a <lapiceoi>
+    break;
+80108fd3:	83 c4 10             	add    $0x10,%esp
+80108fd6:	e9 94 00 00 00       	jmp    8010906f <trap+0x185>
+
+  case T_PGFLT:
+    if(myproc() && pagefault(myproc(), rcr2(), tf->err) == 0)
+80108fdb:	e8 77 cd ff ff       	call   80105d57 <myproc>
+80108fe0:	85 c0                	test   %eax,%eax
+80108fe2:	74 1d                	je     80109001 <trap+0x117>
+80108fe4:	8b 7b 34             	mov    0x34(%ebx),%edi
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80108fe7:	0f 20 d6             	mov    %cr2,%esi
+80108fea:	e8 68 cd ff ff       	call   80105d57 <myproc>
+80108fef:	83 ec 04             	sub    $0x4,%esp
+80108ff2:	57                   	push   %edi
+80108ff3:	56                   	push   %esi
+80108ff4:	50                   	push   %eax
+80108ff5:	e8 76 1d 00 00       	call   8010ad70 <pagefault>
+80108ffa:	83 c4 10             	add    $0x10,%esp
+80108ffd:	85 c0                	test   %eax,%eax
+80108fff:	74 6e                	je     8010906f <trap+0x185>
+      break;
+    // fall through
+
+  //PAGEBREAK: 13
+  default:
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80109001:	e8 51 cd ff ff       	call   80105d57 <myproc>
+80109006:	85 c0                	test   %eax,%eax
+80109008:	0f 84 bf 00 00 00    	je     801090cd <trap+0x1e3>
+8010900e:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80109012:	0f 84 b5 00 00 00    	je     801090cd <trap+0x1e3>
+80109018:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+              tf->trapno, cpuid(), tf->eip, rcr2());
+      panic("trap");
+    }
+    // In user space, assume process misbehaved.
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+8010901b:	8b 43 38             	mov    0x38(%ebx),%eax
+8010901e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80109021:	e8 16 cd ff ff       	call   80105d3c <cpuid>
+80109026:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80109029:	8b 4b 34             	mov    0x34(%ebx),%ecx
+8010902c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+8010902f:	8b 73 30             	mov    0x30(%ebx),%esi
+            "eip 0x%x addr 0x%x--kill proc\n",
+            myproc()->pid, myproc()->name, tf->trapno,
+80109032:	e8 20 cd ff ff       	call   80105d57 <myproc>
+80109037:	8d 90 b4 00 00 00    	lea    0xb4(%eax),%edx
+8010903d:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80109040:	e8 12 cd ff ff       	call   80105d57 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109045:	57                   	push   %edi
+80109046:	ff 75 e4             	push   -0x1c(%ebp)
+80109049:	ff 75 e0             	push   -0x20(%ebp)
+8010904c:	ff 75 dc             	push   -0x24(%ebp)
+8010904f:	56                   	push   %esi
+80109050:	ff 75 d8             	push   -0x28(%ebp)
+80109053:	ff 70 10             	push   0x10(%eax)
+80109056:	68 94 bd 10 80       	push   $0x8010bd94
+8010905b:	e8 87 7d ff ff       	call   80100de7 <cprintf>
+            tf->err, cpuid(), tf->eip, rcr2());
+    myproc()->killed = 1;
+80109060:	83 c4 20             	add    $0x20,%esp
+80109063:	e8 ef cc ff ff       	call   80105d57 <myproc>
+80109068:	c7 40 2c 01 00 00 00 	movl   $0x1,0x2c(%eax)
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+8010906f:	e8 e3 cc ff ff       	call   80105d57 <myproc>
+80109074:	85 c0                	test   %eax,%eax
+80109076:	74 18                	je     80109090 <trap+0x1a6>
+80109078:	e8 da cc ff ff       	call   80105d57 <myproc>
+8010907d:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+80109081:	74 0d                	je     80109090 <trap+0x1a6>
+80109083:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109087:	83 e0 03             	and    $0x3,%eax
+8010908a:	66 83 f8 03          	cmp    $0x3,%ax
+8010908e:	74 68                	je     801090f8 <trap+0x20e>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+80109090:	e8 c2 cc ff ff       	call   80105d57 <myproc>
+80109095:	85 c0                	test   %eax,%eax
+80109097:	74 0b                	je     801090a4 <trap+0x1ba>
+80109099:	e8 b9 cc ff ff       	call   80105d57 <myproc>
+8010909e:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+801090a2:	74 5b                	je     801090ff <trap+0x215>
+    tf->trapno == T_IRQ0+IRQ_TIMER)
+#endif // PDX_XV6
+    yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+801090a4:	e8 ae cc ff ff       	call   80105d57 <myproc>
+801090a9:	85 c0                	test   %eax,%eax
+801090ab:	74 18                	je     801090c5 <trap+0x1db>
+801090ad:	e8 a5 cc ff ff       	call   80105d57 <myproc>
+801090b2:	83 78 2c 00          	cmpl   $0x0,0x2c(%eax)
+801090b6:	74 0d                	je     801090c5 <trap+0x1db>
+801090b8:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+801090bc:	83 e0 03             	and    $0x3,%eax
+801090bf:	66 83 f8 03          	cmp    $0x3,%ax
+801090c3:	74 65                	je     8010912a <trap+0x240>
+    exit();
+}
+801090c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801090c8:	5b                   	pop    %ebx
+801090c9:	5e                   	pop    %esi
+801090ca:	5f                   	pop    %edi
+801090cb:	5d                   	pop    %ebp
+801090cc:	c3                   	ret
+801090cd:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+801090d0:	8b 73 38             	mov    0x38(%ebx),%esi
+801090d3:	e8 64 cc ff ff       	call   80105d3c <cpuid>
+801090d8:	83 ec 0c             	sub    $0xc,%esp
+801090db:	57                   	push   %edi
+801090dc:	56                   	push   %esi
+801090dd:	50                   	push   %eax
+801090de:	ff 73 30             	push   0x30(%ebx)
+801090e1:	68 60 bd 10 80       	push   $0x8010bd60
+801090e6:	e8 fc 7c ff ff       	call   80100de7 <cprintf>
+      panic("trap");
+801090eb:	83 c4 14             	add    $0x14,%esp
+801090ee:	68 d7 bd 10 80       	push   $0x8010bdd7
+801090f3:	e8 2e 7a ff ff       	call   80100b26 <panic>
+    exit();
+801090f8:	e8 a1 d8 ff ff       	call   8010699e <exit>
+801090fd:	eb 91                	jmp    80109090 <trap+0x1a6>
+  if(myproc() && myproc()->state == RUNNING &&
+801090ff:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+80109103:	75 9f                	jne    801090a4 <trap+0x1ba>
+    tf->trapno == T_IRQ0+IRQ_TIMER && ticks%SCHED_INTERVAL==0)
+80109105:	8b 0d e0 fb 33 80    	mov    0x8033fbe0,%ecx
+8010910b:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80109110:	89 c8                	mov    %ecx,%eax
+80109112:	f7 e2                	mul    %edx
+80109114:	c1 ea 03             	shr    $0x3,%edx
+80109117:	8d 04 92             	lea    (%edx,%edx,4),%eax
+8010911a:	01 c0                	add    %eax,%eax
+8010911c:	39 c1                	cmp    %eax,%ecx
+8010911e:	75 84                	jne    801090a4 <trap+0x1ba>
+    yield();
+80109120:	e8 74 da ff ff       	call   80106b99 <yield>
+80109125:	e9 7a ff ff ff       	jmp    801090a4 <trap+0x1ba>
+    exit();
+8010912a:	e8 6f d8 ff ff       	call   8010699e <exit>
+8010912f:	eb 94                	jmp    801090c5 <trap+0x1db>
+
+80109131 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80109131:	83 3d 00 04 34 80 00 	cmpl   $0x0,0x80340400
+80109138:	74 14                	je     8010914e <uartgetc+0x1d>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010913a:	ba fd 03 00 00       	mov    $0x3fd,%edx
+8010913f:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+80109140:	a8 01                	test   $0x1,%al
+80109142:	74 10                	je     80109154 <uartgetc+0x23>
+80109144:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109149:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+8010914a:	0f b6 c0             	movzbl %al,%eax
+8010914d:	c3                   	ret
+    return -1;
+8010914e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109153:	c3                   	ret
+    return -1;
+80109154:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109159:	c3                   	ret
+
+8010915a <uartputc>:
+  if(!uart)
+8010915a:	83 3d 00 04 34 80 00 	cmpl   $0x0,0x80340400
+80109161:	74 3b                	je     8010919e <uartputc+0x44>
+{
+80109163:	55                   	push   %ebp
+80109164:	89 e5                	mov    %esp,%ebp
+80109166:	53                   	push   %ebx
+80109167:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+8010916a:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010916f:	eb 10                	jmp    80109181 <uartputc+0x27>
+    microdelay(10);
+80109171:	83 ec 0c             	sub    $0xc,%esp
+80109174:	6a 0a                	push   $0xa
+80109176:	e8 10 b1 ff ff       	call   8010428b <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+8010917b:	83 c3 01             	add    $0x1,%ebx
+8010917e:	83 c4 10             	add    $0x10,%esp
+80109181:	83 fb 7f             	cmp    $0x7f,%ebx
+80109184:	7f 0a                	jg     80109190 <uartputc+0x36>
+80109186:	ba fd 03 00 00       	mov    $0x3fd,%edx
+8010918b:	ec                   	in     (%dx),%al
+8010918c:	a8 20                	test   $0x20,%al
+8010918e:	74 e1                	je     80109171 <uartputc+0x17>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109190:	8b 45 08             	mov    0x8(%ebp),%eax
+80109193:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109198:	ee                   	out    %al,(%dx)
+}
+80109199:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010919c:	c9                   	leave
+8010919d:	c3                   	ret
+8010919e:	c3                   	ret
+
+8010919f <uartinit>:
+{
+8010919f:	55                   	push   %ebp
+801091a0:	89 e5                	mov    %esp,%ebp
+801091a2:	56                   	push   %esi
+801091a3:	53                   	push   %ebx
+801091a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+801091a9:	ba fa 03 00 00       	mov    $0x3fa,%edx
+801091ae:	89 c8                	mov    %ecx,%eax
+801091b0:	ee                   	out    %al,(%dx)
+801091b1:	be fb 03 00 00       	mov    $0x3fb,%esi
+801091b6:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+801091bb:	89 f2                	mov    %esi,%edx
+801091bd:	ee                   	out    %al,(%dx)
+801091be:	b8 0c 00 00 00       	mov    $0xc,%eax
+801091c3:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801091c8:	ee                   	out    %al,(%dx)
+801091c9:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+801091ce:	89 c8                	mov    %ecx,%eax
+801091d0:	89 da                	mov    %ebx,%edx
+801091d2:	ee                   	out    %al,(%dx)
+801091d3:	b8 03 00 00 00       	mov    $0x3,%eax
+801091d8:	89 f2                	mov    %esi,%edx
+801091da:	ee                   	out    %al,(%dx)
+801091db:	ba fc 03 00 00       	mov    $0x3fc,%edx
+801091e0:	89 c8                	mov    %ecx,%eax
+801091e2:	ee                   	out    %al,(%dx)
+801091e3:	b8 01 00 00 00       	mov    $0x1,%eax
+801091e8:	89 da                	mov    %ebx,%edx
+801091ea:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801091eb:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801091f0:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+801091f1:	3c ff                	cmp    $0xff,%al
+801091f3:	74 45                	je     8010923a <uartinit+0x9b>
+  uart = 1;
+801091f5:	c7 05 00 04 34 80 01 	movl   $0x1,0x80340400
+801091fc:	00 00 00 
+801091ff:	ba fa 03 00 00       	mov    $0x3fa,%edx
+80109204:	ec                   	in     (%dx),%al
+80109205:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010920a:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+8010920b:	83 ec 08             	sub    $0x8,%esp
+8010920e:	6a 00                	push   $0x0
+80109210:	6a 04                	push   $0x4
+80109212:	e8 db a8 ff ff       	call   80103af2 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80109217:	83 c4 10             	add    $0x10,%esp
+8010921a:	bb a4 be 10 80       	mov    $0x8010bea4,%ebx
+8010921f:	eb 12                	jmp    80109233 <uartinit+0x94>
+    uartputc(*p);
+80109221:	83 ec 0c             	sub    $0xc,%esp
+80109224:	0f be c0             	movsbl %al,%eax
+80109227:	50                   	push   %eax
+80109228:	e8 2d ff ff ff       	call   8010915a <uartputc>
+  for(p="xv6...\n"; *p; p++)
+8010922d:	83 c3 01             	add    $0x1,%ebx
+80109230:	83 c4 10             	add    $0x10,%esp
+80109233:	0f b6 03             	movzbl (%ebx),%eax
+80109236:	84 c0                	test   %al,%al
+80109238:	75 e7                	jne    80109221 <uartinit+0x82>
+}
+8010923a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010923d:	5b                   	pop    %ebx
+8010923e:	5e                   	pop    %esi
+8010923f:	5d                   	pop    %ebp
+80109240:	c3                   	ret
+
+80109241 <uartintr>:
+
+void
+uartintr(void)
+{
+80109241:	55                   	push   %ebp
+80109242:	89 e5                	mov    %esp,%ebp
+80109244:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80109247:	68 31 91 10 80       	push   $0x80109131
+8010924c:	e8 e3 7c ff ff       	call   80100f34 <consoleintr>
+}
+80109251:	83 c4 10             	add    $0x10,%esp
+80109254:	c9                   	leave
+80109255:	c3                   	ret
+
+80109256 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80109256:	6a 00                	push   $0x0
+  pushl $0
+80109258:	6a 00                	push   $0x0
+  jmp alltraps
+8010925a:	e9 57 fb ff ff       	jmp    80108db6 <alltraps>
+
+8010925f <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+8010925f:	6a 00                	push   $0x0
+  pushl $1
+80109261:	6a 01                	push   $0x1
+  jmp alltraps
+80109263:	e9 4e fb ff ff       	jmp    80108db6 <alltraps>
+
+80109268 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80109268:	6a 00                	push   $0x0
+  pushl $2
+8010926a:	6a 02                	push   $0x2
+  jmp alltraps
+8010926c:	e9 45 fb ff ff       	jmp    80108db6 <alltraps>
+
+80109271 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+80109271:	6a 00                	push   $0x0
+  pushl $3
+80109273:	6a 03                	push   $0x3
+  jmp alltraps
+80109275:	e9 3c fb ff ff       	jmp    80108db6 <alltraps>
+
+8010927a <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+8010927a:	6a 00                	push   $0x0
+  pushl $4
+8010927c:	6a 04                	push   $0x4
+  jmp alltraps
+8010927e:	e9 33 fb ff ff       	jmp    80108db6 <alltraps>
+
+80109283 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80109283:	6a 00                	push   $0x0
+  pushl $5
+80109285:	6a 05                	push   $0x5
+  jmp alltraps
+80109287:	e9 2a fb ff ff       	jmp    80108db6 <alltraps>
+
+8010928c <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+8010928c:	6a 00                	push   $0x0
+  pushl $6
+8010928e:	6a 06                	push   $0x6
+  jmp alltraps
+80109290:	e9 21 fb ff ff       	jmp    80108db6 <alltraps>
+
+80109295 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80109295:	6a 00                	push   $0x0
+  pushl $7
+80109297:	6a 07                	push   $0x7
+  jmp alltraps
+80109299:	e9 18 fb ff ff       	jmp    80108db6 <alltraps>
+
+8010929e <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+8010929e:	6a 08                	push   $0x8
+  jmp alltraps
+801092a0:	e9 11 fb ff ff       	jmp    80108db6 <alltraps>
+
+801092a5 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+801092a5:	6a 00                	push   $0x0
+  pushl $9
+801092a7:	6a 09                	push   $0x9
+  jmp alltraps
+801092a9:	e9 08 fb ff ff       	jmp    80108db6 <alltraps>
+
+801092ae <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+801092ae:	6a 0a                	push   $0xa
+  jmp alltraps
+801092b0:	e9 01 fb ff ff       	jmp    80108db6 <alltraps>
+
+801092b5 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+801092b5:	6a 0b                	push   $0xb
+  jmp alltraps
+801092b7:	e9 fa fa ff ff       	jmp    80108db6 <alltraps>
+
+801092bc <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+801092bc:	6a 0c                	push   $0xc
+  jmp alltraps
+801092be:	e9 f3 fa ff ff       	jmp    80108db6 <alltraps>
+
+801092c3 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+801092c3:	6a 0d                	push   $0xd
+  jmp alltraps
+801092c5:	e9 ec fa ff ff       	jmp    80108db6 <alltraps>
+
+801092ca <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+801092ca:	6a 0e                	push   $0xe
+  jmp alltraps
+801092cc:	e9 e5 fa ff ff       	jmp    80108db6 <alltraps>
+
+801092d1 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+801092d1:	6a 00                	push   $0x0
+  pushl $15
+801092d3:	6a 0f                	push   $0xf
+  jmp alltraps
+801092d5:	e9 dc fa ff ff       	jmp    80108db6 <alltraps>
+
+801092da <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+801092da:	6a 00                	push   $0x0
+  pushl $16
+801092dc:	6a 10                	push   $0x10
+  jmp alltraps
+801092de:	e9 d3 fa ff ff       	jmp    80108db6 <alltraps>
+
+801092e3 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+801092e3:	6a 11                	push   $0x11
+  jmp alltraps
+801092e5:	e9 cc fa ff ff       	jmp    80108db6 <alltraps>
+
+801092ea <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+801092ea:	6a 00                	push   $0x0
+  pushl $18
+801092ec:	6a 12                	push   $0x12
+  jmp alltraps
+801092ee:	e9 c3 fa ff ff       	jmp    80108db6 <alltraps>
+
+801092f3 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+801092f3:	6a 00                	push   $0x0
+  pushl $19
+801092f5:	6a 13                	push   $0x13
+  jmp alltraps
+801092f7:	e9 ba fa ff ff       	jmp    80108db6 <alltraps>
+
+801092fc <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+801092fc:	6a 00                	push   $0x0
+  pushl $20
+801092fe:	6a 14                	push   $0x14
+  jmp alltraps
+80109300:	e9 b1 fa ff ff       	jmp    80108db6 <alltraps>
+
+80109305 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109305:	6a 00                	push   $0x0
+  pushl $21
+80109307:	6a 15                	push   $0x15
+  jmp alltraps
+80109309:	e9 a8 fa ff ff       	jmp    80108db6 <alltraps>
+
+8010930e <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+8010930e:	6a 00                	push   $0x0
+  pushl $22
+80109310:	6a 16                	push   $0x16
+  jmp alltraps
+80109312:	e9 9f fa ff ff       	jmp    80108db6 <alltraps>
+
+80109317 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109317:	6a 00                	push   $0x0
+  pushl $23
+80109319:	6a 17                	push   $0x17
+  jmp alltraps
+8010931b:	e9 96 fa ff ff       	jmp    80108db6 <alltraps>
+
+80109320 <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+80109320:	6a 00                	push   $0x0
+  pushl $24
+80109322:	6a 18                	push   $0x18
+  jmp alltraps
+80109324:	e9 8d fa ff ff       	jmp    80108db6 <alltraps>
+
+80109329 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+80109329:	6a 00                	push   $0x0
+  pushl $25
+8010932b:	6a 19                	push   $0x19
+  jmp alltraps
+8010932d:	e9 84 fa ff ff       	jmp    80108db6 <alltraps>
+
+80109332 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+80109332:	6a 00                	push   $0x0
+  pushl $26
+80109334:	6a 1a                	push   $0x1a
+  jmp alltraps
+80109336:	e9 7b fa ff ff       	jmp    80108db6 <alltraps>
+
+8010933b <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+8010933b:	6a 00                	push   $0x0
+  pushl $27
+8010933d:	6a 1b                	push   $0x1b
+  jmp alltraps
+8010933f:	e9 72 fa ff ff       	jmp    80108db6 <alltraps>
+
+80109344 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+80109344:	6a 00                	push   $0x0
+  pushl $28
+80109346:	6a 1c                	push   $0x1c
+  jmp alltraps
+80109348:	e9 69 fa ff ff       	jmp    80108db6 <alltraps>
+
+8010934d <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+8010934d:	6a 00                	push   $0x0
+  pushl $29
+8010934f:	6a 1d                	push   $0x1d
+  jmp alltraps
+80109351:	e9 60 fa ff ff       	jmp    80108db6 <alltraps>
+
+80109356 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+80109356:	6a 00                	push   $0x0
+  pushl $30
+80109358:	6a 1e                	push   $0x1e
+  jmp alltraps
+8010935a:	e9 57 fa ff ff       	jmp    80108db6 <alltraps>
+
+8010935f <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+8010935f:	6a 00                	push   $0x0
+  pushl $31
+80109361:	6a 1f                	push   $0x1f
+  jmp alltraps
+80109363:	e9 4e fa ff ff       	jmp    80108db6 <alltraps>
+
+80109368 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80109368:	6a 00                	push   $0x0
+  pushl $32
+8010936a:	6a 20                	push   $0x20
+  jmp alltraps
+8010936c:	e9 45 fa ff ff       	jmp    80108db6 <alltraps>
+
+80109371 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+80109371:	6a 00                	push   $0x0
+  pushl $33
+80109373:	6a 21                	push   $0x21
+  jmp alltraps
+80109375:	e9 3c fa ff ff       	jmp    80108db6 <alltraps>
+
+8010937a <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+8010937a:	6a 00                	push   $0x0
+  pushl $34
+8010937c:	6a 22                	push   $0x22
+  jmp alltraps
+8010937e:	e9 33 fa ff ff       	jmp    80108db6 <alltraps>
+
+80109383 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+80109383:	6a 00                	push   $0x0
+  pushl $35
+80109385:	6a 23                	push   $0x23
+  jmp alltraps
+80109387:	e9 2a fa ff ff       	jmp    80108db6 <alltraps>
+
+8010938c <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+8010938c:	6a 00                	push   $0x0
+  pushl $36
+8010938e:	6a 24                	push   $0x24
+  jmp alltraps
+80109390:	e9 21 fa ff ff       	jmp    80108db6 <alltraps>
+
+80109395 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80109395:	6a 00                	push   $0x0
+  pushl $37
+80109397:	6a 25                	push   $0x25
+  jmp alltraps
+80109399:	e9 18 fa ff ff       	jmp    80108db6 <alltraps>
+
+8010939e <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+8010939e:	6a 00                	push   $0x0
+  pushl $38
+801093a0:	6a 26                	push   $0x26
+  jmp alltraps
+801093a2:	e9 0f fa ff ff       	jmp    80108db6 <alltraps>
+
+801093a7 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+801093a7:	6a 00                	push   $0x0
+  pushl $39
+801093a9:	6a 27                	push   $0x27
+  jmp alltraps
+801093ab:	e9 06 fa ff ff       	jmp    80108db6 <alltraps>
+
+801093b0 <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+801093b0:	6a 00                	push   $0x0
+  pushl $40
+801093b2:	6a 28                	push   $0x28
+  jmp alltraps
+801093b4:	e9 fd f9 ff ff       	jmp    80108db6 <alltraps>
+
+801093b9 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+801093b9:	6a 00                	push   $0x0
+  pushl $41
+801093bb:	6a 29                	push   $0x29
+  jmp alltraps
+801093bd:	e9 f4 f9 ff ff       	jmp    80108db6 <alltraps>
+
+801093c2 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+801093c2:	6a 00                	push   $0x0
+  pushl $42
+801093c4:	6a 2a                	push   $0x2a
+  jmp alltraps
+801093c6:	e9 eb f9 ff ff       	jmp    80108db6 <alltraps>
+
+801093cb <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+801093cb:	6a 00                	push   $0x0
+  pushl $43
+801093cd:	6a 2b                	push   $0x2b
+  jmp alltraps
+801093cf:	e9 e2 f9 ff ff       	jmp    80108db6 <alltraps>
+
+801093d4 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+801093d4:	6a 00                	push   $0x0
+  pushl $44
+801093d6:	6a 2c                	push   $0x2c
+  jmp alltraps
+801093d8:	e9 d9 f9 ff ff       	jmp    80108db6 <alltraps>
+
+801093dd <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+801093dd:	6a 00                	push   $0x0
+  pushl $45
+801093df:	6a 2d                	push   $0x2d
+  jmp alltraps
+801093e1:	e9 d0 f9 ff ff       	jmp    80108db6 <alltraps>
+
+801093e6 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+801093e6:	6a 00                	push   $0x0
+  pushl $46
+801093e8:	6a 2e                	push   $0x2e
+  jmp alltraps
+801093ea:	e9 c7 f9 ff ff       	jmp    80108db6 <alltraps>
+
+801093ef <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+801093ef:	6a 00                	push   $0x0
+  pushl $47
+801093f1:	6a 2f                	push   $0x2f
+  jmp alltraps
+801093f3:	e9 be f9 ff ff       	jmp    80108db6 <alltraps>
+
+801093f8 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+801093f8:	6a 00                	push   $0x0
+  pushl $48
+801093fa:	6a 30                	push   $0x30
+  jmp alltraps
+801093fc:	e9 b5 f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109401 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80109401:	6a 00                	push   $0x0
+  pushl $49
+80109403:	6a 31                	push   $0x31
+  jmp alltraps
+80109405:	e9 ac f9 ff ff       	jmp    80108db6 <alltraps>
+
+8010940a <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+8010940a:	6a 00                	push   $0x0
+  pushl $50
+8010940c:	6a 32                	push   $0x32
+  jmp alltraps
+8010940e:	e9 a3 f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109413 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80109413:	6a 00                	push   $0x0
+  pushl $51
+80109415:	6a 33                	push   $0x33
+  jmp alltraps
+80109417:	e9 9a f9 ff ff       	jmp    80108db6 <alltraps>
+
+8010941c <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+8010941c:	6a 00                	push   $0x0
+  pushl $52
+8010941e:	6a 34                	push   $0x34
+  jmp alltraps
+80109420:	e9 91 f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109425 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+80109425:	6a 00                	push   $0x0
+  pushl $53
+80109427:	6a 35                	push   $0x35
+  jmp alltraps
+80109429:	e9 88 f9 ff ff       	jmp    80108db6 <alltraps>
+
+8010942e <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+8010942e:	6a 00                	push   $0x0
+  pushl $54
+80109430:	6a 36                	push   $0x36
+  jmp alltraps
+80109432:	e9 7f f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109437 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+80109437:	6a 00                	push   $0x0
+  pushl $55
+80109439:	6a 37                	push   $0x37
+  jmp alltraps
+8010943b:	e9 76 f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109440 <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+80109440:	6a 00                	push   $0x0
+  pushl $56
+80109442:	6a 38                	push   $0x38
+  jmp alltraps
+80109444:	e9 6d f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109449 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+80109449:	6a 00                	push   $0x0
+  pushl $57
+8010944b:	6a 39                	push   $0x39
+  jmp alltraps
+8010944d:	e9 64 f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109452 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+80109452:	6a 00                	push   $0x0
+  pushl $58
+80109454:	6a 3a                	push   $0x3a
+  jmp alltraps
+80109456:	e9 5b f9 ff ff       	jmp    80108db6 <alltraps>
+
+8010945b <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+8010945b:	6a 00                	push   $0x0
+  pushl $59
+8010945d:	6a 3b                	push   $0x3b
+  jmp alltraps
+8010945f:	e9 52 f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109464 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+80109464:	6a 00                	push   $0x0
+  pushl $60
+80109466:	6a 3c                	push   $0x3c
+  jmp alltraps
+80109468:	e9 49 f9 ff ff       	jmp    80108db6 <alltraps>
+
+8010946d <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+8010946d:	6a 00                	push   $0x0
+  pushl $61
+8010946f:	6a 3d                	push   $0x3d
+  jmp alltraps
+80109471:	e9 40 f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109476 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+80109476:	6a 00                	push   $0x0
+  pushl $62
+80109478:	6a 3e                	push   $0x3e
+  jmp alltraps
+8010947a:	e9 37 f9 ff ff       	jmp    80108db6 <alltraps>
+
+8010947f <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+8010947f:	6a 00                	push   $0x0
+  pushl $63
+80109481:	6a 3f                	push   $0x3f
+  jmp alltraps
+80109483:	e9 2e f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109488 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+80109488:	6a 00                	push   $0x0
+  pushl $64
+8010948a:	6a 40                	push   $0x40
+  jmp alltraps
+8010948c:	e9 25 f9 ff ff       	jmp    80108db6 <alltraps>
+
+80109491 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+80109491:	6a 00                	push   $0x0
+  pushl $65
+80109493:	6a 41                	push   $0x41
+  jmp alltraps
+80109495:	e9 1c f9 ff ff       	jmp    80108db6 <alltraps>
+
+8010949a <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+8010949a:	6a 00                	push   $0x0
+  pushl $66
+8010949c:	6a 42                	push   $0x42
+  jmp alltraps
+8010949e:	e9 13 f9 ff ff       	jmp    80108db6 <alltraps>
+
+801094a3 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+801094a3:	6a 00                	push   $0x0
+  pushl $67
+801094a5:	6a 43                	push   $0x43
+  jmp alltraps
+801094a7:	e9 0a f9 ff ff       	jmp    80108db6 <alltraps>
+
+801094ac <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+801094ac:	6a 00                	push   $0x0
+  pushl $68
+801094ae:	6a 44                	push   $0x44
+  jmp alltraps
+801094b0:	e9 01 f9 ff ff       	jmp    80108db6 <alltraps>
+
+801094b5 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+801094b5:	6a 00                	push   $0x0
+  pushl $69
+801094b7:	6a 45                	push   $0x45
+  jmp alltraps
+801094b9:	e9 f8 f8 ff ff       	jmp    80108db6 <alltraps>
+
+801094be <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+801094be:	6a 00                	push   $0x0
+  pushl $70
+801094c0:	6a 46                	push   $0x46
+  jmp alltraps
+801094c2:	e9 ef f8 ff ff       	jmp    80108db6 <alltraps>
+
+801094c7 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+801094c7:	6a 00                	push   $0x0
+  pushl $71
+801094c9:	6a 47                	push   $0x47
+  jmp alltraps
+801094cb:	e9 e6 f8 ff ff       	jmp    80108db6 <alltraps>
+
+801094d0 <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+801094d0:	6a 00                	push   $0x0
+  pushl $72
+801094d2:	6a 48                	push   $0x48
+  jmp alltraps
+801094d4:	e9 dd f8 ff ff       	jmp    80108db6 <alltraps>
+
+801094d9 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+801094d9:	6a 00                	push   $0x0
+  pushl $73
+801094db:	6a 49                	push   $0x49
+  jmp alltraps
+801094dd:	e9 d4 f8 ff ff       	jmp    80108db6 <alltraps>
+
+801094e2 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+801094e2:	6a 00                	push   $0x0
+  pushl $74
+801094e4:	6a 4a                	push   $0x4a
+  jmp alltraps
+801094e6:	e9 cb f8 ff ff       	jmp    80108db6 <alltraps>
+
+801094eb <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+801094eb:	6a 00                	push   $0x0
+  pushl $75
+801094ed:	6a 4b                	push   $0x4b
+  jmp alltraps
+801094ef:	e9 c2 f8 ff ff       	jmp    80108db6 <alltraps>
+
+801094f4 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+801094f4:	6a 00                	push   $0x0
+  pushl $76
+801094f6:	6a 4c                	push   $0x4c
+  jmp alltraps
+801094f8:	e9 b9 f8 ff ff       	jmp    80108db6 <alltraps>
+
+801094fd <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+801094fd:	6a 00                	push   $0x0
+  pushl $77
+801094ff:	6a 4d                	push   $0x4d
+  jmp alltraps
+80109501:	e9 b0 f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109506 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+80109506:	6a 00                	push   $0x0
+  pushl $78
+80109508:	6a 4e                	push   $0x4e
+  jmp alltraps
+8010950a:	e9 a7 f8 ff ff       	jmp    80108db6 <alltraps>
+
+8010950f <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+8010950f:	6a 00                	push   $0x0
+  pushl $79
+80109511:	6a 4f                	push   $0x4f
+  jmp alltraps
+80109513:	e9 9e f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109518 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+80109518:	6a 00                	push   $0x0
+  pushl $80
+8010951a:	6a 50                	push   $0x50
+  jmp alltraps
+8010951c:	e9 95 f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109521 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+80109521:	6a 00                	push   $0x0
+  pushl $81
+80109523:	6a 51                	push   $0x51
+  jmp alltraps
+80109525:	e9 8c f8 ff ff       	jmp    80108db6 <alltraps>
+
+8010952a <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+8010952a:	6a 00                	push   $0x0
+  pushl $82
+8010952c:	6a 52                	push   $0x52
+  jmp alltraps
+8010952e:	e9 83 f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109533 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+80109533:	6a 00                	push   $0x0
+  pushl $83
+80109535:	6a 53                	push   $0x53
+  jmp alltraps
+80109537:	e9 7a f8 ff ff       	jmp    80108db6 <alltraps>
+
+8010953c <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+8010953c:	6a 00                	push   $0x0
+  pushl $84
+8010953e:	6a 54                	push   $0x54
+  jmp alltraps
+80109540:	e9 71 f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109545 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+80109545:	6a 00                	push   $0x0
+  pushl $85
+80109547:	6a 55                	push   $0x55
+  jmp alltraps
+80109549:	e9 68 f8 ff ff       	jmp    80108db6 <alltraps>
+
+8010954e <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+8010954e:	6a 00                	push   $0x0
+  pushl $86
+80109550:	6a 56                	push   $0x56
+  jmp alltraps
+80109552:	e9 5f f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109557 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+80109557:	6a 00                	push   $0x0
+  pushl $87
+80109559:	6a 57                	push   $0x57
+  jmp alltraps
+8010955b:	e9 56 f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109560 <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+80109560:	6a 00                	push   $0x0
+  pushl $88
+80109562:	6a 58                	push   $0x58
+  jmp alltraps
+80109564:	e9 4d f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109569 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+80109569:	6a 00                	push   $0x0
+  pushl $89
+8010956b:	6a 59                	push   $0x59
+  jmp alltraps
+8010956d:	e9 44 f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109572 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+80109572:	6a 00                	push   $0x0
+  pushl $90
+80109574:	6a 5a                	push   $0x5a
+  jmp alltraps
+80109576:	e9 3b f8 ff ff       	jmp    80108db6 <alltraps>
+
+8010957b <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+8010957b:	6a 00                	push   $0x0
+  pushl $91
+8010957d:	6a 5b                	push   $0x5b
+  jmp alltraps
+8010957f:	e9 32 f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109584 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+80109584:	6a 00                	push   $0x0
+  pushl $92
+80109586:	6a 5c                	push   $0x5c
+  jmp alltraps
+80109588:	e9 29 f8 ff ff       	jmp    80108db6 <alltraps>
+
+8010958d <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+8010958d:	6a 00                	push   $0x0
+  pushl $93
+8010958f:	6a 5d                	push   $0x5d
+  jmp alltraps
+80109591:	e9 20 f8 ff ff       	jmp    80108db6 <alltraps>
+
+80109596 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80109596:	6a 00                	push   $0x0
+  pushl $94
+80109598:	6a 5e                	push   $0x5e
+  jmp alltraps
+8010959a:	e9 17 f8 ff ff       	jmp    80108db6 <alltraps>
+
+8010959f <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+8010959f:	6a 00                	push   $0x0
+  pushl $95
+801095a1:	6a 5f                	push   $0x5f
+  jmp alltraps
+801095a3:	e9 0e f8 ff ff       	jmp    80108db6 <alltraps>
+
+801095a8 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+801095a8:	6a 00                	push   $0x0
+  pushl $96
+801095aa:	6a 60                	push   $0x60
+  jmp alltraps
+801095ac:	e9 05 f8 ff ff       	jmp    80108db6 <alltraps>
+
+801095b1 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+801095b1:	6a 00                	push   $0x0
+  pushl $97
+801095b3:	6a 61                	push   $0x61
+  jmp alltraps
+801095b5:	e9 fc f7 ff ff       	jmp    80108db6 <alltraps>
+
+801095ba <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+801095ba:	6a 00                	push   $0x0
+  pushl $98
+801095bc:	6a 62                	push   $0x62
+  jmp alltraps
+801095be:	e9 f3 f7 ff ff       	jmp    80108db6 <alltraps>
+
+801095c3 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+801095c3:	6a 00                	push   $0x0
+  pushl $99
+801095c5:	6a 63                	push   $0x63
+  jmp alltraps
+801095c7:	e9 ea f7 ff ff       	jmp    80108db6 <alltraps>
+
+801095cc <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+801095cc:	6a 00                	push   $0x0
+  pushl $100
+801095ce:	6a 64                	push   $0x64
+  jmp alltraps
+801095d0:	e9 e1 f7 ff ff       	jmp    80108db6 <alltraps>
+
+801095d5 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+801095d5:	6a 00                	push   $0x0
+  pushl $101
+801095d7:	6a 65                	push   $0x65
+  jmp alltraps
+801095d9:	e9 d8 f7 ff ff       	jmp    80108db6 <alltraps>
+
+801095de <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+801095de:	6a 00                	push   $0x0
+  pushl $102
+801095e0:	6a 66                	push   $0x66
+  jmp alltraps
+801095e2:	e9 cf f7 ff ff       	jmp    80108db6 <alltraps>
+
+801095e7 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+801095e7:	6a 00                	push   $0x0
+  pushl $103
+801095e9:	6a 67                	push   $0x67
+  jmp alltraps
+801095eb:	e9 c6 f7 ff ff       	jmp    80108db6 <alltraps>
+
+801095f0 <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+801095f0:	6a 00                	push   $0x0
+  pushl $104
+801095f2:	6a 68                	push   $0x68
+  jmp alltraps
+801095f4:	e9 bd f7 ff ff       	jmp    80108db6 <alltraps>
+
+801095f9 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+801095f9:	6a 00                	push   $0x0
+  pushl $105
+801095fb:	6a 69                	push   $0x69
+  jmp alltraps
+801095fd:	e9 b4 f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109602 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+80109602:	6a 00                	push   $0x0
+  pushl $106
+80109604:	6a 6a                	push   $0x6a
+  jmp alltraps
+80109606:	e9 ab f7 ff ff       	jmp    80108db6 <alltraps>
+
+8010960b <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010960b:	6a 00                	push   $0x0
+  pushl $107
+8010960d:	6a 6b                	push   $0x6b
+  jmp alltraps
+8010960f:	e9 a2 f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109614 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+80109614:	6a 00                	push   $0x0
+  pushl $108
+80109616:	6a 6c                	push   $0x6c
+  jmp alltraps
+80109618:	e9 99 f7 ff ff       	jmp    80108db6 <alltraps>
+
+8010961d <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010961d:	6a 00                	push   $0x0
+  pushl $109
+8010961f:	6a 6d                	push   $0x6d
+  jmp alltraps
+80109621:	e9 90 f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109626 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+80109626:	6a 00                	push   $0x0
+  pushl $110
+80109628:	6a 6e                	push   $0x6e
+  jmp alltraps
+8010962a:	e9 87 f7 ff ff       	jmp    80108db6 <alltraps>
+
+8010962f <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+8010962f:	6a 00                	push   $0x0
+  pushl $111
+80109631:	6a 6f                	push   $0x6f
+  jmp alltraps
+80109633:	e9 7e f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109638 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+80109638:	6a 00                	push   $0x0
+  pushl $112
+8010963a:	6a 70                	push   $0x70
+  jmp alltraps
+8010963c:	e9 75 f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109641 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+80109641:	6a 00                	push   $0x0
+  pushl $113
+80109643:	6a 71                	push   $0x71
+  jmp alltraps
+80109645:	e9 6c f7 ff ff       	jmp    80108db6 <alltraps>
+
+8010964a <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+8010964a:	6a 00                	push   $0x0
+  pushl $114
+8010964c:	6a 72                	push   $0x72
+  jmp alltraps
+8010964e:	e9 63 f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109653 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+80109653:	6a 00                	push   $0x0
+  pushl $115
+80109655:	6a 73                	push   $0x73
+  jmp alltraps
+80109657:	e9 5a f7 ff ff       	jmp    80108db6 <alltraps>
+
+8010965c <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+8010965c:	6a 00                	push   $0x0
+  pushl $116
+8010965e:	6a 74                	push   $0x74
+  jmp alltraps
+80109660:	e9 51 f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109665 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+80109665:	6a 00                	push   $0x0
+  pushl $117
+80109667:	6a 75                	push   $0x75
+  jmp alltraps
+80109669:	e9 48 f7 ff ff       	jmp    80108db6 <alltraps>
+
+8010966e <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+8010966e:	6a 00                	push   $0x0
+  pushl $118
+80109670:	6a 76                	push   $0x76
+  jmp alltraps
+80109672:	e9 3f f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109677 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+80109677:	6a 00                	push   $0x0
+  pushl $119
+80109679:	6a 77                	push   $0x77
+  jmp alltraps
+8010967b:	e9 36 f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109680 <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+80109680:	6a 00                	push   $0x0
+  pushl $120
+80109682:	6a 78                	push   $0x78
+  jmp alltraps
+80109684:	e9 2d f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109689 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+80109689:	6a 00                	push   $0x0
+  pushl $121
+8010968b:	6a 79                	push   $0x79
+  jmp alltraps
+8010968d:	e9 24 f7 ff ff       	jmp    80108db6 <alltraps>
+
+80109692 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+80109692:	6a 00                	push   $0x0
+  pushl $122
+80109694:	6a 7a                	push   $0x7a
+  jmp alltraps
+80109696:	e9 1b f7 ff ff       	jmp    80108db6 <alltraps>
+
+8010969b <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+8010969b:	6a 00                	push   $0x0
+  pushl $123
+8010969d:	6a 7b                	push   $0x7b
+  jmp alltraps
+8010969f:	e9 12 f7 ff ff       	jmp    80108db6 <alltraps>
+
+801096a4 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+801096a4:	6a 00                	push   $0x0
+  pushl $124
+801096a6:	6a 7c                	push   $0x7c
+  jmp alltraps
+801096a8:	e9 09 f7 ff ff       	jmp    80108db6 <alltraps>
+
+801096ad <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+801096ad:	6a 00                	push   $0x0
+  pushl $125
+801096af:	6a 7d                	push   $0x7d
+  jmp alltraps
+801096b1:	e9 00 f7 ff ff       	jmp    80108db6 <alltraps>
+
+801096b6 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+801096b6:	6a 00                	push   $0x0
+  pushl $126
+801096b8:	6a 7e                	push   $0x7e
+  jmp alltraps
+801096ba:	e9 f7 f6 ff ff       	jmp    80108db6 <alltraps>
+
+801096bf <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+801096bf:	6a 00                	push   $0x0
+  pushl $127
+801096c1:	6a 7f                	push   $0x7f
+  jmp alltraps
+801096c3:	e9 ee f6 ff ff       	jmp    80108db6 <alltraps>
+
+801096c8 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+801096c8:	6a 00                	push   $0x0
+  pushl $128
+801096ca:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+801096cf:	e9 e2 f6 ff ff       	jmp    80108db6 <alltraps>
+
+801096d4 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+801096d4:	6a 00                	push   $0x0
+  pushl $129
+801096d6:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+801096db:	e9 d6 f6 ff ff       	jmp    80108db6 <alltraps>
+
+801096e0 <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+801096e0:	6a 00                	push   $0x0
+  pushl $130
+801096e2:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+801096e7:	e9 ca f6 ff ff       	jmp    80108db6 <alltraps>
+
+801096ec <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+801096ec:	6a 00                	push   $0x0
+  pushl $131
+801096ee:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+801096f3:	e9 be f6 ff ff       	jmp    80108db6 <alltraps>
+
+801096f8 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+801096f8:	6a 00                	push   $0x0
+  pushl $132
+801096fa:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+801096ff:	e9 b2 f6 ff ff       	jmp    80108db6 <alltraps>
+
+80109704 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+80109704:	6a 00                	push   $0x0
+  pushl $133
+80109706:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+8010970b:	e9 a6 f6 ff ff       	jmp    80108db6 <alltraps>
+
+80109710 <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+80109710:	6a 00                	push   $0x0
+  pushl $134
+80109712:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+80109717:	e9 9a f6 ff ff       	jmp    80108db6 <alltraps>
+
+8010971c <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+8010971c:	6a 00                	push   $0x0
+  pushl $135
+8010971e:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+80109723:	e9 8e f6 ff ff       	jmp    80108db6 <alltraps>
+
+80109728 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+80109728:	6a 00                	push   $0x0
+  pushl $136
+8010972a:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+8010972f:	e9 82 f6 ff ff       	jmp    80108db6 <alltraps>
+
+80109734 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+80109734:	6a 00                	push   $0x0
+  pushl $137
+80109736:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+8010973b:	e9 76 f6 ff ff       	jmp    80108db6 <alltraps>
+
+80109740 <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+80109740:	6a 00                	push   $0x0
+  pushl $138
+80109742:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+80109747:	e9 6a f6 ff ff       	jmp    80108db6 <alltraps>
+
+8010974c <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+8010974c:	6a 00                	push   $0x0
+  pushl $139
+8010974e:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+80109753:	e9 5e f6 ff ff       	jmp    80108db6 <alltraps>
+
+80109758 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+80109758:	6a 00                	push   $0x0
+  pushl $140
+8010975a:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+8010975f:	e9 52 f6 ff ff       	jmp    80108db6 <alltraps>
+
+80109764 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+80109764:	6a 00                	push   $0x0
+  pushl $141
+80109766:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+8010976b:	e9 46 f6 ff ff       	jmp    80108db6 <alltraps>
+
+80109770 <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+80109770:	6a 00                	push   $0x0
+  pushl $142
+80109772:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+80109777:	e9 3a f6 ff ff       	jmp    80108db6 <alltraps>
+
+8010977c <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+8010977c:	6a 00                	push   $0x0
+  pushl $143
+8010977e:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+80109783:	e9 2e f6 ff ff       	jmp    80108db6 <alltraps>
+
+80109788 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+80109788:	6a 00                	push   $0x0
+  pushl $144
+8010978a:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+8010978f:	e9 22 f6 ff ff       	jmp    80108db6 <alltraps>
+
+80109794 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+80109794:	6a 00                	push   $0x0
+  pushl $145
+80109796:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+8010979b:	e9 16 f6 ff ff       	jmp    80108db6 <alltraps>
+
+801097a0 <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+801097a0:	6a 00                	push   $0x0
+  pushl $146
+801097a2:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+801097a7:	e9 0a f6 ff ff       	jmp    80108db6 <alltraps>
+
+801097ac <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+801097ac:	6a 00                	push   $0x0
+  pushl $147
+801097ae:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+801097b3:	e9 fe f5 ff ff       	jmp    80108db6 <alltraps>
+
+801097b8 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+801097b8:	6a 00                	push   $0x0
+  pushl $148
+801097ba:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+801097bf:	e9 f2 f5 ff ff       	jmp    80108db6 <alltraps>
+
+801097c4 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+801097c4:	6a 00                	push   $0x0
+  pushl $149
+801097c6:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+801097cb:	e9 e6 f5 ff ff       	jmp    80108db6 <alltraps>
+
+801097d0 <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+801097d0:	6a 00                	push   $0x0
+  pushl $150
+801097d2:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+801097d7:	e9 da f5 ff ff       	jmp    80108db6 <alltraps>
+
+801097dc <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+801097dc:	6a 00                	push   $0x0
+  pushl $151
+801097de:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+801097e3:	e9 ce f5 ff ff       	jmp    80108db6 <alltraps>
+
+801097e8 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+801097e8:	6a 00                	push   $0x0
+  pushl $152
+801097ea:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+801097ef:	e9 c2 f5 ff ff       	jmp    80108db6 <alltraps>
+
+801097f4 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+801097f4:	6a 00                	push   $0x0
+  pushl $153
+801097f6:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+801097fb:	e9 b6 f5 ff ff       	jmp    80108db6 <alltraps>
+
+80109800 <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+80109800:	6a 00                	push   $0x0
+  pushl $154
+80109802:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+80109807:	e9 aa f5 ff ff       	jmp    80108db6 <alltraps>
+
+8010980c <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+8010980c:	6a 00                	push   $0x0
+  pushl $155
+8010980e:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+80109813:	e9 9e f5 ff ff       	jmp    80108db6 <alltraps>
+
+80109818 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+80109818:	6a 00                	push   $0x0
+  pushl $156
+8010981a:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+8010981f:	e9 92 f5 ff ff       	jmp    80108db6 <alltraps>
+
+80109824 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+80109824:	6a 00                	push   $0x0
+  pushl $157
+80109826:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+8010982b:	e9 86 f5 ff ff       	jmp    80108db6 <alltraps>
+
+80109830 <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+80109830:	6a 00                	push   $0x0
+  pushl $158
+80109832:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+80109837:	e9 7a f5 ff ff       	jmp    80108db6 <alltraps>
+
+8010983c <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+8010983c:	6a 00                	push   $0x0
+  pushl $159
+8010983e:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+80109843:	e9 6e f5 ff ff       	jmp    80108db6 <alltraps>
+
+80109848 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+80109848:	6a 00                	push   $0x0
+  pushl $160
+8010984a:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+8010984f:	e9 62 f5 ff ff       	jmp    80108db6 <alltraps>
+
+80109854 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+80109854:	6a 00                	push   $0x0
+  pushl $161
+80109856:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+8010985b:	e9 56 f5 ff ff       	jmp    80108db6 <alltraps>
+
+80109860 <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+80109860:	6a 00                	push   $0x0
+  pushl $162
+80109862:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+80109867:	e9 4a f5 ff ff       	jmp    80108db6 <alltraps>
+
+8010986c <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+8010986c:	6a 00                	push   $0x0
+  pushl $163
+8010986e:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+80109873:	e9 3e f5 ff ff       	jmp    80108db6 <alltraps>
+
+80109878 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+80109878:	6a 00                	push   $0x0
+  pushl $164
+8010987a:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+8010987f:	e9 32 f5 ff ff       	jmp    80108db6 <alltraps>
+
+80109884 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+80109884:	6a 00                	push   $0x0
+  pushl $165
+80109886:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+8010988b:	e9 26 f5 ff ff       	jmp    80108db6 <alltraps>
+
+80109890 <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+80109890:	6a 00                	push   $0x0
+  pushl $166
+80109892:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80109897:	e9 1a f5 ff ff       	jmp    80108db6 <alltraps>
+
+8010989c <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+8010989c:	6a 00                	push   $0x0
+  pushl $167
+8010989e:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+801098a3:	e9 0e f5 ff ff       	jmp    80108db6 <alltraps>
+
+801098a8 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+801098a8:	6a 00                	push   $0x0
+  pushl $168
+801098aa:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+801098af:	e9 02 f5 ff ff       	jmp    80108db6 <alltraps>
+
+801098b4 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+801098b4:	6a 00                	push   $0x0
+  pushl $169
+801098b6:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+801098bb:	e9 f6 f4 ff ff       	jmp    80108db6 <alltraps>
+
+801098c0 <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+801098c0:	6a 00                	push   $0x0
+  pushl $170
+801098c2:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+801098c7:	e9 ea f4 ff ff       	jmp    80108db6 <alltraps>
+
+801098cc <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+801098cc:	6a 00                	push   $0x0
+  pushl $171
+801098ce:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+801098d3:	e9 de f4 ff ff       	jmp    80108db6 <alltraps>
+
+801098d8 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+801098d8:	6a 00                	push   $0x0
+  pushl $172
+801098da:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+801098df:	e9 d2 f4 ff ff       	jmp    80108db6 <alltraps>
+
+801098e4 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+801098e4:	6a 00                	push   $0x0
+  pushl $173
+801098e6:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+801098eb:	e9 c6 f4 ff ff       	jmp    80108db6 <alltraps>
+
+801098f0 <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+801098f0:	6a 00                	push   $0x0
+  pushl $174
+801098f2:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+801098f7:	e9 ba f4 ff ff       	jmp    80108db6 <alltraps>
+
+801098fc <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+801098fc:	6a 00                	push   $0x0
+  pushl $175
+801098fe:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+80109903:	e9 ae f4 ff ff       	jmp    80108db6 <alltraps>
+
+80109908 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+80109908:	6a 00                	push   $0x0
+  pushl $176
+8010990a:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+8010990f:	e9 a2 f4 ff ff       	jmp    80108db6 <alltraps>
+
+80109914 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+80109914:	6a 00                	push   $0x0
+  pushl $177
+80109916:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+8010991b:	e9 96 f4 ff ff       	jmp    80108db6 <alltraps>
+
+80109920 <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+80109920:	6a 00                	push   $0x0
+  pushl $178
+80109922:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+80109927:	e9 8a f4 ff ff       	jmp    80108db6 <alltraps>
+
+8010992c <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+8010992c:	6a 00                	push   $0x0
+  pushl $179
+8010992e:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+80109933:	e9 7e f4 ff ff       	jmp    80108db6 <alltraps>
+
+80109938 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+80109938:	6a 00                	push   $0x0
+  pushl $180
+8010993a:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+8010993f:	e9 72 f4 ff ff       	jmp    80108db6 <alltraps>
+
+80109944 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+80109944:	6a 00                	push   $0x0
+  pushl $181
+80109946:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+8010994b:	e9 66 f4 ff ff       	jmp    80108db6 <alltraps>
+
+80109950 <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+80109950:	6a 00                	push   $0x0
+  pushl $182
+80109952:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+80109957:	e9 5a f4 ff ff       	jmp    80108db6 <alltraps>
+
+8010995c <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+8010995c:	6a 00                	push   $0x0
+  pushl $183
+8010995e:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+80109963:	e9 4e f4 ff ff       	jmp    80108db6 <alltraps>
+
+80109968 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+80109968:	6a 00                	push   $0x0
+  pushl $184
+8010996a:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010996f:	e9 42 f4 ff ff       	jmp    80108db6 <alltraps>
+
+80109974 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+80109974:	6a 00                	push   $0x0
+  pushl $185
+80109976:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+8010997b:	e9 36 f4 ff ff       	jmp    80108db6 <alltraps>
+
+80109980 <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+80109980:	6a 00                	push   $0x0
+  pushl $186
+80109982:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+80109987:	e9 2a f4 ff ff       	jmp    80108db6 <alltraps>
+
+8010998c <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+8010998c:	6a 00                	push   $0x0
+  pushl $187
+8010998e:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+80109993:	e9 1e f4 ff ff       	jmp    80108db6 <alltraps>
+
+80109998 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+80109998:	6a 00                	push   $0x0
+  pushl $188
+8010999a:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010999f:	e9 12 f4 ff ff       	jmp    80108db6 <alltraps>
+
+801099a4 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+801099a4:	6a 00                	push   $0x0
+  pushl $189
+801099a6:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+801099ab:	e9 06 f4 ff ff       	jmp    80108db6 <alltraps>
+
+801099b0 <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+801099b0:	6a 00                	push   $0x0
+  pushl $190
+801099b2:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+801099b7:	e9 fa f3 ff ff       	jmp    80108db6 <alltraps>
+
+801099bc <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+801099bc:	6a 00                	push   $0x0
+  pushl $191
+801099be:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+801099c3:	e9 ee f3 ff ff       	jmp    80108db6 <alltraps>
+
+801099c8 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+801099c8:	6a 00                	push   $0x0
+  pushl $192
+801099ca:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+801099cf:	e9 e2 f3 ff ff       	jmp    80108db6 <alltraps>
+
+801099d4 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+801099d4:	6a 00                	push   $0x0
+  pushl $193
+801099d6:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+801099db:	e9 d6 f3 ff ff       	jmp    80108db6 <alltraps>
+
+801099e0 <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+801099e0:	6a 00                	push   $0x0
+  pushl $194
+801099e2:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+801099e7:	e9 ca f3 ff ff       	jmp    80108db6 <alltraps>
+
+801099ec <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+801099ec:	6a 00                	push   $0x0
+  pushl $195
+801099ee:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+801099f3:	e9 be f3 ff ff       	jmp    80108db6 <alltraps>
+
+801099f8 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+801099f8:	6a 00                	push   $0x0
+  pushl $196
+801099fa:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+801099ff:	e9 b2 f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a04 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+80109a04:	6a 00                	push   $0x0
+  pushl $197
+80109a06:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+80109a0b:	e9 a6 f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a10 <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+80109a10:	6a 00                	push   $0x0
+  pushl $198
+80109a12:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+80109a17:	e9 9a f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a1c <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+80109a1c:	6a 00                	push   $0x0
+  pushl $199
+80109a1e:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+80109a23:	e9 8e f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a28 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+80109a28:	6a 00                	push   $0x0
+  pushl $200
+80109a2a:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+80109a2f:	e9 82 f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a34 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+80109a34:	6a 00                	push   $0x0
+  pushl $201
+80109a36:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+80109a3b:	e9 76 f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a40 <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+80109a40:	6a 00                	push   $0x0
+  pushl $202
+80109a42:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+80109a47:	e9 6a f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a4c <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+80109a4c:	6a 00                	push   $0x0
+  pushl $203
+80109a4e:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+80109a53:	e9 5e f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a58 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+80109a58:	6a 00                	push   $0x0
+  pushl $204
+80109a5a:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+80109a5f:	e9 52 f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a64 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+80109a64:	6a 00                	push   $0x0
+  pushl $205
+80109a66:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+80109a6b:	e9 46 f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a70 <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+80109a70:	6a 00                	push   $0x0
+  pushl $206
+80109a72:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+80109a77:	e9 3a f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a7c <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+80109a7c:	6a 00                	push   $0x0
+  pushl $207
+80109a7e:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+80109a83:	e9 2e f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a88 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+80109a88:	6a 00                	push   $0x0
+  pushl $208
+80109a8a:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+80109a8f:	e9 22 f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109a94 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+80109a94:	6a 00                	push   $0x0
+  pushl $209
+80109a96:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+80109a9b:	e9 16 f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109aa0 <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+80109aa0:	6a 00                	push   $0x0
+  pushl $210
+80109aa2:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+80109aa7:	e9 0a f3 ff ff       	jmp    80108db6 <alltraps>
+
+80109aac <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+80109aac:	6a 00                	push   $0x0
+  pushl $211
+80109aae:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+80109ab3:	e9 fe f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109ab8 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+80109ab8:	6a 00                	push   $0x0
+  pushl $212
+80109aba:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+80109abf:	e9 f2 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109ac4 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+80109ac4:	6a 00                	push   $0x0
+  pushl $213
+80109ac6:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+80109acb:	e9 e6 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109ad0 <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+80109ad0:	6a 00                	push   $0x0
+  pushl $214
+80109ad2:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+80109ad7:	e9 da f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109adc <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+80109adc:	6a 00                	push   $0x0
+  pushl $215
+80109ade:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+80109ae3:	e9 ce f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109ae8 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+80109ae8:	6a 00                	push   $0x0
+  pushl $216
+80109aea:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+80109aef:	e9 c2 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109af4 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+80109af4:	6a 00                	push   $0x0
+  pushl $217
+80109af6:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+80109afb:	e9 b6 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b00 <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+80109b00:	6a 00                	push   $0x0
+  pushl $218
+80109b02:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+80109b07:	e9 aa f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b0c <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+80109b0c:	6a 00                	push   $0x0
+  pushl $219
+80109b0e:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+80109b13:	e9 9e f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b18 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+80109b18:	6a 00                	push   $0x0
+  pushl $220
+80109b1a:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+80109b1f:	e9 92 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b24 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+80109b24:	6a 00                	push   $0x0
+  pushl $221
+80109b26:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+80109b2b:	e9 86 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b30 <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+80109b30:	6a 00                	push   $0x0
+  pushl $222
+80109b32:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+80109b37:	e9 7a f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b3c <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+80109b3c:	6a 00                	push   $0x0
+  pushl $223
+80109b3e:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+80109b43:	e9 6e f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b48 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+80109b48:	6a 00                	push   $0x0
+  pushl $224
+80109b4a:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+80109b4f:	e9 62 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b54 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+80109b54:	6a 00                	push   $0x0
+  pushl $225
+80109b56:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+80109b5b:	e9 56 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b60 <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+80109b60:	6a 00                	push   $0x0
+  pushl $226
+80109b62:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+80109b67:	e9 4a f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b6c <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+80109b6c:	6a 00                	push   $0x0
+  pushl $227
+80109b6e:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+80109b73:	e9 3e f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b78 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+80109b78:	6a 00                	push   $0x0
+  pushl $228
+80109b7a:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+80109b7f:	e9 32 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b84 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+80109b84:	6a 00                	push   $0x0
+  pushl $229
+80109b86:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+80109b8b:	e9 26 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b90 <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+80109b90:	6a 00                	push   $0x0
+  pushl $230
+80109b92:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+80109b97:	e9 1a f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109b9c <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+80109b9c:	6a 00                	push   $0x0
+  pushl $231
+80109b9e:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+80109ba3:	e9 0e f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109ba8 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+80109ba8:	6a 00                	push   $0x0
+  pushl $232
+80109baa:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+80109baf:	e9 02 f2 ff ff       	jmp    80108db6 <alltraps>
+
+80109bb4 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+80109bb4:	6a 00                	push   $0x0
+  pushl $233
+80109bb6:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+80109bbb:	e9 f6 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109bc0 <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+80109bc0:	6a 00                	push   $0x0
+  pushl $234
+80109bc2:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+80109bc7:	e9 ea f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109bcc <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+80109bcc:	6a 00                	push   $0x0
+  pushl $235
+80109bce:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+80109bd3:	e9 de f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109bd8 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+80109bd8:	6a 00                	push   $0x0
+  pushl $236
+80109bda:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+80109bdf:	e9 d2 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109be4 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+80109be4:	6a 00                	push   $0x0
+  pushl $237
+80109be6:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+80109beb:	e9 c6 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109bf0 <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+80109bf0:	6a 00                	push   $0x0
+  pushl $238
+80109bf2:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+80109bf7:	e9 ba f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109bfc <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+80109bfc:	6a 00                	push   $0x0
+  pushl $239
+80109bfe:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+80109c03:	e9 ae f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c08 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+80109c08:	6a 00                	push   $0x0
+  pushl $240
+80109c0a:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+80109c0f:	e9 a2 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c14 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+80109c14:	6a 00                	push   $0x0
+  pushl $241
+80109c16:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+80109c1b:	e9 96 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c20 <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+80109c20:	6a 00                	push   $0x0
+  pushl $242
+80109c22:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+80109c27:	e9 8a f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c2c <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+80109c2c:	6a 00                	push   $0x0
+  pushl $243
+80109c2e:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+80109c33:	e9 7e f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c38 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+80109c38:	6a 00                	push   $0x0
+  pushl $244
+80109c3a:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+80109c3f:	e9 72 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c44 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+80109c44:	6a 00                	push   $0x0
+  pushl $245
+80109c46:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+80109c4b:	e9 66 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c50 <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+80109c50:	6a 00                	push   $0x0
+  pushl $246
+80109c52:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+80109c57:	e9 5a f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c5c <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+80109c5c:	6a 00                	push   $0x0
+  pushl $247
+80109c5e:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+80109c63:	e9 4e f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c68 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+80109c68:	6a 00                	push   $0x0
+  pushl $248
+80109c6a:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+80109c6f:	e9 42 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c74 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+80109c74:	6a 00                	push   $0x0
+  pushl $249
+80109c76:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+80109c7b:	e9 36 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c80 <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+80109c80:	6a 00                	push   $0x0
+  pushl $250
+80109c82:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+80109c87:	e9 2a f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c8c <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+80109c8c:	6a 00                	push   $0x0
+  pushl $251
+80109c8e:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+80109c93:	e9 1e f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109c98 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+80109c98:	6a 00                	push   $0x0
+  pushl $252
+80109c9a:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+80109c9f:	e9 12 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109ca4 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+80109ca4:	6a 00                	push   $0x0
+  pushl $253
+80109ca6:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+80109cab:	e9 06 f1 ff ff       	jmp    80108db6 <alltraps>
+
+80109cb0 <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+80109cb0:	6a 00                	push   $0x0
+  pushl $254
+80109cb2:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+80109cb7:	e9 fa f0 ff ff       	jmp    80108db6 <alltraps>
+
+80109cbc <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+80109cbc:	6a 00                	push   $0x0
+  pushl $255
+80109cbe:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+80109cc3:	e9 ee f0 ff ff       	jmp    80108db6 <alltraps>
+
+80109cc8 <descalloc>:
+static int
+descalloc(void)
+{
+  int i;
+
+  i = vdisk.freehead;
+80109cc8:	0f b7 15 4a 10 34 80 	movzwl 0x8034104a,%edx
+  vdisk.freehead = vdisk.desc[i].next;
+80109ccf:	89 d0                	mov    %edx,%eax
+80109cd1:	c1 e0 04             	shl    $0x4,%eax
+80109cd4:	03 05 3c 10 34 80    	add    0x8034103c,%eax
+80109cda:	0f b7 40 0e          	movzwl 0xe(%eax),%eax
+80109cde:	66 a3 4a 10 34 80    	mov    %ax,0x8034104a
+  vdisk.nfree--;
+80109ce4:	a1 4c 10 34 80       	mov    0x8034104c,%eax
+80109ce9:	83 e8 01             	sub    $0x1,%eax
+80109cec:	a3 4c 10 34 80       	mov    %eax,0x8034104c
+  return i;
+}
+80109cf1:	89 d0                	mov    %edx,%eax
+80109cf3:	c3                   	ret
+
+80109cf4 <descfree>:
+
+static void
+descfree(int i)
+{
+  vdisk.desc[i].next = vdisk.freehead;
+80109cf4:	89 c2                	mov    %eax,%edx
+80109cf6:	c1 e2 04             	shl    $0x4,%edx
+80109cf9:	03 15 3c 10 34 80    	add    0x8034103c,%edx
+80109cff:	0f b7 0d 4a 10 34 80 	movzwl 0x8034104a,%ecx
+80109d06:	66 89 4a 0e          	mov    %cx,0xe(%edx)
+  vdisk.freehead = i;
+80109d0a:	66 a3 4a 10 34 80    	mov    %ax,0x8034104a
+  vdisk.nfree++;
+80109d10:	a1 4c 10 34 80       	mov    0x8034104c,%eax
+80109d15:	83 c0 01             	add    $0x1,%eax
+80109d18:	a3 4c 10 34 80       	mov    %eax,0x8034104c
+}
+80109d1d:	c3                   	ret
+
+80109d1e <virtioqueue>:
+// Put b on the queue as a three-descriptor chain: request
+// header, data, status byte. Caller must hold vdisk.lock and
+// have checked that three descriptors are free.
+static void
+virtioqueue(struct buf *b)
+{
+80109d1e:	55                   	push   %ebp
+80109d1f:	89 e5                	mov    %esp,%ebp
+80109d21:	57                   	push   %edi
+80109d22:	56                   	push   %esi
+80109d23:	53                   	push   %ebx
+80109d24:	83 ec 1c             	sub    $0x1c,%esp
+80109d27:	89 c7                	mov    %eax,%edi
+  int h, d, s;
+  struct vring_desc *desc = vdisk.desc;
+80109d29:	8b 35 3c 10 34 80    	mov    0x8034103c,%esi
+
+  h = descalloc();
+80109d2f:	e8 94 ff ff ff       	call   80109cc8 <descalloc>
+80109d34:	89 c3                	mov    %eax,%ebx
+  d = descalloc();
+80109d36:	e8 8d ff ff ff       	call   80109cc8 <descalloc>
+80109d3b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  s = descalloc();
+80109d3e:	e8 85 ff ff ff       	call   80109cc8 <descalloc>
+80109d43:	89 45 e0             	mov    %eax,-0x20(%ebp)
+
+  vdisk.req[h].hdr.type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+80109d46:	8b 17                	mov    (%edi),%edx
+80109d48:	c1 fa 02             	sar    $0x2,%edx
+80109d4b:	83 e2 01             	and    $0x1,%edx
+80109d4e:	8d 0c 1b             	lea    (%ebx,%ebx,1),%ecx
+80109d51:	8d 04 19             	lea    (%ecx,%ebx,1),%eax
+80109d54:	8d 04 c5 00 10 34 80 	lea    -0x7fcbf000(,%eax,8),%eax
+80109d5b:	89 50 50             	mov    %edx,0x50(%eax)
+  vdisk.req[h].hdr.ioprio = 0;
+80109d5e:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+  vdisk.req[h].hdr.sector = b->blockno * (BSIZE/512);
+80109d65:	8b 57 08             	mov    0x8(%edi),%edx
+80109d68:	c1 e2 03             	shl    $0x3,%edx
+80109d6b:	89 50 58             	mov    %edx,0x58(%eax)
+  vdisk.req[h].hdr.sectorhi = 0;
+80109d6e:	c7 40 5c 00 00 00 00 	movl   $0x0,0x5c(%eax)
+  vdisk.req[h].status = 0xFF;
+80109d75:	c6 40 60 ff          	movb   $0xff,0x60(%eax)
+  vdisk.req[h].b = b;
+80109d79:	89 78 64             	mov    %edi,0x64(%eax)
+
+  desc[h].addr = V2P(&vdisk.req[h].hdr);
+80109d7c:	01 d9                	add    %ebx,%ecx
+80109d7e:	89 da                	mov    %ebx,%edx
+80109d80:	c1 e2 04             	shl    $0x4,%edx
+80109d83:	89 d0                	mov    %edx,%eax
+80109d85:	01 f0                	add    %esi,%eax
+80109d87:	8d 14 cd 50 10 34 00 	lea    0x341050(,%ecx,8),%edx
+80109d8e:	89 10                	mov    %edx,(%eax)
+  desc[h].addrhi = 0;
+80109d90:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  desc[h].len = sizeof(vdisk.req[h].hdr);
+80109d97:	c7 40 08 10 00 00 00 	movl   $0x10,0x8(%eax)
+  desc[h].flags = VRING_DESC_F_NEXT;
+80109d9e:	66 c7 40 0c 01 00    	movw   $0x1,0xc(%eax)
+  desc[h].next = d;
+80109da4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80109da7:	66 89 48 0e          	mov    %cx,0xe(%eax)
+
+  desc[d].addr = V2P(b->data);
+80109dab:	89 c8                	mov    %ecx,%eax
+80109dad:	c1 e0 04             	shl    $0x4,%eax
+80109db0:	01 f0                	add    %esi,%eax
+80109db2:	8b 4f 60             	mov    0x60(%edi),%ecx
+80109db5:	8d 91 00 00 00 80    	lea    -0x80000000(%ecx),%edx
+80109dbb:	89 10                	mov    %edx,(%eax)
+  desc[d].addrhi = 0;
+80109dbd:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  desc[d].len = BSIZE;
+80109dc4:	c7 40 08 00 10 00 00 	movl   $0x1000,0x8(%eax)
+  desc[d].flags = VRING_DESC_F_NEXT;
+80109dcb:	66 c7 40 0c 01 00    	movw   $0x1,0xc(%eax)
+  if(!(b->flags & B_DIRTY))
+80109dd1:	f6 07 04             	testb  $0x4,(%edi)
+80109dd4:	75 06                	jne    80109ddc <virtioqueue+0xbe>
+    desc[d].flags |= VRING_DESC_F_WRITE;
+80109dd6:	66 c7 40 0c 03 00    	movw   $0x3,0xc(%eax)
+  desc[d].next = s;
+80109ddc:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80109ddf:	66 89 78 0e          	mov    %di,0xe(%eax)
+
+  desc[s].addr = V2P(&vdisk.req[h].status);
+80109de3:	8d 14 5b             	lea    (%ebx,%ebx,2),%edx
+80109de6:	89 f8                	mov    %edi,%eax
+80109de8:	c1 e0 04             	shl    $0x4,%eax
+80109deb:	01 c6                	add    %eax,%esi
+80109ded:	8d 04 d5 60 10 34 00 	lea    0x341060(,%edx,8),%eax
+80109df4:	89 06                	mov    %eax,(%esi)
+  desc[s].addrhi = 0;
+80109df6:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+  desc[s].len = 1;
+80109dfd:	c7 46 08 01 00 00 00 	movl   $0x1,0x8(%esi)
+  desc[s].flags = VRING_DESC_F_WRITE;
+80109e04:	66 c7 46 0c 02 00    	movw   $0x2,0xc(%esi)
+  desc[s].next = 0;
+80109e0a:	66 c7 46 0e 00 00    	movw   $0x0,0xe(%esi)
+
+  vdisk.avail->ring[vdisk.avail->idx % vdisk.qsize] = h;
+80109e10:	8b 0d 40 10 34 80    	mov    0x80341040,%ecx
+80109e16:	0f b7 41 02          	movzwl 0x2(%ecx),%eax
+80109e1a:	99                   	cltd
+80109e1b:	f7 3d 38 10 34 80    	idivl  0x80341038
+80109e21:	66 89 5c 51 04       	mov    %bx,0x4(%ecx,%edx,2)
+  __sync_synchronize();
+80109e26:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  vdisk.avail->idx++;
+80109e2b:	8b 15 40 10 34 80    	mov    0x80341040,%edx
+80109e31:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+80109e35:	83 c0 01             	add    $0x1,%eax
+80109e38:	66 89 42 02          	mov    %ax,0x2(%edx)
+}
+80109e3c:	83 c4 1c             	add    $0x1c,%esp
+80109e3f:	5b                   	pop    %ebx
+80109e40:	5e                   	pop    %esi
+80109e41:	5f                   	pop    %edi
+80109e42:	5d                   	pop    %ebp
+80109e43:	c3                   	ret
+
+80109e44 <virtioinit>:
+{
+80109e44:	55                   	push   %ebp
+80109e45:	89 e5                	mov    %esp,%ebp
+80109e47:	53                   	push   %ebx
+80109e48:	83 ec 1c             	sub    $0x1c,%esp
+  initlock(&vdisk.lock, "virtio");
+80109e4b:	68 ac be 10 80       	push   $0x8010beac
+80109e50:	68 00 10 34 80       	push   $0x80341000
+80109e55:	e8 2d da ff ff       	call   80107887 <initlock>
+  if(pcifind(PCI_ID, 0xFFFFFFFF, VIRTIO_BLK<<16 | VIRTIO_VENDOR, &bdf) < 0)
+80109e5a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109e5d:	50                   	push   %eax
+80109e5e:	68 f4 1a 01 10       	push   $0x10011af4
+80109e63:	6a ff                	push   $0xffffffff
+80109e65:	6a 00                	push   $0x0
+80109e67:	e8 61 ae ff ff       	call   80104ccd <pcifind>
+80109e6c:	83 c4 20             	add    $0x20,%esp
+80109e6f:	85 c0                	test   %eax,%eax
+80109e71:	78 16                	js     80109e89 <virtioinit+0x45>
+  bar = pciread(bdf, PCI_BAR(0));
+80109e73:	83 ec 08             	sub    $0x8,%esp
+80109e76:	6a 10                	push   $0x10
+80109e78:	ff 75 f4             	push   -0xc(%ebp)
+80109e7b:	e8 fc ad ff ff       	call   80104c7c <pciread>
+80109e80:	89 c3                	mov    %eax,%ebx
+  if((bar & PCI_BAR_IO) == 0)
+80109e82:	83 c4 10             	add    $0x10,%esp
+80109e85:	a8 01                	test   $0x1,%al
+80109e87:	75 05                	jne    80109e8e <virtioinit+0x4a>
+}
+80109e89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109e8c:	c9                   	leave
+80109e8d:	c3                   	ret
+           pciread(bdf, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+80109e8e:	83 ec 08             	sub    $0x8,%esp
+80109e91:	6a 04                	push   $0x4
+80109e93:	ff 75 f4             	push   -0xc(%ebp)
+80109e96:	e8 e1 ad ff ff       	call   80104c7c <pciread>
+  pciwrite(bdf, PCI_COMMAND,
+80109e9b:	83 c4 0c             	add    $0xc,%esp
+80109e9e:	83 c8 05             	or     $0x5,%eax
+80109ea1:	50                   	push   %eax
+80109ea2:	6a 04                	push   $0x4
+80109ea4:	ff 75 f4             	push   -0xc(%ebp)
+80109ea7:	e8 f7 ad ff ff       	call   80104ca3 <pciwrite>
+  vdisk.iobase = bar & 0xFFFC;
+80109eac:	89 d9                	mov    %ebx,%ecx
+80109eae:	83 e1 fc             	and    $0xfffffffc,%ecx
+80109eb1:	66 89 0d 34 10 34 80 	mov    %cx,0x80341034
+  outb(vdisk.iobase + VIO_STATUS, 0);  // reset
+80109eb8:	8d 51 12             	lea    0x12(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+80109ec0:	ee                   	out    %al,(%dx)
+80109ec1:	b8 01 00 00 00       	mov    $0x1,%eax
+80109ec6:	ee                   	out    %al,(%dx)
+80109ec7:	b8 03 00 00 00       	mov    $0x3,%eax
+80109ecc:	ee                   	out    %al,(%dx)
+  outl(vdisk.iobase + VIO_GUESTFEAT, 0);  // no optional features
+80109ecd:	8d 51 04             	lea    0x4(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+80109ed5:	ef                   	out    %eax,(%dx)
+  outw(vdisk.iobase + VIO_QSEL, 0);
+80109ed6:	8d 51 0e             	lea    0xe(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109ed9:	66 ef                	out    %ax,(%dx)
+  n = inw(vdisk.iobase + VIO_QSIZE);
+80109edb:	8d 51 0c             	lea    0xc(%ecx),%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109ede:	66 ed                	in     (%dx),%ax
+80109ee0:	0f b7 d8             	movzwl %ax,%ebx
+  if(n < 3 || n > VQMAX){
+80109ee3:	8d 43 fd             	lea    -0x3(%ebx),%eax
+80109ee6:	83 c4 10             	add    $0x10,%esp
+80109ee9:	3d fd 00 00 00       	cmp    $0xfd,%eax
+80109eee:	77 55                	ja     80109f45 <virtioinit+0x101>
+  vdisk.qsize = n;
+80109ef0:	89 1d 38 10 34 80    	mov    %ebx,0x80341038
+  memset(vqmem, 0, sizeof(vqmem));
+80109ef6:	83 ec 04             	sub    $0x4,%esp
+80109ef9:	68 00 30 00 00       	push   $0x3000
+80109efe:	6a 00                	push   $0x0
+80109f00:	68 00 30 34 80       	push   $0x80343000
+80109f05:	e8 6d db ff ff       	call   80107a77 <memset>
+  vdisk.desc = (struct vring_desc*)vqmem;
+80109f0a:	c7 05 3c 10 34 80 00 	movl   $0x80343000,0x8034103c
+80109f11:	30 34 80 
+  vdisk.avail = (struct vring_avail*)(vqmem + 16*n);
+80109f14:	89 d8                	mov    %ebx,%eax
+80109f16:	c1 e0 04             	shl    $0x4,%eax
+80109f19:	8d 90 00 30 34 80    	lea    -0x7fcbd000(%eax),%edx
+80109f1f:	89 15 40 10 34 80    	mov    %edx,0x80341040
+  vdisk.used = (struct vring_used*)(vqmem + PGROUNDUP(16*n + 6 + 2*n));
+80109f25:	8d 84 58 05 10 00 00 	lea    0x1005(%eax,%ebx,2),%eax
+80109f2c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80109f31:	05 00 30 34 80       	add    $0x80343000,%eax
+80109f36:	a3 44 10 34 80       	mov    %eax,0x80341044
+  for(i = 0; i < n; i++)
+80109f3b:	83 c4 10             	add    $0x10,%esp
+80109f3e:	ba 00 00 00 00       	mov    $0x0,%edx
+80109f43:	eb 44                	jmp    80109f89 <virtioinit+0x145>
+    cprintf("virtio: unusable queue size %d\n", n);
+80109f45:	83 ec 08             	sub    $0x8,%esp
+80109f48:	53                   	push   %ebx
+80109f49:	68 10 bf 10 80       	push   $0x8010bf10
+80109f4e:	e8 94 6e ff ff       	call   80100de7 <cprintf>
+    outb(vdisk.iobase + VIO_STATUS, VIO_S_FAILED);
+80109f53:	0f b7 05 34 10 34 80 	movzwl 0x80341034,%eax
+80109f5a:	8d 50 12             	lea    0x12(%eax),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109f5d:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+80109f62:	ee                   	out    %al,(%dx)
+    vdisk.iobase = 0;
+80109f63:	66 c7 05 34 10 34 80 	movw   $0x0,0x80341034
+80109f6a:	00 00 
+    return;
+80109f6c:	83 c4 10             	add    $0x10,%esp
+80109f6f:	e9 15 ff ff ff       	jmp    80109e89 <virtioinit+0x45>
+    vdisk.desc[i].next = i + 1;
+80109f74:	89 d1                	mov    %edx,%ecx
+80109f76:	c1 e1 04             	shl    $0x4,%ecx
+80109f79:	03 0d 3c 10 34 80    	add    0x8034103c,%ecx
+80109f7f:	8d 42 01             	lea    0x1(%edx),%eax
+80109f82:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+  for(i = 0; i < n; i++)
+80109f86:	83 c2 01             	add    $0x1,%edx
+80109f89:	39 da                	cmp    %ebx,%edx
+80109f8b:	7c e7                	jl     80109f74 <virtioinit+0x130>
+  vdisk.freehead = 0;
+80109f8d:	66 c7 05 4a 10 34 80 	movw   $0x0,0x8034104a
+80109f94:	00 00 
+  vdisk.nfree = n;
+80109f96:	89 1d 4c 10 34 80    	mov    %ebx,0x8034104c
+  outl(vdisk.iobase + VIO_QADDR, V2P(vqmem) >> PGSHIFT);
+80109f9c:	b8 00 30 34 00       	mov    $0x343000,%eax
+80109fa1:	c1 e8 0c             	shr    $0xc,%eax
+80109fa4:	0f b7 1d 34 10 34 80 	movzwl 0x80341034,%ebx
+80109fab:	8d 53 08             	lea    0x8(%ebx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109fae:	ef                   	out    %eax,(%dx)
+  ioapicroute(pciread(bdf, PCI_INTR) & 0xFF, IRQ_VIRTIO, ncpu - 1);
+80109faf:	a1 84 ad 33 80       	mov    0x8033ad84,%eax
+80109fb4:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80109fb7:	83 ec 08             	sub    $0x8,%esp
+80109fba:	6a 3c                	push   $0x3c
+80109fbc:	ff 75 f4             	push   -0xc(%ebp)
+80109fbf:	e8 b8 ac ff ff       	call   80104c7c <pciread>
+80109fc4:	83 c4 0c             	add    $0xc,%esp
+80109fc7:	53                   	push   %ebx
+80109fc8:	6a 0b                	push   $0xb
+80109fca:	0f b6 c0             	movzbl %al,%eax
+80109fcd:	50                   	push   %eax
+80109fce:	e8 4a 9b ff ff       	call   80103b1d <ioapicroute>
+  outb(vdisk.iobase + VIO_STATUS, VIO_S_ACK | VIO_S_DRIVER | VIO_S_DRIVER_OK);
+80109fd3:	0f b7 05 34 10 34 80 	movzwl 0x80341034,%eax
+80109fda:	8d 50 12             	lea    0x12(%eax),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109fdd:	b8 07 00 00 00       	mov    $0x7,%eax
+80109fe2:	ee                   	out    %al,(%dx)
+80109fe3:	83 c4 10             	add    $0x10,%esp
+80109fe6:	e9 9e fe ff ff       	jmp    80109e89 <virtioinit+0x45>
+
+80109feb <virtiorw>:
+// set, mark them B_ASYNC and return once they are queued, like
+// idereadahead(). Returns -1 if the bufs are not for a
+// virtio disk. A batch must all be for the same device.
+int
+virtiorw(struct buf **bufs, int n, int async)
+{
+80109feb:	55                   	push   %ebp
+80109fec:	89 e5                	mov    %esp,%ebp
+80109fee:	57                   	push   %edi
+80109fef:	56                   	push   %esi
+80109ff0:	53                   	push   %ebx
+80109ff1:	83 ec 0c             	sub    $0xc,%esp
+80109ff4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i;
+
+  if(vdisk.iobase == 0 || bufs[0]->dev != VIRTIO_DEV)
+80109ff7:	66 83 3d 34 10 34 80 	cmpw   $0x0,0x80341034
+80109ffe:	00 
+80109fff:	0f 84 3d 01 00 00    	je     8010a142 <virtiorw+0x157>
+8010a005:	8b 07                	mov    (%edi),%eax
+8010a007:	83 78 04 01          	cmpl   $0x1,0x4(%eax)
+8010a00b:	0f 85 38 01 00 00    	jne    8010a149 <virtiorw+0x15e>
+    return -1;
+  for(i = 1; i < n; i++)
+8010a011:	b8 01 00 00 00       	mov    $0x1,%eax
+8010a016:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010a019:	39 c8                	cmp    %ecx,%eax
+8010a01b:	7d 1b                	jge    8010a038 <virtiorw+0x4d>
+    if(bufs[i]->dev != VIRTIO_DEV)
+8010a01d:	8b 14 87             	mov    (%edi,%eax,4),%edx
+8010a020:	83 7a 04 01          	cmpl   $0x1,0x4(%edx)
+8010a024:	75 05                	jne    8010a02b <virtiorw+0x40>
+  for(i = 1; i < n; i++)
+8010a026:	83 c0 01             	add    $0x1,%eax
+8010a029:	eb ee                	jmp    8010a019 <virtiorw+0x2e>
+      panic("virtiorw: mixed devices");
+8010a02b:	83 ec 0c             	sub    $0xc,%esp
+8010a02e:	68 b3 be 10 80       	push   $0x8010beb3
+8010a033:	e8 ee 6a ff ff       	call   80100b26 <panic>
+
+  acquire(&vdisk.lock);
+8010a038:	83 ec 0c             	sub    $0xc,%esp
+8010a03b:	68 00 10 34 80       	push   $0x80341000
+8010a040:	e8 86 d9 ff ff       	call   801079cb <acquire>
+  for(i = 0; i < n; i++){
+8010a045:	83 c4 10             	add    $0x10,%esp
+8010a048:	be 00 00 00 00       	mov    $0x0,%esi
+8010a04d:	eb 55                	jmp    8010a0a4 <virtiorw+0xb9>
+    if(!holdingsleep(&bufs[i]->lock))
+      panic("virtiorw: buf not locked");
+8010a04f:	83 ec 0c             	sub    $0xc,%esp
+8010a052:	68 cb be 10 80       	push   $0x8010becb
+8010a057:	e8 ca 6a ff ff       	call   80100b26 <panic>
+    if((bufs[i]->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("virtiorw: nothing to do");
+    while(vdisk.nfree < 3){
+      // Let the device see what is queued so far.
+      outw(vdisk.iobase + VIO_QNOTIFY, 0);
+8010a05c:	0f b7 05 34 10 34 80 	movzwl 0x80341034,%eax
+8010a063:	8d 50 10             	lea    0x10(%eax),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a066:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a06b:	66 ef                	out    %ax,(%dx)
+      sleep(&vdisk.nfree, &vdisk.lock);
+8010a06d:	83 ec 08             	sub    $0x8,%esp
+8010a070:	68 00 10 34 80       	push   $0x80341000
+8010a075:	68 4c 10 34 80       	push   $0x8034104c
+8010a07a:	e8 de cb ff ff       	call   80106c5d <sleep>
+8010a07f:	83 c4 10             	add    $0x10,%esp
+    while(vdisk.nfree < 3){
+8010a082:	83 3d 4c 10 34 80 02 	cmpl   $0x2,0x8034104c
+8010a089:	7e d1                	jle    8010a05c <virtiorw+0x71>
+    }
+    if(async)
+8010a08b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+8010a08f:	74 09                	je     8010a09a <virtiorw+0xaf>
+      bufs[i]->flags |= B_ASYNC;
+8010a091:	8b 13                	mov    (%ebx),%edx
+8010a093:	8b 02                	mov    (%edx),%eax
+8010a095:	83 c8 08             	or     $0x8,%eax
+8010a098:	89 02                	mov    %eax,(%edx)
+    virtioqueue(bufs[i]);
+8010a09a:	8b 03                	mov    (%ebx),%eax
+8010a09c:	e8 7d fc ff ff       	call   80109d1e <virtioqueue>
+  for(i = 0; i < n; i++){
+8010a0a1:	83 c6 01             	add    $0x1,%esi
+8010a0a4:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010a0a7:	7d 31                	jge    8010a0da <virtiorw+0xef>
+    if(!holdingsleep(&bufs[i]->lock))
+8010a0a9:	8d 1c b7             	lea    (%edi,%esi,4),%ebx
+8010a0ac:	83 ec 0c             	sub    $0xc,%esp
+8010a0af:	8b 03                	mov    (%ebx),%eax
+8010a0b1:	83 c0 0c             	add    $0xc,%eax
+8010a0b4:	50                   	push   %eax
+8010a0b5:	e8 a6 d7 ff ff       	call   80107860 <holdingsleep>
+8010a0ba:	83 c4 10             	add    $0x10,%esp
+8010a0bd:	85 c0                	test   %eax,%eax
+8010a0bf:	74 8e                	je     8010a04f <virtiorw+0x64>
+    if((bufs[i]->flags & (B_VALID|B_DIRTY)) == B_VALID)
+8010a0c1:	8b 03                	mov    (%ebx),%eax
+8010a0c3:	8b 00                	mov    (%eax),%eax
+8010a0c5:	83 e0 06             	and    $0x6,%eax
+8010a0c8:	83 f8 02             	cmp    $0x2,%eax
+8010a0cb:	75 b5                	jne    8010a082 <virtiorw+0x97>
+      panic("virtiorw: nothing to do");
+8010a0cd:	83 ec 0c             	sub    $0xc,%esp
+8010a0d0:	68 e4 be 10 80       	push   $0x8010bee4
+8010a0d5:	e8 4c 6a ff ff       	call   80100b26 <panic>
+  }
+  __sync_synchronize();
+8010a0da:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  outw(vdisk.iobase + VIO_QNOTIFY, 0);
+8010a0df:	0f b7 05 34 10 34 80 	movzwl 0x80341034,%eax
+8010a0e6:	8d 50 10             	lea    0x10(%eax),%edx
+8010a0e9:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a0ee:	66 ef                	out    %ax,(%dx)
+
+  if(!async)
+8010a0f0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+8010a0f4:	74 44                	je     8010a13a <virtiorw+0x14f>
+    for(i = 0; i < n; i++)
+      while((bufs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+        sleep(bufs[i], &vdisk.lock);
+  release(&vdisk.lock);
+8010a0f6:	83 ec 0c             	sub    $0xc,%esp
+8010a0f9:	68 00 10 34 80       	push   $0x80341000
+8010a0fe:	e8 2d d9 ff ff       	call   80107a30 <release>
+  return 0;
+8010a103:	83 c4 10             	add    $0x10,%esp
+8010a106:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a10b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a10e:	5b                   	pop    %ebx
+8010a10f:	5e                   	pop    %esi
+8010a110:	5f                   	pop    %edi
+8010a111:	5d                   	pop    %ebp
+8010a112:	c3                   	ret
+        sleep(bufs[i], &vdisk.lock);
+8010a113:	83 ec 08             	sub    $0x8,%esp
+8010a116:	68 00 10 34 80       	push   $0x80341000
+8010a11b:	52                   	push   %edx
+8010a11c:	e8 3c cb ff ff       	call   80106c5d <sleep>
+8010a121:	83 c4 10             	add    $0x10,%esp
+      while((bufs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+8010a124:	8b 14 9f             	mov    (%edi,%ebx,4),%edx
+8010a127:	8b 02                	mov    (%edx),%eax
+8010a129:	83 e0 06             	and    $0x6,%eax
+8010a12c:	83 f8 02             	cmp    $0x2,%eax
+8010a12f:	75 e2                	jne    8010a113 <virtiorw+0x128>
+    for(i = 0; i < n; i++)
+8010a131:	83 c3 01             	add    $0x1,%ebx
+8010a134:	39 f3                	cmp    %esi,%ebx
+8010a136:	7c ec                	jl     8010a124 <virtiorw+0x139>
+8010a138:	eb bc                	jmp    8010a0f6 <virtiorw+0x10b>
+8010a13a:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010a13d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010a140:	eb f2                	jmp    8010a134 <virtiorw+0x149>
+    return -1;
+8010a142:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a147:	eb c2                	jmp    8010a10b <virtiorw+0x120>
+8010a149:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a14e:	eb bb                	jmp    8010a10b <virtiorw+0x120>
+
+8010a150 <virtiowait>:
+
+// Wait for a read-ahead into b to complete, like idewaitahead().
+// Returns -1 if b is not for a virtio disk.
+int
+virtiowait(struct buf *b)
+{
+8010a150:	55                   	push   %ebp
+8010a151:	89 e5                	mov    %esp,%ebp
+8010a153:	56                   	push   %esi
+8010a154:	53                   	push   %ebx
+8010a155:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(vdisk.iobase == 0 || b->dev != VIRTIO_DEV)
+8010a158:	66 83 3d 34 10 34 80 	cmpw   $0x0,0x80341034
+8010a15f:	00 
+8010a160:	74 49                	je     8010a1ab <virtiowait+0x5b>
+8010a162:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+8010a166:	75 4a                	jne    8010a1b2 <virtiowait+0x62>
+    return -1;
+  acquire(&vdisk.lock);
+8010a168:	83 ec 0c             	sub    $0xc,%esp
+8010a16b:	68 00 10 34 80       	push   $0x80341000
+8010a170:	e8 56 d8 ff ff       	call   801079cb <acquire>
+  while(b->flags & B_ASYNC)
+8010a175:	83 c4 10             	add    $0x10,%esp
+8010a178:	eb 11                	jmp    8010a18b <virtiowait+0x3b>
+    sleep(b, &vdisk.lock);
+8010a17a:	83 ec 08             	sub    $0x8,%esp
+8010a17d:	68 00 10 34 80       	push   $0x80341000
+8010a182:	56                   	push   %esi
+8010a183:	e8 d5 ca ff ff       	call   80106c5d <sleep>
+8010a188:	83 c4 10             	add    $0x10,%esp
+  while(b->flags & B_ASYNC)
+8010a18b:	8b 1e                	mov    (%esi),%ebx
+8010a18d:	83 e3 08             	and    $0x8,%ebx
+8010a190:	75 e8                	jne    8010a17a <virtiowait+0x2a>
+  release(&vdisk.lock);
+8010a192:	83 ec 0c             	sub    $0xc,%esp
+8010a195:	68 00 10 34 80       	push   $0x80341000
+8010a19a:	e8 91 d8 ff ff       	call   80107a30 <release>
+  return 0;
+8010a19f:	83 c4 10             	add    $0x10,%esp
+}
+8010a1a2:	89 d8                	mov    %ebx,%eax
+8010a1a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a1a7:	5b                   	pop    %ebx
+8010a1a8:	5e                   	pop    %esi
+8010a1a9:	5d                   	pop    %ebp
+8010a1aa:	c3                   	ret
+    return -1;
+8010a1ab:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010a1b0:	eb f0                	jmp    8010a1a2 <virtiowait+0x52>
+8010a1b2:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010a1b7:	eb e9                	jmp    8010a1a2 <virtiowait+0x52>
+
+8010a1b9 <virtiointr>:
+virtiointr(void)
+{
+  struct buf *b;
+  int h, d;
+
+  if(vdisk.iobase == 0)
+8010a1b9:	66 83 3d 34 10 34 80 	cmpw   $0x0,0x80341034
+8010a1c0:	00 
+8010a1c1:	75 01                	jne    8010a1c4 <virtiointr+0xb>
+8010a1c3:	c3                   	ret
+{
+8010a1c4:	55                   	push   %ebp
+8010a1c5:	89 e5                	mov    %esp,%ebp
+8010a1c7:	56                   	push   %esi
+8010a1c8:	53                   	push   %ebx
+    return;
+
+  acquire(&vdisk.lock);
+8010a1c9:	83 ec 0c             	sub    $0xc,%esp
+8010a1cc:	68 00 10 34 80       	push   $0x80341000
+8010a1d1:	e8 f5 d7 ff ff       	call   801079cb <acquire>
+  inb(vdisk.iobase + VIO_ISR);  // acknowledge
+8010a1d6:	0f b7 05 34 10 34 80 	movzwl 0x80341034,%eax
+8010a1dd:	8d 50 13             	lea    0x13(%eax),%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010a1e0:	ec                   	in     (%dx),%al
+  return data;
+8010a1e1:	83 c4 10             	add    $0x10,%esp
+
+  while(vdisk.usedidx != *(volatile ushort*)&vdisk.used->idx){
+8010a1e4:	a1 44 10 34 80       	mov    0x80341044,%eax
+8010a1e9:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+8010a1ed:	66 39 05 48 10 34 80 	cmp    %ax,0x80341048
+8010a1f4:	0f 84 a4 00 00 00    	je     8010a29e <virtiointr+0xe5>
+    __sync_synchronize();
+8010a1fa:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    h = vdisk.used->ring[vdisk.usedidx % vdisk.qsize].id;
+8010a1ff:	0f b7 05 48 10 34 80 	movzwl 0x80341048,%eax
+8010a206:	99                   	cltd
+8010a207:	f7 3d 38 10 34 80    	idivl  0x80341038
+8010a20d:	a1 44 10 34 80       	mov    0x80341044,%eax
+8010a212:	8b 5c d0 04          	mov    0x4(%eax,%edx,8),%ebx
+    b = vdisk.req[h].b;
+8010a216:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+8010a219:	01 da                	add    %ebx,%edx
+8010a21b:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+8010a222:	8b 90 64 10 34 80    	mov    -0x7fcbef9c(%eax),%edx
+8010a228:	05 00 10 34 80       	add    $0x80341000,%eax
+    if(vdisk.req[h].status != 0)
+8010a22d:	80 78 60 00          	cmpb   $0x0,0x60(%eax)
+8010a231:	75 5e                	jne    8010a291 <virtiointr+0xd8>
+      panic("virtio: I/O error");
+
+    // Wake process waiting for this buf.
+    b->flags |= B_VALID;
+8010a233:	8b 02                	mov    (%edx),%eax
+8010a235:	89 c1                	mov    %eax,%ecx
+8010a237:	83 c9 02             	or     $0x2,%ecx
+8010a23a:	89 0a                	mov    %ecx,(%edx)
+    b->flags &= ~(B_DIRTY|B_ASYNC);
+8010a23c:	83 e0 f3             	and    $0xfffffff3,%eax
+8010a23f:	83 c8 02             	or     $0x2,%eax
+8010a242:	89 02                	mov    %eax,(%edx)
+    wakeup(b);
+8010a244:	83 ec 0c             	sub    $0xc,%esp
+8010a247:	52                   	push   %edx
+8010a248:	e8 fc bf ff ff       	call   80106249 <wakeup>
+
+    d = vdisk.desc[h].next;
+8010a24d:	a1 3c 10 34 80       	mov    0x8034103c,%eax
+8010a252:	89 da                	mov    %ebx,%edx
+8010a254:	c1 e2 04             	shl    $0x4,%edx
+8010a257:	0f b7 74 10 0e       	movzwl 0xe(%eax,%edx,1),%esi
+    descfree(vdisk.desc[d].next);
+8010a25c:	89 f2                	mov    %esi,%edx
+8010a25e:	c1 e2 04             	shl    $0x4,%edx
+8010a261:	0f b7 44 10 0e       	movzwl 0xe(%eax,%edx,1),%eax
+8010a266:	e8 89 fa ff ff       	call   80109cf4 <descfree>
+    descfree(d);
+8010a26b:	89 f0                	mov    %esi,%eax
+8010a26d:	e8 82 fa ff ff       	call   80109cf4 <descfree>
+    descfree(h);
+8010a272:	89 d8                	mov    %ebx,%eax
+8010a274:	e8 7b fa ff ff       	call   80109cf4 <descfree>
+    vdisk.usedidx++;
+8010a279:	0f b7 05 48 10 34 80 	movzwl 0x80341048,%eax
+8010a280:	83 c0 01             	add    $0x1,%eax
+8010a283:	66 a3 48 10 34 80    	mov    %ax,0x80341048
+8010a289:	83 c4 10             	add    $0x10,%esp
+8010a28c:	e9 53 ff ff ff       	jmp    8010a1e4 <virtiointr+0x2b>
+      panic("virtio: I/O error");
+8010a291:	83 ec 0c             	sub    $0xc,%esp
+8010a294:	68 fc be 10 80       	push   $0x8010befc
+8010a299:	e8 88 68 ff ff       	call   80100b26 <panic>
+  }
+  wakeup(&vdisk.nfree);
+8010a29e:	83 ec 0c             	sub    $0xc,%esp
+8010a2a1:	68 4c 10 34 80       	push   $0x8034104c
+8010a2a6:	e8 9e bf ff ff       	call   80106249 <wakeup>
+
+  release(&vdisk.lock);
+8010a2ab:	c7 04 24 00 10 34 80 	movl   $0x80341000,(%esp)
+8010a2b2:	e8 79 d7 ff ff       	call   80107a30 <release>
+8010a2b7:	83 c4 10             	add    $0x10,%esp
+}
+8010a2ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a2bd:	5b                   	pop    %ebx
+8010a2be:	5e                   	pop    %esi
+8010a2bf:	5d                   	pop    %ebp
+8010a2c0:	c3                   	ret
+
+8010a2c1 <walkpgdir>:
+// Return the address of the PTE in page table pgdir
+// that corresponds to virtual address va.  If alloc!=0,
+// create any required page table pages.
+static pte_t *
+walkpgdir(pde_t *pgdir, const void *va, int alloc)
+{
+8010a2c1:	55                   	push   %ebp
+8010a2c2:	89 e5                	mov    %esp,%ebp
+8010a2c4:	57                   	push   %edi
+8010a2c5:	56                   	push   %esi
+8010a2c6:	53                   	push   %ebx
+8010a2c7:	83 ec 0c             	sub    $0xc,%esp
+8010a2ca:	89 d3                	mov    %edx,%ebx
+  pde_t *pde;
+  pte_t *pgtab;
+
+  pde = &pgdir[PDX(va)];
+8010a2cc:	c1 ea 16             	shr    $0x16,%edx
+8010a2cf:	8d 3c 90             	lea    (%eax,%edx,4),%edi
+  if(*pde & PTE_P){
+8010a2d2:	8b 37                	mov    (%edi),%esi
+8010a2d4:	f7 c6 01 00 00 00    	test   $0x1,%esi
+8010a2da:	74 20                	je     8010a2fc <walkpgdir+0x3b>
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a2dc:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+8010a2e2:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+    // The permissions here are overly generous, but they can
+    // be further restricted by the permissions in the page table
+    // entries, if necessary.
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+  }
+  return &pgtab[PTX(va)];
+8010a2e8:	c1 eb 0c             	shr    $0xc,%ebx
+8010a2eb:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+8010a2f1:	8d 04 9e             	lea    (%esi,%ebx,4),%eax
+}
+8010a2f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a2f7:	5b                   	pop    %ebx
+8010a2f8:	5e                   	pop    %esi
+8010a2f9:	5f                   	pop    %edi
+8010a2fa:	5d                   	pop    %ebp
+8010a2fb:	c3                   	ret
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010a2fc:	85 c9                	test   %ecx,%ecx
+8010a2fe:	74 2b                	je     8010a32b <walkpgdir+0x6a>
+8010a300:	e8 8b 9c ff ff       	call   80103f90 <kalloc>
+8010a305:	89 c6                	mov    %eax,%esi
+8010a307:	85 c0                	test   %eax,%eax
+8010a309:	74 20                	je     8010a32b <walkpgdir+0x6a>
+    memset(pgtab, 0, PGSIZE);
+8010a30b:	83 ec 04             	sub    $0x4,%esp
+8010a30e:	68 00 10 00 00       	push   $0x1000
+8010a313:	6a 00                	push   $0x0
+8010a315:	50                   	push   %eax
+8010a316:	e8 5c d7 ff ff       	call   80107a77 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a31b:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+8010a321:	83 c8 07             	or     $0x7,%eax
+8010a324:	89 07                	mov    %eax,(%edi)
+8010a326:	83 c4 10             	add    $0x10,%esp
+8010a329:	eb bd                	jmp    8010a2e8 <walkpgdir+0x27>
+      return 0;
+8010a32b:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a330:	eb c2                	jmp    8010a2f4 <walkpgdir+0x33>
+
+8010a332 <mappages>:
+// Create PTEs for virtual addresses starting at va that refer to
+// physical addresses starting at pa. va and size might not
+// be page-aligned.
+static int
+mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
+{
+8010a332:	55                   	push   %ebp
+8010a333:	89 e5                	mov    %esp,%ebp
+8010a335:	57                   	push   %edi
+8010a336:	56                   	push   %esi
+8010a337:	53                   	push   %ebx
+8010a338:	83 ec 1c             	sub    $0x1c,%esp
+8010a33b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a33e:	8b 75 08             	mov    0x8(%ebp),%esi
+  char *a, *last;
+  pte_t *pte;
+
+  a = (char*)PGROUNDDOWN((uint)va);
+8010a341:	89 d3                	mov    %edx,%ebx
+8010a343:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010a349:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+8010a34d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a352:	89 c7                	mov    %eax,%edi
+  for(;;){
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010a354:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010a359:	89 da                	mov    %ebx,%edx
+8010a35b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a35e:	e8 5e ff ff ff       	call   8010a2c1 <walkpgdir>
+8010a363:	85 c0                	test   %eax,%eax
+8010a365:	74 2e                	je     8010a395 <mappages+0x63>
+      return -1;
+    if(*pte & PTE_P)
+8010a367:	f6 00 01             	testb  $0x1,(%eax)
+8010a36a:	75 1c                	jne    8010a388 <mappages+0x56>
+      panic("remap");
+    *pte = pa | perm | PTE_P;
+8010a36c:	89 f2                	mov    %esi,%edx
+8010a36e:	0b 55 0c             	or     0xc(%ebp),%edx
+8010a371:	83 ca 01             	or     $0x1,%edx
+8010a374:	89 10                	mov    %edx,(%eax)
+    if(a == last)
+8010a376:	39 fb                	cmp    %edi,%ebx
+8010a378:	74 28                	je     8010a3a2 <mappages+0x70>
+      break;
+    a += PGSIZE;
+8010a37a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    pa += PGSIZE;
+8010a380:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010a386:	eb cc                	jmp    8010a354 <mappages+0x22>
+      panic("remap");
+8010a388:	83 ec 0c             	sub    $0xc,%esp
+8010a38b:	68 30 bf 10 80       	push   $0x8010bf30
+8010a390:	e8 91 67 ff ff       	call   80100b26 <panic>
+      return -1;
+8010a395:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return 0;
+}
+8010a39a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a39d:	5b                   	pop    %ebx
+8010a39e:	5e                   	pop    %esi
+8010a39f:	5f                   	pop    %edi
+8010a3a0:	5d                   	pop    %ebp
+8010a3a1:	c3                   	ret
+  return 0;
+8010a3a2:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a3a7:	eb f1                	jmp    8010a39a <mappages+0x68>
+
+8010a3a9 <loadpage>:
+
+// Fill mem with the part of p's executable that belongs at
+// user page va, if any. May sleep.
+static int
+loadpage(struct proc *p, char *mem, uint va)
+{
+8010a3a9:	55                   	push   %ebp
+8010a3aa:	89 e5                	mov    %esp,%ebp
+8010a3ac:	57                   	push   %edi
+8010a3ad:	56                   	push   %esi
+8010a3ae:	53                   	push   %ebx
+8010a3af:	83 ec 1c             	sub    $0x1c,%esp
+8010a3b2:	89 c6                	mov    %eax,%esi
+8010a3b4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010a3b7:	89 cf                	mov    %ecx,%edi
+  struct seg *s;
+  uint n;
+
+  for(s = p->seg; s < &p->seg[p->nseg]; s++){
+8010a3b9:	8d 98 80 00 00 00    	lea    0x80(%eax),%ebx
+8010a3bf:	eb 03                	jmp    8010a3c4 <loadpage+0x1b>
+8010a3c1:	83 c3 0c             	add    $0xc,%ebx
+8010a3c4:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+8010a3ca:	8d 04 40             	lea    (%eax,%eax,2),%eax
+8010a3cd:	8d 84 86 80 00 00 00 	lea    0x80(%esi,%eax,4),%eax
+8010a3d4:	39 c3                	cmp    %eax,%ebx
+8010a3d6:	0f 83 a6 00 00 00    	jae    8010a482 <loadpage+0xd9>
+    if(va < s->vaddr || va >= s->vaddr + s->filesz)
+8010a3dc:	8b 03                	mov    (%ebx),%eax
+8010a3de:	39 c7                	cmp    %eax,%edi
+8010a3e0:	72 df                	jb     8010a3c1 <loadpage+0x18>
+8010a3e2:	03 43 04             	add    0x4(%ebx),%eax
+8010a3e5:	39 c7                	cmp    %eax,%edi
+8010a3e7:	73 d8                	jae    8010a3c1 <loadpage+0x18>
+      continue;
+    n = s->vaddr + s->filesz - va;
+8010a3e9:	29 f8                	sub    %edi,%eax
+8010a3eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(n > PGSIZE)
+8010a3ee:	3d 00 10 00 00       	cmp    $0x1000,%eax
+8010a3f3:	76 07                	jbe    8010a3fc <loadpage+0x53>
+      n = PGSIZE;
+8010a3f5:	c7 45 e4 00 10 00 00 	movl   $0x1000,-0x1c(%ebp)
+    ilock(p->exe);
+8010a3fc:	83 ec 0c             	sub    $0xc,%esp
+8010a3ff:	ff 76 7c             	push   0x7c(%esi)
+8010a402:	e8 9d 89 ff ff       	call   80102da4 <ilock>
+    if(readi(p->exe, mem, s->off + (va - s->vaddr), n) != n){
+8010a407:	89 f8                	mov    %edi,%eax
+8010a409:	2b 03                	sub    (%ebx),%eax
+8010a40b:	ff 75 e4             	push   -0x1c(%ebp)
+8010a40e:	03 43 08             	add    0x8(%ebx),%eax
+8010a411:	50                   	push   %eax
+8010a412:	ff 75 e0             	push   -0x20(%ebp)
+8010a415:	ff 76 7c             	push   0x7c(%esi)
+8010a418:	e8 4b 8c ff ff       	call   80103068 <readi>
+8010a41d:	83 c4 20             	add    $0x20,%esp
+8010a420:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010a423:	39 c8                	cmp    %ecx,%eax
+8010a425:	75 2b                	jne    8010a452 <loadpage+0xa9>
+      iunlock(p->exe);
+      return -1;
+    }
+    // Programs mostly fault their way forward through a
+    // segment, so start reading the next page now.
+    if(va + n < s->vaddr + s->filesz)
+8010a427:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a42a:	01 f8                	add    %edi,%eax
+8010a42c:	8b 13                	mov    (%ebx),%edx
+8010a42e:	89 d1                	mov    %edx,%ecx
+8010a430:	03 4b 04             	add    0x4(%ebx),%ecx
+8010a433:	39 c8                	cmp    %ecx,%eax
+8010a435:	72 30                	jb     8010a467 <loadpage+0xbe>
+      readahead(p->exe, s->off + (va + n - s->vaddr), PGSIZE);
+    iunlock(p->exe);
+8010a437:	83 ec 0c             	sub    $0xc,%esp
+8010a43a:	ff 76 7c             	push   0x7c(%esi)
+8010a43d:	e8 37 8a ff ff       	call   80102e79 <iunlock>
+    break;
+8010a442:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+8010a445:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a44a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a44d:	5b                   	pop    %ebx
+8010a44e:	5e                   	pop    %esi
+8010a44f:	5f                   	pop    %edi
+8010a450:	5d                   	pop    %ebp
+8010a451:	c3                   	ret
+      iunlock(p->exe);
+8010a452:	83 ec 0c             	sub    $0xc,%esp
+8010a455:	ff 76 7c             	push   0x7c(%esi)
+8010a458:	e8 1c 8a ff ff       	call   80102e79 <iunlock>
+      return -1;
+8010a45d:	83 c4 10             	add    $0x10,%esp
+8010a460:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a465:	eb e3                	jmp    8010a44a <loadpage+0xa1>
+      readahead(p->exe, s->off + (va + n - s->vaddr), PGSIZE);
+8010a467:	29 d0                	sub    %edx,%eax
+8010a469:	83 ec 04             	sub    $0x4,%esp
+8010a46c:	68 00 10 00 00       	push   $0x1000
+8010a471:	03 43 08             	add    0x8(%ebx),%eax
+8010a474:	50                   	push   %eax
+8010a475:	ff 76 7c             	push   0x7c(%esi)
+8010a478:	e8 69 8b ff ff       	call   80102fe6 <readahead>
+8010a47d:	83 c4 10             	add    $0x10,%esp
+8010a480:	eb b5                	jmp    8010a437 <loadpage+0x8e>
+  return 0;
+8010a482:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a487:	eb c1                	jmp    8010a44a <loadpage+0xa1>
+
+8010a489 <cowpage>:
+{
+8010a489:	55                   	push   %ebp
+8010a48a:	89 e5                	mov    %esp,%ebp
+8010a48c:	57                   	push   %edi
+8010a48d:	56                   	push   %esi
+8010a48e:	53                   	push   %ebx
+8010a48f:	83 ec 28             	sub    $0x28,%esp
+8010a492:	89 c6                	mov    %eax,%esi
+8010a494:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pa = PTE_ADDR(*pte);
+8010a497:	8b 18                	mov    (%eax),%ebx
+8010a499:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(krefcount(P2V(pa)) > 1){
+8010a49f:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+8010a4a5:	53                   	push   %ebx
+8010a4a6:	e8 ae 98 ff ff       	call   80103d59 <krefcount>
+8010a4ab:	83 c4 10             	add    $0x10,%esp
+8010a4ae:	83 f8 01             	cmp    $0x1,%eax
+8010a4b1:	7f 1f                	jg     8010a4d2 <cowpage+0x49>
+  *pte = (*pte | PTE_W) & ~PTE_COW;
+8010a4b3:	8b 06                	mov    (%esi),%eax
+8010a4b5:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+8010a4ba:	83 c8 02             	or     $0x2,%eax
+8010a4bd:	89 06                	mov    %eax,(%esi)
+}
+
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+8010a4bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a4c2:	0f 01 38             	invlpg (%eax)
+  return 0;
+8010a4c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a4ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a4cd:	5b                   	pop    %ebx
+8010a4ce:	5e                   	pop    %esi
+8010a4cf:	5f                   	pop    %edi
+8010a4d0:	5d                   	pop    %ebp
+8010a4d1:	c3                   	ret
+    if((mem = kalloc()) == 0)
+8010a4d2:	e8 b9 9a ff ff       	call   80103f90 <kalloc>
+8010a4d7:	89 c7                	mov    %eax,%edi
+8010a4d9:	85 c0                	test   %eax,%eax
+8010a4db:	74 2d                	je     8010a50a <cowpage+0x81>
+    memmove(mem, P2V(pa), PGSIZE);
+8010a4dd:	83 ec 04             	sub    $0x4,%esp
+8010a4e0:	68 00 10 00 00       	push   $0x1000
+8010a4e5:	53                   	push   %ebx
+8010a4e6:	50                   	push   %eax
+8010a4e7:	e8 03 d6 ff ff       	call   80107aef <memmove>
+    *pte = V2P(mem) | PTE_FLAGS(*pte);
+8010a4ec:	81 c7 00 00 00 80    	add    $0x80000000,%edi
+8010a4f2:	8b 06                	mov    (%esi),%eax
+8010a4f4:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010a4f9:	09 c7                	or     %eax,%edi
+8010a4fb:	89 3e                	mov    %edi,(%esi)
+    kfree(P2V(pa));
+8010a4fd:	89 1c 24             	mov    %ebx,(%esp)
+8010a500:	e8 6c 98 ff ff       	call   80103d71 <kfree>
+8010a505:	83 c4 10             	add    $0x10,%esp
+8010a508:	eb a9                	jmp    8010a4b3 <cowpage+0x2a>
+      return -1;
+8010a50a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a50f:	eb b9                	jmp    8010a4ca <cowpage+0x41>
+
+8010a511 <seginit>:
+{
+8010a511:	55                   	push   %ebp
+8010a512:	89 e5                	mov    %esp,%ebp
+8010a514:	57                   	push   %edi
+8010a515:	56                   	push   %esi
+8010a516:	53                   	push   %ebx
+8010a517:	83 ec 1c             	sub    $0x1c,%esp
+  c = &cpus[cpuid()];
+8010a51a:	e8 1d b8 ff ff       	call   80105d3c <cpuid>
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a51f:	69 f8 b0 00 00 00    	imul   $0xb0,%eax,%edi
+8010a525:	66 c7 87 18 ae 33 80 	movw   $0xffff,-0x7fcc51e8(%edi)
+8010a52c:	ff ff 
+8010a52e:	66 c7 87 1a ae 33 80 	movw   $0x0,-0x7fcc51e6(%edi)
+8010a535:	00 00 
+8010a537:	c6 87 1c ae 33 80 00 	movb   $0x0,-0x7fcc51e4(%edi)
+8010a53e:	0f b6 8f 1d ae 33 80 	movzbl -0x7fcc51e3(%edi),%ecx
+8010a545:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010a548:	89 ce                	mov    %ecx,%esi
+8010a54a:	83 ce 0a             	or     $0xa,%esi
+8010a54d:	89 f2                	mov    %esi,%edx
+8010a54f:	88 97 1d ae 33 80    	mov    %dl,-0x7fcc51e3(%edi)
+8010a555:	83 c9 1a             	or     $0x1a,%ecx
+8010a558:	88 8f 1d ae 33 80    	mov    %cl,-0x7fcc51e3(%edi)
+8010a55e:	83 e1 9f             	and    $0xffffff9f,%ecx
+8010a561:	88 8f 1d ae 33 80    	mov    %cl,-0x7fcc51e3(%edi)
+8010a567:	83 c9 80             	or     $0xffffff80,%ecx
+8010a56a:	88 8f 1d ae 33 80    	mov    %cl,-0x7fcc51e3(%edi)
+8010a570:	0f b6 8f 1e ae 33 80 	movzbl -0x7fcc51e2(%edi),%ecx
+8010a577:	83 c9 0f             	or     $0xf,%ecx
+8010a57a:	88 8f 1e ae 33 80    	mov    %cl,-0x7fcc51e2(%edi)
+8010a580:	89 ce                	mov    %ecx,%esi
+8010a582:	83 e6 ef             	and    $0xffffffef,%esi
+8010a585:	89 f2                	mov    %esi,%edx
+8010a587:	88 97 1e ae 33 80    	mov    %dl,-0x7fcc51e2(%edi)
+8010a58d:	83 e1 cf             	and    $0xffffffcf,%ecx
+8010a590:	88 8f 1e ae 33 80    	mov    %cl,-0x7fcc51e2(%edi)
+8010a596:	89 ce                	mov    %ecx,%esi
+8010a598:	83 ce 40             	or     $0x40,%esi
+8010a59b:	89 f2                	mov    %esi,%edx
+8010a59d:	88 97 1e ae 33 80    	mov    %dl,-0x7fcc51e2(%edi)
+8010a5a3:	83 c9 c0             	or     $0xffffffc0,%ecx
+8010a5a6:	88 8f 1e ae 33 80    	mov    %cl,-0x7fcc51e2(%edi)
+8010a5ac:	c6 87 1f ae 33 80 00 	movb   $0x0,-0x7fcc51e1(%edi)
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010a5b3:	66 c7 87 20 ae 33 80 	movw   $0xffff,-0x7fcc51e0(%edi)
+8010a5ba:	ff ff 
+8010a5bc:	66 c7 87 22 ae 33 80 	movw   $0x0,-0x7fcc51de(%edi)
+8010a5c3:	00 00 
+8010a5c5:	c6 87 24 ae 33 80 00 	movb   $0x0,-0x7fcc51dc(%edi)
+8010a5cc:	0f b6 8f 25 ae 33 80 	movzbl -0x7fcc51db(%edi),%ecx
+8010a5d3:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010a5d6:	89 ce                	mov    %ecx,%esi
+8010a5d8:	83 ce 02             	or     $0x2,%esi
+8010a5db:	89 f2                	mov    %esi,%edx
+8010a5dd:	88 97 25 ae 33 80    	mov    %dl,-0x7fcc51db(%edi)
+8010a5e3:	83 c9 12             	or     $0x12,%ecx
+8010a5e6:	88 8f 25 ae 33 80    	mov    %cl,-0x7fcc51db(%edi)
+8010a5ec:	83 e1 9f             	and    $0xffffff9f,%ecx
+8010a5ef:	88 8f 25 ae 33 80    	mov    %cl,-0x7fcc51db(%edi)
+8010a5f5:	83 c9 80             	or     $0xffffff80,%ecx
+8010a5f8:	88 8f 25 ae 33 80    	mov    %cl,-0x7fcc51db(%edi)
+8010a5fe:	0f b6 8f 26 ae 33 80 	movzbl -0x7fcc51da(%edi),%ecx
+8010a605:	83 c9 0f             	or     $0xf,%ecx
+8010a608:	88 8f 26 ae 33 80    	mov    %cl,-0x7fcc51da(%edi)
+8010a60e:	89 ce                	mov    %ecx,%esi
+8010a610:	83 e6 ef             	and    $0xffffffef,%esi
+8010a613:	89 f2                	mov    %esi,%edx
+8010a615:	88 97 26 ae 33 80    	mov    %dl,-0x7fcc51da(%edi)
+8010a61b:	83 e1 cf             	and    $0xffffffcf,%ecx
+8010a61e:	88 8f 26 ae 33 80    	mov    %cl,-0x7fcc51da(%edi)
+8010a624:	89 ce                	mov    %ecx,%esi
+8010a626:	83 ce 40             	or     $0x40,%esi
+8010a629:	89 f2                	mov    %esi,%edx
+8010a62b:	88 97 26 ae 33 80    	mov    %dl,-0x7fcc51da(%edi)
+8010a631:	83 c9 c0             	or     $0xffffffc0,%ecx
+8010a634:	88 8f 26 ae 33 80    	mov    %cl,-0x7fcc51da(%edi)
+8010a63a:	c6 87 27 ae 33 80 00 	movb   $0x0,-0x7fcc51d9(%edi)
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010a641:	66 c7 87 28 ae 33 80 	movw   $0xffff,-0x7fcc51d8(%edi)
+8010a648:	ff ff 
+8010a64a:	66 c7 87 2a ae 33 80 	movw   $0x0,-0x7fcc51d6(%edi)
+8010a651:	00 00 
+8010a653:	c6 87 2c ae 33 80 00 	movb   $0x0,-0x7fcc51d4(%edi)
+8010a65a:	0f b6 9f 2d ae 33 80 	movzbl -0x7fcc51d3(%edi),%ebx
+8010a661:	83 e3 f0             	and    $0xfffffff0,%ebx
+8010a664:	89 de                	mov    %ebx,%esi
+8010a666:	83 ce 0a             	or     $0xa,%esi
+8010a669:	89 f2                	mov    %esi,%edx
+8010a66b:	88 97 2d ae 33 80    	mov    %dl,-0x7fcc51d3(%edi)
+8010a671:	89 de                	mov    %ebx,%esi
+8010a673:	83 ce 1a             	or     $0x1a,%esi
+8010a676:	89 f2                	mov    %esi,%edx
+8010a678:	88 97 2d ae 33 80    	mov    %dl,-0x7fcc51d3(%edi)
+8010a67e:	83 cb 7a             	or     $0x7a,%ebx
+8010a681:	88 9f 2d ae 33 80    	mov    %bl,-0x7fcc51d3(%edi)
+8010a687:	c6 87 2d ae 33 80 fa 	movb   $0xfa,-0x7fcc51d3(%edi)
+8010a68e:	0f b6 9f 2e ae 33 80 	movzbl -0x7fcc51d2(%edi),%ebx
+8010a695:	83 cb 0f             	or     $0xf,%ebx
+8010a698:	88 9f 2e ae 33 80    	mov    %bl,-0x7fcc51d2(%edi)
+8010a69e:	89 de                	mov    %ebx,%esi
+8010a6a0:	83 e6 ef             	and    $0xffffffef,%esi
+8010a6a3:	89 f2                	mov    %esi,%edx
+8010a6a5:	88 97 2e ae 33 80    	mov    %dl,-0x7fcc51d2(%edi)
+8010a6ab:	83 e3 cf             	and    $0xffffffcf,%ebx
+8010a6ae:	88 9f 2e ae 33 80    	mov    %bl,-0x7fcc51d2(%edi)
+8010a6b4:	89 de                	mov    %ebx,%esi
+8010a6b6:	83 ce 40             	or     $0x40,%esi
+8010a6b9:	89 f2                	mov    %esi,%edx
+8010a6bb:	88 97 2e ae 33 80    	mov    %dl,-0x7fcc51d2(%edi)
+8010a6c1:	83 cb c0             	or     $0xffffffc0,%ebx
+8010a6c4:	88 9f 2e ae 33 80    	mov    %bl,-0x7fcc51d2(%edi)
+8010a6ca:	c6 87 2f ae 33 80 00 	movb   $0x0,-0x7fcc51d1(%edi)
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a6d1:	66 c7 87 30 ae 33 80 	movw   $0xffff,-0x7fcc51d0(%edi)
+8010a6d8:	ff ff 
+8010a6da:	66 c7 87 32 ae 33 80 	movw   $0x0,-0x7fcc51ce(%edi)
+8010a6e1:	00 00 
+8010a6e3:	c6 87 34 ae 33 80 00 	movb   $0x0,-0x7fcc51cc(%edi)
+8010a6ea:	0f b6 9f 35 ae 33 80 	movzbl -0x7fcc51cb(%edi),%ebx
+8010a6f1:	83 e3 f0             	and    $0xfffffff0,%ebx
+8010a6f4:	89 de                	mov    %ebx,%esi
+8010a6f6:	83 ce 02             	or     $0x2,%esi
+8010a6f9:	89 f2                	mov    %esi,%edx
+8010a6fb:	88 97 35 ae 33 80    	mov    %dl,-0x7fcc51cb(%edi)
+8010a701:	89 de                	mov    %ebx,%esi
+8010a703:	83 ce 12             	or     $0x12,%esi
+8010a706:	89 f2                	mov    %esi,%edx
+8010a708:	88 97 35 ae 33 80    	mov    %dl,-0x7fcc51cb(%edi)
+8010a70e:	83 cb 72             	or     $0x72,%ebx
+8010a711:	88 9f 35 ae 33 80    	mov    %bl,-0x7fcc51cb(%edi)
+8010a717:	c6 87 35 ae 33 80 f2 	movb   $0xf2,-0x7fcc51cb(%edi)
+8010a71e:	0f b6 9f 36 ae 33 80 	movzbl -0x7fcc51ca(%edi),%ebx
+8010a725:	83 cb 0f             	or     $0xf,%ebx
+8010a728:	88 9f 36 ae 33 80    	mov    %bl,-0x7fcc51ca(%edi)
+8010a72e:	89 de                	mov    %ebx,%esi
+8010a730:	83 e6 ef             	and    $0xffffffef,%esi
+8010a733:	89 f2                	mov    %esi,%edx
+8010a735:	88 97 36 ae 33 80    	mov    %dl,-0x7fcc51ca(%edi)
+8010a73b:	83 e3 cf             	and    $0xffffffcf,%ebx
+8010a73e:	88 9f 36 ae 33 80    	mov    %bl,-0x7fcc51ca(%edi)
+8010a744:	89 de                	mov    %ebx,%esi
+8010a746:	83 ce 40             	or     $0x40,%esi
+8010a749:	89 f2                	mov    %esi,%edx
+8010a74b:	88 97 36 ae 33 80    	mov    %dl,-0x7fcc51ca(%edi)
+8010a751:	83 cb c0             	or     $0xffffffc0,%ebx
+8010a754:	88 9f 36 ae 33 80    	mov    %bl,-0x7fcc51ca(%edi)
+8010a75a:	c6 87 37 ae 33 80 00 	movb   $0x0,-0x7fcc51c9(%edi)
+  lgdt(c->gdt, sizeof(c->gdt));
+8010a761:	8d 97 10 ae 33 80    	lea    -0x7fcc51f0(%edi),%edx
+  pd[0] = size-1;
+8010a767:	66 c7 45 e2 2f 00    	movw   $0x2f,-0x1e(%ebp)
+  pd[1] = (uint)p;
+8010a76d:	66 89 55 e4          	mov    %dx,-0x1c(%ebp)
+  pd[2] = (uint)p >> 16;
+8010a771:	c1 ea 10             	shr    $0x10,%edx
+8010a774:	66 89 55 e6          	mov    %dx,-0x1a(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010a778:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+8010a77b:	0f 01 10             	lgdtl  (%eax)
+}
+8010a77e:	83 c4 1c             	add    $0x1c,%esp
+8010a781:	5b                   	pop    %ebx
+8010a782:	5e                   	pop    %esi
+8010a783:	5f                   	pop    %edi
+8010a784:	5d                   	pop    %ebp
+8010a785:	c3                   	ret
+
+8010a786 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010a786:	a1 00 60 34 80       	mov    0x80346000,%eax
+8010a78b:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a790:	0f 22 d8             	mov    %eax,%cr3
+}
+8010a793:	c3                   	ret
+
+8010a794 <switchuvm>:
+{
+8010a794:	55                   	push   %ebp
+8010a795:	89 e5                	mov    %esp,%ebp
+8010a797:	57                   	push   %edi
+8010a798:	56                   	push   %esi
+8010a799:	53                   	push   %ebx
+8010a79a:	83 ec 1c             	sub    $0x1c,%esp
+8010a79d:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010a7a0:	85 f6                	test   %esi,%esi
+8010a7a2:	0f 84 25 01 00 00    	je     8010a8cd <switchuvm+0x139>
+  if(p->kstack == 0)
+8010a7a8:	83 7e 08 00          	cmpl   $0x0,0x8(%esi)
+8010a7ac:	0f 84 28 01 00 00    	je     8010a8da <switchuvm+0x146>
+  if(p->pgdir == 0)
+8010a7b2:	83 7e 04 00          	cmpl   $0x0,0x4(%esi)
+8010a7b6:	0f 84 2b 01 00 00    	je     8010a8e7 <switchuvm+0x153>
+  pushcli();
+8010a7bc:	e8 27 d1 ff ff       	call   801078e8 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010a7c1:	e8 1a b5 ff ff       	call   80105ce0 <mycpu>
+8010a7c6:	89 c3                	mov    %eax,%ebx
+8010a7c8:	e8 13 b5 ff ff       	call   80105ce0 <mycpu>
+8010a7cd:	8d 78 08             	lea    0x8(%eax),%edi
+8010a7d0:	e8 0b b5 ff ff       	call   80105ce0 <mycpu>
+8010a7d5:	83 c0 08             	add    $0x8,%eax
+8010a7d8:	c1 e8 10             	shr    $0x10,%eax
+8010a7db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a7de:	e8 fd b4 ff ff       	call   80105ce0 <mycpu>
+8010a7e3:	83 c0 08             	add    $0x8,%eax
+8010a7e6:	c1 e8 18             	shr    $0x18,%eax
+8010a7e9:	66 c7 83 98 00 00 00 	movw   $0x67,0x98(%ebx)
+8010a7f0:	67 00 
+8010a7f2:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+8010a7f9:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+8010a7fd:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+8010a803:	0f b6 93 9d 00 00 00 	movzbl 0x9d(%ebx),%edx
+8010a80a:	83 e2 f0             	and    $0xfffffff0,%edx
+8010a80d:	89 d1                	mov    %edx,%ecx
+8010a80f:	83 c9 09             	or     $0x9,%ecx
+8010a812:	88 8b 9d 00 00 00    	mov    %cl,0x9d(%ebx)
+8010a818:	83 ca 19             	or     $0x19,%edx
+8010a81b:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010a821:	83 e2 9f             	and    $0xffffff9f,%edx
+8010a824:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010a82a:	83 ca 80             	or     $0xffffff80,%edx
+8010a82d:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010a833:	0f b6 93 9e 00 00 00 	movzbl 0x9e(%ebx),%edx
+8010a83a:	89 d1                	mov    %edx,%ecx
+8010a83c:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010a83f:	88 8b 9e 00 00 00    	mov    %cl,0x9e(%ebx)
+8010a845:	89 d1                	mov    %edx,%ecx
+8010a847:	83 e1 e0             	and    $0xffffffe0,%ecx
+8010a84a:	88 8b 9e 00 00 00    	mov    %cl,0x9e(%ebx)
+8010a850:	83 e2 c0             	and    $0xffffffc0,%edx
+8010a853:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010a859:	83 ca 40             	or     $0x40,%edx
+8010a85c:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010a862:	83 e2 7f             	and    $0x7f,%edx
+8010a865:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010a86b:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010a871:	e8 6a b4 ff ff       	call   80105ce0 <mycpu>
+8010a876:	0f b6 90 9d 00 00 00 	movzbl 0x9d(%eax),%edx
+8010a87d:	83 e2 ef             	and    $0xffffffef,%edx
+8010a880:	88 90 9d 00 00 00    	mov    %dl,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010a886:	e8 55 b4 ff ff       	call   80105ce0 <mycpu>
+8010a88b:	66 c7 40 10 10 00    	movw   $0x10,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010a891:	8b 5e 08             	mov    0x8(%esi),%ebx
+8010a894:	e8 47 b4 ff ff       	call   80105ce0 <mycpu>
+8010a899:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a89f:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010a8a2:	e8 39 b4 ff ff       	call   80105ce0 <mycpu>
+8010a8a7:	66 c7 40 6e ff ff    	movw   $0xffff,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010a8ad:	b8 28 00 00 00       	mov    $0x28,%eax
+8010a8b2:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+8010a8b5:	8b 46 04             	mov    0x4(%esi),%eax
+8010a8b8:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a8bd:	0f 22 d8             	mov    %eax,%cr3
+  popcli();
+8010a8c0:	e8 67 d0 ff ff       	call   8010792c <popcli>
+}
+8010a8c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a8c8:	5b                   	pop    %ebx
+8010a8c9:	5e                   	pop    %esi
+8010a8ca:	5f                   	pop    %edi
+8010a8cb:	5d                   	pop    %ebp
+8010a8cc:	c3                   	ret
+    panic("switchuvm: no process");
+8010a8cd:	83 ec 0c             	sub    $0xc,%esp
+8010a8d0:	68 36 bf 10 80       	push   $0x8010bf36
+8010a8d5:	e8 4c 62 ff ff       	call   80100b26 <panic>
+    panic("switchuvm: no kstack");
+8010a8da:	83 ec 0c             	sub    $0xc,%esp
+8010a8dd:	68 4c bf 10 80       	push   $0x8010bf4c
+8010a8e2:	e8 3f 62 ff ff       	call   80100b26 <panic>
+    panic("switchuvm: no pgdir");
+8010a8e7:	83 ec 0c             	sub    $0xc,%esp
+8010a8ea:	68 61 bf 10 80       	push   $0x8010bf61
+8010a8ef:	e8 32 62 ff ff       	call   80100b26 <panic>
+
+8010a8f4 <inituvm>:
+{
+8010a8f4:	55                   	push   %ebp
+8010a8f5:	89 e5                	mov    %esp,%ebp
+8010a8f7:	56                   	push   %esi
+8010a8f8:	53                   	push   %ebx
+8010a8f9:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(sz >= PGSIZE)
+8010a8fc:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010a902:	77 4c                	ja     8010a950 <inituvm+0x5c>
+  mem = kalloc();
+8010a904:	e8 87 96 ff ff       	call   80103f90 <kalloc>
+8010a909:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+8010a90b:	83 ec 04             	sub    $0x4,%esp
+8010a90e:	68 00 10 00 00       	push   $0x1000
+8010a913:	6a 00                	push   $0x0
+8010a915:	50                   	push   %eax
+8010a916:	e8 5c d1 ff ff       	call   80107a77 <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010a91b:	83 c4 08             	add    $0x8,%esp
+8010a91e:	6a 06                	push   $0x6
+8010a920:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010a926:	50                   	push   %eax
+8010a927:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a92c:	ba 00 00 00 00       	mov    $0x0,%edx
+8010a931:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a934:	e8 f9 f9 ff ff       	call   8010a332 <mappages>
+  memmove(mem, init, sz);
+8010a939:	83 c4 0c             	add    $0xc,%esp
+8010a93c:	56                   	push   %esi
+8010a93d:	ff 75 0c             	push   0xc(%ebp)
+8010a940:	53                   	push   %ebx
+8010a941:	e8 a9 d1 ff ff       	call   80107aef <memmove>
+}
+8010a946:	83 c4 10             	add    $0x10,%esp
+8010a949:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a94c:	5b                   	pop    %ebx
+8010a94d:	5e                   	pop    %esi
+8010a94e:	5d                   	pop    %ebp
+8010a94f:	c3                   	ret
+    panic("inituvm: more than a page");
+8010a950:	83 ec 0c             	sub    $0xc,%esp
+8010a953:	68 75 bf 10 80       	push   $0x8010bf75
+8010a958:	e8 c9 61 ff ff       	call   80100b26 <panic>
+
+8010a95d <loaduvm>:
+{
+8010a95d:	55                   	push   %ebp
+8010a95e:	89 e5                	mov    %esp,%ebp
+8010a960:	57                   	push   %edi
+8010a961:	56                   	push   %esi
+8010a962:	53                   	push   %ebx
+8010a963:	83 ec 0c             	sub    $0xc,%esp
+8010a966:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if((uint) addr % PGSIZE != 0)
+8010a969:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010a96c:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+8010a972:	74 3c                	je     8010a9b0 <loaduvm+0x53>
+    panic("loaduvm: addr must be page aligned");
+8010a974:	83 ec 0c             	sub    $0xc,%esp
+8010a977:	68 fc bf 10 80       	push   $0x8010bffc
+8010a97c:	e8 a5 61 ff ff       	call   80100b26 <panic>
+      panic("loaduvm: address should exist");
+8010a981:	83 ec 0c             	sub    $0xc,%esp
+8010a984:	68 8f bf 10 80       	push   $0x8010bf8f
+8010a989:	e8 98 61 ff ff       	call   80100b26 <panic>
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010a98e:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a993:	56                   	push   %esi
+8010a994:	89 da                	mov    %ebx,%edx
+8010a996:	03 55 14             	add    0x14(%ebp),%edx
+8010a999:	52                   	push   %edx
+8010a99a:	50                   	push   %eax
+8010a99b:	ff 75 10             	push   0x10(%ebp)
+8010a99e:	e8 c5 86 ff ff       	call   80103068 <readi>
+8010a9a3:	83 c4 10             	add    $0x10,%esp
+8010a9a6:	39 f0                	cmp    %esi,%eax
+8010a9a8:	75 47                	jne    8010a9f1 <loaduvm+0x94>
+  for(i = 0; i < sz; i += PGSIZE){
+8010a9aa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a9b0:	39 fb                	cmp    %edi,%ebx
+8010a9b2:	73 30                	jae    8010a9e4 <loaduvm+0x87>
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010a9b4:	89 da                	mov    %ebx,%edx
+8010a9b6:	03 55 0c             	add    0xc(%ebp),%edx
+8010a9b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a9be:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a9c1:	e8 fb f8 ff ff       	call   8010a2c1 <walkpgdir>
+8010a9c6:	85 c0                	test   %eax,%eax
+8010a9c8:	74 b7                	je     8010a981 <loaduvm+0x24>
+    pa = PTE_ADDR(*pte);
+8010a9ca:	8b 00                	mov    (%eax),%eax
+8010a9cc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(sz - i < PGSIZE)
+8010a9d1:	89 fe                	mov    %edi,%esi
+8010a9d3:	29 de                	sub    %ebx,%esi
+8010a9d5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010a9db:	76 b1                	jbe    8010a98e <loaduvm+0x31>
+      n = PGSIZE;
+8010a9dd:	be 00 10 00 00       	mov    $0x1000,%esi
+8010a9e2:	eb aa                	jmp    8010a98e <loaduvm+0x31>
+  return 0;
+8010a9e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a9e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a9ec:	5b                   	pop    %ebx
+8010a9ed:	5e                   	pop    %esi
+8010a9ee:	5f                   	pop    %edi
+8010a9ef:	5d                   	pop    %ebp
+8010a9f0:	c3                   	ret
+      return -1;
+8010a9f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a9f6:	eb f1                	jmp    8010a9e9 <loaduvm+0x8c>
+
+8010a9f8 <deallocuvm>:
+{
+8010a9f8:	55                   	push   %ebp
+8010a9f9:	89 e5                	mov    %esp,%ebp
+8010a9fb:	57                   	push   %edi
+8010a9fc:	56                   	push   %esi
+8010a9fd:	53                   	push   %ebx
+8010a9fe:	83 ec 0c             	sub    $0xc,%esp
+8010aa01:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(newsz >= oldsz)
+8010aa04:	39 7d 10             	cmp    %edi,0x10(%ebp)
+8010aa07:	73 11                	jae    8010aa1a <deallocuvm+0x22>
+  a = PGROUNDUP(newsz);
+8010aa09:	8b 45 10             	mov    0x10(%ebp),%eax
+8010aa0c:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+8010aa12:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010aa18:	eb 19                	jmp    8010aa33 <deallocuvm+0x3b>
+    return oldsz;
+8010aa1a:	89 f8                	mov    %edi,%eax
+8010aa1c:	eb 64                	jmp    8010aa82 <deallocuvm+0x8a>
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010aa1e:	c1 eb 16             	shr    $0x16,%ebx
+8010aa21:	83 c3 01             	add    $0x1,%ebx
+8010aa24:	c1 e3 16             	shl    $0x16,%ebx
+8010aa27:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010aa2d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010aa33:	39 fb                	cmp    %edi,%ebx
+8010aa35:	73 48                	jae    8010aa7f <deallocuvm+0x87>
+    pte = walkpgdir(pgdir, (char*)a, 0);
+8010aa37:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010aa3c:	89 da                	mov    %ebx,%edx
+8010aa3e:	8b 45 08             	mov    0x8(%ebp),%eax
+8010aa41:	e8 7b f8 ff ff       	call   8010a2c1 <walkpgdir>
+8010aa46:	89 c6                	mov    %eax,%esi
+    if(!pte)
+8010aa48:	85 c0                	test   %eax,%eax
+8010aa4a:	74 d2                	je     8010aa1e <deallocuvm+0x26>
+    else if((*pte & PTE_P) != 0){
+8010aa4c:	8b 00                	mov    (%eax),%eax
+8010aa4e:	a8 01                	test   $0x1,%al
+8010aa50:	74 db                	je     8010aa2d <deallocuvm+0x35>
+      if(pa == 0)
+8010aa52:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010aa57:	74 19                	je     8010aa72 <deallocuvm+0x7a>
+      char *v = P2V(pa);
+8010aa59:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010aa5e:	83 ec 0c             	sub    $0xc,%esp
+8010aa61:	50                   	push   %eax
+8010aa62:	e8 0a 93 ff ff       	call   80103d71 <kfree>
+      *pte = 0;
+8010aa67:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+8010aa6d:	83 c4 10             	add    $0x10,%esp
+8010aa70:	eb bb                	jmp    8010aa2d <deallocuvm+0x35>
+        panic("kfree");
+8010aa72:	83 ec 0c             	sub    $0xc,%esp
+8010aa75:	68 02 b4 10 80       	push   $0x8010b402
+8010aa7a:	e8 a7 60 ff ff       	call   80100b26 <panic>
+  return newsz;
+8010aa7f:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+8010aa82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aa85:	5b                   	pop    %ebx
+8010aa86:	5e                   	pop    %esi
+8010aa87:	5f                   	pop    %edi
+8010aa88:	5d                   	pop    %ebp
+8010aa89:	c3                   	ret
+
+8010aa8a <allocuvm>:
+{
+8010aa8a:	55                   	push   %ebp
+8010aa8b:	89 e5                	mov    %esp,%ebp
+8010aa8d:	57                   	push   %edi
+8010aa8e:	56                   	push   %esi
+8010aa8f:	53                   	push   %ebx
+8010aa90:	83 ec 1c             	sub    $0x1c,%esp
+8010aa93:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(newsz >= KERNBASE)
+8010aa96:	85 ff                	test   %edi,%edi
+8010aa98:	0f 88 c2 00 00 00    	js     8010ab60 <allocuvm+0xd6>
+  if(newsz < oldsz)
+8010aa9e:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+8010aaa1:	72 5f                	jb     8010ab02 <allocuvm+0x78>
+  a = PGROUNDUP(oldsz);
+8010aaa3:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010aaa6:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+8010aaac:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  for(; a < newsz; a += PGSIZE){
+8010aab2:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+8010aab5:	39 fe                	cmp    %edi,%esi
+8010aab7:	0f 83 9e 00 00 00    	jae    8010ab5b <allocuvm+0xd1>
+    mem = kalloc();
+8010aabd:	e8 ce 94 ff ff       	call   80103f90 <kalloc>
+8010aac2:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010aac4:	85 c0                	test   %eax,%eax
+8010aac6:	74 3f                	je     8010ab07 <allocuvm+0x7d>
+    memset(mem, 0, PGSIZE);
+8010aac8:	83 ec 04             	sub    $0x4,%esp
+8010aacb:	68 00 10 00 00       	push   $0x1000
+8010aad0:	6a 00                	push   $0x0
+8010aad2:	50                   	push   %eax
+8010aad3:	e8 9f cf ff ff       	call   80107a77 <memset>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010aad8:	83 c4 08             	add    $0x8,%esp
+8010aadb:	6a 06                	push   $0x6
+8010aadd:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010aae3:	50                   	push   %eax
+8010aae4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010aae9:	89 f2                	mov    %esi,%edx
+8010aaeb:	8b 45 08             	mov    0x8(%ebp),%eax
+8010aaee:	e8 3f f8 ff ff       	call   8010a332 <mappages>
+8010aaf3:	83 c4 10             	add    $0x10,%esp
+8010aaf6:	85 c0                	test   %eax,%eax
+8010aaf8:	78 33                	js     8010ab2d <allocuvm+0xa3>
+  for(; a < newsz; a += PGSIZE){
+8010aafa:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010ab00:	eb b3                	jmp    8010aab5 <allocuvm+0x2b>
+    return oldsz;
+8010ab02:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010ab05:	eb 5e                	jmp    8010ab65 <allocuvm+0xdb>
+      cprintf("allocuvm out of memory\n");
+8010ab07:	83 ec 0c             	sub    $0xc,%esp
+8010ab0a:	68 ad bf 10 80       	push   $0x8010bfad
+8010ab0f:	e8 d3 62 ff ff       	call   80100de7 <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+8010ab14:	83 c4 0c             	add    $0xc,%esp
+8010ab17:	ff 75 0c             	push   0xc(%ebp)
+8010ab1a:	57                   	push   %edi
+8010ab1b:	ff 75 08             	push   0x8(%ebp)
+8010ab1e:	e8 d5 fe ff ff       	call   8010a9f8 <deallocuvm>
+      return 0;
+8010ab23:	83 c4 10             	add    $0x10,%esp
+8010ab26:	ba 00 00 00 00       	mov    $0x0,%edx
+8010ab2b:	eb 38                	jmp    8010ab65 <allocuvm+0xdb>
+      cprintf("allocuvm out of memory (2)\n");
+8010ab2d:	83 ec 0c             	sub    $0xc,%esp
+8010ab30:	68 c5 bf 10 80       	push   $0x8010bfc5
+8010ab35:	e8 ad 62 ff ff       	call   80100de7 <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+8010ab3a:	83 c4 0c             	add    $0xc,%esp
+8010ab3d:	ff 75 0c             	push   0xc(%ebp)
+8010ab40:	57                   	push   %edi
+8010ab41:	ff 75 08             	push   0x8(%ebp)
+8010ab44:	e8 af fe ff ff       	call   8010a9f8 <deallocuvm>
+      kfree(mem);
+8010ab49:	89 1c 24             	mov    %ebx,(%esp)
+8010ab4c:	e8 20 92 ff ff       	call   80103d71 <kfree>
+      return 0;
+8010ab51:	83 c4 10             	add    $0x10,%esp
+8010ab54:	ba 00 00 00 00       	mov    $0x0,%edx
+8010ab59:	eb 0a                	jmp    8010ab65 <allocuvm+0xdb>
+8010ab5b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010ab5e:	eb 05                	jmp    8010ab65 <allocuvm+0xdb>
+    return 0;
+8010ab60:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+8010ab65:	89 d0                	mov    %edx,%eax
+8010ab67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ab6a:	5b                   	pop    %ebx
+8010ab6b:	5e                   	pop    %esi
+8010ab6c:	5f                   	pop    %edi
+8010ab6d:	5d                   	pop    %ebp
+8010ab6e:	c3                   	ret
+
+8010ab6f <freevm>:
+{
+8010ab6f:	55                   	push   %ebp
+8010ab70:	89 e5                	mov    %esp,%ebp
+8010ab72:	56                   	push   %esi
+8010ab73:	53                   	push   %ebx
+8010ab74:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(pgdir == 0)
+8010ab77:	85 f6                	test   %esi,%esi
+8010ab79:	74 1a                	je     8010ab95 <freevm+0x26>
+  deallocuvm(pgdir, KERNBASE, 0);
+8010ab7b:	83 ec 04             	sub    $0x4,%esp
+8010ab7e:	6a 00                	push   $0x0
+8010ab80:	68 00 00 00 80       	push   $0x80000000
+8010ab85:	56                   	push   %esi
+8010ab86:	e8 6d fe ff ff       	call   8010a9f8 <deallocuvm>
+  for(i = 0; i < NPDENTRIES; i++){
+8010ab8b:	83 c4 10             	add    $0x10,%esp
+8010ab8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010ab93:	eb 10                	jmp    8010aba5 <freevm+0x36>
+    panic("freevm: no pgdir");
+8010ab95:	83 ec 0c             	sub    $0xc,%esp
+8010ab98:	68 e1 bf 10 80       	push   $0x8010bfe1
+8010ab9d:	e8 84 5f ff ff       	call   80100b26 <panic>
+  for(i = 0; i < NPDENTRIES; i++){
+8010aba2:	83 c3 01             	add    $0x1,%ebx
+8010aba5:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+8010abab:	77 1f                	ja     8010abcc <freevm+0x5d>
+    if(pgdir[i] & PTE_P){
+8010abad:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+8010abb0:	a8 01                	test   $0x1,%al
+8010abb2:	74 ee                	je     8010aba2 <freevm+0x33>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010abb4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010abb9:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010abbe:	83 ec 0c             	sub    $0xc,%esp
+8010abc1:	50                   	push   %eax
+8010abc2:	e8 aa 91 ff ff       	call   80103d71 <kfree>
+8010abc7:	83 c4 10             	add    $0x10,%esp
+8010abca:	eb d6                	jmp    8010aba2 <freevm+0x33>
+  kfree((char*)pgdir);
+8010abcc:	83 ec 0c             	sub    $0xc,%esp
+8010abcf:	56                   	push   %esi
+8010abd0:	e8 9c 91 ff ff       	call   80103d71 <kfree>
+}
+8010abd5:	83 c4 10             	add    $0x10,%esp
+8010abd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010abdb:	5b                   	pop    %ebx
+8010abdc:	5e                   	pop    %esi
+8010abdd:	5d                   	pop    %ebp
+8010abde:	c3                   	ret
+
+8010abdf <setupkvm>:
+{
+8010abdf:	55                   	push   %ebp
+8010abe0:	89 e5                	mov    %esp,%ebp
+8010abe2:	56                   	push   %esi
+8010abe3:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+8010abe4:	e8 a7 93 ff ff       	call   80103f90 <kalloc>
+8010abe9:	89 c6                	mov    %eax,%esi
+8010abeb:	85 c0                	test   %eax,%eax
+8010abed:	74 55                	je     8010ac44 <setupkvm+0x65>
+  memset(pgdir, 0, PGSIZE);
+8010abef:	83 ec 04             	sub    $0x4,%esp
+8010abf2:	68 00 10 00 00       	push   $0x1000
+8010abf7:	6a 00                	push   $0x0
+8010abf9:	50                   	push   %eax
+8010abfa:	e8 78 ce ff ff       	call   80107a77 <memset>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010abff:	83 c4 10             	add    $0x10,%esp
+8010ac02:	bb 20 f4 10 80       	mov    $0x8010f420,%ebx
+8010ac07:	81 fb 60 f4 10 80    	cmp    $0x8010f460,%ebx
+8010ac0d:	73 35                	jae    8010ac44 <setupkvm+0x65>
+                (uint)k->phys_start, k->perm) < 0) {
+8010ac0f:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+8010ac12:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010ac15:	29 c1                	sub    %eax,%ecx
+8010ac17:	8b 13                	mov    (%ebx),%edx
+8010ac19:	83 ec 08             	sub    $0x8,%esp
+8010ac1c:	ff 73 0c             	push   0xc(%ebx)
+8010ac1f:	50                   	push   %eax
+8010ac20:	89 f0                	mov    %esi,%eax
+8010ac22:	e8 0b f7 ff ff       	call   8010a332 <mappages>
+8010ac27:	83 c4 10             	add    $0x10,%esp
+8010ac2a:	85 c0                	test   %eax,%eax
+8010ac2c:	78 05                	js     8010ac33 <setupkvm+0x54>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010ac2e:	83 c3 10             	add    $0x10,%ebx
+8010ac31:	eb d4                	jmp    8010ac07 <setupkvm+0x28>
+      freevm(pgdir);
+8010ac33:	83 ec 0c             	sub    $0xc,%esp
+8010ac36:	56                   	push   %esi
+8010ac37:	e8 33 ff ff ff       	call   8010ab6f <freevm>
+      return 0;
+8010ac3c:	83 c4 10             	add    $0x10,%esp
+8010ac3f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+8010ac44:	89 f0                	mov    %esi,%eax
+8010ac46:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010ac49:	5b                   	pop    %ebx
+8010ac4a:	5e                   	pop    %esi
+8010ac4b:	5d                   	pop    %ebp
+8010ac4c:	c3                   	ret
+
+8010ac4d <kvmalloc>:
+{
+8010ac4d:	55                   	push   %ebp
+8010ac4e:	89 e5                	mov    %esp,%ebp
+8010ac50:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010ac53:	e8 87 ff ff ff       	call   8010abdf <setupkvm>
+8010ac58:	a3 00 60 34 80       	mov    %eax,0x80346000
+  switchkvm();
+8010ac5d:	e8 24 fb ff ff       	call   8010a786 <switchkvm>
+}
+8010ac62:	c9                   	leave
+8010ac63:	c3                   	ret
+
+8010ac64 <clearpteu>:
+{
+8010ac64:	55                   	push   %ebp
+8010ac65:	89 e5                	mov    %esp,%ebp
+8010ac67:	83 ec 08             	sub    $0x8,%esp
+  pte = walkpgdir(pgdir, uva, 0);
+8010ac6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ac6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010ac72:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ac75:	e8 47 f6 ff ff       	call   8010a2c1 <walkpgdir>
+  if(pte == 0)
+8010ac7a:	85 c0                	test   %eax,%eax
+8010ac7c:	74 09                	je     8010ac87 <clearpteu+0x23>
+  *pte &= ~PTE_U;
+8010ac7e:	8b 10                	mov    (%eax),%edx
+8010ac80:	83 e2 fb             	and    $0xfffffffb,%edx
+8010ac83:	89 10                	mov    %edx,(%eax)
+}
+8010ac85:	c9                   	leave
+8010ac86:	c3                   	ret
+    panic("clearpteu");
+8010ac87:	83 ec 0c             	sub    $0xc,%esp
+8010ac8a:	68 f2 bf 10 80       	push   $0x8010bff2
+8010ac8f:	e8 92 5e ff ff       	call   80100b26 <panic>
+
+8010ac94 <copyuvm>:
+{
+8010ac94:	55                   	push   %ebp
+8010ac95:	89 e5                	mov    %esp,%ebp
+8010ac97:	57                   	push   %edi
+8010ac98:	56                   	push   %esi
+8010ac99:	53                   	push   %ebx
+8010ac9a:	83 ec 1c             	sub    $0x1c,%esp
+8010ac9d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((d = setupkvm()) == 0)
+8010aca0:	e8 3a ff ff ff       	call   8010abdf <setupkvm>
+8010aca5:	89 c1                	mov    %eax,%ecx
+8010aca7:	85 c0                	test   %eax,%eax
+8010aca9:	0f 84 b7 00 00 00    	je     8010ad66 <copyuvm+0xd2>
+  for(i = 0; i < sz; i += PGSIZE){
+8010acaf:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010acb4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010acb7:	89 7d 08             	mov    %edi,0x8(%ebp)
+8010acba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010acbd:	eb 43                	jmp    8010ad02 <copyuvm+0x6e>
+    pa = PTE_ADDR(*pte);
+8010acbf:	8b 00                	mov    (%eax),%eax
+8010acc1:	89 c6                	mov    %eax,%esi
+8010acc3:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    flags = PTE_FLAGS(*pte);
+8010acc9:	25 ff 0f 00 00       	and    $0xfff,%eax
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010acce:	83 ec 08             	sub    $0x8,%esp
+8010acd1:	50                   	push   %eax
+8010acd2:	56                   	push   %esi
+8010acd3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010acd8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010acdb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010acde:	e8 4f f6 ff ff       	call   8010a332 <mappages>
+8010ace3:	83 c4 10             	add    $0x10,%esp
+8010ace6:	85 c0                	test   %eax,%eax
+8010ace8:	78 4b                	js     8010ad35 <copyuvm+0xa1>
+    kincref(P2V(pa));
+8010acea:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+8010acf0:	83 ec 0c             	sub    $0xc,%esp
+8010acf3:	56                   	push   %esi
+8010acf4:	e8 20 90 ff ff       	call   80103d19 <kincref>
+8010acf9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sz; i += PGSIZE){
+8010acfc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010ad02:	39 fb                	cmp    %edi,%ebx
+8010ad04:	73 51                	jae    8010ad57 <copyuvm+0xc3>
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0 || !(*pte & PTE_P))
+8010ad06:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010ad09:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ad0e:	89 da                	mov    %ebx,%edx
+8010ad10:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ad13:	e8 a9 f5 ff ff       	call   8010a2c1 <walkpgdir>
+8010ad18:	85 c0                	test   %eax,%eax
+8010ad1a:	74 e0                	je     8010acfc <copyuvm+0x68>
+8010ad1c:	8b 10                	mov    (%eax),%edx
+8010ad1e:	f6 c2 01             	test   $0x1,%dl
+8010ad21:	74 d9                	je     8010acfc <copyuvm+0x68>
+    if(*pte & PTE_W)
+8010ad23:	f6 c2 02             	test   $0x2,%dl
+8010ad26:	74 97                	je     8010acbf <copyuvm+0x2b>
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+8010ad28:	81 e2 fd fd ff ff    	and    $0xfffffdfd,%edx
+8010ad2e:	80 ce 02             	or     $0x2,%dh
+8010ad31:	89 10                	mov    %edx,(%eax)
+8010ad33:	eb 8a                	jmp    8010acbf <copyuvm+0x2b>
+  lcr3(V2P(pgdir));
+8010ad35:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010ad38:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010ad3b:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010ad41:	0f 22 d8             	mov    %eax,%cr3
+  freevm(d);
+8010ad44:	83 ec 0c             	sub    $0xc,%esp
+8010ad47:	51                   	push   %ecx
+8010ad48:	e8 22 fe ff ff       	call   8010ab6f <freevm>
+  return 0;
+8010ad4d:	83 c4 10             	add    $0x10,%esp
+8010ad50:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ad55:	eb 0f                	jmp    8010ad66 <copyuvm+0xd2>
+  lcr3(V2P(pgdir));
+8010ad57:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010ad5a:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010ad5d:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010ad63:	0f 22 d8             	mov    %eax,%cr3
+}
+8010ad66:	89 c8                	mov    %ecx,%eax
+8010ad68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ad6b:	5b                   	pop    %ebx
+8010ad6c:	5e                   	pop    %esi
+8010ad6d:	5f                   	pop    %edi
+8010ad6e:	5d                   	pop    %ebp
+8010ad6f:	c3                   	ret
+
+8010ad70 <pagefault>:
+// Handle a page fault at va in process p with error code err.
+// Returns 0 if the fault was resolved and the faulting
+// instruction can be restarted, -1 otherwise.
+int
+pagefault(struct proc *p, uint va, uint err)
+{
+8010ad70:	55                   	push   %ebp
+8010ad71:	89 e5                	mov    %esp,%ebp
+8010ad73:	57                   	push   %edi
+8010ad74:	56                   	push   %esi
+8010ad75:	53                   	push   %ebx
+8010ad76:	83 ec 0c             	sub    $0xc,%esp
+8010ad79:	8b 75 08             	mov    0x8(%ebp),%esi
+8010ad7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  pte_t *pte;
+  char *mem;
+  uint a;
+
+  if(va >= p->sz)
+8010ad7f:	3b 1e                	cmp    (%esi),%ebx
+8010ad81:	0f 83 b0 00 00 00    	jae    8010ae37 <pagefault+0xc7>
+    return -1;
+  a = PGROUNDDOWN(va);
+8010ad87:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  pte = walkpgdir(p->pgdir, (char*)a, 0);
+8010ad8d:	8b 46 04             	mov    0x4(%esi),%eax
+8010ad90:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ad95:	89 da                	mov    %ebx,%edx
+8010ad97:	e8 25 f5 ff ff       	call   8010a2c1 <walkpgdir>
+  if(pte == 0 || (*pte & PTE_P) == 0){
+8010ad9c:	85 c0                	test   %eax,%eax
+8010ad9e:	74 07                	je     8010ada7 <pagefault+0x37>
+8010ada0:	8b 10                	mov    (%eax),%edx
+8010ada2:	f6 c2 01             	test   $0x1,%dl
+8010ada5:	75 73                	jne    8010ae1a <pagefault+0xaa>
+    // exec() and sbrk() only set up p->sz; program and heap
+    // pages are allocated and filled here, on first touch.
+    if((mem = kalloc()) == 0)
+8010ada7:	e8 e4 91 ff ff       	call   80103f90 <kalloc>
+8010adac:	89 c7                	mov    %eax,%edi
+8010adae:	85 c0                	test   %eax,%eax
+8010adb0:	0f 84 88 00 00 00    	je     8010ae3e <pagefault+0xce>
+      return -1;
+    memset(mem, 0, PGSIZE);
+8010adb6:	83 ec 04             	sub    $0x4,%esp
+8010adb9:	68 00 10 00 00       	push   $0x1000
+8010adbe:	6a 00                	push   $0x0
+8010adc0:	50                   	push   %eax
+8010adc1:	e8 b1 cc ff ff       	call   80107a77 <memset>
+    if(loadpage(p, mem, a) < 0 ||
+8010adc6:	89 d9                	mov    %ebx,%ecx
+8010adc8:	89 fa                	mov    %edi,%edx
+8010adca:	89 f0                	mov    %esi,%eax
+8010adcc:	e8 d8 f5 ff ff       	call   8010a3a9 <loadpage>
+8010add1:	83 c4 10             	add    $0x10,%esp
+8010add4:	85 c0                	test   %eax,%eax
+8010add6:	78 2f                	js     8010ae07 <pagefault+0x97>
+       mappages(p->pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010add8:	8b 46 04             	mov    0x4(%esi),%eax
+8010addb:	83 ec 08             	sub    $0x8,%esp
+8010adde:	6a 06                	push   $0x6
+8010ade0:	8d 97 00 00 00 80    	lea    -0x80000000(%edi),%edx
+8010ade6:	52                   	push   %edx
+8010ade7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010adec:	89 da                	mov    %ebx,%edx
+8010adee:	e8 3f f5 ff ff       	call   8010a332 <mappages>
+    if(loadpage(p, mem, a) < 0 ||
+8010adf3:	83 c4 10             	add    $0x10,%esp
+8010adf6:	85 c0                	test   %eax,%eax
+8010adf8:	78 0d                	js     8010ae07 <pagefault+0x97>
+      kfree(mem);
+      return -1;
+    }
+    return 0;
+8010adfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  if((err & FEC_WR) && (*pte & (PTE_U|PTE_COW)) == (PTE_U|PTE_COW))
+    return cowpage(pte, a);
+  return -1;
+}
+8010adff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ae02:	5b                   	pop    %ebx
+8010ae03:	5e                   	pop    %esi
+8010ae04:	5f                   	pop    %edi
+8010ae05:	5d                   	pop    %ebp
+8010ae06:	c3                   	ret
+      kfree(mem);
+8010ae07:	83 ec 0c             	sub    $0xc,%esp
+8010ae0a:	57                   	push   %edi
+8010ae0b:	e8 61 8f ff ff       	call   80103d71 <kfree>
+      return -1;
+8010ae10:	83 c4 10             	add    $0x10,%esp
+8010ae13:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ae18:	eb e5                	jmp    8010adff <pagefault+0x8f>
+  if((err & FEC_WR) && (*pte & (PTE_U|PTE_COW)) == (PTE_U|PTE_COW))
+8010ae1a:	f6 45 10 02          	testb  $0x2,0x10(%ebp)
+8010ae1e:	74 25                	je     8010ae45 <pagefault+0xd5>
+8010ae20:	81 e2 04 02 00 00    	and    $0x204,%edx
+8010ae26:	81 fa 04 02 00 00    	cmp    $0x204,%edx
+8010ae2c:	75 1e                	jne    8010ae4c <pagefault+0xdc>
+    return cowpage(pte, a);
+8010ae2e:	89 da                	mov    %ebx,%edx
+8010ae30:	e8 54 f6 ff ff       	call   8010a489 <cowpage>
+8010ae35:	eb c8                	jmp    8010adff <pagefault+0x8f>
+    return -1;
+8010ae37:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ae3c:	eb c1                	jmp    8010adff <pagefault+0x8f>
+      return -1;
+8010ae3e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ae43:	eb ba                	jmp    8010adff <pagefault+0x8f>
+  return -1;
+8010ae45:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ae4a:	eb b3                	jmp    8010adff <pagefault+0x8f>
+8010ae4c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ae51:	eb ac                	jmp    8010adff <pagefault+0x8f>
+
+8010ae53 <prefault>:
+// Fault in any pages of [va, va+len) in p that are not present
+// yet, so the kernel can use a user buffer without taking a
+// fault it could not back out of. Returns -1 if out of memory.
+int
+prefault(struct proc *p, uint va, uint len)
+{
+8010ae53:	55                   	push   %ebp
+8010ae54:	89 e5                	mov    %esp,%ebp
+8010ae56:	57                   	push   %edi
+8010ae57:	56                   	push   %esi
+8010ae58:	53                   	push   %ebx
+8010ae59:	83 ec 0c             	sub    $0xc,%esp
+8010ae5c:	8b 75 08             	mov    0x8(%ebp),%esi
+8010ae5f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010ae62:	89 fb                	mov    %edi,%ebx
+8010ae64:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010ae6a:	eb 19                	jmp    8010ae85 <prefault+0x32>
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if((pte == 0 || (*pte & PTE_P) == 0) && pagefault(p, a, 0) < 0)
+8010ae6c:	83 ec 04             	sub    $0x4,%esp
+8010ae6f:	6a 00                	push   $0x0
+8010ae71:	53                   	push   %ebx
+8010ae72:	56                   	push   %esi
+8010ae73:	e8 f8 fe ff ff       	call   8010ad70 <pagefault>
+8010ae78:	83 c4 10             	add    $0x10,%esp
+8010ae7b:	85 c0                	test   %eax,%eax
+8010ae7d:	78 36                	js     8010aeb5 <prefault+0x62>
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010ae7f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010ae85:	89 f8                	mov    %edi,%eax
+8010ae87:	03 45 10             	add    0x10(%ebp),%eax
+8010ae8a:	39 c3                	cmp    %eax,%ebx
+8010ae8c:	73 1a                	jae    8010aea8 <prefault+0x55>
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+8010ae8e:	8b 46 04             	mov    0x4(%esi),%eax
+8010ae91:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010ae96:	89 da                	mov    %ebx,%edx
+8010ae98:	e8 24 f4 ff ff       	call   8010a2c1 <walkpgdir>
+    if((pte == 0 || (*pte & PTE_P) == 0) && pagefault(p, a, 0) < 0)
+8010ae9d:	85 c0                	test   %eax,%eax
+8010ae9f:	74 cb                	je     8010ae6c <prefault+0x19>
+8010aea1:	f6 00 01             	testb  $0x1,(%eax)
+8010aea4:	75 d9                	jne    8010ae7f <prefault+0x2c>
+8010aea6:	eb c4                	jmp    8010ae6c <prefault+0x19>
+      return -1;
+  }
+  return 0;
+8010aea8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010aead:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aeb0:	5b                   	pop    %ebx
+8010aeb1:	5e                   	pop    %esi
+8010aeb2:	5f                   	pop    %edi
+8010aeb3:	5d                   	pop    %ebp
+8010aeb4:	c3                   	ret
+      return -1;
+8010aeb5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010aeba:	eb f1                	jmp    8010aead <prefault+0x5a>
+
+8010aebc <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010aebc:	55                   	push   %ebp
+8010aebd:	89 e5                	mov    %esp,%ebp
+8010aebf:	83 ec 08             	sub    $0x8,%esp
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+8010aec2:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010aec7:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010aeca:	8b 45 08             	mov    0x8(%ebp),%eax
+8010aecd:	e8 ef f3 ff ff       	call   8010a2c1 <walkpgdir>
+  if((*pte & PTE_P) == 0)
+8010aed2:	8b 00                	mov    (%eax),%eax
+8010aed4:	a8 01                	test   $0x1,%al
+8010aed6:	74 10                	je     8010aee8 <uva2ka+0x2c>
+    return 0;
+  if((*pte & PTE_U) == 0)
+8010aed8:	a8 04                	test   $0x4,%al
+8010aeda:	74 13                	je     8010aeef <uva2ka+0x33>
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+8010aedc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010aee1:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+8010aee6:	c9                   	leave
+8010aee7:	c3                   	ret
+    return 0;
+8010aee8:	b8 00 00 00 00       	mov    $0x0,%eax
+8010aeed:	eb f7                	jmp    8010aee6 <uva2ka+0x2a>
+    return 0;
+8010aeef:	b8 00 00 00 00       	mov    $0x0,%eax
+8010aef4:	eb f0                	jmp    8010aee6 <uva2ka+0x2a>
+
+8010aef6 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010aef6:	55                   	push   %ebp
+8010aef7:	89 e5                	mov    %esp,%ebp
+8010aef9:	57                   	push   %edi
+8010aefa:	56                   	push   %esi
+8010aefb:	53                   	push   %ebx
+8010aefc:	83 ec 0c             	sub    $0xc,%esp
+8010aeff:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+8010af02:	eb 32                	jmp    8010af36 <copyout+0x40>
+    va0 = (uint)PGROUNDDOWN(va);
+    // The kernel writes through its own mapping, so a shared
+    // page has to be copied here rather than on a fault.
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & (PTE_P|PTE_U|PTE_COW)) == (PTE_P|PTE_U|PTE_COW))
+      if(cowpage(pte, va0) < 0)
+8010af04:	89 f2                	mov    %esi,%edx
+8010af06:	e8 7e f5 ff ff       	call   8010a489 <cowpage>
+8010af0b:	85 c0                	test   %eax,%eax
+8010af0d:	79 58                	jns    8010af67 <copyout+0x71>
+        return -1;
+8010af0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010af14:	eb 7d                	jmp    8010af93 <copyout+0x9d>
+    if(pa0 == 0)
+      return -1;
+    n = PGSIZE - (va - va0);
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+8010af16:	29 f7                	sub    %esi,%edi
+8010af18:	01 f8                	add    %edi,%eax
+8010af1a:	83 ec 04             	sub    $0x4,%esp
+8010af1d:	53                   	push   %ebx
+8010af1e:	ff 75 10             	push   0x10(%ebp)
+8010af21:	50                   	push   %eax
+8010af22:	e8 c8 cb ff ff       	call   80107aef <memmove>
+    len -= n;
+8010af27:	29 5d 14             	sub    %ebx,0x14(%ebp)
+    buf += n;
+8010af2a:	01 5d 10             	add    %ebx,0x10(%ebp)
+    va = va0 + PGSIZE;
+8010af2d:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+8010af33:	83 c4 10             	add    $0x10,%esp
+  while(len > 0){
+8010af36:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010af3a:	74 52                	je     8010af8e <copyout+0x98>
+    va0 = (uint)PGROUNDDOWN(va);
+8010af3c:	89 fe                	mov    %edi,%esi
+8010af3e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+8010af44:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010af49:	89 f2                	mov    %esi,%edx
+8010af4b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010af4e:	e8 6e f3 ff ff       	call   8010a2c1 <walkpgdir>
+    if(pte && (*pte & (PTE_P|PTE_U|PTE_COW)) == (PTE_P|PTE_U|PTE_COW))
+8010af53:	85 c0                	test   %eax,%eax
+8010af55:	74 10                	je     8010af67 <copyout+0x71>
+8010af57:	8b 10                	mov    (%eax),%edx
+8010af59:	81 e2 05 02 00 00    	and    $0x205,%edx
+8010af5f:	81 fa 05 02 00 00    	cmp    $0x205,%edx
+8010af65:	74 9d                	je     8010af04 <copyout+0xe>
+    pa0 = uva2ka(pgdir, (char*)va0);
+8010af67:	83 ec 08             	sub    $0x8,%esp
+8010af6a:	56                   	push   %esi
+8010af6b:	ff 75 08             	push   0x8(%ebp)
+8010af6e:	e8 49 ff ff ff       	call   8010aebc <uva2ka>
+    if(pa0 == 0)
+8010af73:	83 c4 10             	add    $0x10,%esp
+8010af76:	85 c0                	test   %eax,%eax
+8010af78:	74 21                	je     8010af9b <copyout+0xa5>
+    n = PGSIZE - (va - va0);
+8010af7a:	89 f3                	mov    %esi,%ebx
+8010af7c:	29 fb                	sub    %edi,%ebx
+8010af7e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    if(n > len)
+8010af84:	39 5d 14             	cmp    %ebx,0x14(%ebp)
+8010af87:	73 8d                	jae    8010af16 <copyout+0x20>
+      n = len;
+8010af89:	8b 5d 14             	mov    0x14(%ebp),%ebx
+8010af8c:	eb 88                	jmp    8010af16 <copyout+0x20>
+  }
+  return 0;
+8010af8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010af93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010af96:	5b                   	pop    %ebx
+8010af97:	5e                   	pop    %esi
+8010af98:	5f                   	pop    %edi
+8010af99:	5d                   	pop    %ebp
+8010af9a:	c3                   	ret
+      return -1;
+8010af9b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010afa0:	eb f1                	jmp    8010af93 <copyout+0x9d>
+
+8010afa2 <ideinit>:
+static uchar *memdisk;
+
+void
+ideinit(void)
+{
+  memdisk = _binary_fs_memfs_img_start;
+8010afa2:	c7 05 04 60 34 80 16 	movl   $0x8010f516,0x80346004
+8010afa9:	f5 10 80 
+  disksize = (uint)_binary_fs_memfs_img_size/BSIZE;
+8010afac:	b8 00 00 20 00       	mov    $0x200000,%eax
+8010afb1:	c1 e8 0c             	shr    $0xc,%eax
+8010afb4:	a3 08 60 34 80       	mov    %eax,0x80346008
+}
+8010afb9:	c3                   	ret
+
+8010afba <ideintr>:
+// Interrupt handler.
+void
+ideintr(void)
+{
+  // no-op
+}
+8010afba:	c3                   	ret
+
+8010afbb <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+8010afbb:	55                   	push   %ebp
+8010afbc:	89 e5                	mov    %esp,%ebp
+8010afbe:	53                   	push   %ebx
+8010afbf:	83 ec 10             	sub    $0x10,%esp
+8010afc2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uchar *p;
+
+  if(!holdingsleep(&b->lock))
+8010afc5:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010afc8:	50                   	push   %eax
+8010afc9:	e8 92 c8 ff ff       	call   80107860 <holdingsleep>
+8010afce:	83 c4 10             	add    $0x10,%esp
+8010afd1:	85 c0                	test   %eax,%eax
+8010afd3:	74 50                	je     8010b025 <iderw+0x6a>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+8010afd5:	8b 13                	mov    (%ebx),%edx
+8010afd7:	89 d0                	mov    %edx,%eax
+8010afd9:	83 e0 06             	and    $0x6,%eax
+8010afdc:	83 f8 02             	cmp    $0x2,%eax
+8010afdf:	74 51                	je     8010b032 <iderw+0x77>
+    panic("iderw: nothing to do");
+  if(b->dev != 1)
+8010afe1:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+8010afe5:	75 58                	jne    8010b03f <iderw+0x84>
+    panic("iderw: request not for disk 1");
+  if(b->blockno >= disksize)
+8010afe7:	8b 43 08             	mov    0x8(%ebx),%eax
+8010afea:	3b 05 08 60 34 80    	cmp    0x80346008,%eax
+8010aff0:	73 5a                	jae    8010b04c <iderw+0x91>
+    panic("iderw: block out of range");
+
+  p = memdisk + b->blockno*BSIZE;
+8010aff2:	c1 e0 0c             	shl    $0xc,%eax
+8010aff5:	03 05 04 60 34 80    	add    0x80346004,%eax
+
+  if(b->flags & B_DIRTY){
+8010affb:	f6 c2 04             	test   $0x4,%dl
+8010affe:	74 59                	je     8010b059 <iderw+0x9e>
+    b->flags &= ~B_DIRTY;
+8010b000:	83 e2 fb             	and    $0xfffffffb,%edx
+8010b003:	89 13                	mov    %edx,(%ebx)
+    memmove(p, b->data, BSIZE);
+8010b005:	83 ec 04             	sub    $0x4,%esp
+8010b008:	68 00 10 00 00       	push   $0x1000
+8010b00d:	ff 73 60             	push   0x60(%ebx)
+8010b010:	50                   	push   %eax
+8010b011:	e8 d9 ca ff ff       	call   80107aef <memmove>
+8010b016:	83 c4 10             	add    $0x10,%esp
+  } else
+    memmove(b->data, p, BSIZE);
+  b->flags |= B_VALID;
+8010b019:	8b 03                	mov    (%ebx),%eax
+8010b01b:	83 c8 02             	or     $0x2,%eax
+8010b01e:	89 03                	mov    %eax,(%ebx)
+}
+8010b020:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010b023:	c9                   	leave
+8010b024:	c3                   	ret
+    panic("iderw: buf not locked");
+8010b025:	83 ec 0c             	sub    $0xc,%esp
+8010b028:	68 1f c0 10 80       	push   $0x8010c01f
+8010b02d:	e8 f4 5a ff ff       	call   80100b26 <panic>
+    panic("iderw: nothing to do");
+8010b032:	83 ec 0c             	sub    $0xc,%esp
+8010b035:	68 35 c0 10 80       	push   $0x8010c035
+8010b03a:	e8 e7 5a ff ff       	call   80100b26 <panic>
+    panic("iderw: request not for disk 1");
+8010b03f:	83 ec 0c             	sub    $0xc,%esp
+8010b042:	68 4a c0 10 80       	push   $0x8010c04a
+8010b047:	e8 da 5a ff ff       	call   80100b26 <panic>
+    panic("iderw: block out of range");
+8010b04c:	83 ec 0c             	sub    $0xc,%esp
+8010b04f:	68 68 c0 10 80       	push   $0x8010c068
+8010b054:	e8 cd 5a ff ff       	call   80100b26 <panic>
+    memmove(b->data, p, BSIZE);
+8010b059:	83 ec 04             	sub    $0x4,%esp
+8010b05c:	68 00 10 00 00       	push   $0x1000
+8010b061:	50                   	push   %eax
+8010b062:	ff 73 60             	push   0x60(%ebx)
+8010b065:	e8 85 ca ff ff       	call   80107aef <memmove>
+8010b06a:	83 c4 10             	add    $0x10,%esp
+8010b06d:	eb aa                	jmp    8010b019 <iderw+0x5e>
+
+8010b06f <iderwv>:
+
+void
+iderwv(struct buf **bufs, int n)
+{
+8010b06f:	55                   	push   %ebp
+8010b070:	89 e5                	mov    %esp,%ebp
+8010b072:	57                   	push   %edi
+8010b073:	56                   	push   %esi
+8010b074:	53                   	push   %ebx
+8010b075:	83 ec 0c             	sub    $0xc,%esp
+8010b078:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010b07b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int i;
+
+  for(i = 0; i < n; i++)
+8010b07e:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010b083:	eb 11                	jmp    8010b096 <iderwv+0x27>
+    iderw(bufs[i]);
+8010b085:	83 ec 0c             	sub    $0xc,%esp
+8010b088:	ff 34 9f             	push   (%edi,%ebx,4)
+8010b08b:	e8 2b ff ff ff       	call   8010afbb <iderw>
+  for(i = 0; i < n; i++)
+8010b090:	83 c3 01             	add    $0x1,%ebx
+8010b093:	83 c4 10             	add    $0x10,%esp
+8010b096:	39 f3                	cmp    %esi,%ebx
+8010b098:	7c eb                	jl     8010b085 <iderwv+0x16>
+}
+8010b09a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b09d:	5b                   	pop    %ebx
+8010b09e:	5e                   	pop    %esi
+8010b09f:	5f                   	pop    %edi
+8010b0a0:	5d                   	pop    %ebp
+8010b0a1:	c3                   	ret
+
+8010b0a2 <idereadahead>:
+
+// No point reading ahead from memory; just do the read.
+void
+idereadahead(struct buf *b)
+{
+8010b0a2:	55                   	push   %ebp
+8010b0a3:	89 e5                	mov    %esp,%ebp
+8010b0a5:	83 ec 14             	sub    $0x14,%esp
+  iderw(b);
+8010b0a8:	ff 75 08             	push   0x8(%ebp)
+8010b0ab:	e8 0b ff ff ff       	call   8010afbb <iderw>
+}
+8010b0b0:	83 c4 10             	add    $0x10,%esp
+8010b0b3:	c9                   	leave
+8010b0b4:	c3                   	ret
+
+8010b0b5 <idewaitahead>:
+
+void
+idewaitahead(struct buf *b)
+{
+}
+8010b0b5:	c3                   	ret
@@ -0,0 +1,1181 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "pdx.h"
+#endif // PDX_XV6
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 07                	jle    25 <main+0x25>
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+  1e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  23:	eb 2d                	jmp    52 <main+0x52>
+    printf(2, "usage: kill pid...\n");
+  25:	83 ec 08             	sub    $0x8,%esp
+  28:	68 14 07 00 00       	push   $0x714
+  2d:	6a 02                	push   $0x2
+  2f:	e8 30 04 00 00       	call   464 <printf>
+    exit();
+  34:	e8 86 02 00 00       	call   2bf <exit>
+    kill(atoi(argv[i]));
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 34 9f             	push   (%edi,%ebx,4)
+  3f:	e8 52 01 00 00       	call   196 <atoi>
+  44:	89 04 24             	mov    %eax,(%esp)
+  47:	e8 a3 02 00 00       	call   2ef <kill>
+  for(i=1; i<argc; i++)
+  4c:	83 c3 01             	add    $0x1,%ebx
+  4f:	83 c4 10             	add    $0x10,%esp
+  52:	39 f3                	cmp    %esi,%ebx
+  54:	7c e3                	jl     39 <main+0x39>
+  exit();
+  56:	e8 64 02 00 00       	call   2bf <exit>
+
+0000005b <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  5b:	55                   	push   %ebp
+  5c:	89 e5                	mov    %esp,%ebp
+  5e:	56                   	push   %esi
+  5f:	53                   	push   %ebx
+  60:	8b 75 08             	mov    0x8(%ebp),%esi
+  63:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  66:	89 f0                	mov    %esi,%eax
+  68:	89 d1                	mov    %edx,%ecx
+  6a:	83 c2 01             	add    $0x1,%edx
+  6d:	89 c3                	mov    %eax,%ebx
+  6f:	83 c0 01             	add    $0x1,%eax
+  72:	0f b6 09             	movzbl (%ecx),%ecx
+  75:	88 0b                	mov    %cl,(%ebx)
+  77:	84 c9                	test   %cl,%cl
+  79:	75 ed                	jne    68 <strcpy+0xd>
+    ;
+  return os;
+}
+  7b:	89 f0                	mov    %esi,%eax
+  7d:	5b                   	pop    %ebx
+  7e:	5e                   	pop    %esi
+  7f:	5d                   	pop    %ebp
+  80:	c3                   	ret
+
+00000081 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  81:	55                   	push   %ebp
+  82:	89 e5                	mov    %esp,%ebp
+  84:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  87:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  8a:	eb 06                	jmp    92 <strcmp+0x11>
+    p++, q++;
+  8c:	83 c1 01             	add    $0x1,%ecx
+  8f:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  92:	0f b6 01             	movzbl (%ecx),%eax
+  95:	84 c0                	test   %al,%al
+  97:	74 04                	je     9d <strcmp+0x1c>
+  99:	3a 02                	cmp    (%edx),%al
+  9b:	74 ef                	je     8c <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+  9d:	0f b6 c0             	movzbl %al,%eax
+  a0:	0f b6 12             	movzbl (%edx),%edx
+  a3:	29 d0                	sub    %edx,%eax
+}
+  a5:	5d                   	pop    %ebp
+  a6:	c3                   	ret
+
+000000a7 <strlen>:
+
+uint
+strlen(char *s)
+{
+  a7:	55                   	push   %ebp
+  a8:	89 e5                	mov    %esp,%ebp
+  aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  b2:	eb 03                	jmp    b7 <strlen+0x10>
+  b4:	83 c0 01             	add    $0x1,%eax
+  b7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  bb:	75 f7                	jne    b4 <strlen+0xd>
+    ;
+  return n;
+}
+  bd:	5d                   	pop    %ebp
+  be:	c3                   	ret
+
+000000bf <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  bf:	55                   	push   %ebp
+  c0:	89 e5                	mov    %esp,%ebp
+  c2:	57                   	push   %edi
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  c6:	89 d7                	mov    %edx,%edi
+  c8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ce:	fc                   	cld
+  cf:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  d1:	89 d0                	mov    %edx,%eax
+  d3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  d6:	c9                   	leave
+  d7:	c3                   	ret
+
+000000d8 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  d8:	55                   	push   %ebp
+  d9:	89 e5                	mov    %esp,%ebp
+  db:	8b 45 08             	mov    0x8(%ebp),%eax
+  de:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  e2:	eb 03                	jmp    e7 <strchr+0xf>
+  e4:	83 c0 01             	add    $0x1,%eax
+  e7:	0f b6 10             	movzbl (%eax),%edx
+  ea:	84 d2                	test   %dl,%dl
+  ec:	74 06                	je     f4 <strchr+0x1c>
+    if(*s == c)
+  ee:	38 ca                	cmp    %cl,%dl
+  f0:	75 f2                	jne    e4 <strchr+0xc>
+  f2:	eb 05                	jmp    f9 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  f9:	5d                   	pop    %ebp
+  fa:	c3                   	ret
+
+000000fb <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  fb:	55                   	push   %ebp
+  fc:	89 e5                	mov    %esp,%ebp
+  fe:	57                   	push   %edi
+  ff:	56                   	push   %esi
+ 100:	53                   	push   %ebx
+ 101:	83 ec 1c             	sub    $0x1c,%esp
+ 104:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 107:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 10c:	89 de                	mov    %ebx,%esi
+ 10e:	83 c3 01             	add    $0x1,%ebx
+ 111:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 114:	7d 2e                	jge    144 <gets+0x49>
+    cc = read(0, &c, 1);
+ 116:	83 ec 04             	sub    $0x4,%esp
+ 119:	6a 01                	push   $0x1
+ 11b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 11e:	50                   	push   %eax
+ 11f:	6a 00                	push   $0x0
+ 121:	e8 b1 01 00 00       	call   2d7 <read>
+    if(cc < 1)
+ 126:	83 c4 10             	add    $0x10,%esp
+ 129:	85 c0                	test   %eax,%eax
+ 12b:	7e 17                	jle    144 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 12d:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 131:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 134:	3c 0a                	cmp    $0xa,%al
+ 136:	0f 94 c2             	sete   %dl
+ 139:	3c 0d                	cmp    $0xd,%al
+ 13b:	0f 94 c0             	sete   %al
+ 13e:	08 c2                	or     %al,%dl
+ 140:	74 ca                	je     10c <gets+0x11>
+    buf[i++] = c;
+ 142:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 144:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 148:	89 f8                	mov    %edi,%eax
+ 14a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 14d:	5b                   	pop    %ebx
+ 14e:	5e                   	pop    %esi
+ 14f:	5f                   	pop    %edi
+ 150:	5d                   	pop    %ebp
+ 151:	c3                   	ret
+
+00000152 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	56                   	push   %esi
+ 156:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 157:	83 ec 08             	sub    $0x8,%esp
+ 15a:	6a 00                	push   $0x0
+ 15c:	ff 75 08             	push   0x8(%ebp)
+ 15f:	e8 9b 01 00 00       	call   2ff <open>
+  if(fd < 0)
+ 164:	83 c4 10             	add    $0x10,%esp
+ 167:	85 c0                	test   %eax,%eax
+ 169:	78 24                	js     18f <stat+0x3d>
+ 16b:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 16d:	83 ec 08             	sub    $0x8,%esp
+ 170:	ff 75 0c             	push   0xc(%ebp)
+ 173:	50                   	push   %eax
+ 174:	e8 9e 01 00 00       	call   317 <fstat>
+ 179:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 17b:	89 1c 24             	mov    %ebx,(%esp)
+ 17e:	e8 64 01 00 00       	call   2e7 <close>
+  return r;
+ 183:	83 c4 10             	add    $0x10,%esp
+}
+ 186:	89 f0                	mov    %esi,%eax
+ 188:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 18b:	5b                   	pop    %ebx
+ 18c:	5e                   	pop    %esi
+ 18d:	5d                   	pop    %ebp
+ 18e:	c3                   	ret
+    return -1;
+ 18f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 194:	eb f0                	jmp    186 <stat+0x34>
+
+00000196 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 196:	55                   	push   %ebp
+ 197:	89 e5                	mov    %esp,%ebp
+ 199:	56                   	push   %esi
+ 19a:	53                   	push   %ebx
+ 19b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 19e:	eb 03                	jmp    1a3 <atoi+0xd>
+ 1a0:	83 c2 01             	add    $0x1,%edx
+ 1a3:	0f b6 02             	movzbl (%edx),%eax
+ 1a6:	3c 20                	cmp    $0x20,%al
+ 1a8:	74 f6                	je     1a0 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 1aa:	3c 2d                	cmp    $0x2d,%al
+ 1ac:	74 1d                	je     1cb <atoi+0x35>
+ 1ae:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1b3:	3c 2b                	cmp    $0x2b,%al
+ 1b5:	0f 94 c1             	sete   %cl
+ 1b8:	3c 2d                	cmp    $0x2d,%al
+ 1ba:	0f 94 c0             	sete   %al
+ 1bd:	08 c1                	or     %al,%cl
+ 1bf:	74 03                	je     1c4 <atoi+0x2e>
+    s++;
+ 1c1:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 1c4:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1c9:	eb 17                	jmp    1e2 <atoi+0x4c>
+ 1cb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1d0:	eb e1                	jmp    1b3 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 1d2:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 1d5:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 1d8:	83 c2 01             	add    $0x1,%edx
+ 1db:	0f be c9             	movsbl %cl,%ecx
+ 1de:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 1e2:	0f b6 0a             	movzbl (%edx),%ecx
+ 1e5:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 1e8:	80 fb 09             	cmp    $0x9,%bl
+ 1eb:	76 e5                	jbe    1d2 <atoi+0x3c>
+  return sign*n;
+ 1ed:	0f af c6             	imul   %esi,%eax
+}
+ 1f0:	5b                   	pop    %ebx
+ 1f1:	5e                   	pop    %esi
+ 1f2:	5d                   	pop    %ebp
+ 1f3:	c3                   	ret
+
+000001f4 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 1f4:	55                   	push   %ebp
+ 1f5:	89 e5                	mov    %esp,%ebp
+ 1f7:	56                   	push   %esi
+ 1f8:	53                   	push   %ebx
+ 1f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1fc:	eb 03                	jmp    201 <atoo+0xd>
+ 1fe:	83 c2 01             	add    $0x1,%edx
+ 201:	0f b6 02             	movzbl (%edx),%eax
+ 204:	3c 20                	cmp    $0x20,%al
+ 206:	74 f6                	je     1fe <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 208:	3c 2d                	cmp    $0x2d,%al
+ 20a:	74 1d                	je     229 <atoo+0x35>
+ 20c:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 211:	3c 2b                	cmp    $0x2b,%al
+ 213:	0f 94 c1             	sete   %cl
+ 216:	3c 2d                	cmp    $0x2d,%al
+ 218:	0f 94 c0             	sete   %al
+ 21b:	08 c1                	or     %al,%cl
+ 21d:	74 03                	je     222 <atoo+0x2e>
+    s++;
+ 21f:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 222:	b8 00 00 00 00       	mov    $0x0,%eax
+ 227:	eb 11                	jmp    23a <atoo+0x46>
+ 229:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 22e:	eb e1                	jmp    211 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 230:	83 c2 01             	add    $0x1,%edx
+ 233:	0f be c9             	movsbl %cl,%ecx
+ 236:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 23a:	0f b6 0a             	movzbl (%edx),%ecx
+ 23d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 240:	80 fb 07             	cmp    $0x7,%bl
+ 243:	76 eb                	jbe    230 <atoo+0x3c>
+  return sign*n;
+ 245:	0f af c6             	imul   %esi,%eax
+}
+ 248:	5b                   	pop    %ebx
+ 249:	5e                   	pop    %esi
+ 24a:	5d                   	pop    %ebp
+ 24b:	c3                   	ret
+
+0000024c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 24c:	55                   	push   %ebp
+ 24d:	89 e5                	mov    %esp,%ebp
+ 24f:	53                   	push   %ebx
+ 250:	8b 55 08             	mov    0x8(%ebp),%edx
+ 253:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 256:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 259:	eb 09                	jmp    264 <strncmp+0x18>
+      n--, p++, q++;
+ 25b:	83 e8 01             	sub    $0x1,%eax
+ 25e:	83 c2 01             	add    $0x1,%edx
+ 261:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 264:	85 c0                	test   %eax,%eax
+ 266:	74 0b                	je     273 <strncmp+0x27>
+ 268:	0f b6 1a             	movzbl (%edx),%ebx
+ 26b:	84 db                	test   %bl,%bl
+ 26d:	74 04                	je     273 <strncmp+0x27>
+ 26f:	3a 19                	cmp    (%ecx),%bl
+ 271:	74 e8                	je     25b <strncmp+0xf>
+    if(n == 0)
+ 273:	85 c0                	test   %eax,%eax
+ 275:	74 0d                	je     284 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 277:	0f b6 02             	movzbl (%edx),%eax
+ 27a:	0f b6 11             	movzbl (%ecx),%edx
+ 27d:	29 d0                	sub    %edx,%eax
+}
+ 27f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 282:	c9                   	leave
+ 283:	c3                   	ret
+      return 0;
+ 284:	b8 00 00 00 00       	mov    $0x0,%eax
+ 289:	eb f4                	jmp    27f <strncmp+0x33>
+
+0000028b <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 28b:	55                   	push   %ebp
+ 28c:	89 e5                	mov    %esp,%ebp
+ 28e:	56                   	push   %esi
+ 28f:	53                   	push   %ebx
+ 290:	8b 75 08             	mov    0x8(%ebp),%esi
+ 293:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 296:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 299:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 29b:	eb 0d                	jmp    2aa <memmove+0x1f>
+    *dst++ = *src++;
+ 29d:	0f b6 01             	movzbl (%ecx),%eax
+ 2a0:	88 02                	mov    %al,(%edx)
+ 2a2:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 2a5:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 2a8:	89 d8                	mov    %ebx,%eax
+ 2aa:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 2ad:	85 c0                	test   %eax,%eax
+ 2af:	7f ec                	jg     29d <memmove+0x12>
+  return vdst;
+}
+ 2b1:	89 f0                	mov    %esi,%eax
+ 2b3:	5b                   	pop    %ebx
+ 2b4:	5e                   	pop    %esi
+ 2b5:	5d                   	pop    %ebp
+ 2b6:	c3                   	ret
+
+000002b7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2b7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2bc:	cd 40                	int    $0x40
+ 2be:	c3                   	ret
+
+000002bf <exit>:
+SYSCALL(exit)
+ 2bf:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c4:	cd 40                	int    $0x40
+ 2c6:	c3                   	ret
+
+000002c7 <wait>:
+SYSCALL(wait)
+ 2c7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2cc:	cd 40                	int    $0x40
+ 2ce:	c3                   	ret
+
+000002cf <pipe>:
+SYSCALL(pipe)
+ 2cf:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d4:	cd 40                	int    $0x40
+ 2d6:	c3                   	ret
+
+000002d7 <read>:
+SYSCALL(read)
+ 2d7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2dc:	cd 40                	int    $0x40
+ 2de:	c3                   	ret
+
+000002df <write>:
+SYSCALL(write)
+ 2df:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e4:	cd 40                	int    $0x40
+ 2e6:	c3                   	ret
+
+000002e7 <close>:
+SYSCALL(close)
+ 2e7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2ec:	cd 40                	int    $0x40
+ 2ee:	c3                   	ret
+
+000002ef <kill>:
+SYSCALL(kill)
+ 2ef:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f4:	cd 40                	int    $0x40
+ 2f6:	c3                   	ret
+
+000002f7 <exec>:
+SYSCALL(exec)
+ 2f7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2fc:	cd 40                	int    $0x40
+ 2fe:	c3                   	ret
+
+000002ff <open>:
+SYSCALL(open)
+ 2ff:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 304:	cd 40                	int    $0x40
+ 306:	c3                   	ret
+
+00000307 <mknod>:
+SYSCALL(mknod)
+ 307:	b8 11 00 00 00       	mov    $0x11,%eax
+ 30c:	cd 40                	int    $0x40
+ 30e:	c3                   	ret
+
+0000030f <unlink>:
+SYSCALL(unlink)
+ 30f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 314:	cd 40                	int    $0x40
+ 316:	c3                   	ret
+
+00000317 <fstat>:
+SYSCALL(fstat)
+ 317:	b8 08 00 00 00       	mov    $0x8,%eax
+ 31c:	cd 40                	int    $0x40
+ 31e:	c3                   	ret
+
+0000031f <link>:
+SYSCALL(link)
+ 31f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 324:	cd 40                	int    $0x40
+ 326:	c3                   	ret
+
+00000327 <mkdir>:
+SYSCALL(mkdir)
+ 327:	b8 14 00 00 00       	mov    $0x14,%eax
+ 32c:	cd 40                	int    $0x40
+ 32e:	c3                   	ret
+
+0000032f <chdir>:
+SYSCALL(chdir)
+ 32f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 334:	cd 40                	int    $0x40
+ 336:	c3                   	ret
+
+00000337 <dup>:
+SYSCALL(dup)
+ 337:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 33c:	cd 40                	int    $0x40
+ 33e:	c3                   	ret
+
+0000033f <getpid>:
+SYSCALL(getpid)
+ 33f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 344:	cd 40                	int    $0x40
+ 346:	c3                   	ret
+
+00000347 <sbrk>:
+SYSCALL(sbrk)
+ 347:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 34c:	cd 40                	int    $0x40
+ 34e:	c3                   	ret
+
+0000034f <sleep>:
+SYSCALL(sleep)
+ 34f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 354:	cd 40                	int    $0x40
+ 356:	c3                   	ret
+
+00000357 <uptime>:
+SYSCALL(uptime)
+ 357:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 35c:	cd 40                	int    $0x40
+ 35e:	c3                   	ret
+
+0000035f <halt>:
+SYSCALL(halt)
+ 35f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 364:	cd 40                	int    $0x40
+ 366:	c3                   	ret
+
+00000367 <date>:
+SYSCALL(date)
+ 367:	b8 17 00 00 00       	mov    $0x17,%eax
+ 36c:	cd 40                	int    $0x40
+ 36e:	c3                   	ret
+
+0000036f <getuid>:
+SYSCALL(getuid)
+ 36f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 374:	cd 40                	int    $0x40
+ 376:	c3                   	ret
+
+00000377 <getgid>:
+SYSCALL(getgid)
+ 377:	b8 19 00 00 00       	mov    $0x19,%eax
+ 37c:	cd 40                	int    $0x40
+ 37e:	c3                   	ret
+
+0000037f <getppid>:
+SYSCALL(getppid)
+ 37f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 384:	cd 40                	int    $0x40
+ 386:	c3                   	ret
+
+00000387 <setuid>:
+SYSCALL(setuid)
+ 387:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 38c:	cd 40                	int    $0x40
+ 38e:	c3                   	ret
+
+0000038f <setgid>:
+SYSCALL(setgid)
+ 38f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 394:	cd 40                	int    $0x40
+ 396:	c3                   	ret
+
+00000397 <getprocs>:
+SYSCALL(getprocs)
+ 397:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 39c:	cd 40                	int    $0x40
+ 39e:	c3                   	ret
+
+0000039f <getpriority>:
+SYSCALL(getpriority)
+ 39f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a4:	cd 40                	int    $0x40
+ 3a6:	c3                   	ret
+
+000003a7 <setpriority>:
+SYSCALL(setpriority)
+ 3a7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3ac:	cd 40                	int    $0x40
+ 3ae:	c3                   	ret
+
+000003af <pipesize>:
+SYSCALL(pipesize)
+ 3af:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b4:	cd 40                	int    $0x40
+ 3b6:	c3                   	ret
+
+000003b7 <splice>:
+SYSCALL(splice)
+ 3b7:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3bf:	55                   	push   %ebp
+ 3c0:	89 e5                	mov    %esp,%ebp
+ 3c2:	83 ec 1c             	sub    $0x1c,%esp
+ 3c5:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3c8:	6a 01                	push   $0x1
+ 3ca:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3cd:	52                   	push   %edx
+ 3ce:	50                   	push   %eax
+ 3cf:	e8 0b ff ff ff       	call   2df <write>
+}
+ 3d4:	83 c4 10             	add    $0x10,%esp
+ 3d7:	c9                   	leave
+ 3d8:	c3                   	ret
+
+000003d9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3d9:	55                   	push   %ebp
+ 3da:	89 e5                	mov    %esp,%ebp
+ 3dc:	57                   	push   %edi
+ 3dd:	56                   	push   %esi
+ 3de:	53                   	push   %ebx
+ 3df:	83 ec 2c             	sub    $0x2c,%esp
+ 3e2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3e5:	89 d0                	mov    %edx,%eax
+ 3e7:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3e9:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3ed:	0f 95 c1             	setne  %cl
+ 3f0:	c1 ea 1f             	shr    $0x1f,%edx
+ 3f3:	84 d1                	test   %dl,%cl
+ 3f5:	74 44                	je     43b <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3f7:	f7 d8                	neg    %eax
+ 3f9:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3fb:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 402:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 407:	89 c8                	mov    %ecx,%eax
+ 409:	ba 00 00 00 00       	mov    $0x0,%edx
+ 40e:	f7 f6                	div    %esi
+ 410:	89 df                	mov    %ebx,%edi
+ 412:	83 c3 01             	add    $0x1,%ebx
+ 415:	0f b6 92 88 07 00 00 	movzbl 0x788(%edx),%edx
+ 41c:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 420:	89 ca                	mov    %ecx,%edx
+ 422:	89 c1                	mov    %eax,%ecx
+ 424:	39 f2                	cmp    %esi,%edx
+ 426:	73 df                	jae    407 <printint+0x2e>
+  if(neg)
+ 428:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 42c:	74 31                	je     45f <printint+0x86>
+    buf[i++] = '-';
+ 42e:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 433:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 436:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 439:	eb 17                	jmp    452 <printint+0x79>
+    x = xx;
+ 43b:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 43d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 444:	eb bc                	jmp    402 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 446:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 44b:	89 f0                	mov    %esi,%eax
+ 44d:	e8 6d ff ff ff       	call   3bf <putc>
+  while(--i >= 0)
+ 452:	83 eb 01             	sub    $0x1,%ebx
+ 455:	79 ef                	jns    446 <printint+0x6d>
+}
+ 457:	83 c4 2c             	add    $0x2c,%esp
+ 45a:	5b                   	pop    %ebx
+ 45b:	5e                   	pop    %esi
+ 45c:	5f                   	pop    %edi
+ 45d:	5d                   	pop    %ebp
+ 45e:	c3                   	ret
+ 45f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 462:	eb ee                	jmp    452 <printint+0x79>
+
+00000464 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 464:	55                   	push   %ebp
+ 465:	89 e5                	mov    %esp,%ebp
+ 467:	57                   	push   %edi
+ 468:	56                   	push   %esi
+ 469:	53                   	push   %ebx
+ 46a:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 46d:	8d 45 10             	lea    0x10(%ebp),%eax
+ 470:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 473:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 478:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 47d:	eb 14                	jmp    493 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 47f:	89 fa                	mov    %edi,%edx
+ 481:	8b 45 08             	mov    0x8(%ebp),%eax
+ 484:	e8 36 ff ff ff       	call   3bf <putc>
+ 489:	eb 05                	jmp    490 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 48b:	83 fe 25             	cmp    $0x25,%esi
+ 48e:	74 25                	je     4b5 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 490:	83 c3 01             	add    $0x1,%ebx
+ 493:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 496:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 49a:	84 c0                	test   %al,%al
+ 49c:	0f 84 20 01 00 00    	je     5c2 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 4a2:	0f be f8             	movsbl %al,%edi
+ 4a5:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 4a8:	85 f6                	test   %esi,%esi
+ 4aa:	75 df                	jne    48b <printf+0x27>
+      if(c == '%'){
+ 4ac:	83 f8 25             	cmp    $0x25,%eax
+ 4af:	75 ce                	jne    47f <printf+0x1b>
+        state = '%';
+ 4b1:	89 c6                	mov    %eax,%esi
+ 4b3:	eb db                	jmp    490 <printf+0x2c>
+      if(c == 'd'){
+ 4b5:	83 f8 25             	cmp    $0x25,%eax
+ 4b8:	0f 84 cf 00 00 00    	je     58d <printf+0x129>
+ 4be:	0f 8c dd 00 00 00    	jl     5a1 <printf+0x13d>
+ 4c4:	83 f8 78             	cmp    $0x78,%eax
+ 4c7:	0f 8f d4 00 00 00    	jg     5a1 <printf+0x13d>
+ 4cd:	83 f8 63             	cmp    $0x63,%eax
+ 4d0:	0f 8c cb 00 00 00    	jl     5a1 <printf+0x13d>
+ 4d6:	83 e8 63             	sub    $0x63,%eax
+ 4d9:	83 f8 15             	cmp    $0x15,%eax
+ 4dc:	0f 87 bf 00 00 00    	ja     5a1 <printf+0x13d>
+ 4e2:	ff 24 85 30 07 00 00 	jmp    *0x730(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4ec:	8b 17                	mov    (%edi),%edx
+ 4ee:	83 ec 0c             	sub    $0xc,%esp
+ 4f1:	6a 01                	push   $0x1
+ 4f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fb:	e8 d9 fe ff ff       	call   3d9 <printint>
+        ap++;
+ 500:	83 c7 04             	add    $0x4,%edi
+ 503:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 506:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 509:	be 00 00 00 00       	mov    $0x0,%esi
+ 50e:	eb 80                	jmp    490 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 510:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 513:	8b 17                	mov    (%edi),%edx
+ 515:	83 ec 0c             	sub    $0xc,%esp
+ 518:	6a 00                	push   $0x0
+ 51a:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 51f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 522:	e8 b2 fe ff ff       	call   3d9 <printint>
+        ap++;
+ 527:	83 c7 04             	add    $0x4,%edi
+ 52a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 52d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 530:	be 00 00 00 00       	mov    $0x0,%esi
+ 535:	e9 56 ff ff ff       	jmp    490 <printf+0x2c>
+        s = (char*)*ap;
+ 53a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 53d:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 53f:	83 c0 04             	add    $0x4,%eax
+ 542:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 545:	85 f6                	test   %esi,%esi
+ 547:	75 15                	jne    55e <printf+0xfa>
+          s = "(null)";
+ 549:	be 28 07 00 00       	mov    $0x728,%esi
+ 54e:	eb 0e                	jmp    55e <printf+0xfa>
+          putc(fd, *s);
+ 550:	0f be d2             	movsbl %dl,%edx
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	e8 64 fe ff ff       	call   3bf <putc>
+          s++;
+ 55b:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 55e:	0f b6 16             	movzbl (%esi),%edx
+ 561:	84 d2                	test   %dl,%dl
+ 563:	75 eb                	jne    550 <printf+0xec>
+      state = 0;
+ 565:	be 00 00 00 00       	mov    $0x0,%esi
+ 56a:	e9 21 ff ff ff       	jmp    490 <printf+0x2c>
+        putc(fd, *ap);
+ 56f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 572:	0f be 17             	movsbl (%edi),%edx
+ 575:	8b 45 08             	mov    0x8(%ebp),%eax
+ 578:	e8 42 fe ff ff       	call   3bf <putc>
+        ap++;
+ 57d:	83 c7 04             	add    $0x4,%edi
+ 580:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 583:	be 00 00 00 00       	mov    $0x0,%esi
+ 588:	e9 03 ff ff ff       	jmp    490 <printf+0x2c>
+        putc(fd, c);
+ 58d:	89 fa                	mov    %edi,%edx
+ 58f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 592:	e8 28 fe ff ff       	call   3bf <putc>
+      state = 0;
+ 597:	be 00 00 00 00       	mov    $0x0,%esi
+ 59c:	e9 ef fe ff ff       	jmp    490 <printf+0x2c>
+        putc(fd, '%');
+ 5a1:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a9:	e8 11 fe ff ff       	call   3bf <putc>
+        putc(fd, c);
+ 5ae:	89 fa                	mov    %edi,%edx
+ 5b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b3:	e8 07 fe ff ff       	call   3bf <putc>
+      state = 0;
+ 5b8:	be 00 00 00 00       	mov    $0x0,%esi
+ 5bd:	e9 ce fe ff ff       	jmp    490 <printf+0x2c>
+    }
+  }
+}
+ 5c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c5:	5b                   	pop    %ebx
+ 5c6:	5e                   	pop    %esi
+ 5c7:	5f                   	pop    %edi
+ 5c8:	5d                   	pop    %ebp
+ 5c9:	c3                   	ret
+
+000005ca <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5ca:	55                   	push   %ebp
+ 5cb:	89 e5                	mov    %esp,%ebp
+ 5cd:	57                   	push   %edi
+ 5ce:	56                   	push   %esi
+ 5cf:	53                   	push   %ebx
+ 5d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5d3:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5d6:	a1 88 0a 00 00       	mov    0xa88,%eax
+ 5db:	eb 02                	jmp    5df <free+0x15>
+ 5dd:	89 d0                	mov    %edx,%eax
+ 5df:	39 c8                	cmp    %ecx,%eax
+ 5e1:	73 04                	jae    5e7 <free+0x1d>
+ 5e3:	3b 08                	cmp    (%eax),%ecx
+ 5e5:	72 12                	jb     5f9 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5e7:	8b 10                	mov    (%eax),%edx
+ 5e9:	39 d0                	cmp    %edx,%eax
+ 5eb:	72 f0                	jb     5dd <free+0x13>
+ 5ed:	39 c8                	cmp    %ecx,%eax
+ 5ef:	72 08                	jb     5f9 <free+0x2f>
+ 5f1:	39 d1                	cmp    %edx,%ecx
+ 5f3:	72 04                	jb     5f9 <free+0x2f>
+ 5f5:	89 d0                	mov    %edx,%eax
+ 5f7:	eb e6                	jmp    5df <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5f9:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5fc:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5ff:	8b 10                	mov    (%eax),%edx
+ 601:	39 d7                	cmp    %edx,%edi
+ 603:	74 19                	je     61e <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 605:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 608:	8b 50 04             	mov    0x4(%eax),%edx
+ 60b:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 60e:	39 ce                	cmp    %ecx,%esi
+ 610:	74 1b                	je     62d <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 612:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 614:	a3 88 0a 00 00       	mov    %eax,0xa88
+}
+ 619:	5b                   	pop    %ebx
+ 61a:	5e                   	pop    %esi
+ 61b:	5f                   	pop    %edi
+ 61c:	5d                   	pop    %ebp
+ 61d:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 61e:	03 72 04             	add    0x4(%edx),%esi
+ 621:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 624:	8b 10                	mov    (%eax),%edx
+ 626:	8b 12                	mov    (%edx),%edx
+ 628:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 62b:	eb db                	jmp    608 <free+0x3e>
+    p->s.size += bp->s.size;
+ 62d:	03 53 fc             	add    -0x4(%ebx),%edx
+ 630:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 633:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 636:	89 10                	mov    %edx,(%eax)
+ 638:	eb da                	jmp    614 <free+0x4a>
+
+0000063a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 63a:	55                   	push   %ebp
+ 63b:	89 e5                	mov    %esp,%ebp
+ 63d:	53                   	push   %ebx
+ 63e:	83 ec 04             	sub    $0x4,%esp
+ 641:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 643:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 648:	77 05                	ja     64f <morecore+0x15>
+    nu = 4096;
+ 64a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 64f:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 656:	83 ec 0c             	sub    $0xc,%esp
+ 659:	50                   	push   %eax
+ 65a:	e8 e8 fc ff ff       	call   347 <sbrk>
+  if(p == (char*)-1)
+ 65f:	83 c4 10             	add    $0x10,%esp
+ 662:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 665:	74 1c                	je     683 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 667:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 66a:	83 c0 08             	add    $0x8,%eax
+ 66d:	83 ec 0c             	sub    $0xc,%esp
+ 670:	50                   	push   %eax
+ 671:	e8 54 ff ff ff       	call   5ca <free>
+  return freep;
+ 676:	a1 88 0a 00 00       	mov    0xa88,%eax
+ 67b:	83 c4 10             	add    $0x10,%esp
+}
+ 67e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 681:	c9                   	leave
+ 682:	c3                   	ret
+    return 0;
+ 683:	b8 00 00 00 00       	mov    $0x0,%eax
+ 688:	eb f4                	jmp    67e <morecore+0x44>
+
+0000068a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 68a:	55                   	push   %ebp
+ 68b:	89 e5                	mov    %esp,%ebp
+ 68d:	53                   	push   %ebx
+ 68e:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 691:	8b 45 08             	mov    0x8(%ebp),%eax
+ 694:	8d 58 07             	lea    0x7(%eax),%ebx
+ 697:	c1 eb 03             	shr    $0x3,%ebx
+ 69a:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 69d:	8b 0d 88 0a 00 00    	mov    0xa88,%ecx
+ 6a3:	85 c9                	test   %ecx,%ecx
+ 6a5:	74 04                	je     6ab <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6a7:	8b 01                	mov    (%ecx),%eax
+ 6a9:	eb 4a                	jmp    6f5 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 6ab:	c7 05 88 0a 00 00 8c 	movl   $0xa8c,0xa88
+ 6b2:	0a 00 00 
+ 6b5:	c7 05 8c 0a 00 00 8c 	movl   $0xa8c,0xa8c
+ 6bc:	0a 00 00 
+    base.s.size = 0;
+ 6bf:	c7 05 90 0a 00 00 00 	movl   $0x0,0xa90
+ 6c6:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 6c9:	b9 8c 0a 00 00       	mov    $0xa8c,%ecx
+ 6ce:	eb d7                	jmp    6a7 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 6d0:	74 19                	je     6eb <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6d2:	29 da                	sub    %ebx,%edx
+ 6d4:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 6d7:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 6da:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6dd:	89 0d 88 0a 00 00    	mov    %ecx,0xa88
+      return (void*)(p + 1);
+ 6e3:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6e9:	c9                   	leave
+ 6ea:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6eb:	8b 10                	mov    (%eax),%edx
+ 6ed:	89 11                	mov    %edx,(%ecx)
+ 6ef:	eb ec                	jmp    6dd <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6f1:	89 c1                	mov    %eax,%ecx
+ 6f3:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 6f5:	8b 50 04             	mov    0x4(%eax),%edx
+ 6f8:	39 da                	cmp    %ebx,%edx
+ 6fa:	73 d4                	jae    6d0 <malloc+0x46>
+    if(p == freep)
+ 6fc:	39 05 88 0a 00 00    	cmp    %eax,0xa88
+ 702:	75 ed                	jne    6f1 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 704:	89 d8                	mov    %ebx,%eax
+ 706:	e8 2f ff ff ff       	call   63a <morecore>
+ 70b:	85 c0                	test   %eax,%eax
+ 70d:	75 e2                	jne    6f1 <malloc+0x67>
+ 70f:	eb d5                	jmp    6e6 <malloc+0x5c>
@@ -80,10 +80,19 @@ initProcessLists()
     ptable.list[i].head = NULL;
     ptable.list[i].tail = NULL;
   }
+  for (i = 0; i < NSLEEPQ; i++) {
+    ptable.sleepq[i].head = NULL;
+    ptable.sleepq[i].tail = NULL;
+  }
 #ifdef CS333_P4
-  for (i = 0; i <= MAXPRIO; i++) {
-    ptable.ready[i].head = NULL;
-    ptable.ready[i].tail = NULL;
+  struct runq *q;
+
+  for (q = runq; q < &runq[NCPU]; q++) {
+    for (i = 0; i <= MAXPRIO; i++) {
+      q->ready[i].head = NULL;
+      q->ready[i].tail = NULL;
+    }
+    q->count = 0;
   }
 #endif
 }
@@ -93,8 +102,9 @@ initFreeList(void)
 {
   struct proc* p;
 
-  for(p = ptable.proc; p < ptable.proc + NPROC; ++p){
+  for(p = ptable.all; p; p = p->allnext){
     p->state = UNUSED;
+    p->list = NULL;
     stateListAdd(&ptable.list[UNUSED], p);
   }
 }
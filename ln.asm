@@ -0,0 +1,1176 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  12:	83 39 03             	cmpl   $0x3,(%ecx)
+  15:	74 14                	je     2b <main+0x2b>
+    printf(2, "Usage: ln old new\n");
+  17:	83 ec 08             	sub    $0x8,%esp
+  1a:	68 14 07 00 00       	push   $0x714
+  1f:	6a 02                	push   $0x2
+  21:	e8 3f 04 00 00       	call   465 <printf>
+    exit();
+  26:	e8 95 02 00 00       	call   2c0 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2b:	83 ec 08             	sub    $0x8,%esp
+  2e:	ff 73 08             	push   0x8(%ebx)
+  31:	ff 73 04             	push   0x4(%ebx)
+  34:	e8 e7 02 00 00       	call   320 <link>
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	85 c0                	test   %eax,%eax
+  3e:	78 05                	js     45 <main+0x45>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  40:	e8 7b 02 00 00       	call   2c0 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  45:	ff 73 08             	push   0x8(%ebx)
+  48:	ff 73 04             	push   0x4(%ebx)
+  4b:	68 27 07 00 00       	push   $0x727
+  50:	6a 02                	push   $0x2
+  52:	e8 0e 04 00 00       	call   465 <printf>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	eb e4                	jmp    40 <main+0x40>
+
+0000005c <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  5c:	55                   	push   %ebp
+  5d:	89 e5                	mov    %esp,%ebp
+  5f:	56                   	push   %esi
+  60:	53                   	push   %ebx
+  61:	8b 75 08             	mov    0x8(%ebp),%esi
+  64:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  67:	89 f0                	mov    %esi,%eax
+  69:	89 d1                	mov    %edx,%ecx
+  6b:	83 c2 01             	add    $0x1,%edx
+  6e:	89 c3                	mov    %eax,%ebx
+  70:	83 c0 01             	add    $0x1,%eax
+  73:	0f b6 09             	movzbl (%ecx),%ecx
+  76:	88 0b                	mov    %cl,(%ebx)
+  78:	84 c9                	test   %cl,%cl
+  7a:	75 ed                	jne    69 <strcpy+0xd>
+    ;
+  return os;
+}
+  7c:	89 f0                	mov    %esi,%eax
+  7e:	5b                   	pop    %ebx
+  7f:	5e                   	pop    %esi
+  80:	5d                   	pop    %ebp
+  81:	c3                   	ret
+
+00000082 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  82:	55                   	push   %ebp
+  83:	89 e5                	mov    %esp,%ebp
+  85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  88:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  8b:	eb 06                	jmp    93 <strcmp+0x11>
+    p++, q++;
+  8d:	83 c1 01             	add    $0x1,%ecx
+  90:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  93:	0f b6 01             	movzbl (%ecx),%eax
+  96:	84 c0                	test   %al,%al
+  98:	74 04                	je     9e <strcmp+0x1c>
+  9a:	3a 02                	cmp    (%edx),%al
+  9c:	74 ef                	je     8d <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+  9e:	0f b6 c0             	movzbl %al,%eax
+  a1:	0f b6 12             	movzbl (%edx),%edx
+  a4:	29 d0                	sub    %edx,%eax
+}
+  a6:	5d                   	pop    %ebp
+  a7:	c3                   	ret
+
+000000a8 <strlen>:
+
+uint
+strlen(char *s)
+{
+  a8:	55                   	push   %ebp
+  a9:	89 e5                	mov    %esp,%ebp
+  ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  b3:	eb 03                	jmp    b8 <strlen+0x10>
+  b5:	83 c0 01             	add    $0x1,%eax
+  b8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  bc:	75 f7                	jne    b5 <strlen+0xd>
+    ;
+  return n;
+}
+  be:	5d                   	pop    %ebp
+  bf:	c3                   	ret
+
+000000c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  c7:	89 d7                	mov    %edx,%edi
+  c9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  cf:	fc                   	cld
+  d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  d2:	89 d0                	mov    %edx,%eax
+  d4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  d7:	c9                   	leave
+  d8:	c3                   	ret
+
+000000d9 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  d9:	55                   	push   %ebp
+  da:	89 e5                	mov    %esp,%ebp
+  dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  df:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  e3:	eb 03                	jmp    e8 <strchr+0xf>
+  e5:	83 c0 01             	add    $0x1,%eax
+  e8:	0f b6 10             	movzbl (%eax),%edx
+  eb:	84 d2                	test   %dl,%dl
+  ed:	74 06                	je     f5 <strchr+0x1c>
+    if(*s == c)
+  ef:	38 ca                	cmp    %cl,%dl
+  f1:	75 f2                	jne    e5 <strchr+0xc>
+  f3:	eb 05                	jmp    fa <strchr+0x21>
+      return (char*)s;
+  return 0;
+  f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  fa:	5d                   	pop    %ebp
+  fb:	c3                   	ret
+
+000000fc <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  fc:	55                   	push   %ebp
+  fd:	89 e5                	mov    %esp,%ebp
+  ff:	57                   	push   %edi
+ 100:	56                   	push   %esi
+ 101:	53                   	push   %ebx
+ 102:	83 ec 1c             	sub    $0x1c,%esp
+ 105:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 108:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 10d:	89 de                	mov    %ebx,%esi
+ 10f:	83 c3 01             	add    $0x1,%ebx
+ 112:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 115:	7d 2e                	jge    145 <gets+0x49>
+    cc = read(0, &c, 1);
+ 117:	83 ec 04             	sub    $0x4,%esp
+ 11a:	6a 01                	push   $0x1
+ 11c:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 11f:	50                   	push   %eax
+ 120:	6a 00                	push   $0x0
+ 122:	e8 b1 01 00 00       	call   2d8 <read>
+    if(cc < 1)
+ 127:	83 c4 10             	add    $0x10,%esp
+ 12a:	85 c0                	test   %eax,%eax
+ 12c:	7e 17                	jle    145 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 12e:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 132:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 135:	3c 0a                	cmp    $0xa,%al
+ 137:	0f 94 c2             	sete   %dl
+ 13a:	3c 0d                	cmp    $0xd,%al
+ 13c:	0f 94 c0             	sete   %al
+ 13f:	08 c2                	or     %al,%dl
+ 141:	74 ca                	je     10d <gets+0x11>
+    buf[i++] = c;
+ 143:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 145:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 149:	89 f8                	mov    %edi,%eax
+ 14b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 14e:	5b                   	pop    %ebx
+ 14f:	5e                   	pop    %esi
+ 150:	5f                   	pop    %edi
+ 151:	5d                   	pop    %ebp
+ 152:	c3                   	ret
+
+00000153 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 153:	55                   	push   %ebp
+ 154:	89 e5                	mov    %esp,%ebp
+ 156:	56                   	push   %esi
+ 157:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 158:	83 ec 08             	sub    $0x8,%esp
+ 15b:	6a 00                	push   $0x0
+ 15d:	ff 75 08             	push   0x8(%ebp)
+ 160:	e8 9b 01 00 00       	call   300 <open>
+  if(fd < 0)
+ 165:	83 c4 10             	add    $0x10,%esp
+ 168:	85 c0                	test   %eax,%eax
+ 16a:	78 24                	js     190 <stat+0x3d>
+ 16c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 16e:	83 ec 08             	sub    $0x8,%esp
+ 171:	ff 75 0c             	push   0xc(%ebp)
+ 174:	50                   	push   %eax
+ 175:	e8 9e 01 00 00       	call   318 <fstat>
+ 17a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 17c:	89 1c 24             	mov    %ebx,(%esp)
+ 17f:	e8 64 01 00 00       	call   2e8 <close>
+  return r;
+ 184:	83 c4 10             	add    $0x10,%esp
+}
+ 187:	89 f0                	mov    %esi,%eax
+ 189:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 18c:	5b                   	pop    %ebx
+ 18d:	5e                   	pop    %esi
+ 18e:	5d                   	pop    %ebp
+ 18f:	c3                   	ret
+    return -1;
+ 190:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 195:	eb f0                	jmp    187 <stat+0x34>
+
+00000197 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 197:	55                   	push   %ebp
+ 198:	89 e5                	mov    %esp,%ebp
+ 19a:	56                   	push   %esi
+ 19b:	53                   	push   %ebx
+ 19c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 19f:	eb 03                	jmp    1a4 <atoi+0xd>
+ 1a1:	83 c2 01             	add    $0x1,%edx
+ 1a4:	0f b6 02             	movzbl (%edx),%eax
+ 1a7:	3c 20                	cmp    $0x20,%al
+ 1a9:	74 f6                	je     1a1 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 1ab:	3c 2d                	cmp    $0x2d,%al
+ 1ad:	74 1d                	je     1cc <atoi+0x35>
+ 1af:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1b4:	3c 2b                	cmp    $0x2b,%al
+ 1b6:	0f 94 c1             	sete   %cl
+ 1b9:	3c 2d                	cmp    $0x2d,%al
+ 1bb:	0f 94 c0             	sete   %al
+ 1be:	08 c1                	or     %al,%cl
+ 1c0:	74 03                	je     1c5 <atoi+0x2e>
+    s++;
+ 1c2:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 1c5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1ca:	eb 17                	jmp    1e3 <atoi+0x4c>
+ 1cc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1d1:	eb e1                	jmp    1b4 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 1d3:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 1d6:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 1d9:	83 c2 01             	add    $0x1,%edx
+ 1dc:	0f be c9             	movsbl %cl,%ecx
+ 1df:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 1e3:	0f b6 0a             	movzbl (%edx),%ecx
+ 1e6:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 1e9:	80 fb 09             	cmp    $0x9,%bl
+ 1ec:	76 e5                	jbe    1d3 <atoi+0x3c>
+  return sign*n;
+ 1ee:	0f af c6             	imul   %esi,%eax
+}
+ 1f1:	5b                   	pop    %ebx
+ 1f2:	5e                   	pop    %esi
+ 1f3:	5d                   	pop    %ebp
+ 1f4:	c3                   	ret
+
+000001f5 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 1f5:	55                   	push   %ebp
+ 1f6:	89 e5                	mov    %esp,%ebp
+ 1f8:	56                   	push   %esi
+ 1f9:	53                   	push   %ebx
+ 1fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1fd:	eb 03                	jmp    202 <atoo+0xd>
+ 1ff:	83 c2 01             	add    $0x1,%edx
+ 202:	0f b6 02             	movzbl (%edx),%eax
+ 205:	3c 20                	cmp    $0x20,%al
+ 207:	74 f6                	je     1ff <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 209:	3c 2d                	cmp    $0x2d,%al
+ 20b:	74 1d                	je     22a <atoo+0x35>
+ 20d:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 212:	3c 2b                	cmp    $0x2b,%al
+ 214:	0f 94 c1             	sete   %cl
+ 217:	3c 2d                	cmp    $0x2d,%al
+ 219:	0f 94 c0             	sete   %al
+ 21c:	08 c1                	or     %al,%cl
+ 21e:	74 03                	je     223 <atoo+0x2e>
+    s++;
+ 220:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 223:	b8 00 00 00 00       	mov    $0x0,%eax
+ 228:	eb 11                	jmp    23b <atoo+0x46>
+ 22a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 22f:	eb e1                	jmp    212 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 231:	83 c2 01             	add    $0x1,%edx
+ 234:	0f be c9             	movsbl %cl,%ecx
+ 237:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 23b:	0f b6 0a             	movzbl (%edx),%ecx
+ 23e:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 241:	80 fb 07             	cmp    $0x7,%bl
+ 244:	76 eb                	jbe    231 <atoo+0x3c>
+  return sign*n;
+ 246:	0f af c6             	imul   %esi,%eax
+}
+ 249:	5b                   	pop    %ebx
+ 24a:	5e                   	pop    %esi
+ 24b:	5d                   	pop    %ebp
+ 24c:	c3                   	ret
+
+0000024d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 24d:	55                   	push   %ebp
+ 24e:	89 e5                	mov    %esp,%ebp
+ 250:	53                   	push   %ebx
+ 251:	8b 55 08             	mov    0x8(%ebp),%edx
+ 254:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 257:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 25a:	eb 09                	jmp    265 <strncmp+0x18>
+      n--, p++, q++;
+ 25c:	83 e8 01             	sub    $0x1,%eax
+ 25f:	83 c2 01             	add    $0x1,%edx
+ 262:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 265:	85 c0                	test   %eax,%eax
+ 267:	74 0b                	je     274 <strncmp+0x27>
+ 269:	0f b6 1a             	movzbl (%edx),%ebx
+ 26c:	84 db                	test   %bl,%bl
+ 26e:	74 04                	je     274 <strncmp+0x27>
+ 270:	3a 19                	cmp    (%ecx),%bl
+ 272:	74 e8                	je     25c <strncmp+0xf>
+    if(n == 0)
+ 274:	85 c0                	test   %eax,%eax
+ 276:	74 0d                	je     285 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 278:	0f b6 02             	movzbl (%edx),%eax
+ 27b:	0f b6 11             	movzbl (%ecx),%edx
+ 27e:	29 d0                	sub    %edx,%eax
+}
+ 280:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 283:	c9                   	leave
+ 284:	c3                   	ret
+      return 0;
+ 285:	b8 00 00 00 00       	mov    $0x0,%eax
+ 28a:	eb f4                	jmp    280 <strncmp+0x33>
+
+0000028c <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 28c:	55                   	push   %ebp
+ 28d:	89 e5                	mov    %esp,%ebp
+ 28f:	56                   	push   %esi
+ 290:	53                   	push   %ebx
+ 291:	8b 75 08             	mov    0x8(%ebp),%esi
+ 294:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 297:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 29a:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 29c:	eb 0d                	jmp    2ab <memmove+0x1f>
+    *dst++ = *src++;
+ 29e:	0f b6 01             	movzbl (%ecx),%eax
+ 2a1:	88 02                	mov    %al,(%edx)
+ 2a3:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 2a6:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 2a9:	89 d8                	mov    %ebx,%eax
+ 2ab:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 2ae:	85 c0                	test   %eax,%eax
+ 2b0:	7f ec                	jg     29e <memmove+0x12>
+  return vdst;
+}
+ 2b2:	89 f0                	mov    %esi,%eax
+ 2b4:	5b                   	pop    %ebx
+ 2b5:	5e                   	pop    %esi
+ 2b6:	5d                   	pop    %ebp
+ 2b7:	c3                   	ret
+
+000002b8 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2b8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2bd:	cd 40                	int    $0x40
+ 2bf:	c3                   	ret
+
+000002c0 <exit>:
+SYSCALL(exit)
+ 2c0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c5:	cd 40                	int    $0x40
+ 2c7:	c3                   	ret
+
+000002c8 <wait>:
+SYSCALL(wait)
+ 2c8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2cd:	cd 40                	int    $0x40
+ 2cf:	c3                   	ret
+
+000002d0 <pipe>:
+SYSCALL(pipe)
+ 2d0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d5:	cd 40                	int    $0x40
+ 2d7:	c3                   	ret
+
+000002d8 <read>:
+SYSCALL(read)
+ 2d8:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2dd:	cd 40                	int    $0x40
+ 2df:	c3                   	ret
+
+000002e0 <write>:
+SYSCALL(write)
+ 2e0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e5:	cd 40                	int    $0x40
+ 2e7:	c3                   	ret
+
+000002e8 <close>:
+SYSCALL(close)
+ 2e8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2ed:	cd 40                	int    $0x40
+ 2ef:	c3                   	ret
+
+000002f0 <kill>:
+SYSCALL(kill)
+ 2f0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f5:	cd 40                	int    $0x40
+ 2f7:	c3                   	ret
+
+000002f8 <exec>:
+SYSCALL(exec)
+ 2f8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2fd:	cd 40                	int    $0x40
+ 2ff:	c3                   	ret
+
+00000300 <open>:
+SYSCALL(open)
+ 300:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 305:	cd 40                	int    $0x40
+ 307:	c3                   	ret
+
+00000308 <mknod>:
+SYSCALL(mknod)
+ 308:	b8 11 00 00 00       	mov    $0x11,%eax
+ 30d:	cd 40                	int    $0x40
+ 30f:	c3                   	ret
+
+00000310 <unlink>:
+SYSCALL(unlink)
+ 310:	b8 12 00 00 00       	mov    $0x12,%eax
+ 315:	cd 40                	int    $0x40
+ 317:	c3                   	ret
+
+00000318 <fstat>:
+SYSCALL(fstat)
+ 318:	b8 08 00 00 00       	mov    $0x8,%eax
+ 31d:	cd 40                	int    $0x40
+ 31f:	c3                   	ret
+
+00000320 <link>:
+SYSCALL(link)
+ 320:	b8 13 00 00 00       	mov    $0x13,%eax
+ 325:	cd 40                	int    $0x40
+ 327:	c3                   	ret
+
+00000328 <mkdir>:
+SYSCALL(mkdir)
+ 328:	b8 14 00 00 00       	mov    $0x14,%eax
+ 32d:	cd 40                	int    $0x40
+ 32f:	c3                   	ret
+
+00000330 <chdir>:
+SYSCALL(chdir)
+ 330:	b8 09 00 00 00       	mov    $0x9,%eax
+ 335:	cd 40                	int    $0x40
+ 337:	c3                   	ret
+
+00000338 <dup>:
+SYSCALL(dup)
+ 338:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <getpid>:
+SYSCALL(getpid)
+ 340:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <sbrk>:
+SYSCALL(sbrk)
+ 348:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <sleep>:
+SYSCALL(sleep)
+ 350:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <uptime>:
+SYSCALL(uptime)
+ 358:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <halt>:
+SYSCALL(halt)
+ 360:	b8 16 00 00 00       	mov    $0x16,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <date>:
+SYSCALL(date)
+ 368:	b8 17 00 00 00       	mov    $0x17,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <getuid>:
+SYSCALL(getuid)
+ 370:	b8 18 00 00 00       	mov    $0x18,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <getgid>:
+SYSCALL(getgid)
+ 378:	b8 19 00 00 00       	mov    $0x19,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <getppid>:
+SYSCALL(getppid)
+ 380:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <setuid>:
+SYSCALL(setuid)
+ 388:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <setgid>:
+SYSCALL(setgid)
+ 390:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <getprocs>:
+SYSCALL(getprocs)
+ 398:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <getpriority>:
+SYSCALL(getpriority)
+ 3a0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <setpriority>:
+SYSCALL(setpriority)
+ 3a8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <pipesize>:
+SYSCALL(pipesize)
+ 3b0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <splice>:
+SYSCALL(splice)
+ 3b8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	83 ec 1c             	sub    $0x1c,%esp
+ 3c6:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3c9:	6a 01                	push   $0x1
+ 3cb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3ce:	52                   	push   %edx
+ 3cf:	50                   	push   %eax
+ 3d0:	e8 0b ff ff ff       	call   2e0 <write>
+}
+ 3d5:	83 c4 10             	add    $0x10,%esp
+ 3d8:	c9                   	leave
+ 3d9:	c3                   	ret
+
+000003da <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3da:	55                   	push   %ebp
+ 3db:	89 e5                	mov    %esp,%ebp
+ 3dd:	57                   	push   %edi
+ 3de:	56                   	push   %esi
+ 3df:	53                   	push   %ebx
+ 3e0:	83 ec 2c             	sub    $0x2c,%esp
+ 3e3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3e6:	89 d0                	mov    %edx,%eax
+ 3e8:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3ea:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3ee:	0f 95 c1             	setne  %cl
+ 3f1:	c1 ea 1f             	shr    $0x1f,%edx
+ 3f4:	84 d1                	test   %dl,%cl
+ 3f6:	74 44                	je     43c <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3f8:	f7 d8                	neg    %eax
+ 3fa:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3fc:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 403:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 408:	89 c8                	mov    %ecx,%eax
+ 40a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 40f:	f7 f6                	div    %esi
+ 411:	89 df                	mov    %ebx,%edi
+ 413:	83 c3 01             	add    $0x1,%ebx
+ 416:	0f b6 92 9c 07 00 00 	movzbl 0x79c(%edx),%edx
+ 41d:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 421:	89 ca                	mov    %ecx,%edx
+ 423:	89 c1                	mov    %eax,%ecx
+ 425:	39 f2                	cmp    %esi,%edx
+ 427:	73 df                	jae    408 <printint+0x2e>
+  if(neg)
+ 429:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 42d:	74 31                	je     460 <printint+0x86>
+    buf[i++] = '-';
+ 42f:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 434:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 437:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 43a:	eb 17                	jmp    453 <printint+0x79>
+    x = xx;
+ 43c:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 43e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 445:	eb bc                	jmp    403 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 447:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 44c:	89 f0                	mov    %esi,%eax
+ 44e:	e8 6d ff ff ff       	call   3c0 <putc>
+  while(--i >= 0)
+ 453:	83 eb 01             	sub    $0x1,%ebx
+ 456:	79 ef                	jns    447 <printint+0x6d>
+}
+ 458:	83 c4 2c             	add    $0x2c,%esp
+ 45b:	5b                   	pop    %ebx
+ 45c:	5e                   	pop    %esi
+ 45d:	5f                   	pop    %edi
+ 45e:	5d                   	pop    %ebp
+ 45f:	c3                   	ret
+ 460:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 463:	eb ee                	jmp    453 <printint+0x79>
+
+00000465 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 465:	55                   	push   %ebp
+ 466:	89 e5                	mov    %esp,%ebp
+ 468:	57                   	push   %edi
+ 469:	56                   	push   %esi
+ 46a:	53                   	push   %ebx
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 46e:	8d 45 10             	lea    0x10(%ebp),%eax
+ 471:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 474:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 479:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 47e:	eb 14                	jmp    494 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 480:	89 fa                	mov    %edi,%edx
+ 482:	8b 45 08             	mov    0x8(%ebp),%eax
+ 485:	e8 36 ff ff ff       	call   3c0 <putc>
+ 48a:	eb 05                	jmp    491 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 48c:	83 fe 25             	cmp    $0x25,%esi
+ 48f:	74 25                	je     4b6 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 491:	83 c3 01             	add    $0x1,%ebx
+ 494:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 497:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 49b:	84 c0                	test   %al,%al
+ 49d:	0f 84 20 01 00 00    	je     5c3 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 4a3:	0f be f8             	movsbl %al,%edi
+ 4a6:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 4a9:	85 f6                	test   %esi,%esi
+ 4ab:	75 df                	jne    48c <printf+0x27>
+      if(c == '%'){
+ 4ad:	83 f8 25             	cmp    $0x25,%eax
+ 4b0:	75 ce                	jne    480 <printf+0x1b>
+        state = '%';
+ 4b2:	89 c6                	mov    %eax,%esi
+ 4b4:	eb db                	jmp    491 <printf+0x2c>
+      if(c == 'd'){
+ 4b6:	83 f8 25             	cmp    $0x25,%eax
+ 4b9:	0f 84 cf 00 00 00    	je     58e <printf+0x129>
+ 4bf:	0f 8c dd 00 00 00    	jl     5a2 <printf+0x13d>
+ 4c5:	83 f8 78             	cmp    $0x78,%eax
+ 4c8:	0f 8f d4 00 00 00    	jg     5a2 <printf+0x13d>
+ 4ce:	83 f8 63             	cmp    $0x63,%eax
+ 4d1:	0f 8c cb 00 00 00    	jl     5a2 <printf+0x13d>
+ 4d7:	83 e8 63             	sub    $0x63,%eax
+ 4da:	83 f8 15             	cmp    $0x15,%eax
+ 4dd:	0f 87 bf 00 00 00    	ja     5a2 <printf+0x13d>
+ 4e3:	ff 24 85 44 07 00 00 	jmp    *0x744(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4ed:	8b 17                	mov    (%edi),%edx
+ 4ef:	83 ec 0c             	sub    $0xc,%esp
+ 4f2:	6a 01                	push   $0x1
+ 4f4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fc:	e8 d9 fe ff ff       	call   3da <printint>
+        ap++;
+ 501:	83 c7 04             	add    $0x4,%edi
+ 504:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 507:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 50a:	be 00 00 00 00       	mov    $0x0,%esi
+ 50f:	eb 80                	jmp    491 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 511:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 514:	8b 17                	mov    (%edi),%edx
+ 516:	83 ec 0c             	sub    $0xc,%esp
+ 519:	6a 00                	push   $0x0
+ 51b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 520:	8b 45 08             	mov    0x8(%ebp),%eax
+ 523:	e8 b2 fe ff ff       	call   3da <printint>
+        ap++;
+ 528:	83 c7 04             	add    $0x4,%edi
+ 52b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 52e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 531:	be 00 00 00 00       	mov    $0x0,%esi
+ 536:	e9 56 ff ff ff       	jmp    491 <printf+0x2c>
+        s = (char*)*ap;
+ 53b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 53e:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 540:	83 c0 04             	add    $0x4,%eax
+ 543:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 546:	85 f6                	test   %esi,%esi
+ 548:	75 15                	jne    55f <printf+0xfa>
+          s = "(null)";
+ 54a:	be 3b 07 00 00       	mov    $0x73b,%esi
+ 54f:	eb 0e                	jmp    55f <printf+0xfa>
+          putc(fd, *s);
+ 551:	0f be d2             	movsbl %dl,%edx
+ 554:	8b 45 08             	mov    0x8(%ebp),%eax
+ 557:	e8 64 fe ff ff       	call   3c0 <putc>
+          s++;
+ 55c:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 55f:	0f b6 16             	movzbl (%esi),%edx
+ 562:	84 d2                	test   %dl,%dl
+ 564:	75 eb                	jne    551 <printf+0xec>
+      state = 0;
+ 566:	be 00 00 00 00       	mov    $0x0,%esi
+ 56b:	e9 21 ff ff ff       	jmp    491 <printf+0x2c>
+        putc(fd, *ap);
+ 570:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 573:	0f be 17             	movsbl (%edi),%edx
+ 576:	8b 45 08             	mov    0x8(%ebp),%eax
+ 579:	e8 42 fe ff ff       	call   3c0 <putc>
+        ap++;
+ 57e:	83 c7 04             	add    $0x4,%edi
+ 581:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 584:	be 00 00 00 00       	mov    $0x0,%esi
+ 589:	e9 03 ff ff ff       	jmp    491 <printf+0x2c>
+        putc(fd, c);
+ 58e:	89 fa                	mov    %edi,%edx
+ 590:	8b 45 08             	mov    0x8(%ebp),%eax
+ 593:	e8 28 fe ff ff       	call   3c0 <putc>
+      state = 0;
+ 598:	be 00 00 00 00       	mov    $0x0,%esi
+ 59d:	e9 ef fe ff ff       	jmp    491 <printf+0x2c>
+        putc(fd, '%');
+ 5a2:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5aa:	e8 11 fe ff ff       	call   3c0 <putc>
+        putc(fd, c);
+ 5af:	89 fa                	mov    %edi,%edx
+ 5b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b4:	e8 07 fe ff ff       	call   3c0 <putc>
+      state = 0;
+ 5b9:	be 00 00 00 00       	mov    $0x0,%esi
+ 5be:	e9 ce fe ff ff       	jmp    491 <printf+0x2c>
+    }
+  }
+}
+ 5c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c6:	5b                   	pop    %ebx
+ 5c7:	5e                   	pop    %esi
+ 5c8:	5f                   	pop    %edi
+ 5c9:	5d                   	pop    %ebp
+ 5ca:	c3                   	ret
+
+000005cb <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5cb:	55                   	push   %ebp
+ 5cc:	89 e5                	mov    %esp,%ebp
+ 5ce:	57                   	push   %edi
+ 5cf:	56                   	push   %esi
+ 5d0:	53                   	push   %ebx
+ 5d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5d4:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5d7:	a1 94 0a 00 00       	mov    0xa94,%eax
+ 5dc:	eb 02                	jmp    5e0 <free+0x15>
+ 5de:	89 d0                	mov    %edx,%eax
+ 5e0:	39 c8                	cmp    %ecx,%eax
+ 5e2:	73 04                	jae    5e8 <free+0x1d>
+ 5e4:	3b 08                	cmp    (%eax),%ecx
+ 5e6:	72 12                	jb     5fa <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5e8:	8b 10                	mov    (%eax),%edx
+ 5ea:	39 d0                	cmp    %edx,%eax
+ 5ec:	72 f0                	jb     5de <free+0x13>
+ 5ee:	39 c8                	cmp    %ecx,%eax
+ 5f0:	72 08                	jb     5fa <free+0x2f>
+ 5f2:	39 d1                	cmp    %edx,%ecx
+ 5f4:	72 04                	jb     5fa <free+0x2f>
+ 5f6:	89 d0                	mov    %edx,%eax
+ 5f8:	eb e6                	jmp    5e0 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5fa:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5fd:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 600:	8b 10                	mov    (%eax),%edx
+ 602:	39 d7                	cmp    %edx,%edi
+ 604:	74 19                	je     61f <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 606:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 609:	8b 50 04             	mov    0x4(%eax),%edx
+ 60c:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 60f:	39 ce                	cmp    %ecx,%esi
+ 611:	74 1b                	je     62e <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 613:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 615:	a3 94 0a 00 00       	mov    %eax,0xa94
+}
+ 61a:	5b                   	pop    %ebx
+ 61b:	5e                   	pop    %esi
+ 61c:	5f                   	pop    %edi
+ 61d:	5d                   	pop    %ebp
+ 61e:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 61f:	03 72 04             	add    0x4(%edx),%esi
+ 622:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 625:	8b 10                	mov    (%eax),%edx
+ 627:	8b 12                	mov    (%edx),%edx
+ 629:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 62c:	eb db                	jmp    609 <free+0x3e>
+    p->s.size += bp->s.size;
+ 62e:	03 53 fc             	add    -0x4(%ebx),%edx
+ 631:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 634:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 637:	89 10                	mov    %edx,(%eax)
+ 639:	eb da                	jmp    615 <free+0x4a>
+
+0000063b <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 63b:	55                   	push   %ebp
+ 63c:	89 e5                	mov    %esp,%ebp
+ 63e:	53                   	push   %ebx
+ 63f:	83 ec 04             	sub    $0x4,%esp
+ 642:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 644:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 649:	77 05                	ja     650 <morecore+0x15>
+    nu = 4096;
+ 64b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 650:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 657:	83 ec 0c             	sub    $0xc,%esp
+ 65a:	50                   	push   %eax
+ 65b:	e8 e8 fc ff ff       	call   348 <sbrk>
+  if(p == (char*)-1)
+ 660:	83 c4 10             	add    $0x10,%esp
+ 663:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 666:	74 1c                	je     684 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 668:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 66b:	83 c0 08             	add    $0x8,%eax
+ 66e:	83 ec 0c             	sub    $0xc,%esp
+ 671:	50                   	push   %eax
+ 672:	e8 54 ff ff ff       	call   5cb <free>
+  return freep;
+ 677:	a1 94 0a 00 00       	mov    0xa94,%eax
+ 67c:	83 c4 10             	add    $0x10,%esp
+}
+ 67f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 682:	c9                   	leave
+ 683:	c3                   	ret
+    return 0;
+ 684:	b8 00 00 00 00       	mov    $0x0,%eax
+ 689:	eb f4                	jmp    67f <morecore+0x44>
+
+0000068b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 68b:	55                   	push   %ebp
+ 68c:	89 e5                	mov    %esp,%ebp
+ 68e:	53                   	push   %ebx
+ 68f:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 692:	8b 45 08             	mov    0x8(%ebp),%eax
+ 695:	8d 58 07             	lea    0x7(%eax),%ebx
+ 698:	c1 eb 03             	shr    $0x3,%ebx
+ 69b:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 69e:	8b 0d 94 0a 00 00    	mov    0xa94,%ecx
+ 6a4:	85 c9                	test   %ecx,%ecx
+ 6a6:	74 04                	je     6ac <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6a8:	8b 01                	mov    (%ecx),%eax
+ 6aa:	eb 4a                	jmp    6f6 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 6ac:	c7 05 94 0a 00 00 98 	movl   $0xa98,0xa94
+ 6b3:	0a 00 00 
+ 6b6:	c7 05 98 0a 00 00 98 	movl   $0xa98,0xa98
+ 6bd:	0a 00 00 
+    base.s.size = 0;
+ 6c0:	c7 05 9c 0a 00 00 00 	movl   $0x0,0xa9c
+ 6c7:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 6ca:	b9 98 0a 00 00       	mov    $0xa98,%ecx
+ 6cf:	eb d7                	jmp    6a8 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 6d1:	74 19                	je     6ec <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6d3:	29 da                	sub    %ebx,%edx
+ 6d5:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 6d8:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 6db:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6de:	89 0d 94 0a 00 00    	mov    %ecx,0xa94
+      return (void*)(p + 1);
+ 6e4:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6ea:	c9                   	leave
+ 6eb:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6ec:	8b 10                	mov    (%eax),%edx
+ 6ee:	89 11                	mov    %edx,(%ecx)
+ 6f0:	eb ec                	jmp    6de <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6f2:	89 c1                	mov    %eax,%ecx
+ 6f4:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 6f6:	8b 50 04             	mov    0x4(%eax),%edx
+ 6f9:	39 da                	cmp    %ebx,%edx
+ 6fb:	73 d4                	jae    6d1 <malloc+0x46>
+    if(p == freep)
+ 6fd:	39 05 94 0a 00 00    	cmp    %eax,0xa94
+ 703:	75 ed                	jne    6f2 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 705:	89 d8                	mov    %ebx,%eax
+ 707:	e8 2f ff ff ff       	call   63b <morecore>
+ 70c:	85 c0                	test   %eax,%eax
+ 70e:	75 e2                	jne    6f2 <malloc+0x67>
+ 710:	eb d5                	jmp    6e7 <malloc+0x5c>
@@ -0,0 +1,1464 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "fs.h"
+
+
+char*
+fmtname(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  static char buf[DIRSIZ+1];
+  char *p;
+
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+   8:	83 ec 0c             	sub    $0xc,%esp
+   b:	53                   	push   %ebx
+   c:	e8 27 03 00 00       	call   338 <strlen>
+  11:	01 d8                	add    %ebx,%eax
+  13:	83 c4 10             	add    $0x10,%esp
+  16:	eb 03                	jmp    1b <fmtname+0x1b>
+  18:	83 e8 01             	sub    $0x1,%eax
+  1b:	39 d8                	cmp    %ebx,%eax
+  1d:	72 05                	jb     24 <fmtname+0x24>
+  1f:	80 38 2f             	cmpb   $0x2f,(%eax)
+  22:	75 f4                	jne    18 <fmtname+0x18>
+    ;
+  p++;
+  24:	8d 58 01             	lea    0x1(%eax),%ebx
+
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+  27:	83 ec 0c             	sub    $0xc,%esp
+  2a:	53                   	push   %ebx
+  2b:	e8 08 03 00 00       	call   338 <strlen>
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	83 f8 0d             	cmp    $0xd,%eax
+  36:	76 09                	jbe    41 <fmtname+0x41>
+    return p;
+  memmove(buf, p, strlen(p));
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  return buf;
+}
+  38:	89 d8                	mov    %ebx,%eax
+  3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  3d:	5b                   	pop    %ebx
+  3e:	5e                   	pop    %esi
+  3f:	5d                   	pop    %ebp
+  40:	c3                   	ret
+  memmove(buf, p, strlen(p));
+  41:	83 ec 0c             	sub    $0xc,%esp
+  44:	53                   	push   %ebx
+  45:	e8 ee 02 00 00       	call   338 <strlen>
+  4a:	83 c4 0c             	add    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	53                   	push   %ebx
+  4f:	68 ac 0d 00 00       	push   $0xdac
+  54:	e8 c3 04 00 00       	call   51c <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  59:	89 1c 24             	mov    %ebx,(%esp)
+  5c:	e8 d7 02 00 00       	call   338 <strlen>
+  61:	89 c6                	mov    %eax,%esi
+  63:	89 1c 24             	mov    %ebx,(%esp)
+  66:	e8 cd 02 00 00       	call   338 <strlen>
+  6b:	83 c4 0c             	add    $0xc,%esp
+  6e:	ba 0e 00 00 00       	mov    $0xe,%edx
+  73:	29 f2                	sub    %esi,%edx
+  75:	52                   	push   %edx
+  76:	6a 20                	push   $0x20
+  78:	05 ac 0d 00 00       	add    $0xdac,%eax
+  7d:	50                   	push   %eax
+  7e:	e8 cd 02 00 00       	call   350 <memset>
+  return buf;
+  83:	83 c4 10             	add    $0x10,%esp
+  86:	bb ac 0d 00 00       	mov    $0xdac,%ebx
+  8b:	eb ab                	jmp    38 <fmtname+0x38>
+
+0000008d <ls>:
+
+void
+ls(char *path)
+{
+  8d:	55                   	push   %ebp
+  8e:	89 e5                	mov    %esp,%ebp
+  90:	57                   	push   %edi
+  91:	56                   	push   %esi
+  92:	53                   	push   %ebx
+  93:	81 ec 54 02 00 00    	sub    $0x254,%esp
+  99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char buf[512], *p;
+  int fd;
+  struct dirent de;
+  struct stat st;
+
+  if((fd = open(path, 0)) < 0){
+  9c:	6a 00                	push   $0x0
+  9e:	53                   	push   %ebx
+  9f:	e8 ec 04 00 00       	call   590 <open>
+  a4:	83 c4 10             	add    $0x10,%esp
+  a7:	85 c0                	test   %eax,%eax
+  a9:	0f 88 94 00 00 00    	js     143 <ls+0xb6>
+  af:	89 c7                	mov    %eax,%edi
+    printf(2, "ls: cannot open %s\n", path);
+    return;
+  }
+
+  if(fstat(fd, &st) < 0){
+  b1:	83 ec 08             	sub    $0x8,%esp
+  b4:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+  ba:	50                   	push   %eax
+  bb:	57                   	push   %edi
+  bc:	e8 e7 04 00 00       	call   5a8 <fstat>
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	85 c0                	test   %eax,%eax
+  c6:	0f 88 8c 00 00 00    	js     158 <ls+0xcb>
+    printf(2, "ls: cannot stat %s\n", path);
+    close(fd);
+    return;
+  }
+
+  switch(st.type){
+  cc:	0f b7 85 c4 fd ff ff 	movzwl -0x23c(%ebp),%eax
+  d3:	0f bf f0             	movswl %ax,%esi
+  d6:	66 83 f8 01          	cmp    $0x1,%ax
+  da:	0f 84 95 00 00 00    	je     175 <ls+0xe8>
+  e0:	66 85 c0             	test   %ax,%ax
+  e3:	7e 4a                	jle    12f <ls+0xa2>
+  e5:	83 e8 02             	sub    $0x2,%eax
+  e8:	66 83 f8 01          	cmp    $0x1,%ax
+  ec:	77 41                	ja     12f <ls+0xa2>
+  case T_FILE:
+  case T_DEV:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+  ee:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  f4:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+  fa:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+ 100:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 106:	83 ec 0c             	sub    $0xc,%esp
+ 109:	53                   	push   %ebx
+ 10a:	e8 f1 fe ff ff       	call   0 <fmtname>
+ 10f:	83 c4 08             	add    $0x8,%esp
+ 112:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 118:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+ 11e:	56                   	push   %esi
+ 11f:	50                   	push   %eax
+ 120:	68 cc 09 00 00       	push   $0x9cc
+ 125:	6a 01                	push   $0x1
+ 127:	e8 c9 05 00 00       	call   6f5 <printf>
+    break;
+ 12c:	83 c4 20             	add    $0x20,%esp
+      }
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+    }
+    break;
+  }
+  close(fd);
+ 12f:	83 ec 0c             	sub    $0xc,%esp
+ 132:	57                   	push   %edi
+ 133:	e8 40 04 00 00       	call   578 <close>
+ 138:	83 c4 10             	add    $0x10,%esp
+}
+ 13b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 13e:	5b                   	pop    %ebx
+ 13f:	5e                   	pop    %esi
+ 140:	5f                   	pop    %edi
+ 141:	5d                   	pop    %ebp
+ 142:	c3                   	ret
+    printf(2, "ls: cannot open %s\n", path);
+ 143:	83 ec 04             	sub    $0x4,%esp
+ 146:	53                   	push   %ebx
+ 147:	68 a4 09 00 00       	push   $0x9a4
+ 14c:	6a 02                	push   $0x2
+ 14e:	e8 a2 05 00 00       	call   6f5 <printf>
+    return;
+ 153:	83 c4 10             	add    $0x10,%esp
+ 156:	eb e3                	jmp    13b <ls+0xae>
+    printf(2, "ls: cannot stat %s\n", path);
+ 158:	83 ec 04             	sub    $0x4,%esp
+ 15b:	53                   	push   %ebx
+ 15c:	68 b8 09 00 00       	push   $0x9b8
+ 161:	6a 02                	push   $0x2
+ 163:	e8 8d 05 00 00       	call   6f5 <printf>
+    close(fd);
+ 168:	89 3c 24             	mov    %edi,(%esp)
+ 16b:	e8 08 04 00 00       	call   578 <close>
+    return;
+ 170:	83 c4 10             	add    $0x10,%esp
+ 173:	eb c6                	jmp    13b <ls+0xae>
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 175:	83 ec 0c             	sub    $0xc,%esp
+ 178:	53                   	push   %ebx
+ 179:	e8 ba 01 00 00       	call   338 <strlen>
+ 17e:	83 c0 10             	add    $0x10,%eax
+ 181:	83 c4 10             	add    $0x10,%esp
+ 184:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 189:	76 14                	jbe    19f <ls+0x112>
+      printf(1, "ls: path too long\n");
+ 18b:	83 ec 08             	sub    $0x8,%esp
+ 18e:	68 d9 09 00 00       	push   $0x9d9
+ 193:	6a 01                	push   $0x1
+ 195:	e8 5b 05 00 00       	call   6f5 <printf>
+      break;
+ 19a:	83 c4 10             	add    $0x10,%esp
+ 19d:	eb 90                	jmp    12f <ls+0xa2>
+    strcpy(buf, path);
+ 19f:	83 ec 08             	sub    $0x8,%esp
+ 1a2:	53                   	push   %ebx
+ 1a3:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+ 1a9:	56                   	push   %esi
+ 1aa:	e8 3d 01 00 00       	call   2ec <strcpy>
+    p = buf+strlen(buf);
+ 1af:	89 34 24             	mov    %esi,(%esp)
+ 1b2:	e8 81 01 00 00       	call   338 <strlen>
+ 1b7:	01 c6                	add    %eax,%esi
+    *p++ = '/';
+ 1b9:	8d 46 01             	lea    0x1(%esi),%eax
+ 1bc:	89 85 ac fd ff ff    	mov    %eax,-0x254(%ebp)
+ 1c2:	c6 06 2f             	movb   $0x2f,(%esi)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1c5:	83 c4 10             	add    $0x10,%esp
+ 1c8:	eb 19                	jmp    1e3 <ls+0x156>
+        printf(1, "ls: cannot stat %s\n", buf);
+ 1ca:	83 ec 04             	sub    $0x4,%esp
+ 1cd:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 1d3:	50                   	push   %eax
+ 1d4:	68 b8 09 00 00       	push   $0x9b8
+ 1d9:	6a 01                	push   $0x1
+ 1db:	e8 15 05 00 00       	call   6f5 <printf>
+        continue;
+ 1e0:	83 c4 10             	add    $0x10,%esp
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e3:	83 ec 04             	sub    $0x4,%esp
+ 1e6:	6a 10                	push   $0x10
+ 1e8:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+ 1ee:	50                   	push   %eax
+ 1ef:	57                   	push   %edi
+ 1f0:	e8 73 03 00 00       	call   568 <read>
+ 1f5:	83 c4 10             	add    $0x10,%esp
+ 1f8:	83 f8 10             	cmp    $0x10,%eax
+ 1fb:	0f 85 2e ff ff ff    	jne    12f <ls+0xa2>
+      if(de.inum == 0)
+ 201:	66 83 bd d8 fd ff ff 	cmpw   $0x0,-0x228(%ebp)
+ 208:	00 
+ 209:	74 d8                	je     1e3 <ls+0x156>
+      memmove(p, de.name, DIRSIZ);
+ 20b:	83 ec 04             	sub    $0x4,%esp
+ 20e:	6a 0e                	push   $0xe
+ 210:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+ 216:	50                   	push   %eax
+ 217:	ff b5 ac fd ff ff    	push   -0x254(%ebp)
+ 21d:	e8 fa 02 00 00       	call   51c <memmove>
+      p[DIRSIZ] = 0;
+ 222:	c6 46 0f 00          	movb   $0x0,0xf(%esi)
+      if(stat(buf, &st) < 0){
+ 226:	83 c4 08             	add    $0x8,%esp
+ 229:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 22f:	50                   	push   %eax
+ 230:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 236:	50                   	push   %eax
+ 237:	e8 a7 01 00 00       	call   3e3 <stat>
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	85 c0                	test   %eax,%eax
+ 241:	78 87                	js     1ca <ls+0x13d>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 243:	8b 9d d4 fd ff ff    	mov    -0x22c(%ebp),%ebx
+ 249:	8b 85 cc fd ff ff    	mov    -0x234(%ebp),%eax
+ 24f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 255:	0f b7 8d c4 fd ff ff 	movzwl -0x23c(%ebp),%ecx
+ 25c:	66 89 8d b0 fd ff ff 	mov    %cx,-0x250(%ebp)
+ 263:	83 ec 0c             	sub    $0xc,%esp
+ 266:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 26c:	50                   	push   %eax
+ 26d:	e8 8e fd ff ff       	call   0 <fmtname>
+ 272:	89 c2                	mov    %eax,%edx
+ 274:	83 c4 08             	add    $0x8,%esp
+ 277:	53                   	push   %ebx
+ 278:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 27e:	0f bf 85 b0 fd ff ff 	movswl -0x250(%ebp),%eax
+ 285:	50                   	push   %eax
+ 286:	52                   	push   %edx
+ 287:	68 cc 09 00 00       	push   $0x9cc
+ 28c:	6a 01                	push   $0x1
+ 28e:	e8 62 04 00 00       	call   6f5 <printf>
+ 293:	83 c4 20             	add    $0x20,%esp
+ 296:	e9 48 ff ff ff       	jmp    1e3 <ls+0x156>
+
+0000029b <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 29b:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 29f:	83 e4 f0             	and    $0xfffffff0,%esp
+ 2a2:	ff 71 fc             	push   -0x4(%ecx)
+ 2a5:	55                   	push   %ebp
+ 2a6:	89 e5                	mov    %esp,%ebp
+ 2a8:	57                   	push   %edi
+ 2a9:	56                   	push   %esi
+ 2aa:	53                   	push   %ebx
+ 2ab:	51                   	push   %ecx
+ 2ac:	83 ec 08             	sub    $0x8,%esp
+ 2af:	8b 31                	mov    (%ecx),%esi
+ 2b1:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+ 2b4:	83 fe 01             	cmp    $0x1,%esi
+ 2b7:	7e 07                	jle    2c0 <main+0x25>
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+ 2b9:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 2be:	eb 23                	jmp    2e3 <main+0x48>
+    ls(".");
+ 2c0:	83 ec 0c             	sub    $0xc,%esp
+ 2c3:	68 ec 09 00 00       	push   $0x9ec
+ 2c8:	e8 c0 fd ff ff       	call   8d <ls>
+    exit();
+ 2cd:	e8 7e 02 00 00       	call   550 <exit>
+    ls(argv[i]);
+ 2d2:	83 ec 0c             	sub    $0xc,%esp
+ 2d5:	ff 34 9f             	push   (%edi,%ebx,4)
+ 2d8:	e8 b0 fd ff ff       	call   8d <ls>
+  for(i=1; i<argc; i++)
+ 2dd:	83 c3 01             	add    $0x1,%ebx
+ 2e0:	83 c4 10             	add    $0x10,%esp
+ 2e3:	39 f3                	cmp    %esi,%ebx
+ 2e5:	7c eb                	jl     2d2 <main+0x37>
+  exit();
+ 2e7:	e8 64 02 00 00       	call   550 <exit>
+
+000002ec <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2ec:	55                   	push   %ebp
+ 2ed:	89 e5                	mov    %esp,%ebp
+ 2ef:	56                   	push   %esi
+ 2f0:	53                   	push   %ebx
+ 2f1:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2f7:	89 f0                	mov    %esi,%eax
+ 2f9:	89 d1                	mov    %edx,%ecx
+ 2fb:	83 c2 01             	add    $0x1,%edx
+ 2fe:	89 c3                	mov    %eax,%ebx
+ 300:	83 c0 01             	add    $0x1,%eax
+ 303:	0f b6 09             	movzbl (%ecx),%ecx
+ 306:	88 0b                	mov    %cl,(%ebx)
+ 308:	84 c9                	test   %cl,%cl
+ 30a:	75 ed                	jne    2f9 <strcpy+0xd>
+    ;
+  return os;
+}
+ 30c:	89 f0                	mov    %esi,%eax
+ 30e:	5b                   	pop    %ebx
+ 30f:	5e                   	pop    %esi
+ 310:	5d                   	pop    %ebp
+ 311:	c3                   	ret
+
+00000312 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 312:	55                   	push   %ebp
+ 313:	89 e5                	mov    %esp,%ebp
+ 315:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 318:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 31b:	eb 06                	jmp    323 <strcmp+0x11>
+    p++, q++;
+ 31d:	83 c1 01             	add    $0x1,%ecx
+ 320:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 323:	0f b6 01             	movzbl (%ecx),%eax
+ 326:	84 c0                	test   %al,%al
+ 328:	74 04                	je     32e <strcmp+0x1c>
+ 32a:	3a 02                	cmp    (%edx),%al
+ 32c:	74 ef                	je     31d <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 32e:	0f b6 c0             	movzbl %al,%eax
+ 331:	0f b6 12             	movzbl (%edx),%edx
+ 334:	29 d0                	sub    %edx,%eax
+}
+ 336:	5d                   	pop    %ebp
+ 337:	c3                   	ret
+
+00000338 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 338:	55                   	push   %ebp
+ 339:	89 e5                	mov    %esp,%ebp
+ 33b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 33e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 343:	eb 03                	jmp    348 <strlen+0x10>
+ 345:	83 c0 01             	add    $0x1,%eax
+ 348:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 34c:	75 f7                	jne    345 <strlen+0xd>
+    ;
+  return n;
+}
+ 34e:	5d                   	pop    %ebp
+ 34f:	c3                   	ret
+
+00000350 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 357:	89 d7                	mov    %edx,%edi
+ 359:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 35c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 35f:	fc                   	cld
+ 360:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 362:	89 d0                	mov    %edx,%eax
+ 364:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 367:	c9                   	leave
+ 368:	c3                   	ret
+
+00000369 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 369:	55                   	push   %ebp
+ 36a:	89 e5                	mov    %esp,%ebp
+ 36c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 373:	eb 03                	jmp    378 <strchr+0xf>
+ 375:	83 c0 01             	add    $0x1,%eax
+ 378:	0f b6 10             	movzbl (%eax),%edx
+ 37b:	84 d2                	test   %dl,%dl
+ 37d:	74 06                	je     385 <strchr+0x1c>
+    if(*s == c)
+ 37f:	38 ca                	cmp    %cl,%dl
+ 381:	75 f2                	jne    375 <strchr+0xc>
+ 383:	eb 05                	jmp    38a <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 385:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 38a:	5d                   	pop    %ebp
+ 38b:	c3                   	ret
+
+0000038c <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 38c:	55                   	push   %ebp
+ 38d:	89 e5                	mov    %esp,%ebp
+ 38f:	57                   	push   %edi
+ 390:	56                   	push   %esi
+ 391:	53                   	push   %ebx
+ 392:	83 ec 1c             	sub    $0x1c,%esp
+ 395:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 398:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 39d:	89 de                	mov    %ebx,%esi
+ 39f:	83 c3 01             	add    $0x1,%ebx
+ 3a2:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3a5:	7d 2e                	jge    3d5 <gets+0x49>
+    cc = read(0, &c, 1);
+ 3a7:	83 ec 04             	sub    $0x4,%esp
+ 3aa:	6a 01                	push   $0x1
+ 3ac:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 3af:	50                   	push   %eax
+ 3b0:	6a 00                	push   $0x0
+ 3b2:	e8 b1 01 00 00       	call   568 <read>
+    if(cc < 1)
+ 3b7:	83 c4 10             	add    $0x10,%esp
+ 3ba:	85 c0                	test   %eax,%eax
+ 3bc:	7e 17                	jle    3d5 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 3be:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3c2:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 3c5:	3c 0a                	cmp    $0xa,%al
+ 3c7:	0f 94 c2             	sete   %dl
+ 3ca:	3c 0d                	cmp    $0xd,%al
+ 3cc:	0f 94 c0             	sete   %al
+ 3cf:	08 c2                	or     %al,%dl
+ 3d1:	74 ca                	je     39d <gets+0x11>
+    buf[i++] = c;
+ 3d3:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 3d5:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 3d9:	89 f8                	mov    %edi,%eax
+ 3db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3de:	5b                   	pop    %ebx
+ 3df:	5e                   	pop    %esi
+ 3e0:	5f                   	pop    %edi
+ 3e1:	5d                   	pop    %ebp
+ 3e2:	c3                   	ret
+
+000003e3 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3e3:	55                   	push   %ebp
+ 3e4:	89 e5                	mov    %esp,%ebp
+ 3e6:	56                   	push   %esi
+ 3e7:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3e8:	83 ec 08             	sub    $0x8,%esp
+ 3eb:	6a 00                	push   $0x0
+ 3ed:	ff 75 08             	push   0x8(%ebp)
+ 3f0:	e8 9b 01 00 00       	call   590 <open>
+  if(fd < 0)
+ 3f5:	83 c4 10             	add    $0x10,%esp
+ 3f8:	85 c0                	test   %eax,%eax
+ 3fa:	78 24                	js     420 <stat+0x3d>
+ 3fc:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 3fe:	83 ec 08             	sub    $0x8,%esp
+ 401:	ff 75 0c             	push   0xc(%ebp)
+ 404:	50                   	push   %eax
+ 405:	e8 9e 01 00 00       	call   5a8 <fstat>
+ 40a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 40c:	89 1c 24             	mov    %ebx,(%esp)
+ 40f:	e8 64 01 00 00       	call   578 <close>
+  return r;
+ 414:	83 c4 10             	add    $0x10,%esp
+}
+ 417:	89 f0                	mov    %esi,%eax
+ 419:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 41c:	5b                   	pop    %ebx
+ 41d:	5e                   	pop    %esi
+ 41e:	5d                   	pop    %ebp
+ 41f:	c3                   	ret
+    return -1;
+ 420:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 425:	eb f0                	jmp    417 <stat+0x34>
+
+00000427 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 427:	55                   	push   %ebp
+ 428:	89 e5                	mov    %esp,%ebp
+ 42a:	56                   	push   %esi
+ 42b:	53                   	push   %ebx
+ 42c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 42f:	eb 03                	jmp    434 <atoi+0xd>
+ 431:	83 c2 01             	add    $0x1,%edx
+ 434:	0f b6 02             	movzbl (%edx),%eax
+ 437:	3c 20                	cmp    $0x20,%al
+ 439:	74 f6                	je     431 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 43b:	3c 2d                	cmp    $0x2d,%al
+ 43d:	74 1d                	je     45c <atoi+0x35>
+ 43f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 444:	3c 2b                	cmp    $0x2b,%al
+ 446:	0f 94 c1             	sete   %cl
+ 449:	3c 2d                	cmp    $0x2d,%al
+ 44b:	0f 94 c0             	sete   %al
+ 44e:	08 c1                	or     %al,%cl
+ 450:	74 03                	je     455 <atoi+0x2e>
+    s++;
+ 452:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 455:	b8 00 00 00 00       	mov    $0x0,%eax
+ 45a:	eb 17                	jmp    473 <atoi+0x4c>
+ 45c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 461:	eb e1                	jmp    444 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 463:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 466:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 469:	83 c2 01             	add    $0x1,%edx
+ 46c:	0f be c9             	movsbl %cl,%ecx
+ 46f:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 473:	0f b6 0a             	movzbl (%edx),%ecx
+ 476:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 479:	80 fb 09             	cmp    $0x9,%bl
+ 47c:	76 e5                	jbe    463 <atoi+0x3c>
+  return sign*n;
+ 47e:	0f af c6             	imul   %esi,%eax
+}
+ 481:	5b                   	pop    %ebx
+ 482:	5e                   	pop    %esi
+ 483:	5d                   	pop    %ebp
+ 484:	c3                   	ret
+
+00000485 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 485:	55                   	push   %ebp
+ 486:	89 e5                	mov    %esp,%ebp
+ 488:	56                   	push   %esi
+ 489:	53                   	push   %ebx
+ 48a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 48d:	eb 03                	jmp    492 <atoo+0xd>
+ 48f:	83 c2 01             	add    $0x1,%edx
+ 492:	0f b6 02             	movzbl (%edx),%eax
+ 495:	3c 20                	cmp    $0x20,%al
+ 497:	74 f6                	je     48f <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 499:	3c 2d                	cmp    $0x2d,%al
+ 49b:	74 1d                	je     4ba <atoo+0x35>
+ 49d:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4a2:	3c 2b                	cmp    $0x2b,%al
+ 4a4:	0f 94 c1             	sete   %cl
+ 4a7:	3c 2d                	cmp    $0x2d,%al
+ 4a9:	0f 94 c0             	sete   %al
+ 4ac:	08 c1                	or     %al,%cl
+ 4ae:	74 03                	je     4b3 <atoo+0x2e>
+    s++;
+ 4b0:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 4b3:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4b8:	eb 11                	jmp    4cb <atoo+0x46>
+ 4ba:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4bf:	eb e1                	jmp    4a2 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 4c1:	83 c2 01             	add    $0x1,%edx
+ 4c4:	0f be c9             	movsbl %cl,%ecx
+ 4c7:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 4cb:	0f b6 0a             	movzbl (%edx),%ecx
+ 4ce:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 4d1:	80 fb 07             	cmp    $0x7,%bl
+ 4d4:	76 eb                	jbe    4c1 <atoo+0x3c>
+  return sign*n;
+ 4d6:	0f af c6             	imul   %esi,%eax
+}
+ 4d9:	5b                   	pop    %ebx
+ 4da:	5e                   	pop    %esi
+ 4db:	5d                   	pop    %ebp
+ 4dc:	c3                   	ret
+
+000004dd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 4dd:	55                   	push   %ebp
+ 4de:	89 e5                	mov    %esp,%ebp
+ 4e0:	53                   	push   %ebx
+ 4e1:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 4e7:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 4ea:	eb 09                	jmp    4f5 <strncmp+0x18>
+      n--, p++, q++;
+ 4ec:	83 e8 01             	sub    $0x1,%eax
+ 4ef:	83 c2 01             	add    $0x1,%edx
+ 4f2:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 4f5:	85 c0                	test   %eax,%eax
+ 4f7:	74 0b                	je     504 <strncmp+0x27>
+ 4f9:	0f b6 1a             	movzbl (%edx),%ebx
+ 4fc:	84 db                	test   %bl,%bl
+ 4fe:	74 04                	je     504 <strncmp+0x27>
+ 500:	3a 19                	cmp    (%ecx),%bl
+ 502:	74 e8                	je     4ec <strncmp+0xf>
+    if(n == 0)
+ 504:	85 c0                	test   %eax,%eax
+ 506:	74 0d                	je     515 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 508:	0f b6 02             	movzbl (%edx),%eax
+ 50b:	0f b6 11             	movzbl (%ecx),%edx
+ 50e:	29 d0                	sub    %edx,%eax
+}
+ 510:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 513:	c9                   	leave
+ 514:	c3                   	ret
+      return 0;
+ 515:	b8 00 00 00 00       	mov    $0x0,%eax
+ 51a:	eb f4                	jmp    510 <strncmp+0x33>
+
+0000051c <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 51c:	55                   	push   %ebp
+ 51d:	89 e5                	mov    %esp,%ebp
+ 51f:	56                   	push   %esi
+ 520:	53                   	push   %ebx
+ 521:	8b 75 08             	mov    0x8(%ebp),%esi
+ 524:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 527:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 52a:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 52c:	eb 0d                	jmp    53b <memmove+0x1f>
+    *dst++ = *src++;
+ 52e:	0f b6 01             	movzbl (%ecx),%eax
+ 531:	88 02                	mov    %al,(%edx)
+ 533:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 536:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 539:	89 d8                	mov    %ebx,%eax
+ 53b:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 53e:	85 c0                	test   %eax,%eax
+ 540:	7f ec                	jg     52e <memmove+0x12>
+  return vdst;
+}
+ 542:	89 f0                	mov    %esi,%eax
+ 544:	5b                   	pop    %ebx
+ 545:	5e                   	pop    %esi
+ 546:	5d                   	pop    %ebp
+ 547:	c3                   	ret
+
+00000548 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 548:	b8 01 00 00 00       	mov    $0x1,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <exit>:
+SYSCALL(exit)
+ 550:	b8 02 00 00 00       	mov    $0x2,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <wait>:
+SYSCALL(wait)
+ 558:	b8 03 00 00 00       	mov    $0x3,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <pipe>:
+SYSCALL(pipe)
+ 560:	b8 04 00 00 00       	mov    $0x4,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <read>:
+SYSCALL(read)
+ 568:	b8 05 00 00 00       	mov    $0x5,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <write>:
+SYSCALL(write)
+ 570:	b8 10 00 00 00       	mov    $0x10,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <close>:
+SYSCALL(close)
+ 578:	b8 15 00 00 00       	mov    $0x15,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <kill>:
+SYSCALL(kill)
+ 580:	b8 06 00 00 00       	mov    $0x6,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <exec>:
+SYSCALL(exec)
+ 588:	b8 07 00 00 00       	mov    $0x7,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <open>:
+SYSCALL(open)
+ 590:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <mknod>:
+SYSCALL(mknod)
+ 598:	b8 11 00 00 00       	mov    $0x11,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <unlink>:
+SYSCALL(unlink)
+ 5a0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <fstat>:
+SYSCALL(fstat)
+ 5a8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <link>:
+SYSCALL(link)
+ 5b0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <mkdir>:
+SYSCALL(mkdir)
+ 5b8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <chdir>:
+SYSCALL(chdir)
+ 5c0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <dup>:
+SYSCALL(dup)
+ 5c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <getpid>:
+SYSCALL(getpid)
+ 5d0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <sbrk>:
+SYSCALL(sbrk)
+ 5d8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <sleep>:
+SYSCALL(sleep)
+ 5e0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <uptime>:
+SYSCALL(uptime)
+ 5e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <halt>:
+SYSCALL(halt)
+ 5f0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <date>:
+SYSCALL(date)
+ 5f8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <getuid>:
+SYSCALL(getuid)
+ 600:	b8 18 00 00 00       	mov    $0x18,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <getgid>:
+SYSCALL(getgid)
+ 608:	b8 19 00 00 00       	mov    $0x19,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <getppid>:
+SYSCALL(getppid)
+ 610:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <setuid>:
+SYSCALL(setuid)
+ 618:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <setgid>:
+SYSCALL(setgid)
+ 620:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <getprocs>:
+SYSCALL(getprocs)
+ 628:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <getpriority>:
+SYSCALL(getpriority)
+ 630:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <setpriority>:
+SYSCALL(setpriority)
+ 638:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <pipesize>:
+SYSCALL(pipesize)
+ 640:	b8 20 00 00 00       	mov    $0x20,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <splice>:
+SYSCALL(splice)
+ 648:	b8 21 00 00 00       	mov    $0x21,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	83 ec 1c             	sub    $0x1c,%esp
+ 656:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 659:	6a 01                	push   $0x1
+ 65b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 65e:	52                   	push   %edx
+ 65f:	50                   	push   %eax
+ 660:	e8 0b ff ff ff       	call   570 <write>
+}
+ 665:	83 c4 10             	add    $0x10,%esp
+ 668:	c9                   	leave
+ 669:	c3                   	ret
+
+0000066a <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 66a:	55                   	push   %ebp
+ 66b:	89 e5                	mov    %esp,%ebp
+ 66d:	57                   	push   %edi
+ 66e:	56                   	push   %esi
+ 66f:	53                   	push   %ebx
+ 670:	83 ec 2c             	sub    $0x2c,%esp
+ 673:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 676:	89 d0                	mov    %edx,%eax
+ 678:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 67a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 67e:	0f 95 c1             	setne  %cl
+ 681:	c1 ea 1f             	shr    $0x1f,%edx
+ 684:	84 d1                	test   %dl,%cl
+ 686:	74 44                	je     6cc <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 688:	f7 d8                	neg    %eax
+ 68a:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 68c:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 693:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 698:	89 c8                	mov    %ecx,%eax
+ 69a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 69f:	f7 f6                	div    %esi
+ 6a1:	89 df                	mov    %ebx,%edi
+ 6a3:	83 c3 01             	add    $0x1,%ebx
+ 6a6:	0f b6 92 50 0a 00 00 	movzbl 0xa50(%edx),%edx
+ 6ad:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 6b1:	89 ca                	mov    %ecx,%edx
+ 6b3:	89 c1                	mov    %eax,%ecx
+ 6b5:	39 f2                	cmp    %esi,%edx
+ 6b7:	73 df                	jae    698 <printint+0x2e>
+  if(neg)
+ 6b9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 6bd:	74 31                	je     6f0 <printint+0x86>
+    buf[i++] = '-';
+ 6bf:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 6c4:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 6c7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 6ca:	eb 17                	jmp    6e3 <printint+0x79>
+    x = xx;
+ 6cc:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 6ce:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 6d5:	eb bc                	jmp    693 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6d7:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 6dc:	89 f0                	mov    %esi,%eax
+ 6de:	e8 6d ff ff ff       	call   650 <putc>
+  while(--i >= 0)
+ 6e3:	83 eb 01             	sub    $0x1,%ebx
+ 6e6:	79 ef                	jns    6d7 <printint+0x6d>
+}
+ 6e8:	83 c4 2c             	add    $0x2c,%esp
+ 6eb:	5b                   	pop    %ebx
+ 6ec:	5e                   	pop    %esi
+ 6ed:	5f                   	pop    %edi
+ 6ee:	5d                   	pop    %ebp
+ 6ef:	c3                   	ret
+ 6f0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 6f3:	eb ee                	jmp    6e3 <printint+0x79>
+
+000006f5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6f5:	55                   	push   %ebp
+ 6f6:	89 e5                	mov    %esp,%ebp
+ 6f8:	57                   	push   %edi
+ 6f9:	56                   	push   %esi
+ 6fa:	53                   	push   %ebx
+ 6fb:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 6fe:	8d 45 10             	lea    0x10(%ebp),%eax
+ 701:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 704:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 709:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 70e:	eb 14                	jmp    724 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 710:	89 fa                	mov    %edi,%edx
+ 712:	8b 45 08             	mov    0x8(%ebp),%eax
+ 715:	e8 36 ff ff ff       	call   650 <putc>
+ 71a:	eb 05                	jmp    721 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 71c:	83 fe 25             	cmp    $0x25,%esi
+ 71f:	74 25                	je     746 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 721:	83 c3 01             	add    $0x1,%ebx
+ 724:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 727:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 72b:	84 c0                	test   %al,%al
+ 72d:	0f 84 20 01 00 00    	je     853 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 733:	0f be f8             	movsbl %al,%edi
+ 736:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 739:	85 f6                	test   %esi,%esi
+ 73b:	75 df                	jne    71c <printf+0x27>
+      if(c == '%'){
+ 73d:	83 f8 25             	cmp    $0x25,%eax
+ 740:	75 ce                	jne    710 <printf+0x1b>
+        state = '%';
+ 742:	89 c6                	mov    %eax,%esi
+ 744:	eb db                	jmp    721 <printf+0x2c>
+      if(c == 'd'){
+ 746:	83 f8 25             	cmp    $0x25,%eax
+ 749:	0f 84 cf 00 00 00    	je     81e <printf+0x129>
+ 74f:	0f 8c dd 00 00 00    	jl     832 <printf+0x13d>
+ 755:	83 f8 78             	cmp    $0x78,%eax
+ 758:	0f 8f d4 00 00 00    	jg     832 <printf+0x13d>
+ 75e:	83 f8 63             	cmp    $0x63,%eax
+ 761:	0f 8c cb 00 00 00    	jl     832 <printf+0x13d>
+ 767:	83 e8 63             	sub    $0x63,%eax
+ 76a:	83 f8 15             	cmp    $0x15,%eax
+ 76d:	0f 87 bf 00 00 00    	ja     832 <printf+0x13d>
+ 773:	ff 24 85 f8 09 00 00 	jmp    *0x9f8(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 77a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 77d:	8b 17                	mov    (%edi),%edx
+ 77f:	83 ec 0c             	sub    $0xc,%esp
+ 782:	6a 01                	push   $0x1
+ 784:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 789:	8b 45 08             	mov    0x8(%ebp),%eax
+ 78c:	e8 d9 fe ff ff       	call   66a <printint>
+        ap++;
+ 791:	83 c7 04             	add    $0x4,%edi
+ 794:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 797:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 79a:	be 00 00 00 00       	mov    $0x0,%esi
+ 79f:	eb 80                	jmp    721 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 7a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 7a4:	8b 17                	mov    (%edi),%edx
+ 7a6:	83 ec 0c             	sub    $0xc,%esp
+ 7a9:	6a 00                	push   $0x0
+ 7ab:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b3:	e8 b2 fe ff ff       	call   66a <printint>
+        ap++;
+ 7b8:	83 c7 04             	add    $0x4,%edi
+ 7bb:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 7be:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7c1:	be 00 00 00 00       	mov    $0x0,%esi
+ 7c6:	e9 56 ff ff ff       	jmp    721 <printf+0x2c>
+        s = (char*)*ap;
+ 7cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7ce:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 7d0:	83 c0 04             	add    $0x4,%eax
+ 7d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 7d6:	85 f6                	test   %esi,%esi
+ 7d8:	75 15                	jne    7ef <printf+0xfa>
+          s = "(null)";
+ 7da:	be ee 09 00 00       	mov    $0x9ee,%esi
+ 7df:	eb 0e                	jmp    7ef <printf+0xfa>
+          putc(fd, *s);
+ 7e1:	0f be d2             	movsbl %dl,%edx
+ 7e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e7:	e8 64 fe ff ff       	call   650 <putc>
+          s++;
+ 7ec:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 7ef:	0f b6 16             	movzbl (%esi),%edx
+ 7f2:	84 d2                	test   %dl,%dl
+ 7f4:	75 eb                	jne    7e1 <printf+0xec>
+      state = 0;
+ 7f6:	be 00 00 00 00       	mov    $0x0,%esi
+ 7fb:	e9 21 ff ff ff       	jmp    721 <printf+0x2c>
+        putc(fd, *ap);
+ 800:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 803:	0f be 17             	movsbl (%edi),%edx
+ 806:	8b 45 08             	mov    0x8(%ebp),%eax
+ 809:	e8 42 fe ff ff       	call   650 <putc>
+        ap++;
+ 80e:	83 c7 04             	add    $0x4,%edi
+ 811:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 814:	be 00 00 00 00       	mov    $0x0,%esi
+ 819:	e9 03 ff ff ff       	jmp    721 <printf+0x2c>
+        putc(fd, c);
+ 81e:	89 fa                	mov    %edi,%edx
+ 820:	8b 45 08             	mov    0x8(%ebp),%eax
+ 823:	e8 28 fe ff ff       	call   650 <putc>
+      state = 0;
+ 828:	be 00 00 00 00       	mov    $0x0,%esi
+ 82d:	e9 ef fe ff ff       	jmp    721 <printf+0x2c>
+        putc(fd, '%');
+ 832:	ba 25 00 00 00       	mov    $0x25,%edx
+ 837:	8b 45 08             	mov    0x8(%ebp),%eax
+ 83a:	e8 11 fe ff ff       	call   650 <putc>
+        putc(fd, c);
+ 83f:	89 fa                	mov    %edi,%edx
+ 841:	8b 45 08             	mov    0x8(%ebp),%eax
+ 844:	e8 07 fe ff ff       	call   650 <putc>
+      state = 0;
+ 849:	be 00 00 00 00       	mov    $0x0,%esi
+ 84e:	e9 ce fe ff ff       	jmp    721 <printf+0x2c>
+    }
+  }
+}
+ 853:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 856:	5b                   	pop    %ebx
+ 857:	5e                   	pop    %esi
+ 858:	5f                   	pop    %edi
+ 859:	5d                   	pop    %ebp
+ 85a:	c3                   	ret
+
+0000085b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 85b:	55                   	push   %ebp
+ 85c:	89 e5                	mov    %esp,%ebp
+ 85e:	57                   	push   %edi
+ 85f:	56                   	push   %esi
+ 860:	53                   	push   %ebx
+ 861:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 864:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 867:	a1 bc 0d 00 00       	mov    0xdbc,%eax
+ 86c:	eb 02                	jmp    870 <free+0x15>
+ 86e:	89 d0                	mov    %edx,%eax
+ 870:	39 c8                	cmp    %ecx,%eax
+ 872:	73 04                	jae    878 <free+0x1d>
+ 874:	3b 08                	cmp    (%eax),%ecx
+ 876:	72 12                	jb     88a <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 878:	8b 10                	mov    (%eax),%edx
+ 87a:	39 d0                	cmp    %edx,%eax
+ 87c:	72 f0                	jb     86e <free+0x13>
+ 87e:	39 c8                	cmp    %ecx,%eax
+ 880:	72 08                	jb     88a <free+0x2f>
+ 882:	39 d1                	cmp    %edx,%ecx
+ 884:	72 04                	jb     88a <free+0x2f>
+ 886:	89 d0                	mov    %edx,%eax
+ 888:	eb e6                	jmp    870 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 88a:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 88d:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 890:	8b 10                	mov    (%eax),%edx
+ 892:	39 d7                	cmp    %edx,%edi
+ 894:	74 19                	je     8af <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 896:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 899:	8b 50 04             	mov    0x4(%eax),%edx
+ 89c:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 89f:	39 ce                	cmp    %ecx,%esi
+ 8a1:	74 1b                	je     8be <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 8a3:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 8a5:	a3 bc 0d 00 00       	mov    %eax,0xdbc
+}
+ 8aa:	5b                   	pop    %ebx
+ 8ab:	5e                   	pop    %esi
+ 8ac:	5f                   	pop    %edi
+ 8ad:	5d                   	pop    %ebp
+ 8ae:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 8af:	03 72 04             	add    0x4(%edx),%esi
+ 8b2:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b5:	8b 10                	mov    (%eax),%edx
+ 8b7:	8b 12                	mov    (%edx),%edx
+ 8b9:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 8bc:	eb db                	jmp    899 <free+0x3e>
+    p->s.size += bp->s.size;
+ 8be:	03 53 fc             	add    -0x4(%ebx),%edx
+ 8c1:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 8c4:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 8c7:	89 10                	mov    %edx,(%eax)
+ 8c9:	eb da                	jmp    8a5 <free+0x4a>
+
+000008cb <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8cb:	55                   	push   %ebp
+ 8cc:	89 e5                	mov    %esp,%ebp
+ 8ce:	53                   	push   %ebx
+ 8cf:	83 ec 04             	sub    $0x4,%esp
+ 8d2:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8d4:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 8d9:	77 05                	ja     8e0 <morecore+0x15>
+    nu = 4096;
+ 8db:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8e0:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 8e7:	83 ec 0c             	sub    $0xc,%esp
+ 8ea:	50                   	push   %eax
+ 8eb:	e8 e8 fc ff ff       	call   5d8 <sbrk>
+  if(p == (char*)-1)
+ 8f0:	83 c4 10             	add    $0x10,%esp
+ 8f3:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8f6:	74 1c                	je     914 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 8f8:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8fb:	83 c0 08             	add    $0x8,%eax
+ 8fe:	83 ec 0c             	sub    $0xc,%esp
+ 901:	50                   	push   %eax
+ 902:	e8 54 ff ff ff       	call   85b <free>
+  return freep;
+ 907:	a1 bc 0d 00 00       	mov    0xdbc,%eax
+ 90c:	83 c4 10             	add    $0x10,%esp
+}
+ 90f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 912:	c9                   	leave
+ 913:	c3                   	ret
+    return 0;
+ 914:	b8 00 00 00 00       	mov    $0x0,%eax
+ 919:	eb f4                	jmp    90f <morecore+0x44>
+
+0000091b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 91b:	55                   	push   %ebp
+ 91c:	89 e5                	mov    %esp,%ebp
+ 91e:	53                   	push   %ebx
+ 91f:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 922:	8b 45 08             	mov    0x8(%ebp),%eax
+ 925:	8d 58 07             	lea    0x7(%eax),%ebx
+ 928:	c1 eb 03             	shr    $0x3,%ebx
+ 92b:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 92e:	8b 0d bc 0d 00 00    	mov    0xdbc,%ecx
+ 934:	85 c9                	test   %ecx,%ecx
+ 936:	74 04                	je     93c <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 938:	8b 01                	mov    (%ecx),%eax
+ 93a:	eb 4a                	jmp    986 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 93c:	c7 05 bc 0d 00 00 c0 	movl   $0xdc0,0xdbc
+ 943:	0d 00 00 
+ 946:	c7 05 c0 0d 00 00 c0 	movl   $0xdc0,0xdc0
+ 94d:	0d 00 00 
+    base.s.size = 0;
+ 950:	c7 05 c4 0d 00 00 00 	movl   $0x0,0xdc4
+ 957:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 95a:	b9 c0 0d 00 00       	mov    $0xdc0,%ecx
+ 95f:	eb d7                	jmp    938 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 961:	74 19                	je     97c <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 963:	29 da                	sub    %ebx,%edx
+ 965:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 968:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 96b:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 96e:	89 0d bc 0d 00 00    	mov    %ecx,0xdbc
+      return (void*)(p + 1);
+ 974:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 977:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 97a:	c9                   	leave
+ 97b:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 97c:	8b 10                	mov    (%eax),%edx
+ 97e:	89 11                	mov    %edx,(%ecx)
+ 980:	eb ec                	jmp    96e <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 982:	89 c1                	mov    %eax,%ecx
+ 984:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 986:	8b 50 04             	mov    0x4(%eax),%edx
+ 989:	39 da                	cmp    %ebx,%edx
+ 98b:	73 d4                	jae    961 <malloc+0x46>
+    if(p == freep)
+ 98d:	39 05 bc 0d 00 00    	cmp    %eax,0xdbc
+ 993:	75 ed                	jne    982 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 995:	89 d8                	mov    %ebx,%eax
+ 997:	e8 2f ff ff ff       	call   8cb <morecore>
+ 99c:	85 c0                	test   %eax,%eax
+ 99e:	75 e2                	jne    982 <malloc+0x67>
+ 9a0:	eb d5                	jmp    977 <malloc+0x5c>
@@ -31,8 +31,10 @@ main(void)
   binit();         // buffer cache
   fileinit();      // file table
   ideinit();       // disk 
+  virtioinit();    // virtio disk
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  binit2();        // let buffer cache use the memory
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 }
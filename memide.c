@@ -13,7 +13,7 @@
 #include "fs.h"
 #include "buf.h"
 
-extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
+extern uchar _binary_fs_memfs_img_start[], _binary_fs_memfs_img_size[];
 
 static int disksize;
 static uchar *memdisk;
@@ -21,8 +21,8 @@ static uchar *memdisk;
 void
 ideinit(void)
 {
-  memdisk = _binary_fs_img_start;
-  disksize = (uint)_binary_fs_img_size/BSIZE;
+  memdisk = _binary_fs_memfs_img_start;
+  disksize = (uint)_binary_fs_memfs_img_size/BSIZE;
 }
 
 // Interrupt handler.
@@ -58,3 +58,24 @@ iderw(struct buf *b)
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+void
+iderwv(struct buf **bufs, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    iderw(bufs[i]);
+}
+
+// No point reading ahead from memory; just do the read.
+void
+idereadahead(struct buf *b)
+{
+  iderw(b);
+}
+
+void
+idewaitahead(struct buf *b)
+{
+}
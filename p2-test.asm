@@ -0,0 +1,2277 @@
+
+_p2-test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <testinvalidarray>:
+  free(table);
+  return success;
+}
+
+static int
+testinvalidarray(void){
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+  struct uproc * table;
+  int ret;
+
+  table = malloc(sizeof(struct uproc));
+       5:	83 ec 0c             	sub    $0xc,%esp
+       8:	6a 60                	push   $0x60
+       a:	e8 8e 10 00 00       	call   109d <malloc>
+  if (!table) {
+       f:	83 c4 10             	add    $0x10,%esp
+      12:	85 c0                	test   %eax,%eax
+      14:	74 2d                	je     43 <testinvalidarray+0x43>
+      16:	89 c3                	mov    %eax,%ebx
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+    exit();
+  }
+  ret = getprocs(1024, table);
+      18:	83 ec 08             	sub    $0x8,%esp
+      1b:	50                   	push   %eax
+      1c:	68 00 04 00 00       	push   $0x400
+      21:	e8 84 0d 00 00       	call   daa <getprocs>
+      26:	89 c6                	mov    %eax,%esi
+  free(table);
+      28:	89 1c 24             	mov    %ebx,(%esp)
+      2b:	e8 ad 0f 00 00       	call   fdd <free>
+  if(ret >= 0){
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 f6                	test   %esi,%esi
+      35:	79 27                	jns    5e <testinvalidarray+0x5e>
+    printf(2, "FAILED: called getprocs with max way larger than table and returned %d, not error\n", ret);
+    return -1;
+  }
+  return 0;
+      37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+      3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      3f:	5b                   	pop    %ebx
+      40:	5e                   	pop    %esi
+      41:	5d                   	pop    %ebp
+      42:	c3                   	ret
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+      43:	68 06 01 00 00       	push   $0x106
+      48:	68 84 17 00 00       	push   $0x1784
+      4d:	68 24 11 00 00       	push   $0x1124
+      52:	6a 02                	push   $0x2
+      54:	e8 1e 0e 00 00       	call   e77 <printf>
+    exit();
+      59:	e8 74 0c 00 00       	call   cd2 <exit>
+    printf(2, "FAILED: called getprocs with max way larger than table and returned %d, not error\n", ret);
+      5e:	83 ec 04             	sub    $0x4,%esp
+      61:	56                   	push   %esi
+      62:	68 50 11 00 00       	push   $0x1150
+      67:	6a 02                	push   $0x2
+      69:	e8 09 0e 00 00       	call   e77 <printf>
+    return -1;
+      6e:	83 c4 10             	add    $0x10,%esp
+      71:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      76:	eb c4                	jmp    3c <testinvalidarray+0x3c>
+
+00000078 <testprocarray>:
+testprocarray(int max, int expected_ret){
+      78:	55                   	push   %ebp
+      79:	89 e5                	mov    %esp,%ebp
+      7b:	57                   	push   %edi
+      7c:	56                   	push   %esi
+      7d:	53                   	push   %ebx
+      7e:	83 ec 18             	sub    $0x18,%esp
+      81:	89 c3                	mov    %eax,%ebx
+      83:	89 d7                	mov    %edx,%edi
+  table = malloc(sizeof(struct uproc) * max);  // bad code, assumes success
+      85:	8d 04 40             	lea    (%eax,%eax,2),%eax
+      88:	c1 e0 05             	shl    $0x5,%eax
+      8b:	50                   	push   %eax
+      8c:	e8 0c 10 00 00       	call   109d <malloc>
+  if (!table) {
+      91:	83 c4 10             	add    $0x10,%esp
+      94:	85 c0                	test   %eax,%eax
+      96:	74 3c                	je     d4 <testprocarray+0x5c>
+      98:	89 c6                	mov    %eax,%esi
+  ret = getprocs(max, table);
+      9a:	83 ec 08             	sub    $0x8,%esp
+      9d:	50                   	push   %eax
+      9e:	53                   	push   %ebx
+      9f:	e8 06 0d 00 00       	call   daa <getprocs>
+  if (ret != expected_ret){
+      a4:	83 c4 10             	add    $0x10,%esp
+      a7:	39 f8                	cmp    %edi,%eax
+      a9:	75 44                	jne    ef <testprocarray+0x77>
+    printf(2, "getprocs() was asked for %d processes and returned %d. SUCCESS\n", max, expected_ret);
+      ab:	57                   	push   %edi
+      ac:	53                   	push   %ebx
+      ad:	68 d4 11 00 00       	push   $0x11d4
+      b2:	6a 02                	push   $0x2
+      b4:	e8 be 0d 00 00       	call   e77 <printf>
+      b9:	83 c4 10             	add    $0x10,%esp
+  int ret, success = 0;
+      bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  free(table);
+      c1:	83 ec 0c             	sub    $0xc,%esp
+      c4:	56                   	push   %esi
+      c5:	e8 13 0f 00 00       	call   fdd <free>
+}
+      ca:	89 d8                	mov    %ebx,%eax
+      cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      cf:	5b                   	pop    %ebx
+      d0:	5e                   	pop    %esi
+      d1:	5f                   	pop    %edi
+      d2:	5d                   	pop    %ebp
+      d3:	c3                   	ret
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+      d4:	68 f0 00 00 00       	push   $0xf0
+      d9:	68 74 17 00 00       	push   $0x1774
+      de:	68 24 11 00 00       	push   $0x1124
+      e3:	6a 02                	push   $0x2
+      e5:	e8 8d 0d 00 00       	call   e77 <printf>
+    exit();
+      ea:	e8 e3 0b 00 00       	call   cd2 <exit>
+    printf(2, "FAILED: getprocs(%d) returned %d, expected %d\n", max, ret, expected_ret);
+      ef:	83 ec 0c             	sub    $0xc,%esp
+      f2:	57                   	push   %edi
+      f3:	50                   	push   %eax
+      f4:	53                   	push   %ebx
+      f5:	68 a4 11 00 00       	push   $0x11a4
+      fa:	6a 02                	push   $0x2
+      fc:	e8 76 0d 00 00       	call   e77 <printf>
+    success = -1;
+     101:	83 c4 20             	add    $0x20,%esp
+     104:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+     109:	eb b6                	jmp    c1 <testprocarray+0x49>
+
+0000010b <testgetprocs>:
+
+static void
+testgetprocs(){
+     10b:	55                   	push   %ebp
+     10c:	89 e5                	mov    %esp,%ebp
+     10e:	53                   	push   %ebx
+     10f:	83 ec 0c             	sub    $0xc,%esp
+  int ret, success;
+
+  printf(1, "\n----------\nRunning GetProcs Test\n----------\n");
+     112:	68 14 12 00 00       	push   $0x1214
+     117:	6a 01                	push   $0x1
+     119:	e8 59 0d 00 00       	call   e77 <printf>
+  printf(1, "Filling the proc[] array with dummy processes\n");
+     11e:	83 c4 08             	add    $0x8,%esp
+     121:	68 44 12 00 00       	push   $0x1244
+     126:	6a 01                	push   $0x1
+     128:	e8 4a 0d 00 00       	call   e77 <printf>
+  // Fork until no space left in ptable
+  ret = fork();
+     12d:	e8 98 0b 00 00       	call   cca <fork>
+  if (ret == 0){
+     132:	83 c4 10             	add    $0x10,%esp
+     135:	85 c0                	test   %eax,%eax
+     137:	75 7b                	jne    1b4 <testgetprocs+0xa9>
+    while((ret = fork()) == 0);
+     139:	e8 8c 0b 00 00       	call   cca <fork>
+     13e:	85 c0                	test   %eax,%eax
+     140:	74 f7                	je     139 <testgetprocs+0x2e>
+    if(ret > 0){
+     142:	7e 0a                	jle    14e <testgetprocs+0x43>
+      wait();
+     144:	e8 91 0b 00 00       	call   cda <wait>
+      exit();
+     149:	e8 84 0b 00 00       	call   cd2 <exit>
+    }
+    
+    // Only return left is -1, which is no space left in ptable
+    success  = testinvalidarray();
+     14e:	e8 ad fe ff ff       	call   0 <testinvalidarray>
+     153:	89 c3                	mov    %eax,%ebx
+    success |= testprocarray( 1,  1);
+     155:	ba 01 00 00 00       	mov    $0x1,%edx
+     15a:	b8 01 00 00 00       	mov    $0x1,%eax
+     15f:	e8 14 ff ff ff       	call   78 <testprocarray>
+     164:	09 c3                	or     %eax,%ebx
+    success |= testprocarray(16, 16);
+     166:	ba 10 00 00 00       	mov    $0x10,%edx
+     16b:	b8 10 00 00 00       	mov    $0x10,%eax
+     170:	e8 03 ff ff ff       	call   78 <testprocarray>
+     175:	09 c3                	or     %eax,%ebx
+    success |= testprocarray(64, 64);
+     177:	ba 40 00 00 00       	mov    $0x40,%edx
+     17c:	b8 40 00 00 00       	mov    $0x40,%eax
+     181:	e8 f2 fe ff ff       	call   78 <testprocarray>
+     186:	09 c3                	or     %eax,%ebx
+    success |= testprocarray(72, 64);
+     188:	ba 40 00 00 00       	mov    $0x40,%edx
+     18d:	b8 48 00 00 00       	mov    $0x48,%eax
+     192:	e8 e1 fe ff ff       	call   78 <testprocarray>
+    if (success == 0)
+     197:	09 c3                	or     %eax,%ebx
+     199:	74 05                	je     1a0 <testgetprocs+0x95>
+      printf(1, "** All Tests Passed **\n");
+    exit();
+     19b:	e8 32 0b 00 00       	call   cd2 <exit>
+      printf(1, "** All Tests Passed **\n");
+     1a0:	83 ec 08             	sub    $0x8,%esp
+     1a3:	68 88 16 00 00       	push   $0x1688
+     1a8:	6a 01                	push   $0x1
+     1aa:	e8 c8 0c 00 00       	call   e77 <printf>
+     1af:	83 c4 10             	add    $0x10,%esp
+     1b2:	eb e7                	jmp    19b <testgetprocs+0x90>
+  }
+  wait();
+     1b4:	e8 21 0b 00 00       	call   cda <wait>
+}
+     1b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1bc:	c9                   	leave
+     1bd:	c3                   	ret
+
+000001be <getcputime>:
+getcputime(char * name, struct uproc * table){
+     1be:	55                   	push   %ebp
+     1bf:	89 e5                	mov    %esp,%ebp
+     1c1:	57                   	push   %edi
+     1c2:	56                   	push   %esi
+     1c3:	53                   	push   %ebx
+     1c4:	83 ec 24             	sub    $0x24,%esp
+     1c7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     1ca:	89 d7                	mov    %edx,%edi
+  size = getprocs(64, table);
+     1cc:	52                   	push   %edx
+     1cd:	6a 40                	push   $0x40
+     1cf:	e8 d6 0b 00 00       	call   daa <getprocs>
+     1d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(int i = 0; i < size; ++i){
+     1d7:	83 c4 10             	add    $0x10,%esp
+     1da:	be 00 00 00 00       	mov    $0x0,%esi
+     1df:	eb 03                	jmp    1e4 <getcputime+0x26>
+     1e1:	83 c6 01             	add    $0x1,%esi
+     1e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     1e7:	39 c6                	cmp    %eax,%esi
+     1e9:	7d 20                	jge    20b <getcputime+0x4d>
+    if(strcmp(table[i].name, name) == 0){
+     1eb:	8d 1c 76             	lea    (%esi,%esi,2),%ebx
+     1ee:	c1 e3 05             	shl    $0x5,%ebx
+     1f1:	01 fb                	add    %edi,%ebx
+     1f3:	8d 43 40             	lea    0x40(%ebx),%eax
+     1f6:	83 ec 08             	sub    $0x8,%esp
+     1f9:	ff 75 e0             	push   -0x20(%ebp)
+     1fc:	50                   	push   %eax
+     1fd:	e8 92 08 00 00       	call   a94 <strcmp>
+     202:	83 c4 10             	add    $0x10,%esp
+     205:	85 c0                	test   %eax,%eax
+     207:	75 d8                	jne    1e1 <getcputime+0x23>
+     209:	eb 05                	jmp    210 <getcputime+0x52>
+  struct uproc *p = 0;
+     20b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if(p == 0){
+     210:	85 db                	test   %ebx,%ebx
+     212:	74 0b                	je     21f <getcputime+0x61>
+    return p->CPU_total_ticks;
+     214:	8b 43 18             	mov    0x18(%ebx),%eax
+}
+     217:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     21a:	5b                   	pop    %ebx
+     21b:	5e                   	pop    %esi
+     21c:	5f                   	pop    %edi
+     21d:	5d                   	pop    %ebp
+     21e:	c3                   	ret
+    printf(2, "FAILED: Test program \"%s\" not found in table returned by getprocs\n", name);
+     21f:	83 ec 04             	sub    $0x4,%esp
+     222:	ff 75 e0             	push   -0x20(%ebp)
+     225:	68 74 12 00 00       	push   $0x1274
+     22a:	6a 02                	push   $0x2
+     22c:	e8 46 0c 00 00       	call   e77 <printf>
+    return -1;
+     231:	83 c4 10             	add    $0x10,%esp
+     234:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     239:	eb dc                	jmp    217 <getcputime+0x59>
+
+0000023b <testcputime>:
+testcputime(char * name){
+     23b:	55                   	push   %ebp
+     23c:	89 e5                	mov    %esp,%ebp
+     23e:	57                   	push   %edi
+     23f:	56                   	push   %esi
+     240:	53                   	push   %ebx
+     241:	83 ec 24             	sub    $0x24,%esp
+     244:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  printf(1, "\n----------\nRunning CPU Time Test\n----------\n");
+     247:	68 b8 12 00 00       	push   $0x12b8
+     24c:	6a 01                	push   $0x1
+     24e:	e8 24 0c 00 00       	call   e77 <printf>
+  table = malloc(sizeof(struct uproc) * 64);
+     253:	c7 04 24 00 18 00 00 	movl   $0x1800,(%esp)
+     25a:	e8 3e 0e 00 00       	call   109d <malloc>
+  if (!table) {
+     25f:	83 c4 10             	add    $0x10,%esp
+     262:	85 c0                	test   %eax,%eax
+     264:	74 34                	je     29a <testcputime+0x5f>
+     266:	89 c7                	mov    %eax,%edi
+  printf(1, "This will take a couple seconds\n");
+     268:	83 ec 08             	sub    $0x8,%esp
+     26b:	68 e8 12 00 00       	push   $0x12e8
+     270:	6a 01                	push   $0x1
+     272:	e8 00 0c 00 00       	call   e77 <printf>
+  time1 = getcputime(name, table);
+     277:	89 fa                	mov    %edi,%edx
+     279:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     27c:	e8 3d ff ff ff       	call   1be <getcputime>
+     281:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for(i = 0, num = 0; i < 1000000; ++i){
+     284:	83 c4 10             	add    $0x10,%esp
+     287:	bb 00 00 00 00       	mov    $0x0,%ebx
+     28c:	be 00 00 00 00       	mov    $0x0,%esi
+  int success = 0;
+     291:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  for(i = 0, num = 0; i < 1000000; ++i){
+     298:	eb 1e                	jmp    2b8 <testcputime+0x7d>
+    printf(2, "Error: malloc() call failed. %s at line %d\n", __FUNCTION__, __LINE__);
+     29a:	68 c1 00 00 00       	push   $0xc1
+     29f:	68 98 17 00 00       	push   $0x1798
+     2a4:	68 24 11 00 00       	push   $0x1124
+     2a9:	6a 02                	push   $0x2
+     2ab:	e8 c7 0b 00 00       	call   e77 <printf>
+    exit();
+     2b0:	e8 1d 0a 00 00       	call   cd2 <exit>
+  for(i = 0, num = 0; i < 1000000; ++i){
+     2b5:	83 c6 01             	add    $0x1,%esi
+     2b8:	81 fe 3f 42 0f 00    	cmp    $0xf423f,%esi
+     2be:	7f 6c                	jg     32c <testcputime+0xf1>
+    ++num;
+     2c0:	83 c3 01             	add    $0x1,%ebx
+    if(num % 100000 == 0){
+     2c3:	ba 89 b5 f8 14       	mov    $0x14f8b589,%edx
+     2c8:	89 d8                	mov    %ebx,%eax
+     2ca:	f7 ea                	imul   %edx
+     2cc:	c1 fa 0d             	sar    $0xd,%edx
+     2cf:	89 d8                	mov    %ebx,%eax
+     2d1:	c1 f8 1f             	sar    $0x1f,%eax
+     2d4:	29 c2                	sub    %eax,%edx
+     2d6:	69 d2 a0 86 01 00    	imul   $0x186a0,%edx,%edx
+     2dc:	39 d3                	cmp    %edx,%ebx
+     2de:	75 d5                	jne    2b5 <testcputime+0x7a>
+      pre_sleep = getcputime(name, table);
+     2e0:	89 fa                	mov    %edi,%edx
+     2e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     2e5:	e8 d4 fe ff ff       	call   1be <getcputime>
+     2ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      sleep(200);
+     2ed:	83 ec 0c             	sub    $0xc,%esp
+     2f0:	68 c8 00 00 00       	push   $0xc8
+     2f5:	e8 68 0a 00 00       	call   d62 <sleep>
+      post_sleep = getcputime(name, table);
+     2fa:	89 fa                	mov    %edi,%edx
+     2fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     2ff:	e8 ba fe ff ff       	call   1be <getcputime>
+      if((post_sleep - pre_sleep) >= 100){
+     304:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     307:	29 c8                	sub    %ecx,%eax
+     309:	83 c4 10             	add    $0x10,%esp
+     30c:	83 f8 63             	cmp    $0x63,%eax
+     30f:	76 a4                	jbe    2b5 <testcputime+0x7a>
+        printf(2, "FAILED: CPU_total_ticks changed by 100+ milliseconds while process was asleep\n");
+     311:	83 ec 08             	sub    $0x8,%esp
+     314:	68 0c 13 00 00       	push   $0x130c
+     319:	6a 02                	push   $0x2
+     31b:	e8 57 0b 00 00       	call   e77 <printf>
+     320:	83 c4 10             	add    $0x10,%esp
+        success = -1;
+     323:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%ebp)
+     32a:	eb 89                	jmp    2b5 <testcputime+0x7a>
+  time2 = getcputime(name, table);
+     32c:	89 fa                	mov    %edi,%edx
+     32e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     331:	e8 88 fe ff ff       	call   1be <getcputime>
+  if((time2 - time1) > 400){
+     336:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+     339:	29 c8                	sub    %ecx,%eax
+     33b:	89 c3                	mov    %eax,%ebx
+     33d:	3d 90 01 00 00       	cmp    $0x190,%eax
+     342:	77 29                	ja     36d <testcputime+0x132>
+  printf(1, "T2 - T1 = %d milliseconds\n", (time2 - time1));
+     344:	83 ec 04             	sub    $0x4,%esp
+     347:	53                   	push   %ebx
+     348:	68 a0 16 00 00       	push   $0x16a0
+     34d:	6a 01                	push   $0x1
+     34f:	e8 23 0b 00 00       	call   e77 <printf>
+  free(table);
+     354:	89 3c 24             	mov    %edi,(%esp)
+     357:	e8 81 0c 00 00       	call   fdd <free>
+  if(success == 0)
+     35c:	83 c4 10             	add    $0x10,%esp
+     35f:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+     363:	74 24                	je     389 <testcputime+0x14e>
+}
+     365:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     368:	5b                   	pop    %ebx
+     369:	5e                   	pop    %esi
+     36a:	5f                   	pop    %edi
+     36b:	5d                   	pop    %ebp
+     36c:	c3                   	ret
+    printf(2, "ABNORMALLY HIGH: T2 - T1 = %d milliseconds.  Run test again\n", (time2 - time1));
+     36d:	83 ec 04             	sub    $0x4,%esp
+     370:	50                   	push   %eax
+     371:	68 5c 13 00 00       	push   $0x135c
+     376:	6a 02                	push   $0x2
+     378:	e8 fa 0a 00 00       	call   e77 <printf>
+     37d:	83 c4 10             	add    $0x10,%esp
+    success = -1;
+     380:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%ebp)
+     387:	eb bb                	jmp    344 <testcputime+0x109>
+    printf(1, "** All Tests Passed! **\n");
+     389:	83 ec 08             	sub    $0x8,%esp
+     38c:	68 bb 16 00 00       	push   $0x16bb
+     391:	6a 01                	push   $0x1
+     393:	e8 df 0a 00 00       	call   e77 <printf>
+     398:	83 c4 10             	add    $0x10,%esp
+}
+     39b:	eb c8                	jmp    365 <testcputime+0x12a>
+
+0000039d <testuid>:
+testuid(uint new_val, uint expected_get_val, int expected_set_ret){
+     39d:	55                   	push   %ebp
+     39e:	89 e5                	mov    %esp,%ebp
+     3a0:	57                   	push   %edi
+     3a1:	56                   	push   %esi
+     3a2:	53                   	push   %ebx
+     3a3:	83 ec 1c             	sub    $0x1c,%esp
+     3a6:	89 c3                	mov    %eax,%ebx
+     3a8:	89 d7                	mov    %edx,%edi
+     3aa:	89 ce                	mov    %ecx,%esi
+  pre_uid = getuid();
+     3ac:	e8 d1 09 00 00       	call   d82 <getuid>
+     3b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  ret = setuid(new_val);
+     3b4:	83 ec 0c             	sub    $0xc,%esp
+     3b7:	53                   	push   %ebx
+     3b8:	e8 dd 09 00 00       	call   d9a <setuid>
+  if((ret < 0 && expected_set_ret >= 0) || (ret >= 0 && expected_set_ret < 0)){
+     3bd:	83 c4 10             	add    $0x10,%esp
+     3c0:	89 c2                	mov    %eax,%edx
+     3c2:	31 f2                	xor    %esi,%edx
+     3c4:	78 18                	js     3de <testuid+0x41>
+  int success = 0;
+     3c6:	be 00 00 00 00       	mov    $0x0,%esi
+  post_uid = getuid();
+     3cb:	e8 b2 09 00 00       	call   d82 <getuid>
+  if(post_uid != expected_get_val){
+     3d0:	39 f8                	cmp    %edi,%eax
+     3d2:	75 26                	jne    3fa <testuid+0x5d>
+}
+     3d4:	89 f0                	mov    %esi,%eax
+     3d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3d9:	5b                   	pop    %ebx
+     3da:	5e                   	pop    %esi
+     3db:	5f                   	pop    %edi
+     3dc:	5d                   	pop    %ebp
+     3dd:	c3                   	ret
+    printf(2, "FAILED: setuid(%d) returned %d, expected %d\n", new_val, ret, expected_set_ret);
+     3de:	83 ec 0c             	sub    $0xc,%esp
+     3e1:	56                   	push   %esi
+     3e2:	50                   	push   %eax
+     3e3:	53                   	push   %ebx
+     3e4:	68 9c 13 00 00       	push   $0x139c
+     3e9:	6a 02                	push   $0x2
+     3eb:	e8 87 0a 00 00       	call   e77 <printf>
+     3f0:	83 c4 20             	add    $0x20,%esp
+    success = -1;
+     3f3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     3f8:	eb d1                	jmp    3cb <testuid+0x2e>
+    printf(2, "FAILED: UID was %d. After setuid(%d), getuid() returned %d, expected %d\n",
+     3fa:	83 ec 08             	sub    $0x8,%esp
+     3fd:	57                   	push   %edi
+     3fe:	50                   	push   %eax
+     3ff:	53                   	push   %ebx
+     400:	ff 75 e4             	push   -0x1c(%ebp)
+     403:	68 cc 13 00 00       	push   $0x13cc
+     408:	6a 02                	push   $0x2
+     40a:	e8 68 0a 00 00       	call   e77 <printf>
+     40f:	83 c4 20             	add    $0x20,%esp
+    success = -1;
+     412:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return success;
+     417:	eb bb                	jmp    3d4 <testuid+0x37>
+
+00000419 <testgid>:
+testgid(uint new_val, uint expected_get_val, int expected_set_ret){
+     419:	55                   	push   %ebp
+     41a:	89 e5                	mov    %esp,%ebp
+     41c:	57                   	push   %edi
+     41d:	56                   	push   %esi
+     41e:	53                   	push   %ebx
+     41f:	83 ec 1c             	sub    $0x1c,%esp
+     422:	89 c3                	mov    %eax,%ebx
+     424:	89 d7                	mov    %edx,%edi
+     426:	89 ce                	mov    %ecx,%esi
+  pre_gid = getgid();
+     428:	e8 5d 09 00 00       	call   d8a <getgid>
+     42d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  ret = setgid(new_val);
+     430:	83 ec 0c             	sub    $0xc,%esp
+     433:	53                   	push   %ebx
+     434:	e8 69 09 00 00       	call   da2 <setgid>
+  if((ret < 0 && expected_set_ret >= 0) || (ret >= 0 && expected_set_ret < 0)){
+     439:	83 c4 10             	add    $0x10,%esp
+     43c:	89 c2                	mov    %eax,%edx
+     43e:	31 f2                	xor    %esi,%edx
+     440:	78 18                	js     45a <testgid+0x41>
+  int success = 0;
+     442:	be 00 00 00 00       	mov    $0x0,%esi
+  post_gid = getgid();
+     447:	e8 3e 09 00 00       	call   d8a <getgid>
+  if(post_gid != expected_get_val){
+     44c:	39 f8                	cmp    %edi,%eax
+     44e:	75 26                	jne    476 <testgid+0x5d>
+}
+     450:	89 f0                	mov    %esi,%eax
+     452:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     455:	5b                   	pop    %ebx
+     456:	5e                   	pop    %esi
+     457:	5f                   	pop    %edi
+     458:	5d                   	pop    %ebp
+     459:	c3                   	ret
+    printf(2, "FAILED: setgid(%d) returned %d, expected %d\n", new_val, ret, expected_set_ret);
+     45a:	83 ec 0c             	sub    $0xc,%esp
+     45d:	56                   	push   %esi
+     45e:	50                   	push   %eax
+     45f:	53                   	push   %ebx
+     460:	68 18 14 00 00       	push   $0x1418
+     465:	6a 02                	push   $0x2
+     467:	e8 0b 0a 00 00       	call   e77 <printf>
+     46c:	83 c4 20             	add    $0x20,%esp
+    success = -1;
+     46f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     474:	eb d1                	jmp    447 <testgid+0x2e>
+    printf(2, "FAILED: UID was %d. After setgid(%d), getgid() returned %d, expected %d\n",
+     476:	83 ec 08             	sub    $0x8,%esp
+     479:	57                   	push   %edi
+     47a:	50                   	push   %eax
+     47b:	53                   	push   %ebx
+     47c:	ff 75 e4             	push   -0x1c(%ebp)
+     47f:	68 48 14 00 00       	push   $0x1448
+     484:	6a 02                	push   $0x2
+     486:	e8 ec 09 00 00       	call   e77 <printf>
+     48b:	83 c4 20             	add    $0x20,%esp
+    success = -1;
+     48e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  return success;
+     493:	eb bb                	jmp    450 <testgid+0x37>
+
+00000495 <testuidgid>:
+{
+     495:	55                   	push   %ebp
+     496:	89 e5                	mov    %esp,%ebp
+     498:	53                   	push   %ebx
+     499:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "\n----------\nRunning UID / GID Tests\n----------\n");
+     49c:	68 94 14 00 00       	push   $0x1494
+     4a1:	6a 01                	push   $0x1
+     4a3:	e8 cf 09 00 00       	call   e77 <printf>
+  uid = getuid();
+     4a8:	e8 d5 08 00 00       	call   d82 <getuid>
+  if(uid < 0 || uid > 32767){
+     4ad:	83 c4 10             	add    $0x10,%esp
+     4b0:	3d ff 7f 00 00       	cmp    $0x7fff,%eax
+     4b5:	0f 87 3b 01 00 00    	ja     5f6 <testuidgid+0x161>
+  int success = 0;
+     4bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (testuid(0, 0, 0))
+     4c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+     4c5:	ba 00 00 00 00       	mov    $0x0,%edx
+     4ca:	b8 00 00 00 00       	mov    $0x0,%eax
+     4cf:	e8 c9 fe ff ff       	call   39d <testuid>
+     4d4:	85 c0                	test   %eax,%eax
+     4d6:	74 05                	je     4dd <testuidgid+0x48>
+    success = -1;
+     4d8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  if (testuid(5, 5, 0))
+     4dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+     4e2:	ba 05 00 00 00       	mov    $0x5,%edx
+     4e7:	b8 05 00 00 00       	mov    $0x5,%eax
+     4ec:	e8 ac fe ff ff       	call   39d <testuid>
+     4f1:	85 c0                	test   %eax,%eax
+     4f3:	74 05                	je     4fa <testuidgid+0x65>
+    success = -1;
+     4f5:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  if (testuid(32767, 32767, 0))
+     4fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+     4ff:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     504:	b8 ff 7f 00 00       	mov    $0x7fff,%eax
+     509:	e8 8f fe ff ff       	call   39d <testuid>
+     50e:	85 c0                	test   %eax,%eax
+     510:	74 05                	je     517 <testuidgid+0x82>
+    success = -1;
+     512:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  if (testuid(32768, 32767, -1))
+     517:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     51c:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     521:	b8 00 80 00 00       	mov    $0x8000,%eax
+     526:	e8 72 fe ff ff       	call   39d <testuid>
+     52b:	85 c0                	test   %eax,%eax
+     52d:	74 05                	je     534 <testuidgid+0x9f>
+    success = -1;
+     52f:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  if (testuid(-1, 32767, -1))
+     534:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     539:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     53e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     543:	e8 55 fe ff ff       	call   39d <testuid>
+     548:	85 c0                	test   %eax,%eax
+     54a:	74 05                	je     551 <testuidgid+0xbc>
+    success = -1;
+     54c:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  gid = getgid();
+     551:	e8 34 08 00 00       	call   d8a <getgid>
+  if(gid < 0 || gid > 32767){
+     556:	3d ff 7f 00 00       	cmp    $0x7fff,%eax
+     55b:	0f 87 b2 00 00 00    	ja     613 <testuidgid+0x17e>
+  if (testgid(0, 0, 0))
+     561:	b9 00 00 00 00       	mov    $0x0,%ecx
+     566:	ba 00 00 00 00       	mov    $0x0,%edx
+     56b:	b8 00 00 00 00       	mov    $0x0,%eax
+     570:	e8 a4 fe ff ff       	call   419 <testgid>
+     575:	85 c0                	test   %eax,%eax
+     577:	74 05                	je     57e <testuidgid+0xe9>
+    success = -1;
+     579:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  if (testgid(5, 5, 0))
+     57e:	b9 00 00 00 00       	mov    $0x0,%ecx
+     583:	ba 05 00 00 00       	mov    $0x5,%edx
+     588:	b8 05 00 00 00       	mov    $0x5,%eax
+     58d:	e8 87 fe ff ff       	call   419 <testgid>
+     592:	85 c0                	test   %eax,%eax
+     594:	74 05                	je     59b <testuidgid+0x106>
+    success = -1;
+     596:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  if (testgid(32767, 32767, 0))
+     59b:	b9 00 00 00 00       	mov    $0x0,%ecx
+     5a0:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     5a5:	b8 ff 7f 00 00       	mov    $0x7fff,%eax
+     5aa:	e8 6a fe ff ff       	call   419 <testgid>
+     5af:	85 c0                	test   %eax,%eax
+     5b1:	74 05                	je     5b8 <testuidgid+0x123>
+    success = -1;
+     5b3:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  if (testgid(-1, 32767, -1))
+     5b8:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     5bd:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     5c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5c7:	e8 4d fe ff ff       	call   419 <testgid>
+     5cc:	85 c0                	test   %eax,%eax
+     5ce:	74 05                	je     5d5 <testuidgid+0x140>
+    success = -1;
+     5d0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  if (testgid(32768, 32767, -1))
+     5d5:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+     5da:	ba ff 7f 00 00       	mov    $0x7fff,%edx
+     5df:	b8 00 80 00 00       	mov    $0x8000,%eax
+     5e4:	e8 30 fe ff ff       	call   419 <testgid>
+     5e9:	85 c0                	test   %eax,%eax
+     5eb:	75 04                	jne    5f1 <testuidgid+0x15c>
+  if (success == 0)
+     5ed:	85 db                	test   %ebx,%ebx
+     5ef:	74 3f                	je     630 <testuidgid+0x19b>
+}
+     5f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5f4:	c9                   	leave
+     5f5:	c3                   	ret
+    printf(1, "FAILED: Default UID %d, out of range\n", uid);
+     5f6:	83 ec 04             	sub    $0x4,%esp
+     5f9:	50                   	push   %eax
+     5fa:	68 c4 14 00 00       	push   $0x14c4
+     5ff:	6a 01                	push   $0x1
+     601:	e8 71 08 00 00       	call   e77 <printf>
+     606:	83 c4 10             	add    $0x10,%esp
+    success = -1;
+     609:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+     60e:	e9 ad fe ff ff       	jmp    4c0 <testuidgid+0x2b>
+    printf(1, "FAILED: Default GID %d, out of range\n", gid);
+     613:	83 ec 04             	sub    $0x4,%esp
+     616:	50                   	push   %eax
+     617:	68 ec 14 00 00       	push   $0x14ec
+     61c:	6a 01                	push   $0x1
+     61e:	e8 54 08 00 00       	call   e77 <printf>
+     623:	83 c4 10             	add    $0x10,%esp
+    success = -1;
+     626:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+     62b:	e9 31 ff ff ff       	jmp    561 <testuidgid+0xcc>
+    printf(1, "** All tests passed! **\n");
+     630:	83 ec 08             	sub    $0x8,%esp
+     633:	68 d4 16 00 00       	push   $0x16d4
+     638:	6a 01                	push   $0x1
+     63a:	e8 38 08 00 00       	call   e77 <printf>
+     63f:	83 c4 10             	add    $0x10,%esp
+}
+     642:	eb ad                	jmp    5f1 <testuidgid+0x15c>
+
+00000644 <testuidgidinheritance>:
+testuidgidinheritance(void){
+     644:	55                   	push   %ebp
+     645:	89 e5                	mov    %esp,%ebp
+     647:	53                   	push   %ebx
+     648:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "\n----------\nRunning UID / GID Inheritance Test\n----------\n");
+     64b:	68 14 15 00 00       	push   $0x1514
+     650:	6a 01                	push   $0x1
+     652:	e8 20 08 00 00       	call   e77 <printf>
+  if (testuid(12345, 12345, 0))
+     657:	b9 00 00 00 00       	mov    $0x0,%ecx
+     65c:	ba 39 30 00 00       	mov    $0x3039,%edx
+     661:	b8 39 30 00 00       	mov    $0x3039,%eax
+     666:	e8 32 fd ff ff       	call   39d <testuid>
+     66b:	89 c3                	mov    %eax,%ebx
+     66d:	83 c4 10             	add    $0x10,%esp
+     670:	85 c0                	test   %eax,%eax
+     672:	74 05                	je     679 <testuidgidinheritance+0x35>
+    success = -1;
+     674:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  if (testgid(12345, 12345, 0))
+     679:	b9 00 00 00 00       	mov    $0x0,%ecx
+     67e:	ba 39 30 00 00       	mov    $0x3039,%edx
+     683:	b8 39 30 00 00       	mov    $0x3039,%eax
+     688:	e8 8c fd ff ff       	call   419 <testgid>
+     68d:	85 c0                	test   %eax,%eax
+     68f:	75 04                	jne    695 <testuidgidinheritance+0x51>
+  if(success != 0)
+     691:	85 db                	test   %ebx,%ebx
+     693:	74 05                	je     69a <testuidgidinheritance+0x56>
+}
+     695:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     698:	c9                   	leave
+     699:	c3                   	ret
+  ret = fork();
+     69a:	e8 2b 06 00 00       	call   cca <fork>
+  if(ret == 0){
+     69f:	85 c0                	test   %eax,%eax
+     6a1:	74 07                	je     6aa <testuidgidinheritance+0x66>
+    wait();
+     6a3:	e8 32 06 00 00       	call   cda <wait>
+     6a8:	eb eb                	jmp    695 <testuidgidinheritance+0x51>
+    uid = getuid();
+     6aa:	e8 d3 06 00 00       	call   d82 <getuid>
+     6af:	89 c3                	mov    %eax,%ebx
+    gid = getgid();
+     6b1:	e8 d4 06 00 00       	call   d8a <getgid>
+    if(uid != 12345){
+     6b6:	81 fb 39 30 00 00    	cmp    $0x3039,%ebx
+     6bc:	75 1c                	jne    6da <testuidgidinheritance+0x96>
+    else if(gid != 12345){
+     6be:	3d 39 30 00 00       	cmp    $0x3039,%eax
+     6c3:	74 2d                	je     6f2 <testuidgidinheritance+0xae>
+      printf(2, "FAILED: Parent GID is 12345, child GID is %d\n", gid);
+     6c5:	83 ec 04             	sub    $0x4,%esp
+     6c8:	50                   	push   %eax
+     6c9:	68 80 15 00 00       	push   $0x1580
+     6ce:	6a 02                	push   $0x2
+     6d0:	e8 a2 07 00 00       	call   e77 <printf>
+     6d5:	83 c4 10             	add    $0x10,%esp
+     6d8:	eb 13                	jmp    6ed <testuidgidinheritance+0xa9>
+      printf(2, "FAILED: Parent UID is 12345, child UID is %d\n", uid);
+     6da:	83 ec 04             	sub    $0x4,%esp
+     6dd:	53                   	push   %ebx
+     6de:	68 50 15 00 00       	push   $0x1550
+     6e3:	6a 02                	push   $0x2
+     6e5:	e8 8d 07 00 00       	call   e77 <printf>
+     6ea:	83 c4 10             	add    $0x10,%esp
+    exit();
+     6ed:	e8 e0 05 00 00       	call   cd2 <exit>
+      printf(1, "** Test Passed! **\n");
+     6f2:	83 ec 08             	sub    $0x8,%esp
+     6f5:	68 ed 16 00 00       	push   $0x16ed
+     6fa:	6a 01                	push   $0x1
+     6fc:	e8 76 07 00 00       	call   e77 <printf>
+     701:	83 c4 10             	add    $0x10,%esp
+     704:	eb e7                	jmp    6ed <testuidgidinheritance+0xa9>
+
+00000706 <testppid>:
+testppid(void){
+     706:	55                   	push   %ebp
+     707:	89 e5                	mov    %esp,%ebp
+     709:	53                   	push   %ebx
+     70a:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "\n----------\nRunning PPID Test\n----------\n");
+     70d:	68 b0 15 00 00       	push   $0x15b0
+     712:	6a 01                	push   $0x1
+     714:	e8 5e 07 00 00       	call   e77 <printf>
+  pid = getpid();
+     719:	e8 34 06 00 00       	call   d52 <getpid>
+     71e:	89 c3                	mov    %eax,%ebx
+  ret = fork();
+     720:	e8 a5 05 00 00       	call   cca <fork>
+  if(ret == 0){
+     725:	83 c4 10             	add    $0x10,%esp
+     728:	85 c0                	test   %eax,%eax
+     72a:	74 0a                	je     736 <testppid+0x30>
+    wait();
+     72c:	e8 a9 05 00 00       	call   cda <wait>
+}
+     731:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     734:	c9                   	leave
+     735:	c3                   	ret
+    ppid = getppid();
+     736:	e8 57 06 00 00       	call   d92 <getppid>
+    if(ppid != pid)
+     73b:	39 c3                	cmp    %eax,%ebx
+     73d:	74 16                	je     755 <testppid+0x4f>
+      printf(2, "FAILED: Parent PID is %d, Child's PPID is %d\n", pid, ppid);
+     73f:	50                   	push   %eax
+     740:	53                   	push   %ebx
+     741:	68 dc 15 00 00       	push   $0x15dc
+     746:	6a 02                	push   $0x2
+     748:	e8 2a 07 00 00       	call   e77 <printf>
+     74d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     750:	e8 7d 05 00 00       	call   cd2 <exit>
+      printf(1, "** Test passed! **\n");
+     755:	83 ec 08             	sub    $0x8,%esp
+     758:	68 01 17 00 00       	push   $0x1701
+     75d:	6a 01                	push   $0x1
+     75f:	e8 13 07 00 00       	call   e77 <printf>
+     764:	83 c4 10             	add    $0x10,%esp
+     767:	eb e7                	jmp    750 <testppid+0x4a>
+
+00000769 <testtimewitharg>:
+#endif
+
+#ifdef TIME_TEST
+// Forks a process and execs with time + args to see how it handles no args, invalid args, mulitple args
+void
+testtimewitharg(char **arg){
+     769:	55                   	push   %ebp
+     76a:	89 e5                	mov    %esp,%ebp
+     76c:	83 ec 08             	sub    $0x8,%esp
+  int ret;
+
+  ret = fork();
+     76f:	e8 56 05 00 00       	call   cca <fork>
+  if (ret == 0){
+     774:	85 c0                	test   %eax,%eax
+     776:	74 0c                	je     784 <testtimewitharg+0x1b>
+    exec(arg[0], arg);
+    printf(2, "FAILED: exec failed to execute %s\n", arg[0]);
+    exit();
+  }
+  else if(ret == -1){
+     778:	83 f8 ff             	cmp    $0xffffffff,%eax
+     77b:	74 30                	je     7ad <testtimewitharg+0x44>
+    printf(2, "FAILED: fork failed\n");
+  }
+  else
+    wait();
+     77d:	e8 58 05 00 00       	call   cda <wait>
+}
+     782:	c9                   	leave
+     783:	c3                   	ret
+    exec(arg[0], arg);
+     784:	83 ec 08             	sub    $0x8,%esp
+     787:	ff 75 08             	push   0x8(%ebp)
+     78a:	8b 45 08             	mov    0x8(%ebp),%eax
+     78d:	ff 30                	push   (%eax)
+     78f:	e8 76 05 00 00       	call   d0a <exec>
+    printf(2, "FAILED: exec failed to execute %s\n", arg[0]);
+     794:	83 c4 0c             	add    $0xc,%esp
+     797:	8b 45 08             	mov    0x8(%ebp),%eax
+     79a:	ff 30                	push   (%eax)
+     79c:	68 0c 16 00 00       	push   $0x160c
+     7a1:	6a 02                	push   $0x2
+     7a3:	e8 cf 06 00 00       	call   e77 <printf>
+    exit();
+     7a8:	e8 25 05 00 00       	call   cd2 <exit>
+    printf(2, "FAILED: fork failed\n");
+     7ad:	83 ec 08             	sub    $0x8,%esp
+     7b0:	68 15 17 00 00       	push   $0x1715
+     7b5:	6a 02                	push   $0x2
+     7b7:	e8 bb 06 00 00       	call   e77 <printf>
+     7bc:	83 c4 10             	add    $0x10,%esp
+     7bf:	eb c1                	jmp    782 <testtimewitharg+0x19>
+
+000007c1 <testtime>:
+void
+testtime(void){
+     7c1:	55                   	push   %ebp
+     7c2:	89 e5                	mov    %esp,%ebp
+     7c4:	57                   	push   %edi
+     7c5:	56                   	push   %esi
+     7c6:	53                   	push   %ebx
+     7c7:	83 ec 28             	sub    $0x28,%esp
+  char **arg1 = malloc(sizeof(char *));
+     7ca:	6a 04                	push   $0x4
+     7cc:	e8 cc 08 00 00       	call   109d <malloc>
+     7d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  char **arg2 = malloc(sizeof(char *)*2);
+     7d4:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     7db:	e8 bd 08 00 00       	call   109d <malloc>
+     7e0:	89 c7                	mov    %eax,%edi
+  char **arg3 = malloc(sizeof(char *)*2);
+     7e2:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     7e9:	e8 af 08 00 00       	call   109d <malloc>
+     7ee:	89 c6                	mov    %eax,%esi
+  char **arg4 = malloc(sizeof(char *)*4);
+     7f0:	c7 04 24 10 00 00 00 	movl   $0x10,(%esp)
+     7f7:	e8 a1 08 00 00       	call   109d <malloc>
+     7fc:	89 c3                	mov    %eax,%ebx
+
+  arg1[0] = malloc(sizeof(char) * 5);
+     7fe:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     805:	e8 93 08 00 00       	call   109d <malloc>
+     80a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     80d:	89 02                	mov    %eax,(%edx)
+  strcpy(arg1[0], "time");
+     80f:	83 c4 08             	add    $0x8,%esp
+     812:	68 2a 17 00 00       	push   $0x172a
+     817:	50                   	push   %eax
+     818:	e8 51 02 00 00       	call   a6e <strcpy>
+
+  arg2[0] = malloc(sizeof(char) * 5);
+     81d:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     824:	e8 74 08 00 00       	call   109d <malloc>
+     829:	89 07                	mov    %eax,(%edi)
+  strcpy(arg2[0], "time");
+     82b:	83 c4 08             	add    $0x8,%esp
+     82e:	68 2a 17 00 00       	push   $0x172a
+     833:	50                   	push   %eax
+     834:	e8 35 02 00 00       	call   a6e <strcpy>
+  arg2[1] = malloc(sizeof(char) * 4);
+     839:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+     840:	e8 58 08 00 00       	call   109d <malloc>
+     845:	89 47 04             	mov    %eax,0x4(%edi)
+  strcpy(arg2[1], "abc");
+     848:	83 c4 08             	add    $0x8,%esp
+     84b:	68 2f 17 00 00       	push   $0x172f
+     850:	50                   	push   %eax
+     851:	e8 18 02 00 00       	call   a6e <strcpy>
+
+  arg3[0] = malloc(sizeof(char) * 5);
+     856:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     85d:	e8 3b 08 00 00       	call   109d <malloc>
+     862:	89 06                	mov    %eax,(%esi)
+  strcpy(arg3[0], "time");
+     864:	83 c4 08             	add    $0x8,%esp
+     867:	68 2a 17 00 00       	push   $0x172a
+     86c:	50                   	push   %eax
+     86d:	e8 fc 01 00 00       	call   a6e <strcpy>
+  arg3[1] = malloc(sizeof(char) * 5);
+     872:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     879:	e8 1f 08 00 00       	call   109d <malloc>
+     87e:	89 46 04             	mov    %eax,0x4(%esi)
+  strcpy(arg3[1], "date");
+     881:	83 c4 08             	add    $0x8,%esp
+     884:	68 33 17 00 00       	push   $0x1733
+     889:	50                   	push   %eax
+     88a:	e8 df 01 00 00       	call   a6e <strcpy>
+
+  arg4[0] = malloc(sizeof(char) * 5);
+     88f:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     896:	e8 02 08 00 00       	call   109d <malloc>
+     89b:	89 03                	mov    %eax,(%ebx)
+  strcpy(arg4[0], "time");
+     89d:	83 c4 08             	add    $0x8,%esp
+     8a0:	68 2a 17 00 00       	push   $0x172a
+     8a5:	50                   	push   %eax
+     8a6:	e8 c3 01 00 00       	call   a6e <strcpy>
+  arg4[1] = malloc(sizeof(char) * 5);
+     8ab:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     8b2:	e8 e6 07 00 00       	call   109d <malloc>
+     8b7:	89 43 04             	mov    %eax,0x4(%ebx)
+  strcpy(arg4[1], "time");
+     8ba:	83 c4 08             	add    $0x8,%esp
+     8bd:	68 2a 17 00 00       	push   $0x172a
+     8c2:	50                   	push   %eax
+     8c3:	e8 a6 01 00 00       	call   a6e <strcpy>
+  arg4[2] = malloc(sizeof(char) * 5);
+     8c8:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     8cf:	e8 c9 07 00 00       	call   109d <malloc>
+     8d4:	89 43 08             	mov    %eax,0x8(%ebx)
+  strcpy(arg4[2], "echo");
+     8d7:	83 c4 08             	add    $0x8,%esp
+     8da:	68 38 17 00 00       	push   $0x1738
+     8df:	50                   	push   %eax
+     8e0:	e8 89 01 00 00       	call   a6e <strcpy>
+  arg4[3] = malloc(sizeof(char) * 6);
+     8e5:	c7 04 24 06 00 00 00 	movl   $0x6,(%esp)
+     8ec:	e8 ac 07 00 00       	call   109d <malloc>
+     8f1:	89 43 0c             	mov    %eax,0xc(%ebx)
+  strcpy(arg4[3], "\"abc\"");
+     8f4:	83 c4 08             	add    $0x8,%esp
+     8f7:	68 3d 17 00 00       	push   $0x173d
+     8fc:	50                   	push   %eax
+     8fd:	e8 6c 01 00 00       	call   a6e <strcpy>
+
+  printf(1, "\n----------\nRunning Time Test\n----------\n");
+     902:	83 c4 08             	add    $0x8,%esp
+     905:	68 30 16 00 00       	push   $0x1630
+     90a:	6a 01                	push   $0x1
+     90c:	e8 66 05 00 00       	call   e77 <printf>
+  printf(1, "You will need to verify these tests passed\n");
+     911:	83 c4 08             	add    $0x8,%esp
+     914:	68 5c 16 00 00       	push   $0x165c
+     919:	6a 01                	push   $0x1
+     91b:	e8 57 05 00 00       	call   e77 <printf>
+
+  printf(1,"\n%s\n", arg1[0]);
+     920:	83 c4 0c             	add    $0xc,%esp
+     923:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     926:	ff 32                	push   (%edx)
+     928:	68 43 17 00 00       	push   $0x1743
+     92d:	6a 01                	push   $0x1
+     92f:	e8 43 05 00 00       	call   e77 <printf>
+  testtimewitharg(arg1);
+     934:	83 c4 04             	add    $0x4,%esp
+     937:	ff 75 e4             	push   -0x1c(%ebp)
+     93a:	e8 2a fe ff ff       	call   769 <testtimewitharg>
+  printf(1,"\n%s %s\n", arg2[0], arg2[1]);
+     93f:	ff 77 04             	push   0x4(%edi)
+     942:	ff 37                	push   (%edi)
+     944:	68 48 17 00 00       	push   $0x1748
+     949:	6a 01                	push   $0x1
+     94b:	e8 27 05 00 00       	call   e77 <printf>
+  testtimewitharg(arg2);
+     950:	83 c4 14             	add    $0x14,%esp
+     953:	57                   	push   %edi
+     954:	e8 10 fe ff ff       	call   769 <testtimewitharg>
+  printf(1,"\n%s %s\n", arg3[0], arg3[1]);
+     959:	ff 76 04             	push   0x4(%esi)
+     95c:	ff 36                	push   (%esi)
+     95e:	68 48 17 00 00       	push   $0x1748
+     963:	6a 01                	push   $0x1
+     965:	e8 0d 05 00 00       	call   e77 <printf>
+  testtimewitharg(arg3);
+     96a:	83 c4 14             	add    $0x14,%esp
+     96d:	56                   	push   %esi
+     96e:	e8 f6 fd ff ff       	call   769 <testtimewitharg>
+  printf(1,"\n%s %s %s %s\n", arg4[0], arg4[1], arg4[2], arg4[3]);
+     973:	83 c4 08             	add    $0x8,%esp
+     976:	ff 73 0c             	push   0xc(%ebx)
+     979:	ff 73 08             	push   0x8(%ebx)
+     97c:	ff 73 04             	push   0x4(%ebx)
+     97f:	ff 33                	push   (%ebx)
+     981:	68 50 17 00 00       	push   $0x1750
+     986:	6a 01                	push   $0x1
+     988:	e8 ea 04 00 00       	call   e77 <printf>
+  testtimewitharg(arg4);
+     98d:	83 c4 14             	add    $0x14,%esp
+     990:	53                   	push   %ebx
+     991:	e8 d3 fd ff ff       	call   769 <testtimewitharg>
+
+  free(arg1[0]);
+     996:	83 c4 04             	add    $0x4,%esp
+     999:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     99c:	ff 32                	push   (%edx)
+     99e:	e8 3a 06 00 00       	call   fdd <free>
+  free(arg1);
+     9a3:	83 c4 04             	add    $0x4,%esp
+     9a6:	ff 75 e4             	push   -0x1c(%ebp)
+     9a9:	e8 2f 06 00 00       	call   fdd <free>
+  free(arg2[0]); free(arg2[1]);
+     9ae:	83 c4 04             	add    $0x4,%esp
+     9b1:	ff 37                	push   (%edi)
+     9b3:	e8 25 06 00 00       	call   fdd <free>
+     9b8:	83 c4 04             	add    $0x4,%esp
+     9bb:	ff 77 04             	push   0x4(%edi)
+     9be:	e8 1a 06 00 00       	call   fdd <free>
+  free(arg2);
+     9c3:	89 3c 24             	mov    %edi,(%esp)
+     9c6:	e8 12 06 00 00       	call   fdd <free>
+  free(arg3[0]); free(arg3[1]);
+     9cb:	83 c4 04             	add    $0x4,%esp
+     9ce:	ff 36                	push   (%esi)
+     9d0:	e8 08 06 00 00       	call   fdd <free>
+     9d5:	83 c4 04             	add    $0x4,%esp
+     9d8:	ff 76 04             	push   0x4(%esi)
+     9db:	e8 fd 05 00 00       	call   fdd <free>
+  free(arg3);
+     9e0:	89 34 24             	mov    %esi,(%esp)
+     9e3:	e8 f5 05 00 00       	call   fdd <free>
+  free(arg4[0]); free(arg4[1]); free(arg4[2]); free(arg4[3]);
+     9e8:	83 c4 04             	add    $0x4,%esp
+     9eb:	ff 33                	push   (%ebx)
+     9ed:	e8 eb 05 00 00       	call   fdd <free>
+     9f2:	83 c4 04             	add    $0x4,%esp
+     9f5:	ff 73 04             	push   0x4(%ebx)
+     9f8:	e8 e0 05 00 00       	call   fdd <free>
+     9fd:	83 c4 04             	add    $0x4,%esp
+     a00:	ff 73 08             	push   0x8(%ebx)
+     a03:	e8 d5 05 00 00       	call   fdd <free>
+     a08:	83 c4 04             	add    $0x4,%esp
+     a0b:	ff 73 0c             	push   0xc(%ebx)
+     a0e:	e8 ca 05 00 00       	call   fdd <free>
+  free(arg4);
+     a13:	89 1c 24             	mov    %ebx,(%esp)
+     a16:	e8 c2 05 00 00       	call   fdd <free>
+}
+     a1b:	83 c4 10             	add    $0x10,%esp
+     a1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a21:	5b                   	pop    %ebx
+     a22:	5e                   	pop    %esi
+     a23:	5f                   	pop    %edi
+     a24:	5d                   	pop    %ebp
+     a25:	c3                   	ret
+
+00000a26 <main>:
+#endif
+
+int
+main(int argc, char *argv[])
+{
+     a26:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     a2a:	83 e4 f0             	and    $0xfffffff0,%esp
+     a2d:	ff 71 fc             	push   -0x4(%ecx)
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	51                   	push   %ecx
+     a34:	83 ec 04             	sub    $0x4,%esp
+     a37:	8b 41 04             	mov    0x4(%ecx),%eax
+  #ifdef CPUTIME_TEST
+  testcputime(argv[0]);
+     a3a:	8b 00                	mov    (%eax),%eax
+     a3c:	e8 fa f7 ff ff       	call   23b <testcputime>
+  #endif
+  #ifdef UIDGIDPPID_TEST
+  testuidgid();
+     a41:	e8 4f fa ff ff       	call   495 <testuidgid>
+  testuidgidinheritance();
+     a46:	e8 f9 fb ff ff       	call   644 <testuidgidinheritance>
+  testppid();
+     a4b:	e8 b6 fc ff ff       	call   706 <testppid>
+  #endif
+  #ifdef GETPROCS_TEST
+  testgetprocs();  // no need to pass argv[0]
+     a50:	e8 b6 f6 ff ff       	call   10b <testgetprocs>
+  #endif
+  #ifdef TIME_TEST
+  testtime();
+     a55:	e8 67 fd ff ff       	call   7c1 <testtime>
+  #endif
+  printf(1, "\n** End of Tests **\n");
+     a5a:	83 ec 08             	sub    $0x8,%esp
+     a5d:	68 5e 17 00 00       	push   $0x175e
+     a62:	6a 01                	push   $0x1
+     a64:	e8 0e 04 00 00       	call   e77 <printf>
+  exit();
+     a69:	e8 64 02 00 00       	call   cd2 <exit>
+
+00000a6e <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     a6e:	55                   	push   %ebp
+     a6f:	89 e5                	mov    %esp,%ebp
+     a71:	56                   	push   %esi
+     a72:	53                   	push   %ebx
+     a73:	8b 75 08             	mov    0x8(%ebp),%esi
+     a76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     a79:	89 f0                	mov    %esi,%eax
+     a7b:	89 d1                	mov    %edx,%ecx
+     a7d:	83 c2 01             	add    $0x1,%edx
+     a80:	89 c3                	mov    %eax,%ebx
+     a82:	83 c0 01             	add    $0x1,%eax
+     a85:	0f b6 09             	movzbl (%ecx),%ecx
+     a88:	88 0b                	mov    %cl,(%ebx)
+     a8a:	84 c9                	test   %cl,%cl
+     a8c:	75 ed                	jne    a7b <strcpy+0xd>
+    ;
+  return os;
+}
+     a8e:	89 f0                	mov    %esi,%eax
+     a90:	5b                   	pop    %ebx
+     a91:	5e                   	pop    %esi
+     a92:	5d                   	pop    %ebp
+     a93:	c3                   	ret
+
+00000a94 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     a94:	55                   	push   %ebp
+     a95:	89 e5                	mov    %esp,%ebp
+     a97:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     a9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     a9d:	eb 06                	jmp    aa5 <strcmp+0x11>
+    p++, q++;
+     a9f:	83 c1 01             	add    $0x1,%ecx
+     aa2:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     aa5:	0f b6 01             	movzbl (%ecx),%eax
+     aa8:	84 c0                	test   %al,%al
+     aaa:	74 04                	je     ab0 <strcmp+0x1c>
+     aac:	3a 02                	cmp    (%edx),%al
+     aae:	74 ef                	je     a9f <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     ab0:	0f b6 c0             	movzbl %al,%eax
+     ab3:	0f b6 12             	movzbl (%edx),%edx
+     ab6:	29 d0                	sub    %edx,%eax
+}
+     ab8:	5d                   	pop    %ebp
+     ab9:	c3                   	ret
+
+00000aba <strlen>:
+
+uint
+strlen(char *s)
+{
+     aba:	55                   	push   %ebp
+     abb:	89 e5                	mov    %esp,%ebp
+     abd:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+     ac5:	eb 03                	jmp    aca <strlen+0x10>
+     ac7:	83 c0 01             	add    $0x1,%eax
+     aca:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     ace:	75 f7                	jne    ac7 <strlen+0xd>
+    ;
+  return n;
+}
+     ad0:	5d                   	pop    %ebp
+     ad1:	c3                   	ret
+
+00000ad2 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     ad2:	55                   	push   %ebp
+     ad3:	89 e5                	mov    %esp,%ebp
+     ad5:	57                   	push   %edi
+     ad6:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     ad9:	89 d7                	mov    %edx,%edi
+     adb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ade:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ae1:	fc                   	cld
+     ae2:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     ae4:	89 d0                	mov    %edx,%eax
+     ae6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     ae9:	c9                   	leave
+     aea:	c3                   	ret
+
+00000aeb <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     aeb:	55                   	push   %ebp
+     aec:	89 e5                	mov    %esp,%ebp
+     aee:	8b 45 08             	mov    0x8(%ebp),%eax
+     af1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     af5:	eb 03                	jmp    afa <strchr+0xf>
+     af7:	83 c0 01             	add    $0x1,%eax
+     afa:	0f b6 10             	movzbl (%eax),%edx
+     afd:	84 d2                	test   %dl,%dl
+     aff:	74 06                	je     b07 <strchr+0x1c>
+    if(*s == c)
+     b01:	38 ca                	cmp    %cl,%dl
+     b03:	75 f2                	jne    af7 <strchr+0xc>
+     b05:	eb 05                	jmp    b0c <strchr+0x21>
+      return (char*)s;
+  return 0;
+     b07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     b0c:	5d                   	pop    %ebp
+     b0d:	c3                   	ret
+
+00000b0e <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     b0e:	55                   	push   %ebp
+     b0f:	89 e5                	mov    %esp,%ebp
+     b11:	57                   	push   %edi
+     b12:	56                   	push   %esi
+     b13:	53                   	push   %ebx
+     b14:	83 ec 1c             	sub    $0x1c,%esp
+     b17:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     b1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     b1f:	89 de                	mov    %ebx,%esi
+     b21:	83 c3 01             	add    $0x1,%ebx
+     b24:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     b27:	7d 2e                	jge    b57 <gets+0x49>
+    cc = read(0, &c, 1);
+     b29:	83 ec 04             	sub    $0x4,%esp
+     b2c:	6a 01                	push   $0x1
+     b2e:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     b31:	50                   	push   %eax
+     b32:	6a 00                	push   $0x0
+     b34:	e8 b1 01 00 00       	call   cea <read>
+    if(cc < 1)
+     b39:	83 c4 10             	add    $0x10,%esp
+     b3c:	85 c0                	test   %eax,%eax
+     b3e:	7e 17                	jle    b57 <gets+0x49>
+      break;
+    buf[i++] = c;
+     b40:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     b44:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     b47:	3c 0a                	cmp    $0xa,%al
+     b49:	0f 94 c2             	sete   %dl
+     b4c:	3c 0d                	cmp    $0xd,%al
+     b4e:	0f 94 c0             	sete   %al
+     b51:	08 c2                	or     %al,%dl
+     b53:	74 ca                	je     b1f <gets+0x11>
+    buf[i++] = c;
+     b55:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     b57:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     b5b:	89 f8                	mov    %edi,%eax
+     b5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b60:	5b                   	pop    %ebx
+     b61:	5e                   	pop    %esi
+     b62:	5f                   	pop    %edi
+     b63:	5d                   	pop    %ebp
+     b64:	c3                   	ret
+
+00000b65 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     b65:	55                   	push   %ebp
+     b66:	89 e5                	mov    %esp,%ebp
+     b68:	56                   	push   %esi
+     b69:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     b6a:	83 ec 08             	sub    $0x8,%esp
+     b6d:	6a 00                	push   $0x0
+     b6f:	ff 75 08             	push   0x8(%ebp)
+     b72:	e8 9b 01 00 00       	call   d12 <open>
+  if(fd < 0)
+     b77:	83 c4 10             	add    $0x10,%esp
+     b7a:	85 c0                	test   %eax,%eax
+     b7c:	78 24                	js     ba2 <stat+0x3d>
+     b7e:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+     b80:	83 ec 08             	sub    $0x8,%esp
+     b83:	ff 75 0c             	push   0xc(%ebp)
+     b86:	50                   	push   %eax
+     b87:	e8 9e 01 00 00       	call   d2a <fstat>
+     b8c:	89 c6                	mov    %eax,%esi
+  close(fd);
+     b8e:	89 1c 24             	mov    %ebx,(%esp)
+     b91:	e8 64 01 00 00       	call   cfa <close>
+  return r;
+     b96:	83 c4 10             	add    $0x10,%esp
+}
+     b99:	89 f0                	mov    %esi,%eax
+     b9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b9e:	5b                   	pop    %ebx
+     b9f:	5e                   	pop    %esi
+     ba0:	5d                   	pop    %ebp
+     ba1:	c3                   	ret
+    return -1;
+     ba2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     ba7:	eb f0                	jmp    b99 <stat+0x34>
+
+00000ba9 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+     ba9:	55                   	push   %ebp
+     baa:	89 e5                	mov    %esp,%ebp
+     bac:	56                   	push   %esi
+     bad:	53                   	push   %ebx
+     bae:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     bb1:	eb 03                	jmp    bb6 <atoi+0xd>
+     bb3:	83 c2 01             	add    $0x1,%edx
+     bb6:	0f b6 02             	movzbl (%edx),%eax
+     bb9:	3c 20                	cmp    $0x20,%al
+     bbb:	74 f6                	je     bb3 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+     bbd:	3c 2d                	cmp    $0x2d,%al
+     bbf:	74 1d                	je     bde <atoi+0x35>
+     bc1:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     bc6:	3c 2b                	cmp    $0x2b,%al
+     bc8:	0f 94 c1             	sete   %cl
+     bcb:	3c 2d                	cmp    $0x2d,%al
+     bcd:	0f 94 c0             	sete   %al
+     bd0:	08 c1                	or     %al,%cl
+     bd2:	74 03                	je     bd7 <atoi+0x2e>
+    s++;
+     bd4:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+     bd7:	b8 00 00 00 00       	mov    $0x0,%eax
+     bdc:	eb 17                	jmp    bf5 <atoi+0x4c>
+     bde:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     be3:	eb e1                	jmp    bc6 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+     be5:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+     be8:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+     beb:	83 c2 01             	add    $0x1,%edx
+     bee:	0f be c9             	movsbl %cl,%ecx
+     bf1:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+     bf5:	0f b6 0a             	movzbl (%edx),%ecx
+     bf8:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     bfb:	80 fb 09             	cmp    $0x9,%bl
+     bfe:	76 e5                	jbe    be5 <atoi+0x3c>
+  return sign*n;
+     c00:	0f af c6             	imul   %esi,%eax
+}
+     c03:	5b                   	pop    %ebx
+     c04:	5e                   	pop    %esi
+     c05:	5d                   	pop    %ebp
+     c06:	c3                   	ret
+
+00000c07 <atoo>:
+
+int
+atoo(const char *s)
+{
+     c07:	55                   	push   %ebp
+     c08:	89 e5                	mov    %esp,%ebp
+     c0a:	56                   	push   %esi
+     c0b:	53                   	push   %ebx
+     c0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     c0f:	eb 03                	jmp    c14 <atoo+0xd>
+     c11:	83 c2 01             	add    $0x1,%edx
+     c14:	0f b6 02             	movzbl (%edx),%eax
+     c17:	3c 20                	cmp    $0x20,%al
+     c19:	74 f6                	je     c11 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+     c1b:	3c 2d                	cmp    $0x2d,%al
+     c1d:	74 1d                	je     c3c <atoo+0x35>
+     c1f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     c24:	3c 2b                	cmp    $0x2b,%al
+     c26:	0f 94 c1             	sete   %cl
+     c29:	3c 2d                	cmp    $0x2d,%al
+     c2b:	0f 94 c0             	sete   %al
+     c2e:	08 c1                	or     %al,%cl
+     c30:	74 03                	je     c35 <atoo+0x2e>
+    s++;
+     c32:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+     c35:	b8 00 00 00 00       	mov    $0x0,%eax
+     c3a:	eb 11                	jmp    c4d <atoo+0x46>
+     c3c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     c41:	eb e1                	jmp    c24 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+     c43:	83 c2 01             	add    $0x1,%edx
+     c46:	0f be c9             	movsbl %cl,%ecx
+     c49:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+     c4d:	0f b6 0a             	movzbl (%edx),%ecx
+     c50:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     c53:	80 fb 07             	cmp    $0x7,%bl
+     c56:	76 eb                	jbe    c43 <atoo+0x3c>
+  return sign*n;
+     c58:	0f af c6             	imul   %esi,%eax
+}
+     c5b:	5b                   	pop    %ebx
+     c5c:	5e                   	pop    %esi
+     c5d:	5d                   	pop    %ebp
+     c5e:	c3                   	ret
+
+00000c5f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+     c5f:	55                   	push   %ebp
+     c60:	89 e5                	mov    %esp,%ebp
+     c62:	53                   	push   %ebx
+     c63:	8b 55 08             	mov    0x8(%ebp),%edx
+     c66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     c69:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+     c6c:	eb 09                	jmp    c77 <strncmp+0x18>
+      n--, p++, q++;
+     c6e:	83 e8 01             	sub    $0x1,%eax
+     c71:	83 c2 01             	add    $0x1,%edx
+     c74:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+     c77:	85 c0                	test   %eax,%eax
+     c79:	74 0b                	je     c86 <strncmp+0x27>
+     c7b:	0f b6 1a             	movzbl (%edx),%ebx
+     c7e:	84 db                	test   %bl,%bl
+     c80:	74 04                	je     c86 <strncmp+0x27>
+     c82:	3a 19                	cmp    (%ecx),%bl
+     c84:	74 e8                	je     c6e <strncmp+0xf>
+    if(n == 0)
+     c86:	85 c0                	test   %eax,%eax
+     c88:	74 0d                	je     c97 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+     c8a:	0f b6 02             	movzbl (%edx),%eax
+     c8d:	0f b6 11             	movzbl (%ecx),%edx
+     c90:	29 d0                	sub    %edx,%eax
+}
+     c92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c95:	c9                   	leave
+     c96:	c3                   	ret
+      return 0;
+     c97:	b8 00 00 00 00       	mov    $0x0,%eax
+     c9c:	eb f4                	jmp    c92 <strncmp+0x33>
+
+00000c9e <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     c9e:	55                   	push   %ebp
+     c9f:	89 e5                	mov    %esp,%ebp
+     ca1:	56                   	push   %esi
+     ca2:	53                   	push   %ebx
+     ca3:	8b 75 08             	mov    0x8(%ebp),%esi
+     ca6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     ca9:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+     cac:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+     cae:	eb 0d                	jmp    cbd <memmove+0x1f>
+    *dst++ = *src++;
+     cb0:	0f b6 01             	movzbl (%ecx),%eax
+     cb3:	88 02                	mov    %al,(%edx)
+     cb5:	8d 49 01             	lea    0x1(%ecx),%ecx
+     cb8:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+     cbb:	89 d8                	mov    %ebx,%eax
+     cbd:	8d 58 ff             	lea    -0x1(%eax),%ebx
+     cc0:	85 c0                	test   %eax,%eax
+     cc2:	7f ec                	jg     cb0 <memmove+0x12>
+  return vdst;
+}
+     cc4:	89 f0                	mov    %esi,%eax
+     cc6:	5b                   	pop    %ebx
+     cc7:	5e                   	pop    %esi
+     cc8:	5d                   	pop    %ebp
+     cc9:	c3                   	ret
+
+00000cca <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     cca:	b8 01 00 00 00       	mov    $0x1,%eax
+     ccf:	cd 40                	int    $0x40
+     cd1:	c3                   	ret
+
+00000cd2 <exit>:
+SYSCALL(exit)
+     cd2:	b8 02 00 00 00       	mov    $0x2,%eax
+     cd7:	cd 40                	int    $0x40
+     cd9:	c3                   	ret
+
+00000cda <wait>:
+SYSCALL(wait)
+     cda:	b8 03 00 00 00       	mov    $0x3,%eax
+     cdf:	cd 40                	int    $0x40
+     ce1:	c3                   	ret
+
+00000ce2 <pipe>:
+SYSCALL(pipe)
+     ce2:	b8 04 00 00 00       	mov    $0x4,%eax
+     ce7:	cd 40                	int    $0x40
+     ce9:	c3                   	ret
+
+00000cea <read>:
+SYSCALL(read)
+     cea:	b8 05 00 00 00       	mov    $0x5,%eax
+     cef:	cd 40                	int    $0x40
+     cf1:	c3                   	ret
+
+00000cf2 <write>:
+SYSCALL(write)
+     cf2:	b8 10 00 00 00       	mov    $0x10,%eax
+     cf7:	cd 40                	int    $0x40
+     cf9:	c3                   	ret
+
+00000cfa <close>:
+SYSCALL(close)
+     cfa:	b8 15 00 00 00       	mov    $0x15,%eax
+     cff:	cd 40                	int    $0x40
+     d01:	c3                   	ret
+
+00000d02 <kill>:
+SYSCALL(kill)
+     d02:	b8 06 00 00 00       	mov    $0x6,%eax
+     d07:	cd 40                	int    $0x40
+     d09:	c3                   	ret
+
+00000d0a <exec>:
+SYSCALL(exec)
+     d0a:	b8 07 00 00 00       	mov    $0x7,%eax
+     d0f:	cd 40                	int    $0x40
+     d11:	c3                   	ret
+
+00000d12 <open>:
+SYSCALL(open)
+     d12:	b8 0f 00 00 00       	mov    $0xf,%eax
+     d17:	cd 40                	int    $0x40
+     d19:	c3                   	ret
+
+00000d1a <mknod>:
+SYSCALL(mknod)
+     d1a:	b8 11 00 00 00       	mov    $0x11,%eax
+     d1f:	cd 40                	int    $0x40
+     d21:	c3                   	ret
+
+00000d22 <unlink>:
+SYSCALL(unlink)
+     d22:	b8 12 00 00 00       	mov    $0x12,%eax
+     d27:	cd 40                	int    $0x40
+     d29:	c3                   	ret
+
+00000d2a <fstat>:
+SYSCALL(fstat)
+     d2a:	b8 08 00 00 00       	mov    $0x8,%eax
+     d2f:	cd 40                	int    $0x40
+     d31:	c3                   	ret
+
+00000d32 <link>:
+SYSCALL(link)
+     d32:	b8 13 00 00 00       	mov    $0x13,%eax
+     d37:	cd 40                	int    $0x40
+     d39:	c3                   	ret
+
+00000d3a <mkdir>:
+SYSCALL(mkdir)
+     d3a:	b8 14 00 00 00       	mov    $0x14,%eax
+     d3f:	cd 40                	int    $0x40
+     d41:	c3                   	ret
+
+00000d42 <chdir>:
+SYSCALL(chdir)
+     d42:	b8 09 00 00 00       	mov    $0x9,%eax
+     d47:	cd 40                	int    $0x40
+     d49:	c3                   	ret
+
+00000d4a <dup>:
+SYSCALL(dup)
+     d4a:	b8 0a 00 00 00       	mov    $0xa,%eax
+     d4f:	cd 40                	int    $0x40
+     d51:	c3                   	ret
+
+00000d52 <getpid>:
+SYSCALL(getpid)
+     d52:	b8 0b 00 00 00       	mov    $0xb,%eax
+     d57:	cd 40                	int    $0x40
+     d59:	c3                   	ret
+
+00000d5a <sbrk>:
+SYSCALL(sbrk)
+     d5a:	b8 0c 00 00 00       	mov    $0xc,%eax
+     d5f:	cd 40                	int    $0x40
+     d61:	c3                   	ret
+
+00000d62 <sleep>:
+SYSCALL(sleep)
+     d62:	b8 0d 00 00 00       	mov    $0xd,%eax
+     d67:	cd 40                	int    $0x40
+     d69:	c3                   	ret
+
+00000d6a <uptime>:
+SYSCALL(uptime)
+     d6a:	b8 0e 00 00 00       	mov    $0xe,%eax
+     d6f:	cd 40                	int    $0x40
+     d71:	c3                   	ret
+
+00000d72 <halt>:
+SYSCALL(halt)
+     d72:	b8 16 00 00 00       	mov    $0x16,%eax
+     d77:	cd 40                	int    $0x40
+     d79:	c3                   	ret
+
+00000d7a <date>:
+SYSCALL(date)
+     d7a:	b8 17 00 00 00       	mov    $0x17,%eax
+     d7f:	cd 40                	int    $0x40
+     d81:	c3                   	ret
+
+00000d82 <getuid>:
+SYSCALL(getuid)
+     d82:	b8 18 00 00 00       	mov    $0x18,%eax
+     d87:	cd 40                	int    $0x40
+     d89:	c3                   	ret
+
+00000d8a <getgid>:
+SYSCALL(getgid)
+     d8a:	b8 19 00 00 00       	mov    $0x19,%eax
+     d8f:	cd 40                	int    $0x40
+     d91:	c3                   	ret
+
+00000d92 <getppid>:
+SYSCALL(getppid)
+     d92:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     d97:	cd 40                	int    $0x40
+     d99:	c3                   	ret
+
+00000d9a <setuid>:
+SYSCALL(setuid)
+     d9a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     d9f:	cd 40                	int    $0x40
+     da1:	c3                   	ret
+
+00000da2 <setgid>:
+SYSCALL(setgid)
+     da2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     da7:	cd 40                	int    $0x40
+     da9:	c3                   	ret
+
+00000daa <getprocs>:
+SYSCALL(getprocs)
+     daa:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     daf:	cd 40                	int    $0x40
+     db1:	c3                   	ret
+
+00000db2 <getpriority>:
+SYSCALL(getpriority)
+     db2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     db7:	cd 40                	int    $0x40
+     db9:	c3                   	ret
+
+00000dba <setpriority>:
+SYSCALL(setpriority)
+     dba:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     dbf:	cd 40                	int    $0x40
+     dc1:	c3                   	ret
+
+00000dc2 <pipesize>:
+SYSCALL(pipesize)
+     dc2:	b8 20 00 00 00       	mov    $0x20,%eax
+     dc7:	cd 40                	int    $0x40
+     dc9:	c3                   	ret
+
+00000dca <splice>:
+SYSCALL(splice)
+     dca:	b8 21 00 00 00       	mov    $0x21,%eax
+     dcf:	cd 40                	int    $0x40
+     dd1:	c3                   	ret
+
+00000dd2 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     dd2:	55                   	push   %ebp
+     dd3:	89 e5                	mov    %esp,%ebp
+     dd5:	83 ec 1c             	sub    $0x1c,%esp
+     dd8:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+     ddb:	6a 01                	push   $0x1
+     ddd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+     de0:	52                   	push   %edx
+     de1:	50                   	push   %eax
+     de2:	e8 0b ff ff ff       	call   cf2 <write>
+}
+     de7:	83 c4 10             	add    $0x10,%esp
+     dea:	c9                   	leave
+     deb:	c3                   	ret
+
+00000dec <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     dec:	55                   	push   %ebp
+     ded:	89 e5                	mov    %esp,%ebp
+     def:	57                   	push   %edi
+     df0:	56                   	push   %esi
+     df1:	53                   	push   %ebx
+     df2:	83 ec 2c             	sub    $0x2c,%esp
+     df5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     df8:	89 d0                	mov    %edx,%eax
+     dfa:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     dfc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     e00:	0f 95 c1             	setne  %cl
+     e03:	c1 ea 1f             	shr    $0x1f,%edx
+     e06:	84 d1                	test   %dl,%cl
+     e08:	74 44                	je     e4e <printint+0x62>
+    neg = 1;
+    x = -xx;
+     e0a:	f7 d8                	neg    %eax
+     e0c:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     e0e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     e15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     e1a:	89 c8                	mov    %ecx,%eax
+     e1c:	ba 00 00 00 00       	mov    $0x0,%edx
+     e21:	f7 f6                	div    %esi
+     e23:	89 df                	mov    %ebx,%edi
+     e25:	83 c3 01             	add    $0x1,%ebx
+     e28:	0f b6 92 04 18 00 00 	movzbl 0x1804(%edx),%edx
+     e2f:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     e33:	89 ca                	mov    %ecx,%edx
+     e35:	89 c1                	mov    %eax,%ecx
+     e37:	39 f2                	cmp    %esi,%edx
+     e39:	73 df                	jae    e1a <printint+0x2e>
+  if(neg)
+     e3b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     e3f:	74 31                	je     e72 <printint+0x86>
+    buf[i++] = '-';
+     e41:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     e46:	8d 5f 02             	lea    0x2(%edi),%ebx
+     e49:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     e4c:	eb 17                	jmp    e65 <printint+0x79>
+    x = xx;
+     e4e:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     e50:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     e57:	eb bc                	jmp    e15 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     e59:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     e5e:	89 f0                	mov    %esi,%eax
+     e60:	e8 6d ff ff ff       	call   dd2 <putc>
+  while(--i >= 0)
+     e65:	83 eb 01             	sub    $0x1,%ebx
+     e68:	79 ef                	jns    e59 <printint+0x6d>
+}
+     e6a:	83 c4 2c             	add    $0x2c,%esp
+     e6d:	5b                   	pop    %ebx
+     e6e:	5e                   	pop    %esi
+     e6f:	5f                   	pop    %edi
+     e70:	5d                   	pop    %ebp
+     e71:	c3                   	ret
+     e72:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     e75:	eb ee                	jmp    e65 <printint+0x79>
+
+00000e77 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     e77:	55                   	push   %ebp
+     e78:	89 e5                	mov    %esp,%ebp
+     e7a:	57                   	push   %edi
+     e7b:	56                   	push   %esi
+     e7c:	53                   	push   %ebx
+     e7d:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     e80:	8d 45 10             	lea    0x10(%ebp),%eax
+     e83:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+     e86:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     e8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+     e90:	eb 14                	jmp    ea6 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+     e92:	89 fa                	mov    %edi,%edx
+     e94:	8b 45 08             	mov    0x8(%ebp),%eax
+     e97:	e8 36 ff ff ff       	call   dd2 <putc>
+     e9c:	eb 05                	jmp    ea3 <printf+0x2c>
+      }
+    } else if(state == '%'){
+     e9e:	83 fe 25             	cmp    $0x25,%esi
+     ea1:	74 25                	je     ec8 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+     ea3:	83 c3 01             	add    $0x1,%ebx
+     ea6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ea9:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     ead:	84 c0                	test   %al,%al
+     eaf:	0f 84 20 01 00 00    	je     fd5 <printf+0x15e>
+    c = fmt[i] & 0xff;
+     eb5:	0f be f8             	movsbl %al,%edi
+     eb8:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     ebb:	85 f6                	test   %esi,%esi
+     ebd:	75 df                	jne    e9e <printf+0x27>
+      if(c == '%'){
+     ebf:	83 f8 25             	cmp    $0x25,%eax
+     ec2:	75 ce                	jne    e92 <printf+0x1b>
+        state = '%';
+     ec4:	89 c6                	mov    %eax,%esi
+     ec6:	eb db                	jmp    ea3 <printf+0x2c>
+      if(c == 'd'){
+     ec8:	83 f8 25             	cmp    $0x25,%eax
+     ecb:	0f 84 cf 00 00 00    	je     fa0 <printf+0x129>
+     ed1:	0f 8c dd 00 00 00    	jl     fb4 <printf+0x13d>
+     ed7:	83 f8 78             	cmp    $0x78,%eax
+     eda:	0f 8f d4 00 00 00    	jg     fb4 <printf+0x13d>
+     ee0:	83 f8 63             	cmp    $0x63,%eax
+     ee3:	0f 8c cb 00 00 00    	jl     fb4 <printf+0x13d>
+     ee9:	83 e8 63             	sub    $0x63,%eax
+     eec:	83 f8 15             	cmp    $0x15,%eax
+     eef:	0f 87 bf 00 00 00    	ja     fb4 <printf+0x13d>
+     ef5:	ff 24 85 ac 17 00 00 	jmp    *0x17ac(,%eax,4)
+        printint(fd, *ap, 10, 1);
+     efc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     eff:	8b 17                	mov    (%edi),%edx
+     f01:	83 ec 0c             	sub    $0xc,%esp
+     f04:	6a 01                	push   $0x1
+     f06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+     f0e:	e8 d9 fe ff ff       	call   dec <printint>
+        ap++;
+     f13:	83 c7 04             	add    $0x4,%edi
+     f16:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     f19:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+     f1c:	be 00 00 00 00       	mov    $0x0,%esi
+     f21:	eb 80                	jmp    ea3 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+     f23:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     f26:	8b 17                	mov    (%edi),%edx
+     f28:	83 ec 0c             	sub    $0xc,%esp
+     f2b:	6a 00                	push   $0x0
+     f2d:	b9 10 00 00 00       	mov    $0x10,%ecx
+     f32:	8b 45 08             	mov    0x8(%ebp),%eax
+     f35:	e8 b2 fe ff ff       	call   dec <printint>
+        ap++;
+     f3a:	83 c7 04             	add    $0x4,%edi
+     f3d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     f40:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f43:	be 00 00 00 00       	mov    $0x0,%esi
+     f48:	e9 56 ff ff ff       	jmp    ea3 <printf+0x2c>
+        s = (char*)*ap;
+     f4d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f50:	8b 30                	mov    (%eax),%esi
+        ap++;
+     f52:	83 c0 04             	add    $0x4,%eax
+     f55:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     f58:	85 f6                	test   %esi,%esi
+     f5a:	75 15                	jne    f71 <printf+0xfa>
+          s = "(null)";
+     f5c:	be a4 17 00 00       	mov    $0x17a4,%esi
+     f61:	eb 0e                	jmp    f71 <printf+0xfa>
+          putc(fd, *s);
+     f63:	0f be d2             	movsbl %dl,%edx
+     f66:	8b 45 08             	mov    0x8(%ebp),%eax
+     f69:	e8 64 fe ff ff       	call   dd2 <putc>
+          s++;
+     f6e:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     f71:	0f b6 16             	movzbl (%esi),%edx
+     f74:	84 d2                	test   %dl,%dl
+     f76:	75 eb                	jne    f63 <printf+0xec>
+      state = 0;
+     f78:	be 00 00 00 00       	mov    $0x0,%esi
+     f7d:	e9 21 ff ff ff       	jmp    ea3 <printf+0x2c>
+        putc(fd, *ap);
+     f82:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     f85:	0f be 17             	movsbl (%edi),%edx
+     f88:	8b 45 08             	mov    0x8(%ebp),%eax
+     f8b:	e8 42 fe ff ff       	call   dd2 <putc>
+        ap++;
+     f90:	83 c7 04             	add    $0x4,%edi
+     f93:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+     f96:	be 00 00 00 00       	mov    $0x0,%esi
+     f9b:	e9 03 ff ff ff       	jmp    ea3 <printf+0x2c>
+        putc(fd, c);
+     fa0:	89 fa                	mov    %edi,%edx
+     fa2:	8b 45 08             	mov    0x8(%ebp),%eax
+     fa5:	e8 28 fe ff ff       	call   dd2 <putc>
+      state = 0;
+     faa:	be 00 00 00 00       	mov    $0x0,%esi
+     faf:	e9 ef fe ff ff       	jmp    ea3 <printf+0x2c>
+        putc(fd, '%');
+     fb4:	ba 25 00 00 00       	mov    $0x25,%edx
+     fb9:	8b 45 08             	mov    0x8(%ebp),%eax
+     fbc:	e8 11 fe ff ff       	call   dd2 <putc>
+        putc(fd, c);
+     fc1:	89 fa                	mov    %edi,%edx
+     fc3:	8b 45 08             	mov    0x8(%ebp),%eax
+     fc6:	e8 07 fe ff ff       	call   dd2 <putc>
+      state = 0;
+     fcb:	be 00 00 00 00       	mov    $0x0,%esi
+     fd0:	e9 ce fe ff ff       	jmp    ea3 <printf+0x2c>
+    }
+  }
+}
+     fd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fd8:	5b                   	pop    %ebx
+     fd9:	5e                   	pop    %esi
+     fda:	5f                   	pop    %edi
+     fdb:	5d                   	pop    %ebp
+     fdc:	c3                   	ret
+
+00000fdd <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     fdd:	55                   	push   %ebp
+     fde:	89 e5                	mov    %esp,%ebp
+     fe0:	57                   	push   %edi
+     fe1:	56                   	push   %esi
+     fe2:	53                   	push   %ebx
+     fe3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     fe6:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     fe9:	a1 04 1d 00 00       	mov    0x1d04,%eax
+     fee:	eb 02                	jmp    ff2 <free+0x15>
+     ff0:	89 d0                	mov    %edx,%eax
+     ff2:	39 c8                	cmp    %ecx,%eax
+     ff4:	73 04                	jae    ffa <free+0x1d>
+     ff6:	3b 08                	cmp    (%eax),%ecx
+     ff8:	72 12                	jb     100c <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ffa:	8b 10                	mov    (%eax),%edx
+     ffc:	39 d0                	cmp    %edx,%eax
+     ffe:	72 f0                	jb     ff0 <free+0x13>
+    1000:	39 c8                	cmp    %ecx,%eax
+    1002:	72 08                	jb     100c <free+0x2f>
+    1004:	39 d1                	cmp    %edx,%ecx
+    1006:	72 04                	jb     100c <free+0x2f>
+    1008:	89 d0                	mov    %edx,%eax
+    100a:	eb e6                	jmp    ff2 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    100c:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    100f:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    1012:	8b 10                	mov    (%eax),%edx
+    1014:	39 d7                	cmp    %edx,%edi
+    1016:	74 19                	je     1031 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+    1018:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    101b:	8b 50 04             	mov    0x4(%eax),%edx
+    101e:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    1021:	39 ce                	cmp    %ecx,%esi
+    1023:	74 1b                	je     1040 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+    1025:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+    1027:	a3 04 1d 00 00       	mov    %eax,0x1d04
+}
+    102c:	5b                   	pop    %ebx
+    102d:	5e                   	pop    %esi
+    102e:	5f                   	pop    %edi
+    102f:	5d                   	pop    %ebp
+    1030:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    1031:	03 72 04             	add    0x4(%edx),%esi
+    1034:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1037:	8b 10                	mov    (%eax),%edx
+    1039:	8b 12                	mov    (%edx),%edx
+    103b:	89 53 f8             	mov    %edx,-0x8(%ebx)
+    103e:	eb db                	jmp    101b <free+0x3e>
+    p->s.size += bp->s.size;
+    1040:	03 53 fc             	add    -0x4(%ebx),%edx
+    1043:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    1046:	8b 53 f8             	mov    -0x8(%ebx),%edx
+    1049:	89 10                	mov    %edx,(%eax)
+    104b:	eb da                	jmp    1027 <free+0x4a>
+
+0000104d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    104d:	55                   	push   %ebp
+    104e:	89 e5                	mov    %esp,%ebp
+    1050:	53                   	push   %ebx
+    1051:	83 ec 04             	sub    $0x4,%esp
+    1054:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1056:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    105b:	77 05                	ja     1062 <morecore+0x15>
+    nu = 4096;
+    105d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1062:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    1069:	83 ec 0c             	sub    $0xc,%esp
+    106c:	50                   	push   %eax
+    106d:	e8 e8 fc ff ff       	call   d5a <sbrk>
+  if(p == (char*)-1)
+    1072:	83 c4 10             	add    $0x10,%esp
+    1075:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1078:	74 1c                	je     1096 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+    107a:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    107d:	83 c0 08             	add    $0x8,%eax
+    1080:	83 ec 0c             	sub    $0xc,%esp
+    1083:	50                   	push   %eax
+    1084:	e8 54 ff ff ff       	call   fdd <free>
+  return freep;
+    1089:	a1 04 1d 00 00       	mov    0x1d04,%eax
+    108e:	83 c4 10             	add    $0x10,%esp
+}
+    1091:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1094:	c9                   	leave
+    1095:	c3                   	ret
+    return 0;
+    1096:	b8 00 00 00 00       	mov    $0x0,%eax
+    109b:	eb f4                	jmp    1091 <morecore+0x44>
+
+0000109d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    109d:	55                   	push   %ebp
+    109e:	89 e5                	mov    %esp,%ebp
+    10a0:	53                   	push   %ebx
+    10a1:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10a4:	8b 45 08             	mov    0x8(%ebp),%eax
+    10a7:	8d 58 07             	lea    0x7(%eax),%ebx
+    10aa:	c1 eb 03             	shr    $0x3,%ebx
+    10ad:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    10b0:	8b 0d 04 1d 00 00    	mov    0x1d04,%ecx
+    10b6:	85 c9                	test   %ecx,%ecx
+    10b8:	74 04                	je     10be <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10ba:	8b 01                	mov    (%ecx),%eax
+    10bc:	eb 4a                	jmp    1108 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+    10be:	c7 05 04 1d 00 00 08 	movl   $0x1d08,0x1d04
+    10c5:	1d 00 00 
+    10c8:	c7 05 08 1d 00 00 08 	movl   $0x1d08,0x1d08
+    10cf:	1d 00 00 
+    base.s.size = 0;
+    10d2:	c7 05 0c 1d 00 00 00 	movl   $0x0,0x1d0c
+    10d9:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+    10dc:	b9 08 1d 00 00       	mov    $0x1d08,%ecx
+    10e1:	eb d7                	jmp    10ba <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+    10e3:	74 19                	je     10fe <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    10e5:	29 da                	sub    %ebx,%edx
+    10e7:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    10ea:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+    10ed:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    10f0:	89 0d 04 1d 00 00    	mov    %ecx,0x1d04
+      return (void*)(p + 1);
+    10f6:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    10f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10fc:	c9                   	leave
+    10fd:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    10fe:	8b 10                	mov    (%eax),%edx
+    1100:	89 11                	mov    %edx,(%ecx)
+    1102:	eb ec                	jmp    10f0 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1104:	89 c1                	mov    %eax,%ecx
+    1106:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+    1108:	8b 50 04             	mov    0x4(%eax),%edx
+    110b:	39 da                	cmp    %ebx,%edx
+    110d:	73 d4                	jae    10e3 <malloc+0x46>
+    if(p == freep)
+    110f:	39 05 04 1d 00 00    	cmp    %eax,0x1d04
+    1115:	75 ed                	jne    1104 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+    1117:	89 d8                	mov    %ebx,%eax
+    1119:	e8 2f ff ff ff       	call   104d <morecore>
+    111e:	85 c0                	test   %eax,%eax
+    1120:	75 e2                	jne    1104 <malloc+0x67>
+    1122:	eb d5                	jmp    10f9 <malloc+0x5c>
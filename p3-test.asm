@@ -0,0 +1,1251 @@
+
+_p3-test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "param.h"
+#include "pdx.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+  13:	8b 71 04             	mov    0x4(%ecx),%esi
+  int rc, i = 0, childCount = 5;
+
+  if (argc > 1) {
+  16:	83 39 01             	cmpl   $0x1,(%ecx)
+  19:	7e 2a                	jle    45 <main+0x45>
+    childCount = atoi(argv[1]);
+  1b:	83 ec 0c             	sub    $0xc,%esp
+  1e:	ff 76 04             	push   0x4(%esi)
+  21:	e8 05 02 00 00       	call   22b <atoi>
+  26:	89 c3                	mov    %eax,%ebx
+  }
+  if (!childCount) {
+  28:	83 c4 10             	add    $0x10,%esp
+  2b:	85 c0                	test   %eax,%eax
+  2d:	75 1b                	jne    4a <main+0x4a>
+    printf(1, "No children to create, so %s is exiting.\n", argv[0]);
+  2f:	83 ec 04             	sub    $0x4,%esp
+  32:	ff 36                	push   (%esi)
+  34:	68 a8 07 00 00       	push   $0x7a8
+  39:	6a 01                	push   $0x1
+  3b:	e8 b9 04 00 00       	call   4f9 <printf>
+    exit();
+  40:	e8 0f 03 00 00       	call   354 <exit>
+  int rc, i = 0, childCount = 5;
+  45:	bb 05 00 00 00       	mov    $0x5,%ebx
+  }
+
+  printf(1, "Starting %d child processes that will run forever\n", childCount);
+  4a:	83 ec 04             	sub    $0x4,%esp
+  4d:	53                   	push   %ebx
+  4e:	68 d4 07 00 00       	push   $0x7d4
+  53:	6a 01                	push   $0x1
+  55:	e8 9f 04 00 00       	call   4f9 <printf>
+  5a:	83 c4 10             	add    $0x10,%esp
+
+  do {
+    rc = fork();
+  5d:	e8 ea 02 00 00       	call   34c <fork>
+    if (rc < 0) {
+  62:	85 c0                	test   %eax,%eax
+  64:	78 74                	js     da <main+0xda>
+      printf(2, "Fork failed!\n");
+      exit();
+    }
+    if (rc == 0) { // child process
+  66:	0f 84 82 00 00 00    	je     ee <main+0xee>
+      while(1) i++;  // infinite
+      exit();  // not reachable.
+    }
+    childCount--;
+  } while(childCount);
+  6c:	83 eb 01             	sub    $0x1,%ebx
+  6f:	75 ec                	jne    5d <main+0x5d>
+
+  printf(1, "All child processes created\n");
+  71:	83 ec 08             	sub    $0x8,%esp
+  74:	68 6e 08 00 00       	push   $0x86e
+  79:	6a 01                	push   $0x1
+  7b:	e8 79 04 00 00       	call   4f9 <printf>
+  //printf(1, "Setting pid 4 to prio 1\n");
+  int pid = getpid();
+  80:	e8 4f 03 00 00       	call   3d4 <getpid>
+  printf(1,"Priority of current process: %d \n", getpriority(pid));
+  85:	89 04 24             	mov    %eax,(%esp)
+  88:	e8 a7 03 00 00       	call   434 <getpriority>
+  8d:	83 c4 0c             	add    $0xc,%esp
+  90:	50                   	push   %eax
+  91:	68 08 08 00 00       	push   $0x808
+  96:	6a 01                	push   $0x1
+  98:	e8 5c 04 00 00       	call   4f9 <printf>
+
+  printf(1,"Priority of process 4: %d \n", getpriority(4));
+  9d:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+  a4:	e8 8b 03 00 00       	call   434 <getpriority>
+  a9:	83 c4 0c             	add    $0xc,%esp
+  ac:	50                   	push   %eax
+  ad:	68 8b 08 00 00       	push   $0x88b
+  b2:	6a 01                	push   $0x1
+  b4:	e8 40 04 00 00       	call   4f9 <printf>
+  printf(1,"Return code for trying to getprio of PID 3000: %d \n", getpriority(3000));
+  b9:	c7 04 24 b8 0b 00 00 	movl   $0xbb8,(%esp)
+  c0:	e8 6f 03 00 00       	call   434 <getpriority>
+  c5:	83 c4 0c             	add    $0xc,%esp
+  c8:	50                   	push   %eax
+  c9:	68 2c 08 00 00       	push   $0x82c
+  ce:	6a 01                	push   $0x1
+  d0:	e8 24 04 00 00       	call   4f9 <printf>
+  d5:	83 c4 10             	add    $0x10,%esp
+  //  printf(1, "set proc 4 to prio 1");
+ //    printf(2, "attempt to put proc 5 on top prio");
+ // if(setpriority(5,MAXPRIO) != 0)
+ //   printf(2, "the proc could not be placed back to same list");
+  while(1) i++;  // loop forever and don't call wait. Good for zombie check
+  d8:	eb fe                	jmp    d8 <main+0xd8>
+      printf(2, "Fork failed!\n");
+  da:	83 ec 08             	sub    $0x8,%esp
+  dd:	68 60 08 00 00       	push   $0x860
+  e2:	6a 02                	push   $0x2
+  e4:	e8 10 04 00 00       	call   4f9 <printf>
+      exit();
+  e9:	e8 66 02 00 00       	call   354 <exit>
+      while(1) i++;  // infinite
+  ee:	eb fe                	jmp    ee <main+0xee>
+
+000000f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	56                   	push   %esi
+  f4:	53                   	push   %ebx
+  f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  fb:	89 f0                	mov    %esi,%eax
+  fd:	89 d1                	mov    %edx,%ecx
+  ff:	83 c2 01             	add    $0x1,%edx
+ 102:	89 c3                	mov    %eax,%ebx
+ 104:	83 c0 01             	add    $0x1,%eax
+ 107:	0f b6 09             	movzbl (%ecx),%ecx
+ 10a:	88 0b                	mov    %cl,(%ebx)
+ 10c:	84 c9                	test   %cl,%cl
+ 10e:	75 ed                	jne    fd <strcpy+0xd>
+    ;
+  return os;
+}
+ 110:	89 f0                	mov    %esi,%eax
+ 112:	5b                   	pop    %ebx
+ 113:	5e                   	pop    %esi
+ 114:	5d                   	pop    %ebp
+ 115:	c3                   	ret
+
+00000116 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 116:	55                   	push   %ebp
+ 117:	89 e5                	mov    %esp,%ebp
+ 119:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 11c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 11f:	eb 06                	jmp    127 <strcmp+0x11>
+    p++, q++;
+ 121:	83 c1 01             	add    $0x1,%ecx
+ 124:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 127:	0f b6 01             	movzbl (%ecx),%eax
+ 12a:	84 c0                	test   %al,%al
+ 12c:	74 04                	je     132 <strcmp+0x1c>
+ 12e:	3a 02                	cmp    (%edx),%al
+ 130:	74 ef                	je     121 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 132:	0f b6 c0             	movzbl %al,%eax
+ 135:	0f b6 12             	movzbl (%edx),%edx
+ 138:	29 d0                	sub    %edx,%eax
+}
+ 13a:	5d                   	pop    %ebp
+ 13b:	c3                   	ret
+
+0000013c <strlen>:
+
+uint
+strlen(char *s)
+{
+ 13c:	55                   	push   %ebp
+ 13d:	89 e5                	mov    %esp,%ebp
+ 13f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 142:	b8 00 00 00 00       	mov    $0x0,%eax
+ 147:	eb 03                	jmp    14c <strlen+0x10>
+ 149:	83 c0 01             	add    $0x1,%eax
+ 14c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 150:	75 f7                	jne    149 <strlen+0xd>
+    ;
+  return n;
+}
+ 152:	5d                   	pop    %ebp
+ 153:	c3                   	ret
+
+00000154 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 154:	55                   	push   %ebp
+ 155:	89 e5                	mov    %esp,%ebp
+ 157:	57                   	push   %edi
+ 158:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 15b:	89 d7                	mov    %edx,%edi
+ 15d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 160:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 163:	fc                   	cld
+ 164:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 166:	89 d0                	mov    %edx,%eax
+ 168:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+
+0000016d <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 16d:	55                   	push   %ebp
+ 16e:	89 e5                	mov    %esp,%ebp
+ 170:	8b 45 08             	mov    0x8(%ebp),%eax
+ 173:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 177:	eb 03                	jmp    17c <strchr+0xf>
+ 179:	83 c0 01             	add    $0x1,%eax
+ 17c:	0f b6 10             	movzbl (%eax),%edx
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 06                	je     189 <strchr+0x1c>
+    if(*s == c)
+ 183:	38 ca                	cmp    %cl,%dl
+ 185:	75 f2                	jne    179 <strchr+0xc>
+ 187:	eb 05                	jmp    18e <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 189:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 18e:	5d                   	pop    %ebp
+ 18f:	c3                   	ret
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+ 195:	53                   	push   %ebx
+ 196:	83 ec 1c             	sub    $0x1c,%esp
+ 199:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 19c:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1a1:	89 de                	mov    %ebx,%esi
+ 1a3:	83 c3 01             	add    $0x1,%ebx
+ 1a6:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1a9:	7d 2e                	jge    1d9 <gets+0x49>
+    cc = read(0, &c, 1);
+ 1ab:	83 ec 04             	sub    $0x4,%esp
+ 1ae:	6a 01                	push   $0x1
+ 1b0:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1b3:	50                   	push   %eax
+ 1b4:	6a 00                	push   $0x0
+ 1b6:	e8 b1 01 00 00       	call   36c <read>
+    if(cc < 1)
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	7e 17                	jle    1d9 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1c2:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c6:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1c9:	3c 0a                	cmp    $0xa,%al
+ 1cb:	0f 94 c2             	sete   %dl
+ 1ce:	3c 0d                	cmp    $0xd,%al
+ 1d0:	0f 94 c0             	sete   %al
+ 1d3:	08 c2                	or     %al,%dl
+ 1d5:	74 ca                	je     1a1 <gets+0x11>
+    buf[i++] = c;
+ 1d7:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1d9:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 1dd:	89 f8                	mov    %edi,%eax
+ 1df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1e2:	5b                   	pop    %ebx
+ 1e3:	5e                   	pop    %esi
+ 1e4:	5f                   	pop    %edi
+ 1e5:	5d                   	pop    %ebp
+ 1e6:	c3                   	ret
+
+000001e7 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+ 1ea:	56                   	push   %esi
+ 1eb:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1ec:	83 ec 08             	sub    $0x8,%esp
+ 1ef:	6a 00                	push   $0x0
+ 1f1:	ff 75 08             	push   0x8(%ebp)
+ 1f4:	e8 9b 01 00 00       	call   394 <open>
+  if(fd < 0)
+ 1f9:	83 c4 10             	add    $0x10,%esp
+ 1fc:	85 c0                	test   %eax,%eax
+ 1fe:	78 24                	js     224 <stat+0x3d>
+ 200:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 202:	83 ec 08             	sub    $0x8,%esp
+ 205:	ff 75 0c             	push   0xc(%ebp)
+ 208:	50                   	push   %eax
+ 209:	e8 9e 01 00 00       	call   3ac <fstat>
+ 20e:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 210:	89 1c 24             	mov    %ebx,(%esp)
+ 213:	e8 64 01 00 00       	call   37c <close>
+  return r;
+ 218:	83 c4 10             	add    $0x10,%esp
+}
+ 21b:	89 f0                	mov    %esi,%eax
+ 21d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 220:	5b                   	pop    %ebx
+ 221:	5e                   	pop    %esi
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+    return -1;
+ 224:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 229:	eb f0                	jmp    21b <stat+0x34>
+
+0000022b <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 22b:	55                   	push   %ebp
+ 22c:	89 e5                	mov    %esp,%ebp
+ 22e:	56                   	push   %esi
+ 22f:	53                   	push   %ebx
+ 230:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 233:	eb 03                	jmp    238 <atoi+0xd>
+ 235:	83 c2 01             	add    $0x1,%edx
+ 238:	0f b6 02             	movzbl (%edx),%eax
+ 23b:	3c 20                	cmp    $0x20,%al
+ 23d:	74 f6                	je     235 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 23f:	3c 2d                	cmp    $0x2d,%al
+ 241:	74 1d                	je     260 <atoi+0x35>
+ 243:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 248:	3c 2b                	cmp    $0x2b,%al
+ 24a:	0f 94 c1             	sete   %cl
+ 24d:	3c 2d                	cmp    $0x2d,%al
+ 24f:	0f 94 c0             	sete   %al
+ 252:	08 c1                	or     %al,%cl
+ 254:	74 03                	je     259 <atoi+0x2e>
+    s++;
+ 256:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 259:	b8 00 00 00 00       	mov    $0x0,%eax
+ 25e:	eb 17                	jmp    277 <atoi+0x4c>
+ 260:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 265:	eb e1                	jmp    248 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 267:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 26a:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 26d:	83 c2 01             	add    $0x1,%edx
+ 270:	0f be c9             	movsbl %cl,%ecx
+ 273:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 277:	0f b6 0a             	movzbl (%edx),%ecx
+ 27a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 27d:	80 fb 09             	cmp    $0x9,%bl
+ 280:	76 e5                	jbe    267 <atoi+0x3c>
+  return sign*n;
+ 282:	0f af c6             	imul   %esi,%eax
+}
+ 285:	5b                   	pop    %ebx
+ 286:	5e                   	pop    %esi
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+
+00000289 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 289:	55                   	push   %ebp
+ 28a:	89 e5                	mov    %esp,%ebp
+ 28c:	56                   	push   %esi
+ 28d:	53                   	push   %ebx
+ 28e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 291:	eb 03                	jmp    296 <atoo+0xd>
+ 293:	83 c2 01             	add    $0x1,%edx
+ 296:	0f b6 02             	movzbl (%edx),%eax
+ 299:	3c 20                	cmp    $0x20,%al
+ 29b:	74 f6                	je     293 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 29d:	3c 2d                	cmp    $0x2d,%al
+ 29f:	74 1d                	je     2be <atoo+0x35>
+ 2a1:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2a6:	3c 2b                	cmp    $0x2b,%al
+ 2a8:	0f 94 c1             	sete   %cl
+ 2ab:	3c 2d                	cmp    $0x2d,%al
+ 2ad:	0f 94 c0             	sete   %al
+ 2b0:	08 c1                	or     %al,%cl
+ 2b2:	74 03                	je     2b7 <atoo+0x2e>
+    s++;
+ 2b4:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 2b7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2bc:	eb 11                	jmp    2cf <atoo+0x46>
+ 2be:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2c3:	eb e1                	jmp    2a6 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 2c5:	83 c2 01             	add    $0x1,%edx
+ 2c8:	0f be c9             	movsbl %cl,%ecx
+ 2cb:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 2cf:	0f b6 0a             	movzbl (%edx),%ecx
+ 2d2:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2d5:	80 fb 07             	cmp    $0x7,%bl
+ 2d8:	76 eb                	jbe    2c5 <atoo+0x3c>
+  return sign*n;
+ 2da:	0f af c6             	imul   %esi,%eax
+}
+ 2dd:	5b                   	pop    %ebx
+ 2de:	5e                   	pop    %esi
+ 2df:	5d                   	pop    %ebp
+ 2e0:	c3                   	ret
+
+000002e1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 2e1:	55                   	push   %ebp
+ 2e2:	89 e5                	mov    %esp,%ebp
+ 2e4:	53                   	push   %ebx
+ 2e5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 2eb:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 2ee:	eb 09                	jmp    2f9 <strncmp+0x18>
+      n--, p++, q++;
+ 2f0:	83 e8 01             	sub    $0x1,%eax
+ 2f3:	83 c2 01             	add    $0x1,%edx
+ 2f6:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 2f9:	85 c0                	test   %eax,%eax
+ 2fb:	74 0b                	je     308 <strncmp+0x27>
+ 2fd:	0f b6 1a             	movzbl (%edx),%ebx
+ 300:	84 db                	test   %bl,%bl
+ 302:	74 04                	je     308 <strncmp+0x27>
+ 304:	3a 19                	cmp    (%ecx),%bl
+ 306:	74 e8                	je     2f0 <strncmp+0xf>
+    if(n == 0)
+ 308:	85 c0                	test   %eax,%eax
+ 30a:	74 0d                	je     319 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 30c:	0f b6 02             	movzbl (%edx),%eax
+ 30f:	0f b6 11             	movzbl (%ecx),%edx
+ 312:	29 d0                	sub    %edx,%eax
+}
+ 314:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 317:	c9                   	leave
+ 318:	c3                   	ret
+      return 0;
+ 319:	b8 00 00 00 00       	mov    $0x0,%eax
+ 31e:	eb f4                	jmp    314 <strncmp+0x33>
+
+00000320 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+ 324:	53                   	push   %ebx
+ 325:	8b 75 08             	mov    0x8(%ebp),%esi
+ 328:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 32b:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 32e:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 330:	eb 0d                	jmp    33f <memmove+0x1f>
+    *dst++ = *src++;
+ 332:	0f b6 01             	movzbl (%ecx),%eax
+ 335:	88 02                	mov    %al,(%edx)
+ 337:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 33a:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 33d:	89 d8                	mov    %ebx,%eax
+ 33f:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 342:	85 c0                	test   %eax,%eax
+ 344:	7f ec                	jg     332 <memmove+0x12>
+  return vdst;
+}
+ 346:	89 f0                	mov    %esi,%eax
+ 348:	5b                   	pop    %ebx
+ 349:	5e                   	pop    %esi
+ 34a:	5d                   	pop    %ebp
+ 34b:	c3                   	ret
+
+0000034c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 34c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <exit>:
+SYSCALL(exit)
+ 354:	b8 02 00 00 00       	mov    $0x2,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <wait>:
+SYSCALL(wait)
+ 35c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <pipe>:
+SYSCALL(pipe)
+ 364:	b8 04 00 00 00       	mov    $0x4,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <read>:
+SYSCALL(read)
+ 36c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <write>:
+SYSCALL(write)
+ 374:	b8 10 00 00 00       	mov    $0x10,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <close>:
+SYSCALL(close)
+ 37c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <kill>:
+SYSCALL(kill)
+ 384:	b8 06 00 00 00       	mov    $0x6,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <exec>:
+SYSCALL(exec)
+ 38c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <open>:
+SYSCALL(open)
+ 394:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <mknod>:
+SYSCALL(mknod)
+ 39c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <unlink>:
+SYSCALL(unlink)
+ 3a4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <fstat>:
+SYSCALL(fstat)
+ 3ac:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <link>:
+SYSCALL(link)
+ 3b4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <mkdir>:
+SYSCALL(mkdir)
+ 3bc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <chdir>:
+SYSCALL(chdir)
+ 3c4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <dup>:
+SYSCALL(dup)
+ 3cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <getpid>:
+SYSCALL(getpid)
+ 3d4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <sbrk>:
+SYSCALL(sbrk)
+ 3dc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <sleep>:
+SYSCALL(sleep)
+ 3e4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <uptime>:
+SYSCALL(uptime)
+ 3ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <halt>:
+SYSCALL(halt)
+ 3f4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <date>:
+SYSCALL(date)
+ 3fc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <getuid>:
+SYSCALL(getuid)
+ 404:	b8 18 00 00 00       	mov    $0x18,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <getgid>:
+SYSCALL(getgid)
+ 40c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <getppid>:
+SYSCALL(getppid)
+ 414:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <setuid>:
+SYSCALL(setuid)
+ 41c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <setgid>:
+SYSCALL(setgid)
+ 424:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <getprocs>:
+SYSCALL(getprocs)
+ 42c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <getpriority>:
+SYSCALL(getpriority)
+ 434:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <setpriority>:
+SYSCALL(setpriority)
+ 43c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <pipesize>:
+SYSCALL(pipesize)
+ 444:	b8 20 00 00 00       	mov    $0x20,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <splice>:
+SYSCALL(splice)
+ 44c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 454:	55                   	push   %ebp
+ 455:	89 e5                	mov    %esp,%ebp
+ 457:	83 ec 1c             	sub    $0x1c,%esp
+ 45a:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 45d:	6a 01                	push   $0x1
+ 45f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 462:	52                   	push   %edx
+ 463:	50                   	push   %eax
+ 464:	e8 0b ff ff ff       	call   374 <write>
+}
+ 469:	83 c4 10             	add    $0x10,%esp
+ 46c:	c9                   	leave
+ 46d:	c3                   	ret
+
+0000046e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 46e:	55                   	push   %ebp
+ 46f:	89 e5                	mov    %esp,%ebp
+ 471:	57                   	push   %edi
+ 472:	56                   	push   %esi
+ 473:	53                   	push   %ebx
+ 474:	83 ec 2c             	sub    $0x2c,%esp
+ 477:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 47a:	89 d0                	mov    %edx,%eax
+ 47c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 47e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 482:	0f 95 c1             	setne  %cl
+ 485:	c1 ea 1f             	shr    $0x1f,%edx
+ 488:	84 d1                	test   %dl,%cl
+ 48a:	74 44                	je     4d0 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 48c:	f7 d8                	neg    %eax
+ 48e:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 490:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 497:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 49c:	89 c8                	mov    %ecx,%eax
+ 49e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4a3:	f7 f6                	div    %esi
+ 4a5:	89 df                	mov    %ebx,%edi
+ 4a7:	83 c3 01             	add    $0x1,%ebx
+ 4aa:	0f b6 92 08 09 00 00 	movzbl 0x908(%edx),%edx
+ 4b1:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 4b5:	89 ca                	mov    %ecx,%edx
+ 4b7:	89 c1                	mov    %eax,%ecx
+ 4b9:	39 f2                	cmp    %esi,%edx
+ 4bb:	73 df                	jae    49c <printint+0x2e>
+  if(neg)
+ 4bd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 4c1:	74 31                	je     4f4 <printint+0x86>
+    buf[i++] = '-';
+ 4c3:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4c8:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 4cb:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4ce:	eb 17                	jmp    4e7 <printint+0x79>
+    x = xx;
+ 4d0:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 4d2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 4d9:	eb bc                	jmp    497 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4db:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 4e0:	89 f0                	mov    %esi,%eax
+ 4e2:	e8 6d ff ff ff       	call   454 <putc>
+  while(--i >= 0)
+ 4e7:	83 eb 01             	sub    $0x1,%ebx
+ 4ea:	79 ef                	jns    4db <printint+0x6d>
+}
+ 4ec:	83 c4 2c             	add    $0x2c,%esp
+ 4ef:	5b                   	pop    %ebx
+ 4f0:	5e                   	pop    %esi
+ 4f1:	5f                   	pop    %edi
+ 4f2:	5d                   	pop    %ebp
+ 4f3:	c3                   	ret
+ 4f4:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4f7:	eb ee                	jmp    4e7 <printint+0x79>
+
+000004f9 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4f9:	55                   	push   %ebp
+ 4fa:	89 e5                	mov    %esp,%ebp
+ 4fc:	57                   	push   %edi
+ 4fd:	56                   	push   %esi
+ 4fe:	53                   	push   %ebx
+ 4ff:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 502:	8d 45 10             	lea    0x10(%ebp),%eax
+ 505:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 508:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 50d:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 512:	eb 14                	jmp    528 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 514:	89 fa                	mov    %edi,%edx
+ 516:	8b 45 08             	mov    0x8(%ebp),%eax
+ 519:	e8 36 ff ff ff       	call   454 <putc>
+ 51e:	eb 05                	jmp    525 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 520:	83 fe 25             	cmp    $0x25,%esi
+ 523:	74 25                	je     54a <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 525:	83 c3 01             	add    $0x1,%ebx
+ 528:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 52b:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 52f:	84 c0                	test   %al,%al
+ 531:	0f 84 20 01 00 00    	je     657 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 537:	0f be f8             	movsbl %al,%edi
+ 53a:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 53d:	85 f6                	test   %esi,%esi
+ 53f:	75 df                	jne    520 <printf+0x27>
+      if(c == '%'){
+ 541:	83 f8 25             	cmp    $0x25,%eax
+ 544:	75 ce                	jne    514 <printf+0x1b>
+        state = '%';
+ 546:	89 c6                	mov    %eax,%esi
+ 548:	eb db                	jmp    525 <printf+0x2c>
+      if(c == 'd'){
+ 54a:	83 f8 25             	cmp    $0x25,%eax
+ 54d:	0f 84 cf 00 00 00    	je     622 <printf+0x129>
+ 553:	0f 8c dd 00 00 00    	jl     636 <printf+0x13d>
+ 559:	83 f8 78             	cmp    $0x78,%eax
+ 55c:	0f 8f d4 00 00 00    	jg     636 <printf+0x13d>
+ 562:	83 f8 63             	cmp    $0x63,%eax
+ 565:	0f 8c cb 00 00 00    	jl     636 <printf+0x13d>
+ 56b:	83 e8 63             	sub    $0x63,%eax
+ 56e:	83 f8 15             	cmp    $0x15,%eax
+ 571:	0f 87 bf 00 00 00    	ja     636 <printf+0x13d>
+ 577:	ff 24 85 b0 08 00 00 	jmp    *0x8b0(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 57e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 581:	8b 17                	mov    (%edi),%edx
+ 583:	83 ec 0c             	sub    $0xc,%esp
+ 586:	6a 01                	push   $0x1
+ 588:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 58d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 590:	e8 d9 fe ff ff       	call   46e <printint>
+        ap++;
+ 595:	83 c7 04             	add    $0x4,%edi
+ 598:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 59b:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 59e:	be 00 00 00 00       	mov    $0x0,%esi
+ 5a3:	eb 80                	jmp    525 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 5a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5a8:	8b 17                	mov    (%edi),%edx
+ 5aa:	83 ec 0c             	sub    $0xc,%esp
+ 5ad:	6a 00                	push   $0x0
+ 5af:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b7:	e8 b2 fe ff ff       	call   46e <printint>
+        ap++;
+ 5bc:	83 c7 04             	add    $0x4,%edi
+ 5bf:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 5c2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5c5:	be 00 00 00 00       	mov    $0x0,%esi
+ 5ca:	e9 56 ff ff ff       	jmp    525 <printf+0x2c>
+        s = (char*)*ap;
+ 5cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5d2:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 5d4:	83 c0 04             	add    $0x4,%eax
+ 5d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 5da:	85 f6                	test   %esi,%esi
+ 5dc:	75 15                	jne    5f3 <printf+0xfa>
+          s = "(null)";
+ 5de:	be a7 08 00 00       	mov    $0x8a7,%esi
+ 5e3:	eb 0e                	jmp    5f3 <printf+0xfa>
+          putc(fd, *s);
+ 5e5:	0f be d2             	movsbl %dl,%edx
+ 5e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5eb:	e8 64 fe ff ff       	call   454 <putc>
+          s++;
+ 5f0:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 5f3:	0f b6 16             	movzbl (%esi),%edx
+ 5f6:	84 d2                	test   %dl,%dl
+ 5f8:	75 eb                	jne    5e5 <printf+0xec>
+      state = 0;
+ 5fa:	be 00 00 00 00       	mov    $0x0,%esi
+ 5ff:	e9 21 ff ff ff       	jmp    525 <printf+0x2c>
+        putc(fd, *ap);
+ 604:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 607:	0f be 17             	movsbl (%edi),%edx
+ 60a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60d:	e8 42 fe ff ff       	call   454 <putc>
+        ap++;
+ 612:	83 c7 04             	add    $0x4,%edi
+ 615:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 618:	be 00 00 00 00       	mov    $0x0,%esi
+ 61d:	e9 03 ff ff ff       	jmp    525 <printf+0x2c>
+        putc(fd, c);
+ 622:	89 fa                	mov    %edi,%edx
+ 624:	8b 45 08             	mov    0x8(%ebp),%eax
+ 627:	e8 28 fe ff ff       	call   454 <putc>
+      state = 0;
+ 62c:	be 00 00 00 00       	mov    $0x0,%esi
+ 631:	e9 ef fe ff ff       	jmp    525 <printf+0x2c>
+        putc(fd, '%');
+ 636:	ba 25 00 00 00       	mov    $0x25,%edx
+ 63b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63e:	e8 11 fe ff ff       	call   454 <putc>
+        putc(fd, c);
+ 643:	89 fa                	mov    %edi,%edx
+ 645:	8b 45 08             	mov    0x8(%ebp),%eax
+ 648:	e8 07 fe ff ff       	call   454 <putc>
+      state = 0;
+ 64d:	be 00 00 00 00       	mov    $0x0,%esi
+ 652:	e9 ce fe ff ff       	jmp    525 <printf+0x2c>
+    }
+  }
+}
+ 657:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 65a:	5b                   	pop    %ebx
+ 65b:	5e                   	pop    %esi
+ 65c:	5f                   	pop    %edi
+ 65d:	5d                   	pop    %ebp
+ 65e:	c3                   	ret
+
+0000065f <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 65f:	55                   	push   %ebp
+ 660:	89 e5                	mov    %esp,%ebp
+ 662:	57                   	push   %edi
+ 663:	56                   	push   %esi
+ 664:	53                   	push   %ebx
+ 665:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 668:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 66b:	a1 04 0c 00 00       	mov    0xc04,%eax
+ 670:	eb 02                	jmp    674 <free+0x15>
+ 672:	89 d0                	mov    %edx,%eax
+ 674:	39 c8                	cmp    %ecx,%eax
+ 676:	73 04                	jae    67c <free+0x1d>
+ 678:	3b 08                	cmp    (%eax),%ecx
+ 67a:	72 12                	jb     68e <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 67c:	8b 10                	mov    (%eax),%edx
+ 67e:	39 d0                	cmp    %edx,%eax
+ 680:	72 f0                	jb     672 <free+0x13>
+ 682:	39 c8                	cmp    %ecx,%eax
+ 684:	72 08                	jb     68e <free+0x2f>
+ 686:	39 d1                	cmp    %edx,%ecx
+ 688:	72 04                	jb     68e <free+0x2f>
+ 68a:	89 d0                	mov    %edx,%eax
+ 68c:	eb e6                	jmp    674 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 68e:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 691:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 694:	8b 10                	mov    (%eax),%edx
+ 696:	39 d7                	cmp    %edx,%edi
+ 698:	74 19                	je     6b3 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 69a:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 69d:	8b 50 04             	mov    0x4(%eax),%edx
+ 6a0:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 6a3:	39 ce                	cmp    %ecx,%esi
+ 6a5:	74 1b                	je     6c2 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 6a7:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 6a9:	a3 04 0c 00 00       	mov    %eax,0xc04
+}
+ 6ae:	5b                   	pop    %ebx
+ 6af:	5e                   	pop    %esi
+ 6b0:	5f                   	pop    %edi
+ 6b1:	5d                   	pop    %ebp
+ 6b2:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6b3:	03 72 04             	add    0x4(%edx),%esi
+ 6b6:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6b9:	8b 10                	mov    (%eax),%edx
+ 6bb:	8b 12                	mov    (%edx),%edx
+ 6bd:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 6c0:	eb db                	jmp    69d <free+0x3e>
+    p->s.size += bp->s.size;
+ 6c2:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6c5:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6c8:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 6cb:	89 10                	mov    %edx,(%eax)
+ 6cd:	eb da                	jmp    6a9 <free+0x4a>
+
+000006cf <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6cf:	55                   	push   %ebp
+ 6d0:	89 e5                	mov    %esp,%ebp
+ 6d2:	53                   	push   %ebx
+ 6d3:	83 ec 04             	sub    $0x4,%esp
+ 6d6:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 6d8:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 6dd:	77 05                	ja     6e4 <morecore+0x15>
+    nu = 4096;
+ 6df:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6e4:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 6eb:	83 ec 0c             	sub    $0xc,%esp
+ 6ee:	50                   	push   %eax
+ 6ef:	e8 e8 fc ff ff       	call   3dc <sbrk>
+  if(p == (char*)-1)
+ 6f4:	83 c4 10             	add    $0x10,%esp
+ 6f7:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6fa:	74 1c                	je     718 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 6fc:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 6ff:	83 c0 08             	add    $0x8,%eax
+ 702:	83 ec 0c             	sub    $0xc,%esp
+ 705:	50                   	push   %eax
+ 706:	e8 54 ff ff ff       	call   65f <free>
+  return freep;
+ 70b:	a1 04 0c 00 00       	mov    0xc04,%eax
+ 710:	83 c4 10             	add    $0x10,%esp
+}
+ 713:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 716:	c9                   	leave
+ 717:	c3                   	ret
+    return 0;
+ 718:	b8 00 00 00 00       	mov    $0x0,%eax
+ 71d:	eb f4                	jmp    713 <morecore+0x44>
+
+0000071f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 71f:	55                   	push   %ebp
+ 720:	89 e5                	mov    %esp,%ebp
+ 722:	53                   	push   %ebx
+ 723:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 726:	8b 45 08             	mov    0x8(%ebp),%eax
+ 729:	8d 58 07             	lea    0x7(%eax),%ebx
+ 72c:	c1 eb 03             	shr    $0x3,%ebx
+ 72f:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 732:	8b 0d 04 0c 00 00    	mov    0xc04,%ecx
+ 738:	85 c9                	test   %ecx,%ecx
+ 73a:	74 04                	je     740 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 73c:	8b 01                	mov    (%ecx),%eax
+ 73e:	eb 4a                	jmp    78a <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 740:	c7 05 04 0c 00 00 08 	movl   $0xc08,0xc04
+ 747:	0c 00 00 
+ 74a:	c7 05 08 0c 00 00 08 	movl   $0xc08,0xc08
+ 751:	0c 00 00 
+    base.s.size = 0;
+ 754:	c7 05 0c 0c 00 00 00 	movl   $0x0,0xc0c
+ 75b:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 75e:	b9 08 0c 00 00       	mov    $0xc08,%ecx
+ 763:	eb d7                	jmp    73c <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 765:	74 19                	je     780 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 767:	29 da                	sub    %ebx,%edx
+ 769:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 76c:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 76f:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 772:	89 0d 04 0c 00 00    	mov    %ecx,0xc04
+      return (void*)(p + 1);
+ 778:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 77b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 77e:	c9                   	leave
+ 77f:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 780:	8b 10                	mov    (%eax),%edx
+ 782:	89 11                	mov    %edx,(%ecx)
+ 784:	eb ec                	jmp    772 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 786:	89 c1                	mov    %eax,%ecx
+ 788:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 78a:	8b 50 04             	mov    0x4(%eax),%edx
+ 78d:	39 da                	cmp    %ebx,%edx
+ 78f:	73 d4                	jae    765 <malloc+0x46>
+    if(p == freep)
+ 791:	39 05 04 0c 00 00    	cmp    %eax,0xc04
+ 797:	75 ed                	jne    786 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 799:	89 d8                	mov    %ebx,%eax
+ 79b:	e8 2f ff ff ff       	call   6cf <morecore>
+ 7a0:	85 c0                	test   %eax,%eax
+ 7a2:	75 e2                	jne    786 <malloc+0x67>
+ 7a4:	eb d5                	jmp    77b <malloc+0x5c>
@@ -0,0 +1,1519 @@
+
+_p4-priority:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <testPromotion>:
+// This tests the promotion facility.
+//
+// It is assumed that setpriority will return the appropriate success/failure codes
+void
+testPromotion(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+  int pid, prio, newPrio, rc;
+  // Test promotion
+  printf(1, "\n\nTesting promotion...\n");
+   5:	83 ec 08             	sub    $0x8,%esp
+   8:	68 04 0a 00 00       	push   $0xa04
+   d:	6a 01                	push   $0x1
+   f:	e8 43 07 00 00       	call   757 <printf>
+  pid = getpid();
+  14:	e8 19 06 00 00       	call   632 <getpid>
+  19:	89 c3                	mov    %eax,%ebx
+
+  rc = setpriority(pid, 0);
+  1b:	83 c4 08             	add    $0x8,%esp
+  1e:	6a 00                	push   $0x0
+  20:	50                   	push   %eax
+  21:	e8 74 06 00 00       	call   69a <setpriority>
+
+  if (rc != 0) {
+  26:	83 c4 10             	add    $0x10,%esp
+  29:	85 c0                	test   %eax,%eax
+  2b:	75 49                	jne    76 <testPromotion+0x76>
+    printf(2, "setpriority returned failure code!\n");
+    printf(2, "**** TEST FAILED ****\n\n\n");
+    return;
+  }
+
+  prio = getpriority(pid);
+  2d:	83 ec 0c             	sub    $0xc,%esp
+  30:	53                   	push   %ebx
+  31:	e8 5c 06 00 00       	call   692 <getpriority>
+  36:	89 c6                	mov    %eax,%esi
+
+  sleep(TICKS_TO_PROMOTE + 100);
+  38:	c7 04 24 1c 0c 00 00 	movl   $0xc1c,(%esp)
+  3f:	e8 fe 05 00 00       	call   642 <sleep>
+
+  newPrio = getpriority(pid);
+  44:	89 1c 24             	mov    %ebx,(%esp)
+  47:	e8 46 06 00 00       	call   692 <getpriority>
+
+  if (newPrio != prio && newPrio > prio) {
+  4c:	83 c4 10             	add    $0x10,%esp
+  4f:	39 c6                	cmp    %eax,%esi
+  51:	7d 4b                	jge    9e <testPromotion+0x9e>
+    printf(1, "Promotion has occurred.\n");
+  53:	83 ec 08             	sub    $0x8,%esp
+  56:	68 35 0a 00 00       	push   $0xa35
+  5b:	6a 01                	push   $0x1
+  5d:	e8 f5 06 00 00       	call   757 <printf>
+    printf(1, "**** TEST PASSES ****\n\n\n");
+  62:	83 c4 08             	add    $0x8,%esp
+  65:	68 4e 0a 00 00       	push   $0xa4e
+  6a:	6a 01                	push   $0x1
+  6c:	e8 e6 06 00 00       	call   757 <printf>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	eb 21                	jmp    97 <testPromotion+0x97>
+    printf(2, "setpriority returned failure code!\n");
+  76:	83 ec 08             	sub    $0x8,%esp
+  79:	68 08 0b 00 00       	push   $0xb08
+  7e:	6a 02                	push   $0x2
+  80:	e8 d2 06 00 00       	call   757 <printf>
+    printf(2, "**** TEST FAILED ****\n\n\n");
+  85:	83 c4 08             	add    $0x8,%esp
+  88:	68 1c 0a 00 00       	push   $0xa1c
+  8d:	6a 02                	push   $0x2
+  8f:	e8 c3 06 00 00       	call   757 <printf>
+    return;
+  94:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(2, "Either promotion did not occur or an unexpected change in priority happened.\n");
+    printf(2, "**** TEST FAILED ****\n\n\n");
+  }
+}
+  97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  9a:	5b                   	pop    %ebx
+  9b:	5e                   	pop    %esi
+  9c:	5d                   	pop    %ebp
+  9d:	c3                   	ret
+    printf(2, "Either promotion did not occur or an unexpected change in priority happened.\n");
+  9e:	83 ec 08             	sub    $0x8,%esp
+  a1:	68 2c 0b 00 00       	push   $0xb2c
+  a6:	6a 02                	push   $0x2
+  a8:	e8 aa 06 00 00       	call   757 <printf>
+    printf(2, "**** TEST FAILED ****\n\n\n");
+  ad:	83 c4 08             	add    $0x8,%esp
+  b0:	68 1c 0a 00 00       	push   $0xa1c
+  b5:	6a 02                	push   $0x2
+  b7:	e8 9b 06 00 00       	call   757 <printf>
+  bc:	83 c4 10             	add    $0x10,%esp
+  bf:	eb d6                	jmp    97 <testPromotion+0x97>
+
+000000c1 <checkPriority>:
+
+// Create a process and change the priority
+void
+checkPriority(void)
+{
+  c1:	55                   	push   %ebp
+  c2:	89 e5                	mov    %esp,%ebp
+  c4:	57                   	push   %edi
+  c5:	56                   	push   %esi
+  c6:	53                   	push   %ebx
+  c7:	83 ec 14             	sub    $0x14,%esp
+  int pid;
+  int originalPriority;
+  int newPriority;
+  int rc;
+
+  printf(1, "Testing that process starts at MAXPRIO\n");
+  ca:	68 7c 0b 00 00       	push   $0xb7c
+  cf:	6a 01                	push   $0x1
+  d1:	e8 81 06 00 00       	call   757 <printf>
+
+  pid = getpid();
+  d6:	e8 57 05 00 00       	call   632 <getpid>
+  db:	89 c3                	mov    %eax,%ebx
+  originalPriority = getpriority(pid);
+  dd:	89 04 24             	mov    %eax,(%esp)
+  e0:	e8 ad 05 00 00       	call   692 <getpriority>
+  e5:	89 c6                	mov    %eax,%esi
+
+  printf(1, "Priority after program start is %d\n", originalPriority);
+  e7:	83 c4 0c             	add    $0xc,%esp
+  ea:	50                   	push   %eax
+  eb:	68 a4 0b 00 00       	push   $0xba4
+  f0:	6a 01                	push   $0x1
+  f2:	e8 60 06 00 00       	call   757 <printf>
+  if (originalPriority != MAXPRIO) {
+  f7:	83 c4 10             	add    $0x10,%esp
+  fa:	83 fe 06             	cmp    $0x6,%esi
+  fd:	0f 84 34 01 00 00    	je     237 <checkPriority+0x176>
+    printf(2, "Process didn't start at MAXPRIO\n");
+ 103:	83 ec 08             	sub    $0x8,%esp
+ 106:	68 c8 0b 00 00       	push   $0xbc8
+ 10b:	6a 02                	push   $0x2
+ 10d:	e8 45 06 00 00       	call   757 <printf>
+    printf(2, "**** TEST FAILED ****\n\n\n");
+ 112:	83 c4 08             	add    $0x8,%esp
+ 115:	68 1c 0a 00 00       	push   $0xa1c
+ 11a:	6a 02                	push   $0x2
+ 11c:	e8 36 06 00 00       	call   757 <printf>
+ 121:	83 c4 10             	add    $0x10,%esp
+  }
+
+  // Test that setting the priority
+  //  1. Returns an appropriate code on success
+  //  2. Actually changes the priority on success
+  rc = setpriority(pid, MAXPRIO);
+ 124:	83 ec 08             	sub    $0x8,%esp
+ 127:	6a 06                	push   $0x6
+ 129:	53                   	push   %ebx
+ 12a:	e8 6b 05 00 00       	call   69a <setpriority>
+  if (rc != 0) {
+ 12f:	83 c4 10             	add    $0x10,%esp
+ 132:	85 c0                	test   %eax,%eax
+ 134:	0f 84 14 01 00 00    	je     24e <checkPriority+0x18d>
+    printf(2, "setpriority(%d, %d) failed!\n", pid, MAXPRIO);
+ 13a:	6a 06                	push   $0x6
+ 13c:	53                   	push   %ebx
+ 13d:	68 67 0a 00 00       	push   $0xa67
+ 142:	6a 02                	push   $0x2
+ 144:	e8 0e 06 00 00       	call   757 <printf>
+    printf(2, "**** TEST FAILED ****\n\n\n");
+ 149:	83 c4 08             	add    $0x8,%esp
+ 14c:	68 1c 0a 00 00       	push   $0xa1c
+ 151:	6a 02                	push   $0x2
+ 153:	e8 ff 05 00 00       	call   757 <printf>
+ 158:	83 c4 10             	add    $0x10,%esp
+      printf(2, "**** TEST FAILED ****\n\n\n");
+    }
+  }
+
+  // Test that the priority cannot be set to a negative number:
+  printf(1, "Testing that a priority cannot be set to an out of range value.\n");
+ 15b:	83 ec 08             	sub    $0x8,%esp
+ 15e:	68 18 0c 00 00       	push   $0xc18
+ 163:	6a 01                	push   $0x1
+ 165:	e8 ed 05 00 00       	call   757 <printf>
+  printf(1, "  Testing setting priority to a negative number.\n");
+ 16a:	83 c4 08             	add    $0x8,%esp
+ 16d:	68 5c 0c 00 00       	push   $0xc5c
+ 172:	6a 01                	push   $0x1
+ 174:	e8 de 05 00 00       	call   757 <printf>
+  originalPriority = getpriority(pid);
+ 179:	89 1c 24             	mov    %ebx,(%esp)
+ 17c:	e8 11 05 00 00       	call   692 <getpriority>
+ 181:	89 c7                	mov    %eax,%edi
+  rc = setpriority(pid, -1);
+ 183:	83 c4 08             	add    $0x8,%esp
+ 186:	6a ff                	push   $0xffffffff
+ 188:	53                   	push   %ebx
+ 189:	e8 0c 05 00 00       	call   69a <setpriority>
+ 18e:	89 c6                	mov    %eax,%esi
+  printf(1, "  setPriority(%d, -1) returned %d.\n", pid, rc);
+ 190:	50                   	push   %eax
+ 191:	53                   	push   %ebx
+ 192:	68 90 0c 00 00       	push   $0xc90
+ 197:	6a 01                	push   $0x1
+ 199:	e8 b9 05 00 00       	call   757 <printf>
+  if (rc != 0) {
+ 19e:	83 c4 20             	add    $0x20,%esp
+ 1a1:	85 f6                	test   %esi,%esi
+ 1a3:	0f 84 f1 00 00 00    	je     29a <checkPriority+0x1d9>
+    printf(1, "  **** TEST PASSED ****\n\n\n");
+ 1a9:	83 ec 08             	sub    $0x8,%esp
+ 1ac:	68 a1 0a 00 00       	push   $0xaa1
+ 1b1:	6a 01                	push   $0x1
+ 1b3:	e8 9f 05 00 00       	call   757 <printf>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+      printf(2, "  **** TEST FAILED ****\n\n");
+    }
+  }
+
+  // Test that the priority on a bogus PID cannot be set
+  printf(1, "  Testing that a priority cannot be set on a non-existent PID.\n");
+ 1bb:	83 ec 08             	sub    $0x8,%esp
+ 1be:	68 4c 0d 00 00       	push   $0xd4c
+ 1c3:	6a 01                	push   $0x1
+ 1c5:	e8 8d 05 00 00       	call   757 <printf>
+  rc = setpriority(32767, MAXPRIO);
+ 1ca:	83 c4 08             	add    $0x8,%esp
+ 1cd:	6a 06                	push   $0x6
+ 1cf:	68 ff 7f 00 00       	push   $0x7fff
+ 1d4:	e8 c1 04 00 00       	call   69a <setpriority>
+ 1d9:	89 c3                	mov    %eax,%ebx
+  if (rc != 0) {
+ 1db:	83 c4 10             	add    $0x10,%esp
+ 1de:	85 c0                	test   %eax,%eax
+ 1e0:	0f 84 1b 01 00 00    	je     301 <checkPriority+0x240>
+    printf(1, "  **** TEST PASSED ****\n\n\n");
+ 1e6:	83 ec 08             	sub    $0x8,%esp
+ 1e9:	68 a1 0a 00 00       	push   $0xaa1
+ 1ee:	6a 01                	push   $0x1
+ 1f0:	e8 62 05 00 00       	call   757 <printf>
+ 1f5:	83 c4 10             	add    $0x10,%esp
+    printf(2, "  **** TEST FAILED ****\n\n");
+  }
+
+  // Test the priority of a known PID:
+  pid = 1; // init
+  int prio = getpriority(pid);
+ 1f8:	83 ec 0c             	sub    $0xc,%esp
+ 1fb:	6a 01                	push   $0x1
+ 1fd:	e8 90 04 00 00       	call   692 <getpriority>
+  printf(1, "Priority for pid %d is %d\n", pid, prio);
+ 202:	50                   	push   %eax
+ 203:	6a 01                	push   $0x1
+ 205:	68 d6 0a 00 00       	push   $0xad6
+ 20a:	6a 01                	push   $0x1
+ 20c:	e8 46 05 00 00       	call   757 <printf>
+  printf(1, "Press C-p to verify.\n");
+ 211:	83 c4 18             	add    $0x18,%esp
+ 214:	68 f1 0a 00 00       	push   $0xaf1
+ 219:	6a 01                	push   $0x1
+ 21b:	e8 37 05 00 00       	call   757 <printf>
+  sleep(5 * TPS);
+ 220:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+ 227:	e8 16 04 00 00       	call   642 <sleep>
+}
+ 22c:	83 c4 10             	add    $0x10,%esp
+ 22f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 232:	5b                   	pop    %ebx
+ 233:	5e                   	pop    %esi
+ 234:	5f                   	pop    %edi
+ 235:	5d                   	pop    %ebp
+ 236:	c3                   	ret
+    printf(1, "**** TEST PASSED ****\n\n\n");
+ 237:	83 ec 08             	sub    $0x8,%esp
+ 23a:	68 a3 0a 00 00       	push   $0xaa3
+ 23f:	6a 01                	push   $0x1
+ 241:	e8 11 05 00 00       	call   757 <printf>
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	e9 d6 fe ff ff       	jmp    124 <checkPriority+0x63>
+    newPriority = getpriority(pid);
+ 24e:	83 ec 0c             	sub    $0xc,%esp
+ 251:	53                   	push   %ebx
+ 252:	e8 3b 04 00 00       	call   692 <getpriority>
+ 257:	89 c6                	mov    %eax,%esi
+    if (newPriority != MAXPRIO) {
+ 259:	83 c4 10             	add    $0x10,%esp
+ 25c:	83 f8 06             	cmp    $0x6,%eax
+ 25f:	0f 84 f6 fe ff ff    	je     15b <checkPriority+0x9a>
+      printf(2, "setpriority(%d, %d) failed.\n", pid, MAXPRIO);
+ 265:	6a 06                	push   $0x6
+ 267:	53                   	push   %ebx
+ 268:	68 84 0a 00 00       	push   $0xa84
+ 26d:	6a 02                	push   $0x2
+ 26f:	e8 e3 04 00 00       	call   757 <printf>
+      printf(2, "New priority is %d, but it should be %d.\n", newPriority, MAXPRIO);
+ 274:	6a 06                	push   $0x6
+ 276:	56                   	push   %esi
+ 277:	68 ec 0b 00 00       	push   $0xbec
+ 27c:	6a 02                	push   $0x2
+ 27e:	e8 d4 04 00 00       	call   757 <printf>
+      printf(2, "**** TEST FAILED ****\n\n\n");
+ 283:	83 c4 18             	add    $0x18,%esp
+ 286:	68 1c 0a 00 00       	push   $0xa1c
+ 28b:	6a 02                	push   $0x2
+ 28d:	e8 c5 04 00 00       	call   757 <printf>
+ 292:	83 c4 10             	add    $0x10,%esp
+ 295:	e9 c1 fe ff ff       	jmp    15b <checkPriority+0x9a>
+    printf(2, "  setPriority should have indicated failed.\n");
+ 29a:	83 ec 08             	sub    $0x8,%esp
+ 29d:	68 b4 0c 00 00       	push   $0xcb4
+ 2a2:	6a 02                	push   $0x2
+ 2a4:	e8 ae 04 00 00       	call   757 <printf>
+    printf(2, "  **** TEST FAILED ****\n\n");
+ 2a9:	83 c4 08             	add    $0x8,%esp
+ 2ac:	68 bc 0a 00 00       	push   $0xabc
+ 2b1:	6a 02                	push   $0x2
+ 2b3:	e8 9f 04 00 00       	call   757 <printf>
+    newPriority = getpriority(pid);
+ 2b8:	89 1c 24             	mov    %ebx,(%esp)
+ 2bb:	e8 d2 03 00 00       	call   692 <getpriority>
+ 2c0:	89 c3                	mov    %eax,%ebx
+    if (newPriority != originalPriority) {
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	39 c7                	cmp    %eax,%edi
+ 2c7:	0f 84 ee fe ff ff    	je     1bb <checkPriority+0xfa>
+      printf(2, "  setPriority failed but the priority was changed.\n");
+ 2cd:	83 ec 08             	sub    $0x8,%esp
+ 2d0:	68 e4 0c 00 00       	push   $0xce4
+ 2d5:	6a 02                	push   $0x2
+ 2d7:	e8 7b 04 00 00       	call   757 <printf>
+      printf(2, "  Original priority was %d; new priority is %d.\n", originalPriority, newPriority);
+ 2dc:	53                   	push   %ebx
+ 2dd:	57                   	push   %edi
+ 2de:	68 18 0d 00 00       	push   $0xd18
+ 2e3:	6a 02                	push   $0x2
+ 2e5:	e8 6d 04 00 00       	call   757 <printf>
+      printf(2, "  **** TEST FAILED ****\n\n");
+ 2ea:	83 c4 18             	add    $0x18,%esp
+ 2ed:	68 bc 0a 00 00       	push   $0xabc
+ 2f2:	6a 02                	push   $0x2
+ 2f4:	e8 5e 04 00 00       	call   757 <printf>
+ 2f9:	83 c4 10             	add    $0x10,%esp
+ 2fc:	e9 ba fe ff ff       	jmp    1bb <checkPriority+0xfa>
+    printf(2, "  Attempted to set the priority of PID 32767 to %d.\n", MAXPRIO);
+ 301:	83 ec 04             	sub    $0x4,%esp
+ 304:	6a 06                	push   $0x6
+ 306:	68 8c 0d 00 00       	push   $0xd8c
+ 30b:	6a 02                	push   $0x2
+ 30d:	e8 45 04 00 00       	call   757 <printf>
+    printf(2, "  This should have returned a non-zero value but returned %d.\n", rc);
+ 312:	83 c4 0c             	add    $0xc,%esp
+ 315:	53                   	push   %ebx
+ 316:	68 c4 0d 00 00       	push   $0xdc4
+ 31b:	6a 02                	push   $0x2
+ 31d:	e8 35 04 00 00       	call   757 <printf>
+    printf(2, "  **** TEST FAILED ****\n\n");
+ 322:	83 c4 08             	add    $0x8,%esp
+ 325:	68 bc 0a 00 00       	push   $0xabc
+ 32a:	6a 02                	push   $0x2
+ 32c:	e8 26 04 00 00       	call   757 <printf>
+ 331:	83 c4 10             	add    $0x10,%esp
+ 334:	e9 bf fe ff ff       	jmp    1f8 <checkPriority+0x137>
+
+00000339 <main>:
+
+int
+main(int argc, char* argv[])
+{
+ 339:	55                   	push   %ebp
+ 33a:	89 e5                	mov    %esp,%ebp
+ 33c:	83 e4 f0             	and    $0xfffffff0,%esp
+  if (MAXPRIO == 0) {
+    printf(1, "MAXPRIO is 0. Change MAXPRIO and try again\n");
+    exit();
+  }
+
+  checkPriority();
+ 33f:	e8 7d fd ff ff       	call   c1 <checkPriority>
+
+  testPromotion();
+ 344:	e8 b7 fc ff ff       	call   0 <testPromotion>
+  exit();
+ 349:	e8 64 02 00 00       	call   5b2 <exit>
+
+0000034e <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 34e:	55                   	push   %ebp
+ 34f:	89 e5                	mov    %esp,%ebp
+ 351:	56                   	push   %esi
+ 352:	53                   	push   %ebx
+ 353:	8b 75 08             	mov    0x8(%ebp),%esi
+ 356:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 359:	89 f0                	mov    %esi,%eax
+ 35b:	89 d1                	mov    %edx,%ecx
+ 35d:	83 c2 01             	add    $0x1,%edx
+ 360:	89 c3                	mov    %eax,%ebx
+ 362:	83 c0 01             	add    $0x1,%eax
+ 365:	0f b6 09             	movzbl (%ecx),%ecx
+ 368:	88 0b                	mov    %cl,(%ebx)
+ 36a:	84 c9                	test   %cl,%cl
+ 36c:	75 ed                	jne    35b <strcpy+0xd>
+    ;
+  return os;
+}
+ 36e:	89 f0                	mov    %esi,%eax
+ 370:	5b                   	pop    %ebx
+ 371:	5e                   	pop    %esi
+ 372:	5d                   	pop    %ebp
+ 373:	c3                   	ret
+
+00000374 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 374:	55                   	push   %ebp
+ 375:	89 e5                	mov    %esp,%ebp
+ 377:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 37a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 37d:	eb 06                	jmp    385 <strcmp+0x11>
+    p++, q++;
+ 37f:	83 c1 01             	add    $0x1,%ecx
+ 382:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 385:	0f b6 01             	movzbl (%ecx),%eax
+ 388:	84 c0                	test   %al,%al
+ 38a:	74 04                	je     390 <strcmp+0x1c>
+ 38c:	3a 02                	cmp    (%edx),%al
+ 38e:	74 ef                	je     37f <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 390:	0f b6 c0             	movzbl %al,%eax
+ 393:	0f b6 12             	movzbl (%edx),%edx
+ 396:	29 d0                	sub    %edx,%eax
+}
+ 398:	5d                   	pop    %ebp
+ 399:	c3                   	ret
+
+0000039a <strlen>:
+
+uint
+strlen(char *s)
+{
+ 39a:	55                   	push   %ebp
+ 39b:	89 e5                	mov    %esp,%ebp
+ 39d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3a0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3a5:	eb 03                	jmp    3aa <strlen+0x10>
+ 3a7:	83 c0 01             	add    $0x1,%eax
+ 3aa:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3ae:	75 f7                	jne    3a7 <strlen+0xd>
+    ;
+  return n;
+}
+ 3b0:	5d                   	pop    %ebp
+ 3b1:	c3                   	ret
+
+000003b2 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3b2:	55                   	push   %ebp
+ 3b3:	89 e5                	mov    %esp,%ebp
+ 3b5:	57                   	push   %edi
+ 3b6:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3b9:	89 d7                	mov    %edx,%edi
+ 3bb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3be:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3c1:	fc                   	cld
+ 3c2:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3c4:	89 d0                	mov    %edx,%eax
+ 3c6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3c9:	c9                   	leave
+ 3ca:	c3                   	ret
+
+000003cb <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3cb:	55                   	push   %ebp
+ 3cc:	89 e5                	mov    %esp,%ebp
+ 3ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3d5:	eb 03                	jmp    3da <strchr+0xf>
+ 3d7:	83 c0 01             	add    $0x1,%eax
+ 3da:	0f b6 10             	movzbl (%eax),%edx
+ 3dd:	84 d2                	test   %dl,%dl
+ 3df:	74 06                	je     3e7 <strchr+0x1c>
+    if(*s == c)
+ 3e1:	38 ca                	cmp    %cl,%dl
+ 3e3:	75 f2                	jne    3d7 <strchr+0xc>
+ 3e5:	eb 05                	jmp    3ec <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 3e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3ec:	5d                   	pop    %ebp
+ 3ed:	c3                   	ret
+
+000003ee <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3ee:	55                   	push   %ebp
+ 3ef:	89 e5                	mov    %esp,%ebp
+ 3f1:	57                   	push   %edi
+ 3f2:	56                   	push   %esi
+ 3f3:	53                   	push   %ebx
+ 3f4:	83 ec 1c             	sub    $0x1c,%esp
+ 3f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 3ff:	89 de                	mov    %ebx,%esi
+ 401:	83 c3 01             	add    $0x1,%ebx
+ 404:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 407:	7d 2e                	jge    437 <gets+0x49>
+    cc = read(0, &c, 1);
+ 409:	83 ec 04             	sub    $0x4,%esp
+ 40c:	6a 01                	push   $0x1
+ 40e:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 411:	50                   	push   %eax
+ 412:	6a 00                	push   $0x0
+ 414:	e8 b1 01 00 00       	call   5ca <read>
+    if(cc < 1)
+ 419:	83 c4 10             	add    $0x10,%esp
+ 41c:	85 c0                	test   %eax,%eax
+ 41e:	7e 17                	jle    437 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 420:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 424:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 427:	3c 0a                	cmp    $0xa,%al
+ 429:	0f 94 c2             	sete   %dl
+ 42c:	3c 0d                	cmp    $0xd,%al
+ 42e:	0f 94 c0             	sete   %al
+ 431:	08 c2                	or     %al,%dl
+ 433:	74 ca                	je     3ff <gets+0x11>
+    buf[i++] = c;
+ 435:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 437:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 43b:	89 f8                	mov    %edi,%eax
+ 43d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 440:	5b                   	pop    %ebx
+ 441:	5e                   	pop    %esi
+ 442:	5f                   	pop    %edi
+ 443:	5d                   	pop    %ebp
+ 444:	c3                   	ret
+
+00000445 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 445:	55                   	push   %ebp
+ 446:	89 e5                	mov    %esp,%ebp
+ 448:	56                   	push   %esi
+ 449:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 44a:	83 ec 08             	sub    $0x8,%esp
+ 44d:	6a 00                	push   $0x0
+ 44f:	ff 75 08             	push   0x8(%ebp)
+ 452:	e8 9b 01 00 00       	call   5f2 <open>
+  if(fd < 0)
+ 457:	83 c4 10             	add    $0x10,%esp
+ 45a:	85 c0                	test   %eax,%eax
+ 45c:	78 24                	js     482 <stat+0x3d>
+ 45e:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 460:	83 ec 08             	sub    $0x8,%esp
+ 463:	ff 75 0c             	push   0xc(%ebp)
+ 466:	50                   	push   %eax
+ 467:	e8 9e 01 00 00       	call   60a <fstat>
+ 46c:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 46e:	89 1c 24             	mov    %ebx,(%esp)
+ 471:	e8 64 01 00 00       	call   5da <close>
+  return r;
+ 476:	83 c4 10             	add    $0x10,%esp
+}
+ 479:	89 f0                	mov    %esi,%eax
+ 47b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 47e:	5b                   	pop    %ebx
+ 47f:	5e                   	pop    %esi
+ 480:	5d                   	pop    %ebp
+ 481:	c3                   	ret
+    return -1;
+ 482:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 487:	eb f0                	jmp    479 <stat+0x34>
+
+00000489 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 489:	55                   	push   %ebp
+ 48a:	89 e5                	mov    %esp,%ebp
+ 48c:	56                   	push   %esi
+ 48d:	53                   	push   %ebx
+ 48e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 491:	eb 03                	jmp    496 <atoi+0xd>
+ 493:	83 c2 01             	add    $0x1,%edx
+ 496:	0f b6 02             	movzbl (%edx),%eax
+ 499:	3c 20                	cmp    $0x20,%al
+ 49b:	74 f6                	je     493 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 49d:	3c 2d                	cmp    $0x2d,%al
+ 49f:	74 1d                	je     4be <atoi+0x35>
+ 4a1:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4a6:	3c 2b                	cmp    $0x2b,%al
+ 4a8:	0f 94 c1             	sete   %cl
+ 4ab:	3c 2d                	cmp    $0x2d,%al
+ 4ad:	0f 94 c0             	sete   %al
+ 4b0:	08 c1                	or     %al,%cl
+ 4b2:	74 03                	je     4b7 <atoi+0x2e>
+    s++;
+ 4b4:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 4b7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4bc:	eb 17                	jmp    4d5 <atoi+0x4c>
+ 4be:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4c3:	eb e1                	jmp    4a6 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 4c5:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 4c8:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 4cb:	83 c2 01             	add    $0x1,%edx
+ 4ce:	0f be c9             	movsbl %cl,%ecx
+ 4d1:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 4d5:	0f b6 0a             	movzbl (%edx),%ecx
+ 4d8:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 4db:	80 fb 09             	cmp    $0x9,%bl
+ 4de:	76 e5                	jbe    4c5 <atoi+0x3c>
+  return sign*n;
+ 4e0:	0f af c6             	imul   %esi,%eax
+}
+ 4e3:	5b                   	pop    %ebx
+ 4e4:	5e                   	pop    %esi
+ 4e5:	5d                   	pop    %ebp
+ 4e6:	c3                   	ret
+
+000004e7 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 4e7:	55                   	push   %ebp
+ 4e8:	89 e5                	mov    %esp,%ebp
+ 4ea:	56                   	push   %esi
+ 4eb:	53                   	push   %ebx
+ 4ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4ef:	eb 03                	jmp    4f4 <atoo+0xd>
+ 4f1:	83 c2 01             	add    $0x1,%edx
+ 4f4:	0f b6 02             	movzbl (%edx),%eax
+ 4f7:	3c 20                	cmp    $0x20,%al
+ 4f9:	74 f6                	je     4f1 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 4fb:	3c 2d                	cmp    $0x2d,%al
+ 4fd:	74 1d                	je     51c <atoo+0x35>
+ 4ff:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 504:	3c 2b                	cmp    $0x2b,%al
+ 506:	0f 94 c1             	sete   %cl
+ 509:	3c 2d                	cmp    $0x2d,%al
+ 50b:	0f 94 c0             	sete   %al
+ 50e:	08 c1                	or     %al,%cl
+ 510:	74 03                	je     515 <atoo+0x2e>
+    s++;
+ 512:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 515:	b8 00 00 00 00       	mov    $0x0,%eax
+ 51a:	eb 11                	jmp    52d <atoo+0x46>
+ 51c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 521:	eb e1                	jmp    504 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 523:	83 c2 01             	add    $0x1,%edx
+ 526:	0f be c9             	movsbl %cl,%ecx
+ 529:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 52d:	0f b6 0a             	movzbl (%edx),%ecx
+ 530:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 533:	80 fb 07             	cmp    $0x7,%bl
+ 536:	76 eb                	jbe    523 <atoo+0x3c>
+  return sign*n;
+ 538:	0f af c6             	imul   %esi,%eax
+}
+ 53b:	5b                   	pop    %ebx
+ 53c:	5e                   	pop    %esi
+ 53d:	5d                   	pop    %ebp
+ 53e:	c3                   	ret
+
+0000053f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 53f:	55                   	push   %ebp
+ 540:	89 e5                	mov    %esp,%ebp
+ 542:	53                   	push   %ebx
+ 543:	8b 55 08             	mov    0x8(%ebp),%edx
+ 546:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 549:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 54c:	eb 09                	jmp    557 <strncmp+0x18>
+      n--, p++, q++;
+ 54e:	83 e8 01             	sub    $0x1,%eax
+ 551:	83 c2 01             	add    $0x1,%edx
+ 554:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 557:	85 c0                	test   %eax,%eax
+ 559:	74 0b                	je     566 <strncmp+0x27>
+ 55b:	0f b6 1a             	movzbl (%edx),%ebx
+ 55e:	84 db                	test   %bl,%bl
+ 560:	74 04                	je     566 <strncmp+0x27>
+ 562:	3a 19                	cmp    (%ecx),%bl
+ 564:	74 e8                	je     54e <strncmp+0xf>
+    if(n == 0)
+ 566:	85 c0                	test   %eax,%eax
+ 568:	74 0d                	je     577 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 56a:	0f b6 02             	movzbl (%edx),%eax
+ 56d:	0f b6 11             	movzbl (%ecx),%edx
+ 570:	29 d0                	sub    %edx,%eax
+}
+ 572:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 575:	c9                   	leave
+ 576:	c3                   	ret
+      return 0;
+ 577:	b8 00 00 00 00       	mov    $0x0,%eax
+ 57c:	eb f4                	jmp    572 <strncmp+0x33>
+
+0000057e <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 57e:	55                   	push   %ebp
+ 57f:	89 e5                	mov    %esp,%ebp
+ 581:	56                   	push   %esi
+ 582:	53                   	push   %ebx
+ 583:	8b 75 08             	mov    0x8(%ebp),%esi
+ 586:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 589:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 58c:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 58e:	eb 0d                	jmp    59d <memmove+0x1f>
+    *dst++ = *src++;
+ 590:	0f b6 01             	movzbl (%ecx),%eax
+ 593:	88 02                	mov    %al,(%edx)
+ 595:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 598:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 59b:	89 d8                	mov    %ebx,%eax
+ 59d:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 5a0:	85 c0                	test   %eax,%eax
+ 5a2:	7f ec                	jg     590 <memmove+0x12>
+  return vdst;
+}
+ 5a4:	89 f0                	mov    %esi,%eax
+ 5a6:	5b                   	pop    %ebx
+ 5a7:	5e                   	pop    %esi
+ 5a8:	5d                   	pop    %ebp
+ 5a9:	c3                   	ret
+
+000005aa <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5aa:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5af:	cd 40                	int    $0x40
+ 5b1:	c3                   	ret
+
+000005b2 <exit>:
+SYSCALL(exit)
+ 5b2:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5b7:	cd 40                	int    $0x40
+ 5b9:	c3                   	ret
+
+000005ba <wait>:
+SYSCALL(wait)
+ 5ba:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5bf:	cd 40                	int    $0x40
+ 5c1:	c3                   	ret
+
+000005c2 <pipe>:
+SYSCALL(pipe)
+ 5c2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5c7:	cd 40                	int    $0x40
+ 5c9:	c3                   	ret
+
+000005ca <read>:
+SYSCALL(read)
+ 5ca:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5cf:	cd 40                	int    $0x40
+ 5d1:	c3                   	ret
+
+000005d2 <write>:
+SYSCALL(write)
+ 5d2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5d7:	cd 40                	int    $0x40
+ 5d9:	c3                   	ret
+
+000005da <close>:
+SYSCALL(close)
+ 5da:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5df:	cd 40                	int    $0x40
+ 5e1:	c3                   	ret
+
+000005e2 <kill>:
+SYSCALL(kill)
+ 5e2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5e7:	cd 40                	int    $0x40
+ 5e9:	c3                   	ret
+
+000005ea <exec>:
+SYSCALL(exec)
+ 5ea:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5ef:	cd 40                	int    $0x40
+ 5f1:	c3                   	ret
+
+000005f2 <open>:
+SYSCALL(open)
+ 5f2:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5f7:	cd 40                	int    $0x40
+ 5f9:	c3                   	ret
+
+000005fa <mknod>:
+SYSCALL(mknod)
+ 5fa:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5ff:	cd 40                	int    $0x40
+ 601:	c3                   	ret
+
+00000602 <unlink>:
+SYSCALL(unlink)
+ 602:	b8 12 00 00 00       	mov    $0x12,%eax
+ 607:	cd 40                	int    $0x40
+ 609:	c3                   	ret
+
+0000060a <fstat>:
+SYSCALL(fstat)
+ 60a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 60f:	cd 40                	int    $0x40
+ 611:	c3                   	ret
+
+00000612 <link>:
+SYSCALL(link)
+ 612:	b8 13 00 00 00       	mov    $0x13,%eax
+ 617:	cd 40                	int    $0x40
+ 619:	c3                   	ret
+
+0000061a <mkdir>:
+SYSCALL(mkdir)
+ 61a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 61f:	cd 40                	int    $0x40
+ 621:	c3                   	ret
+
+00000622 <chdir>:
+SYSCALL(chdir)
+ 622:	b8 09 00 00 00       	mov    $0x9,%eax
+ 627:	cd 40                	int    $0x40
+ 629:	c3                   	ret
+
+0000062a <dup>:
+SYSCALL(dup)
+ 62a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 62f:	cd 40                	int    $0x40
+ 631:	c3                   	ret
+
+00000632 <getpid>:
+SYSCALL(getpid)
+ 632:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 637:	cd 40                	int    $0x40
+ 639:	c3                   	ret
+
+0000063a <sbrk>:
+SYSCALL(sbrk)
+ 63a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 63f:	cd 40                	int    $0x40
+ 641:	c3                   	ret
+
+00000642 <sleep>:
+SYSCALL(sleep)
+ 642:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 647:	cd 40                	int    $0x40
+ 649:	c3                   	ret
+
+0000064a <uptime>:
+SYSCALL(uptime)
+ 64a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 64f:	cd 40                	int    $0x40
+ 651:	c3                   	ret
+
+00000652 <halt>:
+SYSCALL(halt)
+ 652:	b8 16 00 00 00       	mov    $0x16,%eax
+ 657:	cd 40                	int    $0x40
+ 659:	c3                   	ret
+
+0000065a <date>:
+SYSCALL(date)
+ 65a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 65f:	cd 40                	int    $0x40
+ 661:	c3                   	ret
+
+00000662 <getuid>:
+SYSCALL(getuid)
+ 662:	b8 18 00 00 00       	mov    $0x18,%eax
+ 667:	cd 40                	int    $0x40
+ 669:	c3                   	ret
+
+0000066a <getgid>:
+SYSCALL(getgid)
+ 66a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 66f:	cd 40                	int    $0x40
+ 671:	c3                   	ret
+
+00000672 <getppid>:
+SYSCALL(getppid)
+ 672:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 677:	cd 40                	int    $0x40
+ 679:	c3                   	ret
+
+0000067a <setuid>:
+SYSCALL(setuid)
+ 67a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 67f:	cd 40                	int    $0x40
+ 681:	c3                   	ret
+
+00000682 <setgid>:
+SYSCALL(setgid)
+ 682:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 687:	cd 40                	int    $0x40
+ 689:	c3                   	ret
+
+0000068a <getprocs>:
+SYSCALL(getprocs)
+ 68a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 68f:	cd 40                	int    $0x40
+ 691:	c3                   	ret
+
+00000692 <getpriority>:
+SYSCALL(getpriority)
+ 692:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 697:	cd 40                	int    $0x40
+ 699:	c3                   	ret
+
+0000069a <setpriority>:
+SYSCALL(setpriority)
+ 69a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 69f:	cd 40                	int    $0x40
+ 6a1:	c3                   	ret
+
+000006a2 <pipesize>:
+SYSCALL(pipesize)
+ 6a2:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6a7:	cd 40                	int    $0x40
+ 6a9:	c3                   	ret
+
+000006aa <splice>:
+SYSCALL(splice)
+ 6aa:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6af:	cd 40                	int    $0x40
+ 6b1:	c3                   	ret
+
+000006b2 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6b2:	55                   	push   %ebp
+ 6b3:	89 e5                	mov    %esp,%ebp
+ 6b5:	83 ec 1c             	sub    $0x1c,%esp
+ 6b8:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 6bb:	6a 01                	push   $0x1
+ 6bd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 6c0:	52                   	push   %edx
+ 6c1:	50                   	push   %eax
+ 6c2:	e8 0b ff ff ff       	call   5d2 <write>
+}
+ 6c7:	83 c4 10             	add    $0x10,%esp
+ 6ca:	c9                   	leave
+ 6cb:	c3                   	ret
+
+000006cc <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6cc:	55                   	push   %ebp
+ 6cd:	89 e5                	mov    %esp,%ebp
+ 6cf:	57                   	push   %edi
+ 6d0:	56                   	push   %esi
+ 6d1:	53                   	push   %ebx
+ 6d2:	83 ec 2c             	sub    $0x2c,%esp
+ 6d5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 6d8:	89 d0                	mov    %edx,%eax
+ 6da:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 6dc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 6e0:	0f 95 c1             	setne  %cl
+ 6e3:	c1 ea 1f             	shr    $0x1f,%edx
+ 6e6:	84 d1                	test   %dl,%cl
+ 6e8:	74 44                	je     72e <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 6ea:	f7 d8                	neg    %eax
+ 6ec:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 6ee:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 6fa:	89 c8                	mov    %ecx,%eax
+ 6fc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 701:	f7 f6                	div    %esi
+ 703:	89 df                	mov    %ebx,%edi
+ 705:	83 c3 01             	add    $0x1,%ebx
+ 708:	0f b6 92 64 0e 00 00 	movzbl 0xe64(%edx),%edx
+ 70f:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 713:	89 ca                	mov    %ecx,%edx
+ 715:	89 c1                	mov    %eax,%ecx
+ 717:	39 f2                	cmp    %esi,%edx
+ 719:	73 df                	jae    6fa <printint+0x2e>
+  if(neg)
+ 71b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 71f:	74 31                	je     752 <printint+0x86>
+    buf[i++] = '-';
+ 721:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 726:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 729:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 72c:	eb 17                	jmp    745 <printint+0x79>
+    x = xx;
+ 72e:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 730:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 737:	eb bc                	jmp    6f5 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 739:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 73e:	89 f0                	mov    %esi,%eax
+ 740:	e8 6d ff ff ff       	call   6b2 <putc>
+  while(--i >= 0)
+ 745:	83 eb 01             	sub    $0x1,%ebx
+ 748:	79 ef                	jns    739 <printint+0x6d>
+}
+ 74a:	83 c4 2c             	add    $0x2c,%esp
+ 74d:	5b                   	pop    %ebx
+ 74e:	5e                   	pop    %esi
+ 74f:	5f                   	pop    %edi
+ 750:	5d                   	pop    %ebp
+ 751:	c3                   	ret
+ 752:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 755:	eb ee                	jmp    745 <printint+0x79>
+
+00000757 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 757:	55                   	push   %ebp
+ 758:	89 e5                	mov    %esp,%ebp
+ 75a:	57                   	push   %edi
+ 75b:	56                   	push   %esi
+ 75c:	53                   	push   %ebx
+ 75d:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 760:	8d 45 10             	lea    0x10(%ebp),%eax
+ 763:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 766:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 76b:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 770:	eb 14                	jmp    786 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 772:	89 fa                	mov    %edi,%edx
+ 774:	8b 45 08             	mov    0x8(%ebp),%eax
+ 777:	e8 36 ff ff ff       	call   6b2 <putc>
+ 77c:	eb 05                	jmp    783 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 77e:	83 fe 25             	cmp    $0x25,%esi
+ 781:	74 25                	je     7a8 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 783:	83 c3 01             	add    $0x1,%ebx
+ 786:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 789:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 78d:	84 c0                	test   %al,%al
+ 78f:	0f 84 20 01 00 00    	je     8b5 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 795:	0f be f8             	movsbl %al,%edi
+ 798:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 79b:	85 f6                	test   %esi,%esi
+ 79d:	75 df                	jne    77e <printf+0x27>
+      if(c == '%'){
+ 79f:	83 f8 25             	cmp    $0x25,%eax
+ 7a2:	75 ce                	jne    772 <printf+0x1b>
+        state = '%';
+ 7a4:	89 c6                	mov    %eax,%esi
+ 7a6:	eb db                	jmp    783 <printf+0x2c>
+      if(c == 'd'){
+ 7a8:	83 f8 25             	cmp    $0x25,%eax
+ 7ab:	0f 84 cf 00 00 00    	je     880 <printf+0x129>
+ 7b1:	0f 8c dd 00 00 00    	jl     894 <printf+0x13d>
+ 7b7:	83 f8 78             	cmp    $0x78,%eax
+ 7ba:	0f 8f d4 00 00 00    	jg     894 <printf+0x13d>
+ 7c0:	83 f8 63             	cmp    $0x63,%eax
+ 7c3:	0f 8c cb 00 00 00    	jl     894 <printf+0x13d>
+ 7c9:	83 e8 63             	sub    $0x63,%eax
+ 7cc:	83 f8 15             	cmp    $0x15,%eax
+ 7cf:	0f 87 bf 00 00 00    	ja     894 <printf+0x13d>
+ 7d5:	ff 24 85 0c 0e 00 00 	jmp    *0xe0c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 7dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 7df:	8b 17                	mov    (%edi),%edx
+ 7e1:	83 ec 0c             	sub    $0xc,%esp
+ 7e4:	6a 01                	push   $0x1
+ 7e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ee:	e8 d9 fe ff ff       	call   6cc <printint>
+        ap++;
+ 7f3:	83 c7 04             	add    $0x4,%edi
+ 7f6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 7f9:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 7fc:	be 00 00 00 00       	mov    $0x0,%esi
+ 801:	eb 80                	jmp    783 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 803:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 806:	8b 17                	mov    (%edi),%edx
+ 808:	83 ec 0c             	sub    $0xc,%esp
+ 80b:	6a 00                	push   $0x0
+ 80d:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 812:	8b 45 08             	mov    0x8(%ebp),%eax
+ 815:	e8 b2 fe ff ff       	call   6cc <printint>
+        ap++;
+ 81a:	83 c7 04             	add    $0x4,%edi
+ 81d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 820:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 823:	be 00 00 00 00       	mov    $0x0,%esi
+ 828:	e9 56 ff ff ff       	jmp    783 <printf+0x2c>
+        s = (char*)*ap;
+ 82d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 830:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 832:	83 c0 04             	add    $0x4,%eax
+ 835:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 838:	85 f6                	test   %esi,%esi
+ 83a:	75 15                	jne    851 <printf+0xfa>
+          s = "(null)";
+ 83c:	be 03 0e 00 00       	mov    $0xe03,%esi
+ 841:	eb 0e                	jmp    851 <printf+0xfa>
+          putc(fd, *s);
+ 843:	0f be d2             	movsbl %dl,%edx
+ 846:	8b 45 08             	mov    0x8(%ebp),%eax
+ 849:	e8 64 fe ff ff       	call   6b2 <putc>
+          s++;
+ 84e:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 851:	0f b6 16             	movzbl (%esi),%edx
+ 854:	84 d2                	test   %dl,%dl
+ 856:	75 eb                	jne    843 <printf+0xec>
+      state = 0;
+ 858:	be 00 00 00 00       	mov    $0x0,%esi
+ 85d:	e9 21 ff ff ff       	jmp    783 <printf+0x2c>
+        putc(fd, *ap);
+ 862:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 865:	0f be 17             	movsbl (%edi),%edx
+ 868:	8b 45 08             	mov    0x8(%ebp),%eax
+ 86b:	e8 42 fe ff ff       	call   6b2 <putc>
+        ap++;
+ 870:	83 c7 04             	add    $0x4,%edi
+ 873:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 876:	be 00 00 00 00       	mov    $0x0,%esi
+ 87b:	e9 03 ff ff ff       	jmp    783 <printf+0x2c>
+        putc(fd, c);
+ 880:	89 fa                	mov    %edi,%edx
+ 882:	8b 45 08             	mov    0x8(%ebp),%eax
+ 885:	e8 28 fe ff ff       	call   6b2 <putc>
+      state = 0;
+ 88a:	be 00 00 00 00       	mov    $0x0,%esi
+ 88f:	e9 ef fe ff ff       	jmp    783 <printf+0x2c>
+        putc(fd, '%');
+ 894:	ba 25 00 00 00       	mov    $0x25,%edx
+ 899:	8b 45 08             	mov    0x8(%ebp),%eax
+ 89c:	e8 11 fe ff ff       	call   6b2 <putc>
+        putc(fd, c);
+ 8a1:	89 fa                	mov    %edi,%edx
+ 8a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8a6:	e8 07 fe ff ff       	call   6b2 <putc>
+      state = 0;
+ 8ab:	be 00 00 00 00       	mov    $0x0,%esi
+ 8b0:	e9 ce fe ff ff       	jmp    783 <printf+0x2c>
+    }
+  }
+}
+ 8b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8b8:	5b                   	pop    %ebx
+ 8b9:	5e                   	pop    %esi
+ 8ba:	5f                   	pop    %edi
+ 8bb:	5d                   	pop    %ebp
+ 8bc:	c3                   	ret
+
+000008bd <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8bd:	55                   	push   %ebp
+ 8be:	89 e5                	mov    %esp,%ebp
+ 8c0:	57                   	push   %edi
+ 8c1:	56                   	push   %esi
+ 8c2:	53                   	push   %ebx
+ 8c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 8c6:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c9:	a1 ac 11 00 00       	mov    0x11ac,%eax
+ 8ce:	eb 02                	jmp    8d2 <free+0x15>
+ 8d0:	89 d0                	mov    %edx,%eax
+ 8d2:	39 c8                	cmp    %ecx,%eax
+ 8d4:	73 04                	jae    8da <free+0x1d>
+ 8d6:	3b 08                	cmp    (%eax),%ecx
+ 8d8:	72 12                	jb     8ec <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8da:	8b 10                	mov    (%eax),%edx
+ 8dc:	39 d0                	cmp    %edx,%eax
+ 8de:	72 f0                	jb     8d0 <free+0x13>
+ 8e0:	39 c8                	cmp    %ecx,%eax
+ 8e2:	72 08                	jb     8ec <free+0x2f>
+ 8e4:	39 d1                	cmp    %edx,%ecx
+ 8e6:	72 04                	jb     8ec <free+0x2f>
+ 8e8:	89 d0                	mov    %edx,%eax
+ 8ea:	eb e6                	jmp    8d2 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8ec:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8ef:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8f2:	8b 10                	mov    (%eax),%edx
+ 8f4:	39 d7                	cmp    %edx,%edi
+ 8f6:	74 19                	je     911 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8f8:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8fb:	8b 50 04             	mov    0x4(%eax),%edx
+ 8fe:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 901:	39 ce                	cmp    %ecx,%esi
+ 903:	74 1b                	je     920 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 905:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 907:	a3 ac 11 00 00       	mov    %eax,0x11ac
+}
+ 90c:	5b                   	pop    %ebx
+ 90d:	5e                   	pop    %esi
+ 90e:	5f                   	pop    %edi
+ 90f:	5d                   	pop    %ebp
+ 910:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 911:	03 72 04             	add    0x4(%edx),%esi
+ 914:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 917:	8b 10                	mov    (%eax),%edx
+ 919:	8b 12                	mov    (%edx),%edx
+ 91b:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 91e:	eb db                	jmp    8fb <free+0x3e>
+    p->s.size += bp->s.size;
+ 920:	03 53 fc             	add    -0x4(%ebx),%edx
+ 923:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 926:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 929:	89 10                	mov    %edx,(%eax)
+ 92b:	eb da                	jmp    907 <free+0x4a>
+
+0000092d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 92d:	55                   	push   %ebp
+ 92e:	89 e5                	mov    %esp,%ebp
+ 930:	53                   	push   %ebx
+ 931:	83 ec 04             	sub    $0x4,%esp
+ 934:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 936:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 93b:	77 05                	ja     942 <morecore+0x15>
+    nu = 4096;
+ 93d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 942:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 949:	83 ec 0c             	sub    $0xc,%esp
+ 94c:	50                   	push   %eax
+ 94d:	e8 e8 fc ff ff       	call   63a <sbrk>
+  if(p == (char*)-1)
+ 952:	83 c4 10             	add    $0x10,%esp
+ 955:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 958:	74 1c                	je     976 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 95a:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 95d:	83 c0 08             	add    $0x8,%eax
+ 960:	83 ec 0c             	sub    $0xc,%esp
+ 963:	50                   	push   %eax
+ 964:	e8 54 ff ff ff       	call   8bd <free>
+  return freep;
+ 969:	a1 ac 11 00 00       	mov    0x11ac,%eax
+ 96e:	83 c4 10             	add    $0x10,%esp
+}
+ 971:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 974:	c9                   	leave
+ 975:	c3                   	ret
+    return 0;
+ 976:	b8 00 00 00 00       	mov    $0x0,%eax
+ 97b:	eb f4                	jmp    971 <morecore+0x44>
+
+0000097d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 97d:	55                   	push   %ebp
+ 97e:	89 e5                	mov    %esp,%ebp
+ 980:	53                   	push   %ebx
+ 981:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 984:	8b 45 08             	mov    0x8(%ebp),%eax
+ 987:	8d 58 07             	lea    0x7(%eax),%ebx
+ 98a:	c1 eb 03             	shr    $0x3,%ebx
+ 98d:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 990:	8b 0d ac 11 00 00    	mov    0x11ac,%ecx
+ 996:	85 c9                	test   %ecx,%ecx
+ 998:	74 04                	je     99e <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 99a:	8b 01                	mov    (%ecx),%eax
+ 99c:	eb 4a                	jmp    9e8 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 99e:	c7 05 ac 11 00 00 b0 	movl   $0x11b0,0x11ac
+ 9a5:	11 00 00 
+ 9a8:	c7 05 b0 11 00 00 b0 	movl   $0x11b0,0x11b0
+ 9af:	11 00 00 
+    base.s.size = 0;
+ 9b2:	c7 05 b4 11 00 00 00 	movl   $0x0,0x11b4
+ 9b9:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 9bc:	b9 b0 11 00 00       	mov    $0x11b0,%ecx
+ 9c1:	eb d7                	jmp    99a <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 9c3:	74 19                	je     9de <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 9c5:	29 da                	sub    %ebx,%edx
+ 9c7:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 9ca:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 9cd:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 9d0:	89 0d ac 11 00 00    	mov    %ecx,0x11ac
+      return (void*)(p + 1);
+ 9d6:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 9d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 9dc:	c9                   	leave
+ 9dd:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 9de:	8b 10                	mov    (%eax),%edx
+ 9e0:	89 11                	mov    %edx,(%ecx)
+ 9e2:	eb ec                	jmp    9d0 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9e4:	89 c1                	mov    %eax,%ecx
+ 9e6:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 9e8:	8b 50 04             	mov    0x4(%eax),%edx
+ 9eb:	39 da                	cmp    %ebx,%edx
+ 9ed:	73 d4                	jae    9c3 <malloc+0x46>
+    if(p == freep)
+ 9ef:	39 05 ac 11 00 00    	cmp    %eax,0x11ac
+ 9f5:	75 ed                	jne    9e4 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 9f7:	89 d8                	mov    %ebx,%eax
+ 9f9:	e8 2f ff ff ff       	call   92d <morecore>
+ 9fe:	85 c0                	test   %eax,%eax
+ a00:	75 e2                	jne    9e4 <malloc+0x67>
+ a02:	eb d5                	jmp    9d9 <malloc+0x5c>
@@ -0,0 +1,1347 @@
+
+_p4-test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <createProcess>:
+// Every seventh process will sleep for P4T_CHILD_SLEEP_SECONDS (whatever that
+// might be). This can be used to demonstrate that sleeping processes are not
+// being scheduled in the system.
+int
+createProcess(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+  // What time is it right now?
+  int start = uptime();
+   5:	e8 7a 04 00 00       	call   484 <uptime>
+  // When should this process stop running?
+  int end = start + (P4T_SECONDS * TPS);
+   a:	8d 98 60 ea 00 00    	lea    0xea60(%eax),%ebx
+  // A counter to track the pointless CPU cycles we're using
+  int counter = COUNTER_START;
+  // Store the return value of fork() so we know if this is the child or the
+  // parent process.
+  int rc = fork();
+  10:	e8 cf 03 00 00       	call   3e4 <fork>
+
+  if (rc == 0) {
+  15:	85 c0                	test   %eax,%eax
+  17:	74 2e                	je     47 <createProcess+0x47>
+  19:	89 c6                	mov    %eax,%esi
+        }
+      }
+
+      counter = COUNTER_START;
+    }
+  } else if (rc < 0) {
+  1b:	78 62                	js     7f <createProcess+0x7f>
+    // by `p4-test&`
+    printf(2, "Fork failed! Done creating\n");
+  }
+
+  return rc;
+}
+  1d:	89 f0                	mov    %esi,%eax
+  1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  22:	5b                   	pop    %ebx
+  23:	5e                   	pop    %esi
+  24:	5d                   	pop    %ebp
+  25:	c3                   	ret
+        exit();
+  26:	e8 c1 03 00 00       	call   3ec <exit>
+        sleep(P4T_CHILD_SLEEP_SECONDS);
+  2b:	83 ec 0c             	sub    $0xc,%esp
+  2e:	68 20 bf 02 00       	push   $0x2bf20
+  33:	e8 44 04 00 00       	call   47c <sleep>
+        exit();
+  38:	e8 af 03 00 00       	call   3ec <exit>
+          ++counter;
+  3d:	83 c0 01             	add    $0x1,%eax
+        while (counter < COUNTER_END) {
+  40:	3d 7f 96 98 00       	cmp    $0x98967f,%eax
+  45:	7e f6                	jle    3d <createProcess+0x3d>
+      if (uptime() > end) {
+  47:	e8 38 04 00 00       	call   484 <uptime>
+  4c:	39 d8                	cmp    %ebx,%eax
+  4e:	7f d6                	jg     26 <createProcess+0x26>
+      pid = getpid();
+  50:	e8 17 04 00 00       	call   46c <getpid>
+  55:	89 c1                	mov    %eax,%ecx
+      if (pid % 7 == 0) {
+  57:	ba 93 24 49 92       	mov    $0x92492493,%edx
+  5c:	f7 ea                	imul   %edx
+  5e:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  61:	c1 f8 02             	sar    $0x2,%eax
+  64:	89 ca                	mov    %ecx,%edx
+  66:	c1 fa 1f             	sar    $0x1f,%edx
+  69:	29 d0                	sub    %edx,%eax
+  6b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+  72:	29 c2                	sub    %eax,%edx
+  74:	39 d1                	cmp    %edx,%ecx
+  76:	74 b3                	je     2b <createProcess+0x2b>
+  78:	b8 80 69 67 ff       	mov    $0xff676980,%eax
+  7d:	eb c1                	jmp    40 <createProcess+0x40>
+    printf(2, "Fork failed! Done creating\n");
+  7f:	83 ec 08             	sub    $0x8,%esp
+  82:	68 40 08 00 00       	push   $0x840
+  87:	6a 02                	push   $0x2
+  89:	e8 03 05 00 00       	call   591 <printf>
+  8e:	83 c4 10             	add    $0x10,%esp
+  return rc;
+  91:	eb 8a                	jmp    1d <createProcess+0x1d>
+
+00000093 <main>:
+
+int
+main(int argc, char* argv[])
+{
+  93:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  97:	83 e4 f0             	and    $0xfffffff0,%esp
+  9a:	ff 71 fc             	push   -0x4(%ecx)
+  9d:	55                   	push   %ebp
+  9e:	89 e5                	mov    %esp,%ebp
+  a0:	56                   	push   %esi
+  a1:	53                   	push   %ebx
+  a2:	51                   	push   %ecx
+  a3:	83 ec 0c             	sub    $0xc,%esp
+  // Track the count of processes that we've created
+  int pc = 0;
+  a6:	be 00 00 00 00       	mov    $0x0,%esi
+  // This spreads the processes out so that it should be possible to see
+  // multiple queues in use at the same time.
+  //
+  // If, for some reason, you are not seeing that behavior, adjust the budget
+  // or promotion timer accordingly.
+  while (pc < P4T_MAX) {
+  ab:	eb 3e                	jmp    eb <main+0x58>
+      }
+      ++pc;
+    }
+
+    printf(1, "Created %d processes. Sleeping for %d seconds.\n",
+           pc % P4T_TO_CREATE ? pc % P4T_TO_CREATE : P4T_TO_CREATE,
+  ad:	ba 67 66 66 66       	mov    $0x66666667,%edx
+  b2:	89 f0                	mov    %esi,%eax
+  b4:	f7 ea                	imul   %edx
+  b6:	d1 fa                	sar    %edx
+  b8:	89 f0                	mov    %esi,%eax
+  ba:	c1 f8 1f             	sar    $0x1f,%eax
+  bd:	29 c2                	sub    %eax,%edx
+  bf:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    printf(1, "Created %d processes. Sleeping for %d seconds.\n",
+  c2:	89 f2                	mov    %esi,%edx
+  c4:	29 c2                	sub    %eax,%edx
+  c6:	75 05                	jne    cd <main+0x3a>
+  c8:	ba 05 00 00 00       	mov    $0x5,%edx
+  cd:	6a 01                	push   $0x1
+  cf:	52                   	push   %edx
+  d0:	68 7c 08 00 00       	push   $0x87c
+  d5:	6a 01                	push   $0x1
+  d7:	e8 b5 04 00 00       	call   591 <printf>
+           P4T_PARENT_SLEEP_SECONDS);
+    sleep(P4T_PARENT_SLEEP_SECONDS * TPS);
+  dc:	c7 04 24 e8 03 00 00 	movl   $0x3e8,(%esp)
+  e3:	e8 94 03 00 00       	call   47c <sleep>
+  e8:	83 c4 10             	add    $0x10,%esp
+  while (pc < P4T_MAX) {
+  eb:	83 fe 3b             	cmp    $0x3b,%esi
+  ee:	7f 1c                	jg     10c <main+0x79>
+    for (i = 0; i < P4T_TO_CREATE; ++i) {
+  f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  f5:	83 fb 04             	cmp    $0x4,%ebx
+  f8:	7f b3                	jg     ad <main+0x1a>
+      if (createProcess() == -1) {
+  fa:	e8 01 ff ff ff       	call   0 <createProcess>
+  ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 102:	74 a9                	je     ad <main+0x1a>
+      ++pc;
+ 104:	83 c6 01             	add    $0x1,%esi
+    for (i = 0; i < P4T_TO_CREATE; ++i) {
+ 107:	83 c3 01             	add    $0x1,%ebx
+ 10a:	eb e9                	jmp    f5 <main+0x62>
+  }
+
+  printf(1, "Created %d processes.\n", pc);
+ 10c:	83 ec 04             	sub    $0x4,%esp
+ 10f:	56                   	push   %esi
+ 110:	68 5c 08 00 00       	push   $0x85c
+ 115:	6a 01                	push   $0x1
+ 117:	e8 75 04 00 00       	call   591 <printf>
+
+  // Loop for approximately one minute while prompting for action.
+  for (i = 0; i < 6; ++i) {
+ 11c:	83 c4 10             	add    $0x10,%esp
+ 11f:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 124:	83 fb 05             	cmp    $0x5,%ebx
+ 127:	7f 41                	jg     16a <main+0xd7>
+    // Prompt for action!
+    printf(1, "Now verify that your system is working by pressing C-p and then C-r.\n");
+ 129:	83 ec 08             	sub    $0x8,%esp
+ 12c:	68 ac 08 00 00       	push   $0x8ac
+ 131:	6a 01                	push   $0x1
+ 133:	e8 59 04 00 00       	call   591 <printf>
+    // Now sleep for 10 seconds so the user can actually do something
+    sleep(10 * TPS);
+ 138:	c7 04 24 10 27 00 00 	movl   $0x2710,(%esp)
+ 13f:	e8 38 03 00 00       	call   47c <sleep>
+  for (i = 0; i < 6; ++i) {
+ 144:	83 c3 01             	add    $0x1,%ebx
+ 147:	83 c4 10             	add    $0x10,%esp
+ 14a:	eb d8                	jmp    124 <main+0x91>
+
+  // Just make sure that all child processes have exited so we don't leave
+  // orphaned processes hanging around. If there are any child processes,
+  // print a helpful message and then sleep for 1 second.
+  while (wait() != -1) {
+    printf(1, "Waiting on all child processes to exit...\n");
+ 14c:	83 ec 08             	sub    $0x8,%esp
+ 14f:	68 f4 08 00 00       	push   $0x8f4
+ 154:	6a 01                	push   $0x1
+ 156:	e8 36 04 00 00       	call   591 <printf>
+    sleep(TPS);
+ 15b:	c7 04 24 e8 03 00 00 	movl   $0x3e8,(%esp)
+ 162:	e8 15 03 00 00       	call   47c <sleep>
+ 167:	83 c4 10             	add    $0x10,%esp
+  while (wait() != -1) {
+ 16a:	e8 85 02 00 00       	call   3f4 <wait>
+ 16f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 172:	75 d8                	jne    14c <main+0xb9>
+  }
+
+  printf(1, "Done!\n");
+ 174:	83 ec 08             	sub    $0x8,%esp
+ 177:	68 73 08 00 00       	push   $0x873
+ 17c:	6a 01                	push   $0x1
+ 17e:	e8 0e 04 00 00       	call   591 <printf>
+
+  exit();
+ 183:	e8 64 02 00 00       	call   3ec <exit>
+
+00000188 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 188:	55                   	push   %ebp
+ 189:	89 e5                	mov    %esp,%ebp
+ 18b:	56                   	push   %esi
+ 18c:	53                   	push   %ebx
+ 18d:	8b 75 08             	mov    0x8(%ebp),%esi
+ 190:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 193:	89 f0                	mov    %esi,%eax
+ 195:	89 d1                	mov    %edx,%ecx
+ 197:	83 c2 01             	add    $0x1,%edx
+ 19a:	89 c3                	mov    %eax,%ebx
+ 19c:	83 c0 01             	add    $0x1,%eax
+ 19f:	0f b6 09             	movzbl (%ecx),%ecx
+ 1a2:	88 0b                	mov    %cl,(%ebx)
+ 1a4:	84 c9                	test   %cl,%cl
+ 1a6:	75 ed                	jne    195 <strcpy+0xd>
+    ;
+  return os;
+}
+ 1a8:	89 f0                	mov    %esi,%eax
+ 1aa:	5b                   	pop    %ebx
+ 1ab:	5e                   	pop    %esi
+ 1ac:	5d                   	pop    %ebp
+ 1ad:	c3                   	ret
+
+000001ae <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1ae:	55                   	push   %ebp
+ 1af:	89 e5                	mov    %esp,%ebp
+ 1b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 1b7:	eb 06                	jmp    1bf <strcmp+0x11>
+    p++, q++;
+ 1b9:	83 c1 01             	add    $0x1,%ecx
+ 1bc:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 1bf:	0f b6 01             	movzbl (%ecx),%eax
+ 1c2:	84 c0                	test   %al,%al
+ 1c4:	74 04                	je     1ca <strcmp+0x1c>
+ 1c6:	3a 02                	cmp    (%edx),%al
+ 1c8:	74 ef                	je     1b9 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 1ca:	0f b6 c0             	movzbl %al,%eax
+ 1cd:	0f b6 12             	movzbl (%edx),%edx
+ 1d0:	29 d0                	sub    %edx,%eax
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+
+000001d4 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1d4:	55                   	push   %ebp
+ 1d5:	89 e5                	mov    %esp,%ebp
+ 1d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1da:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1df:	eb 03                	jmp    1e4 <strlen+0x10>
+ 1e1:	83 c0 01             	add    $0x1,%eax
+ 1e4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1e8:	75 f7                	jne    1e1 <strlen+0xd>
+    ;
+  return n;
+}
+ 1ea:	5d                   	pop    %ebp
+ 1eb:	c3                   	ret
+
+000001ec <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1ec:	55                   	push   %ebp
+ 1ed:	89 e5                	mov    %esp,%ebp
+ 1ef:	57                   	push   %edi
+ 1f0:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1f3:	89 d7                	mov    %edx,%edi
+ 1f5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fb:	fc                   	cld
+ 1fc:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1fe:	89 d0                	mov    %edx,%eax
+ 200:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 203:	c9                   	leave
+ 204:	c3                   	ret
+
+00000205 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 205:	55                   	push   %ebp
+ 206:	89 e5                	mov    %esp,%ebp
+ 208:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20f:	eb 03                	jmp    214 <strchr+0xf>
+ 211:	83 c0 01             	add    $0x1,%eax
+ 214:	0f b6 10             	movzbl (%eax),%edx
+ 217:	84 d2                	test   %dl,%dl
+ 219:	74 06                	je     221 <strchr+0x1c>
+    if(*s == c)
+ 21b:	38 ca                	cmp    %cl,%dl
+ 21d:	75 f2                	jne    211 <strchr+0xc>
+ 21f:	eb 05                	jmp    226 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 221:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 226:	5d                   	pop    %ebp
+ 227:	c3                   	ret
+
+00000228 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 228:	55                   	push   %ebp
+ 229:	89 e5                	mov    %esp,%ebp
+ 22b:	57                   	push   %edi
+ 22c:	56                   	push   %esi
+ 22d:	53                   	push   %ebx
+ 22e:	83 ec 1c             	sub    $0x1c,%esp
+ 231:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 234:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 239:	89 de                	mov    %ebx,%esi
+ 23b:	83 c3 01             	add    $0x1,%ebx
+ 23e:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 241:	7d 2e                	jge    271 <gets+0x49>
+    cc = read(0, &c, 1);
+ 243:	83 ec 04             	sub    $0x4,%esp
+ 246:	6a 01                	push   $0x1
+ 248:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 24b:	50                   	push   %eax
+ 24c:	6a 00                	push   $0x0
+ 24e:	e8 b1 01 00 00       	call   404 <read>
+    if(cc < 1)
+ 253:	83 c4 10             	add    $0x10,%esp
+ 256:	85 c0                	test   %eax,%eax
+ 258:	7e 17                	jle    271 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 25a:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 25e:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 261:	3c 0a                	cmp    $0xa,%al
+ 263:	0f 94 c2             	sete   %dl
+ 266:	3c 0d                	cmp    $0xd,%al
+ 268:	0f 94 c0             	sete   %al
+ 26b:	08 c2                	or     %al,%dl
+ 26d:	74 ca                	je     239 <gets+0x11>
+    buf[i++] = c;
+ 26f:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 271:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 275:	89 f8                	mov    %edi,%eax
+ 277:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27a:	5b                   	pop    %ebx
+ 27b:	5e                   	pop    %esi
+ 27c:	5f                   	pop    %edi
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+
+0000027f <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 27f:	55                   	push   %ebp
+ 280:	89 e5                	mov    %esp,%ebp
+ 282:	56                   	push   %esi
+ 283:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 284:	83 ec 08             	sub    $0x8,%esp
+ 287:	6a 00                	push   $0x0
+ 289:	ff 75 08             	push   0x8(%ebp)
+ 28c:	e8 9b 01 00 00       	call   42c <open>
+  if(fd < 0)
+ 291:	83 c4 10             	add    $0x10,%esp
+ 294:	85 c0                	test   %eax,%eax
+ 296:	78 24                	js     2bc <stat+0x3d>
+ 298:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 29a:	83 ec 08             	sub    $0x8,%esp
+ 29d:	ff 75 0c             	push   0xc(%ebp)
+ 2a0:	50                   	push   %eax
+ 2a1:	e8 9e 01 00 00       	call   444 <fstat>
+ 2a6:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2a8:	89 1c 24             	mov    %ebx,(%esp)
+ 2ab:	e8 64 01 00 00       	call   414 <close>
+  return r;
+ 2b0:	83 c4 10             	add    $0x10,%esp
+}
+ 2b3:	89 f0                	mov    %esi,%eax
+ 2b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2b8:	5b                   	pop    %ebx
+ 2b9:	5e                   	pop    %esi
+ 2ba:	5d                   	pop    %ebp
+ 2bb:	c3                   	ret
+    return -1;
+ 2bc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2c1:	eb f0                	jmp    2b3 <stat+0x34>
+
+000002c3 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 2c3:	55                   	push   %ebp
+ 2c4:	89 e5                	mov    %esp,%ebp
+ 2c6:	56                   	push   %esi
+ 2c7:	53                   	push   %ebx
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2cb:	eb 03                	jmp    2d0 <atoi+0xd>
+ 2cd:	83 c2 01             	add    $0x1,%edx
+ 2d0:	0f b6 02             	movzbl (%edx),%eax
+ 2d3:	3c 20                	cmp    $0x20,%al
+ 2d5:	74 f6                	je     2cd <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 2d7:	3c 2d                	cmp    $0x2d,%al
+ 2d9:	74 1d                	je     2f8 <atoi+0x35>
+ 2db:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2e0:	3c 2b                	cmp    $0x2b,%al
+ 2e2:	0f 94 c1             	sete   %cl
+ 2e5:	3c 2d                	cmp    $0x2d,%al
+ 2e7:	0f 94 c0             	sete   %al
+ 2ea:	08 c1                	or     %al,%cl
+ 2ec:	74 03                	je     2f1 <atoi+0x2e>
+    s++;
+ 2ee:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 2f1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2f6:	eb 17                	jmp    30f <atoi+0x4c>
+ 2f8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2fd:	eb e1                	jmp    2e0 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 2ff:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 302:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 305:	83 c2 01             	add    $0x1,%edx
+ 308:	0f be c9             	movsbl %cl,%ecx
+ 30b:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 30f:	0f b6 0a             	movzbl (%edx),%ecx
+ 312:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 315:	80 fb 09             	cmp    $0x9,%bl
+ 318:	76 e5                	jbe    2ff <atoi+0x3c>
+  return sign*n;
+ 31a:	0f af c6             	imul   %esi,%eax
+}
+ 31d:	5b                   	pop    %ebx
+ 31e:	5e                   	pop    %esi
+ 31f:	5d                   	pop    %ebp
+ 320:	c3                   	ret
+
+00000321 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 321:	55                   	push   %ebp
+ 322:	89 e5                	mov    %esp,%ebp
+ 324:	56                   	push   %esi
+ 325:	53                   	push   %ebx
+ 326:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 329:	eb 03                	jmp    32e <atoo+0xd>
+ 32b:	83 c2 01             	add    $0x1,%edx
+ 32e:	0f b6 02             	movzbl (%edx),%eax
+ 331:	3c 20                	cmp    $0x20,%al
+ 333:	74 f6                	je     32b <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 335:	3c 2d                	cmp    $0x2d,%al
+ 337:	74 1d                	je     356 <atoo+0x35>
+ 339:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 33e:	3c 2b                	cmp    $0x2b,%al
+ 340:	0f 94 c1             	sete   %cl
+ 343:	3c 2d                	cmp    $0x2d,%al
+ 345:	0f 94 c0             	sete   %al
+ 348:	08 c1                	or     %al,%cl
+ 34a:	74 03                	je     34f <atoo+0x2e>
+    s++;
+ 34c:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 34f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 354:	eb 11                	jmp    367 <atoo+0x46>
+ 356:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 35b:	eb e1                	jmp    33e <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 35d:	83 c2 01             	add    $0x1,%edx
+ 360:	0f be c9             	movsbl %cl,%ecx
+ 363:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 367:	0f b6 0a             	movzbl (%edx),%ecx
+ 36a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 36d:	80 fb 07             	cmp    $0x7,%bl
+ 370:	76 eb                	jbe    35d <atoo+0x3c>
+  return sign*n;
+ 372:	0f af c6             	imul   %esi,%eax
+}
+ 375:	5b                   	pop    %ebx
+ 376:	5e                   	pop    %esi
+ 377:	5d                   	pop    %ebp
+ 378:	c3                   	ret
+
+00000379 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 379:	55                   	push   %ebp
+ 37a:	89 e5                	mov    %esp,%ebp
+ 37c:	53                   	push   %ebx
+ 37d:	8b 55 08             	mov    0x8(%ebp),%edx
+ 380:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 383:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 386:	eb 09                	jmp    391 <strncmp+0x18>
+      n--, p++, q++;
+ 388:	83 e8 01             	sub    $0x1,%eax
+ 38b:	83 c2 01             	add    $0x1,%edx
+ 38e:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 391:	85 c0                	test   %eax,%eax
+ 393:	74 0b                	je     3a0 <strncmp+0x27>
+ 395:	0f b6 1a             	movzbl (%edx),%ebx
+ 398:	84 db                	test   %bl,%bl
+ 39a:	74 04                	je     3a0 <strncmp+0x27>
+ 39c:	3a 19                	cmp    (%ecx),%bl
+ 39e:	74 e8                	je     388 <strncmp+0xf>
+    if(n == 0)
+ 3a0:	85 c0                	test   %eax,%eax
+ 3a2:	74 0d                	je     3b1 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 3a4:	0f b6 02             	movzbl (%edx),%eax
+ 3a7:	0f b6 11             	movzbl (%ecx),%edx
+ 3aa:	29 d0                	sub    %edx,%eax
+}
+ 3ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3af:	c9                   	leave
+ 3b0:	c3                   	ret
+      return 0;
+ 3b1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3b6:	eb f4                	jmp    3ac <strncmp+0x33>
+
+000003b8 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3b8:	55                   	push   %ebp
+ 3b9:	89 e5                	mov    %esp,%ebp
+ 3bb:	56                   	push   %esi
+ 3bc:	53                   	push   %ebx
+ 3bd:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 3c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 3c6:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 3c8:	eb 0d                	jmp    3d7 <memmove+0x1f>
+    *dst++ = *src++;
+ 3ca:	0f b6 01             	movzbl (%ecx),%eax
+ 3cd:	88 02                	mov    %al,(%edx)
+ 3cf:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 3d2:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 3d5:	89 d8                	mov    %ebx,%eax
+ 3d7:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 3da:	85 c0                	test   %eax,%eax
+ 3dc:	7f ec                	jg     3ca <memmove+0x12>
+  return vdst;
+}
+ 3de:	89 f0                	mov    %esi,%eax
+ 3e0:	5b                   	pop    %ebx
+ 3e1:	5e                   	pop    %esi
+ 3e2:	5d                   	pop    %ebp
+ 3e3:	c3                   	ret
+
+000003e4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3e4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <exit>:
+SYSCALL(exit)
+ 3ec:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <wait>:
+SYSCALL(wait)
+ 3f4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <pipe>:
+SYSCALL(pipe)
+ 3fc:	b8 04 00 00 00       	mov    $0x4,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <read>:
+SYSCALL(read)
+ 404:	b8 05 00 00 00       	mov    $0x5,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <write>:
+SYSCALL(write)
+ 40c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <close>:
+SYSCALL(close)
+ 414:	b8 15 00 00 00       	mov    $0x15,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <kill>:
+SYSCALL(kill)
+ 41c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <exec>:
+SYSCALL(exec)
+ 424:	b8 07 00 00 00       	mov    $0x7,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <open>:
+SYSCALL(open)
+ 42c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <mknod>:
+SYSCALL(mknod)
+ 434:	b8 11 00 00 00       	mov    $0x11,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <unlink>:
+SYSCALL(unlink)
+ 43c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <fstat>:
+SYSCALL(fstat)
+ 444:	b8 08 00 00 00       	mov    $0x8,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <link>:
+SYSCALL(link)
+ 44c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <mkdir>:
+SYSCALL(mkdir)
+ 454:	b8 14 00 00 00       	mov    $0x14,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <chdir>:
+SYSCALL(chdir)
+ 45c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <dup>:
+SYSCALL(dup)
+ 464:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <getpid>:
+SYSCALL(getpid)
+ 46c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <sbrk>:
+SYSCALL(sbrk)
+ 474:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <sleep>:
+SYSCALL(sleep)
+ 47c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <uptime>:
+SYSCALL(uptime)
+ 484:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <halt>:
+SYSCALL(halt)
+ 48c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <date>:
+SYSCALL(date)
+ 494:	b8 17 00 00 00       	mov    $0x17,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <getuid>:
+SYSCALL(getuid)
+ 49c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <getgid>:
+SYSCALL(getgid)
+ 4a4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <getppid>:
+SYSCALL(getppid)
+ 4ac:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <setuid>:
+SYSCALL(setuid)
+ 4b4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <setgid>:
+SYSCALL(setgid)
+ 4bc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <getprocs>:
+SYSCALL(getprocs)
+ 4c4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <getpriority>:
+SYSCALL(getpriority)
+ 4cc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <setpriority>:
+SYSCALL(setpriority)
+ 4d4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <pipesize>:
+SYSCALL(pipesize)
+ 4dc:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <splice>:
+SYSCALL(splice)
+ 4e4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4ec:	55                   	push   %ebp
+ 4ed:	89 e5                	mov    %esp,%ebp
+ 4ef:	83 ec 1c             	sub    $0x1c,%esp
+ 4f2:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4f5:	6a 01                	push   $0x1
+ 4f7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 4fa:	52                   	push   %edx
+ 4fb:	50                   	push   %eax
+ 4fc:	e8 0b ff ff ff       	call   40c <write>
+}
+ 501:	83 c4 10             	add    $0x10,%esp
+ 504:	c9                   	leave
+ 505:	c3                   	ret
+
+00000506 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 506:	55                   	push   %ebp
+ 507:	89 e5                	mov    %esp,%ebp
+ 509:	57                   	push   %edi
+ 50a:	56                   	push   %esi
+ 50b:	53                   	push   %ebx
+ 50c:	83 ec 2c             	sub    $0x2c,%esp
+ 50f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 512:	89 d0                	mov    %edx,%eax
+ 514:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 516:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 51a:	0f 95 c1             	setne  %cl
+ 51d:	c1 ea 1f             	shr    $0x1f,%edx
+ 520:	84 d1                	test   %dl,%cl
+ 522:	74 44                	je     568 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 524:	f7 d8                	neg    %eax
+ 526:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 528:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 52f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 534:	89 c8                	mov    %ecx,%eax
+ 536:	ba 00 00 00 00       	mov    $0x0,%edx
+ 53b:	f7 f6                	div    %esi
+ 53d:	89 df                	mov    %ebx,%edi
+ 53f:	83 c3 01             	add    $0x1,%ebx
+ 542:	0f b6 92 80 09 00 00 	movzbl 0x980(%edx),%edx
+ 549:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 54d:	89 ca                	mov    %ecx,%edx
+ 54f:	89 c1                	mov    %eax,%ecx
+ 551:	39 f2                	cmp    %esi,%edx
+ 553:	73 df                	jae    534 <printint+0x2e>
+  if(neg)
+ 555:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 559:	74 31                	je     58c <printint+0x86>
+    buf[i++] = '-';
+ 55b:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 560:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 563:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 566:	eb 17                	jmp    57f <printint+0x79>
+    x = xx;
+ 568:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 56a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 571:	eb bc                	jmp    52f <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 573:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 578:	89 f0                	mov    %esi,%eax
+ 57a:	e8 6d ff ff ff       	call   4ec <putc>
+  while(--i >= 0)
+ 57f:	83 eb 01             	sub    $0x1,%ebx
+ 582:	79 ef                	jns    573 <printint+0x6d>
+}
+ 584:	83 c4 2c             	add    $0x2c,%esp
+ 587:	5b                   	pop    %ebx
+ 588:	5e                   	pop    %esi
+ 589:	5f                   	pop    %edi
+ 58a:	5d                   	pop    %ebp
+ 58b:	c3                   	ret
+ 58c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 58f:	eb ee                	jmp    57f <printint+0x79>
+
+00000591 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 591:	55                   	push   %ebp
+ 592:	89 e5                	mov    %esp,%ebp
+ 594:	57                   	push   %edi
+ 595:	56                   	push   %esi
+ 596:	53                   	push   %ebx
+ 597:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 59a:	8d 45 10             	lea    0x10(%ebp),%eax
+ 59d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 5a0:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 5a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 5aa:	eb 14                	jmp    5c0 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 5ac:	89 fa                	mov    %edi,%edx
+ 5ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b1:	e8 36 ff ff ff       	call   4ec <putc>
+ 5b6:	eb 05                	jmp    5bd <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 5b8:	83 fe 25             	cmp    $0x25,%esi
+ 5bb:	74 25                	je     5e2 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 5bd:	83 c3 01             	add    $0x1,%ebx
+ 5c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5c3:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 5c7:	84 c0                	test   %al,%al
+ 5c9:	0f 84 20 01 00 00    	je     6ef <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 5cf:	0f be f8             	movsbl %al,%edi
+ 5d2:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 5d5:	85 f6                	test   %esi,%esi
+ 5d7:	75 df                	jne    5b8 <printf+0x27>
+      if(c == '%'){
+ 5d9:	83 f8 25             	cmp    $0x25,%eax
+ 5dc:	75 ce                	jne    5ac <printf+0x1b>
+        state = '%';
+ 5de:	89 c6                	mov    %eax,%esi
+ 5e0:	eb db                	jmp    5bd <printf+0x2c>
+      if(c == 'd'){
+ 5e2:	83 f8 25             	cmp    $0x25,%eax
+ 5e5:	0f 84 cf 00 00 00    	je     6ba <printf+0x129>
+ 5eb:	0f 8c dd 00 00 00    	jl     6ce <printf+0x13d>
+ 5f1:	83 f8 78             	cmp    $0x78,%eax
+ 5f4:	0f 8f d4 00 00 00    	jg     6ce <printf+0x13d>
+ 5fa:	83 f8 63             	cmp    $0x63,%eax
+ 5fd:	0f 8c cb 00 00 00    	jl     6ce <printf+0x13d>
+ 603:	83 e8 63             	sub    $0x63,%eax
+ 606:	83 f8 15             	cmp    $0x15,%eax
+ 609:	0f 87 bf 00 00 00    	ja     6ce <printf+0x13d>
+ 60f:	ff 24 85 28 09 00 00 	jmp    *0x928(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 616:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 619:	8b 17                	mov    (%edi),%edx
+ 61b:	83 ec 0c             	sub    $0xc,%esp
+ 61e:	6a 01                	push   $0x1
+ 620:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 625:	8b 45 08             	mov    0x8(%ebp),%eax
+ 628:	e8 d9 fe ff ff       	call   506 <printint>
+        ap++;
+ 62d:	83 c7 04             	add    $0x4,%edi
+ 630:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 633:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 636:	be 00 00 00 00       	mov    $0x0,%esi
+ 63b:	eb 80                	jmp    5bd <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 63d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 640:	8b 17                	mov    (%edi),%edx
+ 642:	83 ec 0c             	sub    $0xc,%esp
+ 645:	6a 00                	push   $0x0
+ 647:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 64c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64f:	e8 b2 fe ff ff       	call   506 <printint>
+        ap++;
+ 654:	83 c7 04             	add    $0x4,%edi
+ 657:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 65a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 65d:	be 00 00 00 00       	mov    $0x0,%esi
+ 662:	e9 56 ff ff ff       	jmp    5bd <printf+0x2c>
+        s = (char*)*ap;
+ 667:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 66a:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 66c:	83 c0 04             	add    $0x4,%eax
+ 66f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 672:	85 f6                	test   %esi,%esi
+ 674:	75 15                	jne    68b <printf+0xfa>
+          s = "(null)";
+ 676:	be 1f 09 00 00       	mov    $0x91f,%esi
+ 67b:	eb 0e                	jmp    68b <printf+0xfa>
+          putc(fd, *s);
+ 67d:	0f be d2             	movsbl %dl,%edx
+ 680:	8b 45 08             	mov    0x8(%ebp),%eax
+ 683:	e8 64 fe ff ff       	call   4ec <putc>
+          s++;
+ 688:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 68b:	0f b6 16             	movzbl (%esi),%edx
+ 68e:	84 d2                	test   %dl,%dl
+ 690:	75 eb                	jne    67d <printf+0xec>
+      state = 0;
+ 692:	be 00 00 00 00       	mov    $0x0,%esi
+ 697:	e9 21 ff ff ff       	jmp    5bd <printf+0x2c>
+        putc(fd, *ap);
+ 69c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 69f:	0f be 17             	movsbl (%edi),%edx
+ 6a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a5:	e8 42 fe ff ff       	call   4ec <putc>
+        ap++;
+ 6aa:	83 c7 04             	add    $0x4,%edi
+ 6ad:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 6b0:	be 00 00 00 00       	mov    $0x0,%esi
+ 6b5:	e9 03 ff ff ff       	jmp    5bd <printf+0x2c>
+        putc(fd, c);
+ 6ba:	89 fa                	mov    %edi,%edx
+ 6bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6bf:	e8 28 fe ff ff       	call   4ec <putc>
+      state = 0;
+ 6c4:	be 00 00 00 00       	mov    $0x0,%esi
+ 6c9:	e9 ef fe ff ff       	jmp    5bd <printf+0x2c>
+        putc(fd, '%');
+ 6ce:	ba 25 00 00 00       	mov    $0x25,%edx
+ 6d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d6:	e8 11 fe ff ff       	call   4ec <putc>
+        putc(fd, c);
+ 6db:	89 fa                	mov    %edi,%edx
+ 6dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e0:	e8 07 fe ff ff       	call   4ec <putc>
+      state = 0;
+ 6e5:	be 00 00 00 00       	mov    $0x0,%esi
+ 6ea:	e9 ce fe ff ff       	jmp    5bd <printf+0x2c>
+    }
+  }
+}
+ 6ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6f2:	5b                   	pop    %ebx
+ 6f3:	5e                   	pop    %esi
+ 6f4:	5f                   	pop    %edi
+ 6f5:	5d                   	pop    %ebp
+ 6f6:	c3                   	ret
+
+000006f7 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6f7:	55                   	push   %ebp
+ 6f8:	89 e5                	mov    %esp,%ebp
+ 6fa:	57                   	push   %edi
+ 6fb:	56                   	push   %esi
+ 6fc:	53                   	push   %ebx
+ 6fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 700:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 703:	a1 a8 0c 00 00       	mov    0xca8,%eax
+ 708:	eb 02                	jmp    70c <free+0x15>
+ 70a:	89 d0                	mov    %edx,%eax
+ 70c:	39 c8                	cmp    %ecx,%eax
+ 70e:	73 04                	jae    714 <free+0x1d>
+ 710:	3b 08                	cmp    (%eax),%ecx
+ 712:	72 12                	jb     726 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 714:	8b 10                	mov    (%eax),%edx
+ 716:	39 d0                	cmp    %edx,%eax
+ 718:	72 f0                	jb     70a <free+0x13>
+ 71a:	39 c8                	cmp    %ecx,%eax
+ 71c:	72 08                	jb     726 <free+0x2f>
+ 71e:	39 d1                	cmp    %edx,%ecx
+ 720:	72 04                	jb     726 <free+0x2f>
+ 722:	89 d0                	mov    %edx,%eax
+ 724:	eb e6                	jmp    70c <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 726:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 729:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 72c:	8b 10                	mov    (%eax),%edx
+ 72e:	39 d7                	cmp    %edx,%edi
+ 730:	74 19                	je     74b <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 732:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 735:	8b 50 04             	mov    0x4(%eax),%edx
+ 738:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 73b:	39 ce                	cmp    %ecx,%esi
+ 73d:	74 1b                	je     75a <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 73f:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 741:	a3 a8 0c 00 00       	mov    %eax,0xca8
+}
+ 746:	5b                   	pop    %ebx
+ 747:	5e                   	pop    %esi
+ 748:	5f                   	pop    %edi
+ 749:	5d                   	pop    %ebp
+ 74a:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 74b:	03 72 04             	add    0x4(%edx),%esi
+ 74e:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 751:	8b 10                	mov    (%eax),%edx
+ 753:	8b 12                	mov    (%edx),%edx
+ 755:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 758:	eb db                	jmp    735 <free+0x3e>
+    p->s.size += bp->s.size;
+ 75a:	03 53 fc             	add    -0x4(%ebx),%edx
+ 75d:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 760:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 763:	89 10                	mov    %edx,(%eax)
+ 765:	eb da                	jmp    741 <free+0x4a>
+
+00000767 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 767:	55                   	push   %ebp
+ 768:	89 e5                	mov    %esp,%ebp
+ 76a:	53                   	push   %ebx
+ 76b:	83 ec 04             	sub    $0x4,%esp
+ 76e:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 770:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 775:	77 05                	ja     77c <morecore+0x15>
+    nu = 4096;
+ 777:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 77c:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	50                   	push   %eax
+ 787:	e8 e8 fc ff ff       	call   474 <sbrk>
+  if(p == (char*)-1)
+ 78c:	83 c4 10             	add    $0x10,%esp
+ 78f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 792:	74 1c                	je     7b0 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 794:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 797:	83 c0 08             	add    $0x8,%eax
+ 79a:	83 ec 0c             	sub    $0xc,%esp
+ 79d:	50                   	push   %eax
+ 79e:	e8 54 ff ff ff       	call   6f7 <free>
+  return freep;
+ 7a3:	a1 a8 0c 00 00       	mov    0xca8,%eax
+ 7a8:	83 c4 10             	add    $0x10,%esp
+}
+ 7ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7ae:	c9                   	leave
+ 7af:	c3                   	ret
+    return 0;
+ 7b0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7b5:	eb f4                	jmp    7ab <morecore+0x44>
+
+000007b7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7b7:	55                   	push   %ebp
+ 7b8:	89 e5                	mov    %esp,%ebp
+ 7ba:	53                   	push   %ebx
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c1:	8d 58 07             	lea    0x7(%eax),%ebx
+ 7c4:	c1 eb 03             	shr    $0x3,%ebx
+ 7c7:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 7ca:	8b 0d a8 0c 00 00    	mov    0xca8,%ecx
+ 7d0:	85 c9                	test   %ecx,%ecx
+ 7d2:	74 04                	je     7d8 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7d4:	8b 01                	mov    (%ecx),%eax
+ 7d6:	eb 4a                	jmp    822 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 7d8:	c7 05 a8 0c 00 00 ac 	movl   $0xcac,0xca8
+ 7df:	0c 00 00 
+ 7e2:	c7 05 ac 0c 00 00 ac 	movl   $0xcac,0xcac
+ 7e9:	0c 00 00 
+    base.s.size = 0;
+ 7ec:	c7 05 b0 0c 00 00 00 	movl   $0x0,0xcb0
+ 7f3:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 7f6:	b9 ac 0c 00 00       	mov    $0xcac,%ecx
+ 7fb:	eb d7                	jmp    7d4 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 7fd:	74 19                	je     818 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7ff:	29 da                	sub    %ebx,%edx
+ 801:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 804:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 807:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 80a:	89 0d a8 0c 00 00    	mov    %ecx,0xca8
+      return (void*)(p + 1);
+ 810:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 813:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 816:	c9                   	leave
+ 817:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 818:	8b 10                	mov    (%eax),%edx
+ 81a:	89 11                	mov    %edx,(%ecx)
+ 81c:	eb ec                	jmp    80a <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 81e:	89 c1                	mov    %eax,%ecx
+ 820:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 822:	8b 50 04             	mov    0x4(%eax),%edx
+ 825:	39 da                	cmp    %ebx,%edx
+ 827:	73 d4                	jae    7fd <malloc+0x46>
+    if(p == freep)
+ 829:	39 05 a8 0c 00 00    	cmp    %eax,0xca8
+ 82f:	75 ed                	jne    81e <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 831:	89 d8                	mov    %ebx,%eax
+ 833:	e8 2f ff ff ff       	call   767 <morecore>
+ 838:	85 c0                	test   %eax,%eax
+ 83a:	75 e2                	jne    81e <malloc+0x67>
+ 83c:	eb d5                	jmp    813 <malloc+0x5c>
@@ -1,17 +1,22 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC        64  // initial size of process table
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
-#define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NOFILE       16  // open files per process before its table grows
+#define NFILE       100  // initial size of file table
+#define NINODE       50  // initial size of i-node cache
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define NSEG          4  // max demand-loaded ELF segments per process
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define NBUF         (MAXOPBLOCKS*3)  // minimum size of disk block cache
+#define NREADAHEAD   32  // max blocks read ahead at once
 #ifdef PDX_XV6
-#define FSSIZE       2000  // size of file system in blocks
+#define FSSIZE       4096  // size of file system in blocks
 #else
-#define FSSIZE       1000  // size of file system in blocks
+#define FSSIZE       2048  // size of file system in blocks
 #endif // PDX_XV6
+#define MEMFSSIZE     512  // kernelmemfs file system; kernel + image fit in 4MB
+#define NINODES      200  // number of inodes in file system
+#define PIPEMAX    65536  // max bytes a pipe can buffer, see pipesize()
@@ -0,0 +1,54 @@
+// PCI configuration space access, through configuration
+// mechanism #1 (I/O ports 0xCF8/0xCFC). Just enough for
+// drivers to find their device and its resources.
+//
+// A device function is named by a bdf: bus<<8 | device<<3 | function.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+#include "pci.h"
+
+#define CONFIG_ADDRESS  0xCF8
+#define CONFIG_DATA     0xCFC
+
+uint
+pciread(uint bdf, int off)
+{
+  outl(CONFIG_ADDRESS, 0x80000000 | bdf<<8 | (off & 0xFC));
+  return inl(CONFIG_DATA);
+}
+
+void
+pciwrite(uint bdf, int off, uint val)
+{
+  outl(CONFIG_ADDRESS, 0x80000000 | bdf<<8 | (off & 0xFC));
+  outl(CONFIG_DATA, val);
+}
+
+// Find the first device function whose config register off,
+// masked with mask, equals val. Returns 0 and sets *bdf if
+// found, -1 if not.
+int
+pcifind(int off, uint mask, uint val, uint *bdf)
+{
+  uint bus, dev, func, nfunc, b;
+
+  for(bus = 0; bus < 256; bus++){
+    for(dev = 0; dev < 32; dev++){
+      nfunc = 1;
+      for(func = 0; func < nfunc; func++){
+        b = bus<<8 | dev<<3 | func;
+        if((pciread(b, PCI_ID) & 0xFFFF) == 0xFFFF)
+          continue;  // no such function
+        if(func == 0 && (pciread(b, PCI_HEADER) & 0x800000))
+          nfunc = 8;  // multi-function device
+        if((pciread(b, off) & mask) == val){
+          *bdf = b;
+          return 0;
+        }
+      }
+    }
+  }
+  return -1;
+}
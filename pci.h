@@ -0,0 +1,15 @@
+// PCI configuration space registers.
+
+#define PCI_ID        0x00  // vendor id (low 16 bits), device id (high)
+#define PCI_COMMAND   0x04  // command (low 16 bits), status (high)
+#define PCI_CLASS     0x08  // revision, prog-if, subclass, class (high byte)
+#define PCI_HEADER    0x0C  // header type in bits 16-23
+#define PCI_BAR0      0x10  // base address registers 0-5
+#define PCI_INTR      0x3C  // interrupt line (low 8 bits)
+
+#define PCI_CMD_IO      0x1  // respond to I/O space accesses
+#define PCI_CMD_MEM     0x2  // respond to memory space accesses
+#define PCI_CMD_MASTER  0x4  // may act as bus master (DMA)
+
+#define PCI_BAR(n)    (PCI_BAR0 + 4*(n))
+#define PCI_BAR_IO    0x1    // BAR is in I/O space
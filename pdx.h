@@ -19,7 +19,7 @@
 #define TPS 1000   // ticks-per-second
 #define SCHED_INTERVAL (TPS/100)  // see trap.c
 
-#define NPROC  64  // maximum number of processes -- normally in param.h
+#define NPROC  64  // initial size of process table -- normally in param.h
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 #define max(a, b) ((a) > (b) ? (a) : (b))
@@ -8,17 +8,45 @@
 #include "sleeplock.h"
 #include "file.h"
 
-#define PIPESIZE 512
+// A pipe's ring buffer starts as the rest of the page holding
+// struct pipe; piperesize() can move it to up to PIPEMAX bytes
+// of pages of its own. Either way it is npg pieces of pgsize
+// bytes, and data is copied in runs contiguous in a piece.
+#define PIPEMAXPG (PIPEMAX/PGSIZE)
 
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
+  char *pg[PIPEMAXPG];
+  int npg;
+  uint pgsize;
+  uint size;      // npg*pgsize
+  uint rpos;      // ring index of the next byte to read
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
 };
 
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+// Copy n bytes between addr and the ring, starting at ring
+// index i: into the ring if in is set, else out of it.
+static void
+pipecopy(struct pipe *p, uint i, char *addr, uint n, int in)
+{
+  uint m;
+  char *b;
+
+  for(; n > 0; n -= m, addr += m, i = (i + m) % p->size){
+    b = p->pg[i / p->pgsize] + i % p->pgsize;
+    m = min(n, p->pgsize - i % p->pgsize);
+    if(in)
+      memmove(b, addr, m);
+    else
+      memmove(addr, b, m);
+  }
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
@@ -32,6 +60,11 @@ pipealloc(struct file **f0, struct file **f1)
     goto bad;
   p->readopen = 1;
   p->writeopen = 1;
+  p->pg[0] = (char*)(p + 1);
+  p->npg = 1;
+  p->pgsize = PGSIZE - sizeof(*p);
+  p->size = p->pgsize;
+  p->rpos = 0;
   p->nwrite = 0;
   p->nread = 0;
   initlock(&p->lock, "pipe");
@@ -56,6 +89,16 @@ pipealloc(struct file **f0, struct file **f1)
   return -1;
 }
 
+static void
+pipefreepg(struct pipe *p)
+{
+  int i;
+
+  if(p->pg[0] != (char*)(p + 1))
+    for(i = 0; i < p->npg; i++)
+      kfree(p->pg[i]);
+}
+
 void
 pipeclose(struct pipe *p, int writable)
 {
@@ -69,20 +112,50 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
+    pipefreepg(p);
     kfree((char*)p);
   } else
     release(&p->lock);
 }
 
+// Move up to n bytes from addr into p's ring, as many as fit.
+// Caller must hold p->lock.
+static int
+pipein(struct pipe *p, char *addr, int n)
+{
+  int m;
+
+  m = min(n, p->size - (p->nwrite - p->nread));
+  pipecopy(p, (p->rpos + p->nwrite - p->nread) % p->size, addr, m, 1);
+  p->nwrite += m;
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  return m;
+}
+
+// Move up to n buffered bytes out of p's ring into addr.
+// Caller must hold p->lock.
+static int
+pipeout(struct pipe *p, char *addr, int n)
+{
+  int m;
+
+  m = min(n, p->nwrite - p->nread);  //DOC: piperead-copy
+  pipecopy(p, p->rpos, addr, m, 0);
+  p->rpos = (p->rpos + m) % p->size;
+  p->nread += m;
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  return m;
+}
+
 //PAGEBREAK: 40
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, m;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+  for(i = 0; i < n; i += m){
+    while(p->nwrite == p->nread + p->size){  //DOC: pipewrite-full
       if(p->readopen == 0 || myproc()->killed){
         release(&p->lock);
         return -1;
@@ -90,9 +163,8 @@ pipewrite(struct pipe *p, char *addr, int n)
       wakeup(&p->nread);
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    m = pipein(p, addr + i, n - i);
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
   return n;
 }
@@ -100,7 +172,7 @@ pipewrite(struct pipe *p, char *addr, int n)
 int
 piperead(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int m;
 
   acquire(&p->lock);
   while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
@@ -110,12 +182,141 @@ piperead(struct pipe *p, char *addr, int n)
     }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
+  m = pipeout(p, addr, n);
+  release(&p->lock);
+  return m;
+}
+
+// For splicing: pipewait sleeps until p has bytes to read or,
+// if wr is set, room to write, and returns how many. It returns
+// 0 for a reader at end of file, and -1 if the process is
+// killed or, for a writer, the read end is closed. pipeput,
+// pipeget and pipemove then move what they can without sleeping,
+// so callers can hold other locks.
+
+int
+pipewait(struct pipe *p, int wr)
+{
+  int n;
+
+  acquire(&p->lock);
+  for(;;){
+    if(myproc()->killed || (wr && p->readopen == 0)){
+      n = -1;
       break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+    }
+    n = wr ? p->size - (p->nwrite - p->nread) : p->nwrite - p->nread;
+    if(n > 0 || (!wr && p->writeopen == 0))
+      break;
+    sleep(wr ? &p->nwrite : &p->nread, &p->lock);
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
-  return i;
+  return n;
+}
+
+// Write up to n bytes from addr to p. Returns the number
+// written, or -1 if the read end is closed.
+int
+pipeput(struct pipe *p, char *addr, int n)
+{
+  int m;
+
+  acquire(&p->lock);
+  m = p->readopen ? pipein(p, addr, n) : -1;
+  release(&p->lock);
+  return m;
+}
+
+// Read up to n bytes from p to addr. Returns the number read.
+int
+pipeget(struct pipe *p, char *addr, int n)
+{
+  int m;
+
+  acquire(&p->lock);
+  m = pipeout(p, addr, n);
+  release(&p->lock);
+  return m;
+}
+
+// Move up to n bytes from pipe in to pipe out, ring to ring.
+// Returns the number moved, or -1 if out's read end is closed.
+int
+pipemove(struct pipe *in, struct pipe *out, int n)
+{
+  int m, tot;
+  uint k;
+
+  if(in == out)
+    return -1;
+  // Lock in address order.
+  acquire(in < out ? &in->lock : &out->lock);
+  acquire(in < out ? &out->lock : &in->lock);
+  if(out->readopen == 0){
+    tot = -1;
+  } else {
+    n = min(n, in->nwrite - in->nread);
+    for(tot = 0; tot < n; tot += m){
+      k = in->rpos;
+      m = min(n - tot, in->pgsize - k % in->pgsize);
+      if((m = pipein(out, in->pg[k / in->pgsize] + k % in->pgsize, m)) == 0)
+        break;
+      in->rpos = (in->rpos + m) % in->size;
+      in->nread += m;
+    }
+    if(tot > 0)
+      wakeup(&in->nwrite);
+  }
+  release(&in->lock);
+  release(&out->lock);
+  return tot;
+}
+
+// Grow p's ring buffer to hold at least n bytes, in pages.
+// Returns the new size, or -1 if n is over PIPEMAX or memory
+// is short. The buffer never shrinks.
+int
+piperesize(struct pipe *p, int n)
+{
+  char *pg[PIPEMAXPG];
+  int npg, i;
+  uint j, k, m, cnt;
+
+  if(n < 0 || n > PIPEMAX)
+    return -1;
+  npg = (n + PGSIZE - 1) / PGSIZE;
+  if(npg * PGSIZE <= p->size)
+    return p->size;
+  for(i = 0; i < npg; i++){
+    if((pg[i] = kalloc()) == 0){
+      while(--i >= 0)
+        kfree(pg[i]);
+      return -1;
+    }
+  }
+
+  acquire(&p->lock);
+  if(npg * PGSIZE <= p->size){  // someone else grew it
+    release(&p->lock);
+    for(i = 0; i < npg; i++)
+      kfree(pg[i]);
+    return p->size;
+  }
+  // Move the buffered bytes to the start of the new ring.
+  cnt = p->nwrite - p->nread;
+  for(j = 0; j < cnt; j += m){
+    k = (p->rpos + j) % p->size;
+    m = min(cnt - j, p->pgsize - k % p->pgsize);
+    m = min(m, PGSIZE - j % PGSIZE);
+    memmove(pg[j / PGSIZE] + j % PGSIZE, p->pg[k / p->pgsize] + k % p->pgsize, m);
+  }
+  pipefreepg(p);
+  memmove(p->pg, pg, sizeof(pg));
+  p->npg = npg;
+  p->pgsize = PGSIZE;
+  p->size = npg * PGSIZE;
+  p->rpos = 0;
+  wakeup(&p->nwrite);
+  release(&p->lock);
+  return p->size;
 }
@@ -25,20 +25,59 @@ struct ptrs {
 };
 
 #define statecount NELEM(states)
+
+// Sleeping processes are kept on hash chains keyed by wait channel
+// rather than on one SLEEPING list, so wakeup() only looks at the
+// processes waiting on that channel.
+#define NSLEEPQ 61
 #endif //CS333_P3
 
+// Timer wheel for sleepticks(). A sleeper waits in the slot for its
+// deadline tick; a slot also holds deadlines more than NTIMERSLOT
+// ticks away, which stay put until their own revolution comes round.
+#define NTIMERSLOT 256
+
+// Live pids are hashed so lookups by pid don't walk the state lists.
+#define NPIDHASH 64
+
+// The table starts with the NPROC procs in proc[] and grows by
+// a page of procs at a time when none is unused. All of them,
+// wherever they live, are chained through allnext from all.
 static struct {
   struct spinlock lock;
   struct proc proc[NPROC];
+  struct proc *all;
+  struct proc *timer[NTIMERSLOT];
+  struct proc *pidhash[NPIDHASH];
 #ifdef CS333_P3
   struct ptrs list[statecount];
+  struct ptrs sleepq[NSLEEPQ];
 #endif //CS333_P3
 #ifdef CS333_P4
-  struct ptrs ready[MAXPRIO+1];
   uint PromoteAtTime;
 #endif //CS333_P4
 } ptable;
 
+#ifdef CS333_P4
+// Per-CPU run queues. Each CPU schedules from its own set of
+// priority lists and an idle CPU steals from the busiest peer.
+// A queue's lists and count only change with both ptable.lock
+// (every state transition holds it) and the queue's own lock
+// held, so either lock is enough to read them.
+// Lock order: ptable.lock, then a runq lock.
+// The scheduler polls its own queue under just its runq lock,
+// and peers' counts with no lock at all, so an idle CPU takes
+// neither ptable.lock nor anyone else's lock until there is
+// work to dispatch.
+struct runq {
+  struct spinlock lock;
+  struct ptrs ready[MAXPRIO+1];
+  int count;                    // processes on all ready lists
+} __attribute__ ((aligned (64)));
+
+static struct runq runq[NCPU];
+#endif //CS333_P4
+
 // list management function prototypes
 #ifdef CS333_P3
 static void initProcessLists(void);
@@ -46,70 +85,67 @@ static void initFreeList(void);
 static void stateListAdd(struct ptrs*, struct proc*);
 static int  stateListRemove(struct ptrs*, struct proc* p);
 static void assertState(struct proc *p, enum procstate state, const char * func, int line);
+static struct ptrs* sleepList(void*);
+#ifdef CS333_P4
+static void runqAdd(int, struct proc*);
+static void runqRemove(struct proc*);
+static struct proc* runqHead(struct runq*);
+static int  runqPick(int);
+#endif //CS333_P4
 
 // list management helper functions
+//
+// The state lists are intrusive and doubly linked. Each proc records
+// the list it is on, so removal is O(1) and can check membership
+// without walking the list.
 static void
 stateListAdd(struct ptrs* list, struct proc* p)
 {
-  if((*list).head == NULL){
+  if(p->list != NULL)
+    panic("stateListAdd: proc already on a list");
+
+  p->next = NULL;
+  p->prev = (*list).tail;
+  if((*list).head == NULL)
     (*list).head = p;
-    (*list).tail = p;
-    p->next = NULL;
-  } else{
+  else
     ((*list).tail)->next = p;
-    (*list).tail = ((*list).tail)->next;
-    ((*list).tail)->next = NULL;
-  }
+  (*list).tail = p;
+  p->list = list;
 }
 
 static int
 stateListRemove(struct ptrs* list, struct proc* p)
 {
-  if((*list).head == NULL || (*list).tail == NULL || p == NULL){
+  if(p == NULL || p->list != list){
     return -1;
   }
 
-  struct proc* current = (*list).head;
-  struct proc* previous = 0;
-
-  if(current == p){
-    (*list).head = ((*list).head)->next;
-    // prevent tail remaining assigned when we've removed the only item
-    // on the list
-    if((*list).tail == p){
-      (*list).tail = NULL;
-    }
-    return 0;
-  }
-
-  while(current){
-    if(current == p){
-      break;
-    }
-
-    previous = current;
-    current = current->next;
-  }
-
-  // Process not found. return error
-  if(current == NULL){
-    return -1;
-  }
+  if(p->prev)
+    p->prev->next = p->next;
+  else
+    (*list).head = p->next;
 
-  // Process found.
-  if(current == (*list).tail){
-    (*list).tail = previous;
-    ((*list).tail)->next = NULL;
-  } else{
-    previous->next = current->next;
-  }
+  if(p->next)
+    p->next->prev = p->prev;
+  else
+    (*list).tail = p->prev;
 
-  // Make sure p->next doesn't point into the list.
+  // Make sure p doesn't point into the list.
   p->next = NULL;
+  p->prev = NULL;
+  p->list = NULL;
 
   return 0;
 }
 
+// The hash chain holding processes asleep on chan.
+static struct ptrs*
+sleepList(void *chan)
+{
+  return &ptable.sleepq[((uint)chan >> 2) % NSLEEPQ];
+}
+
 static void
 initProcessLists()
 {
@@ -119,10 +155,19 @@ initProcessLists()
     ptable.list[i].head = NULL;
     ptable.list[i].tail = NULL;
   }
+  for (i = 0; i < NSLEEPQ; i++) {
+    ptable.sleepq[i].head = NULL;
+    ptable.sleepq[i].tail = NULL;
+  }
 #ifdef CS333_P4
-  for (i = 0; i <= MAXPRIO; i++) {
-    ptable.ready[i].head = NULL;
-    ptable.ready[i].tail = NULL;
+  struct runq *q;
+
+  for (q = runq; q < &runq[NCPU]; q++) {
+    for (i = 0; i <= MAXPRIO; i++) {
+      q->ready[i].head = NULL;
+      q->ready[i].tail = NULL;
+    }
+    q->count = 0;
   }
 #endif
 }
@@ -132,8 +177,9 @@ initFreeList(void)
 {
   struct proc* p;
 
-  for(p = ptable.proc; p < ptable.proc + NPROC; ++p){
+  for(p = ptable.all; p; p = p->allnext){
     p->state = UNUSED;
+    p->list = NULL;
     stateListAdd(&ptable.list[UNUSED], p);
   }
 }
@@ -152,6 +198,78 @@ assertState(struct proc *p, enum procstate state, const char * func, int line)
     panic("Error: Process state incorrect in assertState()");
 }
 
+#ifdef CS333_P4
+// Queue p on the ready list for its priority in run queue rq.
+// Caller must hold ptable.lock.
+static void
+runqAdd(int rq, struct proc* p)
+{
+  struct runq *q = &runq[rq];
+
+  acquire(&q->lock);
+  stateListAdd(&q->ready[p->priority], p);
+  q->count++;
+  p->rq = rq;
+  release(&q->lock);
+}
+
+// Take p off the ready list it is queued on.
+// Caller must hold ptable.lock.
+static void
+runqRemove(struct proc* p)
+{
+  struct runq *q = &runq[p->rq];
+
+  acquire(&q->lock);
+  if(stateListRemove(&q->ready[p->priority], p) < 0)
+    panic("Process could not be removed from the RUNNABLE list");
+  q->count--;
+  release(&q->lock);
+}
+
+// Highest priority process waiting on q, or NULL.
+// Caller must hold ptable.lock.
+static struct proc*
+runqHead(struct runq* q)
+{
+  int i;
+
+  for(i = MAXPRIO; i >= 0; --i)
+    if(q->ready[i].head != NULL)
+      return q->ready[i].head;
+  return NULL;
+}
+
+// Pick the run queue CPU self should take work from: its own
+// if anything is queued there, otherwise the busiest peer.
+// Returns -1 if every queue is empty. Only our own queue is
+// locked, so for peers the answer is a hint; the caller looks
+// again under ptable.lock.
+static int
+runqPick(int self)
+{
+  int i, n, best, most;
+
+  acquire(&runq[self].lock);
+  n = runq[self].count;
+  release(&runq[self].lock);
+  if(n > 0)
+    return self;
+
+  best = -1;
+  most = 0;
+  for(i = 0; i < ncpu; i++){
+    if(i == self)
+      continue;
+    n = *(volatile int*)&runq[i].count;
+    if(n > most){
+      most = n;
+      best = i;
+    }
+  }
+  return best;
+}
+#endif //CS333_P4
 #endif
 static struct proc *initproc;
 
@@ -160,10 +278,65 @@ extern void forkret(void);
 extern void trapret(void);
 static void wakeup1(void* chan);
 
+// Give p the next pid and enter it in the pid hash.
+// Caller must hold ptable.lock.
+static void
+allocpid(struct proc *p)
+{
+  struct proc **h;
+
+  p->pid = nextpid++;
+  h = &ptable.pidhash[p->pid % NPIDHASH];
+  p->pidnext = *h;
+  *h = p;
+}
+
+// Drop p from the pid hash and clear its pid.
+// Caller must hold ptable.lock.
+static void
+freepid(struct proc *p)
+{
+  struct proc **h;
+
+  for(h = &ptable.pidhash[p->pid % NPIDHASH]; *h; h = &(*h)->pidnext){
+    if(*h == p){
+      *h = p->pidnext;
+      break;
+    }
+  }
+  p->pidnext = 0;
+  p->pid = 0;
+}
+
+// The process with the given pid, or NULL if it has been reaped.
+// Caller must hold ptable.lock.
+static struct proc*
+pidlookup(int pid)
+{
+  struct proc *p;
+
+  for(p = ptable.pidhash[(uint)pid % NPIDHASH]; p; p = p->pidnext)
+    if(p->pid == pid)
+      return p;
+  return NULL;
+}
+
 void
 pinit(void)
 {
+  struct proc *p;
+
   initlock(&ptable.lock, "ptable");
+  for(p = &ptable.proc[NPROC-1]; p >= ptable.proc; p--){
+    p->allnext = ptable.all;
+    ptable.all = p;
+  }
+#ifdef CS333_P4
+  struct runq *q;
+
+  for(q = runq; q < &runq[NCPU]; q++)
+    initlock(&q->lock, "runq");
+#endif //CS333_P4
 }
 
 // Must be called with interrupts disabled
@@ -206,6 +379,56 @@ myproc(void) {
   return p;
 }
 
+// Add a page of UNUSED procs to the process table.
+// Caller must hold ptable.lock. Returns 0 if out of memory.
+static int
+procgrow(void)
+{
+  struct proc *p, *np;
+
+  if((np = (struct proc*)kalloc()) == 0)
+    return 0;
+  memset(np, 0, PGSIZE);
+  for(p = np; p < np + PGSIZE/sizeof(*p); p++){
+    p->state = UNUSED;
+    p->allnext = ptable.all;
+    ptable.all = p;
+#ifdef CS333_P3
+    stateListAdd(&ptable.list[UNUSED], p);
+#endif //CS333_P3
+  }
+  return 1;
+}
+
+// Move p's open files from ofile0 to a page of their own,
+// which has room for PGSIZE/sizeof(struct file*) of them.
+// Returns -1 if p already has one or memory is short.
+int
+ofilegrow(struct proc *p)
+{
+  struct file **f;
+
+  if(p->ofile != p->ofile0 || (f = (struct file**)kalloc()) == 0)
+    return -1;
+  memset(f, 0, PGSIZE);
+  memmove(f, p->ofile0, sizeof(p->ofile0));
+  memset(p->ofile0, 0, sizeof(p->ofile0));
+  p->ofile = f;
+  p->nofile = PGSIZE/sizeof(*f);
+  return 0;
+}
+
+// Return p to its built-in open file table, which must be
+// empty, freeing any page it grew.
+static void
+ofilefree(struct proc *p)
+{
+  if(p->ofile != p->ofile0)
+    kfree((char*)p->ofile);
+  p->ofile = p->ofile0;
+  p->nofile = NOFILE;
+}
+
 //PAGEBREAK: 32
 // Look in the process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize
@@ -219,7 +442,8 @@ allocproc(void)
   char *sp;
 
   acquire(&ptable.lock);
-  	
+  if(ptable.list[UNUSED].head == NULL)
+    procgrow();
   if(ptable.list[UNUSED].head != NULL){
     p = ptable.list[UNUSED].head;
     if(stateListRemove(&ptable.list[p->state], p) < 0){
@@ -240,12 +464,13 @@ allocproc(void)
  
 
 
-  p->pid = nextpid++;
+  allocpid(p);
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
     acquire(&ptable.lock);
+    freepid(p);
     if(stateListRemove(&ptable.list[p->state], p) < 0){
       panic("Process could not be removed from EMBRYO list");
     }
@@ -253,7 +478,7 @@ allocproc(void)
     p->state = UNUSED;
     stateListAdd(&ptable.list[p->state], p);
     release(&ptable.lock);
-   
+    return 0;
   }
   sp = p->kstack + KSTACKSIZE;
 
@@ -270,6 +495,8 @@ allocproc(void)
   p->context = (struct context*)sp;
   memset(p->context, 0, sizeof *p->context);
   p->context->eip = (uint)forkret;
+  p->ofile = p->ofile0;
+  p->nofile = NOFILE;
 #ifdef CS333_P1
   p->start_ticks = ticks;
 #endif //CS333_P1
@@ -288,22 +515,29 @@ allocproc(void)
 
   acquire(&ptable.lock);
   int found = 0;
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.all; p; p = p->allnext)
     if(p->state == UNUSED) {
       found = 1;
       break;
     }
+  if (!found && procgrow()) {
+    p = ptable.all;
+    found = 1;
+  }
   if (!found) {
     release(&ptable.lock);
     return 0;
   }
   p->state = EMBRYO;
-  p->pid = nextpid++;
+  allocpid(p);
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
+    acquire(&ptable.lock);
+    freepid(p);
     p->state = UNUSED;
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -321,6 +555,8 @@ allocproc(void)
   p->context = (struct context*)sp;
   memset(p->context, 0, sizeof *p->context);
   p->context->eip = (uint)forkret;
+  p->ofile = p->ofile0;
+  p->nofile = NOFILE;
 #ifdef CS333_P1
   p->start_ticks = ticks;
 #endif //CS333_P1
@@ -385,7 +621,7 @@ userinit(void)
   }
   assertState(p, EMBRYO, __FUNCTION__, __LINE__);
   p->state = RUNNABLE;
-  stateListAdd(&ptable.ready[p->priority],p);
+  runqAdd(cpuid(), p);
   release(&ptable.lock);
       
 
@@ -416,8 +652,11 @@ growproc(int n)
 
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Just reserve the range; pagefault() allocates each
+    // page the first time it is touched.
+    if(sz + n < sz || sz + n >= KERNBASE)
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
@@ -444,11 +683,14 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+  if((curproc->nofile > np->nofile && ofilegrow(np) < 0) ||
+     (np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+    ofilefree(np);
     kfree(np->kstack);
     np->kstack = 0;
 #ifdef CS333_P3
     acquire(&ptable.lock);
+    freepid(np);
     if(stateListRemove(&ptable.list[np->state],np) < 0){
       panic("Process could not be removed from EMBRYO list");
     }
@@ -457,7 +699,10 @@ fork(void)
     stateListAdd(&ptable.list[np->state], np);
     release(&ptable.lock);
 #else
+    acquire(&ptable.lock);
+    freepid(np);
     np->state = UNUSED;
+    release(&ptable.lock);
 #endif //CS333_P3
 
     return -1;
@@ -472,10 +717,17 @@ fork(void)
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
+  for(i = 0; i < curproc->nofile; i++)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  if(curproc->exe){
+    np->exe = idup(curproc->exe);
+    iexecref(np->exe, 1);
+  } else
+    np->exe = 0;
+  np->nseg = curproc->nseg;
+  memmove(np->seg, curproc->seg, sizeof(curproc->seg));
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -489,7 +741,7 @@ fork(void)
   assertState(np, EMBRYO, __FUNCTION__, __LINE__);
   np->state = RUNNABLE;
 
-  stateListAdd(&ptable.ready[np->priority],np);
+  runqAdd(cpuid(), np);
 
   release(&ptable.lock);
 #elif CS333_P3
@@ -528,17 +780,23 @@ exit(void)
     panic("init exiting");
 
   // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
+  for(fd = 0; fd < curproc->nofile; fd++){
     if(curproc->ofile[fd]){
       fileclose(curproc->ofile[fd]);
       curproc->ofile[fd] = 0;
     }
   }
+  ofilefree(curproc);
 
   begin_op();
   iput(curproc->cwd);
+  if(curproc->exe){
+    iexecref(curproc->exe, -1);
+    iput(curproc->exe);
+  }
   end_op();
   curproc->cwd = 0;
+  curproc->exe = 0;
 
   acquire(&ptable.lock);
 
@@ -552,17 +810,21 @@ exit(void)
       p->parent = initproc;
     }
   }
-  for(int i = MAXPRIO; i >= 0; --i){
-    for(p= ptable.ready[i].head; p!= NULL; p = p->next){
-      if(p->parent == curproc){
-        p->parent = initproc;
+  for(struct runq *q = runq; q < &runq[ncpu]; q++){
+    for(int i = MAXPRIO; i >= 0; --i){
+      for(p= q->ready[i].head; p!= NULL; p = p->next){
+        if(p->parent == curproc){
+          p->parent = initproc;
+        }
       }
     }
   }
 
-  for(p= ptable.list[SLEEPING].head; p!= NULL; p = p->next){
-    if(p->parent == curproc){
-      p->parent = initproc;
+  for(int i = 0; i < NSLEEPQ; i++){
+    for(p= ptable.sleepq[i].head; p!= NULL; p = p->next){
+      if(p->parent == curproc){
+        p->parent = initproc;
+      }
     }
   }
   for(p= ptable.list[EMBRYO].head; p!= NULL; p = p->next){
@@ -601,17 +863,23 @@ exit(void)
     panic("init exiting");
 
   // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
+  for(fd = 0; fd < curproc->nofile; fd++){
     if(curproc->ofile[fd]){
       fileclose(curproc->ofile[fd]);
       curproc->ofile[fd] = 0;
     }
   }
+  ofilefree(curproc);
 
   begin_op();
   iput(curproc->cwd);
+  if(curproc->exe){
+    iexecref(curproc->exe, -1);
+    iput(curproc->exe);
+  }
   end_op();
   curproc->cwd = 0;
+  curproc->exe = 0;
 
   acquire(&ptable.lock);
 
@@ -631,9 +899,11 @@ exit(void)
     }
   }
 
-  for(p= ptable.list[SLEEPING].head; p!= NULL; p = p->next){
-    if(p->parent == curproc){
-      p->parent = initproc;
+  for(int i = 0; i < NSLEEPQ; i++){
+    for(p= ptable.sleepq[i].head; p!= NULL; p = p->next){
+      if(p->parent == curproc){
+        p->parent = initproc;
+      }
     }
   }
   for(p= ptable.list[EMBRYO].head; p!= NULL; p = p->next){
@@ -672,17 +942,23 @@ exit(void)
     panic("init exiting");
 
   // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
+  for(fd = 0; fd < curproc->nofile; fd++){
     if(curproc->ofile[fd]){
       fileclose(curproc->ofile[fd]);
       curproc->ofile[fd] = 0;
     }
   }
+  ofilefree(curproc);
 
   begin_op();
   iput(curproc->cwd);
+  if(curproc->exe){
+    iexecref(curproc->exe, -1);
+    iput(curproc->exe);
+  }
   end_op();
   curproc->cwd = 0;
+  curproc->exe = 0;
 
   acquire(&ptable.lock);
 
@@ -690,7 +966,7 @@ exit(void)
   wakeup1(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.all; p; p = p->allnext){
     if(p->parent == curproc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
@@ -732,7 +1008,7 @@ wait(void)
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
-        p->pid = 0;
+        freepid(p);
         p->parent = 0;
         p->name[0] = 0;
         p->killed = 0;
@@ -747,20 +1023,24 @@ wait(void)
         return pid;
       }
     }
-    for(int i = MAXPRIO; i >= 0; --i){
-      for(p = ptable.ready[i].head; p != NULL; p = p->next){
+    for(struct runq *q = runq; q < &runq[ncpu]; q++){
+      for(int i = MAXPRIO; i >= 0; --i){
+        for(p = q->ready[i].head; p != NULL; p = p->next){
+          if(p->parent == curproc){
+            havekids = 1;
+	    break;
+          }
+        }
+      }
+    }
+    for(int i = 0; i < NSLEEPQ; i++){
+      for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
         if(p->parent == curproc){
           havekids = 1;
 	  break;
-        }	
+        }
       }
     }
-    for(p = ptable.list[SLEEPING].head; p != NULL; p = p->next){
-      if(p->parent == curproc){
-        havekids = 1;
-	break;
-      }	
-    }
     for(p = ptable.list[EMBRYO].head; p != NULL; p = p->next){
       if(p->parent == curproc){
         havekids = 1;
@@ -806,7 +1086,7 @@ wait(void)
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
-        p->pid = 0;
+        freepid(p);
         p->parent = 0;
         p->name[0] = 0;
         p->killed = 0;
@@ -827,11 +1107,13 @@ wait(void)
 	break;
       }	
     }
-    for(p = ptable.list[SLEEPING].head; p != NULL; p = p->next){
-      if(p->parent == curproc){
-        havekids = 1;
-	break;
-      }	
+    for(int i = 0; i < NSLEEPQ; i++){
+      for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
+        if(p->parent == curproc){
+          havekids = 1;
+	  break;
+        }
+      }
     }
     for(p = ptable.list[EMBRYO].head; p != NULL; p = p->next){
       if(p->parent == curproc){
@@ -868,7 +1150,7 @@ wait(void)
   for(;;){
     // Scan through table looking for exited children.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.all; p; p = p->allnext){
       if(p->parent != curproc)
         continue;
       havekids = 1;
@@ -878,7 +1160,7 @@ wait(void)
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
-        p->pid = 0;
+        freepid(p);
         p->parent = 0;
         p->name[0] = 0;
         p->killed = 0;
@@ -913,6 +1195,8 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  int self = c - cpus;
+  int rq;
   c->proc = 0;
 #ifdef PDX_XV6
   int idle;  // for checking if processor is idle
@@ -926,49 +1210,42 @@ scheduler(void)
     idle = 1;  // assume idle unless we schedule a process
 #endif // PDX_XV6
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(int i = MAXPRIO; i >= 0; --i){
-      if(ptable.ready[i].head != NULL){
-	p = ptable.ready[i].head; 
-
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
+    // Find a run queue with work, stealing from the busiest
+    // peer if our own is empty, before touching ptable.lock.
+    rq = runqPick(self);
+    if(rq >= 0 || (MAXPRIO > 0 && ticks >= ptable.PromoteAtTime)){
+      acquire(&ptable.lock);
+      if(rq >= 0 && (p = runqHead(&runq[rq])) != NULL){
+        // Switch to chosen process.  It is the process's job
+        // to release ptable.lock and then reacquire it
+        // before jumping back to us.
 #ifdef PDX_XV6
         idle = 0;  // not idle this timeslice
 #endif // PDX_XV6
 
-
-
         c->proc = p;
         switchuvm(p);
-	if(stateListRemove(&ptable.ready[p->priority],p) < 0){
-          panic("Process could not be removed from the RUNNABLE list");
-	}
-	assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+        runqRemove(p);
+        assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+        p->rq = self;  // a stolen process now belongs to this CPU
         p->state = RUNNING;
-	stateListAdd(&ptable.list[p->state],p);
+        stateListAdd(&ptable.list[p->state],p);
 #ifdef CS333_P2
         p->cpu_ticks_in = ticks;
 #endif //CS333_P2
         swtch(&(c->scheduler), p->context);
 
-
         switchkvm();
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
+        // Process is done running for now.
+        // It should have changed its p->state before coming back.
         c->proc = 0;
-	break;
       }
+      if(ticks >= ptable.PromoteAtTime && MAXPRIO > 0){
+        promote();
+        ptable.PromoteAtTime = ticks + TICKS_TO_PROMOTE;
+      }
+      release(&ptable.lock);
     }
-    if(ticks >= ptable.PromoteAtTime && MAXPRIO > 0){
-      promote();
-      ptable.PromoteAtTime = ticks + TICKS_TO_PROMOTE;
-    }
-    
-    release(&ptable.lock);
 #ifdef PDX_XV6
     // if idle, wait for next interrupt
     if (idle) {
@@ -1061,7 +1338,7 @@ scheduler(void)
 #endif // PDX_XV6
     // Loop over process table looking for process to run.
     acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.all; p; p = p->allnext){
       if(p->state != RUNNABLE)
         continue;
 
@@ -1172,7 +1449,7 @@ yield(void)
       curproc->priority = curproc->priority - 1;
     curproc->budget = DEFAULT_BUDGET;
   }
-  stateListAdd(&ptable.ready[curproc->priority], curproc);
+  runqAdd(cpuid(), curproc);
   sched();
   release(&ptable.lock);
 }
@@ -1221,6 +1498,7 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    iinit2(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -1260,7 +1538,7 @@ sleep(void *chan, struct spinlock *lk)
     p->budget = DEFAULT_BUDGET;
   }
   p->state = SLEEPING;
-  stateListAdd(&ptable.list[p->state], p);
+  stateListAdd(sleepList(chan), p);
 
   sched();
 
@@ -1300,7 +1578,7 @@ sleep(void *chan, struct spinlock *lk)
   }
   assertState(p, RUNNING, __FUNCTION__, __LINE__);
   p->state = SLEEPING;
-  stateListAdd(&ptable.list[p->state], p);
+  stateListAdd(sleepList(chan), p);
 
   sched();
 
@@ -1356,33 +1634,35 @@ sleep(void *chan, struct spinlock *lk)
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
+  struct proc *p, *next;
 
-  for(p = ptable.list[SLEEPING].head; p != NULL; p = p->next)
+  for(p = sleepList(chan)->head; p != NULL; p = next){
+    next = p->next;  // removal clears p->next
     if(p->chan == chan){
-      if(stateListRemove(&ptable.list[p->state], p) < 0)
+      if(stateListRemove(sleepList(chan), p) < 0)
 	panic("Process could not be removed from the list");
       assertState(p, SLEEPING, __FUNCTION__, __LINE__);
       p->state = RUNNABLE;
-      stateListAdd(&ptable.ready[p->priority],p);
+      runqAdd(p->rq, p);
     }
-
+  }
 }
 #elif CS333_P3
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
+  struct proc *p, *next;
 
-  for(p = ptable.list[SLEEPING].head; p != NULL; p = p->next)
+  for(p = sleepList(chan)->head; p != NULL; p = next){
+    next = p->next;  // removal clears p->next
     if(p->chan == chan){
-      if(stateListRemove(&ptable.list[p->state], p) < 0)
+      if(stateListRemove(sleepList(chan), p) < 0)
 	panic("Process could not be removed from the list");
       assertState(p, SLEEPING, __FUNCTION__, __LINE__);
       p->state = RUNNABLE;
       stateListAdd(&ptable.list[p->state],p);
     }
-
+  }
 }
 #else
 static void
@@ -1390,7 +1670,7 @@ wakeup1(void *chan)
 {
   struct proc *p;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.all; p; p = p->allnext)
     if(p->state == SLEEPING && p->chan == chan)
       p->state = RUNNABLE;
 }
@@ -1405,130 +1685,126 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
-// Kill the process with the given pid.
-// Process won't exit until it returns
-// to user space (see trap in trap.c).
-#ifdef CS333_P4
+static void
+timerremove(struct proc *p)
+{
+  if(p->tnext)
+    p->tnext->tprev = p->tprev;
+  *p->tprev = p->tnext;
+  p->tnext = 0;
+  p->tprev = 0;
+}
+
+// Sleep until n ticks have passed. The caller sits on the timer
+// wheel and is woken once, by timertick(), when its deadline is due,
+// rather than on every tick. Returns -1 if killed while asleep.
 int
-kill(int pid)
+sleepticks(uint n)
 {
-  struct proc *p;
+  struct proc *p = myproc();
+  struct proc **slot;
 
   acquire(&ptable.lock);
-  for(p = ptable.list[SLEEPING].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING){
-        if(stateListRemove(&ptable.list[p->state], p) < 0){
-          panic("Process could not be removed from the SLEEPING list");
-	}
-	assertState(p, SLEEPING, __FUNCTION__, __LINE__);
-        p->state = RUNNABLE;
-	stateListAdd(&ptable.ready[p->priority], p);
-
-      }
-      release(&ptable.lock);
-      return 0;
-    }
-  }
-  for(p = ptable.list[RUNNING].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      p->killed = 1;
-      
+  p->wakeat = ticks + n;
+  while((int)(p->wakeat - ticks) > 0){
+    if(p->killed){
       release(&ptable.lock);
-      return 0;
+      return -1;
     }
+    slot = &ptable.timer[p->wakeat % NTIMERSLOT];
+    p->tnext = *slot;
+    p->tprev = slot;
+    if(*slot)
+      (*slot)->tprev = &p->tnext;
+    *slot = p;
+    // Pairs with the barrier in timertick(): either the tick that
+    // makes us due sees us on the wheel or we see that tick here.
+    __sync_synchronize();
+    if((int)(p->wakeat - ticks) > 0)
+      sleep(&p->wakeat, &ptable.lock);
+    if(p->tprev)
+      timerremove(p);
   }
-  for(int i = MAXPRIO; i >= 0; --i){
-    for(p = ptable.ready[i].head; p != NULL; p = p->next){
-      if(p->pid == pid){
-        p->killed = 1;
-      
-        release(&ptable.lock);
-        return 0;
-     }
-   }
-  }
+  release(&ptable.lock);
+  return 0;
+}
 
-  for(p = ptable.list[EMBRYO].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      p->killed = 1;
-      
-      release(&ptable.lock);
-      return 0;
-    }
-  }
-  for(p = ptable.list[UNUSED].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      p->killed = 1;
-      
-      release(&ptable.lock);
-      return 0;
+// Called on every clock tick, after ticks is advanced to now.
+// Wakes the sleepers whose deadline is now; an empty slot is
+// skipped without taking ptable.lock.
+void
+timertick(uint now)
+{
+  struct proc **slot = &ptable.timer[now % NTIMERSLOT];
+  struct proc *p, *next;
+
+  __sync_synchronize();
+  if(*slot == 0)
+    return;
+
+  acquire(&ptable.lock);
+  for(p = *slot; p; p = next){
+    next = p->tnext;
+    if((int)(p->wakeat - now) <= 0){
+      timerremove(p);
+      wakeup1(&p->wakeat);
     }
   }
   release(&ptable.lock);
-  return -1;
 }
-#elif CS333_P3
+
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+#ifdef CS333_P4
 int
 kill(int pid)
 {
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.list[SLEEPING].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING){
-        if(stateListRemove(&ptable.list[p->state], p) < 0){
-          panic("Process could not be removed from the SLEEPING list");
-	}
-	assertState(p, SLEEPING, __FUNCTION__, __LINE__);
-        p->state = RUNNABLE;
-	stateListAdd(&ptable.list[p->state], p);
-
-      }
-      release(&ptable.lock);
-      return 0;
-    }
+  p = pidlookup(pid);
+  if(p == NULL || p->state == ZOMBIE){
+    release(&ptable.lock);
+    return -1;
   }
-  for(p = ptable.list[RUNNING].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      p->killed = 1;
-      
-      release(&ptable.lock);
-      return 0;
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING){
+    if(stateListRemove(sleepList(p->chan), p) < 0){
+      panic("Process could not be removed from the SLEEPING list");
     }
+    assertState(p, SLEEPING, __FUNCTION__, __LINE__);
+    p->state = RUNNABLE;
+    runqAdd(p->rq, p);
   }
+  release(&ptable.lock);
+  return 0;
+}
+#elif CS333_P3
+int
+kill(int pid)
+{
+  struct proc *p;
 
-  for(p = ptable.list[RUNNABLE].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      p->killed = 1;
-      
-      release(&ptable.lock);
-      return 0;
-    }
-  }
-  for(p = ptable.list[EMBRYO].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      p->killed = 1;
-      
-      release(&ptable.lock);
-      return 0;
-    }
+  acquire(&ptable.lock);
+  p = pidlookup(pid);
+  if(p == NULL || p->state == ZOMBIE){
+    release(&ptable.lock);
+    return -1;
   }
-  for(p = ptable.list[UNUSED].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      p->killed = 1;
-      
-      release(&ptable.lock);
-      return 0;
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING){
+    if(stateListRemove(sleepList(p->chan), p) < 0){
+      panic("Process could not be removed from the SLEEPING list");
     }
+    assertState(p, SLEEPING, __FUNCTION__, __LINE__);
+    p->state = RUNNABLE;
+    stateListAdd(&ptable.list[p->state], p);
   }
   release(&ptable.lock);
-  return -1;
+  return 0;
 }
 #else
 int
@@ -1537,18 +1813,17 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+  p = pidlookup(pid);
+  if(p == NULL){
+    release(&ptable.lock);
+    return -1;
   }
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING)
+    p->state = RUNNABLE;
   release(&ptable.lock);
-  return -1;
+  return 0;
 }
 #endif //CS333_P3
 #ifdef CS333_P2
@@ -1561,7 +1836,7 @@ getprocs(int max, struct uproc * table)
 
   acquire(&ptable.lock);
 
-  for(p= ptable.proc; p < &ptable.proc[NPROC]&& i< max; p++){
+  for(p= ptable.all; p && i< max; p = p->allnext){
 
      if( (p->state == UNUSED || p->state == EMBRYO))
        continue;	     
@@ -1596,18 +1871,19 @@ void
 promote()
 {
   struct proc* p;
-  for(int i = MAXPRIO-1; i >= 0; --i){
-    p = ptable.ready[i].head;
-    while(p != NULL){
-      struct proc* temp = p->next;
-
-      if(stateListRemove(&ptable.ready[p->priority],p) < 0)
-	panic("Could not remove from RUNNABLE");
-      assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
-      p->priority = p->priority + 1;
-      p->budget = DEFAULT_BUDGET;
-      stateListAdd(&ptable.ready[p->priority],p);
-      p = temp;
+  for(struct runq *q = runq; q < &runq[ncpu]; q++){
+    for(int i = MAXPRIO-1; i >= 0; --i){
+      p = q->ready[i].head;
+      while(p != NULL){
+        struct proc* temp = p->next;
+
+        runqRemove(p);
+        assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
+        p->priority = p->priority + 1;
+        p->budget = DEFAULT_BUDGET;
+        runqAdd(p->rq, p);
+        p = temp;
+      }
     }
   }
   for(p = ptable.list[RUNNING].head; p != NULL; p = p->next){
@@ -1616,11 +1892,12 @@ promote()
        p->budget = DEFAULT_BUDGET;
     }
   }
-  for(p = ptable.list[SLEEPING].head; p != NULL; p = p->next){
-    if(p->priority != MAXPRIO){
-      p->priority = p->priority + 1;
-      p->budget = DEFAULT_BUDGET;
-
+  for(int i = 0; i < NSLEEPQ; i++){
+    for(p = ptable.sleepq[i].head; p != NULL; p = p->next){
+      if(p->priority != MAXPRIO){
+        p->priority = p->priority + 1;
+        p->budget = DEFAULT_BUDGET;
+      }
     }
   }
 }
@@ -1630,102 +1907,24 @@ getpriority(int pid)
 {
   struct proc * p;
   int prio = -1;
-  acquire(&ptable.lock);
-
-  for(p = ptable.list[RUNNING].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      prio = p->priority;
-      release(&ptable.lock);
-      return prio;
-    }
-    else{
-      break;
-    }      
-  }
-  for(p = ptable.list[SLEEPING].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      prio = p->priority;
-      release(&ptable.lock);
-      return prio;
-    }
-    else{
-      break;
-    } 
-  }
-  for(p = ptable.list[EMBRYO].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      prio = p->priority;
-      release(&ptable.lock);
-      return prio;
-    }
-    else{
-      break;
-    } 
-  }
-  for(p = ptable.list[ZOMBIE].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-      prio = p->priority;
-      release(&ptable.lock);
-      return prio;
-    }
-    else{
-      break;
-    } 
-  }
-  for(int i = MAXPRIO; i >= 0; --i){
-
-    p = ptable.ready[i].head;
-    while(p != NULL){
-      struct proc* temp = p->next;
 
-    //for(p = ptable.ready[i].head; p != NULL; p = p->next){
-      if(p->pid == pid){
-	prio = p->priority;
-	release(&ptable.lock);
-	return prio;
-      }
-      p = temp;
-    }
-  }
-  release(&ptable.lock);  
+  acquire(&ptable.lock);
+  p = pidlookup(pid);
+  if(p != NULL)
+    prio = p->priority;
+  release(&ptable.lock);
   return prio;
 }
-//only used when ptable lock is being held 
+//only used when ptable lock is being held
 struct proc*
 FindPID(int pid)
 {
-  //acquire(&ptable.lock);
-  struct proc * p;
-
-  for(p = ptable.list[RUNNING].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-//      release(&ptable.lock);
-      return p;
-    }
-  }
-  for(p = ptable.list[SLEEPING].head; p != NULL; p = p->next){
-    if(p->pid == pid){
-//      release(&ptable.lock);
-      return p;
-    }
-  }
-  for(int i = MAXPRIO; i >= 0; --i){
-    p = ptable.ready[i].head;
-    while(p != NULL){
-      struct proc* temp = p->next;
+  struct proc * p = pidlookup(pid);
 
-    //for(p = ptable.ready[i].head; p != NULL; p = p->next){
-      if(p->pid == pid){
-//	release(&ptable.lock);
-	return p;
-      }
-      p = temp;
-    }
-  }
-
-  //release(&ptable.lock);
+  if(p != NULL && (p->state == RUNNING || p->state == SLEEPING ||
+                   p->state == RUNNABLE))
+    return p;
   return NULL;
-
 }
 
 int
@@ -1739,12 +1938,11 @@ setpriority(int pid, int priority)
     return -1;
   }
   if(p->priority != priority && p->state == RUNNABLE){
-    if(stateListRemove(&ptable.ready[p->priority],p) < 0)
-      panic("Cannot remove from list");
+    runqRemove(p);
     assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
     p->budget = DEFAULT_BUDGET;
     p->priority = priority;
-    stateListAdd(&ptable.ready[p->priority], p);
+    runqAdd(p->rq, p);
     release(&ptable.lock);
     return 0;
   }
@@ -1768,12 +1966,11 @@ schedDemote(int pid, int priority){
     return ;
   }
   if(p->priority != priority && p->state == RUNNABLE){
-    if(stateListRemove(&ptable.ready[p->priority],p) < 0)
-      panic("Cannot remove from list");
+    runqRemove(p);
     assertState(p, RUNNABLE, __FUNCTION__, __LINE__);
     p->budget = DEFAULT_BUDGET;
     p->priority = priority;
-    stateListAdd(&ptable.ready[p->priority], p);
+    runqAdd(p->rq, p);
     return ;
   }
   else{
@@ -1885,20 +2082,23 @@ ctrlr(void)
   acquire(&ptable.lock);
   struct proc * current;
   cprintf("Ready List Processes:\n");
-  for(int i = MAXPRIO; i >= 0; --i){
-    current = ptable.ready[i].head;
-    cprintf("%d: ", i);    
-    while(current != NULL){
-      if(current->next == NULL)	  
-        cprintf("(%d,%d)\n", current->pid, current->budget);
-      else
-        cprintf("(%d,%d)->", current->pid, current->budget);        
-    
-      current = current->next;
+  for(int c = 0; c < ncpu; c++){
+    cprintf("cpu%d:\n", c);
+    for(int i = MAXPRIO; i >= 0; --i){
+      current = runq[c].ready[i].head;
+      cprintf("%d: ", i);
+      while(current != NULL){
+        if(current->next == NULL)
+          cprintf("(%d,%d)\n", current->pid, current->budget);
+        else
+          cprintf("(%d,%d)->", current->pid, current->budget);
 
-   }
-   cprintf("\n");
+        current = current->next;
+
+     }
+     cprintf("\n");
 
+    }
   }
   release(&ptable.lock);
   cprintf("\n$ ");
@@ -1944,15 +2144,17 @@ void
 ctrls(void)
 {
   acquire(&ptable.lock);
-  struct proc * current = ptable.list[SLEEPING].head;
+  struct proc * current;
+  int first = 1;
   cprintf("Sleeping List Processes:\n");
-  while(current != NULL){
-    if(current->next == NULL)	  
-      cprintf("%d", current->pid);
-    else
-      cprintf("%d->", current->pid);   
-    current = current->next;
-
+  for(int i = 0; i < NSLEEPQ; i++){
+    for(current = ptable.sleepq[i].head; current != NULL; current = current->next){
+      if(first)
+        cprintf("%d", current->pid);
+      else
+        cprintf("->%d", current->pid);
+      first = 0;
+    }
   }
   release(&ptable.lock);
   cprintf("\n$ ");
@@ -2005,7 +2207,7 @@ procdump(void)
 
   cprintf(HEADER);  // not conditionally compiled as must work in all project states
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.all; p; p = p->allnext){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
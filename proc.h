@@ -34,6 +34,15 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// A program segment that exec() left to be read in on demand:
+// user addresses [vaddr, vaddr+filesz) come from the executable
+// starting at file offset off.
+struct seg {
+  uint vaddr;
+  uint filesz;
+  uint off;
+};
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -41,14 +50,24 @@ struct proc {
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   uint pid;                    // Process ID
+  struct proc *pidnext;        // Next proc in pid hash chain
+  struct proc *allnext;        // Next proc in ptable.all
   struct proc *parent;         // Parent process. NULL indicates no parent
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
+  struct file **ofile;         // Open files: ofile0 or a page
+  int nofile;                  // Entries in ofile
+  struct file *ofile0[NOFILE];
   struct inode *cwd;           // Current directory
+  struct inode *exe;           // Executable that seg[] is read from
+  struct seg seg[NSEG];        // Segments not yet read in from exe
+  int nseg;
   char name[16];               // Process name (debugging)
+  uint wakeat;                 // sleepticks() deadline
+  struct proc *tnext;          // Next sleeper in p's timer wheel slot
+  struct proc **tprev;         // Link pointing at p, or 0 if not on wheel
 #ifdef CS333_P1
   uint start_ticks;
 #endif //CS333_P1
@@ -60,10 +79,13 @@ struct proc {
 #endif //CS333_P2
 #ifdef CS333_P3
   struct proc * next;
+  struct proc * prev;
+  struct ptrs * list;          // State list p is on, or NULL
 #endif //CS333_P3
 #ifdef CS333_P4
   uint priority;
   int budget;
+  int rq;                      // Run queue (CPU) p is or was last queued on
 #endif //CS333_P4
 
 };
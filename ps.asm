@@ -0,0 +1,1338 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "uproc.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 24             	sub    $0x24,%esp
+
+  int max = 72;
+  struct uproc * table =  malloc(max *(sizeof(struct uproc)));
+  14:	68 00 1b 00 00       	push   $0x1b00
+  19:	e8 06 08 00 00       	call   824 <malloc>
+  1e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(getprocs(max, table) < 0)
+  21:	83 c4 08             	add    $0x8,%esp
+  24:	50                   	push   %eax
+  25:	6a 48                	push   $0x48
+  27:	e8 05 05 00 00       	call   531 <getprocs>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	85 c0                	test   %eax,%eax
+  31:	78 1c                	js     4f <main+0x4f>
+    printf(1, "Error: Processes cannot be gotten.\n");
+#ifdef CS333_P4  
+  printf(2,"\nPID\tName         UID\tGID\tPPID\tPrio\tElapsed\tCPU\tState\tSize\n");
+  33:	83 ec 08             	sub    $0x8,%esp
+  36:	68 d0 08 00 00       	push   $0x8d0
+  3b:	6a 02                	push   $0x2
+  3d:	e8 bc 05 00 00       	call   5fe <printf>
+#else
+  printf(2,"\nPID\tName         UID\tGID\tPPID\tElapsed\tCPU\tState\tSize\n");
+#endif
+   for(int i = 0; i < max; ++i)
+  42:	83 c4 10             	add    $0x10,%esp
+  45:	be 00 00 00 00       	mov    $0x0,%esi
+  4a:	e9 c0 00 00 00       	jmp    10f <main+0x10f>
+    printf(1, "Error: Processes cannot be gotten.\n");
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	68 ac 08 00 00       	push   $0x8ac
+  57:	6a 01                	push   $0x1
+  59:	e8 a0 05 00 00       	call   5fe <printf>
+  5e:	83 c4 10             	add    $0x10,%esp
+  61:	eb d0                	jmp    33 <main+0x33>
+#endif
+      int elapsed = table[i].elapsed_ticks / 1000;
+      int elapsed_dec = table[i].elapsed_ticks % 1000;
+      printf(1,"%d.", elapsed);
+      if(elapsed_dec < 100 && elapsed_dec > 9)
+        printf(1,"0%d\t", elapsed_dec);
+  63:	83 ec 04             	sub    $0x4,%esp
+  66:	57                   	push   %edi
+  67:	68 31 09 00 00       	push   $0x931
+  6c:	6a 01                	push   $0x1
+  6e:	e8 8b 05 00 00       	call   5fe <printf>
+  73:	83 c4 10             	add    $0x10,%esp
+  76:	e9 04 01 00 00       	jmp    17f <main+0x17f>
+      if(elapsed_dec < 10)
+        printf(1,"00%d\t", elapsed_dec);
+  7b:	83 ec 04             	sub    $0x4,%esp
+  7e:	ff 75 e4             	push   -0x1c(%ebp)
+  81:	68 30 09 00 00       	push   $0x930
+  86:	6a 01                	push   $0x1
+  88:	e8 71 05 00 00       	call   5fe <printf>
+  8d:	83 c4 10             	add    $0x10,%esp
+  90:	e9 f4 00 00 00       	jmp    189 <main+0x189>
+      if(elapsed_dec >=100)
+        printf(1,"%d\t", elapsed_dec);
+  95:	83 ec 04             	sub    $0x4,%esp
+  98:	ff 75 e4             	push   -0x1c(%ebp)
+  9b:	68 32 09 00 00       	push   $0x932
+  a0:	6a 01                	push   $0x1
+  a2:	e8 57 05 00 00       	call   5fe <printf>
+  a7:	83 c4 10             	add    $0x10,%esp
+  aa:	e9 e4 00 00 00       	jmp    193 <main+0x193>
+    // printf(1,"CPU TICKS: %d", table[i].CPU_total_ticks);
+      int cpuelapsed = table[i].CPU_total_ticks /1000;
+      int cpuelapsed_dec = table[i].CPU_total_ticks % 1000;    
+      printf(1,"%d.", cpuelapsed);
+      if(cpuelapsed_dec < 100 && cpuelapsed_dec > 9)
+        printf(1,"0%d", cpuelapsed_dec);
+  af:	83 ec 04             	sub    $0x4,%esp
+  b2:	57                   	push   %edi
+  b3:	68 37 09 00 00       	push   $0x937
+  b8:	6a 01                	push   $0x1
+  ba:	e8 3f 05 00 00       	call   5fe <printf>
+  bf:	83 c4 10             	add    $0x10,%esp
+  c2:	e9 05 01 00 00       	jmp    1cc <main+0x1cc>
+      if(cpuelapsed_dec < 10)
+        printf(1,"00%d", cpuelapsed_dec);
+  c7:	83 ec 04             	sub    $0x4,%esp
+  ca:	ff 75 e4             	push   -0x1c(%ebp)
+  cd:	68 36 09 00 00       	push   $0x936
+  d2:	6a 01                	push   $0x1
+  d4:	e8 25 05 00 00       	call   5fe <printf>
+  d9:	83 c4 10             	add    $0x10,%esp
+  dc:	e9 f5 00 00 00       	jmp    1d6 <main+0x1d6>
+      if(cpuelapsed_dec >=100)
+        printf(1,"%d", cpuelapsed_dec);
+  e1:	83 ec 04             	sub    $0x4,%esp
+  e4:	ff 75 e4             	push   -0x1c(%ebp)
+  e7:	68 38 09 00 00       	push   $0x938
+  ec:	6a 01                	push   $0x1
+  ee:	e8 0b 05 00 00       	call   5fe <printf>
+  f3:	83 c4 10             	add    $0x10,%esp
+      printf(1, "   %s\t%d\n", table[i].state, table[i].size);
+  f6:	8d 43 1c             	lea    0x1c(%ebx),%eax
+  f9:	ff 73 3c             	push   0x3c(%ebx)
+  fc:	50                   	push   %eax
+  fd:	68 3b 09 00 00       	push   $0x93b
+ 102:	6a 01                	push   $0x1
+ 104:	e8 f5 04 00 00       	call   5fe <printf>
+ 109:	83 c4 10             	add    $0x10,%esp
+   for(int i = 0; i < max; ++i)
+ 10c:	83 c6 01             	add    $0x1,%esi
+ 10f:	83 fe 47             	cmp    $0x47,%esi
+ 112:	0f 8f cd 00 00 00    	jg     1e5 <main+0x1e5>
+      if(table[i].ppid < 1)
+ 118:	8d 1c 76             	lea    (%esi,%esi,2),%ebx
+ 11b:	c1 e3 05             	shl    $0x5,%ebx
+ 11e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 121:	01 c3                	add    %eax,%ebx
+ 123:	8b 43 0c             	mov    0xc(%ebx),%eax
+ 126:	85 c0                	test   %eax,%eax
+ 128:	74 e2                	je     10c <main+0x10c>
+      printf(1,"%d\t%s\t     %d\t        %d\t%d\t%d\t", table[i].pid, table[i].name,table[i].uid, table[i].gid, table[i].ppid, table[i].priority);
+ 12a:	8d 53 40             	lea    0x40(%ebx),%edx
+ 12d:	ff 73 10             	push   0x10(%ebx)
+ 130:	50                   	push   %eax
+ 131:	ff 73 08             	push   0x8(%ebx)
+ 134:	ff 73 04             	push   0x4(%ebx)
+ 137:	52                   	push   %edx
+ 138:	ff 33                	push   (%ebx)
+ 13a:	68 0c 09 00 00       	push   $0x90c
+ 13f:	6a 01                	push   $0x1
+ 141:	e8 b8 04 00 00       	call   5fe <printf>
+      int elapsed = table[i].elapsed_ticks / 1000;
+ 146:	8b 7b 14             	mov    0x14(%ebx),%edi
+ 149:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 14e:	89 f8                	mov    %edi,%eax
+ 150:	f7 e2                	mul    %edx
+ 152:	c1 ea 06             	shr    $0x6,%edx
+      int elapsed_dec = table[i].elapsed_ticks % 1000;
+ 155:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+ 15b:	29 c7                	sub    %eax,%edi
+ 15d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      printf(1,"%d.", elapsed);
+ 160:	83 c4 1c             	add    $0x1c,%esp
+ 163:	52                   	push   %edx
+ 164:	68 2c 09 00 00       	push   $0x92c
+ 169:	6a 01                	push   $0x1
+ 16b:	e8 8e 04 00 00       	call   5fe <printf>
+      if(elapsed_dec < 100 && elapsed_dec > 9)
+ 170:	8d 47 f6             	lea    -0xa(%edi),%eax
+ 173:	83 c4 10             	add    $0x10,%esp
+ 176:	83 f8 59             	cmp    $0x59,%eax
+ 179:	0f 86 e4 fe ff ff    	jbe    63 <main+0x63>
+      if(elapsed_dec < 10)
+ 17f:	83 7d e4 09          	cmpl   $0x9,-0x1c(%ebp)
+ 183:	0f 8e f2 fe ff ff    	jle    7b <main+0x7b>
+      if(elapsed_dec >=100)
+ 189:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 18d:	0f 8f 02 ff ff ff    	jg     95 <main+0x95>
+      int cpuelapsed = table[i].CPU_total_ticks /1000;
+ 193:	8b 7b 18             	mov    0x18(%ebx),%edi
+ 196:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 19b:	89 f8                	mov    %edi,%eax
+ 19d:	f7 e2                	mul    %edx
+ 19f:	c1 ea 06             	shr    $0x6,%edx
+      int cpuelapsed_dec = table[i].CPU_total_ticks % 1000;    
+ 1a2:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+ 1a8:	29 c7                	sub    %eax,%edi
+ 1aa:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      printf(1,"%d.", cpuelapsed);
+ 1ad:	83 ec 04             	sub    $0x4,%esp
+ 1b0:	52                   	push   %edx
+ 1b1:	68 2c 09 00 00       	push   $0x92c
+ 1b6:	6a 01                	push   $0x1
+ 1b8:	e8 41 04 00 00       	call   5fe <printf>
+      if(cpuelapsed_dec < 100 && cpuelapsed_dec > 9)
+ 1bd:	8d 47 f6             	lea    -0xa(%edi),%eax
+ 1c0:	83 c4 10             	add    $0x10,%esp
+ 1c3:	83 f8 59             	cmp    $0x59,%eax
+ 1c6:	0f 86 e3 fe ff ff    	jbe    af <main+0xaf>
+      if(cpuelapsed_dec < 10)
+ 1cc:	83 7d e4 09          	cmpl   $0x9,-0x1c(%ebp)
+ 1d0:	0f 8e f1 fe ff ff    	jle    c7 <main+0xc7>
+      if(cpuelapsed_dec >=100)
+ 1d6:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 1da:	0f 8e 16 ff ff ff    	jle    f6 <main+0xf6>
+ 1e0:	e9 fc fe ff ff       	jmp    e1 <main+0xe1>
+    } 
+    
+  free(table);
+ 1e5:	83 ec 0c             	sub    $0xc,%esp
+ 1e8:	ff 75 e0             	push   -0x20(%ebp)
+ 1eb:	e8 74 05 00 00       	call   764 <free>
+  exit();
+ 1f0:	e8 64 02 00 00       	call   459 <exit>
+
+000001f5 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1f5:	55                   	push   %ebp
+ 1f6:	89 e5                	mov    %esp,%ebp
+ 1f8:	56                   	push   %esi
+ 1f9:	53                   	push   %ebx
+ 1fa:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 200:	89 f0                	mov    %esi,%eax
+ 202:	89 d1                	mov    %edx,%ecx
+ 204:	83 c2 01             	add    $0x1,%edx
+ 207:	89 c3                	mov    %eax,%ebx
+ 209:	83 c0 01             	add    $0x1,%eax
+ 20c:	0f b6 09             	movzbl (%ecx),%ecx
+ 20f:	88 0b                	mov    %cl,(%ebx)
+ 211:	84 c9                	test   %cl,%cl
+ 213:	75 ed                	jne    202 <strcpy+0xd>
+    ;
+  return os;
+}
+ 215:	89 f0                	mov    %esi,%eax
+ 217:	5b                   	pop    %ebx
+ 218:	5e                   	pop    %esi
+ 219:	5d                   	pop    %ebp
+ 21a:	c3                   	ret
+
+0000021b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 21b:	55                   	push   %ebp
+ 21c:	89 e5                	mov    %esp,%ebp
+ 21e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 221:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 224:	eb 06                	jmp    22c <strcmp+0x11>
+    p++, q++;
+ 226:	83 c1 01             	add    $0x1,%ecx
+ 229:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 22c:	0f b6 01             	movzbl (%ecx),%eax
+ 22f:	84 c0                	test   %al,%al
+ 231:	74 04                	je     237 <strcmp+0x1c>
+ 233:	3a 02                	cmp    (%edx),%al
+ 235:	74 ef                	je     226 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 237:	0f b6 c0             	movzbl %al,%eax
+ 23a:	0f b6 12             	movzbl (%edx),%edx
+ 23d:	29 d0                	sub    %edx,%eax
+}
+ 23f:	5d                   	pop    %ebp
+ 240:	c3                   	ret
+
+00000241 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 241:	55                   	push   %ebp
+ 242:	89 e5                	mov    %esp,%ebp
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 247:	b8 00 00 00 00       	mov    $0x0,%eax
+ 24c:	eb 03                	jmp    251 <strlen+0x10>
+ 24e:	83 c0 01             	add    $0x1,%eax
+ 251:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 255:	75 f7                	jne    24e <strlen+0xd>
+    ;
+  return n;
+}
+ 257:	5d                   	pop    %ebp
+ 258:	c3                   	ret
+
+00000259 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 259:	55                   	push   %ebp
+ 25a:	89 e5                	mov    %esp,%ebp
+ 25c:	57                   	push   %edi
+ 25d:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 260:	89 d7                	mov    %edx,%edi
+ 262:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 265:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 268:	fc                   	cld
+ 269:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 26b:	89 d0                	mov    %edx,%eax
+ 26d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 270:	c9                   	leave
+ 271:	c3                   	ret
+
+00000272 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 272:	55                   	push   %ebp
+ 273:	89 e5                	mov    %esp,%ebp
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 27c:	eb 03                	jmp    281 <strchr+0xf>
+ 27e:	83 c0 01             	add    $0x1,%eax
+ 281:	0f b6 10             	movzbl (%eax),%edx
+ 284:	84 d2                	test   %dl,%dl
+ 286:	74 06                	je     28e <strchr+0x1c>
+    if(*s == c)
+ 288:	38 ca                	cmp    %cl,%dl
+ 28a:	75 f2                	jne    27e <strchr+0xc>
+ 28c:	eb 05                	jmp    293 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 28e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 293:	5d                   	pop    %ebp
+ 294:	c3                   	ret
+
+00000295 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 295:	55                   	push   %ebp
+ 296:	89 e5                	mov    %esp,%ebp
+ 298:	57                   	push   %edi
+ 299:	56                   	push   %esi
+ 29a:	53                   	push   %ebx
+ 29b:	83 ec 1c             	sub    $0x1c,%esp
+ 29e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2a6:	89 de                	mov    %ebx,%esi
+ 2a8:	83 c3 01             	add    $0x1,%ebx
+ 2ab:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ae:	7d 2e                	jge    2de <gets+0x49>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 2b8:	50                   	push   %eax
+ 2b9:	6a 00                	push   $0x0
+ 2bb:	e8 b1 01 00 00       	call   471 <read>
+    if(cc < 1)
+ 2c0:	83 c4 10             	add    $0x10,%esp
+ 2c3:	85 c0                	test   %eax,%eax
+ 2c5:	7e 17                	jle    2de <gets+0x49>
+      break;
+    buf[i++] = c;
+ 2c7:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2cb:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 2ce:	3c 0a                	cmp    $0xa,%al
+ 2d0:	0f 94 c2             	sete   %dl
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	0f 94 c0             	sete   %al
+ 2d8:	08 c2                	or     %al,%dl
+ 2da:	74 ca                	je     2a6 <gets+0x11>
+    buf[i++] = c;
+ 2dc:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 2de:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 2e2:	89 f8                	mov    %edi,%eax
+ 2e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2e7:	5b                   	pop    %ebx
+ 2e8:	5e                   	pop    %esi
+ 2e9:	5f                   	pop    %edi
+ 2ea:	5d                   	pop    %ebp
+ 2eb:	c3                   	ret
+
+000002ec <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2ec:	55                   	push   %ebp
+ 2ed:	89 e5                	mov    %esp,%ebp
+ 2ef:	56                   	push   %esi
+ 2f0:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2f1:	83 ec 08             	sub    $0x8,%esp
+ 2f4:	6a 00                	push   $0x0
+ 2f6:	ff 75 08             	push   0x8(%ebp)
+ 2f9:	e8 9b 01 00 00       	call   499 <open>
+  if(fd < 0)
+ 2fe:	83 c4 10             	add    $0x10,%esp
+ 301:	85 c0                	test   %eax,%eax
+ 303:	78 24                	js     329 <stat+0x3d>
+ 305:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 307:	83 ec 08             	sub    $0x8,%esp
+ 30a:	ff 75 0c             	push   0xc(%ebp)
+ 30d:	50                   	push   %eax
+ 30e:	e8 9e 01 00 00       	call   4b1 <fstat>
+ 313:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 315:	89 1c 24             	mov    %ebx,(%esp)
+ 318:	e8 64 01 00 00       	call   481 <close>
+  return r;
+ 31d:	83 c4 10             	add    $0x10,%esp
+}
+ 320:	89 f0                	mov    %esi,%eax
+ 322:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 325:	5b                   	pop    %ebx
+ 326:	5e                   	pop    %esi
+ 327:	5d                   	pop    %ebp
+ 328:	c3                   	ret
+    return -1;
+ 329:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 32e:	eb f0                	jmp    320 <stat+0x34>
+
+00000330 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	56                   	push   %esi
+ 334:	53                   	push   %ebx
+ 335:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 338:	eb 03                	jmp    33d <atoi+0xd>
+ 33a:	83 c2 01             	add    $0x1,%edx
+ 33d:	0f b6 02             	movzbl (%edx),%eax
+ 340:	3c 20                	cmp    $0x20,%al
+ 342:	74 f6                	je     33a <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 344:	3c 2d                	cmp    $0x2d,%al
+ 346:	74 1d                	je     365 <atoi+0x35>
+ 348:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 34d:	3c 2b                	cmp    $0x2b,%al
+ 34f:	0f 94 c1             	sete   %cl
+ 352:	3c 2d                	cmp    $0x2d,%al
+ 354:	0f 94 c0             	sete   %al
+ 357:	08 c1                	or     %al,%cl
+ 359:	74 03                	je     35e <atoi+0x2e>
+    s++;
+ 35b:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 35e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 363:	eb 17                	jmp    37c <atoi+0x4c>
+ 365:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 36a:	eb e1                	jmp    34d <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 36c:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 36f:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 372:	83 c2 01             	add    $0x1,%edx
+ 375:	0f be c9             	movsbl %cl,%ecx
+ 378:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 37c:	0f b6 0a             	movzbl (%edx),%ecx
+ 37f:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 382:	80 fb 09             	cmp    $0x9,%bl
+ 385:	76 e5                	jbe    36c <atoi+0x3c>
+  return sign*n;
+ 387:	0f af c6             	imul   %esi,%eax
+}
+ 38a:	5b                   	pop    %ebx
+ 38b:	5e                   	pop    %esi
+ 38c:	5d                   	pop    %ebp
+ 38d:	c3                   	ret
+
+0000038e <atoo>:
+
+int
+atoo(const char *s)
+{
+ 38e:	55                   	push   %ebp
+ 38f:	89 e5                	mov    %esp,%ebp
+ 391:	56                   	push   %esi
+ 392:	53                   	push   %ebx
+ 393:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 396:	eb 03                	jmp    39b <atoo+0xd>
+ 398:	83 c2 01             	add    $0x1,%edx
+ 39b:	0f b6 02             	movzbl (%edx),%eax
+ 39e:	3c 20                	cmp    $0x20,%al
+ 3a0:	74 f6                	je     398 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 3a2:	3c 2d                	cmp    $0x2d,%al
+ 3a4:	74 1d                	je     3c3 <atoo+0x35>
+ 3a6:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 3ab:	3c 2b                	cmp    $0x2b,%al
+ 3ad:	0f 94 c1             	sete   %cl
+ 3b0:	3c 2d                	cmp    $0x2d,%al
+ 3b2:	0f 94 c0             	sete   %al
+ 3b5:	08 c1                	or     %al,%cl
+ 3b7:	74 03                	je     3bc <atoo+0x2e>
+    s++;
+ 3b9:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 3bc:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3c1:	eb 11                	jmp    3d4 <atoo+0x46>
+ 3c3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3c8:	eb e1                	jmp    3ab <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 3ca:	83 c2 01             	add    $0x1,%edx
+ 3cd:	0f be c9             	movsbl %cl,%ecx
+ 3d0:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 3d4:	0f b6 0a             	movzbl (%edx),%ecx
+ 3d7:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 3da:	80 fb 07             	cmp    $0x7,%bl
+ 3dd:	76 eb                	jbe    3ca <atoo+0x3c>
+  return sign*n;
+ 3df:	0f af c6             	imul   %esi,%eax
+}
+ 3e2:	5b                   	pop    %ebx
+ 3e3:	5e                   	pop    %esi
+ 3e4:	5d                   	pop    %ebp
+ 3e5:	c3                   	ret
+
+000003e6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 3e6:	55                   	push   %ebp
+ 3e7:	89 e5                	mov    %esp,%ebp
+ 3e9:	53                   	push   %ebx
+ 3ea:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 3f0:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 3f3:	eb 09                	jmp    3fe <strncmp+0x18>
+      n--, p++, q++;
+ 3f5:	83 e8 01             	sub    $0x1,%eax
+ 3f8:	83 c2 01             	add    $0x1,%edx
+ 3fb:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 3fe:	85 c0                	test   %eax,%eax
+ 400:	74 0b                	je     40d <strncmp+0x27>
+ 402:	0f b6 1a             	movzbl (%edx),%ebx
+ 405:	84 db                	test   %bl,%bl
+ 407:	74 04                	je     40d <strncmp+0x27>
+ 409:	3a 19                	cmp    (%ecx),%bl
+ 40b:	74 e8                	je     3f5 <strncmp+0xf>
+    if(n == 0)
+ 40d:	85 c0                	test   %eax,%eax
+ 40f:	74 0d                	je     41e <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 411:	0f b6 02             	movzbl (%edx),%eax
+ 414:	0f b6 11             	movzbl (%ecx),%edx
+ 417:	29 d0                	sub    %edx,%eax
+}
+ 419:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41c:	c9                   	leave
+ 41d:	c3                   	ret
+      return 0;
+ 41e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 423:	eb f4                	jmp    419 <strncmp+0x33>
+
+00000425 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 425:	55                   	push   %ebp
+ 426:	89 e5                	mov    %esp,%ebp
+ 428:	56                   	push   %esi
+ 429:	53                   	push   %ebx
+ 42a:	8b 75 08             	mov    0x8(%ebp),%esi
+ 42d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 430:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 433:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 435:	eb 0d                	jmp    444 <memmove+0x1f>
+    *dst++ = *src++;
+ 437:	0f b6 01             	movzbl (%ecx),%eax
+ 43a:	88 02                	mov    %al,(%edx)
+ 43c:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 43f:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 442:	89 d8                	mov    %ebx,%eax
+ 444:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 447:	85 c0                	test   %eax,%eax
+ 449:	7f ec                	jg     437 <memmove+0x12>
+  return vdst;
+}
+ 44b:	89 f0                	mov    %esi,%eax
+ 44d:	5b                   	pop    %ebx
+ 44e:	5e                   	pop    %esi
+ 44f:	5d                   	pop    %ebp
+ 450:	c3                   	ret
+
+00000451 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 451:	b8 01 00 00 00       	mov    $0x1,%eax
+ 456:	cd 40                	int    $0x40
+ 458:	c3                   	ret
+
+00000459 <exit>:
+SYSCALL(exit)
+ 459:	b8 02 00 00 00       	mov    $0x2,%eax
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <wait>:
+SYSCALL(wait)
+ 461:	b8 03 00 00 00       	mov    $0x3,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <pipe>:
+SYSCALL(pipe)
+ 469:	b8 04 00 00 00       	mov    $0x4,%eax
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <read>:
+SYSCALL(read)
+ 471:	b8 05 00 00 00       	mov    $0x5,%eax
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <write>:
+SYSCALL(write)
+ 479:	b8 10 00 00 00       	mov    $0x10,%eax
+ 47e:	cd 40                	int    $0x40
+ 480:	c3                   	ret
+
+00000481 <close>:
+SYSCALL(close)
+ 481:	b8 15 00 00 00       	mov    $0x15,%eax
+ 486:	cd 40                	int    $0x40
+ 488:	c3                   	ret
+
+00000489 <kill>:
+SYSCALL(kill)
+ 489:	b8 06 00 00 00       	mov    $0x6,%eax
+ 48e:	cd 40                	int    $0x40
+ 490:	c3                   	ret
+
+00000491 <exec>:
+SYSCALL(exec)
+ 491:	b8 07 00 00 00       	mov    $0x7,%eax
+ 496:	cd 40                	int    $0x40
+ 498:	c3                   	ret
+
+00000499 <open>:
+SYSCALL(open)
+ 499:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 49e:	cd 40                	int    $0x40
+ 4a0:	c3                   	ret
+
+000004a1 <mknod>:
+SYSCALL(mknod)
+ 4a1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4a6:	cd 40                	int    $0x40
+ 4a8:	c3                   	ret
+
+000004a9 <unlink>:
+SYSCALL(unlink)
+ 4a9:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4ae:	cd 40                	int    $0x40
+ 4b0:	c3                   	ret
+
+000004b1 <fstat>:
+SYSCALL(fstat)
+ 4b1:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4b6:	cd 40                	int    $0x40
+ 4b8:	c3                   	ret
+
+000004b9 <link>:
+SYSCALL(link)
+ 4b9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4be:	cd 40                	int    $0x40
+ 4c0:	c3                   	ret
+
+000004c1 <mkdir>:
+SYSCALL(mkdir)
+ 4c1:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4c6:	cd 40                	int    $0x40
+ 4c8:	c3                   	ret
+
+000004c9 <chdir>:
+SYSCALL(chdir)
+ 4c9:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4ce:	cd 40                	int    $0x40
+ 4d0:	c3                   	ret
+
+000004d1 <dup>:
+SYSCALL(dup)
+ 4d1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4d6:	cd 40                	int    $0x40
+ 4d8:	c3                   	ret
+
+000004d9 <getpid>:
+SYSCALL(getpid)
+ 4d9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4de:	cd 40                	int    $0x40
+ 4e0:	c3                   	ret
+
+000004e1 <sbrk>:
+SYSCALL(sbrk)
+ 4e1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4e6:	cd 40                	int    $0x40
+ 4e8:	c3                   	ret
+
+000004e9 <sleep>:
+SYSCALL(sleep)
+ 4e9:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4ee:	cd 40                	int    $0x40
+ 4f0:	c3                   	ret
+
+000004f1 <uptime>:
+SYSCALL(uptime)
+ 4f1:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4f6:	cd 40                	int    $0x40
+ 4f8:	c3                   	ret
+
+000004f9 <halt>:
+SYSCALL(halt)
+ 4f9:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4fe:	cd 40                	int    $0x40
+ 500:	c3                   	ret
+
+00000501 <date>:
+SYSCALL(date)
+ 501:	b8 17 00 00 00       	mov    $0x17,%eax
+ 506:	cd 40                	int    $0x40
+ 508:	c3                   	ret
+
+00000509 <getuid>:
+SYSCALL(getuid)
+ 509:	b8 18 00 00 00       	mov    $0x18,%eax
+ 50e:	cd 40                	int    $0x40
+ 510:	c3                   	ret
+
+00000511 <getgid>:
+SYSCALL(getgid)
+ 511:	b8 19 00 00 00       	mov    $0x19,%eax
+ 516:	cd 40                	int    $0x40
+ 518:	c3                   	ret
+
+00000519 <getppid>:
+SYSCALL(getppid)
+ 519:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 51e:	cd 40                	int    $0x40
+ 520:	c3                   	ret
+
+00000521 <setuid>:
+SYSCALL(setuid)
+ 521:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 526:	cd 40                	int    $0x40
+ 528:	c3                   	ret
+
+00000529 <setgid>:
+SYSCALL(setgid)
+ 529:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 52e:	cd 40                	int    $0x40
+ 530:	c3                   	ret
+
+00000531 <getprocs>:
+SYSCALL(getprocs)
+ 531:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 536:	cd 40                	int    $0x40
+ 538:	c3                   	ret
+
+00000539 <getpriority>:
+SYSCALL(getpriority)
+ 539:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 53e:	cd 40                	int    $0x40
+ 540:	c3                   	ret
+
+00000541 <setpriority>:
+SYSCALL(setpriority)
+ 541:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 546:	cd 40                	int    $0x40
+ 548:	c3                   	ret
+
+00000549 <pipesize>:
+SYSCALL(pipesize)
+ 549:	b8 20 00 00 00       	mov    $0x20,%eax
+ 54e:	cd 40                	int    $0x40
+ 550:	c3                   	ret
+
+00000551 <splice>:
+SYSCALL(splice)
+ 551:	b8 21 00 00 00       	mov    $0x21,%eax
+ 556:	cd 40                	int    $0x40
+ 558:	c3                   	ret
+
+00000559 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 559:	55                   	push   %ebp
+ 55a:	89 e5                	mov    %esp,%ebp
+ 55c:	83 ec 1c             	sub    $0x1c,%esp
+ 55f:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 562:	6a 01                	push   $0x1
+ 564:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 567:	52                   	push   %edx
+ 568:	50                   	push   %eax
+ 569:	e8 0b ff ff ff       	call   479 <write>
+}
+ 56e:	83 c4 10             	add    $0x10,%esp
+ 571:	c9                   	leave
+ 572:	c3                   	ret
+
+00000573 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 573:	55                   	push   %ebp
+ 574:	89 e5                	mov    %esp,%ebp
+ 576:	57                   	push   %edi
+ 577:	56                   	push   %esi
+ 578:	53                   	push   %ebx
+ 579:	83 ec 2c             	sub    $0x2c,%esp
+ 57c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 57f:	89 d0                	mov    %edx,%eax
+ 581:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 583:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 587:	0f 95 c1             	setne  %cl
+ 58a:	c1 ea 1f             	shr    $0x1f,%edx
+ 58d:	84 d1                	test   %dl,%cl
+ 58f:	74 44                	je     5d5 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 591:	f7 d8                	neg    %eax
+ 593:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 595:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 59c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 5a1:	89 c8                	mov    %ecx,%eax
+ 5a3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5a8:	f7 f6                	div    %esi
+ 5aa:	89 df                	mov    %ebx,%edi
+ 5ac:	83 c3 01             	add    $0x1,%ebx
+ 5af:	0f b6 92 a4 09 00 00 	movzbl 0x9a4(%edx),%edx
+ 5b6:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 5ba:	89 ca                	mov    %ecx,%edx
+ 5bc:	89 c1                	mov    %eax,%ecx
+ 5be:	39 f2                	cmp    %esi,%edx
+ 5c0:	73 df                	jae    5a1 <printint+0x2e>
+  if(neg)
+ 5c2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 5c6:	74 31                	je     5f9 <printint+0x86>
+    buf[i++] = '-';
+ 5c8:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 5cd:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 5d0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5d3:	eb 17                	jmp    5ec <printint+0x79>
+    x = xx;
+ 5d5:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 5d7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 5de:	eb bc                	jmp    59c <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5e0:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 5e5:	89 f0                	mov    %esi,%eax
+ 5e7:	e8 6d ff ff ff       	call   559 <putc>
+  while(--i >= 0)
+ 5ec:	83 eb 01             	sub    $0x1,%ebx
+ 5ef:	79 ef                	jns    5e0 <printint+0x6d>
+}
+ 5f1:	83 c4 2c             	add    $0x2c,%esp
+ 5f4:	5b                   	pop    %ebx
+ 5f5:	5e                   	pop    %esi
+ 5f6:	5f                   	pop    %edi
+ 5f7:	5d                   	pop    %ebp
+ 5f8:	c3                   	ret
+ 5f9:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5fc:	eb ee                	jmp    5ec <printint+0x79>
+
+000005fe <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5fe:	55                   	push   %ebp
+ 5ff:	89 e5                	mov    %esp,%ebp
+ 601:	57                   	push   %edi
+ 602:	56                   	push   %esi
+ 603:	53                   	push   %ebx
+ 604:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 607:	8d 45 10             	lea    0x10(%ebp),%eax
+ 60a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 60d:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 612:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 617:	eb 14                	jmp    62d <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 619:	89 fa                	mov    %edi,%edx
+ 61b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61e:	e8 36 ff ff ff       	call   559 <putc>
+ 623:	eb 05                	jmp    62a <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 625:	83 fe 25             	cmp    $0x25,%esi
+ 628:	74 25                	je     64f <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 62a:	83 c3 01             	add    $0x1,%ebx
+ 62d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 630:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 634:	84 c0                	test   %al,%al
+ 636:	0f 84 20 01 00 00    	je     75c <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 63c:	0f be f8             	movsbl %al,%edi
+ 63f:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 642:	85 f6                	test   %esi,%esi
+ 644:	75 df                	jne    625 <printf+0x27>
+      if(c == '%'){
+ 646:	83 f8 25             	cmp    $0x25,%eax
+ 649:	75 ce                	jne    619 <printf+0x1b>
+        state = '%';
+ 64b:	89 c6                	mov    %eax,%esi
+ 64d:	eb db                	jmp    62a <printf+0x2c>
+      if(c == 'd'){
+ 64f:	83 f8 25             	cmp    $0x25,%eax
+ 652:	0f 84 cf 00 00 00    	je     727 <printf+0x129>
+ 658:	0f 8c dd 00 00 00    	jl     73b <printf+0x13d>
+ 65e:	83 f8 78             	cmp    $0x78,%eax
+ 661:	0f 8f d4 00 00 00    	jg     73b <printf+0x13d>
+ 667:	83 f8 63             	cmp    $0x63,%eax
+ 66a:	0f 8c cb 00 00 00    	jl     73b <printf+0x13d>
+ 670:	83 e8 63             	sub    $0x63,%eax
+ 673:	83 f8 15             	cmp    $0x15,%eax
+ 676:	0f 87 bf 00 00 00    	ja     73b <printf+0x13d>
+ 67c:	ff 24 85 4c 09 00 00 	jmp    *0x94c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 683:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 686:	8b 17                	mov    (%edi),%edx
+ 688:	83 ec 0c             	sub    $0xc,%esp
+ 68b:	6a 01                	push   $0x1
+ 68d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 692:	8b 45 08             	mov    0x8(%ebp),%eax
+ 695:	e8 d9 fe ff ff       	call   573 <printint>
+        ap++;
+ 69a:	83 c7 04             	add    $0x4,%edi
+ 69d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 6a0:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 6a3:	be 00 00 00 00       	mov    $0x0,%esi
+ 6a8:	eb 80                	jmp    62a <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 6aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 6ad:	8b 17                	mov    (%edi),%edx
+ 6af:	83 ec 0c             	sub    $0xc,%esp
+ 6b2:	6a 00                	push   $0x0
+ 6b4:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6bc:	e8 b2 fe ff ff       	call   573 <printint>
+        ap++;
+ 6c1:	83 c7 04             	add    $0x4,%edi
+ 6c4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 6c7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ca:	be 00 00 00 00       	mov    $0x0,%esi
+ 6cf:	e9 56 ff ff ff       	jmp    62a <printf+0x2c>
+        s = (char*)*ap;
+ 6d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6d7:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 6d9:	83 c0 04             	add    $0x4,%eax
+ 6dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 6df:	85 f6                	test   %esi,%esi
+ 6e1:	75 15                	jne    6f8 <printf+0xfa>
+          s = "(null)";
+ 6e3:	be 45 09 00 00       	mov    $0x945,%esi
+ 6e8:	eb 0e                	jmp    6f8 <printf+0xfa>
+          putc(fd, *s);
+ 6ea:	0f be d2             	movsbl %dl,%edx
+ 6ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f0:	e8 64 fe ff ff       	call   559 <putc>
+          s++;
+ 6f5:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 6f8:	0f b6 16             	movzbl (%esi),%edx
+ 6fb:	84 d2                	test   %dl,%dl
+ 6fd:	75 eb                	jne    6ea <printf+0xec>
+      state = 0;
+ 6ff:	be 00 00 00 00       	mov    $0x0,%esi
+ 704:	e9 21 ff ff ff       	jmp    62a <printf+0x2c>
+        putc(fd, *ap);
+ 709:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 70c:	0f be 17             	movsbl (%edi),%edx
+ 70f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 712:	e8 42 fe ff ff       	call   559 <putc>
+        ap++;
+ 717:	83 c7 04             	add    $0x4,%edi
+ 71a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 71d:	be 00 00 00 00       	mov    $0x0,%esi
+ 722:	e9 03 ff ff ff       	jmp    62a <printf+0x2c>
+        putc(fd, c);
+ 727:	89 fa                	mov    %edi,%edx
+ 729:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72c:	e8 28 fe ff ff       	call   559 <putc>
+      state = 0;
+ 731:	be 00 00 00 00       	mov    $0x0,%esi
+ 736:	e9 ef fe ff ff       	jmp    62a <printf+0x2c>
+        putc(fd, '%');
+ 73b:	ba 25 00 00 00       	mov    $0x25,%edx
+ 740:	8b 45 08             	mov    0x8(%ebp),%eax
+ 743:	e8 11 fe ff ff       	call   559 <putc>
+        putc(fd, c);
+ 748:	89 fa                	mov    %edi,%edx
+ 74a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74d:	e8 07 fe ff ff       	call   559 <putc>
+      state = 0;
+ 752:	be 00 00 00 00       	mov    $0x0,%esi
+ 757:	e9 ce fe ff ff       	jmp    62a <printf+0x2c>
+    }
+  }
+}
+ 75c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 75f:	5b                   	pop    %ebx
+ 760:	5e                   	pop    %esi
+ 761:	5f                   	pop    %edi
+ 762:	5d                   	pop    %ebp
+ 763:	c3                   	ret
+
+00000764 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 764:	55                   	push   %ebp
+ 765:	89 e5                	mov    %esp,%ebp
+ 767:	57                   	push   %edi
+ 768:	56                   	push   %esi
+ 769:	53                   	push   %ebx
+ 76a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 76d:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 770:	a1 a4 0c 00 00       	mov    0xca4,%eax
+ 775:	eb 02                	jmp    779 <free+0x15>
+ 777:	89 d0                	mov    %edx,%eax
+ 779:	39 c8                	cmp    %ecx,%eax
+ 77b:	73 04                	jae    781 <free+0x1d>
+ 77d:	3b 08                	cmp    (%eax),%ecx
+ 77f:	72 12                	jb     793 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 781:	8b 10                	mov    (%eax),%edx
+ 783:	39 d0                	cmp    %edx,%eax
+ 785:	72 f0                	jb     777 <free+0x13>
+ 787:	39 c8                	cmp    %ecx,%eax
+ 789:	72 08                	jb     793 <free+0x2f>
+ 78b:	39 d1                	cmp    %edx,%ecx
+ 78d:	72 04                	jb     793 <free+0x2f>
+ 78f:	89 d0                	mov    %edx,%eax
+ 791:	eb e6                	jmp    779 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 793:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 796:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 799:	8b 10                	mov    (%eax),%edx
+ 79b:	39 d7                	cmp    %edx,%edi
+ 79d:	74 19                	je     7b8 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 79f:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7a2:	8b 50 04             	mov    0x4(%eax),%edx
+ 7a5:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 7a8:	39 ce                	cmp    %ecx,%esi
+ 7aa:	74 1b                	je     7c7 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 7ac:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 7ae:	a3 a4 0c 00 00       	mov    %eax,0xca4
+}
+ 7b3:	5b                   	pop    %ebx
+ 7b4:	5e                   	pop    %esi
+ 7b5:	5f                   	pop    %edi
+ 7b6:	5d                   	pop    %ebp
+ 7b7:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 7b8:	03 72 04             	add    0x4(%edx),%esi
+ 7bb:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7be:	8b 10                	mov    (%eax),%edx
+ 7c0:	8b 12                	mov    (%edx),%edx
+ 7c2:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 7c5:	eb db                	jmp    7a2 <free+0x3e>
+    p->s.size += bp->s.size;
+ 7c7:	03 53 fc             	add    -0x4(%ebx),%edx
+ 7ca:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7cd:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 7d0:	89 10                	mov    %edx,(%eax)
+ 7d2:	eb da                	jmp    7ae <free+0x4a>
+
+000007d4 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7d4:	55                   	push   %ebp
+ 7d5:	89 e5                	mov    %esp,%ebp
+ 7d7:	53                   	push   %ebx
+ 7d8:	83 ec 04             	sub    $0x4,%esp
+ 7db:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7dd:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 7e2:	77 05                	ja     7e9 <morecore+0x15>
+    nu = 4096;
+ 7e4:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7e9:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 7f0:	83 ec 0c             	sub    $0xc,%esp
+ 7f3:	50                   	push   %eax
+ 7f4:	e8 e8 fc ff ff       	call   4e1 <sbrk>
+  if(p == (char*)-1)
+ 7f9:	83 c4 10             	add    $0x10,%esp
+ 7fc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7ff:	74 1c                	je     81d <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 801:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 804:	83 c0 08             	add    $0x8,%eax
+ 807:	83 ec 0c             	sub    $0xc,%esp
+ 80a:	50                   	push   %eax
+ 80b:	e8 54 ff ff ff       	call   764 <free>
+  return freep;
+ 810:	a1 a4 0c 00 00       	mov    0xca4,%eax
+ 815:	83 c4 10             	add    $0x10,%esp
+}
+ 818:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 81b:	c9                   	leave
+ 81c:	c3                   	ret
+    return 0;
+ 81d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 822:	eb f4                	jmp    818 <morecore+0x44>
+
+00000824 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 824:	55                   	push   %ebp
+ 825:	89 e5                	mov    %esp,%ebp
+ 827:	53                   	push   %ebx
+ 828:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 82b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 82e:	8d 58 07             	lea    0x7(%eax),%ebx
+ 831:	c1 eb 03             	shr    $0x3,%ebx
+ 834:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 837:	8b 0d a4 0c 00 00    	mov    0xca4,%ecx
+ 83d:	85 c9                	test   %ecx,%ecx
+ 83f:	74 04                	je     845 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 841:	8b 01                	mov    (%ecx),%eax
+ 843:	eb 4a                	jmp    88f <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 845:	c7 05 a4 0c 00 00 a8 	movl   $0xca8,0xca4
+ 84c:	0c 00 00 
+ 84f:	c7 05 a8 0c 00 00 a8 	movl   $0xca8,0xca8
+ 856:	0c 00 00 
+    base.s.size = 0;
+ 859:	c7 05 ac 0c 00 00 00 	movl   $0x0,0xcac
+ 860:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 863:	b9 a8 0c 00 00       	mov    $0xca8,%ecx
+ 868:	eb d7                	jmp    841 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 86a:	74 19                	je     885 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 86c:	29 da                	sub    %ebx,%edx
+ 86e:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 871:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 874:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 877:	89 0d a4 0c 00 00    	mov    %ecx,0xca4
+      return (void*)(p + 1);
+ 87d:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 880:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 883:	c9                   	leave
+ 884:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 885:	8b 10                	mov    (%eax),%edx
+ 887:	89 11                	mov    %edx,(%ecx)
+ 889:	eb ec                	jmp    877 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 88b:	89 c1                	mov    %eax,%ecx
+ 88d:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 88f:	8b 50 04             	mov    0x4(%eax),%edx
+ 892:	39 da                	cmp    %ebx,%edx
+ 894:	73 d4                	jae    86a <malloc+0x46>
+    if(p == freep)
+ 896:	39 05 a4 0c 00 00    	cmp    %eax,0xca4
+ 89c:	75 ed                	jne    88b <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 89e:	89 d8                	mov    %ebx,%eax
+ 8a0:	e8 2f ff ff ff       	call   7d4 <morecore>
+ 8a5:	85 c0                	test   %eax,%eax
+ 8a7:	75 e2                	jne    88b <malloc+0x67>
+ 8a9:	eb d5                	jmp    880 <malloc+0x5c>
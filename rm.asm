@@ -0,0 +1,1196 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 41 04             	mov    0x4(%ecx),%eax
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int i;
+
+  if(argc < 2){
+  1c:	83 ff 01             	cmp    $0x1,%edi
+  1f:	7e 07                	jle    28 <main+0x28>
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  21:	bb 01 00 00 00       	mov    $0x1,%ebx
+  26:	eb 17                	jmp    3f <main+0x3f>
+    printf(2, "Usage: rm files...\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 2c 07 00 00       	push   $0x72c
+  30:	6a 02                	push   $0x2
+  32:	e8 45 04 00 00       	call   47c <printf>
+    exit();
+  37:	e8 9b 02 00 00       	call   2d7 <exit>
+  for(i = 1; i < argc; i++){
+  3c:	83 c3 01             	add    $0x1,%ebx
+  3f:	39 fb                	cmp    %edi,%ebx
+  41:	7d 2b                	jge    6e <main+0x6e>
+    if(unlink(argv[i]) < 0){
+  43:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  46:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+  49:	83 ec 0c             	sub    $0xc,%esp
+  4c:	ff 36                	push   (%esi)
+  4e:	e8 d4 02 00 00       	call   327 <unlink>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 e2                	jns    3c <main+0x3c>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  5a:	83 ec 04             	sub    $0x4,%esp
+  5d:	ff 36                	push   (%esi)
+  5f:	68 40 07 00 00       	push   $0x740
+  64:	6a 02                	push   $0x2
+  66:	e8 11 04 00 00       	call   47c <printf>
+      break;
+  6b:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  6e:	e8 64 02 00 00       	call   2d7 <exit>
+
+00000073 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  73:	55                   	push   %ebp
+  74:	89 e5                	mov    %esp,%ebp
+  76:	56                   	push   %esi
+  77:	53                   	push   %ebx
+  78:	8b 75 08             	mov    0x8(%ebp),%esi
+  7b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  7e:	89 f0                	mov    %esi,%eax
+  80:	89 d1                	mov    %edx,%ecx
+  82:	83 c2 01             	add    $0x1,%edx
+  85:	89 c3                	mov    %eax,%ebx
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	0f b6 09             	movzbl (%ecx),%ecx
+  8d:	88 0b                	mov    %cl,(%ebx)
+  8f:	84 c9                	test   %cl,%cl
+  91:	75 ed                	jne    80 <strcpy+0xd>
+    ;
+  return os;
+}
+  93:	89 f0                	mov    %esi,%eax
+  95:	5b                   	pop    %ebx
+  96:	5e                   	pop    %esi
+  97:	5d                   	pop    %ebp
+  98:	c3                   	ret
+
+00000099 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  99:	55                   	push   %ebp
+  9a:	89 e5                	mov    %esp,%ebp
+  9c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  a2:	eb 06                	jmp    aa <strcmp+0x11>
+    p++, q++;
+  a4:	83 c1 01             	add    $0x1,%ecx
+  a7:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  aa:	0f b6 01             	movzbl (%ecx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	74 04                	je     b5 <strcmp+0x1c>
+  b1:	3a 02                	cmp    (%edx),%al
+  b3:	74 ef                	je     a4 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+  b5:	0f b6 c0             	movzbl %al,%eax
+  b8:	0f b6 12             	movzbl (%edx),%edx
+  bb:	29 d0                	sub    %edx,%eax
+}
+  bd:	5d                   	pop    %ebp
+  be:	c3                   	ret
+
+000000bf <strlen>:
+
+uint
+strlen(char *s)
+{
+  bf:	55                   	push   %ebp
+  c0:	89 e5                	mov    %esp,%ebp
+  c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  ca:	eb 03                	jmp    cf <strlen+0x10>
+  cc:	83 c0 01             	add    $0x1,%eax
+  cf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d3:	75 f7                	jne    cc <strlen+0xd>
+    ;
+  return n;
+}
+  d5:	5d                   	pop    %ebp
+  d6:	c3                   	ret
+
+000000d7 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  d7:	55                   	push   %ebp
+  d8:	89 e5                	mov    %esp,%ebp
+  da:	57                   	push   %edi
+  db:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  de:	89 d7                	mov    %edx,%edi
+  e0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e6:	fc                   	cld
+  e7:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  e9:	89 d0                	mov    %edx,%eax
+  eb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  ee:	c9                   	leave
+  ef:	c3                   	ret
+
+000000f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  fa:	eb 03                	jmp    ff <strchr+0xf>
+  fc:	83 c0 01             	add    $0x1,%eax
+  ff:	0f b6 10             	movzbl (%eax),%edx
+ 102:	84 d2                	test   %dl,%dl
+ 104:	74 06                	je     10c <strchr+0x1c>
+    if(*s == c)
+ 106:	38 ca                	cmp    %cl,%dl
+ 108:	75 f2                	jne    fc <strchr+0xc>
+ 10a:	eb 05                	jmp    111 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 10c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 111:	5d                   	pop    %ebp
+ 112:	c3                   	ret
+
+00000113 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 113:	55                   	push   %ebp
+ 114:	89 e5                	mov    %esp,%ebp
+ 116:	57                   	push   %edi
+ 117:	56                   	push   %esi
+ 118:	53                   	push   %ebx
+ 119:	83 ec 1c             	sub    $0x1c,%esp
+ 11c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 11f:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 124:	89 de                	mov    %ebx,%esi
+ 126:	83 c3 01             	add    $0x1,%ebx
+ 129:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 12c:	7d 2e                	jge    15c <gets+0x49>
+    cc = read(0, &c, 1);
+ 12e:	83 ec 04             	sub    $0x4,%esp
+ 131:	6a 01                	push   $0x1
+ 133:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 136:	50                   	push   %eax
+ 137:	6a 00                	push   $0x0
+ 139:	e8 b1 01 00 00       	call   2ef <read>
+    if(cc < 1)
+ 13e:	83 c4 10             	add    $0x10,%esp
+ 141:	85 c0                	test   %eax,%eax
+ 143:	7e 17                	jle    15c <gets+0x49>
+      break;
+    buf[i++] = c;
+ 145:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 149:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 14c:	3c 0a                	cmp    $0xa,%al
+ 14e:	0f 94 c2             	sete   %dl
+ 151:	3c 0d                	cmp    $0xd,%al
+ 153:	0f 94 c0             	sete   %al
+ 156:	08 c2                	or     %al,%dl
+ 158:	74 ca                	je     124 <gets+0x11>
+    buf[i++] = c;
+ 15a:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 15c:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 160:	89 f8                	mov    %edi,%eax
+ 162:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 165:	5b                   	pop    %ebx
+ 166:	5e                   	pop    %esi
+ 167:	5f                   	pop    %edi
+ 168:	5d                   	pop    %ebp
+ 169:	c3                   	ret
+
+0000016a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 16a:	55                   	push   %ebp
+ 16b:	89 e5                	mov    %esp,%ebp
+ 16d:	56                   	push   %esi
+ 16e:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 16f:	83 ec 08             	sub    $0x8,%esp
+ 172:	6a 00                	push   $0x0
+ 174:	ff 75 08             	push   0x8(%ebp)
+ 177:	e8 9b 01 00 00       	call   317 <open>
+  if(fd < 0)
+ 17c:	83 c4 10             	add    $0x10,%esp
+ 17f:	85 c0                	test   %eax,%eax
+ 181:	78 24                	js     1a7 <stat+0x3d>
+ 183:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 185:	83 ec 08             	sub    $0x8,%esp
+ 188:	ff 75 0c             	push   0xc(%ebp)
+ 18b:	50                   	push   %eax
+ 18c:	e8 9e 01 00 00       	call   32f <fstat>
+ 191:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 193:	89 1c 24             	mov    %ebx,(%esp)
+ 196:	e8 64 01 00 00       	call   2ff <close>
+  return r;
+ 19b:	83 c4 10             	add    $0x10,%esp
+}
+ 19e:	89 f0                	mov    %esi,%eax
+ 1a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1a3:	5b                   	pop    %ebx
+ 1a4:	5e                   	pop    %esi
+ 1a5:	5d                   	pop    %ebp
+ 1a6:	c3                   	ret
+    return -1;
+ 1a7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1ac:	eb f0                	jmp    19e <stat+0x34>
+
+000001ae <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 1ae:	55                   	push   %ebp
+ 1af:	89 e5                	mov    %esp,%ebp
+ 1b1:	56                   	push   %esi
+ 1b2:	53                   	push   %ebx
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1b6:	eb 03                	jmp    1bb <atoi+0xd>
+ 1b8:	83 c2 01             	add    $0x1,%edx
+ 1bb:	0f b6 02             	movzbl (%edx),%eax
+ 1be:	3c 20                	cmp    $0x20,%al
+ 1c0:	74 f6                	je     1b8 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 1c2:	3c 2d                	cmp    $0x2d,%al
+ 1c4:	74 1d                	je     1e3 <atoi+0x35>
+ 1c6:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1cb:	3c 2b                	cmp    $0x2b,%al
+ 1cd:	0f 94 c1             	sete   %cl
+ 1d0:	3c 2d                	cmp    $0x2d,%al
+ 1d2:	0f 94 c0             	sete   %al
+ 1d5:	08 c1                	or     %al,%cl
+ 1d7:	74 03                	je     1dc <atoi+0x2e>
+    s++;
+ 1d9:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 1dc:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1e1:	eb 17                	jmp    1fa <atoi+0x4c>
+ 1e3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1e8:	eb e1                	jmp    1cb <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 1ea:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 1ed:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 1f0:	83 c2 01             	add    $0x1,%edx
+ 1f3:	0f be c9             	movsbl %cl,%ecx
+ 1f6:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 1fa:	0f b6 0a             	movzbl (%edx),%ecx
+ 1fd:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 200:	80 fb 09             	cmp    $0x9,%bl
+ 203:	76 e5                	jbe    1ea <atoi+0x3c>
+  return sign*n;
+ 205:	0f af c6             	imul   %esi,%eax
+}
+ 208:	5b                   	pop    %ebx
+ 209:	5e                   	pop    %esi
+ 20a:	5d                   	pop    %ebp
+ 20b:	c3                   	ret
+
+0000020c <atoo>:
+
+int
+atoo(const char *s)
+{
+ 20c:	55                   	push   %ebp
+ 20d:	89 e5                	mov    %esp,%ebp
+ 20f:	56                   	push   %esi
+ 210:	53                   	push   %ebx
+ 211:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 214:	eb 03                	jmp    219 <atoo+0xd>
+ 216:	83 c2 01             	add    $0x1,%edx
+ 219:	0f b6 02             	movzbl (%edx),%eax
+ 21c:	3c 20                	cmp    $0x20,%al
+ 21e:	74 f6                	je     216 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 220:	3c 2d                	cmp    $0x2d,%al
+ 222:	74 1d                	je     241 <atoo+0x35>
+ 224:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 229:	3c 2b                	cmp    $0x2b,%al
+ 22b:	0f 94 c1             	sete   %cl
+ 22e:	3c 2d                	cmp    $0x2d,%al
+ 230:	0f 94 c0             	sete   %al
+ 233:	08 c1                	or     %al,%cl
+ 235:	74 03                	je     23a <atoo+0x2e>
+    s++;
+ 237:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 23a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 23f:	eb 11                	jmp    252 <atoo+0x46>
+ 241:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 246:	eb e1                	jmp    229 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 248:	83 c2 01             	add    $0x1,%edx
+ 24b:	0f be c9             	movsbl %cl,%ecx
+ 24e:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 252:	0f b6 0a             	movzbl (%edx),%ecx
+ 255:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 258:	80 fb 07             	cmp    $0x7,%bl
+ 25b:	76 eb                	jbe    248 <atoo+0x3c>
+  return sign*n;
+ 25d:	0f af c6             	imul   %esi,%eax
+}
+ 260:	5b                   	pop    %ebx
+ 261:	5e                   	pop    %esi
+ 262:	5d                   	pop    %ebp
+ 263:	c3                   	ret
+
+00000264 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 264:	55                   	push   %ebp
+ 265:	89 e5                	mov    %esp,%ebp
+ 267:	53                   	push   %ebx
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 26e:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 271:	eb 09                	jmp    27c <strncmp+0x18>
+      n--, p++, q++;
+ 273:	83 e8 01             	sub    $0x1,%eax
+ 276:	83 c2 01             	add    $0x1,%edx
+ 279:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 27c:	85 c0                	test   %eax,%eax
+ 27e:	74 0b                	je     28b <strncmp+0x27>
+ 280:	0f b6 1a             	movzbl (%edx),%ebx
+ 283:	84 db                	test   %bl,%bl
+ 285:	74 04                	je     28b <strncmp+0x27>
+ 287:	3a 19                	cmp    (%ecx),%bl
+ 289:	74 e8                	je     273 <strncmp+0xf>
+    if(n == 0)
+ 28b:	85 c0                	test   %eax,%eax
+ 28d:	74 0d                	je     29c <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 28f:	0f b6 02             	movzbl (%edx),%eax
+ 292:	0f b6 11             	movzbl (%ecx),%edx
+ 295:	29 d0                	sub    %edx,%eax
+}
+ 297:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 29a:	c9                   	leave
+ 29b:	c3                   	ret
+      return 0;
+ 29c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2a1:	eb f4                	jmp    297 <strncmp+0x33>
+
+000002a3 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2a3:	55                   	push   %ebp
+ 2a4:	89 e5                	mov    %esp,%ebp
+ 2a6:	56                   	push   %esi
+ 2a7:	53                   	push   %ebx
+ 2a8:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 2ae:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 2b1:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 2b3:	eb 0d                	jmp    2c2 <memmove+0x1f>
+    *dst++ = *src++;
+ 2b5:	0f b6 01             	movzbl (%ecx),%eax
+ 2b8:	88 02                	mov    %al,(%edx)
+ 2ba:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 2bd:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 2c0:	89 d8                	mov    %ebx,%eax
+ 2c2:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 2c5:	85 c0                	test   %eax,%eax
+ 2c7:	7f ec                	jg     2b5 <memmove+0x12>
+  return vdst;
+}
+ 2c9:	89 f0                	mov    %esi,%eax
+ 2cb:	5b                   	pop    %ebx
+ 2cc:	5e                   	pop    %esi
+ 2cd:	5d                   	pop    %ebp
+ 2ce:	c3                   	ret
+
+000002cf <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2cf:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2d4:	cd 40                	int    $0x40
+ 2d6:	c3                   	ret
+
+000002d7 <exit>:
+SYSCALL(exit)
+ 2d7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2dc:	cd 40                	int    $0x40
+ 2de:	c3                   	ret
+
+000002df <wait>:
+SYSCALL(wait)
+ 2df:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2e4:	cd 40                	int    $0x40
+ 2e6:	c3                   	ret
+
+000002e7 <pipe>:
+SYSCALL(pipe)
+ 2e7:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2ec:	cd 40                	int    $0x40
+ 2ee:	c3                   	ret
+
+000002ef <read>:
+SYSCALL(read)
+ 2ef:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2f4:	cd 40                	int    $0x40
+ 2f6:	c3                   	ret
+
+000002f7 <write>:
+SYSCALL(write)
+ 2f7:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2fc:	cd 40                	int    $0x40
+ 2fe:	c3                   	ret
+
+000002ff <close>:
+SYSCALL(close)
+ 2ff:	b8 15 00 00 00       	mov    $0x15,%eax
+ 304:	cd 40                	int    $0x40
+ 306:	c3                   	ret
+
+00000307 <kill>:
+SYSCALL(kill)
+ 307:	b8 06 00 00 00       	mov    $0x6,%eax
+ 30c:	cd 40                	int    $0x40
+ 30e:	c3                   	ret
+
+0000030f <exec>:
+SYSCALL(exec)
+ 30f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 314:	cd 40                	int    $0x40
+ 316:	c3                   	ret
+
+00000317 <open>:
+SYSCALL(open)
+ 317:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 31c:	cd 40                	int    $0x40
+ 31e:	c3                   	ret
+
+0000031f <mknod>:
+SYSCALL(mknod)
+ 31f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 324:	cd 40                	int    $0x40
+ 326:	c3                   	ret
+
+00000327 <unlink>:
+SYSCALL(unlink)
+ 327:	b8 12 00 00 00       	mov    $0x12,%eax
+ 32c:	cd 40                	int    $0x40
+ 32e:	c3                   	ret
+
+0000032f <fstat>:
+SYSCALL(fstat)
+ 32f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 334:	cd 40                	int    $0x40
+ 336:	c3                   	ret
+
+00000337 <link>:
+SYSCALL(link)
+ 337:	b8 13 00 00 00       	mov    $0x13,%eax
+ 33c:	cd 40                	int    $0x40
+ 33e:	c3                   	ret
+
+0000033f <mkdir>:
+SYSCALL(mkdir)
+ 33f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 344:	cd 40                	int    $0x40
+ 346:	c3                   	ret
+
+00000347 <chdir>:
+SYSCALL(chdir)
+ 347:	b8 09 00 00 00       	mov    $0x9,%eax
+ 34c:	cd 40                	int    $0x40
+ 34e:	c3                   	ret
+
+0000034f <dup>:
+SYSCALL(dup)
+ 34f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 354:	cd 40                	int    $0x40
+ 356:	c3                   	ret
+
+00000357 <getpid>:
+SYSCALL(getpid)
+ 357:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 35c:	cd 40                	int    $0x40
+ 35e:	c3                   	ret
+
+0000035f <sbrk>:
+SYSCALL(sbrk)
+ 35f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 364:	cd 40                	int    $0x40
+ 366:	c3                   	ret
+
+00000367 <sleep>:
+SYSCALL(sleep)
+ 367:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 36c:	cd 40                	int    $0x40
+ 36e:	c3                   	ret
+
+0000036f <uptime>:
+SYSCALL(uptime)
+ 36f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 374:	cd 40                	int    $0x40
+ 376:	c3                   	ret
+
+00000377 <halt>:
+SYSCALL(halt)
+ 377:	b8 16 00 00 00       	mov    $0x16,%eax
+ 37c:	cd 40                	int    $0x40
+ 37e:	c3                   	ret
+
+0000037f <date>:
+SYSCALL(date)
+ 37f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 384:	cd 40                	int    $0x40
+ 386:	c3                   	ret
+
+00000387 <getuid>:
+SYSCALL(getuid)
+ 387:	b8 18 00 00 00       	mov    $0x18,%eax
+ 38c:	cd 40                	int    $0x40
+ 38e:	c3                   	ret
+
+0000038f <getgid>:
+SYSCALL(getgid)
+ 38f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 394:	cd 40                	int    $0x40
+ 396:	c3                   	ret
+
+00000397 <getppid>:
+SYSCALL(getppid)
+ 397:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 39c:	cd 40                	int    $0x40
+ 39e:	c3                   	ret
+
+0000039f <setuid>:
+SYSCALL(setuid)
+ 39f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3a4:	cd 40                	int    $0x40
+ 3a6:	c3                   	ret
+
+000003a7 <setgid>:
+SYSCALL(setgid)
+ 3a7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3ac:	cd 40                	int    $0x40
+ 3ae:	c3                   	ret
+
+000003af <getprocs>:
+SYSCALL(getprocs)
+ 3af:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3b4:	cd 40                	int    $0x40
+ 3b6:	c3                   	ret
+
+000003b7 <getpriority>:
+SYSCALL(getpriority)
+ 3b7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <setpriority>:
+SYSCALL(setpriority)
+ 3bf:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3c4:	cd 40                	int    $0x40
+ 3c6:	c3                   	ret
+
+000003c7 <pipesize>:
+SYSCALL(pipesize)
+ 3c7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3cc:	cd 40                	int    $0x40
+ 3ce:	c3                   	ret
+
+000003cf <splice>:
+SYSCALL(splice)
+ 3cf:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3d4:	cd 40                	int    $0x40
+ 3d6:	c3                   	ret
+
+000003d7 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3d7:	55                   	push   %ebp
+ 3d8:	89 e5                	mov    %esp,%ebp
+ 3da:	83 ec 1c             	sub    $0x1c,%esp
+ 3dd:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3e0:	6a 01                	push   $0x1
+ 3e2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3e5:	52                   	push   %edx
+ 3e6:	50                   	push   %eax
+ 3e7:	e8 0b ff ff ff       	call   2f7 <write>
+}
+ 3ec:	83 c4 10             	add    $0x10,%esp
+ 3ef:	c9                   	leave
+ 3f0:	c3                   	ret
+
+000003f1 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3f1:	55                   	push   %ebp
+ 3f2:	89 e5                	mov    %esp,%ebp
+ 3f4:	57                   	push   %edi
+ 3f5:	56                   	push   %esi
+ 3f6:	53                   	push   %ebx
+ 3f7:	83 ec 2c             	sub    $0x2c,%esp
+ 3fa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3fd:	89 d0                	mov    %edx,%eax
+ 3ff:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 401:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 405:	0f 95 c1             	setne  %cl
+ 408:	c1 ea 1f             	shr    $0x1f,%edx
+ 40b:	84 d1                	test   %dl,%cl
+ 40d:	74 44                	je     453 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 40f:	f7 d8                	neg    %eax
+ 411:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 413:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 41a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 41f:	89 c8                	mov    %ecx,%eax
+ 421:	ba 00 00 00 00       	mov    $0x0,%edx
+ 426:	f7 f6                	div    %esi
+ 428:	89 df                	mov    %ebx,%edi
+ 42a:	83 c3 01             	add    $0x1,%ebx
+ 42d:	0f b6 92 b8 07 00 00 	movzbl 0x7b8(%edx),%edx
+ 434:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 438:	89 ca                	mov    %ecx,%edx
+ 43a:	89 c1                	mov    %eax,%ecx
+ 43c:	39 f2                	cmp    %esi,%edx
+ 43e:	73 df                	jae    41f <printint+0x2e>
+  if(neg)
+ 440:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 444:	74 31                	je     477 <printint+0x86>
+    buf[i++] = '-';
+ 446:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 44b:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 44e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 451:	eb 17                	jmp    46a <printint+0x79>
+    x = xx;
+ 453:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 455:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 45c:	eb bc                	jmp    41a <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 45e:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 463:	89 f0                	mov    %esi,%eax
+ 465:	e8 6d ff ff ff       	call   3d7 <putc>
+  while(--i >= 0)
+ 46a:	83 eb 01             	sub    $0x1,%ebx
+ 46d:	79 ef                	jns    45e <printint+0x6d>
+}
+ 46f:	83 c4 2c             	add    $0x2c,%esp
+ 472:	5b                   	pop    %ebx
+ 473:	5e                   	pop    %esi
+ 474:	5f                   	pop    %edi
+ 475:	5d                   	pop    %ebp
+ 476:	c3                   	ret
+ 477:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 47a:	eb ee                	jmp    46a <printint+0x79>
+
+0000047c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 47c:	55                   	push   %ebp
+ 47d:	89 e5                	mov    %esp,%ebp
+ 47f:	57                   	push   %edi
+ 480:	56                   	push   %esi
+ 481:	53                   	push   %ebx
+ 482:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 485:	8d 45 10             	lea    0x10(%ebp),%eax
+ 488:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 48b:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 490:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 495:	eb 14                	jmp    4ab <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 497:	89 fa                	mov    %edi,%edx
+ 499:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49c:	e8 36 ff ff ff       	call   3d7 <putc>
+ 4a1:	eb 05                	jmp    4a8 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 4a3:	83 fe 25             	cmp    $0x25,%esi
+ 4a6:	74 25                	je     4cd <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 4a8:	83 c3 01             	add    $0x1,%ebx
+ 4ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4ae:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 4b2:	84 c0                	test   %al,%al
+ 4b4:	0f 84 20 01 00 00    	je     5da <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 4ba:	0f be f8             	movsbl %al,%edi
+ 4bd:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 4c0:	85 f6                	test   %esi,%esi
+ 4c2:	75 df                	jne    4a3 <printf+0x27>
+      if(c == '%'){
+ 4c4:	83 f8 25             	cmp    $0x25,%eax
+ 4c7:	75 ce                	jne    497 <printf+0x1b>
+        state = '%';
+ 4c9:	89 c6                	mov    %eax,%esi
+ 4cb:	eb db                	jmp    4a8 <printf+0x2c>
+      if(c == 'd'){
+ 4cd:	83 f8 25             	cmp    $0x25,%eax
+ 4d0:	0f 84 cf 00 00 00    	je     5a5 <printf+0x129>
+ 4d6:	0f 8c dd 00 00 00    	jl     5b9 <printf+0x13d>
+ 4dc:	83 f8 78             	cmp    $0x78,%eax
+ 4df:	0f 8f d4 00 00 00    	jg     5b9 <printf+0x13d>
+ 4e5:	83 f8 63             	cmp    $0x63,%eax
+ 4e8:	0f 8c cb 00 00 00    	jl     5b9 <printf+0x13d>
+ 4ee:	83 e8 63             	sub    $0x63,%eax
+ 4f1:	83 f8 15             	cmp    $0x15,%eax
+ 4f4:	0f 87 bf 00 00 00    	ja     5b9 <printf+0x13d>
+ 4fa:	ff 24 85 60 07 00 00 	jmp    *0x760(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 501:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 504:	8b 17                	mov    (%edi),%edx
+ 506:	83 ec 0c             	sub    $0xc,%esp
+ 509:	6a 01                	push   $0x1
+ 50b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 510:	8b 45 08             	mov    0x8(%ebp),%eax
+ 513:	e8 d9 fe ff ff       	call   3f1 <printint>
+        ap++;
+ 518:	83 c7 04             	add    $0x4,%edi
+ 51b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 51e:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 521:	be 00 00 00 00       	mov    $0x0,%esi
+ 526:	eb 80                	jmp    4a8 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 528:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 52b:	8b 17                	mov    (%edi),%edx
+ 52d:	83 ec 0c             	sub    $0xc,%esp
+ 530:	6a 00                	push   $0x0
+ 532:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 537:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53a:	e8 b2 fe ff ff       	call   3f1 <printint>
+        ap++;
+ 53f:	83 c7 04             	add    $0x4,%edi
+ 542:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 545:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 548:	be 00 00 00 00       	mov    $0x0,%esi
+ 54d:	e9 56 ff ff ff       	jmp    4a8 <printf+0x2c>
+        s = (char*)*ap;
+ 552:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 555:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 557:	83 c0 04             	add    $0x4,%eax
+ 55a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 55d:	85 f6                	test   %esi,%esi
+ 55f:	75 15                	jne    576 <printf+0xfa>
+          s = "(null)";
+ 561:	be 59 07 00 00       	mov    $0x759,%esi
+ 566:	eb 0e                	jmp    576 <printf+0xfa>
+          putc(fd, *s);
+ 568:	0f be d2             	movsbl %dl,%edx
+ 56b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56e:	e8 64 fe ff ff       	call   3d7 <putc>
+          s++;
+ 573:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 576:	0f b6 16             	movzbl (%esi),%edx
+ 579:	84 d2                	test   %dl,%dl
+ 57b:	75 eb                	jne    568 <printf+0xec>
+      state = 0;
+ 57d:	be 00 00 00 00       	mov    $0x0,%esi
+ 582:	e9 21 ff ff ff       	jmp    4a8 <printf+0x2c>
+        putc(fd, *ap);
+ 587:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 58a:	0f be 17             	movsbl (%edi),%edx
+ 58d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 590:	e8 42 fe ff ff       	call   3d7 <putc>
+        ap++;
+ 595:	83 c7 04             	add    $0x4,%edi
+ 598:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 59b:	be 00 00 00 00       	mov    $0x0,%esi
+ 5a0:	e9 03 ff ff ff       	jmp    4a8 <printf+0x2c>
+        putc(fd, c);
+ 5a5:	89 fa                	mov    %edi,%edx
+ 5a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5aa:	e8 28 fe ff ff       	call   3d7 <putc>
+      state = 0;
+ 5af:	be 00 00 00 00       	mov    $0x0,%esi
+ 5b4:	e9 ef fe ff ff       	jmp    4a8 <printf+0x2c>
+        putc(fd, '%');
+ 5b9:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c1:	e8 11 fe ff ff       	call   3d7 <putc>
+        putc(fd, c);
+ 5c6:	89 fa                	mov    %edi,%edx
+ 5c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cb:	e8 07 fe ff ff       	call   3d7 <putc>
+      state = 0;
+ 5d0:	be 00 00 00 00       	mov    $0x0,%esi
+ 5d5:	e9 ce fe ff ff       	jmp    4a8 <printf+0x2c>
+    }
+  }
+}
+ 5da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dd:	5b                   	pop    %ebx
+ 5de:	5e                   	pop    %esi
+ 5df:	5f                   	pop    %edi
+ 5e0:	5d                   	pop    %ebp
+ 5e1:	c3                   	ret
+
+000005e2 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5e2:	55                   	push   %ebp
+ 5e3:	89 e5                	mov    %esp,%ebp
+ 5e5:	57                   	push   %edi
+ 5e6:	56                   	push   %esi
+ 5e7:	53                   	push   %ebx
+ 5e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5eb:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5ee:	a1 b8 0a 00 00       	mov    0xab8,%eax
+ 5f3:	eb 02                	jmp    5f7 <free+0x15>
+ 5f5:	89 d0                	mov    %edx,%eax
+ 5f7:	39 c8                	cmp    %ecx,%eax
+ 5f9:	73 04                	jae    5ff <free+0x1d>
+ 5fb:	3b 08                	cmp    (%eax),%ecx
+ 5fd:	72 12                	jb     611 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5ff:	8b 10                	mov    (%eax),%edx
+ 601:	39 d0                	cmp    %edx,%eax
+ 603:	72 f0                	jb     5f5 <free+0x13>
+ 605:	39 c8                	cmp    %ecx,%eax
+ 607:	72 08                	jb     611 <free+0x2f>
+ 609:	39 d1                	cmp    %edx,%ecx
+ 60b:	72 04                	jb     611 <free+0x2f>
+ 60d:	89 d0                	mov    %edx,%eax
+ 60f:	eb e6                	jmp    5f7 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 611:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 614:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 617:	8b 10                	mov    (%eax),%edx
+ 619:	39 d7                	cmp    %edx,%edi
+ 61b:	74 19                	je     636 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 61d:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 620:	8b 50 04             	mov    0x4(%eax),%edx
+ 623:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 626:	39 ce                	cmp    %ecx,%esi
+ 628:	74 1b                	je     645 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 62a:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 62c:	a3 b8 0a 00 00       	mov    %eax,0xab8
+}
+ 631:	5b                   	pop    %ebx
+ 632:	5e                   	pop    %esi
+ 633:	5f                   	pop    %edi
+ 634:	5d                   	pop    %ebp
+ 635:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 636:	03 72 04             	add    0x4(%edx),%esi
+ 639:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 63c:	8b 10                	mov    (%eax),%edx
+ 63e:	8b 12                	mov    (%edx),%edx
+ 640:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 643:	eb db                	jmp    620 <free+0x3e>
+    p->s.size += bp->s.size;
+ 645:	03 53 fc             	add    -0x4(%ebx),%edx
+ 648:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 64b:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 64e:	89 10                	mov    %edx,(%eax)
+ 650:	eb da                	jmp    62c <free+0x4a>
+
+00000652 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 652:	55                   	push   %ebp
+ 653:	89 e5                	mov    %esp,%ebp
+ 655:	53                   	push   %ebx
+ 656:	83 ec 04             	sub    $0x4,%esp
+ 659:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 65b:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 660:	77 05                	ja     667 <morecore+0x15>
+    nu = 4096;
+ 662:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 667:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 66e:	83 ec 0c             	sub    $0xc,%esp
+ 671:	50                   	push   %eax
+ 672:	e8 e8 fc ff ff       	call   35f <sbrk>
+  if(p == (char*)-1)
+ 677:	83 c4 10             	add    $0x10,%esp
+ 67a:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 67d:	74 1c                	je     69b <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 67f:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 682:	83 c0 08             	add    $0x8,%eax
+ 685:	83 ec 0c             	sub    $0xc,%esp
+ 688:	50                   	push   %eax
+ 689:	e8 54 ff ff ff       	call   5e2 <free>
+  return freep;
+ 68e:	a1 b8 0a 00 00       	mov    0xab8,%eax
+ 693:	83 c4 10             	add    $0x10,%esp
+}
+ 696:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 699:	c9                   	leave
+ 69a:	c3                   	ret
+    return 0;
+ 69b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 6a0:	eb f4                	jmp    696 <morecore+0x44>
+
+000006a2 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 6a2:	55                   	push   %ebp
+ 6a3:	89 e5                	mov    %esp,%ebp
+ 6a5:	53                   	push   %ebx
+ 6a6:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ac:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6af:	c1 eb 03             	shr    $0x3,%ebx
+ 6b2:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6b5:	8b 0d b8 0a 00 00    	mov    0xab8,%ecx
+ 6bb:	85 c9                	test   %ecx,%ecx
+ 6bd:	74 04                	je     6c3 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6bf:	8b 01                	mov    (%ecx),%eax
+ 6c1:	eb 4a                	jmp    70d <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 6c3:	c7 05 b8 0a 00 00 bc 	movl   $0xabc,0xab8
+ 6ca:	0a 00 00 
+ 6cd:	c7 05 bc 0a 00 00 bc 	movl   $0xabc,0xabc
+ 6d4:	0a 00 00 
+    base.s.size = 0;
+ 6d7:	c7 05 c0 0a 00 00 00 	movl   $0x0,0xac0
+ 6de:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 6e1:	b9 bc 0a 00 00       	mov    $0xabc,%ecx
+ 6e6:	eb d7                	jmp    6bf <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 6e8:	74 19                	je     703 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6ea:	29 da                	sub    %ebx,%edx
+ 6ec:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 6ef:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 6f2:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6f5:	89 0d b8 0a 00 00    	mov    %ecx,0xab8
+      return (void*)(p + 1);
+ 6fb:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 701:	c9                   	leave
+ 702:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 703:	8b 10                	mov    (%eax),%edx
+ 705:	89 11                	mov    %edx,(%ecx)
+ 707:	eb ec                	jmp    6f5 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 709:	89 c1                	mov    %eax,%ecx
+ 70b:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 70d:	8b 50 04             	mov    0x4(%eax),%edx
+ 710:	39 da                	cmp    %ebx,%edx
+ 712:	73 d4                	jae    6e8 <malloc+0x46>
+    if(p == freep)
+ 714:	39 05 b8 0a 00 00    	cmp    %eax,0xab8
+ 71a:	75 ed                	jne    709 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 71c:	89 d8                	mov    %ebx,%eax
+ 71e:	e8 2f ff ff ff       	call   652 <morecore>
+ 723:	85 c0                	test   %eax,%eax
+ 725:	75 e2                	jne    709 <malloc+0x67>
+ 727:	eb d5                	jmp    6fe <malloc+0x5c>
@@ -0,0 +1,2714 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <setbuiltin>:
+
+#ifdef USE_BUILTINS
+// ***** processing for shell builtins begins here *****
+int
+setbuiltin(char *p)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	53                   	push   %ebx
+       4:	83 ec 10             	sub    $0x10,%esp
+  int i;
+  int rc;
+
+  p += strlen("_set");
+       7:	68 e4 12 00 00       	push   $0x12e4
+       c:	e8 67 0c 00 00       	call   c78 <strlen>
+      11:	03 45 08             	add    0x8(%ebp),%eax
+      14:	89 c3                	mov    %eax,%ebx
+  while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+      16:	83 c4 10             	add    $0x10,%esp
+      19:	eb 03                	jmp    1e <setbuiltin+0x1e>
+      1b:	83 c3 01             	add    $0x1,%ebx
+      1e:	83 ec 04             	sub    $0x4,%esp
+      21:	6a 01                	push   $0x1
+      23:	68 2b 13 00 00       	push   $0x132b
+      28:	53                   	push   %ebx
+      29:	e8 ef 0d 00 00       	call   e1d <strncmp>
+      2e:	83 c4 10             	add    $0x10,%esp
+      31:	85 c0                	test   %eax,%eax
+      33:	74 e6                	je     1b <setbuiltin+0x1b>
+  if (strncmp("uid", p, 3) == 0) {
+      35:	83 ec 04             	sub    $0x4,%esp
+      38:	6a 03                	push   $0x3
+      3a:	53                   	push   %ebx
+      3b:	68 e9 12 00 00       	push   $0x12e9
+      40:	e8 d8 0d 00 00       	call   e1d <strncmp>
+      45:	83 c4 10             	add    $0x10,%esp
+      48:	85 c0                	test   %eax,%eax
+      4a:	75 4b                	jne    97 <setbuiltin+0x97>
+    p += strlen("uid");
+      4c:	83 ec 0c             	sub    $0xc,%esp
+      4f:	68 e9 12 00 00       	push   $0x12e9
+      54:	e8 1f 0c 00 00       	call   c78 <strlen>
+      59:	01 c3                	add    %eax,%ebx
+    while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+      5b:	83 c4 10             	add    $0x10,%esp
+      5e:	83 ec 04             	sub    $0x4,%esp
+      61:	6a 01                	push   $0x1
+      63:	68 2b 13 00 00       	push   $0x132b
+      68:	53                   	push   %ebx
+      69:	e8 af 0d 00 00       	call   e1d <strncmp>
+      6e:	83 c4 10             	add    $0x10,%esp
+      71:	85 c0                	test   %eax,%eax
+      73:	75 05                	jne    7a <setbuiltin+0x7a>
+      75:	83 c3 01             	add    $0x1,%ebx
+      78:	eb e4                	jmp    5e <setbuiltin+0x5e>
+    i = atoi(p);
+      7a:	83 ec 0c             	sub    $0xc,%esp
+      7d:	53                   	push   %ebx
+      7e:	e8 e4 0c 00 00       	call   d67 <atoi>
+    rc = (setuid(i));
+      83:	89 04 24             	mov    %eax,(%esp)
+      86:	e8 cd 0e 00 00       	call   f58 <setuid>
+    if (rc == 0)
+      8b:	83 c4 10             	add    $0x10,%esp
+      8e:	85 c0                	test   %eax,%eax
+      90:	75 62                	jne    f4 <setbuiltin+0xf4>
+    if (rc == 0)
+      return 0;
+  }
+  printf(2, "Invalid _set parameter\n");
+  return -1;
+}
+      92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      95:	c9                   	leave
+      96:	c3                   	ret
+  if (strncmp("gid", p, 3) == 0) {
+      97:	83 ec 04             	sub    $0x4,%esp
+      9a:	6a 03                	push   $0x3
+      9c:	53                   	push   %ebx
+      9d:	68 ed 12 00 00       	push   $0x12ed
+      a2:	e8 76 0d 00 00       	call   e1d <strncmp>
+      a7:	83 c4 10             	add    $0x10,%esp
+      aa:	85 c0                	test   %eax,%eax
+      ac:	75 46                	jne    f4 <setbuiltin+0xf4>
+    p += strlen("gid");
+      ae:	83 ec 0c             	sub    $0xc,%esp
+      b1:	68 ed 12 00 00       	push   $0x12ed
+      b6:	e8 bd 0b 00 00       	call   c78 <strlen>
+      bb:	01 c3                	add    %eax,%ebx
+    while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+      bd:	83 c4 10             	add    $0x10,%esp
+      c0:	eb 03                	jmp    c5 <setbuiltin+0xc5>
+      c2:	83 c3 01             	add    $0x1,%ebx
+      c5:	83 ec 04             	sub    $0x4,%esp
+      c8:	6a 01                	push   $0x1
+      ca:	68 2b 13 00 00       	push   $0x132b
+      cf:	53                   	push   %ebx
+      d0:	e8 48 0d 00 00       	call   e1d <strncmp>
+      d5:	83 c4 10             	add    $0x10,%esp
+      d8:	85 c0                	test   %eax,%eax
+      da:	74 e6                	je     c2 <setbuiltin+0xc2>
+    i = atoi(p);
+      dc:	83 ec 0c             	sub    $0xc,%esp
+      df:	53                   	push   %ebx
+      e0:	e8 82 0c 00 00       	call   d67 <atoi>
+    rc = (setgid(i));
+      e5:	89 04 24             	mov    %eax,(%esp)
+      e8:	e8 73 0e 00 00       	call   f60 <setgid>
+    if (rc == 0)
+      ed:	83 c4 10             	add    $0x10,%esp
+      f0:	85 c0                	test   %eax,%eax
+      f2:	74 9e                	je     92 <setbuiltin+0x92>
+  printf(2, "Invalid _set parameter\n");
+      f4:	83 ec 08             	sub    $0x8,%esp
+      f7:	68 f1 12 00 00       	push   $0x12f1
+      fc:	6a 02                	push   $0x2
+      fe:	e8 32 0f 00 00       	call   1035 <printf>
+  return -1;
+     103:	83 c4 10             	add    $0x10,%esp
+     106:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     10b:	eb 85                	jmp    92 <setbuiltin+0x92>
+
+0000010d <getbuiltin>:
+
+int
+getbuiltin(char *p)
+{
+     10d:	55                   	push   %ebp
+     10e:	89 e5                	mov    %esp,%ebp
+     110:	56                   	push   %esi
+     111:	53                   	push   %ebx
+  p += strlen("_get");
+     112:	83 ec 0c             	sub    $0xc,%esp
+     115:	68 09 13 00 00       	push   $0x1309
+     11a:	e8 59 0b 00 00       	call   c78 <strlen>
+     11f:	03 45 08             	add    0x8(%ebp),%eax
+     122:	89 c3                	mov    %eax,%ebx
+  while (strncmp(p, " ", 1) == 0) p++; // chomp spaces
+     124:	83 c4 10             	add    $0x10,%esp
+     127:	eb 03                	jmp    12c <getbuiltin+0x1f>
+     129:	83 c3 01             	add    $0x1,%ebx
+     12c:	83 ec 04             	sub    $0x4,%esp
+     12f:	6a 01                	push   $0x1
+     131:	68 2b 13 00 00       	push   $0x132b
+     136:	53                   	push   %ebx
+     137:	e8 e1 0c 00 00       	call   e1d <strncmp>
+     13c:	83 c4 10             	add    $0x10,%esp
+     13f:	85 c0                	test   %eax,%eax
+     141:	74 e6                	je     129 <getbuiltin+0x1c>
+  if (strncmp("uid", p, 3) == 0) {
+     143:	83 ec 04             	sub    $0x4,%esp
+     146:	6a 03                	push   $0x3
+     148:	53                   	push   %ebx
+     149:	68 e9 12 00 00       	push   $0x12e9
+     14e:	e8 ca 0c 00 00       	call   e1d <strncmp>
+     153:	89 c6                	mov    %eax,%esi
+     155:	83 c4 10             	add    $0x10,%esp
+     158:	85 c0                	test   %eax,%eax
+     15a:	74 3a                	je     196 <getbuiltin+0x89>
+    printf(2, "%d\n", getuid());
+    return 0;
+  }
+  if (strncmp("gid", p, 3) == 0) {
+     15c:	83 ec 04             	sub    $0x4,%esp
+     15f:	6a 03                	push   $0x3
+     161:	53                   	push   %ebx
+     162:	68 ed 12 00 00       	push   $0x12ed
+     167:	e8 b1 0c 00 00       	call   e1d <strncmp>
+     16c:	89 c6                	mov    %eax,%esi
+     16e:	83 c4 10             	add    $0x10,%esp
+     171:	85 c0                	test   %eax,%eax
+     173:	75 3b                	jne    1b0 <getbuiltin+0xa3>
+    printf(2, "%d\n", getgid());
+     175:	e8 ce 0d 00 00       	call   f48 <getgid>
+     17a:	83 ec 04             	sub    $0x4,%esp
+     17d:	50                   	push   %eax
+     17e:	68 0e 13 00 00       	push   $0x130e
+     183:	6a 02                	push   $0x2
+     185:	e8 ab 0e 00 00       	call   1035 <printf>
+    return 0;
+     18a:	83 c4 10             	add    $0x10,%esp
+  }
+  printf(2, "Invalid _get parameter\n");
+  return -1;
+}
+     18d:	89 f0                	mov    %esi,%eax
+     18f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     192:	5b                   	pop    %ebx
+     193:	5e                   	pop    %esi
+     194:	5d                   	pop    %ebp
+     195:	c3                   	ret
+    printf(2, "%d\n", getuid());
+     196:	e8 a5 0d 00 00       	call   f40 <getuid>
+     19b:	83 ec 04             	sub    $0x4,%esp
+     19e:	50                   	push   %eax
+     19f:	68 0e 13 00 00       	push   $0x130e
+     1a4:	6a 02                	push   $0x2
+     1a6:	e8 8a 0e 00 00       	call   1035 <printf>
+    return 0;
+     1ab:	83 c4 10             	add    $0x10,%esp
+     1ae:	eb dd                	jmp    18d <getbuiltin+0x80>
+  printf(2, "Invalid _get parameter\n");
+     1b0:	83 ec 08             	sub    $0x8,%esp
+     1b3:	68 12 13 00 00       	push   $0x1312
+     1b8:	6a 02                	push   $0x2
+     1ba:	e8 76 0e 00 00       	call   1035 <printf>
+  return -1;
+     1bf:	83 c4 10             	add    $0x10,%esp
+     1c2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     1c7:	eb c4                	jmp    18d <getbuiltin+0x80>
+
+000001c9 <getcmd>:
+{
+     1c9:	55                   	push   %ebp
+     1ca:	89 e5                	mov    %esp,%ebp
+     1cc:	56                   	push   %esi
+     1cd:	53                   	push   %ebx
+     1ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     1d4:	83 ec 08             	sub    $0x8,%esp
+     1d7:	68 2a 13 00 00       	push   $0x132a
+     1dc:	6a 02                	push   $0x2
+     1de:	e8 52 0e 00 00       	call   1035 <printf>
+  memset(buf, 0, nbuf);
+     1e3:	83 c4 0c             	add    $0xc,%esp
+     1e6:	56                   	push   %esi
+     1e7:	6a 00                	push   $0x0
+     1e9:	53                   	push   %ebx
+     1ea:	e8 a1 0a 00 00       	call   c90 <memset>
+  gets(buf, nbuf);
+     1ef:	83 c4 08             	add    $0x8,%esp
+     1f2:	56                   	push   %esi
+     1f3:	53                   	push   %ebx
+     1f4:	e8 d3 0a 00 00       	call   ccc <gets>
+  if(buf[0] == 0) // EOF
+     1f9:	83 c4 10             	add    $0x10,%esp
+     1fc:	80 3b 00             	cmpb   $0x0,(%ebx)
+     1ff:	74 0c                	je     20d <getcmd+0x44>
+  return 0;
+     201:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     206:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     209:	5b                   	pop    %ebx
+     20a:	5e                   	pop    %esi
+     20b:	5d                   	pop    %ebp
+     20c:	c3                   	ret
+    return -1;
+     20d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     212:	eb f2                	jmp    206 <getcmd+0x3d>
+
+00000214 <dobuiltin>:
+  {"_get", getbuiltin}
+};
+int FDTcount = sizeof(fdt) / sizeof(fdt[0]); // # entris in FDT
+
+void
+dobuiltin(char *cmd) {
+     214:	55                   	push   %ebp
+     215:	89 e5                	mov    %esp,%ebp
+     217:	56                   	push   %esi
+     218:	53                   	push   %ebx
+     219:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i;
+
+  for (i=0; i<FDTcount; i++)
+     21c:	bb 00 00 00 00       	mov    $0x0,%ebx
+     221:	eb 03                	jmp    226 <dobuiltin+0x12>
+     223:	83 c3 01             	add    $0x1,%ebx
+     226:	39 1d d0 1a 00 00    	cmp    %ebx,0x1ad0
+     22c:	7e 37                	jle    265 <dobuiltin+0x51>
+    if (strncmp(cmd, fdt[i].cmd, strlen(fdt[i].cmd)) == 0)
+     22e:	83 ec 0c             	sub    $0xc,%esp
+     231:	ff 34 dd d4 1a 00 00 	push   0x1ad4(,%ebx,8)
+     238:	e8 3b 0a 00 00       	call   c78 <strlen>
+     23d:	83 c4 0c             	add    $0xc,%esp
+     240:	50                   	push   %eax
+     241:	ff 34 dd d4 1a 00 00 	push   0x1ad4(,%ebx,8)
+     248:	56                   	push   %esi
+     249:	e8 cf 0b 00 00       	call   e1d <strncmp>
+     24e:	83 c4 10             	add    $0x10,%esp
+     251:	85 c0                	test   %eax,%eax
+     253:	75 ce                	jne    223 <dobuiltin+0xf>
+     (*fdt[i].name)(cmd);
+     255:	83 ec 0c             	sub    $0xc,%esp
+     258:	56                   	push   %esi
+     259:	ff 14 dd d8 1a 00 00 	call   *0x1ad8(,%ebx,8)
+     260:	83 c4 10             	add    $0x10,%esp
+     263:	eb be                	jmp    223 <dobuiltin+0xf>
+}
+     265:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     268:	5b                   	pop    %ebx
+     269:	5e                   	pop    %esi
+     26a:	5d                   	pop    %ebp
+     26b:	c3                   	ret
+
+0000026c <panic>:
+  exit();
+}
+
+void
+panic(char *s)
+{
+     26c:	55                   	push   %ebp
+     26d:	89 e5                	mov    %esp,%ebp
+     26f:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     272:	ff 75 08             	push   0x8(%ebp)
+     275:	68 c7 13 00 00       	push   $0x13c7
+     27a:	6a 02                	push   $0x2
+     27c:	e8 b4 0d 00 00       	call   1035 <printf>
+  exit();
+     281:	e8 0a 0c 00 00       	call   e90 <exit>
+
+00000286 <fork1>:
+}
+
+int
+fork1(void)
+{
+     286:	55                   	push   %ebp
+     287:	89 e5                	mov    %esp,%ebp
+     289:	83 ec 08             	sub    $0x8,%esp
+  int pid;
+
+  pid = fork();
+     28c:	e8 f7 0b 00 00       	call   e88 <fork>
+  if(pid == -1)
+     291:	83 f8 ff             	cmp    $0xffffffff,%eax
+     294:	74 02                	je     298 <fork1+0x12>
+    panic("fork");
+  return pid;
+}
+     296:	c9                   	leave
+     297:	c3                   	ret
+    panic("fork");
+     298:	83 ec 0c             	sub    $0xc,%esp
+     29b:	68 2d 13 00 00       	push   $0x132d
+     2a0:	e8 c7 ff ff ff       	call   26c <panic>
+
+000002a5 <runcmd>:
+{
+     2a5:	55                   	push   %ebp
+     2a6:	89 e5                	mov    %esp,%ebp
+     2a8:	53                   	push   %ebx
+     2a9:	83 ec 14             	sub    $0x14,%esp
+     2ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     2af:	85 db                	test   %ebx,%ebx
+     2b1:	74 0e                	je     2c1 <runcmd+0x1c>
+  switch(cmd->type){
+     2b3:	8b 03                	mov    (%ebx),%eax
+     2b5:	83 f8 05             	cmp    $0x5,%eax
+     2b8:	77 0c                	ja     2c6 <runcmd+0x21>
+     2ba:	ff 24 85 e8 13 00 00 	jmp    *0x13e8(,%eax,4)
+    exit();
+     2c1:	e8 ca 0b 00 00       	call   e90 <exit>
+    panic("runcmd");
+     2c6:	83 ec 0c             	sub    $0xc,%esp
+     2c9:	68 32 13 00 00       	push   $0x1332
+     2ce:	e8 99 ff ff ff       	call   26c <panic>
+    if(ecmd->argv[0] == 0)
+     2d3:	8b 43 04             	mov    0x4(%ebx),%eax
+     2d6:	85 c0                	test   %eax,%eax
+     2d8:	74 27                	je     301 <runcmd+0x5c>
+    exec(ecmd->argv[0], ecmd->argv);
+     2da:	8d 53 04             	lea    0x4(%ebx),%edx
+     2dd:	83 ec 08             	sub    $0x8,%esp
+     2e0:	52                   	push   %edx
+     2e1:	50                   	push   %eax
+     2e2:	e8 e1 0b 00 00       	call   ec8 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     2e7:	83 c4 0c             	add    $0xc,%esp
+     2ea:	ff 73 04             	push   0x4(%ebx)
+     2ed:	68 39 13 00 00       	push   $0x1339
+     2f2:	6a 02                	push   $0x2
+     2f4:	e8 3c 0d 00 00       	call   1035 <printf>
+    break;
+     2f9:	83 c4 10             	add    $0x10,%esp
+  exit();
+     2fc:	e8 8f 0b 00 00       	call   e90 <exit>
+      exit();
+     301:	e8 8a 0b 00 00       	call   e90 <exit>
+    close(rcmd->fd);
+     306:	83 ec 0c             	sub    $0xc,%esp
+     309:	ff 73 14             	push   0x14(%ebx)
+     30c:	e8 a7 0b 00 00       	call   eb8 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     311:	83 c4 08             	add    $0x8,%esp
+     314:	ff 73 10             	push   0x10(%ebx)
+     317:	ff 73 08             	push   0x8(%ebx)
+     31a:	e8 b1 0b 00 00       	call   ed0 <open>
+     31f:	83 c4 10             	add    $0x10,%esp
+     322:	85 c0                	test   %eax,%eax
+     324:	78 0b                	js     331 <runcmd+0x8c>
+    runcmd(rcmd->cmd);
+     326:	83 ec 0c             	sub    $0xc,%esp
+     329:	ff 73 04             	push   0x4(%ebx)
+     32c:	e8 74 ff ff ff       	call   2a5 <runcmd>
+      printf(2, "open %s failed\n", rcmd->file);
+     331:	83 ec 04             	sub    $0x4,%esp
+     334:	ff 73 08             	push   0x8(%ebx)
+     337:	68 49 13 00 00       	push   $0x1349
+     33c:	6a 02                	push   $0x2
+     33e:	e8 f2 0c 00 00       	call   1035 <printf>
+      exit();
+     343:	e8 48 0b 00 00       	call   e90 <exit>
+    if(fork1() == 0)
+     348:	e8 39 ff ff ff       	call   286 <fork1>
+     34d:	85 c0                	test   %eax,%eax
+     34f:	74 10                	je     361 <runcmd+0xbc>
+    wait();
+     351:	e8 42 0b 00 00       	call   e98 <wait>
+    runcmd(lcmd->right);
+     356:	83 ec 0c             	sub    $0xc,%esp
+     359:	ff 73 08             	push   0x8(%ebx)
+     35c:	e8 44 ff ff ff       	call   2a5 <runcmd>
+      runcmd(lcmd->left);
+     361:	83 ec 0c             	sub    $0xc,%esp
+     364:	ff 73 04             	push   0x4(%ebx)
+     367:	e8 39 ff ff ff       	call   2a5 <runcmd>
+    if(pipe(p) < 0)
+     36c:	83 ec 0c             	sub    $0xc,%esp
+     36f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     372:	50                   	push   %eax
+     373:	e8 28 0b 00 00       	call   ea0 <pipe>
+     378:	83 c4 10             	add    $0x10,%esp
+     37b:	85 c0                	test   %eax,%eax
+     37d:	78 3a                	js     3b9 <runcmd+0x114>
+    if(fork1() == 0){
+     37f:	e8 02 ff ff ff       	call   286 <fork1>
+     384:	85 c0                	test   %eax,%eax
+     386:	74 3e                	je     3c6 <runcmd+0x121>
+    if(fork1() == 0){
+     388:	e8 f9 fe ff ff       	call   286 <fork1>
+     38d:	85 c0                	test   %eax,%eax
+     38f:	74 6b                	je     3fc <runcmd+0x157>
+    close(p[0]);
+     391:	83 ec 0c             	sub    $0xc,%esp
+     394:	ff 75 f0             	push   -0x10(%ebp)
+     397:	e8 1c 0b 00 00       	call   eb8 <close>
+    close(p[1]);
+     39c:	83 c4 04             	add    $0x4,%esp
+     39f:	ff 75 f4             	push   -0xc(%ebp)
+     3a2:	e8 11 0b 00 00       	call   eb8 <close>
+    wait();
+     3a7:	e8 ec 0a 00 00       	call   e98 <wait>
+    wait();
+     3ac:	e8 e7 0a 00 00       	call   e98 <wait>
+    break;
+     3b1:	83 c4 10             	add    $0x10,%esp
+     3b4:	e9 43 ff ff ff       	jmp    2fc <runcmd+0x57>
+      panic("pipe");
+     3b9:	83 ec 0c             	sub    $0xc,%esp
+     3bc:	68 59 13 00 00       	push   $0x1359
+     3c1:	e8 a6 fe ff ff       	call   26c <panic>
+      close(1);
+     3c6:	83 ec 0c             	sub    $0xc,%esp
+     3c9:	6a 01                	push   $0x1
+     3cb:	e8 e8 0a 00 00       	call   eb8 <close>
+      dup(p[1]);
+     3d0:	83 c4 04             	add    $0x4,%esp
+     3d3:	ff 75 f4             	push   -0xc(%ebp)
+     3d6:	e8 2d 0b 00 00       	call   f08 <dup>
+      close(p[0]);
+     3db:	83 c4 04             	add    $0x4,%esp
+     3de:	ff 75 f0             	push   -0x10(%ebp)
+     3e1:	e8 d2 0a 00 00       	call   eb8 <close>
+      close(p[1]);
+     3e6:	83 c4 04             	add    $0x4,%esp
+     3e9:	ff 75 f4             	push   -0xc(%ebp)
+     3ec:	e8 c7 0a 00 00       	call   eb8 <close>
+      runcmd(pcmd->left);
+     3f1:	83 c4 04             	add    $0x4,%esp
+     3f4:	ff 73 04             	push   0x4(%ebx)
+     3f7:	e8 a9 fe ff ff       	call   2a5 <runcmd>
+      close(0);
+     3fc:	83 ec 0c             	sub    $0xc,%esp
+     3ff:	6a 00                	push   $0x0
+     401:	e8 b2 0a 00 00       	call   eb8 <close>
+      dup(p[0]);
+     406:	83 c4 04             	add    $0x4,%esp
+     409:	ff 75 f0             	push   -0x10(%ebp)
+     40c:	e8 f7 0a 00 00       	call   f08 <dup>
+      close(p[0]);
+     411:	83 c4 04             	add    $0x4,%esp
+     414:	ff 75 f0             	push   -0x10(%ebp)
+     417:	e8 9c 0a 00 00       	call   eb8 <close>
+      close(p[1]);
+     41c:	83 c4 04             	add    $0x4,%esp
+     41f:	ff 75 f4             	push   -0xc(%ebp)
+     422:	e8 91 0a 00 00       	call   eb8 <close>
+      runcmd(pcmd->right);
+     427:	83 c4 04             	add    $0x4,%esp
+     42a:	ff 73 08             	push   0x8(%ebx)
+     42d:	e8 73 fe ff ff       	call   2a5 <runcmd>
+    if(fork1() == 0)
+     432:	e8 4f fe ff ff       	call   286 <fork1>
+     437:	85 c0                	test   %eax,%eax
+     439:	0f 85 bd fe ff ff    	jne    2fc <runcmd+0x57>
+      runcmd(bcmd->cmd);
+     43f:	83 ec 0c             	sub    $0xc,%esp
+     442:	ff 73 04             	push   0x4(%ebx)
+     445:	e8 5b fe ff ff       	call   2a5 <runcmd>
+
+0000044a <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     44a:	55                   	push   %ebp
+     44b:	89 e5                	mov    %esp,%ebp
+     44d:	53                   	push   %ebx
+     44e:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     451:	6a 54                	push   $0x54
+     453:	e8 03 0e 00 00       	call   125b <malloc>
+     458:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     45a:	83 c4 0c             	add    $0xc,%esp
+     45d:	6a 54                	push   $0x54
+     45f:	6a 00                	push   $0x0
+     461:	50                   	push   %eax
+     462:	e8 29 08 00 00       	call   c90 <memset>
+  cmd->type = EXEC;
+     467:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     46d:	89 d8                	mov    %ebx,%eax
+     46f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     472:	c9                   	leave
+     473:	c3                   	ret
+
+00000474 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     474:	55                   	push   %ebp
+     475:	89 e5                	mov    %esp,%ebp
+     477:	53                   	push   %ebx
+     478:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     47b:	6a 18                	push   $0x18
+     47d:	e8 d9 0d 00 00       	call   125b <malloc>
+     482:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     484:	83 c4 0c             	add    $0xc,%esp
+     487:	6a 18                	push   $0x18
+     489:	6a 00                	push   $0x0
+     48b:	50                   	push   %eax
+     48c:	e8 ff 07 00 00       	call   c90 <memset>
+  cmd->type = REDIR;
+     491:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     497:	8b 45 08             	mov    0x8(%ebp),%eax
+     49a:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     49d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4a0:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     4a3:	8b 45 10             	mov    0x10(%ebp),%eax
+     4a6:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     4a9:	8b 45 14             	mov    0x14(%ebp),%eax
+     4ac:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     4af:	8b 45 18             	mov    0x18(%ebp),%eax
+     4b2:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     4b5:	89 d8                	mov    %ebx,%eax
+     4b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4ba:	c9                   	leave
+     4bb:	c3                   	ret
+
+000004bc <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     4bc:	55                   	push   %ebp
+     4bd:	89 e5                	mov    %esp,%ebp
+     4bf:	53                   	push   %ebx
+     4c0:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4c3:	6a 0c                	push   $0xc
+     4c5:	e8 91 0d 00 00       	call   125b <malloc>
+     4ca:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     4cc:	83 c4 0c             	add    $0xc,%esp
+     4cf:	6a 0c                	push   $0xc
+     4d1:	6a 00                	push   $0x0
+     4d3:	50                   	push   %eax
+     4d4:	e8 b7 07 00 00       	call   c90 <memset>
+  cmd->type = PIPE;
+     4d9:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     4df:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e2:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     4e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4e8:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     4eb:	89 d8                	mov    %ebx,%eax
+     4ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4f0:	c9                   	leave
+     4f1:	c3                   	ret
+
+000004f2 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     4f2:	55                   	push   %ebp
+     4f3:	89 e5                	mov    %esp,%ebp
+     4f5:	53                   	push   %ebx
+     4f6:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4f9:	6a 0c                	push   $0xc
+     4fb:	e8 5b 0d 00 00       	call   125b <malloc>
+     500:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     502:	83 c4 0c             	add    $0xc,%esp
+     505:	6a 0c                	push   $0xc
+     507:	6a 00                	push   $0x0
+     509:	50                   	push   %eax
+     50a:	e8 81 07 00 00       	call   c90 <memset>
+  cmd->type = LIST;
+     50f:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     515:	8b 45 08             	mov    0x8(%ebp),%eax
+     518:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     51b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     51e:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     521:	89 d8                	mov    %ebx,%eax
+     523:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     526:	c9                   	leave
+     527:	c3                   	ret
+
+00000528 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     528:	55                   	push   %ebp
+     529:	89 e5                	mov    %esp,%ebp
+     52b:	53                   	push   %ebx
+     52c:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     52f:	6a 08                	push   $0x8
+     531:	e8 25 0d 00 00       	call   125b <malloc>
+     536:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     538:	83 c4 0c             	add    $0xc,%esp
+     53b:	6a 08                	push   $0x8
+     53d:	6a 00                	push   $0x0
+     53f:	50                   	push   %eax
+     540:	e8 4b 07 00 00       	call   c90 <memset>
+  cmd->type = BACK;
+     545:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     54b:	8b 45 08             	mov    0x8(%ebp),%eax
+     54e:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     551:	89 d8                	mov    %ebx,%eax
+     553:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     556:	c9                   	leave
+     557:	c3                   	ret
+
+00000558 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     558:	55                   	push   %ebp
+     559:	89 e5                	mov    %esp,%ebp
+     55b:	57                   	push   %edi
+     55c:	56                   	push   %esi
+     55d:	53                   	push   %ebx
+     55e:	83 ec 0c             	sub    $0xc,%esp
+     561:	8b 75 0c             	mov    0xc(%ebp),%esi
+     564:	8b 7d 10             	mov    0x10(%ebp),%edi
+  char *s;
+  int ret;
+
+  s = *ps;
+     567:	8b 45 08             	mov    0x8(%ebp),%eax
+     56a:	8b 18                	mov    (%eax),%ebx
+  while(s < es && strchr(whitespace, *s))
+     56c:	eb 03                	jmp    571 <gettoken+0x19>
+    s++;
+     56e:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     571:	39 f3                	cmp    %esi,%ebx
+     573:	73 18                	jae    58d <gettoken+0x35>
+     575:	83 ec 08             	sub    $0x8,%esp
+     578:	0f be 03             	movsbl (%ebx),%eax
+     57b:	50                   	push   %eax
+     57c:	68 c8 1a 00 00       	push   $0x1ac8
+     581:	e8 23 07 00 00       	call   ca9 <strchr>
+     586:	83 c4 10             	add    $0x10,%esp
+     589:	85 c0                	test   %eax,%eax
+     58b:	75 e1                	jne    56e <gettoken+0x16>
+  if(q)
+     58d:	85 ff                	test   %edi,%edi
+     58f:	74 02                	je     593 <gettoken+0x3b>
+    *q = s;
+     591:	89 1f                	mov    %ebx,(%edi)
+  ret = *s;
+     593:	0f b6 03             	movzbl (%ebx),%eax
+     596:	0f be f8             	movsbl %al,%edi
+  switch(*s){
+     599:	3c 3c                	cmp    $0x3c,%al
+     59b:	7f 27                	jg     5c4 <gettoken+0x6c>
+     59d:	3c 3b                	cmp    $0x3b,%al
+     59f:	7d 13                	jge    5b4 <gettoken+0x5c>
+     5a1:	84 c0                	test   %al,%al
+     5a3:	74 12                	je     5b7 <gettoken+0x5f>
+     5a5:	78 41                	js     5e8 <gettoken+0x90>
+     5a7:	3c 26                	cmp    $0x26,%al
+     5a9:	74 09                	je     5b4 <gettoken+0x5c>
+     5ab:	7c 3b                	jl     5e8 <gettoken+0x90>
+     5ad:	83 e8 28             	sub    $0x28,%eax
+     5b0:	3c 01                	cmp    $0x1,%al
+     5b2:	77 34                	ja     5e8 <gettoken+0x90>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     5b4:	83 c3 01             	add    $0x1,%ebx
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     5b7:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     5bb:	74 77                	je     634 <gettoken+0xdc>
+    *eq = s;
+     5bd:	8b 45 14             	mov    0x14(%ebp),%eax
+     5c0:	89 18                	mov    %ebx,(%eax)
+     5c2:	eb 70                	jmp    634 <gettoken+0xdc>
+  switch(*s){
+     5c4:	3c 3e                	cmp    $0x3e,%al
+     5c6:	75 0d                	jne    5d5 <gettoken+0x7d>
+    s++;
+     5c8:	8d 43 01             	lea    0x1(%ebx),%eax
+    if(*s == '>'){
+     5cb:	80 7b 01 3e          	cmpb   $0x3e,0x1(%ebx)
+     5cf:	74 0a                	je     5db <gettoken+0x83>
+    s++;
+     5d1:	89 c3                	mov    %eax,%ebx
+     5d3:	eb e2                	jmp    5b7 <gettoken+0x5f>
+  switch(*s){
+     5d5:	3c 7c                	cmp    $0x7c,%al
+     5d7:	75 0f                	jne    5e8 <gettoken+0x90>
+     5d9:	eb d9                	jmp    5b4 <gettoken+0x5c>
+      s++;
+     5db:	83 c3 02             	add    $0x2,%ebx
+      ret = '+';
+     5de:	bf 2b 00 00 00       	mov    $0x2b,%edi
+     5e3:	eb d2                	jmp    5b7 <gettoken+0x5f>
+      s++;
+     5e5:	83 c3 01             	add    $0x1,%ebx
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     5e8:	39 f3                	cmp    %esi,%ebx
+     5ea:	73 37                	jae    623 <gettoken+0xcb>
+     5ec:	83 ec 08             	sub    $0x8,%esp
+     5ef:	0f be 03             	movsbl (%ebx),%eax
+     5f2:	50                   	push   %eax
+     5f3:	68 c8 1a 00 00       	push   $0x1ac8
+     5f8:	e8 ac 06 00 00       	call   ca9 <strchr>
+     5fd:	83 c4 10             	add    $0x10,%esp
+     600:	85 c0                	test   %eax,%eax
+     602:	75 26                	jne    62a <gettoken+0xd2>
+     604:	83 ec 08             	sub    $0x8,%esp
+     607:	0f be 03             	movsbl (%ebx),%eax
+     60a:	50                   	push   %eax
+     60b:	68 c0 1a 00 00       	push   $0x1ac0
+     610:	e8 94 06 00 00       	call   ca9 <strchr>
+     615:	83 c4 10             	add    $0x10,%esp
+     618:	85 c0                	test   %eax,%eax
+     61a:	74 c9                	je     5e5 <gettoken+0x8d>
+    ret = 'a';
+     61c:	bf 61 00 00 00       	mov    $0x61,%edi
+     621:	eb 94                	jmp    5b7 <gettoken+0x5f>
+     623:	bf 61 00 00 00       	mov    $0x61,%edi
+     628:	eb 8d                	jmp    5b7 <gettoken+0x5f>
+     62a:	bf 61 00 00 00       	mov    $0x61,%edi
+     62f:	eb 86                	jmp    5b7 <gettoken+0x5f>
+
+  while(s < es && strchr(whitespace, *s))
+    s++;
+     631:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     634:	39 f3                	cmp    %esi,%ebx
+     636:	73 18                	jae    650 <gettoken+0xf8>
+     638:	83 ec 08             	sub    $0x8,%esp
+     63b:	0f be 03             	movsbl (%ebx),%eax
+     63e:	50                   	push   %eax
+     63f:	68 c8 1a 00 00       	push   $0x1ac8
+     644:	e8 60 06 00 00       	call   ca9 <strchr>
+     649:	83 c4 10             	add    $0x10,%esp
+     64c:	85 c0                	test   %eax,%eax
+     64e:	75 e1                	jne    631 <gettoken+0xd9>
+  *ps = s;
+     650:	8b 45 08             	mov    0x8(%ebp),%eax
+     653:	89 18                	mov    %ebx,(%eax)
+  return ret;
+}
+     655:	89 f8                	mov    %edi,%eax
+     657:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     65a:	5b                   	pop    %ebx
+     65b:	5e                   	pop    %esi
+     65c:	5f                   	pop    %edi
+     65d:	5d                   	pop    %ebp
+     65e:	c3                   	ret
+
+0000065f <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     65f:	55                   	push   %ebp
+     660:	89 e5                	mov    %esp,%ebp
+     662:	57                   	push   %edi
+     663:	56                   	push   %esi
+     664:	53                   	push   %ebx
+     665:	83 ec 0c             	sub    $0xc,%esp
+     668:	8b 7d 08             	mov    0x8(%ebp),%edi
+     66b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     66e:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     670:	eb 03                	jmp    675 <peek+0x16>
+    s++;
+     672:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     675:	39 f3                	cmp    %esi,%ebx
+     677:	73 18                	jae    691 <peek+0x32>
+     679:	83 ec 08             	sub    $0x8,%esp
+     67c:	0f be 03             	movsbl (%ebx),%eax
+     67f:	50                   	push   %eax
+     680:	68 c8 1a 00 00       	push   $0x1ac8
+     685:	e8 1f 06 00 00       	call   ca9 <strchr>
+     68a:	83 c4 10             	add    $0x10,%esp
+     68d:	85 c0                	test   %eax,%eax
+     68f:	75 e1                	jne    672 <peek+0x13>
+  *ps = s;
+     691:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     693:	0f b6 03             	movzbl (%ebx),%eax
+     696:	84 c0                	test   %al,%al
+     698:	75 0d                	jne    6a7 <peek+0x48>
+     69a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     69f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6a2:	5b                   	pop    %ebx
+     6a3:	5e                   	pop    %esi
+     6a4:	5f                   	pop    %edi
+     6a5:	5d                   	pop    %ebp
+     6a6:	c3                   	ret
+  return *s && strchr(toks, *s);
+     6a7:	83 ec 08             	sub    $0x8,%esp
+     6aa:	0f be c0             	movsbl %al,%eax
+     6ad:	50                   	push   %eax
+     6ae:	ff 75 10             	push   0x10(%ebp)
+     6b1:	e8 f3 05 00 00       	call   ca9 <strchr>
+     6b6:	83 c4 10             	add    $0x10,%esp
+     6b9:	85 c0                	test   %eax,%eax
+     6bb:	74 07                	je     6c4 <peek+0x65>
+     6bd:	b8 01 00 00 00       	mov    $0x1,%eax
+     6c2:	eb db                	jmp    69f <peek+0x40>
+     6c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c9:	eb d4                	jmp    69f <peek+0x40>
+
+000006cb <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     6cb:	55                   	push   %ebp
+     6cc:	89 e5                	mov    %esp,%ebp
+     6ce:	57                   	push   %edi
+     6cf:	56                   	push   %esi
+     6d0:	53                   	push   %ebx
+     6d1:	83 ec 1c             	sub    $0x1c,%esp
+     6d4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     6d7:	8b 75 10             	mov    0x10(%ebp),%esi
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     6da:	eb 28                	jmp    704 <parseredirs+0x39>
+    tok = gettoken(ps, es, 0, 0);
+    if(gettoken(ps, es, &q, &eq) != 'a')
+      panic("missing file for redirection");
+     6dc:	83 ec 0c             	sub    $0xc,%esp
+     6df:	68 5e 13 00 00       	push   $0x135e
+     6e4:	e8 83 fb ff ff       	call   26c <panic>
+    switch(tok){
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     6e9:	83 ec 0c             	sub    $0xc,%esp
+     6ec:	6a 00                	push   $0x0
+     6ee:	6a 00                	push   $0x0
+     6f0:	ff 75 e0             	push   -0x20(%ebp)
+     6f3:	ff 75 e4             	push   -0x1c(%ebp)
+     6f6:	ff 75 08             	push   0x8(%ebp)
+     6f9:	e8 76 fd ff ff       	call   474 <redircmd>
+     6fe:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     701:	83 c4 20             	add    $0x20,%esp
+  while(peek(ps, es, "<>")){
+     704:	83 ec 04             	sub    $0x4,%esp
+     707:	68 7b 13 00 00       	push   $0x137b
+     70c:	56                   	push   %esi
+     70d:	57                   	push   %edi
+     70e:	e8 4c ff ff ff       	call   65f <peek>
+     713:	83 c4 10             	add    $0x10,%esp
+     716:	85 c0                	test   %eax,%eax
+     718:	74 76                	je     790 <parseredirs+0xc5>
+    tok = gettoken(ps, es, 0, 0);
+     71a:	6a 00                	push   $0x0
+     71c:	6a 00                	push   $0x0
+     71e:	56                   	push   %esi
+     71f:	57                   	push   %edi
+     720:	e8 33 fe ff ff       	call   558 <gettoken>
+     725:	89 c3                	mov    %eax,%ebx
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     727:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     72a:	50                   	push   %eax
+     72b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     72e:	50                   	push   %eax
+     72f:	56                   	push   %esi
+     730:	57                   	push   %edi
+     731:	e8 22 fe ff ff       	call   558 <gettoken>
+     736:	83 c4 20             	add    $0x20,%esp
+     739:	83 f8 61             	cmp    $0x61,%eax
+     73c:	75 9e                	jne    6dc <parseredirs+0x11>
+    switch(tok){
+     73e:	83 fb 3c             	cmp    $0x3c,%ebx
+     741:	74 a6                	je     6e9 <parseredirs+0x1e>
+     743:	83 fb 3e             	cmp    $0x3e,%ebx
+     746:	74 25                	je     76d <parseredirs+0xa2>
+     748:	83 fb 2b             	cmp    $0x2b,%ebx
+     74b:	75 b7                	jne    704 <parseredirs+0x39>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     74d:	83 ec 0c             	sub    $0xc,%esp
+     750:	6a 01                	push   $0x1
+     752:	68 01 02 00 00       	push   $0x201
+     757:	ff 75 e0             	push   -0x20(%ebp)
+     75a:	ff 75 e4             	push   -0x1c(%ebp)
+     75d:	ff 75 08             	push   0x8(%ebp)
+     760:	e8 0f fd ff ff       	call   474 <redircmd>
+     765:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     768:	83 c4 20             	add    $0x20,%esp
+     76b:	eb 97                	jmp    704 <parseredirs+0x39>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     76d:	83 ec 0c             	sub    $0xc,%esp
+     770:	6a 01                	push   $0x1
+     772:	68 01 02 00 00       	push   $0x201
+     777:	ff 75 e0             	push   -0x20(%ebp)
+     77a:	ff 75 e4             	push   -0x1c(%ebp)
+     77d:	ff 75 08             	push   0x8(%ebp)
+     780:	e8 ef fc ff ff       	call   474 <redircmd>
+     785:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     788:	83 c4 20             	add    $0x20,%esp
+     78b:	e9 74 ff ff ff       	jmp    704 <parseredirs+0x39>
+    }
+  }
+  return cmd;
+}
+     790:	8b 45 08             	mov    0x8(%ebp),%eax
+     793:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     796:	5b                   	pop    %ebx
+     797:	5e                   	pop    %esi
+     798:	5f                   	pop    %edi
+     799:	5d                   	pop    %ebp
+     79a:	c3                   	ret
+
+0000079b <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     79b:	55                   	push   %ebp
+     79c:	89 e5                	mov    %esp,%ebp
+     79e:	57                   	push   %edi
+     79f:	56                   	push   %esi
+     7a0:	53                   	push   %ebx
+     7a1:	83 ec 30             	sub    $0x30,%esp
+     7a4:	8b 75 08             	mov    0x8(%ebp),%esi
+     7a7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     7aa:	68 7e 13 00 00       	push   $0x137e
+     7af:	57                   	push   %edi
+     7b0:	56                   	push   %esi
+     7b1:	e8 a9 fe ff ff       	call   65f <peek>
+     7b6:	83 c4 10             	add    $0x10,%esp
+     7b9:	85 c0                	test   %eax,%eax
+     7bb:	75 1d                	jne    7da <parseexec+0x3f>
+     7bd:	89 c3                	mov    %eax,%ebx
+    return parseblock(ps, es);
+
+  ret = execcmd();
+     7bf:	e8 86 fc ff ff       	call   44a <execcmd>
+     7c4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     7c7:	83 ec 04             	sub    $0x4,%esp
+     7ca:	57                   	push   %edi
+     7cb:	56                   	push   %esi
+     7cc:	50                   	push   %eax
+     7cd:	e8 f9 fe ff ff       	call   6cb <parseredirs>
+     7d2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     7d5:	83 c4 10             	add    $0x10,%esp
+     7d8:	eb 3b                	jmp    815 <parseexec+0x7a>
+    return parseblock(ps, es);
+     7da:	83 ec 08             	sub    $0x8,%esp
+     7dd:	57                   	push   %edi
+     7de:	56                   	push   %esi
+     7df:	e8 8f 01 00 00       	call   973 <parseblock>
+     7e4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     7e7:	83 c4 10             	add    $0x10,%esp
+    ret = parseredirs(ret, ps, es);
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     7ea:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     7ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7f0:	5b                   	pop    %ebx
+     7f1:	5e                   	pop    %esi
+     7f2:	5f                   	pop    %edi
+     7f3:	5d                   	pop    %ebp
+     7f4:	c3                   	ret
+      panic("syntax");
+     7f5:	83 ec 0c             	sub    $0xc,%esp
+     7f8:	68 80 13 00 00       	push   $0x1380
+     7fd:	e8 6a fa ff ff       	call   26c <panic>
+    ret = parseredirs(ret, ps, es);
+     802:	83 ec 04             	sub    $0x4,%esp
+     805:	57                   	push   %edi
+     806:	56                   	push   %esi
+     807:	ff 75 d4             	push   -0x2c(%ebp)
+     80a:	e8 bc fe ff ff       	call   6cb <parseredirs>
+     80f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     812:	83 c4 10             	add    $0x10,%esp
+  while(!peek(ps, es, "|)&;")){
+     815:	83 ec 04             	sub    $0x4,%esp
+     818:	68 95 13 00 00       	push   $0x1395
+     81d:	57                   	push   %edi
+     81e:	56                   	push   %esi
+     81f:	e8 3b fe ff ff       	call   65f <peek>
+     824:	83 c4 10             	add    $0x10,%esp
+     827:	85 c0                	test   %eax,%eax
+     829:	75 41                	jne    86c <parseexec+0xd1>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     82b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     82e:	50                   	push   %eax
+     82f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     832:	50                   	push   %eax
+     833:	57                   	push   %edi
+     834:	56                   	push   %esi
+     835:	e8 1e fd ff ff       	call   558 <gettoken>
+     83a:	83 c4 10             	add    $0x10,%esp
+     83d:	85 c0                	test   %eax,%eax
+     83f:	74 2b                	je     86c <parseexec+0xd1>
+    if(tok != 'a')
+     841:	83 f8 61             	cmp    $0x61,%eax
+     844:	75 af                	jne    7f5 <parseexec+0x5a>
+    cmd->argv[argc] = q;
+     846:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     849:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     84c:	89 44 9a 04          	mov    %eax,0x4(%edx,%ebx,4)
+    cmd->eargv[argc] = eq;
+     850:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     853:	89 44 9a 2c          	mov    %eax,0x2c(%edx,%ebx,4)
+    argc++;
+     857:	83 c3 01             	add    $0x1,%ebx
+    if(argc >= MAXARGS)
+     85a:	83 fb 09             	cmp    $0x9,%ebx
+     85d:	7e a3                	jle    802 <parseexec+0x67>
+      panic("too many args");
+     85f:	83 ec 0c             	sub    $0xc,%esp
+     862:	68 87 13 00 00       	push   $0x1387
+     867:	e8 00 fa ff ff       	call   26c <panic>
+  cmd->argv[argc] = 0;
+     86c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     86f:	c7 44 98 04 00 00 00 	movl   $0x0,0x4(%eax,%ebx,4)
+     876:	00 
+  cmd->eargv[argc] = 0;
+     877:	c7 44 98 2c 00 00 00 	movl   $0x0,0x2c(%eax,%ebx,4)
+     87e:	00 
+  return ret;
+     87f:	e9 66 ff ff ff       	jmp    7ea <parseexec+0x4f>
+
+00000884 <parsepipe>:
+{
+     884:	55                   	push   %ebp
+     885:	89 e5                	mov    %esp,%ebp
+     887:	57                   	push   %edi
+     888:	56                   	push   %esi
+     889:	53                   	push   %ebx
+     88a:	83 ec 14             	sub    $0x14,%esp
+     88d:	8b 75 08             	mov    0x8(%ebp),%esi
+     890:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     893:	57                   	push   %edi
+     894:	56                   	push   %esi
+     895:	e8 01 ff ff ff       	call   79b <parseexec>
+     89a:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     89c:	83 c4 0c             	add    $0xc,%esp
+     89f:	68 9a 13 00 00       	push   $0x139a
+     8a4:	57                   	push   %edi
+     8a5:	56                   	push   %esi
+     8a6:	e8 b4 fd ff ff       	call   65f <peek>
+     8ab:	83 c4 10             	add    $0x10,%esp
+     8ae:	85 c0                	test   %eax,%eax
+     8b0:	75 0a                	jne    8bc <parsepipe+0x38>
+}
+     8b2:	89 d8                	mov    %ebx,%eax
+     8b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8b7:	5b                   	pop    %ebx
+     8b8:	5e                   	pop    %esi
+     8b9:	5f                   	pop    %edi
+     8ba:	5d                   	pop    %ebp
+     8bb:	c3                   	ret
+    gettoken(ps, es, 0, 0);
+     8bc:	6a 00                	push   $0x0
+     8be:	6a 00                	push   $0x0
+     8c0:	57                   	push   %edi
+     8c1:	56                   	push   %esi
+     8c2:	e8 91 fc ff ff       	call   558 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     8c7:	83 c4 08             	add    $0x8,%esp
+     8ca:	57                   	push   %edi
+     8cb:	56                   	push   %esi
+     8cc:	e8 b3 ff ff ff       	call   884 <parsepipe>
+     8d1:	83 c4 08             	add    $0x8,%esp
+     8d4:	50                   	push   %eax
+     8d5:	53                   	push   %ebx
+     8d6:	e8 e1 fb ff ff       	call   4bc <pipecmd>
+     8db:	89 c3                	mov    %eax,%ebx
+     8dd:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     8e0:	eb d0                	jmp    8b2 <parsepipe+0x2e>
+
+000008e2 <parseline>:
+{
+     8e2:	55                   	push   %ebp
+     8e3:	89 e5                	mov    %esp,%ebp
+     8e5:	57                   	push   %edi
+     8e6:	56                   	push   %esi
+     8e7:	53                   	push   %ebx
+     8e8:	83 ec 14             	sub    $0x14,%esp
+     8eb:	8b 75 08             	mov    0x8(%ebp),%esi
+     8ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     8f1:	57                   	push   %edi
+     8f2:	56                   	push   %esi
+     8f3:	e8 8c ff ff ff       	call   884 <parsepipe>
+     8f8:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     8fa:	83 c4 10             	add    $0x10,%esp
+     8fd:	eb 18                	jmp    917 <parseline+0x35>
+    gettoken(ps, es, 0, 0);
+     8ff:	6a 00                	push   $0x0
+     901:	6a 00                	push   $0x0
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+     905:	e8 4e fc ff ff       	call   558 <gettoken>
+    cmd = backcmd(cmd);
+     90a:	89 1c 24             	mov    %ebx,(%esp)
+     90d:	e8 16 fc ff ff       	call   528 <backcmd>
+     912:	89 c3                	mov    %eax,%ebx
+     914:	83 c4 10             	add    $0x10,%esp
+  while(peek(ps, es, "&")){
+     917:	83 ec 04             	sub    $0x4,%esp
+     91a:	68 9c 13 00 00       	push   $0x139c
+     91f:	57                   	push   %edi
+     920:	56                   	push   %esi
+     921:	e8 39 fd ff ff       	call   65f <peek>
+     926:	83 c4 10             	add    $0x10,%esp
+     929:	85 c0                	test   %eax,%eax
+     92b:	75 d2                	jne    8ff <parseline+0x1d>
+  if(peek(ps, es, ";")){
+     92d:	83 ec 04             	sub    $0x4,%esp
+     930:	68 98 13 00 00       	push   $0x1398
+     935:	57                   	push   %edi
+     936:	56                   	push   %esi
+     937:	e8 23 fd ff ff       	call   65f <peek>
+     93c:	83 c4 10             	add    $0x10,%esp
+     93f:	85 c0                	test   %eax,%eax
+     941:	75 0a                	jne    94d <parseline+0x6b>
+}
+     943:	89 d8                	mov    %ebx,%eax
+     945:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     948:	5b                   	pop    %ebx
+     949:	5e                   	pop    %esi
+     94a:	5f                   	pop    %edi
+     94b:	5d                   	pop    %ebp
+     94c:	c3                   	ret
+    gettoken(ps, es, 0, 0);
+     94d:	6a 00                	push   $0x0
+     94f:	6a 00                	push   $0x0
+     951:	57                   	push   %edi
+     952:	56                   	push   %esi
+     953:	e8 00 fc ff ff       	call   558 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     958:	83 c4 08             	add    $0x8,%esp
+     95b:	57                   	push   %edi
+     95c:	56                   	push   %esi
+     95d:	e8 80 ff ff ff       	call   8e2 <parseline>
+     962:	83 c4 08             	add    $0x8,%esp
+     965:	50                   	push   %eax
+     966:	53                   	push   %ebx
+     967:	e8 86 fb ff ff       	call   4f2 <listcmd>
+     96c:	89 c3                	mov    %eax,%ebx
+     96e:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     971:	eb d0                	jmp    943 <parseline+0x61>
+
+00000973 <parseblock>:
+{
+     973:	55                   	push   %ebp
+     974:	89 e5                	mov    %esp,%ebp
+     976:	57                   	push   %edi
+     977:	56                   	push   %esi
+     978:	53                   	push   %ebx
+     979:	83 ec 10             	sub    $0x10,%esp
+     97c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     97f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     982:	68 7e 13 00 00       	push   $0x137e
+     987:	56                   	push   %esi
+     988:	53                   	push   %ebx
+     989:	e8 d1 fc ff ff       	call   65f <peek>
+     98e:	83 c4 10             	add    $0x10,%esp
+     991:	85 c0                	test   %eax,%eax
+     993:	74 4b                	je     9e0 <parseblock+0x6d>
+  gettoken(ps, es, 0, 0);
+     995:	6a 00                	push   $0x0
+     997:	6a 00                	push   $0x0
+     999:	56                   	push   %esi
+     99a:	53                   	push   %ebx
+     99b:	e8 b8 fb ff ff       	call   558 <gettoken>
+  cmd = parseline(ps, es);
+     9a0:	83 c4 08             	add    $0x8,%esp
+     9a3:	56                   	push   %esi
+     9a4:	53                   	push   %ebx
+     9a5:	e8 38 ff ff ff       	call   8e2 <parseline>
+     9aa:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     9ac:	83 c4 0c             	add    $0xc,%esp
+     9af:	68 ba 13 00 00       	push   $0x13ba
+     9b4:	56                   	push   %esi
+     9b5:	53                   	push   %ebx
+     9b6:	e8 a4 fc ff ff       	call   65f <peek>
+     9bb:	83 c4 10             	add    $0x10,%esp
+     9be:	85 c0                	test   %eax,%eax
+     9c0:	74 2b                	je     9ed <parseblock+0x7a>
+  gettoken(ps, es, 0, 0);
+     9c2:	6a 00                	push   $0x0
+     9c4:	6a 00                	push   $0x0
+     9c6:	56                   	push   %esi
+     9c7:	53                   	push   %ebx
+     9c8:	e8 8b fb ff ff       	call   558 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     9cd:	83 c4 0c             	add    $0xc,%esp
+     9d0:	56                   	push   %esi
+     9d1:	53                   	push   %ebx
+     9d2:	57                   	push   %edi
+     9d3:	e8 f3 fc ff ff       	call   6cb <parseredirs>
+}
+     9d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9db:	5b                   	pop    %ebx
+     9dc:	5e                   	pop    %esi
+     9dd:	5f                   	pop    %edi
+     9de:	5d                   	pop    %ebp
+     9df:	c3                   	ret
+    panic("parseblock");
+     9e0:	83 ec 0c             	sub    $0xc,%esp
+     9e3:	68 9e 13 00 00       	push   $0x139e
+     9e8:	e8 7f f8 ff ff       	call   26c <panic>
+    panic("syntax - missing )");
+     9ed:	83 ec 0c             	sub    $0xc,%esp
+     9f0:	68 a9 13 00 00       	push   $0x13a9
+     9f5:	e8 72 f8 ff ff       	call   26c <panic>
+
+000009fa <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     9fa:	55                   	push   %ebp
+     9fb:	89 e5                	mov    %esp,%ebp
+     9fd:	53                   	push   %ebx
+     9fe:	83 ec 04             	sub    $0x4,%esp
+     a01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     a04:	85 db                	test   %ebx,%ebx
+     a06:	74 1f                	je     a27 <nulterminate+0x2d>
+    return 0;
+
+  switch(cmd->type){
+     a08:	8b 03                	mov    (%ebx),%eax
+     a0a:	83 f8 05             	cmp    $0x5,%eax
+     a0d:	77 18                	ja     a27 <nulterminate+0x2d>
+     a0f:	ff 24 85 00 14 00 00 	jmp    *0x1400(,%eax,4)
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+    for(i=0; ecmd->argv[i]; i++)
+      *ecmd->eargv[i] = 0;
+     a16:	8b 54 83 2c          	mov    0x2c(%ebx,%eax,4),%edx
+     a1a:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     a1d:	83 c0 01             	add    $0x1,%eax
+     a20:	83 7c 83 04 00       	cmpl   $0x0,0x4(%ebx,%eax,4)
+     a25:	75 ef                	jne    a16 <nulterminate+0x1c>
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     a27:	89 d8                	mov    %ebx,%eax
+     a29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a2c:	c9                   	leave
+     a2d:	c3                   	ret
+  switch(cmd->type){
+     a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+     a33:	eb eb                	jmp    a20 <nulterminate+0x26>
+    nulterminate(rcmd->cmd);
+     a35:	83 ec 0c             	sub    $0xc,%esp
+     a38:	ff 73 04             	push   0x4(%ebx)
+     a3b:	e8 ba ff ff ff       	call   9fa <nulterminate>
+    *rcmd->efile = 0;
+     a40:	8b 43 0c             	mov    0xc(%ebx),%eax
+     a43:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     a46:	83 c4 10             	add    $0x10,%esp
+     a49:	eb dc                	jmp    a27 <nulterminate+0x2d>
+    nulterminate(pcmd->left);
+     a4b:	83 ec 0c             	sub    $0xc,%esp
+     a4e:	ff 73 04             	push   0x4(%ebx)
+     a51:	e8 a4 ff ff ff       	call   9fa <nulterminate>
+    nulterminate(pcmd->right);
+     a56:	83 c4 04             	add    $0x4,%esp
+     a59:	ff 73 08             	push   0x8(%ebx)
+     a5c:	e8 99 ff ff ff       	call   9fa <nulterminate>
+    break;
+     a61:	83 c4 10             	add    $0x10,%esp
+     a64:	eb c1                	jmp    a27 <nulterminate+0x2d>
+    nulterminate(lcmd->left);
+     a66:	83 ec 0c             	sub    $0xc,%esp
+     a69:	ff 73 04             	push   0x4(%ebx)
+     a6c:	e8 89 ff ff ff       	call   9fa <nulterminate>
+    nulterminate(lcmd->right);
+     a71:	83 c4 04             	add    $0x4,%esp
+     a74:	ff 73 08             	push   0x8(%ebx)
+     a77:	e8 7e ff ff ff       	call   9fa <nulterminate>
+    break;
+     a7c:	83 c4 10             	add    $0x10,%esp
+     a7f:	eb a6                	jmp    a27 <nulterminate+0x2d>
+    nulterminate(bcmd->cmd);
+     a81:	83 ec 0c             	sub    $0xc,%esp
+     a84:	ff 73 04             	push   0x4(%ebx)
+     a87:	e8 6e ff ff ff       	call   9fa <nulterminate>
+    break;
+     a8c:	83 c4 10             	add    $0x10,%esp
+     a8f:	eb 96                	jmp    a27 <nulterminate+0x2d>
+
+00000a91 <parsecmd>:
+{
+     a91:	55                   	push   %ebp
+     a92:	89 e5                	mov    %esp,%ebp
+     a94:	56                   	push   %esi
+     a95:	53                   	push   %ebx
+  es = s + strlen(s);
+     a96:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a99:	83 ec 0c             	sub    $0xc,%esp
+     a9c:	53                   	push   %ebx
+     a9d:	e8 d6 01 00 00       	call   c78 <strlen>
+     aa2:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     aa4:	83 c4 08             	add    $0x8,%esp
+     aa7:	53                   	push   %ebx
+     aa8:	8d 45 08             	lea    0x8(%ebp),%eax
+     aab:	50                   	push   %eax
+     aac:	e8 31 fe ff ff       	call   8e2 <parseline>
+     ab1:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     ab3:	83 c4 0c             	add    $0xc,%esp
+     ab6:	68 11 13 00 00       	push   $0x1311
+     abb:	53                   	push   %ebx
+     abc:	8d 45 08             	lea    0x8(%ebp),%eax
+     abf:	50                   	push   %eax
+     ac0:	e8 9a fb ff ff       	call   65f <peek>
+  if(s != es){
+     ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+     ac8:	83 c4 10             	add    $0x10,%esp
+     acb:	39 d8                	cmp    %ebx,%eax
+     acd:	75 12                	jne    ae1 <parsecmd+0x50>
+  nulterminate(cmd);
+     acf:	83 ec 0c             	sub    $0xc,%esp
+     ad2:	56                   	push   %esi
+     ad3:	e8 22 ff ff ff       	call   9fa <nulterminate>
+}
+     ad8:	89 f0                	mov    %esi,%eax
+     ada:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     add:	5b                   	pop    %ebx
+     ade:	5e                   	pop    %esi
+     adf:	5d                   	pop    %ebp
+     ae0:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     ae1:	83 ec 04             	sub    $0x4,%esp
+     ae4:	50                   	push   %eax
+     ae5:	68 bc 13 00 00       	push   $0x13bc
+     aea:	6a 02                	push   $0x2
+     aec:	e8 44 05 00 00       	call   1035 <printf>
+    panic("syntax");
+     af1:	c7 04 24 80 13 00 00 	movl   $0x1380,(%esp)
+     af8:	e8 6f f7 ff ff       	call   26c <panic>
+
+00000afd <main>:
+{
+     afd:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     b01:	83 e4 f0             	and    $0xfffffff0,%esp
+     b04:	ff 71 fc             	push   -0x4(%ecx)
+     b07:	55                   	push   %ebp
+     b08:	89 e5                	mov    %esp,%ebp
+     b0a:	51                   	push   %ecx
+     b0b:	83 ec 04             	sub    $0x4,%esp
+  while((fd = open("console", O_RDWR)) >= 0){
+     b0e:	83 ec 08             	sub    $0x8,%esp
+     b11:	6a 02                	push   $0x2
+     b13:	68 cb 13 00 00       	push   $0x13cb
+     b18:	e8 b3 03 00 00       	call   ed0 <open>
+     b1d:	83 c4 10             	add    $0x10,%esp
+     b20:	85 c0                	test   %eax,%eax
+     b22:	0f 88 80 00 00 00    	js     ba8 <main+0xab>
+    if(fd >= 3){
+     b28:	83 f8 02             	cmp    $0x2,%eax
+     b2b:	7e e1                	jle    b0e <main+0x11>
+      close(fd);
+     b2d:	83 ec 0c             	sub    $0xc,%esp
+     b30:	50                   	push   %eax
+     b31:	e8 82 03 00 00       	call   eb8 <close>
+      break;
+     b36:	83 c4 10             	add    $0x10,%esp
+     b39:	eb 6d                	jmp    ba8 <main+0xab>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     b3b:	80 3d 01 1b 00 00 64 	cmpb   $0x64,0x1b01
+     b42:	0f 85 85 00 00 00    	jne    bcd <main+0xd0>
+     b48:	80 3d 02 1b 00 00 20 	cmpb   $0x20,0x1b02
+     b4f:	75 7c                	jne    bcd <main+0xd0>
+      buf[strlen(buf)-1] = 0;  // chop \n
+     b51:	83 ec 0c             	sub    $0xc,%esp
+     b54:	68 00 1b 00 00       	push   $0x1b00
+     b59:	e8 1a 01 00 00       	call   c78 <strlen>
+     b5e:	c6 80 ff 1a 00 00 00 	movb   $0x0,0x1aff(%eax)
+      if(chdir(buf+3) < 0)
+     b65:	c7 04 24 03 1b 00 00 	movl   $0x1b03,(%esp)
+     b6c:	e8 8f 03 00 00       	call   f00 <chdir>
+     b71:	83 c4 10             	add    $0x10,%esp
+     b74:	85 c0                	test   %eax,%eax
+     b76:	79 30                	jns    ba8 <main+0xab>
+        printf(2, "cannot cd %s\n", buf+3);
+     b78:	83 ec 04             	sub    $0x4,%esp
+     b7b:	68 03 1b 00 00       	push   $0x1b03
+     b80:	68 d3 13 00 00       	push   $0x13d3
+     b85:	6a 02                	push   $0x2
+     b87:	e8 a9 04 00 00       	call   1035 <printf>
+     b8c:	83 c4 10             	add    $0x10,%esp
+      continue;
+     b8f:	eb 17                	jmp    ba8 <main+0xab>
+    if (buf[0]=='_') {     // assume it is a builtin command
+     b91:	80 3d 00 1b 00 00 5f 	cmpb   $0x5f,0x1b00
+     b98:	74 66                	je     c00 <main+0x103>
+    if(fork1() == 0)
+     b9a:	e8 e7 f6 ff ff       	call   286 <fork1>
+     b9f:	85 c0                	test   %eax,%eax
+     ba1:	74 6f                	je     c12 <main+0x115>
+    wait();
+     ba3:	e8 f0 02 00 00       	call   e98 <wait>
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     ba8:	83 ec 08             	sub    $0x8,%esp
+     bab:	6a 64                	push   $0x64
+     bad:	68 00 1b 00 00       	push   $0x1b00
+     bb2:	e8 12 f6 ff ff       	call   1c9 <getcmd>
+     bb7:	83 c4 10             	add    $0x10,%esp
+     bba:	85 c0                	test   %eax,%eax
+     bbc:	78 69                	js     c27 <main+0x12a>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     bbe:	0f b6 05 00 1b 00 00 	movzbl 0x1b00,%eax
+     bc5:	3c 63                	cmp    $0x63,%al
+     bc7:	0f 84 6e ff ff ff    	je     b3b <main+0x3e>
+    if ((buf[0] != '\n') && (strncmp(buf, "exit", strlen(buf)-1) == 0)) { // ignore '\n'
+     bcd:	3c 0a                	cmp    $0xa,%al
+     bcf:	74 c0                	je     b91 <main+0x94>
+     bd1:	83 ec 0c             	sub    $0xc,%esp
+     bd4:	68 00 1b 00 00       	push   $0x1b00
+     bd9:	e8 9a 00 00 00       	call   c78 <strlen>
+     bde:	83 c4 0c             	add    $0xc,%esp
+     be1:	83 e8 01             	sub    $0x1,%eax
+     be4:	50                   	push   %eax
+     be5:	68 e1 13 00 00       	push   $0x13e1
+     bea:	68 00 1b 00 00       	push   $0x1b00
+     bef:	e8 29 02 00 00       	call   e1d <strncmp>
+     bf4:	83 c4 10             	add    $0x10,%esp
+     bf7:	85 c0                	test   %eax,%eax
+     bf9:	75 96                	jne    b91 <main+0x94>
+      exit();
+     bfb:	e8 90 02 00 00       	call   e90 <exit>
+      dobuiltin(buf);
+     c00:	83 ec 0c             	sub    $0xc,%esp
+     c03:	68 00 1b 00 00       	push   $0x1b00
+     c08:	e8 07 f6 ff ff       	call   214 <dobuiltin>
+      continue;
+     c0d:	83 c4 10             	add    $0x10,%esp
+     c10:	eb 96                	jmp    ba8 <main+0xab>
+      runcmd(parsecmd(buf));
+     c12:	83 ec 0c             	sub    $0xc,%esp
+     c15:	68 00 1b 00 00       	push   $0x1b00
+     c1a:	e8 72 fe ff ff       	call   a91 <parsecmd>
+     c1f:	89 04 24             	mov    %eax,(%esp)
+     c22:	e8 7e f6 ff ff       	call   2a5 <runcmd>
+  exit();
+     c27:	e8 64 02 00 00       	call   e90 <exit>
+
+00000c2c <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     c2c:	55                   	push   %ebp
+     c2d:	89 e5                	mov    %esp,%ebp
+     c2f:	56                   	push   %esi
+     c30:	53                   	push   %ebx
+     c31:	8b 75 08             	mov    0x8(%ebp),%esi
+     c34:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     c37:	89 f0                	mov    %esi,%eax
+     c39:	89 d1                	mov    %edx,%ecx
+     c3b:	83 c2 01             	add    $0x1,%edx
+     c3e:	89 c3                	mov    %eax,%ebx
+     c40:	83 c0 01             	add    $0x1,%eax
+     c43:	0f b6 09             	movzbl (%ecx),%ecx
+     c46:	88 0b                	mov    %cl,(%ebx)
+     c48:	84 c9                	test   %cl,%cl
+     c4a:	75 ed                	jne    c39 <strcpy+0xd>
+    ;
+  return os;
+}
+     c4c:	89 f0                	mov    %esi,%eax
+     c4e:	5b                   	pop    %ebx
+     c4f:	5e                   	pop    %esi
+     c50:	5d                   	pop    %ebp
+     c51:	c3                   	ret
+
+00000c52 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     c52:	55                   	push   %ebp
+     c53:	89 e5                	mov    %esp,%ebp
+     c55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     c5b:	eb 06                	jmp    c63 <strcmp+0x11>
+    p++, q++;
+     c5d:	83 c1 01             	add    $0x1,%ecx
+     c60:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     c63:	0f b6 01             	movzbl (%ecx),%eax
+     c66:	84 c0                	test   %al,%al
+     c68:	74 04                	je     c6e <strcmp+0x1c>
+     c6a:	3a 02                	cmp    (%edx),%al
+     c6c:	74 ef                	je     c5d <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     c6e:	0f b6 c0             	movzbl %al,%eax
+     c71:	0f b6 12             	movzbl (%edx),%edx
+     c74:	29 d0                	sub    %edx,%eax
+}
+     c76:	5d                   	pop    %ebp
+     c77:	c3                   	ret
+
+00000c78 <strlen>:
+
+uint
+strlen(char *s)
+{
+     c78:	55                   	push   %ebp
+     c79:	89 e5                	mov    %esp,%ebp
+     c7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+     c83:	eb 03                	jmp    c88 <strlen+0x10>
+     c85:	83 c0 01             	add    $0x1,%eax
+     c88:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     c8c:	75 f7                	jne    c85 <strlen+0xd>
+    ;
+  return n;
+}
+     c8e:	5d                   	pop    %ebp
+     c8f:	c3                   	ret
+
+00000c90 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	57                   	push   %edi
+     c94:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     c97:	89 d7                	mov    %edx,%edi
+     c99:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c9f:	fc                   	cld
+     ca0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     ca2:	89 d0                	mov    %edx,%eax
+     ca4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     ca7:	c9                   	leave
+     ca8:	c3                   	ret
+
+00000ca9 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     ca9:	55                   	push   %ebp
+     caa:	89 e5                	mov    %esp,%ebp
+     cac:	8b 45 08             	mov    0x8(%ebp),%eax
+     caf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     cb3:	eb 03                	jmp    cb8 <strchr+0xf>
+     cb5:	83 c0 01             	add    $0x1,%eax
+     cb8:	0f b6 10             	movzbl (%eax),%edx
+     cbb:	84 d2                	test   %dl,%dl
+     cbd:	74 06                	je     cc5 <strchr+0x1c>
+    if(*s == c)
+     cbf:	38 ca                	cmp    %cl,%dl
+     cc1:	75 f2                	jne    cb5 <strchr+0xc>
+     cc3:	eb 05                	jmp    cca <strchr+0x21>
+      return (char*)s;
+  return 0;
+     cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     cca:	5d                   	pop    %ebp
+     ccb:	c3                   	ret
+
+00000ccc <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     ccc:	55                   	push   %ebp
+     ccd:	89 e5                	mov    %esp,%ebp
+     ccf:	57                   	push   %edi
+     cd0:	56                   	push   %esi
+     cd1:	53                   	push   %ebx
+     cd2:	83 ec 1c             	sub    $0x1c,%esp
+     cd5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     cd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cdd:	89 de                	mov    %ebx,%esi
+     cdf:	83 c3 01             	add    $0x1,%ebx
+     ce2:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     ce5:	7d 2e                	jge    d15 <gets+0x49>
+    cc = read(0, &c, 1);
+     ce7:	83 ec 04             	sub    $0x4,%esp
+     cea:	6a 01                	push   $0x1
+     cec:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     cef:	50                   	push   %eax
+     cf0:	6a 00                	push   $0x0
+     cf2:	e8 b1 01 00 00       	call   ea8 <read>
+    if(cc < 1)
+     cf7:	83 c4 10             	add    $0x10,%esp
+     cfa:	85 c0                	test   %eax,%eax
+     cfc:	7e 17                	jle    d15 <gets+0x49>
+      break;
+    buf[i++] = c;
+     cfe:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     d02:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     d05:	3c 0a                	cmp    $0xa,%al
+     d07:	0f 94 c2             	sete   %dl
+     d0a:	3c 0d                	cmp    $0xd,%al
+     d0c:	0f 94 c0             	sete   %al
+     d0f:	08 c2                	or     %al,%dl
+     d11:	74 ca                	je     cdd <gets+0x11>
+    buf[i++] = c;
+     d13:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     d15:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     d19:	89 f8                	mov    %edi,%eax
+     d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d1e:	5b                   	pop    %ebx
+     d1f:	5e                   	pop    %esi
+     d20:	5f                   	pop    %edi
+     d21:	5d                   	pop    %ebp
+     d22:	c3                   	ret
+
+00000d23 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     d23:	55                   	push   %ebp
+     d24:	89 e5                	mov    %esp,%ebp
+     d26:	56                   	push   %esi
+     d27:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d28:	83 ec 08             	sub    $0x8,%esp
+     d2b:	6a 00                	push   $0x0
+     d2d:	ff 75 08             	push   0x8(%ebp)
+     d30:	e8 9b 01 00 00       	call   ed0 <open>
+  if(fd < 0)
+     d35:	83 c4 10             	add    $0x10,%esp
+     d38:	85 c0                	test   %eax,%eax
+     d3a:	78 24                	js     d60 <stat+0x3d>
+     d3c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+     d3e:	83 ec 08             	sub    $0x8,%esp
+     d41:	ff 75 0c             	push   0xc(%ebp)
+     d44:	50                   	push   %eax
+     d45:	e8 9e 01 00 00       	call   ee8 <fstat>
+     d4a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     d4c:	89 1c 24             	mov    %ebx,(%esp)
+     d4f:	e8 64 01 00 00       	call   eb8 <close>
+  return r;
+     d54:	83 c4 10             	add    $0x10,%esp
+}
+     d57:	89 f0                	mov    %esi,%eax
+     d59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d5c:	5b                   	pop    %ebx
+     d5d:	5e                   	pop    %esi
+     d5e:	5d                   	pop    %ebp
+     d5f:	c3                   	ret
+    return -1;
+     d60:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     d65:	eb f0                	jmp    d57 <stat+0x34>
+
+00000d67 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+     d67:	55                   	push   %ebp
+     d68:	89 e5                	mov    %esp,%ebp
+     d6a:	56                   	push   %esi
+     d6b:	53                   	push   %ebx
+     d6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     d6f:	eb 03                	jmp    d74 <atoi+0xd>
+     d71:	83 c2 01             	add    $0x1,%edx
+     d74:	0f b6 02             	movzbl (%edx),%eax
+     d77:	3c 20                	cmp    $0x20,%al
+     d79:	74 f6                	je     d71 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+     d7b:	3c 2d                	cmp    $0x2d,%al
+     d7d:	74 1d                	je     d9c <atoi+0x35>
+     d7f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     d84:	3c 2b                	cmp    $0x2b,%al
+     d86:	0f 94 c1             	sete   %cl
+     d89:	3c 2d                	cmp    $0x2d,%al
+     d8b:	0f 94 c0             	sete   %al
+     d8e:	08 c1                	or     %al,%cl
+     d90:	74 03                	je     d95 <atoi+0x2e>
+    s++;
+     d92:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+     d95:	b8 00 00 00 00       	mov    $0x0,%eax
+     d9a:	eb 17                	jmp    db3 <atoi+0x4c>
+     d9c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     da1:	eb e1                	jmp    d84 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+     da3:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+     da6:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+     da9:	83 c2 01             	add    $0x1,%edx
+     dac:	0f be c9             	movsbl %cl,%ecx
+     daf:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+     db3:	0f b6 0a             	movzbl (%edx),%ecx
+     db6:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     db9:	80 fb 09             	cmp    $0x9,%bl
+     dbc:	76 e5                	jbe    da3 <atoi+0x3c>
+  return sign*n;
+     dbe:	0f af c6             	imul   %esi,%eax
+}
+     dc1:	5b                   	pop    %ebx
+     dc2:	5e                   	pop    %esi
+     dc3:	5d                   	pop    %ebp
+     dc4:	c3                   	ret
+
+00000dc5 <atoo>:
+
+int
+atoo(const char *s)
+{
+     dc5:	55                   	push   %ebp
+     dc6:	89 e5                	mov    %esp,%ebp
+     dc8:	56                   	push   %esi
+     dc9:	53                   	push   %ebx
+     dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+     dcd:	eb 03                	jmp    dd2 <atoo+0xd>
+     dcf:	83 c2 01             	add    $0x1,%edx
+     dd2:	0f b6 02             	movzbl (%edx),%eax
+     dd5:	3c 20                	cmp    $0x20,%al
+     dd7:	74 f6                	je     dcf <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+     dd9:	3c 2d                	cmp    $0x2d,%al
+     ddb:	74 1d                	je     dfa <atoo+0x35>
+     ddd:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+     de2:	3c 2b                	cmp    $0x2b,%al
+     de4:	0f 94 c1             	sete   %cl
+     de7:	3c 2d                	cmp    $0x2d,%al
+     de9:	0f 94 c0             	sete   %al
+     dec:	08 c1                	or     %al,%cl
+     dee:	74 03                	je     df3 <atoo+0x2e>
+    s++;
+     df0:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+     df3:	b8 00 00 00 00       	mov    $0x0,%eax
+     df8:	eb 11                	jmp    e0b <atoo+0x46>
+     dfa:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     dff:	eb e1                	jmp    de2 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+     e01:	83 c2 01             	add    $0x1,%edx
+     e04:	0f be c9             	movsbl %cl,%ecx
+     e07:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+     e0b:	0f b6 0a             	movzbl (%edx),%ecx
+     e0e:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+     e11:	80 fb 07             	cmp    $0x7,%bl
+     e14:	76 eb                	jbe    e01 <atoo+0x3c>
+  return sign*n;
+     e16:	0f af c6             	imul   %esi,%eax
+}
+     e19:	5b                   	pop    %ebx
+     e1a:	5e                   	pop    %esi
+     e1b:	5d                   	pop    %ebp
+     e1c:	c3                   	ret
+
+00000e1d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+     e1d:	55                   	push   %ebp
+     e1e:	89 e5                	mov    %esp,%ebp
+     e20:	53                   	push   %ebx
+     e21:	8b 55 08             	mov    0x8(%ebp),%edx
+     e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     e27:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+     e2a:	eb 09                	jmp    e35 <strncmp+0x18>
+      n--, p++, q++;
+     e2c:	83 e8 01             	sub    $0x1,%eax
+     e2f:	83 c2 01             	add    $0x1,%edx
+     e32:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+     e35:	85 c0                	test   %eax,%eax
+     e37:	74 0b                	je     e44 <strncmp+0x27>
+     e39:	0f b6 1a             	movzbl (%edx),%ebx
+     e3c:	84 db                	test   %bl,%bl
+     e3e:	74 04                	je     e44 <strncmp+0x27>
+     e40:	3a 19                	cmp    (%ecx),%bl
+     e42:	74 e8                	je     e2c <strncmp+0xf>
+    if(n == 0)
+     e44:	85 c0                	test   %eax,%eax
+     e46:	74 0d                	je     e55 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+     e48:	0f b6 02             	movzbl (%edx),%eax
+     e4b:	0f b6 11             	movzbl (%ecx),%edx
+     e4e:	29 d0                	sub    %edx,%eax
+}
+     e50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e53:	c9                   	leave
+     e54:	c3                   	ret
+      return 0;
+     e55:	b8 00 00 00 00       	mov    $0x0,%eax
+     e5a:	eb f4                	jmp    e50 <strncmp+0x33>
+
+00000e5c <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     e5c:	55                   	push   %ebp
+     e5d:	89 e5                	mov    %esp,%ebp
+     e5f:	56                   	push   %esi
+     e60:	53                   	push   %ebx
+     e61:	8b 75 08             	mov    0x8(%ebp),%esi
+     e64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     e67:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+     e6a:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+     e6c:	eb 0d                	jmp    e7b <memmove+0x1f>
+    *dst++ = *src++;
+     e6e:	0f b6 01             	movzbl (%ecx),%eax
+     e71:	88 02                	mov    %al,(%edx)
+     e73:	8d 49 01             	lea    0x1(%ecx),%ecx
+     e76:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+     e79:	89 d8                	mov    %ebx,%eax
+     e7b:	8d 58 ff             	lea    -0x1(%eax),%ebx
+     e7e:	85 c0                	test   %eax,%eax
+     e80:	7f ec                	jg     e6e <memmove+0x12>
+  return vdst;
+}
+     e82:	89 f0                	mov    %esi,%eax
+     e84:	5b                   	pop    %ebx
+     e85:	5e                   	pop    %esi
+     e86:	5d                   	pop    %ebp
+     e87:	c3                   	ret
+
+00000e88 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     e88:	b8 01 00 00 00       	mov    $0x1,%eax
+     e8d:	cd 40                	int    $0x40
+     e8f:	c3                   	ret
+
+00000e90 <exit>:
+SYSCALL(exit)
+     e90:	b8 02 00 00 00       	mov    $0x2,%eax
+     e95:	cd 40                	int    $0x40
+     e97:	c3                   	ret
+
+00000e98 <wait>:
+SYSCALL(wait)
+     e98:	b8 03 00 00 00       	mov    $0x3,%eax
+     e9d:	cd 40                	int    $0x40
+     e9f:	c3                   	ret
+
+00000ea0 <pipe>:
+SYSCALL(pipe)
+     ea0:	b8 04 00 00 00       	mov    $0x4,%eax
+     ea5:	cd 40                	int    $0x40
+     ea7:	c3                   	ret
+
+00000ea8 <read>:
+SYSCALL(read)
+     ea8:	b8 05 00 00 00       	mov    $0x5,%eax
+     ead:	cd 40                	int    $0x40
+     eaf:	c3                   	ret
+
+00000eb0 <write>:
+SYSCALL(write)
+     eb0:	b8 10 00 00 00       	mov    $0x10,%eax
+     eb5:	cd 40                	int    $0x40
+     eb7:	c3                   	ret
+
+00000eb8 <close>:
+SYSCALL(close)
+     eb8:	b8 15 00 00 00       	mov    $0x15,%eax
+     ebd:	cd 40                	int    $0x40
+     ebf:	c3                   	ret
+
+00000ec0 <kill>:
+SYSCALL(kill)
+     ec0:	b8 06 00 00 00       	mov    $0x6,%eax
+     ec5:	cd 40                	int    $0x40
+     ec7:	c3                   	ret
+
+00000ec8 <exec>:
+SYSCALL(exec)
+     ec8:	b8 07 00 00 00       	mov    $0x7,%eax
+     ecd:	cd 40                	int    $0x40
+     ecf:	c3                   	ret
+
+00000ed0 <open>:
+SYSCALL(open)
+     ed0:	b8 0f 00 00 00       	mov    $0xf,%eax
+     ed5:	cd 40                	int    $0x40
+     ed7:	c3                   	ret
+
+00000ed8 <mknod>:
+SYSCALL(mknod)
+     ed8:	b8 11 00 00 00       	mov    $0x11,%eax
+     edd:	cd 40                	int    $0x40
+     edf:	c3                   	ret
+
+00000ee0 <unlink>:
+SYSCALL(unlink)
+     ee0:	b8 12 00 00 00       	mov    $0x12,%eax
+     ee5:	cd 40                	int    $0x40
+     ee7:	c3                   	ret
+
+00000ee8 <fstat>:
+SYSCALL(fstat)
+     ee8:	b8 08 00 00 00       	mov    $0x8,%eax
+     eed:	cd 40                	int    $0x40
+     eef:	c3                   	ret
+
+00000ef0 <link>:
+SYSCALL(link)
+     ef0:	b8 13 00 00 00       	mov    $0x13,%eax
+     ef5:	cd 40                	int    $0x40
+     ef7:	c3                   	ret
+
+00000ef8 <mkdir>:
+SYSCALL(mkdir)
+     ef8:	b8 14 00 00 00       	mov    $0x14,%eax
+     efd:	cd 40                	int    $0x40
+     eff:	c3                   	ret
+
+00000f00 <chdir>:
+SYSCALL(chdir)
+     f00:	b8 09 00 00 00       	mov    $0x9,%eax
+     f05:	cd 40                	int    $0x40
+     f07:	c3                   	ret
+
+00000f08 <dup>:
+SYSCALL(dup)
+     f08:	b8 0a 00 00 00       	mov    $0xa,%eax
+     f0d:	cd 40                	int    $0x40
+     f0f:	c3                   	ret
+
+00000f10 <getpid>:
+SYSCALL(getpid)
+     f10:	b8 0b 00 00 00       	mov    $0xb,%eax
+     f15:	cd 40                	int    $0x40
+     f17:	c3                   	ret
+
+00000f18 <sbrk>:
+SYSCALL(sbrk)
+     f18:	b8 0c 00 00 00       	mov    $0xc,%eax
+     f1d:	cd 40                	int    $0x40
+     f1f:	c3                   	ret
+
+00000f20 <sleep>:
+SYSCALL(sleep)
+     f20:	b8 0d 00 00 00       	mov    $0xd,%eax
+     f25:	cd 40                	int    $0x40
+     f27:	c3                   	ret
+
+00000f28 <uptime>:
+SYSCALL(uptime)
+     f28:	b8 0e 00 00 00       	mov    $0xe,%eax
+     f2d:	cd 40                	int    $0x40
+     f2f:	c3                   	ret
+
+00000f30 <halt>:
+SYSCALL(halt)
+     f30:	b8 16 00 00 00       	mov    $0x16,%eax
+     f35:	cd 40                	int    $0x40
+     f37:	c3                   	ret
+
+00000f38 <date>:
+SYSCALL(date)
+     f38:	b8 17 00 00 00       	mov    $0x17,%eax
+     f3d:	cd 40                	int    $0x40
+     f3f:	c3                   	ret
+
+00000f40 <getuid>:
+SYSCALL(getuid)
+     f40:	b8 18 00 00 00       	mov    $0x18,%eax
+     f45:	cd 40                	int    $0x40
+     f47:	c3                   	ret
+
+00000f48 <getgid>:
+SYSCALL(getgid)
+     f48:	b8 19 00 00 00       	mov    $0x19,%eax
+     f4d:	cd 40                	int    $0x40
+     f4f:	c3                   	ret
+
+00000f50 <getppid>:
+SYSCALL(getppid)
+     f50:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     f55:	cd 40                	int    $0x40
+     f57:	c3                   	ret
+
+00000f58 <setuid>:
+SYSCALL(setuid)
+     f58:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     f5d:	cd 40                	int    $0x40
+     f5f:	c3                   	ret
+
+00000f60 <setgid>:
+SYSCALL(setgid)
+     f60:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     f65:	cd 40                	int    $0x40
+     f67:	c3                   	ret
+
+00000f68 <getprocs>:
+SYSCALL(getprocs)
+     f68:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     f6d:	cd 40                	int    $0x40
+     f6f:	c3                   	ret
+
+00000f70 <getpriority>:
+SYSCALL(getpriority)
+     f70:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     f75:	cd 40                	int    $0x40
+     f77:	c3                   	ret
+
+00000f78 <setpriority>:
+SYSCALL(setpriority)
+     f78:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f7d:	cd 40                	int    $0x40
+     f7f:	c3                   	ret
+
+00000f80 <pipesize>:
+SYSCALL(pipesize)
+     f80:	b8 20 00 00 00       	mov    $0x20,%eax
+     f85:	cd 40                	int    $0x40
+     f87:	c3                   	ret
+
+00000f88 <splice>:
+SYSCALL(splice)
+     f88:	b8 21 00 00 00       	mov    $0x21,%eax
+     f8d:	cd 40                	int    $0x40
+     f8f:	c3                   	ret
+
+00000f90 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	83 ec 1c             	sub    $0x1c,%esp
+     f96:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+     f99:	6a 01                	push   $0x1
+     f9b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+     f9e:	52                   	push   %edx
+     f9f:	50                   	push   %eax
+     fa0:	e8 0b ff ff ff       	call   eb0 <write>
+}
+     fa5:	83 c4 10             	add    $0x10,%esp
+     fa8:	c9                   	leave
+     fa9:	c3                   	ret
+
+00000faa <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     faa:	55                   	push   %ebp
+     fab:	89 e5                	mov    %esp,%ebp
+     fad:	57                   	push   %edi
+     fae:	56                   	push   %esi
+     faf:	53                   	push   %ebx
+     fb0:	83 ec 2c             	sub    $0x2c,%esp
+     fb3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     fb6:	89 d0                	mov    %edx,%eax
+     fb8:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     fba:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     fbe:	0f 95 c1             	setne  %cl
+     fc1:	c1 ea 1f             	shr    $0x1f,%edx
+     fc4:	84 d1                	test   %dl,%cl
+     fc6:	74 44                	je     100c <printint+0x62>
+    neg = 1;
+    x = -xx;
+     fc8:	f7 d8                	neg    %eax
+     fca:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     fcc:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     fd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     fd8:	89 c8                	mov    %ecx,%eax
+     fda:	ba 00 00 00 00       	mov    $0x0,%edx
+     fdf:	f7 f6                	div    %esi
+     fe1:	89 df                	mov    %ebx,%edi
+     fe3:	83 c3 01             	add    $0x1,%ebx
+     fe6:	0f b6 92 78 14 00 00 	movzbl 0x1478(%edx),%edx
+     fed:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     ff1:	89 ca                	mov    %ecx,%edx
+     ff3:	89 c1                	mov    %eax,%ecx
+     ff5:	39 f2                	cmp    %esi,%edx
+     ff7:	73 df                	jae    fd8 <printint+0x2e>
+  if(neg)
+     ff9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     ffd:	74 31                	je     1030 <printint+0x86>
+    buf[i++] = '-';
+     fff:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    1004:	8d 5f 02             	lea    0x2(%edi),%ebx
+    1007:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    100a:	eb 17                	jmp    1023 <printint+0x79>
+    x = xx;
+    100c:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    100e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    1015:	eb bc                	jmp    fd3 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1017:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    101c:	89 f0                	mov    %esi,%eax
+    101e:	e8 6d ff ff ff       	call   f90 <putc>
+  while(--i >= 0)
+    1023:	83 eb 01             	sub    $0x1,%ebx
+    1026:	79 ef                	jns    1017 <printint+0x6d>
+}
+    1028:	83 c4 2c             	add    $0x2c,%esp
+    102b:	5b                   	pop    %ebx
+    102c:	5e                   	pop    %esi
+    102d:	5f                   	pop    %edi
+    102e:	5d                   	pop    %ebp
+    102f:	c3                   	ret
+    1030:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    1033:	eb ee                	jmp    1023 <printint+0x79>
+
+00001035 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1035:	55                   	push   %ebp
+    1036:	89 e5                	mov    %esp,%ebp
+    1038:	57                   	push   %edi
+    1039:	56                   	push   %esi
+    103a:	53                   	push   %ebx
+    103b:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    103e:	8d 45 10             	lea    0x10(%ebp),%eax
+    1041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+    1044:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    1049:	bb 00 00 00 00       	mov    $0x0,%ebx
+    104e:	eb 14                	jmp    1064 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    1050:	89 fa                	mov    %edi,%edx
+    1052:	8b 45 08             	mov    0x8(%ebp),%eax
+    1055:	e8 36 ff ff ff       	call   f90 <putc>
+    105a:	eb 05                	jmp    1061 <printf+0x2c>
+      }
+    } else if(state == '%'){
+    105c:	83 fe 25             	cmp    $0x25,%esi
+    105f:	74 25                	je     1086 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+    1061:	83 c3 01             	add    $0x1,%ebx
+    1064:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1067:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    106b:	84 c0                	test   %al,%al
+    106d:	0f 84 20 01 00 00    	je     1193 <printf+0x15e>
+    c = fmt[i] & 0xff;
+    1073:	0f be f8             	movsbl %al,%edi
+    1076:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    1079:	85 f6                	test   %esi,%esi
+    107b:	75 df                	jne    105c <printf+0x27>
+      if(c == '%'){
+    107d:	83 f8 25             	cmp    $0x25,%eax
+    1080:	75 ce                	jne    1050 <printf+0x1b>
+        state = '%';
+    1082:	89 c6                	mov    %eax,%esi
+    1084:	eb db                	jmp    1061 <printf+0x2c>
+      if(c == 'd'){
+    1086:	83 f8 25             	cmp    $0x25,%eax
+    1089:	0f 84 cf 00 00 00    	je     115e <printf+0x129>
+    108f:	0f 8c dd 00 00 00    	jl     1172 <printf+0x13d>
+    1095:	83 f8 78             	cmp    $0x78,%eax
+    1098:	0f 8f d4 00 00 00    	jg     1172 <printf+0x13d>
+    109e:	83 f8 63             	cmp    $0x63,%eax
+    10a1:	0f 8c cb 00 00 00    	jl     1172 <printf+0x13d>
+    10a7:	83 e8 63             	sub    $0x63,%eax
+    10aa:	83 f8 15             	cmp    $0x15,%eax
+    10ad:	0f 87 bf 00 00 00    	ja     1172 <printf+0x13d>
+    10b3:	ff 24 85 20 14 00 00 	jmp    *0x1420(,%eax,4)
+        printint(fd, *ap, 10, 1);
+    10ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    10bd:	8b 17                	mov    (%edi),%edx
+    10bf:	83 ec 0c             	sub    $0xc,%esp
+    10c2:	6a 01                	push   $0x1
+    10c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    10c9:	8b 45 08             	mov    0x8(%ebp),%eax
+    10cc:	e8 d9 fe ff ff       	call   faa <printint>
+        ap++;
+    10d1:	83 c7 04             	add    $0x4,%edi
+    10d4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    10d7:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    10da:	be 00 00 00 00       	mov    $0x0,%esi
+    10df:	eb 80                	jmp    1061 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+    10e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    10e4:	8b 17                	mov    (%edi),%edx
+    10e6:	83 ec 0c             	sub    $0xc,%esp
+    10e9:	6a 00                	push   $0x0
+    10eb:	b9 10 00 00 00       	mov    $0x10,%ecx
+    10f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f3:	e8 b2 fe ff ff       	call   faa <printint>
+        ap++;
+    10f8:	83 c7 04             	add    $0x4,%edi
+    10fb:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    10fe:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1101:	be 00 00 00 00       	mov    $0x0,%esi
+    1106:	e9 56 ff ff ff       	jmp    1061 <printf+0x2c>
+        s = (char*)*ap;
+    110b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    110e:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1110:	83 c0 04             	add    $0x4,%eax
+    1113:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    1116:	85 f6                	test   %esi,%esi
+    1118:	75 15                	jne    112f <printf+0xfa>
+          s = "(null)";
+    111a:	be 18 14 00 00       	mov    $0x1418,%esi
+    111f:	eb 0e                	jmp    112f <printf+0xfa>
+          putc(fd, *s);
+    1121:	0f be d2             	movsbl %dl,%edx
+    1124:	8b 45 08             	mov    0x8(%ebp),%eax
+    1127:	e8 64 fe ff ff       	call   f90 <putc>
+          s++;
+    112c:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    112f:	0f b6 16             	movzbl (%esi),%edx
+    1132:	84 d2                	test   %dl,%dl
+    1134:	75 eb                	jne    1121 <printf+0xec>
+      state = 0;
+    1136:	be 00 00 00 00       	mov    $0x0,%esi
+    113b:	e9 21 ff ff ff       	jmp    1061 <printf+0x2c>
+        putc(fd, *ap);
+    1140:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    1143:	0f be 17             	movsbl (%edi),%edx
+    1146:	8b 45 08             	mov    0x8(%ebp),%eax
+    1149:	e8 42 fe ff ff       	call   f90 <putc>
+        ap++;
+    114e:	83 c7 04             	add    $0x4,%edi
+    1151:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+    1154:	be 00 00 00 00       	mov    $0x0,%esi
+    1159:	e9 03 ff ff ff       	jmp    1061 <printf+0x2c>
+        putc(fd, c);
+    115e:	89 fa                	mov    %edi,%edx
+    1160:	8b 45 08             	mov    0x8(%ebp),%eax
+    1163:	e8 28 fe ff ff       	call   f90 <putc>
+      state = 0;
+    1168:	be 00 00 00 00       	mov    $0x0,%esi
+    116d:	e9 ef fe ff ff       	jmp    1061 <printf+0x2c>
+        putc(fd, '%');
+    1172:	ba 25 00 00 00       	mov    $0x25,%edx
+    1177:	8b 45 08             	mov    0x8(%ebp),%eax
+    117a:	e8 11 fe ff ff       	call   f90 <putc>
+        putc(fd, c);
+    117f:	89 fa                	mov    %edi,%edx
+    1181:	8b 45 08             	mov    0x8(%ebp),%eax
+    1184:	e8 07 fe ff ff       	call   f90 <putc>
+      state = 0;
+    1189:	be 00 00 00 00       	mov    $0x0,%esi
+    118e:	e9 ce fe ff ff       	jmp    1061 <printf+0x2c>
+    }
+  }
+}
+    1193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1196:	5b                   	pop    %ebx
+    1197:	5e                   	pop    %esi
+    1198:	5f                   	pop    %edi
+    1199:	5d                   	pop    %ebp
+    119a:	c3                   	ret
+
+0000119b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    119b:	55                   	push   %ebp
+    119c:	89 e5                	mov    %esp,%ebp
+    119e:	57                   	push   %edi
+    119f:	56                   	push   %esi
+    11a0:	53                   	push   %ebx
+    11a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    11a4:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    11a7:	a1 64 1b 00 00       	mov    0x1b64,%eax
+    11ac:	eb 02                	jmp    11b0 <free+0x15>
+    11ae:	89 d0                	mov    %edx,%eax
+    11b0:	39 c8                	cmp    %ecx,%eax
+    11b2:	73 04                	jae    11b8 <free+0x1d>
+    11b4:	3b 08                	cmp    (%eax),%ecx
+    11b6:	72 12                	jb     11ca <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11b8:	8b 10                	mov    (%eax),%edx
+    11ba:	39 d0                	cmp    %edx,%eax
+    11bc:	72 f0                	jb     11ae <free+0x13>
+    11be:	39 c8                	cmp    %ecx,%eax
+    11c0:	72 08                	jb     11ca <free+0x2f>
+    11c2:	39 d1                	cmp    %edx,%ecx
+    11c4:	72 04                	jb     11ca <free+0x2f>
+    11c6:	89 d0                	mov    %edx,%eax
+    11c8:	eb e6                	jmp    11b0 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    11ca:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    11cd:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    11d0:	8b 10                	mov    (%eax),%edx
+    11d2:	39 d7                	cmp    %edx,%edi
+    11d4:	74 19                	je     11ef <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+    11d6:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    11d9:	8b 50 04             	mov    0x4(%eax),%edx
+    11dc:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    11df:	39 ce                	cmp    %ecx,%esi
+    11e1:	74 1b                	je     11fe <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+    11e3:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+    11e5:	a3 64 1b 00 00       	mov    %eax,0x1b64
+}
+    11ea:	5b                   	pop    %ebx
+    11eb:	5e                   	pop    %esi
+    11ec:	5f                   	pop    %edi
+    11ed:	5d                   	pop    %ebp
+    11ee:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    11ef:	03 72 04             	add    0x4(%edx),%esi
+    11f2:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    11f5:	8b 10                	mov    (%eax),%edx
+    11f7:	8b 12                	mov    (%edx),%edx
+    11f9:	89 53 f8             	mov    %edx,-0x8(%ebx)
+    11fc:	eb db                	jmp    11d9 <free+0x3e>
+    p->s.size += bp->s.size;
+    11fe:	03 53 fc             	add    -0x4(%ebx),%edx
+    1201:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    1204:	8b 53 f8             	mov    -0x8(%ebx),%edx
+    1207:	89 10                	mov    %edx,(%eax)
+    1209:	eb da                	jmp    11e5 <free+0x4a>
+
+0000120b <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    120b:	55                   	push   %ebp
+    120c:	89 e5                	mov    %esp,%ebp
+    120e:	53                   	push   %ebx
+    120f:	83 ec 04             	sub    $0x4,%esp
+    1212:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1214:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    1219:	77 05                	ja     1220 <morecore+0x15>
+    nu = 4096;
+    121b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1220:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    1227:	83 ec 0c             	sub    $0xc,%esp
+    122a:	50                   	push   %eax
+    122b:	e8 e8 fc ff ff       	call   f18 <sbrk>
+  if(p == (char*)-1)
+    1230:	83 c4 10             	add    $0x10,%esp
+    1233:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1236:	74 1c                	je     1254 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+    1238:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    123b:	83 c0 08             	add    $0x8,%eax
+    123e:	83 ec 0c             	sub    $0xc,%esp
+    1241:	50                   	push   %eax
+    1242:	e8 54 ff ff ff       	call   119b <free>
+  return freep;
+    1247:	a1 64 1b 00 00       	mov    0x1b64,%eax
+    124c:	83 c4 10             	add    $0x10,%esp
+}
+    124f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1252:	c9                   	leave
+    1253:	c3                   	ret
+    return 0;
+    1254:	b8 00 00 00 00       	mov    $0x0,%eax
+    1259:	eb f4                	jmp    124f <morecore+0x44>
+
+0000125b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    125b:	55                   	push   %ebp
+    125c:	89 e5                	mov    %esp,%ebp
+    125e:	53                   	push   %ebx
+    125f:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1262:	8b 45 08             	mov    0x8(%ebp),%eax
+    1265:	8d 58 07             	lea    0x7(%eax),%ebx
+    1268:	c1 eb 03             	shr    $0x3,%ebx
+    126b:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    126e:	8b 0d 64 1b 00 00    	mov    0x1b64,%ecx
+    1274:	85 c9                	test   %ecx,%ecx
+    1276:	74 04                	je     127c <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1278:	8b 01                	mov    (%ecx),%eax
+    127a:	eb 4a                	jmp    12c6 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+    127c:	c7 05 64 1b 00 00 68 	movl   $0x1b68,0x1b64
+    1283:	1b 00 00 
+    1286:	c7 05 68 1b 00 00 68 	movl   $0x1b68,0x1b68
+    128d:	1b 00 00 
+    base.s.size = 0;
+    1290:	c7 05 6c 1b 00 00 00 	movl   $0x0,0x1b6c
+    1297:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+    129a:	b9 68 1b 00 00       	mov    $0x1b68,%ecx
+    129f:	eb d7                	jmp    1278 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+    12a1:	74 19                	je     12bc <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    12a3:	29 da                	sub    %ebx,%edx
+    12a5:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    12a8:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+    12ab:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    12ae:	89 0d 64 1b 00 00    	mov    %ecx,0x1b64
+      return (void*)(p + 1);
+    12b4:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    12b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12ba:	c9                   	leave
+    12bb:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    12bc:	8b 10                	mov    (%eax),%edx
+    12be:	89 11                	mov    %edx,(%ecx)
+    12c0:	eb ec                	jmp    12ae <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    12c2:	89 c1                	mov    %eax,%ecx
+    12c4:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+    12c6:	8b 50 04             	mov    0x4(%eax),%edx
+    12c9:	39 da                	cmp    %ebx,%edx
+    12cb:	73 d4                	jae    12a1 <malloc+0x46>
+    if(p == freep)
+    12cd:	39 05 64 1b 00 00    	cmp    %eax,0x1b64
+    12d3:	75 ed                	jne    12c2 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+    12d5:	89 d8                	mov    %ebx,%eax
+    12d7:	e8 2f ff ff ff       	call   120b <morecore>
+    12dc:	85 c0                	test   %eax,%eax
+    12de:	75 e2                	jne    12c2 <malloc+0x67>
+    12e0:	eb d5                	jmp    12b7 <malloc+0x5c>
@@ -31,3 +31,5 @@
 #define SYS_getprocs SYS_setgid+1
 #define SYS_getpriority SYS_getprocs+1
 #define SYS_setpriority SYS_getpriority+1
+#define SYS_pipesize SYS_setpriority+1
+#define SYS_splice SYS_pipesize+1
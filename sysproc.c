@@ -65,18 +65,12 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      return -1;
-    }
-    sleep(&ticks, (struct spinlock *)0);
-  }
-  return 0;
+  if(n <= 0)
+    return 0;
+  return sleepticks(n);
 }
 
 // return how many clock tick interrupts have occurred
@@ -107,7 +101,7 @@ sys_date(void)
 {
   struct rtcdate *d;
 
-  if(argptr(0, (void*)&d, sizeof(struct rtcdate)) < 0)
+  if(argptrw(0, (void*)&d, sizeof(struct rtcdate)) < 0)
     return -1;
   cmostime(d);
   return 0;
@@ -180,7 +174,7 @@ sys_getprocs(void)
   struct uproc *up;
   if(argint(0, &max) < 0)
     return -1;
-  if((argptr(1, (void*)&up, max*sizeof(*up))< 0))
+  if((argptrw(1, (void*)&up, max*sizeof(*up))< 0))
     return -1;
   if(max <= 64)	  
     return getprocs(max, up);
@@ -0,0 +1,1280 @@
+
+_testSched:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <countForever>:
+#define PrioCount 7
+#define numChildren 10
+
+void
+countForever(int i)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	8b 75 08             	mov    0x8(%ebp),%esi
+  int j, p, rc;
+  unsigned long count = 0;
+
+  j = getpid();
+   c:	e8 ef 03 00 00       	call   400 <getpid>
+  11:	89 c7                	mov    %eax,%edi
+  p = i%PrioCount;
+  13:	ba 93 24 49 92       	mov    $0x92492493,%edx
+  18:	89 f0                	mov    %esi,%eax
+  1a:	f7 ea                	imul   %edx
+  1c:	8d 1c 32             	lea    (%edx,%esi,1),%ebx
+  1f:	c1 fb 02             	sar    $0x2,%ebx
+  22:	89 f0                	mov    %esi,%eax
+  24:	c1 f8 1f             	sar    $0x1f,%eax
+  27:	29 c3                	sub    %eax,%ebx
+  29:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  30:	29 d8                	sub    %ebx,%eax
+  32:	29 c6                	sub    %eax,%esi
+  rc = setpriority(j, p);
+  34:	83 ec 08             	sub    $0x8,%esp
+  37:	56                   	push   %esi
+  38:	57                   	push   %edi
+  39:	e8 2a 04 00 00       	call   468 <setpriority>
+  if (rc == 0)
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	85 c0                	test   %eax,%eax
+  43:	75 6d                	jne    b2 <countForever+0xb2>
+  45:	89 f3                	mov    %esi,%ebx
+    printf(1, "%d: start prio %d\n", j, p);
+  47:	56                   	push   %esi
+  48:	57                   	push   %edi
+  49:	68 d4 07 00 00       	push   $0x7d4
+  4e:	6a 01                	push   $0x1
+  50:	e8 d0 04 00 00       	call   525 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  unsigned long count = 0;
+  58:	be 00 00 00 00       	mov    $0x0,%esi
+    printf(1, "setpriority failed. file %s at %d\n", __FILE__, __LINE__);
+    exit();
+  }
+
+  while (1) {
+    count++;
+  5d:	83 c6 01             	add    $0x1,%esi
+    if ((count & (0x1FFFFFFF)) == 0) {
+  60:	f7 c6 ff ff ff 1f    	test   $0x1fffffff,%esi
+  66:	75 f5                	jne    5d <countForever+0x5d>
+      p = (p+1) % PrioCount;
+  68:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  6b:	ba 93 24 49 92       	mov    $0x92492493,%edx
+  70:	89 c8                	mov    %ecx,%eax
+  72:	f7 ea                	imul   %edx
+  74:	8d 1c 0a             	lea    (%edx,%ecx,1),%ebx
+  77:	c1 fb 02             	sar    $0x2,%ebx
+  7a:	89 c8                	mov    %ecx,%eax
+  7c:	c1 f8 1f             	sar    $0x1f,%eax
+  7f:	29 c3                	sub    %eax,%ebx
+  81:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  88:	29 d8                	sub    %ebx,%eax
+  8a:	29 c1                	sub    %eax,%ecx
+  8c:	89 cb                	mov    %ecx,%ebx
+      rc = setpriority(j, p);
+  8e:	83 ec 08             	sub    $0x8,%esp
+  91:	51                   	push   %ecx
+  92:	57                   	push   %edi
+  93:	e8 d0 03 00 00       	call   468 <setpriority>
+      if (rc == 0)
+  98:	83 c4 10             	add    $0x10,%esp
+  9b:	85 c0                	test   %eax,%eax
+  9d:	75 2b                	jne    ca <countForever+0xca>
+         printf(1, "%d: new prio %d\n", j, p);
+  9f:	53                   	push   %ebx
+  a0:	57                   	push   %edi
+  a1:	68 f3 07 00 00       	push   $0x7f3
+  a6:	6a 01                	push   $0x1
+  a8:	e8 78 04 00 00       	call   525 <printf>
+  ad:	83 c4 10             	add    $0x10,%esp
+  b0:	eb ab                	jmp    5d <countForever+0x5d>
+    printf(1, "setpriority failed. file %s at %d\n", __FILE__, __LINE__);
+  b2:	6a 15                	push   $0x15
+  b4:	68 e7 07 00 00       	push   $0x7e7
+  b9:	68 04 08 00 00       	push   $0x804
+  be:	6a 01                	push   $0x1
+  c0:	e8 60 04 00 00       	call   525 <printf>
+    exit();
+  c5:	e8 b6 02 00 00       	call   380 <exit>
+      else {
+         printf(1, "setpriority failed. file %s at %d\n", __FILE__, __LINE__);
+  ca:	6a 21                	push   $0x21
+  cc:	68 e7 07 00 00       	push   $0x7e7
+  d1:	68 04 08 00 00       	push   $0x804
+  d6:	6a 01                	push   $0x1
+  d8:	e8 48 04 00 00       	call   525 <printf>
+         exit();
+  dd:	e8 9e 02 00 00       	call   380 <exit>
+
+000000e2 <main>:
+  }
+}
+
+int
+main(void)
+{
+  e2:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  e6:	83 e4 f0             	and    $0xfffffff0,%esp
+  e9:	ff 71 fc             	push   -0x4(%ecx)
+  ec:	55                   	push   %ebp
+  ed:	89 e5                	mov    %esp,%ebp
+  ef:	53                   	push   %ebx
+  f0:	51                   	push   %ecx
+  int i, rc;
+
+  for (i=0; i<numChildren; i++) {
+  f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  f6:	83 fb 09             	cmp    $0x9,%ebx
+  f9:	7f 17                	jg     112 <main+0x30>
+    rc = fork();
+  fb:	e8 78 02 00 00       	call   378 <fork>
+    if (!rc) { // child
+ 100:	85 c0                	test   %eax,%eax
+ 102:	74 05                	je     109 <main+0x27>
+  for (i=0; i<numChildren; i++) {
+ 104:	83 c3 01             	add    $0x1,%ebx
+ 107:	eb ed                	jmp    f6 <main+0x14>
+      countForever(i);
+ 109:	83 ec 0c             	sub    $0xc,%esp
+ 10c:	53                   	push   %ebx
+ 10d:	e8 ee fe ff ff       	call   0 <countForever>
+    }
+  }
+  // what the heck, let's have the parent waste time as well!
+  countForever(1);
+ 112:	83 ec 0c             	sub    $0xc,%esp
+ 115:	6a 01                	push   $0x1
+ 117:	e8 e4 fe ff ff       	call   0 <countForever>
+
+0000011c <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 11c:	55                   	push   %ebp
+ 11d:	89 e5                	mov    %esp,%ebp
+ 11f:	56                   	push   %esi
+ 120:	53                   	push   %ebx
+ 121:	8b 75 08             	mov    0x8(%ebp),%esi
+ 124:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 127:	89 f0                	mov    %esi,%eax
+ 129:	89 d1                	mov    %edx,%ecx
+ 12b:	83 c2 01             	add    $0x1,%edx
+ 12e:	89 c3                	mov    %eax,%ebx
+ 130:	83 c0 01             	add    $0x1,%eax
+ 133:	0f b6 09             	movzbl (%ecx),%ecx
+ 136:	88 0b                	mov    %cl,(%ebx)
+ 138:	84 c9                	test   %cl,%cl
+ 13a:	75 ed                	jne    129 <strcpy+0xd>
+    ;
+  return os;
+}
+ 13c:	89 f0                	mov    %esi,%eax
+ 13e:	5b                   	pop    %ebx
+ 13f:	5e                   	pop    %esi
+ 140:	5d                   	pop    %ebp
+ 141:	c3                   	ret
+
+00000142 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 142:	55                   	push   %ebp
+ 143:	89 e5                	mov    %esp,%ebp
+ 145:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 148:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 14b:	eb 06                	jmp    153 <strcmp+0x11>
+    p++, q++;
+ 14d:	83 c1 01             	add    $0x1,%ecx
+ 150:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 153:	0f b6 01             	movzbl (%ecx),%eax
+ 156:	84 c0                	test   %al,%al
+ 158:	74 04                	je     15e <strcmp+0x1c>
+ 15a:	3a 02                	cmp    (%edx),%al
+ 15c:	74 ef                	je     14d <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 15e:	0f b6 c0             	movzbl %al,%eax
+ 161:	0f b6 12             	movzbl (%edx),%edx
+ 164:	29 d0                	sub    %edx,%eax
+}
+ 166:	5d                   	pop    %ebp
+ 167:	c3                   	ret
+
+00000168 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 168:	55                   	push   %ebp
+ 169:	89 e5                	mov    %esp,%ebp
+ 16b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 16e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 173:	eb 03                	jmp    178 <strlen+0x10>
+ 175:	83 c0 01             	add    $0x1,%eax
+ 178:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 17c:	75 f7                	jne    175 <strlen+0xd>
+    ;
+  return n;
+}
+ 17e:	5d                   	pop    %ebp
+ 17f:	c3                   	ret
+
+00000180 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 187:	89 d7                	mov    %edx,%edi
+ 189:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 18c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18f:	fc                   	cld
+ 190:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 192:	89 d0                	mov    %edx,%eax
+ 194:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+
+00000199 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 199:	55                   	push   %ebp
+ 19a:	89 e5                	mov    %esp,%ebp
+ 19c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1a3:	eb 03                	jmp    1a8 <strchr+0xf>
+ 1a5:	83 c0 01             	add    $0x1,%eax
+ 1a8:	0f b6 10             	movzbl (%eax),%edx
+ 1ab:	84 d2                	test   %dl,%dl
+ 1ad:	74 06                	je     1b5 <strchr+0x1c>
+    if(*s == c)
+ 1af:	38 ca                	cmp    %cl,%dl
+ 1b1:	75 f2                	jne    1a5 <strchr+0xc>
+ 1b3:	eb 05                	jmp    1ba <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 1b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1ba:	5d                   	pop    %ebp
+ 1bb:	c3                   	ret
+
+000001bc <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1bc:	55                   	push   %ebp
+ 1bd:	89 e5                	mov    %esp,%ebp
+ 1bf:	57                   	push   %edi
+ 1c0:	56                   	push   %esi
+ 1c1:	53                   	push   %ebx
+ 1c2:	83 ec 1c             	sub    $0x1c,%esp
+ 1c5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1cd:	89 de                	mov    %ebx,%esi
+ 1cf:	83 c3 01             	add    $0x1,%ebx
+ 1d2:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1d5:	7d 2e                	jge    205 <gets+0x49>
+    cc = read(0, &c, 1);
+ 1d7:	83 ec 04             	sub    $0x4,%esp
+ 1da:	6a 01                	push   $0x1
+ 1dc:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1df:	50                   	push   %eax
+ 1e0:	6a 00                	push   $0x0
+ 1e2:	e8 b1 01 00 00       	call   398 <read>
+    if(cc < 1)
+ 1e7:	83 c4 10             	add    $0x10,%esp
+ 1ea:	85 c0                	test   %eax,%eax
+ 1ec:	7e 17                	jle    205 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1ee:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1f2:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1f5:	3c 0a                	cmp    $0xa,%al
+ 1f7:	0f 94 c2             	sete   %dl
+ 1fa:	3c 0d                	cmp    $0xd,%al
+ 1fc:	0f 94 c0             	sete   %al
+ 1ff:	08 c2                	or     %al,%dl
+ 201:	74 ca                	je     1cd <gets+0x11>
+    buf[i++] = c;
+ 203:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 205:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 209:	89 f8                	mov    %edi,%eax
+ 20b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 20e:	5b                   	pop    %ebx
+ 20f:	5e                   	pop    %esi
+ 210:	5f                   	pop    %edi
+ 211:	5d                   	pop    %ebp
+ 212:	c3                   	ret
+
+00000213 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 213:	55                   	push   %ebp
+ 214:	89 e5                	mov    %esp,%ebp
+ 216:	56                   	push   %esi
+ 217:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 218:	83 ec 08             	sub    $0x8,%esp
+ 21b:	6a 00                	push   $0x0
+ 21d:	ff 75 08             	push   0x8(%ebp)
+ 220:	e8 9b 01 00 00       	call   3c0 <open>
+  if(fd < 0)
+ 225:	83 c4 10             	add    $0x10,%esp
+ 228:	85 c0                	test   %eax,%eax
+ 22a:	78 24                	js     250 <stat+0x3d>
+ 22c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 22e:	83 ec 08             	sub    $0x8,%esp
+ 231:	ff 75 0c             	push   0xc(%ebp)
+ 234:	50                   	push   %eax
+ 235:	e8 9e 01 00 00       	call   3d8 <fstat>
+ 23a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 23c:	89 1c 24             	mov    %ebx,(%esp)
+ 23f:	e8 64 01 00 00       	call   3a8 <close>
+  return r;
+ 244:	83 c4 10             	add    $0x10,%esp
+}
+ 247:	89 f0                	mov    %esi,%eax
+ 249:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 24c:	5b                   	pop    %ebx
+ 24d:	5e                   	pop    %esi
+ 24e:	5d                   	pop    %ebp
+ 24f:	c3                   	ret
+    return -1;
+ 250:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 255:	eb f0                	jmp    247 <stat+0x34>
+
+00000257 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 257:	55                   	push   %ebp
+ 258:	89 e5                	mov    %esp,%ebp
+ 25a:	56                   	push   %esi
+ 25b:	53                   	push   %ebx
+ 25c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 25f:	eb 03                	jmp    264 <atoi+0xd>
+ 261:	83 c2 01             	add    $0x1,%edx
+ 264:	0f b6 02             	movzbl (%edx),%eax
+ 267:	3c 20                	cmp    $0x20,%al
+ 269:	74 f6                	je     261 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 26b:	3c 2d                	cmp    $0x2d,%al
+ 26d:	74 1d                	je     28c <atoi+0x35>
+ 26f:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 274:	3c 2b                	cmp    $0x2b,%al
+ 276:	0f 94 c1             	sete   %cl
+ 279:	3c 2d                	cmp    $0x2d,%al
+ 27b:	0f 94 c0             	sete   %al
+ 27e:	08 c1                	or     %al,%cl
+ 280:	74 03                	je     285 <atoi+0x2e>
+    s++;
+ 282:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 285:	b8 00 00 00 00       	mov    $0x0,%eax
+ 28a:	eb 17                	jmp    2a3 <atoi+0x4c>
+ 28c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 291:	eb e1                	jmp    274 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 293:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 296:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 299:	83 c2 01             	add    $0x1,%edx
+ 29c:	0f be c9             	movsbl %cl,%ecx
+ 29f:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 2a3:	0f b6 0a             	movzbl (%edx),%ecx
+ 2a6:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2a9:	80 fb 09             	cmp    $0x9,%bl
+ 2ac:	76 e5                	jbe    293 <atoi+0x3c>
+  return sign*n;
+ 2ae:	0f af c6             	imul   %esi,%eax
+}
+ 2b1:	5b                   	pop    %ebx
+ 2b2:	5e                   	pop    %esi
+ 2b3:	5d                   	pop    %ebp
+ 2b4:	c3                   	ret
+
+000002b5 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2b5:	55                   	push   %ebp
+ 2b6:	89 e5                	mov    %esp,%ebp
+ 2b8:	56                   	push   %esi
+ 2b9:	53                   	push   %ebx
+ 2ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2bd:	eb 03                	jmp    2c2 <atoo+0xd>
+ 2bf:	83 c2 01             	add    $0x1,%edx
+ 2c2:	0f b6 02             	movzbl (%edx),%eax
+ 2c5:	3c 20                	cmp    $0x20,%al
+ 2c7:	74 f6                	je     2bf <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 2c9:	3c 2d                	cmp    $0x2d,%al
+ 2cb:	74 1d                	je     2ea <atoo+0x35>
+ 2cd:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2d2:	3c 2b                	cmp    $0x2b,%al
+ 2d4:	0f 94 c1             	sete   %cl
+ 2d7:	3c 2d                	cmp    $0x2d,%al
+ 2d9:	0f 94 c0             	sete   %al
+ 2dc:	08 c1                	or     %al,%cl
+ 2de:	74 03                	je     2e3 <atoo+0x2e>
+    s++;
+ 2e0:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 2e3:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2e8:	eb 11                	jmp    2fb <atoo+0x46>
+ 2ea:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2ef:	eb e1                	jmp    2d2 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 2f1:	83 c2 01             	add    $0x1,%edx
+ 2f4:	0f be c9             	movsbl %cl,%ecx
+ 2f7:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 2fb:	0f b6 0a             	movzbl (%edx),%ecx
+ 2fe:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 301:	80 fb 07             	cmp    $0x7,%bl
+ 304:	76 eb                	jbe    2f1 <atoo+0x3c>
+  return sign*n;
+ 306:	0f af c6             	imul   %esi,%eax
+}
+ 309:	5b                   	pop    %ebx
+ 30a:	5e                   	pop    %esi
+ 30b:	5d                   	pop    %ebp
+ 30c:	c3                   	ret
+
+0000030d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 30d:	55                   	push   %ebp
+ 30e:	89 e5                	mov    %esp,%ebp
+ 310:	53                   	push   %ebx
+ 311:	8b 55 08             	mov    0x8(%ebp),%edx
+ 314:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 317:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 31a:	eb 09                	jmp    325 <strncmp+0x18>
+      n--, p++, q++;
+ 31c:	83 e8 01             	sub    $0x1,%eax
+ 31f:	83 c2 01             	add    $0x1,%edx
+ 322:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 325:	85 c0                	test   %eax,%eax
+ 327:	74 0b                	je     334 <strncmp+0x27>
+ 329:	0f b6 1a             	movzbl (%edx),%ebx
+ 32c:	84 db                	test   %bl,%bl
+ 32e:	74 04                	je     334 <strncmp+0x27>
+ 330:	3a 19                	cmp    (%ecx),%bl
+ 332:	74 e8                	je     31c <strncmp+0xf>
+    if(n == 0)
+ 334:	85 c0                	test   %eax,%eax
+ 336:	74 0d                	je     345 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 338:	0f b6 02             	movzbl (%edx),%eax
+ 33b:	0f b6 11             	movzbl (%ecx),%edx
+ 33e:	29 d0                	sub    %edx,%eax
+}
+ 340:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 343:	c9                   	leave
+ 344:	c3                   	ret
+      return 0;
+ 345:	b8 00 00 00 00       	mov    $0x0,%eax
+ 34a:	eb f4                	jmp    340 <strncmp+0x33>
+
+0000034c <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 34c:	55                   	push   %ebp
+ 34d:	89 e5                	mov    %esp,%ebp
+ 34f:	56                   	push   %esi
+ 350:	53                   	push   %ebx
+ 351:	8b 75 08             	mov    0x8(%ebp),%esi
+ 354:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 357:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 35a:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 35c:	eb 0d                	jmp    36b <memmove+0x1f>
+    *dst++ = *src++;
+ 35e:	0f b6 01             	movzbl (%ecx),%eax
+ 361:	88 02                	mov    %al,(%edx)
+ 363:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 366:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 369:	89 d8                	mov    %ebx,%eax
+ 36b:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 36e:	85 c0                	test   %eax,%eax
+ 370:	7f ec                	jg     35e <memmove+0x12>
+  return vdst;
+}
+ 372:	89 f0                	mov    %esi,%eax
+ 374:	5b                   	pop    %ebx
+ 375:	5e                   	pop    %esi
+ 376:	5d                   	pop    %ebp
+ 377:	c3                   	ret
+
+00000378 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 378:	b8 01 00 00 00       	mov    $0x1,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <exit>:
+SYSCALL(exit)
+ 380:	b8 02 00 00 00       	mov    $0x2,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <wait>:
+SYSCALL(wait)
+ 388:	b8 03 00 00 00       	mov    $0x3,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <pipe>:
+SYSCALL(pipe)
+ 390:	b8 04 00 00 00       	mov    $0x4,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <read>:
+SYSCALL(read)
+ 398:	b8 05 00 00 00       	mov    $0x5,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <write>:
+SYSCALL(write)
+ 3a0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <close>:
+SYSCALL(close)
+ 3a8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <kill>:
+SYSCALL(kill)
+ 3b0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <exec>:
+SYSCALL(exec)
+ 3b8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <open>:
+SYSCALL(open)
+ 3c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <mknod>:
+SYSCALL(mknod)
+ 3c8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <unlink>:
+SYSCALL(unlink)
+ 3d0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <fstat>:
+SYSCALL(fstat)
+ 3d8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <link>:
+SYSCALL(link)
+ 3e0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <mkdir>:
+SYSCALL(mkdir)
+ 3e8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <chdir>:
+SYSCALL(chdir)
+ 3f0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <dup>:
+SYSCALL(dup)
+ 3f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <getpid>:
+SYSCALL(getpid)
+ 400:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <sbrk>:
+SYSCALL(sbrk)
+ 408:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <sleep>:
+SYSCALL(sleep)
+ 410:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <uptime>:
+SYSCALL(uptime)
+ 418:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <halt>:
+SYSCALL(halt)
+ 420:	b8 16 00 00 00       	mov    $0x16,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <date>:
+SYSCALL(date)
+ 428:	b8 17 00 00 00       	mov    $0x17,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <getuid>:
+SYSCALL(getuid)
+ 430:	b8 18 00 00 00       	mov    $0x18,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <getgid>:
+SYSCALL(getgid)
+ 438:	b8 19 00 00 00       	mov    $0x19,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <getppid>:
+SYSCALL(getppid)
+ 440:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <setuid>:
+SYSCALL(setuid)
+ 448:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <setgid>:
+SYSCALL(setgid)
+ 450:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <getprocs>:
+SYSCALL(getprocs)
+ 458:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <getpriority>:
+SYSCALL(getpriority)
+ 460:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <setpriority>:
+SYSCALL(setpriority)
+ 468:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <pipesize>:
+SYSCALL(pipesize)
+ 470:	b8 20 00 00 00       	mov    $0x20,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <splice>:
+SYSCALL(splice)
+ 478:	b8 21 00 00 00       	mov    $0x21,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	83 ec 1c             	sub    $0x1c,%esp
+ 486:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 489:	6a 01                	push   $0x1
+ 48b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 48e:	52                   	push   %edx
+ 48f:	50                   	push   %eax
+ 490:	e8 0b ff ff ff       	call   3a0 <write>
+}
+ 495:	83 c4 10             	add    $0x10,%esp
+ 498:	c9                   	leave
+ 499:	c3                   	ret
+
+0000049a <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 49a:	55                   	push   %ebp
+ 49b:	89 e5                	mov    %esp,%ebp
+ 49d:	57                   	push   %edi
+ 49e:	56                   	push   %esi
+ 49f:	53                   	push   %ebx
+ 4a0:	83 ec 2c             	sub    $0x2c,%esp
+ 4a3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 4a6:	89 d0                	mov    %edx,%eax
+ 4a8:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 4aa:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 4ae:	0f 95 c1             	setne  %cl
+ 4b1:	c1 ea 1f             	shr    $0x1f,%edx
+ 4b4:	84 d1                	test   %dl,%cl
+ 4b6:	74 44                	je     4fc <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 4b8:	f7 d8                	neg    %eax
+ 4ba:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 4bc:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 4c8:	89 c8                	mov    %ecx,%eax
+ 4ca:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4cf:	f7 f6                	div    %esi
+ 4d1:	89 df                	mov    %ebx,%edi
+ 4d3:	83 c3 01             	add    $0x1,%ebx
+ 4d6:	0f b6 92 88 08 00 00 	movzbl 0x888(%edx),%edx
+ 4dd:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 4e1:	89 ca                	mov    %ecx,%edx
+ 4e3:	89 c1                	mov    %eax,%ecx
+ 4e5:	39 f2                	cmp    %esi,%edx
+ 4e7:	73 df                	jae    4c8 <printint+0x2e>
+  if(neg)
+ 4e9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 4ed:	74 31                	je     520 <printint+0x86>
+    buf[i++] = '-';
+ 4ef:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4f4:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 4f7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4fa:	eb 17                	jmp    513 <printint+0x79>
+    x = xx;
+ 4fc:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 4fe:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 505:	eb bc                	jmp    4c3 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 507:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 50c:	89 f0                	mov    %esi,%eax
+ 50e:	e8 6d ff ff ff       	call   480 <putc>
+  while(--i >= 0)
+ 513:	83 eb 01             	sub    $0x1,%ebx
+ 516:	79 ef                	jns    507 <printint+0x6d>
+}
+ 518:	83 c4 2c             	add    $0x2c,%esp
+ 51b:	5b                   	pop    %ebx
+ 51c:	5e                   	pop    %esi
+ 51d:	5f                   	pop    %edi
+ 51e:	5d                   	pop    %ebp
+ 51f:	c3                   	ret
+ 520:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 523:	eb ee                	jmp    513 <printint+0x79>
+
+00000525 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 525:	55                   	push   %ebp
+ 526:	89 e5                	mov    %esp,%ebp
+ 528:	57                   	push   %edi
+ 529:	56                   	push   %esi
+ 52a:	53                   	push   %ebx
+ 52b:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 52e:	8d 45 10             	lea    0x10(%ebp),%eax
+ 531:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 534:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 539:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 53e:	eb 14                	jmp    554 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 540:	89 fa                	mov    %edi,%edx
+ 542:	8b 45 08             	mov    0x8(%ebp),%eax
+ 545:	e8 36 ff ff ff       	call   480 <putc>
+ 54a:	eb 05                	jmp    551 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 54c:	83 fe 25             	cmp    $0x25,%esi
+ 54f:	74 25                	je     576 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 551:	83 c3 01             	add    $0x1,%ebx
+ 554:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 557:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 55b:	84 c0                	test   %al,%al
+ 55d:	0f 84 20 01 00 00    	je     683 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 563:	0f be f8             	movsbl %al,%edi
+ 566:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 569:	85 f6                	test   %esi,%esi
+ 56b:	75 df                	jne    54c <printf+0x27>
+      if(c == '%'){
+ 56d:	83 f8 25             	cmp    $0x25,%eax
+ 570:	75 ce                	jne    540 <printf+0x1b>
+        state = '%';
+ 572:	89 c6                	mov    %eax,%esi
+ 574:	eb db                	jmp    551 <printf+0x2c>
+      if(c == 'd'){
+ 576:	83 f8 25             	cmp    $0x25,%eax
+ 579:	0f 84 cf 00 00 00    	je     64e <printf+0x129>
+ 57f:	0f 8c dd 00 00 00    	jl     662 <printf+0x13d>
+ 585:	83 f8 78             	cmp    $0x78,%eax
+ 588:	0f 8f d4 00 00 00    	jg     662 <printf+0x13d>
+ 58e:	83 f8 63             	cmp    $0x63,%eax
+ 591:	0f 8c cb 00 00 00    	jl     662 <printf+0x13d>
+ 597:	83 e8 63             	sub    $0x63,%eax
+ 59a:	83 f8 15             	cmp    $0x15,%eax
+ 59d:	0f 87 bf 00 00 00    	ja     662 <printf+0x13d>
+ 5a3:	ff 24 85 30 08 00 00 	jmp    *0x830(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 5aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5ad:	8b 17                	mov    (%edi),%edx
+ 5af:	83 ec 0c             	sub    $0xc,%esp
+ 5b2:	6a 01                	push   $0x1
+ 5b4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5bc:	e8 d9 fe ff ff       	call   49a <printint>
+        ap++;
+ 5c1:	83 c7 04             	add    $0x4,%edi
+ 5c4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 5c7:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 5ca:	be 00 00 00 00       	mov    $0x0,%esi
+ 5cf:	eb 80                	jmp    551 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 5d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5d4:	8b 17                	mov    (%edi),%edx
+ 5d6:	83 ec 0c             	sub    $0xc,%esp
+ 5d9:	6a 00                	push   $0x0
+ 5db:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e3:	e8 b2 fe ff ff       	call   49a <printint>
+        ap++;
+ 5e8:	83 c7 04             	add    $0x4,%edi
+ 5eb:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 5ee:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5f1:	be 00 00 00 00       	mov    $0x0,%esi
+ 5f6:	e9 56 ff ff ff       	jmp    551 <printf+0x2c>
+        s = (char*)*ap;
+ 5fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5fe:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 600:	83 c0 04             	add    $0x4,%eax
+ 603:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 606:	85 f6                	test   %esi,%esi
+ 608:	75 15                	jne    61f <printf+0xfa>
+          s = "(null)";
+ 60a:	be 27 08 00 00       	mov    $0x827,%esi
+ 60f:	eb 0e                	jmp    61f <printf+0xfa>
+          putc(fd, *s);
+ 611:	0f be d2             	movsbl %dl,%edx
+ 614:	8b 45 08             	mov    0x8(%ebp),%eax
+ 617:	e8 64 fe ff ff       	call   480 <putc>
+          s++;
+ 61c:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 61f:	0f b6 16             	movzbl (%esi),%edx
+ 622:	84 d2                	test   %dl,%dl
+ 624:	75 eb                	jne    611 <printf+0xec>
+      state = 0;
+ 626:	be 00 00 00 00       	mov    $0x0,%esi
+ 62b:	e9 21 ff ff ff       	jmp    551 <printf+0x2c>
+        putc(fd, *ap);
+ 630:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 633:	0f be 17             	movsbl (%edi),%edx
+ 636:	8b 45 08             	mov    0x8(%ebp),%eax
+ 639:	e8 42 fe ff ff       	call   480 <putc>
+        ap++;
+ 63e:	83 c7 04             	add    $0x4,%edi
+ 641:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 644:	be 00 00 00 00       	mov    $0x0,%esi
+ 649:	e9 03 ff ff ff       	jmp    551 <printf+0x2c>
+        putc(fd, c);
+ 64e:	89 fa                	mov    %edi,%edx
+ 650:	8b 45 08             	mov    0x8(%ebp),%eax
+ 653:	e8 28 fe ff ff       	call   480 <putc>
+      state = 0;
+ 658:	be 00 00 00 00       	mov    $0x0,%esi
+ 65d:	e9 ef fe ff ff       	jmp    551 <printf+0x2c>
+        putc(fd, '%');
+ 662:	ba 25 00 00 00       	mov    $0x25,%edx
+ 667:	8b 45 08             	mov    0x8(%ebp),%eax
+ 66a:	e8 11 fe ff ff       	call   480 <putc>
+        putc(fd, c);
+ 66f:	89 fa                	mov    %edi,%edx
+ 671:	8b 45 08             	mov    0x8(%ebp),%eax
+ 674:	e8 07 fe ff ff       	call   480 <putc>
+      state = 0;
+ 679:	be 00 00 00 00       	mov    $0x0,%esi
+ 67e:	e9 ce fe ff ff       	jmp    551 <printf+0x2c>
+    }
+  }
+}
+ 683:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 686:	5b                   	pop    %ebx
+ 687:	5e                   	pop    %esi
+ 688:	5f                   	pop    %edi
+ 689:	5d                   	pop    %ebp
+ 68a:	c3                   	ret
+
+0000068b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 68b:	55                   	push   %ebp
+ 68c:	89 e5                	mov    %esp,%ebp
+ 68e:	57                   	push   %edi
+ 68f:	56                   	push   %esi
+ 690:	53                   	push   %ebx
+ 691:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 694:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 697:	a1 a0 0b 00 00       	mov    0xba0,%eax
+ 69c:	eb 02                	jmp    6a0 <free+0x15>
+ 69e:	89 d0                	mov    %edx,%eax
+ 6a0:	39 c8                	cmp    %ecx,%eax
+ 6a2:	73 04                	jae    6a8 <free+0x1d>
+ 6a4:	3b 08                	cmp    (%eax),%ecx
+ 6a6:	72 12                	jb     6ba <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6a8:	8b 10                	mov    (%eax),%edx
+ 6aa:	39 d0                	cmp    %edx,%eax
+ 6ac:	72 f0                	jb     69e <free+0x13>
+ 6ae:	39 c8                	cmp    %ecx,%eax
+ 6b0:	72 08                	jb     6ba <free+0x2f>
+ 6b2:	39 d1                	cmp    %edx,%ecx
+ 6b4:	72 04                	jb     6ba <free+0x2f>
+ 6b6:	89 d0                	mov    %edx,%eax
+ 6b8:	eb e6                	jmp    6a0 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6ba:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6bd:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6c0:	8b 10                	mov    (%eax),%edx
+ 6c2:	39 d7                	cmp    %edx,%edi
+ 6c4:	74 19                	je     6df <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 6c6:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6c9:	8b 50 04             	mov    0x4(%eax),%edx
+ 6cc:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 6cf:	39 ce                	cmp    %ecx,%esi
+ 6d1:	74 1b                	je     6ee <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 6d3:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 6d5:	a3 a0 0b 00 00       	mov    %eax,0xba0
+}
+ 6da:	5b                   	pop    %ebx
+ 6db:	5e                   	pop    %esi
+ 6dc:	5f                   	pop    %edi
+ 6dd:	5d                   	pop    %ebp
+ 6de:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6df:	03 72 04             	add    0x4(%edx),%esi
+ 6e2:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6e5:	8b 10                	mov    (%eax),%edx
+ 6e7:	8b 12                	mov    (%edx),%edx
+ 6e9:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 6ec:	eb db                	jmp    6c9 <free+0x3e>
+    p->s.size += bp->s.size;
+ 6ee:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6f1:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6f4:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 6f7:	89 10                	mov    %edx,(%eax)
+ 6f9:	eb da                	jmp    6d5 <free+0x4a>
+
+000006fb <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6fb:	55                   	push   %ebp
+ 6fc:	89 e5                	mov    %esp,%ebp
+ 6fe:	53                   	push   %ebx
+ 6ff:	83 ec 04             	sub    $0x4,%esp
+ 702:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 704:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 709:	77 05                	ja     710 <morecore+0x15>
+    nu = 4096;
+ 70b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 710:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 717:	83 ec 0c             	sub    $0xc,%esp
+ 71a:	50                   	push   %eax
+ 71b:	e8 e8 fc ff ff       	call   408 <sbrk>
+  if(p == (char*)-1)
+ 720:	83 c4 10             	add    $0x10,%esp
+ 723:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 726:	74 1c                	je     744 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 728:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 72b:	83 c0 08             	add    $0x8,%eax
+ 72e:	83 ec 0c             	sub    $0xc,%esp
+ 731:	50                   	push   %eax
+ 732:	e8 54 ff ff ff       	call   68b <free>
+  return freep;
+ 737:	a1 a0 0b 00 00       	mov    0xba0,%eax
+ 73c:	83 c4 10             	add    $0x10,%esp
+}
+ 73f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 742:	c9                   	leave
+ 743:	c3                   	ret
+    return 0;
+ 744:	b8 00 00 00 00       	mov    $0x0,%eax
+ 749:	eb f4                	jmp    73f <morecore+0x44>
+
+0000074b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 74b:	55                   	push   %ebp
+ 74c:	89 e5                	mov    %esp,%ebp
+ 74e:	53                   	push   %ebx
+ 74f:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 752:	8b 45 08             	mov    0x8(%ebp),%eax
+ 755:	8d 58 07             	lea    0x7(%eax),%ebx
+ 758:	c1 eb 03             	shr    $0x3,%ebx
+ 75b:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 75e:	8b 0d a0 0b 00 00    	mov    0xba0,%ecx
+ 764:	85 c9                	test   %ecx,%ecx
+ 766:	74 04                	je     76c <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 768:	8b 01                	mov    (%ecx),%eax
+ 76a:	eb 4a                	jmp    7b6 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 76c:	c7 05 a0 0b 00 00 a4 	movl   $0xba4,0xba0
+ 773:	0b 00 00 
+ 776:	c7 05 a4 0b 00 00 a4 	movl   $0xba4,0xba4
+ 77d:	0b 00 00 
+    base.s.size = 0;
+ 780:	c7 05 a8 0b 00 00 00 	movl   $0x0,0xba8
+ 787:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 78a:	b9 a4 0b 00 00       	mov    $0xba4,%ecx
+ 78f:	eb d7                	jmp    768 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 791:	74 19                	je     7ac <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 793:	29 da                	sub    %ebx,%edx
+ 795:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 798:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 79b:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 79e:	89 0d a0 0b 00 00    	mov    %ecx,0xba0
+      return (void*)(p + 1);
+ 7a4:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7aa:	c9                   	leave
+ 7ab:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7ac:	8b 10                	mov    (%eax),%edx
+ 7ae:	89 11                	mov    %edx,(%ecx)
+ 7b0:	eb ec                	jmp    79e <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7b2:	89 c1                	mov    %eax,%ecx
+ 7b4:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 7b6:	8b 50 04             	mov    0x4(%eax),%edx
+ 7b9:	39 da                	cmp    %ebx,%edx
+ 7bb:	73 d4                	jae    791 <malloc+0x46>
+    if(p == freep)
+ 7bd:	39 05 a0 0b 00 00    	cmp    %eax,0xba0
+ 7c3:	75 ed                	jne    7b2 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 7c5:	89 d8                	mov    %ebx,%eax
+ 7c7:	e8 2f ff ff ff       	call   6fb <morecore>
+ 7cc:	85 c0                	test   %eax,%eax
+ 7ce:	75 e2                	jne    7b2 <malloc+0x67>
+ 7d0:	eb d5                	jmp    7a7 <malloc+0x5c>
@@ -0,0 +1,1155 @@
+
+_testsetuid:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	8b 59 04             	mov    0x4(%ecx),%ebx
+  printf(1, "***** In %s: my uid is %d\n\n", argv[0], getuid());
+  12:	e8 28 03 00 00       	call   33f <getuid>
+  17:	50                   	push   %eax
+  18:	ff 33                	push   (%ebx)
+  1a:	68 e4 06 00 00       	push   $0x6e4
+  1f:	6a 01                	push   $0x1
+  21:	e8 0e 04 00 00       	call   434 <printf>
+  exit();
+  26:	e8 64 02 00 00       	call   28f <exit>
+
+0000002b <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  2b:	55                   	push   %ebp
+  2c:	89 e5                	mov    %esp,%ebp
+  2e:	56                   	push   %esi
+  2f:	53                   	push   %ebx
+  30:	8b 75 08             	mov    0x8(%ebp),%esi
+  33:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  36:	89 f0                	mov    %esi,%eax
+  38:	89 d1                	mov    %edx,%ecx
+  3a:	83 c2 01             	add    $0x1,%edx
+  3d:	89 c3                	mov    %eax,%ebx
+  3f:	83 c0 01             	add    $0x1,%eax
+  42:	0f b6 09             	movzbl (%ecx),%ecx
+  45:	88 0b                	mov    %cl,(%ebx)
+  47:	84 c9                	test   %cl,%cl
+  49:	75 ed                	jne    38 <strcpy+0xd>
+    ;
+  return os;
+}
+  4b:	89 f0                	mov    %esi,%eax
+  4d:	5b                   	pop    %ebx
+  4e:	5e                   	pop    %esi
+  4f:	5d                   	pop    %ebp
+  50:	c3                   	ret
+
+00000051 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  51:	55                   	push   %ebp
+  52:	89 e5                	mov    %esp,%ebp
+  54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  57:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  5a:	eb 06                	jmp    62 <strcmp+0x11>
+    p++, q++;
+  5c:	83 c1 01             	add    $0x1,%ecx
+  5f:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  62:	0f b6 01             	movzbl (%ecx),%eax
+  65:	84 c0                	test   %al,%al
+  67:	74 04                	je     6d <strcmp+0x1c>
+  69:	3a 02                	cmp    (%edx),%al
+  6b:	74 ef                	je     5c <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+  6d:	0f b6 c0             	movzbl %al,%eax
+  70:	0f b6 12             	movzbl (%edx),%edx
+  73:	29 d0                	sub    %edx,%eax
+}
+  75:	5d                   	pop    %ebp
+  76:	c3                   	ret
+
+00000077 <strlen>:
+
+uint
+strlen(char *s)
+{
+  77:	55                   	push   %ebp
+  78:	89 e5                	mov    %esp,%ebp
+  7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  82:	eb 03                	jmp    87 <strlen+0x10>
+  84:	83 c0 01             	add    $0x1,%eax
+  87:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8b:	75 f7                	jne    84 <strlen+0xd>
+    ;
+  return n;
+}
+  8d:	5d                   	pop    %ebp
+  8e:	c3                   	ret
+
+0000008f <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  8f:	55                   	push   %ebp
+  90:	89 e5                	mov    %esp,%ebp
+  92:	57                   	push   %edi
+  93:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  96:	89 d7                	mov    %edx,%edi
+  98:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9e:	fc                   	cld
+  9f:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  a1:	89 d0                	mov    %edx,%eax
+  a3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  a6:	c9                   	leave
+  a7:	c3                   	ret
+
+000000a8 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  a8:	55                   	push   %ebp
+  a9:	89 e5                	mov    %esp,%ebp
+  ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  ae:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  b2:	eb 03                	jmp    b7 <strchr+0xf>
+  b4:	83 c0 01             	add    $0x1,%eax
+  b7:	0f b6 10             	movzbl (%eax),%edx
+  ba:	84 d2                	test   %dl,%dl
+  bc:	74 06                	je     c4 <strchr+0x1c>
+    if(*s == c)
+  be:	38 ca                	cmp    %cl,%dl
+  c0:	75 f2                	jne    b4 <strchr+0xc>
+  c2:	eb 05                	jmp    c9 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  c9:	5d                   	pop    %ebp
+  ca:	c3                   	ret
+
+000000cb <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  cb:	55                   	push   %ebp
+  cc:	89 e5                	mov    %esp,%ebp
+  ce:	57                   	push   %edi
+  cf:	56                   	push   %esi
+  d0:	53                   	push   %ebx
+  d1:	83 ec 1c             	sub    $0x1c,%esp
+  d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  dc:	89 de                	mov    %ebx,%esi
+  de:	83 c3 01             	add    $0x1,%ebx
+  e1:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+  e4:	7d 2e                	jge    114 <gets+0x49>
+    cc = read(0, &c, 1);
+  e6:	83 ec 04             	sub    $0x4,%esp
+  e9:	6a 01                	push   $0x1
+  eb:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  ee:	50                   	push   %eax
+  ef:	6a 00                	push   $0x0
+  f1:	e8 b1 01 00 00       	call   2a7 <read>
+    if(cc < 1)
+  f6:	83 c4 10             	add    $0x10,%esp
+  f9:	85 c0                	test   %eax,%eax
+  fb:	7e 17                	jle    114 <gets+0x49>
+      break;
+    buf[i++] = c;
+  fd:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 101:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 104:	3c 0a                	cmp    $0xa,%al
+ 106:	0f 94 c2             	sete   %dl
+ 109:	3c 0d                	cmp    $0xd,%al
+ 10b:	0f 94 c0             	sete   %al
+ 10e:	08 c2                	or     %al,%dl
+ 110:	74 ca                	je     dc <gets+0x11>
+    buf[i++] = c;
+ 112:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 114:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 118:	89 f8                	mov    %edi,%eax
+ 11a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 11d:	5b                   	pop    %ebx
+ 11e:	5e                   	pop    %esi
+ 11f:	5f                   	pop    %edi
+ 120:	5d                   	pop    %ebp
+ 121:	c3                   	ret
+
+00000122 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 122:	55                   	push   %ebp
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	56                   	push   %esi
+ 126:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 127:	83 ec 08             	sub    $0x8,%esp
+ 12a:	6a 00                	push   $0x0
+ 12c:	ff 75 08             	push   0x8(%ebp)
+ 12f:	e8 9b 01 00 00       	call   2cf <open>
+  if(fd < 0)
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	78 24                	js     15f <stat+0x3d>
+ 13b:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 13d:	83 ec 08             	sub    $0x8,%esp
+ 140:	ff 75 0c             	push   0xc(%ebp)
+ 143:	50                   	push   %eax
+ 144:	e8 9e 01 00 00       	call   2e7 <fstat>
+ 149:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 14b:	89 1c 24             	mov    %ebx,(%esp)
+ 14e:	e8 64 01 00 00       	call   2b7 <close>
+  return r;
+ 153:	83 c4 10             	add    $0x10,%esp
+}
+ 156:	89 f0                	mov    %esi,%eax
+ 158:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 15b:	5b                   	pop    %ebx
+ 15c:	5e                   	pop    %esi
+ 15d:	5d                   	pop    %ebp
+ 15e:	c3                   	ret
+    return -1;
+ 15f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 164:	eb f0                	jmp    156 <stat+0x34>
+
+00000166 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	56                   	push   %esi
+ 16a:	53                   	push   %ebx
+ 16b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 16e:	eb 03                	jmp    173 <atoi+0xd>
+ 170:	83 c2 01             	add    $0x1,%edx
+ 173:	0f b6 02             	movzbl (%edx),%eax
+ 176:	3c 20                	cmp    $0x20,%al
+ 178:	74 f6                	je     170 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 17a:	3c 2d                	cmp    $0x2d,%al
+ 17c:	74 1d                	je     19b <atoi+0x35>
+ 17e:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 183:	3c 2b                	cmp    $0x2b,%al
+ 185:	0f 94 c1             	sete   %cl
+ 188:	3c 2d                	cmp    $0x2d,%al
+ 18a:	0f 94 c0             	sete   %al
+ 18d:	08 c1                	or     %al,%cl
+ 18f:	74 03                	je     194 <atoi+0x2e>
+    s++;
+ 191:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 194:	b8 00 00 00 00       	mov    $0x0,%eax
+ 199:	eb 17                	jmp    1b2 <atoi+0x4c>
+ 19b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1a0:	eb e1                	jmp    183 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 1a2:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 1a5:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 1a8:	83 c2 01             	add    $0x1,%edx
+ 1ab:	0f be c9             	movsbl %cl,%ecx
+ 1ae:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 1b2:	0f b6 0a             	movzbl (%edx),%ecx
+ 1b5:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 1b8:	80 fb 09             	cmp    $0x9,%bl
+ 1bb:	76 e5                	jbe    1a2 <atoi+0x3c>
+  return sign*n;
+ 1bd:	0f af c6             	imul   %esi,%eax
+}
+ 1c0:	5b                   	pop    %ebx
+ 1c1:	5e                   	pop    %esi
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	c3                   	ret
+
+000001c4 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 1c4:	55                   	push   %ebp
+ 1c5:	89 e5                	mov    %esp,%ebp
+ 1c7:	56                   	push   %esi
+ 1c8:	53                   	push   %ebx
+ 1c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1cc:	eb 03                	jmp    1d1 <atoo+0xd>
+ 1ce:	83 c2 01             	add    $0x1,%edx
+ 1d1:	0f b6 02             	movzbl (%edx),%eax
+ 1d4:	3c 20                	cmp    $0x20,%al
+ 1d6:	74 f6                	je     1ce <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 1d8:	3c 2d                	cmp    $0x2d,%al
+ 1da:	74 1d                	je     1f9 <atoo+0x35>
+ 1dc:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1e1:	3c 2b                	cmp    $0x2b,%al
+ 1e3:	0f 94 c1             	sete   %cl
+ 1e6:	3c 2d                	cmp    $0x2d,%al
+ 1e8:	0f 94 c0             	sete   %al
+ 1eb:	08 c1                	or     %al,%cl
+ 1ed:	74 03                	je     1f2 <atoo+0x2e>
+    s++;
+ 1ef:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 1f2:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1f7:	eb 11                	jmp    20a <atoo+0x46>
+ 1f9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1fe:	eb e1                	jmp    1e1 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 200:	83 c2 01             	add    $0x1,%edx
+ 203:	0f be c9             	movsbl %cl,%ecx
+ 206:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 20a:	0f b6 0a             	movzbl (%edx),%ecx
+ 20d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 210:	80 fb 07             	cmp    $0x7,%bl
+ 213:	76 eb                	jbe    200 <atoo+0x3c>
+  return sign*n;
+ 215:	0f af c6             	imul   %esi,%eax
+}
+ 218:	5b                   	pop    %ebx
+ 219:	5e                   	pop    %esi
+ 21a:	5d                   	pop    %ebp
+ 21b:	c3                   	ret
+
+0000021c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 21c:	55                   	push   %ebp
+ 21d:	89 e5                	mov    %esp,%ebp
+ 21f:	53                   	push   %ebx
+ 220:	8b 55 08             	mov    0x8(%ebp),%edx
+ 223:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 226:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 229:	eb 09                	jmp    234 <strncmp+0x18>
+      n--, p++, q++;
+ 22b:	83 e8 01             	sub    $0x1,%eax
+ 22e:	83 c2 01             	add    $0x1,%edx
+ 231:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 234:	85 c0                	test   %eax,%eax
+ 236:	74 0b                	je     243 <strncmp+0x27>
+ 238:	0f b6 1a             	movzbl (%edx),%ebx
+ 23b:	84 db                	test   %bl,%bl
+ 23d:	74 04                	je     243 <strncmp+0x27>
+ 23f:	3a 19                	cmp    (%ecx),%bl
+ 241:	74 e8                	je     22b <strncmp+0xf>
+    if(n == 0)
+ 243:	85 c0                	test   %eax,%eax
+ 245:	74 0d                	je     254 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 247:	0f b6 02             	movzbl (%edx),%eax
+ 24a:	0f b6 11             	movzbl (%ecx),%edx
+ 24d:	29 d0                	sub    %edx,%eax
+}
+ 24f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 252:	c9                   	leave
+ 253:	c3                   	ret
+      return 0;
+ 254:	b8 00 00 00 00       	mov    $0x0,%eax
+ 259:	eb f4                	jmp    24f <strncmp+0x33>
+
+0000025b <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	56                   	push   %esi
+ 25f:	53                   	push   %ebx
+ 260:	8b 75 08             	mov    0x8(%ebp),%esi
+ 263:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 266:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 269:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 26b:	eb 0d                	jmp    27a <memmove+0x1f>
+    *dst++ = *src++;
+ 26d:	0f b6 01             	movzbl (%ecx),%eax
+ 270:	88 02                	mov    %al,(%edx)
+ 272:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 275:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 278:	89 d8                	mov    %ebx,%eax
+ 27a:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 27d:	85 c0                	test   %eax,%eax
+ 27f:	7f ec                	jg     26d <memmove+0x12>
+  return vdst;
+}
+ 281:	89 f0                	mov    %esi,%eax
+ 283:	5b                   	pop    %ebx
+ 284:	5e                   	pop    %esi
+ 285:	5d                   	pop    %ebp
+ 286:	c3                   	ret
+
+00000287 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 287:	b8 01 00 00 00       	mov    $0x1,%eax
+ 28c:	cd 40                	int    $0x40
+ 28e:	c3                   	ret
+
+0000028f <exit>:
+SYSCALL(exit)
+ 28f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 294:	cd 40                	int    $0x40
+ 296:	c3                   	ret
+
+00000297 <wait>:
+SYSCALL(wait)
+ 297:	b8 03 00 00 00       	mov    $0x3,%eax
+ 29c:	cd 40                	int    $0x40
+ 29e:	c3                   	ret
+
+0000029f <pipe>:
+SYSCALL(pipe)
+ 29f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2a4:	cd 40                	int    $0x40
+ 2a6:	c3                   	ret
+
+000002a7 <read>:
+SYSCALL(read)
+ 2a7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2ac:	cd 40                	int    $0x40
+ 2ae:	c3                   	ret
+
+000002af <write>:
+SYSCALL(write)
+ 2af:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2b4:	cd 40                	int    $0x40
+ 2b6:	c3                   	ret
+
+000002b7 <close>:
+SYSCALL(close)
+ 2b7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2bc:	cd 40                	int    $0x40
+ 2be:	c3                   	ret
+
+000002bf <kill>:
+SYSCALL(kill)
+ 2bf:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2c4:	cd 40                	int    $0x40
+ 2c6:	c3                   	ret
+
+000002c7 <exec>:
+SYSCALL(exec)
+ 2c7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2cc:	cd 40                	int    $0x40
+ 2ce:	c3                   	ret
+
+000002cf <open>:
+SYSCALL(open)
+ 2cf:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2d4:	cd 40                	int    $0x40
+ 2d6:	c3                   	ret
+
+000002d7 <mknod>:
+SYSCALL(mknod)
+ 2d7:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2dc:	cd 40                	int    $0x40
+ 2de:	c3                   	ret
+
+000002df <unlink>:
+SYSCALL(unlink)
+ 2df:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2e4:	cd 40                	int    $0x40
+ 2e6:	c3                   	ret
+
+000002e7 <fstat>:
+SYSCALL(fstat)
+ 2e7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2ec:	cd 40                	int    $0x40
+ 2ee:	c3                   	ret
+
+000002ef <link>:
+SYSCALL(link)
+ 2ef:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2f4:	cd 40                	int    $0x40
+ 2f6:	c3                   	ret
+
+000002f7 <mkdir>:
+SYSCALL(mkdir)
+ 2f7:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2fc:	cd 40                	int    $0x40
+ 2fe:	c3                   	ret
+
+000002ff <chdir>:
+SYSCALL(chdir)
+ 2ff:	b8 09 00 00 00       	mov    $0x9,%eax
+ 304:	cd 40                	int    $0x40
+ 306:	c3                   	ret
+
+00000307 <dup>:
+SYSCALL(dup)
+ 307:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 30c:	cd 40                	int    $0x40
+ 30e:	c3                   	ret
+
+0000030f <getpid>:
+SYSCALL(getpid)
+ 30f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 314:	cd 40                	int    $0x40
+ 316:	c3                   	ret
+
+00000317 <sbrk>:
+SYSCALL(sbrk)
+ 317:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 31c:	cd 40                	int    $0x40
+ 31e:	c3                   	ret
+
+0000031f <sleep>:
+SYSCALL(sleep)
+ 31f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 324:	cd 40                	int    $0x40
+ 326:	c3                   	ret
+
+00000327 <uptime>:
+SYSCALL(uptime)
+ 327:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 32c:	cd 40                	int    $0x40
+ 32e:	c3                   	ret
+
+0000032f <halt>:
+SYSCALL(halt)
+ 32f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 334:	cd 40                	int    $0x40
+ 336:	c3                   	ret
+
+00000337 <date>:
+SYSCALL(date)
+ 337:	b8 17 00 00 00       	mov    $0x17,%eax
+ 33c:	cd 40                	int    $0x40
+ 33e:	c3                   	ret
+
+0000033f <getuid>:
+SYSCALL(getuid)
+ 33f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 344:	cd 40                	int    $0x40
+ 346:	c3                   	ret
+
+00000347 <getgid>:
+SYSCALL(getgid)
+ 347:	b8 19 00 00 00       	mov    $0x19,%eax
+ 34c:	cd 40                	int    $0x40
+ 34e:	c3                   	ret
+
+0000034f <getppid>:
+SYSCALL(getppid)
+ 34f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 354:	cd 40                	int    $0x40
+ 356:	c3                   	ret
+
+00000357 <setuid>:
+SYSCALL(setuid)
+ 357:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 35c:	cd 40                	int    $0x40
+ 35e:	c3                   	ret
+
+0000035f <setgid>:
+SYSCALL(setgid)
+ 35f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 364:	cd 40                	int    $0x40
+ 366:	c3                   	ret
+
+00000367 <getprocs>:
+SYSCALL(getprocs)
+ 367:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 36c:	cd 40                	int    $0x40
+ 36e:	c3                   	ret
+
+0000036f <getpriority>:
+SYSCALL(getpriority)
+ 36f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 374:	cd 40                	int    $0x40
+ 376:	c3                   	ret
+
+00000377 <setpriority>:
+SYSCALL(setpriority)
+ 377:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 37c:	cd 40                	int    $0x40
+ 37e:	c3                   	ret
+
+0000037f <pipesize>:
+SYSCALL(pipesize)
+ 37f:	b8 20 00 00 00       	mov    $0x20,%eax
+ 384:	cd 40                	int    $0x40
+ 386:	c3                   	ret
+
+00000387 <splice>:
+SYSCALL(splice)
+ 387:	b8 21 00 00 00       	mov    $0x21,%eax
+ 38c:	cd 40                	int    $0x40
+ 38e:	c3                   	ret
+
+0000038f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 38f:	55                   	push   %ebp
+ 390:	89 e5                	mov    %esp,%ebp
+ 392:	83 ec 1c             	sub    $0x1c,%esp
+ 395:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 398:	6a 01                	push   $0x1
+ 39a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 39d:	52                   	push   %edx
+ 39e:	50                   	push   %eax
+ 39f:	e8 0b ff ff ff       	call   2af <write>
+}
+ 3a4:	83 c4 10             	add    $0x10,%esp
+ 3a7:	c9                   	leave
+ 3a8:	c3                   	ret
+
+000003a9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3a9:	55                   	push   %ebp
+ 3aa:	89 e5                	mov    %esp,%ebp
+ 3ac:	57                   	push   %edi
+ 3ad:	56                   	push   %esi
+ 3ae:	53                   	push   %ebx
+ 3af:	83 ec 2c             	sub    $0x2c,%esp
+ 3b2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3b5:	89 d0                	mov    %edx,%eax
+ 3b7:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3b9:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3bd:	0f 95 c1             	setne  %cl
+ 3c0:	c1 ea 1f             	shr    $0x1f,%edx
+ 3c3:	84 d1                	test   %dl,%cl
+ 3c5:	74 44                	je     40b <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3c7:	f7 d8                	neg    %eax
+ 3c9:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3cb:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3d7:	89 c8                	mov    %ecx,%eax
+ 3d9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3de:	f7 f6                	div    %esi
+ 3e0:	89 df                	mov    %ebx,%edi
+ 3e2:	83 c3 01             	add    $0x1,%ebx
+ 3e5:	0f b6 92 60 07 00 00 	movzbl 0x760(%edx),%edx
+ 3ec:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 3f0:	89 ca                	mov    %ecx,%edx
+ 3f2:	89 c1                	mov    %eax,%ecx
+ 3f4:	39 f2                	cmp    %esi,%edx
+ 3f6:	73 df                	jae    3d7 <printint+0x2e>
+  if(neg)
+ 3f8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 3fc:	74 31                	je     42f <printint+0x86>
+    buf[i++] = '-';
+ 3fe:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 403:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 406:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 409:	eb 17                	jmp    422 <printint+0x79>
+    x = xx;
+ 40b:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 40d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 414:	eb bc                	jmp    3d2 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 416:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 41b:	89 f0                	mov    %esi,%eax
+ 41d:	e8 6d ff ff ff       	call   38f <putc>
+  while(--i >= 0)
+ 422:	83 eb 01             	sub    $0x1,%ebx
+ 425:	79 ef                	jns    416 <printint+0x6d>
+}
+ 427:	83 c4 2c             	add    $0x2c,%esp
+ 42a:	5b                   	pop    %ebx
+ 42b:	5e                   	pop    %esi
+ 42c:	5f                   	pop    %edi
+ 42d:	5d                   	pop    %ebp
+ 42e:	c3                   	ret
+ 42f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 432:	eb ee                	jmp    422 <printint+0x79>
+
+00000434 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 434:	55                   	push   %ebp
+ 435:	89 e5                	mov    %esp,%ebp
+ 437:	57                   	push   %edi
+ 438:	56                   	push   %esi
+ 439:	53                   	push   %ebx
+ 43a:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 43d:	8d 45 10             	lea    0x10(%ebp),%eax
+ 440:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 443:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 448:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 44d:	eb 14                	jmp    463 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 44f:	89 fa                	mov    %edi,%edx
+ 451:	8b 45 08             	mov    0x8(%ebp),%eax
+ 454:	e8 36 ff ff ff       	call   38f <putc>
+ 459:	eb 05                	jmp    460 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 45b:	83 fe 25             	cmp    $0x25,%esi
+ 45e:	74 25                	je     485 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 460:	83 c3 01             	add    $0x1,%ebx
+ 463:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 466:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 46a:	84 c0                	test   %al,%al
+ 46c:	0f 84 20 01 00 00    	je     592 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 472:	0f be f8             	movsbl %al,%edi
+ 475:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 478:	85 f6                	test   %esi,%esi
+ 47a:	75 df                	jne    45b <printf+0x27>
+      if(c == '%'){
+ 47c:	83 f8 25             	cmp    $0x25,%eax
+ 47f:	75 ce                	jne    44f <printf+0x1b>
+        state = '%';
+ 481:	89 c6                	mov    %eax,%esi
+ 483:	eb db                	jmp    460 <printf+0x2c>
+      if(c == 'd'){
+ 485:	83 f8 25             	cmp    $0x25,%eax
+ 488:	0f 84 cf 00 00 00    	je     55d <printf+0x129>
+ 48e:	0f 8c dd 00 00 00    	jl     571 <printf+0x13d>
+ 494:	83 f8 78             	cmp    $0x78,%eax
+ 497:	0f 8f d4 00 00 00    	jg     571 <printf+0x13d>
+ 49d:	83 f8 63             	cmp    $0x63,%eax
+ 4a0:	0f 8c cb 00 00 00    	jl     571 <printf+0x13d>
+ 4a6:	83 e8 63             	sub    $0x63,%eax
+ 4a9:	83 f8 15             	cmp    $0x15,%eax
+ 4ac:	0f 87 bf 00 00 00    	ja     571 <printf+0x13d>
+ 4b2:	ff 24 85 08 07 00 00 	jmp    *0x708(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4bc:	8b 17                	mov    (%edi),%edx
+ 4be:	83 ec 0c             	sub    $0xc,%esp
+ 4c1:	6a 01                	push   $0x1
+ 4c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cb:	e8 d9 fe ff ff       	call   3a9 <printint>
+        ap++;
+ 4d0:	83 c7 04             	add    $0x4,%edi
+ 4d3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 4d6:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4d9:	be 00 00 00 00       	mov    $0x0,%esi
+ 4de:	eb 80                	jmp    460 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 4e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4e3:	8b 17                	mov    (%edi),%edx
+ 4e5:	83 ec 0c             	sub    $0xc,%esp
+ 4e8:	6a 00                	push   $0x0
+ 4ea:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 4ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f2:	e8 b2 fe ff ff       	call   3a9 <printint>
+        ap++;
+ 4f7:	83 c7 04             	add    $0x4,%edi
+ 4fa:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 4fd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 500:	be 00 00 00 00       	mov    $0x0,%esi
+ 505:	e9 56 ff ff ff       	jmp    460 <printf+0x2c>
+        s = (char*)*ap;
+ 50a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 50d:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 50f:	83 c0 04             	add    $0x4,%eax
+ 512:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 515:	85 f6                	test   %esi,%esi
+ 517:	75 15                	jne    52e <printf+0xfa>
+          s = "(null)";
+ 519:	be 00 07 00 00       	mov    $0x700,%esi
+ 51e:	eb 0e                	jmp    52e <printf+0xfa>
+          putc(fd, *s);
+ 520:	0f be d2             	movsbl %dl,%edx
+ 523:	8b 45 08             	mov    0x8(%ebp),%eax
+ 526:	e8 64 fe ff ff       	call   38f <putc>
+          s++;
+ 52b:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 52e:	0f b6 16             	movzbl (%esi),%edx
+ 531:	84 d2                	test   %dl,%dl
+ 533:	75 eb                	jne    520 <printf+0xec>
+      state = 0;
+ 535:	be 00 00 00 00       	mov    $0x0,%esi
+ 53a:	e9 21 ff ff ff       	jmp    460 <printf+0x2c>
+        putc(fd, *ap);
+ 53f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 542:	0f be 17             	movsbl (%edi),%edx
+ 545:	8b 45 08             	mov    0x8(%ebp),%eax
+ 548:	e8 42 fe ff ff       	call   38f <putc>
+        ap++;
+ 54d:	83 c7 04             	add    $0x4,%edi
+ 550:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 553:	be 00 00 00 00       	mov    $0x0,%esi
+ 558:	e9 03 ff ff ff       	jmp    460 <printf+0x2c>
+        putc(fd, c);
+ 55d:	89 fa                	mov    %edi,%edx
+ 55f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 562:	e8 28 fe ff ff       	call   38f <putc>
+      state = 0;
+ 567:	be 00 00 00 00       	mov    $0x0,%esi
+ 56c:	e9 ef fe ff ff       	jmp    460 <printf+0x2c>
+        putc(fd, '%');
+ 571:	ba 25 00 00 00       	mov    $0x25,%edx
+ 576:	8b 45 08             	mov    0x8(%ebp),%eax
+ 579:	e8 11 fe ff ff       	call   38f <putc>
+        putc(fd, c);
+ 57e:	89 fa                	mov    %edi,%edx
+ 580:	8b 45 08             	mov    0x8(%ebp),%eax
+ 583:	e8 07 fe ff ff       	call   38f <putc>
+      state = 0;
+ 588:	be 00 00 00 00       	mov    $0x0,%esi
+ 58d:	e9 ce fe ff ff       	jmp    460 <printf+0x2c>
+    }
+  }
+}
+ 592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 595:	5b                   	pop    %ebx
+ 596:	5e                   	pop    %esi
+ 597:	5f                   	pop    %edi
+ 598:	5d                   	pop    %ebp
+ 599:	c3                   	ret
+
+0000059a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 59a:	55                   	push   %ebp
+ 59b:	89 e5                	mov    %esp,%ebp
+ 59d:	57                   	push   %edi
+ 59e:	56                   	push   %esi
+ 59f:	53                   	push   %ebx
+ 5a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5a3:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5a6:	a1 58 0a 00 00       	mov    0xa58,%eax
+ 5ab:	eb 02                	jmp    5af <free+0x15>
+ 5ad:	89 d0                	mov    %edx,%eax
+ 5af:	39 c8                	cmp    %ecx,%eax
+ 5b1:	73 04                	jae    5b7 <free+0x1d>
+ 5b3:	3b 08                	cmp    (%eax),%ecx
+ 5b5:	72 12                	jb     5c9 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5b7:	8b 10                	mov    (%eax),%edx
+ 5b9:	39 d0                	cmp    %edx,%eax
+ 5bb:	72 f0                	jb     5ad <free+0x13>
+ 5bd:	39 c8                	cmp    %ecx,%eax
+ 5bf:	72 08                	jb     5c9 <free+0x2f>
+ 5c1:	39 d1                	cmp    %edx,%ecx
+ 5c3:	72 04                	jb     5c9 <free+0x2f>
+ 5c5:	89 d0                	mov    %edx,%eax
+ 5c7:	eb e6                	jmp    5af <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5c9:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5cc:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5cf:	8b 10                	mov    (%eax),%edx
+ 5d1:	39 d7                	cmp    %edx,%edi
+ 5d3:	74 19                	je     5ee <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 5d5:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 5d8:	8b 50 04             	mov    0x4(%eax),%edx
+ 5db:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 5de:	39 ce                	cmp    %ecx,%esi
+ 5e0:	74 1b                	je     5fd <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 5e2:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 5e4:	a3 58 0a 00 00       	mov    %eax,0xa58
+}
+ 5e9:	5b                   	pop    %ebx
+ 5ea:	5e                   	pop    %esi
+ 5eb:	5f                   	pop    %edi
+ 5ec:	5d                   	pop    %ebp
+ 5ed:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 5ee:	03 72 04             	add    0x4(%edx),%esi
+ 5f1:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5f4:	8b 10                	mov    (%eax),%edx
+ 5f6:	8b 12                	mov    (%edx),%edx
+ 5f8:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 5fb:	eb db                	jmp    5d8 <free+0x3e>
+    p->s.size += bp->s.size;
+ 5fd:	03 53 fc             	add    -0x4(%ebx),%edx
+ 600:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 603:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 606:	89 10                	mov    %edx,(%eax)
+ 608:	eb da                	jmp    5e4 <free+0x4a>
+
+0000060a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 60a:	55                   	push   %ebp
+ 60b:	89 e5                	mov    %esp,%ebp
+ 60d:	53                   	push   %ebx
+ 60e:	83 ec 04             	sub    $0x4,%esp
+ 611:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 613:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 618:	77 05                	ja     61f <morecore+0x15>
+    nu = 4096;
+ 61a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 61f:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 626:	83 ec 0c             	sub    $0xc,%esp
+ 629:	50                   	push   %eax
+ 62a:	e8 e8 fc ff ff       	call   317 <sbrk>
+  if(p == (char*)-1)
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 635:	74 1c                	je     653 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 637:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 63a:	83 c0 08             	add    $0x8,%eax
+ 63d:	83 ec 0c             	sub    $0xc,%esp
+ 640:	50                   	push   %eax
+ 641:	e8 54 ff ff ff       	call   59a <free>
+  return freep;
+ 646:	a1 58 0a 00 00       	mov    0xa58,%eax
+ 64b:	83 c4 10             	add    $0x10,%esp
+}
+ 64e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 651:	c9                   	leave
+ 652:	c3                   	ret
+    return 0;
+ 653:	b8 00 00 00 00       	mov    $0x0,%eax
+ 658:	eb f4                	jmp    64e <morecore+0x44>
+
+0000065a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 65a:	55                   	push   %ebp
+ 65b:	89 e5                	mov    %esp,%ebp
+ 65d:	53                   	push   %ebx
+ 65e:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 661:	8b 45 08             	mov    0x8(%ebp),%eax
+ 664:	8d 58 07             	lea    0x7(%eax),%ebx
+ 667:	c1 eb 03             	shr    $0x3,%ebx
+ 66a:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 66d:	8b 0d 58 0a 00 00    	mov    0xa58,%ecx
+ 673:	85 c9                	test   %ecx,%ecx
+ 675:	74 04                	je     67b <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 677:	8b 01                	mov    (%ecx),%eax
+ 679:	eb 4a                	jmp    6c5 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 67b:	c7 05 58 0a 00 00 5c 	movl   $0xa5c,0xa58
+ 682:	0a 00 00 
+ 685:	c7 05 5c 0a 00 00 5c 	movl   $0xa5c,0xa5c
+ 68c:	0a 00 00 
+    base.s.size = 0;
+ 68f:	c7 05 60 0a 00 00 00 	movl   $0x0,0xa60
+ 696:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 699:	b9 5c 0a 00 00       	mov    $0xa5c,%ecx
+ 69e:	eb d7                	jmp    677 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 6a0:	74 19                	je     6bb <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6a2:	29 da                	sub    %ebx,%edx
+ 6a4:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 6a7:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 6aa:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6ad:	89 0d 58 0a 00 00    	mov    %ecx,0xa58
+      return (void*)(p + 1);
+ 6b3:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6b9:	c9                   	leave
+ 6ba:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6bb:	8b 10                	mov    (%eax),%edx
+ 6bd:	89 11                	mov    %edx,(%ecx)
+ 6bf:	eb ec                	jmp    6ad <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6c1:	89 c1                	mov    %eax,%ecx
+ 6c3:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 6c5:	8b 50 04             	mov    0x4(%eax),%edx
+ 6c8:	39 da                	cmp    %ebx,%edx
+ 6ca:	73 d4                	jae    6a0 <malloc+0x46>
+    if(p == freep)
+ 6cc:	39 05 58 0a 00 00    	cmp    %eax,0xa58
+ 6d2:	75 ed                	jne    6c1 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 6d4:	89 d8                	mov    %ebx,%eax
+ 6d6:	e8 2f ff ff ff       	call   60a <morecore>
+ 6db:	85 c0                	test   %eax,%eax
+ 6dd:	75 e2                	jne    6c1 <malloc+0x67>
+ 6df:	eb d5                	jmp    6b6 <malloc+0x5c>
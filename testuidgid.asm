@@ -0,0 +1,1494 @@
+
+_testuidgid:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <uidTest>:
+#include "types.h"
+#include "user.h"
+
+static void
+uidTest(uint nval)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 04             	sub    $0x4,%esp
+   7:	89 c3                	mov    %eax,%ebx
+  uint uid = getuid();
+   9:	e8 08 06 00 00       	call   616 <getuid>
+  printf(1, "Current UID is: %d\n", uid);
+   e:	83 ec 04             	sub    $0x4,%esp
+  11:	50                   	push   %eax
+  12:	68 b8 09 00 00       	push   $0x9b8
+  17:	6a 01                	push   $0x1
+  19:	e8 ed 06 00 00       	call   70b <printf>
+  printf(1, "Setting UID to %d\n", nval);
+  1e:	83 c4 0c             	add    $0xc,%esp
+  21:	53                   	push   %ebx
+  22:	68 cc 09 00 00       	push   $0x9cc
+  27:	6a 01                	push   $0x1
+  29:	e8 dd 06 00 00       	call   70b <printf>
+  if (setuid(nval) < 0)
+  2e:	89 1c 24             	mov    %ebx,(%esp)
+  31:	e8 f8 05 00 00       	call   62e <setuid>
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	85 c0                	test   %eax,%eax
+  3b:	78 29                	js     66 <uidTest+0x66>
+    printf(2, "Error. Invalid UID: %d\n", nval);
+  uid = getuid();
+  3d:	e8 d4 05 00 00       	call   616 <getuid>
+  printf(1, "Current UID is: %d\n", uid);
+  42:	83 ec 04             	sub    $0x4,%esp
+  45:	50                   	push   %eax
+  46:	68 b8 09 00 00       	push   $0x9b8
+  4b:	6a 01                	push   $0x1
+  4d:	e8 b9 06 00 00       	call   70b <printf>
+  sleep(5 * TPS);  // now type control-p
+  52:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+  59:	e8 98 05 00 00       	call   5f6 <sleep>
+}
+  5e:	83 c4 10             	add    $0x10,%esp
+  61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  64:	c9                   	leave
+  65:	c3                   	ret
+    printf(2, "Error. Invalid UID: %d\n", nval);
+  66:	83 ec 04             	sub    $0x4,%esp
+  69:	53                   	push   %ebx
+  6a:	68 df 09 00 00       	push   $0x9df
+  6f:	6a 02                	push   $0x2
+  71:	e8 95 06 00 00       	call   70b <printf>
+  76:	83 c4 10             	add    $0x10,%esp
+  79:	eb c2                	jmp    3d <uidTest+0x3d>
+
+0000007b <gidTest>:
+
+static void
+gidTest(uint nval)
+{
+  7b:	55                   	push   %ebp
+  7c:	89 e5                	mov    %esp,%ebp
+  7e:	53                   	push   %ebx
+  7f:	83 ec 04             	sub    $0x4,%esp
+  82:	89 c3                	mov    %eax,%ebx
+  uint gid = getgid();
+  84:	e8 95 05 00 00       	call   61e <getgid>
+  printf(1, "Current GID is: %d\n", gid);
+  89:	83 ec 04             	sub    $0x4,%esp
+  8c:	50                   	push   %eax
+  8d:	68 f7 09 00 00       	push   $0x9f7
+  92:	6a 01                	push   $0x1
+  94:	e8 72 06 00 00       	call   70b <printf>
+  printf(1, "Setting GID to %d\n", nval);
+  99:	83 c4 0c             	add    $0xc,%esp
+  9c:	53                   	push   %ebx
+  9d:	68 0b 0a 00 00       	push   $0xa0b
+  a2:	6a 01                	push   $0x1
+  a4:	e8 62 06 00 00       	call   70b <printf>
+  if (setgid(nval) < 0)
+  a9:	89 1c 24             	mov    %ebx,(%esp)
+  ac:	e8 85 05 00 00       	call   636 <setgid>
+  b1:	83 c4 10             	add    $0x10,%esp
+  b4:	85 c0                	test   %eax,%eax
+  b6:	78 32                	js     ea <gidTest+0x6f>
+    printf(2, "Error. Invalid GID: %d\n", nval);
+  setgid(nval);
+  b8:	83 ec 0c             	sub    $0xc,%esp
+  bb:	53                   	push   %ebx
+  bc:	e8 75 05 00 00       	call   636 <setgid>
+  gid = getgid();
+  c1:	e8 58 05 00 00       	call   61e <getgid>
+  printf(1, "Current GID is: %d\n", gid);
+  c6:	83 c4 0c             	add    $0xc,%esp
+  c9:	50                   	push   %eax
+  ca:	68 f7 09 00 00       	push   $0x9f7
+  cf:	6a 01                	push   $0x1
+  d1:	e8 35 06 00 00       	call   70b <printf>
+  sleep(5 * TPS);  // now type control-p
+  d6:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+  dd:	e8 14 05 00 00       	call   5f6 <sleep>
+}
+  e2:	83 c4 10             	add    $0x10,%esp
+  e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e8:	c9                   	leave
+  e9:	c3                   	ret
+    printf(2, "Error. Invalid GID: %d\n", nval);
+  ea:	83 ec 04             	sub    $0x4,%esp
+  ed:	53                   	push   %ebx
+  ee:	68 1e 0a 00 00       	push   $0xa1e
+  f3:	6a 02                	push   $0x2
+  f5:	e8 11 06 00 00       	call   70b <printf>
+  fa:	83 c4 10             	add    $0x10,%esp
+  fd:	eb b9                	jmp    b8 <gidTest+0x3d>
+
+000000ff <invalidTest>:
+    pid = wait();
+}
+
+static void
+invalidTest(uint nval)
+{
+  ff:	55                   	push   %ebp
+ 100:	89 e5                	mov    %esp,%ebp
+ 102:	53                   	push   %ebx
+ 103:	83 ec 08             	sub    $0x8,%esp
+ 106:	89 c3                	mov    %eax,%ebx
+  printf(1, "Setting UID to %d. This test should FAIL\n", nval);
+ 108:	50                   	push   %eax
+ 109:	68 58 0a 00 00       	push   $0xa58
+ 10e:	6a 01                	push   $0x1
+ 110:	e8 f6 05 00 00       	call   70b <printf>
+  if (setuid(nval) < 0)
+ 115:	89 1c 24             	mov    %ebx,(%esp)
+ 118:	e8 11 05 00 00       	call   62e <setuid>
+ 11d:	83 c4 10             	add    $0x10,%esp
+ 120:	85 c0                	test   %eax,%eax
+ 122:	78 7e                	js     1a2 <invalidTest+0xa3>
+    printf(1, "SUCCESS! The setuid sytem call indicated failure\n");
+  else
+    printf(2, "FAILURE! The setuid system call indicates success\n");
+ 124:	83 ec 08             	sub    $0x8,%esp
+ 127:	68 b8 0a 00 00       	push   $0xab8
+ 12c:	6a 02                	push   $0x2
+ 12e:	e8 d8 05 00 00       	call   70b <printf>
+ 133:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "Setting GID to %d. This test should FAIL\n", nval);
+ 136:	83 ec 04             	sub    $0x4,%esp
+ 139:	53                   	push   %ebx
+ 13a:	68 ec 0a 00 00       	push   $0xaec
+ 13f:	6a 01                	push   $0x1
+ 141:	e8 c5 05 00 00       	call   70b <printf>
+  if (setgid(nval) < 0)
+ 146:	89 1c 24             	mov    %ebx,(%esp)
+ 149:	e8 e8 04 00 00       	call   636 <setgid>
+ 14e:	83 c4 10             	add    $0x10,%esp
+ 151:	85 c0                	test   %eax,%eax
+ 153:	78 61                	js     1b6 <invalidTest+0xb7>
+    printf(1, "SUCCESS! The setgid sytem call indicated failure\n");
+  else
+    printf(2, "FAILURE! The setgid system call indicates success\n");
+ 155:	83 ec 08             	sub    $0x8,%esp
+ 158:	68 4c 0b 00 00       	push   $0xb4c
+ 15d:	6a 02                	push   $0x2
+ 15f:	e8 a7 05 00 00       	call   70b <printf>
+ 164:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "Setting UID to %d. This test should FAIL\n", -1);
+ 167:	83 ec 04             	sub    $0x4,%esp
+ 16a:	6a ff                	push   $0xffffffff
+ 16c:	68 58 0a 00 00       	push   $0xa58
+ 171:	6a 01                	push   $0x1
+ 173:	e8 93 05 00 00       	call   70b <printf>
+  if (setuid(-1) < 0)
+ 178:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+ 17f:	e8 aa 04 00 00       	call   62e <setuid>
+ 184:	83 c4 10             	add    $0x10,%esp
+ 187:	85 c0                	test   %eax,%eax
+ 189:	78 3f                	js     1ca <invalidTest+0xcb>
+    printf(1, "SUCCESS! The setuid sytem call indicated failure\n");
+  else
+    printf(2, "FAILURE! The setgid system call indicates success\n");
+ 18b:	83 ec 08             	sub    $0x8,%esp
+ 18e:	68 4c 0b 00 00       	push   $0xb4c
+ 193:	6a 02                	push   $0x2
+ 195:	e8 71 05 00 00       	call   70b <printf>
+ 19a:	83 c4 10             	add    $0x10,%esp
+}
+ 19d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a0:	c9                   	leave
+ 1a1:	c3                   	ret
+    printf(1, "SUCCESS! The setuid sytem call indicated failure\n");
+ 1a2:	83 ec 08             	sub    $0x8,%esp
+ 1a5:	68 84 0a 00 00       	push   $0xa84
+ 1aa:	6a 01                	push   $0x1
+ 1ac:	e8 5a 05 00 00       	call   70b <printf>
+ 1b1:	83 c4 10             	add    $0x10,%esp
+ 1b4:	eb 80                	jmp    136 <invalidTest+0x37>
+    printf(1, "SUCCESS! The setgid sytem call indicated failure\n");
+ 1b6:	83 ec 08             	sub    $0x8,%esp
+ 1b9:	68 18 0b 00 00       	push   $0xb18
+ 1be:	6a 01                	push   $0x1
+ 1c0:	e8 46 05 00 00       	call   70b <printf>
+ 1c5:	83 c4 10             	add    $0x10,%esp
+ 1c8:	eb 9d                	jmp    167 <invalidTest+0x68>
+    printf(1, "SUCCESS! The setuid sytem call indicated failure\n");
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	68 84 0a 00 00       	push   $0xa84
+ 1d2:	6a 01                	push   $0x1
+ 1d4:	e8 32 05 00 00       	call   70b <printf>
+ 1d9:	83 c4 10             	add    $0x10,%esp
+ 1dc:	eb bf                	jmp    19d <invalidTest+0x9e>
+
+000001de <forkTest>:
+{
+ 1de:	55                   	push   %ebp
+ 1df:	89 e5                	mov    %esp,%ebp
+ 1e1:	53                   	push   %ebx
+ 1e2:	83 ec 04             	sub    $0x4,%esp
+ 1e5:	89 c3                	mov    %eax,%ebx
+  printf(1, "Setting UID to %d and GID to %d before fork(). Value"
+ 1e7:	50                   	push   %eax
+ 1e8:	50                   	push   %eax
+ 1e9:	68 80 0b 00 00       	push   $0xb80
+ 1ee:	6a 01                	push   $0x1
+ 1f0:	e8 16 05 00 00       	call   70b <printf>
+  if (setuid(nval) < 0)
+ 1f5:	89 1c 24             	mov    %ebx,(%esp)
+ 1f8:	e8 31 04 00 00       	call   62e <setuid>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	85 c0                	test   %eax,%eax
+ 202:	78 40                	js     244 <forkTest+0x66>
+  if (setgid(nval) < 0)
+ 204:	83 ec 0c             	sub    $0xc,%esp
+ 207:	53                   	push   %ebx
+ 208:	e8 29 04 00 00       	call   636 <setgid>
+ 20d:	83 c4 10             	add    $0x10,%esp
+ 210:	85 c0                	test   %eax,%eax
+ 212:	78 45                	js     259 <forkTest+0x7b>
+  printf(1, "Before fork(), UID = %d, GID = %d\n", getuid(), getgid());
+ 214:	e8 05 04 00 00       	call   61e <getgid>
+ 219:	89 c3                	mov    %eax,%ebx
+ 21b:	e8 f6 03 00 00       	call   616 <getuid>
+ 220:	53                   	push   %ebx
+ 221:	50                   	push   %eax
+ 222:	68 cc 0b 00 00       	push   $0xbcc
+ 227:	6a 01                	push   $0x1
+ 229:	e8 dd 04 00 00       	call   70b <printf>
+  pid = fork();
+ 22e:	e8 2b 03 00 00       	call   55e <fork>
+  if (pid == 0) {  // child
+ 233:	83 c4 10             	add    $0x10,%esp
+ 236:	85 c0                	test   %eax,%eax
+ 238:	74 34                	je     26e <forkTest+0x90>
+    pid = wait();
+ 23a:	e8 2f 03 00 00       	call   56e <wait>
+}
+ 23f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 242:	c9                   	leave
+ 243:	c3                   	ret
+    printf(2, "Error. Invalid UID: %d\n", nval);
+ 244:	83 ec 04             	sub    $0x4,%esp
+ 247:	53                   	push   %ebx
+ 248:	68 df 09 00 00       	push   $0x9df
+ 24d:	6a 02                	push   $0x2
+ 24f:	e8 b7 04 00 00       	call   70b <printf>
+ 254:	83 c4 10             	add    $0x10,%esp
+ 257:	eb ab                	jmp    204 <forkTest+0x26>
+    printf(2, "Error. Invalid UID: %d\n", nval);
+ 259:	83 ec 04             	sub    $0x4,%esp
+ 25c:	53                   	push   %ebx
+ 25d:	68 df 09 00 00       	push   $0x9df
+ 262:	6a 02                	push   $0x2
+ 264:	e8 a2 04 00 00       	call   70b <printf>
+ 269:	83 c4 10             	add    $0x10,%esp
+ 26c:	eb a6                	jmp    214 <forkTest+0x36>
+    uid = getuid();
+ 26e:	e8 a3 03 00 00       	call   616 <getuid>
+ 273:	89 c3                	mov    %eax,%ebx
+    gid = getgid();
+ 275:	e8 a4 03 00 00       	call   61e <getgid>
+    printf(1, "Child: UID is: %d, GID is: %d\n", uid, gid);
+ 27a:	50                   	push   %eax
+ 27b:	53                   	push   %ebx
+ 27c:	68 f0 0b 00 00       	push   $0xbf0
+ 281:	6a 01                	push   $0x1
+ 283:	e8 83 04 00 00       	call   70b <printf>
+    sleep(5 * TPS);  // now type control-p
+ 288:	c7 04 24 88 13 00 00 	movl   $0x1388,(%esp)
+ 28f:	e8 62 03 00 00       	call   5f6 <sleep>
+    exit();
+ 294:	e8 cd 02 00 00       	call   566 <exit>
+
+00000299 <testuidgid>:
+
+static int
+testuidgid(void)
+{
+ 299:	55                   	push   %ebp
+ 29a:	89 e5                	mov    %esp,%ebp
+ 29c:	83 ec 08             	sub    $0x8,%esp
+  uint nval, ppid;
+
+  // get/set uid test
+  nval = 100;
+  uidTest(nval);
+ 29f:	b8 64 00 00 00       	mov    $0x64,%eax
+ 2a4:	e8 57 fd ff ff       	call   0 <uidTest>
+
+  // get/set gid test
+  nval = 200;
+  gidTest(nval);
+ 2a9:	b8 c8 00 00 00       	mov    $0xc8,%eax
+ 2ae:	e8 c8 fd ff ff       	call   7b <gidTest>
+
+  // getppid test
+  ppid = getppid();
+ 2b3:	e8 6e 03 00 00       	call   626 <getppid>
+  printf(1, "My parent process is: %d\n", ppid);
+ 2b8:	83 ec 04             	sub    $0x4,%esp
+ 2bb:	50                   	push   %eax
+ 2bc:	68 36 0a 00 00       	push   $0xa36
+ 2c1:	6a 01                	push   $0x1
+ 2c3:	e8 43 04 00 00       	call   70b <printf>
+
+  // fork tests to demonstrate UID/GID inheritance
+  nval = 111;
+  forkTest(nval);
+ 2c8:	b8 6f 00 00 00       	mov    $0x6f,%eax
+ 2cd:	e8 0c ff ff ff       	call   1de <forkTest>
+
+  // tests for invalid values for uid and gid
+  nval = 32800;   // 32767 is max value
+  invalidTest(nval);
+ 2d2:	b8 20 80 00 00       	mov    $0x8020,%eax
+ 2d7:	e8 23 fe ff ff       	call   ff <invalidTest>
+
+  printf(1, "Done!\n");
+ 2dc:	83 c4 08             	add    $0x8,%esp
+ 2df:	68 50 0a 00 00       	push   $0xa50
+ 2e4:	6a 01                	push   $0x1
+ 2e6:	e8 20 04 00 00       	call   70b <printf>
+  return 0;
+}
+ 2eb:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2f0:	c9                   	leave
+ 2f1:	c3                   	ret
+
+000002f2 <main>:
+
+int
+main() {
+ 2f2:	55                   	push   %ebp
+ 2f3:	89 e5                	mov    %esp,%ebp
+ 2f5:	83 e4 f0             	and    $0xfffffff0,%esp
+  testuidgid();
+ 2f8:	e8 9c ff ff ff       	call   299 <testuidgid>
+  exit();
+ 2fd:	e8 64 02 00 00       	call   566 <exit>
+
+00000302 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 302:	55                   	push   %ebp
+ 303:	89 e5                	mov    %esp,%ebp
+ 305:	56                   	push   %esi
+ 306:	53                   	push   %ebx
+ 307:	8b 75 08             	mov    0x8(%ebp),%esi
+ 30a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 30d:	89 f0                	mov    %esi,%eax
+ 30f:	89 d1                	mov    %edx,%ecx
+ 311:	83 c2 01             	add    $0x1,%edx
+ 314:	89 c3                	mov    %eax,%ebx
+ 316:	83 c0 01             	add    $0x1,%eax
+ 319:	0f b6 09             	movzbl (%ecx),%ecx
+ 31c:	88 0b                	mov    %cl,(%ebx)
+ 31e:	84 c9                	test   %cl,%cl
+ 320:	75 ed                	jne    30f <strcpy+0xd>
+    ;
+  return os;
+}
+ 322:	89 f0                	mov    %esi,%eax
+ 324:	5b                   	pop    %ebx
+ 325:	5e                   	pop    %esi
+ 326:	5d                   	pop    %ebp
+ 327:	c3                   	ret
+
+00000328 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 328:	55                   	push   %ebp
+ 329:	89 e5                	mov    %esp,%ebp
+ 32b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 32e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 331:	eb 06                	jmp    339 <strcmp+0x11>
+    p++, q++;
+ 333:	83 c1 01             	add    $0x1,%ecx
+ 336:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 339:	0f b6 01             	movzbl (%ecx),%eax
+ 33c:	84 c0                	test   %al,%al
+ 33e:	74 04                	je     344 <strcmp+0x1c>
+ 340:	3a 02                	cmp    (%edx),%al
+ 342:	74 ef                	je     333 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 344:	0f b6 c0             	movzbl %al,%eax
+ 347:	0f b6 12             	movzbl (%edx),%edx
+ 34a:	29 d0                	sub    %edx,%eax
+}
+ 34c:	5d                   	pop    %ebp
+ 34d:	c3                   	ret
+
+0000034e <strlen>:
+
+uint
+strlen(char *s)
+{
+ 34e:	55                   	push   %ebp
+ 34f:	89 e5                	mov    %esp,%ebp
+ 351:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 354:	b8 00 00 00 00       	mov    $0x0,%eax
+ 359:	eb 03                	jmp    35e <strlen+0x10>
+ 35b:	83 c0 01             	add    $0x1,%eax
+ 35e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 362:	75 f7                	jne    35b <strlen+0xd>
+    ;
+  return n;
+}
+ 364:	5d                   	pop    %ebp
+ 365:	c3                   	ret
+
+00000366 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 366:	55                   	push   %ebp
+ 367:	89 e5                	mov    %esp,%ebp
+ 369:	57                   	push   %edi
+ 36a:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 36d:	89 d7                	mov    %edx,%edi
+ 36f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 372:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 375:	fc                   	cld
+ 376:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 378:	89 d0                	mov    %edx,%eax
+ 37a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 37d:	c9                   	leave
+ 37e:	c3                   	ret
+
+0000037f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 37f:	55                   	push   %ebp
+ 380:	89 e5                	mov    %esp,%ebp
+ 382:	8b 45 08             	mov    0x8(%ebp),%eax
+ 385:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 389:	eb 03                	jmp    38e <strchr+0xf>
+ 38b:	83 c0 01             	add    $0x1,%eax
+ 38e:	0f b6 10             	movzbl (%eax),%edx
+ 391:	84 d2                	test   %dl,%dl
+ 393:	74 06                	je     39b <strchr+0x1c>
+    if(*s == c)
+ 395:	38 ca                	cmp    %cl,%dl
+ 397:	75 f2                	jne    38b <strchr+0xc>
+ 399:	eb 05                	jmp    3a0 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 39b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3a0:	5d                   	pop    %ebp
+ 3a1:	c3                   	ret
+
+000003a2 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3a2:	55                   	push   %ebp
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	57                   	push   %edi
+ 3a6:	56                   	push   %esi
+ 3a7:	53                   	push   %ebx
+ 3a8:	83 ec 1c             	sub    $0x1c,%esp
+ 3ab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 3b3:	89 de                	mov    %ebx,%esi
+ 3b5:	83 c3 01             	add    $0x1,%ebx
+ 3b8:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3bb:	7d 2e                	jge    3eb <gets+0x49>
+    cc = read(0, &c, 1);
+ 3bd:	83 ec 04             	sub    $0x4,%esp
+ 3c0:	6a 01                	push   $0x1
+ 3c2:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 3c5:	50                   	push   %eax
+ 3c6:	6a 00                	push   $0x0
+ 3c8:	e8 b1 01 00 00       	call   57e <read>
+    if(cc < 1)
+ 3cd:	83 c4 10             	add    $0x10,%esp
+ 3d0:	85 c0                	test   %eax,%eax
+ 3d2:	7e 17                	jle    3eb <gets+0x49>
+      break;
+    buf[i++] = c;
+ 3d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3d8:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 3db:	3c 0a                	cmp    $0xa,%al
+ 3dd:	0f 94 c2             	sete   %dl
+ 3e0:	3c 0d                	cmp    $0xd,%al
+ 3e2:	0f 94 c0             	sete   %al
+ 3e5:	08 c2                	or     %al,%dl
+ 3e7:	74 ca                	je     3b3 <gets+0x11>
+    buf[i++] = c;
+ 3e9:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 3eb:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 3ef:	89 f8                	mov    %edi,%eax
+ 3f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3f4:	5b                   	pop    %ebx
+ 3f5:	5e                   	pop    %esi
+ 3f6:	5f                   	pop    %edi
+ 3f7:	5d                   	pop    %ebp
+ 3f8:	c3                   	ret
+
+000003f9 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3f9:	55                   	push   %ebp
+ 3fa:	89 e5                	mov    %esp,%ebp
+ 3fc:	56                   	push   %esi
+ 3fd:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3fe:	83 ec 08             	sub    $0x8,%esp
+ 401:	6a 00                	push   $0x0
+ 403:	ff 75 08             	push   0x8(%ebp)
+ 406:	e8 9b 01 00 00       	call   5a6 <open>
+  if(fd < 0)
+ 40b:	83 c4 10             	add    $0x10,%esp
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	78 24                	js     436 <stat+0x3d>
+ 412:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 414:	83 ec 08             	sub    $0x8,%esp
+ 417:	ff 75 0c             	push   0xc(%ebp)
+ 41a:	50                   	push   %eax
+ 41b:	e8 9e 01 00 00       	call   5be <fstat>
+ 420:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 422:	89 1c 24             	mov    %ebx,(%esp)
+ 425:	e8 64 01 00 00       	call   58e <close>
+  return r;
+ 42a:	83 c4 10             	add    $0x10,%esp
+}
+ 42d:	89 f0                	mov    %esi,%eax
+ 42f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 432:	5b                   	pop    %ebx
+ 433:	5e                   	pop    %esi
+ 434:	5d                   	pop    %ebp
+ 435:	c3                   	ret
+    return -1;
+ 436:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 43b:	eb f0                	jmp    42d <stat+0x34>
+
+0000043d <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 43d:	55                   	push   %ebp
+ 43e:	89 e5                	mov    %esp,%ebp
+ 440:	56                   	push   %esi
+ 441:	53                   	push   %ebx
+ 442:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 445:	eb 03                	jmp    44a <atoi+0xd>
+ 447:	83 c2 01             	add    $0x1,%edx
+ 44a:	0f b6 02             	movzbl (%edx),%eax
+ 44d:	3c 20                	cmp    $0x20,%al
+ 44f:	74 f6                	je     447 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 451:	3c 2d                	cmp    $0x2d,%al
+ 453:	74 1d                	je     472 <atoi+0x35>
+ 455:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 45a:	3c 2b                	cmp    $0x2b,%al
+ 45c:	0f 94 c1             	sete   %cl
+ 45f:	3c 2d                	cmp    $0x2d,%al
+ 461:	0f 94 c0             	sete   %al
+ 464:	08 c1                	or     %al,%cl
+ 466:	74 03                	je     46b <atoi+0x2e>
+    s++;
+ 468:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 46b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 470:	eb 17                	jmp    489 <atoi+0x4c>
+ 472:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 477:	eb e1                	jmp    45a <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 479:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 47c:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 47f:	83 c2 01             	add    $0x1,%edx
+ 482:	0f be c9             	movsbl %cl,%ecx
+ 485:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 489:	0f b6 0a             	movzbl (%edx),%ecx
+ 48c:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 48f:	80 fb 09             	cmp    $0x9,%bl
+ 492:	76 e5                	jbe    479 <atoi+0x3c>
+  return sign*n;
+ 494:	0f af c6             	imul   %esi,%eax
+}
+ 497:	5b                   	pop    %ebx
+ 498:	5e                   	pop    %esi
+ 499:	5d                   	pop    %ebp
+ 49a:	c3                   	ret
+
+0000049b <atoo>:
+
+int
+atoo(const char *s)
+{
+ 49b:	55                   	push   %ebp
+ 49c:	89 e5                	mov    %esp,%ebp
+ 49e:	56                   	push   %esi
+ 49f:	53                   	push   %ebx
+ 4a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 4a3:	eb 03                	jmp    4a8 <atoo+0xd>
+ 4a5:	83 c2 01             	add    $0x1,%edx
+ 4a8:	0f b6 02             	movzbl (%edx),%eax
+ 4ab:	3c 20                	cmp    $0x20,%al
+ 4ad:	74 f6                	je     4a5 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 4af:	3c 2d                	cmp    $0x2d,%al
+ 4b1:	74 1d                	je     4d0 <atoo+0x35>
+ 4b3:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 4b8:	3c 2b                	cmp    $0x2b,%al
+ 4ba:	0f 94 c1             	sete   %cl
+ 4bd:	3c 2d                	cmp    $0x2d,%al
+ 4bf:	0f 94 c0             	sete   %al
+ 4c2:	08 c1                	or     %al,%cl
+ 4c4:	74 03                	je     4c9 <atoo+0x2e>
+    s++;
+ 4c6:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 4c9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4ce:	eb 11                	jmp    4e1 <atoo+0x46>
+ 4d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4d5:	eb e1                	jmp    4b8 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 4d7:	83 c2 01             	add    $0x1,%edx
+ 4da:	0f be c9             	movsbl %cl,%ecx
+ 4dd:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 4e1:	0f b6 0a             	movzbl (%edx),%ecx
+ 4e4:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 4e7:	80 fb 07             	cmp    $0x7,%bl
+ 4ea:	76 eb                	jbe    4d7 <atoo+0x3c>
+  return sign*n;
+ 4ec:	0f af c6             	imul   %esi,%eax
+}
+ 4ef:	5b                   	pop    %ebx
+ 4f0:	5e                   	pop    %esi
+ 4f1:	5d                   	pop    %ebp
+ 4f2:	c3                   	ret
+
+000004f3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 4f3:	55                   	push   %ebp
+ 4f4:	89 e5                	mov    %esp,%ebp
+ 4f6:	53                   	push   %ebx
+ 4f7:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 4fd:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 500:	eb 09                	jmp    50b <strncmp+0x18>
+      n--, p++, q++;
+ 502:	83 e8 01             	sub    $0x1,%eax
+ 505:	83 c2 01             	add    $0x1,%edx
+ 508:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 50b:	85 c0                	test   %eax,%eax
+ 50d:	74 0b                	je     51a <strncmp+0x27>
+ 50f:	0f b6 1a             	movzbl (%edx),%ebx
+ 512:	84 db                	test   %bl,%bl
+ 514:	74 04                	je     51a <strncmp+0x27>
+ 516:	3a 19                	cmp    (%ecx),%bl
+ 518:	74 e8                	je     502 <strncmp+0xf>
+    if(n == 0)
+ 51a:	85 c0                	test   %eax,%eax
+ 51c:	74 0d                	je     52b <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 51e:	0f b6 02             	movzbl (%edx),%eax
+ 521:	0f b6 11             	movzbl (%ecx),%edx
+ 524:	29 d0                	sub    %edx,%eax
+}
+ 526:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 529:	c9                   	leave
+ 52a:	c3                   	ret
+      return 0;
+ 52b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 530:	eb f4                	jmp    526 <strncmp+0x33>
+
+00000532 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 532:	55                   	push   %ebp
+ 533:	89 e5                	mov    %esp,%ebp
+ 535:	56                   	push   %esi
+ 536:	53                   	push   %ebx
+ 537:	8b 75 08             	mov    0x8(%ebp),%esi
+ 53a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 53d:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 540:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 542:	eb 0d                	jmp    551 <memmove+0x1f>
+    *dst++ = *src++;
+ 544:	0f b6 01             	movzbl (%ecx),%eax
+ 547:	88 02                	mov    %al,(%edx)
+ 549:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 54c:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 54f:	89 d8                	mov    %ebx,%eax
+ 551:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 554:	85 c0                	test   %eax,%eax
+ 556:	7f ec                	jg     544 <memmove+0x12>
+  return vdst;
+}
+ 558:	89 f0                	mov    %esi,%eax
+ 55a:	5b                   	pop    %ebx
+ 55b:	5e                   	pop    %esi
+ 55c:	5d                   	pop    %ebp
+ 55d:	c3                   	ret
+
+0000055e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 55e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <exit>:
+SYSCALL(exit)
+ 566:	b8 02 00 00 00       	mov    $0x2,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <wait>:
+SYSCALL(wait)
+ 56e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <pipe>:
+SYSCALL(pipe)
+ 576:	b8 04 00 00 00       	mov    $0x4,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <read>:
+SYSCALL(read)
+ 57e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <write>:
+SYSCALL(write)
+ 586:	b8 10 00 00 00       	mov    $0x10,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <close>:
+SYSCALL(close)
+ 58e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <kill>:
+SYSCALL(kill)
+ 596:	b8 06 00 00 00       	mov    $0x6,%eax
+ 59b:	cd 40                	int    $0x40
+ 59d:	c3                   	ret
+
+0000059e <exec>:
+SYSCALL(exec)
+ 59e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5a3:	cd 40                	int    $0x40
+ 5a5:	c3                   	ret
+
+000005a6 <open>:
+SYSCALL(open)
+ 5a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5ab:	cd 40                	int    $0x40
+ 5ad:	c3                   	ret
+
+000005ae <mknod>:
+SYSCALL(mknod)
+ 5ae:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5b3:	cd 40                	int    $0x40
+ 5b5:	c3                   	ret
+
+000005b6 <unlink>:
+SYSCALL(unlink)
+ 5b6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5bb:	cd 40                	int    $0x40
+ 5bd:	c3                   	ret
+
+000005be <fstat>:
+SYSCALL(fstat)
+ 5be:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5c3:	cd 40                	int    $0x40
+ 5c5:	c3                   	ret
+
+000005c6 <link>:
+SYSCALL(link)
+ 5c6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5cb:	cd 40                	int    $0x40
+ 5cd:	c3                   	ret
+
+000005ce <mkdir>:
+SYSCALL(mkdir)
+ 5ce:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5d3:	cd 40                	int    $0x40
+ 5d5:	c3                   	ret
+
+000005d6 <chdir>:
+SYSCALL(chdir)
+ 5d6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5db:	cd 40                	int    $0x40
+ 5dd:	c3                   	ret
+
+000005de <dup>:
+SYSCALL(dup)
+ 5de:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5e3:	cd 40                	int    $0x40
+ 5e5:	c3                   	ret
+
+000005e6 <getpid>:
+SYSCALL(getpid)
+ 5e6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5eb:	cd 40                	int    $0x40
+ 5ed:	c3                   	ret
+
+000005ee <sbrk>:
+SYSCALL(sbrk)
+ 5ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5f3:	cd 40                	int    $0x40
+ 5f5:	c3                   	ret
+
+000005f6 <sleep>:
+SYSCALL(sleep)
+ 5f6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5fb:	cd 40                	int    $0x40
+ 5fd:	c3                   	ret
+
+000005fe <uptime>:
+SYSCALL(uptime)
+ 5fe:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 603:	cd 40                	int    $0x40
+ 605:	c3                   	ret
+
+00000606 <halt>:
+SYSCALL(halt)
+ 606:	b8 16 00 00 00       	mov    $0x16,%eax
+ 60b:	cd 40                	int    $0x40
+ 60d:	c3                   	ret
+
+0000060e <date>:
+SYSCALL(date)
+ 60e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 613:	cd 40                	int    $0x40
+ 615:	c3                   	ret
+
+00000616 <getuid>:
+SYSCALL(getuid)
+ 616:	b8 18 00 00 00       	mov    $0x18,%eax
+ 61b:	cd 40                	int    $0x40
+ 61d:	c3                   	ret
+
+0000061e <getgid>:
+SYSCALL(getgid)
+ 61e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 623:	cd 40                	int    $0x40
+ 625:	c3                   	ret
+
+00000626 <getppid>:
+SYSCALL(getppid)
+ 626:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 62b:	cd 40                	int    $0x40
+ 62d:	c3                   	ret
+
+0000062e <setuid>:
+SYSCALL(setuid)
+ 62e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 633:	cd 40                	int    $0x40
+ 635:	c3                   	ret
+
+00000636 <setgid>:
+SYSCALL(setgid)
+ 636:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 63b:	cd 40                	int    $0x40
+ 63d:	c3                   	ret
+
+0000063e <getprocs>:
+SYSCALL(getprocs)
+ 63e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 643:	cd 40                	int    $0x40
+ 645:	c3                   	ret
+
+00000646 <getpriority>:
+SYSCALL(getpriority)
+ 646:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 64b:	cd 40                	int    $0x40
+ 64d:	c3                   	ret
+
+0000064e <setpriority>:
+SYSCALL(setpriority)
+ 64e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 653:	cd 40                	int    $0x40
+ 655:	c3                   	ret
+
+00000656 <pipesize>:
+SYSCALL(pipesize)
+ 656:	b8 20 00 00 00       	mov    $0x20,%eax
+ 65b:	cd 40                	int    $0x40
+ 65d:	c3                   	ret
+
+0000065e <splice>:
+SYSCALL(splice)
+ 65e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 663:	cd 40                	int    $0x40
+ 665:	c3                   	ret
+
+00000666 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 666:	55                   	push   %ebp
+ 667:	89 e5                	mov    %esp,%ebp
+ 669:	83 ec 1c             	sub    $0x1c,%esp
+ 66c:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 66f:	6a 01                	push   $0x1
+ 671:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 674:	52                   	push   %edx
+ 675:	50                   	push   %eax
+ 676:	e8 0b ff ff ff       	call   586 <write>
+}
+ 67b:	83 c4 10             	add    $0x10,%esp
+ 67e:	c9                   	leave
+ 67f:	c3                   	ret
+
+00000680 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	53                   	push   %ebx
+ 686:	83 ec 2c             	sub    $0x2c,%esp
+ 689:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 68c:	89 d0                	mov    %edx,%eax
+ 68e:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 690:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 694:	0f 95 c1             	setne  %cl
+ 697:	c1 ea 1f             	shr    $0x1f,%edx
+ 69a:	84 d1                	test   %dl,%cl
+ 69c:	74 44                	je     6e2 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 69e:	f7 d8                	neg    %eax
+ 6a0:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 6a2:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 6ae:	89 c8                	mov    %ecx,%eax
+ 6b0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6b5:	f7 f6                	div    %esi
+ 6b7:	89 df                	mov    %ebx,%edi
+ 6b9:	83 c3 01             	add    $0x1,%ebx
+ 6bc:	0f b6 92 70 0c 00 00 	movzbl 0xc70(%edx),%edx
+ 6c3:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 6c7:	89 ca                	mov    %ecx,%edx
+ 6c9:	89 c1                	mov    %eax,%ecx
+ 6cb:	39 f2                	cmp    %esi,%edx
+ 6cd:	73 df                	jae    6ae <printint+0x2e>
+  if(neg)
+ 6cf:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 6d3:	74 31                	je     706 <printint+0x86>
+    buf[i++] = '-';
+ 6d5:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 6da:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 6dd:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 6e0:	eb 17                	jmp    6f9 <printint+0x79>
+    x = xx;
+ 6e2:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 6e4:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 6eb:	eb bc                	jmp    6a9 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6ed:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 6f2:	89 f0                	mov    %esi,%eax
+ 6f4:	e8 6d ff ff ff       	call   666 <putc>
+  while(--i >= 0)
+ 6f9:	83 eb 01             	sub    $0x1,%ebx
+ 6fc:	79 ef                	jns    6ed <printint+0x6d>
+}
+ 6fe:	83 c4 2c             	add    $0x2c,%esp
+ 701:	5b                   	pop    %ebx
+ 702:	5e                   	pop    %esi
+ 703:	5f                   	pop    %edi
+ 704:	5d                   	pop    %ebp
+ 705:	c3                   	ret
+ 706:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 709:	eb ee                	jmp    6f9 <printint+0x79>
+
+0000070b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 70b:	55                   	push   %ebp
+ 70c:	89 e5                	mov    %esp,%ebp
+ 70e:	57                   	push   %edi
+ 70f:	56                   	push   %esi
+ 710:	53                   	push   %ebx
+ 711:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 714:	8d 45 10             	lea    0x10(%ebp),%eax
+ 717:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 71a:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 71f:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 724:	eb 14                	jmp    73a <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 726:	89 fa                	mov    %edi,%edx
+ 728:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72b:	e8 36 ff ff ff       	call   666 <putc>
+ 730:	eb 05                	jmp    737 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 732:	83 fe 25             	cmp    $0x25,%esi
+ 735:	74 25                	je     75c <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 737:	83 c3 01             	add    $0x1,%ebx
+ 73a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 73d:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 741:	84 c0                	test   %al,%al
+ 743:	0f 84 20 01 00 00    	je     869 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 749:	0f be f8             	movsbl %al,%edi
+ 74c:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 74f:	85 f6                	test   %esi,%esi
+ 751:	75 df                	jne    732 <printf+0x27>
+      if(c == '%'){
+ 753:	83 f8 25             	cmp    $0x25,%eax
+ 756:	75 ce                	jne    726 <printf+0x1b>
+        state = '%';
+ 758:	89 c6                	mov    %eax,%esi
+ 75a:	eb db                	jmp    737 <printf+0x2c>
+      if(c == 'd'){
+ 75c:	83 f8 25             	cmp    $0x25,%eax
+ 75f:	0f 84 cf 00 00 00    	je     834 <printf+0x129>
+ 765:	0f 8c dd 00 00 00    	jl     848 <printf+0x13d>
+ 76b:	83 f8 78             	cmp    $0x78,%eax
+ 76e:	0f 8f d4 00 00 00    	jg     848 <printf+0x13d>
+ 774:	83 f8 63             	cmp    $0x63,%eax
+ 777:	0f 8c cb 00 00 00    	jl     848 <printf+0x13d>
+ 77d:	83 e8 63             	sub    $0x63,%eax
+ 780:	83 f8 15             	cmp    $0x15,%eax
+ 783:	0f 87 bf 00 00 00    	ja     848 <printf+0x13d>
+ 789:	ff 24 85 18 0c 00 00 	jmp    *0xc18(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 790:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 793:	8b 17                	mov    (%edi),%edx
+ 795:	83 ec 0c             	sub    $0xc,%esp
+ 798:	6a 01                	push   $0x1
+ 79a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 79f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a2:	e8 d9 fe ff ff       	call   680 <printint>
+        ap++;
+ 7a7:	83 c7 04             	add    $0x4,%edi
+ 7aa:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 7ad:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 7b0:	be 00 00 00 00       	mov    $0x0,%esi
+ 7b5:	eb 80                	jmp    737 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 7b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 7ba:	8b 17                	mov    (%edi),%edx
+ 7bc:	83 ec 0c             	sub    $0xc,%esp
+ 7bf:	6a 00                	push   $0x0
+ 7c1:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c9:	e8 b2 fe ff ff       	call   680 <printint>
+        ap++;
+ 7ce:	83 c7 04             	add    $0x4,%edi
+ 7d1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 7d4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7d7:	be 00 00 00 00       	mov    $0x0,%esi
+ 7dc:	e9 56 ff ff ff       	jmp    737 <printf+0x2c>
+        s = (char*)*ap;
+ 7e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7e4:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 7e6:	83 c0 04             	add    $0x4,%eax
+ 7e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 7ec:	85 f6                	test   %esi,%esi
+ 7ee:	75 15                	jne    805 <printf+0xfa>
+          s = "(null)";
+ 7f0:	be 0f 0c 00 00       	mov    $0xc0f,%esi
+ 7f5:	eb 0e                	jmp    805 <printf+0xfa>
+          putc(fd, *s);
+ 7f7:	0f be d2             	movsbl %dl,%edx
+ 7fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7fd:	e8 64 fe ff ff       	call   666 <putc>
+          s++;
+ 802:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 805:	0f b6 16             	movzbl (%esi),%edx
+ 808:	84 d2                	test   %dl,%dl
+ 80a:	75 eb                	jne    7f7 <printf+0xec>
+      state = 0;
+ 80c:	be 00 00 00 00       	mov    $0x0,%esi
+ 811:	e9 21 ff ff ff       	jmp    737 <printf+0x2c>
+        putc(fd, *ap);
+ 816:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 819:	0f be 17             	movsbl (%edi),%edx
+ 81c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 81f:	e8 42 fe ff ff       	call   666 <putc>
+        ap++;
+ 824:	83 c7 04             	add    $0x4,%edi
+ 827:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 82a:	be 00 00 00 00       	mov    $0x0,%esi
+ 82f:	e9 03 ff ff ff       	jmp    737 <printf+0x2c>
+        putc(fd, c);
+ 834:	89 fa                	mov    %edi,%edx
+ 836:	8b 45 08             	mov    0x8(%ebp),%eax
+ 839:	e8 28 fe ff ff       	call   666 <putc>
+      state = 0;
+ 83e:	be 00 00 00 00       	mov    $0x0,%esi
+ 843:	e9 ef fe ff ff       	jmp    737 <printf+0x2c>
+        putc(fd, '%');
+ 848:	ba 25 00 00 00       	mov    $0x25,%edx
+ 84d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 850:	e8 11 fe ff ff       	call   666 <putc>
+        putc(fd, c);
+ 855:	89 fa                	mov    %edi,%edx
+ 857:	8b 45 08             	mov    0x8(%ebp),%eax
+ 85a:	e8 07 fe ff ff       	call   666 <putc>
+      state = 0;
+ 85f:	be 00 00 00 00       	mov    $0x0,%esi
+ 864:	e9 ce fe ff ff       	jmp    737 <printf+0x2c>
+    }
+  }
+}
+ 869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 86c:	5b                   	pop    %ebx
+ 86d:	5e                   	pop    %esi
+ 86e:	5f                   	pop    %edi
+ 86f:	5d                   	pop    %ebp
+ 870:	c3                   	ret
+
+00000871 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 871:	55                   	push   %ebp
+ 872:	89 e5                	mov    %esp,%ebp
+ 874:	57                   	push   %edi
+ 875:	56                   	push   %esi
+ 876:	53                   	push   %ebx
+ 877:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 87a:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 87d:	a1 1c 10 00 00       	mov    0x101c,%eax
+ 882:	eb 02                	jmp    886 <free+0x15>
+ 884:	89 d0                	mov    %edx,%eax
+ 886:	39 c8                	cmp    %ecx,%eax
+ 888:	73 04                	jae    88e <free+0x1d>
+ 88a:	3b 08                	cmp    (%eax),%ecx
+ 88c:	72 12                	jb     8a0 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 88e:	8b 10                	mov    (%eax),%edx
+ 890:	39 d0                	cmp    %edx,%eax
+ 892:	72 f0                	jb     884 <free+0x13>
+ 894:	39 c8                	cmp    %ecx,%eax
+ 896:	72 08                	jb     8a0 <free+0x2f>
+ 898:	39 d1                	cmp    %edx,%ecx
+ 89a:	72 04                	jb     8a0 <free+0x2f>
+ 89c:	89 d0                	mov    %edx,%eax
+ 89e:	eb e6                	jmp    886 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8a0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8a3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8a6:	8b 10                	mov    (%eax),%edx
+ 8a8:	39 d7                	cmp    %edx,%edi
+ 8aa:	74 19                	je     8c5 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8ac:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8af:	8b 50 04             	mov    0x4(%eax),%edx
+ 8b2:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 8b5:	39 ce                	cmp    %ecx,%esi
+ 8b7:	74 1b                	je     8d4 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 8b9:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 8bb:	a3 1c 10 00 00       	mov    %eax,0x101c
+}
+ 8c0:	5b                   	pop    %ebx
+ 8c1:	5e                   	pop    %esi
+ 8c2:	5f                   	pop    %edi
+ 8c3:	5d                   	pop    %ebp
+ 8c4:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 8c5:	03 72 04             	add    0x4(%edx),%esi
+ 8c8:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8cb:	8b 10                	mov    (%eax),%edx
+ 8cd:	8b 12                	mov    (%edx),%edx
+ 8cf:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 8d2:	eb db                	jmp    8af <free+0x3e>
+    p->s.size += bp->s.size;
+ 8d4:	03 53 fc             	add    -0x4(%ebx),%edx
+ 8d7:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 8da:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 8dd:	89 10                	mov    %edx,(%eax)
+ 8df:	eb da                	jmp    8bb <free+0x4a>
+
+000008e1 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8e1:	55                   	push   %ebp
+ 8e2:	89 e5                	mov    %esp,%ebp
+ 8e4:	53                   	push   %ebx
+ 8e5:	83 ec 04             	sub    $0x4,%esp
+ 8e8:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8ea:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 8ef:	77 05                	ja     8f6 <morecore+0x15>
+    nu = 4096;
+ 8f1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8f6:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 8fd:	83 ec 0c             	sub    $0xc,%esp
+ 900:	50                   	push   %eax
+ 901:	e8 e8 fc ff ff       	call   5ee <sbrk>
+  if(p == (char*)-1)
+ 906:	83 c4 10             	add    $0x10,%esp
+ 909:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 90c:	74 1c                	je     92a <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 90e:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 911:	83 c0 08             	add    $0x8,%eax
+ 914:	83 ec 0c             	sub    $0xc,%esp
+ 917:	50                   	push   %eax
+ 918:	e8 54 ff ff ff       	call   871 <free>
+  return freep;
+ 91d:	a1 1c 10 00 00       	mov    0x101c,%eax
+ 922:	83 c4 10             	add    $0x10,%esp
+}
+ 925:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 928:	c9                   	leave
+ 929:	c3                   	ret
+    return 0;
+ 92a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 92f:	eb f4                	jmp    925 <morecore+0x44>
+
+00000931 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 931:	55                   	push   %ebp
+ 932:	89 e5                	mov    %esp,%ebp
+ 934:	53                   	push   %ebx
+ 935:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 938:	8b 45 08             	mov    0x8(%ebp),%eax
+ 93b:	8d 58 07             	lea    0x7(%eax),%ebx
+ 93e:	c1 eb 03             	shr    $0x3,%ebx
+ 941:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 944:	8b 0d 1c 10 00 00    	mov    0x101c,%ecx
+ 94a:	85 c9                	test   %ecx,%ecx
+ 94c:	74 04                	je     952 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 94e:	8b 01                	mov    (%ecx),%eax
+ 950:	eb 4a                	jmp    99c <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 952:	c7 05 1c 10 00 00 20 	movl   $0x1020,0x101c
+ 959:	10 00 00 
+ 95c:	c7 05 20 10 00 00 20 	movl   $0x1020,0x1020
+ 963:	10 00 00 
+    base.s.size = 0;
+ 966:	c7 05 24 10 00 00 00 	movl   $0x0,0x1024
+ 96d:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 970:	b9 20 10 00 00       	mov    $0x1020,%ecx
+ 975:	eb d7                	jmp    94e <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 977:	74 19                	je     992 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 979:	29 da                	sub    %ebx,%edx
+ 97b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 97e:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 981:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 984:	89 0d 1c 10 00 00    	mov    %ecx,0x101c
+      return (void*)(p + 1);
+ 98a:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 98d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 990:	c9                   	leave
+ 991:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 992:	8b 10                	mov    (%eax),%edx
+ 994:	89 11                	mov    %edx,(%ecx)
+ 996:	eb ec                	jmp    984 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 998:	89 c1                	mov    %eax,%ecx
+ 99a:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 99c:	8b 50 04             	mov    0x4(%eax),%edx
+ 99f:	39 da                	cmp    %ebx,%edx
+ 9a1:	73 d4                	jae    977 <malloc+0x46>
+    if(p == freep)
+ 9a3:	39 05 1c 10 00 00    	cmp    %eax,0x101c
+ 9a9:	75 ed                	jne    998 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 9ab:	89 d8                	mov    %ebx,%eax
+ 9ad:	e8 2f ff ff ff       	call   8e1 <morecore>
+ 9b2:	85 c0                	test   %eax,%eax
+ 9b4:	75 e2                	jne    998 <malloc+0x67>
+ 9b6:	eb d5                	jmp    98d <malloc+0x5c>
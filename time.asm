@@ -0,0 +1,1272 @@
+
+_time:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int
+main(int argc, char* argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 59 04             	mov    0x4(%ecx),%ebx
+ // exec("echo", argv);
+  int timebefore = uptime(); 
+  17:	e8 f0 03 00 00       	call   40c <uptime>
+  1c:	89 c6                	mov    %eax,%esi
+  int timeafter = 0;
+  int pid = fork();
+  1e:	e8 49 03 00 00       	call   36c <fork>
+	  
+  if(pid > 0){
+  23:	85 c0                	test   %eax,%eax
+  25:	7f 28                	jg     4f <main+0x4f>
+  27:	89 c7                	mov    %eax,%edi
+     pid = wait();
+     timeafter = uptime();
+  }
+  else if(pid == 0){
+  29:	0f 85 89 00 00 00    	jne    b8 <main+0xb8>
+     if(argv[1] != NULL){
+  2f:	8b 43 04             	mov    0x4(%ebx),%eax
+  32:	85 c0                	test   %eax,%eax
+  34:	74 7d                	je     b3 <main+0xb3>
+       if(exec(argv[1], argv +1) < 0)
+  36:	83 ec 08             	sub    $0x8,%esp
+  39:	8d 53 04             	lea    0x4(%ebx),%edx
+  3c:	52                   	push   %edx
+  3d:	50                   	push   %eax
+  3e:	e8 69 03 00 00       	call   3ac <exec>
+  43:	83 c4 10             	add    $0x10,%esp
+  46:	85 c0                	test   %eax,%eax
+  48:	79 11                	jns    5b <main+0x5b>
+	 exit();
+  4a:	e8 25 03 00 00       	call   374 <exit>
+     pid = wait();
+  4f:	e8 28 03 00 00       	call   37c <wait>
+     timeafter = uptime();
+  54:	e8 b3 03 00 00       	call   40c <uptime>
+  59:	89 c7                	mov    %eax,%edi
+     else
+       exit();	     
+  }   
+  else
+     printf(1,"fork error\n");  
+  int timeelapsed = (timeafter - timebefore) / 1000;
+  5b:	29 f7                	sub    %esi,%edi
+  5d:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+  62:	89 f8                	mov    %edi,%eax
+  64:	f7 ea                	imul   %edx
+  66:	c1 fa 06             	sar    $0x6,%edx
+  69:	89 f8                	mov    %edi,%eax
+  6b:	c1 f8 1f             	sar    $0x1f,%eax
+  6e:	29 c2                	sub    %eax,%edx
+  int timedec = (timeafter - timebefore) % 1000;
+  70:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+  76:	89 fe                	mov    %edi,%esi
+  78:	29 c6                	sub    %eax,%esi
+  printf(1,"%s ran in %d.", argv[1] , timeelapsed);
+  7a:	52                   	push   %edx
+  7b:	ff 73 04             	push   0x4(%ebx)
+  7e:	68 d4 07 00 00       	push   $0x7d4
+  83:	6a 01                	push   $0x1
+  85:	e8 8f 04 00 00       	call   519 <printf>
+  if(timedec < 100 && timedec > 9)
+  8a:	8d 46 f6             	lea    -0xa(%esi),%eax
+  8d:	83 c4 10             	add    $0x10,%esp
+  90:	83 f8 59             	cmp    $0x59,%eax
+  93:	76 3c                	jbe    d1 <main+0xd1>
+    printf(1, "0%d", timedec);
+  if(timedec < 10)
+  95:	83 fe 09             	cmp    $0x9,%esi
+  98:	7e 4c                	jle    e6 <main+0xe6>
+    printf(1, "00%d", timedec);
+  if(timedec >= 100)
+  9a:	83 fe 63             	cmp    $0x63,%esi
+  9d:	7f 5c                	jg     fb <main+0xfb>
+    printf(1,"%d", timedec);
+
+  printf(1, " seconds.\n");
+  9f:	83 ec 08             	sub    $0x8,%esp
+  a2:	68 e7 07 00 00       	push   $0x7e7
+  a7:	6a 01                	push   $0x1
+  a9:	e8 6b 04 00 00       	call   519 <printf>
+
+
+
+
+
+  exit();
+  ae:	e8 c1 02 00 00       	call   374 <exit>
+       exit();	     
+  b3:	e8 bc 02 00 00       	call   374 <exit>
+     printf(1,"fork error\n");  
+  b8:	83 ec 08             	sub    $0x8,%esp
+  bb:	68 c8 07 00 00       	push   $0x7c8
+  c0:	6a 01                	push   $0x1
+  c2:	e8 52 04 00 00       	call   519 <printf>
+  c7:	83 c4 10             	add    $0x10,%esp
+  int timeafter = 0;
+  ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  cf:	eb 8a                	jmp    5b <main+0x5b>
+    printf(1, "0%d", timedec);
+  d1:	83 ec 04             	sub    $0x4,%esp
+  d4:	56                   	push   %esi
+  d5:	68 e3 07 00 00       	push   $0x7e3
+  da:	6a 01                	push   $0x1
+  dc:	e8 38 04 00 00       	call   519 <printf>
+  e1:	83 c4 10             	add    $0x10,%esp
+  e4:	eb af                	jmp    95 <main+0x95>
+    printf(1, "00%d", timedec);
+  e6:	83 ec 04             	sub    $0x4,%esp
+  e9:	56                   	push   %esi
+  ea:	68 e2 07 00 00       	push   $0x7e2
+  ef:	6a 01                	push   $0x1
+  f1:	e8 23 04 00 00       	call   519 <printf>
+  f6:	83 c4 10             	add    $0x10,%esp
+  f9:	eb 9f                	jmp    9a <main+0x9a>
+    printf(1,"%d", timedec);
+  fb:	83 ec 04             	sub    $0x4,%esp
+  fe:	56                   	push   %esi
+  ff:	68 e4 07 00 00       	push   $0x7e4
+ 104:	6a 01                	push   $0x1
+ 106:	e8 0e 04 00 00       	call   519 <printf>
+ 10b:	83 c4 10             	add    $0x10,%esp
+ 10e:	eb 8f                	jmp    9f <main+0x9f>
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	56                   	push   %esi
+ 114:	53                   	push   %ebx
+ 115:	8b 75 08             	mov    0x8(%ebp),%esi
+ 118:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 11b:	89 f0                	mov    %esi,%eax
+ 11d:	89 d1                	mov    %edx,%ecx
+ 11f:	83 c2 01             	add    $0x1,%edx
+ 122:	89 c3                	mov    %eax,%ebx
+ 124:	83 c0 01             	add    $0x1,%eax
+ 127:	0f b6 09             	movzbl (%ecx),%ecx
+ 12a:	88 0b                	mov    %cl,(%ebx)
+ 12c:	84 c9                	test   %cl,%cl
+ 12e:	75 ed                	jne    11d <strcpy+0xd>
+    ;
+  return os;
+}
+ 130:	89 f0                	mov    %esi,%eax
+ 132:	5b                   	pop    %ebx
+ 133:	5e                   	pop    %esi
+ 134:	5d                   	pop    %ebp
+ 135:	c3                   	ret
+
+00000136 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 136:	55                   	push   %ebp
+ 137:	89 e5                	mov    %esp,%ebp
+ 139:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 13c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 13f:	eb 06                	jmp    147 <strcmp+0x11>
+    p++, q++;
+ 141:	83 c1 01             	add    $0x1,%ecx
+ 144:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 147:	0f b6 01             	movzbl (%ecx),%eax
+ 14a:	84 c0                	test   %al,%al
+ 14c:	74 04                	je     152 <strcmp+0x1c>
+ 14e:	3a 02                	cmp    (%edx),%al
+ 150:	74 ef                	je     141 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 152:	0f b6 c0             	movzbl %al,%eax
+ 155:	0f b6 12             	movzbl (%edx),%edx
+ 158:	29 d0                	sub    %edx,%eax
+}
+ 15a:	5d                   	pop    %ebp
+ 15b:	c3                   	ret
+
+0000015c <strlen>:
+
+uint
+strlen(char *s)
+{
+ 15c:	55                   	push   %ebp
+ 15d:	89 e5                	mov    %esp,%ebp
+ 15f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 162:	b8 00 00 00 00       	mov    $0x0,%eax
+ 167:	eb 03                	jmp    16c <strlen+0x10>
+ 169:	83 c0 01             	add    $0x1,%eax
+ 16c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 170:	75 f7                	jne    169 <strlen+0xd>
+    ;
+  return n;
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+
+00000174 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 174:	55                   	push   %ebp
+ 175:	89 e5                	mov    %esp,%ebp
+ 177:	57                   	push   %edi
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 17b:	89 d7                	mov    %edx,%edi
+ 17d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 180:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 183:	fc                   	cld
+ 184:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 186:	89 d0                	mov    %edx,%eax
+ 188:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+
+0000018d <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 18d:	55                   	push   %ebp
+ 18e:	89 e5                	mov    %esp,%ebp
+ 190:	8b 45 08             	mov    0x8(%ebp),%eax
+ 193:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 197:	eb 03                	jmp    19c <strchr+0xf>
+ 199:	83 c0 01             	add    $0x1,%eax
+ 19c:	0f b6 10             	movzbl (%eax),%edx
+ 19f:	84 d2                	test   %dl,%dl
+ 1a1:	74 06                	je     1a9 <strchr+0x1c>
+    if(*s == c)
+ 1a3:	38 ca                	cmp    %cl,%dl
+ 1a5:	75 f2                	jne    199 <strchr+0xc>
+ 1a7:	eb 05                	jmp    1ae <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 1a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1ae:	5d                   	pop    %ebp
+ 1af:	c3                   	ret
+
+000001b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	83 ec 1c             	sub    $0x1c,%esp
+ 1b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1c1:	89 de                	mov    %ebx,%esi
+ 1c3:	83 c3 01             	add    $0x1,%ebx
+ 1c6:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1c9:	7d 2e                	jge    1f9 <gets+0x49>
+    cc = read(0, &c, 1);
+ 1cb:	83 ec 04             	sub    $0x4,%esp
+ 1ce:	6a 01                	push   $0x1
+ 1d0:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1d3:	50                   	push   %eax
+ 1d4:	6a 00                	push   $0x0
+ 1d6:	e8 b1 01 00 00       	call   38c <read>
+    if(cc < 1)
+ 1db:	83 c4 10             	add    $0x10,%esp
+ 1de:	85 c0                	test   %eax,%eax
+ 1e0:	7e 17                	jle    1f9 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1e2:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1e6:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1e9:	3c 0a                	cmp    $0xa,%al
+ 1eb:	0f 94 c2             	sete   %dl
+ 1ee:	3c 0d                	cmp    $0xd,%al
+ 1f0:	0f 94 c0             	sete   %al
+ 1f3:	08 c2                	or     %al,%dl
+ 1f5:	74 ca                	je     1c1 <gets+0x11>
+    buf[i++] = c;
+ 1f7:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1f9:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 1fd:	89 f8                	mov    %edi,%eax
+ 1ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 202:	5b                   	pop    %ebx
+ 203:	5e                   	pop    %esi
+ 204:	5f                   	pop    %edi
+ 205:	5d                   	pop    %ebp
+ 206:	c3                   	ret
+
+00000207 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 207:	55                   	push   %ebp
+ 208:	89 e5                	mov    %esp,%ebp
+ 20a:	56                   	push   %esi
+ 20b:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 20c:	83 ec 08             	sub    $0x8,%esp
+ 20f:	6a 00                	push   $0x0
+ 211:	ff 75 08             	push   0x8(%ebp)
+ 214:	e8 9b 01 00 00       	call   3b4 <open>
+  if(fd < 0)
+ 219:	83 c4 10             	add    $0x10,%esp
+ 21c:	85 c0                	test   %eax,%eax
+ 21e:	78 24                	js     244 <stat+0x3d>
+ 220:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 222:	83 ec 08             	sub    $0x8,%esp
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	50                   	push   %eax
+ 229:	e8 9e 01 00 00       	call   3cc <fstat>
+ 22e:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 230:	89 1c 24             	mov    %ebx,(%esp)
+ 233:	e8 64 01 00 00       	call   39c <close>
+  return r;
+ 238:	83 c4 10             	add    $0x10,%esp
+}
+ 23b:	89 f0                	mov    %esi,%eax
+ 23d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 240:	5b                   	pop    %ebx
+ 241:	5e                   	pop    %esi
+ 242:	5d                   	pop    %ebp
+ 243:	c3                   	ret
+    return -1;
+ 244:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 249:	eb f0                	jmp    23b <stat+0x34>
+
+0000024b <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 24b:	55                   	push   %ebp
+ 24c:	89 e5                	mov    %esp,%ebp
+ 24e:	56                   	push   %esi
+ 24f:	53                   	push   %ebx
+ 250:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 253:	eb 03                	jmp    258 <atoi+0xd>
+ 255:	83 c2 01             	add    $0x1,%edx
+ 258:	0f b6 02             	movzbl (%edx),%eax
+ 25b:	3c 20                	cmp    $0x20,%al
+ 25d:	74 f6                	je     255 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 25f:	3c 2d                	cmp    $0x2d,%al
+ 261:	74 1d                	je     280 <atoi+0x35>
+ 263:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 268:	3c 2b                	cmp    $0x2b,%al
+ 26a:	0f 94 c1             	sete   %cl
+ 26d:	3c 2d                	cmp    $0x2d,%al
+ 26f:	0f 94 c0             	sete   %al
+ 272:	08 c1                	or     %al,%cl
+ 274:	74 03                	je     279 <atoi+0x2e>
+    s++;
+ 276:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 279:	b8 00 00 00 00       	mov    $0x0,%eax
+ 27e:	eb 17                	jmp    297 <atoi+0x4c>
+ 280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 285:	eb e1                	jmp    268 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 287:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 28a:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 28d:	83 c2 01             	add    $0x1,%edx
+ 290:	0f be c9             	movsbl %cl,%ecx
+ 293:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 297:	0f b6 0a             	movzbl (%edx),%ecx
+ 29a:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 29d:	80 fb 09             	cmp    $0x9,%bl
+ 2a0:	76 e5                	jbe    287 <atoi+0x3c>
+  return sign*n;
+ 2a2:	0f af c6             	imul   %esi,%eax
+}
+ 2a5:	5b                   	pop    %ebx
+ 2a6:	5e                   	pop    %esi
+ 2a7:	5d                   	pop    %ebp
+ 2a8:	c3                   	ret
+
+000002a9 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2a9:	55                   	push   %ebp
+ 2aa:	89 e5                	mov    %esp,%ebp
+ 2ac:	56                   	push   %esi
+ 2ad:	53                   	push   %ebx
+ 2ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2b1:	eb 03                	jmp    2b6 <atoo+0xd>
+ 2b3:	83 c2 01             	add    $0x1,%edx
+ 2b6:	0f b6 02             	movzbl (%edx),%eax
+ 2b9:	3c 20                	cmp    $0x20,%al
+ 2bb:	74 f6                	je     2b3 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 2bd:	3c 2d                	cmp    $0x2d,%al
+ 2bf:	74 1d                	je     2de <atoo+0x35>
+ 2c1:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2c6:	3c 2b                	cmp    $0x2b,%al
+ 2c8:	0f 94 c1             	sete   %cl
+ 2cb:	3c 2d                	cmp    $0x2d,%al
+ 2cd:	0f 94 c0             	sete   %al
+ 2d0:	08 c1                	or     %al,%cl
+ 2d2:	74 03                	je     2d7 <atoo+0x2e>
+    s++;
+ 2d4:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 2d7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2dc:	eb 11                	jmp    2ef <atoo+0x46>
+ 2de:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e3:	eb e1                	jmp    2c6 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 2e5:	83 c2 01             	add    $0x1,%edx
+ 2e8:	0f be c9             	movsbl %cl,%ecx
+ 2eb:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 2ef:	0f b6 0a             	movzbl (%edx),%ecx
+ 2f2:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2f5:	80 fb 07             	cmp    $0x7,%bl
+ 2f8:	76 eb                	jbe    2e5 <atoo+0x3c>
+  return sign*n;
+ 2fa:	0f af c6             	imul   %esi,%eax
+}
+ 2fd:	5b                   	pop    %ebx
+ 2fe:	5e                   	pop    %esi
+ 2ff:	5d                   	pop    %ebp
+ 300:	c3                   	ret
+
+00000301 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 301:	55                   	push   %ebp
+ 302:	89 e5                	mov    %esp,%ebp
+ 304:	53                   	push   %ebx
+ 305:	8b 55 08             	mov    0x8(%ebp),%edx
+ 308:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 30b:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 30e:	eb 09                	jmp    319 <strncmp+0x18>
+      n--, p++, q++;
+ 310:	83 e8 01             	sub    $0x1,%eax
+ 313:	83 c2 01             	add    $0x1,%edx
+ 316:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 319:	85 c0                	test   %eax,%eax
+ 31b:	74 0b                	je     328 <strncmp+0x27>
+ 31d:	0f b6 1a             	movzbl (%edx),%ebx
+ 320:	84 db                	test   %bl,%bl
+ 322:	74 04                	je     328 <strncmp+0x27>
+ 324:	3a 19                	cmp    (%ecx),%bl
+ 326:	74 e8                	je     310 <strncmp+0xf>
+    if(n == 0)
+ 328:	85 c0                	test   %eax,%eax
+ 32a:	74 0d                	je     339 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 32c:	0f b6 02             	movzbl (%edx),%eax
+ 32f:	0f b6 11             	movzbl (%ecx),%edx
+ 332:	29 d0                	sub    %edx,%eax
+}
+ 334:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 337:	c9                   	leave
+ 338:	c3                   	ret
+      return 0;
+ 339:	b8 00 00 00 00       	mov    $0x0,%eax
+ 33e:	eb f4                	jmp    334 <strncmp+0x33>
+
+00000340 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	53                   	push   %ebx
+ 345:	8b 75 08             	mov    0x8(%ebp),%esi
+ 348:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 34b:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 34e:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 350:	eb 0d                	jmp    35f <memmove+0x1f>
+    *dst++ = *src++;
+ 352:	0f b6 01             	movzbl (%ecx),%eax
+ 355:	88 02                	mov    %al,(%edx)
+ 357:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 35a:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 35d:	89 d8                	mov    %ebx,%eax
+ 35f:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 362:	85 c0                	test   %eax,%eax
+ 364:	7f ec                	jg     352 <memmove+0x12>
+  return vdst;
+}
+ 366:	89 f0                	mov    %esi,%eax
+ 368:	5b                   	pop    %ebx
+ 369:	5e                   	pop    %esi
+ 36a:	5d                   	pop    %ebp
+ 36b:	c3                   	ret
+
+0000036c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 36c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <exit>:
+SYSCALL(exit)
+ 374:	b8 02 00 00 00       	mov    $0x2,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <wait>:
+SYSCALL(wait)
+ 37c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <pipe>:
+SYSCALL(pipe)
+ 384:	b8 04 00 00 00       	mov    $0x4,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <read>:
+SYSCALL(read)
+ 38c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <write>:
+SYSCALL(write)
+ 394:	b8 10 00 00 00       	mov    $0x10,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <close>:
+SYSCALL(close)
+ 39c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <kill>:
+SYSCALL(kill)
+ 3a4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <exec>:
+SYSCALL(exec)
+ 3ac:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <open>:
+SYSCALL(open)
+ 3b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <mknod>:
+SYSCALL(mknod)
+ 3bc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <unlink>:
+SYSCALL(unlink)
+ 3c4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <fstat>:
+SYSCALL(fstat)
+ 3cc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <link>:
+SYSCALL(link)
+ 3d4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <mkdir>:
+SYSCALL(mkdir)
+ 3dc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <chdir>:
+SYSCALL(chdir)
+ 3e4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <dup>:
+SYSCALL(dup)
+ 3ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <getpid>:
+SYSCALL(getpid)
+ 3f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <sbrk>:
+SYSCALL(sbrk)
+ 3fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <sleep>:
+SYSCALL(sleep)
+ 404:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <uptime>:
+SYSCALL(uptime)
+ 40c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <halt>:
+SYSCALL(halt)
+ 414:	b8 16 00 00 00       	mov    $0x16,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <date>:
+SYSCALL(date)
+ 41c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <getuid>:
+SYSCALL(getuid)
+ 424:	b8 18 00 00 00       	mov    $0x18,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <getgid>:
+SYSCALL(getgid)
+ 42c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <getppid>:
+SYSCALL(getppid)
+ 434:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <setuid>:
+SYSCALL(setuid)
+ 43c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <setgid>:
+SYSCALL(setgid)
+ 444:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <getprocs>:
+SYSCALL(getprocs)
+ 44c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <getpriority>:
+SYSCALL(getpriority)
+ 454:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <setpriority>:
+SYSCALL(setpriority)
+ 45c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <pipesize>:
+SYSCALL(pipesize)
+ 464:	b8 20 00 00 00       	mov    $0x20,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <splice>:
+SYSCALL(splice)
+ 46c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 474:	55                   	push   %ebp
+ 475:	89 e5                	mov    %esp,%ebp
+ 477:	83 ec 1c             	sub    $0x1c,%esp
+ 47a:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 47d:	6a 01                	push   $0x1
+ 47f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 482:	52                   	push   %edx
+ 483:	50                   	push   %eax
+ 484:	e8 0b ff ff ff       	call   394 <write>
+}
+ 489:	83 c4 10             	add    $0x10,%esp
+ 48c:	c9                   	leave
+ 48d:	c3                   	ret
+
+0000048e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 48e:	55                   	push   %ebp
+ 48f:	89 e5                	mov    %esp,%ebp
+ 491:	57                   	push   %edi
+ 492:	56                   	push   %esi
+ 493:	53                   	push   %ebx
+ 494:	83 ec 2c             	sub    $0x2c,%esp
+ 497:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 49a:	89 d0                	mov    %edx,%eax
+ 49c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 49e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 4a2:	0f 95 c1             	setne  %cl
+ 4a5:	c1 ea 1f             	shr    $0x1f,%edx
+ 4a8:	84 d1                	test   %dl,%cl
+ 4aa:	74 44                	je     4f0 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 4ac:	f7 d8                	neg    %eax
+ 4ae:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 4b0:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 4bc:	89 c8                	mov    %ecx,%eax
+ 4be:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4c3:	f7 f6                	div    %esi
+ 4c5:	89 df                	mov    %ebx,%edi
+ 4c7:	83 c3 01             	add    $0x1,%ebx
+ 4ca:	0f b6 92 54 08 00 00 	movzbl 0x854(%edx),%edx
+ 4d1:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 4d5:	89 ca                	mov    %ecx,%edx
+ 4d7:	89 c1                	mov    %eax,%ecx
+ 4d9:	39 f2                	cmp    %esi,%edx
+ 4db:	73 df                	jae    4bc <printint+0x2e>
+  if(neg)
+ 4dd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 4e1:	74 31                	je     514 <printint+0x86>
+    buf[i++] = '-';
+ 4e3:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4e8:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 4eb:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4ee:	eb 17                	jmp    507 <printint+0x79>
+    x = xx;
+ 4f0:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 4f2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 4f9:	eb bc                	jmp    4b7 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4fb:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 500:	89 f0                	mov    %esi,%eax
+ 502:	e8 6d ff ff ff       	call   474 <putc>
+  while(--i >= 0)
+ 507:	83 eb 01             	sub    $0x1,%ebx
+ 50a:	79 ef                	jns    4fb <printint+0x6d>
+}
+ 50c:	83 c4 2c             	add    $0x2c,%esp
+ 50f:	5b                   	pop    %ebx
+ 510:	5e                   	pop    %esi
+ 511:	5f                   	pop    %edi
+ 512:	5d                   	pop    %ebp
+ 513:	c3                   	ret
+ 514:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 517:	eb ee                	jmp    507 <printint+0x79>
+
+00000519 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 519:	55                   	push   %ebp
+ 51a:	89 e5                	mov    %esp,%ebp
+ 51c:	57                   	push   %edi
+ 51d:	56                   	push   %esi
+ 51e:	53                   	push   %ebx
+ 51f:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 522:	8d 45 10             	lea    0x10(%ebp),%eax
+ 525:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 528:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 52d:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 532:	eb 14                	jmp    548 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 534:	89 fa                	mov    %edi,%edx
+ 536:	8b 45 08             	mov    0x8(%ebp),%eax
+ 539:	e8 36 ff ff ff       	call   474 <putc>
+ 53e:	eb 05                	jmp    545 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 540:	83 fe 25             	cmp    $0x25,%esi
+ 543:	74 25                	je     56a <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 545:	83 c3 01             	add    $0x1,%ebx
+ 548:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 54b:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 54f:	84 c0                	test   %al,%al
+ 551:	0f 84 20 01 00 00    	je     677 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 557:	0f be f8             	movsbl %al,%edi
+ 55a:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 55d:	85 f6                	test   %esi,%esi
+ 55f:	75 df                	jne    540 <printf+0x27>
+      if(c == '%'){
+ 561:	83 f8 25             	cmp    $0x25,%eax
+ 564:	75 ce                	jne    534 <printf+0x1b>
+        state = '%';
+ 566:	89 c6                	mov    %eax,%esi
+ 568:	eb db                	jmp    545 <printf+0x2c>
+      if(c == 'd'){
+ 56a:	83 f8 25             	cmp    $0x25,%eax
+ 56d:	0f 84 cf 00 00 00    	je     642 <printf+0x129>
+ 573:	0f 8c dd 00 00 00    	jl     656 <printf+0x13d>
+ 579:	83 f8 78             	cmp    $0x78,%eax
+ 57c:	0f 8f d4 00 00 00    	jg     656 <printf+0x13d>
+ 582:	83 f8 63             	cmp    $0x63,%eax
+ 585:	0f 8c cb 00 00 00    	jl     656 <printf+0x13d>
+ 58b:	83 e8 63             	sub    $0x63,%eax
+ 58e:	83 f8 15             	cmp    $0x15,%eax
+ 591:	0f 87 bf 00 00 00    	ja     656 <printf+0x13d>
+ 597:	ff 24 85 fc 07 00 00 	jmp    *0x7fc(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 59e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5a1:	8b 17                	mov    (%edi),%edx
+ 5a3:	83 ec 0c             	sub    $0xc,%esp
+ 5a6:	6a 01                	push   $0x1
+ 5a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b0:	e8 d9 fe ff ff       	call   48e <printint>
+        ap++;
+ 5b5:	83 c7 04             	add    $0x4,%edi
+ 5b8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 5bb:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 5be:	be 00 00 00 00       	mov    $0x0,%esi
+ 5c3:	eb 80                	jmp    545 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 5c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5c8:	8b 17                	mov    (%edi),%edx
+ 5ca:	83 ec 0c             	sub    $0xc,%esp
+ 5cd:	6a 00                	push   $0x0
+ 5cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d7:	e8 b2 fe ff ff       	call   48e <printint>
+        ap++;
+ 5dc:	83 c7 04             	add    $0x4,%edi
+ 5df:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 5e2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5e5:	be 00 00 00 00       	mov    $0x0,%esi
+ 5ea:	e9 56 ff ff ff       	jmp    545 <printf+0x2c>
+        s = (char*)*ap;
+ 5ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5f2:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 5f4:	83 c0 04             	add    $0x4,%eax
+ 5f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 5fa:	85 f6                	test   %esi,%esi
+ 5fc:	75 15                	jne    613 <printf+0xfa>
+          s = "(null)";
+ 5fe:	be f2 07 00 00       	mov    $0x7f2,%esi
+ 603:	eb 0e                	jmp    613 <printf+0xfa>
+          putc(fd, *s);
+ 605:	0f be d2             	movsbl %dl,%edx
+ 608:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60b:	e8 64 fe ff ff       	call   474 <putc>
+          s++;
+ 610:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 613:	0f b6 16             	movzbl (%esi),%edx
+ 616:	84 d2                	test   %dl,%dl
+ 618:	75 eb                	jne    605 <printf+0xec>
+      state = 0;
+ 61a:	be 00 00 00 00       	mov    $0x0,%esi
+ 61f:	e9 21 ff ff ff       	jmp    545 <printf+0x2c>
+        putc(fd, *ap);
+ 624:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 627:	0f be 17             	movsbl (%edi),%edx
+ 62a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62d:	e8 42 fe ff ff       	call   474 <putc>
+        ap++;
+ 632:	83 c7 04             	add    $0x4,%edi
+ 635:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 638:	be 00 00 00 00       	mov    $0x0,%esi
+ 63d:	e9 03 ff ff ff       	jmp    545 <printf+0x2c>
+        putc(fd, c);
+ 642:	89 fa                	mov    %edi,%edx
+ 644:	8b 45 08             	mov    0x8(%ebp),%eax
+ 647:	e8 28 fe ff ff       	call   474 <putc>
+      state = 0;
+ 64c:	be 00 00 00 00       	mov    $0x0,%esi
+ 651:	e9 ef fe ff ff       	jmp    545 <printf+0x2c>
+        putc(fd, '%');
+ 656:	ba 25 00 00 00       	mov    $0x25,%edx
+ 65b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65e:	e8 11 fe ff ff       	call   474 <putc>
+        putc(fd, c);
+ 663:	89 fa                	mov    %edi,%edx
+ 665:	8b 45 08             	mov    0x8(%ebp),%eax
+ 668:	e8 07 fe ff ff       	call   474 <putc>
+      state = 0;
+ 66d:	be 00 00 00 00       	mov    $0x0,%esi
+ 672:	e9 ce fe ff ff       	jmp    545 <printf+0x2c>
+    }
+  }
+}
+ 677:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 67a:	5b                   	pop    %ebx
+ 67b:	5e                   	pop    %esi
+ 67c:	5f                   	pop    %edi
+ 67d:	5d                   	pop    %ebp
+ 67e:	c3                   	ret
+
+0000067f <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 67f:	55                   	push   %ebp
+ 680:	89 e5                	mov    %esp,%ebp
+ 682:	57                   	push   %edi
+ 683:	56                   	push   %esi
+ 684:	53                   	push   %ebx
+ 685:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 688:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 68b:	a1 54 0b 00 00       	mov    0xb54,%eax
+ 690:	eb 02                	jmp    694 <free+0x15>
+ 692:	89 d0                	mov    %edx,%eax
+ 694:	39 c8                	cmp    %ecx,%eax
+ 696:	73 04                	jae    69c <free+0x1d>
+ 698:	3b 08                	cmp    (%eax),%ecx
+ 69a:	72 12                	jb     6ae <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 69c:	8b 10                	mov    (%eax),%edx
+ 69e:	39 d0                	cmp    %edx,%eax
+ 6a0:	72 f0                	jb     692 <free+0x13>
+ 6a2:	39 c8                	cmp    %ecx,%eax
+ 6a4:	72 08                	jb     6ae <free+0x2f>
+ 6a6:	39 d1                	cmp    %edx,%ecx
+ 6a8:	72 04                	jb     6ae <free+0x2f>
+ 6aa:	89 d0                	mov    %edx,%eax
+ 6ac:	eb e6                	jmp    694 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6ae:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6b1:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6b4:	8b 10                	mov    (%eax),%edx
+ 6b6:	39 d7                	cmp    %edx,%edi
+ 6b8:	74 19                	je     6d3 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 6ba:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6bd:	8b 50 04             	mov    0x4(%eax),%edx
+ 6c0:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 6c3:	39 ce                	cmp    %ecx,%esi
+ 6c5:	74 1b                	je     6e2 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 6c7:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 6c9:	a3 54 0b 00 00       	mov    %eax,0xb54
+}
+ 6ce:	5b                   	pop    %ebx
+ 6cf:	5e                   	pop    %esi
+ 6d0:	5f                   	pop    %edi
+ 6d1:	5d                   	pop    %ebp
+ 6d2:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6d3:	03 72 04             	add    0x4(%edx),%esi
+ 6d6:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6d9:	8b 10                	mov    (%eax),%edx
+ 6db:	8b 12                	mov    (%edx),%edx
+ 6dd:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 6e0:	eb db                	jmp    6bd <free+0x3e>
+    p->s.size += bp->s.size;
+ 6e2:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6e5:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6e8:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 6eb:	89 10                	mov    %edx,(%eax)
+ 6ed:	eb da                	jmp    6c9 <free+0x4a>
+
+000006ef <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6ef:	55                   	push   %ebp
+ 6f0:	89 e5                	mov    %esp,%ebp
+ 6f2:	53                   	push   %ebx
+ 6f3:	83 ec 04             	sub    $0x4,%esp
+ 6f6:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 6f8:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 6fd:	77 05                	ja     704 <morecore+0x15>
+    nu = 4096;
+ 6ff:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 704:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 70b:	83 ec 0c             	sub    $0xc,%esp
+ 70e:	50                   	push   %eax
+ 70f:	e8 e8 fc ff ff       	call   3fc <sbrk>
+  if(p == (char*)-1)
+ 714:	83 c4 10             	add    $0x10,%esp
+ 717:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 71a:	74 1c                	je     738 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 71c:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 71f:	83 c0 08             	add    $0x8,%eax
+ 722:	83 ec 0c             	sub    $0xc,%esp
+ 725:	50                   	push   %eax
+ 726:	e8 54 ff ff ff       	call   67f <free>
+  return freep;
+ 72b:	a1 54 0b 00 00       	mov    0xb54,%eax
+ 730:	83 c4 10             	add    $0x10,%esp
+}
+ 733:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 736:	c9                   	leave
+ 737:	c3                   	ret
+    return 0;
+ 738:	b8 00 00 00 00       	mov    $0x0,%eax
+ 73d:	eb f4                	jmp    733 <morecore+0x44>
+
+0000073f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 73f:	55                   	push   %ebp
+ 740:	89 e5                	mov    %esp,%ebp
+ 742:	53                   	push   %ebx
+ 743:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 746:	8b 45 08             	mov    0x8(%ebp),%eax
+ 749:	8d 58 07             	lea    0x7(%eax),%ebx
+ 74c:	c1 eb 03             	shr    $0x3,%ebx
+ 74f:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 752:	8b 0d 54 0b 00 00    	mov    0xb54,%ecx
+ 758:	85 c9                	test   %ecx,%ecx
+ 75a:	74 04                	je     760 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 75c:	8b 01                	mov    (%ecx),%eax
+ 75e:	eb 4a                	jmp    7aa <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 760:	c7 05 54 0b 00 00 58 	movl   $0xb58,0xb54
+ 767:	0b 00 00 
+ 76a:	c7 05 58 0b 00 00 58 	movl   $0xb58,0xb58
+ 771:	0b 00 00 
+    base.s.size = 0;
+ 774:	c7 05 5c 0b 00 00 00 	movl   $0x0,0xb5c
+ 77b:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 77e:	b9 58 0b 00 00       	mov    $0xb58,%ecx
+ 783:	eb d7                	jmp    75c <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 785:	74 19                	je     7a0 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 787:	29 da                	sub    %ebx,%edx
+ 789:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 78c:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 78f:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 792:	89 0d 54 0b 00 00    	mov    %ecx,0xb54
+      return (void*)(p + 1);
+ 798:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 79b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 79e:	c9                   	leave
+ 79f:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7a0:	8b 10                	mov    (%eax),%edx
+ 7a2:	89 11                	mov    %edx,(%ecx)
+ 7a4:	eb ec                	jmp    792 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7a6:	89 c1                	mov    %eax,%ecx
+ 7a8:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 7aa:	8b 50 04             	mov    0x4(%eax),%edx
+ 7ad:	39 da                	cmp    %ebx,%edx
+ 7af:	73 d4                	jae    785 <malloc+0x46>
+    if(p == freep)
+ 7b1:	39 05 54 0b 00 00    	cmp    %eax,0xb54
+ 7b7:	75 ed                	jne    7a6 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 7b9:	89 d8                	mov    %ebx,%eax
+ 7bb:	e8 2f ff ff ff       	call   6ef <morecore>
+ 7c0:	85 c0                	test   %eax,%eax
+ 7c2:	75 e2                	jne    7a6 <malloc+0x67>
+ 7c4:	eb d5                	jmp    79b <malloc+0x5c>
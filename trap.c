@@ -59,11 +59,11 @@ trap(struct trapframe *tf)
     if(cpuid() == 0){
 #ifdef PDX_XV6
       atom_inc((int *)&ticks);
-      wakeup(&ticks);
+      timertick(ticks);
 #else
       acquire(&tickslock);
       ticks++;
-      wakeup(&ticks);
+      timertick(ticks);
       release(&tickslock);
 #endif // PDX_XV6
     }
@@ -73,6 +73,12 @@ trap(struct trapframe *tf)
     ideintr();
     lapiceoi();
     break;
+  case T_IRQ0 + IRQ_PCI0:
+  case T_IRQ0 + IRQ_PCI1:
+  case T_IRQ0 + IRQ_PCI2:
+    virtiointr(tf->trapno - T_IRQ0);
+    lapiceoi();
+    break;
   case T_IRQ0 + IRQ_IDE+1:
     // Bochs generates spurious IDE1 interrupts.
     break;
@@ -91,6 +97,20 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // Only user code faults on user memory; system calls
+    // fault their buffers in up front (see prefault).
+    // Reading the page in may sleep, so let interrupts in,
+    // once cr2 is safe.
+    if(myproc() && (tf->cs&3) == DPL_USER){
+      uint va = rcr2();
+
+      sti();
+      if(pagefault(myproc(), va, tf->err) == 0)
+        break;
+    }
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -33,6 +33,9 @@
 #define IRQ_KBD          1
 #define IRQ_COM1         4
 #define IRQ_IDE         14
+#define IRQ_PCI0         9  // lines a PC BIOS routes PCI INTx to
+#define IRQ_PCI1        10
+#define IRQ_PCI2        11
 #define IRQ_ERROR       19
 #define IRQ_SPURIOUS    31
 
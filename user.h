@@ -25,6 +25,8 @@ char* sbrk(int);
 int sleep(int);
 int uptime(void);
 int halt(void);
+int pipesize(int, int);
+int splice(int, int, int);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -0,0 +1,7577 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <pipesizeput>:
+// byte at stream position i, so misplaced runs show up
+#define PIPEPAT(i) (((i) ^ ((i) >> 8)) & 0xff)
+
+static void
+pipesizeput(int fd, int pos, int n)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	83 ec 0c             	sub    $0xc,%esp
+       9:	89 c6                	mov    %eax,%esi
+       b:	89 d7                	mov    %edx,%edi
+       d:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  for(i = 0; i < n; i++)
+       f:	b8 00 00 00 00       	mov    $0x0,%eax
+      14:	eb 14                	jmp    2a <pipesizeput+0x2a>
+    buf[i] = PIPEPAT(pos + i);
+      16:	8d 14 07             	lea    (%edi,%eax,1),%edx
+      19:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+      1c:	c1 f9 08             	sar    $0x8,%ecx
+      1f:	31 ca                	xor    %ecx,%edx
+      21:	88 90 80 8a 00 00    	mov    %dl,0x8a80(%eax)
+  for(i = 0; i < n; i++)
+      27:	83 c0 01             	add    $0x1,%eax
+      2a:	39 d8                	cmp    %ebx,%eax
+      2c:	7c e8                	jl     16 <pipesizeput+0x16>
+  if(write(fd, buf, n) != n){
+      2e:	83 ec 04             	sub    $0x4,%esp
+      31:	53                   	push   %ebx
+      32:	68 80 8a 00 00       	push   $0x8a80
+      37:	56                   	push   %esi
+      38:	e8 10 3c 00 00       	call   3c4d <write>
+      3d:	83 c4 10             	add    $0x10,%esp
+      40:	39 d8                	cmp    %ebx,%eax
+      42:	75 08                	jne    4c <pipesizeput+0x4c>
+    printf(1, "pipesize write failed\n");
+    exit();
+  }
+}
+      44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      47:	5b                   	pop    %ebx
+      48:	5e                   	pop    %esi
+      49:	5f                   	pop    %edi
+      4a:	5d                   	pop    %ebp
+      4b:	c3                   	ret
+    printf(1, "pipesize write failed\n");
+      4c:	83 ec 08             	sub    $0x8,%esp
+      4f:	68 80 40 00 00       	push   $0x4080
+      54:	6a 01                	push   $0x1
+      56:	e8 77 3d 00 00       	call   3dd2 <printf>
+    exit();
+      5b:	e8 cd 3b 00 00       	call   3c2d <exit>
+
+00000060 <pipesizeget>:
+
+static int
+pipesizeget(int fd, int pos, int n)
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	57                   	push   %edi
+      64:	56                   	push   %esi
+      65:	53                   	push   %ebx
+      66:	83 ec 10             	sub    $0x10,%esp
+      69:	89 d3                	mov    %edx,%ebx
+  int i;
+
+  if((n = read(fd, buf, n)) < 0){
+      6b:	51                   	push   %ecx
+      6c:	68 80 8a 00 00       	push   $0x8a80
+      71:	50                   	push   %eax
+      72:	e8 ce 3b 00 00       	call   3c45 <read>
+      77:	83 c4 10             	add    $0x10,%esp
+      7a:	85 c0                	test   %eax,%eax
+      7c:	78 27                	js     a5 <pipesizeget+0x45>
+      7e:	89 c6                	mov    %eax,%esi
+    printf(1, "pipesize read failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++){
+      80:	b8 00 00 00 00       	mov    $0x0,%eax
+      85:	39 f0                	cmp    %esi,%eax
+      87:	7d 45                	jge    ce <pipesizeget+0x6e>
+    if((buf[i] & 0xff) != PIPEPAT(pos + i)){
+      89:	0f be 90 80 8a 00 00 	movsbl 0x8a80(%eax),%edx
+      90:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+      93:	89 cf                	mov    %ecx,%edi
+      95:	c1 ff 08             	sar    $0x8,%edi
+      98:	31 cf                	xor    %ecx,%edi
+      9a:	31 fa                	xor    %edi,%edx
+      9c:	84 d2                	test   %dl,%dl
+      9e:	75 19                	jne    b9 <pipesizeget+0x59>
+  for(i = 0; i < n; i++){
+      a0:	83 c0 01             	add    $0x1,%eax
+      a3:	eb e0                	jmp    85 <pipesizeget+0x25>
+    printf(1, "pipesize read failed\n");
+      a5:	83 ec 08             	sub    $0x8,%esp
+      a8:	68 97 40 00 00       	push   $0x4097
+      ad:	6a 01                	push   $0x1
+      af:	e8 1e 3d 00 00       	call   3dd2 <printf>
+    exit();
+      b4:	e8 74 3b 00 00       	call   3c2d <exit>
+      printf(1, "pipesize read bad data at %d\n", pos + i);
+      b9:	83 ec 04             	sub    $0x4,%esp
+      bc:	51                   	push   %ecx
+      bd:	68 ad 40 00 00       	push   $0x40ad
+      c2:	6a 01                	push   $0x1
+      c4:	e8 09 3d 00 00       	call   3dd2 <printf>
+      exit();
+      c9:	e8 5f 3b 00 00       	call   3c2d <exit>
+    }
+  }
+  return n;
+}
+      ce:	89 f0                	mov    %esi,%eax
+      d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      d3:	5b                   	pop    %ebx
+      d4:	5e                   	pop    %esi
+      d5:	5f                   	pop    %edi
+      d6:	5d                   	pop    %ebp
+      d7:	c3                   	ret
+
+000000d8 <iputtest>:
+{
+      d8:	55                   	push   %ebp
+      d9:	89 e5                	mov    %esp,%ebp
+      db:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+      de:	68 5f 41 00 00       	push   $0x415f
+      e3:	ff 35 3c 63 00 00    	push   0x633c
+      e9:	e8 e4 3c 00 00       	call   3dd2 <printf>
+  if(mkdir("iputdir") < 0){
+      ee:	c7 04 24 f2 40 00 00 	movl   $0x40f2,(%esp)
+      f5:	e8 9b 3b 00 00       	call   3c95 <mkdir>
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	85 c0                	test   %eax,%eax
+      ff:	78 54                	js     155 <iputtest+0x7d>
+  if(chdir("iputdir") < 0){
+     101:	83 ec 0c             	sub    $0xc,%esp
+     104:	68 f2 40 00 00       	push   $0x40f2
+     109:	e8 8f 3b 00 00       	call   3c9d <chdir>
+     10e:	83 c4 10             	add    $0x10,%esp
+     111:	85 c0                	test   %eax,%eax
+     113:	78 58                	js     16d <iputtest+0x95>
+  if(unlink("../iputdir") < 0){
+     115:	83 ec 0c             	sub    $0xc,%esp
+     118:	68 ef 40 00 00       	push   $0x40ef
+     11d:	e8 5b 3b 00 00       	call   3c7d <unlink>
+     122:	83 c4 10             	add    $0x10,%esp
+     125:	85 c0                	test   %eax,%eax
+     127:	78 5c                	js     185 <iputtest+0xad>
+  if(chdir("/") < 0){
+     129:	83 ec 0c             	sub    $0xc,%esp
+     12c:	68 14 41 00 00       	push   $0x4114
+     131:	e8 67 3b 00 00       	call   3c9d <chdir>
+     136:	83 c4 10             	add    $0x10,%esp
+     139:	85 c0                	test   %eax,%eax
+     13b:	78 60                	js     19d <iputtest+0xc5>
+  printf(stdout, "iput test ok\n");
+     13d:	83 ec 08             	sub    $0x8,%esp
+     140:	68 97 41 00 00       	push   $0x4197
+     145:	ff 35 3c 63 00 00    	push   0x633c
+     14b:	e8 82 3c 00 00       	call   3dd2 <printf>
+}
+     150:	83 c4 10             	add    $0x10,%esp
+     153:	c9                   	leave
+     154:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     155:	83 ec 08             	sub    $0x8,%esp
+     158:	68 cb 40 00 00       	push   $0x40cb
+     15d:	ff 35 3c 63 00 00    	push   0x633c
+     163:	e8 6a 3c 00 00       	call   3dd2 <printf>
+    exit();
+     168:	e8 c0 3a 00 00       	call   3c2d <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     16d:	83 ec 08             	sub    $0x8,%esp
+     170:	68 d9 40 00 00       	push   $0x40d9
+     175:	ff 35 3c 63 00 00    	push   0x633c
+     17b:	e8 52 3c 00 00       	call   3dd2 <printf>
+    exit();
+     180:	e8 a8 3a 00 00       	call   3c2d <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     185:	83 ec 08             	sub    $0x8,%esp
+     188:	68 fa 40 00 00       	push   $0x40fa
+     18d:	ff 35 3c 63 00 00    	push   0x633c
+     193:	e8 3a 3c 00 00       	call   3dd2 <printf>
+    exit();
+     198:	e8 90 3a 00 00       	call   3c2d <exit>
+    printf(stdout, "chdir / failed\n");
+     19d:	83 ec 08             	sub    $0x8,%esp
+     1a0:	68 16 41 00 00       	push   $0x4116
+     1a5:	ff 35 3c 63 00 00    	push   0x633c
+     1ab:	e8 22 3c 00 00       	call   3dd2 <printf>
+    exit();
+     1b0:	e8 78 3a 00 00       	call   3c2d <exit>
+
+000001b5 <exitiputtest>:
+{
+     1b5:	55                   	push   %ebp
+     1b6:	89 e5                	mov    %esp,%ebp
+     1b8:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     1bb:	68 26 41 00 00       	push   $0x4126
+     1c0:	ff 35 3c 63 00 00    	push   0x633c
+     1c6:	e8 07 3c 00 00       	call   3dd2 <printf>
+  pid = fork();
+     1cb:	e8 55 3a 00 00       	call   3c25 <fork>
+  if(pid < 0){
+     1d0:	83 c4 10             	add    $0x10,%esp
+     1d3:	85 c0                	test   %eax,%eax
+     1d5:	78 47                	js     21e <exitiputtest+0x69>
+  if(pid == 0){
+     1d7:	0f 85 a1 00 00 00    	jne    27e <exitiputtest+0xc9>
+    if(mkdir("iputdir") < 0){
+     1dd:	83 ec 0c             	sub    $0xc,%esp
+     1e0:	68 f2 40 00 00       	push   $0x40f2
+     1e5:	e8 ab 3a 00 00       	call   3c95 <mkdir>
+     1ea:	83 c4 10             	add    $0x10,%esp
+     1ed:	85 c0                	test   %eax,%eax
+     1ef:	78 45                	js     236 <exitiputtest+0x81>
+    if(chdir("iputdir") < 0){
+     1f1:	83 ec 0c             	sub    $0xc,%esp
+     1f4:	68 f2 40 00 00       	push   $0x40f2
+     1f9:	e8 9f 3a 00 00       	call   3c9d <chdir>
+     1fe:	83 c4 10             	add    $0x10,%esp
+     201:	85 c0                	test   %eax,%eax
+     203:	78 49                	js     24e <exitiputtest+0x99>
+    if(unlink("../iputdir") < 0){
+     205:	83 ec 0c             	sub    $0xc,%esp
+     208:	68 ef 40 00 00       	push   $0x40ef
+     20d:	e8 6b 3a 00 00       	call   3c7d <unlink>
+     212:	83 c4 10             	add    $0x10,%esp
+     215:	85 c0                	test   %eax,%eax
+     217:	78 4d                	js     266 <exitiputtest+0xb1>
+    exit();
+     219:	e8 0f 3a 00 00       	call   3c2d <exit>
+    printf(stdout, "fork failed\n");
+     21e:	83 ec 08             	sub    $0x8,%esp
+     221:	68 ef 50 00 00       	push   $0x50ef
+     226:	ff 35 3c 63 00 00    	push   0x633c
+     22c:	e8 a1 3b 00 00       	call   3dd2 <printf>
+    exit();
+     231:	e8 f7 39 00 00       	call   3c2d <exit>
+      printf(stdout, "mkdir failed\n");
+     236:	83 ec 08             	sub    $0x8,%esp
+     239:	68 cb 40 00 00       	push   $0x40cb
+     23e:	ff 35 3c 63 00 00    	push   0x633c
+     244:	e8 89 3b 00 00       	call   3dd2 <printf>
+      exit();
+     249:	e8 df 39 00 00       	call   3c2d <exit>
+      printf(stdout, "child chdir failed\n");
+     24e:	83 ec 08             	sub    $0x8,%esp
+     251:	68 35 41 00 00       	push   $0x4135
+     256:	ff 35 3c 63 00 00    	push   0x633c
+     25c:	e8 71 3b 00 00       	call   3dd2 <printf>
+      exit();
+     261:	e8 c7 39 00 00       	call   3c2d <exit>
+      printf(stdout, "unlink ../iputdir failed\n");
+     266:	83 ec 08             	sub    $0x8,%esp
+     269:	68 fa 40 00 00       	push   $0x40fa
+     26e:	ff 35 3c 63 00 00    	push   0x633c
+     274:	e8 59 3b 00 00       	call   3dd2 <printf>
+      exit();
+     279:	e8 af 39 00 00       	call   3c2d <exit>
+  wait();
+     27e:	e8 b2 39 00 00       	call   3c35 <wait>
+  printf(stdout, "exitiput test ok\n");
+     283:	83 ec 08             	sub    $0x8,%esp
+     286:	68 49 41 00 00       	push   $0x4149
+     28b:	ff 35 3c 63 00 00    	push   0x633c
+     291:	e8 3c 3b 00 00       	call   3dd2 <printf>
+}
+     296:	83 c4 10             	add    $0x10,%esp
+     299:	c9                   	leave
+     29a:	c3                   	ret
+
+0000029b <openiputtest>:
+{
+     29b:	55                   	push   %ebp
+     29c:	89 e5                	mov    %esp,%ebp
+     29e:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     2a1:	68 5b 41 00 00       	push   $0x415b
+     2a6:	ff 35 3c 63 00 00    	push   0x633c
+     2ac:	e8 21 3b 00 00       	call   3dd2 <printf>
+  if(mkdir("oidir") < 0){
+     2b1:	c7 04 24 6a 41 00 00 	movl   $0x416a,(%esp)
+     2b8:	e8 d8 39 00 00       	call   3c95 <mkdir>
+     2bd:	83 c4 10             	add    $0x10,%esp
+     2c0:	85 c0                	test   %eax,%eax
+     2c2:	78 39                	js     2fd <openiputtest+0x62>
+  pid = fork();
+     2c4:	e8 5c 39 00 00       	call   3c25 <fork>
+  if(pid < 0){
+     2c9:	85 c0                	test   %eax,%eax
+     2cb:	78 48                	js     315 <openiputtest+0x7a>
+  if(pid == 0){
+     2cd:	75 63                	jne    332 <openiputtest+0x97>
+    int fd = open("oidir", O_RDWR);
+     2cf:	83 ec 08             	sub    $0x8,%esp
+     2d2:	6a 02                	push   $0x2
+     2d4:	68 6a 41 00 00       	push   $0x416a
+     2d9:	e8 8f 39 00 00       	call   3c6d <open>
+    if(fd >= 0){
+     2de:	83 c4 10             	add    $0x10,%esp
+     2e1:	85 c0                	test   %eax,%eax
+     2e3:	78 48                	js     32d <openiputtest+0x92>
+      printf(stdout, "open directory for write succeeded\n");
+     2e5:	83 ec 08             	sub    $0x8,%esp
+     2e8:	68 d0 51 00 00       	push   $0x51d0
+     2ed:	ff 35 3c 63 00 00    	push   0x633c
+     2f3:	e8 da 3a 00 00       	call   3dd2 <printf>
+      exit();
+     2f8:	e8 30 39 00 00       	call   3c2d <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     2fd:	83 ec 08             	sub    $0x8,%esp
+     300:	68 70 41 00 00       	push   $0x4170
+     305:	ff 35 3c 63 00 00    	push   0x633c
+     30b:	e8 c2 3a 00 00       	call   3dd2 <printf>
+    exit();
+     310:	e8 18 39 00 00       	call   3c2d <exit>
+    printf(stdout, "fork failed\n");
+     315:	83 ec 08             	sub    $0x8,%esp
+     318:	68 ef 50 00 00       	push   $0x50ef
+     31d:	ff 35 3c 63 00 00    	push   0x633c
+     323:	e8 aa 3a 00 00       	call   3dd2 <printf>
+    exit();
+     328:	e8 00 39 00 00       	call   3c2d <exit>
+    exit();
+     32d:	e8 fb 38 00 00       	call   3c2d <exit>
+  sleep(1);
+     332:	83 ec 0c             	sub    $0xc,%esp
+     335:	6a 01                	push   $0x1
+     337:	e8 81 39 00 00       	call   3cbd <sleep>
+  if(unlink("oidir") != 0){
+     33c:	c7 04 24 6a 41 00 00 	movl   $0x416a,(%esp)
+     343:	e8 35 39 00 00       	call   3c7d <unlink>
+     348:	83 c4 10             	add    $0x10,%esp
+     34b:	85 c0                	test   %eax,%eax
+     34d:	75 1d                	jne    36c <openiputtest+0xd1>
+  wait();
+     34f:	e8 e1 38 00 00       	call   3c35 <wait>
+  printf(stdout, "openiput test ok\n");
+     354:	83 ec 08             	sub    $0x8,%esp
+     357:	68 93 41 00 00       	push   $0x4193
+     35c:	ff 35 3c 63 00 00    	push   0x633c
+     362:	e8 6b 3a 00 00       	call   3dd2 <printf>
+}
+     367:	83 c4 10             	add    $0x10,%esp
+     36a:	c9                   	leave
+     36b:	c3                   	ret
+    printf(stdout, "unlink failed\n");
+     36c:	83 ec 08             	sub    $0x8,%esp
+     36f:	68 84 41 00 00       	push   $0x4184
+     374:	ff 35 3c 63 00 00    	push   0x633c
+     37a:	e8 53 3a 00 00       	call   3dd2 <printf>
+    exit();
+     37f:	e8 a9 38 00 00       	call   3c2d <exit>
+
+00000384 <opentest>:
+{
+     384:	55                   	push   %ebp
+     385:	89 e5                	mov    %esp,%ebp
+     387:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     38a:	68 a5 41 00 00       	push   $0x41a5
+     38f:	ff 35 3c 63 00 00    	push   0x633c
+     395:	e8 38 3a 00 00       	call   3dd2 <printf>
+  fd = open("echo", 0);
+     39a:	83 c4 08             	add    $0x8,%esp
+     39d:	6a 00                	push   $0x0
+     39f:	68 b0 41 00 00       	push   $0x41b0
+     3a4:	e8 c4 38 00 00       	call   3c6d <open>
+  if(fd < 0){
+     3a9:	83 c4 10             	add    $0x10,%esp
+     3ac:	85 c0                	test   %eax,%eax
+     3ae:	78 37                	js     3e7 <opentest+0x63>
+  close(fd);
+     3b0:	83 ec 0c             	sub    $0xc,%esp
+     3b3:	50                   	push   %eax
+     3b4:	e8 9c 38 00 00       	call   3c55 <close>
+  fd = open("doesnotexist", 0);
+     3b9:	83 c4 08             	add    $0x8,%esp
+     3bc:	6a 00                	push   $0x0
+     3be:	68 c8 41 00 00       	push   $0x41c8
+     3c3:	e8 a5 38 00 00       	call   3c6d <open>
+  if(fd >= 0){
+     3c8:	83 c4 10             	add    $0x10,%esp
+     3cb:	85 c0                	test   %eax,%eax
+     3cd:	79 30                	jns    3ff <opentest+0x7b>
+  printf(stdout, "open test ok\n");
+     3cf:	83 ec 08             	sub    $0x8,%esp
+     3d2:	68 f3 41 00 00       	push   $0x41f3
+     3d7:	ff 35 3c 63 00 00    	push   0x633c
+     3dd:	e8 f0 39 00 00       	call   3dd2 <printf>
+}
+     3e2:	83 c4 10             	add    $0x10,%esp
+     3e5:	c9                   	leave
+     3e6:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     3e7:	83 ec 08             	sub    $0x8,%esp
+     3ea:	68 b5 41 00 00       	push   $0x41b5
+     3ef:	ff 35 3c 63 00 00    	push   0x633c
+     3f5:	e8 d8 39 00 00       	call   3dd2 <printf>
+    exit();
+     3fa:	e8 2e 38 00 00       	call   3c2d <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     3ff:	83 ec 08             	sub    $0x8,%esp
+     402:	68 d5 41 00 00       	push   $0x41d5
+     407:	ff 35 3c 63 00 00    	push   0x633c
+     40d:	e8 c0 39 00 00       	call   3dd2 <printf>
+    exit();
+     412:	e8 16 38 00 00       	call   3c2d <exit>
+
+00000417 <writetest>:
+{
+     417:	55                   	push   %ebp
+     418:	89 e5                	mov    %esp,%ebp
+     41a:	56                   	push   %esi
+     41b:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     41c:	83 ec 08             	sub    $0x8,%esp
+     41f:	68 01 42 00 00       	push   $0x4201
+     424:	ff 35 3c 63 00 00    	push   0x633c
+     42a:	e8 a3 39 00 00       	call   3dd2 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     42f:	83 c4 08             	add    $0x8,%esp
+     432:	68 02 02 00 00       	push   $0x202
+     437:	68 12 42 00 00       	push   $0x4212
+     43c:	e8 2c 38 00 00       	call   3c6d <open>
+  if(fd >= 0){
+     441:	83 c4 10             	add    $0x10,%esp
+     444:	85 c0                	test   %eax,%eax
+     446:	78 57                	js     49f <writetest+0x88>
+     448:	89 c6                	mov    %eax,%esi
+    printf(stdout, "creat small succeeded; ok\n");
+     44a:	83 ec 08             	sub    $0x8,%esp
+     44d:	68 18 42 00 00       	push   $0x4218
+     452:	ff 35 3c 63 00 00    	push   0x633c
+     458:	e8 75 39 00 00       	call   3dd2 <printf>
+  for(i = 0; i < 100; i++){
+     45d:	83 c4 10             	add    $0x10,%esp
+     460:	bb 00 00 00 00       	mov    $0x0,%ebx
+     465:	83 fb 63             	cmp    $0x63,%ebx
+     468:	7f 7f                	jg     4e9 <writetest+0xd2>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     46a:	83 ec 04             	sub    $0x4,%esp
+     46d:	6a 0a                	push   $0xa
+     46f:	68 4f 42 00 00       	push   $0x424f
+     474:	56                   	push   %esi
+     475:	e8 d3 37 00 00       	call   3c4d <write>
+     47a:	83 c4 10             	add    $0x10,%esp
+     47d:	83 f8 0a             	cmp    $0xa,%eax
+     480:	75 35                	jne    4b7 <writetest+0xa0>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     482:	83 ec 04             	sub    $0x4,%esp
+     485:	6a 0a                	push   $0xa
+     487:	68 5a 42 00 00       	push   $0x425a
+     48c:	56                   	push   %esi
+     48d:	e8 bb 37 00 00       	call   3c4d <write>
+     492:	83 c4 10             	add    $0x10,%esp
+     495:	83 f8 0a             	cmp    $0xa,%eax
+     498:	75 36                	jne    4d0 <writetest+0xb9>
+  for(i = 0; i < 100; i++){
+     49a:	83 c3 01             	add    $0x1,%ebx
+     49d:	eb c6                	jmp    465 <writetest+0x4e>
+    printf(stdout, "error: creat small failed!\n");
+     49f:	83 ec 08             	sub    $0x8,%esp
+     4a2:	68 33 42 00 00       	push   $0x4233
+     4a7:	ff 35 3c 63 00 00    	push   0x633c
+     4ad:	e8 20 39 00 00       	call   3dd2 <printf>
+    exit();
+     4b2:	e8 76 37 00 00       	call   3c2d <exit>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     4b7:	83 ec 04             	sub    $0x4,%esp
+     4ba:	53                   	push   %ebx
+     4bb:	68 f4 51 00 00       	push   $0x51f4
+     4c0:	ff 35 3c 63 00 00    	push   0x633c
+     4c6:	e8 07 39 00 00       	call   3dd2 <printf>
+      exit();
+     4cb:	e8 5d 37 00 00       	call   3c2d <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     4d0:	83 ec 04             	sub    $0x4,%esp
+     4d3:	53                   	push   %ebx
+     4d4:	68 18 52 00 00       	push   $0x5218
+     4d9:	ff 35 3c 63 00 00    	push   0x633c
+     4df:	e8 ee 38 00 00       	call   3dd2 <printf>
+      exit();
+     4e4:	e8 44 37 00 00       	call   3c2d <exit>
+  printf(stdout, "writes ok\n");
+     4e9:	83 ec 08             	sub    $0x8,%esp
+     4ec:	68 65 42 00 00       	push   $0x4265
+     4f1:	ff 35 3c 63 00 00    	push   0x633c
+     4f7:	e8 d6 38 00 00       	call   3dd2 <printf>
+  close(fd);
+     4fc:	89 34 24             	mov    %esi,(%esp)
+     4ff:	e8 51 37 00 00       	call   3c55 <close>
+  fd = open("small", O_RDONLY);
+     504:	83 c4 08             	add    $0x8,%esp
+     507:	6a 00                	push   $0x0
+     509:	68 12 42 00 00       	push   $0x4212
+     50e:	e8 5a 37 00 00       	call   3c6d <open>
+     513:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     515:	83 c4 10             	add    $0x10,%esp
+     518:	85 c0                	test   %eax,%eax
+     51a:	78 7b                	js     597 <writetest+0x180>
+    printf(stdout, "open small succeeded ok\n");
+     51c:	83 ec 08             	sub    $0x8,%esp
+     51f:	68 70 42 00 00       	push   $0x4270
+     524:	ff 35 3c 63 00 00    	push   0x633c
+     52a:	e8 a3 38 00 00       	call   3dd2 <printf>
+  i = read(fd, buf, 2000);
+     52f:	83 c4 0c             	add    $0xc,%esp
+     532:	68 d0 07 00 00       	push   $0x7d0
+     537:	68 80 8a 00 00       	push   $0x8a80
+     53c:	53                   	push   %ebx
+     53d:	e8 03 37 00 00       	call   3c45 <read>
+  if(i == 2000){
+     542:	83 c4 10             	add    $0x10,%esp
+     545:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     54a:	75 63                	jne    5af <writetest+0x198>
+    printf(stdout, "read succeeded ok\n");
+     54c:	83 ec 08             	sub    $0x8,%esp
+     54f:	68 a4 42 00 00       	push   $0x42a4
+     554:	ff 35 3c 63 00 00    	push   0x633c
+     55a:	e8 73 38 00 00       	call   3dd2 <printf>
+  close(fd);
+     55f:	89 1c 24             	mov    %ebx,(%esp)
+     562:	e8 ee 36 00 00       	call   3c55 <close>
+  if(unlink("small") < 0){
+     567:	c7 04 24 12 42 00 00 	movl   $0x4212,(%esp)
+     56e:	e8 0a 37 00 00       	call   3c7d <unlink>
+     573:	83 c4 10             	add    $0x10,%esp
+     576:	85 c0                	test   %eax,%eax
+     578:	78 4d                	js     5c7 <writetest+0x1b0>
+  printf(stdout, "small file test ok\n");
+     57a:	83 ec 08             	sub    $0x8,%esp
+     57d:	68 cc 42 00 00       	push   $0x42cc
+     582:	ff 35 3c 63 00 00    	push   0x633c
+     588:	e8 45 38 00 00       	call   3dd2 <printf>
+}
+     58d:	83 c4 10             	add    $0x10,%esp
+     590:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     593:	5b                   	pop    %ebx
+     594:	5e                   	pop    %esi
+     595:	5d                   	pop    %ebp
+     596:	c3                   	ret
+    printf(stdout, "error: open small failed!\n");
+     597:	83 ec 08             	sub    $0x8,%esp
+     59a:	68 89 42 00 00       	push   $0x4289
+     59f:	ff 35 3c 63 00 00    	push   0x633c
+     5a5:	e8 28 38 00 00       	call   3dd2 <printf>
+    exit();
+     5aa:	e8 7e 36 00 00       	call   3c2d <exit>
+    printf(stdout, "read failed\n");
+     5af:	83 ec 08             	sub    $0x8,%esp
+     5b2:	68 a0 40 00 00       	push   $0x40a0
+     5b7:	ff 35 3c 63 00 00    	push   0x633c
+     5bd:	e8 10 38 00 00       	call   3dd2 <printf>
+    exit();
+     5c2:	e8 66 36 00 00       	call   3c2d <exit>
+    printf(stdout, "unlink small failed\n");
+     5c7:	83 ec 08             	sub    $0x8,%esp
+     5ca:	68 b7 42 00 00       	push   $0x42b7
+     5cf:	ff 35 3c 63 00 00    	push   0x633c
+     5d5:	e8 f8 37 00 00       	call   3dd2 <printf>
+    exit();
+     5da:	e8 4e 36 00 00       	call   3c2d <exit>
+
+000005df <writetest1>:
+{
+     5df:	55                   	push   %ebp
+     5e0:	89 e5                	mov    %esp,%ebp
+     5e2:	56                   	push   %esi
+     5e3:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     5e4:	83 ec 08             	sub    $0x8,%esp
+     5e7:	68 e0 42 00 00       	push   $0x42e0
+     5ec:	ff 35 3c 63 00 00    	push   0x633c
+     5f2:	e8 db 37 00 00       	call   3dd2 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     5f7:	83 c4 08             	add    $0x8,%esp
+     5fa:	68 02 02 00 00       	push   $0x202
+     5ff:	68 5a 43 00 00       	push   $0x435a
+     604:	e8 64 36 00 00       	call   3c6d <open>
+  if(fd < 0){
+     609:	83 c4 10             	add    $0x10,%esp
+     60c:	85 c0                	test   %eax,%eax
+     60e:	78 37                	js     647 <writetest1+0x68>
+     610:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGFILE; i++){
+     612:	bb 00 00 00 00       	mov    $0x0,%ebx
+     617:	81 fb 1a 04 00 00    	cmp    $0x41a,%ebx
+     61d:	77 59                	ja     678 <writetest1+0x99>
+    ((int*)buf)[0] = i;
+     61f:	89 1d 80 8a 00 00    	mov    %ebx,0x8a80
+    if(write(fd, buf, BSIZE) != BSIZE){
+     625:	83 ec 04             	sub    $0x4,%esp
+     628:	68 00 10 00 00       	push   $0x1000
+     62d:	68 80 8a 00 00       	push   $0x8a80
+     632:	56                   	push   %esi
+     633:	e8 15 36 00 00       	call   3c4d <write>
+     638:	83 c4 10             	add    $0x10,%esp
+     63b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     640:	75 1d                	jne    65f <writetest1+0x80>
+  for(i = 0; i < BIGFILE; i++){
+     642:	83 c3 01             	add    $0x1,%ebx
+     645:	eb d0                	jmp    617 <writetest1+0x38>
+    printf(stdout, "error: creat big failed!\n");
+     647:	83 ec 08             	sub    $0x8,%esp
+     64a:	68 f0 42 00 00       	push   $0x42f0
+     64f:	ff 35 3c 63 00 00    	push   0x633c
+     655:	e8 78 37 00 00       	call   3dd2 <printf>
+    exit();
+     65a:	e8 ce 35 00 00       	call   3c2d <exit>
+      printf(stdout, "error: write big file failed\n", i);
+     65f:	83 ec 04             	sub    $0x4,%esp
+     662:	53                   	push   %ebx
+     663:	68 0a 43 00 00       	push   $0x430a
+     668:	ff 35 3c 63 00 00    	push   0x633c
+     66e:	e8 5f 37 00 00       	call   3dd2 <printf>
+      exit();
+     673:	e8 b5 35 00 00       	call   3c2d <exit>
+  close(fd);
+     678:	83 ec 0c             	sub    $0xc,%esp
+     67b:	56                   	push   %esi
+     67c:	e8 d4 35 00 00       	call   3c55 <close>
+  fd = open("big", O_RDONLY);
+     681:	83 c4 08             	add    $0x8,%esp
+     684:	6a 00                	push   $0x0
+     686:	68 5a 43 00 00       	push   $0x435a
+     68b:	e8 dd 35 00 00       	call   3c6d <open>
+     690:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     692:	83 c4 10             	add    $0x10,%esp
+     695:	85 c0                	test   %eax,%eax
+     697:	78 3c                	js     6d5 <writetest1+0xf6>
+  n = 0;
+     699:	bb 00 00 00 00       	mov    $0x0,%ebx
+    i = read(fd, buf, BSIZE);
+     69e:	83 ec 04             	sub    $0x4,%esp
+     6a1:	68 00 10 00 00       	push   $0x1000
+     6a6:	68 80 8a 00 00       	push   $0x8a80
+     6ab:	56                   	push   %esi
+     6ac:	e8 94 35 00 00       	call   3c45 <read>
+    if(i == 0){
+     6b1:	83 c4 10             	add    $0x10,%esp
+     6b4:	85 c0                	test   %eax,%eax
+     6b6:	74 35                	je     6ed <writetest1+0x10e>
+    } else if(i != BSIZE){
+     6b8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     6bd:	0f 85 84 00 00 00    	jne    747 <writetest1+0x168>
+    if(((int*)buf)[0] != n){
+     6c3:	a1 80 8a 00 00       	mov    0x8a80,%eax
+     6c8:	39 d8                	cmp    %ebx,%eax
+     6ca:	0f 85 90 00 00 00    	jne    760 <writetest1+0x181>
+    n++;
+     6d0:	83 c3 01             	add    $0x1,%ebx
+    i = read(fd, buf, BSIZE);
+     6d3:	eb c9                	jmp    69e <writetest1+0xbf>
+    printf(stdout, "error: open big failed!\n");
+     6d5:	83 ec 08             	sub    $0x8,%esp
+     6d8:	68 28 43 00 00       	push   $0x4328
+     6dd:	ff 35 3c 63 00 00    	push   0x633c
+     6e3:	e8 ea 36 00 00       	call   3dd2 <printf>
+    exit();
+     6e8:	e8 40 35 00 00       	call   3c2d <exit>
+      if(n == BIGFILE - 1){
+     6ed:	81 fb 1a 04 00 00    	cmp    $0x41a,%ebx
+     6f3:	74 39                	je     72e <writetest1+0x14f>
+  close(fd);
+     6f5:	83 ec 0c             	sub    $0xc,%esp
+     6f8:	56                   	push   %esi
+     6f9:	e8 57 35 00 00       	call   3c55 <close>
+  if(unlink("big") < 0){
+     6fe:	c7 04 24 5a 43 00 00 	movl   $0x435a,(%esp)
+     705:	e8 73 35 00 00       	call   3c7d <unlink>
+     70a:	83 c4 10             	add    $0x10,%esp
+     70d:	85 c0                	test   %eax,%eax
+     70f:	78 66                	js     777 <writetest1+0x198>
+  printf(stdout, "big files ok\n");
+     711:	83 ec 08             	sub    $0x8,%esp
+     714:	68 81 43 00 00       	push   $0x4381
+     719:	ff 35 3c 63 00 00    	push   0x633c
+     71f:	e8 ae 36 00 00       	call   3dd2 <printf>
+}
+     724:	83 c4 10             	add    $0x10,%esp
+     727:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     72a:	5b                   	pop    %ebx
+     72b:	5e                   	pop    %esi
+     72c:	5d                   	pop    %ebp
+     72d:	c3                   	ret
+        printf(stdout, "read only %d blocks from big", n);
+     72e:	83 ec 04             	sub    $0x4,%esp
+     731:	53                   	push   %ebx
+     732:	68 41 43 00 00       	push   $0x4341
+     737:	ff 35 3c 63 00 00    	push   0x633c
+     73d:	e8 90 36 00 00       	call   3dd2 <printf>
+        exit();
+     742:	e8 e6 34 00 00       	call   3c2d <exit>
+      printf(stdout, "read failed %d\n", i);
+     747:	83 ec 04             	sub    $0x4,%esp
+     74a:	50                   	push   %eax
+     74b:	68 5e 43 00 00       	push   $0x435e
+     750:	ff 35 3c 63 00 00    	push   0x633c
+     756:	e8 77 36 00 00       	call   3dd2 <printf>
+      exit();
+     75b:	e8 cd 34 00 00       	call   3c2d <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     760:	50                   	push   %eax
+     761:	53                   	push   %ebx
+     762:	68 3c 52 00 00       	push   $0x523c
+     767:	ff 35 3c 63 00 00    	push   0x633c
+     76d:	e8 60 36 00 00       	call   3dd2 <printf>
+      exit();
+     772:	e8 b6 34 00 00       	call   3c2d <exit>
+    printf(stdout, "unlink big failed\n");
+     777:	83 ec 08             	sub    $0x8,%esp
+     77a:	68 6e 43 00 00       	push   $0x436e
+     77f:	ff 35 3c 63 00 00    	push   0x633c
+     785:	e8 48 36 00 00       	call   3dd2 <printf>
+    exit();
+     78a:	e8 9e 34 00 00       	call   3c2d <exit>
+
+0000078f <createtest>:
+{
+     78f:	55                   	push   %ebp
+     790:	89 e5                	mov    %esp,%ebp
+     792:	53                   	push   %ebx
+     793:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     796:	68 5c 52 00 00       	push   $0x525c
+     79b:	ff 35 3c 63 00 00    	push   0x633c
+     7a1:	e8 2c 36 00 00       	call   3dd2 <printf>
+  name[0] = 'a';
+     7a6:	c6 05 70 8a 00 00 61 	movb   $0x61,0x8a70
+  name[2] = '\0';
+     7ad:	c6 05 72 8a 00 00 00 	movb   $0x0,0x8a72
+  for(i = 0; i < 52; i++){
+     7b4:	83 c4 10             	add    $0x10,%esp
+     7b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+     7bc:	eb 28                	jmp    7e6 <createtest+0x57>
+    name[1] = '0' + i;
+     7be:	8d 43 30             	lea    0x30(%ebx),%eax
+     7c1:	a2 71 8a 00 00       	mov    %al,0x8a71
+    fd = open(name, O_CREATE|O_RDWR);
+     7c6:	83 ec 08             	sub    $0x8,%esp
+     7c9:	68 02 02 00 00       	push   $0x202
+     7ce:	68 70 8a 00 00       	push   $0x8a70
+     7d3:	e8 95 34 00 00       	call   3c6d <open>
+    close(fd);
+     7d8:	89 04 24             	mov    %eax,(%esp)
+     7db:	e8 75 34 00 00       	call   3c55 <close>
+  for(i = 0; i < 52; i++){
+     7e0:	83 c3 01             	add    $0x1,%ebx
+     7e3:	83 c4 10             	add    $0x10,%esp
+     7e6:	83 fb 33             	cmp    $0x33,%ebx
+     7e9:	7e d3                	jle    7be <createtest+0x2f>
+  name[0] = 'a';
+     7eb:	c6 05 70 8a 00 00 61 	movb   $0x61,0x8a70
+  name[2] = '\0';
+     7f2:	c6 05 72 8a 00 00 00 	movb   $0x0,0x8a72
+  for(i = 0; i < 52; i++){
+     7f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+     7fe:	eb 1b                	jmp    81b <createtest+0x8c>
+    name[1] = '0' + i;
+     800:	8d 43 30             	lea    0x30(%ebx),%eax
+     803:	a2 71 8a 00 00       	mov    %al,0x8a71
+    unlink(name);
+     808:	83 ec 0c             	sub    $0xc,%esp
+     80b:	68 70 8a 00 00       	push   $0x8a70
+     810:	e8 68 34 00 00       	call   3c7d <unlink>
+  for(i = 0; i < 52; i++){
+     815:	83 c3 01             	add    $0x1,%ebx
+     818:	83 c4 10             	add    $0x10,%esp
+     81b:	83 fb 33             	cmp    $0x33,%ebx
+     81e:	7e e0                	jle    800 <createtest+0x71>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     820:	83 ec 08             	sub    $0x8,%esp
+     823:	68 84 52 00 00       	push   $0x5284
+     828:	ff 35 3c 63 00 00    	push   0x633c
+     82e:	e8 9f 35 00 00       	call   3dd2 <printf>
+}
+     833:	83 c4 10             	add    $0x10,%esp
+     836:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     839:	c9                   	leave
+     83a:	c3                   	ret
+
+0000083b <dirtest>:
+{
+     83b:	55                   	push   %ebp
+     83c:	89 e5                	mov    %esp,%ebp
+     83e:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     841:	68 8f 43 00 00       	push   $0x438f
+     846:	ff 35 3c 63 00 00    	push   0x633c
+     84c:	e8 81 35 00 00       	call   3dd2 <printf>
+  if(mkdir("dir0") < 0){
+     851:	c7 04 24 9b 43 00 00 	movl   $0x439b,(%esp)
+     858:	e8 38 34 00 00       	call   3c95 <mkdir>
+     85d:	83 c4 10             	add    $0x10,%esp
+     860:	85 c0                	test   %eax,%eax
+     862:	78 54                	js     8b8 <dirtest+0x7d>
+  if(chdir("dir0") < 0){
+     864:	83 ec 0c             	sub    $0xc,%esp
+     867:	68 9b 43 00 00       	push   $0x439b
+     86c:	e8 2c 34 00 00       	call   3c9d <chdir>
+     871:	83 c4 10             	add    $0x10,%esp
+     874:	85 c0                	test   %eax,%eax
+     876:	78 58                	js     8d0 <dirtest+0x95>
+  if(chdir("..") < 0){
+     878:	83 ec 0c             	sub    $0xc,%esp
+     87b:	68 23 4a 00 00       	push   $0x4a23
+     880:	e8 18 34 00 00       	call   3c9d <chdir>
+     885:	83 c4 10             	add    $0x10,%esp
+     888:	85 c0                	test   %eax,%eax
+     88a:	78 5c                	js     8e8 <dirtest+0xad>
+  if(unlink("dir0") < 0){
+     88c:	83 ec 0c             	sub    $0xc,%esp
+     88f:	68 9b 43 00 00       	push   $0x439b
+     894:	e8 e4 33 00 00       	call   3c7d <unlink>
+     899:	83 c4 10             	add    $0x10,%esp
+     89c:	85 c0                	test   %eax,%eax
+     89e:	78 60                	js     900 <dirtest+0xc5>
+  printf(stdout, "mkdir test ok\n");
+     8a0:	83 ec 08             	sub    $0x8,%esp
+     8a3:	68 d8 43 00 00       	push   $0x43d8
+     8a8:	ff 35 3c 63 00 00    	push   0x633c
+     8ae:	e8 1f 35 00 00       	call   3dd2 <printf>
+}
+     8b3:	83 c4 10             	add    $0x10,%esp
+     8b6:	c9                   	leave
+     8b7:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     8b8:	83 ec 08             	sub    $0x8,%esp
+     8bb:	68 cb 40 00 00       	push   $0x40cb
+     8c0:	ff 35 3c 63 00 00    	push   0x633c
+     8c6:	e8 07 35 00 00       	call   3dd2 <printf>
+    exit();
+     8cb:	e8 5d 33 00 00       	call   3c2d <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     8d0:	83 ec 08             	sub    $0x8,%esp
+     8d3:	68 a0 43 00 00       	push   $0x43a0
+     8d8:	ff 35 3c 63 00 00    	push   0x633c
+     8de:	e8 ef 34 00 00       	call   3dd2 <printf>
+    exit();
+     8e3:	e8 45 33 00 00       	call   3c2d <exit>
+    printf(stdout, "chdir .. failed\n");
+     8e8:	83 ec 08             	sub    $0x8,%esp
+     8eb:	68 b3 43 00 00       	push   $0x43b3
+     8f0:	ff 35 3c 63 00 00    	push   0x633c
+     8f6:	e8 d7 34 00 00       	call   3dd2 <printf>
+    exit();
+     8fb:	e8 2d 33 00 00       	call   3c2d <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     900:	83 ec 08             	sub    $0x8,%esp
+     903:	68 c4 43 00 00       	push   $0x43c4
+     908:	ff 35 3c 63 00 00    	push   0x633c
+     90e:	e8 bf 34 00 00       	call   3dd2 <printf>
+    exit();
+     913:	e8 15 33 00 00       	call   3c2d <exit>
+
+00000918 <exectest>:
+{
+     918:	55                   	push   %ebp
+     919:	89 e5                	mov    %esp,%ebp
+     91b:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     91e:	68 e7 43 00 00       	push   $0x43e7
+     923:	ff 35 3c 63 00 00    	push   0x633c
+     929:	e8 a4 34 00 00       	call   3dd2 <printf>
+  if(exec("echo", echoargv) < 0){
+     92e:	83 c4 08             	add    $0x8,%esp
+     931:	68 40 63 00 00       	push   $0x6340
+     936:	68 b0 41 00 00       	push   $0x41b0
+     93b:	e8 25 33 00 00       	call   3c65 <exec>
+     940:	83 c4 10             	add    $0x10,%esp
+     943:	85 c0                	test   %eax,%eax
+     945:	78 02                	js     949 <exectest+0x31>
+}
+     947:	c9                   	leave
+     948:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     949:	83 ec 08             	sub    $0x8,%esp
+     94c:	68 f2 43 00 00       	push   $0x43f2
+     951:	ff 35 3c 63 00 00    	push   0x633c
+     957:	e8 76 34 00 00       	call   3dd2 <printf>
+    exit();
+     95c:	e8 cc 32 00 00       	call   3c2d <exit>
+
+00000961 <pipe1>:
+{
+     961:	55                   	push   %ebp
+     962:	89 e5                	mov    %esp,%ebp
+     964:	57                   	push   %edi
+     965:	56                   	push   %esi
+     966:	53                   	push   %ebx
+     967:	83 ec 38             	sub    $0x38,%esp
+  if(pipe(fds) != 0){
+     96a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     96d:	50                   	push   %eax
+     96e:	e8 ca 32 00 00       	call   3c3d <pipe>
+     973:	83 c4 10             	add    $0x10,%esp
+     976:	85 c0                	test   %eax,%eax
+     978:	75 74                	jne    9ee <pipe1+0x8d>
+     97a:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     97c:	e8 a4 32 00 00       	call   3c25 <fork>
+     981:	89 c7                	mov    %eax,%edi
+  if(pid == 0){
+     983:	85 c0                	test   %eax,%eax
+     985:	74 7b                	je     a02 <pipe1+0xa1>
+  } else if(pid > 0){
+     987:	0f 8e 60 01 00 00    	jle    aed <pipe1+0x18c>
+    close(fds[1]);
+     98d:	83 ec 0c             	sub    $0xc,%esp
+     990:	ff 75 e4             	push   -0x1c(%ebp)
+     993:	e8 bd 32 00 00       	call   3c55 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     998:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     99b:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  seq = 0;
+     99e:	89 f3                	mov    %esi,%ebx
+    cc = 1;
+     9a0:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     9a7:	83 ec 04             	sub    $0x4,%esp
+     9aa:	ff 75 d4             	push   -0x2c(%ebp)
+     9ad:	68 80 8a 00 00       	push   $0x8a80
+     9b2:	ff 75 e0             	push   -0x20(%ebp)
+     9b5:	e8 8b 32 00 00       	call   3c45 <read>
+     9ba:	89 c7                	mov    %eax,%edi
+     9bc:	83 c4 10             	add    $0x10,%esp
+     9bf:	85 c0                	test   %eax,%eax
+     9c1:	0f 8e e2 00 00 00    	jle    aa9 <pipe1+0x148>
+      for(i = 0; i < n; i++){
+     9c7:	89 f0                	mov    %esi,%eax
+     9c9:	89 d9                	mov    %ebx,%ecx
+     9cb:	39 f8                	cmp    %edi,%eax
+     9cd:	0f 8d b4 00 00 00    	jge    a87 <pipe1+0x126>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     9d3:	0f be 98 80 8a 00 00 	movsbl 0x8a80(%eax),%ebx
+     9da:	8d 51 01             	lea    0x1(%ecx),%edx
+     9dd:	31 cb                	xor    %ecx,%ebx
+     9df:	84 db                	test   %bl,%bl
+     9e1:	0f 85 86 00 00 00    	jne    a6d <pipe1+0x10c>
+      for(i = 0; i < n; i++){
+     9e7:	83 c0 01             	add    $0x1,%eax
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     9ea:	89 d1                	mov    %edx,%ecx
+     9ec:	eb dd                	jmp    9cb <pipe1+0x6a>
+    printf(1, "pipe() failed\n");
+     9ee:	83 ec 08             	sub    $0x8,%esp
+     9f1:	68 04 44 00 00       	push   $0x4404
+     9f6:	6a 01                	push   $0x1
+     9f8:	e8 d5 33 00 00       	call   3dd2 <printf>
+    exit();
+     9fd:	e8 2b 32 00 00       	call   3c2d <exit>
+    close(fds[0]);
+     a02:	83 ec 0c             	sub    $0xc,%esp
+     a05:	ff 75 e0             	push   -0x20(%ebp)
+     a08:	e8 48 32 00 00       	call   3c55 <close>
+    for(n = 0; n < 5; n++){
+     a0d:	83 c4 10             	add    $0x10,%esp
+     a10:	89 fe                	mov    %edi,%esi
+  seq = 0;
+     a12:	89 fb                	mov    %edi,%ebx
+    for(n = 0; n < 5; n++){
+     a14:	eb 35                	jmp    a4b <pipe1+0xea>
+        buf[i] = seq++;
+     a16:	88 98 80 8a 00 00    	mov    %bl,0x8a80(%eax)
+      for(i = 0; i < 1033; i++)
+     a1c:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     a1f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+      for(i = 0; i < 1033; i++)
+     a22:	3d 08 04 00 00       	cmp    $0x408,%eax
+     a27:	7e ed                	jle    a16 <pipe1+0xb5>
+      if(write(fds[1], buf, 1033) != 1033){
+     a29:	83 ec 04             	sub    $0x4,%esp
+     a2c:	68 09 04 00 00       	push   $0x409
+     a31:	68 80 8a 00 00       	push   $0x8a80
+     a36:	ff 75 e4             	push   -0x1c(%ebp)
+     a39:	e8 0f 32 00 00       	call   3c4d <write>
+     a3e:	83 c4 10             	add    $0x10,%esp
+     a41:	3d 09 04 00 00       	cmp    $0x409,%eax
+     a46:	75 0c                	jne    a54 <pipe1+0xf3>
+    for(n = 0; n < 5; n++){
+     a48:	83 c6 01             	add    $0x1,%esi
+     a4b:	83 fe 04             	cmp    $0x4,%esi
+     a4e:	7f 18                	jg     a68 <pipe1+0x107>
+      for(i = 0; i < 1033; i++)
+     a50:	89 f8                	mov    %edi,%eax
+     a52:	eb ce                	jmp    a22 <pipe1+0xc1>
+        printf(1, "pipe1 oops 1\n");
+     a54:	83 ec 08             	sub    $0x8,%esp
+     a57:	68 13 44 00 00       	push   $0x4413
+     a5c:	6a 01                	push   $0x1
+     a5e:	e8 6f 33 00 00       	call   3dd2 <printf>
+        exit();
+     a63:	e8 c5 31 00 00       	call   3c2d <exit>
+    exit();
+     a68:	e8 c0 31 00 00       	call   3c2d <exit>
+          printf(1, "pipe1 oops 2\n");
+     a6d:	83 ec 08             	sub    $0x8,%esp
+     a70:	68 21 44 00 00       	push   $0x4421
+     a75:	6a 01                	push   $0x1
+     a77:	e8 56 33 00 00       	call   3dd2 <printf>
+          return;
+     a7c:	83 c4 10             	add    $0x10,%esp
+}
+     a7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a82:	5b                   	pop    %ebx
+     a83:	5e                   	pop    %esi
+     a84:	5f                   	pop    %edi
+     a85:	5d                   	pop    %ebp
+     a86:	c3                   	ret
+      total += n;
+     a87:	89 cb                	mov    %ecx,%ebx
+     a89:	01 7d d0             	add    %edi,-0x30(%ebp)
+      cc = cc * 2;
+     a8c:	d1 65 d4             	shll   -0x2c(%ebp)
+     a8f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+      if(cc > sizeof(buf))
+     a92:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     a97:	0f 86 0a ff ff ff    	jbe    9a7 <pipe1+0x46>
+        cc = sizeof(buf);
+     a9d:	c7 45 d4 00 20 00 00 	movl   $0x2000,-0x2c(%ebp)
+     aa4:	e9 fe fe ff ff       	jmp    9a7 <pipe1+0x46>
+    if(total != 5 * 1033){
+     aa9:	81 7d d0 2d 14 00 00 	cmpl   $0x142d,-0x30(%ebp)
+     ab0:	75 24                	jne    ad6 <pipe1+0x175>
+    close(fds[0]);
+     ab2:	83 ec 0c             	sub    $0xc,%esp
+     ab5:	ff 75 e0             	push   -0x20(%ebp)
+     ab8:	e8 98 31 00 00       	call   3c55 <close>
+    wait();
+     abd:	e8 73 31 00 00       	call   3c35 <wait>
+  printf(1, "pipe1 ok\n");
+     ac2:	83 c4 08             	add    $0x8,%esp
+     ac5:	68 46 44 00 00       	push   $0x4446
+     aca:	6a 01                	push   $0x1
+     acc:	e8 01 33 00 00       	call   3dd2 <printf>
+     ad1:	83 c4 10             	add    $0x10,%esp
+     ad4:	eb a9                	jmp    a7f <pipe1+0x11e>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     ad6:	83 ec 04             	sub    $0x4,%esp
+     ad9:	ff 75 d0             	push   -0x30(%ebp)
+     adc:	68 2f 44 00 00       	push   $0x442f
+     ae1:	6a 01                	push   $0x1
+     ae3:	e8 ea 32 00 00       	call   3dd2 <printf>
+      exit();
+     ae8:	e8 40 31 00 00       	call   3c2d <exit>
+    printf(1, "fork() failed\n");
+     aed:	83 ec 08             	sub    $0x8,%esp
+     af0:	68 50 44 00 00       	push   $0x4450
+     af5:	6a 01                	push   $0x1
+     af7:	e8 d6 32 00 00       	call   3dd2 <printf>
+    exit();
+     afc:	e8 2c 31 00 00       	call   3c2d <exit>
+
+00000b01 <pipesizetest>:
+
+// grow a pipe with wrapped data in it; a write that fits
+// must not block, and every byte must come out in order
+void
+pipesizetest(void)
+{
+     b01:	55                   	push   %ebp
+     b02:	89 e5                	mov    %esp,%ebp
+     b04:	53                   	push   %ebx
+     b05:	83 ec 1c             	sub    $0x1c,%esp
+  int fds[2], pos, n;
+
+  printf(1, "pipesize test\n");
+     b08:	68 5f 44 00 00       	push   $0x445f
+     b0d:	6a 01                	push   $0x1
+     b0f:	e8 be 32 00 00       	call   3dd2 <printf>
+  if(pipe(fds) != 0){
+     b14:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     b17:	89 04 24             	mov    %eax,(%esp)
+     b1a:	e8 1e 31 00 00       	call   3c3d <pipe>
+     b1f:	83 c4 10             	add    $0x10,%esp
+     b22:	85 c0                	test   %eax,%eax
+     b24:	75 16                	jne    b3c <pipesizetest+0x3b>
+     b26:	89 c3                	mov    %eax,%ebx
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  // Leave data wrapped around the end of the default ring.
+  pipesizeput(fds[1], 0, 3000);
+     b28:	b9 b8 0b 00 00       	mov    $0xbb8,%ecx
+     b2d:	ba 00 00 00 00       	mov    $0x0,%edx
+     b32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b35:	e8 c6 f4 ff ff       	call   0 <pipesizeput>
+  for(pos = 0; pos < 2000; pos += n)
+     b3a:	eb 27                	jmp    b63 <pipesizetest+0x62>
+    printf(1, "pipe() failed\n");
+     b3c:	83 ec 08             	sub    $0x8,%esp
+     b3f:	68 04 44 00 00       	push   $0x4404
+     b44:	6a 01                	push   $0x1
+     b46:	e8 87 32 00 00       	call   3dd2 <printf>
+    exit();
+     b4b:	e8 dd 30 00 00       	call   3c2d <exit>
+    n = pipesizeget(fds[0], pos, 2000 - pos);
+     b50:	b9 d0 07 00 00       	mov    $0x7d0,%ecx
+     b55:	29 d9                	sub    %ebx,%ecx
+     b57:	89 da                	mov    %ebx,%edx
+     b59:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b5c:	e8 ff f4 ff ff       	call   60 <pipesizeget>
+  for(pos = 0; pos < 2000; pos += n)
+     b61:	01 c3                	add    %eax,%ebx
+     b63:	81 fb cf 07 00 00    	cmp    $0x7cf,%ebx
+     b69:	7e e5                	jle    b50 <pipesizetest+0x4f>
+  pipesizeput(fds[1], 3000, 2000);
+     b6b:	b9 d0 07 00 00       	mov    $0x7d0,%ecx
+     b70:	ba b8 0b 00 00       	mov    $0xbb8,%edx
+     b75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b78:	e8 83 f4 ff ff       	call   0 <pipesizeput>
+
+  if(pipesize(fds[1], 16384) < 16384 || pipesize(fds[0], 1<<30) >= 0){
+     b7d:	83 ec 08             	sub    $0x8,%esp
+     b80:	68 00 40 00 00       	push   $0x4000
+     b85:	ff 75 f4             	push   -0xc(%ebp)
+     b88:	e8 90 31 00 00       	call   3d1d <pipesize>
+     b8d:	83 c4 10             	add    $0x10,%esp
+     b90:	3d ff 3f 00 00       	cmp    $0x3fff,%eax
+     b95:	7e 39                	jle    bd0 <pipesizetest+0xcf>
+     b97:	83 ec 08             	sub    $0x8,%esp
+     b9a:	68 00 00 00 40       	push   $0x40000000
+     b9f:	ff 75 f0             	push   -0x10(%ebp)
+     ba2:	e8 76 31 00 00       	call   3d1d <pipesize>
+     ba7:	83 c4 10             	add    $0x10,%esp
+     baa:	85 c0                	test   %eax,%eax
+     bac:	79 22                	jns    bd0 <pipesizetest+0xcf>
+    printf(1, "pipesize failed\n");
+    exit();
+  }
+  pipesizeput(fds[1], 5000, 8000);
+     bae:	b9 40 1f 00 00       	mov    $0x1f40,%ecx
+     bb3:	ba 88 13 00 00       	mov    $0x1388,%edx
+     bb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bbb:	e8 40 f4 ff ff       	call   0 <pipesizeput>
+  close(fds[1]);
+     bc0:	83 ec 0c             	sub    $0xc,%esp
+     bc3:	ff 75 f4             	push   -0xc(%ebp)
+     bc6:	e8 8a 30 00 00       	call   3c55 <close>
+  while((n = pipesizeget(fds[0], pos, 1500)) > 0)
+     bcb:	83 c4 10             	add    $0x10,%esp
+     bce:	eb 16                	jmp    be6 <pipesizetest+0xe5>
+    printf(1, "pipesize failed\n");
+     bd0:	83 ec 08             	sub    $0x8,%esp
+     bd3:	68 6e 44 00 00       	push   $0x446e
+     bd8:	6a 01                	push   $0x1
+     bda:	e8 f3 31 00 00       	call   3dd2 <printf>
+    exit();
+     bdf:	e8 49 30 00 00       	call   3c2d <exit>
+    pos += n;
+     be4:	01 c3                	add    %eax,%ebx
+  while((n = pipesizeget(fds[0], pos, 1500)) > 0)
+     be6:	b9 dc 05 00 00       	mov    $0x5dc,%ecx
+     beb:	89 da                	mov    %ebx,%edx
+     bed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bf0:	e8 6b f4 ff ff       	call   60 <pipesizeget>
+     bf5:	85 c0                	test   %eax,%eax
+     bf7:	7f eb                	jg     be4 <pipesizetest+0xe3>
+  if(pos != 13000){
+     bf9:	81 fb c8 32 00 00    	cmp    $0x32c8,%ebx
+     bff:	75 22                	jne    c23 <pipesizetest+0x122>
+    printf(1, "pipesize read %d bytes\n", pos);
+    exit();
+  }
+  close(fds[0]);
+     c01:	83 ec 0c             	sub    $0xc,%esp
+     c04:	ff 75 f0             	push   -0x10(%ebp)
+     c07:	e8 49 30 00 00       	call   3c55 <close>
+  printf(1, "pipesize ok\n");
+     c0c:	83 c4 08             	add    $0x8,%esp
+     c0f:	68 97 44 00 00       	push   $0x4497
+     c14:	6a 01                	push   $0x1
+     c16:	e8 b7 31 00 00       	call   3dd2 <printf>
+}
+     c1b:	83 c4 10             	add    $0x10,%esp
+     c1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c21:	c9                   	leave
+     c22:	c3                   	ret
+    printf(1, "pipesize read %d bytes\n", pos);
+     c23:	83 ec 04             	sub    $0x4,%esp
+     c26:	53                   	push   %ebx
+     c27:	68 7f 44 00 00       	push   $0x447f
+     c2c:	6a 01                	push   $0x1
+     c2e:	e8 9f 31 00 00       	call   3dd2 <printf>
+    exit();
+     c33:	e8 f5 2f 00 00       	call   3c2d <exit>
+
+00000c38 <splicetest>:
+
+// file -> pipe -> file without a user buffer in between
+void
+splicetest(void)
+{
+     c38:	55                   	push   %ebp
+     c39:	89 e5                	mov    %esp,%ebp
+     c3b:	57                   	push   %edi
+     c3c:	56                   	push   %esi
+     c3d:	53                   	push   %ebx
+     c3e:	83 ec 24             	sub    $0x24,%esp
+  int fd, fds[2], i, n;
+
+  printf(1, "splice test\n");
+     c41:	68 a4 44 00 00       	push   $0x44a4
+     c46:	6a 01                	push   $0x1
+     c48:	e8 85 31 00 00       	call   3dd2 <printf>
+  fd = open("splice", O_CREATE|O_RDWR);
+     c4d:	83 c4 08             	add    $0x8,%esp
+     c50:	68 02 02 00 00       	push   $0x202
+     c55:	68 b1 44 00 00       	push   $0x44b1
+     c5a:	e8 0e 30 00 00       	call   3c6d <open>
+     c5f:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 3000; i++)
+     c61:	83 c4 10             	add    $0x10,%esp
+     c64:	b8 00 00 00 00       	mov    $0x0,%eax
+     c69:	eb 09                	jmp    c74 <splicetest+0x3c>
+    buf[i] = i;
+     c6b:	88 80 80 8a 00 00    	mov    %al,0x8a80(%eax)
+  for(i = 0; i < 3000; i++)
+     c71:	83 c0 01             	add    $0x1,%eax
+     c74:	3d b7 0b 00 00       	cmp    $0xbb7,%eax
+     c79:	7e f0                	jle    c6b <splicetest+0x33>
+  if(fd < 0 || write(fd, buf, 3000) != 3000){
+     c7b:	85 db                	test   %ebx,%ebx
+     c7d:	0f 88 b1 00 00 00    	js     d34 <splicetest+0xfc>
+     c83:	83 ec 04             	sub    $0x4,%esp
+     c86:	68 b8 0b 00 00       	push   $0xbb8
+     c8b:	68 80 8a 00 00       	push   $0x8a80
+     c90:	53                   	push   %ebx
+     c91:	e8 b7 2f 00 00       	call   3c4d <write>
+     c96:	83 c4 10             	add    $0x10,%esp
+     c99:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+     c9e:	0f 85 90 00 00 00    	jne    d34 <splicetest+0xfc>
+    printf(1, "splice: create failed\n");
+    exit();
+  }
+  close(fd);
+     ca4:	83 ec 0c             	sub    $0xc,%esp
+     ca7:	53                   	push   %ebx
+     ca8:	e8 a8 2f 00 00       	call   3c55 <close>
+  fd = open("splice", O_RDONLY);
+     cad:	83 c4 08             	add    $0x8,%esp
+     cb0:	6a 00                	push   $0x0
+     cb2:	68 b1 44 00 00       	push   $0x44b1
+     cb7:	e8 b1 2f 00 00       	call   3c6d <open>
+     cbc:	89 c6                	mov    %eax,%esi
+  if(pipe(fds) != 0){
+     cbe:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     cc1:	89 04 24             	mov    %eax,(%esp)
+     cc4:	e8 74 2f 00 00       	call   3c3d <pipe>
+     cc9:	83 c4 10             	add    $0x10,%esp
+     ccc:	85 c0                	test   %eax,%eax
+     cce:	75 78                	jne    d48 <splicetest+0x110>
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(splice(fd, fds[1], 5000) != 3000 || splice(fd, fds[1], 5000) != 0){
+     cd0:	83 ec 04             	sub    $0x4,%esp
+     cd3:	68 88 13 00 00       	push   $0x1388
+     cd8:	ff 75 e4             	push   -0x1c(%ebp)
+     cdb:	56                   	push   %esi
+     cdc:	e8 44 30 00 00       	call   3d25 <splice>
+     ce1:	83 c4 10             	add    $0x10,%esp
+     ce4:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+     ce9:	75 71                	jne    d5c <splicetest+0x124>
+     ceb:	83 ec 04             	sub    $0x4,%esp
+     cee:	68 88 13 00 00       	push   $0x1388
+     cf3:	ff 75 e4             	push   -0x1c(%ebp)
+     cf6:	56                   	push   %esi
+     cf7:	e8 29 30 00 00       	call   3d25 <splice>
+     cfc:	89 c3                	mov    %eax,%ebx
+     cfe:	83 c4 10             	add    $0x10,%esp
+     d01:	85 c0                	test   %eax,%eax
+     d03:	75 57                	jne    d5c <splicetest+0x124>
+    printf(1, "splice: file to pipe failed\n");
+    exit();
+  }
+  close(fd);
+     d05:	83 ec 0c             	sub    $0xc,%esp
+     d08:	56                   	push   %esi
+     d09:	e8 47 2f 00 00       	call   3c55 <close>
+  close(fds[1]);
+     d0e:	83 c4 04             	add    $0x4,%esp
+     d11:	ff 75 e4             	push   -0x1c(%ebp)
+     d14:	e8 3c 2f 00 00       	call   3c55 <close>
+  fd = open("splice2", O_CREATE|O_RDWR);
+     d19:	83 c4 08             	add    $0x8,%esp
+     d1c:	68 02 02 00 00       	push   $0x202
+     d21:	68 ec 44 00 00       	push   $0x44ec
+     d26:	e8 42 2f 00 00       	call   3c6d <open>
+     d2b:	89 c7                	mov    %eax,%edi
+  for(n = 0; (i = splice(fds[0], fd, 1000)) > 0; n += i)
+     d2d:	83 c4 10             	add    $0x10,%esp
+     d30:	89 de                	mov    %ebx,%esi
+     d32:	eb 3e                	jmp    d72 <splicetest+0x13a>
+    printf(1, "splice: create failed\n");
+     d34:	83 ec 08             	sub    $0x8,%esp
+     d37:	68 b8 44 00 00       	push   $0x44b8
+     d3c:	6a 01                	push   $0x1
+     d3e:	e8 8f 30 00 00       	call   3dd2 <printf>
+    exit();
+     d43:	e8 e5 2e 00 00       	call   3c2d <exit>
+    printf(1, "pipe() failed\n");
+     d48:	83 ec 08             	sub    $0x8,%esp
+     d4b:	68 04 44 00 00       	push   $0x4404
+     d50:	6a 01                	push   $0x1
+     d52:	e8 7b 30 00 00       	call   3dd2 <printf>
+    exit();
+     d57:	e8 d1 2e 00 00       	call   3c2d <exit>
+    printf(1, "splice: file to pipe failed\n");
+     d5c:	83 ec 08             	sub    $0x8,%esp
+     d5f:	68 cf 44 00 00       	push   $0x44cf
+     d64:	6a 01                	push   $0x1
+     d66:	e8 67 30 00 00       	call   3dd2 <printf>
+    exit();
+     d6b:	e8 bd 2e 00 00       	call   3c2d <exit>
+  for(n = 0; (i = splice(fds[0], fd, 1000)) > 0; n += i)
+     d70:	01 c6                	add    %eax,%esi
+     d72:	83 ec 04             	sub    $0x4,%esp
+     d75:	68 e8 03 00 00       	push   $0x3e8
+     d7a:	57                   	push   %edi
+     d7b:	ff 75 e0             	push   -0x20(%ebp)
+     d7e:	e8 a2 2f 00 00       	call   3d25 <splice>
+     d83:	83 c4 10             	add    $0x10,%esp
+     d86:	85 c0                	test   %eax,%eax
+     d88:	7f e6                	jg     d70 <splicetest+0x138>
+    ;
+  if(i < 0 || n != 3000){
+     d8a:	c1 e8 1f             	shr    $0x1f,%eax
+     d8d:	81 fe b8 0b 00 00    	cmp    $0xbb8,%esi
+     d93:	0f 95 c2             	setne  %dl
+     d96:	08 c2                	or     %al,%dl
+     d98:	75 5b                	jne    df5 <splicetest+0x1bd>
+    printf(1, "splice: pipe to file failed\n");
+    exit();
+  }
+  close(fds[0]);
+     d9a:	83 ec 0c             	sub    $0xc,%esp
+     d9d:	ff 75 e0             	push   -0x20(%ebp)
+     da0:	e8 b0 2e 00 00       	call   3c55 <close>
+  close(fd);
+     da5:	89 3c 24             	mov    %edi,(%esp)
+     da8:	e8 a8 2e 00 00       	call   3c55 <close>
+  fd = open("splice2", O_RDONLY);
+     dad:	83 c4 08             	add    $0x8,%esp
+     db0:	6a 00                	push   $0x0
+     db2:	68 ec 44 00 00       	push   $0x44ec
+     db7:	e8 b1 2e 00 00       	call   3c6d <open>
+     dbc:	89 c6                	mov    %eax,%esi
+  if(read(fd, buf, sizeof(buf)) != 3000){
+     dbe:	83 c4 0c             	add    $0xc,%esp
+     dc1:	68 00 20 00 00       	push   $0x2000
+     dc6:	68 80 8a 00 00       	push   $0x8a80
+     dcb:	50                   	push   %eax
+     dcc:	e8 74 2e 00 00       	call   3c45 <read>
+     dd1:	83 c4 10             	add    $0x10,%esp
+     dd4:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+     dd9:	75 2e                	jne    e09 <splicetest+0x1d1>
+    printf(1, "splice: short file\n");
+    exit();
+  }
+  for(i = 0; i < 3000; i++){
+     ddb:	81 fb b7 0b 00 00    	cmp    $0xbb7,%ebx
+     de1:	7f 4e                	jg     e31 <splicetest+0x1f9>
+    if((buf[i] & 0xff) != (i & 0xff)){
+     de3:	0f be 83 80 8a 00 00 	movsbl 0x8a80(%ebx),%eax
+     dea:	31 d8                	xor    %ebx,%eax
+     dec:	84 c0                	test   %al,%al
+     dee:	75 2d                	jne    e1d <splicetest+0x1e5>
+  for(i = 0; i < 3000; i++){
+     df0:	83 c3 01             	add    $0x1,%ebx
+     df3:	eb e6                	jmp    ddb <splicetest+0x1a3>
+    printf(1, "splice: pipe to file failed\n");
+     df5:	83 ec 08             	sub    $0x8,%esp
+     df8:	68 f4 44 00 00       	push   $0x44f4
+     dfd:	6a 01                	push   $0x1
+     dff:	e8 ce 2f 00 00       	call   3dd2 <printf>
+    exit();
+     e04:	e8 24 2e 00 00       	call   3c2d <exit>
+    printf(1, "splice: short file\n");
+     e09:	83 ec 08             	sub    $0x8,%esp
+     e0c:	68 11 45 00 00       	push   $0x4511
+     e11:	6a 01                	push   $0x1
+     e13:	e8 ba 2f 00 00       	call   3dd2 <printf>
+    exit();
+     e18:	e8 10 2e 00 00       	call   3c2d <exit>
+      printf(1, "splice: bad data\n");
+     e1d:	83 ec 08             	sub    $0x8,%esp
+     e20:	68 25 45 00 00       	push   $0x4525
+     e25:	6a 01                	push   $0x1
+     e27:	e8 a6 2f 00 00       	call   3dd2 <printf>
+      exit();
+     e2c:	e8 fc 2d 00 00       	call   3c2d <exit>
+    }
+  }
+  close(fd);
+     e31:	83 ec 0c             	sub    $0xc,%esp
+     e34:	56                   	push   %esi
+     e35:	e8 1b 2e 00 00       	call   3c55 <close>
+  unlink("splice");
+     e3a:	c7 04 24 b1 44 00 00 	movl   $0x44b1,(%esp)
+     e41:	e8 37 2e 00 00       	call   3c7d <unlink>
+  unlink("splice2");
+     e46:	c7 04 24 ec 44 00 00 	movl   $0x44ec,(%esp)
+     e4d:	e8 2b 2e 00 00       	call   3c7d <unlink>
+  printf(1, "splice ok\n");
+     e52:	83 c4 08             	add    $0x8,%esp
+     e55:	68 37 45 00 00       	push   $0x4537
+     e5a:	6a 01                	push   $0x1
+     e5c:	e8 71 2f 00 00       	call   3dd2 <printf>
+}
+     e61:	83 c4 10             	add    $0x10,%esp
+     e64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e67:	5b                   	pop    %ebx
+     e68:	5e                   	pop    %esi
+     e69:	5f                   	pop    %edi
+     e6a:	5d                   	pop    %ebp
+     e6b:	c3                   	ret
+
+00000e6c <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     e6c:	55                   	push   %ebp
+     e6d:	89 e5                	mov    %esp,%ebp
+     e6f:	57                   	push   %edi
+     e70:	56                   	push   %esi
+     e71:	53                   	push   %ebx
+     e72:	83 ec 24             	sub    $0x24,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     e75:	68 42 45 00 00       	push   $0x4542
+     e7a:	6a 01                	push   $0x1
+     e7c:	e8 51 2f 00 00       	call   3dd2 <printf>
+  pid1 = fork();
+     e81:	e8 9f 2d 00 00       	call   3c25 <fork>
+  if(pid1 == 0)
+     e86:	83 c4 10             	add    $0x10,%esp
+     e89:	85 c0                	test   %eax,%eax
+     e8b:	75 02                	jne    e8f <preempt+0x23>
+    for(;;)
+     e8d:	eb fe                	jmp    e8d <preempt+0x21>
+     e8f:	89 c3                	mov    %eax,%ebx
+      ;
+
+  pid2 = fork();
+     e91:	e8 8f 2d 00 00       	call   3c25 <fork>
+     e96:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     e98:	85 c0                	test   %eax,%eax
+     e9a:	75 02                	jne    e9e <preempt+0x32>
+    for(;;)
+     e9c:	eb fe                	jmp    e9c <preempt+0x30>
+      ;
+
+  pipe(pfds);
+     e9e:	83 ec 0c             	sub    $0xc,%esp
+     ea1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     ea4:	50                   	push   %eax
+     ea5:	e8 93 2d 00 00       	call   3c3d <pipe>
+  pid3 = fork();
+     eaa:	e8 76 2d 00 00       	call   3c25 <fork>
+     eaf:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     eb1:	83 c4 10             	add    $0x10,%esp
+     eb4:	85 c0                	test   %eax,%eax
+     eb6:	75 49                	jne    f01 <preempt+0x95>
+    close(pfds[0]);
+     eb8:	83 ec 0c             	sub    $0xc,%esp
+     ebb:	ff 75 e0             	push   -0x20(%ebp)
+     ebe:	e8 92 2d 00 00       	call   3c55 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     ec3:	83 c4 0c             	add    $0xc,%esp
+     ec6:	6a 01                	push   $0x1
+     ec8:	68 07 4b 00 00       	push   $0x4b07
+     ecd:	ff 75 e4             	push   -0x1c(%ebp)
+     ed0:	e8 78 2d 00 00       	call   3c4d <write>
+     ed5:	83 c4 10             	add    $0x10,%esp
+     ed8:	83 f8 01             	cmp    $0x1,%eax
+     edb:	75 10                	jne    eed <preempt+0x81>
+      printf(1, "preempt write error");
+    close(pfds[1]);
+     edd:	83 ec 0c             	sub    $0xc,%esp
+     ee0:	ff 75 e4             	push   -0x1c(%ebp)
+     ee3:	e8 6d 2d 00 00       	call   3c55 <close>
+     ee8:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     eeb:	eb fe                	jmp    eeb <preempt+0x7f>
+      printf(1, "preempt write error");
+     eed:	83 ec 08             	sub    $0x8,%esp
+     ef0:	68 4c 45 00 00       	push   $0x454c
+     ef5:	6a 01                	push   $0x1
+     ef7:	e8 d6 2e 00 00       	call   3dd2 <printf>
+     efc:	83 c4 10             	add    $0x10,%esp
+     eff:	eb dc                	jmp    edd <preempt+0x71>
+      ;
+  }
+
+  close(pfds[1]);
+     f01:	83 ec 0c             	sub    $0xc,%esp
+     f04:	ff 75 e4             	push   -0x1c(%ebp)
+     f07:	e8 49 2d 00 00       	call   3c55 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     f0c:	83 c4 0c             	add    $0xc,%esp
+     f0f:	68 00 20 00 00       	push   $0x2000
+     f14:	68 80 8a 00 00       	push   $0x8a80
+     f19:	ff 75 e0             	push   -0x20(%ebp)
+     f1c:	e8 24 2d 00 00       	call   3c45 <read>
+     f21:	83 c4 10             	add    $0x10,%esp
+     f24:	83 f8 01             	cmp    $0x1,%eax
+     f27:	74 1a                	je     f43 <preempt+0xd7>
+    printf(1, "preempt read error");
+     f29:	83 ec 08             	sub    $0x8,%esp
+     f2c:	68 60 45 00 00       	push   $0x4560
+     f31:	6a 01                	push   $0x1
+     f33:	e8 9a 2e 00 00       	call   3dd2 <printf>
+    return;
+     f38:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+  wait();
+  wait();
+  wait();
+  printf(1, "preempt ok\n");
+}
+     f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f3e:	5b                   	pop    %ebx
+     f3f:	5e                   	pop    %esi
+     f40:	5f                   	pop    %edi
+     f41:	5d                   	pop    %ebp
+     f42:	c3                   	ret
+  close(pfds[0]);
+     f43:	83 ec 0c             	sub    $0xc,%esp
+     f46:	ff 75 e0             	push   -0x20(%ebp)
+     f49:	e8 07 2d 00 00       	call   3c55 <close>
+  printf(1, "kill... ");
+     f4e:	83 c4 08             	add    $0x8,%esp
+     f51:	68 73 45 00 00       	push   $0x4573
+     f56:	6a 01                	push   $0x1
+     f58:	e8 75 2e 00 00       	call   3dd2 <printf>
+  kill(pid1);
+     f5d:	89 1c 24             	mov    %ebx,(%esp)
+     f60:	e8 f8 2c 00 00       	call   3c5d <kill>
+  kill(pid2);
+     f65:	89 34 24             	mov    %esi,(%esp)
+     f68:	e8 f0 2c 00 00       	call   3c5d <kill>
+  kill(pid3);
+     f6d:	89 3c 24             	mov    %edi,(%esp)
+     f70:	e8 e8 2c 00 00       	call   3c5d <kill>
+  printf(1, "wait... ");
+     f75:	83 c4 08             	add    $0x8,%esp
+     f78:	68 7c 45 00 00       	push   $0x457c
+     f7d:	6a 01                	push   $0x1
+     f7f:	e8 4e 2e 00 00       	call   3dd2 <printf>
+  wait();
+     f84:	e8 ac 2c 00 00       	call   3c35 <wait>
+  wait();
+     f89:	e8 a7 2c 00 00       	call   3c35 <wait>
+  wait();
+     f8e:	e8 a2 2c 00 00       	call   3c35 <wait>
+  printf(1, "preempt ok\n");
+     f93:	83 c4 08             	add    $0x8,%esp
+     f96:	68 85 45 00 00       	push   $0x4585
+     f9b:	6a 01                	push   $0x1
+     f9d:	e8 30 2e 00 00       	call   3dd2 <printf>
+     fa2:	83 c4 10             	add    $0x10,%esp
+     fa5:	eb 94                	jmp    f3b <preempt+0xcf>
+
+00000fa7 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+     fa7:	55                   	push   %ebp
+     fa8:	89 e5                	mov    %esp,%ebp
+     faa:	56                   	push   %esi
+     fab:	53                   	push   %ebx
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+     fac:	be 00 00 00 00       	mov    $0x0,%esi
+     fb1:	83 fe 63             	cmp    $0x63,%esi
+     fb4:	7f 4d                	jg     1003 <exitwait+0x5c>
+    pid = fork();
+     fb6:	e8 6a 2c 00 00       	call   3c25 <fork>
+     fbb:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     fbd:	85 c0                	test   %eax,%eax
+     fbf:	78 10                	js     fd1 <exitwait+0x2a>
+      printf(1, "fork failed\n");
+      return;
+    }
+    if(pid){
+     fc1:	74 3b                	je     ffe <exitwait+0x57>
+      if(wait() != pid){
+     fc3:	e8 6d 2c 00 00       	call   3c35 <wait>
+     fc8:	39 d8                	cmp    %ebx,%eax
+     fca:	75 1e                	jne    fea <exitwait+0x43>
+  for(i = 0; i < 100; i++){
+     fcc:	83 c6 01             	add    $0x1,%esi
+     fcf:	eb e0                	jmp    fb1 <exitwait+0xa>
+      printf(1, "fork failed\n");
+     fd1:	83 ec 08             	sub    $0x8,%esp
+     fd4:	68 ef 50 00 00       	push   $0x50ef
+     fd9:	6a 01                	push   $0x1
+     fdb:	e8 f2 2d 00 00       	call   3dd2 <printf>
+      return;
+     fe0:	83 c4 10             	add    $0x10,%esp
+    } else {
+      exit();
+    }
+  }
+  printf(1, "exitwait ok\n");
+}
+     fe3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fe6:	5b                   	pop    %ebx
+     fe7:	5e                   	pop    %esi
+     fe8:	5d                   	pop    %ebp
+     fe9:	c3                   	ret
+        printf(1, "wait wrong pid\n");
+     fea:	83 ec 08             	sub    $0x8,%esp
+     fed:	68 91 45 00 00       	push   $0x4591
+     ff2:	6a 01                	push   $0x1
+     ff4:	e8 d9 2d 00 00       	call   3dd2 <printf>
+        return;
+     ff9:	83 c4 10             	add    $0x10,%esp
+     ffc:	eb e5                	jmp    fe3 <exitwait+0x3c>
+      exit();
+     ffe:	e8 2a 2c 00 00       	call   3c2d <exit>
+  printf(1, "exitwait ok\n");
+    1003:	83 ec 08             	sub    $0x8,%esp
+    1006:	68 a1 45 00 00       	push   $0x45a1
+    100b:	6a 01                	push   $0x1
+    100d:	e8 c0 2d 00 00       	call   3dd2 <printf>
+    1012:	83 c4 10             	add    $0x10,%esp
+    1015:	eb cc                	jmp    fe3 <exitwait+0x3c>
+
+00001017 <mem>:
+
+void
+mem(void)
+{
+    1017:	55                   	push   %ebp
+    1018:	89 e5                	mov    %esp,%ebp
+    101a:	57                   	push   %edi
+    101b:	56                   	push   %esi
+    101c:	53                   	push   %ebx
+    101d:	83 ec 14             	sub    $0x14,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+    1020:	68 ae 45 00 00       	push   $0x45ae
+    1025:	6a 01                	push   $0x1
+    1027:	e8 a6 2d 00 00       	call   3dd2 <printf>
+  ppid = getpid();
+    102c:	e8 7c 2c 00 00       	call   3cad <getpid>
+    1031:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) == 0){
+    1033:	e8 ed 2b 00 00       	call   3c25 <fork>
+    1038:	83 c4 10             	add    $0x10,%esp
+    103b:	85 c0                	test   %eax,%eax
+    103d:	0f 85 82 00 00 00    	jne    10c5 <mem+0xae>
+    m1 = 0;
+    1043:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1048:	eb 04                	jmp    104e <mem+0x37>
+    while((m2 = malloc(10001)) != 0){
+      *(char**)m2 = m1;
+    104a:	89 18                	mov    %ebx,(%eax)
+      m1 = m2;
+    104c:	89 c3                	mov    %eax,%ebx
+    while((m2 = malloc(10001)) != 0){
+    104e:	83 ec 0c             	sub    $0xc,%esp
+    1051:	68 11 27 00 00       	push   $0x2711
+    1056:	e8 9d 2f 00 00       	call   3ff8 <malloc>
+    105b:	83 c4 10             	add    $0x10,%esp
+    105e:	85 c0                	test   %eax,%eax
+    1060:	75 e8                	jne    104a <mem+0x33>
+    1062:	eb 10                	jmp    1074 <mem+0x5d>
+    }
+    while(m1){
+      m2 = *(char**)m1;
+    1064:	8b 3b                	mov    (%ebx),%edi
+      free(m1);
+    1066:	83 ec 0c             	sub    $0xc,%esp
+    1069:	53                   	push   %ebx
+    106a:	e8 c9 2e 00 00       	call   3f38 <free>
+    106f:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+    1072:	89 fb                	mov    %edi,%ebx
+    while(m1){
+    1074:	85 db                	test   %ebx,%ebx
+    1076:	75 ec                	jne    1064 <mem+0x4d>
+    }
+    m1 = malloc(1024*20);
+    1078:	83 ec 0c             	sub    $0xc,%esp
+    107b:	68 00 50 00 00       	push   $0x5000
+    1080:	e8 73 2f 00 00       	call   3ff8 <malloc>
+    if(m1 == 0){
+    1085:	83 c4 10             	add    $0x10,%esp
+    1088:	85 c0                	test   %eax,%eax
+    108a:	74 1d                	je     10a9 <mem+0x92>
+      printf(1, "couldn't allocate mem?!!\n");
+      kill(ppid);
+      exit();
+    }
+    free(m1);
+    108c:	83 ec 0c             	sub    $0xc,%esp
+    108f:	50                   	push   %eax
+    1090:	e8 a3 2e 00 00       	call   3f38 <free>
+    printf(1, "mem ok\n");
+    1095:	83 c4 08             	add    $0x8,%esp
+    1098:	68 d2 45 00 00       	push   $0x45d2
+    109d:	6a 01                	push   $0x1
+    109f:	e8 2e 2d 00 00       	call   3dd2 <printf>
+    exit();
+    10a4:	e8 84 2b 00 00       	call   3c2d <exit>
+      printf(1, "couldn't allocate mem?!!\n");
+    10a9:	83 ec 08             	sub    $0x8,%esp
+    10ac:	68 b8 45 00 00       	push   $0x45b8
+    10b1:	6a 01                	push   $0x1
+    10b3:	e8 1a 2d 00 00       	call   3dd2 <printf>
+      kill(ppid);
+    10b8:	89 34 24             	mov    %esi,(%esp)
+    10bb:	e8 9d 2b 00 00       	call   3c5d <kill>
+      exit();
+    10c0:	e8 68 2b 00 00       	call   3c2d <exit>
+  } else {
+    wait();
+    10c5:	e8 6b 2b 00 00       	call   3c35 <wait>
+  }
+}
+    10ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10cd:	5b                   	pop    %ebx
+    10ce:	5e                   	pop    %esi
+    10cf:	5f                   	pop    %edi
+    10d0:	5d                   	pop    %ebp
+    10d1:	c3                   	ret
+
+000010d2 <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+    10d2:	55                   	push   %ebp
+    10d3:	89 e5                	mov    %esp,%ebp
+    10d5:	57                   	push   %edi
+    10d6:	56                   	push   %esi
+    10d7:	53                   	push   %ebx
+    10d8:	83 ec 24             	sub    $0x24,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+    10db:	68 da 45 00 00       	push   $0x45da
+    10e0:	6a 01                	push   $0x1
+    10e2:	e8 eb 2c 00 00       	call   3dd2 <printf>
+
+  unlink("sharedfd");
+    10e7:	c7 04 24 e9 45 00 00 	movl   $0x45e9,(%esp)
+    10ee:	e8 8a 2b 00 00       	call   3c7d <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    10f3:	83 c4 08             	add    $0x8,%esp
+    10f6:	68 02 02 00 00       	push   $0x202
+    10fb:	68 e9 45 00 00       	push   $0x45e9
+    1100:	e8 68 2b 00 00       	call   3c6d <open>
+  if(fd < 0){
+    1105:	83 c4 10             	add    $0x10,%esp
+    1108:	85 c0                	test   %eax,%eax
+    110a:	78 4d                	js     1159 <sharedfd+0x87>
+    110c:	89 c6                	mov    %eax,%esi
+    printf(1, "fstests: cannot open sharedfd for writing");
+    return;
+  }
+  pid = fork();
+    110e:	e8 12 2b 00 00       	call   3c25 <fork>
+    1113:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1115:	85 c0                	test   %eax,%eax
+    1117:	75 57                	jne    1170 <sharedfd+0x9e>
+    1119:	b8 63 00 00 00       	mov    $0x63,%eax
+    111e:	83 ec 04             	sub    $0x4,%esp
+    1121:	6a 0a                	push   $0xa
+    1123:	50                   	push   %eax
+    1124:	8d 45 de             	lea    -0x22(%ebp),%eax
+    1127:	50                   	push   %eax
+    1128:	e8 00 29 00 00       	call   3a2d <memset>
+  for(i = 0; i < 1000; i++){
+    112d:	83 c4 10             	add    $0x10,%esp
+    1130:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1135:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+    113b:	7f 4c                	jg     1189 <sharedfd+0xb7>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    113d:	83 ec 04             	sub    $0x4,%esp
+    1140:	6a 0a                	push   $0xa
+    1142:	8d 45 de             	lea    -0x22(%ebp),%eax
+    1145:	50                   	push   %eax
+    1146:	56                   	push   %esi
+    1147:	e8 01 2b 00 00       	call   3c4d <write>
+    114c:	83 c4 10             	add    $0x10,%esp
+    114f:	83 f8 0a             	cmp    $0xa,%eax
+    1152:	75 23                	jne    1177 <sharedfd+0xa5>
+  for(i = 0; i < 1000; i++){
+    1154:	83 c3 01             	add    $0x1,%ebx
+    1157:	eb dc                	jmp    1135 <sharedfd+0x63>
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1159:	83 ec 08             	sub    $0x8,%esp
+    115c:	68 ac 52 00 00       	push   $0x52ac
+    1161:	6a 01                	push   $0x1
+    1163:	e8 6a 2c 00 00       	call   3dd2 <printf>
+    return;
+    1168:	83 c4 10             	add    $0x10,%esp
+    116b:	e9 e4 00 00 00       	jmp    1254 <sharedfd+0x182>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1170:	b8 70 00 00 00       	mov    $0x70,%eax
+    1175:	eb a7                	jmp    111e <sharedfd+0x4c>
+      printf(1, "fstests: write sharedfd failed\n");
+    1177:	83 ec 08             	sub    $0x8,%esp
+    117a:	68 d8 52 00 00       	push   $0x52d8
+    117f:	6a 01                	push   $0x1
+    1181:	e8 4c 2c 00 00       	call   3dd2 <printf>
+      break;
+    1186:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  if(pid == 0)
+    1189:	85 ff                	test   %edi,%edi
+    118b:	74 4d                	je     11da <sharedfd+0x108>
+    exit();
+  else
+    wait();
+    118d:	e8 a3 2a 00 00       	call   3c35 <wait>
+  close(fd);
+    1192:	83 ec 0c             	sub    $0xc,%esp
+    1195:	56                   	push   %esi
+    1196:	e8 ba 2a 00 00       	call   3c55 <close>
+  fd = open("sharedfd", 0);
+    119b:	83 c4 08             	add    $0x8,%esp
+    119e:	6a 00                	push   $0x0
+    11a0:	68 e9 45 00 00       	push   $0x45e9
+    11a5:	e8 c3 2a 00 00       	call   3c6d <open>
+    11aa:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    11ac:	83 c4 10             	add    $0x10,%esp
+    11af:	85 c0                	test   %eax,%eax
+    11b1:	78 2c                	js     11df <sharedfd+0x10d>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    return;
+  }
+  nc = np = 0;
+    11b3:	be 00 00 00 00       	mov    $0x0,%esi
+    11b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    11bd:	83 ec 04             	sub    $0x4,%esp
+    11c0:	6a 0a                	push   $0xa
+    11c2:	8d 45 de             	lea    -0x22(%ebp),%eax
+    11c5:	50                   	push   %eax
+    11c6:	57                   	push   %edi
+    11c7:	e8 79 2a 00 00       	call   3c45 <read>
+    11cc:	83 c4 10             	add    $0x10,%esp
+    11cf:	85 c0                	test   %eax,%eax
+    11d1:	7e 41                	jle    1214 <sharedfd+0x142>
+    for(i = 0; i < sizeof(buf); i++){
+    11d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    11d8:	eb 21                	jmp    11fb <sharedfd+0x129>
+    exit();
+    11da:	e8 4e 2a 00 00       	call   3c2d <exit>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    11df:	83 ec 08             	sub    $0x8,%esp
+    11e2:	68 f8 52 00 00       	push   $0x52f8
+    11e7:	6a 01                	push   $0x1
+    11e9:	e8 e4 2b 00 00       	call   3dd2 <printf>
+    return;
+    11ee:	83 c4 10             	add    $0x10,%esp
+    11f1:	eb 61                	jmp    1254 <sharedfd+0x182>
+      if(buf[i] == 'c')
+        nc++;
+      if(buf[i] == 'p')
+    11f3:	80 fa 70             	cmp    $0x70,%dl
+    11f6:	74 17                	je     120f <sharedfd+0x13d>
+    for(i = 0; i < sizeof(buf); i++){
+    11f8:	83 c0 01             	add    $0x1,%eax
+    11fb:	83 f8 09             	cmp    $0x9,%eax
+    11fe:	77 bd                	ja     11bd <sharedfd+0xeb>
+      if(buf[i] == 'c')
+    1200:	0f b6 54 05 de       	movzbl -0x22(%ebp,%eax,1),%edx
+    1205:	80 fa 63             	cmp    $0x63,%dl
+    1208:	75 e9                	jne    11f3 <sharedfd+0x121>
+        nc++;
+    120a:	83 c3 01             	add    $0x1,%ebx
+    120d:	eb e4                	jmp    11f3 <sharedfd+0x121>
+        np++;
+    120f:	83 c6 01             	add    $0x1,%esi
+    1212:	eb e4                	jmp    11f8 <sharedfd+0x126>
+    }
+  }
+  close(fd);
+    1214:	83 ec 0c             	sub    $0xc,%esp
+    1217:	57                   	push   %edi
+    1218:	e8 38 2a 00 00       	call   3c55 <close>
+  unlink("sharedfd");
+    121d:	c7 04 24 e9 45 00 00 	movl   $0x45e9,(%esp)
+    1224:	e8 54 2a 00 00       	call   3c7d <unlink>
+  if(nc == 10000 && np == 10000){
+    1229:	83 c4 10             	add    $0x10,%esp
+    122c:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    1232:	0f 94 c2             	sete   %dl
+    1235:	81 fe 10 27 00 00    	cmp    $0x2710,%esi
+    123b:	0f 94 c0             	sete   %al
+    123e:	84 c2                	test   %al,%dl
+    1240:	74 1a                	je     125c <sharedfd+0x18a>
+    printf(1, "sharedfd ok\n");
+    1242:	83 ec 08             	sub    $0x8,%esp
+    1245:	68 f2 45 00 00       	push   $0x45f2
+    124a:	6a 01                	push   $0x1
+    124c:	e8 81 2b 00 00       	call   3dd2 <printf>
+    1251:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    exit();
+  }
+}
+    1254:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1257:	5b                   	pop    %ebx
+    1258:	5e                   	pop    %esi
+    1259:	5f                   	pop    %edi
+    125a:	5d                   	pop    %ebp
+    125b:	c3                   	ret
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    125c:	56                   	push   %esi
+    125d:	53                   	push   %ebx
+    125e:	68 ff 45 00 00       	push   $0x45ff
+    1263:	6a 01                	push   $0x1
+    1265:	e8 68 2b 00 00       	call   3dd2 <printf>
+    exit();
+    126a:	e8 be 29 00 00       	call   3c2d <exit>
+
+0000126f <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+    126f:	55                   	push   %ebp
+    1270:	89 e5                	mov    %esp,%ebp
+    1272:	57                   	push   %edi
+    1273:	56                   	push   %esi
+    1274:	53                   	push   %ebx
+    1275:	83 ec 34             	sub    $0x34,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    1278:	c7 45 d8 14 46 00 00 	movl   $0x4614,-0x28(%ebp)
+    127f:	c7 45 dc 5d 47 00 00 	movl   $0x475d,-0x24(%ebp)
+    1286:	c7 45 e0 61 47 00 00 	movl   $0x4761,-0x20(%ebp)
+    128d:	c7 45 e4 17 46 00 00 	movl   $0x4617,-0x1c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+    1294:	68 1a 46 00 00       	push   $0x461a
+    1299:	6a 01                	push   $0x1
+    129b:	e8 32 2b 00 00       	call   3dd2 <printf>
+
+  for(pi = 0; pi < 4; pi++){
+    12a0:	83 c4 10             	add    $0x10,%esp
+    12a3:	be 00 00 00 00       	mov    $0x0,%esi
+    12a8:	eb 45                	jmp    12ef <fourfiles+0x80>
+    fname = names[pi];
+    unlink(fname);
+
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+    12aa:	83 ec 08             	sub    $0x8,%esp
+    12ad:	68 ef 50 00 00       	push   $0x50ef
+    12b2:	6a 01                	push   $0x1
+    12b4:	e8 19 2b 00 00       	call   3dd2 <printf>
+      exit();
+    12b9:	e8 6f 29 00 00       	call   3c2d <exit>
+    }
+
+    if(pid == 0){
+      fd = open(fname, O_CREATE | O_RDWR);
+      if(fd < 0){
+        printf(1, "create failed\n");
+    12be:	83 ec 08             	sub    $0x8,%esp
+    12c1:	68 c0 44 00 00       	push   $0x44c0
+    12c6:	6a 01                	push   $0x1
+    12c8:	e8 05 2b 00 00       	call   3dd2 <printf>
+        exit();
+    12cd:	e8 5b 29 00 00       	call   3c2d <exit>
+      }
+
+      memset(buf, '0'+pi, 512);
+      for(i = 0; i < 12; i++){
+        if((n = write(fd, buf, 500)) != 500){
+          printf(1, "write failed %d\n", n);
+    12d2:	83 ec 04             	sub    $0x4,%esp
+    12d5:	50                   	push   %eax
+    12d6:	68 2a 46 00 00       	push   $0x462a
+    12db:	6a 01                	push   $0x1
+    12dd:	e8 f0 2a 00 00       	call   3dd2 <printf>
+          exit();
+    12e2:	e8 46 29 00 00       	call   3c2d <exit>
+        }
+      }
+      exit();
+    12e7:	e8 41 29 00 00       	call   3c2d <exit>
+  for(pi = 0; pi < 4; pi++){
+    12ec:	83 c6 01             	add    $0x1,%esi
+    12ef:	83 fe 03             	cmp    $0x3,%esi
+    12f2:	7f 78                	jg     136c <fourfiles+0xfd>
+    fname = names[pi];
+    12f4:	8b 7c b5 d8          	mov    -0x28(%ebp,%esi,4),%edi
+    unlink(fname);
+    12f8:	83 ec 0c             	sub    $0xc,%esp
+    12fb:	57                   	push   %edi
+    12fc:	e8 7c 29 00 00       	call   3c7d <unlink>
+    pid = fork();
+    1301:	e8 1f 29 00 00       	call   3c25 <fork>
+    if(pid < 0){
+    1306:	83 c4 10             	add    $0x10,%esp
+    1309:	85 c0                	test   %eax,%eax
+    130b:	78 9d                	js     12aa <fourfiles+0x3b>
+    if(pid == 0){
+    130d:	75 dd                	jne    12ec <fourfiles+0x7d>
+      fd = open(fname, O_CREATE | O_RDWR);
+    130f:	89 c3                	mov    %eax,%ebx
+    1311:	83 ec 08             	sub    $0x8,%esp
+    1314:	68 02 02 00 00       	push   $0x202
+    1319:	57                   	push   %edi
+    131a:	e8 4e 29 00 00       	call   3c6d <open>
+    131f:	89 c7                	mov    %eax,%edi
+      if(fd < 0){
+    1321:	83 c4 10             	add    $0x10,%esp
+    1324:	85 c0                	test   %eax,%eax
+    1326:	78 96                	js     12be <fourfiles+0x4f>
+      memset(buf, '0'+pi, 512);
+    1328:	83 ec 04             	sub    $0x4,%esp
+    132b:	68 00 02 00 00       	push   $0x200
+    1330:	83 c6 30             	add    $0x30,%esi
+    1333:	56                   	push   %esi
+    1334:	68 80 8a 00 00       	push   $0x8a80
+    1339:	e8 ef 26 00 00       	call   3a2d <memset>
+      for(i = 0; i < 12; i++){
+    133e:	83 c4 10             	add    $0x10,%esp
+    1341:	83 fb 0b             	cmp    $0xb,%ebx
+    1344:	7f a1                	jg     12e7 <fourfiles+0x78>
+        if((n = write(fd, buf, 500)) != 500){
+    1346:	83 ec 04             	sub    $0x4,%esp
+    1349:	68 f4 01 00 00       	push   $0x1f4
+    134e:	68 80 8a 00 00       	push   $0x8a80
+    1353:	57                   	push   %edi
+    1354:	e8 f4 28 00 00       	call   3c4d <write>
+    1359:	83 c4 10             	add    $0x10,%esp
+    135c:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    1361:	0f 85 6b ff ff ff    	jne    12d2 <fourfiles+0x63>
+      for(i = 0; i < 12; i++){
+    1367:	83 c3 01             	add    $0x1,%ebx
+    136a:	eb d5                	jmp    1341 <fourfiles+0xd2>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    136c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1371:	eb 08                	jmp    137b <fourfiles+0x10c>
+    wait();
+    1373:	e8 bd 28 00 00       	call   3c35 <wait>
+  for(pi = 0; pi < 4; pi++){
+    1378:	83 c3 01             	add    $0x1,%ebx
+    137b:	83 fb 03             	cmp    $0x3,%ebx
+    137e:	7e f3                	jle    1373 <fourfiles+0x104>
+  }
+
+  for(i = 0; i < 2; i++){
+    1380:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1385:	eb 78                	jmp    13ff <fourfiles+0x190>
+    fd = open(fname, 0);
+    total = 0;
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+      for(j = 0; j < n; j++){
+        if(buf[j] != '0'+i){
+          printf(1, "wrong char\n");
+    1387:	83 ec 08             	sub    $0x8,%esp
+    138a:	68 3b 46 00 00       	push   $0x463b
+    138f:	6a 01                	push   $0x1
+    1391:	e8 3c 2a 00 00       	call   3dd2 <printf>
+          exit();
+    1396:	e8 92 28 00 00       	call   3c2d <exit>
+        }
+      }
+      total += n;
+    139b:	01 fe                	add    %edi,%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    139d:	83 ec 04             	sub    $0x4,%esp
+    13a0:	68 00 20 00 00       	push   $0x2000
+    13a5:	68 80 8a 00 00       	push   $0x8a80
+    13aa:	ff 75 d4             	push   -0x2c(%ebp)
+    13ad:	e8 93 28 00 00       	call   3c45 <read>
+    13b2:	89 c7                	mov    %eax,%edi
+    13b4:	83 c4 10             	add    $0x10,%esp
+    13b7:	85 c0                	test   %eax,%eax
+    13b9:	7e 1c                	jle    13d7 <fourfiles+0x168>
+      for(j = 0; j < n; j++){
+    13bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    13c0:	39 f8                	cmp    %edi,%eax
+    13c2:	7d d7                	jge    139b <fourfiles+0x12c>
+        if(buf[j] != '0'+i){
+    13c4:	0f be 88 80 8a 00 00 	movsbl 0x8a80(%eax),%ecx
+    13cb:	8d 53 30             	lea    0x30(%ebx),%edx
+    13ce:	39 d1                	cmp    %edx,%ecx
+    13d0:	75 b5                	jne    1387 <fourfiles+0x118>
+      for(j = 0; j < n; j++){
+    13d2:	83 c0 01             	add    $0x1,%eax
+    13d5:	eb e9                	jmp    13c0 <fourfiles+0x151>
+    }
+    close(fd);
+    13d7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+    13da:	83 ec 0c             	sub    $0xc,%esp
+    13dd:	ff 75 d4             	push   -0x2c(%ebp)
+    13e0:	e8 70 28 00 00       	call   3c55 <close>
+    if(total != 12*500){
+    13e5:	83 c4 10             	add    $0x10,%esp
+    13e8:	81 fe 70 17 00 00    	cmp    $0x1770,%esi
+    13ee:	75 36                	jne    1426 <fourfiles+0x1b7>
+      printf(1, "wrong length %d\n", total);
+      exit();
+    }
+    unlink(fname);
+    13f0:	83 ec 0c             	sub    $0xc,%esp
+    13f3:	57                   	push   %edi
+    13f4:	e8 84 28 00 00       	call   3c7d <unlink>
+  for(i = 0; i < 2; i++){
+    13f9:	83 c3 01             	add    $0x1,%ebx
+    13fc:	83 c4 10             	add    $0x10,%esp
+    13ff:	83 fb 01             	cmp    $0x1,%ebx
+    1402:	7f 37                	jg     143b <fourfiles+0x1cc>
+    fname = names[i];
+    1404:	8b 7c 9d d8          	mov    -0x28(%ebp,%ebx,4),%edi
+    fd = open(fname, 0);
+    1408:	83 ec 08             	sub    $0x8,%esp
+    140b:	6a 00                	push   $0x0
+    140d:	57                   	push   %edi
+    140e:	e8 5a 28 00 00       	call   3c6d <open>
+    1413:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1416:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+    1419:	be 00 00 00 00       	mov    $0x0,%esi
+    141e:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1421:	e9 77 ff ff ff       	jmp    139d <fourfiles+0x12e>
+      printf(1, "wrong length %d\n", total);
+    1426:	83 ec 04             	sub    $0x4,%esp
+    1429:	56                   	push   %esi
+    142a:	68 47 46 00 00       	push   $0x4647
+    142f:	6a 01                	push   $0x1
+    1431:	e8 9c 29 00 00       	call   3dd2 <printf>
+      exit();
+    1436:	e8 f2 27 00 00       	call   3c2d <exit>
+  }
+
+  printf(1, "fourfiles ok\n");
+    143b:	83 ec 08             	sub    $0x8,%esp
+    143e:	68 58 46 00 00       	push   $0x4658
+    1443:	6a 01                	push   $0x1
+    1445:	e8 88 29 00 00       	call   3dd2 <printf>
+}
+    144a:	83 c4 10             	add    $0x10,%esp
+    144d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1450:	5b                   	pop    %ebx
+    1451:	5e                   	pop    %esi
+    1452:	5f                   	pop    %edi
+    1453:	5d                   	pop    %ebp
+    1454:	c3                   	ret
+
+00001455 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    1455:	55                   	push   %ebp
+    1456:	89 e5                	mov    %esp,%ebp
+    1458:	56                   	push   %esi
+    1459:	53                   	push   %ebx
+    145a:	83 ec 28             	sub    $0x28,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    145d:	68 66 46 00 00       	push   $0x4666
+    1462:	6a 01                	push   $0x1
+    1464:	e8 69 29 00 00       	call   3dd2 <printf>
+
+  for(pi = 0; pi < 4; pi++){
+    1469:	83 c4 10             	add    $0x10,%esp
+    146c:	be 00 00 00 00       	mov    $0x0,%esi
+    1471:	83 fe 03             	cmp    $0x3,%esi
+    1474:	0f 8f bc 00 00 00    	jg     1536 <createdelete+0xe1>
+    pid = fork();
+    147a:	e8 a6 27 00 00       	call   3c25 <fork>
+    147f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1481:	85 c0                	test   %eax,%eax
+    1483:	78 07                	js     148c <createdelete+0x37>
+      printf(1, "fork failed\n");
+      exit();
+    }
+
+    if(pid == 0){
+    1485:	74 19                	je     14a0 <createdelete+0x4b>
+  for(pi = 0; pi < 4; pi++){
+    1487:	83 c6 01             	add    $0x1,%esi
+    148a:	eb e5                	jmp    1471 <createdelete+0x1c>
+      printf(1, "fork failed\n");
+    148c:	83 ec 08             	sub    $0x8,%esp
+    148f:	68 ef 50 00 00       	push   $0x50ef
+    1494:	6a 01                	push   $0x1
+    1496:	e8 37 29 00 00       	call   3dd2 <printf>
+      exit();
+    149b:	e8 8d 27 00 00       	call   3c2d <exit>
+      name[0] = 'p' + pi;
+    14a0:	8d 46 70             	lea    0x70(%esi),%eax
+    14a3:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[2] = '\0';
+    14a6:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+      for(i = 0; i < N; i++){
+    14aa:	eb 17                	jmp    14c3 <createdelete+0x6e>
+        name[1] = '0' + i;
+        fd = open(name, O_CREATE | O_RDWR);
+        if(fd < 0){
+          printf(1, "create failed\n");
+    14ac:	83 ec 08             	sub    $0x8,%esp
+    14af:	68 c0 44 00 00       	push   $0x44c0
+    14b4:	6a 01                	push   $0x1
+    14b6:	e8 17 29 00 00       	call   3dd2 <printf>
+          exit();
+    14bb:	e8 6d 27 00 00       	call   3c2d <exit>
+      for(i = 0; i < N; i++){
+    14c0:	83 c3 01             	add    $0x1,%ebx
+    14c3:	83 fb 13             	cmp    $0x13,%ebx
+    14c6:	7f 69                	jg     1531 <createdelete+0xdc>
+        name[1] = '0' + i;
+    14c8:	8d 43 30             	lea    0x30(%ebx),%eax
+    14cb:	88 45 d9             	mov    %al,-0x27(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    14ce:	83 ec 08             	sub    $0x8,%esp
+    14d1:	68 02 02 00 00       	push   $0x202
+    14d6:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    14d9:	50                   	push   %eax
+    14da:	e8 8e 27 00 00       	call   3c6d <open>
+        if(fd < 0){
+    14df:	83 c4 10             	add    $0x10,%esp
+    14e2:	85 c0                	test   %eax,%eax
+    14e4:	78 c6                	js     14ac <createdelete+0x57>
+        }
+        close(fd);
+    14e6:	83 ec 0c             	sub    $0xc,%esp
+    14e9:	50                   	push   %eax
+    14ea:	e8 66 27 00 00       	call   3c55 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    14ef:	83 c4 10             	add    $0x10,%esp
+    14f2:	85 db                	test   %ebx,%ebx
+    14f4:	7e ca                	jle    14c0 <createdelete+0x6b>
+    14f6:	f6 c3 01             	test   $0x1,%bl
+    14f9:	75 c5                	jne    14c0 <createdelete+0x6b>
+          name[1] = '0' + (i / 2);
+    14fb:	89 d8                	mov    %ebx,%eax
+    14fd:	c1 e8 1f             	shr    $0x1f,%eax
+    1500:	01 d8                	add    %ebx,%eax
+    1502:	d1 f8                	sar    %eax
+    1504:	83 c0 30             	add    $0x30,%eax
+    1507:	88 45 d9             	mov    %al,-0x27(%ebp)
+          if(unlink(name) < 0){
+    150a:	83 ec 0c             	sub    $0xc,%esp
+    150d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1510:	50                   	push   %eax
+    1511:	e8 67 27 00 00       	call   3c7d <unlink>
+    1516:	83 c4 10             	add    $0x10,%esp
+    1519:	85 c0                	test   %eax,%eax
+    151b:	79 a3                	jns    14c0 <createdelete+0x6b>
+            printf(1, "unlink failed\n");
+    151d:	83 ec 08             	sub    $0x8,%esp
+    1520:	68 84 41 00 00       	push   $0x4184
+    1525:	6a 01                	push   $0x1
+    1527:	e8 a6 28 00 00       	call   3dd2 <printf>
+            exit();
+    152c:	e8 fc 26 00 00       	call   3c2d <exit>
+          }
+        }
+      }
+      exit();
+    1531:	e8 f7 26 00 00       	call   3c2d <exit>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    1536:	bb 00 00 00 00       	mov    $0x0,%ebx
+    153b:	eb 08                	jmp    1545 <createdelete+0xf0>
+    wait();
+    153d:	e8 f3 26 00 00       	call   3c35 <wait>
+  for(pi = 0; pi < 4; pi++){
+    1542:	83 c3 01             	add    $0x1,%ebx
+    1545:	83 fb 03             	cmp    $0x3,%ebx
+    1548:	7e f3                	jle    153d <createdelete+0xe8>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    154a:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+    154e:	c6 45 d9 00          	movb   $0x0,-0x27(%ebp)
+    1552:	c6 45 d8 00          	movb   $0x0,-0x28(%ebp)
+  for(i = 0; i < N; i++){
+    1556:	bb 00 00 00 00       	mov    $0x0,%ebx
+    155b:	e9 89 00 00 00       	jmp    15e9 <createdelete+0x194>
+      name[1] = '0' + i;
+      fd = open(name, 0);
+      if((i == 0 || i >= N/2) && fd < 0){
+        printf(1, "oops createdelete %s didn't exist\n", name);
+        exit();
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1560:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1563:	83 fa 08             	cmp    $0x8,%edx
+    1566:	76 54                	jbe    15bc <createdelete+0x167>
+        printf(1, "oops createdelete %s did exist\n", name);
+        exit();
+      }
+      if(fd >= 0)
+    1568:	85 c0                	test   %eax,%eax
+    156a:	79 6c                	jns    15d8 <createdelete+0x183>
+    for(pi = 0; pi < 4; pi++){
+    156c:	83 c6 01             	add    $0x1,%esi
+    156f:	83 fe 03             	cmp    $0x3,%esi
+    1572:	7f 72                	jg     15e6 <createdelete+0x191>
+      name[0] = 'p' + pi;
+    1574:	8d 46 70             	lea    0x70(%esi),%eax
+    1577:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+    157a:	8d 43 30             	lea    0x30(%ebx),%eax
+    157d:	88 45 d9             	mov    %al,-0x27(%ebp)
+      fd = open(name, 0);
+    1580:	83 ec 08             	sub    $0x8,%esp
+    1583:	6a 00                	push   $0x0
+    1585:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1588:	50                   	push   %eax
+    1589:	e8 df 26 00 00       	call   3c6d <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    158e:	83 c4 10             	add    $0x10,%esp
+    1591:	85 db                	test   %ebx,%ebx
+    1593:	0f 94 c2             	sete   %dl
+    1596:	83 fb 09             	cmp    $0x9,%ebx
+    1599:	0f 9f c1             	setg   %cl
+    159c:	08 ca                	or     %cl,%dl
+    159e:	74 c0                	je     1560 <createdelete+0x10b>
+    15a0:	85 c0                	test   %eax,%eax
+    15a2:	79 bc                	jns    1560 <createdelete+0x10b>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    15a4:	83 ec 04             	sub    $0x4,%esp
+    15a7:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    15aa:	50                   	push   %eax
+    15ab:	68 24 53 00 00       	push   $0x5324
+    15b0:	6a 01                	push   $0x1
+    15b2:	e8 1b 28 00 00       	call   3dd2 <printf>
+        exit();
+    15b7:	e8 71 26 00 00       	call   3c2d <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    15bc:	85 c0                	test   %eax,%eax
+    15be:	78 ac                	js     156c <createdelete+0x117>
+        printf(1, "oops createdelete %s did exist\n", name);
+    15c0:	83 ec 04             	sub    $0x4,%esp
+    15c3:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    15c6:	50                   	push   %eax
+    15c7:	68 48 53 00 00       	push   $0x5348
+    15cc:	6a 01                	push   $0x1
+    15ce:	e8 ff 27 00 00       	call   3dd2 <printf>
+        exit();
+    15d3:	e8 55 26 00 00       	call   3c2d <exit>
+        close(fd);
+    15d8:	83 ec 0c             	sub    $0xc,%esp
+    15db:	50                   	push   %eax
+    15dc:	e8 74 26 00 00       	call   3c55 <close>
+    15e1:	83 c4 10             	add    $0x10,%esp
+    15e4:	eb 86                	jmp    156c <createdelete+0x117>
+  for(i = 0; i < N; i++){
+    15e6:	83 c3 01             	add    $0x1,%ebx
+    15e9:	83 fb 13             	cmp    $0x13,%ebx
+    15ec:	7f 0a                	jg     15f8 <createdelete+0x1a3>
+    for(pi = 0; pi < 4; pi++){
+    15ee:	be 00 00 00 00       	mov    $0x0,%esi
+    15f3:	e9 77 ff ff ff       	jmp    156f <createdelete+0x11a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    15f8:	be 00 00 00 00       	mov    $0x0,%esi
+    15fd:	eb 26                	jmp    1625 <createdelete+0x1d0>
+    for(pi = 0; pi < 4; pi++){
+      name[0] = 'p' + i;
+    15ff:	8d 46 70             	lea    0x70(%esi),%eax
+    1602:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+    1605:	8d 46 30             	lea    0x30(%esi),%eax
+    1608:	88 45 d9             	mov    %al,-0x27(%ebp)
+      unlink(name);
+    160b:	83 ec 0c             	sub    $0xc,%esp
+    160e:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1611:	50                   	push   %eax
+    1612:	e8 66 26 00 00       	call   3c7d <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1617:	83 c3 01             	add    $0x1,%ebx
+    161a:	83 c4 10             	add    $0x10,%esp
+    161d:	83 fb 03             	cmp    $0x3,%ebx
+    1620:	7e dd                	jle    15ff <createdelete+0x1aa>
+  for(i = 0; i < N; i++){
+    1622:	83 c6 01             	add    $0x1,%esi
+    1625:	83 fe 13             	cmp    $0x13,%esi
+    1628:	7f 07                	jg     1631 <createdelete+0x1dc>
+    for(pi = 0; pi < 4; pi++){
+    162a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    162f:	eb ec                	jmp    161d <createdelete+0x1c8>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    1631:	83 ec 08             	sub    $0x8,%esp
+    1634:	68 79 46 00 00       	push   $0x4679
+    1639:	6a 01                	push   $0x1
+    163b:	e8 92 27 00 00       	call   3dd2 <printf>
+}
+    1640:	83 c4 10             	add    $0x10,%esp
+    1643:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1646:	5b                   	pop    %ebx
+    1647:	5e                   	pop    %esi
+    1648:	5d                   	pop    %ebp
+    1649:	c3                   	ret
+
+0000164a <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    164a:	55                   	push   %ebp
+    164b:	89 e5                	mov    %esp,%ebp
+    164d:	56                   	push   %esi
+    164e:	53                   	push   %ebx
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    164f:	83 ec 08             	sub    $0x8,%esp
+    1652:	68 8a 46 00 00       	push   $0x468a
+    1657:	6a 01                	push   $0x1
+    1659:	e8 74 27 00 00       	call   3dd2 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    165e:	83 c4 08             	add    $0x8,%esp
+    1661:	68 02 02 00 00       	push   $0x202
+    1666:	68 9b 46 00 00       	push   $0x469b
+    166b:	e8 fd 25 00 00       	call   3c6d <open>
+  if(fd < 0){
+    1670:	83 c4 10             	add    $0x10,%esp
+    1673:	85 c0                	test   %eax,%eax
+    1675:	0f 88 f0 00 00 00    	js     176b <unlinkread+0x121>
+    167b:	89 c3                	mov    %eax,%ebx
+    printf(1, "create unlinkread failed\n");
+    exit();
+  }
+  write(fd, "hello", 5);
+    167d:	83 ec 04             	sub    $0x4,%esp
+    1680:	6a 05                	push   $0x5
+    1682:	68 c0 46 00 00       	push   $0x46c0
+    1687:	50                   	push   %eax
+    1688:	e8 c0 25 00 00       	call   3c4d <write>
+  close(fd);
+    168d:	89 1c 24             	mov    %ebx,(%esp)
+    1690:	e8 c0 25 00 00       	call   3c55 <close>
+
+  fd = open("unlinkread", O_RDWR);
+    1695:	83 c4 08             	add    $0x8,%esp
+    1698:	6a 02                	push   $0x2
+    169a:	68 9b 46 00 00       	push   $0x469b
+    169f:	e8 c9 25 00 00       	call   3c6d <open>
+    16a4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    16a6:	83 c4 10             	add    $0x10,%esp
+    16a9:	85 c0                	test   %eax,%eax
+    16ab:	0f 88 ce 00 00 00    	js     177f <unlinkread+0x135>
+    printf(1, "open unlinkread failed\n");
+    exit();
+  }
+  if(unlink("unlinkread") != 0){
+    16b1:	83 ec 0c             	sub    $0xc,%esp
+    16b4:	68 9b 46 00 00       	push   $0x469b
+    16b9:	e8 bf 25 00 00       	call   3c7d <unlink>
+    16be:	83 c4 10             	add    $0x10,%esp
+    16c1:	85 c0                	test   %eax,%eax
+    16c3:	0f 85 ca 00 00 00    	jne    1793 <unlinkread+0x149>
+    printf(1, "unlink unlinkread failed\n");
+    exit();
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    16c9:	83 ec 08             	sub    $0x8,%esp
+    16cc:	68 02 02 00 00       	push   $0x202
+    16d1:	68 9b 46 00 00       	push   $0x469b
+    16d6:	e8 92 25 00 00       	call   3c6d <open>
+    16db:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    16dd:	83 c4 0c             	add    $0xc,%esp
+    16e0:	6a 03                	push   $0x3
+    16e2:	68 f8 46 00 00       	push   $0x46f8
+    16e7:	50                   	push   %eax
+    16e8:	e8 60 25 00 00       	call   3c4d <write>
+  close(fd1);
+    16ed:	89 34 24             	mov    %esi,(%esp)
+    16f0:	e8 60 25 00 00       	call   3c55 <close>
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    16f5:	83 c4 0c             	add    $0xc,%esp
+    16f8:	68 00 20 00 00       	push   $0x2000
+    16fd:	68 80 8a 00 00       	push   $0x8a80
+    1702:	53                   	push   %ebx
+    1703:	e8 3d 25 00 00       	call   3c45 <read>
+    1708:	83 c4 10             	add    $0x10,%esp
+    170b:	83 f8 05             	cmp    $0x5,%eax
+    170e:	0f 85 93 00 00 00    	jne    17a7 <unlinkread+0x15d>
+    printf(1, "unlinkread read failed");
+    exit();
+  }
+  if(buf[0] != 'h'){
+    1714:	80 3d 80 8a 00 00 68 	cmpb   $0x68,0x8a80
+    171b:	0f 85 9a 00 00 00    	jne    17bb <unlinkread+0x171>
+    printf(1, "unlinkread wrong data\n");
+    exit();
+  }
+  if(write(fd, buf, 10) != 10){
+    1721:	83 ec 04             	sub    $0x4,%esp
+    1724:	6a 0a                	push   $0xa
+    1726:	68 80 8a 00 00       	push   $0x8a80
+    172b:	53                   	push   %ebx
+    172c:	e8 1c 25 00 00       	call   3c4d <write>
+    1731:	83 c4 10             	add    $0x10,%esp
+    1734:	83 f8 0a             	cmp    $0xa,%eax
+    1737:	0f 85 92 00 00 00    	jne    17cf <unlinkread+0x185>
+    printf(1, "unlinkread write failed\n");
+    exit();
+  }
+  close(fd);
+    173d:	83 ec 0c             	sub    $0xc,%esp
+    1740:	53                   	push   %ebx
+    1741:	e8 0f 25 00 00       	call   3c55 <close>
+  unlink("unlinkread");
+    1746:	c7 04 24 9b 46 00 00 	movl   $0x469b,(%esp)
+    174d:	e8 2b 25 00 00       	call   3c7d <unlink>
+  printf(1, "unlinkread ok\n");
+    1752:	83 c4 08             	add    $0x8,%esp
+    1755:	68 43 47 00 00       	push   $0x4743
+    175a:	6a 01                	push   $0x1
+    175c:	e8 71 26 00 00       	call   3dd2 <printf>
+}
+    1761:	83 c4 10             	add    $0x10,%esp
+    1764:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1767:	5b                   	pop    %ebx
+    1768:	5e                   	pop    %esi
+    1769:	5d                   	pop    %ebp
+    176a:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    176b:	83 ec 08             	sub    $0x8,%esp
+    176e:	68 a6 46 00 00       	push   $0x46a6
+    1773:	6a 01                	push   $0x1
+    1775:	e8 58 26 00 00       	call   3dd2 <printf>
+    exit();
+    177a:	e8 ae 24 00 00       	call   3c2d <exit>
+    printf(1, "open unlinkread failed\n");
+    177f:	83 ec 08             	sub    $0x8,%esp
+    1782:	68 c6 46 00 00       	push   $0x46c6
+    1787:	6a 01                	push   $0x1
+    1789:	e8 44 26 00 00       	call   3dd2 <printf>
+    exit();
+    178e:	e8 9a 24 00 00       	call   3c2d <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1793:	83 ec 08             	sub    $0x8,%esp
+    1796:	68 de 46 00 00       	push   $0x46de
+    179b:	6a 01                	push   $0x1
+    179d:	e8 30 26 00 00       	call   3dd2 <printf>
+    exit();
+    17a2:	e8 86 24 00 00       	call   3c2d <exit>
+    printf(1, "unlinkread read failed");
+    17a7:	83 ec 08             	sub    $0x8,%esp
+    17aa:	68 fc 46 00 00       	push   $0x46fc
+    17af:	6a 01                	push   $0x1
+    17b1:	e8 1c 26 00 00       	call   3dd2 <printf>
+    exit();
+    17b6:	e8 72 24 00 00       	call   3c2d <exit>
+    printf(1, "unlinkread wrong data\n");
+    17bb:	83 ec 08             	sub    $0x8,%esp
+    17be:	68 13 47 00 00       	push   $0x4713
+    17c3:	6a 01                	push   $0x1
+    17c5:	e8 08 26 00 00       	call   3dd2 <printf>
+    exit();
+    17ca:	e8 5e 24 00 00       	call   3c2d <exit>
+    printf(1, "unlinkread write failed\n");
+    17cf:	83 ec 08             	sub    $0x8,%esp
+    17d2:	68 2a 47 00 00       	push   $0x472a
+    17d7:	6a 01                	push   $0x1
+    17d9:	e8 f4 25 00 00       	call   3dd2 <printf>
+    exit();
+    17de:	e8 4a 24 00 00       	call   3c2d <exit>
+
+000017e3 <linktest>:
+
+void
+linktest(void)
+{
+    17e3:	55                   	push   %ebp
+    17e4:	89 e5                	mov    %esp,%ebp
+    17e6:	53                   	push   %ebx
+    17e7:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    17ea:	68 52 47 00 00       	push   $0x4752
+    17ef:	6a 01                	push   $0x1
+    17f1:	e8 dc 25 00 00       	call   3dd2 <printf>
+
+  unlink("lf1");
+    17f6:	c7 04 24 5c 47 00 00 	movl   $0x475c,(%esp)
+    17fd:	e8 7b 24 00 00       	call   3c7d <unlink>
+  unlink("lf2");
+    1802:	c7 04 24 60 47 00 00 	movl   $0x4760,(%esp)
+    1809:	e8 6f 24 00 00       	call   3c7d <unlink>
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    180e:	83 c4 08             	add    $0x8,%esp
+    1811:	68 02 02 00 00       	push   $0x202
+    1816:	68 5c 47 00 00       	push   $0x475c
+    181b:	e8 4d 24 00 00       	call   3c6d <open>
+  if(fd < 0){
+    1820:	83 c4 10             	add    $0x10,%esp
+    1823:	85 c0                	test   %eax,%eax
+    1825:	0f 88 2a 01 00 00    	js     1955 <linktest+0x172>
+    182b:	89 c3                	mov    %eax,%ebx
+    printf(1, "create lf1 failed\n");
+    exit();
+  }
+  if(write(fd, "hello", 5) != 5){
+    182d:	83 ec 04             	sub    $0x4,%esp
+    1830:	6a 05                	push   $0x5
+    1832:	68 c0 46 00 00       	push   $0x46c0
+    1837:	50                   	push   %eax
+    1838:	e8 10 24 00 00       	call   3c4d <write>
+    183d:	83 c4 10             	add    $0x10,%esp
+    1840:	83 f8 05             	cmp    $0x5,%eax
+    1843:	0f 85 20 01 00 00    	jne    1969 <linktest+0x186>
+    printf(1, "write lf1 failed\n");
+    exit();
+  }
+  close(fd);
+    1849:	83 ec 0c             	sub    $0xc,%esp
+    184c:	53                   	push   %ebx
+    184d:	e8 03 24 00 00       	call   3c55 <close>
+
+  if(link("lf1", "lf2") < 0){
+    1852:	83 c4 08             	add    $0x8,%esp
+    1855:	68 60 47 00 00       	push   $0x4760
+    185a:	68 5c 47 00 00       	push   $0x475c
+    185f:	e8 29 24 00 00       	call   3c8d <link>
+    1864:	83 c4 10             	add    $0x10,%esp
+    1867:	85 c0                	test   %eax,%eax
+    1869:	0f 88 0e 01 00 00    	js     197d <linktest+0x19a>
+    printf(1, "link lf1 lf2 failed\n");
+    exit();
+  }
+  unlink("lf1");
+    186f:	83 ec 0c             	sub    $0xc,%esp
+    1872:	68 5c 47 00 00       	push   $0x475c
+    1877:	e8 01 24 00 00       	call   3c7d <unlink>
+
+  if(open("lf1", 0) >= 0){
+    187c:	83 c4 08             	add    $0x8,%esp
+    187f:	6a 00                	push   $0x0
+    1881:	68 5c 47 00 00       	push   $0x475c
+    1886:	e8 e2 23 00 00       	call   3c6d <open>
+    188b:	83 c4 10             	add    $0x10,%esp
+    188e:	85 c0                	test   %eax,%eax
+    1890:	0f 89 fb 00 00 00    	jns    1991 <linktest+0x1ae>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    exit();
+  }
+
+  fd = open("lf2", 0);
+    1896:	83 ec 08             	sub    $0x8,%esp
+    1899:	6a 00                	push   $0x0
+    189b:	68 60 47 00 00       	push   $0x4760
+    18a0:	e8 c8 23 00 00       	call   3c6d <open>
+    18a5:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    18a7:	83 c4 10             	add    $0x10,%esp
+    18aa:	85 c0                	test   %eax,%eax
+    18ac:	0f 88 f3 00 00 00    	js     19a5 <linktest+0x1c2>
+    printf(1, "open lf2 failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    18b2:	83 ec 04             	sub    $0x4,%esp
+    18b5:	68 00 20 00 00       	push   $0x2000
+    18ba:	68 80 8a 00 00       	push   $0x8a80
+    18bf:	50                   	push   %eax
+    18c0:	e8 80 23 00 00       	call   3c45 <read>
+    18c5:	83 c4 10             	add    $0x10,%esp
+    18c8:	83 f8 05             	cmp    $0x5,%eax
+    18cb:	0f 85 e8 00 00 00    	jne    19b9 <linktest+0x1d6>
+    printf(1, "read lf2 failed\n");
+    exit();
+  }
+  close(fd);
+    18d1:	83 ec 0c             	sub    $0xc,%esp
+    18d4:	53                   	push   %ebx
+    18d5:	e8 7b 23 00 00       	call   3c55 <close>
+
+  if(link("lf2", "lf2") >= 0){
+    18da:	83 c4 08             	add    $0x8,%esp
+    18dd:	68 60 47 00 00       	push   $0x4760
+    18e2:	68 60 47 00 00       	push   $0x4760
+    18e7:	e8 a1 23 00 00       	call   3c8d <link>
+    18ec:	83 c4 10             	add    $0x10,%esp
+    18ef:	85 c0                	test   %eax,%eax
+    18f1:	0f 89 d6 00 00 00    	jns    19cd <linktest+0x1ea>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    exit();
+  }
+
+  unlink("lf2");
+    18f7:	83 ec 0c             	sub    $0xc,%esp
+    18fa:	68 60 47 00 00       	push   $0x4760
+    18ff:	e8 79 23 00 00       	call   3c7d <unlink>
+  if(link("lf2", "lf1") >= 0){
+    1904:	83 c4 08             	add    $0x8,%esp
+    1907:	68 5c 47 00 00       	push   $0x475c
+    190c:	68 60 47 00 00       	push   $0x4760
+    1911:	e8 77 23 00 00       	call   3c8d <link>
+    1916:	83 c4 10             	add    $0x10,%esp
+    1919:	85 c0                	test   %eax,%eax
+    191b:	0f 89 c0 00 00 00    	jns    19e1 <linktest+0x1fe>
+    printf(1, "link non-existant succeeded! oops\n");
+    exit();
+  }
+
+  if(link(".", "lf1") >= 0){
+    1921:	83 ec 08             	sub    $0x8,%esp
+    1924:	68 5c 47 00 00       	push   $0x475c
+    1929:	68 24 4a 00 00       	push   $0x4a24
+    192e:	e8 5a 23 00 00       	call   3c8d <link>
+    1933:	83 c4 10             	add    $0x10,%esp
+    1936:	85 c0                	test   %eax,%eax
+    1938:	0f 89 b7 00 00 00    	jns    19f5 <linktest+0x212>
+    printf(1, "link . lf1 succeeded! oops\n");
+    exit();
+  }
+
+  printf(1, "linktest ok\n");
+    193e:	83 ec 08             	sub    $0x8,%esp
+    1941:	68 fa 47 00 00       	push   $0x47fa
+    1946:	6a 01                	push   $0x1
+    1948:	e8 85 24 00 00       	call   3dd2 <printf>
+}
+    194d:	83 c4 10             	add    $0x10,%esp
+    1950:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1953:	c9                   	leave
+    1954:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1955:	83 ec 08             	sub    $0x8,%esp
+    1958:	68 64 47 00 00       	push   $0x4764
+    195d:	6a 01                	push   $0x1
+    195f:	e8 6e 24 00 00       	call   3dd2 <printf>
+    exit();
+    1964:	e8 c4 22 00 00       	call   3c2d <exit>
+    printf(1, "write lf1 failed\n");
+    1969:	83 ec 08             	sub    $0x8,%esp
+    196c:	68 77 47 00 00       	push   $0x4777
+    1971:	6a 01                	push   $0x1
+    1973:	e8 5a 24 00 00       	call   3dd2 <printf>
+    exit();
+    1978:	e8 b0 22 00 00       	call   3c2d <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    197d:	83 ec 08             	sub    $0x8,%esp
+    1980:	68 89 47 00 00       	push   $0x4789
+    1985:	6a 01                	push   $0x1
+    1987:	e8 46 24 00 00       	call   3dd2 <printf>
+    exit();
+    198c:	e8 9c 22 00 00       	call   3c2d <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1991:	83 ec 08             	sub    $0x8,%esp
+    1994:	68 68 53 00 00       	push   $0x5368
+    1999:	6a 01                	push   $0x1
+    199b:	e8 32 24 00 00       	call   3dd2 <printf>
+    exit();
+    19a0:	e8 88 22 00 00       	call   3c2d <exit>
+    printf(1, "open lf2 failed\n");
+    19a5:	83 ec 08             	sub    $0x8,%esp
+    19a8:	68 9e 47 00 00       	push   $0x479e
+    19ad:	6a 01                	push   $0x1
+    19af:	e8 1e 24 00 00       	call   3dd2 <printf>
+    exit();
+    19b4:	e8 74 22 00 00       	call   3c2d <exit>
+    printf(1, "read lf2 failed\n");
+    19b9:	83 ec 08             	sub    $0x8,%esp
+    19bc:	68 af 47 00 00       	push   $0x47af
+    19c1:	6a 01                	push   $0x1
+    19c3:	e8 0a 24 00 00       	call   3dd2 <printf>
+    exit();
+    19c8:	e8 60 22 00 00       	call   3c2d <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    19cd:	83 ec 08             	sub    $0x8,%esp
+    19d0:	68 c0 47 00 00       	push   $0x47c0
+    19d5:	6a 01                	push   $0x1
+    19d7:	e8 f6 23 00 00       	call   3dd2 <printf>
+    exit();
+    19dc:	e8 4c 22 00 00       	call   3c2d <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    19e1:	83 ec 08             	sub    $0x8,%esp
+    19e4:	68 90 53 00 00       	push   $0x5390
+    19e9:	6a 01                	push   $0x1
+    19eb:	e8 e2 23 00 00       	call   3dd2 <printf>
+    exit();
+    19f0:	e8 38 22 00 00       	call   3c2d <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    19f5:	83 ec 08             	sub    $0x8,%esp
+    19f8:	68 de 47 00 00       	push   $0x47de
+    19fd:	6a 01                	push   $0x1
+    19ff:	e8 ce 23 00 00       	call   3dd2 <printf>
+    exit();
+    1a04:	e8 24 22 00 00       	call   3c2d <exit>
+
+00001a09 <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    1a09:	55                   	push   %ebp
+    1a0a:	89 e5                	mov    %esp,%ebp
+    1a0c:	57                   	push   %edi
+    1a0d:	56                   	push   %esi
+    1a0e:	53                   	push   %ebx
+    1a0f:	83 ec 54             	sub    $0x54,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    1a12:	68 07 48 00 00       	push   $0x4807
+    1a17:	6a 01                	push   $0x1
+    1a19:	e8 b4 23 00 00       	call   3dd2 <printf>
+  file[0] = 'C';
+    1a1e:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    1a22:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    1a26:	83 c4 10             	add    $0x10,%esp
+    1a29:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1a2e:	eb 5a                	jmp    1a8a <concreate+0x81>
+    file[1] = '0' + i;
+    unlink(file);
+    pid = fork();
+    if(pid && (i % 3) == 1){
+      link("C0", file);
+    } else if(pid == 0 && (i % 5) == 1){
+    1a30:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1a35:	89 d8                	mov    %ebx,%eax
+    1a37:	f7 ea                	imul   %edx
+    1a39:	d1 fa                	sar    %edx
+    1a3b:	89 d8                	mov    %ebx,%eax
+    1a3d:	c1 f8 1f             	sar    $0x1f,%eax
+    1a40:	29 c2                	sub    %eax,%edx
+    1a42:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1a45:	89 da                	mov    %ebx,%edx
+    1a47:	29 c2                	sub    %eax,%edx
+    1a49:	83 fa 01             	cmp    $0x1,%edx
+    1a4c:	0f 84 9b 00 00 00    	je     1aed <concreate+0xe4>
+      link("C0", file);
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    1a52:	83 ec 08             	sub    $0x8,%esp
+    1a55:	68 02 02 00 00       	push   $0x202
+    1a5a:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1a5d:	50                   	push   %eax
+    1a5e:	e8 0a 22 00 00       	call   3c6d <open>
+      if(fd < 0){
+    1a63:	83 c4 10             	add    $0x10,%esp
+    1a66:	85 c0                	test   %eax,%eax
+    1a68:	0f 88 98 00 00 00    	js     1b06 <concreate+0xfd>
+        printf(1, "concreate create %s failed\n", file);
+        exit();
+      }
+      close(fd);
+    1a6e:	83 ec 0c             	sub    $0xc,%esp
+    1a71:	50                   	push   %eax
+    1a72:	e8 de 21 00 00       	call   3c55 <close>
+    1a77:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1a7a:	85 f6                	test   %esi,%esi
+    1a7c:	0f 84 9c 00 00 00    	je     1b1e <concreate+0x115>
+      exit();
+    else
+      wait();
+    1a82:	e8 ae 21 00 00       	call   3c35 <wait>
+  for(i = 0; i < 40; i++){
+    1a87:	83 c3 01             	add    $0x1,%ebx
+    1a8a:	83 fb 27             	cmp    $0x27,%ebx
+    1a8d:	0f 8f 90 00 00 00    	jg     1b23 <concreate+0x11a>
+    file[1] = '0' + i;
+    1a93:	8d 43 30             	lea    0x30(%ebx),%eax
+    1a96:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    1a99:	83 ec 0c             	sub    $0xc,%esp
+    1a9c:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1a9f:	50                   	push   %eax
+    1aa0:	e8 d8 21 00 00       	call   3c7d <unlink>
+    pid = fork();
+    1aa5:	e8 7b 21 00 00       	call   3c25 <fork>
+    1aaa:	89 c6                	mov    %eax,%esi
+    if(pid && (i % 3) == 1){
+    1aac:	83 c4 10             	add    $0x10,%esp
+    1aaf:	85 c0                	test   %eax,%eax
+    1ab1:	0f 84 79 ff ff ff    	je     1a30 <concreate+0x27>
+    1ab7:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1abc:	89 d8                	mov    %ebx,%eax
+    1abe:	f7 ea                	imul   %edx
+    1ac0:	89 d8                	mov    %ebx,%eax
+    1ac2:	c1 f8 1f             	sar    $0x1f,%eax
+    1ac5:	29 c2                	sub    %eax,%edx
+    1ac7:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    1aca:	89 da                	mov    %ebx,%edx
+    1acc:	29 c2                	sub    %eax,%edx
+    1ace:	83 fa 01             	cmp    $0x1,%edx
+    1ad1:	0f 85 7b ff ff ff    	jne    1a52 <concreate+0x49>
+      link("C0", file);
+    1ad7:	83 ec 08             	sub    $0x8,%esp
+    1ada:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1add:	50                   	push   %eax
+    1ade:	68 17 48 00 00       	push   $0x4817
+    1ae3:	e8 a5 21 00 00       	call   3c8d <link>
+    1ae8:	83 c4 10             	add    $0x10,%esp
+    1aeb:	eb 8d                	jmp    1a7a <concreate+0x71>
+      link("C0", file);
+    1aed:	83 ec 08             	sub    $0x8,%esp
+    1af0:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1af3:	50                   	push   %eax
+    1af4:	68 17 48 00 00       	push   $0x4817
+    1af9:	e8 8f 21 00 00       	call   3c8d <link>
+    1afe:	83 c4 10             	add    $0x10,%esp
+    1b01:	e9 74 ff ff ff       	jmp    1a7a <concreate+0x71>
+        printf(1, "concreate create %s failed\n", file);
+    1b06:	83 ec 04             	sub    $0x4,%esp
+    1b09:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1b0c:	50                   	push   %eax
+    1b0d:	68 1a 48 00 00       	push   $0x481a
+    1b12:	6a 01                	push   $0x1
+    1b14:	e8 b9 22 00 00       	call   3dd2 <printf>
+        exit();
+    1b19:	e8 0f 21 00 00       	call   3c2d <exit>
+      exit();
+    1b1e:	e8 0a 21 00 00       	call   3c2d <exit>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    1b23:	83 ec 04             	sub    $0x4,%esp
+    1b26:	6a 28                	push   $0x28
+    1b28:	6a 00                	push   $0x0
+    1b2a:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    1b2d:	50                   	push   %eax
+    1b2e:	e8 fa 1e 00 00       	call   3a2d <memset>
+  fd = open(".", 0);
+    1b33:	83 c4 08             	add    $0x8,%esp
+    1b36:	6a 00                	push   $0x0
+    1b38:	68 24 4a 00 00       	push   $0x4a24
+    1b3d:	e8 2b 21 00 00       	call   3c6d <open>
+    1b42:	89 c3                	mov    %eax,%ebx
+  n = 0;
+  while(read(fd, &de, sizeof(de)) > 0){
+    1b44:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+    1b47:	be 00 00 00 00       	mov    $0x0,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1b4c:	83 ec 04             	sub    $0x4,%esp
+    1b4f:	6a 10                	push   $0x10
+    1b51:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1b54:	50                   	push   %eax
+    1b55:	53                   	push   %ebx
+    1b56:	e8 ea 20 00 00       	call   3c45 <read>
+    1b5b:	83 c4 10             	add    $0x10,%esp
+    1b5e:	85 c0                	test   %eax,%eax
+    1b60:	7e 60                	jle    1bc2 <concreate+0x1b9>
+    if(de.inum == 0)
+    1b62:	66 83 7d ac 00       	cmpw   $0x0,-0x54(%ebp)
+    1b67:	74 e3                	je     1b4c <concreate+0x143>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1b69:	80 7d ae 43          	cmpb   $0x43,-0x52(%ebp)
+    1b6d:	75 dd                	jne    1b4c <concreate+0x143>
+    1b6f:	80 7d b0 00          	cmpb   $0x0,-0x50(%ebp)
+    1b73:	75 d7                	jne    1b4c <concreate+0x143>
+      i = de.name[1] - '0';
+    1b75:	0f be 45 af          	movsbl -0x51(%ebp),%eax
+    1b79:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1b7c:	83 f8 27             	cmp    $0x27,%eax
+    1b7f:	77 11                	ja     1b92 <concreate+0x189>
+        printf(1, "concreate weird file %s\n", de.name);
+        exit();
+      }
+      if(fa[i]){
+    1b81:	80 7c 05 bd 00       	cmpb   $0x0,-0x43(%ebp,%eax,1)
+    1b86:	75 22                	jne    1baa <concreate+0x1a1>
+        printf(1, "concreate duplicate file %s\n", de.name);
+        exit();
+      }
+      fa[i] = 1;
+    1b88:	c6 44 05 bd 01       	movb   $0x1,-0x43(%ebp,%eax,1)
+      n++;
+    1b8d:	83 c6 01             	add    $0x1,%esi
+    1b90:	eb ba                	jmp    1b4c <concreate+0x143>
+        printf(1, "concreate weird file %s\n", de.name);
+    1b92:	83 ec 04             	sub    $0x4,%esp
+    1b95:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    1b98:	50                   	push   %eax
+    1b99:	68 36 48 00 00       	push   $0x4836
+    1b9e:	6a 01                	push   $0x1
+    1ba0:	e8 2d 22 00 00       	call   3dd2 <printf>
+        exit();
+    1ba5:	e8 83 20 00 00       	call   3c2d <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1baa:	83 ec 04             	sub    $0x4,%esp
+    1bad:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    1bb0:	50                   	push   %eax
+    1bb1:	68 4f 48 00 00       	push   $0x484f
+    1bb6:	6a 01                	push   $0x1
+    1bb8:	e8 15 22 00 00       	call   3dd2 <printf>
+        exit();
+    1bbd:	e8 6b 20 00 00       	call   3c2d <exit>
+    }
+  }
+  close(fd);
+    1bc2:	83 ec 0c             	sub    $0xc,%esp
+    1bc5:	53                   	push   %ebx
+    1bc6:	e8 8a 20 00 00       	call   3c55 <close>
+
+  if(n != 40){
+    1bcb:	83 c4 10             	add    $0x10,%esp
+    1bce:	83 fe 28             	cmp    $0x28,%esi
+    1bd1:	75 0a                	jne    1bdd <concreate+0x1d4>
+    printf(1, "concreate not enough files in directory listing\n");
+    exit();
+  }
+
+  for(i = 0; i < 40; i++){
+    1bd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1bd8:	e9 86 00 00 00       	jmp    1c63 <concreate+0x25a>
+    printf(1, "concreate not enough files in directory listing\n");
+    1bdd:	83 ec 08             	sub    $0x8,%esp
+    1be0:	68 b4 53 00 00       	push   $0x53b4
+    1be5:	6a 01                	push   $0x1
+    1be7:	e8 e6 21 00 00       	call   3dd2 <printf>
+    exit();
+    1bec:	e8 3c 20 00 00       	call   3c2d <exit>
+    file[1] = '0' + i;
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+    1bf1:	83 ec 08             	sub    $0x8,%esp
+    1bf4:	68 ef 50 00 00       	push   $0x50ef
+    1bf9:	6a 01                	push   $0x1
+    1bfb:	e8 d2 21 00 00       	call   3dd2 <printf>
+      exit();
+    1c00:	e8 28 20 00 00       	call   3c2d <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+       ((i % 3) == 1 && pid != 0)){
+      close(open(file, 0));
+    1c05:	83 ec 08             	sub    $0x8,%esp
+    1c08:	6a 00                	push   $0x0
+    1c0a:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    1c0d:	57                   	push   %edi
+    1c0e:	e8 5a 20 00 00       	call   3c6d <open>
+    1c13:	89 04 24             	mov    %eax,(%esp)
+    1c16:	e8 3a 20 00 00       	call   3c55 <close>
+      close(open(file, 0));
+    1c1b:	83 c4 08             	add    $0x8,%esp
+    1c1e:	6a 00                	push   $0x0
+    1c20:	57                   	push   %edi
+    1c21:	e8 47 20 00 00       	call   3c6d <open>
+    1c26:	89 04 24             	mov    %eax,(%esp)
+    1c29:	e8 27 20 00 00       	call   3c55 <close>
+      close(open(file, 0));
+    1c2e:	83 c4 08             	add    $0x8,%esp
+    1c31:	6a 00                	push   $0x0
+    1c33:	57                   	push   %edi
+    1c34:	e8 34 20 00 00       	call   3c6d <open>
+    1c39:	89 04 24             	mov    %eax,(%esp)
+    1c3c:	e8 14 20 00 00       	call   3c55 <close>
+      close(open(file, 0));
+    1c41:	83 c4 08             	add    $0x8,%esp
+    1c44:	6a 00                	push   $0x0
+    1c46:	57                   	push   %edi
+    1c47:	e8 21 20 00 00       	call   3c6d <open>
+    1c4c:	89 04 24             	mov    %eax,(%esp)
+    1c4f:	e8 01 20 00 00       	call   3c55 <close>
+    1c54:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+      unlink(file);
+      unlink(file);
+      unlink(file);
+    }
+    if(pid == 0)
+    1c57:	85 f6                	test   %esi,%esi
+    1c59:	74 79                	je     1cd4 <concreate+0x2cb>
+      exit();
+    else
+      wait();
+    1c5b:	e8 d5 1f 00 00       	call   3c35 <wait>
+  for(i = 0; i < 40; i++){
+    1c60:	83 c3 01             	add    $0x1,%ebx
+    1c63:	83 fb 27             	cmp    $0x27,%ebx
+    1c66:	7f 71                	jg     1cd9 <concreate+0x2d0>
+    file[1] = '0' + i;
+    1c68:	8d 43 30             	lea    0x30(%ebx),%eax
+    1c6b:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    1c6e:	e8 b2 1f 00 00       	call   3c25 <fork>
+    1c73:	89 c6                	mov    %eax,%esi
+    if(pid < 0){
+    1c75:	85 c0                	test   %eax,%eax
+    1c77:	0f 88 74 ff ff ff    	js     1bf1 <concreate+0x1e8>
+    if(((i % 3) == 0 && pid == 0) ||
+    1c7d:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1c82:	89 d8                	mov    %ebx,%eax
+    1c84:	f7 ea                	imul   %edx
+    1c86:	89 d8                	mov    %ebx,%eax
+    1c88:	c1 f8 1f             	sar    $0x1f,%eax
+    1c8b:	29 c2                	sub    %eax,%edx
+    1c8d:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    1c90:	89 da                	mov    %ebx,%edx
+    1c92:	29 c2                	sub    %eax,%edx
+    1c94:	89 d0                	mov    %edx,%eax
+    1c96:	09 f0                	or     %esi,%eax
+    1c98:	0f 84 67 ff ff ff    	je     1c05 <concreate+0x1fc>
+    1c9e:	83 fa 01             	cmp    $0x1,%edx
+    1ca1:	75 08                	jne    1cab <concreate+0x2a2>
+       ((i % 3) == 1 && pid != 0)){
+    1ca3:	85 f6                	test   %esi,%esi
+    1ca5:	0f 85 5a ff ff ff    	jne    1c05 <concreate+0x1fc>
+      unlink(file);
+    1cab:	83 ec 0c             	sub    $0xc,%esp
+    1cae:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    1cb1:	57                   	push   %edi
+    1cb2:	e8 c6 1f 00 00       	call   3c7d <unlink>
+      unlink(file);
+    1cb7:	89 3c 24             	mov    %edi,(%esp)
+    1cba:	e8 be 1f 00 00       	call   3c7d <unlink>
+      unlink(file);
+    1cbf:	89 3c 24             	mov    %edi,(%esp)
+    1cc2:	e8 b6 1f 00 00       	call   3c7d <unlink>
+      unlink(file);
+    1cc7:	89 3c 24             	mov    %edi,(%esp)
+    1cca:	e8 ae 1f 00 00       	call   3c7d <unlink>
+    1ccf:	83 c4 10             	add    $0x10,%esp
+    1cd2:	eb 83                	jmp    1c57 <concreate+0x24e>
+      exit();
+    1cd4:	e8 54 1f 00 00       	call   3c2d <exit>
+  }
+
+  printf(1, "concreate ok\n");
+    1cd9:	83 ec 08             	sub    $0x8,%esp
+    1cdc:	68 6c 48 00 00       	push   $0x486c
+    1ce1:	6a 01                	push   $0x1
+    1ce3:	e8 ea 20 00 00       	call   3dd2 <printf>
+}
+    1ce8:	83 c4 10             	add    $0x10,%esp
+    1ceb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cee:	5b                   	pop    %ebx
+    1cef:	5e                   	pop    %esi
+    1cf0:	5f                   	pop    %edi
+    1cf1:	5d                   	pop    %ebp
+    1cf2:	c3                   	ret
+
+00001cf3 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    1cf3:	55                   	push   %ebp
+    1cf4:	89 e5                	mov    %esp,%ebp
+    1cf6:	57                   	push   %edi
+    1cf7:	56                   	push   %esi
+    1cf8:	53                   	push   %ebx
+    1cf9:	83 ec 14             	sub    $0x14,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    1cfc:	68 7a 48 00 00       	push   $0x487a
+    1d01:	6a 01                	push   $0x1
+    1d03:	e8 ca 20 00 00       	call   3dd2 <printf>
+
+  unlink("x");
+    1d08:	c7 04 24 07 4b 00 00 	movl   $0x4b07,(%esp)
+    1d0f:	e8 69 1f 00 00       	call   3c7d <unlink>
+  pid = fork();
+    1d14:	e8 0c 1f 00 00       	call   3c25 <fork>
+  if(pid < 0){
+    1d19:	83 c4 10             	add    $0x10,%esp
+    1d1c:	85 c0                	test   %eax,%eax
+    1d1e:	78 10                	js     1d30 <linkunlink+0x3d>
+    1d20:	89 c7                	mov    %eax,%edi
+    printf(1, "fork failed\n");
+    exit();
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    1d22:	74 20                	je     1d44 <linkunlink+0x51>
+    1d24:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1d29:	be 00 00 00 00       	mov    $0x0,%esi
+    1d2e:	eb 3b                	jmp    1d6b <linkunlink+0x78>
+    printf(1, "fork failed\n");
+    1d30:	83 ec 08             	sub    $0x8,%esp
+    1d33:	68 ef 50 00 00       	push   $0x50ef
+    1d38:	6a 01                	push   $0x1
+    1d3a:	e8 93 20 00 00       	call   3dd2 <printf>
+    exit();
+    1d3f:	e8 e9 1e 00 00       	call   3c2d <exit>
+  unsigned int x = (pid ? 1 : 97);
+    1d44:	bb 61 00 00 00       	mov    $0x61,%ebx
+    1d49:	eb de                	jmp    1d29 <linkunlink+0x36>
+  for(i = 0; i < 100; i++){
+    x = x * 1103515245 + 12345;
+    if((x % 3) == 0){
+      close(open("x", O_RDWR | O_CREATE));
+    1d4b:	83 ec 08             	sub    $0x8,%esp
+    1d4e:	68 02 02 00 00       	push   $0x202
+    1d53:	68 07 4b 00 00       	push   $0x4b07
+    1d58:	e8 10 1f 00 00       	call   3c6d <open>
+    1d5d:	89 04 24             	mov    %eax,(%esp)
+    1d60:	e8 f0 1e 00 00       	call   3c55 <close>
+    1d65:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1d68:	83 c6 01             	add    $0x1,%esi
+    1d6b:	83 fe 63             	cmp    $0x63,%esi
+    1d6e:	7f 52                	jg     1dc2 <linkunlink+0xcf>
+    x = x * 1103515245 + 12345;
+    1d70:	69 db 6d 4e c6 41    	imul   $0x41c64e6d,%ebx,%ebx
+    1d76:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+    if((x % 3) == 0){
+    1d7c:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    1d81:	89 d8                	mov    %ebx,%eax
+    1d83:	f7 e2                	mul    %edx
+    1d85:	89 d0                	mov    %edx,%eax
+    1d87:	d1 e8                	shr    %eax
+    1d89:	83 e2 fe             	and    $0xfffffffe,%edx
+    1d8c:	01 c2                	add    %eax,%edx
+    1d8e:	89 d8                	mov    %ebx,%eax
+    1d90:	29 d0                	sub    %edx,%eax
+    1d92:	74 b7                	je     1d4b <linkunlink+0x58>
+    } else if((x % 3) == 1){
+    1d94:	83 f8 01             	cmp    $0x1,%eax
+    1d97:	74 12                	je     1dab <linkunlink+0xb8>
+      link("cat", "x");
+    } else {
+      unlink("x");
+    1d99:	83 ec 0c             	sub    $0xc,%esp
+    1d9c:	68 07 4b 00 00       	push   $0x4b07
+    1da1:	e8 d7 1e 00 00       	call   3c7d <unlink>
+    1da6:	83 c4 10             	add    $0x10,%esp
+    1da9:	eb bd                	jmp    1d68 <linkunlink+0x75>
+      link("cat", "x");
+    1dab:	83 ec 08             	sub    $0x8,%esp
+    1dae:	68 07 4b 00 00       	push   $0x4b07
+    1db3:	68 8b 48 00 00       	push   $0x488b
+    1db8:	e8 d0 1e 00 00       	call   3c8d <link>
+    1dbd:	83 c4 10             	add    $0x10,%esp
+    1dc0:	eb a6                	jmp    1d68 <linkunlink+0x75>
+    }
+  }
+
+  if(pid)
+    1dc2:	85 ff                	test   %edi,%edi
+    1dc4:	74 1c                	je     1de2 <linkunlink+0xef>
+    wait();
+    1dc6:	e8 6a 1e 00 00       	call   3c35 <wait>
+  else
+    exit();
+
+  printf(1, "linkunlink ok\n");
+    1dcb:	83 ec 08             	sub    $0x8,%esp
+    1dce:	68 8f 48 00 00       	push   $0x488f
+    1dd3:	6a 01                	push   $0x1
+    1dd5:	e8 f8 1f 00 00       	call   3dd2 <printf>
+}
+    1dda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ddd:	5b                   	pop    %ebx
+    1dde:	5e                   	pop    %esi
+    1ddf:	5f                   	pop    %edi
+    1de0:	5d                   	pop    %ebp
+    1de1:	c3                   	ret
+    exit();
+    1de2:	e8 46 1e 00 00       	call   3c2d <exit>
+
+00001de7 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    1de7:	55                   	push   %ebp
+    1de8:	89 e5                	mov    %esp,%ebp
+    1dea:	53                   	push   %ebx
+    1deb:	83 ec 1c             	sub    $0x1c,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    1dee:	68 9e 48 00 00       	push   $0x489e
+    1df3:	6a 01                	push   $0x1
+    1df5:	e8 d8 1f 00 00       	call   3dd2 <printf>
+  unlink("bd");
+    1dfa:	c7 04 24 ab 48 00 00 	movl   $0x48ab,(%esp)
+    1e01:	e8 77 1e 00 00       	call   3c7d <unlink>
+
+  fd = open("bd", O_CREATE);
+    1e06:	83 c4 08             	add    $0x8,%esp
+    1e09:	68 00 02 00 00       	push   $0x200
+    1e0e:	68 ab 48 00 00       	push   $0x48ab
+    1e13:	e8 55 1e 00 00       	call   3c6d <open>
+  if(fd < 0){
+    1e18:	83 c4 10             	add    $0x10,%esp
+    1e1b:	85 c0                	test   %eax,%eax
+    1e1d:	78 65                	js     1e84 <bigdir+0x9d>
+    printf(1, "bigdir create failed\n");
+    exit();
+  }
+  close(fd);
+    1e1f:	83 ec 0c             	sub    $0xc,%esp
+    1e22:	50                   	push   %eax
+    1e23:	e8 2d 1e 00 00       	call   3c55 <close>
+
+  for(i = 0; i < 500; i++){
+    1e28:	83 c4 10             	add    $0x10,%esp
+    1e2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1e30:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    1e36:	7f 74                	jg     1eac <bigdir+0xc5>
+    name[0] = 'x';
+    1e38:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    1e3c:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    1e3f:	85 db                	test   %ebx,%ebx
+    1e41:	0f 49 c3             	cmovns %ebx,%eax
+    1e44:	c1 f8 06             	sar    $0x6,%eax
+    1e47:	83 c0 30             	add    $0x30,%eax
+    1e4a:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    1e4d:	89 da                	mov    %ebx,%edx
+    1e4f:	c1 fa 1f             	sar    $0x1f,%edx
+    1e52:	c1 ea 1a             	shr    $0x1a,%edx
+    1e55:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1e58:	83 e0 3f             	and    $0x3f,%eax
+    1e5b:	29 d0                	sub    %edx,%eax
+    1e5d:	83 c0 30             	add    $0x30,%eax
+    1e60:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    1e63:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(link("bd", name) != 0){
+    1e67:	83 ec 08             	sub    $0x8,%esp
+    1e6a:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    1e6d:	50                   	push   %eax
+    1e6e:	68 ab 48 00 00       	push   $0x48ab
+    1e73:	e8 15 1e 00 00       	call   3c8d <link>
+    1e78:	83 c4 10             	add    $0x10,%esp
+    1e7b:	85 c0                	test   %eax,%eax
+    1e7d:	75 19                	jne    1e98 <bigdir+0xb1>
+  for(i = 0; i < 500; i++){
+    1e7f:	83 c3 01             	add    $0x1,%ebx
+    1e82:	eb ac                	jmp    1e30 <bigdir+0x49>
+    printf(1, "bigdir create failed\n");
+    1e84:	83 ec 08             	sub    $0x8,%esp
+    1e87:	68 ae 48 00 00       	push   $0x48ae
+    1e8c:	6a 01                	push   $0x1
+    1e8e:	e8 3f 1f 00 00       	call   3dd2 <printf>
+    exit();
+    1e93:	e8 95 1d 00 00       	call   3c2d <exit>
+      printf(1, "bigdir link failed\n");
+    1e98:	83 ec 08             	sub    $0x8,%esp
+    1e9b:	68 c4 48 00 00       	push   $0x48c4
+    1ea0:	6a 01                	push   $0x1
+    1ea2:	e8 2b 1f 00 00       	call   3dd2 <printf>
+      exit();
+    1ea7:	e8 81 1d 00 00       	call   3c2d <exit>
+    }
+  }
+
+  unlink("bd");
+    1eac:	83 ec 0c             	sub    $0xc,%esp
+    1eaf:	68 ab 48 00 00       	push   $0x48ab
+    1eb4:	e8 c4 1d 00 00       	call   3c7d <unlink>
+  for(i = 0; i < 500; i++){
+    1eb9:	83 c4 10             	add    $0x10,%esp
+    1ebc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1ec1:	eb 03                	jmp    1ec6 <bigdir+0xdf>
+    1ec3:	83 c3 01             	add    $0x1,%ebx
+    1ec6:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    1ecc:	7f 56                	jg     1f24 <bigdir+0x13d>
+    name[0] = 'x';
+    1ece:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    1ed2:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    1ed5:	85 db                	test   %ebx,%ebx
+    1ed7:	0f 49 c3             	cmovns %ebx,%eax
+    1eda:	c1 f8 06             	sar    $0x6,%eax
+    1edd:	83 c0 30             	add    $0x30,%eax
+    1ee0:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    1ee3:	89 da                	mov    %ebx,%edx
+    1ee5:	c1 fa 1f             	sar    $0x1f,%edx
+    1ee8:	c1 ea 1a             	shr    $0x1a,%edx
+    1eeb:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1eee:	83 e0 3f             	and    $0x3f,%eax
+    1ef1:	29 d0                	sub    %edx,%eax
+    1ef3:	83 c0 30             	add    $0x30,%eax
+    1ef6:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    1ef9:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(unlink(name) != 0){
+    1efd:	83 ec 0c             	sub    $0xc,%esp
+    1f00:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    1f03:	50                   	push   %eax
+    1f04:	e8 74 1d 00 00       	call   3c7d <unlink>
+    1f09:	83 c4 10             	add    $0x10,%esp
+    1f0c:	85 c0                	test   %eax,%eax
+    1f0e:	74 b3                	je     1ec3 <bigdir+0xdc>
+      printf(1, "bigdir unlink failed");
+    1f10:	83 ec 08             	sub    $0x8,%esp
+    1f13:	68 d8 48 00 00       	push   $0x48d8
+    1f18:	6a 01                	push   $0x1
+    1f1a:	e8 b3 1e 00 00       	call   3dd2 <printf>
+      exit();
+    1f1f:	e8 09 1d 00 00       	call   3c2d <exit>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    1f24:	83 ec 08             	sub    $0x8,%esp
+    1f27:	68 ed 48 00 00       	push   $0x48ed
+    1f2c:	6a 01                	push   $0x1
+    1f2e:	e8 9f 1e 00 00       	call   3dd2 <printf>
+}
+    1f33:	83 c4 10             	add    $0x10,%esp
+    1f36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f39:	c9                   	leave
+    1f3a:	c3                   	ret
+
+00001f3b <subdir>:
+
+void
+subdir(void)
+{
+    1f3b:	55                   	push   %ebp
+    1f3c:	89 e5                	mov    %esp,%ebp
+    1f3e:	53                   	push   %ebx
+    1f3f:	83 ec 0c             	sub    $0xc,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    1f42:	68 f8 48 00 00       	push   $0x48f8
+    1f47:	6a 01                	push   $0x1
+    1f49:	e8 84 1e 00 00       	call   3dd2 <printf>
+
+  unlink("ff");
+    1f4e:	c7 04 24 81 49 00 00 	movl   $0x4981,(%esp)
+    1f55:	e8 23 1d 00 00       	call   3c7d <unlink>
+  if(mkdir("dd") != 0){
+    1f5a:	c7 04 24 1e 4a 00 00 	movl   $0x4a1e,(%esp)
+    1f61:	e8 2f 1d 00 00       	call   3c95 <mkdir>
+    1f66:	83 c4 10             	add    $0x10,%esp
+    1f69:	85 c0                	test   %eax,%eax
+    1f6b:	0f 85 14 04 00 00    	jne    2385 <subdir+0x44a>
+    printf(1, "subdir mkdir dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1f71:	83 ec 08             	sub    $0x8,%esp
+    1f74:	68 02 02 00 00       	push   $0x202
+    1f79:	68 57 49 00 00       	push   $0x4957
+    1f7e:	e8 ea 1c 00 00       	call   3c6d <open>
+    1f83:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1f85:	83 c4 10             	add    $0x10,%esp
+    1f88:	85 c0                	test   %eax,%eax
+    1f8a:	0f 88 09 04 00 00    	js     2399 <subdir+0x45e>
+    printf(1, "create dd/ff failed\n");
+    exit();
+  }
+  write(fd, "ff", 2);
+    1f90:	83 ec 04             	sub    $0x4,%esp
+    1f93:	6a 02                	push   $0x2
+    1f95:	68 81 49 00 00       	push   $0x4981
+    1f9a:	50                   	push   %eax
+    1f9b:	e8 ad 1c 00 00       	call   3c4d <write>
+  close(fd);
+    1fa0:	89 1c 24             	mov    %ebx,(%esp)
+    1fa3:	e8 ad 1c 00 00       	call   3c55 <close>
+
+  if(unlink("dd") >= 0){
+    1fa8:	c7 04 24 1e 4a 00 00 	movl   $0x4a1e,(%esp)
+    1faf:	e8 c9 1c 00 00       	call   3c7d <unlink>
+    1fb4:	83 c4 10             	add    $0x10,%esp
+    1fb7:	85 c0                	test   %eax,%eax
+    1fb9:	0f 89 ee 03 00 00    	jns    23ad <subdir+0x472>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    exit();
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    1fbf:	83 ec 0c             	sub    $0xc,%esp
+    1fc2:	68 32 49 00 00       	push   $0x4932
+    1fc7:	e8 c9 1c 00 00       	call   3c95 <mkdir>
+    1fcc:	83 c4 10             	add    $0x10,%esp
+    1fcf:	85 c0                	test   %eax,%eax
+    1fd1:	0f 85 ea 03 00 00    	jne    23c1 <subdir+0x486>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1fd7:	83 ec 08             	sub    $0x8,%esp
+    1fda:	68 02 02 00 00       	push   $0x202
+    1fdf:	68 54 49 00 00       	push   $0x4954
+    1fe4:	e8 84 1c 00 00       	call   3c6d <open>
+    1fe9:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1feb:	83 c4 10             	add    $0x10,%esp
+    1fee:	85 c0                	test   %eax,%eax
+    1ff0:	0f 88 df 03 00 00    	js     23d5 <subdir+0x49a>
+    printf(1, "create dd/dd/ff failed\n");
+    exit();
+  }
+  write(fd, "FF", 2);
+    1ff6:	83 ec 04             	sub    $0x4,%esp
+    1ff9:	6a 02                	push   $0x2
+    1ffb:	68 75 49 00 00       	push   $0x4975
+    2000:	50                   	push   %eax
+    2001:	e8 47 1c 00 00       	call   3c4d <write>
+  close(fd);
+    2006:	89 1c 24             	mov    %ebx,(%esp)
+    2009:	e8 47 1c 00 00       	call   3c55 <close>
+
+  fd = open("dd/dd/../ff", 0);
+    200e:	83 c4 08             	add    $0x8,%esp
+    2011:	6a 00                	push   $0x0
+    2013:	68 78 49 00 00       	push   $0x4978
+    2018:	e8 50 1c 00 00       	call   3c6d <open>
+    201d:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    201f:	83 c4 10             	add    $0x10,%esp
+    2022:	85 c0                	test   %eax,%eax
+    2024:	0f 88 bf 03 00 00    	js     23e9 <subdir+0x4ae>
+    printf(1, "open dd/dd/../ff failed\n");
+    exit();
+  }
+  cc = read(fd, buf, sizeof(buf));
+    202a:	83 ec 04             	sub    $0x4,%esp
+    202d:	68 00 20 00 00       	push   $0x2000
+    2032:	68 80 8a 00 00       	push   $0x8a80
+    2037:	50                   	push   %eax
+    2038:	e8 08 1c 00 00       	call   3c45 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    203d:	83 c4 10             	add    $0x10,%esp
+    2040:	83 f8 02             	cmp    $0x2,%eax
+    2043:	0f 85 b4 03 00 00    	jne    23fd <subdir+0x4c2>
+    2049:	80 3d 80 8a 00 00 66 	cmpb   $0x66,0x8a80
+    2050:	0f 85 a7 03 00 00    	jne    23fd <subdir+0x4c2>
+    printf(1, "dd/dd/../ff wrong content\n");
+    exit();
+  }
+  close(fd);
+    2056:	83 ec 0c             	sub    $0xc,%esp
+    2059:	53                   	push   %ebx
+    205a:	e8 f6 1b 00 00       	call   3c55 <close>
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    205f:	83 c4 08             	add    $0x8,%esp
+    2062:	68 b8 49 00 00       	push   $0x49b8
+    2067:	68 54 49 00 00       	push   $0x4954
+    206c:	e8 1c 1c 00 00       	call   3c8d <link>
+    2071:	83 c4 10             	add    $0x10,%esp
+    2074:	85 c0                	test   %eax,%eax
+    2076:	0f 85 95 03 00 00    	jne    2411 <subdir+0x4d6>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    207c:	83 ec 0c             	sub    $0xc,%esp
+    207f:	68 54 49 00 00       	push   $0x4954
+    2084:	e8 f4 1b 00 00       	call   3c7d <unlink>
+    2089:	83 c4 10             	add    $0x10,%esp
+    208c:	85 c0                	test   %eax,%eax
+    208e:	0f 85 91 03 00 00    	jne    2425 <subdir+0x4ea>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2094:	83 ec 08             	sub    $0x8,%esp
+    2097:	6a 00                	push   $0x0
+    2099:	68 54 49 00 00       	push   $0x4954
+    209e:	e8 ca 1b 00 00       	call   3c6d <open>
+    20a3:	83 c4 10             	add    $0x10,%esp
+    20a6:	85 c0                	test   %eax,%eax
+    20a8:	0f 89 8b 03 00 00    	jns    2439 <subdir+0x4fe>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    exit();
+  }
+
+  if(chdir("dd") != 0){
+    20ae:	83 ec 0c             	sub    $0xc,%esp
+    20b1:	68 1e 4a 00 00       	push   $0x4a1e
+    20b6:	e8 e2 1b 00 00       	call   3c9d <chdir>
+    20bb:	83 c4 10             	add    $0x10,%esp
+    20be:	85 c0                	test   %eax,%eax
+    20c0:	0f 85 87 03 00 00    	jne    244d <subdir+0x512>
+    printf(1, "chdir dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../dd") != 0){
+    20c6:	83 ec 0c             	sub    $0xc,%esp
+    20c9:	68 ec 49 00 00       	push   $0x49ec
+    20ce:	e8 ca 1b 00 00       	call   3c9d <chdir>
+    20d3:	83 c4 10             	add    $0x10,%esp
+    20d6:	85 c0                	test   %eax,%eax
+    20d8:	0f 85 83 03 00 00    	jne    2461 <subdir+0x526>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../../dd") != 0){
+    20de:	83 ec 0c             	sub    $0xc,%esp
+    20e1:	68 12 4a 00 00       	push   $0x4a12
+    20e6:	e8 b2 1b 00 00       	call   3c9d <chdir>
+    20eb:	83 c4 10             	add    $0x10,%esp
+    20ee:	85 c0                	test   %eax,%eax
+    20f0:	0f 85 7f 03 00 00    	jne    2475 <subdir+0x53a>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("./..") != 0){
+    20f6:	83 ec 0c             	sub    $0xc,%esp
+    20f9:	68 21 4a 00 00       	push   $0x4a21
+    20fe:	e8 9a 1b 00 00       	call   3c9d <chdir>
+    2103:	83 c4 10             	add    $0x10,%esp
+    2106:	85 c0                	test   %eax,%eax
+    2108:	0f 85 7b 03 00 00    	jne    2489 <subdir+0x54e>
+    printf(1, "chdir ./.. failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    210e:	83 ec 08             	sub    $0x8,%esp
+    2111:	6a 00                	push   $0x0
+    2113:	68 b8 49 00 00       	push   $0x49b8
+    2118:	e8 50 1b 00 00       	call   3c6d <open>
+    211d:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    211f:	83 c4 10             	add    $0x10,%esp
+    2122:	85 c0                	test   %eax,%eax
+    2124:	0f 88 73 03 00 00    	js     249d <subdir+0x562>
+    printf(1, "open dd/dd/ffff failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    212a:	83 ec 04             	sub    $0x4,%esp
+    212d:	68 00 20 00 00       	push   $0x2000
+    2132:	68 80 8a 00 00       	push   $0x8a80
+    2137:	50                   	push   %eax
+    2138:	e8 08 1b 00 00       	call   3c45 <read>
+    213d:	83 c4 10             	add    $0x10,%esp
+    2140:	83 f8 02             	cmp    $0x2,%eax
+    2143:	0f 85 68 03 00 00    	jne    24b1 <subdir+0x576>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    exit();
+  }
+  close(fd);
+    2149:	83 ec 0c             	sub    $0xc,%esp
+    214c:	53                   	push   %ebx
+    214d:	e8 03 1b 00 00       	call   3c55 <close>
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2152:	83 c4 08             	add    $0x8,%esp
+    2155:	6a 00                	push   $0x0
+    2157:	68 54 49 00 00       	push   $0x4954
+    215c:	e8 0c 1b 00 00       	call   3c6d <open>
+    2161:	83 c4 10             	add    $0x10,%esp
+    2164:	85 c0                	test   %eax,%eax
+    2166:	0f 89 59 03 00 00    	jns    24c5 <subdir+0x58a>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    exit();
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    216c:	83 ec 08             	sub    $0x8,%esp
+    216f:	68 02 02 00 00       	push   $0x202
+    2174:	68 6c 4a 00 00       	push   $0x4a6c
+    2179:	e8 ef 1a 00 00       	call   3c6d <open>
+    217e:	83 c4 10             	add    $0x10,%esp
+    2181:	85 c0                	test   %eax,%eax
+    2183:	0f 89 50 03 00 00    	jns    24d9 <subdir+0x59e>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    2189:	83 ec 08             	sub    $0x8,%esp
+    218c:	68 02 02 00 00       	push   $0x202
+    2191:	68 91 4a 00 00       	push   $0x4a91
+    2196:	e8 d2 1a 00 00       	call   3c6d <open>
+    219b:	83 c4 10             	add    $0x10,%esp
+    219e:	85 c0                	test   %eax,%eax
+    21a0:	0f 89 47 03 00 00    	jns    24ed <subdir+0x5b2>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_CREATE) >= 0){
+    21a6:	83 ec 08             	sub    $0x8,%esp
+    21a9:	68 00 02 00 00       	push   $0x200
+    21ae:	68 1e 4a 00 00       	push   $0x4a1e
+    21b3:	e8 b5 1a 00 00       	call   3c6d <open>
+    21b8:	83 c4 10             	add    $0x10,%esp
+    21bb:	85 c0                	test   %eax,%eax
+    21bd:	0f 89 3e 03 00 00    	jns    2501 <subdir+0x5c6>
+    printf(1, "create dd succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_RDWR) >= 0){
+    21c3:	83 ec 08             	sub    $0x8,%esp
+    21c6:	6a 02                	push   $0x2
+    21c8:	68 1e 4a 00 00       	push   $0x4a1e
+    21cd:	e8 9b 1a 00 00       	call   3c6d <open>
+    21d2:	83 c4 10             	add    $0x10,%esp
+    21d5:	85 c0                	test   %eax,%eax
+    21d7:	0f 89 38 03 00 00    	jns    2515 <subdir+0x5da>
+    printf(1, "open dd rdwr succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    21dd:	83 ec 08             	sub    $0x8,%esp
+    21e0:	6a 01                	push   $0x1
+    21e2:	68 1e 4a 00 00       	push   $0x4a1e
+    21e7:	e8 81 1a 00 00       	call   3c6d <open>
+    21ec:	83 c4 10             	add    $0x10,%esp
+    21ef:	85 c0                	test   %eax,%eax
+    21f1:	0f 89 32 03 00 00    	jns    2529 <subdir+0x5ee>
+    printf(1, "open dd wronly succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    21f7:	83 ec 08             	sub    $0x8,%esp
+    21fa:	68 00 4b 00 00       	push   $0x4b00
+    21ff:	68 6c 4a 00 00       	push   $0x4a6c
+    2204:	e8 84 1a 00 00       	call   3c8d <link>
+    2209:	83 c4 10             	add    $0x10,%esp
+    220c:	85 c0                	test   %eax,%eax
+    220e:	0f 84 29 03 00 00    	je     253d <subdir+0x602>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2214:	83 ec 08             	sub    $0x8,%esp
+    2217:	68 00 4b 00 00       	push   $0x4b00
+    221c:	68 91 4a 00 00       	push   $0x4a91
+    2221:	e8 67 1a 00 00       	call   3c8d <link>
+    2226:	83 c4 10             	add    $0x10,%esp
+    2229:	85 c0                	test   %eax,%eax
+    222b:	0f 84 20 03 00 00    	je     2551 <subdir+0x616>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2231:	83 ec 08             	sub    $0x8,%esp
+    2234:	68 b8 49 00 00       	push   $0x49b8
+    2239:	68 57 49 00 00       	push   $0x4957
+    223e:	e8 4a 1a 00 00       	call   3c8d <link>
+    2243:	83 c4 10             	add    $0x10,%esp
+    2246:	85 c0                	test   %eax,%eax
+    2248:	0f 84 17 03 00 00    	je     2565 <subdir+0x62a>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    224e:	83 ec 0c             	sub    $0xc,%esp
+    2251:	68 6c 4a 00 00       	push   $0x4a6c
+    2256:	e8 3a 1a 00 00       	call   3c95 <mkdir>
+    225b:	83 c4 10             	add    $0x10,%esp
+    225e:	85 c0                	test   %eax,%eax
+    2260:	0f 84 13 03 00 00    	je     2579 <subdir+0x63e>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    2266:	83 ec 0c             	sub    $0xc,%esp
+    2269:	68 91 4a 00 00       	push   $0x4a91
+    226e:	e8 22 1a 00 00       	call   3c95 <mkdir>
+    2273:	83 c4 10             	add    $0x10,%esp
+    2276:	85 c0                	test   %eax,%eax
+    2278:	0f 84 0f 03 00 00    	je     258d <subdir+0x652>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    227e:	83 ec 0c             	sub    $0xc,%esp
+    2281:	68 b8 49 00 00       	push   $0x49b8
+    2286:	e8 0a 1a 00 00       	call   3c95 <mkdir>
+    228b:	83 c4 10             	add    $0x10,%esp
+    228e:	85 c0                	test   %eax,%eax
+    2290:	0f 84 0b 03 00 00    	je     25a1 <subdir+0x666>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/xx/ff") == 0){
+    2296:	83 ec 0c             	sub    $0xc,%esp
+    2299:	68 91 4a 00 00       	push   $0x4a91
+    229e:	e8 da 19 00 00       	call   3c7d <unlink>
+    22a3:	83 c4 10             	add    $0x10,%esp
+    22a6:	85 c0                	test   %eax,%eax
+    22a8:	0f 84 07 03 00 00    	je     25b5 <subdir+0x67a>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/ff/ff") == 0){
+    22ae:	83 ec 0c             	sub    $0xc,%esp
+    22b1:	68 6c 4a 00 00       	push   $0x4a6c
+    22b6:	e8 c2 19 00 00       	call   3c7d <unlink>
+    22bb:	83 c4 10             	add    $0x10,%esp
+    22be:	85 c0                	test   %eax,%eax
+    22c0:	0f 84 03 03 00 00    	je     25c9 <subdir+0x68e>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/ff") == 0){
+    22c6:	83 ec 0c             	sub    $0xc,%esp
+    22c9:	68 57 49 00 00       	push   $0x4957
+    22ce:	e8 ca 19 00 00       	call   3c9d <chdir>
+    22d3:	83 c4 10             	add    $0x10,%esp
+    22d6:	85 c0                	test   %eax,%eax
+    22d8:	0f 84 ff 02 00 00    	je     25dd <subdir+0x6a2>
+    printf(1, "chdir dd/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/xx") == 0){
+    22de:	83 ec 0c             	sub    $0xc,%esp
+    22e1:	68 03 4b 00 00       	push   $0x4b03
+    22e6:	e8 b2 19 00 00       	call   3c9d <chdir>
+    22eb:	83 c4 10             	add    $0x10,%esp
+    22ee:	85 c0                	test   %eax,%eax
+    22f0:	0f 84 fb 02 00 00    	je     25f1 <subdir+0x6b6>
+    printf(1, "chdir dd/xx succeeded!\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    22f6:	83 ec 0c             	sub    $0xc,%esp
+    22f9:	68 b8 49 00 00       	push   $0x49b8
+    22fe:	e8 7a 19 00 00       	call   3c7d <unlink>
+    2303:	83 c4 10             	add    $0x10,%esp
+    2306:	85 c0                	test   %eax,%eax
+    2308:	0f 85 f7 02 00 00    	jne    2605 <subdir+0x6ca>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd/ff") != 0){
+    230e:	83 ec 0c             	sub    $0xc,%esp
+    2311:	68 57 49 00 00       	push   $0x4957
+    2316:	e8 62 19 00 00       	call   3c7d <unlink>
+    231b:	83 c4 10             	add    $0x10,%esp
+    231e:	85 c0                	test   %eax,%eax
+    2320:	0f 85 f3 02 00 00    	jne    2619 <subdir+0x6de>
+    printf(1, "unlink dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd") == 0){
+    2326:	83 ec 0c             	sub    $0xc,%esp
+    2329:	68 1e 4a 00 00       	push   $0x4a1e
+    232e:	e8 4a 19 00 00       	call   3c7d <unlink>
+    2333:	83 c4 10             	add    $0x10,%esp
+    2336:	85 c0                	test   %eax,%eax
+    2338:	0f 84 ef 02 00 00    	je     262d <subdir+0x6f2>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/dd") < 0){
+    233e:	83 ec 0c             	sub    $0xc,%esp
+    2341:	68 33 49 00 00       	push   $0x4933
+    2346:	e8 32 19 00 00       	call   3c7d <unlink>
+    234b:	83 c4 10             	add    $0x10,%esp
+    234e:	85 c0                	test   %eax,%eax
+    2350:	0f 88 eb 02 00 00    	js     2641 <subdir+0x706>
+    printf(1, "unlink dd/dd failed\n");
+    exit();
+  }
+  if(unlink("dd") < 0){
+    2356:	83 ec 0c             	sub    $0xc,%esp
+    2359:	68 1e 4a 00 00       	push   $0x4a1e
+    235e:	e8 1a 19 00 00       	call   3c7d <unlink>
+    2363:	83 c4 10             	add    $0x10,%esp
+    2366:	85 c0                	test   %eax,%eax
+    2368:	0f 88 e7 02 00 00    	js     2655 <subdir+0x71a>
+    printf(1, "unlink dd failed\n");
+    exit();
+  }
+
+  printf(1, "subdir ok\n");
+    236e:	83 ec 08             	sub    $0x8,%esp
+    2371:	68 00 4c 00 00       	push   $0x4c00
+    2376:	6a 01                	push   $0x1
+    2378:	e8 55 1a 00 00       	call   3dd2 <printf>
+}
+    237d:	83 c4 10             	add    $0x10,%esp
+    2380:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2383:	c9                   	leave
+    2384:	c3                   	ret
+    printf(1, "subdir mkdir dd failed\n");
+    2385:	83 ec 08             	sub    $0x8,%esp
+    2388:	68 05 49 00 00       	push   $0x4905
+    238d:	6a 01                	push   $0x1
+    238f:	e8 3e 1a 00 00       	call   3dd2 <printf>
+    exit();
+    2394:	e8 94 18 00 00       	call   3c2d <exit>
+    printf(1, "create dd/ff failed\n");
+    2399:	83 ec 08             	sub    $0x8,%esp
+    239c:	68 1d 49 00 00       	push   $0x491d
+    23a1:	6a 01                	push   $0x1
+    23a3:	e8 2a 1a 00 00       	call   3dd2 <printf>
+    exit();
+    23a8:	e8 80 18 00 00       	call   3c2d <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    23ad:	83 ec 08             	sub    $0x8,%esp
+    23b0:	68 e8 53 00 00       	push   $0x53e8
+    23b5:	6a 01                	push   $0x1
+    23b7:	e8 16 1a 00 00       	call   3dd2 <printf>
+    exit();
+    23bc:	e8 6c 18 00 00       	call   3c2d <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    23c1:	83 ec 08             	sub    $0x8,%esp
+    23c4:	68 39 49 00 00       	push   $0x4939
+    23c9:	6a 01                	push   $0x1
+    23cb:	e8 02 1a 00 00       	call   3dd2 <printf>
+    exit();
+    23d0:	e8 58 18 00 00       	call   3c2d <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    23d5:	83 ec 08             	sub    $0x8,%esp
+    23d8:	68 5d 49 00 00       	push   $0x495d
+    23dd:	6a 01                	push   $0x1
+    23df:	e8 ee 19 00 00       	call   3dd2 <printf>
+    exit();
+    23e4:	e8 44 18 00 00       	call   3c2d <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    23e9:	83 ec 08             	sub    $0x8,%esp
+    23ec:	68 84 49 00 00       	push   $0x4984
+    23f1:	6a 01                	push   $0x1
+    23f3:	e8 da 19 00 00       	call   3dd2 <printf>
+    exit();
+    23f8:	e8 30 18 00 00       	call   3c2d <exit>
+    printf(1, "dd/dd/../ff wrong content\n");
+    23fd:	83 ec 08             	sub    $0x8,%esp
+    2400:	68 9d 49 00 00       	push   $0x499d
+    2405:	6a 01                	push   $0x1
+    2407:	e8 c6 19 00 00       	call   3dd2 <printf>
+    exit();
+    240c:	e8 1c 18 00 00       	call   3c2d <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2411:	83 ec 08             	sub    $0x8,%esp
+    2414:	68 10 54 00 00       	push   $0x5410
+    2419:	6a 01                	push   $0x1
+    241b:	e8 b2 19 00 00       	call   3dd2 <printf>
+    exit();
+    2420:	e8 08 18 00 00       	call   3c2d <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2425:	83 ec 08             	sub    $0x8,%esp
+    2428:	68 c3 49 00 00       	push   $0x49c3
+    242d:	6a 01                	push   $0x1
+    242f:	e8 9e 19 00 00       	call   3dd2 <printf>
+    exit();
+    2434:	e8 f4 17 00 00       	call   3c2d <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    2439:	83 ec 08             	sub    $0x8,%esp
+    243c:	68 34 54 00 00       	push   $0x5434
+    2441:	6a 01                	push   $0x1
+    2443:	e8 8a 19 00 00       	call   3dd2 <printf>
+    exit();
+    2448:	e8 e0 17 00 00       	call   3c2d <exit>
+    printf(1, "chdir dd failed\n");
+    244d:	83 ec 08             	sub    $0x8,%esp
+    2450:	68 db 49 00 00       	push   $0x49db
+    2455:	6a 01                	push   $0x1
+    2457:	e8 76 19 00 00       	call   3dd2 <printf>
+    exit();
+    245c:	e8 cc 17 00 00       	call   3c2d <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2461:	83 ec 08             	sub    $0x8,%esp
+    2464:	68 f8 49 00 00       	push   $0x49f8
+    2469:	6a 01                	push   $0x1
+    246b:	e8 62 19 00 00       	call   3dd2 <printf>
+    exit();
+    2470:	e8 b8 17 00 00       	call   3c2d <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2475:	83 ec 08             	sub    $0x8,%esp
+    2478:	68 f8 49 00 00       	push   $0x49f8
+    247d:	6a 01                	push   $0x1
+    247f:	e8 4e 19 00 00       	call   3dd2 <printf>
+    exit();
+    2484:	e8 a4 17 00 00       	call   3c2d <exit>
+    printf(1, "chdir ./.. failed\n");
+    2489:	83 ec 08             	sub    $0x8,%esp
+    248c:	68 26 4a 00 00       	push   $0x4a26
+    2491:	6a 01                	push   $0x1
+    2493:	e8 3a 19 00 00       	call   3dd2 <printf>
+    exit();
+    2498:	e8 90 17 00 00       	call   3c2d <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    249d:	83 ec 08             	sub    $0x8,%esp
+    24a0:	68 39 4a 00 00       	push   $0x4a39
+    24a5:	6a 01                	push   $0x1
+    24a7:	e8 26 19 00 00       	call   3dd2 <printf>
+    exit();
+    24ac:	e8 7c 17 00 00       	call   3c2d <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    24b1:	83 ec 08             	sub    $0x8,%esp
+    24b4:	68 51 4a 00 00       	push   $0x4a51
+    24b9:	6a 01                	push   $0x1
+    24bb:	e8 12 19 00 00       	call   3dd2 <printf>
+    exit();
+    24c0:	e8 68 17 00 00       	call   3c2d <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    24c5:	83 ec 08             	sub    $0x8,%esp
+    24c8:	68 58 54 00 00       	push   $0x5458
+    24cd:	6a 01                	push   $0x1
+    24cf:	e8 fe 18 00 00       	call   3dd2 <printf>
+    exit();
+    24d4:	e8 54 17 00 00       	call   3c2d <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    24d9:	83 ec 08             	sub    $0x8,%esp
+    24dc:	68 75 4a 00 00       	push   $0x4a75
+    24e1:	6a 01                	push   $0x1
+    24e3:	e8 ea 18 00 00       	call   3dd2 <printf>
+    exit();
+    24e8:	e8 40 17 00 00       	call   3c2d <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    24ed:	83 ec 08             	sub    $0x8,%esp
+    24f0:	68 9a 4a 00 00       	push   $0x4a9a
+    24f5:	6a 01                	push   $0x1
+    24f7:	e8 d6 18 00 00       	call   3dd2 <printf>
+    exit();
+    24fc:	e8 2c 17 00 00       	call   3c2d <exit>
+    printf(1, "create dd succeeded!\n");
+    2501:	83 ec 08             	sub    $0x8,%esp
+    2504:	68 b6 4a 00 00       	push   $0x4ab6
+    2509:	6a 01                	push   $0x1
+    250b:	e8 c2 18 00 00       	call   3dd2 <printf>
+    exit();
+    2510:	e8 18 17 00 00       	call   3c2d <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2515:	83 ec 08             	sub    $0x8,%esp
+    2518:	68 cc 4a 00 00       	push   $0x4acc
+    251d:	6a 01                	push   $0x1
+    251f:	e8 ae 18 00 00       	call   3dd2 <printf>
+    exit();
+    2524:	e8 04 17 00 00       	call   3c2d <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    2529:	83 ec 08             	sub    $0x8,%esp
+    252c:	68 e5 4a 00 00       	push   $0x4ae5
+    2531:	6a 01                	push   $0x1
+    2533:	e8 9a 18 00 00       	call   3dd2 <printf>
+    exit();
+    2538:	e8 f0 16 00 00       	call   3c2d <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    253d:	83 ec 08             	sub    $0x8,%esp
+    2540:	68 80 54 00 00       	push   $0x5480
+    2545:	6a 01                	push   $0x1
+    2547:	e8 86 18 00 00       	call   3dd2 <printf>
+    exit();
+    254c:	e8 dc 16 00 00       	call   3c2d <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2551:	83 ec 08             	sub    $0x8,%esp
+    2554:	68 a4 54 00 00       	push   $0x54a4
+    2559:	6a 01                	push   $0x1
+    255b:	e8 72 18 00 00       	call   3dd2 <printf>
+    exit();
+    2560:	e8 c8 16 00 00       	call   3c2d <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2565:	83 ec 08             	sub    $0x8,%esp
+    2568:	68 c8 54 00 00       	push   $0x54c8
+    256d:	6a 01                	push   $0x1
+    256f:	e8 5e 18 00 00       	call   3dd2 <printf>
+    exit();
+    2574:	e8 b4 16 00 00       	call   3c2d <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2579:	83 ec 08             	sub    $0x8,%esp
+    257c:	68 09 4b 00 00       	push   $0x4b09
+    2581:	6a 01                	push   $0x1
+    2583:	e8 4a 18 00 00       	call   3dd2 <printf>
+    exit();
+    2588:	e8 a0 16 00 00       	call   3c2d <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    258d:	83 ec 08             	sub    $0x8,%esp
+    2590:	68 24 4b 00 00       	push   $0x4b24
+    2595:	6a 01                	push   $0x1
+    2597:	e8 36 18 00 00       	call   3dd2 <printf>
+    exit();
+    259c:	e8 8c 16 00 00       	call   3c2d <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    25a1:	83 ec 08             	sub    $0x8,%esp
+    25a4:	68 3f 4b 00 00       	push   $0x4b3f
+    25a9:	6a 01                	push   $0x1
+    25ab:	e8 22 18 00 00       	call   3dd2 <printf>
+    exit();
+    25b0:	e8 78 16 00 00       	call   3c2d <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    25b5:	83 ec 08             	sub    $0x8,%esp
+    25b8:	68 5c 4b 00 00       	push   $0x4b5c
+    25bd:	6a 01                	push   $0x1
+    25bf:	e8 0e 18 00 00       	call   3dd2 <printf>
+    exit();
+    25c4:	e8 64 16 00 00       	call   3c2d <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    25c9:	83 ec 08             	sub    $0x8,%esp
+    25cc:	68 78 4b 00 00       	push   $0x4b78
+    25d1:	6a 01                	push   $0x1
+    25d3:	e8 fa 17 00 00       	call   3dd2 <printf>
+    exit();
+    25d8:	e8 50 16 00 00       	call   3c2d <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    25dd:	83 ec 08             	sub    $0x8,%esp
+    25e0:	68 94 4b 00 00       	push   $0x4b94
+    25e5:	6a 01                	push   $0x1
+    25e7:	e8 e6 17 00 00       	call   3dd2 <printf>
+    exit();
+    25ec:	e8 3c 16 00 00       	call   3c2d <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    25f1:	83 ec 08             	sub    $0x8,%esp
+    25f4:	68 ac 4b 00 00       	push   $0x4bac
+    25f9:	6a 01                	push   $0x1
+    25fb:	e8 d2 17 00 00       	call   3dd2 <printf>
+    exit();
+    2600:	e8 28 16 00 00       	call   3c2d <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2605:	83 ec 08             	sub    $0x8,%esp
+    2608:	68 c3 49 00 00       	push   $0x49c3
+    260d:	6a 01                	push   $0x1
+    260f:	e8 be 17 00 00       	call   3dd2 <printf>
+    exit();
+    2614:	e8 14 16 00 00       	call   3c2d <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2619:	83 ec 08             	sub    $0x8,%esp
+    261c:	68 c4 4b 00 00       	push   $0x4bc4
+    2621:	6a 01                	push   $0x1
+    2623:	e8 aa 17 00 00       	call   3dd2 <printf>
+    exit();
+    2628:	e8 00 16 00 00       	call   3c2d <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    262d:	83 ec 08             	sub    $0x8,%esp
+    2630:	68 ec 54 00 00       	push   $0x54ec
+    2635:	6a 01                	push   $0x1
+    2637:	e8 96 17 00 00       	call   3dd2 <printf>
+    exit();
+    263c:	e8 ec 15 00 00       	call   3c2d <exit>
+    printf(1, "unlink dd/dd failed\n");
+    2641:	83 ec 08             	sub    $0x8,%esp
+    2644:	68 d9 4b 00 00       	push   $0x4bd9
+    2649:	6a 01                	push   $0x1
+    264b:	e8 82 17 00 00       	call   3dd2 <printf>
+    exit();
+    2650:	e8 d8 15 00 00       	call   3c2d <exit>
+    printf(1, "unlink dd failed\n");
+    2655:	83 ec 08             	sub    $0x8,%esp
+    2658:	68 ee 4b 00 00       	push   $0x4bee
+    265d:	6a 01                	push   $0x1
+    265f:	e8 6e 17 00 00       	call   3dd2 <printf>
+    exit();
+    2664:	e8 c4 15 00 00       	call   3c2d <exit>
+
+00002669 <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    2669:	55                   	push   %ebp
+    266a:	89 e5                	mov    %esp,%ebp
+    266c:	57                   	push   %edi
+    266d:	56                   	push   %esi
+    266e:	53                   	push   %ebx
+    266f:	83 ec 14             	sub    $0x14,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    2672:	68 0b 4c 00 00       	push   $0x4c0b
+    2677:	6a 01                	push   $0x1
+    2679:	e8 54 17 00 00       	call   3dd2 <printf>
+
+  unlink("bigwrite");
+    267e:	c7 04 24 1a 4c 00 00 	movl   $0x4c1a,(%esp)
+    2685:	e8 f3 15 00 00       	call   3c7d <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    268a:	83 c4 10             	add    $0x10,%esp
+    268d:	be f3 01 00 00       	mov    $0x1f3,%esi
+    2692:	eb 45                	jmp    26d9 <bigwrite+0x70>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    if(fd < 0){
+      printf(1, "cannot create bigwrite\n");
+    2694:	83 ec 08             	sub    $0x8,%esp
+    2697:	68 23 4c 00 00       	push   $0x4c23
+    269c:	6a 01                	push   $0x1
+    269e:	e8 2f 17 00 00       	call   3dd2 <printf>
+      exit();
+    26a3:	e8 85 15 00 00       	call   3c2d <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+      int cc = write(fd, buf, sz);
+      if(cc != sz){
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    26a8:	50                   	push   %eax
+    26a9:	56                   	push   %esi
+    26aa:	68 3b 4c 00 00       	push   $0x4c3b
+    26af:	6a 01                	push   $0x1
+    26b1:	e8 1c 17 00 00       	call   3dd2 <printf>
+        exit();
+    26b6:	e8 72 15 00 00       	call   3c2d <exit>
+      }
+    }
+    close(fd);
+    26bb:	83 ec 0c             	sub    $0xc,%esp
+    26be:	57                   	push   %edi
+    26bf:	e8 91 15 00 00       	call   3c55 <close>
+    unlink("bigwrite");
+    26c4:	c7 04 24 1a 4c 00 00 	movl   $0x4c1a,(%esp)
+    26cb:	e8 ad 15 00 00       	call   3c7d <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    26d0:	81 c6 d7 01 00 00    	add    $0x1d7,%esi
+    26d6:	83 c4 10             	add    $0x10,%esp
+    26d9:	81 fe ff 17 00 00    	cmp    $0x17ff,%esi
+    26df:	7f 40                	jg     2721 <bigwrite+0xb8>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    26e1:	83 ec 08             	sub    $0x8,%esp
+    26e4:	68 02 02 00 00       	push   $0x202
+    26e9:	68 1a 4c 00 00       	push   $0x4c1a
+    26ee:	e8 7a 15 00 00       	call   3c6d <open>
+    26f3:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    26f5:	83 c4 10             	add    $0x10,%esp
+    26f8:	85 c0                	test   %eax,%eax
+    26fa:	78 98                	js     2694 <bigwrite+0x2b>
+    for(i = 0; i < 2; i++){
+    26fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2701:	83 fb 01             	cmp    $0x1,%ebx
+    2704:	7f b5                	jg     26bb <bigwrite+0x52>
+      int cc = write(fd, buf, sz);
+    2706:	83 ec 04             	sub    $0x4,%esp
+    2709:	56                   	push   %esi
+    270a:	68 80 8a 00 00       	push   $0x8a80
+    270f:	57                   	push   %edi
+    2710:	e8 38 15 00 00       	call   3c4d <write>
+      if(cc != sz){
+    2715:	83 c4 10             	add    $0x10,%esp
+    2718:	39 c6                	cmp    %eax,%esi
+    271a:	75 8c                	jne    26a8 <bigwrite+0x3f>
+    for(i = 0; i < 2; i++){
+    271c:	83 c3 01             	add    $0x1,%ebx
+    271f:	eb e0                	jmp    2701 <bigwrite+0x98>
+  }
+
+  printf(1, "bigwrite ok\n");
+    2721:	83 ec 08             	sub    $0x8,%esp
+    2724:	68 4d 4c 00 00       	push   $0x4c4d
+    2729:	6a 01                	push   $0x1
+    272b:	e8 a2 16 00 00       	call   3dd2 <printf>
+}
+    2730:	83 c4 10             	add    $0x10,%esp
+    2733:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2736:	5b                   	pop    %ebx
+    2737:	5e                   	pop    %esi
+    2738:	5f                   	pop    %edi
+    2739:	5d                   	pop    %ebp
+    273a:	c3                   	ret
+
+0000273b <bigfile>:
+
+void
+bigfile(void)
+{
+    273b:	55                   	push   %ebp
+    273c:	89 e5                	mov    %esp,%ebp
+    273e:	57                   	push   %edi
+    273f:	56                   	push   %esi
+    2740:	53                   	push   %ebx
+    2741:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    2744:	68 5a 4c 00 00       	push   $0x4c5a
+    2749:	6a 01                	push   $0x1
+    274b:	e8 82 16 00 00       	call   3dd2 <printf>
+
+  unlink("bigfile");
+    2750:	c7 04 24 76 4c 00 00 	movl   $0x4c76,(%esp)
+    2757:	e8 21 15 00 00       	call   3c7d <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    275c:	83 c4 08             	add    $0x8,%esp
+    275f:	68 02 02 00 00       	push   $0x202
+    2764:	68 76 4c 00 00       	push   $0x4c76
+    2769:	e8 ff 14 00 00       	call   3c6d <open>
+  if(fd < 0){
+    276e:	83 c4 10             	add    $0x10,%esp
+    2771:	85 c0                	test   %eax,%eax
+    2773:	78 41                	js     27b6 <bigfile+0x7b>
+    2775:	89 c6                	mov    %eax,%esi
+    printf(1, "cannot create bigfile");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    2777:	bb 00 00 00 00       	mov    $0x0,%ebx
+    277c:	83 fb 13             	cmp    $0x13,%ebx
+    277f:	7f 5d                	jg     27de <bigfile+0xa3>
+    memset(buf, i, 600);
+    2781:	83 ec 04             	sub    $0x4,%esp
+    2784:	68 58 02 00 00       	push   $0x258
+    2789:	53                   	push   %ebx
+    278a:	68 80 8a 00 00       	push   $0x8a80
+    278f:	e8 99 12 00 00       	call   3a2d <memset>
+    if(write(fd, buf, 600) != 600){
+    2794:	83 c4 0c             	add    $0xc,%esp
+    2797:	68 58 02 00 00       	push   $0x258
+    279c:	68 80 8a 00 00       	push   $0x8a80
+    27a1:	56                   	push   %esi
+    27a2:	e8 a6 14 00 00       	call   3c4d <write>
+    27a7:	83 c4 10             	add    $0x10,%esp
+    27aa:	3d 58 02 00 00       	cmp    $0x258,%eax
+    27af:	75 19                	jne    27ca <bigfile+0x8f>
+  for(i = 0; i < 20; i++){
+    27b1:	83 c3 01             	add    $0x1,%ebx
+    27b4:	eb c6                	jmp    277c <bigfile+0x41>
+    printf(1, "cannot create bigfile");
+    27b6:	83 ec 08             	sub    $0x8,%esp
+    27b9:	68 68 4c 00 00       	push   $0x4c68
+    27be:	6a 01                	push   $0x1
+    27c0:	e8 0d 16 00 00       	call   3dd2 <printf>
+    exit();
+    27c5:	e8 63 14 00 00       	call   3c2d <exit>
+      printf(1, "write bigfile failed\n");
+    27ca:	83 ec 08             	sub    $0x8,%esp
+    27cd:	68 7e 4c 00 00       	push   $0x4c7e
+    27d2:	6a 01                	push   $0x1
+    27d4:	e8 f9 15 00 00       	call   3dd2 <printf>
+      exit();
+    27d9:	e8 4f 14 00 00       	call   3c2d <exit>
+    }
+  }
+  close(fd);
+    27de:	83 ec 0c             	sub    $0xc,%esp
+    27e1:	56                   	push   %esi
+    27e2:	e8 6e 14 00 00       	call   3c55 <close>
+
+  fd = open("bigfile", 0);
+    27e7:	83 c4 08             	add    $0x8,%esp
+    27ea:	6a 00                	push   $0x0
+    27ec:	68 76 4c 00 00       	push   $0x4c76
+    27f1:	e8 77 14 00 00       	call   3c6d <open>
+    27f6:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    27f8:	83 c4 10             	add    $0x10,%esp
+    27fb:	85 c0                	test   %eax,%eax
+    27fd:	78 53                	js     2852 <bigfile+0x117>
+    printf(1, "cannot open bigfile\n");
+    exit();
+  }
+  total = 0;
+    27ff:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; ; i++){
+    2804:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(fd, buf, 300);
+    2809:	83 ec 04             	sub    $0x4,%esp
+    280c:	68 2c 01 00 00       	push   $0x12c
+    2811:	68 80 8a 00 00       	push   $0x8a80
+    2816:	57                   	push   %edi
+    2817:	e8 29 14 00 00       	call   3c45 <read>
+    if(cc < 0){
+    281c:	83 c4 10             	add    $0x10,%esp
+    281f:	85 c0                	test   %eax,%eax
+    2821:	78 43                	js     2866 <bigfile+0x12b>
+      printf(1, "read bigfile failed\n");
+      exit();
+    }
+    if(cc == 0)
+    2823:	74 7d                	je     28a2 <bigfile+0x167>
+      break;
+    if(cc != 300){
+    2825:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    282a:	75 4e                	jne    287a <bigfile+0x13f>
+      printf(1, "short read bigfile\n");
+      exit();
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    282c:	0f be 0d 80 8a 00 00 	movsbl 0x8a80,%ecx
+    2833:	89 da                	mov    %ebx,%edx
+    2835:	c1 ea 1f             	shr    $0x1f,%edx
+    2838:	01 da                	add    %ebx,%edx
+    283a:	d1 fa                	sar    %edx
+    283c:	39 d1                	cmp    %edx,%ecx
+    283e:	75 4e                	jne    288e <bigfile+0x153>
+    2840:	0f be 0d ab 8b 00 00 	movsbl 0x8bab,%ecx
+    2847:	39 ca                	cmp    %ecx,%edx
+    2849:	75 43                	jne    288e <bigfile+0x153>
+      printf(1, "read bigfile wrong data\n");
+      exit();
+    }
+    total += cc;
+    284b:	01 c6                	add    %eax,%esi
+  for(i = 0; ; i++){
+    284d:	83 c3 01             	add    $0x1,%ebx
+    cc = read(fd, buf, 300);
+    2850:	eb b7                	jmp    2809 <bigfile+0xce>
+    printf(1, "cannot open bigfile\n");
+    2852:	83 ec 08             	sub    $0x8,%esp
+    2855:	68 94 4c 00 00       	push   $0x4c94
+    285a:	6a 01                	push   $0x1
+    285c:	e8 71 15 00 00       	call   3dd2 <printf>
+    exit();
+    2861:	e8 c7 13 00 00       	call   3c2d <exit>
+      printf(1, "read bigfile failed\n");
+    2866:	83 ec 08             	sub    $0x8,%esp
+    2869:	68 a9 4c 00 00       	push   $0x4ca9
+    286e:	6a 01                	push   $0x1
+    2870:	e8 5d 15 00 00       	call   3dd2 <printf>
+      exit();
+    2875:	e8 b3 13 00 00       	call   3c2d <exit>
+      printf(1, "short read bigfile\n");
+    287a:	83 ec 08             	sub    $0x8,%esp
+    287d:	68 be 4c 00 00       	push   $0x4cbe
+    2882:	6a 01                	push   $0x1
+    2884:	e8 49 15 00 00       	call   3dd2 <printf>
+      exit();
+    2889:	e8 9f 13 00 00       	call   3c2d <exit>
+      printf(1, "read bigfile wrong data\n");
+    288e:	83 ec 08             	sub    $0x8,%esp
+    2891:	68 d2 4c 00 00       	push   $0x4cd2
+    2896:	6a 01                	push   $0x1
+    2898:	e8 35 15 00 00       	call   3dd2 <printf>
+      exit();
+    289d:	e8 8b 13 00 00       	call   3c2d <exit>
+  }
+  close(fd);
+    28a2:	83 ec 0c             	sub    $0xc,%esp
+    28a5:	57                   	push   %edi
+    28a6:	e8 aa 13 00 00       	call   3c55 <close>
+  if(total != 20*600){
+    28ab:	83 c4 10             	add    $0x10,%esp
+    28ae:	81 fe e0 2e 00 00    	cmp    $0x2ee0,%esi
+    28b4:	75 27                	jne    28dd <bigfile+0x1a2>
+    printf(1, "read bigfile wrong total\n");
+    exit();
+  }
+  unlink("bigfile");
+    28b6:	83 ec 0c             	sub    $0xc,%esp
+    28b9:	68 76 4c 00 00       	push   $0x4c76
+    28be:	e8 ba 13 00 00       	call   3c7d <unlink>
+
+  printf(1, "bigfile test ok\n");
+    28c3:	83 c4 08             	add    $0x8,%esp
+    28c6:	68 05 4d 00 00       	push   $0x4d05
+    28cb:	6a 01                	push   $0x1
+    28cd:	e8 00 15 00 00       	call   3dd2 <printf>
+}
+    28d2:	83 c4 10             	add    $0x10,%esp
+    28d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    28d8:	5b                   	pop    %ebx
+    28d9:	5e                   	pop    %esi
+    28da:	5f                   	pop    %edi
+    28db:	5d                   	pop    %ebp
+    28dc:	c3                   	ret
+    printf(1, "read bigfile wrong total\n");
+    28dd:	83 ec 08             	sub    $0x8,%esp
+    28e0:	68 eb 4c 00 00       	push   $0x4ceb
+    28e5:	6a 01                	push   $0x1
+    28e7:	e8 e6 14 00 00       	call   3dd2 <printf>
+    exit();
+    28ec:	e8 3c 13 00 00       	call   3c2d <exit>
+
+000028f1 <fourteen>:
+
+void
+fourteen(void)
+{
+    28f1:	55                   	push   %ebp
+    28f2:	89 e5                	mov    %esp,%ebp
+    28f4:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    28f7:	68 16 4d 00 00       	push   $0x4d16
+    28fc:	6a 01                	push   $0x1
+    28fe:	e8 cf 14 00 00       	call   3dd2 <printf>
+
+  if(mkdir("12345678901234") != 0){
+    2903:	c7 04 24 51 4d 00 00 	movl   $0x4d51,(%esp)
+    290a:	e8 86 13 00 00       	call   3c95 <mkdir>
+    290f:	83 c4 10             	add    $0x10,%esp
+    2912:	85 c0                	test   %eax,%eax
+    2914:	0f 85 9c 00 00 00    	jne    29b6 <fourteen+0xc5>
+    printf(1, "mkdir 12345678901234 failed\n");
+    exit();
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    291a:	83 ec 0c             	sub    $0xc,%esp
+    291d:	68 0c 55 00 00       	push   $0x550c
+    2922:	e8 6e 13 00 00       	call   3c95 <mkdir>
+    2927:	83 c4 10             	add    $0x10,%esp
+    292a:	85 c0                	test   %eax,%eax
+    292c:	0f 85 98 00 00 00    	jne    29ca <fourteen+0xd9>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    exit();
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2932:	83 ec 08             	sub    $0x8,%esp
+    2935:	68 00 02 00 00       	push   $0x200
+    293a:	68 5c 55 00 00       	push   $0x555c
+    293f:	e8 29 13 00 00       	call   3c6d <open>
+  if(fd < 0){
+    2944:	83 c4 10             	add    $0x10,%esp
+    2947:	85 c0                	test   %eax,%eax
+    2949:	0f 88 8f 00 00 00    	js     29de <fourteen+0xed>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    exit();
+  }
+  close(fd);
+    294f:	83 ec 0c             	sub    $0xc,%esp
+    2952:	50                   	push   %eax
+    2953:	e8 fd 12 00 00       	call   3c55 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2958:	83 c4 08             	add    $0x8,%esp
+    295b:	6a 00                	push   $0x0
+    295d:	68 cc 55 00 00       	push   $0x55cc
+    2962:	e8 06 13 00 00       	call   3c6d <open>
+  if(fd < 0){
+    2967:	83 c4 10             	add    $0x10,%esp
+    296a:	85 c0                	test   %eax,%eax
+    296c:	0f 88 80 00 00 00    	js     29f2 <fourteen+0x101>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    exit();
+  }
+  close(fd);
+    2972:	83 ec 0c             	sub    $0xc,%esp
+    2975:	50                   	push   %eax
+    2976:	e8 da 12 00 00       	call   3c55 <close>
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    297b:	c7 04 24 42 4d 00 00 	movl   $0x4d42,(%esp)
+    2982:	e8 0e 13 00 00       	call   3c95 <mkdir>
+    2987:	83 c4 10             	add    $0x10,%esp
+    298a:	85 c0                	test   %eax,%eax
+    298c:	74 78                	je     2a06 <fourteen+0x115>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    exit();
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    298e:	83 ec 0c             	sub    $0xc,%esp
+    2991:	68 68 56 00 00       	push   $0x5668
+    2996:	e8 fa 12 00 00       	call   3c95 <mkdir>
+    299b:	83 c4 10             	add    $0x10,%esp
+    299e:	85 c0                	test   %eax,%eax
+    29a0:	74 78                	je     2a1a <fourteen+0x129>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    exit();
+  }
+
+  printf(1, "fourteen ok\n");
+    29a2:	83 ec 08             	sub    $0x8,%esp
+    29a5:	68 60 4d 00 00       	push   $0x4d60
+    29aa:	6a 01                	push   $0x1
+    29ac:	e8 21 14 00 00       	call   3dd2 <printf>
+}
+    29b1:	83 c4 10             	add    $0x10,%esp
+    29b4:	c9                   	leave
+    29b5:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    29b6:	83 ec 08             	sub    $0x8,%esp
+    29b9:	68 25 4d 00 00       	push   $0x4d25
+    29be:	6a 01                	push   $0x1
+    29c0:	e8 0d 14 00 00       	call   3dd2 <printf>
+    exit();
+    29c5:	e8 63 12 00 00       	call   3c2d <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    29ca:	83 ec 08             	sub    $0x8,%esp
+    29cd:	68 2c 55 00 00       	push   $0x552c
+    29d2:	6a 01                	push   $0x1
+    29d4:	e8 f9 13 00 00       	call   3dd2 <printf>
+    exit();
+    29d9:	e8 4f 12 00 00       	call   3c2d <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    29de:	83 ec 08             	sub    $0x8,%esp
+    29e1:	68 8c 55 00 00       	push   $0x558c
+    29e6:	6a 01                	push   $0x1
+    29e8:	e8 e5 13 00 00       	call   3dd2 <printf>
+    exit();
+    29ed:	e8 3b 12 00 00       	call   3c2d <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    29f2:	83 ec 08             	sub    $0x8,%esp
+    29f5:	68 fc 55 00 00       	push   $0x55fc
+    29fa:	6a 01                	push   $0x1
+    29fc:	e8 d1 13 00 00       	call   3dd2 <printf>
+    exit();
+    2a01:	e8 27 12 00 00       	call   3c2d <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2a06:	83 ec 08             	sub    $0x8,%esp
+    2a09:	68 38 56 00 00       	push   $0x5638
+    2a0e:	6a 01                	push   $0x1
+    2a10:	e8 bd 13 00 00       	call   3dd2 <printf>
+    exit();
+    2a15:	e8 13 12 00 00       	call   3c2d <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2a1a:	83 ec 08             	sub    $0x8,%esp
+    2a1d:	68 88 56 00 00       	push   $0x5688
+    2a22:	6a 01                	push   $0x1
+    2a24:	e8 a9 13 00 00       	call   3dd2 <printf>
+    exit();
+    2a29:	e8 ff 11 00 00       	call   3c2d <exit>
+
+00002a2e <rmdot>:
+
+void
+rmdot(void)
+{
+    2a2e:	55                   	push   %ebp
+    2a2f:	89 e5                	mov    %esp,%ebp
+    2a31:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2a34:	68 6d 4d 00 00       	push   $0x4d6d
+    2a39:	6a 01                	push   $0x1
+    2a3b:	e8 92 13 00 00       	call   3dd2 <printf>
+  if(mkdir("dots") != 0){
+    2a40:	c7 04 24 79 4d 00 00 	movl   $0x4d79,(%esp)
+    2a47:	e8 49 12 00 00       	call   3c95 <mkdir>
+    2a4c:	83 c4 10             	add    $0x10,%esp
+    2a4f:	85 c0                	test   %eax,%eax
+    2a51:	0f 85 bc 00 00 00    	jne    2b13 <rmdot+0xe5>
+    printf(1, "mkdir dots failed\n");
+    exit();
+  }
+  if(chdir("dots") != 0){
+    2a57:	83 ec 0c             	sub    $0xc,%esp
+    2a5a:	68 79 4d 00 00       	push   $0x4d79
+    2a5f:	e8 39 12 00 00       	call   3c9d <chdir>
+    2a64:	83 c4 10             	add    $0x10,%esp
+    2a67:	85 c0                	test   %eax,%eax
+    2a69:	0f 85 b8 00 00 00    	jne    2b27 <rmdot+0xf9>
+    printf(1, "chdir dots failed\n");
+    exit();
+  }
+  if(unlink(".") == 0){
+    2a6f:	83 ec 0c             	sub    $0xc,%esp
+    2a72:	68 24 4a 00 00       	push   $0x4a24
+    2a77:	e8 01 12 00 00       	call   3c7d <unlink>
+    2a7c:	83 c4 10             	add    $0x10,%esp
+    2a7f:	85 c0                	test   %eax,%eax
+    2a81:	0f 84 b4 00 00 00    	je     2b3b <rmdot+0x10d>
+    printf(1, "rm . worked!\n");
+    exit();
+  }
+  if(unlink("..") == 0){
+    2a87:	83 ec 0c             	sub    $0xc,%esp
+    2a8a:	68 23 4a 00 00       	push   $0x4a23
+    2a8f:	e8 e9 11 00 00       	call   3c7d <unlink>
+    2a94:	83 c4 10             	add    $0x10,%esp
+    2a97:	85 c0                	test   %eax,%eax
+    2a99:	0f 84 b0 00 00 00    	je     2b4f <rmdot+0x121>
+    printf(1, "rm .. worked!\n");
+    exit();
+  }
+  if(chdir("/") != 0){
+    2a9f:	83 ec 0c             	sub    $0xc,%esp
+    2aa2:	68 14 41 00 00       	push   $0x4114
+    2aa7:	e8 f1 11 00 00       	call   3c9d <chdir>
+    2aac:	83 c4 10             	add    $0x10,%esp
+    2aaf:	85 c0                	test   %eax,%eax
+    2ab1:	0f 85 ac 00 00 00    	jne    2b63 <rmdot+0x135>
+    printf(1, "chdir / failed\n");
+    exit();
+  }
+  if(unlink("dots/.") == 0){
+    2ab7:	83 ec 0c             	sub    $0xc,%esp
+    2aba:	68 c1 4d 00 00       	push   $0x4dc1
+    2abf:	e8 b9 11 00 00       	call   3c7d <unlink>
+    2ac4:	83 c4 10             	add    $0x10,%esp
+    2ac7:	85 c0                	test   %eax,%eax
+    2ac9:	0f 84 a8 00 00 00    	je     2b77 <rmdot+0x149>
+    printf(1, "unlink dots/. worked!\n");
+    exit();
+  }
+  if(unlink("dots/..") == 0){
+    2acf:	83 ec 0c             	sub    $0xc,%esp
+    2ad2:	68 df 4d 00 00       	push   $0x4ddf
+    2ad7:	e8 a1 11 00 00       	call   3c7d <unlink>
+    2adc:	83 c4 10             	add    $0x10,%esp
+    2adf:	85 c0                	test   %eax,%eax
+    2ae1:	0f 84 a4 00 00 00    	je     2b8b <rmdot+0x15d>
+    printf(1, "unlink dots/.. worked!\n");
+    exit();
+  }
+  if(unlink("dots") != 0){
+    2ae7:	83 ec 0c             	sub    $0xc,%esp
+    2aea:	68 79 4d 00 00       	push   $0x4d79
+    2aef:	e8 89 11 00 00       	call   3c7d <unlink>
+    2af4:	83 c4 10             	add    $0x10,%esp
+    2af7:	85 c0                	test   %eax,%eax
+    2af9:	0f 85 a0 00 00 00    	jne    2b9f <rmdot+0x171>
+    printf(1, "unlink dots failed!\n");
+    exit();
+  }
+  printf(1, "rmdot ok\n");
+    2aff:	83 ec 08             	sub    $0x8,%esp
+    2b02:	68 14 4e 00 00       	push   $0x4e14
+    2b07:	6a 01                	push   $0x1
+    2b09:	e8 c4 12 00 00       	call   3dd2 <printf>
+}
+    2b0e:	83 c4 10             	add    $0x10,%esp
+    2b11:	c9                   	leave
+    2b12:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2b13:	83 ec 08             	sub    $0x8,%esp
+    2b16:	68 7e 4d 00 00       	push   $0x4d7e
+    2b1b:	6a 01                	push   $0x1
+    2b1d:	e8 b0 12 00 00       	call   3dd2 <printf>
+    exit();
+    2b22:	e8 06 11 00 00       	call   3c2d <exit>
+    printf(1, "chdir dots failed\n");
+    2b27:	83 ec 08             	sub    $0x8,%esp
+    2b2a:	68 91 4d 00 00       	push   $0x4d91
+    2b2f:	6a 01                	push   $0x1
+    2b31:	e8 9c 12 00 00       	call   3dd2 <printf>
+    exit();
+    2b36:	e8 f2 10 00 00       	call   3c2d <exit>
+    printf(1, "rm . worked!\n");
+    2b3b:	83 ec 08             	sub    $0x8,%esp
+    2b3e:	68 a4 4d 00 00       	push   $0x4da4
+    2b43:	6a 01                	push   $0x1
+    2b45:	e8 88 12 00 00       	call   3dd2 <printf>
+    exit();
+    2b4a:	e8 de 10 00 00       	call   3c2d <exit>
+    printf(1, "rm .. worked!\n");
+    2b4f:	83 ec 08             	sub    $0x8,%esp
+    2b52:	68 b2 4d 00 00       	push   $0x4db2
+    2b57:	6a 01                	push   $0x1
+    2b59:	e8 74 12 00 00       	call   3dd2 <printf>
+    exit();
+    2b5e:	e8 ca 10 00 00       	call   3c2d <exit>
+    printf(1, "chdir / failed\n");
+    2b63:	83 ec 08             	sub    $0x8,%esp
+    2b66:	68 16 41 00 00       	push   $0x4116
+    2b6b:	6a 01                	push   $0x1
+    2b6d:	e8 60 12 00 00       	call   3dd2 <printf>
+    exit();
+    2b72:	e8 b6 10 00 00       	call   3c2d <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2b77:	83 ec 08             	sub    $0x8,%esp
+    2b7a:	68 c8 4d 00 00       	push   $0x4dc8
+    2b7f:	6a 01                	push   $0x1
+    2b81:	e8 4c 12 00 00       	call   3dd2 <printf>
+    exit();
+    2b86:	e8 a2 10 00 00       	call   3c2d <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2b8b:	83 ec 08             	sub    $0x8,%esp
+    2b8e:	68 e7 4d 00 00       	push   $0x4de7
+    2b93:	6a 01                	push   $0x1
+    2b95:	e8 38 12 00 00       	call   3dd2 <printf>
+    exit();
+    2b9a:	e8 8e 10 00 00       	call   3c2d <exit>
+    printf(1, "unlink dots failed!\n");
+    2b9f:	83 ec 08             	sub    $0x8,%esp
+    2ba2:	68 ff 4d 00 00       	push   $0x4dff
+    2ba7:	6a 01                	push   $0x1
+    2ba9:	e8 24 12 00 00       	call   3dd2 <printf>
+    exit();
+    2bae:	e8 7a 10 00 00       	call   3c2d <exit>
+
+00002bb3 <dirfile>:
+
+void
+dirfile(void)
+{
+    2bb3:	55                   	push   %ebp
+    2bb4:	89 e5                	mov    %esp,%ebp
+    2bb6:	53                   	push   %ebx
+    2bb7:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    2bba:	68 1e 4e 00 00       	push   $0x4e1e
+    2bbf:	6a 01                	push   $0x1
+    2bc1:	e8 0c 12 00 00       	call   3dd2 <printf>
+
+  fd = open("dirfile", O_CREATE);
+    2bc6:	83 c4 08             	add    $0x8,%esp
+    2bc9:	68 00 02 00 00       	push   $0x200
+    2bce:	68 2b 4e 00 00       	push   $0x4e2b
+    2bd3:	e8 95 10 00 00       	call   3c6d <open>
+  if(fd < 0){
+    2bd8:	83 c4 10             	add    $0x10,%esp
+    2bdb:	85 c0                	test   %eax,%eax
+    2bdd:	0f 88 22 01 00 00    	js     2d05 <dirfile+0x152>
+    printf(1, "create dirfile failed\n");
+    exit();
+  }
+  close(fd);
+    2be3:	83 ec 0c             	sub    $0xc,%esp
+    2be6:	50                   	push   %eax
+    2be7:	e8 69 10 00 00       	call   3c55 <close>
+  if(chdir("dirfile") == 0){
+    2bec:	c7 04 24 2b 4e 00 00 	movl   $0x4e2b,(%esp)
+    2bf3:	e8 a5 10 00 00       	call   3c9d <chdir>
+    2bf8:	83 c4 10             	add    $0x10,%esp
+    2bfb:	85 c0                	test   %eax,%eax
+    2bfd:	0f 84 16 01 00 00    	je     2d19 <dirfile+0x166>
+    printf(1, "chdir dirfile succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", 0);
+    2c03:	83 ec 08             	sub    $0x8,%esp
+    2c06:	6a 00                	push   $0x0
+    2c08:	68 64 4e 00 00       	push   $0x4e64
+    2c0d:	e8 5b 10 00 00       	call   3c6d <open>
+  if(fd >= 0){
+    2c12:	83 c4 10             	add    $0x10,%esp
+    2c15:	85 c0                	test   %eax,%eax
+    2c17:	0f 89 10 01 00 00    	jns    2d2d <dirfile+0x17a>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    2c1d:	83 ec 08             	sub    $0x8,%esp
+    2c20:	68 00 02 00 00       	push   $0x200
+    2c25:	68 64 4e 00 00       	push   $0x4e64
+    2c2a:	e8 3e 10 00 00       	call   3c6d <open>
+  if(fd >= 0){
+    2c2f:	83 c4 10             	add    $0x10,%esp
+    2c32:	85 c0                	test   %eax,%eax
+    2c34:	0f 89 07 01 00 00    	jns    2d41 <dirfile+0x18e>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(mkdir("dirfile/xx") == 0){
+    2c3a:	83 ec 0c             	sub    $0xc,%esp
+    2c3d:	68 64 4e 00 00       	push   $0x4e64
+    2c42:	e8 4e 10 00 00       	call   3c95 <mkdir>
+    2c47:	83 c4 10             	add    $0x10,%esp
+    2c4a:	85 c0                	test   %eax,%eax
+    2c4c:	0f 84 03 01 00 00    	je     2d55 <dirfile+0x1a2>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile/xx") == 0){
+    2c52:	83 ec 0c             	sub    $0xc,%esp
+    2c55:	68 64 4e 00 00       	push   $0x4e64
+    2c5a:	e8 1e 10 00 00       	call   3c7d <unlink>
+    2c5f:	83 c4 10             	add    $0x10,%esp
+    2c62:	85 c0                	test   %eax,%eax
+    2c64:	0f 84 ff 00 00 00    	je     2d69 <dirfile+0x1b6>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(link("README", "dirfile/xx") == 0){
+    2c6a:	83 ec 08             	sub    $0x8,%esp
+    2c6d:	68 64 4e 00 00       	push   $0x4e64
+    2c72:	68 c8 4e 00 00       	push   $0x4ec8
+    2c77:	e8 11 10 00 00       	call   3c8d <link>
+    2c7c:	83 c4 10             	add    $0x10,%esp
+    2c7f:	85 c0                	test   %eax,%eax
+    2c81:	0f 84 f6 00 00 00    	je     2d7d <dirfile+0x1ca>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile") != 0){
+    2c87:	83 ec 0c             	sub    $0xc,%esp
+    2c8a:	68 2b 4e 00 00       	push   $0x4e2b
+    2c8f:	e8 e9 0f 00 00       	call   3c7d <unlink>
+    2c94:	83 c4 10             	add    $0x10,%esp
+    2c97:	85 c0                	test   %eax,%eax
+    2c99:	0f 85 f2 00 00 00    	jne    2d91 <dirfile+0x1de>
+    printf(1, "unlink dirfile failed!\n");
+    exit();
+  }
+
+  fd = open(".", O_RDWR);
+    2c9f:	83 ec 08             	sub    $0x8,%esp
+    2ca2:	6a 02                	push   $0x2
+    2ca4:	68 24 4a 00 00       	push   $0x4a24
+    2ca9:	e8 bf 0f 00 00       	call   3c6d <open>
+  if(fd >= 0){
+    2cae:	83 c4 10             	add    $0x10,%esp
+    2cb1:	85 c0                	test   %eax,%eax
+    2cb3:	0f 89 ec 00 00 00    	jns    2da5 <dirfile+0x1f2>
+    printf(1, "open . for writing succeeded!\n");
+    exit();
+  }
+  fd = open(".", 0);
+    2cb9:	83 ec 08             	sub    $0x8,%esp
+    2cbc:	6a 00                	push   $0x0
+    2cbe:	68 24 4a 00 00       	push   $0x4a24
+    2cc3:	e8 a5 0f 00 00       	call   3c6d <open>
+    2cc8:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2cca:	83 c4 0c             	add    $0xc,%esp
+    2ccd:	6a 01                	push   $0x1
+    2ccf:	68 07 4b 00 00       	push   $0x4b07
+    2cd4:	50                   	push   %eax
+    2cd5:	e8 73 0f 00 00       	call   3c4d <write>
+    2cda:	83 c4 10             	add    $0x10,%esp
+    2cdd:	85 c0                	test   %eax,%eax
+    2cdf:	0f 8f d4 00 00 00    	jg     2db9 <dirfile+0x206>
+    printf(1, "write . succeeded!\n");
+    exit();
+  }
+  close(fd);
+    2ce5:	83 ec 0c             	sub    $0xc,%esp
+    2ce8:	53                   	push   %ebx
+    2ce9:	e8 67 0f 00 00       	call   3c55 <close>
+
+  printf(1, "dir vs file OK\n");
+    2cee:	83 c4 08             	add    $0x8,%esp
+    2cf1:	68 fb 4e 00 00       	push   $0x4efb
+    2cf6:	6a 01                	push   $0x1
+    2cf8:	e8 d5 10 00 00       	call   3dd2 <printf>
+}
+    2cfd:	83 c4 10             	add    $0x10,%esp
+    2d00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d03:	c9                   	leave
+    2d04:	c3                   	ret
+    printf(1, "create dirfile failed\n");
+    2d05:	83 ec 08             	sub    $0x8,%esp
+    2d08:	68 33 4e 00 00       	push   $0x4e33
+    2d0d:	6a 01                	push   $0x1
+    2d0f:	e8 be 10 00 00       	call   3dd2 <printf>
+    exit();
+    2d14:	e8 14 0f 00 00       	call   3c2d <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2d19:	83 ec 08             	sub    $0x8,%esp
+    2d1c:	68 4a 4e 00 00       	push   $0x4e4a
+    2d21:	6a 01                	push   $0x1
+    2d23:	e8 aa 10 00 00       	call   3dd2 <printf>
+    exit();
+    2d28:	e8 00 0f 00 00       	call   3c2d <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    2d2d:	83 ec 08             	sub    $0x8,%esp
+    2d30:	68 6f 4e 00 00       	push   $0x4e6f
+    2d35:	6a 01                	push   $0x1
+    2d37:	e8 96 10 00 00       	call   3dd2 <printf>
+    exit();
+    2d3c:	e8 ec 0e 00 00       	call   3c2d <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    2d41:	83 ec 08             	sub    $0x8,%esp
+    2d44:	68 6f 4e 00 00       	push   $0x4e6f
+    2d49:	6a 01                	push   $0x1
+    2d4b:	e8 82 10 00 00       	call   3dd2 <printf>
+    exit();
+    2d50:	e8 d8 0e 00 00       	call   3c2d <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2d55:	83 ec 08             	sub    $0x8,%esp
+    2d58:	68 8d 4e 00 00       	push   $0x4e8d
+    2d5d:	6a 01                	push   $0x1
+    2d5f:	e8 6e 10 00 00       	call   3dd2 <printf>
+    exit();
+    2d64:	e8 c4 0e 00 00       	call   3c2d <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2d69:	83 ec 08             	sub    $0x8,%esp
+    2d6c:	68 aa 4e 00 00       	push   $0x4eaa
+    2d71:	6a 01                	push   $0x1
+    2d73:	e8 5a 10 00 00       	call   3dd2 <printf>
+    exit();
+    2d78:	e8 b0 0e 00 00       	call   3c2d <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2d7d:	83 ec 08             	sub    $0x8,%esp
+    2d80:	68 bc 56 00 00       	push   $0x56bc
+    2d85:	6a 01                	push   $0x1
+    2d87:	e8 46 10 00 00       	call   3dd2 <printf>
+    exit();
+    2d8c:	e8 9c 0e 00 00       	call   3c2d <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2d91:	83 ec 08             	sub    $0x8,%esp
+    2d94:	68 cf 4e 00 00       	push   $0x4ecf
+    2d99:	6a 01                	push   $0x1
+    2d9b:	e8 32 10 00 00       	call   3dd2 <printf>
+    exit();
+    2da0:	e8 88 0e 00 00       	call   3c2d <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2da5:	83 ec 08             	sub    $0x8,%esp
+    2da8:	68 dc 56 00 00       	push   $0x56dc
+    2dad:	6a 01                	push   $0x1
+    2daf:	e8 1e 10 00 00       	call   3dd2 <printf>
+    exit();
+    2db4:	e8 74 0e 00 00       	call   3c2d <exit>
+    printf(1, "write . succeeded!\n");
+    2db9:	83 ec 08             	sub    $0x8,%esp
+    2dbc:	68 e7 4e 00 00       	push   $0x4ee7
+    2dc1:	6a 01                	push   $0x1
+    2dc3:	e8 0a 10 00 00       	call   3dd2 <printf>
+    exit();
+    2dc8:	e8 60 0e 00 00       	call   3c2d <exit>
+
+00002dcd <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    2dcd:	55                   	push   %ebp
+    2dce:	89 e5                	mov    %esp,%ebp
+    2dd0:	53                   	push   %ebx
+    2dd1:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    2dd4:	68 0b 4f 00 00       	push   $0x4f0b
+    2dd9:	6a 01                	push   $0x1
+    2ddb:	e8 f2 0f 00 00       	call   3dd2 <printf>
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    2de0:	83 c4 10             	add    $0x10,%esp
+    2de3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2de8:	eb 4c                	jmp    2e36 <iref+0x69>
+    if(mkdir("irefd") != 0){
+      printf(1, "mkdir irefd failed\n");
+    2dea:	83 ec 08             	sub    $0x8,%esp
+    2ded:	68 22 4f 00 00       	push   $0x4f22
+    2df2:	6a 01                	push   $0x1
+    2df4:	e8 d9 0f 00 00       	call   3dd2 <printf>
+      exit();
+    2df9:	e8 2f 0e 00 00       	call   3c2d <exit>
+    }
+    if(chdir("irefd") != 0){
+      printf(1, "chdir irefd failed\n");
+    2dfe:	83 ec 08             	sub    $0x8,%esp
+    2e01:	68 36 4f 00 00       	push   $0x4f36
+    2e06:	6a 01                	push   $0x1
+    2e08:	e8 c5 0f 00 00       	call   3dd2 <printf>
+      exit();
+    2e0d:	e8 1b 0e 00 00       	call   3c2d <exit>
+
+    mkdir("");
+    link("README", "");
+    fd = open("", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    2e12:	83 ec 0c             	sub    $0xc,%esp
+    2e15:	50                   	push   %eax
+    2e16:	e8 3a 0e 00 00       	call   3c55 <close>
+    2e1b:	83 c4 10             	add    $0x10,%esp
+    2e1e:	e9 80 00 00 00       	jmp    2ea3 <iref+0xd6>
+    fd = open("xx", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    unlink("xx");
+    2e23:	83 ec 0c             	sub    $0xc,%esp
+    2e26:	68 06 4b 00 00       	push   $0x4b06
+    2e2b:	e8 4d 0e 00 00       	call   3c7d <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2e30:	83 c3 01             	add    $0x1,%ebx
+    2e33:	83 c4 10             	add    $0x10,%esp
+    2e36:	83 fb 32             	cmp    $0x32,%ebx
+    2e39:	0f 8f 92 00 00 00    	jg     2ed1 <iref+0x104>
+    if(mkdir("irefd") != 0){
+    2e3f:	83 ec 0c             	sub    $0xc,%esp
+    2e42:	68 1c 4f 00 00       	push   $0x4f1c
+    2e47:	e8 49 0e 00 00       	call   3c95 <mkdir>
+    2e4c:	83 c4 10             	add    $0x10,%esp
+    2e4f:	85 c0                	test   %eax,%eax
+    2e51:	75 97                	jne    2dea <iref+0x1d>
+    if(chdir("irefd") != 0){
+    2e53:	83 ec 0c             	sub    $0xc,%esp
+    2e56:	68 1c 4f 00 00       	push   $0x4f1c
+    2e5b:	e8 3d 0e 00 00       	call   3c9d <chdir>
+    2e60:	83 c4 10             	add    $0x10,%esp
+    2e63:	85 c0                	test   %eax,%eax
+    2e65:	75 97                	jne    2dfe <iref+0x31>
+    mkdir("");
+    2e67:	83 ec 0c             	sub    $0xc,%esp
+    2e6a:	68 d1 45 00 00       	push   $0x45d1
+    2e6f:	e8 21 0e 00 00       	call   3c95 <mkdir>
+    link("README", "");
+    2e74:	83 c4 08             	add    $0x8,%esp
+    2e77:	68 d1 45 00 00       	push   $0x45d1
+    2e7c:	68 c8 4e 00 00       	push   $0x4ec8
+    2e81:	e8 07 0e 00 00       	call   3c8d <link>
+    fd = open("", O_CREATE);
+    2e86:	83 c4 08             	add    $0x8,%esp
+    2e89:	68 00 02 00 00       	push   $0x200
+    2e8e:	68 d1 45 00 00       	push   $0x45d1
+    2e93:	e8 d5 0d 00 00       	call   3c6d <open>
+    if(fd >= 0)
+    2e98:	83 c4 10             	add    $0x10,%esp
+    2e9b:	85 c0                	test   %eax,%eax
+    2e9d:	0f 89 6f ff ff ff    	jns    2e12 <iref+0x45>
+    fd = open("xx", O_CREATE);
+    2ea3:	83 ec 08             	sub    $0x8,%esp
+    2ea6:	68 00 02 00 00       	push   $0x200
+    2eab:	68 06 4b 00 00       	push   $0x4b06
+    2eb0:	e8 b8 0d 00 00       	call   3c6d <open>
+    if(fd >= 0)
+    2eb5:	83 c4 10             	add    $0x10,%esp
+    2eb8:	85 c0                	test   %eax,%eax
+    2eba:	0f 88 63 ff ff ff    	js     2e23 <iref+0x56>
+      close(fd);
+    2ec0:	83 ec 0c             	sub    $0xc,%esp
+    2ec3:	50                   	push   %eax
+    2ec4:	e8 8c 0d 00 00       	call   3c55 <close>
+    2ec9:	83 c4 10             	add    $0x10,%esp
+    2ecc:	e9 52 ff ff ff       	jmp    2e23 <iref+0x56>
+  }
+
+  chdir("/");
+    2ed1:	83 ec 0c             	sub    $0xc,%esp
+    2ed4:	68 14 41 00 00       	push   $0x4114
+    2ed9:	e8 bf 0d 00 00       	call   3c9d <chdir>
+  printf(1, "empty file name OK\n");
+    2ede:	83 c4 08             	add    $0x8,%esp
+    2ee1:	68 4a 4f 00 00       	push   $0x4f4a
+    2ee6:	6a 01                	push   $0x1
+    2ee8:	e8 e5 0e 00 00       	call   3dd2 <printf>
+}
+    2eed:	83 c4 10             	add    $0x10,%esp
+    2ef0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2ef3:	c9                   	leave
+    2ef4:	c3                   	ret
+
+00002ef5 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    2ef5:	55                   	push   %ebp
+    2ef6:	89 e5                	mov    %esp,%ebp
+    2ef8:	53                   	push   %ebx
+    2ef9:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    2efc:	68 5e 4f 00 00       	push   $0x4f5e
+    2f01:	6a 01                	push   $0x1
+    2f03:	e8 ca 0e 00 00       	call   3dd2 <printf>
+
+  for(n=0; n<1000; n++){
+    2f08:	83 c4 10             	add    $0x10,%esp
+    2f0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2f10:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+    2f16:	7f 15                	jg     2f2d <forktest+0x38>
+    pid = fork();
+    2f18:	e8 08 0d 00 00       	call   3c25 <fork>
+    if(pid < 0)
+    2f1d:	85 c0                	test   %eax,%eax
+    2f1f:	78 0c                	js     2f2d <forktest+0x38>
+      break;
+    if(pid == 0)
+    2f21:	74 05                	je     2f28 <forktest+0x33>
+  for(n=0; n<1000; n++){
+    2f23:	83 c3 01             	add    $0x1,%ebx
+    2f26:	eb e8                	jmp    2f10 <forktest+0x1b>
+      exit();
+    2f28:	e8 00 0d 00 00       	call   3c2d <exit>
+  }
+
+  if(n == 1000){
+    2f2d:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2f33:	74 12                	je     2f47 <forktest+0x52>
+    printf(1, "fork claimed to work 1000 times!\n");
+    exit();
+  }
+
+  for(; n > 0; n--){
+    2f35:	85 db                	test   %ebx,%ebx
+    2f37:	7e 36                	jle    2f6f <forktest+0x7a>
+    if(wait() < 0){
+    2f39:	e8 f7 0c 00 00       	call   3c35 <wait>
+    2f3e:	85 c0                	test   %eax,%eax
+    2f40:	78 19                	js     2f5b <forktest+0x66>
+  for(; n > 0; n--){
+    2f42:	83 eb 01             	sub    $0x1,%ebx
+    2f45:	eb ee                	jmp    2f35 <forktest+0x40>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2f47:	83 ec 08             	sub    $0x8,%esp
+    2f4a:	68 fc 56 00 00       	push   $0x56fc
+    2f4f:	6a 01                	push   $0x1
+    2f51:	e8 7c 0e 00 00       	call   3dd2 <printf>
+    exit();
+    2f56:	e8 d2 0c 00 00       	call   3c2d <exit>
+      printf(1, "wait stopped early\n");
+    2f5b:	83 ec 08             	sub    $0x8,%esp
+    2f5e:	68 69 4f 00 00       	push   $0x4f69
+    2f63:	6a 01                	push   $0x1
+    2f65:	e8 68 0e 00 00       	call   3dd2 <printf>
+      exit();
+    2f6a:	e8 be 0c 00 00       	call   3c2d <exit>
+    }
+  }
+
+  if(wait() != -1){
+    2f6f:	e8 c1 0c 00 00       	call   3c35 <wait>
+    2f74:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f77:	75 17                	jne    2f90 <forktest+0x9b>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+    2f79:	83 ec 08             	sub    $0x8,%esp
+    2f7c:	68 90 4f 00 00       	push   $0x4f90
+    2f81:	6a 01                	push   $0x1
+    2f83:	e8 4a 0e 00 00       	call   3dd2 <printf>
+}
+    2f88:	83 c4 10             	add    $0x10,%esp
+    2f8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2f8e:	c9                   	leave
+    2f8f:	c3                   	ret
+    printf(1, "wait got too many\n");
+    2f90:	83 ec 08             	sub    $0x8,%esp
+    2f93:	68 7d 4f 00 00       	push   $0x4f7d
+    2f98:	6a 01                	push   $0x1
+    2f9a:	e8 33 0e 00 00       	call   3dd2 <printf>
+    exit();
+    2f9f:	e8 89 0c 00 00       	call   3c2d <exit>
+
+00002fa4 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    2fa4:	55                   	push   %ebp
+    2fa5:	89 e5                	mov    %esp,%ebp
+    2fa7:	57                   	push   %edi
+    2fa8:	56                   	push   %esi
+    2fa9:	53                   	push   %ebx
+    2faa:	83 ec 54             	sub    $0x54,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    2fad:	68 9e 4f 00 00       	push   $0x4f9e
+    2fb2:	ff 35 3c 63 00 00    	push   0x633c
+    2fb8:	e8 15 0e 00 00       	call   3dd2 <printf>
+  oldbrk = sbrk(0);
+    2fbd:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2fc4:	e8 ec 0c 00 00       	call   3cb5 <sbrk>
+    2fc9:	89 c7                	mov    %eax,%edi
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    2fcb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2fd2:	e8 de 0c 00 00       	call   3cb5 <sbrk>
+    2fd7:	89 c6                	mov    %eax,%esi
+  int i;
+  for(i = 0; i < 5000; i++){
+    2fd9:	83 c4 10             	add    $0x10,%esp
+    2fdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2fe1:	81 fb 87 13 00 00    	cmp    $0x1387,%ebx
+    2fe7:	7f 3a                	jg     3023 <sbrktest+0x7f>
+    b = sbrk(1);
+    2fe9:	83 ec 0c             	sub    $0xc,%esp
+    2fec:	6a 01                	push   $0x1
+    2fee:	e8 c2 0c 00 00       	call   3cb5 <sbrk>
+    if(b != a){
+    2ff3:	83 c4 10             	add    $0x10,%esp
+    2ff6:	39 c6                	cmp    %eax,%esi
+    2ff8:	75 0b                	jne    3005 <sbrktest+0x61>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      exit();
+    }
+    *b = 1;
+    2ffa:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    2ffd:	8d 70 01             	lea    0x1(%eax),%esi
+  for(i = 0; i < 5000; i++){
+    3000:	83 c3 01             	add    $0x1,%ebx
+    3003:	eb dc                	jmp    2fe1 <sbrktest+0x3d>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3005:	83 ec 0c             	sub    $0xc,%esp
+    3008:	50                   	push   %eax
+    3009:	56                   	push   %esi
+    300a:	53                   	push   %ebx
+    300b:	68 a9 4f 00 00       	push   $0x4fa9
+    3010:	ff 35 3c 63 00 00    	push   0x633c
+    3016:	e8 b7 0d 00 00       	call   3dd2 <printf>
+      exit();
+    301b:	83 c4 20             	add    $0x20,%esp
+    301e:	e8 0a 0c 00 00       	call   3c2d <exit>
+  }
+  pid = fork();
+    3023:	e8 fd 0b 00 00       	call   3c25 <fork>
+    3028:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    302a:	85 c0                	test   %eax,%eax
+    302c:	0f 88 53 01 00 00    	js     3185 <sbrktest+0x1e1>
+    printf(stdout, "sbrk test fork failed\n");
+    exit();
+  }
+  c = sbrk(1);
+    3032:	83 ec 0c             	sub    $0xc,%esp
+    3035:	6a 01                	push   $0x1
+    3037:	e8 79 0c 00 00       	call   3cb5 <sbrk>
+  c = sbrk(1);
+    303c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3043:	e8 6d 0c 00 00       	call   3cb5 <sbrk>
+  if(c != a + 1){
+    3048:	83 c6 01             	add    $0x1,%esi
+    304b:	83 c4 10             	add    $0x10,%esp
+    304e:	39 c6                	cmp    %eax,%esi
+    3050:	0f 85 47 01 00 00    	jne    319d <sbrktest+0x1f9>
+    printf(stdout, "sbrk test failed post-fork\n");
+    exit();
+  }
+  if(pid == 0)
+    3056:	85 db                	test   %ebx,%ebx
+    3058:	0f 84 57 01 00 00    	je     31b5 <sbrktest+0x211>
+    exit();
+  wait();
+    305e:	e8 d2 0b 00 00       	call   3c35 <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    3063:	83 ec 0c             	sub    $0xc,%esp
+    3066:	6a 00                	push   $0x0
+    3068:	e8 48 0c 00 00       	call   3cb5 <sbrk>
+    306d:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    306f:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3074:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    3076:	89 04 24             	mov    %eax,(%esp)
+    3079:	e8 37 0c 00 00       	call   3cb5 <sbrk>
+  if (p != a) {
+    307e:	83 c4 10             	add    $0x10,%esp
+    3081:	39 c3                	cmp    %eax,%ebx
+    3083:	0f 85 31 01 00 00    	jne    31ba <sbrktest+0x216>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    exit();
+  }
+  lastaddr = (char*) (BIG-1);
+  *lastaddr = 99;
+    3089:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+
+  // can one de-allocate?
+  a = sbrk(0);
+    3090:	83 ec 0c             	sub    $0xc,%esp
+    3093:	6a 00                	push   $0x0
+    3095:	e8 1b 0c 00 00       	call   3cb5 <sbrk>
+    309a:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    309c:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+    30a3:	e8 0d 0c 00 00       	call   3cb5 <sbrk>
+  if(c == (char*)0xffffffff){
+    30a8:	83 c4 10             	add    $0x10,%esp
+    30ab:	83 f8 ff             	cmp    $0xffffffff,%eax
+    30ae:	0f 84 1e 01 00 00    	je     31d2 <sbrktest+0x22e>
+    printf(stdout, "sbrk could not deallocate\n");
+    exit();
+  }
+  c = sbrk(0);
+    30b4:	83 ec 0c             	sub    $0xc,%esp
+    30b7:	6a 00                	push   $0x0
+    30b9:	e8 f7 0b 00 00       	call   3cb5 <sbrk>
+  if(c != a - 4096){
+    30be:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    30c4:	83 c4 10             	add    $0x10,%esp
+    30c7:	39 c2                	cmp    %eax,%edx
+    30c9:	0f 85 1b 01 00 00    	jne    31ea <sbrktest+0x246>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    30cf:	83 ec 0c             	sub    $0xc,%esp
+    30d2:	6a 00                	push   $0x0
+    30d4:	e8 dc 0b 00 00       	call   3cb5 <sbrk>
+    30d9:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    30db:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    30e2:	e8 ce 0b 00 00       	call   3cb5 <sbrk>
+    30e7:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    30e9:	83 c4 10             	add    $0x10,%esp
+    30ec:	39 c3                	cmp    %eax,%ebx
+    30ee:	0f 85 0d 01 00 00    	jne    3201 <sbrktest+0x25d>
+    30f4:	83 ec 0c             	sub    $0xc,%esp
+    30f7:	6a 00                	push   $0x0
+    30f9:	e8 b7 0b 00 00       	call   3cb5 <sbrk>
+    30fe:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3104:	83 c4 10             	add    $0x10,%esp
+    3107:	39 c2                	cmp    %eax,%edx
+    3109:	0f 85 f2 00 00 00    	jne    3201 <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    exit();
+  }
+  if(*lastaddr == 99){
+    310f:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    3116:	0f 84 fc 00 00 00    	je     3218 <sbrktest+0x274>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    exit();
+  }
+
+  a = sbrk(0);
+    311c:	83 ec 0c             	sub    $0xc,%esp
+    311f:	6a 00                	push   $0x0
+    3121:	e8 8f 0b 00 00       	call   3cb5 <sbrk>
+    3126:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3128:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    312f:	e8 81 0b 00 00       	call   3cb5 <sbrk>
+    3134:	89 c2                	mov    %eax,%edx
+    3136:	89 f8                	mov    %edi,%eax
+    3138:	29 d0                	sub    %edx,%eax
+    313a:	89 04 24             	mov    %eax,(%esp)
+    313d:	e8 73 0b 00 00       	call   3cb5 <sbrk>
+  if(c != a){
+    3142:	83 c4 10             	add    $0x10,%esp
+    3145:	39 c3                	cmp    %eax,%ebx
+    3147:	0f 85 e3 00 00 00    	jne    3230 <sbrktest+0x28c>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    314d:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3152:	81 fb 7f 84 1e 80    	cmp    $0x801e847f,%ebx
+    3158:	0f 87 23 01 00 00    	ja     3281 <sbrktest+0x2dd>
+    ppid = getpid();
+    315e:	e8 4a 0b 00 00       	call   3cad <getpid>
+    3163:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3165:	e8 bb 0a 00 00       	call   3c25 <fork>
+    if(pid < 0){
+    316a:	85 c0                	test   %eax,%eax
+    316c:	0f 88 d5 00 00 00    	js     3247 <sbrktest+0x2a3>
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    3172:	0f 84 e7 00 00 00    	je     325f <sbrktest+0x2bb>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+      kill(ppid);
+      exit();
+    }
+    wait();
+    3178:	e8 b8 0a 00 00       	call   3c35 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    317d:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3183:	eb cd                	jmp    3152 <sbrktest+0x1ae>
+    printf(stdout, "sbrk test fork failed\n");
+    3185:	83 ec 08             	sub    $0x8,%esp
+    3188:	68 c4 4f 00 00       	push   $0x4fc4
+    318d:	ff 35 3c 63 00 00    	push   0x633c
+    3193:	e8 3a 0c 00 00       	call   3dd2 <printf>
+    exit();
+    3198:	e8 90 0a 00 00       	call   3c2d <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    319d:	83 ec 08             	sub    $0x8,%esp
+    31a0:	68 db 4f 00 00       	push   $0x4fdb
+    31a5:	ff 35 3c 63 00 00    	push   0x633c
+    31ab:	e8 22 0c 00 00       	call   3dd2 <printf>
+    exit();
+    31b0:	e8 78 0a 00 00       	call   3c2d <exit>
+    exit();
+    31b5:	e8 73 0a 00 00       	call   3c2d <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    31ba:	83 ec 08             	sub    $0x8,%esp
+    31bd:	68 20 57 00 00       	push   $0x5720
+    31c2:	ff 35 3c 63 00 00    	push   0x633c
+    31c8:	e8 05 0c 00 00       	call   3dd2 <printf>
+    exit();
+    31cd:	e8 5b 0a 00 00       	call   3c2d <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    31d2:	83 ec 08             	sub    $0x8,%esp
+    31d5:	68 f7 4f 00 00       	push   $0x4ff7
+    31da:	ff 35 3c 63 00 00    	push   0x633c
+    31e0:	e8 ed 0b 00 00       	call   3dd2 <printf>
+    exit();
+    31e5:	e8 43 0a 00 00       	call   3c2d <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    31ea:	50                   	push   %eax
+    31eb:	53                   	push   %ebx
+    31ec:	68 60 57 00 00       	push   $0x5760
+    31f1:	ff 35 3c 63 00 00    	push   0x633c
+    31f7:	e8 d6 0b 00 00       	call   3dd2 <printf>
+    exit();
+    31fc:	e8 2c 0a 00 00       	call   3c2d <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3201:	56                   	push   %esi
+    3202:	53                   	push   %ebx
+    3203:	68 98 57 00 00       	push   $0x5798
+    3208:	ff 35 3c 63 00 00    	push   0x633c
+    320e:	e8 bf 0b 00 00       	call   3dd2 <printf>
+    exit();
+    3213:	e8 15 0a 00 00       	call   3c2d <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3218:	83 ec 08             	sub    $0x8,%esp
+    321b:	68 c0 57 00 00       	push   $0x57c0
+    3220:	ff 35 3c 63 00 00    	push   0x633c
+    3226:	e8 a7 0b 00 00       	call   3dd2 <printf>
+    exit();
+    322b:	e8 fd 09 00 00       	call   3c2d <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3230:	50                   	push   %eax
+    3231:	53                   	push   %ebx
+    3232:	68 f0 57 00 00       	push   $0x57f0
+    3237:	ff 35 3c 63 00 00    	push   0x633c
+    323d:	e8 90 0b 00 00       	call   3dd2 <printf>
+    exit();
+    3242:	e8 e6 09 00 00       	call   3c2d <exit>
+      printf(stdout, "fork failed\n");
+    3247:	83 ec 08             	sub    $0x8,%esp
+    324a:	68 ef 50 00 00       	push   $0x50ef
+    324f:	ff 35 3c 63 00 00    	push   0x633c
+    3255:	e8 78 0b 00 00       	call   3dd2 <printf>
+      exit();
+    325a:	e8 ce 09 00 00       	call   3c2d <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    325f:	0f be 03             	movsbl (%ebx),%eax
+    3262:	50                   	push   %eax
+    3263:	53                   	push   %ebx
+    3264:	68 12 50 00 00       	push   $0x5012
+    3269:	ff 35 3c 63 00 00    	push   0x633c
+    326f:	e8 5e 0b 00 00       	call   3dd2 <printf>
+      kill(ppid);
+    3274:	89 34 24             	mov    %esi,(%esp)
+    3277:	e8 e1 09 00 00       	call   3c5d <kill>
+      exit();
+    327c:	e8 ac 09 00 00       	call   3c2d <exit>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    3281:	83 ec 0c             	sub    $0xc,%esp
+    3284:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    3287:	50                   	push   %eax
+    3288:	e8 b0 09 00 00       	call   3c3d <pipe>
+    328d:	89 c3                	mov    %eax,%ebx
+    328f:	83 c4 10             	add    $0x10,%esp
+    3292:	85 c0                	test   %eax,%eax
+    3294:	75 04                	jne    329a <sbrktest+0x2f6>
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3296:	89 c6                	mov    %eax,%esi
+    3298:	eb 59                	jmp    32f3 <sbrktest+0x34f>
+    printf(1, "pipe() failed\n");
+    329a:	83 ec 08             	sub    $0x8,%esp
+    329d:	68 04 44 00 00       	push   $0x4404
+    32a2:	6a 01                	push   $0x1
+    32a4:	e8 29 0b 00 00       	call   3dd2 <printf>
+    exit();
+    32a9:	e8 7f 09 00 00       	call   3c2d <exit>
+    if((pids[i] = fork()) == 0){
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    32ae:	83 ec 0c             	sub    $0xc,%esp
+    32b1:	6a 00                	push   $0x0
+    32b3:	e8 fd 09 00 00       	call   3cb5 <sbrk>
+    32b8:	89 c2                	mov    %eax,%edx
+    32ba:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    32bf:	29 d0                	sub    %edx,%eax
+    32c1:	89 04 24             	mov    %eax,(%esp)
+    32c4:	e8 ec 09 00 00       	call   3cb5 <sbrk>
+      write(fds[1], "x", 1);
+    32c9:	83 c4 0c             	add    $0xc,%esp
+    32cc:	6a 01                	push   $0x1
+    32ce:	68 07 4b 00 00       	push   $0x4b07
+    32d3:	ff 75 e4             	push   -0x1c(%ebp)
+    32d6:	e8 72 09 00 00       	call   3c4d <write>
+    32db:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    32de:	83 ec 0c             	sub    $0xc,%esp
+    32e1:	68 e8 03 00 00       	push   $0x3e8
+    32e6:	e8 d2 09 00 00       	call   3cbd <sleep>
+    32eb:	83 c4 10             	add    $0x10,%esp
+    32ee:	eb ee                	jmp    32de <sbrktest+0x33a>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    32f0:	83 c6 01             	add    $0x1,%esi
+    32f3:	83 fe 09             	cmp    $0x9,%esi
+    32f6:	77 28                	ja     3320 <sbrktest+0x37c>
+    if((pids[i] = fork()) == 0){
+    32f8:	e8 28 09 00 00       	call   3c25 <fork>
+    32fd:	89 44 b5 b8          	mov    %eax,-0x48(%ebp,%esi,4)
+    3301:	85 c0                	test   %eax,%eax
+    3303:	74 a9                	je     32ae <sbrktest+0x30a>
+    }
+    if(pids[i] != -1)
+    3305:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3308:	74 e6                	je     32f0 <sbrktest+0x34c>
+      read(fds[0], &scratch, 1);
+    330a:	83 ec 04             	sub    $0x4,%esp
+    330d:	6a 01                	push   $0x1
+    330f:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    3312:	50                   	push   %eax
+    3313:	ff 75 e0             	push   -0x20(%ebp)
+    3316:	e8 2a 09 00 00       	call   3c45 <read>
+    331b:	83 c4 10             	add    $0x10,%esp
+    331e:	eb d0                	jmp    32f0 <sbrktest+0x34c>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    3320:	83 ec 0c             	sub    $0xc,%esp
+    3323:	68 00 10 00 00       	push   $0x1000
+    3328:	e8 88 09 00 00       	call   3cb5 <sbrk>
+    332d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    332f:	83 c4 10             	add    $0x10,%esp
+    3332:	eb 03                	jmp    3337 <sbrktest+0x393>
+    3334:	83 c3 01             	add    $0x1,%ebx
+    3337:	83 fb 09             	cmp    $0x9,%ebx
+    333a:	77 1c                	ja     3358 <sbrktest+0x3b4>
+    if(pids[i] == -1)
+    333c:	8b 44 9d b8          	mov    -0x48(%ebp,%ebx,4),%eax
+    3340:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3343:	74 ef                	je     3334 <sbrktest+0x390>
+      continue;
+    kill(pids[i]);
+    3345:	83 ec 0c             	sub    $0xc,%esp
+    3348:	50                   	push   %eax
+    3349:	e8 0f 09 00 00       	call   3c5d <kill>
+    wait();
+    334e:	e8 e2 08 00 00       	call   3c35 <wait>
+    3353:	83 c4 10             	add    $0x10,%esp
+    3356:	eb dc                	jmp    3334 <sbrktest+0x390>
+  }
+  if(c == (char*)0xffffffff){
+    3358:	83 fe ff             	cmp    $0xffffffff,%esi
+    335b:	74 2f                	je     338c <sbrktest+0x3e8>
+    printf(stdout, "failed sbrk leaked memory\n");
+    exit();
+  }
+
+  if(sbrk(0) > oldbrk)
+    335d:	83 ec 0c             	sub    $0xc,%esp
+    3360:	6a 00                	push   $0x0
+    3362:	e8 4e 09 00 00       	call   3cb5 <sbrk>
+    3367:	83 c4 10             	add    $0x10,%esp
+    336a:	39 c7                	cmp    %eax,%edi
+    336c:	72 36                	jb     33a4 <sbrktest+0x400>
+    sbrk(-(sbrk(0) - oldbrk));
+
+  printf(stdout, "sbrk test OK\n");
+    336e:	83 ec 08             	sub    $0x8,%esp
+    3371:	68 46 50 00 00       	push   $0x5046
+    3376:	ff 35 3c 63 00 00    	push   0x633c
+    337c:	e8 51 0a 00 00       	call   3dd2 <printf>
+}
+    3381:	83 c4 10             	add    $0x10,%esp
+    3384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3387:	5b                   	pop    %ebx
+    3388:	5e                   	pop    %esi
+    3389:	5f                   	pop    %edi
+    338a:	5d                   	pop    %ebp
+    338b:	c3                   	ret
+    printf(stdout, "failed sbrk leaked memory\n");
+    338c:	83 ec 08             	sub    $0x8,%esp
+    338f:	68 2b 50 00 00       	push   $0x502b
+    3394:	ff 35 3c 63 00 00    	push   0x633c
+    339a:	e8 33 0a 00 00       	call   3dd2 <printf>
+    exit();
+    339f:	e8 89 08 00 00       	call   3c2d <exit>
+    sbrk(-(sbrk(0) - oldbrk));
+    33a4:	83 ec 0c             	sub    $0xc,%esp
+    33a7:	6a 00                	push   $0x0
+    33a9:	e8 07 09 00 00       	call   3cb5 <sbrk>
+    33ae:	29 c7                	sub    %eax,%edi
+    33b0:	89 3c 24             	mov    %edi,(%esp)
+    33b3:	e8 fd 08 00 00       	call   3cb5 <sbrk>
+    33b8:	83 c4 10             	add    $0x10,%esp
+    33bb:	eb b1                	jmp    336e <sbrktest+0x3ca>
+
+000033bd <validateint>:
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    33bd:	c3                   	ret
+
+000033be <validatetest>:
+
+void
+validatetest(void)
+{
+    33be:	55                   	push   %ebp
+    33bf:	89 e5                	mov    %esp,%ebp
+    33c1:	56                   	push   %esi
+    33c2:	53                   	push   %ebx
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    33c3:	83 ec 08             	sub    $0x8,%esp
+    33c6:	68 54 50 00 00       	push   $0x5054
+    33cb:	ff 35 3c 63 00 00    	push   0x633c
+    33d1:	e8 fc 09 00 00       	call   3dd2 <printf>
+  hi = 1100*1024;
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    33d6:	83 c4 10             	add    $0x10,%esp
+    33d9:	be 00 00 00 00       	mov    $0x0,%esi
+    33de:	81 fe 00 30 11 00    	cmp    $0x113000,%esi
+    33e4:	77 69                	ja     344f <validatetest+0x91>
+    if((pid = fork()) == 0){
+    33e6:	e8 3a 08 00 00       	call   3c25 <fork>
+    33eb:	89 c3                	mov    %eax,%ebx
+    33ed:	85 c0                	test   %eax,%eax
+    33ef:	74 41                	je     3432 <validatetest+0x74>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+      exit();
+    }
+    sleep(0);
+    33f1:	83 ec 0c             	sub    $0xc,%esp
+    33f4:	6a 00                	push   $0x0
+    33f6:	e8 c2 08 00 00       	call   3cbd <sleep>
+    sleep(0);
+    33fb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3402:	e8 b6 08 00 00       	call   3cbd <sleep>
+    kill(pid);
+    3407:	89 1c 24             	mov    %ebx,(%esp)
+    340a:	e8 4e 08 00 00       	call   3c5d <kill>
+    wait();
+    340f:	e8 21 08 00 00       	call   3c35 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    3414:	83 c4 08             	add    $0x8,%esp
+    3417:	56                   	push   %esi
+    3418:	68 63 50 00 00       	push   $0x5063
+    341d:	e8 6b 08 00 00       	call   3c8d <link>
+    3422:	83 c4 10             	add    $0x10,%esp
+    3425:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3428:	75 0d                	jne    3437 <validatetest+0x79>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    342a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3430:	eb ac                	jmp    33de <validatetest+0x20>
+      exit();
+    3432:	e8 f6 07 00 00       	call   3c2d <exit>
+      printf(stdout, "link should not succeed\n");
+    3437:	83 ec 08             	sub    $0x8,%esp
+    343a:	68 6e 50 00 00       	push   $0x506e
+    343f:	ff 35 3c 63 00 00    	push   0x633c
+    3445:	e8 88 09 00 00       	call   3dd2 <printf>
+      exit();
+    344a:	e8 de 07 00 00       	call   3c2d <exit>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    344f:	83 ec 08             	sub    $0x8,%esp
+    3452:	68 87 50 00 00       	push   $0x5087
+    3457:	ff 35 3c 63 00 00    	push   0x633c
+    345d:	e8 70 09 00 00       	call   3dd2 <printf>
+}
+    3462:	83 c4 10             	add    $0x10,%esp
+    3465:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3468:	5b                   	pop    %ebx
+    3469:	5e                   	pop    %esi
+    346a:	5d                   	pop    %ebp
+    346b:	c3                   	ret
+
+0000346c <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    346c:	55                   	push   %ebp
+    346d:	89 e5                	mov    %esp,%ebp
+    346f:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    3472:	68 94 50 00 00       	push   $0x5094
+    3477:	ff 35 3c 63 00 00    	push   0x633c
+    347d:	e8 50 09 00 00       	call   3dd2 <printf>
+  for(i = 0; i < sizeof(uninit); i++){
+    3482:	83 c4 10             	add    $0x10,%esp
+    3485:	b8 00 00 00 00       	mov    $0x0,%eax
+    348a:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    348f:	77 26                	ja     34b7 <bsstest+0x4b>
+    if(uninit[i] != '\0'){
+    3491:	80 b8 60 63 00 00 00 	cmpb   $0x0,0x6360(%eax)
+    3498:	75 05                	jne    349f <bsstest+0x33>
+  for(i = 0; i < sizeof(uninit); i++){
+    349a:	83 c0 01             	add    $0x1,%eax
+    349d:	eb eb                	jmp    348a <bsstest+0x1e>
+      printf(stdout, "bss test failed\n");
+    349f:	83 ec 08             	sub    $0x8,%esp
+    34a2:	68 9e 50 00 00       	push   $0x509e
+    34a7:	ff 35 3c 63 00 00    	push   0x633c
+    34ad:	e8 20 09 00 00       	call   3dd2 <printf>
+      exit();
+    34b2:	e8 76 07 00 00       	call   3c2d <exit>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    34b7:	83 ec 08             	sub    $0x8,%esp
+    34ba:	68 af 50 00 00       	push   $0x50af
+    34bf:	ff 35 3c 63 00 00    	push   0x633c
+    34c5:	e8 08 09 00 00       	call   3dd2 <printf>
+}
+    34ca:	83 c4 10             	add    $0x10,%esp
+    34cd:	c9                   	leave
+    34ce:	c3                   	ret
+
+000034cf <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    34cf:	55                   	push   %ebp
+    34d0:	89 e5                	mov    %esp,%ebp
+    34d2:	83 ec 14             	sub    $0x14,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    34d5:	68 bc 50 00 00       	push   $0x50bc
+    34da:	e8 9e 07 00 00       	call   3c7d <unlink>
+  pid = fork();
+    34df:	e8 41 07 00 00       	call   3c25 <fork>
+  if(pid == 0){
+    34e4:	83 c4 10             	add    $0x10,%esp
+    34e7:	85 c0                	test   %eax,%eax
+    34e9:	74 4d                	je     3538 <bigargtest+0x69>
+    exec("echo", args);
+    printf(stdout, "bigarg test ok\n");
+    fd = open("bigarg-ok", O_CREATE);
+    close(fd);
+    exit();
+  } else if(pid < 0){
+    34eb:	0f 88 ad 00 00 00    	js     359e <bigargtest+0xcf>
+    printf(stdout, "bigargtest: fork failed\n");
+    exit();
+  }
+  wait();
+    34f1:	e8 3f 07 00 00       	call   3c35 <wait>
+  fd = open("bigarg-ok", 0);
+    34f6:	83 ec 08             	sub    $0x8,%esp
+    34f9:	6a 00                	push   $0x0
+    34fb:	68 bc 50 00 00       	push   $0x50bc
+    3500:	e8 68 07 00 00       	call   3c6d <open>
+  if(fd < 0){
+    3505:	83 c4 10             	add    $0x10,%esp
+    3508:	85 c0                	test   %eax,%eax
+    350a:	0f 88 a6 00 00 00    	js     35b6 <bigargtest+0xe7>
+    printf(stdout, "bigarg test failed!\n");
+    exit();
+  }
+  close(fd);
+    3510:	83 ec 0c             	sub    $0xc,%esp
+    3513:	50                   	push   %eax
+    3514:	e8 3c 07 00 00       	call   3c55 <close>
+  unlink("bigarg-ok");
+    3519:	c7 04 24 bc 50 00 00 	movl   $0x50bc,(%esp)
+    3520:	e8 58 07 00 00       	call   3c7d <unlink>
+}
+    3525:	83 c4 10             	add    $0x10,%esp
+    3528:	c9                   	leave
+    3529:	c3                   	ret
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    352a:	c7 04 85 80 aa 00 00 	movl   $0x5814,0xaa80(,%eax,4)
+    3531:	14 58 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3535:	83 c0 01             	add    $0x1,%eax
+    3538:	83 f8 1e             	cmp    $0x1e,%eax
+    353b:	7e ed                	jle    352a <bigargtest+0x5b>
+    args[MAXARG-1] = 0;
+    353d:	c7 05 fc aa 00 00 00 	movl   $0x0,0xaafc
+    3544:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    3547:	83 ec 08             	sub    $0x8,%esp
+    354a:	68 c6 50 00 00       	push   $0x50c6
+    354f:	ff 35 3c 63 00 00    	push   0x633c
+    3555:	e8 78 08 00 00       	call   3dd2 <printf>
+    exec("echo", args);
+    355a:	83 c4 08             	add    $0x8,%esp
+    355d:	68 80 aa 00 00       	push   $0xaa80
+    3562:	68 b0 41 00 00       	push   $0x41b0
+    3567:	e8 f9 06 00 00       	call   3c65 <exec>
+    printf(stdout, "bigarg test ok\n");
+    356c:	83 c4 08             	add    $0x8,%esp
+    356f:	68 d3 50 00 00       	push   $0x50d3
+    3574:	ff 35 3c 63 00 00    	push   0x633c
+    357a:	e8 53 08 00 00       	call   3dd2 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    357f:	83 c4 08             	add    $0x8,%esp
+    3582:	68 00 02 00 00       	push   $0x200
+    3587:	68 bc 50 00 00       	push   $0x50bc
+    358c:	e8 dc 06 00 00       	call   3c6d <open>
+    close(fd);
+    3591:	89 04 24             	mov    %eax,(%esp)
+    3594:	e8 bc 06 00 00       	call   3c55 <close>
+    exit();
+    3599:	e8 8f 06 00 00       	call   3c2d <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    359e:	83 ec 08             	sub    $0x8,%esp
+    35a1:	68 e3 50 00 00       	push   $0x50e3
+    35a6:	ff 35 3c 63 00 00    	push   0x633c
+    35ac:	e8 21 08 00 00       	call   3dd2 <printf>
+    exit();
+    35b1:	e8 77 06 00 00       	call   3c2d <exit>
+    printf(stdout, "bigarg test failed!\n");
+    35b6:	83 ec 08             	sub    $0x8,%esp
+    35b9:	68 fc 50 00 00       	push   $0x50fc
+    35be:	ff 35 3c 63 00 00    	push   0x633c
+    35c4:	e8 09 08 00 00       	call   3dd2 <printf>
+    exit();
+    35c9:	e8 5f 06 00 00       	call   3c2d <exit>
+
+000035ce <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    35ce:	55                   	push   %ebp
+    35cf:	89 e5                	mov    %esp,%ebp
+    35d1:	57                   	push   %edi
+    35d2:	56                   	push   %esi
+    35d3:	53                   	push   %ebx
+    35d4:	83 ec 54             	sub    $0x54,%esp
+  int nfiles;
+  int fsblocks = 0;
+
+  printf(1, "fsfull test\n");
+    35d7:	68 11 51 00 00       	push   $0x5111
+    35dc:	6a 01                	push   $0x1
+    35de:	e8 ef 07 00 00       	call   3dd2 <printf>
+    35e3:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    35e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    char name[64];
+    name[0] = 'f';
+    35eb:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    35ef:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    35f4:	89 d8                	mov    %ebx,%eax
+    35f6:	f7 ea                	imul   %edx
+    35f8:	c1 fa 06             	sar    $0x6,%edx
+    35fb:	89 de                	mov    %ebx,%esi
+    35fd:	c1 fe 1f             	sar    $0x1f,%esi
+    3600:	29 f2                	sub    %esi,%edx
+    3602:	8d 42 30             	lea    0x30(%edx),%eax
+    3605:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3608:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    360e:	89 d9                	mov    %ebx,%ecx
+    3610:	29 d1                	sub    %edx,%ecx
+    3612:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    3617:	89 c8                	mov    %ecx,%eax
+    3619:	f7 ef                	imul   %edi
+    361b:	c1 fa 05             	sar    $0x5,%edx
+    361e:	c1 f9 1f             	sar    $0x1f,%ecx
+    3621:	29 ca                	sub    %ecx,%edx
+    3623:	83 c2 30             	add    $0x30,%edx
+    3626:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3629:	89 d8                	mov    %ebx,%eax
+    362b:	f7 ef                	imul   %edi
+    362d:	89 d7                	mov    %edx,%edi
+    362f:	c1 ff 05             	sar    $0x5,%edi
+    3632:	29 f7                	sub    %esi,%edi
+    3634:	6b c7 64             	imul   $0x64,%edi,%eax
+    3637:	89 df                	mov    %ebx,%edi
+    3639:	29 c7                	sub    %eax,%edi
+    363b:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    3640:	89 f8                	mov    %edi,%eax
+    3642:	f7 e9                	imul   %ecx
+    3644:	c1 fa 02             	sar    $0x2,%edx
+    3647:	c1 ff 1f             	sar    $0x1f,%edi
+    364a:	29 fa                	sub    %edi,%edx
+    364c:	83 c2 30             	add    $0x30,%edx
+    364f:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3652:	89 d8                	mov    %ebx,%eax
+    3654:	f7 e9                	imul   %ecx
+    3656:	c1 fa 02             	sar    $0x2,%edx
+    3659:	29 f2                	sub    %esi,%edx
+    365b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    365e:	01 c0                	add    %eax,%eax
+    3660:	89 da                	mov    %ebx,%edx
+    3662:	29 c2                	sub    %eax,%edx
+    3664:	83 c2 30             	add    $0x30,%edx
+    3667:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    366a:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    printf(1, "writing %s\n", name);
+    366e:	83 ec 04             	sub    $0x4,%esp
+    3671:	8d 75 a8             	lea    -0x58(%ebp),%esi
+    3674:	56                   	push   %esi
+    3675:	68 1e 51 00 00       	push   $0x511e
+    367a:	6a 01                	push   $0x1
+    367c:	e8 51 07 00 00       	call   3dd2 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    3681:	83 c4 08             	add    $0x8,%esp
+    3684:	68 02 02 00 00       	push   $0x202
+    3689:	56                   	push   %esi
+    368a:	e8 de 05 00 00       	call   3c6d <open>
+    368f:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    3691:	83 c4 10             	add    $0x10,%esp
+    3694:	85 c0                	test   %eax,%eax
+    3696:	79 1b                	jns    36b3 <fsfull+0xe5>
+      printf(1, "open %s failed\n", name);
+    3698:	83 ec 04             	sub    $0x4,%esp
+    369b:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    369e:	50                   	push   %eax
+    369f:	68 2a 51 00 00       	push   $0x512a
+    36a4:	6a 01                	push   $0x1
+    36a6:	e8 27 07 00 00       	call   3dd2 <printf>
+      break;
+    36ab:	83 c4 10             	add    $0x10,%esp
+    36ae:	e9 e6 00 00 00       	jmp    3799 <fsfull+0x1cb>
+    }
+    int total = 0;
+    36b3:	bf 00 00 00 00       	mov    $0x0,%edi
+    while(1){
+      int cc = write(fd, buf, 512);
+    36b8:	83 ec 04             	sub    $0x4,%esp
+    36bb:	68 00 02 00 00       	push   $0x200
+    36c0:	68 80 8a 00 00       	push   $0x8a80
+    36c5:	56                   	push   %esi
+    36c6:	e8 82 05 00 00       	call   3c4d <write>
+      if(cc < 512)
+    36cb:	83 c4 10             	add    $0x10,%esp
+    36ce:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    36d3:	7e 04                	jle    36d9 <fsfull+0x10b>
+        break;
+      total += cc;
+    36d5:	01 c7                	add    %eax,%edi
+    while(1){
+    36d7:	eb df                	jmp    36b8 <fsfull+0xea>
+      fsblocks++;
+    }
+    printf(1, "wrote %d bytes\n", total);
+    36d9:	83 ec 04             	sub    $0x4,%esp
+    36dc:	57                   	push   %edi
+    36dd:	68 3a 51 00 00       	push   $0x513a
+    36e2:	6a 01                	push   $0x1
+    36e4:	e8 e9 06 00 00       	call   3dd2 <printf>
+    close(fd);
+    36e9:	89 34 24             	mov    %esi,(%esp)
+    36ec:	e8 64 05 00 00       	call   3c55 <close>
+    if(total == 0)
+    36f1:	83 c4 10             	add    $0x10,%esp
+    36f4:	85 ff                	test   %edi,%edi
+    36f6:	0f 84 9d 00 00 00    	je     3799 <fsfull+0x1cb>
+  for(nfiles = 0; ; nfiles++){
+    36fc:	83 c3 01             	add    $0x1,%ebx
+    36ff:	e9 e7 fe ff ff       	jmp    35eb <fsfull+0x1d>
+      break;
+  }
+
+  while(nfiles >= 0){
+    char name[64];
+    name[0] = 'f';
+    3704:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3708:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    370d:	89 d8                	mov    %ebx,%eax
+    370f:	f7 ea                	imul   %edx
+    3711:	c1 fa 06             	sar    $0x6,%edx
+    3714:	89 de                	mov    %ebx,%esi
+    3716:	c1 fe 1f             	sar    $0x1f,%esi
+    3719:	29 f2                	sub    %esi,%edx
+    371b:	8d 42 30             	lea    0x30(%edx),%eax
+    371e:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3721:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    3727:	89 d9                	mov    %ebx,%ecx
+    3729:	29 d1                	sub    %edx,%ecx
+    372b:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    3730:	89 c8                	mov    %ecx,%eax
+    3732:	f7 ef                	imul   %edi
+    3734:	c1 fa 05             	sar    $0x5,%edx
+    3737:	c1 f9 1f             	sar    $0x1f,%ecx
+    373a:	29 ca                	sub    %ecx,%edx
+    373c:	83 c2 30             	add    $0x30,%edx
+    373f:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3742:	89 d8                	mov    %ebx,%eax
+    3744:	f7 ef                	imul   %edi
+    3746:	89 d7                	mov    %edx,%edi
+    3748:	c1 ff 05             	sar    $0x5,%edi
+    374b:	29 f7                	sub    %esi,%edi
+    374d:	6b c7 64             	imul   $0x64,%edi,%eax
+    3750:	89 df                	mov    %ebx,%edi
+    3752:	29 c7                	sub    %eax,%edi
+    3754:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    3759:	89 f8                	mov    %edi,%eax
+    375b:	f7 e9                	imul   %ecx
+    375d:	c1 fa 02             	sar    $0x2,%edx
+    3760:	c1 ff 1f             	sar    $0x1f,%edi
+    3763:	29 fa                	sub    %edi,%edx
+    3765:	83 c2 30             	add    $0x30,%edx
+    3768:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    376b:	89 d8                	mov    %ebx,%eax
+    376d:	f7 e9                	imul   %ecx
+    376f:	c1 fa 02             	sar    $0x2,%edx
+    3772:	29 f2                	sub    %esi,%edx
+    3774:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    3777:	01 c0                	add    %eax,%eax
+    3779:	89 da                	mov    %ebx,%edx
+    377b:	29 c2                	sub    %eax,%edx
+    377d:	83 c2 30             	add    $0x30,%edx
+    3780:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    3783:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    unlink(name);
+    3787:	83 ec 0c             	sub    $0xc,%esp
+    378a:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    378d:	50                   	push   %eax
+    378e:	e8 ea 04 00 00       	call   3c7d <unlink>
+    nfiles--;
+    3793:	83 eb 01             	sub    $0x1,%ebx
+    3796:	83 c4 10             	add    $0x10,%esp
+  while(nfiles >= 0){
+    3799:	85 db                	test   %ebx,%ebx
+    379b:	0f 89 63 ff ff ff    	jns    3704 <fsfull+0x136>
+  }
+
+  printf(1, "fsfull test finished\n");
+    37a1:	83 ec 08             	sub    $0x8,%esp
+    37a4:	68 4a 51 00 00       	push   $0x514a
+    37a9:	6a 01                	push   $0x1
+    37ab:	e8 22 06 00 00       	call   3dd2 <printf>
+}
+    37b0:	83 c4 10             	add    $0x10,%esp
+    37b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    37b6:	5b                   	pop    %ebx
+    37b7:	5e                   	pop    %esi
+    37b8:	5f                   	pop    %edi
+    37b9:	5d                   	pop    %ebp
+    37ba:	c3                   	ret
+
+000037bb <uio>:
+
+void
+uio()
+{
+    37bb:	55                   	push   %ebp
+    37bc:	89 e5                	mov    %esp,%ebp
+    37be:	83 ec 10             	sub    $0x10,%esp
+
+  ushort port = 0;
+  uchar val = 0;
+  int pid;
+
+  printf(1, "uio test\n");
+    37c1:	68 60 51 00 00       	push   $0x5160
+    37c6:	6a 01                	push   $0x1
+    37c8:	e8 05 06 00 00       	call   3dd2 <printf>
+  pid = fork();
+    37cd:	e8 53 04 00 00       	call   3c25 <fork>
+  if(pid == 0){
+    37d2:	83 c4 10             	add    $0x10,%esp
+    37d5:	85 c0                	test   %eax,%eax
+    37d7:	74 1b                	je     37f4 <uio+0x39>
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    port = RTC_DATA;
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    exit();
+  } else if(pid < 0){
+    37d9:	78 3e                	js     3819 <uio+0x5e>
+    printf (1, "fork failed\n");
+    exit();
+  }
+  wait();
+    37db:	e8 55 04 00 00       	call   3c35 <wait>
+  printf(1, "uio test done\n");
+    37e0:	83 ec 08             	sub    $0x8,%esp
+    37e3:	68 6a 51 00 00       	push   $0x516a
+    37e8:	6a 01                	push   $0x1
+    37ea:	e8 e3 05 00 00       	call   3dd2 <printf>
+}
+    37ef:	83 c4 10             	add    $0x10,%esp
+    37f2:	c9                   	leave
+    37f3:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    37f4:	b8 09 00 00 00       	mov    $0x9,%eax
+    37f9:	ba 70 00 00 00       	mov    $0x70,%edx
+    37fe:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    37ff:	ba 71 00 00 00       	mov    $0x71,%edx
+    3804:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    3805:	83 ec 08             	sub    $0x8,%esp
+    3808:	68 f4 58 00 00       	push   $0x58f4
+    380d:	6a 01                	push   $0x1
+    380f:	e8 be 05 00 00       	call   3dd2 <printf>
+    exit();
+    3814:	e8 14 04 00 00       	call   3c2d <exit>
+    printf (1, "fork failed\n");
+    3819:	83 ec 08             	sub    $0x8,%esp
+    381c:	68 ef 50 00 00       	push   $0x50ef
+    3821:	6a 01                	push   $0x1
+    3823:	e8 aa 05 00 00       	call   3dd2 <printf>
+    exit();
+    3828:	e8 00 04 00 00       	call   3c2d <exit>
+
+0000382d <argptest>:
+
+void argptest()
+{
+    382d:	55                   	push   %ebp
+    382e:	89 e5                	mov    %esp,%ebp
+    3830:	53                   	push   %ebx
+    3831:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    3834:	6a 00                	push   $0x0
+    3836:	68 79 51 00 00       	push   $0x5179
+    383b:	e8 2d 04 00 00       	call   3c6d <open>
+  if (fd < 0) {
+    3840:	83 c4 10             	add    $0x10,%esp
+    3843:	85 c0                	test   %eax,%eax
+    3845:	78 3a                	js     3881 <argptest+0x54>
+    3847:	89 c3                	mov    %eax,%ebx
+    printf(2, "open failed\n");
+    exit();
+  }
+  read(fd, sbrk(0) - 1, -1);
+    3849:	83 ec 0c             	sub    $0xc,%esp
+    384c:	6a 00                	push   $0x0
+    384e:	e8 62 04 00 00       	call   3cb5 <sbrk>
+    3853:	83 e8 01             	sub    $0x1,%eax
+    3856:	83 c4 0c             	add    $0xc,%esp
+    3859:	6a ff                	push   $0xffffffff
+    385b:	50                   	push   %eax
+    385c:	53                   	push   %ebx
+    385d:	e8 e3 03 00 00       	call   3c45 <read>
+  close(fd);
+    3862:	89 1c 24             	mov    %ebx,(%esp)
+    3865:	e8 eb 03 00 00       	call   3c55 <close>
+  printf(1, "arg test passed\n");
+    386a:	83 c4 08             	add    $0x8,%esp
+    386d:	68 8b 51 00 00       	push   $0x518b
+    3872:	6a 01                	push   $0x1
+    3874:	e8 59 05 00 00       	call   3dd2 <printf>
+}
+    3879:	83 c4 10             	add    $0x10,%esp
+    387c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    387f:	c9                   	leave
+    3880:	c3                   	ret
+    printf(2, "open failed\n");
+    3881:	83 ec 08             	sub    $0x8,%esp
+    3884:	68 7e 51 00 00       	push   $0x517e
+    3889:	6a 02                	push   $0x2
+    388b:	e8 42 05 00 00       	call   3dd2 <printf>
+    exit();
+    3890:	e8 98 03 00 00       	call   3c2d <exit>
+
+00003895 <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+  randstate = randstate * 1664525 + 1013904223;
+    3895:	69 05 38 63 00 00 0d 	imul   $0x19660d,0x6338,%eax
+    389c:	66 19 00 
+    389f:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    38a4:	a3 38 63 00 00       	mov    %eax,0x6338
+  return randstate;
+}
+    38a9:	c3                   	ret
+
+000038aa <main>:
+
+int
+main(int argc, char *argv[])
+{
+    38aa:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    38ae:	83 e4 f0             	and    $0xfffffff0,%esp
+    38b1:	ff 71 fc             	push   -0x4(%ecx)
+    38b4:	55                   	push   %ebp
+    38b5:	89 e5                	mov    %esp,%ebp
+    38b7:	51                   	push   %ecx
+    38b8:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+    38bb:	68 9c 51 00 00       	push   $0x519c
+    38c0:	6a 01                	push   $0x1
+    38c2:	e8 0b 05 00 00       	call   3dd2 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+    38c7:	83 c4 08             	add    $0x8,%esp
+    38ca:	6a 00                	push   $0x0
+    38cc:	68 b0 51 00 00       	push   $0x51b0
+    38d1:	e8 97 03 00 00       	call   3c6d <open>
+    38d6:	83 c4 10             	add    $0x10,%esp
+    38d9:	85 c0                	test   %eax,%eax
+    38db:	78 14                	js     38f1 <main+0x47>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    38dd:	83 ec 08             	sub    $0x8,%esp
+    38e0:	68 18 59 00 00       	push   $0x5918
+    38e5:	6a 01                	push   $0x1
+    38e7:	e8 e6 04 00 00       	call   3dd2 <printf>
+    exit();
+    38ec:	e8 3c 03 00 00       	call   3c2d <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    38f1:	83 ec 08             	sub    $0x8,%esp
+    38f4:	68 00 02 00 00       	push   $0x200
+    38f9:	68 b0 51 00 00       	push   $0x51b0
+    38fe:	e8 6a 03 00 00       	call   3c6d <open>
+    3903:	89 04 24             	mov    %eax,(%esp)
+    3906:	e8 4a 03 00 00       	call   3c55 <close>
+
+  argptest();
+    390b:	e8 1d ff ff ff       	call   382d <argptest>
+  createdelete();
+    3910:	e8 40 db ff ff       	call   1455 <createdelete>
+  linkunlink();
+    3915:	e8 d9 e3 ff ff       	call   1cf3 <linkunlink>
+  concreate();
+    391a:	e8 ea e0 ff ff       	call   1a09 <concreate>
+  fourfiles();
+    391f:	e8 4b d9 ff ff       	call   126f <fourfiles>
+  sharedfd();
+    3924:	e8 a9 d7 ff ff       	call   10d2 <sharedfd>
+
+  bigargtest();
+    3929:	e8 a1 fb ff ff       	call   34cf <bigargtest>
+  bigwrite();
+    392e:	e8 36 ed ff ff       	call   2669 <bigwrite>
+  bigargtest();
+    3933:	e8 97 fb ff ff       	call   34cf <bigargtest>
+  bsstest();
+    3938:	e8 2f fb ff ff       	call   346c <bsstest>
+  sbrktest();
+    393d:	e8 62 f6 ff ff       	call   2fa4 <sbrktest>
+  validatetest();
+    3942:	e8 77 fa ff ff       	call   33be <validatetest>
+
+  opentest();
+    3947:	e8 38 ca ff ff       	call   384 <opentest>
+  writetest();
+    394c:	e8 c6 ca ff ff       	call   417 <writetest>
+  writetest1();
+    3951:	e8 89 cc ff ff       	call   5df <writetest1>
+  createtest();
+    3956:	e8 34 ce ff ff       	call   78f <createtest>
+
+  openiputtest();
+    395b:	e8 3b c9 ff ff       	call   29b <openiputtest>
+  exitiputtest();
+    3960:	e8 50 c8 ff ff       	call   1b5 <exitiputtest>
+  iputtest();
+    3965:	e8 6e c7 ff ff       	call   d8 <iputtest>
+
+  mem();
+    396a:	e8 a8 d6 ff ff       	call   1017 <mem>
+  pipe1();
+    396f:	e8 ed cf ff ff       	call   961 <pipe1>
+  pipesizetest();
+    3974:	e8 88 d1 ff ff       	call   b01 <pipesizetest>
+  splicetest();
+    3979:	e8 ba d2 ff ff       	call   c38 <splicetest>
+  preempt();
+    397e:	e8 e9 d4 ff ff       	call   e6c <preempt>
+  exitwait();
+    3983:	e8 1f d6 ff ff       	call   fa7 <exitwait>
+
+  rmdot();
+    3988:	e8 a1 f0 ff ff       	call   2a2e <rmdot>
+  fourteen();
+    398d:	e8 5f ef ff ff       	call   28f1 <fourteen>
+  bigfile();
+    3992:	e8 a4 ed ff ff       	call   273b <bigfile>
+  subdir();
+    3997:	e8 9f e5 ff ff       	call   1f3b <subdir>
+  linktest();
+    399c:	e8 42 de ff ff       	call   17e3 <linktest>
+  unlinkread();
+    39a1:	e8 a4 dc ff ff       	call   164a <unlinkread>
+  dirfile();
+    39a6:	e8 08 f2 ff ff       	call   2bb3 <dirfile>
+  iref();
+    39ab:	e8 1d f4 ff ff       	call   2dcd <iref>
+  forktest();
+    39b0:	e8 40 f5 ff ff       	call   2ef5 <forktest>
+  bigdir(); // slow
+    39b5:	e8 2d e4 ff ff       	call   1de7 <bigdir>
+
+  uio();
+    39ba:	e8 fc fd ff ff       	call   37bb <uio>
+
+  exectest();
+    39bf:	e8 54 cf ff ff       	call   918 <exectest>
+
+  exit();
+    39c4:	e8 64 02 00 00       	call   3c2d <exit>
+
+000039c9 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    39c9:	55                   	push   %ebp
+    39ca:	89 e5                	mov    %esp,%ebp
+    39cc:	56                   	push   %esi
+    39cd:	53                   	push   %ebx
+    39ce:	8b 75 08             	mov    0x8(%ebp),%esi
+    39d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    39d4:	89 f0                	mov    %esi,%eax
+    39d6:	89 d1                	mov    %edx,%ecx
+    39d8:	83 c2 01             	add    $0x1,%edx
+    39db:	89 c3                	mov    %eax,%ebx
+    39dd:	83 c0 01             	add    $0x1,%eax
+    39e0:	0f b6 09             	movzbl (%ecx),%ecx
+    39e3:	88 0b                	mov    %cl,(%ebx)
+    39e5:	84 c9                	test   %cl,%cl
+    39e7:	75 ed                	jne    39d6 <strcpy+0xd>
+    ;
+  return os;
+}
+    39e9:	89 f0                	mov    %esi,%eax
+    39eb:	5b                   	pop    %ebx
+    39ec:	5e                   	pop    %esi
+    39ed:	5d                   	pop    %ebp
+    39ee:	c3                   	ret
+
+000039ef <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    39ef:	55                   	push   %ebp
+    39f0:	89 e5                	mov    %esp,%ebp
+    39f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    39f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+    39f8:	eb 06                	jmp    3a00 <strcmp+0x11>
+    p++, q++;
+    39fa:	83 c1 01             	add    $0x1,%ecx
+    39fd:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+    3a00:	0f b6 01             	movzbl (%ecx),%eax
+    3a03:	84 c0                	test   %al,%al
+    3a05:	74 04                	je     3a0b <strcmp+0x1c>
+    3a07:	3a 02                	cmp    (%edx),%al
+    3a09:	74 ef                	je     39fa <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+    3a0b:	0f b6 c0             	movzbl %al,%eax
+    3a0e:	0f b6 12             	movzbl (%edx),%edx
+    3a11:	29 d0                	sub    %edx,%eax
+}
+    3a13:	5d                   	pop    %ebp
+    3a14:	c3                   	ret
+
+00003a15 <strlen>:
+
+uint
+strlen(char *s)
+{
+    3a15:	55                   	push   %ebp
+    3a16:	89 e5                	mov    %esp,%ebp
+    3a18:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    3a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+    3a20:	eb 03                	jmp    3a25 <strlen+0x10>
+    3a22:	83 c0 01             	add    $0x1,%eax
+    3a25:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    3a29:	75 f7                	jne    3a22 <strlen+0xd>
+    ;
+  return n;
+}
+    3a2b:	5d                   	pop    %ebp
+    3a2c:	c3                   	ret
+
+00003a2d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    3a2d:	55                   	push   %ebp
+    3a2e:	89 e5                	mov    %esp,%ebp
+    3a30:	57                   	push   %edi
+    3a31:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3a34:	89 d7                	mov    %edx,%edi
+    3a36:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    3a39:	8b 45 0c             	mov    0xc(%ebp),%eax
+    3a3c:	fc                   	cld
+    3a3d:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    3a3f:	89 d0                	mov    %edx,%eax
+    3a41:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    3a44:	c9                   	leave
+    3a45:	c3                   	ret
+
+00003a46 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    3a46:	55                   	push   %ebp
+    3a47:	89 e5                	mov    %esp,%ebp
+    3a49:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a4c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    3a50:	eb 03                	jmp    3a55 <strchr+0xf>
+    3a52:	83 c0 01             	add    $0x1,%eax
+    3a55:	0f b6 10             	movzbl (%eax),%edx
+    3a58:	84 d2                	test   %dl,%dl
+    3a5a:	74 06                	je     3a62 <strchr+0x1c>
+    if(*s == c)
+    3a5c:	38 ca                	cmp    %cl,%dl
+    3a5e:	75 f2                	jne    3a52 <strchr+0xc>
+    3a60:	eb 05                	jmp    3a67 <strchr+0x21>
+      return (char*)s;
+  return 0;
+    3a62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    3a67:	5d                   	pop    %ebp
+    3a68:	c3                   	ret
+
+00003a69 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    3a69:	55                   	push   %ebp
+    3a6a:	89 e5                	mov    %esp,%ebp
+    3a6c:	57                   	push   %edi
+    3a6d:	56                   	push   %esi
+    3a6e:	53                   	push   %ebx
+    3a6f:	83 ec 1c             	sub    $0x1c,%esp
+    3a72:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    3a75:	bb 00 00 00 00       	mov    $0x0,%ebx
+    3a7a:	89 de                	mov    %ebx,%esi
+    3a7c:	83 c3 01             	add    $0x1,%ebx
+    3a7f:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    3a82:	7d 2e                	jge    3ab2 <gets+0x49>
+    cc = read(0, &c, 1);
+    3a84:	83 ec 04             	sub    $0x4,%esp
+    3a87:	6a 01                	push   $0x1
+    3a89:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3a8c:	50                   	push   %eax
+    3a8d:	6a 00                	push   $0x0
+    3a8f:	e8 b1 01 00 00       	call   3c45 <read>
+    if(cc < 1)
+    3a94:	83 c4 10             	add    $0x10,%esp
+    3a97:	85 c0                	test   %eax,%eax
+    3a99:	7e 17                	jle    3ab2 <gets+0x49>
+      break;
+    buf[i++] = c;
+    3a9b:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3a9f:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    3aa2:	3c 0a                	cmp    $0xa,%al
+    3aa4:	0f 94 c2             	sete   %dl
+    3aa7:	3c 0d                	cmp    $0xd,%al
+    3aa9:	0f 94 c0             	sete   %al
+    3aac:	08 c2                	or     %al,%dl
+    3aae:	74 ca                	je     3a7a <gets+0x11>
+    buf[i++] = c;
+    3ab0:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+    3ab2:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+    3ab6:	89 f8                	mov    %edi,%eax
+    3ab8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3abb:	5b                   	pop    %ebx
+    3abc:	5e                   	pop    %esi
+    3abd:	5f                   	pop    %edi
+    3abe:	5d                   	pop    %ebp
+    3abf:	c3                   	ret
+
+00003ac0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    3ac0:	55                   	push   %ebp
+    3ac1:	89 e5                	mov    %esp,%ebp
+    3ac3:	56                   	push   %esi
+    3ac4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3ac5:	83 ec 08             	sub    $0x8,%esp
+    3ac8:	6a 00                	push   $0x0
+    3aca:	ff 75 08             	push   0x8(%ebp)
+    3acd:	e8 9b 01 00 00       	call   3c6d <open>
+  if(fd < 0)
+    3ad2:	83 c4 10             	add    $0x10,%esp
+    3ad5:	85 c0                	test   %eax,%eax
+    3ad7:	78 24                	js     3afd <stat+0x3d>
+    3ad9:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+    3adb:	83 ec 08             	sub    $0x8,%esp
+    3ade:	ff 75 0c             	push   0xc(%ebp)
+    3ae1:	50                   	push   %eax
+    3ae2:	e8 9e 01 00 00       	call   3c85 <fstat>
+    3ae7:	89 c6                	mov    %eax,%esi
+  close(fd);
+    3ae9:	89 1c 24             	mov    %ebx,(%esp)
+    3aec:	e8 64 01 00 00       	call   3c55 <close>
+  return r;
+    3af1:	83 c4 10             	add    $0x10,%esp
+}
+    3af4:	89 f0                	mov    %esi,%eax
+    3af6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3af9:	5b                   	pop    %ebx
+    3afa:	5e                   	pop    %esi
+    3afb:	5d                   	pop    %ebp
+    3afc:	c3                   	ret
+    return -1;
+    3afd:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3b02:	eb f0                	jmp    3af4 <stat+0x34>
+
+00003b04 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+    3b04:	55                   	push   %ebp
+    3b05:	89 e5                	mov    %esp,%ebp
+    3b07:	56                   	push   %esi
+    3b08:	53                   	push   %ebx
+    3b09:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    3b0c:	eb 03                	jmp    3b11 <atoi+0xd>
+    3b0e:	83 c2 01             	add    $0x1,%edx
+    3b11:	0f b6 02             	movzbl (%edx),%eax
+    3b14:	3c 20                	cmp    $0x20,%al
+    3b16:	74 f6                	je     3b0e <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+    3b18:	3c 2d                	cmp    $0x2d,%al
+    3b1a:	74 1d                	je     3b39 <atoi+0x35>
+    3b1c:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    3b21:	3c 2b                	cmp    $0x2b,%al
+    3b23:	0f 94 c1             	sete   %cl
+    3b26:	3c 2d                	cmp    $0x2d,%al
+    3b28:	0f 94 c0             	sete   %al
+    3b2b:	08 c1                	or     %al,%cl
+    3b2d:	74 03                	je     3b32 <atoi+0x2e>
+    s++;
+    3b2f:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+    3b32:	b8 00 00 00 00       	mov    $0x0,%eax
+    3b37:	eb 17                	jmp    3b50 <atoi+0x4c>
+    3b39:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3b3e:	eb e1                	jmp    3b21 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+    3b40:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+    3b43:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+    3b46:	83 c2 01             	add    $0x1,%edx
+    3b49:	0f be c9             	movsbl %cl,%ecx
+    3b4c:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+    3b50:	0f b6 0a             	movzbl (%edx),%ecx
+    3b53:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+    3b56:	80 fb 09             	cmp    $0x9,%bl
+    3b59:	76 e5                	jbe    3b40 <atoi+0x3c>
+  return sign*n;
+    3b5b:	0f af c6             	imul   %esi,%eax
+}
+    3b5e:	5b                   	pop    %ebx
+    3b5f:	5e                   	pop    %esi
+    3b60:	5d                   	pop    %ebp
+    3b61:	c3                   	ret
+
+00003b62 <atoo>:
+
+int
+atoo(const char *s)
+{
+    3b62:	55                   	push   %ebp
+    3b63:	89 e5                	mov    %esp,%ebp
+    3b65:	56                   	push   %esi
+    3b66:	53                   	push   %ebx
+    3b67:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+    3b6a:	eb 03                	jmp    3b6f <atoo+0xd>
+    3b6c:	83 c2 01             	add    $0x1,%edx
+    3b6f:	0f b6 02             	movzbl (%edx),%eax
+    3b72:	3c 20                	cmp    $0x20,%al
+    3b74:	74 f6                	je     3b6c <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+    3b76:	3c 2d                	cmp    $0x2d,%al
+    3b78:	74 1d                	je     3b97 <atoo+0x35>
+    3b7a:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+    3b7f:	3c 2b                	cmp    $0x2b,%al
+    3b81:	0f 94 c1             	sete   %cl
+    3b84:	3c 2d                	cmp    $0x2d,%al
+    3b86:	0f 94 c0             	sete   %al
+    3b89:	08 c1                	or     %al,%cl
+    3b8b:	74 03                	je     3b90 <atoo+0x2e>
+    s++;
+    3b8d:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+    3b90:	b8 00 00 00 00       	mov    $0x0,%eax
+    3b95:	eb 11                	jmp    3ba8 <atoo+0x46>
+    3b97:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3b9c:	eb e1                	jmp    3b7f <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+    3b9e:	83 c2 01             	add    $0x1,%edx
+    3ba1:	0f be c9             	movsbl %cl,%ecx
+    3ba4:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+    3ba8:	0f b6 0a             	movzbl (%edx),%ecx
+    3bab:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+    3bae:	80 fb 07             	cmp    $0x7,%bl
+    3bb1:	76 eb                	jbe    3b9e <atoo+0x3c>
+  return sign*n;
+    3bb3:	0f af c6             	imul   %esi,%eax
+}
+    3bb6:	5b                   	pop    %ebx
+    3bb7:	5e                   	pop    %esi
+    3bb8:	5d                   	pop    %ebp
+    3bb9:	c3                   	ret
+
+00003bba <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+    3bba:	55                   	push   %ebp
+    3bbb:	89 e5                	mov    %esp,%ebp
+    3bbd:	53                   	push   %ebx
+    3bbe:	8b 55 08             	mov    0x8(%ebp),%edx
+    3bc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    3bc4:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+    3bc7:	eb 09                	jmp    3bd2 <strncmp+0x18>
+      n--, p++, q++;
+    3bc9:	83 e8 01             	sub    $0x1,%eax
+    3bcc:	83 c2 01             	add    $0x1,%edx
+    3bcf:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+    3bd2:	85 c0                	test   %eax,%eax
+    3bd4:	74 0b                	je     3be1 <strncmp+0x27>
+    3bd6:	0f b6 1a             	movzbl (%edx),%ebx
+    3bd9:	84 db                	test   %bl,%bl
+    3bdb:	74 04                	je     3be1 <strncmp+0x27>
+    3bdd:	3a 19                	cmp    (%ecx),%bl
+    3bdf:	74 e8                	je     3bc9 <strncmp+0xf>
+    if(n == 0)
+    3be1:	85 c0                	test   %eax,%eax
+    3be3:	74 0d                	je     3bf2 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+    3be5:	0f b6 02             	movzbl (%edx),%eax
+    3be8:	0f b6 11             	movzbl (%ecx),%edx
+    3beb:	29 d0                	sub    %edx,%eax
+}
+    3bed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3bf0:	c9                   	leave
+    3bf1:	c3                   	ret
+      return 0;
+    3bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+    3bf7:	eb f4                	jmp    3bed <strncmp+0x33>
+
+00003bf9 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    3bf9:	55                   	push   %ebp
+    3bfa:	89 e5                	mov    %esp,%ebp
+    3bfc:	56                   	push   %esi
+    3bfd:	53                   	push   %ebx
+    3bfe:	8b 75 08             	mov    0x8(%ebp),%esi
+    3c01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    3c04:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+    3c07:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+    3c09:	eb 0d                	jmp    3c18 <memmove+0x1f>
+    *dst++ = *src++;
+    3c0b:	0f b6 01             	movzbl (%ecx),%eax
+    3c0e:	88 02                	mov    %al,(%edx)
+    3c10:	8d 49 01             	lea    0x1(%ecx),%ecx
+    3c13:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+    3c16:	89 d8                	mov    %ebx,%eax
+    3c18:	8d 58 ff             	lea    -0x1(%eax),%ebx
+    3c1b:	85 c0                	test   %eax,%eax
+    3c1d:	7f ec                	jg     3c0b <memmove+0x12>
+  return vdst;
+}
+    3c1f:	89 f0                	mov    %esi,%eax
+    3c21:	5b                   	pop    %ebx
+    3c22:	5e                   	pop    %esi
+    3c23:	5d                   	pop    %ebp
+    3c24:	c3                   	ret
+
+00003c25 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3c25:	b8 01 00 00 00       	mov    $0x1,%eax
+    3c2a:	cd 40                	int    $0x40
+    3c2c:	c3                   	ret
+
+00003c2d <exit>:
+SYSCALL(exit)
+    3c2d:	b8 02 00 00 00       	mov    $0x2,%eax
+    3c32:	cd 40                	int    $0x40
+    3c34:	c3                   	ret
+
+00003c35 <wait>:
+SYSCALL(wait)
+    3c35:	b8 03 00 00 00       	mov    $0x3,%eax
+    3c3a:	cd 40                	int    $0x40
+    3c3c:	c3                   	ret
+
+00003c3d <pipe>:
+SYSCALL(pipe)
+    3c3d:	b8 04 00 00 00       	mov    $0x4,%eax
+    3c42:	cd 40                	int    $0x40
+    3c44:	c3                   	ret
+
+00003c45 <read>:
+SYSCALL(read)
+    3c45:	b8 05 00 00 00       	mov    $0x5,%eax
+    3c4a:	cd 40                	int    $0x40
+    3c4c:	c3                   	ret
+
+00003c4d <write>:
+SYSCALL(write)
+    3c4d:	b8 10 00 00 00       	mov    $0x10,%eax
+    3c52:	cd 40                	int    $0x40
+    3c54:	c3                   	ret
+
+00003c55 <close>:
+SYSCALL(close)
+    3c55:	b8 15 00 00 00       	mov    $0x15,%eax
+    3c5a:	cd 40                	int    $0x40
+    3c5c:	c3                   	ret
+
+00003c5d <kill>:
+SYSCALL(kill)
+    3c5d:	b8 06 00 00 00       	mov    $0x6,%eax
+    3c62:	cd 40                	int    $0x40
+    3c64:	c3                   	ret
+
+00003c65 <exec>:
+SYSCALL(exec)
+    3c65:	b8 07 00 00 00       	mov    $0x7,%eax
+    3c6a:	cd 40                	int    $0x40
+    3c6c:	c3                   	ret
+
+00003c6d <open>:
+SYSCALL(open)
+    3c6d:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3c72:	cd 40                	int    $0x40
+    3c74:	c3                   	ret
+
+00003c75 <mknod>:
+SYSCALL(mknod)
+    3c75:	b8 11 00 00 00       	mov    $0x11,%eax
+    3c7a:	cd 40                	int    $0x40
+    3c7c:	c3                   	ret
+
+00003c7d <unlink>:
+SYSCALL(unlink)
+    3c7d:	b8 12 00 00 00       	mov    $0x12,%eax
+    3c82:	cd 40                	int    $0x40
+    3c84:	c3                   	ret
+
+00003c85 <fstat>:
+SYSCALL(fstat)
+    3c85:	b8 08 00 00 00       	mov    $0x8,%eax
+    3c8a:	cd 40                	int    $0x40
+    3c8c:	c3                   	ret
+
+00003c8d <link>:
+SYSCALL(link)
+    3c8d:	b8 13 00 00 00       	mov    $0x13,%eax
+    3c92:	cd 40                	int    $0x40
+    3c94:	c3                   	ret
+
+00003c95 <mkdir>:
+SYSCALL(mkdir)
+    3c95:	b8 14 00 00 00       	mov    $0x14,%eax
+    3c9a:	cd 40                	int    $0x40
+    3c9c:	c3                   	ret
+
+00003c9d <chdir>:
+SYSCALL(chdir)
+    3c9d:	b8 09 00 00 00       	mov    $0x9,%eax
+    3ca2:	cd 40                	int    $0x40
+    3ca4:	c3                   	ret
+
+00003ca5 <dup>:
+SYSCALL(dup)
+    3ca5:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3caa:	cd 40                	int    $0x40
+    3cac:	c3                   	ret
+
+00003cad <getpid>:
+SYSCALL(getpid)
+    3cad:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3cb2:	cd 40                	int    $0x40
+    3cb4:	c3                   	ret
+
+00003cb5 <sbrk>:
+SYSCALL(sbrk)
+    3cb5:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3cba:	cd 40                	int    $0x40
+    3cbc:	c3                   	ret
+
+00003cbd <sleep>:
+SYSCALL(sleep)
+    3cbd:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3cc2:	cd 40                	int    $0x40
+    3cc4:	c3                   	ret
+
+00003cc5 <uptime>:
+SYSCALL(uptime)
+    3cc5:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3cca:	cd 40                	int    $0x40
+    3ccc:	c3                   	ret
+
+00003ccd <halt>:
+SYSCALL(halt)
+    3ccd:	b8 16 00 00 00       	mov    $0x16,%eax
+    3cd2:	cd 40                	int    $0x40
+    3cd4:	c3                   	ret
+
+00003cd5 <date>:
+SYSCALL(date)
+    3cd5:	b8 17 00 00 00       	mov    $0x17,%eax
+    3cda:	cd 40                	int    $0x40
+    3cdc:	c3                   	ret
+
+00003cdd <getuid>:
+SYSCALL(getuid)
+    3cdd:	b8 18 00 00 00       	mov    $0x18,%eax
+    3ce2:	cd 40                	int    $0x40
+    3ce4:	c3                   	ret
+
+00003ce5 <getgid>:
+SYSCALL(getgid)
+    3ce5:	b8 19 00 00 00       	mov    $0x19,%eax
+    3cea:	cd 40                	int    $0x40
+    3cec:	c3                   	ret
+
+00003ced <getppid>:
+SYSCALL(getppid)
+    3ced:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3cf2:	cd 40                	int    $0x40
+    3cf4:	c3                   	ret
+
+00003cf5 <setuid>:
+SYSCALL(setuid)
+    3cf5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    3cfa:	cd 40                	int    $0x40
+    3cfc:	c3                   	ret
+
+00003cfd <setgid>:
+SYSCALL(setgid)
+    3cfd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    3d02:	cd 40                	int    $0x40
+    3d04:	c3                   	ret
+
+00003d05 <getprocs>:
+SYSCALL(getprocs)
+    3d05:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    3d0a:	cd 40                	int    $0x40
+    3d0c:	c3                   	ret
+
+00003d0d <getpriority>:
+SYSCALL(getpriority)
+    3d0d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    3d12:	cd 40                	int    $0x40
+    3d14:	c3                   	ret
+
+00003d15 <setpriority>:
+SYSCALL(setpriority)
+    3d15:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    3d1a:	cd 40                	int    $0x40
+    3d1c:	c3                   	ret
+
+00003d1d <pipesize>:
+SYSCALL(pipesize)
+    3d1d:	b8 20 00 00 00       	mov    $0x20,%eax
+    3d22:	cd 40                	int    $0x40
+    3d24:	c3                   	ret
+
+00003d25 <splice>:
+SYSCALL(splice)
+    3d25:	b8 21 00 00 00       	mov    $0x21,%eax
+    3d2a:	cd 40                	int    $0x40
+    3d2c:	c3                   	ret
+
+00003d2d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    3d2d:	55                   	push   %ebp
+    3d2e:	89 e5                	mov    %esp,%ebp
+    3d30:	83 ec 1c             	sub    $0x1c,%esp
+    3d33:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+    3d36:	6a 01                	push   $0x1
+    3d38:	8d 55 f4             	lea    -0xc(%ebp),%edx
+    3d3b:	52                   	push   %edx
+    3d3c:	50                   	push   %eax
+    3d3d:	e8 0b ff ff ff       	call   3c4d <write>
+}
+    3d42:	83 c4 10             	add    $0x10,%esp
+    3d45:	c9                   	leave
+    3d46:	c3                   	ret
+
+00003d47 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3d47:	55                   	push   %ebp
+    3d48:	89 e5                	mov    %esp,%ebp
+    3d4a:	57                   	push   %edi
+    3d4b:	56                   	push   %esi
+    3d4c:	53                   	push   %ebx
+    3d4d:	83 ec 2c             	sub    $0x2c,%esp
+    3d50:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    3d53:	89 d0                	mov    %edx,%eax
+    3d55:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    3d57:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    3d5b:	0f 95 c1             	setne  %cl
+    3d5e:	c1 ea 1f             	shr    $0x1f,%edx
+    3d61:	84 d1                	test   %dl,%cl
+    3d63:	74 44                	je     3da9 <printint+0x62>
+    neg = 1;
+    x = -xx;
+    3d65:	f7 d8                	neg    %eax
+    3d67:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+    3d69:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    3d70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    3d75:	89 c8                	mov    %ecx,%eax
+    3d77:	ba 00 00 00 00       	mov    $0x0,%edx
+    3d7c:	f7 f6                	div    %esi
+    3d7e:	89 df                	mov    %ebx,%edi
+    3d80:	83 c3 01             	add    $0x1,%ebx
+    3d83:	0f b6 92 a4 59 00 00 	movzbl 0x59a4(%edx),%edx
+    3d8a:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+    3d8e:	89 ca                	mov    %ecx,%edx
+    3d90:	89 c1                	mov    %eax,%ecx
+    3d92:	39 f2                	cmp    %esi,%edx
+    3d94:	73 df                	jae    3d75 <printint+0x2e>
+  if(neg)
+    3d96:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+    3d9a:	74 31                	je     3dcd <printint+0x86>
+    buf[i++] = '-';
+    3d9c:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    3da1:	8d 5f 02             	lea    0x2(%edi),%ebx
+    3da4:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    3da7:	eb 17                	jmp    3dc0 <printint+0x79>
+    x = xx;
+    3da9:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    3dab:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    3db2:	eb bc                	jmp    3d70 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    3db4:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    3db9:	89 f0                	mov    %esi,%eax
+    3dbb:	e8 6d ff ff ff       	call   3d2d <putc>
+  while(--i >= 0)
+    3dc0:	83 eb 01             	sub    $0x1,%ebx
+    3dc3:	79 ef                	jns    3db4 <printint+0x6d>
+}
+    3dc5:	83 c4 2c             	add    $0x2c,%esp
+    3dc8:	5b                   	pop    %ebx
+    3dc9:	5e                   	pop    %esi
+    3dca:	5f                   	pop    %edi
+    3dcb:	5d                   	pop    %ebp
+    3dcc:	c3                   	ret
+    3dcd:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    3dd0:	eb ee                	jmp    3dc0 <printint+0x79>
+
+00003dd2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    3dd2:	55                   	push   %ebp
+    3dd3:	89 e5                	mov    %esp,%ebp
+    3dd5:	57                   	push   %edi
+    3dd6:	56                   	push   %esi
+    3dd7:	53                   	push   %ebx
+    3dd8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    3ddb:	8d 45 10             	lea    0x10(%ebp),%eax
+    3dde:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+    3de1:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    3de6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    3deb:	eb 14                	jmp    3e01 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    3ded:	89 fa                	mov    %edi,%edx
+    3def:	8b 45 08             	mov    0x8(%ebp),%eax
+    3df2:	e8 36 ff ff ff       	call   3d2d <putc>
+    3df7:	eb 05                	jmp    3dfe <printf+0x2c>
+      }
+    } else if(state == '%'){
+    3df9:	83 fe 25             	cmp    $0x25,%esi
+    3dfc:	74 25                	je     3e23 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+    3dfe:	83 c3 01             	add    $0x1,%ebx
+    3e01:	8b 45 0c             	mov    0xc(%ebp),%eax
+    3e04:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    3e08:	84 c0                	test   %al,%al
+    3e0a:	0f 84 20 01 00 00    	je     3f30 <printf+0x15e>
+    c = fmt[i] & 0xff;
+    3e10:	0f be f8             	movsbl %al,%edi
+    3e13:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    3e16:	85 f6                	test   %esi,%esi
+    3e18:	75 df                	jne    3df9 <printf+0x27>
+      if(c == '%'){
+    3e1a:	83 f8 25             	cmp    $0x25,%eax
+    3e1d:	75 ce                	jne    3ded <printf+0x1b>
+        state = '%';
+    3e1f:	89 c6                	mov    %eax,%esi
+    3e21:	eb db                	jmp    3dfe <printf+0x2c>
+      if(c == 'd'){
+    3e23:	83 f8 25             	cmp    $0x25,%eax
+    3e26:	0f 84 cf 00 00 00    	je     3efb <printf+0x129>
+    3e2c:	0f 8c dd 00 00 00    	jl     3f0f <printf+0x13d>
+    3e32:	83 f8 78             	cmp    $0x78,%eax
+    3e35:	0f 8f d4 00 00 00    	jg     3f0f <printf+0x13d>
+    3e3b:	83 f8 63             	cmp    $0x63,%eax
+    3e3e:	0f 8c cb 00 00 00    	jl     3f0f <printf+0x13d>
+    3e44:	83 e8 63             	sub    $0x63,%eax
+    3e47:	83 f8 15             	cmp    $0x15,%eax
+    3e4a:	0f 87 bf 00 00 00    	ja     3f0f <printf+0x13d>
+    3e50:	ff 24 85 4c 59 00 00 	jmp    *0x594c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+    3e57:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    3e5a:	8b 17                	mov    (%edi),%edx
+    3e5c:	83 ec 0c             	sub    $0xc,%esp
+    3e5f:	6a 01                	push   $0x1
+    3e61:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    3e66:	8b 45 08             	mov    0x8(%ebp),%eax
+    3e69:	e8 d9 fe ff ff       	call   3d47 <printint>
+        ap++;
+    3e6e:	83 c7 04             	add    $0x4,%edi
+    3e71:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    3e74:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    3e77:	be 00 00 00 00       	mov    $0x0,%esi
+    3e7c:	eb 80                	jmp    3dfe <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+    3e7e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    3e81:	8b 17                	mov    (%edi),%edx
+    3e83:	83 ec 0c             	sub    $0xc,%esp
+    3e86:	6a 00                	push   $0x0
+    3e88:	b9 10 00 00 00       	mov    $0x10,%ecx
+    3e8d:	8b 45 08             	mov    0x8(%ebp),%eax
+    3e90:	e8 b2 fe ff ff       	call   3d47 <printint>
+        ap++;
+    3e95:	83 c7 04             	add    $0x4,%edi
+    3e98:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    3e9b:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3e9e:	be 00 00 00 00       	mov    $0x0,%esi
+    3ea3:	e9 56 ff ff ff       	jmp    3dfe <printf+0x2c>
+        s = (char*)*ap;
+    3ea8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3eab:	8b 30                	mov    (%eax),%esi
+        ap++;
+    3ead:	83 c0 04             	add    $0x4,%eax
+    3eb0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    3eb3:	85 f6                	test   %esi,%esi
+    3eb5:	75 15                	jne    3ecc <printf+0xfa>
+          s = "(null)";
+    3eb7:	be 42 59 00 00       	mov    $0x5942,%esi
+    3ebc:	eb 0e                	jmp    3ecc <printf+0xfa>
+          putc(fd, *s);
+    3ebe:	0f be d2             	movsbl %dl,%edx
+    3ec1:	8b 45 08             	mov    0x8(%ebp),%eax
+    3ec4:	e8 64 fe ff ff       	call   3d2d <putc>
+          s++;
+    3ec9:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    3ecc:	0f b6 16             	movzbl (%esi),%edx
+    3ecf:	84 d2                	test   %dl,%dl
+    3ed1:	75 eb                	jne    3ebe <printf+0xec>
+      state = 0;
+    3ed3:	be 00 00 00 00       	mov    $0x0,%esi
+    3ed8:	e9 21 ff ff ff       	jmp    3dfe <printf+0x2c>
+        putc(fd, *ap);
+    3edd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    3ee0:	0f be 17             	movsbl (%edi),%edx
+    3ee3:	8b 45 08             	mov    0x8(%ebp),%eax
+    3ee6:	e8 42 fe ff ff       	call   3d2d <putc>
+        ap++;
+    3eeb:	83 c7 04             	add    $0x4,%edi
+    3eee:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+    3ef1:	be 00 00 00 00       	mov    $0x0,%esi
+    3ef6:	e9 03 ff ff ff       	jmp    3dfe <printf+0x2c>
+        putc(fd, c);
+    3efb:	89 fa                	mov    %edi,%edx
+    3efd:	8b 45 08             	mov    0x8(%ebp),%eax
+    3f00:	e8 28 fe ff ff       	call   3d2d <putc>
+      state = 0;
+    3f05:	be 00 00 00 00       	mov    $0x0,%esi
+    3f0a:	e9 ef fe ff ff       	jmp    3dfe <printf+0x2c>
+        putc(fd, '%');
+    3f0f:	ba 25 00 00 00       	mov    $0x25,%edx
+    3f14:	8b 45 08             	mov    0x8(%ebp),%eax
+    3f17:	e8 11 fe ff ff       	call   3d2d <putc>
+        putc(fd, c);
+    3f1c:	89 fa                	mov    %edi,%edx
+    3f1e:	8b 45 08             	mov    0x8(%ebp),%eax
+    3f21:	e8 07 fe ff ff       	call   3d2d <putc>
+      state = 0;
+    3f26:	be 00 00 00 00       	mov    $0x0,%esi
+    3f2b:	e9 ce fe ff ff       	jmp    3dfe <printf+0x2c>
+    }
+  }
+}
+    3f30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3f33:	5b                   	pop    %ebx
+    3f34:	5e                   	pop    %esi
+    3f35:	5f                   	pop    %edi
+    3f36:	5d                   	pop    %ebp
+    3f37:	c3                   	ret
+
+00003f38 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    3f38:	55                   	push   %ebp
+    3f39:	89 e5                	mov    %esp,%ebp
+    3f3b:	57                   	push   %edi
+    3f3c:	56                   	push   %esi
+    3f3d:	53                   	push   %ebx
+    3f3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    3f41:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3f44:	a1 00 ab 00 00       	mov    0xab00,%eax
+    3f49:	eb 02                	jmp    3f4d <free+0x15>
+    3f4b:	89 d0                	mov    %edx,%eax
+    3f4d:	39 c8                	cmp    %ecx,%eax
+    3f4f:	73 04                	jae    3f55 <free+0x1d>
+    3f51:	3b 08                	cmp    (%eax),%ecx
+    3f53:	72 12                	jb     3f67 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3f55:	8b 10                	mov    (%eax),%edx
+    3f57:	39 d0                	cmp    %edx,%eax
+    3f59:	72 f0                	jb     3f4b <free+0x13>
+    3f5b:	39 c8                	cmp    %ecx,%eax
+    3f5d:	72 08                	jb     3f67 <free+0x2f>
+    3f5f:	39 d1                	cmp    %edx,%ecx
+    3f61:	72 04                	jb     3f67 <free+0x2f>
+    3f63:	89 d0                	mov    %edx,%eax
+    3f65:	eb e6                	jmp    3f4d <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    3f67:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    3f6a:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    3f6d:	8b 10                	mov    (%eax),%edx
+    3f6f:	39 d7                	cmp    %edx,%edi
+    3f71:	74 19                	je     3f8c <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+    3f73:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    3f76:	8b 50 04             	mov    0x4(%eax),%edx
+    3f79:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    3f7c:	39 ce                	cmp    %ecx,%esi
+    3f7e:	74 1b                	je     3f9b <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+    3f80:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+    3f82:	a3 00 ab 00 00       	mov    %eax,0xab00
+}
+    3f87:	5b                   	pop    %ebx
+    3f88:	5e                   	pop    %esi
+    3f89:	5f                   	pop    %edi
+    3f8a:	5d                   	pop    %ebp
+    3f8b:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    3f8c:	03 72 04             	add    0x4(%edx),%esi
+    3f8f:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3f92:	8b 10                	mov    (%eax),%edx
+    3f94:	8b 12                	mov    (%edx),%edx
+    3f96:	89 53 f8             	mov    %edx,-0x8(%ebx)
+    3f99:	eb db                	jmp    3f76 <free+0x3e>
+    p->s.size += bp->s.size;
+    3f9b:	03 53 fc             	add    -0x4(%ebx),%edx
+    3f9e:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    3fa1:	8b 53 f8             	mov    -0x8(%ebx),%edx
+    3fa4:	89 10                	mov    %edx,(%eax)
+    3fa6:	eb da                	jmp    3f82 <free+0x4a>
+
+00003fa8 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    3fa8:	55                   	push   %ebp
+    3fa9:	89 e5                	mov    %esp,%ebp
+    3fab:	53                   	push   %ebx
+    3fac:	83 ec 04             	sub    $0x4,%esp
+    3faf:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    3fb1:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    3fb6:	77 05                	ja     3fbd <morecore+0x15>
+    nu = 4096;
+    3fb8:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+    3fbd:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    3fc4:	83 ec 0c             	sub    $0xc,%esp
+    3fc7:	50                   	push   %eax
+    3fc8:	e8 e8 fc ff ff       	call   3cb5 <sbrk>
+  if(p == (char*)-1)
+    3fcd:	83 c4 10             	add    $0x10,%esp
+    3fd0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3fd3:	74 1c                	je     3ff1 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+    3fd5:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    3fd8:	83 c0 08             	add    $0x8,%eax
+    3fdb:	83 ec 0c             	sub    $0xc,%esp
+    3fde:	50                   	push   %eax
+    3fdf:	e8 54 ff ff ff       	call   3f38 <free>
+  return freep;
+    3fe4:	a1 00 ab 00 00       	mov    0xab00,%eax
+    3fe9:	83 c4 10             	add    $0x10,%esp
+}
+    3fec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3fef:	c9                   	leave
+    3ff0:	c3                   	ret
+    return 0;
+    3ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+    3ff6:	eb f4                	jmp    3fec <morecore+0x44>
+
+00003ff8 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    3ff8:	55                   	push   %ebp
+    3ff9:	89 e5                	mov    %esp,%ebp
+    3ffb:	53                   	push   %ebx
+    3ffc:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    3fff:	8b 45 08             	mov    0x8(%ebp),%eax
+    4002:	8d 58 07             	lea    0x7(%eax),%ebx
+    4005:	c1 eb 03             	shr    $0x3,%ebx
+    4008:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    400b:	8b 0d 00 ab 00 00    	mov    0xab00,%ecx
+    4011:	85 c9                	test   %ecx,%ecx
+    4013:	74 04                	je     4019 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4015:	8b 01                	mov    (%ecx),%eax
+    4017:	eb 4a                	jmp    4063 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+    4019:	c7 05 00 ab 00 00 04 	movl   $0xab04,0xab00
+    4020:	ab 00 00 
+    4023:	c7 05 04 ab 00 00 04 	movl   $0xab04,0xab04
+    402a:	ab 00 00 
+    base.s.size = 0;
+    402d:	c7 05 08 ab 00 00 00 	movl   $0x0,0xab08
+    4034:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+    4037:	b9 04 ab 00 00       	mov    $0xab04,%ecx
+    403c:	eb d7                	jmp    4015 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+    403e:	74 19                	je     4059 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    4040:	29 da                	sub    %ebx,%edx
+    4042:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    4045:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+    4048:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    404b:	89 0d 00 ab 00 00    	mov    %ecx,0xab00
+      return (void*)(p + 1);
+    4051:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    4054:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4057:	c9                   	leave
+    4058:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    4059:	8b 10                	mov    (%eax),%edx
+    405b:	89 11                	mov    %edx,(%ecx)
+    405d:	eb ec                	jmp    404b <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    405f:	89 c1                	mov    %eax,%ecx
+    4061:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+    4063:	8b 50 04             	mov    0x4(%eax),%edx
+    4066:	39 da                	cmp    %ebx,%edx
+    4068:	73 d4                	jae    403e <malloc+0x46>
+    if(p == freep)
+    406a:	39 05 00 ab 00 00    	cmp    %eax,0xab00
+    4070:	75 ed                	jne    405f <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+    4072:	89 d8                	mov    %ebx,%eax
+    4074:	e8 2f ff ff ff       	call   3fa8 <morecore>
+    4079:	85 c0                	test   %eax,%eax
+    407b:	75 e2                	jne    405f <malloc+0x67>
+    407d:	eb d5                	jmp    4054 <malloc+0x5c>
@@ -184,6 +184,9 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// Big enough to need a double-indirect block.
+#define BIGFILE (NDIRECT + NINDIRECT + 16)
+
 void
 writetest1(void)
 {
@@ -197,9 +200,9 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGFILE; i++){
     ((int*)buf)[0] = i;
-    if(write(fd, buf, 512) != 512){
+    if(write(fd, buf, BSIZE) != BSIZE){
       printf(stdout, "error: write big file failed\n", i);
       exit();
     }
@@ -215,14 +218,14 @@ writetest1(void)
 
   n = 0;
   for(;;){
-    i = read(fd, buf, 512);
+    i = read(fd, buf, BSIZE);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n == BIGFILE - 1){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
       break;
-    } else if(i != 512){
+    } else if(i != BSIZE){
       printf(stdout, "read failed %d\n", i);
       exit();
     }
@@ -354,6 +357,126 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+// byte at stream position i, so misplaced runs show up
+#define PIPEPAT(i) (((i) ^ ((i) >> 8)) & 0xff)
+
+static void
+pipesizeput(int fd, int pos, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    buf[i] = PIPEPAT(pos + i);
+  if(write(fd, buf, n) != n){
+    printf(1, "pipesize write failed\n");
+    exit();
+  }
+}
+
+static int
+pipesizeget(int fd, int pos, int n)
+{
+  int i;
+
+  if((n = read(fd, buf, n)) < 0){
+    printf(1, "pipesize read failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    if((buf[i] & 0xff) != PIPEPAT(pos + i)){
+      printf(1, "pipesize read bad data at %d\n", pos + i);
+      exit();
+    }
+  }
+  return n;
+}
+
+// grow a pipe with wrapped data in it; a write that fits
+// must not block, and every byte must come out in order
+void
+pipesizetest(void)
+{
+  int fds[2], pos, n;
+
+  printf(1, "pipesize test\n");
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  // Leave data wrapped around the end of the default ring.
+  pipesizeput(fds[1], 0, 3000);
+  for(pos = 0; pos < 2000; pos += n)
+    n = pipesizeget(fds[0], pos, 2000 - pos);
+  pipesizeput(fds[1], 3000, 2000);
+
+  if(pipesize(fds[1], 16384) < 16384 || pipesize(fds[0], 1<<30) >= 0){
+    printf(1, "pipesize failed\n");
+    exit();
+  }
+  pipesizeput(fds[1], 5000, 8000);
+  close(fds[1]);
+  while((n = pipesizeget(fds[0], pos, 1500)) > 0)
+    pos += n;
+  if(pos != 13000){
+    printf(1, "pipesize read %d bytes\n", pos);
+    exit();
+  }
+  close(fds[0]);
+  printf(1, "pipesize ok\n");
+}
+
+// file -> pipe -> file without a user buffer in between
+void
+splicetest(void)
+{
+  int fd, fds[2], i, n;
+
+  printf(1, "splice test\n");
+  fd = open("splice", O_CREATE|O_RDWR);
+  for(i = 0; i < 3000; i++)
+    buf[i] = i;
+  if(fd < 0 || write(fd, buf, 3000) != 3000){
+    printf(1, "splice: create failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("splice", O_RDONLY);
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(splice(fd, fds[1], 5000) != 3000 || splice(fd, fds[1], 5000) != 0){
+    printf(1, "splice: file to pipe failed\n");
+    exit();
+  }
+  close(fd);
+  close(fds[1]);
+  fd = open("splice2", O_CREATE|O_RDWR);
+  for(n = 0; (i = splice(fds[0], fd, 1000)) > 0; n += i)
+    ;
+  if(i < 0 || n != 3000){
+    printf(1, "splice: pipe to file failed\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fd);
+  fd = open("splice2", O_RDONLY);
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    printf(1, "splice: short file\n");
+    exit();
+  }
+  for(i = 0; i < 3000; i++){
+    if((buf[i] & 0xff) != (i & 0xff)){
+      printf(1, "splice: bad data\n");
+      exit();
+    }
+  }
+  close(fd);
+  unlink("splice");
+  unlink("splice2");
+  printf(1, "splice ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -1781,6 +1904,8 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  pipesizetest();
+  splicetest();
   preempt();
   exitwait();
 
@@ -0,0 +1,308 @@
+// Driver for a virtio block device, through the legacy virtio PCI
+// interface (QEMU's -drive if=virtio). Requests go on a single
+// virtqueue, as many at a time as it has room for, and are
+// completed by virtiointr(). When present, the virtio disk takes
+// the place of IDE disk 1: iderw() hands disk 1 requests here.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "pci.h"
+
+#define VIRTIO_VENDOR   0x1AF4
+#define VIRTIO_BLK      0x1001  // legacy (transitional) block device
+#define VIRTIO_DEV      1       // xv6 device number served
+
+// Legacy virtio PCI registers, relative to the I/O BAR.
+#define VIO_DEVFEAT     0x00  // device features
+#define VIO_GUESTFEAT   0x04  // features the driver accepts
+#define VIO_QADDR       0x08  // queue address, in pages
+#define VIO_QSIZE       0x0C  // queue size (entries)
+#define VIO_QSEL        0x0E  // queue select
+#define VIO_QNOTIFY     0x10  // queue notify
+#define VIO_STATUS      0x12  // device status
+#define VIO_ISR         0x13  // interrupt status, cleared by reading
+
+#define VIO_S_ACK       0x01
+#define VIO_S_DRIVER    0x02
+#define VIO_S_DRIVER_OK 0x04
+#define VIO_S_FAILED    0x80
+
+// Virtqueue layout (virtio spec, "legacy interface").
+struct vring_desc {
+  uint addr;       // physical address, low 32 bits
+  uint addrhi;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+#define VRING_DESC_F_NEXT   1
+#define VRING_DESC_F_WRITE  2   // device writes (vs reads) the buffer
+
+struct vring_avail {
+  ushort flags;
+  ushort idx;
+  ushort ring[];
+};
+
+struct vring_used_elem {
+  uint id;         // head of the completed descriptor chain
+  uint len;
+};
+
+struct vring_used {
+  ushort flags;
+  ushort idx;
+  struct vring_used_elem ring[];
+};
+
+// Block request header, read by the device.
+struct virtio_blk_outhdr {
+  uint type;
+  uint ioprio;
+  uint sector;
+  uint sectorhi;
+};
+#define VIRTIO_BLK_T_IN   0
+#define VIRTIO_BLK_T_OUT  1
+
+// The queue has to be physically contiguous; kalloc only hands
+// out single pages, so it lives in the kernel's bss.
+#define VQMAX 256
+#define VQBYTES(n) (PGROUNDUP(16*(n) + 6 + 2*(n)) + PGROUNDUP(6 + 8*(n)))
+static char vqmem[VQBYTES(VQMAX)] __attribute__ ((aligned (PGSIZE)));
+
+static struct {
+  struct spinlock lock;
+  ushort iobase;           // 0 if there is no virtio disk
+  int irq;                 // PCI interrupt line
+  int qsize;
+  struct vring_desc *desc;
+  struct vring_avail *avail;
+  struct vring_used *used;
+  ushort usedidx;          // next used entry to look at
+  ushort freehead;         // free descriptors, chained through next
+  int nfree;
+
+  // Per request, indexed by its first descriptor.
+  struct {
+    struct virtio_blk_outhdr hdr;
+    uchar status;
+    struct buf *b;
+  } req[VQMAX];
+} vdisk;
+
+void
+virtioinit(void)
+{
+  uint bdf, bar;
+  int i, n;
+
+  initlock(&vdisk.lock, "virtio");
+  if(pcifind(PCI_ID, 0xFFFFFFFF, VIRTIO_BLK<<16 | VIRTIO_VENDOR, &bdf) < 0)
+    return;
+  bar = pciread(bdf, PCI_BAR(0));
+  if((bar & PCI_BAR_IO) == 0)
+    return;
+  pciwrite(bdf, PCI_COMMAND,
+           pciread(bdf, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+  vdisk.iobase = bar & 0xFFFC;
+
+  outb(vdisk.iobase + VIO_STATUS, 0);  // reset
+  outb(vdisk.iobase + VIO_STATUS, VIO_S_ACK);
+  outb(vdisk.iobase + VIO_STATUS, VIO_S_ACK | VIO_S_DRIVER);
+  outl(vdisk.iobase + VIO_GUESTFEAT, 0);  // no optional features
+
+  outw(vdisk.iobase + VIO_QSEL, 0);
+  n = inw(vdisk.iobase + VIO_QSIZE);
+  if(n < 3 || n > VQMAX){
+    cprintf("virtio: unusable queue size %d\n", n);
+    outb(vdisk.iobase + VIO_STATUS, VIO_S_FAILED);
+    vdisk.iobase = 0;
+    return;
+  }
+  vdisk.qsize = n;
+  memset(vqmem, 0, sizeof(vqmem));
+  vdisk.desc = (struct vring_desc*)vqmem;
+  vdisk.avail = (struct vring_avail*)(vqmem + 16*n);
+  vdisk.used = (struct vring_used*)(vqmem + PGROUNDUP(16*n + 6 + 2*n));
+  for(i = 0; i < n; i++)
+    vdisk.desc[i].next = i + 1;
+  vdisk.freehead = 0;
+  vdisk.nfree = n;
+  outl(vdisk.iobase + VIO_QADDR, V2P(vqmem) >> PGSHIFT);
+
+  vdisk.irq = pciread(bdf, PCI_INTR) & 0xFF;
+  if(vdisk.irq != IRQ_PCI0 && vdisk.irq != IRQ_PCI1 && vdisk.irq != IRQ_PCI2){
+    cprintf("virtio: unexpected irq %d\n", vdisk.irq);
+    outb(vdisk.iobase + VIO_STATUS, VIO_S_FAILED);
+    vdisk.iobase = 0;
+    return;
+  }
+  ioapicenablepci(vdisk.irq, ncpu - 1);
+  outb(vdisk.iobase + VIO_STATUS, VIO_S_ACK | VIO_S_DRIVER | VIO_S_DRIVER_OK);
+}
+
+static int
+descalloc(void)
+{
+  int i;
+
+  i = vdisk.freehead;
+  vdisk.freehead = vdisk.desc[i].next;
+  vdisk.nfree--;
+  return i;
+}
+
+static void
+descfree(int i)
+{
+  vdisk.desc[i].next = vdisk.freehead;
+  vdisk.freehead = i;
+  vdisk.nfree++;
+}
+
+// Put b on the queue as a three-descriptor chain: request
+// header, data, status byte. Caller must hold vdisk.lock and
+// have checked that three descriptors are free.
+static void
+virtioqueue(struct buf *b)
+{
+  int h, d, s;
+  struct vring_desc *desc = vdisk.desc;
+
+  h = descalloc();
+  d = descalloc();
+  s = descalloc();
+
+  vdisk.req[h].hdr.type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  vdisk.req[h].hdr.ioprio = 0;
+  vdisk.req[h].hdr.sector = b->blockno * (BSIZE/512);
+  vdisk.req[h].hdr.sectorhi = 0;
+  vdisk.req[h].status = 0xFF;
+  vdisk.req[h].b = b;
+
+  desc[h].addr = V2P(&vdisk.req[h].hdr);
+  desc[h].addrhi = 0;
+  desc[h].len = sizeof(vdisk.req[h].hdr);
+  desc[h].flags = VRING_DESC_F_NEXT;
+  desc[h].next = d;
+
+  desc[d].addr = V2P(b->data);
+  desc[d].addrhi = 0;
+  desc[d].len = BSIZE;
+  desc[d].flags = VRING_DESC_F_NEXT;
+  if(!(b->flags & B_DIRTY))
+    desc[d].flags |= VRING_DESC_F_WRITE;
+  desc[d].next = s;
+
+  desc[s].addr = V2P(&vdisk.req[h].status);
+  desc[s].addrhi = 0;
+  desc[s].len = 1;
+  desc[s].flags = VRING_DESC_F_WRITE;
+  desc[s].next = 0;
+
+  vdisk.avail->ring[vdisk.avail->idx % vdisk.qsize] = h;
+  __sync_synchronize();
+  vdisk.avail->idx++;
+}
+
+// Sync n bufs with the virtio disk, like iderwv(). If async is
+// set, mark them B_ASYNC and return once they are queued, like
+// idereadahead(). Returns -1 if the bufs are not for a
+// virtio disk. A batch must all be for the same device.
+int
+virtiorw(struct buf **bufs, int n, int async)
+{
+  int i;
+
+  if(vdisk.iobase == 0 || bufs[0]->dev != VIRTIO_DEV)
+    return -1;
+  for(i = 1; i < n; i++)
+    if(bufs[i]->dev != VIRTIO_DEV)
+      panic("virtiorw: mixed devices");
+
+  acquire(&vdisk.lock);
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bufs[i]->lock))
+      panic("virtiorw: buf not locked");
+    if((bufs[i]->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("virtiorw: nothing to do");
+    while(vdisk.nfree < 3){
+      // Let the device see what is queued so far.
+      outw(vdisk.iobase + VIO_QNOTIFY, 0);
+      sleep(&vdisk.nfree, &vdisk.lock);
+    }
+    if(async)
+      bufs[i]->flags |= B_ASYNC;
+    virtioqueue(bufs[i]);
+  }
+  __sync_synchronize();
+  outw(vdisk.iobase + VIO_QNOTIFY, 0);
+
+  if(!async)
+    for(i = 0; i < n; i++)
+      while((bufs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+        sleep(bufs[i], &vdisk.lock);
+  release(&vdisk.lock);
+  return 0;
+}
+
+// Wait for a read-ahead into b to complete, like idewaitahead().
+// Returns -1 if b is not for a virtio disk.
+int
+virtiowait(struct buf *b)
+{
+  if(vdisk.iobase == 0 || b->dev != VIRTIO_DEV)
+    return -1;
+  acquire(&vdisk.lock);
+  while(b->flags & B_ASYNC)
+    sleep(b, &vdisk.lock);
+  release(&vdisk.lock);
+  return 0;
+}
+
+// Interrupt handler for PCI line irq, which may be shared.
+void
+virtiointr(int irq)
+{
+  struct buf *b;
+  int h, d;
+
+  if(vdisk.iobase == 0 || irq != vdisk.irq)
+    return;
+
+  acquire(&vdisk.lock);
+  inb(vdisk.iobase + VIO_ISR);  // acknowledge
+
+  while(vdisk.usedidx != *(volatile ushort*)&vdisk.used->idx){
+    __sync_synchronize();
+    h = vdisk.used->ring[vdisk.usedidx % vdisk.qsize].id;
+    b = vdisk.req[h].b;
+    if(vdisk.req[h].status != 0)
+      panic("virtio: I/O error");
+
+    // Wake process waiting for this buf.
+    b->flags |= B_VALID;
+    b->flags &= ~(B_DIRTY|B_ASYNC);
+    wakeup(b);
+
+    d = vdisk.desc[h].next;
+    descfree(vdisk.desc[d].next);
+    descfree(d);
+    descfree(h);
+    vdisk.usedidx++;
+  }
+  wakeup(&vdisk.nfree);
+
+  release(&vdisk.lock);
+}
@@ -311,37 +311,151 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child. Pages are not copied: both page tables
+// map them read-only and marked PTE_COW, and the first write
+// to one from either side takes a private copy (see cowpage).
+// pgdir must be the current page table.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
   pte_t *pte;
   uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+    // Heap pages that were never touched stay unmapped in the child.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0 || !(*pte & PTE_P))
+      continue;
+    if(*pte & PTE_W)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0)
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
+    kincref(P2V(pa));
   }
+  // The parent's writable entries were just downgraded.
+  lcr3(V2P(pgdir));
   return d;
 
 bad:
+  lcr3(V2P(pgdir));
   freevm(d);
   return 0;
 }
 
+// Give pgdir its own writable copy of the copy-on-write page
+// mapped by pte at user address va. If no one else shares the
+// page any more it is simply made writable again.
+// Returns 0 on success, -1 if out of memory.
+static int
+cowpage(pte_t *pte, uint va)
+{
+  uint pa;
+  char *mem;
+
+  pa = PTE_ADDR(*pte);
+  if(krefcount(P2V(pa)) > 1){
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, P2V(pa), PGSIZE);
+    *pte = V2P(mem) | PTE_FLAGS(*pte);
+    kfree(P2V(pa));
+  }
+  *pte = (*pte | PTE_W) & ~PTE_COW;
+  invlpg((void*)va);
+  return 0;
+}
+
+// Fill mem with the part of p's executable that belongs at
+// user page va, if any. May sleep, so only called from process
+// context with no locks held. The file can't be written while
+// p runs it (see iexecref), so late pages match early ones.
+static int
+loadpage(struct proc *p, char *mem, uint va)
+{
+  struct seg *s;
+  uint n;
+
+  for(s = p->seg; s < &p->seg[p->nseg]; s++){
+    if(va < s->vaddr || va >= s->vaddr + s->filesz)
+      continue;
+    n = s->vaddr + s->filesz - va;
+    if(n > PGSIZE)
+      n = PGSIZE;
+    ilock(p->exe);
+    if(readi(p->exe, mem, s->off + (va - s->vaddr), n) != n){
+      iunlock(p->exe);
+      return -1;
+    }
+    // Programs mostly fault their way forward through a
+    // segment, so start reading the next page now.
+    if(va + n < s->vaddr + s->filesz)
+      readahead(p->exe, s->off + (va + n - s->vaddr), PGSIZE);
+    iunlock(p->exe);
+    break;
+  }
+  return 0;
+}
+
+// Handle a page fault at va in process p with error code err.
+// Returns 0 if the fault was resolved and the faulting
+// instruction can be restarted, -1 otherwise.
+int
+pagefault(struct proc *p, uint va, uint err)
+{
+  pte_t *pte;
+  char *mem;
+  uint a;
+
+  if(va >= p->sz)
+    return -1;
+  a = PGROUNDDOWN(va);
+  pte = walkpgdir(p->pgdir, (char*)a, 0);
+  if(pte == 0 || (*pte & PTE_P) == 0){
+    // exec() and sbrk() only set up p->sz; program and heap
+    // pages are allocated and filled here, on first touch.
+    if((mem = kalloc()) == 0)
+      return -1;
+    memset(mem, 0, PGSIZE);
+    if(loadpage(p, mem, a) < 0 ||
+       mappages(p->pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+      kfree(mem);
+      return -1;
+    }
+    return 0;
+  }
+  if((err & FEC_WR) && (*pte & (PTE_U|PTE_COW)) == (PTE_U|PTE_COW))
+    return cowpage(pte, a);
+  return -1;
+}
+
+// Fault in any pages of [va, va+len) in p that are not present
+// yet and, if the kernel is going to write the buffer, take
+// private copies of copy-on-write ones. The kernel never takes
+// page faults on user memory itself (see trap). Returns -1 if
+// out of memory.
+int
+prefault(struct proc *p, uint va, uint len, int write)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0){
+      if(pagefault(p, a, write ? FEC_WR : 0) < 0)
+        return -1;
+    } else if(write && (*pte & PTE_COW)){
+      if(pagefault(p, a, FEC_WR) < 0)
+        return -1;
+    }
+  }
+  return 0;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -365,10 +479,17 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    // The kernel writes through its own mapping, so a shared
+    // page has to be copied here rather than on a fault.
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & (PTE_P|PTE_U|PTE_COW)) == (PTE_P|PTE_U|PTE_COW))
+      if(cowpage(pte, va0) < 0)
+        return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
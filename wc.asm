@@ -0,0 +1,1313 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 1c             	sub    $0x1c,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+  inword = 0;
+   9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  l = w = c = 0;
+  10:	be 00 00 00 00       	mov    $0x0,%esi
+  15:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  1c:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  23:	83 ec 04             	sub    $0x4,%esp
+  26:	68 00 02 00 00       	push   $0x200
+  2b:	68 00 0c 00 00       	push   $0xc00
+  30:	ff 75 08             	push   0x8(%ebp)
+  33:	e8 a8 03 00 00       	call   3e0 <read>
+  38:	89 c7                	mov    %eax,%edi
+  3a:	83 c4 10             	add    $0x10,%esp
+  3d:	85 c0                	test   %eax,%eax
+  3f:	7e 54                	jle    95 <wc+0x95>
+    for(i=0; i<n; i++){
+  41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  46:	eb 22                	jmp    6a <wc+0x6a>
+      c++;
+      if(buf[i] == '\n')
+        l++;
+      if(strchr(" \r\t\n\v", buf[i]))
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	0f be c0             	movsbl %al,%eax
+  4e:	50                   	push   %eax
+  4f:	68 1c 08 00 00       	push   $0x81c
+  54:	e8 88 01 00 00       	call   1e1 <strchr>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	85 c0                	test   %eax,%eax
+  5e:	74 22                	je     82 <wc+0x82>
+        inword = 0;
+  60:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	39 fb                	cmp    %edi,%ebx
+  6c:	7d b5                	jge    23 <wc+0x23>
+      c++;
+  6e:	83 c6 01             	add    $0x1,%esi
+      if(buf[i] == '\n')
+  71:	0f b6 83 00 0c 00 00 	movzbl 0xc00(%ebx),%eax
+  78:	3c 0a                	cmp    $0xa,%al
+  7a:	75 cc                	jne    48 <wc+0x48>
+        l++;
+  7c:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  80:	eb c6                	jmp    48 <wc+0x48>
+      else if(!inword){
+  82:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  86:	75 df                	jne    67 <wc+0x67>
+        w++;
+  88:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+        inword = 1;
+  8c:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  93:	eb d2                	jmp    67 <wc+0x67>
+      }
+    }
+  }
+  if(n < 0){
+  95:	78 24                	js     bb <wc+0xbb>
+    printf(1, "wc: read error\n");
+    exit();
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  97:	83 ec 08             	sub    $0x8,%esp
+  9a:	ff 75 0c             	push   0xc(%ebp)
+  9d:	56                   	push   %esi
+  9e:	ff 75 dc             	push   -0x24(%ebp)
+  a1:	ff 75 e0             	push   -0x20(%ebp)
+  a4:	68 32 08 00 00       	push   $0x832
+  a9:	6a 01                	push   $0x1
+  ab:	e8 bd 04 00 00       	call   56d <printf>
+}
+  b0:	83 c4 20             	add    $0x20,%esp
+  b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  b6:	5b                   	pop    %ebx
+  b7:	5e                   	pop    %esi
+  b8:	5f                   	pop    %edi
+  b9:	5d                   	pop    %ebp
+  ba:	c3                   	ret
+    printf(1, "wc: read error\n");
+  bb:	83 ec 08             	sub    $0x8,%esp
+  be:	68 22 08 00 00       	push   $0x822
+  c3:	6a 01                	push   $0x1
+  c5:	e8 a3 04 00 00       	call   56d <printf>
+    exit();
+  ca:	e8 f9 02 00 00       	call   3c8 <exit>
+
+000000cf <main>:
+
+int
+main(int argc, char *argv[])
+{
+  cf:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  d3:	83 e4 f0             	and    $0xfffffff0,%esp
+  d6:	ff 71 fc             	push   -0x4(%ecx)
+  d9:	55                   	push   %ebp
+  da:	89 e5                	mov    %esp,%ebp
+  dc:	57                   	push   %edi
+  dd:	56                   	push   %esi
+  de:	53                   	push   %ebx
+  df:	51                   	push   %ecx
+  e0:	83 ec 18             	sub    $0x18,%esp
+  e3:	8b 01                	mov    (%ecx),%eax
+  e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  e8:	8b 51 04             	mov    0x4(%ecx),%edx
+  eb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+  ee:	83 f8 01             	cmp    $0x1,%eax
+  f1:	7e 07                	jle    fa <main+0x2b>
+    wc(0, "");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  f3:	be 01 00 00 00       	mov    $0x1,%esi
+  f8:	eb 2d                	jmp    127 <main+0x58>
+    wc(0, "");
+  fa:	83 ec 08             	sub    $0x8,%esp
+  fd:	68 31 08 00 00       	push   $0x831
+ 102:	6a 00                	push   $0x0
+ 104:	e8 f7 fe ff ff       	call   0 <wc>
+    exit();
+ 109:	e8 ba 02 00 00       	call   3c8 <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+ 10e:	83 ec 08             	sub    $0x8,%esp
+ 111:	ff 37                	push   (%edi)
+ 113:	50                   	push   %eax
+ 114:	e8 e7 fe ff ff       	call   0 <wc>
+    close(fd);
+ 119:	89 1c 24             	mov    %ebx,(%esp)
+ 11c:	e8 cf 02 00 00       	call   3f0 <close>
+  for(i = 1; i < argc; i++){
+ 121:	83 c6 01             	add    $0x1,%esi
+ 124:	83 c4 10             	add    $0x10,%esp
+ 127:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 12a:	39 c6                	cmp    %eax,%esi
+ 12c:	7d 31                	jge    15f <main+0x90>
+    if((fd = open(argv[i], 0)) < 0){
+ 12e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 131:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+ 134:	83 ec 08             	sub    $0x8,%esp
+ 137:	6a 00                	push   $0x0
+ 139:	ff 37                	push   (%edi)
+ 13b:	e8 c8 02 00 00       	call   408 <open>
+ 140:	89 c3                	mov    %eax,%ebx
+ 142:	83 c4 10             	add    $0x10,%esp
+ 145:	85 c0                	test   %eax,%eax
+ 147:	79 c5                	jns    10e <main+0x3f>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 149:	83 ec 04             	sub    $0x4,%esp
+ 14c:	ff 37                	push   (%edi)
+ 14e:	68 3f 08 00 00       	push   $0x83f
+ 153:	6a 01                	push   $0x1
+ 155:	e8 13 04 00 00       	call   56d <printf>
+      exit();
+ 15a:	e8 69 02 00 00       	call   3c8 <exit>
+  }
+  exit();
+ 15f:	e8 64 02 00 00       	call   3c8 <exit>
+
+00000164 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 164:	55                   	push   %ebp
+ 165:	89 e5                	mov    %esp,%ebp
+ 167:	56                   	push   %esi
+ 168:	53                   	push   %ebx
+ 169:	8b 75 08             	mov    0x8(%ebp),%esi
+ 16c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 16f:	89 f0                	mov    %esi,%eax
+ 171:	89 d1                	mov    %edx,%ecx
+ 173:	83 c2 01             	add    $0x1,%edx
+ 176:	89 c3                	mov    %eax,%ebx
+ 178:	83 c0 01             	add    $0x1,%eax
+ 17b:	0f b6 09             	movzbl (%ecx),%ecx
+ 17e:	88 0b                	mov    %cl,(%ebx)
+ 180:	84 c9                	test   %cl,%cl
+ 182:	75 ed                	jne    171 <strcpy+0xd>
+    ;
+  return os;
+}
+ 184:	89 f0                	mov    %esi,%eax
+ 186:	5b                   	pop    %ebx
+ 187:	5e                   	pop    %esi
+ 188:	5d                   	pop    %ebp
+ 189:	c3                   	ret
+
+0000018a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 18a:	55                   	push   %ebp
+ 18b:	89 e5                	mov    %esp,%ebp
+ 18d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 190:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 193:	eb 06                	jmp    19b <strcmp+0x11>
+    p++, q++;
+ 195:	83 c1 01             	add    $0x1,%ecx
+ 198:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 19b:	0f b6 01             	movzbl (%ecx),%eax
+ 19e:	84 c0                	test   %al,%al
+ 1a0:	74 04                	je     1a6 <strcmp+0x1c>
+ 1a2:	3a 02                	cmp    (%edx),%al
+ 1a4:	74 ef                	je     195 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 1a6:	0f b6 c0             	movzbl %al,%eax
+ 1a9:	0f b6 12             	movzbl (%edx),%edx
+ 1ac:	29 d0                	sub    %edx,%eax
+}
+ 1ae:	5d                   	pop    %ebp
+ 1af:	c3                   	ret
+
+000001b0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1bb:	eb 03                	jmp    1c0 <strlen+0x10>
+ 1bd:	83 c0 01             	add    $0x1,%eax
+ 1c0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c4:	75 f7                	jne    1bd <strlen+0xd>
+    ;
+  return n;
+}
+ 1c6:	5d                   	pop    %ebp
+ 1c7:	c3                   	ret
+
+000001c8 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1c8:	55                   	push   %ebp
+ 1c9:	89 e5                	mov    %esp,%ebp
+ 1cb:	57                   	push   %edi
+ 1cc:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1cf:	89 d7                	mov    %edx,%edi
+ 1d1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d7:	fc                   	cld
+ 1d8:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1da:	89 d0                	mov    %edx,%eax
+ 1dc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1df:	c9                   	leave
+ 1e0:	c3                   	ret
+
+000001e1 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1e1:	55                   	push   %ebp
+ 1e2:	89 e5                	mov    %esp,%ebp
+ 1e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1eb:	eb 03                	jmp    1f0 <strchr+0xf>
+ 1ed:	83 c0 01             	add    $0x1,%eax
+ 1f0:	0f b6 10             	movzbl (%eax),%edx
+ 1f3:	84 d2                	test   %dl,%dl
+ 1f5:	74 06                	je     1fd <strchr+0x1c>
+    if(*s == c)
+ 1f7:	38 ca                	cmp    %cl,%dl
+ 1f9:	75 f2                	jne    1ed <strchr+0xc>
+ 1fb:	eb 05                	jmp    202 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 1fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+
+00000204 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 204:	55                   	push   %ebp
+ 205:	89 e5                	mov    %esp,%ebp
+ 207:	57                   	push   %edi
+ 208:	56                   	push   %esi
+ 209:	53                   	push   %ebx
+ 20a:	83 ec 1c             	sub    $0x1c,%esp
+ 20d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 210:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 215:	89 de                	mov    %ebx,%esi
+ 217:	83 c3 01             	add    $0x1,%ebx
+ 21a:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21d:	7d 2e                	jge    24d <gets+0x49>
+    cc = read(0, &c, 1);
+ 21f:	83 ec 04             	sub    $0x4,%esp
+ 222:	6a 01                	push   $0x1
+ 224:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 227:	50                   	push   %eax
+ 228:	6a 00                	push   $0x0
+ 22a:	e8 b1 01 00 00       	call   3e0 <read>
+    if(cc < 1)
+ 22f:	83 c4 10             	add    $0x10,%esp
+ 232:	85 c0                	test   %eax,%eax
+ 234:	7e 17                	jle    24d <gets+0x49>
+      break;
+    buf[i++] = c;
+ 236:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 23a:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 23d:	3c 0a                	cmp    $0xa,%al
+ 23f:	0f 94 c2             	sete   %dl
+ 242:	3c 0d                	cmp    $0xd,%al
+ 244:	0f 94 c0             	sete   %al
+ 247:	08 c2                	or     %al,%dl
+ 249:	74 ca                	je     215 <gets+0x11>
+    buf[i++] = c;
+ 24b:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 24d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 251:	89 f8                	mov    %edi,%eax
+ 253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 256:	5b                   	pop    %ebx
+ 257:	5e                   	pop    %esi
+ 258:	5f                   	pop    %edi
+ 259:	5d                   	pop    %ebp
+ 25a:	c3                   	ret
+
+0000025b <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	56                   	push   %esi
+ 25f:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 260:	83 ec 08             	sub    $0x8,%esp
+ 263:	6a 00                	push   $0x0
+ 265:	ff 75 08             	push   0x8(%ebp)
+ 268:	e8 9b 01 00 00       	call   408 <open>
+  if(fd < 0)
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	85 c0                	test   %eax,%eax
+ 272:	78 24                	js     298 <stat+0x3d>
+ 274:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 276:	83 ec 08             	sub    $0x8,%esp
+ 279:	ff 75 0c             	push   0xc(%ebp)
+ 27c:	50                   	push   %eax
+ 27d:	e8 9e 01 00 00       	call   420 <fstat>
+ 282:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 284:	89 1c 24             	mov    %ebx,(%esp)
+ 287:	e8 64 01 00 00       	call   3f0 <close>
+  return r;
+ 28c:	83 c4 10             	add    $0x10,%esp
+}
+ 28f:	89 f0                	mov    %esi,%eax
+ 291:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 294:	5b                   	pop    %ebx
+ 295:	5e                   	pop    %esi
+ 296:	5d                   	pop    %ebp
+ 297:	c3                   	ret
+    return -1;
+ 298:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 29d:	eb f0                	jmp    28f <stat+0x34>
+
+0000029f <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 29f:	55                   	push   %ebp
+ 2a0:	89 e5                	mov    %esp,%ebp
+ 2a2:	56                   	push   %esi
+ 2a3:	53                   	push   %ebx
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 2a7:	eb 03                	jmp    2ac <atoi+0xd>
+ 2a9:	83 c2 01             	add    $0x1,%edx
+ 2ac:	0f b6 02             	movzbl (%edx),%eax
+ 2af:	3c 20                	cmp    $0x20,%al
+ 2b1:	74 f6                	je     2a9 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 2b3:	3c 2d                	cmp    $0x2d,%al
+ 2b5:	74 1d                	je     2d4 <atoi+0x35>
+ 2b7:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 2bc:	3c 2b                	cmp    $0x2b,%al
+ 2be:	0f 94 c1             	sete   %cl
+ 2c1:	3c 2d                	cmp    $0x2d,%al
+ 2c3:	0f 94 c0             	sete   %al
+ 2c6:	08 c1                	or     %al,%cl
+ 2c8:	74 03                	je     2cd <atoi+0x2e>
+    s++;
+ 2ca:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 2cd:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2d2:	eb 17                	jmp    2eb <atoi+0x4c>
+ 2d4:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d9:	eb e1                	jmp    2bc <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 2db:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 2de:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 2e1:	83 c2 01             	add    $0x1,%edx
+ 2e4:	0f be c9             	movsbl %cl,%ecx
+ 2e7:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 2eb:	0f b6 0a             	movzbl (%edx),%ecx
+ 2ee:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 2f1:	80 fb 09             	cmp    $0x9,%bl
+ 2f4:	76 e5                	jbe    2db <atoi+0x3c>
+  return sign*n;
+ 2f6:	0f af c6             	imul   %esi,%eax
+}
+ 2f9:	5b                   	pop    %ebx
+ 2fa:	5e                   	pop    %esi
+ 2fb:	5d                   	pop    %ebp
+ 2fc:	c3                   	ret
+
+000002fd <atoo>:
+
+int
+atoo(const char *s)
+{
+ 2fd:	55                   	push   %ebp
+ 2fe:	89 e5                	mov    %esp,%ebp
+ 300:	56                   	push   %esi
+ 301:	53                   	push   %ebx
+ 302:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 305:	eb 03                	jmp    30a <atoo+0xd>
+ 307:	83 c2 01             	add    $0x1,%edx
+ 30a:	0f b6 02             	movzbl (%edx),%eax
+ 30d:	3c 20                	cmp    $0x20,%al
+ 30f:	74 f6                	je     307 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 311:	3c 2d                	cmp    $0x2d,%al
+ 313:	74 1d                	je     332 <atoo+0x35>
+ 315:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 31a:	3c 2b                	cmp    $0x2b,%al
+ 31c:	0f 94 c1             	sete   %cl
+ 31f:	3c 2d                	cmp    $0x2d,%al
+ 321:	0f 94 c0             	sete   %al
+ 324:	08 c1                	or     %al,%cl
+ 326:	74 03                	je     32b <atoo+0x2e>
+    s++;
+ 328:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 32b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 330:	eb 11                	jmp    343 <atoo+0x46>
+ 332:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 337:	eb e1                	jmp    31a <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 339:	83 c2 01             	add    $0x1,%edx
+ 33c:	0f be c9             	movsbl %cl,%ecx
+ 33f:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 343:	0f b6 0a             	movzbl (%edx),%ecx
+ 346:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 349:	80 fb 07             	cmp    $0x7,%bl
+ 34c:	76 eb                	jbe    339 <atoo+0x3c>
+  return sign*n;
+ 34e:	0f af c6             	imul   %esi,%eax
+}
+ 351:	5b                   	pop    %ebx
+ 352:	5e                   	pop    %esi
+ 353:	5d                   	pop    %ebp
+ 354:	c3                   	ret
+
+00000355 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 355:	55                   	push   %ebp
+ 356:	89 e5                	mov    %esp,%ebp
+ 358:	53                   	push   %ebx
+ 359:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 35f:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 362:	eb 09                	jmp    36d <strncmp+0x18>
+      n--, p++, q++;
+ 364:	83 e8 01             	sub    $0x1,%eax
+ 367:	83 c2 01             	add    $0x1,%edx
+ 36a:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 36d:	85 c0                	test   %eax,%eax
+ 36f:	74 0b                	je     37c <strncmp+0x27>
+ 371:	0f b6 1a             	movzbl (%edx),%ebx
+ 374:	84 db                	test   %bl,%bl
+ 376:	74 04                	je     37c <strncmp+0x27>
+ 378:	3a 19                	cmp    (%ecx),%bl
+ 37a:	74 e8                	je     364 <strncmp+0xf>
+    if(n == 0)
+ 37c:	85 c0                	test   %eax,%eax
+ 37e:	74 0d                	je     38d <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 380:	0f b6 02             	movzbl (%edx),%eax
+ 383:	0f b6 11             	movzbl (%ecx),%edx
+ 386:	29 d0                	sub    %edx,%eax
+}
+ 388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 38b:	c9                   	leave
+ 38c:	c3                   	ret
+      return 0;
+ 38d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 392:	eb f4                	jmp    388 <strncmp+0x33>
+
+00000394 <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 394:	55                   	push   %ebp
+ 395:	89 e5                	mov    %esp,%ebp
+ 397:	56                   	push   %esi
+ 398:	53                   	push   %ebx
+ 399:	8b 75 08             	mov    0x8(%ebp),%esi
+ 39c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 39f:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 3a2:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 3a4:	eb 0d                	jmp    3b3 <memmove+0x1f>
+    *dst++ = *src++;
+ 3a6:	0f b6 01             	movzbl (%ecx),%eax
+ 3a9:	88 02                	mov    %al,(%edx)
+ 3ab:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 3ae:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 3b1:	89 d8                	mov    %ebx,%eax
+ 3b3:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 3b6:	85 c0                	test   %eax,%eax
+ 3b8:	7f ec                	jg     3a6 <memmove+0x12>
+  return vdst;
+}
+ 3ba:	89 f0                	mov    %esi,%eax
+ 3bc:	5b                   	pop    %ebx
+ 3bd:	5e                   	pop    %esi
+ 3be:	5d                   	pop    %ebp
+ 3bf:	c3                   	ret
+
+000003c0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3c0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <exit>:
+SYSCALL(exit)
+ 3c8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <wait>:
+SYSCALL(wait)
+ 3d0:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <pipe>:
+SYSCALL(pipe)
+ 3d8:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <read>:
+SYSCALL(read)
+ 3e0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <write>:
+SYSCALL(write)
+ 3e8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <close>:
+SYSCALL(close)
+ 3f0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <kill>:
+SYSCALL(kill)
+ 3f8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <exec>:
+SYSCALL(exec)
+ 400:	b8 07 00 00 00       	mov    $0x7,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <open>:
+SYSCALL(open)
+ 408:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <mknod>:
+SYSCALL(mknod)
+ 410:	b8 11 00 00 00       	mov    $0x11,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <unlink>:
+SYSCALL(unlink)
+ 418:	b8 12 00 00 00       	mov    $0x12,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <fstat>:
+SYSCALL(fstat)
+ 420:	b8 08 00 00 00       	mov    $0x8,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <link>:
+SYSCALL(link)
+ 428:	b8 13 00 00 00       	mov    $0x13,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <mkdir>:
+SYSCALL(mkdir)
+ 430:	b8 14 00 00 00       	mov    $0x14,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <chdir>:
+SYSCALL(chdir)
+ 438:	b8 09 00 00 00       	mov    $0x9,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <dup>:
+SYSCALL(dup)
+ 440:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <getpid>:
+SYSCALL(getpid)
+ 448:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <sbrk>:
+SYSCALL(sbrk)
+ 450:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <sleep>:
+SYSCALL(sleep)
+ 458:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <uptime>:
+SYSCALL(uptime)
+ 460:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <halt>:
+SYSCALL(halt)
+ 468:	b8 16 00 00 00       	mov    $0x16,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <date>:
+SYSCALL(date)
+ 470:	b8 17 00 00 00       	mov    $0x17,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <getuid>:
+SYSCALL(getuid)
+ 478:	b8 18 00 00 00       	mov    $0x18,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <getgid>:
+SYSCALL(getgid)
+ 480:	b8 19 00 00 00       	mov    $0x19,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <getppid>:
+SYSCALL(getppid)
+ 488:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <setuid>:
+SYSCALL(setuid)
+ 490:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <setgid>:
+SYSCALL(setgid)
+ 498:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <getprocs>:
+SYSCALL(getprocs)
+ 4a0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <getpriority>:
+SYSCALL(getpriority)
+ 4a8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <setpriority>:
+SYSCALL(setpriority)
+ 4b0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <pipesize>:
+SYSCALL(pipesize)
+ 4b8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <splice>:
+SYSCALL(splice)
+ 4c0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4c8:	55                   	push   %ebp
+ 4c9:	89 e5                	mov    %esp,%ebp
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+ 4ce:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4d1:	6a 01                	push   $0x1
+ 4d3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 4d6:	52                   	push   %edx
+ 4d7:	50                   	push   %eax
+ 4d8:	e8 0b ff ff ff       	call   3e8 <write>
+}
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	c9                   	leave
+ 4e1:	c3                   	ret
+
+000004e2 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4e2:	55                   	push   %ebp
+ 4e3:	89 e5                	mov    %esp,%ebp
+ 4e5:	57                   	push   %edi
+ 4e6:	56                   	push   %esi
+ 4e7:	53                   	push   %ebx
+ 4e8:	83 ec 2c             	sub    $0x2c,%esp
+ 4eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 4ee:	89 d0                	mov    %edx,%eax
+ 4f0:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 4f2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 4f6:	0f 95 c1             	setne  %cl
+ 4f9:	c1 ea 1f             	shr    $0x1f,%edx
+ 4fc:	84 d1                	test   %dl,%cl
+ 4fe:	74 44                	je     544 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 500:	f7 d8                	neg    %eax
+ 502:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 504:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 50b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 510:	89 c8                	mov    %ecx,%eax
+ 512:	ba 00 00 00 00       	mov    $0x0,%edx
+ 517:	f7 f6                	div    %esi
+ 519:	89 df                	mov    %ebx,%edi
+ 51b:	83 c3 01             	add    $0x1,%ebx
+ 51e:	0f b6 92 b4 08 00 00 	movzbl 0x8b4(%edx),%edx
+ 525:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 529:	89 ca                	mov    %ecx,%edx
+ 52b:	89 c1                	mov    %eax,%ecx
+ 52d:	39 f2                	cmp    %esi,%edx
+ 52f:	73 df                	jae    510 <printint+0x2e>
+  if(neg)
+ 531:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 535:	74 31                	je     568 <printint+0x86>
+    buf[i++] = '-';
+ 537:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 53c:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 53f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 542:	eb 17                	jmp    55b <printint+0x79>
+    x = xx;
+ 544:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 546:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 54d:	eb bc                	jmp    50b <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 54f:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 554:	89 f0                	mov    %esi,%eax
+ 556:	e8 6d ff ff ff       	call   4c8 <putc>
+  while(--i >= 0)
+ 55b:	83 eb 01             	sub    $0x1,%ebx
+ 55e:	79 ef                	jns    54f <printint+0x6d>
+}
+ 560:	83 c4 2c             	add    $0x2c,%esp
+ 563:	5b                   	pop    %ebx
+ 564:	5e                   	pop    %esi
+ 565:	5f                   	pop    %edi
+ 566:	5d                   	pop    %ebp
+ 567:	c3                   	ret
+ 568:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 56b:	eb ee                	jmp    55b <printint+0x79>
+
+0000056d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 56d:	55                   	push   %ebp
+ 56e:	89 e5                	mov    %esp,%ebp
+ 570:	57                   	push   %edi
+ 571:	56                   	push   %esi
+ 572:	53                   	push   %ebx
+ 573:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 576:	8d 45 10             	lea    0x10(%ebp),%eax
+ 579:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 57c:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 581:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 586:	eb 14                	jmp    59c <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 588:	89 fa                	mov    %edi,%edx
+ 58a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58d:	e8 36 ff ff ff       	call   4c8 <putc>
+ 592:	eb 05                	jmp    599 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 594:	83 fe 25             	cmp    $0x25,%esi
+ 597:	74 25                	je     5be <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 599:	83 c3 01             	add    $0x1,%ebx
+ 59c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59f:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 5a3:	84 c0                	test   %al,%al
+ 5a5:	0f 84 20 01 00 00    	je     6cb <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 5ab:	0f be f8             	movsbl %al,%edi
+ 5ae:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 5b1:	85 f6                	test   %esi,%esi
+ 5b3:	75 df                	jne    594 <printf+0x27>
+      if(c == '%'){
+ 5b5:	83 f8 25             	cmp    $0x25,%eax
+ 5b8:	75 ce                	jne    588 <printf+0x1b>
+        state = '%';
+ 5ba:	89 c6                	mov    %eax,%esi
+ 5bc:	eb db                	jmp    599 <printf+0x2c>
+      if(c == 'd'){
+ 5be:	83 f8 25             	cmp    $0x25,%eax
+ 5c1:	0f 84 cf 00 00 00    	je     696 <printf+0x129>
+ 5c7:	0f 8c dd 00 00 00    	jl     6aa <printf+0x13d>
+ 5cd:	83 f8 78             	cmp    $0x78,%eax
+ 5d0:	0f 8f d4 00 00 00    	jg     6aa <printf+0x13d>
+ 5d6:	83 f8 63             	cmp    $0x63,%eax
+ 5d9:	0f 8c cb 00 00 00    	jl     6aa <printf+0x13d>
+ 5df:	83 e8 63             	sub    $0x63,%eax
+ 5e2:	83 f8 15             	cmp    $0x15,%eax
+ 5e5:	0f 87 bf 00 00 00    	ja     6aa <printf+0x13d>
+ 5eb:	ff 24 85 5c 08 00 00 	jmp    *0x85c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 5f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5f5:	8b 17                	mov    (%edi),%edx
+ 5f7:	83 ec 0c             	sub    $0xc,%esp
+ 5fa:	6a 01                	push   $0x1
+ 5fc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 601:	8b 45 08             	mov    0x8(%ebp),%eax
+ 604:	e8 d9 fe ff ff       	call   4e2 <printint>
+        ap++;
+ 609:	83 c7 04             	add    $0x4,%edi
+ 60c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 60f:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 612:	be 00 00 00 00       	mov    $0x0,%esi
+ 617:	eb 80                	jmp    599 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 619:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 61c:	8b 17                	mov    (%edi),%edx
+ 61e:	83 ec 0c             	sub    $0xc,%esp
+ 621:	6a 00                	push   $0x0
+ 623:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 628:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62b:	e8 b2 fe ff ff       	call   4e2 <printint>
+        ap++;
+ 630:	83 c7 04             	add    $0x4,%edi
+ 633:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 636:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 639:	be 00 00 00 00       	mov    $0x0,%esi
+ 63e:	e9 56 ff ff ff       	jmp    599 <printf+0x2c>
+        s = (char*)*ap;
+ 643:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 646:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 648:	83 c0 04             	add    $0x4,%eax
+ 64b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 64e:	85 f6                	test   %esi,%esi
+ 650:	75 15                	jne    667 <printf+0xfa>
+          s = "(null)";
+ 652:	be 53 08 00 00       	mov    $0x853,%esi
+ 657:	eb 0e                	jmp    667 <printf+0xfa>
+          putc(fd, *s);
+ 659:	0f be d2             	movsbl %dl,%edx
+ 65c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65f:	e8 64 fe ff ff       	call   4c8 <putc>
+          s++;
+ 664:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 667:	0f b6 16             	movzbl (%esi),%edx
+ 66a:	84 d2                	test   %dl,%dl
+ 66c:	75 eb                	jne    659 <printf+0xec>
+      state = 0;
+ 66e:	be 00 00 00 00       	mov    $0x0,%esi
+ 673:	e9 21 ff ff ff       	jmp    599 <printf+0x2c>
+        putc(fd, *ap);
+ 678:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 67b:	0f be 17             	movsbl (%edi),%edx
+ 67e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 681:	e8 42 fe ff ff       	call   4c8 <putc>
+        ap++;
+ 686:	83 c7 04             	add    $0x4,%edi
+ 689:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 68c:	be 00 00 00 00       	mov    $0x0,%esi
+ 691:	e9 03 ff ff ff       	jmp    599 <printf+0x2c>
+        putc(fd, c);
+ 696:	89 fa                	mov    %edi,%edx
+ 698:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69b:	e8 28 fe ff ff       	call   4c8 <putc>
+      state = 0;
+ 6a0:	be 00 00 00 00       	mov    $0x0,%esi
+ 6a5:	e9 ef fe ff ff       	jmp    599 <printf+0x2c>
+        putc(fd, '%');
+ 6aa:	ba 25 00 00 00       	mov    $0x25,%edx
+ 6af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b2:	e8 11 fe ff ff       	call   4c8 <putc>
+        putc(fd, c);
+ 6b7:	89 fa                	mov    %edi,%edx
+ 6b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6bc:	e8 07 fe ff ff       	call   4c8 <putc>
+      state = 0;
+ 6c1:	be 00 00 00 00       	mov    $0x0,%esi
+ 6c6:	e9 ce fe ff ff       	jmp    599 <printf+0x2c>
+    }
+  }
+}
+ 6cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ce:	5b                   	pop    %ebx
+ 6cf:	5e                   	pop    %esi
+ 6d0:	5f                   	pop    %edi
+ 6d1:	5d                   	pop    %ebp
+ 6d2:	c3                   	ret
+
+000006d3 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6d3:	55                   	push   %ebp
+ 6d4:	89 e5                	mov    %esp,%ebp
+ 6d6:	57                   	push   %edi
+ 6d7:	56                   	push   %esi
+ 6d8:	53                   	push   %ebx
+ 6d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6dc:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6df:	a1 00 0e 00 00       	mov    0xe00,%eax
+ 6e4:	eb 02                	jmp    6e8 <free+0x15>
+ 6e6:	89 d0                	mov    %edx,%eax
+ 6e8:	39 c8                	cmp    %ecx,%eax
+ 6ea:	73 04                	jae    6f0 <free+0x1d>
+ 6ec:	3b 08                	cmp    (%eax),%ecx
+ 6ee:	72 12                	jb     702 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6f0:	8b 10                	mov    (%eax),%edx
+ 6f2:	39 d0                	cmp    %edx,%eax
+ 6f4:	72 f0                	jb     6e6 <free+0x13>
+ 6f6:	39 c8                	cmp    %ecx,%eax
+ 6f8:	72 08                	jb     702 <free+0x2f>
+ 6fa:	39 d1                	cmp    %edx,%ecx
+ 6fc:	72 04                	jb     702 <free+0x2f>
+ 6fe:	89 d0                	mov    %edx,%eax
+ 700:	eb e6                	jmp    6e8 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 702:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 705:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 708:	8b 10                	mov    (%eax),%edx
+ 70a:	39 d7                	cmp    %edx,%edi
+ 70c:	74 19                	je     727 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 70e:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 711:	8b 50 04             	mov    0x4(%eax),%edx
+ 714:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 717:	39 ce                	cmp    %ecx,%esi
+ 719:	74 1b                	je     736 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 71b:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 71d:	a3 00 0e 00 00       	mov    %eax,0xe00
+}
+ 722:	5b                   	pop    %ebx
+ 723:	5e                   	pop    %esi
+ 724:	5f                   	pop    %edi
+ 725:	5d                   	pop    %ebp
+ 726:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 727:	03 72 04             	add    0x4(%edx),%esi
+ 72a:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 72d:	8b 10                	mov    (%eax),%edx
+ 72f:	8b 12                	mov    (%edx),%edx
+ 731:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 734:	eb db                	jmp    711 <free+0x3e>
+    p->s.size += bp->s.size;
+ 736:	03 53 fc             	add    -0x4(%ebx),%edx
+ 739:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 73c:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 73f:	89 10                	mov    %edx,(%eax)
+ 741:	eb da                	jmp    71d <free+0x4a>
+
+00000743 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 743:	55                   	push   %ebp
+ 744:	89 e5                	mov    %esp,%ebp
+ 746:	53                   	push   %ebx
+ 747:	83 ec 04             	sub    $0x4,%esp
+ 74a:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 74c:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 751:	77 05                	ja     758 <morecore+0x15>
+    nu = 4096;
+ 753:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 758:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 75f:	83 ec 0c             	sub    $0xc,%esp
+ 762:	50                   	push   %eax
+ 763:	e8 e8 fc ff ff       	call   450 <sbrk>
+  if(p == (char*)-1)
+ 768:	83 c4 10             	add    $0x10,%esp
+ 76b:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 76e:	74 1c                	je     78c <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 770:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 773:	83 c0 08             	add    $0x8,%eax
+ 776:	83 ec 0c             	sub    $0xc,%esp
+ 779:	50                   	push   %eax
+ 77a:	e8 54 ff ff ff       	call   6d3 <free>
+  return freep;
+ 77f:	a1 00 0e 00 00       	mov    0xe00,%eax
+ 784:	83 c4 10             	add    $0x10,%esp
+}
+ 787:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 78a:	c9                   	leave
+ 78b:	c3                   	ret
+    return 0;
+ 78c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 791:	eb f4                	jmp    787 <morecore+0x44>
+
+00000793 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 793:	55                   	push   %ebp
+ 794:	89 e5                	mov    %esp,%ebp
+ 796:	53                   	push   %ebx
+ 797:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 79a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79d:	8d 58 07             	lea    0x7(%eax),%ebx
+ 7a0:	c1 eb 03             	shr    $0x3,%ebx
+ 7a3:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 7a6:	8b 0d 00 0e 00 00    	mov    0xe00,%ecx
+ 7ac:	85 c9                	test   %ecx,%ecx
+ 7ae:	74 04                	je     7b4 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7b0:	8b 01                	mov    (%ecx),%eax
+ 7b2:	eb 4a                	jmp    7fe <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 7b4:	c7 05 00 0e 00 00 04 	movl   $0xe04,0xe00
+ 7bb:	0e 00 00 
+ 7be:	c7 05 04 0e 00 00 04 	movl   $0xe04,0xe04
+ 7c5:	0e 00 00 
+    base.s.size = 0;
+ 7c8:	c7 05 08 0e 00 00 00 	movl   $0x0,0xe08
+ 7cf:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 7d2:	b9 04 0e 00 00       	mov    $0xe04,%ecx
+ 7d7:	eb d7                	jmp    7b0 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 7d9:	74 19                	je     7f4 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7db:	29 da                	sub    %ebx,%edx
+ 7dd:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7e0:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 7e3:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7e6:	89 0d 00 0e 00 00    	mov    %ecx,0xe00
+      return (void*)(p + 1);
+ 7ec:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7f2:	c9                   	leave
+ 7f3:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7f4:	8b 10                	mov    (%eax),%edx
+ 7f6:	89 11                	mov    %edx,(%ecx)
+ 7f8:	eb ec                	jmp    7e6 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7fa:	89 c1                	mov    %eax,%ecx
+ 7fc:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 7fe:	8b 50 04             	mov    0x4(%eax),%edx
+ 801:	39 da                	cmp    %ebx,%edx
+ 803:	73 d4                	jae    7d9 <malloc+0x46>
+    if(p == freep)
+ 805:	39 05 00 0e 00 00    	cmp    %eax,0xe00
+ 80b:	75 ed                	jne    7fa <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 80d:	89 d8                	mov    %ebx,%eax
+ 80f:	e8 2f ff ff ff       	call   743 <morecore>
+ 814:	85 c0                	test   %eax,%eax
+ 816:	75 e2                	jne    7fa <malloc+0x67>
+ 818:	eb d5                	jmp    7ef <malloc+0x5c>
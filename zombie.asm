@@ -0,0 +1,1158 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 74 02 00 00       	call   28a <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7f 05                	jg     1f <main+0x1f>
+    sleep(5);  // Let child exit before parent.
+  exit();
+  1a:	e8 73 02 00 00       	call   292 <exit>
+    sleep(5);  // Let child exit before parent.
+  1f:	83 ec 0c             	sub    $0xc,%esp
+  22:	6a 05                	push   $0x5
+  24:	e8 f9 02 00 00       	call   322 <sleep>
+  29:	83 c4 10             	add    $0x10,%esp
+  2c:	eb ec                	jmp    1a <main+0x1a>
+
+0000002e <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  2e:	55                   	push   %ebp
+  2f:	89 e5                	mov    %esp,%ebp
+  31:	56                   	push   %esi
+  32:	53                   	push   %ebx
+  33:	8b 75 08             	mov    0x8(%ebp),%esi
+  36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  39:	89 f0                	mov    %esi,%eax
+  3b:	89 d1                	mov    %edx,%ecx
+  3d:	83 c2 01             	add    $0x1,%edx
+  40:	89 c3                	mov    %eax,%ebx
+  42:	83 c0 01             	add    $0x1,%eax
+  45:	0f b6 09             	movzbl (%ecx),%ecx
+  48:	88 0b                	mov    %cl,(%ebx)
+  4a:	84 c9                	test   %cl,%cl
+  4c:	75 ed                	jne    3b <strcpy+0xd>
+    ;
+  return os;
+}
+  4e:	89 f0                	mov    %esi,%eax
+  50:	5b                   	pop    %ebx
+  51:	5e                   	pop    %esi
+  52:	5d                   	pop    %ebp
+  53:	c3                   	ret
+
+00000054 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  54:	55                   	push   %ebp
+  55:	89 e5                	mov    %esp,%ebp
+  57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  5d:	eb 06                	jmp    65 <strcmp+0x11>
+    p++, q++;
+  5f:	83 c1 01             	add    $0x1,%ecx
+  62:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  65:	0f b6 01             	movzbl (%ecx),%eax
+  68:	84 c0                	test   %al,%al
+  6a:	74 04                	je     70 <strcmp+0x1c>
+  6c:	3a 02                	cmp    (%edx),%al
+  6e:	74 ef                	je     5f <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+  70:	0f b6 c0             	movzbl %al,%eax
+  73:	0f b6 12             	movzbl (%edx),%edx
+  76:	29 d0                	sub    %edx,%eax
+}
+  78:	5d                   	pop    %ebp
+  79:	c3                   	ret
+
+0000007a <strlen>:
+
+uint
+strlen(char *s)
+{
+  7a:	55                   	push   %ebp
+  7b:	89 e5                	mov    %esp,%ebp
+  7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  80:	b8 00 00 00 00       	mov    $0x0,%eax
+  85:	eb 03                	jmp    8a <strlen+0x10>
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8e:	75 f7                	jne    87 <strlen+0xd>
+    ;
+  return n;
+}
+  90:	5d                   	pop    %ebp
+  91:	c3                   	ret
+
+00000092 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  92:	55                   	push   %ebp
+  93:	89 e5                	mov    %esp,%ebp
+  95:	57                   	push   %edi
+  96:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  99:	89 d7                	mov    %edx,%edi
+  9b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a1:	fc                   	cld
+  a2:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  a4:	89 d0                	mov    %edx,%eax
+  a6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  a9:	c9                   	leave
+  aa:	c3                   	ret
+
+000000ab <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  ab:	55                   	push   %ebp
+  ac:	89 e5                	mov    %esp,%ebp
+  ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  b1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  b5:	eb 03                	jmp    ba <strchr+0xf>
+  b7:	83 c0 01             	add    $0x1,%eax
+  ba:	0f b6 10             	movzbl (%eax),%edx
+  bd:	84 d2                	test   %dl,%dl
+  bf:	74 06                	je     c7 <strchr+0x1c>
+    if(*s == c)
+  c1:	38 ca                	cmp    %cl,%dl
+  c3:	75 f2                	jne    b7 <strchr+0xc>
+  c5:	eb 05                	jmp    cc <strchr+0x21>
+      return (char*)s;
+  return 0;
+  c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  cc:	5d                   	pop    %ebp
+  cd:	c3                   	ret
+
+000000ce <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  ce:	55                   	push   %ebp
+  cf:	89 e5                	mov    %esp,%ebp
+  d1:	57                   	push   %edi
+  d2:	56                   	push   %esi
+  d3:	53                   	push   %ebx
+  d4:	83 ec 1c             	sub    $0x1c,%esp
+  d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  df:	89 de                	mov    %ebx,%esi
+  e1:	83 c3 01             	add    $0x1,%ebx
+  e4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+  e7:	7d 2e                	jge    117 <gets+0x49>
+    cc = read(0, &c, 1);
+  e9:	83 ec 04             	sub    $0x4,%esp
+  ec:	6a 01                	push   $0x1
+  ee:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  f1:	50                   	push   %eax
+  f2:	6a 00                	push   $0x0
+  f4:	e8 b1 01 00 00       	call   2aa <read>
+    if(cc < 1)
+  f9:	83 c4 10             	add    $0x10,%esp
+  fc:	85 c0                	test   %eax,%eax
+  fe:	7e 17                	jle    117 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 100:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 104:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 107:	3c 0a                	cmp    $0xa,%al
+ 109:	0f 94 c2             	sete   %dl
+ 10c:	3c 0d                	cmp    $0xd,%al
+ 10e:	0f 94 c0             	sete   %al
+ 111:	08 c2                	or     %al,%dl
+ 113:	74 ca                	je     df <gets+0x11>
+    buf[i++] = c;
+ 115:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 117:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 11b:	89 f8                	mov    %edi,%eax
+ 11d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 120:	5b                   	pop    %ebx
+ 121:	5e                   	pop    %esi
+ 122:	5f                   	pop    %edi
+ 123:	5d                   	pop    %ebp
+ 124:	c3                   	ret
+
+00000125 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 125:	55                   	push   %ebp
+ 126:	89 e5                	mov    %esp,%ebp
+ 128:	56                   	push   %esi
+ 129:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 12a:	83 ec 08             	sub    $0x8,%esp
+ 12d:	6a 00                	push   $0x0
+ 12f:	ff 75 08             	push   0x8(%ebp)
+ 132:	e8 9b 01 00 00       	call   2d2 <open>
+  if(fd < 0)
+ 137:	83 c4 10             	add    $0x10,%esp
+ 13a:	85 c0                	test   %eax,%eax
+ 13c:	78 24                	js     162 <stat+0x3d>
+ 13e:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 140:	83 ec 08             	sub    $0x8,%esp
+ 143:	ff 75 0c             	push   0xc(%ebp)
+ 146:	50                   	push   %eax
+ 147:	e8 9e 01 00 00       	call   2ea <fstat>
+ 14c:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 14e:	89 1c 24             	mov    %ebx,(%esp)
+ 151:	e8 64 01 00 00       	call   2ba <close>
+  return r;
+ 156:	83 c4 10             	add    $0x10,%esp
+}
+ 159:	89 f0                	mov    %esi,%eax
+ 15b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 15e:	5b                   	pop    %ebx
+ 15f:	5e                   	pop    %esi
+ 160:	5d                   	pop    %ebp
+ 161:	c3                   	ret
+    return -1;
+ 162:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 167:	eb f0                	jmp    159 <stat+0x34>
+
+00000169 <atoi>:
+
+#ifdef PDX_XV6
+int
+atoi(const char *s)
+{
+ 169:	55                   	push   %ebp
+ 16a:	89 e5                	mov    %esp,%ebp
+ 16c:	56                   	push   %esi
+ 16d:	53                   	push   %ebx
+ 16e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 171:	eb 03                	jmp    176 <atoi+0xd>
+ 173:	83 c2 01             	add    $0x1,%edx
+ 176:	0f b6 02             	movzbl (%edx),%eax
+ 179:	3c 20                	cmp    $0x20,%al
+ 17b:	74 f6                	je     173 <atoi+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 17d:	3c 2d                	cmp    $0x2d,%al
+ 17f:	74 1d                	je     19e <atoi+0x35>
+ 181:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 186:	3c 2b                	cmp    $0x2b,%al
+ 188:	0f 94 c1             	sete   %cl
+ 18b:	3c 2d                	cmp    $0x2d,%al
+ 18d:	0f 94 c0             	sete   %al
+ 190:	08 c1                	or     %al,%cl
+ 192:	74 03                	je     197 <atoi+0x2e>
+    s++;
+ 194:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 197:	b8 00 00 00 00       	mov    $0x0,%eax
+ 19c:	eb 17                	jmp    1b5 <atoi+0x4c>
+ 19e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1a3:	eb e1                	jmp    186 <atoi+0x1d>
+  while('0' <= *s && *s <= '9')
+    n = n*10 + *s++ - '0';
+ 1a5:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 1a8:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+ 1ab:	83 c2 01             	add    $0x1,%edx
+ 1ae:	0f be c9             	movsbl %cl,%ecx
+ 1b1:	8d 44 01 d0          	lea    -0x30(%ecx,%eax,1),%eax
+  while('0' <= *s && *s <= '9')
+ 1b5:	0f b6 0a             	movzbl (%edx),%ecx
+ 1b8:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 1bb:	80 fb 09             	cmp    $0x9,%bl
+ 1be:	76 e5                	jbe    1a5 <atoi+0x3c>
+  return sign*n;
+ 1c0:	0f af c6             	imul   %esi,%eax
+}
+ 1c3:	5b                   	pop    %ebx
+ 1c4:	5e                   	pop    %esi
+ 1c5:	5d                   	pop    %ebp
+ 1c6:	c3                   	ret
+
+000001c7 <atoo>:
+
+int
+atoo(const char *s)
+{
+ 1c7:	55                   	push   %ebp
+ 1c8:	89 e5                	mov    %esp,%ebp
+ 1ca:	56                   	push   %esi
+ 1cb:	53                   	push   %ebx
+ 1cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n, sign;
+
+  n = 0;
+  while (*s == ' ') s++;
+ 1cf:	eb 03                	jmp    1d4 <atoo+0xd>
+ 1d1:	83 c2 01             	add    $0x1,%edx
+ 1d4:	0f b6 02             	movzbl (%edx),%eax
+ 1d7:	3c 20                	cmp    $0x20,%al
+ 1d9:	74 f6                	je     1d1 <atoo+0xa>
+  sign = (*s == '-') ? -1 : 1;
+ 1db:	3c 2d                	cmp    $0x2d,%al
+ 1dd:	74 1d                	je     1fc <atoo+0x35>
+ 1df:	be 01 00 00 00       	mov    $0x1,%esi
+  if (*s == '+'  || *s == '-')
+ 1e4:	3c 2b                	cmp    $0x2b,%al
+ 1e6:	0f 94 c1             	sete   %cl
+ 1e9:	3c 2d                	cmp    $0x2d,%al
+ 1eb:	0f 94 c0             	sete   %al
+ 1ee:	08 c1                	or     %al,%cl
+ 1f0:	74 03                	je     1f5 <atoo+0x2e>
+    s++;
+ 1f2:	83 c2 01             	add    $0x1,%edx
+  sign = (*s == '-') ? -1 : 1;
+ 1f5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1fa:	eb 11                	jmp    20d <atoo+0x46>
+ 1fc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 201:	eb e1                	jmp    1e4 <atoo+0x1d>
+  while('0' <= *s && *s <= '7')
+    n = n*8 + *s++ - '0';
+ 203:	83 c2 01             	add    $0x1,%edx
+ 206:	0f be c9             	movsbl %cl,%ecx
+ 209:	8d 44 c1 d0          	lea    -0x30(%ecx,%eax,8),%eax
+  while('0' <= *s && *s <= '7')
+ 20d:	0f b6 0a             	movzbl (%edx),%ecx
+ 210:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+ 213:	80 fb 07             	cmp    $0x7,%bl
+ 216:	76 eb                	jbe    203 <atoo+0x3c>
+  return sign*n;
+ 218:	0f af c6             	imul   %esi,%eax
+}
+ 21b:	5b                   	pop    %ebx
+ 21c:	5e                   	pop    %esi
+ 21d:	5d                   	pop    %ebp
+ 21e:	c3                   	ret
+
+0000021f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 21f:	55                   	push   %ebp
+ 220:	89 e5                	mov    %esp,%ebp
+ 222:	53                   	push   %ebx
+ 223:	8b 55 08             	mov    0x8(%ebp),%edx
+ 226:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 229:	8b 45 10             	mov    0x10(%ebp),%eax
+    while(n > 0 && *p && *p == *q)
+ 22c:	eb 09                	jmp    237 <strncmp+0x18>
+      n--, p++, q++;
+ 22e:	83 e8 01             	sub    $0x1,%eax
+ 231:	83 c2 01             	add    $0x1,%edx
+ 234:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+ 237:	85 c0                	test   %eax,%eax
+ 239:	74 0b                	je     246 <strncmp+0x27>
+ 23b:	0f b6 1a             	movzbl (%edx),%ebx
+ 23e:	84 db                	test   %bl,%bl
+ 240:	74 04                	je     246 <strncmp+0x27>
+ 242:	3a 19                	cmp    (%ecx),%bl
+ 244:	74 e8                	je     22e <strncmp+0xf>
+    if(n == 0)
+ 246:	85 c0                	test   %eax,%eax
+ 248:	74 0d                	je     257 <strncmp+0x38>
+      return 0;
+    return (uchar)*p - (uchar)*q;
+ 24a:	0f b6 02             	movzbl (%edx),%eax
+ 24d:	0f b6 11             	movzbl (%ecx),%edx
+ 250:	29 d0                	sub    %edx,%eax
+}
+ 252:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 255:	c9                   	leave
+ 256:	c3                   	ret
+      return 0;
+ 257:	b8 00 00 00 00       	mov    $0x0,%eax
+ 25c:	eb f4                	jmp    252 <strncmp+0x33>
+
+0000025e <memmove>:
+}
+#endif // PDX_XV6
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 25e:	55                   	push   %ebp
+ 25f:	89 e5                	mov    %esp,%ebp
+ 261:	56                   	push   %esi
+ 262:	53                   	push   %ebx
+ 263:	8b 75 08             	mov    0x8(%ebp),%esi
+ 266:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 269:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst, *src;
+
+  dst = vdst;
+ 26c:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 26e:	eb 0d                	jmp    27d <memmove+0x1f>
+    *dst++ = *src++;
+ 270:	0f b6 01             	movzbl (%ecx),%eax
+ 273:	88 02                	mov    %al,(%edx)
+ 275:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 278:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 27b:	89 d8                	mov    %ebx,%eax
+ 27d:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 280:	85 c0                	test   %eax,%eax
+ 282:	7f ec                	jg     270 <memmove+0x12>
+  return vdst;
+}
+ 284:	89 f0                	mov    %esi,%eax
+ 286:	5b                   	pop    %ebx
+ 287:	5e                   	pop    %esi
+ 288:	5d                   	pop    %ebp
+ 289:	c3                   	ret
+
+0000028a <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 28a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 28f:	cd 40                	int    $0x40
+ 291:	c3                   	ret
+
+00000292 <exit>:
+SYSCALL(exit)
+ 292:	b8 02 00 00 00       	mov    $0x2,%eax
+ 297:	cd 40                	int    $0x40
+ 299:	c3                   	ret
+
+0000029a <wait>:
+SYSCALL(wait)
+ 29a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 29f:	cd 40                	int    $0x40
+ 2a1:	c3                   	ret
+
+000002a2 <pipe>:
+SYSCALL(pipe)
+ 2a2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2a7:	cd 40                	int    $0x40
+ 2a9:	c3                   	ret
+
+000002aa <read>:
+SYSCALL(read)
+ 2aa:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2af:	cd 40                	int    $0x40
+ 2b1:	c3                   	ret
+
+000002b2 <write>:
+SYSCALL(write)
+ 2b2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2b7:	cd 40                	int    $0x40
+ 2b9:	c3                   	ret
+
+000002ba <close>:
+SYSCALL(close)
+ 2ba:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2bf:	cd 40                	int    $0x40
+ 2c1:	c3                   	ret
+
+000002c2 <kill>:
+SYSCALL(kill)
+ 2c2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2c7:	cd 40                	int    $0x40
+ 2c9:	c3                   	ret
+
+000002ca <exec>:
+SYSCALL(exec)
+ 2ca:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2cf:	cd 40                	int    $0x40
+ 2d1:	c3                   	ret
+
+000002d2 <open>:
+SYSCALL(open)
+ 2d2:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2d7:	cd 40                	int    $0x40
+ 2d9:	c3                   	ret
+
+000002da <mknod>:
+SYSCALL(mknod)
+ 2da:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2df:	cd 40                	int    $0x40
+ 2e1:	c3                   	ret
+
+000002e2 <unlink>:
+SYSCALL(unlink)
+ 2e2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2e7:	cd 40                	int    $0x40
+ 2e9:	c3                   	ret
+
+000002ea <fstat>:
+SYSCALL(fstat)
+ 2ea:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2ef:	cd 40                	int    $0x40
+ 2f1:	c3                   	ret
+
+000002f2 <link>:
+SYSCALL(link)
+ 2f2:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2f7:	cd 40                	int    $0x40
+ 2f9:	c3                   	ret
+
+000002fa <mkdir>:
+SYSCALL(mkdir)
+ 2fa:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2ff:	cd 40                	int    $0x40
+ 301:	c3                   	ret
+
+00000302 <chdir>:
+SYSCALL(chdir)
+ 302:	b8 09 00 00 00       	mov    $0x9,%eax
+ 307:	cd 40                	int    $0x40
+ 309:	c3                   	ret
+
+0000030a <dup>:
+SYSCALL(dup)
+ 30a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 30f:	cd 40                	int    $0x40
+ 311:	c3                   	ret
+
+00000312 <getpid>:
+SYSCALL(getpid)
+ 312:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 317:	cd 40                	int    $0x40
+ 319:	c3                   	ret
+
+0000031a <sbrk>:
+SYSCALL(sbrk)
+ 31a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 31f:	cd 40                	int    $0x40
+ 321:	c3                   	ret
+
+00000322 <sleep>:
+SYSCALL(sleep)
+ 322:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 327:	cd 40                	int    $0x40
+ 329:	c3                   	ret
+
+0000032a <uptime>:
+SYSCALL(uptime)
+ 32a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 32f:	cd 40                	int    $0x40
+ 331:	c3                   	ret
+
+00000332 <halt>:
+SYSCALL(halt)
+ 332:	b8 16 00 00 00       	mov    $0x16,%eax
+ 337:	cd 40                	int    $0x40
+ 339:	c3                   	ret
+
+0000033a <date>:
+SYSCALL(date)
+ 33a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 33f:	cd 40                	int    $0x40
+ 341:	c3                   	ret
+
+00000342 <getuid>:
+SYSCALL(getuid)
+ 342:	b8 18 00 00 00       	mov    $0x18,%eax
+ 347:	cd 40                	int    $0x40
+ 349:	c3                   	ret
+
+0000034a <getgid>:
+SYSCALL(getgid)
+ 34a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 34f:	cd 40                	int    $0x40
+ 351:	c3                   	ret
+
+00000352 <getppid>:
+SYSCALL(getppid)
+ 352:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 357:	cd 40                	int    $0x40
+ 359:	c3                   	ret
+
+0000035a <setuid>:
+SYSCALL(setuid)
+ 35a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 35f:	cd 40                	int    $0x40
+ 361:	c3                   	ret
+
+00000362 <setgid>:
+SYSCALL(setgid)
+ 362:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 367:	cd 40                	int    $0x40
+ 369:	c3                   	ret
+
+0000036a <getprocs>:
+SYSCALL(getprocs)
+ 36a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 36f:	cd 40                	int    $0x40
+ 371:	c3                   	ret
+
+00000372 <getpriority>:
+SYSCALL(getpriority)
+ 372:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 377:	cd 40                	int    $0x40
+ 379:	c3                   	ret
+
+0000037a <setpriority>:
+SYSCALL(setpriority)
+ 37a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 37f:	cd 40                	int    $0x40
+ 381:	c3                   	ret
+
+00000382 <pipesize>:
+SYSCALL(pipesize)
+ 382:	b8 20 00 00 00       	mov    $0x20,%eax
+ 387:	cd 40                	int    $0x40
+ 389:	c3                   	ret
+
+0000038a <splice>:
+SYSCALL(splice)
+ 38a:	b8 21 00 00 00       	mov    $0x21,%eax
+ 38f:	cd 40                	int    $0x40
+ 391:	c3                   	ret
+
+00000392 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 392:	55                   	push   %ebp
+ 393:	89 e5                	mov    %esp,%ebp
+ 395:	83 ec 1c             	sub    $0x1c,%esp
+ 398:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 39b:	6a 01                	push   $0x1
+ 39d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3a0:	52                   	push   %edx
+ 3a1:	50                   	push   %eax
+ 3a2:	e8 0b ff ff ff       	call   2b2 <write>
+}
+ 3a7:	83 c4 10             	add    $0x10,%esp
+ 3aa:	c9                   	leave
+ 3ab:	c3                   	ret
+
+000003ac <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3ac:	55                   	push   %ebp
+ 3ad:	89 e5                	mov    %esp,%ebp
+ 3af:	57                   	push   %edi
+ 3b0:	56                   	push   %esi
+ 3b1:	53                   	push   %ebx
+ 3b2:	83 ec 2c             	sub    $0x2c,%esp
+ 3b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3b8:	89 d0                	mov    %edx,%eax
+ 3ba:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3bc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3c0:	0f 95 c1             	setne  %cl
+ 3c3:	c1 ea 1f             	shr    $0x1f,%edx
+ 3c6:	84 d1                	test   %dl,%cl
+ 3c8:	74 44                	je     40e <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3ca:	f7 d8                	neg    %eax
+ 3cc:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3ce:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3da:	89 c8                	mov    %ecx,%eax
+ 3dc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3e1:	f7 f6                	div    %esi
+ 3e3:	89 df                	mov    %ebx,%edi
+ 3e5:	83 c3 01             	add    $0x1,%ebx
+ 3e8:	0f b6 92 44 07 00 00 	movzbl 0x744(%edx),%edx
+ 3ef:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 3f3:	89 ca                	mov    %ecx,%edx
+ 3f5:	89 c1                	mov    %eax,%ecx
+ 3f7:	39 f2                	cmp    %esi,%edx
+ 3f9:	73 df                	jae    3da <printint+0x2e>
+  if(neg)
+ 3fb:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 3ff:	74 31                	je     432 <printint+0x86>
+    buf[i++] = '-';
+ 401:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 406:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 409:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 40c:	eb 17                	jmp    425 <printint+0x79>
+    x = xx;
+ 40e:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 410:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 417:	eb bc                	jmp    3d5 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 419:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 41e:	89 f0                	mov    %esi,%eax
+ 420:	e8 6d ff ff ff       	call   392 <putc>
+  while(--i >= 0)
+ 425:	83 eb 01             	sub    $0x1,%ebx
+ 428:	79 ef                	jns    419 <printint+0x6d>
+}
+ 42a:	83 c4 2c             	add    $0x2c,%esp
+ 42d:	5b                   	pop    %ebx
+ 42e:	5e                   	pop    %esi
+ 42f:	5f                   	pop    %edi
+ 430:	5d                   	pop    %ebp
+ 431:	c3                   	ret
+ 432:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 435:	eb ee                	jmp    425 <printint+0x79>
+
+00000437 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 437:	55                   	push   %ebp
+ 438:	89 e5                	mov    %esp,%ebp
+ 43a:	57                   	push   %edi
+ 43b:	56                   	push   %esi
+ 43c:	53                   	push   %ebx
+ 43d:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 440:	8d 45 10             	lea    0x10(%ebp),%eax
+ 443:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 446:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 44b:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 450:	eb 14                	jmp    466 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 452:	89 fa                	mov    %edi,%edx
+ 454:	8b 45 08             	mov    0x8(%ebp),%eax
+ 457:	e8 36 ff ff ff       	call   392 <putc>
+ 45c:	eb 05                	jmp    463 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 45e:	83 fe 25             	cmp    $0x25,%esi
+ 461:	74 25                	je     488 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 463:	83 c3 01             	add    $0x1,%ebx
+ 466:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 469:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 46d:	84 c0                	test   %al,%al
+ 46f:	0f 84 20 01 00 00    	je     595 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 475:	0f be f8             	movsbl %al,%edi
+ 478:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 47b:	85 f6                	test   %esi,%esi
+ 47d:	75 df                	jne    45e <printf+0x27>
+      if(c == '%'){
+ 47f:	83 f8 25             	cmp    $0x25,%eax
+ 482:	75 ce                	jne    452 <printf+0x1b>
+        state = '%';
+ 484:	89 c6                	mov    %eax,%esi
+ 486:	eb db                	jmp    463 <printf+0x2c>
+      if(c == 'd'){
+ 488:	83 f8 25             	cmp    $0x25,%eax
+ 48b:	0f 84 cf 00 00 00    	je     560 <printf+0x129>
+ 491:	0f 8c dd 00 00 00    	jl     574 <printf+0x13d>
+ 497:	83 f8 78             	cmp    $0x78,%eax
+ 49a:	0f 8f d4 00 00 00    	jg     574 <printf+0x13d>
+ 4a0:	83 f8 63             	cmp    $0x63,%eax
+ 4a3:	0f 8c cb 00 00 00    	jl     574 <printf+0x13d>
+ 4a9:	83 e8 63             	sub    $0x63,%eax
+ 4ac:	83 f8 15             	cmp    $0x15,%eax
+ 4af:	0f 87 bf 00 00 00    	ja     574 <printf+0x13d>
+ 4b5:	ff 24 85 ec 06 00 00 	jmp    *0x6ec(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4bf:	8b 17                	mov    (%edi),%edx
+ 4c1:	83 ec 0c             	sub    $0xc,%esp
+ 4c4:	6a 01                	push   $0x1
+ 4c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ce:	e8 d9 fe ff ff       	call   3ac <printint>
+        ap++;
+ 4d3:	83 c7 04             	add    $0x4,%edi
+ 4d6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 4d9:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4dc:	be 00 00 00 00       	mov    $0x0,%esi
+ 4e1:	eb 80                	jmp    463 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 4e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4e6:	8b 17                	mov    (%edi),%edx
+ 4e8:	83 ec 0c             	sub    $0xc,%esp
+ 4eb:	6a 00                	push   $0x0
+ 4ed:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 4f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f5:	e8 b2 fe ff ff       	call   3ac <printint>
+        ap++;
+ 4fa:	83 c7 04             	add    $0x4,%edi
+ 4fd:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 500:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 503:	be 00 00 00 00       	mov    $0x0,%esi
+ 508:	e9 56 ff ff ff       	jmp    463 <printf+0x2c>
+        s = (char*)*ap;
+ 50d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 510:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 512:	83 c0 04             	add    $0x4,%eax
+ 515:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 518:	85 f6                	test   %esi,%esi
+ 51a:	75 15                	jne    531 <printf+0xfa>
+          s = "(null)";
+ 51c:	be e4 06 00 00       	mov    $0x6e4,%esi
+ 521:	eb 0e                	jmp    531 <printf+0xfa>
+          putc(fd, *s);
+ 523:	0f be d2             	movsbl %dl,%edx
+ 526:	8b 45 08             	mov    0x8(%ebp),%eax
+ 529:	e8 64 fe ff ff       	call   392 <putc>
+          s++;
+ 52e:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 531:	0f b6 16             	movzbl (%esi),%edx
+ 534:	84 d2                	test   %dl,%dl
+ 536:	75 eb                	jne    523 <printf+0xec>
+      state = 0;
+ 538:	be 00 00 00 00       	mov    $0x0,%esi
+ 53d:	e9 21 ff ff ff       	jmp    463 <printf+0x2c>
+        putc(fd, *ap);
+ 542:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 545:	0f be 17             	movsbl (%edi),%edx
+ 548:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54b:	e8 42 fe ff ff       	call   392 <putc>
+        ap++;
+ 550:	83 c7 04             	add    $0x4,%edi
+ 553:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 556:	be 00 00 00 00       	mov    $0x0,%esi
+ 55b:	e9 03 ff ff ff       	jmp    463 <printf+0x2c>
+        putc(fd, c);
+ 560:	89 fa                	mov    %edi,%edx
+ 562:	8b 45 08             	mov    0x8(%ebp),%eax
+ 565:	e8 28 fe ff ff       	call   392 <putc>
+      state = 0;
+ 56a:	be 00 00 00 00       	mov    $0x0,%esi
+ 56f:	e9 ef fe ff ff       	jmp    463 <printf+0x2c>
+        putc(fd, '%');
+ 574:	ba 25 00 00 00       	mov    $0x25,%edx
+ 579:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57c:	e8 11 fe ff ff       	call   392 <putc>
+        putc(fd, c);
+ 581:	89 fa                	mov    %edi,%edx
+ 583:	8b 45 08             	mov    0x8(%ebp),%eax
+ 586:	e8 07 fe ff ff       	call   392 <putc>
+      state = 0;
+ 58b:	be 00 00 00 00       	mov    $0x0,%esi
+ 590:	e9 ce fe ff ff       	jmp    463 <printf+0x2c>
+    }
+  }
+}
+ 595:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 598:	5b                   	pop    %ebx
+ 599:	5e                   	pop    %esi
+ 59a:	5f                   	pop    %edi
+ 59b:	5d                   	pop    %ebp
+ 59c:	c3                   	ret
+
+0000059d <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 59d:	55                   	push   %ebp
+ 59e:	89 e5                	mov    %esp,%ebp
+ 5a0:	57                   	push   %edi
+ 5a1:	56                   	push   %esi
+ 5a2:	53                   	push   %ebx
+ 5a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5a6:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5a9:	a1 38 0a 00 00       	mov    0xa38,%eax
+ 5ae:	eb 02                	jmp    5b2 <free+0x15>
+ 5b0:	89 d0                	mov    %edx,%eax
+ 5b2:	39 c8                	cmp    %ecx,%eax
+ 5b4:	73 04                	jae    5ba <free+0x1d>
+ 5b6:	3b 08                	cmp    (%eax),%ecx
+ 5b8:	72 12                	jb     5cc <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5ba:	8b 10                	mov    (%eax),%edx
+ 5bc:	39 d0                	cmp    %edx,%eax
+ 5be:	72 f0                	jb     5b0 <free+0x13>
+ 5c0:	39 c8                	cmp    %ecx,%eax
+ 5c2:	72 08                	jb     5cc <free+0x2f>
+ 5c4:	39 d1                	cmp    %edx,%ecx
+ 5c6:	72 04                	jb     5cc <free+0x2f>
+ 5c8:	89 d0                	mov    %edx,%eax
+ 5ca:	eb e6                	jmp    5b2 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5cc:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5cf:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5d2:	8b 10                	mov    (%eax),%edx
+ 5d4:	39 d7                	cmp    %edx,%edi
+ 5d6:	74 19                	je     5f1 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 5d8:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 5db:	8b 50 04             	mov    0x4(%eax),%edx
+ 5de:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 5e1:	39 ce                	cmp    %ecx,%esi
+ 5e3:	74 1b                	je     600 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 5e5:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 5e7:	a3 38 0a 00 00       	mov    %eax,0xa38
+}
+ 5ec:	5b                   	pop    %ebx
+ 5ed:	5e                   	pop    %esi
+ 5ee:	5f                   	pop    %edi
+ 5ef:	5d                   	pop    %ebp
+ 5f0:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 5f1:	03 72 04             	add    0x4(%edx),%esi
+ 5f4:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5f7:	8b 10                	mov    (%eax),%edx
+ 5f9:	8b 12                	mov    (%edx),%edx
+ 5fb:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 5fe:	eb db                	jmp    5db <free+0x3e>
+    p->s.size += bp->s.size;
+ 600:	03 53 fc             	add    -0x4(%ebx),%edx
+ 603:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 606:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 609:	89 10                	mov    %edx,(%eax)
+ 60b:	eb da                	jmp    5e7 <free+0x4a>
+
+0000060d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 60d:	55                   	push   %ebp
+ 60e:	89 e5                	mov    %esp,%ebp
+ 610:	53                   	push   %ebx
+ 611:	83 ec 04             	sub    $0x4,%esp
+ 614:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 616:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 61b:	77 05                	ja     622 <morecore+0x15>
+    nu = 4096;
+ 61d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 622:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 629:	83 ec 0c             	sub    $0xc,%esp
+ 62c:	50                   	push   %eax
+ 62d:	e8 e8 fc ff ff       	call   31a <sbrk>
+  if(p == (char*)-1)
+ 632:	83 c4 10             	add    $0x10,%esp
+ 635:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 638:	74 1c                	je     656 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 63a:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 63d:	83 c0 08             	add    $0x8,%eax
+ 640:	83 ec 0c             	sub    $0xc,%esp
+ 643:	50                   	push   %eax
+ 644:	e8 54 ff ff ff       	call   59d <free>
+  return freep;
+ 649:	a1 38 0a 00 00       	mov    0xa38,%eax
+ 64e:	83 c4 10             	add    $0x10,%esp
+}
+ 651:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 654:	c9                   	leave
+ 655:	c3                   	ret
+    return 0;
+ 656:	b8 00 00 00 00       	mov    $0x0,%eax
+ 65b:	eb f4                	jmp    651 <morecore+0x44>
+
+0000065d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 65d:	55                   	push   %ebp
+ 65e:	89 e5                	mov    %esp,%ebp
+ 660:	53                   	push   %ebx
+ 661:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 664:	8b 45 08             	mov    0x8(%ebp),%eax
+ 667:	8d 58 07             	lea    0x7(%eax),%ebx
+ 66a:	c1 eb 03             	shr    $0x3,%ebx
+ 66d:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 670:	8b 0d 38 0a 00 00    	mov    0xa38,%ecx
+ 676:	85 c9                	test   %ecx,%ecx
+ 678:	74 04                	je     67e <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 67a:	8b 01                	mov    (%ecx),%eax
+ 67c:	eb 4a                	jmp    6c8 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 67e:	c7 05 38 0a 00 00 3c 	movl   $0xa3c,0xa38
+ 685:	0a 00 00 
+ 688:	c7 05 3c 0a 00 00 3c 	movl   $0xa3c,0xa3c
+ 68f:	0a 00 00 
+    base.s.size = 0;
+ 692:	c7 05 40 0a 00 00 00 	movl   $0x0,0xa40
+ 699:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 69c:	b9 3c 0a 00 00       	mov    $0xa3c,%ecx
+ 6a1:	eb d7                	jmp    67a <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 6a3:	74 19                	je     6be <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6a5:	29 da                	sub    %ebx,%edx
+ 6a7:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 6aa:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 6ad:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6b0:	89 0d 38 0a 00 00    	mov    %ecx,0xa38
+      return (void*)(p + 1);
+ 6b6:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6bc:	c9                   	leave
+ 6bd:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6be:	8b 10                	mov    (%eax),%edx
+ 6c0:	89 11                	mov    %edx,(%ecx)
+ 6c2:	eb ec                	jmp    6b0 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6c4:	89 c1                	mov    %eax,%ecx
+ 6c6:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 6c8:	8b 50 04             	mov    0x4(%eax),%edx
+ 6cb:	39 da                	cmp    %ebx,%edx
+ 6cd:	73 d4                	jae    6a3 <malloc+0x46>
+    if(p == freep)
+ 6cf:	39 05 38 0a 00 00    	cmp    %eax,0xa38
+ 6d5:	75 ed                	jne    6c4 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 6d7:	89 d8                	mov    %ebx,%eax
+ 6d9:	e8 2f ff ff ff       	call   60d <morecore>
+ 6de:	85 c0                	test   %eax,%eax
+ 6e0:	75 e2                	jne    6c4 <malloc+0x67>
+ 6e2:	eb d5                	jmp    6b9 <malloc+0x5c>